@@ -94,8 +94,8 @@ void Gambit_fn_0206D2FC(CPUState* cpu) {
   L_0206D2FC: ; // 0x206d2fc
         /* 0206D2FC */ _t0 = cpu->r[3] + 0x00000224u;
         /* 0206D2FC */ cpu->r[0] = rbrew_read8(cpu->mem, _t0);
-        /* 0206D300 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206D304 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D300 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206D304 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D304 */ _t2 = _t1 & 0x00000001u;
         /* 0206D304 */ if (_t2) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206D304 */ goto L_0206D308;
@@ -115,8 +115,8 @@ void Gambit_fn_0206D2FC(CPUState* cpu) {
         /* 020B75DC */ _t6 = cpu->r[3] + 0x00003400u;
         /* 020B75DC */ cpu->r[3] = rbrew_read32(cpu->mem, _t6);
         /* 020B75E0 */ Gambit_fn_0206C030(cpu);
-        /* 020B75E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B75E8 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B75E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B75E8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B75E8 */ _t8 = _t7 & 0x00000001u;
         /* 020B75E8 */ if (_t8) goto L_020B7600; else goto L_020B75EC;
   L_020B75EC: ; // 0x20b75ec
@@ -148,15 +148,15 @@ void Gambit_fn_0206D30C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0206D30C: ; // 0x206d30c
-        /* 0206D30C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206D310 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D30C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206D310 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D310 */ _t1 = _t0 & 0x00000001u;
         /* 0206D310 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206D310 */ goto L_0206D314;
   L_0206D314: ; // 0x206d314
         /* 0206D314 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206D314 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206D318 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D314 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206D318 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D318 */ _t3 = _t2 & 0x00000001u;
         /* 0206D318 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206D318 */ goto L_0206D31C;
@@ -175,8 +175,8 @@ void Gambit_fn_0206D30C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -190,15 +190,15 @@ void Gambit_fn_0206D30C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -235,11 +235,11 @@ void Gambit_fn_0206D320(CPUState* cpu) {
         /* 0206D32C */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0206D32C */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0206D330 */ cpu->r[30] = cpu->r[3];
-        /* 0206D330 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0206D330 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0206D334 */ cpu->r[31] = cpu->r[4];
         /* 0206D338 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0206D338 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0206D33C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D33C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D33C */ _t5 = _t4 & 0x00000001u;
         /* 0206D33C */ if (_t5) goto L_0206D3AC; else goto L_0206D340;
   L_0206D340: ; // 0x206d340
@@ -253,10 +253,10 @@ void Gambit_fn_0206D320(CPUState* cpu) {
         /* 0206D358 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0206D358 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0206D35C */ cpu->r[11] = cpu->r[11] + 0xFFFF840Cu;
-        /* 0206D360 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0206D360 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0206D364 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0206D364 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0206D368 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D368 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D368 */ _t10 = _t9 & 0x00000001u;
         /* 0206D368 */ if (_t10) goto L_0206D39C; else goto L_0206D36C;
   L_0206D36C: ; // 0x206d36c
@@ -277,8 +277,8 @@ void Gambit_fn_0206D320(CPUState* cpu) {
         /* 0206D398 */ Gambit_fn_02068798(cpu);
   L_0206D39C: ; // 0x206d39c
         /* 0206D39C */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206D39C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0206D3A0 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D39C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0206D3A0 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D3A0 */ _t15 = _t14 & 0x00000001u;
         /* 0206D3A0 */ if (_t15) goto L_0206D3AC; else goto L_0206D3A4;
   L_0206D3A4: ; // 0x206d3a4
@@ -309,11 +309,11 @@ void Gambit_fn_0206D324(CPUState* cpu) {
         /* 0206D32C */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0206D32C */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0206D330 */ cpu->r[30] = cpu->r[3];
-        /* 0206D330 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0206D330 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0206D334 */ cpu->r[31] = cpu->r[4];
         /* 0206D338 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0206D338 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0206D33C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D33C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D33C */ _t5 = _t4 & 0x00000001u;
         /* 0206D33C */ if (_t5) goto L_0206D3AC; else goto L_0206D340;
   L_0206D340: ; // 0x206d340
@@ -327,10 +327,10 @@ void Gambit_fn_0206D324(CPUState* cpu) {
         /* 0206D358 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0206D358 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0206D35C */ cpu->r[11] = cpu->r[11] + 0xFFFF840Cu;
-        /* 0206D360 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0206D360 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0206D364 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0206D364 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0206D368 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D368 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D368 */ _t10 = _t9 & 0x00000001u;
         /* 0206D368 */ if (_t10) goto L_0206D39C; else goto L_0206D36C;
   L_0206D36C: ; // 0x206d36c
@@ -351,8 +351,8 @@ void Gambit_fn_0206D324(CPUState* cpu) {
         /* 0206D398 */ Gambit_fn_02068798(cpu);
   L_0206D39C: ; // 0x206d39c
         /* 0206D39C */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206D39C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0206D3A0 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D39C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0206D3A0 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D3A0 */ _t15 = _t14 & 0x00000001u;
         /* 0206D3A0 */ if (_t15) goto L_0206D3AC; else goto L_0206D3A4;
   L_0206D3A4: ; // 0x206d3a4
@@ -407,15 +407,15 @@ void Gambit_fn_0206D3DC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0206D3DC: ; // 0x206d3dc
-        /* 0206D3DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206D3E0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D3DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206D3E0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D3E0 */ _t1 = _t0 & 0x00000001u;
         /* 0206D3E0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206D3E0 */ goto L_0206D3E4;
   L_0206D3E4: ; // 0x206d3e4
         /* 0206D3E4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206D3E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206D3E8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D3E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206D3E8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D3E8 */ _t3 = _t2 & 0x00000001u;
         /* 0206D3E8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206D3E8 */ goto L_0206D3EC;
@@ -434,8 +434,8 @@ void Gambit_fn_0206D3DC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -449,15 +449,15 @@ void Gambit_fn_0206D3DC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -513,15 +513,15 @@ void Gambit_fn_0206D414(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0206D414: ; // 0x206d414
-        /* 0206D414 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206D418 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D414 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206D418 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D418 */ _t1 = _t0 & 0x00000001u;
         /* 0206D418 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206D418 */ goto L_0206D41C;
   L_0206D41C: ; // 0x206d41c
         /* 0206D41C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206D41C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206D420 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D41C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206D420 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D420 */ _t3 = _t2 & 0x00000001u;
         /* 0206D420 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206D420 */ goto L_0206D424;
@@ -540,8 +540,8 @@ void Gambit_fn_0206D414(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -555,15 +555,15 @@ void Gambit_fn_0206D414(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -591,15 +591,15 @@ void Gambit_fn_0206D428(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0206D428: ; // 0x206d428
-        /* 0206D428 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206D42C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D428 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206D42C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D42C */ _t1 = _t0 & 0x00000001u;
         /* 0206D42C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206D42C */ goto L_0206D430;
   L_0206D430: ; // 0x206d430
         /* 0206D430 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206D430 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206D434 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D430 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206D434 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D434 */ _t3 = _t2 & 0x00000001u;
         /* 0206D434 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206D434 */ goto L_0206D438;
@@ -618,8 +618,8 @@ void Gambit_fn_0206D428(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -633,15 +633,15 @@ void Gambit_fn_0206D428(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -737,9 +737,9 @@ void Gambit_fn_0206D474(CPUState* cpu) {
         /* 0206D478 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 0206D478 */ cpu->r[9] = _t0;
         /* 0206D47C */ cpu->r[12] = 0x101D0000u;
-        /* 0206D480 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0206D480 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0206D484 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 0206D488 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D488 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D488 */ _t2 = _t1 & 0x00000001u;
         /* 0206D488 */ if (_t2) goto L_0206D48C; else goto L_0206D4A0;
   L_0206D48C: ; // 0x206d48c
@@ -751,8 +751,8 @@ void Gambit_fn_0206D474(CPUState* cpu) {
         /* 0206D49C */ _t4 = cpu->r[12] + 0x00000000u;
         /* 0206D49C */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_0206D4A0: ; // 0x206d4a0
-        /* 0206D4A0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0206D4A4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D4A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0206D4A4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D4A4 */ _t6 = _t5 & 0x00000001u;
         /* 0206D4A4 */ if (_t6) goto L_0206D4A8; else goto L_0206D4B0;
   L_0206D4A8: ; // 0x206d4a8
@@ -764,9 +764,9 @@ void Gambit_fn_0206D474(CPUState* cpu) {
         /* 0206D4B4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 0206D4B4 */ cpu->r[7] = _t7;
         /* 0206D4B8 */ cpu->r[11] = 0x101D0000u;
-        /* 0206D4BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0206D4BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0206D4C0 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 0206D4C4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D4C4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D4C4 */ _t9 = _t8 & 0x00000001u;
         /* 0206D4C4 */ if (_t9) goto L_0206D4C8; else goto L_0206D4DC;
   L_0206D4C8: ; // 0x206d4c8
@@ -887,18 +887,18 @@ void Gambit_fn_0206D52C(CPUState* cpu) {
         /* 02008980 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02008980 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02008984 */ cpu->r[12] = 0x00000000u;
-        /* 02008988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02008988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0200898C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0200898C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02008990 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02008990 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02008990 */ _t6 = _t5 & 0x00000001u;
         /* 02008990 */ if (_t6) goto L_020089B8; else goto L_02008994;
   L_02008994: ; // 0x2008994
         /* 02008994 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02008994 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02008998 */ /* nop */
-        /* 0200899C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 020089A0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0200899C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 020089A0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020089A0 */ _t9 = _t8 & 0x00000001u;
         /* 020089A0 */ if (_t9) goto L_020089A4; else goto L_020089B8;
   L_020089A4: ; // 0x20089a4
@@ -972,8 +972,8 @@ void Gambit_fn_0206D53C(CPUState* cpu) {
         /* 0206D584 */ _t7 = cpu->r[30] + 0x0000002Cu;
         /* 0206D584 */ cpu->r[31] = rbrew_read32(cpu->mem, _t7);
         /* 0206D588 */ Gambit_fn_02801A78(cpu);
-        /* 0206D58C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206D590 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D58C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206D590 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D590 */ _t9 = _t8 & 0x00000001u;
         /* 0206D590 */ if (_t9) goto L_0206D598; else goto L_0206D594;
   L_0206D594: ; // 0x206d594
@@ -1009,10 +1009,10 @@ void Gambit_fn_0206D53C(CPUState* cpu) {
         /* 0206D5E4 */ Gambit_fn_026D6F40(cpu);
         /* 0206D5E8 */ _t18 = cpu->r[30] + 0x00000028u;
         /* 0206D5E8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t18);
-        /* 0206D5EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000001u);
+        /* 0206D5EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000001u));
         /* 0206D5F0 */ _t19 = cpu->r[30] + 0x0000002Cu;
         /* 0206D5F0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t19);
-        /* 0206D5F4 */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206D5F4 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206D5F4 */ _t21 = _t20 & 0x00000001u;
         /* 0206D5F4 */ if (_t21) goto L_0206D5F8; else goto L_0206D5FC;
   L_0206D5F8: ; // 0x206d5f8
@@ -1020,8 +1020,8 @@ void Gambit_fn_0206D53C(CPUState* cpu) {
   L_0206D5FC: ; // 0x206d5fc
         /* 0206D5FC */ cpu->r[3] = 0x00000228u;
         /* 0206D600 */ Gambit_fn_02801A78(cpu);
-        /* 0206D604 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206D608 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206D608 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D608 */ _t23 = _t22 & 0x00000001u;
         /* 0206D608 */ if (_t23) goto L_0206D610; else goto L_0206D60C;
   L_0206D60C: ; // 0x206d60c
@@ -1031,10 +1031,10 @@ void Gambit_fn_0206D53C(CPUState* cpu) {
         /* 0206D610 */ rbrew_write32(cpu->mem, _t24, cpu->r[3]);
         /* 0206D614 */ _t25 = cpu->r[30] + 0x00000028u;
         /* 0206D614 */ cpu->r[0] = rbrew_read32(cpu->mem, _t25);
-        /* 0206D618 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 0206D618 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 0206D61C */ _t26 = cpu->r[30] + 0x0000002Cu;
         /* 0206D61C */ cpu->r[12] = rbrew_read32(cpu->mem, _t26);
-        /* 0206D620 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206D620 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206D620 */ _t28 = _t27 & 0x00000001u;
         /* 0206D620 */ if (_t28) goto L_0206D624; else goto L_0206D628;
   L_0206D624: ; // 0x206d624
@@ -1093,8 +1093,8 @@ void Gambit_fn_0206D540(CPUState* cpu) {
         /* 0206D584 */ _t7 = cpu->r[30] + 0x0000002Cu;
         /* 0206D584 */ cpu->r[31] = rbrew_read32(cpu->mem, _t7);
         /* 0206D588 */ Gambit_fn_02801A78(cpu);
-        /* 0206D58C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206D590 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D58C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206D590 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D590 */ _t9 = _t8 & 0x00000001u;
         /* 0206D590 */ if (_t9) goto L_0206D598; else goto L_0206D594;
   L_0206D594: ; // 0x206d594
@@ -1130,10 +1130,10 @@ void Gambit_fn_0206D540(CPUState* cpu) {
         /* 0206D5E4 */ Gambit_fn_026D6F40(cpu);
         /* 0206D5E8 */ _t18 = cpu->r[30] + 0x00000028u;
         /* 0206D5E8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t18);
-        /* 0206D5EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000001u);
+        /* 0206D5EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000001u));
         /* 0206D5F0 */ _t19 = cpu->r[30] + 0x0000002Cu;
         /* 0206D5F0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t19);
-        /* 0206D5F4 */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206D5F4 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206D5F4 */ _t21 = _t20 & 0x00000001u;
         /* 0206D5F4 */ if (_t21) goto L_0206D5F8; else goto L_0206D5FC;
   L_0206D5F8: ; // 0x206d5f8
@@ -1141,8 +1141,8 @@ void Gambit_fn_0206D540(CPUState* cpu) {
   L_0206D5FC: ; // 0x206d5fc
         /* 0206D5FC */ cpu->r[3] = 0x00000228u;
         /* 0206D600 */ Gambit_fn_02801A78(cpu);
-        /* 0206D604 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206D608 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206D608 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D608 */ _t23 = _t22 & 0x00000001u;
         /* 0206D608 */ if (_t23) goto L_0206D610; else goto L_0206D60C;
   L_0206D60C: ; // 0x206d60c
@@ -1152,10 +1152,10 @@ void Gambit_fn_0206D540(CPUState* cpu) {
         /* 0206D610 */ rbrew_write32(cpu->mem, _t24, cpu->r[3]);
         /* 0206D614 */ _t25 = cpu->r[30] + 0x00000028u;
         /* 0206D614 */ cpu->r[0] = rbrew_read32(cpu->mem, _t25);
-        /* 0206D618 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 0206D618 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 0206D61C */ _t26 = cpu->r[30] + 0x0000002Cu;
         /* 0206D61C */ cpu->r[12] = rbrew_read32(cpu->mem, _t26);
-        /* 0206D620 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206D620 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206D620 */ _t28 = _t27 & 0x00000001u;
         /* 0206D620 */ if (_t28) goto L_0206D624; else goto L_0206D628;
   L_0206D624: ; // 0x206d624
@@ -1215,8 +1215,8 @@ void Gambit_fn_0206D658(CPUState* cpu) {
         /* 0206D584 */ _t7 = cpu->r[30] + 0x0000002Cu;
         /* 0206D584 */ cpu->r[31] = rbrew_read32(cpu->mem, _t7);
         /* 0206D588 */ Gambit_fn_02801A78(cpu);
-        /* 0206D58C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206D590 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D58C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206D590 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D590 */ _t9 = _t8 & 0x00000001u;
         /* 0206D590 */ if (_t9) goto L_0206D598; else goto L_0206D594;
   L_0206D594: ; // 0x206d594
@@ -1252,10 +1252,10 @@ void Gambit_fn_0206D658(CPUState* cpu) {
         /* 0206D5E4 */ Gambit_fn_026D6F40(cpu);
         /* 0206D5E8 */ _t18 = cpu->r[30] + 0x00000028u;
         /* 0206D5E8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t18);
-        /* 0206D5EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000001u);
+        /* 0206D5EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000001u));
         /* 0206D5F0 */ _t19 = cpu->r[30] + 0x0000002Cu;
         /* 0206D5F0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t19);
-        /* 0206D5F4 */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206D5F4 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206D5F4 */ _t21 = _t20 & 0x00000001u;
         /* 0206D5F4 */ if (_t21) goto L_0206D5F8; else goto L_0206D5FC;
   L_0206D5F8: ; // 0x206d5f8
@@ -1263,8 +1263,8 @@ void Gambit_fn_0206D658(CPUState* cpu) {
   L_0206D5FC: ; // 0x206d5fc
         /* 0206D5FC */ cpu->r[3] = 0x00000228u;
         /* 0206D600 */ Gambit_fn_02801A78(cpu);
-        /* 0206D604 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206D608 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206D608 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D608 */ _t23 = _t22 & 0x00000001u;
         /* 0206D608 */ if (_t23) goto L_0206D610; else goto L_0206D60C;
   L_0206D60C: ; // 0x206d60c
@@ -1274,10 +1274,10 @@ void Gambit_fn_0206D658(CPUState* cpu) {
         /* 0206D610 */ rbrew_write32(cpu->mem, _t24, cpu->r[3]);
         /* 0206D614 */ _t25 = cpu->r[30] + 0x00000028u;
         /* 0206D614 */ cpu->r[0] = rbrew_read32(cpu->mem, _t25);
-        /* 0206D618 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 0206D618 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 0206D61C */ _t26 = cpu->r[30] + 0x0000002Cu;
         /* 0206D61C */ cpu->r[12] = rbrew_read32(cpu->mem, _t26);
-        /* 0206D620 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206D620 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206D620 */ _t28 = _t27 & 0x00000001u;
         /* 0206D620 */ if (_t28) goto L_0206D624; else goto L_0206D628;
   L_0206D624: ; // 0x206d624
@@ -1327,12 +1327,12 @@ void Gambit_fn_0206D668(CPUState* cpu) {
         /* 0206D670 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0206D670 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0206D674 */ cpu->r[31] = cpu->r[3];
-        /* 0206D678 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 0206D678 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 0206D67C */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0206D67C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0206D680 */ _t3 = cpu->r[31] + 0x0000002Cu;
         /* 0206D680 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0206D684 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D684 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D684 */ _t5 = _t4 & 0x00000001u;
         /* 0206D684 */ if (_t5) goto L_0206D688; else goto L_0206D6A8;
   L_0206D688: ; // 0x206d688
@@ -1349,15 +1349,15 @@ void Gambit_fn_0206D668(CPUState* cpu) {
         /* 0206D6A0 */ rbrew_write32(cpu->mem, _t9, cpu->r[11]);
         /* 0206D6A4 */ goto L_0206D72C;
   L_0206D6A8: ; // 0x206d6a8
-        /* 0206D6A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000001u);
-        /* 0206D6AC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D6A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000001u));
+        /* 0206D6AC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D6AC */ _t11 = _t10 & 0x00000001u;
         /* 0206D6AC */ if (_t11) goto L_0206D6B0; else goto L_0206D6E0;
   L_0206D6B0: ; // 0x206d6b0
         /* 0206D6B0 */ _t12 = cpu->r[31] + 0x00000028u;
         /* 0206D6B0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0206D6B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
-        /* 0206D6B8 */ _t13 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206D6B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
+        /* 0206D6B8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206D6B8 */ _t14 = _t13 & 0x00000001u;
         /* 0206D6B8 */ if (_t14) goto L_0206D6BC; else goto L_0206D6C0;
   L_0206D6BC: ; // 0x206d6bc
@@ -1389,10 +1389,10 @@ void Gambit_fn_0206D668(CPUState* cpu) {
         /* 0206D6F8 */ cpu->r[12] = 0xFFFFFFFFu;
         /* 0206D6FC */ _t23 = cpu->r[31] + 0x00000050u;
         /* 0206D6FC */ rbrew_write32(cpu->mem, _t23, cpu->r[12]);
-        /* 0206D700 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 0206D700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 0206D704 */ _t24 = cpu->r[31] + 0x0000002Cu;
         /* 0206D704 */ cpu->r[12] = rbrew_read32(cpu->mem, _t24);
-        /* 0206D708 */ _t25 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206D708 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206D708 */ _t26 = _t25 & 0x00000001u;
         /* 0206D708 */ if (_t26) goto L_0206D70C; else goto L_0206D710;
   L_0206D70C: ; // 0x206d70c
@@ -1430,12 +1430,12 @@ void Gambit_fn_0206D66C(CPUState* cpu) {
         /* 0206D670 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0206D670 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0206D674 */ cpu->r[31] = cpu->r[3];
-        /* 0206D678 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 0206D678 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 0206D67C */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0206D67C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0206D680 */ _t3 = cpu->r[31] + 0x0000002Cu;
         /* 0206D680 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0206D684 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D684 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D684 */ _t5 = _t4 & 0x00000001u;
         /* 0206D684 */ if (_t5) goto L_0206D688; else goto L_0206D6A8;
   L_0206D688: ; // 0x206d688
@@ -1452,15 +1452,15 @@ void Gambit_fn_0206D66C(CPUState* cpu) {
         /* 0206D6A0 */ rbrew_write32(cpu->mem, _t9, cpu->r[11]);
         /* 0206D6A4 */ goto L_0206D72C;
   L_0206D6A8: ; // 0x206d6a8
-        /* 0206D6A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000001u);
-        /* 0206D6AC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D6A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000001u));
+        /* 0206D6AC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D6AC */ _t11 = _t10 & 0x00000001u;
         /* 0206D6AC */ if (_t11) goto L_0206D6B0; else goto L_0206D6E0;
   L_0206D6B0: ; // 0x206d6b0
         /* 0206D6B0 */ _t12 = cpu->r[31] + 0x00000028u;
         /* 0206D6B0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0206D6B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
-        /* 0206D6B8 */ _t13 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206D6B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
+        /* 0206D6B8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206D6B8 */ _t14 = _t13 & 0x00000001u;
         /* 0206D6B8 */ if (_t14) goto L_0206D6BC; else goto L_0206D6C0;
   L_0206D6BC: ; // 0x206d6bc
@@ -1492,10 +1492,10 @@ void Gambit_fn_0206D66C(CPUState* cpu) {
         /* 0206D6F8 */ cpu->r[12] = 0xFFFFFFFFu;
         /* 0206D6FC */ _t23 = cpu->r[31] + 0x00000050u;
         /* 0206D6FC */ rbrew_write32(cpu->mem, _t23, cpu->r[12]);
-        /* 0206D700 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 0206D700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 0206D704 */ _t24 = cpu->r[31] + 0x0000002Cu;
         /* 0206D704 */ cpu->r[12] = rbrew_read32(cpu->mem, _t24);
-        /* 0206D708 */ _t25 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206D708 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206D708 */ _t26 = _t25 & 0x00000001u;
         /* 0206D708 */ if (_t26) goto L_0206D70C; else goto L_0206D710;
   L_0206D70C: ; // 0x206d70c
@@ -1713,10 +1713,10 @@ void Gambit_fn_0206D7BC(CPUState* cpu) {
         /* 0206D7EC */ cpu->r[12] = 0xFFFFFFFFu;
         /* 0206D7F0 */ _t8 = cpu->r[31] + 0x00000050u;
         /* 0206D7F0 */ rbrew_write32(cpu->mem, _t8, cpu->r[12]);
-        /* 0206D7F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 0206D7F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 0206D7F8 */ _t9 = cpu->r[31] + 0x0000002Cu;
         /* 0206D7F8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t9);
-        /* 0206D7FC */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206D7FC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206D7FC */ _t11 = _t10 & 0x00000001u;
         /* 0206D7FC */ if (_t11) goto L_0206D800; else goto L_0206D804;
   L_0206D800: ; // 0x206d800
@@ -1770,10 +1770,10 @@ void Gambit_fn_0206D7C0(CPUState* cpu) {
         /* 0206D7EC */ cpu->r[12] = 0xFFFFFFFFu;
         /* 0206D7F0 */ _t8 = cpu->r[31] + 0x00000050u;
         /* 0206D7F0 */ rbrew_write32(cpu->mem, _t8, cpu->r[12]);
-        /* 0206D7F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 0206D7F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 0206D7F8 */ _t9 = cpu->r[31] + 0x0000002Cu;
         /* 0206D7F8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t9);
-        /* 0206D7FC */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206D7FC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206D7FC */ _t11 = _t10 & 0x00000001u;
         /* 0206D7FC */ if (_t11) goto L_0206D800; else goto L_0206D804;
   L_0206D800: ; // 0x206d800
@@ -1810,21 +1810,21 @@ void Gambit_fn_0206D834(CPUState* cpu) {
         /* 0206D838 */ cpu->r[0] = cpu->lr;
         /* 0206D83C */ /* nop */
         /* 0206D840 */ cpu->r[31] = cpu->r[3];
-        /* 0206D840 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0206D840 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0206D844 */ cpu->r[27] = cpu->r[4];
         /* 0206D848 */ cpu->r[28] = cpu->r[5];
         /* 0206D84C */ _t1 = cpu->r[1] + 0x00000024u;
         /* 0206D84C */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 0206D850 */ cpu->r[29] = cpu->r[6];
-        /* 0206D854 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D854 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D854 */ _t3 = _t2 & 0x00000001u;
         /* 0206D854 */ if (_t3) goto L_0206D858; else goto L_0206D868;
   L_0206D858: ; // 0x206d858
         /* 0206D858 */ cpu->r[3] = 0x00000068u;
         /* 0206D85C */ Gambit_fn_02801A78(cpu);
         /* 0206D860 */ cpu->r[31] = cpu->r[3];
-        /* 0206D860 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0206D864 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D860 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0206D864 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D864 */ _t5 = _t4 & 0x00000001u;
         /* 0206D864 */ if (_t5) goto L_0206D9B8; else goto L_0206D868;
   L_0206D868: ; // 0x206d868
@@ -1842,20 +1842,20 @@ void Gambit_fn_0206D834(CPUState* cpu) {
         /* 0206D890 */ rbrew_write32(cpu->mem, _t6, cpu->r[9]);
         /* 0206D894 */ cpu->r[11] = cpu->r[11] + 0xFFFF8554u;
         /* 0206D898 */ cpu->r[3] = cpu->r[31] + 0x00000028u;
-        /* 0206D898 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0206D898 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0206D89C */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0206D89C */ rbrew_write32(cpu->mem, _t7, cpu->r[10]);
         /* 0206D8A0 */ cpu->r[30] = 0x00000000u;
         /* 0206D8A4 */ _t8 = cpu->r[31] + 0x00000010u;
         /* 0206D8A4 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0206D8A8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D8A8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D8A8 */ _t10 = _t9 & 0x00000001u;
         /* 0206D8A8 */ if (_t10) goto L_0206D8AC; else goto L_0206D8BC;
   L_0206D8AC: ; // 0x206d8ac
         /* 0206D8AC */ cpu->r[3] = 0x00000008u;
         /* 0206D8B0 */ Gambit_fn_02801A78(cpu);
-        /* 0206D8B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206D8B8 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D8B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206D8B8 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D8B8 */ _t12 = _t11 & 0x00000001u;
         /* 0206D8B8 */ if (_t12) goto L_0206D8C4; else goto L_0206D8BC;
   L_0206D8BC: ; // 0x206d8bc
@@ -1867,17 +1867,17 @@ void Gambit_fn_0206D834(CPUState* cpu) {
         /* 0206D8C4 */ _t15 = cpu->r[31] + 0x00000030u;
         /* 0206D8C4 */ rbrew_write32(cpu->mem, _t15, cpu->r[28]);
         /* 0206D8C8 */ cpu->r[3] = cpu->r[31] + 0x00000038u;
-        /* 0206D8C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0206D8C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0206D8CC */ _t16 = cpu->r[31] + 0x00000034u;
         /* 0206D8CC */ rbrew_write32(cpu->mem, _t16, cpu->r[29]);
-        /* 0206D8D0 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D8D0 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D8D0 */ _t18 = _t17 & 0x00000001u;
         /* 0206D8D0 */ if (_t18) goto L_0206D8D4; else goto L_0206D8E4;
   L_0206D8D4: ; // 0x206d8d4
         /* 0206D8D4 */ cpu->r[3] = 0x0000000Cu;
         /* 0206D8D8 */ Gambit_fn_02801A78(cpu);
-        /* 0206D8DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206D8E0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D8DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206D8E0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D8E0 */ _t20 = _t19 & 0x00000001u;
         /* 0206D8E0 */ if (_t20) goto L_0206D8F4; else goto L_0206D8E4;
   L_0206D8E4: ; // 0x206d8e4
@@ -1890,15 +1890,15 @@ void Gambit_fn_0206D834(CPUState* cpu) {
         /* 0206D8F0 */ rbrew_write8(cpu->mem, _t23, (uint8_t)cpu->r[12]);
   L_0206D8F4: ; // 0x206d8f4
         /* 0206D8F4 */ cpu->r[3] = cpu->r[31] + 0x00000044u;
-        /* 0206D8F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206D8F8 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D8F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206D8F8 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D8F8 */ _t25 = _t24 & 0x00000001u;
         /* 0206D8F8 */ if (_t25) goto L_0206D8FC; else goto L_0206D90C;
   L_0206D8FC: ; // 0x206d8fc
         /* 0206D8FC */ cpu->r[3] = 0x0000000Cu;
         /* 0206D900 */ Gambit_fn_02801A78(cpu);
-        /* 0206D904 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206D908 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D904 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206D908 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D908 */ _t27 = _t26 & 0x00000001u;
         /* 0206D908 */ if (_t27) goto L_0206D91C; else goto L_0206D90C;
   L_0206D90C: ; // 0x206d90c
@@ -1914,17 +1914,17 @@ void Gambit_fn_0206D834(CPUState* cpu) {
         /* 0206D920 */ _t31 = cpu->r[31] + 0x00000050u;
         /* 0206D920 */ rbrew_write32(cpu->mem, _t31, cpu->r[6]);
         /* 0206D924 */ cpu->r[3] = cpu->r[31] + 0x00000058u;
-        /* 0206D924 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0206D924 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0206D928 */ _t32 = cpu->r[31] + 0x00000054u;
         /* 0206D928 */ rbrew_write32(cpu->mem, _t32, cpu->r[6]);
-        /* 0206D92C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D92C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D92C */ _t34 = _t33 & 0x00000001u;
         /* 0206D92C */ if (_t34) goto L_0206D930; else goto L_0206D940;
   L_0206D930: ; // 0x206d930
         /* 0206D930 */ cpu->r[3] = 0x0000000Cu;
         /* 0206D934 */ Gambit_fn_02801A78(cpu);
-        /* 0206D938 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206D93C */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D938 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206D93C */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D93C */ _t36 = _t35 & 0x00000001u;
         /* 0206D93C */ if (_t36) goto L_0206D950; else goto L_0206D940;
   L_0206D940: ; // 0x206d940
@@ -1950,8 +1950,8 @@ void Gambit_fn_0206D834(CPUState* cpu) {
         /* 0206D96C */ cpu->r[4] = 0x00000008u;
         /* 0206D970 */ cpu->r[5] = 0x00000004u;
         /* 0206D974 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0206D978 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206D97C */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D978 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206D97C */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D97C */ _t45 = _t44 & 0x00000001u;
         /* 0206D97C */ if (_t45) goto L_0206D98C; else goto L_0206D980;
   L_0206D980: ; // 0x206d980
@@ -1963,8 +1963,8 @@ void Gambit_fn_0206D834(CPUState* cpu) {
   L_0206D98C: ; // 0x206d98c
         /* 0206D98C */ _t48 = cpu->r[31] + 0x00000028u;
         /* 0206D98C */ cpu->r[0] = rbrew_read32(cpu->mem, _t48);
-        /* 0206D990 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206D994 */ _t49 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206D990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206D994 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206D994 */ _t50 = _t49 & 0x00000001u;
         /* 0206D994 */ if (_t50) goto L_0206D998; else goto L_0206D9B4;
   L_0206D998: ; // 0x206d998
@@ -2000,15 +2000,15 @@ void Gambit_fn_0206D9D0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0206D9D0: ; // 0x206d9d0
-        /* 0206D9D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206D9D4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D9D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206D9D4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D9D4 */ _t1 = _t0 & 0x00000001u;
         /* 0206D9D4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206D9D4 */ goto L_0206D9D8;
   L_0206D9D8: ; // 0x206d9d8
         /* 0206D9D8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206D9D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206D9DC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206D9D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206D9DC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206D9DC */ _t3 = _t2 & 0x00000001u;
         /* 0206D9DC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206D9DC */ goto L_0206D9E0;
@@ -2027,8 +2027,8 @@ void Gambit_fn_0206D9D0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -2042,15 +2042,15 @@ void Gambit_fn_0206D9D0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -2177,11 +2177,11 @@ void Gambit_fn_0206DA28(CPUState* cpu) {
         /* 0206E46C */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0206E46C */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0206E470 */ cpu->r[30] = cpu->r[3];
-        /* 0206E470 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0206E470 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0206E474 */ cpu->r[31] = cpu->r[4];
         /* 0206E478 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0206E478 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0206E47C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E47C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E47C */ _t5 = _t4 & 0x00000001u;
         /* 0206E47C */ if (_t5) goto L_0206E4EC; else goto L_0206E480;
   L_0206E480: ; // 0x206e480
@@ -2195,10 +2195,10 @@ void Gambit_fn_0206DA28(CPUState* cpu) {
         /* 0206E498 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0206E498 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0206E49C */ cpu->r[11] = cpu->r[11] + 0xFFFF890Cu;
-        /* 0206E4A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0206E4A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0206E4A4 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0206E4A4 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0206E4A8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E4A8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E4A8 */ _t10 = _t9 & 0x00000001u;
         /* 0206E4A8 */ if (_t10) goto L_0206E4DC; else goto L_0206E4AC;
   L_0206E4AC: ; // 0x206e4ac
@@ -2219,8 +2219,8 @@ void Gambit_fn_0206DA28(CPUState* cpu) {
         /* 0206E4D8 */ Gambit_fn_02068798(cpu);
   L_0206E4DC: ; // 0x206e4dc
         /* 0206E4DC */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206E4DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0206E4E0 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E4DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0206E4E0 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E4E0 */ _t15 = _t14 & 0x00000001u;
         /* 0206E4E0 */ if (_t15) goto L_0206E4EC; else goto L_0206E4E4;
   L_0206E4E4: ; // 0x206e4e4
@@ -2248,8 +2248,8 @@ void Gambit_fn_0206DA30(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -2304,18 +2304,18 @@ void Gambit_fn_0206DA48(CPUState* cpu) {
         /* 0206DA58 */ _t3 = cpu->r[1] + 0x00000010u;
         /* 0206DA58 */ rbrew_write32(cpu->mem, _t3, cpu->r[30]);
         /* 0206DA5C */ cpu->r[31] = cpu->r[3];
-        /* 0206DA5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0206DA5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0206DA60 */ _t4 = cpu->r[1] + 0x0000001Cu;
         /* 0206DA60 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
-        /* 0206DA64 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DA64 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DA64 */ _t6 = _t5 & 0x00000001u;
         /* 0206DA64 */ if (_t6) goto L_0206DA68; else goto L_0206DA78;
   L_0206DA68: ; // 0x206da68
         /* 0206DA68 */ cpu->r[3] = 0x00000230u;
         /* 0206DA6C */ Gambit_fn_02801A78(cpu);
         /* 0206DA70 */ cpu->r[31] = cpu->r[3];
-        /* 0206DA70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0206DA74 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DA70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0206DA74 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DA74 */ _t8 = _t7 & 0x00000001u;
         /* 0206DA74 */ if (_t8) goto L_0206DBC4; else goto L_0206DA78;
   L_0206DA78: ; // 0x206da78
@@ -2341,17 +2341,17 @@ void Gambit_fn_0206DA48(CPUState* cpu) {
         /* 0206DAB8 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
         /* 0206DABC */ cpu->r[11] = cpu->r[11] + 0xFFFF891Cu;
         /* 0206DAC0 */ cpu->r[3] = cpu->r[31] + 0x0000021Cu;
-        /* 0206DAC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0206DAC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0206DAC4 */ _t12 = cpu->r[31] + 0x000001C8u;
         /* 0206DAC4 */ rbrew_write32(cpu->mem, _t12, cpu->r[11]);
-        /* 0206DAC8 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DAC8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DAC8 */ _t14 = _t13 & 0x00000001u;
         /* 0206DAC8 */ if (_t14) goto L_0206DACC; else goto L_0206DADC;
   L_0206DACC: ; // 0x206dacc
         /* 0206DACC */ cpu->r[3] = 0x00000008u;
         /* 0206DAD0 */ Gambit_fn_02801A78(cpu);
-        /* 0206DAD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206DAD8 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DAD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206DAD8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DAD8 */ _t16 = _t15 & 0x00000001u;
         /* 0206DAD8 */ if (_t16) goto L_0206DAE4; else goto L_0206DADC;
   L_0206DADC: ; // 0x206dadc
@@ -2361,15 +2361,15 @@ void Gambit_fn_0206DA48(CPUState* cpu) {
         /* 0206DAE0 */ rbrew_write32(cpu->mem, _t18, cpu->r[29]);
   L_0206DAE4: ; // 0x206dae4
         /* 0206DAE4 */ cpu->r[3] = cpu->r[31] + 0x00000224u;
-        /* 0206DAE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206DAE8 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DAE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206DAE8 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DAE8 */ _t20 = _t19 & 0x00000001u;
         /* 0206DAE8 */ if (_t20) goto L_0206DAEC; else goto L_0206DAFC;
   L_0206DAEC: ; // 0x206daec
         /* 0206DAEC */ cpu->r[3] = 0x00000008u;
         /* 0206DAF0 */ Gambit_fn_02801A78(cpu);
-        /* 0206DAF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206DAF8 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DAF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206DAF8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DAF8 */ _t22 = _t21 & 0x00000001u;
         /* 0206DAF8 */ if (_t22) goto L_0206DB04; else goto L_0206DAFC;
   L_0206DAFC: ; // 0x206dafc
@@ -2393,8 +2393,8 @@ void Gambit_fn_0206DA48(CPUState* cpu) {
         /* 0206DB20 */ cpu->ctr = cpu->r[0];
         /* 0206DB24 */ cpu->r[5] = cpu->r[4];
         /* 0206DB28 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0206DB2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206DB30 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DB2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206DB30 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DB30 */ _t30 = _t29 & 0x00000001u;
         /* 0206DB30 */ if (_t30) goto L_0206DB40; else goto L_0206DB34;
   L_0206DB34: ; // 0x206db34
@@ -2406,8 +2406,8 @@ void Gambit_fn_0206DA48(CPUState* cpu) {
   L_0206DB40: ; // 0x206db40
         /* 0206DB40 */ _t33 = cpu->r[31] + 0x0000021Cu;
         /* 0206DB40 */ cpu->r[0] = rbrew_read32(cpu->mem, _t33);
-        /* 0206DB44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206DB48 */ _t34 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206DB44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206DB48 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206DB48 */ _t35 = _t34 & 0x00000001u;
         /* 0206DB48 */ if (_t35) goto L_0206DB4C; else goto L_0206DB68;
   L_0206DB4C: ; // 0x206db4c
@@ -2437,8 +2437,8 @@ void Gambit_fn_0206DA48(CPUState* cpu) {
         /* 0206DB7C */ cpu->r[5] = 0x00000004u;
         /* 0206DB80 */ cpu->r[4] = 0x00000008u;
         /* 0206DB84 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0206DB88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206DB8C */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DB88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206DB8C */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DB8C */ _t45 = _t44 & 0x00000001u;
         /* 0206DB8C */ if (_t45) goto L_0206DB9C; else goto L_0206DB90;
   L_0206DB90: ; // 0x206db90
@@ -2450,8 +2450,8 @@ void Gambit_fn_0206DA48(CPUState* cpu) {
   L_0206DB9C: ; // 0x206db9c
         /* 0206DB9C */ _t48 = cpu->r[31] + 0x00000224u;
         /* 0206DB9C */ cpu->r[9] = rbrew_read32(cpu->mem, _t48);
-        /* 0206DBA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0206DBA4 */ _t49 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206DBA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0206DBA4 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206DBA4 */ _t50 = _t49 & 0x00000001u;
         /* 0206DBA4 */ if (_t50) goto L_0206DBA8; else goto L_0206DBC4;
   L_0206DBA8: ; // 0x206dba8
@@ -2499,18 +2499,18 @@ void Gambit_fn_0206DA4C(CPUState* cpu) {
         /* 0206DA58 */ _t3 = cpu->r[1] + 0x00000010u;
         /* 0206DA58 */ rbrew_write32(cpu->mem, _t3, cpu->r[30]);
         /* 0206DA5C */ cpu->r[31] = cpu->r[3];
-        /* 0206DA5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0206DA5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0206DA60 */ _t4 = cpu->r[1] + 0x0000001Cu;
         /* 0206DA60 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
-        /* 0206DA64 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DA64 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DA64 */ _t6 = _t5 & 0x00000001u;
         /* 0206DA64 */ if (_t6) goto L_0206DA68; else goto L_0206DA78;
   L_0206DA68: ; // 0x206da68
         /* 0206DA68 */ cpu->r[3] = 0x00000230u;
         /* 0206DA6C */ Gambit_fn_02801A78(cpu);
         /* 0206DA70 */ cpu->r[31] = cpu->r[3];
-        /* 0206DA70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0206DA74 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DA70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0206DA74 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DA74 */ _t8 = _t7 & 0x00000001u;
         /* 0206DA74 */ if (_t8) goto L_0206DBC4; else goto L_0206DA78;
   L_0206DA78: ; // 0x206da78
@@ -2536,17 +2536,17 @@ void Gambit_fn_0206DA4C(CPUState* cpu) {
         /* 0206DAB8 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
         /* 0206DABC */ cpu->r[11] = cpu->r[11] + 0xFFFF891Cu;
         /* 0206DAC0 */ cpu->r[3] = cpu->r[31] + 0x0000021Cu;
-        /* 0206DAC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0206DAC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0206DAC4 */ _t12 = cpu->r[31] + 0x000001C8u;
         /* 0206DAC4 */ rbrew_write32(cpu->mem, _t12, cpu->r[11]);
-        /* 0206DAC8 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DAC8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DAC8 */ _t14 = _t13 & 0x00000001u;
         /* 0206DAC8 */ if (_t14) goto L_0206DACC; else goto L_0206DADC;
   L_0206DACC: ; // 0x206dacc
         /* 0206DACC */ cpu->r[3] = 0x00000008u;
         /* 0206DAD0 */ Gambit_fn_02801A78(cpu);
-        /* 0206DAD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206DAD8 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DAD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206DAD8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DAD8 */ _t16 = _t15 & 0x00000001u;
         /* 0206DAD8 */ if (_t16) goto L_0206DAE4; else goto L_0206DADC;
   L_0206DADC: ; // 0x206dadc
@@ -2556,15 +2556,15 @@ void Gambit_fn_0206DA4C(CPUState* cpu) {
         /* 0206DAE0 */ rbrew_write32(cpu->mem, _t18, cpu->r[29]);
   L_0206DAE4: ; // 0x206dae4
         /* 0206DAE4 */ cpu->r[3] = cpu->r[31] + 0x00000224u;
-        /* 0206DAE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206DAE8 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DAE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206DAE8 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DAE8 */ _t20 = _t19 & 0x00000001u;
         /* 0206DAE8 */ if (_t20) goto L_0206DAEC; else goto L_0206DAFC;
   L_0206DAEC: ; // 0x206daec
         /* 0206DAEC */ cpu->r[3] = 0x00000008u;
         /* 0206DAF0 */ Gambit_fn_02801A78(cpu);
-        /* 0206DAF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206DAF8 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DAF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206DAF8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DAF8 */ _t22 = _t21 & 0x00000001u;
         /* 0206DAF8 */ if (_t22) goto L_0206DB04; else goto L_0206DAFC;
   L_0206DAFC: ; // 0x206dafc
@@ -2588,8 +2588,8 @@ void Gambit_fn_0206DA4C(CPUState* cpu) {
         /* 0206DB20 */ cpu->ctr = cpu->r[0];
         /* 0206DB24 */ cpu->r[5] = cpu->r[4];
         /* 0206DB28 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0206DB2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206DB30 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DB2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206DB30 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DB30 */ _t30 = _t29 & 0x00000001u;
         /* 0206DB30 */ if (_t30) goto L_0206DB40; else goto L_0206DB34;
   L_0206DB34: ; // 0x206db34
@@ -2601,8 +2601,8 @@ void Gambit_fn_0206DA4C(CPUState* cpu) {
   L_0206DB40: ; // 0x206db40
         /* 0206DB40 */ _t33 = cpu->r[31] + 0x0000021Cu;
         /* 0206DB40 */ cpu->r[0] = rbrew_read32(cpu->mem, _t33);
-        /* 0206DB44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206DB48 */ _t34 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206DB44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206DB48 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206DB48 */ _t35 = _t34 & 0x00000001u;
         /* 0206DB48 */ if (_t35) goto L_0206DB4C; else goto L_0206DB68;
   L_0206DB4C: ; // 0x206db4c
@@ -2632,8 +2632,8 @@ void Gambit_fn_0206DA4C(CPUState* cpu) {
         /* 0206DB7C */ cpu->r[5] = 0x00000004u;
         /* 0206DB80 */ cpu->r[4] = 0x00000008u;
         /* 0206DB84 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0206DB88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206DB8C */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DB88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206DB8C */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DB8C */ _t45 = _t44 & 0x00000001u;
         /* 0206DB8C */ if (_t45) goto L_0206DB9C; else goto L_0206DB90;
   L_0206DB90: ; // 0x206db90
@@ -2645,8 +2645,8 @@ void Gambit_fn_0206DA4C(CPUState* cpu) {
   L_0206DB9C: ; // 0x206db9c
         /* 0206DB9C */ _t48 = cpu->r[31] + 0x00000224u;
         /* 0206DB9C */ cpu->r[9] = rbrew_read32(cpu->mem, _t48);
-        /* 0206DBA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0206DBA4 */ _t49 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206DBA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0206DBA4 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206DBA4 */ _t50 = _t49 & 0x00000001u;
         /* 0206DBA4 */ if (_t50) goto L_0206DBA8; else goto L_0206DBC4;
   L_0206DBA8: ; // 0x206dba8
@@ -2725,7 +2725,7 @@ void Gambit_fn_0206DBE4(CPUState* cpu) {
         /* 0206DC48 */ cpu->r[3] = cpu->r[1] + 0x00000010u;
         /* 0206DC4C */ _t12 = cpu->r[1] + 0x0000002Bu;
         /* 0206DC4C */ rbrew_write8(cpu->mem, _t12, (uint8_t)cpu->r[12]);
-        /* 0206DC50 */ _t13 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0206DC50 */ _t13 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0206DC50 */ _t14 = _t13 & 0x00000001u;
         /* 0206DC50 */ if (_t14) goto L_0206DC54; // else: addr-0 trap, fall-through
   L_0206DC54: ; // 0x206dc54
@@ -2738,8 +2738,8 @@ void Gambit_fn_0206DBE4(CPUState* cpu) {
         /* 0206DC68 */ cpu->r[5] = cpu->r[1] + 0x00000010u;
         /* 0206DC6C */ cpu->r[3] = cpu->r[31];
         /* 0206DC70 */ Gambit_fn_027ED2B0(cpu);
-        /* 0206DC74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206DC78 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DC74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206DC78 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DC78 */ _t17 = _t16 & 0x00000001u;
         /* 0206DC78 */ if (_t17) goto L_0206DC7C; else goto L_0206DCA0;
   L_0206DC7C: ; // 0x206dc7c
@@ -2763,7 +2763,7 @@ void Gambit_fn_0206DBE4(CPUState* cpu) {
         /* 0206DCA8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t22);
         /* 0206DCAC */ _t23 = cpu->r[1] + 0x00000030u;
         /* 0206DCAC */ cpu->r[30] = rbrew_read32(cpu->mem, _t23);
-        /* 0206DCB0 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206DCB0 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206DCB0 */ _t25 = _t24 & 0x00000001u;
         /* 0206DCB0 */ if (_t25) goto L_0206DCB4; // else: addr-0 trap, fall-through
   L_0206DCB4: ; // 0x206dcb4
@@ -2796,11 +2796,11 @@ void Gambit_fn_0206DCC4(CPUState* cpu) {
         /* 0206DCE4 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[11]);
         /* 0206DCE8 */ _t5 = cpu->r[1] + 0x00000014u;
         /* 0206DCE8 */ rbrew_write32(cpu->mem, _t5, cpu->r[29]);
-        /* 0206DCEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 0206DCEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 0206DCF0 */ cpu->r[31] = cpu->r[3];
         /* 0206DCF4 */ _t6 = cpu->r[1] + 0x00000024u;
         /* 0206DCF4 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
-        /* 0206DCF8 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DCF8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DCF8 */ _t8 = _t7 & 0x00000001u;
         /* 0206DCF8 */ if (_t8) goto L_0206DCFC; else goto L_0206DD10;
   L_0206DCFC: ; // 0x206dcfc
@@ -2813,8 +2813,8 @@ void Gambit_fn_0206DCC4(CPUState* cpu) {
         /* 0206DD08 */ rbrew_write8(cpu->mem, _t11, (uint8_t)cpu->r[0]);
         /* 0206DD0C */ goto L_0206DD48;
   L_0206DD10: ; // 0x206dd10
-        /* 0206DD10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000001u);
-        /* 0206DD14 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DD10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000001u));
+        /* 0206DD14 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DD14 */ _t13 = _t12 & 0x00000001u;
         /* 0206DD14 */ if (_t13) goto L_0206DD38; else goto L_0206DD18;
   L_0206DD18: ; // 0x206dd18
@@ -2830,7 +2830,7 @@ void Gambit_fn_0206DCC4(CPUState* cpu) {
         /* 0206DD28 */ rbrew_write8(cpu->mem, _t18, (uint8_t)cpu->r[9]);
         /* 0206DD2C */ _t19 = cpu->r[10] + 0x00000000u;
         /* 0206DD2C */ cpu->r[3] = rbrew_read32(cpu->mem, _t19);
-        /* 0206DD30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0206DD30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0206DD34 */ goto L_0206DD58;
   L_0206DD38: ; // 0x206dd38
         /* 0206DD38 */ cpu->r[12] = 0x000000FFu;
@@ -2847,7 +2847,7 @@ void Gambit_fn_0206DCC4(CPUState* cpu) {
         /* 0206DD4C */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
         /* 0206DD50 */ _t25 = cpu->r[10] + 0x00000000u;
         /* 0206DD50 */ cpu->r[3] = rbrew_read32(cpu->mem, _t25);
-        /* 0206DD54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0206DD54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
   L_0206DD58: ; // 0x206dd58
         /* 0206DD58 */ cpu->r[4] = cpu->r[1] + 0x00000008u;
         /* 0206DD5C */ cpu->r[5] = 0x00000001u;
@@ -2858,10 +2858,10 @@ void Gambit_fn_0206DCC4(CPUState* cpu) {
   L_0206DD70: ; // 0x206dd70
         /* 0206DD70 */ _t26 = cpu->r[31] + 0x00000224u;
         /* 0206DD70 */ cpu->r[0] = rbrew_read32(cpu->mem, _t26);
-        /* 0206DD74 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
+        /* 0206DD74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
         /* 0206DD78 */ _t27 = cpu->r[31] + 0x00000228u;
         /* 0206DD78 */ cpu->r[8] = rbrew_read32(cpu->mem, _t27);
-        /* 0206DD7C */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206DD7C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206DD7C */ _t29 = _t28 & 0x00000001u;
         /* 0206DD7C */ if (_t29) goto L_0206DD80; else goto L_0206DD84;
   L_0206DD80: ; // 0x206dd80
@@ -2873,10 +2873,10 @@ void Gambit_fn_0206DCC4(CPUState* cpu) {
         /* 0206DD8C */ cpu->r[4] = cpu->r[1] + 0x00000008u;
         /* 0206DD90 */ Gambit_fn_020E3250(cpu);
         /* 0206DD94 */ cpu->r[28] = cpu->r[28] + 0xFFFFFFFFu;
-        /* 0206DD94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 0206DD94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 0206DD98 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
         /* 0206DD9C */ cpu->r[29] = cpu->r[29] + 0x00000004u;
-        /* 0206DDA0 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DDA0 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DDA0 */ _t32 = _t31 & 0x00000001u;
         /* 0206DDA0 */ if (_t32) goto L_0206DDA4; else goto L_0206DD70;
   L_0206DDA4: ; // 0x206dda4
@@ -2916,11 +2916,11 @@ void Gambit_fn_0206DCC8(CPUState* cpu) {
         /* 0206DCE4 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[11]);
         /* 0206DCE8 */ _t5 = cpu->r[1] + 0x00000014u;
         /* 0206DCE8 */ rbrew_write32(cpu->mem, _t5, cpu->r[29]);
-        /* 0206DCEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 0206DCEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 0206DCF0 */ cpu->r[31] = cpu->r[3];
         /* 0206DCF4 */ _t6 = cpu->r[1] + 0x00000024u;
         /* 0206DCF4 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
-        /* 0206DCF8 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DCF8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DCF8 */ _t8 = _t7 & 0x00000001u;
         /* 0206DCF8 */ if (_t8) goto L_0206DCFC; else goto L_0206DD10;
   L_0206DCFC: ; // 0x206dcfc
@@ -2933,8 +2933,8 @@ void Gambit_fn_0206DCC8(CPUState* cpu) {
         /* 0206DD08 */ rbrew_write8(cpu->mem, _t11, (uint8_t)cpu->r[0]);
         /* 0206DD0C */ goto L_0206DD48;
   L_0206DD10: ; // 0x206dd10
-        /* 0206DD10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000001u);
-        /* 0206DD14 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DD10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000001u));
+        /* 0206DD14 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DD14 */ _t13 = _t12 & 0x00000001u;
         /* 0206DD14 */ if (_t13) goto L_0206DD38; else goto L_0206DD18;
   L_0206DD18: ; // 0x206dd18
@@ -2950,7 +2950,7 @@ void Gambit_fn_0206DCC8(CPUState* cpu) {
         /* 0206DD28 */ rbrew_write8(cpu->mem, _t18, (uint8_t)cpu->r[9]);
         /* 0206DD2C */ _t19 = cpu->r[10] + 0x00000000u;
         /* 0206DD2C */ cpu->r[3] = rbrew_read32(cpu->mem, _t19);
-        /* 0206DD30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0206DD30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0206DD34 */ goto L_0206DD58;
   L_0206DD38: ; // 0x206dd38
         /* 0206DD38 */ cpu->r[12] = 0x000000FFu;
@@ -2967,7 +2967,7 @@ void Gambit_fn_0206DCC8(CPUState* cpu) {
         /* 0206DD4C */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
         /* 0206DD50 */ _t25 = cpu->r[10] + 0x00000000u;
         /* 0206DD50 */ cpu->r[3] = rbrew_read32(cpu->mem, _t25);
-        /* 0206DD54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0206DD54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
   L_0206DD58: ; // 0x206dd58
         /* 0206DD58 */ cpu->r[4] = cpu->r[1] + 0x00000008u;
         /* 0206DD5C */ cpu->r[5] = 0x00000001u;
@@ -2978,10 +2978,10 @@ void Gambit_fn_0206DCC8(CPUState* cpu) {
   L_0206DD70: ; // 0x206dd70
         /* 0206DD70 */ _t26 = cpu->r[31] + 0x00000224u;
         /* 0206DD70 */ cpu->r[0] = rbrew_read32(cpu->mem, _t26);
-        /* 0206DD74 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
+        /* 0206DD74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
         /* 0206DD78 */ _t27 = cpu->r[31] + 0x00000228u;
         /* 0206DD78 */ cpu->r[8] = rbrew_read32(cpu->mem, _t27);
-        /* 0206DD7C */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206DD7C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206DD7C */ _t29 = _t28 & 0x00000001u;
         /* 0206DD7C */ if (_t29) goto L_0206DD80; else goto L_0206DD84;
   L_0206DD80: ; // 0x206dd80
@@ -2993,10 +2993,10 @@ void Gambit_fn_0206DCC8(CPUState* cpu) {
         /* 0206DD8C */ cpu->r[4] = cpu->r[1] + 0x00000008u;
         /* 0206DD90 */ Gambit_fn_020E3250(cpu);
         /* 0206DD94 */ cpu->r[28] = cpu->r[28] + 0xFFFFFFFFu;
-        /* 0206DD94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 0206DD94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 0206DD98 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
         /* 0206DD9C */ cpu->r[29] = cpu->r[29] + 0x00000004u;
-        /* 0206DDA0 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DDA0 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DDA0 */ _t32 = _t31 & 0x00000001u;
         /* 0206DDA0 */ if (_t32) goto L_0206DDA4; else goto L_0206DD70;
   L_0206DDA4: ; // 0x206dda4
@@ -3167,7 +3167,7 @@ void Gambit_fn_0206DEB4(CPUState* cpu) {
         /* 0206DF0C */ cpu->r[5] = cpu->r[30];
         /* 0206DF10 */ cpu->r[4] = cpu->r[28] + 0xFFFF86C4u;
         /* 0206DF14 */ cpu->r[3] = cpu->r[1] + 0x00000008u;
-        /* 0206DF18 */ _t12 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0206DF18 */ _t12 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0206DF18 */ _t13 = _t12 & 0x00000001u;
         /* 0206DF18 */ if (_t13) goto L_0206DF1C; // else: addr-0 trap, fall-through
   L_0206DF1C: ; // 0x206df1c
@@ -3177,9 +3177,9 @@ void Gambit_fn_0206DEB4(CPUState* cpu) {
         /* 0206DF28 */ cpu->r[5] = cpu->r[4];
         /* 0206DF2C */ Gambit_fn_027ED060(cpu);
         /* 0206DF30 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 0206DF30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0206DF30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0206DF34 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0206DF38 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DF38 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DF38 */ _t15 = _t14 & 0x00000001u;
         /* 0206DF38 */ if (_t15) goto L_0206DF3C; else goto L_0206DF0C;
   L_0206DF3C: ; // 0x206df3c
@@ -3241,7 +3241,7 @@ void Gambit_fn_0206DEB8(CPUState* cpu) {
         /* 0206DF0C */ cpu->r[5] = cpu->r[30];
         /* 0206DF10 */ cpu->r[4] = cpu->r[28] + 0xFFFF86C4u;
         /* 0206DF14 */ cpu->r[3] = cpu->r[1] + 0x00000008u;
-        /* 0206DF18 */ _t12 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0206DF18 */ _t12 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0206DF18 */ _t13 = _t12 & 0x00000001u;
         /* 0206DF18 */ if (_t13) goto L_0206DF1C; // else: addr-0 trap, fall-through
   L_0206DF1C: ; // 0x206df1c
@@ -3251,9 +3251,9 @@ void Gambit_fn_0206DEB8(CPUState* cpu) {
         /* 0206DF28 */ cpu->r[5] = cpu->r[4];
         /* 0206DF2C */ Gambit_fn_027ED060(cpu);
         /* 0206DF30 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 0206DF30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0206DF30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0206DF34 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0206DF38 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DF38 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DF38 */ _t15 = _t14 & 0x00000001u;
         /* 0206DF38 */ if (_t15) goto L_0206DF3C; else goto L_0206DF0C;
   L_0206DF3C: ; // 0x206df3c
@@ -3316,7 +3316,7 @@ void Gambit_fn_0206DF5C(CPUState* cpu) {
         /* 0206DFB4 */ cpu->r[5] = cpu->r[30];
         /* 0206DFB8 */ cpu->r[4] = cpu->r[28] + 0xFFFF86CCu;
         /* 0206DFBC */ cpu->r[3] = cpu->r[1] + 0x00000008u;
-        /* 0206DFC0 */ _t12 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0206DFC0 */ _t12 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0206DFC0 */ _t13 = _t12 & 0x00000001u;
         /* 0206DFC0 */ if (_t13) goto L_0206DFC4; // else: addr-0 trap, fall-through
   L_0206DFC4: ; // 0x206dfc4
@@ -3326,9 +3326,9 @@ void Gambit_fn_0206DF5C(CPUState* cpu) {
         /* 0206DFD0 */ cpu->r[5] = cpu->r[4];
         /* 0206DFD4 */ Gambit_fn_027ED060(cpu);
         /* 0206DFD8 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 0206DFD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0206DFD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0206DFDC */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0206DFE0 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DFE0 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DFE0 */ _t15 = _t14 & 0x00000001u;
         /* 0206DFE0 */ if (_t15) goto L_0206DFE4; else goto L_0206DFB4;
   L_0206DFE4: ; // 0x206dfe4
@@ -3390,7 +3390,7 @@ void Gambit_fn_0206DF60(CPUState* cpu) {
         /* 0206DFB4 */ cpu->r[5] = cpu->r[30];
         /* 0206DFB8 */ cpu->r[4] = cpu->r[28] + 0xFFFF86CCu;
         /* 0206DFBC */ cpu->r[3] = cpu->r[1] + 0x00000008u;
-        /* 0206DFC0 */ _t12 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0206DFC0 */ _t12 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0206DFC0 */ _t13 = _t12 & 0x00000001u;
         /* 0206DFC0 */ if (_t13) goto L_0206DFC4; // else: addr-0 trap, fall-through
   L_0206DFC4: ; // 0x206dfc4
@@ -3400,9 +3400,9 @@ void Gambit_fn_0206DF60(CPUState* cpu) {
         /* 0206DFD0 */ cpu->r[5] = cpu->r[4];
         /* 0206DFD4 */ Gambit_fn_027ED060(cpu);
         /* 0206DFD8 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 0206DFD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0206DFD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0206DFDC */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0206DFE0 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206DFE0 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206DFE0 */ _t15 = _t14 & 0x00000001u;
         /* 0206DFE0 */ if (_t15) goto L_0206DFE4; else goto L_0206DFB4;
   L_0206DFE4: ; // 0x206dfe4
@@ -3466,7 +3466,7 @@ void Gambit_fn_0206E004(CPUState* cpu) {
         /* 0206E064 */ cpu->r[4] = cpu->r[4] + 0xFFFF86D8u;
         /* 0206E068 */ _t12 = cpu->r[1] + 0x00000014u;
         /* 0206E068 */ rbrew_write32(cpu->mem, _t12, cpu->r[0]);
-        /* 0206E06C */ _t13 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0206E06C */ _t13 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0206E06C */ _t14 = _t13 & 0x00000001u;
         /* 0206E06C */ if (_t14) goto L_0206E070; // else: addr-0 trap, fall-through
   L_0206E070: ; // 0x206e070
@@ -3481,8 +3481,8 @@ void Gambit_fn_0206E004(CPUState* cpu) {
         /* 0206E08C */ cpu->r[5] = cpu->r[1] + 0x00000010u;
         /* 0206E090 */ cpu->r[3] = cpu->r[31];
         /* 0206E094 */ Gambit_fn_027ED2B0(cpu);
-        /* 0206E098 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206E09C */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E098 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206E09C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E09C */ _t17 = _t16 & 0x00000001u;
         /* 0206E09C */ if (_t17) goto L_0206E0A0; else goto L_0206E0CC;
   L_0206E0A0: ; // 0x206e0a0
@@ -3508,7 +3508,7 @@ void Gambit_fn_0206E004(CPUState* cpu) {
         /* 0206E0D4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t22);
         /* 0206E0D8 */ _t23 = cpu->r[1] + 0x00000030u;
         /* 0206E0D8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t23);
-        /* 0206E0DC */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206E0DC */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206E0DC */ _t25 = _t24 & 0x00000001u;
         /* 0206E0DC */ if (_t25) goto L_0206E0E0; // else: addr-0 trap, fall-through
   L_0206E0E0: ; // 0x206e0e0
@@ -3563,7 +3563,7 @@ void Gambit_fn_0206E008(CPUState* cpu) {
         /* 0206E064 */ cpu->r[4] = cpu->r[4] + 0xFFFF86D8u;
         /* 0206E068 */ _t12 = cpu->r[1] + 0x00000014u;
         /* 0206E068 */ rbrew_write32(cpu->mem, _t12, cpu->r[0]);
-        /* 0206E06C */ _t13 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0206E06C */ _t13 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0206E06C */ _t14 = _t13 & 0x00000001u;
         /* 0206E06C */ if (_t14) goto L_0206E070; // else: addr-0 trap, fall-through
   L_0206E070: ; // 0x206e070
@@ -3578,8 +3578,8 @@ void Gambit_fn_0206E008(CPUState* cpu) {
         /* 0206E08C */ cpu->r[5] = cpu->r[1] + 0x00000010u;
         /* 0206E090 */ cpu->r[3] = cpu->r[31];
         /* 0206E094 */ Gambit_fn_027ED2B0(cpu);
-        /* 0206E098 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206E09C */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E098 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206E09C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E09C */ _t17 = _t16 & 0x00000001u;
         /* 0206E09C */ if (_t17) goto L_0206E0A0; else goto L_0206E0CC;
   L_0206E0A0: ; // 0x206e0a0
@@ -3605,7 +3605,7 @@ void Gambit_fn_0206E008(CPUState* cpu) {
         /* 0206E0D4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t22);
         /* 0206E0D8 */ _t23 = cpu->r[1] + 0x00000030u;
         /* 0206E0D8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t23);
-        /* 0206E0DC */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206E0DC */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206E0DC */ _t25 = _t24 & 0x00000001u;
         /* 0206E0DC */ if (_t25) goto L_0206E0E0; // else: addr-0 trap, fall-through
   L_0206E0E0: ; // 0x206e0e0
@@ -3661,7 +3661,7 @@ void Gambit_fn_0206E0F0(CPUState* cpu) {
         /* 0206E150 */ cpu->r[4] = cpu->r[4] + 0xFFFF86F0u;
         /* 0206E154 */ _t12 = cpu->r[1] + 0x00000014u;
         /* 0206E154 */ rbrew_write32(cpu->mem, _t12, cpu->r[0]);
-        /* 0206E158 */ _t13 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0206E158 */ _t13 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0206E158 */ _t14 = _t13 & 0x00000001u;
         /* 0206E158 */ if (_t14) goto L_0206E15C; // else: addr-0 trap, fall-through
   L_0206E15C: ; // 0x206e15c
@@ -3676,8 +3676,8 @@ void Gambit_fn_0206E0F0(CPUState* cpu) {
         /* 0206E178 */ cpu->r[5] = cpu->r[1] + 0x00000010u;
         /* 0206E17C */ cpu->r[3] = cpu->r[31];
         /* 0206E180 */ Gambit_fn_027ED2B0(cpu);
-        /* 0206E184 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206E188 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E184 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206E188 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E188 */ _t17 = _t16 & 0x00000001u;
         /* 0206E188 */ if (_t17) goto L_0206E18C; else goto L_0206E1B8;
   L_0206E18C: ; // 0x206e18c
@@ -3703,7 +3703,7 @@ void Gambit_fn_0206E0F0(CPUState* cpu) {
         /* 0206E1C0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t22);
         /* 0206E1C4 */ _t23 = cpu->r[1] + 0x00000030u;
         /* 0206E1C4 */ cpu->r[30] = rbrew_read32(cpu->mem, _t23);
-        /* 0206E1C8 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206E1C8 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206E1C8 */ _t25 = _t24 & 0x00000001u;
         /* 0206E1C8 */ if (_t25) goto L_0206E1CC; // else: addr-0 trap, fall-through
   L_0206E1CC: ; // 0x206e1cc
@@ -3758,7 +3758,7 @@ void Gambit_fn_0206E0F4(CPUState* cpu) {
         /* 0206E150 */ cpu->r[4] = cpu->r[4] + 0xFFFF86F0u;
         /* 0206E154 */ _t12 = cpu->r[1] + 0x00000014u;
         /* 0206E154 */ rbrew_write32(cpu->mem, _t12, cpu->r[0]);
-        /* 0206E158 */ _t13 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0206E158 */ _t13 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0206E158 */ _t14 = _t13 & 0x00000001u;
         /* 0206E158 */ if (_t14) goto L_0206E15C; // else: addr-0 trap, fall-through
   L_0206E15C: ; // 0x206e15c
@@ -3773,8 +3773,8 @@ void Gambit_fn_0206E0F4(CPUState* cpu) {
         /* 0206E178 */ cpu->r[5] = cpu->r[1] + 0x00000010u;
         /* 0206E17C */ cpu->r[3] = cpu->r[31];
         /* 0206E180 */ Gambit_fn_027ED2B0(cpu);
-        /* 0206E184 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206E188 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E184 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206E188 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E188 */ _t17 = _t16 & 0x00000001u;
         /* 0206E188 */ if (_t17) goto L_0206E18C; else goto L_0206E1B8;
   L_0206E18C: ; // 0x206e18c
@@ -3800,7 +3800,7 @@ void Gambit_fn_0206E0F4(CPUState* cpu) {
         /* 0206E1C0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t22);
         /* 0206E1C4 */ _t23 = cpu->r[1] + 0x00000030u;
         /* 0206E1C4 */ cpu->r[30] = rbrew_read32(cpu->mem, _t23);
-        /* 0206E1C8 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206E1C8 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206E1C8 */ _t25 = _t24 & 0x00000001u;
         /* 0206E1C8 */ if (_t25) goto L_0206E1CC; // else: addr-0 trap, fall-through
   L_0206E1CC: ; // 0x206e1cc
@@ -3851,7 +3851,7 @@ void Gambit_fn_0206E1DC(CPUState* cpu) {
         /* 0206E230 */ cpu->r[30] = cpu->r[30] + 0xFFFF85CCu;
         /* 0206E234 */ _t10 = cpu->r[1] + 0x0000002Bu;
         /* 0206E234 */ rbrew_write8(cpu->mem, _t10, (uint8_t)cpu->r[12]);
-        /* 0206E238 */ _t11 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0206E238 */ _t11 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0206E238 */ _t12 = _t11 & 0x00000001u;
         /* 0206E238 */ if (_t12) goto L_0206E23C; // else: addr-0 trap, fall-through
   L_0206E23C: ; // 0x206e23c
@@ -3862,8 +3862,8 @@ void Gambit_fn_0206E1DC(CPUState* cpu) {
         /* 0206E24C */ cpu->r[3] = cpu->r[31];
         /* 0206E250 */ cpu->r[5] = cpu->r[1] + 0x00000010u;
         /* 0206E254 */ Gambit_fn_027ED700(cpu);
-        /* 0206E258 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206E25C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E258 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206E25C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E25C */ _t14 = _t13 & 0x00000001u;
         /* 0206E25C */ if (_t14) goto L_0206E260; else goto L_0206E288;
   L_0206E260: ; // 0x206e260
@@ -3930,7 +3930,7 @@ void Gambit_fn_0206E1E0(CPUState* cpu) {
         /* 0206E230 */ cpu->r[30] = cpu->r[30] + 0xFFFF85CCu;
         /* 0206E234 */ _t10 = cpu->r[1] + 0x0000002Bu;
         /* 0206E234 */ rbrew_write8(cpu->mem, _t10, (uint8_t)cpu->r[12]);
-        /* 0206E238 */ _t11 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0206E238 */ _t11 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0206E238 */ _t12 = _t11 & 0x00000001u;
         /* 0206E238 */ if (_t12) goto L_0206E23C; // else: addr-0 trap, fall-through
   L_0206E23C: ; // 0x206e23c
@@ -3941,8 +3941,8 @@ void Gambit_fn_0206E1E0(CPUState* cpu) {
         /* 0206E24C */ cpu->r[3] = cpu->r[31];
         /* 0206E250 */ cpu->r[5] = cpu->r[1] + 0x00000010u;
         /* 0206E254 */ Gambit_fn_027ED700(cpu);
-        /* 0206E258 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206E25C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E258 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206E25C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E25C */ _t14 = _t13 & 0x00000001u;
         /* 0206E25C */ if (_t14) goto L_0206E260; else goto L_0206E288;
   L_0206E260: ; // 0x206e260
@@ -4014,7 +4014,7 @@ void Gambit_fn_0206E2A0(CPUState* cpu) {
         /* 0206E2F8 */ cpu->r[5] = cpu->r[30];
         /* 0206E2FC */ cpu->r[4] = cpu->r[28] + 0xFFFF870Cu;
         /* 0206E300 */ cpu->r[3] = cpu->r[1] + 0x00000008u;
-        /* 0206E304 */ _t12 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0206E304 */ _t12 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0206E304 */ _t13 = _t12 & 0x00000001u;
         /* 0206E304 */ if (_t13) goto L_0206E308; // else: addr-0 trap, fall-through
   L_0206E308: ; // 0x206e308
@@ -4024,9 +4024,9 @@ void Gambit_fn_0206E2A0(CPUState* cpu) {
         /* 0206E314 */ cpu->r[5] = cpu->r[4];
         /* 0206E318 */ Gambit_fn_027ED060(cpu);
         /* 0206E31C */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 0206E31C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0206E31C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0206E320 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0206E324 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E324 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E324 */ _t15 = _t14 & 0x00000001u;
         /* 0206E324 */ if (_t15) goto L_0206E328; else goto L_0206E2F8;
   L_0206E328: ; // 0x206e328
@@ -4088,7 +4088,7 @@ void Gambit_fn_0206E2A4(CPUState* cpu) {
         /* 0206E2F8 */ cpu->r[5] = cpu->r[30];
         /* 0206E2FC */ cpu->r[4] = cpu->r[28] + 0xFFFF870Cu;
         /* 0206E300 */ cpu->r[3] = cpu->r[1] + 0x00000008u;
-        /* 0206E304 */ _t12 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0206E304 */ _t12 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0206E304 */ _t13 = _t12 & 0x00000001u;
         /* 0206E304 */ if (_t13) goto L_0206E308; // else: addr-0 trap, fall-through
   L_0206E308: ; // 0x206e308
@@ -4098,9 +4098,9 @@ void Gambit_fn_0206E2A4(CPUState* cpu) {
         /* 0206E314 */ cpu->r[5] = cpu->r[4];
         /* 0206E318 */ Gambit_fn_027ED060(cpu);
         /* 0206E31C */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 0206E31C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0206E31C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0206E320 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0206E324 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E324 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E324 */ _t15 = _t14 & 0x00000001u;
         /* 0206E324 */ if (_t15) goto L_0206E328; else goto L_0206E2F8;
   L_0206E328: ; // 0x206e328
@@ -4153,7 +4153,7 @@ void Gambit_fn_0206E348(CPUState* cpu) {
         /* 0206E38C */ cpu->r[30] = cpu->r[30] + 0xFFFF85CCu;
         /* 0206E390 */ _t8 = cpu->r[25] + 0x00000220u;
         /* 0206E390 */ cpu->r[31] = rbrew_read32(cpu->mem, _t8);
-        /* 0206E394 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0206E394 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0206E398 */ _t9 = cpu->r[1] + 0x00000034u;
         /* 0206E398 */ rbrew_write8(cpu->mem, _t9, (uint8_t)cpu->r[11]);
         /* 0206E39C */ cpu->r[24] = 0x10010000u;
@@ -4184,10 +4184,10 @@ void Gambit_fn_0206E348(CPUState* cpu) {
   L_0206E3E8: ; // 0x206e3e8
         /* 0206E3E8 */ _t16 = cpu->r[25] + 0x00000224u;
         /* 0206E3E8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t16);
-        /* 0206E3EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], cpu->r[0]);
+        /* 0206E3EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], cpu->r[0]));
         /* 0206E3F0 */ _t17 = cpu->r[25] + 0x00000228u;
         /* 0206E3F0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t17);
-        /* 0206E3F4 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206E3F4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206E3F4 */ _t19 = _t18 & 0x00000001u;
         /* 0206E3F4 */ if (_t19) goto L_0206E3F8; else goto L_0206E3FC;
   L_0206E3F8: ; // 0x206e3f8
@@ -4211,11 +4211,11 @@ void Gambit_fn_0206E348(CPUState* cpu) {
         /* 0206E420 */ Gambit_fn_020E31C4(cpu);
         /* 0206E424 */ cpu->r[28] = cpu->r[28] + 0x00000004u;
         /* 0206E428 */ cpu->r[27] = cpu->r[27] + 0xFFFFFFFFu;
-        /* 0206E428 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0206E428 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0206E42C */ _t25 = cpu->r[31] + 0x00000000u;
         /* 0206E42C */ rbrew_write32(cpu->mem, _t25, cpu->r[3]);
         /* 0206E430 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 0206E434 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E434 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E434 */ _t27 = _t26 & 0x00000001u;
         /* 0206E434 */ if (_t27) goto L_0206E438; else goto L_0206E3E8;
   L_0206E438: ; // 0x206e438
@@ -4232,15 +4232,15 @@ void Gambit_fn_0206E44C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0206E44C: ; // 0x206e44c
-        /* 0206E44C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206E450 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E44C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206E450 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E450 */ _t1 = _t0 & 0x00000001u;
         /* 0206E450 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206E450 */ goto L_0206E454;
   L_0206E454: ; // 0x206e454
         /* 0206E454 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206E454 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206E458 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E454 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206E458 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E458 */ _t3 = _t2 & 0x00000001u;
         /* 0206E458 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206E458 */ goto L_0206E45C;
@@ -4259,8 +4259,8 @@ void Gambit_fn_0206E44C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4274,15 +4274,15 @@ void Gambit_fn_0206E44C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4319,11 +4319,11 @@ void Gambit_fn_0206E460(CPUState* cpu) {
         /* 0206E46C */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0206E46C */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0206E470 */ cpu->r[30] = cpu->r[3];
-        /* 0206E470 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0206E470 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0206E474 */ cpu->r[31] = cpu->r[4];
         /* 0206E478 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0206E478 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0206E47C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E47C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E47C */ _t5 = _t4 & 0x00000001u;
         /* 0206E47C */ if (_t5) goto L_0206E4EC; else goto L_0206E480;
   L_0206E480: ; // 0x206e480
@@ -4337,10 +4337,10 @@ void Gambit_fn_0206E460(CPUState* cpu) {
         /* 0206E498 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0206E498 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0206E49C */ cpu->r[11] = cpu->r[11] + 0xFFFF890Cu;
-        /* 0206E4A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0206E4A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0206E4A4 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0206E4A4 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0206E4A8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E4A8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E4A8 */ _t10 = _t9 & 0x00000001u;
         /* 0206E4A8 */ if (_t10) goto L_0206E4DC; else goto L_0206E4AC;
   L_0206E4AC: ; // 0x206e4ac
@@ -4361,8 +4361,8 @@ void Gambit_fn_0206E460(CPUState* cpu) {
         /* 0206E4D8 */ Gambit_fn_02068798(cpu);
   L_0206E4DC: ; // 0x206e4dc
         /* 0206E4DC */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206E4DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0206E4E0 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E4DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0206E4E0 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E4E0 */ _t15 = _t14 & 0x00000001u;
         /* 0206E4E0 */ if (_t15) goto L_0206E4EC; else goto L_0206E4E4;
   L_0206E4E4: ; // 0x206e4e4
@@ -4393,11 +4393,11 @@ void Gambit_fn_0206E464(CPUState* cpu) {
         /* 0206E46C */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0206E46C */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0206E470 */ cpu->r[30] = cpu->r[3];
-        /* 0206E470 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0206E470 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0206E474 */ cpu->r[31] = cpu->r[4];
         /* 0206E478 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0206E478 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0206E47C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E47C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E47C */ _t5 = _t4 & 0x00000001u;
         /* 0206E47C */ if (_t5) goto L_0206E4EC; else goto L_0206E480;
   L_0206E480: ; // 0x206e480
@@ -4411,10 +4411,10 @@ void Gambit_fn_0206E464(CPUState* cpu) {
         /* 0206E498 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0206E498 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0206E49C */ cpu->r[11] = cpu->r[11] + 0xFFFF890Cu;
-        /* 0206E4A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0206E4A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0206E4A4 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0206E4A4 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0206E4A8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E4A8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E4A8 */ _t10 = _t9 & 0x00000001u;
         /* 0206E4A8 */ if (_t10) goto L_0206E4DC; else goto L_0206E4AC;
   L_0206E4AC: ; // 0x206e4ac
@@ -4435,8 +4435,8 @@ void Gambit_fn_0206E464(CPUState* cpu) {
         /* 0206E4D8 */ Gambit_fn_02068798(cpu);
   L_0206E4DC: ; // 0x206e4dc
         /* 0206E4DC */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206E4DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0206E4E0 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E4DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0206E4E0 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E4E0 */ _t15 = _t14 & 0x00000001u;
         /* 0206E4E0 */ if (_t15) goto L_0206E4EC; else goto L_0206E4E4;
   L_0206E4E4: ; // 0x206e4e4
@@ -4491,15 +4491,15 @@ void Gambit_fn_0206E51C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0206E51C: ; // 0x206e51c
-        /* 0206E51C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206E520 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E51C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206E520 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E520 */ _t1 = _t0 & 0x00000001u;
         /* 0206E520 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206E520 */ goto L_0206E524;
   L_0206E524: ; // 0x206e524
         /* 0206E524 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206E524 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206E528 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206E528 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E528 */ _t3 = _t2 & 0x00000001u;
         /* 0206E528 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206E528 */ goto L_0206E52C;
@@ -4518,8 +4518,8 @@ void Gambit_fn_0206E51C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4533,15 +4533,15 @@ void Gambit_fn_0206E51C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4587,15 +4587,15 @@ void Gambit_fn_0206E54C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0206E54C: ; // 0x206e54c
-        /* 0206E54C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206E550 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E54C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206E550 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E550 */ _t1 = _t0 & 0x00000001u;
         /* 0206E550 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206E550 */ goto L_0206E554;
   L_0206E554: ; // 0x206e554
         /* 0206E554 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206E554 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206E558 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E554 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206E558 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E558 */ _t3 = _t2 & 0x00000001u;
         /* 0206E558 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206E558 */ goto L_0206E55C;
@@ -4614,8 +4614,8 @@ void Gambit_fn_0206E54C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4629,15 +4629,15 @@ void Gambit_fn_0206E54C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4665,15 +4665,15 @@ void Gambit_fn_0206E560(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0206E560: ; // 0x206e560
-        /* 0206E560 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206E564 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E560 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206E564 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E564 */ _t1 = _t0 & 0x00000001u;
         /* 0206E564 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206E564 */ goto L_0206E568;
   L_0206E568: ; // 0x206e568
         /* 0206E568 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206E568 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206E56C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E568 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206E56C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E56C */ _t3 = _t2 & 0x00000001u;
         /* 0206E56C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206E56C */ goto L_0206E570;
@@ -4692,8 +4692,8 @@ void Gambit_fn_0206E560(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4707,15 +4707,15 @@ void Gambit_fn_0206E560(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4753,15 +4753,15 @@ void Gambit_fn_0206E57C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0206E57C: ; // 0x206e57c
-        /* 0206E57C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206E580 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E57C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206E580 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E580 */ _t1 = _t0 & 0x00000001u;
         /* 0206E580 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206E580 */ goto L_0206E584;
   L_0206E584: ; // 0x206e584
         /* 0206E584 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206E584 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206E588 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206E588 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E588 */ _t3 = _t2 & 0x00000001u;
         /* 0206E588 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206E588 */ goto L_0206E58C;
@@ -4780,8 +4780,8 @@ void Gambit_fn_0206E57C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4795,15 +4795,15 @@ void Gambit_fn_0206E57C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4831,15 +4831,15 @@ void Gambit_fn_0206E590(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0206E590: ; // 0x206e590
-        /* 0206E590 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206E594 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E590 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206E594 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E594 */ _t1 = _t0 & 0x00000001u;
         /* 0206E594 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206E594 */ goto L_0206E598;
   L_0206E598: ; // 0x206e598
         /* 0206E598 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206E598 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206E59C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E598 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206E59C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E59C */ _t3 = _t2 & 0x00000001u;
         /* 0206E59C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206E59C */ goto L_0206E5A0;
@@ -4858,8 +4858,8 @@ void Gambit_fn_0206E590(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4873,15 +4873,15 @@ void Gambit_fn_0206E590(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4977,9 +4977,9 @@ void Gambit_fn_0206E5DC(CPUState* cpu) {
         /* 0206E5E0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 0206E5E0 */ cpu->r[9] = _t0;
         /* 0206E5E4 */ cpu->r[12] = 0x101D0000u;
-        /* 0206E5E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0206E5E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0206E5EC */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 0206E5F0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E5F0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E5F0 */ _t2 = _t1 & 0x00000001u;
         /* 0206E5F0 */ if (_t2) goto L_0206E5F4; else goto L_0206E608;
   L_0206E5F4: ; // 0x206e5f4
@@ -4991,8 +4991,8 @@ void Gambit_fn_0206E5DC(CPUState* cpu) {
         /* 0206E604 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 0206E604 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_0206E608: ; // 0x206e608
-        /* 0206E608 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0206E60C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E608 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0206E60C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E60C */ _t6 = _t5 & 0x00000001u;
         /* 0206E60C */ if (_t6) goto L_0206E610; else goto L_0206E618;
   L_0206E610: ; // 0x206e610
@@ -5004,9 +5004,9 @@ void Gambit_fn_0206E5DC(CPUState* cpu) {
         /* 0206E61C */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 0206E61C */ cpu->r[7] = _t7;
         /* 0206E620 */ cpu->r[11] = 0x101D0000u;
-        /* 0206E624 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0206E624 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0206E628 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 0206E62C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E62C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E62C */ _t9 = _t8 & 0x00000001u;
         /* 0206E62C */ if (_t9) goto L_0206E630; else goto L_0206E644;
   L_0206E630: ; // 0x206e630
@@ -5127,18 +5127,18 @@ void Gambit_fn_0206E694(CPUState* cpu) {
         /* 02008980 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02008980 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02008984 */ cpu->r[12] = 0x00000000u;
-        /* 02008988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02008988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0200898C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0200898C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02008990 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02008990 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02008990 */ _t6 = _t5 & 0x00000001u;
         /* 02008990 */ if (_t6) goto L_020089B8; else goto L_02008994;
   L_02008994: ; // 0x2008994
         /* 02008994 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02008994 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02008998 */ /* nop */
-        /* 0200899C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 020089A0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0200899C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 020089A0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020089A0 */ _t9 = _t8 & 0x00000001u;
         /* 020089A0 */ if (_t9) goto L_020089A4; else goto L_020089B8;
   L_020089A4: ; // 0x20089a4
@@ -5212,8 +5212,8 @@ void Gambit_fn_0206E6A4(CPUState* cpu) {
         /* 0206E6EC */ _t7 = cpu->r[30] + 0x00000030u;
         /* 0206E6EC */ cpu->r[31] = rbrew_read32(cpu->mem, _t7);
         /* 0206E6F0 */ Gambit_fn_02801A78(cpu);
-        /* 0206E6F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206E6F8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E6F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206E6F8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E6F8 */ _t9 = _t8 & 0x00000001u;
         /* 0206E6F8 */ if (_t9) goto L_0206E700; else goto L_0206E6FC;
   L_0206E6FC: ; // 0x206e6fc
@@ -5249,10 +5249,10 @@ void Gambit_fn_0206E6A4(CPUState* cpu) {
         /* 0206E74C */ Gambit_fn_026D6F40(cpu);
         /* 0206E750 */ _t18 = cpu->r[30] + 0x0000002Cu;
         /* 0206E750 */ cpu->r[9] = rbrew_read32(cpu->mem, _t18);
-        /* 0206E754 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000001u);
+        /* 0206E754 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000001u));
         /* 0206E758 */ _t19 = cpu->r[30] + 0x00000030u;
         /* 0206E758 */ cpu->r[31] = rbrew_read32(cpu->mem, _t19);
-        /* 0206E75C */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206E75C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206E75C */ _t21 = _t20 & 0x00000001u;
         /* 0206E75C */ if (_t21) goto L_0206E760; else goto L_0206E764;
   L_0206E760: ; // 0x206e760
@@ -5260,8 +5260,8 @@ void Gambit_fn_0206E6A4(CPUState* cpu) {
   L_0206E764: ; // 0x206e764
         /* 0206E764 */ cpu->r[3] = 0x00000230u;
         /* 0206E768 */ Gambit_fn_02801A78(cpu);
-        /* 0206E76C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206E770 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E76C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206E770 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E770 */ _t23 = _t22 & 0x00000001u;
         /* 0206E770 */ if (_t23) goto L_0206E778; else goto L_0206E774;
   L_0206E774: ; // 0x206e774
@@ -5271,10 +5271,10 @@ void Gambit_fn_0206E6A4(CPUState* cpu) {
         /* 0206E778 */ rbrew_write32(cpu->mem, _t24, cpu->r[3]);
         /* 0206E77C */ _t25 = cpu->r[30] + 0x0000002Cu;
         /* 0206E77C */ cpu->r[0] = rbrew_read32(cpu->mem, _t25);
-        /* 0206E780 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 0206E780 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 0206E784 */ _t26 = cpu->r[30] + 0x00000030u;
         /* 0206E784 */ cpu->r[12] = rbrew_read32(cpu->mem, _t26);
-        /* 0206E788 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206E788 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206E788 */ _t28 = _t27 & 0x00000001u;
         /* 0206E788 */ if (_t28) goto L_0206E78C; else goto L_0206E790;
   L_0206E78C: ; // 0x206e78c
@@ -5333,8 +5333,8 @@ void Gambit_fn_0206E6A8(CPUState* cpu) {
         /* 0206E6EC */ _t7 = cpu->r[30] + 0x00000030u;
         /* 0206E6EC */ cpu->r[31] = rbrew_read32(cpu->mem, _t7);
         /* 0206E6F0 */ Gambit_fn_02801A78(cpu);
-        /* 0206E6F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206E6F8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E6F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206E6F8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E6F8 */ _t9 = _t8 & 0x00000001u;
         /* 0206E6F8 */ if (_t9) goto L_0206E700; else goto L_0206E6FC;
   L_0206E6FC: ; // 0x206e6fc
@@ -5370,10 +5370,10 @@ void Gambit_fn_0206E6A8(CPUState* cpu) {
         /* 0206E74C */ Gambit_fn_026D6F40(cpu);
         /* 0206E750 */ _t18 = cpu->r[30] + 0x0000002Cu;
         /* 0206E750 */ cpu->r[9] = rbrew_read32(cpu->mem, _t18);
-        /* 0206E754 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000001u);
+        /* 0206E754 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000001u));
         /* 0206E758 */ _t19 = cpu->r[30] + 0x00000030u;
         /* 0206E758 */ cpu->r[31] = rbrew_read32(cpu->mem, _t19);
-        /* 0206E75C */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206E75C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206E75C */ _t21 = _t20 & 0x00000001u;
         /* 0206E75C */ if (_t21) goto L_0206E760; else goto L_0206E764;
   L_0206E760: ; // 0x206e760
@@ -5381,8 +5381,8 @@ void Gambit_fn_0206E6A8(CPUState* cpu) {
   L_0206E764: ; // 0x206e764
         /* 0206E764 */ cpu->r[3] = 0x00000230u;
         /* 0206E768 */ Gambit_fn_02801A78(cpu);
-        /* 0206E76C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206E770 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E76C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206E770 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E770 */ _t23 = _t22 & 0x00000001u;
         /* 0206E770 */ if (_t23) goto L_0206E778; else goto L_0206E774;
   L_0206E774: ; // 0x206e774
@@ -5392,10 +5392,10 @@ void Gambit_fn_0206E6A8(CPUState* cpu) {
         /* 0206E778 */ rbrew_write32(cpu->mem, _t24, cpu->r[3]);
         /* 0206E77C */ _t25 = cpu->r[30] + 0x0000002Cu;
         /* 0206E77C */ cpu->r[0] = rbrew_read32(cpu->mem, _t25);
-        /* 0206E780 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 0206E780 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 0206E784 */ _t26 = cpu->r[30] + 0x00000030u;
         /* 0206E784 */ cpu->r[12] = rbrew_read32(cpu->mem, _t26);
-        /* 0206E788 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206E788 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206E788 */ _t28 = _t27 & 0x00000001u;
         /* 0206E788 */ if (_t28) goto L_0206E78C; else goto L_0206E790;
   L_0206E78C: ; // 0x206e78c
@@ -5455,8 +5455,8 @@ void Gambit_fn_0206E7C0(CPUState* cpu) {
         /* 0206E6EC */ _t7 = cpu->r[30] + 0x00000030u;
         /* 0206E6EC */ cpu->r[31] = rbrew_read32(cpu->mem, _t7);
         /* 0206E6F0 */ Gambit_fn_02801A78(cpu);
-        /* 0206E6F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206E6F8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E6F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206E6F8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E6F8 */ _t9 = _t8 & 0x00000001u;
         /* 0206E6F8 */ if (_t9) goto L_0206E700; else goto L_0206E6FC;
   L_0206E6FC: ; // 0x206e6fc
@@ -5492,10 +5492,10 @@ void Gambit_fn_0206E7C0(CPUState* cpu) {
         /* 0206E74C */ Gambit_fn_026D6F40(cpu);
         /* 0206E750 */ _t18 = cpu->r[30] + 0x0000002Cu;
         /* 0206E750 */ cpu->r[9] = rbrew_read32(cpu->mem, _t18);
-        /* 0206E754 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000001u);
+        /* 0206E754 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000001u));
         /* 0206E758 */ _t19 = cpu->r[30] + 0x00000030u;
         /* 0206E758 */ cpu->r[31] = rbrew_read32(cpu->mem, _t19);
-        /* 0206E75C */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206E75C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206E75C */ _t21 = _t20 & 0x00000001u;
         /* 0206E75C */ if (_t21) goto L_0206E760; else goto L_0206E764;
   L_0206E760: ; // 0x206e760
@@ -5503,8 +5503,8 @@ void Gambit_fn_0206E7C0(CPUState* cpu) {
   L_0206E764: ; // 0x206e764
         /* 0206E764 */ cpu->r[3] = 0x00000230u;
         /* 0206E768 */ Gambit_fn_02801A78(cpu);
-        /* 0206E76C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206E770 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E76C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206E770 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E770 */ _t23 = _t22 & 0x00000001u;
         /* 0206E770 */ if (_t23) goto L_0206E778; else goto L_0206E774;
   L_0206E774: ; // 0x206e774
@@ -5514,10 +5514,10 @@ void Gambit_fn_0206E7C0(CPUState* cpu) {
         /* 0206E778 */ rbrew_write32(cpu->mem, _t24, cpu->r[3]);
         /* 0206E77C */ _t25 = cpu->r[30] + 0x0000002Cu;
         /* 0206E77C */ cpu->r[0] = rbrew_read32(cpu->mem, _t25);
-        /* 0206E780 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 0206E780 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 0206E784 */ _t26 = cpu->r[30] + 0x00000030u;
         /* 0206E784 */ cpu->r[12] = rbrew_read32(cpu->mem, _t26);
-        /* 0206E788 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206E788 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206E788 */ _t28 = _t27 & 0x00000001u;
         /* 0206E788 */ if (_t28) goto L_0206E78C; else goto L_0206E790;
   L_0206E78C: ; // 0x206e78c
@@ -5658,21 +5658,21 @@ void Gambit_fn_0206E810(CPUState* cpu) {
         /* 0206E824 */ cpu->r[28] = cpu->r[5];
         /* 0206E828 */ cpu->r[30] = cpu->r[4];
         /* 0206E82C */ cpu->r[31] = cpu->r[3];
-        /* 0206E82C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0206E82C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0206E830 */ _t4 = cpu->r[1] + 0x0000000Cu;
         /* 0206E830 */ rbrew_write32(cpu->mem, _t4, cpu->r[29]);
         /* 0206E834 */ _t5 = cpu->r[1] + 0x0000001Cu;
         /* 0206E834 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
         /* 0206E838 */ cpu->r[29] = cpu->r[6];
-        /* 0206E83C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E83C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E83C */ _t7 = _t6 & 0x00000001u;
         /* 0206E83C */ if (_t7) goto L_0206E840; else goto L_0206E850;
   L_0206E840: ; // 0x206e840
         /* 0206E840 */ cpu->r[3] = 0x0000004Cu;
         /* 0206E844 */ Gambit_fn_02801A78(cpu);
         /* 0206E848 */ cpu->r[31] = cpu->r[3];
-        /* 0206E848 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0206E84C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E848 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0206E84C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E84C */ _t9 = _t8 & 0x00000001u;
         /* 0206E84C */ if (_t9) goto L_0206E940; else goto L_0206E850;
   L_0206E850: ; // 0x206e850
@@ -5691,21 +5691,21 @@ void Gambit_fn_0206E810(CPUState* cpu) {
         /* 0206E878 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
         /* 0206E87C */ cpu->r[9] = 0x10010000u;
         /* 0206E880 */ cpu->r[3] = cpu->r[31] + 0x0000002Cu;
-        /* 0206E880 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0206E880 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0206E884 */ _t12 = cpu->r[31] + 0x0000000Cu;
         /* 0206E884 */ rbrew_write32(cpu->mem, _t12, cpu->r[7]);
         /* 0206E888 */ cpu->r[9] = cpu->r[9] + 0xFFFF8A4Cu;
         /* 0206E88C */ cpu->r[30] = 0x00000000u;
         /* 0206E890 */ _t13 = cpu->r[31] + 0x00000010u;
         /* 0206E890 */ rbrew_write32(cpu->mem, _t13, cpu->r[9]);
-        /* 0206E894 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E894 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E894 */ _t15 = _t14 & 0x00000001u;
         /* 0206E894 */ if (_t15) goto L_0206E898; else goto L_0206E8A8;
   L_0206E898: ; // 0x206e898
         /* 0206E898 */ cpu->r[3] = 0x00000008u;
         /* 0206E89C */ Gambit_fn_02801A78(cpu);
-        /* 0206E8A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206E8A4 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E8A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206E8A4 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E8A4 */ _t17 = _t16 & 0x00000001u;
         /* 0206E8A4 */ if (_t17) goto L_0206E8B0; else goto L_0206E8A8;
   L_0206E8A8: ; // 0x206e8a8
@@ -5717,17 +5717,17 @@ void Gambit_fn_0206E810(CPUState* cpu) {
         /* 0206E8B0 */ _t20 = cpu->r[31] + 0x00000034u;
         /* 0206E8B0 */ rbrew_write32(cpu->mem, _t20, cpu->r[28]);
         /* 0206E8B4 */ cpu->r[3] = cpu->r[31] + 0x0000003Cu;
-        /* 0206E8B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0206E8B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0206E8B8 */ _t21 = cpu->r[31] + 0x00000038u;
         /* 0206E8B8 */ rbrew_write32(cpu->mem, _t21, cpu->r[29]);
-        /* 0206E8BC */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E8BC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E8BC */ _t23 = _t22 & 0x00000001u;
         /* 0206E8BC */ if (_t23) goto L_0206E8C0; else goto L_0206E8D0;
   L_0206E8C0: ; // 0x206e8c0
         /* 0206E8C0 */ cpu->r[3] = 0x0000000Cu;
         /* 0206E8C4 */ Gambit_fn_02801A78(cpu);
-        /* 0206E8C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206E8CC */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E8C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206E8CC */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E8CC */ _t25 = _t24 & 0x00000001u;
         /* 0206E8CC */ if (_t25) goto L_0206E8DC; else goto L_0206E8D0;
   L_0206E8D0: ; // 0x206e8d0
@@ -5750,8 +5750,8 @@ void Gambit_fn_0206E810(CPUState* cpu) {
         /* 0206E8F4 */ cpu->r[4] = 0x00000008u;
         /* 0206E8F8 */ cpu->r[5] = 0x00000004u;
         /* 0206E8FC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0206E900 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206E904 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E900 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206E904 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E904 */ _t33 = _t32 & 0x00000001u;
         /* 0206E904 */ if (_t33) goto L_0206E914; else goto L_0206E908;
   L_0206E908: ; // 0x206e908
@@ -5763,8 +5763,8 @@ void Gambit_fn_0206E810(CPUState* cpu) {
   L_0206E914: ; // 0x206e914
         /* 0206E914 */ _t36 = cpu->r[31] + 0x0000002Cu;
         /* 0206E914 */ cpu->r[6] = rbrew_read32(cpu->mem, _t36);
-        /* 0206E918 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0206E91C */ _t37 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206E918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0206E91C */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206E91C */ _t38 = _t37 & 0x00000001u;
         /* 0206E91C */ if (_t38) goto L_0206E920; else goto L_0206E93C;
   L_0206E920: ; // 0x206e920
@@ -5819,21 +5819,21 @@ void Gambit_fn_0206E814(CPUState* cpu) {
         /* 0206E824 */ cpu->r[28] = cpu->r[5];
         /* 0206E828 */ cpu->r[30] = cpu->r[4];
         /* 0206E82C */ cpu->r[31] = cpu->r[3];
-        /* 0206E82C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0206E82C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0206E830 */ _t4 = cpu->r[1] + 0x0000000Cu;
         /* 0206E830 */ rbrew_write32(cpu->mem, _t4, cpu->r[29]);
         /* 0206E834 */ _t5 = cpu->r[1] + 0x0000001Cu;
         /* 0206E834 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
         /* 0206E838 */ cpu->r[29] = cpu->r[6];
-        /* 0206E83C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E83C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E83C */ _t7 = _t6 & 0x00000001u;
         /* 0206E83C */ if (_t7) goto L_0206E840; else goto L_0206E850;
   L_0206E840: ; // 0x206e840
         /* 0206E840 */ cpu->r[3] = 0x0000004Cu;
         /* 0206E844 */ Gambit_fn_02801A78(cpu);
         /* 0206E848 */ cpu->r[31] = cpu->r[3];
-        /* 0206E848 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0206E84C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E848 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0206E84C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E84C */ _t9 = _t8 & 0x00000001u;
         /* 0206E84C */ if (_t9) goto L_0206E940; else goto L_0206E850;
   L_0206E850: ; // 0x206e850
@@ -5852,21 +5852,21 @@ void Gambit_fn_0206E814(CPUState* cpu) {
         /* 0206E878 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
         /* 0206E87C */ cpu->r[9] = 0x10010000u;
         /* 0206E880 */ cpu->r[3] = cpu->r[31] + 0x0000002Cu;
-        /* 0206E880 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0206E880 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0206E884 */ _t12 = cpu->r[31] + 0x0000000Cu;
         /* 0206E884 */ rbrew_write32(cpu->mem, _t12, cpu->r[7]);
         /* 0206E888 */ cpu->r[9] = cpu->r[9] + 0xFFFF8A4Cu;
         /* 0206E88C */ cpu->r[30] = 0x00000000u;
         /* 0206E890 */ _t13 = cpu->r[31] + 0x00000010u;
         /* 0206E890 */ rbrew_write32(cpu->mem, _t13, cpu->r[9]);
-        /* 0206E894 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E894 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E894 */ _t15 = _t14 & 0x00000001u;
         /* 0206E894 */ if (_t15) goto L_0206E898; else goto L_0206E8A8;
   L_0206E898: ; // 0x206e898
         /* 0206E898 */ cpu->r[3] = 0x00000008u;
         /* 0206E89C */ Gambit_fn_02801A78(cpu);
-        /* 0206E8A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206E8A4 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E8A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206E8A4 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E8A4 */ _t17 = _t16 & 0x00000001u;
         /* 0206E8A4 */ if (_t17) goto L_0206E8B0; else goto L_0206E8A8;
   L_0206E8A8: ; // 0x206e8a8
@@ -5878,17 +5878,17 @@ void Gambit_fn_0206E814(CPUState* cpu) {
         /* 0206E8B0 */ _t20 = cpu->r[31] + 0x00000034u;
         /* 0206E8B0 */ rbrew_write32(cpu->mem, _t20, cpu->r[28]);
         /* 0206E8B4 */ cpu->r[3] = cpu->r[31] + 0x0000003Cu;
-        /* 0206E8B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0206E8B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0206E8B8 */ _t21 = cpu->r[31] + 0x00000038u;
         /* 0206E8B8 */ rbrew_write32(cpu->mem, _t21, cpu->r[29]);
-        /* 0206E8BC */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E8BC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E8BC */ _t23 = _t22 & 0x00000001u;
         /* 0206E8BC */ if (_t23) goto L_0206E8C0; else goto L_0206E8D0;
   L_0206E8C0: ; // 0x206e8c0
         /* 0206E8C0 */ cpu->r[3] = 0x0000000Cu;
         /* 0206E8C4 */ Gambit_fn_02801A78(cpu);
-        /* 0206E8C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206E8CC */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E8C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206E8CC */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E8CC */ _t25 = _t24 & 0x00000001u;
         /* 0206E8CC */ if (_t25) goto L_0206E8DC; else goto L_0206E8D0;
   L_0206E8D0: ; // 0x206e8d0
@@ -5911,8 +5911,8 @@ void Gambit_fn_0206E814(CPUState* cpu) {
         /* 0206E8F4 */ cpu->r[4] = 0x00000008u;
         /* 0206E8F8 */ cpu->r[5] = 0x00000004u;
         /* 0206E8FC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0206E900 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206E904 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E900 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206E904 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E904 */ _t33 = _t32 & 0x00000001u;
         /* 0206E904 */ if (_t33) goto L_0206E914; else goto L_0206E908;
   L_0206E908: ; // 0x206e908
@@ -5924,8 +5924,8 @@ void Gambit_fn_0206E814(CPUState* cpu) {
   L_0206E914: ; // 0x206e914
         /* 0206E914 */ _t36 = cpu->r[31] + 0x0000002Cu;
         /* 0206E914 */ cpu->r[6] = rbrew_read32(cpu->mem, _t36);
-        /* 0206E918 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0206E91C */ _t37 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206E918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0206E91C */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206E91C */ _t38 = _t37 & 0x00000001u;
         /* 0206E91C */ if (_t38) goto L_0206E920; else goto L_0206E93C;
   L_0206E920: ; // 0x206e920
@@ -6001,8 +6001,8 @@ void Gambit_fn_0206E964(CPUState* cpu) {
   L_0206E964: ; // 0x206e964
         /* 0206E964 */ _t9 = cpu->r[4] + 0x00000000u;
         /* 0206E964 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 0206E968 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206E96C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E968 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206E96C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E96C */ _t11 = _t10 & 0x00000001u;
         /* 0206E96C */ if (_t11) goto L_0206E970; else goto L_0206E97C;
   L_0206E970: ; // 0x206e970
@@ -6012,8 +6012,8 @@ void Gambit_fn_0206E964(CPUState* cpu) {
         /* 0206E974 */ cpu->r[3] = rbrew_read32(cpu->mem, _t13);
         /* 0206E978 */ goto L_0206DE64;
   L_0206E97C: ; // 0x206e97c
-        /* 0206E97C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 0206E980 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E97C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 0206E980 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E980 */ _t15 = _t14 & 0x00000001u;
         /* 0206E980 */ _t16 = _t15 ^ 0x00000001u;
         /* 0206E980 */ if (_t16) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -6021,10 +6021,10 @@ void Gambit_fn_0206E964(CPUState* cpu) {
   L_0206E984: ; // 0x206e984
         /* 0206E984 */ _t17 = cpu->r[3] + 0x0000002Cu;
         /* 0206E984 */ cpu->r[9] = rbrew_read32(cpu->mem, _t17);
-        /* 0206E988 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000001u);
+        /* 0206E988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000001u));
         /* 0206E98C */ _t18 = cpu->r[3] + 0x00000030u;
         /* 0206E98C */ cpu->r[12] = rbrew_read32(cpu->mem, _t18);
-        /* 0206E990 */ _t19 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206E990 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206E990 */ _t20 = _t19 & 0x00000001u;
         /* 0206E990 */ if (_t20) goto L_0206E994; else goto L_0206E998;
   L_0206E994: ; // 0x206e994
@@ -6040,8 +6040,8 @@ void Gambit_fn_0206E9A0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15;
 
   L_0206E9A0: ; // 0x206e9a0
-        /* 0206E9A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0206E9A4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E9A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0206E9A4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E9A4 */ _t1 = _t0 & 0x00000001u;
         /* 0206E9A4 */ if (_t1) goto L_0206E9A8; else goto L_0206E9C0;
   L_0206E9A8: ; // 0x206e9a8
@@ -6056,8 +6056,8 @@ void Gambit_fn_0206E9A0(CPUState* cpu) {
         /* 0206E9B8 */ cpu->ctr = cpu->r[12];
         /* 0206E9BC */ rbrew_dispatch(cpu, cpu->ctr); return;
   L_0206E9C0: ; // 0x206e9c0
-        /* 0206E9C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000001u);
-        /* 0206E9C4 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E9C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000001u));
+        /* 0206E9C4 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E9C4 */ _t7 = _t6 & 0x00000001u;
         /* 0206E9C4 */ _t8 = _t7 ^ 0x00000001u;
         /* 0206E9C4 */ if (_t8) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -6065,10 +6065,10 @@ void Gambit_fn_0206E9A0(CPUState* cpu) {
   L_0206E9C8: ; // 0x206e9c8
         /* 0206E9C8 */ _t9 = cpu->r[3] + 0x0000002Cu;
         /* 0206E9C8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 0206E9CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 0206E9CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 0206E9D0 */ _t10 = cpu->r[3] + 0x00000030u;
         /* 0206E9D0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 0206E9D4 */ _t11 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206E9D4 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206E9D4 */ _t12 = _t11 & 0x00000001u;
         /* 0206E9D4 */ if (_t12) goto L_0206E9D8; else goto L_0206E9DC;
   L_0206E9D8: ; // 0x206e9d8
@@ -6122,8 +6122,8 @@ void Gambit_fn_0206E9F0(CPUState* cpu) {
   L_0206E9F0: ; // 0x206e9f0
         /* 0206E9F0 */ _t9 = cpu->r[4] + 0x00000000u;
         /* 0206E9F0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 0206E9F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206E9F8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206E9F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206E9F8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206E9F8 */ _t11 = _t10 & 0x00000001u;
         /* 0206E9F8 */ if (_t11) goto L_0206E9FC; else goto L_0206EA08;
   L_0206E9FC: ; // 0x206e9fc
@@ -6133,8 +6133,8 @@ void Gambit_fn_0206E9F0(CPUState* cpu) {
         /* 0206EA00 */ cpu->r[3] = rbrew_read32(cpu->mem, _t13);
         /* 0206EA04 */ goto L_0206DDC4;
   L_0206EA08: ; // 0x206ea08
-        /* 0206EA08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 0206EA0C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206EA08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 0206EA0C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206EA0C */ _t15 = _t14 & 0x00000001u;
         /* 0206EA0C */ _t16 = _t15 ^ 0x00000001u;
         /* 0206EA0C */ if (_t16) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -6142,10 +6142,10 @@ void Gambit_fn_0206E9F0(CPUState* cpu) {
   L_0206EA10: ; // 0x206ea10
         /* 0206EA10 */ _t17 = cpu->r[3] + 0x0000002Cu;
         /* 0206EA10 */ cpu->r[9] = rbrew_read32(cpu->mem, _t17);
-        /* 0206EA14 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000001u);
+        /* 0206EA14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000001u));
         /* 0206EA18 */ _t18 = cpu->r[3] + 0x00000030u;
         /* 0206EA18 */ cpu->r[12] = rbrew_read32(cpu->mem, _t18);
-        /* 0206EA1C */ _t19 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206EA1C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206EA1C */ _t20 = _t19 & 0x00000001u;
         /* 0206EA1C */ if (_t20) goto L_0206EA20; else goto L_0206EA24;
   L_0206EA20: ; // 0x206ea20
@@ -6194,8 +6194,8 @@ void Gambit_fn_0206EA2C(CPUState* cpu) {
   L_0206EA2C: ; // 0x206ea2c
         /* 0206EA2C */ _t9 = cpu->r[4] + 0x00000000u;
         /* 0206EA2C */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 0206EA30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206EA34 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206EA30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206EA34 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206EA34 */ _t11 = _t10 & 0x00000001u;
         /* 0206EA34 */ if (_t11) goto L_0206EA38; else goto L_0206EA44;
   L_0206EA38: ; // 0x206ea38
@@ -6205,8 +6205,8 @@ void Gambit_fn_0206EA2C(CPUState* cpu) {
         /* 0206EA3C */ cpu->r[3] = rbrew_read32(cpu->mem, _t13);
         /* 0206EA40 */ goto L_0206DE14;
   L_0206EA44: ; // 0x206ea44
-        /* 0206EA44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 0206EA48 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206EA44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 0206EA48 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206EA48 */ _t15 = _t14 & 0x00000001u;
         /* 0206EA48 */ _t16 = _t15 ^ 0x00000001u;
         /* 0206EA48 */ if (_t16) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -6214,10 +6214,10 @@ void Gambit_fn_0206EA2C(CPUState* cpu) {
   L_0206EA4C: ; // 0x206ea4c
         /* 0206EA4C */ _t17 = cpu->r[3] + 0x0000002Cu;
         /* 0206EA4C */ cpu->r[9] = rbrew_read32(cpu->mem, _t17);
-        /* 0206EA50 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000001u);
+        /* 0206EA50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000001u));
         /* 0206EA54 */ _t18 = cpu->r[3] + 0x00000030u;
         /* 0206EA54 */ cpu->r[12] = rbrew_read32(cpu->mem, _t18);
-        /* 0206EA58 */ _t19 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206EA58 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206EA58 */ _t20 = _t19 & 0x00000001u;
         /* 0206EA58 */ if (_t20) goto L_0206EA5C; else goto L_0206EA60;
   L_0206EA5C: ; // 0x206ea5c
@@ -6233,8 +6233,8 @@ void Gambit_fn_0206EA68(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19, _t20, _t21, _t22, _t23, _t24;
 
   L_0206EA68: ; // 0x206ea68
-        /* 0206EA68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0206EA6C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206EA68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0206EA6C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206EA6C */ _t1 = _t0 & 0x00000001u;
         /* 0206EA6C */ if (_t1) goto L_0206EA70; else goto L_0206EA80;
   L_0206EA70: ; // 0x206ea70
@@ -6245,8 +6245,8 @@ void Gambit_fn_0206EA68(CPUState* cpu) {
         /* 0206EA78 */ cpu->r[4] = cpu->r[5];
         /* 0206EA7C */ goto L_020B76CC;
   L_0206EA80: ; // 0x206ea80
-        /* 0206EA80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000001u);
-        /* 0206EA84 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206EA80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000001u));
+        /* 0206EA84 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206EA84 */ _t5 = _t4 & 0x00000001u;
         /* 0206EA84 */ _t6 = _t5 ^ 0x00000001u;
         /* 0206EA84 */ if (_t6) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -6254,10 +6254,10 @@ void Gambit_fn_0206EA68(CPUState* cpu) {
   L_0206EA88: ; // 0x206ea88
         /* 0206EA88 */ _t7 = cpu->r[3] + 0x0000002Cu;
         /* 0206EA88 */ cpu->r[0] = rbrew_read32(cpu->mem, _t7);
-        /* 0206EA8C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 0206EA8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 0206EA90 */ _t8 = cpu->r[3] + 0x00000030u;
         /* 0206EA90 */ cpu->r[12] = rbrew_read32(cpu->mem, _t8);
-        /* 0206EA94 */ _t9 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206EA94 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206EA94 */ _t10 = _t9 & 0x00000001u;
         /* 0206EA94 */ if (_t10) goto L_0206EA98; else goto L_0206EA9C;
   L_0206EA98: ; // 0x206ea98
@@ -6315,8 +6315,8 @@ void Gambit_fn_0206EAA8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12;
 
   L_0206EAA8: ; // 0x206eaa8
-        /* 0206EAA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0206EAAC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206EAA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0206EAAC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206EAAC */ _t1 = _t0 & 0x00000001u;
         /* 0206EAAC */ if (_t1) goto L_0206EAB0; else goto L_0206EACC;
   L_0206EAB0: ; // 0x206eab0
@@ -6331,17 +6331,17 @@ void Gambit_fn_0206EAA8(CPUState* cpu) {
         /* 0206EAC4 */ cpu->r[3] = cpu->r[0] - cpu->r[12];
         /* 0206EAC8 */ return;
   L_0206EACC: ; // 0x206eacc
-        /* 0206EACC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000001u);
-        /* 0206EAD0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206EACC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000001u));
+        /* 0206EAD0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206EAD0 */ _t6 = _t5 & 0x00000001u;
         /* 0206EAD0 */ if (_t6) goto L_0206EAD4; else goto L_0206EB00;
   L_0206EAD4: ; // 0x206ead4
         /* 0206EAD4 */ _t7 = cpu->r[3] + 0x0000002Cu;
         /* 0206EAD4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t7);
-        /* 0206EAD8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 0206EAD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 0206EADC */ _t8 = cpu->r[3] + 0x00000030u;
         /* 0206EADC */ cpu->r[12] = rbrew_read32(cpu->mem, _t8);
-        /* 0206EAE0 */ _t9 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206EAE0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206EAE0 */ _t10 = _t9 & 0x00000001u;
         /* 0206EAE0 */ if (_t10) goto L_0206EAE4; else goto L_0206EAE8;
   L_0206EAE4: ; // 0x206eae4
@@ -6365,8 +6365,8 @@ void Gambit_fn_0206EB08(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14;
 
   L_0206EB08: ; // 0x206eb08
-        /* 0206EB08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0206EB0C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206EB08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0206EB0C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206EB0C */ _t1 = _t0 & 0x00000001u;
         /* 0206EB0C */ if (_t1) goto L_0206EB10; else goto L_0206EB28;
   L_0206EB10: ; // 0x206eb10
@@ -6381,17 +6381,17 @@ void Gambit_fn_0206EB08(CPUState* cpu) {
         /* 0206EB20 */ cpu->ctr = cpu->r[0];
         /* 0206EB24 */ rbrew_dispatch(cpu, cpu->ctr); return;
   L_0206EB28: ; // 0x206eb28
-        /* 0206EB28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000001u);
-        /* 0206EB2C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206EB28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000001u));
+        /* 0206EB2C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206EB2C */ _t7 = _t6 & 0x00000001u;
         /* 0206EB2C */ if (_t7) goto L_0206EB30; else goto L_0206EB58;
   L_0206EB30: ; // 0x206eb30
         /* 0206EB30 */ _t8 = cpu->r[3] + 0x0000002Cu;
         /* 0206EB30 */ cpu->r[12] = rbrew_read32(cpu->mem, _t8);
-        /* 0206EB34 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], 0x00000001u);
+        /* 0206EB34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], 0x00000001u));
         /* 0206EB38 */ _t9 = cpu->r[3] + 0x00000030u;
         /* 0206EB38 */ cpu->r[12] = rbrew_read32(cpu->mem, _t9);
-        /* 0206EB3C */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206EB3C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206EB3C */ _t11 = _t10 & 0x00000001u;
         /* 0206EB3C */ if (_t11) goto L_0206EB40; else goto L_0206EB44;
   L_0206EB40: ; // 0x206eb40
@@ -6415,8 +6415,8 @@ void Gambit_fn_0206EB60(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11;
 
   L_0206EB60: ; // 0x206eb60
-        /* 0206EB60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0206EB64 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206EB60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0206EB64 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206EB64 */ _t1 = _t0 & 0x00000001u;
         /* 0206EB64 */ if (_t1) goto L_0206EB68; else goto L_0206EB74;
   L_0206EB68: ; // 0x206eb68
@@ -6426,17 +6426,17 @@ void Gambit_fn_0206EB60(CPUState* cpu) {
         /* 0206EB6C */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0206EB70 */ goto L_020B769C;
   L_0206EB74: ; // 0x206eb74
-        /* 0206EB74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000001u);
-        /* 0206EB78 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206EB74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000001u));
+        /* 0206EB78 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206EB78 */ _t5 = _t4 & 0x00000001u;
         /* 0206EB78 */ if (_t5) goto L_0206EB7C; else goto L_0206EB98;
   L_0206EB7C: ; // 0x206eb7c
         /* 0206EB7C */ _t6 = cpu->r[3] + 0x0000002Cu;
         /* 0206EB7C */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 0206EB80 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 0206EB80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 0206EB84 */ _t7 = cpu->r[3] + 0x00000030u;
         /* 0206EB84 */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 0206EB88 */ _t8 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206EB88 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206EB88 */ _t9 = _t8 & 0x00000001u;
         /* 0206EB88 */ if (_t9) goto L_0206EB8C; else goto L_0206EB90;
   L_0206EB8C: ; // 0x206eb8c
@@ -6463,8 +6463,8 @@ void Gambit_fn_0206EBA0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11;
 
   L_0206EBA0: ; // 0x206eba0
-        /* 0206EBA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0206EBA4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206EBA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0206EBA4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206EBA4 */ _t1 = _t0 & 0x00000001u;
         /* 0206EBA4 */ if (_t1) goto L_0206EBA8; else goto L_0206EBB4;
   L_0206EBA8: ; // 0x206eba8
@@ -6474,17 +6474,17 @@ void Gambit_fn_0206EBA0(CPUState* cpu) {
         /* 0206EBAC */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0206EBB0 */ goto L_020B76B4;
   L_0206EBB4: ; // 0x206ebb4
-        /* 0206EBB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000001u);
-        /* 0206EBB8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206EBB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000001u));
+        /* 0206EBB8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206EBB8 */ _t5 = _t4 & 0x00000001u;
         /* 0206EBB8 */ if (_t5) goto L_0206EBBC; else goto L_0206EBD8;
   L_0206EBBC: ; // 0x206ebbc
         /* 0206EBBC */ _t6 = cpu->r[3] + 0x0000002Cu;
         /* 0206EBBC */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 0206EBC0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 0206EBC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 0206EBC4 */ _t7 = cpu->r[3] + 0x00000030u;
         /* 0206EBC4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 0206EBC8 */ _t8 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206EBC8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206EBC8 */ _t9 = _t8 & 0x00000001u;
         /* 0206EBC8 */ if (_t9) goto L_0206EBCC; else goto L_0206EBD0;
   L_0206EBCC: ; // 0x206ebcc
@@ -6511,15 +6511,15 @@ void Gambit_fn_0206EBE0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0206EBE0: ; // 0x206ebe0
-        /* 0206EBE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206EBE4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206EBE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206EBE4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206EBE4 */ _t1 = _t0 & 0x00000001u;
         /* 0206EBE4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206EBE4 */ goto L_0206EBE8;
   L_0206EBE8: ; // 0x206ebe8
         /* 0206EBE8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206EBE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206EBEC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206EBE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206EBEC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206EBEC */ _t3 = _t2 & 0x00000001u;
         /* 0206EBEC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206EBEC */ goto L_0206EBF0;
@@ -6538,8 +6538,8 @@ void Gambit_fn_0206EBE0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -6553,15 +6553,15 @@ void Gambit_fn_0206EBE0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -6710,8 +6710,8 @@ void Gambit_fn_0206EC3C(CPUState* cpu) {
         /* 0206EC88 */ Gambit_fn_026D6F40(cpu);
         /* 0206EC8C */ cpu->r[3] = 0x0000021Cu;
         /* 0206EC90 */ Gambit_fn_02801A78(cpu);
-        /* 0206EC94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206EC98 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206EC94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206EC98 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206EC98 */ _t6 = _t5 & 0x00000001u;
         /* 0206EC98 */ if (_t6) goto L_0206ECA0; else goto L_0206EC9C;
   L_0206EC9C: ; // 0x206ec9c
@@ -6728,8 +6728,8 @@ void Gambit_fn_0206EC3C(CPUState* cpu) {
         /* 0206ECB4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0206ECB8 */ cpu->r[3] = 0x0000021Cu;
         /* 0206ECBC */ Gambit_fn_02801A78(cpu);
-        /* 0206ECC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206ECC4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206ECC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206ECC4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206ECC4 */ _t11 = _t10 & 0x00000001u;
         /* 0206ECC4 */ if (_t11) goto L_0206ECCC; else goto L_0206ECC8;
   L_0206ECC8: ; // 0x206ecc8
@@ -6746,8 +6746,8 @@ void Gambit_fn_0206EC3C(CPUState* cpu) {
         /* 0206ECE0 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0206ECE4 */ cpu->r[3] = 0x00000224u;
         /* 0206ECE8 */ Gambit_fn_02801A78(cpu);
-        /* 0206ECEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206ECF0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206ECEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206ECF0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206ECF0 */ _t16 = _t15 & 0x00000001u;
         /* 0206ECF0 */ if (_t16) goto L_0206ECF8; else goto L_0206ECF4;
   L_0206ECF4: ; // 0x206ecf4
@@ -6803,8 +6803,8 @@ void Gambit_fn_0206EC40(CPUState* cpu) {
         /* 0206EC88 */ Gambit_fn_026D6F40(cpu);
         /* 0206EC8C */ cpu->r[3] = 0x0000021Cu;
         /* 0206EC90 */ Gambit_fn_02801A78(cpu);
-        /* 0206EC94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206EC98 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206EC94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206EC98 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206EC98 */ _t6 = _t5 & 0x00000001u;
         /* 0206EC98 */ if (_t6) goto L_0206ECA0; else goto L_0206EC9C;
   L_0206EC9C: ; // 0x206ec9c
@@ -6821,8 +6821,8 @@ void Gambit_fn_0206EC40(CPUState* cpu) {
         /* 0206ECB4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0206ECB8 */ cpu->r[3] = 0x0000021Cu;
         /* 0206ECBC */ Gambit_fn_02801A78(cpu);
-        /* 0206ECC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206ECC4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206ECC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206ECC4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206ECC4 */ _t11 = _t10 & 0x00000001u;
         /* 0206ECC4 */ if (_t11) goto L_0206ECCC; else goto L_0206ECC8;
   L_0206ECC8: ; // 0x206ecc8
@@ -6839,8 +6839,8 @@ void Gambit_fn_0206EC40(CPUState* cpu) {
         /* 0206ECE0 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0206ECE4 */ cpu->r[3] = 0x00000224u;
         /* 0206ECE8 */ Gambit_fn_02801A78(cpu);
-        /* 0206ECEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206ECF0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206ECEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206ECF0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206ECF0 */ _t16 = _t15 & 0x00000001u;
         /* 0206ECF0 */ if (_t16) goto L_0206ECF8; else goto L_0206ECF4;
   L_0206ECF4: ; // 0x206ecf4
@@ -6897,8 +6897,8 @@ void Gambit_fn_0206ED24(CPUState* cpu) {
         /* 0206EC88 */ Gambit_fn_026D6F40(cpu);
         /* 0206EC8C */ cpu->r[3] = 0x0000021Cu;
         /* 0206EC90 */ Gambit_fn_02801A78(cpu);
-        /* 0206EC94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206EC98 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206EC94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206EC98 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206EC98 */ _t6 = _t5 & 0x00000001u;
         /* 0206EC98 */ if (_t6) goto L_0206ECA0; else goto L_0206EC9C;
   L_0206EC9C: ; // 0x206ec9c
@@ -6915,8 +6915,8 @@ void Gambit_fn_0206ED24(CPUState* cpu) {
         /* 0206ECB4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0206ECB8 */ cpu->r[3] = 0x0000021Cu;
         /* 0206ECBC */ Gambit_fn_02801A78(cpu);
-        /* 0206ECC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206ECC4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206ECC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206ECC4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206ECC4 */ _t11 = _t10 & 0x00000001u;
         /* 0206ECC4 */ if (_t11) goto L_0206ECCC; else goto L_0206ECC8;
   L_0206ECC8: ; // 0x206ecc8
@@ -6933,8 +6933,8 @@ void Gambit_fn_0206ED24(CPUState* cpu) {
         /* 0206ECE0 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0206ECE4 */ cpu->r[3] = 0x00000224u;
         /* 0206ECE8 */ Gambit_fn_02801A78(cpu);
-        /* 0206ECEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206ECF0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206ECEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206ECF0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206ECF0 */ _t16 = _t15 & 0x00000001u;
         /* 0206ECF0 */ if (_t16) goto L_0206ECF8; else goto L_0206ECF4;
   L_0206ECF4: ; // 0x206ecf4
@@ -7069,19 +7069,19 @@ void Gambit_fn_0206ED74(CPUState* cpu) {
         /* 0206ED80 */ _t2 = cpu->r[1] + 0x0000000Cu;
         /* 0206ED80 */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
         /* 0206ED84 */ cpu->r[31] = cpu->r[3];
-        /* 0206ED84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0206ED84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0206ED88 */ cpu->r[30] = cpu->r[4];
         /* 0206ED8C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0206ED8C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0206ED90 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206ED90 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206ED90 */ _t5 = _t4 & 0x00000001u;
         /* 0206ED90 */ if (_t5) goto L_0206ED94; else goto L_0206EDA4;
   L_0206ED94: ; // 0x206ed94
         /* 0206ED94 */ cpu->r[3] = 0x00000038u;
         /* 0206ED98 */ Gambit_fn_02801A78(cpu);
         /* 0206ED9C */ cpu->r[31] = cpu->r[3];
-        /* 0206ED9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0206EDA0 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206ED9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0206EDA0 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206EDA0 */ _t7 = _t6 & 0x00000001u;
         /* 0206EDA0 */ if (_t7) goto L_0206EDF0; else goto L_0206EDA4;
   L_0206EDA4: ; // 0x206eda4
@@ -7137,19 +7137,19 @@ void Gambit_fn_0206ED78(CPUState* cpu) {
         /* 0206ED80 */ _t2 = cpu->r[1] + 0x0000000Cu;
         /* 0206ED80 */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
         /* 0206ED84 */ cpu->r[31] = cpu->r[3];
-        /* 0206ED84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0206ED84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0206ED88 */ cpu->r[30] = cpu->r[4];
         /* 0206ED8C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0206ED8C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0206ED90 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206ED90 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206ED90 */ _t5 = _t4 & 0x00000001u;
         /* 0206ED90 */ if (_t5) goto L_0206ED94; else goto L_0206EDA4;
   L_0206ED94: ; // 0x206ed94
         /* 0206ED94 */ cpu->r[3] = 0x00000038u;
         /* 0206ED98 */ Gambit_fn_02801A78(cpu);
         /* 0206ED9C */ cpu->r[31] = cpu->r[3];
-        /* 0206ED9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0206EDA0 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206ED9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0206EDA0 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206EDA0 */ _t7 = _t6 & 0x00000001u;
         /* 0206EDA0 */ if (_t7) goto L_0206EDF0; else goto L_0206EDA4;
   L_0206EDA4: ; // 0x206eda4
@@ -7528,11 +7528,11 @@ void Gambit_fn_0206EF90(CPUState* cpu) {
         /* 0206F094 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0206F094 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0206F098 */ cpu->r[30] = cpu->r[3];
-        /* 0206F098 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0206F098 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0206F09C */ cpu->r[31] = cpu->r[4];
         /* 0206F0A0 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0206F0A0 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0206F0A4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F0A4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F0A4 */ _t5 = _t4 & 0x00000001u;
         /* 0206F0A4 */ if (_t5) goto L_0206F114; else goto L_0206F0A8;
   L_0206F0A8: ; // 0x206f0a8
@@ -7546,10 +7546,10 @@ void Gambit_fn_0206EF90(CPUState* cpu) {
         /* 0206F0C0 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0206F0C0 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0206F0C4 */ cpu->r[11] = cpu->r[11] + 0xFFFF8E00u;
-        /* 0206F0C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0206F0C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0206F0CC */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0206F0CC */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0206F0D0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F0D0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F0D0 */ _t10 = _t9 & 0x00000001u;
         /* 0206F0D0 */ if (_t10) goto L_0206F104; else goto L_0206F0D4;
   L_0206F0D4: ; // 0x206f0d4
@@ -7570,8 +7570,8 @@ void Gambit_fn_0206EF90(CPUState* cpu) {
         /* 0206F100 */ Gambit_fn_02068798(cpu);
   L_0206F104: ; // 0x206f104
         /* 0206F104 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206F104 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0206F108 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F104 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0206F108 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F108 */ _t15 = _t14 & 0x00000001u;
         /* 0206F108 */ if (_t15) goto L_0206F114; else goto L_0206F10C;
   L_0206F10C: ; // 0x206f10c
@@ -7599,8 +7599,8 @@ void Gambit_fn_0206EF98(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -7651,18 +7651,18 @@ void Gambit_fn_0206EFB0(CPUState* cpu) {
         /* 0206EFB8 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0206EFB8 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0206EFBC */ cpu->r[31] = cpu->r[3];
-        /* 0206EFBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0206EFBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0206EFC0 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0206EFC0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0206EFC4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206EFC4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206EFC4 */ _t4 = _t3 & 0x00000001u;
         /* 0206EFC4 */ if (_t4) goto L_0206EFC8; else goto L_0206EFD8;
   L_0206EFC8: ; // 0x206efc8
         /* 0206EFC8 */ cpu->r[3] = 0x0000021Cu;
         /* 0206EFCC */ Gambit_fn_02801A78(cpu);
         /* 0206EFD0 */ cpu->r[31] = cpu->r[3];
-        /* 0206EFD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0206EFD4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206EFD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0206EFD4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206EFD4 */ _t6 = _t5 & 0x00000001u;
         /* 0206EFD4 */ if (_t6) goto L_0206F020; else goto L_0206EFD8;
   L_0206EFD8: ; // 0x206efd8
@@ -7710,18 +7710,18 @@ void Gambit_fn_0206EFB4(CPUState* cpu) {
         /* 0206EFB8 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0206EFB8 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0206EFBC */ cpu->r[31] = cpu->r[3];
-        /* 0206EFBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0206EFBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0206EFC0 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0206EFC0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0206EFC4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206EFC4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206EFC4 */ _t4 = _t3 & 0x00000001u;
         /* 0206EFC4 */ if (_t4) goto L_0206EFC8; else goto L_0206EFD8;
   L_0206EFC8: ; // 0x206efc8
         /* 0206EFC8 */ cpu->r[3] = 0x0000021Cu;
         /* 0206EFCC */ Gambit_fn_02801A78(cpu);
         /* 0206EFD0 */ cpu->r[31] = cpu->r[3];
-        /* 0206EFD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0206EFD4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206EFD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0206EFD4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206EFD4 */ _t6 = _t5 & 0x00000001u;
         /* 0206EFD4 */ if (_t6) goto L_0206F020; else goto L_0206EFD8;
   L_0206EFD8: ; // 0x206efd8
@@ -7813,15 +7813,15 @@ void Gambit_fn_0206F074(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0206F074: ; // 0x206f074
-        /* 0206F074 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206F078 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F074 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206F078 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F078 */ _t1 = _t0 & 0x00000001u;
         /* 0206F078 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206F078 */ goto L_0206F07C;
   L_0206F07C: ; // 0x206f07c
         /* 0206F07C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206F07C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206F080 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F07C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206F080 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F080 */ _t3 = _t2 & 0x00000001u;
         /* 0206F080 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206F080 */ goto L_0206F084;
@@ -7840,8 +7840,8 @@ void Gambit_fn_0206F074(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -7855,15 +7855,15 @@ void Gambit_fn_0206F074(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -7900,11 +7900,11 @@ void Gambit_fn_0206F088(CPUState* cpu) {
         /* 0206F094 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0206F094 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0206F098 */ cpu->r[30] = cpu->r[3];
-        /* 0206F098 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0206F098 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0206F09C */ cpu->r[31] = cpu->r[4];
         /* 0206F0A0 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0206F0A0 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0206F0A4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F0A4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F0A4 */ _t5 = _t4 & 0x00000001u;
         /* 0206F0A4 */ if (_t5) goto L_0206F114; else goto L_0206F0A8;
   L_0206F0A8: ; // 0x206f0a8
@@ -7918,10 +7918,10 @@ void Gambit_fn_0206F088(CPUState* cpu) {
         /* 0206F0C0 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0206F0C0 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0206F0C4 */ cpu->r[11] = cpu->r[11] + 0xFFFF8E00u;
-        /* 0206F0C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0206F0C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0206F0CC */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0206F0CC */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0206F0D0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F0D0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F0D0 */ _t10 = _t9 & 0x00000001u;
         /* 0206F0D0 */ if (_t10) goto L_0206F104; else goto L_0206F0D4;
   L_0206F0D4: ; // 0x206f0d4
@@ -7942,8 +7942,8 @@ void Gambit_fn_0206F088(CPUState* cpu) {
         /* 0206F100 */ Gambit_fn_02068798(cpu);
   L_0206F104: ; // 0x206f104
         /* 0206F104 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206F104 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0206F108 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F104 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0206F108 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F108 */ _t15 = _t14 & 0x00000001u;
         /* 0206F108 */ if (_t15) goto L_0206F114; else goto L_0206F10C;
   L_0206F10C: ; // 0x206f10c
@@ -7974,11 +7974,11 @@ void Gambit_fn_0206F08C(CPUState* cpu) {
         /* 0206F094 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0206F094 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0206F098 */ cpu->r[30] = cpu->r[3];
-        /* 0206F098 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0206F098 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0206F09C */ cpu->r[31] = cpu->r[4];
         /* 0206F0A0 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0206F0A0 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0206F0A4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F0A4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F0A4 */ _t5 = _t4 & 0x00000001u;
         /* 0206F0A4 */ if (_t5) goto L_0206F114; else goto L_0206F0A8;
   L_0206F0A8: ; // 0x206f0a8
@@ -7992,10 +7992,10 @@ void Gambit_fn_0206F08C(CPUState* cpu) {
         /* 0206F0C0 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0206F0C0 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0206F0C4 */ cpu->r[11] = cpu->r[11] + 0xFFFF8E00u;
-        /* 0206F0C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0206F0C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0206F0CC */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0206F0CC */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0206F0D0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F0D0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F0D0 */ _t10 = _t9 & 0x00000001u;
         /* 0206F0D0 */ if (_t10) goto L_0206F104; else goto L_0206F0D4;
   L_0206F0D4: ; // 0x206f0d4
@@ -8016,8 +8016,8 @@ void Gambit_fn_0206F08C(CPUState* cpu) {
         /* 0206F100 */ Gambit_fn_02068798(cpu);
   L_0206F104: ; // 0x206f104
         /* 0206F104 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206F104 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0206F108 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F104 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0206F108 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F108 */ _t15 = _t14 & 0x00000001u;
         /* 0206F108 */ if (_t15) goto L_0206F114; else goto L_0206F10C;
   L_0206F10C: ; // 0x206f10c
@@ -8150,9 +8150,9 @@ void Gambit_fn_0206F184(CPUState* cpu) {
         /* 0206F188 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 0206F188 */ cpu->r[9] = _t0;
         /* 0206F18C */ cpu->r[12] = 0x101D0000u;
-        /* 0206F190 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0206F190 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0206F194 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 0206F198 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F198 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F198 */ _t2 = _t1 & 0x00000001u;
         /* 0206F198 */ if (_t2) goto L_0206F19C; else goto L_0206F1B0;
   L_0206F19C: ; // 0x206f19c
@@ -8164,8 +8164,8 @@ void Gambit_fn_0206F184(CPUState* cpu) {
         /* 0206F1AC */ _t4 = cpu->r[12] + 0x00000000u;
         /* 0206F1AC */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_0206F1B0: ; // 0x206f1b0
-        /* 0206F1B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0206F1B4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F1B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0206F1B4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F1B4 */ _t6 = _t5 & 0x00000001u;
         /* 0206F1B4 */ if (_t6) goto L_0206F1B8; else goto L_0206F1C0;
   L_0206F1B8: ; // 0x206f1b8
@@ -8177,9 +8177,9 @@ void Gambit_fn_0206F184(CPUState* cpu) {
         /* 0206F1C4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 0206F1C4 */ cpu->r[7] = _t7;
         /* 0206F1C8 */ cpu->r[11] = 0x101D0000u;
-        /* 0206F1CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0206F1CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0206F1D0 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 0206F1D4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F1D4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F1D4 */ _t9 = _t8 & 0x00000001u;
         /* 0206F1D4 */ if (_t9) goto L_0206F1D8; else goto L_0206F1EC;
   L_0206F1D8: ; // 0x206f1d8
@@ -8294,18 +8294,18 @@ void Gambit_fn_0206F238(CPUState* cpu) {
         /* 02008980 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02008980 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02008984 */ cpu->r[12] = 0x00000000u;
-        /* 02008988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02008988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0200898C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0200898C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02008990 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02008990 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02008990 */ _t6 = _t5 & 0x00000001u;
         /* 02008990 */ if (_t6) goto L_020089B8; else goto L_02008994;
   L_02008994: ; // 0x2008994
         /* 02008994 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02008994 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02008998 */ /* nop */
-        /* 0200899C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 020089A0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0200899C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 020089A0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020089A0 */ _t9 = _t8 & 0x00000001u;
         /* 020089A0 */ if (_t9) goto L_020089A4; else goto L_020089B8;
   L_020089A4: ; // 0x20089a4
@@ -8362,11 +8362,11 @@ void Gambit_fn_0206F248(CPUState* cpu) {
         /* 0206F3F4 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0206F3F4 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0206F3F8 */ cpu->r[30] = cpu->r[3];
-        /* 0206F3F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0206F3F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0206F3FC */ cpu->r[31] = cpu->r[4];
         /* 0206F400 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0206F400 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0206F404 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F404 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F404 */ _t5 = _t4 & 0x00000001u;
         /* 0206F404 */ if (_t5) goto L_0206F474; else goto L_0206F408;
   L_0206F408: ; // 0x206f408
@@ -8380,10 +8380,10 @@ void Gambit_fn_0206F248(CPUState* cpu) {
         /* 0206F420 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0206F420 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0206F424 */ cpu->r[11] = cpu->r[11] + 0xFFFF9114u;
-        /* 0206F428 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0206F428 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0206F42C */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0206F42C */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0206F430 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F430 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F430 */ _t10 = _t9 & 0x00000001u;
         /* 0206F430 */ if (_t10) goto L_0206F464; else goto L_0206F434;
   L_0206F434: ; // 0x206f434
@@ -8404,8 +8404,8 @@ void Gambit_fn_0206F248(CPUState* cpu) {
         /* 0206F460 */ Gambit_fn_02068798(cpu);
   L_0206F464: ; // 0x206f464
         /* 0206F464 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206F464 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0206F468 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0206F468 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F468 */ _t15 = _t14 & 0x00000001u;
         /* 0206F468 */ if (_t15) goto L_0206F474; else goto L_0206F46C;
   L_0206F46C: ; // 0x206f46c
@@ -8433,8 +8433,8 @@ void Gambit_fn_0206F250(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -8485,18 +8485,18 @@ void Gambit_fn_0206F268(CPUState* cpu) {
         /* 0206F270 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0206F270 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0206F274 */ cpu->r[31] = cpu->r[3];
-        /* 0206F274 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0206F274 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0206F278 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0206F278 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0206F27C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F27C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F27C */ _t4 = _t3 & 0x00000001u;
         /* 0206F27C */ if (_t4) goto L_0206F280; else goto L_0206F290;
   L_0206F280: ; // 0x206f280
         /* 0206F280 */ cpu->r[3] = 0x0000021Cu;
         /* 0206F284 */ Gambit_fn_02801A78(cpu);
         /* 0206F288 */ cpu->r[31] = cpu->r[3];
-        /* 0206F288 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0206F28C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F288 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0206F28C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F28C */ _t6 = _t5 & 0x00000001u;
         /* 0206F28C */ if (_t6) goto L_0206F2D8; else goto L_0206F290;
   L_0206F290: ; // 0x206f290
@@ -8544,18 +8544,18 @@ void Gambit_fn_0206F26C(CPUState* cpu) {
         /* 0206F270 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0206F270 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0206F274 */ cpu->r[31] = cpu->r[3];
-        /* 0206F274 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0206F274 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0206F278 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0206F278 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0206F27C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F27C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F27C */ _t4 = _t3 & 0x00000001u;
         /* 0206F27C */ if (_t4) goto L_0206F280; else goto L_0206F290;
   L_0206F280: ; // 0x206f280
         /* 0206F280 */ cpu->r[3] = 0x0000021Cu;
         /* 0206F284 */ Gambit_fn_02801A78(cpu);
         /* 0206F288 */ cpu->r[31] = cpu->r[3];
-        /* 0206F288 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0206F28C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F288 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0206F28C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F28C */ _t6 = _t5 & 0x00000001u;
         /* 0206F28C */ if (_t6) goto L_0206F2D8; else goto L_0206F290;
   L_0206F290: ; // 0x206f290
@@ -8634,7 +8634,7 @@ void Gambit_fn_0206F2F0(CPUState* cpu) {
         /* 0206F354 */ rbrew_write32(cpu->mem, _t6, cpu->r[31]);
         /* 0206F358 */ _t7 = cpu->r[31] + 0x00000000u;
         /* 0206F358 */ rbrew_write8(cpu->mem, _t7, (uint8_t)cpu->r[30]);
-        /* 0206F35C */ _t8 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0206F35C */ _t8 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0206F35C */ _t9 = _t8 & 0x00000001u;
         /* 0206F35C */ if (_t9) goto L_0206F360; // else: addr-0 trap, fall-through
   L_0206F360: ; // 0x206f360
@@ -8647,8 +8647,8 @@ void Gambit_fn_0206F2F0(CPUState* cpu) {
         /* 0206F374 */ _t11 = cpu->r[1] + 0x00000008u;
         /* 0206F374 */ rbrew_write32(cpu->mem, _t11, cpu->r[26]);
         /* 0206F378 */ Gambit_fn_027EBCFC(cpu);
-        /* 0206F37C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206F380 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F37C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206F380 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F380 */ _t13 = _t12 & 0x00000001u;
         /* 0206F380 */ if (_t13) goto L_0206F3B4; else goto L_0206F384;
   L_0206F384: ; // 0x206f384
@@ -8669,9 +8669,9 @@ void Gambit_fn_0206F2F0(CPUState* cpu) {
         /* 0206F3B0 */ Gambit_fn_020E2B5C(cpu);
   L_0206F3B4: ; // 0x206f3b4
         /* 0206F3B4 */ cpu->r[22] = cpu->r[22] + 0xFFFFFFFFu;
-        /* 0206F3B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
+        /* 0206F3B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
         /* 0206F3B8 */ cpu->r[21] = cpu->r[21] + 0x00000001u;
-        /* 0206F3BC */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F3BC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F3BC */ _t18 = _t17 & 0x00000001u;
         /* 0206F3BC */ if (_t18) goto L_0206F3C0; else goto L_0206F33C;
   L_0206F3C0: ; // 0x206f3c0
@@ -8688,15 +8688,15 @@ void Gambit_fn_0206F3D4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0206F3D4: ; // 0x206f3d4
-        /* 0206F3D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206F3D8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F3D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206F3D8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F3D8 */ _t1 = _t0 & 0x00000001u;
         /* 0206F3D8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206F3D8 */ goto L_0206F3DC;
   L_0206F3DC: ; // 0x206f3dc
         /* 0206F3DC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206F3DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206F3E0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F3DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206F3E0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F3E0 */ _t3 = _t2 & 0x00000001u;
         /* 0206F3E0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206F3E0 */ goto L_0206F3E4;
@@ -8715,8 +8715,8 @@ void Gambit_fn_0206F3D4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -8730,15 +8730,15 @@ void Gambit_fn_0206F3D4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -8775,11 +8775,11 @@ void Gambit_fn_0206F3E8(CPUState* cpu) {
         /* 0206F3F4 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0206F3F4 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0206F3F8 */ cpu->r[30] = cpu->r[3];
-        /* 0206F3F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0206F3F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0206F3FC */ cpu->r[31] = cpu->r[4];
         /* 0206F400 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0206F400 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0206F404 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F404 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F404 */ _t5 = _t4 & 0x00000001u;
         /* 0206F404 */ if (_t5) goto L_0206F474; else goto L_0206F408;
   L_0206F408: ; // 0x206f408
@@ -8793,10 +8793,10 @@ void Gambit_fn_0206F3E8(CPUState* cpu) {
         /* 0206F420 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0206F420 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0206F424 */ cpu->r[11] = cpu->r[11] + 0xFFFF9114u;
-        /* 0206F428 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0206F428 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0206F42C */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0206F42C */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0206F430 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F430 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F430 */ _t10 = _t9 & 0x00000001u;
         /* 0206F430 */ if (_t10) goto L_0206F464; else goto L_0206F434;
   L_0206F434: ; // 0x206f434
@@ -8817,8 +8817,8 @@ void Gambit_fn_0206F3E8(CPUState* cpu) {
         /* 0206F460 */ Gambit_fn_02068798(cpu);
   L_0206F464: ; // 0x206f464
         /* 0206F464 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206F464 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0206F468 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0206F468 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F468 */ _t15 = _t14 & 0x00000001u;
         /* 0206F468 */ if (_t15) goto L_0206F474; else goto L_0206F46C;
   L_0206F46C: ; // 0x206f46c
@@ -8849,11 +8849,11 @@ void Gambit_fn_0206F3EC(CPUState* cpu) {
         /* 0206F3F4 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0206F3F4 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0206F3F8 */ cpu->r[30] = cpu->r[3];
-        /* 0206F3F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0206F3F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0206F3FC */ cpu->r[31] = cpu->r[4];
         /* 0206F400 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0206F400 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0206F404 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F404 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F404 */ _t5 = _t4 & 0x00000001u;
         /* 0206F404 */ if (_t5) goto L_0206F474; else goto L_0206F408;
   L_0206F408: ; // 0x206f408
@@ -8867,10 +8867,10 @@ void Gambit_fn_0206F3EC(CPUState* cpu) {
         /* 0206F420 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0206F420 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0206F424 */ cpu->r[11] = cpu->r[11] + 0xFFFF9114u;
-        /* 0206F428 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0206F428 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0206F42C */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0206F42C */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0206F430 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F430 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F430 */ _t10 = _t9 & 0x00000001u;
         /* 0206F430 */ if (_t10) goto L_0206F464; else goto L_0206F434;
   L_0206F434: ; // 0x206f434
@@ -8891,8 +8891,8 @@ void Gambit_fn_0206F3EC(CPUState* cpu) {
         /* 0206F460 */ Gambit_fn_02068798(cpu);
   L_0206F464: ; // 0x206f464
         /* 0206F464 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206F464 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0206F468 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0206F468 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F468 */ _t15 = _t14 & 0x00000001u;
         /* 0206F468 */ if (_t15) goto L_0206F474; else goto L_0206F46C;
   L_0206F46C: ; // 0x206f46c
@@ -8947,15 +8947,15 @@ void Gambit_fn_0206F4A4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0206F4A4: ; // 0x206f4a4
-        /* 0206F4A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206F4A8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F4A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206F4A8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F4A8 */ _t1 = _t0 & 0x00000001u;
         /* 0206F4A8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206F4A8 */ goto L_0206F4AC;
   L_0206F4AC: ; // 0x206f4ac
         /* 0206F4AC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206F4AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206F4B0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F4AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206F4B0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F4B0 */ _t3 = _t2 & 0x00000001u;
         /* 0206F4B0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206F4B0 */ goto L_0206F4B4;
@@ -8974,8 +8974,8 @@ void Gambit_fn_0206F4A4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -8989,15 +8989,15 @@ void Gambit_fn_0206F4A4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -9043,15 +9043,15 @@ void Gambit_fn_0206F4D4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0206F4D4: ; // 0x206f4d4
-        /* 0206F4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206F4D8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206F4D8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F4D8 */ _t1 = _t0 & 0x00000001u;
         /* 0206F4D8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206F4D8 */ goto L_0206F4DC;
   L_0206F4DC: ; // 0x206f4dc
         /* 0206F4DC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206F4DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206F4E0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F4DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206F4E0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F4E0 */ _t3 = _t2 & 0x00000001u;
         /* 0206F4E0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206F4E0 */ goto L_0206F4E4;
@@ -9070,8 +9070,8 @@ void Gambit_fn_0206F4D4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -9085,15 +9085,15 @@ void Gambit_fn_0206F4D4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -9121,15 +9121,15 @@ void Gambit_fn_0206F4E8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0206F4E8: ; // 0x206f4e8
-        /* 0206F4E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206F4EC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F4E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206F4EC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F4EC */ _t1 = _t0 & 0x00000001u;
         /* 0206F4EC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206F4EC */ goto L_0206F4F0;
   L_0206F4F0: ; // 0x206f4f0
         /* 0206F4F0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0206F4F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206F4F4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F4F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206F4F4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F4F4 */ _t3 = _t2 & 0x00000001u;
         /* 0206F4F4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0206F4F4 */ goto L_0206F4F8;
@@ -9148,8 +9148,8 @@ void Gambit_fn_0206F4E8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -9163,15 +9163,15 @@ void Gambit_fn_0206F4E8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -9277,9 +9277,9 @@ void Gambit_fn_0206F53C(CPUState* cpu) {
         /* 0206F540 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 0206F540 */ cpu->r[9] = _t0;
         /* 0206F544 */ cpu->r[12] = 0x101D0000u;
-        /* 0206F548 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0206F548 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0206F54C */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 0206F550 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F550 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F550 */ _t2 = _t1 & 0x00000001u;
         /* 0206F550 */ if (_t2) goto L_0206F554; else goto L_0206F568;
   L_0206F554: ; // 0x206f554
@@ -9291,8 +9291,8 @@ void Gambit_fn_0206F53C(CPUState* cpu) {
         /* 0206F564 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 0206F564 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_0206F568: ; // 0x206f568
-        /* 0206F568 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0206F56C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F568 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0206F56C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F56C */ _t6 = _t5 & 0x00000001u;
         /* 0206F56C */ if (_t6) goto L_0206F570; else goto L_0206F578;
   L_0206F570: ; // 0x206f570
@@ -9304,9 +9304,9 @@ void Gambit_fn_0206F53C(CPUState* cpu) {
         /* 0206F57C */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 0206F57C */ cpu->r[7] = _t7;
         /* 0206F580 */ cpu->r[11] = 0x101D0000u;
-        /* 0206F584 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0206F584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0206F588 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 0206F58C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F58C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F58C */ _t9 = _t8 & 0x00000001u;
         /* 0206F58C */ if (_t9) goto L_0206F590; else goto L_0206F5A4;
   L_0206F590: ; // 0x206f590
@@ -9433,18 +9433,18 @@ void Gambit_fn_0206F5F8(CPUState* cpu) {
         /* 02008980 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02008980 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02008984 */ cpu->r[12] = 0x00000000u;
-        /* 02008988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02008988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0200898C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0200898C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02008990 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02008990 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02008990 */ _t6 = _t5 & 0x00000001u;
         /* 02008990 */ if (_t6) goto L_020089B8; else goto L_02008994;
   L_02008994: ; // 0x2008994
         /* 02008994 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02008994 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02008998 */ /* nop */
-        /* 0200899C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 020089A0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0200899C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 020089A0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020089A0 */ _t9 = _t8 & 0x00000001u;
         /* 020089A0 */ if (_t9) goto L_020089A4; else goto L_020089B8;
   L_020089A4: ; // 0x20089a4
@@ -9489,11 +9489,11 @@ void Gambit_fn_0206F600(CPUState* cpu) {
         /* 02070020 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02070020 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02070024 */ cpu->r[30] = cpu->r[3];
-        /* 02070024 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02070024 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02070028 */ cpu->r[31] = cpu->r[4];
         /* 0207002C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0207002C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02070030 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070030 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070030 */ _t5 = _t4 & 0x00000001u;
         /* 02070030 */ if (_t5) goto L_020700A0; else goto L_02070034;
   L_02070034: ; // 0x2070034
@@ -9507,10 +9507,10 @@ void Gambit_fn_0206F600(CPUState* cpu) {
         /* 0207004C */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0207004C */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02070050 */ cpu->r[11] = cpu->r[11] + 0xFFFF94F0u;
-        /* 02070054 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02070054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02070058 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02070058 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0207005C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207005C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207005C */ _t10 = _t9 & 0x00000001u;
         /* 0207005C */ if (_t10) goto L_02070090; else goto L_02070060;
   L_02070060: ; // 0x2070060
@@ -9531,8 +9531,8 @@ void Gambit_fn_0206F600(CPUState* cpu) {
         /* 0207008C */ Gambit_fn_02068798(cpu);
   L_02070090: ; // 0x2070090
         /* 02070090 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02070090 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02070094 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070090 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02070094 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070094 */ _t15 = _t14 & 0x00000001u;
         /* 02070094 */ if (_t15) goto L_020700A0; else goto L_02070098;
   L_02070098: ; // 0x2070098
@@ -9560,8 +9560,8 @@ void Gambit_fn_0206F608(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -9612,18 +9612,18 @@ void Gambit_fn_0206F620(CPUState* cpu) {
         /* 0206F628 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0206F628 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0206F62C */ cpu->r[31] = cpu->r[3];
-        /* 0206F62C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0206F62C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0206F630 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0206F630 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0206F634 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F634 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F634 */ _t4 = _t3 & 0x00000001u;
         /* 0206F634 */ if (_t4) goto L_0206F638; else goto L_0206F648;
   L_0206F638: ; // 0x206f638
         /* 0206F638 */ cpu->r[3] = 0x00000224u;
         /* 0206F63C */ Gambit_fn_02801A78(cpu);
         /* 0206F640 */ cpu->r[31] = cpu->r[3];
-        /* 0206F640 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0206F644 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F640 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0206F644 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F644 */ _t6 = _t5 & 0x00000001u;
         /* 0206F644 */ if (_t6) goto L_0206F6A8; else goto L_0206F648;
   L_0206F648: ; // 0x206f648
@@ -9684,18 +9684,18 @@ void Gambit_fn_0206F624(CPUState* cpu) {
         /* 0206F628 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0206F628 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0206F62C */ cpu->r[31] = cpu->r[3];
-        /* 0206F62C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0206F62C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0206F630 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0206F630 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0206F634 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F634 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F634 */ _t4 = _t3 & 0x00000001u;
         /* 0206F634 */ if (_t4) goto L_0206F638; else goto L_0206F648;
   L_0206F638: ; // 0x206f638
         /* 0206F638 */ cpu->r[3] = 0x00000224u;
         /* 0206F63C */ Gambit_fn_02801A78(cpu);
         /* 0206F640 */ cpu->r[31] = cpu->r[3];
-        /* 0206F640 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0206F644 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F640 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0206F644 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F644 */ _t6 = _t5 & 0x00000001u;
         /* 0206F644 */ if (_t6) goto L_0206F6A8; else goto L_0206F648;
   L_0206F648: ; // 0x206f648
@@ -9796,10 +9796,10 @@ void Gambit_fn_0206F6C0(CPUState* cpu) {
         /* 0206F728 */ cpu->r[6] = 0x10010000u;
         /* 0206F72C */ cpu->f[1] = cpu->f[31];
         /* 0206F730 */ cpu->r[30] = cpu->r[3];
-        /* 0206F734 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
+        /* 0206F734 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
         /* 0206F738 */ _t16 = cpu->r[6] + 0xFFFF9244u;
         /* 0206F738 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t16);
-        /* 0206F73C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F73C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F73C */ _t18 = _t17 & 0x00000001u;
         /* 0206F73C */ if (_t18) goto L_0206F740; else goto L_0206F744;
   L_0206F740: ; // 0x206f740
@@ -9844,22 +9844,22 @@ void Gambit_fn_0206F6C0(CPUState* cpu) {
   L_0206F7BC: ; // 0x206f7bc
         /* 0206F7BC */ _t25 = cpu->r[31] + 0x00000000u;
         /* 0206F7BC */ cpu->r[8] = rbrew_read32(cpu->mem, _t25);
-        /* 0206F7C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], cpu->r[8]);
-        /* 0206F7C4 */ _t26 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206F7C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], cpu->r[8]));
+        /* 0206F7C4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206F7C4 */ _t27 = _t26 & 0x00000001u;
         /* 0206F7C4 */ if (_t27) goto L_0206F7C8; else goto L_0206F7D8;
   L_0206F7C8: ; // 0x206f7c8
-        /* 0206F7C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000002u);
+        /* 0206F7C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000002u));
         /* 0206F7CC */ cpu->f[1] = cpu->f[30];
-        /* 0206F7D0 */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206F7D0 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206F7D0 */ _t29 = _t28 & 0x00000001u;
         /* 0206F7D0 */ if (_t29) goto L_0206F7E4; else goto L_0206F7D4;
   L_0206F7D4: ; // 0x206f7d4
         /* 0206F7D4 */ goto L_0206F80C;
   L_0206F7D8: ; // 0x206f7d8
-        /* 0206F7D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000002u);
+        /* 0206F7D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000002u));
         /* 0206F7DC */ cpu->f[1] = cpu->f[31];
-        /* 0206F7E0 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206F7E0 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206F7E0 */ _t31 = _t30 & 0x00000001u;
         /* 0206F7E0 */ if (_t31) goto L_0206F7E4; else goto L_0206F80C;
   L_0206F7E4: ; // 0x206f7e4
@@ -9872,9 +9872,9 @@ void Gambit_fn_0206F6C0(CPUState* cpu) {
         /* 0206F7F0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t34);
         /* 0206F7F4 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 0206F7F8 */ Gambit_fn_027ED914(cpu);
-        /* 0206F7FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000002u);
+        /* 0206F7FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000002u));
         /* 0206F800 */ cpu->f[1] = cpu->f[31];
-        /* 0206F804 */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206F804 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206F804 */ _t36 = _t35 & 0x00000001u;
         /* 0206F804 */ if (_t36) goto L_0206F830; else goto L_0206F808;
   L_0206F808: ; // 0x206f808
@@ -9889,16 +9889,16 @@ void Gambit_fn_0206F6C0(CPUState* cpu) {
         /* 0206F818 */ cpu->r[3] = rbrew_read32(cpu->mem, _t39);
         /* 0206F81C */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 0206F820 */ Gambit_fn_027ED914(cpu);
-        /* 0206F824 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000002u);
+        /* 0206F824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000002u));
         /* 0206F828 */ cpu->f[1] = cpu->f[31];
-        /* 0206F82C */ _t40 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206F82C */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206F82C */ _t41 = _t40 & 0x00000001u;
         /* 0206F82C */ if (_t41) goto L_0206F830; else goto L_0206F840;
   L_0206F830: ; // 0x206f830
         /* 0206F830 */ _t42 = cpu->r[21] + cpu->r[22];
         /* 0206F830 */ cpu->r[9] = rbrew_read32(cpu->mem, _t42);
-        /* 0206F834 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0206F838 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F834 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0206F838 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F838 */ _t44 = _t43 & 0x00000001u;
         /* 0206F838 */ if (_t44) goto L_0206F83C; else goto L_0206F85C;
   L_0206F83C: ; // 0x206f83c
@@ -9906,28 +9906,28 @@ void Gambit_fn_0206F6C0(CPUState* cpu) {
   L_0206F840: ; // 0x206f840
         /* 0206F840 */ _t45 = cpu->r[21] + 0x00000000u;
         /* 0206F840 */ cpu->r[9] = rbrew_read32(cpu->mem, _t45);
-        /* 0206F844 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0206F848 */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0206F848 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F848 */ _t47 = _t46 & 0x00000001u;
         /* 0206F848 */ if (_t47) goto L_0206F84C; else goto L_0206F85C;
   L_0206F84C: ; // 0x206f84c
-        /* 0206F84C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000002u);
+        /* 0206F84C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000002u));
         /* 0206F850 */ cpu->f[1] = cpu->f[31];
-        /* 0206F854 */ _t48 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206F854 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206F854 */ _t49 = _t48 & 0x00000001u;
         /* 0206F854 */ if (_t49) goto L_0206F8F4; else goto L_0206F858;
   L_0206F858: ; // 0x206f858
         /* 0206F858 */ goto L_0206F918;
   L_0206F85C: ; // 0x206f85c
-        /* 0206F85C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000002u);
-        /* 0206F860 */ _t50 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206F85C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000002u));
+        /* 0206F860 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206F860 */ _t51 = _t50 & 0x00000001u;
         /* 0206F860 */ if (_t51) goto L_0206F864; else goto L_0206F874;
   L_0206F864: ; // 0x206f864
         /* 0206F864 */ _t52 = cpu->r[21] + cpu->r[22];
         /* 0206F864 */ cpu->r[10] = rbrew_read32(cpu->mem, _t52);
-        /* 0206F868 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000001u);
-        /* 0206F86C */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F868 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000001u));
+        /* 0206F86C */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F86C */ _t54 = _t53 & 0x00000001u;
         /* 0206F86C */ if (_t54) goto L_0206F870; else goto L_0206F890;
   L_0206F870: ; // 0x206f870
@@ -9935,28 +9935,28 @@ void Gambit_fn_0206F6C0(CPUState* cpu) {
   L_0206F874: ; // 0x206f874
         /* 0206F874 */ _t55 = cpu->r[21] + 0x00000000u;
         /* 0206F874 */ cpu->r[10] = rbrew_read32(cpu->mem, _t55);
-        /* 0206F878 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000001u);
-        /* 0206F87C */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F878 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000001u));
+        /* 0206F87C */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F87C */ _t57 = _t56 & 0x00000001u;
         /* 0206F87C */ if (_t57) goto L_0206F880; else goto L_0206F890;
   L_0206F880: ; // 0x206f880
-        /* 0206F880 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000002u);
+        /* 0206F880 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000002u));
         /* 0206F884 */ cpu->f[1] = cpu->f[30];
-        /* 0206F888 */ _t58 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206F888 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206F888 */ _t59 = _t58 & 0x00000001u;
         /* 0206F888 */ if (_t59) goto L_0206F8F4; else goto L_0206F88C;
   L_0206F88C: ; // 0x206f88c
         /* 0206F88C */ goto L_0206F918;
   L_0206F890: ; // 0x206f890
-        /* 0206F890 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000002u);
-        /* 0206F894 */ _t60 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206F890 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000002u));
+        /* 0206F894 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206F894 */ _t61 = _t60 & 0x00000001u;
         /* 0206F894 */ if (_t61) goto L_0206F898; else goto L_0206F8A8;
   L_0206F898: ; // 0x206f898
         /* 0206F898 */ _t62 = cpu->r[21] + cpu->r[22];
         /* 0206F898 */ cpu->r[0] = rbrew_read32(cpu->mem, _t62);
-        /* 0206F89C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 0206F8A0 */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F89C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 0206F8A0 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F8A0 */ _t64 = _t63 & 0x00000001u;
         /* 0206F8A0 */ if (_t64) goto L_0206F8A4; else goto L_0206F8C4;
   L_0206F8A4: ; // 0x206f8a4
@@ -9964,28 +9964,28 @@ void Gambit_fn_0206F6C0(CPUState* cpu) {
   L_0206F8A8: ; // 0x206f8a8
         /* 0206F8A8 */ _t65 = cpu->r[21] + 0x00000000u;
         /* 0206F8A8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t65);
-        /* 0206F8AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 0206F8B0 */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F8AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 0206F8B0 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F8B0 */ _t67 = _t66 & 0x00000001u;
         /* 0206F8B0 */ if (_t67) goto L_0206F8B4; else goto L_0206F8C4;
   L_0206F8B4: ; // 0x206f8b4
-        /* 0206F8B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000002u);
+        /* 0206F8B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000002u));
         /* 0206F8B8 */ cpu->f[1] = cpu->f[27];
-        /* 0206F8BC */ _t68 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206F8BC */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206F8BC */ _t69 = _t68 & 0x00000001u;
         /* 0206F8BC */ if (_t69) goto L_0206F8F4; else goto L_0206F8C0;
   L_0206F8C0: ; // 0x206f8c0
         /* 0206F8C0 */ goto L_0206F918;
   L_0206F8C4: ; // 0x206f8c4
-        /* 0206F8C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000002u);
-        /* 0206F8C8 */ _t70 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206F8C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000002u));
+        /* 0206F8C8 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206F8C8 */ _t71 = _t70 & 0x00000001u;
         /* 0206F8C8 */ if (_t71) goto L_0206F8CC; else goto L_0206F8DC;
   L_0206F8CC: ; // 0x206f8cc
         /* 0206F8CC */ _t72 = cpu->r[21] + cpu->r[22];
         /* 0206F8CC */ cpu->r[6] = rbrew_read32(cpu->mem, _t72);
-        /* 0206F8D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000002u);
-        /* 0206F8D4 */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F8D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000002u));
+        /* 0206F8D4 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F8D4 */ _t74 = _t73 & 0x00000001u;
         /* 0206F8D4 */ if (_t74) goto L_0206F8D8; else goto L_0206F8EC;
   L_0206F8D8: ; // 0x206f8d8
@@ -9993,15 +9993,15 @@ void Gambit_fn_0206F6C0(CPUState* cpu) {
   L_0206F8DC: ; // 0x206f8dc
         /* 0206F8DC */ _t75 = cpu->r[21] + 0x00000000u;
         /* 0206F8DC */ cpu->r[6] = rbrew_read32(cpu->mem, _t75);
-        /* 0206F8E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000002u);
-        /* 0206F8E4 */ _t76 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F8E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000002u));
+        /* 0206F8E4 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F8E4 */ _t77 = _t76 & 0x00000001u;
         /* 0206F8E4 */ if (_t77) goto L_0206F8E8; else goto L_0206F8EC;
   L_0206F8E8: ; // 0x206f8e8
         /* 0206F8E8 */ cpu->f[1] = cpu->f[26];
   L_0206F8EC: ; // 0x206f8ec
-        /* 0206F8EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000002u);
-        /* 0206F8F0 */ _t78 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206F8EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000002u));
+        /* 0206F8F0 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206F8F0 */ _t79 = _t78 & 0x00000001u;
         /* 0206F8F0 */ if (_t79) goto L_0206F8F4; else goto L_0206F918;
   L_0206F8F4: ; // 0x206f8f4
@@ -10014,8 +10014,8 @@ void Gambit_fn_0206F6C0(CPUState* cpu) {
         /* 0206F900 */ cpu->r[3] = rbrew_read32(cpu->mem, _t82);
         /* 0206F904 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 0206F908 */ Gambit_fn_027ED914(cpu);
-        /* 0206F90C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000002u);
-        /* 0206F910 */ _t83 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206F90C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000002u));
+        /* 0206F910 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206F910 */ _t84 = _t83 & 0x00000001u;
         /* 0206F910 */ if (_t84) goto L_0206F938; else goto L_0206F914;
   L_0206F914: ; // 0x206f914
@@ -10030,15 +10030,15 @@ void Gambit_fn_0206F6C0(CPUState* cpu) {
         /* 0206F924 */ cpu->r[3] = rbrew_read32(cpu->mem, _t87);
         /* 0206F928 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 0206F92C */ Gambit_fn_027ED914(cpu);
-        /* 0206F930 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000002u);
-        /* 0206F934 */ _t88 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206F930 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000002u));
+        /* 0206F934 */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206F934 */ _t89 = _t88 & 0x00000001u;
         /* 0206F934 */ if (_t89) goto L_0206F938; else goto L_0206F948;
   L_0206F938: ; // 0x206f938
         /* 0206F938 */ _t90 = cpu->r[27] + cpu->r[23];
         /* 0206F938 */ cpu->r[8] = rbrew_read8(cpu->mem, _t90);
-        /* 0206F93C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 0206F940 */ _t91 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F93C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 0206F940 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F940 */ _t92 = _t91 & 0x00000001u;
         /* 0206F940 */ if (_t92) goto L_0206F964; else goto L_0206F944;
   L_0206F944: ; // 0x206f944
@@ -10046,29 +10046,29 @@ void Gambit_fn_0206F6C0(CPUState* cpu) {
   L_0206F948: ; // 0x206f948
         /* 0206F948 */ _t93 = cpu->r[27] + 0x00000000u;
         /* 0206F948 */ cpu->r[8] = rbrew_read8(cpu->mem, _t93);
-        /* 0206F94C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 0206F950 */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F94C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 0206F950 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F950 */ _t95 = _t94 & 0x00000001u;
         /* 0206F950 */ if (_t95) goto L_0206F964; else goto L_0206F954;
   L_0206F954: ; // 0x206f954
-        /* 0206F954 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000002u);
+        /* 0206F954 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000002u));
         /* 0206F958 */ cpu->f[1] = cpu->f[29];
-        /* 0206F95C */ _t96 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206F95C */ _t96 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206F95C */ _t97 = _t96 & 0x00000001u;
         /* 0206F95C */ if (_t97) goto L_0206F9DC; else goto L_0206F960;
   L_0206F960: ; // 0x206f960
         /* 0206F960 */ goto L_0206FA08;
   L_0206F964: ; // 0x206f964
-        /* 0206F964 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000002u);
+        /* 0206F964 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000002u));
         /* 0206F968 */ cpu->r[12] = cpu->r[31] + 0x0000000Cu;
-        /* 0206F96C */ _t98 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206F96C */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206F96C */ _t99 = _t98 & 0x00000001u;
         /* 0206F96C */ if (_t99) goto L_0206F970; else goto L_0206F980;
   L_0206F970: ; // 0x206f970
         /* 0206F970 */ _t100 = cpu->r[12] + cpu->r[22];
         /* 0206F970 */ cpu->r[0] = rbrew_read32(cpu->mem, _t100);
-        /* 0206F974 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206F978 */ _t101 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206F978 */ _t101 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F978 */ _t102 = _t101 & 0x00000001u;
         /* 0206F978 */ if (_t102) goto L_0206F97C; else goto L_0206F99C;
   L_0206F97C: ; // 0x206f97c
@@ -10076,21 +10076,21 @@ void Gambit_fn_0206F6C0(CPUState* cpu) {
   L_0206F980: ; // 0x206f980
         /* 0206F980 */ _t103 = cpu->r[12] + 0x00000000u;
         /* 0206F980 */ cpu->r[0] = rbrew_read32(cpu->mem, _t103);
-        /* 0206F984 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0206F988 */ _t104 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206F984 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0206F988 */ _t104 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206F988 */ _t105 = _t104 & 0x00000001u;
         /* 0206F988 */ if (_t105) goto L_0206F98C; else goto L_0206F99C;
   L_0206F98C: ; // 0x206f98c
-        /* 0206F98C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000002u);
+        /* 0206F98C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000002u));
         /* 0206F990 */ cpu->f[1] = cpu->f[28];
-        /* 0206F994 */ _t106 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206F994 */ _t106 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206F994 */ _t107 = _t106 & 0x00000001u;
         /* 0206F994 */ if (_t107) goto L_0206F9DC; else goto L_0206F998;
   L_0206F998: ; // 0x206f998
         /* 0206F998 */ goto L_0206FA08;
   L_0206F99C: ; // 0x206f99c
-        /* 0206F99C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000002u);
-        /* 0206F9A0 */ _t108 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206F99C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000002u));
+        /* 0206F9A0 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206F9A0 */ _t109 = _t108 & 0x00000001u;
         /* 0206F9A0 */ if (_t109) goto L_0206F9A4; else goto L_0206F9A8;
   L_0206F9A4: ; // 0x206f9a4
@@ -10111,9 +10111,9 @@ void Gambit_fn_0206F6C0(CPUState* cpu) {
         /* 0206F9C8 */ _t114 = cpu->r[1] + 0x00000010u;
         /* 0206F9C8 */ cpu->f[12] = rbrew_read_f64(cpu->mem, _t114);
         /* 0206F9CC */ cpu->f[13] = cpu->f[12] - cpu->f[0];
-        /* 0206F9D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000002u);
+        /* 0206F9D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000002u));
         /* 0206F9D4 */ cpu->f[1] = (double)(float)cpu->f[13];
-        /* 0206F9D8 */ _t115 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206F9D8 */ _t115 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206F9D8 */ _t116 = _t115 & 0x00000001u;
         /* 0206F9D8 */ if (_t116) goto L_0206F9DC; else goto L_0206FA08;
   L_0206F9DC: ; // 0x206f9dc
@@ -10127,10 +10127,10 @@ void Gambit_fn_0206F6C0(CPUState* cpu) {
         /* 0206F9EC */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 0206F9F0 */ Gambit_fn_027ED914(cpu);
         /* 0206F9F4 */ cpu->r[24] = cpu->r[24] + 0xFFFFFFFFu;
-        /* 0206F9F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 0206F9F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 0206F9F8 */ cpu->r[23] = cpu->r[23] + 0x00000001u;
         /* 0206F9FC */ cpu->r[22] = cpu->r[22] + 0x00000004u;
-        /* 0206FA00 */ _t120 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206FA00 */ _t120 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206FA00 */ _t121 = _t120 & 0x00000001u;
         /* 0206FA00 */ if (_t121) goto L_0206FA04; else goto L_0206F7BC;
   L_0206FA04: ; // 0x206fa04
@@ -10146,10 +10146,10 @@ void Gambit_fn_0206F6C0(CPUState* cpu) {
         /* 0206FA18 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 0206FA1C */ Gambit_fn_027ED914(cpu);
         /* 0206FA20 */ cpu->r[24] = cpu->r[24] + 0xFFFFFFFFu;
-        /* 0206FA20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 0206FA20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 0206FA24 */ cpu->r[23] = cpu->r[23] + 0x00000001u;
         /* 0206FA28 */ cpu->r[22] = cpu->r[22] + 0x00000004u;
-        /* 0206FA2C */ _t125 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206FA2C */ _t125 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206FA2C */ _t126 = _t125 & 0x00000001u;
         /* 0206FA2C */ if (_t126) goto L_0206FA30; else goto L_0206F7BC;
   L_0206FA30: ; // 0x206fa30
@@ -10178,7 +10178,7 @@ void Gambit_fn_0206F6C0(CPUState* cpu) {
         /* 0206FA5C */ cpu->f[26] = rbrew_read_f64(cpu->mem, _t137);
         /* 0206FA60 */ _t138 = cpu->r[1] + 0x000000A0u;
         /* 0206FA60 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t138);
-        /* 0206FA64 */ _t139 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206FA64 */ _t139 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206FA64 */ _t140 = _t139 & 0x00000001u;
         /* 0206FA64 */ if (_t140) goto L_0206FA68; // else: addr-0 trap, fall-through
   L_0206FA68: ; // 0x206fa68
@@ -10231,13 +10231,13 @@ void Gambit_fn_0206FA78(CPUState* cpu) {
         /* 0206FADC */ rbrew_write32(cpu->mem, _t6, cpu->r[31]);
         /* 0206FAE0 */ _t7 = cpu->r[31] + 0x00000000u;
         /* 0206FAE0 */ rbrew_write8(cpu->mem, _t7, (uint8_t)cpu->r[30]);
-        /* 0206FAE4 */ _t8 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0206FAE4 */ _t8 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0206FAE4 */ _t9 = _t8 & 0x00000001u;
         /* 0206FAE4 */ if (_t9) goto L_0206FAE8; // else: addr-0 trap, fall-through
   L_0206FAE8: ; // 0x206fae8
         /* 0206FAE8 */ Gambit_fn_0282A5F4(cpu);
-        /* 0206FAEC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[17], 0x00000002u);
-        /* 0206FAF0 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206FAEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[17], 0x00000002u));
+        /* 0206FAF0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206FAF0 */ _t11 = _t10 & 0x00000001u;
         /* 0206FAF0 */ if (_t11) goto L_0206FAF4; else goto L_0206FB18;
   L_0206FAF4: ; // 0x206faf4
@@ -10247,9 +10247,9 @@ void Gambit_fn_0206FA78(CPUState* cpu) {
         /* 0206FB00 */ Gambit_fn_026D86B0(cpu);
         /* 0206FB04 */ _t12 = cpu->r[19] + 0xFFFFED98u;
         /* 0206FB04 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0206FB08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0206FB08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0206FB0C */ cpu->r[29] = cpu->r[3];
-        /* 0206FB10 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206FB10 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206FB10 */ _t14 = _t13 & 0x00000001u;
         /* 0206FB10 */ if (_t14) goto L_0206FB14; else goto L_0206FB48;
   L_0206FB14: ; // 0x206fb14
@@ -10261,9 +10261,9 @@ void Gambit_fn_0206FA78(CPUState* cpu) {
         /* 0206FB24 */ Gambit_fn_026D86B0(cpu);
         /* 0206FB28 */ _t15 = cpu->r[19] + 0xFFFFED98u;
         /* 0206FB28 */ cpu->r[0] = rbrew_read32(cpu->mem, _t15);
-        /* 0206FB2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0206FB2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0206FB30 */ cpu->r[29] = cpu->r[3];
-        /* 0206FB34 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206FB34 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206FB34 */ _t17 = _t16 & 0x00000001u;
         /* 0206FB34 */ if (_t17) goto L_0206FB38; else goto L_0206FB48;
   L_0206FB38: ; // 0x206fb38
@@ -10274,8 +10274,8 @@ void Gambit_fn_0206FA78(CPUState* cpu) {
         /* 0206FB44 */ _t19 = cpu->r[18] + 0xFFFFEDE0u;
         /* 0206FB44 */ rbrew_write32(cpu->mem, _t19, cpu->r[0]);
   L_0206FB48: ; // 0x206fb48
-        /* 0206FB48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0206FB4C */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206FB48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0206FB4C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206FB4C */ _t21 = _t20 & 0x00000001u;
         /* 0206FB4C */ if (_t21) goto L_0206FB70; else goto L_0206FB50;
   L_0206FB50: ; // 0x206fb50
@@ -10287,8 +10287,8 @@ void Gambit_fn_0206FA78(CPUState* cpu) {
         /* 0206FB5C */ cpu->r[3] = cpu->r[29];
         /* 0206FB60 */ cpu->r[4] = cpu->r[18] + 0xFFFFEDE0u;
         /* 0206FB64 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0206FB68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206FB6C */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206FB68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206FB6C */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206FB6C */ _t25 = _t24 & 0x00000001u;
         /* 0206FB6C */ if (_t25) goto L_0206FB70; else goto L_0206FB74;
   L_0206FB70: ; // 0x206fb70
@@ -10297,10 +10297,10 @@ void Gambit_fn_0206FA78(CPUState* cpu) {
         /* 0206FB74 */ _t26 = cpu->r[26] + 0x00000000u;
         /* 0206FB74 */ rbrew_write32(cpu->mem, _t26, cpu->r[29]);
         /* 0206FB78 */ cpu->r[28] = cpu->r[28] + 0xFFFFFFFFu;
-        /* 0206FB78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 0206FB78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 0206FB7C */ cpu->r[17] = cpu->r[17] + 0x00000001u;
         /* 0206FB80 */ cpu->r[20] = cpu->r[20] + 0x00000004u;
-        /* 0206FB84 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206FB84 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206FB84 */ _t28 = _t27 & 0x00000001u;
         /* 0206FB84 */ if (_t28) goto L_0206FB88; else goto L_0206FAC4;
   L_0206FB88: ; // 0x206fb88
@@ -10388,8 +10388,8 @@ void Gambit_fn_0206FB9C(CPUState* cpu) {
         /* 0206FC64 */ cpu->r[5] = cpu->r[1] + 0x00000010u;
         /* 0206FC68 */ cpu->r[6] = cpu->r[1] + 0x00000018u;
         /* 0206FC6C */ Gambit_fn_027ECDD0(cpu);
-        /* 0206FC70 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000002u);
-        /* 0206FC74 */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206FC70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000002u));
+        /* 0206FC74 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206FC74 */ _t16 = _t15 & 0x00000001u;
         /* 0206FC74 */ if (_t16) goto L_0206FC78; else goto L_0206FCB0;
   L_0206FC78: ; // 0x206fc78
@@ -10411,8 +10411,8 @@ void Gambit_fn_0206FB9C(CPUState* cpu) {
         /* 0206FC98 */ cpu->r[5] = cpu->r[1] + 0x00000010u;
         /* 0206FC9C */ cpu->r[6] = cpu->r[1] + 0x00000008u;
         /* 0206FCA0 */ Gambit_fn_027ECDD0(cpu);
-        /* 0206FCA4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000002u);
-        /* 0206FCA8 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206FCA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000002u));
+        /* 0206FCA8 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206FCA8 */ _t25 = _t24 & 0x00000001u;
         /* 0206FCA8 */ if (_t25) goto L_0206FCE4; else goto L_0206FCAC;
   L_0206FCAC: ; // 0x206fcac
@@ -10436,8 +10436,8 @@ void Gambit_fn_0206FB9C(CPUState* cpu) {
         /* 0206FCD0 */ cpu->r[5] = cpu->r[1] + 0x00000010u;
         /* 0206FCD4 */ cpu->r[6] = cpu->r[1] + 0x00000008u;
         /* 0206FCD8 */ Gambit_fn_027ECDD0(cpu);
-        /* 0206FCDC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000002u);
-        /* 0206FCE0 */ _t33 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206FCDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000002u));
+        /* 0206FCE0 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206FCE0 */ _t34 = _t33 & 0x00000001u;
         /* 0206FCE0 */ if (_t34) goto L_0206FCE4; else goto L_0206FD34;
   L_0206FCE4: ; // 0x206fce4
@@ -10461,14 +10461,14 @@ void Gambit_fn_0206FB9C(CPUState* cpu) {
         /* 0206FD0C */ Gambit_fn_027ECDD0(cpu);
         /* 0206FD10 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
         /* 0206FD14 */ cpu->r[19] = cpu->r[19] + 0x00000004u;
-        /* 0206FD18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000002u);
+        /* 0206FD18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000002u));
         /* 0206FD1C */ cpu->r[20] = cpu->r[20] + 0x00000004u;
-        /* 0206FD20 */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206FD20 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206FD20 */ _t43 = _t42 & 0x00000001u;
         /* 0206FD20 */ if (_t43) goto L_0206FD24; else goto L_0206FD74;
   L_0206FD24: ; // 0x206fd24
-        /* 0206FD24 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000002u);
-        /* 0206FD28 */ _t44 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206FD24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000002u));
+        /* 0206FD28 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206FD28 */ _t45 = _t44 & 0x00000001u;
         /* 0206FD28 */ if (_t45) goto L_0206FC3C; else goto L_0206FD2C;
   L_0206FD2C: ; // 0x206fd2c
@@ -10495,9 +10495,9 @@ void Gambit_fn_0206FB9C(CPUState* cpu) {
         /* 0206FD5C */ Gambit_fn_027ECDD0(cpu);
         /* 0206FD60 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
         /* 0206FD64 */ cpu->r[19] = cpu->r[19] + 0x00000004u;
-        /* 0206FD68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000002u);
+        /* 0206FD68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000002u));
         /* 0206FD6C */ cpu->r[20] = cpu->r[20] + 0x00000004u;
-        /* 0206FD70 */ _t53 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206FD70 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206FD70 */ _t54 = _t53 & 0x00000001u;
         /* 0206FD70 */ if (_t54) goto L_0206FD24; else goto L_0206FD74;
   L_0206FD74: ; // 0x206fd74
@@ -10545,23 +10545,23 @@ void Gambit_fn_0206FD88(CPUState* cpu) {
         /* 0206FDD4 */ _t8 = cpu->r[5] + 0x00000000u;
         /* 0206FDD4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t8);
         /* 0206FDD8 */ cpu->r[30] = 0x00000000u;
-        /* 0206FDDC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 0206FDDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 0206FDE0 */ cpu->r[6] = 0x00080000u;
-        /* 0206FDE4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206FDE4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206FDE4 */ _t10 = _t9 & 0x00000001u;
         /* 0206FDE4 */ if (_t10) goto L_0206FE0C; else goto L_0206FDE8;
   L_0206FDE8: ; // 0x206fde8
         /* 0206FDE8 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0206FDEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[6]);
+        /* 0206FDEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[6]));
         /* 0206FDF0 */ cpu->r[5] = cpu->r[5] + 0x00000001u;
-        /* 0206FDF4 */ _t11 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206FDF4 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206FDF4 */ _t12 = _t11 & 0x00000001u;
         /* 0206FDF4 */ if (_t12) goto L_0206FE08; else goto L_0206FDF8;
   L_0206FDF8: ; // 0x206fdf8
         /* 0206FDF8 */ _t13 = cpu->r[5] + 0x00000000u;
         /* 0206FDF8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t13);
-        /* 0206FDFC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 0206FE00 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206FDFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 0206FE00 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206FE00 */ _t15 = _t14 & 0x00000001u;
         /* 0206FE00 */ if (_t15) goto L_0206FE04; else goto L_0206FDE8;
   L_0206FE04: ; // 0x206fe04
@@ -10581,23 +10581,23 @@ void Gambit_fn_0206FD88(CPUState* cpu) {
         /* 0206FE24 */ _t19 = cpu->r[12] + 0x00000000u;
         /* 0206FE24 */ cpu->r[7] = rbrew_read8(cpu->mem, _t19);
         /* 0206FE28 */ cpu->r[4] = 0x00080000u;
-        /* 0206FE2C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[31]);
+        /* 0206FE2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[31]));
         /* 0206FE30 */ cpu->r[29] = 0x00000000u;
-        /* 0206FE34 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206FE34 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206FE34 */ _t21 = _t20 & 0x00000001u;
         /* 0206FE34 */ if (_t21) goto L_0206FE5C; else goto L_0206FE38;
   L_0206FE38: ; // 0x206fe38
         /* 0206FE38 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 0206FE3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[4]);
+        /* 0206FE3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[4]));
         /* 0206FE40 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 0206FE44 */ _t22 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206FE44 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206FE44 */ _t23 = _t22 & 0x00000001u;
         /* 0206FE44 */ if (_t23) goto L_0206FE58; else goto L_0206FE48;
   L_0206FE48: ; // 0x206fe48
         /* 0206FE48 */ _t24 = cpu->r[12] + 0x00000000u;
         /* 0206FE48 */ cpu->r[9] = rbrew_read8(cpu->mem, _t24);
-        /* 0206FE4C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[31]);
-        /* 0206FE50 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206FE4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[31]));
+        /* 0206FE50 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206FE50 */ _t26 = _t25 & 0x00000001u;
         /* 0206FE50 */ if (_t26) goto L_0206FE54; else goto L_0206FE38;
   L_0206FE54: ; // 0x206fe54
@@ -10606,9 +10606,9 @@ void Gambit_fn_0206FD88(CPUState* cpu) {
         /* 0206FE58 */ cpu->r[29] = 0x00000000u;
   L_0206FE5C: ; // 0x206fe5c
         /* 0206FE5C */ cpu->r[30] = cpu->r[30] - cpu->r[29];
-        /* 0206FE5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0206FE5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0206FE60 */ cpu->r[28] = 0x00000000u;
-        /* 0206FE64 */ _t27 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0206FE64 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0206FE64 */ _t28 = _t27 & 0x00000001u;
         /* 0206FE64 */ if (_t28) goto L_0206FF30; else goto L_0206FE68;
   L_0206FE68: ; // 0x206fe68
@@ -10640,13 +10640,13 @@ void Gambit_fn_0206FD88(CPUState* cpu) {
         /* 0206FEAC */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0206FEB0 */ _t37 = cpu->r[1] + 0x00000010u;
         /* 0206FEB0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t37);
-        /* 0206FEB4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[24], cpu->r[9]);
-        /* 0206FEB8 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206FEB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[24], cpu->r[9]));
+        /* 0206FEB8 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206FEB8 */ _t39 = _t38 & 0x00000001u;
         /* 0206FEB8 */ if (_t39) goto L_0206FF0C; else goto L_0206FEBC;
   L_0206FEBC: ; // 0x206febc
-        /* 0206FEBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0206FEC0 */ _t40 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206FEBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0206FEC0 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206FEC0 */ _t41 = _t40 & 0x00000001u;
         /* 0206FEC0 */ if (_t41) goto L_0206FEC4; else goto L_0206FF0C;
   L_0206FEC4: ; // 0x206fec4
@@ -10658,15 +10658,15 @@ void Gambit_fn_0206FD88(CPUState* cpu) {
   L_0206FED0: ; // 0x206fed0
         /* 0206FED0 */ _t44 = cpu->r[6] + 0x00000000u;
         /* 0206FED0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t44);
-        /* 0206FED4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 0206FED8 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206FED4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 0206FED8 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206FED8 */ _t46 = _t45 & 0x00000001u;
         /* 0206FED8 */ if (_t46) goto L_0206FEDC; else goto L_0206FEEC;
   L_0206FEDC: ; // 0x206fedc
         /* 0206FEDC */ _t47 = cpu->r[4] + 0x00000000u;
         /* 0206FEDC */ cpu->r[10] = rbrew_read8(cpu->mem, _t47);
-        /* 0206FEE0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[31]);
-        /* 0206FEE4 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206FEE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[31]));
+        /* 0206FEE4 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206FEE4 */ _t49 = _t48 & 0x00000001u;
         /* 0206FEE4 */ if (_t49) goto L_0206FF0C; else goto L_0206FEE8;
   L_0206FEE8: ; // 0x206fee8
@@ -10674,13 +10674,13 @@ void Gambit_fn_0206FD88(CPUState* cpu) {
   L_0206FEEC: ; // 0x206feec
         /* 0206FEEC */ _t50 = cpu->r[4] + 0x00000000u;
         /* 0206FEEC */ cpu->r[7] = rbrew_read8(cpu->mem, _t50);
-        /* 0206FEF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[31]);
-        /* 0206FEF4 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206FEF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[31]));
+        /* 0206FEF4 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206FEF4 */ _t52 = _t51 & 0x00000001u;
         /* 0206FEF4 */ if (_t52) goto L_0206FF24; else goto L_0206FEF8;
   L_0206FEF8: ; // 0x206fef8
-        /* 0206FEF8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[0]);
-        /* 0206FEFC */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206FEF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[0]));
+        /* 0206FEFC */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206FEFC */ _t54 = _t53 & 0x00000001u;
         /* 0206FEFC */ if (_t54) goto L_0206FF00; else goto L_0206FF24;
   L_0206FF00: ; // 0x206ff00
@@ -10696,25 +10696,25 @@ void Gambit_fn_0206FD88(CPUState* cpu) {
         /* 0206FF0C */ cpu->r[11] = ~_t58;
         /* 0206FF10 */ cpu->r[0] = cpu->r[11] + 0xFFFFFFFFu;
         /* 0206FF14 */ cpu->r[8] = cpu->r[11] - cpu->r[0];
-        /* 0206FF14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0206FF14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0206FF18 */ cpu->r[3] = 0x00000000u;
-        /* 0206FF1C */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206FF1C */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206FF1C */ _t60 = _t59 & 0x00000001u;
         /* 0206FF1C */ if (_t60) goto L_0206FF44; else goto L_0206FF20;
   L_0206FF20: ; // 0x206ff20
         /* 0206FF20 */ goto L_0206FF40;
   L_0206FF24: ; // 0x206ff24
         /* 0206FF24 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
-        /* 0206FF28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], cpu->r[30]);
-        /* 0206FF2C */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0206FF28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], cpu->r[30]));
+        /* 0206FF2C */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0206FF2C */ _t62 = _t61 & 0x00000001u;
         /* 0206FF2C */ if (_t62) goto L_0206FF30; else goto L_0206FE68;
   L_0206FF30: ; // 0x206ff30
         /* 0206FF30 */ cpu->r[3] = 0x00000000u;
         /* 0206FF34 */ cpu->r[0] = cpu->r[3] + 0xFFFFFFFFu;
         /* 0206FF38 */ cpu->r[8] = ~cpu->r[0];
-        /* 0206FF38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 0206FF3C */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206FF38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 0206FF3C */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206FF3C */ _t64 = _t63 & 0x00000001u;
         /* 0206FF3C */ if (_t64) goto L_0206FF44; else goto L_0206FF40;
   L_0206FF40: ; // 0x206ff40
@@ -10740,18 +10740,18 @@ void Gambit_fn_0206FF58(CPUState* cpu) {
         /* 0206FF60 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0206FF60 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0206FF64 */ cpu->r[31] = cpu->r[3];
-        /* 0206FF64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0206FF64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0206FF68 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0206FF68 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0206FF6C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206FF6C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206FF6C */ _t4 = _t3 & 0x00000001u;
         /* 0206FF6C */ if (_t4) goto L_0206FF70; else goto L_0206FF80;
   L_0206FF70: ; // 0x206ff70
         /* 0206FF70 */ cpu->r[3] = 0x00000018u;
         /* 0206FF74 */ Gambit_fn_02801A78(cpu);
         /* 0206FF78 */ cpu->r[31] = cpu->r[3];
-        /* 0206FF78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0206FF7C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206FF78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0206FF7C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206FF7C */ _t6 = _t5 & 0x00000001u;
         /* 0206FF7C */ if (_t6) goto L_0206FFE8; else goto L_0206FF80;
   L_0206FF80: ; // 0x206ff80
@@ -10822,18 +10822,18 @@ void Gambit_fn_0206FF5C(CPUState* cpu) {
         /* 0206FF60 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0206FF60 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0206FF64 */ cpu->r[31] = cpu->r[3];
-        /* 0206FF64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0206FF64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0206FF68 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0206FF68 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0206FF6C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206FF6C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206FF6C */ _t4 = _t3 & 0x00000001u;
         /* 0206FF6C */ if (_t4) goto L_0206FF70; else goto L_0206FF80;
   L_0206FF70: ; // 0x206ff70
         /* 0206FF70 */ cpu->r[3] = 0x00000018u;
         /* 0206FF74 */ Gambit_fn_02801A78(cpu);
         /* 0206FF78 */ cpu->r[31] = cpu->r[3];
-        /* 0206FF78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0206FF7C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206FF78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0206FF7C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206FF7C */ _t6 = _t5 & 0x00000001u;
         /* 0206FF7C */ if (_t6) goto L_0206FFE8; else goto L_0206FF80;
   L_0206FF80: ; // 0x206ff80
@@ -10898,15 +10898,15 @@ void Gambit_fn_02070000(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02070000: ; // 0x2070000
-        /* 02070000 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070004 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070000 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070004 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070004 */ _t1 = _t0 & 0x00000001u;
         /* 02070004 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02070004 */ goto L_02070008;
   L_02070008: ; // 0x2070008
         /* 02070008 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02070008 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207000C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070008 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207000C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207000C */ _t3 = _t2 & 0x00000001u;
         /* 0207000C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207000C */ goto L_02070010;
@@ -10925,8 +10925,8 @@ void Gambit_fn_02070000(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -10940,15 +10940,15 @@ void Gambit_fn_02070000(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -10976,14 +10976,14 @@ void Gambit_fn_02070004(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02070004: ; // 0x2070004
-        /* 02070004 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070004 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070004 */ _t1 = _t0 & 0x00000001u;
         /* 02070004 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02070004 */ goto L_02070008;
   L_02070008: ; // 0x2070008
         /* 02070008 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02070008 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207000C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070008 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207000C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207000C */ _t3 = _t2 & 0x00000001u;
         /* 0207000C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207000C */ goto L_02070010;
@@ -11002,8 +11002,8 @@ void Gambit_fn_02070004(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -11017,15 +11017,15 @@ void Gambit_fn_02070004(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -11054,8 +11054,8 @@ void Gambit_fn_02070008(CPUState* cpu) {
 
   L_02070008: ; // 0x2070008
         /* 02070008 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02070008 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207000C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070008 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207000C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207000C */ _t1 = _t0 & 0x00000001u;
         /* 0207000C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207000C */ goto L_02070010;
@@ -11074,8 +11074,8 @@ void Gambit_fn_02070008(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 02801B48 */ _t5 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t5);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t7 = _t6 & 0x00000001u;
         /* 02801B50 */ if (_t7) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -11089,15 +11089,15 @@ void Gambit_fn_02070008(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t11 = _t10 & 0x00000001u;
         /* 02801B74 */ if (_t11) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t13 = _t12 & 0x00000001u;
         /* 02801B84 */ if (_t13) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -11134,11 +11134,11 @@ void Gambit_fn_02070014(CPUState* cpu) {
         /* 02070020 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02070020 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02070024 */ cpu->r[30] = cpu->r[3];
-        /* 02070024 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02070024 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02070028 */ cpu->r[31] = cpu->r[4];
         /* 0207002C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0207002C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02070030 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070030 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070030 */ _t5 = _t4 & 0x00000001u;
         /* 02070030 */ if (_t5) goto L_020700A0; else goto L_02070034;
   L_02070034: ; // 0x2070034
@@ -11152,10 +11152,10 @@ void Gambit_fn_02070014(CPUState* cpu) {
         /* 0207004C */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0207004C */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02070050 */ cpu->r[11] = cpu->r[11] + 0xFFFF94F0u;
-        /* 02070054 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02070054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02070058 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02070058 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0207005C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207005C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207005C */ _t10 = _t9 & 0x00000001u;
         /* 0207005C */ if (_t10) goto L_02070090; else goto L_02070060;
   L_02070060: ; // 0x2070060
@@ -11176,8 +11176,8 @@ void Gambit_fn_02070014(CPUState* cpu) {
         /* 0207008C */ Gambit_fn_02068798(cpu);
   L_02070090: ; // 0x2070090
         /* 02070090 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02070090 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02070094 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070090 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02070094 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070094 */ _t15 = _t14 & 0x00000001u;
         /* 02070094 */ if (_t15) goto L_020700A0; else goto L_02070098;
   L_02070098: ; // 0x2070098
@@ -11208,11 +11208,11 @@ void Gambit_fn_02070018(CPUState* cpu) {
         /* 02070020 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02070020 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02070024 */ cpu->r[30] = cpu->r[3];
-        /* 02070024 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02070024 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02070028 */ cpu->r[31] = cpu->r[4];
         /* 0207002C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0207002C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02070030 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070030 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070030 */ _t5 = _t4 & 0x00000001u;
         /* 02070030 */ if (_t5) goto L_020700A0; else goto L_02070034;
   L_02070034: ; // 0x2070034
@@ -11226,10 +11226,10 @@ void Gambit_fn_02070018(CPUState* cpu) {
         /* 0207004C */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0207004C */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02070050 */ cpu->r[11] = cpu->r[11] + 0xFFFF94F0u;
-        /* 02070054 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02070054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02070058 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02070058 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0207005C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207005C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207005C */ _t10 = _t9 & 0x00000001u;
         /* 0207005C */ if (_t10) goto L_02070090; else goto L_02070060;
   L_02070060: ; // 0x2070060
@@ -11250,8 +11250,8 @@ void Gambit_fn_02070018(CPUState* cpu) {
         /* 0207008C */ Gambit_fn_02068798(cpu);
   L_02070090: ; // 0x2070090
         /* 02070090 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02070090 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02070094 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070090 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02070094 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070094 */ _t15 = _t14 & 0x00000001u;
         /* 02070094 */ if (_t15) goto L_020700A0; else goto L_02070098;
   L_02070098: ; // 0x2070098
@@ -11306,15 +11306,15 @@ void Gambit_fn_020700D0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020700D0: ; // 0x20700d0
-        /* 020700D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020700D4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020700D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020700D4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020700D4 */ _t1 = _t0 & 0x00000001u;
         /* 020700D4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020700D4 */ goto L_020700D8;
   L_020700D8: ; // 0x20700d8
         /* 020700D8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020700D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020700DC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020700D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020700DC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020700DC */ _t3 = _t2 & 0x00000001u;
         /* 020700DC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020700DC */ goto L_020700E0;
@@ -11333,8 +11333,8 @@ void Gambit_fn_020700D0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -11348,15 +11348,15 @@ void Gambit_fn_020700D0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -11402,15 +11402,15 @@ void Gambit_fn_02070100(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02070100: ; // 0x2070100
-        /* 02070100 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070104 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070100 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070104 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070104 */ _t1 = _t0 & 0x00000001u;
         /* 02070104 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02070104 */ goto L_02070108;
   L_02070108: ; // 0x2070108
         /* 02070108 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02070108 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207010C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070108 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207010C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207010C */ _t3 = _t2 & 0x00000001u;
         /* 0207010C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207010C */ goto L_02070110;
@@ -11429,8 +11429,8 @@ void Gambit_fn_02070100(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -11444,15 +11444,15 @@ void Gambit_fn_02070100(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -11481,8 +11481,8 @@ void Gambit_fn_02070108(CPUState* cpu) {
 
   L_02070108: ; // 0x2070108
         /* 02070108 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02070108 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207010C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070108 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207010C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207010C */ _t1 = _t0 & 0x00000001u;
         /* 0207010C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207010C */ goto L_02070110;
@@ -11501,8 +11501,8 @@ void Gambit_fn_02070108(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 02801B48 */ _t5 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t5);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t7 = _t6 & 0x00000001u;
         /* 02801B50 */ if (_t7) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -11516,15 +11516,15 @@ void Gambit_fn_02070108(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t11 = _t10 & 0x00000001u;
         /* 02801B74 */ if (_t11) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t13 = _t12 & 0x00000001u;
         /* 02801B84 */ if (_t13) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -11552,15 +11552,15 @@ void Gambit_fn_02070114(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02070114: ; // 0x2070114
-        /* 02070114 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070118 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070114 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070118 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070118 */ _t1 = _t0 & 0x00000001u;
         /* 02070118 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02070118 */ goto L_0207011C;
   L_0207011C: ; // 0x207011c
         /* 0207011C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0207011C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02070120 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207011C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02070120 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070120 */ _t3 = _t2 & 0x00000001u;
         /* 02070120 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02070120 */ goto L_02070124;
@@ -11579,8 +11579,8 @@ void Gambit_fn_02070114(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -11594,15 +11594,15 @@ void Gambit_fn_02070114(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -11708,9 +11708,9 @@ void Gambit_fn_02070168(CPUState* cpu) {
         /* 0207016C */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 0207016C */ cpu->r[9] = _t0;
         /* 02070170 */ cpu->r[12] = 0x101D0000u;
-        /* 02070174 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02070174 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02070178 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 0207017C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207017C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207017C */ _t2 = _t1 & 0x00000001u;
         /* 0207017C */ if (_t2) goto L_02070180; else goto L_02070194;
   L_02070180: ; // 0x2070180
@@ -11722,8 +11722,8 @@ void Gambit_fn_02070168(CPUState* cpu) {
         /* 02070190 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 02070190 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_02070194: ; // 0x2070194
-        /* 02070194 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02070198 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070194 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02070198 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070198 */ _t6 = _t5 & 0x00000001u;
         /* 02070198 */ if (_t6) goto L_0207019C; else goto L_020701A4;
   L_0207019C: ; // 0x207019c
@@ -11735,9 +11735,9 @@ void Gambit_fn_02070168(CPUState* cpu) {
         /* 020701A8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 020701A8 */ cpu->r[7] = _t7;
         /* 020701AC */ cpu->r[11] = 0x101D0000u;
-        /* 020701B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020701B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020701B4 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 020701B8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020701B8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020701B8 */ _t9 = _t8 & 0x00000001u;
         /* 020701B8 */ if (_t9) goto L_020701BC; else goto L_020701D0;
   L_020701BC: ; // 0x20701bc
@@ -11797,18 +11797,18 @@ void Gambit_fn_02070204(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6;
 
   L_02070204: ; // 0x2070204
-        /* 02070204 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02070204 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02070208 */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 02070208 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 02070208 */ cpu->r[1] = _t0;
-        /* 0207020C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207020C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207020C */ _t2 = _t1 & 0x00000001u;
         /* 0207020C */ if (_t2) goto L_02070210; else goto L_02070220;
   L_02070210: ; // 0x2070210
         /* 02070210 */ cpu->r[3] = 0x00000004u;
         /* 02070214 */ Gambit_fn_02801A78(cpu);
-        /* 02070218 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207021C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070218 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207021C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207021C */ _t4 = _t3 & 0x00000001u;
         /* 0207021C */ if (_t4) goto L_02070228; else goto L_02070220;
   L_02070220: ; // 0x2070220
@@ -11831,14 +11831,14 @@ void Gambit_fn_02070208(CPUState* cpu) {
         /* 02070208 */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 02070208 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 02070208 */ cpu->r[1] = _t0;
-        /* 0207020C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207020C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207020C */ _t2 = _t1 & 0x00000001u;
         /* 0207020C */ if (_t2) goto L_02070210; else goto L_02070220;
   L_02070210: ; // 0x2070210
         /* 02070210 */ cpu->r[3] = 0x00000004u;
         /* 02070214 */ Gambit_fn_02801A78(cpu);
-        /* 02070218 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207021C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070218 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207021C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207021C */ _t4 = _t3 & 0x00000001u;
         /* 0207021C */ if (_t4) goto L_02070228; else goto L_02070220;
   L_02070220: ; // 0x2070220
@@ -11906,18 +11906,18 @@ void Gambit_fn_02070250(CPUState* cpu) {
         /* 02008980 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02008980 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02008984 */ cpu->r[12] = 0x00000000u;
-        /* 02008988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02008988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0200898C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0200898C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02008990 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02008990 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02008990 */ _t6 = _t5 & 0x00000001u;
         /* 02008990 */ if (_t6) goto L_020089B8; else goto L_02008994;
   L_02008994: ; // 0x2008994
         /* 02008994 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02008994 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02008998 */ /* nop */
-        /* 0200899C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 020089A0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0200899C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 020089A0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020089A0 */ _t9 = _t8 & 0x00000001u;
         /* 020089A0 */ if (_t9) goto L_020089A4; else goto L_020089B8;
   L_020089A4: ; // 0x20089a4
@@ -11968,11 +11968,11 @@ void Gambit_fn_0207025C(CPUState* cpu) {
         /* 020703E8 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020703E8 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020703EC */ cpu->r[30] = cpu->r[3];
-        /* 020703EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020703EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020703F0 */ cpu->r[31] = cpu->r[4];
         /* 020703F4 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020703F4 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020703F8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020703F8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020703F8 */ _t5 = _t4 & 0x00000001u;
         /* 020703F8 */ if (_t5) goto L_02070468; else goto L_020703FC;
   L_020703FC: ; // 0x20703fc
@@ -11986,10 +11986,10 @@ void Gambit_fn_0207025C(CPUState* cpu) {
         /* 02070414 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02070414 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02070418 */ cpu->r[11] = cpu->r[11] + 0xFFFF97DCu;
-        /* 0207041C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207041C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02070420 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02070420 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02070424 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070424 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070424 */ _t10 = _t9 & 0x00000001u;
         /* 02070424 */ if (_t10) goto L_02070458; else goto L_02070428;
   L_02070428: ; // 0x2070428
@@ -12010,8 +12010,8 @@ void Gambit_fn_0207025C(CPUState* cpu) {
         /* 02070454 */ Gambit_fn_02068798(cpu);
   L_02070458: ; // 0x2070458
         /* 02070458 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02070458 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0207045C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070458 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0207045C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207045C */ _t15 = _t14 & 0x00000001u;
         /* 0207045C */ if (_t15) goto L_02070468; else goto L_02070460;
   L_02070460: ; // 0x2070460
@@ -12039,8 +12039,8 @@ void Gambit_fn_02070264(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -12091,18 +12091,18 @@ void Gambit_fn_0207027C(CPUState* cpu) {
         /* 02070284 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 02070284 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02070288 */ cpu->r[31] = cpu->r[3];
-        /* 02070288 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02070288 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0207028C */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0207028C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 02070290 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070290 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070290 */ _t4 = _t3 & 0x00000001u;
         /* 02070290 */ if (_t4) goto L_02070294; else goto L_020702A4;
   L_02070294: ; // 0x2070294
         /* 02070294 */ cpu->r[3] = 0x0000021Cu;
         /* 02070298 */ Gambit_fn_02801A78(cpu);
         /* 0207029C */ cpu->r[31] = cpu->r[3];
-        /* 0207029C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020702A0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207029C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020702A0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020702A0 */ _t6 = _t5 & 0x00000001u;
         /* 020702A0 */ if (_t6) goto L_020702EC; else goto L_020702A4;
   L_020702A4: ; // 0x20702a4
@@ -12150,18 +12150,18 @@ void Gambit_fn_02070280(CPUState* cpu) {
         /* 02070284 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 02070284 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02070288 */ cpu->r[31] = cpu->r[3];
-        /* 02070288 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02070288 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0207028C */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0207028C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 02070290 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070290 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070290 */ _t4 = _t3 & 0x00000001u;
         /* 02070290 */ if (_t4) goto L_02070294; else goto L_020702A4;
   L_02070294: ; // 0x2070294
         /* 02070294 */ cpu->r[3] = 0x0000021Cu;
         /* 02070298 */ Gambit_fn_02801A78(cpu);
         /* 0207029C */ cpu->r[31] = cpu->r[3];
-        /* 0207029C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020702A0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207029C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020702A0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020702A0 */ _t6 = _t5 & 0x00000001u;
         /* 020702A0 */ if (_t6) goto L_020702EC; else goto L_020702A4;
   L_020702A4: ; // 0x20702a4
@@ -12359,15 +12359,15 @@ void Gambit_fn_020703C8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020703C8: ; // 0x20703c8
-        /* 020703C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020703CC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020703C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020703CC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020703CC */ _t1 = _t0 & 0x00000001u;
         /* 020703CC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020703CC */ goto L_020703D0;
   L_020703D0: ; // 0x20703d0
         /* 020703D0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020703D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020703D4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020703D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020703D4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020703D4 */ _t3 = _t2 & 0x00000001u;
         /* 020703D4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020703D4 */ goto L_020703D8;
@@ -12386,8 +12386,8 @@ void Gambit_fn_020703C8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -12401,15 +12401,15 @@ void Gambit_fn_020703C8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -12446,11 +12446,11 @@ void Gambit_fn_020703DC(CPUState* cpu) {
         /* 020703E8 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020703E8 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020703EC */ cpu->r[30] = cpu->r[3];
-        /* 020703EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020703EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020703F0 */ cpu->r[31] = cpu->r[4];
         /* 020703F4 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020703F4 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020703F8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020703F8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020703F8 */ _t5 = _t4 & 0x00000001u;
         /* 020703F8 */ if (_t5) goto L_02070468; else goto L_020703FC;
   L_020703FC: ; // 0x20703fc
@@ -12464,10 +12464,10 @@ void Gambit_fn_020703DC(CPUState* cpu) {
         /* 02070414 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02070414 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02070418 */ cpu->r[11] = cpu->r[11] + 0xFFFF97DCu;
-        /* 0207041C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207041C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02070420 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02070420 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02070424 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070424 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070424 */ _t10 = _t9 & 0x00000001u;
         /* 02070424 */ if (_t10) goto L_02070458; else goto L_02070428;
   L_02070428: ; // 0x2070428
@@ -12488,8 +12488,8 @@ void Gambit_fn_020703DC(CPUState* cpu) {
         /* 02070454 */ Gambit_fn_02068798(cpu);
   L_02070458: ; // 0x2070458
         /* 02070458 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02070458 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0207045C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070458 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0207045C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207045C */ _t15 = _t14 & 0x00000001u;
         /* 0207045C */ if (_t15) goto L_02070468; else goto L_02070460;
   L_02070460: ; // 0x2070460
@@ -12520,11 +12520,11 @@ void Gambit_fn_020703E0(CPUState* cpu) {
         /* 020703E8 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020703E8 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020703EC */ cpu->r[30] = cpu->r[3];
-        /* 020703EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020703EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020703F0 */ cpu->r[31] = cpu->r[4];
         /* 020703F4 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020703F4 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020703F8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020703F8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020703F8 */ _t5 = _t4 & 0x00000001u;
         /* 020703F8 */ if (_t5) goto L_02070468; else goto L_020703FC;
   L_020703FC: ; // 0x20703fc
@@ -12538,10 +12538,10 @@ void Gambit_fn_020703E0(CPUState* cpu) {
         /* 02070414 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02070414 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02070418 */ cpu->r[11] = cpu->r[11] + 0xFFFF97DCu;
-        /* 0207041C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207041C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02070420 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02070420 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02070424 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070424 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070424 */ _t10 = _t9 & 0x00000001u;
         /* 02070424 */ if (_t10) goto L_02070458; else goto L_02070428;
   L_02070428: ; // 0x2070428
@@ -12562,8 +12562,8 @@ void Gambit_fn_020703E0(CPUState* cpu) {
         /* 02070454 */ Gambit_fn_02068798(cpu);
   L_02070458: ; // 0x2070458
         /* 02070458 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02070458 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0207045C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070458 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0207045C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207045C */ _t15 = _t14 & 0x00000001u;
         /* 0207045C */ if (_t15) goto L_02070468; else goto L_02070460;
   L_02070460: ; // 0x2070460
@@ -12595,10 +12595,10 @@ void Gambit_fn_02070400(CPUState* cpu) {
         /* 02070414 */ _t1 = cpu->r[30] + 0x000001C8u;
         /* 02070414 */ rbrew_write32(cpu->mem, _t1, cpu->r[12]);
         /* 02070418 */ cpu->r[11] = cpu->r[11] + 0xFFFF97DCu;
-        /* 0207041C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207041C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02070420 */ _t2 = cpu->r[30] + 0x0000001Cu;
         /* 02070420 */ rbrew_write32(cpu->mem, _t2, cpu->r[11]);
-        /* 02070424 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070424 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070424 */ _t4 = _t3 & 0x00000001u;
         /* 02070424 */ if (_t4) goto L_02070458; else goto L_02070428;
   L_02070428: ; // 0x2070428
@@ -12619,8 +12619,8 @@ void Gambit_fn_02070400(CPUState* cpu) {
         /* 02070454 */ Gambit_fn_02068798(cpu);
   L_02070458: ; // 0x2070458
         /* 02070458 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02070458 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0207045C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070458 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0207045C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207045C */ _t9 = _t8 & 0x00000001u;
         /* 0207045C */ if (_t9) goto L_02070468; else goto L_02070460;
   L_02070460: ; // 0x2070460
@@ -12650,10 +12650,10 @@ void Gambit_fn_02070408(CPUState* cpu) {
         /* 02070414 */ _t1 = cpu->r[30] + 0x000001C8u;
         /* 02070414 */ rbrew_write32(cpu->mem, _t1, cpu->r[12]);
         /* 02070418 */ cpu->r[11] = cpu->r[11] + 0xFFFF97DCu;
-        /* 0207041C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207041C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02070420 */ _t2 = cpu->r[30] + 0x0000001Cu;
         /* 02070420 */ rbrew_write32(cpu->mem, _t2, cpu->r[11]);
-        /* 02070424 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070424 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070424 */ _t4 = _t3 & 0x00000001u;
         /* 02070424 */ if (_t4) goto L_02070458; else goto L_02070428;
   L_02070428: ; // 0x2070428
@@ -12674,8 +12674,8 @@ void Gambit_fn_02070408(CPUState* cpu) {
         /* 02070454 */ Gambit_fn_02068798(cpu);
   L_02070458: ; // 0x2070458
         /* 02070458 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02070458 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0207045C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070458 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0207045C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207045C */ _t9 = _t8 & 0x00000001u;
         /* 0207045C */ if (_t9) goto L_02070468; else goto L_02070460;
   L_02070460: ; // 0x2070460
@@ -12808,9 +12808,9 @@ void Gambit_fn_020704D8(CPUState* cpu) {
         /* 020704DC */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 020704DC */ cpu->r[9] = _t0;
         /* 020704E0 */ cpu->r[12] = 0x101D0000u;
-        /* 020704E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 020704E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 020704E8 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 020704EC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020704EC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020704EC */ _t2 = _t1 & 0x00000001u;
         /* 020704EC */ if (_t2) goto L_020704F0; else goto L_02070504;
   L_020704F0: ; // 0x20704f0
@@ -12822,8 +12822,8 @@ void Gambit_fn_020704D8(CPUState* cpu) {
         /* 02070500 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 02070500 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_02070504: ; // 0x2070504
-        /* 02070504 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02070508 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070504 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02070508 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070508 */ _t6 = _t5 & 0x00000001u;
         /* 02070508 */ if (_t6) goto L_0207050C; else goto L_02070514;
   L_0207050C: ; // 0x207050c
@@ -12835,9 +12835,9 @@ void Gambit_fn_020704D8(CPUState* cpu) {
         /* 02070518 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 02070518 */ cpu->r[7] = _t7;
         /* 0207051C */ cpu->r[11] = 0x101D0000u;
-        /* 02070520 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02070520 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02070524 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 02070528 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070528 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070528 */ _t9 = _t8 & 0x00000001u;
         /* 02070528 */ if (_t9) goto L_0207052C; else goto L_02070540;
   L_0207052C: ; // 0x207052c
@@ -12860,8 +12860,8 @@ void Gambit_fn_02070504(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6;
 
   L_02070504: ; // 0x2070504
-        /* 02070504 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02070508 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070504 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02070508 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070508 */ _t1 = _t0 & 0x00000001u;
         /* 02070508 */ if (_t1) goto L_0207050C; else goto L_02070514;
   L_0207050C: ; // 0x207050c
@@ -12873,9 +12873,9 @@ void Gambit_fn_02070504(CPUState* cpu) {
         /* 02070518 */ cpu->r[8] = rbrew_read32(cpu->mem, _t2);
         /* 02070518 */ cpu->r[7] = _t2;
         /* 0207051C */ cpu->r[11] = 0x101D0000u;
-        /* 02070520 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02070520 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02070524 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 02070528 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070528 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070528 */ _t4 = _t3 & 0x00000001u;
         /* 02070528 */ if (_t4) goto L_0207052C; else goto L_02070540;
   L_0207052C: ; // 0x207052c
@@ -12898,7 +12898,7 @@ void Gambit_fn_02070508(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6;
 
   L_02070508: ; // 0x2070508
-        /* 02070508 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070508 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070508 */ _t1 = _t0 & 0x00000001u;
         /* 02070508 */ if (_t1) goto L_0207050C; else goto L_02070514;
   L_0207050C: ; // 0x207050c
@@ -12910,9 +12910,9 @@ void Gambit_fn_02070508(CPUState* cpu) {
         /* 02070518 */ cpu->r[8] = rbrew_read32(cpu->mem, _t2);
         /* 02070518 */ cpu->r[7] = _t2;
         /* 0207051C */ cpu->r[11] = 0x101D0000u;
-        /* 02070520 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02070520 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02070524 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 02070528 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070528 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070528 */ _t4 = _t3 & 0x00000001u;
         /* 02070528 */ if (_t4) goto L_0207052C; else goto L_02070540;
   L_0207052C: ; // 0x207052c
@@ -13039,18 +13039,18 @@ void Gambit_fn_02070594(CPUState* cpu) {
         /* 02008980 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02008980 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02008984 */ cpu->r[12] = 0x00000000u;
-        /* 02008988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02008988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0200898C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0200898C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02008990 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02008990 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02008990 */ _t6 = _t5 & 0x00000001u;
         /* 02008990 */ if (_t6) goto L_020089B8; else goto L_02008994;
   L_02008994: ; // 0x2008994
         /* 02008994 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02008994 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02008998 */ /* nop */
-        /* 0200899C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 020089A0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0200899C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 020089A0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020089A0 */ _t9 = _t8 & 0x00000001u;
         /* 020089A0 */ if (_t9) goto L_020089A4; else goto L_020089B8;
   L_020089A4: ; // 0x20089a4
@@ -13112,8 +13112,8 @@ void Gambit_fn_0207059C(CPUState* cpu) {
         /* 020705E4 */ _t7 = cpu->r[1] + 0x00000084u;
         /* 020705E4 */ rbrew_write32(cpu->mem, _t7, cpu->r[0]);
         /* 020705E8 */ Gambit_fn_02801A78(cpu);
-        /* 020705EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020705F0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020705EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020705F0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020705F0 */ _t9 = _t8 & 0x00000001u;
         /* 020705F0 */ if (_t9) goto L_020705F8; else goto L_020705F4;
   L_020705F4: ; // 0x20705f4
@@ -13170,8 +13170,8 @@ void Gambit_fn_020705A0(CPUState* cpu) {
         /* 020705E4 */ _t7 = cpu->r[1] + 0x00000084u;
         /* 020705E4 */ rbrew_write32(cpu->mem, _t7, cpu->r[0]);
         /* 020705E8 */ Gambit_fn_02801A78(cpu);
-        /* 020705EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020705F0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020705EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020705F0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020705F0 */ _t9 = _t8 & 0x00000001u;
         /* 020705F0 */ if (_t9) goto L_020705F8; else goto L_020705F4;
   L_020705F4: ; // 0x20705f4
@@ -13248,8 +13248,8 @@ void Gambit_fn_02070624(CPUState* cpu) {
         /* 020705E4 */ _t7 = cpu->r[1] + 0x00000084u;
         /* 020705E4 */ rbrew_write32(cpu->mem, _t7, cpu->r[0]);
         /* 020705E8 */ Gambit_fn_02801A78(cpu);
-        /* 020705EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020705F0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020705EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020705F0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020705F0 */ _t9 = _t8 & 0x00000001u;
         /* 020705F0 */ if (_t9) goto L_020705F8; else goto L_020705F4;
   L_020705F4: ; // 0x20705f4
@@ -13394,18 +13394,18 @@ void Gambit_fn_0207067C(CPUState* cpu) {
         /* 02009100 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02009100 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02009104 */ cpu->r[12] = 0x00000000u;
-        /* 02009108 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02009108 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0200910C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0200910C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02009110 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02009110 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02009110 */ _t6 = _t5 & 0x00000001u;
         /* 02009110 */ if (_t6) goto L_02009138; else goto L_02009114;
   L_02009114: ; // 0x2009114
         /* 02009114 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02009114 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02009118 */ /* nop */
-        /* 0200911C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 02009120 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0200911C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 02009120 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02009120 */ _t9 = _t8 & 0x00000001u;
         /* 02009120 */ if (_t9) goto L_02009124; else goto L_02009138;
   L_02009124: ; // 0x2009124
@@ -13516,17 +13516,17 @@ void Gambit_fn_020706B4(CPUState* cpu) {
         /* 020706C0 */ _t1 = cpu->r[1] + 0x00000054u;
         /* 020706C0 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020706C4 */ cpu->r[29] = cpu->r[3];
-        /* 020706C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020706C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020706C8 */ cpu->r[30] = cpu->r[4];
-        /* 020706CC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020706CC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020706CC */ _t3 = _t2 & 0x00000001u;
         /* 020706CC */ if (_t3) goto L_020706D0; else goto L_020706E0;
   L_020706D0: ; // 0x20706d0
         /* 020706D0 */ cpu->r[3] = 0x00000074u;
         /* 020706D4 */ Gambit_fn_02801A78(cpu);
         /* 020706D8 */ cpu->r[29] = cpu->r[3];
-        /* 020706D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020706DC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020706D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020706DC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020706DC */ _t5 = _t4 & 0x00000001u;
         /* 020706DC */ if (_t5) goto L_020709BC; else goto L_020706E0;
   L_020706E0: ; // 0x20706e0
@@ -13544,21 +13544,21 @@ void Gambit_fn_020706B4(CPUState* cpu) {
         /* 02070708 */ rbrew_write32(cpu->mem, _t6, cpu->r[5]);
         /* 0207070C */ cpu->r[9] = cpu->r[9] + 0xFFFF998Cu;
         /* 02070710 */ cpu->r[31] = cpu->r[29] + 0x00000028u;
-        /* 02070710 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02070710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02070714 */ _t7 = cpu->r[29] + 0x0000000Cu;
         /* 02070714 */ rbrew_write32(cpu->mem, _t7, cpu->r[7]);
         /* 02070718 */ cpu->r[28] = 0x00000000u;
         /* 0207071C */ _t8 = cpu->r[29] + 0x00000010u;
         /* 0207071C */ rbrew_write32(cpu->mem, _t8, cpu->r[9]);
-        /* 02070720 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070720 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070720 */ _t10 = _t9 & 0x00000001u;
         /* 02070720 */ if (_t10) goto L_02070724; else goto L_02070734;
   L_02070724: ; // 0x2070724
         /* 02070724 */ cpu->r[3] = 0x00000038u;
         /* 02070728 */ Gambit_fn_02801A78(cpu);
         /* 0207072C */ cpu->r[31] = cpu->r[3];
-        /* 0207072C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02070730 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207072C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02070730 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070730 */ _t12 = _t11 & 0x00000001u;
         /* 02070730 */ if (_t12) goto L_02070764; else goto L_02070734;
   L_02070734: ; // 0x2070734
@@ -13584,15 +13584,15 @@ void Gambit_fn_020706B4(CPUState* cpu) {
         /* 02070760 */ rbrew_write32(cpu->mem, _t20, cpu->r[28]);
   L_02070764: ; // 0x2070764
         /* 02070764 */ cpu->r[3] = cpu->r[29] + 0x00000060u;
-        /* 02070764 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070768 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070764 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070768 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070768 */ _t22 = _t21 & 0x00000001u;
         /* 02070768 */ if (_t22) goto L_0207076C; else goto L_0207077C;
   L_0207076C: ; // 0x207076c
         /* 0207076C */ cpu->r[3] = 0x0000000Cu;
         /* 02070770 */ Gambit_fn_02801A78(cpu);
-        /* 02070774 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070778 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070774 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070778 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070778 */ _t24 = _t23 & 0x00000001u;
         /* 02070778 */ if (_t24) goto L_02070798; else goto L_0207077C;
   L_0207077C: ; // 0x207077c
@@ -13646,23 +13646,23 @@ void Gambit_fn_020706B4(CPUState* cpu) {
         /* 020707FC */ _t39 = cpu->r[11] + 0x00000000u;
         /* 020707FC */ cpu->r[0] = rbrew_read8(cpu->mem, _t39);
         /* 02070800 */ cpu->r[30] = 0x00000000u;
-        /* 02070804 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 02070804 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 02070808 */ cpu->r[0] = 0x00080000u;
-        /* 0207080C */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207080C */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207080C */ _t41 = _t40 & 0x00000001u;
         /* 0207080C */ if (_t41) goto L_02070834; else goto L_02070810;
   L_02070810: ; // 0x2070810
         /* 02070810 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02070814 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 02070814 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 02070818 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 0207081C */ _t42 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207081C */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207081C */ _t43 = _t42 & 0x00000001u;
         /* 0207081C */ if (_t43) goto L_02070830; else goto L_02070820;
   L_02070820: ; // 0x2070820
         /* 02070820 */ _t44 = cpu->r[11] + 0x00000000u;
         /* 02070820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t44);
-        /* 02070824 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[31]);
-        /* 02070828 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[31]));
+        /* 02070828 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070828 */ _t46 = _t45 & 0x00000001u;
         /* 02070828 */ if (_t46) goto L_0207082C; else goto L_02070810;
   L_0207082C: ; // 0x207082c
@@ -13674,10 +13674,10 @@ void Gambit_fn_020706B4(CPUState* cpu) {
         /* 02070834 */ cpu->r[7] = rbrew_read32(cpu->mem, _t47);
         /* 02070838 */ _t48 = cpu->r[1] + 0x00000010u;
         /* 02070838 */ cpu->r[5] = rbrew_read32(cpu->mem, _t48);
-        /* 0207083C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 0207083C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 02070840 */ _t49 = cpu->r[5] + 0x00000014u;
         /* 02070840 */ cpu->r[0] = rbrew_read32(cpu->mem, _t49);
-        /* 02070844 */ _t50 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02070844 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02070844 */ _t51 = _t50 & 0x00000001u;
         /* 02070844 */ if (_t51) goto L_0207084C; else goto L_02070848;
   L_02070848: ; // 0x2070848
@@ -13732,10 +13732,10 @@ void Gambit_fn_020706B4(CPUState* cpu) {
         /* 020708CC */ rbrew_write32(cpu->mem, _t65, cpu->r[10]);
         /* 020708D0 */ _t66 = cpu->r[29] + 0x0000003Cu;
         /* 020708D0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t66);
-        /* 020708D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000001u);
+        /* 020708D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000001u));
         /* 020708D8 */ _t67 = cpu->r[29] + 0x00000040u;
         /* 020708D8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t67);
-        /* 020708DC */ _t68 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020708DC */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020708DC */ _t69 = _t68 & 0x00000001u;
         /* 020708DC */ if (_t69) goto L_020708E0; else goto L_020708E4;
   L_020708E0: ; // 0x20708e0
@@ -13751,23 +13751,23 @@ void Gambit_fn_020706B4(CPUState* cpu) {
         /* 020708F8 */ _t72 = cpu->r[7] + 0x00000000u;
         /* 020708F8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t72);
         /* 020708FC */ cpu->r[27] = 0x00000000u;
-        /* 02070900 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 02070900 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 02070904 */ cpu->r[9] = 0x00080000u;
-        /* 02070908 */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070908 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070908 */ _t74 = _t73 & 0x00000001u;
         /* 02070908 */ if (_t74) goto L_02070930; else goto L_0207090C;
   L_0207090C: ; // 0x207090c
         /* 0207090C */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 02070910 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[9]);
+        /* 02070910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[9]));
         /* 02070914 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02070918 */ _t75 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02070918 */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02070918 */ _t76 = _t75 & 0x00000001u;
         /* 02070918 */ if (_t76) goto L_0207092C; else goto L_0207091C;
   L_0207091C: ; // 0x207091c
         /* 0207091C */ _t77 = cpu->r[7] + 0x00000000u;
         /* 0207091C */ cpu->r[0] = rbrew_read8(cpu->mem, _t77);
-        /* 02070920 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 02070924 */ _t78 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070920 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 02070924 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070924 */ _t79 = _t78 & 0x00000001u;
         /* 02070924 */ if (_t79) goto L_02070928; else goto L_0207090C;
   L_02070928: ; // 0x2070928
@@ -13777,8 +13777,8 @@ void Gambit_fn_020706B4(CPUState* cpu) {
   L_02070930: ; // 0x2070930
         /* 02070930 */ _t80 = cpu->r[30] + 0x00000008u;
         /* 02070930 */ cpu->r[8] = rbrew_read32(cpu->mem, _t80);
-        /* 02070934 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[8]);
-        /* 02070938 */ _t81 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02070934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[8]));
+        /* 02070938 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02070938 */ _t82 = _t81 & 0x00000001u;
         /* 02070938 */ if (_t82) goto L_02070940; else goto L_0207093C;
   L_0207093C: ; // 0x207093c
@@ -13850,21 +13850,21 @@ void Gambit_fn_02070700(CPUState* cpu) {
         /* 02070708 */ rbrew_write32(cpu->mem, _t0, cpu->r[5]);
         /* 0207070C */ cpu->r[9] = cpu->r[9] + 0xFFFF998Cu;
         /* 02070710 */ cpu->r[31] = cpu->r[29] + 0x00000028u;
-        /* 02070710 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02070710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02070714 */ _t1 = cpu->r[29] + 0x0000000Cu;
         /* 02070714 */ rbrew_write32(cpu->mem, _t1, cpu->r[7]);
         /* 02070718 */ cpu->r[28] = 0x00000000u;
         /* 0207071C */ _t2 = cpu->r[29] + 0x00000010u;
         /* 0207071C */ rbrew_write32(cpu->mem, _t2, cpu->r[9]);
-        /* 02070720 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070720 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070720 */ _t4 = _t3 & 0x00000001u;
         /* 02070720 */ if (_t4) goto L_02070724; else goto L_02070734;
   L_02070724: ; // 0x2070724
         /* 02070724 */ cpu->r[3] = 0x00000038u;
         /* 02070728 */ Gambit_fn_02801A78(cpu);
         /* 0207072C */ cpu->r[31] = cpu->r[3];
-        /* 0207072C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02070730 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207072C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02070730 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070730 */ _t6 = _t5 & 0x00000001u;
         /* 02070730 */ if (_t6) goto L_02070764; else goto L_02070734;
   L_02070734: ; // 0x2070734
@@ -13890,15 +13890,15 @@ void Gambit_fn_02070700(CPUState* cpu) {
         /* 02070760 */ rbrew_write32(cpu->mem, _t14, cpu->r[28]);
   L_02070764: ; // 0x2070764
         /* 02070764 */ cpu->r[3] = cpu->r[29] + 0x00000060u;
-        /* 02070764 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070768 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070764 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070768 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070768 */ _t16 = _t15 & 0x00000001u;
         /* 02070768 */ if (_t16) goto L_0207076C; else goto L_0207077C;
   L_0207076C: ; // 0x207076c
         /* 0207076C */ cpu->r[3] = 0x0000000Cu;
         /* 02070770 */ Gambit_fn_02801A78(cpu);
-        /* 02070774 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070778 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070774 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070778 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070778 */ _t18 = _t17 & 0x00000001u;
         /* 02070778 */ if (_t18) goto L_02070798; else goto L_0207077C;
   L_0207077C: ; // 0x207077c
@@ -13952,23 +13952,23 @@ void Gambit_fn_02070700(CPUState* cpu) {
         /* 020707FC */ _t33 = cpu->r[11] + 0x00000000u;
         /* 020707FC */ cpu->r[0] = rbrew_read8(cpu->mem, _t33);
         /* 02070800 */ cpu->r[30] = 0x00000000u;
-        /* 02070804 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 02070804 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 02070808 */ cpu->r[0] = 0x00080000u;
-        /* 0207080C */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207080C */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207080C */ _t35 = _t34 & 0x00000001u;
         /* 0207080C */ if (_t35) goto L_02070834; else goto L_02070810;
   L_02070810: ; // 0x2070810
         /* 02070810 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02070814 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 02070814 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 02070818 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 0207081C */ _t36 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207081C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207081C */ _t37 = _t36 & 0x00000001u;
         /* 0207081C */ if (_t37) goto L_02070830; else goto L_02070820;
   L_02070820: ; // 0x2070820
         /* 02070820 */ _t38 = cpu->r[11] + 0x00000000u;
         /* 02070820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t38);
-        /* 02070824 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[31]);
-        /* 02070828 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[31]));
+        /* 02070828 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070828 */ _t40 = _t39 & 0x00000001u;
         /* 02070828 */ if (_t40) goto L_0207082C; else goto L_02070810;
   L_0207082C: ; // 0x207082c
@@ -13980,10 +13980,10 @@ void Gambit_fn_02070700(CPUState* cpu) {
         /* 02070834 */ cpu->r[7] = rbrew_read32(cpu->mem, _t41);
         /* 02070838 */ _t42 = cpu->r[1] + 0x00000010u;
         /* 02070838 */ cpu->r[5] = rbrew_read32(cpu->mem, _t42);
-        /* 0207083C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 0207083C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 02070840 */ _t43 = cpu->r[5] + 0x00000014u;
         /* 02070840 */ cpu->r[0] = rbrew_read32(cpu->mem, _t43);
-        /* 02070844 */ _t44 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02070844 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02070844 */ _t45 = _t44 & 0x00000001u;
         /* 02070844 */ if (_t45) goto L_0207084C; else goto L_02070848;
   L_02070848: ; // 0x2070848
@@ -14038,10 +14038,10 @@ void Gambit_fn_02070700(CPUState* cpu) {
         /* 020708CC */ rbrew_write32(cpu->mem, _t59, cpu->r[10]);
         /* 020708D0 */ _t60 = cpu->r[29] + 0x0000003Cu;
         /* 020708D0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t60);
-        /* 020708D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000001u);
+        /* 020708D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000001u));
         /* 020708D8 */ _t61 = cpu->r[29] + 0x00000040u;
         /* 020708D8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t61);
-        /* 020708DC */ _t62 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020708DC */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020708DC */ _t63 = _t62 & 0x00000001u;
         /* 020708DC */ if (_t63) goto L_020708E0; else goto L_020708E4;
   L_020708E0: ; // 0x20708e0
@@ -14057,23 +14057,23 @@ void Gambit_fn_02070700(CPUState* cpu) {
         /* 020708F8 */ _t66 = cpu->r[7] + 0x00000000u;
         /* 020708F8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t66);
         /* 020708FC */ cpu->r[27] = 0x00000000u;
-        /* 02070900 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 02070900 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 02070904 */ cpu->r[9] = 0x00080000u;
-        /* 02070908 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070908 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070908 */ _t68 = _t67 & 0x00000001u;
         /* 02070908 */ if (_t68) goto L_02070930; else goto L_0207090C;
   L_0207090C: ; // 0x207090c
         /* 0207090C */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 02070910 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[9]);
+        /* 02070910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[9]));
         /* 02070914 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02070918 */ _t69 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02070918 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02070918 */ _t70 = _t69 & 0x00000001u;
         /* 02070918 */ if (_t70) goto L_0207092C; else goto L_0207091C;
   L_0207091C: ; // 0x207091c
         /* 0207091C */ _t71 = cpu->r[7] + 0x00000000u;
         /* 0207091C */ cpu->r[0] = rbrew_read8(cpu->mem, _t71);
-        /* 02070920 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 02070924 */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070920 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 02070924 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070924 */ _t73 = _t72 & 0x00000001u;
         /* 02070924 */ if (_t73) goto L_02070928; else goto L_0207090C;
   L_02070928: ; // 0x2070928
@@ -14083,8 +14083,8 @@ void Gambit_fn_02070700(CPUState* cpu) {
   L_02070930: ; // 0x2070930
         /* 02070930 */ _t74 = cpu->r[30] + 0x00000008u;
         /* 02070930 */ cpu->r[8] = rbrew_read32(cpu->mem, _t74);
-        /* 02070934 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[8]);
-        /* 02070938 */ _t75 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02070934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[8]));
+        /* 02070938 */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02070938 */ _t76 = _t75 & 0x00000001u;
         /* 02070938 */ if (_t76) goto L_02070940; else goto L_0207093C;
   L_0207093C: ; // 0x207093c
@@ -14154,21 +14154,21 @@ void Gambit_fn_02070704(CPUState* cpu) {
         /* 02070708 */ rbrew_write32(cpu->mem, _t0, cpu->r[5]);
         /* 0207070C */ cpu->r[9] = cpu->r[9] + 0xFFFF998Cu;
         /* 02070710 */ cpu->r[31] = cpu->r[29] + 0x00000028u;
-        /* 02070710 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02070710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02070714 */ _t1 = cpu->r[29] + 0x0000000Cu;
         /* 02070714 */ rbrew_write32(cpu->mem, _t1, cpu->r[7]);
         /* 02070718 */ cpu->r[28] = 0x00000000u;
         /* 0207071C */ _t2 = cpu->r[29] + 0x00000010u;
         /* 0207071C */ rbrew_write32(cpu->mem, _t2, cpu->r[9]);
-        /* 02070720 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070720 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070720 */ _t4 = _t3 & 0x00000001u;
         /* 02070720 */ if (_t4) goto L_02070724; else goto L_02070734;
   L_02070724: ; // 0x2070724
         /* 02070724 */ cpu->r[3] = 0x00000038u;
         /* 02070728 */ Gambit_fn_02801A78(cpu);
         /* 0207072C */ cpu->r[31] = cpu->r[3];
-        /* 0207072C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02070730 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207072C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02070730 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070730 */ _t6 = _t5 & 0x00000001u;
         /* 02070730 */ if (_t6) goto L_02070764; else goto L_02070734;
   L_02070734: ; // 0x2070734
@@ -14194,15 +14194,15 @@ void Gambit_fn_02070704(CPUState* cpu) {
         /* 02070760 */ rbrew_write32(cpu->mem, _t14, cpu->r[28]);
   L_02070764: ; // 0x2070764
         /* 02070764 */ cpu->r[3] = cpu->r[29] + 0x00000060u;
-        /* 02070764 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070768 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070764 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070768 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070768 */ _t16 = _t15 & 0x00000001u;
         /* 02070768 */ if (_t16) goto L_0207076C; else goto L_0207077C;
   L_0207076C: ; // 0x207076c
         /* 0207076C */ cpu->r[3] = 0x0000000Cu;
         /* 02070770 */ Gambit_fn_02801A78(cpu);
-        /* 02070774 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070778 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070774 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070778 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070778 */ _t18 = _t17 & 0x00000001u;
         /* 02070778 */ if (_t18) goto L_02070798; else goto L_0207077C;
   L_0207077C: ; // 0x207077c
@@ -14256,23 +14256,23 @@ void Gambit_fn_02070704(CPUState* cpu) {
         /* 020707FC */ _t33 = cpu->r[11] + 0x00000000u;
         /* 020707FC */ cpu->r[0] = rbrew_read8(cpu->mem, _t33);
         /* 02070800 */ cpu->r[30] = 0x00000000u;
-        /* 02070804 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 02070804 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 02070808 */ cpu->r[0] = 0x00080000u;
-        /* 0207080C */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207080C */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207080C */ _t35 = _t34 & 0x00000001u;
         /* 0207080C */ if (_t35) goto L_02070834; else goto L_02070810;
   L_02070810: ; // 0x2070810
         /* 02070810 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02070814 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 02070814 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 02070818 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 0207081C */ _t36 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207081C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207081C */ _t37 = _t36 & 0x00000001u;
         /* 0207081C */ if (_t37) goto L_02070830; else goto L_02070820;
   L_02070820: ; // 0x2070820
         /* 02070820 */ _t38 = cpu->r[11] + 0x00000000u;
         /* 02070820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t38);
-        /* 02070824 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[31]);
-        /* 02070828 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[31]));
+        /* 02070828 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070828 */ _t40 = _t39 & 0x00000001u;
         /* 02070828 */ if (_t40) goto L_0207082C; else goto L_02070810;
   L_0207082C: ; // 0x207082c
@@ -14284,10 +14284,10 @@ void Gambit_fn_02070704(CPUState* cpu) {
         /* 02070834 */ cpu->r[7] = rbrew_read32(cpu->mem, _t41);
         /* 02070838 */ _t42 = cpu->r[1] + 0x00000010u;
         /* 02070838 */ cpu->r[5] = rbrew_read32(cpu->mem, _t42);
-        /* 0207083C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 0207083C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 02070840 */ _t43 = cpu->r[5] + 0x00000014u;
         /* 02070840 */ cpu->r[0] = rbrew_read32(cpu->mem, _t43);
-        /* 02070844 */ _t44 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02070844 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02070844 */ _t45 = _t44 & 0x00000001u;
         /* 02070844 */ if (_t45) goto L_0207084C; else goto L_02070848;
   L_02070848: ; // 0x2070848
@@ -14342,10 +14342,10 @@ void Gambit_fn_02070704(CPUState* cpu) {
         /* 020708CC */ rbrew_write32(cpu->mem, _t59, cpu->r[10]);
         /* 020708D0 */ _t60 = cpu->r[29] + 0x0000003Cu;
         /* 020708D0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t60);
-        /* 020708D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000001u);
+        /* 020708D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000001u));
         /* 020708D8 */ _t61 = cpu->r[29] + 0x00000040u;
         /* 020708D8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t61);
-        /* 020708DC */ _t62 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020708DC */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020708DC */ _t63 = _t62 & 0x00000001u;
         /* 020708DC */ if (_t63) goto L_020708E0; else goto L_020708E4;
   L_020708E0: ; // 0x20708e0
@@ -14361,23 +14361,23 @@ void Gambit_fn_02070704(CPUState* cpu) {
         /* 020708F8 */ _t66 = cpu->r[7] + 0x00000000u;
         /* 020708F8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t66);
         /* 020708FC */ cpu->r[27] = 0x00000000u;
-        /* 02070900 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 02070900 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 02070904 */ cpu->r[9] = 0x00080000u;
-        /* 02070908 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070908 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070908 */ _t68 = _t67 & 0x00000001u;
         /* 02070908 */ if (_t68) goto L_02070930; else goto L_0207090C;
   L_0207090C: ; // 0x207090c
         /* 0207090C */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 02070910 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[9]);
+        /* 02070910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[9]));
         /* 02070914 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02070918 */ _t69 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02070918 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02070918 */ _t70 = _t69 & 0x00000001u;
         /* 02070918 */ if (_t70) goto L_0207092C; else goto L_0207091C;
   L_0207091C: ; // 0x207091c
         /* 0207091C */ _t71 = cpu->r[7] + 0x00000000u;
         /* 0207091C */ cpu->r[0] = rbrew_read8(cpu->mem, _t71);
-        /* 02070920 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 02070924 */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070920 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 02070924 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070924 */ _t73 = _t72 & 0x00000001u;
         /* 02070924 */ if (_t73) goto L_02070928; else goto L_0207090C;
   L_02070928: ; // 0x2070928
@@ -14387,8 +14387,8 @@ void Gambit_fn_02070704(CPUState* cpu) {
   L_02070930: ; // 0x2070930
         /* 02070930 */ _t74 = cpu->r[30] + 0x00000008u;
         /* 02070930 */ cpu->r[8] = rbrew_read32(cpu->mem, _t74);
-        /* 02070934 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[8]);
-        /* 02070938 */ _t75 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02070934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[8]));
+        /* 02070938 */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02070938 */ _t76 = _t75 & 0x00000001u;
         /* 02070938 */ if (_t76) goto L_02070940; else goto L_0207093C;
   L_0207093C: ; // 0x207093c
@@ -14457,21 +14457,21 @@ void Gambit_fn_02070708(CPUState* cpu) {
         /* 02070708 */ rbrew_write32(cpu->mem, _t0, cpu->r[5]);
         /* 0207070C */ cpu->r[9] = cpu->r[9] + 0xFFFF998Cu;
         /* 02070710 */ cpu->r[31] = cpu->r[29] + 0x00000028u;
-        /* 02070710 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02070710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02070714 */ _t1 = cpu->r[29] + 0x0000000Cu;
         /* 02070714 */ rbrew_write32(cpu->mem, _t1, cpu->r[7]);
         /* 02070718 */ cpu->r[28] = 0x00000000u;
         /* 0207071C */ _t2 = cpu->r[29] + 0x00000010u;
         /* 0207071C */ rbrew_write32(cpu->mem, _t2, cpu->r[9]);
-        /* 02070720 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070720 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070720 */ _t4 = _t3 & 0x00000001u;
         /* 02070720 */ if (_t4) goto L_02070724; else goto L_02070734;
   L_02070724: ; // 0x2070724
         /* 02070724 */ cpu->r[3] = 0x00000038u;
         /* 02070728 */ Gambit_fn_02801A78(cpu);
         /* 0207072C */ cpu->r[31] = cpu->r[3];
-        /* 0207072C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02070730 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207072C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02070730 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070730 */ _t6 = _t5 & 0x00000001u;
         /* 02070730 */ if (_t6) goto L_02070764; else goto L_02070734;
   L_02070734: ; // 0x2070734
@@ -14497,15 +14497,15 @@ void Gambit_fn_02070708(CPUState* cpu) {
         /* 02070760 */ rbrew_write32(cpu->mem, _t14, cpu->r[28]);
   L_02070764: ; // 0x2070764
         /* 02070764 */ cpu->r[3] = cpu->r[29] + 0x00000060u;
-        /* 02070764 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070768 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070764 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070768 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070768 */ _t16 = _t15 & 0x00000001u;
         /* 02070768 */ if (_t16) goto L_0207076C; else goto L_0207077C;
   L_0207076C: ; // 0x207076c
         /* 0207076C */ cpu->r[3] = 0x0000000Cu;
         /* 02070770 */ Gambit_fn_02801A78(cpu);
-        /* 02070774 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070778 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070774 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070778 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070778 */ _t18 = _t17 & 0x00000001u;
         /* 02070778 */ if (_t18) goto L_02070798; else goto L_0207077C;
   L_0207077C: ; // 0x207077c
@@ -14559,23 +14559,23 @@ void Gambit_fn_02070708(CPUState* cpu) {
         /* 020707FC */ _t33 = cpu->r[11] + 0x00000000u;
         /* 020707FC */ cpu->r[0] = rbrew_read8(cpu->mem, _t33);
         /* 02070800 */ cpu->r[30] = 0x00000000u;
-        /* 02070804 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 02070804 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 02070808 */ cpu->r[0] = 0x00080000u;
-        /* 0207080C */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207080C */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207080C */ _t35 = _t34 & 0x00000001u;
         /* 0207080C */ if (_t35) goto L_02070834; else goto L_02070810;
   L_02070810: ; // 0x2070810
         /* 02070810 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02070814 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 02070814 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 02070818 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 0207081C */ _t36 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207081C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207081C */ _t37 = _t36 & 0x00000001u;
         /* 0207081C */ if (_t37) goto L_02070830; else goto L_02070820;
   L_02070820: ; // 0x2070820
         /* 02070820 */ _t38 = cpu->r[11] + 0x00000000u;
         /* 02070820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t38);
-        /* 02070824 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[31]);
-        /* 02070828 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[31]));
+        /* 02070828 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070828 */ _t40 = _t39 & 0x00000001u;
         /* 02070828 */ if (_t40) goto L_0207082C; else goto L_02070810;
   L_0207082C: ; // 0x207082c
@@ -14587,10 +14587,10 @@ void Gambit_fn_02070708(CPUState* cpu) {
         /* 02070834 */ cpu->r[7] = rbrew_read32(cpu->mem, _t41);
         /* 02070838 */ _t42 = cpu->r[1] + 0x00000010u;
         /* 02070838 */ cpu->r[5] = rbrew_read32(cpu->mem, _t42);
-        /* 0207083C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 0207083C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 02070840 */ _t43 = cpu->r[5] + 0x00000014u;
         /* 02070840 */ cpu->r[0] = rbrew_read32(cpu->mem, _t43);
-        /* 02070844 */ _t44 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02070844 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02070844 */ _t45 = _t44 & 0x00000001u;
         /* 02070844 */ if (_t45) goto L_0207084C; else goto L_02070848;
   L_02070848: ; // 0x2070848
@@ -14645,10 +14645,10 @@ void Gambit_fn_02070708(CPUState* cpu) {
         /* 020708CC */ rbrew_write32(cpu->mem, _t59, cpu->r[10]);
         /* 020708D0 */ _t60 = cpu->r[29] + 0x0000003Cu;
         /* 020708D0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t60);
-        /* 020708D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000001u);
+        /* 020708D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000001u));
         /* 020708D8 */ _t61 = cpu->r[29] + 0x00000040u;
         /* 020708D8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t61);
-        /* 020708DC */ _t62 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020708DC */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020708DC */ _t63 = _t62 & 0x00000001u;
         /* 020708DC */ if (_t63) goto L_020708E0; else goto L_020708E4;
   L_020708E0: ; // 0x20708e0
@@ -14664,23 +14664,23 @@ void Gambit_fn_02070708(CPUState* cpu) {
         /* 020708F8 */ _t66 = cpu->r[7] + 0x00000000u;
         /* 020708F8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t66);
         /* 020708FC */ cpu->r[27] = 0x00000000u;
-        /* 02070900 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 02070900 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 02070904 */ cpu->r[9] = 0x00080000u;
-        /* 02070908 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070908 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070908 */ _t68 = _t67 & 0x00000001u;
         /* 02070908 */ if (_t68) goto L_02070930; else goto L_0207090C;
   L_0207090C: ; // 0x207090c
         /* 0207090C */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 02070910 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[9]);
+        /* 02070910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[9]));
         /* 02070914 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02070918 */ _t69 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02070918 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02070918 */ _t70 = _t69 & 0x00000001u;
         /* 02070918 */ if (_t70) goto L_0207092C; else goto L_0207091C;
   L_0207091C: ; // 0x207091c
         /* 0207091C */ _t71 = cpu->r[7] + 0x00000000u;
         /* 0207091C */ cpu->r[0] = rbrew_read8(cpu->mem, _t71);
-        /* 02070920 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 02070924 */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070920 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 02070924 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070924 */ _t73 = _t72 & 0x00000001u;
         /* 02070924 */ if (_t73) goto L_02070928; else goto L_0207090C;
   L_02070928: ; // 0x2070928
@@ -14690,8 +14690,8 @@ void Gambit_fn_02070708(CPUState* cpu) {
   L_02070930: ; // 0x2070930
         /* 02070930 */ _t74 = cpu->r[30] + 0x00000008u;
         /* 02070930 */ cpu->r[8] = rbrew_read32(cpu->mem, _t74);
-        /* 02070934 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[8]);
-        /* 02070938 */ _t75 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02070934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[8]));
+        /* 02070938 */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02070938 */ _t76 = _t75 & 0x00000001u;
         /* 02070938 */ if (_t76) goto L_02070940; else goto L_0207093C;
   L_0207093C: ; // 0x207093c
@@ -14756,23 +14756,23 @@ void Gambit_fn_02070804(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19, _t20, _t21, _t22, _t23, _t24, _t25, _t26, _t27, _t28, _t29, _t30, _t31, _t32, _t33, _t34, _t35, _t36, _t37, _t38, _t39, _t40, _t41, _t42, _t43, _t44, _t45, _t46, _t47, _t48, _t49, _t50, _t51, _t52, _t53, _t54, _t55, _t56, _t57;
 
   L_02070804: ; // 0x2070804
-        /* 02070804 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 02070804 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 02070808 */ cpu->r[0] = 0x00080000u;
-        /* 0207080C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207080C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207080C */ _t1 = _t0 & 0x00000001u;
         /* 0207080C */ if (_t1) goto L_02070834; else goto L_02070810;
   L_02070810: ; // 0x2070810
         /* 02070810 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02070814 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 02070814 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 02070818 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 0207081C */ _t2 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207081C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207081C */ _t3 = _t2 & 0x00000001u;
         /* 0207081C */ if (_t3) goto L_02070830; else goto L_02070820;
   L_02070820: ; // 0x2070820
         /* 02070820 */ _t4 = cpu->r[11] + 0x00000000u;
         /* 02070820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
-        /* 02070824 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[31]);
-        /* 02070828 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[31]));
+        /* 02070828 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070828 */ _t6 = _t5 & 0x00000001u;
         /* 02070828 */ if (_t6) goto L_0207082C; else goto L_02070810;
   L_0207082C: ; // 0x207082c
@@ -14784,10 +14784,10 @@ void Gambit_fn_02070804(CPUState* cpu) {
         /* 02070834 */ cpu->r[7] = rbrew_read32(cpu->mem, _t7);
         /* 02070838 */ _t8 = cpu->r[1] + 0x00000010u;
         /* 02070838 */ cpu->r[5] = rbrew_read32(cpu->mem, _t8);
-        /* 0207083C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 0207083C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 02070840 */ _t9 = cpu->r[5] + 0x00000014u;
         /* 02070840 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 02070844 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02070844 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02070844 */ _t11 = _t10 & 0x00000001u;
         /* 02070844 */ if (_t11) goto L_0207084C; else goto L_02070848;
   L_02070848: ; // 0x2070848
@@ -14842,10 +14842,10 @@ void Gambit_fn_02070804(CPUState* cpu) {
         /* 020708CC */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
         /* 020708D0 */ _t26 = cpu->r[29] + 0x0000003Cu;
         /* 020708D0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t26);
-        /* 020708D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000001u);
+        /* 020708D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000001u));
         /* 020708D8 */ _t27 = cpu->r[29] + 0x00000040u;
         /* 020708D8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t27);
-        /* 020708DC */ _t28 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020708DC */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020708DC */ _t29 = _t28 & 0x00000001u;
         /* 020708DC */ if (_t29) goto L_020708E0; else goto L_020708E4;
   L_020708E0: ; // 0x20708e0
@@ -14861,23 +14861,23 @@ void Gambit_fn_02070804(CPUState* cpu) {
         /* 020708F8 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 020708F8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t32);
         /* 020708FC */ cpu->r[27] = 0x00000000u;
-        /* 02070900 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 02070900 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 02070904 */ cpu->r[9] = 0x00080000u;
-        /* 02070908 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070908 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070908 */ _t34 = _t33 & 0x00000001u;
         /* 02070908 */ if (_t34) goto L_02070930; else goto L_0207090C;
   L_0207090C: ; // 0x207090c
         /* 0207090C */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 02070910 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[9]);
+        /* 02070910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[9]));
         /* 02070914 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02070918 */ _t35 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02070918 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02070918 */ _t36 = _t35 & 0x00000001u;
         /* 02070918 */ if (_t36) goto L_0207092C; else goto L_0207091C;
   L_0207091C: ; // 0x207091c
         /* 0207091C */ _t37 = cpu->r[7] + 0x00000000u;
         /* 0207091C */ cpu->r[0] = rbrew_read8(cpu->mem, _t37);
-        /* 02070920 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 02070924 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070920 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 02070924 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070924 */ _t39 = _t38 & 0x00000001u;
         /* 02070924 */ if (_t39) goto L_02070928; else goto L_0207090C;
   L_02070928: ; // 0x2070928
@@ -14887,8 +14887,8 @@ void Gambit_fn_02070804(CPUState* cpu) {
   L_02070930: ; // 0x2070930
         /* 02070930 */ _t40 = cpu->r[30] + 0x00000008u;
         /* 02070930 */ cpu->r[8] = rbrew_read32(cpu->mem, _t40);
-        /* 02070934 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[8]);
-        /* 02070938 */ _t41 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02070934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[8]));
+        /* 02070938 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02070938 */ _t42 = _t41 & 0x00000001u;
         /* 02070938 */ if (_t42) goto L_02070940; else goto L_0207093C;
   L_0207093C: ; // 0x207093c
@@ -14954,21 +14954,21 @@ void Gambit_fn_02070808(CPUState* cpu) {
 
   L_02070808: ; // 0x2070808
         /* 02070808 */ cpu->r[0] = 0x00080000u;
-        /* 0207080C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207080C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207080C */ _t1 = _t0 & 0x00000001u;
         /* 0207080C */ if (_t1) goto L_02070834; else goto L_02070810;
   L_02070810: ; // 0x2070810
         /* 02070810 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02070814 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 02070814 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 02070818 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 0207081C */ _t2 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207081C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207081C */ _t3 = _t2 & 0x00000001u;
         /* 0207081C */ if (_t3) goto L_02070830; else goto L_02070820;
   L_02070820: ; // 0x2070820
         /* 02070820 */ _t4 = cpu->r[11] + 0x00000000u;
         /* 02070820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
-        /* 02070824 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[31]);
-        /* 02070828 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[31]));
+        /* 02070828 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070828 */ _t6 = _t5 & 0x00000001u;
         /* 02070828 */ if (_t6) goto L_0207082C; else goto L_02070810;
   L_0207082C: ; // 0x207082c
@@ -14980,10 +14980,10 @@ void Gambit_fn_02070808(CPUState* cpu) {
         /* 02070834 */ cpu->r[7] = rbrew_read32(cpu->mem, _t7);
         /* 02070838 */ _t8 = cpu->r[1] + 0x00000010u;
         /* 02070838 */ cpu->r[5] = rbrew_read32(cpu->mem, _t8);
-        /* 0207083C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 0207083C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 02070840 */ _t9 = cpu->r[5] + 0x00000014u;
         /* 02070840 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 02070844 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02070844 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02070844 */ _t11 = _t10 & 0x00000001u;
         /* 02070844 */ if (_t11) goto L_0207084C; else goto L_02070848;
   L_02070848: ; // 0x2070848
@@ -15038,10 +15038,10 @@ void Gambit_fn_02070808(CPUState* cpu) {
         /* 020708CC */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
         /* 020708D0 */ _t26 = cpu->r[29] + 0x0000003Cu;
         /* 020708D0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t26);
-        /* 020708D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000001u);
+        /* 020708D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000001u));
         /* 020708D8 */ _t27 = cpu->r[29] + 0x00000040u;
         /* 020708D8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t27);
-        /* 020708DC */ _t28 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020708DC */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020708DC */ _t29 = _t28 & 0x00000001u;
         /* 020708DC */ if (_t29) goto L_020708E0; else goto L_020708E4;
   L_020708E0: ; // 0x20708e0
@@ -15057,23 +15057,23 @@ void Gambit_fn_02070808(CPUState* cpu) {
         /* 020708F8 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 020708F8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t32);
         /* 020708FC */ cpu->r[27] = 0x00000000u;
-        /* 02070900 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 02070900 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 02070904 */ cpu->r[9] = 0x00080000u;
-        /* 02070908 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070908 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070908 */ _t34 = _t33 & 0x00000001u;
         /* 02070908 */ if (_t34) goto L_02070930; else goto L_0207090C;
   L_0207090C: ; // 0x207090c
         /* 0207090C */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 02070910 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[9]);
+        /* 02070910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[9]));
         /* 02070914 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02070918 */ _t35 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02070918 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02070918 */ _t36 = _t35 & 0x00000001u;
         /* 02070918 */ if (_t36) goto L_0207092C; else goto L_0207091C;
   L_0207091C: ; // 0x207091c
         /* 0207091C */ _t37 = cpu->r[7] + 0x00000000u;
         /* 0207091C */ cpu->r[0] = rbrew_read8(cpu->mem, _t37);
-        /* 02070920 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 02070924 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070920 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 02070924 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070924 */ _t39 = _t38 & 0x00000001u;
         /* 02070924 */ if (_t39) goto L_02070928; else goto L_0207090C;
   L_02070928: ; // 0x2070928
@@ -15083,8 +15083,8 @@ void Gambit_fn_02070808(CPUState* cpu) {
   L_02070930: ; // 0x2070930
         /* 02070930 */ _t40 = cpu->r[30] + 0x00000008u;
         /* 02070930 */ cpu->r[8] = rbrew_read32(cpu->mem, _t40);
-        /* 02070934 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[8]);
-        /* 02070938 */ _t41 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02070934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[8]));
+        /* 02070938 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02070938 */ _t42 = _t41 & 0x00000001u;
         /* 02070938 */ if (_t42) goto L_02070940; else goto L_0207093C;
   L_0207093C: ; // 0x207093c
@@ -15149,23 +15149,23 @@ void Gambit_fn_02070900(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19, _t20, _t21, _t22, _t23, _t24;
 
   L_02070900: ; // 0x2070900
-        /* 02070900 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 02070900 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 02070904 */ cpu->r[9] = 0x00080000u;
-        /* 02070908 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070908 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070908 */ _t1 = _t0 & 0x00000001u;
         /* 02070908 */ if (_t1) goto L_02070930; else goto L_0207090C;
   L_0207090C: ; // 0x207090c
         /* 0207090C */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 02070910 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[9]);
+        /* 02070910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[9]));
         /* 02070914 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02070918 */ _t2 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02070918 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02070918 */ _t3 = _t2 & 0x00000001u;
         /* 02070918 */ if (_t3) goto L_0207092C; else goto L_0207091C;
   L_0207091C: ; // 0x207091c
         /* 0207091C */ _t4 = cpu->r[7] + 0x00000000u;
         /* 0207091C */ cpu->r[0] = rbrew_read8(cpu->mem, _t4);
-        /* 02070920 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 02070924 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070920 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 02070924 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070924 */ _t6 = _t5 & 0x00000001u;
         /* 02070924 */ if (_t6) goto L_02070928; else goto L_0207090C;
   L_02070928: ; // 0x2070928
@@ -15175,8 +15175,8 @@ void Gambit_fn_02070900(CPUState* cpu) {
   L_02070930: ; // 0x2070930
         /* 02070930 */ _t7 = cpu->r[30] + 0x00000008u;
         /* 02070930 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
-        /* 02070934 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[8]);
-        /* 02070938 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02070934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[8]));
+        /* 02070938 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02070938 */ _t9 = _t8 & 0x00000001u;
         /* 02070938 */ if (_t9) goto L_02070940; else goto L_0207093C;
   L_0207093C: ; // 0x207093c
@@ -15242,21 +15242,21 @@ void Gambit_fn_02070904(CPUState* cpu) {
 
   L_02070904: ; // 0x2070904
         /* 02070904 */ cpu->r[9] = 0x00080000u;
-        /* 02070908 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070908 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070908 */ _t1 = _t0 & 0x00000001u;
         /* 02070908 */ if (_t1) goto L_02070930; else goto L_0207090C;
   L_0207090C: ; // 0x207090c
         /* 0207090C */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 02070910 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[9]);
+        /* 02070910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[9]));
         /* 02070914 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02070918 */ _t2 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02070918 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02070918 */ _t3 = _t2 & 0x00000001u;
         /* 02070918 */ if (_t3) goto L_0207092C; else goto L_0207091C;
   L_0207091C: ; // 0x207091c
         /* 0207091C */ _t4 = cpu->r[7] + 0x00000000u;
         /* 0207091C */ cpu->r[0] = rbrew_read8(cpu->mem, _t4);
-        /* 02070920 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 02070924 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070920 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 02070924 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070924 */ _t6 = _t5 & 0x00000001u;
         /* 02070924 */ if (_t6) goto L_02070928; else goto L_0207090C;
   L_02070928: ; // 0x2070928
@@ -15266,8 +15266,8 @@ void Gambit_fn_02070904(CPUState* cpu) {
   L_02070930: ; // 0x2070930
         /* 02070930 */ _t7 = cpu->r[30] + 0x00000008u;
         /* 02070930 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
-        /* 02070934 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[8]);
-        /* 02070938 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02070934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[8]));
+        /* 02070938 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02070938 */ _t9 = _t8 & 0x00000001u;
         /* 02070938 */ if (_t9) goto L_02070940; else goto L_0207093C;
   L_0207093C: ; // 0x207093c
@@ -15332,21 +15332,21 @@ void Gambit_fn_02070908(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19, _t20, _t21, _t22, _t23, _t24;
 
   L_02070908: ; // 0x2070908
-        /* 02070908 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070908 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070908 */ _t1 = _t0 & 0x00000001u;
         /* 02070908 */ if (_t1) goto L_02070930; else goto L_0207090C;
   L_0207090C: ; // 0x207090c
         /* 0207090C */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 02070910 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[9]);
+        /* 02070910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[9]));
         /* 02070914 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02070918 */ _t2 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02070918 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02070918 */ _t3 = _t2 & 0x00000001u;
         /* 02070918 */ if (_t3) goto L_0207092C; else goto L_0207091C;
   L_0207091C: ; // 0x207091c
         /* 0207091C */ _t4 = cpu->r[7] + 0x00000000u;
         /* 0207091C */ cpu->r[0] = rbrew_read8(cpu->mem, _t4);
-        /* 02070920 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 02070924 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070920 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 02070924 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070924 */ _t6 = _t5 & 0x00000001u;
         /* 02070924 */ if (_t6) goto L_02070928; else goto L_0207090C;
   L_02070928: ; // 0x2070928
@@ -15356,8 +15356,8 @@ void Gambit_fn_02070908(CPUState* cpu) {
   L_02070930: ; // 0x2070930
         /* 02070930 */ _t7 = cpu->r[30] + 0x00000008u;
         /* 02070930 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
-        /* 02070934 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[8]);
-        /* 02070938 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02070934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[8]));
+        /* 02070938 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02070938 */ _t9 = _t8 & 0x00000001u;
         /* 02070938 */ if (_t9) goto L_02070940; else goto L_0207093C;
   L_0207093C: ; // 0x207093c
@@ -15513,8 +15513,8 @@ void Gambit_fn_02070A38(CPUState* cpu) {
         /* 02070A48 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 02070A4C */ _t4 = cpu->r[31] + 0x00000030u;
         /* 02070A4C */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
-        /* 02070A50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02070A54 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070A50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02070A54 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070A54 */ _t6 = _t5 & 0x00000001u;
         /* 02070A54 */ if (_t6) goto L_02070A58; else goto L_02070A84;
   L_02070A58: ; // 0x2070a58
@@ -15538,8 +15538,8 @@ void Gambit_fn_02070A38(CPUState* cpu) {
   L_02070A84: ; // 0x2070a84
         /* 02070A84 */ _t13 = cpu->r[31] + 0x00000070u;
         /* 02070A84 */ cpu->r[0] = rbrew_read8(cpu->mem, _t13);
-        /* 02070A88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02070A8C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070A88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02070A8C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070A8C */ _t15 = _t14 & 0x00000001u;
         /* 02070A8C */ if (_t15) goto L_02070A90; else goto L_02070AC0;
   L_02070A90: ; // 0x2070a90
@@ -15551,8 +15551,8 @@ void Gambit_fn_02070A38(CPUState* cpu) {
         /* 02070A98 */ cpu->r[0] = rbrew_read32(cpu->mem, _t18);
         /* 02070A9C */ cpu->ctr = cpu->r[0];
         /* 02070AA0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02070AA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070AA8 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070AA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070AA8 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070AA8 */ _t20 = _t19 & 0x00000001u;
         /* 02070AA8 */ if (_t20) goto L_02070AC0; else goto L_02070AAC;
   L_02070AAC: ; // 0x2070aac
@@ -15570,8 +15570,8 @@ void Gambit_fn_02070A38(CPUState* cpu) {
         /* 02070AC4 */ _t25 = cpu->r[12] + 0x00000118u;
         /* 02070AC4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t25);
         /* 02070AC8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 02070AC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02070ACC */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070AC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02070ACC */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070ACC */ _t27 = _t26 & 0x00000001u;
         /* 02070ACC */ if (_t27) goto L_02070AF0; else goto L_02070AD0;
   L_02070AD0: ; // 0x2070ad0
@@ -15604,18 +15604,18 @@ void Gambit_fn_02070B08(CPUState* cpu) {
         /* 02070B08 */ cpu->r[0] = cpu->lr;
         /* 02070B0C */ _t0 = cpu->r[1] + 0x00000004u;
         /* 02070B0C */ rbrew_write32(cpu->mem, _t0, cpu->r[0]);
-        /* 02070B10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02070B10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02070B14 */ _t1 = cpu->r[1] + 0xFFFFFFF8u;
         /* 02070B14 */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 02070B14 */ cpu->r[1] = _t1;
-        /* 02070B18 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070B18 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070B18 */ _t3 = _t2 & 0x00000001u;
         /* 02070B18 */ if (_t3) goto L_02070B1C; else goto L_02070B2C;
   L_02070B1C: ; // 0x2070b1c
         /* 02070B1C */ cpu->r[3] = 0x0000000Cu;
         /* 02070B20 */ Gambit_fn_02801A78(cpu);
-        /* 02070B24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070B28 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070B24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070B28 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070B28 */ _t5 = _t4 & 0x00000001u;
         /* 02070B28 */ if (_t5) goto L_02070B48; else goto L_02070B2C;
   L_02070B2C: ; // 0x2070b2c
@@ -15645,14 +15645,14 @@ void Gambit_fn_02070B14(CPUState* cpu) {
         /* 02070B14 */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 02070B14 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 02070B14 */ cpu->r[1] = _t0;
-        /* 02070B18 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070B18 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070B18 */ _t2 = _t1 & 0x00000001u;
         /* 02070B18 */ if (_t2) goto L_02070B1C; else goto L_02070B2C;
   L_02070B1C: ; // 0x2070b1c
         /* 02070B1C */ cpu->r[3] = 0x0000000Cu;
         /* 02070B20 */ Gambit_fn_02801A78(cpu);
-        /* 02070B24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070B28 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070B24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070B28 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070B28 */ _t4 = _t3 & 0x00000001u;
         /* 02070B28 */ if (_t4) goto L_02070B48; else goto L_02070B2C;
   L_02070B2C: ; // 0x2070b2c
@@ -15679,15 +15679,15 @@ void Gambit_fn_02070B58(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02070B58: ; // 0x2070b58
-        /* 02070B58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070B5C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070B58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070B5C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070B5C */ _t1 = _t0 & 0x00000001u;
         /* 02070B5C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02070B5C */ goto L_02070B60;
   L_02070B60: ; // 0x2070b60
         /* 02070B60 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02070B60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02070B64 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070B60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02070B64 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070B64 */ _t3 = _t2 & 0x00000001u;
         /* 02070B64 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02070B64 */ goto L_02070B68;
@@ -15706,8 +15706,8 @@ void Gambit_fn_02070B58(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -15721,15 +15721,15 @@ void Gambit_fn_02070B58(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -15775,18 +15775,18 @@ void Gambit_fn_02070B70(CPUState* cpu) {
         /* 02009100 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02009100 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02009104 */ cpu->r[12] = 0x00000000u;
-        /* 02009108 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02009108 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0200910C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0200910C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02009110 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02009110 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02009110 */ _t6 = _t5 & 0x00000001u;
         /* 02009110 */ if (_t6) goto L_02009138; else goto L_02009114;
   L_02009114: ; // 0x2009114
         /* 02009114 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02009114 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02009118 */ /* nop */
-        /* 0200911C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 02009120 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0200911C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 02009120 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02009120 */ _t9 = _t8 & 0x00000001u;
         /* 02009120 */ if (_t9) goto L_02009124; else goto L_02009138;
   L_02009124: ; // 0x2009124
@@ -15884,15 +15884,15 @@ void Gambit_fn_02070BAC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02070BAC: ; // 0x2070bac
-        /* 02070BAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070BB0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070BAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070BB0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070BB0 */ _t1 = _t0 & 0x00000001u;
         /* 02070BB0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02070BB0 */ goto L_02070BB4;
   L_02070BB4: ; // 0x2070bb4
         /* 02070BB4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02070BB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02070BB8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070BB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02070BB8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070BB8 */ _t3 = _t2 & 0x00000001u;
         /* 02070BB8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02070BB8 */ goto L_02070BBC;
@@ -15911,8 +15911,8 @@ void Gambit_fn_02070BAC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -15926,15 +15926,15 @@ void Gambit_fn_02070BAC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -15980,15 +15980,15 @@ void Gambit_fn_02070BDC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02070BDC: ; // 0x2070bdc
-        /* 02070BDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070BE0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070BDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070BE0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070BE0 */ _t1 = _t0 & 0x00000001u;
         /* 02070BE0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02070BE0 */ goto L_02070BE4;
   L_02070BE4: ; // 0x2070be4
         /* 02070BE4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02070BE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02070BE8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070BE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02070BE8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070BE8 */ _t3 = _t2 & 0x00000001u;
         /* 02070BE8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02070BE8 */ goto L_02070BEC;
@@ -16007,8 +16007,8 @@ void Gambit_fn_02070BDC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -16022,15 +16022,15 @@ void Gambit_fn_02070BDC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -16058,15 +16058,15 @@ void Gambit_fn_02070BF0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02070BF0: ; // 0x2070bf0
-        /* 02070BF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070BF4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070BF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070BF4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070BF4 */ _t1 = _t0 & 0x00000001u;
         /* 02070BF4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02070BF4 */ goto L_02070BF8;
   L_02070BF8: ; // 0x2070bf8
         /* 02070BF8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02070BF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02070BFC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070BF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02070BFC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070BFC */ _t3 = _t2 & 0x00000001u;
         /* 02070BFC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02070BFC */ goto L_02070C00;
@@ -16085,8 +16085,8 @@ void Gambit_fn_02070BF0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -16100,15 +16100,15 @@ void Gambit_fn_02070BF0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -16161,10 +16161,10 @@ void Gambit_fn_02070C0C(CPUState* cpu) {
         /* 02070C2C */ cpu->r[31] = 0x101D0000u;
         /* 02070C30 */ _t3 = cpu->r[28] + 0x0000001Cu;
         /* 02070C30 */ rbrew_write32(cpu->mem, _t3, cpu->r[4]);
-        /* 02070C34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02070C34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02070C38 */ _t4 = cpu->r[28] + 0x0000000Fu;
         /* 02070C38 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[27]);
-        /* 02070C3C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070C3C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070C3C */ _t6 = _t5 & 0x00000001u;
         /* 02070C3C */ if (_t6) goto L_02070C80; else goto L_02070C40;
   L_02070C40: ; // 0x2070c40
@@ -16179,16 +16179,16 @@ void Gambit_fn_02070C0C(CPUState* cpu) {
         /* 02070C54 */ cpu->r[5] = 0x00000004u;
         /* 02070C58 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 02070C5C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02070C60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02070C60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02070C64 */ cpu->r[0] = cpu->r[27];
-        /* 02070C68 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02070C68 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02070C68 */ _t11 = _t10 & 0x00000001u;
         /* 02070C68 */ if (_t11) goto L_02070C70; else goto L_02070C6C;
   L_02070C6C: ; // 0x2070c6c
         /* 02070C6C */ cpu->r[0] = 0x00000001u;
   L_02070C70: ; // 0x2070c70
-        /* 02070C70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070C74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070C70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070C74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070C74 */ _t13 = _t12 & 0x00000001u;
         /* 02070C74 */ if (_t13) goto L_02070C80; else goto L_02070C78;
   L_02070C78: ; // 0x2070c78
@@ -16200,9 +16200,9 @@ void Gambit_fn_02070C0C(CPUState* cpu) {
         /* 02070C80 */ _t16 = cpu->r[28] + 0x00000020u;
         /* 02070C80 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 02070C84 */ cpu->r[0] = 0x00000000u;
-        /* 02070C88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02070C88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02070C8C */ cpu->r[12] = cpu->r[0];
-        /* 02070C90 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02070C90 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02070C90 */ _t18 = _t17 & 0x00000001u;
         /* 02070C90 */ if (_t18) goto L_02070C94; else goto L_02070CB8;
   L_02070C94: ; // 0x2070c94
@@ -16227,8 +16227,8 @@ void Gambit_fn_02070C0C(CPUState* cpu) {
   L_02070CB8: ; // 0x2070cb8
         /* 02070CB8 */ _t26 = cpu->r[28] + 0x0000000Fu;
         /* 02070CB8 */ cpu->r[27] = rbrew_read8(cpu->mem, _t26);
-        /* 02070CBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 02070CC0 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070CBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 02070CC0 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070CC0 */ _t28 = _t27 & 0x00000001u;
         /* 02070CC0 */ if (_t28) goto L_02070D04; else goto L_02070CC4;
   L_02070CC4: ; // 0x2070cc4
@@ -16243,16 +16243,16 @@ void Gambit_fn_02070C0C(CPUState* cpu) {
         /* 02070CD8 */ cpu->r[5] = 0x00000004u;
         /* 02070CDC */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 02070CE0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02070CE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02070CE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02070CE8 */ cpu->r[11] = cpu->r[27];
-        /* 02070CEC */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02070CEC */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02070CEC */ _t33 = _t32 & 0x00000001u;
         /* 02070CEC */ if (_t33) goto L_02070CF4; else goto L_02070CF0;
   L_02070CF0: ; // 0x2070cf0
         /* 02070CF0 */ cpu->r[11] = 0x00000001u;
   L_02070CF4: ; // 0x2070cf4
-        /* 02070CF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070CF8 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070CF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070CF8 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070CF8 */ _t35 = _t34 & 0x00000001u;
         /* 02070CF8 */ if (_t35) goto L_02070D04; else goto L_02070CFC;
   L_02070CFC: ; // 0x2070cfc
@@ -16264,9 +16264,9 @@ void Gambit_fn_02070C0C(CPUState* cpu) {
         /* 02070D04 */ _t38 = cpu->r[28] + 0x00000028u;
         /* 02070D04 */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 02070D08 */ cpu->r[0] = 0x00000000u;
-        /* 02070D0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02070D0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 02070D10 */ cpu->r[12] = cpu->r[0];
-        /* 02070D14 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02070D14 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02070D14 */ _t40 = _t39 & 0x00000001u;
         /* 02070D14 */ if (_t40) goto L_02070D18; else goto L_02070D3C;
   L_02070D18: ; // 0x2070d18
@@ -16291,8 +16291,8 @@ void Gambit_fn_02070C0C(CPUState* cpu) {
   L_02070D3C: ; // 0x2070d3c
         /* 02070D3C */ _t48 = cpu->r[28] + 0x0000000Fu;
         /* 02070D3C */ cpu->r[27] = rbrew_read8(cpu->mem, _t48);
-        /* 02070D40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 02070D44 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070D40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 02070D44 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070D44 */ _t50 = _t49 & 0x00000001u;
         /* 02070D44 */ if (_t50) goto L_02070D88; else goto L_02070D48;
   L_02070D48: ; // 0x2070d48
@@ -16307,16 +16307,16 @@ void Gambit_fn_02070C0C(CPUState* cpu) {
         /* 02070D5C */ cpu->r[5] = 0x00000004u;
         /* 02070D60 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 02070D64 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02070D68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02070D68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02070D6C */ cpu->r[10] = cpu->r[27];
-        /* 02070D70 */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02070D70 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02070D70 */ _t55 = _t54 & 0x00000001u;
         /* 02070D70 */ if (_t55) goto L_02070D78; else goto L_02070D74;
   L_02070D74: ; // 0x2070d74
         /* 02070D74 */ cpu->r[10] = 0x00000001u;
   L_02070D78: ; // 0x2070d78
-        /* 02070D78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070D7C */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070D78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070D7C */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070D7C */ _t57 = _t56 & 0x00000001u;
         /* 02070D7C */ if (_t57) goto L_02070D88; else goto L_02070D80;
   L_02070D80: ; // 0x2070d80
@@ -16328,9 +16328,9 @@ void Gambit_fn_02070C0C(CPUState* cpu) {
         /* 02070D88 */ _t60 = cpu->r[28] + 0x00000030u;
         /* 02070D88 */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
         /* 02070D8C */ cpu->r[0] = 0x00000000u;
-        /* 02070D90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02070D90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02070D94 */ cpu->r[5] = cpu->r[0];
-        /* 02070D98 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02070D98 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02070D98 */ _t62 = _t61 & 0x00000001u;
         /* 02070D98 */ if (_t62) goto L_02070D9C; else goto L_02070DC0;
   L_02070D9C: ; // 0x2070d9c
@@ -16355,8 +16355,8 @@ void Gambit_fn_02070C0C(CPUState* cpu) {
   L_02070DC0: ; // 0x2070dc0
         /* 02070DC0 */ _t70 = cpu->r[30] + 0x00000000u;
         /* 02070DC0 */ cpu->r[25] = rbrew_read8(cpu->mem, _t70);
-        /* 02070DC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 02070DC8 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070DC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 02070DC8 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070DC8 */ _t72 = _t71 & 0x00000001u;
         /* 02070DC8 */ if (_t72) goto L_02070EA4; else goto L_02070DCC;
   L_02070DCC: ; // 0x2070dcc
@@ -16372,10 +16372,10 @@ void Gambit_fn_02070C0C(CPUState* cpu) {
         /* 02070DE4 */ cpu->r[4] = (uint32_t)((int32_t)cpu->r[25] * (int32_t)0x00000024u);
         /* 02070DE8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02070DEC */ cpu->r[24] = cpu->r[3];
-        /* 02070DF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 02070DF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 02070DF4 */ cpu->r[30] = cpu->r[25];
         /* 02070DF8 */ cpu->r[7] = 0x00000000u;
-        /* 02070DFC */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02070DFC */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02070DFC */ _t77 = _t76 & 0x00000001u;
         /* 02070DFC */ if (_t77) goto L_02070E04; else goto L_02070E00;
   L_02070E00: ; // 0x2070e00
@@ -16388,36 +16388,36 @@ void Gambit_fn_02070C0C(CPUState* cpu) {
         /* 02070E10 */ cpu->r[23] = 0x00000018u;
   L_02070E14: ; // 0x2070e14
         /* 02070E14 */ cpu->r[27] = cpu->r[24] + cpu->r[22];
-        /* 02070E14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 02070E18 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070E14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 02070E18 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070E18 */ _t80 = _t79 & 0x00000001u;
         /* 02070E18 */ if (_t80) goto L_02070E88; else goto L_02070E1C;
   L_02070E1C: ; // 0x2070e1c
         /* 02070E1C */ cpu->r[26] = cpu->r[27];
-        /* 02070E1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 02070E20 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070E1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 02070E20 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070E20 */ _t82 = _t81 & 0x00000001u;
         /* 02070E20 */ if (_t82) goto L_02070E24; else goto L_02070E34;
   L_02070E24: ; // 0x2070e24
         /* 02070E24 */ cpu->r[3] = 0x00000024u;
         /* 02070E28 */ Gambit_fn_02801A78(cpu);
         /* 02070E2C */ cpu->r[26] = cpu->r[3];
-        /* 02070E2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 02070E30 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070E2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 02070E30 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070E30 */ _t84 = _t83 & 0x00000001u;
         /* 02070E30 */ if (_t84) goto L_02070E7C; else goto L_02070E34;
   L_02070E34: ; // 0x2070e34
         /* 02070E34 */ cpu->r[11] = cpu->r[26];
-        /* 02070E34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02070E38 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070E34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02070E38 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070E38 */ _t86 = _t85 & 0x00000001u;
         /* 02070E38 */ if (_t86) goto L_02070E3C; else goto L_02070E4C;
   L_02070E3C: ; // 0x2070e3c
         /* 02070E3C */ cpu->r[3] = 0x0000000Cu;
         /* 02070E40 */ Gambit_fn_02801A78(cpu);
         /* 02070E44 */ cpu->r[11] = cpu->r[3];
-        /* 02070E44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02070E48 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070E44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02070E48 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070E48 */ _t88 = _t87 & 0x00000001u;
         /* 02070E48 */ if (_t88) goto L_02070E68; else goto L_02070E4C;
   L_02070E4C: ; // 0x2070e4c
@@ -16448,14 +16448,14 @@ void Gambit_fn_02070C0C(CPUState* cpu) {
         /* 02070E84 */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
   L_02070E88: ; // 0x2070e88
         /* 02070E88 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 02070E88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02070E88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02070E8C */ cpu->r[22] = cpu->r[22] + 0x00000024u;
-        /* 02070E90 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070E90 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070E90 */ _t98 = _t97 & 0x00000001u;
         /* 02070E90 */ if (_t98) goto L_02070E94; else goto L_02070E14;
   L_02070E94: ; // 0x2070e94
-        /* 02070E94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 02070E98 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070E94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 02070E98 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070E98 */ _t100 = _t99 & 0x00000001u;
         /* 02070E98 */ if (_t100) goto L_02070EA4; else goto L_02070E9C;
   L_02070E9C: ; // 0x2070e9c
@@ -16485,10 +16485,10 @@ void Gambit_fn_02070EBC(CPUState* cpu) {
         /* 02070EC0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 02070EC4 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 02070EC4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 02070EC8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[12]);
+        /* 02070EC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[12]));
         /* 02070ECC */ _t3 = cpu->r[4] + 0x00000000u;
         /* 02070ECC */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 02070ED0 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02070ED0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02070ED0 */ _t5 = _t4 & 0x00000001u;
         /* 02070ED0 */ if (_t5) goto L_02070ED4; else goto L_02070EDC;
   L_02070ED4: ; // 0x2070ed4
@@ -16505,10 +16505,10 @@ void Gambit_fn_02070EBC(CPUState* cpu) {
         /* 02070EE8 */ cpu->r[9] = rbrew_read8(cpu->mem, _t9);
         /* 02070EEC */ _t10 = cpu->r[3] + 0x00000028u;
         /* 02070EEC */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 02070EF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
+        /* 02070EF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
         /* 02070EF4 */ _t11 = cpu->r[3] + 0x0000002Cu;
         /* 02070EF4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
-        /* 02070EF8 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02070EF8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02070EF8 */ _t13 = _t12 & 0x00000001u;
         /* 02070EF8 */ if (_t13) goto L_02070EFC; else goto L_02070F04;
   L_02070EFC: ; // 0x2070efc
@@ -16529,10 +16529,10 @@ void Gambit_fn_02070EBC(CPUState* cpu) {
         /* 02070F18 */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
         /* 02070F1C */ _t20 = cpu->r[3] + 0x00000034u;
         /* 02070F1C */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 02070F20 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
+        /* 02070F20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
         /* 02070F24 */ _t21 = cpu->r[6] + 0x00000000u;
         /* 02070F24 */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
-        /* 02070F28 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02070F28 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02070F28 */ _t23 = _t22 & 0x00000001u;
         /* 02070F28 */ if (_t23) goto L_02070F2C; else goto L_02070F34;
   L_02070F2C: ; // 0x2070f2c
@@ -16578,8 +16578,8 @@ void Gambit_fn_02070F44(CPUState* cpu) {
         /* 02070F80 */ Gambit_fn_026D6F40(cpu);
         /* 02070F84 */ cpu->r[3] = 0x00000278u;
         /* 02070F88 */ Gambit_fn_02801A78(cpu);
-        /* 02070F8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070F90 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070F8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070F90 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070F90 */ _t7 = _t6 & 0x00000001u;
         /* 02070F90 */ if (_t7) goto L_02070F98; else goto L_02070F94;
   L_02070F94: ; // 0x2070f94
@@ -16613,8 +16613,8 @@ void Gambit_fn_02070F44(CPUState* cpu) {
         /* 02070FE8 */ _t13 = cpu->r[1] + 0x00000084u;
         /* 02070FE8 */ rbrew_write32(cpu->mem, _t13, cpu->r[0]);
         /* 02070FEC */ Gambit_fn_02801A78(cpu);
-        /* 02070FF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070FF4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070FF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070FF4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070FF4 */ _t15 = _t14 & 0x00000001u;
         /* 02070FF4 */ if (_t15) goto L_02070FFC; else goto L_02070FF8;
   L_02070FF8: ; // 0x2070ff8
@@ -16667,8 +16667,8 @@ void Gambit_fn_02070F48(CPUState* cpu) {
         /* 02070F80 */ Gambit_fn_026D6F40(cpu);
         /* 02070F84 */ cpu->r[3] = 0x00000278u;
         /* 02070F88 */ Gambit_fn_02801A78(cpu);
-        /* 02070F8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070F90 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070F8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070F90 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070F90 */ _t7 = _t6 & 0x00000001u;
         /* 02070F90 */ if (_t7) goto L_02070F98; else goto L_02070F94;
   L_02070F94: ; // 0x2070f94
@@ -16702,8 +16702,8 @@ void Gambit_fn_02070F48(CPUState* cpu) {
         /* 02070FE8 */ _t13 = cpu->r[1] + 0x00000084u;
         /* 02070FE8 */ rbrew_write32(cpu->mem, _t13, cpu->r[0]);
         /* 02070FEC */ Gambit_fn_02801A78(cpu);
-        /* 02070FF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070FF4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070FF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070FF4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070FF4 */ _t15 = _t14 & 0x00000001u;
         /* 02070FF4 */ if (_t15) goto L_02070FFC; else goto L_02070FF8;
   L_02070FF8: ; // 0x2070ff8
@@ -16757,8 +16757,8 @@ void Gambit_fn_02071028(CPUState* cpu) {
         /* 02070F80 */ Gambit_fn_026D6F40(cpu);
         /* 02070F84 */ cpu->r[3] = 0x00000278u;
         /* 02070F88 */ Gambit_fn_02801A78(cpu);
-        /* 02070F8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070F90 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070F8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070F90 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070F90 */ _t7 = _t6 & 0x00000001u;
         /* 02070F90 */ if (_t7) goto L_02070F98; else goto L_02070F94;
   L_02070F94: ; // 0x2070f94
@@ -16792,8 +16792,8 @@ void Gambit_fn_02071028(CPUState* cpu) {
         /* 02070FE8 */ _t13 = cpu->r[1] + 0x00000084u;
         /* 02070FE8 */ rbrew_write32(cpu->mem, _t13, cpu->r[0]);
         /* 02070FEC */ Gambit_fn_02801A78(cpu);
-        /* 02070FF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02070FF4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02070FF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02070FF4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02070FF4 */ _t15 = _t14 & 0x00000001u;
         /* 02070FF4 */ if (_t15) goto L_02070FFC; else goto L_02070FF8;
   L_02070FF8: ; // 0x2070ff8
@@ -16863,15 +16863,15 @@ void Gambit_fn_02071040(CPUState* cpu) {
         /* 027E73C0 */ _t4 = cpu->r[1] + 0x00000014u;
         /* 027E73C0 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 027E73C4 */ Gambit_fn_027E6F8C(cpu);
-        /* 027E73C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 027E73CC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 027E73C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 027E73CC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 027E73CC */ _t6 = _t5 & 0x00000001u;
         /* 027E73CC */ if (_t6) goto L_027E73F8; else goto L_027E73D0;
   L_027E73D0: ; // 0x27e73d0
         /* 027E73D0 */ _t7 = cpu->r[3] + 0x00000094u;
         /* 027E73D0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 027E73D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 027E73D8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 027E73D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 027E73D8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 027E73D8 */ _t9 = _t8 & 0x00000001u;
         /* 027E73D8 */ if (_t9) goto L_027E73F8; else goto L_027E73DC;
   L_027E73DC: ; // 0x27e73dc
@@ -16924,15 +16924,15 @@ void Gambit_fn_0207105C(CPUState* cpu) {
         /* 027E73C0 */ _t4 = cpu->r[1] + 0x00000014u;
         /* 027E73C0 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 027E73C4 */ Gambit_fn_027E6F8C(cpu);
-        /* 027E73C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 027E73CC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 027E73C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 027E73CC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 027E73CC */ _t6 = _t5 & 0x00000001u;
         /* 027E73CC */ if (_t6) goto L_027E73F8; else goto L_027E73D0;
   L_027E73D0: ; // 0x27e73d0
         /* 027E73D0 */ _t7 = cpu->r[3] + 0x00000094u;
         /* 027E73D0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 027E73D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 027E73D8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 027E73D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 027E73D8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 027E73D8 */ _t9 = _t8 & 0x00000001u;
         /* 027E73D8 */ if (_t9) goto L_027E73F8; else goto L_027E73DC;
   L_027E73DC: ; // 0x27e73dc
@@ -17039,21 +17039,21 @@ void Gambit_fn_02071094(CPUState* cpu) {
         /* 020710A0 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020710A4 */ cpu->r[30] = cpu->r[5];
         /* 020710A8 */ cpu->r[31] = cpu->r[3];
-        /* 020710A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020710A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020710AC */ _t3 = cpu->r[1] + 0x0000000Cu;
         /* 020710AC */ rbrew_write32(cpu->mem, _t3, cpu->r[29]);
         /* 020710B0 */ _t4 = cpu->r[1] + 0x0000001Cu;
         /* 020710B0 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 020710B4 */ cpu->r[29] = cpu->r[4];
-        /* 020710B8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020710B8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020710B8 */ _t6 = _t5 & 0x00000001u;
         /* 020710B8 */ if (_t6) goto L_020710BC; else goto L_020710CC;
   L_020710BC: ; // 0x20710bc
         /* 020710BC */ cpu->r[3] = 0x0000003Cu;
         /* 020710C0 */ Gambit_fn_02801A78(cpu);
         /* 020710C4 */ cpu->r[31] = cpu->r[3];
-        /* 020710C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020710C8 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020710C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020710C8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020710C8 */ _t8 = _t7 & 0x00000001u;
         /* 020710C8 */ if (_t8) goto L_02071140; else goto L_020710CC;
   L_020710CC: ; // 0x20710cc
@@ -17088,8 +17088,8 @@ void Gambit_fn_02071094(CPUState* cpu) {
         /* 02071120 */ _t16 = cpu->r[31] + 0x00000028u;
         /* 02071120 */ rbrew_write32(cpu->mem, _t16, cpu->r[10]);
         /* 02071124 */ Gambit_fn_02801A78(cpu);
-        /* 02071128 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207112C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071128 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207112C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207112C */ _t18 = _t17 & 0x00000001u;
         /* 0207112C */ if (_t18) goto L_02071134; else goto L_02071130;
   L_02071130: ; // 0x2071130
@@ -17129,21 +17129,21 @@ void Gambit_fn_02071098(CPUState* cpu) {
         /* 020710A0 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020710A4 */ cpu->r[30] = cpu->r[5];
         /* 020710A8 */ cpu->r[31] = cpu->r[3];
-        /* 020710A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020710A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020710AC */ _t3 = cpu->r[1] + 0x0000000Cu;
         /* 020710AC */ rbrew_write32(cpu->mem, _t3, cpu->r[29]);
         /* 020710B0 */ _t4 = cpu->r[1] + 0x0000001Cu;
         /* 020710B0 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 020710B4 */ cpu->r[29] = cpu->r[4];
-        /* 020710B8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020710B8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020710B8 */ _t6 = _t5 & 0x00000001u;
         /* 020710B8 */ if (_t6) goto L_020710BC; else goto L_020710CC;
   L_020710BC: ; // 0x20710bc
         /* 020710BC */ cpu->r[3] = 0x0000003Cu;
         /* 020710C0 */ Gambit_fn_02801A78(cpu);
         /* 020710C4 */ cpu->r[31] = cpu->r[3];
-        /* 020710C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020710C8 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020710C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020710C8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020710C8 */ _t8 = _t7 & 0x00000001u;
         /* 020710C8 */ if (_t8) goto L_02071140; else goto L_020710CC;
   L_020710CC: ; // 0x20710cc
@@ -17178,8 +17178,8 @@ void Gambit_fn_02071098(CPUState* cpu) {
         /* 02071120 */ _t16 = cpu->r[31] + 0x00000028u;
         /* 02071120 */ rbrew_write32(cpu->mem, _t16, cpu->r[10]);
         /* 02071124 */ Gambit_fn_02801A78(cpu);
-        /* 02071128 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207112C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071128 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207112C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207112C */ _t18 = _t17 & 0x00000001u;
         /* 0207112C */ if (_t18) goto L_02071134; else goto L_02071130;
   L_02071130: ; // 0x2071130
@@ -17225,8 +17225,8 @@ void Gambit_fn_02071104(CPUState* cpu) {
         /* 02071120 */ _t5 = cpu->r[31] + 0x00000028u;
         /* 02071120 */ rbrew_write32(cpu->mem, _t5, cpu->r[10]);
         /* 02071124 */ Gambit_fn_02801A78(cpu);
-        /* 02071128 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207112C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071128 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207112C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207112C */ _t7 = _t6 & 0x00000001u;
         /* 0207112C */ if (_t7) goto L_02071134; else goto L_02071130;
   L_02071130: ; // 0x2071130
@@ -17287,15 +17287,15 @@ void Gambit_fn_02071174(CPUState* cpu) {
         /* 02071194 */ cpu->r[3] = rbrew_read32(cpu->mem, _t2);
         /* 02071198 */ cpu->r[4] = cpu->r[30];
         /* 0207119C */ Gambit_fn_02072728(cpu);
-        /* 020711A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020711A4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020711A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020711A4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020711A4 */ _t4 = _t3 & 0x00000001u;
         /* 020711A4 */ if (_t4) goto L_020711A8; else goto L_02071554;
   L_020711A8: ; // 0x20711a8
         /* 020711A8 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 020711A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020711A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020711AC */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020711B0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020711B0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020711B0 */ _t6 = _t5 & 0x00000001u;
         /* 020711B0 */ if (_t6) goto L_020711B4; else goto L_02071194;
   L_020711B4: ; // 0x20711b4
@@ -17304,8 +17304,8 @@ void Gambit_fn_02071174(CPUState* cpu) {
         /* 020711B8 */ _t8 = cpu->r[3] + 0x000004D8u;
         /* 020711B8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t8);
         /* 020711BC */ cpu->r[30] = 0x00000000u;
-        /* 020711C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[5]);
-        /* 020711C4 */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020711C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[5]));
+        /* 020711C4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020711C4 */ _t10 = _t9 & 0x00000001u;
         /* 020711C4 */ if (_t10) goto L_020711C8; else goto L_020713B8;
   L_020711C8: ; // 0x20711c8
@@ -17318,13 +17318,13 @@ void Gambit_fn_02071174(CPUState* cpu) {
   L_020711DC: ; // 0x20711dc
         /* 020711DC */ _t12 = cpu->r[29] + 0x000004D8u;
         /* 020711DC */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 020711E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
-        /* 020711E4 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020711E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
+        /* 020711E4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020711E4 */ _t14 = _t13 & 0x00000001u;
         /* 020711E4 */ if (_t14) goto L_020711E8; else goto L_02071308;
   L_020711E8: ; // 0x20711e8
-        /* 020711E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000008u);
-        /* 020711EC */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020711E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000008u));
+        /* 020711EC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020711EC */ _t16 = _t15 & 0x00000001u;
         /* 020711EC */ if (_t16) goto L_020711F0; else goto L_020711F4;
   L_020711F0: ; // 0x20711f0
@@ -17333,10 +17333,10 @@ void Gambit_fn_02071174(CPUState* cpu) {
         /* 020711F4 */ _t17 = cpu->r[3] + 0x00000018u;
         /* 020711F4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t17);
         /* 020711F8 */ cpu->r[23] = cpu->r[3] + 0x00000014u;
-        /* 020711FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000008u);
+        /* 020711FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000008u));
         /* 02071200 */ _t18 = cpu->r[7] + 0x00000014u;
         /* 02071200 */ cpu->r[0] = rbrew_read32(cpu->mem, _t18);
-        /* 02071204 */ _t19 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071204 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02071204 */ _t20 = _t19 & 0x00000001u;
         /* 02071204 */ if (_t20) goto L_02071208; else goto L_02071258;
   L_02071208: ; // 0x2071208
@@ -17363,8 +17363,8 @@ void Gambit_fn_02071174(CPUState* cpu) {
         /* 02071244 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02071248 */ _t26 = cpu->r[22] + 0x00000014u;
         /* 02071248 */ cpu->r[0] = rbrew_read32(cpu->mem, _t26);
-        /* 0207124C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], cpu->r[0]);
-        /* 02071250 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207124C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], cpu->r[0]));
+        /* 02071250 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071250 */ _t28 = _t27 & 0x00000001u;
         /* 02071250 */ if (_t28) goto L_020712E0; else goto L_02071254;
   L_02071254: ; // 0x2071254
@@ -17392,8 +17392,8 @@ void Gambit_fn_02071174(CPUState* cpu) {
         /* 02071290 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02071294 */ _t34 = cpu->r[29] + 0x00000014u;
         /* 02071294 */ cpu->r[0] = rbrew_read32(cpu->mem, _t34);
-        /* 02071298 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], cpu->r[0]);
-        /* 0207129C */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071298 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], cpu->r[0]));
+        /* 0207129C */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207129C */ _t36 = _t35 & 0x00000001u;
         /* 0207129C */ if (_t36) goto L_020712E0; else goto L_020712A0;
   L_020712A0: ; // 0x20712a0
@@ -17411,13 +17411,13 @@ void Gambit_fn_02071174(CPUState* cpu) {
         /* 020712B8 */ _t40 = cpu->r[10] + 0x00000002u;
         /* 020712B8 */ cpu->r[8] = rbrew_read16(cpu->mem, _t40);
         /* 020712B8 */ cpu->r[10] = _t40;
-        /* 020712BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
-        /* 020712C0 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020712BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
+        /* 020712C0 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020712C0 */ _t42 = _t41 & 0x00000001u;
         /* 020712C0 */ if (_t42) goto L_020712C4; else goto L_020712D0;
   L_020712C4: ; // 0x20712c4
-        /* 020712C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020712C8 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020712C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020712C8 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020712C8 */ _t44 = _t43 & 0x00000001u;
         /* 020712C8 */ if (_t44) goto L_020712E0; else goto L_020712CC;
   L_020712CC: ; // 0x20712cc
@@ -17427,10 +17427,10 @@ void Gambit_fn_02071174(CPUState* cpu) {
         /* 020712CC */ _t47 = _t46 & 0x00000001u;
         /* 020712CC */ if (_t47) goto L_020712B4; else goto L_020712D0;
   L_020712D0: ; // 0x20712d0
-        /* 020712D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020712D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020712D4 */ _t48 = cpu->r[28] + 0x00000034u;
         /* 020712D4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t48);
-        /* 020712D8 */ _t49 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020712D8 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020712D8 */ _t50 = _t49 & 0x00000001u;
         /* 020712D8 */ if (_t50) goto L_020713B8; else goto L_020712DC;
   L_020712DC: ; // 0x20712dc
@@ -17441,32 +17441,32 @@ void Gambit_fn_02071174(CPUState* cpu) {
         /* 020712E4 */ _t52 = cpu->r[3] + 0x000004D8u;
         /* 020712E4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t52);
         /* 020712E8 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020712EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[9]);
+        /* 020712EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[9]));
         /* 020712F0 */ cpu->r[26] = cpu->r[26] + 0x00000090u;
-        /* 020712F4 */ _t53 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020712F4 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020712F4 */ _t54 = _t53 & 0x00000001u;
         /* 020712F4 */ if (_t54) goto L_020711DC; else goto L_020712F8;
   L_020712F8: ; // 0x20712f8
         /* 020712F8 */ _t55 = cpu->r[3] + 0x000004D8u;
         /* 020712F8 */ cpu->r[26] = rbrew_read32(cpu->mem, _t55);
-        /* 020712FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000008u);
-        /* 02071300 */ _t56 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020712FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000008u));
+        /* 02071300 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02071300 */ _t57 = _t56 & 0x00000001u;
         /* 02071300 */ if (_t57) goto L_02071304; else goto L_02071554;
   L_02071304: ; // 0x2071304
         /* 02071304 */ goto L_020713C4;
   L_02071308: ; // 0x2071308
-        /* 02071308 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0207130C */ _t58 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071308 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0207130C */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207130C */ _t59 = _t58 & 0x00000001u;
         /* 0207130C */ if (_t59) goto L_020713B8; else goto L_02071310;
   L_02071310: ; // 0x2071310
         /* 02071310 */ _t60 = cpu->r[3] + 0x000004D8u;
         /* 02071310 */ cpu->r[0] = rbrew_read32(cpu->mem, _t60);
         /* 02071314 */ cpu->r[31] = cpu->r[30];
-        /* 02071318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 02071318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 0207131C */ cpu->r[29] = 0x00000001u;
-        /* 02071320 */ _t61 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071320 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02071320 */ _t62 = _t61 & 0x00000001u;
         /* 02071320 */ if (_t62) goto L_02071324; else goto L_02071358;
   L_02071324: ; // 0x2071324
@@ -17474,8 +17474,8 @@ void Gambit_fn_02071174(CPUState* cpu) {
         /* 02071324 */ cpu->r[3] = rbrew_read32(cpu->mem, _t63);
         /* 02071328 */ cpu->r[4] = cpu->r[31];
         /* 0207132C */ Gambit_fn_020726B8(cpu);
-        /* 02071330 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02071334 */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071330 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02071334 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071334 */ _t65 = _t64 & 0x00000001u;
         /* 02071334 */ if (_t65) goto L_02071338; else goto L_0207133C;
   L_02071338: ; // 0x2071338
@@ -17486,21 +17486,21 @@ void Gambit_fn_02071174(CPUState* cpu) {
         /* 02071340 */ _t67 = cpu->r[3] + 0x000004D8u;
         /* 02071340 */ cpu->r[11] = rbrew_read32(cpu->mem, _t67);
         /* 02071344 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02071348 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
-        /* 0207134C */ _t68 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071348 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
+        /* 0207134C */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207134C */ _t69 = _t68 & 0x00000001u;
         /* 0207134C */ if (_t69) goto L_02071324; else goto L_02071350;
   L_02071350: ; // 0x2071350
-        /* 02071350 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02071354 */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071350 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02071354 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071354 */ _t71 = _t70 & 0x00000001u;
         /* 02071354 */ if (_t71) goto L_02071554; else goto L_02071358;
   L_02071358: ; // 0x2071358
         /* 02071358 */ _t72 = cpu->r[3] + 0x000004D8u;
         /* 02071358 */ cpu->r[0] = rbrew_read32(cpu->mem, _t72);
         /* 0207135C */ cpu->r[31] = cpu->r[30];
-        /* 02071360 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
-        /* 02071364 */ _t73 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071360 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
+        /* 02071364 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02071364 */ _t74 = _t73 & 0x00000001u;
         /* 02071364 */ if (_t74) goto L_02071368; else goto L_0207139C;
   L_02071368: ; // 0x2071368
@@ -17508,8 +17508,8 @@ void Gambit_fn_02071174(CPUState* cpu) {
         /* 02071368 */ cpu->r[3] = rbrew_read32(cpu->mem, _t75);
         /* 0207136C */ cpu->r[4] = cpu->r[31];
         /* 02071370 */ Gambit_fn_020726B8(cpu);
-        /* 02071374 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02071378 */ _t76 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071374 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02071378 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071378 */ _t77 = _t76 & 0x00000001u;
         /* 02071378 */ if (_t77) goto L_02071388; else goto L_0207137C;
   L_0207137C: ; // 0x207137c
@@ -17523,8 +17523,8 @@ void Gambit_fn_02071174(CPUState* cpu) {
         /* 0207138C */ _t80 = cpu->r[3] + 0x000004D8u;
         /* 0207138C */ cpu->r[5] = rbrew_read32(cpu->mem, _t80);
         /* 02071390 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02071394 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
-        /* 02071398 */ _t81 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071394 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
+        /* 02071398 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02071398 */ _t82 = _t81 & 0x00000001u;
         /* 02071398 */ if (_t82) goto L_02071368; else goto L_0207139C;
   L_0207139C: ; // 0x207139c
@@ -17539,15 +17539,15 @@ void Gambit_fn_02071174(CPUState* cpu) {
   L_020713B8: ; // 0x20713b8
         /* 020713B8 */ _t84 = cpu->r[3] + 0x000004D8u;
         /* 020713B8 */ cpu->r[26] = rbrew_read32(cpu->mem, _t84);
-        /* 020713BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000008u);
-        /* 020713C0 */ _t85 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020713BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000008u));
+        /* 020713C0 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020713C0 */ _t86 = _t85 & 0x00000001u;
         /* 020713C0 */ if (_t86) goto L_020713C4; else goto L_02071554;
   L_020713C4: ; // 0x20713c4
         /* 020713C4 */ _t87 = cpu->r[29] + 0x000004D8u;
         /* 020713C4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t87);
-        /* 020713C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[0]);
-        /* 020713CC */ _t88 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020713C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[0]));
+        /* 020713CC */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020713CC */ _t89 = _t88 & 0x00000001u;
         /* 020713CC */ if (_t89) goto L_020713D0; else goto L_02071554;
   L_020713D0: ; // 0x20713d0
@@ -17555,45 +17555,45 @@ void Gambit_fn_02071174(CPUState* cpu) {
         /* 020713D0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t90);
         /* 020713D4 */ cpu->r[4] = cpu->r[26];
         /* 020713D8 */ Gambit_fn_02072668(cpu);
-        /* 020713DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020713E0 */ _t91 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020713DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020713E0 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020713E0 */ _t92 = _t91 & 0x00000001u;
         /* 020713E0 */ if (_t92) goto L_02071554; else goto L_020713E4;
   L_020713E4: ; // 0x20713e4
-        /* 020713E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000008u);
-        /* 020713E8 */ _t93 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020713E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000008u));
+        /* 020713E8 */ _t93 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020713E8 */ _t94 = _t93 & 0x00000001u;
         /* 020713E8 */ if (_t94) goto L_020713EC; else goto L_02071404;
   L_020713EC: ; // 0x20713ec
         /* 020713EC */ cpu->r[8] = (uint32_t)((int32_t)cpu->r[26] * (int32_t)0x00000090u);
         /* 020713F0 */ cpu->r[4] = cpu->r[29] + cpu->r[8];
-        /* 020713F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000008u);
+        /* 020713F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000008u));
         /* 020713F8 */ cpu->r[24] = cpu->r[4] + 0x00000014u;
-        /* 020713FC */ _t95 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020713FC */ _t95 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020713FC */ _t96 = _t95 & 0x00000001u;
         /* 020713FC */ if (_t96) goto L_02071410; else goto L_02071400;
   L_02071400: ; // 0x2071400
         /* 02071400 */ goto L_02071428;
   L_02071404: ; // 0x2071404
-        /* 02071404 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000008u);
+        /* 02071404 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000008u));
         /* 02071408 */ cpu->r[24] = cpu->r[29] + 0x00000014u;
-        /* 0207140C */ _t97 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207140C */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207140C */ _t98 = _t97 & 0x00000001u;
         /* 0207140C */ if (_t98) goto L_02071410; else goto L_02071428;
   L_02071410: ; // 0x2071410
         /* 02071410 */ cpu->r[9] = (uint32_t)((int32_t)cpu->r[26] * (int32_t)0x00000090u);
         /* 02071414 */ cpu->r[4] = cpu->r[29] + cpu->r[9];
-        /* 02071418 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000008u);
+        /* 02071418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000008u));
         /* 0207141C */ cpu->r[25] = cpu->r[4] + 0x00000044u;
-        /* 02071420 */ _t99 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071420 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02071420 */ _t100 = _t99 & 0x00000001u;
         /* 02071420 */ if (_t100) goto L_02071434; else goto L_02071424;
   L_02071424: ; // 0x2071424
         /* 02071424 */ goto L_020714A0;
   L_02071428: ; // 0x2071428
-        /* 02071428 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000008u);
+        /* 02071428 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000008u));
         /* 0207142C */ cpu->r[25] = cpu->r[29] + 0x00000044u;
-        /* 02071430 */ _t101 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071430 */ _t101 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02071430 */ _t102 = _t101 & 0x00000001u;
         /* 02071430 */ if (_t102) goto L_02071434; else goto L_020714A0;
   L_02071434: ; // 0x2071434
@@ -17631,10 +17631,10 @@ void Gambit_fn_02071174(CPUState* cpu) {
         /* 02071488 */ _t113 = cpu->r[3] + 0x00000000u;
         /* 02071488 */ cpu->r[4] = rbrew_read32(cpu->mem, _t113);
         /* 0207148C */ cpu->r[5] = 0x00000000u;
-        /* 02071490 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[27]);
+        /* 02071490 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[27]));
         /* 02071494 */ _t114 = cpu->r[1] + 0x0000000Cu;
         /* 02071494 */ cpu->r[0] = rbrew_read32(cpu->mem, _t114);
-        /* 02071498 */ _t115 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071498 */ _t115 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071498 */ _t116 = _t115 & 0x00000001u;
         /* 02071498 */ if (_t116) goto L_02071500; else goto L_0207149C;
   L_0207149C: ; // 0x207149c
@@ -17672,31 +17672,31 @@ void Gambit_fn_02071174(CPUState* cpu) {
         /* 020714EC */ _t127 = cpu->r[3] + 0x00000000u;
         /* 020714EC */ cpu->r[4] = rbrew_read32(cpu->mem, _t127);
         /* 020714F0 */ cpu->r[5] = 0x00000000u;
-        /* 020714F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[27]);
+        /* 020714F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[27]));
         /* 020714F8 */ _t128 = cpu->r[1] + 0x0000000Cu;
         /* 020714F8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t128);
-        /* 020714FC */ _t129 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020714FC */ _t129 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020714FC */ _t130 = _t129 & 0x00000001u;
         /* 020714FC */ if (_t130) goto L_02071500; else goto L_02071528;
   L_02071500: ; // 0x2071500
         /* 02071500 */ _t131 = cpu->r[3] + 0x00000004u;
         /* 02071500 */ cpu->r[6] = rbrew_read32(cpu->mem, _t131);
-        /* 02071504 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[0]);
-        /* 02071508 */ _t132 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071504 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[0]));
+        /* 02071508 */ _t132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071508 */ _t133 = _t132 & 0x00000001u;
         /* 02071508 */ if (_t133) goto L_0207150C; else goto L_02071528;
   L_0207150C: ; // 0x207150c
         /* 0207150C */ _t134 = cpu->r[3] + 0x00000008u;
         /* 0207150C */ cpu->r[7] = rbrew_read8(cpu->mem, _t134);
-        /* 02071510 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[30]);
-        /* 02071514 */ _t135 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071510 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[30]));
+        /* 02071514 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071514 */ _t136 = _t135 & 0x00000001u;
         /* 02071514 */ if (_t136) goto L_02071518; else goto L_02071528;
   L_02071518: ; // 0x2071518
         /* 02071518 */ _t137 = cpu->r[3] + 0x00000009u;
         /* 02071518 */ cpu->r[8] = rbrew_read8(cpu->mem, _t137);
-        /* 0207151C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[31]);
-        /* 02071520 */ _t138 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207151C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[31]));
+        /* 02071520 */ _t138 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071520 */ _t139 = _t138 & 0x00000001u;
         /* 02071520 */ if (_t139) goto L_02071524; else goto L_02071528;
   L_02071524: ; // 0x2071524
@@ -17707,8 +17707,8 @@ void Gambit_fn_02071174(CPUState* cpu) {
         /* 0207152C */ cpu->r[5] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x00000018u, 0x0000001Fu);
         /* 02071530 */ cpu->r[4] = cpu->r[26];
         /* 02071534 */ Gambit_fn_020724E8(cpu);
-        /* 02071538 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000008u);
-        /* 0207153C */ _t141 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071538 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000008u));
+        /* 0207153C */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207153C */ _t142 = _t141 & 0x00000001u;
         /* 0207153C */ if (_t142) goto L_02071540; else goto L_02071548;
   L_02071540: ; // 0x2071540
@@ -17748,15 +17748,15 @@ void Gambit_fn_02071178(CPUState* cpu) {
         /* 02071194 */ cpu->r[3] = rbrew_read32(cpu->mem, _t2);
         /* 02071198 */ cpu->r[4] = cpu->r[30];
         /* 0207119C */ Gambit_fn_02072728(cpu);
-        /* 020711A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020711A4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020711A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020711A4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020711A4 */ _t4 = _t3 & 0x00000001u;
         /* 020711A4 */ if (_t4) goto L_020711A8; else goto L_02071554;
   L_020711A8: ; // 0x20711a8
         /* 020711A8 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 020711A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020711A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020711AC */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020711B0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020711B0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020711B0 */ _t6 = _t5 & 0x00000001u;
         /* 020711B0 */ if (_t6) goto L_020711B4; else goto L_02071194;
   L_020711B4: ; // 0x20711b4
@@ -17765,8 +17765,8 @@ void Gambit_fn_02071178(CPUState* cpu) {
         /* 020711B8 */ _t8 = cpu->r[3] + 0x000004D8u;
         /* 020711B8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t8);
         /* 020711BC */ cpu->r[30] = 0x00000000u;
-        /* 020711C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[5]);
-        /* 020711C4 */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020711C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[5]));
+        /* 020711C4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020711C4 */ _t10 = _t9 & 0x00000001u;
         /* 020711C4 */ if (_t10) goto L_020711C8; else goto L_020713B8;
   L_020711C8: ; // 0x20711c8
@@ -17779,13 +17779,13 @@ void Gambit_fn_02071178(CPUState* cpu) {
   L_020711DC: ; // 0x20711dc
         /* 020711DC */ _t12 = cpu->r[29] + 0x000004D8u;
         /* 020711DC */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 020711E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
-        /* 020711E4 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020711E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
+        /* 020711E4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020711E4 */ _t14 = _t13 & 0x00000001u;
         /* 020711E4 */ if (_t14) goto L_020711E8; else goto L_02071308;
   L_020711E8: ; // 0x20711e8
-        /* 020711E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000008u);
-        /* 020711EC */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020711E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000008u));
+        /* 020711EC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020711EC */ _t16 = _t15 & 0x00000001u;
         /* 020711EC */ if (_t16) goto L_020711F0; else goto L_020711F4;
   L_020711F0: ; // 0x20711f0
@@ -17794,10 +17794,10 @@ void Gambit_fn_02071178(CPUState* cpu) {
         /* 020711F4 */ _t17 = cpu->r[3] + 0x00000018u;
         /* 020711F4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t17);
         /* 020711F8 */ cpu->r[23] = cpu->r[3] + 0x00000014u;
-        /* 020711FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000008u);
+        /* 020711FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000008u));
         /* 02071200 */ _t18 = cpu->r[7] + 0x00000014u;
         /* 02071200 */ cpu->r[0] = rbrew_read32(cpu->mem, _t18);
-        /* 02071204 */ _t19 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071204 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02071204 */ _t20 = _t19 & 0x00000001u;
         /* 02071204 */ if (_t20) goto L_02071208; else goto L_02071258;
   L_02071208: ; // 0x2071208
@@ -17824,8 +17824,8 @@ void Gambit_fn_02071178(CPUState* cpu) {
         /* 02071244 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02071248 */ _t26 = cpu->r[22] + 0x00000014u;
         /* 02071248 */ cpu->r[0] = rbrew_read32(cpu->mem, _t26);
-        /* 0207124C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], cpu->r[0]);
-        /* 02071250 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207124C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], cpu->r[0]));
+        /* 02071250 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071250 */ _t28 = _t27 & 0x00000001u;
         /* 02071250 */ if (_t28) goto L_020712E0; else goto L_02071254;
   L_02071254: ; // 0x2071254
@@ -17853,8 +17853,8 @@ void Gambit_fn_02071178(CPUState* cpu) {
         /* 02071290 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02071294 */ _t34 = cpu->r[29] + 0x00000014u;
         /* 02071294 */ cpu->r[0] = rbrew_read32(cpu->mem, _t34);
-        /* 02071298 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], cpu->r[0]);
-        /* 0207129C */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071298 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], cpu->r[0]));
+        /* 0207129C */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207129C */ _t36 = _t35 & 0x00000001u;
         /* 0207129C */ if (_t36) goto L_020712E0; else goto L_020712A0;
   L_020712A0: ; // 0x20712a0
@@ -17872,13 +17872,13 @@ void Gambit_fn_02071178(CPUState* cpu) {
         /* 020712B8 */ _t40 = cpu->r[10] + 0x00000002u;
         /* 020712B8 */ cpu->r[8] = rbrew_read16(cpu->mem, _t40);
         /* 020712B8 */ cpu->r[10] = _t40;
-        /* 020712BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
-        /* 020712C0 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020712BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
+        /* 020712C0 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020712C0 */ _t42 = _t41 & 0x00000001u;
         /* 020712C0 */ if (_t42) goto L_020712C4; else goto L_020712D0;
   L_020712C4: ; // 0x20712c4
-        /* 020712C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020712C8 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020712C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020712C8 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020712C8 */ _t44 = _t43 & 0x00000001u;
         /* 020712C8 */ if (_t44) goto L_020712E0; else goto L_020712CC;
   L_020712CC: ; // 0x20712cc
@@ -17888,10 +17888,10 @@ void Gambit_fn_02071178(CPUState* cpu) {
         /* 020712CC */ _t47 = _t46 & 0x00000001u;
         /* 020712CC */ if (_t47) goto L_020712B4; else goto L_020712D0;
   L_020712D0: ; // 0x20712d0
-        /* 020712D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020712D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020712D4 */ _t48 = cpu->r[28] + 0x00000034u;
         /* 020712D4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t48);
-        /* 020712D8 */ _t49 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020712D8 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020712D8 */ _t50 = _t49 & 0x00000001u;
         /* 020712D8 */ if (_t50) goto L_020713B8; else goto L_020712DC;
   L_020712DC: ; // 0x20712dc
@@ -17902,32 +17902,32 @@ void Gambit_fn_02071178(CPUState* cpu) {
         /* 020712E4 */ _t52 = cpu->r[3] + 0x000004D8u;
         /* 020712E4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t52);
         /* 020712E8 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020712EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[9]);
+        /* 020712EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[9]));
         /* 020712F0 */ cpu->r[26] = cpu->r[26] + 0x00000090u;
-        /* 020712F4 */ _t53 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020712F4 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020712F4 */ _t54 = _t53 & 0x00000001u;
         /* 020712F4 */ if (_t54) goto L_020711DC; else goto L_020712F8;
   L_020712F8: ; // 0x20712f8
         /* 020712F8 */ _t55 = cpu->r[3] + 0x000004D8u;
         /* 020712F8 */ cpu->r[26] = rbrew_read32(cpu->mem, _t55);
-        /* 020712FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000008u);
-        /* 02071300 */ _t56 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020712FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000008u));
+        /* 02071300 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02071300 */ _t57 = _t56 & 0x00000001u;
         /* 02071300 */ if (_t57) goto L_02071304; else goto L_02071554;
   L_02071304: ; // 0x2071304
         /* 02071304 */ goto L_020713C4;
   L_02071308: ; // 0x2071308
-        /* 02071308 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0207130C */ _t58 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071308 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0207130C */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207130C */ _t59 = _t58 & 0x00000001u;
         /* 0207130C */ if (_t59) goto L_020713B8; else goto L_02071310;
   L_02071310: ; // 0x2071310
         /* 02071310 */ _t60 = cpu->r[3] + 0x000004D8u;
         /* 02071310 */ cpu->r[0] = rbrew_read32(cpu->mem, _t60);
         /* 02071314 */ cpu->r[31] = cpu->r[30];
-        /* 02071318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 02071318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 0207131C */ cpu->r[29] = 0x00000001u;
-        /* 02071320 */ _t61 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071320 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02071320 */ _t62 = _t61 & 0x00000001u;
         /* 02071320 */ if (_t62) goto L_02071324; else goto L_02071358;
   L_02071324: ; // 0x2071324
@@ -17935,8 +17935,8 @@ void Gambit_fn_02071178(CPUState* cpu) {
         /* 02071324 */ cpu->r[3] = rbrew_read32(cpu->mem, _t63);
         /* 02071328 */ cpu->r[4] = cpu->r[31];
         /* 0207132C */ Gambit_fn_020726B8(cpu);
-        /* 02071330 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02071334 */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071330 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02071334 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071334 */ _t65 = _t64 & 0x00000001u;
         /* 02071334 */ if (_t65) goto L_02071338; else goto L_0207133C;
   L_02071338: ; // 0x2071338
@@ -17947,21 +17947,21 @@ void Gambit_fn_02071178(CPUState* cpu) {
         /* 02071340 */ _t67 = cpu->r[3] + 0x000004D8u;
         /* 02071340 */ cpu->r[11] = rbrew_read32(cpu->mem, _t67);
         /* 02071344 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02071348 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
-        /* 0207134C */ _t68 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071348 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
+        /* 0207134C */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207134C */ _t69 = _t68 & 0x00000001u;
         /* 0207134C */ if (_t69) goto L_02071324; else goto L_02071350;
   L_02071350: ; // 0x2071350
-        /* 02071350 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02071354 */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071350 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02071354 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071354 */ _t71 = _t70 & 0x00000001u;
         /* 02071354 */ if (_t71) goto L_02071554; else goto L_02071358;
   L_02071358: ; // 0x2071358
         /* 02071358 */ _t72 = cpu->r[3] + 0x000004D8u;
         /* 02071358 */ cpu->r[0] = rbrew_read32(cpu->mem, _t72);
         /* 0207135C */ cpu->r[31] = cpu->r[30];
-        /* 02071360 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
-        /* 02071364 */ _t73 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071360 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
+        /* 02071364 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02071364 */ _t74 = _t73 & 0x00000001u;
         /* 02071364 */ if (_t74) goto L_02071368; else goto L_0207139C;
   L_02071368: ; // 0x2071368
@@ -17969,8 +17969,8 @@ void Gambit_fn_02071178(CPUState* cpu) {
         /* 02071368 */ cpu->r[3] = rbrew_read32(cpu->mem, _t75);
         /* 0207136C */ cpu->r[4] = cpu->r[31];
         /* 02071370 */ Gambit_fn_020726B8(cpu);
-        /* 02071374 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02071378 */ _t76 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071374 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02071378 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071378 */ _t77 = _t76 & 0x00000001u;
         /* 02071378 */ if (_t77) goto L_02071388; else goto L_0207137C;
   L_0207137C: ; // 0x207137c
@@ -17984,8 +17984,8 @@ void Gambit_fn_02071178(CPUState* cpu) {
         /* 0207138C */ _t80 = cpu->r[3] + 0x000004D8u;
         /* 0207138C */ cpu->r[5] = rbrew_read32(cpu->mem, _t80);
         /* 02071390 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02071394 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
-        /* 02071398 */ _t81 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071394 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
+        /* 02071398 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02071398 */ _t82 = _t81 & 0x00000001u;
         /* 02071398 */ if (_t82) goto L_02071368; else goto L_0207139C;
   L_0207139C: ; // 0x207139c
@@ -18000,15 +18000,15 @@ void Gambit_fn_02071178(CPUState* cpu) {
   L_020713B8: ; // 0x20713b8
         /* 020713B8 */ _t84 = cpu->r[3] + 0x000004D8u;
         /* 020713B8 */ cpu->r[26] = rbrew_read32(cpu->mem, _t84);
-        /* 020713BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000008u);
-        /* 020713C0 */ _t85 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020713BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000008u));
+        /* 020713C0 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020713C0 */ _t86 = _t85 & 0x00000001u;
         /* 020713C0 */ if (_t86) goto L_020713C4; else goto L_02071554;
   L_020713C4: ; // 0x20713c4
         /* 020713C4 */ _t87 = cpu->r[29] + 0x000004D8u;
         /* 020713C4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t87);
-        /* 020713C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[0]);
-        /* 020713CC */ _t88 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020713C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[0]));
+        /* 020713CC */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020713CC */ _t89 = _t88 & 0x00000001u;
         /* 020713CC */ if (_t89) goto L_020713D0; else goto L_02071554;
   L_020713D0: ; // 0x20713d0
@@ -18016,45 +18016,45 @@ void Gambit_fn_02071178(CPUState* cpu) {
         /* 020713D0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t90);
         /* 020713D4 */ cpu->r[4] = cpu->r[26];
         /* 020713D8 */ Gambit_fn_02072668(cpu);
-        /* 020713DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020713E0 */ _t91 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020713DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020713E0 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020713E0 */ _t92 = _t91 & 0x00000001u;
         /* 020713E0 */ if (_t92) goto L_02071554; else goto L_020713E4;
   L_020713E4: ; // 0x20713e4
-        /* 020713E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000008u);
-        /* 020713E8 */ _t93 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020713E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000008u));
+        /* 020713E8 */ _t93 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020713E8 */ _t94 = _t93 & 0x00000001u;
         /* 020713E8 */ if (_t94) goto L_020713EC; else goto L_02071404;
   L_020713EC: ; // 0x20713ec
         /* 020713EC */ cpu->r[8] = (uint32_t)((int32_t)cpu->r[26] * (int32_t)0x00000090u);
         /* 020713F0 */ cpu->r[4] = cpu->r[29] + cpu->r[8];
-        /* 020713F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000008u);
+        /* 020713F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000008u));
         /* 020713F8 */ cpu->r[24] = cpu->r[4] + 0x00000014u;
-        /* 020713FC */ _t95 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020713FC */ _t95 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020713FC */ _t96 = _t95 & 0x00000001u;
         /* 020713FC */ if (_t96) goto L_02071410; else goto L_02071400;
   L_02071400: ; // 0x2071400
         /* 02071400 */ goto L_02071428;
   L_02071404: ; // 0x2071404
-        /* 02071404 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000008u);
+        /* 02071404 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000008u));
         /* 02071408 */ cpu->r[24] = cpu->r[29] + 0x00000014u;
-        /* 0207140C */ _t97 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207140C */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207140C */ _t98 = _t97 & 0x00000001u;
         /* 0207140C */ if (_t98) goto L_02071410; else goto L_02071428;
   L_02071410: ; // 0x2071410
         /* 02071410 */ cpu->r[9] = (uint32_t)((int32_t)cpu->r[26] * (int32_t)0x00000090u);
         /* 02071414 */ cpu->r[4] = cpu->r[29] + cpu->r[9];
-        /* 02071418 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000008u);
+        /* 02071418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000008u));
         /* 0207141C */ cpu->r[25] = cpu->r[4] + 0x00000044u;
-        /* 02071420 */ _t99 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071420 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02071420 */ _t100 = _t99 & 0x00000001u;
         /* 02071420 */ if (_t100) goto L_02071434; else goto L_02071424;
   L_02071424: ; // 0x2071424
         /* 02071424 */ goto L_020714A0;
   L_02071428: ; // 0x2071428
-        /* 02071428 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000008u);
+        /* 02071428 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000008u));
         /* 0207142C */ cpu->r[25] = cpu->r[29] + 0x00000044u;
-        /* 02071430 */ _t101 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071430 */ _t101 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02071430 */ _t102 = _t101 & 0x00000001u;
         /* 02071430 */ if (_t102) goto L_02071434; else goto L_020714A0;
   L_02071434: ; // 0x2071434
@@ -18092,10 +18092,10 @@ void Gambit_fn_02071178(CPUState* cpu) {
         /* 02071488 */ _t113 = cpu->r[3] + 0x00000000u;
         /* 02071488 */ cpu->r[4] = rbrew_read32(cpu->mem, _t113);
         /* 0207148C */ cpu->r[5] = 0x00000000u;
-        /* 02071490 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[27]);
+        /* 02071490 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[27]));
         /* 02071494 */ _t114 = cpu->r[1] + 0x0000000Cu;
         /* 02071494 */ cpu->r[0] = rbrew_read32(cpu->mem, _t114);
-        /* 02071498 */ _t115 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071498 */ _t115 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071498 */ _t116 = _t115 & 0x00000001u;
         /* 02071498 */ if (_t116) goto L_02071500; else goto L_0207149C;
   L_0207149C: ; // 0x207149c
@@ -18133,31 +18133,31 @@ void Gambit_fn_02071178(CPUState* cpu) {
         /* 020714EC */ _t127 = cpu->r[3] + 0x00000000u;
         /* 020714EC */ cpu->r[4] = rbrew_read32(cpu->mem, _t127);
         /* 020714F0 */ cpu->r[5] = 0x00000000u;
-        /* 020714F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[27]);
+        /* 020714F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[27]));
         /* 020714F8 */ _t128 = cpu->r[1] + 0x0000000Cu;
         /* 020714F8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t128);
-        /* 020714FC */ _t129 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020714FC */ _t129 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020714FC */ _t130 = _t129 & 0x00000001u;
         /* 020714FC */ if (_t130) goto L_02071500; else goto L_02071528;
   L_02071500: ; // 0x2071500
         /* 02071500 */ _t131 = cpu->r[3] + 0x00000004u;
         /* 02071500 */ cpu->r[6] = rbrew_read32(cpu->mem, _t131);
-        /* 02071504 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[0]);
-        /* 02071508 */ _t132 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071504 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[0]));
+        /* 02071508 */ _t132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071508 */ _t133 = _t132 & 0x00000001u;
         /* 02071508 */ if (_t133) goto L_0207150C; else goto L_02071528;
   L_0207150C: ; // 0x207150c
         /* 0207150C */ _t134 = cpu->r[3] + 0x00000008u;
         /* 0207150C */ cpu->r[7] = rbrew_read8(cpu->mem, _t134);
-        /* 02071510 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[30]);
-        /* 02071514 */ _t135 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071510 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[30]));
+        /* 02071514 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071514 */ _t136 = _t135 & 0x00000001u;
         /* 02071514 */ if (_t136) goto L_02071518; else goto L_02071528;
   L_02071518: ; // 0x2071518
         /* 02071518 */ _t137 = cpu->r[3] + 0x00000009u;
         /* 02071518 */ cpu->r[8] = rbrew_read8(cpu->mem, _t137);
-        /* 0207151C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[31]);
-        /* 02071520 */ _t138 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207151C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[31]));
+        /* 02071520 */ _t138 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071520 */ _t139 = _t138 & 0x00000001u;
         /* 02071520 */ if (_t139) goto L_02071524; else goto L_02071528;
   L_02071524: ; // 0x2071524
@@ -18168,8 +18168,8 @@ void Gambit_fn_02071178(CPUState* cpu) {
         /* 0207152C */ cpu->r[5] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x00000018u, 0x0000001Fu);
         /* 02071530 */ cpu->r[4] = cpu->r[26];
         /* 02071534 */ Gambit_fn_020724E8(cpu);
-        /* 02071538 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000008u);
-        /* 0207153C */ _t141 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071538 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000008u));
+        /* 0207153C */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207153C */ _t142 = _t141 & 0x00000001u;
         /* 0207153C */ if (_t142) goto L_02071540; else goto L_02071548;
   L_02071540: ; // 0x2071540
@@ -18253,7 +18253,7 @@ void Gambit_fn_02071568(CPUState* cpu) {
         /* 020729A4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t15);
         /* 020729A8 */ _t16 = cpu->r[1] + 0x00000010u;
         /* 020729A8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t16);
-        /* 020729AC */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020729AC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020729AC */ _t18 = _t17 & 0x00000001u;
         /* 020729AC */ if (_t18) goto L_020729B0; // else: addr-0 trap, fall-through
   L_020729B0: ; // 0x20729b0
@@ -18323,10 +18323,10 @@ void Gambit_fn_02071570(CPUState* cpu) {
   L_02072A50: ; // 0x2072a50
         /* 02072A50 */ _t11 = cpu->r[26] + 0x0000021Cu;
         /* 02072A50 */ cpu->r[0] = rbrew_read32(cpu->mem, _t11);
-        /* 02072A54 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[0]);
+        /* 02072A54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[0]));
         /* 02072A58 */ _t12 = cpu->r[26] + 0x00000220u;
         /* 02072A58 */ cpu->r[12] = rbrew_read32(cpu->mem, _t12);
-        /* 02072A5C */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02072A5C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02072A5C */ _t14 = _t13 & 0x00000001u;
         /* 02072A5C */ if (_t14) goto L_02072A60; else goto L_02072A64;
   L_02072A60: ; // 0x2072a60
@@ -18343,10 +18343,10 @@ void Gambit_fn_02071570(CPUState* cpu) {
         /* 02072A78 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 02072A7C */ Gambit_fn_027ED2B0(cpu);
         /* 02072A80 */ cpu->r[27] = cpu->r[27] + 0xFFFFFFFFu;
-        /* 02072A80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02072A80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02072A84 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
         /* 02072A88 */ cpu->r[29] = cpu->r[29] + 0x00000004u;
-        /* 02072A8C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072A8C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072A8C */ _t19 = _t18 & 0x00000001u;
         /* 02072A8C */ if (_t19) goto L_02072A90; else goto L_02072A50;
   L_02072A90: ; // 0x2072a90
@@ -18355,7 +18355,7 @@ void Gambit_fn_02071570(CPUState* cpu) {
         /* 02072A94 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t20);
         /* 02072A98 */ _t21 = cpu->r[1] + 0x00000030u;
         /* 02072A98 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t21);
-        /* 02072A9C */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02072A9C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02072A9C */ _t23 = _t22 & 0x00000001u;
         /* 02072A9C */ if (_t23) goto L_02072AA0; // else: addr-0 trap, fall-through
   L_02072AA0: ; // 0x2072aa0
@@ -18394,16 +18394,16 @@ void Gambit_fn_02071578(CPUState* cpu) {
         /* 020715A4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t6);
         /* 020715A8 */ cpu->r[4] = cpu->r[30];
         /* 020715AC */ Gambit_fn_020726B8(cpu);
-        /* 020715B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020715B4 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020715B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020715B4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020715B4 */ _t8 = _t7 & 0x00000001u;
         /* 020715B4 */ if (_t8) goto L_020715C8; else goto L_020715B8;
   L_020715B8: ; // 0x20715b8
         /* 020715B8 */ cpu->r[28] = cpu->r[28] + 0xFFFFFFFFu;
-        /* 020715B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 020715B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 020715BC */ cpu->r[30] = cpu->r[30] + 0x00000001u;
         /* 020715C0 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020715C4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020715C4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020715C4 */ _t10 = _t9 & 0x00000001u;
         /* 020715C4 */ if (_t10) goto L_020715C8; else goto L_020715A4;
   L_020715C8: ; // 0x20715c8
@@ -18450,16 +18450,16 @@ void Gambit_fn_0207157C(CPUState* cpu) {
         /* 020715A4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t6);
         /* 020715A8 */ cpu->r[4] = cpu->r[30];
         /* 020715AC */ Gambit_fn_020726B8(cpu);
-        /* 020715B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020715B4 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020715B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020715B4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020715B4 */ _t8 = _t7 & 0x00000001u;
         /* 020715B4 */ if (_t8) goto L_020715C8; else goto L_020715B8;
   L_020715B8: ; // 0x20715b8
         /* 020715B8 */ cpu->r[28] = cpu->r[28] + 0xFFFFFFFFu;
-        /* 020715B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 020715B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 020715BC */ cpu->r[30] = cpu->r[30] + 0x00000001u;
         /* 020715C0 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020715C4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020715C4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020715C4 */ _t10 = _t9 & 0x00000001u;
         /* 020715C4 */ if (_t10) goto L_020715C8; else goto L_020715A4;
   L_020715C8: ; // 0x20715c8
@@ -18502,15 +18502,15 @@ void Gambit_fn_020715EC(CPUState* cpu) {
         /* 02071614 */ cpu->r[3] = rbrew_read32(cpu->mem, _t2);
         /* 02071618 */ cpu->r[4] = cpu->r[30];
         /* 0207161C */ Gambit_fn_02072728(cpu);
-        /* 02071620 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02071624 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071620 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02071624 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071624 */ _t4 = _t3 & 0x00000001u;
         /* 02071624 */ if (_t4) goto L_02071628; else goto L_02071A54;
   L_02071628: ; // 0x2071628
         /* 02071628 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 02071628 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02071628 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0207162C */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02071630 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071630 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071630 */ _t6 = _t5 & 0x00000001u;
         /* 02071630 */ if (_t6) goto L_02071634; else goto L_02071614;
   L_02071634: ; // 0x2071634
@@ -18524,8 +18524,8 @@ void Gambit_fn_020715EC(CPUState* cpu) {
         /* 02071644 */ cpu->r[30] = cpu->r[26];
         /* 02071648 */ Gambit_fn_021402F8(cpu);
         /* 0207164C */ cpu->r[8] = cpu->r[26] + cpu->r[3];
-        /* 02071650 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[8]);
-        /* 02071654 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071650 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[8]));
+        /* 02071654 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02071654 */ _t11 = _t10 & 0x00000001u;
         /* 02071654 */ if (_t11) goto L_02071658; else goto L_020718F0;
   L_02071658: ; // 0x2071658
@@ -18543,8 +18543,8 @@ void Gambit_fn_020715EC(CPUState* cpu) {
         /* 02071678 */ _t14 = cpu->r[1] + 0x00000010u;
         /* 02071678 */ rbrew_write32(cpu->mem, _t14, cpu->r[0]);
         /* 0207167C */ Gambit_fn_021402F8(cpu);
-        /* 02071680 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[3]);
-        /* 02071684 */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071680 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[3]));
+        /* 02071684 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02071684 */ _t16 = _t15 & 0x00000001u;
         /* 02071684 */ if (_t16) goto L_02071688; else goto L_02071794;
   L_02071688: ; // 0x2071688
@@ -18592,8 +18592,8 @@ void Gambit_fn_020715EC(CPUState* cpu) {
         /* 020716FC */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02071700 */ _t29 = cpu->r[22] + 0x00000000u;
         /* 02071700 */ cpu->r[8] = rbrew_read32(cpu->mem, _t29);
-        /* 02071704 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], cpu->r[8]);
-        /* 02071708 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071704 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], cpu->r[8]));
+        /* 02071708 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071708 */ _t31 = _t30 & 0x00000001u;
         /* 02071708 */ if (_t31) goto L_02071748; else goto L_0207170C;
   L_0207170C: ; // 0x207170c
@@ -18611,13 +18611,13 @@ void Gambit_fn_020715EC(CPUState* cpu) {
         /* 02071724 */ _t35 = cpu->r[9] + 0x00000002u;
         /* 02071724 */ cpu->r[0] = rbrew_read16(cpu->mem, _t35);
         /* 02071724 */ cpu->r[9] = _t35;
-        /* 02071728 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[0]);
-        /* 0207172C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[0]));
+        /* 0207172C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207172C */ _t37 = _t36 & 0x00000001u;
         /* 0207172C */ if (_t37) goto L_02071730; else goto L_02071794;
   L_02071730: ; // 0x2071730
-        /* 02071730 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[31]);
-        /* 02071734 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071730 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[31]));
+        /* 02071734 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071734 */ _t39 = _t38 & 0x00000001u;
         /* 02071734 */ if (_t39) goto L_02071748; else goto L_02071738;
   L_02071738: ; // 0x2071738
@@ -18627,8 +18627,8 @@ void Gambit_fn_020715EC(CPUState* cpu) {
         /* 02071738 */ _t42 = _t41 & 0x00000001u;
         /* 02071738 */ if (_t42) goto L_02071720; else goto L_0207173C;
   L_0207173C: ; // 0x207173c
-        /* 0207173C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02071740 */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207173C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02071740 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02071740 */ _t44 = _t43 & 0x00000001u;
         /* 02071740 */ if (_t44) goto L_020718F0; else goto L_02071744;
   L_02071744: ; // 0x2071744
@@ -18645,8 +18645,8 @@ void Gambit_fn_020715EC(CPUState* cpu) {
         /* 0207175C */ rbrew_write32(cpu->mem, _t47, cpu->r[0]);
         /* 02071760 */ Gambit_fn_021402F8(cpu);
         /* 02071764 */ cpu->r[0] = cpu->r[26] + cpu->r[3];
-        /* 02071768 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
-        /* 0207176C */ _t48 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
+        /* 0207176C */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207176C */ _t49 = _t48 & 0x00000001u;
         /* 0207176C */ if (_t49) goto L_0207166C; else goto L_02071770;
   L_02071770: ; // 0x2071770
@@ -18659,15 +18659,15 @@ void Gambit_fn_020715EC(CPUState* cpu) {
         /* 0207177C */ rbrew_write32(cpu->mem, _t52, cpu->r[7]);
         /* 02071780 */ Gambit_fn_021402F8(cpu);
         /* 02071784 */ cpu->r[24] = cpu->r[26] + cpu->r[3];
-        /* 02071788 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000008u);
-        /* 0207178C */ _t53 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071788 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000008u));
+        /* 0207178C */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207178C */ _t54 = _t53 & 0x00000001u;
         /* 0207178C */ if (_t54) goto L_02071790; else goto L_02071A54;
   L_02071790: ; // 0x2071790
         /* 02071790 */ goto L_02071910;
   L_02071794: ; // 0x2071794
-        /* 02071794 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02071798 */ _t55 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071794 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02071798 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02071798 */ _t56 = _t55 & 0x00000001u;
         /* 02071798 */ if (_t56) goto L_020718F0; else goto L_0207179C;
   L_0207179C: ; // 0x207179c
@@ -18683,9 +18683,9 @@ void Gambit_fn_020715EC(CPUState* cpu) {
         /* 020717B4 */ cpu->r[25] = cpu->r[26] + cpu->r[3];
         /* 020717B8 */ cpu->r[29] = cpu->r[30];
         /* 020717BC */ cpu->r[31] = cpu->r[25] - cpu->r[30];
-        /* 020717C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[25]);
+        /* 020717C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[25]));
         /* 020717C4 */ cpu->r[23] = cpu->r[31];
-        /* 020717C8 */ _t60 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020717C8 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020717C8 */ _t61 = _t60 & 0x00000001u;
         /* 020717C8 */ if (_t61) goto L_020717CC; else goto L_020717F8;
   L_020717CC: ; // 0x20717cc
@@ -18693,22 +18693,22 @@ void Gambit_fn_020715EC(CPUState* cpu) {
         /* 020717CC */ cpu->r[3] = rbrew_read32(cpu->mem, _t62);
         /* 020717D0 */ cpu->r[4] = cpu->r[29];
         /* 020717D4 */ Gambit_fn_020726B8(cpu);
-        /* 020717D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020717DC */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020717D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020717DC */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020717DC */ _t64 = _t63 & 0x00000001u;
         /* 020717DC */ if (_t64) goto L_020717E0; else goto L_020717E4;
   L_020717E0: ; // 0x20717e0
         /* 020717E0 */ cpu->r[24] = 0x00000000u;
   L_020717E4: ; // 0x20717e4
         /* 020717E4 */ cpu->r[23] = cpu->r[23] + 0xFFFFFFFFu;
-        /* 020717E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
+        /* 020717E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
         /* 020717E8 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 020717EC */ _t65 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020717EC */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020717EC */ _t66 = _t65 & 0x00000001u;
         /* 020717EC */ if (_t66) goto L_020717F0; else goto L_020717CC;
   L_020717F0: ; // 0x20717f0
-        /* 020717F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 020717F4 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020717F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 020717F4 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020717F4 */ _t68 = _t67 & 0x00000001u;
         /* 020717F4 */ if (_t68) goto L_02071A54; else goto L_020717F8;
   L_020717F8: ; // 0x20717f8
@@ -18718,9 +18718,9 @@ void Gambit_fn_020715EC(CPUState* cpu) {
         /* 02071804 */ cpu->r[6] = cpu->r[6] + 0x00001F88u;
         /* 02071808 */ cpu->r[5] = 0x0000000Cu;
         /* 0207180C */ Gambit_fn_02C82E00(cpu);
-        /* 02071810 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[25]);
+        /* 02071810 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[25]));
         /* 02071814 */ cpu->r[29] = 0x00000000u;
-        /* 02071818 */ _t69 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071818 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02071818 */ _t70 = _t69 & 0x00000001u;
         /* 02071818 */ if (_t70) goto L_0207181C; else goto L_020718A4;
   L_0207181C: ; // 0x207181c
@@ -18738,7 +18738,7 @@ void Gambit_fn_020715EC(CPUState* cpu) {
         /* 02071838 */ Gambit_fn_02140324(cpu);
         /* 0207183C */ _t74 = cpu->r[3] + 0x0000000Cu;
         /* 0207183C */ cpu->r[8] = rbrew_read8(cpu->mem, _t74);
-        /* 02071840 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], 0x00000004u);
+        /* 02071840 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], 0x00000004u));
         /* 02071844 */ _t75 = cpu->r[3] + 0x00000008u;
         /* 02071844 */ cpu->r[11] = rbrew_read32(cpu->mem, _t75);
         /* 02071848 */ cpu->r[10] = cpu->r[1] + 0x00000028u;
@@ -18748,7 +18748,7 @@ void Gambit_fn_020715EC(CPUState* cpu) {
         /* 02071850 */ cpu->r[6] = rbrew_read8(cpu->mem, _t77);
         /* 02071854 */ _t78 = cpu->r[28] + 0x0000002Cu;
         /* 02071854 */ cpu->r[3] = rbrew_read32(cpu->mem, _t78);
-        /* 02071858 */ _t79 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071858 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02071858 */ _t80 = _t79 & 0x00000001u;
         /* 02071858 */ if (_t80) goto L_0207185C; else goto L_02071860;
   L_0207185C: ; // 0x207185c
@@ -18766,8 +18766,8 @@ void Gambit_fn_020715EC(CPUState* cpu) {
         /* 02071878 */ _t84 = cpu->r[10] + 0x00000009u;
         /* 02071878 */ rbrew_write8(cpu->mem, _t84, (uint8_t)cpu->r[6]);
         /* 0207187C */ Gambit_fn_020726B8(cpu);
-        /* 02071880 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02071884 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071880 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02071884 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071884 */ _t86 = _t85 & 0x00000001u;
         /* 02071884 */ if (_t86) goto L_02071894; else goto L_02071888;
   L_02071888: ; // 0x2071888
@@ -18777,26 +18777,26 @@ void Gambit_fn_020715EC(CPUState* cpu) {
         /* 02071890 */ Gambit_fn_020725F0(cpu);
   L_02071894: ; // 0x2071894
         /* 02071894 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 02071894 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02071894 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02071898 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
         /* 0207189C */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 020718A0 */ _t88 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020718A0 */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020718A0 */ _t89 = _t88 & 0x00000001u;
         /* 020718A0 */ if (_t89) goto L_020718A4; else goto L_02071824;
   L_020718A4: ; // 0x20718a4
-        /* 020718A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020718A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020718A8 */ cpu->r[31] = 0x00000000u;
-        /* 020718AC */ _t90 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020718AC */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020718AC */ _t91 = _t90 & 0x00000001u;
         /* 020718AC */ if (_t91) goto L_020718B0; else goto L_02071A54;
   L_020718B0: ; // 0x20718b0
         /* 020718B0 */ cpu->r[30] = cpu->r[1] + 0x00000028u;
   L_020718B4: ; // 0x20718b4
-        /* 020718B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], 0x00000004u);
+        /* 020718B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], 0x00000004u));
         /* 020718B8 */ cpu->r[4] = cpu->r[1] + 0x00000028u;
         /* 020718BC */ _t92 = cpu->r[28] + 0x00000034u;
         /* 020718BC */ cpu->r[3] = rbrew_read32(cpu->mem, _t92);
-        /* 020718C0 */ _t93 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020718C0 */ _t93 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020718C0 */ _t94 = _t93 & 0x00000001u;
         /* 020718C0 */ if (_t94) goto L_020718C4; else goto L_020718C8;
   L_020718C4: ; // 0x20718c4
@@ -18804,10 +18804,10 @@ void Gambit_fn_020715EC(CPUState* cpu) {
   L_020718C8: ; // 0x20718c8
         /* 020718C8 */ Gambit_fn_02140014(cpu);
         /* 020718CC */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 020718CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020718CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020718D0 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
         /* 020718D4 */ cpu->r[30] = cpu->r[30] + 0x0000000Cu;
-        /* 020718D8 */ _t95 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020718D8 */ _t95 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020718D8 */ _t96 = _t95 & 0x00000001u;
         /* 020718D8 */ if (_t96) goto L_020718DC; else goto L_020718B4;
   L_020718DC: ; // 0x20718dc
@@ -18827,8 +18827,8 @@ void Gambit_fn_020715EC(CPUState* cpu) {
         /* 020718FC */ rbrew_write32(cpu->mem, _t100, cpu->r[7]);
         /* 02071900 */ Gambit_fn_021402F8(cpu);
         /* 02071904 */ cpu->r[24] = cpu->r[26] + cpu->r[3];
-        /* 02071908 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000008u);
-        /* 0207190C */ _t101 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071908 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000008u));
+        /* 0207190C */ _t101 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207190C */ _t102 = _t101 & 0x00000001u;
         /* 0207190C */ if (_t102) goto L_02071910; else goto L_02071A54;
   L_02071910: ; // 0x2071910
@@ -18840,8 +18840,8 @@ void Gambit_fn_020715EC(CPUState* cpu) {
         /* 0207191C */ rbrew_write32(cpu->mem, _t104, cpu->r[8]);
         /* 02071920 */ Gambit_fn_021402F8(cpu);
         /* 02071924 */ cpu->r[0] = cpu->r[26] + cpu->r[3];
-        /* 02071928 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], cpu->r[0]);
-        /* 0207192C */ _t105 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02071928 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], cpu->r[0]));
+        /* 0207192C */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207192C */ _t106 = _t105 & 0x00000001u;
         /* 0207192C */ if (_t106) goto L_02071930; else goto L_02071A54;
   L_02071930: ; // 0x2071930
@@ -18850,8 +18850,8 @@ void Gambit_fn_020715EC(CPUState* cpu) {
         /* 02071934 */ cpu->r[4] = cpu->r[24];
         /* 02071938 */ cpu->r[31] = cpu->r[24] - cpu->r[26];
         /* 0207193C */ Gambit_fn_02072668(cpu);
-        /* 02071940 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02071944 */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02071944 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071944 */ _t109 = _t108 & 0x00000001u;
         /* 02071944 */ if (_t109) goto L_02071A54; else goto L_02071948;
   L_02071948: ; // 0x2071948
@@ -18913,31 +18913,31 @@ void Gambit_fn_020715EC(CPUState* cpu) {
         /* 020719E4 */ _t126 = cpu->r[3] + 0x00000000u;
         /* 020719E4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t126);
         /* 020719E8 */ cpu->r[0] = 0x00000000u;
-        /* 020719EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[26]);
+        /* 020719EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[26]));
         /* 020719F0 */ _t127 = cpu->r[1] + 0x0000005Cu;
         /* 020719F0 */ cpu->r[4] = rbrew_read32(cpu->mem, _t127);
-        /* 020719F4 */ _t128 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020719F4 */ _t128 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020719F4 */ _t129 = _t128 & 0x00000001u;
         /* 020719F4 */ if (_t129) goto L_020719F8; else goto L_02071A20;
   L_020719F8: ; // 0x20719f8
         /* 020719F8 */ _t130 = cpu->r[3] + 0x00000004u;
         /* 020719F8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t130);
-        /* 020719FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[4]);
-        /* 02071A00 */ _t131 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020719FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[4]));
+        /* 02071A00 */ _t131 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071A00 */ _t132 = _t131 & 0x00000001u;
         /* 02071A00 */ if (_t132) goto L_02071A04; else goto L_02071A20;
   L_02071A04: ; // 0x2071a04
         /* 02071A04 */ _t133 = cpu->r[3] + 0x00000008u;
         /* 02071A04 */ cpu->r[8] = rbrew_read8(cpu->mem, _t133);
-        /* 02071A08 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[29]);
-        /* 02071A0C */ _t134 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071A08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[29]));
+        /* 02071A0C */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071A0C */ _t135 = _t134 & 0x00000001u;
         /* 02071A0C */ if (_t135) goto L_02071A10; else goto L_02071A20;
   L_02071A10: ; // 0x2071a10
         /* 02071A10 */ _t136 = cpu->r[3] + 0x00000009u;
         /* 02071A10 */ cpu->r[9] = rbrew_read8(cpu->mem, _t136);
-        /* 02071A14 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[30]);
-        /* 02071A18 */ _t137 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071A14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[30]));
+        /* 02071A18 */ _t137 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071A18 */ _t138 = _t137 & 0x00000001u;
         /* 02071A18 */ if (_t138) goto L_02071A1C; else goto L_02071A20;
   L_02071A1C: ; // 0x2071a1c
@@ -18986,11 +18986,11 @@ void Gambit_fn_02071A68(CPUState* cpu) {
         /* 02071A7C */ cpu->r[30] = cpu->r[4];
         /* 02071A80 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02071A80 */ rbrew_write32(cpu->mem, _t3, cpu->r[29]);
-        /* 02071A84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02071A84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 02071A88 */ _t4 = cpu->r[1] + 0x00000024u;
         /* 02071A88 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 02071A8C */ cpu->r[29] = cpu->r[3];
-        /* 02071A90 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071A90 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071A90 */ _t6 = _t5 & 0x00000001u;
         /* 02071A90 */ if (_t6) goto L_02071A94; else goto L_02071AB0;
   L_02071A94: ; // 0x2071a94
@@ -19043,11 +19043,11 @@ void Gambit_fn_02071A6C(CPUState* cpu) {
         /* 02071A7C */ cpu->r[30] = cpu->r[4];
         /* 02071A80 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02071A80 */ rbrew_write32(cpu->mem, _t3, cpu->r[29]);
-        /* 02071A84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02071A84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 02071A88 */ _t4 = cpu->r[1] + 0x00000024u;
         /* 02071A88 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 02071A8C */ cpu->r[29] = cpu->r[3];
-        /* 02071A90 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071A90 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071A90 */ _t6 = _t5 & 0x00000001u;
         /* 02071A90 */ if (_t6) goto L_02071A94; else goto L_02071AB0;
   L_02071A94: ; // 0x2071a94
@@ -19112,16 +19112,16 @@ void Gambit_fn_02071AEC(CPUState* cpu) {
         /* 02071B18 */ cpu->r[3] = rbrew_read32(cpu->mem, _t6);
         /* 02071B1C */ cpu->r[4] = cpu->r[30];
         /* 02071B20 */ Gambit_fn_020726B8(cpu);
-        /* 02071B24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02071B28 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071B24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02071B28 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071B28 */ _t8 = _t7 & 0x00000001u;
         /* 02071B28 */ if (_t8) goto L_02071B3C; else goto L_02071B2C;
   L_02071B2C: ; // 0x2071b2c
         /* 02071B2C */ cpu->r[28] = cpu->r[28] + 0xFFFFFFFFu;
-        /* 02071B2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 02071B2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 02071B30 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
         /* 02071B34 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02071B38 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071B38 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071B38 */ _t10 = _t9 & 0x00000001u;
         /* 02071B38 */ if (_t10) goto L_02071B3C; else goto L_02071B18;
   L_02071B3C: ; // 0x2071b3c
@@ -19168,16 +19168,16 @@ void Gambit_fn_02071AF0(CPUState* cpu) {
         /* 02071B18 */ cpu->r[3] = rbrew_read32(cpu->mem, _t6);
         /* 02071B1C */ cpu->r[4] = cpu->r[30];
         /* 02071B20 */ Gambit_fn_020726B8(cpu);
-        /* 02071B24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02071B28 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071B24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02071B28 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071B28 */ _t8 = _t7 & 0x00000001u;
         /* 02071B28 */ if (_t8) goto L_02071B3C; else goto L_02071B2C;
   L_02071B2C: ; // 0x2071b2c
         /* 02071B2C */ cpu->r[28] = cpu->r[28] + 0xFFFFFFFFu;
-        /* 02071B2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 02071B2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 02071B30 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
         /* 02071B34 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02071B38 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071B38 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071B38 */ _t10 = _t9 & 0x00000001u;
         /* 02071B38 */ if (_t10) goto L_02071B3C; else goto L_02071B18;
   L_02071B3C: ; // 0x2071b3c
@@ -19225,16 +19225,16 @@ void Gambit_fn_02071B60(CPUState* cpu) {
         /* 02071B8C */ cpu->r[3] = rbrew_read32(cpu->mem, _t6);
         /* 02071B90 */ cpu->r[4] = cpu->r[30];
         /* 02071B94 */ Gambit_fn_020726B8(cpu);
-        /* 02071B98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02071B9C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071B98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02071B9C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071B9C */ _t8 = _t7 & 0x00000001u;
         /* 02071B9C */ if (_t8) goto L_02071BB0; else goto L_02071BA0;
   L_02071BA0: ; // 0x2071ba0
         /* 02071BA0 */ cpu->r[28] = cpu->r[28] + 0xFFFFFFFFu;
-        /* 02071BA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 02071BA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 02071BA4 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
         /* 02071BA8 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02071BAC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071BAC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071BAC */ _t10 = _t9 & 0x00000001u;
         /* 02071BAC */ if (_t10) goto L_02071BB0; else goto L_02071B8C;
   L_02071BB0: ; // 0x2071bb0
@@ -19281,16 +19281,16 @@ void Gambit_fn_02071B64(CPUState* cpu) {
         /* 02071B8C */ cpu->r[3] = rbrew_read32(cpu->mem, _t6);
         /* 02071B90 */ cpu->r[4] = cpu->r[30];
         /* 02071B94 */ Gambit_fn_020726B8(cpu);
-        /* 02071B98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02071B9C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071B98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02071B9C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071B9C */ _t8 = _t7 & 0x00000001u;
         /* 02071B9C */ if (_t8) goto L_02071BB0; else goto L_02071BA0;
   L_02071BA0: ; // 0x2071ba0
         /* 02071BA0 */ cpu->r[28] = cpu->r[28] + 0xFFFFFFFFu;
-        /* 02071BA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 02071BA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 02071BA4 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
         /* 02071BA8 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02071BAC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071BAC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071BAC */ _t10 = _t9 & 0x00000001u;
         /* 02071BAC */ if (_t10) goto L_02071BB0; else goto L_02071B8C;
   L_02071BB0: ; // 0x2071bb0
@@ -19617,9 +19617,9 @@ void Gambit_fn_02071D14(CPUState* cpu) {
         /* 02071D34 */ cpu->r[12] = rbrew_read32(cpu->mem, _t5);
         /* 02071D38 */ _t6 = cpu->r[31] + 0x00000038u;
         /* 02071D38 */ cpu->r[10] = rbrew_read32(cpu->mem, _t6);
-        /* 02071D3C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[12]);
+        /* 02071D3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[12]));
         /* 02071D40 */ cpu->r[30] = cpu->r[5];
-        /* 02071D44 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071D44 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071D44 */ _t8 = _t7 & 0x00000001u;
         /* 02071D44 */ if (_t8) goto L_02071D48; else goto L_02071D70;
   L_02071D48: ; // 0x2071d48
@@ -19649,8 +19649,8 @@ void Gambit_fn_02071D14(CPUState* cpu) {
         /* 02071D80 */ Gambit_fn_02073B14(cpu);
         /* 02071D84 */ _t17 = cpu->r[29] + 0x00000000u;
         /* 02071D84 */ cpu->r[9] = rbrew_read32(cpu->mem, _t17);
-        /* 02071D88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000001u);
-        /* 02071D8C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071D88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000001u));
+        /* 02071D8C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071D8C */ _t19 = _t18 & 0x00000001u;
         /* 02071D8C */ if (_t19) goto L_02071D90; else goto L_02071D9C;
   L_02071D90: ; // 0x2071d90
@@ -19698,9 +19698,9 @@ void Gambit_fn_02071D18(CPUState* cpu) {
         /* 02071D34 */ cpu->r[12] = rbrew_read32(cpu->mem, _t5);
         /* 02071D38 */ _t6 = cpu->r[31] + 0x00000038u;
         /* 02071D38 */ cpu->r[10] = rbrew_read32(cpu->mem, _t6);
-        /* 02071D3C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[12]);
+        /* 02071D3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[12]));
         /* 02071D40 */ cpu->r[30] = cpu->r[5];
-        /* 02071D44 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071D44 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071D44 */ _t8 = _t7 & 0x00000001u;
         /* 02071D44 */ if (_t8) goto L_02071D48; else goto L_02071D70;
   L_02071D48: ; // 0x2071d48
@@ -19730,8 +19730,8 @@ void Gambit_fn_02071D18(CPUState* cpu) {
         /* 02071D80 */ Gambit_fn_02073B14(cpu);
         /* 02071D84 */ _t17 = cpu->r[29] + 0x00000000u;
         /* 02071D84 */ cpu->r[9] = rbrew_read32(cpu->mem, _t17);
-        /* 02071D88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000001u);
-        /* 02071D8C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071D88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000001u));
+        /* 02071D8C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071D8C */ _t19 = _t18 & 0x00000001u;
         /* 02071D8C */ if (_t19) goto L_02071D90; else goto L_02071D9C;
   L_02071D90: ; // 0x2071d90
@@ -19778,8 +19778,8 @@ void Gambit_fn_02071DC0(CPUState* cpu) {
         /* 02071DE0 */ _t4 = cpu->r[30] + 0x0000008Cu;
         /* 02071DE0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
         /* 02071DE4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000000Fu, 0x0000000Fu);
-        /* 02071DE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02071DE8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071DE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02071DE8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071DE8 */ _t6 = _t5 & 0x00000001u;
         /* 02071DE8 */ if (_t6) goto L_02071E14; else goto L_02071DEC;
   L_02071DEC: ; // 0x2071dec
@@ -19787,8 +19787,8 @@ void Gambit_fn_02071DC0(CPUState* cpu) {
         /* 02071DEC */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
         /* 02071DF0 */ cpu->r[4] = 0x00000000u;
         /* 02071DF4 */ Gambit_fn_02072668(cpu);
-        /* 02071DF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02071DFC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071DF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02071DFC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071DFC */ _t9 = _t8 & 0x00000001u;
         /* 02071DFC */ if (_t9) goto L_02071E10; else goto L_02071E00;
   L_02071E00: ; // 0x2071e00
@@ -19802,8 +19802,8 @@ void Gambit_fn_02071DC0(CPUState* cpu) {
         /* 02071E10 */ cpu->r[0] = rbrew_read32(cpu->mem, _t11);
   L_02071E14: ; // 0x2071e14
         /* 02071E14 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000000Eu, 0x0000000Eu);
-        /* 02071E14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02071E18 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071E14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02071E18 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071E18 */ _t13 = _t12 & 0x00000001u;
         /* 02071E18 */ if (_t13) goto L_02071E3C; else goto L_02071E1C;
   L_02071E1C: ; // 0x2071e1c
@@ -19811,8 +19811,8 @@ void Gambit_fn_02071DC0(CPUState* cpu) {
         /* 02071E1C */ cpu->r[3] = rbrew_read32(cpu->mem, _t14);
         /* 02071E20 */ cpu->r[4] = 0x00000000u;
         /* 02071E24 */ Gambit_fn_020726B8(cpu);
-        /* 02071E28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02071E2C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071E28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02071E2C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071E2C */ _t16 = _t15 & 0x00000001u;
         /* 02071E2C */ if (_t16) goto L_02071E3C; else goto L_02071E30;
   L_02071E30: ; // 0x2071e30
@@ -19852,8 +19852,8 @@ void Gambit_fn_02071DC4(CPUState* cpu) {
         /* 02071DE0 */ _t4 = cpu->r[30] + 0x0000008Cu;
         /* 02071DE0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
         /* 02071DE4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000000Fu, 0x0000000Fu);
-        /* 02071DE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02071DE8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071DE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02071DE8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071DE8 */ _t6 = _t5 & 0x00000001u;
         /* 02071DE8 */ if (_t6) goto L_02071E14; else goto L_02071DEC;
   L_02071DEC: ; // 0x2071dec
@@ -19861,8 +19861,8 @@ void Gambit_fn_02071DC4(CPUState* cpu) {
         /* 02071DEC */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
         /* 02071DF0 */ cpu->r[4] = 0x00000000u;
         /* 02071DF4 */ Gambit_fn_02072668(cpu);
-        /* 02071DF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02071DFC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071DF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02071DFC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071DFC */ _t9 = _t8 & 0x00000001u;
         /* 02071DFC */ if (_t9) goto L_02071E10; else goto L_02071E00;
   L_02071E00: ; // 0x2071e00
@@ -19876,8 +19876,8 @@ void Gambit_fn_02071DC4(CPUState* cpu) {
         /* 02071E10 */ cpu->r[0] = rbrew_read32(cpu->mem, _t11);
   L_02071E14: ; // 0x2071e14
         /* 02071E14 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000000Eu, 0x0000000Eu);
-        /* 02071E14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02071E18 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071E14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02071E18 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071E18 */ _t13 = _t12 & 0x00000001u;
         /* 02071E18 */ if (_t13) goto L_02071E3C; else goto L_02071E1C;
   L_02071E1C: ; // 0x2071e1c
@@ -19885,8 +19885,8 @@ void Gambit_fn_02071DC4(CPUState* cpu) {
         /* 02071E1C */ cpu->r[3] = rbrew_read32(cpu->mem, _t14);
         /* 02071E20 */ cpu->r[4] = 0x00000000u;
         /* 02071E24 */ Gambit_fn_020726B8(cpu);
-        /* 02071E28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02071E2C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071E28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02071E2C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071E2C */ _t16 = _t15 & 0x00000001u;
         /* 02071E2C */ if (_t16) goto L_02071E3C; else goto L_02071E30;
   L_02071E30: ; // 0x2071e30
@@ -19924,8 +19924,8 @@ void Gambit_fn_02071E54(CPUState* cpu) {
         /* 02071E6C */ _t3 = cpu->r[3] + 0x0000008Cu;
         /* 02071E6C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 02071E70 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000000Fu, 0x0000000Fu);
-        /* 02071E70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02071E74 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071E70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02071E74 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071E74 */ _t5 = _t4 & 0x00000001u;
         /* 02071E74 */ if (_t5) goto L_02071EA8; else goto L_02071E78;
   L_02071E78: ; // 0x2071e78
@@ -19937,8 +19937,8 @@ void Gambit_fn_02071E54(CPUState* cpu) {
         /* 02071E80 */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
         /* 02071E84 */ cpu->ctr = cpu->r[0];
         /* 02071E88 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02071E8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02071E90 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071E8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02071E90 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071E90 */ _t10 = _t9 & 0x00000001u;
         /* 02071E90 */ if (_t10) goto L_02071EA8; else goto L_02071E94;
   L_02071E94: ; // 0x2071e94
@@ -19954,8 +19954,8 @@ void Gambit_fn_02071E54(CPUState* cpu) {
         /* 02071EAC */ _t13 = cpu->r[10] + 0x00003414u;
         /* 02071EAC */ cpu->r[4] = rbrew_read32(cpu->mem, _t13);
         /* 02071EAC */ cpu->r[10] = _t13;
-        /* 02071EB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 02071EB4 */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02071EB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 02071EB4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02071EB4 */ _t15 = _t14 & 0x00000001u;
         /* 02071EB4 */ if (_t15) goto L_02071EB8; else goto L_02071EC0;
   L_02071EB8: ; // 0x2071eb8
@@ -19992,8 +19992,8 @@ void Gambit_fn_02071E58(CPUState* cpu) {
         /* 02071E6C */ _t3 = cpu->r[3] + 0x0000008Cu;
         /* 02071E6C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 02071E70 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000000Fu, 0x0000000Fu);
-        /* 02071E70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02071E74 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071E70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02071E74 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071E74 */ _t5 = _t4 & 0x00000001u;
         /* 02071E74 */ if (_t5) goto L_02071EA8; else goto L_02071E78;
   L_02071E78: ; // 0x2071e78
@@ -20005,8 +20005,8 @@ void Gambit_fn_02071E58(CPUState* cpu) {
         /* 02071E80 */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
         /* 02071E84 */ cpu->ctr = cpu->r[0];
         /* 02071E88 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02071E8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02071E90 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071E8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02071E90 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071E90 */ _t10 = _t9 & 0x00000001u;
         /* 02071E90 */ if (_t10) goto L_02071EA8; else goto L_02071E94;
   L_02071E94: ; // 0x2071e94
@@ -20022,8 +20022,8 @@ void Gambit_fn_02071E58(CPUState* cpu) {
         /* 02071EAC */ _t13 = cpu->r[10] + 0x00003414u;
         /* 02071EAC */ cpu->r[4] = rbrew_read32(cpu->mem, _t13);
         /* 02071EAC */ cpu->r[10] = _t13;
-        /* 02071EB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 02071EB4 */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02071EB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 02071EB4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02071EB4 */ _t15 = _t14 & 0x00000001u;
         /* 02071EB4 */ if (_t15) goto L_02071EB8; else goto L_02071EC0;
   L_02071EB8: ; // 0x2071eb8
@@ -76,14 +76,14 @@ void Gambit_fn_02071F94(CPUState* cpu) {
         /* 02071F94 */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 02071F94 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 02071F94 */ cpu->r[1] = _t0;
-        /* 02071F98 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071F98 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071F98 */ _t2 = _t1 & 0x00000001u;
         /* 02071F98 */ if (_t2) goto L_02071F9C; else goto L_02071FAC;
   L_02071F9C: ; // 0x2071f9c
         /* 02071F9C */ cpu->r[3] = 0x0000000Cu;
         /* 02071FA0 */ Gambit_fn_02801A78(cpu);
-        /* 02071FA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02071FA8 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02071FA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02071FA8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02071FA8 */ _t4 = _t3 & 0x00000001u;
         /* 02071FA8 */ if (_t4) goto L_02071FCC; else goto L_02071FAC;
   L_02071FAC: ; // 0x2071fac
@@ -127,11 +127,11 @@ void Gambit_fn_02071FDC(CPUState* cpu) {
         /* 02073708 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02073708 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0207370C */ cpu->r[30] = cpu->r[3];
-        /* 0207370C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207370C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02073710 */ cpu->r[31] = cpu->r[4];
         /* 02073714 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02073714 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02073718 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073718 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073718 */ _t5 = _t4 & 0x00000001u;
         /* 02073718 */ if (_t5) goto L_02073788; else goto L_0207371C;
   L_0207371C: ; // 0x207371c
@@ -145,10 +145,10 @@ void Gambit_fn_02071FDC(CPUState* cpu) {
         /* 02073734 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02073734 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02073738 */ cpu->r[11] = cpu->r[11] + 0xFFFF9FDCu;
-        /* 0207373C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207373C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02073740 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02073740 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02073744 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073744 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073744 */ _t10 = _t9 & 0x00000001u;
         /* 02073744 */ if (_t10) goto L_02073778; else goto L_02073748;
   L_02073748: ; // 0x2073748
@@ -169,8 +169,8 @@ void Gambit_fn_02071FDC(CPUState* cpu) {
         /* 02073774 */ Gambit_fn_02068798(cpu);
   L_02073778: ; // 0x2073778
         /* 02073778 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02073778 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0207377C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073778 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0207377C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207377C */ _t15 = _t14 & 0x00000001u;
         /* 0207377C */ if (_t15) goto L_02073788; else goto L_02073780;
   L_02073780: ; // 0x2073780
@@ -198,8 +198,8 @@ void Gambit_fn_02071FE4(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -254,18 +254,18 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
         /* 0207200C */ _t3 = cpu->r[1] + 0x00000010u;
         /* 0207200C */ rbrew_write32(cpu->mem, _t3, cpu->r[30]);
         /* 02072010 */ cpu->r[31] = cpu->r[3];
-        /* 02072010 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02072010 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02072014 */ _t4 = cpu->r[1] + 0x0000001Cu;
         /* 02072014 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
-        /* 02072018 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072018 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072018 */ _t6 = _t5 & 0x00000001u;
         /* 02072018 */ if (_t6) goto L_0207201C; else goto L_0207202C;
   L_0207201C: ; // 0x207201c
         /* 0207201C */ cpu->r[3] = 0x00000278u;
         /* 02072020 */ Gambit_fn_02801A78(cpu);
         /* 02072024 */ cpu->r[31] = cpu->r[3];
-        /* 02072024 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02072028 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072024 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02072028 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072028 */ _t8 = _t7 & 0x00000001u;
         /* 02072028 */ if (_t8) goto L_020724C8; else goto L_0207202C;
   L_0207202C: ; // 0x207202c
@@ -291,17 +291,17 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
         /* 0207206C */ rbrew_write32(cpu->mem, _t11, cpu->r[5]);
         /* 02072070 */ cpu->r[8] = cpu->r[8] + 0xFFFF9FECu;
         /* 02072074 */ cpu->r[3] = cpu->r[31] + 0x0000021Cu;
-        /* 02072074 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02072074 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02072078 */ _t12 = cpu->r[31] + 0x000001C8u;
         /* 02072078 */ rbrew_write32(cpu->mem, _t12, cpu->r[8]);
-        /* 0207207C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207207C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207207C */ _t14 = _t13 & 0x00000001u;
         /* 0207207C */ if (_t14) goto L_02072080; else goto L_02072090;
   L_02072080: ; // 0x2072080
         /* 02072080 */ cpu->r[3] = 0x00000008u;
         /* 02072084 */ Gambit_fn_02801A78(cpu);
-        /* 02072088 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207208C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072088 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207208C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207208C */ _t16 = _t15 & 0x00000001u;
         /* 0207208C */ if (_t16) goto L_02072098; else goto L_02072090;
   L_02072090: ; // 0x2072090
@@ -311,15 +311,15 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
         /* 02072094 */ rbrew_write32(cpu->mem, _t18, cpu->r[30]);
   L_02072098: ; // 0x2072098
         /* 02072098 */ cpu->r[3] = cpu->r[31] + 0x00000224u;
-        /* 02072098 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207209C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072098 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207209C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207209C */ _t20 = _t19 & 0x00000001u;
         /* 0207209C */ if (_t20) goto L_020720A0; else goto L_020720B0;
   L_020720A0: ; // 0x20720a0
         /* 020720A0 */ cpu->r[3] = 0x00000008u;
         /* 020720A4 */ Gambit_fn_02801A78(cpu);
-        /* 020720A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020720AC */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020720A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020720AC */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020720AC */ _t22 = _t21 & 0x00000001u;
         /* 020720AC */ if (_t22) goto L_020720B8; else goto L_020720B0;
   L_020720B0: ; // 0x20720b0
@@ -329,15 +329,15 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
         /* 020720B4 */ rbrew_write32(cpu->mem, _t24, cpu->r[30]);
   L_020720B8: ; // 0x20720b8
         /* 020720B8 */ cpu->r[3] = cpu->r[31] + 0x00000234u;
-        /* 020720B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020720BC */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020720B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020720BC */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020720BC */ _t26 = _t25 & 0x00000001u;
         /* 020720BC */ if (_t26) goto L_020720C0; else goto L_020720D0;
   L_020720C0: ; // 0x20720c0
         /* 020720C0 */ cpu->r[3] = 0x00000008u;
         /* 020720C4 */ Gambit_fn_02801A78(cpu);
-        /* 020720C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020720CC */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020720C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020720CC */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020720CC */ _t28 = _t27 & 0x00000001u;
         /* 020720CC */ if (_t28) goto L_020720D8; else goto L_020720D0;
   L_020720D0: ; // 0x20720d0
@@ -347,15 +347,15 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
         /* 020720D4 */ rbrew_write32(cpu->mem, _t30, cpu->r[30]);
   L_020720D8: ; // 0x20720d8
         /* 020720D8 */ cpu->r[3] = cpu->r[31] + 0x0000023Cu;
-        /* 020720D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020720DC */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020720D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020720DC */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020720DC */ _t32 = _t31 & 0x00000001u;
         /* 020720DC */ if (_t32) goto L_020720E0; else goto L_020720F0;
   L_020720E0: ; // 0x20720e0
         /* 020720E0 */ cpu->r[3] = 0x00000008u;
         /* 020720E4 */ Gambit_fn_02801A78(cpu);
-        /* 020720E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020720EC */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020720E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020720EC */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020720EC */ _t34 = _t33 & 0x00000001u;
         /* 020720EC */ if (_t34) goto L_020720F8; else goto L_020720F0;
   L_020720F0: ; // 0x20720f0
@@ -365,15 +365,15 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
         /* 020720F4 */ rbrew_write32(cpu->mem, _t36, cpu->r[30]);
   L_020720F8: ; // 0x20720f8
         /* 020720F8 */ cpu->r[3] = cpu->r[31] + 0x00000244u;
-        /* 020720F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020720FC */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020720F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020720FC */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020720FC */ _t38 = _t37 & 0x00000001u;
         /* 020720FC */ if (_t38) goto L_02072100; else goto L_02072110;
   L_02072100: ; // 0x2072100
         /* 02072100 */ cpu->r[3] = 0x00000008u;
         /* 02072104 */ Gambit_fn_02801A78(cpu);
-        /* 02072108 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207210C */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072108 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207210C */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207210C */ _t40 = _t39 & 0x00000001u;
         /* 0207210C */ if (_t40) goto L_02072118; else goto L_02072110;
   L_02072110: ; // 0x2072110
@@ -383,15 +383,15 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
         /* 02072114 */ rbrew_write32(cpu->mem, _t42, cpu->r[30]);
   L_02072118: ; // 0x2072118
         /* 02072118 */ cpu->r[3] = cpu->r[31] + 0x0000024Cu;
-        /* 02072118 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207211C */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072118 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207211C */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207211C */ _t44 = _t43 & 0x00000001u;
         /* 0207211C */ if (_t44) goto L_02072120; else goto L_02072130;
   L_02072120: ; // 0x2072120
         /* 02072120 */ cpu->r[3] = 0x00000008u;
         /* 02072124 */ Gambit_fn_02801A78(cpu);
-        /* 02072128 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207212C */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072128 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207212C */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207212C */ _t46 = _t45 & 0x00000001u;
         /* 0207212C */ if (_t46) goto L_02072138; else goto L_02072130;
   L_02072130: ; // 0x2072130
@@ -401,15 +401,15 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
         /* 02072134 */ rbrew_write32(cpu->mem, _t48, cpu->r[30]);
   L_02072138: ; // 0x2072138
         /* 02072138 */ cpu->r[3] = cpu->r[31] + 0x00000254u;
-        /* 02072138 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207213C */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072138 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207213C */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207213C */ _t50 = _t49 & 0x00000001u;
         /* 0207213C */ if (_t50) goto L_02072140; else goto L_02072150;
   L_02072140: ; // 0x2072140
         /* 02072140 */ cpu->r[3] = 0x00000008u;
         /* 02072144 */ Gambit_fn_02801A78(cpu);
-        /* 02072148 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207214C */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072148 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207214C */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207214C */ _t52 = _t51 & 0x00000001u;
         /* 0207214C */ if (_t52) goto L_02072158; else goto L_02072150;
   L_02072150: ; // 0x2072150
@@ -419,15 +419,15 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
         /* 02072154 */ rbrew_write32(cpu->mem, _t54, cpu->r[30]);
   L_02072158: ; // 0x2072158
         /* 02072158 */ cpu->r[3] = cpu->r[31] + 0x0000025Cu;
-        /* 02072158 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207215C */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207215C */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207215C */ _t56 = _t55 & 0x00000001u;
         /* 0207215C */ if (_t56) goto L_02072160; else goto L_02072170;
   L_02072160: ; // 0x2072160
         /* 02072160 */ cpu->r[3] = 0x00000008u;
         /* 02072164 */ Gambit_fn_02801A78(cpu);
-        /* 02072168 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207216C */ _t57 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072168 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207216C */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207216C */ _t58 = _t57 & 0x00000001u;
         /* 0207216C */ if (_t58) goto L_02072178; else goto L_02072170;
   L_02072170: ; // 0x2072170
@@ -437,15 +437,15 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
         /* 02072174 */ rbrew_write32(cpu->mem, _t60, cpu->r[30]);
   L_02072178: ; // 0x2072178
         /* 02072178 */ cpu->r[3] = cpu->r[31] + 0x00000268u;
-        /* 02072178 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207217C */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207217C */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207217C */ _t62 = _t61 & 0x00000001u;
         /* 0207217C */ if (_t62) goto L_02072180; else goto L_02072190;
   L_02072180: ; // 0x2072180
         /* 02072180 */ cpu->r[3] = 0x00000002u;
         /* 02072184 */ Gambit_fn_02801A78(cpu);
-        /* 02072188 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207218C */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072188 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207218C */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207218C */ _t64 = _t63 & 0x00000001u;
         /* 0207218C */ if (_t64) goto L_02072194; else goto L_02072190;
   L_02072190: ; // 0x2072190
@@ -470,8 +470,8 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
         /* 020721B8 */ cpu->r[4] = 0x00000020u;
         /* 020721BC */ cpu->r[5] = 0x00000004u;
         /* 020721C0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020721C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020721C8 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020721C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020721C8 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020721C8 */ _t72 = _t71 & 0x00000001u;
         /* 020721C8 */ if (_t72) goto L_020721D8; else goto L_020721CC;
   L_020721CC: ; // 0x20721cc
@@ -483,8 +483,8 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
   L_020721D8: ; // 0x20721d8
         /* 020721D8 */ _t75 = cpu->r[31] + 0x0000021Cu;
         /* 020721D8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t75);
-        /* 020721DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020721E0 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020721DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020721E0 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020721E0 */ _t77 = _t76 & 0x00000001u;
         /* 020721E0 */ if (_t77) goto L_020721E4; else goto L_02072200;
   L_020721E4: ; // 0x20721e4
@@ -514,8 +514,8 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
         /* 02072214 */ cpu->r[4] = 0x0000000Cu;
         /* 02072218 */ cpu->r[5] = 0x00000004u;
         /* 0207221C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02072220 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02072224 */ _t86 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072220 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02072224 */ _t86 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072224 */ _t87 = _t86 & 0x00000001u;
         /* 02072224 */ if (_t87) goto L_02072234; else goto L_02072228;
   L_02072228: ; // 0x2072228
@@ -527,8 +527,8 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
   L_02072234: ; // 0x2072234
         /* 02072234 */ _t90 = cpu->r[31] + 0x00000224u;
         /* 02072234 */ cpu->r[8] = rbrew_read32(cpu->mem, _t90);
-        /* 02072238 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 0207223C */ _t91 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02072238 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 0207223C */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207223C */ _t92 = _t91 & 0x00000001u;
         /* 0207223C */ if (_t92) goto L_02072240; else goto L_0207225C;
   L_02072240: ; // 0x2072240
@@ -562,8 +562,8 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
         /* 02072278 */ cpu->r[4] = 0x00000020u;
         /* 0207227C */ cpu->r[5] = 0x00000004u;
         /* 02072280 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02072284 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02072288 */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072284 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02072288 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072288 */ _t104 = _t103 & 0x00000001u;
         /* 02072288 */ if (_t104) goto L_02072298; else goto L_0207228C;
   L_0207228C: ; // 0x207228c
@@ -575,8 +575,8 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
   L_02072298: ; // 0x2072298
         /* 02072298 */ _t107 = cpu->r[31] + 0x00000234u;
         /* 02072298 */ cpu->r[12] = rbrew_read32(cpu->mem, _t107);
-        /* 0207229C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020722A0 */ _t108 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207229C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020722A0 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020722A0 */ _t109 = _t108 & 0x00000001u;
         /* 020722A0 */ if (_t109) goto L_020722A4; else goto L_020722C0;
   L_020722A4: ; // 0x20722a4
@@ -606,8 +606,8 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
         /* 020722D4 */ cpu->r[4] = 0x00000020u;
         /* 020722D8 */ cpu->r[5] = 0x00000004u;
         /* 020722DC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020722E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020722E4 */ _t118 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020722E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020722E4 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020722E4 */ _t119 = _t118 & 0x00000001u;
         /* 020722E4 */ if (_t119) goto L_020722F4; else goto L_020722E8;
   L_020722E8: ; // 0x20722e8
@@ -619,8 +619,8 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
   L_020722F4: ; // 0x20722f4
         /* 020722F4 */ _t122 = cpu->r[31] + 0x0000023Cu;
         /* 020722F4 */ cpu->r[6] = rbrew_read32(cpu->mem, _t122);
-        /* 020722F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 020722FC */ _t123 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020722F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 020722FC */ _t123 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020722FC */ _t124 = _t123 & 0x00000001u;
         /* 020722FC */ if (_t124) goto L_02072300; else goto L_0207231C;
   L_02072300: ; // 0x2072300
@@ -650,8 +650,8 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
         /* 02072330 */ cpu->r[4] = 0x00000020u;
         /* 02072334 */ cpu->r[5] = 0x00000004u;
         /* 02072338 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207233C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02072340 */ _t133 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207233C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02072340 */ _t133 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072340 */ _t134 = _t133 & 0x00000001u;
         /* 02072340 */ if (_t134) goto L_02072350; else goto L_02072344;
   L_02072344: ; // 0x2072344
@@ -663,8 +663,8 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
   L_02072350: ; // 0x2072350
         /* 02072350 */ _t137 = cpu->r[31] + 0x00000244u;
         /* 02072350 */ cpu->r[9] = rbrew_read32(cpu->mem, _t137);
-        /* 02072354 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02072358 */ _t138 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02072354 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02072358 */ _t138 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02072358 */ _t139 = _t138 & 0x00000001u;
         /* 02072358 */ if (_t139) goto L_0207235C; else goto L_02072378;
   L_0207235C: ; // 0x207235c
@@ -694,8 +694,8 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
         /* 0207238C */ cpu->r[4] = 0x00000020u;
         /* 02072390 */ cpu->r[5] = 0x00000004u;
         /* 02072394 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02072398 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207239C */ _t148 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072398 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207239C */ _t148 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207239C */ _t149 = _t148 & 0x00000001u;
         /* 0207239C */ if (_t149) goto L_020723AC; else goto L_020723A0;
   L_020723A0: ; // 0x20723a0
@@ -707,8 +707,8 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
   L_020723AC: ; // 0x20723ac
         /* 020723AC */ _t152 = cpu->r[31] + 0x0000024Cu;
         /* 020723AC */ cpu->r[5] = rbrew_read32(cpu->mem, _t152);
-        /* 020723B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 020723B4 */ _t153 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020723B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 020723B4 */ _t153 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020723B4 */ _t154 = _t153 & 0x00000001u;
         /* 020723B4 */ if (_t154) goto L_020723B8; else goto L_020723D4;
   L_020723B8: ; // 0x20723b8
@@ -738,8 +738,8 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
         /* 020723E8 */ cpu->r[4] = 0x0000000Cu;
         /* 020723EC */ cpu->r[5] = 0x00000004u;
         /* 020723F0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020723F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020723F8 */ _t163 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020723F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020723F8 */ _t163 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020723F8 */ _t164 = _t163 & 0x00000001u;
         /* 020723F8 */ if (_t164) goto L_02072408; else goto L_020723FC;
   L_020723FC: ; // 0x20723fc
@@ -751,8 +751,8 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
   L_02072408: ; // 0x2072408
         /* 02072408 */ _t167 = cpu->r[31] + 0x00000254u;
         /* 02072408 */ cpu->r[10] = rbrew_read32(cpu->mem, _t167);
-        /* 0207240C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02072410 */ _t168 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207240C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02072410 */ _t168 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02072410 */ _t169 = _t168 & 0x00000001u;
         /* 02072410 */ if (_t169) goto L_02072414; else goto L_02072430;
   L_02072414: ; // 0x2072414
@@ -782,8 +782,8 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
         /* 02072444 */ cpu->r[4] = 0x00000010u;
         /* 02072448 */ cpu->r[5] = 0x00000004u;
         /* 0207244C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02072450 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02072454 */ _t178 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072450 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02072454 */ _t178 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072454 */ _t179 = _t178 & 0x00000001u;
         /* 02072454 */ if (_t179) goto L_02072464; else goto L_02072458;
   L_02072458: ; // 0x2072458
@@ -795,8 +795,8 @@ void Gambit_fn_02071FFC(CPUState* cpu) {
   L_02072464: ; // 0x2072464
         /* 02072464 */ _t182 = cpu->r[31] + 0x0000025Cu;
         /* 02072464 */ cpu->r[6] = rbrew_read32(cpu->mem, _t182);
-        /* 02072468 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0207246C */ _t183 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02072468 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0207246C */ _t183 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207246C */ _t184 = _t183 & 0x00000001u;
         /* 0207246C */ if (_t184) goto L_02072470; else goto L_0207248C;
   L_02072470: ; // 0x2072470
@@ -871,18 +871,18 @@ void Gambit_fn_02072000(CPUState* cpu) {
         /* 0207200C */ _t3 = cpu->r[1] + 0x00000010u;
         /* 0207200C */ rbrew_write32(cpu->mem, _t3, cpu->r[30]);
         /* 02072010 */ cpu->r[31] = cpu->r[3];
-        /* 02072010 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02072010 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02072014 */ _t4 = cpu->r[1] + 0x0000001Cu;
         /* 02072014 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
-        /* 02072018 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072018 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072018 */ _t6 = _t5 & 0x00000001u;
         /* 02072018 */ if (_t6) goto L_0207201C; else goto L_0207202C;
   L_0207201C: ; // 0x207201c
         /* 0207201C */ cpu->r[3] = 0x00000278u;
         /* 02072020 */ Gambit_fn_02801A78(cpu);
         /* 02072024 */ cpu->r[31] = cpu->r[3];
-        /* 02072024 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02072028 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072024 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02072028 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072028 */ _t8 = _t7 & 0x00000001u;
         /* 02072028 */ if (_t8) goto L_020724C8; else goto L_0207202C;
   L_0207202C: ; // 0x207202c
@@ -908,17 +908,17 @@ void Gambit_fn_02072000(CPUState* cpu) {
         /* 0207206C */ rbrew_write32(cpu->mem, _t11, cpu->r[5]);
         /* 02072070 */ cpu->r[8] = cpu->r[8] + 0xFFFF9FECu;
         /* 02072074 */ cpu->r[3] = cpu->r[31] + 0x0000021Cu;
-        /* 02072074 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02072074 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02072078 */ _t12 = cpu->r[31] + 0x000001C8u;
         /* 02072078 */ rbrew_write32(cpu->mem, _t12, cpu->r[8]);
-        /* 0207207C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207207C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207207C */ _t14 = _t13 & 0x00000001u;
         /* 0207207C */ if (_t14) goto L_02072080; else goto L_02072090;
   L_02072080: ; // 0x2072080
         /* 02072080 */ cpu->r[3] = 0x00000008u;
         /* 02072084 */ Gambit_fn_02801A78(cpu);
-        /* 02072088 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207208C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072088 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207208C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207208C */ _t16 = _t15 & 0x00000001u;
         /* 0207208C */ if (_t16) goto L_02072098; else goto L_02072090;
   L_02072090: ; // 0x2072090
@@ -928,15 +928,15 @@ void Gambit_fn_02072000(CPUState* cpu) {
         /* 02072094 */ rbrew_write32(cpu->mem, _t18, cpu->r[30]);
   L_02072098: ; // 0x2072098
         /* 02072098 */ cpu->r[3] = cpu->r[31] + 0x00000224u;
-        /* 02072098 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207209C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072098 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207209C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207209C */ _t20 = _t19 & 0x00000001u;
         /* 0207209C */ if (_t20) goto L_020720A0; else goto L_020720B0;
   L_020720A0: ; // 0x20720a0
         /* 020720A0 */ cpu->r[3] = 0x00000008u;
         /* 020720A4 */ Gambit_fn_02801A78(cpu);
-        /* 020720A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020720AC */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020720A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020720AC */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020720AC */ _t22 = _t21 & 0x00000001u;
         /* 020720AC */ if (_t22) goto L_020720B8; else goto L_020720B0;
   L_020720B0: ; // 0x20720b0
@@ -946,15 +946,15 @@ void Gambit_fn_02072000(CPUState* cpu) {
         /* 020720B4 */ rbrew_write32(cpu->mem, _t24, cpu->r[30]);
   L_020720B8: ; // 0x20720b8
         /* 020720B8 */ cpu->r[3] = cpu->r[31] + 0x00000234u;
-        /* 020720B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020720BC */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020720B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020720BC */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020720BC */ _t26 = _t25 & 0x00000001u;
         /* 020720BC */ if (_t26) goto L_020720C0; else goto L_020720D0;
   L_020720C0: ; // 0x20720c0
         /* 020720C0 */ cpu->r[3] = 0x00000008u;
         /* 020720C4 */ Gambit_fn_02801A78(cpu);
-        /* 020720C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020720CC */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020720C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020720CC */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020720CC */ _t28 = _t27 & 0x00000001u;
         /* 020720CC */ if (_t28) goto L_020720D8; else goto L_020720D0;
   L_020720D0: ; // 0x20720d0
@@ -964,15 +964,15 @@ void Gambit_fn_02072000(CPUState* cpu) {
         /* 020720D4 */ rbrew_write32(cpu->mem, _t30, cpu->r[30]);
   L_020720D8: ; // 0x20720d8
         /* 020720D8 */ cpu->r[3] = cpu->r[31] + 0x0000023Cu;
-        /* 020720D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020720DC */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020720D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020720DC */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020720DC */ _t32 = _t31 & 0x00000001u;
         /* 020720DC */ if (_t32) goto L_020720E0; else goto L_020720F0;
   L_020720E0: ; // 0x20720e0
         /* 020720E0 */ cpu->r[3] = 0x00000008u;
         /* 020720E4 */ Gambit_fn_02801A78(cpu);
-        /* 020720E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020720EC */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020720E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020720EC */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020720EC */ _t34 = _t33 & 0x00000001u;
         /* 020720EC */ if (_t34) goto L_020720F8; else goto L_020720F0;
   L_020720F0: ; // 0x20720f0
@@ -982,15 +982,15 @@ void Gambit_fn_02072000(CPUState* cpu) {
         /* 020720F4 */ rbrew_write32(cpu->mem, _t36, cpu->r[30]);
   L_020720F8: ; // 0x20720f8
         /* 020720F8 */ cpu->r[3] = cpu->r[31] + 0x00000244u;
-        /* 020720F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020720FC */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020720F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020720FC */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020720FC */ _t38 = _t37 & 0x00000001u;
         /* 020720FC */ if (_t38) goto L_02072100; else goto L_02072110;
   L_02072100: ; // 0x2072100
         /* 02072100 */ cpu->r[3] = 0x00000008u;
         /* 02072104 */ Gambit_fn_02801A78(cpu);
-        /* 02072108 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207210C */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072108 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207210C */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207210C */ _t40 = _t39 & 0x00000001u;
         /* 0207210C */ if (_t40) goto L_02072118; else goto L_02072110;
   L_02072110: ; // 0x2072110
@@ -1000,15 +1000,15 @@ void Gambit_fn_02072000(CPUState* cpu) {
         /* 02072114 */ rbrew_write32(cpu->mem, _t42, cpu->r[30]);
   L_02072118: ; // 0x2072118
         /* 02072118 */ cpu->r[3] = cpu->r[31] + 0x0000024Cu;
-        /* 02072118 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207211C */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072118 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207211C */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207211C */ _t44 = _t43 & 0x00000001u;
         /* 0207211C */ if (_t44) goto L_02072120; else goto L_02072130;
   L_02072120: ; // 0x2072120
         /* 02072120 */ cpu->r[3] = 0x00000008u;
         /* 02072124 */ Gambit_fn_02801A78(cpu);
-        /* 02072128 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207212C */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072128 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207212C */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207212C */ _t46 = _t45 & 0x00000001u;
         /* 0207212C */ if (_t46) goto L_02072138; else goto L_02072130;
   L_02072130: ; // 0x2072130
@@ -1018,15 +1018,15 @@ void Gambit_fn_02072000(CPUState* cpu) {
         /* 02072134 */ rbrew_write32(cpu->mem, _t48, cpu->r[30]);
   L_02072138: ; // 0x2072138
         /* 02072138 */ cpu->r[3] = cpu->r[31] + 0x00000254u;
-        /* 02072138 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207213C */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072138 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207213C */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207213C */ _t50 = _t49 & 0x00000001u;
         /* 0207213C */ if (_t50) goto L_02072140; else goto L_02072150;
   L_02072140: ; // 0x2072140
         /* 02072140 */ cpu->r[3] = 0x00000008u;
         /* 02072144 */ Gambit_fn_02801A78(cpu);
-        /* 02072148 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207214C */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072148 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207214C */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207214C */ _t52 = _t51 & 0x00000001u;
         /* 0207214C */ if (_t52) goto L_02072158; else goto L_02072150;
   L_02072150: ; // 0x2072150
@@ -1036,15 +1036,15 @@ void Gambit_fn_02072000(CPUState* cpu) {
         /* 02072154 */ rbrew_write32(cpu->mem, _t54, cpu->r[30]);
   L_02072158: ; // 0x2072158
         /* 02072158 */ cpu->r[3] = cpu->r[31] + 0x0000025Cu;
-        /* 02072158 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207215C */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207215C */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207215C */ _t56 = _t55 & 0x00000001u;
         /* 0207215C */ if (_t56) goto L_02072160; else goto L_02072170;
   L_02072160: ; // 0x2072160
         /* 02072160 */ cpu->r[3] = 0x00000008u;
         /* 02072164 */ Gambit_fn_02801A78(cpu);
-        /* 02072168 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207216C */ _t57 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072168 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207216C */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207216C */ _t58 = _t57 & 0x00000001u;
         /* 0207216C */ if (_t58) goto L_02072178; else goto L_02072170;
   L_02072170: ; // 0x2072170
@@ -1054,15 +1054,15 @@ void Gambit_fn_02072000(CPUState* cpu) {
         /* 02072174 */ rbrew_write32(cpu->mem, _t60, cpu->r[30]);
   L_02072178: ; // 0x2072178
         /* 02072178 */ cpu->r[3] = cpu->r[31] + 0x00000268u;
-        /* 02072178 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207217C */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207217C */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207217C */ _t62 = _t61 & 0x00000001u;
         /* 0207217C */ if (_t62) goto L_02072180; else goto L_02072190;
   L_02072180: ; // 0x2072180
         /* 02072180 */ cpu->r[3] = 0x00000002u;
         /* 02072184 */ Gambit_fn_02801A78(cpu);
-        /* 02072188 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207218C */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072188 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207218C */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207218C */ _t64 = _t63 & 0x00000001u;
         /* 0207218C */ if (_t64) goto L_02072194; else goto L_02072190;
   L_02072190: ; // 0x2072190
@@ -1087,8 +1087,8 @@ void Gambit_fn_02072000(CPUState* cpu) {
         /* 020721B8 */ cpu->r[4] = 0x00000020u;
         /* 020721BC */ cpu->r[5] = 0x00000004u;
         /* 020721C0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020721C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020721C8 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020721C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020721C8 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020721C8 */ _t72 = _t71 & 0x00000001u;
         /* 020721C8 */ if (_t72) goto L_020721D8; else goto L_020721CC;
   L_020721CC: ; // 0x20721cc
@@ -1100,8 +1100,8 @@ void Gambit_fn_02072000(CPUState* cpu) {
   L_020721D8: ; // 0x20721d8
         /* 020721D8 */ _t75 = cpu->r[31] + 0x0000021Cu;
         /* 020721D8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t75);
-        /* 020721DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020721E0 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020721DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020721E0 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020721E0 */ _t77 = _t76 & 0x00000001u;
         /* 020721E0 */ if (_t77) goto L_020721E4; else goto L_02072200;
   L_020721E4: ; // 0x20721e4
@@ -1131,8 +1131,8 @@ void Gambit_fn_02072000(CPUState* cpu) {
         /* 02072214 */ cpu->r[4] = 0x0000000Cu;
         /* 02072218 */ cpu->r[5] = 0x00000004u;
         /* 0207221C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02072220 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02072224 */ _t86 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072220 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02072224 */ _t86 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072224 */ _t87 = _t86 & 0x00000001u;
         /* 02072224 */ if (_t87) goto L_02072234; else goto L_02072228;
   L_02072228: ; // 0x2072228
@@ -1144,8 +1144,8 @@ void Gambit_fn_02072000(CPUState* cpu) {
   L_02072234: ; // 0x2072234
         /* 02072234 */ _t90 = cpu->r[31] + 0x00000224u;
         /* 02072234 */ cpu->r[8] = rbrew_read32(cpu->mem, _t90);
-        /* 02072238 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 0207223C */ _t91 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02072238 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 0207223C */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207223C */ _t92 = _t91 & 0x00000001u;
         /* 0207223C */ if (_t92) goto L_02072240; else goto L_0207225C;
   L_02072240: ; // 0x2072240
@@ -1179,8 +1179,8 @@ void Gambit_fn_02072000(CPUState* cpu) {
         /* 02072278 */ cpu->r[4] = 0x00000020u;
         /* 0207227C */ cpu->r[5] = 0x00000004u;
         /* 02072280 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02072284 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02072288 */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072284 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02072288 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072288 */ _t104 = _t103 & 0x00000001u;
         /* 02072288 */ if (_t104) goto L_02072298; else goto L_0207228C;
   L_0207228C: ; // 0x207228c
@@ -1192,8 +1192,8 @@ void Gambit_fn_02072000(CPUState* cpu) {
   L_02072298: ; // 0x2072298
         /* 02072298 */ _t107 = cpu->r[31] + 0x00000234u;
         /* 02072298 */ cpu->r[12] = rbrew_read32(cpu->mem, _t107);
-        /* 0207229C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020722A0 */ _t108 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207229C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020722A0 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020722A0 */ _t109 = _t108 & 0x00000001u;
         /* 020722A0 */ if (_t109) goto L_020722A4; else goto L_020722C0;
   L_020722A4: ; // 0x20722a4
@@ -1223,8 +1223,8 @@ void Gambit_fn_02072000(CPUState* cpu) {
         /* 020722D4 */ cpu->r[4] = 0x00000020u;
         /* 020722D8 */ cpu->r[5] = 0x00000004u;
         /* 020722DC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020722E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020722E4 */ _t118 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020722E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020722E4 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020722E4 */ _t119 = _t118 & 0x00000001u;
         /* 020722E4 */ if (_t119) goto L_020722F4; else goto L_020722E8;
   L_020722E8: ; // 0x20722e8
@@ -1236,8 +1236,8 @@ void Gambit_fn_02072000(CPUState* cpu) {
   L_020722F4: ; // 0x20722f4
         /* 020722F4 */ _t122 = cpu->r[31] + 0x0000023Cu;
         /* 020722F4 */ cpu->r[6] = rbrew_read32(cpu->mem, _t122);
-        /* 020722F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 020722FC */ _t123 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020722F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 020722FC */ _t123 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020722FC */ _t124 = _t123 & 0x00000001u;
         /* 020722FC */ if (_t124) goto L_02072300; else goto L_0207231C;
   L_02072300: ; // 0x2072300
@@ -1267,8 +1267,8 @@ void Gambit_fn_02072000(CPUState* cpu) {
         /* 02072330 */ cpu->r[4] = 0x00000020u;
         /* 02072334 */ cpu->r[5] = 0x00000004u;
         /* 02072338 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207233C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02072340 */ _t133 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207233C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02072340 */ _t133 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072340 */ _t134 = _t133 & 0x00000001u;
         /* 02072340 */ if (_t134) goto L_02072350; else goto L_02072344;
   L_02072344: ; // 0x2072344
@@ -1280,8 +1280,8 @@ void Gambit_fn_02072000(CPUState* cpu) {
   L_02072350: ; // 0x2072350
         /* 02072350 */ _t137 = cpu->r[31] + 0x00000244u;
         /* 02072350 */ cpu->r[9] = rbrew_read32(cpu->mem, _t137);
-        /* 02072354 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02072358 */ _t138 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02072354 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02072358 */ _t138 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02072358 */ _t139 = _t138 & 0x00000001u;
         /* 02072358 */ if (_t139) goto L_0207235C; else goto L_02072378;
   L_0207235C: ; // 0x207235c
@@ -1311,8 +1311,8 @@ void Gambit_fn_02072000(CPUState* cpu) {
         /* 0207238C */ cpu->r[4] = 0x00000020u;
         /* 02072390 */ cpu->r[5] = 0x00000004u;
         /* 02072394 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02072398 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207239C */ _t148 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072398 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207239C */ _t148 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207239C */ _t149 = _t148 & 0x00000001u;
         /* 0207239C */ if (_t149) goto L_020723AC; else goto L_020723A0;
   L_020723A0: ; // 0x20723a0
@@ -1324,8 +1324,8 @@ void Gambit_fn_02072000(CPUState* cpu) {
   L_020723AC: ; // 0x20723ac
         /* 020723AC */ _t152 = cpu->r[31] + 0x0000024Cu;
         /* 020723AC */ cpu->r[5] = rbrew_read32(cpu->mem, _t152);
-        /* 020723B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 020723B4 */ _t153 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020723B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 020723B4 */ _t153 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020723B4 */ _t154 = _t153 & 0x00000001u;
         /* 020723B4 */ if (_t154) goto L_020723B8; else goto L_020723D4;
   L_020723B8: ; // 0x20723b8
@@ -1355,8 +1355,8 @@ void Gambit_fn_02072000(CPUState* cpu) {
         /* 020723E8 */ cpu->r[4] = 0x0000000Cu;
         /* 020723EC */ cpu->r[5] = 0x00000004u;
         /* 020723F0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020723F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020723F8 */ _t163 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020723F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020723F8 */ _t163 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020723F8 */ _t164 = _t163 & 0x00000001u;
         /* 020723F8 */ if (_t164) goto L_02072408; else goto L_020723FC;
   L_020723FC: ; // 0x20723fc
@@ -1368,8 +1368,8 @@ void Gambit_fn_02072000(CPUState* cpu) {
   L_02072408: ; // 0x2072408
         /* 02072408 */ _t167 = cpu->r[31] + 0x00000254u;
         /* 02072408 */ cpu->r[10] = rbrew_read32(cpu->mem, _t167);
-        /* 0207240C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02072410 */ _t168 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207240C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02072410 */ _t168 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02072410 */ _t169 = _t168 & 0x00000001u;
         /* 02072410 */ if (_t169) goto L_02072414; else goto L_02072430;
   L_02072414: ; // 0x2072414
@@ -1399,8 +1399,8 @@ void Gambit_fn_02072000(CPUState* cpu) {
         /* 02072444 */ cpu->r[4] = 0x00000010u;
         /* 02072448 */ cpu->r[5] = 0x00000004u;
         /* 0207244C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02072450 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02072454 */ _t178 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072450 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02072454 */ _t178 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072454 */ _t179 = _t178 & 0x00000001u;
         /* 02072454 */ if (_t179) goto L_02072464; else goto L_02072458;
   L_02072458: ; // 0x2072458
@@ -1412,8 +1412,8 @@ void Gambit_fn_02072000(CPUState* cpu) {
   L_02072464: ; // 0x2072464
         /* 02072464 */ _t182 = cpu->r[31] + 0x0000025Cu;
         /* 02072464 */ cpu->r[6] = rbrew_read32(cpu->mem, _t182);
-        /* 02072468 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0207246C */ _t183 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02072468 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0207246C */ _t183 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207246C */ _t184 = _t183 & 0x00000001u;
         /* 0207246C */ if (_t184) goto L_02072470; else goto L_0207248C;
   L_02072470: ; // 0x2072470
@@ -1495,10 +1495,10 @@ void Gambit_fn_020724E8(CPUState* cpu) {
         /* 02072504 */ cpu->r[9] = rbrew_read32(cpu->mem, _t5);
         /* 02072508 */ cpu->r[30] = cpu->r[4];
         /* 0207250C */ cpu->r[31] = cpu->r[5];
-        /* 02072510 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[9]);
+        /* 02072510 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[9]));
         /* 02072514 */ _t6 = cpu->r[29] + 0x00000220u;
         /* 02072514 */ cpu->r[11] = rbrew_read32(cpu->mem, _t6);
-        /* 02072518 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02072518 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02072518 */ _t8 = _t7 & 0x00000001u;
         /* 02072518 */ if (_t8) goto L_0207251C; else goto L_02072524;
   L_0207251C: ; // 0x207251c
@@ -1511,7 +1511,7 @@ void Gambit_fn_020724E8(CPUState* cpu) {
         /* 0207252C */ cpu->r[0] = 0x00000001u;
         /* 02072530 */ _t10 = cpu->r[29] + 0x00000268u;
         /* 02072530 */ cpu->r[5] = rbrew_read16(cpu->mem, _t10);
-        /* 02072534 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02072534 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02072538 */ /* nop */
         /* 0207253C */ _t11 = cpu->r[29] + 0x0000021Cu;
         /* 0207253C */ cpu->r[0] = rbrew_read32(cpu->mem, _t11);
@@ -1524,12 +1524,12 @@ void Gambit_fn_020724E8(CPUState* cpu) {
         /* 02072554 */ _t13 = cpu->r[29] + 0x00000268u;
         /* 02072554 */ rbrew_write16(cpu->mem, _t13, (uint16_t)cpu->r[5]);
         /* 02072558 */ cpu->r[7] = cpu->r[7] + 0xFFFF9B04u;
-        /* 0207255C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207255C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207255C */ _t15 = _t14 & 0x00000001u;
         /* 0207255C */ if (_t15) goto L_0207259C; else goto L_02072560;
   L_02072560: ; // 0x2072560
-        /* 02072560 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
-        /* 02072564 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02072560 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
+        /* 02072564 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02072564 */ _t17 = _t16 & 0x00000001u;
         /* 02072564 */ if (_t17) goto L_02072568; else goto L_02072570;
   L_02072568: ; // 0x2072568
@@ -1552,8 +1552,8 @@ void Gambit_fn_020724E8(CPUState* cpu) {
         /* 02072594 */ Gambit_fn_027B70F0(cpu);
         /* 02072598 */ goto L_020725D4;
   L_0207259C: ; // 0x207259c
-        /* 0207259C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
-        /* 020725A0 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207259C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
+        /* 020725A0 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020725A0 */ _t23 = _t22 & 0x00000001u;
         /* 020725A0 */ if (_t23) goto L_020725A4; else goto L_020725AC;
   L_020725A4: ; // 0x20725a4
@@ -1609,10 +1609,10 @@ void Gambit_fn_020724EC(CPUState* cpu) {
         /* 02072504 */ cpu->r[9] = rbrew_read32(cpu->mem, _t5);
         /* 02072508 */ cpu->r[30] = cpu->r[4];
         /* 0207250C */ cpu->r[31] = cpu->r[5];
-        /* 02072510 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[9]);
+        /* 02072510 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[9]));
         /* 02072514 */ _t6 = cpu->r[29] + 0x00000220u;
         /* 02072514 */ cpu->r[11] = rbrew_read32(cpu->mem, _t6);
-        /* 02072518 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02072518 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02072518 */ _t8 = _t7 & 0x00000001u;
         /* 02072518 */ if (_t8) goto L_0207251C; else goto L_02072524;
   L_0207251C: ; // 0x207251c
@@ -1625,7 +1625,7 @@ void Gambit_fn_020724EC(CPUState* cpu) {
         /* 0207252C */ cpu->r[0] = 0x00000001u;
         /* 02072530 */ _t10 = cpu->r[29] + 0x00000268u;
         /* 02072530 */ cpu->r[5] = rbrew_read16(cpu->mem, _t10);
-        /* 02072534 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02072534 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02072538 */ /* nop */
         /* 0207253C */ _t11 = cpu->r[29] + 0x0000021Cu;
         /* 0207253C */ cpu->r[0] = rbrew_read32(cpu->mem, _t11);
@@ -1638,12 +1638,12 @@ void Gambit_fn_020724EC(CPUState* cpu) {
         /* 02072554 */ _t13 = cpu->r[29] + 0x00000268u;
         /* 02072554 */ rbrew_write16(cpu->mem, _t13, (uint16_t)cpu->r[5]);
         /* 02072558 */ cpu->r[7] = cpu->r[7] + 0xFFFF9B04u;
-        /* 0207255C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207255C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207255C */ _t15 = _t14 & 0x00000001u;
         /* 0207255C */ if (_t15) goto L_0207259C; else goto L_02072560;
   L_02072560: ; // 0x2072560
-        /* 02072560 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
-        /* 02072564 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02072560 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
+        /* 02072564 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02072564 */ _t17 = _t16 & 0x00000001u;
         /* 02072564 */ if (_t17) goto L_02072568; else goto L_02072570;
   L_02072568: ; // 0x2072568
@@ -1666,8 +1666,8 @@ void Gambit_fn_020724EC(CPUState* cpu) {
         /* 02072594 */ Gambit_fn_027B70F0(cpu);
         /* 02072598 */ goto L_020725D4;
   L_0207259C: ; // 0x207259c
-        /* 0207259C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
-        /* 020725A0 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207259C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
+        /* 020725A0 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020725A0 */ _t23 = _t22 & 0x00000001u;
         /* 020725A0 */ if (_t23) goto L_020725A4; else goto L_020725AC;
   L_020725A4: ; // 0x20725a4
@@ -1721,10 +1721,10 @@ void Gambit_fn_020725F0(CPUState* cpu) {
         /* 02072608 */ _t4 = cpu->r[30] + 0x0000021Cu;
         /* 02072608 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
         /* 0207260C */ cpu->r[31] = cpu->r[4];
-        /* 02072610 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
+        /* 02072610 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
         /* 02072614 */ _t5 = cpu->r[30] + 0x00000220u;
         /* 02072614 */ cpu->r[12] = rbrew_read32(cpu->mem, _t5);
-        /* 02072618 */ _t6 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02072618 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02072618 */ _t7 = _t6 & 0x00000001u;
         /* 02072618 */ if (_t7) goto L_0207261C; else goto L_02072624;
   L_0207261C: ; // 0x207261c
@@ -1776,10 +1776,10 @@ void Gambit_fn_020725F4(CPUState* cpu) {
         /* 02072608 */ _t4 = cpu->r[30] + 0x0000021Cu;
         /* 02072608 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
         /* 0207260C */ cpu->r[31] = cpu->r[4];
-        /* 02072610 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
+        /* 02072610 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
         /* 02072614 */ _t5 = cpu->r[30] + 0x00000220u;
         /* 02072614 */ cpu->r[12] = rbrew_read32(cpu->mem, _t5);
-        /* 02072618 */ _t6 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02072618 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02072618 */ _t7 = _t6 & 0x00000001u;
         /* 02072618 */ if (_t7) goto L_0207261C; else goto L_02072624;
   L_0207261C: ; // 0x207261c
@@ -1824,18 +1824,18 @@ void Gambit_fn_02072668(CPUState* cpu) {
         /* 02072670 */ cpu->r[7] = rbrew_read16(cpu->mem, _t0);
         /* 02072674 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000010u, 0x0000001Fu);
         /* 02072678 */ cpu->r[6] = cpu->r[7] & cpu->r[0];
-        /* 02072678 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02072678 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 0207267C */ cpu->r[5] = 0x00000000u;
-        /* 02072680 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072680 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072680 */ _t2 = _t1 & 0x00000001u;
         /* 02072680 */ if (_t2) goto L_02072684; else goto L_020726B0;
   L_02072684: ; // 0x2072684
         /* 02072684 */ _t3 = cpu->r[3] + 0x0000021Cu;
         /* 02072684 */ cpu->r[8] = rbrew_read32(cpu->mem, _t3);
-        /* 02072688 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
+        /* 02072688 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
         /* 0207268C */ _t4 = cpu->r[3] + 0x00000220u;
         /* 0207268C */ cpu->r[12] = rbrew_read32(cpu->mem, _t4);
-        /* 02072690 */ _t5 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02072690 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02072690 */ _t6 = _t5 & 0x00000001u;
         /* 02072690 */ if (_t6) goto L_02072694; else goto L_0207269C;
   L_02072694: ; // 0x2072694
@@ -1847,8 +1847,8 @@ void Gambit_fn_02072668(CPUState* cpu) {
         /* 020726A0 */ _t8 = cpu->r[12] + 0x00000118u;
         /* 020726A0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t8);
         /* 020726A4 */ cpu->r[10] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 020726A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020726A8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020726A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020726A8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020726A8 */ _t10 = _t9 & 0x00000001u;
         /* 020726A8 */ if (_t10) goto L_020726B0; else goto L_020726AC;
   L_020726AC: ; // 0x20726ac
@@ -1877,18 +1877,18 @@ void Gambit_fn_020726B8(CPUState* cpu) {
         /* 020726D0 */ cpu->r[10] = rbrew_read16(cpu->mem, _t3);
         /* 020726D4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000010u, 0x0000001Fu);
         /* 020726D8 */ cpu->r[9] = cpu->r[10] & cpu->r[0];
-        /* 020726D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 020726D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 020726DC */ cpu->r[31] = 0x00000000u;
-        /* 020726E0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020726E0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020726E0 */ _t5 = _t4 & 0x00000001u;
         /* 020726E0 */ if (_t5) goto L_02072710; else goto L_020726E4;
   L_020726E4: ; // 0x20726e4
         /* 020726E4 */ _t6 = cpu->r[3] + 0x0000021Cu;
         /* 020726E4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t6);
-        /* 020726E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
+        /* 020726E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
         /* 020726EC */ _t7 = cpu->r[3] + 0x00000220u;
         /* 020726EC */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 020726F0 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020726F0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020726F0 */ _t9 = _t8 & 0x00000001u;
         /* 020726F0 */ if (_t9) goto L_020726F4; else goto L_020726FC;
   L_020726F4: ; // 0x20726f4
@@ -1898,8 +1898,8 @@ void Gambit_fn_020726B8(CPUState* cpu) {
         /* 020726FC */ _t10 = cpu->r[12] + 0x00000000u;
         /* 020726FC */ cpu->r[3] = rbrew_read32(cpu->mem, _t10);
         /* 02072700 */ Gambit_fn_020D0A1C(cpu);
-        /* 02072704 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02072708 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072704 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02072708 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072708 */ _t12 = _t11 & 0x00000001u;
         /* 02072708 */ if (_t12) goto L_02072710; else goto L_0207270C;
   L_0207270C: ; // 0x207270c
@@ -1933,18 +1933,18 @@ void Gambit_fn_020726BC(CPUState* cpu) {
         /* 020726D0 */ cpu->r[10] = rbrew_read16(cpu->mem, _t3);
         /* 020726D4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000010u, 0x0000001Fu);
         /* 020726D8 */ cpu->r[9] = cpu->r[10] & cpu->r[0];
-        /* 020726D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 020726D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 020726DC */ cpu->r[31] = 0x00000000u;
-        /* 020726E0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020726E0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020726E0 */ _t5 = _t4 & 0x00000001u;
         /* 020726E0 */ if (_t5) goto L_02072710; else goto L_020726E4;
   L_020726E4: ; // 0x20726e4
         /* 020726E4 */ _t6 = cpu->r[3] + 0x0000021Cu;
         /* 020726E4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t6);
-        /* 020726E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
+        /* 020726E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
         /* 020726EC */ _t7 = cpu->r[3] + 0x00000220u;
         /* 020726EC */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 020726F0 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020726F0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020726F0 */ _t9 = _t8 & 0x00000001u;
         /* 020726F0 */ if (_t9) goto L_020726F4; else goto L_020726FC;
   L_020726F4: ; // 0x20726f4
@@ -1954,8 +1954,8 @@ void Gambit_fn_020726BC(CPUState* cpu) {
         /* 020726FC */ _t10 = cpu->r[12] + 0x00000000u;
         /* 020726FC */ cpu->r[3] = rbrew_read32(cpu->mem, _t10);
         /* 02072700 */ Gambit_fn_020D0A1C(cpu);
-        /* 02072704 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02072708 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072704 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02072708 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072708 */ _t12 = _t11 & 0x00000001u;
         /* 02072708 */ if (_t12) goto L_02072710; else goto L_0207270C;
   L_0207270C: ; // 0x207270c
@@ -1990,18 +1990,18 @@ void Gambit_fn_02072728(CPUState* cpu) {
         /* 02072740 */ cpu->r[10] = rbrew_read16(cpu->mem, _t3);
         /* 02072744 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000010u, 0x0000001Fu);
         /* 02072748 */ cpu->r[9] = cpu->r[10] & cpu->r[0];
-        /* 02072748 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02072748 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0207274C */ cpu->r[31] = 0x00000000u;
-        /* 02072750 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072750 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072750 */ _t5 = _t4 & 0x00000001u;
         /* 02072750 */ if (_t5) goto L_02072754; else goto L_02072780;
   L_02072754: ; // 0x2072754
         /* 02072754 */ _t6 = cpu->r[3] + 0x0000021Cu;
         /* 02072754 */ cpu->r[11] = rbrew_read32(cpu->mem, _t6);
-        /* 02072758 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
+        /* 02072758 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
         /* 0207275C */ _t7 = cpu->r[3] + 0x00000220u;
         /* 0207275C */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 02072760 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02072760 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02072760 */ _t9 = _t8 & 0x00000001u;
         /* 02072760 */ if (_t9) goto L_02072764; else goto L_0207276C;
   L_02072764: ; // 0x2072764
@@ -2011,8 +2011,8 @@ void Gambit_fn_02072728(CPUState* cpu) {
         /* 0207276C */ _t10 = cpu->r[12] + 0x00000000u;
         /* 0207276C */ cpu->r[3] = rbrew_read32(cpu->mem, _t10);
         /* 02072770 */ Gambit_fn_020D0B68(cpu);
-        /* 02072774 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02072778 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072774 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02072778 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072778 */ _t12 = _t11 & 0x00000001u;
         /* 02072778 */ if (_t12) goto L_02072780; else goto L_0207277C;
   L_0207277C: ; // 0x207277c
@@ -2046,18 +2046,18 @@ void Gambit_fn_0207272C(CPUState* cpu) {
         /* 02072740 */ cpu->r[10] = rbrew_read16(cpu->mem, _t3);
         /* 02072744 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000010u, 0x0000001Fu);
         /* 02072748 */ cpu->r[9] = cpu->r[10] & cpu->r[0];
-        /* 02072748 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02072748 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0207274C */ cpu->r[31] = 0x00000000u;
-        /* 02072750 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072750 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072750 */ _t5 = _t4 & 0x00000001u;
         /* 02072750 */ if (_t5) goto L_02072754; else goto L_02072780;
   L_02072754: ; // 0x2072754
         /* 02072754 */ _t6 = cpu->r[3] + 0x0000021Cu;
         /* 02072754 */ cpu->r[11] = rbrew_read32(cpu->mem, _t6);
-        /* 02072758 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
+        /* 02072758 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
         /* 0207275C */ _t7 = cpu->r[3] + 0x00000220u;
         /* 0207275C */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 02072760 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02072760 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02072760 */ _t9 = _t8 & 0x00000001u;
         /* 02072760 */ if (_t9) goto L_02072764; else goto L_0207276C;
   L_02072764: ; // 0x2072764
@@ -2067,8 +2067,8 @@ void Gambit_fn_0207272C(CPUState* cpu) {
         /* 0207276C */ _t10 = cpu->r[12] + 0x00000000u;
         /* 0207276C */ cpu->r[3] = rbrew_read32(cpu->mem, _t10);
         /* 02072770 */ Gambit_fn_020D0B68(cpu);
-        /* 02072774 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02072778 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072774 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02072778 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072778 */ _t12 = _t11 & 0x00000001u;
         /* 02072778 */ if (_t12) goto L_02072780; else goto L_0207277C;
   L_0207277C: ; // 0x207277c
@@ -2091,10 +2091,10 @@ void Gambit_fn_02072798(CPUState* cpu) {
   L_02072798: ; // 0x2072798
         /* 02072798 */ _t0 = cpu->r[3] + 0x00000234u;
         /* 02072798 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
-        /* 0207279C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[0]);
+        /* 0207279C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[0]));
         /* 020727A0 */ _t1 = cpu->r[3] + 0x00000238u;
         /* 020727A0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
-        /* 020727A4 */ _t2 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020727A4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020727A4 */ _t3 = _t2 & 0x00000001u;
         /* 020727A4 */ if (_t3) goto L_020727A8; else goto L_020727B0;
   L_020727A8: ; // 0x20727a8
@@ -2152,32 +2152,32 @@ void Gambit_fn_020727BC(CPUState* cpu) {
         /* 020727E4 */ /* nop */
         /* 020727E8 */ _t6 = cpu->r[29] + 0x0000023Cu;
         /* 020727E8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 020727EC */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020727EC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020727EC */ _t8 = _t7 & 0x00000001u;
         /* 020727EC */ if (_t8) goto L_020727F0; else goto L_02072804;
   L_020727F0: ; // 0x20727f0
-        /* 020727F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
+        /* 020727F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
         /* 020727F4 */ _t9 = cpu->r[29] + 0x00000240u;
         /* 020727F4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t9);
         /* 020727F8 */ cpu->r[4] = 0x00000001u;
-        /* 020727FC */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020727FC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020727FC */ _t11 = _t10 & 0x00000001u;
         /* 020727FC */ if (_t11) goto L_02072820; else goto L_02072800;
   L_02072800: ; // 0x2072800
         /* 02072800 */ goto L_02072828;
   L_02072804: ; // 0x2072804
-        /* 02072804 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000013u);
-        /* 02072808 */ _t12 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02072804 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000013u));
+        /* 02072808 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02072808 */ _t13 = _t12 & 0x00000001u;
         /* 02072808 */ if (_t13) goto L_0207280C; else goto L_02072810;
   L_0207280C: ; // 0x207280c
         /* 0207280C */ cpu->r[8] = 0x00000013u;
   L_02072810: ; // 0x2072810
-        /* 02072810 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
+        /* 02072810 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
         /* 02072814 */ _t14 = cpu->r[29] + 0x00000240u;
         /* 02072814 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 02072818 */ cpu->r[4] = cpu->r[8] + 0x00000001u;
-        /* 0207281C */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207281C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207281C */ _t16 = _t15 & 0x00000001u;
         /* 0207281C */ if (_t16) goto L_02072820; else goto L_02072800;
   L_02072820: ; // 0x2072820
@@ -2193,31 +2193,31 @@ void Gambit_fn_020727BC(CPUState* cpu) {
         /* 02072838 */ /* nop */
         /* 0207283C */ _t19 = cpu->r[29] + 0x00000244u;
         /* 0207283C */ cpu->r[10] = rbrew_read32(cpu->mem, _t19);
-        /* 02072840 */ _t20 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02072840 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02072840 */ _t21 = _t20 & 0x00000001u;
         /* 02072840 */ if (_t21) goto L_02072844; else goto L_02072858;
   L_02072844: ; // 0x2072844
-        /* 02072844 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[10]);
+        /* 02072844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[10]));
         /* 02072848 */ _t22 = cpu->r[29] + 0x00000248u;
         /* 02072848 */ cpu->r[12] = rbrew_read32(cpu->mem, _t22);
         /* 0207284C */ cpu->r[4] = 0x00000000u;
-        /* 02072850 */ _t23 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02072850 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02072850 */ _t24 = _t23 & 0x00000001u;
         /* 02072850 */ if (_t24) goto L_02072870; else goto L_02072854;
   L_02072854: ; // 0x2072854
         /* 02072854 */ goto L_02072878;
   L_02072858: ; // 0x2072858
-        /* 02072858 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000008u);
-        /* 0207285C */ _t25 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02072858 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000008u));
+        /* 0207285C */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207285C */ _t26 = _t25 & 0x00000001u;
         /* 0207285C */ if (_t26) goto L_02072860; else goto L_02072864;
   L_02072860: ; // 0x2072860
         /* 02072860 */ cpu->r[4] = 0x00000008u;
   L_02072864: ; // 0x2072864
-        /* 02072864 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[10]);
+        /* 02072864 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[10]));
         /* 02072868 */ _t27 = cpu->r[29] + 0x00000248u;
         /* 02072868 */ cpu->r[12] = rbrew_read32(cpu->mem, _t27);
-        /* 0207286C */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207286C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207286C */ _t29 = _t28 & 0x00000001u;
         /* 0207286C */ if (_t29) goto L_02072870; else goto L_02072854;
   L_02072870: ; // 0x2072870
@@ -2232,12 +2232,12 @@ void Gambit_fn_020727BC(CPUState* cpu) {
         /* 02072884 */ /* nop */
         /* 02072888 */ _t32 = cpu->r[1] + 0x00000008u;
         /* 02072888 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
-        /* 0207288C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207288C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207288C */ _t34 = _t33 & 0x00000001u;
         /* 0207288C */ if (_t34) goto L_02072898; else goto L_02072890;
   L_02072890: ; // 0x2072890
-        /* 02072890 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 02072894 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072890 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 02072894 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072894 */ _t36 = _t35 & 0x00000001u;
         /* 02072894 */ if (_t36) goto L_02072898; else goto L_020728F8;
   L_02072898: ; // 0x2072898
@@ -2249,31 +2249,31 @@ void Gambit_fn_020727BC(CPUState* cpu) {
         /* 020728A4 */ /* nop */
         /* 020728A8 */ _t39 = cpu->r[29] + 0x0000024Cu;
         /* 020728A8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t39);
-        /* 020728AC */ _t40 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020728AC */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020728AC */ _t41 = _t40 & 0x00000001u;
         /* 020728AC */ if (_t41) goto L_020728B0; else goto L_020728C4;
   L_020728B0: ; // 0x20728b0
-        /* 020728B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
+        /* 020728B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
         /* 020728B4 */ _t42 = cpu->r[29] + 0x00000250u;
         /* 020728B4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t42);
         /* 020728B8 */ cpu->r[6] = 0x00000000u;
-        /* 020728BC */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020728BC */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020728BC */ _t44 = _t43 & 0x00000001u;
         /* 020728BC */ if (_t44) goto L_020728DC; else goto L_020728C0;
   L_020728C0: ; // 0x20728c0
         /* 020728C0 */ goto L_020728E4;
   L_020728C4: ; // 0x20728c4
-        /* 020728C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000004u);
-        /* 020728C8 */ _t45 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020728C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000004u));
+        /* 020728C8 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020728C8 */ _t46 = _t45 & 0x00000001u;
         /* 020728C8 */ if (_t46) goto L_020728CC; else goto L_020728D0;
   L_020728CC: ; // 0x20728cc
         /* 020728CC */ cpu->r[6] = 0x00000004u;
   L_020728D0: ; // 0x20728d0
-        /* 020728D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
+        /* 020728D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
         /* 020728D4 */ _t47 = cpu->r[29] + 0x00000250u;
         /* 020728D4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t47);
-        /* 020728D8 */ _t48 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020728D8 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020728D8 */ _t49 = _t48 & 0x00000001u;
         /* 020728D8 */ if (_t49) goto L_020728DC; else goto L_020728C0;
   L_020728DC: ; // 0x20728dc
@@ -2326,32 +2326,32 @@ void Gambit_fn_020727C0(CPUState* cpu) {
         /* 020727E4 */ /* nop */
         /* 020727E8 */ _t6 = cpu->r[29] + 0x0000023Cu;
         /* 020727E8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 020727EC */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020727EC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020727EC */ _t8 = _t7 & 0x00000001u;
         /* 020727EC */ if (_t8) goto L_020727F0; else goto L_02072804;
   L_020727F0: ; // 0x20727f0
-        /* 020727F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
+        /* 020727F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
         /* 020727F4 */ _t9 = cpu->r[29] + 0x00000240u;
         /* 020727F4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t9);
         /* 020727F8 */ cpu->r[4] = 0x00000001u;
-        /* 020727FC */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020727FC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020727FC */ _t11 = _t10 & 0x00000001u;
         /* 020727FC */ if (_t11) goto L_02072820; else goto L_02072800;
   L_02072800: ; // 0x2072800
         /* 02072800 */ goto L_02072828;
   L_02072804: ; // 0x2072804
-        /* 02072804 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000013u);
-        /* 02072808 */ _t12 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02072804 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000013u));
+        /* 02072808 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02072808 */ _t13 = _t12 & 0x00000001u;
         /* 02072808 */ if (_t13) goto L_0207280C; else goto L_02072810;
   L_0207280C: ; // 0x207280c
         /* 0207280C */ cpu->r[8] = 0x00000013u;
   L_02072810: ; // 0x2072810
-        /* 02072810 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
+        /* 02072810 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
         /* 02072814 */ _t14 = cpu->r[29] + 0x00000240u;
         /* 02072814 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 02072818 */ cpu->r[4] = cpu->r[8] + 0x00000001u;
-        /* 0207281C */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207281C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207281C */ _t16 = _t15 & 0x00000001u;
         /* 0207281C */ if (_t16) goto L_02072820; else goto L_02072800;
   L_02072820: ; // 0x2072820
@@ -2367,31 +2367,31 @@ void Gambit_fn_020727C0(CPUState* cpu) {
         /* 02072838 */ /* nop */
         /* 0207283C */ _t19 = cpu->r[29] + 0x00000244u;
         /* 0207283C */ cpu->r[10] = rbrew_read32(cpu->mem, _t19);
-        /* 02072840 */ _t20 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02072840 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02072840 */ _t21 = _t20 & 0x00000001u;
         /* 02072840 */ if (_t21) goto L_02072844; else goto L_02072858;
   L_02072844: ; // 0x2072844
-        /* 02072844 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[10]);
+        /* 02072844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[10]));
         /* 02072848 */ _t22 = cpu->r[29] + 0x00000248u;
         /* 02072848 */ cpu->r[12] = rbrew_read32(cpu->mem, _t22);
         /* 0207284C */ cpu->r[4] = 0x00000000u;
-        /* 02072850 */ _t23 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02072850 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02072850 */ _t24 = _t23 & 0x00000001u;
         /* 02072850 */ if (_t24) goto L_02072870; else goto L_02072854;
   L_02072854: ; // 0x2072854
         /* 02072854 */ goto L_02072878;
   L_02072858: ; // 0x2072858
-        /* 02072858 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000008u);
-        /* 0207285C */ _t25 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02072858 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000008u));
+        /* 0207285C */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207285C */ _t26 = _t25 & 0x00000001u;
         /* 0207285C */ if (_t26) goto L_02072860; else goto L_02072864;
   L_02072860: ; // 0x2072860
         /* 02072860 */ cpu->r[4] = 0x00000008u;
   L_02072864: ; // 0x2072864
-        /* 02072864 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[10]);
+        /* 02072864 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[10]));
         /* 02072868 */ _t27 = cpu->r[29] + 0x00000248u;
         /* 02072868 */ cpu->r[12] = rbrew_read32(cpu->mem, _t27);
-        /* 0207286C */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207286C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207286C */ _t29 = _t28 & 0x00000001u;
         /* 0207286C */ if (_t29) goto L_02072870; else goto L_02072854;
   L_02072870: ; // 0x2072870
@@ -2406,12 +2406,12 @@ void Gambit_fn_020727C0(CPUState* cpu) {
         /* 02072884 */ /* nop */
         /* 02072888 */ _t32 = cpu->r[1] + 0x00000008u;
         /* 02072888 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
-        /* 0207288C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207288C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207288C */ _t34 = _t33 & 0x00000001u;
         /* 0207288C */ if (_t34) goto L_02072898; else goto L_02072890;
   L_02072890: ; // 0x2072890
-        /* 02072890 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 02072894 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072890 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 02072894 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072894 */ _t36 = _t35 & 0x00000001u;
         /* 02072894 */ if (_t36) goto L_02072898; else goto L_020728F8;
   L_02072898: ; // 0x2072898
@@ -2423,31 +2423,31 @@ void Gambit_fn_020727C0(CPUState* cpu) {
         /* 020728A4 */ /* nop */
         /* 020728A8 */ _t39 = cpu->r[29] + 0x0000024Cu;
         /* 020728A8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t39);
-        /* 020728AC */ _t40 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020728AC */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020728AC */ _t41 = _t40 & 0x00000001u;
         /* 020728AC */ if (_t41) goto L_020728B0; else goto L_020728C4;
   L_020728B0: ; // 0x20728b0
-        /* 020728B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
+        /* 020728B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
         /* 020728B4 */ _t42 = cpu->r[29] + 0x00000250u;
         /* 020728B4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t42);
         /* 020728B8 */ cpu->r[6] = 0x00000000u;
-        /* 020728BC */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020728BC */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020728BC */ _t44 = _t43 & 0x00000001u;
         /* 020728BC */ if (_t44) goto L_020728DC; else goto L_020728C0;
   L_020728C0: ; // 0x20728c0
         /* 020728C0 */ goto L_020728E4;
   L_020728C4: ; // 0x20728c4
-        /* 020728C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000004u);
-        /* 020728C8 */ _t45 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020728C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000004u));
+        /* 020728C8 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020728C8 */ _t46 = _t45 & 0x00000001u;
         /* 020728C8 */ if (_t46) goto L_020728CC; else goto L_020728D0;
   L_020728CC: ; // 0x20728cc
         /* 020728CC */ cpu->r[6] = 0x00000004u;
   L_020728D0: ; // 0x20728d0
-        /* 020728D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
+        /* 020728D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
         /* 020728D4 */ _t47 = cpu->r[29] + 0x00000250u;
         /* 020728D4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t47);
-        /* 020728D8 */ _t48 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020728D8 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020728D8 */ _t49 = _t48 & 0x00000001u;
         /* 020728D8 */ if (_t49) goto L_020728DC; else goto L_020728C0;
   L_020728DC: ; // 0x20728dc
@@ -2536,7 +2536,7 @@ void Gambit_fn_02072914(CPUState* cpu) {
         /* 020729A4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t14);
         /* 020729A8 */ _t15 = cpu->r[1] + 0x00000010u;
         /* 020729A8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t15);
-        /* 020729AC */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020729AC */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020729AC */ _t17 = _t16 & 0x00000001u;
         /* 020729AC */ if (_t17) goto L_020729B0; // else: addr-0 trap, fall-through
   L_020729B0: ; // 0x20729b0
@@ -2602,10 +2602,10 @@ void Gambit_fn_020729C0(CPUState* cpu) {
   L_02072A50: ; // 0x2072a50
         /* 02072A50 */ _t10 = cpu->r[26] + 0x0000021Cu;
         /* 02072A50 */ cpu->r[0] = rbrew_read32(cpu->mem, _t10);
-        /* 02072A54 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[0]);
+        /* 02072A54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[0]));
         /* 02072A58 */ _t11 = cpu->r[26] + 0x00000220u;
         /* 02072A58 */ cpu->r[12] = rbrew_read32(cpu->mem, _t11);
-        /* 02072A5C */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02072A5C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02072A5C */ _t13 = _t12 & 0x00000001u;
         /* 02072A5C */ if (_t13) goto L_02072A60; else goto L_02072A64;
   L_02072A60: ; // 0x2072a60
@@ -2622,10 +2622,10 @@ void Gambit_fn_020729C0(CPUState* cpu) {
         /* 02072A78 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 02072A7C */ Gambit_fn_027ED2B0(cpu);
         /* 02072A80 */ cpu->r[27] = cpu->r[27] + 0xFFFFFFFFu;
-        /* 02072A80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02072A80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02072A84 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
         /* 02072A88 */ cpu->r[29] = cpu->r[29] + 0x00000004u;
-        /* 02072A8C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072A8C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072A8C */ _t18 = _t17 & 0x00000001u;
         /* 02072A8C */ if (_t18) goto L_02072A90; else goto L_02072A50;
   L_02072A90: ; // 0x2072a90
@@ -2634,7 +2634,7 @@ void Gambit_fn_020729C0(CPUState* cpu) {
         /* 02072A94 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t19);
         /* 02072A98 */ _t20 = cpu->r[1] + 0x00000030u;
         /* 02072A98 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t20);
-        /* 02072A9C */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02072A9C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02072A9C */ _t22 = _t21 & 0x00000001u;
         /* 02072A9C */ if (_t22) goto L_02072AA0; // else: addr-0 trap, fall-through
   L_02072AA0: ; // 0x2072aa0
@@ -2690,17 +2690,17 @@ void Gambit_fn_02072AB0(CPUState* cpu) {
         /* 02072B1C */ cpu->r[5] = cpu->r[21];
         /* 02072B20 */ cpu->r[4] = cpu->r[24] + 0xFFFF9C08u;
         /* 02072B24 */ cpu->r[3] = cpu->r[1] + 0x00000014u;
-        /* 02072B28 */ _t8 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02072B28 */ _t8 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02072B28 */ _t9 = _t8 & 0x00000001u;
         /* 02072B28 */ if (_t9) goto L_02072B2C; // else: addr-0 trap, fall-through
   L_02072B2C: ; // 0x2072b2c
         /* 02072B2C */ Gambit_fn_0282A5F4(cpu);
         /* 02072B30 */ _t10 = cpu->r[28] + 0x0000021Cu;
         /* 02072B30 */ cpu->r[7] = rbrew_read32(cpu->mem, _t10);
-        /* 02072B34 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[21], cpu->r[7]);
+        /* 02072B34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[21], cpu->r[7]));
         /* 02072B38 */ _t11 = cpu->r[28] + 0x00000220u;
         /* 02072B38 */ cpu->r[29] = rbrew_read32(cpu->mem, _t11);
-        /* 02072B3C */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02072B3C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02072B3C */ _t13 = _t12 & 0x00000001u;
         /* 02072B3C */ if (_t13) goto L_02072B40; else goto L_02072B44;
   L_02072B40: ; // 0x2072b40
@@ -2711,9 +2711,9 @@ void Gambit_fn_02072AB0(CPUState* cpu) {
         /* 02072B4C */ Gambit_fn_026D86B0(cpu);
         /* 02072B50 */ _t14 = cpu->r[26] + 0xFFFFDBA0u;
         /* 02072B50 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
-        /* 02072B54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02072B54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02072B58 */ cpu->r[31] = cpu->r[3];
-        /* 02072B5C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072B5C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072B5C */ _t16 = _t15 & 0x00000001u;
         /* 02072B5C */ if (_t16) goto L_02072B60; else goto L_02072B68;
   L_02072B60: ; // 0x2072b60
@@ -2722,8 +2722,8 @@ void Gambit_fn_02072AB0(CPUState* cpu) {
         /* 02072B64 */ _t18 = cpu->r[26] + 0xFFFFDBA0u;
         /* 02072B64 */ rbrew_write32(cpu->mem, _t18, cpu->r[23]);
   L_02072B68: ; // 0x2072b68
-        /* 02072B68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02072B6C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072B68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02072B6C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072B6C */ _t20 = _t19 & 0x00000001u;
         /* 02072B6C */ if (_t20) goto L_02072B90; else goto L_02072B70;
   L_02072B70: ; // 0x2072b70
@@ -2735,8 +2735,8 @@ void Gambit_fn_02072AB0(CPUState* cpu) {
         /* 02072B7C */ cpu->r[4] = cpu->r[30] + 0xFFFFED90u;
         /* 02072B80 */ cpu->r[3] = cpu->r[31];
         /* 02072B84 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02072B88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02072B8C */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072B88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02072B8C */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072B8C */ _t24 = _t23 & 0x00000001u;
         /* 02072B8C */ if (_t24) goto L_02072B90; else goto L_02072B94;
   L_02072B90: ; // 0x2072b90
@@ -2745,10 +2745,10 @@ void Gambit_fn_02072AB0(CPUState* cpu) {
         /* 02072B94 */ _t25 = cpu->r[29] + 0x00000000u;
         /* 02072B94 */ rbrew_write32(cpu->mem, _t25, cpu->r[31]);
         /* 02072B98 */ cpu->r[20] = cpu->r[20] + 0xFFFFFFFFu;
-        /* 02072B98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
+        /* 02072B98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
         /* 02072B9C */ cpu->r[21] = cpu->r[21] + 0x00000001u;
         /* 02072BA0 */ cpu->r[22] = cpu->r[22] + 0x00000004u;
-        /* 02072BA4 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072BA4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072BA4 */ _t27 = _t26 & 0x00000001u;
         /* 02072BA4 */ if (_t27) goto L_02072BA8; else goto L_02072B1C;
   L_02072BA8: ; // 0x2072ba8
@@ -2763,17 +2763,17 @@ void Gambit_fn_02072AB0(CPUState* cpu) {
         /* 02072BC4 */ cpu->r[5] = cpu->r[23];
         /* 02072BC8 */ cpu->r[4] = cpu->r[24] + 0xFFFF9C18u;
         /* 02072BCC */ cpu->r[3] = cpu->r[1] + 0x00000014u;
-        /* 02072BD0 */ _t28 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02072BD0 */ _t28 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02072BD0 */ _t29 = _t28 & 0x00000001u;
         /* 02072BD0 */ if (_t29) goto L_02072BD4; // else: addr-0 trap, fall-through
   L_02072BD4: ; // 0x2072bd4
         /* 02072BD4 */ Gambit_fn_0282A5F4(cpu);
         /* 02072BD8 */ _t30 = cpu->r[28] + 0x00000224u;
         /* 02072BD8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t30);
-        /* 02072BDC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], cpu->r[0]);
+        /* 02072BDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], cpu->r[0]));
         /* 02072BE0 */ _t31 = cpu->r[28] + 0x00000228u;
         /* 02072BE0 */ cpu->r[29] = rbrew_read32(cpu->mem, _t31);
-        /* 02072BE4 */ _t32 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02072BE4 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02072BE4 */ _t33 = _t32 & 0x00000001u;
         /* 02072BE4 */ if (_t33) goto L_02072BE8; else goto L_02072BEC;
   L_02072BE8: ; // 0x2072be8
@@ -2784,9 +2784,9 @@ void Gambit_fn_02072AB0(CPUState* cpu) {
         /* 02072BF4 */ Gambit_fn_026D86B0(cpu);
         /* 02072BF8 */ _t34 = cpu->r[21] + 0xFFFFED9Cu;
         /* 02072BF8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t34);
-        /* 02072BFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02072BFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02072C00 */ cpu->r[31] = cpu->r[3];
-        /* 02072C04 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072C04 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072C04 */ _t36 = _t35 & 0x00000001u;
         /* 02072C04 */ if (_t36) goto L_02072C08; else goto L_02072C18;
   L_02072C08: ; // 0x2072c08
@@ -2797,8 +2797,8 @@ void Gambit_fn_02072AB0(CPUState* cpu) {
         /* 02072C14 */ _t38 = cpu->r[20] + 0xFFFFEDDCu;
         /* 02072C14 */ rbrew_write32(cpu->mem, _t38, cpu->r[0]);
   L_02072C18: ; // 0x2072c18
-        /* 02072C18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02072C1C */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072C18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02072C1C */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072C1C */ _t40 = _t39 & 0x00000001u;
         /* 02072C1C */ if (_t40) goto L_02072C40; else goto L_02072C20;
   L_02072C20: ; // 0x2072c20
@@ -2810,8 +2810,8 @@ void Gambit_fn_02072AB0(CPUState* cpu) {
         /* 02072C2C */ cpu->r[3] = cpu->r[31];
         /* 02072C30 */ cpu->r[4] = cpu->r[20] + 0xFFFFEDDCu;
         /* 02072C34 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02072C38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02072C3C */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072C38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02072C3C */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072C3C */ _t44 = _t43 & 0x00000001u;
         /* 02072C3C */ if (_t44) goto L_02072C40; else goto L_02072C44;
   L_02072C40: ; // 0x2072c40
@@ -2821,8 +2821,8 @@ void Gambit_fn_02072AB0(CPUState* cpu) {
         /* 02072C44 */ rbrew_write32(cpu->mem, _t45, cpu->r[31]);
         /* 02072C48 */ _t46 = cpu->r[28] + 0x00000274u;
         /* 02072C48 */ cpu->r[0] = rbrew_read32(cpu->mem, _t46);
-        /* 02072C4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], cpu->r[0]);
-        /* 02072C50 */ _t47 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02072C4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], cpu->r[0]));
+        /* 02072C50 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02072C50 */ _t48 = _t47 & 0x00000001u;
         /* 02072C50 */ if (_t48) goto L_02072C54; else goto L_02072C84;
   L_02072C54: ; // 0x2072c54
@@ -2830,10 +2830,10 @@ void Gambit_fn_02072AB0(CPUState* cpu) {
         /* 02072C54 */ cpu->r[4] = rbrew_read32(cpu->mem, _t49);
         /* 02072C58 */ _t50 = cpu->r[28] + 0x00000228u;
         /* 02072C58 */ cpu->r[11] = rbrew_read32(cpu->mem, _t50);
-        /* 02072C5C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], cpu->r[4]);
+        /* 02072C5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], cpu->r[4]));
         /* 02072C60 */ _t51 = cpu->r[28] + 0x0000026Cu;
         /* 02072C60 */ cpu->r[0] = rbrew_read32(cpu->mem, _t51);
-        /* 02072C64 */ _t52 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02072C64 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02072C64 */ _t53 = _t52 & 0x00000001u;
         /* 02072C64 */ if (_t53) goto L_02072C68; else goto L_02072C6C;
   L_02072C68: ; // 0x2072c68
@@ -2849,10 +2849,10 @@ void Gambit_fn_02072AB0(CPUState* cpu) {
         /* 02072C80 */ Gambit_fn_020CF8DC(cpu);
   L_02072C84: ; // 0x2072c84
         /* 02072C84 */ cpu->r[18] = cpu->r[18] + 0xFFFFFFFFu;
-        /* 02072C84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[18], 0x00000000u);
+        /* 02072C84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[18], 0x00000000u));
         /* 02072C88 */ cpu->r[23] = cpu->r[23] + 0x00000001u;
         /* 02072C8C */ cpu->r[19] = cpu->r[19] + 0x00000004u;
-        /* 02072C90 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072C90 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072C90 */ _t57 = _t56 & 0x00000001u;
         /* 02072C90 */ if (_t57) goto L_02072C94; else goto L_02072BC4;
   L_02072C94: ; // 0x2072c94
@@ -2871,9 +2871,9 @@ void Gambit_fn_02072AB0(CPUState* cpu) {
         /* 02072CB4 */ cpu->r[6] = _t60;
         /* 02072CB8 */ cpu->r[31] = cpu->r[3];
         /* 02072CBC */ cpu->r[4] = 0x101D0000u;
-        /* 02072CC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02072CC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02072CC4 */ cpu->r[4] = cpu->r[4] + 0xFFFFEDF4u;
-        /* 02072CC8 */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072CC8 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072CC8 */ _t62 = _t61 & 0x00000001u;
         /* 02072CC8 */ if (_t62) goto L_02072CCC; else goto L_02072CE0;
   L_02072CCC: ; // 0x2072ccc
@@ -2885,8 +2885,8 @@ void Gambit_fn_02072AB0(CPUState* cpu) {
         /* 02072CDC */ _t64 = cpu->r[4] + 0x00000000u;
         /* 02072CDC */ rbrew_write32(cpu->mem, _t64, cpu->r[12]);
   L_02072CE0: ; // 0x2072ce0
-        /* 02072CE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02072CE4 */ _t65 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072CE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02072CE4 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072CE4 */ _t66 = _t65 & 0x00000001u;
         /* 02072CE4 */ if (_t66) goto L_02072D04; else goto L_02072CE8;
   L_02072CE8: ; // 0x2072ce8
@@ -2897,8 +2897,8 @@ void Gambit_fn_02072AB0(CPUState* cpu) {
         /* 02072CF0 */ cpu->ctr = cpu->r[6];
         /* 02072CF4 */ cpu->r[3] = cpu->r[31];
         /* 02072CF8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02072CFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02072D00 */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072CFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02072D00 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072D00 */ _t70 = _t69 & 0x00000001u;
         /* 02072D00 */ if (_t70) goto L_02072D04; else goto L_02072D08;
   L_02072D04: ; // 0x2072d04
@@ -2917,9 +2917,9 @@ void Gambit_fn_02072AB0(CPUState* cpu) {
         /* 02072D24 */ Gambit_fn_026D86B0(cpu);
         /* 02072D28 */ _t74 = cpu->r[26] + 0xFFFFDBA0u;
         /* 02072D28 */ cpu->r[9] = rbrew_read32(cpu->mem, _t74);
-        /* 02072D2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02072D2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02072D30 */ cpu->r[31] = cpu->r[3];
-        /* 02072D34 */ _t75 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072D34 */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072D34 */ _t76 = _t75 & 0x00000001u;
         /* 02072D34 */ if (_t76) goto L_02072D38; else goto L_02072D44;
   L_02072D38: ; // 0x2072d38
@@ -2929,8 +2929,8 @@ void Gambit_fn_02072AB0(CPUState* cpu) {
         /* 02072D40 */ _t78 = cpu->r[26] + 0xFFFFDBA0u;
         /* 02072D40 */ rbrew_write32(cpu->mem, _t78, cpu->r[10]);
   L_02072D44: ; // 0x2072d44
-        /* 02072D44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02072D48 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072D44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02072D48 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072D48 */ _t80 = _t79 & 0x00000001u;
         /* 02072D48 */ if (_t80) goto L_02072D6C; else goto L_02072D4C;
   L_02072D4C: ; // 0x2072d4c
@@ -2942,8 +2942,8 @@ void Gambit_fn_02072AB0(CPUState* cpu) {
         /* 02072D58 */ cpu->r[3] = cpu->r[31];
         /* 02072D5C */ cpu->r[4] = cpu->r[30] + 0xFFFFED90u;
         /* 02072D60 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02072D64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02072D68 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02072D64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02072D68 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02072D68 */ _t84 = _t83 & 0x00000001u;
         /* 02072D68 */ if (_t84) goto L_02072D6C; else goto L_02072D70;
   L_02072D6C: ; // 0x2072d6c
@@ -3133,10 +3133,10 @@ void Gambit_fn_02072D88(CPUState* cpu) {
   L_02072F6C: ; // 0x2072f6c
         /* 02072F6C */ _t44 = cpu->r[31] + 0x0000021Cu;
         /* 02072F6C */ cpu->r[6] = rbrew_read32(cpu->mem, _t44);
-        /* 02072F70 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], cpu->r[6]);
+        /* 02072F70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], cpu->r[6]));
         /* 02072F74 */ _t45 = cpu->r[31] + 0x00000220u;
         /* 02072F74 */ cpu->r[8] = rbrew_read32(cpu->mem, _t45);
-        /* 02072F78 */ _t46 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02072F78 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02072F78 */ _t47 = _t46 & 0x00000001u;
         /* 02072F78 */ if (_t47) goto L_02072F7C; else goto L_02072F80;
   L_02072F7C: ; // 0x2072f7c
@@ -3157,10 +3157,10 @@ void Gambit_fn_02072D88(CPUState* cpu) {
         /* 02072F9C */ Gambit_fn_027ED060(cpu);
         /* 02072FA0 */ _t53 = cpu->r[31] + 0x0000021Cu;
         /* 02072FA0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t53);
-        /* 02072FA4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], cpu->r[7]);
+        /* 02072FA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], cpu->r[7]));
         /* 02072FA8 */ _t54 = cpu->r[31] + 0x00000220u;
         /* 02072FA8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t54);
-        /* 02072FAC */ _t55 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02072FAC */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02072FAC */ _t56 = _t55 & 0x00000001u;
         /* 02072FAC */ if (_t56) goto L_02072FB0; else goto L_02072FB4;
   L_02072FB0: ; // 0x2072fb0
@@ -3181,10 +3181,10 @@ void Gambit_fn_02072D88(CPUState* cpu) {
         /* 02072FD0 */ Gambit_fn_027ED060(cpu);
         /* 02072FD4 */ _t62 = cpu->r[31] + 0x0000021Cu;
         /* 02072FD4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t62);
-        /* 02072FD8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], cpu->r[8]);
+        /* 02072FD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], cpu->r[8]));
         /* 02072FDC */ _t63 = cpu->r[31] + 0x00000220u;
         /* 02072FDC */ cpu->r[9] = rbrew_read32(cpu->mem, _t63);
-        /* 02072FE0 */ _t64 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02072FE0 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02072FE0 */ _t65 = _t64 & 0x00000001u;
         /* 02072FE0 */ if (_t65) goto L_02072FE4; else goto L_02072FE8;
   L_02072FE4: ; // 0x2072fe4
@@ -3203,10 +3203,10 @@ void Gambit_fn_02072D88(CPUState* cpu) {
         /* 02073000 */ cpu->r[0] = rbrew_read32(cpu->mem, _t69);
         /* 02073004 */ _t70 = cpu->r[31] + 0x00000220u;
         /* 02073004 */ cpu->r[11] = rbrew_read32(cpu->mem, _t70);
-        /* 02073008 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], cpu->r[0]);
+        /* 02073008 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], cpu->r[0]));
         /* 0207300C */ _t71 = cpu->r[31] + 0x0000026Cu;
         /* 0207300C */ cpu->r[0] = rbrew_read32(cpu->mem, _t71);
-        /* 02073010 */ _t72 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02073010 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02073010 */ _t73 = _t72 & 0x00000001u;
         /* 02073010 */ if (_t73) goto L_02073014; else goto L_02073018;
   L_02073014: ; // 0x2073014
@@ -3223,10 +3223,10 @@ void Gambit_fn_02072D88(CPUState* cpu) {
         /* 0207302C */ cpu->r[0] = rbrew_read32(cpu->mem, _t76);
         /* 02073030 */ _t77 = cpu->r[31] + 0x00000220u;
         /* 02073030 */ cpu->r[12] = rbrew_read32(cpu->mem, _t77);
-        /* 02073034 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], cpu->r[0]);
+        /* 02073034 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], cpu->r[0]));
         /* 02073038 */ _t78 = cpu->r[31] + 0x0000026Cu;
         /* 02073038 */ cpu->r[0] = rbrew_read32(cpu->mem, _t78);
-        /* 0207303C */ _t79 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207303C */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207303C */ _t80 = _t79 & 0x00000001u;
         /* 0207303C */ if (_t80) goto L_02073040; else goto L_02073044;
   L_02073040: ; // 0x2073040
@@ -3240,10 +3240,10 @@ void Gambit_fn_02072D88(CPUState* cpu) {
         /* 02073050 */ cpu->r[4] = 0x00000001u;
         /* 02073054 */ Gambit_fn_020EC310(cpu);
         /* 02073058 */ cpu->r[24] = cpu->r[24] + 0xFFFFFFFFu;
-        /* 02073058 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 02073058 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 0207305C */ cpu->r[23] = cpu->r[23] + 0x00000001u;
         /* 02073060 */ cpu->r[25] = cpu->r[25] + 0x00000004u;
-        /* 02073064 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073064 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073064 */ _t84 = _t83 & 0x00000001u;
         /* 02073064 */ if (_t84) goto L_02073068; else goto L_02072F6C;
   L_02073068: ; // 0x2073068
@@ -3298,17 +3298,17 @@ void Gambit_fn_0207307C(CPUState* cpu) {
         /* 020730E0 */ cpu->r[5] = cpu->r[26];
         /* 020730E4 */ cpu->r[4] = cpu->r[22] + 0xFFFF9CDCu;
         /* 020730E8 */ cpu->r[3] = cpu->r[1] + 0x00000014u;
-        /* 020730EC */ _t8 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020730EC */ _t8 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020730EC */ _t9 = _t8 & 0x00000001u;
         /* 020730EC */ if (_t9) goto L_020730F0; // else: addr-0 trap, fall-through
   L_020730F0: ; // 0x20730f0
         /* 020730F0 */ Gambit_fn_0282A5F4(cpu);
         /* 020730F4 */ _t10 = cpu->r[30] + 0x00000234u;
         /* 020730F4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t10);
-        /* 020730F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], cpu->r[0]);
+        /* 020730F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], cpu->r[0]));
         /* 020730FC */ _t11 = cpu->r[30] + 0x00000238u;
         /* 020730FC */ cpu->r[31] = rbrew_read32(cpu->mem, _t11);
-        /* 02073100 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02073100 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02073100 */ _t13 = _t12 & 0x00000001u;
         /* 02073100 */ if (_t13) goto L_02073104; else goto L_02073108;
   L_02073104: ; // 0x2073104
@@ -3323,17 +3323,17 @@ void Gambit_fn_0207307C(CPUState* cpu) {
         /* 0207311C */ cpu->r[5] = cpu->r[26];
         /* 02073120 */ cpu->r[4] = cpu->r[23] + 0xFFFF9CF8u;
         /* 02073124 */ cpu->r[3] = cpu->r[1] + 0x00000014u;
-        /* 02073128 */ _t15 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02073128 */ _t15 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02073128 */ _t16 = _t15 & 0x00000001u;
         /* 02073128 */ if (_t16) goto L_0207312C; // else: addr-0 trap, fall-through
   L_0207312C: ; // 0x207312c
         /* 0207312C */ Gambit_fn_0282A5F4(cpu);
         /* 02073130 */ _t17 = cpu->r[30] + 0x0000023Cu;
         /* 02073130 */ cpu->r[0] = rbrew_read32(cpu->mem, _t17);
-        /* 02073134 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], cpu->r[0]);
+        /* 02073134 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], cpu->r[0]));
         /* 02073138 */ _t18 = cpu->r[30] + 0x00000240u;
         /* 02073138 */ cpu->r[31] = rbrew_read32(cpu->mem, _t18);
-        /* 0207313C */ _t19 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207313C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207313C */ _t20 = _t19 & 0x00000001u;
         /* 0207313C */ if (_t20) goto L_02073140; else goto L_02073144;
   L_02073140: ; // 0x2073140
@@ -3348,17 +3348,17 @@ void Gambit_fn_0207307C(CPUState* cpu) {
         /* 02073158 */ cpu->r[5] = cpu->r[26];
         /* 0207315C */ cpu->r[4] = cpu->r[24] + 0xFFFF9D20u;
         /* 02073160 */ cpu->r[3] = cpu->r[1] + 0x00000014u;
-        /* 02073164 */ _t22 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02073164 */ _t22 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02073164 */ _t23 = _t22 & 0x00000001u;
         /* 02073164 */ if (_t23) goto L_02073168; // else: addr-0 trap, fall-through
   L_02073168: ; // 0x2073168
         /* 02073168 */ Gambit_fn_0282A5F4(cpu);
         /* 0207316C */ _t24 = cpu->r[30] + 0x00000244u;
         /* 0207316C */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
-        /* 02073170 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], cpu->r[0]);
+        /* 02073170 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], cpu->r[0]));
         /* 02073174 */ _t25 = cpu->r[30] + 0x00000248u;
         /* 02073174 */ cpu->r[31] = rbrew_read32(cpu->mem, _t25);
-        /* 02073178 */ _t26 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02073178 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02073178 */ _t27 = _t26 & 0x00000001u;
         /* 02073178 */ if (_t27) goto L_0207317C; else goto L_02073180;
   L_0207317C: ; // 0x207317c
@@ -3373,17 +3373,17 @@ void Gambit_fn_0207307C(CPUState* cpu) {
         /* 02073194 */ cpu->r[5] = cpu->r[26];
         /* 02073198 */ cpu->r[4] = cpu->r[25] + 0xFFFF9CC4u;
         /* 0207319C */ cpu->r[3] = cpu->r[1] + 0x00000014u;
-        /* 020731A0 */ _t29 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020731A0 */ _t29 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020731A0 */ _t30 = _t29 & 0x00000001u;
         /* 020731A0 */ if (_t30) goto L_020731A4; // else: addr-0 trap, fall-through
   L_020731A4: ; // 0x20731a4
         /* 020731A4 */ Gambit_fn_0282A5F4(cpu);
         /* 020731A8 */ _t31 = cpu->r[30] + 0x0000024Cu;
         /* 020731A8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t31);
-        /* 020731AC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], cpu->r[0]);
+        /* 020731AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], cpu->r[0]));
         /* 020731B0 */ _t32 = cpu->r[30] + 0x00000250u;
         /* 020731B0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t32);
-        /* 020731B4 */ _t33 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020731B4 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020731B4 */ _t34 = _t33 & 0x00000001u;
         /* 020731B4 */ if (_t34) goto L_020731B8; else goto L_020731BC;
   L_020731B8: ; // 0x20731b8
@@ -3396,10 +3396,10 @@ void Gambit_fn_0207307C(CPUState* cpu) {
         /* 020731CC */ _t35 = cpu->r[31] + 0x00000000u;
         /* 020731CC */ rbrew_write32(cpu->mem, _t35, cpu->r[3]);
         /* 020731D0 */ cpu->r[27] = cpu->r[27] + 0xFFFFFFFFu;
-        /* 020731D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020731D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020731D4 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 020731D8 */ cpu->r[28] = cpu->r[28] + 0x00000004u;
-        /* 020731DC */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020731DC */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020731DC */ _t37 = _t36 & 0x00000001u;
         /* 020731DC */ if (_t37) goto L_020731E0; else goto L_020730E0;
   L_020731E0: ; // 0x20731e0
@@ -3411,17 +3411,17 @@ void Gambit_fn_0207307C(CPUState* cpu) {
         /* 020731F0 */ cpu->r[5] = cpu->r[26];
         /* 020731F4 */ cpu->r[4] = cpu->r[25] + 0xFFFF9D40u;
         /* 020731F8 */ cpu->r[3] = cpu->r[1] + 0x00000014u;
-        /* 020731FC */ _t38 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020731FC */ _t38 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020731FC */ _t39 = _t38 & 0x00000001u;
         /* 020731FC */ if (_t39) goto L_02073200; // else: addr-0 trap, fall-through
   L_02073200: ; // 0x2073200
         /* 02073200 */ Gambit_fn_0282A5F4(cpu);
         /* 02073204 */ _t40 = cpu->r[30] + 0x00000254u;
         /* 02073204 */ cpu->r[10] = rbrew_read32(cpu->mem, _t40);
-        /* 02073208 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], cpu->r[10]);
+        /* 02073208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], cpu->r[10]));
         /* 0207320C */ _t41 = cpu->r[30] + 0x00000258u;
         /* 0207320C */ cpu->r[31] = rbrew_read32(cpu->mem, _t41);
-        /* 02073210 */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02073210 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02073210 */ _t43 = _t42 & 0x00000001u;
         /* 02073210 */ if (_t43) goto L_02073214; else goto L_02073218;
   L_02073214: ; // 0x2073214
@@ -3435,8 +3435,8 @@ void Gambit_fn_0207307C(CPUState* cpu) {
         /* 02073228 */ rbrew_write32(cpu->mem, _t44, cpu->r[3]);
         /* 0207322C */ _t45 = cpu->r[30] + 0x00000274u;
         /* 0207322C */ cpu->r[12] = rbrew_read32(cpu->mem, _t45);
-        /* 02073230 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[12]);
-        /* 02073234 */ _t46 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02073230 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[12]));
+        /* 02073234 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02073234 */ _t47 = _t46 & 0x00000001u;
         /* 02073234 */ if (_t47) goto L_02073238; else goto L_02073264;
   L_02073238: ; // 0x2073238
@@ -3444,10 +3444,10 @@ void Gambit_fn_0207307C(CPUState* cpu) {
         /* 02073238 */ cpu->r[0] = rbrew_read32(cpu->mem, _t48);
         /* 0207323C */ _t49 = cpu->r[30] + 0x00000258u;
         /* 0207323C */ cpu->r[10] = rbrew_read32(cpu->mem, _t49);
-        /* 02073240 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], cpu->r[0]);
+        /* 02073240 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], cpu->r[0]));
         /* 02073244 */ _t50 = cpu->r[30] + 0x0000026Cu;
         /* 02073244 */ cpu->r[4] = rbrew_read32(cpu->mem, _t50);
-        /* 02073248 */ _t51 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02073248 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02073248 */ _t52 = _t51 & 0x00000001u;
         /* 02073248 */ if (_t52) goto L_0207324C; else goto L_02073250;
   L_0207324C: ; // 0x207324c
@@ -3462,10 +3462,10 @@ void Gambit_fn_0207307C(CPUState* cpu) {
         /* 02073260 */ Gambit_fn_020A900C(cpu);
   L_02073264: ; // 0x2073264
         /* 02073264 */ cpu->r[27] = cpu->r[27] + 0xFFFFFFFFu;
-        /* 02073264 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02073264 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02073268 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0207326C */ cpu->r[28] = cpu->r[28] + 0x00000004u;
-        /* 02073270 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073270 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073270 */ _t56 = _t55 & 0x00000001u;
         /* 02073270 */ if (_t56) goto L_02073274; else goto L_020731F0;
   L_02073274: ; // 0x2073274
@@ -3494,11 +3494,11 @@ void Gambit_fn_0207307C(CPUState* cpu) {
         /* 020732B4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t61);
         /* 020732B8 */ _t62 = cpu->r[30] + 0x00000260u;
         /* 020732B8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t62);
-        /* 020732BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], cpu->r[12]);
+        /* 020732BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], cpu->r[12]));
         /* 020732C0 */ _t63 = cpu->r[28] + 0x00000004u;
         /* 020732C0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t63);
         /* 020732C0 */ cpu->r[28] = _t63;
-        /* 020732C4 */ _t64 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020732C4 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020732C4 */ _t65 = _t64 & 0x00000001u;
         /* 020732C4 */ if (_t65) goto L_020732C8; else goto L_020732CC;
   L_020732C8: ; // 0x20732c8
@@ -3516,17 +3516,17 @@ void Gambit_fn_0207307C(CPUState* cpu) {
         /* 020732E4 */ rbrew_write32(cpu->mem, _t68, cpu->r[3]);
         /* 020732E8 */ _t69 = cpu->r[30] + 0x0000026Cu;
         /* 020732E8 */ cpu->r[4] = rbrew_read32(cpu->mem, _t69);
-        /* 020732EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000002u);
-        /* 020732F0 */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020732EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000002u));
+        /* 020732F0 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020732F0 */ _t71 = _t70 & 0x00000001u;
         /* 020732F0 */ if (_t71) goto L_020732F4; else goto L_02073310;
   L_020732F4: ; // 0x20732f4
         /* 020732F4 */ _t72 = cpu->r[30] + 0x0000025Cu;
         /* 020732F4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t72);
-        /* 020732F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], cpu->r[5]);
+        /* 020732F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], cpu->r[5]));
         /* 020732FC */ _t73 = cpu->r[30] + 0x00000260u;
         /* 020732FC */ cpu->r[11] = rbrew_read32(cpu->mem, _t73);
-        /* 02073300 */ _t74 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02073300 */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02073300 */ _t75 = _t74 & 0x00000001u;
         /* 02073300 */ if (_t75) goto L_02073304; else goto L_02073308;
   L_02073304: ; // 0x2073304
@@ -3537,10 +3537,10 @@ void Gambit_fn_0207307C(CPUState* cpu) {
         /* 0207330C */ Gambit_fn_020A7E60(cpu);
   L_02073310: ; // 0x2073310
         /* 02073310 */ cpu->r[26] = cpu->r[26] + 0xFFFFFFFFu;
-        /* 02073310 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 02073310 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 02073314 */ cpu->r[25] = cpu->r[25] + 0x00000001u;
         /* 02073318 */ cpu->r[27] = cpu->r[27] + 0x00000004u;
-        /* 0207331C */ _t77 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207331C */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207331C */ _t78 = _t77 & 0x00000001u;
         /* 0207331C */ if (_t78) goto L_02073320; else goto L_020732B4;
   L_02073320: ; // 0x2073320
@@ -3631,9 +3631,9 @@ void Gambit_fn_02073368(CPUState* cpu) {
         /* 02073400 */ _t14 = cpu->r[31] + 0x0000026Cu;
         /* 02073400 */ cpu->r[10] = rbrew_read32(cpu->mem, _t14);
         /* 02073404 */ cpu->r[0] = rbrew_clz32(cpu->r[12]);
-        /* 02073408 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
+        /* 02073408 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
         /* 0207340C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x0000001Bu, 0x00000005u, 0x0000001Fu);
-        /* 02073410 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073410 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073410 */ _t16 = _t15 & 0x00000001u;
         /* 02073410 */ if (_t16) goto L_02073414; else goto L_02073440;
   L_02073414: ; // 0x2073414
@@ -3652,8 +3652,8 @@ void Gambit_fn_02073368(CPUState* cpu) {
         /* 02073438 */ Gambit_fn_027ED914(cpu);
         /* 0207343C */ goto L_02073470;
   L_02073440: ; // 0x2073440
-        /* 02073440 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02073444 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073440 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02073444 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073444 */ _t21 = _t20 & 0x00000001u;
         /* 02073444 */ if (_t21) goto L_02073450; else goto L_02073448;
   L_02073448: ; // 0x2073448
@@ -3743,9 +3743,9 @@ void Gambit_fn_0207336C(CPUState* cpu) {
         /* 02073400 */ _t14 = cpu->r[31] + 0x0000026Cu;
         /* 02073400 */ cpu->r[10] = rbrew_read32(cpu->mem, _t14);
         /* 02073404 */ cpu->r[0] = rbrew_clz32(cpu->r[12]);
-        /* 02073408 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
+        /* 02073408 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
         /* 0207340C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x0000001Bu, 0x00000005u, 0x0000001Fu);
-        /* 02073410 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073410 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073410 */ _t16 = _t15 & 0x00000001u;
         /* 02073410 */ if (_t16) goto L_02073414; else goto L_02073440;
   L_02073414: ; // 0x2073414
@@ -3764,8 +3764,8 @@ void Gambit_fn_0207336C(CPUState* cpu) {
         /* 02073438 */ Gambit_fn_027ED914(cpu);
         /* 0207343C */ goto L_02073470;
   L_02073440: ; // 0x2073440
-        /* 02073440 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02073444 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073440 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02073444 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073444 */ _t21 = _t20 & 0x00000001u;
         /* 02073444 */ if (_t21) goto L_02073450; else goto L_02073448;
   L_02073448: ; // 0x2073448
@@ -3834,7 +3834,7 @@ void Gambit_fn_02073488(CPUState* cpu) {
         /* 020734DC */ cpu->r[5] = cpu->r[28];
         /* 020734E0 */ cpu->r[4] = cpu->r[26] + 0xFFFF9DB0u;
         /* 020734E4 */ cpu->r[3] = cpu->r[1] + 0x00000008u;
-        /* 020734E8 */ _t8 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020734E8 */ _t8 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020734E8 */ _t9 = _t8 & 0x00000001u;
         /* 020734E8 */ if (_t9) goto L_020734EC; // else: addr-0 trap, fall-through
   L_020734EC: ; // 0x20734ec
@@ -3864,8 +3864,8 @@ void Gambit_fn_02073488(CPUState* cpu) {
         /* 0207352C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02073530 */ _t17 = cpu->r[1] + 0x00000008u;
         /* 02073530 */ cpu->r[11] = rbrew_read32(cpu->mem, _t17);
-        /* 02073534 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[11]);
-        /* 02073538 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073534 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[11]));
+        /* 02073538 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073538 */ _t19 = _t18 & 0x00000001u;
         /* 02073538 */ if (_t19) goto L_0207356C; else goto L_0207353C;
   L_0207353C: ; // 0x207353c
@@ -3881,13 +3881,13 @@ void Gambit_fn_02073488(CPUState* cpu) {
         /* 02073550 */ _t22 = cpu->r[9] + 0x00000001u;
         /* 02073550 */ cpu->r[0] = rbrew_read8(cpu->mem, _t22);
         /* 02073550 */ cpu->r[9] = _t22;
-        /* 02073554 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
-        /* 02073558 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073554 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
+        /* 02073558 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073558 */ _t24 = _t23 & 0x00000001u;
         /* 02073558 */ if (_t24) goto L_0207355C; else goto L_02073584;
   L_0207355C: ; // 0x207355c
-        /* 0207355C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[31]);
-        /* 02073560 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207355C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[31]));
+        /* 02073560 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073560 */ _t26 = _t25 & 0x00000001u;
         /* 02073560 */ if (_t26) goto L_0207356C; else goto L_02073564;
   L_02073564: ; // 0x2073564
@@ -3908,9 +3908,9 @@ void Gambit_fn_02073488(CPUState* cpu) {
         /* 02073580 */ return;
   L_02073584: ; // 0x2073584
         /* 02073584 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 02073584 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02073584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02073588 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
-        /* 0207358C */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207358C */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207358C */ _t32 = _t31 & 0x00000001u;
         /* 0207358C */ if (_t32) goto L_02073590; else goto L_020734DC;
   L_02073590: ; // 0x2073590
@@ -4101,15 +4101,15 @@ void Gambit_fn_020736E8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020736E8: ; // 0x20736e8
-        /* 020736E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020736EC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020736E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020736EC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020736EC */ _t1 = _t0 & 0x00000001u;
         /* 020736EC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020736EC */ goto L_020736F0;
   L_020736F0: ; // 0x20736f0
         /* 020736F0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020736F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020736F4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020736F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020736F4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020736F4 */ _t3 = _t2 & 0x00000001u;
         /* 020736F4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020736F4 */ goto L_020736F8;
@@ -4128,8 +4128,8 @@ void Gambit_fn_020736E8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4143,15 +4143,15 @@ void Gambit_fn_020736E8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4188,11 +4188,11 @@ void Gambit_fn_020736FC(CPUState* cpu) {
         /* 02073708 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02073708 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0207370C */ cpu->r[30] = cpu->r[3];
-        /* 0207370C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207370C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02073710 */ cpu->r[31] = cpu->r[4];
         /* 02073714 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02073714 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02073718 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073718 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073718 */ _t5 = _t4 & 0x00000001u;
         /* 02073718 */ if (_t5) goto L_02073788; else goto L_0207371C;
   L_0207371C: ; // 0x207371c
@@ -4206,10 +4206,10 @@ void Gambit_fn_020736FC(CPUState* cpu) {
         /* 02073734 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02073734 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02073738 */ cpu->r[11] = cpu->r[11] + 0xFFFF9FDCu;
-        /* 0207373C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207373C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02073740 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02073740 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02073744 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073744 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073744 */ _t10 = _t9 & 0x00000001u;
         /* 02073744 */ if (_t10) goto L_02073778; else goto L_02073748;
   L_02073748: ; // 0x2073748
@@ -4230,8 +4230,8 @@ void Gambit_fn_020736FC(CPUState* cpu) {
         /* 02073774 */ Gambit_fn_02068798(cpu);
   L_02073778: ; // 0x2073778
         /* 02073778 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02073778 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0207377C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073778 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0207377C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207377C */ _t15 = _t14 & 0x00000001u;
         /* 0207377C */ if (_t15) goto L_02073788; else goto L_02073780;
   L_02073780: ; // 0x2073780
@@ -4262,11 +4262,11 @@ void Gambit_fn_02073700(CPUState* cpu) {
         /* 02073708 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02073708 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0207370C */ cpu->r[30] = cpu->r[3];
-        /* 0207370C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207370C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02073710 */ cpu->r[31] = cpu->r[4];
         /* 02073714 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02073714 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02073718 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073718 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073718 */ _t5 = _t4 & 0x00000001u;
         /* 02073718 */ if (_t5) goto L_02073788; else goto L_0207371C;
   L_0207371C: ; // 0x207371c
@@ -4280,10 +4280,10 @@ void Gambit_fn_02073700(CPUState* cpu) {
         /* 02073734 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02073734 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02073738 */ cpu->r[11] = cpu->r[11] + 0xFFFF9FDCu;
-        /* 0207373C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207373C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02073740 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02073740 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02073744 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073744 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073744 */ _t10 = _t9 & 0x00000001u;
         /* 02073744 */ if (_t10) goto L_02073778; else goto L_02073748;
   L_02073748: ; // 0x2073748
@@ -4304,8 +4304,8 @@ void Gambit_fn_02073700(CPUState* cpu) {
         /* 02073774 */ Gambit_fn_02068798(cpu);
   L_02073778: ; // 0x2073778
         /* 02073778 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02073778 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0207377C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073778 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0207377C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207377C */ _t15 = _t14 & 0x00000001u;
         /* 0207377C */ if (_t15) goto L_02073788; else goto L_02073780;
   L_02073780: ; // 0x2073780
@@ -4360,15 +4360,15 @@ void Gambit_fn_020737B8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020737B8: ; // 0x20737b8
-        /* 020737B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020737BC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020737B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020737BC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020737BC */ _t1 = _t0 & 0x00000001u;
         /* 020737BC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020737BC */ goto L_020737C0;
   L_020737C0: ; // 0x20737c0
         /* 020737C0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020737C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020737C4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020737C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020737C4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020737C4 */ _t3 = _t2 & 0x00000001u;
         /* 020737C4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020737C4 */ goto L_020737C8;
@@ -4387,8 +4387,8 @@ void Gambit_fn_020737B8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4402,15 +4402,15 @@ void Gambit_fn_020737B8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4456,15 +4456,15 @@ void Gambit_fn_020737E8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020737E8: ; // 0x20737e8
-        /* 020737E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020737EC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020737E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020737EC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020737EC */ _t1 = _t0 & 0x00000001u;
         /* 020737EC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020737EC */ goto L_020737F0;
   L_020737F0: ; // 0x20737f0
         /* 020737F0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020737F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020737F4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020737F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020737F4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020737F4 */ _t3 = _t2 & 0x00000001u;
         /* 020737F4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020737F4 */ goto L_020737F8;
@@ -4483,8 +4483,8 @@ void Gambit_fn_020737E8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4498,15 +4498,15 @@ void Gambit_fn_020737E8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4534,15 +4534,15 @@ void Gambit_fn_020737FC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020737FC: ; // 0x20737fc
-        /* 020737FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02073800 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020737FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02073800 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073800 */ _t1 = _t0 & 0x00000001u;
         /* 02073800 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02073800 */ goto L_02073804;
   L_02073804: ; // 0x2073804
         /* 02073804 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02073804 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02073808 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073804 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02073808 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073808 */ _t3 = _t2 & 0x00000001u;
         /* 02073808 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02073808 */ goto L_0207380C;
@@ -4561,8 +4561,8 @@ void Gambit_fn_020737FC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4576,15 +4576,15 @@ void Gambit_fn_020737FC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4612,15 +4612,15 @@ void Gambit_fn_02073810(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02073810: ; // 0x2073810
-        /* 02073810 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02073814 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073810 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02073814 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073814 */ _t1 = _t0 & 0x00000001u;
         /* 02073814 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02073814 */ goto L_02073818;
   L_02073818: ; // 0x2073818
         /* 02073818 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02073818 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207381C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073818 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207381C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207381C */ _t3 = _t2 & 0x00000001u;
         /* 0207381C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207381C */ goto L_02073820;
@@ -4639,8 +4639,8 @@ void Gambit_fn_02073810(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4654,15 +4654,15 @@ void Gambit_fn_02073810(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4690,15 +4690,15 @@ void Gambit_fn_02073824(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02073824: ; // 0x2073824
-        /* 02073824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02073828 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02073828 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073828 */ _t1 = _t0 & 0x00000001u;
         /* 02073828 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02073828 */ goto L_0207382C;
   L_0207382C: ; // 0x207382c
         /* 0207382C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0207382C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02073830 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207382C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02073830 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073830 */ _t3 = _t2 & 0x00000001u;
         /* 02073830 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02073830 */ goto L_02073834;
@@ -4717,8 +4717,8 @@ void Gambit_fn_02073824(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4732,15 +4732,15 @@ void Gambit_fn_02073824(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4840,9 +4840,9 @@ void Gambit_fn_02073874(CPUState* cpu) {
         /* 02073878 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 02073878 */ cpu->r[9] = _t0;
         /* 0207387C */ cpu->r[12] = 0x101D0000u;
-        /* 02073880 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02073880 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02073884 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 02073888 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073888 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073888 */ _t2 = _t1 & 0x00000001u;
         /* 02073888 */ if (_t2) goto L_0207388C; else goto L_020738A0;
   L_0207388C: ; // 0x207388c
@@ -4854,8 +4854,8 @@ void Gambit_fn_02073874(CPUState* cpu) {
         /* 0207389C */ _t4 = cpu->r[12] + 0x00000000u;
         /* 0207389C */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_020738A0: ; // 0x20738a0
-        /* 020738A0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 020738A4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020738A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 020738A4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020738A4 */ _t6 = _t5 & 0x00000001u;
         /* 020738A4 */ if (_t6) goto L_020738A8; else goto L_020738B0;
   L_020738A8: ; // 0x20738a8
@@ -4867,9 +4867,9 @@ void Gambit_fn_02073874(CPUState* cpu) {
         /* 020738B4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 020738B4 */ cpu->r[7] = _t7;
         /* 020738B8 */ cpu->r[11] = 0x101D0000u;
-        /* 020738BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020738BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020738C0 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 020738C4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020738C4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020738C4 */ _t9 = _t8 & 0x00000001u;
         /* 020738C4 */ if (_t9) goto L_020738C8; else goto L_020738DC;
   L_020738C8: ; // 0x20738c8
@@ -4965,18 +4965,18 @@ void Gambit_fn_02073918(CPUState* cpu) {
         /* 02008980 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02008980 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02008984 */ cpu->r[12] = 0x00000000u;
-        /* 02008988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02008988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0200898C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0200898C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02008990 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02008990 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02008990 */ _t6 = _t5 & 0x00000001u;
         /* 02008990 */ if (_t6) goto L_020089B8; else goto L_02008994;
   L_02008994: ; // 0x2008994
         /* 02008994 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02008994 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02008998 */ /* nop */
-        /* 0200899C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 020089A0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0200899C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 020089A0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020089A0 */ _t9 = _t8 & 0x00000001u;
         /* 020089A0 */ if (_t9) goto L_020089A4; else goto L_020089B8;
   L_020089A4: ; // 0x20089a4
@@ -5027,11 +5027,11 @@ void Gambit_fn_02073924(CPUState* cpu) {
         /* 02074108 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02074108 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0207410C */ cpu->r[30] = cpu->r[3];
-        /* 0207410C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207410C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02074110 */ cpu->r[31] = cpu->r[4];
         /* 02074114 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02074114 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02074118 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074118 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074118 */ _t5 = _t4 & 0x00000001u;
         /* 02074118 */ if (_t5) goto L_02074188; else goto L_0207411C;
   L_0207411C: ; // 0x207411c
@@ -5045,10 +5045,10 @@ void Gambit_fn_02073924(CPUState* cpu) {
         /* 02074134 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02074134 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02074138 */ cpu->r[11] = cpu->r[11] + 0xFFFFA384u;
-        /* 0207413C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207413C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02074140 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02074140 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02074144 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074144 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074144 */ _t10 = _t9 & 0x00000001u;
         /* 02074144 */ if (_t10) goto L_02074178; else goto L_02074148;
   L_02074148: ; // 0x2074148
@@ -5069,8 +5069,8 @@ void Gambit_fn_02073924(CPUState* cpu) {
         /* 02074174 */ Gambit_fn_02068798(cpu);
   L_02074178: ; // 0x2074178
         /* 02074178 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02074178 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0207417C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0207417C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207417C */ _t15 = _t14 & 0x00000001u;
         /* 0207417C */ if (_t15) goto L_02074188; else goto L_02074180;
   L_02074180: ; // 0x2074180
@@ -5098,8 +5098,8 @@ void Gambit_fn_0207392C(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -5150,18 +5150,18 @@ void Gambit_fn_02073944(CPUState* cpu) {
         /* 0207394C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0207394C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02073950 */ cpu->r[31] = cpu->r[3];
-        /* 02073950 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02073950 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02073954 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02073954 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 02073958 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073958 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073958 */ _t4 = _t3 & 0x00000001u;
         /* 02073958 */ if (_t4) goto L_0207395C; else goto L_0207396C;
   L_0207395C: ; // 0x207395c
         /* 0207395C */ cpu->r[3] = 0x00000234u;
         /* 02073960 */ Gambit_fn_02801A78(cpu);
         /* 02073964 */ cpu->r[31] = cpu->r[3];
-        /* 02073964 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02073968 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073964 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02073968 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073968 */ _t6 = _t5 & 0x00000001u;
         /* 02073968 */ if (_t6) goto L_020739D0; else goto L_0207396C;
   L_0207396C: ; // 0x207396c
@@ -5222,18 +5222,18 @@ void Gambit_fn_02073948(CPUState* cpu) {
         /* 0207394C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0207394C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02073950 */ cpu->r[31] = cpu->r[3];
-        /* 02073950 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02073950 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02073954 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02073954 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 02073958 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073958 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073958 */ _t4 = _t3 & 0x00000001u;
         /* 02073958 */ if (_t4) goto L_0207395C; else goto L_0207396C;
   L_0207395C: ; // 0x207395c
         /* 0207395C */ cpu->r[3] = 0x00000234u;
         /* 02073960 */ Gambit_fn_02801A78(cpu);
         /* 02073964 */ cpu->r[31] = cpu->r[3];
-        /* 02073964 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02073968 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073964 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02073968 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073968 */ _t6 = _t5 & 0x00000001u;
         /* 02073968 */ if (_t6) goto L_020739D0; else goto L_0207396C;
   L_0207396C: ; // 0x207396c
@@ -5437,11 +5437,11 @@ void Gambit_fn_02073A58(CPUState* cpu) {
         /* 020D4950 */ cpu->r[29] = 0x10020000u;
         /* 020D4954 */ cpu->r[30] = 0x10020000u;
         /* 020D4958 */ cpu->r[28] = cpu->r[3];
-        /* 020D4958 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 020D4958 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 020D495C */ cpu->r[29] = cpu->r[29] + 0xFFFF8648u;
         /* 020D4960 */ cpu->r[30] = cpu->r[30] + 0xFFFF86C8u;
         /* 020D4964 */ cpu->r[3] = cpu->r[31];
-        /* 020D4968 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4968 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4968 */ _t15 = _t14 & 0x00000001u;
         /* 020D4968 */ if (_t15) goto L_020D49B4; else goto L_020D496C;
   L_020D496C: ; // 0x20d496c
@@ -5485,9 +5485,9 @@ void Gambit_fn_02073A58(CPUState* cpu) {
         /* 020D49D0 */ Gambit_fn_027ED700(cpu);
         /* 020D49D4 */ _t27 = cpu->r[31] + 0x00000234u;
         /* 020D49D4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t27);
-        /* 020D49D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020D49D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020D49DC */ cpu->r[3] = cpu->r[31];
-        /* 020D49E0 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D49E0 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D49E0 */ _t29 = _t28 & 0x00000001u;
         /* 020D49E0 */ if (_t29) goto L_020D4A14; else goto L_020D49E4;
   L_020D49E4: ; // 0x20d49e4
@@ -5565,15 +5565,15 @@ void Gambit_fn_02073A64(CPUState* cpu) {
         /* 020D4AB8 */ rbrew_write32(cpu->mem, _t7, cpu->r[0]);
         /* 020D4ABC */ _t8 = cpu->r[31] + 0x00000235u;
         /* 020D4ABC */ cpu->r[0] = rbrew_read8(cpu->mem, _t8);
-        /* 020D4AC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020D4AC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020D4AC4 */ _t9 = cpu->r[31] + 0x0000021Cu;
         /* 020D4AC4 */ rbrew_write32(cpu->mem, _t9, cpu->r[4]);
-        /* 020D4AC8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4AC8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4AC8 */ _t11 = _t10 & 0x00000001u;
         /* 020D4AC8 */ if (_t11) goto L_020D4B20; else goto L_020D4ACC;
   L_020D4ACC: ; // 0x20d4acc
-        /* 020D4ACC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020D4AD0 */ _t12 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D4ACC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020D4AD0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D4AD0 */ _t13 = _t12 & 0x00000001u;
         /* 020D4AD0 */ if (_t13) goto L_020D4AD4; else goto L_020D4B2C;
   L_020D4AD4: ; // 0x20d4ad4
@@ -5584,8 +5584,8 @@ void Gambit_fn_02073A64(CPUState* cpu) {
         /* 020D4AE0 */ cpu->r[9] = (uint32_t)((int32_t)cpu->r[7] / (int32_t)cpu->r[10]);
         /* 020D4AE4 */ _t15 = cpu->r[31] + 0x00000218u;
         /* 020D4AE4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t15);
-        /* 020D4AE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], cpu->r[0]);
-        /* 020D4AEC */ _t16 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D4AE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], cpu->r[0]));
+        /* 020D4AEC */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D4AEC */ _t17 = _t16 & 0x00000001u;
         /* 020D4AEC */ if (_t17) goto L_020D4AF0; else goto L_020D4B30;
   L_020D4AF0: ; // 0x20d4af0
@@ -5598,10 +5598,10 @@ void Gambit_fn_02073A64(CPUState* cpu) {
         /* 020D4B04 */ cpu->r[29] = cpu->r[3];
         /* 020D4B08 */ cpu->r[30] = cpu->r[30] + 0xFFFF8648u;
         /* 020D4B0C */ cpu->r[10] = 0x10020000u;
-        /* 020D4B10 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[9]);
+        /* 020D4B10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[9]));
         /* 020D4B14 */ _t19 = cpu->r[10] + 0xFFFF86B8u;
         /* 020D4B14 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t19);
-        /* 020D4B18 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4B18 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4B18 */ _t21 = _t20 & 0x00000001u;
         /* 020D4B18 */ if (_t21) goto L_020D4BBC; else goto L_020D4B1C;
   L_020D4B1C: ; // 0x20d4b1c
@@ -5610,8 +5610,8 @@ void Gambit_fn_02073A64(CPUState* cpu) {
         /* 020D4B20 */ _t22 = cpu->r[31] + 0x0000022Cu;
         /* 020D4B20 */ cpu->r[8] = rbrew_read32(cpu->mem, _t22);
         /* 020D4B24 */ cpu->r[9] = (uint32_t)((int32_t)cpu->r[4] / (int32_t)cpu->r[8]);
-        /* 020D4B24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 020D4B28 */ _t23 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D4B24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 020D4B28 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D4B28 */ _t24 = _t23 & 0x00000001u;
         /* 020D4B28 */ if (_t24) goto L_020D4B2C; else goto L_020D4B30;
   L_020D4B2C: ; // 0x20d4b2c
@@ -5625,10 +5625,10 @@ void Gambit_fn_02073A64(CPUState* cpu) {
         /* 020D4B40 */ cpu->r[29] = cpu->r[3];
         /* 020D4B44 */ cpu->r[30] = cpu->r[30] + 0xFFFF8648u;
         /* 020D4B48 */ cpu->r[10] = 0x10020000u;
-        /* 020D4B4C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[9]);
+        /* 020D4B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[9]));
         /* 020D4B50 */ _t26 = cpu->r[10] + 0xFFFF86B8u;
         /* 020D4B50 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t26);
-        /* 020D4B54 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4B54 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4B54 */ _t28 = _t27 & 0x00000001u;
         /* 020D4B54 */ if (_t28) goto L_020D4BBC; else goto L_020D4B58;
   L_020D4B58: ; // 0x20d4b58
@@ -5636,10 +5636,10 @@ void Gambit_fn_02073A64(CPUState* cpu) {
         /* 020D4B5C */ _t29 = cpu->r[31] + 0x00000220u;
         /* 020D4B5C */ rbrew_write32(cpu->mem, _t29, cpu->r[9]);
         /* 020D4B60 */ Gambit_fn_020D48A4(cpu);
-        /* 020D4B64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020D4B64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020D4B68 */ _t30 = cpu->r[31] + 0x000001DCu;
         /* 020D4B68 */ cpu->r[12] = rbrew_read32(cpu->mem, _t30);
-        /* 020D4B6C */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4B6C */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4B6C */ _t32 = _t31 & 0x00000001u;
         /* 020D4B6C */ if (_t32) goto L_020D4B98; else goto L_020D4B70;
   L_020D4B70: ; // 0x20d4b70
@@ -5670,15 +5670,15 @@ void Gambit_fn_02073A64(CPUState* cpu) {
   L_020D4BBC: ; // 0x20d4bbc
         /* 020D4BBC */ _t37 = cpu->r[31] + 0x00000236u;
         /* 020D4BBC */ cpu->r[0] = rbrew_read8(cpu->mem, _t37);
-        /* 020D4BC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020D4BC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020D4BC4 */ cpu->r[0] = 0x10020000u;
         /* 020D4BC8 */ cpu->r[0] = cpu->r[0] + 0xFFFF86F8u;
-        /* 020D4BCC */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4BCC */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4BCC */ _t39 = _t38 & 0x00000001u;
         /* 020D4BCC */ if (_t39) goto L_020D4BD0; else goto L_020D4C00;
   L_020D4BD0: ; // 0x20d4bd0
-        /* 020D4BD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020D4BD4 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4BD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020D4BD4 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4BD4 */ _t41 = _t40 & 0x00000001u;
         /* 020D4BD4 */ if (_t41) goto L_020D4C5C; else goto L_020D4BD8;
   L_020D4BD8: ; // 0x20d4bd8
@@ -5698,16 +5698,16 @@ void Gambit_fn_02073A64(CPUState* cpu) {
         /* 020D4BF8 */ rbrew_write8(cpu->mem, _t46, (uint8_t)cpu->r[29]);
         /* 020D4BFC */ goto L_020D4C60;
   L_020D4C00: ; // 0x20d4c00
-        /* 020D4C00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020D4C04 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4C00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020D4C04 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4C04 */ _t48 = _t47 & 0x00000001u;
         /* 020D4C04 */ if (_t48) goto L_020D4C08; else goto L_020D4C5C;
   L_020D4C08: ; // 0x20d4c08
         /* 020D4C08 */ _t49 = cpu->r[31] + 0x00000234u;
         /* 020D4C08 */ cpu->r[6] = rbrew_read8(cpu->mem, _t49);
-        /* 020D4C0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 020D4C0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 020D4C10 */ cpu->r[3] = cpu->r[31];
-        /* 020D4C14 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4C14 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4C14 */ _t51 = _t50 & 0x00000001u;
         /* 020D4C14 */ if (_t51) goto L_020D4C44; else goto L_020D4C18;
   L_020D4C18: ; // 0x20d4c18
@@ -5750,7 +5750,7 @@ void Gambit_fn_02073A64(CPUState* cpu) {
         /* 020D4C6C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t63);
         /* 020D4C70 */ _t64 = cpu->r[1] + 0x0000003Cu;
         /* 020D4C70 */ cpu->r[31] = rbrew_read32(cpu->mem, _t64);
-        /* 020D4C74 */ _t65 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D4C74 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D4C74 */ _t66 = _t65 & 0x00000001u;
         /* 020D4C74 */ if (_t66) goto L_020D4C78; // else: addr-0 trap, fall-through
   L_020D4C78: ; // 0x20d4c78
@@ -5775,9 +5775,9 @@ void Gambit_fn_02073A6C(CPUState* cpu) {
         /* 02073A78 */ _t2 = cpu->r[4] + 0x00000000u;
         /* 02073A78 */ cpu->r[0] = rbrew_read32(cpu->mem, _t2);
         /* 02073A7C */ cpu->r[12] = 0x10010000u;
-        /* 02073A80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02073A80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02073A84 */ cpu->r[12] = cpu->r[12] + 0xFFFFA074u;
-        /* 02073A88 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073A88 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073A88 */ _t4 = _t3 & 0x00000001u;
         /* 02073A88 */ if (_t4) goto L_02073A8C; else goto L_02073AB0;
   L_02073A8C: ; // 0x2073a8c
@@ -5794,8 +5794,8 @@ void Gambit_fn_02073A6C(CPUState* cpu) {
         /* 02073AA8 */ Gambit_fn_027ED700(cpu);
         /* 02073AAC */ goto L_02073B04;
   L_02073AB0: ; // 0x2073ab0
-        /* 02073AB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 02073AB4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073AB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 02073AB4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073AB4 */ _t9 = _t8 & 0x00000001u;
         /* 02073AB4 */ if (_t9) goto L_02073AB8; else goto L_02073ADC;
   L_02073AB8: ; // 0x2073ab8
@@ -5812,8 +5812,8 @@ void Gambit_fn_02073A6C(CPUState* cpu) {
         /* 02073AD4 */ Gambit_fn_027ED700(cpu);
         /* 02073AD8 */ goto L_02073B04;
   L_02073ADC: ; // 0x2073adc
-        /* 02073ADC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02073AE0 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073ADC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02073AE0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073AE0 */ _t14 = _t13 & 0x00000001u;
         /* 02073AE0 */ if (_t14) goto L_02073AE4; else goto L_02073B04;
   L_02073AE4: ; // 0x2073ae4
@@ -5847,9 +5847,9 @@ void Gambit_fn_02073A74(CPUState* cpu) {
         /* 02073A78 */ _t1 = cpu->r[4] + 0x00000000u;
         /* 02073A78 */ cpu->r[0] = rbrew_read32(cpu->mem, _t1);
         /* 02073A7C */ cpu->r[12] = 0x10010000u;
-        /* 02073A80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02073A80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02073A84 */ cpu->r[12] = cpu->r[12] + 0xFFFFA074u;
-        /* 02073A88 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073A88 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073A88 */ _t3 = _t2 & 0x00000001u;
         /* 02073A88 */ if (_t3) goto L_02073A8C; else goto L_02073AB0;
   L_02073A8C: ; // 0x2073a8c
@@ -5866,8 +5866,8 @@ void Gambit_fn_02073A74(CPUState* cpu) {
         /* 02073AA8 */ Gambit_fn_027ED700(cpu);
         /* 02073AAC */ goto L_02073B04;
   L_02073AB0: ; // 0x2073ab0
-        /* 02073AB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 02073AB4 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073AB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 02073AB4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073AB4 */ _t8 = _t7 & 0x00000001u;
         /* 02073AB4 */ if (_t8) goto L_02073AB8; else goto L_02073ADC;
   L_02073AB8: ; // 0x2073ab8
@@ -5884,8 +5884,8 @@ void Gambit_fn_02073A74(CPUState* cpu) {
         /* 02073AD4 */ Gambit_fn_027ED700(cpu);
         /* 02073AD8 */ goto L_02073B04;
   L_02073ADC: ; // 0x2073adc
-        /* 02073ADC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02073AE0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073ADC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02073AE0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073AE0 */ _t13 = _t12 & 0x00000001u;
         /* 02073AE0 */ if (_t13) goto L_02073AE4; else goto L_02073B04;
   L_02073AE4: ; // 0x2073ae4
@@ -5922,9 +5922,9 @@ void Gambit_fn_02073B14(CPUState* cpu) {
         /* 02073B20 */ _t2 = cpu->r[4] + 0x00000000u;
         /* 02073B20 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
         /* 02073B24 */ cpu->r[10] = 0x10010000u;
-        /* 02073B28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02073B28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02073B2C */ cpu->r[10] = cpu->r[10] + 0xFFFFA074u;
-        /* 02073B30 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073B30 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073B30 */ _t4 = _t3 & 0x00000001u;
         /* 02073B30 */ if (_t4) goto L_02073B34; else goto L_02073B60;
   L_02073B34: ; // 0x2073b34
@@ -5944,8 +5944,8 @@ void Gambit_fn_02073B14(CPUState* cpu) {
         /* 02073B58 */ Gambit_fn_027ED2B0(cpu);
         /* 02073B5C */ goto L_02073BC4;
   L_02073B60: ; // 0x2073b60
-        /* 02073B60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000001u);
-        /* 02073B64 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073B60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000001u));
+        /* 02073B64 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073B64 */ _t10 = _t9 & 0x00000001u;
         /* 02073B64 */ if (_t10) goto L_02073B68; else goto L_02073B94;
   L_02073B68: ; // 0x2073b68
@@ -5965,8 +5965,8 @@ void Gambit_fn_02073B14(CPUState* cpu) {
         /* 02073B8C */ Gambit_fn_027ED2B0(cpu);
         /* 02073B90 */ goto L_02073BC4;
   L_02073B94: ; // 0x2073b94
-        /* 02073B94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000002u);
-        /* 02073B98 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073B94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000002u));
+        /* 02073B98 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073B98 */ _t16 = _t15 & 0x00000001u;
         /* 02073B98 */ if (_t16) goto L_02073B9C; else goto L_02073BC4;
   L_02073B9C: ; // 0x2073b9c
@@ -6003,9 +6003,9 @@ void Gambit_fn_02073B1C(CPUState* cpu) {
         /* 02073B20 */ _t1 = cpu->r[4] + 0x00000000u;
         /* 02073B20 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 02073B24 */ cpu->r[10] = 0x10010000u;
-        /* 02073B28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02073B28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02073B2C */ cpu->r[10] = cpu->r[10] + 0xFFFFA074u;
-        /* 02073B30 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073B30 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073B30 */ _t3 = _t2 & 0x00000001u;
         /* 02073B30 */ if (_t3) goto L_02073B34; else goto L_02073B60;
   L_02073B34: ; // 0x2073b34
@@ -6025,8 +6025,8 @@ void Gambit_fn_02073B1C(CPUState* cpu) {
         /* 02073B58 */ Gambit_fn_027ED2B0(cpu);
         /* 02073B5C */ goto L_02073BC4;
   L_02073B60: ; // 0x2073b60
-        /* 02073B60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000001u);
-        /* 02073B64 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073B60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000001u));
+        /* 02073B64 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073B64 */ _t9 = _t8 & 0x00000001u;
         /* 02073B64 */ if (_t9) goto L_02073B68; else goto L_02073B94;
   L_02073B68: ; // 0x2073b68
@@ -6046,8 +6046,8 @@ void Gambit_fn_02073B1C(CPUState* cpu) {
         /* 02073B8C */ Gambit_fn_027ED2B0(cpu);
         /* 02073B90 */ goto L_02073BC4;
   L_02073B94: ; // 0x2073b94
-        /* 02073B94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000002u);
-        /* 02073B98 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073B94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000002u));
+        /* 02073B98 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073B98 */ _t15 = _t14 & 0x00000001u;
         /* 02073B98 */ if (_t15) goto L_02073B9C; else goto L_02073BC4;
   L_02073B9C: ; // 0x2073b9c
@@ -6103,9 +6103,9 @@ void Gambit_fn_02073BD4(CPUState* cpu) {
         /* 02073C10 */ cpu->r[31] = cpu->r[3];
         /* 02073C14 */ cpu->r[27] = 0x101D0000u;
         /* 02073C18 */ cpu->r[29] = 0x10010000u;
-        /* 02073C1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02073C1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02073C20 */ cpu->r[29] = cpu->r[29] + 0xFFFFA08Cu;
-        /* 02073C24 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073C24 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073C24 */ _t6 = _t5 & 0x00000001u;
         /* 02073C24 */ if (_t6) goto L_02073C28; else goto L_02073C34;
   L_02073C28: ; // 0x2073c28
@@ -6115,8 +6115,8 @@ void Gambit_fn_02073BD4(CPUState* cpu) {
         /* 02073C30 */ _t8 = cpu->r[28] + 0x00000000u;
         /* 02073C30 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
   L_02073C34: ; // 0x2073c34
-        /* 02073C34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02073C38 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073C34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02073C38 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073C38 */ _t10 = _t9 & 0x00000001u;
         /* 02073C38 */ if (_t10) goto L_02073C5C; else goto L_02073C3C;
   L_02073C3C: ; // 0x2073c3c
@@ -6128,8 +6128,8 @@ void Gambit_fn_02073BD4(CPUState* cpu) {
         /* 02073C48 */ cpu->r[3] = cpu->r[31];
         /* 02073C4C */ cpu->r[4] = cpu->r[27] + 0xFFFFED90u;
         /* 02073C50 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02073C54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02073C58 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073C54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02073C58 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073C58 */ _t14 = _t13 & 0x00000001u;
         /* 02073C58 */ if (_t14) goto L_02073C5C; else goto L_02073C60;
   L_02073C5C: ; // 0x2073c5c
@@ -6148,9 +6148,9 @@ void Gambit_fn_02073BD4(CPUState* cpu) {
         /* 02073C7C */ Gambit_fn_026D86B0(cpu);
         /* 02073C80 */ _t18 = cpu->r[28] + 0x00000000u;
         /* 02073C80 */ cpu->r[12] = rbrew_read32(cpu->mem, _t18);
-        /* 02073C84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02073C84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02073C88 */ cpu->r[31] = cpu->r[3];
-        /* 02073C8C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073C8C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073C8C */ _t20 = _t19 & 0x00000001u;
         /* 02073C8C */ if (_t20) goto L_02073C90; else goto L_02073C9C;
   L_02073C90: ; // 0x2073c90
@@ -6160,8 +6160,8 @@ void Gambit_fn_02073BD4(CPUState* cpu) {
         /* 02073C98 */ _t22 = cpu->r[28] + 0x00000000u;
         /* 02073C98 */ rbrew_write32(cpu->mem, _t22, cpu->r[0]);
   L_02073C9C: ; // 0x2073c9c
-        /* 02073C9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02073CA0 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073C9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02073CA0 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073CA0 */ _t24 = _t23 & 0x00000001u;
         /* 02073CA0 */ if (_t24) goto L_02073CC4; else goto L_02073CA4;
   L_02073CA4: ; // 0x2073ca4
@@ -6173,8 +6173,8 @@ void Gambit_fn_02073BD4(CPUState* cpu) {
         /* 02073CB0 */ cpu->r[3] = cpu->r[31];
         /* 02073CB4 */ cpu->r[4] = cpu->r[27] + 0xFFFFED90u;
         /* 02073CB8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02073CBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02073CC0 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073CBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02073CC0 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073CC0 */ _t28 = _t27 & 0x00000001u;
         /* 02073CC0 */ if (_t28) goto L_02073CC4; else goto L_02073CC8;
   L_02073CC4: ; // 0x2073cc4
@@ -6490,9 +6490,9 @@ void Gambit_fn_02073EAC(CPUState* cpu) {
         /* 02073ECC */ cpu->r[10] = rbrew_read8(cpu->mem, _t5);
         /* 02073ED0 */ cpu->r[29] = 0x10010000u;
         /* 02073ED4 */ cpu->r[30] = cpu->r[30] + 0xFFFFA180u;
-        /* 02073ED8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02073ED8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02073EDC */ cpu->r[29] = cpu->r[29] + 0xFFFFA074u;
-        /* 02073EE0 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073EE0 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073EE0 */ _t7 = _t6 & 0x00000001u;
         /* 02073EE0 */ if (_t7) goto L_02073EE4; else goto L_02073F38;
   L_02073EE4: ; // 0x2073ee4
@@ -6500,8 +6500,8 @@ void Gambit_fn_02073EAC(CPUState* cpu) {
         /* 02073EE4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
         /* 02073EE8 */ _t9 = cpu->r[31] + 0x00000228u;
         /* 02073EE8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t9);
-        /* 02073EEC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 02073EF0 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073EEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 02073EF0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073EF0 */ _t11 = _t10 & 0x00000001u;
         /* 02073EF0 */ if (_t11) goto L_02073F80; else goto L_02073EF4;
   L_02073EF4: ; // 0x2073ef4
@@ -6534,8 +6534,8 @@ void Gambit_fn_02073EAC(CPUState* cpu) {
         /* 02073F38 */ cpu->r[3] = cpu->r[31];
         /* 02073F3C */ cpu->r[4] = 0x00000000u;
         /* 02073F40 */ Gambit_fn_027EDF00(cpu);
-        /* 02073F44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02073F48 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073F44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02073F48 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073F48 */ _t21 = _t20 & 0x00000001u;
         /* 02073F48 */ if (_t21) goto L_02073F80; else goto L_02073F4C;
   L_02073F4C: ; // 0x2073f4c
@@ -6593,9 +6593,9 @@ void Gambit_fn_02073EB0(CPUState* cpu) {
         /* 02073ECC */ cpu->r[10] = rbrew_read8(cpu->mem, _t5);
         /* 02073ED0 */ cpu->r[29] = 0x10010000u;
         /* 02073ED4 */ cpu->r[30] = cpu->r[30] + 0xFFFFA180u;
-        /* 02073ED8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02073ED8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02073EDC */ cpu->r[29] = cpu->r[29] + 0xFFFFA074u;
-        /* 02073EE0 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073EE0 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073EE0 */ _t7 = _t6 & 0x00000001u;
         /* 02073EE0 */ if (_t7) goto L_02073EE4; else goto L_02073F38;
   L_02073EE4: ; // 0x2073ee4
@@ -6603,8 +6603,8 @@ void Gambit_fn_02073EB0(CPUState* cpu) {
         /* 02073EE4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
         /* 02073EE8 */ _t9 = cpu->r[31] + 0x00000228u;
         /* 02073EE8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t9);
-        /* 02073EEC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 02073EF0 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073EEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 02073EF0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073EF0 */ _t11 = _t10 & 0x00000001u;
         /* 02073EF0 */ if (_t11) goto L_02073F80; else goto L_02073EF4;
   L_02073EF4: ; // 0x2073ef4
@@ -6637,8 +6637,8 @@ void Gambit_fn_02073EB0(CPUState* cpu) {
         /* 02073F38 */ cpu->r[3] = cpu->r[31];
         /* 02073F3C */ cpu->r[4] = 0x00000000u;
         /* 02073F40 */ Gambit_fn_027EDF00(cpu);
-        /* 02073F44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02073F48 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02073F44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02073F48 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02073F48 */ _t21 = _t20 & 0x00000001u;
         /* 02073F48 */ if (_t21) goto L_02073F80; else goto L_02073F4C;
   L_02073F4C: ; // 0x2073f4c
@@ -6723,8 +6723,8 @@ void Gambit_fn_02073F9C(CPUState* cpu) {
         /* 02074008 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0207400C */ _t13 = cpu->r[1] + 0x00000008u;
         /* 0207400C */ cpu->r[0] = rbrew_read32(cpu->mem, _t13);
-        /* 02074010 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
-        /* 02074014 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074010 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
+        /* 02074014 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074014 */ _t15 = _t14 & 0x00000001u;
         /* 02074014 */ if (_t15) goto L_02074018; else goto L_02074020;
   L_02074018: ; // 0x2074018
@@ -6750,13 +6750,13 @@ void Gambit_fn_02073F9C(CPUState* cpu) {
         /* 02074048 */ _t20 = cpu->r[11] + 0x00000001u;
         /* 02074048 */ cpu->r[8] = rbrew_read8(cpu->mem, _t20);
         /* 02074048 */ cpu->r[11] = _t20;
-        /* 0207404C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
-        /* 02074050 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207404C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
+        /* 02074050 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074050 */ _t22 = _t21 & 0x00000001u;
         /* 02074050 */ if (_t22) goto L_02074054; else goto L_02074060;
   L_02074054: ; // 0x2074054
-        /* 02074054 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 02074058 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 02074058 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074058 */ _t24 = _t23 & 0x00000001u;
         /* 02074058 */ if (_t24) goto L_02074018; else goto L_0207405C;
   L_0207405C: ; // 0x207405c
@@ -6825,8 +6825,8 @@ void Gambit_fn_02073FA8(CPUState* cpu) {
         /* 02074008 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0207400C */ _t13 = cpu->r[1] + 0x00000008u;
         /* 0207400C */ cpu->r[0] = rbrew_read32(cpu->mem, _t13);
-        /* 02074010 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
-        /* 02074014 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074010 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
+        /* 02074014 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074014 */ _t15 = _t14 & 0x00000001u;
         /* 02074014 */ if (_t15) goto L_02074018; else goto L_02074020;
   L_02074018: ; // 0x2074018
@@ -6852,13 +6852,13 @@ void Gambit_fn_02073FA8(CPUState* cpu) {
         /* 02074048 */ _t20 = cpu->r[11] + 0x00000001u;
         /* 02074048 */ cpu->r[8] = rbrew_read8(cpu->mem, _t20);
         /* 02074048 */ cpu->r[11] = _t20;
-        /* 0207404C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
-        /* 02074050 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207404C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
+        /* 02074050 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074050 */ _t22 = _t21 & 0x00000001u;
         /* 02074050 */ if (_t22) goto L_02074054; else goto L_02074060;
   L_02074054: ; // 0x2074054
-        /* 02074054 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 02074058 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 02074058 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074058 */ _t24 = _t23 & 0x00000001u;
         /* 02074058 */ if (_t24) goto L_02074018; else goto L_0207405C;
   L_0207405C: ; // 0x207405c
@@ -6993,15 +6993,15 @@ void Gambit_fn_020740E8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020740E8: ; // 0x20740e8
-        /* 020740E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020740EC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020740E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020740EC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020740EC */ _t1 = _t0 & 0x00000001u;
         /* 020740EC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020740EC */ goto L_020740F0;
   L_020740F0: ; // 0x20740f0
         /* 020740F0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020740F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020740F4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020740F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020740F4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020740F4 */ _t3 = _t2 & 0x00000001u;
         /* 020740F4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020740F4 */ goto L_020740F8;
@@ -7020,8 +7020,8 @@ void Gambit_fn_020740E8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -7035,15 +7035,15 @@ void Gambit_fn_020740E8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -7080,11 +7080,11 @@ void Gambit_fn_020740FC(CPUState* cpu) {
         /* 02074108 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02074108 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0207410C */ cpu->r[30] = cpu->r[3];
-        /* 0207410C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207410C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02074110 */ cpu->r[31] = cpu->r[4];
         /* 02074114 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02074114 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02074118 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074118 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074118 */ _t5 = _t4 & 0x00000001u;
         /* 02074118 */ if (_t5) goto L_02074188; else goto L_0207411C;
   L_0207411C: ; // 0x207411c
@@ -7098,10 +7098,10 @@ void Gambit_fn_020740FC(CPUState* cpu) {
         /* 02074134 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02074134 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02074138 */ cpu->r[11] = cpu->r[11] + 0xFFFFA384u;
-        /* 0207413C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207413C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02074140 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02074140 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02074144 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074144 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074144 */ _t10 = _t9 & 0x00000001u;
         /* 02074144 */ if (_t10) goto L_02074178; else goto L_02074148;
   L_02074148: ; // 0x2074148
@@ -7122,8 +7122,8 @@ void Gambit_fn_020740FC(CPUState* cpu) {
         /* 02074174 */ Gambit_fn_02068798(cpu);
   L_02074178: ; // 0x2074178
         /* 02074178 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02074178 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0207417C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0207417C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207417C */ _t15 = _t14 & 0x00000001u;
         /* 0207417C */ if (_t15) goto L_02074188; else goto L_02074180;
   L_02074180: ; // 0x2074180
@@ -7154,11 +7154,11 @@ void Gambit_fn_02074100(CPUState* cpu) {
         /* 02074108 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02074108 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0207410C */ cpu->r[30] = cpu->r[3];
-        /* 0207410C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207410C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02074110 */ cpu->r[31] = cpu->r[4];
         /* 02074114 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02074114 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02074118 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074118 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074118 */ _t5 = _t4 & 0x00000001u;
         /* 02074118 */ if (_t5) goto L_02074188; else goto L_0207411C;
   L_0207411C: ; // 0x207411c
@@ -7172,10 +7172,10 @@ void Gambit_fn_02074100(CPUState* cpu) {
         /* 02074134 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02074134 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02074138 */ cpu->r[11] = cpu->r[11] + 0xFFFFA384u;
-        /* 0207413C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207413C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02074140 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02074140 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02074144 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074144 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074144 */ _t10 = _t9 & 0x00000001u;
         /* 02074144 */ if (_t10) goto L_02074178; else goto L_02074148;
   L_02074148: ; // 0x2074148
@@ -7196,8 +7196,8 @@ void Gambit_fn_02074100(CPUState* cpu) {
         /* 02074174 */ Gambit_fn_02068798(cpu);
   L_02074178: ; // 0x2074178
         /* 02074178 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02074178 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0207417C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0207417C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207417C */ _t15 = _t14 & 0x00000001u;
         /* 0207417C */ if (_t15) goto L_02074188; else goto L_02074180;
   L_02074180: ; // 0x2074180
@@ -7318,9 +7318,9 @@ void Gambit_fn_020741F0(CPUState* cpu) {
         /* 020741F4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 020741F4 */ cpu->r[9] = _t0;
         /* 020741F8 */ cpu->r[12] = 0x101D0000u;
-        /* 020741FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 020741FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02074200 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 02074204 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074204 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074204 */ _t2 = _t1 & 0x00000001u;
         /* 02074204 */ if (_t2) goto L_02074208; else goto L_0207421C;
   L_02074208: ; // 0x2074208
@@ -7332,8 +7332,8 @@ void Gambit_fn_020741F0(CPUState* cpu) {
         /* 02074218 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 02074218 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_0207421C: ; // 0x207421c
-        /* 0207421C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02074220 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207421C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02074220 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074220 */ _t6 = _t5 & 0x00000001u;
         /* 02074220 */ if (_t6) goto L_02074224; else goto L_0207422C;
   L_02074224: ; // 0x2074224
@@ -7345,9 +7345,9 @@ void Gambit_fn_020741F0(CPUState* cpu) {
         /* 02074230 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 02074230 */ cpu->r[7] = _t7;
         /* 02074234 */ cpu->r[11] = 0x101D0000u;
-        /* 02074238 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02074238 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0207423C */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 02074240 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074240 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074240 */ _t9 = _t8 & 0x00000001u;
         /* 02074240 */ if (_t9) goto L_02074244; else goto L_02074258;
   L_02074244: ; // 0x2074244
@@ -7437,18 +7437,18 @@ void Gambit_fn_02074290(CPUState* cpu) {
         /* 02008980 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02008980 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02008984 */ cpu->r[12] = 0x00000000u;
-        /* 02008988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02008988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0200898C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0200898C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02008990 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02008990 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02008990 */ _t6 = _t5 & 0x00000001u;
         /* 02008990 */ if (_t6) goto L_020089B8; else goto L_02008994;
   L_02008994: ; // 0x2008994
         /* 02008994 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02008994 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02008998 */ /* nop */
-        /* 0200899C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 020089A0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0200899C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 020089A0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020089A0 */ _t9 = _t8 & 0x00000001u;
         /* 020089A0 */ if (_t9) goto L_020089A4; else goto L_020089B8;
   L_020089A4: ; // 0x20089a4
@@ -7523,8 +7523,8 @@ void Gambit_fn_020742A4(CPUState* cpu) {
         /* 020742E0 */ Gambit_fn_026D6F40(cpu);
         /* 020742E4 */ cpu->r[3] = 0x00000230u;
         /* 020742E8 */ Gambit_fn_02801A78(cpu);
-        /* 020742EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020742F0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020742EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020742F0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020742F0 */ _t6 = _t5 & 0x00000001u;
         /* 020742F0 */ if (_t6) goto L_020742F8; else goto L_020742F4;
   L_020742F4: ; // 0x20742f4
@@ -7555,8 +7555,8 @@ void Gambit_fn_020742A4(CPUState* cpu) {
         /* 0207433C */ Gambit_fn_026D6F40(cpu);
         /* 02074340 */ cpu->r[3] = 0x00000234u;
         /* 02074344 */ Gambit_fn_02801A78(cpu);
-        /* 02074348 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207434C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074348 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207434C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207434C */ _t13 = _t12 & 0x00000001u;
         /* 0207434C */ if (_t13) goto L_02074354; else goto L_02074350;
   L_02074350: ; // 0x2074350
@@ -7608,8 +7608,8 @@ void Gambit_fn_020742A8(CPUState* cpu) {
         /* 020742E0 */ Gambit_fn_026D6F40(cpu);
         /* 020742E4 */ cpu->r[3] = 0x00000230u;
         /* 020742E8 */ Gambit_fn_02801A78(cpu);
-        /* 020742EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020742F0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020742EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020742F0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020742F0 */ _t6 = _t5 & 0x00000001u;
         /* 020742F0 */ if (_t6) goto L_020742F8; else goto L_020742F4;
   L_020742F4: ; // 0x20742f4
@@ -7640,8 +7640,8 @@ void Gambit_fn_020742A8(CPUState* cpu) {
         /* 0207433C */ Gambit_fn_026D6F40(cpu);
         /* 02074340 */ cpu->r[3] = 0x00000234u;
         /* 02074344 */ Gambit_fn_02801A78(cpu);
-        /* 02074348 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207434C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074348 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207434C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207434C */ _t13 = _t12 & 0x00000001u;
         /* 0207434C */ if (_t13) goto L_02074354; else goto L_02074350;
   L_02074350: ; // 0x2074350
@@ -7694,8 +7694,8 @@ void Gambit_fn_02074380(CPUState* cpu) {
         /* 020742E0 */ Gambit_fn_026D6F40(cpu);
         /* 020742E4 */ cpu->r[3] = 0x00000230u;
         /* 020742E8 */ Gambit_fn_02801A78(cpu);
-        /* 020742EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020742F0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020742EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020742F0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020742F0 */ _t6 = _t5 & 0x00000001u;
         /* 020742F0 */ if (_t6) goto L_020742F8; else goto L_020742F4;
   L_020742F4: ; // 0x20742f4
@@ -7726,8 +7726,8 @@ void Gambit_fn_02074380(CPUState* cpu) {
         /* 0207433C */ Gambit_fn_026D6F40(cpu);
         /* 02074340 */ cpu->r[3] = 0x00000234u;
         /* 02074344 */ Gambit_fn_02801A78(cpu);
-        /* 02074348 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207434C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074348 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207434C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207434C */ _t13 = _t12 & 0x00000001u;
         /* 0207434C */ if (_t13) goto L_02074354; else goto L_02074350;
   L_02074350: ; // 0x2074350
@@ -7862,19 +7862,19 @@ void Gambit_fn_020743D0(CPUState* cpu) {
         /* 020743DC */ _t2 = cpu->r[1] + 0x0000000Cu;
         /* 020743DC */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
         /* 020743E0 */ cpu->r[31] = cpu->r[3];
-        /* 020743E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020743E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020743E4 */ cpu->r[30] = cpu->r[4];
         /* 020743E8 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020743E8 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020743EC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020743EC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020743EC */ _t5 = _t4 & 0x00000001u;
         /* 020743EC */ if (_t5) goto L_020743F0; else goto L_02074400;
   L_020743F0: ; // 0x20743f0
         /* 020743F0 */ cpu->r[3] = 0x00000030u;
         /* 020743F4 */ Gambit_fn_02801A78(cpu);
         /* 020743F8 */ cpu->r[31] = cpu->r[3];
-        /* 020743F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020743FC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020743F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020743FC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020743FC */ _t7 = _t6 & 0x00000001u;
         /* 020743FC */ if (_t7) goto L_02074444; else goto L_02074400;
   L_02074400: ; // 0x2074400
@@ -7926,19 +7926,19 @@ void Gambit_fn_020743D4(CPUState* cpu) {
         /* 020743DC */ _t2 = cpu->r[1] + 0x0000000Cu;
         /* 020743DC */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
         /* 020743E0 */ cpu->r[31] = cpu->r[3];
-        /* 020743E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020743E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020743E4 */ cpu->r[30] = cpu->r[4];
         /* 020743E8 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020743E8 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020743EC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020743EC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020743EC */ _t5 = _t4 & 0x00000001u;
         /* 020743EC */ if (_t5) goto L_020743F0; else goto L_02074400;
   L_020743F0: ; // 0x20743f0
         /* 020743F0 */ cpu->r[3] = 0x00000030u;
         /* 020743F4 */ Gambit_fn_02801A78(cpu);
         /* 020743F8 */ cpu->r[31] = cpu->r[3];
-        /* 020743F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020743FC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020743F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020743FC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020743FC */ _t7 = _t6 & 0x00000001u;
         /* 020743FC */ if (_t7) goto L_02074444; else goto L_02074400;
   L_02074400: ; // 0x2074400
@@ -7998,12 +7998,12 @@ void Gambit_fn_02074460(CPUState* cpu) {
         /* 020B8624 */ _t4 = cpu->r[31] + 0x000001E8u;
         /* 020B8624 */ cpu->r[0] = rbrew_read8(cpu->mem, _t4);
         /* 020B8628 */ /* nop */
-        /* 020B862C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B862C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B862C */ _t6 = _t5 & 0x00000001u;
         /* 020B862C */ if (_t6) goto L_020B8630; else goto L_020B8668;
   L_020B8630: ; // 0x20b8630
-        /* 020B8630 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020B8634 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8630 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020B8634 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8634 */ _t8 = _t7 & 0x00000001u;
         /* 020B8634 */ if (_t8) goto L_020B868C; else goto L_020B8638;
   L_020B8638: ; // 0x20b8638
@@ -8023,13 +8023,13 @@ void Gambit_fn_02074460(CPUState* cpu) {
         /* 020B8660 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 020B8664 */ return;
   L_020B8668: ; // 0x20b8668
-        /* 020B8668 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 020B866C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8668 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 020B866C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B866C */ _t13 = _t12 & 0x00000001u;
         /* 020B866C */ if (_t13) goto L_020B8670; else goto L_020B868C;
   L_020B8670: ; // 0x20b8670
-        /* 020B8670 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020B8674 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8670 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020B8674 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8674 */ _t15 = _t14 & 0x00000001u;
         /* 020B8674 */ if (_t15) goto L_020B8678; else goto L_020B868C;
   L_020B8678: ; // 0x20b8678
@@ -8118,19 +8118,19 @@ void Gambit_fn_02074498(CPUState* cpu) {
         /* 0207464C */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
         /* 02074650 */ cpu->r[31] = cpu->r[3];
         /* 02074654 */ cpu->r[12] = cpu->r[12] + 0xFFFFA520u;
-        /* 02074658 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 02074658 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 0207465C */ _t3 = cpu->r[8] + 0xFFFFA558u;
         /* 0207465C */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t3);
         /* 02074660 */ _t4 = cpu->r[1] + 0x00000024u;
         /* 02074660 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 02074664 */ _t5 = cpu->r[31] + 0x00000228u;
         /* 02074664 */ cpu->r[9] = rbrew_read8(cpu->mem, _t5);
-        /* 02074668 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074668 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074668 */ _t7 = _t6 & 0x00000001u;
         /* 02074668 */ if (_t7) goto L_020746A0; else goto L_0207466C;
   L_0207466C: ; // 0x207466c
-        /* 0207466C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02074670 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207466C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02074670 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074670 */ _t9 = _t8 & 0x00000001u;
         /* 02074670 */ if (_t9) goto L_02074674; else goto L_020746D0;
   L_02074674: ; // 0x2074674
@@ -8149,8 +8149,8 @@ void Gambit_fn_02074498(CPUState* cpu) {
         /* 02074698 */ rbrew_write8(cpu->mem, _t12, (uint8_t)cpu->r[11]);
         /* 0207469C */ goto L_020746D0;
   L_020746A0: ; // 0x20746a0
-        /* 020746A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 020746A4 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020746A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 020746A4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020746A4 */ _t14 = _t13 & 0x00000001u;
         /* 020746A4 */ if (_t14) goto L_020746D0; else goto L_020746A8;
   L_020746A8: ; // 0x20746a8
@@ -8195,19 +8195,19 @@ void Gambit_fn_020744A0(CPUState* cpu) {
         /* 02074784 */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
         /* 02074788 */ cpu->r[31] = cpu->r[3];
         /* 0207478C */ cpu->r[11] = cpu->r[11] + 0xFFFFA520u;
-        /* 02074790 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 02074790 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 02074794 */ _t3 = cpu->r[1] + 0x00000024u;
         /* 02074794 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 02074798 */ cpu->r[0] = 0x10010000u;
         /* 0207479C */ _t4 = cpu->r[31] + 0x00000229u;
         /* 0207479C */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 020747A0 */ cpu->r[0] = cpu->r[0] + 0xFFFFA584u;
-        /* 020747A4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020747A4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020747A4 */ _t6 = _t5 & 0x00000001u;
         /* 020747A4 */ if (_t6) goto L_020747DC; else goto L_020747A8;
   L_020747A8: ; // 0x20747a8
-        /* 020747A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020747AC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020747A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020747AC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020747AC */ _t8 = _t7 & 0x00000001u;
         /* 020747AC */ if (_t8) goto L_020747B0; else goto L_0207480C;
   L_020747B0: ; // 0x20747b0
@@ -8227,8 +8227,8 @@ void Gambit_fn_020744A0(CPUState* cpu) {
         /* 020747D4 */ rbrew_write8(cpu->mem, _t12, (uint8_t)cpu->r[10]);
         /* 020747D8 */ goto L_0207480C;
   L_020747DC: ; // 0x20747dc
-        /* 020747DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020747E0 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020747DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020747E0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020747E0 */ _t14 = _t13 & 0x00000001u;
         /* 020747E0 */ if (_t14) goto L_0207480C; else goto L_020747E4;
   L_020747E4: ; // 0x20747e4
@@ -8323,19 +8323,19 @@ void Gambit_fn_020744D8(CPUState* cpu) {
         /* 02074AB8 */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
         /* 02074ABC */ cpu->r[31] = cpu->r[3];
         /* 02074AC0 */ cpu->r[11] = cpu->r[11] + 0xFFFFA520u;
-        /* 02074AC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 02074AC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 02074AC8 */ _t3 = cpu->r[1] + 0x00000024u;
         /* 02074AC8 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 02074ACC */ cpu->r[0] = 0x10010000u;
         /* 02074AD0 */ _t4 = cpu->r[31] + 0x0000022Cu;
         /* 02074AD0 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 02074AD4 */ cpu->r[0] = cpu->r[0] + 0xFFFFA5A8u;
-        /* 02074AD8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074AD8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074AD8 */ _t6 = _t5 & 0x00000001u;
         /* 02074AD8 */ if (_t6) goto L_02074B10; else goto L_02074ADC;
   L_02074ADC: ; // 0x2074adc
-        /* 02074ADC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02074AE0 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074ADC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02074AE0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074AE0 */ _t8 = _t7 & 0x00000001u;
         /* 02074AE0 */ if (_t8) goto L_02074AE4; else goto L_02074B40;
   L_02074AE4: ; // 0x2074ae4
@@ -8355,8 +8355,8 @@ void Gambit_fn_020744D8(CPUState* cpu) {
         /* 02074B08 */ rbrew_write8(cpu->mem, _t12, (uint8_t)cpu->r[10]);
         /* 02074B0C */ goto L_02074B40;
   L_02074B10: ; // 0x2074b10
-        /* 02074B10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02074B14 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074B10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02074B14 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074B14 */ _t14 = _t13 & 0x00000001u;
         /* 02074B14 */ if (_t14) goto L_02074B40; else goto L_02074B18;
   L_02074B18: ; // 0x2074b18
@@ -8405,12 +8405,12 @@ void Gambit_fn_020744E0(CPUState* cpu) {
         /* 020B8624 */ _t4 = cpu->r[31] + 0x000001E8u;
         /* 020B8624 */ cpu->r[0] = rbrew_read8(cpu->mem, _t4);
         /* 020B8628 */ /* nop */
-        /* 020B862C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B862C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B862C */ _t6 = _t5 & 0x00000001u;
         /* 020B862C */ if (_t6) goto L_020B8630; else goto L_020B8668;
   L_020B8630: ; // 0x20b8630
-        /* 020B8630 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020B8634 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8630 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020B8634 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8634 */ _t8 = _t7 & 0x00000001u;
         /* 020B8634 */ if (_t8) goto L_020B868C; else goto L_020B8638;
   L_020B8638: ; // 0x20b8638
@@ -8430,13 +8430,13 @@ void Gambit_fn_020744E0(CPUState* cpu) {
         /* 020B8660 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 020B8664 */ return;
   L_020B8668: ; // 0x20b8668
-        /* 020B8668 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 020B866C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8668 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 020B866C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B866C */ _t13 = _t12 & 0x00000001u;
         /* 020B866C */ if (_t13) goto L_020B8670; else goto L_020B868C;
   L_020B8670: ; // 0x20b8670
-        /* 020B8670 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020B8674 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8670 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020B8674 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8674 */ _t15 = _t14 & 0x00000001u;
         /* 020B8674 */ if (_t15) goto L_020B8678; else goto L_020B868C;
   L_020B8678: ; // 0x20b8678
@@ -8657,11 +8657,11 @@ void Gambit_fn_02074564(CPUState* cpu) {
         /* 02074E50 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02074E50 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02074E54 */ cpu->r[30] = cpu->r[3];
-        /* 02074E54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02074E54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02074E58 */ cpu->r[31] = cpu->r[4];
         /* 02074E5C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02074E5C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02074E60 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074E60 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074E60 */ _t5 = _t4 & 0x00000001u;
         /* 02074E60 */ if (_t5) goto L_02074ED0; else goto L_02074E64;
   L_02074E64: ; // 0x2074e64
@@ -8675,10 +8675,10 @@ void Gambit_fn_02074564(CPUState* cpu) {
         /* 02074E7C */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02074E7C */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02074E80 */ cpu->r[11] = cpu->r[11] + 0xFFFFA7A4u;
-        /* 02074E84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02074E84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02074E88 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02074E88 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02074E8C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074E8C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074E8C */ _t10 = _t9 & 0x00000001u;
         /* 02074E8C */ if (_t10) goto L_02074EC0; else goto L_02074E90;
   L_02074E90: ; // 0x2074e90
@@ -8699,8 +8699,8 @@ void Gambit_fn_02074564(CPUState* cpu) {
         /* 02074EBC */ Gambit_fn_02068798(cpu);
   L_02074EC0: ; // 0x2074ec0
         /* 02074EC0 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02074EC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02074EC4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074EC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02074EC4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074EC4 */ _t15 = _t14 & 0x00000001u;
         /* 02074EC4 */ if (_t15) goto L_02074ED0; else goto L_02074EC8;
   L_02074EC8: ; // 0x2074ec8
@@ -8728,8 +8728,8 @@ void Gambit_fn_0207456C(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -8780,18 +8780,18 @@ void Gambit_fn_02074584(CPUState* cpu) {
         /* 0207458C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0207458C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02074590 */ cpu->r[31] = cpu->r[3];
-        /* 02074590 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02074590 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02074594 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02074594 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 02074598 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074598 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074598 */ _t4 = _t3 & 0x00000001u;
         /* 02074598 */ if (_t4) goto L_0207459C; else goto L_020745AC;
   L_0207459C: ; // 0x207459c
         /* 0207459C */ cpu->r[3] = 0x00000230u;
         /* 020745A0 */ Gambit_fn_02801A78(cpu);
         /* 020745A4 */ cpu->r[31] = cpu->r[3];
-        /* 020745A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020745A8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020745A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020745A8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020745A8 */ _t6 = _t5 & 0x00000001u;
         /* 020745A8 */ if (_t6) goto L_02074624; else goto L_020745AC;
   L_020745AC: ; // 0x20745ac
@@ -8861,18 +8861,18 @@ void Gambit_fn_02074588(CPUState* cpu) {
         /* 0207458C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0207458C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02074590 */ cpu->r[31] = cpu->r[3];
-        /* 02074590 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02074590 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02074594 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02074594 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 02074598 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074598 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074598 */ _t4 = _t3 & 0x00000001u;
         /* 02074598 */ if (_t4) goto L_0207459C; else goto L_020745AC;
   L_0207459C: ; // 0x207459c
         /* 0207459C */ cpu->r[3] = 0x00000230u;
         /* 020745A0 */ Gambit_fn_02801A78(cpu);
         /* 020745A4 */ cpu->r[31] = cpu->r[3];
-        /* 020745A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020745A8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020745A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020745A8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020745A8 */ _t6 = _t5 & 0x00000001u;
         /* 020745A8 */ if (_t6) goto L_02074624; else goto L_020745AC;
   L_020745AC: ; // 0x20745ac
@@ -8944,19 +8944,19 @@ void Gambit_fn_02074644(CPUState* cpu) {
         /* 0207464C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02074650 */ cpu->r[31] = cpu->r[3];
         /* 02074654 */ cpu->r[12] = cpu->r[12] + 0xFFFFA520u;
-        /* 02074658 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 02074658 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 0207465C */ _t2 = cpu->r[8] + 0xFFFFA558u;
         /* 0207465C */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t2);
         /* 02074660 */ _t3 = cpu->r[1] + 0x00000024u;
         /* 02074660 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 02074664 */ _t4 = cpu->r[31] + 0x00000228u;
         /* 02074664 */ cpu->r[9] = rbrew_read8(cpu->mem, _t4);
-        /* 02074668 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074668 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074668 */ _t6 = _t5 & 0x00000001u;
         /* 02074668 */ if (_t6) goto L_020746A0; else goto L_0207466C;
   L_0207466C: ; // 0x207466c
-        /* 0207466C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02074670 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207466C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02074670 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074670 */ _t8 = _t7 & 0x00000001u;
         /* 02074670 */ if (_t8) goto L_02074674; else goto L_020746D0;
   L_02074674: ; // 0x2074674
@@ -8975,8 +8975,8 @@ void Gambit_fn_02074644(CPUState* cpu) {
         /* 02074698 */ rbrew_write8(cpu->mem, _t11, (uint8_t)cpu->r[11]);
         /* 0207469C */ goto L_020746D0;
   L_020746A0: ; // 0x20746a0
-        /* 020746A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 020746A4 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020746A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 020746A4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020746A4 */ _t13 = _t12 & 0x00000001u;
         /* 020746A4 */ if (_t13) goto L_020746D0; else goto L_020746A8;
   L_020746A8: ; // 0x20746a8
@@ -9139,19 +9139,19 @@ void Gambit_fn_0207477C(CPUState* cpu) {
         /* 02074784 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02074788 */ cpu->r[31] = cpu->r[3];
         /* 0207478C */ cpu->r[11] = cpu->r[11] + 0xFFFFA520u;
-        /* 02074790 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 02074790 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 02074794 */ _t2 = cpu->r[1] + 0x00000024u;
         /* 02074794 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02074798 */ cpu->r[0] = 0x10010000u;
         /* 0207479C */ _t3 = cpu->r[31] + 0x00000229u;
         /* 0207479C */ cpu->r[12] = rbrew_read8(cpu->mem, _t3);
         /* 020747A0 */ cpu->r[0] = cpu->r[0] + 0xFFFFA584u;
-        /* 020747A4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020747A4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020747A4 */ _t5 = _t4 & 0x00000001u;
         /* 020747A4 */ if (_t5) goto L_020747DC; else goto L_020747A8;
   L_020747A8: ; // 0x20747a8
-        /* 020747A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020747AC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020747A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020747AC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020747AC */ _t7 = _t6 & 0x00000001u;
         /* 020747AC */ if (_t7) goto L_020747B0; else goto L_0207480C;
   L_020747B0: ; // 0x20747b0
@@ -9171,8 +9171,8 @@ void Gambit_fn_0207477C(CPUState* cpu) {
         /* 020747D4 */ rbrew_write8(cpu->mem, _t11, (uint8_t)cpu->r[10]);
         /* 020747D8 */ goto L_0207480C;
   L_020747DC: ; // 0x20747dc
-        /* 020747DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020747E0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020747DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020747E0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020747E0 */ _t13 = _t12 & 0x00000001u;
         /* 020747E0 */ if (_t13) goto L_0207480C; else goto L_020747E4;
   L_020747E4: ; // 0x20747e4
@@ -9222,7 +9222,7 @@ void Gambit_fn_02074820(CPUState* cpu) {
         /* 02074840 */ cpu->r[11] = cpu->r[11] + 0xFFFFA598u;
         /* 02074844 */ _t5 = cpu->r[1] + 0x00000030u;
         /* 02074844 */ rbrew_write32(cpu->mem, _t5, cpu->r[28]);
-        /* 02074848 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02074848 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0207484C */ cpu->r[31] = 0x10010000u;
         /* 02074850 */ _t6 = cpu->r[1] + 0x00000048u;
         /* 02074850 */ rbrew_write_f32(cpu->mem, _t6, cpu->f[31]);
@@ -9246,19 +9246,19 @@ void Gambit_fn_02074820(CPUState* cpu) {
         /* 02074888 */ _t11 = cpu->r[1] + 0x0000002Cu;
         /* 02074888 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
         /* 0207488C */ cpu->r[0] = cpu->r[12];
-        /* 02074890 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074890 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074890 */ _t13 = _t12 & 0x00000001u;
         /* 02074890 */ if (_t13) goto L_02074960; else goto L_02074894;
   L_02074894: ; // 0x2074894
-        /* 02074894 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000002u);
-        /* 02074898 */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02074894 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000002u));
+        /* 02074898 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02074898 */ _t15 = _t14 & 0x00000001u;
         /* 02074898 */ if (_t15) goto L_0207489C; else goto L_020748AC;
   L_0207489C: ; // 0x207489c
         /* 0207489C */ _t16 = cpu->r[28] + cpu->r[0];
         /* 0207489C */ cpu->r[7] = rbrew_read8(cpu->mem, _t16);
-        /* 020748A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 020748A4 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020748A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 020748A4 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020748A4 */ _t18 = _t17 & 0x00000001u;
         /* 020748A4 */ if (_t18) goto L_020748B8; else goto L_020748A8;
   L_020748A8: ; // 0x20748a8
@@ -9266,8 +9266,8 @@ void Gambit_fn_02074820(CPUState* cpu) {
   L_020748AC: ; // 0x20748ac
         /* 020748AC */ _t19 = cpu->r[28] + 0x00000000u;
         /* 020748AC */ cpu->r[7] = rbrew_read8(cpu->mem, _t19);
-        /* 020748B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 020748B4 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020748B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 020748B4 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020748B4 */ _t21 = _t20 & 0x00000001u;
         /* 020748B4 */ if (_t21) goto L_020748B8; else goto L_02074984;
   L_020748B8: ; // 0x20748b8
@@ -9284,8 +9284,8 @@ void Gambit_fn_02074820(CPUState* cpu) {
         /* 020748D4 */ Gambit_fn_027ED2B0(cpu);
         /* 020748D8 */ _t25 = cpu->r[30] + 0x00000000u;
         /* 020748D8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t25);
-        /* 020748DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000002u);
-        /* 020748E0 */ _t26 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020748DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000002u));
+        /* 020748E0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020748E0 */ _t27 = _t26 & 0x00000001u;
         /* 020748E0 */ if (_t27) goto L_020748E4; else goto L_02074908;
   L_020748E4: ; // 0x20748e4
@@ -9296,9 +9296,9 @@ void Gambit_fn_02074820(CPUState* cpu) {
         /* 020748F0 */ _t29 = cpu->r[28] + 0x00000000u;
         /* 020748F0 */ cpu->r[11] = rbrew_read8(cpu->mem, _t29);
         /* 020748F4 */ cpu->r[0] = 0x10010000u;
-        /* 020748F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 020748F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 020748FC */ cpu->r[0] = cpu->r[0] + 0xFFFFA590u;
-        /* 02074900 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074900 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074900 */ _t31 = _t30 & 0x00000001u;
         /* 02074900 */ if (_t31) goto L_02074A0C; else goto L_02074904;
   L_02074904: ; // 0x2074904
@@ -9330,7 +9330,7 @@ void Gambit_fn_02074820(CPUState* cpu) {
         /* 02074944 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t39);
         /* 02074948 */ _t40 = cpu->r[1] + 0x0000003Cu;
         /* 02074948 */ cpu->r[31] = rbrew_read32(cpu->mem, _t40);
-        /* 0207494C */ _t41 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207494C */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207494C */ _t42 = _t41 & 0x00000001u;
         /* 0207494C */ if (_t42) goto L_02074950; // else: addr-0 trap, fall-through
   L_02074950: ; // 0x2074950
@@ -9340,15 +9340,15 @@ void Gambit_fn_02074820(CPUState* cpu) {
         /* 02074958 */ cpu->r[1] = cpu->r[1] + 0x00000050u;
         /* 0207495C */ return;
   L_02074960: ; // 0x2074960
-        /* 02074960 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000002u);
-        /* 02074964 */ _t44 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02074960 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000002u));
+        /* 02074964 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02074964 */ _t45 = _t44 & 0x00000001u;
         /* 02074964 */ if (_t45) goto L_02074968; else goto L_02074978;
   L_02074968: ; // 0x2074968
         /* 02074968 */ _t46 = cpu->r[28] + cpu->r[0];
         /* 02074968 */ cpu->r[6] = rbrew_read8(cpu->mem, _t46);
-        /* 0207496C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 02074970 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207496C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 02074970 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074970 */ _t48 = _t47 & 0x00000001u;
         /* 02074970 */ if (_t48) goto L_02074984; else goto L_02074974;
   L_02074974: ; // 0x2074974
@@ -9356,17 +9356,17 @@ void Gambit_fn_02074820(CPUState* cpu) {
   L_02074978: ; // 0x2074978
         /* 02074978 */ _t49 = cpu->r[28] + 0x00000000u;
         /* 02074978 */ cpu->r[6] = rbrew_read8(cpu->mem, _t49);
-        /* 0207497C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 02074980 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207497C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 02074980 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074980 */ _t51 = _t50 & 0x00000001u;
         /* 02074980 */ if (_t51) goto L_02074984; else goto L_0207499C;
   L_02074984: ; // 0x2074984
         /* 02074984 */ _t52 = cpu->r[28] + 0x00000000u;
         /* 02074984 */ cpu->r[11] = rbrew_read8(cpu->mem, _t52);
         /* 02074988 */ cpu->r[0] = 0x10010000u;
-        /* 0207498C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0207498C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02074990 */ cpu->r[0] = cpu->r[0] + 0xFFFFA590u;
-        /* 02074994 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074994 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074994 */ _t54 = _t53 & 0x00000001u;
         /* 02074994 */ if (_t54) goto L_02074A0C; else goto L_02074998;
   L_02074998: ; // 0x2074998
@@ -9387,8 +9387,8 @@ void Gambit_fn_02074820(CPUState* cpu) {
         /* 020749BC */ Gambit_fn_027ED2B0(cpu);
         /* 020749C0 */ _t59 = cpu->r[30] + 0x00000000u;
         /* 020749C0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t59);
-        /* 020749C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000002u);
-        /* 020749C8 */ _t60 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020749C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000002u));
+        /* 020749C8 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020749C8 */ _t61 = _t60 & 0x00000001u;
         /* 020749C8 */ if (_t61) goto L_020749CC; else goto L_020749F0;
   L_020749CC: ; // 0x20749cc
@@ -9399,9 +9399,9 @@ void Gambit_fn_02074820(CPUState* cpu) {
         /* 020749D8 */ _t63 = cpu->r[28] + 0x00000000u;
         /* 020749D8 */ cpu->r[11] = rbrew_read8(cpu->mem, _t63);
         /* 020749DC */ cpu->r[0] = 0x10010000u;
-        /* 020749E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 020749E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 020749E4 */ cpu->r[0] = cpu->r[0] + 0xFFFFA590u;
-        /* 020749E8 */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020749E8 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020749E8 */ _t65 = _t64 & 0x00000001u;
         /* 020749E8 */ if (_t65) goto L_02074A0C; else goto L_020749EC;
   L_020749EC: ; // 0x20749ec
@@ -9413,16 +9413,16 @@ void Gambit_fn_02074820(CPUState* cpu) {
         /* 020749F8 */ _t67 = cpu->r[28] + 0x00000000u;
         /* 020749F8 */ cpu->r[11] = rbrew_read8(cpu->mem, _t67);
         /* 020749FC */ cpu->r[0] = 0x10010000u;
-        /* 02074A00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02074A00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02074A04 */ cpu->r[0] = cpu->r[0] + 0xFFFFA590u;
-        /* 02074A08 */ _t68 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074A08 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074A08 */ _t69 = _t68 & 0x00000001u;
         /* 02074A08 */ if (_t69) goto L_02074A0C; else goto L_02074A18;
   L_02074A0C: ; // 0x2074a0c
         /* 02074A0C */ _t70 = cpu->r[28] + 0x00000001u;
         /* 02074A0C */ cpu->r[12] = rbrew_read8(cpu->mem, _t70);
-        /* 02074A10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02074A14 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074A10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02074A14 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074A14 */ _t72 = _t71 & 0x00000001u;
         /* 02074A14 */ if (_t72) goto L_02074A60; else goto L_02074A18;
   L_02074A18: ; // 0x2074a18
@@ -9447,7 +9447,7 @@ void Gambit_fn_02074820(CPUState* cpu) {
         /* 02074A44 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t79);
         /* 02074A48 */ _t80 = cpu->r[1] + 0x0000003Cu;
         /* 02074A48 */ cpu->r[31] = rbrew_read32(cpu->mem, _t80);
-        /* 02074A4C */ _t81 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02074A4C */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02074A4C */ _t82 = _t81 & 0x00000001u;
         /* 02074A4C */ if (_t82) goto L_02074A50; // else: addr-0 trap, fall-through
   L_02074A50: ; // 0x2074a50
@@ -9480,7 +9480,7 @@ void Gambit_fn_02074820(CPUState* cpu) {
         /* 02074A90 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t91);
         /* 02074A94 */ _t92 = cpu->r[1] + 0x0000003Cu;
         /* 02074A94 */ cpu->r[31] = rbrew_read32(cpu->mem, _t92);
-        /* 02074A98 */ _t93 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02074A98 */ _t93 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02074A98 */ _t94 = _t93 & 0x00000001u;
         /* 02074A98 */ if (_t94) goto L_02074A9C; // else: addr-0 trap, fall-through
   L_02074A9C: ; // 0x2074a9c
@@ -9504,19 +9504,19 @@ void Gambit_fn_02074AB0(CPUState* cpu) {
         /* 02074AB8 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02074ABC */ cpu->r[31] = cpu->r[3];
         /* 02074AC0 */ cpu->r[11] = cpu->r[11] + 0xFFFFA520u;
-        /* 02074AC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 02074AC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 02074AC8 */ _t2 = cpu->r[1] + 0x00000024u;
         /* 02074AC8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02074ACC */ cpu->r[0] = 0x10010000u;
         /* 02074AD0 */ _t3 = cpu->r[31] + 0x0000022Cu;
         /* 02074AD0 */ cpu->r[12] = rbrew_read8(cpu->mem, _t3);
         /* 02074AD4 */ cpu->r[0] = cpu->r[0] + 0xFFFFA5A8u;
-        /* 02074AD8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074AD8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074AD8 */ _t5 = _t4 & 0x00000001u;
         /* 02074AD8 */ if (_t5) goto L_02074B10; else goto L_02074ADC;
   L_02074ADC: ; // 0x2074adc
-        /* 02074ADC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02074AE0 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074ADC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02074AE0 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074AE0 */ _t7 = _t6 & 0x00000001u;
         /* 02074AE0 */ if (_t7) goto L_02074AE4; else goto L_02074B40;
   L_02074AE4: ; // 0x2074ae4
@@ -9536,8 +9536,8 @@ void Gambit_fn_02074AB0(CPUState* cpu) {
         /* 02074B08 */ rbrew_write8(cpu->mem, _t11, (uint8_t)cpu->r[10]);
         /* 02074B0C */ goto L_02074B40;
   L_02074B10: ; // 0x2074b10
-        /* 02074B10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02074B14 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074B10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02074B14 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074B14 */ _t13 = _t12 & 0x00000001u;
         /* 02074B14 */ if (_t13) goto L_02074B40; else goto L_02074B18;
   L_02074B18: ; // 0x2074b18
@@ -9940,15 +9940,15 @@ void Gambit_fn_02074E30(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02074E30: ; // 0x2074e30
-        /* 02074E30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02074E34 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074E30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02074E34 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074E34 */ _t1 = _t0 & 0x00000001u;
         /* 02074E34 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02074E34 */ goto L_02074E38;
   L_02074E38: ; // 0x2074e38
         /* 02074E38 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02074E38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02074E3C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074E38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02074E3C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074E3C */ _t3 = _t2 & 0x00000001u;
         /* 02074E3C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02074E3C */ goto L_02074E40;
@@ -9967,8 +9967,8 @@ void Gambit_fn_02074E30(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -9982,15 +9982,15 @@ void Gambit_fn_02074E30(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -10027,11 +10027,11 @@ void Gambit_fn_02074E44(CPUState* cpu) {
         /* 02074E50 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02074E50 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02074E54 */ cpu->r[30] = cpu->r[3];
-        /* 02074E54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02074E54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02074E58 */ cpu->r[31] = cpu->r[4];
         /* 02074E5C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02074E5C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02074E60 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074E60 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074E60 */ _t5 = _t4 & 0x00000001u;
         /* 02074E60 */ if (_t5) goto L_02074ED0; else goto L_02074E64;
   L_02074E64: ; // 0x2074e64
@@ -10045,10 +10045,10 @@ void Gambit_fn_02074E44(CPUState* cpu) {
         /* 02074E7C */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02074E7C */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02074E80 */ cpu->r[11] = cpu->r[11] + 0xFFFFA7A4u;
-        /* 02074E84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02074E84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02074E88 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02074E88 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02074E8C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074E8C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074E8C */ _t10 = _t9 & 0x00000001u;
         /* 02074E8C */ if (_t10) goto L_02074EC0; else goto L_02074E90;
   L_02074E90: ; // 0x2074e90
@@ -10069,8 +10069,8 @@ void Gambit_fn_02074E44(CPUState* cpu) {
         /* 02074EBC */ Gambit_fn_02068798(cpu);
   L_02074EC0: ; // 0x2074ec0
         /* 02074EC0 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02074EC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02074EC4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074EC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02074EC4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074EC4 */ _t15 = _t14 & 0x00000001u;
         /* 02074EC4 */ if (_t15) goto L_02074ED0; else goto L_02074EC8;
   L_02074EC8: ; // 0x2074ec8
@@ -10101,11 +10101,11 @@ void Gambit_fn_02074E48(CPUState* cpu) {
         /* 02074E50 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02074E50 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02074E54 */ cpu->r[30] = cpu->r[3];
-        /* 02074E54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02074E54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02074E58 */ cpu->r[31] = cpu->r[4];
         /* 02074E5C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02074E5C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02074E60 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074E60 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074E60 */ _t5 = _t4 & 0x00000001u;
         /* 02074E60 */ if (_t5) goto L_02074ED0; else goto L_02074E64;
   L_02074E64: ; // 0x2074e64
@@ -10119,10 +10119,10 @@ void Gambit_fn_02074E48(CPUState* cpu) {
         /* 02074E7C */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02074E7C */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02074E80 */ cpu->r[11] = cpu->r[11] + 0xFFFFA7A4u;
-        /* 02074E84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02074E84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02074E88 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02074E88 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02074E8C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074E8C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074E8C */ _t10 = _t9 & 0x00000001u;
         /* 02074E8C */ if (_t10) goto L_02074EC0; else goto L_02074E90;
   L_02074E90: ; // 0x2074e90
@@ -10143,8 +10143,8 @@ void Gambit_fn_02074E48(CPUState* cpu) {
         /* 02074EBC */ Gambit_fn_02068798(cpu);
   L_02074EC0: ; // 0x2074ec0
         /* 02074EC0 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02074EC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02074EC4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074EC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02074EC4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074EC4 */ _t15 = _t14 & 0x00000001u;
         /* 02074EC4 */ if (_t15) goto L_02074ED0; else goto L_02074EC8;
   L_02074EC8: ; // 0x2074ec8
@@ -10240,9 +10240,9 @@ void Gambit_fn_02074F24(CPUState* cpu) {
         /* 02074F28 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 02074F28 */ cpu->r[9] = _t0;
         /* 02074F2C */ cpu->r[12] = 0x101D0000u;
-        /* 02074F30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02074F30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02074F34 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 02074F38 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074F38 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074F38 */ _t2 = _t1 & 0x00000001u;
         /* 02074F38 */ if (_t2) goto L_02074F3C; else goto L_02074F50;
   L_02074F3C: ; // 0x2074f3c
@@ -10254,8 +10254,8 @@ void Gambit_fn_02074F24(CPUState* cpu) {
         /* 02074F4C */ _t4 = cpu->r[12] + 0x00000000u;
         /* 02074F4C */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_02074F50: ; // 0x2074f50
-        /* 02074F50 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02074F54 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074F50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02074F54 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074F54 */ _t6 = _t5 & 0x00000001u;
         /* 02074F54 */ if (_t6) goto L_02074F58; else goto L_02074F60;
   L_02074F58: ; // 0x2074f58
@@ -10267,9 +10267,9 @@ void Gambit_fn_02074F24(CPUState* cpu) {
         /* 02074F64 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 02074F64 */ cpu->r[7] = _t7;
         /* 02074F68 */ cpu->r[11] = 0x101D0000u;
-        /* 02074F6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02074F6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02074F70 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 02074F74 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02074F74 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02074F74 */ _t9 = _t8 & 0x00000001u;
         /* 02074F74 */ if (_t9) goto L_02074F78; else goto L_02074F8C;
   L_02074F78: ; // 0x2074f78
@@ -10360,18 +10360,18 @@ void Gambit_fn_02074FC8(CPUState* cpu) {
         /* 0206C8A8 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0206C8A8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0206C8AC */ cpu->r[12] = 0x00000000u;
-        /* 0206C8B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0206C8B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0206C8B4 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0206C8B4 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0206C8B8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206C8B8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206C8B8 */ _t6 = _t5 & 0x00000001u;
         /* 0206C8B8 */ if (_t6) goto L_0206C8E0; else goto L_0206C8BC;
   L_0206C8BC: ; // 0x206c8bc
         /* 0206C8BC */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0206C8BC */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0206C8C0 */ /* nop */
-        /* 0206C8C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0206C8C8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206C8C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0206C8C8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206C8C8 */ _t9 = _t8 & 0x00000001u;
         /* 0206C8C8 */ if (_t9) goto L_0206C8CC; else goto L_0206C8E0;
   L_0206C8CC: ; // 0x206c8cc
@@ -10453,11 +10453,11 @@ void Gambit_fn_02074FEC(CPUState* cpu) {
         /* 02075520 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02075520 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02075524 */ cpu->r[30] = cpu->r[3];
-        /* 02075524 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02075524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02075528 */ cpu->r[31] = cpu->r[4];
         /* 0207552C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0207552C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02075530 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075530 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075530 */ _t5 = _t4 & 0x00000001u;
         /* 02075530 */ if (_t5) goto L_020755A0; else goto L_02075534;
   L_02075534: ; // 0x2075534
@@ -10471,10 +10471,10 @@ void Gambit_fn_02074FEC(CPUState* cpu) {
         /* 0207554C */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0207554C */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02075550 */ cpu->r[11] = cpu->r[11] + 0xFFFFAA90u;
-        /* 02075554 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02075554 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02075558 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02075558 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0207555C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207555C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207555C */ _t10 = _t9 & 0x00000001u;
         /* 0207555C */ if (_t10) goto L_02075590; else goto L_02075560;
   L_02075560: ; // 0x2075560
@@ -10495,8 +10495,8 @@ void Gambit_fn_02074FEC(CPUState* cpu) {
         /* 0207558C */ Gambit_fn_02068798(cpu);
   L_02075590: ; // 0x2075590
         /* 02075590 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02075590 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02075594 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075590 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02075594 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075594 */ _t15 = _t14 & 0x00000001u;
         /* 02075594 */ if (_t15) goto L_020755A0; else goto L_02075598;
   L_02075598: ; // 0x2075598
@@ -10524,8 +10524,8 @@ void Gambit_fn_02074FF4(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -10578,18 +10578,18 @@ void Gambit_fn_0207500C(CPUState* cpu) {
         /* 02075018 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02075018 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0207501C */ cpu->r[31] = cpu->r[3];
-        /* 0207501C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0207501C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02075020 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02075020 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02075024 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075024 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075024 */ _t5 = _t4 & 0x00000001u;
         /* 02075024 */ if (_t5) goto L_02075028; else goto L_02075038;
   L_02075028: ; // 0x2075028
         /* 02075028 */ cpu->r[3] = 0x00000234u;
         /* 0207502C */ Gambit_fn_02801A78(cpu);
         /* 02075030 */ cpu->r[31] = cpu->r[3];
-        /* 02075030 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02075034 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075030 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02075034 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075034 */ _t7 = _t6 & 0x00000001u;
         /* 02075034 */ if (_t7) goto L_0207517C; else goto L_02075038;
   L_02075038: ; // 0x2075038
@@ -10610,21 +10610,21 @@ void Gambit_fn_0207500C(CPUState* cpu) {
         /* 0207506C */ _t9 = cpu->r[31] + 0x0000000Cu;
         /* 0207506C */ rbrew_write32(cpu->mem, _t9, cpu->r[8]);
         /* 02075070 */ cpu->r[3] = cpu->r[31] + 0x00000224u;
-        /* 02075070 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02075070 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02075074 */ cpu->r[10] = cpu->r[10] + 0xFFFFAAA0u;
         /* 02075078 */ _t10 = cpu->r[31] + 0x0000001Cu;
         /* 02075078 */ rbrew_write32(cpu->mem, _t10, cpu->r[9]);
         /* 0207507C */ cpu->r[30] = 0x00000000u;
         /* 02075080 */ _t11 = cpu->r[31] + 0x000001C8u;
         /* 02075080 */ rbrew_write32(cpu->mem, _t11, cpu->r[10]);
-        /* 02075084 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075084 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075084 */ _t13 = _t12 & 0x00000001u;
         /* 02075084 */ if (_t13) goto L_02075088; else goto L_02075098;
   L_02075088: ; // 0x2075088
         /* 02075088 */ cpu->r[3] = 0x00000008u;
         /* 0207508C */ Gambit_fn_02801A78(cpu);
-        /* 02075090 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02075094 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075090 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02075094 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075094 */ _t15 = _t14 & 0x00000001u;
         /* 02075094 */ if (_t15) goto L_020750A0; else goto L_02075098;
   L_02075098: ; // 0x2075098
@@ -10634,15 +10634,15 @@ void Gambit_fn_0207500C(CPUState* cpu) {
         /* 0207509C */ rbrew_write32(cpu->mem, _t17, cpu->r[30]);
   L_020750A0: ; // 0x20750a0
         /* 020750A0 */ cpu->r[3] = cpu->r[31] + 0x0000022Cu;
-        /* 020750A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020750A4 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020750A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020750A4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020750A4 */ _t19 = _t18 & 0x00000001u;
         /* 020750A4 */ if (_t19) goto L_020750A8; else goto L_020750B8;
   L_020750A8: ; // 0x20750a8
         /* 020750A8 */ cpu->r[3] = 0x00000008u;
         /* 020750AC */ Gambit_fn_02801A78(cpu);
-        /* 020750B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020750B4 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020750B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020750B4 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020750B4 */ _t21 = _t20 & 0x00000001u;
         /* 020750B4 */ if (_t21) goto L_020750C0; else goto L_020750B8;
   L_020750B8: ; // 0x20750b8
@@ -10664,8 +10664,8 @@ void Gambit_fn_0207500C(CPUState* cpu) {
         /* 020750D8 */ cpu->r[4] = 0x00000010u;
         /* 020750DC */ cpu->r[5] = 0x00000004u;
         /* 020750E0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020750E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020750E8 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020750E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020750E8 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020750E8 */ _t28 = _t27 & 0x00000001u;
         /* 020750E8 */ if (_t28) goto L_020750F8; else goto L_020750EC;
   L_020750EC: ; // 0x20750ec
@@ -10677,8 +10677,8 @@ void Gambit_fn_0207500C(CPUState* cpu) {
   L_020750F8: ; // 0x20750f8
         /* 020750F8 */ _t31 = cpu->r[31] + 0x00000224u;
         /* 020750F8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t31);
-        /* 020750FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02075100 */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020750FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02075100 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02075100 */ _t33 = _t32 & 0x00000001u;
         /* 02075100 */ if (_t33) goto L_02075104; else goto L_02075120;
   L_02075104: ; // 0x2075104
@@ -10708,8 +10708,8 @@ void Gambit_fn_0207500C(CPUState* cpu) {
         /* 02075134 */ cpu->r[4] = 0x00000010u;
         /* 02075138 */ cpu->r[5] = 0x00000004u;
         /* 0207513C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02075140 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02075144 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075140 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02075144 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075144 */ _t43 = _t42 & 0x00000001u;
         /* 02075144 */ if (_t43) goto L_02075154; else goto L_02075148;
   L_02075148: ; // 0x2075148
@@ -10721,8 +10721,8 @@ void Gambit_fn_0207500C(CPUState* cpu) {
   L_02075154: ; // 0x2075154
         /* 02075154 */ _t46 = cpu->r[31] + 0x0000022Cu;
         /* 02075154 */ cpu->r[11] = rbrew_read32(cpu->mem, _t46);
-        /* 02075158 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0207515C */ _t47 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02075158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0207515C */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207515C */ _t48 = _t47 & 0x00000001u;
         /* 0207515C */ if (_t48) goto L_02075160; else goto L_0207517C;
   L_02075160: ; // 0x2075160
@@ -10766,18 +10766,18 @@ void Gambit_fn_02075010(CPUState* cpu) {
         /* 02075018 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02075018 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0207501C */ cpu->r[31] = cpu->r[3];
-        /* 0207501C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0207501C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02075020 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02075020 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02075024 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075024 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075024 */ _t5 = _t4 & 0x00000001u;
         /* 02075024 */ if (_t5) goto L_02075028; else goto L_02075038;
   L_02075028: ; // 0x2075028
         /* 02075028 */ cpu->r[3] = 0x00000234u;
         /* 0207502C */ Gambit_fn_02801A78(cpu);
         /* 02075030 */ cpu->r[31] = cpu->r[3];
-        /* 02075030 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02075034 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075030 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02075034 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075034 */ _t7 = _t6 & 0x00000001u;
         /* 02075034 */ if (_t7) goto L_0207517C; else goto L_02075038;
   L_02075038: ; // 0x2075038
@@ -10798,21 +10798,21 @@ void Gambit_fn_02075010(CPUState* cpu) {
         /* 0207506C */ _t9 = cpu->r[31] + 0x0000000Cu;
         /* 0207506C */ rbrew_write32(cpu->mem, _t9, cpu->r[8]);
         /* 02075070 */ cpu->r[3] = cpu->r[31] + 0x00000224u;
-        /* 02075070 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02075070 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02075074 */ cpu->r[10] = cpu->r[10] + 0xFFFFAAA0u;
         /* 02075078 */ _t10 = cpu->r[31] + 0x0000001Cu;
         /* 02075078 */ rbrew_write32(cpu->mem, _t10, cpu->r[9]);
         /* 0207507C */ cpu->r[30] = 0x00000000u;
         /* 02075080 */ _t11 = cpu->r[31] + 0x000001C8u;
         /* 02075080 */ rbrew_write32(cpu->mem, _t11, cpu->r[10]);
-        /* 02075084 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075084 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075084 */ _t13 = _t12 & 0x00000001u;
         /* 02075084 */ if (_t13) goto L_02075088; else goto L_02075098;
   L_02075088: ; // 0x2075088
         /* 02075088 */ cpu->r[3] = 0x00000008u;
         /* 0207508C */ Gambit_fn_02801A78(cpu);
-        /* 02075090 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02075094 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075090 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02075094 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075094 */ _t15 = _t14 & 0x00000001u;
         /* 02075094 */ if (_t15) goto L_020750A0; else goto L_02075098;
   L_02075098: ; // 0x2075098
@@ -10822,15 +10822,15 @@ void Gambit_fn_02075010(CPUState* cpu) {
         /* 0207509C */ rbrew_write32(cpu->mem, _t17, cpu->r[30]);
   L_020750A0: ; // 0x20750a0
         /* 020750A0 */ cpu->r[3] = cpu->r[31] + 0x0000022Cu;
-        /* 020750A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020750A4 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020750A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020750A4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020750A4 */ _t19 = _t18 & 0x00000001u;
         /* 020750A4 */ if (_t19) goto L_020750A8; else goto L_020750B8;
   L_020750A8: ; // 0x20750a8
         /* 020750A8 */ cpu->r[3] = 0x00000008u;
         /* 020750AC */ Gambit_fn_02801A78(cpu);
-        /* 020750B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020750B4 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020750B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020750B4 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020750B4 */ _t21 = _t20 & 0x00000001u;
         /* 020750B4 */ if (_t21) goto L_020750C0; else goto L_020750B8;
   L_020750B8: ; // 0x20750b8
@@ -10852,8 +10852,8 @@ void Gambit_fn_02075010(CPUState* cpu) {
         /* 020750D8 */ cpu->r[4] = 0x00000010u;
         /* 020750DC */ cpu->r[5] = 0x00000004u;
         /* 020750E0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020750E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020750E8 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020750E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020750E8 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020750E8 */ _t28 = _t27 & 0x00000001u;
         /* 020750E8 */ if (_t28) goto L_020750F8; else goto L_020750EC;
   L_020750EC: ; // 0x20750ec
@@ -10865,8 +10865,8 @@ void Gambit_fn_02075010(CPUState* cpu) {
   L_020750F8: ; // 0x20750f8
         /* 020750F8 */ _t31 = cpu->r[31] + 0x00000224u;
         /* 020750F8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t31);
-        /* 020750FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02075100 */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020750FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02075100 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02075100 */ _t33 = _t32 & 0x00000001u;
         /* 02075100 */ if (_t33) goto L_02075104; else goto L_02075120;
   L_02075104: ; // 0x2075104
@@ -10896,8 +10896,8 @@ void Gambit_fn_02075010(CPUState* cpu) {
         /* 02075134 */ cpu->r[4] = 0x00000010u;
         /* 02075138 */ cpu->r[5] = 0x00000004u;
         /* 0207513C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02075140 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02075144 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075140 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02075144 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075144 */ _t43 = _t42 & 0x00000001u;
         /* 02075144 */ if (_t43) goto L_02075154; else goto L_02075148;
   L_02075148: ; // 0x2075148
@@ -10909,8 +10909,8 @@ void Gambit_fn_02075010(CPUState* cpu) {
   L_02075154: ; // 0x2075154
         /* 02075154 */ _t46 = cpu->r[31] + 0x0000022Cu;
         /* 02075154 */ cpu->r[11] = rbrew_read32(cpu->mem, _t46);
-        /* 02075158 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0207515C */ _t47 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02075158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0207515C */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207515C */ _t48 = _t47 & 0x00000001u;
         /* 0207515C */ if (_t48) goto L_02075160; else goto L_0207517C;
   L_02075160: ; // 0x2075160
@@ -11003,10 +11003,10 @@ void Gambit_fn_02075200(CPUState* cpu) {
         /* 02075224 */ cpu->r[30] = cpu->r[4];
         /* 02075228 */ _t6 = cpu->r[29] + 0x00000228u;
         /* 02075228 */ cpu->r[11] = rbrew_read32(cpu->mem, _t6);
-        /* 0207522C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[5]);
+        /* 0207522C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[5]));
         /* 02075230 */ _t7 = cpu->r[31] + 0x00000000u;
         /* 02075230 */ cpu->r[7] = rbrew_read32(cpu->mem, _t7);
-        /* 02075234 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02075234 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02075234 */ _t9 = _t8 & 0x00000001u;
         /* 02075234 */ if (_t9) goto L_02075238; else goto L_02075240;
   L_02075238: ; // 0x2075238
@@ -11023,10 +11023,10 @@ void Gambit_fn_02075200(CPUState* cpu) {
         /* 02075250 */ cpu->r[8] = rbrew_read32(cpu->mem, _t12);
         /* 02075254 */ _t13 = cpu->r[29] + 0x00000230u;
         /* 02075254 */ cpu->r[12] = rbrew_read32(cpu->mem, _t13);
-        /* 02075258 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[8]);
+        /* 02075258 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[8]));
         /* 0207525C */ _t14 = cpu->r[31] + 0x00000000u;
         /* 0207525C */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
-        /* 02075260 */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02075260 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02075260 */ _t16 = _t15 & 0x00000001u;
         /* 02075260 */ if (_t16) goto L_02075264; else goto L_0207526C;
   L_02075264: ; // 0x2075264
@@ -11075,10 +11075,10 @@ void Gambit_fn_02075204(CPUState* cpu) {
         /* 02075224 */ cpu->r[30] = cpu->r[4];
         /* 02075228 */ _t6 = cpu->r[29] + 0x00000228u;
         /* 02075228 */ cpu->r[11] = rbrew_read32(cpu->mem, _t6);
-        /* 0207522C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[5]);
+        /* 0207522C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[5]));
         /* 02075230 */ _t7 = cpu->r[31] + 0x00000000u;
         /* 02075230 */ cpu->r[7] = rbrew_read32(cpu->mem, _t7);
-        /* 02075234 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02075234 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02075234 */ _t9 = _t8 & 0x00000001u;
         /* 02075234 */ if (_t9) goto L_02075238; else goto L_02075240;
   L_02075238: ; // 0x2075238
@@ -11095,10 +11095,10 @@ void Gambit_fn_02075204(CPUState* cpu) {
         /* 02075250 */ cpu->r[8] = rbrew_read32(cpu->mem, _t12);
         /* 02075254 */ _t13 = cpu->r[29] + 0x00000230u;
         /* 02075254 */ cpu->r[12] = rbrew_read32(cpu->mem, _t13);
-        /* 02075258 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[8]);
+        /* 02075258 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[8]));
         /* 0207525C */ _t14 = cpu->r[31] + 0x00000000u;
         /* 0207525C */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
-        /* 02075260 */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02075260 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02075260 */ _t16 = _t15 & 0x00000001u;
         /* 02075260 */ if (_t16) goto L_02075264; else goto L_0207526C;
   L_02075264: ; // 0x2075264
@@ -11165,17 +11165,17 @@ void Gambit_fn_02075298(CPUState* cpu) {
         /* 020752F4 */ cpu->r[5] = cpu->r[28];
         /* 020752F8 */ cpu->r[4] = cpu->r[26] + 0xFFFFA8ECu;
         /* 020752FC */ cpu->r[3] = cpu->r[1] + 0x00000008u;
-        /* 02075300 */ _t8 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02075300 */ _t8 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02075300 */ _t9 = _t8 & 0x00000001u;
         /* 02075300 */ if (_t9) goto L_02075304; // else: addr-0 trap, fall-through
   L_02075304: ; // 0x2075304
         /* 02075304 */ Gambit_fn_0282A5F4(cpu);
         /* 02075308 */ _t10 = cpu->r[27] + 0x00000224u;
         /* 02075308 */ cpu->r[0] = rbrew_read32(cpu->mem, _t10);
-        /* 0207530C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[0]);
+        /* 0207530C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[0]));
         /* 02075310 */ _t11 = cpu->r[27] + 0x00000228u;
         /* 02075310 */ cpu->r[30] = rbrew_read32(cpu->mem, _t11);
-        /* 02075314 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02075314 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02075314 */ _t13 = _t12 & 0x00000001u;
         /* 02075314 */ if (_t13) goto L_02075318; else goto L_0207531C;
   L_02075318: ; // 0x2075318
@@ -11186,9 +11186,9 @@ void Gambit_fn_02075298(CPUState* cpu) {
         /* 02075324 */ Gambit_fn_026D86B0(cpu);
         /* 02075328 */ _t14 = cpu->r[24] + 0xFFFFED9Cu;
         /* 02075328 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
-        /* 0207532C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0207532C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02075330 */ cpu->r[31] = cpu->r[3];
-        /* 02075334 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075334 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075334 */ _t16 = _t15 & 0x00000001u;
         /* 02075334 */ if (_t16) goto L_02075338; else goto L_02075348;
   L_02075338: ; // 0x2075338
@@ -11199,8 +11199,8 @@ void Gambit_fn_02075298(CPUState* cpu) {
         /* 02075344 */ _t18 = cpu->r[23] + 0xFFFFEDDCu;
         /* 02075344 */ rbrew_write32(cpu->mem, _t18, cpu->r[0]);
   L_02075348: ; // 0x2075348
-        /* 02075348 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0207534C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075348 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0207534C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207534C */ _t20 = _t19 & 0x00000001u;
         /* 0207534C */ if (_t20) goto L_02075370; else goto L_02075350;
   L_02075350: ; // 0x2075350
@@ -11212,8 +11212,8 @@ void Gambit_fn_02075298(CPUState* cpu) {
         /* 0207535C */ cpu->r[3] = cpu->r[31];
         /* 02075360 */ cpu->r[4] = cpu->r[23] + 0xFFFFEDDCu;
         /* 02075364 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02075368 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207536C */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075368 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207536C */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207536C */ _t24 = _t23 & 0x00000001u;
         /* 0207536C */ if (_t24) goto L_02075370; else goto L_02075374;
   L_02075370: ; // 0x2075370
@@ -11222,10 +11222,10 @@ void Gambit_fn_02075298(CPUState* cpu) {
         /* 02075374 */ _t25 = cpu->r[30] + 0x00000000u;
         /* 02075374 */ rbrew_write32(cpu->mem, _t25, cpu->r[31]);
         /* 02075378 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 02075378 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 02075378 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0207537C */ cpu->r[28] = cpu->r[28] + 0x00000001u;
         /* 02075380 */ cpu->r[25] = cpu->r[25] + 0x00000004u;
-        /* 02075384 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075384 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075384 */ _t27 = _t26 & 0x00000001u;
         /* 02075384 */ if (_t27) goto L_02075388; else goto L_020752F4;
   L_02075388: ; // 0x2075388
@@ -11335,17 +11335,17 @@ void Gambit_fn_020753E4(CPUState* cpu) {
         /* 02075434 */ cpu->r[5] = cpu->r[28];
         /* 02075438 */ cpu->r[4] = cpu->r[29] + 0xFFFFA908u;
         /* 0207543C */ cpu->r[3] = cpu->r[1] + 0x00000008u;
-        /* 02075440 */ _t8 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02075440 */ _t8 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02075440 */ _t9 = _t8 & 0x00000001u;
         /* 02075440 */ if (_t9) goto L_02075444; // else: addr-0 trap, fall-through
   L_02075444: ; // 0x2075444
         /* 02075444 */ Gambit_fn_0282A5F4(cpu);
         /* 02075448 */ _t10 = cpu->r[30] + 0x0000022Cu;
         /* 02075448 */ cpu->r[0] = rbrew_read32(cpu->mem, _t10);
-        /* 0207544C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[0]);
+        /* 0207544C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[0]));
         /* 02075450 */ _t11 = cpu->r[30] + 0x00000230u;
         /* 02075450 */ cpu->r[31] = rbrew_read32(cpu->mem, _t11);
-        /* 02075454 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02075454 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02075454 */ _t13 = _t12 & 0x00000001u;
         /* 02075454 */ if (_t13) goto L_02075458; else goto L_0207545C;
   L_02075458: ; // 0x2075458
@@ -11358,10 +11358,10 @@ void Gambit_fn_020753E4(CPUState* cpu) {
         /* 0207546C */ _t14 = cpu->r[31] + 0x00000000u;
         /* 0207546C */ rbrew_write32(cpu->mem, _t14, cpu->r[3]);
         /* 02075470 */ cpu->r[26] = cpu->r[26] + 0xFFFFFFFFu;
-        /* 02075470 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 02075470 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 02075474 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
         /* 02075478 */ cpu->r[27] = cpu->r[27] + 0x00000004u;
-        /* 0207547C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207547C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207547C */ _t16 = _t15 & 0x00000001u;
         /* 0207547C */ if (_t16) goto L_02075480; else goto L_02075434;
   L_02075480: ; // 0x2075480
@@ -11485,15 +11485,15 @@ void Gambit_fn_02075500(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02075500: ; // 0x2075500
-        /* 02075500 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02075504 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075500 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02075504 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075504 */ _t1 = _t0 & 0x00000001u;
         /* 02075504 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02075504 */ goto L_02075508;
   L_02075508: ; // 0x2075508
         /* 02075508 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02075508 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207550C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075508 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207550C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207550C */ _t3 = _t2 & 0x00000001u;
         /* 0207550C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207550C */ goto L_02075510;
@@ -11512,8 +11512,8 @@ void Gambit_fn_02075500(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -11527,15 +11527,15 @@ void Gambit_fn_02075500(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -11572,11 +11572,11 @@ void Gambit_fn_02075514(CPUState* cpu) {
         /* 02075520 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02075520 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02075524 */ cpu->r[30] = cpu->r[3];
-        /* 02075524 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02075524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02075528 */ cpu->r[31] = cpu->r[4];
         /* 0207552C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0207552C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02075530 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075530 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075530 */ _t5 = _t4 & 0x00000001u;
         /* 02075530 */ if (_t5) goto L_020755A0; else goto L_02075534;
   L_02075534: ; // 0x2075534
@@ -11590,10 +11590,10 @@ void Gambit_fn_02075514(CPUState* cpu) {
         /* 0207554C */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0207554C */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02075550 */ cpu->r[11] = cpu->r[11] + 0xFFFFAA90u;
-        /* 02075554 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02075554 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02075558 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02075558 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0207555C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207555C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207555C */ _t10 = _t9 & 0x00000001u;
         /* 0207555C */ if (_t10) goto L_02075590; else goto L_02075560;
   L_02075560: ; // 0x2075560
@@ -11614,8 +11614,8 @@ void Gambit_fn_02075514(CPUState* cpu) {
         /* 0207558C */ Gambit_fn_02068798(cpu);
   L_02075590: ; // 0x2075590
         /* 02075590 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02075590 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02075594 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075590 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02075594 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075594 */ _t15 = _t14 & 0x00000001u;
         /* 02075594 */ if (_t15) goto L_020755A0; else goto L_02075598;
   L_02075598: ; // 0x2075598
@@ -11646,11 +11646,11 @@ void Gambit_fn_02075518(CPUState* cpu) {
         /* 02075520 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02075520 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02075524 */ cpu->r[30] = cpu->r[3];
-        /* 02075524 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02075524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02075528 */ cpu->r[31] = cpu->r[4];
         /* 0207552C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0207552C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02075530 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075530 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075530 */ _t5 = _t4 & 0x00000001u;
         /* 02075530 */ if (_t5) goto L_020755A0; else goto L_02075534;
   L_02075534: ; // 0x2075534
@@ -11664,10 +11664,10 @@ void Gambit_fn_02075518(CPUState* cpu) {
         /* 0207554C */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0207554C */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02075550 */ cpu->r[11] = cpu->r[11] + 0xFFFFAA90u;
-        /* 02075554 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02075554 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02075558 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02075558 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0207555C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207555C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207555C */ _t10 = _t9 & 0x00000001u;
         /* 0207555C */ if (_t10) goto L_02075590; else goto L_02075560;
   L_02075560: ; // 0x2075560
@@ -11688,8 +11688,8 @@ void Gambit_fn_02075518(CPUState* cpu) {
         /* 0207558C */ Gambit_fn_02068798(cpu);
   L_02075590: ; // 0x2075590
         /* 02075590 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02075590 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02075594 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075590 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02075594 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075594 */ _t15 = _t14 & 0x00000001u;
         /* 02075594 */ if (_t15) goto L_020755A0; else goto L_02075598;
   L_02075598: ; // 0x2075598
@@ -11744,15 +11744,15 @@ void Gambit_fn_020755D0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020755D0: ; // 0x20755d0
-        /* 020755D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020755D4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020755D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020755D4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020755D4 */ _t1 = _t0 & 0x00000001u;
         /* 020755D4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020755D4 */ goto L_020755D8;
   L_020755D8: ; // 0x20755d8
         /* 020755D8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020755D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020755DC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020755D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020755DC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020755DC */ _t3 = _t2 & 0x00000001u;
         /* 020755DC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020755DC */ goto L_020755E0;
@@ -11771,8 +11771,8 @@ void Gambit_fn_020755D0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -11786,15 +11786,15 @@ void Gambit_fn_020755D0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -11840,15 +11840,15 @@ void Gambit_fn_02075600(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02075600: ; // 0x2075600
-        /* 02075600 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02075604 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075600 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02075604 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075604 */ _t1 = _t0 & 0x00000001u;
         /* 02075604 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02075604 */ goto L_02075608;
   L_02075608: ; // 0x2075608
         /* 02075608 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02075608 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207560C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075608 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207560C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207560C */ _t3 = _t2 & 0x00000001u;
         /* 0207560C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207560C */ goto L_02075610;
@@ -11867,8 +11867,8 @@ void Gambit_fn_02075600(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -11882,15 +11882,15 @@ void Gambit_fn_02075600(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -11918,15 +11918,15 @@ void Gambit_fn_02075614(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02075614: ; // 0x2075614
-        /* 02075614 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02075618 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075614 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02075618 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075618 */ _t1 = _t0 & 0x00000001u;
         /* 02075618 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02075618 */ goto L_0207561C;
   L_0207561C: ; // 0x207561c
         /* 0207561C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0207561C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02075620 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207561C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02075620 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075620 */ _t3 = _t2 & 0x00000001u;
         /* 02075620 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02075620 */ goto L_02075624;
@@ -11945,8 +11945,8 @@ void Gambit_fn_02075614(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -11960,15 +11960,15 @@ void Gambit_fn_02075614(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -12074,9 +12074,9 @@ void Gambit_fn_02075668(CPUState* cpu) {
         /* 0207566C */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 0207566C */ cpu->r[9] = _t0;
         /* 02075670 */ cpu->r[12] = 0x101D0000u;
-        /* 02075674 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02075674 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02075678 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 0207567C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207567C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207567C */ _t2 = _t1 & 0x00000001u;
         /* 0207567C */ if (_t2) goto L_02075680; else goto L_02075694;
   L_02075680: ; // 0x2075680
@@ -12088,8 +12088,8 @@ void Gambit_fn_02075668(CPUState* cpu) {
         /* 02075690 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 02075690 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_02075694: ; // 0x2075694
-        /* 02075694 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02075698 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075694 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02075698 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075698 */ _t6 = _t5 & 0x00000001u;
         /* 02075698 */ if (_t6) goto L_0207569C; else goto L_020756A4;
   L_0207569C: ; // 0x207569c
@@ -12101,9 +12101,9 @@ void Gambit_fn_02075668(CPUState* cpu) {
         /* 020756A8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 020756A8 */ cpu->r[7] = _t7;
         /* 020756AC */ cpu->r[11] = 0x101D0000u;
-        /* 020756B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020756B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020756B4 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 020756B8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020756B8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020756B8 */ _t9 = _t8 & 0x00000001u;
         /* 020756B8 */ if (_t9) goto L_020756BC; else goto L_020756D0;
   L_020756BC: ; // 0x20756bc
@@ -12188,18 +12188,18 @@ void Gambit_fn_02075708(CPUState* cpu) {
         /* 0206C8A8 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0206C8A8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0206C8AC */ cpu->r[12] = 0x00000000u;
-        /* 0206C8B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0206C8B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0206C8B4 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0206C8B4 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0206C8B8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206C8B8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206C8B8 */ _t6 = _t5 & 0x00000001u;
         /* 0206C8B8 */ if (_t6) goto L_0206C8E0; else goto L_0206C8BC;
   L_0206C8BC: ; // 0x206c8bc
         /* 0206C8BC */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0206C8BC */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0206C8C0 */ /* nop */
-        /* 0206C8C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0206C8C8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206C8C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0206C8C8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206C8C8 */ _t9 = _t8 & 0x00000001u;
         /* 0206C8C8 */ if (_t9) goto L_0206C8CC; else goto L_0206C8E0;
   L_0206C8CC: ; // 0x206c8cc
@@ -12261,8 +12261,8 @@ void Gambit_fn_02075710(CPUState* cpu) {
         /* 02075754 */ Gambit_fn_026D6F40(cpu);
         /* 02075758 */ cpu->r[3] = 0x0000029Cu;
         /* 0207575C */ Gambit_fn_02801A78(cpu);
-        /* 02075760 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02075764 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075760 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02075764 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075764 */ _t9 = _t8 & 0x00000001u;
         /* 02075764 */ if (_t9) goto L_0207576C; else goto L_02075768;
   L_02075768: ; // 0x2075768
@@ -12319,8 +12319,8 @@ void Gambit_fn_02075714(CPUState* cpu) {
         /* 02075754 */ Gambit_fn_026D6F40(cpu);
         /* 02075758 */ cpu->r[3] = 0x0000029Cu;
         /* 0207575C */ Gambit_fn_02801A78(cpu);
-        /* 02075760 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02075764 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075760 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02075764 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075764 */ _t9 = _t8 & 0x00000001u;
         /* 02075764 */ if (_t9) goto L_0207576C; else goto L_02075768;
   L_02075768: ; // 0x2075768
@@ -12378,8 +12378,8 @@ void Gambit_fn_02075798(CPUState* cpu) {
         /* 02075754 */ Gambit_fn_026D6F40(cpu);
         /* 02075758 */ cpu->r[3] = 0x0000029Cu;
         /* 0207575C */ Gambit_fn_02801A78(cpu);
-        /* 02075760 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02075764 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075760 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02075764 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075764 */ _t9 = _t8 & 0x00000001u;
         /* 02075764 */ if (_t9) goto L_0207576C; else goto L_02075768;
   L_02075768: ; // 0x2075768
@@ -12511,19 +12511,19 @@ void Gambit_fn_020757E8(CPUState* cpu) {
         /* 020757EC */ cpu->r[0] = cpu->lr;
         /* 020757F0 */ /* nop */
         /* 020757F4 */ cpu->r[30] = cpu->r[3];
-        /* 020757F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020757F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020757F8 */ cpu->r[31] = cpu->r[4];
         /* 020757FC */ _t1 = cpu->r[1] + 0x0000002Cu;
         /* 020757FC */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
-        /* 02075800 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075800 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075800 */ _t3 = _t2 & 0x00000001u;
         /* 02075800 */ if (_t3) goto L_02075804; else goto L_02075814;
   L_02075804: ; // 0x2075804
         /* 02075804 */ cpu->r[3] = 0x00000068u;
         /* 02075808 */ Gambit_fn_02801A78(cpu);
         /* 0207580C */ cpu->r[30] = cpu->r[3];
-        /* 0207580C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02075810 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207580C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02075810 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075810 */ _t5 = _t4 & 0x00000001u;
         /* 02075810 */ if (_t5) goto L_02075A04; else goto L_02075814;
   L_02075814: ; // 0x2075814
@@ -12543,17 +12543,17 @@ void Gambit_fn_020757E8(CPUState* cpu) {
         /* 02075840 */ rbrew_write32(cpu->mem, _t7, cpu->r[5]);
         /* 02075844 */ cpu->r[0] = cpu->r[0] + 0xFFFFACCCu;
         /* 02075848 */ cpu->r[3] = cpu->r[30] + 0x00000028u;
-        /* 02075848 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02075848 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0207584C */ _t8 = cpu->r[30] + 0x0000000Cu;
         /* 0207584C */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
-        /* 02075850 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075850 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075850 */ _t10 = _t9 & 0x00000001u;
         /* 02075850 */ if (_t10) goto L_02075854; else goto L_02075864;
   L_02075854: ; // 0x2075854
         /* 02075854 */ cpu->r[3] = 0x00000010u;
         /* 02075858 */ Gambit_fn_02801A78(cpu);
-        /* 0207585C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02075860 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207585C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02075860 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075860 */ _t12 = _t11 & 0x00000001u;
         /* 02075860 */ if (_t12) goto L_02075888; else goto L_02075864;
   L_02075864: ; // 0x2075864
@@ -12584,46 +12584,46 @@ void Gambit_fn_020757E8(CPUState* cpu) {
         /* 0207589C */ rbrew_write32(cpu->mem, _t21, cpu->r[9]);
         /* 020758A0 */ cpu->r[11] = cpu->r[11] + 0xFFFFABB8u;
         /* 020758A4 */ cpu->r[26] = cpu->r[30] + 0x0000003Cu;
-        /* 020758A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 020758A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 020758A8 */ _t22 = cpu->r[1] + 0x00000008u;
         /* 020758A8 */ rbrew_write32(cpu->mem, _t22, cpu->r[11]);
-        /* 020758AC */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020758AC */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020758AC */ _t24 = _t23 & 0x00000001u;
         /* 020758AC */ if (_t24) goto L_020758B0; else goto L_020758C0;
   L_020758B0: ; // 0x20758b0
         /* 020758B0 */ cpu->r[3] = 0x0000002Cu;
         /* 020758B4 */ Gambit_fn_02801A78(cpu);
         /* 020758B8 */ cpu->r[26] = cpu->r[3];
-        /* 020758B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 020758BC */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020758B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 020758BC */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020758BC */ _t26 = _t25 & 0x00000001u;
         /* 020758BC */ if (_t26) goto L_02075A04; else goto L_020758C0;
   L_020758C0: ; // 0x20758c0
         /* 020758C0 */ cpu->r[27] = cpu->r[26];
-        /* 020758C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020758C4 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020758C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020758C4 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020758C4 */ _t28 = _t27 & 0x00000001u;
         /* 020758C4 */ if (_t28) goto L_020758C8; else goto L_020758D8;
   L_020758C8: ; // 0x20758c8
         /* 020758C8 */ cpu->r[3] = 0x0000002Cu;
         /* 020758CC */ Gambit_fn_02801A78(cpu);
         /* 020758D0 */ cpu->r[27] = cpu->r[3];
-        /* 020758D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020758D4 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020758D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020758D4 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020758D4 */ _t30 = _t29 & 0x00000001u;
         /* 020758D4 */ if (_t30) goto L_020759F8; else goto L_020758D8;
   L_020758D8: ; // 0x20758d8
         /* 020758D8 */ cpu->r[3] = cpu->r[27];
-        /* 020758D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 020758D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 020758DC */ cpu->r[31] = 0x10110000u;
-        /* 020758E0 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020758E0 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020758E0 */ _t32 = _t31 & 0x00000001u;
         /* 020758E0 */ if (_t32) goto L_020758E4; else goto L_02075938;
   L_020758E4: ; // 0x20758e4
         /* 020758E4 */ cpu->r[3] = 0x0000000Cu;
         /* 020758E8 */ Gambit_fn_02801A78(cpu);
-        /* 020758EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020758F0 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020758EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020758F0 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020758F0 */ _t34 = _t33 & 0x00000001u;
         /* 020758F0 */ if (_t34) goto L_020758F4; else goto L_02075938;
   L_020758F4: ; // 0x20758f4
@@ -12647,9 +12647,9 @@ void Gambit_fn_020757E8(CPUState* cpu) {
         /* 02075920 */ _t41 = cpu->r[12] + 0x00000000u;
         /* 02075920 */ cpu->r[5] = rbrew_read8(cpu->mem, _t41);
         /* 02075924 */ cpu->r[0] = 0x00080000u;
-        /* 02075928 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[31]);
+        /* 02075928 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[31]));
         /* 0207592C */ cpu->r[29] = 0x00000000u;
-        /* 02075930 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075930 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075930 */ _t43 = _t42 & 0x00000001u;
         /* 02075930 */ if (_t43) goto L_02075934; else goto L_02075998;
   L_02075934: ; // 0x2075934
@@ -12687,23 +12687,23 @@ void Gambit_fn_020757E8(CPUState* cpu) {
         /* 02075984 */ _t54 = cpu->r[12] + 0x00000000u;
         /* 02075984 */ cpu->r[5] = rbrew_read8(cpu->mem, _t54);
         /* 02075988 */ cpu->r[0] = 0x00080000u;
-        /* 0207598C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[31]);
+        /* 0207598C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[31]));
         /* 02075990 */ cpu->r[29] = 0x00000000u;
-        /* 02075994 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075994 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075994 */ _t56 = _t55 & 0x00000001u;
         /* 02075994 */ if (_t56) goto L_02075934; else goto L_02075998;
   L_02075998: ; // 0x2075998
         /* 02075998 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 0207599C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[0]);
+        /* 0207599C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[0]));
         /* 020759A0 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 020759A4 */ _t57 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020759A4 */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020759A4 */ _t58 = _t57 & 0x00000001u;
         /* 020759A4 */ if (_t58) goto L_020759B8; else goto L_020759A8;
   L_020759A8: ; // 0x20759a8
         /* 020759A8 */ _t59 = cpu->r[12] + 0x00000000u;
         /* 020759A8 */ cpu->r[6] = rbrew_read8(cpu->mem, _t59);
-        /* 020759AC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[31]);
-        /* 020759B0 */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020759AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[31]));
+        /* 020759B0 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020759B0 */ _t61 = _t60 & 0x00000001u;
         /* 020759B0 */ if (_t61) goto L_020759B4; else goto L_02075998;
   L_020759B4: ; // 0x20759b4
@@ -12713,8 +12713,8 @@ void Gambit_fn_020757E8(CPUState* cpu) {
   L_020759BC: ; // 0x20759bc
         /* 020759BC */ _t62 = cpu->r[27] + 0x00000008u;
         /* 020759BC */ cpu->r[7] = rbrew_read32(cpu->mem, _t62);
-        /* 020759C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[7]);
-        /* 020759C4 */ _t63 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020759C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[7]));
+        /* 020759C4 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020759C4 */ _t64 = _t63 & 0x00000001u;
         /* 020759C4 */ if (_t64) goto L_020759CC; else goto L_020759C8;
   L_020759C8: ; // 0x20759c8
@@ -12807,9 +12807,9 @@ void Gambit_fn_02075A48(CPUState* cpu) {
         /* 02075A74 */ cpu->r[11] = rbrew_read8(cpu->mem, _t6);
         /* 02075A78 */ _t7 = cpu->r[29] + 0x00000038u;
         /* 02075A78 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02075A7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02075A7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02075A80 */ cpu->r[5] = 0x00000001u;
-        /* 02075A84 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075A84 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075A84 */ _t9 = _t8 & 0x00000001u;
         /* 02075A84 */ if (_t9) goto L_02075AB0; else goto L_02075A88;
   L_02075A88: ; // 0x2075a88
@@ -12822,8 +12822,8 @@ void Gambit_fn_02075A48(CPUState* cpu) {
         /* 02075A9C */ _t11 = cpu->r[10] + 0x00000100u;
         /* 02075A9C */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
         /* 02075AA0 */ Gambit_fn_02075A1C(cpu);
-        /* 02075AA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02075AA8 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075AA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02075AA8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075AA8 */ _t13 = _t12 & 0x00000001u;
         /* 02075AA8 */ if (_t13) goto L_02075AD4; else goto L_02075AAC;
   L_02075AAC: ; // 0x2075aac
@@ -12839,16 +12839,16 @@ void Gambit_fn_02075A48(CPUState* cpu) {
         /* 02075AC4 */ _t16 = cpu->r[7] + 0x00000100u;
         /* 02075AC4 */ rbrew_write32(cpu->mem, _t16, cpu->r[0]);
         /* 02075AC8 */ Gambit_fn_02075A1C(cpu);
-        /* 02075ACC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02075AD0 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075ACC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02075AD0 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075AD0 */ _t18 = _t17 & 0x00000001u;
         /* 02075AD0 */ if (_t18) goto L_02075AD4; else goto L_02075AE4;
   L_02075AD4: ; // 0x2075ad4
         /* 02075AD4 */ _t19 = cpu->r[29] + 0x00000038u;
         /* 02075AD4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t19);
         /* 02075AD8 */ Gambit_fn_020BAD8C(cpu);
-        /* 02075ADC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02075AE0 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075ADC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02075AE0 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075AE0 */ _t21 = _t20 & 0x00000001u;
         /* 02075AE0 */ if (_t21) goto L_02075B00; else goto L_02075AE4;
   L_02075AE4: ; // 0x2075ae4
@@ -12864,8 +12864,8 @@ void Gambit_fn_02075A48(CPUState* cpu) {
   L_02075B00: ; // 0x2075b00
         /* 02075B00 */ cpu->r[3] = cpu->r[29];
         /* 02075B04 */ Gambit_fn_02075A30(cpu);
-        /* 02075B08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02075B0C */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075B08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02075B0C */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075B0C */ _t25 = _t24 & 0x00000001u;
         /* 02075B0C */ if (_t25) goto L_02075B10; else goto L_02075B24;
   L_02075B10: ; // 0x2075b10
@@ -12926,9 +12926,9 @@ void Gambit_fn_02075A4C(CPUState* cpu) {
         /* 02075A74 */ cpu->r[11] = rbrew_read8(cpu->mem, _t6);
         /* 02075A78 */ _t7 = cpu->r[29] + 0x00000038u;
         /* 02075A78 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02075A7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02075A7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02075A80 */ cpu->r[5] = 0x00000001u;
-        /* 02075A84 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075A84 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075A84 */ _t9 = _t8 & 0x00000001u;
         /* 02075A84 */ if (_t9) goto L_02075AB0; else goto L_02075A88;
   L_02075A88: ; // 0x2075a88
@@ -12941,8 +12941,8 @@ void Gambit_fn_02075A4C(CPUState* cpu) {
         /* 02075A9C */ _t11 = cpu->r[10] + 0x00000100u;
         /* 02075A9C */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
         /* 02075AA0 */ Gambit_fn_02075A1C(cpu);
-        /* 02075AA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02075AA8 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075AA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02075AA8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075AA8 */ _t13 = _t12 & 0x00000001u;
         /* 02075AA8 */ if (_t13) goto L_02075AD4; else goto L_02075AAC;
   L_02075AAC: ; // 0x2075aac
@@ -12958,16 +12958,16 @@ void Gambit_fn_02075A4C(CPUState* cpu) {
         /* 02075AC4 */ _t16 = cpu->r[7] + 0x00000100u;
         /* 02075AC4 */ rbrew_write32(cpu->mem, _t16, cpu->r[0]);
         /* 02075AC8 */ Gambit_fn_02075A1C(cpu);
-        /* 02075ACC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02075AD0 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075ACC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02075AD0 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075AD0 */ _t18 = _t17 & 0x00000001u;
         /* 02075AD0 */ if (_t18) goto L_02075AD4; else goto L_02075AE4;
   L_02075AD4: ; // 0x2075ad4
         /* 02075AD4 */ _t19 = cpu->r[29] + 0x00000038u;
         /* 02075AD4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t19);
         /* 02075AD8 */ Gambit_fn_020BAD8C(cpu);
-        /* 02075ADC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02075AE0 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075ADC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02075AE0 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075AE0 */ _t21 = _t20 & 0x00000001u;
         /* 02075AE0 */ if (_t21) goto L_02075B00; else goto L_02075AE4;
   L_02075AE4: ; // 0x2075ae4
@@ -12983,8 +12983,8 @@ void Gambit_fn_02075A4C(CPUState* cpu) {
   L_02075B00: ; // 0x2075b00
         /* 02075B00 */ cpu->r[3] = cpu->r[29];
         /* 02075B04 */ Gambit_fn_02075A30(cpu);
-        /* 02075B08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02075B0C */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075B08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02075B0C */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075B0C */ _t25 = _t24 & 0x00000001u;
         /* 02075B0C */ if (_t25) goto L_02075B10; else goto L_02075B24;
   L_02075B10: ; // 0x2075b10
@@ -13049,16 +13049,16 @@ void Gambit_fn_02075B58(CPUState* cpu) {
         /* 02075B98 */ _t5 = cpu->r[10] + 0x00000100u;
         /* 02075B98 */ rbrew_write32(cpu->mem, _t5, cpu->r[26]);
         /* 02075B9C */ Gambit_fn_02075A1C(cpu);
-        /* 02075BA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02075BA4 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075BA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02075BA4 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075BA4 */ _t7 = _t6 & 0x00000001u;
         /* 02075BA4 */ if (_t7) goto L_02075BA8; else goto L_02075BB8;
   L_02075BA8: ; // 0x2075ba8
         /* 02075BA8 */ _t8 = cpu->r[27] + 0x00000038u;
         /* 02075BA8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t8);
         /* 02075BAC */ Gambit_fn_020BAD8C(cpu);
-        /* 02075BB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02075BB4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075BB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02075BB4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075BB4 */ _t10 = _t9 & 0x00000001u;
         /* 02075BB4 */ if (_t10) goto L_02075BF0; else goto L_02075BB8;
   L_02075BB8: ; // 0x2075bb8
@@ -13084,8 +13084,8 @@ void Gambit_fn_02075B58(CPUState* cpu) {
   L_02075BF0: ; // 0x2075bf0
         /* 02075BF0 */ cpu->r[3] = cpu->r[27];
         /* 02075BF4 */ Gambit_fn_02075A30(cpu);
-        /* 02075BF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02075BFC */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075BF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02075BFC */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075BFC */ _t17 = _t16 & 0x00000001u;
         /* 02075BFC */ if (_t17) goto L_02075C00; else goto L_02075C14;
   L_02075C00: ; // 0x2075c00
@@ -13199,9 +13199,9 @@ void Gambit_fn_02075C5C(CPUState* cpu) {
   L_02075D20: ; // 0x2075d20
         /* 02075D20 */ _t15 = cpu->r[26] + 0xFFFFE378u;
         /* 02075D20 */ cpu->r[11] = rbrew_read32(cpu->mem, _t15);
-        /* 02075D24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02075D24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02075D28 */ cpu->r[15] = cpu->r[31];
-        /* 02075D2C */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075D2C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075D2C */ _t17 = _t16 & 0x00000001u;
         /* 02075D2C */ if (_t17) goto L_02075D30; else goto L_02075D44;
   L_02075D30: ; // 0x2075d30
@@ -13214,8 +13214,8 @@ void Gambit_fn_02075C5C(CPUState* cpu) {
   L_02075D44: ; // 0x2075d44
         /* 02075D44 */ _t19 = cpu->r[25] + 0xFFFFE374u;
         /* 02075D44 */ cpu->r[7] = rbrew_read32(cpu->mem, _t19);
-        /* 02075D48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 02075D4C */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075D48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 02075D4C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075D4C */ _t21 = _t20 & 0x00000001u;
         /* 02075D4C */ if (_t21) goto L_02075D50; else goto L_02075D58;
   L_02075D50: ; // 0x2075d50
@@ -13224,8 +13224,8 @@ void Gambit_fn_02075C5C(CPUState* cpu) {
         /* 02075D54 */ _t23 = cpu->r[25] + 0xFFFFE374u;
         /* 02075D54 */ rbrew_write32(cpu->mem, _t23, cpu->r[29]);
   L_02075D58: ; // 0x2075d58
-        /* 02075D58 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[15], 0x00000007u);
-        /* 02075D5C */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02075D58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[15], 0x00000007u));
+        /* 02075D5C */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02075D5C */ _t25 = _t24 & 0x00000001u;
         /* 02075D5C */ if (_t25) goto L_02075DFC; else goto L_02075D60;
   L_02075D60: ; // 0x2075d60
@@ -13235,7 +13235,7 @@ void Gambit_fn_02075C5C(CPUState* cpu) {
         /* 02075D68 */ cpu->r[3] = cpu->r[1] + 0x000000E8u;
         /* 02075D6C */ cpu->r[5] = cpu->r[17];
         /* 02075D70 */ cpu->r[6] = cpu->r[30];
-        /* 02075D74 */ _t27 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02075D74 */ _t27 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02075D74 */ _t28 = _t27 & 0x00000001u;
         /* 02075D74 */ if (_t28) goto L_02075D78; // else: addr-0 trap, fall-through
   L_02075D78: ; // 0x2075d78
@@ -13291,8 +13291,8 @@ void Gambit_fn_02075C5C(CPUState* cpu) {
         /* 02075DE8 */ Gambit_fn_027FD390(cpu);
         /* 02075DEC */ _t50 = cpu->r[1] + 0x00000034u;
         /* 02075DEC */ cpu->r[0] = rbrew_read8(cpu->mem, _t50);
-        /* 02075DF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02075DF4 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075DF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02075DF4 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075DF4 */ _t52 = _t51 & 0x00000001u;
         /* 02075DF4 */ if (_t52) goto L_02075EDC; else goto L_02075DF8;
   L_02075DF8: ; // 0x2075df8
@@ -13300,8 +13300,8 @@ void Gambit_fn_02075C5C(CPUState* cpu) {
   L_02075DFC: ; // 0x2075dfc
         /* 02075DFC */ _t53 = cpu->r[22] + 0xFFFFEE14u;
         /* 02075DFC */ cpu->r[4] = rbrew_read32(cpu->mem, _t53);
-        /* 02075E00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 02075E04 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075E00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 02075E04 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075E04 */ _t55 = _t54 & 0x00000001u;
         /* 02075E04 */ if (_t55) goto L_02075E08; else goto L_02075E40;
   L_02075E08: ; // 0x2075e08
@@ -13310,8 +13310,8 @@ void Gambit_fn_02075C5C(CPUState* cpu) {
         /* 02075E10 */ Gambit_fn_02836FFC(cpu);
         /* 02075E14 */ _t56 = cpu->r[22] + 0xFFFFEE14u;
         /* 02075E14 */ cpu->r[0] = rbrew_read32(cpu->mem, _t56);
-        /* 02075E18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02075E1C */ _t57 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075E18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02075E1C */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075E1C */ _t58 = _t57 & 0x00000001u;
         /* 02075E1C */ if (_t58) goto L_02075E20; else goto L_02075E34;
   L_02075E20: ; // 0x2075e20
@@ -13335,7 +13335,7 @@ void Gambit_fn_02075C5C(CPUState* cpu) {
         /* 02075E4C */ cpu->r[4] = rbrew_read32(cpu->mem, _t62);
         /* 02075E50 */ cpu->r[5] = cpu->r[17];
         /* 02075E54 */ cpu->r[6] = cpu->r[30];
-        /* 02075E58 */ _t63 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02075E58 */ _t63 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02075E58 */ _t64 = _t63 & 0x00000001u;
         /* 02075E58 */ if (_t64) goto L_02075E5C; // else: addr-0 trap, fall-through
   L_02075E5C: ; // 0x2075e5c
@@ -13391,16 +13391,16 @@ void Gambit_fn_02075C5C(CPUState* cpu) {
         /* 02075ECC */ Gambit_fn_027FD390(cpu);
         /* 02075ED0 */ _t86 = cpu->r[1] + 0x00000034u;
         /* 02075ED0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t86);
-        /* 02075ED4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02075ED8 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075ED4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02075ED8 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075ED8 */ _t88 = _t87 & 0x00000001u;
         /* 02075ED8 */ if (_t88) goto L_02075EDC; else goto L_02076024;
   L_02075EDC: ; // 0x2075edc
         /* 02075EDC */ _t89 = cpu->r[26] + 0xFFFFE378u;
         /* 02075EDC */ cpu->r[0] = rbrew_read32(cpu->mem, _t89);
-        /* 02075EE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02075EE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02075EE4 */ cpu->r[16] = cpu->r[31];
-        /* 02075EE8 */ _t90 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075EE8 */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075EE8 */ _t91 = _t90 & 0x00000001u;
         /* 02075EE8 */ if (_t91) goto L_02075EEC; else goto L_02075F00;
   L_02075EEC: ; // 0x2075eec
@@ -13413,8 +13413,8 @@ void Gambit_fn_02075C5C(CPUState* cpu) {
   L_02075F00: ; // 0x2075f00
         /* 02075F00 */ _t93 = cpu->r[25] + 0xFFFFE374u;
         /* 02075F00 */ cpu->r[4] = rbrew_read32(cpu->mem, _t93);
-        /* 02075F04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 02075F08 */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075F04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 02075F08 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075F08 */ _t95 = _t94 & 0x00000001u;
         /* 02075F08 */ if (_t95) goto L_02075F0C; else goto L_02075F14;
   L_02075F0C: ; // 0x2075f0c
@@ -13423,8 +13423,8 @@ void Gambit_fn_02075C5C(CPUState* cpu) {
         /* 02075F10 */ _t97 = cpu->r[25] + 0xFFFFE374u;
         /* 02075F10 */ rbrew_write32(cpu->mem, _t97, cpu->r[29]);
   L_02075F14: ; // 0x2075f14
-        /* 02075F14 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[16], 0x00000007u);
-        /* 02075F18 */ _t98 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02075F14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[16], 0x00000007u));
+        /* 02075F18 */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02075F18 */ _t99 = _t98 & 0x00000001u;
         /* 02075F18 */ if (_t99) goto L_02075F68; else goto L_02075F1C;
   L_02075F1C: ; // 0x2075f1c
@@ -13434,7 +13434,7 @@ void Gambit_fn_02075C5C(CPUState* cpu) {
         /* 02075F28 */ cpu->r[5] = cpu->r[17];
         /* 02075F2C */ cpu->r[3] = cpu->r[1] + 0x000000E8u;
         /* 02075F30 */ cpu->r[7] = 0x00000000u;
-        /* 02075F34 */ _t100 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02075F34 */ _t100 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02075F34 */ _t101 = _t100 & 0x00000001u;
         /* 02075F34 */ if (_t101) goto L_02075F38; // else: addr-0 trap, fall-through
   L_02075F38: ; // 0x2075f38
@@ -13450,8 +13450,8 @@ void Gambit_fn_02075C5C(CPUState* cpu) {
         /* 02075F54 */ Gambit_fn_027FD390(cpu);
         /* 02075F58 */ _t104 = cpu->r[1] + 0x00000034u;
         /* 02075F58 */ cpu->r[0] = rbrew_read8(cpu->mem, _t104);
-        /* 02075F5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02075F60 */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075F5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02075F60 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075F60 */ _t106 = _t105 & 0x00000001u;
         /* 02075F60 */ if (_t106) goto L_02075FF8; else goto L_02075F64;
   L_02075F64: ; // 0x2075f64
@@ -13459,8 +13459,8 @@ void Gambit_fn_02075C5C(CPUState* cpu) {
   L_02075F68: ; // 0x2075f68
         /* 02075F68 */ _t107 = cpu->r[22] + 0xFFFFEE14u;
         /* 02075F68 */ cpu->r[4] = rbrew_read32(cpu->mem, _t107);
-        /* 02075F6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 02075F70 */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075F6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 02075F70 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075F70 */ _t109 = _t108 & 0x00000001u;
         /* 02075F70 */ if (_t109) goto L_02075F74; else goto L_02075FAC;
   L_02075F74: ; // 0x2075f74
@@ -13469,8 +13469,8 @@ void Gambit_fn_02075C5C(CPUState* cpu) {
         /* 02075F7C */ Gambit_fn_02836FFC(cpu);
         /* 02075F80 */ _t110 = cpu->r[22] + 0xFFFFEE14u;
         /* 02075F80 */ cpu->r[0] = rbrew_read32(cpu->mem, _t110);
-        /* 02075F84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02075F88 */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075F84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02075F88 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075F88 */ _t112 = _t111 & 0x00000001u;
         /* 02075F88 */ if (_t112) goto L_02075F8C; else goto L_02075FA0;
   L_02075F8C: ; // 0x2075f8c
@@ -13494,7 +13494,7 @@ void Gambit_fn_02075C5C(CPUState* cpu) {
         /* 02075FBC */ cpu->r[6] = cpu->r[30];
         /* 02075FC0 */ cpu->r[4] = cpu->r[4] + 0xFFFFABFCu;
         /* 02075FC4 */ cpu->r[3] = cpu->r[1] + 0x000000E8u;
-        /* 02075FC8 */ _t116 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02075FC8 */ _t116 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02075FC8 */ _t117 = _t116 & 0x00000001u;
         /* 02075FC8 */ if (_t117) goto L_02075FCC; // else: addr-0 trap, fall-through
   L_02075FCC: ; // 0x2075fcc
@@ -13510,30 +13510,30 @@ void Gambit_fn_02075C5C(CPUState* cpu) {
         /* 02075FE8 */ Gambit_fn_027FD390(cpu);
         /* 02075FEC */ _t120 = cpu->r[1] + 0x00000034u;
         /* 02075FEC */ cpu->r[0] = rbrew_read8(cpu->mem, _t120);
-        /* 02075FF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02075FF4 */ _t121 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02075FF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02075FF4 */ _t121 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02075FF4 */ _t122 = _t121 & 0x00000001u;
         /* 02075FF4 */ if (_t122) goto L_02075FF8; else goto L_02076024;
   L_02075FF8: ; // 0x2075ff8
         /* 02075FF8 */ _t123 = cpu->r[1] + 0x00000020u;
         /* 02075FF8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t123);
         /* 02075FFC */ cpu->r[6] = cpu->r[8] + 0xFFFFFFFFu;
-        /* 02075FFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02075FFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 02076000 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
         /* 02076004 */ _t124 = cpu->r[1] + 0x00000020u;
         /* 02076004 */ rbrew_write32(cpu->mem, _t124, cpu->r[6]);
-        /* 02076008 */ _t125 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076008 */ _t125 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076008 */ _t126 = _t125 & 0x00000001u;
         /* 02076008 */ if (_t126) goto L_0207600C; else goto L_02075D20;
   L_0207600C: ; // 0x207600c
         /* 0207600C */ _t127 = cpu->r[1] + 0x0000001Cu;
         /* 0207600C */ cpu->r[5] = rbrew_read32(cpu->mem, _t127);
         /* 02076010 */ cpu->r[0] = cpu->r[5] + 0xFFFFFFFFu;
-        /* 02076010 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02076010 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02076014 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
         /* 02076018 */ _t128 = cpu->r[1] + 0x0000001Cu;
         /* 02076018 */ rbrew_write32(cpu->mem, _t128, cpu->r[0]);
-        /* 0207601C */ _t129 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207601C */ _t129 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207601C */ _t130 = _t129 & 0x00000001u;
         /* 0207601C */ if (_t130) goto L_02076020; else goto L_02075D00;
   L_02076020: ; // 0x2076020
@@ -13547,11 +13547,11 @@ void Gambit_fn_02075C5C(CPUState* cpu) {
         /* 02076030 */ _t133 = cpu->r[1] + 0x0000001Cu;
         /* 02076030 */ cpu->r[5] = rbrew_read32(cpu->mem, _t133);
         /* 02076034 */ cpu->r[0] = cpu->r[5] + 0xFFFFFFFFu;
-        /* 02076034 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02076034 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02076038 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
         /* 0207603C */ _t134 = cpu->r[1] + 0x0000001Cu;
         /* 0207603C */ rbrew_write32(cpu->mem, _t134, cpu->r[0]);
-        /* 02076040 */ _t135 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076040 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076040 */ _t136 = _t135 & 0x00000001u;
         /* 02076040 */ if (_t136) goto L_02076044; else goto L_02075D00;
   L_02076044: ; // 0x2076044
@@ -13635,9 +13635,9 @@ void Gambit_fn_0207605C(CPUState* cpu) {
   L_02076114: ; // 0x2076114
         /* 02076114 */ _t14 = cpu->r[27] + 0xFFFFE378u;
         /* 02076114 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
-        /* 02076118 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02076118 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0207611C */ cpu->r[16] = cpu->r[31];
-        /* 02076120 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076120 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076120 */ _t16 = _t15 & 0x00000001u;
         /* 02076120 */ if (_t16) goto L_02076124; else goto L_02076138;
   L_02076124: ; // 0x2076124
@@ -13650,8 +13650,8 @@ void Gambit_fn_0207605C(CPUState* cpu) {
   L_02076138: ; // 0x2076138
         /* 02076138 */ _t18 = cpu->r[26] + 0xFFFFE374u;
         /* 02076138 */ cpu->r[0] = rbrew_read32(cpu->mem, _t18);
-        /* 0207613C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02076140 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207613C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02076140 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076140 */ _t20 = _t19 & 0x00000001u;
         /* 02076140 */ if (_t20) goto L_02076144; else goto L_0207614C;
   L_02076144: ; // 0x2076144
@@ -13660,8 +13660,8 @@ void Gambit_fn_0207605C(CPUState* cpu) {
         /* 02076148 */ _t22 = cpu->r[26] + 0xFFFFE374u;
         /* 02076148 */ rbrew_write32(cpu->mem, _t22, cpu->r[30]);
   L_0207614C: ; // 0x207614c
-        /* 0207614C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[16], 0x00000007u);
-        /* 02076150 */ _t23 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207614C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[16], 0x00000007u));
+        /* 02076150 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02076150 */ _t24 = _t23 & 0x00000001u;
         /* 02076150 */ if (_t24) goto L_020761EC; else goto L_02076154;
   L_02076154: ; // 0x2076154
@@ -13669,7 +13669,7 @@ void Gambit_fn_0207605C(CPUState* cpu) {
         /* 02076158 */ cpu->r[4] = cpu->r[14] + 0xFFFFAC2Cu;
         /* 0207615C */ cpu->r[3] = cpu->r[1] + 0x000000E4u;
         /* 02076160 */ cpu->r[6] = 0x00000000u;
-        /* 02076164 */ _t25 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02076164 */ _t25 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02076164 */ _t26 = _t25 & 0x00000001u;
         /* 02076164 */ if (_t26) goto L_02076168; // else: addr-0 trap, fall-through
   L_02076168: ; // 0x2076168
@@ -13725,8 +13725,8 @@ void Gambit_fn_0207605C(CPUState* cpu) {
         /* 020761D8 */ Gambit_fn_027FD390(cpu);
         /* 020761DC */ _t48 = cpu->r[1] + 0x00000030u;
         /* 020761DC */ cpu->r[0] = rbrew_read8(cpu->mem, _t48);
-        /* 020761E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020761E4 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020761E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020761E4 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020761E4 */ _t50 = _t49 & 0x00000001u;
         /* 020761E4 */ if (_t50) goto L_020762C8; else goto L_020761E8;
   L_020761E8: ; // 0x20761e8
@@ -13734,8 +13734,8 @@ void Gambit_fn_0207605C(CPUState* cpu) {
   L_020761EC: ; // 0x20761ec
         /* 020761EC */ _t51 = cpu->r[23] + 0xFFFFEE14u;
         /* 020761EC */ cpu->r[0] = rbrew_read32(cpu->mem, _t51);
-        /* 020761F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020761F4 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020761F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020761F4 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020761F4 */ _t53 = _t52 & 0x00000001u;
         /* 020761F4 */ if (_t53) goto L_020761F8; else goto L_02076230;
   L_020761F8: ; // 0x20761f8
@@ -13744,8 +13744,8 @@ void Gambit_fn_0207605C(CPUState* cpu) {
         /* 02076200 */ Gambit_fn_02836FFC(cpu);
         /* 02076204 */ _t54 = cpu->r[23] + 0xFFFFEE14u;
         /* 02076204 */ cpu->r[6] = rbrew_read32(cpu->mem, _t54);
-        /* 02076208 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0207620C */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0207620C */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207620C */ _t56 = _t55 & 0x00000001u;
         /* 0207620C */ if (_t56) goto L_02076210; else goto L_02076224;
   L_02076210: ; // 0x2076210
@@ -13767,7 +13767,7 @@ void Gambit_fn_0207605C(CPUState* cpu) {
         /* 02076238 */ cpu->r[6] = rbrew_read32(cpu->mem, _t59);
         /* 0207623C */ cpu->r[4] = cpu->r[14] + 0xFFFFAC2Cu;
         /* 02076240 */ cpu->r[5] = cpu->r[21];
-        /* 02076244 */ _t60 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02076244 */ _t60 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02076244 */ _t61 = _t60 & 0x00000001u;
         /* 02076244 */ if (_t61) goto L_02076248; // else: addr-0 trap, fall-through
   L_02076248: ; // 0x2076248
@@ -13823,16 +13823,16 @@ void Gambit_fn_0207605C(CPUState* cpu) {
         /* 020762B8 */ Gambit_fn_027FD390(cpu);
         /* 020762BC */ _t83 = cpu->r[1] + 0x00000030u;
         /* 020762BC */ cpu->r[0] = rbrew_read8(cpu->mem, _t83);
-        /* 020762C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020762C4 */ _t84 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020762C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020762C4 */ _t84 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020762C4 */ _t85 = _t84 & 0x00000001u;
         /* 020762C4 */ if (_t85) goto L_020762C8; else goto L_02076408;
   L_020762C8: ; // 0x20762c8
         /* 020762C8 */ _t86 = cpu->r[27] + 0xFFFFE378u;
         /* 020762C8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t86);
-        /* 020762CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020762CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020762D0 */ cpu->r[16] = cpu->r[31];
-        /* 020762D4 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020762D4 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020762D4 */ _t88 = _t87 & 0x00000001u;
         /* 020762D4 */ if (_t88) goto L_020762D8; else goto L_020762EC;
   L_020762D8: ; // 0x20762d8
@@ -13845,8 +13845,8 @@ void Gambit_fn_0207605C(CPUState* cpu) {
   L_020762EC: ; // 0x20762ec
         /* 020762EC */ _t90 = cpu->r[26] + 0xFFFFE374u;
         /* 020762EC */ cpu->r[10] = rbrew_read32(cpu->mem, _t90);
-        /* 020762F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020762F4 */ _t91 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020762F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020762F4 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020762F4 */ _t92 = _t91 & 0x00000001u;
         /* 020762F4 */ if (_t92) goto L_020762F8; else goto L_02076300;
   L_020762F8: ; // 0x20762f8
@@ -13855,8 +13855,8 @@ void Gambit_fn_0207605C(CPUState* cpu) {
         /* 020762FC */ _t94 = cpu->r[26] + 0xFFFFE374u;
         /* 020762FC */ rbrew_write32(cpu->mem, _t94, cpu->r[30]);
   L_02076300: ; // 0x2076300
-        /* 02076300 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[16], 0x00000007u);
-        /* 02076304 */ _t95 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02076300 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[16], 0x00000007u));
+        /* 02076304 */ _t95 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02076304 */ _t96 = _t95 & 0x00000001u;
         /* 02076304 */ if (_t96) goto L_02076350; else goto L_02076308;
   L_02076308: ; // 0x2076308
@@ -13865,7 +13865,7 @@ void Gambit_fn_0207605C(CPUState* cpu) {
         /* 02076310 */ cpu->r[4] = cpu->r[4] + 0xFFFFAC14u;
         /* 02076314 */ cpu->r[3] = cpu->r[1] + 0x000000E4u;
         /* 02076318 */ cpu->r[6] = 0x00000000u;
-        /* 0207631C */ _t97 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0207631C */ _t97 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0207631C */ _t98 = _t97 & 0x00000001u;
         /* 0207631C */ if (_t98) goto L_02076320; // else: addr-0 trap, fall-through
   L_02076320: ; // 0x2076320
@@ -13881,8 +13881,8 @@ void Gambit_fn_0207605C(CPUState* cpu) {
         /* 0207633C */ Gambit_fn_027FD390(cpu);
         /* 02076340 */ _t101 = cpu->r[1] + 0x00000030u;
         /* 02076340 */ cpu->r[0] = rbrew_read8(cpu->mem, _t101);
-        /* 02076344 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02076348 */ _t102 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076344 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02076348 */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076348 */ _t103 = _t102 & 0x00000001u;
         /* 02076348 */ if (_t103) goto L_020763DC; else goto L_0207634C;
   L_0207634C: ; // 0x207634c
@@ -13890,8 +13890,8 @@ void Gambit_fn_0207605C(CPUState* cpu) {
   L_02076350: ; // 0x2076350
         /* 02076350 */ _t104 = cpu->r[23] + 0xFFFFEE14u;
         /* 02076350 */ cpu->r[0] = rbrew_read32(cpu->mem, _t104);
-        /* 02076354 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02076358 */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076354 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02076358 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076358 */ _t106 = _t105 & 0x00000001u;
         /* 02076358 */ if (_t106) goto L_0207635C; else goto L_02076394;
   L_0207635C: ; // 0x207635c
@@ -13900,8 +13900,8 @@ void Gambit_fn_0207605C(CPUState* cpu) {
         /* 02076364 */ Gambit_fn_02836FFC(cpu);
         /* 02076368 */ _t107 = cpu->r[23] + 0xFFFFEE14u;
         /* 02076368 */ cpu->r[10] = rbrew_read32(cpu->mem, _t107);
-        /* 0207636C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02076370 */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207636C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02076370 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076370 */ _t109 = _t108 & 0x00000001u;
         /* 02076370 */ if (_t109) goto L_02076374; else goto L_02076388;
   L_02076374: ; // 0x2076374
@@ -13924,7 +13924,7 @@ void Gambit_fn_0207605C(CPUState* cpu) {
         /* 020763A0 */ cpu->r[6] = rbrew_read32(cpu->mem, _t112);
         /* 020763A4 */ cpu->r[5] = cpu->r[21];
         /* 020763A8 */ cpu->r[4] = cpu->r[4] + 0xFFFFAC14u;
-        /* 020763AC */ _t113 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020763AC */ _t113 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020763AC */ _t114 = _t113 & 0x00000001u;
         /* 020763AC */ if (_t114) goto L_020763B0; // else: addr-0 trap, fall-through
   L_020763B0: ; // 0x20763b0
@@ -13940,30 +13940,30 @@ void Gambit_fn_0207605C(CPUState* cpu) {
         /* 020763CC */ Gambit_fn_027FD390(cpu);
         /* 020763D0 */ _t117 = cpu->r[1] + 0x00000030u;
         /* 020763D0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t117);
-        /* 020763D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020763D8 */ _t118 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020763D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020763D8 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020763D8 */ _t119 = _t118 & 0x00000001u;
         /* 020763D8 */ if (_t119) goto L_020763DC; else goto L_02076408;
   L_020763DC: ; // 0x20763dc
         /* 020763DC */ _t120 = cpu->r[1] + 0x0000001Cu;
         /* 020763DC */ cpu->r[4] = rbrew_read32(cpu->mem, _t120);
         /* 020763E0 */ cpu->r[0] = cpu->r[4] + 0xFFFFFFFFu;
-        /* 020763E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020763E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020763E4 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
         /* 020763E8 */ _t121 = cpu->r[1] + 0x0000001Cu;
         /* 020763E8 */ rbrew_write32(cpu->mem, _t121, cpu->r[0]);
-        /* 020763EC */ _t122 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020763EC */ _t122 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020763EC */ _t123 = _t122 & 0x00000001u;
         /* 020763EC */ if (_t123) goto L_020763F0; else goto L_02076114;
   L_020763F0: ; // 0x20763f0
         /* 020763F0 */ _t124 = cpu->r[1] + 0x00000018u;
         /* 020763F0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t124);
         /* 020763F4 */ cpu->r[0] = cpu->r[11] + 0xFFFFFFFFu;
-        /* 020763F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020763F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020763F8 */ cpu->r[21] = cpu->r[21] + 0x00000001u;
         /* 020763FC */ _t125 = cpu->r[1] + 0x00000018u;
         /* 020763FC */ rbrew_write32(cpu->mem, _t125, cpu->r[0]);
-        /* 02076400 */ _t126 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076400 */ _t126 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076400 */ _t127 = _t126 & 0x00000001u;
         /* 02076400 */ if (_t127) goto L_02076404; else goto L_020760F4;
   L_02076404: ; // 0x2076404
@@ -13977,11 +13977,11 @@ void Gambit_fn_0207605C(CPUState* cpu) {
         /* 02076414 */ _t130 = cpu->r[1] + 0x00000018u;
         /* 02076414 */ cpu->r[11] = rbrew_read32(cpu->mem, _t130);
         /* 02076418 */ cpu->r[0] = cpu->r[11] + 0xFFFFFFFFu;
-        /* 02076418 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02076418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0207641C */ cpu->r[21] = cpu->r[21] + 0x00000001u;
         /* 02076420 */ _t131 = cpu->r[1] + 0x00000018u;
         /* 02076420 */ rbrew_write32(cpu->mem, _t131, cpu->r[0]);
-        /* 02076424 */ _t132 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076424 */ _t132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076424 */ _t133 = _t132 & 0x00000001u;
         /* 02076424 */ if (_t133) goto L_02076428; else goto L_020760F4;
   L_02076428: ; // 0x2076428
@@ -14012,11 +14012,11 @@ void Gambit_fn_02076440(CPUState* cpu) {
         /* 02076454 */ Gambit_fn_02075A1C(cpu);
         /* 02076458 */ _t3 = cpu->r[31] + 0x00000038u;
         /* 02076458 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0207645C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0207645C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02076460 */ _t4 = cpu->r[11] + 0x00000000u;
         /* 02076460 */ cpu->r[12] = rbrew_read32(cpu->mem, _t4);
         /* 02076464 */ cpu->r[3] = cpu->r[11];
-        /* 02076468 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076468 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076468 */ _t6 = _t5 & 0x00000001u;
         /* 02076468 */ if (_t6) goto L_0207648C; else goto L_0207646C;
   L_0207646C: ; // 0x207646c
@@ -14061,11 +14061,11 @@ void Gambit_fn_02076444(CPUState* cpu) {
         /* 02076454 */ Gambit_fn_02075A1C(cpu);
         /* 02076458 */ _t3 = cpu->r[31] + 0x00000038u;
         /* 02076458 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0207645C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0207645C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02076460 */ _t4 = cpu->r[11] + 0x00000000u;
         /* 02076460 */ cpu->r[12] = rbrew_read32(cpu->mem, _t4);
         /* 02076464 */ cpu->r[3] = cpu->r[11];
-        /* 02076468 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076468 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076468 */ _t6 = _t5 & 0x00000001u;
         /* 02076468 */ if (_t6) goto L_0207648C; else goto L_0207646C;
   L_0207646C: ; // 0x207646c
@@ -14140,23 +14140,23 @@ void Gambit_fn_020764C0(CPUState* cpu) {
         /* 020764FC */ _t7 = cpu->r[9] + 0x00000000u;
         /* 020764FC */ cpu->r[5] = rbrew_read8(cpu->mem, _t7);
         /* 02076500 */ cpu->r[30] = 0x00000000u;
-        /* 02076504 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[31]);
+        /* 02076504 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[31]));
         /* 02076508 */ cpu->r[0] = 0x00080000u;
-        /* 0207650C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207650C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207650C */ _t9 = _t8 & 0x00000001u;
         /* 0207650C */ if (_t9) goto L_02076534; else goto L_02076510;
   L_02076510: ; // 0x2076510
         /* 02076510 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02076514 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 02076514 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 02076518 */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 0207651C */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207651C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207651C */ _t11 = _t10 & 0x00000001u;
         /* 0207651C */ if (_t11) goto L_02076530; else goto L_02076520;
   L_02076520: ; // 0x2076520
         /* 02076520 */ _t12 = cpu->r[9] + 0x00000000u;
         /* 02076520 */ cpu->r[6] = rbrew_read8(cpu->mem, _t12);
-        /* 02076524 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[31]);
-        /* 02076528 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[31]));
+        /* 02076528 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076528 */ _t14 = _t13 & 0x00000001u;
         /* 02076528 */ if (_t14) goto L_0207652C; else goto L_02076510;
   L_0207652C: ; // 0x207652c
@@ -14168,10 +14168,10 @@ void Gambit_fn_020764C0(CPUState* cpu) {
         /* 02076534 */ cpu->r[11] = rbrew_read32(cpu->mem, _t15);
         /* 02076538 */ _t16 = cpu->r[29] + 0x00000004u;
         /* 02076538 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
-        /* 0207653C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[11]);
+        /* 0207653C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[11]));
         /* 02076540 */ _t17 = cpu->r[7] + 0x00000014u;
         /* 02076540 */ cpu->r[8] = rbrew_read32(cpu->mem, _t17);
-        /* 02076544 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02076544 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02076544 */ _t19 = _t18 & 0x00000001u;
         /* 02076544 */ if (_t19) goto L_0207654C; else goto L_02076548;
   L_02076548: ; // 0x2076548
@@ -14204,18 +14204,18 @@ void Gambit_fn_02076584(CPUState* cpu) {
         /* 02076584 */ cpu->r[0] = cpu->lr;
         /* 02076588 */ _t0 = cpu->r[1] + 0x00000004u;
         /* 02076588 */ rbrew_write32(cpu->mem, _t0, cpu->r[0]);
-        /* 0207658C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0207658C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02076590 */ _t1 = cpu->r[1] + 0xFFFFFFF8u;
         /* 02076590 */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 02076590 */ cpu->r[1] = _t1;
-        /* 02076594 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076594 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076594 */ _t3 = _t2 & 0x00000001u;
         /* 02076594 */ if (_t3) goto L_02076598; else goto L_020765A8;
   L_02076598: ; // 0x2076598
         /* 02076598 */ cpu->r[3] = 0x00000010u;
         /* 0207659C */ Gambit_fn_02801A78(cpu);
-        /* 020765A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020765A4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020765A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020765A4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020765A4 */ _t5 = _t4 & 0x00000001u;
         /* 020765A4 */ if (_t5) goto L_020765D4; else goto L_020765A8;
   L_020765A8: ; // 0x20765a8
@@ -14256,14 +14256,14 @@ void Gambit_fn_02076590(CPUState* cpu) {
         /* 02076590 */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 02076590 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 02076590 */ cpu->r[1] = _t0;
-        /* 02076594 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076594 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076594 */ _t2 = _t1 & 0x00000001u;
         /* 02076594 */ if (_t2) goto L_02076598; else goto L_020765A8;
   L_02076598: ; // 0x2076598
         /* 02076598 */ cpu->r[3] = 0x00000010u;
         /* 0207659C */ Gambit_fn_02801A78(cpu);
-        /* 020765A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020765A4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020765A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020765A4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020765A4 */ _t4 = _t3 & 0x00000001u;
         /* 020765A4 */ if (_t4) goto L_020765D4; else goto L_020765A8;
   L_020765A8: ; // 0x20765a8
@@ -14301,15 +14301,15 @@ void Gambit_fn_020765E4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020765E4: ; // 0x20765e4
-        /* 020765E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020765E8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020765E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020765E8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020765E8 */ _t1 = _t0 & 0x00000001u;
         /* 020765E8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020765E8 */ goto L_020765EC;
   L_020765EC: ; // 0x20765ec
         /* 020765EC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020765EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020765F0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020765EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020765F0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020765F0 */ _t3 = _t2 & 0x00000001u;
         /* 020765F0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020765F0 */ goto L_020765F4;
@@ -14328,8 +14328,8 @@ void Gambit_fn_020765E4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -14343,15 +14343,15 @@ void Gambit_fn_020765E4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -14379,15 +14379,15 @@ void Gambit_fn_020765F8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020765F8: ; // 0x20765f8
-        /* 020765F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020765FC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020765F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020765FC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020765FC */ _t1 = _t0 & 0x00000001u;
         /* 020765FC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020765FC */ goto L_02076600;
   L_02076600: ; // 0x2076600
         /* 02076600 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02076600 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02076604 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076600 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02076604 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076604 */ _t3 = _t2 & 0x00000001u;
         /* 02076604 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02076604 */ goto L_02076608;
@@ -14406,8 +14406,8 @@ void Gambit_fn_020765F8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -14421,15 +14421,15 @@ void Gambit_fn_020765F8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -14540,15 +14540,15 @@ void Gambit_fn_0207664C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0207664C: ; // 0x207664c
-        /* 0207664C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02076650 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207664C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02076650 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076650 */ _t1 = _t0 & 0x00000001u;
         /* 02076650 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02076650 */ goto L_02076654;
   L_02076654: ; // 0x2076654
         /* 02076654 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02076654 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02076658 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076654 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02076658 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076658 */ _t3 = _t2 & 0x00000001u;
         /* 02076658 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02076658 */ goto L_0207665C;
@@ -14567,8 +14567,8 @@ void Gambit_fn_0207664C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -14582,15 +14582,15 @@ void Gambit_fn_0207664C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -14636,15 +14636,15 @@ void Gambit_fn_0207667C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0207667C: ; // 0x207667c
-        /* 0207667C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02076680 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207667C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02076680 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076680 */ _t1 = _t0 & 0x00000001u;
         /* 02076680 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02076680 */ goto L_02076684;
   L_02076684: ; // 0x2076684
         /* 02076684 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02076684 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02076688 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076684 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02076688 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076688 */ _t3 = _t2 & 0x00000001u;
         /* 02076688 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02076688 */ goto L_0207668C;
@@ -14663,8 +14663,8 @@ void Gambit_fn_0207667C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -14678,15 +14678,15 @@ void Gambit_fn_0207667C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -14714,15 +14714,15 @@ void Gambit_fn_02076690(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02076690: ; // 0x2076690
-        /* 02076690 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02076694 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076690 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02076694 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076694 */ _t1 = _t0 & 0x00000001u;
         /* 02076694 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02076694 */ goto L_02076698;
   L_02076698: ; // 0x2076698
         /* 02076698 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02076698 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207669C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076698 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207669C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207669C */ _t3 = _t2 & 0x00000001u;
         /* 0207669C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207669C */ goto L_020766A0;
@@ -14741,8 +14741,8 @@ void Gambit_fn_02076690(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -14756,15 +14756,15 @@ void Gambit_fn_02076690(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -14792,15 +14792,15 @@ void Gambit_fn_020766A4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020766A4: ; // 0x20766a4
-        /* 020766A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020766A8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020766A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020766A8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020766A8 */ _t1 = _t0 & 0x00000001u;
         /* 020766A8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020766A8 */ goto L_020766AC;
   L_020766AC: ; // 0x20766ac
         /* 020766AC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020766AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020766B0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020766AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020766B0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020766B0 */ _t3 = _t2 & 0x00000001u;
         /* 020766B0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020766B0 */ goto L_020766B4;
@@ -14819,8 +14819,8 @@ void Gambit_fn_020766A4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -14834,15 +14834,15 @@ void Gambit_fn_020766A4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -14892,11 +14892,11 @@ void Gambit_fn_020766C0(CPUState* cpu) {
         /* 02079948 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02079948 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0207994C */ cpu->r[30] = cpu->r[3];
-        /* 0207994C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207994C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02079950 */ cpu->r[31] = cpu->r[4];
         /* 02079954 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02079954 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02079958 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079958 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079958 */ _t5 = _t4 & 0x00000001u;
         /* 02079958 */ if (_t5) goto L_020799C8; else goto L_0207995C;
   L_0207995C: ; // 0x207995c
@@ -14910,10 +14910,10 @@ void Gambit_fn_020766C0(CPUState* cpu) {
         /* 02079974 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02079974 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02079978 */ cpu->r[11] = cpu->r[11] + 0xFFFFB258u;
-        /* 0207997C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207997C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02079980 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02079980 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02079984 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079984 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079984 */ _t10 = _t9 & 0x00000001u;
         /* 02079984 */ if (_t10) goto L_020799B8; else goto L_02079988;
   L_02079988: ; // 0x2079988
@@ -14934,8 +14934,8 @@ void Gambit_fn_020766C0(CPUState* cpu) {
         /* 020799B4 */ Gambit_fn_02068798(cpu);
   L_020799B8: ; // 0x20799b8
         /* 020799B8 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020799B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020799BC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020799B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020799BC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020799BC */ _t15 = _t14 & 0x00000001u;
         /* 020799BC */ if (_t15) goto L_020799C8; else goto L_020799C0;
   L_020799C0: ; // 0x20799c0
@@ -14963,8 +14963,8 @@ void Gambit_fn_020766C8(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -15037,23 +15037,23 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 02076720 */ cpu->r[30] = 0x00000000u;
         /* 02076724 */ _t9 = cpu->r[1] + 0x00000008u;
         /* 02076724 */ rbrew_write8(cpu->mem, _t9, (uint8_t)cpu->r[0]);
-        /* 02076728 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[0]);
+        /* 02076728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[0]));
         /* 0207672C */ cpu->r[8] = 0x00080000u;
-        /* 02076730 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076730 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076730 */ _t11 = _t10 & 0x00000001u;
         /* 02076730 */ if (_t11) goto L_02076758; else goto L_02076734;
   L_02076734: ; // 0x2076734
         /* 02076734 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02076738 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[8]);
+        /* 02076738 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[8]));
         /* 0207673C */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 02076740 */ _t12 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02076740 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02076740 */ _t13 = _t12 & 0x00000001u;
         /* 02076740 */ if (_t13) goto L_02076754; else goto L_02076744;
   L_02076744: ; // 0x2076744
         /* 02076744 */ _t14 = cpu->r[6] + 0x00000000u;
         /* 02076744 */ cpu->r[12] = rbrew_read8(cpu->mem, _t14);
-        /* 02076748 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
-        /* 0207674C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076748 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
+        /* 0207674C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207674C */ _t16 = _t15 & 0x00000001u;
         /* 0207674C */ if (_t16) goto L_02076750; else goto L_02076734;
   L_02076750: ; // 0x2076750
@@ -15065,10 +15065,10 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 02076758 */ cpu->r[12] = rbrew_read32(cpu->mem, _t17);
         /* 0207675C */ _t18 = cpu->r[12] + 0x00000458u;
         /* 0207675C */ cpu->r[10] = rbrew_read32(cpu->mem, _t18);
-        /* 02076760 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[10]);
+        /* 02076760 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[10]));
         /* 02076764 */ _t19 = cpu->r[31] + 0x00000004u;
         /* 02076764 */ cpu->r[7] = rbrew_read32(cpu->mem, _t19);
-        /* 02076768 */ _t20 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02076768 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02076768 */ _t21 = _t20 & 0x00000001u;
         /* 02076768 */ if (_t21) goto L_02076770; else goto L_0207676C;
   L_0207676C: ; // 0x207676c
@@ -15131,7 +15131,7 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 02076800 */ cpu->r[5] = rbrew_read32(cpu->mem, _t39);
         /* 02076804 */ cpu->r[3] = cpu->r[1] + 0x00000058u;
         /* 02076808 */ cpu->r[4] = cpu->r[4] + 0xFFFFAE2Cu;
-        /* 0207680C */ _t40 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0207680C */ _t40 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0207680C */ _t41 = _t40 & 0x00000001u;
         /* 0207680C */ if (_t41) goto L_02076810; // else: addr-0 trap, fall-through
   L_02076810: ; // 0x2076810
@@ -15180,9 +15180,9 @@ void Gambit_fn_020766E0(CPUState* cpu) {
   L_0207688C: ; // 0x207688c
         /* 0207688C */ _t53 = cpu->r[22] + 0xFFFFE378u;
         /* 0207688C */ cpu->r[8] = rbrew_read32(cpu->mem, _t53);
-        /* 02076890 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02076890 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02076894 */ cpu->r[30] = cpu->r[28];
-        /* 02076898 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076898 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076898 */ _t55 = _t54 & 0x00000001u;
         /* 02076898 */ if (_t55) goto L_0207689C; else goto L_020768B0;
   L_0207689C: ; // 0x207689c
@@ -15195,8 +15195,8 @@ void Gambit_fn_020766E0(CPUState* cpu) {
   L_020768B0: ; // 0x20768b0
         /* 020768B0 */ _t57 = cpu->r[21] + 0xFFFFE374u;
         /* 020768B0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t57);
-        /* 020768B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 020768B8 */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020768B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 020768B8 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020768B8 */ _t59 = _t58 & 0x00000001u;
         /* 020768B8 */ if (_t59) goto L_020768BC; else goto L_020768C4;
   L_020768BC: ; // 0x20768bc
@@ -15205,15 +15205,15 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 020768C0 */ _t61 = cpu->r[21] + 0xFFFFE374u;
         /* 020768C0 */ rbrew_write32(cpu->mem, _t61, cpu->r[25]);
   L_020768C4: ; // 0x20768c4
-        /* 020768C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000007u);
-        /* 020768C8 */ _t62 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020768C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000007u));
+        /* 020768C8 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020768C8 */ _t63 = _t62 & 0x00000001u;
         /* 020768C8 */ if (_t63) goto L_02076918; else goto L_020768CC;
   L_020768CC: ; // 0x20768cc
         /* 020768CC */ cpu->r[4] = cpu->r[29] + 0xFFFFAE34u;
         /* 020768D0 */ cpu->r[3] = cpu->r[1] + 0x0000001Cu;
         /* 020768D4 */ cpu->r[5] = 0x00000000u;
-        /* 020768D8 */ _t64 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020768D8 */ _t64 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020768D8 */ _t65 = _t64 & 0x00000001u;
         /* 020768D8 */ if (_t65) goto L_020768DC; // else: addr-0 trap, fall-through
   L_020768DC: ; // 0x20768dc
@@ -15232,9 +15232,9 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 02076900 */ _t69 = cpu->r[9] + 0x00000000u;
         /* 02076900 */ cpu->r[10] = rbrew_read8(cpu->mem, _t69);
         /* 02076904 */ cpu->r[11] = 0x00000000u;
-        /* 02076908 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[0]);
+        /* 02076908 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[0]));
         /* 0207690C */ cpu->r[10] = 0x00080000u;
-        /* 02076910 */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076910 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076910 */ _t71 = _t70 & 0x00000001u;
         /* 02076910 */ if (_t71) goto L_02076914; else goto L_020769A8;
   L_02076914: ; // 0x2076914
@@ -15242,8 +15242,8 @@ void Gambit_fn_020766E0(CPUState* cpu) {
   L_02076918: ; // 0x2076918
         /* 02076918 */ _t72 = cpu->r[20] + 0xFFFFEE14u;
         /* 02076918 */ cpu->r[12] = rbrew_read32(cpu->mem, _t72);
-        /* 0207691C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02076920 */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207691C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02076920 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076920 */ _t74 = _t73 & 0x00000001u;
         /* 02076920 */ if (_t74) goto L_02076924; else goto L_0207695C;
   L_02076924: ; // 0x2076924
@@ -15252,8 +15252,8 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 0207692C */ Gambit_fn_02836FFC(cpu);
         /* 02076930 */ _t75 = cpu->r[20] + 0xFFFFEE14u;
         /* 02076930 */ cpu->r[12] = rbrew_read32(cpu->mem, _t75);
-        /* 02076934 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02076938 */ _t76 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02076938 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076938 */ _t77 = _t76 & 0x00000001u;
         /* 02076938 */ if (_t77) goto L_0207693C; else goto L_02076950;
   L_0207693C: ; // 0x207693c
@@ -15274,7 +15274,7 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 02076964 */ _t80 = cpu->r[7] + cpu->r[12];
         /* 02076964 */ cpu->r[5] = rbrew_read32(cpu->mem, _t80);
         /* 02076968 */ cpu->r[4] = cpu->r[29] + 0xFFFFAE34u;
-        /* 0207696C */ _t81 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0207696C */ _t81 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0207696C */ _t82 = _t81 & 0x00000001u;
         /* 0207696C */ if (_t82) goto L_02076970; // else: addr-0 trap, fall-through
   L_02076970: ; // 0x2076970
@@ -15293,29 +15293,29 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 02076994 */ _t86 = cpu->r[9] + 0x00000000u;
         /* 02076994 */ cpu->r[10] = rbrew_read8(cpu->mem, _t86);
         /* 02076998 */ cpu->r[11] = 0x00000000u;
-        /* 0207699C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[0]);
+        /* 0207699C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[0]));
         /* 020769A0 */ cpu->r[10] = 0x00080000u;
-        /* 020769A4 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020769A4 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020769A4 */ _t88 = _t87 & 0x00000001u;
         /* 020769A4 */ if (_t88) goto L_020769C4; else goto L_020769A8;
   L_020769A8: ; // 0x20769a8
         /* 020769A8 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 020769AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], cpu->r[10]);
+        /* 020769AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], cpu->r[10]));
         /* 020769B0 */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 020769B4 */ _t89 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020769B4 */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020769B4 */ _t90 = _t89 & 0x00000001u;
         /* 020769B4 */ if (_t90) goto L_02076A78; else goto L_020769B8;
   L_020769B8: ; // 0x20769b8
         /* 020769B8 */ _t91 = cpu->r[9] + 0x00000000u;
         /* 020769B8 */ cpu->r[4] = rbrew_read8(cpu->mem, _t91);
-        /* 020769BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[0]);
-        /* 020769C0 */ _t92 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020769BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[0]));
+        /* 020769C0 */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020769C0 */ _t93 = _t92 & 0x00000001u;
         /* 020769C0 */ if (_t93) goto L_020769C4; else goto L_020769A8;
   L_020769C4: ; // 0x20769c4
         /* 020769C4 */ cpu->r[16] = cpu->r[11];
-        /* 020769C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[16], 0x00000000u);
-        /* 020769C8 */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020769C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[16], 0x00000000u));
+        /* 020769C8 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020769C8 */ _t95 = _t94 & 0x00000001u;
         /* 020769C8 */ if (_t95) goto L_02076A78; else goto L_020769CC;
   L_020769CC: ; // 0x20769cc
@@ -15335,23 +15335,23 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 020769F0 */ _t100 = cpu->r[5] + 0x00000000u;
         /* 020769F0 */ cpu->r[7] = rbrew_read8(cpu->mem, _t100);
         /* 020769F4 */ cpu->r[12] = 0x00000000u;
-        /* 020769F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 020769F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 020769FC */ cpu->r[4] = 0x00080000u;
-        /* 02076A00 */ _t101 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076A00 */ _t101 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076A00 */ _t102 = _t101 & 0x00000001u;
         /* 02076A00 */ if (_t102) goto L_02076A38; else goto L_02076A04;
   L_02076A04: ; // 0x2076a04
         /* 02076A04 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 02076A08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[4]);
+        /* 02076A08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[4]));
         /* 02076A0C */ cpu->r[5] = cpu->r[5] + 0x00000001u;
-        /* 02076A10 */ _t103 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02076A10 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02076A10 */ _t104 = _t103 & 0x00000001u;
         /* 02076A10 */ if (_t104) goto L_02076A28; else goto L_02076A14;
   L_02076A14: ; // 0x2076a14
         /* 02076A14 */ _t105 = cpu->r[5] + 0x00000000u;
         /* 02076A14 */ cpu->r[0] = rbrew_read8(cpu->mem, _t105);
-        /* 02076A18 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
-        /* 02076A1C */ _t106 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076A18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
+        /* 02076A1C */ _t106 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076A1C */ _t107 = _t106 & 0x00000001u;
         /* 02076A1C */ if (_t107) goto L_02076A20; else goto L_02076A04;
   L_02076A20: ; // 0x2076a20
@@ -15359,8 +15359,8 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 02076A24 */ goto L_02076A3C;
   L_02076A28: ; // 0x2076a28
         /* 02076A28 */ cpu->r[0] = 0x00000000u;
-        /* 02076A2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[16]);
-        /* 02076A30 */ _t108 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02076A2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[16]));
+        /* 02076A30 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02076A30 */ _t109 = _t108 & 0x00000001u;
         /* 02076A30 */ if (_t109) goto L_02076A8C; else goto L_02076A34;
   L_02076A34: ; // 0x2076a34
@@ -15368,16 +15368,16 @@ void Gambit_fn_020766E0(CPUState* cpu) {
   L_02076A38: ; // 0x2076a38
         /* 02076A38 */ cpu->r[0] = cpu->r[12];
   L_02076A3C: ; // 0x2076a3c
-        /* 02076A3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[16]);
-        /* 02076A40 */ _t110 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02076A3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[16]));
+        /* 02076A40 */ _t110 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02076A40 */ _t111 = _t110 & 0x00000001u;
         /* 02076A40 */ if (_t111) goto L_02076A8C; else goto L_02076A44;
   L_02076A44: ; // 0x2076a44
         /* 02076A44 */ cpu->r[9] = cpu->r[16];
-        /* 02076A44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02076A44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02076A48 */ cpu->r[7] = cpu->r[0] - cpu->r[16];
         /* 02076A4C */ cpu->r[4] = 0x00000000u;
-        /* 02076A50 */ _t112 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02076A50 */ _t112 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02076A50 */ _t113 = _t112 & 0x00000001u;
         /* 02076A50 */ if (_t113) goto L_02076A54; else goto L_02076A78;
   L_02076A54: ; // 0x2076a54
@@ -15390,8 +15390,8 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 02076A60 */ cpu->r[12] = _t114;
         /* 02076A64 */ _t115 = cpu->r[18] + cpu->r[4];
         /* 02076A64 */ cpu->r[0] = rbrew_read8(cpu->mem, _t115);
-        /* 02076A68 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[0]);
-        /* 02076A6C */ _t116 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076A68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[0]));
+        /* 02076A6C */ _t116 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076A6C */ _t117 = _t116 & 0x00000001u;
         /* 02076A6C */ if (_t117) goto L_02076A70; else goto L_02076A8C;
   L_02076A70: ; // 0x2076a70
@@ -15413,9 +15413,9 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 02076A88 */ goto L_02076CCC;
   L_02076A8C: ; // 0x2076a8c
         /* 02076A8C */ cpu->r[15] = cpu->r[15] + 0xFFFFFFFFu;
-        /* 02076A8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[15], 0x00000000u);
+        /* 02076A8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[15], 0x00000000u));
         /* 02076A90 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
-        /* 02076A94 */ _t125 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076A94 */ _t125 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076A94 */ _t126 = _t125 & 0x00000001u;
         /* 02076A94 */ if (_t126) goto L_02076A98; else goto L_0207688C;
   L_02076A98: ; // 0x2076a98
@@ -15438,9 +15438,9 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 02076ACC */ _t129 = cpu->r[20] + 0x00000000u;
         /* 02076ACC */ cpu->r[11] = rbrew_read32(cpu->mem, _t129);
         /* 02076AD0 */ cpu->r[27] = cpu->r[28];
-        /* 02076AD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02076AD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02076AD8 */ cpu->r[30] = cpu->r[28];
-        /* 02076ADC */ _t130 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076ADC */ _t130 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076ADC */ _t131 = _t130 & 0x00000001u;
         /* 02076ADC */ if (_t131) goto L_02076AE0; else goto L_02076AF4;
   L_02076AE0: ; // 0x2076ae0
@@ -15453,8 +15453,8 @@ void Gambit_fn_020766E0(CPUState* cpu) {
   L_02076AF4: ; // 0x2076af4
         /* 02076AF4 */ _t133 = cpu->r[19] + 0x00000000u;
         /* 02076AF4 */ cpu->r[4] = rbrew_read32(cpu->mem, _t133);
-        /* 02076AF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 02076AFC */ _t134 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076AF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 02076AFC */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076AFC */ _t135 = _t134 & 0x00000001u;
         /* 02076AFC */ if (_t135) goto L_02076B00; else goto L_02076B08;
   L_02076B00: ; // 0x2076b00
@@ -15463,15 +15463,15 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 02076B04 */ _t137 = cpu->r[19] + 0x00000000u;
         /* 02076B04 */ rbrew_write32(cpu->mem, _t137, cpu->r[23]);
   L_02076B08: ; // 0x2076b08
-        /* 02076B08 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000007u);
-        /* 02076B0C */ _t138 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02076B08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000007u));
+        /* 02076B0C */ _t138 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02076B0C */ _t139 = _t138 & 0x00000001u;
         /* 02076B0C */ if (_t139) goto L_02076B5C; else goto L_02076B10;
   L_02076B10: ; // 0x2076b10
         /* 02076B10 */ cpu->r[5] = 0x00000000u;
         /* 02076B14 */ cpu->r[3] = cpu->r[1] + 0x0000001Cu;
         /* 02076B18 */ cpu->r[4] = cpu->r[26] + 0xFFFFAE38u;
-        /* 02076B1C */ _t140 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02076B1C */ _t140 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02076B1C */ _t141 = _t140 & 0x00000001u;
         /* 02076B1C */ if (_t141) goto L_02076B20; // else: addr-0 trap, fall-through
   L_02076B20: ; // 0x2076b20
@@ -15490,9 +15490,9 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 02076B44 */ _t145 = cpu->r[11] + 0x00000000u;
         /* 02076B44 */ cpu->r[10] = rbrew_read8(cpu->mem, _t145);
         /* 02076B48 */ cpu->r[7] = 0x00000000u;
-        /* 02076B4C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[5]);
+        /* 02076B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[5]));
         /* 02076B50 */ cpu->r[4] = 0x00080000u;
-        /* 02076B54 */ _t146 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076B54 */ _t146 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076B54 */ _t147 = _t146 & 0x00000001u;
         /* 02076B54 */ if (_t147) goto L_02076B58; else goto L_02076BEC;
   L_02076B58: ; // 0x2076b58
@@ -15500,8 +15500,8 @@ void Gambit_fn_020766E0(CPUState* cpu) {
   L_02076B5C: ; // 0x2076b5c
         /* 02076B5C */ _t148 = cpu->r[18] + 0x00000000u;
         /* 02076B5C */ cpu->r[6] = rbrew_read32(cpu->mem, _t148);
-        /* 02076B60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 02076B64 */ _t149 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076B60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 02076B64 */ _t149 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076B64 */ _t150 = _t149 & 0x00000001u;
         /* 02076B64 */ if (_t150) goto L_02076B68; else goto L_02076BA0;
   L_02076B68: ; // 0x2076b68
@@ -15510,8 +15510,8 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 02076B70 */ Gambit_fn_02836FFC(cpu);
         /* 02076B74 */ _t151 = cpu->r[18] + 0x00000000u;
         /* 02076B74 */ cpu->r[5] = rbrew_read32(cpu->mem, _t151);
-        /* 02076B78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 02076B7C */ _t152 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076B78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 02076B7C */ _t152 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076B7C */ _t153 = _t152 & 0x00000001u;
         /* 02076B7C */ if (_t153) goto L_02076B80; else goto L_02076B94;
   L_02076B80: ; // 0x2076b80
@@ -15532,7 +15532,7 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 02076BA8 */ _t156 = cpu->r[7] + cpu->r[6];
         /* 02076BA8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t156);
         /* 02076BAC */ cpu->r[4] = cpu->r[26] + 0xFFFFAE38u;
-        /* 02076BB0 */ _t157 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02076BB0 */ _t157 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02076BB0 */ _t158 = _t157 & 0x00000001u;
         /* 02076BB0 */ if (_t158) goto L_02076BB4; // else: addr-0 trap, fall-through
   L_02076BB4: ; // 0x2076bb4
@@ -15551,29 +15551,29 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 02076BD8 */ _t162 = cpu->r[11] + 0x00000000u;
         /* 02076BD8 */ cpu->r[10] = rbrew_read8(cpu->mem, _t162);
         /* 02076BDC */ cpu->r[7] = 0x00000000u;
-        /* 02076BE0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[5]);
+        /* 02076BE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[5]));
         /* 02076BE4 */ cpu->r[4] = 0x00080000u;
-        /* 02076BE8 */ _t163 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076BE8 */ _t163 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076BE8 */ _t164 = _t163 & 0x00000001u;
         /* 02076BE8 */ if (_t164) goto L_02076C08; else goto L_02076BEC;
   L_02076BEC: ; // 0x2076bec
         /* 02076BEC */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02076BF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], cpu->r[4]);
+        /* 02076BF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], cpu->r[4]));
         /* 02076BF4 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 02076BF8 */ _t165 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02076BF8 */ _t165 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02076BF8 */ _t166 = _t165 & 0x00000001u;
         /* 02076BF8 */ if (_t166) goto L_02076CA8; else goto L_02076BFC;
   L_02076BFC: ; // 0x2076bfc
         /* 02076BFC */ _t167 = cpu->r[11] + 0x00000000u;
         /* 02076BFC */ cpu->r[0] = rbrew_read8(cpu->mem, _t167);
-        /* 02076C00 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[5]);
-        /* 02076C04 */ _t168 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076C00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[5]));
+        /* 02076C04 */ _t168 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076C04 */ _t169 = _t168 & 0x00000001u;
         /* 02076C04 */ if (_t169) goto L_02076C08; else goto L_02076BEC;
   L_02076C08: ; // 0x2076c08
         /* 02076C08 */ cpu->r[15] = cpu->r[7];
-        /* 02076C08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[15], 0x00000000u);
-        /* 02076C0C */ _t170 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076C08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[15], 0x00000000u));
+        /* 02076C0C */ _t170 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076C0C */ _t171 = _t170 & 0x00000001u;
         /* 02076C0C */ if (_t171) goto L_02076CA8; else goto L_02076C10;
   L_02076C10: ; // 0x2076c10
@@ -15593,23 +15593,23 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 02076C34 */ _t176 = cpu->r[12] + 0x00000000u;
         /* 02076C34 */ cpu->r[5] = rbrew_read8(cpu->mem, _t176);
         /* 02076C38 */ cpu->r[9] = 0x00000000u;
-        /* 02076C3C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[6]);
+        /* 02076C3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[6]));
         /* 02076C40 */ cpu->r[5] = 0x00080000u;
-        /* 02076C44 */ _t177 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076C44 */ _t177 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076C44 */ _t178 = _t177 & 0x00000001u;
         /* 02076C44 */ if (_t178) goto L_02076C6C; else goto L_02076C48;
   L_02076C48: ; // 0x2076c48
         /* 02076C48 */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 02076C4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], cpu->r[5]);
+        /* 02076C4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], cpu->r[5]));
         /* 02076C50 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 02076C54 */ _t179 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02076C54 */ _t179 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02076C54 */ _t180 = _t179 & 0x00000001u;
         /* 02076C54 */ if (_t180) goto L_02076C68; else goto L_02076C58;
   L_02076C58: ; // 0x2076c58
         /* 02076C58 */ _t181 = cpu->r[12] + 0x00000000u;
         /* 02076C58 */ cpu->r[8] = rbrew_read8(cpu->mem, _t181);
-        /* 02076C5C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[6]);
-        /* 02076C60 */ _t182 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076C5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[6]));
+        /* 02076C60 */ _t182 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076C60 */ _t183 = _t182 & 0x00000001u;
         /* 02076C60 */ if (_t183) goto L_02076C64; else goto L_02076C48;
   L_02076C64: ; // 0x2076c64
@@ -15617,16 +15617,16 @@ void Gambit_fn_020766E0(CPUState* cpu) {
   L_02076C68: ; // 0x2076c68
         /* 02076C68 */ cpu->r[9] = 0x00000000u;
   L_02076C6C: ; // 0x2076c6c
-        /* 02076C6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], cpu->r[15]);
-        /* 02076C70 */ _t184 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02076C6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], cpu->r[15]));
+        /* 02076C70 */ _t184 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02076C70 */ _t185 = _t184 & 0x00000001u;
         /* 02076C70 */ if (_t185) goto L_02076CBC; else goto L_02076C74;
   L_02076C74: ; // 0x2076c74
         /* 02076C74 */ cpu->r[10] = cpu->r[15];
-        /* 02076C74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02076C74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02076C78 */ cpu->r[0] = cpu->r[9] - cpu->r[15];
         /* 02076C7C */ cpu->r[7] = 0x00000000u;
-        /* 02076C80 */ _t186 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02076C80 */ _t186 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02076C80 */ _t187 = _t186 & 0x00000001u;
         /* 02076C80 */ if (_t187) goto L_02076C84; else goto L_02076CA8;
   L_02076C84: ; // 0x2076c84
@@ -15639,8 +15639,8 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 02076C90 */ cpu->r[8] = _t188;
         /* 02076C94 */ _t189 = cpu->r[30] + cpu->r[7];
         /* 02076C94 */ cpu->r[10] = rbrew_read8(cpu->mem, _t189);
-        /* 02076C98 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[10]);
-        /* 02076C9C */ _t190 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076C98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[10]));
+        /* 02076C9C */ _t190 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076C9C */ _t191 = _t190 & 0x00000001u;
         /* 02076C9C */ if (_t191) goto L_02076CA0; else goto L_02076CBC;
   L_02076CA0: ; // 0x2076ca0
@@ -15662,9 +15662,9 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 02076CB8 */ goto L_02076CCC;
   L_02076CBC: ; // 0x2076cbc
         /* 02076CBC */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 02076CBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 02076CBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 02076CC0 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
-        /* 02076CC4 */ _t199 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076CC4 */ _t199 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076CC4 */ _t200 = _t199 & 0x00000001u;
         /* 02076CC4 */ if (_t200) goto L_02076CC8; else goto L_02076ACC;
   L_02076CC8: ; // 0x2076cc8
@@ -15689,28 +15689,28 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 02076CF4 */ _t207 = cpu->r[7] + 0x00000000u;
         /* 02076CF4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t207);
         /* 02076CF8 */ cpu->r[30] = 0x00000000u;
-        /* 02076CFC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[6]);
+        /* 02076CFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[6]));
         /* 02076D00 */ cpu->r[0] = 0x00080000u;
-        /* 02076D04 */ _t208 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076D04 */ _t208 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076D04 */ _t209 = _t208 & 0x00000001u;
         /* 02076D04 */ if (_t209) goto L_02076D24; else goto L_02076D08;
   L_02076D08: ; // 0x2076d08
         /* 02076D08 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02076D0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 02076D0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 02076D10 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02076D14 */ _t210 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02076D14 */ _t210 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02076D14 */ _t211 = _t210 & 0x00000001u;
         /* 02076D14 */ if (_t211) goto L_02076DC0; else goto L_02076D18;
   L_02076D18: ; // 0x2076d18
         /* 02076D18 */ _t212 = cpu->r[7] + 0x00000000u;
         /* 02076D18 */ cpu->r[5] = rbrew_read8(cpu->mem, _t212);
-        /* 02076D1C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[6]);
-        /* 02076D20 */ _t213 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076D1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[6]));
+        /* 02076D20 */ _t213 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076D20 */ _t214 = _t213 & 0x00000001u;
         /* 02076D20 */ if (_t214) goto L_02076D24; else goto L_02076D08;
   L_02076D24: ; // 0x2076d24
-        /* 02076D24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02076D28 */ _t215 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076D24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02076D28 */ _t215 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076D28 */ _t216 = _t215 & 0x00000001u;
         /* 02076D28 */ if (_t216) goto L_02076DC0; else goto L_02076D2C;
   L_02076D2C: ; // 0x2076d2c
@@ -15730,23 +15730,23 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 02076D4C */ _t222 = cpu->r[12] + 0x00000000u;
         /* 02076D4C */ cpu->r[10] = rbrew_read8(cpu->mem, _t222);
         /* 02076D50 */ cpu->r[4] = 0x00000000u;
-        /* 02076D54 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[11]);
+        /* 02076D54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[11]));
         /* 02076D58 */ cpu->r[5] = 0x00080000u;
-        /* 02076D5C */ _t223 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076D5C */ _t223 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076D5C */ _t224 = _t223 & 0x00000001u;
         /* 02076D5C */ if (_t224) goto L_02076D84; else goto L_02076D60;
   L_02076D60: ; // 0x2076d60
         /* 02076D60 */ cpu->r[4] = cpu->r[4] + 0x00000001u;
-        /* 02076D64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], cpu->r[5]);
+        /* 02076D64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], cpu->r[5]));
         /* 02076D68 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 02076D6C */ _t225 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02076D6C */ _t225 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02076D6C */ _t226 = _t225 & 0x00000001u;
         /* 02076D6C */ if (_t226) goto L_02076D80; else goto L_02076D70;
   L_02076D70: ; // 0x2076d70
         /* 02076D70 */ _t227 = cpu->r[12] + 0x00000000u;
         /* 02076D70 */ cpu->r[0] = rbrew_read8(cpu->mem, _t227);
-        /* 02076D74 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[11]);
-        /* 02076D78 */ _t228 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076D74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[11]));
+        /* 02076D78 */ _t228 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076D78 */ _t229 = _t228 & 0x00000001u;
         /* 02076D78 */ if (_t229) goto L_02076D7C; else goto L_02076D60;
   L_02076D7C: ; // 0x2076d7c
@@ -15754,15 +15754,15 @@ void Gambit_fn_020766E0(CPUState* cpu) {
   L_02076D80: ; // 0x2076d80
         /* 02076D80 */ cpu->r[4] = 0x00000000u;
   L_02076D84: ; // 0x2076d84
-        /* 02076D84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], cpu->r[30]);
-        /* 02076D88 */ _t230 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02076D84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], cpu->r[30]));
+        /* 02076D88 */ _t230 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02076D88 */ _t231 = _t230 & 0x00000001u;
         /* 02076D88 */ if (_t231) goto L_02076DCC; else goto L_02076D8C;
   L_02076D8C: ; // 0x2076d8c
-        /* 02076D8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02076D8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02076D90 */ cpu->r[8] = 0x00000000u;
         /* 02076D94 */ cpu->r[0] = cpu->r[4] - cpu->r[30];
-        /* 02076D98 */ _t232 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02076D98 */ _t232 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02076D98 */ _t233 = _t232 & 0x00000001u;
         /* 02076D98 */ if (_t233) goto L_02076D9C; else goto L_02076DC0;
   L_02076D9C: ; // 0x2076d9c
@@ -15775,8 +15775,8 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 02076DA8 */ cpu->r[10] = _t234;
         /* 02076DAC */ _t235 = cpu->r[29] + cpu->r[8];
         /* 02076DAC */ cpu->r[4] = rbrew_read8(cpu->mem, _t235);
-        /* 02076DB0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[4]);
-        /* 02076DB4 */ _t236 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076DB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[4]));
+        /* 02076DB4 */ _t236 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076DB4 */ _t237 = _t236 & 0x00000001u;
         /* 02076DB4 */ if (_t237) goto L_02076DB8; else goto L_02076DCC;
   L_02076DB8: ; // 0x2076db8
@@ -15797,8 +15797,8 @@ void Gambit_fn_020766E0(CPUState* cpu) {
         /* 02076DCC */ cpu->r[8] = rbrew_read32(cpu->mem, _t243);
         /* 02076DD0 */ _t244 = cpu->r[8] + 0x00000000u;
         /* 02076DD0 */ cpu->r[6] = rbrew_read8(cpu->mem, _t244);
-        /* 02076DD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 02076DD8 */ _t245 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076DD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 02076DD8 */ _t245 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076DD8 */ _t246 = _t245 & 0x00000001u;
         /* 02076DD8 */ if (_t246) goto L_02076DEC; else goto L_02076DDC;
   L_02076DDC: ; // 0x2076ddc
@@ -15834,9 +15834,9 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 02076E14 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
         /* 02076E18 */ cpu->r[30] = cpu->r[4];
         /* 02076E1C */ cpu->r[28] = 0x00000000u;
-        /* 02076E20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02076E20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02076E24 */ cpu->r[29] = cpu->r[3];
-        /* 02076E28 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076E28 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076E28 */ _t4 = _t3 & 0x00000001u;
         /* 02076E28 */ if (_t4) goto L_02076E30; else goto L_02076E2C;
   L_02076E2C: ; // 0x2076e2c
@@ -15850,10 +15850,10 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 02076E38 */ cpu->r[11] = rbrew_read32(cpu->mem, _t7);
         /* 02076E3C */ _t8 = cpu->r[7] + 0x00000014u;
         /* 02076E3C */ cpu->r[9] = rbrew_read32(cpu->mem, _t8);
-        /* 02076E40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02076E40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02076E44 */ _t9 = cpu->r[29] + 0x00000450u;
         /* 02076E44 */ cpu->r[27] = rbrew_read32(cpu->mem, _t9);
-        /* 02076E48 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076E48 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076E48 */ _t11 = _t10 & 0x00000001u;
         /* 02076E48 */ if (_t11) goto L_02076E50; else goto L_02076E4C;
   L_02076E4C: ; // 0x2076e4c
@@ -15873,23 +15873,23 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 02076E6C */ cpu->r[31] = 0x00000000u;
         /* 02076E70 */ _t16 = cpu->r[1] + 0x0000000Cu;
         /* 02076E70 */ rbrew_write8(cpu->mem, _t16, (uint8_t)cpu->r[4]);
-        /* 02076E74 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[4]);
+        /* 02076E74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[4]));
         /* 02076E78 */ cpu->r[6] = 0x00080000u;
-        /* 02076E7C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076E7C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076E7C */ _t18 = _t17 & 0x00000001u;
         /* 02076E7C */ if (_t18) goto L_02076EA4; else goto L_02076E80;
   L_02076E80: ; // 0x2076e80
         /* 02076E80 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02076E84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 02076E84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 02076E88 */ cpu->r[5] = cpu->r[5] + 0x00000001u;
-        /* 02076E8C */ _t19 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02076E8C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02076E8C */ _t20 = _t19 & 0x00000001u;
         /* 02076E8C */ if (_t20) goto L_02076EA0; else goto L_02076E90;
   L_02076E90: ; // 0x2076e90
         /* 02076E90 */ _t21 = cpu->r[5] + 0x00000000u;
         /* 02076E90 */ cpu->r[0] = rbrew_read8(cpu->mem, _t21);
-        /* 02076E94 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[4]);
-        /* 02076E98 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076E94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[4]));
+        /* 02076E98 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076E98 */ _t23 = _t22 & 0x00000001u;
         /* 02076E98 */ if (_t23) goto L_02076E9C; else goto L_02076E80;
   L_02076E9C: ; // 0x2076e9c
@@ -15901,10 +15901,10 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 02076EA4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t24);
         /* 02076EA8 */ _t25 = cpu->r[30] + 0x00000004u;
         /* 02076EA8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t25);
-        /* 02076EAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 02076EAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 02076EB0 */ _t26 = cpu->r[7] + 0x00000014u;
         /* 02076EB0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t26);
-        /* 02076EB4 */ _t27 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02076EB4 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02076EB4 */ _t28 = _t27 & 0x00000001u;
         /* 02076EB4 */ if (_t28) goto L_02076EBC; else goto L_02076EB8;
   L_02076EB8: ; // 0x2076eb8
@@ -15962,7 +15962,7 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 02076F44 */ _t44 = cpu->r[29] + 0x00000450u;
         /* 02076F44 */ cpu->r[5] = rbrew_read32(cpu->mem, _t44);
         /* 02076F48 */ cpu->r[4] = cpu->r[4] + 0xFFFFAE44u;
-        /* 02076F4C */ _t45 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02076F4C */ _t45 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02076F4C */ _t46 = _t45 & 0x00000001u;
         /* 02076F4C */ if (_t46) goto L_02076F50; // else: addr-0 trap, fall-through
   L_02076F50: ; // 0x2076f50
@@ -15980,8 +15980,8 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 02076F70 */ _t50 = cpu->r[1] + 0x00000050u;
         /* 02076F70 */ rbrew_write32(cpu->mem, _t50, cpu->r[10]);
         /* 02076F74 */ Gambit_fn_020A54C4(cpu);
-        /* 02076F78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 02076F7C */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076F78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 02076F7C */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076F7C */ _t52 = _t51 & 0x00000001u;
         /* 02076F7C */ if (_t52) goto L_02076F8C; else goto L_02076F80;
   L_02076F80: ; // 0x2076f80
@@ -16023,10 +16023,10 @@ void Gambit_fn_02076E00(CPUState* cpu) {
   L_02076FEC: ; // 0x2076fec
         /* 02076FEC */ _t60 = cpu->r[22] + 0xFFFFE378u;
         /* 02076FEC */ cpu->r[11] = rbrew_read32(cpu->mem, _t60);
-        /* 02076FF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02076FF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02076FF4 */ _t61 = cpu->r[1] + 0x00000018u;
         /* 02076FF4 */ rbrew_write32(cpu->mem, _t61, cpu->r[27]);
-        /* 02076FF8 */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02076FF8 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02076FF8 */ _t63 = _t62 & 0x00000001u;
         /* 02076FF8 */ if (_t63) goto L_02076FFC; else goto L_02077010;
   L_02076FFC: ; // 0x2076ffc
@@ -16039,8 +16039,8 @@ void Gambit_fn_02076E00(CPUState* cpu) {
   L_02077010: ; // 0x2077010
         /* 02077010 */ _t65 = cpu->r[21] + 0xFFFFE374u;
         /* 02077010 */ cpu->r[12] = rbrew_read32(cpu->mem, _t65);
-        /* 02077014 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02077018 */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077014 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02077018 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077018 */ _t67 = _t66 & 0x00000001u;
         /* 02077018 */ if (_t67) goto L_0207701C; else goto L_02077024;
   L_0207701C: ; // 0x207701c
@@ -16049,15 +16049,15 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 02077020 */ _t69 = cpu->r[21] + 0xFFFFE374u;
         /* 02077020 */ rbrew_write32(cpu->mem, _t69, cpu->r[25]);
   L_02077024: ; // 0x2077024
-        /* 02077024 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], 0x00000007u);
-        /* 02077028 */ _t70 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02077024 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], 0x00000007u));
+        /* 02077028 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02077028 */ _t71 = _t70 & 0x00000001u;
         /* 02077028 */ if (_t71) goto L_02077078; else goto L_0207702C;
   L_0207702C: ; // 0x207702c
         /* 0207702C */ cpu->r[5] = 0x00000000u;
         /* 02077030 */ cpu->r[3] = cpu->r[1] + 0x0000001Cu;
         /* 02077034 */ cpu->r[4] = cpu->r[28] + 0xFFFFAE4Cu;
-        /* 02077038 */ _t72 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02077038 */ _t72 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02077038 */ _t73 = _t72 & 0x00000001u;
         /* 02077038 */ if (_t73) goto L_0207703C; // else: addr-0 trap, fall-through
   L_0207703C: ; // 0x207703c
@@ -16076,9 +16076,9 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 02077060 */ _t77 = cpu->r[6] + 0x00000000u;
         /* 02077060 */ cpu->r[10] = rbrew_read8(cpu->mem, _t77);
         /* 02077064 */ cpu->r[11] = 0x00000000u;
-        /* 02077068 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[7]);
+        /* 02077068 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[7]));
         /* 0207706C */ cpu->r[9] = 0x00080000u;
-        /* 02077070 */ _t78 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077070 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077070 */ _t79 = _t78 & 0x00000001u;
         /* 02077070 */ if (_t79) goto L_02077074; else goto L_02077108;
   L_02077074: ; // 0x2077074
@@ -16086,8 +16086,8 @@ void Gambit_fn_02076E00(CPUState* cpu) {
   L_02077078: ; // 0x2077078
         /* 02077078 */ _t80 = cpu->r[20] + 0xFFFFEE14u;
         /* 02077078 */ cpu->r[0] = rbrew_read32(cpu->mem, _t80);
-        /* 0207707C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02077080 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207707C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02077080 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077080 */ _t82 = _t81 & 0x00000001u;
         /* 02077080 */ if (_t82) goto L_02077084; else goto L_020770BC;
   L_02077084: ; // 0x2077084
@@ -16096,8 +16096,8 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 0207708C */ Gambit_fn_02836FFC(cpu);
         /* 02077090 */ _t83 = cpu->r[20] + 0xFFFFEE14u;
         /* 02077090 */ cpu->r[0] = rbrew_read32(cpu->mem, _t83);
-        /* 02077094 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02077098 */ _t84 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077094 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02077098 */ _t84 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077098 */ _t85 = _t84 & 0x00000001u;
         /* 02077098 */ if (_t85) goto L_0207709C; else goto L_020770B0;
   L_0207709C: ; // 0x207709c
@@ -16118,7 +16118,7 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 020770C4 */ _t88 = cpu->r[7] + cpu->r[0];
         /* 020770C4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t88);
         /* 020770C8 */ cpu->r[4] = cpu->r[28] + 0xFFFFAE4Cu;
-        /* 020770CC */ _t89 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020770CC */ _t89 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020770CC */ _t90 = _t89 & 0x00000001u;
         /* 020770CC */ if (_t90) goto L_020770D0; // else: addr-0 trap, fall-through
   L_020770D0: ; // 0x20770d0
@@ -16137,29 +16137,29 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 020770F4 */ _t94 = cpu->r[6] + 0x00000000u;
         /* 020770F4 */ cpu->r[10] = rbrew_read8(cpu->mem, _t94);
         /* 020770F8 */ cpu->r[11] = 0x00000000u;
-        /* 020770FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[7]);
+        /* 020770FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[7]));
         /* 02077100 */ cpu->r[9] = 0x00080000u;
-        /* 02077104 */ _t95 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077104 */ _t95 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077104 */ _t96 = _t95 & 0x00000001u;
         /* 02077104 */ if (_t96) goto L_02077124; else goto L_02077108;
   L_02077108: ; // 0x2077108
         /* 02077108 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 0207710C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], cpu->r[9]);
+        /* 0207710C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], cpu->r[9]));
         /* 02077110 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 02077114 */ _t97 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02077114 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02077114 */ _t98 = _t97 & 0x00000001u;
         /* 02077114 */ if (_t98) goto L_020771D8; else goto L_02077118;
   L_02077118: ; // 0x2077118
         /* 02077118 */ _t99 = cpu->r[6] + 0x00000000u;
         /* 02077118 */ cpu->r[0] = rbrew_read8(cpu->mem, _t99);
-        /* 0207711C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
-        /* 02077120 */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207711C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
+        /* 02077120 */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077120 */ _t101 = _t100 & 0x00000001u;
         /* 02077120 */ if (_t101) goto L_02077124; else goto L_02077108;
   L_02077124: ; // 0x2077124
         /* 02077124 */ cpu->r[16] = cpu->r[11];
-        /* 02077124 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[16], 0x00000000u);
-        /* 02077128 */ _t102 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077124 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[16], 0x00000000u));
+        /* 02077128 */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077128 */ _t103 = _t102 & 0x00000001u;
         /* 02077128 */ if (_t103) goto L_020771D8; else goto L_0207712C;
   L_0207712C: ; // 0x207712c
@@ -16179,23 +16179,23 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 02077150 */ _t108 = cpu->r[7] + 0x00000000u;
         /* 02077150 */ cpu->r[6] = rbrew_read8(cpu->mem, _t108);
         /* 02077154 */ cpu->r[11] = 0x00000000u;
-        /* 02077158 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[9]);
+        /* 02077158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[9]));
         /* 0207715C */ cpu->r[6] = 0x00080000u;
-        /* 02077160 */ _t109 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077160 */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077160 */ _t110 = _t109 & 0x00000001u;
         /* 02077160 */ if (_t110) goto L_02077198; else goto L_02077164;
   L_02077164: ; // 0x2077164
         /* 02077164 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 02077168 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], cpu->r[6]);
+        /* 02077168 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], cpu->r[6]));
         /* 0207716C */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02077170 */ _t111 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02077170 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02077170 */ _t112 = _t111 & 0x00000001u;
         /* 02077170 */ if (_t112) goto L_02077188; else goto L_02077174;
   L_02077174: ; // 0x2077174
         /* 02077174 */ _t113 = cpu->r[7] + 0x00000000u;
         /* 02077174 */ cpu->r[0] = rbrew_read8(cpu->mem, _t113);
-        /* 02077178 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[9]);
-        /* 0207717C */ _t114 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[9]));
+        /* 0207717C */ _t114 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207717C */ _t115 = _t114 & 0x00000001u;
         /* 0207717C */ if (_t115) goto L_02077180; else goto L_02077164;
   L_02077180: ; // 0x2077180
@@ -16203,8 +16203,8 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 02077184 */ goto L_0207719C;
   L_02077188: ; // 0x2077188
         /* 02077188 */ cpu->r[0] = 0x00000000u;
-        /* 0207718C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[16]);
-        /* 02077190 */ _t116 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207718C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[16]));
+        /* 02077190 */ _t116 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02077190 */ _t117 = _t116 & 0x00000001u;
         /* 02077190 */ if (_t117) goto L_020771E8; else goto L_02077194;
   L_02077194: ; // 0x2077194
@@ -16212,16 +16212,16 @@ void Gambit_fn_02076E00(CPUState* cpu) {
   L_02077198: ; // 0x2077198
         /* 02077198 */ cpu->r[0] = cpu->r[11];
   L_0207719C: ; // 0x207719c
-        /* 0207719C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[16]);
-        /* 020771A0 */ _t118 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207719C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[16]));
+        /* 020771A0 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020771A0 */ _t119 = _t118 & 0x00000001u;
         /* 020771A0 */ if (_t119) goto L_020771E8; else goto L_020771A4;
   L_020771A4: ; // 0x20771a4
         /* 020771A4 */ cpu->r[10] = cpu->r[16];
-        /* 020771A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 020771A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 020771A8 */ cpu->r[4] = cpu->r[0] - cpu->r[16];
         /* 020771AC */ cpu->r[12] = 0x00000000u;
-        /* 020771B0 */ _t120 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020771B0 */ _t120 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020771B0 */ _t121 = _t120 & 0x00000001u;
         /* 020771B0 */ if (_t121) goto L_020771B4; else goto L_020771D8;
   L_020771B4: ; // 0x20771b4
@@ -16234,8 +16234,8 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 020771C0 */ cpu->r[11] = _t122;
         /* 020771C4 */ _t123 = cpu->r[18] + cpu->r[12];
         /* 020771C4 */ cpu->r[9] = rbrew_read8(cpu->mem, _t123);
-        /* 020771C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[9]);
-        /* 020771CC */ _t124 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020771C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[9]));
+        /* 020771CC */ _t124 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020771CC */ _t125 = _t124 & 0x00000001u;
         /* 020771CC */ if (_t125) goto L_020771D0; else goto L_020771E8;
   L_020771D0: ; // 0x20771d0
@@ -16255,16 +16255,16 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 020771E4 */ rbrew_write32(cpu->mem, _t131, cpu->r[4]);
   L_020771E8: ; // 0x20771e8
         /* 020771E8 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 020771E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020771E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020771EC */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 020771F0 */ _t132 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020771F0 */ _t132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020771F0 */ _t133 = _t132 & 0x00000001u;
         /* 020771F0 */ if (_t133) goto L_020771F4; else goto L_02076FEC;
   L_020771F4: ; // 0x20771f4
         /* 020771F4 */ _t134 = cpu->r[1] + 0x0000000Du;
         /* 020771F4 */ cpu->r[10] = rbrew_read8(cpu->mem, _t134);
-        /* 020771F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020771FC */ _t135 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020771F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020771FC */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020771FC */ _t136 = _t135 & 0x00000001u;
         /* 020771FC */ if (_t136) goto L_02077200; else goto L_0207746C;
   L_02077200: ; // 0x2077200
@@ -16284,9 +16284,9 @@ void Gambit_fn_02076E00(CPUState* cpu) {
   L_02077230: ; // 0x2077230
         /* 02077230 */ _t138 = cpu->r[20] + 0x00000000u;
         /* 02077230 */ cpu->r[11] = rbrew_read32(cpu->mem, _t138);
-        /* 02077234 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02077234 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02077238 */ cpu->r[27] = cpu->r[28];
-        /* 0207723C */ _t139 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207723C */ _t139 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207723C */ _t140 = _t139 & 0x00000001u;
         /* 0207723C */ if (_t140) goto L_02077240; else goto L_02077254;
   L_02077240: ; // 0x2077240
@@ -16299,8 +16299,8 @@ void Gambit_fn_02076E00(CPUState* cpu) {
   L_02077254: ; // 0x2077254
         /* 02077254 */ _t142 = cpu->r[19] + 0x00000000u;
         /* 02077254 */ cpu->r[12] = rbrew_read32(cpu->mem, _t142);
-        /* 02077258 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0207725C */ _t143 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077258 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0207725C */ _t143 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207725C */ _t144 = _t143 & 0x00000001u;
         /* 0207725C */ if (_t144) goto L_02077260; else goto L_02077268;
   L_02077260: ; // 0x2077260
@@ -16309,15 +16309,15 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 02077264 */ _t146 = cpu->r[19] + 0x00000000u;
         /* 02077264 */ rbrew_write32(cpu->mem, _t146, cpu->r[23]);
   L_02077268: ; // 0x2077268
-        /* 02077268 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000007u);
-        /* 0207726C */ _t147 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02077268 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000007u));
+        /* 0207726C */ _t147 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207726C */ _t148 = _t147 & 0x00000001u;
         /* 0207726C */ if (_t148) goto L_020772BC; else goto L_02077270;
   L_02077270: ; // 0x2077270
         /* 02077270 */ cpu->r[5] = 0x00000000u;
         /* 02077274 */ cpu->r[3] = cpu->r[1] + 0x0000001Cu;
         /* 02077278 */ cpu->r[4] = cpu->r[26] + 0xFFFFAE50u;
-        /* 0207727C */ _t149 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0207727C */ _t149 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0207727C */ _t150 = _t149 & 0x00000001u;
         /* 0207727C */ if (_t150) goto L_02077280; // else: addr-0 trap, fall-through
   L_02077280: ; // 0x2077280
@@ -16336,9 +16336,9 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 020772A4 */ _t154 = cpu->r[11] + 0x00000000u;
         /* 020772A4 */ cpu->r[9] = rbrew_read8(cpu->mem, _t154);
         /* 020772A8 */ cpu->r[8] = 0x00000000u;
-        /* 020772AC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[5]);
+        /* 020772AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[5]));
         /* 020772B0 */ cpu->r[4] = 0x00080000u;
-        /* 020772B4 */ _t155 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020772B4 */ _t155 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020772B4 */ _t156 = _t155 & 0x00000001u;
         /* 020772B4 */ if (_t156) goto L_020772B8; else goto L_0207734C;
   L_020772B8: ; // 0x20772b8
@@ -16346,8 +16346,8 @@ void Gambit_fn_02076E00(CPUState* cpu) {
   L_020772BC: ; // 0x20772bc
         /* 020772BC */ _t157 = cpu->r[18] + 0x00000000u;
         /* 020772BC */ cpu->r[5] = rbrew_read32(cpu->mem, _t157);
-        /* 020772C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 020772C4 */ _t158 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020772C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 020772C4 */ _t158 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020772C4 */ _t159 = _t158 & 0x00000001u;
         /* 020772C4 */ if (_t159) goto L_020772C8; else goto L_02077300;
   L_020772C8: ; // 0x20772c8
@@ -16356,8 +16356,8 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 020772D0 */ Gambit_fn_02836FFC(cpu);
         /* 020772D4 */ _t160 = cpu->r[18] + 0x00000000u;
         /* 020772D4 */ cpu->r[4] = rbrew_read32(cpu->mem, _t160);
-        /* 020772D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020772DC */ _t161 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020772D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020772DC */ _t161 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020772DC */ _t162 = _t161 & 0x00000001u;
         /* 020772DC */ if (_t162) goto L_020772E0; else goto L_020772F4;
   L_020772E0: ; // 0x20772e0
@@ -16378,7 +16378,7 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 02077308 */ _t165 = cpu->r[6] + cpu->r[5];
         /* 02077308 */ cpu->r[5] = rbrew_read32(cpu->mem, _t165);
         /* 0207730C */ cpu->r[4] = cpu->r[26] + 0xFFFFAE50u;
-        /* 02077310 */ _t166 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02077310 */ _t166 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02077310 */ _t167 = _t166 & 0x00000001u;
         /* 02077310 */ if (_t167) goto L_02077314; // else: addr-0 trap, fall-through
   L_02077314: ; // 0x2077314
@@ -16397,29 +16397,29 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 02077338 */ _t171 = cpu->r[11] + 0x00000000u;
         /* 02077338 */ cpu->r[9] = rbrew_read8(cpu->mem, _t171);
         /* 0207733C */ cpu->r[8] = 0x00000000u;
-        /* 02077340 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[5]);
+        /* 02077340 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[5]));
         /* 02077344 */ cpu->r[4] = 0x00080000u;
-        /* 02077348 */ _t172 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077348 */ _t172 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077348 */ _t173 = _t172 & 0x00000001u;
         /* 02077348 */ if (_t173) goto L_02077368; else goto L_0207734C;
   L_0207734C: ; // 0x207734c
         /* 0207734C */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 02077350 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], cpu->r[4]);
+        /* 02077350 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], cpu->r[4]));
         /* 02077354 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 02077358 */ _t174 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02077358 */ _t174 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02077358 */ _t175 = _t174 & 0x00000001u;
         /* 02077358 */ if (_t175) goto L_02077410; else goto L_0207735C;
   L_0207735C: ; // 0x207735c
         /* 0207735C */ _t176 = cpu->r[11] + 0x00000000u;
         /* 0207735C */ cpu->r[0] = rbrew_read8(cpu->mem, _t176);
-        /* 02077360 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[5]);
-        /* 02077364 */ _t177 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077360 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[5]));
+        /* 02077364 */ _t177 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077364 */ _t178 = _t177 & 0x00000001u;
         /* 02077364 */ if (_t178) goto L_02077368; else goto L_0207734C;
   L_02077368: ; // 0x2077368
         /* 02077368 */ cpu->r[15] = cpu->r[8];
-        /* 02077368 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[15], 0x00000000u);
-        /* 0207736C */ _t179 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077368 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[15], 0x00000000u));
+        /* 0207736C */ _t179 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207736C */ _t180 = _t179 & 0x00000001u;
         /* 0207736C */ if (_t180) goto L_02077410; else goto L_02077370;
   L_02077370: ; // 0x2077370
@@ -16441,23 +16441,23 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 02077398 */ _t186 = cpu->r[9] + 0x00000000u;
         /* 02077398 */ cpu->r[5] = rbrew_read8(cpu->mem, _t186);
         /* 0207739C */ cpu->r[8] = 0x00000000u;
-        /* 020773A0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[6]);
+        /* 020773A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[6]));
         /* 020773A4 */ cpu->r[10] = 0x00080000u;
-        /* 020773A8 */ _t187 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020773A8 */ _t187 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020773A8 */ _t188 = _t187 & 0x00000001u;
         /* 020773A8 */ if (_t188) goto L_020773D0; else goto L_020773AC;
   L_020773AC: ; // 0x20773ac
         /* 020773AC */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 020773B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], cpu->r[10]);
+        /* 020773B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], cpu->r[10]));
         /* 020773B4 */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 020773B8 */ _t189 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020773B8 */ _t189 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020773B8 */ _t190 = _t189 & 0x00000001u;
         /* 020773B8 */ if (_t190) goto L_020773CC; else goto L_020773BC;
   L_020773BC: ; // 0x20773bc
         /* 020773BC */ _t191 = cpu->r[9] + 0x00000000u;
         /* 020773BC */ cpu->r[7] = rbrew_read8(cpu->mem, _t191);
-        /* 020773C0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[6]);
-        /* 020773C4 */ _t192 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020773C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[6]));
+        /* 020773C4 */ _t192 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020773C4 */ _t193 = _t192 & 0x00000001u;
         /* 020773C4 */ if (_t193) goto L_020773C8; else goto L_020773AC;
   L_020773C8: ; // 0x20773c8
@@ -16465,16 +16465,16 @@ void Gambit_fn_02076E00(CPUState* cpu) {
   L_020773CC: ; // 0x20773cc
         /* 020773CC */ cpu->r[8] = 0x00000000u;
   L_020773D0: ; // 0x20773d0
-        /* 020773D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], cpu->r[15]);
-        /* 020773D4 */ _t194 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020773D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], cpu->r[15]));
+        /* 020773D4 */ _t194 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020773D4 */ _t195 = _t194 & 0x00000001u;
         /* 020773D4 */ if (_t195) goto L_0207745C; else goto L_020773D8;
   L_020773D8: ; // 0x20773d8
         /* 020773D8 */ cpu->r[0] = cpu->r[15];
-        /* 020773D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020773D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020773DC */ cpu->r[7] = cpu->r[8] - cpu->r[15];
         /* 020773E0 */ cpu->r[8] = 0x00000000u;
-        /* 020773E4 */ _t196 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020773E4 */ _t196 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020773E4 */ _t197 = _t196 & 0x00000001u;
         /* 020773E4 */ if (_t197) goto L_020773E8; else goto L_02077410;
   L_020773E8: ; // 0x20773e8
@@ -16489,8 +16489,8 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 020773F8 */ cpu->r[6] = _t199;
         /* 020773FC */ _t200 = cpu->r[16] + cpu->r[8];
         /* 020773FC */ cpu->r[10] = rbrew_read8(cpu->mem, _t200);
-        /* 02077400 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[10]);
-        /* 02077404 */ _t201 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077400 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[10]));
+        /* 02077404 */ _t201 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077404 */ _t202 = _t201 & 0x00000001u;
         /* 02077404 */ if (_t202) goto L_02077408; else goto L_0207745C;
   L_02077408: ; // 0x2077408
@@ -16525,18 +16525,18 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 02077444 */ _t214 = cpu->r[7] + 0x00000000u;
         /* 02077444 */ cpu->r[4] = rbrew_read8(cpu->mem, _t214);
         /* 02077448 */ cpu->r[31] = 0x00000000u;
-        /* 0207744C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
+        /* 0207744C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
         /* 02077450 */ cpu->r[0] = 0x00080000u;
-        /* 02077454 */ _t215 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077454 */ _t215 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077454 */ _t216 = _t215 & 0x00000001u;
         /* 02077454 */ if (_t216) goto L_02077458; else goto L_020774A8;
   L_02077458: ; // 0x2077458
         /* 02077458 */ goto L_020774C4;
   L_0207745C: ; // 0x207745c
         /* 0207745C */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 0207745C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0207745C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02077460 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
-        /* 02077464 */ _t217 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077464 */ _t217 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077464 */ _t218 = _t217 & 0x00000001u;
         /* 02077464 */ if (_t218) goto L_02077468; else goto L_02077230;
   L_02077468: ; // 0x2077468
@@ -16561,28 +16561,28 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 02077494 */ _t225 = cpu->r[7] + 0x00000000u;
         /* 02077494 */ cpu->r[4] = rbrew_read8(cpu->mem, _t225);
         /* 02077498 */ cpu->r[31] = 0x00000000u;
-        /* 0207749C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
+        /* 0207749C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
         /* 020774A0 */ cpu->r[0] = 0x00080000u;
-        /* 020774A4 */ _t226 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020774A4 */ _t226 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020774A4 */ _t227 = _t226 & 0x00000001u;
         /* 020774A4 */ if (_t227) goto L_020774C4; else goto L_020774A8;
   L_020774A8: ; // 0x20774a8
         /* 020774A8 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020774AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 020774AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 020774B0 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 020774B4 */ _t228 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020774B4 */ _t228 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020774B4 */ _t229 = _t228 & 0x00000001u;
         /* 020774B4 */ if (_t229) goto L_02077560; else goto L_020774B8;
   L_020774B8: ; // 0x20774b8
         /* 020774B8 */ _t230 = cpu->r[7] + 0x00000000u;
         /* 020774B8 */ cpu->r[5] = rbrew_read8(cpu->mem, _t230);
-        /* 020774BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[6]);
-        /* 020774C0 */ _t231 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020774BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[6]));
+        /* 020774C0 */ _t231 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020774C0 */ _t232 = _t231 & 0x00000001u;
         /* 020774C0 */ if (_t232) goto L_020774C4; else goto L_020774A8;
   L_020774C4: ; // 0x20774c4
-        /* 020774C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020774C8 */ _t233 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020774C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020774C8 */ _t233 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020774C8 */ _t234 = _t233 & 0x00000001u;
         /* 020774C8 */ if (_t234) goto L_02077560; else goto L_020774CC;
   L_020774CC: ; // 0x20774cc
@@ -16602,23 +16602,23 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 020774EC */ _t240 = cpu->r[12] + 0x00000000u;
         /* 020774EC */ cpu->r[10] = rbrew_read8(cpu->mem, _t240);
         /* 020774F0 */ cpu->r[4] = 0x00000000u;
-        /* 020774F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[11]);
+        /* 020774F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[11]));
         /* 020774F8 */ cpu->r[5] = 0x00080000u;
-        /* 020774FC */ _t241 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020774FC */ _t241 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020774FC */ _t242 = _t241 & 0x00000001u;
         /* 020774FC */ if (_t242) goto L_02077524; else goto L_02077500;
   L_02077500: ; // 0x2077500
         /* 02077500 */ cpu->r[4] = cpu->r[4] + 0x00000001u;
-        /* 02077504 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], cpu->r[5]);
+        /* 02077504 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], cpu->r[5]));
         /* 02077508 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 0207750C */ _t243 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207750C */ _t243 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207750C */ _t244 = _t243 & 0x00000001u;
         /* 0207750C */ if (_t244) goto L_02077520; else goto L_02077510;
   L_02077510: ; // 0x2077510
         /* 02077510 */ _t245 = cpu->r[12] + 0x00000000u;
         /* 02077510 */ cpu->r[0] = rbrew_read8(cpu->mem, _t245);
-        /* 02077514 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[11]);
-        /* 02077518 */ _t246 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077514 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[11]));
+        /* 02077518 */ _t246 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077518 */ _t247 = _t246 & 0x00000001u;
         /* 02077518 */ if (_t247) goto L_0207751C; else goto L_02077500;
   L_0207751C: ; // 0x207751c
@@ -16626,15 +16626,15 @@ void Gambit_fn_02076E00(CPUState* cpu) {
   L_02077520: ; // 0x2077520
         /* 02077520 */ cpu->r[4] = 0x00000000u;
   L_02077524: ; // 0x2077524
-        /* 02077524 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], cpu->r[31]);
-        /* 02077528 */ _t248 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02077524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], cpu->r[31]));
+        /* 02077528 */ _t248 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02077528 */ _t249 = _t248 & 0x00000001u;
         /* 02077528 */ if (_t249) goto L_02077568; else goto L_0207752C;
   L_0207752C: ; // 0x207752c
-        /* 0207752C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0207752C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02077530 */ cpu->r[9] = 0x00000000u;
         /* 02077534 */ cpu->r[0] = cpu->r[4] - cpu->r[31];
-        /* 02077538 */ _t250 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02077538 */ _t250 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02077538 */ _t251 = _t250 & 0x00000001u;
         /* 02077538 */ if (_t251) goto L_0207753C; else goto L_02077560;
   L_0207753C: ; // 0x207753c
@@ -16647,8 +16647,8 @@ void Gambit_fn_02076E00(CPUState* cpu) {
         /* 02077548 */ cpu->r[10] = _t252;
         /* 0207754C */ _t253 = cpu->r[28] + cpu->r[9];
         /* 0207754C */ cpu->r[5] = rbrew_read8(cpu->mem, _t253);
-        /* 02077550 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[5]);
-        /* 02077554 */ _t254 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077550 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[5]));
+        /* 02077554 */ _t254 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077554 */ _t255 = _t254 & 0x00000001u;
         /* 02077554 */ if (_t255) goto L_02077558; else goto L_02077568;
   L_02077558: ; // 0x2077558
@@ -16665,8 +16665,8 @@ void Gambit_fn_02076E00(CPUState* cpu) {
   L_02077568: ; // 0x2077568
         /* 02077568 */ _t260 = cpu->r[29] + 0x00000000u;
         /* 02077568 */ cpu->r[0] = rbrew_read8(cpu->mem, _t260);
-        /* 0207756C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02077570 */ _t261 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207756C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02077570 */ _t261 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077570 */ _t262 = _t261 & 0x00000001u;
         /* 02077570 */ if (_t262) goto L_02077584; else goto L_02077574;
   L_02077574: ; // 0x2077574
@@ -16786,9 +16786,9 @@ void Gambit_fn_02077598(CPUState* cpu) {
         /* 02077694 */ cpu->r[7] = rbrew_read32(cpu->mem, _t29);
         /* 02077698 */ _t30 = cpu->r[20] + 0x00000000u;
         /* 02077698 */ cpu->r[16] = rbrew_read32(cpu->mem, _t30);
-        /* 0207769C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0207769C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 020776A0 */ cpu->r[15] = cpu->r[30];
-        /* 020776A4 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020776A4 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020776A4 */ _t32 = _t31 & 0x00000001u;
         /* 020776A4 */ if (_t32) goto L_020776A8; else goto L_020776BC;
   L_020776A8: ; // 0x20776a8
@@ -16801,8 +16801,8 @@ void Gambit_fn_02077598(CPUState* cpu) {
   L_020776BC: ; // 0x20776bc
         /* 020776BC */ _t34 = cpu->r[23] + 0xFFFFE374u;
         /* 020776BC */ cpu->r[8] = rbrew_read32(cpu->mem, _t34);
-        /* 020776C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 020776C4 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020776C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 020776C4 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020776C4 */ _t36 = _t35 & 0x00000001u;
         /* 020776C4 */ if (_t36) goto L_020776C8; else goto L_020776D0;
   L_020776C8: ; // 0x20776c8
@@ -16811,8 +16811,8 @@ void Gambit_fn_02077598(CPUState* cpu) {
         /* 020776CC */ _t38 = cpu->r[23] + 0xFFFFE374u;
         /* 020776CC */ rbrew_write32(cpu->mem, _t38, cpu->r[27]);
   L_020776D0: ; // 0x20776d0
-        /* 020776D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[15], 0x00000007u);
-        /* 020776D4 */ _t39 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020776D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[15], 0x00000007u));
+        /* 020776D4 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020776D4 */ _t40 = _t39 & 0x00000001u;
         /* 020776D4 */ if (_t40) goto L_02077720; else goto L_020776D8;
   L_020776D8: ; // 0x20776d8
@@ -16820,7 +16820,7 @@ void Gambit_fn_02077598(CPUState* cpu) {
         /* 020776DC */ cpu->r[3] = cpu->r[1] + 0x0000001Cu;
         /* 020776E0 */ cpu->r[4] = cpu->r[29] + 0xFFFFAE5Cu;
         /* 020776E4 */ cpu->r[5] = cpu->r[16];
-        /* 020776E8 */ _t41 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020776E8 */ _t41 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020776E8 */ _t42 = _t41 & 0x00000001u;
         /* 020776E8 */ if (_t42) goto L_020776EC; // else: addr-0 trap, fall-through
   L_020776EC: ; // 0x20776ec
@@ -16838,8 +16838,8 @@ void Gambit_fn_02077598(CPUState* cpu) {
         /* 0207770C */ Gambit_fn_027FD390(cpu);
         /* 02077710 */ _t46 = cpu->r[1] + 0x00000050u;
         /* 02077710 */ cpu->r[0] = rbrew_read8(cpu->mem, _t46);
-        /* 02077714 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02077718 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077714 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02077718 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077718 */ _t48 = _t47 & 0x00000001u;
         /* 02077718 */ if (_t48) goto L_020777F0; else goto L_0207771C;
   L_0207771C: ; // 0x207771c
@@ -16847,8 +16847,8 @@ void Gambit_fn_02077598(CPUState* cpu) {
   L_02077720: ; // 0x2077720
         /* 02077720 */ _t49 = cpu->r[21] + 0xFFFFEE14u;
         /* 02077720 */ cpu->r[12] = rbrew_read32(cpu->mem, _t49);
-        /* 02077724 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02077728 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077724 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02077728 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077728 */ _t51 = _t50 & 0x00000001u;
         /* 02077728 */ if (_t51) goto L_0207772C; else goto L_02077764;
   L_0207772C: ; // 0x207772c
@@ -16857,8 +16857,8 @@ void Gambit_fn_02077598(CPUState* cpu) {
         /* 02077734 */ Gambit_fn_02836FFC(cpu);
         /* 02077738 */ _t52 = cpu->r[21] + 0xFFFFEE14u;
         /* 02077738 */ cpu->r[11] = rbrew_read32(cpu->mem, _t52);
-        /* 0207773C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02077740 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207773C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02077740 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077740 */ _t54 = _t53 & 0x00000001u;
         /* 02077740 */ if (_t54) goto L_02077744; else goto L_02077758;
   L_02077744: ; // 0x2077744
@@ -16880,7 +16880,7 @@ void Gambit_fn_02077598(CPUState* cpu) {
         /* 0207776C */ cpu->r[6] = rbrew_read32(cpu->mem, _t57);
         /* 02077770 */ cpu->r[5] = cpu->r[16];
         /* 02077774 */ cpu->r[4] = cpu->r[29] + 0xFFFFAE5Cu;
-        /* 02077778 */ _t58 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02077778 */ _t58 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02077778 */ _t59 = _t58 & 0x00000001u;
         /* 02077778 */ if (_t59) goto L_0207777C; // else: addr-0 trap, fall-through
   L_0207777C: ; // 0x207777c
@@ -16898,8 +16898,8 @@ void Gambit_fn_02077598(CPUState* cpu) {
         /* 0207779C */ Gambit_fn_027FD390(cpu);
         /* 020777A0 */ _t63 = cpu->r[1] + 0x00000050u;
         /* 020777A0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t63);
-        /* 020777A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020777A8 */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020777A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020777A8 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020777A8 */ _t65 = _t64 & 0x00000001u;
         /* 020777A8 */ if (_t65) goto L_020777F0; else goto L_020777AC;
   L_020777AC: ; // 0x20777ac
@@ -16924,18 +16924,18 @@ void Gambit_fn_02077598(CPUState* cpu) {
         /* 020777D8 */ _t73 = cpu->r[4] + 0x00000000u;
         /* 020777D8 */ cpu->r[7] = rbrew_read8(cpu->mem, _t73);
         /* 020777DC */ cpu->r[6] = 0x00080000u;
-        /* 020777E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[0]);
+        /* 020777E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[0]));
         /* 020777E4 */ cpu->r[29] = 0x00000000u;
-        /* 020777E8 */ _t74 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020777E8 */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020777E8 */ _t75 = _t74 & 0x00000001u;
         /* 020777E8 */ if (_t75) goto L_020777EC; else goto L_020779B4;
   L_020777EC: ; // 0x20777ec
         /* 020777EC */ goto L_020779D8;
   L_020777F0: ; // 0x20777f0
         /* 020777F0 */ cpu->r[18] = cpu->r[18] + 0xFFFFFFFFu;
-        /* 020777F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[18], 0x00000000u);
+        /* 020777F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[18], 0x00000000u));
         /* 020777F4 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020777F8 */ _t76 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020777F8 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020777F8 */ _t77 = _t76 & 0x00000001u;
         /* 020777F8 */ if (_t77) goto L_020777FC; else goto L_02077680;
   L_020777FC: ; // 0x20777fc
@@ -16961,9 +16961,9 @@ void Gambit_fn_02077598(CPUState* cpu) {
         /* 02077838 */ cpu->r[0] = rbrew_read32(cpu->mem, _t80);
         /* 0207783C */ _t81 = cpu->r[20] + 0x00000000u;
         /* 0207783C */ cpu->r[29] = rbrew_read32(cpu->mem, _t81);
-        /* 02077840 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02077840 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02077844 */ cpu->r[30] = cpu->r[28];
-        /* 02077848 */ _t82 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077848 */ _t82 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077848 */ _t83 = _t82 & 0x00000001u;
         /* 02077848 */ if (_t83) goto L_0207784C; else goto L_02077860;
   L_0207784C: ; // 0x207784c
@@ -16976,8 +16976,8 @@ void Gambit_fn_02077598(CPUState* cpu) {
   L_02077860: ; // 0x2077860
         /* 02077860 */ _t85 = cpu->r[21] + 0x00000000u;
         /* 02077860 */ cpu->r[10] = rbrew_read32(cpu->mem, _t85);
-        /* 02077864 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02077868 */ _t86 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077864 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02077868 */ _t86 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077868 */ _t87 = _t86 & 0x00000001u;
         /* 02077868 */ if (_t87) goto L_0207786C; else goto L_02077874;
   L_0207786C: ; // 0x207786c
@@ -16986,8 +16986,8 @@ void Gambit_fn_02077598(CPUState* cpu) {
         /* 02077870 */ _t89 = cpu->r[21] + 0x00000000u;
         /* 02077870 */ rbrew_write32(cpu->mem, _t89, cpu->r[26]);
   L_02077874: ; // 0x2077874
-        /* 02077874 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000007u);
-        /* 02077878 */ _t90 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02077874 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000007u));
+        /* 02077878 */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02077878 */ _t91 = _t90 & 0x00000001u;
         /* 02077878 */ if (_t91) goto L_020778C4; else goto L_0207787C;
   L_0207787C: ; // 0x207787c
@@ -16995,7 +16995,7 @@ void Gambit_fn_02077598(CPUState* cpu) {
         /* 02077880 */ cpu->r[3] = cpu->r[1] + 0x0000001Cu;
         /* 02077884 */ cpu->r[4] = cpu->r[16] + 0xFFFFAE68u;
         /* 02077888 */ cpu->r[5] = cpu->r[29];
-        /* 0207788C */ _t92 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0207788C */ _t92 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0207788C */ _t93 = _t92 & 0x00000001u;
         /* 0207788C */ if (_t93) goto L_02077890; // else: addr-0 trap, fall-through
   L_02077890: ; // 0x2077890
@@ -17013,8 +17013,8 @@ void Gambit_fn_02077598(CPUState* cpu) {
         /* 020778B0 */ Gambit_fn_027FD390(cpu);
         /* 020778B4 */ _t97 = cpu->r[1] + 0x00000050u;
         /* 020778B4 */ cpu->r[11] = rbrew_read8(cpu->mem, _t97);
-        /* 020778B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020778BC */ _t98 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020778B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020778BC */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020778BC */ _t99 = _t98 & 0x00000001u;
         /* 020778BC */ if (_t99) goto L_02077994; else goto L_020778C0;
   L_020778C0: ; // 0x20778c0
@@ -17022,8 +17022,8 @@ void Gambit_fn_02077598(CPUState* cpu) {
   L_020778C4: ; // 0x20778c4
         /* 020778C4 */ _t100 = cpu->r[18] + 0x00000000u;
         /* 020778C4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t100);
-        /* 020778C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020778CC */ _t101 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020778C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020778CC */ _t101 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020778CC */ _t102 = _t101 & 0x00000001u;
         /* 020778CC */ if (_t102) goto L_020778D0; else goto L_02077908;
   L_020778D0: ; // 0x20778d0
@@ -17032,8 +17032,8 @@ void Gambit_fn_02077598(CPUState* cpu) {
         /* 020778D8 */ Gambit_fn_02836FFC(cpu);
         /* 020778DC */ _t103 = cpu->r[18] + 0x00000000u;
         /* 020778DC */ cpu->r[11] = rbrew_read32(cpu->mem, _t103);
-        /* 020778E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020778E4 */ _t104 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020778E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020778E4 */ _t104 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020778E4 */ _t105 = _t104 & 0x00000001u;
         /* 020778E4 */ if (_t105) goto L_020778E8; else goto L_020778FC;
   L_020778E8: ; // 0x20778e8
@@ -17055,7 +17055,7 @@ void Gambit_fn_02077598(CPUState* cpu) {
         /* 02077910 */ cpu->r[6] = rbrew_read32(cpu->mem, _t108);
         /* 02077914 */ cpu->r[4] = cpu->r[16] + 0xFFFFAE68u;
         /* 02077918 */ cpu->r[5] = cpu->r[29];
-        /* 0207791C */ _t109 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0207791C */ _t109 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0207791C */ _t110 = _t109 & 0x00000001u;
         /* 0207791C */ if (_t110) goto L_02077920; // else: addr-0 trap, fall-through
   L_02077920: ; // 0x2077920
@@ -17073,8 +17073,8 @@ void Gambit_fn_02077598(CPUState* cpu) {
         /* 02077940 */ Gambit_fn_027FD390(cpu);
         /* 02077944 */ _t114 = cpu->r[1] + 0x00000050u;
         /* 02077944 */ cpu->r[11] = rbrew_read8(cpu->mem, _t114);
-        /* 02077948 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0207794C */ _t115 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077948 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0207794C */ _t115 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207794C */ _t116 = _t115 & 0x00000001u;
         /* 0207794C */ if (_t116) goto L_02077994; else goto L_02077950;
   L_02077950: ; // 0x2077950
@@ -17099,18 +17099,18 @@ void Gambit_fn_02077598(CPUState* cpu) {
         /* 0207797C */ _t124 = cpu->r[4] + 0x00000000u;
         /* 0207797C */ cpu->r[7] = rbrew_read8(cpu->mem, _t124);
         /* 02077980 */ cpu->r[6] = 0x00080000u;
-        /* 02077984 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[0]);
+        /* 02077984 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[0]));
         /* 02077988 */ cpu->r[29] = 0x00000000u;
-        /* 0207798C */ _t125 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207798C */ _t125 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207798C */ _t126 = _t125 & 0x00000001u;
         /* 0207798C */ if (_t126) goto L_020777EC; else goto L_02077990;
   L_02077990: ; // 0x2077990
         /* 02077990 */ goto L_020779B4;
   L_02077994: ; // 0x2077994
         /* 02077994 */ cpu->r[17] = cpu->r[17] + 0xFFFFFFFFu;
-        /* 02077994 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[17], 0x00000000u);
+        /* 02077994 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[17], 0x00000000u));
         /* 02077998 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
-        /* 0207799C */ _t127 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207799C */ _t127 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207799C */ _t128 = _t127 & 0x00000001u;
         /* 0207799C */ if (_t128) goto L_020779A0; else goto L_02077824;
   L_020779A0: ; // 0x20779a0
@@ -17122,16 +17122,16 @@ void Gambit_fn_02077598(CPUState* cpu) {
         /* 020779B0 */ return;
   L_020779B4: ; // 0x20779b4
         /* 020779B4 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 020779B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[6]);
+        /* 020779B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[6]));
         /* 020779BC */ cpu->r[4] = cpu->r[4] + 0x00000001u;
-        /* 020779C0 */ _t130 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020779C0 */ _t130 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020779C0 */ _t131 = _t130 & 0x00000001u;
         /* 020779C0 */ if (_t131) goto L_020779D4; else goto L_020779C4;
   L_020779C4: ; // 0x20779c4
         /* 020779C4 */ _t132 = cpu->r[4] + 0x00000000u;
         /* 020779C4 */ cpu->r[8] = rbrew_read8(cpu->mem, _t132);
-        /* 020779C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[0]);
-        /* 020779CC */ _t133 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020779C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[0]));
+        /* 020779CC */ _t133 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020779CC */ _t134 = _t133 & 0x00000001u;
         /* 020779CC */ if (_t134) goto L_020779D0; else goto L_020779B4;
   L_020779D0: ; // 0x20779d0
@@ -17153,23 +17153,23 @@ void Gambit_fn_02077598(CPUState* cpu) {
         /* 020779F4 */ _t139 = cpu->r[10] + 0x00000000u;
         /* 020779F4 */ cpu->r[8] = rbrew_read8(cpu->mem, _t139);
         /* 020779F8 */ cpu->r[30] = 0x00000000u;
-        /* 020779FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[9]);
+        /* 020779FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[9]));
         /* 02077A00 */ cpu->r[12] = 0x00080000u;
-        /* 02077A04 */ _t140 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077A04 */ _t140 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077A04 */ _t141 = _t140 & 0x00000001u;
         /* 02077A04 */ if (_t141) goto L_02077A2C; else goto L_02077A08;
   L_02077A08: ; // 0x2077a08
         /* 02077A08 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02077A0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[12]);
+        /* 02077A0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[12]));
         /* 02077A10 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 02077A14 */ _t142 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02077A14 */ _t142 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02077A14 */ _t143 = _t142 & 0x00000001u;
         /* 02077A14 */ if (_t143) goto L_02077A28; else goto L_02077A18;
   L_02077A18: ; // 0x2077a18
         /* 02077A18 */ _t144 = cpu->r[10] + 0x00000000u;
         /* 02077A18 */ cpu->r[11] = rbrew_read8(cpu->mem, _t144);
-        /* 02077A1C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
-        /* 02077A20 */ _t145 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077A1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
+        /* 02077A20 */ _t145 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077A20 */ _t146 = _t145 & 0x00000001u;
         /* 02077A20 */ if (_t146) goto L_02077A24; else goto L_02077A08;
   L_02077A24: ; // 0x2077a24
@@ -17180,15 +17180,15 @@ void Gambit_fn_02077598(CPUState* cpu) {
         /* 02077A2C */ _t147 = cpu->r[14] + 0x00000458u;
         /* 02077A2C */ cpu->r[6] = rbrew_read32(cpu->mem, _t147);
         /* 02077A30 */ cpu->r[4] = cpu->r[6] + 0xFFFFFFFBu;
-        /* 02077A34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[4]);
-        /* 02077A38 */ _t148 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02077A34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[4]));
+        /* 02077A38 */ _t148 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02077A38 */ _t149 = _t148 & 0x00000001u;
         /* 02077A38 */ if (_t149) goto L_02077A40; else goto L_02077A3C;
   L_02077A3C: ; // 0x2077a3c
         /* 02077A3C */ cpu->r[30] = cpu->r[6] + 0xFFFFFFFAu;
   L_02077A40: ; // 0x2077a40
-        /* 02077A40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02077A44 */ _t150 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02077A40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02077A44 */ _t150 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02077A44 */ _t151 = _t150 & 0x00000001u;
         /* 02077A44 */ if (_t151) goto L_02077A48; else goto L_02077A8C;
   L_02077A48: ; // 0x2077a48
@@ -17207,8 +17207,8 @@ void Gambit_fn_02077598(CPUState* cpu) {
         /* 02077A6C */ cpu->r[3] = cpu->r[28];
         /* 02077A70 */ rbrew_dispatch(cpu, 0x02d0a6e8u);
         /* 02077A74 */ cpu->r[7] = cpu->r[30] + 0x00000005u;
-        /* 02077A78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], cpu->r[29]);
-        /* 02077A7C */ _t155 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02077A78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], cpu->r[29]));
+        /* 02077A7C */ _t155 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02077A7C */ _t156 = _t155 & 0x00000001u;
         /* 02077A7C */ if (_t156) goto L_02077A80; else goto L_02077A8C;
   L_02077A80: ; // 0x2077a80
@@ -17240,8 +17240,8 @@ void Gambit_fn_02077598(CPUState* cpu) {
         /* 02077ABC */ Gambit_fn_020A54C4(cpu);
         /* 02077AC0 */ _t166 = cpu->r[14] + 0x00000000u;
         /* 02077AC0 */ cpu->r[5] = rbrew_read8(cpu->mem, _t166);
-        /* 02077AC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 02077AC8 */ _t167 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077AC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 02077AC8 */ _t167 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077AC8 */ _t168 = _t167 & 0x00000001u;
         /* 02077AC8 */ if (_t168) goto L_02077ADC; else goto L_02077ACC;
   L_02077ACC: ; // 0x2077acc
@@ -17275,9 +17275,9 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 02077B04 */ cpu->r[8] = 0x101D0000u;
         /* 02077B08 */ _t3 = cpu->r[8] + 0xFFFF85A8u;
         /* 02077B08 */ cpu->r[8] = rbrew_read32(cpu->mem, _t3);
-        /* 02077B0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02077B0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02077B10 */ cpu->r[23] = 0x00000000u;
-        /* 02077B14 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077B14 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077B14 */ _t5 = _t4 & 0x00000001u;
         /* 02077B14 */ if (_t5) goto L_02077B1C; else goto L_02077B18;
   L_02077B18: ; // 0x2077b18
@@ -17287,8 +17287,8 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 02077B1C */ cpu->r[7] = 0x101C0000u;
         /* 02077B20 */ _t7 = cpu->r[7] + 0x00006BD0u;
         /* 02077B20 */ cpu->r[7] = rbrew_read32(cpu->mem, _t7);
-        /* 02077B24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 02077B28 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077B24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 02077B28 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077B28 */ _t9 = _t8 & 0x00000001u;
         /* 02077B28 */ if (_t9) goto L_02077B30; else goto L_02077B2C;
   L_02077B2C: ; // 0x2077b2c
@@ -17366,13 +17366,13 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 02077BE4 */ cpu->r[4] = rbrew_read32(cpu->mem, _t28);
         /* 02077BE8 */ cpu->r[5] = cpu->r[19];
         /* 02077BEC */ cpu->r[3] = cpu->r[1] + 0x0000002Cu;
-        /* 02077BF0 */ _t29 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02077BF0 */ _t29 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02077BF0 */ _t30 = _t29 & 0x00000001u;
         /* 02077BF0 */ if (_t30) goto L_02077BF4; // else: addr-0 trap, fall-through
   L_02077BF4: ; // 0x2077bf4
         /* 02077BF4 */ Gambit_fn_0282A5F4(cpu);
-        /* 02077BF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
-        /* 02077BFC */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077BF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
+        /* 02077BFC */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077BFC */ _t32 = _t31 & 0x00000001u;
         /* 02077BFC */ if (_t32) goto L_02077C7C; else goto L_02077C00;
   L_02077C00: ; // 0x2077c00
@@ -17401,8 +17401,8 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 02077C3C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02077C40 */ _t40 = cpu->r[1] + 0x0000002Cu;
         /* 02077C40 */ cpu->r[12] = rbrew_read32(cpu->mem, _t40);
-        /* 02077C44 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[17], cpu->r[12]);
-        /* 02077C48 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077C44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[17], cpu->r[12]));
+        /* 02077C48 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077C48 */ _t42 = _t41 & 0x00000001u;
         /* 02077C48 */ if (_t42) goto L_02077D0C; else goto L_02077C4C;
   L_02077C4C: ; // 0x2077c4c
@@ -17419,13 +17419,13 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 02077C64 */ _t45 = cpu->r[12] + 0x00000001u;
         /* 02077C64 */ cpu->r[9] = rbrew_read8(cpu->mem, _t45);
         /* 02077C64 */ cpu->r[12] = _t45;
-        /* 02077C68 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[9]);
-        /* 02077C6C */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077C68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[9]));
+        /* 02077C6C */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077C6C */ _t47 = _t46 & 0x00000001u;
         /* 02077C6C */ if (_t47) goto L_02077C70; else goto L_02077C7C;
   L_02077C70: ; // 0x2077c70
-        /* 02077C70 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[11]);
-        /* 02077C74 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077C70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[11]));
+        /* 02077C74 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077C74 */ _t49 = _t48 & 0x00000001u;
         /* 02077C74 */ if (_t49) goto L_02077D0C; else goto L_02077C78;
   L_02077C78: ; // 0x2077c78
@@ -17483,15 +17483,15 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 02077CE0 */ Gambit_fn_027FD390(cpu);
         /* 02077CE4 */ _t73 = cpu->r[1] + 0x00000058u;
         /* 02077CE4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t73);
-        /* 02077CE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02077CEC */ _t74 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077CE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02077CEC */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077CEC */ _t75 = _t74 & 0x00000001u;
         /* 02077CEC */ if (_t75) goto L_02077D0C; else goto L_02077CF0;
   L_02077CF0: ; // 0x2077cf0
-        /* 02077CF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[24], 0x00000064u);
+        /* 02077CF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[24], 0x00000064u));
         /* 02077CF4 */ _t76 = cpu->r[1] + 0x00000008u;
         /* 02077CF4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t76);
-        /* 02077CF8 */ _t77 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02077CF8 */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02077CF8 */ _t78 = _t77 & 0x00000001u;
         /* 02077CF8 */ if (_t78) goto L_02077CFC; else goto L_02077D00;
   L_02077CFC: ; // 0x2077cfc
@@ -17503,9 +17503,9 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 02077D08 */ rbrew_write32(cpu->mem, _t79, cpu->r[19]);
   L_02077D0C: ; // 0x2077d0c
         /* 02077D0C */ cpu->r[18] = cpu->r[18] + 0xFFFFFFFFu;
-        /* 02077D0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[18], 0x00000000u);
+        /* 02077D0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[18], 0x00000000u));
         /* 02077D10 */ cpu->r[19] = cpu->r[19] + 0x00000001u;
-        /* 02077D14 */ _t80 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077D14 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077D14 */ _t81 = _t80 & 0x00000001u;
         /* 02077D14 */ if (_t81) goto L_02077D18; else goto L_02077BE4;
   L_02077D18: ; // 0x2077d18
@@ -17527,9 +17527,9 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 02077D44 */ cpu->r[20] = rbrew_read32(cpu->mem, _t85);
         /* 02077D48 */ _t86 = cpu->r[1] + 0x00000010u;
         /* 02077D48 */ rbrew_write32(cpu->mem, _t86, cpu->r[3]);
-        /* 02077D4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
+        /* 02077D4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
         /* 02077D50 */ cpu->r[16] = 0x10010000u;
-        /* 02077D54 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077D54 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077D54 */ _t88 = _t87 & 0x00000001u;
         /* 02077D54 */ if (_t88) goto L_02077F48; else goto L_02077D58;
   L_02077D58: ; // 0x2077d58
@@ -17551,8 +17551,8 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 02077D74 */ _t93 = cpu->r[20] + 0x0000000Cu;
         /* 02077D74 */ cpu->r[6] = rbrew_read32(cpu->mem, _t93);
         /* 02077D78 */ cpu->r[27] = 0x00000000u;
-        /* 02077D7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[6]);
-        /* 02077D80 */ _t94 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02077D7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[6]));
+        /* 02077D80 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02077D80 */ _t95 = _t94 & 0x00000001u;
         /* 02077D80 */ if (_t95) goto L_02077D84; else goto L_02077F3C;
   L_02077D84: ; // 0x2077d84
@@ -17570,15 +17570,15 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 02077DA8 */ cpu->r[4] = cpu->r[27];
         /* 02077DAC */ Gambit_fn_02026004(cpu);
         /* 02077DB0 */ cpu->r[28] = cpu->r[3];
-        /* 02077DB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 02077DB4 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077DB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 02077DB4 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077DB4 */ _t98 = _t97 & 0x00000001u;
         /* 02077DB4 */ if (_t98) goto L_02077F2C; else goto L_02077DB8;
   L_02077DB8: ; // 0x2077db8
         /* 02077DB8 */ _t99 = cpu->r[28] + 0x00000124u;
         /* 02077DB8 */ cpu->r[8] = rbrew_read8(cpu->mem, _t99);
-        /* 02077DBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02077DC0 */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077DBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02077DC0 */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077DC0 */ _t101 = _t100 & 0x00000001u;
         /* 02077DC0 */ if (_t101) goto L_02077F2C; else goto L_02077DC4;
   L_02077DC4: ; // 0x2077dc4
@@ -17586,12 +17586,12 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 02077DC4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t102);
         /* 02077DC8 */ _t103 = cpu->r[1] + 0x00000018u;
         /* 02077DC8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t103);
-        /* 02077DCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], cpu->r[0]);
-        /* 02077DD0 */ _t104 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02077DCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], cpu->r[0]));
+        /* 02077DD0 */ _t104 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02077DD0 */ _t105 = _t104 & 0x00000001u;
         /* 02077DD0 */ if (_t105) goto L_02077DE8; else goto L_02077DD4;
   L_02077DD4: ; // 0x2077dd4
-        /* 02077DD4 */ _t106 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02077DD4 */ _t106 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02077DD4 */ _t107 = _t106 & 0x00000001u;
         /* 02077DD4 */ if (_t107) goto L_02077F2C; else goto L_02077DD8;
   L_02077DD8: ; // 0x2077dd8
@@ -17599,8 +17599,8 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 02077DD8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t108);
         /* 02077DDC */ _t109 = cpu->r[1] + 0x00000010u;
         /* 02077DDC */ cpu->r[6] = rbrew_read32(cpu->mem, _t109);
-        /* 02077DE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], cpu->r[6]);
-        /* 02077DE4 */ _t110 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02077DE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], cpu->r[6]));
+        /* 02077DE4 */ _t110 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02077DE4 */ _t111 = _t110 & 0x00000001u;
         /* 02077DE4 */ if (_t111) goto L_02077F2C; else goto L_02077DE8;
   L_02077DE8: ; // 0x2077de8
@@ -17615,13 +17615,13 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 02077DFC */ cpu->r[5] = rbrew_read32(cpu->mem, _t114);
         /* 02077E00 */ cpu->r[3] = cpu->r[1] + 0x0000002Cu;
         /* 02077E04 */ cpu->r[4] = cpu->r[16] + 0xFFFFAE78u;
-        /* 02077E08 */ _t115 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02077E08 */ _t115 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02077E08 */ _t116 = _t115 & 0x00000001u;
         /* 02077E08 */ if (_t116) goto L_02077E0C; // else: addr-0 trap, fall-through
   L_02077E0C: ; // 0x2077e0c
         /* 02077E0C */ Gambit_fn_0282A5F4(cpu);
-        /* 02077E10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
-        /* 02077E14 */ _t117 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077E10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
+        /* 02077E14 */ _t117 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077E14 */ _t118 = _t117 & 0x00000001u;
         /* 02077E14 */ if (_t118) goto L_02077E9C; else goto L_02077E18;
   L_02077E18: ; // 0x2077e18
@@ -17650,8 +17650,8 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 02077E54 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02077E58 */ _t126 = cpu->r[1] + 0x0000002Cu;
         /* 02077E58 */ cpu->r[12] = rbrew_read32(cpu->mem, _t126);
-        /* 02077E5C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[12]);
-        /* 02077E60 */ _t127 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077E5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[12]));
+        /* 02077E60 */ _t127 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077E60 */ _t128 = _t127 & 0x00000001u;
         /* 02077E60 */ if (_t128) goto L_02077F2C; else goto L_02077E64;
   L_02077E64: ; // 0x2077e64
@@ -17670,13 +17670,13 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 02077E84 */ _t131 = cpu->r[12] + 0x00000001u;
         /* 02077E84 */ cpu->r[9] = rbrew_read8(cpu->mem, _t131);
         /* 02077E84 */ cpu->r[12] = _t131;
-        /* 02077E88 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
-        /* 02077E8C */ _t132 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077E88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
+        /* 02077E8C */ _t132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077E8C */ _t133 = _t132 & 0x00000001u;
         /* 02077E8C */ if (_t133) goto L_02077E90; else goto L_02077E9C;
   L_02077E90: ; // 0x2077e90
-        /* 02077E90 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[0]);
-        /* 02077E94 */ _t134 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077E90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[0]));
+        /* 02077E94 */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077E94 */ _t135 = _t134 & 0x00000001u;
         /* 02077E94 */ if (_t135) goto L_02077F2C; else goto L_02077E98;
   L_02077E98: ; // 0x2077e98
@@ -17734,14 +17734,14 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 02077F00 */ Gambit_fn_027FD390(cpu);
         /* 02077F04 */ _t159 = cpu->r[1] + 0x00000058u;
         /* 02077F04 */ cpu->r[4] = rbrew_read8(cpu->mem, _t159);
-        /* 02077F08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 02077F0C */ _t160 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077F08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 02077F0C */ _t160 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077F0C */ _t161 = _t160 & 0x00000001u;
         /* 02077F0C */ if (_t161) goto L_02077F2C; else goto L_02077F10;
   L_02077F10: ; // 0x2077f10
-        /* 02077F10 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[22], 0x00000064u);
+        /* 02077F10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[22], 0x00000064u));
         /* 02077F14 */ cpu->r[5] = cpu->r[29];
-        /* 02077F18 */ _t162 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02077F18 */ _t162 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02077F18 */ _t163 = _t162 & 0x00000001u;
         /* 02077F18 */ if (_t163) goto L_02077F1C; else goto L_02077F20;
   L_02077F1C: ; // 0x2077f1c
@@ -17755,8 +17755,8 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 02077F2C */ _t165 = cpu->r[20] + 0x0000000Cu;
         /* 02077F2C */ cpu->r[8] = rbrew_read32(cpu->mem, _t165);
         /* 02077F30 */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 02077F34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[8]);
-        /* 02077F38 */ _t166 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02077F34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[8]));
+        /* 02077F38 */ _t166 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02077F38 */ _t167 = _t166 & 0x00000001u;
         /* 02077F38 */ if (_t167) goto L_02077DA4; else goto L_02077F3C;
   L_02077F3C: ; // 0x2077f3c
@@ -17768,8 +17768,8 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
   L_02077F48: ; // 0x2077f48
         /* 02077F48 */ _t170 = cpu->r[1] + 0x0000001Cu;
         /* 02077F48 */ cpu->r[11] = rbrew_read32(cpu->mem, _t170);
-        /* 02077F4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02077F50 */ _t171 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077F4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02077F50 */ _t171 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077F50 */ _t172 = _t171 & 0x00000001u;
         /* 02077F50 */ if (_t172) goto L_02078178; else goto L_02077F54;
   L_02077F54: ; // 0x2077f54
@@ -17780,15 +17780,15 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 02077F60 */ _t174 = cpu->r[1] + 0x0000001Cu;
         /* 02077F60 */ cpu->r[10] = rbrew_read32(cpu->mem, _t174);
         /* 02077F64 */ /* nop */
-        /* 02077F68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[24]);
-        /* 02077F6C */ _t175 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02077F68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[24]));
+        /* 02077F6C */ _t175 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02077F6C */ _t176 = _t175 & 0x00000001u;
         /* 02077F6C */ if (_t176) goto L_02077F70; else goto L_02077FA8;
   L_02077F70: ; // 0x2077f70
-        /* 02077F70 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000064u);
+        /* 02077F70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000064u));
         /* 02077F74 */ _t177 = cpu->r[1] + 0x00000008u;
         /* 02077F74 */ cpu->r[9] = rbrew_read32(cpu->mem, _t177);
-        /* 02077F78 */ _t178 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02077F78 */ _t178 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02077F78 */ _t179 = _t178 & 0x00000001u;
         /* 02077F78 */ if (_t179) goto L_02077F7C; else goto L_02077F88;
   L_02077F7C: ; // 0x2077f7c
@@ -17802,13 +17802,13 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 02077F8C */ cpu->r[3] = cpu->r[1] + 0x0000002Cu;
         /* 02077F90 */ _t182 = cpu->r[9] + 0x00000000u;
         /* 02077F90 */ cpu->r[5] = rbrew_read32(cpu->mem, _t182);
-        /* 02077F94 */ _t183 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02077F94 */ _t183 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02077F94 */ _t184 = _t183 & 0x00000001u;
         /* 02077F94 */ if (_t184) goto L_02077F98; // else: addr-0 trap, fall-through
   L_02077F98: ; // 0x2077f98
         /* 02077F98 */ Gambit_fn_0282A5F4(cpu);
-        /* 02077F9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
-        /* 02077FA0 */ _t185 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077F9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
+        /* 02077FA0 */ _t185 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077FA0 */ _t186 = _t185 & 0x00000001u;
         /* 02077FA0 */ if (_t186) goto L_02078014; else goto L_02077FA4;
   L_02077FA4: ; // 0x2077fa4
@@ -17816,9 +17816,9 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
   L_02077FA8: ; // 0x2077fa8
         /* 02077FA8 */ cpu->r[12] = cpu->r[0] - cpu->r[24];
         /* 02077FAC */ cpu->r[29] = cpu->r[1] + 0x00000120u;
-        /* 02077FB0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], 0x00000064u);
+        /* 02077FB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], 0x00000064u));
         /* 02077FB4 */ cpu->r[10] = cpu->r[29];
-        /* 02077FB8 */ _t187 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02077FB8 */ _t187 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02077FB8 */ _t188 = _t187 & 0x00000001u;
         /* 02077FB8 */ if (_t188) goto L_02077FBC; else goto L_02077FC4;
   L_02077FBC: ; // 0x2077fbc
@@ -17830,8 +17830,8 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 02077FC8 */ cpu->r[3] = cpu->r[20];
         /* 02077FCC */ Gambit_fn_02026004(cpu);
         /* 02077FD0 */ cpu->r[31] = cpu->r[3];
-        /* 02077FD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02077FD4 */ _t190 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02077FD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02077FD4 */ _t190 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02077FD4 */ _t191 = _t190 & 0x00000001u;
         /* 02077FD4 */ if (_t191) goto L_02078000; else goto L_02077FD8;
   L_02077FD8: ; // 0x2077fd8
@@ -17846,14 +17846,14 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 02077FEC */ cpu->r[5] = rbrew_read32(cpu->mem, _t194);
         /* 02077FF0 */ cpu->r[3] = cpu->r[1] + 0x0000002Cu;
         /* 02077FF4 */ cpu->r[4] = cpu->r[16] + 0xFFFFAE78u;
-        /* 02077FF8 */ _t195 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02077FF8 */ _t195 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02077FF8 */ _t196 = _t195 & 0x00000001u;
         /* 02077FF8 */ if (_t196) goto L_02077FFC; // else: addr-0 trap, fall-through
   L_02077FFC: ; // 0x2077ffc
         /* 02077FFC */ Gambit_fn_0282A5F4(cpu);
   L_02078000: ; // 0x2078000
-        /* 02078000 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
-        /* 02078004 */ _t197 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078000 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
+        /* 02078004 */ _t197 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078004 */ _t198 = _t197 & 0x00000001u;
         /* 02078004 */ if (_t198) goto L_02078014; else goto L_02078008;
   L_02078008: ; // 0x2078008
@@ -17881,23 +17881,23 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 0207803C */ _t206 = cpu->r[9] + 0x00000000u;
         /* 0207803C */ cpu->r[6] = rbrew_read8(cpu->mem, _t206);
         /* 02078040 */ cpu->r[31] = 0x00000000u;
-        /* 02078044 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[8]);
+        /* 02078044 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[8]));
         /* 02078048 */ cpu->r[10] = 0x00080000u;
-        /* 0207804C */ _t207 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207804C */ _t207 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207804C */ _t208 = _t207 & 0x00000001u;
         /* 0207804C */ if (_t208) goto L_02078074; else goto L_02078050;
   L_02078050: ; // 0x2078050
         /* 02078050 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02078054 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 02078054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 02078058 */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 0207805C */ _t209 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207805C */ _t209 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207805C */ _t210 = _t209 & 0x00000001u;
         /* 0207805C */ if (_t210) goto L_02078070; else goto L_02078060;
   L_02078060: ; // 0x2078060
         /* 02078060 */ _t211 = cpu->r[9] + 0x00000000u;
         /* 02078060 */ cpu->r[7] = rbrew_read8(cpu->mem, _t211);
-        /* 02078064 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
-        /* 02078068 */ _t212 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078064 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
+        /* 02078068 */ _t212 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078068 */ _t213 = _t212 & 0x00000001u;
         /* 02078068 */ if (_t213) goto L_0207806C; else goto L_02078050;
   L_0207806C: ; // 0x207806c
@@ -17919,23 +17919,23 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 02078090 */ _t218 = cpu->r[6] + 0x00000000u;
         /* 02078090 */ cpu->r[10] = rbrew_read8(cpu->mem, _t218);
         /* 02078094 */ cpu->r[30] = 0x00000000u;
-        /* 02078098 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[0]);
+        /* 02078098 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[0]));
         /* 0207809C */ cpu->r[7] = 0x00080000u;
-        /* 020780A0 */ _t219 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020780A0 */ _t219 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020780A0 */ _t220 = _t219 & 0x00000001u;
         /* 020780A0 */ if (_t220) goto L_020780C8; else goto L_020780A4;
   L_020780A4: ; // 0x20780a4
         /* 020780A4 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020780A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 020780A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 020780AC */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 020780B0 */ _t221 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020780B0 */ _t221 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020780B0 */ _t222 = _t221 & 0x00000001u;
         /* 020780B0 */ if (_t222) goto L_020780C4; else goto L_020780B4;
   L_020780B4: ; // 0x20780b4
         /* 020780B4 */ _t223 = cpu->r[6] + 0x00000000u;
         /* 020780B4 */ cpu->r[12] = rbrew_read8(cpu->mem, _t223);
-        /* 020780B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
-        /* 020780BC */ _t224 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020780B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
+        /* 020780BC */ _t224 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020780BC */ _t225 = _t224 & 0x00000001u;
         /* 020780BC */ if (_t225) goto L_020780C0; else goto L_020780A4;
   L_020780C0: ; // 0x20780c0
@@ -17948,15 +17948,15 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 020780CC */ _t227 = cpu->r[12] + 0x00000458u;
         /* 020780CC */ cpu->r[12] = rbrew_read32(cpu->mem, _t227);
         /* 020780D0 */ cpu->r[0] = cpu->r[12] + 0xFFFFFFFBu;
-        /* 020780D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
-        /* 020780D8 */ _t228 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020780D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
+        /* 020780D8 */ _t228 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020780D8 */ _t229 = _t228 & 0x00000001u;
         /* 020780D8 */ if (_t229) goto L_020780E0; else goto L_020780DC;
   L_020780DC: ; // 0x20780dc
         /* 020780DC */ cpu->r[30] = cpu->r[12] + 0xFFFFFFFAu;
   L_020780E0: ; // 0x20780e0
-        /* 020780E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 020780E4 */ _t230 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020780E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 020780E4 */ _t230 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020780E4 */ _t231 = _t230 & 0x00000001u;
         /* 020780E4 */ if (_t231) goto L_020780E8; else goto L_0207812C;
   L_020780E8: ; // 0x20780e8
@@ -17975,8 +17975,8 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 0207810C */ cpu->r[3] = cpu->r[28];
         /* 02078110 */ rbrew_dispatch(cpu, 0x02d0a6e8u);
         /* 02078114 */ cpu->r[7] = cpu->r[30] + 0x00000005u;
-        /* 02078118 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], cpu->r[31]);
-        /* 0207811C */ _t235 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02078118 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], cpu->r[31]));
+        /* 0207811C */ _t235 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207811C */ _t236 = _t235 & 0x00000001u;
         /* 0207811C */ if (_t236) goto L_02078120; else goto L_0207812C;
   L_02078120: ; // 0x2078120
@@ -18008,8 +18008,8 @@ void Gambit_fn_02077AF0(CPUState* cpu) {
         /* 02078158 */ cpu->r[12] = rbrew_read32(cpu->mem, _t246);
         /* 0207815C */ _t247 = cpu->r[12] + 0x00000000u;
         /* 0207815C */ cpu->r[0] = rbrew_read8(cpu->mem, _t247);
-        /* 02078160 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02078164 */ _t248 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078160 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02078164 */ _t248 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078164 */ _t249 = _t248 & 0x00000001u;
         /* 02078164 */ if (_t249) goto L_02078178; else goto L_02078168;
   L_02078168: ; // 0x2078168
@@ -18047,9 +18047,9 @@ void Gambit_fn_02078198(CPUState* cpu) {
         /* 020781AC */ _t2 = cpu->r[8] + 0xFFFF85A8u;
         /* 020781AC */ cpu->r[8] = rbrew_read32(cpu->mem, _t2);
         /* 020781B0 */ cpu->r[15] = cpu->r[3];
-        /* 020781B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020781B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020781B8 */ cpu->r[16] = 0x00000000u;
-        /* 020781BC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020781BC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020781BC */ _t4 = _t3 & 0x00000001u;
         /* 020781BC */ if (_t4) goto L_020781C4; else goto L_020781C0;
   L_020781C0: ; // 0x20781c0
@@ -18059,8 +18059,8 @@ void Gambit_fn_02078198(CPUState* cpu) {
         /* 020781C4 */ cpu->r[7] = 0x101C0000u;
         /* 020781C8 */ _t6 = cpu->r[7] + 0x00006BD0u;
         /* 020781C8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t6);
-        /* 020781CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 020781D0 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020781CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 020781D0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020781D0 */ _t8 = _t7 & 0x00000001u;
         /* 020781D0 */ if (_t8) goto L_020781D8; else goto L_020781D4;
   L_020781D4: ; // 0x20781d4
@@ -18119,13 +18119,13 @@ void Gambit_fn_02078198(CPUState* cpu) {
         /* 02078260 */ cpu->r[5] = cpu->r[18];
         /* 02078264 */ cpu->r[4] = cpu->r[29] + 0xFFFFAE90u;
         /* 02078268 */ cpu->r[3] = cpu->r[1] + 0x00000010u;
-        /* 0207826C */ _t20 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0207826C */ _t20 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0207826C */ _t21 = _t20 & 0x00000001u;
         /* 0207826C */ if (_t21) goto L_02078270; // else: addr-0 trap, fall-through
   L_02078270: ; // 0x2078270
         /* 02078270 */ Gambit_fn_0282A5F4(cpu);
-        /* 02078274 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[16], 0x00000000u);
-        /* 02078278 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078274 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[16], 0x00000000u));
+        /* 02078278 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078278 */ _t23 = _t22 & 0x00000001u;
         /* 02078278 */ if (_t23) goto L_020782F8; else goto L_0207827C;
   L_0207827C: ; // 0x207827c
@@ -18154,8 +18154,8 @@ void Gambit_fn_02078198(CPUState* cpu) {
         /* 020782B8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020782BC */ _t31 = cpu->r[1] + 0x00000010u;
         /* 020782BC */ cpu->r[5] = rbrew_read32(cpu->mem, _t31);
-        /* 020782C0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[19], cpu->r[5]);
-        /* 020782C4 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020782C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[19], cpu->r[5]));
+        /* 020782C4 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020782C4 */ _t33 = _t32 & 0x00000001u;
         /* 020782C4 */ if (_t33) goto L_02078390; else goto L_020782C8;
   L_020782C8: ; // 0x20782c8
@@ -18172,13 +18172,13 @@ void Gambit_fn_02078198(CPUState* cpu) {
         /* 020782E0 */ _t36 = cpu->r[6] + 0x00000001u;
         /* 020782E0 */ cpu->r[5] = rbrew_read8(cpu->mem, _t36);
         /* 020782E0 */ cpu->r[6] = _t36;
-        /* 020782E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[5]);
-        /* 020782E8 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020782E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[5]));
+        /* 020782E8 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020782E8 */ _t38 = _t37 & 0x00000001u;
         /* 020782E8 */ if (_t38) goto L_020782EC; else goto L_020782F8;
   L_020782EC: ; // 0x20782ec
-        /* 020782EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[0]);
-        /* 020782F0 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020782EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[0]));
+        /* 020782F0 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020782F0 */ _t40 = _t39 & 0x00000001u;
         /* 020782F0 */ if (_t40) goto L_02078390; else goto L_020782F4;
   L_020782F4: ; // 0x20782f4
@@ -18238,14 +18238,14 @@ void Gambit_fn_02078198(CPUState* cpu) {
         /* 02078364 */ Gambit_fn_027FD390(cpu);
         /* 02078368 */ _t64 = cpu->r[1] + 0x0000003Cu;
         /* 02078368 */ cpu->r[0] = rbrew_read8(cpu->mem, _t64);
-        /* 0207836C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02078370 */ _t65 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207836C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02078370 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078370 */ _t66 = _t65 & 0x00000001u;
         /* 02078370 */ if (_t66) goto L_02078390; else goto L_02078374;
   L_02078374: ; // 0x2078374
-        /* 02078374 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[17], 0x00000064u);
+        /* 02078374 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[17], 0x00000064u));
         /* 02078378 */ cpu->r[10] = cpu->r[28];
-        /* 0207837C */ _t67 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207837C */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207837C */ _t68 = _t67 & 0x00000001u;
         /* 0207837C */ if (_t68) goto L_02078380; else goto L_02078384;
   L_02078380: ; // 0x2078380
@@ -18257,14 +18257,14 @@ void Gambit_fn_02078198(CPUState* cpu) {
         /* 0207838C */ rbrew_write32(cpu->mem, _t69, cpu->r[18]);
   L_02078390: ; // 0x2078390
         /* 02078390 */ cpu->r[20] = cpu->r[20] + 0xFFFFFFFFu;
-        /* 02078390 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
+        /* 02078390 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
         /* 02078394 */ cpu->r[18] = cpu->r[18] + 0x00000001u;
-        /* 02078398 */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078398 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078398 */ _t71 = _t70 & 0x00000001u;
         /* 02078398 */ if (_t71) goto L_0207839C; else goto L_02078260;
   L_0207839C: ; // 0x207839c
-        /* 0207839C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[17], 0x00000000u);
-        /* 020783A0 */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207839C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[17], 0x00000000u));
+        /* 020783A0 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020783A0 */ _t73 = _t72 & 0x00000001u;
         /* 020783A0 */ if (_t73) goto L_02078540; else goto L_020783A4;
   L_020783A4: ; // 0x20783a4
@@ -18273,9 +18273,9 @@ void Gambit_fn_02078198(CPUState* cpu) {
         /* 020783A8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t74);
         /* 020783AC */ Gambit_fn_02830138(cpu);
         /* 020783B0 */ /* nop */
-        /* 020783B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000064u);
+        /* 020783B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000064u));
         /* 020783B8 */ cpu->r[11] = cpu->r[28];
-        /* 020783BC */ _t75 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020783BC */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020783BC */ _t76 = _t75 & 0x00000001u;
         /* 020783BC */ if (_t76) goto L_020783C0; else goto L_020783C8;
   L_020783C0: ; // 0x20783c0
@@ -18286,13 +18286,13 @@ void Gambit_fn_02078198(CPUState* cpu) {
         /* 020783C8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t77);
         /* 020783CC */ cpu->r[3] = cpu->r[1] + 0x00000010u;
         /* 020783D0 */ cpu->r[4] = cpu->r[29] + 0xFFFFAE90u;
-        /* 020783D4 */ _t78 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020783D4 */ _t78 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020783D4 */ _t79 = _t78 & 0x00000001u;
         /* 020783D4 */ if (_t79) goto L_020783D8; // else: addr-0 trap, fall-through
   L_020783D8: ; // 0x20783d8
         /* 020783D8 */ Gambit_fn_0282A5F4(cpu);
-        /* 020783DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[16], 0x00000000u);
-        /* 020783E0 */ _t80 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020783DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[16], 0x00000000u));
+        /* 020783E0 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020783E0 */ _t81 = _t80 & 0x00000001u;
         /* 020783E0 */ if (_t81) goto L_020783F0; else goto L_020783E4;
   L_020783E4: ; // 0x20783e4
@@ -18315,23 +18315,23 @@ void Gambit_fn_02078198(CPUState* cpu) {
         /* 02078410 */ _t86 = cpu->r[4] + 0x00000000u;
         /* 02078410 */ cpu->r[12] = rbrew_read8(cpu->mem, _t86);
         /* 02078414 */ cpu->r[5] = 0x00080000u;
-        /* 02078418 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[9]);
+        /* 02078418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[9]));
         /* 0207841C */ cpu->r[29] = 0x00000000u;
-        /* 02078420 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078420 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078420 */ _t88 = _t87 & 0x00000001u;
         /* 02078420 */ if (_t88) goto L_02078448; else goto L_02078424;
   L_02078424: ; // 0x2078424
         /* 02078424 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 02078428 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[5]);
+        /* 02078428 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[5]));
         /* 0207842C */ cpu->r[4] = cpu->r[4] + 0x00000001u;
-        /* 02078430 */ _t89 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02078430 */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02078430 */ _t90 = _t89 & 0x00000001u;
         /* 02078430 */ if (_t90) goto L_02078444; else goto L_02078434;
   L_02078434: ; // 0x2078434
         /* 02078434 */ _t91 = cpu->r[4] + 0x00000000u;
         /* 02078434 */ cpu->r[6] = rbrew_read8(cpu->mem, _t91);
-        /* 02078438 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[9]);
-        /* 0207843C */ _t92 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078438 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[9]));
+        /* 0207843C */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207843C */ _t93 = _t92 & 0x00000001u;
         /* 0207843C */ if (_t93) goto L_02078440; else goto L_02078424;
   L_02078440: ; // 0x2078440
@@ -18352,23 +18352,23 @@ void Gambit_fn_02078198(CPUState* cpu) {
         /* 02078464 */ _t97 = cpu->r[10] + 0x00000000u;
         /* 02078464 */ cpu->r[11] = rbrew_read8(cpu->mem, _t97);
         /* 02078468 */ cpu->r[31] = 0x00000000u;
-        /* 0207846C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[12]);
+        /* 0207846C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[12]));
         /* 02078470 */ cpu->r[11] = 0x00080000u;
-        /* 02078474 */ _t98 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078474 */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078474 */ _t99 = _t98 & 0x00000001u;
         /* 02078474 */ if (_t99) goto L_0207849C; else goto L_02078478;
   L_02078478: ; // 0x2078478
         /* 02078478 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0207847C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 0207847C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 02078480 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 02078484 */ _t100 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02078484 */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02078484 */ _t101 = _t100 & 0x00000001u;
         /* 02078484 */ if (_t101) goto L_02078498; else goto L_02078488;
   L_02078488: ; // 0x2078488
         /* 02078488 */ _t102 = cpu->r[10] + 0x00000000u;
         /* 02078488 */ cpu->r[0] = rbrew_read8(cpu->mem, _t102);
-        /* 0207848C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 02078490 */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207848C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 02078490 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078490 */ _t104 = _t103 & 0x00000001u;
         /* 02078490 */ if (_t104) goto L_02078494; else goto L_02078478;
   L_02078494: ; // 0x2078494
@@ -18379,15 +18379,15 @@ void Gambit_fn_02078198(CPUState* cpu) {
         /* 0207849C */ _t105 = cpu->r[15] + 0x00000458u;
         /* 0207849C */ cpu->r[12] = rbrew_read32(cpu->mem, _t105);
         /* 020784A0 */ cpu->r[4] = cpu->r[12] + 0xFFFFFFFBu;
-        /* 020784A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[4]);
-        /* 020784A8 */ _t106 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020784A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[4]));
+        /* 020784A8 */ _t106 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020784A8 */ _t107 = _t106 & 0x00000001u;
         /* 020784A8 */ if (_t107) goto L_020784B0; else goto L_020784AC;
   L_020784AC: ; // 0x20784ac
         /* 020784AC */ cpu->r[31] = cpu->r[12] + 0xFFFFFFFAu;
   L_020784B0: ; // 0x20784b0
-        /* 020784B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020784B4 */ _t108 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020784B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020784B4 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020784B4 */ _t109 = _t108 & 0x00000001u;
         /* 020784B4 */ if (_t109) goto L_020784B8; else goto L_020784F8;
   L_020784B8: ; // 0x20784b8
@@ -18406,8 +18406,8 @@ void Gambit_fn_02078198(CPUState* cpu) {
         /* 020784DC */ cpu->r[3] = cpu->r[25];
         /* 020784E0 */ rbrew_dispatch(cpu, 0x02d0a6e8u);
         /* 020784E4 */ cpu->r[9] = cpu->r[31] + 0x00000005u;
-        /* 020784E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], cpu->r[29]);
-        /* 020784EC */ _t113 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020784E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], cpu->r[29]));
+        /* 020784EC */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020784EC */ _t114 = _t113 & 0x00000001u;
         /* 020784EC */ if (_t114) goto L_020784F0; else goto L_020784F8;
   L_020784F0: ; // 0x20784f0
@@ -18434,8 +18434,8 @@ void Gambit_fn_02078198(CPUState* cpu) {
         /* 02078520 */ Gambit_fn_020A54C4(cpu);
         /* 02078524 */ _t122 = cpu->r[15] + 0x00000000u;
         /* 02078524 */ cpu->r[11] = rbrew_read8(cpu->mem, _t122);
-        /* 02078528 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0207852C */ _t123 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078528 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0207852C */ _t123 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207852C */ _t124 = _t123 & 0x00000001u;
         /* 0207852C */ if (_t124) goto L_02078540; else goto L_02078530;
   L_02078530: ; // 0x2078530
@@ -18544,9 +18544,9 @@ void Gambit_fn_02078554(CPUState* cpu) {
   L_02078638: ; // 0x2078638
         /* 02078638 */ _t26 = cpu->r[25] + 0xFFFFE378u;
         /* 02078638 */ cpu->r[7] = rbrew_read32(cpu->mem, _t26);
-        /* 0207863C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0207863C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02078640 */ cpu->r[14] = cpu->r[22];
-        /* 02078644 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078644 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078644 */ _t28 = _t27 & 0x00000001u;
         /* 02078644 */ if (_t28) goto L_02078648; else goto L_0207865C;
   L_02078648: ; // 0x2078648
@@ -18559,8 +18559,8 @@ void Gambit_fn_02078554(CPUState* cpu) {
   L_0207865C: ; // 0x207865c
         /* 0207865C */ _t30 = cpu->r[24] + 0xFFFFE374u;
         /* 0207865C */ cpu->r[8] = rbrew_read32(cpu->mem, _t30);
-        /* 02078660 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02078664 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078660 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02078664 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078664 */ _t32 = _t31 & 0x00000001u;
         /* 02078664 */ if (_t32) goto L_02078668; else goto L_02078670;
   L_02078668: ; // 0x2078668
@@ -18569,8 +18569,8 @@ void Gambit_fn_02078554(CPUState* cpu) {
         /* 0207866C */ _t34 = cpu->r[24] + 0xFFFFE374u;
         /* 0207866C */ rbrew_write32(cpu->mem, _t34, cpu->r[28]);
   L_02078670: ; // 0x2078670
-        /* 02078670 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[22], 0x00000007u);
-        /* 02078674 */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02078670 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[22], 0x00000007u));
+        /* 02078674 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02078674 */ _t36 = _t35 & 0x00000001u;
         /* 02078674 */ if (_t36) goto L_020786C4; else goto L_02078678;
   L_02078678: ; // 0x2078678
@@ -18579,7 +18579,7 @@ void Gambit_fn_02078554(CPUState* cpu) {
         /* 02078680 */ cpu->r[4] = cpu->r[31] + 0xFFFFAEA0u;
         /* 02078684 */ cpu->r[5] = cpu->r[18];
         /* 02078688 */ cpu->r[6] = cpu->r[19];
-        /* 0207868C */ _t37 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0207868C */ _t37 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0207868C */ _t38 = _t37 & 0x00000001u;
         /* 0207868C */ if (_t38) goto L_02078690; // else: addr-0 trap, fall-through
   L_02078690: ; // 0x2078690
@@ -18597,8 +18597,8 @@ void Gambit_fn_02078554(CPUState* cpu) {
         /* 020786B0 */ Gambit_fn_027FD390(cpu);
         /* 020786B4 */ _t42 = cpu->r[1] + 0x00000050u;
         /* 020786B4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t42);
-        /* 020786B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020786BC */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020786B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020786BC */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020786BC */ _t44 = _t43 & 0x00000001u;
         /* 020786BC */ if (_t44) goto L_02078798; else goto L_020786C0;
   L_020786C0: ; // 0x20786c0
@@ -18606,8 +18606,8 @@ void Gambit_fn_02078554(CPUState* cpu) {
   L_020786C4: ; // 0x20786c4
         /* 020786C4 */ _t45 = cpu->r[23] + 0xFFFFEE14u;
         /* 020786C4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t45);
-        /* 020786C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020786CC */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020786C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020786CC */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020786CC */ _t47 = _t46 & 0x00000001u;
         /* 020786CC */ if (_t47) goto L_020786D0; else goto L_02078708;
   L_020786D0: ; // 0x20786d0
@@ -18616,8 +18616,8 @@ void Gambit_fn_02078554(CPUState* cpu) {
         /* 020786D8 */ Gambit_fn_02836FFC(cpu);
         /* 020786DC */ _t48 = cpu->r[23] + 0xFFFFEE14u;
         /* 020786DC */ cpu->r[9] = rbrew_read32(cpu->mem, _t48);
-        /* 020786E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 020786E4 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020786E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 020786E4 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020786E4 */ _t50 = _t49 & 0x00000001u;
         /* 020786E4 */ if (_t50) goto L_020786E8; else goto L_020786FC;
   L_020786E8: ; // 0x20786e8
@@ -18640,7 +18640,7 @@ void Gambit_fn_02078554(CPUState* cpu) {
         /* 02078714 */ cpu->r[7] = rbrew_read32(cpu->mem, _t53);
         /* 02078718 */ cpu->r[5] = cpu->r[18];
         /* 0207871C */ cpu->r[3] = cpu->r[1] + 0x0000001Cu;
-        /* 02078720 */ _t54 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02078720 */ _t54 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02078720 */ _t55 = _t54 & 0x00000001u;
         /* 02078720 */ if (_t55) goto L_02078724; // else: addr-0 trap, fall-through
   L_02078724: ; // 0x2078724
@@ -18658,8 +18658,8 @@ void Gambit_fn_02078554(CPUState* cpu) {
         /* 02078744 */ Gambit_fn_027FD390(cpu);
         /* 02078748 */ _t59 = cpu->r[1] + 0x00000050u;
         /* 02078748 */ cpu->r[0] = rbrew_read8(cpu->mem, _t59);
-        /* 0207874C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02078750 */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207874C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02078750 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078750 */ _t61 = _t60 & 0x00000001u;
         /* 02078750 */ if (_t61) goto L_02078798; else goto L_02078754;
   L_02078754: ; // 0x2078754
@@ -18684,18 +18684,18 @@ void Gambit_fn_02078554(CPUState* cpu) {
         /* 02078780 */ _t69 = cpu->r[6] + 0x00000000u;
         /* 02078780 */ cpu->r[7] = rbrew_read8(cpu->mem, _t69);
         /* 02078784 */ cpu->r[8] = 0x00080000u;
-        /* 02078788 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[0]);
+        /* 02078788 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[0]));
         /* 0207878C */ cpu->r[29] = 0x00000000u;
-        /* 02078790 */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078790 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078790 */ _t71 = _t70 & 0x00000001u;
         /* 02078790 */ if (_t71) goto L_02078794; else goto L_02078940;
   L_02078794: ; // 0x2078794
         /* 02078794 */ goto L_02078964;
   L_02078798: ; // 0x2078798
         /* 02078798 */ cpu->r[20] = cpu->r[20] + 0xFFFFFFFFu;
-        /* 02078798 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
+        /* 02078798 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
         /* 0207879C */ cpu->r[22] = cpu->r[22] + 0x00000001u;
-        /* 020787A0 */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020787A0 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020787A0 */ _t73 = _t72 & 0x00000001u;
         /* 020787A0 */ if (_t73) goto L_020787A4; else goto L_02078638;
   L_020787A4: ; // 0x20787a4
@@ -18709,9 +18709,9 @@ void Gambit_fn_02078554(CPUState* cpu) {
   L_020787C0: ; // 0x20787c0
         /* 020787C0 */ _t74 = cpu->r[25] + 0xFFFFE378u;
         /* 020787C0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t74);
-        /* 020787C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 020787C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 020787C8 */ cpu->r[14] = cpu->r[31];
-        /* 020787CC */ _t75 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020787CC */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020787CC */ _t76 = _t75 & 0x00000001u;
         /* 020787CC */ if (_t76) goto L_020787D0; else goto L_020787E4;
   L_020787D0: ; // 0x20787d0
@@ -18724,8 +18724,8 @@ void Gambit_fn_02078554(CPUState* cpu) {
   L_020787E4: ; // 0x20787e4
         /* 020787E4 */ _t78 = cpu->r[24] + 0xFFFFE374u;
         /* 020787E4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t78);
-        /* 020787E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020787EC */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020787E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020787EC */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020787EC */ _t80 = _t79 & 0x00000001u;
         /* 020787EC */ if (_t80) goto L_020787F0; else goto L_020787F8;
   L_020787F0: ; // 0x20787f0
@@ -18734,8 +18734,8 @@ void Gambit_fn_02078554(CPUState* cpu) {
         /* 020787F4 */ _t82 = cpu->r[24] + 0xFFFFE374u;
         /* 020787F4 */ rbrew_write32(cpu->mem, _t82, cpu->r[20]);
   L_020787F8: ; // 0x20787f8
-        /* 020787F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[14], 0x00000007u);
-        /* 020787FC */ _t83 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020787F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[14], 0x00000007u));
+        /* 020787FC */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020787FC */ _t84 = _t83 & 0x00000001u;
         /* 020787FC */ if (_t84) goto L_0207884C; else goto L_02078800;
   L_02078800: ; // 0x2078800
@@ -18744,7 +18744,7 @@ void Gambit_fn_02078554(CPUState* cpu) {
         /* 02078808 */ cpu->r[4] = cpu->r[15] + 0xFFFFAEB8u;
         /* 0207880C */ cpu->r[5] = cpu->r[18];
         /* 02078810 */ cpu->r[6] = cpu->r[19];
-        /* 02078814 */ _t85 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02078814 */ _t85 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02078814 */ _t86 = _t85 & 0x00000001u;
         /* 02078814 */ if (_t86) goto L_02078818; // else: addr-0 trap, fall-through
   L_02078818: ; // 0x2078818
@@ -18762,8 +18762,8 @@ void Gambit_fn_02078554(CPUState* cpu) {
         /* 02078838 */ Gambit_fn_027FD390(cpu);
         /* 0207883C */ _t90 = cpu->r[1] + 0x00000050u;
         /* 0207883C */ cpu->r[10] = rbrew_read8(cpu->mem, _t90);
-        /* 02078840 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02078844 */ _t91 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078840 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02078844 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078844 */ _t92 = _t91 & 0x00000001u;
         /* 02078844 */ if (_t92) goto L_02078920; else goto L_02078848;
   L_02078848: ; // 0x2078848
@@ -18771,8 +18771,8 @@ void Gambit_fn_02078554(CPUState* cpu) {
   L_0207884C: ; // 0x207884c
         /* 0207884C */ _t93 = cpu->r[23] + 0xFFFFEE14u;
         /* 0207884C */ cpu->r[8] = rbrew_read32(cpu->mem, _t93);
-        /* 02078850 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02078854 */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078850 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02078854 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078854 */ _t95 = _t94 & 0x00000001u;
         /* 02078854 */ if (_t95) goto L_02078858; else goto L_02078890;
   L_02078858: ; // 0x2078858
@@ -18781,8 +18781,8 @@ void Gambit_fn_02078554(CPUState* cpu) {
         /* 02078860 */ Gambit_fn_02836FFC(cpu);
         /* 02078864 */ _t96 = cpu->r[23] + 0xFFFFEE14u;
         /* 02078864 */ cpu->r[11] = rbrew_read32(cpu->mem, _t96);
-        /* 02078868 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0207886C */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078868 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0207886C */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207886C */ _t98 = _t97 & 0x00000001u;
         /* 0207886C */ if (_t98) goto L_02078870; else goto L_02078884;
   L_02078870: ; // 0x2078870
@@ -18805,7 +18805,7 @@ void Gambit_fn_02078554(CPUState* cpu) {
         /* 0207889C */ cpu->r[7] = rbrew_read32(cpu->mem, _t101);
         /* 020788A0 */ cpu->r[4] = cpu->r[15] + 0xFFFFAEB8u;
         /* 020788A4 */ cpu->r[6] = cpu->r[19];
-        /* 020788A8 */ _t102 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020788A8 */ _t102 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020788A8 */ _t103 = _t102 & 0x00000001u;
         /* 020788A8 */ if (_t103) goto L_020788AC; // else: addr-0 trap, fall-through
   L_020788AC: ; // 0x20788ac
@@ -18823,8 +18823,8 @@ void Gambit_fn_02078554(CPUState* cpu) {
         /* 020788CC */ Gambit_fn_027FD390(cpu);
         /* 020788D0 */ _t107 = cpu->r[1] + 0x00000050u;
         /* 020788D0 */ cpu->r[10] = rbrew_read8(cpu->mem, _t107);
-        /* 020788D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020788D8 */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020788D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020788D8 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020788D8 */ _t109 = _t108 & 0x00000001u;
         /* 020788D8 */ if (_t109) goto L_02078920; else goto L_020788DC;
   L_020788DC: ; // 0x20788dc
@@ -18849,18 +18849,18 @@ void Gambit_fn_02078554(CPUState* cpu) {
         /* 02078908 */ _t117 = cpu->r[6] + 0x00000000u;
         /* 02078908 */ cpu->r[7] = rbrew_read8(cpu->mem, _t117);
         /* 0207890C */ cpu->r[8] = 0x00080000u;
-        /* 02078910 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[0]);
+        /* 02078910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[0]));
         /* 02078914 */ cpu->r[29] = 0x00000000u;
-        /* 02078918 */ _t118 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078918 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078918 */ _t119 = _t118 & 0x00000001u;
         /* 02078918 */ if (_t119) goto L_02078794; else goto L_0207891C;
   L_0207891C: ; // 0x207891c
         /* 0207891C */ goto L_02078940;
   L_02078920: ; // 0x2078920
         /* 02078920 */ cpu->r[22] = cpu->r[22] + 0xFFFFFFFFu;
-        /* 02078920 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
+        /* 02078920 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
         /* 02078924 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02078928 */ _t120 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078928 */ _t120 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078928 */ _t121 = _t120 & 0x00000001u;
         /* 02078928 */ if (_t121) goto L_0207892C; else goto L_020787C0;
   L_0207892C: ; // 0x207892c
@@ -18872,16 +18872,16 @@ void Gambit_fn_02078554(CPUState* cpu) {
         /* 0207893C */ return;
   L_02078940: ; // 0x2078940
         /* 02078940 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 02078944 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[8]);
+        /* 02078944 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[8]));
         /* 02078948 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 0207894C */ _t123 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207894C */ _t123 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207894C */ _t124 = _t123 & 0x00000001u;
         /* 0207894C */ if (_t124) goto L_02078960; else goto L_02078950;
   L_02078950: ; // 0x2078950
         /* 02078950 */ _t125 = cpu->r[6] + 0x00000000u;
         /* 02078950 */ cpu->r[9] = rbrew_read8(cpu->mem, _t125);
-        /* 02078954 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[0]);
-        /* 02078958 */ _t126 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078954 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[0]));
+        /* 02078958 */ _t126 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078958 */ _t127 = _t126 & 0x00000001u;
         /* 02078958 */ if (_t127) goto L_0207895C; else goto L_02078940;
   L_0207895C: ; // 0x207895c
@@ -18903,23 +18903,23 @@ void Gambit_fn_02078554(CPUState* cpu) {
         /* 02078980 */ _t132 = cpu->r[11] + 0x00000000u;
         /* 02078980 */ cpu->r[0] = rbrew_read8(cpu->mem, _t132);
         /* 02078984 */ cpu->r[31] = 0x00000000u;
-        /* 02078988 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[10]);
+        /* 02078988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[10]));
         /* 0207898C */ cpu->r[0] = 0x00080000u;
-        /* 02078990 */ _t133 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078990 */ _t133 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078990 */ _t134 = _t133 & 0x00000001u;
         /* 02078990 */ if (_t134) goto L_020789B8; else goto L_02078994;
   L_02078994: ; // 0x2078994
         /* 02078994 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02078998 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 02078998 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 0207899C */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 020789A0 */ _t135 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020789A0 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020789A0 */ _t136 = _t135 & 0x00000001u;
         /* 020789A0 */ if (_t136) goto L_020789B4; else goto L_020789A4;
   L_020789A4: ; // 0x20789a4
         /* 020789A4 */ _t137 = cpu->r[11] + 0x00000000u;
         /* 020789A4 */ cpu->r[5] = rbrew_read8(cpu->mem, _t137);
-        /* 020789A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[10]);
-        /* 020789AC */ _t138 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020789A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[10]));
+        /* 020789AC */ _t138 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020789AC */ _t139 = _t138 & 0x00000001u;
         /* 020789AC */ if (_t139) goto L_020789B0; else goto L_02078994;
   L_020789B0: ; // 0x20789b0
@@ -18930,15 +18930,15 @@ void Gambit_fn_02078554(CPUState* cpu) {
         /* 020789B8 */ _t140 = cpu->r[16] + 0x00000458u;
         /* 020789B8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t140);
         /* 020789BC */ cpu->r[0] = cpu->r[10] + 0xFFFFFFFBu;
-        /* 020789C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
-        /* 020789C4 */ _t141 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020789C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
+        /* 020789C4 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020789C4 */ _t142 = _t141 & 0x00000001u;
         /* 020789C4 */ if (_t142) goto L_020789CC; else goto L_020789C8;
   L_020789C8: ; // 0x20789c8
         /* 020789C8 */ cpu->r[31] = cpu->r[10] + 0xFFFFFFFAu;
   L_020789CC: ; // 0x20789cc
-        /* 020789CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020789D0 */ _t143 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020789CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020789D0 */ _t143 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020789D0 */ _t144 = _t143 & 0x00000001u;
         /* 020789D0 */ if (_t144) goto L_020789D4; else goto L_02078A18;
   L_020789D4: ; // 0x20789d4
@@ -18957,8 +18957,8 @@ void Gambit_fn_02078554(CPUState* cpu) {
         /* 020789F8 */ cpu->r[3] = cpu->r[27];
         /* 020789FC */ rbrew_dispatch(cpu, 0x02d0a6e8u);
         /* 02078A00 */ cpu->r[8] = cpu->r[31] + 0x00000005u;
-        /* 02078A04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], cpu->r[29]);
-        /* 02078A08 */ _t148 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02078A04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], cpu->r[29]));
+        /* 02078A08 */ _t148 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02078A08 */ _t149 = _t148 & 0x00000001u;
         /* 02078A08 */ if (_t149) goto L_02078A0C; else goto L_02078A18;
   L_02078A0C: ; // 0x2078a0c
@@ -18990,8 +18990,8 @@ void Gambit_fn_02078554(CPUState* cpu) {
         /* 02078A48 */ Gambit_fn_020A54C4(cpu);
         /* 02078A4C */ _t159 = cpu->r[16] + 0x00000000u;
         /* 02078A4C */ cpu->r[0] = rbrew_read8(cpu->mem, _t159);
-        /* 02078A50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02078A54 */ _t160 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078A50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02078A54 */ _t160 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078A54 */ _t161 = _t160 & 0x00000001u;
         /* 02078A54 */ if (_t161) goto L_02078A68; else goto L_02078A58;
   L_02078A58: ; // 0x2078a58
@@ -19097,9 +19097,9 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
   L_02078B58: ; // 0x2078b58
         /* 02078B58 */ _t25 = cpu->r[22] + 0xFFFFE378u;
         /* 02078B58 */ cpu->r[8] = rbrew_read32(cpu->mem, _t25);
-        /* 02078B5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02078B5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02078B60 */ cpu->r[14] = cpu->r[20];
-        /* 02078B64 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078B64 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078B64 */ _t27 = _t26 & 0x00000001u;
         /* 02078B64 */ if (_t27) goto L_02078B68; else goto L_02078B7C;
   L_02078B68: ; // 0x2078b68
@@ -19112,8 +19112,8 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
   L_02078B7C: ; // 0x2078b7c
         /* 02078B7C */ _t29 = cpu->r[21] + 0xFFFFE374u;
         /* 02078B7C */ cpu->r[9] = rbrew_read32(cpu->mem, _t29);
-        /* 02078B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02078B84 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02078B84 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078B84 */ _t31 = _t30 & 0x00000001u;
         /* 02078B84 */ if (_t31) goto L_02078B88; else goto L_02078B90;
   L_02078B88: ; // 0x2078b88
@@ -19122,8 +19122,8 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
         /* 02078B8C */ _t33 = cpu->r[21] + 0xFFFFE374u;
         /* 02078B8C */ rbrew_write32(cpu->mem, _t33, cpu->r[25]);
   L_02078B90: ; // 0x2078b90
-        /* 02078B90 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[20], 0x00000007u);
-        /* 02078B94 */ _t34 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02078B90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[20], 0x00000007u));
+        /* 02078B94 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02078B94 */ _t35 = _t34 & 0x00000001u;
         /* 02078B94 */ if (_t35) goto L_02078BE0; else goto L_02078B98;
   L_02078B98: ; // 0x2078b98
@@ -19131,7 +19131,7 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
         /* 02078B9C */ cpu->r[3] = cpu->r[1] + 0x00000018u;
         /* 02078BA0 */ cpu->r[4] = cpu->r[30] + 0xFFFFAEE8u;
         /* 02078BA4 */ cpu->r[5] = cpu->r[18];
-        /* 02078BA8 */ _t36 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02078BA8 */ _t36 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02078BA8 */ _t37 = _t36 & 0x00000001u;
         /* 02078BA8 */ if (_t37) goto L_02078BAC; // else: addr-0 trap, fall-through
   L_02078BAC: ; // 0x2078bac
@@ -19149,8 +19149,8 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
         /* 02078BCC */ Gambit_fn_027FD390(cpu);
         /* 02078BD0 */ _t41 = cpu->r[1] + 0x0000004Cu;
         /* 02078BD0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t41);
-        /* 02078BD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02078BD8 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078BD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02078BD8 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078BD8 */ _t43 = _t42 & 0x00000001u;
         /* 02078BD8 */ if (_t43) goto L_02078CB0; else goto L_02078BDC;
   L_02078BDC: ; // 0x2078bdc
@@ -19158,8 +19158,8 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
   L_02078BE0: ; // 0x2078be0
         /* 02078BE0 */ _t44 = cpu->r[31] + 0xFFFFEE14u;
         /* 02078BE0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t44);
-        /* 02078BE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02078BE8 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078BE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02078BE8 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078BE8 */ _t46 = _t45 & 0x00000001u;
         /* 02078BE8 */ if (_t46) goto L_02078BEC; else goto L_02078C24;
   L_02078BEC: ; // 0x2078bec
@@ -19168,8 +19168,8 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
         /* 02078BF4 */ Gambit_fn_02836FFC(cpu);
         /* 02078BF8 */ _t47 = cpu->r[31] + 0xFFFFEE14u;
         /* 02078BF8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t47);
-        /* 02078BFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02078C00 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078BFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02078C00 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078C00 */ _t49 = _t48 & 0x00000001u;
         /* 02078C00 */ if (_t49) goto L_02078C04; else goto L_02078C18;
   L_02078C04: ; // 0x2078c04
@@ -19191,7 +19191,7 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
         /* 02078C2C */ cpu->r[6] = rbrew_read32(cpu->mem, _t52);
         /* 02078C30 */ cpu->r[4] = cpu->r[30] + 0xFFFFAEE8u;
         /* 02078C34 */ cpu->r[5] = cpu->r[18];
-        /* 02078C38 */ _t53 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02078C38 */ _t53 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02078C38 */ _t54 = _t53 & 0x00000001u;
         /* 02078C38 */ if (_t54) goto L_02078C3C; // else: addr-0 trap, fall-through
   L_02078C3C: ; // 0x2078c3c
@@ -19209,8 +19209,8 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
         /* 02078C5C */ Gambit_fn_027FD390(cpu);
         /* 02078C60 */ _t58 = cpu->r[1] + 0x0000004Cu;
         /* 02078C60 */ cpu->r[0] = rbrew_read8(cpu->mem, _t58);
-        /* 02078C64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02078C68 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078C64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02078C68 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078C68 */ _t60 = _t59 & 0x00000001u;
         /* 02078C68 */ if (_t60) goto L_02078CB0; else goto L_02078C6C;
   L_02078C6C: ; // 0x2078c6c
@@ -19234,18 +19234,18 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
         /* 02078C98 */ _t67 = cpu->r[6] + 0x00000000u;
         /* 02078C98 */ cpu->r[8] = rbrew_read8(cpu->mem, _t67);
         /* 02078C9C */ cpu->r[30] = 0x00000000u;
-        /* 02078CA0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[0]);
+        /* 02078CA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[0]));
         /* 02078CA4 */ cpu->r[7] = 0x00080000u;
-        /* 02078CA8 */ _t68 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078CA8 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078CA8 */ _t69 = _t68 & 0x00000001u;
         /* 02078CA8 */ if (_t69) goto L_02078CAC; else goto L_02078E5C;
   L_02078CAC: ; // 0x2078cac
         /* 02078CAC */ goto L_02078E80;
   L_02078CB0: ; // 0x2078cb0
         /* 02078CB0 */ cpu->r[19] = cpu->r[19] + 0xFFFFFFFFu;
-        /* 02078CB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[19], 0x00000000u);
+        /* 02078CB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[19], 0x00000000u));
         /* 02078CB4 */ cpu->r[20] = cpu->r[20] + 0x00000001u;
-        /* 02078CB8 */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078CB8 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078CB8 */ _t71 = _t70 & 0x00000001u;
         /* 02078CB8 */ if (_t71) goto L_02078CBC; else goto L_02078B58;
   L_02078CBC: ; // 0x2078cbc
@@ -19262,9 +19262,9 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
   L_02078CE4: ; // 0x2078ce4
         /* 02078CE4 */ _t72 = cpu->r[26] + 0x00000000u;
         /* 02078CE4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t72);
-        /* 02078CE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02078CE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02078CEC */ cpu->r[23] = cpu->r[31];
-        /* 02078CF0 */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078CF0 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078CF0 */ _t74 = _t73 & 0x00000001u;
         /* 02078CF0 */ if (_t74) goto L_02078CF4; else goto L_02078D08;
   L_02078CF4: ; // 0x2078cf4
@@ -19277,8 +19277,8 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
   L_02078D08: ; // 0x2078d08
         /* 02078D08 */ _t76 = cpu->r[25] + 0x00000000u;
         /* 02078D08 */ cpu->r[9] = rbrew_read32(cpu->mem, _t76);
-        /* 02078D0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02078D10 */ _t77 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078D0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02078D10 */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078D10 */ _t78 = _t77 & 0x00000001u;
         /* 02078D10 */ if (_t78) goto L_02078D14; else goto L_02078D1C;
   L_02078D14: ; // 0x2078d14
@@ -19287,8 +19287,8 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
         /* 02078D18 */ _t80 = cpu->r[25] + 0x00000000u;
         /* 02078D18 */ rbrew_write32(cpu->mem, _t80, cpu->r[21]);
   L_02078D1C: ; // 0x2078d1c
-        /* 02078D1C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000007u);
-        /* 02078D20 */ _t81 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02078D1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000007u));
+        /* 02078D20 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02078D20 */ _t82 = _t81 & 0x00000001u;
         /* 02078D20 */ if (_t82) goto L_02078D6C; else goto L_02078D24;
   L_02078D24: ; // 0x2078d24
@@ -19296,7 +19296,7 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
         /* 02078D28 */ cpu->r[3] = cpu->r[1] + 0x00000018u;
         /* 02078D2C */ cpu->r[4] = cpu->r[14] + 0xFFFFAED0u;
         /* 02078D30 */ cpu->r[5] = cpu->r[18];
-        /* 02078D34 */ _t83 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02078D34 */ _t83 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02078D34 */ _t84 = _t83 & 0x00000001u;
         /* 02078D34 */ if (_t84) goto L_02078D38; // else: addr-0 trap, fall-through
   L_02078D38: ; // 0x2078d38
@@ -19314,8 +19314,8 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
         /* 02078D58 */ Gambit_fn_027FD390(cpu);
         /* 02078D5C */ _t88 = cpu->r[1] + 0x0000004Cu;
         /* 02078D5C */ cpu->r[0] = rbrew_read8(cpu->mem, _t88);
-        /* 02078D60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02078D64 */ _t89 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078D60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02078D64 */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078D64 */ _t90 = _t89 & 0x00000001u;
         /* 02078D64 */ if (_t90) goto L_02078E3C; else goto L_02078D68;
   L_02078D68: ; // 0x2078d68
@@ -19323,8 +19323,8 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
   L_02078D6C: ; // 0x2078d6c
         /* 02078D6C */ _t91 = cpu->r[20] + 0x00000000u;
         /* 02078D6C */ cpu->r[12] = rbrew_read32(cpu->mem, _t91);
-        /* 02078D70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02078D74 */ _t92 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078D70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02078D74 */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078D74 */ _t93 = _t92 & 0x00000001u;
         /* 02078D74 */ if (_t93) goto L_02078D78; else goto L_02078DB0;
   L_02078D78: ; // 0x2078d78
@@ -19333,8 +19333,8 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
         /* 02078D80 */ Gambit_fn_02836FFC(cpu);
         /* 02078D84 */ _t94 = cpu->r[20] + 0x00000000u;
         /* 02078D84 */ cpu->r[10] = rbrew_read32(cpu->mem, _t94);
-        /* 02078D88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02078D8C */ _t95 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078D88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02078D8C */ _t95 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078D8C */ _t96 = _t95 & 0x00000001u;
         /* 02078D8C */ if (_t96) goto L_02078D90; else goto L_02078DA4;
   L_02078D90: ; // 0x2078d90
@@ -19356,7 +19356,7 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
         /* 02078DB8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t99);
         /* 02078DBC */ cpu->r[4] = cpu->r[14] + 0xFFFFAED0u;
         /* 02078DC0 */ cpu->r[5] = cpu->r[18];
-        /* 02078DC4 */ _t100 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02078DC4 */ _t100 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02078DC4 */ _t101 = _t100 & 0x00000001u;
         /* 02078DC4 */ if (_t101) goto L_02078DC8; // else: addr-0 trap, fall-through
   L_02078DC8: ; // 0x2078dc8
@@ -19374,8 +19374,8 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
         /* 02078DE8 */ Gambit_fn_027FD390(cpu);
         /* 02078DEC */ _t105 = cpu->r[1] + 0x0000004Cu;
         /* 02078DEC */ cpu->r[0] = rbrew_read8(cpu->mem, _t105);
-        /* 02078DF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02078DF4 */ _t106 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078DF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02078DF4 */ _t106 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078DF4 */ _t107 = _t106 & 0x00000001u;
         /* 02078DF4 */ if (_t107) goto L_02078E3C; else goto L_02078DF8;
   L_02078DF8: ; // 0x2078df8
@@ -19399,18 +19399,18 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
         /* 02078E24 */ _t114 = cpu->r[6] + 0x00000000u;
         /* 02078E24 */ cpu->r[8] = rbrew_read8(cpu->mem, _t114);
         /* 02078E28 */ cpu->r[30] = 0x00000000u;
-        /* 02078E2C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[0]);
+        /* 02078E2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[0]));
         /* 02078E30 */ cpu->r[7] = 0x00080000u;
-        /* 02078E34 */ _t115 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078E34 */ _t115 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078E34 */ _t116 = _t115 & 0x00000001u;
         /* 02078E34 */ if (_t116) goto L_02078CAC; else goto L_02078E38;
   L_02078E38: ; // 0x2078e38
         /* 02078E38 */ goto L_02078E5C;
   L_02078E3C: ; // 0x2078e3c
         /* 02078E3C */ cpu->r[19] = cpu->r[19] + 0xFFFFFFFFu;
-        /* 02078E3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[19], 0x00000000u);
+        /* 02078E3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[19], 0x00000000u));
         /* 02078E40 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02078E44 */ _t117 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078E44 */ _t117 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078E44 */ _t118 = _t117 & 0x00000001u;
         /* 02078E44 */ if (_t118) goto L_02078E48; else goto L_02078CE4;
   L_02078E48: ; // 0x2078e48
@@ -19422,16 +19422,16 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
         /* 02078E58 */ return;
   L_02078E5C: ; // 0x2078e5c
         /* 02078E5C */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02078E60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 02078E60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 02078E64 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 02078E68 */ _t120 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02078E68 */ _t120 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02078E68 */ _t121 = _t120 & 0x00000001u;
         /* 02078E68 */ if (_t121) goto L_02078E7C; else goto L_02078E6C;
   L_02078E6C: ; // 0x2078e6c
         /* 02078E6C */ _t122 = cpu->r[6] + 0x00000000u;
         /* 02078E6C */ cpu->r[10] = rbrew_read8(cpu->mem, _t122);
-        /* 02078E70 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[0]);
-        /* 02078E74 */ _t123 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078E70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[0]));
+        /* 02078E74 */ _t123 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078E74 */ _t124 = _t123 & 0x00000001u;
         /* 02078E74 */ if (_t124) goto L_02078E78; else goto L_02078E5C;
   L_02078E78: ; // 0x2078e78
@@ -19452,23 +19452,23 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
         /* 02078E9C */ _t128 = cpu->r[11] + 0x00000000u;
         /* 02078E9C */ cpu->r[5] = rbrew_read8(cpu->mem, _t128);
         /* 02078EA0 */ cpu->r[31] = 0x00000000u;
-        /* 02078EA4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[10]);
+        /* 02078EA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[10]));
         /* 02078EA8 */ cpu->r[5] = 0x00080000u;
-        /* 02078EAC */ _t129 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078EAC */ _t129 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078EAC */ _t130 = _t129 & 0x00000001u;
         /* 02078EAC */ if (_t130) goto L_02078ED4; else goto L_02078EB0;
   L_02078EB0: ; // 0x2078eb0
         /* 02078EB0 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02078EB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 02078EB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 02078EB8 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 02078EBC */ _t131 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02078EBC */ _t131 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02078EBC */ _t132 = _t131 & 0x00000001u;
         /* 02078EBC */ if (_t132) goto L_02078ED0; else goto L_02078EC0;
   L_02078EC0: ; // 0x2078ec0
         /* 02078EC0 */ _t133 = cpu->r[11] + 0x00000000u;
         /* 02078EC0 */ cpu->r[6] = rbrew_read8(cpu->mem, _t133);
-        /* 02078EC4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[10]);
-        /* 02078EC8 */ _t134 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078EC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[10]));
+        /* 02078EC8 */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078EC8 */ _t135 = _t134 & 0x00000001u;
         /* 02078EC8 */ if (_t135) goto L_02078ECC; else goto L_02078EB0;
   L_02078ECC: ; // 0x2078ecc
@@ -19479,15 +19479,15 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
         /* 02078ED4 */ _t136 = cpu->r[17] + 0x00000458u;
         /* 02078ED4 */ cpu->r[4] = rbrew_read32(cpu->mem, _t136);
         /* 02078ED8 */ cpu->r[0] = cpu->r[4] + 0xFFFFFFFBu;
-        /* 02078EDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
-        /* 02078EE0 */ _t137 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02078EDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
+        /* 02078EE0 */ _t137 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02078EE0 */ _t138 = _t137 & 0x00000001u;
         /* 02078EE0 */ if (_t138) goto L_02078EE8; else goto L_02078EE4;
   L_02078EE4: ; // 0x2078ee4
         /* 02078EE4 */ cpu->r[31] = cpu->r[4] + 0xFFFFFFFAu;
   L_02078EE8: ; // 0x2078ee8
-        /* 02078EE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02078EEC */ _t139 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02078EE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02078EEC */ _t139 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02078EEC */ _t140 = _t139 & 0x00000001u;
         /* 02078EEC */ if (_t140) goto L_02078EF0; else goto L_02078F30;
   L_02078EF0: ; // 0x2078ef0
@@ -19506,8 +19506,8 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
         /* 02078F14 */ cpu->r[3] = cpu->r[26];
         /* 02078F18 */ rbrew_dispatch(cpu, 0x02d0a6e8u);
         /* 02078F1C */ cpu->r[0] = cpu->r[31] + 0x00000005u;
-        /* 02078F20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[30]);
-        /* 02078F24 */ _t144 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02078F20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[30]));
+        /* 02078F24 */ _t144 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02078F24 */ _t145 = _t144 & 0x00000001u;
         /* 02078F24 */ if (_t145) goto L_02078F28; else goto L_02078F30;
   L_02078F28: ; // 0x2078f28
@@ -19537,8 +19537,8 @@ void Gambit_fn_02078A7C(CPUState* cpu) {
         /* 02078F60 */ Gambit_fn_020A54C4(cpu);
         /* 02078F64 */ _t154 = cpu->r[17] + 0x00000000u;
         /* 02078F64 */ cpu->r[5] = rbrew_read8(cpu->mem, _t154);
-        /* 02078F68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 02078F6C */ _t155 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078F68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 02078F6C */ _t155 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078F6C */ _t156 = _t155 & 0x00000001u;
         /* 02078F6C */ if (_t156) goto L_02078F80; else goto L_02078F70;
   L_02078F70: ; // 0x2078f70
@@ -19567,18 +19567,18 @@ void Gambit_fn_02078F94(CPUState* cpu) {
         /* 02078F9C */ _t1 = cpu->r[1] + 0x0000001Cu;
         /* 02078F9C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02078FA0 */ cpu->r[31] = cpu->r[3];
-        /* 02078FA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02078FA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02078FA4 */ _t2 = cpu->r[1] + 0x00000024u;
         /* 02078FA4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 02078FA8 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078FA8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078FA8 */ _t4 = _t3 & 0x00000001u;
         /* 02078FA8 */ if (_t4) goto L_02078FAC; else goto L_02078FBC;
   L_02078FAC: ; // 0x2078fac
         /* 02078FAC */ cpu->r[3] = 0x0000029Cu;
         /* 02078FB0 */ Gambit_fn_02801A78(cpu);
         /* 02078FB4 */ cpu->r[31] = cpu->r[3];
-        /* 02078FB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02078FB8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078FB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02078FB8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078FB8 */ _t6 = _t5 & 0x00000001u;
         /* 02078FB8 */ if (_t6) goto L_02079058; else goto L_02078FBC;
   L_02078FBC: ; // 0x2078fbc
@@ -19661,18 +19661,18 @@ void Gambit_fn_02078F98(CPUState* cpu) {
         /* 02078F9C */ _t1 = cpu->r[1] + 0x0000001Cu;
         /* 02078F9C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02078FA0 */ cpu->r[31] = cpu->r[3];
-        /* 02078FA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02078FA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02078FA4 */ _t2 = cpu->r[1] + 0x00000024u;
         /* 02078FA4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 02078FA8 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078FA8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078FA8 */ _t4 = _t3 & 0x00000001u;
         /* 02078FA8 */ if (_t4) goto L_02078FAC; else goto L_02078FBC;
   L_02078FAC: ; // 0x2078fac
         /* 02078FAC */ cpu->r[3] = 0x0000029Cu;
         /* 02078FB0 */ Gambit_fn_02801A78(cpu);
         /* 02078FB4 */ cpu->r[31] = cpu->r[3];
-        /* 02078FB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02078FB8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02078FB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02078FB8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02078FB8 */ _t6 = _t5 & 0x00000001u;
         /* 02078FB8 */ if (_t6) goto L_02079058; else goto L_02078FBC;
   L_02078FBC: ; // 0x2078fbc
@@ -19769,9 +19769,9 @@ void Gambit_fn_02079070(CPUState* cpu) {
         /* 02079098 */ Gambit_fn_027B8224(cpu);
         /* 0207909C */ _t6 = cpu->r[31] + 0x00000000u;
         /* 0207909C */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 020790A0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 020790A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 020790A4 */ cpu->r[12] = cpu->r[30] + 0x00000290u;
-        /* 020790A8 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020790A8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020790A8 */ _t8 = _t7 & 0x00000001u;
         /* 020790A8 */ if (_t8) goto L_020790AC; else goto L_020790B4;
   L_020790AC: ; // 0x20790ac
@@ -19789,9 +19789,9 @@ void Gambit_fn_02079070(CPUState* cpu) {
         /* 020790C8 */ cpu->r[0] = 0x10010000u;
         /* 020790CC */ cpu->r[11] = cpu->r[11] + 0xFFFFAD58u;
         /* 020790D0 */ cpu->r[4] = 0x00000003u;
-        /* 020790D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
+        /* 020790D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
         /* 020790D8 */ cpu->r[0] = cpu->r[0] + 0xFFFFAF34u;
-        /* 020790DC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020790DC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020790DC */ _t13 = _t12 & 0x00000001u;
         /* 020790DC */ if (_t13) goto L_020790E0; else goto L_0207910C;
   L_020790E0: ; // 0x20790e0
@@ -19813,8 +19813,8 @@ void Gambit_fn_02079070(CPUState* cpu) {
         /* 02079104 */ rbrew_write_f32(cpu->mem, _t19, cpu->f[0]);
         /* 02079108 */ goto L_02079168;
   L_0207910C: ; // 0x207910c
-        /* 0207910C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000001u);
-        /* 02079110 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207910C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000001u));
+        /* 02079110 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079110 */ _t21 = _t20 & 0x00000001u;
         /* 02079110 */ if (_t21) goto L_02079114; else goto L_02079140;
   L_02079114: ; // 0x2079114
@@ -19888,9 +19888,9 @@ void Gambit_fn_02079074(CPUState* cpu) {
         /* 02079098 */ Gambit_fn_027B8224(cpu);
         /* 0207909C */ _t6 = cpu->r[31] + 0x00000000u;
         /* 0207909C */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 020790A0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 020790A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 020790A4 */ cpu->r[12] = cpu->r[30] + 0x00000290u;
-        /* 020790A8 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020790A8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020790A8 */ _t8 = _t7 & 0x00000001u;
         /* 020790A8 */ if (_t8) goto L_020790AC; else goto L_020790B4;
   L_020790AC: ; // 0x20790ac
@@ -19908,9 +19908,9 @@ void Gambit_fn_02079074(CPUState* cpu) {
         /* 020790C8 */ cpu->r[0] = 0x10010000u;
         /* 020790CC */ cpu->r[11] = cpu->r[11] + 0xFFFFAD58u;
         /* 020790D0 */ cpu->r[4] = 0x00000003u;
-        /* 020790D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
+        /* 020790D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
         /* 020790D8 */ cpu->r[0] = cpu->r[0] + 0xFFFFAF34u;
-        /* 020790DC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020790DC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020790DC */ _t13 = _t12 & 0x00000001u;
         /* 020790DC */ if (_t13) goto L_020790E0; else goto L_0207910C;
   L_020790E0: ; // 0x20790e0
@@ -19932,8 +19932,8 @@ void Gambit_fn_02079074(CPUState* cpu) {
         /* 02079104 */ rbrew_write_f32(cpu->mem, _t19, cpu->f[0]);
         /* 02079108 */ goto L_02079168;
   L_0207910C: ; // 0x207910c
-        /* 0207910C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000001u);
-        /* 02079110 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207910C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000001u));
+        /* 02079110 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079110 */ _t21 = _t20 & 0x00000001u;
         /* 02079110 */ if (_t21) goto L_02079114; else goto L_02079140;
   L_02079114: ; // 0x2079114
@@ -19996,8 +19996,8 @@ void Gambit_fn_02079180(CPUState* cpu) {
         /* 02079188 */ cpu->r[1] = _t1;
         /* 0207918C */ _t2 = cpu->r[4] + 0x00000000u;
         /* 0207918C */ cpu->r[0] = rbrew_read32(cpu->mem, _t2);
-        /* 02079190 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000006u);
-        /* 02079194 */ _t3 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02079190 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000006u));
+        /* 02079194 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02079194 */ _t4 = _t3 & 0x00000001u;
         /* 02079194 */ if (_t4) goto L_020791C0; else goto L_02079198;
   L_02079198: ; // 0x2079198
@@ -20046,8 +20046,8 @@ void Gambit_fn_02079188(CPUState* cpu) {
         /* 02079188 */ cpu->r[1] = _t0;
         /* 0207918C */ _t1 = cpu->r[4] + 0x00000000u;
         /* 0207918C */ cpu->r[0] = rbrew_read32(cpu->mem, _t1);
-        /* 02079190 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000006u);
-        /* 02079194 */ _t2 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02079190 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000006u));
+        /* 02079194 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02079194 */ _t3 = _t2 & 0x00000001u;
         /* 02079194 */ if (_t3) goto L_020791C0; else goto L_02079198;
   L_02079198: ; // 0x2079198
@@ -20242,11 +20242,11 @@ void Gambit_fn_02079280(CPUState* cpu) {
         /* 020792C0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t9);
         /* 020792C4 */ cpu->r[29] = 0x10010000u;
         /* 020792C8 */ cpu->r[30] = 0x10010000u;
-        /* 020792CC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
+        /* 020792CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
         /* 020792D0 */ cpu->r[29] = cpu->r[29] + 0xFFFFAF58u;
         /* 020792D4 */ cpu->r[30] = cpu->r[30] + 0xFFFFAD58u;
         /* 020792D8 */ cpu->r[31] = cpu->r[3];
-        /* 020792DC */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020792DC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020792DC */ _t11 = _t10 & 0x00000001u;
         /* 020792DC */ if (_t11) goto L_02079338; else goto L_020792E0;
   L_020792E0: ; // 0x20792e0
@@ -20336,11 +20336,11 @@ void Gambit_fn_02079284(CPUState* cpu) {
         /* 020792C0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t9);
         /* 020792C4 */ cpu->r[29] = 0x10010000u;
         /* 020792C8 */ cpu->r[30] = 0x10010000u;
-        /* 020792CC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
+        /* 020792CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
         /* 020792D0 */ cpu->r[29] = cpu->r[29] + 0xFFFFAF58u;
         /* 020792D4 */ cpu->r[30] = cpu->r[30] + 0xFFFFAD58u;
         /* 020792D8 */ cpu->r[31] = cpu->r[3];
-        /* 020792DC */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020792DC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020792DC */ _t11 = _t10 & 0x00000001u;
         /* 020792DC */ if (_t11) goto L_02079338; else goto L_020792E0;
   L_020792E0: ; // 0x20792e0
@@ -20437,12 +20437,12 @@ void Gambit_fn_02079368(CPUState* cpu) {
         /* 020793C0 */ Gambit_fn_02079280(cpu);
         /* 020793C4 */ cpu->r[12] = 0x10010000u;
         /* 020793C8 */ cpu->r[0] = 0x10010000u;
-        /* 020793CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020793CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020793D0 */ cpu->r[12] = cpu->r[12] + 0xFFFFAD58u;
         /* 020793D4 */ cpu->r[0] = cpu->r[0] + 0xFFFFAF68u;
         /* 020793D8 */ cpu->r[4] = 0x00000005u;
         /* 020793DC */ cpu->r[3] = cpu->r[30];
-        /* 020793E0 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020793E0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020793E0 */ _t11 = _t10 & 0x00000001u;
         /* 020793E0 */ if (_t11) goto L_02079414; else goto L_020793E4;
   L_020793E4: ; // 0x20793e4
@@ -20527,12 +20527,12 @@ void Gambit_fn_0207936C(CPUState* cpu) {
         /* 020793C0 */ Gambit_fn_02079280(cpu);
         /* 020793C4 */ cpu->r[12] = 0x10010000u;
         /* 020793C8 */ cpu->r[0] = 0x10010000u;
-        /* 020793CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020793CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020793D0 */ cpu->r[12] = cpu->r[12] + 0xFFFFAD58u;
         /* 020793D4 */ cpu->r[0] = cpu->r[0] + 0xFFFFAF68u;
         /* 020793D8 */ cpu->r[4] = 0x00000005u;
         /* 020793DC */ cpu->r[3] = cpu->r[30];
-        /* 020793E0 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020793E0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020793E0 */ _t11 = _t10 & 0x00000001u;
         /* 020793E0 */ if (_t11) goto L_02079414; else goto L_020793E4;
   L_020793E4: ; // 0x20793e4
@@ -21010,17 +21010,17 @@ void Gambit_fn_0207963C(CPUState* cpu) {
   L_0207963C: ; // 0x207963c
         /* 0207963C */ _t0 = cpu->r[3] + 0x0000028Cu;
         /* 0207963C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 02079640 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02079644 */ _t1 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02079640 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02079644 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02079644 */ _t2 = _t1 & 0x00000001u;
         /* 02079644 */ if (_t2) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02079644 */ goto L_02079648;
   L_02079648: ; // 0x2079648
         /* 02079648 */ cpu->r[12] = cpu->r[12] + 0xFFFFFFFFu;
-        /* 02079648 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02079648 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0207964C */ _t3 = cpu->r[3] + 0x0000028Cu;
         /* 0207964C */ rbrew_write32(cpu->mem, _t3, cpu->r[12]);
-        /* 02079650 */ _t4 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02079650 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02079650 */ _t5 = _t4 & 0x00000001u;
         /* 02079650 */ if (_t5) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02079650 */ goto L_02079654;
@@ -21074,9 +21074,9 @@ void Gambit_fn_02079664(CPUState* cpu) {
         /* 020796B8 */ cpu->r[12] = _t9;
         /* 020796BC */ cpu->r[30] = cpu->r[3];
         /* 020796C0 */ cpu->r[4] = 0x101D0000u;
-        /* 020796C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020796C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020796C8 */ cpu->r[4] = cpu->r[4] + 0xFFFFED90u;
-        /* 020796CC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020796CC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020796CC */ _t11 = _t10 & 0x00000001u;
         /* 020796CC */ if (_t11) goto L_020796D0; else goto L_020796E4;
   L_020796D0: ; // 0x20796d0
@@ -21088,8 +21088,8 @@ void Gambit_fn_02079664(CPUState* cpu) {
         /* 020796E0 */ _t13 = cpu->r[4] + 0x00000000u;
         /* 020796E0 */ rbrew_write32(cpu->mem, _t13, cpu->r[10]);
   L_020796E4: ; // 0x20796e4
-        /* 020796E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 020796E8 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020796E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 020796E8 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020796E8 */ _t15 = _t14 & 0x00000001u;
         /* 020796E8 */ if (_t15) goto L_02079708; else goto L_020796EC;
   L_020796EC: ; // 0x20796ec
@@ -21100,8 +21100,8 @@ void Gambit_fn_02079664(CPUState* cpu) {
         /* 020796F4 */ cpu->ctr = cpu->r[0];
         /* 020796F8 */ cpu->r[3] = cpu->r[30];
         /* 020796FC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02079700 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02079704 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02079704 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079704 */ _t19 = _t18 & 0x00000001u;
         /* 02079704 */ if (_t19) goto L_02079708; else goto L_0207970C;
   L_02079708: ; // 0x2079708
@@ -21164,9 +21164,9 @@ void Gambit_fn_02079668(CPUState* cpu) {
         /* 020796B8 */ cpu->r[12] = _t9;
         /* 020796BC */ cpu->r[30] = cpu->r[3];
         /* 020796C0 */ cpu->r[4] = 0x101D0000u;
-        /* 020796C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020796C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020796C8 */ cpu->r[4] = cpu->r[4] + 0xFFFFED90u;
-        /* 020796CC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020796CC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020796CC */ _t11 = _t10 & 0x00000001u;
         /* 020796CC */ if (_t11) goto L_020796D0; else goto L_020796E4;
   L_020796D0: ; // 0x20796d0
@@ -21178,8 +21178,8 @@ void Gambit_fn_02079668(CPUState* cpu) {
         /* 020796E0 */ _t13 = cpu->r[4] + 0x00000000u;
         /* 020796E0 */ rbrew_write32(cpu->mem, _t13, cpu->r[10]);
   L_020796E4: ; // 0x20796e4
-        /* 020796E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 020796E8 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020796E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 020796E8 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020796E8 */ _t15 = _t14 & 0x00000001u;
         /* 020796E8 */ if (_t15) goto L_02079708; else goto L_020796EC;
   L_020796EC: ; // 0x20796ec
@@ -21190,8 +21190,8 @@ void Gambit_fn_02079668(CPUState* cpu) {
         /* 020796F4 */ cpu->ctr = cpu->r[0];
         /* 020796F8 */ cpu->r[3] = cpu->r[30];
         /* 020796FC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02079700 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02079704 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02079704 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079704 */ _t19 = _t18 & 0x00000001u;
         /* 02079704 */ if (_t19) goto L_02079708; else goto L_0207970C;
   L_02079708: ; // 0x2079708
@@ -21410,9 +21410,9 @@ void Gambit_fn_02079908(CPUState* cpu) {
         /* 02053C48 */ cpu->r[23] = cpu->r[3];
         /* 02053C4C */ cpu->r[30] = cpu->r[4];
         /* 02053C50 */ cpu->r[31] = 0x101E0000u;
-        /* 02053C54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02053C54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02053C58 */ cpu->r[31] = cpu->r[31] + 0xFFFF9878u;
-        /* 02053C5C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02053C5C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02053C5C */ _t4 = _t3 & 0x00000001u;
         /* 02053C5C */ if (_t4) goto L_02053C60; else goto L_02053CA8;
   L_02053C60: ; // 0x2053c60
@@ -21438,8 +21438,8 @@ void Gambit_fn_02079908(CPUState* cpu) {
   L_02053CA8: ; // 0x2053ca8
         /* 02053CA8 */ _t6 = cpu->r[31] + 0x00000054u;
         /* 02053CA8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t6);
-        /* 02053CAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 02053CB0 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02053CAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 02053CB0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02053CB0 */ _t8 = _t7 & 0x00000001u;
         /* 02053CB0 */ if (_t8) goto L_02053CB4; else goto L_02053DA8;
   L_02053CB4: ; // 0x2053cb4
@@ -21455,9 +21455,9 @@ void Gambit_fn_02079908(CPUState* cpu) {
   L_02053CD8: ; // 0x2053cd8
         /* 02053CD8 */ _t9 = cpu->r[22] + 0xFFFFE36Cu;
         /* 02053CD8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 02053CDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02053CDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02053CE0 */ cpu->r[28] = cpu->r[29];
-        /* 02053CE4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02053CE4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02053CE4 */ _t11 = _t10 & 0x00000001u;
         /* 02053CE4 */ if (_t11) goto L_02053CE8; else goto L_02053D00;
   L_02053CE8: ; // 0x2053ce8
@@ -21471,8 +21471,8 @@ void Gambit_fn_02079908(CPUState* cpu) {
   L_02053D00: ; // 0x2053d00
         /* 02053D00 */ _t13 = cpu->r[20] + 0xFFFFE368u;
         /* 02053D00 */ cpu->r[8] = rbrew_read32(cpu->mem, _t13);
-        /* 02053D04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02053D08 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02053D04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02053D08 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02053D08 */ _t15 = _t14 & 0x00000001u;
         /* 02053D08 */ if (_t15) goto L_02053D0C; else goto L_02053D14;
   L_02053D0C: ; // 0x2053d0c
@@ -21481,8 +21481,8 @@ void Gambit_fn_02079908(CPUState* cpu) {
         /* 02053D10 */ _t17 = cpu->r[20] + 0xFFFFE368u;
         /* 02053D10 */ rbrew_write32(cpu->mem, _t17, cpu->r[21]);
   L_02053D14: ; // 0x2053d14
-        /* 02053D14 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000004u);
-        /* 02053D18 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02053D14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000004u));
+        /* 02053D18 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02053D18 */ _t19 = _t18 & 0x00000001u;
         /* 02053D18 */ if (_t19) goto L_02053D40; else goto L_02053D1C;
   L_02053D1C: ; // 0x2053d1c
@@ -21491,12 +21491,12 @@ void Gambit_fn_02079908(CPUState* cpu) {
         /* 02053D24 */ cpu->r[5] = 0x00000000u;
         /* 02053D28 */ Gambit_fn_028A6634(cpu);
         /* 02053D2C */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 02053D30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000004u);
-        /* 02053D34 */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02053D30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000004u));
+        /* 02053D34 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02053D34 */ _t21 = _t20 & 0x00000001u;
         /* 02053D34 */ if (_t21) goto L_02053DA8; else goto L_02053D38;
   L_02053D38: ; // 0x2053d38
-        /* 02053D38 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02053D38 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02053D38 */ _t23 = _t22 & 0x00000001u;
         /* 02053D38 */ if (_t23) goto L_02053CD8; else goto L_02053D3C;
   L_02053D3C: ; // 0x2053d3c
@@ -21504,8 +21504,8 @@ void Gambit_fn_02079908(CPUState* cpu) {
   L_02053D40: ; // 0x2053d40
         /* 02053D40 */ _t24 = cpu->r[19] + 0xFFFFE364u;
         /* 02053D40 */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
-        /* 02053D44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02053D48 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02053D44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02053D48 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02053D48 */ _t26 = _t25 & 0x00000001u;
         /* 02053D48 */ if (_t26) goto L_02053D4C; else goto L_02053D84;
   L_02053D4C: ; // 0x2053d4c
@@ -21514,8 +21514,8 @@ void Gambit_fn_02079908(CPUState* cpu) {
         /* 02053D54 */ Gambit_fn_02836FFC(cpu);
         /* 02053D58 */ _t27 = cpu->r[19] + 0xFFFFE364u;
         /* 02053D58 */ cpu->r[10] = rbrew_read32(cpu->mem, _t27);
-        /* 02053D5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02053D60 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02053D5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02053D60 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02053D60 */ _t29 = _t28 & 0x00000001u;
         /* 02053D60 */ if (_t29) goto L_02053D64; else goto L_02053D78;
   L_02053D64: ; // 0x2053d64
@@ -21538,12 +21538,12 @@ void Gambit_fn_02079908(CPUState* cpu) {
         /* 02053D90 */ cpu->r[4] = cpu->r[29];
         /* 02053D94 */ Gambit_fn_028A6634(cpu);
         /* 02053D98 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 02053D9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000004u);
-        /* 02053DA0 */ _t33 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02053D9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000004u));
+        /* 02053DA0 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02053DA0 */ _t34 = _t33 & 0x00000001u;
         /* 02053DA0 */ if (_t34) goto L_02053DA8; else goto L_02053DA4;
   L_02053DA4: ; // 0x2053da4
-        /* 02053DA4 */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02053DA4 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02053DA4 */ _t36 = _t35 & 0x00000001u;
         /* 02053DA4 */ if (_t36) goto L_02053CD8; else goto L_02053DA8;
   L_02053DA8: ; // 0x2053da8
@@ -21569,15 +21569,15 @@ void Gambit_fn_02079914(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02079914: ; // 0x2079914
-        /* 02079914 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02079918 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079914 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02079918 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079918 */ _t1 = _t0 & 0x00000001u;
         /* 02079918 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02079918 */ goto L_0207991C;
   L_0207991C: ; // 0x207991c
         /* 0207991C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0207991C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02079920 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207991C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02079920 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079920 */ _t3 = _t2 & 0x00000001u;
         /* 02079920 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02079920 */ goto L_02079924;
@@ -21596,8 +21596,8 @@ void Gambit_fn_02079914(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -21611,15 +21611,15 @@ void Gambit_fn_02079914(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -21647,15 +21647,15 @@ void Gambit_fn_02079928(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02079928: ; // 0x2079928
-        /* 02079928 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207992C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079928 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207992C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207992C */ _t1 = _t0 & 0x00000001u;
         /* 0207992C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207992C */ goto L_02079930;
   L_02079930: ; // 0x2079930
         /* 02079930 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02079930 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02079934 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079930 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02079934 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079934 */ _t3 = _t2 & 0x00000001u;
         /* 02079934 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02079934 */ goto L_02079938;
@@ -21674,8 +21674,8 @@ void Gambit_fn_02079928(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -21689,15 +21689,15 @@ void Gambit_fn_02079928(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -21734,11 +21734,11 @@ void Gambit_fn_0207993C(CPUState* cpu) {
         /* 02079948 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02079948 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0207994C */ cpu->r[30] = cpu->r[3];
-        /* 0207994C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207994C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02079950 */ cpu->r[31] = cpu->r[4];
         /* 02079954 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02079954 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02079958 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079958 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079958 */ _t5 = _t4 & 0x00000001u;
         /* 02079958 */ if (_t5) goto L_020799C8; else goto L_0207995C;
   L_0207995C: ; // 0x207995c
@@ -21752,10 +21752,10 @@ void Gambit_fn_0207993C(CPUState* cpu) {
         /* 02079974 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02079974 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02079978 */ cpu->r[11] = cpu->r[11] + 0xFFFFB258u;
-        /* 0207997C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207997C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02079980 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02079980 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02079984 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079984 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079984 */ _t10 = _t9 & 0x00000001u;
         /* 02079984 */ if (_t10) goto L_020799B8; else goto L_02079988;
   L_02079988: ; // 0x2079988
@@ -21776,8 +21776,8 @@ void Gambit_fn_0207993C(CPUState* cpu) {
         /* 020799B4 */ Gambit_fn_02068798(cpu);
   L_020799B8: ; // 0x20799b8
         /* 020799B8 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020799B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020799BC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020799B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020799BC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020799BC */ _t15 = _t14 & 0x00000001u;
         /* 020799BC */ if (_t15) goto L_020799C8; else goto L_020799C0;
   L_020799C0: ; // 0x20799c0
@@ -21808,11 +21808,11 @@ void Gambit_fn_02079940(CPUState* cpu) {
         /* 02079948 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02079948 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0207994C */ cpu->r[30] = cpu->r[3];
-        /* 0207994C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207994C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02079950 */ cpu->r[31] = cpu->r[4];
         /* 02079954 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02079954 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02079958 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079958 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079958 */ _t5 = _t4 & 0x00000001u;
         /* 02079958 */ if (_t5) goto L_020799C8; else goto L_0207995C;
   L_0207995C: ; // 0x207995c
@@ -21826,10 +21826,10 @@ void Gambit_fn_02079940(CPUState* cpu) {
         /* 02079974 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02079974 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02079978 */ cpu->r[11] = cpu->r[11] + 0xFFFFB258u;
-        /* 0207997C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207997C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02079980 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02079980 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02079984 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079984 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079984 */ _t10 = _t9 & 0x00000001u;
         /* 02079984 */ if (_t10) goto L_020799B8; else goto L_02079988;
   L_02079988: ; // 0x2079988
@@ -21850,8 +21850,8 @@ void Gambit_fn_02079940(CPUState* cpu) {
         /* 020799B4 */ Gambit_fn_02068798(cpu);
   L_020799B8: ; // 0x20799b8
         /* 020799B8 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020799B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020799BC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020799B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020799BC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020799BC */ _t15 = _t14 & 0x00000001u;
         /* 020799BC */ if (_t15) goto L_020799C8; else goto L_020799C0;
   L_020799C0: ; // 0x20799c0
@@ -21906,15 +21906,15 @@ void Gambit_fn_020799F8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020799F8: ; // 0x20799f8
-        /* 020799F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020799FC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020799F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020799FC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020799FC */ _t1 = _t0 & 0x00000001u;
         /* 020799FC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020799FC */ goto L_02079A00;
   L_02079A00: ; // 0x2079a00
         /* 02079A00 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02079A00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02079A04 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079A00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02079A04 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079A04 */ _t3 = _t2 & 0x00000001u;
         /* 02079A04 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02079A04 */ goto L_02079A08;
@@ -21933,8 +21933,8 @@ void Gambit_fn_020799F8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -21948,15 +21948,15 @@ void Gambit_fn_020799F8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -22002,15 +22002,15 @@ void Gambit_fn_02079A28(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02079A28: ; // 0x2079a28
-        /* 02079A28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02079A2C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079A28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02079A2C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079A2C */ _t1 = _t0 & 0x00000001u;
         /* 02079A2C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02079A2C */ goto L_02079A30;
   L_02079A30: ; // 0x2079a30
         /* 02079A30 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02079A30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02079A34 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079A30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02079A34 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079A34 */ _t3 = _t2 & 0x00000001u;
         /* 02079A34 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02079A34 */ goto L_02079A38;
@@ -22029,8 +22029,8 @@ void Gambit_fn_02079A28(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -22044,15 +22044,15 @@ void Gambit_fn_02079A28(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -22080,15 +22080,15 @@ void Gambit_fn_02079A3C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02079A3C: ; // 0x2079a3c
-        /* 02079A3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02079A40 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079A3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02079A40 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079A40 */ _t1 = _t0 & 0x00000001u;
         /* 02079A40 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02079A40 */ goto L_02079A44;
   L_02079A44: ; // 0x2079a44
         /* 02079A44 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02079A44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02079A48 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079A44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02079A48 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079A48 */ _t3 = _t2 & 0x00000001u;
         /* 02079A48 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02079A48 */ goto L_02079A4C;
@@ -22107,8 +22107,8 @@ void Gambit_fn_02079A3C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -22122,15 +22122,15 @@ void Gambit_fn_02079A3C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -22158,15 +22158,15 @@ void Gambit_fn_02079A50(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02079A50: ; // 0x2079a50
-        /* 02079A50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02079A54 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079A50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02079A54 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079A54 */ _t1 = _t0 & 0x00000001u;
         /* 02079A54 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02079A54 */ goto L_02079A58;
   L_02079A58: ; // 0x2079a58
         /* 02079A58 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02079A58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02079A5C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079A58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02079A5C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079A5C */ _t3 = _t2 & 0x00000001u;
         /* 02079A5C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02079A5C */ goto L_02079A60;
@@ -22185,8 +22185,8 @@ void Gambit_fn_02079A50(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -22200,15 +22200,15 @@ void Gambit_fn_02079A50(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -22350,10 +22350,10 @@ void Gambit_fn_02079AC4(CPUState* cpu) {
         /* 02079AC4 */ cpu->r[12] = 0x101D0000u;
         /* 02079AC8 */ _t0 = cpu->r[12] + 0xFFFFE370u;
         /* 02079AC8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 02079ACC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02079ACC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02079AD0 */ cpu->r[12] = 0x101D0000u;
         /* 02079AD4 */ cpu->r[12] = cpu->r[12] + 0xFFFFEE18u;
-        /* 02079AD8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079AD8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079AD8 */ _t2 = _t1 & 0x00000001u;
         /* 02079AD8 */ if (_t2) goto L_02079ADC; else goto L_02079AF4;
   L_02079ADC: ; // 0x2079adc
@@ -22366,8 +22366,8 @@ void Gambit_fn_02079AC4(CPUState* cpu) {
         /* 02079AF0 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 02079AF0 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_02079AF4: ; // 0x2079af4
-        /* 02079AF4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02079AF8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079AF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02079AF8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079AF8 */ _t6 = _t5 & 0x00000001u;
         /* 02079AF8 */ if (_t6) goto L_02079AFC; else goto L_02079B04;
   L_02079AFC: ; // 0x2079afc
@@ -22379,9 +22379,9 @@ void Gambit_fn_02079AC4(CPUState* cpu) {
         /* 02079B08 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 02079B08 */ cpu->r[11] = _t7;
         /* 02079B0C */ cpu->r[10] = 0x101D0000u;
-        /* 02079B10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02079B10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02079B14 */ cpu->r[10] = cpu->r[10] + 0xFFFFED90u;
-        /* 02079B18 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079B18 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079B18 */ _t9 = _t8 & 0x00000001u;
         /* 02079B18 */ if (_t9) goto L_02079B1C; else goto L_02079B30;
   L_02079B1C: ; // 0x2079b1c
@@ -22393,8 +22393,8 @@ void Gambit_fn_02079AC4(CPUState* cpu) {
         /* 02079B2C */ _t11 = cpu->r[10] + 0x00000000u;
         /* 02079B2C */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
   L_02079B30: ; // 0x2079b30
-        /* 02079B30 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02079B34 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079B30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02079B34 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079B34 */ _t13 = _t12 & 0x00000001u;
         /* 02079B34 */ if (_t13) goto L_02079B38; else goto L_02079B40;
   L_02079B38: ; // 0x2079b38
@@ -22406,9 +22406,9 @@ void Gambit_fn_02079AC4(CPUState* cpu) {
         /* 02079B44 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 02079B44 */ cpu->r[8] = _t14;
         /* 02079B48 */ cpu->r[11] = 0x101D0000u;
-        /* 02079B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02079B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02079B50 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 02079B54 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079B54 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079B54 */ _t16 = _t15 & 0x00000001u;
         /* 02079B54 */ if (_t16) goto L_02079B58; else goto L_02079B6C;
   L_02079B58: ; // 0x2079b58
@@ -22475,18 +22475,18 @@ void Gambit_fn_02079B94(CPUState* cpu) {
         /* 02053FC4 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02053FC4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02053FC8 */ cpu->r[12] = 0x00000000u;
-        /* 02053FCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02053FCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02053FD0 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 02053FD0 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02053FD4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02053FD4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02053FD4 */ _t6 = _t5 & 0x00000001u;
         /* 02053FD4 */ if (_t6) goto L_02053FFC; else goto L_02053FD8;
   L_02053FD8: ; // 0x2053fd8
         /* 02053FD8 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02053FD8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02053FDC */ /* nop */
-        /* 02053FE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 02053FE4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02053FE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 02053FE4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02053FE4 */ _t9 = _t8 & 0x00000001u;
         /* 02053FE4 */ if (_t9) goto L_02053FE8; else goto L_02053FFC;
   L_02053FE8: ; // 0x2053fe8
@@ -22531,11 +22531,11 @@ void Gambit_fn_02079B9C(CPUState* cpu) {
         /* 0207B9FC */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0207B9FC */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0207BA00 */ cpu->r[30] = cpu->r[3];
-        /* 0207BA00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207BA00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0207BA04 */ cpu->r[31] = cpu->r[4];
         /* 0207BA08 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0207BA08 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0207BA0C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BA0C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BA0C */ _t5 = _t4 & 0x00000001u;
         /* 0207BA0C */ if (_t5) goto L_0207BA50; else goto L_0207BA10;
   L_0207BA10: ; // 0x207ba10
@@ -22555,8 +22555,8 @@ void Gambit_fn_02079B9C(CPUState* cpu) {
         /* 0207BA38 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 0207BA3C */ Gambit_fn_02068798(cpu);
         /* 0207BA40 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0207BA40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207BA44 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BA40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207BA44 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BA44 */ _t10 = _t9 & 0x00000001u;
         /* 0207BA44 */ if (_t10) goto L_0207BA50; else goto L_0207BA48;
   L_0207BA48: ; // 0x207ba48
@@ -22584,8 +22584,8 @@ void Gambit_fn_02079BA4(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -22610,14 +22610,14 @@ void Gambit_fn_02079BAC(CPUState* cpu) {
         /* 02079BAC */ _t0 = cpu->r[3] + 0x000001E8u;
         /* 02079BAC */ cpu->r[12] = rbrew_read8(cpu->mem, _t0);
         /* 02079BB0 */ /* nop */
-        /* 02079BB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000004u);
+        /* 02079BB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000004u));
         /* 02079BB8 */ cpu->r[0] = 0x00000001u;
-        /* 02079BBC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079BBC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079BBC */ _t2 = _t1 & 0x00000001u;
         /* 02079BBC */ if (_t2) goto L_02079BCC; else goto L_02079BC0;
   L_02079BC0: ; // 0x2079bc0
-        /* 02079BC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000005u);
-        /* 02079BC4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079BC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000005u));
+        /* 02079BC4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079BC4 */ _t4 = _t3 & 0x00000001u;
         /* 02079BC4 */ if (_t4) goto L_02079BCC; else goto L_02079BC8;
   L_02079BC8: ; // 0x2079bc8
@@ -22705,17 +22705,17 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 02079C1C */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 02079C20 */ /* nop */
         /* 02079C24 */ cpu->r[29] = cpu->r[3];
-        /* 02079C24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 02079C24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 02079C28 */ cpu->r[31] = cpu->r[4];
-        /* 02079C2C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079C2C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079C2C */ _t3 = _t2 & 0x00000001u;
         /* 02079C2C */ if (_t3) goto L_02079C30; else goto L_02079C40;
   L_02079C30: ; // 0x2079c30
         /* 02079C30 */ cpu->r[3] = 0x00000250u;
         /* 02079C34 */ Gambit_fn_02801A78(cpu);
         /* 02079C38 */ cpu->r[29] = cpu->r[3];
-        /* 02079C38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02079C3C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079C38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02079C3C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079C3C */ _t5 = _t4 & 0x00000001u;
         /* 02079C3C */ if (_t5) goto L_0207A4A0; else goto L_02079C40;
   L_02079C40: ; // 0x2079c40
@@ -22743,7 +22743,7 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 02079C88 */ _t9 = cpu->r[29] + 0x0000000Cu;
         /* 02079C88 */ rbrew_write32(cpu->mem, _t9, cpu->r[11]);
         /* 02079C8C */ cpu->r[27] = cpu->r[29] + 0x000001DCu;
-        /* 02079C8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02079C8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02079C90 */ cpu->r[0] = cpu->r[0] + 0xFFFFB6FCu;
         /* 02079C94 */ _t10 = cpu->r[29] + 0x0000001Cu;
         /* 02079C94 */ rbrew_write32(cpu->mem, _t10, cpu->r[12]);
@@ -22751,15 +22751,15 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 02079C9C */ cpu->r[28] = 0x00000000u;
         /* 02079CA0 */ _t11 = cpu->r[29] + 0x000001C8u;
         /* 02079CA0 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
-        /* 02079CA4 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079CA4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079CA4 */ _t13 = _t12 & 0x00000001u;
         /* 02079CA4 */ if (_t13) goto L_02079CA8; else goto L_02079CB8;
   L_02079CA8: ; // 0x2079ca8
         /* 02079CA8 */ cpu->r[3] = 0x00000038u;
         /* 02079CAC */ Gambit_fn_02801A78(cpu);
         /* 02079CB0 */ cpu->r[30] = cpu->r[3];
-        /* 02079CB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02079CB4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079CB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02079CB4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079CB4 */ _t15 = _t14 & 0x00000001u;
         /* 02079CB4 */ if (_t15) goto L_02079CE8; else goto L_02079CB8;
   L_02079CB8: ; // 0x2079cb8
@@ -22787,7 +22787,7 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 02079CE8 */ _t24 = cpu->r[29] + 0x00000224u;
         /* 02079CE8 */ rbrew_write32(cpu->mem, _t24, cpu->r[28]);
         /* 02079CEC */ cpu->r[3] = cpu->r[29] + 0x00000230u;
-        /* 02079CEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02079CEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02079CF0 */ _t25 = cpu->r[29] + 0x00000214u;
         /* 02079CF0 */ rbrew_write32(cpu->mem, _t25, cpu->r[31]);
         /* 02079CF4 */ _t26 = cpu->r[29] + 0x00000220u;
@@ -22796,14 +22796,14 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 02079CF8 */ rbrew_write32(cpu->mem, _t27, cpu->r[28]);
         /* 02079CFC */ _t28 = cpu->r[29] + 0x00000228u;
         /* 02079CFC */ rbrew_write32(cpu->mem, _t28, cpu->r[28]);
-        /* 02079D00 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079D00 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079D00 */ _t30 = _t29 & 0x00000001u;
         /* 02079D00 */ if (_t30) goto L_02079D04; else goto L_02079D14;
   L_02079D04: ; // 0x2079d04
         /* 02079D04 */ cpu->r[3] = 0x00000008u;
         /* 02079D08 */ Gambit_fn_02801A78(cpu);
-        /* 02079D0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02079D10 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079D0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02079D10 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079D10 */ _t32 = _t31 & 0x00000001u;
         /* 02079D10 */ if (_t32) goto L_02079D1C; else goto L_02079D14;
   L_02079D14: ; // 0x2079d14
@@ -22813,15 +22813,15 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 02079D18 */ rbrew_write32(cpu->mem, _t34, cpu->r[28]);
   L_02079D1C: ; // 0x2079d1c
         /* 02079D1C */ cpu->r[3] = cpu->r[29] + 0x00000238u;
-        /* 02079D1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02079D20 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079D1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02079D20 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079D20 */ _t36 = _t35 & 0x00000001u;
         /* 02079D20 */ if (_t36) goto L_02079D24; else goto L_02079D34;
   L_02079D24: ; // 0x2079d24
         /* 02079D24 */ cpu->r[3] = 0x00000008u;
         /* 02079D28 */ Gambit_fn_02801A78(cpu);
-        /* 02079D2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02079D30 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079D2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02079D30 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079D30 */ _t38 = _t37 & 0x00000001u;
         /* 02079D30 */ if (_t38) goto L_02079D3C; else goto L_02079D34;
   L_02079D34: ; // 0x2079d34
@@ -22841,9 +22841,9 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 02079D50 */ _t44 = cpu->r[29] + 0x00000240u;
         /* 02079D50 */ rbrew_write32(cpu->mem, _t44, cpu->r[0]);
         /* 02079D54 */ Gambit_fn_02801A78(cpu);
-        /* 02079D58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02079D58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02079D5C */ cpu->r[8] = cpu->r[3];
-        /* 02079D60 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079D60 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079D60 */ _t46 = _t45 & 0x00000001u;
         /* 02079D60 */ if (_t46) goto L_02079D6C; else goto L_02079D64;
   L_02079D64: ; // 0x2079d64
@@ -22854,9 +22854,9 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 02079D70 */ _t47 = cpu->r[29] + 0x00000218u;
         /* 02079D70 */ rbrew_write32(cpu->mem, _t47, cpu->r[8]);
         /* 02079D74 */ Gambit_fn_02801A78(cpu);
-        /* 02079D78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02079D78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02079D7C */ cpu->r[10] = cpu->r[3];
-        /* 02079D80 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079D80 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079D80 */ _t49 = _t48 & 0x00000001u;
         /* 02079D80 */ if (_t49) goto L_02079D8C; else goto L_02079D84;
   L_02079D84: ; // 0x2079d84
@@ -22899,23 +22899,23 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 02079DF0 */ _t58 = cpu->r[4] + 0x00000000u;
         /* 02079DF0 */ cpu->r[7] = rbrew_read8(cpu->mem, _t58);
         /* 02079DF4 */ cpu->r[31] = 0x00000000u;
-        /* 02079DF8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[26]);
+        /* 02079DF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[26]));
         /* 02079DFC */ cpu->r[6] = 0x00080000u;
-        /* 02079E00 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079E00 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079E00 */ _t60 = _t59 & 0x00000001u;
         /* 02079E00 */ if (_t60) goto L_02079E28; else goto L_02079E04;
   L_02079E04: ; // 0x2079e04
         /* 02079E04 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02079E08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 02079E08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 02079E0C */ cpu->r[4] = cpu->r[4] + 0x00000001u;
-        /* 02079E10 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02079E10 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02079E10 */ _t62 = _t61 & 0x00000001u;
         /* 02079E10 */ if (_t62) goto L_02079E24; else goto L_02079E14;
   L_02079E14: ; // 0x2079e14
         /* 02079E14 */ _t63 = cpu->r[4] + 0x00000000u;
         /* 02079E14 */ cpu->r[8] = rbrew_read8(cpu->mem, _t63);
-        /* 02079E18 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[26]);
-        /* 02079E1C */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079E18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[26]));
+        /* 02079E1C */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079E1C */ _t65 = _t64 & 0x00000001u;
         /* 02079E1C */ if (_t65) goto L_02079E20; else goto L_02079E04;
   L_02079E20: ; // 0x2079e20
@@ -22925,10 +22925,10 @@ void Gambit_fn_02079C14(CPUState* cpu) {
   L_02079E28: ; // 0x2079e28
         /* 02079E28 */ _t66 = cpu->r[23] + 0x00000008u;
         /* 02079E28 */ cpu->r[10] = rbrew_read32(cpu->mem, _t66);
-        /* 02079E2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 02079E2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 02079E30 */ _t67 = cpu->r[1] + 0x00000010u;
         /* 02079E30 */ cpu->r[9] = rbrew_read32(cpu->mem, _t67);
-        /* 02079E34 */ _t68 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02079E34 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02079E34 */ _t69 = _t68 & 0x00000001u;
         /* 02079E34 */ if (_t69) goto L_02079E3C; else goto L_02079E38;
   L_02079E38: ; // 0x2079e38
@@ -22985,10 +22985,10 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 02079EC0 */ rbrew_write32(cpu->mem, _t84, cpu->r[9]);
         /* 02079EC4 */ _t85 = cpu->r[27] + 0x00000014u;
         /* 02079EC4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t85);
-        /* 02079EC8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 02079EC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 02079ECC */ _t86 = cpu->r[27] + 0x00000018u;
         /* 02079ECC */ cpu->r[30] = rbrew_read32(cpu->mem, _t86);
-        /* 02079ED0 */ _t87 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02079ED0 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02079ED0 */ _t88 = _t87 & 0x00000001u;
         /* 02079ED0 */ if (_t88) goto L_02079ED4; else goto L_02079ED8;
   L_02079ED4: ; // 0x2079ed4
@@ -23004,23 +23004,23 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 02079EEC */ _t91 = cpu->r[10] + 0x00000000u;
         /* 02079EEC */ cpu->r[4] = rbrew_read8(cpu->mem, _t91);
         /* 02079EF0 */ cpu->r[31] = 0x00000000u;
-        /* 02079EF4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[26]);
+        /* 02079EF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[26]));
         /* 02079EF8 */ cpu->r[12] = 0x00080000u;
-        /* 02079EFC */ _t92 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079EFC */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079EFC */ _t93 = _t92 & 0x00000001u;
         /* 02079EFC */ if (_t93) goto L_02079F24; else goto L_02079F00;
   L_02079F00: ; // 0x2079f00
         /* 02079F00 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02079F04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 02079F04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 02079F08 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 02079F0C */ _t94 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02079F0C */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02079F0C */ _t95 = _t94 & 0x00000001u;
         /* 02079F0C */ if (_t95) goto L_02079F20; else goto L_02079F10;
   L_02079F10: ; // 0x2079f10
         /* 02079F10 */ _t96 = cpu->r[10] + 0x00000000u;
         /* 02079F10 */ cpu->r[5] = rbrew_read8(cpu->mem, _t96);
-        /* 02079F14 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[26]);
-        /* 02079F18 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079F14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[26]));
+        /* 02079F18 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079F18 */ _t98 = _t97 & 0x00000001u;
         /* 02079F18 */ if (_t98) goto L_02079F1C; else goto L_02079F00;
   L_02079F1C: ; // 0x2079f1c
@@ -23032,10 +23032,10 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 02079F24 */ cpu->r[12] = rbrew_read32(cpu->mem, _t99);
         /* 02079F28 */ _t100 = cpu->r[1] + 0x00000010u;
         /* 02079F28 */ cpu->r[7] = rbrew_read32(cpu->mem, _t100);
-        /* 02079F2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 02079F2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 02079F30 */ _t101 = cpu->r[7] + 0x00000014u;
         /* 02079F30 */ cpu->r[0] = rbrew_read32(cpu->mem, _t101);
-        /* 02079F34 */ _t102 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02079F34 */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02079F34 */ _t103 = _t102 & 0x00000001u;
         /* 02079F34 */ if (_t103) goto L_02079F3C; else goto L_02079F38;
   L_02079F38: ; // 0x2079f38
@@ -23090,10 +23090,10 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 02079FBC */ rbrew_write32(cpu->mem, _t117, cpu->r[0]);
         /* 02079FC0 */ _t118 = cpu->r[27] + 0x00000014u;
         /* 02079FC0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t118);
-        /* 02079FC4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x00000002u);
+        /* 02079FC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x00000002u));
         /* 02079FC8 */ _t119 = cpu->r[27] + 0x00000018u;
         /* 02079FC8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t119);
-        /* 02079FCC */ _t120 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02079FCC */ _t120 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02079FCC */ _t121 = _t120 & 0x00000001u;
         /* 02079FCC */ if (_t121) goto L_02079FD0; else goto L_02079FD4;
   L_02079FD0: ; // 0x2079fd0
@@ -23109,23 +23109,23 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 02079FE8 */ _t124 = cpu->r[6] + 0x00000000u;
         /* 02079FE8 */ cpu->r[7] = rbrew_read8(cpu->mem, _t124);
         /* 02079FEC */ cpu->r[31] = 0x00000000u;
-        /* 02079FF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[26]);
+        /* 02079FF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[26]));
         /* 02079FF4 */ cpu->r[8] = 0x00080000u;
-        /* 02079FF8 */ _t125 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079FF8 */ _t125 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079FF8 */ _t126 = _t125 & 0x00000001u;
         /* 02079FF8 */ if (_t126) goto L_0207A020; else goto L_02079FFC;
   L_02079FFC: ; // 0x2079ffc
         /* 02079FFC */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0207A000 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[8]);
+        /* 0207A000 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[8]));
         /* 0207A004 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 0207A008 */ _t127 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207A008 */ _t127 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207A008 */ _t128 = _t127 & 0x00000001u;
         /* 0207A008 */ if (_t128) goto L_0207A01C; else goto L_0207A00C;
   L_0207A00C: ; // 0x207a00c
         /* 0207A00C */ _t129 = cpu->r[6] + 0x00000000u;
         /* 0207A00C */ cpu->r[0] = rbrew_read8(cpu->mem, _t129);
-        /* 0207A010 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[26]);
-        /* 0207A014 */ _t130 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A010 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[26]));
+        /* 0207A014 */ _t130 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A014 */ _t131 = _t130 & 0x00000001u;
         /* 0207A014 */ if (_t131) goto L_0207A018; else goto L_02079FFC;
   L_0207A018: ; // 0x207a018
@@ -23137,10 +23137,10 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 0207A020 */ cpu->r[5] = rbrew_read32(cpu->mem, _t132);
         /* 0207A024 */ _t133 = cpu->r[1] + 0x00000010u;
         /* 0207A024 */ cpu->r[9] = rbrew_read32(cpu->mem, _t133);
-        /* 0207A028 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 0207A028 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 0207A02C */ _t134 = cpu->r[9] + 0x00000014u;
         /* 0207A02C */ cpu->r[0] = rbrew_read32(cpu->mem, _t134);
-        /* 0207A030 */ _t135 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207A030 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207A030 */ _t136 = _t135 & 0x00000001u;
         /* 0207A030 */ if (_t136) goto L_0207A038; else goto L_0207A034;
   L_0207A034: ; // 0x207a034
@@ -23195,10 +23195,10 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 0207A0B8 */ rbrew_write32(cpu->mem, _t150, cpu->r[7]);
         /* 0207A0BC */ _t151 = cpu->r[27] + 0x00000014u;
         /* 0207A0BC */ cpu->r[9] = rbrew_read32(cpu->mem, _t151);
-        /* 0207A0C0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000003u);
+        /* 0207A0C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000003u));
         /* 0207A0C4 */ _t152 = cpu->r[27] + 0x00000018u;
         /* 0207A0C4 */ cpu->r[30] = rbrew_read32(cpu->mem, _t152);
-        /* 0207A0C8 */ _t153 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207A0C8 */ _t153 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207A0C8 */ _t154 = _t153 & 0x00000001u;
         /* 0207A0C8 */ if (_t154) goto L_0207A0CC; else goto L_0207A0D0;
   L_0207A0CC: ; // 0x207a0cc
@@ -23214,23 +23214,23 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 0207A0E4 */ _t157 = cpu->r[11] + 0x00000000u;
         /* 0207A0E4 */ cpu->r[12] = rbrew_read8(cpu->mem, _t157);
         /* 0207A0E8 */ cpu->r[31] = 0x00000000u;
-        /* 0207A0EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[26]);
+        /* 0207A0EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[26]));
         /* 0207A0F0 */ cpu->r[12] = 0x00080000u;
-        /* 0207A0F4 */ _t158 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A0F4 */ _t158 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A0F4 */ _t159 = _t158 & 0x00000001u;
         /* 0207A0F4 */ if (_t159) goto L_0207A11C; else goto L_0207A0F8;
   L_0207A0F8: ; // 0x207a0f8
         /* 0207A0F8 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0207A0FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 0207A0FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 0207A100 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 0207A104 */ _t160 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207A104 */ _t160 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207A104 */ _t161 = _t160 & 0x00000001u;
         /* 0207A104 */ if (_t161) goto L_0207A118; else goto L_0207A108;
   L_0207A108: ; // 0x207a108
         /* 0207A108 */ _t162 = cpu->r[11] + 0x00000000u;
         /* 0207A108 */ cpu->r[0] = rbrew_read8(cpu->mem, _t162);
-        /* 0207A10C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[26]);
-        /* 0207A110 */ _t163 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A10C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[26]));
+        /* 0207A110 */ _t163 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A110 */ _t164 = _t163 & 0x00000001u;
         /* 0207A110 */ if (_t164) goto L_0207A114; else goto L_0207A0F8;
   L_0207A114: ; // 0x207a114
@@ -23242,10 +23242,10 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 0207A11C */ cpu->r[6] = rbrew_read32(cpu->mem, _t165);
         /* 0207A120 */ _t166 = cpu->r[1] + 0x00000010u;
         /* 0207A120 */ cpu->r[4] = rbrew_read32(cpu->mem, _t166);
-        /* 0207A124 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 0207A124 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 0207A128 */ _t167 = cpu->r[4] + 0x00000014u;
         /* 0207A128 */ cpu->r[0] = rbrew_read32(cpu->mem, _t167);
-        /* 0207A12C */ _t168 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207A12C */ _t168 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207A12C */ _t169 = _t168 & 0x00000001u;
         /* 0207A12C */ if (_t169) goto L_0207A134; else goto L_0207A130;
   L_0207A130: ; // 0x207a130
@@ -23300,10 +23300,10 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 0207A1B4 */ rbrew_write32(cpu->mem, _t183, cpu->r[7]);
         /* 0207A1B8 */ _t184 = cpu->r[27] + 0x00000014u;
         /* 0207A1B8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t184);
-        /* 0207A1BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000004u);
+        /* 0207A1BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000004u));
         /* 0207A1C0 */ _t185 = cpu->r[27] + 0x00000018u;
         /* 0207A1C0 */ cpu->r[30] = rbrew_read32(cpu->mem, _t185);
-        /* 0207A1C4 */ _t186 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207A1C4 */ _t186 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207A1C4 */ _t187 = _t186 & 0x00000001u;
         /* 0207A1C4 */ if (_t187) goto L_0207A1C8; else goto L_0207A1CC;
   L_0207A1C8: ; // 0x207a1c8
@@ -23319,23 +23319,23 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 0207A1E0 */ _t190 = cpu->r[7] + 0x00000000u;
         /* 0207A1E0 */ cpu->r[9] = rbrew_read8(cpu->mem, _t190);
         /* 0207A1E4 */ cpu->r[31] = 0x00000000u;
-        /* 0207A1E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[26]);
+        /* 0207A1E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[26]));
         /* 0207A1EC */ cpu->r[8] = 0x00080000u;
-        /* 0207A1F0 */ _t191 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A1F0 */ _t191 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A1F0 */ _t192 = _t191 & 0x00000001u;
         /* 0207A1F0 */ if (_t192) goto L_0207A218; else goto L_0207A1F4;
   L_0207A1F4: ; // 0x207a1f4
         /* 0207A1F4 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0207A1F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[8]);
+        /* 0207A1F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[8]));
         /* 0207A1FC */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 0207A200 */ _t193 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207A200 */ _t193 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207A200 */ _t194 = _t193 & 0x00000001u;
         /* 0207A200 */ if (_t194) goto L_0207A214; else goto L_0207A204;
   L_0207A204: ; // 0x207a204
         /* 0207A204 */ _t195 = cpu->r[7] + 0x00000000u;
         /* 0207A204 */ cpu->r[10] = rbrew_read8(cpu->mem, _t195);
-        /* 0207A208 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[26]);
-        /* 0207A20C */ _t196 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[26]));
+        /* 0207A20C */ _t196 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A20C */ _t197 = _t196 & 0x00000001u;
         /* 0207A20C */ if (_t197) goto L_0207A210; else goto L_0207A1F4;
   L_0207A210: ; // 0x207a210
@@ -23347,10 +23347,10 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 0207A218 */ cpu->r[8] = rbrew_read32(cpu->mem, _t198);
         /* 0207A21C */ _t199 = cpu->r[1] + 0x00000010u;
         /* 0207A21C */ cpu->r[11] = rbrew_read32(cpu->mem, _t199);
-        /* 0207A220 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[8]);
+        /* 0207A220 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[8]));
         /* 0207A224 */ _t200 = cpu->r[11] + 0x00000014u;
         /* 0207A224 */ cpu->r[12] = rbrew_read32(cpu->mem, _t200);
-        /* 0207A228 */ _t201 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207A228 */ _t201 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207A228 */ _t202 = _t201 & 0x00000001u;
         /* 0207A228 */ if (_t202) goto L_0207A230; else goto L_0207A22C;
   L_0207A22C: ; // 0x207a22c
@@ -23405,10 +23405,10 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 0207A2B0 */ rbrew_write32(cpu->mem, _t216, cpu->r[5]);
         /* 0207A2B4 */ _t217 = cpu->r[27] + 0x00000014u;
         /* 0207A2B4 */ cpu->r[6] = rbrew_read32(cpu->mem, _t217);
-        /* 0207A2B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], 0x00000005u);
+        /* 0207A2B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], 0x00000005u));
         /* 0207A2BC */ _t218 = cpu->r[27] + 0x00000018u;
         /* 0207A2BC */ cpu->r[30] = rbrew_read32(cpu->mem, _t218);
-        /* 0207A2C0 */ _t219 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207A2C0 */ _t219 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207A2C0 */ _t220 = _t219 & 0x00000001u;
         /* 0207A2C0 */ if (_t220) goto L_0207A2C4; else goto L_0207A2C8;
   L_0207A2C4: ; // 0x207a2c4
@@ -23424,23 +23424,23 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 0207A2DC */ _t223 = cpu->r[4] + 0x00000000u;
         /* 0207A2DC */ cpu->r[7] = rbrew_read8(cpu->mem, _t223);
         /* 0207A2E0 */ cpu->r[31] = 0x00000000u;
-        /* 0207A2E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[26]);
+        /* 0207A2E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[26]));
         /* 0207A2E8 */ cpu->r[5] = 0x00080000u;
-        /* 0207A2EC */ _t224 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A2EC */ _t224 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A2EC */ _t225 = _t224 & 0x00000001u;
         /* 0207A2EC */ if (_t225) goto L_0207A314; else goto L_0207A2F0;
   L_0207A2F0: ; // 0x207a2f0
         /* 0207A2F0 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0207A2F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 0207A2F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 0207A2F8 */ cpu->r[4] = cpu->r[4] + 0x00000001u;
-        /* 0207A2FC */ _t226 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207A2FC */ _t226 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207A2FC */ _t227 = _t226 & 0x00000001u;
         /* 0207A2FC */ if (_t227) goto L_0207A310; else goto L_0207A300;
   L_0207A300: ; // 0x207a300
         /* 0207A300 */ _t228 = cpu->r[4] + 0x00000000u;
         /* 0207A300 */ cpu->r[0] = rbrew_read8(cpu->mem, _t228);
-        /* 0207A304 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[26]);
-        /* 0207A308 */ _t229 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A304 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[26]));
+        /* 0207A308 */ _t229 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A308 */ _t230 = _t229 & 0x00000001u;
         /* 0207A308 */ if (_t230) goto L_0207A30C; else goto L_0207A2F0;
   L_0207A30C: ; // 0x207a30c
@@ -23450,10 +23450,10 @@ void Gambit_fn_02079C14(CPUState* cpu) {
   L_0207A314: ; // 0x207a314
         /* 0207A314 */ _t231 = cpu->r[30] + 0x00000008u;
         /* 0207A314 */ cpu->r[10] = rbrew_read32(cpu->mem, _t231);
-        /* 0207A318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 0207A318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 0207A31C */ _t232 = cpu->r[1] + 0x00000010u;
         /* 0207A31C */ cpu->r[9] = rbrew_read32(cpu->mem, _t232);
-        /* 0207A320 */ _t233 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207A320 */ _t233 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207A320 */ _t234 = _t233 & 0x00000001u;
         /* 0207A320 */ if (_t234) goto L_0207A328; else goto L_0207A324;
   L_0207A324: ; // 0x207a324
@@ -23510,10 +23510,10 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 0207A3AC */ rbrew_write32(cpu->mem, _t249, cpu->r[12]);
         /* 0207A3B0 */ _t250 = cpu->r[27] + 0x00000014u;
         /* 0207A3B0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t250);
-        /* 0207A3B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000006u);
+        /* 0207A3B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000006u));
         /* 0207A3B8 */ _t251 = cpu->r[27] + 0x00000018u;
         /* 0207A3B8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t251);
-        /* 0207A3BC */ _t252 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207A3BC */ _t252 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207A3BC */ _t253 = _t252 & 0x00000001u;
         /* 0207A3BC */ if (_t253) goto L_0207A3C0; else goto L_0207A3C4;
   L_0207A3C0: ; // 0x207a3c0
@@ -23529,23 +23529,23 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 0207A3D8 */ _t256 = cpu->r[11] + 0x00000000u;
         /* 0207A3D8 */ cpu->r[4] = rbrew_read8(cpu->mem, _t256);
         /* 0207A3DC */ cpu->r[31] = 0x00000000u;
-        /* 0207A3E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[26]);
+        /* 0207A3E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[26]));
         /* 0207A3E4 */ cpu->r[0] = 0x00080000u;
-        /* 0207A3E8 */ _t257 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A3E8 */ _t257 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A3E8 */ _t258 = _t257 & 0x00000001u;
         /* 0207A3E8 */ if (_t258) goto L_0207A410; else goto L_0207A3EC;
   L_0207A3EC: ; // 0x207a3ec
         /* 0207A3EC */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0207A3F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 0207A3F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 0207A3F4 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 0207A3F8 */ _t259 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207A3F8 */ _t259 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207A3F8 */ _t260 = _t259 & 0x00000001u;
         /* 0207A3F8 */ if (_t260) goto L_0207A40C; else goto L_0207A3FC;
   L_0207A3FC: ; // 0x207a3fc
         /* 0207A3FC */ _t261 = cpu->r[11] + 0x00000000u;
         /* 0207A3FC */ cpu->r[5] = rbrew_read8(cpu->mem, _t261);
-        /* 0207A400 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[26]);
-        /* 0207A404 */ _t262 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A400 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[26]));
+        /* 0207A404 */ _t262 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A404 */ _t263 = _t262 & 0x00000001u;
         /* 0207A404 */ if (_t263) goto L_0207A408; else goto L_0207A3EC;
   L_0207A408: ; // 0x207a408
@@ -23557,10 +23557,10 @@ void Gambit_fn_02079C14(CPUState* cpu) {
         /* 0207A410 */ cpu->r[11] = rbrew_read32(cpu->mem, _t264);
         /* 0207A414 */ _t265 = cpu->r[1] + 0x00000010u;
         /* 0207A414 */ cpu->r[6] = rbrew_read32(cpu->mem, _t265);
-        /* 0207A418 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 0207A418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 0207A41C */ _t266 = cpu->r[6] + 0x00000014u;
         /* 0207A41C */ cpu->r[7] = rbrew_read32(cpu->mem, _t266);
-        /* 0207A420 */ _t267 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207A420 */ _t267 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207A420 */ _t268 = _t267 & 0x00000001u;
         /* 0207A420 */ if (_t268) goto L_0207A428; else goto L_0207A424;
   L_0207A424: ; // 0x207a424
@@ -23631,17 +23631,17 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 02079C1C */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 02079C20 */ /* nop */
         /* 02079C24 */ cpu->r[29] = cpu->r[3];
-        /* 02079C24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 02079C24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 02079C28 */ cpu->r[31] = cpu->r[4];
-        /* 02079C2C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079C2C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079C2C */ _t3 = _t2 & 0x00000001u;
         /* 02079C2C */ if (_t3) goto L_02079C30; else goto L_02079C40;
   L_02079C30: ; // 0x2079c30
         /* 02079C30 */ cpu->r[3] = 0x00000250u;
         /* 02079C34 */ Gambit_fn_02801A78(cpu);
         /* 02079C38 */ cpu->r[29] = cpu->r[3];
-        /* 02079C38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02079C3C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079C38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02079C3C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079C3C */ _t5 = _t4 & 0x00000001u;
         /* 02079C3C */ if (_t5) goto L_0207A4A0; else goto L_02079C40;
   L_02079C40: ; // 0x2079c40
@@ -23669,7 +23669,7 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 02079C88 */ _t9 = cpu->r[29] + 0x0000000Cu;
         /* 02079C88 */ rbrew_write32(cpu->mem, _t9, cpu->r[11]);
         /* 02079C8C */ cpu->r[27] = cpu->r[29] + 0x000001DCu;
-        /* 02079C8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02079C8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02079C90 */ cpu->r[0] = cpu->r[0] + 0xFFFFB6FCu;
         /* 02079C94 */ _t10 = cpu->r[29] + 0x0000001Cu;
         /* 02079C94 */ rbrew_write32(cpu->mem, _t10, cpu->r[12]);
@@ -23677,15 +23677,15 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 02079C9C */ cpu->r[28] = 0x00000000u;
         /* 02079CA0 */ _t11 = cpu->r[29] + 0x000001C8u;
         /* 02079CA0 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
-        /* 02079CA4 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079CA4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079CA4 */ _t13 = _t12 & 0x00000001u;
         /* 02079CA4 */ if (_t13) goto L_02079CA8; else goto L_02079CB8;
   L_02079CA8: ; // 0x2079ca8
         /* 02079CA8 */ cpu->r[3] = 0x00000038u;
         /* 02079CAC */ Gambit_fn_02801A78(cpu);
         /* 02079CB0 */ cpu->r[30] = cpu->r[3];
-        /* 02079CB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02079CB4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079CB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02079CB4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079CB4 */ _t15 = _t14 & 0x00000001u;
         /* 02079CB4 */ if (_t15) goto L_02079CE8; else goto L_02079CB8;
   L_02079CB8: ; // 0x2079cb8
@@ -23713,7 +23713,7 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 02079CE8 */ _t24 = cpu->r[29] + 0x00000224u;
         /* 02079CE8 */ rbrew_write32(cpu->mem, _t24, cpu->r[28]);
         /* 02079CEC */ cpu->r[3] = cpu->r[29] + 0x00000230u;
-        /* 02079CEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02079CEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02079CF0 */ _t25 = cpu->r[29] + 0x00000214u;
         /* 02079CF0 */ rbrew_write32(cpu->mem, _t25, cpu->r[31]);
         /* 02079CF4 */ _t26 = cpu->r[29] + 0x00000220u;
@@ -23722,14 +23722,14 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 02079CF8 */ rbrew_write32(cpu->mem, _t27, cpu->r[28]);
         /* 02079CFC */ _t28 = cpu->r[29] + 0x00000228u;
         /* 02079CFC */ rbrew_write32(cpu->mem, _t28, cpu->r[28]);
-        /* 02079D00 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079D00 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079D00 */ _t30 = _t29 & 0x00000001u;
         /* 02079D00 */ if (_t30) goto L_02079D04; else goto L_02079D14;
   L_02079D04: ; // 0x2079d04
         /* 02079D04 */ cpu->r[3] = 0x00000008u;
         /* 02079D08 */ Gambit_fn_02801A78(cpu);
-        /* 02079D0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02079D10 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079D0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02079D10 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079D10 */ _t32 = _t31 & 0x00000001u;
         /* 02079D10 */ if (_t32) goto L_02079D1C; else goto L_02079D14;
   L_02079D14: ; // 0x2079d14
@@ -23739,15 +23739,15 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 02079D18 */ rbrew_write32(cpu->mem, _t34, cpu->r[28]);
   L_02079D1C: ; // 0x2079d1c
         /* 02079D1C */ cpu->r[3] = cpu->r[29] + 0x00000238u;
-        /* 02079D1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02079D20 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079D1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02079D20 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079D20 */ _t36 = _t35 & 0x00000001u;
         /* 02079D20 */ if (_t36) goto L_02079D24; else goto L_02079D34;
   L_02079D24: ; // 0x2079d24
         /* 02079D24 */ cpu->r[3] = 0x00000008u;
         /* 02079D28 */ Gambit_fn_02801A78(cpu);
-        /* 02079D2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02079D30 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079D2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02079D30 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079D30 */ _t38 = _t37 & 0x00000001u;
         /* 02079D30 */ if (_t38) goto L_02079D3C; else goto L_02079D34;
   L_02079D34: ; // 0x2079d34
@@ -23767,9 +23767,9 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 02079D50 */ _t44 = cpu->r[29] + 0x00000240u;
         /* 02079D50 */ rbrew_write32(cpu->mem, _t44, cpu->r[0]);
         /* 02079D54 */ Gambit_fn_02801A78(cpu);
-        /* 02079D58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02079D58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02079D5C */ cpu->r[8] = cpu->r[3];
-        /* 02079D60 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079D60 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079D60 */ _t46 = _t45 & 0x00000001u;
         /* 02079D60 */ if (_t46) goto L_02079D6C; else goto L_02079D64;
   L_02079D64: ; // 0x2079d64
@@ -23780,9 +23780,9 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 02079D70 */ _t47 = cpu->r[29] + 0x00000218u;
         /* 02079D70 */ rbrew_write32(cpu->mem, _t47, cpu->r[8]);
         /* 02079D74 */ Gambit_fn_02801A78(cpu);
-        /* 02079D78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02079D78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02079D7C */ cpu->r[10] = cpu->r[3];
-        /* 02079D80 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079D80 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079D80 */ _t49 = _t48 & 0x00000001u;
         /* 02079D80 */ if (_t49) goto L_02079D8C; else goto L_02079D84;
   L_02079D84: ; // 0x2079d84
@@ -23825,23 +23825,23 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 02079DF0 */ _t58 = cpu->r[4] + 0x00000000u;
         /* 02079DF0 */ cpu->r[7] = rbrew_read8(cpu->mem, _t58);
         /* 02079DF4 */ cpu->r[31] = 0x00000000u;
-        /* 02079DF8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[26]);
+        /* 02079DF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[26]));
         /* 02079DFC */ cpu->r[6] = 0x00080000u;
-        /* 02079E00 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079E00 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079E00 */ _t60 = _t59 & 0x00000001u;
         /* 02079E00 */ if (_t60) goto L_02079E28; else goto L_02079E04;
   L_02079E04: ; // 0x2079e04
         /* 02079E04 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02079E08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 02079E08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 02079E0C */ cpu->r[4] = cpu->r[4] + 0x00000001u;
-        /* 02079E10 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02079E10 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02079E10 */ _t62 = _t61 & 0x00000001u;
         /* 02079E10 */ if (_t62) goto L_02079E24; else goto L_02079E14;
   L_02079E14: ; // 0x2079e14
         /* 02079E14 */ _t63 = cpu->r[4] + 0x00000000u;
         /* 02079E14 */ cpu->r[8] = rbrew_read8(cpu->mem, _t63);
-        /* 02079E18 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[26]);
-        /* 02079E1C */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079E18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[26]));
+        /* 02079E1C */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079E1C */ _t65 = _t64 & 0x00000001u;
         /* 02079E1C */ if (_t65) goto L_02079E20; else goto L_02079E04;
   L_02079E20: ; // 0x2079e20
@@ -23851,10 +23851,10 @@ void Gambit_fn_02079C18(CPUState* cpu) {
   L_02079E28: ; // 0x2079e28
         /* 02079E28 */ _t66 = cpu->r[23] + 0x00000008u;
         /* 02079E28 */ cpu->r[10] = rbrew_read32(cpu->mem, _t66);
-        /* 02079E2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 02079E2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 02079E30 */ _t67 = cpu->r[1] + 0x00000010u;
         /* 02079E30 */ cpu->r[9] = rbrew_read32(cpu->mem, _t67);
-        /* 02079E34 */ _t68 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02079E34 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02079E34 */ _t69 = _t68 & 0x00000001u;
         /* 02079E34 */ if (_t69) goto L_02079E3C; else goto L_02079E38;
   L_02079E38: ; // 0x2079e38
@@ -23911,10 +23911,10 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 02079EC0 */ rbrew_write32(cpu->mem, _t84, cpu->r[9]);
         /* 02079EC4 */ _t85 = cpu->r[27] + 0x00000014u;
         /* 02079EC4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t85);
-        /* 02079EC8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 02079EC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 02079ECC */ _t86 = cpu->r[27] + 0x00000018u;
         /* 02079ECC */ cpu->r[30] = rbrew_read32(cpu->mem, _t86);
-        /* 02079ED0 */ _t87 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02079ED0 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02079ED0 */ _t88 = _t87 & 0x00000001u;
         /* 02079ED0 */ if (_t88) goto L_02079ED4; else goto L_02079ED8;
   L_02079ED4: ; // 0x2079ed4
@@ -23930,23 +23930,23 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 02079EEC */ _t91 = cpu->r[10] + 0x00000000u;
         /* 02079EEC */ cpu->r[4] = rbrew_read8(cpu->mem, _t91);
         /* 02079EF0 */ cpu->r[31] = 0x00000000u;
-        /* 02079EF4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[26]);
+        /* 02079EF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[26]));
         /* 02079EF8 */ cpu->r[12] = 0x00080000u;
-        /* 02079EFC */ _t92 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079EFC */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079EFC */ _t93 = _t92 & 0x00000001u;
         /* 02079EFC */ if (_t93) goto L_02079F24; else goto L_02079F00;
   L_02079F00: ; // 0x2079f00
         /* 02079F00 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02079F04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 02079F04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 02079F08 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 02079F0C */ _t94 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02079F0C */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02079F0C */ _t95 = _t94 & 0x00000001u;
         /* 02079F0C */ if (_t95) goto L_02079F20; else goto L_02079F10;
   L_02079F10: ; // 0x2079f10
         /* 02079F10 */ _t96 = cpu->r[10] + 0x00000000u;
         /* 02079F10 */ cpu->r[5] = rbrew_read8(cpu->mem, _t96);
-        /* 02079F14 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[26]);
-        /* 02079F18 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079F14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[26]));
+        /* 02079F18 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079F18 */ _t98 = _t97 & 0x00000001u;
         /* 02079F18 */ if (_t98) goto L_02079F1C; else goto L_02079F00;
   L_02079F1C: ; // 0x2079f1c
@@ -23958,10 +23958,10 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 02079F24 */ cpu->r[12] = rbrew_read32(cpu->mem, _t99);
         /* 02079F28 */ _t100 = cpu->r[1] + 0x00000010u;
         /* 02079F28 */ cpu->r[7] = rbrew_read32(cpu->mem, _t100);
-        /* 02079F2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 02079F2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 02079F30 */ _t101 = cpu->r[7] + 0x00000014u;
         /* 02079F30 */ cpu->r[0] = rbrew_read32(cpu->mem, _t101);
-        /* 02079F34 */ _t102 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02079F34 */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02079F34 */ _t103 = _t102 & 0x00000001u;
         /* 02079F34 */ if (_t103) goto L_02079F3C; else goto L_02079F38;
   L_02079F38: ; // 0x2079f38
@@ -24016,10 +24016,10 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 02079FBC */ rbrew_write32(cpu->mem, _t117, cpu->r[0]);
         /* 02079FC0 */ _t118 = cpu->r[27] + 0x00000014u;
         /* 02079FC0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t118);
-        /* 02079FC4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x00000002u);
+        /* 02079FC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x00000002u));
         /* 02079FC8 */ _t119 = cpu->r[27] + 0x00000018u;
         /* 02079FC8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t119);
-        /* 02079FCC */ _t120 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02079FCC */ _t120 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02079FCC */ _t121 = _t120 & 0x00000001u;
         /* 02079FCC */ if (_t121) goto L_02079FD0; else goto L_02079FD4;
   L_02079FD0: ; // 0x2079fd0
@@ -24035,23 +24035,23 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 02079FE8 */ _t124 = cpu->r[6] + 0x00000000u;
         /* 02079FE8 */ cpu->r[7] = rbrew_read8(cpu->mem, _t124);
         /* 02079FEC */ cpu->r[31] = 0x00000000u;
-        /* 02079FF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[26]);
+        /* 02079FF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[26]));
         /* 02079FF4 */ cpu->r[8] = 0x00080000u;
-        /* 02079FF8 */ _t125 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02079FF8 */ _t125 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02079FF8 */ _t126 = _t125 & 0x00000001u;
         /* 02079FF8 */ if (_t126) goto L_0207A020; else goto L_02079FFC;
   L_02079FFC: ; // 0x2079ffc
         /* 02079FFC */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0207A000 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[8]);
+        /* 0207A000 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[8]));
         /* 0207A004 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 0207A008 */ _t127 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207A008 */ _t127 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207A008 */ _t128 = _t127 & 0x00000001u;
         /* 0207A008 */ if (_t128) goto L_0207A01C; else goto L_0207A00C;
   L_0207A00C: ; // 0x207a00c
         /* 0207A00C */ _t129 = cpu->r[6] + 0x00000000u;
         /* 0207A00C */ cpu->r[0] = rbrew_read8(cpu->mem, _t129);
-        /* 0207A010 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[26]);
-        /* 0207A014 */ _t130 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A010 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[26]));
+        /* 0207A014 */ _t130 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A014 */ _t131 = _t130 & 0x00000001u;
         /* 0207A014 */ if (_t131) goto L_0207A018; else goto L_02079FFC;
   L_0207A018: ; // 0x207a018
@@ -24063,10 +24063,10 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 0207A020 */ cpu->r[5] = rbrew_read32(cpu->mem, _t132);
         /* 0207A024 */ _t133 = cpu->r[1] + 0x00000010u;
         /* 0207A024 */ cpu->r[9] = rbrew_read32(cpu->mem, _t133);
-        /* 0207A028 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 0207A028 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 0207A02C */ _t134 = cpu->r[9] + 0x00000014u;
         /* 0207A02C */ cpu->r[0] = rbrew_read32(cpu->mem, _t134);
-        /* 0207A030 */ _t135 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207A030 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207A030 */ _t136 = _t135 & 0x00000001u;
         /* 0207A030 */ if (_t136) goto L_0207A038; else goto L_0207A034;
   L_0207A034: ; // 0x207a034
@@ -24121,10 +24121,10 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 0207A0B8 */ rbrew_write32(cpu->mem, _t150, cpu->r[7]);
         /* 0207A0BC */ _t151 = cpu->r[27] + 0x00000014u;
         /* 0207A0BC */ cpu->r[9] = rbrew_read32(cpu->mem, _t151);
-        /* 0207A0C0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000003u);
+        /* 0207A0C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000003u));
         /* 0207A0C4 */ _t152 = cpu->r[27] + 0x00000018u;
         /* 0207A0C4 */ cpu->r[30] = rbrew_read32(cpu->mem, _t152);
-        /* 0207A0C8 */ _t153 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207A0C8 */ _t153 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207A0C8 */ _t154 = _t153 & 0x00000001u;
         /* 0207A0C8 */ if (_t154) goto L_0207A0CC; else goto L_0207A0D0;
   L_0207A0CC: ; // 0x207a0cc
@@ -24140,23 +24140,23 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 0207A0E4 */ _t157 = cpu->r[11] + 0x00000000u;
         /* 0207A0E4 */ cpu->r[12] = rbrew_read8(cpu->mem, _t157);
         /* 0207A0E8 */ cpu->r[31] = 0x00000000u;
-        /* 0207A0EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[26]);
+        /* 0207A0EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[26]));
         /* 0207A0F0 */ cpu->r[12] = 0x00080000u;
-        /* 0207A0F4 */ _t158 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A0F4 */ _t158 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A0F4 */ _t159 = _t158 & 0x00000001u;
         /* 0207A0F4 */ if (_t159) goto L_0207A11C; else goto L_0207A0F8;
   L_0207A0F8: ; // 0x207a0f8
         /* 0207A0F8 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0207A0FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 0207A0FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 0207A100 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 0207A104 */ _t160 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207A104 */ _t160 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207A104 */ _t161 = _t160 & 0x00000001u;
         /* 0207A104 */ if (_t161) goto L_0207A118; else goto L_0207A108;
   L_0207A108: ; // 0x207a108
         /* 0207A108 */ _t162 = cpu->r[11] + 0x00000000u;
         /* 0207A108 */ cpu->r[0] = rbrew_read8(cpu->mem, _t162);
-        /* 0207A10C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[26]);
-        /* 0207A110 */ _t163 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A10C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[26]));
+        /* 0207A110 */ _t163 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A110 */ _t164 = _t163 & 0x00000001u;
         /* 0207A110 */ if (_t164) goto L_0207A114; else goto L_0207A0F8;
   L_0207A114: ; // 0x207a114
@@ -24168,10 +24168,10 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 0207A11C */ cpu->r[6] = rbrew_read32(cpu->mem, _t165);
         /* 0207A120 */ _t166 = cpu->r[1] + 0x00000010u;
         /* 0207A120 */ cpu->r[4] = rbrew_read32(cpu->mem, _t166);
-        /* 0207A124 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 0207A124 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 0207A128 */ _t167 = cpu->r[4] + 0x00000014u;
         /* 0207A128 */ cpu->r[0] = rbrew_read32(cpu->mem, _t167);
-        /* 0207A12C */ _t168 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207A12C */ _t168 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207A12C */ _t169 = _t168 & 0x00000001u;
         /* 0207A12C */ if (_t169) goto L_0207A134; else goto L_0207A130;
   L_0207A130: ; // 0x207a130
@@ -24226,10 +24226,10 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 0207A1B4 */ rbrew_write32(cpu->mem, _t183, cpu->r[7]);
         /* 0207A1B8 */ _t184 = cpu->r[27] + 0x00000014u;
         /* 0207A1B8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t184);
-        /* 0207A1BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000004u);
+        /* 0207A1BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000004u));
         /* 0207A1C0 */ _t185 = cpu->r[27] + 0x00000018u;
         /* 0207A1C0 */ cpu->r[30] = rbrew_read32(cpu->mem, _t185);
-        /* 0207A1C4 */ _t186 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207A1C4 */ _t186 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207A1C4 */ _t187 = _t186 & 0x00000001u;
         /* 0207A1C4 */ if (_t187) goto L_0207A1C8; else goto L_0207A1CC;
   L_0207A1C8: ; // 0x207a1c8
@@ -24245,23 +24245,23 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 0207A1E0 */ _t190 = cpu->r[7] + 0x00000000u;
         /* 0207A1E0 */ cpu->r[9] = rbrew_read8(cpu->mem, _t190);
         /* 0207A1E4 */ cpu->r[31] = 0x00000000u;
-        /* 0207A1E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[26]);
+        /* 0207A1E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[26]));
         /* 0207A1EC */ cpu->r[8] = 0x00080000u;
-        /* 0207A1F0 */ _t191 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A1F0 */ _t191 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A1F0 */ _t192 = _t191 & 0x00000001u;
         /* 0207A1F0 */ if (_t192) goto L_0207A218; else goto L_0207A1F4;
   L_0207A1F4: ; // 0x207a1f4
         /* 0207A1F4 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0207A1F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[8]);
+        /* 0207A1F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[8]));
         /* 0207A1FC */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 0207A200 */ _t193 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207A200 */ _t193 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207A200 */ _t194 = _t193 & 0x00000001u;
         /* 0207A200 */ if (_t194) goto L_0207A214; else goto L_0207A204;
   L_0207A204: ; // 0x207a204
         /* 0207A204 */ _t195 = cpu->r[7] + 0x00000000u;
         /* 0207A204 */ cpu->r[10] = rbrew_read8(cpu->mem, _t195);
-        /* 0207A208 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[26]);
-        /* 0207A20C */ _t196 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[26]));
+        /* 0207A20C */ _t196 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A20C */ _t197 = _t196 & 0x00000001u;
         /* 0207A20C */ if (_t197) goto L_0207A210; else goto L_0207A1F4;
   L_0207A210: ; // 0x207a210
@@ -24273,10 +24273,10 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 0207A218 */ cpu->r[8] = rbrew_read32(cpu->mem, _t198);
         /* 0207A21C */ _t199 = cpu->r[1] + 0x00000010u;
         /* 0207A21C */ cpu->r[11] = rbrew_read32(cpu->mem, _t199);
-        /* 0207A220 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[8]);
+        /* 0207A220 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[8]));
         /* 0207A224 */ _t200 = cpu->r[11] + 0x00000014u;
         /* 0207A224 */ cpu->r[12] = rbrew_read32(cpu->mem, _t200);
-        /* 0207A228 */ _t201 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207A228 */ _t201 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207A228 */ _t202 = _t201 & 0x00000001u;
         /* 0207A228 */ if (_t202) goto L_0207A230; else goto L_0207A22C;
   L_0207A22C: ; // 0x207a22c
@@ -24331,10 +24331,10 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 0207A2B0 */ rbrew_write32(cpu->mem, _t216, cpu->r[5]);
         /* 0207A2B4 */ _t217 = cpu->r[27] + 0x00000014u;
         /* 0207A2B4 */ cpu->r[6] = rbrew_read32(cpu->mem, _t217);
-        /* 0207A2B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], 0x00000005u);
+        /* 0207A2B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], 0x00000005u));
         /* 0207A2BC */ _t218 = cpu->r[27] + 0x00000018u;
         /* 0207A2BC */ cpu->r[30] = rbrew_read32(cpu->mem, _t218);
-        /* 0207A2C0 */ _t219 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207A2C0 */ _t219 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207A2C0 */ _t220 = _t219 & 0x00000001u;
         /* 0207A2C0 */ if (_t220) goto L_0207A2C4; else goto L_0207A2C8;
   L_0207A2C4: ; // 0x207a2c4
@@ -24350,23 +24350,23 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 0207A2DC */ _t223 = cpu->r[4] + 0x00000000u;
         /* 0207A2DC */ cpu->r[7] = rbrew_read8(cpu->mem, _t223);
         /* 0207A2E0 */ cpu->r[31] = 0x00000000u;
-        /* 0207A2E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[26]);
+        /* 0207A2E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[26]));
         /* 0207A2E8 */ cpu->r[5] = 0x00080000u;
-        /* 0207A2EC */ _t224 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A2EC */ _t224 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A2EC */ _t225 = _t224 & 0x00000001u;
         /* 0207A2EC */ if (_t225) goto L_0207A314; else goto L_0207A2F0;
   L_0207A2F0: ; // 0x207a2f0
         /* 0207A2F0 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0207A2F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 0207A2F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 0207A2F8 */ cpu->r[4] = cpu->r[4] + 0x00000001u;
-        /* 0207A2FC */ _t226 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207A2FC */ _t226 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207A2FC */ _t227 = _t226 & 0x00000001u;
         /* 0207A2FC */ if (_t227) goto L_0207A310; else goto L_0207A300;
   L_0207A300: ; // 0x207a300
         /* 0207A300 */ _t228 = cpu->r[4] + 0x00000000u;
         /* 0207A300 */ cpu->r[0] = rbrew_read8(cpu->mem, _t228);
-        /* 0207A304 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[26]);
-        /* 0207A308 */ _t229 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A304 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[26]));
+        /* 0207A308 */ _t229 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A308 */ _t230 = _t229 & 0x00000001u;
         /* 0207A308 */ if (_t230) goto L_0207A30C; else goto L_0207A2F0;
   L_0207A30C: ; // 0x207a30c
@@ -24376,10 +24376,10 @@ void Gambit_fn_02079C18(CPUState* cpu) {
   L_0207A314: ; // 0x207a314
         /* 0207A314 */ _t231 = cpu->r[30] + 0x00000008u;
         /* 0207A314 */ cpu->r[10] = rbrew_read32(cpu->mem, _t231);
-        /* 0207A318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 0207A318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 0207A31C */ _t232 = cpu->r[1] + 0x00000010u;
         /* 0207A31C */ cpu->r[9] = rbrew_read32(cpu->mem, _t232);
-        /* 0207A320 */ _t233 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207A320 */ _t233 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207A320 */ _t234 = _t233 & 0x00000001u;
         /* 0207A320 */ if (_t234) goto L_0207A328; else goto L_0207A324;
   L_0207A324: ; // 0x207a324
@@ -24436,10 +24436,10 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 0207A3AC */ rbrew_write32(cpu->mem, _t249, cpu->r[12]);
         /* 0207A3B0 */ _t250 = cpu->r[27] + 0x00000014u;
         /* 0207A3B0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t250);
-        /* 0207A3B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000006u);
+        /* 0207A3B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000006u));
         /* 0207A3B8 */ _t251 = cpu->r[27] + 0x00000018u;
         /* 0207A3B8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t251);
-        /* 0207A3BC */ _t252 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207A3BC */ _t252 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207A3BC */ _t253 = _t252 & 0x00000001u;
         /* 0207A3BC */ if (_t253) goto L_0207A3C0; else goto L_0207A3C4;
   L_0207A3C0: ; // 0x207a3c0
@@ -24455,23 +24455,23 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 0207A3D8 */ _t256 = cpu->r[11] + 0x00000000u;
         /* 0207A3D8 */ cpu->r[4] = rbrew_read8(cpu->mem, _t256);
         /* 0207A3DC */ cpu->r[31] = 0x00000000u;
-        /* 0207A3E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[26]);
+        /* 0207A3E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[26]));
         /* 0207A3E4 */ cpu->r[0] = 0x00080000u;
-        /* 0207A3E8 */ _t257 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A3E8 */ _t257 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A3E8 */ _t258 = _t257 & 0x00000001u;
         /* 0207A3E8 */ if (_t258) goto L_0207A410; else goto L_0207A3EC;
   L_0207A3EC: ; // 0x207a3ec
         /* 0207A3EC */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0207A3F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 0207A3F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 0207A3F4 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 0207A3F8 */ _t259 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207A3F8 */ _t259 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207A3F8 */ _t260 = _t259 & 0x00000001u;
         /* 0207A3F8 */ if (_t260) goto L_0207A40C; else goto L_0207A3FC;
   L_0207A3FC: ; // 0x207a3fc
         /* 0207A3FC */ _t261 = cpu->r[11] + 0x00000000u;
         /* 0207A3FC */ cpu->r[5] = rbrew_read8(cpu->mem, _t261);
-        /* 0207A400 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[26]);
-        /* 0207A404 */ _t262 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A400 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[26]));
+        /* 0207A404 */ _t262 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A404 */ _t263 = _t262 & 0x00000001u;
         /* 0207A404 */ if (_t263) goto L_0207A408; else goto L_0207A3EC;
   L_0207A408: ; // 0x207a408
@@ -24483,10 +24483,10 @@ void Gambit_fn_02079C18(CPUState* cpu) {
         /* 0207A410 */ cpu->r[11] = rbrew_read32(cpu->mem, _t264);
         /* 0207A414 */ _t265 = cpu->r[1] + 0x00000010u;
         /* 0207A414 */ cpu->r[6] = rbrew_read32(cpu->mem, _t265);
-        /* 0207A418 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 0207A418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 0207A41C */ _t266 = cpu->r[6] + 0x00000014u;
         /* 0207A41C */ cpu->r[7] = rbrew_read32(cpu->mem, _t266);
-        /* 0207A420 */ _t267 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207A420 */ _t267 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207A420 */ _t268 = _t267 & 0x00000001u;
         /* 0207A420 */ if (_t268) goto L_0207A428; else goto L_0207A424;
   L_0207A424: ; // 0x207a424
@@ -24722,8 +24722,8 @@ void Gambit_fn_0207A584(CPUState* cpu) {
         /* 0207A59C */ cpu->ctr = cpu->r[12];
         /* 0207A5A0 */ cpu->r[31] = cpu->r[3];
         /* 0207A5A4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207A5A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207A5AC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A5A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207A5AC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A5AC */ _t6 = _t5 & 0x00000001u;
         /* 0207A5AC */ if (_t6) goto L_0207A5C8; else goto L_0207A5B0;
   L_0207A5B0: ; // 0x207a5b0
@@ -24739,16 +24739,16 @@ void Gambit_fn_0207A584(CPUState* cpu) {
         /* 0207A5C8 */ _t9 = cpu->r[31] + 0x000001E8u;
         /* 0207A5C8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t9);
         /* 0207A5CC */ /* nop */
-        /* 0207A5D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
+        /* 0207A5D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
         /* 0207A5D4 */ cpu->r[11] = 0x00000000u;
-        /* 0207A5D8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A5D8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A5D8 */ _t11 = _t10 & 0x00000001u;
         /* 0207A5D8 */ if (_t11) goto L_0207A5DC; else goto L_0207A5EC;
   L_0207A5DC: ; // 0x207a5dc
         /* 0207A5DC */ _t12 = cpu->r[31] + 0x000001E4u;
         /* 0207A5DC */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0207A5E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207A5E4 */ _t13 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207A5E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207A5E4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207A5E4 */ _t14 = _t13 & 0x00000001u;
         /* 0207A5E4 */ if (_t14) goto L_0207A5E8; else goto L_0207A5EC;
   L_0207A5E8: ; // 0x207a5e8
@@ -24783,8 +24783,8 @@ void Gambit_fn_0207A588(CPUState* cpu) {
         /* 0207A59C */ cpu->ctr = cpu->r[12];
         /* 0207A5A0 */ cpu->r[31] = cpu->r[3];
         /* 0207A5A4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207A5A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207A5AC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A5A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207A5AC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A5AC */ _t6 = _t5 & 0x00000001u;
         /* 0207A5AC */ if (_t6) goto L_0207A5C8; else goto L_0207A5B0;
   L_0207A5B0: ; // 0x207a5b0
@@ -24800,16 +24800,16 @@ void Gambit_fn_0207A588(CPUState* cpu) {
         /* 0207A5C8 */ _t9 = cpu->r[31] + 0x000001E8u;
         /* 0207A5C8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t9);
         /* 0207A5CC */ /* nop */
-        /* 0207A5D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
+        /* 0207A5D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
         /* 0207A5D4 */ cpu->r[11] = 0x00000000u;
-        /* 0207A5D8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A5D8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A5D8 */ _t11 = _t10 & 0x00000001u;
         /* 0207A5D8 */ if (_t11) goto L_0207A5DC; else goto L_0207A5EC;
   L_0207A5DC: ; // 0x207a5dc
         /* 0207A5DC */ _t12 = cpu->r[31] + 0x000001E4u;
         /* 0207A5DC */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0207A5E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207A5E4 */ _t13 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207A5E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207A5E4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207A5E4 */ _t14 = _t13 & 0x00000001u;
         /* 0207A5E4 */ if (_t14) goto L_0207A5E8; else goto L_0207A5EC;
   L_0207A5E8: ; // 0x207a5e8
@@ -24843,8 +24843,8 @@ void Gambit_fn_0207A604(CPUState* cpu) {
         /* 0207A61C */ _t3 = cpu->r[3] + 0x00003400u;
         /* 0207A61C */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0207A620 */ Gambit_fn_0206C030(cpu);
-        /* 0207A624 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207A628 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A624 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207A628 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A628 */ _t5 = _t4 & 0x00000001u;
         /* 0207A628 */ if (_t5) goto L_0207A634; else goto L_0207A62C;
   L_0207A62C: ; // 0x207a62c
@@ -24880,8 +24880,8 @@ void Gambit_fn_0207A608(CPUState* cpu) {
         /* 0207A61C */ _t3 = cpu->r[3] + 0x00003400u;
         /* 0207A61C */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0207A620 */ Gambit_fn_0206C030(cpu);
-        /* 0207A624 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207A628 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A624 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207A628 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A628 */ _t5 = _t4 & 0x00000001u;
         /* 0207A628 */ if (_t5) goto L_0207A634; else goto L_0207A62C;
   L_0207A62C: ; // 0x207a62c
@@ -24977,8 +24977,8 @@ void Gambit_fn_0207A6D8(CPUState* cpu) {
         /* 0207A6F4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t5);
         /* 0207A6F8 */ cpu->ctr = cpu->r[9];
         /* 0207A6FC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207A700 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207A704 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207A704 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A704 */ _t7 = _t6 & 0x00000001u;
         /* 0207A704 */ if (_t7) goto L_0207A720; else goto L_0207A708;
   L_0207A708: ; // 0x207a708
@@ -24993,13 +24993,13 @@ void Gambit_fn_0207A6D8(CPUState* cpu) {
   L_0207A720: ; // 0x207a720
         /* 0207A720 */ _t10 = cpu->r[31] + 0x00000214u;
         /* 0207A720 */ cpu->r[0] = rbrew_read32(cpu->mem, _t10);
-        /* 0207A724 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207A728 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A724 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207A728 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A728 */ _t12 = _t11 & 0x00000001u;
         /* 0207A728 */ if (_t12) goto L_0207A734; else goto L_0207A72C;
   L_0207A72C: ; // 0x207a72c
-        /* 0207A72C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 0207A730 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A72C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 0207A730 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A730 */ _t14 = _t13 & 0x00000001u;
         /* 0207A730 */ if (_t14) goto L_0207A734; else goto L_0207A7D0;
   L_0207A734: ; // 0x207a734
@@ -25011,8 +25011,8 @@ void Gambit_fn_0207A6D8(CPUState* cpu) {
         /* 0207A73C */ cpu->r[0] = rbrew_read32(cpu->mem, _t17);
         /* 0207A740 */ cpu->ctr = cpu->r[0];
         /* 0207A744 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207A748 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207A74C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A748 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207A74C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A74C */ _t19 = _t18 & 0x00000001u;
         /* 0207A74C */ if (_t19) goto L_0207A768; else goto L_0207A750;
   L_0207A750: ; // 0x207a750
@@ -25033,8 +25033,8 @@ void Gambit_fn_0207A6D8(CPUState* cpu) {
         /* 0207A770 */ cpu->r[5] = rbrew_read32(cpu->mem, _t24);
         /* 0207A774 */ cpu->ctr = cpu->r[5];
         /* 0207A778 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207A77C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207A780 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A77C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207A780 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A780 */ _t26 = _t25 & 0x00000001u;
         /* 0207A780 */ if (_t26) goto L_0207A79C; else goto L_0207A784;
   L_0207A784: ; // 0x207a784
@@ -25055,8 +25055,8 @@ void Gambit_fn_0207A6D8(CPUState* cpu) {
         /* 0207A7A4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t31);
         /* 0207A7A8 */ cpu->ctr = cpu->r[0];
         /* 0207A7AC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207A7B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207A7B4 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A7B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207A7B4 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A7B4 */ _t33 = _t32 & 0x00000001u;
         /* 0207A7B4 */ if (_t33) goto L_0207A7D0; else goto L_0207A7B8;
   L_0207A7B8: ; // 0x207a7b8
@@ -25100,8 +25100,8 @@ void Gambit_fn_0207A6DC(CPUState* cpu) {
         /* 0207A6F4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t5);
         /* 0207A6F8 */ cpu->ctr = cpu->r[9];
         /* 0207A6FC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207A700 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207A704 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207A704 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A704 */ _t7 = _t6 & 0x00000001u;
         /* 0207A704 */ if (_t7) goto L_0207A720; else goto L_0207A708;
   L_0207A708: ; // 0x207a708
@@ -25116,13 +25116,13 @@ void Gambit_fn_0207A6DC(CPUState* cpu) {
   L_0207A720: ; // 0x207a720
         /* 0207A720 */ _t10 = cpu->r[31] + 0x00000214u;
         /* 0207A720 */ cpu->r[0] = rbrew_read32(cpu->mem, _t10);
-        /* 0207A724 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207A728 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A724 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207A728 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A728 */ _t12 = _t11 & 0x00000001u;
         /* 0207A728 */ if (_t12) goto L_0207A734; else goto L_0207A72C;
   L_0207A72C: ; // 0x207a72c
-        /* 0207A72C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 0207A730 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A72C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 0207A730 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A730 */ _t14 = _t13 & 0x00000001u;
         /* 0207A730 */ if (_t14) goto L_0207A734; else goto L_0207A7D0;
   L_0207A734: ; // 0x207a734
@@ -25134,8 +25134,8 @@ void Gambit_fn_0207A6DC(CPUState* cpu) {
         /* 0207A73C */ cpu->r[0] = rbrew_read32(cpu->mem, _t17);
         /* 0207A740 */ cpu->ctr = cpu->r[0];
         /* 0207A744 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207A748 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207A74C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A748 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207A74C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A74C */ _t19 = _t18 & 0x00000001u;
         /* 0207A74C */ if (_t19) goto L_0207A768; else goto L_0207A750;
   L_0207A750: ; // 0x207a750
@@ -25156,8 +25156,8 @@ void Gambit_fn_0207A6DC(CPUState* cpu) {
         /* 0207A770 */ cpu->r[5] = rbrew_read32(cpu->mem, _t24);
         /* 0207A774 */ cpu->ctr = cpu->r[5];
         /* 0207A778 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207A77C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207A780 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A77C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207A780 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A780 */ _t26 = _t25 & 0x00000001u;
         /* 0207A780 */ if (_t26) goto L_0207A79C; else goto L_0207A784;
   L_0207A784: ; // 0x207a784
@@ -25178,8 +25178,8 @@ void Gambit_fn_0207A6DC(CPUState* cpu) {
         /* 0207A7A4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t31);
         /* 0207A7A8 */ cpu->ctr = cpu->r[0];
         /* 0207A7AC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207A7B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207A7B4 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A7B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207A7B4 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A7B4 */ _t33 = _t32 & 0x00000001u;
         /* 0207A7B4 */ if (_t33) goto L_0207A7D0; else goto L_0207A7B8;
   L_0207A7B8: ; // 0x207a7b8
@@ -25299,9 +25299,9 @@ void Gambit_fn_0207A82C(CPUState* cpu) {
         /* 0207A86C */ cpu->r[28] = cpu->r[28] + 0xFFFFB3A0u;
         /* 0207A870 */ cpu->r[31] = cpu->r[3];
         /* 0207A874 */ cpu->r[4] = 0x101D0000u;
-        /* 0207A878 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0207A878 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0207A87C */ cpu->r[4] = cpu->r[4] + 0xFFFFEE1Cu;
-        /* 0207A880 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A880 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A880 */ _t6 = _t5 & 0x00000001u;
         /* 0207A880 */ if (_t6) goto L_0207A884; else goto L_0207A894;
   L_0207A884: ; // 0x207a884
@@ -25312,8 +25312,8 @@ void Gambit_fn_0207A82C(CPUState* cpu) {
         /* 0207A890 */ _t8 = cpu->r[12] + 0xFFFFDBBCu;
         /* 0207A890 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
   L_0207A894: ; // 0x207a894
-        /* 0207A894 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0207A898 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A894 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0207A898 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A898 */ _t10 = _t9 & 0x00000001u;
         /* 0207A898 */ if (_t10) goto L_0207A8B8; else goto L_0207A89C;
   L_0207A89C: ; // 0x207a89c
@@ -25324,8 +25324,8 @@ void Gambit_fn_0207A82C(CPUState* cpu) {
         /* 0207A8A4 */ cpu->ctr = cpu->r[5];
         /* 0207A8A8 */ cpu->r[3] = cpu->r[31];
         /* 0207A8AC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207A8B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207A8B4 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A8B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207A8B4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A8B4 */ _t14 = _t13 & 0x00000001u;
         /* 0207A8B4 */ if (_t14) goto L_0207A8B8; else goto L_0207A8BC;
   L_0207A8B8: ; // 0x207a8b8
@@ -25347,9 +25347,9 @@ void Gambit_fn_0207A82C(CPUState* cpu) {
         /* 0207A8E0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t18);
         /* 0207A8E0 */ cpu->r[26] = _t18;
         /* 0207A8E4 */ cpu->r[31] = cpu->r[3];
-        /* 0207A8E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0207A8E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0207A8EC */ cpu->r[30] = 0x101D0000u;
-        /* 0207A8F0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A8F0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A8F0 */ _t20 = _t19 & 0x00000001u;
         /* 0207A8F0 */ if (_t20) goto L_0207A8F4; else goto L_0207A900;
   L_0207A8F4: ; // 0x207a8f4
@@ -25359,8 +25359,8 @@ void Gambit_fn_0207A82C(CPUState* cpu) {
         /* 0207A8FC */ _t22 = cpu->r[26] + 0x00000000u;
         /* 0207A8FC */ rbrew_write32(cpu->mem, _t22, cpu->r[8]);
   L_0207A900: ; // 0x207a900
-        /* 0207A900 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0207A904 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A900 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0207A904 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A904 */ _t24 = _t23 & 0x00000001u;
         /* 0207A904 */ if (_t24) goto L_0207A928; else goto L_0207A908;
   L_0207A908: ; // 0x207a908
@@ -25372,8 +25372,8 @@ void Gambit_fn_0207A82C(CPUState* cpu) {
         /* 0207A914 */ cpu->r[3] = cpu->r[31];
         /* 0207A918 */ cpu->r[4] = cpu->r[30] + 0xFFFFEE20u;
         /* 0207A91C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207A920 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207A924 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A920 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207A924 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A924 */ _t28 = _t27 & 0x00000001u;
         /* 0207A924 */ if (_t28) goto L_0207A928; else goto L_0207A92C;
   L_0207A928: ; // 0x207a928
@@ -25392,9 +25392,9 @@ void Gambit_fn_0207A82C(CPUState* cpu) {
         /* 0207A948 */ Gambit_fn_026D86C0(cpu);
         /* 0207A94C */ _t32 = cpu->r[26] + 0x00000000u;
         /* 0207A94C */ cpu->r[0] = rbrew_read32(cpu->mem, _t32);
-        /* 0207A950 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0207A950 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0207A954 */ cpu->r[31] = cpu->r[3];
-        /* 0207A958 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A958 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A958 */ _t34 = _t33 & 0x00000001u;
         /* 0207A958 */ if (_t34) goto L_0207A95C; else goto L_0207A968;
   L_0207A95C: ; // 0x207a95c
@@ -25404,8 +25404,8 @@ void Gambit_fn_0207A82C(CPUState* cpu) {
         /* 0207A964 */ _t36 = cpu->r[26] + 0x00000000u;
         /* 0207A964 */ rbrew_write32(cpu->mem, _t36, cpu->r[6]);
   L_0207A968: ; // 0x207a968
-        /* 0207A968 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0207A96C */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A968 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0207A96C */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A96C */ _t38 = _t37 & 0x00000001u;
         /* 0207A96C */ if (_t38) goto L_0207A990; else goto L_0207A970;
   L_0207A970: ; // 0x207a970
@@ -25417,8 +25417,8 @@ void Gambit_fn_0207A82C(CPUState* cpu) {
         /* 0207A97C */ cpu->r[3] = cpu->r[31];
         /* 0207A980 */ cpu->r[4] = cpu->r[30] + 0xFFFFEE20u;
         /* 0207A984 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207A988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207A98C */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207A98C */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A98C */ _t42 = _t41 & 0x00000001u;
         /* 0207A98C */ if (_t42) goto L_0207A990; else goto L_0207A994;
   L_0207A990: ; // 0x207a990
@@ -25437,9 +25437,9 @@ void Gambit_fn_0207A82C(CPUState* cpu) {
         /* 0207A9B0 */ Gambit_fn_026D86C0(cpu);
         /* 0207A9B4 */ _t46 = cpu->r[26] + 0x00000000u;
         /* 0207A9B4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t46);
-        /* 0207A9B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0207A9B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0207A9BC */ cpu->r[31] = cpu->r[3];
-        /* 0207A9C0 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A9C0 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A9C0 */ _t48 = _t47 & 0x00000001u;
         /* 0207A9C0 */ if (_t48) goto L_0207A9C4; else goto L_0207A9D0;
   L_0207A9C4: ; // 0x207a9c4
@@ -25449,8 +25449,8 @@ void Gambit_fn_0207A82C(CPUState* cpu) {
         /* 0207A9CC */ _t50 = cpu->r[26] + 0x00000000u;
         /* 0207A9CC */ rbrew_write32(cpu->mem, _t50, cpu->r[0]);
   L_0207A9D0: ; // 0x207a9d0
-        /* 0207A9D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0207A9D4 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A9D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0207A9D4 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A9D4 */ _t52 = _t51 & 0x00000001u;
         /* 0207A9D4 */ if (_t52) goto L_0207A9F8; else goto L_0207A9D8;
   L_0207A9D8: ; // 0x207a9d8
@@ -25462,8 +25462,8 @@ void Gambit_fn_0207A82C(CPUState* cpu) {
         /* 0207A9E4 */ cpu->r[3] = cpu->r[31];
         /* 0207A9E8 */ cpu->r[4] = cpu->r[30] + 0xFFFFEE20u;
         /* 0207A9EC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207A9F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207A9F4 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A9F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207A9F4 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A9F4 */ _t56 = _t55 & 0x00000001u;
         /* 0207A9F4 */ if (_t56) goto L_0207A9F8; else goto L_0207A9FC;
   L_0207A9F8: ; // 0x207a9f8
@@ -25691,8 +25691,8 @@ void Gambit_fn_0207AAFC(CPUState* cpu) {
         /* 0207AB2C */ cpu->r[4] = 0x00000008u;
         /* 0207AB30 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0207AB34 */ cpu->r[31] = cpu->r[3];
-        /* 0207AB34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0207AB38 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207AB34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0207AB38 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207AB38 */ _t6 = _t5 & 0x00000001u;
         /* 0207AB38 */ if (_t6) goto L_0207AB3C; else goto L_0207AB60;
   L_0207AB3C: ; // 0x207ab3c
@@ -25721,8 +25721,8 @@ void Gambit_fn_0207AAFC(CPUState* cpu) {
   L_0207AB84: ; // 0x207ab84
         /* 0207AB84 */ _t10 = cpu->r[29] + 0x00000230u;
         /* 0207AB84 */ cpu->r[0] = rbrew_read32(cpu->mem, _t10);
-        /* 0207AB88 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[24], cpu->r[0]);
-        /* 0207AB8C */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207AB88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[24], cpu->r[0]));
+        /* 0207AB8C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207AB8C */ _t12 = _t11 & 0x00000001u;
         /* 0207AB8C */ if (_t12) goto L_0207AB90; else goto L_0207AB94;
   L_0207AB90: ; // 0x207ab90
@@ -25740,10 +25740,10 @@ void Gambit_fn_0207AAFC(CPUState* cpu) {
         /* 0207ABAC */ rbrew_write32(cpu->mem, _t15, cpu->r[3]);
         /* 0207ABB0 */ _t16 = cpu->r[29] + 0x00000230u;
         /* 0207ABB0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t16);
-        /* 0207ABB4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[24], cpu->r[0]);
+        /* 0207ABB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[24], cpu->r[0]));
         /* 0207ABB8 */ _t17 = cpu->r[29] + 0x00000234u;
         /* 0207ABB8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t17);
-        /* 0207ABBC */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207ABBC */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207ABBC */ _t19 = _t18 & 0x00000001u;
         /* 0207ABBC */ if (_t19) goto L_0207ABC0; else goto L_0207ABC4;
   L_0207ABC0: ; // 0x207abc0
@@ -25754,10 +25754,10 @@ void Gambit_fn_0207AAFC(CPUState* cpu) {
         /* 0207ABC8 */ cpu->r[4] = 0x00000001u;
         /* 0207ABCC */ Gambit_fn_020A9F18(cpu);
         /* 0207ABD0 */ cpu->r[25] = cpu->r[25] + 0xFFFFFFFFu;
-        /* 0207ABD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 0207ABD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 0207ABD4 */ cpu->r[24] = cpu->r[24] + 0x00000001u;
         /* 0207ABD8 */ cpu->r[26] = cpu->r[26] + 0x00000004u;
-        /* 0207ABDC */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207ABDC */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207ABDC */ _t22 = _t21 & 0x00000001u;
         /* 0207ABDC */ if (_t22) goto L_0207ABE8; else goto L_0207ABE0;
   L_0207ABE0: ; // 0x207abe0
@@ -25777,8 +25777,8 @@ void Gambit_fn_0207AAFC(CPUState* cpu) {
         /* 0207AC00 */ cpu->r[5] = 0x00000004u;
         /* 0207AC04 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0207AC08 */ cpu->r[31] = cpu->r[3];
-        /* 0207AC08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0207AC0C */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207AC08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0207AC0C */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207AC0C */ _t28 = _t27 & 0x00000001u;
         /* 0207AC0C */ if (_t28) goto L_0207AC10; else goto L_0207AC2C;
   L_0207AC10: ; // 0x207ac10
@@ -25803,11 +25803,11 @@ void Gambit_fn_0207AAFC(CPUState* cpu) {
   L_0207AC48: ; // 0x207ac48
         /* 0207AC48 */ _t32 = cpu->r[29] + 0x00000238u;
         /* 0207AC48 */ cpu->r[0] = rbrew_read32(cpu->mem, _t32);
-        /* 0207AC4C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
+        /* 0207AC4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
         /* 0207AC50 */ _t33 = cpu->r[28] + 0x00000004u;
         /* 0207AC50 */ cpu->r[8] = rbrew_read32(cpu->mem, _t33);
         /* 0207AC50 */ cpu->r[28] = _t33;
-        /* 0207AC54 */ _t34 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207AC54 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207AC54 */ _t35 = _t34 & 0x00000001u;
         /* 0207AC54 */ if (_t35) goto L_0207AC58; else goto L_0207AC5C;
   L_0207AC58: ; // 0x207ac58
@@ -25823,11 +25823,11 @@ void Gambit_fn_0207AAFC(CPUState* cpu) {
         /* 0207AC70 */ Gambit_fn_020A7150(cpu);
         /* 0207AC74 */ cpu->r[26] = cpu->r[26] + 0x00000004u;
         /* 0207AC78 */ cpu->r[25] = cpu->r[25] + 0xFFFFFFFFu;
-        /* 0207AC78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 0207AC78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 0207AC7C */ _t38 = cpu->r[31] + 0x00000000u;
         /* 0207AC7C */ rbrew_write32(cpu->mem, _t38, cpu->r[3]);
         /* 0207AC80 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0207AC84 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207AC84 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207AC84 */ _t40 = _t39 & 0x00000001u;
         /* 0207AC84 */ if (_t40) goto L_0207AC90; else goto L_0207AC88;
   L_0207AC88: ; // 0x207ac88
@@ -25851,16 +25851,16 @@ void Gambit_fn_0207ACA4(CPUState* cpu) {
         /* 0207ACA4 */ cpu->r[12] = cpu->r[3];
         /* 0207ACA8 */ _t0 = cpu->r[12] + 0x00000228u;
         /* 0207ACA8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t0);
-        /* 0207ACAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207ACB0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207ACAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207ACB0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207ACB0 */ _t2 = _t1 & 0x00000001u;
         /* 0207ACB0 */ if (_t2) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207ACB0 */ goto L_0207ACB4;
   L_0207ACB4: ; // 0x207acb4
         /* 0207ACB4 */ _t3 = cpu->r[12] + 0x0000022Cu;
         /* 0207ACB4 */ cpu->r[4] = rbrew_read32(cpu->mem, _t3);
-        /* 0207ACB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0207ACBC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207ACB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0207ACBC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207ACBC */ _t5 = _t4 & 0x00000001u;
         /* 0207ACBC */ if (_t5) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207ACBC */ goto L_0207ACC0;
@@ -25920,12 +25920,12 @@ void Gambit_fn_0207ACC4(CPUState* cpu) {
         /* 0207ACE8 */ cpu->r[29] = rbrew_read32(cpu->mem, _t7);
         /* 0207ACEC */ _t8 = cpu->r[30] + 0x00000234u;
         /* 0207ACEC */ cpu->r[31] = rbrew_read32(cpu->mem, _t8);
-        /* 0207ACF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[0]);
+        /* 0207ACF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[0]));
         /* 0207ACF4 */ _t9 = cpu->r[30] + 0x00000248u;
         /* 0207ACF4 */ cpu->r[4] = rbrew_read32(cpu->mem, _t9);
         /* 0207ACF8 */ _t10 = cpu->r[30] + 0x0000021Cu;
         /* 0207ACF8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t10);
-        /* 0207ACFC */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207ACFC */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207ACFC */ _t12 = _t11 & 0x00000001u;
         /* 0207ACFC */ if (_t12) goto L_0207AD00; else goto L_0207AD08;
   L_0207AD00: ; // 0x207ad00
@@ -25939,10 +25939,10 @@ void Gambit_fn_0207ACC4(CPUState* cpu) {
         /* 0207AD14 */ Gambit_fn_020A7BE4(cpu);
         /* 0207AD18 */ _t14 = cpu->r[30] + 0x00000230u;
         /* 0207AD18 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
-        /* 0207AD1C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[0]);
+        /* 0207AD1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[0]));
         /* 0207AD20 */ _t15 = cpu->r[30] + 0x00000234u;
         /* 0207AD20 */ cpu->r[12] = rbrew_read32(cpu->mem, _t15);
-        /* 0207AD24 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207AD24 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207AD24 */ _t17 = _t16 & 0x00000001u;
         /* 0207AD24 */ if (_t17) goto L_0207AD28; else goto L_0207AD30;
   L_0207AD28: ; // 0x207ad28
@@ -25990,12 +25990,12 @@ void Gambit_fn_0207ACC8(CPUState* cpu) {
         /* 0207ACE8 */ cpu->r[29] = rbrew_read32(cpu->mem, _t7);
         /* 0207ACEC */ _t8 = cpu->r[30] + 0x00000234u;
         /* 0207ACEC */ cpu->r[31] = rbrew_read32(cpu->mem, _t8);
-        /* 0207ACF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[0]);
+        /* 0207ACF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[0]));
         /* 0207ACF4 */ _t9 = cpu->r[30] + 0x00000248u;
         /* 0207ACF4 */ cpu->r[4] = rbrew_read32(cpu->mem, _t9);
         /* 0207ACF8 */ _t10 = cpu->r[30] + 0x0000021Cu;
         /* 0207ACF8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t10);
-        /* 0207ACFC */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207ACFC */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207ACFC */ _t12 = _t11 & 0x00000001u;
         /* 0207ACFC */ if (_t12) goto L_0207AD00; else goto L_0207AD08;
   L_0207AD00: ; // 0x207ad00
@@ -26009,10 +26009,10 @@ void Gambit_fn_0207ACC8(CPUState* cpu) {
         /* 0207AD14 */ Gambit_fn_020A7BE4(cpu);
         /* 0207AD18 */ _t14 = cpu->r[30] + 0x00000230u;
         /* 0207AD18 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
-        /* 0207AD1C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[0]);
+        /* 0207AD1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[0]));
         /* 0207AD20 */ _t15 = cpu->r[30] + 0x00000234u;
         /* 0207AD20 */ cpu->r[12] = rbrew_read32(cpu->mem, _t15);
-        /* 0207AD24 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207AD24 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207AD24 */ _t17 = _t16 & 0x00000001u;
         /* 0207AD24 */ if (_t17) goto L_0207AD28; else goto L_0207AD30;
   L_0207AD28: ; // 0x207ad28
@@ -26044,20 +26044,20 @@ void Gambit_fn_0207AD54(CPUState* cpu) {
         /* 0207AD54 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 0207AD58 */ _t1 = cpu->r[3] + 0x0000024Cu;
         /* 0207AD58 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
-        /* 0207AD5C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[12]);
+        /* 0207AD5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[12]));
         /* 0207AD60 */ _t2 = cpu->r[3] + 0x00000244u;
         /* 0207AD60 */ cpu->r[0] = rbrew_read32(cpu->mem, _t2);
-        /* 0207AD64 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207AD64 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207AD64 */ _t4 = _t3 & 0x00000001u;
         /* 0207AD64 */ if (_t4) goto L_0207AD7C; else goto L_0207AD68;
   L_0207AD68: ; // 0x207ad68
-        /* 0207AD68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 0207AD6C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207AD68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 0207AD6C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207AD6C */ _t6 = _t5 & 0x00000001u;
         /* 0207AD6C */ if (_t6) goto L_0207AD78; else goto L_0207AD70;
   L_0207AD70: ; // 0x207ad70
-        /* 0207AD70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 0207AD74 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207AD70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 0207AD74 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207AD74 */ _t8 = _t7 & 0x00000001u;
         /* 0207AD74 */ if (_t8) goto L_0207AD78; else goto L_0207AD7C;
   L_0207AD78: ; // 0x207ad78
@@ -26089,32 +26089,32 @@ void Gambit_fn_0207AD84(CPUState* cpu) {
         /* 0207ADA0 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 0207ADA4 */ _t5 = cpu->r[30] + 0x00000240u;
         /* 0207ADA4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t5);
-        /* 0207ADA8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000002u);
+        /* 0207ADA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000002u));
         /* 0207ADAC */ cpu->f[1] = cpu->f[0];
-        /* 0207ADB0 */ _t6 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207ADB0 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207ADB0 */ _t7 = _t6 & 0x00000001u;
         /* 0207ADB0 */ if (_t7) goto L_0207ADB4; else goto L_0207ADC0;
   L_0207ADB4: ; // 0x207adb4
-        /* 0207ADB4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000001u);
-        /* 0207ADB8 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207ADB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000001u));
+        /* 0207ADB8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207ADB8 */ _t9 = _t8 & 0x00000001u;
         /* 0207ADB8 */ if (_t9) goto L_0207AE0C; else goto L_0207ADBC;
   L_0207ADBC: ; // 0x207adbc
-        /* 0207ADBC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207ADBC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207ADBC */ _t11 = _t10 & 0x00000001u;
         /* 0207ADBC */ if (_t11) goto L_0207AE4C; else goto L_0207ADC0;
   L_0207ADC0: ; // 0x207adc0
-        /* 0207ADC0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000003u);
-        /* 0207ADC4 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207ADC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000003u));
+        /* 0207ADC4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207ADC4 */ _t13 = _t12 & 0x00000001u;
         /* 0207ADC4 */ if (_t13) goto L_0207AE8C; else goto L_0207ADC8;
   L_0207ADC8: ; // 0x207adc8
-        /* 0207ADC8 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207ADC8 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207ADC8 */ _t15 = _t14 & 0x00000001u;
         /* 0207ADC8 */ if (_t15) goto L_0207AECC; else goto L_0207ADCC;
   L_0207ADCC: ; // 0x207adcc
-        /* 0207ADCC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000004u);
-        /* 0207ADD0 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207ADCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000004u));
+        /* 0207ADD0 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207ADD0 */ _t17 = _t16 & 0x00000001u;
         /* 0207ADD0 */ if (_t17) goto L_0207AF08; else goto L_0207ADD4;
   L_0207ADD4: ; // 0x207add4
@@ -26132,8 +26132,8 @@ void Gambit_fn_0207AD84(CPUState* cpu) {
         /* 0207ADF8 */ Gambit_fn_027ED914(cpu);
         /* 0207ADFC */ _t20 = cpu->r[30] + 0x00000240u;
         /* 0207ADFC */ cpu->r[0] = rbrew_read32(cpu->mem, _t20);
-        /* 0207AE00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 0207AE04 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207AE00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 0207AE04 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207AE04 */ _t22 = _t21 & 0x00000001u;
         /* 0207AE04 */ if (_t22) goto L_0207AE08; else goto L_0207AFC8;
   L_0207AE08: ; // 0x207ae08
@@ -26156,8 +26156,8 @@ void Gambit_fn_0207AD84(CPUState* cpu) {
         /* 0207AE38 */ Gambit_fn_027ED914(cpu);
         /* 0207AE3C */ _t26 = cpu->r[30] + 0x00000240u;
         /* 0207AE3C */ cpu->r[0] = rbrew_read32(cpu->mem, _t26);
-        /* 0207AE40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 0207AE44 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207AE40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 0207AE44 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207AE44 */ _t28 = _t27 & 0x00000001u;
         /* 0207AE44 */ if (_t28) goto L_0207AE48; else goto L_0207AFC8;
   L_0207AE48: ; // 0x207ae48
@@ -26180,8 +26180,8 @@ void Gambit_fn_0207AD84(CPUState* cpu) {
         /* 0207AE78 */ Gambit_fn_027ED914(cpu);
         /* 0207AE7C */ _t32 = cpu->r[30] + 0x00000240u;
         /* 0207AE7C */ cpu->r[0] = rbrew_read32(cpu->mem, _t32);
-        /* 0207AE80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 0207AE84 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207AE80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 0207AE84 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207AE84 */ _t34 = _t33 & 0x00000001u;
         /* 0207AE84 */ if (_t34) goto L_0207AE88; else goto L_0207AFC8;
   L_0207AE88: ; // 0x207ae88
@@ -26204,8 +26204,8 @@ void Gambit_fn_0207AD84(CPUState* cpu) {
         /* 0207AEB8 */ Gambit_fn_027ED914(cpu);
         /* 0207AEBC */ _t38 = cpu->r[30] + 0x00000240u;
         /* 0207AEBC */ cpu->r[0] = rbrew_read32(cpu->mem, _t38);
-        /* 0207AEC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 0207AEC4 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207AEC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 0207AEC4 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207AEC4 */ _t40 = _t39 & 0x00000001u;
         /* 0207AEC4 */ if (_t40) goto L_0207AEC8; else goto L_0207AFC8;
   L_0207AEC8: ; // 0x207aec8
@@ -26226,8 +26226,8 @@ void Gambit_fn_0207AD84(CPUState* cpu) {
         /* 0207AEF4 */ Gambit_fn_027ED914(cpu);
         /* 0207AEF8 */ _t43 = cpu->r[30] + 0x00000240u;
         /* 0207AEF8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t43);
-        /* 0207AEFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 0207AF00 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207AEFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 0207AF00 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207AF00 */ _t45 = _t44 & 0x00000001u;
         /* 0207AF00 */ if (_t45) goto L_0207AF04; else goto L_0207AFC8;
   L_0207AF04: ; // 0x207af04
@@ -26250,8 +26250,8 @@ void Gambit_fn_0207AD84(CPUState* cpu) {
         /* 0207AF34 */ Gambit_fn_027ED914(cpu);
         /* 0207AF38 */ _t49 = cpu->r[30] + 0x00000240u;
         /* 0207AF38 */ cpu->r[0] = rbrew_read32(cpu->mem, _t49);
-        /* 0207AF3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 0207AF40 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207AF3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 0207AF40 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207AF40 */ _t51 = _t50 & 0x00000001u;
         /* 0207AF40 */ if (_t51) goto L_0207AF44; else goto L_0207AFC8;
   L_0207AF44: ; // 0x207af44
@@ -26270,9 +26270,9 @@ void Gambit_fn_0207AD84(CPUState* cpu) {
         /* 0207AF64 */ cpu->r[10] = _t54;
         /* 0207AF68 */ cpu->r[31] = cpu->r[3];
         /* 0207AF6C */ cpu->r[4] = 0x101D0000u;
-        /* 0207AF70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0207AF70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0207AF74 */ cpu->r[4] = cpu->r[4] + 0xFFFFED90u;
-        /* 0207AF78 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207AF78 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207AF78 */ _t56 = _t55 & 0x00000001u;
         /* 0207AF78 */ if (_t56) goto L_0207AF7C; else goto L_0207AF90;
   L_0207AF7C: ; // 0x207af7c
@@ -26284,8 +26284,8 @@ void Gambit_fn_0207AD84(CPUState* cpu) {
         /* 0207AF8C */ _t58 = cpu->r[4] + 0x00000000u;
         /* 0207AF8C */ rbrew_write32(cpu->mem, _t58, cpu->r[8]);
   L_0207AF90: ; // 0x207af90
-        /* 0207AF90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0207AF94 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207AF90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0207AF94 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207AF94 */ _t60 = _t59 & 0x00000001u;
         /* 0207AF94 */ if (_t60) goto L_0207AFC0; else goto L_0207AF98;
   L_0207AF98: ; // 0x207af98
@@ -26296,8 +26296,8 @@ void Gambit_fn_0207AD84(CPUState* cpu) {
         /* 0207AFA0 */ cpu->ctr = cpu->r[0];
         /* 0207AFA4 */ cpu->r[3] = cpu->r[31];
         /* 0207AFA8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207AFAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207AFB0 */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207AFAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207AFB0 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207AFB0 */ _t64 = _t63 & 0x00000001u;
         /* 0207AFB0 */ if (_t64) goto L_0207AFC0; else goto L_0207AFB4;
   L_0207AFB4: ; // 0x207afb4
@@ -26338,32 +26338,32 @@ void Gambit_fn_0207AD8C(CPUState* cpu) {
         /* 0207ADA0 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 0207ADA4 */ _t5 = cpu->r[30] + 0x00000240u;
         /* 0207ADA4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t5);
-        /* 0207ADA8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000002u);
+        /* 0207ADA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000002u));
         /* 0207ADAC */ cpu->f[1] = cpu->f[0];
-        /* 0207ADB0 */ _t6 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207ADB0 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207ADB0 */ _t7 = _t6 & 0x00000001u;
         /* 0207ADB0 */ if (_t7) goto L_0207ADB4; else goto L_0207ADC0;
   L_0207ADB4: ; // 0x207adb4
-        /* 0207ADB4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000001u);
-        /* 0207ADB8 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207ADB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000001u));
+        /* 0207ADB8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207ADB8 */ _t9 = _t8 & 0x00000001u;
         /* 0207ADB8 */ if (_t9) goto L_0207AE0C; else goto L_0207ADBC;
   L_0207ADBC: ; // 0x207adbc
-        /* 0207ADBC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207ADBC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207ADBC */ _t11 = _t10 & 0x00000001u;
         /* 0207ADBC */ if (_t11) goto L_0207AE4C; else goto L_0207ADC0;
   L_0207ADC0: ; // 0x207adc0
-        /* 0207ADC0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000003u);
-        /* 0207ADC4 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207ADC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000003u));
+        /* 0207ADC4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207ADC4 */ _t13 = _t12 & 0x00000001u;
         /* 0207ADC4 */ if (_t13) goto L_0207AE8C; else goto L_0207ADC8;
   L_0207ADC8: ; // 0x207adc8
-        /* 0207ADC8 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207ADC8 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207ADC8 */ _t15 = _t14 & 0x00000001u;
         /* 0207ADC8 */ if (_t15) goto L_0207AECC; else goto L_0207ADCC;
   L_0207ADCC: ; // 0x207adcc
-        /* 0207ADCC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000004u);
-        /* 0207ADD0 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207ADCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000004u));
+        /* 0207ADD0 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207ADD0 */ _t17 = _t16 & 0x00000001u;
         /* 0207ADD0 */ if (_t17) goto L_0207AF08; else goto L_0207ADD4;
   L_0207ADD4: ; // 0x207add4
@@ -26381,8 +26381,8 @@ void Gambit_fn_0207AD8C(CPUState* cpu) {
         /* 0207ADF8 */ Gambit_fn_027ED914(cpu);
         /* 0207ADFC */ _t20 = cpu->r[30] + 0x00000240u;
         /* 0207ADFC */ cpu->r[0] = rbrew_read32(cpu->mem, _t20);
-        /* 0207AE00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 0207AE04 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207AE00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 0207AE04 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207AE04 */ _t22 = _t21 & 0x00000001u;
         /* 0207AE04 */ if (_t22) goto L_0207AE08; else goto L_0207AFC8;
   L_0207AE08: ; // 0x207ae08
@@ -26405,8 +26405,8 @@ void Gambit_fn_0207AD8C(CPUState* cpu) {
         /* 0207AE38 */ Gambit_fn_027ED914(cpu);
         /* 0207AE3C */ _t26 = cpu->r[30] + 0x00000240u;
         /* 0207AE3C */ cpu->r[0] = rbrew_read32(cpu->mem, _t26);
-        /* 0207AE40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 0207AE44 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207AE40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 0207AE44 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207AE44 */ _t28 = _t27 & 0x00000001u;
         /* 0207AE44 */ if (_t28) goto L_0207AE48; else goto L_0207AFC8;
   L_0207AE48: ; // 0x207ae48
@@ -26429,8 +26429,8 @@ void Gambit_fn_0207AD8C(CPUState* cpu) {
         /* 0207AE78 */ Gambit_fn_027ED914(cpu);
         /* 0207AE7C */ _t32 = cpu->r[30] + 0x00000240u;
         /* 0207AE7C */ cpu->r[0] = rbrew_read32(cpu->mem, _t32);
-        /* 0207AE80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 0207AE84 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207AE80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 0207AE84 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207AE84 */ _t34 = _t33 & 0x00000001u;
         /* 0207AE84 */ if (_t34) goto L_0207AE88; else goto L_0207AFC8;
   L_0207AE88: ; // 0x207ae88
@@ -26453,8 +26453,8 @@ void Gambit_fn_0207AD8C(CPUState* cpu) {
         /* 0207AEB8 */ Gambit_fn_027ED914(cpu);
         /* 0207AEBC */ _t38 = cpu->r[30] + 0x00000240u;
         /* 0207AEBC */ cpu->r[0] = rbrew_read32(cpu->mem, _t38);
-        /* 0207AEC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 0207AEC4 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207AEC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 0207AEC4 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207AEC4 */ _t40 = _t39 & 0x00000001u;
         /* 0207AEC4 */ if (_t40) goto L_0207AEC8; else goto L_0207AFC8;
   L_0207AEC8: ; // 0x207aec8
@@ -26475,8 +26475,8 @@ void Gambit_fn_0207AD8C(CPUState* cpu) {
         /* 0207AEF4 */ Gambit_fn_027ED914(cpu);
         /* 0207AEF8 */ _t43 = cpu->r[30] + 0x00000240u;
         /* 0207AEF8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t43);
-        /* 0207AEFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 0207AF00 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207AEFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 0207AF00 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207AF00 */ _t45 = _t44 & 0x00000001u;
         /* 0207AF00 */ if (_t45) goto L_0207AF04; else goto L_0207AFC8;
   L_0207AF04: ; // 0x207af04
@@ -26499,8 +26499,8 @@ void Gambit_fn_0207AD8C(CPUState* cpu) {
         /* 0207AF34 */ Gambit_fn_027ED914(cpu);
         /* 0207AF38 */ _t49 = cpu->r[30] + 0x00000240u;
         /* 0207AF38 */ cpu->r[0] = rbrew_read32(cpu->mem, _t49);
-        /* 0207AF3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 0207AF40 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207AF3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 0207AF40 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207AF40 */ _t51 = _t50 & 0x00000001u;
         /* 0207AF40 */ if (_t51) goto L_0207AF44; else goto L_0207AFC8;
   L_0207AF44: ; // 0x207af44
@@ -26519,9 +26519,9 @@ void Gambit_fn_0207AD8C(CPUState* cpu) {
         /* 0207AF64 */ cpu->r[10] = _t54;
         /* 0207AF68 */ cpu->r[31] = cpu->r[3];
         /* 0207AF6C */ cpu->r[4] = 0x101D0000u;
-        /* 0207AF70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0207AF70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0207AF74 */ cpu->r[4] = cpu->r[4] + 0xFFFFED90u;
-        /* 0207AF78 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207AF78 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207AF78 */ _t56 = _t55 & 0x00000001u;
         /* 0207AF78 */ if (_t56) goto L_0207AF7C; else goto L_0207AF90;
   L_0207AF7C: ; // 0x207af7c
@@ -26533,8 +26533,8 @@ void Gambit_fn_0207AD8C(CPUState* cpu) {
         /* 0207AF8C */ _t58 = cpu->r[4] + 0x00000000u;
         /* 0207AF8C */ rbrew_write32(cpu->mem, _t58, cpu->r[8]);
   L_0207AF90: ; // 0x207af90
-        /* 0207AF90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0207AF94 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207AF90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0207AF94 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207AF94 */ _t60 = _t59 & 0x00000001u;
         /* 0207AF94 */ if (_t60) goto L_0207AFC0; else goto L_0207AF98;
   L_0207AF98: ; // 0x207af98
@@ -26545,8 +26545,8 @@ void Gambit_fn_0207AD8C(CPUState* cpu) {
         /* 0207AFA0 */ cpu->ctr = cpu->r[0];
         /* 0207AFA4 */ cpu->r[3] = cpu->r[31];
         /* 0207AFA8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207AFAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207AFB0 */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207AFAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207AFB0 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207AFB0 */ _t64 = _t63 & 0x00000001u;
         /* 0207AFB0 */ if (_t64) goto L_0207AFC0; else goto L_0207AFB4;
   L_0207AFB4: ; // 0x207afb4
@@ -26583,9 +26583,9 @@ void Gambit_fn_0207AFE0(CPUState* cpu) {
         /* 0207AFF0 */ cpu->r[28] = cpu->r[3];
         /* 0207AFF4 */ _t2 = cpu->r[28] + 0x00000240u;
         /* 0207AFF4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t2);
-        /* 0207AFF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0207AFF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0207AFFC */ cpu->r[30] = 0x00000000u;
-        /* 0207B000 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B000 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B000 */ _t4 = _t3 & 0x00000001u;
         /* 0207B000 */ if (_t4) goto L_0207B004; else goto L_0207B01C;
   L_0207B004: ; // 0x207b004
@@ -26602,11 +26602,11 @@ void Gambit_fn_0207AFE0(CPUState* cpu) {
   L_0207B01C: ; // 0x207b01c
         /* 0207B01C */ cpu->r[31] = 0x10010000u;
         /* 0207B020 */ cpu->r[29] = 0x10010000u;
-        /* 0207B024 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000001u);
+        /* 0207B024 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000001u));
         /* 0207B028 */ cpu->r[31] = cpu->r[31] + 0xFFFFB338u;
         /* 0207B02C */ cpu->r[29] = cpu->r[29] + 0xFFFFB2F0u;
         /* 0207B030 */ cpu->r[27] = 0x10110000u;
-        /* 0207B034 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B034 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B034 */ _t10 = _t9 & 0x00000001u;
         /* 0207B034 */ if (_t10) goto L_0207B038; else goto L_0207B1C4;
   L_0207B038: ; // 0x207b038
@@ -26614,8 +26614,8 @@ void Gambit_fn_0207AFE0(CPUState* cpu) {
         /* 0207B038 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
         /* 0207B03C */ _t12 = cpu->r[28] + 0x0000024Cu;
         /* 0207B03C */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0207B040 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[0]);
-        /* 0207B044 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B040 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[0]));
+        /* 0207B044 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B044 */ _t14 = _t13 & 0x00000001u;
         /* 0207B044 */ if (_t14) goto L_0207B048; else goto L_0207B0F0;
   L_0207B048: ; // 0x207b048
@@ -26684,8 +26684,8 @@ void Gambit_fn_0207AFE0(CPUState* cpu) {
         /* 0207B0DC */ Gambit_fn_020A7E60(cpu);
         /* 0207B0E0 */ _t40 = cpu->r[28] + 0x00000214u;
         /* 0207B0E0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t40);
-        /* 0207B0E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0207B0E8 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B0E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0207B0E8 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B0E8 */ _t42 = _t41 & 0x00000001u;
         /* 0207B0E8 */ if (_t42) goto L_0207B0EC; else goto L_0207B1A8;
   L_0207B0EC: ; // 0x207b0ec
@@ -26763,13 +26763,13 @@ void Gambit_fn_0207AFE0(CPUState* cpu) {
         /* 0207B198 */ Gambit_fn_020A7E60(cpu);
         /* 0207B19C */ _t70 = cpu->r[28] + 0x00000214u;
         /* 0207B19C */ cpu->r[7] = rbrew_read32(cpu->mem, _t70);
-        /* 0207B1A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0207B1A4 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B1A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0207B1A4 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B1A4 */ _t72 = _t71 & 0x00000001u;
         /* 0207B1A4 */ if (_t72) goto L_0207B1B0; else goto L_0207B1A8;
   L_0207B1A8: ; // 0x207b1a8
-        /* 0207B1A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000001u);
-        /* 0207B1AC */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B1A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000001u));
+        /* 0207B1AC */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B1AC */ _t74 = _t73 & 0x00000001u;
         /* 0207B1AC */ if (_t74) goto L_0207B1B0; else goto L_0207B1C0;
   L_0207B1B0: ; // 0x207b1b0
@@ -26782,8 +26782,8 @@ void Gambit_fn_0207AFE0(CPUState* cpu) {
         /* 0207B1C0 */ _t76 = cpu->r[28] + 0x00000240u;
         /* 0207B1C0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t76);
   L_0207B1C4: ; // 0x207b1c4
-        /* 0207B1C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000002u);
-        /* 0207B1C8 */ _t77 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B1C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000002u));
+        /* 0207B1C8 */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B1C8 */ _t78 = _t77 & 0x00000001u;
         /* 0207B1C8 */ if (_t78) goto L_0207B1CC; else goto L_0207B38C;
   L_0207B1CC: ; // 0x207b1cc
@@ -26841,10 +26841,10 @@ void Gambit_fn_0207AFE0(CPUState* cpu) {
         /* 0207B244 */ Gambit_fn_0207C348(cpu);
         /* 0207B248 */ _t100 = cpu->r[28] + 0x00000238u;
         /* 0207B248 */ cpu->r[6] = rbrew_read32(cpu->mem, _t100);
-        /* 0207B24C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], 0x00000001u);
+        /* 0207B24C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], 0x00000001u));
         /* 0207B250 */ _t101 = cpu->r[28] + 0x0000023Cu;
         /* 0207B250 */ cpu->r[10] = rbrew_read32(cpu->mem, _t101);
-        /* 0207B254 */ _t102 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207B254 */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207B254 */ _t103 = _t102 & 0x00000001u;
         /* 0207B254 */ if (_t103) goto L_0207B258; else goto L_0207B25C;
   L_0207B258: ; // 0x207b258
@@ -26856,10 +26856,10 @@ void Gambit_fn_0207AFE0(CPUState* cpu) {
         /* 0207B264 */ Gambit_fn_020A7BE4(cpu);
         /* 0207B268 */ _t105 = cpu->r[28] + 0x00000238u;
         /* 0207B268 */ cpu->r[7] = rbrew_read32(cpu->mem, _t105);
-        /* 0207B26C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x00000001u);
+        /* 0207B26C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x00000001u));
         /* 0207B270 */ _t106 = cpu->r[28] + 0x0000023Cu;
         /* 0207B270 */ cpu->r[12] = rbrew_read32(cpu->mem, _t106);
-        /* 0207B274 */ _t107 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207B274 */ _t107 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207B274 */ _t108 = _t107 & 0x00000001u;
         /* 0207B274 */ if (_t108) goto L_0207B278; else goto L_0207B27C;
   L_0207B278: ; // 0x207b278
@@ -26920,10 +26920,10 @@ void Gambit_fn_0207AFE0(CPUState* cpu) {
         /* 0207B2F8 */ Gambit_fn_0207C348(cpu);
         /* 0207B2FC */ _t130 = cpu->r[28] + 0x00000238u;
         /* 0207B2FC */ cpu->r[5] = rbrew_read32(cpu->mem, _t130);
-        /* 0207B300 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x00000002u);
+        /* 0207B300 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x00000002u));
         /* 0207B304 */ _t131 = cpu->r[28] + 0x0000023Cu;
         /* 0207B304 */ cpu->r[11] = rbrew_read32(cpu->mem, _t131);
-        /* 0207B308 */ _t132 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207B308 */ _t132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207B308 */ _t133 = _t132 & 0x00000001u;
         /* 0207B308 */ if (_t133) goto L_0207B30C; else goto L_0207B310;
   L_0207B30C: ; // 0x207b30c
@@ -26935,10 +26935,10 @@ void Gambit_fn_0207AFE0(CPUState* cpu) {
         /* 0207B318 */ Gambit_fn_020A7BE4(cpu);
         /* 0207B31C */ _t135 = cpu->r[28] + 0x00000238u;
         /* 0207B31C */ cpu->r[0] = rbrew_read32(cpu->mem, _t135);
-        /* 0207B320 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000002u);
+        /* 0207B320 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000002u));
         /* 0207B324 */ _t136 = cpu->r[28] + 0x0000023Cu;
         /* 0207B324 */ cpu->r[9] = rbrew_read32(cpu->mem, _t136);
-        /* 0207B328 */ _t137 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207B328 */ _t137 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207B328 */ _t138 = _t137 & 0x00000001u;
         /* 0207B328 */ if (_t138) goto L_0207B32C; else goto L_0207B330;
   L_0207B32C: ; // 0x207b32c
@@ -26949,13 +26949,13 @@ void Gambit_fn_0207AFE0(CPUState* cpu) {
         /* 0207B334 */ Gambit_fn_020A7E60(cpu);
         /* 0207B338 */ _t140 = cpu->r[28] + 0x00000214u;
         /* 0207B338 */ cpu->r[7] = rbrew_read32(cpu->mem, _t140);
-        /* 0207B33C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0207B340 */ _t141 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B33C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0207B340 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B340 */ _t142 = _t141 & 0x00000001u;
         /* 0207B340 */ if (_t142) goto L_0207B34C; else goto L_0207B344;
   L_0207B344: ; // 0x207b344
-        /* 0207B344 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000001u);
-        /* 0207B348 */ _t143 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B344 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000001u));
+        /* 0207B348 */ _t143 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B348 */ _t144 = _t143 & 0x00000001u;
         /* 0207B348 */ if (_t144) goto L_0207B34C; else goto L_0207B38C;
   L_0207B34C: ; // 0x207b34c
@@ -27006,54 +27006,54 @@ void Gambit_fn_0207B3A0(CPUState* cpu) {
         /* 0207B3B4 */ Gambit_fn_0207ACA4(cpu);
         /* 0207B3B8 */ _t3 = cpu->r[31] + 0x00000240u;
         /* 0207B3B8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 0207B3BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 0207B3C0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B3BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 0207B3C0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B3C0 */ _t5 = _t4 & 0x00000001u;
         /* 0207B3C0 */ if (_t5) goto L_0207B3C4; else goto L_0207B3E8;
   L_0207B3C4: ; // 0x207b3c4
         /* 0207B3C4 */ _t6 = cpu->r[31] + 0x00000214u;
         /* 0207B3C4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t6);
-        /* 0207B3C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0207B3CC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B3C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0207B3CC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B3CC */ _t8 = _t7 & 0x00000001u;
         /* 0207B3CC */ if (_t8) goto L_0207B3D8; else goto L_0207B3D0;
   L_0207B3D0: ; // 0x207b3d0
-        /* 0207B3D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000001u);
-        /* 0207B3D4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B3D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000001u));
+        /* 0207B3D4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B3D4 */ _t10 = _t9 & 0x00000001u;
         /* 0207B3D4 */ if (_t10) goto L_0207B3D8; else goto L_0207B434;
   L_0207B3D8: ; // 0x207b3d8
         /* 0207B3D8 */ _t11 = cpu->r[31] + 0x00000224u;
         /* 0207B3D8 */ cpu->r[4] = rbrew_read32(cpu->mem, _t11);
-        /* 0207B3DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0207B3E0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B3DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0207B3E0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B3E0 */ _t13 = _t12 & 0x00000001u;
         /* 0207B3E0 */ if (_t13) goto L_0207B434; else goto L_0207B3E4;
   L_0207B3E4: ; // 0x207b3e4
         /* 0207B3E4 */ goto L_0207B428;
   L_0207B3E8: ; // 0x207b3e8
-        /* 0207B3E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 0207B3EC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B3E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 0207B3EC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B3EC */ _t15 = _t14 & 0x00000001u;
         /* 0207B3EC */ if (_t15) goto L_0207B3F0; else goto L_0207B434;
   L_0207B3F0: ; // 0x207b3f0
         /* 0207B3F0 */ _t16 = cpu->r[31] + 0x00000214u;
         /* 0207B3F0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t16);
-        /* 0207B3F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0207B3F8 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B3F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0207B3F8 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B3F8 */ _t18 = _t17 & 0x00000001u;
         /* 0207B3F8 */ if (_t18) goto L_0207B404; else goto L_0207B3FC;
   L_0207B3FC: ; // 0x207b3fc
-        /* 0207B3FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000001u);
-        /* 0207B400 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B3FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000001u));
+        /* 0207B400 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B400 */ _t20 = _t19 & 0x00000001u;
         /* 0207B400 */ if (_t20) goto L_0207B404; else goto L_0207B434;
   L_0207B404: ; // 0x207b404
         /* 0207B404 */ _t21 = cpu->r[31] + 0x00000218u;
         /* 0207B404 */ cpu->r[3] = rbrew_read32(cpu->mem, _t21);
         /* 0207B408 */ Gambit_fn_0207C41C(cpu);
-        /* 0207B40C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207B410 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B40C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207B410 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B410 */ _t23 = _t22 & 0x00000001u;
         /* 0207B410 */ if (_t23) goto L_0207B414; else goto L_0207B41C;
   L_0207B414: ; // 0x207b414
@@ -27064,8 +27064,8 @@ void Gambit_fn_0207B3A0(CPUState* cpu) {
         /* 0207B41C */ _t25 = cpu->r[31] + 0x0000022Cu;
         /* 0207B41C */ cpu->r[4] = rbrew_read32(cpu->mem, _t25);
   L_0207B420: ; // 0x207b420
-        /* 0207B420 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0207B424 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B420 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0207B424 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B424 */ _t27 = _t26 & 0x00000001u;
         /* 0207B424 */ if (_t27) goto L_0207B434; else goto L_0207B428;
   L_0207B428: ; // 0x207b428
@@ -27098,54 +27098,54 @@ void Gambit_fn_0207B3A4(CPUState* cpu) {
         /* 0207B3B4 */ Gambit_fn_0207ACA4(cpu);
         /* 0207B3B8 */ _t3 = cpu->r[31] + 0x00000240u;
         /* 0207B3B8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 0207B3BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 0207B3C0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B3BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 0207B3C0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B3C0 */ _t5 = _t4 & 0x00000001u;
         /* 0207B3C0 */ if (_t5) goto L_0207B3C4; else goto L_0207B3E8;
   L_0207B3C4: ; // 0x207b3c4
         /* 0207B3C4 */ _t6 = cpu->r[31] + 0x00000214u;
         /* 0207B3C4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t6);
-        /* 0207B3C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0207B3CC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B3C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0207B3CC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B3CC */ _t8 = _t7 & 0x00000001u;
         /* 0207B3CC */ if (_t8) goto L_0207B3D8; else goto L_0207B3D0;
   L_0207B3D0: ; // 0x207b3d0
-        /* 0207B3D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000001u);
-        /* 0207B3D4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B3D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000001u));
+        /* 0207B3D4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B3D4 */ _t10 = _t9 & 0x00000001u;
         /* 0207B3D4 */ if (_t10) goto L_0207B3D8; else goto L_0207B434;
   L_0207B3D8: ; // 0x207b3d8
         /* 0207B3D8 */ _t11 = cpu->r[31] + 0x00000224u;
         /* 0207B3D8 */ cpu->r[4] = rbrew_read32(cpu->mem, _t11);
-        /* 0207B3DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0207B3E0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B3DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0207B3E0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B3E0 */ _t13 = _t12 & 0x00000001u;
         /* 0207B3E0 */ if (_t13) goto L_0207B434; else goto L_0207B3E4;
   L_0207B3E4: ; // 0x207b3e4
         /* 0207B3E4 */ goto L_0207B428;
   L_0207B3E8: ; // 0x207b3e8
-        /* 0207B3E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 0207B3EC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B3E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 0207B3EC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B3EC */ _t15 = _t14 & 0x00000001u;
         /* 0207B3EC */ if (_t15) goto L_0207B3F0; else goto L_0207B434;
   L_0207B3F0: ; // 0x207b3f0
         /* 0207B3F0 */ _t16 = cpu->r[31] + 0x00000214u;
         /* 0207B3F0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t16);
-        /* 0207B3F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0207B3F8 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B3F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0207B3F8 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B3F8 */ _t18 = _t17 & 0x00000001u;
         /* 0207B3F8 */ if (_t18) goto L_0207B404; else goto L_0207B3FC;
   L_0207B3FC: ; // 0x207b3fc
-        /* 0207B3FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000001u);
-        /* 0207B400 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B3FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000001u));
+        /* 0207B400 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B400 */ _t20 = _t19 & 0x00000001u;
         /* 0207B400 */ if (_t20) goto L_0207B404; else goto L_0207B434;
   L_0207B404: ; // 0x207b404
         /* 0207B404 */ _t21 = cpu->r[31] + 0x00000218u;
         /* 0207B404 */ cpu->r[3] = rbrew_read32(cpu->mem, _t21);
         /* 0207B408 */ Gambit_fn_0207C41C(cpu);
-        /* 0207B40C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207B410 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B40C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207B410 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B410 */ _t23 = _t22 & 0x00000001u;
         /* 0207B410 */ if (_t23) goto L_0207B414; else goto L_0207B41C;
   L_0207B414: ; // 0x207b414
@@ -27156,8 +27156,8 @@ void Gambit_fn_0207B3A4(CPUState* cpu) {
         /* 0207B41C */ _t25 = cpu->r[31] + 0x0000022Cu;
         /* 0207B41C */ cpu->r[4] = rbrew_read32(cpu->mem, _t25);
   L_0207B420: ; // 0x207b420
-        /* 0207B420 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0207B424 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B420 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0207B424 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B424 */ _t27 = _t26 & 0x00000001u;
         /* 0207B424 */ if (_t27) goto L_0207B434; else goto L_0207B428;
   L_0207B428: ; // 0x207b428
@@ -27188,9 +27188,9 @@ void Gambit_fn_0207B44C(CPUState* cpu) {
         /* 0207B454 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0207B458 */ _t3 = cpu->r[3] + 0x000001E4u;
         /* 0207B458 */ cpu->r[8] = rbrew_read32(cpu->mem, _t3);
-        /* 0207B45C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0207B45C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0207B460 */ cpu->r[31] = cpu->r[3];
-        /* 0207B464 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B464 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B464 */ _t5 = _t4 & 0x00000001u;
         /* 0207B464 */ if (_t5) goto L_0207B468; else goto L_0207B4D8;
   L_0207B468: ; // 0x207b468
@@ -27232,8 +27232,8 @@ void Gambit_fn_0207B44C(CPUState* cpu) {
   L_0207B4D8: ; // 0x207b4d8
         /* 0207B4D8 */ cpu->r[4] = 0x00000000u;
         /* 0207B4DC */ Gambit_fn_027EDF00(cpu);
-        /* 0207B4E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207B4E4 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B4E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207B4E4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B4E4 */ _t14 = _t13 & 0x00000001u;
         /* 0207B4E4 */ if (_t14) goto L_0207B524; else goto L_0207B4E8;
   L_0207B4E8: ; // 0x207b4e8
@@ -27241,9 +27241,9 @@ void Gambit_fn_0207B44C(CPUState* cpu) {
         /* 0207B4EC */ Gambit_fn_0207B3A0(cpu);
         /* 0207B4F0 */ _t15 = cpu->r[31] + 0x00000240u;
         /* 0207B4F0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t15);
-        /* 0207B4F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0207B4F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0207B4F8 */ cpu->r[3] = cpu->r[31] + 0x000001DCu;
-        /* 0207B4FC */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B4FC */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B4FC */ _t17 = _t16 & 0x00000001u;
         /* 0207B4FC */ if (_t17) goto L_0207B500; else goto L_0207B51C;
   L_0207B500: ; // 0x207b500
@@ -27285,8 +27285,8 @@ void Gambit_fn_0207B53C(CPUState* cpu) {
         /* 0207B54C */ _t3 = cpu->r[31] + 0x00000220u;
         /* 0207B54C */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0207B550 */ Gambit_fn_020C3920(cpu);
-        /* 0207B554 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207B558 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B554 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207B558 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B558 */ _t5 = _t4 & 0x00000001u;
         /* 0207B558 */ if (_t5) goto L_0207B57C; else goto L_0207B55C;
   L_0207B55C: ; // 0x207b55c
@@ -27304,15 +27304,15 @@ void Gambit_fn_0207B53C(CPUState* cpu) {
         /* 0207B57C */ _t8 = cpu->r[31] + 0x00000220u;
         /* 0207B57C */ cpu->r[3] = rbrew_read32(cpu->mem, _t8);
         /* 0207B580 */ Gambit_fn_020C38CC(cpu);
-        /* 0207B584 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207B588 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207B588 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B588 */ _t10 = _t9 & 0x00000001u;
         /* 0207B588 */ if (_t10) goto L_0207B5A0; else goto L_0207B58C;
   L_0207B58C: ; // 0x207b58c
         /* 0207B58C */ _t11 = cpu->r[31] + 0x000001E4u;
         /* 0207B58C */ cpu->r[0] = rbrew_read32(cpu->mem, _t11);
-        /* 0207B590 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x0000000Au);
-        /* 0207B594 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B590 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x0000000Au));
+        /* 0207B594 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B594 */ _t13 = _t12 & 0x00000001u;
         /* 0207B594 */ if (_t13) goto L_0207B598; else goto L_0207B5A0;
   L_0207B598: ; // 0x207b598
@@ -27346,15 +27346,15 @@ void Gambit_fn_0207B5B8(CPUState* cpu) {
         /* 0207B5C8 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 0207B5CC */ _t4 = cpu->r[31] + 0x000001E4u;
         /* 0207B5CC */ cpu->r[11] = rbrew_read32(cpu->mem, _t4);
-        /* 0207B5D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0207B5D4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B5D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0207B5D4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B5D4 */ _t6 = _t5 & 0x00000001u;
         /* 0207B5D4 */ if (_t6) goto L_0207B5D8; else goto L_0207B670;
   L_0207B5D8: ; // 0x207b5d8
         /* 0207B5D8 */ _t7 = cpu->r[31] + 0x00000240u;
         /* 0207B5D8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t7);
-        /* 0207B5DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207B5E0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B5DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207B5E0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B5E0 */ _t9 = _t8 & 0x00000001u;
         /* 0207B5E0 */ if (_t9) goto L_0207B5E4; else goto L_0207B5F4;
   L_0207B5E4: ; // 0x207b5e4
@@ -27366,15 +27366,15 @@ void Gambit_fn_0207B5B8(CPUState* cpu) {
         /* 0207B5F0 */ _t12 = cpu->r[31] + 0x00000240u;
         /* 0207B5F0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
   L_0207B5F4: ; // 0x207b5f4
-        /* 0207B5F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 0207B5F8 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B5F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 0207B5F8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B5F8 */ _t14 = _t13 & 0x00000001u;
         /* 0207B5F8 */ if (_t14) goto L_0207B5FC; else goto L_0207B628;
   L_0207B5FC: ; // 0x207b5fc
         /* 0207B5FC */ _t15 = cpu->r[31] + 0x00000224u;
         /* 0207B5FC */ cpu->r[9] = rbrew_read32(cpu->mem, _t15);
-        /* 0207B600 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0207B604 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B600 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0207B604 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B604 */ _t17 = _t16 & 0x00000001u;
         /* 0207B604 */ if (_t17) goto L_0207B758; else goto L_0207B608;
   L_0207B608: ; // 0x207b608
@@ -27391,15 +27391,15 @@ void Gambit_fn_0207B5B8(CPUState* cpu) {
         /* 0207B620 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 0207B624 */ return;
   L_0207B628: ; // 0x207b628
-        /* 0207B628 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 0207B62C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B628 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 0207B62C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B62C */ _t23 = _t22 & 0x00000001u;
         /* 0207B62C */ if (_t23) goto L_0207B630; else goto L_0207B758;
   L_0207B630: ; // 0x207b630
         /* 0207B630 */ _t24 = cpu->r[31] + 0x00000228u;
         /* 0207B630 */ cpu->r[7] = rbrew_read32(cpu->mem, _t24);
-        /* 0207B634 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0207B638 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B634 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0207B638 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B638 */ _t26 = _t25 & 0x00000001u;
         /* 0207B638 */ if (_t26) goto L_0207B644; else goto L_0207B63C;
   L_0207B63C: ; // 0x207b63c
@@ -27409,8 +27409,8 @@ void Gambit_fn_0207B5B8(CPUState* cpu) {
   L_0207B644: ; // 0x207b644
         /* 0207B644 */ _t28 = cpu->r[31] + 0x0000022Cu;
         /* 0207B644 */ cpu->r[8] = rbrew_read32(cpu->mem, _t28);
-        /* 0207B648 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 0207B64C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B648 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 0207B64C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B64C */ _t30 = _t29 & 0x00000001u;
         /* 0207B64C */ if (_t30) goto L_0207B758; else goto L_0207B650;
   L_0207B650: ; // 0x207b650
@@ -27429,21 +27429,21 @@ void Gambit_fn_0207B5B8(CPUState* cpu) {
   L_0207B670: ; // 0x207b670
         /* 0207B670 */ _t35 = cpu->r[31] + 0x00000214u;
         /* 0207B670 */ cpu->r[0] = rbrew_read32(cpu->mem, _t35);
-        /* 0207B674 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0207B674 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0207B678 */ cpu->r[30] = 0x00000000u;
-        /* 0207B67C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B67C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B67C */ _t37 = _t36 & 0x00000001u;
         /* 0207B67C */ if (_t37) goto L_0207B688; else goto L_0207B680;
   L_0207B680: ; // 0x207b680
-        /* 0207B680 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 0207B684 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B680 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 0207B684 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B684 */ _t39 = _t38 & 0x00000001u;
         /* 0207B684 */ if (_t39) goto L_0207B688; else goto L_0207B758;
   L_0207B688: ; // 0x207b688
         /* 0207B688 */ _t40 = cpu->r[31] + 0x00000240u;
         /* 0207B688 */ cpu->r[0] = rbrew_read32(cpu->mem, _t40);
-        /* 0207B68C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207B690 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B68C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207B690 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B690 */ _t42 = _t41 & 0x00000001u;
         /* 0207B690 */ if (_t42) goto L_0207B694; else goto L_0207B6B8;
   L_0207B694: ; // 0x207b694
@@ -27455,17 +27455,17 @@ void Gambit_fn_0207B5B8(CPUState* cpu) {
         /* 0207B69C */ cpu->r[12] = rbrew_read32(cpu->mem, _t45);
         /* 0207B6A0 */ cpu->ctr = cpu->r[12];
         /* 0207B6A4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207B6A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0207B6A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0207B6AC */ _t46 = cpu->r[31] + 0x00000240u;
         /* 0207B6AC */ cpu->r[0] = rbrew_read32(cpu->mem, _t46);
-        /* 0207B6B0 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B6B0 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B6B0 */ _t48 = _t47 & 0x00000001u;
         /* 0207B6B0 */ if (_t48) goto L_0207B6B8; else goto L_0207B6B4;
   L_0207B6B4: ; // 0x207b6b4
         /* 0207B6B4 */ cpu->r[30] = 0x00000001u;
   L_0207B6B8: ; // 0x207b6b8
-        /* 0207B6B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 0207B6BC */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B6B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 0207B6BC */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B6BC */ _t50 = _t49 & 0x00000001u;
         /* 0207B6BC */ if (_t50) goto L_0207B6C0; else goto L_0207B6E0;
   L_0207B6C0: ; // 0x207b6c0
@@ -27477,15 +27477,15 @@ void Gambit_fn_0207B5B8(CPUState* cpu) {
         /* 0207B6C8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t53);
         /* 0207B6CC */ cpu->ctr = cpu->r[0];
         /* 0207B6D0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207B6D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207B6D8 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B6D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207B6D8 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B6D8 */ _t55 = _t54 & 0x00000001u;
         /* 0207B6D8 */ if (_t55) goto L_0207B724; else goto L_0207B6DC;
   L_0207B6DC: ; // 0x207b6dc
         /* 0207B6DC */ goto L_0207B72C;
   L_0207B6E0: ; // 0x207b6e0
-        /* 0207B6E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 0207B6E4 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B6E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 0207B6E4 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B6E4 */ _t57 = _t56 & 0x00000001u;
         /* 0207B6E4 */ if (_t57) goto L_0207B6E8; else goto L_0207B724;
   L_0207B6E8: ; // 0x207b6e8
@@ -27497,14 +27497,14 @@ void Gambit_fn_0207B5B8(CPUState* cpu) {
         /* 0207B6F0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t60);
         /* 0207B6F4 */ cpu->ctr = cpu->r[8];
         /* 0207B6F8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207B6FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0207B6FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0207B700 */ _t61 = cpu->r[31] + 0x0000022Cu;
         /* 0207B700 */ cpu->r[3] = rbrew_read32(cpu->mem, _t61);
         /* 0207B704 */ _t62 = cpu->r[3] + 0x00000000u;
         /* 0207B704 */ cpu->r[9] = rbrew_read32(cpu->mem, _t62);
         /* 0207B708 */ _t63 = cpu->r[9] + 0x00000084u;
         /* 0207B708 */ cpu->r[10] = rbrew_read32(cpu->mem, _t63);
-        /* 0207B70C */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B70C */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B70C */ _t65 = _t64 & 0x00000001u;
         /* 0207B70C */ if (_t65) goto L_0207B714; else goto L_0207B710;
   L_0207B710: ; // 0x207b710
@@ -27512,13 +27512,13 @@ void Gambit_fn_0207B5B8(CPUState* cpu) {
   L_0207B714: ; // 0x207b714
         /* 0207B714 */ cpu->ctr = cpu->r[10];
         /* 0207B718 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207B71C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207B720 */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B71C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207B720 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B720 */ _t67 = _t66 & 0x00000001u;
         /* 0207B720 */ if (_t67) goto L_0207B724; else goto L_0207B72C;
   L_0207B724: ; // 0x207b724
-        /* 0207B724 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0207B728 */ _t68 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B724 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0207B728 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B728 */ _t69 = _t68 & 0x00000001u;
         /* 0207B728 */ if (_t69) goto L_0207B758; else goto L_0207B72C;
   L_0207B72C: ; // 0x207b72c
@@ -27565,21 +27565,21 @@ void Gambit_fn_0207B774(CPUState* cpu) {
         /* 0207B784 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 0207B788 */ _t4 = cpu->r[31] + 0x00000214u;
         /* 0207B788 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
-        /* 0207B78C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0207B78C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0207B790 */ cpu->r[30] = 0x00000000u;
-        /* 0207B794 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B794 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B794 */ _t6 = _t5 & 0x00000001u;
         /* 0207B794 */ if (_t6) goto L_0207B7A0; else goto L_0207B798;
   L_0207B798: ; // 0x207b798
-        /* 0207B798 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 0207B79C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B798 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 0207B79C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B79C */ _t8 = _t7 & 0x00000001u;
         /* 0207B79C */ if (_t8) goto L_0207B7A0; else goto L_0207B88C;
   L_0207B7A0: ; // 0x207b7a0
         /* 0207B7A0 */ _t9 = cpu->r[31] + 0x00000240u;
         /* 0207B7A0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 0207B7A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207B7A8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B7A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207B7A8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B7A8 */ _t11 = _t10 & 0x00000001u;
         /* 0207B7A8 */ if (_t11) goto L_0207B7AC; else goto L_0207B7D0;
   L_0207B7AC: ; // 0x207b7ac
@@ -27591,17 +27591,17 @@ void Gambit_fn_0207B774(CPUState* cpu) {
         /* 0207B7B4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 0207B7B8 */ cpu->ctr = cpu->r[0];
         /* 0207B7BC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207B7C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0207B7C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0207B7C4 */ _t15 = cpu->r[31] + 0x00000240u;
         /* 0207B7C4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t15);
-        /* 0207B7C8 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B7C8 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B7C8 */ _t17 = _t16 & 0x00000001u;
         /* 0207B7C8 */ if (_t17) goto L_0207B7D0; else goto L_0207B7CC;
   L_0207B7CC: ; // 0x207b7cc
         /* 0207B7CC */ cpu->r[30] = 0x00000001u;
   L_0207B7D0: ; // 0x207b7d0
-        /* 0207B7D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 0207B7D4 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B7D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 0207B7D4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B7D4 */ _t19 = _t18 & 0x00000001u;
         /* 0207B7D4 */ if (_t19) goto L_0207B7D8; else goto L_0207B7F8;
   L_0207B7D8: ; // 0x207b7d8
@@ -27613,15 +27613,15 @@ void Gambit_fn_0207B774(CPUState* cpu) {
         /* 0207B7E0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t22);
         /* 0207B7E4 */ cpu->ctr = cpu->r[12];
         /* 0207B7E8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207B7EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207B7F0 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B7EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207B7F0 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B7F0 */ _t24 = _t23 & 0x00000001u;
         /* 0207B7F0 */ if (_t24) goto L_0207B83C; else goto L_0207B7F4;
   L_0207B7F4: ; // 0x207b7f4
         /* 0207B7F4 */ goto L_0207B844;
   L_0207B7F8: ; // 0x207b7f8
-        /* 0207B7F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 0207B7FC */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B7F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 0207B7FC */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B7FC */ _t26 = _t25 & 0x00000001u;
         /* 0207B7FC */ if (_t26) goto L_0207B800; else goto L_0207B83C;
   L_0207B800: ; // 0x207b800
@@ -27633,14 +27633,14 @@ void Gambit_fn_0207B774(CPUState* cpu) {
         /* 0207B808 */ cpu->r[0] = rbrew_read32(cpu->mem, _t29);
         /* 0207B80C */ cpu->ctr = cpu->r[0];
         /* 0207B810 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207B814 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0207B814 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0207B818 */ _t30 = cpu->r[31] + 0x0000022Cu;
         /* 0207B818 */ cpu->r[3] = rbrew_read32(cpu->mem, _t30);
         /* 0207B81C */ _t31 = cpu->r[3] + 0x00000000u;
         /* 0207B81C */ cpu->r[11] = rbrew_read32(cpu->mem, _t31);
         /* 0207B820 */ _t32 = cpu->r[11] + 0x000000DCu;
         /* 0207B820 */ cpu->r[0] = rbrew_read32(cpu->mem, _t32);
-        /* 0207B824 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B824 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B824 */ _t34 = _t33 & 0x00000001u;
         /* 0207B824 */ if (_t34) goto L_0207B82C; else goto L_0207B828;
   L_0207B828: ; // 0x207b828
@@ -27648,13 +27648,13 @@ void Gambit_fn_0207B774(CPUState* cpu) {
   L_0207B82C: ; // 0x207b82c
         /* 0207B82C */ cpu->ctr = cpu->r[0];
         /* 0207B830 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207B834 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207B838 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B834 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207B838 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B838 */ _t36 = _t35 & 0x00000001u;
         /* 0207B838 */ if (_t36) goto L_0207B83C; else goto L_0207B844;
   L_0207B83C: ; // 0x207b83c
-        /* 0207B83C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0207B840 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B83C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0207B840 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B840 */ _t38 = _t37 & 0x00000001u;
         /* 0207B840 */ if (_t38) goto L_0207B88C; else goto L_0207B844;
   L_0207B844: ; // 0x207b844
@@ -27665,8 +27665,8 @@ void Gambit_fn_0207B774(CPUState* cpu) {
         /* 0207B850 */ cpu->r[0] = rbrew_read32(cpu->mem, _t39);
         /* 0207B854 */ _t40 = cpu->r[31] + 0x0000024Cu;
         /* 0207B854 */ cpu->r[12] = rbrew_read32(cpu->mem, _t40);
-        /* 0207B858 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 0207B85C */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B858 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 0207B85C */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B85C */ _t42 = _t41 & 0x00000001u;
         /* 0207B85C */ if (_t42) goto L_0207B860; else goto L_0207B880;
   L_0207B860: ; // 0x207b860
@@ -27674,8 +27674,8 @@ void Gambit_fn_0207B774(CPUState* cpu) {
         /* 0207B860 */ cpu->r[12] = rbrew_read32(cpu->mem, _t43);
         /* 0207B864 */ _t44 = cpu->r[12] + 0x00000481u;
         /* 0207B864 */ cpu->r[0] = rbrew_read8(cpu->mem, _t44);
-        /* 0207B868 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207B86C */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B868 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207B86C */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B86C */ _t46 = _t45 & 0x00000001u;
         /* 0207B86C */ if (_t46) goto L_0207B880; else goto L_0207B870;
   L_0207B870: ; // 0x207b870
@@ -27714,9 +27714,9 @@ void Gambit_fn_0207B8A8(CPUState* cpu) {
         /* 0207B8B4 */ _t3 = cpu->r[3] + 0x000001E4u;
         /* 0207B8B4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 0207B8B8 */ cpu->r[4] = 0x00000000u;
-        /* 0207B8BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0207B8BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0207B8C0 */ cpu->r[31] = cpu->r[3];
-        /* 0207B8C4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B8C4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B8C4 */ _t5 = _t4 & 0x00000001u;
         /* 0207B8C4 */ if (_t5) goto L_0207B8C8; else goto L_0207B904;
   L_0207B8C8: ; // 0x207b8c8
@@ -27742,8 +27742,8 @@ void Gambit_fn_0207B8A8(CPUState* cpu) {
         /* 0207B900 */ return;
   L_0207B904: ; // 0x207b904
         /* 0207B904 */ Gambit_fn_027EDF00(cpu);
-        /* 0207B908 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207B90C */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B908 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207B90C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B90C */ _t12 = _t11 & 0x00000001u;
         /* 0207B90C */ if (_t12) goto L_0207B95C; else goto L_0207B910;
   L_0207B910: ; // 0x207b910
@@ -27751,8 +27751,8 @@ void Gambit_fn_0207B8A8(CPUState* cpu) {
         /* 0207B910 */ cpu->r[11] = rbrew_read32(cpu->mem, _t13);
         /* 0207B914 */ _t14 = cpu->r[31] + 0x0000024Cu;
         /* 0207B914 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
-        /* 0207B918 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[0]);
-        /* 0207B91C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[0]));
+        /* 0207B91C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B91C */ _t16 = _t15 & 0x00000001u;
         /* 0207B91C */ if (_t16) goto L_0207B920; else goto L_0207B948;
   L_0207B920: ; // 0x207b920
@@ -27899,15 +27899,15 @@ void Gambit_fn_0207B9DC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0207B9DC: ; // 0x207b9dc
-        /* 0207B9DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207B9E0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B9DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207B9E0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B9E0 */ _t1 = _t0 & 0x00000001u;
         /* 0207B9E0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207B9E0 */ goto L_0207B9E4;
   L_0207B9E4: ; // 0x207b9e4
         /* 0207B9E4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0207B9E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207B9E8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207B9E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207B9E8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207B9E8 */ _t3 = _t2 & 0x00000001u;
         /* 0207B9E8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207B9E8 */ goto L_0207B9EC;
@@ -27926,8 +27926,8 @@ void Gambit_fn_0207B9DC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -27941,15 +27941,15 @@ void Gambit_fn_0207B9DC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -27986,11 +27986,11 @@ void Gambit_fn_0207B9F0(CPUState* cpu) {
         /* 0207B9FC */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0207B9FC */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0207BA00 */ cpu->r[30] = cpu->r[3];
-        /* 0207BA00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207BA00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0207BA04 */ cpu->r[31] = cpu->r[4];
         /* 0207BA08 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0207BA08 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0207BA0C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BA0C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BA0C */ _t5 = _t4 & 0x00000001u;
         /* 0207BA0C */ if (_t5) goto L_0207BA50; else goto L_0207BA10;
   L_0207BA10: ; // 0x207ba10
@@ -28010,8 +28010,8 @@ void Gambit_fn_0207B9F0(CPUState* cpu) {
         /* 0207BA38 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 0207BA3C */ Gambit_fn_02068798(cpu);
         /* 0207BA40 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0207BA40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207BA44 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BA40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207BA44 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BA44 */ _t10 = _t9 & 0x00000001u;
         /* 0207BA44 */ if (_t10) goto L_0207BA50; else goto L_0207BA48;
   L_0207BA48: ; // 0x207ba48
@@ -28042,11 +28042,11 @@ void Gambit_fn_0207B9F4(CPUState* cpu) {
         /* 0207B9FC */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0207B9FC */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0207BA00 */ cpu->r[30] = cpu->r[3];
-        /* 0207BA00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207BA00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0207BA04 */ cpu->r[31] = cpu->r[4];
         /* 0207BA08 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0207BA08 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0207BA0C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BA0C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BA0C */ _t5 = _t4 & 0x00000001u;
         /* 0207BA0C */ if (_t5) goto L_0207BA50; else goto L_0207BA10;
   L_0207BA10: ; // 0x207ba10
@@ -28066,8 +28066,8 @@ void Gambit_fn_0207B9F4(CPUState* cpu) {
         /* 0207BA38 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 0207BA3C */ Gambit_fn_02068798(cpu);
         /* 0207BA40 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0207BA40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207BA44 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BA40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207BA44 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BA44 */ _t10 = _t9 & 0x00000001u;
         /* 0207BA44 */ if (_t10) goto L_0207BA50; else goto L_0207BA48;
   L_0207BA48: ; // 0x207ba48
@@ -28128,15 +28128,15 @@ void Gambit_fn_0207BA84(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0207BA84: ; // 0x207ba84
-        /* 0207BA84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207BA88 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BA84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207BA88 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BA88 */ _t1 = _t0 & 0x00000001u;
         /* 0207BA88 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207BA88 */ goto L_0207BA8C;
   L_0207BA8C: ; // 0x207ba8c
         /* 0207BA8C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0207BA8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207BA90 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BA8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207BA90 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BA90 */ _t3 = _t2 & 0x00000001u;
         /* 0207BA90 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207BA90 */ goto L_0207BA94;
@@ -28155,8 +28155,8 @@ void Gambit_fn_0207BA84(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -28170,15 +28170,15 @@ void Gambit_fn_0207BA84(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -28224,15 +28224,15 @@ void Gambit_fn_0207BAB4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0207BAB4: ; // 0x207bab4
-        /* 0207BAB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207BAB8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BAB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207BAB8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BAB8 */ _t1 = _t0 & 0x00000001u;
         /* 0207BAB8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207BAB8 */ goto L_0207BABC;
   L_0207BABC: ; // 0x207babc
         /* 0207BABC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0207BABC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207BAC0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BABC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207BAC0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BAC0 */ _t3 = _t2 & 0x00000001u;
         /* 0207BAC0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207BAC0 */ goto L_0207BAC4;
@@ -28251,8 +28251,8 @@ void Gambit_fn_0207BAB4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -28266,15 +28266,15 @@ void Gambit_fn_0207BAB4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -28302,15 +28302,15 @@ void Gambit_fn_0207BAC8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0207BAC8: ; // 0x207bac8
-        /* 0207BAC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207BACC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BAC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207BACC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BACC */ _t1 = _t0 & 0x00000001u;
         /* 0207BACC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207BACC */ goto L_0207BAD0;
   L_0207BAD0: ; // 0x207bad0
         /* 0207BAD0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0207BAD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207BAD4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BAD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207BAD4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BAD4 */ _t3 = _t2 & 0x00000001u;
         /* 0207BAD4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207BAD4 */ goto L_0207BAD8;
@@ -28329,8 +28329,8 @@ void Gambit_fn_0207BAC8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -28344,15 +28344,15 @@ void Gambit_fn_0207BAC8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -28380,15 +28380,15 @@ void Gambit_fn_0207BADC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0207BADC: ; // 0x207badc
-        /* 0207BADC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207BAE0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BADC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207BAE0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BAE0 */ _t1 = _t0 & 0x00000001u;
         /* 0207BAE0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207BAE0 */ goto L_0207BAE4;
   L_0207BAE4: ; // 0x207bae4
         /* 0207BAE4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0207BAE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207BAE8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BAE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207BAE8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BAE8 */ _t3 = _t2 & 0x00000001u;
         /* 0207BAE8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207BAE8 */ goto L_0207BAEC;
@@ -28407,8 +28407,8 @@ void Gambit_fn_0207BADC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -28422,15 +28422,15 @@ void Gambit_fn_0207BADC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -28458,15 +28458,15 @@ void Gambit_fn_0207BAF0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0207BAF0: ; // 0x207baf0
-        /* 0207BAF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207BAF4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BAF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207BAF4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BAF4 */ _t1 = _t0 & 0x00000001u;
         /* 0207BAF4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207BAF4 */ goto L_0207BAF8;
   L_0207BAF8: ; // 0x207baf8
         /* 0207BAF8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0207BAF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207BAFC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BAF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207BAFC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BAFC */ _t3 = _t2 & 0x00000001u;
         /* 0207BAFC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207BAFC */ goto L_0207BB00;
@@ -28485,8 +28485,8 @@ void Gambit_fn_0207BAF0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -28500,15 +28500,15 @@ void Gambit_fn_0207BAF0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -28608,9 +28608,9 @@ void Gambit_fn_0207BB40(CPUState* cpu) {
         /* 0207BB44 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 0207BB44 */ cpu->r[9] = _t0;
         /* 0207BB48 */ cpu->r[12] = 0x101D0000u;
-        /* 0207BB4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0207BB4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0207BB50 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 0207BB54 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BB54 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BB54 */ _t2 = _t1 & 0x00000001u;
         /* 0207BB54 */ if (_t2) goto L_0207BB58; else goto L_0207BB6C;
   L_0207BB58: ; // 0x207bb58
@@ -28622,8 +28622,8 @@ void Gambit_fn_0207BB40(CPUState* cpu) {
         /* 0207BB68 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 0207BB68 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_0207BB6C: ; // 0x207bb6c
-        /* 0207BB6C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0207BB70 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BB6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0207BB70 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BB70 */ _t6 = _t5 & 0x00000001u;
         /* 0207BB70 */ if (_t6) goto L_0207BB74; else goto L_0207BB7C;
   L_0207BB74: ; // 0x207bb74
@@ -28635,9 +28635,9 @@ void Gambit_fn_0207BB40(CPUState* cpu) {
         /* 0207BB80 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 0207BB80 */ cpu->r[7] = _t7;
         /* 0207BB84 */ cpu->r[11] = 0x101D0000u;
-        /* 0207BB88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0207BB88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0207BB8C */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 0207BB90 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BB90 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BB90 */ _t9 = _t8 & 0x00000001u;
         /* 0207BB90 */ if (_t9) goto L_0207BB94; else goto L_0207BBA8;
   L_0207BB94: ; // 0x207bb94
@@ -28722,18 +28722,18 @@ void Gambit_fn_0207BBE0(CPUState* cpu) {
         /* 02008C00 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02008C00 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02008C04 */ cpu->r[12] = 0x00000000u;
-        /* 02008C08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02008C08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02008C0C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 02008C0C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02008C10 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02008C10 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02008C10 */ _t6 = _t5 & 0x00000001u;
         /* 02008C10 */ if (_t6) goto L_02008C38; else goto L_02008C14;
   L_02008C14: ; // 0x2008c14
         /* 02008C14 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02008C14 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02008C18 */ /* nop */
-        /* 02008C1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 02008C20 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02008C1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 02008C20 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02008C20 */ _t9 = _t8 & 0x00000001u;
         /* 02008C20 */ if (_t9) goto L_02008C24; else goto L_02008C38;
   L_02008C24: ; // 0x2008c24
@@ -28781,10 +28781,10 @@ void Gambit_fn_0207BBF0(CPUState* cpu) {
         /* 0207BC10 */ cpu->r[31] = 0x101D0000u;
         /* 0207BC14 */ _t3 = cpu->r[28] + 0x0000001Cu;
         /* 0207BC14 */ rbrew_write32(cpu->mem, _t3, cpu->r[4]);
-        /* 0207BC18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0207BC18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0207BC1C */ _t4 = cpu->r[28] + 0x0000000Fu;
         /* 0207BC1C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[27]);
-        /* 0207BC20 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BC20 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BC20 */ _t6 = _t5 & 0x00000001u;
         /* 0207BC20 */ if (_t6) goto L_0207BC64; else goto L_0207BC24;
   L_0207BC24: ; // 0x207bc24
@@ -28799,16 +28799,16 @@ void Gambit_fn_0207BBF0(CPUState* cpu) {
         /* 0207BC38 */ cpu->r[5] = 0x00000004u;
         /* 0207BC3C */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 0207BC40 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207BC44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0207BC44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0207BC48 */ cpu->r[0] = cpu->r[27];
-        /* 0207BC4C */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207BC4C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207BC4C */ _t11 = _t10 & 0x00000001u;
         /* 0207BC4C */ if (_t11) goto L_0207BC54; else goto L_0207BC50;
   L_0207BC50: ; // 0x207bc50
         /* 0207BC50 */ cpu->r[0] = 0x00000001u;
   L_0207BC54: ; // 0x207bc54
-        /* 0207BC54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207BC58 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BC54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207BC58 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BC58 */ _t13 = _t12 & 0x00000001u;
         /* 0207BC58 */ if (_t13) goto L_0207BC64; else goto L_0207BC5C;
   L_0207BC5C: ; // 0x207bc5c
@@ -28820,9 +28820,9 @@ void Gambit_fn_0207BBF0(CPUState* cpu) {
         /* 0207BC64 */ _t16 = cpu->r[28] + 0x00000020u;
         /* 0207BC64 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 0207BC68 */ cpu->r[0] = 0x00000000u;
-        /* 0207BC6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0207BC6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0207BC70 */ cpu->r[12] = cpu->r[0];
-        /* 0207BC74 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207BC74 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207BC74 */ _t18 = _t17 & 0x00000001u;
         /* 0207BC74 */ if (_t18) goto L_0207BC78; else goto L_0207BC9C;
   L_0207BC78: ; // 0x207bc78
@@ -28847,8 +28847,8 @@ void Gambit_fn_0207BBF0(CPUState* cpu) {
   L_0207BC9C: ; // 0x207bc9c
         /* 0207BC9C */ _t26 = cpu->r[28] + 0x0000000Fu;
         /* 0207BC9C */ cpu->r[27] = rbrew_read8(cpu->mem, _t26);
-        /* 0207BCA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0207BCA4 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BCA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0207BCA4 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BCA4 */ _t28 = _t27 & 0x00000001u;
         /* 0207BCA4 */ if (_t28) goto L_0207BCE8; else goto L_0207BCA8;
   L_0207BCA8: ; // 0x207bca8
@@ -28863,16 +28863,16 @@ void Gambit_fn_0207BBF0(CPUState* cpu) {
         /* 0207BCBC */ cpu->r[5] = 0x00000004u;
         /* 0207BCC0 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 0207BCC4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207BCC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0207BCC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0207BCCC */ cpu->r[11] = cpu->r[27];
-        /* 0207BCD0 */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207BCD0 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207BCD0 */ _t33 = _t32 & 0x00000001u;
         /* 0207BCD0 */ if (_t33) goto L_0207BCD8; else goto L_0207BCD4;
   L_0207BCD4: ; // 0x207bcd4
         /* 0207BCD4 */ cpu->r[11] = 0x00000001u;
   L_0207BCD8: ; // 0x207bcd8
-        /* 0207BCD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207BCDC */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BCD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207BCDC */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BCDC */ _t35 = _t34 & 0x00000001u;
         /* 0207BCDC */ if (_t35) goto L_0207BCE8; else goto L_0207BCE0;
   L_0207BCE0: ; // 0x207bce0
@@ -28884,9 +28884,9 @@ void Gambit_fn_0207BBF0(CPUState* cpu) {
         /* 0207BCE8 */ _t38 = cpu->r[28] + 0x00000028u;
         /* 0207BCE8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 0207BCEC */ cpu->r[0] = 0x00000000u;
-        /* 0207BCF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 0207BCF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 0207BCF4 */ cpu->r[12] = cpu->r[0];
-        /* 0207BCF8 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207BCF8 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207BCF8 */ _t40 = _t39 & 0x00000001u;
         /* 0207BCF8 */ if (_t40) goto L_0207BCFC; else goto L_0207BD20;
   L_0207BCFC: ; // 0x207bcfc
@@ -28911,8 +28911,8 @@ void Gambit_fn_0207BBF0(CPUState* cpu) {
   L_0207BD20: ; // 0x207bd20
         /* 0207BD20 */ _t48 = cpu->r[28] + 0x0000000Fu;
         /* 0207BD20 */ cpu->r[27] = rbrew_read8(cpu->mem, _t48);
-        /* 0207BD24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0207BD28 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BD24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0207BD28 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BD28 */ _t50 = _t49 & 0x00000001u;
         /* 0207BD28 */ if (_t50) goto L_0207BD6C; else goto L_0207BD2C;
   L_0207BD2C: ; // 0x207bd2c
@@ -28927,16 +28927,16 @@ void Gambit_fn_0207BBF0(CPUState* cpu) {
         /* 0207BD40 */ cpu->r[5] = 0x00000004u;
         /* 0207BD44 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 0207BD48 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207BD4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0207BD4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0207BD50 */ cpu->r[10] = cpu->r[27];
-        /* 0207BD54 */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207BD54 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207BD54 */ _t55 = _t54 & 0x00000001u;
         /* 0207BD54 */ if (_t55) goto L_0207BD5C; else goto L_0207BD58;
   L_0207BD58: ; // 0x207bd58
         /* 0207BD58 */ cpu->r[10] = 0x00000001u;
   L_0207BD5C: ; // 0x207bd5c
-        /* 0207BD5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207BD60 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BD5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207BD60 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BD60 */ _t57 = _t56 & 0x00000001u;
         /* 0207BD60 */ if (_t57) goto L_0207BD6C; else goto L_0207BD64;
   L_0207BD64: ; // 0x207bd64
@@ -28948,9 +28948,9 @@ void Gambit_fn_0207BBF0(CPUState* cpu) {
         /* 0207BD6C */ _t60 = cpu->r[28] + 0x00000030u;
         /* 0207BD6C */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
         /* 0207BD70 */ cpu->r[0] = 0x00000000u;
-        /* 0207BD74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0207BD74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0207BD78 */ cpu->r[5] = cpu->r[0];
-        /* 0207BD7C */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207BD7C */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207BD7C */ _t62 = _t61 & 0x00000001u;
         /* 0207BD7C */ if (_t62) goto L_0207BD80; else goto L_0207BDA4;
   L_0207BD80: ; // 0x207bd80
@@ -28975,8 +28975,8 @@ void Gambit_fn_0207BBF0(CPUState* cpu) {
   L_0207BDA4: ; // 0x207bda4
         /* 0207BDA4 */ _t70 = cpu->r[30] + 0x00000000u;
         /* 0207BDA4 */ cpu->r[25] = rbrew_read8(cpu->mem, _t70);
-        /* 0207BDA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 0207BDAC */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BDA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 0207BDAC */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BDAC */ _t72 = _t71 & 0x00000001u;
         /* 0207BDAC */ if (_t72) goto L_0207BE88; else goto L_0207BDB0;
   L_0207BDB0: ; // 0x207bdb0
@@ -28992,10 +28992,10 @@ void Gambit_fn_0207BBF0(CPUState* cpu) {
         /* 0207BDC8 */ cpu->r[4] = (uint32_t)((int32_t)cpu->r[25] * (int32_t)0x00000024u);
         /* 0207BDCC */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0207BDD0 */ cpu->r[24] = cpu->r[3];
-        /* 0207BDD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 0207BDD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 0207BDD8 */ cpu->r[30] = cpu->r[25];
         /* 0207BDDC */ cpu->r[7] = 0x00000000u;
-        /* 0207BDE0 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207BDE0 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207BDE0 */ _t77 = _t76 & 0x00000001u;
         /* 0207BDE0 */ if (_t77) goto L_0207BDE8; else goto L_0207BDE4;
   L_0207BDE4: ; // 0x207bde4
@@ -29008,36 +29008,36 @@ void Gambit_fn_0207BBF0(CPUState* cpu) {
         /* 0207BDF4 */ cpu->r[23] = 0x00000018u;
   L_0207BDF8: ; // 0x207bdf8
         /* 0207BDF8 */ cpu->r[27] = cpu->r[24] + cpu->r[22];
-        /* 0207BDF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0207BDFC */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BDF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0207BDFC */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BDFC */ _t80 = _t79 & 0x00000001u;
         /* 0207BDFC */ if (_t80) goto L_0207BE6C; else goto L_0207BE00;
   L_0207BE00: ; // 0x207be00
         /* 0207BE00 */ cpu->r[26] = cpu->r[27];
-        /* 0207BE00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0207BE04 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BE00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0207BE04 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BE04 */ _t82 = _t81 & 0x00000001u;
         /* 0207BE04 */ if (_t82) goto L_0207BE08; else goto L_0207BE18;
   L_0207BE08: ; // 0x207be08
         /* 0207BE08 */ cpu->r[3] = 0x00000024u;
         /* 0207BE0C */ Gambit_fn_02801A78(cpu);
         /* 0207BE10 */ cpu->r[26] = cpu->r[3];
-        /* 0207BE10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0207BE14 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BE10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0207BE14 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BE14 */ _t84 = _t83 & 0x00000001u;
         /* 0207BE14 */ if (_t84) goto L_0207BE60; else goto L_0207BE18;
   L_0207BE18: ; // 0x207be18
         /* 0207BE18 */ cpu->r[11] = cpu->r[26];
-        /* 0207BE18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0207BE1C */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BE18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0207BE1C */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BE1C */ _t86 = _t85 & 0x00000001u;
         /* 0207BE1C */ if (_t86) goto L_0207BE20; else goto L_0207BE30;
   L_0207BE20: ; // 0x207be20
         /* 0207BE20 */ cpu->r[3] = 0x0000000Cu;
         /* 0207BE24 */ Gambit_fn_02801A78(cpu);
         /* 0207BE28 */ cpu->r[11] = cpu->r[3];
-        /* 0207BE28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0207BE2C */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BE28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0207BE2C */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BE2C */ _t88 = _t87 & 0x00000001u;
         /* 0207BE2C */ if (_t88) goto L_0207BE4C; else goto L_0207BE30;
   L_0207BE30: ; // 0x207be30
@@ -29068,14 +29068,14 @@ void Gambit_fn_0207BBF0(CPUState* cpu) {
         /* 0207BE68 */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
   L_0207BE6C: ; // 0x207be6c
         /* 0207BE6C */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 0207BE6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0207BE6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0207BE70 */ cpu->r[22] = cpu->r[22] + 0x00000024u;
-        /* 0207BE74 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BE74 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BE74 */ _t98 = _t97 & 0x00000001u;
         /* 0207BE74 */ if (_t98) goto L_0207BE78; else goto L_0207BDF8;
   L_0207BE78: ; // 0x207be78
-        /* 0207BE78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 0207BE7C */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BE78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 0207BE7C */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BE7C */ _t100 = _t99 & 0x00000001u;
         /* 0207BE7C */ if (_t100) goto L_0207BE88; else goto L_0207BE80;
   L_0207BE80: ; // 0x207be80
@@ -29105,10 +29105,10 @@ void Gambit_fn_0207BEA0(CPUState* cpu) {
         /* 0207BEA4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 0207BEA8 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 0207BEA8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 0207BEAC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[12]);
+        /* 0207BEAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[12]));
         /* 0207BEB0 */ _t3 = cpu->r[4] + 0x00000000u;
         /* 0207BEB0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 0207BEB4 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207BEB4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207BEB4 */ _t5 = _t4 & 0x00000001u;
         /* 0207BEB4 */ if (_t5) goto L_0207BEB8; else goto L_0207BEC0;
   L_0207BEB8: ; // 0x207beb8
@@ -29125,10 +29125,10 @@ void Gambit_fn_0207BEA0(CPUState* cpu) {
         /* 0207BECC */ cpu->r[9] = rbrew_read8(cpu->mem, _t9);
         /* 0207BED0 */ _t10 = cpu->r[3] + 0x00000028u;
         /* 0207BED0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 0207BED4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
+        /* 0207BED4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
         /* 0207BED8 */ _t11 = cpu->r[3] + 0x0000002Cu;
         /* 0207BED8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
-        /* 0207BEDC */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207BEDC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207BEDC */ _t13 = _t12 & 0x00000001u;
         /* 0207BEDC */ if (_t13) goto L_0207BEE0; else goto L_0207BEE8;
   L_0207BEE0: ; // 0x207bee0
@@ -29149,10 +29149,10 @@ void Gambit_fn_0207BEA0(CPUState* cpu) {
         /* 0207BEFC */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
         /* 0207BF00 */ _t20 = cpu->r[3] + 0x00000034u;
         /* 0207BF00 */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 0207BF04 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
+        /* 0207BF04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
         /* 0207BF08 */ _t21 = cpu->r[6] + 0x00000000u;
         /* 0207BF08 */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
-        /* 0207BF0C */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207BF0C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207BF0C */ _t23 = _t22 & 0x00000001u;
         /* 0207BF0C */ if (_t23) goto L_0207BF10; else goto L_0207BF18;
   L_0207BF10: ; // 0x207bf10
@@ -29186,18 +29186,18 @@ void Gambit_fn_0207BF28(CPUState* cpu) {
         /* 0207BF3C */ _t4 = cpu->r[1] + 0x00000010u;
         /* 0207BF3C */ rbrew_write32(cpu->mem, _t4, cpu->r[30]);
         /* 0207BF40 */ cpu->r[31] = cpu->r[3];
-        /* 0207BF40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0207BF40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0207BF44 */ _t5 = cpu->r[1] + 0x0000001Cu;
         /* 0207BF44 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
-        /* 0207BF48 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BF48 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BF48 */ _t7 = _t6 & 0x00000001u;
         /* 0207BF48 */ if (_t7) goto L_0207BF4C; else goto L_0207BF5C;
   L_0207BF4C: ; // 0x207bf4c
         /* 0207BF4C */ cpu->r[3] = 0x00000488u;
         /* 0207BF50 */ Gambit_fn_02801A78(cpu);
         /* 0207BF54 */ cpu->r[31] = cpu->r[3];
-        /* 0207BF54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0207BF58 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BF54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0207BF58 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BF58 */ _t9 = _t8 & 0x00000001u;
         /* 0207BF58 */ if (_t9) goto L_0207C088; else goto L_0207BF5C;
   L_0207BF5C: ; // 0x207bf5c
@@ -29205,20 +29205,20 @@ void Gambit_fn_0207BF28(CPUState* cpu) {
         /* 0207BF60 */ Gambit_fn_020A50C0(cpu);
         /* 0207BF64 */ cpu->r[0] = 0x10010000u;
         /* 0207BF68 */ cpu->r[28] = cpu->r[31] + 0x00000450u;
-        /* 0207BF68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 0207BF68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 0207BF6C */ cpu->r[0] = cpu->r[0] + 0xFFFFB804u;
         /* 0207BF70 */ cpu->r[30] = 0x10110000u;
         /* 0207BF74 */ _t10 = cpu->r[31] + 0x0000044Cu;
         /* 0207BF74 */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
-        /* 0207BF78 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BF78 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BF78 */ _t12 = _t11 & 0x00000001u;
         /* 0207BF78 */ if (_t12) goto L_0207BF7C; else goto L_0207BFBC;
   L_0207BF7C: ; // 0x207bf7c
         /* 0207BF7C */ cpu->r[3] = 0x0000002Cu;
         /* 0207BF80 */ Gambit_fn_02801A78(cpu);
         /* 0207BF84 */ cpu->r[28] = cpu->r[3];
-        /* 0207BF84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 0207BF88 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BF84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 0207BF88 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BF88 */ _t14 = _t13 & 0x00000001u;
         /* 0207BF88 */ if (_t14) goto L_0207BF8C; else goto L_0207BFBC;
   L_0207BF8C: ; // 0x207bf8c
@@ -29245,16 +29245,16 @@ void Gambit_fn_0207BF28(CPUState* cpu) {
         /* 0207BFB8 */ goto L_0207C088;
   L_0207BFBC: ; // 0x207bfbc
         /* 0207BFBC */ cpu->r[29] = cpu->r[28];
-        /* 0207BFBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0207BFC0 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BFBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0207BFC0 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BFC0 */ _t25 = _t24 & 0x00000001u;
         /* 0207BFC0 */ if (_t25) goto L_0207BFC4; else goto L_0207BFE8;
   L_0207BFC4: ; // 0x207bfc4
         /* 0207BFC4 */ cpu->r[3] = 0x0000002Cu;
         /* 0207BFC8 */ Gambit_fn_02801A78(cpu);
         /* 0207BFCC */ cpu->r[29] = cpu->r[3];
-        /* 0207BFCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0207BFD0 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BFCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0207BFD0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BFD0 */ _t27 = _t26 & 0x00000001u;
         /* 0207BFD0 */ if (_t27) goto L_0207BFD4; else goto L_0207BFE8;
   L_0207BFD4: ; // 0x207bfd4
@@ -29267,15 +29267,15 @@ void Gambit_fn_0207BF28(CPUState* cpu) {
         /* 0207BFE4 */ goto L_0207C060;
   L_0207BFE8: ; // 0x207bfe8
         /* 0207BFE8 */ cpu->r[3] = cpu->r[29];
-        /* 0207BFE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207BFEC */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BFE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207BFEC */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BFEC */ _t31 = _t30 & 0x00000001u;
         /* 0207BFEC */ if (_t31) goto L_0207BFF0; else goto L_0207C01C;
   L_0207BFF0: ; // 0x207bff0
         /* 0207BFF0 */ cpu->r[3] = 0x0000000Cu;
         /* 0207BFF4 */ Gambit_fn_02801A78(cpu);
-        /* 0207BFF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207BFFC */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BFF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207BFFC */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BFFC */ _t33 = _t32 & 0x00000001u;
         /* 0207BFFC */ if (_t33) goto L_0207C000; else goto L_0207C01C;
   L_0207C000: ; // 0x207c000
@@ -29371,18 +29371,18 @@ void Gambit_fn_0207BF2C(CPUState* cpu) {
         /* 0207BF3C */ _t4 = cpu->r[1] + 0x00000010u;
         /* 0207BF3C */ rbrew_write32(cpu->mem, _t4, cpu->r[30]);
         /* 0207BF40 */ cpu->r[31] = cpu->r[3];
-        /* 0207BF40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0207BF40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0207BF44 */ _t5 = cpu->r[1] + 0x0000001Cu;
         /* 0207BF44 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
-        /* 0207BF48 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BF48 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BF48 */ _t7 = _t6 & 0x00000001u;
         /* 0207BF48 */ if (_t7) goto L_0207BF4C; else goto L_0207BF5C;
   L_0207BF4C: ; // 0x207bf4c
         /* 0207BF4C */ cpu->r[3] = 0x00000488u;
         /* 0207BF50 */ Gambit_fn_02801A78(cpu);
         /* 0207BF54 */ cpu->r[31] = cpu->r[3];
-        /* 0207BF54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0207BF58 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BF54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0207BF58 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BF58 */ _t9 = _t8 & 0x00000001u;
         /* 0207BF58 */ if (_t9) goto L_0207C088; else goto L_0207BF5C;
   L_0207BF5C: ; // 0x207bf5c
@@ -29390,20 +29390,20 @@ void Gambit_fn_0207BF2C(CPUState* cpu) {
         /* 0207BF60 */ Gambit_fn_020A50C0(cpu);
         /* 0207BF64 */ cpu->r[0] = 0x10010000u;
         /* 0207BF68 */ cpu->r[28] = cpu->r[31] + 0x00000450u;
-        /* 0207BF68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 0207BF68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 0207BF6C */ cpu->r[0] = cpu->r[0] + 0xFFFFB804u;
         /* 0207BF70 */ cpu->r[30] = 0x10110000u;
         /* 0207BF74 */ _t10 = cpu->r[31] + 0x0000044Cu;
         /* 0207BF74 */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
-        /* 0207BF78 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BF78 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BF78 */ _t12 = _t11 & 0x00000001u;
         /* 0207BF78 */ if (_t12) goto L_0207BF7C; else goto L_0207BFBC;
   L_0207BF7C: ; // 0x207bf7c
         /* 0207BF7C */ cpu->r[3] = 0x0000002Cu;
         /* 0207BF80 */ Gambit_fn_02801A78(cpu);
         /* 0207BF84 */ cpu->r[28] = cpu->r[3];
-        /* 0207BF84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 0207BF88 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BF84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 0207BF88 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BF88 */ _t14 = _t13 & 0x00000001u;
         /* 0207BF88 */ if (_t14) goto L_0207BF8C; else goto L_0207BFBC;
   L_0207BF8C: ; // 0x207bf8c
@@ -29430,16 +29430,16 @@ void Gambit_fn_0207BF2C(CPUState* cpu) {
         /* 0207BFB8 */ goto L_0207C088;
   L_0207BFBC: ; // 0x207bfbc
         /* 0207BFBC */ cpu->r[29] = cpu->r[28];
-        /* 0207BFBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0207BFC0 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BFBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0207BFC0 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BFC0 */ _t25 = _t24 & 0x00000001u;
         /* 0207BFC0 */ if (_t25) goto L_0207BFC4; else goto L_0207BFE8;
   L_0207BFC4: ; // 0x207bfc4
         /* 0207BFC4 */ cpu->r[3] = 0x0000002Cu;
         /* 0207BFC8 */ Gambit_fn_02801A78(cpu);
         /* 0207BFCC */ cpu->r[29] = cpu->r[3];
-        /* 0207BFCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0207BFD0 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BFCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0207BFD0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BFD0 */ _t27 = _t26 & 0x00000001u;
         /* 0207BFD0 */ if (_t27) goto L_0207BFD4; else goto L_0207BFE8;
   L_0207BFD4: ; // 0x207bfd4
@@ -29452,15 +29452,15 @@ void Gambit_fn_0207BF2C(CPUState* cpu) {
         /* 0207BFE4 */ goto L_0207C060;
   L_0207BFE8: ; // 0x207bfe8
         /* 0207BFE8 */ cpu->r[3] = cpu->r[29];
-        /* 0207BFE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207BFEC */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BFE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207BFEC */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BFEC */ _t31 = _t30 & 0x00000001u;
         /* 0207BFEC */ if (_t31) goto L_0207BFF0; else goto L_0207C01C;
   L_0207BFF0: ; // 0x207bff0
         /* 0207BFF0 */ cpu->r[3] = 0x0000000Cu;
         /* 0207BFF4 */ Gambit_fn_02801A78(cpu);
-        /* 0207BFF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207BFFC */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207BFF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207BFFC */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207BFFC */ _t33 = _t32 & 0x00000001u;
         /* 0207BFFC */ if (_t33) goto L_0207C000; else goto L_0207C01C;
   L_0207C000: ; // 0x207c000
@@ -29571,23 +29571,23 @@ void Gambit_fn_0207C0AC(CPUState* cpu) {
         /* 0207C0EC */ _t7 = cpu->r[12] + 0x00000000u;
         /* 0207C0EC */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0207C0F0 */ cpu->r[30] = 0x00000000u;
-        /* 0207C0F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 0207C0F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 0207C0F8 */ cpu->r[0] = 0x00080000u;
-        /* 0207C0FC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C0FC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C0FC */ _t9 = _t8 & 0x00000001u;
         /* 0207C0FC */ if (_t9) goto L_0207C124; else goto L_0207C100;
   L_0207C100: ; // 0x207c100
         /* 0207C100 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0207C104 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 0207C104 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 0207C108 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 0207C10C */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207C10C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207C10C */ _t11 = _t10 & 0x00000001u;
         /* 0207C10C */ if (_t11) goto L_0207C120; else goto L_0207C110;
   L_0207C110: ; // 0x207c110
         /* 0207C110 */ _t12 = cpu->r[12] + 0x00000000u;
         /* 0207C110 */ cpu->r[10] = rbrew_read8(cpu->mem, _t12);
-        /* 0207C114 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[31]);
-        /* 0207C118 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C114 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[31]));
+        /* 0207C118 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C118 */ _t14 = _t13 & 0x00000001u;
         /* 0207C118 */ if (_t14) goto L_0207C11C; else goto L_0207C100;
   L_0207C11C: ; // 0x207c11c
@@ -29599,10 +29599,10 @@ void Gambit_fn_0207C0AC(CPUState* cpu) {
         /* 0207C124 */ cpu->r[7] = rbrew_read32(cpu->mem, _t15);
         /* 0207C128 */ _t16 = cpu->r[29] + 0x00000454u;
         /* 0207C128 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
-        /* 0207C12C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 0207C12C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 0207C130 */ _t17 = cpu->r[11] + 0x00000014u;
         /* 0207C130 */ cpu->r[5] = rbrew_read32(cpu->mem, _t17);
-        /* 0207C134 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207C134 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207C134 */ _t19 = _t18 & 0x00000001u;
         /* 0207C134 */ if (_t19) goto L_0207C13C; else goto L_0207C138;
   L_0207C138: ; // 0x207c138
@@ -29660,29 +29660,29 @@ void Gambit_fn_0207C1A4(CPUState* cpu) {
         /* 0207C1A4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 0207C1A8 */ _t1 = cpu->r[12] + 0x00000002u;
         /* 0207C1A8 */ cpu->r[10] = rbrew_read8(cpu->mem, _t1);
-        /* 0207C1AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0207C1AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0207C1B0 */ cpu->r[0] = 0x00000001u;
-        /* 0207C1B4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C1B4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C1B4 */ _t3 = _t2 & 0x00000001u;
         /* 0207C1B4 */ if (_t3) goto L_0207C1C4; else goto L_0207C1B8;
   L_0207C1B8: ; // 0x207c1b8
-        /* 0207C1B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000001u);
-        /* 0207C1BC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C1B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000001u));
+        /* 0207C1BC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C1BC */ _t5 = _t4 & 0x00000001u;
         /* 0207C1BC */ if (_t5) goto L_0207C1C4; else goto L_0207C1C0;
   L_0207C1C0: ; // 0x207c1c0
         /* 0207C1C0 */ cpu->r[0] = 0x00000000u;
   L_0207C1C4: ; // 0x207c1c4
-        /* 0207C1C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0207C1C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0207C1C8 */ cpu->r[12] = 0x00000001u;
         /* 0207C1CC */ _t6 = cpu->r[3] + 0x00000482u;
         /* 0207C1CC */ rbrew_write8(cpu->mem, _t6, (uint8_t)cpu->r[0]);
-        /* 0207C1D0 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C1D0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C1D0 */ _t8 = _t7 & 0x00000001u;
         /* 0207C1D0 */ if (_t8) goto L_0207C1E0; else goto L_0207C1D4;
   L_0207C1D4: ; // 0x207c1d4
-        /* 0207C1D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
-        /* 0207C1D8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C1D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
+        /* 0207C1D8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C1D8 */ _t10 = _t9 & 0x00000001u;
         /* 0207C1D8 */ if (_t10) goto L_0207C1E0; else goto L_0207C1DC;
   L_0207C1DC: ; // 0x207c1dc
@@ -29724,23 +29724,23 @@ void Gambit_fn_0207C1E8(CPUState* cpu) {
         /* 0207C224 */ _t7 = cpu->r[11] + 0x00000000u;
         /* 0207C224 */ cpu->r[12] = rbrew_read8(cpu->mem, _t7);
         /* 0207C228 */ cpu->r[30] = 0x00000000u;
-        /* 0207C22C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[31]);
+        /* 0207C22C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[31]));
         /* 0207C230 */ cpu->r[7] = 0x00080000u;
-        /* 0207C234 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C234 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C234 */ _t9 = _t8 & 0x00000001u;
         /* 0207C234 */ if (_t9) goto L_0207C25C; else goto L_0207C238;
   L_0207C238: ; // 0x207c238
         /* 0207C238 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0207C23C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 0207C23C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 0207C240 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 0207C244 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207C244 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207C244 */ _t11 = _t10 & 0x00000001u;
         /* 0207C244 */ if (_t11) goto L_0207C258; else goto L_0207C248;
   L_0207C248: ; // 0x207c248
         /* 0207C248 */ _t12 = cpu->r[11] + 0x00000000u;
         /* 0207C248 */ cpu->r[0] = rbrew_read8(cpu->mem, _t12);
-        /* 0207C24C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 0207C250 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C24C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 0207C250 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C250 */ _t14 = _t13 & 0x00000001u;
         /* 0207C250 */ if (_t14) goto L_0207C254; else goto L_0207C238;
   L_0207C254: ; // 0x207c254
@@ -29752,10 +29752,10 @@ void Gambit_fn_0207C1E8(CPUState* cpu) {
         /* 0207C25C */ cpu->r[9] = rbrew_read32(cpu->mem, _t15);
         /* 0207C260 */ _t16 = cpu->r[28] + 0x00000004u;
         /* 0207C260 */ cpu->r[6] = rbrew_read32(cpu->mem, _t16);
-        /* 0207C264 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[9]);
+        /* 0207C264 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[9]));
         /* 0207C268 */ _t17 = cpu->r[6] + 0x00000014u;
         /* 0207C268 */ cpu->r[7] = rbrew_read32(cpu->mem, _t17);
-        /* 0207C26C */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207C26C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207C26C */ _t19 = _t18 & 0x00000001u;
         /* 0207C26C */ if (_t19) goto L_0207C274; else goto L_0207C270;
   L_0207C270: ; // 0x207c270
@@ -29803,7 +29803,7 @@ void Gambit_fn_0207C1E8(CPUState* cpu) {
         /* 0207C2E4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t30);
         /* 0207C2E8 */ cpu->r[3] = cpu->r[1] + 0x00000010u;
         /* 0207C2EC */ cpu->r[4] = cpu->r[4] + 0xFFFFB824u;
-        /* 0207C2F0 */ _t31 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0207C2F0 */ _t31 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0207C2F0 */ _t32 = _t31 & 0x00000001u;
         /* 0207C2F0 */ if (_t32) goto L_0207C2F4; // else: addr-0 trap, fall-through
   L_0207C2F4: ; // 0x207c2f4
@@ -29821,8 +29821,8 @@ void Gambit_fn_0207C1E8(CPUState* cpu) {
         /* 0207C314 */ Gambit_fn_020A54C4(cpu);
         /* 0207C318 */ _t36 = cpu->r[29] + 0x00000000u;
         /* 0207C318 */ cpu->r[6] = rbrew_read8(cpu->mem, _t36);
-        /* 0207C31C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0207C320 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C31C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0207C320 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C320 */ _t38 = _t37 & 0x00000001u;
         /* 0207C320 */ if (_t38) goto L_0207C334; else goto L_0207C324;
   L_0207C324: ; // 0x207c324
@@ -29899,7 +29899,7 @@ void Gambit_fn_0207C348(CPUState* cpu) {
         /* 0207C3CC */ cpu->r[3] = cpu->r[1] + 0x00000008u;
         /* 0207C3D0 */ cpu->r[4] = cpu->r[4] + 0xFFFFB82Cu;
         /* 0207C3D4 */ cpu->r[5] = cpu->r[31];
-        /* 0207C3D8 */ _t17 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0207C3D8 */ _t17 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0207C3D8 */ _t18 = _t17 & 0x00000001u;
         /* 0207C3D8 */ if (_t18) goto L_0207C3DC; // else: addr-0 trap, fall-through
   L_0207C3DC: ; // 0x207c3dc
@@ -29980,7 +29980,7 @@ void Gambit_fn_0207C34C(CPUState* cpu) {
         /* 0207C3CC */ cpu->r[3] = cpu->r[1] + 0x00000008u;
         /* 0207C3D0 */ cpu->r[4] = cpu->r[4] + 0xFFFFB82Cu;
         /* 0207C3D4 */ cpu->r[5] = cpu->r[31];
-        /* 0207C3D8 */ _t17 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0207C3D8 */ _t17 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0207C3D8 */ _t18 = _t17 & 0x00000001u;
         /* 0207C3D8 */ if (_t18) goto L_0207C3DC; // else: addr-0 trap, fall-through
   L_0207C3DC: ; // 0x207c3dc
@@ -30037,8 +30037,8 @@ void Gambit_fn_0207C428(CPUState* cpu) {
         /* 0207C42C */ _t1 = cpu->r[12] + 0x00000004u;
         /* 0207C42C */ cpu->r[0] = rbrew_read8(cpu->mem, _t1);
         /* 0207C430 */ cpu->r[3] = 0x00000000u;
-        /* 0207C434 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 0207C438 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C434 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 0207C438 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C438 */ _t3 = _t2 & 0x00000001u;
         /* 0207C438 */ _t4 = _t3 ^ 0x00000001u;
         /* 0207C438 */ if (_t4) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -30053,15 +30053,15 @@ void Gambit_fn_0207C444(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0207C444: ; // 0x207c444
-        /* 0207C444 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207C448 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C444 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207C448 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C448 */ _t1 = _t0 & 0x00000001u;
         /* 0207C448 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207C448 */ goto L_0207C44C;
   L_0207C44C: ; // 0x207c44c
         /* 0207C44C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0207C44C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207C450 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C44C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207C450 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C450 */ _t3 = _t2 & 0x00000001u;
         /* 0207C450 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207C450 */ goto L_0207C454;
@@ -30080,8 +30080,8 @@ void Gambit_fn_0207C444(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -30095,15 +30095,15 @@ void Gambit_fn_0207C444(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -30137,15 +30137,15 @@ void Gambit_fn_0207C45C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0207C45C: ; // 0x207c45c
-        /* 0207C45C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207C460 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C45C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207C460 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C460 */ _t1 = _t0 & 0x00000001u;
         /* 0207C460 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207C460 */ goto L_0207C464;
   L_0207C464: ; // 0x207c464
         /* 0207C464 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0207C464 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207C468 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207C468 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C468 */ _t3 = _t2 & 0x00000001u;
         /* 0207C468 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207C468 */ goto L_0207C46C;
@@ -30164,8 +30164,8 @@ void Gambit_fn_0207C45C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -30179,15 +30179,15 @@ void Gambit_fn_0207C45C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -30233,15 +30233,15 @@ void Gambit_fn_0207C48C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0207C48C: ; // 0x207c48c
-        /* 0207C48C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207C490 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C48C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207C490 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C490 */ _t1 = _t0 & 0x00000001u;
         /* 0207C490 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207C490 */ goto L_0207C494;
   L_0207C494: ; // 0x207c494
         /* 0207C494 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0207C494 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207C498 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C494 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207C498 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C498 */ _t3 = _t2 & 0x00000001u;
         /* 0207C498 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207C498 */ goto L_0207C49C;
@@ -30260,8 +30260,8 @@ void Gambit_fn_0207C48C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -30275,15 +30275,15 @@ void Gambit_fn_0207C48C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -30311,15 +30311,15 @@ void Gambit_fn_0207C4A0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0207C4A0: ; // 0x207c4a0
-        /* 0207C4A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207C4A4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C4A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207C4A4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C4A4 */ _t1 = _t0 & 0x00000001u;
         /* 0207C4A4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207C4A4 */ goto L_0207C4A8;
   L_0207C4A8: ; // 0x207c4a8
         /* 0207C4A8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0207C4A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207C4AC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C4A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207C4AC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C4AC */ _t3 = _t2 & 0x00000001u;
         /* 0207C4AC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207C4AC */ goto L_0207C4B0;
@@ -30338,8 +30338,8 @@ void Gambit_fn_0207C4A0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -30353,15 +30353,15 @@ void Gambit_fn_0207C4A0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -30389,15 +30389,15 @@ void Gambit_fn_0207C4B4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0207C4B4: ; // 0x207c4b4
-        /* 0207C4B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207C4B8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C4B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207C4B8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C4B8 */ _t1 = _t0 & 0x00000001u;
         /* 0207C4B8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207C4B8 */ goto L_0207C4BC;
   L_0207C4BC: ; // 0x207c4bc
         /* 0207C4BC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0207C4BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207C4C0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C4BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207C4C0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C4C0 */ _t3 = _t2 & 0x00000001u;
         /* 0207C4C0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207C4C0 */ goto L_0207C4C4;
@@ -30416,8 +30416,8 @@ void Gambit_fn_0207C4B4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -30431,15 +30431,15 @@ void Gambit_fn_0207C4B4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -30467,15 +30467,15 @@ void Gambit_fn_0207C4C8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0207C4C8: ; // 0x207c4c8
-        /* 0207C4C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207C4CC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C4C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207C4CC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C4CC */ _t1 = _t0 & 0x00000001u;
         /* 0207C4CC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207C4CC */ goto L_0207C4D0;
   L_0207C4D0: ; // 0x207c4d0
         /* 0207C4D0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0207C4D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207C4D4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C4D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207C4D4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C4D4 */ _t3 = _t2 & 0x00000001u;
         /* 0207C4D4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0207C4D4 */ goto L_0207C4D8;
@@ -30494,8 +30494,8 @@ void Gambit_fn_0207C4C8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -30509,15 +30509,15 @@ void Gambit_fn_0207C4C8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -30839,18 +30839,18 @@ void Gambit_fn_0207C5C8(CPUState* cpu) {
         /* 02008E80 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02008E80 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02008E84 */ cpu->r[12] = 0x00000000u;
-        /* 02008E88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02008E88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02008E8C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 02008E8C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02008E90 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02008E90 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02008E90 */ _t6 = _t5 & 0x00000001u;
         /* 02008E90 */ if (_t6) goto L_02008EB8; else goto L_02008E94;
   L_02008E94: ; // 0x2008e94
         /* 02008E94 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02008E94 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02008E98 */ /* nop */
-        /* 02008E9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 02008EA0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02008E9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 02008EA0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02008EA0 */ _t9 = _t8 & 0x00000001u;
         /* 02008EA0 */ if (_t9) goto L_02008EA4; else goto L_02008EB8;
   L_02008EA4: ; // 0x2008ea4
@@ -30961,17 +30961,17 @@ void Gambit_fn_0207C600(CPUState* cpu) {
         /* 0207C60C */ _t1 = cpu->r[1] + 0x00000054u;
         /* 0207C60C */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 0207C610 */ cpu->r[29] = cpu->r[3];
-        /* 0207C610 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0207C610 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0207C614 */ cpu->r[30] = cpu->r[4];
-        /* 0207C618 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C618 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C618 */ _t3 = _t2 & 0x00000001u;
         /* 0207C618 */ if (_t3) goto L_0207C61C; else goto L_0207C62C;
   L_0207C61C: ; // 0x207c61c
         /* 0207C61C */ cpu->r[3] = 0x0000008Cu;
         /* 0207C620 */ Gambit_fn_02801A78(cpu);
         /* 0207C624 */ cpu->r[29] = cpu->r[3];
-        /* 0207C624 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0207C628 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C624 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0207C628 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C628 */ _t5 = _t4 & 0x00000001u;
         /* 0207C628 */ if (_t5) goto L_0207C988; else goto L_0207C62C;
   L_0207C62C: ; // 0x207c62c
@@ -30989,21 +30989,21 @@ void Gambit_fn_0207C600(CPUState* cpu) {
         /* 0207C654 */ rbrew_write32(cpu->mem, _t6, cpu->r[8]);
         /* 0207C658 */ cpu->r[10] = cpu->r[10] + 0xFFFFB960u;
         /* 0207C65C */ cpu->r[31] = cpu->r[29] + 0x00000028u;
-        /* 0207C65C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0207C65C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0207C660 */ _t7 = cpu->r[29] + 0x0000000Cu;
         /* 0207C660 */ rbrew_write32(cpu->mem, _t7, cpu->r[9]);
         /* 0207C664 */ cpu->r[28] = 0x00000000u;
         /* 0207C668 */ _t8 = cpu->r[29] + 0x00000010u;
         /* 0207C668 */ rbrew_write32(cpu->mem, _t8, cpu->r[10]);
-        /* 0207C66C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C66C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C66C */ _t10 = _t9 & 0x00000001u;
         /* 0207C66C */ if (_t10) goto L_0207C670; else goto L_0207C680;
   L_0207C670: ; // 0x207c670
         /* 0207C670 */ cpu->r[3] = 0x00000038u;
         /* 0207C674 */ Gambit_fn_02801A78(cpu);
         /* 0207C678 */ cpu->r[31] = cpu->r[3];
-        /* 0207C678 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0207C67C */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C678 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0207C67C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C67C */ _t12 = _t11 & 0x00000001u;
         /* 0207C67C */ if (_t12) goto L_0207C6B0; else goto L_0207C680;
   L_0207C680: ; // 0x207c680
@@ -31029,15 +31029,15 @@ void Gambit_fn_0207C600(CPUState* cpu) {
         /* 0207C6AC */ rbrew_write32(cpu->mem, _t20, cpu->r[28]);
   L_0207C6B0: ; // 0x207c6b0
         /* 0207C6B0 */ cpu->r[3] = cpu->r[29] + 0x00000060u;
-        /* 0207C6B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207C6B4 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C6B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207C6B4 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C6B4 */ _t22 = _t21 & 0x00000001u;
         /* 0207C6B4 */ if (_t22) goto L_0207C6B8; else goto L_0207C6C8;
   L_0207C6B8: ; // 0x207c6b8
         /* 0207C6B8 */ cpu->r[3] = 0x00000010u;
         /* 0207C6BC */ Gambit_fn_02801A78(cpu);
-        /* 0207C6C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207C6C4 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C6C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207C6C4 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C6C4 */ _t24 = _t23 & 0x00000001u;
         /* 0207C6C4 */ if (_t24) goto L_0207C6EC; else goto L_0207C6C8;
   L_0207C6C8: ; // 0x207c6c8
@@ -31059,29 +31059,29 @@ void Gambit_fn_0207C600(CPUState* cpu) {
         /* 0207C6E8 */ rbrew_write32(cpu->mem, _t31, cpu->r[6]);
   L_0207C6EC: ; // 0x207c6ec
         /* 0207C6EC */ cpu->r[3] = cpu->r[29] + 0x00000074u;
-        /* 0207C6EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0207C6EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0207C6F0 */ _t32 = cpu->r[29] + 0x00000070u;
         /* 0207C6F0 */ rbrew_write32(cpu->mem, _t32, cpu->r[28]);
-        /* 0207C6F4 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C6F4 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C6F4 */ _t34 = _t33 & 0x00000001u;
         /* 0207C6F4 */ if (_t34) goto L_0207C6F8; else goto L_0207C708;
   L_0207C6F8: ; // 0x207c6f8
         /* 0207C6F8 */ cpu->r[3] = 0x0000000Cu;
         /* 0207C6FC */ Gambit_fn_02801A78(cpu);
-        /* 0207C700 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207C704 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207C704 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C704 */ _t36 = _t35 & 0x00000001u;
         /* 0207C704 */ if (_t36) goto L_0207C72C; else goto L_0207C708;
   L_0207C708: ; // 0x207c708
-        /* 0207C708 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207C70C */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C708 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207C70C */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C70C */ _t38 = _t37 & 0x00000001u;
         /* 0207C70C */ if (_t38) goto L_0207C710; else goto L_0207C720;
   L_0207C710: ; // 0x207c710
         /* 0207C710 */ cpu->r[3] = 0x0000000Cu;
         /* 0207C714 */ Gambit_fn_02801A78(cpu);
-        /* 0207C718 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207C71C */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C718 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207C71C */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C71C */ _t40 = _t39 & 0x00000001u;
         /* 0207C71C */ if (_t40) goto L_0207C72C; else goto L_0207C720;
   L_0207C720: ; // 0x207c720
@@ -31108,8 +31108,8 @@ void Gambit_fn_0207C600(CPUState* cpu) {
         /* 0207C754 */ _t47 = cpu->r[29] + 0x00000074u;
         /* 0207C754 */ rbrew_write32(cpu->mem, _t47, cpu->r[28]);
         /* 0207C758 */ Gambit_fn_02801A78(cpu);
-        /* 0207C75C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207C760 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C75C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207C760 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C760 */ _t49 = _t48 & 0x00000001u;
         /* 0207C760 */ if (_t49) goto L_0207C768; else goto L_0207C764;
   L_0207C764: ; // 0x207c764
@@ -31150,23 +31150,23 @@ void Gambit_fn_0207C600(CPUState* cpu) {
         /* 0207C7C8 */ _t58 = cpu->r[8] + 0x00000000u;
         /* 0207C7C8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t58);
         /* 0207C7CC */ cpu->r[30] = 0x00000000u;
-        /* 0207C7D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 0207C7D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 0207C7D4 */ cpu->r[0] = 0x00080000u;
-        /* 0207C7D8 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C7D8 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C7D8 */ _t60 = _t59 & 0x00000001u;
         /* 0207C7D8 */ if (_t60) goto L_0207C800; else goto L_0207C7DC;
   L_0207C7DC: ; // 0x207c7dc
         /* 0207C7DC */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0207C7E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 0207C7E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 0207C7E4 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 0207C7E8 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207C7E8 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207C7E8 */ _t62 = _t61 & 0x00000001u;
         /* 0207C7E8 */ if (_t62) goto L_0207C7FC; else goto L_0207C7EC;
   L_0207C7EC: ; // 0x207c7ec
         /* 0207C7EC */ _t63 = cpu->r[8] + 0x00000000u;
         /* 0207C7EC */ cpu->r[10] = rbrew_read8(cpu->mem, _t63);
-        /* 0207C7F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[31]);
-        /* 0207C7F4 */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C7F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[31]));
+        /* 0207C7F4 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C7F4 */ _t65 = _t64 & 0x00000001u;
         /* 0207C7F4 */ if (_t65) goto L_0207C7F8; else goto L_0207C7DC;
   L_0207C7F8: ; // 0x207c7f8
@@ -31178,10 +31178,10 @@ void Gambit_fn_0207C600(CPUState* cpu) {
         /* 0207C800 */ cpu->r[6] = rbrew_read32(cpu->mem, _t66);
         /* 0207C804 */ _t67 = cpu->r[1] + 0x00000010u;
         /* 0207C804 */ cpu->r[11] = rbrew_read32(cpu->mem, _t67);
-        /* 0207C808 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[6]);
+        /* 0207C808 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[6]));
         /* 0207C80C */ _t68 = cpu->r[11] + 0x00000014u;
         /* 0207C80C */ cpu->r[12] = rbrew_read32(cpu->mem, _t68);
-        /* 0207C810 */ _t69 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207C810 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207C810 */ _t70 = _t69 & 0x00000001u;
         /* 0207C810 */ if (_t70) goto L_0207C818; else goto L_0207C814;
   L_0207C814: ; // 0x207c814
@@ -31236,10 +31236,10 @@ void Gambit_fn_0207C600(CPUState* cpu) {
         /* 0207C898 */ rbrew_write32(cpu->mem, _t84, cpu->r[5]);
         /* 0207C89C */ _t85 = cpu->r[29] + 0x0000003Cu;
         /* 0207C89C */ cpu->r[7] = rbrew_read32(cpu->mem, _t85);
-        /* 0207C8A0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x00000001u);
+        /* 0207C8A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x00000001u));
         /* 0207C8A4 */ _t86 = cpu->r[29] + 0x00000040u;
         /* 0207C8A4 */ cpu->r[27] = rbrew_read32(cpu->mem, _t86);
-        /* 0207C8A8 */ _t87 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207C8A8 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207C8A8 */ _t88 = _t87 & 0x00000001u;
         /* 0207C8A8 */ if (_t88) goto L_0207C8AC; else goto L_0207C8B0;
   L_0207C8AC: ; // 0x207c8ac
@@ -31255,23 +31255,23 @@ void Gambit_fn_0207C600(CPUState* cpu) {
         /* 0207C8C4 */ _t91 = cpu->r[6] + 0x00000000u;
         /* 0207C8C4 */ cpu->r[8] = rbrew_read8(cpu->mem, _t91);
         /* 0207C8C8 */ cpu->r[30] = 0x00000000u;
-        /* 0207C8CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[31]);
+        /* 0207C8CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[31]));
         /* 0207C8D0 */ cpu->r[7] = 0x00080000u;
-        /* 0207C8D4 */ _t92 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C8D4 */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C8D4 */ _t93 = _t92 & 0x00000001u;
         /* 0207C8D4 */ if (_t93) goto L_0207C8FC; else goto L_0207C8D8;
   L_0207C8D8: ; // 0x207c8d8
         /* 0207C8D8 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0207C8DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 0207C8DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 0207C8E0 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 0207C8E4 */ _t94 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207C8E4 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207C8E4 */ _t95 = _t94 & 0x00000001u;
         /* 0207C8E4 */ if (_t95) goto L_0207C8F8; else goto L_0207C8E8;
   L_0207C8E8: ; // 0x207c8e8
         /* 0207C8E8 */ _t96 = cpu->r[6] + 0x00000000u;
         /* 0207C8E8 */ cpu->r[9] = rbrew_read8(cpu->mem, _t96);
-        /* 0207C8EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[31]);
-        /* 0207C8F0 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207C8EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[31]));
+        /* 0207C8F0 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207C8F0 */ _t98 = _t97 & 0x00000001u;
         /* 0207C8F0 */ if (_t98) goto L_0207C8F4; else goto L_0207C8D8;
   L_0207C8F4: ; // 0x207c8f4
@@ -31283,10 +31283,10 @@ void Gambit_fn_0207C600(CPUState* cpu) {
         /* 0207C8FC */ cpu->r[7] = rbrew_read32(cpu->mem, _t99);
         /* 0207C900 */ _t100 = cpu->r[1] + 0x00000010u;
         /* 0207C900 */ cpu->r[10] = rbrew_read32(cpu->mem, _t100);
-        /* 0207C904 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 0207C904 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 0207C908 */ _t101 = cpu->r[10] + 0x00000014u;
         /* 0207C908 */ cpu->r[0] = rbrew_read32(cpu->mem, _t101);
-        /* 0207C90C */ _t102 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207C90C */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207C90C */ _t103 = _t102 & 0x00000001u;
         /* 0207C90C */ if (_t103) goto L_0207C914; else goto L_0207C910;
   L_0207C910: ; // 0x207c910
@@ -31465,8 +31465,8 @@ void Gambit_fn_0207CA1C(CPUState* cpu) {
         /* 0207A59C */ cpu->ctr = cpu->r[12];
         /* 0207A5A0 */ cpu->r[31] = cpu->r[3];
         /* 0207A5A4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207A5A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207A5AC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A5A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207A5AC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A5AC */ _t6 = _t5 & 0x00000001u;
         /* 0207A5AC */ if (_t6) goto L_0207A5C8; else goto L_0207A5B0;
   L_0207A5B0: ; // 0x207a5b0
@@ -31482,16 +31482,16 @@ void Gambit_fn_0207CA1C(CPUState* cpu) {
         /* 0207A5C8 */ _t9 = cpu->r[31] + 0x000001E8u;
         /* 0207A5C8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t9);
         /* 0207A5CC */ /* nop */
-        /* 0207A5D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
+        /* 0207A5D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
         /* 0207A5D4 */ cpu->r[11] = 0x00000000u;
-        /* 0207A5D8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A5D8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A5D8 */ _t11 = _t10 & 0x00000001u;
         /* 0207A5D8 */ if (_t11) goto L_0207A5DC; else goto L_0207A5EC;
   L_0207A5DC: ; // 0x207a5dc
         /* 0207A5DC */ _t12 = cpu->r[31] + 0x000001E4u;
         /* 0207A5DC */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0207A5E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207A5E4 */ _t13 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207A5E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207A5E4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207A5E4 */ _t14 = _t13 & 0x00000001u;
         /* 0207A5E4 */ if (_t14) goto L_0207A5E8; else goto L_0207A5EC;
   L_0207A5E8: ; // 0x207a5e8
@@ -31529,8 +31529,8 @@ void Gambit_fn_0207CA24(CPUState* cpu) {
         /* 0207CA3C */ _t3 = cpu->r[3] + 0x00003400u;
         /* 0207CA3C */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0207CA40 */ Gambit_fn_0206C030(cpu);
-        /* 0207CA44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207CA48 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207CA44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207CA48 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207CA48 */ _t5 = _t4 & 0x00000001u;
         /* 0207CA48 */ if (_t5) goto L_0207CA54; else goto L_0207CA4C;
   L_0207CA4C: ; // 0x207ca4c
@@ -31566,8 +31566,8 @@ void Gambit_fn_0207CA28(CPUState* cpu) {
         /* 0207CA3C */ _t3 = cpu->r[3] + 0x00003400u;
         /* 0207CA3C */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0207CA40 */ Gambit_fn_0206C030(cpu);
-        /* 0207CA44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207CA48 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207CA44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207CA48 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207CA48 */ _t5 = _t4 & 0x00000001u;
         /* 0207CA48 */ if (_t5) goto L_0207CA54; else goto L_0207CA4C;
   L_0207CA4C: ; // 0x207ca4c
@@ -31690,8 +31690,8 @@ void Gambit_fn_0207CAE0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13;
 
   L_0207A690: ; // 0x207a690
-        /* 0207A690 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000001u);
-        /* 0207A694 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A690 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000001u));
+        /* 0207A694 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A694 */ _t1 = _t0 & 0x00000001u;
         /* 0207A694 */ if (_t1) goto L_0207A698; else goto L_0207A6A8;
   L_0207A698: ; // 0x207a698
@@ -31702,8 +31702,8 @@ void Gambit_fn_0207CAE0(CPUState* cpu) {
         /* 0207A6A0 */ rbrew_write8(cpu->mem, _t3, (uint8_t)cpu->r[0]);
         /* 0207A6A4 */ return;
   L_0207A6A8: ; // 0x207a6a8
-        /* 0207A6A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000002u);
-        /* 0207A6AC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A6A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000002u));
+        /* 0207A6AC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A6AC */ _t5 = _t4 & 0x00000001u;
         /* 0207A6AC */ if (_t5) goto L_0207A6B0; else goto L_0207A6C0;
   L_0207A6B0: ; // 0x207a6b0
@@ -31714,8 +31714,8 @@ void Gambit_fn_0207CAE0(CPUState* cpu) {
         /* 0207A6B8 */ rbrew_write8(cpu->mem, _t7, (uint8_t)cpu->r[0]);
         /* 0207A6BC */ return;
   L_0207A6C0: ; // 0x207a6c0
-        /* 0207A6C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000003u);
-        /* 0207A6C4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207A6C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000003u));
+        /* 0207A6C4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207A6C4 */ _t9 = _t8 & 0x00000001u;
         /* 0207A6C4 */ _t10 = _t9 ^ 0x00000001u;
         /* 0207A6C4 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -31750,16 +31750,16 @@ void Gambit_fn_0207CAE8(CPUState* cpu) {
         /* 0207CAFC */ _t3 = cpu->r[31] + 0x00000080u;
         /* 0207CAFC */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0207CB00 */ Gambit_fn_0207C410(cpu);
-        /* 0207CB04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000003u);
-        /* 0207CB08 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207CB04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000003u));
+        /* 0207CB08 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207CB08 */ _t5 = _t4 & 0x00000001u;
         /* 0207CB08 */ if (_t5) goto L_0207CB30; else goto L_0207CB0C;
   L_0207CB0C: ; // 0x207cb0c
         /* 0207CB0C */ _t6 = cpu->r[31] + 0x00000070u;
         /* 0207CB0C */ cpu->r[3] = rbrew_read32(cpu->mem, _t6);
         /* 0207CB10 */ Gambit_fn_0207A6D8(cpu);
-        /* 0207CB14 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000003u);
-        /* 0207CB18 */ _t7 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207CB14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000003u));
+        /* 0207CB18 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207CB18 */ _t8 = _t7 & 0x00000001u;
         /* 0207CB18 */ if (_t8) goto L_0207CB1C; else goto L_0207CB3C;
   L_0207CB1C: ; // 0x207cb1c
@@ -31807,16 +31807,16 @@ void Gambit_fn_0207CAEC(CPUState* cpu) {
         /* 0207CAFC */ _t3 = cpu->r[31] + 0x00000080u;
         /* 0207CAFC */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0207CB00 */ Gambit_fn_0207C410(cpu);
-        /* 0207CB04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000003u);
-        /* 0207CB08 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207CB04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000003u));
+        /* 0207CB08 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207CB08 */ _t5 = _t4 & 0x00000001u;
         /* 0207CB08 */ if (_t5) goto L_0207CB30; else goto L_0207CB0C;
   L_0207CB0C: ; // 0x207cb0c
         /* 0207CB0C */ _t6 = cpu->r[31] + 0x00000070u;
         /* 0207CB0C */ cpu->r[3] = rbrew_read32(cpu->mem, _t6);
         /* 0207CB10 */ Gambit_fn_0207A6D8(cpu);
-        /* 0207CB14 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000003u);
-        /* 0207CB18 */ _t7 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0207CB14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000003u));
+        /* 0207CB18 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0207CB18 */ _t8 = _t7 & 0x00000001u;
         /* 0207CB18 */ if (_t8) goto L_0207CB1C; else goto L_0207CB3C;
   L_0207CB1C: ; // 0x207cb1c
@@ -31869,9 +31869,9 @@ void Gambit_fn_0207CB60(CPUState* cpu) {
         /* 0207CB78 */ cpu->r[29] = cpu->r[3];
         /* 0207CB7C */ _t6 = cpu->r[29] + 0x00000030u;
         /* 0207CB7C */ cpu->r[10] = rbrew_read32(cpu->mem, _t6);
-        /* 0207CB80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0207CB80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0207CB84 */ cpu->r[28] = 0x00000000u;
-        /* 0207CB88 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207CB88 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207CB88 */ _t8 = _t7 & 0x00000001u;
         /* 0207CB88 */ if (_t8) goto L_0207CB8C; else goto L_0207CCAC;
   L_0207CB8C: ; // 0x207cb8c
@@ -31887,8 +31887,8 @@ void Gambit_fn_0207CB60(CPUState* cpu) {
         /* 0207CBA0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t12);
         /* 0207CBA4 */ _t13 = cpu->r[7] + 0x00000482u;
         /* 0207CBA4 */ cpu->r[9] = rbrew_read8(cpu->mem, _t13);
-        /* 0207CBA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0207CBAC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207CBA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0207CBAC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207CBAC */ _t15 = _t14 & 0x00000001u;
         /* 0207CBAC */ if (_t15) goto L_0207CBC4; else goto L_0207CBB0;
   L_0207CBB0: ; // 0x207cbb0
@@ -31903,8 +31903,8 @@ void Gambit_fn_0207CB60(CPUState* cpu) {
   L_0207CBC4: ; // 0x207cbc4
         /* 0207CBC4 */ _t19 = cpu->r[7] + 0x00000483u;
         /* 0207CBC4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t19);
-        /* 0207CBC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207CBCC */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207CBC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207CBCC */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207CBCC */ _t21 = _t20 & 0x00000001u;
         /* 0207CBCC */ if (_t21) goto L_0207CBE0; else goto L_0207CBD0;
   L_0207CBD0: ; // 0x207cbd0
@@ -31942,9 +31942,9 @@ void Gambit_fn_0207CB60(CPUState* cpu) {
         /* 0207CC20 */ cpu->r[7] = rbrew_read32(cpu->mem, _t31);
         /* 0207CC24 */ cpu->r[31] = 0x00000000u;
         /* 0207CC28 */ cpu->r[30] = cpu->r[3];
-        /* 0207CC2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[30]);
+        /* 0207CC2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[30]));
         /* 0207CC30 */ cpu->r[11] = cpu->r[7] + 0x00000060u;
-        /* 0207CC34 */ _t32 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207CC34 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207CC34 */ _t33 = _t32 & 0x00000001u;
         /* 0207CC34 */ if (_t33) goto L_0207CC38; else goto L_0207CC68;
   L_0207CC38: ; // 0x207cc38
@@ -31960,9 +31960,9 @@ void Gambit_fn_0207CB60(CPUState* cpu) {
         /* 0207CC54 */ _t36 = cpu->r[29] + 0x00000000u;
         /* 0207CC54 */ cpu->r[9] = rbrew_read32(cpu->mem, _t36);
         /* 0207CC58 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0207CC5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[30]);
+        /* 0207CC5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[30]));
         /* 0207CC60 */ cpu->r[11] = cpu->r[9] + 0x00000060u;
-        /* 0207CC64 */ _t37 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207CC64 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207CC64 */ _t38 = _t37 & 0x00000001u;
         /* 0207CC64 */ if (_t38) goto L_0207CC38; else goto L_0207CC68;
   L_0207CC68: ; // 0x207cc68
@@ -31992,23 +31992,23 @@ void Gambit_fn_0207CB60(CPUState* cpu) {
   L_0207CCAC: ; // 0x207ccac
         /* 0207CCAC */ cpu->r[3] = cpu->r[29];
         /* 0207CCB0 */ Gambit_fn_0207CA1C(cpu);
-        /* 0207CCB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207CCB8 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207CCB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207CCB8 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207CCB8 */ _t46 = _t45 & 0x00000001u;
         /* 0207CCB8 */ if (_t46) goto L_0207CCE0; else goto L_0207CCBC;
   L_0207CCBC: ; // 0x207ccbc
         /* 0207CCBC */ _t47 = cpu->r[29] + 0x00000088u;
         /* 0207CCBC */ cpu->r[0] = rbrew_read8(cpu->mem, _t47);
-        /* 0207CCC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0207CCC4 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207CCC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0207CCC4 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207CCC4 */ _t49 = _t48 & 0x00000001u;
         /* 0207CCC4 */ if (_t49) goto L_0207CCE0; else goto L_0207CCC8;
   L_0207CCC8: ; // 0x207ccc8
         /* 0207CCC8 */ _t50 = cpu->r[29] + 0x00000070u;
         /* 0207CCC8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t50);
         /* 0207CCCC */ Gambit_fn_0207A584(cpu);
-        /* 0207CCD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207CCD4 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207CCD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207CCD4 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207CCD4 */ _t52 = _t51 & 0x00000001u;
         /* 0207CCD4 */ if (_t52) goto L_0207CCE0; else goto L_0207CCD8;
   L_0207CCD8: ; // 0x207ccd8
@@ -32021,8 +32021,8 @@ void Gambit_fn_0207CB60(CPUState* cpu) {
         /* 0207CCE4 */ _t55 = cpu->r[3] + 0x00000118u;
         /* 0207CCE4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t55);
         /* 0207CCE8 */ cpu->r[9] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0207CCE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0207CCEC */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207CCE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0207CCEC */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207CCEC */ _t57 = _t56 & 0x00000001u;
         /* 0207CCEC */ if (_t57) goto L_0207CDA8; else goto L_0207CCF0;
   L_0207CCF0: ; // 0x207ccf0
@@ -32043,9 +32043,9 @@ void Gambit_fn_0207CB60(CPUState* cpu) {
         /* 0207CD1C */ cpu->r[8] = rbrew_read32(cpu->mem, _t60);
         /* 0207CD20 */ cpu->r[31] = 0x00000000u;
         /* 0207CD24 */ cpu->r[30] = cpu->r[3];
-        /* 0207CD28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[30]);
+        /* 0207CD28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[30]));
         /* 0207CD2C */ cpu->r[12] = cpu->r[8] + 0x00000060u;
-        /* 0207CD30 */ _t61 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207CD30 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207CD30 */ _t62 = _t61 & 0x00000001u;
         /* 0207CD30 */ if (_t62) goto L_0207CD34; else goto L_0207CD60;
   L_0207CD34: ; // 0x207cd34
@@ -32059,9 +32059,9 @@ void Gambit_fn_0207CB60(CPUState* cpu) {
         /* 0207CD4C */ _t64 = cpu->r[29] + 0x00000000u;
         /* 0207CD4C */ cpu->r[11] = rbrew_read32(cpu->mem, _t64);
         /* 0207CD50 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0207CD54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[30]);
+        /* 0207CD54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[30]));
         /* 0207CD58 */ cpu->r[12] = cpu->r[11] + 0x00000060u;
-        /* 0207CD5C */ _t65 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0207CD5C */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0207CD5C */ _t66 = _t65 & 0x00000001u;
         /* 0207CD5C */ if (_t66) goto L_0207CD34; else goto L_0207CD60;
   L_0207CD60: ; // 0x207cd60
@@ -32097,8 +32097,8 @@ void Gambit_fn_0207CB60(CPUState* cpu) {
         /* 0207CDAC */ cpu->r[0] = rbrew_read32(cpu->mem, _t75);
         /* 0207CDB0 */ cpu->ctr = cpu->r[0];
         /* 0207CDB4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0207CDB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207CDBC */ _t76 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207CDB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207CDBC */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207CDBC */ _t77 = _t76 & 0x00000001u;
         /* 0207CDBC */ if (_t77) goto L_0207CDC8; else goto L_0207CDC0;
   L_0207CDC0: ; // 0x207cdc0
@@ -32128,18 +32128,18 @@ void Gambit_fn_0207CDE8(CPUState* cpu) {
         /* 0207CDE8 */ cpu->r[0] = cpu->lr;
         /* 0207CDEC */ _t0 = cpu->r[1] + 0x00000004u;
         /* 0207CDEC */ rbrew_write32(cpu->mem, _t0, cpu->r[0]);
-        /* 0207CDF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0207CDF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0207CDF4 */ _t1 = cpu->r[1] + 0xFFFFFFF8u;
         /* 0207CDF4 */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0207CDF4 */ cpu->r[1] = _t1;
-        /* 0207CDF8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207CDF8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207CDF8 */ _t3 = _t2 & 0x00000001u;
         /* 0207CDF8 */ if (_t3) goto L_0207CDFC; else goto L_0207CE0C;
   L_0207CDFC: ; // 0x207cdfc
         /* 0207CDFC */ cpu->r[3] = 0x00000010u;
         /* 0207CE00 */ Gambit_fn_02801A78(cpu);
-        /* 0207CE04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207CE08 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207CE04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207CE08 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207CE08 */ _t5 = _t4 & 0x00000001u;
         /* 0207CE08 */ if (_t5) goto L_0207CE38; else goto L_0207CE0C;
   L_0207CE0C: ; // 0x207ce0c
@@ -32180,14 +32180,14 @@ void Gambit_fn_0207CDF4(CPUState* cpu) {
         /* 0207CDF4 */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 0207CDF4 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 0207CDF4 */ cpu->r[1] = _t0;
-        /* 0207CDF8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207CDF8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207CDF8 */ _t2 = _t1 & 0x00000001u;
         /* 0207CDF8 */ if (_t2) goto L_0207CDFC; else goto L_0207CE0C;
   L_0207CDFC: ; // 0x207cdfc
         /* 0207CDFC */ cpu->r[3] = 0x00000010u;
         /* 0207CE00 */ Gambit_fn_02801A78(cpu);
-        /* 0207CE04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0207CE08 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0207CE04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0207CE08 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0207CE08 */ _t4 = _t3 & 0x00000001u;
         /* 0207CE08 */ if (_t4) goto L_0207CE38; else goto L_0207CE0C;
   L_0207CE0C: ; // 0x207ce0c
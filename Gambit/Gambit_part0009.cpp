@@ -36,15 +36,15 @@ void Gambit_fn_02089168(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02089168: ; // 0x2089168
-        /* 02089168 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208916C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089168 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208916C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208916C */ _t1 = _t0 & 0x00000001u;
         /* 0208916C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208916C */ goto L_02089170;
   L_02089170: ; // 0x2089170
         /* 02089170 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02089170 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02089174 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089170 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02089174 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089174 */ _t3 = _t2 & 0x00000001u;
         /* 02089174 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02089174 */ goto L_02089178;
@@ -63,8 +63,8 @@ void Gambit_fn_02089168(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -78,15 +78,15 @@ void Gambit_fn_02089168(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -141,11 +141,11 @@ void Gambit_fn_02089198(CPUState* cpu) {
         /* 020891A4 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020891A4 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020891A8 */ cpu->r[30] = cpu->r[3];
-        /* 020891A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020891A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020891AC */ cpu->r[31] = cpu->r[4];
         /* 020891B0 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020891B0 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020891B4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020891B4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020891B4 */ _t5 = _t4 & 0x00000001u;
         /* 020891B4 */ if (_t5) goto L_020891E8; else goto L_020891B8;
   L_020891B8: ; // 0x20891b8
@@ -158,8 +158,8 @@ void Gambit_fn_02089198(CPUState* cpu) {
         /* 020891D0 */ cpu->r[5] = 0x00000008u;
         /* 020891D4 */ Gambit_fn_02C82F38(cpu);
         /* 020891D8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020891D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020891DC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020891D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020891DC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020891DC */ _t7 = _t6 & 0x00000001u;
         /* 020891DC */ if (_t7) goto L_020891E8; else goto L_020891E0;
   L_020891E0: ; // 0x20891e0
@@ -190,11 +190,11 @@ void Gambit_fn_0208919C(CPUState* cpu) {
         /* 020891A4 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020891A4 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020891A8 */ cpu->r[30] = cpu->r[3];
-        /* 020891A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020891A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020891AC */ cpu->r[31] = cpu->r[4];
         /* 020891B0 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020891B0 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020891B4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020891B4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020891B4 */ _t5 = _t4 & 0x00000001u;
         /* 020891B4 */ if (_t5) goto L_020891E8; else goto L_020891B8;
   L_020891B8: ; // 0x20891b8
@@ -207,8 +207,8 @@ void Gambit_fn_0208919C(CPUState* cpu) {
         /* 020891D0 */ cpu->r[5] = 0x00000008u;
         /* 020891D4 */ Gambit_fn_02C82F38(cpu);
         /* 020891D8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020891D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020891DC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020891D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020891DC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020891DC */ _t7 = _t6 & 0x00000001u;
         /* 020891DC */ if (_t7) goto L_020891E8; else goto L_020891E0;
   L_020891E0: ; // 0x20891e0
@@ -231,15 +231,15 @@ void Gambit_fn_02089200(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02089200: ; // 0x2089200
-        /* 02089200 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02089204 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089200 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02089204 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089204 */ _t1 = _t0 & 0x00000001u;
         /* 02089204 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02089204 */ goto L_02089208;
   L_02089208: ; // 0x2089208
         /* 02089208 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02089208 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208920C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208920C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208920C */ _t3 = _t2 & 0x00000001u;
         /* 0208920C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208920C */ goto L_02089210;
@@ -258,8 +258,8 @@ void Gambit_fn_02089200(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -273,15 +273,15 @@ void Gambit_fn_02089200(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -309,15 +309,15 @@ void Gambit_fn_02089214(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02089214: ; // 0x2089214
-        /* 02089214 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02089218 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089214 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02089218 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089218 */ _t1 = _t0 & 0x00000001u;
         /* 02089218 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02089218 */ goto L_0208921C;
   L_0208921C: ; // 0x208921c
         /* 0208921C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0208921C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02089220 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208921C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02089220 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089220 */ _t3 = _t2 & 0x00000001u;
         /* 02089220 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02089220 */ goto L_02089224;
@@ -336,8 +336,8 @@ void Gambit_fn_02089214(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -351,15 +351,15 @@ void Gambit_fn_02089214(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -459,9 +459,9 @@ void Gambit_fn_02089264(CPUState* cpu) {
         /* 02089268 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 02089268 */ cpu->r[9] = _t0;
         /* 0208926C */ cpu->r[12] = 0x101D0000u;
-        /* 02089270 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02089270 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02089274 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 02089278 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089278 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089278 */ _t2 = _t1 & 0x00000001u;
         /* 02089278 */ if (_t2) goto L_0208927C; else goto L_02089290;
   L_0208927C: ; // 0x208927c
@@ -473,8 +473,8 @@ void Gambit_fn_02089264(CPUState* cpu) {
         /* 0208928C */ _t4 = cpu->r[12] + 0x00000000u;
         /* 0208928C */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_02089290: ; // 0x2089290
-        /* 02089290 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02089294 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089290 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02089294 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089294 */ _t6 = _t5 & 0x00000001u;
         /* 02089294 */ if (_t6) goto L_02089298; else goto L_020892A0;
   L_02089298: ; // 0x2089298
@@ -486,9 +486,9 @@ void Gambit_fn_02089264(CPUState* cpu) {
         /* 020892A4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 020892A4 */ cpu->r[7] = _t7;
         /* 020892A8 */ cpu->r[11] = 0x101D0000u;
-        /* 020892AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020892AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020892B0 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 020892B4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020892B4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020892B4 */ _t9 = _t8 & 0x00000001u;
         /* 020892B4 */ if (_t9) goto L_020892B8; else goto L_020892CC;
   L_020892B8: ; // 0x20892b8
@@ -590,18 +590,18 @@ void Gambit_fn_0208930C(CPUState* cpu) {
         /* 02008980 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02008980 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02008984 */ cpu->r[12] = 0x00000000u;
-        /* 02008988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02008988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0200898C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0200898C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02008990 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02008990 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02008990 */ _t6 = _t5 & 0x00000001u;
         /* 02008990 */ if (_t6) goto L_020089B8; else goto L_02008994;
   L_02008994: ; // 0x2008994
         /* 02008994 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02008994 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02008998 */ /* nop */
-        /* 0200899C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 020089A0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0200899C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 020089A0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020089A0 */ _t9 = _t8 & 0x00000001u;
         /* 020089A0 */ if (_t9) goto L_020089A4; else goto L_020089B8;
   L_020089A4: ; // 0x20089a4
@@ -653,11 +653,11 @@ void Gambit_fn_0208931C(CPUState* cpu) {
         /* 02089DA8 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02089DA8 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02089DAC */ cpu->r[30] = cpu->r[3];
-        /* 02089DAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02089DAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02089DB0 */ cpu->r[31] = cpu->r[4];
         /* 02089DB4 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02089DB4 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02089DB8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089DB8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089DB8 */ _t5 = _t4 & 0x00000001u;
         /* 02089DB8 */ if (_t5) goto L_02089E28; else goto L_02089DBC;
   L_02089DBC: ; // 0x2089dbc
@@ -671,10 +671,10 @@ void Gambit_fn_0208931C(CPUState* cpu) {
         /* 02089DD4 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02089DD4 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02089DD8 */ cpu->r[11] = cpu->r[11] + 0xFFFFD658u;
-        /* 02089DDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02089DDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02089DE0 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02089DE0 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02089DE4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089DE4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089DE4 */ _t10 = _t9 & 0x00000001u;
         /* 02089DE4 */ if (_t10) goto L_02089E18; else goto L_02089DE8;
   L_02089DE8: ; // 0x2089de8
@@ -695,8 +695,8 @@ void Gambit_fn_0208931C(CPUState* cpu) {
         /* 02089E14 */ Gambit_fn_02068798(cpu);
   L_02089E18: ; // 0x2089e18
         /* 02089E18 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02089E18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02089E1C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089E18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02089E1C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089E1C */ _t15 = _t14 & 0x00000001u;
         /* 02089E1C */ if (_t15) goto L_02089E28; else goto L_02089E20;
   L_02089E20: ; // 0x2089e20
@@ -777,18 +777,18 @@ void Gambit_fn_02089350(CPUState* cpu) {
         /* 02089358 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 02089358 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0208935C */ cpu->r[31] = cpu->r[3];
-        /* 0208935C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0208935C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02089360 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02089360 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 02089364 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089364 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089364 */ _t4 = _t3 & 0x00000001u;
         /* 02089364 */ if (_t4) goto L_02089368; else goto L_02089378;
   L_02089368: ; // 0x2089368
         /* 02089368 */ cpu->r[3] = 0x00000238u;
         /* 0208936C */ Gambit_fn_02801A78(cpu);
         /* 02089370 */ cpu->r[31] = cpu->r[3];
-        /* 02089370 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02089374 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089370 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02089374 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089374 */ _t6 = _t5 & 0x00000001u;
         /* 02089374 */ if (_t6) goto L_020893E0; else goto L_02089378;
   L_02089378: ; // 0x2089378
@@ -846,18 +846,18 @@ void Gambit_fn_02089354(CPUState* cpu) {
         /* 02089358 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 02089358 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0208935C */ cpu->r[31] = cpu->r[3];
-        /* 0208935C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0208935C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02089360 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02089360 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 02089364 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089364 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089364 */ _t4 = _t3 & 0x00000001u;
         /* 02089364 */ if (_t4) goto L_02089368; else goto L_02089378;
   L_02089368: ; // 0x2089368
         /* 02089368 */ cpu->r[3] = 0x00000238u;
         /* 0208936C */ Gambit_fn_02801A78(cpu);
         /* 02089370 */ cpu->r[31] = cpu->r[3];
-        /* 02089370 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02089374 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089370 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02089374 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089374 */ _t6 = _t5 & 0x00000001u;
         /* 02089374 */ if (_t6) goto L_020893E0; else goto L_02089378;
   L_02089378: ; // 0x2089378
@@ -929,8 +929,8 @@ void Gambit_fn_020893F8(CPUState* cpu) {
         /* 0208941C */ cpu->r[30] = cpu->r[4];
         /* 02089420 */ cpu->r[31] = cpu->r[3];
         /* 02089424 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02089428 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208942C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089428 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208942C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208942C */ _t8 = _t7 & 0x00000001u;
         /* 0208942C */ if (_t8) goto L_0208950C; else goto L_02089430;
   L_02089430: ; // 0x2089430
@@ -941,10 +941,10 @@ void Gambit_fn_020893F8(CPUState* cpu) {
         /* 0208943C */ cpu->r[10] = rbrew_read32(cpu->mem, _t9);
         /* 02089440 */ cpu->r[31] = cpu->r[31] + 0xFFFFD794u;
         /* 02089444 */ cpu->r[29] = cpu->r[3];
-        /* 02089448 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000003u);
+        /* 02089448 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000003u));
         /* 0208944C */ _t10 = cpu->r[29] + 0x00000004u;
         /* 0208944C */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 02089450 */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02089450 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02089450 */ _t12 = _t11 & 0x00000001u;
         /* 02089450 */ if (_t12) goto L_02089454; else goto L_0208945C;
   L_02089454: ; // 0x2089454
@@ -974,8 +974,8 @@ void Gambit_fn_020893F8(CPUState* cpu) {
         /* 02089494 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02089498 */ _t19 = cpu->r[31] + 0x00000000u;
         /* 02089498 */ cpu->r[10] = rbrew_read32(cpu->mem, _t19);
-        /* 0208949C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[10]);
-        /* 020894A0 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208949C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[10]));
+        /* 020894A0 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020894A0 */ _t21 = _t20 & 0x00000001u;
         /* 020894A0 */ if (_t21) goto L_020894EC; else goto L_020894A4;
   L_020894A4: ; // 0x20894a4
@@ -998,13 +998,13 @@ void Gambit_fn_020893F8(CPUState* cpu) {
         /* 020894CC */ _t26 = cpu->r[9] + 0x00000001u;
         /* 020894CC */ cpu->r[11] = rbrew_read8(cpu->mem, _t26);
         /* 020894CC */ cpu->r[9] = _t26;
-        /* 020894D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[11]);
-        /* 020894D4 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020894D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[11]));
+        /* 020894D4 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020894D4 */ _t28 = _t27 & 0x00000001u;
         /* 020894D4 */ if (_t28) goto L_020894D8; else goto L_0208950C;
   L_020894D8: ; // 0x20894d8
-        /* 020894D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 020894DC */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020894D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 020894DC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020894DC */ _t30 = _t29 & 0x00000001u;
         /* 020894DC */ if (_t30) goto L_020894EC; else goto L_020894E0;
   L_020894E0: ; // 0x20894e0
@@ -1069,8 +1069,8 @@ void Gambit_fn_020893FC(CPUState* cpu) {
         /* 0208941C */ cpu->r[30] = cpu->r[4];
         /* 02089420 */ cpu->r[31] = cpu->r[3];
         /* 02089424 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02089428 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208942C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089428 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208942C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208942C */ _t8 = _t7 & 0x00000001u;
         /* 0208942C */ if (_t8) goto L_0208950C; else goto L_02089430;
   L_02089430: ; // 0x2089430
@@ -1081,10 +1081,10 @@ void Gambit_fn_020893FC(CPUState* cpu) {
         /* 0208943C */ cpu->r[10] = rbrew_read32(cpu->mem, _t9);
         /* 02089440 */ cpu->r[31] = cpu->r[31] + 0xFFFFD794u;
         /* 02089444 */ cpu->r[29] = cpu->r[3];
-        /* 02089448 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000003u);
+        /* 02089448 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000003u));
         /* 0208944C */ _t10 = cpu->r[29] + 0x00000004u;
         /* 0208944C */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 02089450 */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02089450 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02089450 */ _t12 = _t11 & 0x00000001u;
         /* 02089450 */ if (_t12) goto L_02089454; else goto L_0208945C;
   L_02089454: ; // 0x2089454
@@ -1114,8 +1114,8 @@ void Gambit_fn_020893FC(CPUState* cpu) {
         /* 02089494 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02089498 */ _t19 = cpu->r[31] + 0x00000000u;
         /* 02089498 */ cpu->r[10] = rbrew_read32(cpu->mem, _t19);
-        /* 0208949C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[10]);
-        /* 020894A0 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208949C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[10]));
+        /* 020894A0 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020894A0 */ _t21 = _t20 & 0x00000001u;
         /* 020894A0 */ if (_t21) goto L_020894EC; else goto L_020894A4;
   L_020894A4: ; // 0x20894a4
@@ -1138,13 +1138,13 @@ void Gambit_fn_020893FC(CPUState* cpu) {
         /* 020894CC */ _t26 = cpu->r[9] + 0x00000001u;
         /* 020894CC */ cpu->r[11] = rbrew_read8(cpu->mem, _t26);
         /* 020894CC */ cpu->r[9] = _t26;
-        /* 020894D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[11]);
-        /* 020894D4 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020894D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[11]));
+        /* 020894D4 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020894D4 */ _t28 = _t27 & 0x00000001u;
         /* 020894D4 */ if (_t28) goto L_020894D8; else goto L_0208950C;
   L_020894D8: ; // 0x20894d8
-        /* 020894D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 020894DC */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020894D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 020894DC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020894DC */ _t30 = _t29 & 0x00000001u;
         /* 020894DC */ if (_t30) goto L_020894EC; else goto L_020894E0;
   L_020894E0: ; // 0x20894e0
@@ -1273,8 +1273,8 @@ void Gambit_fn_02089530(CPUState* cpu) {
         /* 020895BC */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020895C0 */ _t13 = cpu->r[1] + 0x00000010u;
         /* 020895C0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t13);
-        /* 020895C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[11]);
-        /* 020895C8 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020895C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[11]));
+        /* 020895C8 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020895C8 */ _t15 = _t14 & 0x00000001u;
         /* 020895C8 */ if (_t15) goto L_02089600; else goto L_020895CC;
   L_020895CC: ; // 0x20895cc
@@ -1290,13 +1290,13 @@ void Gambit_fn_02089530(CPUState* cpu) {
         /* 020895E0 */ _t19 = cpu->r[9] + 0x00000001u;
         /* 020895E0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t19);
         /* 020895E0 */ cpu->r[9] = _t19;
-        /* 020895E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[0]);
-        /* 020895E8 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020895E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[0]));
+        /* 020895E8 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020895E8 */ _t21 = _t20 & 0x00000001u;
         /* 020895E8 */ if (_t21) goto L_020895EC; else goto L_02089680;
   L_020895EC: ; // 0x20895ec
-        /* 020895EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[31]);
-        /* 020895F0 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020895EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[31]));
+        /* 020895F0 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020895F0 */ _t23 = _t22 & 0x00000001u;
         /* 020895F0 */ if (_t23) goto L_02089600; else goto L_020895F4;
   L_020895F4: ; // 0x20895f4
@@ -1310,16 +1310,16 @@ void Gambit_fn_02089530(CPUState* cpu) {
         /* 020895FC */ goto L_02089680;
   L_02089600: ; // 0x2089600
         /* 02089600 */ Gambit_fn_027E3F5C(cpu);
-        /* 02089604 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02089608 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02089608 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089608 */ _t28 = _t27 & 0x00000001u;
         /* 02089608 */ if (_t28) goto L_02089644; else goto L_0208960C;
   L_0208960C: ; // 0x208960c
-        /* 0208960C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000003u);
+        /* 0208960C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000003u));
         /* 02089610 */ cpu->r[30] = cpu->r[29] + 0x00000224u;
         /* 02089614 */ _t29 = cpu->r[29] + 0x00000234u;
         /* 02089614 */ rbrew_write8(cpu->mem, _t29, (uint8_t)cpu->r[22]);
-        /* 02089618 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02089618 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02089618 */ _t31 = _t30 & 0x00000001u;
         /* 02089618 */ if (_t31) goto L_0208961C; else goto L_02089630;
   L_0208961C: ; // 0x208961c
@@ -1337,14 +1337,14 @@ void Gambit_fn_02089530(CPUState* cpu) {
         /* 0208963C */ Gambit_fn_020A7D70(cpu);
         /* 02089640 */ goto L_020898E4;
   L_02089644: ; // 0x2089644
-        /* 02089644 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000001u);
-        /* 02089648 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089644 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000001u));
+        /* 02089648 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089648 */ _t35 = _t34 & 0x00000001u;
         /* 02089648 */ if (_t35) goto L_020898F8; else goto L_0208964C;
   L_0208964C: ; // 0x208964c
-        /* 0208964C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000003u);
+        /* 0208964C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000003u));
         /* 02089650 */ cpu->r[30] = cpu->r[29] + 0x00000224u;
-        /* 02089654 */ _t36 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02089654 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02089654 */ _t37 = _t36 & 0x00000001u;
         /* 02089654 */ if (_t37) goto L_02089658; else goto L_0208966C;
   L_02089658: ; // 0x2089658
@@ -1393,8 +1393,8 @@ void Gambit_fn_02089530(CPUState* cpu) {
         /* 020896CC */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020896D0 */ _t49 = cpu->r[1] + 0x00000018u;
         /* 020896D0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t49);
-        /* 020896D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[11]);
-        /* 020896D8 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020896D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[11]));
+        /* 020896D8 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020896D8 */ _t51 = _t50 & 0x00000001u;
         /* 020896D8 */ if (_t51) goto L_02089710; else goto L_020896DC;
   L_020896DC: ; // 0x20896dc
@@ -1410,13 +1410,13 @@ void Gambit_fn_02089530(CPUState* cpu) {
         /* 020896F0 */ _t55 = cpu->r[7] + 0x00000001u;
         /* 020896F0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t55);
         /* 020896F0 */ cpu->r[7] = _t55;
-        /* 020896F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
-        /* 020896F8 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020896F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
+        /* 020896F8 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020896F8 */ _t57 = _t56 & 0x00000001u;
         /* 020896F8 */ if (_t57) goto L_020896FC; else goto L_0208974C;
   L_020896FC: ; // 0x20896fc
-        /* 020896FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[31]);
-        /* 02089700 */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020896FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[31]));
+        /* 02089700 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089700 */ _t59 = _t58 & 0x00000001u;
         /* 02089700 */ if (_t59) goto L_02089710; else goto L_02089704;
   L_02089704: ; // 0x2089704
@@ -1429,14 +1429,14 @@ void Gambit_fn_02089530(CPUState* cpu) {
   L_0208970C: ; // 0x208970c
         /* 0208970C */ goto L_0208974C;
   L_02089710: ; // 0x2089710
-        /* 02089710 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000001u);
-        /* 02089714 */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000001u));
+        /* 02089714 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089714 */ _t64 = _t63 & 0x00000001u;
         /* 02089714 */ if (_t64) goto L_020898F8; else goto L_02089718;
   L_02089718: ; // 0x2089718
-        /* 02089718 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000003u);
+        /* 02089718 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000003u));
         /* 0208971C */ cpu->r[30] = cpu->r[29] + 0x00000224u;
-        /* 02089720 */ _t65 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02089720 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02089720 */ _t66 = _t65 & 0x00000001u;
         /* 02089720 */ if (_t66) goto L_02089724; else goto L_02089738;
   L_02089724: ; // 0x2089724
@@ -1485,8 +1485,8 @@ void Gambit_fn_02089530(CPUState* cpu) {
         /* 02089798 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208979C */ _t78 = cpu->r[1] + 0x00000020u;
         /* 0208979C */ cpu->r[0] = rbrew_read32(cpu->mem, _t78);
-        /* 020897A0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
-        /* 020897A4 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020897A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
+        /* 020897A4 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020897A4 */ _t80 = _t79 & 0x00000001u;
         /* 020897A4 */ if (_t80) goto L_020897DC; else goto L_020897A8;
   L_020897A8: ; // 0x20897a8
@@ -1502,13 +1502,13 @@ void Gambit_fn_02089530(CPUState* cpu) {
         /* 020897BC */ _t84 = cpu->r[5] + 0x00000001u;
         /* 020897BC */ cpu->r[12] = rbrew_read8(cpu->mem, _t84);
         /* 020897BC */ cpu->r[5] = _t84;
-        /* 020897C0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 020897C4 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020897C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 020897C4 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020897C4 */ _t86 = _t85 & 0x00000001u;
         /* 020897C4 */ if (_t86) goto L_020897C8; else goto L_02089818;
   L_020897C8: ; // 0x20897c8
-        /* 020897C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020897CC */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020897C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020897CC */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020897CC */ _t88 = _t87 & 0x00000001u;
         /* 020897CC */ if (_t88) goto L_020897DC; else goto L_020897D0;
   L_020897D0: ; // 0x20897d0
@@ -1521,14 +1521,14 @@ void Gambit_fn_02089530(CPUState* cpu) {
   L_020897D8: ; // 0x20897d8
         /* 020897D8 */ goto L_02089818;
   L_020897DC: ; // 0x20897dc
-        /* 020897DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000001u);
-        /* 020897E0 */ _t92 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020897DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000001u));
+        /* 020897E0 */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020897E0 */ _t93 = _t92 & 0x00000001u;
         /* 020897E0 */ if (_t93) goto L_020898F8; else goto L_020897E4;
   L_020897E4: ; // 0x20897e4
-        /* 020897E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000003u);
+        /* 020897E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000003u));
         /* 020897E8 */ cpu->r[30] = cpu->r[29] + 0x00000224u;
-        /* 020897EC */ _t94 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020897EC */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020897EC */ _t95 = _t94 & 0x00000001u;
         /* 020897EC */ if (_t95) goto L_020897F0; else goto L_02089804;
   L_020897F0: ; // 0x20897f0
@@ -1577,8 +1577,8 @@ void Gambit_fn_02089530(CPUState* cpu) {
         /* 02089864 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02089868 */ _t107 = cpu->r[1] + 0x00000028u;
         /* 02089868 */ cpu->r[6] = rbrew_read32(cpu->mem, _t107);
-        /* 0208986C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[6]);
-        /* 02089870 */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208986C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[6]));
+        /* 02089870 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089870 */ _t109 = _t108 & 0x00000001u;
         /* 02089870 */ if (_t109) goto L_020898B4; else goto L_02089874;
   L_02089874: ; // 0x2089874
@@ -1594,13 +1594,13 @@ void Gambit_fn_02089530(CPUState* cpu) {
         /* 02089888 */ _t113 = cpu->r[12] + 0x00000001u;
         /* 02089888 */ cpu->r[7] = rbrew_read8(cpu->mem, _t113);
         /* 02089888 */ cpu->r[12] = _t113;
-        /* 0208988C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
-        /* 02089890 */ _t114 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208988C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
+        /* 02089890 */ _t114 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089890 */ _t115 = _t114 & 0x00000001u;
         /* 02089890 */ if (_t115) goto L_02089894; else goto L_020898A4;
   L_02089894: ; // 0x2089894
-        /* 02089894 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 02089898 */ _t116 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089894 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 02089898 */ _t116 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089898 */ _t117 = _t116 & 0x00000001u;
         /* 02089898 */ if (_t117) goto L_020898B4; else goto L_0208989C;
   L_0208989C: ; // 0x208989c
@@ -1611,22 +1611,22 @@ void Gambit_fn_02089530(CPUState* cpu) {
         /* 020898A0 */ _t120 = _t119 & 0x00000001u;
         /* 020898A0 */ if (_t120) goto L_02089884; else goto L_020898A4;
   L_020898A4: ; // 0x20898a4
-        /* 020898A4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000003u);
+        /* 020898A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000003u));
         /* 020898A8 */ cpu->r[30] = cpu->r[29] + 0x00000224u;
-        /* 020898AC */ _t121 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020898AC */ _t121 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020898AC */ _t122 = _t121 & 0x00000001u;
         /* 020898AC */ if (_t122) goto L_020898EC; else goto L_020898B0;
   L_020898B0: ; // 0x20898b0
         /* 020898B0 */ goto L_020898F0;
   L_020898B4: ; // 0x20898b4
-        /* 020898B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000001u);
-        /* 020898B8 */ _t123 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020898B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000001u));
+        /* 020898B8 */ _t123 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020898B8 */ _t124 = _t123 & 0x00000001u;
         /* 020898B8 */ if (_t124) goto L_020898F8; else goto L_020898BC;
   L_020898BC: ; // 0x20898bc
-        /* 020898BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000003u);
+        /* 020898BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000003u));
         /* 020898C0 */ cpu->r[30] = cpu->r[29] + 0x00000224u;
-        /* 020898C4 */ _t125 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020898C4 */ _t125 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020898C4 */ _t126 = _t125 & 0x00000001u;
         /* 020898C4 */ if (_t126) goto L_020898C8; else goto L_020898D4;
   L_020898C8: ; // 0x20898c8
@@ -1642,8 +1642,8 @@ void Gambit_fn_02089530(CPUState* cpu) {
         /* 020898DC */ cpu->r[5] = 0x00000003u;
         /* 020898E0 */ Gambit_fn_020A7D70(cpu);
   L_020898E4: ; // 0x20898e4
-        /* 020898E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000003u);
-        /* 020898E8 */ _t129 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020898E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000003u));
+        /* 020898E8 */ _t129 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020898E8 */ _t130 = _t129 & 0x00000001u;
         /* 020898E8 */ if (_t130) goto L_020898EC; else goto L_020898B0;
   L_020898EC: ; // 0x20898ec
@@ -1654,17 +1654,17 @@ void Gambit_fn_02089530(CPUState* cpu) {
         /* 020898F4 */ Gambit_fn_020A7E60(cpu);
   L_020898F8: ; // 0x20898f8
         /* 020898F8 */ cpu->r[24] = cpu->r[24] + 0xFFFFFFFFu;
-        /* 020898F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 020898F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 020898FC */ cpu->r[23] = cpu->r[23] + 0x00000001u;
         /* 02089900 */ cpu->r[25] = cpu->r[25] + 0x00000004u;
-        /* 02089904 */ _t132 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089904 */ _t132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089904 */ _t133 = _t132 & 0x00000001u;
         /* 02089904 */ if (_t133) goto L_02089908; else goto L_02089578;
   L_02089908: ; // 0x2089908
         /* 02089908 */ _t134 = cpu->r[29] + 0x00000234u;
         /* 02089908 */ cpu->r[10] = rbrew_read8(cpu->mem, _t134);
-        /* 0208990C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02089910 */ _t135 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208990C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02089910 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089910 */ _t136 = _t135 & 0x00000001u;
         /* 02089910 */ if (_t136) goto L_02089940; else goto L_02089914;
   L_02089914: ; // 0x2089914
@@ -1723,9 +1723,9 @@ void Gambit_fn_0208997C(CPUState* cpu) {
         /* 02089990 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 02089994 */ _t4 = cpu->r[30] + 0x00000218u;
         /* 02089994 */ cpu->r[12] = rbrew_read32(cpu->mem, _t4);
-        /* 02089998 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02089998 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0208999C */ cpu->r[31] = cpu->r[30] + 0x00000218u;
-        /* 020899A0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020899A0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020899A0 */ _t6 = _t5 & 0x00000001u;
         /* 020899A0 */ if (_t6) goto L_020899B4; else goto L_020899A4;
   L_020899A4: ; // 0x20899a4
@@ -1738,10 +1738,10 @@ void Gambit_fn_0208997C(CPUState* cpu) {
   L_020899B4: ; // 0x20899b4
         /* 020899B4 */ _t9 = cpu->r[30] + 0x00000234u;
         /* 020899B4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t9);
-        /* 020899B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020899B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020899BC */ _t10 = cpu->r[31] + 0x00000000u;
         /* 020899BC */ cpu->r[3] = rbrew_read32(cpu->mem, _t10);
-        /* 020899C0 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020899C0 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020899C0 */ _t12 = _t11 & 0x00000001u;
         /* 020899C0 */ if (_t12) goto L_020899F0; else goto L_020899C4;
   L_020899C4: ; // 0x20899c4
@@ -1799,9 +1799,9 @@ void Gambit_fn_02089980(CPUState* cpu) {
         /* 02089990 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 02089994 */ _t4 = cpu->r[30] + 0x00000218u;
         /* 02089994 */ cpu->r[12] = rbrew_read32(cpu->mem, _t4);
-        /* 02089998 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02089998 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0208999C */ cpu->r[31] = cpu->r[30] + 0x00000218u;
-        /* 020899A0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020899A0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020899A0 */ _t6 = _t5 & 0x00000001u;
         /* 020899A0 */ if (_t6) goto L_020899B4; else goto L_020899A4;
   L_020899A4: ; // 0x20899a4
@@ -1814,10 +1814,10 @@ void Gambit_fn_02089980(CPUState* cpu) {
   L_020899B4: ; // 0x20899b4
         /* 020899B4 */ _t9 = cpu->r[30] + 0x00000234u;
         /* 020899B4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t9);
-        /* 020899B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020899B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020899BC */ _t10 = cpu->r[31] + 0x00000000u;
         /* 020899BC */ cpu->r[3] = rbrew_read32(cpu->mem, _t10);
-        /* 020899C0 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020899C0 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020899C0 */ _t12 = _t11 & 0x00000001u;
         /* 020899C0 */ if (_t12) goto L_020899F0; else goto L_020899C4;
   L_020899C4: ; // 0x20899c4
@@ -1891,9 +1891,9 @@ void Gambit_fn_02089A20(CPUState* cpu) {
         /* 02089A5C */ cpu->r[25] = cpu->r[20];
         /* 02089A60 */ cpu->r[22] = cpu->r[23] + cpu->r[19];
   L_02089A64: ; // 0x2089a64
-        /* 02089A64 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[21], 0x00000003u);
+        /* 02089A64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[21], 0x00000003u));
         /* 02089A68 */ cpu->r[4] = cpu->r[30];
-        /* 02089A6C */ _t2 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02089A6C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02089A6C */ _t3 = _t2 & 0x00000001u;
         /* 02089A6C */ if (_t3) goto L_02089A70; else goto L_02089A74;
   L_02089A70: ; // 0x2089a70
@@ -1903,9 +1903,9 @@ void Gambit_fn_02089A20(CPUState* cpu) {
         /* 02089A78 */ Gambit_fn_026D86C0(cpu);
         /* 02089A7C */ _t4 = cpu->r[29] + 0xFFFFEDBCu;
         /* 02089A7C */ cpu->r[9] = rbrew_read32(cpu->mem, _t4);
-        /* 02089A80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02089A80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02089A84 */ cpu->r[28] = cpu->r[3];
-        /* 02089A88 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089A88 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089A88 */ _t6 = _t5 & 0x00000001u;
         /* 02089A88 */ if (_t6) goto L_02089A8C; else goto L_02089A9C;
   L_02089A8C: ; // 0x2089a8c
@@ -1916,8 +1916,8 @@ void Gambit_fn_02089A20(CPUState* cpu) {
         /* 02089A98 */ _t8 = cpu->r[31] + 0xFFFFEE20u;
         /* 02089A98 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
   L_02089A9C: ; // 0x2089a9c
-        /* 02089A9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 02089AA0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089A9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 02089AA0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089AA0 */ _t10 = _t9 & 0x00000001u;
         /* 02089AA0 */ if (_t10) goto L_02089AC4; else goto L_02089AA4;
   L_02089AA4: ; // 0x2089aa4
@@ -1929,17 +1929,17 @@ void Gambit_fn_02089A20(CPUState* cpu) {
         /* 02089AB0 */ cpu->r[3] = cpu->r[28];
         /* 02089AB4 */ cpu->r[4] = cpu->r[31] + 0xFFFFEE20u;
         /* 02089AB8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02089ABC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02089AC0 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089ABC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02089AC0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089AC0 */ _t14 = _t13 & 0x00000001u;
         /* 02089AC0 */ if (_t14) goto L_02089AC4; else goto L_02089AC8;
   L_02089AC4: ; // 0x2089ac4
         /* 02089AC4 */ cpu->r[28] = 0x00000000u;
   L_02089AC8: ; // 0x2089ac8
-        /* 02089AC8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[21], 0x00000003u);
+        /* 02089AC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[21], 0x00000003u));
         /* 02089ACC */ _t15 = cpu->r[22] + 0x00000000u;
         /* 02089ACC */ rbrew_write32(cpu->mem, _t15, cpu->r[28]);
-        /* 02089AD0 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02089AD0 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02089AD0 */ _t17 = _t16 & 0x00000001u;
         /* 02089AD0 */ if (_t17) goto L_02089AD4; else goto L_02089B08;
   L_02089AD4: ; // 0x2089ad4
@@ -1949,15 +1949,15 @@ void Gambit_fn_02089A20(CPUState* cpu) {
         /* 02089ADC */ cpu->r[21] = cpu->r[21] + 0x00000001u;
         /* 02089AE0 */ cpu->r[25] = cpu->r[25] + 0x00000008u;
         /* 02089AE4 */ cpu->r[19] = cpu->r[19] + 0x00000004u;
-        /* 02089AE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000003u);
+        /* 02089AE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000003u));
         /* 02089AEC */ cpu->r[26] = cpu->r[26] + 0x00000004u;
         /* 02089AF0 */ cpu->r[20] = cpu->r[20] + 0x00000008u;
-        /* 02089AF4 */ _t19 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02089AF4 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02089AF4 */ _t20 = _t19 & 0x00000001u;
         /* 02089AF4 */ if (_t20) goto L_02089AF8; else goto L_02089B2C;
   L_02089AF8: ; // 0x2089af8
-        /* 02089AF8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[21], 0x00000003u);
-        /* 02089AFC */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02089AF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[21], 0x00000003u));
+        /* 02089AFC */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02089AFC */ _t22 = _t21 & 0x00000001u;
         /* 02089AFC */ if (_t22) goto L_02089A54; else goto L_02089B00;
   L_02089B00: ; // 0x2089b00
@@ -1970,10 +1970,10 @@ void Gambit_fn_02089A20(CPUState* cpu) {
         /* 02089B10 */ cpu->r[21] = cpu->r[21] + 0x00000001u;
         /* 02089B14 */ cpu->r[25] = cpu->r[25] + 0x00000008u;
         /* 02089B18 */ cpu->r[19] = cpu->r[19] + 0x00000004u;
-        /* 02089B1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000003u);
+        /* 02089B1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000003u));
         /* 02089B20 */ cpu->r[26] = cpu->r[26] + 0x00000004u;
         /* 02089B24 */ cpu->r[20] = cpu->r[20] + 0x00000008u;
-        /* 02089B28 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02089B28 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02089B28 */ _t25 = _t24 & 0x00000001u;
         /* 02089B28 */ if (_t25) goto L_02089AF8; else goto L_02089B2C;
   L_02089B2C: ; // 0x2089b2c
@@ -2015,9 +2015,9 @@ void Gambit_fn_02089A24(CPUState* cpu) {
         /* 02089A5C */ cpu->r[25] = cpu->r[20];
         /* 02089A60 */ cpu->r[22] = cpu->r[23] + cpu->r[19];
   L_02089A64: ; // 0x2089a64
-        /* 02089A64 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[21], 0x00000003u);
+        /* 02089A64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[21], 0x00000003u));
         /* 02089A68 */ cpu->r[4] = cpu->r[30];
-        /* 02089A6C */ _t2 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02089A6C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02089A6C */ _t3 = _t2 & 0x00000001u;
         /* 02089A6C */ if (_t3) goto L_02089A70; else goto L_02089A74;
   L_02089A70: ; // 0x2089a70
@@ -2027,9 +2027,9 @@ void Gambit_fn_02089A24(CPUState* cpu) {
         /* 02089A78 */ Gambit_fn_026D86C0(cpu);
         /* 02089A7C */ _t4 = cpu->r[29] + 0xFFFFEDBCu;
         /* 02089A7C */ cpu->r[9] = rbrew_read32(cpu->mem, _t4);
-        /* 02089A80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02089A80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02089A84 */ cpu->r[28] = cpu->r[3];
-        /* 02089A88 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089A88 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089A88 */ _t6 = _t5 & 0x00000001u;
         /* 02089A88 */ if (_t6) goto L_02089A8C; else goto L_02089A9C;
   L_02089A8C: ; // 0x2089a8c
@@ -2040,8 +2040,8 @@ void Gambit_fn_02089A24(CPUState* cpu) {
         /* 02089A98 */ _t8 = cpu->r[31] + 0xFFFFEE20u;
         /* 02089A98 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
   L_02089A9C: ; // 0x2089a9c
-        /* 02089A9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 02089AA0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089A9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 02089AA0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089AA0 */ _t10 = _t9 & 0x00000001u;
         /* 02089AA0 */ if (_t10) goto L_02089AC4; else goto L_02089AA4;
   L_02089AA4: ; // 0x2089aa4
@@ -2053,17 +2053,17 @@ void Gambit_fn_02089A24(CPUState* cpu) {
         /* 02089AB0 */ cpu->r[3] = cpu->r[28];
         /* 02089AB4 */ cpu->r[4] = cpu->r[31] + 0xFFFFEE20u;
         /* 02089AB8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02089ABC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02089AC0 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089ABC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02089AC0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089AC0 */ _t14 = _t13 & 0x00000001u;
         /* 02089AC0 */ if (_t14) goto L_02089AC4; else goto L_02089AC8;
   L_02089AC4: ; // 0x2089ac4
         /* 02089AC4 */ cpu->r[28] = 0x00000000u;
   L_02089AC8: ; // 0x2089ac8
-        /* 02089AC8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[21], 0x00000003u);
+        /* 02089AC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[21], 0x00000003u));
         /* 02089ACC */ _t15 = cpu->r[22] + 0x00000000u;
         /* 02089ACC */ rbrew_write32(cpu->mem, _t15, cpu->r[28]);
-        /* 02089AD0 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02089AD0 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02089AD0 */ _t17 = _t16 & 0x00000001u;
         /* 02089AD0 */ if (_t17) goto L_02089AD4; else goto L_02089B08;
   L_02089AD4: ; // 0x2089ad4
@@ -2073,15 +2073,15 @@ void Gambit_fn_02089A24(CPUState* cpu) {
         /* 02089ADC */ cpu->r[21] = cpu->r[21] + 0x00000001u;
         /* 02089AE0 */ cpu->r[25] = cpu->r[25] + 0x00000008u;
         /* 02089AE4 */ cpu->r[19] = cpu->r[19] + 0x00000004u;
-        /* 02089AE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000003u);
+        /* 02089AE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000003u));
         /* 02089AEC */ cpu->r[26] = cpu->r[26] + 0x00000004u;
         /* 02089AF0 */ cpu->r[20] = cpu->r[20] + 0x00000008u;
-        /* 02089AF4 */ _t19 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02089AF4 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02089AF4 */ _t20 = _t19 & 0x00000001u;
         /* 02089AF4 */ if (_t20) goto L_02089AF8; else goto L_02089B2C;
   L_02089AF8: ; // 0x2089af8
-        /* 02089AF8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[21], 0x00000003u);
-        /* 02089AFC */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02089AF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[21], 0x00000003u));
+        /* 02089AFC */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02089AFC */ _t22 = _t21 & 0x00000001u;
         /* 02089AFC */ if (_t22) goto L_02089A54; else goto L_02089B00;
   L_02089B00: ; // 0x2089b00
@@ -2094,10 +2094,10 @@ void Gambit_fn_02089A24(CPUState* cpu) {
         /* 02089B10 */ cpu->r[21] = cpu->r[21] + 0x00000001u;
         /* 02089B14 */ cpu->r[25] = cpu->r[25] + 0x00000008u;
         /* 02089B18 */ cpu->r[19] = cpu->r[19] + 0x00000004u;
-        /* 02089B1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000003u);
+        /* 02089B1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000003u));
         /* 02089B20 */ cpu->r[26] = cpu->r[26] + 0x00000004u;
         /* 02089B24 */ cpu->r[20] = cpu->r[20] + 0x00000008u;
-        /* 02089B28 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02089B28 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02089B28 */ _t25 = _t24 & 0x00000001u;
         /* 02089B28 */ if (_t25) goto L_02089AF8; else goto L_02089B2C;
   L_02089B2C: ; // 0x2089b2c
@@ -2279,13 +2279,13 @@ void Gambit_fn_02089BE4(CPUState* cpu) {
         /* 02089C38 */ cpu->r[5] = cpu->r[27];
         /* 02089C3C */ cpu->r[4] = cpu->r[29] + 0xFFFFD410u;
         /* 02089C40 */ cpu->r[3] = cpu->r[1] + 0x00000008u;
-        /* 02089C44 */ _t8 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02089C44 */ _t8 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02089C44 */ _t9 = _t8 & 0x00000001u;
         /* 02089C44 */ if (_t9) goto L_02089C48; // else: addr-0 trap, fall-through
   L_02089C48: ; // 0x2089c48
         /* 02089C48 */ Gambit_fn_0282A5F4(cpu);
-        /* 02089C4C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], 0x00000003u);
-        /* 02089C50 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02089C4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], 0x00000003u));
+        /* 02089C50 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02089C50 */ _t11 = _t10 & 0x00000001u;
         /* 02089C50 */ if (_t11) goto L_02089C54; else goto L_02089C7C;
   L_02089C54: ; // 0x2089c54
@@ -2294,12 +2294,12 @@ void Gambit_fn_02089BE4(CPUState* cpu) {
         /* 02089C5C */ cpu->r[4] = cpu->r[31];
         /* 02089C60 */ Gambit_fn_020A7150(cpu);
         /* 02089C64 */ cpu->r[25] = cpu->r[25] + 0xFFFFFFFFu;
-        /* 02089C64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 02089C64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 02089C68 */ cpu->r[27] = cpu->r[27] + 0x00000001u;
         /* 02089C6C */ _t12 = cpu->r[28] + cpu->r[26];
         /* 02089C6C */ rbrew_write32(cpu->mem, _t12, cpu->r[3]);
         /* 02089C70 */ cpu->r[26] = cpu->r[26] + 0x00000004u;
-        /* 02089C74 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089C74 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089C74 */ _t14 = _t13 & 0x00000001u;
         /* 02089C74 */ if (_t14) goto L_02089C78; else goto L_02089C38;
   L_02089C78: ; // 0x2089c78
@@ -2312,10 +2312,10 @@ void Gambit_fn_02089BE4(CPUState* cpu) {
         /* 02089C8C */ _t15 = cpu->r[28] + 0x00000000u;
         /* 02089C8C */ rbrew_write32(cpu->mem, _t15, cpu->r[3]);
         /* 02089C90 */ cpu->r[25] = cpu->r[25] + 0xFFFFFFFFu;
-        /* 02089C90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 02089C90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 02089C94 */ cpu->r[27] = cpu->r[27] + 0x00000001u;
         /* 02089C98 */ cpu->r[26] = cpu->r[26] + 0x00000004u;
-        /* 02089C9C */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089C9C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089C9C */ _t17 = _t16 & 0x00000001u;
         /* 02089C9C */ if (_t17) goto L_02089CA0; else goto L_02089C38;
   L_02089CA0: ; // 0x2089ca0
@@ -2509,15 +2509,15 @@ void Gambit_fn_02089D88(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02089D88: ; // 0x2089d88
-        /* 02089D88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02089D8C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089D88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02089D8C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089D8C */ _t1 = _t0 & 0x00000001u;
         /* 02089D8C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02089D8C */ goto L_02089D90;
   L_02089D90: ; // 0x2089d90
         /* 02089D90 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02089D90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02089D94 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089D90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02089D94 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089D94 */ _t3 = _t2 & 0x00000001u;
         /* 02089D94 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02089D94 */ goto L_02089D98;
@@ -2536,8 +2536,8 @@ void Gambit_fn_02089D88(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -2551,15 +2551,15 @@ void Gambit_fn_02089D88(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -2596,11 +2596,11 @@ void Gambit_fn_02089D9C(CPUState* cpu) {
         /* 02089DA8 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02089DA8 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02089DAC */ cpu->r[30] = cpu->r[3];
-        /* 02089DAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02089DAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02089DB0 */ cpu->r[31] = cpu->r[4];
         /* 02089DB4 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02089DB4 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02089DB8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089DB8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089DB8 */ _t5 = _t4 & 0x00000001u;
         /* 02089DB8 */ if (_t5) goto L_02089E28; else goto L_02089DBC;
   L_02089DBC: ; // 0x2089dbc
@@ -2614,10 +2614,10 @@ void Gambit_fn_02089D9C(CPUState* cpu) {
         /* 02089DD4 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02089DD4 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02089DD8 */ cpu->r[11] = cpu->r[11] + 0xFFFFD658u;
-        /* 02089DDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02089DDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02089DE0 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02089DE0 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02089DE4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089DE4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089DE4 */ _t10 = _t9 & 0x00000001u;
         /* 02089DE4 */ if (_t10) goto L_02089E18; else goto L_02089DE8;
   L_02089DE8: ; // 0x2089de8
@@ -2638,8 +2638,8 @@ void Gambit_fn_02089D9C(CPUState* cpu) {
         /* 02089E14 */ Gambit_fn_02068798(cpu);
   L_02089E18: ; // 0x2089e18
         /* 02089E18 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02089E18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02089E1C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089E18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02089E1C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089E1C */ _t15 = _t14 & 0x00000001u;
         /* 02089E1C */ if (_t15) goto L_02089E28; else goto L_02089E20;
   L_02089E20: ; // 0x2089e20
@@ -2670,11 +2670,11 @@ void Gambit_fn_02089DA0(CPUState* cpu) {
         /* 02089DA8 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02089DA8 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02089DAC */ cpu->r[30] = cpu->r[3];
-        /* 02089DAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02089DAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02089DB0 */ cpu->r[31] = cpu->r[4];
         /* 02089DB4 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02089DB4 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02089DB8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089DB8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089DB8 */ _t5 = _t4 & 0x00000001u;
         /* 02089DB8 */ if (_t5) goto L_02089E28; else goto L_02089DBC;
   L_02089DBC: ; // 0x2089dbc
@@ -2688,10 +2688,10 @@ void Gambit_fn_02089DA0(CPUState* cpu) {
         /* 02089DD4 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02089DD4 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02089DD8 */ cpu->r[11] = cpu->r[11] + 0xFFFFD658u;
-        /* 02089DDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02089DDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02089DE0 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02089DE0 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02089DE4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089DE4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089DE4 */ _t10 = _t9 & 0x00000001u;
         /* 02089DE4 */ if (_t10) goto L_02089E18; else goto L_02089DE8;
   L_02089DE8: ; // 0x2089de8
@@ -2712,8 +2712,8 @@ void Gambit_fn_02089DA0(CPUState* cpu) {
         /* 02089E14 */ Gambit_fn_02068798(cpu);
   L_02089E18: ; // 0x2089e18
         /* 02089E18 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02089E18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02089E1C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089E18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02089E1C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089E1C */ _t15 = _t14 & 0x00000001u;
         /* 02089E1C */ if (_t15) goto L_02089E28; else goto L_02089E20;
   L_02089E20: ; // 0x2089e20
@@ -2768,15 +2768,15 @@ void Gambit_fn_02089E58(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02089E58: ; // 0x2089e58
-        /* 02089E58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02089E5C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089E58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02089E5C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089E5C */ _t1 = _t0 & 0x00000001u;
         /* 02089E5C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02089E5C */ goto L_02089E60;
   L_02089E60: ; // 0x2089e60
         /* 02089E60 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02089E60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02089E64 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089E60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02089E64 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089E64 */ _t3 = _t2 & 0x00000001u;
         /* 02089E64 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02089E64 */ goto L_02089E68;
@@ -2795,8 +2795,8 @@ void Gambit_fn_02089E58(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -2810,15 +2810,15 @@ void Gambit_fn_02089E58(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -2873,11 +2873,11 @@ void Gambit_fn_02089E88(CPUState* cpu) {
         /* 02089E94 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02089E94 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02089E98 */ cpu->r[30] = cpu->r[3];
-        /* 02089E98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02089E98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02089E9C */ cpu->r[31] = cpu->r[4];
         /* 02089EA0 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02089EA0 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02089EA4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089EA4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089EA4 */ _t5 = _t4 & 0x00000001u;
         /* 02089EA4 */ if (_t5) goto L_02089ED8; else goto L_02089EA8;
   L_02089EA8: ; // 0x2089ea8
@@ -2890,8 +2890,8 @@ void Gambit_fn_02089E88(CPUState* cpu) {
         /* 02089EC0 */ cpu->r[5] = 0x00000008u;
         /* 02089EC4 */ Gambit_fn_02C82F38(cpu);
         /* 02089EC8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02089EC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02089ECC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089EC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02089ECC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089ECC */ _t7 = _t6 & 0x00000001u;
         /* 02089ECC */ if (_t7) goto L_02089ED8; else goto L_02089ED0;
   L_02089ED0: ; // 0x2089ed0
@@ -2922,11 +2922,11 @@ void Gambit_fn_02089E8C(CPUState* cpu) {
         /* 02089E94 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02089E94 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02089E98 */ cpu->r[30] = cpu->r[3];
-        /* 02089E98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02089E98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02089E9C */ cpu->r[31] = cpu->r[4];
         /* 02089EA0 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02089EA0 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02089EA4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089EA4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089EA4 */ _t5 = _t4 & 0x00000001u;
         /* 02089EA4 */ if (_t5) goto L_02089ED8; else goto L_02089EA8;
   L_02089EA8: ; // 0x2089ea8
@@ -2939,8 +2939,8 @@ void Gambit_fn_02089E8C(CPUState* cpu) {
         /* 02089EC0 */ cpu->r[5] = 0x00000008u;
         /* 02089EC4 */ Gambit_fn_02C82F38(cpu);
         /* 02089EC8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02089EC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02089ECC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089EC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02089ECC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089ECC */ _t7 = _t6 & 0x00000001u;
         /* 02089ECC */ if (_t7) goto L_02089ED8; else goto L_02089ED0;
   L_02089ED0: ; // 0x2089ed0
@@ -2963,15 +2963,15 @@ void Gambit_fn_02089EF0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02089EF0: ; // 0x2089ef0
-        /* 02089EF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02089EF4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089EF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02089EF4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089EF4 */ _t1 = _t0 & 0x00000001u;
         /* 02089EF4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02089EF4 */ goto L_02089EF8;
   L_02089EF8: ; // 0x2089ef8
         /* 02089EF8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02089EF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02089EFC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089EF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02089EFC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089EFC */ _t3 = _t2 & 0x00000001u;
         /* 02089EFC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02089EFC */ goto L_02089F00;
@@ -2990,8 +2990,8 @@ void Gambit_fn_02089EF0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -3005,15 +3005,15 @@ void Gambit_fn_02089EF0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -3041,15 +3041,15 @@ void Gambit_fn_02089F04(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02089F04: ; // 0x2089f04
-        /* 02089F04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02089F08 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089F04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02089F08 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089F08 */ _t1 = _t0 & 0x00000001u;
         /* 02089F08 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02089F08 */ goto L_02089F0C;
   L_02089F0C: ; // 0x2089f0c
         /* 02089F0C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02089F0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02089F10 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089F0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02089F10 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089F10 */ _t3 = _t2 & 0x00000001u;
         /* 02089F10 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02089F10 */ goto L_02089F14;
@@ -3068,8 +3068,8 @@ void Gambit_fn_02089F04(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -3083,15 +3083,15 @@ void Gambit_fn_02089F04(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -3197,9 +3197,9 @@ void Gambit_fn_02089F58(CPUState* cpu) {
         /* 02089F5C */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 02089F5C */ cpu->r[9] = _t0;
         /* 02089F60 */ cpu->r[12] = 0x101D0000u;
-        /* 02089F64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02089F64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02089F68 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 02089F6C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089F6C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089F6C */ _t2 = _t1 & 0x00000001u;
         /* 02089F6C */ if (_t2) goto L_02089F70; else goto L_02089F84;
   L_02089F70: ; // 0x2089f70
@@ -3211,8 +3211,8 @@ void Gambit_fn_02089F58(CPUState* cpu) {
         /* 02089F80 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 02089F80 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_02089F84: ; // 0x2089f84
-        /* 02089F84 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02089F88 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089F84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02089F88 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089F88 */ _t6 = _t5 & 0x00000001u;
         /* 02089F88 */ if (_t6) goto L_02089F8C; else goto L_02089F94;
   L_02089F8C: ; // 0x2089f8c
@@ -3224,9 +3224,9 @@ void Gambit_fn_02089F58(CPUState* cpu) {
         /* 02089F98 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 02089F98 */ cpu->r[7] = _t7;
         /* 02089F9C */ cpu->r[11] = 0x101D0000u;
-        /* 02089FA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02089FA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02089FA4 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 02089FA8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02089FA8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02089FA8 */ _t9 = _t8 & 0x00000001u;
         /* 02089FA8 */ if (_t9) goto L_02089FAC; else goto L_02089FC0;
   L_02089FAC: ; // 0x2089fac
@@ -3320,18 +3320,18 @@ void Gambit_fn_02089FFC(CPUState* cpu) {
         /* 0208A0DC */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0208A0DC */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0208A0E0 */ cpu->r[12] = 0x00000000u;
-        /* 0208A0E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208A0E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208A0E8 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0208A0E8 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0208A0EC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A0EC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A0EC */ _t6 = _t5 & 0x00000001u;
         /* 0208A0EC */ if (_t6) goto L_0208A114; else goto L_0208A0F0;
   L_0208A0F0: ; // 0x208a0f0
         /* 0208A0F0 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0208A0F0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0208A0F4 */ /* nop */
-        /* 0208A0F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0208A0FC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A0F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0208A0FC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A0FC */ _t9 = _t8 & 0x00000001u;
         /* 0208A0FC */ if (_t9) goto L_0208A100; else goto L_0208A114;
   L_0208A100: ; // 0x208a100
@@ -3424,10 +3424,10 @@ void Gambit_fn_0208A040(CPUState* cpu) {
         /* 0208A048 */ _t1 = cpu->r[3] + 0x00000028u;
         /* 0208A048 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 0208A04C */ cpu->r[8] = cpu->r[0];
-        /* 0208A050 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 0208A050 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 0208A054 */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 0208A054 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0208A058 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208A058 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208A058 */ _t4 = _t3 & 0x00000001u;
         /* 0208A058 */ if (_t4) goto L_0208A05C; else goto L_0208A074;
   L_0208A05C: ; // 0x208a05c
@@ -3435,8 +3435,8 @@ void Gambit_fn_0208A040(CPUState* cpu) {
         /* 0208A060 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 0208A064 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0208A064 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0208A068 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0208A06C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A068 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0208A06C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A06C */ _t7 = _t6 & 0x00000001u;
         /* 0208A06C */ if (_t7) goto L_0208A070; else goto L_0208A080;
   L_0208A070: ; // 0x208a070
@@ -3444,16 +3444,16 @@ void Gambit_fn_0208A040(CPUState* cpu) {
   L_0208A074: ; // 0x208a074
         /* 0208A074 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0208A074 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0208A078 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0208A07C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A078 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0208A07C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A07C */ _t10 = _t9 & 0x00000001u;
         /* 0208A07C */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208A07C */ goto L_0208A080;
   L_0208A080: ; // 0x208a080
-        /* 0208A080 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 0208A080 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 0208A084 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0208A084 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 0208A088 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208A088 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208A088 */ _t13 = _t12 & 0x00000001u;
         /* 0208A088 */ if (_t13) goto L_0208A08C; else goto L_0208A094;
   L_0208A08C: ; // 0x208a08c
@@ -3464,11 +3464,11 @@ void Gambit_fn_0208A040(CPUState* cpu) {
         /* 0208A094 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0208A098 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0208A098 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0208A09C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208A09C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208A0A0 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0208A0A0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0208A0A4 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 0208A0A8 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208A0A8 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208A0A8 */ _t18 = _t17 & 0x00000001u;
         /* 0208A0A8 */ if (_t18) goto L_0208A0C0; else goto L_0208A0AC;
   L_0208A0AC: ; // 0x208a0ac
@@ -3501,18 +3501,18 @@ void Gambit_fn_0208A0C8(CPUState* cpu) {
         /* 0208A0DC */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0208A0DC */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0208A0E0 */ cpu->r[12] = 0x00000000u;
-        /* 0208A0E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208A0E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208A0E8 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0208A0E8 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0208A0EC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A0EC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A0EC */ _t6 = _t5 & 0x00000001u;
         /* 0208A0EC */ if (_t6) goto L_0208A114; else goto L_0208A0F0;
   L_0208A0F0: ; // 0x208a0f0
         /* 0208A0F0 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0208A0F0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0208A0F4 */ /* nop */
-        /* 0208A0F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0208A0FC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A0F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0208A0FC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A0FC */ _t9 = _t8 & 0x00000001u;
         /* 0208A0FC */ if (_t9) goto L_0208A100; else goto L_0208A114;
   L_0208A100: ; // 0x208a100
@@ -3553,18 +3553,18 @@ void Gambit_fn_0208A0CC(CPUState* cpu) {
         /* 0208A0DC */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0208A0DC */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0208A0E0 */ cpu->r[12] = 0x00000000u;
-        /* 0208A0E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208A0E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208A0E8 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0208A0E8 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0208A0EC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A0EC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A0EC */ _t6 = _t5 & 0x00000001u;
         /* 0208A0EC */ if (_t6) goto L_0208A114; else goto L_0208A0F0;
   L_0208A0F0: ; // 0x208a0f0
         /* 0208A0F0 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0208A0F0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0208A0F4 */ /* nop */
-        /* 0208A0F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0208A0FC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A0F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0208A0FC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A0FC */ _t9 = _t8 & 0x00000001u;
         /* 0208A0FC */ if (_t9) goto L_0208A100; else goto L_0208A114;
   L_0208A100: ; // 0x208a100
@@ -3600,10 +3600,10 @@ void Gambit_fn_0208A138(CPUState* cpu) {
         /* 0208A140 */ _t1 = cpu->r[3] + 0x00000020u;
         /* 0208A140 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 0208A144 */ cpu->r[8] = cpu->r[0];
-        /* 0208A148 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 0208A148 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 0208A14C */ _t2 = cpu->r[3] + 0x00000024u;
         /* 0208A14C */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0208A150 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208A150 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208A150 */ _t4 = _t3 & 0x00000001u;
         /* 0208A150 */ if (_t4) goto L_0208A154; else goto L_0208A16C;
   L_0208A154: ; // 0x208a154
@@ -3611,8 +3611,8 @@ void Gambit_fn_0208A138(CPUState* cpu) {
         /* 0208A158 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 0208A15C */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0208A15C */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0208A160 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0208A164 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A160 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0208A164 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A164 */ _t7 = _t6 & 0x00000001u;
         /* 0208A164 */ if (_t7) goto L_0208A168; else goto L_0208A178;
   L_0208A168: ; // 0x208a168
@@ -3620,16 +3620,16 @@ void Gambit_fn_0208A138(CPUState* cpu) {
   L_0208A16C: ; // 0x208a16c
         /* 0208A16C */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0208A16C */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0208A170 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0208A174 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A170 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0208A174 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A174 */ _t10 = _t9 & 0x00000001u;
         /* 0208A174 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208A174 */ goto L_0208A178;
   L_0208A178: ; // 0x208a178
-        /* 0208A178 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 0208A178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 0208A17C */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0208A17C */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 0208A180 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208A180 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208A180 */ _t13 = _t12 & 0x00000001u;
         /* 0208A180 */ if (_t13) goto L_0208A184; else goto L_0208A18C;
   L_0208A184: ; // 0x208a184
@@ -3640,11 +3640,11 @@ void Gambit_fn_0208A138(CPUState* cpu) {
         /* 0208A18C */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0208A190 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0208A190 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0208A194 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208A194 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208A198 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0208A198 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0208A19C */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 0208A1A0 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208A1A0 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208A1A0 */ _t18 = _t17 & 0x00000001u;
         /* 0208A1A0 */ if (_t18) goto L_0208A1B8; else goto L_0208A1A4;
   L_0208A1A4: ; // 0x208a1a4
@@ -3671,10 +3671,10 @@ void Gambit_fn_0208A1C0(CPUState* cpu) {
         /* 0208A1C8 */ _t1 = cpu->r[3] + 0x00000030u;
         /* 0208A1C8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 0208A1CC */ cpu->r[7] = cpu->r[0];
-        /* 0208A1D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 0208A1D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 0208A1D4 */ _t2 = cpu->r[3] + 0x00000034u;
         /* 0208A1D4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0208A1D8 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208A1D8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208A1D8 */ _t4 = _t3 & 0x00000001u;
         /* 0208A1D8 */ if (_t4) goto L_0208A1DC; else goto L_0208A1F4;
   L_0208A1DC: ; // 0x208a1dc
@@ -3682,8 +3682,8 @@ void Gambit_fn_0208A1C0(CPUState* cpu) {
         /* 0208A1E0 */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 0208A1E4 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0208A1E4 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0208A1E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0208A1EC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A1E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0208A1EC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A1EC */ _t7 = _t6 & 0x00000001u;
         /* 0208A1EC */ if (_t7) goto L_0208A1F0; else goto L_0208A200;
   L_0208A1F0: ; // 0x208a1f0
@@ -3691,16 +3691,16 @@ void Gambit_fn_0208A1C0(CPUState* cpu) {
   L_0208A1F4: ; // 0x208a1f4
         /* 0208A1F4 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0208A1F4 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0208A1F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0208A1FC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A1F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0208A1FC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A1FC */ _t10 = _t9 & 0x00000001u;
         /* 0208A1FC */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208A1FC */ goto L_0208A200;
   L_0208A200: ; // 0x208a200
-        /* 0208A200 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 0208A200 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 0208A204 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0208A204 */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 0208A208 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208A208 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208A208 */ _t13 = _t12 & 0x00000001u;
         /* 0208A208 */ if (_t13) goto L_0208A20C; else goto L_0208A214;
   L_0208A20C: ; // 0x208a20c
@@ -3711,11 +3711,11 @@ void Gambit_fn_0208A1C0(CPUState* cpu) {
         /* 0208A214 */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0208A218 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0208A218 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0208A21C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0208A21C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0208A220 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0208A220 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0208A224 */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 0208A228 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208A228 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208A228 */ _t18 = _t17 & 0x00000001u;
         /* 0208A228 */ if (_t18) goto L_0208A240; else goto L_0208A22C;
   L_0208A22C: ; // 0x208a22c
@@ -3750,9 +3750,9 @@ void Gambit_fn_0208A248(CPUState* cpu) {
         /* 0208A260 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 0208A260 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 0208A264 */ /* nop */
-        /* 0208A268 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 0208A268 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 0208A26C */ cpu->r[31] = cpu->r[4];
-        /* 0208A270 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A270 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A270 */ _t6 = _t5 & 0x00000001u;
         /* 0208A270 */ if (_t6) goto L_0208A274; else goto L_0208A288;
   L_0208A274: ; // 0x208a274
@@ -3801,9 +3801,9 @@ void Gambit_fn_0208A24C(CPUState* cpu) {
         /* 0208A260 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 0208A260 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 0208A264 */ /* nop */
-        /* 0208A268 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 0208A268 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 0208A26C */ cpu->r[31] = cpu->r[4];
-        /* 0208A270 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A270 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A270 */ _t6 = _t5 & 0x00000001u;
         /* 0208A270 */ if (_t6) goto L_0208A274; else goto L_0208A288;
   L_0208A274: ; // 0x208a274
@@ -3867,8 +3867,8 @@ void Gambit_fn_0208A2C0(CPUState* cpu) {
         /* 0208A30C */ Gambit_fn_026D6F40(cpu);
         /* 0208A310 */ cpu->r[3] = 0x00000238u;
         /* 0208A314 */ Gambit_fn_02801A78(cpu);
-        /* 0208A318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208A31C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208A31C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A31C */ _t6 = _t5 & 0x00000001u;
         /* 0208A31C */ if (_t6) goto L_0208A324; else goto L_0208A320;
   L_0208A320: ; // 0x208a320
@@ -3885,8 +3885,8 @@ void Gambit_fn_0208A2C0(CPUState* cpu) {
         /* 0208A338 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208A33C */ cpu->r[3] = 0x00000244u;
         /* 0208A340 */ Gambit_fn_02801A78(cpu);
-        /* 0208A344 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208A348 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A344 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208A348 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A348 */ _t11 = _t10 & 0x00000001u;
         /* 0208A348 */ if (_t11) goto L_0208A350; else goto L_0208A34C;
   L_0208A34C: ; // 0x208a34c
@@ -3907,23 +3907,23 @@ void Gambit_fn_0208A2C0(CPUState* cpu) {
   L_0208A374: ; // 0x208a374
         /* 0208A374 */ _t15 = cpu->r[31] + 0x00000028u;
         /* 0208A374 */ cpu->r[7] = rbrew_read32(cpu->mem, _t15);
-        /* 0208A378 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000003u);
+        /* 0208A378 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000003u));
         /* 0208A37C */ cpu->r[0] = cpu->r[9];
         /* 0208A380 */ _t16 = cpu->r[31] + 0x0000002Cu;
         /* 0208A380 */ cpu->r[8] = rbrew_read32(cpu->mem, _t16);
         /* 0208A384 */ cpu->r[11] = cpu->r[7] + 0x00000218u;
-        /* 0208A388 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208A388 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208A388 */ _t18 = _t17 & 0x00000001u;
         /* 0208A388 */ if (_t18) goto L_0208A38C; else goto L_0208A394;
   L_0208A38C: ; // 0x208a38c
         /* 0208A38C */ cpu->r[12] = rbrew_rlwinm(cpu->r[9], 0x00000002u, 0x00000000u, 0x0000001Du);
         /* 0208A390 */ cpu->r[11] = cpu->r[11] + cpu->r[12];
   L_0208A394: ; // 0x208a394
-        /* 0208A394 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 0208A394 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 0208A398 */ cpu->r[12] = cpu->r[8] + 0x00000228u;
         /* 0208A39C */ _t19 = cpu->r[11] + 0x00000000u;
         /* 0208A39C */ cpu->r[10] = rbrew_read32(cpu->mem, _t19);
-        /* 0208A3A0 */ _t20 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208A3A0 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208A3A0 */ _t21 = _t20 & 0x00000001u;
         /* 0208A3A0 */ if (_t21) goto L_0208A3A4; else goto L_0208A3AC;
   L_0208A3A4: ; // 0x208a3a4
@@ -3980,8 +3980,8 @@ void Gambit_fn_0208A2C4(CPUState* cpu) {
         /* 0208A30C */ Gambit_fn_026D6F40(cpu);
         /* 0208A310 */ cpu->r[3] = 0x00000238u;
         /* 0208A314 */ Gambit_fn_02801A78(cpu);
-        /* 0208A318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208A31C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208A31C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A31C */ _t6 = _t5 & 0x00000001u;
         /* 0208A31C */ if (_t6) goto L_0208A324; else goto L_0208A320;
   L_0208A320: ; // 0x208a320
@@ -3998,8 +3998,8 @@ void Gambit_fn_0208A2C4(CPUState* cpu) {
         /* 0208A338 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208A33C */ cpu->r[3] = 0x00000244u;
         /* 0208A340 */ Gambit_fn_02801A78(cpu);
-        /* 0208A344 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208A348 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A344 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208A348 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A348 */ _t11 = _t10 & 0x00000001u;
         /* 0208A348 */ if (_t11) goto L_0208A350; else goto L_0208A34C;
   L_0208A34C: ; // 0x208a34c
@@ -4020,23 +4020,23 @@ void Gambit_fn_0208A2C4(CPUState* cpu) {
   L_0208A374: ; // 0x208a374
         /* 0208A374 */ _t15 = cpu->r[31] + 0x00000028u;
         /* 0208A374 */ cpu->r[7] = rbrew_read32(cpu->mem, _t15);
-        /* 0208A378 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000003u);
+        /* 0208A378 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000003u));
         /* 0208A37C */ cpu->r[0] = cpu->r[9];
         /* 0208A380 */ _t16 = cpu->r[31] + 0x0000002Cu;
         /* 0208A380 */ cpu->r[8] = rbrew_read32(cpu->mem, _t16);
         /* 0208A384 */ cpu->r[11] = cpu->r[7] + 0x00000218u;
-        /* 0208A388 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208A388 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208A388 */ _t18 = _t17 & 0x00000001u;
         /* 0208A388 */ if (_t18) goto L_0208A38C; else goto L_0208A394;
   L_0208A38C: ; // 0x208a38c
         /* 0208A38C */ cpu->r[12] = rbrew_rlwinm(cpu->r[9], 0x00000002u, 0x00000000u, 0x0000001Du);
         /* 0208A390 */ cpu->r[11] = cpu->r[11] + cpu->r[12];
   L_0208A394: ; // 0x208a394
-        /* 0208A394 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 0208A394 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 0208A398 */ cpu->r[12] = cpu->r[8] + 0x00000228u;
         /* 0208A39C */ _t19 = cpu->r[11] + 0x00000000u;
         /* 0208A39C */ cpu->r[10] = rbrew_read32(cpu->mem, _t19);
-        /* 0208A3A0 */ _t20 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208A3A0 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208A3A0 */ _t21 = _t20 & 0x00000001u;
         /* 0208A3A0 */ if (_t21) goto L_0208A3A4; else goto L_0208A3AC;
   L_0208A3A4: ; // 0x208a3a4
@@ -4094,8 +4094,8 @@ void Gambit_fn_0208A3CC(CPUState* cpu) {
         /* 0208A30C */ Gambit_fn_026D6F40(cpu);
         /* 0208A310 */ cpu->r[3] = 0x00000238u;
         /* 0208A314 */ Gambit_fn_02801A78(cpu);
-        /* 0208A318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208A31C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208A31C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A31C */ _t6 = _t5 & 0x00000001u;
         /* 0208A31C */ if (_t6) goto L_0208A324; else goto L_0208A320;
   L_0208A320: ; // 0x208a320
@@ -4112,8 +4112,8 @@ void Gambit_fn_0208A3CC(CPUState* cpu) {
         /* 0208A338 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208A33C */ cpu->r[3] = 0x00000244u;
         /* 0208A340 */ Gambit_fn_02801A78(cpu);
-        /* 0208A344 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208A348 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A344 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208A348 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A348 */ _t11 = _t10 & 0x00000001u;
         /* 0208A348 */ if (_t11) goto L_0208A350; else goto L_0208A34C;
   L_0208A34C: ; // 0x208a34c
@@ -4134,23 +4134,23 @@ void Gambit_fn_0208A3CC(CPUState* cpu) {
   L_0208A374: ; // 0x208a374
         /* 0208A374 */ _t15 = cpu->r[31] + 0x00000028u;
         /* 0208A374 */ cpu->r[7] = rbrew_read32(cpu->mem, _t15);
-        /* 0208A378 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000003u);
+        /* 0208A378 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000003u));
         /* 0208A37C */ cpu->r[0] = cpu->r[9];
         /* 0208A380 */ _t16 = cpu->r[31] + 0x0000002Cu;
         /* 0208A380 */ cpu->r[8] = rbrew_read32(cpu->mem, _t16);
         /* 0208A384 */ cpu->r[11] = cpu->r[7] + 0x00000218u;
-        /* 0208A388 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208A388 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208A388 */ _t18 = _t17 & 0x00000001u;
         /* 0208A388 */ if (_t18) goto L_0208A38C; else goto L_0208A394;
   L_0208A38C: ; // 0x208a38c
         /* 0208A38C */ cpu->r[12] = rbrew_rlwinm(cpu->r[9], 0x00000002u, 0x00000000u, 0x0000001Du);
         /* 0208A390 */ cpu->r[11] = cpu->r[11] + cpu->r[12];
   L_0208A394: ; // 0x208a394
-        /* 0208A394 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 0208A394 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 0208A398 */ cpu->r[12] = cpu->r[8] + 0x00000228u;
         /* 0208A39C */ _t19 = cpu->r[11] + 0x00000000u;
         /* 0208A39C */ cpu->r[10] = rbrew_read32(cpu->mem, _t19);
-        /* 0208A3A0 */ _t20 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208A3A0 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208A3A0 */ _t21 = _t20 & 0x00000001u;
         /* 0208A3A0 */ if (_t21) goto L_0208A3A4; else goto L_0208A3AC;
   L_0208A3A4: ; // 0x208a3a4
@@ -4286,19 +4286,19 @@ void Gambit_fn_0208A41C(CPUState* cpu) {
         /* 0208A428 */ _t2 = cpu->r[1] + 0x0000000Cu;
         /* 0208A428 */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
         /* 0208A42C */ cpu->r[31] = cpu->r[3];
-        /* 0208A42C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0208A42C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0208A430 */ cpu->r[30] = cpu->r[4];
         /* 0208A434 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0208A434 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0208A438 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A438 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A438 */ _t5 = _t4 & 0x00000001u;
         /* 0208A438 */ if (_t5) goto L_0208A43C; else goto L_0208A44C;
   L_0208A43C: ; // 0x208a43c
         /* 0208A43C */ cpu->r[3] = 0x00000034u;
         /* 0208A440 */ Gambit_fn_02801A78(cpu);
         /* 0208A444 */ cpu->r[31] = cpu->r[3];
-        /* 0208A444 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0208A448 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A444 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0208A448 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A448 */ _t7 = _t6 & 0x00000001u;
         /* 0208A448 */ if (_t7) goto L_0208A498; else goto L_0208A44C;
   L_0208A44C: ; // 0x208a44c
@@ -4354,19 +4354,19 @@ void Gambit_fn_0208A420(CPUState* cpu) {
         /* 0208A428 */ _t2 = cpu->r[1] + 0x0000000Cu;
         /* 0208A428 */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
         /* 0208A42C */ cpu->r[31] = cpu->r[3];
-        /* 0208A42C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0208A42C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0208A430 */ cpu->r[30] = cpu->r[4];
         /* 0208A434 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0208A434 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0208A438 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A438 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A438 */ _t5 = _t4 & 0x00000001u;
         /* 0208A438 */ if (_t5) goto L_0208A43C; else goto L_0208A44C;
   L_0208A43C: ; // 0x208a43c
         /* 0208A43C */ cpu->r[3] = 0x00000034u;
         /* 0208A440 */ Gambit_fn_02801A78(cpu);
         /* 0208A444 */ cpu->r[31] = cpu->r[3];
-        /* 0208A444 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0208A448 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A444 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0208A448 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A448 */ _t7 = _t6 & 0x00000001u;
         /* 0208A448 */ if (_t7) goto L_0208A498; else goto L_0208A44C;
   L_0208A44C: ; // 0x208a44c
@@ -4459,14 +4459,14 @@ void Gambit_fn_0208A4CC(CPUState* cpu) {
         /* 0208A510 */ _t9 = cpu->r[29] + 0x00000030u;
         /* 0208A510 */ cpu->r[0] = rbrew_read8(cpu->mem, _t9);
         /* 0208A514 */ cpu->r[4] = 0x00000018u;
-        /* 0208A518 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208A518 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208A51C */ cpu->r[5] = 0x00000001u;
-        /* 0208A520 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A520 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A520 */ _t11 = _t10 & 0x00000001u;
         /* 0208A520 */ if (_t11) goto L_0208A5B4; else goto L_0208A524;
   L_0208A524: ; // 0x208a524
-        /* 0208A524 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0208A528 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0208A528 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A528 */ _t13 = _t12 & 0x00000001u;
         /* 0208A528 */ if (_t13) goto L_0208A52C; else goto L_0208A570;
   L_0208A52C: ; // 0x208a52c
@@ -4492,8 +4492,8 @@ void Gambit_fn_0208A4CC(CPUState* cpu) {
         /* 0208A55C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208A560 */ _t21 = cpu->r[29] + 0x00000030u;
         /* 0208A560 */ cpu->r[11] = rbrew_read8(cpu->mem, _t21);
-        /* 0208A564 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0208A568 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A564 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0208A568 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A568 */ _t23 = _t22 & 0x00000001u;
         /* 0208A568 */ if (_t23) goto L_0208A608; else goto L_0208A56C;
   L_0208A56C: ; // 0x208a56c
@@ -4521,8 +4521,8 @@ void Gambit_fn_0208A4CC(CPUState* cpu) {
         /* 0208A5A0 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208A5A4 */ _t31 = cpu->r[29] + 0x00000030u;
         /* 0208A5A4 */ cpu->r[11] = rbrew_read8(cpu->mem, _t31);
-        /* 0208A5A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0208A5AC */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A5A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0208A5AC */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A5AC */ _t33 = _t32 & 0x00000001u;
         /* 0208A5AC */ if (_t33) goto L_0208A608; else goto L_0208A5B0;
   L_0208A5B0: ; // 0x208a5b0
@@ -4550,8 +4550,8 @@ void Gambit_fn_0208A4CC(CPUState* cpu) {
         /* 0208A5E4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208A5E8 */ _t41 = cpu->r[29] + 0x00000030u;
         /* 0208A5E8 */ cpu->r[11] = rbrew_read8(cpu->mem, _t41);
-        /* 0208A5EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0208A5F0 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A5EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0208A5F0 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A5F0 */ _t43 = _t42 & 0x00000001u;
         /* 0208A5F0 */ if (_t43) goto L_0208A608; else goto L_0208A5F4;
   L_0208A5F4: ; // 0x208a5f4
@@ -4611,14 +4611,14 @@ void Gambit_fn_0208A4D0(CPUState* cpu) {
         /* 0208A510 */ _t9 = cpu->r[29] + 0x00000030u;
         /* 0208A510 */ cpu->r[0] = rbrew_read8(cpu->mem, _t9);
         /* 0208A514 */ cpu->r[4] = 0x00000018u;
-        /* 0208A518 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208A518 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208A51C */ cpu->r[5] = 0x00000001u;
-        /* 0208A520 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A520 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A520 */ _t11 = _t10 & 0x00000001u;
         /* 0208A520 */ if (_t11) goto L_0208A5B4; else goto L_0208A524;
   L_0208A524: ; // 0x208a524
-        /* 0208A524 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0208A528 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0208A528 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A528 */ _t13 = _t12 & 0x00000001u;
         /* 0208A528 */ if (_t13) goto L_0208A52C; else goto L_0208A570;
   L_0208A52C: ; // 0x208a52c
@@ -4644,8 +4644,8 @@ void Gambit_fn_0208A4D0(CPUState* cpu) {
         /* 0208A55C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208A560 */ _t21 = cpu->r[29] + 0x00000030u;
         /* 0208A560 */ cpu->r[11] = rbrew_read8(cpu->mem, _t21);
-        /* 0208A564 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0208A568 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A564 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0208A568 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A568 */ _t23 = _t22 & 0x00000001u;
         /* 0208A568 */ if (_t23) goto L_0208A608; else goto L_0208A56C;
   L_0208A56C: ; // 0x208a56c
@@ -4673,8 +4673,8 @@ void Gambit_fn_0208A4D0(CPUState* cpu) {
         /* 0208A5A0 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208A5A4 */ _t31 = cpu->r[29] + 0x00000030u;
         /* 0208A5A4 */ cpu->r[11] = rbrew_read8(cpu->mem, _t31);
-        /* 0208A5A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0208A5AC */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A5A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0208A5AC */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A5AC */ _t33 = _t32 & 0x00000001u;
         /* 0208A5AC */ if (_t33) goto L_0208A608; else goto L_0208A5B0;
   L_0208A5B0: ; // 0x208a5b0
@@ -4702,8 +4702,8 @@ void Gambit_fn_0208A4D0(CPUState* cpu) {
         /* 0208A5E4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208A5E8 */ _t41 = cpu->r[29] + 0x00000030u;
         /* 0208A5E8 */ cpu->r[11] = rbrew_read8(cpu->mem, _t41);
-        /* 0208A5EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0208A5F0 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A5EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0208A5F0 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A5F0 */ _t43 = _t42 & 0x00000001u;
         /* 0208A5F0 */ if (_t43) goto L_0208A608; else goto L_0208A5F4;
   L_0208A5F4: ; // 0x208a5f4
@@ -4762,8 +4762,8 @@ void Gambit_fn_0208A638(CPUState* cpu) {
         /* 0208A650 */ _t3 = cpu->r[3] + 0x00003400u;
         /* 0208A650 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0208A654 */ Gambit_fn_0206C030(cpu);
-        /* 0208A658 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208A65C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A658 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208A65C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A65C */ _t5 = _t4 & 0x00000001u;
         /* 0208A65C */ if (_t5) goto L_0208A668; else goto L_0208A660;
   L_0208A660: ; // 0x208a660
@@ -4780,8 +4780,8 @@ void Gambit_fn_0208A638(CPUState* cpu) {
         /* 0208A678 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208A67C */ _t9 = cpu->r[31] + 0x00000030u;
         /* 0208A67C */ cpu->r[0] = rbrew_read8(cpu->mem, _t9);
-        /* 0208A680 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208A684 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A680 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208A684 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A684 */ _t11 = _t10 & 0x00000001u;
         /* 0208A684 */ if (_t11) goto L_0208A69C; else goto L_0208A688;
   L_0208A688: ; // 0x208a688
@@ -4820,8 +4820,8 @@ void Gambit_fn_0208A63C(CPUState* cpu) {
         /* 0208A650 */ _t3 = cpu->r[3] + 0x00003400u;
         /* 0208A650 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0208A654 */ Gambit_fn_0206C030(cpu);
-        /* 0208A658 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208A65C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A658 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208A65C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A65C */ _t5 = _t4 & 0x00000001u;
         /* 0208A65C */ if (_t5) goto L_0208A668; else goto L_0208A660;
   L_0208A660: ; // 0x208a660
@@ -4838,8 +4838,8 @@ void Gambit_fn_0208A63C(CPUState* cpu) {
         /* 0208A678 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208A67C */ _t9 = cpu->r[31] + 0x00000030u;
         /* 0208A67C */ cpu->r[0] = rbrew_read8(cpu->mem, _t9);
-        /* 0208A680 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208A684 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A680 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208A684 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A684 */ _t11 = _t10 & 0x00000001u;
         /* 0208A684 */ if (_t11) goto L_0208A69C; else goto L_0208A688;
   L_0208A688: ; // 0x208a688
@@ -5157,11 +5157,11 @@ void Gambit_fn_0208A7C0(CPUState* cpu) {
         /* 0208B894 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0208B894 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0208B898 */ cpu->r[30] = cpu->r[3];
-        /* 0208B898 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0208B898 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0208B89C */ cpu->r[31] = cpu->r[4];
         /* 0208B8A0 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0208B8A0 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0208B8A4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B8A4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B8A4 */ _t5 = _t4 & 0x00000001u;
         /* 0208B8A4 */ if (_t5) goto L_0208B8E8; else goto L_0208B8A8;
   L_0208B8A8: ; // 0x208b8a8
@@ -5181,8 +5181,8 @@ void Gambit_fn_0208A7C0(CPUState* cpu) {
         /* 0208B8D0 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 0208B8D4 */ Gambit_fn_02068798(cpu);
         /* 0208B8D8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0208B8D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208B8DC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B8D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208B8DC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B8DC */ _t10 = _t9 & 0x00000001u;
         /* 0208B8DC */ if (_t10) goto L_0208B8E8; else goto L_0208B8E0;
   L_0208B8E0: ; // 0x208b8e0
@@ -5210,8 +5210,8 @@ void Gambit_fn_0208A7C8(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -5263,16 +5263,16 @@ void Gambit_fn_0208A7E0(CPUState* cpu) {
         /* 0208A7E8 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 0208A7EC */ /* nop */
         /* 0208A7F0 */ cpu->r[29] = cpu->r[3];
-        /* 0208A7F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0208A7F4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A7F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0208A7F4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A7F4 */ _t3 = _t2 & 0x00000001u;
         /* 0208A7F4 */ if (_t3) goto L_0208A7F8; else goto L_0208A808;
   L_0208A7F8: ; // 0x208a7f8
         /* 0208A7F8 */ cpu->r[3] = 0x00000230u;
         /* 0208A7FC */ Gambit_fn_02801A78(cpu);
         /* 0208A800 */ cpu->r[29] = cpu->r[3];
-        /* 0208A800 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0208A804 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A800 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0208A804 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A804 */ _t5 = _t4 & 0x00000001u;
         /* 0208A804 */ if (_t5) goto L_0208AFF8; else goto L_0208A808;
   L_0208A808: ; // 0x208a808
@@ -5300,7 +5300,7 @@ void Gambit_fn_0208A7E0(CPUState* cpu) {
         /* 0208A850 */ _t9 = cpu->r[29] + 0x0000000Cu;
         /* 0208A850 */ rbrew_write32(cpu->mem, _t9, cpu->r[10]);
         /* 0208A854 */ cpu->r[27] = cpu->r[29] + 0x000001DCu;
-        /* 0208A854 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0208A854 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0208A858 */ cpu->r[12] = cpu->r[12] + 0xFFFFDB64u;
         /* 0208A85C */ _t10 = cpu->r[29] + 0x0000001Cu;
         /* 0208A85C */ rbrew_write32(cpu->mem, _t10, cpu->r[11]);
@@ -5308,15 +5308,15 @@ void Gambit_fn_0208A7E0(CPUState* cpu) {
         /* 0208A864 */ cpu->r[28] = 0x00000000u;
         /* 0208A868 */ _t11 = cpu->r[29] + 0x000001C8u;
         /* 0208A868 */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
-        /* 0208A86C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A86C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A86C */ _t13 = _t12 & 0x00000001u;
         /* 0208A86C */ if (_t13) goto L_0208A870; else goto L_0208A880;
   L_0208A870: ; // 0x208a870
         /* 0208A870 */ cpu->r[3] = 0x00000038u;
         /* 0208A874 */ Gambit_fn_02801A78(cpu);
         /* 0208A878 */ cpu->r[31] = cpu->r[3];
-        /* 0208A878 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0208A87C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A878 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0208A87C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A87C */ _t15 = _t14 & 0x00000001u;
         /* 0208A87C */ if (_t15) goto L_0208A8B0; else goto L_0208A880;
   L_0208A880: ; // 0x208a880
@@ -5385,23 +5385,23 @@ void Gambit_fn_0208A7E0(CPUState* cpu) {
         /* 0208A924 */ _t36 = cpu->r[7] + 0x00000000u;
         /* 0208A924 */ cpu->r[5] = rbrew_read8(cpu->mem, _t36);
         /* 0208A928 */ cpu->r[31] = 0x00000000u;
-        /* 0208A92C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[26]);
+        /* 0208A92C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[26]));
         /* 0208A930 */ cpu->r[8] = 0x00080000u;
-        /* 0208A934 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A934 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A934 */ _t38 = _t37 & 0x00000001u;
         /* 0208A934 */ if (_t38) goto L_0208A95C; else goto L_0208A938;
   L_0208A938: ; // 0x208a938
         /* 0208A938 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208A93C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[8]);
+        /* 0208A93C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[8]));
         /* 0208A940 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 0208A944 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208A944 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208A944 */ _t40 = _t39 & 0x00000001u;
         /* 0208A944 */ if (_t40) goto L_0208A958; else goto L_0208A948;
   L_0208A948: ; // 0x208a948
         /* 0208A948 */ _t41 = cpu->r[7] + 0x00000000u;
         /* 0208A948 */ cpu->r[6] = rbrew_read8(cpu->mem, _t41);
-        /* 0208A94C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[26]);
-        /* 0208A950 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A94C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[26]));
+        /* 0208A950 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A950 */ _t43 = _t42 & 0x00000001u;
         /* 0208A950 */ if (_t43) goto L_0208A954; else goto L_0208A938;
   L_0208A954: ; // 0x208a954
@@ -5413,10 +5413,10 @@ void Gambit_fn_0208A7E0(CPUState* cpu) {
         /* 0208A95C */ cpu->r[12] = rbrew_read32(cpu->mem, _t44);
         /* 0208A960 */ _t45 = cpu->r[1] + 0x00000010u;
         /* 0208A960 */ cpu->r[7] = rbrew_read32(cpu->mem, _t45);
-        /* 0208A964 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 0208A964 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 0208A968 */ _t46 = cpu->r[7] + 0x00000014u;
         /* 0208A968 */ cpu->r[8] = rbrew_read32(cpu->mem, _t46);
-        /* 0208A96C */ _t47 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208A96C */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208A96C */ _t48 = _t47 & 0x00000001u;
         /* 0208A96C */ if (_t48) goto L_0208A974; else goto L_0208A970;
   L_0208A970: ; // 0x208a970
@@ -5471,10 +5471,10 @@ void Gambit_fn_0208A7E0(CPUState* cpu) {
         /* 0208A9F4 */ rbrew_write32(cpu->mem, _t62, cpu->r[0]);
         /* 0208A9F8 */ _t63 = cpu->r[27] + 0x00000014u;
         /* 0208A9F8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t63);
-        /* 0208A9FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], 0x00000001u);
+        /* 0208A9FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], 0x00000001u));
         /* 0208AA00 */ _t64 = cpu->r[27] + 0x00000018u;
         /* 0208AA00 */ cpu->r[24] = rbrew_read32(cpu->mem, _t64);
-        /* 0208AA04 */ _t65 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208AA04 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208AA04 */ _t66 = _t65 & 0x00000001u;
         /* 0208AA04 */ if (_t66) goto L_0208AA08; else goto L_0208AA0C;
   L_0208AA08: ; // 0x208aa08
@@ -5490,23 +5490,23 @@ void Gambit_fn_0208A7E0(CPUState* cpu) {
         /* 0208AA20 */ _t69 = cpu->r[11] + 0x00000000u;
         /* 0208AA20 */ cpu->r[8] = rbrew_read8(cpu->mem, _t69);
         /* 0208AA24 */ cpu->r[31] = 0x00000000u;
-        /* 0208AA28 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[26]);
+        /* 0208AA28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[26]));
         /* 0208AA2C */ cpu->r[0] = 0x00080000u;
-        /* 0208AA30 */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208AA30 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208AA30 */ _t71 = _t70 & 0x00000001u;
         /* 0208AA30 */ if (_t71) goto L_0208AA58; else goto L_0208AA34;
   L_0208AA34: ; // 0x208aa34
         /* 0208AA34 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208AA38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 0208AA38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 0208AA3C */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 0208AA40 */ _t72 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208AA40 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208AA40 */ _t73 = _t72 & 0x00000001u;
         /* 0208AA40 */ if (_t73) goto L_0208AA54; else goto L_0208AA44;
   L_0208AA44: ; // 0x208aa44
         /* 0208AA44 */ _t74 = cpu->r[11] + 0x00000000u;
         /* 0208AA44 */ cpu->r[10] = rbrew_read8(cpu->mem, _t74);
-        /* 0208AA48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[26]);
-        /* 0208AA4C */ _t75 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208AA48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[26]));
+        /* 0208AA4C */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208AA4C */ _t76 = _t75 & 0x00000001u;
         /* 0208AA4C */ if (_t76) goto L_0208AA50; else goto L_0208AA34;
   L_0208AA50: ; // 0x208aa50
@@ -5518,10 +5518,10 @@ void Gambit_fn_0208A7E0(CPUState* cpu) {
         /* 0208AA58 */ cpu->r[4] = rbrew_read32(cpu->mem, _t77);
         /* 0208AA5C */ _t78 = cpu->r[1] + 0x00000010u;
         /* 0208AA5C */ cpu->r[12] = rbrew_read32(cpu->mem, _t78);
-        /* 0208AA60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[4]);
+        /* 0208AA60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[4]));
         /* 0208AA64 */ _t79 = cpu->r[12] + 0x00000014u;
         /* 0208AA64 */ cpu->r[0] = rbrew_read32(cpu->mem, _t79);
-        /* 0208AA68 */ _t80 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208AA68 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208AA68 */ _t81 = _t80 & 0x00000001u;
         /* 0208AA68 */ if (_t81) goto L_0208AA70; else goto L_0208AA6C;
   L_0208AA6C: ; // 0x208aa6c
@@ -5576,10 +5576,10 @@ void Gambit_fn_0208A7E0(CPUState* cpu) {
         /* 0208AAF0 */ rbrew_write32(cpu->mem, _t95, cpu->r[8]);
         /* 0208AAF4 */ _t96 = cpu->r[27] + 0x00000014u;
         /* 0208AAF4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t96);
-        /* 0208AAF8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000002u);
+        /* 0208AAF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000002u));
         /* 0208AAFC */ _t97 = cpu->r[27] + 0x00000018u;
         /* 0208AAFC */ cpu->r[24] = rbrew_read32(cpu->mem, _t97);
-        /* 0208AB00 */ _t98 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208AB00 */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208AB00 */ _t99 = _t98 & 0x00000001u;
         /* 0208AB00 */ if (_t99) goto L_0208AB04; else goto L_0208AB08;
   L_0208AB04: ; // 0x208ab04
@@ -5595,23 +5595,23 @@ void Gambit_fn_0208A7E0(CPUState* cpu) {
         /* 0208AB1C */ _t102 = cpu->r[7] + 0x00000000u;
         /* 0208AB1C */ cpu->r[12] = rbrew_read8(cpu->mem, _t102);
         /* 0208AB20 */ cpu->r[31] = 0x00000000u;
-        /* 0208AB24 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[26]);
+        /* 0208AB24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[26]));
         /* 0208AB28 */ cpu->r[9] = 0x00080000u;
-        /* 0208AB2C */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208AB2C */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208AB2C */ _t104 = _t103 & 0x00000001u;
         /* 0208AB2C */ if (_t104) goto L_0208AB54; else goto L_0208AB30;
   L_0208AB30: ; // 0x208ab30
         /* 0208AB30 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208AB34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 0208AB34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 0208AB38 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 0208AB3C */ _t105 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208AB3C */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208AB3C */ _t106 = _t105 & 0x00000001u;
         /* 0208AB3C */ if (_t106) goto L_0208AB50; else goto L_0208AB40;
   L_0208AB40: ; // 0x208ab40
         /* 0208AB40 */ _t107 = cpu->r[7] + 0x00000000u;
         /* 0208AB40 */ cpu->r[4] = rbrew_read8(cpu->mem, _t107);
-        /* 0208AB44 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[26]);
-        /* 0208AB48 */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208AB44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[26]));
+        /* 0208AB48 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208AB48 */ _t109 = _t108 & 0x00000001u;
         /* 0208AB48 */ if (_t109) goto L_0208AB4C; else goto L_0208AB30;
   L_0208AB4C: ; // 0x208ab4c
@@ -5621,10 +5621,10 @@ void Gambit_fn_0208A7E0(CPUState* cpu) {
   L_0208AB54: ; // 0x208ab54
         /* 0208AB54 */ _t110 = cpu->r[24] + 0x00000008u;
         /* 0208AB54 */ cpu->r[6] = rbrew_read32(cpu->mem, _t110);
-        /* 0208AB58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 0208AB58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 0208AB5C */ _t111 = cpu->r[1] + 0x00000010u;
         /* 0208AB5C */ cpu->r[5] = rbrew_read32(cpu->mem, _t111);
-        /* 0208AB60 */ _t112 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208AB60 */ _t112 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208AB60 */ _t113 = _t112 & 0x00000001u;
         /* 0208AB60 */ if (_t113) goto L_0208AB68; else goto L_0208AB64;
   L_0208AB64: ; // 0x208ab64
@@ -5681,10 +5681,10 @@ void Gambit_fn_0208A7E0(CPUState* cpu) {
         /* 0208ABEC */ rbrew_write32(cpu->mem, _t128, cpu->r[0]);
         /* 0208ABF0 */ _t129 = cpu->r[27] + 0x00000014u;
         /* 0208ABF0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t129);
-        /* 0208ABF4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 0208ABF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 0208ABF8 */ _t130 = cpu->r[27] + 0x00000018u;
         /* 0208ABF8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t130);
-        /* 0208ABFC */ _t131 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208ABFC */ _t131 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208ABFC */ _t132 = _t131 & 0x00000001u;
         /* 0208ABFC */ if (_t132) goto L_0208AC00; else goto L_0208AC04;
   L_0208AC00: ; // 0x208ac00
@@ -5700,23 +5700,23 @@ void Gambit_fn_0208A7E0(CPUState* cpu) {
         /* 0208AC18 */ _t135 = cpu->r[4] + 0x00000000u;
         /* 0208AC18 */ cpu->r[5] = rbrew_read8(cpu->mem, _t135);
         /* 0208AC1C */ cpu->r[24] = 0x00000000u;
-        /* 0208AC20 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[26]);
+        /* 0208AC20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[26]));
         /* 0208AC24 */ cpu->r[5] = 0x00080000u;
-        /* 0208AC28 */ _t136 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208AC28 */ _t136 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208AC28 */ _t137 = _t136 & 0x00000001u;
         /* 0208AC28 */ if (_t137) goto L_0208AC50; else goto L_0208AC2C;
   L_0208AC2C: ; // 0x208ac2c
         /* 0208AC2C */ cpu->r[24] = cpu->r[24] + 0x00000001u;
-        /* 0208AC30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], cpu->r[5]);
+        /* 0208AC30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], cpu->r[5]));
         /* 0208AC34 */ cpu->r[4] = cpu->r[4] + 0x00000001u;
-        /* 0208AC38 */ _t138 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208AC38 */ _t138 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208AC38 */ _t139 = _t138 & 0x00000001u;
         /* 0208AC38 */ if (_t139) goto L_0208AC4C; else goto L_0208AC3C;
   L_0208AC3C: ; // 0x208ac3c
         /* 0208AC3C */ _t140 = cpu->r[4] + 0x00000000u;
         /* 0208AC3C */ cpu->r[7] = rbrew_read8(cpu->mem, _t140);
-        /* 0208AC40 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[26]);
-        /* 0208AC44 */ _t141 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208AC40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[26]));
+        /* 0208AC44 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208AC44 */ _t142 = _t141 & 0x00000001u;
         /* 0208AC44 */ if (_t142) goto L_0208AC48; else goto L_0208AC2C;
   L_0208AC48: ; // 0x208ac48
@@ -5728,10 +5728,10 @@ void Gambit_fn_0208A7E0(CPUState* cpu) {
         /* 0208AC50 */ cpu->r[8] = rbrew_read32(cpu->mem, _t143);
         /* 0208AC54 */ _t144 = cpu->r[1] + 0x00000010u;
         /* 0208AC54 */ cpu->r[9] = rbrew_read32(cpu->mem, _t144);
-        /* 0208AC58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], cpu->r[8]);
+        /* 0208AC58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], cpu->r[8]));
         /* 0208AC5C */ _t145 = cpu->r[9] + 0x00000014u;
         /* 0208AC5C */ cpu->r[0] = rbrew_read32(cpu->mem, _t145);
-        /* 0208AC60 */ _t146 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208AC60 */ _t146 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208AC60 */ _t147 = _t146 & 0x00000001u;
         /* 0208AC60 */ if (_t147) goto L_0208AC68; else goto L_0208AC64;
   L_0208AC64: ; // 0x208ac64
@@ -5786,10 +5786,10 @@ void Gambit_fn_0208A7E0(CPUState* cpu) {
         /* 0208ACE8 */ rbrew_write32(cpu->mem, _t161, cpu->r[6]);
         /* 0208ACEC */ _t162 = cpu->r[27] + 0x00000014u;
         /* 0208ACEC */ cpu->r[7] = rbrew_read32(cpu->mem, _t162);
-        /* 0208ACF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x00000004u);
+        /* 0208ACF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x00000004u));
         /* 0208ACF4 */ _t163 = cpu->r[27] + 0x00000018u;
         /* 0208ACF4 */ cpu->r[24] = rbrew_read32(cpu->mem, _t163);
-        /* 0208ACF8 */ _t164 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208ACF8 */ _t164 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208ACF8 */ _t165 = _t164 & 0x00000001u;
         /* 0208ACF8 */ if (_t165) goto L_0208ACFC; else goto L_0208AD00;
   L_0208ACFC: ; // 0x208acfc
@@ -5805,23 +5805,23 @@ void Gambit_fn_0208A7E0(CPUState* cpu) {
         /* 0208AD14 */ _t168 = cpu->r[9] + 0x00000000u;
         /* 0208AD14 */ cpu->r[8] = rbrew_read8(cpu->mem, _t168);
         /* 0208AD18 */ cpu->r[31] = 0x00000000u;
-        /* 0208AD1C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[26]);
+        /* 0208AD1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[26]));
         /* 0208AD20 */ cpu->r[11] = 0x00080000u;
-        /* 0208AD24 */ _t169 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208AD24 */ _t169 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208AD24 */ _t170 = _t169 & 0x00000001u;
         /* 0208AD24 */ if (_t170) goto L_0208AD4C; else goto L_0208AD28;
   L_0208AD28: ; // 0x208ad28
         /* 0208AD28 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208AD2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 0208AD2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 0208AD30 */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 0208AD34 */ _t171 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208AD34 */ _t171 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208AD34 */ _t172 = _t171 & 0x00000001u;
         /* 0208AD34 */ if (_t172) goto L_0208AD48; else goto L_0208AD38;
   L_0208AD38: ; // 0x208ad38
         /* 0208AD38 */ _t173 = cpu->r[9] + 0x00000000u;
         /* 0208AD38 */ cpu->r[0] = rbrew_read8(cpu->mem, _t173);
-        /* 0208AD3C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[26]);
-        /* 0208AD40 */ _t174 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208AD3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[26]));
+        /* 0208AD40 */ _t174 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208AD40 */ _t175 = _t174 & 0x00000001u;
         /* 0208AD40 */ if (_t175) goto L_0208AD44; else goto L_0208AD28;
   L_0208AD44: ; // 0x208ad44
@@ -5831,8 +5831,8 @@ void Gambit_fn_0208A7E0(CPUState* cpu) {
   L_0208AD4C: ; // 0x208ad4c
         /* 0208AD4C */ _t176 = cpu->r[24] + 0x00000008u;
         /* 0208AD4C */ cpu->r[10] = rbrew_read32(cpu->mem, _t176);
-        /* 0208AD50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
-        /* 0208AD54 */ _t177 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208AD50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
+        /* 0208AD54 */ _t177 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208AD54 */ _t178 = _t177 & 0x00000001u;
         /* 0208AD54 */ if (_t178) goto L_0208AD5C; else goto L_0208AD58;
   L_0208AD58: ; // 0x208ad58
@@ -5891,10 +5891,10 @@ void Gambit_fn_0208A7E0(CPUState* cpu) {
         /* 0208ADE4 */ rbrew_write32(cpu->mem, _t194, cpu->r[0]);
         /* 0208ADE8 */ _t195 = cpu->r[27] + 0x00000014u;
         /* 0208ADE8 */ cpu->r[4] = rbrew_read32(cpu->mem, _t195);
-        /* 0208ADEC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000005u);
+        /* 0208ADEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000005u));
         /* 0208ADF0 */ _t196 = cpu->r[27] + 0x00000018u;
         /* 0208ADF0 */ cpu->r[24] = rbrew_read32(cpu->mem, _t196);
-        /* 0208ADF4 */ _t197 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208ADF4 */ _t197 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208ADF4 */ _t198 = _t197 & 0x00000001u;
         /* 0208ADF4 */ if (_t198) goto L_0208ADF8; else goto L_0208ADFC;
   L_0208ADF8: ; // 0x208adf8
@@ -5910,23 +5910,23 @@ void Gambit_fn_0208A7E0(CPUState* cpu) {
         /* 0208AE10 */ _t201 = cpu->r[4] + 0x00000000u;
         /* 0208AE10 */ cpu->r[5] = rbrew_read8(cpu->mem, _t201);
         /* 0208AE14 */ cpu->r[31] = 0x00000000u;
-        /* 0208AE18 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[26]);
+        /* 0208AE18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[26]));
         /* 0208AE1C */ cpu->r[7] = 0x00080000u;
-        /* 0208AE20 */ _t202 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208AE20 */ _t202 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208AE20 */ _t203 = _t202 & 0x00000001u;
         /* 0208AE20 */ if (_t203) goto L_0208AE48; else goto L_0208AE24;
   L_0208AE24: ; // 0x208ae24
         /* 0208AE24 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208AE28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 0208AE28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 0208AE2C */ cpu->r[4] = cpu->r[4] + 0x00000001u;
-        /* 0208AE30 */ _t204 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208AE30 */ _t204 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208AE30 */ _t205 = _t204 & 0x00000001u;
         /* 0208AE30 */ if (_t205) goto L_0208AE44; else goto L_0208AE34;
   L_0208AE34: ; // 0x208ae34
         /* 0208AE34 */ _t206 = cpu->r[4] + 0x00000000u;
         /* 0208AE34 */ cpu->r[6] = rbrew_read8(cpu->mem, _t206);
-        /* 0208AE38 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[26]);
-        /* 0208AE3C */ _t207 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208AE38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[26]));
+        /* 0208AE3C */ _t207 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208AE3C */ _t208 = _t207 & 0x00000001u;
         /* 0208AE3C */ if (_t208) goto L_0208AE40; else goto L_0208AE24;
   L_0208AE40: ; // 0x208ae40
@@ -5938,10 +5938,10 @@ void Gambit_fn_0208A7E0(CPUState* cpu) {
         /* 0208AE48 */ cpu->r[12] = rbrew_read32(cpu->mem, _t209);
         /* 0208AE4C */ _t210 = cpu->r[1] + 0x00000010u;
         /* 0208AE4C */ cpu->r[7] = rbrew_read32(cpu->mem, _t210);
-        /* 0208AE50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 0208AE50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 0208AE54 */ _t211 = cpu->r[7] + 0x00000014u;
         /* 0208AE54 */ cpu->r[8] = rbrew_read32(cpu->mem, _t211);
-        /* 0208AE58 */ _t212 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208AE58 */ _t212 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208AE58 */ _t213 = _t212 & 0x00000001u;
         /* 0208AE58 */ if (_t213) goto L_0208AE60; else goto L_0208AE5C;
   L_0208AE5C: ; // 0x208ae5c
@@ -5996,10 +5996,10 @@ void Gambit_fn_0208A7E0(CPUState* cpu) {
         /* 0208AEE0 */ rbrew_write32(cpu->mem, _t227, cpu->r[0]);
         /* 0208AEE4 */ _t228 = cpu->r[27] + 0x00000014u;
         /* 0208AEE4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t228);
-        /* 0208AEE8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], 0x00000006u);
+        /* 0208AEE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], 0x00000006u));
         /* 0208AEEC */ _t229 = cpu->r[27] + 0x00000018u;
         /* 0208AEEC */ cpu->r[30] = rbrew_read32(cpu->mem, _t229);
-        /* 0208AEF0 */ _t230 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208AEF0 */ _t230 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208AEF0 */ _t231 = _t230 & 0x00000001u;
         /* 0208AEF0 */ if (_t231) goto L_0208AEF4; else goto L_0208AEF8;
   L_0208AEF4: ; // 0x208aef4
@@ -6015,23 +6015,23 @@ void Gambit_fn_0208A7E0(CPUState* cpu) {
         /* 0208AF0C */ _t234 = cpu->r[11] + 0x00000000u;
         /* 0208AF0C */ cpu->r[0] = rbrew_read8(cpu->mem, _t234);
         /* 0208AF10 */ cpu->r[31] = 0x00000000u;
-        /* 0208AF14 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[26]);
+        /* 0208AF14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[26]));
         /* 0208AF18 */ cpu->r[12] = 0x00080000u;
-        /* 0208AF1C */ _t235 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208AF1C */ _t235 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208AF1C */ _t236 = _t235 & 0x00000001u;
         /* 0208AF1C */ if (_t236) goto L_0208AF44; else goto L_0208AF20;
   L_0208AF20: ; // 0x208af20
         /* 0208AF20 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208AF24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 0208AF24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 0208AF28 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 0208AF2C */ _t237 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208AF2C */ _t237 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208AF2C */ _t238 = _t237 & 0x00000001u;
         /* 0208AF2C */ if (_t238) goto L_0208AF40; else goto L_0208AF30;
   L_0208AF30: ; // 0x208af30
         /* 0208AF30 */ _t239 = cpu->r[11] + 0x00000000u;
         /* 0208AF30 */ cpu->r[4] = rbrew_read8(cpu->mem, _t239);
-        /* 0208AF34 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[26]);
-        /* 0208AF38 */ _t240 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208AF34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[26]));
+        /* 0208AF38 */ _t240 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208AF38 */ _t241 = _t240 & 0x00000001u;
         /* 0208AF38 */ if (_t241) goto L_0208AF3C; else goto L_0208AF20;
   L_0208AF3C: ; // 0x208af3c
@@ -6043,10 +6043,10 @@ void Gambit_fn_0208A7E0(CPUState* cpu) {
         /* 0208AF44 */ cpu->r[4] = rbrew_read32(cpu->mem, _t242);
         /* 0208AF48 */ _t243 = cpu->r[1] + 0x00000010u;
         /* 0208AF48 */ cpu->r[5] = rbrew_read32(cpu->mem, _t243);
-        /* 0208AF4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[4]);
+        /* 0208AF4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[4]));
         /* 0208AF50 */ _t244 = cpu->r[5] + 0x00000014u;
         /* 0208AF50 */ cpu->r[6] = rbrew_read32(cpu->mem, _t244);
-        /* 0208AF54 */ _t245 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208AF54 */ _t245 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208AF54 */ _t246 = _t245 & 0x00000001u;
         /* 0208AF54 */ if (_t246) goto L_0208AF5C; else goto L_0208AF58;
   L_0208AF58: ; // 0x208af58
@@ -6127,16 +6127,16 @@ void Gambit_fn_0208A7E4(CPUState* cpu) {
         /* 0208A7E8 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 0208A7EC */ /* nop */
         /* 0208A7F0 */ cpu->r[29] = cpu->r[3];
-        /* 0208A7F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0208A7F4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A7F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0208A7F4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A7F4 */ _t3 = _t2 & 0x00000001u;
         /* 0208A7F4 */ if (_t3) goto L_0208A7F8; else goto L_0208A808;
   L_0208A7F8: ; // 0x208a7f8
         /* 0208A7F8 */ cpu->r[3] = 0x00000230u;
         /* 0208A7FC */ Gambit_fn_02801A78(cpu);
         /* 0208A800 */ cpu->r[29] = cpu->r[3];
-        /* 0208A800 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0208A804 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A800 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0208A804 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A804 */ _t5 = _t4 & 0x00000001u;
         /* 0208A804 */ if (_t5) goto L_0208AFF8; else goto L_0208A808;
   L_0208A808: ; // 0x208a808
@@ -6164,7 +6164,7 @@ void Gambit_fn_0208A7E4(CPUState* cpu) {
         /* 0208A850 */ _t9 = cpu->r[29] + 0x0000000Cu;
         /* 0208A850 */ rbrew_write32(cpu->mem, _t9, cpu->r[10]);
         /* 0208A854 */ cpu->r[27] = cpu->r[29] + 0x000001DCu;
-        /* 0208A854 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0208A854 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0208A858 */ cpu->r[12] = cpu->r[12] + 0xFFFFDB64u;
         /* 0208A85C */ _t10 = cpu->r[29] + 0x0000001Cu;
         /* 0208A85C */ rbrew_write32(cpu->mem, _t10, cpu->r[11]);
@@ -6172,15 +6172,15 @@ void Gambit_fn_0208A7E4(CPUState* cpu) {
         /* 0208A864 */ cpu->r[28] = 0x00000000u;
         /* 0208A868 */ _t11 = cpu->r[29] + 0x000001C8u;
         /* 0208A868 */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
-        /* 0208A86C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A86C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A86C */ _t13 = _t12 & 0x00000001u;
         /* 0208A86C */ if (_t13) goto L_0208A870; else goto L_0208A880;
   L_0208A870: ; // 0x208a870
         /* 0208A870 */ cpu->r[3] = 0x00000038u;
         /* 0208A874 */ Gambit_fn_02801A78(cpu);
         /* 0208A878 */ cpu->r[31] = cpu->r[3];
-        /* 0208A878 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0208A87C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A878 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0208A87C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A87C */ _t15 = _t14 & 0x00000001u;
         /* 0208A87C */ if (_t15) goto L_0208A8B0; else goto L_0208A880;
   L_0208A880: ; // 0x208a880
@@ -6249,23 +6249,23 @@ void Gambit_fn_0208A7E4(CPUState* cpu) {
         /* 0208A924 */ _t36 = cpu->r[7] + 0x00000000u;
         /* 0208A924 */ cpu->r[5] = rbrew_read8(cpu->mem, _t36);
         /* 0208A928 */ cpu->r[31] = 0x00000000u;
-        /* 0208A92C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[26]);
+        /* 0208A92C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[26]));
         /* 0208A930 */ cpu->r[8] = 0x00080000u;
-        /* 0208A934 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A934 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A934 */ _t38 = _t37 & 0x00000001u;
         /* 0208A934 */ if (_t38) goto L_0208A95C; else goto L_0208A938;
   L_0208A938: ; // 0x208a938
         /* 0208A938 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208A93C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[8]);
+        /* 0208A93C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[8]));
         /* 0208A940 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 0208A944 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208A944 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208A944 */ _t40 = _t39 & 0x00000001u;
         /* 0208A944 */ if (_t40) goto L_0208A958; else goto L_0208A948;
   L_0208A948: ; // 0x208a948
         /* 0208A948 */ _t41 = cpu->r[7] + 0x00000000u;
         /* 0208A948 */ cpu->r[6] = rbrew_read8(cpu->mem, _t41);
-        /* 0208A94C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[26]);
-        /* 0208A950 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A94C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[26]));
+        /* 0208A950 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A950 */ _t43 = _t42 & 0x00000001u;
         /* 0208A950 */ if (_t43) goto L_0208A954; else goto L_0208A938;
   L_0208A954: ; // 0x208a954
@@ -6277,10 +6277,10 @@ void Gambit_fn_0208A7E4(CPUState* cpu) {
         /* 0208A95C */ cpu->r[12] = rbrew_read32(cpu->mem, _t44);
         /* 0208A960 */ _t45 = cpu->r[1] + 0x00000010u;
         /* 0208A960 */ cpu->r[7] = rbrew_read32(cpu->mem, _t45);
-        /* 0208A964 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 0208A964 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 0208A968 */ _t46 = cpu->r[7] + 0x00000014u;
         /* 0208A968 */ cpu->r[8] = rbrew_read32(cpu->mem, _t46);
-        /* 0208A96C */ _t47 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208A96C */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208A96C */ _t48 = _t47 & 0x00000001u;
         /* 0208A96C */ if (_t48) goto L_0208A974; else goto L_0208A970;
   L_0208A970: ; // 0x208a970
@@ -6335,10 +6335,10 @@ void Gambit_fn_0208A7E4(CPUState* cpu) {
         /* 0208A9F4 */ rbrew_write32(cpu->mem, _t62, cpu->r[0]);
         /* 0208A9F8 */ _t63 = cpu->r[27] + 0x00000014u;
         /* 0208A9F8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t63);
-        /* 0208A9FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], 0x00000001u);
+        /* 0208A9FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], 0x00000001u));
         /* 0208AA00 */ _t64 = cpu->r[27] + 0x00000018u;
         /* 0208AA00 */ cpu->r[24] = rbrew_read32(cpu->mem, _t64);
-        /* 0208AA04 */ _t65 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208AA04 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208AA04 */ _t66 = _t65 & 0x00000001u;
         /* 0208AA04 */ if (_t66) goto L_0208AA08; else goto L_0208AA0C;
   L_0208AA08: ; // 0x208aa08
@@ -6354,23 +6354,23 @@ void Gambit_fn_0208A7E4(CPUState* cpu) {
         /* 0208AA20 */ _t69 = cpu->r[11] + 0x00000000u;
         /* 0208AA20 */ cpu->r[8] = rbrew_read8(cpu->mem, _t69);
         /* 0208AA24 */ cpu->r[31] = 0x00000000u;
-        /* 0208AA28 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[26]);
+        /* 0208AA28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[26]));
         /* 0208AA2C */ cpu->r[0] = 0x00080000u;
-        /* 0208AA30 */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208AA30 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208AA30 */ _t71 = _t70 & 0x00000001u;
         /* 0208AA30 */ if (_t71) goto L_0208AA58; else goto L_0208AA34;
   L_0208AA34: ; // 0x208aa34
         /* 0208AA34 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208AA38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 0208AA38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 0208AA3C */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 0208AA40 */ _t72 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208AA40 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208AA40 */ _t73 = _t72 & 0x00000001u;
         /* 0208AA40 */ if (_t73) goto L_0208AA54; else goto L_0208AA44;
   L_0208AA44: ; // 0x208aa44
         /* 0208AA44 */ _t74 = cpu->r[11] + 0x00000000u;
         /* 0208AA44 */ cpu->r[10] = rbrew_read8(cpu->mem, _t74);
-        /* 0208AA48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[26]);
-        /* 0208AA4C */ _t75 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208AA48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[26]));
+        /* 0208AA4C */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208AA4C */ _t76 = _t75 & 0x00000001u;
         /* 0208AA4C */ if (_t76) goto L_0208AA50; else goto L_0208AA34;
   L_0208AA50: ; // 0x208aa50
@@ -6382,10 +6382,10 @@ void Gambit_fn_0208A7E4(CPUState* cpu) {
         /* 0208AA58 */ cpu->r[4] = rbrew_read32(cpu->mem, _t77);
         /* 0208AA5C */ _t78 = cpu->r[1] + 0x00000010u;
         /* 0208AA5C */ cpu->r[12] = rbrew_read32(cpu->mem, _t78);
-        /* 0208AA60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[4]);
+        /* 0208AA60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[4]));
         /* 0208AA64 */ _t79 = cpu->r[12] + 0x00000014u;
         /* 0208AA64 */ cpu->r[0] = rbrew_read32(cpu->mem, _t79);
-        /* 0208AA68 */ _t80 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208AA68 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208AA68 */ _t81 = _t80 & 0x00000001u;
         /* 0208AA68 */ if (_t81) goto L_0208AA70; else goto L_0208AA6C;
   L_0208AA6C: ; // 0x208aa6c
@@ -6440,10 +6440,10 @@ void Gambit_fn_0208A7E4(CPUState* cpu) {
         /* 0208AAF0 */ rbrew_write32(cpu->mem, _t95, cpu->r[8]);
         /* 0208AAF4 */ _t96 = cpu->r[27] + 0x00000014u;
         /* 0208AAF4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t96);
-        /* 0208AAF8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000002u);
+        /* 0208AAF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000002u));
         /* 0208AAFC */ _t97 = cpu->r[27] + 0x00000018u;
         /* 0208AAFC */ cpu->r[24] = rbrew_read32(cpu->mem, _t97);
-        /* 0208AB00 */ _t98 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208AB00 */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208AB00 */ _t99 = _t98 & 0x00000001u;
         /* 0208AB00 */ if (_t99) goto L_0208AB04; else goto L_0208AB08;
   L_0208AB04: ; // 0x208ab04
@@ -6459,23 +6459,23 @@ void Gambit_fn_0208A7E4(CPUState* cpu) {
         /* 0208AB1C */ _t102 = cpu->r[7] + 0x00000000u;
         /* 0208AB1C */ cpu->r[12] = rbrew_read8(cpu->mem, _t102);
         /* 0208AB20 */ cpu->r[31] = 0x00000000u;
-        /* 0208AB24 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[26]);
+        /* 0208AB24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[26]));
         /* 0208AB28 */ cpu->r[9] = 0x00080000u;
-        /* 0208AB2C */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208AB2C */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208AB2C */ _t104 = _t103 & 0x00000001u;
         /* 0208AB2C */ if (_t104) goto L_0208AB54; else goto L_0208AB30;
   L_0208AB30: ; // 0x208ab30
         /* 0208AB30 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208AB34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 0208AB34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 0208AB38 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 0208AB3C */ _t105 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208AB3C */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208AB3C */ _t106 = _t105 & 0x00000001u;
         /* 0208AB3C */ if (_t106) goto L_0208AB50; else goto L_0208AB40;
   L_0208AB40: ; // 0x208ab40
         /* 0208AB40 */ _t107 = cpu->r[7] + 0x00000000u;
         /* 0208AB40 */ cpu->r[4] = rbrew_read8(cpu->mem, _t107);
-        /* 0208AB44 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[26]);
-        /* 0208AB48 */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208AB44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[26]));
+        /* 0208AB48 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208AB48 */ _t109 = _t108 & 0x00000001u;
         /* 0208AB48 */ if (_t109) goto L_0208AB4C; else goto L_0208AB30;
   L_0208AB4C: ; // 0x208ab4c
@@ -6485,10 +6485,10 @@ void Gambit_fn_0208A7E4(CPUState* cpu) {
   L_0208AB54: ; // 0x208ab54
         /* 0208AB54 */ _t110 = cpu->r[24] + 0x00000008u;
         /* 0208AB54 */ cpu->r[6] = rbrew_read32(cpu->mem, _t110);
-        /* 0208AB58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 0208AB58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 0208AB5C */ _t111 = cpu->r[1] + 0x00000010u;
         /* 0208AB5C */ cpu->r[5] = rbrew_read32(cpu->mem, _t111);
-        /* 0208AB60 */ _t112 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208AB60 */ _t112 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208AB60 */ _t113 = _t112 & 0x00000001u;
         /* 0208AB60 */ if (_t113) goto L_0208AB68; else goto L_0208AB64;
   L_0208AB64: ; // 0x208ab64
@@ -6545,10 +6545,10 @@ void Gambit_fn_0208A7E4(CPUState* cpu) {
         /* 0208ABEC */ rbrew_write32(cpu->mem, _t128, cpu->r[0]);
         /* 0208ABF0 */ _t129 = cpu->r[27] + 0x00000014u;
         /* 0208ABF0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t129);
-        /* 0208ABF4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 0208ABF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 0208ABF8 */ _t130 = cpu->r[27] + 0x00000018u;
         /* 0208ABF8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t130);
-        /* 0208ABFC */ _t131 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208ABFC */ _t131 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208ABFC */ _t132 = _t131 & 0x00000001u;
         /* 0208ABFC */ if (_t132) goto L_0208AC00; else goto L_0208AC04;
   L_0208AC00: ; // 0x208ac00
@@ -6564,23 +6564,23 @@ void Gambit_fn_0208A7E4(CPUState* cpu) {
         /* 0208AC18 */ _t135 = cpu->r[4] + 0x00000000u;
         /* 0208AC18 */ cpu->r[5] = rbrew_read8(cpu->mem, _t135);
         /* 0208AC1C */ cpu->r[24] = 0x00000000u;
-        /* 0208AC20 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[26]);
+        /* 0208AC20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[26]));
         /* 0208AC24 */ cpu->r[5] = 0x00080000u;
-        /* 0208AC28 */ _t136 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208AC28 */ _t136 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208AC28 */ _t137 = _t136 & 0x00000001u;
         /* 0208AC28 */ if (_t137) goto L_0208AC50; else goto L_0208AC2C;
   L_0208AC2C: ; // 0x208ac2c
         /* 0208AC2C */ cpu->r[24] = cpu->r[24] + 0x00000001u;
-        /* 0208AC30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], cpu->r[5]);
+        /* 0208AC30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], cpu->r[5]));
         /* 0208AC34 */ cpu->r[4] = cpu->r[4] + 0x00000001u;
-        /* 0208AC38 */ _t138 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208AC38 */ _t138 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208AC38 */ _t139 = _t138 & 0x00000001u;
         /* 0208AC38 */ if (_t139) goto L_0208AC4C; else goto L_0208AC3C;
   L_0208AC3C: ; // 0x208ac3c
         /* 0208AC3C */ _t140 = cpu->r[4] + 0x00000000u;
         /* 0208AC3C */ cpu->r[7] = rbrew_read8(cpu->mem, _t140);
-        /* 0208AC40 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[26]);
-        /* 0208AC44 */ _t141 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208AC40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[26]));
+        /* 0208AC44 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208AC44 */ _t142 = _t141 & 0x00000001u;
         /* 0208AC44 */ if (_t142) goto L_0208AC48; else goto L_0208AC2C;
   L_0208AC48: ; // 0x208ac48
@@ -6592,10 +6592,10 @@ void Gambit_fn_0208A7E4(CPUState* cpu) {
         /* 0208AC50 */ cpu->r[8] = rbrew_read32(cpu->mem, _t143);
         /* 0208AC54 */ _t144 = cpu->r[1] + 0x00000010u;
         /* 0208AC54 */ cpu->r[9] = rbrew_read32(cpu->mem, _t144);
-        /* 0208AC58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], cpu->r[8]);
+        /* 0208AC58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], cpu->r[8]));
         /* 0208AC5C */ _t145 = cpu->r[9] + 0x00000014u;
         /* 0208AC5C */ cpu->r[0] = rbrew_read32(cpu->mem, _t145);
-        /* 0208AC60 */ _t146 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208AC60 */ _t146 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208AC60 */ _t147 = _t146 & 0x00000001u;
         /* 0208AC60 */ if (_t147) goto L_0208AC68; else goto L_0208AC64;
   L_0208AC64: ; // 0x208ac64
@@ -6650,10 +6650,10 @@ void Gambit_fn_0208A7E4(CPUState* cpu) {
         /* 0208ACE8 */ rbrew_write32(cpu->mem, _t161, cpu->r[6]);
         /* 0208ACEC */ _t162 = cpu->r[27] + 0x00000014u;
         /* 0208ACEC */ cpu->r[7] = rbrew_read32(cpu->mem, _t162);
-        /* 0208ACF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x00000004u);
+        /* 0208ACF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x00000004u));
         /* 0208ACF4 */ _t163 = cpu->r[27] + 0x00000018u;
         /* 0208ACF4 */ cpu->r[24] = rbrew_read32(cpu->mem, _t163);
-        /* 0208ACF8 */ _t164 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208ACF8 */ _t164 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208ACF8 */ _t165 = _t164 & 0x00000001u;
         /* 0208ACF8 */ if (_t165) goto L_0208ACFC; else goto L_0208AD00;
   L_0208ACFC: ; // 0x208acfc
@@ -6669,23 +6669,23 @@ void Gambit_fn_0208A7E4(CPUState* cpu) {
         /* 0208AD14 */ _t168 = cpu->r[9] + 0x00000000u;
         /* 0208AD14 */ cpu->r[8] = rbrew_read8(cpu->mem, _t168);
         /* 0208AD18 */ cpu->r[31] = 0x00000000u;
-        /* 0208AD1C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[26]);
+        /* 0208AD1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[26]));
         /* 0208AD20 */ cpu->r[11] = 0x00080000u;
-        /* 0208AD24 */ _t169 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208AD24 */ _t169 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208AD24 */ _t170 = _t169 & 0x00000001u;
         /* 0208AD24 */ if (_t170) goto L_0208AD4C; else goto L_0208AD28;
   L_0208AD28: ; // 0x208ad28
         /* 0208AD28 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208AD2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 0208AD2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 0208AD30 */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 0208AD34 */ _t171 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208AD34 */ _t171 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208AD34 */ _t172 = _t171 & 0x00000001u;
         /* 0208AD34 */ if (_t172) goto L_0208AD48; else goto L_0208AD38;
   L_0208AD38: ; // 0x208ad38
         /* 0208AD38 */ _t173 = cpu->r[9] + 0x00000000u;
         /* 0208AD38 */ cpu->r[0] = rbrew_read8(cpu->mem, _t173);
-        /* 0208AD3C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[26]);
-        /* 0208AD40 */ _t174 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208AD3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[26]));
+        /* 0208AD40 */ _t174 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208AD40 */ _t175 = _t174 & 0x00000001u;
         /* 0208AD40 */ if (_t175) goto L_0208AD44; else goto L_0208AD28;
   L_0208AD44: ; // 0x208ad44
@@ -6695,8 +6695,8 @@ void Gambit_fn_0208A7E4(CPUState* cpu) {
   L_0208AD4C: ; // 0x208ad4c
         /* 0208AD4C */ _t176 = cpu->r[24] + 0x00000008u;
         /* 0208AD4C */ cpu->r[10] = rbrew_read32(cpu->mem, _t176);
-        /* 0208AD50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
-        /* 0208AD54 */ _t177 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208AD50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
+        /* 0208AD54 */ _t177 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208AD54 */ _t178 = _t177 & 0x00000001u;
         /* 0208AD54 */ if (_t178) goto L_0208AD5C; else goto L_0208AD58;
   L_0208AD58: ; // 0x208ad58
@@ -6755,10 +6755,10 @@ void Gambit_fn_0208A7E4(CPUState* cpu) {
         /* 0208ADE4 */ rbrew_write32(cpu->mem, _t194, cpu->r[0]);
         /* 0208ADE8 */ _t195 = cpu->r[27] + 0x00000014u;
         /* 0208ADE8 */ cpu->r[4] = rbrew_read32(cpu->mem, _t195);
-        /* 0208ADEC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000005u);
+        /* 0208ADEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000005u));
         /* 0208ADF0 */ _t196 = cpu->r[27] + 0x00000018u;
         /* 0208ADF0 */ cpu->r[24] = rbrew_read32(cpu->mem, _t196);
-        /* 0208ADF4 */ _t197 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208ADF4 */ _t197 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208ADF4 */ _t198 = _t197 & 0x00000001u;
         /* 0208ADF4 */ if (_t198) goto L_0208ADF8; else goto L_0208ADFC;
   L_0208ADF8: ; // 0x208adf8
@@ -6774,23 +6774,23 @@ void Gambit_fn_0208A7E4(CPUState* cpu) {
         /* 0208AE10 */ _t201 = cpu->r[4] + 0x00000000u;
         /* 0208AE10 */ cpu->r[5] = rbrew_read8(cpu->mem, _t201);
         /* 0208AE14 */ cpu->r[31] = 0x00000000u;
-        /* 0208AE18 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[26]);
+        /* 0208AE18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[26]));
         /* 0208AE1C */ cpu->r[7] = 0x00080000u;
-        /* 0208AE20 */ _t202 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208AE20 */ _t202 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208AE20 */ _t203 = _t202 & 0x00000001u;
         /* 0208AE20 */ if (_t203) goto L_0208AE48; else goto L_0208AE24;
   L_0208AE24: ; // 0x208ae24
         /* 0208AE24 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208AE28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 0208AE28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 0208AE2C */ cpu->r[4] = cpu->r[4] + 0x00000001u;
-        /* 0208AE30 */ _t204 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208AE30 */ _t204 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208AE30 */ _t205 = _t204 & 0x00000001u;
         /* 0208AE30 */ if (_t205) goto L_0208AE44; else goto L_0208AE34;
   L_0208AE34: ; // 0x208ae34
         /* 0208AE34 */ _t206 = cpu->r[4] + 0x00000000u;
         /* 0208AE34 */ cpu->r[6] = rbrew_read8(cpu->mem, _t206);
-        /* 0208AE38 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[26]);
-        /* 0208AE3C */ _t207 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208AE38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[26]));
+        /* 0208AE3C */ _t207 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208AE3C */ _t208 = _t207 & 0x00000001u;
         /* 0208AE3C */ if (_t208) goto L_0208AE40; else goto L_0208AE24;
   L_0208AE40: ; // 0x208ae40
@@ -6802,10 +6802,10 @@ void Gambit_fn_0208A7E4(CPUState* cpu) {
         /* 0208AE48 */ cpu->r[12] = rbrew_read32(cpu->mem, _t209);
         /* 0208AE4C */ _t210 = cpu->r[1] + 0x00000010u;
         /* 0208AE4C */ cpu->r[7] = rbrew_read32(cpu->mem, _t210);
-        /* 0208AE50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 0208AE50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 0208AE54 */ _t211 = cpu->r[7] + 0x00000014u;
         /* 0208AE54 */ cpu->r[8] = rbrew_read32(cpu->mem, _t211);
-        /* 0208AE58 */ _t212 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208AE58 */ _t212 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208AE58 */ _t213 = _t212 & 0x00000001u;
         /* 0208AE58 */ if (_t213) goto L_0208AE60; else goto L_0208AE5C;
   L_0208AE5C: ; // 0x208ae5c
@@ -6860,10 +6860,10 @@ void Gambit_fn_0208A7E4(CPUState* cpu) {
         /* 0208AEE0 */ rbrew_write32(cpu->mem, _t227, cpu->r[0]);
         /* 0208AEE4 */ _t228 = cpu->r[27] + 0x00000014u;
         /* 0208AEE4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t228);
-        /* 0208AEE8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], 0x00000006u);
+        /* 0208AEE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], 0x00000006u));
         /* 0208AEEC */ _t229 = cpu->r[27] + 0x00000018u;
         /* 0208AEEC */ cpu->r[30] = rbrew_read32(cpu->mem, _t229);
-        /* 0208AEF0 */ _t230 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208AEF0 */ _t230 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208AEF0 */ _t231 = _t230 & 0x00000001u;
         /* 0208AEF0 */ if (_t231) goto L_0208AEF4; else goto L_0208AEF8;
   L_0208AEF4: ; // 0x208aef4
@@ -6879,23 +6879,23 @@ void Gambit_fn_0208A7E4(CPUState* cpu) {
         /* 0208AF0C */ _t234 = cpu->r[11] + 0x00000000u;
         /* 0208AF0C */ cpu->r[0] = rbrew_read8(cpu->mem, _t234);
         /* 0208AF10 */ cpu->r[31] = 0x00000000u;
-        /* 0208AF14 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[26]);
+        /* 0208AF14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[26]));
         /* 0208AF18 */ cpu->r[12] = 0x00080000u;
-        /* 0208AF1C */ _t235 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208AF1C */ _t235 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208AF1C */ _t236 = _t235 & 0x00000001u;
         /* 0208AF1C */ if (_t236) goto L_0208AF44; else goto L_0208AF20;
   L_0208AF20: ; // 0x208af20
         /* 0208AF20 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208AF24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 0208AF24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 0208AF28 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 0208AF2C */ _t237 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208AF2C */ _t237 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208AF2C */ _t238 = _t237 & 0x00000001u;
         /* 0208AF2C */ if (_t238) goto L_0208AF40; else goto L_0208AF30;
   L_0208AF30: ; // 0x208af30
         /* 0208AF30 */ _t239 = cpu->r[11] + 0x00000000u;
         /* 0208AF30 */ cpu->r[4] = rbrew_read8(cpu->mem, _t239);
-        /* 0208AF34 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[26]);
-        /* 0208AF38 */ _t240 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208AF34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[26]));
+        /* 0208AF38 */ _t240 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208AF38 */ _t241 = _t240 & 0x00000001u;
         /* 0208AF38 */ if (_t241) goto L_0208AF3C; else goto L_0208AF20;
   L_0208AF3C: ; // 0x208af3c
@@ -6907,10 +6907,10 @@ void Gambit_fn_0208A7E4(CPUState* cpu) {
         /* 0208AF44 */ cpu->r[4] = rbrew_read32(cpu->mem, _t242);
         /* 0208AF48 */ _t243 = cpu->r[1] + 0x00000010u;
         /* 0208AF48 */ cpu->r[5] = rbrew_read32(cpu->mem, _t243);
-        /* 0208AF4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[4]);
+        /* 0208AF4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[4]));
         /* 0208AF50 */ _t244 = cpu->r[5] + 0x00000014u;
         /* 0208AF50 */ cpu->r[6] = rbrew_read32(cpu->mem, _t244);
-        /* 0208AF54 */ _t245 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208AF54 */ _t245 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208AF54 */ _t246 = _t245 & 0x00000001u;
         /* 0208AF54 */ if (_t246) goto L_0208AF5C; else goto L_0208AF58;
   L_0208AF58: ; // 0x208af58
@@ -6992,8 +6992,8 @@ void Gambit_fn_0208B010(CPUState* cpu) {
         /* 0208B018 */ cpu->r[1] = _t1;
         /* 0208B01C */ _t2 = cpu->r[3] + 0x00000228u;
         /* 0208B01C */ cpu->r[12] = rbrew_read8(cpu->mem, _t2);
-        /* 0208B020 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0208B024 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B020 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0208B024 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B024 */ _t4 = _t3 & 0x00000001u;
         /* 0208B024 */ if (_t4) goto L_0208B028; else goto L_0208B03C;
   L_0208B028: ; // 0x208b028
@@ -7022,8 +7022,8 @@ void Gambit_fn_0208B018(CPUState* cpu) {
         /* 0208B018 */ cpu->r[1] = _t0;
         /* 0208B01C */ _t1 = cpu->r[3] + 0x00000228u;
         /* 0208B01C */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 0208B020 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0208B024 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B020 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0208B024 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B024 */ _t3 = _t2 & 0x00000001u;
         /* 0208B024 */ if (_t3) goto L_0208B028; else goto L_0208B03C;
   L_0208B028: ; // 0x208b028
@@ -7103,8 +7103,8 @@ void Gambit_fn_0208B04C(CPUState* cpu) {
         /* 0208B0E0 */ Gambit_fn_020BDD60(cpu);
         /* 0208B0E4 */ _t15 = cpu->r[28] + 0x0000022Au;
         /* 0208B0E4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t15);
-        /* 0208B0E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208B0EC */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B0E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208B0EC */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B0EC */ _t17 = _t16 & 0x00000001u;
         /* 0208B0EC */ if (_t17) goto L_0208B0F0; else goto L_0208B0F8;
   L_0208B0F0: ; // 0x208b0f0
@@ -7189,8 +7189,8 @@ void Gambit_fn_0208B050(CPUState* cpu) {
         /* 0208B0E0 */ Gambit_fn_020BDD60(cpu);
         /* 0208B0E4 */ _t15 = cpu->r[28] + 0x0000022Au;
         /* 0208B0E4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t15);
-        /* 0208B0E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208B0EC */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B0E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208B0EC */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B0EC */ _t17 = _t16 & 0x00000001u;
         /* 0208B0EC */ if (_t17) goto L_0208B0F0; else goto L_0208B0F8;
   L_0208B0F0: ; // 0x208b0f0
@@ -7291,10 +7291,10 @@ void Gambit_fn_0208B154(CPUState* cpu) {
         /* 0208B190 */ _t5 = cpu->r[30] + 0x00000228u;
         /* 0208B190 */ rbrew_write8(cpu->mem, _t5, (uint8_t)cpu->r[31]);
         /* 0208B194 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0208B194 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0208B194 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0208B198 */ _t6 = cpu->r[30] + 0x00000229u;
         /* 0208B198 */ rbrew_write8(cpu->mem, _t6, (uint8_t)cpu->r[31]);
-        /* 0208B19C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B19C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B19C */ _t8 = _t7 & 0x00000001u;
         /* 0208B19C */ if (_t8) goto L_0208B1A0; else goto L_0208B1A4;
   L_0208B1A0: ; // 0x208b1a0
@@ -7340,10 +7340,10 @@ void Gambit_fn_0208B158(CPUState* cpu) {
         /* 0208B190 */ _t5 = cpu->r[30] + 0x00000228u;
         /* 0208B190 */ rbrew_write8(cpu->mem, _t5, (uint8_t)cpu->r[31]);
         /* 0208B194 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0208B194 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0208B194 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0208B198 */ _t6 = cpu->r[30] + 0x00000229u;
         /* 0208B198 */ rbrew_write8(cpu->mem, _t6, (uint8_t)cpu->r[31]);
-        /* 0208B19C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B19C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B19C */ _t8 = _t7 & 0x00000001u;
         /* 0208B19C */ if (_t8) goto L_0208B1A0; else goto L_0208B1A4;
   L_0208B1A0: ; // 0x208b1a0
@@ -7370,9 +7370,9 @@ void Gambit_fn_0208B1BC(CPUState* cpu) {
         /* 0208B1BC */ cpu->r[12] = rbrew_read8(cpu->mem, _t0);
         /* 0208B1C0 */ /* nop */
         /* 0208B1C4 */ cpu->r[0] = cpu->r[12] + 0xFFFFFFFEu;
-        /* 0208B1C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 0208B1C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 0208B1CC */ cpu->r[0] = 0x00000001u;
-        /* 0208B1D0 */ _t1 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208B1D0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208B1D0 */ _t2 = _t1 & 0x00000001u;
         /* 0208B1D0 */ if (_t2) goto L_0208B1D4; else goto L_0208B1D8;
   L_0208B1D4: ; // 0x208b1d4
@@ -7517,9 +7517,9 @@ void Gambit_fn_0208B2AC(CPUState* cpu) {
         /* 0208B32C */ Gambit_fn_026D86C0(cpu);
         /* 0208B330 */ _t8 = cpu->r[30] + 0xFFFFEDBCu;
         /* 0208B330 */ cpu->r[8] = rbrew_read32(cpu->mem, _t8);
-        /* 0208B334 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0208B334 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0208B338 */ cpu->r[29] = cpu->r[3];
-        /* 0208B33C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B33C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B33C */ _t10 = _t9 & 0x00000001u;
         /* 0208B33C */ if (_t10) goto L_0208B340; else goto L_0208B350;
   L_0208B340: ; // 0x208b340
@@ -7530,8 +7530,8 @@ void Gambit_fn_0208B2AC(CPUState* cpu) {
         /* 0208B34C */ _t12 = cpu->r[31] + 0xFFFFEE20u;
         /* 0208B34C */ rbrew_write32(cpu->mem, _t12, cpu->r[0]);
   L_0208B350: ; // 0x208b350
-        /* 0208B350 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0208B354 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B350 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0208B354 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B354 */ _t14 = _t13 & 0x00000001u;
         /* 0208B354 */ if (_t14) goto L_0208B378; else goto L_0208B358;
   L_0208B358: ; // 0x208b358
@@ -7543,17 +7543,17 @@ void Gambit_fn_0208B2AC(CPUState* cpu) {
         /* 0208B364 */ cpu->r[3] = cpu->r[29];
         /* 0208B368 */ cpu->r[4] = cpu->r[31] + 0xFFFFEE20u;
         /* 0208B36C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208B370 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208B374 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B370 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208B374 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B374 */ _t18 = _t17 & 0x00000001u;
         /* 0208B374 */ if (_t18) goto L_0208B378; else goto L_0208B37C;
   L_0208B378: ; // 0x208b378
         /* 0208B378 */ cpu->r[29] = 0x00000000u;
   L_0208B37C: ; // 0x208b37c
-        /* 0208B37C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0208B37C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0208B380 */ _t19 = cpu->r[28] + 0x00000000u;
         /* 0208B380 */ rbrew_write32(cpu->mem, _t19, cpu->r[29]);
-        /* 0208B384 */ _t20 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208B384 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208B384 */ _t21 = _t20 & 0x00000001u;
         /* 0208B384 */ if (_t21) goto L_0208B388; else goto L_0208B3BC;
   L_0208B388: ; // 0x208b388
@@ -7563,16 +7563,16 @@ void Gambit_fn_0208B2AC(CPUState* cpu) {
         /* 0208B390 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0208B394 */ cpu->r[23] = cpu->r[23] + 0x00000004u;
         /* 0208B398 */ cpu->r[21] = cpu->r[21] + 0x00000004u;
-        /* 0208B39C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000004u);
+        /* 0208B39C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000004u));
         /* 0208B3A0 */ cpu->r[24] = cpu->r[24] + 0x00000008u;
         /* 0208B3A4 */ _t23 = cpu->r[9] + 0x000001B7u;
         /* 0208B3A4 */ rbrew_write8(cpu->mem, _t23, (uint8_t)cpu->r[22]);
-        /* 0208B3A8 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208B3A8 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208B3A8 */ _t25 = _t24 & 0x00000001u;
         /* 0208B3A8 */ if (_t25) goto L_0208B3AC; else goto L_0208B3E0;
   L_0208B3AC: ; // 0x208b3ac
-        /* 0208B3AC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
-        /* 0208B3B0 */ _t26 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208B3AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
+        /* 0208B3B0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208B3B0 */ _t27 = _t26 & 0x00000001u;
         /* 0208B3B0 */ if (_t27) goto L_0208B314; else goto L_0208B3B4;
   L_0208B3B4: ; // 0x208b3b4
@@ -7586,10 +7586,10 @@ void Gambit_fn_0208B2AC(CPUState* cpu) {
         /* 0208B3C8 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0208B3CC */ _t29 = cpu->r[9] + 0x000001B7u;
         /* 0208B3CC */ rbrew_write8(cpu->mem, _t29, (uint8_t)cpu->r[22]);
-        /* 0208B3D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000004u);
+        /* 0208B3D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000004u));
         /* 0208B3D4 */ cpu->r[24] = cpu->r[24] + 0x00000008u;
         /* 0208B3D8 */ cpu->r[23] = cpu->r[23] + 0x00000004u;
-        /* 0208B3DC */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208B3DC */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208B3DC */ _t31 = _t30 & 0x00000001u;
         /* 0208B3DC */ if (_t31) goto L_0208B3AC; else goto L_0208B3E0;
   L_0208B3E0: ; // 0x208b3e0
@@ -7609,8 +7609,8 @@ void Gambit_fn_0208B2AC(CPUState* cpu) {
         /* 0208B408 */ _t35 = cpu->r[1] + 0x00000010u;
         /* 0208B408 */ rbrew_write32(cpu->mem, _t35, cpu->r[31]);
         /* 0208B40C */ Gambit_fn_027EBCFC(cpu);
-        /* 0208B410 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208B414 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B410 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208B414 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B414 */ _t37 = _t36 & 0x00000001u;
         /* 0208B414 */ if (_t37) goto L_0208B444; else goto L_0208B418;
   L_0208B418: ; // 0x208b418
@@ -7659,15 +7659,15 @@ void Gambit_fn_0208B458(CPUState* cpu) {
         /* 0208B474 */ _t5 = cpu->r[1] + 0x0000001Cu;
         /* 0208B474 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
         /* 0208B478 */ Gambit_fn_0208B1BC(cpu);
-        /* 0208B47C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208B480 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B47C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208B480 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B480 */ _t7 = _t6 & 0x00000001u;
         /* 0208B480 */ if (_t7) goto L_0208B5EC; else goto L_0208B484;
   L_0208B484: ; // 0x208b484
         /* 0208B484 */ _t8 = cpu->r[30] + 0x00000228u;
         /* 0208B484 */ cpu->r[9] = rbrew_read8(cpu->mem, _t8);
-        /* 0208B488 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0208B48C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B488 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0208B48C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B48C */ _t10 = _t9 & 0x00000001u;
         /* 0208B48C */ if (_t10) goto L_0208B490; else goto L_0208B5EC;
   L_0208B490: ; // 0x208b490
@@ -7683,20 +7683,20 @@ void Gambit_fn_0208B458(CPUState* cpu) {
         /* 0208B4A4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t13);
         /* 0208B4A8 */ cpu->ctr = cpu->r[0];
         /* 0208B4AC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208B4B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208B4B4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B4B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208B4B4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B4B4 */ _t15 = _t14 & 0x00000001u;
         /* 0208B4B4 */ if (_t15) goto L_0208B4B8; else goto L_0208B4EC;
   L_0208B4B8: ; // 0x208b4b8
         /* 0208B4B8 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 0208B4BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000004u);
+        /* 0208B4BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000004u));
         /* 0208B4C0 */ cpu->r[28] = cpu->r[28] + 0x00000004u;
-        /* 0208B4C4 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208B4C4 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208B4C4 */ _t17 = _t16 & 0x00000001u;
         /* 0208B4C4 */ if (_t17) goto L_0208B4C8; else goto L_0208B5EC;
   L_0208B4C8: ; // 0x208b4c8
-        /* 0208B4C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], 0x00000004u);
-        /* 0208B4CC */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208B4C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], 0x00000004u));
+        /* 0208B4CC */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208B4CC */ _t19 = _t18 & 0x00000001u;
         /* 0208B4CC */ if (_t19) goto L_0208B49C; else goto L_0208B4D0;
   L_0208B4D0: ; // 0x208b4d0
@@ -7708,8 +7708,8 @@ void Gambit_fn_0208B458(CPUState* cpu) {
         /* 0208B4D8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t22);
         /* 0208B4DC */ cpu->ctr = cpu->r[0];
         /* 0208B4E0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208B4E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208B4E8 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B4E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208B4E8 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B4E8 */ _t24 = _t23 & 0x00000001u;
         /* 0208B4E8 */ if (_t24) goto L_0208B4B8; else goto L_0208B4EC;
   L_0208B4EC: ; // 0x208b4ec
@@ -7722,18 +7722,18 @@ void Gambit_fn_0208B458(CPUState* cpu) {
         /* 0208B4FC */ Gambit_fn_0208B124(cpu);
         /* 0208B500 */ _t27 = cpu->r[30] + 0x00000224u;
         /* 0208B500 */ cpu->r[0] = rbrew_read32(cpu->mem, _t27);
-        /* 0208B504 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[0]);
-        /* 0208B508 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B504 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[0]));
+        /* 0208B508 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B508 */ _t29 = _t28 & 0x00000001u;
         /* 0208B508 */ if (_t29) goto L_0208B5EC; else goto L_0208B50C;
   L_0208B50C: ; // 0x208b50c
-        /* 0208B50C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000004u);
-        /* 0208B510 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208B50C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000004u));
+        /* 0208B510 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208B510 */ _t31 = _t30 & 0x00000001u;
         /* 0208B510 */ if (_t31) goto L_0208B514; else goto L_0208B5C8;
   L_0208B514: ; // 0x208b514
-        /* 0208B514 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000004u);
-        /* 0208B518 */ _t32 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208B514 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000004u));
+        /* 0208B518 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208B518 */ _t33 = _t32 & 0x00000001u;
         /* 0208B518 */ if (_t33) goto L_0208B51C; else goto L_0208B540;
   L_0208B51C: ; // 0x208b51c
@@ -7746,8 +7746,8 @@ void Gambit_fn_0208B458(CPUState* cpu) {
         /* 0208B528 */ cpu->r[6] = rbrew_read32(cpu->mem, _t36);
         /* 0208B52C */ cpu->ctr = cpu->r[6];
         /* 0208B530 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208B534 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208B538 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B534 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208B538 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B538 */ _t38 = _t37 & 0x00000001u;
         /* 0208B538 */ if (_t38) goto L_0208B5C8; else goto L_0208B53C;
   L_0208B53C: ; // 0x208b53c
@@ -7761,15 +7761,15 @@ void Gambit_fn_0208B458(CPUState* cpu) {
         /* 0208B548 */ cpu->r[6] = rbrew_read32(cpu->mem, _t41);
         /* 0208B54C */ cpu->ctr = cpu->r[6];
         /* 0208B550 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208B554 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208B558 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B554 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208B558 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B558 */ _t43 = _t42 & 0x00000001u;
         /* 0208B558 */ if (_t43) goto L_0208B5C8; else goto L_0208B55C;
   L_0208B55C: ; // 0x208b55c
         /* 0208B55C */ _t44 = cpu->r[30] + 0x00000224u;
         /* 0208B55C */ cpu->r[6] = rbrew_read32(cpu->mem, _t44);
-        /* 0208B560 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], 0x00000004u);
-        /* 0208B564 */ _t45 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208B560 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], 0x00000004u));
+        /* 0208B564 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208B564 */ _t46 = _t45 & 0x00000001u;
         /* 0208B564 */ if (_t46) goto L_0208B568; else goto L_0208B590;
   L_0208B568: ; // 0x208b568
@@ -7784,8 +7784,8 @@ void Gambit_fn_0208B458(CPUState* cpu) {
         /* 0208B57C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208B580 */ _t50 = cpu->r[30] + 0x00000224u;
         /* 0208B580 */ cpu->r[10] = rbrew_read32(cpu->mem, _t50);
-        /* 0208B584 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000004u);
-        /* 0208B588 */ _t51 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208B584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000004u));
+        /* 0208B588 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208B588 */ _t52 = _t51 & 0x00000001u;
         /* 0208B588 */ if (_t52) goto L_0208B5B0; else goto L_0208B58C;
   L_0208B58C: ; // 0x208b58c
@@ -7801,8 +7801,8 @@ void Gambit_fn_0208B458(CPUState* cpu) {
         /* 0208B5A0 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208B5A4 */ _t56 = cpu->r[30] + 0x00000224u;
         /* 0208B5A4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t56);
-        /* 0208B5A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000004u);
-        /* 0208B5AC */ _t57 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208B5A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000004u));
+        /* 0208B5AC */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208B5AC */ _t58 = _t57 & 0x00000001u;
         /* 0208B5AC */ if (_t58) goto L_0208B5B0; else goto L_0208B58C;
   L_0208B5B0: ; // 0x208b5b0
@@ -7818,10 +7818,10 @@ void Gambit_fn_0208B458(CPUState* cpu) {
         /* 0208B5C4 */ rbrew_write32(cpu->mem, _t61, cpu->r[11]);
   L_0208B5C8: ; // 0x208b5c8
         /* 0208B5C8 */ cpu->r[0] = cpu->r[29];
-        /* 0208B5CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 0208B5CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 0208B5D0 */ _t62 = cpu->r[30] + 0x00000224u;
         /* 0208B5D0 */ rbrew_write32(cpu->mem, _t62, cpu->r[0]);
-        /* 0208B5D4 */ _t63 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208B5D4 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208B5D4 */ _t64 = _t63 & 0x00000001u;
         /* 0208B5D4 */ if (_t64) goto L_0208B5EC; else goto L_0208B5D8;
   L_0208B5D8: ; // 0x208b5d8
@@ -7867,15 +7867,15 @@ void Gambit_fn_0208B45C(CPUState* cpu) {
         /* 0208B474 */ _t5 = cpu->r[1] + 0x0000001Cu;
         /* 0208B474 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
         /* 0208B478 */ Gambit_fn_0208B1BC(cpu);
-        /* 0208B47C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208B480 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B47C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208B480 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B480 */ _t7 = _t6 & 0x00000001u;
         /* 0208B480 */ if (_t7) goto L_0208B5EC; else goto L_0208B484;
   L_0208B484: ; // 0x208b484
         /* 0208B484 */ _t8 = cpu->r[30] + 0x00000228u;
         /* 0208B484 */ cpu->r[9] = rbrew_read8(cpu->mem, _t8);
-        /* 0208B488 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0208B48C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B488 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0208B48C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B48C */ _t10 = _t9 & 0x00000001u;
         /* 0208B48C */ if (_t10) goto L_0208B490; else goto L_0208B5EC;
   L_0208B490: ; // 0x208b490
@@ -7891,20 +7891,20 @@ void Gambit_fn_0208B45C(CPUState* cpu) {
         /* 0208B4A4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t13);
         /* 0208B4A8 */ cpu->ctr = cpu->r[0];
         /* 0208B4AC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208B4B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208B4B4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B4B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208B4B4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B4B4 */ _t15 = _t14 & 0x00000001u;
         /* 0208B4B4 */ if (_t15) goto L_0208B4B8; else goto L_0208B4EC;
   L_0208B4B8: ; // 0x208b4b8
         /* 0208B4B8 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 0208B4BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000004u);
+        /* 0208B4BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000004u));
         /* 0208B4C0 */ cpu->r[28] = cpu->r[28] + 0x00000004u;
-        /* 0208B4C4 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208B4C4 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208B4C4 */ _t17 = _t16 & 0x00000001u;
         /* 0208B4C4 */ if (_t17) goto L_0208B4C8; else goto L_0208B5EC;
   L_0208B4C8: ; // 0x208b4c8
-        /* 0208B4C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], 0x00000004u);
-        /* 0208B4CC */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208B4C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], 0x00000004u));
+        /* 0208B4CC */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208B4CC */ _t19 = _t18 & 0x00000001u;
         /* 0208B4CC */ if (_t19) goto L_0208B49C; else goto L_0208B4D0;
   L_0208B4D0: ; // 0x208b4d0
@@ -7916,8 +7916,8 @@ void Gambit_fn_0208B45C(CPUState* cpu) {
         /* 0208B4D8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t22);
         /* 0208B4DC */ cpu->ctr = cpu->r[0];
         /* 0208B4E0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208B4E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208B4E8 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B4E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208B4E8 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B4E8 */ _t24 = _t23 & 0x00000001u;
         /* 0208B4E8 */ if (_t24) goto L_0208B4B8; else goto L_0208B4EC;
   L_0208B4EC: ; // 0x208b4ec
@@ -7930,18 +7930,18 @@ void Gambit_fn_0208B45C(CPUState* cpu) {
         /* 0208B4FC */ Gambit_fn_0208B124(cpu);
         /* 0208B500 */ _t27 = cpu->r[30] + 0x00000224u;
         /* 0208B500 */ cpu->r[0] = rbrew_read32(cpu->mem, _t27);
-        /* 0208B504 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[0]);
-        /* 0208B508 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B504 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[0]));
+        /* 0208B508 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B508 */ _t29 = _t28 & 0x00000001u;
         /* 0208B508 */ if (_t29) goto L_0208B5EC; else goto L_0208B50C;
   L_0208B50C: ; // 0x208b50c
-        /* 0208B50C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000004u);
-        /* 0208B510 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208B50C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000004u));
+        /* 0208B510 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208B510 */ _t31 = _t30 & 0x00000001u;
         /* 0208B510 */ if (_t31) goto L_0208B514; else goto L_0208B5C8;
   L_0208B514: ; // 0x208b514
-        /* 0208B514 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000004u);
-        /* 0208B518 */ _t32 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208B514 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000004u));
+        /* 0208B518 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208B518 */ _t33 = _t32 & 0x00000001u;
         /* 0208B518 */ if (_t33) goto L_0208B51C; else goto L_0208B540;
   L_0208B51C: ; // 0x208b51c
@@ -7954,8 +7954,8 @@ void Gambit_fn_0208B45C(CPUState* cpu) {
         /* 0208B528 */ cpu->r[6] = rbrew_read32(cpu->mem, _t36);
         /* 0208B52C */ cpu->ctr = cpu->r[6];
         /* 0208B530 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208B534 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208B538 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B534 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208B538 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B538 */ _t38 = _t37 & 0x00000001u;
         /* 0208B538 */ if (_t38) goto L_0208B5C8; else goto L_0208B53C;
   L_0208B53C: ; // 0x208b53c
@@ -7969,15 +7969,15 @@ void Gambit_fn_0208B45C(CPUState* cpu) {
         /* 0208B548 */ cpu->r[6] = rbrew_read32(cpu->mem, _t41);
         /* 0208B54C */ cpu->ctr = cpu->r[6];
         /* 0208B550 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208B554 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208B558 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B554 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208B558 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B558 */ _t43 = _t42 & 0x00000001u;
         /* 0208B558 */ if (_t43) goto L_0208B5C8; else goto L_0208B55C;
   L_0208B55C: ; // 0x208b55c
         /* 0208B55C */ _t44 = cpu->r[30] + 0x00000224u;
         /* 0208B55C */ cpu->r[6] = rbrew_read32(cpu->mem, _t44);
-        /* 0208B560 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], 0x00000004u);
-        /* 0208B564 */ _t45 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208B560 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], 0x00000004u));
+        /* 0208B564 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208B564 */ _t46 = _t45 & 0x00000001u;
         /* 0208B564 */ if (_t46) goto L_0208B568; else goto L_0208B590;
   L_0208B568: ; // 0x208b568
@@ -7992,8 +7992,8 @@ void Gambit_fn_0208B45C(CPUState* cpu) {
         /* 0208B57C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208B580 */ _t50 = cpu->r[30] + 0x00000224u;
         /* 0208B580 */ cpu->r[10] = rbrew_read32(cpu->mem, _t50);
-        /* 0208B584 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000004u);
-        /* 0208B588 */ _t51 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208B584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000004u));
+        /* 0208B588 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208B588 */ _t52 = _t51 & 0x00000001u;
         /* 0208B588 */ if (_t52) goto L_0208B5B0; else goto L_0208B58C;
   L_0208B58C: ; // 0x208b58c
@@ -8009,8 +8009,8 @@ void Gambit_fn_0208B45C(CPUState* cpu) {
         /* 0208B5A0 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208B5A4 */ _t56 = cpu->r[30] + 0x00000224u;
         /* 0208B5A4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t56);
-        /* 0208B5A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000004u);
-        /* 0208B5AC */ _t57 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208B5A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000004u));
+        /* 0208B5AC */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208B5AC */ _t58 = _t57 & 0x00000001u;
         /* 0208B5AC */ if (_t58) goto L_0208B5B0; else goto L_0208B58C;
   L_0208B5B0: ; // 0x208b5b0
@@ -8026,10 +8026,10 @@ void Gambit_fn_0208B45C(CPUState* cpu) {
         /* 0208B5C4 */ rbrew_write32(cpu->mem, _t61, cpu->r[11]);
   L_0208B5C8: ; // 0x208b5c8
         /* 0208B5C8 */ cpu->r[0] = cpu->r[29];
-        /* 0208B5CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 0208B5CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 0208B5D0 */ _t62 = cpu->r[30] + 0x00000224u;
         /* 0208B5D0 */ rbrew_write32(cpu->mem, _t62, cpu->r[0]);
-        /* 0208B5D4 */ _t63 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208B5D4 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208B5D4 */ _t64 = _t63 & 0x00000001u;
         /* 0208B5D4 */ if (_t64) goto L_0208B5EC; else goto L_0208B5D8;
   L_0208B5D8: ; // 0x208b5d8
@@ -8075,8 +8075,8 @@ void Gambit_fn_0208B60C(CPUState* cpu) {
         /* 0208B628 */ _t4 = cpu->r[3] + 0x00000229u;
         /* 0208B628 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[30]);
         /* 0208B62C */ Gambit_fn_0208B1BC(cpu);
-        /* 0208B630 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208B634 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B630 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208B634 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B634 */ _t6 = _t5 & 0x00000001u;
         /* 0208B634 */ if (_t6) goto L_0208B698; else goto L_0208B638;
   L_0208B638: ; // 0x208b638
@@ -8084,16 +8084,16 @@ void Gambit_fn_0208B60C(CPUState* cpu) {
         /* 0208B63C */ Gambit_fn_0208B458(cpu);
         /* 0208B640 */ _t7 = cpu->r[31] + 0x00000228u;
         /* 0208B640 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
-        /* 0208B644 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208B648 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B644 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208B648 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B648 */ _t9 = _t8 & 0x00000001u;
         /* 0208B648 */ if (_t9) goto L_0208B698; else goto L_0208B64C;
   L_0208B64C: ; // 0x208b64c
         /* 0208B64C */ _t10 = cpu->r[31] + 0x00000224u;
         /* 0208B64C */ cpu->r[9] = rbrew_read32(cpu->mem, _t10);
-        /* 0208B650 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000004u);
+        /* 0208B650 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000004u));
         /* 0208B654 */ cpu->r[12] = cpu->r[31] + 0x00000214u;
-        /* 0208B658 */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208B658 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208B658 */ _t12 = _t11 & 0x00000001u;
         /* 0208B658 */ if (_t12) goto L_0208B65C; else goto L_0208B664;
   L_0208B65C: ; // 0x208b65c
@@ -8108,15 +8108,15 @@ void Gambit_fn_0208B60C(CPUState* cpu) {
         /* 0208B66C */ cpu->r[10] = rbrew_read32(cpu->mem, _t15);
         /* 0208B670 */ cpu->ctr = cpu->r[10];
         /* 0208B674 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208B678 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208B67C */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B678 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208B67C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B67C */ _t17 = _t16 & 0x00000001u;
         /* 0208B67C */ if (_t17) goto L_0208B698; else goto L_0208B680;
   L_0208B680: ; // 0x208b680
         /* 0208B680 */ _t18 = cpu->r[31] + 0x0000022Au;
         /* 0208B680 */ cpu->r[0] = rbrew_read8(cpu->mem, _t18);
-        /* 0208B684 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208B688 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B684 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208B688 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B688 */ _t20 = _t19 & 0x00000001u;
         /* 0208B688 */ if (_t20) goto L_0208B68C; else goto L_0208B698;
   L_0208B68C: ; // 0x208b68c
@@ -8155,8 +8155,8 @@ void Gambit_fn_0208B610(CPUState* cpu) {
         /* 0208B628 */ _t4 = cpu->r[3] + 0x00000229u;
         /* 0208B628 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[30]);
         /* 0208B62C */ Gambit_fn_0208B1BC(cpu);
-        /* 0208B630 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208B634 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B630 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208B634 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B634 */ _t6 = _t5 & 0x00000001u;
         /* 0208B634 */ if (_t6) goto L_0208B698; else goto L_0208B638;
   L_0208B638: ; // 0x208b638
@@ -8164,16 +8164,16 @@ void Gambit_fn_0208B610(CPUState* cpu) {
         /* 0208B63C */ Gambit_fn_0208B458(cpu);
         /* 0208B640 */ _t7 = cpu->r[31] + 0x00000228u;
         /* 0208B640 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
-        /* 0208B644 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208B648 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B644 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208B648 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B648 */ _t9 = _t8 & 0x00000001u;
         /* 0208B648 */ if (_t9) goto L_0208B698; else goto L_0208B64C;
   L_0208B64C: ; // 0x208b64c
         /* 0208B64C */ _t10 = cpu->r[31] + 0x00000224u;
         /* 0208B64C */ cpu->r[9] = rbrew_read32(cpu->mem, _t10);
-        /* 0208B650 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000004u);
+        /* 0208B650 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000004u));
         /* 0208B654 */ cpu->r[12] = cpu->r[31] + 0x00000214u;
-        /* 0208B658 */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208B658 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208B658 */ _t12 = _t11 & 0x00000001u;
         /* 0208B658 */ if (_t12) goto L_0208B65C; else goto L_0208B664;
   L_0208B65C: ; // 0x208b65c
@@ -8188,15 +8188,15 @@ void Gambit_fn_0208B610(CPUState* cpu) {
         /* 0208B66C */ cpu->r[10] = rbrew_read32(cpu->mem, _t15);
         /* 0208B670 */ cpu->ctr = cpu->r[10];
         /* 0208B674 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208B678 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208B67C */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B678 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208B67C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B67C */ _t17 = _t16 & 0x00000001u;
         /* 0208B67C */ if (_t17) goto L_0208B698; else goto L_0208B680;
   L_0208B680: ; // 0x208b680
         /* 0208B680 */ _t18 = cpu->r[31] + 0x0000022Au;
         /* 0208B680 */ cpu->r[0] = rbrew_read8(cpu->mem, _t18);
-        /* 0208B684 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208B688 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B684 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208B688 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B688 */ _t20 = _t19 & 0x00000001u;
         /* 0208B688 */ if (_t20) goto L_0208B68C; else goto L_0208B698;
   L_0208B68C: ; // 0x208b68c
@@ -8231,8 +8231,8 @@ void Gambit_fn_0208B6B4(CPUState* cpu) {
         /* 0208B6C0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0208B6C4 */ _t3 = cpu->r[31] + 0x000001E4u;
         /* 0208B6C4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
-        /* 0208B6C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0208B6CC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B6C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0208B6CC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B6CC */ _t5 = _t4 & 0x00000001u;
         /* 0208B6CC */ if (_t5) goto L_0208B6D0; else goto L_0208B718;
   L_0208B6D0: ; // 0x208b6d0
@@ -8263,15 +8263,15 @@ void Gambit_fn_0208B6B4(CPUState* cpu) {
         /* 0208B718 */ cpu->r[3] = cpu->r[31];
         /* 0208B71C */ cpu->r[4] = 0x00000000u;
         /* 0208B720 */ Gambit_fn_027EDF00(cpu);
-        /* 0208B724 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208B728 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B724 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208B728 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B728 */ _t12 = _t11 & 0x00000001u;
         /* 0208B728 */ if (_t12) goto L_0208B770; else goto L_0208B72C;
   L_0208B72C: ; // 0x208b72c
         /* 0208B72C */ _t13 = cpu->r[31] + 0x0000022Au;
         /* 0208B72C */ cpu->r[10] = rbrew_read8(cpu->mem, _t13);
-        /* 0208B730 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0208B734 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B730 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0208B734 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B734 */ _t15 = _t14 & 0x00000001u;
         /* 0208B734 */ if (_t15) goto L_0208B738; else goto L_0208B740;
   L_0208B738: ; // 0x208b738
@@ -8280,8 +8280,8 @@ void Gambit_fn_0208B6B4(CPUState* cpu) {
   L_0208B740: ; // 0x208b740
         /* 0208B740 */ _t16 = cpu->r[31] + 0x0000022Cu;
         /* 0208B740 */ cpu->r[9] = rbrew_read32(cpu->mem, _t16);
-        /* 0208B744 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0208B748 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B744 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0208B748 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B748 */ _t18 = _t17 & 0x00000001u;
         /* 0208B748 */ if (_t18) goto L_0208B74C; else goto L_0208B75C;
   L_0208B74C: ; // 0x208b74c
@@ -8290,8 +8290,8 @@ void Gambit_fn_0208B6B4(CPUState* cpu) {
         /* 0208B754 */ Gambit_fn_0208BF04(cpu);
         /* 0208B758 */ goto L_0208B770;
   L_0208B75C: ; // 0x208b75c
-        /* 0208B75C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000001u);
-        /* 0208B760 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B75C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000001u));
+        /* 0208B760 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B760 */ _t20 = _t19 & 0x00000001u;
         /* 0208B760 */ if (_t20) goto L_0208B764; else goto L_0208B770;
   L_0208B764: ; // 0x208b764
@@ -8323,8 +8323,8 @@ void Gambit_fn_0208B798(CPUState* cpu) {
         /* 0208B7A4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0208B7A8 */ _t3 = cpu->r[31] + 0x000001E4u;
         /* 0208B7A8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t3);
-        /* 0208B7AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0208B7B0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B7AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0208B7B0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B7B0 */ _t5 = _t4 & 0x00000001u;
         /* 0208B7B0 */ if (_t5) goto L_0208B7B4; else goto L_0208B7E4;
   L_0208B7B4: ; // 0x208b7b4
@@ -8347,8 +8347,8 @@ void Gambit_fn_0208B798(CPUState* cpu) {
         /* 0208B7E4 */ cpu->r[3] = cpu->r[31];
         /* 0208B7E8 */ cpu->r[4] = 0x00000000u;
         /* 0208B7EC */ Gambit_fn_027EDF00(cpu);
-        /* 0208B7F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208B7F4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B7F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208B7F4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B7F4 */ _t10 = _t9 & 0x00000001u;
         /* 0208B7F4 */ if (_t10) goto L_0208B80C; else goto L_0208B7F8;
   L_0208B7F8: ; // 0x208b7f8
@@ -8410,15 +8410,15 @@ void Gambit_fn_0208B874(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0208B874: ; // 0x208b874
-        /* 0208B874 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208B878 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B874 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208B878 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B878 */ _t1 = _t0 & 0x00000001u;
         /* 0208B878 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208B878 */ goto L_0208B87C;
   L_0208B87C: ; // 0x208b87c
         /* 0208B87C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0208B87C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208B880 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B87C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208B880 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B880 */ _t3 = _t2 & 0x00000001u;
         /* 0208B880 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208B880 */ goto L_0208B884;
@@ -8437,8 +8437,8 @@ void Gambit_fn_0208B874(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -8452,15 +8452,15 @@ void Gambit_fn_0208B874(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -8497,11 +8497,11 @@ void Gambit_fn_0208B888(CPUState* cpu) {
         /* 0208B894 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0208B894 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0208B898 */ cpu->r[30] = cpu->r[3];
-        /* 0208B898 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0208B898 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0208B89C */ cpu->r[31] = cpu->r[4];
         /* 0208B8A0 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0208B8A0 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0208B8A4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B8A4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B8A4 */ _t5 = _t4 & 0x00000001u;
         /* 0208B8A4 */ if (_t5) goto L_0208B8E8; else goto L_0208B8A8;
   L_0208B8A8: ; // 0x208b8a8
@@ -8521,8 +8521,8 @@ void Gambit_fn_0208B888(CPUState* cpu) {
         /* 0208B8D0 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 0208B8D4 */ Gambit_fn_02068798(cpu);
         /* 0208B8D8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0208B8D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208B8DC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B8D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208B8DC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B8DC */ _t10 = _t9 & 0x00000001u;
         /* 0208B8DC */ if (_t10) goto L_0208B8E8; else goto L_0208B8E0;
   L_0208B8E0: ; // 0x208b8e0
@@ -8553,11 +8553,11 @@ void Gambit_fn_0208B88C(CPUState* cpu) {
         /* 0208B894 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0208B894 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0208B898 */ cpu->r[30] = cpu->r[3];
-        /* 0208B898 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0208B898 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0208B89C */ cpu->r[31] = cpu->r[4];
         /* 0208B8A0 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0208B8A0 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0208B8A4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B8A4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B8A4 */ _t5 = _t4 & 0x00000001u;
         /* 0208B8A4 */ if (_t5) goto L_0208B8E8; else goto L_0208B8A8;
   L_0208B8A8: ; // 0x208b8a8
@@ -8577,8 +8577,8 @@ void Gambit_fn_0208B88C(CPUState* cpu) {
         /* 0208B8D0 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 0208B8D4 */ Gambit_fn_02068798(cpu);
         /* 0208B8D8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0208B8D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208B8DC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B8D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208B8DC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B8DC */ _t10 = _t9 & 0x00000001u;
         /* 0208B8DC */ if (_t10) goto L_0208B8E8; else goto L_0208B8E0;
   L_0208B8E0: ; // 0x208b8e0
@@ -8633,15 +8633,15 @@ void Gambit_fn_0208B918(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0208B918: ; // 0x208b918
-        /* 0208B918 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208B91C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208B91C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B91C */ _t1 = _t0 & 0x00000001u;
         /* 0208B91C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208B91C */ goto L_0208B920;
   L_0208B920: ; // 0x208b920
         /* 0208B920 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0208B920 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208B924 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B920 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208B924 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B924 */ _t3 = _t2 & 0x00000001u;
         /* 0208B924 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208B924 */ goto L_0208B928;
@@ -8660,8 +8660,8 @@ void Gambit_fn_0208B918(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -8675,15 +8675,15 @@ void Gambit_fn_0208B918(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -8729,15 +8729,15 @@ void Gambit_fn_0208B948(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0208B948: ; // 0x208b948
-        /* 0208B948 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208B94C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B948 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208B94C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B94C */ _t1 = _t0 & 0x00000001u;
         /* 0208B94C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208B94C */ goto L_0208B950;
   L_0208B950: ; // 0x208b950
         /* 0208B950 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0208B950 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208B954 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B950 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208B954 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B954 */ _t3 = _t2 & 0x00000001u;
         /* 0208B954 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208B954 */ goto L_0208B958;
@@ -8756,8 +8756,8 @@ void Gambit_fn_0208B948(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -8771,15 +8771,15 @@ void Gambit_fn_0208B948(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -8807,15 +8807,15 @@ void Gambit_fn_0208B95C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0208B95C: ; // 0x208b95c
-        /* 0208B95C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208B960 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B95C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208B960 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B960 */ _t1 = _t0 & 0x00000001u;
         /* 0208B960 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208B960 */ goto L_0208B964;
   L_0208B964: ; // 0x208b964
         /* 0208B964 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0208B964 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208B968 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B964 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208B968 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B968 */ _t3 = _t2 & 0x00000001u;
         /* 0208B968 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208B968 */ goto L_0208B96C;
@@ -8834,8 +8834,8 @@ void Gambit_fn_0208B95C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -8849,15 +8849,15 @@ void Gambit_fn_0208B95C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -8885,15 +8885,15 @@ void Gambit_fn_0208B970(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0208B970: ; // 0x208b970
-        /* 0208B970 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208B974 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B970 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208B974 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B974 */ _t1 = _t0 & 0x00000001u;
         /* 0208B974 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208B974 */ goto L_0208B978;
   L_0208B978: ; // 0x208b978
         /* 0208B978 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0208B978 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208B97C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B978 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208B97C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B97C */ _t3 = _t2 & 0x00000001u;
         /* 0208B97C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208B97C */ goto L_0208B980;
@@ -8912,8 +8912,8 @@ void Gambit_fn_0208B970(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -8927,15 +8927,15 @@ void Gambit_fn_0208B970(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -8963,15 +8963,15 @@ void Gambit_fn_0208B984(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0208B984: ; // 0x208b984
-        /* 0208B984 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208B988 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B984 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208B988 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B988 */ _t1 = _t0 & 0x00000001u;
         /* 0208B988 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208B988 */ goto L_0208B98C;
   L_0208B98C: ; // 0x208b98c
         /* 0208B98C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0208B98C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208B990 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B98C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208B990 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B990 */ _t3 = _t2 & 0x00000001u;
         /* 0208B990 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208B990 */ goto L_0208B994;
@@ -8990,8 +8990,8 @@ void Gambit_fn_0208B984(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -9005,15 +9005,15 @@ void Gambit_fn_0208B984(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -9113,9 +9113,9 @@ void Gambit_fn_0208B9D4(CPUState* cpu) {
         /* 0208B9D8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 0208B9D8 */ cpu->r[9] = _t0;
         /* 0208B9DC */ cpu->r[12] = 0x101D0000u;
-        /* 0208B9E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0208B9E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0208B9E4 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 0208B9E8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208B9E8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208B9E8 */ _t2 = _t1 & 0x00000001u;
         /* 0208B9E8 */ if (_t2) goto L_0208B9EC; else goto L_0208BA00;
   L_0208B9EC: ; // 0x208b9ec
@@ -9127,8 +9127,8 @@ void Gambit_fn_0208B9D4(CPUState* cpu) {
         /* 0208B9FC */ _t4 = cpu->r[12] + 0x00000000u;
         /* 0208B9FC */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_0208BA00: ; // 0x208ba00
-        /* 0208BA00 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0208BA04 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208BA00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0208BA04 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208BA04 */ _t6 = _t5 & 0x00000001u;
         /* 0208BA04 */ if (_t6) goto L_0208BA08; else goto L_0208BA10;
   L_0208BA08: ; // 0x208ba08
@@ -9140,9 +9140,9 @@ void Gambit_fn_0208B9D4(CPUState* cpu) {
         /* 0208BA14 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 0208BA14 */ cpu->r[7] = _t7;
         /* 0208BA18 */ cpu->r[11] = 0x101D0000u;
-        /* 0208BA1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0208BA1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0208BA20 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 0208BA24 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208BA24 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208BA24 */ _t9 = _t8 & 0x00000001u;
         /* 0208BA24 */ if (_t9) goto L_0208BA28; else goto L_0208BA3C;
   L_0208BA28: ; // 0x208ba28
@@ -9287,18 +9287,18 @@ void Gambit_fn_0208BAB0(CPUState* cpu) {
         /* 0208C018 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0208C018 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0208C01C */ cpu->r[12] = 0x00000000u;
-        /* 0208C020 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208C020 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208C024 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0208C024 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0208C028 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C028 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C028 */ _t6 = _t5 & 0x00000001u;
         /* 0208C028 */ if (_t6) goto L_0208C050; else goto L_0208C02C;
   L_0208C02C: ; // 0x208c02c
         /* 0208C02C */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0208C02C */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0208C030 */ /* nop */
-        /* 0208C034 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0208C038 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C034 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0208C038 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C038 */ _t9 = _t8 & 0x00000001u;
         /* 0208C038 */ if (_t9) goto L_0208C03C; else goto L_0208C050;
   L_0208C03C: ; // 0x208c03c
@@ -9343,10 +9343,10 @@ void Gambit_fn_0208BABC(CPUState* cpu) {
         /* 0208BADC */ cpu->r[31] = 0x101D0000u;
         /* 0208BAE0 */ _t3 = cpu->r[28] + 0x0000001Cu;
         /* 0208BAE0 */ rbrew_write32(cpu->mem, _t3, cpu->r[4]);
-        /* 0208BAE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0208BAE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0208BAE8 */ _t4 = cpu->r[28] + 0x0000000Fu;
         /* 0208BAE8 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[27]);
-        /* 0208BAEC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208BAEC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208BAEC */ _t6 = _t5 & 0x00000001u;
         /* 0208BAEC */ if (_t6) goto L_0208BB30; else goto L_0208BAF0;
   L_0208BAF0: ; // 0x208baf0
@@ -9361,16 +9361,16 @@ void Gambit_fn_0208BABC(CPUState* cpu) {
         /* 0208BB04 */ cpu->r[5] = 0x00000004u;
         /* 0208BB08 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 0208BB0C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208BB10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0208BB10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0208BB14 */ cpu->r[0] = cpu->r[27];
-        /* 0208BB18 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208BB18 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208BB18 */ _t11 = _t10 & 0x00000001u;
         /* 0208BB18 */ if (_t11) goto L_0208BB20; else goto L_0208BB1C;
   L_0208BB1C: ; // 0x208bb1c
         /* 0208BB1C */ cpu->r[0] = 0x00000001u;
   L_0208BB20: ; // 0x208bb20
-        /* 0208BB20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208BB24 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208BB20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208BB24 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208BB24 */ _t13 = _t12 & 0x00000001u;
         /* 0208BB24 */ if (_t13) goto L_0208BB30; else goto L_0208BB28;
   L_0208BB28: ; // 0x208bb28
@@ -9382,9 +9382,9 @@ void Gambit_fn_0208BABC(CPUState* cpu) {
         /* 0208BB30 */ _t16 = cpu->r[28] + 0x00000020u;
         /* 0208BB30 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 0208BB34 */ cpu->r[0] = 0x00000000u;
-        /* 0208BB38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0208BB38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0208BB3C */ cpu->r[12] = cpu->r[0];
-        /* 0208BB40 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208BB40 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208BB40 */ _t18 = _t17 & 0x00000001u;
         /* 0208BB40 */ if (_t18) goto L_0208BB44; else goto L_0208BB68;
   L_0208BB44: ; // 0x208bb44
@@ -9409,8 +9409,8 @@ void Gambit_fn_0208BABC(CPUState* cpu) {
   L_0208BB68: ; // 0x208bb68
         /* 0208BB68 */ _t26 = cpu->r[28] + 0x0000000Fu;
         /* 0208BB68 */ cpu->r[27] = rbrew_read8(cpu->mem, _t26);
-        /* 0208BB6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0208BB70 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208BB6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0208BB70 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208BB70 */ _t28 = _t27 & 0x00000001u;
         /* 0208BB70 */ if (_t28) goto L_0208BBB4; else goto L_0208BB74;
   L_0208BB74: ; // 0x208bb74
@@ -9425,16 +9425,16 @@ void Gambit_fn_0208BABC(CPUState* cpu) {
         /* 0208BB88 */ cpu->r[5] = 0x00000004u;
         /* 0208BB8C */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 0208BB90 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208BB94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0208BB94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0208BB98 */ cpu->r[11] = cpu->r[27];
-        /* 0208BB9C */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208BB9C */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208BB9C */ _t33 = _t32 & 0x00000001u;
         /* 0208BB9C */ if (_t33) goto L_0208BBA4; else goto L_0208BBA0;
   L_0208BBA0: ; // 0x208bba0
         /* 0208BBA0 */ cpu->r[11] = 0x00000001u;
   L_0208BBA4: ; // 0x208bba4
-        /* 0208BBA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208BBA8 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208BBA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208BBA8 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208BBA8 */ _t35 = _t34 & 0x00000001u;
         /* 0208BBA8 */ if (_t35) goto L_0208BBB4; else goto L_0208BBAC;
   L_0208BBAC: ; // 0x208bbac
@@ -9446,9 +9446,9 @@ void Gambit_fn_0208BABC(CPUState* cpu) {
         /* 0208BBB4 */ _t38 = cpu->r[28] + 0x00000028u;
         /* 0208BBB4 */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 0208BBB8 */ cpu->r[0] = 0x00000000u;
-        /* 0208BBBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 0208BBBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 0208BBC0 */ cpu->r[12] = cpu->r[0];
-        /* 0208BBC4 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208BBC4 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208BBC4 */ _t40 = _t39 & 0x00000001u;
         /* 0208BBC4 */ if (_t40) goto L_0208BBC8; else goto L_0208BBEC;
   L_0208BBC8: ; // 0x208bbc8
@@ -9473,8 +9473,8 @@ void Gambit_fn_0208BABC(CPUState* cpu) {
   L_0208BBEC: ; // 0x208bbec
         /* 0208BBEC */ _t48 = cpu->r[28] + 0x0000000Fu;
         /* 0208BBEC */ cpu->r[27] = rbrew_read8(cpu->mem, _t48);
-        /* 0208BBF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0208BBF4 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208BBF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0208BBF4 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208BBF4 */ _t50 = _t49 & 0x00000001u;
         /* 0208BBF4 */ if (_t50) goto L_0208BC38; else goto L_0208BBF8;
   L_0208BBF8: ; // 0x208bbf8
@@ -9489,16 +9489,16 @@ void Gambit_fn_0208BABC(CPUState* cpu) {
         /* 0208BC0C */ cpu->r[5] = 0x00000004u;
         /* 0208BC10 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 0208BC14 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208BC18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0208BC18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0208BC1C */ cpu->r[10] = cpu->r[27];
-        /* 0208BC20 */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208BC20 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208BC20 */ _t55 = _t54 & 0x00000001u;
         /* 0208BC20 */ if (_t55) goto L_0208BC28; else goto L_0208BC24;
   L_0208BC24: ; // 0x208bc24
         /* 0208BC24 */ cpu->r[10] = 0x00000001u;
   L_0208BC28: ; // 0x208bc28
-        /* 0208BC28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208BC2C */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208BC28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208BC2C */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208BC2C */ _t57 = _t56 & 0x00000001u;
         /* 0208BC2C */ if (_t57) goto L_0208BC38; else goto L_0208BC30;
   L_0208BC30: ; // 0x208bc30
@@ -9510,9 +9510,9 @@ void Gambit_fn_0208BABC(CPUState* cpu) {
         /* 0208BC38 */ _t60 = cpu->r[28] + 0x00000030u;
         /* 0208BC38 */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
         /* 0208BC3C */ cpu->r[0] = 0x00000000u;
-        /* 0208BC40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0208BC40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0208BC44 */ cpu->r[5] = cpu->r[0];
-        /* 0208BC48 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208BC48 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208BC48 */ _t62 = _t61 & 0x00000001u;
         /* 0208BC48 */ if (_t62) goto L_0208BC4C; else goto L_0208BC70;
   L_0208BC4C: ; // 0x208bc4c
@@ -9537,8 +9537,8 @@ void Gambit_fn_0208BABC(CPUState* cpu) {
   L_0208BC70: ; // 0x208bc70
         /* 0208BC70 */ _t70 = cpu->r[30] + 0x00000000u;
         /* 0208BC70 */ cpu->r[25] = rbrew_read8(cpu->mem, _t70);
-        /* 0208BC74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 0208BC78 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208BC74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 0208BC78 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208BC78 */ _t72 = _t71 & 0x00000001u;
         /* 0208BC78 */ if (_t72) goto L_0208BD54; else goto L_0208BC7C;
   L_0208BC7C: ; // 0x208bc7c
@@ -9554,10 +9554,10 @@ void Gambit_fn_0208BABC(CPUState* cpu) {
         /* 0208BC94 */ cpu->r[4] = (uint32_t)((int32_t)cpu->r[25] * (int32_t)0x00000024u);
         /* 0208BC98 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208BC9C */ cpu->r[24] = cpu->r[3];
-        /* 0208BCA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 0208BCA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 0208BCA4 */ cpu->r[30] = cpu->r[25];
         /* 0208BCA8 */ cpu->r[7] = 0x00000000u;
-        /* 0208BCAC */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208BCAC */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208BCAC */ _t77 = _t76 & 0x00000001u;
         /* 0208BCAC */ if (_t77) goto L_0208BCB4; else goto L_0208BCB0;
   L_0208BCB0: ; // 0x208bcb0
@@ -9570,36 +9570,36 @@ void Gambit_fn_0208BABC(CPUState* cpu) {
         /* 0208BCC0 */ cpu->r[23] = 0x00000018u;
   L_0208BCC4: ; // 0x208bcc4
         /* 0208BCC4 */ cpu->r[27] = cpu->r[24] + cpu->r[22];
-        /* 0208BCC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0208BCC8 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208BCC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0208BCC8 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208BCC8 */ _t80 = _t79 & 0x00000001u;
         /* 0208BCC8 */ if (_t80) goto L_0208BD38; else goto L_0208BCCC;
   L_0208BCCC: ; // 0x208bccc
         /* 0208BCCC */ cpu->r[26] = cpu->r[27];
-        /* 0208BCCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0208BCD0 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208BCCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0208BCD0 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208BCD0 */ _t82 = _t81 & 0x00000001u;
         /* 0208BCD0 */ if (_t82) goto L_0208BCD4; else goto L_0208BCE4;
   L_0208BCD4: ; // 0x208bcd4
         /* 0208BCD4 */ cpu->r[3] = 0x00000024u;
         /* 0208BCD8 */ Gambit_fn_02801A78(cpu);
         /* 0208BCDC */ cpu->r[26] = cpu->r[3];
-        /* 0208BCDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0208BCE0 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208BCDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0208BCE0 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208BCE0 */ _t84 = _t83 & 0x00000001u;
         /* 0208BCE0 */ if (_t84) goto L_0208BD2C; else goto L_0208BCE4;
   L_0208BCE4: ; // 0x208bce4
         /* 0208BCE4 */ cpu->r[11] = cpu->r[26];
-        /* 0208BCE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0208BCE8 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208BCE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0208BCE8 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208BCE8 */ _t86 = _t85 & 0x00000001u;
         /* 0208BCE8 */ if (_t86) goto L_0208BCEC; else goto L_0208BCFC;
   L_0208BCEC: ; // 0x208bcec
         /* 0208BCEC */ cpu->r[3] = 0x0000000Cu;
         /* 0208BCF0 */ Gambit_fn_02801A78(cpu);
         /* 0208BCF4 */ cpu->r[11] = cpu->r[3];
-        /* 0208BCF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0208BCF8 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208BCF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0208BCF8 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208BCF8 */ _t88 = _t87 & 0x00000001u;
         /* 0208BCF8 */ if (_t88) goto L_0208BD18; else goto L_0208BCFC;
   L_0208BCFC: ; // 0x208bcfc
@@ -9630,14 +9630,14 @@ void Gambit_fn_0208BABC(CPUState* cpu) {
         /* 0208BD34 */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
   L_0208BD38: ; // 0x208bd38
         /* 0208BD38 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 0208BD38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0208BD38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0208BD3C */ cpu->r[22] = cpu->r[22] + 0x00000024u;
-        /* 0208BD40 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208BD40 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208BD40 */ _t98 = _t97 & 0x00000001u;
         /* 0208BD40 */ if (_t98) goto L_0208BD44; else goto L_0208BCC4;
   L_0208BD44: ; // 0x208bd44
-        /* 0208BD44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 0208BD48 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208BD44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 0208BD48 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208BD48 */ _t100 = _t99 & 0x00000001u;
         /* 0208BD48 */ if (_t100) goto L_0208BD54; else goto L_0208BD4C;
   L_0208BD4C: ; // 0x208bd4c
@@ -9667,10 +9667,10 @@ void Gambit_fn_0208BD6C(CPUState* cpu) {
         /* 0208BD70 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 0208BD74 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 0208BD74 */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 0208BD78 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[12]);
+        /* 0208BD78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[12]));
         /* 0208BD7C */ _t3 = cpu->r[4] + 0x00000000u;
         /* 0208BD7C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 0208BD80 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208BD80 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208BD80 */ _t5 = _t4 & 0x00000001u;
         /* 0208BD80 */ if (_t5) goto L_0208BD84; else goto L_0208BD8C;
   L_0208BD84: ; // 0x208bd84
@@ -9687,10 +9687,10 @@ void Gambit_fn_0208BD6C(CPUState* cpu) {
         /* 0208BD98 */ cpu->r[9] = rbrew_read8(cpu->mem, _t9);
         /* 0208BD9C */ _t10 = cpu->r[3] + 0x00000028u;
         /* 0208BD9C */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 0208BDA0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
+        /* 0208BDA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
         /* 0208BDA4 */ _t11 = cpu->r[3] + 0x0000002Cu;
         /* 0208BDA4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
-        /* 0208BDA8 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208BDA8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208BDA8 */ _t13 = _t12 & 0x00000001u;
         /* 0208BDA8 */ if (_t13) goto L_0208BDAC; else goto L_0208BDB4;
   L_0208BDAC: ; // 0x208bdac
@@ -9711,10 +9711,10 @@ void Gambit_fn_0208BD6C(CPUState* cpu) {
         /* 0208BDC8 */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
         /* 0208BDCC */ _t20 = cpu->r[3] + 0x00000034u;
         /* 0208BDCC */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 0208BDD0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
+        /* 0208BDD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
         /* 0208BDD4 */ _t21 = cpu->r[6] + 0x00000000u;
         /* 0208BDD4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
-        /* 0208BDD8 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208BDD8 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208BDD8 */ _t23 = _t22 & 0x00000001u;
         /* 0208BDD8 */ if (_t23) goto L_0208BDDC; else goto L_0208BDE4;
   L_0208BDDC: ; // 0x208bddc
@@ -9741,10 +9741,10 @@ void Gambit_fn_0208BDF4(CPUState* cpu) {
         /* 0208BDFC */ _t1 = cpu->r[3] + 0x00000020u;
         /* 0208BDFC */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 0208BE00 */ cpu->r[8] = cpu->r[0];
-        /* 0208BE04 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 0208BE04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 0208BE08 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 0208BE08 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0208BE0C */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208BE0C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208BE0C */ _t4 = _t3 & 0x00000001u;
         /* 0208BE0C */ if (_t4) goto L_0208BE10; else goto L_0208BE28;
   L_0208BE10: ; // 0x208be10
@@ -9752,8 +9752,8 @@ void Gambit_fn_0208BDF4(CPUState* cpu) {
         /* 0208BE14 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 0208BE18 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0208BE18 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0208BE1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0208BE20 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208BE1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0208BE20 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208BE20 */ _t7 = _t6 & 0x00000001u;
         /* 0208BE20 */ if (_t7) goto L_0208BE24; else goto L_0208BE34;
   L_0208BE24: ; // 0x208be24
@@ -9761,16 +9761,16 @@ void Gambit_fn_0208BDF4(CPUState* cpu) {
   L_0208BE28: ; // 0x208be28
         /* 0208BE28 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0208BE28 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0208BE2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0208BE30 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208BE2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0208BE30 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208BE30 */ _t10 = _t9 & 0x00000001u;
         /* 0208BE30 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208BE30 */ goto L_0208BE34;
   L_0208BE34: ; // 0x208be34
-        /* 0208BE34 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 0208BE34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 0208BE38 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0208BE38 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 0208BE3C */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208BE3C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208BE3C */ _t13 = _t12 & 0x00000001u;
         /* 0208BE3C */ if (_t13) goto L_0208BE40; else goto L_0208BE48;
   L_0208BE40: ; // 0x208be40
@@ -9781,11 +9781,11 @@ void Gambit_fn_0208BDF4(CPUState* cpu) {
         /* 0208BE48 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0208BE4C */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0208BE4C */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0208BE50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208BE50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208BE54 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0208BE54 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0208BE58 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 0208BE5C */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208BE5C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208BE5C */ _t18 = _t17 & 0x00000001u;
         /* 0208BE5C */ if (_t18) goto L_0208BE74; else goto L_0208BE60;
   L_0208BE60: ; // 0x208be60
@@ -9812,10 +9812,10 @@ void Gambit_fn_0208BE7C(CPUState* cpu) {
         /* 0208BE84 */ _t1 = cpu->r[3] + 0x00000030u;
         /* 0208BE84 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 0208BE88 */ cpu->r[7] = cpu->r[0];
-        /* 0208BE8C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 0208BE8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 0208BE90 */ _t2 = cpu->r[3] + 0x00000034u;
         /* 0208BE90 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0208BE94 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208BE94 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208BE94 */ _t4 = _t3 & 0x00000001u;
         /* 0208BE94 */ if (_t4) goto L_0208BE98; else goto L_0208BEB0;
   L_0208BE98: ; // 0x208be98
@@ -9823,8 +9823,8 @@ void Gambit_fn_0208BE7C(CPUState* cpu) {
         /* 0208BE9C */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 0208BEA0 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0208BEA0 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0208BEA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0208BEA8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208BEA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0208BEA8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208BEA8 */ _t7 = _t6 & 0x00000001u;
         /* 0208BEA8 */ if (_t7) goto L_0208BEAC; else goto L_0208BEBC;
   L_0208BEAC: ; // 0x208beac
@@ -9832,16 +9832,16 @@ void Gambit_fn_0208BE7C(CPUState* cpu) {
   L_0208BEB0: ; // 0x208beb0
         /* 0208BEB0 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0208BEB0 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0208BEB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0208BEB8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208BEB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0208BEB8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208BEB8 */ _t10 = _t9 & 0x00000001u;
         /* 0208BEB8 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208BEB8 */ goto L_0208BEBC;
   L_0208BEBC: ; // 0x208bebc
-        /* 0208BEBC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 0208BEBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 0208BEC0 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0208BEC0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 0208BEC4 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208BEC4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208BEC4 */ _t13 = _t12 & 0x00000001u;
         /* 0208BEC4 */ if (_t13) goto L_0208BEC8; else goto L_0208BED0;
   L_0208BEC8: ; // 0x208bec8
@@ -9852,11 +9852,11 @@ void Gambit_fn_0208BE7C(CPUState* cpu) {
         /* 0208BED0 */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0208BED4 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0208BED4 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0208BED8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0208BED8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0208BEDC */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0208BEDC */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0208BEE0 */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 0208BEE4 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208BEE4 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208BEE4 */ _t18 = _t17 & 0x00000001u;
         /* 0208BEE4 */ if (_t18) goto L_0208BEFC; else goto L_0208BEE8;
   L_0208BEE8: ; // 0x208bee8
@@ -9891,9 +9891,9 @@ void Gambit_fn_0208BF04(CPUState* cpu) {
         /* 0208BF1C */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 0208BF1C */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 0208BF20 */ /* nop */
-        /* 0208BF24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 0208BF24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 0208BF28 */ cpu->r[31] = cpu->r[4];
-        /* 0208BF2C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208BF2C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208BF2C */ _t6 = _t5 & 0x00000001u;
         /* 0208BF2C */ if (_t6) goto L_0208BF30; else goto L_0208BF44;
   L_0208BF30: ; // 0x208bf30
@@ -9942,9 +9942,9 @@ void Gambit_fn_0208BF08(CPUState* cpu) {
         /* 0208BF1C */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 0208BF1C */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 0208BF20 */ /* nop */
-        /* 0208BF24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 0208BF24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 0208BF28 */ cpu->r[31] = cpu->r[4];
-        /* 0208BF2C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208BF2C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208BF2C */ _t6 = _t5 & 0x00000001u;
         /* 0208BF2C */ if (_t6) goto L_0208BF30; else goto L_0208BF44;
   L_0208BF30: ; // 0x208bf30
@@ -9986,10 +9986,10 @@ void Gambit_fn_0208BF7C(CPUState* cpu) {
         /* 0208BF84 */ _t1 = cpu->r[3] + 0x00000028u;
         /* 0208BF84 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 0208BF88 */ cpu->r[8] = cpu->r[0];
-        /* 0208BF8C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 0208BF8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 0208BF90 */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 0208BF90 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0208BF94 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208BF94 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208BF94 */ _t4 = _t3 & 0x00000001u;
         /* 0208BF94 */ if (_t4) goto L_0208BF98; else goto L_0208BFB0;
   L_0208BF98: ; // 0x208bf98
@@ -9997,8 +9997,8 @@ void Gambit_fn_0208BF7C(CPUState* cpu) {
         /* 0208BF9C */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 0208BFA0 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0208BFA0 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0208BFA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0208BFA8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208BFA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0208BFA8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208BFA8 */ _t7 = _t6 & 0x00000001u;
         /* 0208BFA8 */ if (_t7) goto L_0208BFAC; else goto L_0208BFBC;
   L_0208BFAC: ; // 0x208bfac
@@ -10006,16 +10006,16 @@ void Gambit_fn_0208BF7C(CPUState* cpu) {
   L_0208BFB0: ; // 0x208bfb0
         /* 0208BFB0 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0208BFB0 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0208BFB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0208BFB8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208BFB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0208BFB8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208BFB8 */ _t10 = _t9 & 0x00000001u;
         /* 0208BFB8 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208BFB8 */ goto L_0208BFBC;
   L_0208BFBC: ; // 0x208bfbc
-        /* 0208BFBC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 0208BFBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 0208BFC0 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0208BFC0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 0208BFC4 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208BFC4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208BFC4 */ _t13 = _t12 & 0x00000001u;
         /* 0208BFC4 */ if (_t13) goto L_0208BFC8; else goto L_0208BFD0;
   L_0208BFC8: ; // 0x208bfc8
@@ -10026,11 +10026,11 @@ void Gambit_fn_0208BF7C(CPUState* cpu) {
         /* 0208BFD0 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0208BFD4 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0208BFD4 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0208BFD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208BFD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208BFDC */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0208BFDC */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0208BFE0 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 0208BFE4 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208BFE4 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208BFE4 */ _t18 = _t17 & 0x00000001u;
         /* 0208BFE4 */ if (_t18) goto L_0208BFFC; else goto L_0208BFE8;
   L_0208BFE8: ; // 0x208bfe8
@@ -10069,18 +10069,18 @@ void Gambit_fn_0208C004(CPUState* cpu) {
         /* 0208C018 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0208C018 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0208C01C */ cpu->r[12] = 0x00000000u;
-        /* 0208C020 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208C020 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208C024 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0208C024 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0208C028 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C028 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C028 */ _t6 = _t5 & 0x00000001u;
         /* 0208C028 */ if (_t6) goto L_0208C050; else goto L_0208C02C;
   L_0208C02C: ; // 0x208c02c
         /* 0208C02C */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0208C02C */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0208C030 */ /* nop */
-        /* 0208C034 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0208C038 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C034 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0208C038 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C038 */ _t9 = _t8 & 0x00000001u;
         /* 0208C038 */ if (_t9) goto L_0208C03C; else goto L_0208C050;
   L_0208C03C: ; // 0x208c03c
@@ -10121,18 +10121,18 @@ void Gambit_fn_0208C008(CPUState* cpu) {
         /* 0208C018 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0208C018 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0208C01C */ cpu->r[12] = 0x00000000u;
-        /* 0208C020 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208C020 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208C024 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0208C024 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0208C028 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C028 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C028 */ _t6 = _t5 & 0x00000001u;
         /* 0208C028 */ if (_t6) goto L_0208C050; else goto L_0208C02C;
   L_0208C02C: ; // 0x208c02c
         /* 0208C02C */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0208C02C */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0208C030 */ /* nop */
-        /* 0208C034 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0208C038 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C034 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0208C038 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C038 */ _t9 = _t8 & 0x00000001u;
         /* 0208C038 */ if (_t9) goto L_0208C03C; else goto L_0208C050;
   L_0208C03C: ; // 0x208c03c
@@ -10174,11 +10174,11 @@ void Gambit_fn_0208C074(CPUState* cpu) {
         /* 0208DB14 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0208DB14 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0208DB18 */ cpu->r[30] = cpu->r[3];
-        /* 0208DB18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0208DB18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0208DB1C */ cpu->r[31] = cpu->r[4];
         /* 0208DB20 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0208DB20 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0208DB24 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DB24 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DB24 */ _t5 = _t4 & 0x00000001u;
         /* 0208DB24 */ if (_t5) goto L_0208DB68; else goto L_0208DB28;
   L_0208DB28: ; // 0x208db28
@@ -10198,8 +10198,8 @@ void Gambit_fn_0208C074(CPUState* cpu) {
         /* 0208DB50 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 0208DB54 */ Gambit_fn_02068798(cpu);
         /* 0208DB58 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0208DB58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208DB5C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DB58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208DB5C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DB5C */ _t10 = _t9 & 0x00000001u;
         /* 0208DB5C */ if (_t10) goto L_0208DB68; else goto L_0208DB60;
   L_0208DB60: ; // 0x208db60
@@ -10227,8 +10227,8 @@ void Gambit_fn_0208C07C(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -10280,16 +10280,16 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C09C */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 0208C0A0 */ /* nop */
         /* 0208C0A4 */ cpu->r[29] = cpu->r[3];
-        /* 0208C0A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0208C0A8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C0A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0208C0A8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C0A8 */ _t3 = _t2 & 0x00000001u;
         /* 0208C0A8 */ if (_t3) goto L_0208C0AC; else goto L_0208C0BC;
   L_0208C0AC: ; // 0x208c0ac
         /* 0208C0AC */ cpu->r[3] = 0x000002F4u;
         /* 0208C0B0 */ Gambit_fn_02801A78(cpu);
         /* 0208C0B4 */ cpu->r[29] = cpu->r[3];
-        /* 0208C0B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0208C0B8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C0B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0208C0B8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C0B8 */ _t5 = _t4 & 0x00000001u;
         /* 0208C0B8 */ if (_t5) goto L_0208C9D8; else goto L_0208C0BC;
   L_0208C0BC: ; // 0x208c0bc
@@ -10317,7 +10317,7 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C104 */ _t9 = cpu->r[29] + 0x0000000Cu;
         /* 0208C104 */ rbrew_write32(cpu->mem, _t9, cpu->r[10]);
         /* 0208C108 */ cpu->r[27] = cpu->r[29] + 0x000001DCu;
-        /* 0208C108 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0208C108 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0208C10C */ cpu->r[0] = cpu->r[0] + 0xFFFFE000u;
         /* 0208C110 */ _t10 = cpu->r[29] + 0x0000001Cu;
         /* 0208C110 */ rbrew_write32(cpu->mem, _t10, cpu->r[11]);
@@ -10325,15 +10325,15 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C118 */ cpu->r[28] = 0x00000000u;
         /* 0208C11C */ _t11 = cpu->r[29] + 0x000001C8u;
         /* 0208C11C */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
-        /* 0208C120 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C120 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C120 */ _t13 = _t12 & 0x00000001u;
         /* 0208C120 */ if (_t13) goto L_0208C124; else goto L_0208C134;
   L_0208C124: ; // 0x208c124
         /* 0208C124 */ cpu->r[3] = 0x00000038u;
         /* 0208C128 */ Gambit_fn_02801A78(cpu);
         /* 0208C12C */ cpu->r[31] = cpu->r[3];
-        /* 0208C12C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0208C130 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C12C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0208C130 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C130 */ _t15 = _t14 & 0x00000001u;
         /* 0208C130 */ if (_t15) goto L_0208C164; else goto L_0208C134;
   L_0208C134: ; // 0x208c134
@@ -10433,23 +10433,23 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C208 */ _t47 = cpu->r[9] + 0x00000000u;
         /* 0208C208 */ cpu->r[0] = rbrew_read8(cpu->mem, _t47);
         /* 0208C20C */ cpu->r[31] = 0x00000000u;
-        /* 0208C210 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[24]);
+        /* 0208C210 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[24]));
         /* 0208C214 */ cpu->r[11] = 0x00080000u;
-        /* 0208C218 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C218 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C218 */ _t49 = _t48 & 0x00000001u;
         /* 0208C218 */ if (_t49) goto L_0208C240; else goto L_0208C21C;
   L_0208C21C: ; // 0x208c21c
         /* 0208C21C */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208C220 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 0208C220 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 0208C224 */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 0208C228 */ _t50 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C228 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C228 */ _t51 = _t50 & 0x00000001u;
         /* 0208C228 */ if (_t51) goto L_0208C23C; else goto L_0208C22C;
   L_0208C22C: ; // 0x208c22c
         /* 0208C22C */ _t52 = cpu->r[9] + 0x00000000u;
         /* 0208C22C */ cpu->r[8] = rbrew_read8(cpu->mem, _t52);
-        /* 0208C230 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[24]);
-        /* 0208C234 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C230 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[24]));
+        /* 0208C234 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C234 */ _t54 = _t53 & 0x00000001u;
         /* 0208C234 */ if (_t54) goto L_0208C238; else goto L_0208C21C;
   L_0208C238: ; // 0x208c238
@@ -10461,10 +10461,10 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C240 */ cpu->r[12] = rbrew_read32(cpu->mem, _t55);
         /* 0208C244 */ _t56 = cpu->r[1] + 0x00000010u;
         /* 0208C244 */ cpu->r[9] = rbrew_read32(cpu->mem, _t56);
-        /* 0208C248 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 0208C248 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 0208C24C */ _t57 = cpu->r[9] + 0x00000014u;
         /* 0208C24C */ cpu->r[0] = rbrew_read32(cpu->mem, _t57);
-        /* 0208C250 */ _t58 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208C250 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208C250 */ _t59 = _t58 & 0x00000001u;
         /* 0208C250 */ if (_t59) goto L_0208C258; else goto L_0208C254;
   L_0208C254: ; // 0x208c254
@@ -10519,10 +10519,10 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C2D8 */ rbrew_write32(cpu->mem, _t73, cpu->r[4]);
         /* 0208C2DC */ _t74 = cpu->r[27] + 0x00000014u;
         /* 0208C2DC */ cpu->r[5] = rbrew_read32(cpu->mem, _t74);
-        /* 0208C2E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x00000001u);
+        /* 0208C2E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x00000001u));
         /* 0208C2E4 */ _t75 = cpu->r[27] + 0x00000018u;
         /* 0208C2E4 */ cpu->r[30] = rbrew_read32(cpu->mem, _t75);
-        /* 0208C2E8 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C2E8 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C2E8 */ _t77 = _t76 & 0x00000001u;
         /* 0208C2E8 */ if (_t77) goto L_0208C2EC; else goto L_0208C2F0;
   L_0208C2EC: ; // 0x208c2ec
@@ -10538,23 +10538,23 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C304 */ _t80 = cpu->r[4] + 0x00000000u;
         /* 0208C304 */ cpu->r[8] = rbrew_read8(cpu->mem, _t80);
         /* 0208C308 */ cpu->r[31] = 0x00000000u;
-        /* 0208C30C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[24]);
+        /* 0208C30C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[24]));
         /* 0208C310 */ cpu->r[6] = 0x00080000u;
-        /* 0208C314 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C314 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C314 */ _t82 = _t81 & 0x00000001u;
         /* 0208C314 */ if (_t82) goto L_0208C33C; else goto L_0208C318;
   L_0208C318: ; // 0x208c318
         /* 0208C318 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208C31C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 0208C31C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 0208C320 */ cpu->r[4] = cpu->r[4] + 0x00000001u;
-        /* 0208C324 */ _t83 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C324 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C324 */ _t84 = _t83 & 0x00000001u;
         /* 0208C324 */ if (_t84) goto L_0208C338; else goto L_0208C328;
   L_0208C328: ; // 0x208c328
         /* 0208C328 */ _t85 = cpu->r[4] + 0x00000000u;
         /* 0208C328 */ cpu->r[9] = rbrew_read8(cpu->mem, _t85);
-        /* 0208C32C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[24]);
-        /* 0208C330 */ _t86 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C32C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[24]));
+        /* 0208C330 */ _t86 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C330 */ _t87 = _t86 & 0x00000001u;
         /* 0208C330 */ if (_t87) goto L_0208C334; else goto L_0208C318;
   L_0208C334: ; // 0x208c334
@@ -10566,10 +10566,10 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C33C */ cpu->r[4] = rbrew_read32(cpu->mem, _t88);
         /* 0208C340 */ _t89 = cpu->r[1] + 0x00000010u;
         /* 0208C340 */ cpu->r[11] = rbrew_read32(cpu->mem, _t89);
-        /* 0208C344 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[4]);
+        /* 0208C344 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[4]));
         /* 0208C348 */ _t90 = cpu->r[11] + 0x00000014u;
         /* 0208C348 */ cpu->r[0] = rbrew_read32(cpu->mem, _t90);
-        /* 0208C34C */ _t91 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208C34C */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208C34C */ _t92 = _t91 & 0x00000001u;
         /* 0208C34C */ if (_t92) goto L_0208C354; else goto L_0208C350;
   L_0208C350: ; // 0x208c350
@@ -10624,10 +10624,10 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C3D4 */ rbrew_write32(cpu->mem, _t106, cpu->r[0]);
         /* 0208C3D8 */ _t107 = cpu->r[27] + 0x00000014u;
         /* 0208C3D8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t107);
-        /* 0208C3DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000002u);
+        /* 0208C3DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000002u));
         /* 0208C3E0 */ _t108 = cpu->r[27] + 0x00000018u;
         /* 0208C3E0 */ cpu->r[30] = rbrew_read32(cpu->mem, _t108);
-        /* 0208C3E4 */ _t109 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C3E4 */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C3E4 */ _t110 = _t109 & 0x00000001u;
         /* 0208C3E4 */ if (_t110) goto L_0208C3E8; else goto L_0208C3EC;
   L_0208C3E8: ; // 0x208c3e8
@@ -10643,23 +10643,23 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C400 */ _t113 = cpu->r[10] + 0x00000000u;
         /* 0208C400 */ cpu->r[0] = rbrew_read8(cpu->mem, _t113);
         /* 0208C404 */ cpu->r[31] = 0x00000000u;
-        /* 0208C408 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[24]);
+        /* 0208C408 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[24]));
         /* 0208C40C */ cpu->r[12] = 0x00080000u;
-        /* 0208C410 */ _t114 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C410 */ _t114 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C410 */ _t115 = _t114 & 0x00000001u;
         /* 0208C410 */ if (_t115) goto L_0208C438; else goto L_0208C414;
   L_0208C414: ; // 0x208c414
         /* 0208C414 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208C418 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 0208C418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 0208C41C */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 0208C420 */ _t116 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C420 */ _t116 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C420 */ _t117 = _t116 & 0x00000001u;
         /* 0208C420 */ if (_t117) goto L_0208C434; else goto L_0208C424;
   L_0208C424: ; // 0x208c424
         /* 0208C424 */ _t118 = cpu->r[10] + 0x00000000u;
         /* 0208C424 */ cpu->r[5] = rbrew_read8(cpu->mem, _t118);
-        /* 0208C428 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[24]);
-        /* 0208C42C */ _t119 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C428 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[24]));
+        /* 0208C42C */ _t119 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C42C */ _t120 = _t119 & 0x00000001u;
         /* 0208C42C */ if (_t120) goto L_0208C430; else goto L_0208C414;
   L_0208C430: ; // 0x208c430
@@ -10671,10 +10671,10 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C438 */ cpu->r[6] = rbrew_read32(cpu->mem, _t121);
         /* 0208C43C */ _t122 = cpu->r[1] + 0x00000010u;
         /* 0208C43C */ cpu->r[7] = rbrew_read32(cpu->mem, _t122);
-        /* 0208C440 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 0208C440 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 0208C444 */ _t123 = cpu->r[7] + 0x00000014u;
         /* 0208C444 */ cpu->r[9] = rbrew_read32(cpu->mem, _t123);
-        /* 0208C448 */ _t124 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208C448 */ _t124 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208C448 */ _t125 = _t124 & 0x00000001u;
         /* 0208C448 */ if (_t125) goto L_0208C450; else goto L_0208C44C;
   L_0208C44C: ; // 0x208c44c
@@ -10729,10 +10729,10 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C4D0 */ rbrew_write32(cpu->mem, _t139, cpu->r[0]);
         /* 0208C4D4 */ _t140 = cpu->r[27] + 0x00000014u;
         /* 0208C4D4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t140);
-        /* 0208C4D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x00000003u);
+        /* 0208C4D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x00000003u));
         /* 0208C4DC */ _t141 = cpu->r[27] + 0x00000018u;
         /* 0208C4DC */ cpu->r[30] = rbrew_read32(cpu->mem, _t141);
-        /* 0208C4E0 */ _t142 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C4E0 */ _t142 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C4E0 */ _t143 = _t142 & 0x00000001u;
         /* 0208C4E0 */ if (_t143) goto L_0208C4E4; else goto L_0208C4E8;
   L_0208C4E4: ; // 0x208c4e4
@@ -10748,23 +10748,23 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C4FC */ _t146 = cpu->r[6] + 0x00000000u;
         /* 0208C4FC */ cpu->r[8] = rbrew_read8(cpu->mem, _t146);
         /* 0208C500 */ cpu->r[31] = 0x00000000u;
-        /* 0208C504 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[24]);
+        /* 0208C504 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[24]));
         /* 0208C508 */ cpu->r[7] = 0x00080000u;
-        /* 0208C50C */ _t147 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C50C */ _t147 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C50C */ _t148 = _t147 & 0x00000001u;
         /* 0208C50C */ if (_t148) goto L_0208C534; else goto L_0208C510;
   L_0208C510: ; // 0x208c510
         /* 0208C510 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208C514 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 0208C514 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 0208C518 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 0208C51C */ _t149 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C51C */ _t149 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C51C */ _t150 = _t149 & 0x00000001u;
         /* 0208C51C */ if (_t150) goto L_0208C530; else goto L_0208C520;
   L_0208C520: ; // 0x208c520
         /* 0208C520 */ _t151 = cpu->r[6] + 0x00000000u;
         /* 0208C520 */ cpu->r[0] = rbrew_read8(cpu->mem, _t151);
-        /* 0208C524 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[24]);
-        /* 0208C528 */ _t152 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[24]));
+        /* 0208C528 */ _t152 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C528 */ _t153 = _t152 & 0x00000001u;
         /* 0208C528 */ if (_t153) goto L_0208C52C; else goto L_0208C510;
   L_0208C52C: ; // 0x208c52c
@@ -10776,10 +10776,10 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C534 */ cpu->r[7] = rbrew_read32(cpu->mem, _t154);
         /* 0208C538 */ _t155 = cpu->r[1] + 0x00000010u;
         /* 0208C538 */ cpu->r[12] = rbrew_read32(cpu->mem, _t155);
-        /* 0208C53C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 0208C53C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 0208C540 */ _t156 = cpu->r[12] + 0x00000014u;
         /* 0208C540 */ cpu->r[4] = rbrew_read32(cpu->mem, _t156);
-        /* 0208C544 */ _t157 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208C544 */ _t157 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208C544 */ _t158 = _t157 & 0x00000001u;
         /* 0208C544 */ if (_t158) goto L_0208C54C; else goto L_0208C548;
   L_0208C548: ; // 0x208c548
@@ -10834,10 +10834,10 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C5CC */ rbrew_write32(cpu->mem, _t172, cpu->r[8]);
         /* 0208C5D0 */ _t173 = cpu->r[27] + 0x00000014u;
         /* 0208C5D0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t173);
-        /* 0208C5D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000004u);
+        /* 0208C5D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000004u));
         /* 0208C5D8 */ _t174 = cpu->r[27] + 0x00000018u;
         /* 0208C5D8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t174);
-        /* 0208C5DC */ _t175 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C5DC */ _t175 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C5DC */ _t176 = _t175 & 0x00000001u;
         /* 0208C5DC */ if (_t176) goto L_0208C5E0; else goto L_0208C5E4;
   L_0208C5E0: ; // 0x208c5e0
@@ -10853,23 +10853,23 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C5F8 */ _t179 = cpu->r[11] + 0x00000000u;
         /* 0208C5F8 */ cpu->r[10] = rbrew_read8(cpu->mem, _t179);
         /* 0208C5FC */ cpu->r[31] = 0x00000000u;
-        /* 0208C600 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[24]);
+        /* 0208C600 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[24]));
         /* 0208C604 */ cpu->r[12] = 0x00080000u;
-        /* 0208C608 */ _t180 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C608 */ _t180 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C608 */ _t181 = _t180 & 0x00000001u;
         /* 0208C608 */ if (_t181) goto L_0208C630; else goto L_0208C60C;
   L_0208C60C: ; // 0x208c60c
         /* 0208C60C */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208C610 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 0208C610 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 0208C614 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 0208C618 */ _t182 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C618 */ _t182 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C618 */ _t183 = _t182 & 0x00000001u;
         /* 0208C618 */ if (_t183) goto L_0208C62C; else goto L_0208C61C;
   L_0208C61C: ; // 0x208c61c
         /* 0208C61C */ _t184 = cpu->r[11] + 0x00000000u;
         /* 0208C61C */ cpu->r[0] = rbrew_read8(cpu->mem, _t184);
-        /* 0208C620 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[24]);
-        /* 0208C624 */ _t185 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C620 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[24]));
+        /* 0208C624 */ _t185 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C624 */ _t186 = _t185 & 0x00000001u;
         /* 0208C624 */ if (_t186) goto L_0208C628; else goto L_0208C60C;
   L_0208C628: ; // 0x208c628
@@ -10881,10 +10881,10 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C630 */ cpu->r[9] = rbrew_read32(cpu->mem, _t187);
         /* 0208C634 */ _t188 = cpu->r[1] + 0x00000010u;
         /* 0208C634 */ cpu->r[12] = rbrew_read32(cpu->mem, _t188);
-        /* 0208C638 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 0208C638 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 0208C63C */ _t189 = cpu->r[12] + 0x00000014u;
         /* 0208C63C */ cpu->r[4] = rbrew_read32(cpu->mem, _t189);
-        /* 0208C640 */ _t190 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208C640 */ _t190 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208C640 */ _t191 = _t190 & 0x00000001u;
         /* 0208C640 */ if (_t191) goto L_0208C648; else goto L_0208C644;
   L_0208C644: ; // 0x208c644
@@ -10939,10 +10939,10 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C6C8 */ rbrew_write32(cpu->mem, _t205, cpu->r[0]);
         /* 0208C6CC */ _t206 = cpu->r[27] + 0x00000014u;
         /* 0208C6CC */ cpu->r[7] = rbrew_read32(cpu->mem, _t206);
-        /* 0208C6D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x00000005u);
+        /* 0208C6D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x00000005u));
         /* 0208C6D4 */ _t207 = cpu->r[27] + 0x00000018u;
         /* 0208C6D4 */ cpu->r[30] = rbrew_read32(cpu->mem, _t207);
-        /* 0208C6D8 */ _t208 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C6D8 */ _t208 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C6D8 */ _t209 = _t208 & 0x00000001u;
         /* 0208C6D8 */ if (_t209) goto L_0208C6DC; else goto L_0208C6E0;
   L_0208C6DC: ; // 0x208c6dc
@@ -10958,23 +10958,23 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C6F4 */ _t212 = cpu->r[7] + 0x00000000u;
         /* 0208C6F4 */ cpu->r[8] = rbrew_read8(cpu->mem, _t212);
         /* 0208C6F8 */ cpu->r[31] = 0x00000000u;
-        /* 0208C6FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[24]);
+        /* 0208C6FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[24]));
         /* 0208C700 */ cpu->r[0] = 0x00080000u;
-        /* 0208C704 */ _t213 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C704 */ _t213 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C704 */ _t214 = _t213 & 0x00000001u;
         /* 0208C704 */ if (_t214) goto L_0208C72C; else goto L_0208C708;
   L_0208C708: ; // 0x208c708
         /* 0208C708 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208C70C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 0208C70C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 0208C710 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 0208C714 */ _t215 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C714 */ _t215 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C714 */ _t216 = _t215 & 0x00000001u;
         /* 0208C714 */ if (_t216) goto L_0208C728; else goto L_0208C718;
   L_0208C718: ; // 0x208c718
         /* 0208C718 */ _t217 = cpu->r[7] + 0x00000000u;
         /* 0208C718 */ cpu->r[9] = rbrew_read8(cpu->mem, _t217);
-        /* 0208C71C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[24]);
-        /* 0208C720 */ _t218 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C71C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[24]));
+        /* 0208C720 */ _t218 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C720 */ _t219 = _t218 & 0x00000001u;
         /* 0208C720 */ if (_t219) goto L_0208C724; else goto L_0208C708;
   L_0208C724: ; // 0x208c724
@@ -10984,10 +10984,10 @@ void Gambit_fn_0208C094(CPUState* cpu) {
   L_0208C72C: ; // 0x208c72c
         /* 0208C72C */ _t220 = cpu->r[30] + 0x00000008u;
         /* 0208C72C */ cpu->r[11] = rbrew_read32(cpu->mem, _t220);
-        /* 0208C730 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 0208C730 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 0208C734 */ _t221 = cpu->r[1] + 0x00000010u;
         /* 0208C734 */ cpu->r[10] = rbrew_read32(cpu->mem, _t221);
-        /* 0208C738 */ _t222 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208C738 */ _t222 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208C738 */ _t223 = _t222 & 0x00000001u;
         /* 0208C738 */ if (_t223) goto L_0208C740; else goto L_0208C73C;
   L_0208C73C: ; // 0x208c73c
@@ -11044,10 +11044,10 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C7C4 */ rbrew_write32(cpu->mem, _t238, cpu->r[0]);
         /* 0208C7C8 */ _t239 = cpu->r[27] + 0x00000014u;
         /* 0208C7C8 */ cpu->r[4] = rbrew_read32(cpu->mem, _t239);
-        /* 0208C7CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000006u);
+        /* 0208C7CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000006u));
         /* 0208C7D0 */ _t240 = cpu->r[27] + 0x00000018u;
         /* 0208C7D0 */ cpu->r[30] = rbrew_read32(cpu->mem, _t240);
-        /* 0208C7D4 */ _t241 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C7D4 */ _t241 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C7D4 */ _t242 = _t241 & 0x00000001u;
         /* 0208C7D4 */ if (_t242) goto L_0208C7D8; else goto L_0208C7DC;
   L_0208C7D8: ; // 0x208c7d8
@@ -11063,23 +11063,23 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C7F0 */ _t245 = cpu->r[4] + 0x00000000u;
         /* 0208C7F0 */ cpu->r[5] = rbrew_read8(cpu->mem, _t245);
         /* 0208C7F4 */ cpu->r[31] = 0x00000000u;
-        /* 0208C7F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[24]);
+        /* 0208C7F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[24]));
         /* 0208C7FC */ cpu->r[6] = 0x00080000u;
-        /* 0208C800 */ _t246 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C800 */ _t246 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C800 */ _t247 = _t246 & 0x00000001u;
         /* 0208C800 */ if (_t247) goto L_0208C828; else goto L_0208C804;
   L_0208C804: ; // 0x208c804
         /* 0208C804 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208C808 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 0208C808 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 0208C80C */ cpu->r[4] = cpu->r[4] + 0x00000001u;
-        /* 0208C810 */ _t248 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C810 */ _t248 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C810 */ _t249 = _t248 & 0x00000001u;
         /* 0208C810 */ if (_t249) goto L_0208C824; else goto L_0208C814;
   L_0208C814: ; // 0x208c814
         /* 0208C814 */ _t250 = cpu->r[4] + 0x00000000u;
         /* 0208C814 */ cpu->r[0] = rbrew_read8(cpu->mem, _t250);
-        /* 0208C818 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[24]);
-        /* 0208C81C */ _t251 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C818 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[24]));
+        /* 0208C81C */ _t251 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C81C */ _t252 = _t251 & 0x00000001u;
         /* 0208C81C */ if (_t252) goto L_0208C820; else goto L_0208C804;
   L_0208C820: ; // 0x208c820
@@ -11091,10 +11091,10 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C828 */ cpu->r[5] = rbrew_read32(cpu->mem, _t253);
         /* 0208C82C */ _t254 = cpu->r[1] + 0x00000010u;
         /* 0208C82C */ cpu->r[7] = rbrew_read32(cpu->mem, _t254);
-        /* 0208C830 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 0208C830 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 0208C834 */ _t255 = cpu->r[7] + 0x00000014u;
         /* 0208C834 */ cpu->r[8] = rbrew_read32(cpu->mem, _t255);
-        /* 0208C838 */ _t256 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208C838 */ _t256 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208C838 */ _t257 = _t256 & 0x00000001u;
         /* 0208C838 */ if (_t257) goto L_0208C840; else goto L_0208C83C;
   L_0208C83C: ; // 0x208c83c
@@ -11149,10 +11149,10 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C8C0 */ rbrew_write32(cpu->mem, _t271, cpu->r[10]);
         /* 0208C8C4 */ _t272 = cpu->r[27] + 0x00000014u;
         /* 0208C8C4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t272);
-        /* 0208C8C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000007u);
+        /* 0208C8C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000007u));
         /* 0208C8CC */ _t273 = cpu->r[27] + 0x00000018u;
         /* 0208C8CC */ cpu->r[30] = rbrew_read32(cpu->mem, _t273);
-        /* 0208C8D0 */ _t274 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C8D0 */ _t274 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C8D0 */ _t275 = _t274 & 0x00000001u;
         /* 0208C8D0 */ if (_t275) goto L_0208C8D4; else goto L_0208C8D8;
   L_0208C8D4: ; // 0x208c8d4
@@ -11168,23 +11168,23 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C8EC */ _t278 = cpu->r[10] + 0x00000000u;
         /* 0208C8EC */ cpu->r[12] = rbrew_read8(cpu->mem, _t278);
         /* 0208C8F0 */ cpu->r[31] = 0x00000000u;
-        /* 0208C8F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[24]);
+        /* 0208C8F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[24]));
         /* 0208C8F8 */ cpu->r[12] = 0x00080000u;
-        /* 0208C8FC */ _t279 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C8FC */ _t279 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C8FC */ _t280 = _t279 & 0x00000001u;
         /* 0208C8FC */ if (_t280) goto L_0208C924; else goto L_0208C900;
   L_0208C900: ; // 0x208c900
         /* 0208C900 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208C904 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 0208C904 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 0208C908 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 0208C90C */ _t281 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C90C */ _t281 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C90C */ _t282 = _t281 & 0x00000001u;
         /* 0208C90C */ if (_t282) goto L_0208C920; else goto L_0208C910;
   L_0208C910: ; // 0x208c910
         /* 0208C910 */ _t283 = cpu->r[10] + 0x00000000u;
         /* 0208C910 */ cpu->r[0] = rbrew_read8(cpu->mem, _t283);
-        /* 0208C914 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[24]);
-        /* 0208C918 */ _t284 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C914 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[24]));
+        /* 0208C918 */ _t284 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C918 */ _t285 = _t284 & 0x00000001u;
         /* 0208C918 */ if (_t285) goto L_0208C91C; else goto L_0208C900;
   L_0208C91C: ; // 0x208c91c
@@ -11196,10 +11196,10 @@ void Gambit_fn_0208C094(CPUState* cpu) {
         /* 0208C924 */ cpu->r[6] = rbrew_read32(cpu->mem, _t286);
         /* 0208C928 */ _t287 = cpu->r[1] + 0x00000010u;
         /* 0208C928 */ cpu->r[4] = rbrew_read32(cpu->mem, _t287);
-        /* 0208C92C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 0208C92C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 0208C930 */ _t288 = cpu->r[4] + 0x00000014u;
         /* 0208C930 */ cpu->r[5] = rbrew_read32(cpu->mem, _t288);
-        /* 0208C934 */ _t289 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208C934 */ _t289 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208C934 */ _t290 = _t289 & 0x00000001u;
         /* 0208C934 */ if (_t290) goto L_0208C93C; else goto L_0208C938;
   L_0208C938: ; // 0x208c938
@@ -11280,16 +11280,16 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C09C */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 0208C0A0 */ /* nop */
         /* 0208C0A4 */ cpu->r[29] = cpu->r[3];
-        /* 0208C0A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0208C0A8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C0A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0208C0A8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C0A8 */ _t3 = _t2 & 0x00000001u;
         /* 0208C0A8 */ if (_t3) goto L_0208C0AC; else goto L_0208C0BC;
   L_0208C0AC: ; // 0x208c0ac
         /* 0208C0AC */ cpu->r[3] = 0x000002F4u;
         /* 0208C0B0 */ Gambit_fn_02801A78(cpu);
         /* 0208C0B4 */ cpu->r[29] = cpu->r[3];
-        /* 0208C0B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0208C0B8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C0B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0208C0B8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C0B8 */ _t5 = _t4 & 0x00000001u;
         /* 0208C0B8 */ if (_t5) goto L_0208C9D8; else goto L_0208C0BC;
   L_0208C0BC: ; // 0x208c0bc
@@ -11317,7 +11317,7 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C104 */ _t9 = cpu->r[29] + 0x0000000Cu;
         /* 0208C104 */ rbrew_write32(cpu->mem, _t9, cpu->r[10]);
         /* 0208C108 */ cpu->r[27] = cpu->r[29] + 0x000001DCu;
-        /* 0208C108 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0208C108 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0208C10C */ cpu->r[0] = cpu->r[0] + 0xFFFFE000u;
         /* 0208C110 */ _t10 = cpu->r[29] + 0x0000001Cu;
         /* 0208C110 */ rbrew_write32(cpu->mem, _t10, cpu->r[11]);
@@ -11325,15 +11325,15 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C118 */ cpu->r[28] = 0x00000000u;
         /* 0208C11C */ _t11 = cpu->r[29] + 0x000001C8u;
         /* 0208C11C */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
-        /* 0208C120 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C120 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C120 */ _t13 = _t12 & 0x00000001u;
         /* 0208C120 */ if (_t13) goto L_0208C124; else goto L_0208C134;
   L_0208C124: ; // 0x208c124
         /* 0208C124 */ cpu->r[3] = 0x00000038u;
         /* 0208C128 */ Gambit_fn_02801A78(cpu);
         /* 0208C12C */ cpu->r[31] = cpu->r[3];
-        /* 0208C12C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0208C130 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C12C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0208C130 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C130 */ _t15 = _t14 & 0x00000001u;
         /* 0208C130 */ if (_t15) goto L_0208C164; else goto L_0208C134;
   L_0208C134: ; // 0x208c134
@@ -11433,23 +11433,23 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C208 */ _t47 = cpu->r[9] + 0x00000000u;
         /* 0208C208 */ cpu->r[0] = rbrew_read8(cpu->mem, _t47);
         /* 0208C20C */ cpu->r[31] = 0x00000000u;
-        /* 0208C210 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[24]);
+        /* 0208C210 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[24]));
         /* 0208C214 */ cpu->r[11] = 0x00080000u;
-        /* 0208C218 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C218 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C218 */ _t49 = _t48 & 0x00000001u;
         /* 0208C218 */ if (_t49) goto L_0208C240; else goto L_0208C21C;
   L_0208C21C: ; // 0x208c21c
         /* 0208C21C */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208C220 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 0208C220 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 0208C224 */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 0208C228 */ _t50 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C228 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C228 */ _t51 = _t50 & 0x00000001u;
         /* 0208C228 */ if (_t51) goto L_0208C23C; else goto L_0208C22C;
   L_0208C22C: ; // 0x208c22c
         /* 0208C22C */ _t52 = cpu->r[9] + 0x00000000u;
         /* 0208C22C */ cpu->r[8] = rbrew_read8(cpu->mem, _t52);
-        /* 0208C230 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[24]);
-        /* 0208C234 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C230 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[24]));
+        /* 0208C234 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C234 */ _t54 = _t53 & 0x00000001u;
         /* 0208C234 */ if (_t54) goto L_0208C238; else goto L_0208C21C;
   L_0208C238: ; // 0x208c238
@@ -11461,10 +11461,10 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C240 */ cpu->r[12] = rbrew_read32(cpu->mem, _t55);
         /* 0208C244 */ _t56 = cpu->r[1] + 0x00000010u;
         /* 0208C244 */ cpu->r[9] = rbrew_read32(cpu->mem, _t56);
-        /* 0208C248 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 0208C248 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 0208C24C */ _t57 = cpu->r[9] + 0x00000014u;
         /* 0208C24C */ cpu->r[0] = rbrew_read32(cpu->mem, _t57);
-        /* 0208C250 */ _t58 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208C250 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208C250 */ _t59 = _t58 & 0x00000001u;
         /* 0208C250 */ if (_t59) goto L_0208C258; else goto L_0208C254;
   L_0208C254: ; // 0x208c254
@@ -11519,10 +11519,10 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C2D8 */ rbrew_write32(cpu->mem, _t73, cpu->r[4]);
         /* 0208C2DC */ _t74 = cpu->r[27] + 0x00000014u;
         /* 0208C2DC */ cpu->r[5] = rbrew_read32(cpu->mem, _t74);
-        /* 0208C2E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x00000001u);
+        /* 0208C2E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x00000001u));
         /* 0208C2E4 */ _t75 = cpu->r[27] + 0x00000018u;
         /* 0208C2E4 */ cpu->r[30] = rbrew_read32(cpu->mem, _t75);
-        /* 0208C2E8 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C2E8 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C2E8 */ _t77 = _t76 & 0x00000001u;
         /* 0208C2E8 */ if (_t77) goto L_0208C2EC; else goto L_0208C2F0;
   L_0208C2EC: ; // 0x208c2ec
@@ -11538,23 +11538,23 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C304 */ _t80 = cpu->r[4] + 0x00000000u;
         /* 0208C304 */ cpu->r[8] = rbrew_read8(cpu->mem, _t80);
         /* 0208C308 */ cpu->r[31] = 0x00000000u;
-        /* 0208C30C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[24]);
+        /* 0208C30C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[24]));
         /* 0208C310 */ cpu->r[6] = 0x00080000u;
-        /* 0208C314 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C314 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C314 */ _t82 = _t81 & 0x00000001u;
         /* 0208C314 */ if (_t82) goto L_0208C33C; else goto L_0208C318;
   L_0208C318: ; // 0x208c318
         /* 0208C318 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208C31C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 0208C31C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 0208C320 */ cpu->r[4] = cpu->r[4] + 0x00000001u;
-        /* 0208C324 */ _t83 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C324 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C324 */ _t84 = _t83 & 0x00000001u;
         /* 0208C324 */ if (_t84) goto L_0208C338; else goto L_0208C328;
   L_0208C328: ; // 0x208c328
         /* 0208C328 */ _t85 = cpu->r[4] + 0x00000000u;
         /* 0208C328 */ cpu->r[9] = rbrew_read8(cpu->mem, _t85);
-        /* 0208C32C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[24]);
-        /* 0208C330 */ _t86 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C32C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[24]));
+        /* 0208C330 */ _t86 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C330 */ _t87 = _t86 & 0x00000001u;
         /* 0208C330 */ if (_t87) goto L_0208C334; else goto L_0208C318;
   L_0208C334: ; // 0x208c334
@@ -11566,10 +11566,10 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C33C */ cpu->r[4] = rbrew_read32(cpu->mem, _t88);
         /* 0208C340 */ _t89 = cpu->r[1] + 0x00000010u;
         /* 0208C340 */ cpu->r[11] = rbrew_read32(cpu->mem, _t89);
-        /* 0208C344 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[4]);
+        /* 0208C344 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[4]));
         /* 0208C348 */ _t90 = cpu->r[11] + 0x00000014u;
         /* 0208C348 */ cpu->r[0] = rbrew_read32(cpu->mem, _t90);
-        /* 0208C34C */ _t91 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208C34C */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208C34C */ _t92 = _t91 & 0x00000001u;
         /* 0208C34C */ if (_t92) goto L_0208C354; else goto L_0208C350;
   L_0208C350: ; // 0x208c350
@@ -11624,10 +11624,10 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C3D4 */ rbrew_write32(cpu->mem, _t106, cpu->r[0]);
         /* 0208C3D8 */ _t107 = cpu->r[27] + 0x00000014u;
         /* 0208C3D8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t107);
-        /* 0208C3DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000002u);
+        /* 0208C3DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000002u));
         /* 0208C3E0 */ _t108 = cpu->r[27] + 0x00000018u;
         /* 0208C3E0 */ cpu->r[30] = rbrew_read32(cpu->mem, _t108);
-        /* 0208C3E4 */ _t109 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C3E4 */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C3E4 */ _t110 = _t109 & 0x00000001u;
         /* 0208C3E4 */ if (_t110) goto L_0208C3E8; else goto L_0208C3EC;
   L_0208C3E8: ; // 0x208c3e8
@@ -11643,23 +11643,23 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C400 */ _t113 = cpu->r[10] + 0x00000000u;
         /* 0208C400 */ cpu->r[0] = rbrew_read8(cpu->mem, _t113);
         /* 0208C404 */ cpu->r[31] = 0x00000000u;
-        /* 0208C408 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[24]);
+        /* 0208C408 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[24]));
         /* 0208C40C */ cpu->r[12] = 0x00080000u;
-        /* 0208C410 */ _t114 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C410 */ _t114 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C410 */ _t115 = _t114 & 0x00000001u;
         /* 0208C410 */ if (_t115) goto L_0208C438; else goto L_0208C414;
   L_0208C414: ; // 0x208c414
         /* 0208C414 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208C418 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 0208C418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 0208C41C */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 0208C420 */ _t116 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C420 */ _t116 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C420 */ _t117 = _t116 & 0x00000001u;
         /* 0208C420 */ if (_t117) goto L_0208C434; else goto L_0208C424;
   L_0208C424: ; // 0x208c424
         /* 0208C424 */ _t118 = cpu->r[10] + 0x00000000u;
         /* 0208C424 */ cpu->r[5] = rbrew_read8(cpu->mem, _t118);
-        /* 0208C428 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[24]);
-        /* 0208C42C */ _t119 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C428 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[24]));
+        /* 0208C42C */ _t119 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C42C */ _t120 = _t119 & 0x00000001u;
         /* 0208C42C */ if (_t120) goto L_0208C430; else goto L_0208C414;
   L_0208C430: ; // 0x208c430
@@ -11671,10 +11671,10 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C438 */ cpu->r[6] = rbrew_read32(cpu->mem, _t121);
         /* 0208C43C */ _t122 = cpu->r[1] + 0x00000010u;
         /* 0208C43C */ cpu->r[7] = rbrew_read32(cpu->mem, _t122);
-        /* 0208C440 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 0208C440 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 0208C444 */ _t123 = cpu->r[7] + 0x00000014u;
         /* 0208C444 */ cpu->r[9] = rbrew_read32(cpu->mem, _t123);
-        /* 0208C448 */ _t124 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208C448 */ _t124 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208C448 */ _t125 = _t124 & 0x00000001u;
         /* 0208C448 */ if (_t125) goto L_0208C450; else goto L_0208C44C;
   L_0208C44C: ; // 0x208c44c
@@ -11729,10 +11729,10 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C4D0 */ rbrew_write32(cpu->mem, _t139, cpu->r[0]);
         /* 0208C4D4 */ _t140 = cpu->r[27] + 0x00000014u;
         /* 0208C4D4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t140);
-        /* 0208C4D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x00000003u);
+        /* 0208C4D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x00000003u));
         /* 0208C4DC */ _t141 = cpu->r[27] + 0x00000018u;
         /* 0208C4DC */ cpu->r[30] = rbrew_read32(cpu->mem, _t141);
-        /* 0208C4E0 */ _t142 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C4E0 */ _t142 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C4E0 */ _t143 = _t142 & 0x00000001u;
         /* 0208C4E0 */ if (_t143) goto L_0208C4E4; else goto L_0208C4E8;
   L_0208C4E4: ; // 0x208c4e4
@@ -11748,23 +11748,23 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C4FC */ _t146 = cpu->r[6] + 0x00000000u;
         /* 0208C4FC */ cpu->r[8] = rbrew_read8(cpu->mem, _t146);
         /* 0208C500 */ cpu->r[31] = 0x00000000u;
-        /* 0208C504 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[24]);
+        /* 0208C504 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[24]));
         /* 0208C508 */ cpu->r[7] = 0x00080000u;
-        /* 0208C50C */ _t147 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C50C */ _t147 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C50C */ _t148 = _t147 & 0x00000001u;
         /* 0208C50C */ if (_t148) goto L_0208C534; else goto L_0208C510;
   L_0208C510: ; // 0x208c510
         /* 0208C510 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208C514 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 0208C514 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 0208C518 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 0208C51C */ _t149 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C51C */ _t149 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C51C */ _t150 = _t149 & 0x00000001u;
         /* 0208C51C */ if (_t150) goto L_0208C530; else goto L_0208C520;
   L_0208C520: ; // 0x208c520
         /* 0208C520 */ _t151 = cpu->r[6] + 0x00000000u;
         /* 0208C520 */ cpu->r[0] = rbrew_read8(cpu->mem, _t151);
-        /* 0208C524 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[24]);
-        /* 0208C528 */ _t152 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[24]));
+        /* 0208C528 */ _t152 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C528 */ _t153 = _t152 & 0x00000001u;
         /* 0208C528 */ if (_t153) goto L_0208C52C; else goto L_0208C510;
   L_0208C52C: ; // 0x208c52c
@@ -11776,10 +11776,10 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C534 */ cpu->r[7] = rbrew_read32(cpu->mem, _t154);
         /* 0208C538 */ _t155 = cpu->r[1] + 0x00000010u;
         /* 0208C538 */ cpu->r[12] = rbrew_read32(cpu->mem, _t155);
-        /* 0208C53C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 0208C53C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 0208C540 */ _t156 = cpu->r[12] + 0x00000014u;
         /* 0208C540 */ cpu->r[4] = rbrew_read32(cpu->mem, _t156);
-        /* 0208C544 */ _t157 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208C544 */ _t157 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208C544 */ _t158 = _t157 & 0x00000001u;
         /* 0208C544 */ if (_t158) goto L_0208C54C; else goto L_0208C548;
   L_0208C548: ; // 0x208c548
@@ -11834,10 +11834,10 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C5CC */ rbrew_write32(cpu->mem, _t172, cpu->r[8]);
         /* 0208C5D0 */ _t173 = cpu->r[27] + 0x00000014u;
         /* 0208C5D0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t173);
-        /* 0208C5D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000004u);
+        /* 0208C5D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000004u));
         /* 0208C5D8 */ _t174 = cpu->r[27] + 0x00000018u;
         /* 0208C5D8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t174);
-        /* 0208C5DC */ _t175 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C5DC */ _t175 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C5DC */ _t176 = _t175 & 0x00000001u;
         /* 0208C5DC */ if (_t176) goto L_0208C5E0; else goto L_0208C5E4;
   L_0208C5E0: ; // 0x208c5e0
@@ -11853,23 +11853,23 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C5F8 */ _t179 = cpu->r[11] + 0x00000000u;
         /* 0208C5F8 */ cpu->r[10] = rbrew_read8(cpu->mem, _t179);
         /* 0208C5FC */ cpu->r[31] = 0x00000000u;
-        /* 0208C600 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[24]);
+        /* 0208C600 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[24]));
         /* 0208C604 */ cpu->r[12] = 0x00080000u;
-        /* 0208C608 */ _t180 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C608 */ _t180 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C608 */ _t181 = _t180 & 0x00000001u;
         /* 0208C608 */ if (_t181) goto L_0208C630; else goto L_0208C60C;
   L_0208C60C: ; // 0x208c60c
         /* 0208C60C */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208C610 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 0208C610 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 0208C614 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 0208C618 */ _t182 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C618 */ _t182 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C618 */ _t183 = _t182 & 0x00000001u;
         /* 0208C618 */ if (_t183) goto L_0208C62C; else goto L_0208C61C;
   L_0208C61C: ; // 0x208c61c
         /* 0208C61C */ _t184 = cpu->r[11] + 0x00000000u;
         /* 0208C61C */ cpu->r[0] = rbrew_read8(cpu->mem, _t184);
-        /* 0208C620 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[24]);
-        /* 0208C624 */ _t185 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C620 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[24]));
+        /* 0208C624 */ _t185 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C624 */ _t186 = _t185 & 0x00000001u;
         /* 0208C624 */ if (_t186) goto L_0208C628; else goto L_0208C60C;
   L_0208C628: ; // 0x208c628
@@ -11881,10 +11881,10 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C630 */ cpu->r[9] = rbrew_read32(cpu->mem, _t187);
         /* 0208C634 */ _t188 = cpu->r[1] + 0x00000010u;
         /* 0208C634 */ cpu->r[12] = rbrew_read32(cpu->mem, _t188);
-        /* 0208C638 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 0208C638 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 0208C63C */ _t189 = cpu->r[12] + 0x00000014u;
         /* 0208C63C */ cpu->r[4] = rbrew_read32(cpu->mem, _t189);
-        /* 0208C640 */ _t190 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208C640 */ _t190 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208C640 */ _t191 = _t190 & 0x00000001u;
         /* 0208C640 */ if (_t191) goto L_0208C648; else goto L_0208C644;
   L_0208C644: ; // 0x208c644
@@ -11939,10 +11939,10 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C6C8 */ rbrew_write32(cpu->mem, _t205, cpu->r[0]);
         /* 0208C6CC */ _t206 = cpu->r[27] + 0x00000014u;
         /* 0208C6CC */ cpu->r[7] = rbrew_read32(cpu->mem, _t206);
-        /* 0208C6D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x00000005u);
+        /* 0208C6D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x00000005u));
         /* 0208C6D4 */ _t207 = cpu->r[27] + 0x00000018u;
         /* 0208C6D4 */ cpu->r[30] = rbrew_read32(cpu->mem, _t207);
-        /* 0208C6D8 */ _t208 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C6D8 */ _t208 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C6D8 */ _t209 = _t208 & 0x00000001u;
         /* 0208C6D8 */ if (_t209) goto L_0208C6DC; else goto L_0208C6E0;
   L_0208C6DC: ; // 0x208c6dc
@@ -11958,23 +11958,23 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C6F4 */ _t212 = cpu->r[7] + 0x00000000u;
         /* 0208C6F4 */ cpu->r[8] = rbrew_read8(cpu->mem, _t212);
         /* 0208C6F8 */ cpu->r[31] = 0x00000000u;
-        /* 0208C6FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[24]);
+        /* 0208C6FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[24]));
         /* 0208C700 */ cpu->r[0] = 0x00080000u;
-        /* 0208C704 */ _t213 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C704 */ _t213 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C704 */ _t214 = _t213 & 0x00000001u;
         /* 0208C704 */ if (_t214) goto L_0208C72C; else goto L_0208C708;
   L_0208C708: ; // 0x208c708
         /* 0208C708 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208C70C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 0208C70C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 0208C710 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 0208C714 */ _t215 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C714 */ _t215 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C714 */ _t216 = _t215 & 0x00000001u;
         /* 0208C714 */ if (_t216) goto L_0208C728; else goto L_0208C718;
   L_0208C718: ; // 0x208c718
         /* 0208C718 */ _t217 = cpu->r[7] + 0x00000000u;
         /* 0208C718 */ cpu->r[9] = rbrew_read8(cpu->mem, _t217);
-        /* 0208C71C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[24]);
-        /* 0208C720 */ _t218 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C71C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[24]));
+        /* 0208C720 */ _t218 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C720 */ _t219 = _t218 & 0x00000001u;
         /* 0208C720 */ if (_t219) goto L_0208C724; else goto L_0208C708;
   L_0208C724: ; // 0x208c724
@@ -11984,10 +11984,10 @@ void Gambit_fn_0208C098(CPUState* cpu) {
   L_0208C72C: ; // 0x208c72c
         /* 0208C72C */ _t220 = cpu->r[30] + 0x00000008u;
         /* 0208C72C */ cpu->r[11] = rbrew_read32(cpu->mem, _t220);
-        /* 0208C730 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 0208C730 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 0208C734 */ _t221 = cpu->r[1] + 0x00000010u;
         /* 0208C734 */ cpu->r[10] = rbrew_read32(cpu->mem, _t221);
-        /* 0208C738 */ _t222 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208C738 */ _t222 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208C738 */ _t223 = _t222 & 0x00000001u;
         /* 0208C738 */ if (_t223) goto L_0208C740; else goto L_0208C73C;
   L_0208C73C: ; // 0x208c73c
@@ -12044,10 +12044,10 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C7C4 */ rbrew_write32(cpu->mem, _t238, cpu->r[0]);
         /* 0208C7C8 */ _t239 = cpu->r[27] + 0x00000014u;
         /* 0208C7C8 */ cpu->r[4] = rbrew_read32(cpu->mem, _t239);
-        /* 0208C7CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000006u);
+        /* 0208C7CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000006u));
         /* 0208C7D0 */ _t240 = cpu->r[27] + 0x00000018u;
         /* 0208C7D0 */ cpu->r[30] = rbrew_read32(cpu->mem, _t240);
-        /* 0208C7D4 */ _t241 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C7D4 */ _t241 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C7D4 */ _t242 = _t241 & 0x00000001u;
         /* 0208C7D4 */ if (_t242) goto L_0208C7D8; else goto L_0208C7DC;
   L_0208C7D8: ; // 0x208c7d8
@@ -12063,23 +12063,23 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C7F0 */ _t245 = cpu->r[4] + 0x00000000u;
         /* 0208C7F0 */ cpu->r[5] = rbrew_read8(cpu->mem, _t245);
         /* 0208C7F4 */ cpu->r[31] = 0x00000000u;
-        /* 0208C7F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[24]);
+        /* 0208C7F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[24]));
         /* 0208C7FC */ cpu->r[6] = 0x00080000u;
-        /* 0208C800 */ _t246 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C800 */ _t246 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C800 */ _t247 = _t246 & 0x00000001u;
         /* 0208C800 */ if (_t247) goto L_0208C828; else goto L_0208C804;
   L_0208C804: ; // 0x208c804
         /* 0208C804 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208C808 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 0208C808 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 0208C80C */ cpu->r[4] = cpu->r[4] + 0x00000001u;
-        /* 0208C810 */ _t248 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C810 */ _t248 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C810 */ _t249 = _t248 & 0x00000001u;
         /* 0208C810 */ if (_t249) goto L_0208C824; else goto L_0208C814;
   L_0208C814: ; // 0x208c814
         /* 0208C814 */ _t250 = cpu->r[4] + 0x00000000u;
         /* 0208C814 */ cpu->r[0] = rbrew_read8(cpu->mem, _t250);
-        /* 0208C818 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[24]);
-        /* 0208C81C */ _t251 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C818 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[24]));
+        /* 0208C81C */ _t251 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C81C */ _t252 = _t251 & 0x00000001u;
         /* 0208C81C */ if (_t252) goto L_0208C820; else goto L_0208C804;
   L_0208C820: ; // 0x208c820
@@ -12091,10 +12091,10 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C828 */ cpu->r[5] = rbrew_read32(cpu->mem, _t253);
         /* 0208C82C */ _t254 = cpu->r[1] + 0x00000010u;
         /* 0208C82C */ cpu->r[7] = rbrew_read32(cpu->mem, _t254);
-        /* 0208C830 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 0208C830 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 0208C834 */ _t255 = cpu->r[7] + 0x00000014u;
         /* 0208C834 */ cpu->r[8] = rbrew_read32(cpu->mem, _t255);
-        /* 0208C838 */ _t256 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208C838 */ _t256 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208C838 */ _t257 = _t256 & 0x00000001u;
         /* 0208C838 */ if (_t257) goto L_0208C840; else goto L_0208C83C;
   L_0208C83C: ; // 0x208c83c
@@ -12149,10 +12149,10 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C8C0 */ rbrew_write32(cpu->mem, _t271, cpu->r[10]);
         /* 0208C8C4 */ _t272 = cpu->r[27] + 0x00000014u;
         /* 0208C8C4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t272);
-        /* 0208C8C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000007u);
+        /* 0208C8C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000007u));
         /* 0208C8CC */ _t273 = cpu->r[27] + 0x00000018u;
         /* 0208C8CC */ cpu->r[30] = rbrew_read32(cpu->mem, _t273);
-        /* 0208C8D0 */ _t274 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C8D0 */ _t274 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C8D0 */ _t275 = _t274 & 0x00000001u;
         /* 0208C8D0 */ if (_t275) goto L_0208C8D4; else goto L_0208C8D8;
   L_0208C8D4: ; // 0x208c8d4
@@ -12168,23 +12168,23 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C8EC */ _t278 = cpu->r[10] + 0x00000000u;
         /* 0208C8EC */ cpu->r[12] = rbrew_read8(cpu->mem, _t278);
         /* 0208C8F0 */ cpu->r[31] = 0x00000000u;
-        /* 0208C8F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[24]);
+        /* 0208C8F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[24]));
         /* 0208C8F8 */ cpu->r[12] = 0x00080000u;
-        /* 0208C8FC */ _t279 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C8FC */ _t279 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C8FC */ _t280 = _t279 & 0x00000001u;
         /* 0208C8FC */ if (_t280) goto L_0208C924; else goto L_0208C900;
   L_0208C900: ; // 0x208c900
         /* 0208C900 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208C904 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 0208C904 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 0208C908 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 0208C90C */ _t281 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208C90C */ _t281 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208C90C */ _t282 = _t281 & 0x00000001u;
         /* 0208C90C */ if (_t282) goto L_0208C920; else goto L_0208C910;
   L_0208C910: ; // 0x208c910
         /* 0208C910 */ _t283 = cpu->r[10] + 0x00000000u;
         /* 0208C910 */ cpu->r[0] = rbrew_read8(cpu->mem, _t283);
-        /* 0208C914 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[24]);
-        /* 0208C918 */ _t284 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208C914 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[24]));
+        /* 0208C918 */ _t284 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208C918 */ _t285 = _t284 & 0x00000001u;
         /* 0208C918 */ if (_t285) goto L_0208C91C; else goto L_0208C900;
   L_0208C91C: ; // 0x208c91c
@@ -12196,10 +12196,10 @@ void Gambit_fn_0208C098(CPUState* cpu) {
         /* 0208C924 */ cpu->r[6] = rbrew_read32(cpu->mem, _t286);
         /* 0208C928 */ _t287 = cpu->r[1] + 0x00000010u;
         /* 0208C928 */ cpu->r[4] = rbrew_read32(cpu->mem, _t287);
-        /* 0208C92C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 0208C92C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 0208C930 */ _t288 = cpu->r[4] + 0x00000014u;
         /* 0208C930 */ cpu->r[5] = rbrew_read32(cpu->mem, _t288);
-        /* 0208C934 */ _t289 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208C934 */ _t289 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208C934 */ _t290 = _t289 & 0x00000001u;
         /* 0208C934 */ if (_t290) goto L_0208C93C; else goto L_0208C938;
   L_0208C938: ; // 0x208c938
@@ -12412,9 +12412,9 @@ void Gambit_fn_0208CAA4(CPUState* cpu) {
         /* 0208CAA4 */ cpu->r[12] = rbrew_read8(cpu->mem, _t0);
         /* 0208CAA8 */ /* nop */
         /* 0208CAAC */ cpu->r[0] = cpu->r[12] + 0xFFFFFFFEu;
-        /* 0208CAB0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 0208CAB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 0208CAB4 */ cpu->r[0] = 0x00000001u;
-        /* 0208CAB8 */ _t1 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208CAB8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208CAB8 */ _t2 = _t1 & 0x00000001u;
         /* 0208CAB8 */ if (_t2) goto L_0208CABC; else goto L_0208CAC0;
   L_0208CABC: ; // 0x208cabc
@@ -12522,8 +12522,8 @@ void Gambit_fn_0208CB28(CPUState* cpu) {
         /* 0208CB3C */ _t3 = cpu->r[31] + 0x00000118u;
         /* 0208CB3C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 0208CB40 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0208CB40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208CB44 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208CB40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208CB44 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208CB44 */ _t5 = _t4 & 0x00000001u;
         /* 0208CB44 */ if (_t5) goto L_0208CB48; else goto L_0208CB50;
   L_0208CB48: ; // 0x208cb48
@@ -12561,8 +12561,8 @@ void Gambit_fn_0208CB2C(CPUState* cpu) {
         /* 0208CB3C */ _t3 = cpu->r[31] + 0x00000118u;
         /* 0208CB3C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 0208CB40 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0208CB40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208CB44 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208CB40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208CB44 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208CB44 */ _t5 = _t4 & 0x00000001u;
         /* 0208CB44 */ if (_t5) goto L_0208CB48; else goto L_0208CB50;
   L_0208CB48: ; // 0x208cb48
@@ -12715,8 +12715,8 @@ void Gambit_fn_0208CBB0(CPUState* cpu) {
         /* 0208CBE4 */ rbrew_write8(cpu->mem, _t8, (uint8_t)cpu->r[0]);
         /* 0208CBE8 */ goto L_0208CBF4;
   L_0208CBEC: ; // 0x208cbec
-        /* 0208CBEC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], 0x00000018u);
-        /* 0208CBF0 */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208CBEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], 0x00000018u));
+        /* 0208CBF0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208CBF0 */ _t10 = _t9 & 0x00000001u;
         /* 0208CBF0 */ if (_t10) goto L_0208CBF4; else goto L_0208CBFC;
   L_0208CBF4: ; // 0x208cbf4
@@ -12732,9 +12732,9 @@ void Gambit_fn_0208CBB0(CPUState* cpu) {
         /* 0208CC08 */ cpu->r[4] = 0x00000000u;
         /* 0208CC0C */ Gambit_fn_027B9B00(cpu);
         /* 0208CC10 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208CC14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000018u);
+        /* 0208CC14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000018u));
         /* 0208CC18 */ cpu->r[29] = cpu->r[29] + 0x00000004u;
-        /* 0208CC1C */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208CC1C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208CC1C */ _t14 = _t13 & 0x00000001u;
         /* 0208CC1C */ if (_t14) goto L_0208CBEC; else goto L_0208CC20;
   L_0208CC20: ; // 0x208cc20
@@ -12781,8 +12781,8 @@ void Gambit_fn_0208CBB4(CPUState* cpu) {
         /* 0208CBE4 */ rbrew_write8(cpu->mem, _t8, (uint8_t)cpu->r[0]);
         /* 0208CBE8 */ goto L_0208CBF4;
   L_0208CBEC: ; // 0x208cbec
-        /* 0208CBEC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], 0x00000018u);
-        /* 0208CBF0 */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208CBEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], 0x00000018u));
+        /* 0208CBF0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208CBF0 */ _t10 = _t9 & 0x00000001u;
         /* 0208CBF0 */ if (_t10) goto L_0208CBF4; else goto L_0208CBFC;
   L_0208CBF4: ; // 0x208cbf4
@@ -12798,9 +12798,9 @@ void Gambit_fn_0208CBB4(CPUState* cpu) {
         /* 0208CC08 */ cpu->r[4] = 0x00000000u;
         /* 0208CC0C */ Gambit_fn_027B9B00(cpu);
         /* 0208CC10 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208CC14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000018u);
+        /* 0208CC14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000018u));
         /* 0208CC18 */ cpu->r[29] = cpu->r[29] + 0x00000004u;
-        /* 0208CC1C */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208CC1C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208CC1C */ _t14 = _t13 & 0x00000001u;
         /* 0208CC1C */ if (_t14) goto L_0208CBEC; else goto L_0208CC20;
   L_0208CC20: ; // 0x208cc20
@@ -12848,10 +12848,10 @@ void Gambit_fn_0208CC3C(CPUState* cpu) {
   L_0208CC78: ; // 0x208cc78
         /* 0208CC78 */ _t6 = cpu->r[10] + 0x00000000u;
         /* 0208CC78 */ cpu->r[8] = rbrew_read32(cpu->mem, _t6);
-        /* 0208CC7C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000018u);
+        /* 0208CC7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000018u));
         /* 0208CC80 */ _t7 = cpu->r[8] + 0x00000100u;
         /* 0208CC80 */ rbrew_write8(cpu->mem, _t7, (uint8_t)cpu->r[29]);
-        /* 0208CC84 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208CC84 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208CC84 */ _t9 = _t8 & 0x00000001u;
         /* 0208CC84 */ if (_t9) goto L_0208CC88; else goto L_0208CCBC;
   L_0208CC88: ; // 0x208cc88
@@ -12863,14 +12863,14 @@ void Gambit_fn_0208CC3C(CPUState* cpu) {
         /* 0208CC94 */ Gambit_fn_027B9B00(cpu);
         /* 0208CC98 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
         /* 0208CC9C */ cpu->r[27] = cpu->r[27] + 0x00000004u;
-        /* 0208CCA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000018u);
+        /* 0208CCA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000018u));
         /* 0208CCA4 */ cpu->r[30] = cpu->r[30] + 0x00000004u;
-        /* 0208CCA8 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208CCA8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208CCA8 */ _t13 = _t12 & 0x00000001u;
         /* 0208CCA8 */ if (_t13) goto L_0208CCAC; else goto L_0208CCE0;
   L_0208CCAC: ; // 0x208ccac
-        /* 0208CCAC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000018u);
-        /* 0208CCB0 */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208CCAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000018u));
+        /* 0208CCB0 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208CCB0 */ _t15 = _t14 & 0x00000001u;
         /* 0208CCB0 */ if (_t15) goto L_0208CC6C; else goto L_0208CCB4;
   L_0208CCB4: ; // 0x208ccb4
@@ -12885,9 +12885,9 @@ void Gambit_fn_0208CC3C(CPUState* cpu) {
         /* 0208CCC8 */ Gambit_fn_027B9B00(cpu);
         /* 0208CCCC */ cpu->r[28] = cpu->r[28] + 0x00000001u;
         /* 0208CCD0 */ cpu->r[27] = cpu->r[27] + 0x00000004u;
-        /* 0208CCD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000018u);
+        /* 0208CCD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000018u));
         /* 0208CCD8 */ cpu->r[30] = cpu->r[30] + 0x00000004u;
-        /* 0208CCDC */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208CCDC */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208CCDC */ _t19 = _t18 & 0x00000001u;
         /* 0208CCDC */ if (_t19) goto L_0208CCAC; else goto L_0208CCE0;
   L_0208CCE0: ; // 0x208cce0
@@ -12916,8 +12916,8 @@ void Gambit_fn_0208CCF4(CPUState* cpu) {
         /* 0208CD08 */ _t3 = cpu->r[31] + 0x000001E8u;
         /* 0208CD08 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0208CD0C */ /* nop */
-        /* 0208CD10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 0208CD14 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208CD10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 0208CD14 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208CD14 */ _t5 = _t4 & 0x00000001u;
         /* 0208CD14 */ if (_t5) goto L_0208CD18; else goto L_0208CD28;
   L_0208CD18: ; // 0x208cd18
@@ -12927,8 +12927,8 @@ void Gambit_fn_0208CCF4(CPUState* cpu) {
         /* 0208CD20 */ cpu->r[0] = rbrew_read8(cpu->mem, _t6);
         /* 0208CD24 */ /* nop */
   L_0208CD28: ; // 0x208cd28
-        /* 0208CD28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 0208CD2C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208CD28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 0208CD2C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208CD2C */ _t8 = _t7 & 0x00000001u;
         /* 0208CD2C */ if (_t8) goto L_0208CD30; else goto L_0208CD38;
   L_0208CD30: ; // 0x208cd30
@@ -12960,8 +12960,8 @@ void Gambit_fn_0208CCF8(CPUState* cpu) {
         /* 0208CD08 */ _t3 = cpu->r[31] + 0x000001E8u;
         /* 0208CD08 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0208CD0C */ /* nop */
-        /* 0208CD10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 0208CD14 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208CD10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 0208CD14 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208CD14 */ _t5 = _t4 & 0x00000001u;
         /* 0208CD14 */ if (_t5) goto L_0208CD18; else goto L_0208CD28;
   L_0208CD18: ; // 0x208cd18
@@ -12971,8 +12971,8 @@ void Gambit_fn_0208CCF8(CPUState* cpu) {
         /* 0208CD20 */ cpu->r[0] = rbrew_read8(cpu->mem, _t6);
         /* 0208CD24 */ /* nop */
   L_0208CD28: ; // 0x208cd28
-        /* 0208CD28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 0208CD2C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208CD28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 0208CD2C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208CD2C */ _t8 = _t7 & 0x00000001u;
         /* 0208CD2C */ if (_t8) goto L_0208CD30; else goto L_0208CD38;
   L_0208CD30: ; // 0x208cd30
@@ -13004,9 +13004,9 @@ void Gambit_fn_0208CD4C(CPUState* cpu) {
         /* 0208CD5C */ _t3 = cpu->r[3] + 0x000001E8u;
         /* 0208CD5C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0208CD60 */ /* nop */
-        /* 0208CD64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000006u);
+        /* 0208CD64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000006u));
         /* 0208CD68 */ cpu->r[31] = 0x00000001u;
-        /* 0208CD6C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208CD6C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208CD6C */ _t5 = _t4 & 0x00000001u;
         /* 0208CD6C */ if (_t5) goto L_0208CD90; else goto L_0208CD70;
   L_0208CD70: ; // 0x208cd70
@@ -13018,8 +13018,8 @@ void Gambit_fn_0208CD4C(CPUState* cpu) {
         /* 0208CD78 */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
         /* 0208CD7C */ cpu->ctr = cpu->r[0];
         /* 0208CD80 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208CD84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208CD88 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208CD84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208CD88 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208CD88 */ _t10 = _t9 & 0x00000001u;
         /* 0208CD88 */ if (_t10) goto L_0208CD8C; else goto L_0208CD90;
   L_0208CD8C: ; // 0x208cd8c
@@ -13050,9 +13050,9 @@ void Gambit_fn_0208CD50(CPUState* cpu) {
         /* 0208CD5C */ _t3 = cpu->r[3] + 0x000001E8u;
         /* 0208CD5C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0208CD60 */ /* nop */
-        /* 0208CD64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000006u);
+        /* 0208CD64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000006u));
         /* 0208CD68 */ cpu->r[31] = 0x00000001u;
-        /* 0208CD6C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208CD6C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208CD6C */ _t5 = _t4 & 0x00000001u;
         /* 0208CD6C */ if (_t5) goto L_0208CD90; else goto L_0208CD70;
   L_0208CD70: ; // 0x208cd70
@@ -13064,8 +13064,8 @@ void Gambit_fn_0208CD50(CPUState* cpu) {
         /* 0208CD78 */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
         /* 0208CD7C */ cpu->ctr = cpu->r[0];
         /* 0208CD80 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208CD84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208CD88 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208CD84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208CD88 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208CD88 */ _t10 = _t9 & 0x00000001u;
         /* 0208CD88 */ if (_t10) goto L_0208CD8C; else goto L_0208CD90;
   L_0208CD8C: ; // 0x208cd8c
@@ -13111,9 +13111,9 @@ void Gambit_fn_0208CDA8(CPUState* cpu) {
         /* 0208CDE4 */ cpu->r[27] = _t4;
         /* 0208CDE8 */ cpu->r[28] = cpu->r[28] + 0xFFFFDCACu;
         /* 0208CDEC */ cpu->r[31] = cpu->r[3];
-        /* 0208CDF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0208CDF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0208CDF4 */ cpu->r[25] = 0x101D0000u;
-        /* 0208CDF8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208CDF8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208CDF8 */ _t6 = _t5 & 0x00000001u;
         /* 0208CDF8 */ if (_t6) goto L_0208CDFC; else goto L_0208CE08;
   L_0208CDFC: ; // 0x208cdfc
@@ -13123,8 +13123,8 @@ void Gambit_fn_0208CDA8(CPUState* cpu) {
         /* 0208CE04 */ _t8 = cpu->r[27] + 0x00000000u;
         /* 0208CE04 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
   L_0208CE08: ; // 0x208ce08
-        /* 0208CE08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0208CE0C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208CE08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0208CE0C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208CE0C */ _t10 = _t9 & 0x00000001u;
         /* 0208CE0C */ if (_t10) goto L_0208CE30; else goto L_0208CE10;
   L_0208CE10: ; // 0x208ce10
@@ -13136,8 +13136,8 @@ void Gambit_fn_0208CDA8(CPUState* cpu) {
         /* 0208CE1C */ cpu->r[3] = cpu->r[31];
         /* 0208CE20 */ cpu->r[4] = cpu->r[25] + 0xFFFFEE20u;
         /* 0208CE24 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208CE28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208CE2C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208CE28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208CE2C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208CE2C */ _t14 = _t13 & 0x00000001u;
         /* 0208CE2C */ if (_t14) goto L_0208CE30; else goto L_0208CE34;
   L_0208CE30: ; // 0x208ce30
@@ -13163,9 +13163,9 @@ void Gambit_fn_0208CDA8(CPUState* cpu) {
         /* 0208CE60 */ Gambit_fn_026D86C0(cpu);
         /* 0208CE64 */ _t21 = cpu->r[27] + 0x00000000u;
         /* 0208CE64 */ cpu->r[6] = rbrew_read32(cpu->mem, _t21);
-        /* 0208CE68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 0208CE68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 0208CE6C */ cpu->r[31] = cpu->r[3];
-        /* 0208CE70 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208CE70 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208CE70 */ _t23 = _t22 & 0x00000001u;
         /* 0208CE70 */ if (_t23) goto L_0208CE74; else goto L_0208CE80;
   L_0208CE74: ; // 0x208ce74
@@ -13175,8 +13175,8 @@ void Gambit_fn_0208CDA8(CPUState* cpu) {
         /* 0208CE7C */ _t25 = cpu->r[27] + 0x00000000u;
         /* 0208CE7C */ rbrew_write32(cpu->mem, _t25, cpu->r[7]);
   L_0208CE80: ; // 0x208ce80
-        /* 0208CE80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0208CE84 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208CE80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0208CE84 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208CE84 */ _t27 = _t26 & 0x00000001u;
         /* 0208CE84 */ if (_t27) goto L_0208CEA8; else goto L_0208CE88;
   L_0208CE88: ; // 0x208ce88
@@ -13188,8 +13188,8 @@ void Gambit_fn_0208CDA8(CPUState* cpu) {
         /* 0208CE94 */ cpu->r[3] = cpu->r[31];
         /* 0208CE98 */ cpu->r[4] = cpu->r[25] + 0xFFFFEE20u;
         /* 0208CE9C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208CEA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208CEA4 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208CEA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208CEA4 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208CEA4 */ _t31 = _t30 & 0x00000001u;
         /* 0208CEA4 */ if (_t31) goto L_0208CEA8; else goto L_0208CEAC;
   L_0208CEA8: ; // 0x208cea8
@@ -13230,9 +13230,9 @@ void Gambit_fn_0208CDA8(CPUState* cpu) {
         /* 0208CF08 */ cpu->r[6] = rbrew_read32(cpu->mem, _t40);
         /* 0208CF08 */ cpu->r[23] = _t40;
         /* 0208CF0C */ cpu->r[31] = 0x101D0000u;
-        /* 0208CF10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 0208CF10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 0208CF14 */ cpu->r[30] = cpu->r[3];
-        /* 0208CF18 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208CF18 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208CF18 */ _t42 = _t41 & 0x00000001u;
         /* 0208CF18 */ if (_t42) goto L_0208CF1C; else goto L_0208CF30;
   L_0208CF1C: ; // 0x208cf1c
@@ -13244,8 +13244,8 @@ void Gambit_fn_0208CDA8(CPUState* cpu) {
         /* 0208CF2C */ _t44 = cpu->r[31] + 0xFFFFEDDCu;
         /* 0208CF2C */ rbrew_write32(cpu->mem, _t44, cpu->r[8]);
   L_0208CF30: ; // 0x208cf30
-        /* 0208CF30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0208CF34 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208CF30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0208CF34 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208CF34 */ _t46 = _t45 & 0x00000001u;
         /* 0208CF34 */ if (_t46) goto L_0208CF58; else goto L_0208CF38;
   L_0208CF38: ; // 0x208cf38
@@ -13257,8 +13257,8 @@ void Gambit_fn_0208CDA8(CPUState* cpu) {
         /* 0208CF44 */ cpu->r[3] = cpu->r[30];
         /* 0208CF48 */ cpu->r[4] = cpu->r[31] + 0xFFFFEDDCu;
         /* 0208CF4C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208CF50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208CF54 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208CF50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208CF54 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208CF54 */ _t50 = _t49 & 0x00000001u;
         /* 0208CF54 */ if (_t50) goto L_0208CF58; else goto L_0208CF5C;
   L_0208CF58: ; // 0x208cf58
@@ -13297,13 +13297,13 @@ void Gambit_fn_0208CDA8(CPUState* cpu) {
         /* 0208CFB4 */ cpu->r[5] = cpu->r[22];
         /* 0208CFB8 */ cpu->r[4] = cpu->r[20] + 0xFFFFDD80u;
         /* 0208CFBC */ cpu->r[3] = cpu->r[1] + 0x00000018u;
-        /* 0208CFC0 */ _t58 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0208CFC0 */ _t58 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0208CFC0 */ _t59 = _t58 & 0x00000001u;
         /* 0208CFC0 */ if (_t59) goto L_0208CFC4; // else: addr-0 trap, fall-through
   L_0208CFC4: ; // 0x208cfc4
         /* 0208CFC4 */ Gambit_fn_0282A5F4(cpu);
-        /* 0208CFC8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[22], 0x00000018u);
-        /* 0208CFCC */ _t60 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208CFC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[22], 0x00000018u));
+        /* 0208CFCC */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208CFCC */ _t61 = _t60 & 0x00000001u;
         /* 0208CFCC */ if (_t61) goto L_0208CFD0; else goto L_0208CFF4;
   L_0208CFD0: ; // 0x208cfd0
@@ -13313,9 +13313,9 @@ void Gambit_fn_0208CDA8(CPUState* cpu) {
         /* 0208CFDC */ Gambit_fn_026D86C0(cpu);
         /* 0208CFE0 */ _t62 = cpu->r[27] + 0x00000000u;
         /* 0208CFE0 */ cpu->r[6] = rbrew_read32(cpu->mem, _t62);
-        /* 0208CFE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 0208CFE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 0208CFE8 */ cpu->r[30] = cpu->r[3];
-        /* 0208CFEC */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208CFEC */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208CFEC */ _t64 = _t63 & 0x00000001u;
         /* 0208CFEC */ if (_t64) goto L_0208CFF0; else goto L_0208D01C;
   L_0208CFF0: ; // 0x208cff0
@@ -13327,9 +13327,9 @@ void Gambit_fn_0208CDA8(CPUState* cpu) {
         /* 0208D000 */ Gambit_fn_026D86C0(cpu);
         /* 0208D004 */ _t65 = cpu->r[27] + 0x00000000u;
         /* 0208D004 */ cpu->r[6] = rbrew_read32(cpu->mem, _t65);
-        /* 0208D008 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 0208D008 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 0208D00C */ cpu->r[30] = cpu->r[3];
-        /* 0208D010 */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D010 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D010 */ _t67 = _t66 & 0x00000001u;
         /* 0208D010 */ if (_t67) goto L_0208D014; else goto L_0208D01C;
   L_0208D014: ; // 0x208d014
@@ -13338,8 +13338,8 @@ void Gambit_fn_0208CDA8(CPUState* cpu) {
         /* 0208D018 */ _t69 = cpu->r[27] + 0x00000000u;
         /* 0208D018 */ rbrew_write32(cpu->mem, _t69, cpu->r[15]);
   L_0208D01C: ; // 0x208d01c
-        /* 0208D01C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0208D020 */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D01C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0208D020 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D020 */ _t71 = _t70 & 0x00000001u;
         /* 0208D020 */ if (_t71) goto L_0208D044; else goto L_0208D024;
   L_0208D024: ; // 0x208d024
@@ -13351,26 +13351,26 @@ void Gambit_fn_0208CDA8(CPUState* cpu) {
         /* 0208D030 */ cpu->r[3] = cpu->r[30];
         /* 0208D034 */ cpu->r[4] = cpu->r[25] + 0xFFFFEE20u;
         /* 0208D038 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208D03C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208D040 */ _t74 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D03C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208D040 */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D040 */ _t75 = _t74 & 0x00000001u;
         /* 0208D040 */ if (_t75) goto L_0208D044; else goto L_0208D048;
   L_0208D044: ; // 0x208d044
         /* 0208D044 */ cpu->r[30] = 0x00000000u;
   L_0208D048: ; // 0x208d048
-        /* 0208D048 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[22], 0x00000018u);
+        /* 0208D048 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[22], 0x00000018u));
         /* 0208D04C */ _t76 = cpu->r[24] + 0x00000000u;
         /* 0208D04C */ rbrew_write32(cpu->mem, _t76, cpu->r[30]);
-        /* 0208D050 */ _t77 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208D050 */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208D050 */ _t78 = _t77 & 0x00000001u;
         /* 0208D050 */ if (_t78) goto L_0208D054; else goto L_0208D068;
   L_0208D054: ; // 0x208d054
         /* 0208D054 */ _t79 = cpu->r[14] + cpu->r[18];
         /* 0208D054 */ cpu->r[8] = rbrew_read32(cpu->mem, _t79);
-        /* 0208D058 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[22], 0x00000018u);
+        /* 0208D058 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[22], 0x00000018u));
         /* 0208D05C */ _t80 = cpu->r[8] + 0x000001B7u;
         /* 0208D05C */ rbrew_write8(cpu->mem, _t80, (uint8_t)cpu->r[15]);
-        /* 0208D060 */ _t81 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208D060 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208D060 */ _t82 = _t81 & 0x00000001u;
         /* 0208D060 */ if (_t82) goto L_0208D078; else goto L_0208D064;
   L_0208D064: ; // 0x208d064
@@ -13378,24 +13378,24 @@ void Gambit_fn_0208CDA8(CPUState* cpu) {
   L_0208D068: ; // 0x208d068
         /* 0208D068 */ _t83 = cpu->r[14] + 0x00000000u;
         /* 0208D068 */ cpu->r[8] = rbrew_read32(cpu->mem, _t83);
-        /* 0208D06C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[22], 0x00000018u);
+        /* 0208D06C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[22], 0x00000018u));
         /* 0208D070 */ _t84 = cpu->r[8] + 0x000001B7u;
         /* 0208D070 */ rbrew_write8(cpu->mem, _t84, (uint8_t)cpu->r[15]);
-        /* 0208D074 */ _t85 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208D074 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208D074 */ _t86 = _t85 & 0x00000001u;
         /* 0208D074 */ if (_t86) goto L_0208D078; else goto L_0208D088;
   L_0208D078: ; // 0x208d078
-        /* 0208D078 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[22], 0x00000018u);
+        /* 0208D078 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[22], 0x00000018u));
         /* 0208D07C */ cpu->r[24] = cpu->r[19] + cpu->r[18];
-        /* 0208D080 */ _t87 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208D080 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208D080 */ _t88 = _t87 & 0x00000001u;
         /* 0208D080 */ if (_t88) goto L_0208D094; else goto L_0208D084;
   L_0208D084: ; // 0x208d084
         /* 0208D084 */ goto L_0208D0BC;
   L_0208D088: ; // 0x208d088
-        /* 0208D088 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[22], 0x00000018u);
+        /* 0208D088 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[22], 0x00000018u));
         /* 0208D08C */ cpu->r[24] = cpu->r[19];
-        /* 0208D090 */ _t89 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208D090 */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208D090 */ _t90 = _t89 & 0x00000001u;
         /* 0208D090 */ if (_t90) goto L_0208D094; else goto L_0208D0BC;
   L_0208D094: ; // 0x208d094
@@ -13409,9 +13409,9 @@ void Gambit_fn_0208CDA8(CPUState* cpu) {
         /* 0208D0A4 */ Gambit_fn_026DB34C(cpu);
         /* 0208D0A8 */ _t94 = cpu->r[23] + 0x00000000u;
         /* 0208D0A8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t94);
-        /* 0208D0AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0208D0AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0208D0B0 */ cpu->r[30] = cpu->r[3];
-        /* 0208D0B4 */ _t95 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D0B4 */ _t95 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D0B4 */ _t96 = _t95 & 0x00000001u;
         /* 0208D0B4 */ if (_t96) goto L_0208D0B8; else goto L_0208D0F0;
   L_0208D0B8: ; // 0x208d0b8
@@ -13427,9 +13427,9 @@ void Gambit_fn_0208CDA8(CPUState* cpu) {
         /* 0208D0CC */ Gambit_fn_026DB34C(cpu);
         /* 0208D0D0 */ _t100 = cpu->r[23] + 0x00000000u;
         /* 0208D0D0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t100);
-        /* 0208D0D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0208D0D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0208D0D8 */ cpu->r[30] = cpu->r[3];
-        /* 0208D0DC */ _t101 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D0DC */ _t101 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D0DC */ _t102 = _t101 & 0x00000001u;
         /* 0208D0DC */ if (_t102) goto L_0208D0E0; else goto L_0208D0F0;
   L_0208D0E0: ; // 0x208d0e0
@@ -13440,8 +13440,8 @@ void Gambit_fn_0208CDA8(CPUState* cpu) {
         /* 0208D0EC */ _t104 = cpu->r[31] + 0xFFFFEDDCu;
         /* 0208D0EC */ rbrew_write32(cpu->mem, _t104, cpu->r[0]);
   L_0208D0F0: ; // 0x208d0f0
-        /* 0208D0F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0208D0F4 */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D0F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0208D0F4 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D0F4 */ _t106 = _t105 & 0x00000001u;
         /* 0208D0F4 */ if (_t106) goto L_0208D118; else goto L_0208D0F8;
   L_0208D0F8: ; // 0x208d0f8
@@ -13453,8 +13453,8 @@ void Gambit_fn_0208CDA8(CPUState* cpu) {
         /* 0208D104 */ cpu->r[3] = cpu->r[30];
         /* 0208D108 */ cpu->r[4] = cpu->r[31] + 0xFFFFEDDCu;
         /* 0208D10C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208D110 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208D114 */ _t109 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D110 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208D114 */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D114 */ _t110 = _t109 & 0x00000001u;
         /* 0208D114 */ if (_t110) goto L_0208D118; else goto L_0208D11C;
   L_0208D118: ; // 0x208d118
@@ -13469,13 +13469,13 @@ void Gambit_fn_0208CDA8(CPUState* cpu) {
         /* 0208D128 */ cpu->r[4] = cpu->r[22] + 0x00000002u;
         /* 0208D12C */ Gambit_fn_02026910(cpu);
         /* 0208D130 */ cpu->r[4] = cpu->r[3];
-        /* 0208D130 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0208D134 */ _t114 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D130 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0208D134 */ _t114 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D134 */ _t115 = _t114 & 0x00000001u;
         /* 0208D134 */ if (_t115) goto L_0208D154; else goto L_0208D138;
   L_0208D138: ; // 0x208d138
-        /* 0208D138 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[22], 0x00000018u);
-        /* 0208D13C */ _t116 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208D138 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[22], 0x00000018u));
+        /* 0208D13C */ _t116 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208D13C */ _t117 = _t116 & 0x00000001u;
         /* 0208D13C */ if (_t117) goto L_0208D140; else goto L_0208D14C;
   L_0208D140: ; // 0x208d140
@@ -13489,10 +13489,10 @@ void Gambit_fn_0208CDA8(CPUState* cpu) {
         /* 0208D150 */ Gambit_fn_020CEED0(cpu);
   L_0208D154: ; // 0x208d154
         /* 0208D154 */ cpu->r[17] = cpu->r[17] + 0xFFFFFFFFu;
-        /* 0208D154 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[17], 0x00000000u);
+        /* 0208D154 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[17], 0x00000000u));
         /* 0208D158 */ cpu->r[22] = cpu->r[22] + 0x00000001u;
         /* 0208D15C */ cpu->r[18] = cpu->r[18] + 0x00000004u;
-        /* 0208D160 */ _t120 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D160 */ _t120 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D160 */ _t121 = _t120 & 0x00000001u;
         /* 0208D160 */ if (_t121) goto L_0208D164; else goto L_0208CFB4;
   L_0208D164: ; // 0x208d164
@@ -13867,8 +13867,8 @@ void Gambit_fn_0208D304(CPUState* cpu) {
         /* 020E8D2C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020E8D30 */ _t11 = cpu->r[1] + 0x00000008u;
         /* 020E8D30 */ cpu->r[12] = rbrew_read32(cpu->mem, _t11);
-        /* 020E8D34 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[12]);
-        /* 020E8D38 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020E8D34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[12]));
+        /* 020E8D38 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020E8D38 */ _t13 = _t12 & 0x00000001u;
         /* 020E8D38 */ if (_t13) goto L_020E8D80; else goto L_020E8D3C;
   L_020E8D3C: ; // 0x20e8d3c
@@ -13891,13 +13891,13 @@ void Gambit_fn_0208D304(CPUState* cpu) {
         /* 020E8D64 */ _t18 = cpu->r[12] + 0x00000001u;
         /* 020E8D64 */ cpu->r[0] = rbrew_read8(cpu->mem, _t18);
         /* 020E8D64 */ cpu->r[12] = _t18;
-        /* 020E8D68 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[0]);
-        /* 020E8D6C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020E8D68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[0]));
+        /* 020E8D6C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020E8D6C */ _t20 = _t19 & 0x00000001u;
         /* 020E8D6C */ if (_t20) goto L_020E8D70; else goto L_020E8D98;
   L_020E8D70: ; // 0x20e8d70
-        /* 020E8D70 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[31]);
-        /* 020E8D74 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020E8D70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[31]));
+        /* 020E8D74 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020E8D74 */ _t22 = _t21 & 0x00000001u;
         /* 020E8D74 */ if (_t22) goto L_020E8D80; else goto L_020E8D78;
   L_020E8D78: ; // 0x20e8d78
@@ -13948,8 +13948,8 @@ void Gambit_fn_0208D304(CPUState* cpu) {
         /* 020E8DE4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020E8DE8 */ _t36 = cpu->r[1] + 0x00000008u;
         /* 020E8DE8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t36);
-        /* 020E8DEC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], cpu->r[5]);
-        /* 020E8DF0 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020E8DEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], cpu->r[5]));
+        /* 020E8DF0 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020E8DF0 */ _t38 = _t37 & 0x00000001u;
         /* 020E8DF0 */ if (_t38) goto L_020E8FFC; else goto L_020E8DF4;
   L_020E8DF4: ; // 0x20e8df4
@@ -13967,13 +13967,13 @@ void Gambit_fn_0208D304(CPUState* cpu) {
         /* 020E8E0C */ _t42 = cpu->r[10] + 0x00000001u;
         /* 020E8E0C */ cpu->r[6] = rbrew_read8(cpu->mem, _t42);
         /* 020E8E0C */ cpu->r[10] = _t42;
-        /* 020E8E10 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[6]);
-        /* 020E8E14 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020E8E10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[6]));
+        /* 020E8E14 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020E8E14 */ _t44 = _t43 & 0x00000001u;
         /* 020E8E14 */ if (_t44) goto L_020E8E18; else goto L_020E8E24;
   L_020E8E18: ; // 0x20e8e18
-        /* 020E8E18 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[31]);
-        /* 020E8E1C */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020E8E18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[31]));
+        /* 020E8E1C */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020E8E1C */ _t46 = _t45 & 0x00000001u;
         /* 020E8E1C */ if (_t46) goto L_020E8FFC; else goto L_020E8E20;
   L_020E8E20: ; // 0x20e8e20
@@ -14014,8 +14014,8 @@ void Gambit_fn_0208D304(CPUState* cpu) {
         /* 020E8E70 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020E8E74 */ _t59 = cpu->r[1] + 0x00000008u;
         /* 020E8E74 */ cpu->r[5] = rbrew_read32(cpu->mem, _t59);
-        /* 020E8E78 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], cpu->r[5]);
-        /* 020E8E7C */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020E8E78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], cpu->r[5]));
+        /* 020E8E7C */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020E8E7C */ _t61 = _t60 & 0x00000001u;
         /* 020E8E7C */ if (_t61) goto L_020E8EB4; else goto L_020E8E80;
   L_020E8E80: ; // 0x20e8e80
@@ -14033,13 +14033,13 @@ void Gambit_fn_0208D304(CPUState* cpu) {
         /* 020E8E98 */ _t65 = cpu->r[7] + 0x00000001u;
         /* 020E8E98 */ cpu->r[6] = rbrew_read8(cpu->mem, _t65);
         /* 020E8E98 */ cpu->r[7] = _t65;
-        /* 020E8E9C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[6]);
-        /* 020E8EA0 */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020E8E9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[6]));
+        /* 020E8EA0 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020E8EA0 */ _t67 = _t66 & 0x00000001u;
         /* 020E8EA0 */ if (_t67) goto L_020E8EA4; else goto L_020E8ECC;
   L_020E8EA4: ; // 0x20e8ea4
-        /* 020E8EA4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[31]);
-        /* 020E8EA8 */ _t68 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020E8EA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[31]));
+        /* 020E8EA8 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020E8EA8 */ _t69 = _t68 & 0x00000001u;
         /* 020E8EA8 */ if (_t69) goto L_020E8EB4; else goto L_020E8EAC;
   L_020E8EAC: ; // 0x20e8eac
@@ -14090,8 +14090,8 @@ void Gambit_fn_0208D304(CPUState* cpu) {
         /* 020E8F18 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020E8F1C */ _t83 = cpu->r[1] + 0x00000008u;
         /* 020E8F1C */ cpu->r[7] = rbrew_read32(cpu->mem, _t83);
-        /* 020E8F20 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], cpu->r[7]);
-        /* 020E8F24 */ _t84 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020E8F20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], cpu->r[7]));
+        /* 020E8F24 */ _t84 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020E8F24 */ _t85 = _t84 & 0x00000001u;
         /* 020E8F24 */ if (_t85) goto L_020E8FFC; else goto L_020E8F28;
   L_020E8F28: ; // 0x20e8f28
@@ -14109,13 +14109,13 @@ void Gambit_fn_0208D304(CPUState* cpu) {
         /* 020E8F40 */ _t89 = cpu->r[10] + 0x00000001u;
         /* 020E8F40 */ cpu->r[8] = rbrew_read8(cpu->mem, _t89);
         /* 020E8F40 */ cpu->r[10] = _t89;
-        /* 020E8F44 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[8]);
-        /* 020E8F48 */ _t90 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020E8F44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[8]));
+        /* 020E8F48 */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020E8F48 */ _t91 = _t90 & 0x00000001u;
         /* 020E8F48 */ if (_t91) goto L_020E8F4C; else goto L_020E8F58;
   L_020E8F4C: ; // 0x20e8f4c
-        /* 020E8F4C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[31]);
-        /* 020E8F50 */ _t92 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020E8F4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[31]));
+        /* 020E8F50 */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020E8F50 */ _t93 = _t92 & 0x00000001u;
         /* 020E8F50 */ if (_t93) goto L_020E8FFC; else goto L_020E8F54;
   L_020E8F54: ; // 0x20e8f54
@@ -14156,8 +14156,8 @@ void Gambit_fn_0208D304(CPUState* cpu) {
         /* 020E8FA4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020E8FA8 */ _t106 = cpu->r[1] + 0x00000008u;
         /* 020E8FA8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t106);
-        /* 020E8FAC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[0]);
-        /* 020E8FB0 */ _t107 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020E8FAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[0]));
+        /* 020E8FB0 */ _t107 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020E8FB0 */ _t108 = _t107 & 0x00000001u;
         /* 020E8FB0 */ if (_t108) goto L_020E8FFC; else goto L_020E8FB4;
   L_020E8FB4: ; // 0x20e8fb4
@@ -14175,13 +14175,13 @@ void Gambit_fn_0208D304(CPUState* cpu) {
         /* 020E8FCC */ _t112 = cpu->r[5] + 0x00000001u;
         /* 020E8FCC */ cpu->r[6] = rbrew_read8(cpu->mem, _t112);
         /* 020E8FCC */ cpu->r[5] = _t112;
-        /* 020E8FD0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[6]);
-        /* 020E8FD4 */ _t113 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020E8FD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[6]));
+        /* 020E8FD4 */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020E8FD4 */ _t114 = _t113 & 0x00000001u;
         /* 020E8FD4 */ if (_t114) goto L_020E8FD8; else goto L_020E8FE4;
   L_020E8FD8: ; // 0x20e8fd8
-        /* 020E8FD8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020E8FDC */ _t115 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020E8FD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020E8FDC */ _t115 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020E8FDC */ _t116 = _t115 & 0x00000001u;
         /* 020E8FDC */ if (_t116) goto L_020E8FFC; else goto L_020E8FE0;
   L_020E8FE0: ; // 0x20e8fe0
@@ -14225,8 +14225,8 @@ void Gambit_fn_0208D310(CPUState* cpu) {
         /* 0208D320 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 0208D324 */ _t4 = cpu->r[30] + 0x000001E4u;
         /* 0208D324 */ cpu->r[7] = rbrew_read32(cpu->mem, _t4);
-        /* 0208D328 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0208D32C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D328 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0208D32C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D32C */ _t6 = _t5 & 0x00000001u;
         /* 0208D32C */ if (_t6) goto L_0208D330; else goto L_0208D45C;
   L_0208D330: ; // 0x208d330
@@ -14294,8 +14294,8 @@ void Gambit_fn_0208D310(CPUState* cpu) {
         /* 0208D3E4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208D3E8 */ _t23 = cpu->r[1] + 0x00000018u;
         /* 0208D3E8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t23);
-        /* 0208D3EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[10]);
-        /* 0208D3F0 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D3EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[10]));
+        /* 0208D3F0 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D3F0 */ _t25 = _t24 & 0x00000001u;
         /* 0208D3F0 */ if (_t25) goto L_0208D44C; else goto L_0208D3F4;
   L_0208D3F4: ; // 0x208d3f4
@@ -14316,13 +14316,13 @@ void Gambit_fn_0208D310(CPUState* cpu) {
         /* 0208D418 */ _t30 = cpu->r[10] + 0x00000001u;
         /* 0208D418 */ cpu->r[0] = rbrew_read8(cpu->mem, _t30);
         /* 0208D418 */ cpu->r[10] = _t30;
-        /* 0208D41C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[0]);
-        /* 0208D420 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D41C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[0]));
+        /* 0208D420 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D420 */ _t32 = _t31 & 0x00000001u;
         /* 0208D420 */ if (_t32) goto L_0208D424; else goto L_0208D45C;
   L_0208D424: ; // 0x208d424
-        /* 0208D424 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[12]);
-        /* 0208D428 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D424 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[12]));
+        /* 0208D428 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D428 */ _t34 = _t33 & 0x00000001u;
         /* 0208D428 */ if (_t34) goto L_0208D44C; else goto L_0208D42C;
   L_0208D42C: ; // 0x208d42c
@@ -14336,8 +14336,8 @@ void Gambit_fn_0208D310(CPUState* cpu) {
         /* 0208D434 */ cpu->r[3] = cpu->r[30];
         /* 0208D438 */ cpu->r[4] = 0x00000000u;
         /* 0208D43C */ Gambit_fn_027EDF00(cpu);
-        /* 0208D440 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208D444 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D440 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208D444 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D444 */ _t39 = _t38 & 0x00000001u;
         /* 0208D444 */ if (_t39) goto L_0208D47C; else goto L_0208D448;
   L_0208D448: ; // 0x208d448
@@ -14352,8 +14352,8 @@ void Gambit_fn_0208D310(CPUState* cpu) {
         /* 0208D45C */ cpu->r[3] = cpu->r[30];
         /* 0208D460 */ cpu->r[4] = 0x00000000u;
         /* 0208D464 */ Gambit_fn_027EDF00(cpu);
-        /* 0208D468 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208D46C */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D468 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208D46C */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D46C */ _t42 = _t41 & 0x00000001u;
         /* 0208D46C */ if (_t42) goto L_0208D47C; else goto L_0208D470;
   L_0208D470: ; // 0x208d470
@@ -14387,15 +14387,15 @@ void Gambit_fn_0208D494(CPUState* cpu) {
         /* 0208D4A4 */ cpu->r[31] = cpu->r[3];
         /* 0208D4A8 */ _t2 = cpu->r[31] + 0x000001E4u;
         /* 0208D4A8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t2);
-        /* 0208D4AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0208D4B0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D4AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0208D4B0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D4B0 */ _t4 = _t3 & 0x00000001u;
         /* 0208D4B0 */ if (_t4) goto L_0208D4B4; else goto L_0208D548;
   L_0208D4B4: ; // 0x208d4b4
         /* 0208D4B4 */ _t5 = cpu->r[31] + 0x0000021Cu;
         /* 0208D4B4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t5);
-        /* 0208D4B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208D4BC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D4B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208D4BC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D4BC */ _t7 = _t6 & 0x00000001u;
         /* 0208D4BC */ if (_t7) goto L_0208D4C0; else goto L_0208D4C8;
   L_0208D4C0: ; // 0x208d4c0
@@ -14413,8 +14413,8 @@ void Gambit_fn_0208D494(CPUState* cpu) {
         /* 0208D4E0 */ _t8 = cpu->r[6] + 0x00000000u;
         /* 0208D4E0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t8);
         /* 0208D4E4 */ Gambit_fn_02068B24(cpu);
-        /* 0208D4E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], 0x00000018u);
-        /* 0208D4EC */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208D4E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], 0x00000018u));
+        /* 0208D4EC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208D4EC */ _t10 = _t9 & 0x00000001u;
         /* 0208D4EC */ if (_t10) goto L_0208D4F0; else goto L_0208D51C;
   L_0208D4F0: ; // 0x208d4f0
@@ -14423,14 +14423,14 @@ void Gambit_fn_0208D494(CPUState* cpu) {
         /* 0208D4F4 */ Gambit_fn_020DB518(cpu);
         /* 0208D4F8 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
         /* 0208D4FC */ cpu->r[26] = cpu->r[26] + 0x00000004u;
-        /* 0208D500 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000018u);
+        /* 0208D500 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000018u));
         /* 0208D504 */ cpu->r[27] = cpu->r[27] + 0x00000004u;
-        /* 0208D508 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208D508 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208D508 */ _t13 = _t12 & 0x00000001u;
         /* 0208D508 */ if (_t13) goto L_0208D50C; else goto L_0208D538;
   L_0208D50C: ; // 0x208d50c
-        /* 0208D50C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], 0x00000018u);
-        /* 0208D510 */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208D50C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], 0x00000018u));
+        /* 0208D510 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208D510 */ _t15 = _t14 & 0x00000001u;
         /* 0208D510 */ if (_t15) goto L_0208D4D8; else goto L_0208D514;
   L_0208D514: ; // 0x208d514
@@ -14442,9 +14442,9 @@ void Gambit_fn_0208D494(CPUState* cpu) {
         /* 0208D520 */ Gambit_fn_020DB518(cpu);
         /* 0208D524 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
         /* 0208D528 */ cpu->r[26] = cpu->r[26] + 0x00000004u;
-        /* 0208D52C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000018u);
+        /* 0208D52C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000018u));
         /* 0208D530 */ cpu->r[27] = cpu->r[27] + 0x00000004u;
-        /* 0208D534 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208D534 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208D534 */ _t18 = _t17 & 0x00000001u;
         /* 0208D534 */ if (_t18) goto L_0208D50C; else goto L_0208D538;
   L_0208D538: ; // 0x208d538
@@ -14463,8 +14463,8 @@ void Gambit_fn_0208D494(CPUState* cpu) {
         /* 0208D550 */ cpu->r[0] = rbrew_read32(cpu->mem, _t23);
         /* 0208D554 */ cpu->ctr = cpu->r[0];
         /* 0208D558 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208D55C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208D560 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D55C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208D560 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D560 */ _t25 = _t24 & 0x00000001u;
         /* 0208D560 */ if (_t25) goto L_0208D578; else goto L_0208D564;
   L_0208D564: ; // 0x208d564
@@ -14482,8 +14482,8 @@ void Gambit_fn_0208D494(CPUState* cpu) {
         /* 0208D580 */ cpu->r[0] = rbrew_read32(cpu->mem, _t28);
         /* 0208D584 */ cpu->ctr = cpu->r[0];
         /* 0208D588 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208D58C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208D590 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D58C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208D590 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D590 */ _t30 = _t29 & 0x00000001u;
         /* 0208D590 */ if (_t30) goto L_0208D5A8; else goto L_0208D594;
   L_0208D594: ; // 0x208d594
@@ -14516,8 +14516,8 @@ void Gambit_fn_0208D5BC(CPUState* cpu) {
         /* 0208D5CC */ cpu->r[31] = cpu->r[3];
         /* 0208D5D0 */ _t2 = cpu->r[31] + 0x000001E4u;
         /* 0208D5D0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t2);
-        /* 0208D5D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208D5D8 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D5D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208D5D8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D5D8 */ _t4 = _t3 & 0x00000001u;
         /* 0208D5D8 */ if (_t4) goto L_0208D5DC; else goto L_0208D718;
   L_0208D5DC: ; // 0x208d5dc
@@ -14544,8 +14544,8 @@ void Gambit_fn_0208D5BC(CPUState* cpu) {
         /* 0208D618 */ cpu->r[4] = 0x00000002u;
         /* 0208D61C */ Gambit_fn_02026910(cpu);
         /* 0208D620 */ cpu->r[30] = cpu->r[3];
-        /* 0208D620 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0208D624 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D620 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0208D624 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D624 */ _t11 = _t10 & 0x00000001u;
         /* 0208D624 */ if (_t11) goto L_0208D64C; else goto L_0208D628;
   L_0208D628: ; // 0x208d628
@@ -14585,16 +14585,16 @@ void Gambit_fn_0208D5BC(CPUState* cpu) {
         /* 0208D680 */ cpu->r[4] = 0x00000001u;
         /* 0208D684 */ cpu->r[5] = 0x00000000u;
         /* 0208D688 */ Gambit_fn_020BDD60(cpu);
-        /* 0208D68C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000018u);
-        /* 0208D690 */ _t20 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208D68C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000018u));
+        /* 0208D690 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208D690 */ _t21 = _t20 & 0x00000001u;
         /* 0208D690 */ if (_t21) goto L_0208D694; else goto L_0208D6A8;
   L_0208D694: ; // 0x208d694
         /* 0208D694 */ _t22 = cpu->r[30] + cpu->r[26];
         /* 0208D694 */ cpu->r[3] = rbrew_read32(cpu->mem, _t22);
         /* 0208D698 */ Gambit_fn_02068B24(cpu);
-        /* 0208D69C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000018u);
-        /* 0208D6A0 */ _t23 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208D69C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000018u));
+        /* 0208D6A0 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208D6A0 */ _t24 = _t23 & 0x00000001u;
         /* 0208D6A0 */ if (_t24) goto L_0208D6B8; else goto L_0208D6A4;
   L_0208D6A4: ; // 0x208d6a4
@@ -14603,8 +14603,8 @@ void Gambit_fn_0208D5BC(CPUState* cpu) {
         /* 0208D6A8 */ _t25 = cpu->r[30] + 0x00000000u;
         /* 0208D6A8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t25);
         /* 0208D6AC */ Gambit_fn_02068B24(cpu);
-        /* 0208D6B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000018u);
-        /* 0208D6B4 */ _t26 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208D6B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000018u));
+        /* 0208D6B4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208D6B4 */ _t27 = _t26 & 0x00000001u;
         /* 0208D6B4 */ if (_t27) goto L_0208D6B8; else goto L_0208D6E4;
   L_0208D6B8: ; // 0x208d6b8
@@ -14613,14 +14613,14 @@ void Gambit_fn_0208D5BC(CPUState* cpu) {
         /* 0208D6BC */ Gambit_fn_020DB518(cpu);
         /* 0208D6C0 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
         /* 0208D6C4 */ cpu->r[26] = cpu->r[26] + 0x00000004u;
-        /* 0208D6C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000018u);
+        /* 0208D6C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000018u));
         /* 0208D6CC */ cpu->r[27] = cpu->r[27] + 0x00000004u;
-        /* 0208D6D0 */ _t29 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208D6D0 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208D6D0 */ _t30 = _t29 & 0x00000001u;
         /* 0208D6D0 */ if (_t30) goto L_0208D6D4; else goto L_0208D700;
   L_0208D6D4: ; // 0x208d6d4
-        /* 0208D6D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000018u);
-        /* 0208D6D8 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208D6D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000018u));
+        /* 0208D6D8 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208D6D8 */ _t32 = _t31 & 0x00000001u;
         /* 0208D6D8 */ if (_t32) goto L_0208D674; else goto L_0208D6DC;
   L_0208D6DC: ; // 0x208d6dc
@@ -14632,9 +14632,9 @@ void Gambit_fn_0208D5BC(CPUState* cpu) {
         /* 0208D6E8 */ Gambit_fn_020DB518(cpu);
         /* 0208D6EC */ cpu->r[28] = cpu->r[28] + 0x00000001u;
         /* 0208D6F0 */ cpu->r[26] = cpu->r[26] + 0x00000004u;
-        /* 0208D6F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000018u);
+        /* 0208D6F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000018u));
         /* 0208D6F8 */ cpu->r[27] = cpu->r[27] + 0x00000004u;
-        /* 0208D6FC */ _t34 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208D6FC */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208D6FC */ _t35 = _t34 & 0x00000001u;
         /* 0208D6FC */ if (_t35) goto L_0208D6D4; else goto L_0208D700;
   L_0208D700: ; // 0x208d700
@@ -14650,16 +14650,16 @@ void Gambit_fn_0208D5BC(CPUState* cpu) {
         /* 0208D718 */ cpu->r[3] = cpu->r[31];
         /* 0208D71C */ cpu->r[4] = 0x00000001u;
         /* 0208D720 */ Gambit_fn_027EDF00(cpu);
-        /* 0208D724 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208D728 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D724 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208D728 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D728 */ _t39 = _t38 & 0x00000001u;
         /* 0208D728 */ if (_t39) goto L_0208D748; else goto L_0208D72C;
   L_0208D72C: ; // 0x208d72c
         /* 0208D72C */ _t40 = cpu->r[31] + 0x00000214u;
         /* 0208D72C */ cpu->r[3] = rbrew_read32(cpu->mem, _t40);
         /* 0208D730 */ Gambit_fn_020BE9AC(cpu);
-        /* 0208D734 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208D738 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D734 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208D738 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D738 */ _t42 = _t41 & 0x00000001u;
         /* 0208D738 */ if (_t42) goto L_0208D73C; else goto L_0208D748;
   L_0208D73C: ; // 0x208d73c
@@ -14690,15 +14690,15 @@ void Gambit_fn_0208D75C(CPUState* cpu) {
         /* 0208D76C */ cpu->r[27] = cpu->r[3];
         /* 0208D770 */ _t2 = cpu->r[27] + 0x000001E4u;
         /* 0208D770 */ cpu->r[0] = rbrew_read32(cpu->mem, _t2);
-        /* 0208D774 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208D778 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D774 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208D778 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D778 */ _t4 = _t3 & 0x00000001u;
         /* 0208D778 */ if (_t4) goto L_0208D77C; else goto L_0208D790;
   L_0208D77C: ; // 0x208d77c
         /* 0208D77C */ _t5 = cpu->r[27] + 0x0000021Cu;
         /* 0208D77C */ cpu->r[0] = rbrew_read8(cpu->mem, _t5);
-        /* 0208D780 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208D784 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D780 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208D784 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D784 */ _t7 = _t6 & 0x00000001u;
         /* 0208D784 */ if (_t7) goto L_0208D788; else goto L_0208D790;
   L_0208D788: ; // 0x208d788
@@ -14711,8 +14711,8 @@ void Gambit_fn_0208D75C(CPUState* cpu) {
         /* 0208D79C */ cpu->r[24] = cpu->r[26];
         /* 0208D7A0 */ goto L_0208D7AC;
   L_0208D7A4: ; // 0x208d7a4
-        /* 0208D7A4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000018u);
-        /* 0208D7A8 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208D7A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000018u));
+        /* 0208D7A8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208D7A8 */ _t9 = _t8 & 0x00000001u;
         /* 0208D7A8 */ if (_t9) goto L_0208D7AC; else goto L_0208D7B8;
   L_0208D7AC: ; // 0x208d7ac
@@ -14730,8 +14730,8 @@ void Gambit_fn_0208D75C(CPUState* cpu) {
         /* 0208D7C4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
         /* 0208D7C8 */ cpu->ctr = cpu->r[0];
         /* 0208D7CC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208D7D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208D7D4 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D7D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208D7D4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D7D4 */ _t14 = _t13 & 0x00000001u;
         /* 0208D7D4 */ if (_t14) goto L_0208D8F8; else goto L_0208D7D8;
   L_0208D7D8: ; // 0x208d7d8
@@ -14742,8 +14742,8 @@ void Gambit_fn_0208D75C(CPUState* cpu) {
         /* 0208D7E0 */ cpu->r[4] = cpu->r[26] + 0x00000002u;
         /* 0208D7E4 */ Gambit_fn_02026910(cpu);
         /* 0208D7E8 */ cpu->r[29] = cpu->r[3];
-        /* 0208D7E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0208D7EC */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D7E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0208D7EC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D7EC */ _t18 = _t17 & 0x00000001u;
         /* 0208D7EC */ if (_t18) goto L_0208D814; else goto L_0208D7F0;
   L_0208D7F0: ; // 0x208d7f0
@@ -14762,8 +14762,8 @@ void Gambit_fn_0208D75C(CPUState* cpu) {
         /* 0208D80C */ cpu->r[4] = rbrew_read32(cpu->mem, _t23);
         /* 0208D810 */ Gambit_fn_020A8C68(cpu);
   L_0208D814: ; // 0x208d814
-        /* 0208D814 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000018u);
-        /* 0208D818 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208D814 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000018u));
+        /* 0208D818 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208D818 */ _t25 = _t24 & 0x00000001u;
         /* 0208D818 */ if (_t25) goto L_0208D81C; else goto L_0208D834;
   L_0208D81C: ; // 0x208d81c
@@ -14782,13 +14782,13 @@ void Gambit_fn_0208D75C(CPUState* cpu) {
         /* 0208D840 */ cpu->r[28] = 0x00000018u;
         /* 0208D844 */ cpu->r[29] = cpu->r[23];
   L_0208D848: ; // 0x208d848
-        /* 0208D848 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], cpu->r[23]);
-        /* 0208D84C */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D848 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], cpu->r[23]));
+        /* 0208D84C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D84C */ _t29 = _t28 & 0x00000001u;
         /* 0208D84C */ if (_t29) goto L_0208D8E8; else goto L_0208D850;
   L_0208D850: ; // 0x208d850
-        /* 0208D850 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000018u);
-        /* 0208D854 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208D850 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000018u));
+        /* 0208D854 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208D854 */ _t31 = _t30 & 0x00000001u;
         /* 0208D854 */ if (_t31) goto L_0208D858; else goto L_0208D878;
   L_0208D858: ; // 0x208d858
@@ -14800,8 +14800,8 @@ void Gambit_fn_0208D75C(CPUState* cpu) {
         /* 0208D860 */ cpu->r[8] = rbrew_read32(cpu->mem, _t34);
         /* 0208D864 */ cpu->ctr = cpu->r[8];
         /* 0208D868 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208D86C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208D870 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D86C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208D870 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D870 */ _t36 = _t35 & 0x00000001u;
         /* 0208D870 */ if (_t36) goto L_0208D8E8; else goto L_0208D874;
   L_0208D874: ; // 0x208d874
@@ -14815,13 +14815,13 @@ void Gambit_fn_0208D75C(CPUState* cpu) {
         /* 0208D880 */ cpu->r[8] = rbrew_read32(cpu->mem, _t39);
         /* 0208D884 */ cpu->ctr = cpu->r[8];
         /* 0208D888 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208D88C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208D890 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D88C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208D890 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D890 */ _t41 = _t40 & 0x00000001u;
         /* 0208D890 */ if (_t41) goto L_0208D8E8; else goto L_0208D894;
   L_0208D894: ; // 0x208d894
-        /* 0208D894 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000018u);
-        /* 0208D898 */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208D894 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000018u));
+        /* 0208D898 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208D898 */ _t43 = _t42 & 0x00000001u;
         /* 0208D898 */ if (_t43) goto L_0208D89C; else goto L_0208D8C4;
   L_0208D89C: ; // 0x208d89c
@@ -14833,8 +14833,8 @@ void Gambit_fn_0208D75C(CPUState* cpu) {
         /* 0208D8A4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t46);
         /* 0208D8A8 */ cpu->ctr = cpu->r[0];
         /* 0208D8AC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208D8B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000018u);
-        /* 0208D8B4 */ _t47 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208D8B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000018u));
+        /* 0208D8B4 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208D8B4 */ _t48 = _t47 & 0x00000001u;
         /* 0208D8B4 */ if (_t48) goto L_0208D8E0; else goto L_0208D8B8;
   L_0208D8B8: ; // 0x208d8b8
@@ -14851,8 +14851,8 @@ void Gambit_fn_0208D75C(CPUState* cpu) {
         /* 0208D8CC */ cpu->r[0] = rbrew_read32(cpu->mem, _t52);
         /* 0208D8D0 */ cpu->ctr = cpu->r[0];
         /* 0208D8D4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208D8D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000018u);
-        /* 0208D8DC */ _t53 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208D8D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000018u));
+        /* 0208D8DC */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208D8DC */ _t54 = _t53 & 0x00000001u;
         /* 0208D8DC */ if (_t54) goto L_0208D8E0; else goto L_0208D8B8;
   L_0208D8E0: ; // 0x208d8e0
@@ -14861,18 +14861,18 @@ void Gambit_fn_0208D75C(CPUState* cpu) {
         /* 0208D8E4 */ Gambit_fn_020DB518(cpu);
   L_0208D8E8: ; // 0x208d8e8
         /* 0208D8E8 */ cpu->r[28] = cpu->r[28] + 0xFFFFFFFFu;
-        /* 0208D8E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 0208D8E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 0208D8EC */ cpu->r[23] = cpu->r[23] + 0x00000001u;
         /* 0208D8F0 */ cpu->r[29] = cpu->r[29] + 0x00000004u;
-        /* 0208D8F4 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D8F4 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D8F4 */ _t57 = _t56 & 0x00000001u;
         /* 0208D8F4 */ if (_t57) goto L_0208D8F8; else goto L_0208D848;
   L_0208D8F8: ; // 0x208d8f8
         /* 0208D8F8 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0208D8FC */ cpu->r[30] = cpu->r[30] + 0x00000004u;
-        /* 0208D900 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000018u);
+        /* 0208D900 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000018u));
         /* 0208D904 */ cpu->r[24] = cpu->r[24] + 0x00000004u;
-        /* 0208D908 */ _t58 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208D908 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208D908 */ _t59 = _t58 & 0x00000001u;
         /* 0208D908 */ if (_t59) goto L_0208D7A4; else goto L_0208D90C;
   L_0208D90C: ; // 0x208d90c
@@ -14884,8 +14884,8 @@ void Gambit_fn_0208D75C(CPUState* cpu) {
         /* 0208D914 */ cpu->r[0] = rbrew_read32(cpu->mem, _t62);
         /* 0208D918 */ cpu->ctr = cpu->r[0];
         /* 0208D91C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208D920 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208D924 */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D920 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208D924 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D924 */ _t64 = _t63 & 0x00000001u;
         /* 0208D924 */ if (_t64) goto L_0208D93C; else goto L_0208D928;
   L_0208D928: ; // 0x208d928
@@ -14918,8 +14918,8 @@ void Gambit_fn_0208D954(CPUState* cpu) {
         /* 0208D960 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0208D964 */ _t3 = cpu->r[31] + 0x000001E4u;
         /* 0208D964 */ cpu->r[10] = rbrew_read32(cpu->mem, _t3);
-        /* 0208D968 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0208D96C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D968 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0208D96C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D96C */ _t5 = _t4 & 0x00000001u;
         /* 0208D96C */ if (_t5) goto L_0208D970; else goto L_0208D9B8;
   L_0208D970: ; // 0x208d970
@@ -14950,16 +14950,16 @@ void Gambit_fn_0208D954(CPUState* cpu) {
         /* 0208D9B8 */ cpu->r[3] = cpu->r[31];
         /* 0208D9BC */ cpu->r[4] = 0x00000001u;
         /* 0208D9C0 */ Gambit_fn_027EDF00(cpu);
-        /* 0208D9C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208D9C8 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D9C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208D9C8 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D9C8 */ _t12 = _t11 & 0x00000001u;
         /* 0208D9C8 */ if (_t12) goto L_0208D9E8; else goto L_0208D9CC;
   L_0208D9CC: ; // 0x208d9cc
         /* 0208D9CC */ _t13 = cpu->r[31] + 0x00000214u;
         /* 0208D9CC */ cpu->r[3] = rbrew_read32(cpu->mem, _t13);
         /* 0208D9D0 */ Gambit_fn_020BE9AC(cpu);
-        /* 0208D9D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208D9D8 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208D9D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208D9D8 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208D9D8 */ _t15 = _t14 & 0x00000001u;
         /* 0208D9D8 */ if (_t15) goto L_0208D9DC; else goto L_0208D9E8;
   L_0208D9DC: ; // 0x208d9dc
@@ -14991,8 +14991,8 @@ void Gambit_fn_0208DA00(CPUState* cpu) {
         /* 0208DA0C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0208DA10 */ _t3 = cpu->r[31] + 0x000001E4u;
         /* 0208DA10 */ cpu->r[9] = rbrew_read32(cpu->mem, _t3);
-        /* 0208DA14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0208DA18 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DA14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0208DA18 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DA18 */ _t5 = _t4 & 0x00000001u;
         /* 0208DA18 */ if (_t5) goto L_0208DA1C; else goto L_0208DA4C;
   L_0208DA1C: ; // 0x208da1c
@@ -15015,8 +15015,8 @@ void Gambit_fn_0208DA00(CPUState* cpu) {
         /* 0208DA4C */ cpu->r[3] = cpu->r[31];
         /* 0208DA50 */ cpu->r[4] = 0x00000000u;
         /* 0208DA54 */ Gambit_fn_027EDF00(cpu);
-        /* 0208DA58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208DA5C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DA58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208DA5C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DA5C */ _t10 = _t9 & 0x00000001u;
         /* 0208DA5C */ if (_t10) goto L_0208DA74; else goto L_0208DA60;
   L_0208DA60: ; // 0x208da60
@@ -15149,15 +15149,15 @@ void Gambit_fn_0208DAF4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0208DAF4: ; // 0x208daf4
-        /* 0208DAF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208DAF8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DAF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208DAF8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DAF8 */ _t1 = _t0 & 0x00000001u;
         /* 0208DAF8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208DAF8 */ goto L_0208DAFC;
   L_0208DAFC: ; // 0x208dafc
         /* 0208DAFC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0208DAFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208DB00 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DAFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208DB00 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DB00 */ _t3 = _t2 & 0x00000001u;
         /* 0208DB00 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208DB00 */ goto L_0208DB04;
@@ -15176,8 +15176,8 @@ void Gambit_fn_0208DAF4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -15191,15 +15191,15 @@ void Gambit_fn_0208DAF4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -15236,11 +15236,11 @@ void Gambit_fn_0208DB08(CPUState* cpu) {
         /* 0208DB14 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0208DB14 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0208DB18 */ cpu->r[30] = cpu->r[3];
-        /* 0208DB18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0208DB18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0208DB1C */ cpu->r[31] = cpu->r[4];
         /* 0208DB20 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0208DB20 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0208DB24 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DB24 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DB24 */ _t5 = _t4 & 0x00000001u;
         /* 0208DB24 */ if (_t5) goto L_0208DB68; else goto L_0208DB28;
   L_0208DB28: ; // 0x208db28
@@ -15260,8 +15260,8 @@ void Gambit_fn_0208DB08(CPUState* cpu) {
         /* 0208DB50 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 0208DB54 */ Gambit_fn_02068798(cpu);
         /* 0208DB58 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0208DB58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208DB5C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DB58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208DB5C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DB5C */ _t10 = _t9 & 0x00000001u;
         /* 0208DB5C */ if (_t10) goto L_0208DB68; else goto L_0208DB60;
   L_0208DB60: ; // 0x208db60
@@ -15292,11 +15292,11 @@ void Gambit_fn_0208DB0C(CPUState* cpu) {
         /* 0208DB14 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0208DB14 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0208DB18 */ cpu->r[30] = cpu->r[3];
-        /* 0208DB18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0208DB18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0208DB1C */ cpu->r[31] = cpu->r[4];
         /* 0208DB20 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0208DB20 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0208DB24 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DB24 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DB24 */ _t5 = _t4 & 0x00000001u;
         /* 0208DB24 */ if (_t5) goto L_0208DB68; else goto L_0208DB28;
   L_0208DB28: ; // 0x208db28
@@ -15316,8 +15316,8 @@ void Gambit_fn_0208DB0C(CPUState* cpu) {
         /* 0208DB50 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 0208DB54 */ Gambit_fn_02068798(cpu);
         /* 0208DB58 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0208DB58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208DB5C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DB58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208DB5C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DB5C */ _t10 = _t9 & 0x00000001u;
         /* 0208DB5C */ if (_t10) goto L_0208DB68; else goto L_0208DB60;
   L_0208DB60: ; // 0x208db60
@@ -15372,15 +15372,15 @@ void Gambit_fn_0208DB98(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0208DB98: ; // 0x208db98
-        /* 0208DB98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208DB9C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DB98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208DB9C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DB9C */ _t1 = _t0 & 0x00000001u;
         /* 0208DB9C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208DB9C */ goto L_0208DBA0;
   L_0208DBA0: ; // 0x208dba0
         /* 0208DBA0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0208DBA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208DBA4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DBA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208DBA4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DBA4 */ _t3 = _t2 & 0x00000001u;
         /* 0208DBA4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208DBA4 */ goto L_0208DBA8;
@@ -15399,8 +15399,8 @@ void Gambit_fn_0208DB98(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -15414,15 +15414,15 @@ void Gambit_fn_0208DB98(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -15468,15 +15468,15 @@ void Gambit_fn_0208DBC8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0208DBC8: ; // 0x208dbc8
-        /* 0208DBC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208DBCC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DBC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208DBCC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DBCC */ _t1 = _t0 & 0x00000001u;
         /* 0208DBCC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208DBCC */ goto L_0208DBD0;
   L_0208DBD0: ; // 0x208dbd0
         /* 0208DBD0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0208DBD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208DBD4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DBD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208DBD4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DBD4 */ _t3 = _t2 & 0x00000001u;
         /* 0208DBD4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208DBD4 */ goto L_0208DBD8;
@@ -15495,8 +15495,8 @@ void Gambit_fn_0208DBC8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -15510,15 +15510,15 @@ void Gambit_fn_0208DBC8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -15546,15 +15546,15 @@ void Gambit_fn_0208DBDC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0208DBDC: ; // 0x208dbdc
-        /* 0208DBDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208DBE0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DBDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208DBE0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DBE0 */ _t1 = _t0 & 0x00000001u;
         /* 0208DBE0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208DBE0 */ goto L_0208DBE4;
   L_0208DBE4: ; // 0x208dbe4
         /* 0208DBE4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0208DBE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208DBE8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DBE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208DBE8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DBE8 */ _t3 = _t2 & 0x00000001u;
         /* 0208DBE8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208DBE8 */ goto L_0208DBEC;
@@ -15573,8 +15573,8 @@ void Gambit_fn_0208DBDC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -15588,15 +15588,15 @@ void Gambit_fn_0208DBDC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -15624,15 +15624,15 @@ void Gambit_fn_0208DBF0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0208DBF0: ; // 0x208dbf0
-        /* 0208DBF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208DBF4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DBF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208DBF4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DBF4 */ _t1 = _t0 & 0x00000001u;
         /* 0208DBF4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208DBF4 */ goto L_0208DBF8;
   L_0208DBF8: ; // 0x208dbf8
         /* 0208DBF8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0208DBF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208DBFC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DBF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208DBFC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DBFC */ _t3 = _t2 & 0x00000001u;
         /* 0208DBFC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208DBFC */ goto L_0208DC00;
@@ -15651,8 +15651,8 @@ void Gambit_fn_0208DBF0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -15666,15 +15666,15 @@ void Gambit_fn_0208DBF0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -15702,15 +15702,15 @@ void Gambit_fn_0208DC04(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0208DC04: ; // 0x208dc04
-        /* 0208DC04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208DC08 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DC04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208DC08 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DC08 */ _t1 = _t0 & 0x00000001u;
         /* 0208DC08 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208DC08 */ goto L_0208DC0C;
   L_0208DC0C: ; // 0x208dc0c
         /* 0208DC0C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0208DC0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208DC10 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DC0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208DC10 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DC10 */ _t3 = _t2 & 0x00000001u;
         /* 0208DC10 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208DC10 */ goto L_0208DC14;
@@ -15729,8 +15729,8 @@ void Gambit_fn_0208DC04(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -15744,15 +15744,15 @@ void Gambit_fn_0208DC04(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -15858,9 +15858,9 @@ void Gambit_fn_0208DC58(CPUState* cpu) {
         /* 0208DC5C */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 0208DC5C */ cpu->r[9] = _t0;
         /* 0208DC60 */ cpu->r[12] = 0x101D0000u;
-        /* 0208DC64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0208DC64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0208DC68 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 0208DC6C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DC6C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DC6C */ _t2 = _t1 & 0x00000001u;
         /* 0208DC6C */ if (_t2) goto L_0208DC70; else goto L_0208DC84;
   L_0208DC70: ; // 0x208dc70
@@ -15872,8 +15872,8 @@ void Gambit_fn_0208DC58(CPUState* cpu) {
         /* 0208DC80 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 0208DC80 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_0208DC84: ; // 0x208dc84
-        /* 0208DC84 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0208DC88 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DC84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0208DC88 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DC88 */ _t6 = _t5 & 0x00000001u;
         /* 0208DC88 */ if (_t6) goto L_0208DC8C; else goto L_0208DC94;
   L_0208DC8C: ; // 0x208dc8c
@@ -15885,9 +15885,9 @@ void Gambit_fn_0208DC58(CPUState* cpu) {
         /* 0208DC98 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 0208DC98 */ cpu->r[7] = _t7;
         /* 0208DC9C */ cpu->r[11] = 0x101D0000u;
-        /* 0208DCA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0208DCA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0208DCA4 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 0208DCA8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DCA8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DCA8 */ _t9 = _t8 & 0x00000001u;
         /* 0208DCA8 */ if (_t9) goto L_0208DCAC; else goto L_0208DCC0;
   L_0208DCAC: ; // 0x208dcac
@@ -16019,18 +16019,18 @@ void Gambit_fn_0208DD28(CPUState* cpu) {
         /* 0208E294 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0208E294 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0208E298 */ cpu->r[12] = 0x00000000u;
-        /* 0208E29C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208E29C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208E2A0 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0208E2A0 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0208E2A4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E2A4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E2A4 */ _t6 = _t5 & 0x00000001u;
         /* 0208E2A4 */ if (_t6) goto L_0208E2CC; else goto L_0208E2A8;
   L_0208E2A8: ; // 0x208e2a8
         /* 0208E2A8 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0208E2A8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0208E2AC */ /* nop */
-        /* 0208E2B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0208E2B4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E2B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0208E2B4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E2B4 */ _t9 = _t8 & 0x00000001u;
         /* 0208E2B4 */ if (_t9) goto L_0208E2B8; else goto L_0208E2CC;
   L_0208E2B8: ; // 0x208e2b8
@@ -16075,10 +16075,10 @@ void Gambit_fn_0208DD38(CPUState* cpu) {
         /* 0208DD58 */ cpu->r[31] = 0x101D0000u;
         /* 0208DD5C */ _t3 = cpu->r[28] + 0x0000001Cu;
         /* 0208DD5C */ rbrew_write32(cpu->mem, _t3, cpu->r[4]);
-        /* 0208DD60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0208DD60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0208DD64 */ _t4 = cpu->r[28] + 0x0000000Fu;
         /* 0208DD64 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[27]);
-        /* 0208DD68 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DD68 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DD68 */ _t6 = _t5 & 0x00000001u;
         /* 0208DD68 */ if (_t6) goto L_0208DDAC; else goto L_0208DD6C;
   L_0208DD6C: ; // 0x208dd6c
@@ -16093,16 +16093,16 @@ void Gambit_fn_0208DD38(CPUState* cpu) {
         /* 0208DD80 */ cpu->r[5] = 0x00000004u;
         /* 0208DD84 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 0208DD88 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208DD8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0208DD8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0208DD90 */ cpu->r[0] = cpu->r[27];
-        /* 0208DD94 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208DD94 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208DD94 */ _t11 = _t10 & 0x00000001u;
         /* 0208DD94 */ if (_t11) goto L_0208DD9C; else goto L_0208DD98;
   L_0208DD98: ; // 0x208dd98
         /* 0208DD98 */ cpu->r[0] = 0x00000001u;
   L_0208DD9C: ; // 0x208dd9c
-        /* 0208DD9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208DDA0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DD9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208DDA0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DDA0 */ _t13 = _t12 & 0x00000001u;
         /* 0208DDA0 */ if (_t13) goto L_0208DDAC; else goto L_0208DDA4;
   L_0208DDA4: ; // 0x208dda4
@@ -16114,9 +16114,9 @@ void Gambit_fn_0208DD38(CPUState* cpu) {
         /* 0208DDAC */ _t16 = cpu->r[28] + 0x00000020u;
         /* 0208DDAC */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 0208DDB0 */ cpu->r[0] = 0x00000000u;
-        /* 0208DDB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0208DDB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0208DDB8 */ cpu->r[12] = cpu->r[0];
-        /* 0208DDBC */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208DDBC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208DDBC */ _t18 = _t17 & 0x00000001u;
         /* 0208DDBC */ if (_t18) goto L_0208DDC0; else goto L_0208DDE4;
   L_0208DDC0: ; // 0x208ddc0
@@ -16141,8 +16141,8 @@ void Gambit_fn_0208DD38(CPUState* cpu) {
   L_0208DDE4: ; // 0x208dde4
         /* 0208DDE4 */ _t26 = cpu->r[28] + 0x0000000Fu;
         /* 0208DDE4 */ cpu->r[27] = rbrew_read8(cpu->mem, _t26);
-        /* 0208DDE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0208DDEC */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DDE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0208DDEC */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DDEC */ _t28 = _t27 & 0x00000001u;
         /* 0208DDEC */ if (_t28) goto L_0208DE30; else goto L_0208DDF0;
   L_0208DDF0: ; // 0x208ddf0
@@ -16157,16 +16157,16 @@ void Gambit_fn_0208DD38(CPUState* cpu) {
         /* 0208DE04 */ cpu->r[5] = 0x00000004u;
         /* 0208DE08 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 0208DE0C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208DE10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0208DE10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0208DE14 */ cpu->r[11] = cpu->r[27];
-        /* 0208DE18 */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208DE18 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208DE18 */ _t33 = _t32 & 0x00000001u;
         /* 0208DE18 */ if (_t33) goto L_0208DE20; else goto L_0208DE1C;
   L_0208DE1C: ; // 0x208de1c
         /* 0208DE1C */ cpu->r[11] = 0x00000001u;
   L_0208DE20: ; // 0x208de20
-        /* 0208DE20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208DE24 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DE20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208DE24 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DE24 */ _t35 = _t34 & 0x00000001u;
         /* 0208DE24 */ if (_t35) goto L_0208DE30; else goto L_0208DE28;
   L_0208DE28: ; // 0x208de28
@@ -16178,9 +16178,9 @@ void Gambit_fn_0208DD38(CPUState* cpu) {
         /* 0208DE30 */ _t38 = cpu->r[28] + 0x00000028u;
         /* 0208DE30 */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 0208DE34 */ cpu->r[0] = 0x00000000u;
-        /* 0208DE38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 0208DE38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 0208DE3C */ cpu->r[12] = cpu->r[0];
-        /* 0208DE40 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208DE40 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208DE40 */ _t40 = _t39 & 0x00000001u;
         /* 0208DE40 */ if (_t40) goto L_0208DE44; else goto L_0208DE68;
   L_0208DE44: ; // 0x208de44
@@ -16205,8 +16205,8 @@ void Gambit_fn_0208DD38(CPUState* cpu) {
   L_0208DE68: ; // 0x208de68
         /* 0208DE68 */ _t48 = cpu->r[28] + 0x0000000Fu;
         /* 0208DE68 */ cpu->r[27] = rbrew_read8(cpu->mem, _t48);
-        /* 0208DE6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0208DE70 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DE6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0208DE70 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DE70 */ _t50 = _t49 & 0x00000001u;
         /* 0208DE70 */ if (_t50) goto L_0208DEB4; else goto L_0208DE74;
   L_0208DE74: ; // 0x208de74
@@ -16221,16 +16221,16 @@ void Gambit_fn_0208DD38(CPUState* cpu) {
         /* 0208DE88 */ cpu->r[5] = 0x00000004u;
         /* 0208DE8C */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 0208DE90 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208DE94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0208DE94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0208DE98 */ cpu->r[10] = cpu->r[27];
-        /* 0208DE9C */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208DE9C */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208DE9C */ _t55 = _t54 & 0x00000001u;
         /* 0208DE9C */ if (_t55) goto L_0208DEA4; else goto L_0208DEA0;
   L_0208DEA0: ; // 0x208dea0
         /* 0208DEA0 */ cpu->r[10] = 0x00000001u;
   L_0208DEA4: ; // 0x208dea4
-        /* 0208DEA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208DEA8 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DEA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208DEA8 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DEA8 */ _t57 = _t56 & 0x00000001u;
         /* 0208DEA8 */ if (_t57) goto L_0208DEB4; else goto L_0208DEAC;
   L_0208DEAC: ; // 0x208deac
@@ -16242,9 +16242,9 @@ void Gambit_fn_0208DD38(CPUState* cpu) {
         /* 0208DEB4 */ _t60 = cpu->r[28] + 0x00000030u;
         /* 0208DEB4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
         /* 0208DEB8 */ cpu->r[0] = 0x00000000u;
-        /* 0208DEBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0208DEBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0208DEC0 */ cpu->r[5] = cpu->r[0];
-        /* 0208DEC4 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208DEC4 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208DEC4 */ _t62 = _t61 & 0x00000001u;
         /* 0208DEC4 */ if (_t62) goto L_0208DEC8; else goto L_0208DEEC;
   L_0208DEC8: ; // 0x208dec8
@@ -16269,8 +16269,8 @@ void Gambit_fn_0208DD38(CPUState* cpu) {
   L_0208DEEC: ; // 0x208deec
         /* 0208DEEC */ _t70 = cpu->r[30] + 0x00000000u;
         /* 0208DEEC */ cpu->r[25] = rbrew_read8(cpu->mem, _t70);
-        /* 0208DEF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 0208DEF4 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DEF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 0208DEF4 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DEF4 */ _t72 = _t71 & 0x00000001u;
         /* 0208DEF4 */ if (_t72) goto L_0208DFD0; else goto L_0208DEF8;
   L_0208DEF8: ; // 0x208def8
@@ -16286,10 +16286,10 @@ void Gambit_fn_0208DD38(CPUState* cpu) {
         /* 0208DF10 */ cpu->r[4] = (uint32_t)((int32_t)cpu->r[25] * (int32_t)0x00000024u);
         /* 0208DF14 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208DF18 */ cpu->r[24] = cpu->r[3];
-        /* 0208DF1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 0208DF1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 0208DF20 */ cpu->r[30] = cpu->r[25];
         /* 0208DF24 */ cpu->r[7] = 0x00000000u;
-        /* 0208DF28 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208DF28 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208DF28 */ _t77 = _t76 & 0x00000001u;
         /* 0208DF28 */ if (_t77) goto L_0208DF30; else goto L_0208DF2C;
   L_0208DF2C: ; // 0x208df2c
@@ -16302,36 +16302,36 @@ void Gambit_fn_0208DD38(CPUState* cpu) {
         /* 0208DF3C */ cpu->r[23] = 0x00000018u;
   L_0208DF40: ; // 0x208df40
         /* 0208DF40 */ cpu->r[27] = cpu->r[24] + cpu->r[22];
-        /* 0208DF40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0208DF44 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DF40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0208DF44 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DF44 */ _t80 = _t79 & 0x00000001u;
         /* 0208DF44 */ if (_t80) goto L_0208DFB4; else goto L_0208DF48;
   L_0208DF48: ; // 0x208df48
         /* 0208DF48 */ cpu->r[26] = cpu->r[27];
-        /* 0208DF48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0208DF4C */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DF48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0208DF4C */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DF4C */ _t82 = _t81 & 0x00000001u;
         /* 0208DF4C */ if (_t82) goto L_0208DF50; else goto L_0208DF60;
   L_0208DF50: ; // 0x208df50
         /* 0208DF50 */ cpu->r[3] = 0x00000024u;
         /* 0208DF54 */ Gambit_fn_02801A78(cpu);
         /* 0208DF58 */ cpu->r[26] = cpu->r[3];
-        /* 0208DF58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0208DF5C */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DF58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0208DF5C */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DF5C */ _t84 = _t83 & 0x00000001u;
         /* 0208DF5C */ if (_t84) goto L_0208DFA8; else goto L_0208DF60;
   L_0208DF60: ; // 0x208df60
         /* 0208DF60 */ cpu->r[11] = cpu->r[26];
-        /* 0208DF60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0208DF64 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DF60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0208DF64 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DF64 */ _t86 = _t85 & 0x00000001u;
         /* 0208DF64 */ if (_t86) goto L_0208DF68; else goto L_0208DF78;
   L_0208DF68: ; // 0x208df68
         /* 0208DF68 */ cpu->r[3] = 0x0000000Cu;
         /* 0208DF6C */ Gambit_fn_02801A78(cpu);
         /* 0208DF70 */ cpu->r[11] = cpu->r[3];
-        /* 0208DF70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0208DF74 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DF70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0208DF74 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DF74 */ _t88 = _t87 & 0x00000001u;
         /* 0208DF74 */ if (_t88) goto L_0208DF94; else goto L_0208DF78;
   L_0208DF78: ; // 0x208df78
@@ -16362,14 +16362,14 @@ void Gambit_fn_0208DD38(CPUState* cpu) {
         /* 0208DFB0 */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
   L_0208DFB4: ; // 0x208dfb4
         /* 0208DFB4 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 0208DFB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0208DFB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0208DFB8 */ cpu->r[22] = cpu->r[22] + 0x00000024u;
-        /* 0208DFBC */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DFBC */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DFBC */ _t98 = _t97 & 0x00000001u;
         /* 0208DFBC */ if (_t98) goto L_0208DFC0; else goto L_0208DF40;
   L_0208DFC0: ; // 0x208dfc0
-        /* 0208DFC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 0208DFC4 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208DFC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 0208DFC4 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208DFC4 */ _t100 = _t99 & 0x00000001u;
         /* 0208DFC4 */ if (_t100) goto L_0208DFD0; else goto L_0208DFC8;
   L_0208DFC8: ; // 0x208dfc8
@@ -16399,10 +16399,10 @@ void Gambit_fn_0208DFE8(CPUState* cpu) {
         /* 0208DFEC */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 0208DFF0 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 0208DFF0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 0208DFF4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[12]);
+        /* 0208DFF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[12]));
         /* 0208DFF8 */ _t3 = cpu->r[4] + 0x00000000u;
         /* 0208DFF8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 0208DFFC */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208DFFC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208DFFC */ _t5 = _t4 & 0x00000001u;
         /* 0208DFFC */ if (_t5) goto L_0208E000; else goto L_0208E008;
   L_0208E000: ; // 0x208e000
@@ -16419,10 +16419,10 @@ void Gambit_fn_0208DFE8(CPUState* cpu) {
         /* 0208E014 */ cpu->r[9] = rbrew_read8(cpu->mem, _t9);
         /* 0208E018 */ _t10 = cpu->r[3] + 0x00000028u;
         /* 0208E018 */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 0208E01C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
+        /* 0208E01C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
         /* 0208E020 */ _t11 = cpu->r[3] + 0x0000002Cu;
         /* 0208E020 */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
-        /* 0208E024 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208E024 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208E024 */ _t13 = _t12 & 0x00000001u;
         /* 0208E024 */ if (_t13) goto L_0208E028; else goto L_0208E030;
   L_0208E028: ; // 0x208e028
@@ -16443,10 +16443,10 @@ void Gambit_fn_0208DFE8(CPUState* cpu) {
         /* 0208E044 */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
         /* 0208E048 */ _t20 = cpu->r[3] + 0x00000034u;
         /* 0208E048 */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 0208E04C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
+        /* 0208E04C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
         /* 0208E050 */ _t21 = cpu->r[6] + 0x00000000u;
         /* 0208E050 */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
-        /* 0208E054 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208E054 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208E054 */ _t23 = _t22 & 0x00000001u;
         /* 0208E054 */ if (_t23) goto L_0208E058; else goto L_0208E060;
   L_0208E058: ; // 0x208e058
@@ -16473,10 +16473,10 @@ void Gambit_fn_0208E070(CPUState* cpu) {
         /* 0208E078 */ _t1 = cpu->r[3] + 0x00000020u;
         /* 0208E078 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 0208E07C */ cpu->r[8] = cpu->r[0];
-        /* 0208E080 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 0208E080 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 0208E084 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 0208E084 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0208E088 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208E088 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208E088 */ _t4 = _t3 & 0x00000001u;
         /* 0208E088 */ if (_t4) goto L_0208E08C; else goto L_0208E0A4;
   L_0208E08C: ; // 0x208e08c
@@ -16484,8 +16484,8 @@ void Gambit_fn_0208E070(CPUState* cpu) {
         /* 0208E090 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 0208E094 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0208E094 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0208E098 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0208E09C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E098 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0208E09C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E09C */ _t7 = _t6 & 0x00000001u;
         /* 0208E09C */ if (_t7) goto L_0208E0A0; else goto L_0208E0B0;
   L_0208E0A0: ; // 0x208e0a0
@@ -16493,16 +16493,16 @@ void Gambit_fn_0208E070(CPUState* cpu) {
   L_0208E0A4: ; // 0x208e0a4
         /* 0208E0A4 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0208E0A4 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0208E0A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0208E0AC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E0A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0208E0AC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E0AC */ _t10 = _t9 & 0x00000001u;
         /* 0208E0AC */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208E0AC */ goto L_0208E0B0;
   L_0208E0B0: ; // 0x208e0b0
-        /* 0208E0B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 0208E0B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 0208E0B4 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0208E0B4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 0208E0B8 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208E0B8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208E0B8 */ _t13 = _t12 & 0x00000001u;
         /* 0208E0B8 */ if (_t13) goto L_0208E0BC; else goto L_0208E0C4;
   L_0208E0BC: ; // 0x208e0bc
@@ -16513,11 +16513,11 @@ void Gambit_fn_0208E070(CPUState* cpu) {
         /* 0208E0C4 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0208E0C8 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0208E0C8 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0208E0CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208E0CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208E0D0 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0208E0D0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0208E0D4 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 0208E0D8 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208E0D8 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208E0D8 */ _t18 = _t17 & 0x00000001u;
         /* 0208E0D8 */ if (_t18) goto L_0208E0F0; else goto L_0208E0DC;
   L_0208E0DC: ; // 0x208e0dc
@@ -16544,10 +16544,10 @@ void Gambit_fn_0208E0F8(CPUState* cpu) {
         /* 0208E100 */ _t1 = cpu->r[3] + 0x00000030u;
         /* 0208E100 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 0208E104 */ cpu->r[7] = cpu->r[0];
-        /* 0208E108 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 0208E108 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 0208E10C */ _t2 = cpu->r[3] + 0x00000034u;
         /* 0208E10C */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0208E110 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208E110 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208E110 */ _t4 = _t3 & 0x00000001u;
         /* 0208E110 */ if (_t4) goto L_0208E114; else goto L_0208E12C;
   L_0208E114: ; // 0x208e114
@@ -16555,8 +16555,8 @@ void Gambit_fn_0208E0F8(CPUState* cpu) {
         /* 0208E118 */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 0208E11C */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0208E11C */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0208E120 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0208E124 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E120 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0208E124 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E124 */ _t7 = _t6 & 0x00000001u;
         /* 0208E124 */ if (_t7) goto L_0208E128; else goto L_0208E138;
   L_0208E128: ; // 0x208e128
@@ -16564,16 +16564,16 @@ void Gambit_fn_0208E0F8(CPUState* cpu) {
   L_0208E12C: ; // 0x208e12c
         /* 0208E12C */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0208E12C */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0208E130 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0208E134 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E130 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0208E134 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E134 */ _t10 = _t9 & 0x00000001u;
         /* 0208E134 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208E134 */ goto L_0208E138;
   L_0208E138: ; // 0x208e138
-        /* 0208E138 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 0208E138 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 0208E13C */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0208E13C */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 0208E140 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208E140 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208E140 */ _t13 = _t12 & 0x00000001u;
         /* 0208E140 */ if (_t13) goto L_0208E144; else goto L_0208E14C;
   L_0208E144: ; // 0x208e144
@@ -16584,11 +16584,11 @@ void Gambit_fn_0208E0F8(CPUState* cpu) {
         /* 0208E14C */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0208E150 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0208E150 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0208E154 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0208E154 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0208E158 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0208E158 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0208E15C */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 0208E160 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208E160 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208E160 */ _t18 = _t17 & 0x00000001u;
         /* 0208E160 */ if (_t18) goto L_0208E178; else goto L_0208E164;
   L_0208E164: ; // 0x208e164
@@ -16623,9 +16623,9 @@ void Gambit_fn_0208E180(CPUState* cpu) {
         /* 0208E198 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 0208E198 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 0208E19C */ /* nop */
-        /* 0208E1A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 0208E1A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 0208E1A4 */ cpu->r[31] = cpu->r[4];
-        /* 0208E1A8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E1A8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E1A8 */ _t6 = _t5 & 0x00000001u;
         /* 0208E1A8 */ if (_t6) goto L_0208E1AC; else goto L_0208E1C0;
   L_0208E1AC: ; // 0x208e1ac
@@ -16674,9 +16674,9 @@ void Gambit_fn_0208E184(CPUState* cpu) {
         /* 0208E198 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 0208E198 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 0208E19C */ /* nop */
-        /* 0208E1A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 0208E1A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 0208E1A4 */ cpu->r[31] = cpu->r[4];
-        /* 0208E1A8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E1A8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E1A8 */ _t6 = _t5 & 0x00000001u;
         /* 0208E1A8 */ if (_t6) goto L_0208E1AC; else goto L_0208E1C0;
   L_0208E1AC: ; // 0x208e1ac
@@ -16718,10 +16718,10 @@ void Gambit_fn_0208E1F8(CPUState* cpu) {
         /* 0208E200 */ _t1 = cpu->r[3] + 0x00000028u;
         /* 0208E200 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 0208E204 */ cpu->r[8] = cpu->r[0];
-        /* 0208E208 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 0208E208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 0208E20C */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 0208E20C */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0208E210 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208E210 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208E210 */ _t4 = _t3 & 0x00000001u;
         /* 0208E210 */ if (_t4) goto L_0208E214; else goto L_0208E22C;
   L_0208E214: ; // 0x208e214
@@ -16729,8 +16729,8 @@ void Gambit_fn_0208E1F8(CPUState* cpu) {
         /* 0208E218 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 0208E21C */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0208E21C */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0208E220 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0208E224 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E220 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0208E224 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E224 */ _t7 = _t6 & 0x00000001u;
         /* 0208E224 */ if (_t7) goto L_0208E228; else goto L_0208E238;
   L_0208E228: ; // 0x208e228
@@ -16738,16 +16738,16 @@ void Gambit_fn_0208E1F8(CPUState* cpu) {
   L_0208E22C: ; // 0x208e22c
         /* 0208E22C */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0208E22C */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0208E230 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0208E234 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E230 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0208E234 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E234 */ _t10 = _t9 & 0x00000001u;
         /* 0208E234 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208E234 */ goto L_0208E238;
   L_0208E238: ; // 0x208e238
-        /* 0208E238 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 0208E238 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 0208E23C */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0208E23C */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 0208E240 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208E240 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208E240 */ _t13 = _t12 & 0x00000001u;
         /* 0208E240 */ if (_t13) goto L_0208E244; else goto L_0208E24C;
   L_0208E244: ; // 0x208e244
@@ -16758,11 +16758,11 @@ void Gambit_fn_0208E1F8(CPUState* cpu) {
         /* 0208E24C */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0208E250 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0208E250 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0208E254 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208E254 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208E258 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0208E258 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0208E25C */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 0208E260 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208E260 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208E260 */ _t18 = _t17 & 0x00000001u;
         /* 0208E260 */ if (_t18) goto L_0208E278; else goto L_0208E264;
   L_0208E264: ; // 0x208e264
@@ -16795,18 +16795,18 @@ void Gambit_fn_0208E280(CPUState* cpu) {
         /* 0208E294 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0208E294 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0208E298 */ cpu->r[12] = 0x00000000u;
-        /* 0208E29C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208E29C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208E2A0 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0208E2A0 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0208E2A4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E2A4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E2A4 */ _t6 = _t5 & 0x00000001u;
         /* 0208E2A4 */ if (_t6) goto L_0208E2CC; else goto L_0208E2A8;
   L_0208E2A8: ; // 0x208e2a8
         /* 0208E2A8 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0208E2A8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0208E2AC */ /* nop */
-        /* 0208E2B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0208E2B4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E2B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0208E2B4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E2B4 */ _t9 = _t8 & 0x00000001u;
         /* 0208E2B4 */ if (_t9) goto L_0208E2B8; else goto L_0208E2CC;
   L_0208E2B8: ; // 0x208e2b8
@@ -16847,18 +16847,18 @@ void Gambit_fn_0208E284(CPUState* cpu) {
         /* 0208E294 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0208E294 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0208E298 */ cpu->r[12] = 0x00000000u;
-        /* 0208E29C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208E29C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208E2A0 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0208E2A0 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0208E2A4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E2A4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E2A4 */ _t6 = _t5 & 0x00000001u;
         /* 0208E2A4 */ if (_t6) goto L_0208E2CC; else goto L_0208E2A8;
   L_0208E2A8: ; // 0x208e2a8
         /* 0208E2A8 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0208E2A8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0208E2AC */ /* nop */
-        /* 0208E2B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0208E2B4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E2B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0208E2B4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E2B4 */ _t9 = _t8 & 0x00000001u;
         /* 0208E2B4 */ if (_t9) goto L_0208E2B8; else goto L_0208E2CC;
   L_0208E2B8: ; // 0x208e2b8
@@ -16917,8 +16917,8 @@ void Gambit_fn_0208E2F0(CPUState* cpu) {
         /* 0208E334 */ Gambit_fn_026D6F40(cpu);
         /* 0208E338 */ cpu->r[3] = 0x00000268u;
         /* 0208E33C */ Gambit_fn_02801A78(cpu);
-        /* 0208E340 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208E344 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E340 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208E344 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E344 */ _t9 = _t8 & 0x00000001u;
         /* 0208E344 */ if (_t9) goto L_0208E34C; else goto L_0208E348;
   L_0208E348: ; // 0x208e348
@@ -16935,8 +16935,8 @@ void Gambit_fn_0208E2F0(CPUState* cpu) {
         /* 0208E360 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208E364 */ cpu->r[3] = 0x0000026Cu;
         /* 0208E368 */ Gambit_fn_02801A78(cpu);
-        /* 0208E36C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208E370 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E36C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208E370 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E370 */ _t14 = _t13 & 0x00000001u;
         /* 0208E370 */ if (_t14) goto L_0208E378; else goto L_0208E374;
   L_0208E374: ; // 0x208e374
@@ -16953,8 +16953,8 @@ void Gambit_fn_0208E2F0(CPUState* cpu) {
         /* 0208E38C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208E390 */ cpu->r[3] = 0x000002F4u;
         /* 0208E394 */ Gambit_fn_02801A78(cpu);
-        /* 0208E398 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208E39C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E398 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208E39C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E39C */ _t19 = _t18 & 0x00000001u;
         /* 0208E39C */ if (_t19) goto L_0208E3A4; else goto L_0208E3A0;
   L_0208E3A0: ; // 0x208e3a0
@@ -16971,8 +16971,8 @@ void Gambit_fn_0208E2F0(CPUState* cpu) {
         /* 0208E3B8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208E3BC */ cpu->r[3] = 0x00000244u;
         /* 0208E3C0 */ Gambit_fn_02801A78(cpu);
-        /* 0208E3C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208E3C8 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E3C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208E3C8 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E3C8 */ _t24 = _t23 & 0x00000001u;
         /* 0208E3C8 */ if (_t24) goto L_0208E3D0; else goto L_0208E3CC;
   L_0208E3CC: ; // 0x208e3cc
@@ -16992,8 +16992,8 @@ void Gambit_fn_0208E2F0(CPUState* cpu) {
         /* 0208E3F0 */ _t28 = cpu->r[1] + 0x00000084u;
         /* 0208E3F0 */ rbrew_write32(cpu->mem, _t28, cpu->r[0]);
         /* 0208E3F4 */ Gambit_fn_02801A78(cpu);
-        /* 0208E3F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208E3FC */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E3F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208E3FC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E3FC */ _t30 = _t29 & 0x00000001u;
         /* 0208E3FC */ if (_t30) goto L_0208E404; else goto L_0208E400;
   L_0208E400: ; // 0x208e400
@@ -17050,8 +17050,8 @@ void Gambit_fn_0208E2F4(CPUState* cpu) {
         /* 0208E334 */ Gambit_fn_026D6F40(cpu);
         /* 0208E338 */ cpu->r[3] = 0x00000268u;
         /* 0208E33C */ Gambit_fn_02801A78(cpu);
-        /* 0208E340 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208E344 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E340 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208E344 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E344 */ _t9 = _t8 & 0x00000001u;
         /* 0208E344 */ if (_t9) goto L_0208E34C; else goto L_0208E348;
   L_0208E348: ; // 0x208e348
@@ -17068,8 +17068,8 @@ void Gambit_fn_0208E2F4(CPUState* cpu) {
         /* 0208E360 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208E364 */ cpu->r[3] = 0x0000026Cu;
         /* 0208E368 */ Gambit_fn_02801A78(cpu);
-        /* 0208E36C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208E370 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E36C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208E370 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E370 */ _t14 = _t13 & 0x00000001u;
         /* 0208E370 */ if (_t14) goto L_0208E378; else goto L_0208E374;
   L_0208E374: ; // 0x208e374
@@ -17086,8 +17086,8 @@ void Gambit_fn_0208E2F4(CPUState* cpu) {
         /* 0208E38C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208E390 */ cpu->r[3] = 0x000002F4u;
         /* 0208E394 */ Gambit_fn_02801A78(cpu);
-        /* 0208E398 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208E39C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E398 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208E39C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E39C */ _t19 = _t18 & 0x00000001u;
         /* 0208E39C */ if (_t19) goto L_0208E3A4; else goto L_0208E3A0;
   L_0208E3A0: ; // 0x208e3a0
@@ -17104,8 +17104,8 @@ void Gambit_fn_0208E2F4(CPUState* cpu) {
         /* 0208E3B8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208E3BC */ cpu->r[3] = 0x00000244u;
         /* 0208E3C0 */ Gambit_fn_02801A78(cpu);
-        /* 0208E3C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208E3C8 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E3C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208E3C8 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E3C8 */ _t24 = _t23 & 0x00000001u;
         /* 0208E3C8 */ if (_t24) goto L_0208E3D0; else goto L_0208E3CC;
   L_0208E3CC: ; // 0x208e3cc
@@ -17125,8 +17125,8 @@ void Gambit_fn_0208E2F4(CPUState* cpu) {
         /* 0208E3F0 */ _t28 = cpu->r[1] + 0x00000084u;
         /* 0208E3F0 */ rbrew_write32(cpu->mem, _t28, cpu->r[0]);
         /* 0208E3F4 */ Gambit_fn_02801A78(cpu);
-        /* 0208E3F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208E3FC */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E3F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208E3FC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E3FC */ _t30 = _t29 & 0x00000001u;
         /* 0208E3FC */ if (_t30) goto L_0208E404; else goto L_0208E400;
   L_0208E400: ; // 0x208e400
@@ -17184,8 +17184,8 @@ void Gambit_fn_0208E430(CPUState* cpu) {
         /* 0208E334 */ Gambit_fn_026D6F40(cpu);
         /* 0208E338 */ cpu->r[3] = 0x00000268u;
         /* 0208E33C */ Gambit_fn_02801A78(cpu);
-        /* 0208E340 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208E344 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E340 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208E344 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E344 */ _t9 = _t8 & 0x00000001u;
         /* 0208E344 */ if (_t9) goto L_0208E34C; else goto L_0208E348;
   L_0208E348: ; // 0x208e348
@@ -17202,8 +17202,8 @@ void Gambit_fn_0208E430(CPUState* cpu) {
         /* 0208E360 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208E364 */ cpu->r[3] = 0x0000026Cu;
         /* 0208E368 */ Gambit_fn_02801A78(cpu);
-        /* 0208E36C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208E370 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E36C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208E370 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E370 */ _t14 = _t13 & 0x00000001u;
         /* 0208E370 */ if (_t14) goto L_0208E378; else goto L_0208E374;
   L_0208E374: ; // 0x208e374
@@ -17220,8 +17220,8 @@ void Gambit_fn_0208E430(CPUState* cpu) {
         /* 0208E38C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208E390 */ cpu->r[3] = 0x000002F4u;
         /* 0208E394 */ Gambit_fn_02801A78(cpu);
-        /* 0208E398 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208E39C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E398 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208E39C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E39C */ _t19 = _t18 & 0x00000001u;
         /* 0208E39C */ if (_t19) goto L_0208E3A4; else goto L_0208E3A0;
   L_0208E3A0: ; // 0x208e3a0
@@ -17238,8 +17238,8 @@ void Gambit_fn_0208E430(CPUState* cpu) {
         /* 0208E3B8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208E3BC */ cpu->r[3] = 0x00000244u;
         /* 0208E3C0 */ Gambit_fn_02801A78(cpu);
-        /* 0208E3C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208E3C8 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E3C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208E3C8 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E3C8 */ _t24 = _t23 & 0x00000001u;
         /* 0208E3C8 */ if (_t24) goto L_0208E3D0; else goto L_0208E3CC;
   L_0208E3CC: ; // 0x208e3cc
@@ -17259,8 +17259,8 @@ void Gambit_fn_0208E430(CPUState* cpu) {
         /* 0208E3F0 */ _t28 = cpu->r[1] + 0x00000084u;
         /* 0208E3F0 */ rbrew_write32(cpu->mem, _t28, cpu->r[0]);
         /* 0208E3F4 */ Gambit_fn_02801A78(cpu);
-        /* 0208E3F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208E3FC */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E3F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208E3FC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E3FC */ _t30 = _t29 & 0x00000001u;
         /* 0208E3FC */ if (_t30) goto L_0208E404; else goto L_0208E400;
   L_0208E400: ; // 0x208e400
@@ -17326,15 +17326,15 @@ void Gambit_fn_0208E448(CPUState* cpu) {
         /* 0208E468 */ _t4 = cpu->r[12] + 0x00000118u;
         /* 0208E468 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
         /* 0208E46C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0208E46C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208E470 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E46C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208E470 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E470 */ _t6 = _t5 & 0x00000001u;
         /* 0208E470 */ if (_t6) goto L_0208E490; else goto L_0208E474;
   L_0208E474: ; // 0x208e474
         /* 0208E474 */ _t7 = cpu->r[31] + 0x00000070u;
         /* 0208E474 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
-        /* 0208E478 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208E47C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E478 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208E47C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E47C */ _t9 = _t8 & 0x00000001u;
         /* 0208E47C */ if (_t9) goto L_0208E490; else goto L_0208E480;
   L_0208E480: ; // 0x208e480
@@ -17374,15 +17374,15 @@ void Gambit_fn_0208E44C(CPUState* cpu) {
         /* 0208E468 */ _t4 = cpu->r[12] + 0x00000118u;
         /* 0208E468 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
         /* 0208E46C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0208E46C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208E470 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E46C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208E470 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E470 */ _t6 = _t5 & 0x00000001u;
         /* 0208E470 */ if (_t6) goto L_0208E490; else goto L_0208E474;
   L_0208E474: ; // 0x208e474
         /* 0208E474 */ _t7 = cpu->r[31] + 0x00000070u;
         /* 0208E474 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
-        /* 0208E478 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208E47C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E478 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208E47C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E47C */ _t9 = _t8 & 0x00000001u;
         /* 0208E47C */ if (_t9) goto L_0208E490; else goto L_0208E480;
   L_0208E480: ; // 0x208e480
@@ -17423,15 +17423,15 @@ void Gambit_fn_0208E4A4(CPUState* cpu) {
         /* 0208E468 */ _t4 = cpu->r[12] + 0x00000118u;
         /* 0208E468 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
         /* 0208E46C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0208E46C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208E470 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E46C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208E470 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E470 */ _t6 = _t5 & 0x00000001u;
         /* 0208E470 */ if (_t6) goto L_0208E490; else goto L_0208E474;
   L_0208E474: ; // 0x208e474
         /* 0208E474 */ _t7 = cpu->r[31] + 0x00000070u;
         /* 0208E474 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
-        /* 0208E478 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208E47C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E478 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208E47C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E47C */ _t9 = _t8 & 0x00000001u;
         /* 0208E47C */ if (_t9) goto L_0208E490; else goto L_0208E480;
   L_0208E480: ; // 0x208e480
@@ -17532,19 +17532,19 @@ void Gambit_fn_0208E4DC(CPUState* cpu) {
         /* 0208E4E0 */ cpu->r[0] = cpu->lr;
         /* 0208E4E4 */ /* nop */
         /* 0208E4E8 */ cpu->r[30] = cpu->r[3];
-        /* 0208E4E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0208E4E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0208E4EC */ cpu->r[31] = cpu->r[4];
         /* 0208E4F0 */ _t1 = cpu->r[1] + 0x00000054u;
         /* 0208E4F0 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
-        /* 0208E4F4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E4F4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E4F4 */ _t3 = _t2 & 0x00000001u;
         /* 0208E4F4 */ if (_t3) goto L_0208E4F8; else goto L_0208E508;
   L_0208E4F8: ; // 0x208e4f8
         /* 0208E4F8 */ cpu->r[3] = 0x0000008Cu;
         /* 0208E4FC */ Gambit_fn_02801A78(cpu);
         /* 0208E500 */ cpu->r[30] = cpu->r[3];
-        /* 0208E500 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0208E504 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E500 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0208E504 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E504 */ _t5 = _t4 & 0x00000001u;
         /* 0208E504 */ if (_t5) goto L_0208EA14; else goto L_0208E508;
   L_0208E508: ; // 0x208e508
@@ -17564,17 +17564,17 @@ void Gambit_fn_0208E4DC(CPUState* cpu) {
         /* 0208E534 */ rbrew_write32(cpu->mem, _t7, cpu->r[6]);
         /* 0208E538 */ cpu->r[5] = cpu->r[5] + 0xFFFFE248u;
         /* 0208E53C */ cpu->r[3] = cpu->r[30] + 0x00000028u;
-        /* 0208E53C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0208E53C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0208E540 */ _t8 = cpu->r[30] + 0x0000000Cu;
         /* 0208E540 */ rbrew_write32(cpu->mem, _t8, cpu->r[5]);
-        /* 0208E544 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E544 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E544 */ _t10 = _t9 & 0x00000001u;
         /* 0208E544 */ if (_t10) goto L_0208E548; else goto L_0208E558;
   L_0208E548: ; // 0x208e548
         /* 0208E548 */ cpu->r[3] = 0x00000010u;
         /* 0208E54C */ Gambit_fn_02801A78(cpu);
-        /* 0208E550 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208E554 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E550 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208E554 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E554 */ _t12 = _t11 & 0x00000001u;
         /* 0208E554 */ if (_t12) goto L_0208E57C; else goto L_0208E558;
   L_0208E558: ; // 0x208e558
@@ -17596,17 +17596,17 @@ void Gambit_fn_0208E4DC(CPUState* cpu) {
         /* 0208E578 */ rbrew_write32(cpu->mem, _t19, cpu->r[10]);
   L_0208E57C: ; // 0x208e57c
         /* 0208E57C */ cpu->r[31] = cpu->r[30] + 0x00000038u;
-        /* 0208E57C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0208E57C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0208E580 */ cpu->r[29] = 0x00000000u;
-        /* 0208E584 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E584 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E584 */ _t21 = _t20 & 0x00000001u;
         /* 0208E584 */ if (_t21) goto L_0208E588; else goto L_0208E598;
   L_0208E588: ; // 0x208e588
         /* 0208E588 */ cpu->r[3] = 0x00000038u;
         /* 0208E58C */ Gambit_fn_02801A78(cpu);
         /* 0208E590 */ cpu->r[31] = cpu->r[3];
-        /* 0208E590 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0208E594 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E590 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0208E594 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E594 */ _t23 = _t22 & 0x00000001u;
         /* 0208E594 */ if (_t23) goto L_0208E5C8; else goto L_0208E598;
   L_0208E598: ; // 0x208e598
@@ -17679,23 +17679,23 @@ void Gambit_fn_0208E4DC(CPUState* cpu) {
         /* 0208E644 */ _t46 = cpu->r[12] + 0x00000000u;
         /* 0208E644 */ cpu->r[7] = rbrew_read8(cpu->mem, _t46);
         /* 0208E648 */ cpu->r[31] = 0x00000000u;
-        /* 0208E64C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[28]);
+        /* 0208E64C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[28]));
         /* 0208E650 */ cpu->r[5] = 0x00080000u;
-        /* 0208E654 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E654 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E654 */ _t48 = _t47 & 0x00000001u;
         /* 0208E654 */ if (_t48) goto L_0208E67C; else goto L_0208E658;
   L_0208E658: ; // 0x208e658
         /* 0208E658 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208E65C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 0208E65C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 0208E660 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 0208E664 */ _t49 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208E664 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208E664 */ _t50 = _t49 & 0x00000001u;
         /* 0208E664 */ if (_t50) goto L_0208E678; else goto L_0208E668;
   L_0208E668: ; // 0x208e668
         /* 0208E668 */ _t51 = cpu->r[12] + 0x00000000u;
         /* 0208E668 */ cpu->r[0] = rbrew_read8(cpu->mem, _t51);
-        /* 0208E66C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[28]);
-        /* 0208E670 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E66C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[28]));
+        /* 0208E670 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E670 */ _t53 = _t52 & 0x00000001u;
         /* 0208E670 */ if (_t53) goto L_0208E674; else goto L_0208E658;
   L_0208E674: ; // 0x208e674
@@ -17705,8 +17705,8 @@ void Gambit_fn_0208E4DC(CPUState* cpu) {
   L_0208E67C: ; // 0x208e67c
         /* 0208E67C */ _t54 = cpu->r[24] + 0x00000008u;
         /* 0208E67C */ cpu->r[9] = rbrew_read32(cpu->mem, _t54);
-        /* 0208E680 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
-        /* 0208E684 */ _t55 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208E680 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
+        /* 0208E684 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208E684 */ _t56 = _t55 & 0x00000001u;
         /* 0208E684 */ if (_t56) goto L_0208E68C; else goto L_0208E688;
   L_0208E688: ; // 0x208e688
@@ -17765,10 +17765,10 @@ void Gambit_fn_0208E4DC(CPUState* cpu) {
         /* 0208E714 */ rbrew_write32(cpu->mem, _t72, cpu->r[12]);
         /* 0208E718 */ _t73 = cpu->r[30] + 0x0000004Cu;
         /* 0208E718 */ cpu->r[0] = rbrew_read32(cpu->mem, _t73);
-        /* 0208E71C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 0208E71C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 0208E720 */ _t74 = cpu->r[30] + 0x00000050u;
         /* 0208E720 */ cpu->r[27] = rbrew_read32(cpu->mem, _t74);
-        /* 0208E724 */ _t75 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208E724 */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208E724 */ _t76 = _t75 & 0x00000001u;
         /* 0208E724 */ if (_t76) goto L_0208E728; else goto L_0208E72C;
   L_0208E728: ; // 0x208e728
@@ -17784,23 +17784,23 @@ void Gambit_fn_0208E4DC(CPUState* cpu) {
         /* 0208E740 */ _t79 = cpu->r[8] + 0x00000000u;
         /* 0208E740 */ cpu->r[5] = rbrew_read8(cpu->mem, _t79);
         /* 0208E744 */ cpu->r[31] = 0x00000000u;
-        /* 0208E748 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[28]);
+        /* 0208E748 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[28]));
         /* 0208E74C */ cpu->r[10] = 0x00080000u;
-        /* 0208E750 */ _t80 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E750 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E750 */ _t81 = _t80 & 0x00000001u;
         /* 0208E750 */ if (_t81) goto L_0208E778; else goto L_0208E754;
   L_0208E754: ; // 0x208e754
         /* 0208E754 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208E758 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 0208E758 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 0208E75C */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 0208E760 */ _t82 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208E760 */ _t82 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208E760 */ _t83 = _t82 & 0x00000001u;
         /* 0208E760 */ if (_t83) goto L_0208E774; else goto L_0208E764;
   L_0208E764: ; // 0x208e764
         /* 0208E764 */ _t84 = cpu->r[8] + 0x00000000u;
         /* 0208E764 */ cpu->r[7] = rbrew_read8(cpu->mem, _t84);
-        /* 0208E768 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[28]);
-        /* 0208E76C */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[28]));
+        /* 0208E76C */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E76C */ _t86 = _t85 & 0x00000001u;
         /* 0208E76C */ if (_t86) goto L_0208E770; else goto L_0208E754;
   L_0208E770: ; // 0x208e770
@@ -17812,10 +17812,10 @@ void Gambit_fn_0208E4DC(CPUState* cpu) {
         /* 0208E778 */ cpu->r[11] = rbrew_read32(cpu->mem, _t87);
         /* 0208E77C */ _t88 = cpu->r[1] + 0x00000010u;
         /* 0208E77C */ cpu->r[10] = rbrew_read32(cpu->mem, _t88);
-        /* 0208E780 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 0208E780 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 0208E784 */ _t89 = cpu->r[10] + 0x00000014u;
         /* 0208E784 */ cpu->r[0] = rbrew_read32(cpu->mem, _t89);
-        /* 0208E788 */ _t90 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208E788 */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208E788 */ _t91 = _t90 & 0x00000001u;
         /* 0208E788 */ if (_t91) goto L_0208E790; else goto L_0208E78C;
   L_0208E78C: ; // 0x208e78c
@@ -17870,10 +17870,10 @@ void Gambit_fn_0208E4DC(CPUState* cpu) {
         /* 0208E810 */ rbrew_write32(cpu->mem, _t105, cpu->r[9]);
         /* 0208E814 */ _t106 = cpu->r[30] + 0x0000004Cu;
         /* 0208E814 */ cpu->r[11] = rbrew_read32(cpu->mem, _t106);
-        /* 0208E818 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000002u);
+        /* 0208E818 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000002u));
         /* 0208E81C */ _t107 = cpu->r[30] + 0x00000050u;
         /* 0208E81C */ cpu->r[27] = rbrew_read32(cpu->mem, _t107);
-        /* 0208E820 */ _t108 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208E820 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208E820 */ _t109 = _t108 & 0x00000001u;
         /* 0208E820 */ if (_t109) goto L_0208E824; else goto L_0208E828;
   L_0208E824: ; // 0x208e824
@@ -17889,23 +17889,23 @@ void Gambit_fn_0208E4DC(CPUState* cpu) {
         /* 0208E83C */ _t112 = cpu->r[12] + 0x00000000u;
         /* 0208E83C */ cpu->r[0] = rbrew_read8(cpu->mem, _t112);
         /* 0208E840 */ cpu->r[31] = 0x00000000u;
-        /* 0208E844 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[28]);
+        /* 0208E844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[28]));
         /* 0208E848 */ cpu->r[5] = 0x00080000u;
-        /* 0208E84C */ _t113 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E84C */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E84C */ _t114 = _t113 & 0x00000001u;
         /* 0208E84C */ if (_t114) goto L_0208E874; else goto L_0208E850;
   L_0208E850: ; // 0x208e850
         /* 0208E850 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0208E854 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 0208E854 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 0208E858 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 0208E85C */ _t115 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208E85C */ _t115 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208E85C */ _t116 = _t115 & 0x00000001u;
         /* 0208E85C */ if (_t116) goto L_0208E870; else goto L_0208E860;
   L_0208E860: ; // 0x208e860
         /* 0208E860 */ _t117 = cpu->r[12] + 0x00000000u;
         /* 0208E860 */ cpu->r[6] = rbrew_read8(cpu->mem, _t117);
-        /* 0208E864 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[28]);
-        /* 0208E868 */ _t118 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E864 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[28]));
+        /* 0208E868 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E868 */ _t119 = _t118 & 0x00000001u;
         /* 0208E868 */ if (_t119) goto L_0208E86C; else goto L_0208E850;
   L_0208E86C: ; // 0x208e86c
@@ -17917,10 +17917,10 @@ void Gambit_fn_0208E4DC(CPUState* cpu) {
         /* 0208E874 */ cpu->r[12] = rbrew_read32(cpu->mem, _t120);
         /* 0208E878 */ _t121 = cpu->r[1] + 0x00000010u;
         /* 0208E878 */ cpu->r[7] = rbrew_read32(cpu->mem, _t121);
-        /* 0208E87C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 0208E87C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 0208E880 */ _t122 = cpu->r[7] + 0x00000014u;
         /* 0208E880 */ cpu->r[8] = rbrew_read32(cpu->mem, _t122);
-        /* 0208E884 */ _t123 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208E884 */ _t123 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208E884 */ _t124 = _t123 & 0x00000001u;
         /* 0208E884 */ if (_t124) goto L_0208E88C; else goto L_0208E888;
   L_0208E888: ; // 0x208e888
@@ -17975,10 +17975,10 @@ void Gambit_fn_0208E4DC(CPUState* cpu) {
         /* 0208E90C */ rbrew_write32(cpu->mem, _t138, cpu->r[0]);
         /* 0208E910 */ _t139 = cpu->r[30] + 0x0000004Cu;
         /* 0208E910 */ cpu->r[0] = rbrew_read32(cpu->mem, _t139);
-        /* 0208E914 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 0208E914 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 0208E918 */ _t140 = cpu->r[30] + 0x00000050u;
         /* 0208E918 */ cpu->r[31] = rbrew_read32(cpu->mem, _t140);
-        /* 0208E91C */ _t141 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208E91C */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208E91C */ _t142 = _t141 & 0x00000001u;
         /* 0208E91C */ if (_t142) goto L_0208E920; else goto L_0208E924;
   L_0208E920: ; // 0x208e920
@@ -17994,23 +17994,23 @@ void Gambit_fn_0208E4DC(CPUState* cpu) {
         /* 0208E938 */ _t145 = cpu->r[6] + 0x00000000u;
         /* 0208E938 */ cpu->r[0] = rbrew_read8(cpu->mem, _t145);
         /* 0208E93C */ cpu->r[27] = 0x00000000u;
-        /* 0208E940 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[28]);
+        /* 0208E940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[28]));
         /* 0208E944 */ cpu->r[9] = 0x00080000u;
-        /* 0208E948 */ _t146 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E948 */ _t146 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E948 */ _t147 = _t146 & 0x00000001u;
         /* 0208E948 */ if (_t147) goto L_0208E970; else goto L_0208E94C;
   L_0208E94C: ; // 0x208e94c
         /* 0208E94C */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 0208E950 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[9]);
+        /* 0208E950 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[9]));
         /* 0208E954 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 0208E958 */ _t148 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208E958 */ _t148 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208E958 */ _t149 = _t148 & 0x00000001u;
         /* 0208E958 */ if (_t149) goto L_0208E96C; else goto L_0208E95C;
   L_0208E95C: ; // 0x208e95c
         /* 0208E95C */ _t150 = cpu->r[6] + 0x00000000u;
         /* 0208E95C */ cpu->r[8] = rbrew_read8(cpu->mem, _t150);
-        /* 0208E960 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[28]);
-        /* 0208E964 */ _t151 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E960 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[28]));
+        /* 0208E964 */ _t151 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E964 */ _t152 = _t151 & 0x00000001u;
         /* 0208E964 */ if (_t152) goto L_0208E968; else goto L_0208E94C;
   L_0208E968: ; // 0x208e968
@@ -18022,10 +18022,10 @@ void Gambit_fn_0208E4DC(CPUState* cpu) {
         /* 0208E970 */ cpu->r[5] = rbrew_read32(cpu->mem, _t153);
         /* 0208E974 */ _t154 = cpu->r[1] + 0x00000010u;
         /* 0208E974 */ cpu->r[9] = rbrew_read32(cpu->mem, _t154);
-        /* 0208E978 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[5]);
+        /* 0208E978 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[5]));
         /* 0208E97C */ _t155 = cpu->r[9] + 0x00000014u;
         /* 0208E97C */ cpu->r[11] = rbrew_read32(cpu->mem, _t155);
-        /* 0208E980 */ _t156 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208E980 */ _t156 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208E980 */ _t157 = _t156 & 0x00000001u;
         /* 0208E980 */ if (_t157) goto L_0208E988; else goto L_0208E984;
   L_0208E984: ; // 0x208e984
@@ -18108,10 +18108,10 @@ void Gambit_fn_0208E8F0(CPUState* cpu) {
         /* 0208E90C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 0208E910 */ _t4 = cpu->r[30] + 0x0000004Cu;
         /* 0208E910 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
-        /* 0208E914 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 0208E914 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 0208E918 */ _t5 = cpu->r[30] + 0x00000050u;
         /* 0208E918 */ cpu->r[31] = rbrew_read32(cpu->mem, _t5);
-        /* 0208E91C */ _t6 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208E91C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208E91C */ _t7 = _t6 & 0x00000001u;
         /* 0208E91C */ if (_t7) goto L_0208E920; else goto L_0208E924;
   L_0208E920: ; // 0x208e920
@@ -18127,23 +18127,23 @@ void Gambit_fn_0208E8F0(CPUState* cpu) {
         /* 0208E938 */ _t10 = cpu->r[6] + 0x00000000u;
         /* 0208E938 */ cpu->r[0] = rbrew_read8(cpu->mem, _t10);
         /* 0208E93C */ cpu->r[27] = 0x00000000u;
-        /* 0208E940 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[28]);
+        /* 0208E940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[28]));
         /* 0208E944 */ cpu->r[9] = 0x00080000u;
-        /* 0208E948 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E948 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E948 */ _t12 = _t11 & 0x00000001u;
         /* 0208E948 */ if (_t12) goto L_0208E970; else goto L_0208E94C;
   L_0208E94C: ; // 0x208e94c
         /* 0208E94C */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 0208E950 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[9]);
+        /* 0208E950 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[9]));
         /* 0208E954 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 0208E958 */ _t13 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208E958 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208E958 */ _t14 = _t13 & 0x00000001u;
         /* 0208E958 */ if (_t14) goto L_0208E96C; else goto L_0208E95C;
   L_0208E95C: ; // 0x208e95c
         /* 0208E95C */ _t15 = cpu->r[6] + 0x00000000u;
         /* 0208E95C */ cpu->r[8] = rbrew_read8(cpu->mem, _t15);
-        /* 0208E960 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[28]);
-        /* 0208E964 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208E960 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[28]));
+        /* 0208E964 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208E964 */ _t17 = _t16 & 0x00000001u;
         /* 0208E964 */ if (_t17) goto L_0208E968; else goto L_0208E94C;
   L_0208E968: ; // 0x208e968
@@ -18155,10 +18155,10 @@ void Gambit_fn_0208E8F0(CPUState* cpu) {
         /* 0208E970 */ cpu->r[5] = rbrew_read32(cpu->mem, _t18);
         /* 0208E974 */ _t19 = cpu->r[1] + 0x00000010u;
         /* 0208E974 */ cpu->r[9] = rbrew_read32(cpu->mem, _t19);
-        /* 0208E978 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[5]);
+        /* 0208E978 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[5]));
         /* 0208E97C */ _t20 = cpu->r[9] + 0x00000014u;
         /* 0208E97C */ cpu->r[11] = rbrew_read32(cpu->mem, _t20);
-        /* 0208E980 */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208E980 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208E980 */ _t22 = _t21 & 0x00000001u;
         /* 0208E980 */ if (_t22) goto L_0208E988; else goto L_0208E984;
   L_0208E984: ; // 0x208e984
@@ -18261,12 +18261,12 @@ void Gambit_fn_0208EA44(CPUState* cpu) {
         /* 0208EA6C */ cpu->r[3] = rbrew_read32(cpu->mem, _t5);
         /* 0208EA70 */ cpu->r[4] = cpu->r[31];
         /* 0208EA74 */ Gambit_fn_0208B04C(cpu);
-        /* 0208EA78 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], 0x00000001u);
-        /* 0208EA7C */ _t6 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208EA78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], 0x00000001u));
+        /* 0208EA7C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208EA7C */ _t7 = _t6 & 0x00000001u;
         /* 0208EA7C */ if (_t7) goto L_0208EA94; else goto L_0208EA80;
   L_0208EA80: ; // 0x208ea80
-        /* 0208EA80 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EA80 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EA80 */ _t9 = _t8 & 0x00000001u;
         /* 0208EA80 */ if (_t9) goto L_0208EAAC; else goto L_0208EA84;
   L_0208EA84: ; // 0x208ea84
@@ -18327,12 +18327,12 @@ void Gambit_fn_0208EA48(CPUState* cpu) {
         /* 0208EA6C */ cpu->r[3] = rbrew_read32(cpu->mem, _t5);
         /* 0208EA70 */ cpu->r[4] = cpu->r[31];
         /* 0208EA74 */ Gambit_fn_0208B04C(cpu);
-        /* 0208EA78 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], 0x00000001u);
-        /* 0208EA7C */ _t6 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208EA78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], 0x00000001u));
+        /* 0208EA7C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208EA7C */ _t7 = _t6 & 0x00000001u;
         /* 0208EA7C */ if (_t7) goto L_0208EA94; else goto L_0208EA80;
   L_0208EA80: ; // 0x208ea80
-        /* 0208EA80 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EA80 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EA80 */ _t9 = _t8 & 0x00000001u;
         /* 0208EA80 */ if (_t9) goto L_0208EAAC; else goto L_0208EA84;
   L_0208EA84: ; // 0x208ea84
@@ -18378,9 +18378,9 @@ void Gambit_fn_0208EAD8(CPUState* cpu) {
         /* 0208B1BC */ cpu->r[12] = rbrew_read8(cpu->mem, _t0);
         /* 0208B1C0 */ /* nop */
         /* 0208B1C4 */ cpu->r[0] = cpu->r[12] + 0xFFFFFFFEu;
-        /* 0208B1C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 0208B1C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 0208B1CC */ cpu->r[0] = 0x00000001u;
-        /* 0208B1D0 */ _t1 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208B1D0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208B1D0 */ _t2 = _t1 & 0x00000001u;
         /* 0208B1D0 */ if (_t2) goto L_0208B1D4; else goto L_0208B1D8;
   L_0208B1D4: ; // 0x208b1d4
@@ -18501,8 +18501,8 @@ void Gambit_fn_0208EB74(CPUState* cpu) {
         /* 0208EB90 */ _t3 = cpu->r[31] + 0x00000078u;
         /* 0208EB90 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0208EB94 */ Gambit_fn_0208B1BC(cpu);
-        /* 0208EB98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EB9C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EB98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EB9C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EB9C */ _t5 = _t4 & 0x00000001u;
         /* 0208EB9C */ if (_t5) goto L_0208EBA8; else goto L_0208EBA0;
   L_0208EBA0: ; // 0x208eba0
@@ -18513,8 +18513,8 @@ void Gambit_fn_0208EB74(CPUState* cpu) {
         /* 0208EBA8 */ _t7 = cpu->r[31] + 0x0000007Cu;
         /* 0208EBA8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
         /* 0208EBAC */ Gambit_fn_02090B20(cpu);
-        /* 0208EBB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EBB4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EBB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EBB4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EBB4 */ _t9 = _t8 & 0x00000001u;
         /* 0208EBB4 */ if (_t9) goto L_0208EBC0; else goto L_0208EBB8;
   L_0208EBB8: ; // 0x208ebb8
@@ -18525,8 +18525,8 @@ void Gambit_fn_0208EB74(CPUState* cpu) {
         /* 0208EBC0 */ _t11 = cpu->r[31] + 0x00000080u;
         /* 0208EBC0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t11);
         /* 0208EBC4 */ Gambit_fn_0208CAA4(cpu);
-        /* 0208EBC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EBCC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EBC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EBCC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EBCC */ _t13 = _t12 & 0x00000001u;
         /* 0208EBCC */ if (_t13) goto L_0208EBD8; else goto L_0208EBD0;
   L_0208EBD0: ; // 0x208ebd0
@@ -18542,8 +18542,8 @@ void Gambit_fn_0208EB74(CPUState* cpu) {
         /* 0208EBE0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t17);
         /* 0208EBE4 */ cpu->ctr = cpu->r[0];
         /* 0208EBE8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208EBEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EBF0 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EBEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EBF0 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EBF0 */ _t19 = _t18 & 0x00000001u;
         /* 0208EBF0 */ if (_t19) goto L_0208EBFC; else goto L_0208EBF4;
   L_0208EBF4: ; // 0x208ebf4
@@ -18554,8 +18554,8 @@ void Gambit_fn_0208EB74(CPUState* cpu) {
         /* 0208EBFC */ _t21 = cpu->r[31] + 0x00000088u;
         /* 0208EBFC */ cpu->r[3] = rbrew_read32(cpu->mem, _t21);
         /* 0208EC00 */ Gambit_fn_020943CC(cpu);
-        /* 0208EC04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EC08 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EC04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EC08 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EC08 */ _t23 = _t22 & 0x00000001u;
         /* 0208EC08 */ if (_t23) goto L_0208EC14; else goto L_0208EC0C;
   L_0208EC0C: ; // 0x208ec0c
@@ -18590,8 +18590,8 @@ void Gambit_fn_0208EB78(CPUState* cpu) {
         /* 0208EB90 */ _t3 = cpu->r[31] + 0x00000078u;
         /* 0208EB90 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0208EB94 */ Gambit_fn_0208B1BC(cpu);
-        /* 0208EB98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EB9C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EB98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EB9C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EB9C */ _t5 = _t4 & 0x00000001u;
         /* 0208EB9C */ if (_t5) goto L_0208EBA8; else goto L_0208EBA0;
   L_0208EBA0: ; // 0x208eba0
@@ -18602,8 +18602,8 @@ void Gambit_fn_0208EB78(CPUState* cpu) {
         /* 0208EBA8 */ _t7 = cpu->r[31] + 0x0000007Cu;
         /* 0208EBA8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
         /* 0208EBAC */ Gambit_fn_02090B20(cpu);
-        /* 0208EBB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EBB4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EBB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EBB4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EBB4 */ _t9 = _t8 & 0x00000001u;
         /* 0208EBB4 */ if (_t9) goto L_0208EBC0; else goto L_0208EBB8;
   L_0208EBB8: ; // 0x208ebb8
@@ -18614,8 +18614,8 @@ void Gambit_fn_0208EB78(CPUState* cpu) {
         /* 0208EBC0 */ _t11 = cpu->r[31] + 0x00000080u;
         /* 0208EBC0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t11);
         /* 0208EBC4 */ Gambit_fn_0208CAA4(cpu);
-        /* 0208EBC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EBCC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EBC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EBCC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EBCC */ _t13 = _t12 & 0x00000001u;
         /* 0208EBCC */ if (_t13) goto L_0208EBD8; else goto L_0208EBD0;
   L_0208EBD0: ; // 0x208ebd0
@@ -18631,8 +18631,8 @@ void Gambit_fn_0208EB78(CPUState* cpu) {
         /* 0208EBE0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t17);
         /* 0208EBE4 */ cpu->ctr = cpu->r[0];
         /* 0208EBE8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208EBEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EBF0 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EBEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EBF0 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EBF0 */ _t19 = _t18 & 0x00000001u;
         /* 0208EBF0 */ if (_t19) goto L_0208EBFC; else goto L_0208EBF4;
   L_0208EBF4: ; // 0x208ebf4
@@ -18643,8 +18643,8 @@ void Gambit_fn_0208EB78(CPUState* cpu) {
         /* 0208EBFC */ _t21 = cpu->r[31] + 0x00000088u;
         /* 0208EBFC */ cpu->r[3] = rbrew_read32(cpu->mem, _t21);
         /* 0208EC00 */ Gambit_fn_020943CC(cpu);
-        /* 0208EC04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EC08 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EC04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EC08 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EC08 */ _t23 = _t22 & 0x00000001u;
         /* 0208EC08 */ if (_t23) goto L_0208EC14; else goto L_0208EC0C;
   L_0208EC0C: ; // 0x208ec0c
@@ -18680,8 +18680,8 @@ void Gambit_fn_0208EC28(CPUState* cpu) {
         /* 0208EC44 */ _t3 = cpu->r[31] + 0x00000078u;
         /* 0208EC44 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0208EC48 */ Gambit_fn_0208B1BC(cpu);
-        /* 0208EC4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EC50 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EC4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EC50 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EC50 */ _t5 = _t4 & 0x00000001u;
         /* 0208EC50 */ if (_t5) goto L_0208EC5C; else goto L_0208EC54;
   L_0208EC54: ; // 0x208ec54
@@ -18692,8 +18692,8 @@ void Gambit_fn_0208EC28(CPUState* cpu) {
         /* 0208EC5C */ _t7 = cpu->r[31] + 0x0000007Cu;
         /* 0208EC5C */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
         /* 0208EC60 */ Gambit_fn_02090B20(cpu);
-        /* 0208EC64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EC68 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EC64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EC68 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EC68 */ _t9 = _t8 & 0x00000001u;
         /* 0208EC68 */ if (_t9) goto L_0208EC74; else goto L_0208EC6C;
   L_0208EC6C: ; // 0x208ec6c
@@ -18704,8 +18704,8 @@ void Gambit_fn_0208EC28(CPUState* cpu) {
         /* 0208EC74 */ _t11 = cpu->r[31] + 0x00000080u;
         /* 0208EC74 */ cpu->r[3] = rbrew_read32(cpu->mem, _t11);
         /* 0208EC78 */ Gambit_fn_0208CAA4(cpu);
-        /* 0208EC7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EC80 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EC7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EC80 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EC80 */ _t13 = _t12 & 0x00000001u;
         /* 0208EC80 */ if (_t13) goto L_0208EC8C; else goto L_0208EC84;
   L_0208EC84: ; // 0x208ec84
@@ -18721,8 +18721,8 @@ void Gambit_fn_0208EC28(CPUState* cpu) {
         /* 0208EC94 */ cpu->r[0] = rbrew_read32(cpu->mem, _t17);
         /* 0208EC98 */ cpu->ctr = cpu->r[0];
         /* 0208EC9C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208ECA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208ECA4 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208ECA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208ECA4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208ECA4 */ _t19 = _t18 & 0x00000001u;
         /* 0208ECA4 */ if (_t19) goto L_0208ECB0; else goto L_0208ECA8;
   L_0208ECA8: ; // 0x208eca8
@@ -18733,8 +18733,8 @@ void Gambit_fn_0208EC28(CPUState* cpu) {
         /* 0208ECB0 */ _t21 = cpu->r[31] + 0x00000088u;
         /* 0208ECB0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t21);
         /* 0208ECB4 */ Gambit_fn_020943CC(cpu);
-        /* 0208ECB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208ECBC */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208ECB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208ECBC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208ECBC */ _t23 = _t22 & 0x00000001u;
         /* 0208ECBC */ if (_t23) goto L_0208ECC8; else goto L_0208ECC0;
   L_0208ECC0: ; // 0x208ecc0
@@ -18769,8 +18769,8 @@ void Gambit_fn_0208EC2C(CPUState* cpu) {
         /* 0208EC44 */ _t3 = cpu->r[31] + 0x00000078u;
         /* 0208EC44 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0208EC48 */ Gambit_fn_0208B1BC(cpu);
-        /* 0208EC4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EC50 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EC4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EC50 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EC50 */ _t5 = _t4 & 0x00000001u;
         /* 0208EC50 */ if (_t5) goto L_0208EC5C; else goto L_0208EC54;
   L_0208EC54: ; // 0x208ec54
@@ -18781,8 +18781,8 @@ void Gambit_fn_0208EC2C(CPUState* cpu) {
         /* 0208EC5C */ _t7 = cpu->r[31] + 0x0000007Cu;
         /* 0208EC5C */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
         /* 0208EC60 */ Gambit_fn_02090B20(cpu);
-        /* 0208EC64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EC68 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EC64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EC68 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EC68 */ _t9 = _t8 & 0x00000001u;
         /* 0208EC68 */ if (_t9) goto L_0208EC74; else goto L_0208EC6C;
   L_0208EC6C: ; // 0x208ec6c
@@ -18793,8 +18793,8 @@ void Gambit_fn_0208EC2C(CPUState* cpu) {
         /* 0208EC74 */ _t11 = cpu->r[31] + 0x00000080u;
         /* 0208EC74 */ cpu->r[3] = rbrew_read32(cpu->mem, _t11);
         /* 0208EC78 */ Gambit_fn_0208CAA4(cpu);
-        /* 0208EC7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EC80 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EC7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EC80 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EC80 */ _t13 = _t12 & 0x00000001u;
         /* 0208EC80 */ if (_t13) goto L_0208EC8C; else goto L_0208EC84;
   L_0208EC84: ; // 0x208ec84
@@ -18810,8 +18810,8 @@ void Gambit_fn_0208EC2C(CPUState* cpu) {
         /* 0208EC94 */ cpu->r[0] = rbrew_read32(cpu->mem, _t17);
         /* 0208EC98 */ cpu->ctr = cpu->r[0];
         /* 0208EC9C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208ECA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208ECA4 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208ECA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208ECA4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208ECA4 */ _t19 = _t18 & 0x00000001u;
         /* 0208ECA4 */ if (_t19) goto L_0208ECB0; else goto L_0208ECA8;
   L_0208ECA8: ; // 0x208eca8
@@ -18822,8 +18822,8 @@ void Gambit_fn_0208EC2C(CPUState* cpu) {
         /* 0208ECB0 */ _t21 = cpu->r[31] + 0x00000088u;
         /* 0208ECB0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t21);
         /* 0208ECB4 */ Gambit_fn_020943CC(cpu);
-        /* 0208ECB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208ECBC */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208ECB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208ECBC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208ECBC */ _t23 = _t22 & 0x00000001u;
         /* 0208ECBC */ if (_t23) goto L_0208ECC8; else goto L_0208ECC0;
   L_0208ECC0: ; // 0x208ecc0
@@ -18869,19 +18869,19 @@ void Gambit_fn_0208ECDC(CPUState* cpu) {
         /* 020908B4 */ Gambit_fn_02090880(cpu);
         /* 020908B8 */ _t6 = cpu->r[29] + 0x0000023Cu;
         /* 020908B8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 020908BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
-        /* 020908C0 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020908BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
+        /* 020908C0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020908C0 */ _t8 = _t7 & 0x00000001u;
         /* 020908C0 */ if (_t8) goto L_02090940; else goto L_020908C4;
   L_020908C4: ; // 0x20908c4
-        /* 020908C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000009u);
-        /* 020908C8 */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020908C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000009u));
+        /* 020908C8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020908C8 */ _t10 = _t9 & 0x00000001u;
         /* 020908C8 */ if (_t10) goto L_020908CC; else goto L_02090940;
   L_020908CC: ; // 0x20908cc
-        /* 020908CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000009u);
+        /* 020908CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000009u));
         /* 020908D0 */ cpu->r[31] = cpu->r[29] + 0x00000218u;
-        /* 020908D4 */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020908D4 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020908D4 */ _t12 = _t11 & 0x00000001u;
         /* 020908D4 */ if (_t12) goto L_020908D8; else goto L_020908FC;
   L_020908D8: ; // 0x20908d8
@@ -18894,8 +18894,8 @@ void Gambit_fn_0208ECDC(CPUState* cpu) {
         /* 020908E4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t15);
         /* 020908E8 */ cpu->ctr = cpu->r[9];
         /* 020908EC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020908F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020908F4 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020908F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020908F4 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020908F4 */ _t17 = _t16 & 0x00000001u;
         /* 020908F4 */ if (_t17) goto L_02090940; else goto L_020908F8;
   L_020908F8: ; // 0x20908f8
@@ -18909,15 +18909,15 @@ void Gambit_fn_0208ECDC(CPUState* cpu) {
         /* 02090904 */ cpu->r[9] = rbrew_read32(cpu->mem, _t20);
         /* 02090908 */ cpu->ctr = cpu->r[9];
         /* 0209090C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02090910 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02090914 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02090914 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090914 */ _t22 = _t21 & 0x00000001u;
         /* 02090914 */ if (_t22) goto L_02090940; else goto L_02090918;
   L_02090918: ; // 0x2090918
         /* 02090918 */ _t23 = cpu->r[29] + 0x0000023Cu;
         /* 02090918 */ cpu->r[8] = rbrew_read32(cpu->mem, _t23);
-        /* 0209091C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000009u);
-        /* 02090920 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209091C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000009u));
+        /* 02090920 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090920 */ _t25 = _t24 & 0x00000001u;
         /* 02090920 */ if (_t25) goto L_02090924; else goto L_0209092C;
   L_02090924: ; // 0x2090924
@@ -18933,14 +18933,14 @@ void Gambit_fn_0208ECDC(CPUState* cpu) {
         /* 02090938 */ cpu->ctr = cpu->r[0];
         /* 0209093C */ rbrew_call_indirect(cpu, cpu->ctr);
   L_02090940: ; // 0x2090940
-        /* 02090940 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000009u);
-        /* 02090944 */ _t29 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000009u));
+        /* 02090944 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090944 */ _t30 = _t29 & 0x00000001u;
         /* 02090944 */ if (_t30) goto L_02090948; else goto L_02090974;
   L_02090948: ; // 0x2090948
-        /* 02090948 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000009u);
+        /* 02090948 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000009u));
         /* 0209094C */ cpu->r[12] = cpu->r[29] + 0x00000218u;
-        /* 02090950 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090950 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090950 */ _t32 = _t31 & 0x00000001u;
         /* 02090950 */ if (_t32) goto L_02090954; else goto L_0209095C;
   L_02090954: ; // 0x2090954
@@ -18980,20 +18980,20 @@ void Gambit_fn_0208ECE4(CPUState* cpu) {
   L_0208ECE4: ; // 0x208ece4
         /* 0208ECE4 */ _t0 = cpu->r[3] + 0x00000070u;
         /* 0208ECE4 */ cpu->r[12] = rbrew_read8(cpu->mem, _t0);
-        /* 0208ECE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0208ECEC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208ECE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0208ECEC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208ECEC */ _t2 = _t1 & 0x00000001u;
         /* 0208ECEC */ if (_t2) goto L_0208ED10; else goto L_0208ECF0;
   L_0208ECF0: ; // 0x208ecf0
         /* 0208ECF0 */ _t3 = cpu->r[3] + 0x00000074u;
         /* 0208ECF0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 0208ECF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0208ECF8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208ECF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0208ECF8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208ECF8 */ _t5 = _t4 & 0x00000001u;
         /* 0208ECF8 */ if (_t5) goto L_0208ED10; else goto L_0208ECFC;
   L_0208ECFC: ; // 0x208ecfc
-        /* 0208ECFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0208ED00 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208ECFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0208ED00 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208ED00 */ _t7 = _t6 & 0x00000001u;
         /* 0208ED00 */ if (_t7) goto L_0208ED08; else goto L_0208ED04;
   L_0208ED04: ; // 0x208ed04
@@ -19174,8 +19174,8 @@ void Gambit_fn_0208ED50(CPUState* cpu) {
         /* 0208ED70 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208ED74 */ cpu->r[4] = 0x00000000u;
         /* 0208ED78 */ Gambit_fn_020DAD84(cpu);
-        /* 0208ED7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208ED80 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208ED7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208ED80 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208ED80 */ _t7 = _t6 & 0x00000001u;
         /* 0208ED80 */ if (_t7) goto L_0208ED84; else goto L_0208EE14;
   L_0208ED84: ; // 0x208ed84
@@ -19189,8 +19189,8 @@ void Gambit_fn_0208ED50(CPUState* cpu) {
         /* 0208ED94 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208ED98 */ cpu->r[4] = 0x00000000u;
         /* 0208ED9C */ Gambit_fn_020DAD84(cpu);
-        /* 0208EDA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EDA4 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EDA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EDA4 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EDA4 */ _t12 = _t11 & 0x00000001u;
         /* 0208EDA4 */ if (_t12) goto L_0208EDA8; else goto L_0208EE14;
   L_0208EDA8: ; // 0x208eda8
@@ -19204,8 +19204,8 @@ void Gambit_fn_0208ED50(CPUState* cpu) {
         /* 0208EDB8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208EDBC */ cpu->r[4] = 0x00000000u;
         /* 0208EDC0 */ Gambit_fn_020DAD84(cpu);
-        /* 0208EDC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EDC8 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EDC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EDC8 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EDC8 */ _t17 = _t16 & 0x00000001u;
         /* 0208EDC8 */ if (_t17) goto L_0208EDCC; else goto L_0208EE14;
   L_0208EDCC: ; // 0x208edcc
@@ -19219,8 +19219,8 @@ void Gambit_fn_0208ED50(CPUState* cpu) {
         /* 0208EDDC */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208EDE0 */ cpu->r[4] = 0x00000000u;
         /* 0208EDE4 */ Gambit_fn_020DAD84(cpu);
-        /* 0208EDE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EDEC */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EDE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EDEC */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EDEC */ _t22 = _t21 & 0x00000001u;
         /* 0208EDEC */ if (_t22) goto L_0208EDF0; else goto L_0208EE14;
   L_0208EDF0: ; // 0x208edf0
@@ -19234,8 +19234,8 @@ void Gambit_fn_0208ED50(CPUState* cpu) {
         /* 0208EE00 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208EE04 */ cpu->r[4] = 0x00000000u;
         /* 0208EE08 */ Gambit_fn_020DAD84(cpu);
-        /* 0208EE0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EE10 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EE0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EE10 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EE10 */ _t27 = _t26 & 0x00000001u;
         /* 0208EE10 */ if (_t27) goto L_0208EE2C; else goto L_0208EE14;
   L_0208EE14: ; // 0x208ee14
@@ -19273,15 +19273,15 @@ void Gambit_fn_0208EE48(CPUState* cpu) {
         /* 0208EE54 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0208EE58 */ _t3 = cpu->r[31] + 0x00000070u;
         /* 0208EE58 */ cpu->r[12] = rbrew_read8(cpu->mem, _t3);
-        /* 0208EE5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0208EE60 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EE5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0208EE60 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EE60 */ _t5 = _t4 & 0x00000001u;
         /* 0208EE60 */ if (_t5) goto L_0208EE64; else goto L_0208EFF0;
   L_0208EE64: ; // 0x208ee64
         /* 0208EE64 */ cpu->r[3] = cpu->r[31];
         /* 0208EE68 */ Gambit_fn_0208EAD8(cpu);
-        /* 0208EE6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EE70 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EE6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EE70 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EE70 */ _t7 = _t6 & 0x00000001u;
         /* 0208EE70 */ if (_t7) goto L_0208EF28; else goto L_0208EE74;
   L_0208EE74: ; // 0x208ee74
@@ -19290,8 +19290,8 @@ void Gambit_fn_0208EE48(CPUState* cpu) {
         /* 0208EE78 */ _t9 = cpu->r[3] + 0x00000118u;
         /* 0208EE78 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
         /* 0208EE7C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0208EE7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208EE80 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EE7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208EE80 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EE80 */ _t11 = _t10 & 0x00000001u;
         /* 0208EE80 */ if (_t11) goto L_0208EEF8; else goto L_0208EE84;
   L_0208EE84: ; // 0x208ee84
@@ -19309,8 +19309,8 @@ void Gambit_fn_0208EE48(CPUState* cpu) {
         /* 0208EE9C */ cpu->r[0] = rbrew_read32(cpu->mem, _t16);
         /* 0208EEA0 */ cpu->ctr = cpu->r[0];
         /* 0208EEA4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208EEA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EEAC */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EEA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EEAC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EEAC */ _t18 = _t17 & 0x00000001u;
         /* 0208EEAC */ if (_t18) goto L_0208EEC4; else goto L_0208EEB0;
   L_0208EEB0: ; // 0x208eeb0
@@ -19326,8 +19326,8 @@ void Gambit_fn_0208EE48(CPUState* cpu) {
         /* 0208EEC4 */ _t22 = cpu->r[31] + 0x00000080u;
         /* 0208EEC4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t22);
         /* 0208EEC8 */ Gambit_fn_0208CAA4(cpu);
-        /* 0208EECC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EED0 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EECC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EED0 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EED0 */ _t24 = _t23 & 0x00000001u;
         /* 0208EED0 */ if (_t24) goto L_0208EEDC; else goto L_0208EED4;
   L_0208EED4: ; // 0x208eed4
@@ -19338,8 +19338,8 @@ void Gambit_fn_0208EE48(CPUState* cpu) {
         /* 0208EEDC */ _t26 = cpu->r[31] + 0x00000088u;
         /* 0208EEDC */ cpu->r[3] = rbrew_read32(cpu->mem, _t26);
         /* 0208EEE0 */ Gambit_fn_020943CC(cpu);
-        /* 0208EEE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EEE8 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EEE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EEE8 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EEE8 */ _t28 = _t27 & 0x00000001u;
         /* 0208EEE8 */ if (_t28) goto L_0208EEF4; else goto L_0208EEEC;
   L_0208EEEC: ; // 0x208eeec
@@ -19351,16 +19351,16 @@ void Gambit_fn_0208EE48(CPUState* cpu) {
         /* 0208EEF4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t30);
   L_0208EEF8: ; // 0x208eef8
         /* 0208EEF8 */ Gambit_fn_02090B20(cpu);
-        /* 0208EEFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EF00 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EEFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EF00 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EF00 */ _t32 = _t31 & 0x00000001u;
         /* 0208EF00 */ if (_t32) goto L_0208EF28; else goto L_0208EF04;
   L_0208EF04: ; // 0x208ef04
         /* 0208EF04 */ _t33 = cpu->r[31] + 0x0000007Cu;
         /* 0208EF04 */ cpu->r[3] = rbrew_read32(cpu->mem, _t33);
         /* 0208EF08 */ Gambit_fn_02090B38(cpu);
-        /* 0208EF0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0xFFFFFFFFu);
-        /* 0208EF10 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EF0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0xFFFFFFFFu));
+        /* 0208EF10 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EF10 */ _t35 = _t34 & 0x00000001u;
         /* 0208EF10 */ if (_t35) goto L_0208EF28; else goto L_0208EF14;
   L_0208EF14: ; // 0x208ef14
@@ -19374,8 +19374,8 @@ void Gambit_fn_0208EE48(CPUState* cpu) {
   L_0208EF28: ; // 0x208ef28
         /* 0208EF28 */ cpu->r[3] = cpu->r[31];
         /* 0208EF2C */ Gambit_fn_0208EAFC(cpu);
-        /* 0208EF30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EF34 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EF30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EF34 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EF34 */ _t39 = _t38 & 0x00000001u;
         /* 0208EF34 */ if (_t39) goto L_0208EF6C; else goto L_0208EF38;
   L_0208EF38: ; // 0x208ef38
@@ -19400,8 +19400,8 @@ void Gambit_fn_0208EE48(CPUState* cpu) {
   L_0208EF6C: ; // 0x208ef6c
         /* 0208EF6C */ cpu->r[3] = cpu->r[31];
         /* 0208EF70 */ Gambit_fn_0208EB18(cpu);
-        /* 0208EF74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EF78 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EF74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EF78 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EF78 */ _t46 = _t45 & 0x00000001u;
         /* 0208EF78 */ if (_t46) goto L_0208EFB0; else goto L_0208EF7C;
   L_0208EF7C: ; // 0x208ef7c
@@ -19426,8 +19426,8 @@ void Gambit_fn_0208EE48(CPUState* cpu) {
   L_0208EFB0: ; // 0x208efb0
         /* 0208EFB0 */ cpu->r[3] = cpu->r[31];
         /* 0208EFB4 */ Gambit_fn_0208EB34(cpu);
-        /* 0208EFB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EFBC */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EFB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EFBC */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EFBC */ _t53 = _t52 & 0x00000001u;
         /* 0208EFBC */ if (_t53) goto L_0208EFF0; else goto L_0208EFC0;
   L_0208EFC0: ; // 0x208efc0
@@ -19473,15 +19473,15 @@ void Gambit_fn_0208F008(CPUState* cpu) {
         /* 0208F014 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0208F018 */ _t3 = cpu->r[31] + 0x00000070u;
         /* 0208F018 */ cpu->r[12] = rbrew_read8(cpu->mem, _t3);
-        /* 0208F01C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0208F020 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F01C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0208F020 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F020 */ _t5 = _t4 & 0x00000001u;
         /* 0208F020 */ if (_t5) goto L_0208F024; else goto L_0208F18C;
   L_0208F024: ; // 0x208f024
         /* 0208F024 */ cpu->r[3] = cpu->r[31];
         /* 0208F028 */ Gambit_fn_0208EAD8(cpu);
-        /* 0208F02C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F030 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F02C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F030 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F030 */ _t7 = _t6 & 0x00000001u;
         /* 0208F030 */ if (_t7) goto L_0208F0DC; else goto L_0208F034;
   L_0208F034: ; // 0x208f034
@@ -19490,8 +19490,8 @@ void Gambit_fn_0208F008(CPUState* cpu) {
         /* 0208F038 */ _t9 = cpu->r[12] + 0x00000118u;
         /* 0208F038 */ cpu->r[10] = rbrew_read32(cpu->mem, _t9);
         /* 0208F03C */ cpu->r[9] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0208F03C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0208F040 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F03C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0208F040 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F040 */ _t11 = _t10 & 0x00000001u;
         /* 0208F040 */ if (_t11) goto L_0208F090; else goto L_0208F044;
   L_0208F044: ; // 0x208f044
@@ -19509,8 +19509,8 @@ void Gambit_fn_0208F008(CPUState* cpu) {
         /* 0208F060 */ _t16 = cpu->r[31] + 0x00000080u;
         /* 0208F060 */ cpu->r[3] = rbrew_read32(cpu->mem, _t16);
         /* 0208F064 */ Gambit_fn_0208CAA4(cpu);
-        /* 0208F068 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F06C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F068 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F06C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F06C */ _t18 = _t17 & 0x00000001u;
         /* 0208F06C */ if (_t18) goto L_0208F078; else goto L_0208F070;
   L_0208F070: ; // 0x208f070
@@ -19521,8 +19521,8 @@ void Gambit_fn_0208F008(CPUState* cpu) {
         /* 0208F078 */ _t20 = cpu->r[31] + 0x00000088u;
         /* 0208F078 */ cpu->r[3] = rbrew_read32(cpu->mem, _t20);
         /* 0208F07C */ Gambit_fn_020943CC(cpu);
-        /* 0208F080 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F084 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F080 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F084 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F084 */ _t22 = _t21 & 0x00000001u;
         /* 0208F084 */ if (_t22) goto L_0208F090; else goto L_0208F088;
   L_0208F088: ; // 0x208f088
@@ -19532,16 +19532,16 @@ void Gambit_fn_0208F008(CPUState* cpu) {
   L_0208F090: ; // 0x208f090
         /* 0208F090 */ _t24 = cpu->r[31] + 0x00000040u;
         /* 0208F090 */ cpu->r[10] = rbrew_read32(cpu->mem, _t24);
-        /* 0208F094 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000008u);
-        /* 0208F098 */ _t25 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208F094 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000008u));
+        /* 0208F098 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208F098 */ _t26 = _t25 & 0x00000001u;
         /* 0208F098 */ if (_t26) goto L_0208F09C; else goto L_0208F0B4;
   L_0208F09C: ; // 0x208f09c
         /* 0208F09C */ _t27 = cpu->r[31] + 0x0000007Cu;
         /* 0208F09C */ cpu->r[3] = rbrew_read32(cpu->mem, _t27);
         /* 0208F0A0 */ Gambit_fn_02090B20(cpu);
-        /* 0208F0A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F0A8 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F0A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F0A8 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F0A8 */ _t29 = _t28 & 0x00000001u;
         /* 0208F0A8 */ if (_t29) goto L_0208F0B4; else goto L_0208F0AC;
   L_0208F0AC: ; // 0x208f0ac
@@ -19552,8 +19552,8 @@ void Gambit_fn_0208F008(CPUState* cpu) {
         /* 0208F0B4 */ _t31 = cpu->r[31] + 0x00000084u;
         /* 0208F0B4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t31);
         /* 0208F0B8 */ Gambit_fn_02096B80(cpu);
-        /* 0208F0BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F0C0 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F0BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F0C0 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F0C0 */ _t33 = _t32 & 0x00000001u;
         /* 0208F0C0 */ if (_t33) goto L_0208F0DC; else goto L_0208F0C4;
   L_0208F0C4: ; // 0x208f0c4
@@ -19568,8 +19568,8 @@ void Gambit_fn_0208F008(CPUState* cpu) {
   L_0208F0DC: ; // 0x208f0dc
         /* 0208F0DC */ cpu->r[3] = cpu->r[31];
         /* 0208F0E0 */ Gambit_fn_0208EAE0(cpu);
-        /* 0208F0E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F0E8 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F0E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F0E8 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F0E8 */ _t37 = _t36 & 0x00000001u;
         /* 0208F0E8 */ if (_t37) goto L_0208F120; else goto L_0208F0EC;
   L_0208F0EC: ; // 0x208f0ec
@@ -19594,8 +19594,8 @@ void Gambit_fn_0208F008(CPUState* cpu) {
   L_0208F120: ; // 0x208f120
         /* 0208F120 */ cpu->r[3] = cpu->r[31];
         /* 0208F124 */ Gambit_fn_0208EB18(cpu);
-        /* 0208F128 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F12C */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F128 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F12C */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F12C */ _t44 = _t43 & 0x00000001u;
         /* 0208F12C */ if (_t44) goto L_0208F158; else goto L_0208F130;
   L_0208F130: ; // 0x208f130
@@ -19615,8 +19615,8 @@ void Gambit_fn_0208F008(CPUState* cpu) {
   L_0208F158: ; // 0x208f158
         /* 0208F158 */ cpu->r[3] = cpu->r[31];
         /* 0208F15C */ Gambit_fn_0208EB34(cpu);
-        /* 0208F160 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F164 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F160 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F164 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F164 */ _t49 = _t48 & 0x00000001u;
         /* 0208F164 */ if (_t49) goto L_0208F18C; else goto L_0208F168;
   L_0208F168: ; // 0x208f168
@@ -19657,15 +19657,15 @@ void Gambit_fn_0208F1A4(CPUState* cpu) {
         /* 0208F1B0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0208F1B4 */ _t3 = cpu->r[31] + 0x00000070u;
         /* 0208F1B4 */ cpu->r[12] = rbrew_read8(cpu->mem, _t3);
-        /* 0208F1B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0208F1BC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F1B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0208F1BC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F1BC */ _t5 = _t4 & 0x00000001u;
         /* 0208F1BC */ if (_t5) goto L_0208F1C0; else goto L_0208F33C;
   L_0208F1C0: ; // 0x208f1c0
         /* 0208F1C0 */ cpu->r[3] = cpu->r[31];
         /* 0208F1C4 */ Gambit_fn_0208EAD8(cpu);
-        /* 0208F1C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F1CC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F1C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F1CC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F1CC */ _t7 = _t6 & 0x00000001u;
         /* 0208F1CC */ if (_t7) goto L_0208F28C; else goto L_0208F1D0;
   L_0208F1D0: ; // 0x208f1d0
@@ -19674,8 +19674,8 @@ void Gambit_fn_0208F1A4(CPUState* cpu) {
         /* 0208F1D4 */ _t9 = cpu->r[10] + 0x00000118u;
         /* 0208F1D4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t9);
         /* 0208F1D8 */ cpu->r[11] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0208F1D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0208F1DC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F1D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0208F1DC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F1DC */ _t11 = _t10 & 0x00000001u;
         /* 0208F1DC */ if (_t11) goto L_0208F240; else goto L_0208F1E0;
   L_0208F1E0: ; // 0x208f1e0
@@ -19696,8 +19696,8 @@ void Gambit_fn_0208F1A4(CPUState* cpu) {
         /* 0208F200 */ cpu->r[9] = rbrew_read32(cpu->mem, _t17);
         /* 0208F204 */ cpu->ctr = cpu->r[9];
         /* 0208F208 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208F20C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F210 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F20C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F210 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F210 */ _t19 = _t18 & 0x00000001u;
         /* 0208F210 */ if (_t19) goto L_0208F228; else goto L_0208F214;
   L_0208F214: ; // 0x208f214
@@ -19713,8 +19713,8 @@ void Gambit_fn_0208F1A4(CPUState* cpu) {
         /* 0208F228 */ _t23 = cpu->r[31] + 0x00000088u;
         /* 0208F228 */ cpu->r[3] = rbrew_read32(cpu->mem, _t23);
         /* 0208F22C */ Gambit_fn_020943CC(cpu);
-        /* 0208F230 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F234 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F230 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F234 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F234 */ _t25 = _t24 & 0x00000001u;
         /* 0208F234 */ if (_t25) goto L_0208F240; else goto L_0208F238;
   L_0208F238: ; // 0x208f238
@@ -19724,16 +19724,16 @@ void Gambit_fn_0208F1A4(CPUState* cpu) {
   L_0208F240: ; // 0x208f240
         /* 0208F240 */ _t27 = cpu->r[31] + 0x00000040u;
         /* 0208F240 */ cpu->r[0] = rbrew_read32(cpu->mem, _t27);
-        /* 0208F244 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000008u);
-        /* 0208F248 */ _t28 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208F244 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000008u));
+        /* 0208F248 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208F248 */ _t29 = _t28 & 0x00000001u;
         /* 0208F248 */ if (_t29) goto L_0208F24C; else goto L_0208F264;
   L_0208F24C: ; // 0x208f24c
         /* 0208F24C */ _t30 = cpu->r[31] + 0x0000007Cu;
         /* 0208F24C */ cpu->r[3] = rbrew_read32(cpu->mem, _t30);
         /* 0208F250 */ Gambit_fn_02090B20(cpu);
-        /* 0208F254 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F258 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F254 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F258 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F258 */ _t32 = _t31 & 0x00000001u;
         /* 0208F258 */ if (_t32) goto L_0208F264; else goto L_0208F25C;
   L_0208F25C: ; // 0x208f25c
@@ -19744,8 +19744,8 @@ void Gambit_fn_0208F1A4(CPUState* cpu) {
         /* 0208F264 */ _t34 = cpu->r[31] + 0x00000080u;
         /* 0208F264 */ cpu->r[3] = rbrew_read32(cpu->mem, _t34);
         /* 0208F268 */ Gambit_fn_0208CD4C(cpu);
-        /* 0208F26C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F270 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F26C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F270 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F270 */ _t36 = _t35 & 0x00000001u;
         /* 0208F270 */ if (_t36) goto L_0208F28C; else goto L_0208F274;
   L_0208F274: ; // 0x208f274
@@ -19760,8 +19760,8 @@ void Gambit_fn_0208F1A4(CPUState* cpu) {
   L_0208F28C: ; // 0x208f28c
         /* 0208F28C */ cpu->r[3] = cpu->r[31];
         /* 0208F290 */ Gambit_fn_0208EAE0(cpu);
-        /* 0208F294 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F298 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F294 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F298 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F298 */ _t40 = _t39 & 0x00000001u;
         /* 0208F298 */ if (_t40) goto L_0208F2D0; else goto L_0208F29C;
   L_0208F29C: ; // 0x208f29c
@@ -19786,8 +19786,8 @@ void Gambit_fn_0208F1A4(CPUState* cpu) {
   L_0208F2D0: ; // 0x208f2d0
         /* 0208F2D0 */ cpu->r[3] = cpu->r[31];
         /* 0208F2D4 */ Gambit_fn_0208EAFC(cpu);
-        /* 0208F2D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F2DC */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F2D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F2DC */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F2DC */ _t47 = _t46 & 0x00000001u;
         /* 0208F2DC */ if (_t47) goto L_0208F308; else goto L_0208F2E0;
   L_0208F2E0: ; // 0x208f2e0
@@ -19807,8 +19807,8 @@ void Gambit_fn_0208F1A4(CPUState* cpu) {
   L_0208F308: ; // 0x208f308
         /* 0208F308 */ cpu->r[3] = cpu->r[31];
         /* 0208F30C */ Gambit_fn_0208EB34(cpu);
-        /* 0208F310 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F314 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F310 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F314 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F314 */ _t52 = _t51 & 0x00000001u;
         /* 0208F314 */ if (_t52) goto L_0208F33C; else goto L_0208F318;
   L_0208F318: ; // 0x208f318
@@ -19849,15 +19849,15 @@ void Gambit_fn_0208F354(CPUState* cpu) {
         /* 0208F360 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0208F364 */ _t3 = cpu->r[31] + 0x00000070u;
         /* 0208F364 */ cpu->r[10] = rbrew_read8(cpu->mem, _t3);
-        /* 0208F368 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0208F36C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F368 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0208F36C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F36C */ _t5 = _t4 & 0x00000001u;
         /* 0208F36C */ if (_t5) goto L_0208F370; else goto L_0208F534;
   L_0208F370: ; // 0x208f370
         /* 0208F370 */ cpu->r[3] = cpu->r[31];
         /* 0208F374 */ Gambit_fn_0208EAD8(cpu);
-        /* 0208F378 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F37C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F378 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F37C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F37C */ _t7 = _t6 & 0x00000001u;
         /* 0208F37C */ if (_t7) goto L_0208F484; else goto L_0208F380;
   L_0208F380: ; // 0x208f380
@@ -19866,8 +19866,8 @@ void Gambit_fn_0208F354(CPUState* cpu) {
         /* 0208F384 */ _t9 = cpu->r[12] + 0x00000118u;
         /* 0208F384 */ cpu->r[10] = rbrew_read32(cpu->mem, _t9);
         /* 0208F388 */ cpu->r[0] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0208F388 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208F38C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F388 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208F38C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F38C */ _t11 = _t10 & 0x00000001u;
         /* 0208F38C */ if (_t11) goto L_0208F3E8; else goto L_0208F390;
   L_0208F390: ; // 0x208f390
@@ -19880,8 +19880,8 @@ void Gambit_fn_0208F354(CPUState* cpu) {
         /* 0208F3A0 */ _t14 = cpu->r[31] + 0x00000080u;
         /* 0208F3A0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t14);
         /* 0208F3A4 */ Gambit_fn_0208CAA4(cpu);
-        /* 0208F3A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F3AC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F3A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F3AC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F3AC */ _t16 = _t15 & 0x00000001u;
         /* 0208F3AC */ if (_t16) goto L_0208F3B8; else goto L_0208F3B0;
   L_0208F3B0: ; // 0x208f3b0
@@ -19897,8 +19897,8 @@ void Gambit_fn_0208F354(CPUState* cpu) {
         /* 0208F3C0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t20);
         /* 0208F3C4 */ cpu->ctr = cpu->r[0];
         /* 0208F3C8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208F3CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F3D0 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F3CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F3D0 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F3D0 */ _t22 = _t21 & 0x00000001u;
         /* 0208F3D0 */ if (_t22) goto L_0208F3E8; else goto L_0208F3D4;
   L_0208F3D4: ; // 0x208f3d4
@@ -19913,16 +19913,16 @@ void Gambit_fn_0208F354(CPUState* cpu) {
   L_0208F3E8: ; // 0x208f3e8
         /* 0208F3E8 */ _t26 = cpu->r[31] + 0x00000040u;
         /* 0208F3E8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t26);
-        /* 0208F3EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000008u);
-        /* 0208F3F0 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208F3EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000008u));
+        /* 0208F3F0 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208F3F0 */ _t28 = _t27 & 0x00000001u;
         /* 0208F3F0 */ if (_t28) goto L_0208F3F4; else goto L_0208F40C;
   L_0208F3F4: ; // 0x208f3f4
         /* 0208F3F4 */ _t29 = cpu->r[31] + 0x0000007Cu;
         /* 0208F3F4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t29);
         /* 0208F3F8 */ Gambit_fn_02090B20(cpu);
-        /* 0208F3FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F400 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F3FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F400 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F400 */ _t31 = _t30 & 0x00000001u;
         /* 0208F400 */ if (_t31) goto L_0208F40C; else goto L_0208F404;
   L_0208F404: ; // 0x208f404
@@ -19933,8 +19933,8 @@ void Gambit_fn_0208F354(CPUState* cpu) {
         /* 0208F40C */ _t33 = cpu->r[31] + 0x00000088u;
         /* 0208F40C */ cpu->r[3] = rbrew_read32(cpu->mem, _t33);
         /* 0208F410 */ Gambit_fn_020944B4(cpu);
-        /* 0208F414 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F418 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F414 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F418 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F418 */ _t35 = _t34 & 0x00000001u;
         /* 0208F418 */ if (_t35) goto L_0208F434; else goto L_0208F41C;
   L_0208F41C: ; // 0x208f41c
@@ -19950,8 +19950,8 @@ void Gambit_fn_0208F354(CPUState* cpu) {
         /* 0208F434 */ _t38 = cpu->r[31] + 0x00000088u;
         /* 0208F434 */ cpu->r[3] = rbrew_read32(cpu->mem, _t38);
         /* 0208F438 */ Gambit_fn_02094518(cpu);
-        /* 0208F43C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F440 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F43C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F440 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F440 */ _t40 = _t39 & 0x00000001u;
         /* 0208F440 */ if (_t40) goto L_0208F45C; else goto L_0208F444;
   L_0208F444: ; // 0x208f444
@@ -19967,8 +19967,8 @@ void Gambit_fn_0208F354(CPUState* cpu) {
         /* 0208F45C */ _t43 = cpu->r[31] + 0x00000088u;
         /* 0208F45C */ cpu->r[3] = rbrew_read32(cpu->mem, _t43);
         /* 0208F460 */ Gambit_fn_02094530(cpu);
-        /* 0208F464 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F468 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F468 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F468 */ _t45 = _t44 & 0x00000001u;
         /* 0208F468 */ if (_t45) goto L_0208F484; else goto L_0208F46C;
   L_0208F46C: ; // 0x208f46c
@@ -19983,8 +19983,8 @@ void Gambit_fn_0208F354(CPUState* cpu) {
   L_0208F484: ; // 0x208f484
         /* 0208F484 */ cpu->r[3] = cpu->r[31];
         /* 0208F488 */ Gambit_fn_0208EAE0(cpu);
-        /* 0208F48C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F490 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F48C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F490 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F490 */ _t49 = _t48 & 0x00000001u;
         /* 0208F490 */ if (_t49) goto L_0208F4C8; else goto L_0208F494;
   L_0208F494: ; // 0x208f494
@@ -20009,8 +20009,8 @@ void Gambit_fn_0208F354(CPUState* cpu) {
   L_0208F4C8: ; // 0x208f4c8
         /* 0208F4C8 */ cpu->r[3] = cpu->r[31];
         /* 0208F4CC */ Gambit_fn_0208EB18(cpu);
-        /* 0208F4D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F4D4 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F4D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F4D4 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F4D4 */ _t56 = _t55 & 0x00000001u;
         /* 0208F4D4 */ if (_t56) goto L_0208F500; else goto L_0208F4D8;
   L_0208F4D8: ; // 0x208f4d8
@@ -20030,8 +20030,8 @@ void Gambit_fn_0208F354(CPUState* cpu) {
   L_0208F500: ; // 0x208f500
         /* 0208F500 */ cpu->r[3] = cpu->r[31];
         /* 0208F504 */ Gambit_fn_0208EAFC(cpu);
-        /* 0208F508 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F50C */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F508 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F50C */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F50C */ _t61 = _t60 & 0x00000001u;
         /* 0208F50C */ if (_t61) goto L_0208F534; else goto L_0208F510;
   L_0208F510: ; // 0x208f510
@@ -20338,15 +20338,15 @@ void Gambit_fn_0208F67C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0208F67C: ; // 0x208f67c
-        /* 0208F67C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F680 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F67C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F680 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F680 */ _t1 = _t0 & 0x00000001u;
         /* 0208F680 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208F680 */ goto L_0208F684;
   L_0208F684: ; // 0x208f684
         /* 0208F684 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0208F684 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208F688 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F684 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208F688 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F688 */ _t3 = _t2 & 0x00000001u;
         /* 0208F688 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208F688 */ goto L_0208F68C;
@@ -20365,8 +20365,8 @@ void Gambit_fn_0208F67C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -20380,15 +20380,15 @@ void Gambit_fn_0208F67C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -20493,15 +20493,15 @@ void Gambit_fn_0208F6CC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0208F6CC: ; // 0x208f6cc
-        /* 0208F6CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F6D0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F6CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F6D0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F6D0 */ _t1 = _t0 & 0x00000001u;
         /* 0208F6D0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208F6D0 */ goto L_0208F6D4;
   L_0208F6D4: ; // 0x208f6d4
         /* 0208F6D4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0208F6D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208F6D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F6D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208F6D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F6D8 */ _t3 = _t2 & 0x00000001u;
         /* 0208F6D8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208F6D8 */ goto L_0208F6DC;
@@ -20520,8 +20520,8 @@ void Gambit_fn_0208F6CC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -20535,15 +20535,15 @@ void Gambit_fn_0208F6CC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -20589,15 +20589,15 @@ void Gambit_fn_0208F6FC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0208F6FC: ; // 0x208f6fc
-        /* 0208F6FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F700 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F6FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F700 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F700 */ _t1 = _t0 & 0x00000001u;
         /* 0208F700 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208F700 */ goto L_0208F704;
   L_0208F704: ; // 0x208f704
         /* 0208F704 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0208F704 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208F708 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F704 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208F708 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F708 */ _t3 = _t2 & 0x00000001u;
         /* 0208F708 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208F708 */ goto L_0208F70C;
@@ -20616,8 +20616,8 @@ void Gambit_fn_0208F6FC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -20631,15 +20631,15 @@ void Gambit_fn_0208F6FC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -20667,15 +20667,15 @@ void Gambit_fn_0208F710(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0208F710: ; // 0x208f710
-        /* 0208F710 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208F714 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208F714 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F714 */ _t1 = _t0 & 0x00000001u;
         /* 0208F714 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208F714 */ goto L_0208F718;
   L_0208F718: ; // 0x208f718
         /* 0208F718 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0208F718 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0208F71C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F718 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0208F71C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F71C */ _t3 = _t2 & 0x00000001u;
         /* 0208F71C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208F71C */ goto L_0208F720;
@@ -20694,8 +20694,8 @@ void Gambit_fn_0208F710(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -20709,15 +20709,15 @@ void Gambit_fn_0208F710(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -20932,10 +20932,10 @@ void Gambit_fn_0208F7E0(CPUState* cpu) {
         /* 0208F7E8 */ _t1 = cpu->r[3] + 0x00000028u;
         /* 0208F7E8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 0208F7EC */ cpu->r[8] = cpu->r[0];
-        /* 0208F7F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 0208F7F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 0208F7F4 */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 0208F7F4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0208F7F8 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208F7F8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208F7F8 */ _t4 = _t3 & 0x00000001u;
         /* 0208F7F8 */ if (_t4) goto L_0208F7FC; else goto L_0208F814;
   L_0208F7FC: ; // 0x208f7fc
@@ -20943,8 +20943,8 @@ void Gambit_fn_0208F7E0(CPUState* cpu) {
         /* 0208F800 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 0208F804 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0208F804 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0208F808 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0208F80C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F808 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0208F80C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F80C */ _t7 = _t6 & 0x00000001u;
         /* 0208F80C */ if (_t7) goto L_0208F810; else goto L_0208F820;
   L_0208F810: ; // 0x208f810
@@ -20952,16 +20952,16 @@ void Gambit_fn_0208F7E0(CPUState* cpu) {
   L_0208F814: ; // 0x208f814
         /* 0208F814 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0208F814 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0208F818 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0208F81C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F818 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0208F81C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F81C */ _t10 = _t9 & 0x00000001u;
         /* 0208F81C */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208F81C */ goto L_0208F820;
   L_0208F820: ; // 0x208f820
-        /* 0208F820 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 0208F820 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 0208F824 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0208F824 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 0208F828 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208F828 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208F828 */ _t13 = _t12 & 0x00000001u;
         /* 0208F828 */ if (_t13) goto L_0208F82C; else goto L_0208F834;
   L_0208F82C: ; // 0x208f82c
@@ -20972,11 +20972,11 @@ void Gambit_fn_0208F7E0(CPUState* cpu) {
         /* 0208F834 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0208F838 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0208F838 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0208F83C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208F83C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208F840 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0208F840 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0208F844 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 0208F848 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208F848 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208F848 */ _t18 = _t17 & 0x00000001u;
         /* 0208F848 */ if (_t18) goto L_0208F860; else goto L_0208F84C;
   L_0208F84C: ; // 0x208f84c
@@ -21009,18 +21009,18 @@ void Gambit_fn_0208F868(CPUState* cpu) {
         /* 0208F87C */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0208F87C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0208F880 */ cpu->r[12] = 0x00000000u;
-        /* 0208F884 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208F884 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208F888 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0208F888 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0208F88C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F88C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F88C */ _t6 = _t5 & 0x00000001u;
         /* 0208F88C */ if (_t6) goto L_0208F8B4; else goto L_0208F890;
   L_0208F890: ; // 0x208f890
         /* 0208F890 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0208F890 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0208F894 */ /* nop */
-        /* 0208F898 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0208F89C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F898 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0208F89C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F89C */ _t9 = _t8 & 0x00000001u;
         /* 0208F89C */ if (_t9) goto L_0208F8A0; else goto L_0208F8B4;
   L_0208F8A0: ; // 0x208f8a0
@@ -21061,18 +21061,18 @@ void Gambit_fn_0208F86C(CPUState* cpu) {
         /* 0208F87C */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0208F87C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0208F880 */ cpu->r[12] = 0x00000000u;
-        /* 0208F884 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208F884 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208F888 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0208F888 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0208F88C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F88C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F88C */ _t6 = _t5 & 0x00000001u;
         /* 0208F88C */ if (_t6) goto L_0208F8B4; else goto L_0208F890;
   L_0208F890: ; // 0x208f890
         /* 0208F890 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0208F890 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0208F894 */ /* nop */
-        /* 0208F898 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0208F89C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F898 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0208F89C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F89C */ _t9 = _t8 & 0x00000001u;
         /* 0208F89C */ if (_t9) goto L_0208F8A0; else goto L_0208F8B4;
   L_0208F8A0: ; // 0x208f8a0
@@ -21108,10 +21108,10 @@ void Gambit_fn_0208F8D8(CPUState* cpu) {
         /* 0208F8E0 */ _t1 = cpu->r[3] + 0x00000020u;
         /* 0208F8E0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 0208F8E4 */ cpu->r[8] = cpu->r[0];
-        /* 0208F8E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 0208F8E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 0208F8EC */ _t2 = cpu->r[3] + 0x00000024u;
         /* 0208F8EC */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0208F8F0 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208F8F0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208F8F0 */ _t4 = _t3 & 0x00000001u;
         /* 0208F8F0 */ if (_t4) goto L_0208F8F4; else goto L_0208F90C;
   L_0208F8F4: ; // 0x208f8f4
@@ -21119,8 +21119,8 @@ void Gambit_fn_0208F8D8(CPUState* cpu) {
         /* 0208F8F8 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 0208F8FC */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0208F8FC */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0208F900 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0208F904 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F900 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0208F904 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F904 */ _t7 = _t6 & 0x00000001u;
         /* 0208F904 */ if (_t7) goto L_0208F908; else goto L_0208F918;
   L_0208F908: ; // 0x208f908
@@ -21128,16 +21128,16 @@ void Gambit_fn_0208F8D8(CPUState* cpu) {
   L_0208F90C: ; // 0x208f90c
         /* 0208F90C */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0208F90C */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0208F910 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0208F914 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0208F914 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F914 */ _t10 = _t9 & 0x00000001u;
         /* 0208F914 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208F914 */ goto L_0208F918;
   L_0208F918: ; // 0x208f918
-        /* 0208F918 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 0208F918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 0208F91C */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0208F91C */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 0208F920 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208F920 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208F920 */ _t13 = _t12 & 0x00000001u;
         /* 0208F920 */ if (_t13) goto L_0208F924; else goto L_0208F92C;
   L_0208F924: ; // 0x208f924
@@ -21148,11 +21148,11 @@ void Gambit_fn_0208F8D8(CPUState* cpu) {
         /* 0208F92C */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0208F930 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0208F930 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0208F934 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208F934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208F938 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0208F938 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0208F93C */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 0208F940 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208F940 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208F940 */ _t18 = _t17 & 0x00000001u;
         /* 0208F940 */ if (_t18) goto L_0208F958; else goto L_0208F944;
   L_0208F944: ; // 0x208f944
@@ -21179,10 +21179,10 @@ void Gambit_fn_0208F960(CPUState* cpu) {
         /* 0208F968 */ _t1 = cpu->r[3] + 0x00000028u;
         /* 0208F968 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 0208F96C */ cpu->r[8] = cpu->r[0];
-        /* 0208F970 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 0208F970 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 0208F974 */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 0208F974 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0208F978 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208F978 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208F978 */ _t4 = _t3 & 0x00000001u;
         /* 0208F978 */ if (_t4) goto L_0208F97C; else goto L_0208F994;
   L_0208F97C: ; // 0x208f97c
@@ -21190,8 +21190,8 @@ void Gambit_fn_0208F960(CPUState* cpu) {
         /* 0208F980 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 0208F984 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0208F984 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0208F988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0208F98C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0208F98C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F98C */ _t7 = _t6 & 0x00000001u;
         /* 0208F98C */ if (_t7) goto L_0208F990; else goto L_0208F9A0;
   L_0208F990: ; // 0x208f990
@@ -21199,16 +21199,16 @@ void Gambit_fn_0208F960(CPUState* cpu) {
   L_0208F994: ; // 0x208f994
         /* 0208F994 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0208F994 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0208F998 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0208F99C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208F998 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0208F99C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208F99C */ _t10 = _t9 & 0x00000001u;
         /* 0208F99C */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208F99C */ goto L_0208F9A0;
   L_0208F9A0: ; // 0x208f9a0
-        /* 0208F9A0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 0208F9A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 0208F9A4 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0208F9A4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 0208F9A8 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208F9A8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208F9A8 */ _t13 = _t12 & 0x00000001u;
         /* 0208F9A8 */ if (_t13) goto L_0208F9AC; else goto L_0208F9B4;
   L_0208F9AC: ; // 0x208f9ac
@@ -21219,11 +21219,11 @@ void Gambit_fn_0208F960(CPUState* cpu) {
         /* 0208F9B4 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0208F9B8 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0208F9B8 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0208F9BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208F9BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208F9C0 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0208F9C0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0208F9C4 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 0208F9C8 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208F9C8 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208F9C8 */ _t18 = _t17 & 0x00000001u;
         /* 0208F9C8 */ if (_t18) goto L_0208F9E0; else goto L_0208F9CC;
   L_0208F9CC: ; // 0x208f9cc
@@ -21256,18 +21256,18 @@ void Gambit_fn_0208F9E8(CPUState* cpu) {
         /* 0208F9FC */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0208F9FC */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0208FA00 */ cpu->r[12] = 0x00000000u;
-        /* 0208FA04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208FA04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208FA08 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0208FA08 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0208FA0C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FA0C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FA0C */ _t6 = _t5 & 0x00000001u;
         /* 0208FA0C */ if (_t6) goto L_0208FA34; else goto L_0208FA10;
   L_0208FA10: ; // 0x208fa10
         /* 0208FA10 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0208FA10 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0208FA14 */ /* nop */
-        /* 0208FA18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0208FA1C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FA18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0208FA1C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FA1C */ _t9 = _t8 & 0x00000001u;
         /* 0208FA1C */ if (_t9) goto L_0208FA20; else goto L_0208FA34;
   L_0208FA20: ; // 0x208fa20
@@ -21308,18 +21308,18 @@ void Gambit_fn_0208F9EC(CPUState* cpu) {
         /* 0208F9FC */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0208F9FC */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0208FA00 */ cpu->r[12] = 0x00000000u;
-        /* 0208FA04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208FA04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208FA08 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0208FA08 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0208FA0C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FA0C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FA0C */ _t6 = _t5 & 0x00000001u;
         /* 0208FA0C */ if (_t6) goto L_0208FA34; else goto L_0208FA10;
   L_0208FA10: ; // 0x208fa10
         /* 0208FA10 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0208FA10 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0208FA14 */ /* nop */
-        /* 0208FA18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0208FA1C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FA18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0208FA1C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FA1C */ _t9 = _t8 & 0x00000001u;
         /* 0208FA1C */ if (_t9) goto L_0208FA20; else goto L_0208FA34;
   L_0208FA20: ; // 0x208fa20
@@ -21355,10 +21355,10 @@ void Gambit_fn_0208FA58(CPUState* cpu) {
         /* 0208FA60 */ _t1 = cpu->r[3] + 0x00000030u;
         /* 0208FA60 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 0208FA64 */ cpu->r[7] = cpu->r[0];
-        /* 0208FA68 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 0208FA68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 0208FA6C */ _t2 = cpu->r[3] + 0x00000034u;
         /* 0208FA6C */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0208FA70 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208FA70 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208FA70 */ _t4 = _t3 & 0x00000001u;
         /* 0208FA70 */ if (_t4) goto L_0208FA74; else goto L_0208FA8C;
   L_0208FA74: ; // 0x208fa74
@@ -21366,8 +21366,8 @@ void Gambit_fn_0208FA58(CPUState* cpu) {
         /* 0208FA78 */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 0208FA7C */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0208FA7C */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0208FA80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0208FA84 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FA80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0208FA84 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FA84 */ _t7 = _t6 & 0x00000001u;
         /* 0208FA84 */ if (_t7) goto L_0208FA88; else goto L_0208FA98;
   L_0208FA88: ; // 0x208fa88
@@ -21375,16 +21375,16 @@ void Gambit_fn_0208FA58(CPUState* cpu) {
   L_0208FA8C: ; // 0x208fa8c
         /* 0208FA8C */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0208FA8C */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0208FA90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0208FA94 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FA90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0208FA94 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FA94 */ _t10 = _t9 & 0x00000001u;
         /* 0208FA94 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208FA94 */ goto L_0208FA98;
   L_0208FA98: ; // 0x208fa98
-        /* 0208FA98 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 0208FA98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 0208FA9C */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0208FA9C */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 0208FAA0 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208FAA0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208FAA0 */ _t13 = _t12 & 0x00000001u;
         /* 0208FAA0 */ if (_t13) goto L_0208FAA4; else goto L_0208FAAC;
   L_0208FAA4: ; // 0x208faa4
@@ -21395,11 +21395,11 @@ void Gambit_fn_0208FA58(CPUState* cpu) {
         /* 0208FAAC */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0208FAB0 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0208FAB0 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0208FAB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0208FAB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0208FAB8 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0208FAB8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0208FABC */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 0208FAC0 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208FAC0 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208FAC0 */ _t18 = _t17 & 0x00000001u;
         /* 0208FAC0 */ if (_t18) goto L_0208FAD8; else goto L_0208FAC4;
   L_0208FAC4: ; // 0x208fac4
@@ -21434,9 +21434,9 @@ void Gambit_fn_0208FAE0(CPUState* cpu) {
         /* 0208FAF8 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 0208FAF8 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 0208FAFC */ /* nop */
-        /* 0208FB00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 0208FB00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 0208FB04 */ cpu->r[31] = cpu->r[4];
-        /* 0208FB08 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FB08 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FB08 */ _t6 = _t5 & 0x00000001u;
         /* 0208FB08 */ if (_t6) goto L_0208FB0C; else goto L_0208FB20;
   L_0208FB0C: ; // 0x208fb0c
@@ -21485,9 +21485,9 @@ void Gambit_fn_0208FAE4(CPUState* cpu) {
         /* 0208FAF8 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 0208FAF8 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 0208FAFC */ /* nop */
-        /* 0208FB00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 0208FB00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 0208FB04 */ cpu->r[31] = cpu->r[4];
-        /* 0208FB08 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FB08 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FB08 */ _t6 = _t5 & 0x00000001u;
         /* 0208FB08 */ if (_t6) goto L_0208FB0C; else goto L_0208FB20;
   L_0208FB0C: ; // 0x208fb0c
@@ -21538,10 +21538,10 @@ void Gambit_fn_0208FB58(CPUState* cpu) {
         /* 0208FB78 */ cpu->r[31] = 0x101D0000u;
         /* 0208FB7C */ _t3 = cpu->r[28] + 0x0000001Cu;
         /* 0208FB7C */ rbrew_write32(cpu->mem, _t3, cpu->r[4]);
-        /* 0208FB80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0208FB80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0208FB84 */ _t4 = cpu->r[28] + 0x0000000Fu;
         /* 0208FB84 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[27]);
-        /* 0208FB88 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FB88 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FB88 */ _t6 = _t5 & 0x00000001u;
         /* 0208FB88 */ if (_t6) goto L_0208FBCC; else goto L_0208FB8C;
   L_0208FB8C: ; // 0x208fb8c
@@ -21556,16 +21556,16 @@ void Gambit_fn_0208FB58(CPUState* cpu) {
         /* 0208FBA0 */ cpu->r[5] = 0x00000004u;
         /* 0208FBA4 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 0208FBA8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208FBAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0208FBAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0208FBB0 */ cpu->r[0] = cpu->r[27];
-        /* 0208FBB4 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208FBB4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208FBB4 */ _t11 = _t10 & 0x00000001u;
         /* 0208FBB4 */ if (_t11) goto L_0208FBBC; else goto L_0208FBB8;
   L_0208FBB8: ; // 0x208fbb8
         /* 0208FBB8 */ cpu->r[0] = 0x00000001u;
   L_0208FBBC: ; // 0x208fbbc
-        /* 0208FBBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208FBC0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FBBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208FBC0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FBC0 */ _t13 = _t12 & 0x00000001u;
         /* 0208FBC0 */ if (_t13) goto L_0208FBCC; else goto L_0208FBC4;
   L_0208FBC4: ; // 0x208fbc4
@@ -21577,9 +21577,9 @@ void Gambit_fn_0208FB58(CPUState* cpu) {
         /* 0208FBCC */ _t16 = cpu->r[28] + 0x00000020u;
         /* 0208FBCC */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 0208FBD0 */ cpu->r[0] = 0x00000000u;
-        /* 0208FBD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0208FBD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0208FBD8 */ cpu->r[12] = cpu->r[0];
-        /* 0208FBDC */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208FBDC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208FBDC */ _t18 = _t17 & 0x00000001u;
         /* 0208FBDC */ if (_t18) goto L_0208FBE0; else goto L_0208FC04;
   L_0208FBE0: ; // 0x208fbe0
@@ -21604,8 +21604,8 @@ void Gambit_fn_0208FB58(CPUState* cpu) {
   L_0208FC04: ; // 0x208fc04
         /* 0208FC04 */ _t26 = cpu->r[28] + 0x0000000Fu;
         /* 0208FC04 */ cpu->r[27] = rbrew_read8(cpu->mem, _t26);
-        /* 0208FC08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0208FC0C */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FC08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0208FC0C */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FC0C */ _t28 = _t27 & 0x00000001u;
         /* 0208FC0C */ if (_t28) goto L_0208FC50; else goto L_0208FC10;
   L_0208FC10: ; // 0x208fc10
@@ -21620,16 +21620,16 @@ void Gambit_fn_0208FB58(CPUState* cpu) {
         /* 0208FC24 */ cpu->r[5] = 0x00000004u;
         /* 0208FC28 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 0208FC2C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208FC30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0208FC30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0208FC34 */ cpu->r[11] = cpu->r[27];
-        /* 0208FC38 */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208FC38 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208FC38 */ _t33 = _t32 & 0x00000001u;
         /* 0208FC38 */ if (_t33) goto L_0208FC40; else goto L_0208FC3C;
   L_0208FC3C: ; // 0x208fc3c
         /* 0208FC3C */ cpu->r[11] = 0x00000001u;
   L_0208FC40: ; // 0x208fc40
-        /* 0208FC40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208FC44 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FC40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208FC44 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FC44 */ _t35 = _t34 & 0x00000001u;
         /* 0208FC44 */ if (_t35) goto L_0208FC50; else goto L_0208FC48;
   L_0208FC48: ; // 0x208fc48
@@ -21641,9 +21641,9 @@ void Gambit_fn_0208FB58(CPUState* cpu) {
         /* 0208FC50 */ _t38 = cpu->r[28] + 0x00000028u;
         /* 0208FC50 */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 0208FC54 */ cpu->r[0] = 0x00000000u;
-        /* 0208FC58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 0208FC58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 0208FC5C */ cpu->r[12] = cpu->r[0];
-        /* 0208FC60 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208FC60 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208FC60 */ _t40 = _t39 & 0x00000001u;
         /* 0208FC60 */ if (_t40) goto L_0208FC64; else goto L_0208FC88;
   L_0208FC64: ; // 0x208fc64
@@ -21668,8 +21668,8 @@ void Gambit_fn_0208FB58(CPUState* cpu) {
   L_0208FC88: ; // 0x208fc88
         /* 0208FC88 */ _t48 = cpu->r[28] + 0x0000000Fu;
         /* 0208FC88 */ cpu->r[27] = rbrew_read8(cpu->mem, _t48);
-        /* 0208FC8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0208FC90 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FC8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0208FC90 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FC90 */ _t50 = _t49 & 0x00000001u;
         /* 0208FC90 */ if (_t50) goto L_0208FCD4; else goto L_0208FC94;
   L_0208FC94: ; // 0x208fc94
@@ -21684,16 +21684,16 @@ void Gambit_fn_0208FB58(CPUState* cpu) {
         /* 0208FCA8 */ cpu->r[5] = 0x00000004u;
         /* 0208FCAC */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 0208FCB0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0208FCB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0208FCB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0208FCB8 */ cpu->r[10] = cpu->r[27];
-        /* 0208FCBC */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208FCBC */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208FCBC */ _t55 = _t54 & 0x00000001u;
         /* 0208FCBC */ if (_t55) goto L_0208FCC4; else goto L_0208FCC0;
   L_0208FCC0: ; // 0x208fcc0
         /* 0208FCC0 */ cpu->r[10] = 0x00000001u;
   L_0208FCC4: ; // 0x208fcc4
-        /* 0208FCC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208FCC8 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FCC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208FCC8 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FCC8 */ _t57 = _t56 & 0x00000001u;
         /* 0208FCC8 */ if (_t57) goto L_0208FCD4; else goto L_0208FCCC;
   L_0208FCCC: ; // 0x208fccc
@@ -21705,9 +21705,9 @@ void Gambit_fn_0208FB58(CPUState* cpu) {
         /* 0208FCD4 */ _t60 = cpu->r[28] + 0x00000030u;
         /* 0208FCD4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
         /* 0208FCD8 */ cpu->r[0] = 0x00000000u;
-        /* 0208FCDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0208FCDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0208FCE0 */ cpu->r[5] = cpu->r[0];
-        /* 0208FCE4 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208FCE4 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208FCE4 */ _t62 = _t61 & 0x00000001u;
         /* 0208FCE4 */ if (_t62) goto L_0208FCE8; else goto L_0208FD0C;
   L_0208FCE8: ; // 0x208fce8
@@ -21732,8 +21732,8 @@ void Gambit_fn_0208FB58(CPUState* cpu) {
   L_0208FD0C: ; // 0x208fd0c
         /* 0208FD0C */ _t70 = cpu->r[30] + 0x00000000u;
         /* 0208FD0C */ cpu->r[25] = rbrew_read8(cpu->mem, _t70);
-        /* 0208FD10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 0208FD14 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FD10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 0208FD14 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FD14 */ _t72 = _t71 & 0x00000001u;
         /* 0208FD14 */ if (_t72) goto L_0208FDF0; else goto L_0208FD18;
   L_0208FD18: ; // 0x208fd18
@@ -21749,10 +21749,10 @@ void Gambit_fn_0208FB58(CPUState* cpu) {
         /* 0208FD30 */ cpu->r[4] = (uint32_t)((int32_t)cpu->r[25] * (int32_t)0x00000024u);
         /* 0208FD34 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208FD38 */ cpu->r[24] = cpu->r[3];
-        /* 0208FD3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 0208FD3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 0208FD40 */ cpu->r[30] = cpu->r[25];
         /* 0208FD44 */ cpu->r[7] = 0x00000000u;
-        /* 0208FD48 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0208FD48 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0208FD48 */ _t77 = _t76 & 0x00000001u;
         /* 0208FD48 */ if (_t77) goto L_0208FD50; else goto L_0208FD4C;
   L_0208FD4C: ; // 0x208fd4c
@@ -21765,36 +21765,36 @@ void Gambit_fn_0208FB58(CPUState* cpu) {
         /* 0208FD5C */ cpu->r[23] = 0x00000018u;
   L_0208FD60: ; // 0x208fd60
         /* 0208FD60 */ cpu->r[27] = cpu->r[24] + cpu->r[22];
-        /* 0208FD60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0208FD64 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FD60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0208FD64 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FD64 */ _t80 = _t79 & 0x00000001u;
         /* 0208FD64 */ if (_t80) goto L_0208FDD4; else goto L_0208FD68;
   L_0208FD68: ; // 0x208fd68
         /* 0208FD68 */ cpu->r[26] = cpu->r[27];
-        /* 0208FD68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0208FD6C */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FD68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0208FD6C */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FD6C */ _t82 = _t81 & 0x00000001u;
         /* 0208FD6C */ if (_t82) goto L_0208FD70; else goto L_0208FD80;
   L_0208FD70: ; // 0x208fd70
         /* 0208FD70 */ cpu->r[3] = 0x00000024u;
         /* 0208FD74 */ Gambit_fn_02801A78(cpu);
         /* 0208FD78 */ cpu->r[26] = cpu->r[3];
-        /* 0208FD78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0208FD7C */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FD78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0208FD7C */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FD7C */ _t84 = _t83 & 0x00000001u;
         /* 0208FD7C */ if (_t84) goto L_0208FDC8; else goto L_0208FD80;
   L_0208FD80: ; // 0x208fd80
         /* 0208FD80 */ cpu->r[11] = cpu->r[26];
-        /* 0208FD80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0208FD84 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FD80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0208FD84 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FD84 */ _t86 = _t85 & 0x00000001u;
         /* 0208FD84 */ if (_t86) goto L_0208FD88; else goto L_0208FD98;
   L_0208FD88: ; // 0x208fd88
         /* 0208FD88 */ cpu->r[3] = 0x0000000Cu;
         /* 0208FD8C */ Gambit_fn_02801A78(cpu);
         /* 0208FD90 */ cpu->r[11] = cpu->r[3];
-        /* 0208FD90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0208FD94 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FD90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0208FD94 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FD94 */ _t88 = _t87 & 0x00000001u;
         /* 0208FD94 */ if (_t88) goto L_0208FDB4; else goto L_0208FD98;
   L_0208FD98: ; // 0x208fd98
@@ -21825,14 +21825,14 @@ void Gambit_fn_0208FB58(CPUState* cpu) {
         /* 0208FDD0 */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
   L_0208FDD4: ; // 0x208fdd4
         /* 0208FDD4 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 0208FDD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0208FDD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0208FDD8 */ cpu->r[22] = cpu->r[22] + 0x00000024u;
-        /* 0208FDDC */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FDDC */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FDDC */ _t98 = _t97 & 0x00000001u;
         /* 0208FDDC */ if (_t98) goto L_0208FDE0; else goto L_0208FD60;
   L_0208FDE0: ; // 0x208fde0
-        /* 0208FDE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 0208FDE4 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FDE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 0208FDE4 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FDE4 */ _t100 = _t99 & 0x00000001u;
         /* 0208FDE4 */ if (_t100) goto L_0208FDF0; else goto L_0208FDE8;
   L_0208FDE8: ; // 0x208fde8
@@ -21862,10 +21862,10 @@ void Gambit_fn_0208FE08(CPUState* cpu) {
         /* 0208FE0C */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 0208FE10 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 0208FE10 */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 0208FE14 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[12]);
+        /* 0208FE14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[12]));
         /* 0208FE18 */ _t3 = cpu->r[4] + 0x00000000u;
         /* 0208FE18 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 0208FE1C */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208FE1C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208FE1C */ _t5 = _t4 & 0x00000001u;
         /* 0208FE1C */ if (_t5) goto L_0208FE20; else goto L_0208FE28;
   L_0208FE20: ; // 0x208fe20
@@ -21882,10 +21882,10 @@ void Gambit_fn_0208FE08(CPUState* cpu) {
         /* 0208FE34 */ cpu->r[9] = rbrew_read8(cpu->mem, _t9);
         /* 0208FE38 */ _t10 = cpu->r[3] + 0x00000028u;
         /* 0208FE38 */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 0208FE3C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
+        /* 0208FE3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
         /* 0208FE40 */ _t11 = cpu->r[3] + 0x0000002Cu;
         /* 0208FE40 */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
-        /* 0208FE44 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208FE44 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208FE44 */ _t13 = _t12 & 0x00000001u;
         /* 0208FE44 */ if (_t13) goto L_0208FE48; else goto L_0208FE50;
   L_0208FE48: ; // 0x208fe48
@@ -21906,10 +21906,10 @@ void Gambit_fn_0208FE08(CPUState* cpu) {
         /* 0208FE64 */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
         /* 0208FE68 */ _t20 = cpu->r[3] + 0x00000034u;
         /* 0208FE68 */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 0208FE6C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
+        /* 0208FE6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
         /* 0208FE70 */ _t21 = cpu->r[6] + 0x00000000u;
         /* 0208FE70 */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
-        /* 0208FE74 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208FE74 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208FE74 */ _t23 = _t22 & 0x00000001u;
         /* 0208FE74 */ if (_t23) goto L_0208FE78; else goto L_0208FE80;
   L_0208FE78: ; // 0x208fe78
@@ -21936,10 +21936,10 @@ void Gambit_fn_0208FE90(CPUState* cpu) {
         /* 0208FE98 */ _t1 = cpu->r[3] + 0x00000020u;
         /* 0208FE98 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 0208FE9C */ cpu->r[8] = cpu->r[0];
-        /* 0208FEA0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 0208FEA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 0208FEA4 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 0208FEA4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0208FEA8 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208FEA8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208FEA8 */ _t4 = _t3 & 0x00000001u;
         /* 0208FEA8 */ if (_t4) goto L_0208FEAC; else goto L_0208FEC4;
   L_0208FEAC: ; // 0x208feac
@@ -21947,8 +21947,8 @@ void Gambit_fn_0208FE90(CPUState* cpu) {
         /* 0208FEB0 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 0208FEB4 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0208FEB4 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0208FEB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0208FEBC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FEB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0208FEBC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FEBC */ _t7 = _t6 & 0x00000001u;
         /* 0208FEBC */ if (_t7) goto L_0208FEC0; else goto L_0208FED0;
   L_0208FEC0: ; // 0x208fec0
@@ -21956,16 +21956,16 @@ void Gambit_fn_0208FE90(CPUState* cpu) {
   L_0208FEC4: ; // 0x208fec4
         /* 0208FEC4 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0208FEC4 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0208FEC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0208FECC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FEC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0208FECC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FECC */ _t10 = _t9 & 0x00000001u;
         /* 0208FECC */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208FECC */ goto L_0208FED0;
   L_0208FED0: ; // 0x208fed0
-        /* 0208FED0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 0208FED0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 0208FED4 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0208FED4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 0208FED8 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208FED8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208FED8 */ _t13 = _t12 & 0x00000001u;
         /* 0208FED8 */ if (_t13) goto L_0208FEDC; else goto L_0208FEE4;
   L_0208FEDC: ; // 0x208fedc
@@ -21976,11 +21976,11 @@ void Gambit_fn_0208FE90(CPUState* cpu) {
         /* 0208FEE4 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0208FEE8 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0208FEE8 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0208FEEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208FEEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208FEF0 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0208FEF0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0208FEF4 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 0208FEF8 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208FEF8 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208FEF8 */ _t18 = _t17 & 0x00000001u;
         /* 0208FEF8 */ if (_t18) goto L_0208FF10; else goto L_0208FEFC;
   L_0208FEFC: ; // 0x208fefc
@@ -22007,10 +22007,10 @@ void Gambit_fn_0208FF18(CPUState* cpu) {
         /* 0208FF20 */ _t1 = cpu->r[3] + 0x00000030u;
         /* 0208FF20 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 0208FF24 */ cpu->r[7] = cpu->r[0];
-        /* 0208FF28 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 0208FF28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 0208FF2C */ _t2 = cpu->r[3] + 0x00000034u;
         /* 0208FF2C */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0208FF30 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208FF30 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208FF30 */ _t4 = _t3 & 0x00000001u;
         /* 0208FF30 */ if (_t4) goto L_0208FF34; else goto L_0208FF4C;
   L_0208FF34: ; // 0x208ff34
@@ -22018,8 +22018,8 @@ void Gambit_fn_0208FF18(CPUState* cpu) {
         /* 0208FF38 */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 0208FF3C */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0208FF3C */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0208FF40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0208FF44 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FF40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0208FF44 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FF44 */ _t7 = _t6 & 0x00000001u;
         /* 0208FF44 */ if (_t7) goto L_0208FF48; else goto L_0208FF58;
   L_0208FF48: ; // 0x208ff48
@@ -22027,16 +22027,16 @@ void Gambit_fn_0208FF18(CPUState* cpu) {
   L_0208FF4C: ; // 0x208ff4c
         /* 0208FF4C */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0208FF4C */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0208FF50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0208FF54 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FF50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0208FF54 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FF54 */ _t10 = _t9 & 0x00000001u;
         /* 0208FF54 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0208FF54 */ goto L_0208FF58;
   L_0208FF58: ; // 0x208ff58
-        /* 0208FF58 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 0208FF58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 0208FF5C */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0208FF5C */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 0208FF60 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208FF60 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208FF60 */ _t13 = _t12 & 0x00000001u;
         /* 0208FF60 */ if (_t13) goto L_0208FF64; else goto L_0208FF6C;
   L_0208FF64: ; // 0x208ff64
@@ -22047,11 +22047,11 @@ void Gambit_fn_0208FF18(CPUState* cpu) {
         /* 0208FF6C */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0208FF70 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0208FF70 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0208FF74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0208FF74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0208FF78 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0208FF78 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0208FF7C */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 0208FF80 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0208FF80 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0208FF80 */ _t18 = _t17 & 0x00000001u;
         /* 0208FF80 */ if (_t18) goto L_0208FF98; else goto L_0208FF84;
   L_0208FF84: ; // 0x208ff84
@@ -22086,9 +22086,9 @@ void Gambit_fn_0208FFA0(CPUState* cpu) {
         /* 0208FFB8 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 0208FFB8 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 0208FFBC */ /* nop */
-        /* 0208FFC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 0208FFC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 0208FFC4 */ cpu->r[31] = cpu->r[4];
-        /* 0208FFC8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FFC8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FFC8 */ _t6 = _t5 & 0x00000001u;
         /* 0208FFC8 */ if (_t6) goto L_0208FFCC; else goto L_0208FFE0;
   L_0208FFCC: ; // 0x208ffcc
@@ -22137,9 +22137,9 @@ void Gambit_fn_0208FFA4(CPUState* cpu) {
         /* 0208FFB8 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 0208FFB8 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 0208FFBC */ /* nop */
-        /* 0208FFC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 0208FFC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 0208FFC4 */ cpu->r[31] = cpu->r[4];
-        /* 0208FFC8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FFC8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FFC8 */ _t6 = _t5 & 0x00000001u;
         /* 0208FFC8 */ if (_t6) goto L_0208FFCC; else goto L_0208FFE0;
   L_0208FFCC: ; // 0x208ffcc
@@ -22223,10 +22223,10 @@ void Gambit_fn_02090018(CPUState* cpu) {
         /* 02090020 */ _t1 = cpu->r[3] + 0x00000020u;
         /* 02090020 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 02090024 */ cpu->r[8] = cpu->r[0];
-        /* 02090028 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 02090028 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 0209002C */ _t2 = cpu->r[3] + 0x00000024u;
         /* 0209002C */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 02090030 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090030 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090030 */ _t4 = _t3 & 0x00000001u;
         /* 02090030 */ if (_t4) goto L_02090034; else goto L_0209004C;
   L_02090034: ; // 0x2090034
@@ -22234,8 +22234,8 @@ void Gambit_fn_02090018(CPUState* cpu) {
         /* 02090038 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 0209003C */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0209003C */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 02090040 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02090044 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090040 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02090044 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090044 */ _t7 = _t6 & 0x00000001u;
         /* 02090044 */ if (_t7) goto L_02090048; else goto L_02090058;
   L_02090048: ; // 0x2090048
@@ -22243,16 +22243,16 @@ void Gambit_fn_02090018(CPUState* cpu) {
   L_0209004C: ; // 0x209004c
         /* 0209004C */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0209004C */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 02090050 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02090054 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090050 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02090054 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090054 */ _t10 = _t9 & 0x00000001u;
         /* 02090054 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02090054 */ goto L_02090058;
   L_02090058: ; // 0x2090058
-        /* 02090058 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 02090058 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 0209005C */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0209005C */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 02090060 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090060 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090060 */ _t13 = _t12 & 0x00000001u;
         /* 02090060 */ if (_t13) goto L_02090064; else goto L_0209006C;
   L_02090064: ; // 0x2090064
@@ -22263,11 +22263,11 @@ void Gambit_fn_02090018(CPUState* cpu) {
         /* 0209006C */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 02090070 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 02090070 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 02090074 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02090074 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02090078 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 02090078 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0209007C */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 02090080 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090080 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090080 */ _t18 = _t17 & 0x00000001u;
         /* 02090080 */ if (_t18) goto L_02090098; else goto L_02090084;
   L_02090084: ; // 0x2090084
@@ -22294,10 +22294,10 @@ void Gambit_fn_020900A0(CPUState* cpu) {
         /* 020900A8 */ _t1 = cpu->r[3] + 0x00000028u;
         /* 020900A8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 020900AC */ cpu->r[8] = cpu->r[0];
-        /* 020900B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 020900B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 020900B4 */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 020900B4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 020900B8 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020900B8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020900B8 */ _t4 = _t3 & 0x00000001u;
         /* 020900B8 */ if (_t4) goto L_020900BC; else goto L_020900D4;
   L_020900BC: ; // 0x20900bc
@@ -22305,8 +22305,8 @@ void Gambit_fn_020900A0(CPUState* cpu) {
         /* 020900C0 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 020900C4 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 020900C4 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 020900C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020900CC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020900C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020900CC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020900CC */ _t7 = _t6 & 0x00000001u;
         /* 020900CC */ if (_t7) goto L_020900D0; else goto L_020900E0;
   L_020900D0: ; // 0x20900d0
@@ -22314,16 +22314,16 @@ void Gambit_fn_020900A0(CPUState* cpu) {
   L_020900D4: ; // 0x20900d4
         /* 020900D4 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 020900D4 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 020900D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020900DC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020900D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020900DC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020900DC */ _t10 = _t9 & 0x00000001u;
         /* 020900DC */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020900DC */ goto L_020900E0;
   L_020900E0: ; // 0x20900e0
-        /* 020900E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 020900E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 020900E4 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 020900E4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 020900E8 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020900E8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020900E8 */ _t13 = _t12 & 0x00000001u;
         /* 020900E8 */ if (_t13) goto L_020900EC; else goto L_020900F4;
   L_020900EC: ; // 0x20900ec
@@ -22334,11 +22334,11 @@ void Gambit_fn_020900A0(CPUState* cpu) {
         /* 020900F4 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 020900F8 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 020900F8 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 020900FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020900FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02090100 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 02090100 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 02090104 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 02090108 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090108 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090108 */ _t18 = _t17 & 0x00000001u;
         /* 02090108 */ if (_t18) goto L_02090120; else goto L_0209010C;
   L_0209010C: ; // 0x209010c
@@ -22362,7 +22362,7 @@ void Gambit_fn_02090100(CPUState* cpu) {
         /* 02090100 */ _t0 = cpu->r[12] + 0x00000004u;
         /* 02090100 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 02090104 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 02090108 */ _t1 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090108 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090108 */ _t2 = _t1 & 0x00000001u;
         /* 02090108 */ if (_t2) goto L_02090120; else goto L_0209010C;
   L_0209010C: ; // 0x209010c
@@ -22383,7 +22383,7 @@ void Gambit_fn_02090108(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3;
 
   L_02090108: ; // 0x2090108
-        /* 02090108 */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090108 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090108 */ _t1 = _t0 & 0x00000001u;
         /* 02090108 */ if (_t1) goto L_02090120; else goto L_0209010C;
   L_0209010C: ; // 0x209010c
@@ -22416,18 +22416,18 @@ void Gambit_fn_02090128(CPUState* cpu) {
         /* 0209013C */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0209013C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02090140 */ cpu->r[12] = 0x00000000u;
-        /* 02090144 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02090144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02090148 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 02090148 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0209014C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209014C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209014C */ _t6 = _t5 & 0x00000001u;
         /* 0209014C */ if (_t6) goto L_02090174; else goto L_02090150;
   L_02090150: ; // 0x2090150
         /* 02090150 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02090150 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02090154 */ /* nop */
-        /* 02090158 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0209015C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0209015C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209015C */ _t9 = _t8 & 0x00000001u;
         /* 0209015C */ if (_t9) goto L_02090160; else goto L_02090174;
   L_02090160: ; // 0x2090160
@@ -22468,18 +22468,18 @@ void Gambit_fn_0209012C(CPUState* cpu) {
         /* 0209013C */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0209013C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02090140 */ cpu->r[12] = 0x00000000u;
-        /* 02090144 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02090144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02090148 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 02090148 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0209014C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209014C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209014C */ _t6 = _t5 & 0x00000001u;
         /* 0209014C */ if (_t6) goto L_02090174; else goto L_02090150;
   L_02090150: ; // 0x2090150
         /* 02090150 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02090150 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02090154 */ /* nop */
-        /* 02090158 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0209015C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0209015C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209015C */ _t9 = _t8 & 0x00000001u;
         /* 0209015C */ if (_t9) goto L_02090160; else goto L_02090174;
   L_02090160: ; // 0x2090160
@@ -22515,10 +22515,10 @@ void Gambit_fn_02090198(CPUState* cpu) {
         /* 020901A0 */ _t1 = cpu->r[3] + 0x00000030u;
         /* 020901A0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 020901A4 */ cpu->r[7] = cpu->r[0];
-        /* 020901A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 020901A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 020901AC */ _t2 = cpu->r[3] + 0x00000034u;
         /* 020901AC */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 020901B0 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020901B0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020901B0 */ _t4 = _t3 & 0x00000001u;
         /* 020901B0 */ if (_t4) goto L_020901B4; else goto L_020901CC;
   L_020901B4: ; // 0x20901b4
@@ -22526,8 +22526,8 @@ void Gambit_fn_02090198(CPUState* cpu) {
         /* 020901B8 */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 020901BC */ _t5 = cpu->r[9] + 0x00000002u;
         /* 020901BC */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 020901C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020901C4 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020901C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020901C4 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020901C4 */ _t7 = _t6 & 0x00000001u;
         /* 020901C4 */ if (_t7) goto L_020901C8; else goto L_020901D8;
   L_020901C8: ; // 0x20901c8
@@ -22535,16 +22535,16 @@ void Gambit_fn_02090198(CPUState* cpu) {
   L_020901CC: ; // 0x20901cc
         /* 020901CC */ _t8 = cpu->r[12] + 0x00000002u;
         /* 020901CC */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 020901D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020901D4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020901D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020901D4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020901D4 */ _t10 = _t9 & 0x00000001u;
         /* 020901D4 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020901D4 */ goto L_020901D8;
   L_020901D8: ; // 0x20901d8
-        /* 020901D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 020901D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 020901DC */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 020901DC */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 020901E0 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020901E0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020901E0 */ _t13 = _t12 & 0x00000001u;
         /* 020901E0 */ if (_t13) goto L_020901E4; else goto L_020901EC;
   L_020901E4: ; // 0x20901e4
@@ -22555,11 +22555,11 @@ void Gambit_fn_02090198(CPUState* cpu) {
         /* 020901EC */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 020901F0 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 020901F0 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 020901F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 020901F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 020901F8 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 020901F8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 020901FC */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 02090200 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090200 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090200 */ _t18 = _t17 & 0x00000001u;
         /* 02090200 */ if (_t18) goto L_02090218; else goto L_02090204;
   L_02090204: ; // 0x2090204
@@ -22580,7 +22580,7 @@ void Gambit_fn_02090200(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3;
 
   L_02090200: ; // 0x2090200
-        /* 02090200 */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090200 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090200 */ _t1 = _t0 & 0x00000001u;
         /* 02090200 */ if (_t1) goto L_02090218; else goto L_02090204;
   L_02090204: ; // 0x2090204
@@ -22630,9 +22630,9 @@ void Gambit_fn_02090220(CPUState* cpu) {
         /* 02090238 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 02090238 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 0209023C */ /* nop */
-        /* 02090240 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 02090240 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 02090244 */ cpu->r[31] = cpu->r[4];
-        /* 02090248 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090248 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090248 */ _t6 = _t5 & 0x00000001u;
         /* 02090248 */ if (_t6) goto L_0209024C; else goto L_02090260;
   L_0209024C: ; // 0x209024c
@@ -22681,9 +22681,9 @@ void Gambit_fn_02090224(CPUState* cpu) {
         /* 02090238 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 02090238 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 0209023C */ /* nop */
-        /* 02090240 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 02090240 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 02090244 */ cpu->r[31] = cpu->r[4];
-        /* 02090248 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090248 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090248 */ _t6 = _t5 & 0x00000001u;
         /* 02090248 */ if (_t6) goto L_0209024C; else goto L_02090260;
   L_0209024C: ; // 0x209024c
@@ -22731,11 +22731,11 @@ void Gambit_fn_02090298(CPUState* cpu) {
         /* 02091110 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02091110 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02091114 */ cpu->r[30] = cpu->r[3];
-        /* 02091114 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02091114 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02091118 */ cpu->r[31] = cpu->r[4];
         /* 0209111C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209111C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02091120 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091120 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091120 */ _t5 = _t4 & 0x00000001u;
         /* 02091120 */ if (_t5) goto L_02091164; else goto L_02091124;
   L_02091124: ; // 0x2091124
@@ -22755,8 +22755,8 @@ void Gambit_fn_02090298(CPUState* cpu) {
         /* 0209114C */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 02091150 */ Gambit_fn_02068798(cpu);
         /* 02091154 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02091154 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02091158 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091154 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02091158 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091158 */ _t10 = _t9 & 0x00000001u;
         /* 02091158 */ if (_t10) goto L_02091164; else goto L_0209115C;
   L_0209115C: ; // 0x209115c
@@ -22784,8 +22784,8 @@ void Gambit_fn_020902A0(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -22835,18 +22835,18 @@ void Gambit_fn_020902B8(CPUState* cpu) {
         /* 020902BC */ /* nop */
         /* 020902C0 */ cpu->r[0] = cpu->lr;
         /* 020902C4 */ cpu->r[30] = cpu->r[3];
-        /* 020902C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020902C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020902C8 */ _t1 = cpu->r[1] + 0x00000054u;
         /* 020902C8 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
-        /* 020902CC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020902CC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020902CC */ _t3 = _t2 & 0x00000001u;
         /* 020902CC */ if (_t3) goto L_020902D0; else goto L_020902E0;
   L_020902D0: ; // 0x20902d0
         /* 020902D0 */ cpu->r[3] = 0x00000244u;
         /* 020902D4 */ Gambit_fn_02801A78(cpu);
         /* 020902D8 */ cpu->r[30] = cpu->r[3];
-        /* 020902D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 020902DC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020902D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 020902DC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020902DC */ _t5 = _t4 & 0x00000001u;
         /* 020902DC */ if (_t5) goto L_020907EC; else goto L_020902E0;
   L_020902E0: ; // 0x20902e0
@@ -22874,7 +22874,7 @@ void Gambit_fn_020902B8(CPUState* cpu) {
         /* 02090328 */ _t9 = cpu->r[30] + 0x0000000Cu;
         /* 02090328 */ rbrew_write32(cpu->mem, _t9, cpu->r[10]);
         /* 0209032C */ cpu->r[27] = cpu->r[30] + 0x000001DCu;
-        /* 0209032C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0209032C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02090330 */ cpu->r[12] = cpu->r[12] + 0xFFFFE5ECu;
         /* 02090334 */ _t10 = cpu->r[30] + 0x0000001Cu;
         /* 02090334 */ rbrew_write32(cpu->mem, _t10, cpu->r[11]);
@@ -22882,15 +22882,15 @@ void Gambit_fn_020902B8(CPUState* cpu) {
         /* 0209033C */ cpu->r[28] = 0x00000000u;
         /* 02090340 */ _t11 = cpu->r[30] + 0x000001C8u;
         /* 02090340 */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
-        /* 02090344 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090344 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090344 */ _t13 = _t12 & 0x00000001u;
         /* 02090344 */ if (_t13) goto L_02090348; else goto L_02090358;
   L_02090348: ; // 0x2090348
         /* 02090348 */ cpu->r[3] = 0x00000038u;
         /* 0209034C */ Gambit_fn_02801A78(cpu);
         /* 02090350 */ cpu->r[31] = cpu->r[3];
-        /* 02090350 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02090354 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090350 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02090354 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090354 */ _t15 = _t14 & 0x00000001u;
         /* 02090354 */ if (_t15) goto L_02090388; else goto L_02090358;
   L_02090358: ; // 0x2090358
@@ -22957,23 +22957,23 @@ void Gambit_fn_020902B8(CPUState* cpu) {
         /* 020903F4 */ _t36 = cpu->r[11] + 0x00000000u;
         /* 020903F4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t36);
         /* 020903F8 */ cpu->r[31] = 0x00000000u;
-        /* 020903FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[29]);
+        /* 020903FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[29]));
         /* 02090400 */ cpu->r[0] = 0x00080000u;
-        /* 02090404 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090404 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090404 */ _t38 = _t37 & 0x00000001u;
         /* 02090404 */ if (_t38) goto L_0209042C; else goto L_02090408;
   L_02090408: ; // 0x2090408
         /* 02090408 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0209040C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 0209040C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 02090410 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 02090414 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02090414 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02090414 */ _t40 = _t39 & 0x00000001u;
         /* 02090414 */ if (_t40) goto L_02090428; else goto L_02090418;
   L_02090418: ; // 0x2090418
         /* 02090418 */ _t41 = cpu->r[11] + 0x00000000u;
         /* 02090418 */ cpu->r[9] = rbrew_read8(cpu->mem, _t41);
-        /* 0209041C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[29]);
-        /* 02090420 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209041C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[29]));
+        /* 02090420 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090420 */ _t43 = _t42 & 0x00000001u;
         /* 02090420 */ if (_t43) goto L_02090424; else goto L_02090408;
   L_02090424: ; // 0x2090424
@@ -22985,10 +22985,10 @@ void Gambit_fn_020902B8(CPUState* cpu) {
         /* 0209042C */ cpu->r[7] = rbrew_read32(cpu->mem, _t44);
         /* 02090430 */ _t45 = cpu->r[1] + 0x00000010u;
         /* 02090430 */ cpu->r[10] = rbrew_read32(cpu->mem, _t45);
-        /* 02090434 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 02090434 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 02090438 */ _t46 = cpu->r[10] + 0x00000014u;
         /* 02090438 */ cpu->r[11] = rbrew_read32(cpu->mem, _t46);
-        /* 0209043C */ _t47 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209043C */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209043C */ _t48 = _t47 & 0x00000001u;
         /* 0209043C */ if (_t48) goto L_02090444; else goto L_02090440;
   L_02090440: ; // 0x2090440
@@ -23043,10 +23043,10 @@ void Gambit_fn_020902B8(CPUState* cpu) {
         /* 020904C4 */ rbrew_write32(cpu->mem, _t62, cpu->r[0]);
         /* 020904C8 */ _t63 = cpu->r[27] + 0x00000014u;
         /* 020904C8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t63);
-        /* 020904CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x00000001u);
+        /* 020904CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x00000001u));
         /* 020904D0 */ _t64 = cpu->r[27] + 0x00000018u;
         /* 020904D0 */ cpu->r[24] = rbrew_read32(cpu->mem, _t64);
-        /* 020904D4 */ _t65 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020904D4 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020904D4 */ _t66 = _t65 & 0x00000001u;
         /* 020904D4 */ if (_t66) goto L_020904D8; else goto L_020904DC;
   L_020904D8: ; // 0x20904d8
@@ -23062,23 +23062,23 @@ void Gambit_fn_020902B8(CPUState* cpu) {
         /* 020904F0 */ _t69 = cpu->r[7] + 0x00000000u;
         /* 020904F0 */ cpu->r[6] = rbrew_read8(cpu->mem, _t69);
         /* 020904F4 */ cpu->r[31] = 0x00000000u;
-        /* 020904F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[29]);
+        /* 020904F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[29]));
         /* 020904FC */ cpu->r[9] = 0x00080000u;
-        /* 02090500 */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090500 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090500 */ _t71 = _t70 & 0x00000001u;
         /* 02090500 */ if (_t71) goto L_02090528; else goto L_02090504;
   L_02090504: ; // 0x2090504
         /* 02090504 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02090508 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 02090508 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 0209050C */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02090510 */ _t72 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02090510 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02090510 */ _t73 = _t72 & 0x00000001u;
         /* 02090510 */ if (_t73) goto L_02090524; else goto L_02090514;
   L_02090514: ; // 0x2090514
         /* 02090514 */ _t74 = cpu->r[7] + 0x00000000u;
         /* 02090514 */ cpu->r[8] = rbrew_read8(cpu->mem, _t74);
-        /* 02090518 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[29]);
-        /* 0209051C */ _t75 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090518 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[29]));
+        /* 0209051C */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209051C */ _t76 = _t75 & 0x00000001u;
         /* 0209051C */ if (_t76) goto L_02090520; else goto L_02090504;
   L_02090520: ; // 0x2090520
@@ -23090,10 +23090,10 @@ void Gambit_fn_020902B8(CPUState* cpu) {
         /* 02090528 */ cpu->r[9] = rbrew_read32(cpu->mem, _t77);
         /* 0209052C */ _t78 = cpu->r[1] + 0x00000010u;
         /* 0209052C */ cpu->r[11] = rbrew_read32(cpu->mem, _t78);
-        /* 02090530 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 02090530 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 02090534 */ _t79 = cpu->r[11] + 0x00000014u;
         /* 02090534 */ cpu->r[0] = rbrew_read32(cpu->mem, _t79);
-        /* 02090538 */ _t80 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090538 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090538 */ _t81 = _t80 & 0x00000001u;
         /* 02090538 */ if (_t81) goto L_02090540; else goto L_0209053C;
   L_0209053C: ; // 0x209053c
@@ -23148,10 +23148,10 @@ void Gambit_fn_020902B8(CPUState* cpu) {
         /* 020905C0 */ rbrew_write32(cpu->mem, _t95, cpu->r[10]);
         /* 020905C4 */ _t96 = cpu->r[27] + 0x00000014u;
         /* 020905C4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t96);
-        /* 020905C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000002u);
+        /* 020905C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000002u));
         /* 020905CC */ _t97 = cpu->r[27] + 0x00000018u;
         /* 020905CC */ cpu->r[24] = rbrew_read32(cpu->mem, _t97);
-        /* 020905D0 */ _t98 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020905D0 */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020905D0 */ _t99 = _t98 & 0x00000001u;
         /* 020905D0 */ if (_t99) goto L_020905D4; else goto L_020905D8;
   L_020905D4: ; // 0x20905d4
@@ -23167,23 +23167,23 @@ void Gambit_fn_020902B8(CPUState* cpu) {
         /* 020905EC */ _t102 = cpu->r[12] + 0x00000000u;
         /* 020905EC */ cpu->r[5] = rbrew_read8(cpu->mem, _t102);
         /* 020905F0 */ cpu->r[31] = 0x00000000u;
-        /* 020905F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[29]);
+        /* 020905F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[29]));
         /* 020905F8 */ cpu->r[0] = 0x00080000u;
-        /* 020905FC */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020905FC */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020905FC */ _t104 = _t103 & 0x00000001u;
         /* 020905FC */ if (_t104) goto L_02090624; else goto L_02090600;
   L_02090600: ; // 0x2090600
         /* 02090600 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02090604 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 02090604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 02090608 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 0209060C */ _t105 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209060C */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209060C */ _t106 = _t105 & 0x00000001u;
         /* 0209060C */ if (_t106) goto L_02090620; else goto L_02090610;
   L_02090610: ; // 0x2090610
         /* 02090610 */ _t107 = cpu->r[12] + 0x00000000u;
         /* 02090610 */ cpu->r[6] = rbrew_read8(cpu->mem, _t107);
-        /* 02090614 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[29]);
-        /* 02090618 */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090614 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[29]));
+        /* 02090618 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090618 */ _t109 = _t108 & 0x00000001u;
         /* 02090618 */ if (_t109) goto L_0209061C; else goto L_02090600;
   L_0209061C: ; // 0x209061c
@@ -23195,10 +23195,10 @@ void Gambit_fn_020902B8(CPUState* cpu) {
         /* 02090624 */ cpu->r[11] = rbrew_read32(cpu->mem, _t110);
         /* 02090628 */ _t111 = cpu->r[1] + 0x00000010u;
         /* 02090628 */ cpu->r[8] = rbrew_read32(cpu->mem, _t111);
-        /* 0209062C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 0209062C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 02090630 */ _t112 = cpu->r[8] + 0x00000014u;
         /* 02090630 */ cpu->r[10] = rbrew_read32(cpu->mem, _t112);
-        /* 02090634 */ _t113 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090634 */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090634 */ _t114 = _t113 & 0x00000001u;
         /* 02090634 */ if (_t114) goto L_0209063C; else goto L_02090638;
   L_02090638: ; // 0x2090638
@@ -23253,10 +23253,10 @@ void Gambit_fn_020902B8(CPUState* cpu) {
         /* 020906BC */ rbrew_write32(cpu->mem, _t128, cpu->r[5]);
         /* 020906C0 */ _t129 = cpu->r[27] + 0x00000014u;
         /* 020906C0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t129);
-        /* 020906C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 020906C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 020906C8 */ _t130 = cpu->r[27] + 0x00000018u;
         /* 020906C8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t130);
-        /* 020906CC */ _t131 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020906CC */ _t131 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020906CC */ _t132 = _t131 & 0x00000001u;
         /* 020906CC */ if (_t132) goto L_020906D0; else goto L_020906D4;
   L_020906D0: ; // 0x20906d0
@@ -23272,23 +23272,23 @@ void Gambit_fn_020902B8(CPUState* cpu) {
         /* 020906E8 */ _t135 = cpu->r[7] + 0x00000000u;
         /* 020906E8 */ cpu->r[8] = rbrew_read8(cpu->mem, _t135);
         /* 020906EC */ cpu->r[26] = 0x00000000u;
-        /* 020906F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[29]);
+        /* 020906F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[29]));
         /* 020906F4 */ cpu->r[9] = 0x00080000u;
-        /* 020906F8 */ _t136 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020906F8 */ _t136 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020906F8 */ _t137 = _t136 & 0x00000001u;
         /* 020906F8 */ if (_t137) goto L_02090720; else goto L_020906FC;
   L_020906FC: ; // 0x20906fc
         /* 020906FC */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 02090700 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[9]);
+        /* 02090700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[9]));
         /* 02090704 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02090708 */ _t138 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02090708 */ _t138 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02090708 */ _t139 = _t138 & 0x00000001u;
         /* 02090708 */ if (_t139) goto L_0209071C; else goto L_0209070C;
   L_0209070C: ; // 0x209070c
         /* 0209070C */ _t140 = cpu->r[7] + 0x00000000u;
         /* 0209070C */ cpu->r[10] = rbrew_read8(cpu->mem, _t140);
-        /* 02090710 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[29]);
-        /* 02090714 */ _t141 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[29]));
+        /* 02090714 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090714 */ _t142 = _t141 & 0x00000001u;
         /* 02090714 */ if (_t142) goto L_02090718; else goto L_020906FC;
   L_02090718: ; // 0x2090718
@@ -23300,10 +23300,10 @@ void Gambit_fn_020902B8(CPUState* cpu) {
         /* 02090720 */ cpu->r[5] = rbrew_read32(cpu->mem, _t143);
         /* 02090724 */ _t144 = cpu->r[1] + 0x00000010u;
         /* 02090724 */ cpu->r[12] = rbrew_read32(cpu->mem, _t144);
-        /* 02090728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[5]);
+        /* 02090728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[5]));
         /* 0209072C */ _t145 = cpu->r[12] + 0x00000014u;
         /* 0209072C */ cpu->r[6] = rbrew_read32(cpu->mem, _t145);
-        /* 02090730 */ _t146 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090730 */ _t146 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090730 */ _t147 = _t146 & 0x00000001u;
         /* 02090730 */ if (_t147) goto L_02090738; else goto L_02090734;
   L_02090734: ; // 0x2090734
@@ -23402,7 +23402,7 @@ void Gambit_fn_02090308(CPUState* cpu) {
         /* 02090328 */ _t1 = cpu->r[30] + 0x0000000Cu;
         /* 02090328 */ rbrew_write32(cpu->mem, _t1, cpu->r[10]);
         /* 0209032C */ cpu->r[27] = cpu->r[30] + 0x000001DCu;
-        /* 0209032C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0209032C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02090330 */ cpu->r[12] = cpu->r[12] + 0xFFFFE5ECu;
         /* 02090334 */ _t2 = cpu->r[30] + 0x0000001Cu;
         /* 02090334 */ rbrew_write32(cpu->mem, _t2, cpu->r[11]);
@@ -23410,15 +23410,15 @@ void Gambit_fn_02090308(CPUState* cpu) {
         /* 0209033C */ cpu->r[28] = 0x00000000u;
         /* 02090340 */ _t3 = cpu->r[30] + 0x000001C8u;
         /* 02090340 */ rbrew_write32(cpu->mem, _t3, cpu->r[12]);
-        /* 02090344 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090344 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090344 */ _t5 = _t4 & 0x00000001u;
         /* 02090344 */ if (_t5) goto L_02090348; else goto L_02090358;
   L_02090348: ; // 0x2090348
         /* 02090348 */ cpu->r[3] = 0x00000038u;
         /* 0209034C */ Gambit_fn_02801A78(cpu);
         /* 02090350 */ cpu->r[31] = cpu->r[3];
-        /* 02090350 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02090354 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090350 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02090354 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090354 */ _t7 = _t6 & 0x00000001u;
         /* 02090354 */ if (_t7) goto L_02090388; else goto L_02090358;
   L_02090358: ; // 0x2090358
@@ -23485,23 +23485,23 @@ void Gambit_fn_02090308(CPUState* cpu) {
         /* 020903F4 */ _t28 = cpu->r[11] + 0x00000000u;
         /* 020903F4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t28);
         /* 020903F8 */ cpu->r[31] = 0x00000000u;
-        /* 020903FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[29]);
+        /* 020903FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[29]));
         /* 02090400 */ cpu->r[0] = 0x00080000u;
-        /* 02090404 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090404 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090404 */ _t30 = _t29 & 0x00000001u;
         /* 02090404 */ if (_t30) goto L_0209042C; else goto L_02090408;
   L_02090408: ; // 0x2090408
         /* 02090408 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0209040C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 0209040C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 02090410 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 02090414 */ _t31 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02090414 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02090414 */ _t32 = _t31 & 0x00000001u;
         /* 02090414 */ if (_t32) goto L_02090428; else goto L_02090418;
   L_02090418: ; // 0x2090418
         /* 02090418 */ _t33 = cpu->r[11] + 0x00000000u;
         /* 02090418 */ cpu->r[9] = rbrew_read8(cpu->mem, _t33);
-        /* 0209041C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[29]);
-        /* 02090420 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209041C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[29]));
+        /* 02090420 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090420 */ _t35 = _t34 & 0x00000001u;
         /* 02090420 */ if (_t35) goto L_02090424; else goto L_02090408;
   L_02090424: ; // 0x2090424
@@ -23513,10 +23513,10 @@ void Gambit_fn_02090308(CPUState* cpu) {
         /* 0209042C */ cpu->r[7] = rbrew_read32(cpu->mem, _t36);
         /* 02090430 */ _t37 = cpu->r[1] + 0x00000010u;
         /* 02090430 */ cpu->r[10] = rbrew_read32(cpu->mem, _t37);
-        /* 02090434 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 02090434 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 02090438 */ _t38 = cpu->r[10] + 0x00000014u;
         /* 02090438 */ cpu->r[11] = rbrew_read32(cpu->mem, _t38);
-        /* 0209043C */ _t39 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209043C */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209043C */ _t40 = _t39 & 0x00000001u;
         /* 0209043C */ if (_t40) goto L_02090444; else goto L_02090440;
   L_02090440: ; // 0x2090440
@@ -23571,10 +23571,10 @@ void Gambit_fn_02090308(CPUState* cpu) {
         /* 020904C4 */ rbrew_write32(cpu->mem, _t54, cpu->r[0]);
         /* 020904C8 */ _t55 = cpu->r[27] + 0x00000014u;
         /* 020904C8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t55);
-        /* 020904CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x00000001u);
+        /* 020904CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x00000001u));
         /* 020904D0 */ _t56 = cpu->r[27] + 0x00000018u;
         /* 020904D0 */ cpu->r[24] = rbrew_read32(cpu->mem, _t56);
-        /* 020904D4 */ _t57 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020904D4 */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020904D4 */ _t58 = _t57 & 0x00000001u;
         /* 020904D4 */ if (_t58) goto L_020904D8; else goto L_020904DC;
   L_020904D8: ; // 0x20904d8
@@ -23590,23 +23590,23 @@ void Gambit_fn_02090308(CPUState* cpu) {
         /* 020904F0 */ _t61 = cpu->r[7] + 0x00000000u;
         /* 020904F0 */ cpu->r[6] = rbrew_read8(cpu->mem, _t61);
         /* 020904F4 */ cpu->r[31] = 0x00000000u;
-        /* 020904F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[29]);
+        /* 020904F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[29]));
         /* 020904FC */ cpu->r[9] = 0x00080000u;
-        /* 02090500 */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090500 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090500 */ _t63 = _t62 & 0x00000001u;
         /* 02090500 */ if (_t63) goto L_02090528; else goto L_02090504;
   L_02090504: ; // 0x2090504
         /* 02090504 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02090508 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 02090508 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 0209050C */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02090510 */ _t64 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02090510 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02090510 */ _t65 = _t64 & 0x00000001u;
         /* 02090510 */ if (_t65) goto L_02090524; else goto L_02090514;
   L_02090514: ; // 0x2090514
         /* 02090514 */ _t66 = cpu->r[7] + 0x00000000u;
         /* 02090514 */ cpu->r[8] = rbrew_read8(cpu->mem, _t66);
-        /* 02090518 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[29]);
-        /* 0209051C */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090518 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[29]));
+        /* 0209051C */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209051C */ _t68 = _t67 & 0x00000001u;
         /* 0209051C */ if (_t68) goto L_02090520; else goto L_02090504;
   L_02090520: ; // 0x2090520
@@ -23618,10 +23618,10 @@ void Gambit_fn_02090308(CPUState* cpu) {
         /* 02090528 */ cpu->r[9] = rbrew_read32(cpu->mem, _t69);
         /* 0209052C */ _t70 = cpu->r[1] + 0x00000010u;
         /* 0209052C */ cpu->r[11] = rbrew_read32(cpu->mem, _t70);
-        /* 02090530 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 02090530 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 02090534 */ _t71 = cpu->r[11] + 0x00000014u;
         /* 02090534 */ cpu->r[0] = rbrew_read32(cpu->mem, _t71);
-        /* 02090538 */ _t72 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090538 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090538 */ _t73 = _t72 & 0x00000001u;
         /* 02090538 */ if (_t73) goto L_02090540; else goto L_0209053C;
   L_0209053C: ; // 0x209053c
@@ -23676,10 +23676,10 @@ void Gambit_fn_02090308(CPUState* cpu) {
         /* 020905C0 */ rbrew_write32(cpu->mem, _t87, cpu->r[10]);
         /* 020905C4 */ _t88 = cpu->r[27] + 0x00000014u;
         /* 020905C4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t88);
-        /* 020905C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000002u);
+        /* 020905C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000002u));
         /* 020905CC */ _t89 = cpu->r[27] + 0x00000018u;
         /* 020905CC */ cpu->r[24] = rbrew_read32(cpu->mem, _t89);
-        /* 020905D0 */ _t90 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020905D0 */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020905D0 */ _t91 = _t90 & 0x00000001u;
         /* 020905D0 */ if (_t91) goto L_020905D4; else goto L_020905D8;
   L_020905D4: ; // 0x20905d4
@@ -23695,23 +23695,23 @@ void Gambit_fn_02090308(CPUState* cpu) {
         /* 020905EC */ _t94 = cpu->r[12] + 0x00000000u;
         /* 020905EC */ cpu->r[5] = rbrew_read8(cpu->mem, _t94);
         /* 020905F0 */ cpu->r[31] = 0x00000000u;
-        /* 020905F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[29]);
+        /* 020905F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[29]));
         /* 020905F8 */ cpu->r[0] = 0x00080000u;
-        /* 020905FC */ _t95 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020905FC */ _t95 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020905FC */ _t96 = _t95 & 0x00000001u;
         /* 020905FC */ if (_t96) goto L_02090624; else goto L_02090600;
   L_02090600: ; // 0x2090600
         /* 02090600 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02090604 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 02090604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 02090608 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 0209060C */ _t97 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209060C */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209060C */ _t98 = _t97 & 0x00000001u;
         /* 0209060C */ if (_t98) goto L_02090620; else goto L_02090610;
   L_02090610: ; // 0x2090610
         /* 02090610 */ _t99 = cpu->r[12] + 0x00000000u;
         /* 02090610 */ cpu->r[6] = rbrew_read8(cpu->mem, _t99);
-        /* 02090614 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[29]);
-        /* 02090618 */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090614 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[29]));
+        /* 02090618 */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090618 */ _t101 = _t100 & 0x00000001u;
         /* 02090618 */ if (_t101) goto L_0209061C; else goto L_02090600;
   L_0209061C: ; // 0x209061c
@@ -23723,10 +23723,10 @@ void Gambit_fn_02090308(CPUState* cpu) {
         /* 02090624 */ cpu->r[11] = rbrew_read32(cpu->mem, _t102);
         /* 02090628 */ _t103 = cpu->r[1] + 0x00000010u;
         /* 02090628 */ cpu->r[8] = rbrew_read32(cpu->mem, _t103);
-        /* 0209062C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 0209062C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 02090630 */ _t104 = cpu->r[8] + 0x00000014u;
         /* 02090630 */ cpu->r[10] = rbrew_read32(cpu->mem, _t104);
-        /* 02090634 */ _t105 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090634 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090634 */ _t106 = _t105 & 0x00000001u;
         /* 02090634 */ if (_t106) goto L_0209063C; else goto L_02090638;
   L_02090638: ; // 0x2090638
@@ -23781,10 +23781,10 @@ void Gambit_fn_02090308(CPUState* cpu) {
         /* 020906BC */ rbrew_write32(cpu->mem, _t120, cpu->r[5]);
         /* 020906C0 */ _t121 = cpu->r[27] + 0x00000014u;
         /* 020906C0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t121);
-        /* 020906C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 020906C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 020906C8 */ _t122 = cpu->r[27] + 0x00000018u;
         /* 020906C8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t122);
-        /* 020906CC */ _t123 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020906CC */ _t123 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020906CC */ _t124 = _t123 & 0x00000001u;
         /* 020906CC */ if (_t124) goto L_020906D0; else goto L_020906D4;
   L_020906D0: ; // 0x20906d0
@@ -23800,23 +23800,23 @@ void Gambit_fn_02090308(CPUState* cpu) {
         /* 020906E8 */ _t127 = cpu->r[7] + 0x00000000u;
         /* 020906E8 */ cpu->r[8] = rbrew_read8(cpu->mem, _t127);
         /* 020906EC */ cpu->r[26] = 0x00000000u;
-        /* 020906F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[29]);
+        /* 020906F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[29]));
         /* 020906F4 */ cpu->r[9] = 0x00080000u;
-        /* 020906F8 */ _t128 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020906F8 */ _t128 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020906F8 */ _t129 = _t128 & 0x00000001u;
         /* 020906F8 */ if (_t129) goto L_02090720; else goto L_020906FC;
   L_020906FC: ; // 0x20906fc
         /* 020906FC */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 02090700 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[9]);
+        /* 02090700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[9]));
         /* 02090704 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02090708 */ _t130 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02090708 */ _t130 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02090708 */ _t131 = _t130 & 0x00000001u;
         /* 02090708 */ if (_t131) goto L_0209071C; else goto L_0209070C;
   L_0209070C: ; // 0x209070c
         /* 0209070C */ _t132 = cpu->r[7] + 0x00000000u;
         /* 0209070C */ cpu->r[10] = rbrew_read8(cpu->mem, _t132);
-        /* 02090710 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[29]);
-        /* 02090714 */ _t133 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[29]));
+        /* 02090714 */ _t133 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090714 */ _t134 = _t133 & 0x00000001u;
         /* 02090714 */ if (_t134) goto L_02090718; else goto L_020906FC;
   L_02090718: ; // 0x2090718
@@ -23828,10 +23828,10 @@ void Gambit_fn_02090308(CPUState* cpu) {
         /* 02090720 */ cpu->r[5] = rbrew_read32(cpu->mem, _t135);
         /* 02090724 */ _t136 = cpu->r[1] + 0x00000010u;
         /* 02090724 */ cpu->r[12] = rbrew_read32(cpu->mem, _t136);
-        /* 02090728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[5]);
+        /* 02090728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[5]));
         /* 0209072C */ _t137 = cpu->r[12] + 0x00000014u;
         /* 0209072C */ cpu->r[6] = rbrew_read32(cpu->mem, _t137);
-        /* 02090730 */ _t138 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090730 */ _t138 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090730 */ _t139 = _t138 & 0x00000001u;
         /* 02090730 */ if (_t139) goto L_02090738; else goto L_02090734;
   L_02090734: ; // 0x2090734
@@ -23918,21 +23918,21 @@ void Gambit_fn_02090404(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19, _t20, _t21, _t22, _t23, _t24, _t25, _t26, _t27, _t28, _t29, _t30, _t31, _t32, _t33, _t34, _t35, _t36, _t37, _t38, _t39, _t40, _t41, _t42, _t43, _t44, _t45, _t46, _t47, _t48, _t49, _t50, _t51, _t52, _t53, _t54, _t55, _t56, _t57, _t58, _t59, _t60, _t61, _t62, _t63, _t64, _t65, _t66, _t67, _t68, _t69, _t70, _t71, _t72, _t73, _t74, _t75, _t76, _t77, _t78, _t79, _t80, _t81, _t82, _t83, _t84, _t85, _t86, _t87, _t88, _t89, _t90, _t91, _t92, _t93, _t94, _t95, _t96, _t97, _t98, _t99, _t100, _t101, _t102, _t103, _t104, _t105, _t106, _t107, _t108, _t109, _t110, _t111, _t112, _t113, _t114, _t115, _t116, _t117, _t118, _t119, _t120, _t121, _t122, _t123, _t124, _t125, _t126, _t127, _t128, _t129;
 
   L_02090404: ; // 0x2090404
-        /* 02090404 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090404 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090404 */ _t1 = _t0 & 0x00000001u;
         /* 02090404 */ if (_t1) goto L_0209042C; else goto L_02090408;
   L_02090408: ; // 0x2090408
         /* 02090408 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0209040C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 0209040C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 02090410 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 02090414 */ _t2 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02090414 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02090414 */ _t3 = _t2 & 0x00000001u;
         /* 02090414 */ if (_t3) goto L_02090428; else goto L_02090418;
   L_02090418: ; // 0x2090418
         /* 02090418 */ _t4 = cpu->r[11] + 0x00000000u;
         /* 02090418 */ cpu->r[9] = rbrew_read8(cpu->mem, _t4);
-        /* 0209041C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[29]);
-        /* 02090420 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209041C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[29]));
+        /* 02090420 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090420 */ _t6 = _t5 & 0x00000001u;
         /* 02090420 */ if (_t6) goto L_02090424; else goto L_02090408;
   L_02090424: ; // 0x2090424
@@ -23944,10 +23944,10 @@ void Gambit_fn_02090404(CPUState* cpu) {
         /* 0209042C */ cpu->r[7] = rbrew_read32(cpu->mem, _t7);
         /* 02090430 */ _t8 = cpu->r[1] + 0x00000010u;
         /* 02090430 */ cpu->r[10] = rbrew_read32(cpu->mem, _t8);
-        /* 02090434 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 02090434 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 02090438 */ _t9 = cpu->r[10] + 0x00000014u;
         /* 02090438 */ cpu->r[11] = rbrew_read32(cpu->mem, _t9);
-        /* 0209043C */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209043C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209043C */ _t11 = _t10 & 0x00000001u;
         /* 0209043C */ if (_t11) goto L_02090444; else goto L_02090440;
   L_02090440: ; // 0x2090440
@@ -24002,10 +24002,10 @@ void Gambit_fn_02090404(CPUState* cpu) {
         /* 020904C4 */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
         /* 020904C8 */ _t26 = cpu->r[27] + 0x00000014u;
         /* 020904C8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t26);
-        /* 020904CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x00000001u);
+        /* 020904CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x00000001u));
         /* 020904D0 */ _t27 = cpu->r[27] + 0x00000018u;
         /* 020904D0 */ cpu->r[24] = rbrew_read32(cpu->mem, _t27);
-        /* 020904D4 */ _t28 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020904D4 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020904D4 */ _t29 = _t28 & 0x00000001u;
         /* 020904D4 */ if (_t29) goto L_020904D8; else goto L_020904DC;
   L_020904D8: ; // 0x20904d8
@@ -24021,23 +24021,23 @@ void Gambit_fn_02090404(CPUState* cpu) {
         /* 020904F0 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 020904F0 */ cpu->r[6] = rbrew_read8(cpu->mem, _t32);
         /* 020904F4 */ cpu->r[31] = 0x00000000u;
-        /* 020904F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[29]);
+        /* 020904F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[29]));
         /* 020904FC */ cpu->r[9] = 0x00080000u;
-        /* 02090500 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090500 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090500 */ _t34 = _t33 & 0x00000001u;
         /* 02090500 */ if (_t34) goto L_02090528; else goto L_02090504;
   L_02090504: ; // 0x2090504
         /* 02090504 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02090508 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 02090508 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 0209050C */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02090510 */ _t35 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02090510 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02090510 */ _t36 = _t35 & 0x00000001u;
         /* 02090510 */ if (_t36) goto L_02090524; else goto L_02090514;
   L_02090514: ; // 0x2090514
         /* 02090514 */ _t37 = cpu->r[7] + 0x00000000u;
         /* 02090514 */ cpu->r[8] = rbrew_read8(cpu->mem, _t37);
-        /* 02090518 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[29]);
-        /* 0209051C */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090518 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[29]));
+        /* 0209051C */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209051C */ _t39 = _t38 & 0x00000001u;
         /* 0209051C */ if (_t39) goto L_02090520; else goto L_02090504;
   L_02090520: ; // 0x2090520
@@ -24049,10 +24049,10 @@ void Gambit_fn_02090404(CPUState* cpu) {
         /* 02090528 */ cpu->r[9] = rbrew_read32(cpu->mem, _t40);
         /* 0209052C */ _t41 = cpu->r[1] + 0x00000010u;
         /* 0209052C */ cpu->r[11] = rbrew_read32(cpu->mem, _t41);
-        /* 02090530 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 02090530 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 02090534 */ _t42 = cpu->r[11] + 0x00000014u;
         /* 02090534 */ cpu->r[0] = rbrew_read32(cpu->mem, _t42);
-        /* 02090538 */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090538 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090538 */ _t44 = _t43 & 0x00000001u;
         /* 02090538 */ if (_t44) goto L_02090540; else goto L_0209053C;
   L_0209053C: ; // 0x209053c
@@ -24107,10 +24107,10 @@ void Gambit_fn_02090404(CPUState* cpu) {
         /* 020905C0 */ rbrew_write32(cpu->mem, _t58, cpu->r[10]);
         /* 020905C4 */ _t59 = cpu->r[27] + 0x00000014u;
         /* 020905C4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t59);
-        /* 020905C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000002u);
+        /* 020905C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000002u));
         /* 020905CC */ _t60 = cpu->r[27] + 0x00000018u;
         /* 020905CC */ cpu->r[24] = rbrew_read32(cpu->mem, _t60);
-        /* 020905D0 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020905D0 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020905D0 */ _t62 = _t61 & 0x00000001u;
         /* 020905D0 */ if (_t62) goto L_020905D4; else goto L_020905D8;
   L_020905D4: ; // 0x20905d4
@@ -24126,23 +24126,23 @@ void Gambit_fn_02090404(CPUState* cpu) {
         /* 020905EC */ _t65 = cpu->r[12] + 0x00000000u;
         /* 020905EC */ cpu->r[5] = rbrew_read8(cpu->mem, _t65);
         /* 020905F0 */ cpu->r[31] = 0x00000000u;
-        /* 020905F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[29]);
+        /* 020905F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[29]));
         /* 020905F8 */ cpu->r[0] = 0x00080000u;
-        /* 020905FC */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020905FC */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020905FC */ _t67 = _t66 & 0x00000001u;
         /* 020905FC */ if (_t67) goto L_02090624; else goto L_02090600;
   L_02090600: ; // 0x2090600
         /* 02090600 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02090604 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 02090604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 02090608 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 0209060C */ _t68 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209060C */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209060C */ _t69 = _t68 & 0x00000001u;
         /* 0209060C */ if (_t69) goto L_02090620; else goto L_02090610;
   L_02090610: ; // 0x2090610
         /* 02090610 */ _t70 = cpu->r[12] + 0x00000000u;
         /* 02090610 */ cpu->r[6] = rbrew_read8(cpu->mem, _t70);
-        /* 02090614 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[29]);
-        /* 02090618 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090614 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[29]));
+        /* 02090618 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090618 */ _t72 = _t71 & 0x00000001u;
         /* 02090618 */ if (_t72) goto L_0209061C; else goto L_02090600;
   L_0209061C: ; // 0x209061c
@@ -24154,10 +24154,10 @@ void Gambit_fn_02090404(CPUState* cpu) {
         /* 02090624 */ cpu->r[11] = rbrew_read32(cpu->mem, _t73);
         /* 02090628 */ _t74 = cpu->r[1] + 0x00000010u;
         /* 02090628 */ cpu->r[8] = rbrew_read32(cpu->mem, _t74);
-        /* 0209062C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 0209062C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 02090630 */ _t75 = cpu->r[8] + 0x00000014u;
         /* 02090630 */ cpu->r[10] = rbrew_read32(cpu->mem, _t75);
-        /* 02090634 */ _t76 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090634 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090634 */ _t77 = _t76 & 0x00000001u;
         /* 02090634 */ if (_t77) goto L_0209063C; else goto L_02090638;
   L_02090638: ; // 0x2090638
@@ -24212,10 +24212,10 @@ void Gambit_fn_02090404(CPUState* cpu) {
         /* 020906BC */ rbrew_write32(cpu->mem, _t91, cpu->r[5]);
         /* 020906C0 */ _t92 = cpu->r[27] + 0x00000014u;
         /* 020906C0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t92);
-        /* 020906C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 020906C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 020906C8 */ _t93 = cpu->r[27] + 0x00000018u;
         /* 020906C8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t93);
-        /* 020906CC */ _t94 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020906CC */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020906CC */ _t95 = _t94 & 0x00000001u;
         /* 020906CC */ if (_t95) goto L_020906D0; else goto L_020906D4;
   L_020906D0: ; // 0x20906d0
@@ -24231,23 +24231,23 @@ void Gambit_fn_02090404(CPUState* cpu) {
         /* 020906E8 */ _t98 = cpu->r[7] + 0x00000000u;
         /* 020906E8 */ cpu->r[8] = rbrew_read8(cpu->mem, _t98);
         /* 020906EC */ cpu->r[26] = 0x00000000u;
-        /* 020906F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[29]);
+        /* 020906F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[29]));
         /* 020906F4 */ cpu->r[9] = 0x00080000u;
-        /* 020906F8 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020906F8 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020906F8 */ _t100 = _t99 & 0x00000001u;
         /* 020906F8 */ if (_t100) goto L_02090720; else goto L_020906FC;
   L_020906FC: ; // 0x20906fc
         /* 020906FC */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 02090700 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[9]);
+        /* 02090700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[9]));
         /* 02090704 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02090708 */ _t101 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02090708 */ _t101 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02090708 */ _t102 = _t101 & 0x00000001u;
         /* 02090708 */ if (_t102) goto L_0209071C; else goto L_0209070C;
   L_0209070C: ; // 0x209070c
         /* 0209070C */ _t103 = cpu->r[7] + 0x00000000u;
         /* 0209070C */ cpu->r[10] = rbrew_read8(cpu->mem, _t103);
-        /* 02090710 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[29]);
-        /* 02090714 */ _t104 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[29]));
+        /* 02090714 */ _t104 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090714 */ _t105 = _t104 & 0x00000001u;
         /* 02090714 */ if (_t105) goto L_02090718; else goto L_020906FC;
   L_02090718: ; // 0x2090718
@@ -24259,10 +24259,10 @@ void Gambit_fn_02090404(CPUState* cpu) {
         /* 02090720 */ cpu->r[5] = rbrew_read32(cpu->mem, _t106);
         /* 02090724 */ _t107 = cpu->r[1] + 0x00000010u;
         /* 02090724 */ cpu->r[12] = rbrew_read32(cpu->mem, _t107);
-        /* 02090728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[5]);
+        /* 02090728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[5]));
         /* 0209072C */ _t108 = cpu->r[12] + 0x00000014u;
         /* 0209072C */ cpu->r[6] = rbrew_read32(cpu->mem, _t108);
-        /* 02090730 */ _t109 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090730 */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090730 */ _t110 = _t109 & 0x00000001u;
         /* 02090730 */ if (_t110) goto L_02090738; else goto L_02090734;
   L_02090734: ; // 0x2090734
@@ -24350,16 +24350,16 @@ void Gambit_fn_02090408(CPUState* cpu) {
 
   L_02090408: ; // 0x2090408
         /* 02090408 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0209040C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 0209040C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 02090410 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 02090414 */ _t0 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02090414 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02090414 */ _t1 = _t0 & 0x00000001u;
         /* 02090414 */ if (_t1) goto L_02090428; else goto L_02090418;
   L_02090418: ; // 0x2090418
         /* 02090418 */ _t2 = cpu->r[11] + 0x00000000u;
         /* 02090418 */ cpu->r[9] = rbrew_read8(cpu->mem, _t2);
-        /* 0209041C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[29]);
-        /* 02090420 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209041C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[29]));
+        /* 02090420 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090420 */ _t4 = _t3 & 0x00000001u;
         /* 02090420 */ if (_t4) goto L_02090424; else goto L_02090408;
   L_02090424: ; // 0x2090424
@@ -24371,10 +24371,10 @@ void Gambit_fn_02090408(CPUState* cpu) {
         /* 0209042C */ cpu->r[7] = rbrew_read32(cpu->mem, _t5);
         /* 02090430 */ _t6 = cpu->r[1] + 0x00000010u;
         /* 02090430 */ cpu->r[10] = rbrew_read32(cpu->mem, _t6);
-        /* 02090434 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 02090434 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 02090438 */ _t7 = cpu->r[10] + 0x00000014u;
         /* 02090438 */ cpu->r[11] = rbrew_read32(cpu->mem, _t7);
-        /* 0209043C */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209043C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209043C */ _t9 = _t8 & 0x00000001u;
         /* 0209043C */ if (_t9) goto L_02090444; else goto L_02090440;
   L_02090440: ; // 0x2090440
@@ -24429,10 +24429,10 @@ void Gambit_fn_02090408(CPUState* cpu) {
         /* 020904C4 */ rbrew_write32(cpu->mem, _t23, cpu->r[0]);
         /* 020904C8 */ _t24 = cpu->r[27] + 0x00000014u;
         /* 020904C8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t24);
-        /* 020904CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x00000001u);
+        /* 020904CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x00000001u));
         /* 020904D0 */ _t25 = cpu->r[27] + 0x00000018u;
         /* 020904D0 */ cpu->r[24] = rbrew_read32(cpu->mem, _t25);
-        /* 020904D4 */ _t26 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020904D4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020904D4 */ _t27 = _t26 & 0x00000001u;
         /* 020904D4 */ if (_t27) goto L_020904D8; else goto L_020904DC;
   L_020904D8: ; // 0x20904d8
@@ -24448,23 +24448,23 @@ void Gambit_fn_02090408(CPUState* cpu) {
         /* 020904F0 */ _t30 = cpu->r[7] + 0x00000000u;
         /* 020904F0 */ cpu->r[6] = rbrew_read8(cpu->mem, _t30);
         /* 020904F4 */ cpu->r[31] = 0x00000000u;
-        /* 020904F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[29]);
+        /* 020904F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[29]));
         /* 020904FC */ cpu->r[9] = 0x00080000u;
-        /* 02090500 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090500 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090500 */ _t32 = _t31 & 0x00000001u;
         /* 02090500 */ if (_t32) goto L_02090528; else goto L_02090504;
   L_02090504: ; // 0x2090504
         /* 02090504 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02090508 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 02090508 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 0209050C */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02090510 */ _t33 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02090510 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02090510 */ _t34 = _t33 & 0x00000001u;
         /* 02090510 */ if (_t34) goto L_02090524; else goto L_02090514;
   L_02090514: ; // 0x2090514
         /* 02090514 */ _t35 = cpu->r[7] + 0x00000000u;
         /* 02090514 */ cpu->r[8] = rbrew_read8(cpu->mem, _t35);
-        /* 02090518 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[29]);
-        /* 0209051C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090518 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[29]));
+        /* 0209051C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209051C */ _t37 = _t36 & 0x00000001u;
         /* 0209051C */ if (_t37) goto L_02090520; else goto L_02090504;
   L_02090520: ; // 0x2090520
@@ -24476,10 +24476,10 @@ void Gambit_fn_02090408(CPUState* cpu) {
         /* 02090528 */ cpu->r[9] = rbrew_read32(cpu->mem, _t38);
         /* 0209052C */ _t39 = cpu->r[1] + 0x00000010u;
         /* 0209052C */ cpu->r[11] = rbrew_read32(cpu->mem, _t39);
-        /* 02090530 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 02090530 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 02090534 */ _t40 = cpu->r[11] + 0x00000014u;
         /* 02090534 */ cpu->r[0] = rbrew_read32(cpu->mem, _t40);
-        /* 02090538 */ _t41 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090538 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090538 */ _t42 = _t41 & 0x00000001u;
         /* 02090538 */ if (_t42) goto L_02090540; else goto L_0209053C;
   L_0209053C: ; // 0x209053c
@@ -24534,10 +24534,10 @@ void Gambit_fn_02090408(CPUState* cpu) {
         /* 020905C0 */ rbrew_write32(cpu->mem, _t56, cpu->r[10]);
         /* 020905C4 */ _t57 = cpu->r[27] + 0x00000014u;
         /* 020905C4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t57);
-        /* 020905C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000002u);
+        /* 020905C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000002u));
         /* 020905CC */ _t58 = cpu->r[27] + 0x00000018u;
         /* 020905CC */ cpu->r[24] = rbrew_read32(cpu->mem, _t58);
-        /* 020905D0 */ _t59 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020905D0 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020905D0 */ _t60 = _t59 & 0x00000001u;
         /* 020905D0 */ if (_t60) goto L_020905D4; else goto L_020905D8;
   L_020905D4: ; // 0x20905d4
@@ -24553,23 +24553,23 @@ void Gambit_fn_02090408(CPUState* cpu) {
         /* 020905EC */ _t63 = cpu->r[12] + 0x00000000u;
         /* 020905EC */ cpu->r[5] = rbrew_read8(cpu->mem, _t63);
         /* 020905F0 */ cpu->r[31] = 0x00000000u;
-        /* 020905F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[29]);
+        /* 020905F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[29]));
         /* 020905F8 */ cpu->r[0] = 0x00080000u;
-        /* 020905FC */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020905FC */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020905FC */ _t65 = _t64 & 0x00000001u;
         /* 020905FC */ if (_t65) goto L_02090624; else goto L_02090600;
   L_02090600: ; // 0x2090600
         /* 02090600 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02090604 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 02090604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 02090608 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 0209060C */ _t66 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209060C */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209060C */ _t67 = _t66 & 0x00000001u;
         /* 0209060C */ if (_t67) goto L_02090620; else goto L_02090610;
   L_02090610: ; // 0x2090610
         /* 02090610 */ _t68 = cpu->r[12] + 0x00000000u;
         /* 02090610 */ cpu->r[6] = rbrew_read8(cpu->mem, _t68);
-        /* 02090614 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[29]);
-        /* 02090618 */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090614 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[29]));
+        /* 02090618 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090618 */ _t70 = _t69 & 0x00000001u;
         /* 02090618 */ if (_t70) goto L_0209061C; else goto L_02090600;
   L_0209061C: ; // 0x209061c
@@ -24581,10 +24581,10 @@ void Gambit_fn_02090408(CPUState* cpu) {
         /* 02090624 */ cpu->r[11] = rbrew_read32(cpu->mem, _t71);
         /* 02090628 */ _t72 = cpu->r[1] + 0x00000010u;
         /* 02090628 */ cpu->r[8] = rbrew_read32(cpu->mem, _t72);
-        /* 0209062C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 0209062C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 02090630 */ _t73 = cpu->r[8] + 0x00000014u;
         /* 02090630 */ cpu->r[10] = rbrew_read32(cpu->mem, _t73);
-        /* 02090634 */ _t74 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090634 */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090634 */ _t75 = _t74 & 0x00000001u;
         /* 02090634 */ if (_t75) goto L_0209063C; else goto L_02090638;
   L_02090638: ; // 0x2090638
@@ -24639,10 +24639,10 @@ void Gambit_fn_02090408(CPUState* cpu) {
         /* 020906BC */ rbrew_write32(cpu->mem, _t89, cpu->r[5]);
         /* 020906C0 */ _t90 = cpu->r[27] + 0x00000014u;
         /* 020906C0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t90);
-        /* 020906C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 020906C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 020906C8 */ _t91 = cpu->r[27] + 0x00000018u;
         /* 020906C8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t91);
-        /* 020906CC */ _t92 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020906CC */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020906CC */ _t93 = _t92 & 0x00000001u;
         /* 020906CC */ if (_t93) goto L_020906D0; else goto L_020906D4;
   L_020906D0: ; // 0x20906d0
@@ -24658,23 +24658,23 @@ void Gambit_fn_02090408(CPUState* cpu) {
         /* 020906E8 */ _t96 = cpu->r[7] + 0x00000000u;
         /* 020906E8 */ cpu->r[8] = rbrew_read8(cpu->mem, _t96);
         /* 020906EC */ cpu->r[26] = 0x00000000u;
-        /* 020906F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[29]);
+        /* 020906F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[29]));
         /* 020906F4 */ cpu->r[9] = 0x00080000u;
-        /* 020906F8 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020906F8 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020906F8 */ _t98 = _t97 & 0x00000001u;
         /* 020906F8 */ if (_t98) goto L_02090720; else goto L_020906FC;
   L_020906FC: ; // 0x20906fc
         /* 020906FC */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 02090700 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[9]);
+        /* 02090700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[9]));
         /* 02090704 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02090708 */ _t99 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02090708 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02090708 */ _t100 = _t99 & 0x00000001u;
         /* 02090708 */ if (_t100) goto L_0209071C; else goto L_0209070C;
   L_0209070C: ; // 0x209070c
         /* 0209070C */ _t101 = cpu->r[7] + 0x00000000u;
         /* 0209070C */ cpu->r[10] = rbrew_read8(cpu->mem, _t101);
-        /* 02090710 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[29]);
-        /* 02090714 */ _t102 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[29]));
+        /* 02090714 */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090714 */ _t103 = _t102 & 0x00000001u;
         /* 02090714 */ if (_t103) goto L_02090718; else goto L_020906FC;
   L_02090718: ; // 0x2090718
@@ -24686,10 +24686,10 @@ void Gambit_fn_02090408(CPUState* cpu) {
         /* 02090720 */ cpu->r[5] = rbrew_read32(cpu->mem, _t104);
         /* 02090724 */ _t105 = cpu->r[1] + 0x00000010u;
         /* 02090724 */ cpu->r[12] = rbrew_read32(cpu->mem, _t105);
-        /* 02090728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[5]);
+        /* 02090728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[5]));
         /* 0209072C */ _t106 = cpu->r[12] + 0x00000014u;
         /* 0209072C */ cpu->r[6] = rbrew_read32(cpu->mem, _t106);
-        /* 02090730 */ _t107 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090730 */ _t107 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090730 */ _t108 = _t107 & 0x00000001u;
         /* 02090730 */ if (_t108) goto L_02090738; else goto L_02090734;
   L_02090734: ; // 0x2090734
@@ -24777,16 +24777,16 @@ void Gambit_fn_02090504(CPUState* cpu) {
 
   L_02090504: ; // 0x2090504
         /* 02090504 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02090508 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 02090508 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 0209050C */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02090510 */ _t0 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02090510 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02090510 */ _t1 = _t0 & 0x00000001u;
         /* 02090510 */ if (_t1) goto L_02090524; else goto L_02090514;
   L_02090514: ; // 0x2090514
         /* 02090514 */ _t2 = cpu->r[7] + 0x00000000u;
         /* 02090514 */ cpu->r[8] = rbrew_read8(cpu->mem, _t2);
-        /* 02090518 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[29]);
-        /* 0209051C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090518 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[29]));
+        /* 0209051C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209051C */ _t4 = _t3 & 0x00000001u;
         /* 0209051C */ if (_t4) goto L_02090520; else goto L_02090504;
   L_02090520: ; // 0x2090520
@@ -24798,10 +24798,10 @@ void Gambit_fn_02090504(CPUState* cpu) {
         /* 02090528 */ cpu->r[9] = rbrew_read32(cpu->mem, _t5);
         /* 0209052C */ _t6 = cpu->r[1] + 0x00000010u;
         /* 0209052C */ cpu->r[11] = rbrew_read32(cpu->mem, _t6);
-        /* 02090530 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 02090530 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 02090534 */ _t7 = cpu->r[11] + 0x00000014u;
         /* 02090534 */ cpu->r[0] = rbrew_read32(cpu->mem, _t7);
-        /* 02090538 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090538 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090538 */ _t9 = _t8 & 0x00000001u;
         /* 02090538 */ if (_t9) goto L_02090540; else goto L_0209053C;
   L_0209053C: ; // 0x209053c
@@ -24856,10 +24856,10 @@ void Gambit_fn_02090504(CPUState* cpu) {
         /* 020905C0 */ rbrew_write32(cpu->mem, _t23, cpu->r[10]);
         /* 020905C4 */ _t24 = cpu->r[27] + 0x00000014u;
         /* 020905C4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t24);
-        /* 020905C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000002u);
+        /* 020905C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000002u));
         /* 020905CC */ _t25 = cpu->r[27] + 0x00000018u;
         /* 020905CC */ cpu->r[24] = rbrew_read32(cpu->mem, _t25);
-        /* 020905D0 */ _t26 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020905D0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020905D0 */ _t27 = _t26 & 0x00000001u;
         /* 020905D0 */ if (_t27) goto L_020905D4; else goto L_020905D8;
   L_020905D4: ; // 0x20905d4
@@ -24875,23 +24875,23 @@ void Gambit_fn_02090504(CPUState* cpu) {
         /* 020905EC */ _t30 = cpu->r[12] + 0x00000000u;
         /* 020905EC */ cpu->r[5] = rbrew_read8(cpu->mem, _t30);
         /* 020905F0 */ cpu->r[31] = 0x00000000u;
-        /* 020905F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[29]);
+        /* 020905F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[29]));
         /* 020905F8 */ cpu->r[0] = 0x00080000u;
-        /* 020905FC */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020905FC */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020905FC */ _t32 = _t31 & 0x00000001u;
         /* 020905FC */ if (_t32) goto L_02090624; else goto L_02090600;
   L_02090600: ; // 0x2090600
         /* 02090600 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02090604 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 02090604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 02090608 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 0209060C */ _t33 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209060C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209060C */ _t34 = _t33 & 0x00000001u;
         /* 0209060C */ if (_t34) goto L_02090620; else goto L_02090610;
   L_02090610: ; // 0x2090610
         /* 02090610 */ _t35 = cpu->r[12] + 0x00000000u;
         /* 02090610 */ cpu->r[6] = rbrew_read8(cpu->mem, _t35);
-        /* 02090614 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[29]);
-        /* 02090618 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090614 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[29]));
+        /* 02090618 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090618 */ _t37 = _t36 & 0x00000001u;
         /* 02090618 */ if (_t37) goto L_0209061C; else goto L_02090600;
   L_0209061C: ; // 0x209061c
@@ -24903,10 +24903,10 @@ void Gambit_fn_02090504(CPUState* cpu) {
         /* 02090624 */ cpu->r[11] = rbrew_read32(cpu->mem, _t38);
         /* 02090628 */ _t39 = cpu->r[1] + 0x00000010u;
         /* 02090628 */ cpu->r[8] = rbrew_read32(cpu->mem, _t39);
-        /* 0209062C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 0209062C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 02090630 */ _t40 = cpu->r[8] + 0x00000014u;
         /* 02090630 */ cpu->r[10] = rbrew_read32(cpu->mem, _t40);
-        /* 02090634 */ _t41 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090634 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090634 */ _t42 = _t41 & 0x00000001u;
         /* 02090634 */ if (_t42) goto L_0209063C; else goto L_02090638;
   L_02090638: ; // 0x2090638
@@ -24961,10 +24961,10 @@ void Gambit_fn_02090504(CPUState* cpu) {
         /* 020906BC */ rbrew_write32(cpu->mem, _t56, cpu->r[5]);
         /* 020906C0 */ _t57 = cpu->r[27] + 0x00000014u;
         /* 020906C0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t57);
-        /* 020906C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 020906C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 020906C8 */ _t58 = cpu->r[27] + 0x00000018u;
         /* 020906C8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t58);
-        /* 020906CC */ _t59 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020906CC */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020906CC */ _t60 = _t59 & 0x00000001u;
         /* 020906CC */ if (_t60) goto L_020906D0; else goto L_020906D4;
   L_020906D0: ; // 0x20906d0
@@ -24980,23 +24980,23 @@ void Gambit_fn_02090504(CPUState* cpu) {
         /* 020906E8 */ _t63 = cpu->r[7] + 0x00000000u;
         /* 020906E8 */ cpu->r[8] = rbrew_read8(cpu->mem, _t63);
         /* 020906EC */ cpu->r[26] = 0x00000000u;
-        /* 020906F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[29]);
+        /* 020906F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[29]));
         /* 020906F4 */ cpu->r[9] = 0x00080000u;
-        /* 020906F8 */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020906F8 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020906F8 */ _t65 = _t64 & 0x00000001u;
         /* 020906F8 */ if (_t65) goto L_02090720; else goto L_020906FC;
   L_020906FC: ; // 0x20906fc
         /* 020906FC */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 02090700 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[9]);
+        /* 02090700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[9]));
         /* 02090704 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02090708 */ _t66 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02090708 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02090708 */ _t67 = _t66 & 0x00000001u;
         /* 02090708 */ if (_t67) goto L_0209071C; else goto L_0209070C;
   L_0209070C: ; // 0x209070c
         /* 0209070C */ _t68 = cpu->r[7] + 0x00000000u;
         /* 0209070C */ cpu->r[10] = rbrew_read8(cpu->mem, _t68);
-        /* 02090710 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[29]);
-        /* 02090714 */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[29]));
+        /* 02090714 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090714 */ _t70 = _t69 & 0x00000001u;
         /* 02090714 */ if (_t70) goto L_02090718; else goto L_020906FC;
   L_02090718: ; // 0x2090718
@@ -25008,10 +25008,10 @@ void Gambit_fn_02090504(CPUState* cpu) {
         /* 02090720 */ cpu->r[5] = rbrew_read32(cpu->mem, _t71);
         /* 02090724 */ _t72 = cpu->r[1] + 0x00000010u;
         /* 02090724 */ cpu->r[12] = rbrew_read32(cpu->mem, _t72);
-        /* 02090728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[5]);
+        /* 02090728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[5]));
         /* 0209072C */ _t73 = cpu->r[12] + 0x00000014u;
         /* 0209072C */ cpu->r[6] = rbrew_read32(cpu->mem, _t73);
-        /* 02090730 */ _t74 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090730 */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090730 */ _t75 = _t74 & 0x00000001u;
         /* 02090730 */ if (_t75) goto L_02090738; else goto L_02090734;
   L_02090734: ; // 0x2090734
@@ -25100,16 +25100,16 @@ void Gambit_fn_02090604(CPUState* cpu) {
   L_02090600: ; // 0x2090600
         /* 02090600 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
   L_02090604: ; // 0x2090604
-        /* 02090604 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 02090604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 02090608 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 0209060C */ _t0 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209060C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209060C */ _t1 = _t0 & 0x00000001u;
         /* 0209060C */ if (_t1) goto L_02090620; else goto L_02090610;
   L_02090610: ; // 0x2090610
         /* 02090610 */ _t2 = cpu->r[12] + 0x00000000u;
         /* 02090610 */ cpu->r[6] = rbrew_read8(cpu->mem, _t2);
-        /* 02090614 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[29]);
-        /* 02090618 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090614 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[29]));
+        /* 02090618 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090618 */ _t4 = _t3 & 0x00000001u;
         /* 02090618 */ if (_t4) goto L_0209061C; else goto L_02090600;
   L_0209061C: ; // 0x209061c
@@ -25121,10 +25121,10 @@ void Gambit_fn_02090604(CPUState* cpu) {
         /* 02090624 */ cpu->r[11] = rbrew_read32(cpu->mem, _t5);
         /* 02090628 */ _t6 = cpu->r[1] + 0x00000010u;
         /* 02090628 */ cpu->r[8] = rbrew_read32(cpu->mem, _t6);
-        /* 0209062C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 0209062C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 02090630 */ _t7 = cpu->r[8] + 0x00000014u;
         /* 02090630 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
-        /* 02090634 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090634 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090634 */ _t9 = _t8 & 0x00000001u;
         /* 02090634 */ if (_t9) goto L_0209063C; else goto L_02090638;
   L_02090638: ; // 0x2090638
@@ -25179,10 +25179,10 @@ void Gambit_fn_02090604(CPUState* cpu) {
         /* 020906BC */ rbrew_write32(cpu->mem, _t23, cpu->r[5]);
         /* 020906C0 */ _t24 = cpu->r[27] + 0x00000014u;
         /* 020906C0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
-        /* 020906C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 020906C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 020906C8 */ _t25 = cpu->r[27] + 0x00000018u;
         /* 020906C8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t25);
-        /* 020906CC */ _t26 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020906CC */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020906CC */ _t27 = _t26 & 0x00000001u;
         /* 020906CC */ if (_t27) goto L_020906D0; else goto L_020906D4;
   L_020906D0: ; // 0x20906d0
@@ -25198,23 +25198,23 @@ void Gambit_fn_02090604(CPUState* cpu) {
         /* 020906E8 */ _t30 = cpu->r[7] + 0x00000000u;
         /* 020906E8 */ cpu->r[8] = rbrew_read8(cpu->mem, _t30);
         /* 020906EC */ cpu->r[26] = 0x00000000u;
-        /* 020906F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[29]);
+        /* 020906F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[29]));
         /* 020906F4 */ cpu->r[9] = 0x00080000u;
-        /* 020906F8 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020906F8 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020906F8 */ _t32 = _t31 & 0x00000001u;
         /* 020906F8 */ if (_t32) goto L_02090720; else goto L_020906FC;
   L_020906FC: ; // 0x20906fc
         /* 020906FC */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 02090700 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[9]);
+        /* 02090700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[9]));
         /* 02090704 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02090708 */ _t33 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02090708 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02090708 */ _t34 = _t33 & 0x00000001u;
         /* 02090708 */ if (_t34) goto L_0209071C; else goto L_0209070C;
   L_0209070C: ; // 0x209070c
         /* 0209070C */ _t35 = cpu->r[7] + 0x00000000u;
         /* 0209070C */ cpu->r[10] = rbrew_read8(cpu->mem, _t35);
-        /* 02090710 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[29]);
-        /* 02090714 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[29]));
+        /* 02090714 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090714 */ _t37 = _t36 & 0x00000001u;
         /* 02090714 */ if (_t37) goto L_02090718; else goto L_020906FC;
   L_02090718: ; // 0x2090718
@@ -25226,10 +25226,10 @@ void Gambit_fn_02090604(CPUState* cpu) {
         /* 02090720 */ cpu->r[5] = rbrew_read32(cpu->mem, _t38);
         /* 02090724 */ _t39 = cpu->r[1] + 0x00000010u;
         /* 02090724 */ cpu->r[12] = rbrew_read32(cpu->mem, _t39);
-        /* 02090728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[5]);
+        /* 02090728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[5]));
         /* 0209072C */ _t40 = cpu->r[12] + 0x00000014u;
         /* 0209072C */ cpu->r[6] = rbrew_read32(cpu->mem, _t40);
-        /* 02090730 */ _t41 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090730 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090730 */ _t42 = _t41 & 0x00000001u;
         /* 02090730 */ if (_t42) goto L_02090738; else goto L_02090734;
   L_02090734: ; // 0x2090734
@@ -25317,17 +25317,17 @@ void Gambit_fn_02090608(CPUState* cpu) {
 
   L_02090600: ; // 0x2090600
         /* 02090600 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02090604 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 02090604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
   L_02090608: ; // 0x2090608
         /* 02090608 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 0209060C */ _t0 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209060C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209060C */ _t1 = _t0 & 0x00000001u;
         /* 0209060C */ if (_t1) goto L_02090620; else goto L_02090610;
   L_02090610: ; // 0x2090610
         /* 02090610 */ _t2 = cpu->r[12] + 0x00000000u;
         /* 02090610 */ cpu->r[6] = rbrew_read8(cpu->mem, _t2);
-        /* 02090614 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[29]);
-        /* 02090618 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090614 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[29]));
+        /* 02090618 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090618 */ _t4 = _t3 & 0x00000001u;
         /* 02090618 */ if (_t4) goto L_0209061C; else goto L_02090600;
   L_0209061C: ; // 0x209061c
@@ -25339,10 +25339,10 @@ void Gambit_fn_02090608(CPUState* cpu) {
         /* 02090624 */ cpu->r[11] = rbrew_read32(cpu->mem, _t5);
         /* 02090628 */ _t6 = cpu->r[1] + 0x00000010u;
         /* 02090628 */ cpu->r[8] = rbrew_read32(cpu->mem, _t6);
-        /* 0209062C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 0209062C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 02090630 */ _t7 = cpu->r[8] + 0x00000014u;
         /* 02090630 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
-        /* 02090634 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090634 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090634 */ _t9 = _t8 & 0x00000001u;
         /* 02090634 */ if (_t9) goto L_0209063C; else goto L_02090638;
   L_02090638: ; // 0x2090638
@@ -25397,10 +25397,10 @@ void Gambit_fn_02090608(CPUState* cpu) {
         /* 020906BC */ rbrew_write32(cpu->mem, _t23, cpu->r[5]);
         /* 020906C0 */ _t24 = cpu->r[27] + 0x00000014u;
         /* 020906C0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
-        /* 020906C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 020906C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 020906C8 */ _t25 = cpu->r[27] + 0x00000018u;
         /* 020906C8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t25);
-        /* 020906CC */ _t26 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020906CC */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020906CC */ _t27 = _t26 & 0x00000001u;
         /* 020906CC */ if (_t27) goto L_020906D0; else goto L_020906D4;
   L_020906D0: ; // 0x20906d0
@@ -25416,23 +25416,23 @@ void Gambit_fn_02090608(CPUState* cpu) {
         /* 020906E8 */ _t30 = cpu->r[7] + 0x00000000u;
         /* 020906E8 */ cpu->r[8] = rbrew_read8(cpu->mem, _t30);
         /* 020906EC */ cpu->r[26] = 0x00000000u;
-        /* 020906F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[29]);
+        /* 020906F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[29]));
         /* 020906F4 */ cpu->r[9] = 0x00080000u;
-        /* 020906F8 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020906F8 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020906F8 */ _t32 = _t31 & 0x00000001u;
         /* 020906F8 */ if (_t32) goto L_02090720; else goto L_020906FC;
   L_020906FC: ; // 0x20906fc
         /* 020906FC */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 02090700 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[9]);
+        /* 02090700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[9]));
         /* 02090704 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02090708 */ _t33 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02090708 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02090708 */ _t34 = _t33 & 0x00000001u;
         /* 02090708 */ if (_t34) goto L_0209071C; else goto L_0209070C;
   L_0209070C: ; // 0x209070c
         /* 0209070C */ _t35 = cpu->r[7] + 0x00000000u;
         /* 0209070C */ cpu->r[10] = rbrew_read8(cpu->mem, _t35);
-        /* 02090710 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[29]);
-        /* 02090714 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[29]));
+        /* 02090714 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090714 */ _t37 = _t36 & 0x00000001u;
         /* 02090714 */ if (_t37) goto L_02090718; else goto L_020906FC;
   L_02090718: ; // 0x2090718
@@ -25444,10 +25444,10 @@ void Gambit_fn_02090608(CPUState* cpu) {
         /* 02090720 */ cpu->r[5] = rbrew_read32(cpu->mem, _t38);
         /* 02090724 */ _t39 = cpu->r[1] + 0x00000010u;
         /* 02090724 */ cpu->r[12] = rbrew_read32(cpu->mem, _t39);
-        /* 02090728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[5]);
+        /* 02090728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[5]));
         /* 0209072C */ _t40 = cpu->r[12] + 0x00000014u;
         /* 0209072C */ cpu->r[6] = rbrew_read32(cpu->mem, _t40);
-        /* 02090730 */ _t41 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090730 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090730 */ _t42 = _t41 & 0x00000001u;
         /* 02090730 */ if (_t42) goto L_02090738; else goto L_02090734;
   L_02090734: ; // 0x2090734
@@ -25536,16 +25536,16 @@ void Gambit_fn_02090700(CPUState* cpu) {
   L_020906FC: ; // 0x20906fc
         /* 020906FC */ cpu->r[26] = cpu->r[26] + 0x00000001u;
   L_02090700: ; // 0x2090700
-        /* 02090700 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[9]);
+        /* 02090700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[9]));
         /* 02090704 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02090708 */ _t0 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02090708 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02090708 */ _t1 = _t0 & 0x00000001u;
         /* 02090708 */ if (_t1) goto L_0209071C; else goto L_0209070C;
   L_0209070C: ; // 0x209070c
         /* 0209070C */ _t2 = cpu->r[7] + 0x00000000u;
         /* 0209070C */ cpu->r[10] = rbrew_read8(cpu->mem, _t2);
-        /* 02090710 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[29]);
-        /* 02090714 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[29]));
+        /* 02090714 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090714 */ _t4 = _t3 & 0x00000001u;
         /* 02090714 */ if (_t4) goto L_02090718; else goto L_020906FC;
   L_02090718: ; // 0x2090718
@@ -25557,10 +25557,10 @@ void Gambit_fn_02090700(CPUState* cpu) {
         /* 02090720 */ cpu->r[5] = rbrew_read32(cpu->mem, _t5);
         /* 02090724 */ _t6 = cpu->r[1] + 0x00000010u;
         /* 02090724 */ cpu->r[12] = rbrew_read32(cpu->mem, _t6);
-        /* 02090728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[5]);
+        /* 02090728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[5]));
         /* 0209072C */ _t7 = cpu->r[12] + 0x00000014u;
         /* 0209072C */ cpu->r[6] = rbrew_read32(cpu->mem, _t7);
-        /* 02090730 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090730 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090730 */ _t9 = _t8 & 0x00000001u;
         /* 02090730 */ if (_t9) goto L_02090738; else goto L_02090734;
   L_02090734: ; // 0x2090734
@@ -25648,17 +25648,17 @@ void Gambit_fn_02090704(CPUState* cpu) {
 
   L_020906FC: ; // 0x20906fc
         /* 020906FC */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 02090700 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[9]);
+        /* 02090700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[9]));
   L_02090704: ; // 0x2090704
         /* 02090704 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02090708 */ _t0 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02090708 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02090708 */ _t1 = _t0 & 0x00000001u;
         /* 02090708 */ if (_t1) goto L_0209071C; else goto L_0209070C;
   L_0209070C: ; // 0x209070c
         /* 0209070C */ _t2 = cpu->r[7] + 0x00000000u;
         /* 0209070C */ cpu->r[10] = rbrew_read8(cpu->mem, _t2);
-        /* 02090710 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[29]);
-        /* 02090714 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[29]));
+        /* 02090714 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090714 */ _t4 = _t3 & 0x00000001u;
         /* 02090714 */ if (_t4) goto L_02090718; else goto L_020906FC;
   L_02090718: ; // 0x2090718
@@ -25670,10 +25670,10 @@ void Gambit_fn_02090704(CPUState* cpu) {
         /* 02090720 */ cpu->r[5] = rbrew_read32(cpu->mem, _t5);
         /* 02090724 */ _t6 = cpu->r[1] + 0x00000010u;
         /* 02090724 */ cpu->r[12] = rbrew_read32(cpu->mem, _t6);
-        /* 02090728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[5]);
+        /* 02090728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[5]));
         /* 0209072C */ _t7 = cpu->r[12] + 0x00000014u;
         /* 0209072C */ cpu->r[6] = rbrew_read32(cpu->mem, _t7);
-        /* 02090730 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090730 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090730 */ _t9 = _t8 & 0x00000001u;
         /* 02090730 */ if (_t9) goto L_02090738; else goto L_02090734;
   L_02090734: ; // 0x2090734
@@ -25901,19 +25901,19 @@ void Gambit_fn_02090888(CPUState* cpu) {
         /* 020908B4 */ Gambit_fn_02090880(cpu);
         /* 020908B8 */ _t5 = cpu->r[29] + 0x0000023Cu;
         /* 020908B8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
-        /* 020908BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
-        /* 020908C0 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020908BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
+        /* 020908C0 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020908C0 */ _t7 = _t6 & 0x00000001u;
         /* 020908C0 */ if (_t7) goto L_02090940; else goto L_020908C4;
   L_020908C4: ; // 0x20908c4
-        /* 020908C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000009u);
-        /* 020908C8 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020908C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000009u));
+        /* 020908C8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020908C8 */ _t9 = _t8 & 0x00000001u;
         /* 020908C8 */ if (_t9) goto L_020908CC; else goto L_02090940;
   L_020908CC: ; // 0x20908cc
-        /* 020908CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000009u);
+        /* 020908CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000009u));
         /* 020908D0 */ cpu->r[31] = cpu->r[29] + 0x00000218u;
-        /* 020908D4 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020908D4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020908D4 */ _t11 = _t10 & 0x00000001u;
         /* 020908D4 */ if (_t11) goto L_020908D8; else goto L_020908FC;
   L_020908D8: ; // 0x20908d8
@@ -25926,8 +25926,8 @@ void Gambit_fn_02090888(CPUState* cpu) {
         /* 020908E4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t14);
         /* 020908E8 */ cpu->ctr = cpu->r[9];
         /* 020908EC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020908F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020908F4 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020908F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020908F4 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020908F4 */ _t16 = _t15 & 0x00000001u;
         /* 020908F4 */ if (_t16) goto L_02090940; else goto L_020908F8;
   L_020908F8: ; // 0x20908f8
@@ -25941,15 +25941,15 @@ void Gambit_fn_02090888(CPUState* cpu) {
         /* 02090904 */ cpu->r[9] = rbrew_read32(cpu->mem, _t19);
         /* 02090908 */ cpu->ctr = cpu->r[9];
         /* 0209090C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02090910 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02090914 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02090914 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090914 */ _t21 = _t20 & 0x00000001u;
         /* 02090914 */ if (_t21) goto L_02090940; else goto L_02090918;
   L_02090918: ; // 0x2090918
         /* 02090918 */ _t22 = cpu->r[29] + 0x0000023Cu;
         /* 02090918 */ cpu->r[8] = rbrew_read32(cpu->mem, _t22);
-        /* 0209091C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000009u);
-        /* 02090920 */ _t23 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209091C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000009u));
+        /* 02090920 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090920 */ _t24 = _t23 & 0x00000001u;
         /* 02090920 */ if (_t24) goto L_02090924; else goto L_0209092C;
   L_02090924: ; // 0x2090924
@@ -25965,14 +25965,14 @@ void Gambit_fn_02090888(CPUState* cpu) {
         /* 02090938 */ cpu->ctr = cpu->r[0];
         /* 0209093C */ rbrew_call_indirect(cpu, cpu->ctr);
   L_02090940: ; // 0x2090940
-        /* 02090940 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000009u);
-        /* 02090944 */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000009u));
+        /* 02090944 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090944 */ _t29 = _t28 & 0x00000001u;
         /* 02090944 */ if (_t29) goto L_02090948; else goto L_02090974;
   L_02090948: ; // 0x2090948
-        /* 02090948 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000009u);
+        /* 02090948 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000009u));
         /* 0209094C */ cpu->r[12] = cpu->r[29] + 0x00000218u;
-        /* 02090950 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090950 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090950 */ _t31 = _t30 & 0x00000001u;
         /* 02090950 */ if (_t31) goto L_02090954; else goto L_0209095C;
   L_02090954: ; // 0x2090954
@@ -26029,19 +26029,19 @@ void Gambit_fn_0209088C(CPUState* cpu) {
         /* 020908B4 */ Gambit_fn_02090880(cpu);
         /* 020908B8 */ _t5 = cpu->r[29] + 0x0000023Cu;
         /* 020908B8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
-        /* 020908BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
-        /* 020908C0 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020908BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
+        /* 020908C0 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020908C0 */ _t7 = _t6 & 0x00000001u;
         /* 020908C0 */ if (_t7) goto L_02090940; else goto L_020908C4;
   L_020908C4: ; // 0x20908c4
-        /* 020908C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000009u);
-        /* 020908C8 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020908C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000009u));
+        /* 020908C8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020908C8 */ _t9 = _t8 & 0x00000001u;
         /* 020908C8 */ if (_t9) goto L_020908CC; else goto L_02090940;
   L_020908CC: ; // 0x20908cc
-        /* 020908CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000009u);
+        /* 020908CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000009u));
         /* 020908D0 */ cpu->r[31] = cpu->r[29] + 0x00000218u;
-        /* 020908D4 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020908D4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020908D4 */ _t11 = _t10 & 0x00000001u;
         /* 020908D4 */ if (_t11) goto L_020908D8; else goto L_020908FC;
   L_020908D8: ; // 0x20908d8
@@ -26054,8 +26054,8 @@ void Gambit_fn_0209088C(CPUState* cpu) {
         /* 020908E4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t14);
         /* 020908E8 */ cpu->ctr = cpu->r[9];
         /* 020908EC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020908F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020908F4 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020908F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020908F4 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020908F4 */ _t16 = _t15 & 0x00000001u;
         /* 020908F4 */ if (_t16) goto L_02090940; else goto L_020908F8;
   L_020908F8: ; // 0x20908f8
@@ -26069,15 +26069,15 @@ void Gambit_fn_0209088C(CPUState* cpu) {
         /* 02090904 */ cpu->r[9] = rbrew_read32(cpu->mem, _t19);
         /* 02090908 */ cpu->ctr = cpu->r[9];
         /* 0209090C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02090910 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02090914 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02090914 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090914 */ _t21 = _t20 & 0x00000001u;
         /* 02090914 */ if (_t21) goto L_02090940; else goto L_02090918;
   L_02090918: ; // 0x2090918
         /* 02090918 */ _t22 = cpu->r[29] + 0x0000023Cu;
         /* 02090918 */ cpu->r[8] = rbrew_read32(cpu->mem, _t22);
-        /* 0209091C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000009u);
-        /* 02090920 */ _t23 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209091C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000009u));
+        /* 02090920 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090920 */ _t24 = _t23 & 0x00000001u;
         /* 02090920 */ if (_t24) goto L_02090924; else goto L_0209092C;
   L_02090924: ; // 0x2090924
@@ -26093,14 +26093,14 @@ void Gambit_fn_0209088C(CPUState* cpu) {
         /* 02090938 */ cpu->ctr = cpu->r[0];
         /* 0209093C */ rbrew_call_indirect(cpu, cpu->ctr);
   L_02090940: ; // 0x2090940
-        /* 02090940 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000009u);
-        /* 02090944 */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000009u));
+        /* 02090944 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090944 */ _t29 = _t28 & 0x00000001u;
         /* 02090944 */ if (_t29) goto L_02090948; else goto L_02090974;
   L_02090948: ; // 0x2090948
-        /* 02090948 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000009u);
+        /* 02090948 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000009u));
         /* 0209094C */ cpu->r[12] = cpu->r[29] + 0x00000218u;
-        /* 02090950 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090950 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090950 */ _t31 = _t30 & 0x00000001u;
         /* 02090950 */ if (_t31) goto L_02090954; else goto L_0209095C;
   L_02090954: ; // 0x2090954
@@ -26144,15 +26144,15 @@ void Gambit_fn_02090900(CPUState* cpu) {
         /* 02090904 */ cpu->r[9] = rbrew_read32(cpu->mem, _t1);
         /* 02090908 */ cpu->ctr = cpu->r[9];
         /* 0209090C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02090910 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02090914 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02090914 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090914 */ _t3 = _t2 & 0x00000001u;
         /* 02090914 */ if (_t3) goto L_02090940; else goto L_02090918;
   L_02090918: ; // 0x2090918
         /* 02090918 */ _t4 = cpu->r[29] + 0x0000023Cu;
         /* 02090918 */ cpu->r[8] = rbrew_read32(cpu->mem, _t4);
-        /* 0209091C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000009u);
-        /* 02090920 */ _t5 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209091C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000009u));
+        /* 02090920 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090920 */ _t6 = _t5 & 0x00000001u;
         /* 02090920 */ if (_t6) goto L_02090924; else goto L_0209092C;
   L_02090924: ; // 0x2090924
@@ -26168,14 +26168,14 @@ void Gambit_fn_02090900(CPUState* cpu) {
         /* 02090938 */ cpu->ctr = cpu->r[0];
         /* 0209093C */ rbrew_call_indirect(cpu, cpu->ctr);
   L_02090940: ; // 0x2090940
-        /* 02090940 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000009u);
-        /* 02090944 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000009u));
+        /* 02090944 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090944 */ _t11 = _t10 & 0x00000001u;
         /* 02090944 */ if (_t11) goto L_02090948; else goto L_02090974;
   L_02090948: ; // 0x2090948
-        /* 02090948 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000009u);
+        /* 02090948 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000009u));
         /* 0209094C */ cpu->r[12] = cpu->r[29] + 0x00000218u;
-        /* 02090950 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090950 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090950 */ _t13 = _t12 & 0x00000001u;
         /* 02090950 */ if (_t13) goto L_02090954; else goto L_0209095C;
   L_02090954: ; // 0x2090954
@@ -26217,15 +26217,15 @@ void Gambit_fn_02090904(CPUState* cpu) {
         /* 02090904 */ cpu->r[9] = rbrew_read32(cpu->mem, _t0);
         /* 02090908 */ cpu->ctr = cpu->r[9];
         /* 0209090C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02090910 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02090914 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02090914 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090914 */ _t2 = _t1 & 0x00000001u;
         /* 02090914 */ if (_t2) goto L_02090940; else goto L_02090918;
   L_02090918: ; // 0x2090918
         /* 02090918 */ _t3 = cpu->r[29] + 0x0000023Cu;
         /* 02090918 */ cpu->r[8] = rbrew_read32(cpu->mem, _t3);
-        /* 0209091C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000009u);
-        /* 02090920 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209091C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000009u));
+        /* 02090920 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090920 */ _t5 = _t4 & 0x00000001u;
         /* 02090920 */ if (_t5) goto L_02090924; else goto L_0209092C;
   L_02090924: ; // 0x2090924
@@ -26241,14 +26241,14 @@ void Gambit_fn_02090904(CPUState* cpu) {
         /* 02090938 */ cpu->ctr = cpu->r[0];
         /* 0209093C */ rbrew_call_indirect(cpu, cpu->ctr);
   L_02090940: ; // 0x2090940
-        /* 02090940 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000009u);
-        /* 02090944 */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000009u));
+        /* 02090944 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090944 */ _t10 = _t9 & 0x00000001u;
         /* 02090944 */ if (_t10) goto L_02090948; else goto L_02090974;
   L_02090948: ; // 0x2090948
-        /* 02090948 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000009u);
+        /* 02090948 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000009u));
         /* 0209094C */ cpu->r[12] = cpu->r[29] + 0x00000218u;
-        /* 02090950 */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090950 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090950 */ _t12 = _t11 & 0x00000001u;
         /* 02090950 */ if (_t12) goto L_02090954; else goto L_0209095C;
   L_02090954: ; // 0x2090954
@@ -26294,14 +26294,14 @@ void Gambit_fn_02090998(CPUState* cpu) {
   L_020909AC: ; // 0x20909ac
         /* 020909AC */ _t0 = cpu->r[3] + 0x0000023Cu;
         /* 020909AC */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 020909B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[8]);
-        /* 020909B4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020909B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[8]));
+        /* 020909B4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020909B4 */ _t2 = _t1 & 0x00000001u;
         /* 020909B4 */ if (_t2) goto L_020909D0; else goto L_020909B8;
   L_020909B8: ; // 0x20909b8
-        /* 020909B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000009u);
+        /* 020909B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000009u));
         /* 020909BC */ cpu->r[12] = cpu->r[3] + 0x00000218u;
-        /* 020909C0 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020909C0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020909C0 */ _t4 = _t3 & 0x00000001u;
         /* 020909C0 */ if (_t4) goto L_020909C4; else goto L_020909C8;
   L_020909C4: ; // 0x20909c4
@@ -26347,8 +26347,8 @@ void Gambit_fn_020909E0(CPUState* cpu) {
         /* 02090A08 */ Gambit_fn_0206A274(cpu);
         /* 02090A0C */ _t5 = cpu->r[31] + 0x0000023Cu;
         /* 02090A0C */ cpu->r[4] = rbrew_read32(cpu->mem, _t5);
-        /* 02090A10 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000009u);
-        /* 02090A14 */ _t6 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090A10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000009u));
+        /* 02090A14 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090A14 */ _t7 = _t6 & 0x00000001u;
         /* 02090A14 */ if (_t7) goto L_02090A18; else goto L_02090A20;
   L_02090A18: ; // 0x2090a18
@@ -26357,8 +26357,8 @@ void Gambit_fn_020909E0(CPUState* cpu) {
   L_02090A20: ; // 0x2090a20
         /* 02090A20 */ _t8 = cpu->r[31] + 0x00000242u;
         /* 02090A20 */ cpu->r[0] = rbrew_read8(cpu->mem, _t8);
-        /* 02090A24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02090A28 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090A24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02090A28 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090A28 */ _t10 = _t9 & 0x00000001u;
         /* 02090A28 */ if (_t10) goto L_02090A2C; else goto L_02090A34;
   L_02090A2C: ; // 0x2090a2c
@@ -26415,8 +26415,8 @@ void Gambit_fn_020909E4(CPUState* cpu) {
         /* 02090A08 */ Gambit_fn_0206A274(cpu);
         /* 02090A0C */ _t5 = cpu->r[31] + 0x0000023Cu;
         /* 02090A0C */ cpu->r[4] = rbrew_read32(cpu->mem, _t5);
-        /* 02090A10 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000009u);
-        /* 02090A14 */ _t6 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090A10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000009u));
+        /* 02090A14 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090A14 */ _t7 = _t6 & 0x00000001u;
         /* 02090A14 */ if (_t7) goto L_02090A18; else goto L_02090A20;
   L_02090A18: ; // 0x2090a18
@@ -26425,8 +26425,8 @@ void Gambit_fn_020909E4(CPUState* cpu) {
   L_02090A20: ; // 0x2090a20
         /* 02090A20 */ _t8 = cpu->r[31] + 0x00000242u;
         /* 02090A20 */ cpu->r[0] = rbrew_read8(cpu->mem, _t8);
-        /* 02090A24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02090A28 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090A24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02090A28 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090A28 */ _t10 = _t9 & 0x00000001u;
         /* 02090A28 */ if (_t10) goto L_02090A2C; else goto L_02090A34;
   L_02090A2C: ; // 0x2090a2c
@@ -26589,10 +26589,10 @@ void Gambit_fn_02090B00(CPUState* cpu) {
         /* 02090B08 */ _t1 = cpu->r[3] + 0x00000240u;
         /* 02090B08 */ rbrew_write8(cpu->mem, _t1, (uint8_t)cpu->r[0]);
         /* 02090B0C */ cpu->r[11] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 02090B0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02090B0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02090B10 */ _t2 = cpu->r[3] + 0x00000241u;
         /* 02090B10 */ rbrew_write8(cpu->mem, _t2, (uint8_t)cpu->r[0]);
-        /* 02090B14 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090B14 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090B14 */ _t4 = _t3 & 0x00000001u;
         /* 02090B14 */ if (_t4) goto L_02090B18; else goto L_02090B1C;
   L_02090B18: ; // 0x2090b18
@@ -26613,8 +26613,8 @@ void Gambit_fn_02090B00(CPUState* cpu) {
         /* 026D82D0 */ _t9 = cpu->r[31] + 0x00000118u;
         /* 026D82D0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
         /* 026D82D4 */ cpu->r[11] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 026D82D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 026D82D8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026D82D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 026D82D8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026D82D8 */ _t11 = _t10 & 0x00000001u;
         /* 026D82D8 */ if (_t11) goto L_026D82DC; else goto L_026D82EC;
   L_026D82DC: ; // 0x26d82dc
@@ -26631,8 +26631,8 @@ void Gambit_fn_02090B00(CPUState* cpu) {
         /* 026D82F8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t13);
         /* 026D82FC */ _t14 = cpu->r[9] + 0x0000000Cu;
         /* 026D82FC */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
-        /* 026D8300 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 026D8304 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026D8300 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 026D8304 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026D8304 */ _t16 = _t15 & 0x00000001u;
         /* 026D8304 */ if (_t16) goto L_026D8308; else goto L_026D8320;
   L_026D8308: ; // 0x26d8308
@@ -26680,8 +26680,8 @@ void Gambit_fn_02090B38(CPUState* cpu) {
         /* 02090B3C */ _t0 = cpu->r[12] + 0x00000241u;
         /* 02090B3C */ cpu->r[0] = rbrew_read8(cpu->mem, _t0);
         /* 02090B40 */ cpu->r[3] = 0xFFFFFFFFu;
-        /* 02090B44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02090B48 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090B44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02090B48 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090B48 */ _t2 = _t1 & 0x00000001u;
         /* 02090B48 */ if (_t2) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02090B48 */ goto L_02090B4C;
@@ -26821,7 +26821,7 @@ void Gambit_fn_02090C30(CPUState* cpu) {
         /* 02090CA0 */ cpu->r[5] = cpu->r[21];
         /* 02090CA4 */ cpu->r[4] = cpu->r[20] + 0xFFFFE44Cu;
         /* 02090CA8 */ cpu->r[3] = cpu->r[1] + 0x00000010u;
-        /* 02090CAC */ _t8 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02090CAC */ _t8 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02090CAC */ _t9 = _t8 & 0x00000001u;
         /* 02090CAC */ if (_t9) goto L_02090CB0; // else: addr-0 trap, fall-through
   L_02090CB0: ; // 0x2090cb0
@@ -26832,9 +26832,9 @@ void Gambit_fn_02090C30(CPUState* cpu) {
         /* 02090CC0 */ Gambit_fn_026D86C0(cpu);
         /* 02090CC4 */ _t10 = cpu->r[23] + 0xFFFFEDBCu;
         /* 02090CC4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t10);
-        /* 02090CC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02090CC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02090CCC */ cpu->r[31] = cpu->r[3];
-        /* 02090CD0 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090CD0 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090CD0 */ _t12 = _t11 & 0x00000001u;
         /* 02090CD0 */ if (_t12) goto L_02090CD4; else goto L_02090CDC;
   L_02090CD4: ; // 0x2090cd4
@@ -26843,8 +26843,8 @@ void Gambit_fn_02090C30(CPUState* cpu) {
         /* 02090CD8 */ _t14 = cpu->r[23] + 0xFFFFEDBCu;
         /* 02090CD8 */ rbrew_write32(cpu->mem, _t14, cpu->r[29]);
   L_02090CDC: ; // 0x2090cdc
-        /* 02090CDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02090CE0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090CDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02090CE0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090CE0 */ _t16 = _t15 & 0x00000001u;
         /* 02090CE0 */ if (_t16) goto L_02090D04; else goto L_02090CE4;
   L_02090CE4: ; // 0x2090ce4
@@ -26856,8 +26856,8 @@ void Gambit_fn_02090C30(CPUState* cpu) {
         /* 02090CF0 */ cpu->r[3] = cpu->r[31];
         /* 02090CF4 */ cpu->r[4] = cpu->r[30] + 0xFFFFEE20u;
         /* 02090CF8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02090CFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02090D00 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090CFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02090D00 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090D00 */ _t20 = _t19 & 0x00000001u;
         /* 02090D00 */ if (_t20) goto L_02090D04; else goto L_02090D08;
   L_02090D04: ; // 0x2090d04
@@ -26869,11 +26869,11 @@ void Gambit_fn_02090C30(CPUState* cpu) {
         /* 02090D0C */ cpu->r[8] = rbrew_read32(cpu->mem, _t22);
         /* 02090D10 */ cpu->r[28] = cpu->r[28] + 0x00000004u;
         /* 02090D14 */ cpu->r[25] = cpu->r[25] + 0xFFFFFFFFu;
-        /* 02090D14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 02090D14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 02090D18 */ cpu->r[21] = cpu->r[21] + 0x00000001u;
         /* 02090D1C */ _t23 = cpu->r[8] + 0x000001B7u;
         /* 02090D1C */ rbrew_write8(cpu->mem, _t23, (uint8_t)cpu->r[29]);
-        /* 02090D20 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090D20 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090D20 */ _t25 = _t24 & 0x00000001u;
         /* 02090D20 */ if (_t25) goto L_02090D24; else goto L_02090CA0;
   L_02090D24: ; // 0x2090d24
@@ -26889,9 +26889,9 @@ void Gambit_fn_02090C30(CPUState* cpu) {
         /* 02090D40 */ Gambit_fn_026D86C0(cpu);
         /* 02090D44 */ _t28 = cpu->r[23] + 0xFFFFEDBCu;
         /* 02090D44 */ cpu->r[0] = rbrew_read32(cpu->mem, _t28);
-        /* 02090D48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02090D48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02090D4C */ cpu->r[29] = cpu->r[3];
-        /* 02090D50 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090D50 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090D50 */ _t30 = _t29 & 0x00000001u;
         /* 02090D50 */ if (_t30) goto L_02090D54; else goto L_02090D60;
   L_02090D54: ; // 0x2090d54
@@ -26901,8 +26901,8 @@ void Gambit_fn_02090C30(CPUState* cpu) {
         /* 02090D5C */ _t32 = cpu->r[23] + 0xFFFFEDBCu;
         /* 02090D5C */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_02090D60: ; // 0x2090d60
-        /* 02090D60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02090D64 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090D60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02090D64 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090D64 */ _t34 = _t33 & 0x00000001u;
         /* 02090D64 */ if (_t34) goto L_02090D88; else goto L_02090D68;
   L_02090D68: ; // 0x2090d68
@@ -26914,8 +26914,8 @@ void Gambit_fn_02090C30(CPUState* cpu) {
         /* 02090D74 */ cpu->r[3] = cpu->r[29];
         /* 02090D78 */ cpu->r[4] = cpu->r[30] + 0xFFFFEE20u;
         /* 02090D7C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02090D80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02090D84 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090D80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02090D84 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090D84 */ _t38 = _t37 & 0x00000001u;
         /* 02090D84 */ if (_t38) goto L_02090D88; else goto L_02090D8C;
   L_02090D88: ; // 0x2090d88
@@ -26977,8 +26977,8 @@ void Gambit_fn_02090DF4(CPUState* cpu) {
         /* 02090E00 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02090E04 */ _t3 = cpu->r[31] + 0x000001E4u;
         /* 02090E04 */ cpu->r[9] = rbrew_read32(cpu->mem, _t3);
-        /* 02090E08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02090E0C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090E08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02090E0C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090E0C */ _t5 = _t4 & 0x00000001u;
         /* 02090E0C */ if (_t5) goto L_02090E10; else goto L_02090E68;
   L_02090E10: ; // 0x2090e10
@@ -26999,8 +26999,8 @@ void Gambit_fn_02090DF4(CPUState* cpu) {
         /* 02090E3C */ Gambit_fn_027ED1E4(cpu);
         /* 02090E40 */ _t9 = cpu->r[31] + 0x00000242u;
         /* 02090E40 */ cpu->r[10] = rbrew_read8(cpu->mem, _t9);
-        /* 02090E44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02090E48 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090E44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02090E48 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090E48 */ _t11 = _t10 & 0x00000001u;
         /* 02090E48 */ if (_t11) goto L_02090E54; else goto L_02090E4C;
   L_02090E4C: ; // 0x2090e4c
@@ -27009,8 +27009,8 @@ void Gambit_fn_02090DF4(CPUState* cpu) {
   L_02090E54: ; // 0x2090e54
         /* 02090E54 */ _t12 = cpu->r[31] + 0x0000023Cu;
         /* 02090E54 */ cpu->r[4] = rbrew_read32(cpu->mem, _t12);
-        /* 02090E58 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000009u);
-        /* 02090E5C */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090E58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000009u));
+        /* 02090E5C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090E5C */ _t14 = _t13 & 0x00000001u;
         /* 02090E5C */ if (_t14) goto L_02090E60; else goto L_02090E68;
   L_02090E60: ; // 0x2090e60
@@ -27020,15 +27020,15 @@ void Gambit_fn_02090DF4(CPUState* cpu) {
         /* 02090E68 */ cpu->r[3] = cpu->r[31];
         /* 02090E6C */ cpu->r[4] = 0x00000000u;
         /* 02090E70 */ Gambit_fn_027EDF00(cpu);
-        /* 02090E74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02090E78 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090E74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02090E78 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090E78 */ _t16 = _t15 & 0x00000001u;
         /* 02090E78 */ if (_t16) goto L_02090EA4; else goto L_02090E7C;
   L_02090E7C: ; // 0x2090e7c
         /* 02090E7C */ _t17 = cpu->r[31] + 0x00000242u;
         /* 02090E7C */ cpu->r[0] = rbrew_read8(cpu->mem, _t17);
-        /* 02090E80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02090E84 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090E80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02090E84 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090E84 */ _t19 = _t18 & 0x00000001u;
         /* 02090E84 */ if (_t19) goto L_02090E88; else goto L_02090E90;
   L_02090E88: ; // 0x2090e88
@@ -27068,10 +27068,10 @@ void Gambit_fn_02090EB8(CPUState* cpu) {
         /* 02090ECC */ cpu->r[7] = rbrew_read8(cpu->mem, _t2);
         /* 02090ED0 */ cpu->r[31] = cpu->r[28] + 0x00000218u;
         /* 02090ED4 */ cpu->r[27] = 0x00000000u;
-        /* 02090ED8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02090ED8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02090EDC */ _t3 = cpu->r[28] + 0x00000241u;
         /* 02090EDC */ rbrew_write8(cpu->mem, _t3, (uint8_t)cpu->r[27]);
-        /* 02090EE0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090EE0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090EE0 */ _t5 = _t4 & 0x00000001u;
         /* 02090EE0 */ if (_t5) goto L_02090EE4; else goto L_02091008;
   L_02090EE4: ; // 0x2090ee4
@@ -27079,8 +27079,8 @@ void Gambit_fn_02090EB8(CPUState* cpu) {
         /* 02090EE8 */ cpu->r[30] = cpu->r[26];
         /* 02090EEC */ goto L_02090EF8;
   L_02090EF0: ; // 0x2090ef0
-        /* 02090EF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000009u);
-        /* 02090EF4 */ _t6 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090EF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000009u));
+        /* 02090EF4 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090EF4 */ _t7 = _t6 & 0x00000001u;
         /* 02090EF4 */ if (_t7) goto L_02090EF8; else goto L_02090F04;
   L_02090EF8: ; // 0x2090ef8
@@ -27098,15 +27098,15 @@ void Gambit_fn_02090EB8(CPUState* cpu) {
         /* 02090F10 */ cpu->r[10] = rbrew_read32(cpu->mem, _t10);
         /* 02090F14 */ cpu->ctr = cpu->r[10];
         /* 02090F18 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02090F1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02090F20 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090F1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02090F20 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090F20 */ _t12 = _t11 & 0x00000001u;
         /* 02090F20 */ if (_t12) goto L_02090FEC; else goto L_02090F24;
   L_02090F24: ; // 0x2090f24
         /* 02090F24 */ _t13 = cpu->r[28] + 0x0000023Cu;
         /* 02090F24 */ cpu->r[0] = rbrew_read32(cpu->mem, _t13);
-        /* 02090F28 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], cpu->r[0]);
-        /* 02090F2C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090F28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], cpu->r[0]));
+        /* 02090F2C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090F2C */ _t15 = _t14 & 0x00000001u;
         /* 02090F2C */ if (_t15) goto L_02090FEC; else goto L_02090F30;
   L_02090F30: ; // 0x2090f30
@@ -27118,13 +27118,13 @@ void Gambit_fn_02090EB8(CPUState* cpu) {
         /* 02090F3C */ Gambit_fn_02090A84(cpu);
         /* 02090F40 */ _t18 = cpu->r[28] + 0x0000023Cu;
         /* 02090F40 */ cpu->r[0] = rbrew_read32(cpu->mem, _t18);
-        /* 02090F44 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000009u);
-        /* 02090F48 */ _t19 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090F44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000009u));
+        /* 02090F48 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090F48 */ _t20 = _t19 & 0x00000001u;
         /* 02090F48 */ if (_t20) goto L_02090F4C; else goto L_02090FD4;
   L_02090F4C: ; // 0x2090f4c
-        /* 02090F4C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000009u);
-        /* 02090F50 */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090F4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000009u));
+        /* 02090F50 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090F50 */ _t22 = _t21 & 0x00000001u;
         /* 02090F50 */ if (_t22) goto L_02090F54; else goto L_02090F78;
   L_02090F54: ; // 0x2090f54
@@ -27137,8 +27137,8 @@ void Gambit_fn_02090EB8(CPUState* cpu) {
         /* 02090F60 */ cpu->r[7] = rbrew_read32(cpu->mem, _t25);
         /* 02090F64 */ cpu->ctr = cpu->r[7];
         /* 02090F68 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02090F6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02090F70 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090F6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02090F70 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090F70 */ _t27 = _t26 & 0x00000001u;
         /* 02090F70 */ if (_t27) goto L_02090FD0; else goto L_02090F74;
   L_02090F74: ; // 0x2090f74
@@ -27152,15 +27152,15 @@ void Gambit_fn_02090EB8(CPUState* cpu) {
         /* 02090F80 */ cpu->r[7] = rbrew_read32(cpu->mem, _t30);
         /* 02090F84 */ cpu->ctr = cpu->r[7];
         /* 02090F88 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02090F8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02090F90 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090F8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02090F90 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02090F90 */ _t32 = _t31 & 0x00000001u;
         /* 02090F90 */ if (_t32) goto L_02090FD0; else goto L_02090F94;
   L_02090F94: ; // 0x2090f94
         /* 02090F94 */ _t33 = cpu->r[28] + 0x0000023Cu;
         /* 02090F94 */ cpu->r[8] = rbrew_read32(cpu->mem, _t33);
-        /* 02090F98 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000009u);
-        /* 02090F9C */ _t34 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090F98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000009u));
+        /* 02090F9C */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090F9C */ _t35 = _t34 & 0x00000001u;
         /* 02090F9C */ if (_t35) goto L_02090FA0; else goto L_02090FBC;
   L_02090FA0: ; // 0x2090fa0
@@ -27196,23 +27196,23 @@ void Gambit_fn_02090EB8(CPUState* cpu) {
         /* 02090FE8 */ rbrew_write32(cpu->mem, _t43, cpu->r[26]);
   L_02090FEC: ; // 0x2090fec
         /* 02090FEC */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 02090FF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000009u);
+        /* 02090FF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000009u));
         /* 02090FF4 */ cpu->r[30] = cpu->r[30] + 0x00000004u;
-        /* 02090FF8 */ _t44 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02090FF8 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02090FF8 */ _t45 = _t44 & 0x00000001u;
         /* 02090FF8 */ if (_t45) goto L_02090EF0; else goto L_02090FFC;
   L_02090FFC: ; // 0x2090ffc
         /* 02090FFC */ _t46 = cpu->r[28] + 0x00000240u;
         /* 02090FFC */ cpu->r[8] = rbrew_read8(cpu->mem, _t46);
-        /* 02091000 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02091004 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091000 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02091004 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091004 */ _t48 = _t47 & 0x00000001u;
         /* 02091004 */ if (_t48) goto L_02091050; else goto L_02091008;
   L_02091008: ; // 0x2091008
         /* 02091008 */ _t49 = cpu->r[28] + 0x0000023Cu;
         /* 02091008 */ cpu->r[4] = rbrew_read32(cpu->mem, _t49);
-        /* 0209100C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000009u);
-        /* 02091010 */ _t50 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209100C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000009u));
+        /* 02091010 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02091010 */ _t51 = _t50 & 0x00000001u;
         /* 02091010 */ if (_t51) goto L_02091014; else goto L_0209101C;
   L_02091014: ; // 0x2091014
@@ -27227,17 +27227,17 @@ void Gambit_fn_02090EB8(CPUState* cpu) {
         /* 02091024 */ cpu->r[11] = rbrew_read32(cpu->mem, _t54);
         /* 02091028 */ cpu->ctr = cpu->r[11];
         /* 0209102C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02091030 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02091034 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091030 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02091034 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091034 */ _t56 = _t55 & 0x00000001u;
         /* 02091034 */ if (_t56) goto L_02091050; else goto L_02091038;
   L_02091038: ; // 0x2091038
         /* 02091038 */ _t57 = cpu->r[28] + 0x00000242u;
         /* 02091038 */ cpu->r[0] = rbrew_read8(cpu->mem, _t57);
-        /* 0209103C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0209103C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02091040 */ _t58 = cpu->r[28] + 0x00000240u;
         /* 02091040 */ rbrew_write8(cpu->mem, _t58, (uint8_t)cpu->r[27]);
-        /* 02091044 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091044 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091044 */ _t60 = _t59 & 0x00000001u;
         /* 02091044 */ if (_t60) goto L_02091048; else goto L_02091050;
   L_02091048: ; // 0x2091048
@@ -27267,8 +27267,8 @@ void Gambit_fn_02091068(CPUState* cpu) {
         /* 02091074 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02091078 */ _t3 = cpu->r[31] + 0x000001E4u;
         /* 02091078 */ cpu->r[9] = rbrew_read32(cpu->mem, _t3);
-        /* 0209107C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02091080 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209107C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02091080 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091080 */ _t5 = _t4 & 0x00000001u;
         /* 02091080 */ if (_t5) goto L_02091084; else goto L_020910B4;
   L_02091084: ; // 0x2091084
@@ -27291,8 +27291,8 @@ void Gambit_fn_02091068(CPUState* cpu) {
         /* 020910B4 */ cpu->r[3] = cpu->r[31];
         /* 020910B8 */ cpu->r[4] = 0x00000000u;
         /* 020910BC */ Gambit_fn_027EDF00(cpu);
-        /* 020910C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020910C4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020910C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020910C4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020910C4 */ _t10 = _t9 & 0x00000001u;
         /* 020910C4 */ if (_t10) goto L_020910DC; else goto L_020910C8;
   L_020910C8: ; // 0x20910c8
@@ -27318,15 +27318,15 @@ void Gambit_fn_020910F0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020910F0: ; // 0x20910f0
-        /* 020910F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020910F4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020910F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020910F4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020910F4 */ _t1 = _t0 & 0x00000001u;
         /* 020910F4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020910F4 */ goto L_020910F8;
   L_020910F8: ; // 0x20910f8
         /* 020910F8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020910F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020910FC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020910F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020910FC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020910FC */ _t3 = _t2 & 0x00000001u;
         /* 020910FC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020910FC */ goto L_02091100;
@@ -27345,8 +27345,8 @@ void Gambit_fn_020910F0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -27360,15 +27360,15 @@ void Gambit_fn_020910F0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -27405,11 +27405,11 @@ void Gambit_fn_02091104(CPUState* cpu) {
         /* 02091110 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02091110 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02091114 */ cpu->r[30] = cpu->r[3];
-        /* 02091114 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02091114 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02091118 */ cpu->r[31] = cpu->r[4];
         /* 0209111C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209111C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02091120 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091120 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091120 */ _t5 = _t4 & 0x00000001u;
         /* 02091120 */ if (_t5) goto L_02091164; else goto L_02091124;
   L_02091124: ; // 0x2091124
@@ -27429,8 +27429,8 @@ void Gambit_fn_02091104(CPUState* cpu) {
         /* 0209114C */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 02091150 */ Gambit_fn_02068798(cpu);
         /* 02091154 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02091154 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02091158 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091154 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02091158 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091158 */ _t10 = _t9 & 0x00000001u;
         /* 02091158 */ if (_t10) goto L_02091164; else goto L_0209115C;
   L_0209115C: ; // 0x209115c
@@ -27461,11 +27461,11 @@ void Gambit_fn_02091108(CPUState* cpu) {
         /* 02091110 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02091110 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02091114 */ cpu->r[30] = cpu->r[3];
-        /* 02091114 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02091114 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02091118 */ cpu->r[31] = cpu->r[4];
         /* 0209111C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209111C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02091120 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091120 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091120 */ _t5 = _t4 & 0x00000001u;
         /* 02091120 */ if (_t5) goto L_02091164; else goto L_02091124;
   L_02091124: ; // 0x2091124
@@ -27485,8 +27485,8 @@ void Gambit_fn_02091108(CPUState* cpu) {
         /* 0209114C */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 02091150 */ Gambit_fn_02068798(cpu);
         /* 02091154 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02091154 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02091158 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091154 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02091158 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091158 */ _t10 = _t9 & 0x00000001u;
         /* 02091158 */ if (_t10) goto L_02091164; else goto L_0209115C;
   L_0209115C: ; // 0x209115c
@@ -27541,15 +27541,15 @@ void Gambit_fn_02091194(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02091194: ; // 0x2091194
-        /* 02091194 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02091198 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091194 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02091198 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091198 */ _t1 = _t0 & 0x00000001u;
         /* 02091198 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02091198 */ goto L_0209119C;
   L_0209119C: ; // 0x209119c
         /* 0209119C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209119C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020911A0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209119C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020911A0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020911A0 */ _t3 = _t2 & 0x00000001u;
         /* 020911A0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020911A0 */ goto L_020911A4;
@@ -27568,8 +27568,8 @@ void Gambit_fn_02091194(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -27583,15 +27583,15 @@ void Gambit_fn_02091194(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -27637,15 +27637,15 @@ void Gambit_fn_020911C4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020911C4: ; // 0x20911c4
-        /* 020911C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020911C8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020911C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020911C8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020911C8 */ _t1 = _t0 & 0x00000001u;
         /* 020911C8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020911C8 */ goto L_020911CC;
   L_020911CC: ; // 0x20911cc
         /* 020911CC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020911CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020911D0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020911CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020911D0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020911D0 */ _t3 = _t2 & 0x00000001u;
         /* 020911D0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020911D0 */ goto L_020911D4;
@@ -27664,8 +27664,8 @@ void Gambit_fn_020911C4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -27679,15 +27679,15 @@ void Gambit_fn_020911C4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -27715,15 +27715,15 @@ void Gambit_fn_020911D8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020911D8: ; // 0x20911d8
-        /* 020911D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020911DC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020911D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020911DC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020911DC */ _t1 = _t0 & 0x00000001u;
         /* 020911DC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020911DC */ goto L_020911E0;
   L_020911E0: ; // 0x20911e0
         /* 020911E0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020911E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020911E4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020911E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020911E4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020911E4 */ _t3 = _t2 & 0x00000001u;
         /* 020911E4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020911E4 */ goto L_020911E8;
@@ -27742,8 +27742,8 @@ void Gambit_fn_020911D8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -27757,15 +27757,15 @@ void Gambit_fn_020911D8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -27793,15 +27793,15 @@ void Gambit_fn_020911EC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020911EC: ; // 0x20911ec
-        /* 020911EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020911F0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020911EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020911F0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020911F0 */ _t1 = _t0 & 0x00000001u;
         /* 020911F0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020911F0 */ goto L_020911F4;
   L_020911F4: ; // 0x20911f4
         /* 020911F4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020911F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020911F8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020911F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020911F8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020911F8 */ _t3 = _t2 & 0x00000001u;
         /* 020911F8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020911F8 */ goto L_020911FC;
@@ -27820,8 +27820,8 @@ void Gambit_fn_020911EC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -27835,15 +27835,15 @@ void Gambit_fn_020911EC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -27871,15 +27871,15 @@ void Gambit_fn_02091200(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02091200: ; // 0x2091200
-        /* 02091200 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02091204 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091200 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02091204 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091204 */ _t1 = _t0 & 0x00000001u;
         /* 02091204 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02091204 */ goto L_02091208;
   L_02091208: ; // 0x2091208
         /* 02091208 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02091208 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209120C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209120C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209120C */ _t3 = _t2 & 0x00000001u;
         /* 0209120C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209120C */ goto L_02091210;
@@ -27898,8 +27898,8 @@ void Gambit_fn_02091200(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -27913,15 +27913,15 @@ void Gambit_fn_02091200(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -28021,9 +28021,9 @@ void Gambit_fn_02091250(CPUState* cpu) {
         /* 02091254 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 02091254 */ cpu->r[9] = _t0;
         /* 02091258 */ cpu->r[12] = 0x101D0000u;
-        /* 0209125C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0209125C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02091260 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 02091264 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091264 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091264 */ _t2 = _t1 & 0x00000001u;
         /* 02091264 */ if (_t2) goto L_02091268; else goto L_0209127C;
   L_02091268: ; // 0x2091268
@@ -28035,8 +28035,8 @@ void Gambit_fn_02091250(CPUState* cpu) {
         /* 02091278 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 02091278 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_0209127C: ; // 0x209127c
-        /* 0209127C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02091280 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209127C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02091280 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091280 */ _t6 = _t5 & 0x00000001u;
         /* 02091280 */ if (_t6) goto L_02091284; else goto L_0209128C;
   L_02091284: ; // 0x2091284
@@ -28048,9 +28048,9 @@ void Gambit_fn_02091250(CPUState* cpu) {
         /* 02091290 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 02091290 */ cpu->r[7] = _t7;
         /* 02091294 */ cpu->r[11] = 0x101D0000u;
-        /* 02091298 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02091298 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0209129C */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 020912A0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020912A0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020912A0 */ _t9 = _t8 & 0x00000001u;
         /* 020912A0 */ if (_t9) goto L_020912A4; else goto L_020912B8;
   L_020912A4: ; // 0x20912a4
@@ -28135,18 +28135,18 @@ void Gambit_fn_020912F0(CPUState* cpu) {
         /* 0208F9FC */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0208F9FC */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0208FA00 */ cpu->r[12] = 0x00000000u;
-        /* 0208FA04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208FA04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208FA08 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0208FA08 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0208FA0C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FA0C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FA0C */ _t6 = _t5 & 0x00000001u;
         /* 0208FA0C */ if (_t6) goto L_0208FA34; else goto L_0208FA10;
   L_0208FA10: ; // 0x208fa10
         /* 0208FA10 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0208FA10 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0208FA14 */ /* nop */
-        /* 0208FA18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0208FA1C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208FA18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0208FA1C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208FA1C */ _t9 = _t8 & 0x00000001u;
         /* 0208FA1C */ if (_t9) goto L_0208FA20; else goto L_0208FA34;
   L_0208FA20: ; // 0x208fa20
@@ -28194,10 +28194,10 @@ void Gambit_fn_020912FC(CPUState* cpu) {
         /* 0209131C */ cpu->r[31] = 0x101D0000u;
         /* 02091320 */ _t3 = cpu->r[28] + 0x0000001Cu;
         /* 02091320 */ rbrew_write32(cpu->mem, _t3, cpu->r[4]);
-        /* 02091324 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02091324 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02091328 */ _t4 = cpu->r[28] + 0x0000000Fu;
         /* 02091328 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[27]);
-        /* 0209132C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209132C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209132C */ _t6 = _t5 & 0x00000001u;
         /* 0209132C */ if (_t6) goto L_02091370; else goto L_02091330;
   L_02091330: ; // 0x2091330
@@ -28212,16 +28212,16 @@ void Gambit_fn_020912FC(CPUState* cpu) {
         /* 02091344 */ cpu->r[5] = 0x00000004u;
         /* 02091348 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 0209134C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02091350 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02091350 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02091354 */ cpu->r[0] = cpu->r[27];
-        /* 02091358 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02091358 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02091358 */ _t11 = _t10 & 0x00000001u;
         /* 02091358 */ if (_t11) goto L_02091360; else goto L_0209135C;
   L_0209135C: ; // 0x209135c
         /* 0209135C */ cpu->r[0] = 0x00000001u;
   L_02091360: ; // 0x2091360
-        /* 02091360 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02091364 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091360 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02091364 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091364 */ _t13 = _t12 & 0x00000001u;
         /* 02091364 */ if (_t13) goto L_02091370; else goto L_02091368;
   L_02091368: ; // 0x2091368
@@ -28233,9 +28233,9 @@ void Gambit_fn_020912FC(CPUState* cpu) {
         /* 02091370 */ _t16 = cpu->r[28] + 0x00000020u;
         /* 02091370 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 02091374 */ cpu->r[0] = 0x00000000u;
-        /* 02091378 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02091378 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0209137C */ cpu->r[12] = cpu->r[0];
-        /* 02091380 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02091380 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02091380 */ _t18 = _t17 & 0x00000001u;
         /* 02091380 */ if (_t18) goto L_02091384; else goto L_020913A8;
   L_02091384: ; // 0x2091384
@@ -28260,8 +28260,8 @@ void Gambit_fn_020912FC(CPUState* cpu) {
   L_020913A8: ; // 0x20913a8
         /* 020913A8 */ _t26 = cpu->r[28] + 0x0000000Fu;
         /* 020913A8 */ cpu->r[27] = rbrew_read8(cpu->mem, _t26);
-        /* 020913AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020913B0 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020913AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020913B0 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020913B0 */ _t28 = _t27 & 0x00000001u;
         /* 020913B0 */ if (_t28) goto L_020913F4; else goto L_020913B4;
   L_020913B4: ; // 0x20913b4
@@ -28276,16 +28276,16 @@ void Gambit_fn_020912FC(CPUState* cpu) {
         /* 020913C8 */ cpu->r[5] = 0x00000004u;
         /* 020913CC */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020913D0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020913D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020913D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020913D8 */ cpu->r[11] = cpu->r[27];
-        /* 020913DC */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020913DC */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020913DC */ _t33 = _t32 & 0x00000001u;
         /* 020913DC */ if (_t33) goto L_020913E4; else goto L_020913E0;
   L_020913E0: ; // 0x20913e0
         /* 020913E0 */ cpu->r[11] = 0x00000001u;
   L_020913E4: ; // 0x20913e4
-        /* 020913E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020913E8 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020913E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020913E8 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020913E8 */ _t35 = _t34 & 0x00000001u;
         /* 020913E8 */ if (_t35) goto L_020913F4; else goto L_020913EC;
   L_020913EC: ; // 0x20913ec
@@ -28297,9 +28297,9 @@ void Gambit_fn_020912FC(CPUState* cpu) {
         /* 020913F4 */ _t38 = cpu->r[28] + 0x00000028u;
         /* 020913F4 */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 020913F8 */ cpu->r[0] = 0x00000000u;
-        /* 020913FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 020913FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 02091400 */ cpu->r[12] = cpu->r[0];
-        /* 02091404 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02091404 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02091404 */ _t40 = _t39 & 0x00000001u;
         /* 02091404 */ if (_t40) goto L_02091408; else goto L_0209142C;
   L_02091408: ; // 0x2091408
@@ -28324,8 +28324,8 @@ void Gambit_fn_020912FC(CPUState* cpu) {
   L_0209142C: ; // 0x209142c
         /* 0209142C */ _t48 = cpu->r[28] + 0x0000000Fu;
         /* 0209142C */ cpu->r[27] = rbrew_read8(cpu->mem, _t48);
-        /* 02091430 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 02091434 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091430 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 02091434 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091434 */ _t50 = _t49 & 0x00000001u;
         /* 02091434 */ if (_t50) goto L_02091478; else goto L_02091438;
   L_02091438: ; // 0x2091438
@@ -28340,16 +28340,16 @@ void Gambit_fn_020912FC(CPUState* cpu) {
         /* 0209144C */ cpu->r[5] = 0x00000004u;
         /* 02091450 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 02091454 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02091458 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02091458 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0209145C */ cpu->r[10] = cpu->r[27];
-        /* 02091460 */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02091460 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02091460 */ _t55 = _t54 & 0x00000001u;
         /* 02091460 */ if (_t55) goto L_02091468; else goto L_02091464;
   L_02091464: ; // 0x2091464
         /* 02091464 */ cpu->r[10] = 0x00000001u;
   L_02091468: ; // 0x2091468
-        /* 02091468 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209146C */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091468 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209146C */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209146C */ _t57 = _t56 & 0x00000001u;
         /* 0209146C */ if (_t57) goto L_02091478; else goto L_02091470;
   L_02091470: ; // 0x2091470
@@ -28361,9 +28361,9 @@ void Gambit_fn_020912FC(CPUState* cpu) {
         /* 02091478 */ _t60 = cpu->r[28] + 0x00000030u;
         /* 02091478 */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
         /* 0209147C */ cpu->r[0] = 0x00000000u;
-        /* 02091480 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02091480 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02091484 */ cpu->r[5] = cpu->r[0];
-        /* 02091488 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02091488 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02091488 */ _t62 = _t61 & 0x00000001u;
         /* 02091488 */ if (_t62) goto L_0209148C; else goto L_020914B0;
   L_0209148C: ; // 0x209148c
@@ -28388,8 +28388,8 @@ void Gambit_fn_020912FC(CPUState* cpu) {
   L_020914B0: ; // 0x20914b0
         /* 020914B0 */ _t70 = cpu->r[30] + 0x00000000u;
         /* 020914B0 */ cpu->r[25] = rbrew_read8(cpu->mem, _t70);
-        /* 020914B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 020914B8 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020914B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 020914B8 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020914B8 */ _t72 = _t71 & 0x00000001u;
         /* 020914B8 */ if (_t72) goto L_02091594; else goto L_020914BC;
   L_020914BC: ; // 0x20914bc
@@ -28405,10 +28405,10 @@ void Gambit_fn_020912FC(CPUState* cpu) {
         /* 020914D4 */ cpu->r[4] = (uint32_t)((int32_t)cpu->r[25] * (int32_t)0x00000024u);
         /* 020914D8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020914DC */ cpu->r[24] = cpu->r[3];
-        /* 020914E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 020914E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 020914E4 */ cpu->r[30] = cpu->r[25];
         /* 020914E8 */ cpu->r[7] = 0x00000000u;
-        /* 020914EC */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020914EC */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020914EC */ _t77 = _t76 & 0x00000001u;
         /* 020914EC */ if (_t77) goto L_020914F4; else goto L_020914F0;
   L_020914F0: ; // 0x20914f0
@@ -28421,36 +28421,36 @@ void Gambit_fn_020912FC(CPUState* cpu) {
         /* 02091500 */ cpu->r[23] = 0x00000018u;
   L_02091504: ; // 0x2091504
         /* 02091504 */ cpu->r[27] = cpu->r[24] + cpu->r[22];
-        /* 02091504 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 02091508 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091504 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 02091508 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091508 */ _t80 = _t79 & 0x00000001u;
         /* 02091508 */ if (_t80) goto L_02091578; else goto L_0209150C;
   L_0209150C: ; // 0x209150c
         /* 0209150C */ cpu->r[26] = cpu->r[27];
-        /* 0209150C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 02091510 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209150C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 02091510 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091510 */ _t82 = _t81 & 0x00000001u;
         /* 02091510 */ if (_t82) goto L_02091514; else goto L_02091524;
   L_02091514: ; // 0x2091514
         /* 02091514 */ cpu->r[3] = 0x00000024u;
         /* 02091518 */ Gambit_fn_02801A78(cpu);
         /* 0209151C */ cpu->r[26] = cpu->r[3];
-        /* 0209151C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 02091520 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209151C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 02091520 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091520 */ _t84 = _t83 & 0x00000001u;
         /* 02091520 */ if (_t84) goto L_0209156C; else goto L_02091524;
   L_02091524: ; // 0x2091524
         /* 02091524 */ cpu->r[11] = cpu->r[26];
-        /* 02091524 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02091528 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02091528 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091528 */ _t86 = _t85 & 0x00000001u;
         /* 02091528 */ if (_t86) goto L_0209152C; else goto L_0209153C;
   L_0209152C: ; // 0x209152c
         /* 0209152C */ cpu->r[3] = 0x0000000Cu;
         /* 02091530 */ Gambit_fn_02801A78(cpu);
         /* 02091534 */ cpu->r[11] = cpu->r[3];
-        /* 02091534 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02091538 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091534 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02091538 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091538 */ _t88 = _t87 & 0x00000001u;
         /* 02091538 */ if (_t88) goto L_02091558; else goto L_0209153C;
   L_0209153C: ; // 0x209153c
@@ -28481,14 +28481,14 @@ void Gambit_fn_020912FC(CPUState* cpu) {
         /* 02091574 */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
   L_02091578: ; // 0x2091578
         /* 02091578 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 02091578 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02091578 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209157C */ cpu->r[22] = cpu->r[22] + 0x00000024u;
-        /* 02091580 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091580 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091580 */ _t98 = _t97 & 0x00000001u;
         /* 02091580 */ if (_t98) goto L_02091584; else goto L_02091504;
   L_02091584: ; // 0x2091584
-        /* 02091584 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 02091588 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 02091588 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091588 */ _t100 = _t99 & 0x00000001u;
         /* 02091588 */ if (_t100) goto L_02091594; else goto L_0209158C;
   L_0209158C: ; // 0x209158c
@@ -28518,10 +28518,10 @@ void Gambit_fn_020915AC(CPUState* cpu) {
         /* 020915B0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 020915B4 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 020915B4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 020915B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[12]);
+        /* 020915B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[12]));
         /* 020915BC */ _t3 = cpu->r[4] + 0x00000000u;
         /* 020915BC */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 020915C0 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020915C0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020915C0 */ _t5 = _t4 & 0x00000001u;
         /* 020915C0 */ if (_t5) goto L_020915C4; else goto L_020915CC;
   L_020915C4: ; // 0x20915c4
@@ -28538,10 +28538,10 @@ void Gambit_fn_020915AC(CPUState* cpu) {
         /* 020915D8 */ cpu->r[9] = rbrew_read8(cpu->mem, _t9);
         /* 020915DC */ _t10 = cpu->r[3] + 0x00000028u;
         /* 020915DC */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 020915E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
+        /* 020915E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
         /* 020915E4 */ _t11 = cpu->r[3] + 0x0000002Cu;
         /* 020915E4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
-        /* 020915E8 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020915E8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020915E8 */ _t13 = _t12 & 0x00000001u;
         /* 020915E8 */ if (_t13) goto L_020915EC; else goto L_020915F4;
   L_020915EC: ; // 0x20915ec
@@ -28562,10 +28562,10 @@ void Gambit_fn_020915AC(CPUState* cpu) {
         /* 02091608 */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
         /* 0209160C */ _t20 = cpu->r[3] + 0x00000034u;
         /* 0209160C */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 02091610 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
+        /* 02091610 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
         /* 02091614 */ _t21 = cpu->r[6] + 0x00000000u;
         /* 02091614 */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
-        /* 02091618 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02091618 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02091618 */ _t23 = _t22 & 0x00000001u;
         /* 02091618 */ if (_t23) goto L_0209161C; else goto L_02091624;
   L_0209161C: ; // 0x209161c
@@ -28594,18 +28594,18 @@ void Gambit_fn_02091638(CPUState* cpu) {
         /* 02091640 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02091640 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02091644 */ cpu->r[31] = cpu->r[3];
-        /* 02091644 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02091644 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02091648 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02091648 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209164C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209164C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209164C */ _t5 = _t4 & 0x00000001u;
         /* 0209164C */ if (_t5) goto L_02091650; else goto L_02091660;
   L_02091650: ; // 0x2091650
         /* 02091650 */ cpu->r[3] = 0x00000070u;
         /* 02091654 */ Gambit_fn_02801A78(cpu);
         /* 02091658 */ cpu->r[31] = cpu->r[3];
-        /* 02091658 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209165C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091658 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209165C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209165C */ _t7 = _t6 & 0x00000001u;
         /* 0209165C */ if (_t7) goto L_020916CC; else goto L_02091660;
   L_02091660: ; // 0x2091660
@@ -28613,19 +28613,19 @@ void Gambit_fn_02091638(CPUState* cpu) {
         /* 02091664 */ Gambit_fn_02000020(cpu);
         /* 02091668 */ cpu->r[0] = 0x10010000u;
         /* 0209166C */ cpu->r[3] = cpu->r[31] + 0x00000050u;
-        /* 0209166C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0209166C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02091670 */ cpu->r[0] = cpu->r[0] + 0xFFFFE7ACu;
         /* 02091674 */ cpu->r[30] = 0x00000000u;
         /* 02091678 */ _t8 = cpu->r[31] + 0x00000004u;
         /* 02091678 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
-        /* 0209167C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209167C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209167C */ _t10 = _t9 & 0x00000001u;
         /* 0209167C */ if (_t10) goto L_02091680; else goto L_02091690;
   L_02091680: ; // 0x2091680
         /* 02091680 */ cpu->r[3] = 0x00000010u;
         /* 02091684 */ Gambit_fn_02801A78(cpu);
-        /* 02091688 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209168C */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091688 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209168C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209168C */ _t12 = _t11 & 0x00000001u;
         /* 0209168C */ if (_t12) goto L_020916B8; else goto L_02091690;
   L_02091690: ; // 0x2091690
@@ -28715,10 +28715,10 @@ void Gambit_fn_02091708(CPUState* cpu) {
         /* 0209172C */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02091730 */ _t3 = cpu->r[31] + 0x00000060u;
         /* 02091730 */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
-        /* 02091734 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02091734 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02091738 */ _t4 = cpu->r[1] + 0x00000008u;
         /* 02091738 */ rbrew_write32(cpu->mem, _t4, cpu->r[3]);
-        /* 0209173C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209173C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209173C */ _t6 = _t5 & 0x00000001u;
         /* 0209173C */ if (_t6) goto L_020917E0; else goto L_02091740;
   L_02091740: ; // 0x2091740
@@ -28728,8 +28728,8 @@ void Gambit_fn_02091708(CPUState* cpu) {
         /* 0209174C */ _t7 = cpu->r[1] + 0x00000010u;
         /* 0209174C */ rbrew_write32(cpu->mem, _t7, cpu->r[11]);
         /* 02091750 */ Gambit_fn_0208ECE4(cpu);
-        /* 02091754 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02091758 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091754 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02091758 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091758 */ _t9 = _t8 & 0x00000001u;
         /* 02091758 */ if (_t9) goto L_020917E0; else goto L_0209175C;
   L_0209175C: ; // 0x209175c
@@ -28739,19 +28739,19 @@ void Gambit_fn_02091708(CPUState* cpu) {
         /* 02091764 */ cpu->r[26] = 0x101C0000u;
         /* 02091768 */ cpu->r[27] = cpu->r[27] + 0x00000001u;
         /* 0209176C */ cpu->r[31] = 0x10010000u;
-        /* 02091770 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
+        /* 02091770 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
         /* 02091774 */ cpu->r[28] = 0x10110000u;
         /* 02091778 */ cpu->r[31] = cpu->r[31] + 0xFFFFE6D0u;
-        /* 0209177C */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209177C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209177C */ _t12 = _t11 & 0x00000001u;
         /* 0209177C */ if (_t12) goto L_02091780; else goto L_020917F8;
   L_02091780: ; // 0x2091780
-        /* 02091780 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
-        /* 02091784 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02091780 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
+        /* 02091784 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02091784 */ _t14 = _t13 & 0x00000001u;
         /* 02091784 */ if (_t14) goto L_02091824; else goto L_02091788;
   L_02091788: ; // 0x2091788
-        /* 02091788 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091788 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091788 */ _t16 = _t15 & 0x00000001u;
         /* 02091788 */ if (_t16) goto L_02091838; else goto L_0209178C;
   L_0209178C: ; // 0x209178c
@@ -28784,8 +28784,8 @@ void Gambit_fn_02091708(CPUState* cpu) {
         /* 020917D0 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020917D4 */ _t26 = cpu->r[1] + 0x0000001Cu;
         /* 020917D4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t26);
-        /* 020917D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[8]);
-        /* 020917DC */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020917D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[8]));
+        /* 020917DC */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020917DC */ _t28 = _t27 & 0x00000001u;
         /* 020917DC */ if (_t28) goto L_020917E0; else goto L_020918D4;
   L_020917E0: ; // 0x20917e0
@@ -28797,17 +28797,17 @@ void Gambit_fn_02091708(CPUState* cpu) {
         /* 020917F0 */ cpu->r[3] = 0x00000000u;
         /* 020917F4 */ return;
   L_020917F8: ; // 0x20917f8
-        /* 020917F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000006u);
-        /* 020917FC */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020917F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000006u));
+        /* 020917FC */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020917FC */ _t31 = _t30 & 0x00000001u;
         /* 020917FC */ if (_t31) goto L_0209191C; else goto L_02091800;
   L_02091800: ; // 0x2091800
-        /* 02091800 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091800 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091800 */ _t33 = _t32 & 0x00000001u;
         /* 02091800 */ if (_t33) goto L_020919B8; else goto L_02091804;
   L_02091804: ; // 0x2091804
-        /* 02091804 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000000Au);
-        /* 02091808 */ _t34 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02091804 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000000Au));
+        /* 02091808 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02091808 */ _t35 = _t34 & 0x00000001u;
         /* 02091808 */ if (_t35) goto L_0209180C; else goto L_02091A54;
   L_0209180C: ; // 0x209180c
@@ -28856,8 +28856,8 @@ void Gambit_fn_02091708(CPUState* cpu) {
         /* 0209187C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02091880 */ _t48 = cpu->r[1] + 0x00000014u;
         /* 02091880 */ cpu->r[7] = rbrew_read32(cpu->mem, _t48);
-        /* 02091884 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[7]);
-        /* 02091888 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091884 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[7]));
+        /* 02091888 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091888 */ _t50 = _t49 & 0x00000001u;
         /* 02091888 */ if (_t50) goto L_020917E0; else goto L_0209188C;
   L_0209188C: ; // 0x209188c
@@ -28875,13 +28875,13 @@ void Gambit_fn_02091708(CPUState* cpu) {
         /* 020918A4 */ _t55 = cpu->r[9] + 0x00000001u;
         /* 020918A4 */ cpu->r[8] = rbrew_read8(cpu->mem, _t55);
         /* 020918A4 */ cpu->r[9] = _t55;
-        /* 020918A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
-        /* 020918AC */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020918A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
+        /* 020918AC */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020918AC */ _t57 = _t56 & 0x00000001u;
         /* 020918AC */ if (_t57) goto L_020918B0; else goto L_020918C0;
   L_020918B0: ; // 0x20918b0
-        /* 020918B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
-        /* 020918B4 */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020918B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
+        /* 020918B4 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020918B4 */ _t59 = _t58 & 0x00000001u;
         /* 020918B4 */ if (_t59) goto L_020917E0; else goto L_020918B8;
   L_020918B8: ; // 0x20918b8
@@ -28915,13 +28915,13 @@ void Gambit_fn_02091708(CPUState* cpu) {
         /* 020918EC */ _t70 = cpu->r[12] + 0x00000001u;
         /* 020918EC */ cpu->r[9] = rbrew_read8(cpu->mem, _t70);
         /* 020918EC */ cpu->r[12] = _t70;
-        /* 020918F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[9]);
-        /* 020918F4 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020918F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[9]));
+        /* 020918F4 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020918F4 */ _t72 = _t71 & 0x00000001u;
         /* 020918F4 */ if (_t72) goto L_020918F8; else goto L_02091908;
   L_020918F8: ; // 0x20918f8
-        /* 020918F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[10]);
-        /* 020918FC */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020918F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[10]));
+        /* 020918FC */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020918FC */ _t74 = _t73 & 0x00000001u;
         /* 020918FC */ if (_t74) goto L_020917E0; else goto L_02091900;
   L_02091900: ; // 0x2091900
@@ -28970,8 +28970,8 @@ void Gambit_fn_02091708(CPUState* cpu) {
         /* 02091960 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02091964 */ _t90 = cpu->r[1] + 0x00000024u;
         /* 02091964 */ cpu->r[0] = rbrew_read32(cpu->mem, _t90);
-        /* 02091968 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
-        /* 0209196C */ _t91 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091968 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
+        /* 0209196C */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209196C */ _t92 = _t91 & 0x00000001u;
         /* 0209196C */ if (_t92) goto L_020917E0; else goto L_02091970;
   L_02091970: ; // 0x2091970
@@ -28989,13 +28989,13 @@ void Gambit_fn_02091708(CPUState* cpu) {
         /* 02091988 */ _t97 = cpu->r[5] + 0x00000001u;
         /* 02091988 */ cpu->r[12] = rbrew_read8(cpu->mem, _t97);
         /* 02091988 */ cpu->r[5] = _t97;
-        /* 0209198C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[12]);
-        /* 02091990 */ _t98 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209198C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[12]));
+        /* 02091990 */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091990 */ _t99 = _t98 & 0x00000001u;
         /* 02091990 */ if (_t99) goto L_02091994; else goto L_020919A4;
   L_02091994: ; // 0x2091994
-        /* 02091994 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[0]);
-        /* 02091998 */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091994 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[0]));
+        /* 02091998 */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091998 */ _t101 = _t100 & 0x00000001u;
         /* 02091998 */ if (_t101) goto L_020917E0; else goto L_0209199C;
   L_0209199C: ; // 0x209199c
@@ -29044,8 +29044,8 @@ void Gambit_fn_02091708(CPUState* cpu) {
         /* 020919FC */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02091A00 */ _t117 = cpu->r[1] + 0x0000002Cu;
         /* 02091A00 */ cpu->r[0] = rbrew_read32(cpu->mem, _t117);
-        /* 02091A04 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
-        /* 02091A08 */ _t118 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091A04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
+        /* 02091A08 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091A08 */ _t119 = _t118 & 0x00000001u;
         /* 02091A08 */ if (_t119) goto L_020917E0; else goto L_02091A0C;
   L_02091A0C: ; // 0x2091a0c
@@ -29063,13 +29063,13 @@ void Gambit_fn_02091708(CPUState* cpu) {
         /* 02091A24 */ _t124 = cpu->r[7] + 0x00000001u;
         /* 02091A24 */ cpu->r[6] = rbrew_read8(cpu->mem, _t124);
         /* 02091A24 */ cpu->r[7] = _t124;
-        /* 02091A28 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[6]);
-        /* 02091A2C */ _t125 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091A28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[6]));
+        /* 02091A2C */ _t125 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091A2C */ _t126 = _t125 & 0x00000001u;
         /* 02091A2C */ if (_t126) goto L_02091A30; else goto L_02091A40;
   L_02091A30: ; // 0x2091a30
-        /* 02091A30 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[5]);
-        /* 02091A34 */ _t127 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091A30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[5]));
+        /* 02091A34 */ _t127 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091A34 */ _t128 = _t127 & 0x00000001u;
         /* 02091A34 */ if (_t128) goto L_020917E0; else goto L_02091A38;
   L_02091A38: ; // 0x2091a38
@@ -29136,8 +29136,8 @@ void Gambit_fn_02091A80(CPUState* cpu) {
         /* 02091ABC */ rbrew_write32(cpu->mem, _t5, cpu->r[29]);
         /* 02091AC0 */ Gambit_fn_02091708(cpu);
         /* 02091AC4 */ cpu->r[30] = cpu->r[3];
-        /* 02091AC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02091AC8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091AC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02091AC8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091AC8 */ _t7 = _t6 & 0x00000001u;
         /* 02091AC8 */ if (_t7) goto L_02091CC0; else goto L_02091ACC;
   L_02091ACC: ; // 0x2091acc
@@ -29175,9 +29175,9 @@ void Gambit_fn_02091A80(CPUState* cpu) {
         /* 02091B20 */ cpu->r[10] = rbrew_read32(cpu->mem, _t17);
         /* 02091B24 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
         /* 02091B28 */ cpu->r[8] = 0x10010000u;
-        /* 02091B2C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[10]);
+        /* 02091B2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[10]));
         /* 02091B30 */ cpu->r[8] = cpu->r[8] + 0xFFFFE744u;
-        /* 02091B34 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091B34 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091B34 */ _t19 = _t18 & 0x00000001u;
         /* 02091B34 */ if (_t19) goto L_02091B70; else goto L_02091B38;
   L_02091B38: ; // 0x2091b38
@@ -29195,13 +29195,13 @@ void Gambit_fn_02091A80(CPUState* cpu) {
         /* 02091B50 */ _t24 = cpu->r[11] + 0x00000001u;
         /* 02091B50 */ cpu->r[0] = rbrew_read8(cpu->mem, _t24);
         /* 02091B50 */ cpu->r[11] = _t24;
-        /* 02091B54 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[0]);
-        /* 02091B58 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091B54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[0]));
+        /* 02091B58 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091B58 */ _t26 = _t25 & 0x00000001u;
         /* 02091B58 */ if (_t26) goto L_02091B5C; else goto L_02091C1C;
   L_02091B5C: ; // 0x2091b5c
-        /* 02091B5C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[31]);
-        /* 02091B60 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091B5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[31]));
+        /* 02091B60 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091B60 */ _t28 = _t27 & 0x00000001u;
         /* 02091B60 */ if (_t28) goto L_02091B70; else goto L_02091B64;
   L_02091B64: ; // 0x2091b64
@@ -29243,8 +29243,8 @@ void Gambit_fn_02091A80(CPUState* cpu) {
         /* 02091BB4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02091BB8 */ _t41 = cpu->r[1] + 0x00000020u;
         /* 02091BB8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t41);
-        /* 02091BBC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 02091BC0 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091BBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 02091BC0 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091BC0 */ _t43 = _t42 & 0x00000001u;
         /* 02091BC0 */ if (_t43) goto L_02091C0C; else goto L_02091BC4;
   L_02091BC4: ; // 0x2091bc4
@@ -29262,13 +29262,13 @@ void Gambit_fn_02091A80(CPUState* cpu) {
         /* 02091BDC */ _t48 = cpu->r[11] + 0x00000001u;
         /* 02091BDC */ cpu->r[8] = rbrew_read8(cpu->mem, _t48);
         /* 02091BDC */ cpu->r[11] = _t48;
-        /* 02091BE0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[8]);
-        /* 02091BE4 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091BE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[8]));
+        /* 02091BE4 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091BE4 */ _t50 = _t49 & 0x00000001u;
         /* 02091BE4 */ if (_t50) goto L_02091BE8; else goto L_02091BF8;
   L_02091BE8: ; // 0x2091be8
-        /* 02091BE8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[0]);
-        /* 02091BEC */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091BE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[0]));
+        /* 02091BEC */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091BEC */ _t52 = _t51 & 0x00000001u;
         /* 02091BEC */ if (_t52) goto L_02091C0C; else goto L_02091BF0;
   L_02091BF0: ; // 0x2091bf0
@@ -29319,8 +29319,8 @@ void Gambit_fn_02091A80(CPUState* cpu) {
         /* 02091C60 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02091C64 */ _t65 = cpu->r[1] + 0x00000028u;
         /* 02091C64 */ cpu->r[10] = rbrew_read32(cpu->mem, _t65);
-        /* 02091C68 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[10]);
-        /* 02091C6C */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091C68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[10]));
+        /* 02091C6C */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091C6C */ _t67 = _t66 & 0x00000001u;
         /* 02091C6C */ if (_t67) goto L_02091CA4; else goto L_02091C70;
   L_02091C70: ; // 0x2091c70
@@ -29336,13 +29336,13 @@ void Gambit_fn_02091A80(CPUState* cpu) {
         /* 02091C84 */ _t71 = cpu->r[8] + 0x00000001u;
         /* 02091C84 */ cpu->r[0] = rbrew_read8(cpu->mem, _t71);
         /* 02091C84 */ cpu->r[8] = _t71;
-        /* 02091C88 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[0]);
-        /* 02091C8C */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091C88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[0]));
+        /* 02091C8C */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091C8C */ _t73 = _t72 & 0x00000001u;
         /* 02091C8C */ if (_t73) goto L_02091C90; else goto L_02091CB4;
   L_02091C90: ; // 0x2091c90
-        /* 02091C90 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[31]);
-        /* 02091C94 */ _t74 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091C90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[31]));
+        /* 02091C94 */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091C94 */ _t75 = _t74 & 0x00000001u;
         /* 02091C94 */ if (_t75) goto L_02091CA4; else goto L_02091C98;
   L_02091C98: ; // 0x2091c98
@@ -29395,10 +29395,10 @@ void Gambit_fn_02091CD8(CPUState* cpu) {
         /* 02091CF8 */ _t4 = cpu->r[1] + 0x00000008u;
         /* 02091CF8 */ rbrew_write32(cpu->mem, _t4, cpu->r[3]);
         /* 02091CFC */ cpu->r[31] = cpu->r[31] + 0xFFFFE678u;
-        /* 02091D00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02091D00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02091D04 */ _t5 = cpu->r[1] + 0x0000000Cu;
         /* 02091D04 */ rbrew_write32(cpu->mem, _t5, cpu->r[31]);
-        /* 02091D08 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091D08 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091D08 */ _t7 = _t6 & 0x00000001u;
         /* 02091D08 */ if (_t7) goto L_02091DF0; else goto L_02091D0C;
   L_02091D0C: ; // 0x2091d0c
@@ -29408,20 +29408,20 @@ void Gambit_fn_02091CD8(CPUState* cpu) {
         /* 02091D18 */ _t8 = cpu->r[1] + 0x00000010u;
         /* 02091D18 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 02091D1C */ Gambit_fn_0208ECE4(cpu);
-        /* 02091D20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02091D24 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091D20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02091D24 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091D24 */ _t10 = _t9 & 0x00000001u;
         /* 02091D24 */ if (_t10) goto L_02091DF0; else goto L_02091D28;
   L_02091D28: ; // 0x2091d28
         /* 02091D28 */ _t11 = cpu->r[1] + 0x00000010u;
         /* 02091D28 */ cpu->r[0] = rbrew_read32(cpu->mem, _t11);
-        /* 02091D2C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
-        /* 02091D30 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02091D2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
+        /* 02091D30 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02091D30 */ _t13 = _t12 & 0x00000001u;
         /* 02091D30 */ if (_t13) goto L_02091DD8; else goto L_02091D34;
   L_02091D34: ; // 0x2091d34
-        /* 02091D34 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000006u);
-        /* 02091D38 */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02091D34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000006u));
+        /* 02091D38 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02091D38 */ _t15 = _t14 & 0x00000001u;
         /* 02091D38 */ if (_t15) goto L_02091DD8; else goto L_02091D3C;
   L_02091D3C: ; // 0x2091d3c
@@ -29456,8 +29456,8 @@ void Gambit_fn_02091CD8(CPUState* cpu) {
         /* 02091D88 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02091D8C */ _t25 = cpu->r[1] + 0x00000014u;
         /* 02091D8C */ cpu->r[8] = rbrew_read32(cpu->mem, _t25);
-        /* 02091D90 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[8]);
-        /* 02091D94 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091D90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[8]));
+        /* 02091D94 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091D94 */ _t27 = _t26 & 0x00000001u;
         /* 02091D94 */ if (_t27) goto L_02091DF0; else goto L_02091D98;
   L_02091D98: ; // 0x2091d98
@@ -29478,13 +29478,13 @@ void Gambit_fn_02091CD8(CPUState* cpu) {
         /* 02091DBC */ _t32 = cpu->r[8] + 0x00000001u;
         /* 02091DBC */ cpu->r[9] = rbrew_read8(cpu->mem, _t32);
         /* 02091DBC */ cpu->r[8] = _t32;
-        /* 02091DC0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[9]);
-        /* 02091DC4 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091DC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[9]));
+        /* 02091DC4 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091DC4 */ _t34 = _t33 & 0x00000001u;
         /* 02091DC4 */ if (_t34) goto L_02091DC8; else goto L_02091DD8;
   L_02091DC8: ; // 0x2091dc8
-        /* 02091DC8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 02091DCC */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091DC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 02091DCC */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091DCC */ _t36 = _t35 & 0x00000001u;
         /* 02091DCC */ if (_t36) goto L_02091DF0; else goto L_02091DD0;
   L_02091DD0: ; // 0x2091dd0
@@ -29534,10 +29534,10 @@ void Gambit_fn_02091CDC(CPUState* cpu) {
         /* 02091CF8 */ _t4 = cpu->r[1] + 0x00000008u;
         /* 02091CF8 */ rbrew_write32(cpu->mem, _t4, cpu->r[3]);
         /* 02091CFC */ cpu->r[31] = cpu->r[31] + 0xFFFFE678u;
-        /* 02091D00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02091D00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02091D04 */ _t5 = cpu->r[1] + 0x0000000Cu;
         /* 02091D04 */ rbrew_write32(cpu->mem, _t5, cpu->r[31]);
-        /* 02091D08 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091D08 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091D08 */ _t7 = _t6 & 0x00000001u;
         /* 02091D08 */ if (_t7) goto L_02091DF0; else goto L_02091D0C;
   L_02091D0C: ; // 0x2091d0c
@@ -29547,20 +29547,20 @@ void Gambit_fn_02091CDC(CPUState* cpu) {
         /* 02091D18 */ _t8 = cpu->r[1] + 0x00000010u;
         /* 02091D18 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 02091D1C */ Gambit_fn_0208ECE4(cpu);
-        /* 02091D20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02091D24 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091D20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02091D24 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091D24 */ _t10 = _t9 & 0x00000001u;
         /* 02091D24 */ if (_t10) goto L_02091DF0; else goto L_02091D28;
   L_02091D28: ; // 0x2091d28
         /* 02091D28 */ _t11 = cpu->r[1] + 0x00000010u;
         /* 02091D28 */ cpu->r[0] = rbrew_read32(cpu->mem, _t11);
-        /* 02091D2C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
-        /* 02091D30 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02091D2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
+        /* 02091D30 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02091D30 */ _t13 = _t12 & 0x00000001u;
         /* 02091D30 */ if (_t13) goto L_02091DD8; else goto L_02091D34;
   L_02091D34: ; // 0x2091d34
-        /* 02091D34 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000006u);
-        /* 02091D38 */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02091D34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000006u));
+        /* 02091D38 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02091D38 */ _t15 = _t14 & 0x00000001u;
         /* 02091D38 */ if (_t15) goto L_02091DD8; else goto L_02091D3C;
   L_02091D3C: ; // 0x2091d3c
@@ -29595,8 +29595,8 @@ void Gambit_fn_02091CDC(CPUState* cpu) {
         /* 02091D88 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02091D8C */ _t25 = cpu->r[1] + 0x00000014u;
         /* 02091D8C */ cpu->r[8] = rbrew_read32(cpu->mem, _t25);
-        /* 02091D90 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[8]);
-        /* 02091D94 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091D90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[8]));
+        /* 02091D94 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091D94 */ _t27 = _t26 & 0x00000001u;
         /* 02091D94 */ if (_t27) goto L_02091DF0; else goto L_02091D98;
   L_02091D98: ; // 0x2091d98
@@ -29617,13 +29617,13 @@ void Gambit_fn_02091CDC(CPUState* cpu) {
         /* 02091DBC */ _t32 = cpu->r[8] + 0x00000001u;
         /* 02091DBC */ cpu->r[9] = rbrew_read8(cpu->mem, _t32);
         /* 02091DBC */ cpu->r[8] = _t32;
-        /* 02091DC0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[9]);
-        /* 02091DC4 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091DC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[9]));
+        /* 02091DC4 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091DC4 */ _t34 = _t33 & 0x00000001u;
         /* 02091DC4 */ if (_t34) goto L_02091DC8; else goto L_02091DD8;
   L_02091DC8: ; // 0x2091dc8
-        /* 02091DC8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 02091DCC */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091DC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 02091DCC */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091DCC */ _t36 = _t35 & 0x00000001u;
         /* 02091DCC */ if (_t36) goto L_02091DF0; else goto L_02091DD0;
   L_02091DD0: ; // 0x2091dd0
@@ -29677,8 +29677,8 @@ void Gambit_fn_02091E08(CPUState* cpu) {
         /* 0208ED70 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208ED74 */ cpu->r[4] = 0x00000000u;
         /* 0208ED78 */ Gambit_fn_020DAD84(cpu);
-        /* 0208ED7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208ED80 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208ED7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208ED80 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208ED80 */ _t7 = _t6 & 0x00000001u;
         /* 0208ED80 */ if (_t7) goto L_0208ED84; else goto L_0208EE14;
   L_0208ED84: ; // 0x208ed84
@@ -29692,8 +29692,8 @@ void Gambit_fn_02091E08(CPUState* cpu) {
         /* 0208ED94 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208ED98 */ cpu->r[4] = 0x00000000u;
         /* 0208ED9C */ Gambit_fn_020DAD84(cpu);
-        /* 0208EDA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EDA4 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EDA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EDA4 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EDA4 */ _t12 = _t11 & 0x00000001u;
         /* 0208EDA4 */ if (_t12) goto L_0208EDA8; else goto L_0208EE14;
   L_0208EDA8: ; // 0x208eda8
@@ -29707,8 +29707,8 @@ void Gambit_fn_02091E08(CPUState* cpu) {
         /* 0208EDB8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208EDBC */ cpu->r[4] = 0x00000000u;
         /* 0208EDC0 */ Gambit_fn_020DAD84(cpu);
-        /* 0208EDC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EDC8 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EDC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EDC8 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EDC8 */ _t17 = _t16 & 0x00000001u;
         /* 0208EDC8 */ if (_t17) goto L_0208EDCC; else goto L_0208EE14;
   L_0208EDCC: ; // 0x208edcc
@@ -29722,8 +29722,8 @@ void Gambit_fn_02091E08(CPUState* cpu) {
         /* 0208EDDC */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208EDE0 */ cpu->r[4] = 0x00000000u;
         /* 0208EDE4 */ Gambit_fn_020DAD84(cpu);
-        /* 0208EDE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EDEC */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EDE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EDEC */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EDEC */ _t22 = _t21 & 0x00000001u;
         /* 0208EDEC */ if (_t22) goto L_0208EDF0; else goto L_0208EE14;
   L_0208EDF0: ; // 0x208edf0
@@ -29737,8 +29737,8 @@ void Gambit_fn_02091E08(CPUState* cpu) {
         /* 0208EE00 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0208EE04 */ cpu->r[4] = 0x00000000u;
         /* 0208EE08 */ Gambit_fn_020DAD84(cpu);
-        /* 0208EE0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0208EE10 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208EE0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0208EE10 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208EE10 */ _t27 = _t26 & 0x00000001u;
         /* 0208EE10 */ if (_t27) goto L_0208EE2C; else goto L_0208EE14;
   L_0208EE14: ; // 0x208ee14
@@ -29763,8 +29763,8 @@ void Gambit_fn_02091E08(CPUState* cpu) {
         /* 02091E08 */ _t32 = cpu->r[3] + 0x00000060u;
         /* 02091E08 */ cpu->r[0] = rbrew_read32(cpu->mem, _t32);
         /* 02091E0C */ cpu->r[3] = 0x00000000u;
-        /* 02091E10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02091E14 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091E10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02091E14 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091E14 */ _t34 = _t33 & 0x00000001u;
         /* 02091E14 */ if (_t34) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02091E14 */ goto L_02091E18;
@@ -29788,9 +29788,9 @@ void Gambit_fn_02091E20(CPUState* cpu) {
         /* 02091E2C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02091E30 */ _t3 = cpu->r[3] + 0x00000060u;
         /* 02091E30 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
-        /* 02091E34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02091E34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02091E38 */ cpu->r[31] = cpu->r[4];
-        /* 02091E3C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091E3C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091E3C */ _t5 = _t4 & 0x00000001u;
         /* 02091E3C */ if (_t5) goto L_02091F5C; else goto L_02091E40;
   L_02091E40: ; // 0x2091e40
@@ -29799,54 +29799,54 @@ void Gambit_fn_02091E20(CPUState* cpu) {
         /* 02091E48 */ _t6 = cpu->r[1] + 0x00000008u;
         /* 02091E48 */ rbrew_write32(cpu->mem, _t6, cpu->r[11]);
         /* 02091E4C */ Gambit_fn_0208ECE4(cpu);
-        /* 02091E50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02091E54 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091E50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02091E54 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091E54 */ _t8 = _t7 & 0x00000001u;
         /* 02091E54 */ if (_t8) goto L_02091F5C; else goto L_02091E58;
   L_02091E58: ; // 0x2091e58
         /* 02091E58 */ _t9 = cpu->r[1] + 0x00000008u;
         /* 02091E58 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 02091E5C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
-        /* 02091E60 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02091E5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
+        /* 02091E60 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02091E60 */ _t11 = _t10 & 0x00000001u;
         /* 02091E60 */ if (_t11) goto L_02091F5C; else goto L_02091E64;
   L_02091E64: ; // 0x2091e64
-        /* 02091E64 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091E64 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091E64 */ _t13 = _t12 & 0x00000001u;
         /* 02091E64 */ if (_t13) goto L_02091E8C; else goto L_02091E68;
   L_02091E68: ; // 0x2091e68
-        /* 02091E68 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
-        /* 02091E6C */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02091E68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
+        /* 02091E6C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02091E6C */ _t15 = _t14 & 0x00000001u;
         /* 02091E6C */ if (_t15) goto L_02091EC0; else goto L_02091E70;
   L_02091E70: ; // 0x2091e70
-        /* 02091E70 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091E70 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091E70 */ _t17 = _t16 & 0x00000001u;
         /* 02091E70 */ if (_t17) goto L_02091EF4; else goto L_02091E74;
   L_02091E74: ; // 0x2091e74
-        /* 02091E74 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000006u);
-        /* 02091E78 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091E74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000006u));
+        /* 02091E78 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091E78 */ _t19 = _t18 & 0x00000001u;
         /* 02091E78 */ if (_t19) goto L_02091F28; else goto L_02091E7C;
   L_02091E7C: ; // 0x2091e7c
-        /* 02091E7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02091E7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02091E80 */ cpu->r[3] = cpu->r[31];
-        /* 02091E84 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091E84 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091E84 */ _t21 = _t20 & 0x00000001u;
         /* 02091E84 */ if (_t21) goto L_02091F68; else goto L_02091E88;
   L_02091E88: ; // 0x2091e88
         /* 02091E88 */ goto L_02091F78;
   L_02091E8C: ; // 0x2091e8c
-        /* 02091E8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02091E90 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091E8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02091E90 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091E90 */ _t23 = _t22 & 0x00000001u;
         /* 02091E90 */ if (_t23) goto L_02091E94; else goto L_02091EA4;
   L_02091E94: ; // 0x2091e94
         /* 02091E94 */ cpu->r[3] = 0x00000004u;
         /* 02091E98 */ Gambit_fn_02801A78(cpu);
         /* 02091E9C */ cpu->r[31] = cpu->r[3];
-        /* 02091E9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02091EA0 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091E9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02091EA0 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091EA0 */ _t25 = _t24 & 0x00000001u;
         /* 02091EA0 */ if (_t25) goto L_02091F80; else goto L_02091EA4;
   L_02091EA4: ; // 0x2091ea4
@@ -29861,16 +29861,16 @@ void Gambit_fn_02091E20(CPUState* cpu) {
         /* 02091EB8 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02091EBC */ return;
   L_02091EC0: ; // 0x2091ec0
-        /* 02091EC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02091EC4 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091EC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02091EC4 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091EC4 */ _t30 = _t29 & 0x00000001u;
         /* 02091EC4 */ if (_t30) goto L_02091EC8; else goto L_02091ED8;
   L_02091EC8: ; // 0x2091ec8
         /* 02091EC8 */ cpu->r[3] = 0x00000004u;
         /* 02091ECC */ Gambit_fn_02801A78(cpu);
         /* 02091ED0 */ cpu->r[31] = cpu->r[3];
-        /* 02091ED0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02091ED4 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091ED0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02091ED4 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091ED4 */ _t32 = _t31 & 0x00000001u;
         /* 02091ED4 */ if (_t32) goto L_02091F80; else goto L_02091ED8;
   L_02091ED8: ; // 0x2091ed8
@@ -29885,16 +29885,16 @@ void Gambit_fn_02091E20(CPUState* cpu) {
         /* 02091EEC */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02091EF0 */ return;
   L_02091EF4: ; // 0x2091ef4
-        /* 02091EF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02091EF8 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091EF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02091EF8 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091EF8 */ _t37 = _t36 & 0x00000001u;
         /* 02091EF8 */ if (_t37) goto L_02091EFC; else goto L_02091F0C;
   L_02091EFC: ; // 0x2091efc
         /* 02091EFC */ cpu->r[3] = 0x00000004u;
         /* 02091F00 */ Gambit_fn_02801A78(cpu);
         /* 02091F04 */ cpu->r[31] = cpu->r[3];
-        /* 02091F04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02091F08 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091F04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02091F08 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091F08 */ _t39 = _t38 & 0x00000001u;
         /* 02091F08 */ if (_t39) goto L_02091F80; else goto L_02091F0C;
   L_02091F0C: ; // 0x2091f0c
@@ -29909,16 +29909,16 @@ void Gambit_fn_02091E20(CPUState* cpu) {
         /* 02091F20 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02091F24 */ return;
   L_02091F28: ; // 0x2091f28
-        /* 02091F28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02091F2C */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091F28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02091F2C */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091F2C */ _t44 = _t43 & 0x00000001u;
         /* 02091F2C */ if (_t44) goto L_02091F30; else goto L_02091F40;
   L_02091F30: ; // 0x2091f30
         /* 02091F30 */ cpu->r[3] = 0x00000004u;
         /* 02091F34 */ Gambit_fn_02801A78(cpu);
         /* 02091F38 */ cpu->r[31] = cpu->r[3];
-        /* 02091F38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02091F3C */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091F38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02091F3C */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091F3C */ _t46 = _t45 & 0x00000001u;
         /* 02091F3C */ if (_t46) goto L_02091F80; else goto L_02091F40;
   L_02091F40: ; // 0x2091f40
@@ -29933,16 +29933,16 @@ void Gambit_fn_02091E20(CPUState* cpu) {
         /* 02091F54 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02091F58 */ return;
   L_02091F5C: ; // 0x2091f5c
-        /* 02091F5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02091F5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02091F60 */ cpu->r[3] = cpu->r[31];
-        /* 02091F64 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091F64 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091F64 */ _t51 = _t50 & 0x00000001u;
         /* 02091F64 */ if (_t51) goto L_02091F68; else goto L_02091F78;
   L_02091F68: ; // 0x2091f68
         /* 02091F68 */ cpu->r[3] = 0x00000004u;
         /* 02091F6C */ Gambit_fn_02801A78(cpu);
-        /* 02091F70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02091F74 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091F70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02091F74 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091F74 */ _t53 = _t52 & 0x00000001u;
         /* 02091F74 */ if (_t53) goto L_02091F80; else goto L_02091F78;
   L_02091F78: ; // 0x2091f78
@@ -29973,9 +29973,9 @@ void Gambit_fn_02091E24(CPUState* cpu) {
         /* 02091E2C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02091E30 */ _t3 = cpu->r[3] + 0x00000060u;
         /* 02091E30 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
-        /* 02091E34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02091E34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02091E38 */ cpu->r[31] = cpu->r[4];
-        /* 02091E3C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091E3C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091E3C */ _t5 = _t4 & 0x00000001u;
         /* 02091E3C */ if (_t5) goto L_02091F5C; else goto L_02091E40;
   L_02091E40: ; // 0x2091e40
@@ -29984,54 +29984,54 @@ void Gambit_fn_02091E24(CPUState* cpu) {
         /* 02091E48 */ _t6 = cpu->r[1] + 0x00000008u;
         /* 02091E48 */ rbrew_write32(cpu->mem, _t6, cpu->r[11]);
         /* 02091E4C */ Gambit_fn_0208ECE4(cpu);
-        /* 02091E50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02091E54 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091E50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02091E54 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091E54 */ _t8 = _t7 & 0x00000001u;
         /* 02091E54 */ if (_t8) goto L_02091F5C; else goto L_02091E58;
   L_02091E58: ; // 0x2091e58
         /* 02091E58 */ _t9 = cpu->r[1] + 0x00000008u;
         /* 02091E58 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 02091E5C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
-        /* 02091E60 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02091E5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
+        /* 02091E60 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02091E60 */ _t11 = _t10 & 0x00000001u;
         /* 02091E60 */ if (_t11) goto L_02091F5C; else goto L_02091E64;
   L_02091E64: ; // 0x2091e64
-        /* 02091E64 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091E64 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091E64 */ _t13 = _t12 & 0x00000001u;
         /* 02091E64 */ if (_t13) goto L_02091E8C; else goto L_02091E68;
   L_02091E68: ; // 0x2091e68
-        /* 02091E68 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
-        /* 02091E6C */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02091E68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
+        /* 02091E6C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02091E6C */ _t15 = _t14 & 0x00000001u;
         /* 02091E6C */ if (_t15) goto L_02091EC0; else goto L_02091E70;
   L_02091E70: ; // 0x2091e70
-        /* 02091E70 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091E70 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091E70 */ _t17 = _t16 & 0x00000001u;
         /* 02091E70 */ if (_t17) goto L_02091EF4; else goto L_02091E74;
   L_02091E74: ; // 0x2091e74
-        /* 02091E74 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000006u);
-        /* 02091E78 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091E74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000006u));
+        /* 02091E78 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091E78 */ _t19 = _t18 & 0x00000001u;
         /* 02091E78 */ if (_t19) goto L_02091F28; else goto L_02091E7C;
   L_02091E7C: ; // 0x2091e7c
-        /* 02091E7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02091E7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02091E80 */ cpu->r[3] = cpu->r[31];
-        /* 02091E84 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091E84 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091E84 */ _t21 = _t20 & 0x00000001u;
         /* 02091E84 */ if (_t21) goto L_02091F68; else goto L_02091E88;
   L_02091E88: ; // 0x2091e88
         /* 02091E88 */ goto L_02091F78;
   L_02091E8C: ; // 0x2091e8c
-        /* 02091E8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02091E90 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091E8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02091E90 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091E90 */ _t23 = _t22 & 0x00000001u;
         /* 02091E90 */ if (_t23) goto L_02091E94; else goto L_02091EA4;
   L_02091E94: ; // 0x2091e94
         /* 02091E94 */ cpu->r[3] = 0x00000004u;
         /* 02091E98 */ Gambit_fn_02801A78(cpu);
         /* 02091E9C */ cpu->r[31] = cpu->r[3];
-        /* 02091E9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02091EA0 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091E9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02091EA0 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091EA0 */ _t25 = _t24 & 0x00000001u;
         /* 02091EA0 */ if (_t25) goto L_02091F80; else goto L_02091EA4;
   L_02091EA4: ; // 0x2091ea4
@@ -30046,16 +30046,16 @@ void Gambit_fn_02091E24(CPUState* cpu) {
         /* 02091EB8 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02091EBC */ return;
   L_02091EC0: ; // 0x2091ec0
-        /* 02091EC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02091EC4 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091EC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02091EC4 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091EC4 */ _t30 = _t29 & 0x00000001u;
         /* 02091EC4 */ if (_t30) goto L_02091EC8; else goto L_02091ED8;
   L_02091EC8: ; // 0x2091ec8
         /* 02091EC8 */ cpu->r[3] = 0x00000004u;
         /* 02091ECC */ Gambit_fn_02801A78(cpu);
         /* 02091ED0 */ cpu->r[31] = cpu->r[3];
-        /* 02091ED0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02091ED4 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091ED0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02091ED4 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091ED4 */ _t32 = _t31 & 0x00000001u;
         /* 02091ED4 */ if (_t32) goto L_02091F80; else goto L_02091ED8;
   L_02091ED8: ; // 0x2091ed8
@@ -30070,16 +30070,16 @@ void Gambit_fn_02091E24(CPUState* cpu) {
         /* 02091EEC */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02091EF0 */ return;
   L_02091EF4: ; // 0x2091ef4
-        /* 02091EF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02091EF8 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091EF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02091EF8 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091EF8 */ _t37 = _t36 & 0x00000001u;
         /* 02091EF8 */ if (_t37) goto L_02091EFC; else goto L_02091F0C;
   L_02091EFC: ; // 0x2091efc
         /* 02091EFC */ cpu->r[3] = 0x00000004u;
         /* 02091F00 */ Gambit_fn_02801A78(cpu);
         /* 02091F04 */ cpu->r[31] = cpu->r[3];
-        /* 02091F04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02091F08 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091F04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02091F08 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091F08 */ _t39 = _t38 & 0x00000001u;
         /* 02091F08 */ if (_t39) goto L_02091F80; else goto L_02091F0C;
   L_02091F0C: ; // 0x2091f0c
@@ -30094,16 +30094,16 @@ void Gambit_fn_02091E24(CPUState* cpu) {
         /* 02091F20 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02091F24 */ return;
   L_02091F28: ; // 0x2091f28
-        /* 02091F28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02091F2C */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091F28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02091F2C */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091F2C */ _t44 = _t43 & 0x00000001u;
         /* 02091F2C */ if (_t44) goto L_02091F30; else goto L_02091F40;
   L_02091F30: ; // 0x2091f30
         /* 02091F30 */ cpu->r[3] = 0x00000004u;
         /* 02091F34 */ Gambit_fn_02801A78(cpu);
         /* 02091F38 */ cpu->r[31] = cpu->r[3];
-        /* 02091F38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02091F3C */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091F38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02091F3C */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091F3C */ _t46 = _t45 & 0x00000001u;
         /* 02091F3C */ if (_t46) goto L_02091F80; else goto L_02091F40;
   L_02091F40: ; // 0x2091f40
@@ -30118,16 +30118,16 @@ void Gambit_fn_02091E24(CPUState* cpu) {
         /* 02091F54 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02091F58 */ return;
   L_02091F5C: ; // 0x2091f5c
-        /* 02091F5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02091F5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02091F60 */ cpu->r[3] = cpu->r[31];
-        /* 02091F64 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091F64 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091F64 */ _t51 = _t50 & 0x00000001u;
         /* 02091F64 */ if (_t51) goto L_02091F68; else goto L_02091F78;
   L_02091F68: ; // 0x2091f68
         /* 02091F68 */ cpu->r[3] = 0x00000004u;
         /* 02091F6C */ Gambit_fn_02801A78(cpu);
-        /* 02091F70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02091F74 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091F70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02091F74 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091F74 */ _t53 = _t52 & 0x00000001u;
         /* 02091F74 */ if (_t53) goto L_02091F80; else goto L_02091F78;
   L_02091F78: ; // 0x2091f78
@@ -30178,15 +30178,15 @@ void Gambit_fn_02091F9C(CPUState* cpu) {
         /* 02091FAC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02091FB0 */ _t3 = cpu->r[31] + 0x00000060u;
         /* 02091FB0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
-        /* 02091FB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02091FB8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091FB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02091FB8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091FB8 */ _t5 = _t4 & 0x00000001u;
         /* 02091FB8 */ if (_t5) goto L_02091FE0; else goto L_02091FBC;
   L_02091FBC: ; // 0x2091fbc
         /* 02091FBC */ _t6 = cpu->r[4] + 0x00000000u;
         /* 02091FBC */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 02091FC0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
-        /* 02091FC4 */ _t7 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02091FC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
+        /* 02091FC4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02091FC4 */ _t8 = _t7 & 0x00000001u;
         /* 02091FC4 */ if (_t8) goto L_02091FD8; else goto L_02091FC8;
   L_02091FC8: ; // 0x2091fc8
@@ -30223,15 +30223,15 @@ void Gambit_fn_02091FA0(CPUState* cpu) {
         /* 02091FAC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02091FB0 */ _t3 = cpu->r[31] + 0x00000060u;
         /* 02091FB0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
-        /* 02091FB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02091FB8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02091FB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02091FB8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02091FB8 */ _t5 = _t4 & 0x00000001u;
         /* 02091FB8 */ if (_t5) goto L_02091FE0; else goto L_02091FBC;
   L_02091FBC: ; // 0x2091fbc
         /* 02091FBC */ _t6 = cpu->r[4] + 0x00000000u;
         /* 02091FBC */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 02091FC0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
-        /* 02091FC4 */ _t7 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02091FC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
+        /* 02091FC4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02091FC4 */ _t8 = _t7 & 0x00000001u;
         /* 02091FC4 */ if (_t8) goto L_02091FD8; else goto L_02091FC8;
   L_02091FC8: ; // 0x2091fc8
@@ -30402,12 +30402,12 @@ void Gambit_fn_02092034(CPUState* cpu) {
         /* 0209204C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02092050 */ Gambit_fn_0208E4DC(cpu);
         /* 02092054 */ cpu->r[4] = cpu->r[3];
-        /* 02092054 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 02092054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 02092058 */ _t3 = cpu->r[31] + 0x00000068u;
         /* 02092058 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0209205C */ _t4 = cpu->r[31] + 0x00000060u;
         /* 0209205C */ rbrew_write32(cpu->mem, _t4, cpu->r[4]);
-        /* 02092060 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092060 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092060 */ _t6 = _t5 & 0x00000001u;
         /* 02092060 */ if (_t6) goto L_02092068; else goto L_02092064;
   L_02092064: ; // 0x2092064
@@ -30441,12 +30441,12 @@ void Gambit_fn_02092038(CPUState* cpu) {
         /* 0209204C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02092050 */ Gambit_fn_0208E4DC(cpu);
         /* 02092054 */ cpu->r[4] = cpu->r[3];
-        /* 02092054 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 02092054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 02092058 */ _t3 = cpu->r[31] + 0x00000068u;
         /* 02092058 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0209205C */ _t4 = cpu->r[31] + 0x00000060u;
         /* 0209205C */ rbrew_write32(cpu->mem, _t4, cpu->r[4]);
-        /* 02092060 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092060 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092060 */ _t6 = _t5 & 0x00000001u;
         /* 02092060 */ if (_t6) goto L_02092068; else goto L_02092064;
   L_02092064: ; // 0x2092064
@@ -30535,8 +30535,8 @@ void Gambit_fn_02092084(CPUState* cpu) {
         /* 02092134 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02092138 */ _t19 = cpu->r[1] + 0x00000010u;
         /* 02092138 */ cpu->r[5] = rbrew_read32(cpu->mem, _t19);
-        /* 0209213C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[5]);
-        /* 02092140 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209213C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[5]));
+        /* 02092140 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092140 */ _t21 = _t20 & 0x00000001u;
         /* 02092140 */ if (_t21) goto L_02092188; else goto L_02092144;
   L_02092144: ; // 0x2092144
@@ -30557,13 +30557,13 @@ void Gambit_fn_02092084(CPUState* cpu) {
         /* 02092168 */ _t26 = cpu->r[10] + 0x00000001u;
         /* 02092168 */ cpu->r[6] = rbrew_read8(cpu->mem, _t26);
         /* 02092168 */ cpu->r[10] = _t26;
-        /* 0209216C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[6]);
-        /* 02092170 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209216C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[6]));
+        /* 02092170 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092170 */ _t28 = _t27 & 0x00000001u;
         /* 02092170 */ if (_t28) goto L_02092174; else goto L_020921A4;
   L_02092174: ; // 0x2092174
-        /* 02092174 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 02092178 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092174 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 02092178 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092178 */ _t30 = _t29 & 0x00000001u;
         /* 02092178 */ if (_t30) goto L_02092188; else goto L_0209217C;
   L_0209217C: ; // 0x209217c
@@ -30618,8 +30618,8 @@ void Gambit_fn_02092084(CPUState* cpu) {
         /* 020921F0 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020921F4 */ _t46 = cpu->r[1] + 0x00000018u;
         /* 020921F4 */ cpu->r[6] = rbrew_read32(cpu->mem, _t46);
-        /* 020921F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], cpu->r[6]);
-        /* 020921FC */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020921F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], cpu->r[6]));
+        /* 020921FC */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020921FC */ _t48 = _t47 & 0x00000001u;
         /* 020921FC */ if (_t48) goto L_02092234; else goto L_02092200;
   L_02092200: ; // 0x2092200
@@ -30635,13 +30635,13 @@ void Gambit_fn_02092084(CPUState* cpu) {
         /* 02092214 */ _t52 = cpu->r[8] + 0x00000001u;
         /* 02092214 */ cpu->r[7] = rbrew_read8(cpu->mem, _t52);
         /* 02092214 */ cpu->r[8] = _t52;
-        /* 02092218 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[7]);
-        /* 0209221C */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092218 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[7]));
+        /* 0209221C */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209221C */ _t54 = _t53 & 0x00000001u;
         /* 0209221C */ if (_t54) goto L_02092220; else goto L_02092250;
   L_02092220: ; // 0x2092220
-        /* 02092220 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[31]);
-        /* 02092224 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092220 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[31]));
+        /* 02092224 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092224 */ _t56 = _t55 & 0x00000001u;
         /* 02092224 */ if (_t56) goto L_02092234; else goto L_02092228;
   L_02092228: ; // 0x2092228
@@ -30696,8 +30696,8 @@ void Gambit_fn_02092084(CPUState* cpu) {
         /* 0209229C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020922A0 */ _t72 = cpu->r[1] + 0x00000020u;
         /* 020922A0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t72);
-        /* 020922A4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], cpu->r[7]);
-        /* 020922A8 */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020922A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], cpu->r[7]));
+        /* 020922A8 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020922A8 */ _t74 = _t73 & 0x00000001u;
         /* 020922A8 */ if (_t74) goto L_020922E0; else goto L_020922AC;
   L_020922AC: ; // 0x20922ac
@@ -30713,13 +30713,13 @@ void Gambit_fn_02092084(CPUState* cpu) {
         /* 020922C0 */ _t78 = cpu->r[5] + 0x00000001u;
         /* 020922C0 */ cpu->r[8] = rbrew_read8(cpu->mem, _t78);
         /* 020922C0 */ cpu->r[5] = _t78;
-        /* 020922C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
-        /* 020922C8 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020922C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
+        /* 020922C8 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020922C8 */ _t80 = _t79 & 0x00000001u;
         /* 020922C8 */ if (_t80) goto L_020922CC; else goto L_020922FC;
   L_020922CC: ; // 0x20922cc
-        /* 020922CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020922D0 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020922CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020922D0 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020922D0 */ _t82 = _t81 & 0x00000001u;
         /* 020922D0 */ if (_t82) goto L_020922E0; else goto L_020922D4;
   L_020922D4: ; // 0x20922d4
@@ -30774,8 +30774,8 @@ void Gambit_fn_02092084(CPUState* cpu) {
         /* 02092348 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209234C */ _t98 = cpu->r[1] + 0x00000028u;
         /* 0209234C */ cpu->r[0] = rbrew_read32(cpu->mem, _t98);
-        /* 02092350 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[0]);
-        /* 02092354 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092350 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[0]));
+        /* 02092354 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092354 */ _t100 = _t99 & 0x00000001u;
         /* 02092354 */ if (_t100) goto L_020923A4; else goto L_02092358;
   L_02092358: ; // 0x2092358
@@ -30791,13 +30791,13 @@ void Gambit_fn_02092084(CPUState* cpu) {
         /* 0209236C */ _t104 = cpu->r[8] + 0x00000001u;
         /* 0209236C */ cpu->r[12] = rbrew_read8(cpu->mem, _t104);
         /* 0209236C */ cpu->r[8] = _t104;
-        /* 02092370 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 02092374 */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092370 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 02092374 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092374 */ _t106 = _t105 & 0x00000001u;
         /* 02092374 */ if (_t106) goto L_02092378; else goto L_020923C4;
   L_02092378: ; // 0x2092378
-        /* 02092378 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 0209237C */ _t107 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092378 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 0209237C */ _t107 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209237C */ _t108 = _t107 & 0x00000001u;
         /* 0209237C */ if (_t108) goto L_020923A4; else goto L_02092380;
   L_02092380: ; // 0x2092380
@@ -30824,8 +30824,8 @@ void Gambit_fn_02092084(CPUState* cpu) {
         /* 020923A8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t115);
         /* 020923AC */ _t116 = cpu->r[12] + 0x00000288u;
         /* 020923AC */ cpu->r[0] = rbrew_read32(cpu->mem, _t116);
-        /* 020923B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
-        /* 020923B4 */ _t117 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020923B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
+        /* 020923B4 */ _t117 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020923B4 */ _t118 = _t117 & 0x00000001u;
         /* 020923B4 */ if (_t118) goto L_020923C4; else goto L_020923B8;
   L_020923B8: ; // 0x20923b8
@@ -30963,8 +30963,8 @@ void Gambit_fn_02092438(CPUState* cpu) {
         /* 02092480 */ _t12 = cpu->r[1] + 0x000003B0u;
         /* 02092480 */ rbrew_write_f32(cpu->mem, _t12, cpu->f[31]);
         /* 02092484 */ Gambit_fn_02091E08(cpu);
-        /* 02092488 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209248C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092488 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209248C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209248C */ _t14 = _t13 & 0x00000001u;
         /* 0209248C */ if (_t14) goto L_02092498; else goto L_02092490;
   L_02092490: ; // 0x2092490
@@ -30973,15 +30973,15 @@ void Gambit_fn_02092438(CPUState* cpu) {
         /* 02092494 */ Gambit_fn_027EFDE4(cpu);
   L_02092498: ; // 0x2092498
         /* 02092498 */ Gambit_fn_027FAE14(cpu);
-        /* 0209249C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020924A0 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209249C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020924A0 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020924A0 */ _t17 = _t16 & 0x00000001u;
         /* 020924A0 */ if (_t17) goto L_020924A4; else goto L_020924B4;
   L_020924A4: ; // 0x20924a4
         /* 020924A4 */ cpu->r[3] = cpu->r[30];
         /* 020924A8 */ Gambit_fn_02091CD8(cpu);
-        /* 020924AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020924B0 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020924AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020924B0 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020924B0 */ _t19 = _t18 & 0x00000001u;
         /* 020924B0 */ if (_t19) goto L_020924C4; else goto L_020924B4;
   L_020924B4: ; // 0x20924b4
@@ -30995,16 +30995,16 @@ void Gambit_fn_02092438(CPUState* cpu) {
         /* 020924C4 */ _t22 = cpu->r[30] + 0x00000060u;
         /* 020924C4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t22);
         /* 020924C8 */ Gambit_fn_0208EAD8(cpu);
-        /* 020924CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020924D0 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020924CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020924D0 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020924D0 */ _t24 = _t23 & 0x00000001u;
         /* 020924D0 */ if (_t24) goto L_02092518; else goto L_020924D4;
   L_020924D4: ; // 0x20924d4
         /* 020924D4 */ _t25 = cpu->r[30] + 0x0000006Cu;
         /* 020924D4 */ cpu->r[5] = rbrew_read8(cpu->mem, _t25);
-        /* 020924D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 020924D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 020924DC */ cpu->r[31] = cpu->r[30] + 0x0000006Cu;
-        /* 020924E0 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020924E0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020924E0 */ _t27 = _t26 & 0x00000001u;
         /* 020924E0 */ if (_t27) goto L_020924F8; else goto L_020924E4;
   L_020924E4: ; // 0x20924e4
@@ -31018,9 +31018,9 @@ void Gambit_fn_02092438(CPUState* cpu) {
   L_020924F8: ; // 0x20924f8
         /* 020924F8 */ _t30 = cpu->r[30] + 0x0000006Du;
         /* 020924F8 */ cpu->r[7] = rbrew_read8(cpu->mem, _t30);
-        /* 020924FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 020924FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02092500 */ cpu->r[31] = cpu->r[30] + 0x0000006Du;
-        /* 02092504 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092504 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092504 */ _t32 = _t31 & 0x00000001u;
         /* 02092504 */ if (_t32) goto L_02092518; else goto L_02092508;
   L_02092508: ; // 0x2092508
@@ -31034,24 +31034,24 @@ void Gambit_fn_02092438(CPUState* cpu) {
         /* 02092518 */ _t35 = cpu->r[30] + 0x00000060u;
         /* 02092518 */ cpu->r[3] = rbrew_read32(cpu->mem, _t35);
         /* 0209251C */ Gambit_fn_0208EAE0(cpu);
-        /* 02092520 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02092520 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02092524 */ _t36 = cpu->r[30] + 0x00000064u;
         /* 02092524 */ cpu->r[3] = rbrew_read32(cpu->mem, _t36);
-        /* 02092528 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092528 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092528 */ _t38 = _t37 & 0x00000001u;
         /* 02092528 */ if (_t38) goto L_02092564; else goto L_0209252C;
   L_0209252C: ; // 0x209252c
         /* 0209252C */ Gambit_fn_0209A758(cpu);
-        /* 02092530 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02092534 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092530 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02092534 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092534 */ _t40 = _t39 & 0x00000001u;
         /* 02092534 */ if (_t40) goto L_0209257C; else goto L_02092538;
   L_02092538: ; // 0x2092538
         /* 02092538 */ _t41 = cpu->r[30] + 0x00000060u;
         /* 02092538 */ cpu->r[3] = rbrew_read32(cpu->mem, _t41);
         /* 0209253C */ Gambit_fn_0208ED3C(cpu);
-        /* 02092540 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02092544 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092540 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02092544 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092544 */ _t43 = _t42 & 0x00000001u;
         /* 02092544 */ if (_t43) goto L_0209257C; else goto L_02092548;
   L_02092548: ; // 0x2092548
@@ -31061,16 +31061,16 @@ void Gambit_fn_02092438(CPUState* cpu) {
         /* 02092550 */ _t45 = cpu->r[30] + 0x00000060u;
         /* 02092550 */ cpu->r[3] = rbrew_read32(cpu->mem, _t45);
         /* 02092554 */ Gambit_fn_0208EA2C(cpu);
-        /* 02092558 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209255C */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092558 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209255C */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209255C */ _t47 = _t46 & 0x00000001u;
         /* 0209255C */ if (_t47) goto L_0209258C; else goto L_02092560;
   L_02092560: ; // 0x2092560
         /* 02092560 */ goto L_02092E7C;
   L_02092564: ; // 0x2092564
         /* 02092564 */ Gambit_fn_0209A63C(cpu);
-        /* 02092568 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209256C */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092568 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209256C */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209256C */ _t49 = _t48 & 0x00000001u;
         /* 0209256C */ if (_t49) goto L_0209257C; else goto L_02092570;
   L_02092570: ; // 0x2092570
@@ -31083,16 +31083,16 @@ void Gambit_fn_02092438(CPUState* cpu) {
         /* 0209257C */ _t52 = cpu->r[30] + 0x00000060u;
         /* 0209257C */ cpu->r[3] = rbrew_read32(cpu->mem, _t52);
         /* 02092580 */ Gambit_fn_0208EA2C(cpu);
-        /* 02092584 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02092588 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02092588 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092588 */ _t54 = _t53 & 0x00000001u;
         /* 02092588 */ if (_t54) goto L_0209258C; else goto L_02092E7C;
   L_0209258C: ; // 0x209258c
         /* 0209258C */ cpu->r[12] = 0x101C0000u;
         /* 02092590 */ _t55 = cpu->r[12] + 0x00006000u;
         /* 02092590 */ cpu->r[12] = rbrew_read32(cpu->mem, _t55);
-        /* 02092594 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02092598 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092594 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02092598 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092598 */ _t57 = _t56 & 0x00000001u;
         /* 02092598 */ if (_t57) goto L_02092E7C; else goto L_0209259C;
   L_0209259C: ; // 0x209259c
@@ -31899,8 +31899,8 @@ void Gambit_fn_02092438(CPUState* cpu) {
         /* 02092BE8 */ cpu->f[9] = fma(cpu->f[28], cpu->f[28], cpu->f[12]);
         /* 02092BEC */ _t450 = cpu->r[5] + 0xFFFFE780u;
         /* 02092BEC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t450);
-        /* 02092BF0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[31]);
-        /* 02092BF4 */ _t451 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02092BF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[31]));
+        /* 02092BF4 */ _t451 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02092BF4 */ _t452 = _t451 & 0x00000001u;
         /* 02092BF4 */ if (_t452) goto L_02092BF8; else goto L_02092C34;
   L_02092BF8: ; // 0x2092bf8
@@ -31926,11 +31926,11 @@ void Gambit_fn_02092438(CPUState* cpu) {
         /* 02092C2C */ rbrew_write_f32(cpu->mem, _t458, cpu->f[28]);
         /* 02092C30 */ /* nop */
   L_02092C34: ; // 0x2092c34
-        /* 02092C34 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[31]);
+        /* 02092C34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[31]));
         /* 02092C38 */ cpu->r[9] = 0x10010000u;
         /* 02092C3C */ _t459 = cpu->r[9] + 0xFFFFE78Cu;
         /* 02092C3C */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t459);
-        /* 02092C40 */ _t460 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092C40 */ _t460 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092C40 */ _t461 = _t460 & 0x00000001u;
         /* 02092C40 */ if (_t461) goto L_02092C44; else goto L_02092C6C;
   L_02092C44: ; // 0x2092c44
@@ -31940,12 +31940,12 @@ void Gambit_fn_02092438(CPUState* cpu) {
         /* 02092C4C */ cpu->f[6] = -cpu->f[7];
         /* 02092C50 */ _t463 = cpu->r[7] + 0xFFFFE790u;
         /* 02092C50 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t463);
-        /* 02092C54 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[31]);
+        /* 02092C54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[31]));
         /* 02092C58 */ /* nop */
         /* 02092C5C */ _t464 = cpu->r[30] + 0x00000060u;
         /* 02092C5C */ cpu->r[3] = rbrew_read32(cpu->mem, _t464);
         /* 02092C60 */ cpu->f[1] = cpu->f[1] - cpu->f[30];
-        /* 02092C64 */ _t465 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02092C64 */ _t465 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02092C64 */ _t466 = _t465 & 0x00000001u;
         /* 02092C64 */ if (_t466) goto L_02092C68; else goto L_02092DE4;
   L_02092C68: ; // 0x2092c68
@@ -31956,15 +31956,15 @@ void Gambit_fn_02092438(CPUState* cpu) {
         /* 02092C70 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t467);
         /* 02092C74 */ cpu->f[1] = cpu->f[10] / cpu->f[8];
         /* 02092C78 */ cpu->r[5] = 0x10010000u;
-        /* 02092C7C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
+        /* 02092C7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
         /* 02092C80 */ _t468 = cpu->r[5] + 0xFFFFE794u;
         /* 02092C80 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t468);
-        /* 02092C84 */ _t469 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02092C84 */ _t469 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02092C84 */ _t470 = _t469 & 0x00000001u;
         /* 02092C84 */ if (_t470) goto L_02092D28; else goto L_02092C88;
   L_02092C88: ; // 0x2092c88
-        /* 02092C88 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[29]);
-        /* 02092C8C */ _t471 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02092C88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[29]));
+        /* 02092C8C */ _t471 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02092C8C */ _t472 = _t471 & 0x00000001u;
         /* 02092C8C */ if (_t472) goto L_02092C90; else goto L_02092CE0;
   L_02092C90: ; // 0x2092c90
@@ -32023,8 +32023,8 @@ void Gambit_fn_02092438(CPUState* cpu) {
         /* 02092D28 */ cpu->r[12] = 0x10010000u;
         /* 02092D2C */ _t485 = cpu->r[12] + 0xFFFFE798u;
         /* 02092D2C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t485);
-        /* 02092D30 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[13]);
-        /* 02092D34 */ _t486 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02092D30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[13]));
+        /* 02092D34 */ _t486 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02092D34 */ _t487 = _t486 & 0x00000001u;
         /* 02092D34 */ if (_t487) goto L_02092D38; else goto L_02092D84;
   L_02092D38: ; // 0x2092d38
@@ -32080,11 +32080,11 @@ void Gambit_fn_02092438(CPUState* cpu) {
         /* 02092DC8 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t499);
         /* 02092DCC */ cpu->f[1] = cpu->f[10] * cpu->f[11];
   L_02092DD0: ; // 0x2092dd0
-        /* 02092DD0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[31]);
+        /* 02092DD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[31]));
         /* 02092DD4 */ cpu->f[1] = cpu->f[1] - cpu->f[30];
         /* 02092DD8 */ _t500 = cpu->r[30] + 0x00000060u;
         /* 02092DD8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t500);
-        /* 02092DDC */ _t501 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02092DDC */ _t501 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02092DDC */ _t502 = _t501 & 0x00000001u;
         /* 02092DDC */ if (_t502) goto L_02092DE0; else goto L_02092DE4;
   L_02092DE0: ; // 0x2092de0
@@ -32104,24 +32104,24 @@ void Gambit_fn_02092438(CPUState* cpu) {
         /* 02092DFC */ rbrew_write32(cpu->mem, _t507, cpu->r[5]);
         /* 02092E00 */ _t508 = cpu->r[31] + 0x0000024Cu;
         /* 02092E00 */ cpu->r[7] = rbrew_read32(cpu->mem, _t508);
-        /* 02092E04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02092E04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02092E08 */ _t509 = cpu->r[1] + 0x0000034Cu;
         /* 02092E08 */ rbrew_write32(cpu->mem, _t509, cpu->r[7]);
-        /* 02092E0C */ _t510 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092E0C */ _t510 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092E0C */ _t511 = _t510 & 0x00000001u;
         /* 02092E0C */ if (_t511) goto L_02092E7C; else goto L_02092E10;
   L_02092E10: ; // 0x2092e10
         /* 02092E10 */ cpu->r[4] = 0x00000001u;
         /* 02092E14 */ Gambit_fn_0200CBD8(cpu);
-        /* 02092E18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02092E1C */ _t512 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092E18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02092E1C */ _t512 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092E1C */ _t513 = _t512 & 0x00000001u;
         /* 02092E1C */ if (_t513) goto L_02092E7C; else goto L_02092E20;
   L_02092E20: ; // 0x2092e20
         /* 02092E20 */ Gambit_fn_0201447C(cpu);
         /* 02092E24 */ cpu->r[31] = cpu->r[3];
-        /* 02092E24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02092E28 */ _t514 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092E24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02092E28 */ _t514 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092E28 */ _t515 = _t514 & 0x00000001u;
         /* 02092E28 */ if (_t515) goto L_02092E7C; else goto L_02092E2C;
   L_02092E2C: ; // 0x2092e2c
@@ -32176,7 +32176,7 @@ void Gambit_fn_02092438(CPUState* cpu) {
         /* 02092EA0 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t533);
         /* 02092EA4 */ _t534 = cpu->r[1] + 0x00000370u;
         /* 02092EA4 */ cpu->r[30] = rbrew_read32(cpu->mem, _t534);
-        /* 02092EA8 */ _t535 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02092EA8 */ _t535 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02092EA8 */ _t536 = _t535 & 0x00000001u;
         /* 02092EA8 */ if (_t536) goto L_02092EAC; // else: addr-0 trap, fall-through
   L_02092EAC: ; // 0x2092eac
@@ -32299,15 +32299,15 @@ void Gambit_fn_02092F28(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02092F28: ; // 0x2092f28
-        /* 02092F28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02092F2C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092F28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02092F2C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092F2C */ _t1 = _t0 & 0x00000001u;
         /* 02092F2C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02092F2C */ goto L_02092F30;
   L_02092F30: ; // 0x2092f30
         /* 02092F30 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02092F30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02092F34 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092F30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02092F34 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092F34 */ _t3 = _t2 & 0x00000001u;
         /* 02092F34 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02092F34 */ goto L_02092F38;
@@ -32326,8 +32326,8 @@ void Gambit_fn_02092F28(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -32341,15 +32341,15 @@ void Gambit_fn_02092F28(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -32439,8 +32439,8 @@ void Gambit_fn_02092F64(CPUState* cpu) {
   L_02092F64: ; // 0x2092f64
         /* 02092F64 */ _t0 = cpu->r[3] + 0x00000008u;
         /* 02092F64 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 02092F68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02092F6C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092F68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02092F6C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092F6C */ _t2 = _t1 & 0x00000001u;
         /* 02092F6C */ if (_t2) goto L_02092F78; else goto L_02092F70;
   L_02092F70: ; // 0x2092f70
@@ -32458,8 +32458,8 @@ void Gambit_fn_02092F80(CPUState* cpu) {
   L_02092F80: ; // 0x2092f80
         /* 02092F80 */ _t0 = cpu->r[3] + 0x00000008u;
         /* 02092F80 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 02092F84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02092F88 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092F84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02092F88 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092F88 */ _t2 = _t1 & 0x00000001u;
         /* 02092F88 */ if (_t2) goto L_02092F94; else goto L_02092F8C;
   L_02092F8C: ; // 0x2092f8c
@@ -32478,8 +32478,8 @@ void Gambit_fn_02092F9C(CPUState* cpu) {
         /* 02092F9C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02092F9C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02092FA0 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 02092FA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02092FA4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092FA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02092FA4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092FA4 */ _t2 = _t1 & 0x00000001u;
         /* 02092FA4 */ _t3 = _t2 ^ 0x00000001u;
         /* 02092FA4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -32501,8 +32501,8 @@ void Gambit_fn_02092FB8(CPUState* cpu) {
         /* 02092FB8 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02092FB8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02092FBC */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 02092FBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02092FC0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092FBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02092FC0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092FC0 */ _t2 = _t1 & 0x00000001u;
         /* 02092FC0 */ _t3 = _t2 ^ 0x00000001u;
         /* 02092FC0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -32524,8 +32524,8 @@ void Gambit_fn_02092FD4(CPUState* cpu) {
         /* 02092FD4 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02092FD4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02092FD8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 02092FD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02092FDC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02092FD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02092FDC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02092FDC */ _t2 = _t1 & 0x00000001u;
         /* 02092FDC */ _t3 = _t2 ^ 0x00000001u;
         /* 02092FDC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -32568,8 +32568,8 @@ void Gambit_fn_02093000(CPUState* cpu) {
         /* 02093010 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02093014 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02093014 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02093018 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0209301C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093018 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0209301C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209301C */ _t5 = _t4 & 0x00000001u;
         /* 0209301C */ if (_t5) goto L_02093020; else goto L_0209303C;
   L_02093020: ; // 0x2093020
@@ -32608,8 +32608,8 @@ void Gambit_fn_02093004(CPUState* cpu) {
         /* 02093010 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02093014 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02093014 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02093018 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0209301C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093018 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0209301C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209301C */ _t5 = _t4 & 0x00000001u;
         /* 0209301C */ if (_t5) goto L_02093020; else goto L_0209303C;
   L_02093020: ; // 0x2093020
@@ -28,10 +28,10 @@ void Gambit_fn_020930C0(CPUState* cpu) {
         /* 020930C0 */ cpu->r[12] = 0x101D0000u;
         /* 020930C4 */ _t0 = cpu->r[12] + 0xFFFFEE38u;
         /* 020930C4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 020930C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 020930C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 020930CC */ cpu->r[12] = 0x101D0000u;
         /* 020930D0 */ cpu->r[12] = cpu->r[12] + 0xFFFFEE3Cu;
-        /* 020930D4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020930D4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020930D4 */ _t2 = _t1 & 0x00000001u;
         /* 020930D4 */ if (_t2) goto L_020930D8; else goto L_020930F0;
   L_020930D8: ; // 0x20930d8
@@ -44,8 +44,8 @@ void Gambit_fn_020930C0(CPUState* cpu) {
         /* 020930EC */ _t4 = cpu->r[12] + 0x00000000u;
         /* 020930EC */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_020930F0: ; // 0x20930f0
-        /* 020930F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 020930F4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020930F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 020930F4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020930F4 */ _t6 = _t5 & 0x00000001u;
         /* 020930F4 */ if (_t6) goto L_020930F8; else goto L_02093100;
   L_020930F8: ; // 0x20930f8
@@ -57,9 +57,9 @@ void Gambit_fn_020930C0(CPUState* cpu) {
         /* 02093104 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 02093104 */ cpu->r[11] = _t7;
         /* 02093108 */ cpu->r[10] = 0x101D0000u;
-        /* 0209310C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0209310C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02093110 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 02093114 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093114 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093114 */ _t9 = _t8 & 0x00000001u;
         /* 02093114 */ if (_t9) goto L_02093118; else goto L_0209312C;
   L_02093118: ; // 0x2093118
@@ -71,8 +71,8 @@ void Gambit_fn_020930C0(CPUState* cpu) {
         /* 02093128 */ _t11 = cpu->r[10] + 0x00000000u;
         /* 02093128 */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
   L_0209312C: ; // 0x209312c
-        /* 0209312C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02093130 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209312C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02093130 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093130 */ _t13 = _t12 & 0x00000001u;
         /* 02093130 */ if (_t13) goto L_02093134; else goto L_0209313C;
   L_02093134: ; // 0x2093134
@@ -84,9 +84,9 @@ void Gambit_fn_020930C0(CPUState* cpu) {
         /* 02093140 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 02093140 */ cpu->r[8] = _t14;
         /* 02093144 */ cpu->r[11] = 0x101D0000u;
-        /* 02093148 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02093148 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0209314C */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 02093150 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093150 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093150 */ _t16 = _t15 & 0x00000001u;
         /* 02093150 */ if (_t16) goto L_02093154; else goto L_02093168;
   L_02093154: ; // 0x2093154
@@ -123,11 +123,11 @@ void Gambit_fn_0209317C(CPUState* cpu) {
         /* 020964F4 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020964F4 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020964F8 */ cpu->r[30] = cpu->r[3];
-        /* 020964F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020964F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020964FC */ cpu->r[31] = cpu->r[4];
         /* 02096500 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02096500 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02096504 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096504 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096504 */ _t5 = _t4 & 0x00000001u;
         /* 02096504 */ if (_t5) goto L_02096548; else goto L_02096508;
   L_02096508: ; // 0x2096508
@@ -147,8 +147,8 @@ void Gambit_fn_0209317C(CPUState* cpu) {
         /* 02096530 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 02096534 */ Gambit_fn_02068798(cpu);
         /* 02096538 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02096538 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209653C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096538 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209653C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209653C */ _t10 = _t9 & 0x00000001u;
         /* 0209653C */ if (_t10) goto L_02096548; else goto L_02096540;
   L_02096540: ; // 0x2096540
@@ -176,8 +176,8 @@ void Gambit_fn_02093184(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -227,18 +227,18 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 020931A0 */ /* nop */
         /* 020931A4 */ cpu->r[0] = cpu->lr;
         /* 020931A8 */ cpu->r[30] = cpu->r[3];
-        /* 020931A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020931A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020931AC */ _t1 = cpu->r[1] + 0x00000054u;
         /* 020931AC */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
-        /* 020931B0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020931B0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020931B0 */ _t3 = _t2 & 0x00000001u;
         /* 020931B0 */ if (_t3) goto L_020931B4; else goto L_020931C4;
   L_020931B4: ; // 0x20931b4
         /* 020931B4 */ cpu->r[3] = 0x00000268u;
         /* 020931B8 */ Gambit_fn_02801A78(cpu);
         /* 020931BC */ cpu->r[30] = cpu->r[3];
-        /* 020931BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 020931C0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020931BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 020931C0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020931C0 */ _t5 = _t4 & 0x00000001u;
         /* 020931C0 */ if (_t5) goto L_02094300; else goto L_020931C4;
   L_020931C4: ; // 0x20931c4
@@ -267,22 +267,22 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 0209320C */ rbrew_write32(cpu->mem, _t9, cpu->r[10]);
         /* 02093210 */ cpu->r[0] = cpu->r[0] + 0xFFFFEF4Cu;
         /* 02093214 */ cpu->r[28] = cpu->r[30] + 0x000001DCu;
-        /* 02093214 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 02093214 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 02093218 */ _t10 = cpu->r[30] + 0x0000001Cu;
         /* 02093218 */ rbrew_write32(cpu->mem, _t10, cpu->r[11]);
         /* 0209321C */ cpu->r[29] = 0x00000000u;
         /* 02093220 */ cpu->r[31] = cpu->r[28];
         /* 02093224 */ _t11 = cpu->r[30] + 0x000001C8u;
         /* 02093224 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
-        /* 02093228 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093228 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093228 */ _t13 = _t12 & 0x00000001u;
         /* 02093228 */ if (_t13) goto L_0209322C; else goto L_0209323C;
   L_0209322C: ; // 0x209322c
         /* 0209322C */ cpu->r[3] = 0x00000038u;
         /* 02093230 */ Gambit_fn_02801A78(cpu);
         /* 02093234 */ cpu->r[31] = cpu->r[3];
-        /* 02093234 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02093238 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093234 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02093238 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093238 */ _t15 = _t14 & 0x00000001u;
         /* 02093238 */ if (_t15) goto L_0209326C; else goto L_0209323C;
   L_0209323C: ; // 0x209323c
@@ -310,7 +310,7 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 0209326C */ _t24 = cpu->r[30] + 0x00000248u;
         /* 0209326C */ rbrew_write32(cpu->mem, _t24, cpu->r[29]);
         /* 02093270 */ cpu->r[3] = cpu->r[30] + 0x00000258u;
-        /* 02093270 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02093270 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02093274 */ _t25 = cpu->r[30] + 0x00000214u;
         /* 02093274 */ rbrew_write32(cpu->mem, _t25, cpu->r[29]);
         /* 02093278 */ _t26 = cpu->r[30] + 0x00000240u;
@@ -323,14 +323,14 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093284 */ rbrew_write8(cpu->mem, _t29, (uint8_t)cpu->r[29]);
         /* 02093288 */ _t30 = cpu->r[30] + 0x00000244u;
         /* 02093288 */ rbrew_write32(cpu->mem, _t30, cpu->r[29]);
-        /* 0209328C */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209328C */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209328C */ _t32 = _t31 & 0x00000001u;
         /* 0209328C */ if (_t32) goto L_02093290; else goto L_020932A0;
   L_02093290: ; // 0x2093290
         /* 02093290 */ cpu->r[3] = 0x00000008u;
         /* 02093294 */ Gambit_fn_02801A78(cpu);
-        /* 02093298 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209329C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093298 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209329C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209329C */ _t34 = _t33 & 0x00000001u;
         /* 0209329C */ if (_t34) goto L_020932BC; else goto L_020932A0;
   L_020932A0: ; // 0x20932a0
@@ -413,23 +413,23 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093350 */ _t58 = cpu->r[7] + 0x00000000u;
         /* 02093350 */ cpu->r[9] = rbrew_read8(cpu->mem, _t58);
         /* 02093354 */ cpu->r[31] = 0x00000000u;
-        /* 02093358 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[26]);
+        /* 02093358 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[26]));
         /* 0209335C */ cpu->r[9] = 0x00080000u;
-        /* 02093360 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093360 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093360 */ _t60 = _t59 & 0x00000001u;
         /* 02093360 */ if (_t60) goto L_02093388; else goto L_02093364;
   L_02093364: ; // 0x2093364
         /* 02093364 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02093368 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 02093368 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 0209336C */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02093370 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02093370 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02093370 */ _t62 = _t61 & 0x00000001u;
         /* 02093370 */ if (_t62) goto L_02093384; else goto L_02093374;
   L_02093374: ; // 0x2093374
         /* 02093374 */ _t63 = cpu->r[7] + 0x00000000u;
         /* 02093374 */ cpu->r[10] = rbrew_read8(cpu->mem, _t63);
-        /* 02093378 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[26]);
-        /* 0209337C */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093378 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[26]));
+        /* 0209337C */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209337C */ _t65 = _t64 & 0x00000001u;
         /* 0209337C */ if (_t65) goto L_02093380; else goto L_02093364;
   L_02093380: ; // 0x2093380
@@ -439,8 +439,8 @@ void Gambit_fn_0209319C(CPUState* cpu) {
   L_02093388: ; // 0x2093388
         /* 02093388 */ _t66 = cpu->r[23] + 0x00000008u;
         /* 02093388 */ cpu->r[11] = rbrew_read32(cpu->mem, _t66);
-        /* 0209338C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
-        /* 02093390 */ _t67 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209338C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
+        /* 02093390 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02093390 */ _t68 = _t67 & 0x00000001u;
         /* 02093390 */ if (_t68) goto L_02093398; else goto L_02093394;
   L_02093394: ; // 0x2093394
@@ -499,10 +499,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093420 */ rbrew_write32(cpu->mem, _t84, cpu->r[4]);
         /* 02093424 */ _t85 = cpu->r[28] + 0x00000014u;
         /* 02093424 */ cpu->r[5] = rbrew_read32(cpu->mem, _t85);
-        /* 02093428 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x00000001u);
+        /* 02093428 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x00000001u));
         /* 0209342C */ _t86 = cpu->r[28] + 0x00000018u;
         /* 0209342C */ cpu->r[24] = rbrew_read32(cpu->mem, _t86);
-        /* 02093430 */ _t87 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02093430 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02093430 */ _t88 = _t87 & 0x00000001u;
         /* 02093430 */ if (_t88) goto L_02093434; else goto L_02093438;
   L_02093434: ; // 0x2093434
@@ -518,23 +518,23 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 0209344C */ _t91 = cpu->r[12] + 0x00000000u;
         /* 0209344C */ cpu->r[6] = rbrew_read8(cpu->mem, _t91);
         /* 02093450 */ cpu->r[31] = 0x00000000u;
-        /* 02093454 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[26]);
+        /* 02093454 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[26]));
         /* 02093458 */ cpu->r[5] = 0x00080000u;
-        /* 0209345C */ _t92 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209345C */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209345C */ _t93 = _t92 & 0x00000001u;
         /* 0209345C */ if (_t93) goto L_02093484; else goto L_02093460;
   L_02093460: ; // 0x2093460
         /* 02093460 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02093464 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 02093464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 02093468 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 0209346C */ _t94 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209346C */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209346C */ _t95 = _t94 & 0x00000001u;
         /* 0209346C */ if (_t95) goto L_02093480; else goto L_02093470;
   L_02093470: ; // 0x2093470
         /* 02093470 */ _t96 = cpu->r[12] + 0x00000000u;
         /* 02093470 */ cpu->r[0] = rbrew_read8(cpu->mem, _t96);
-        /* 02093474 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[26]);
-        /* 02093478 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093474 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[26]));
+        /* 02093478 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093478 */ _t98 = _t97 & 0x00000001u;
         /* 02093478 */ if (_t98) goto L_0209347C; else goto L_02093460;
   L_0209347C: ; // 0x209347c
@@ -546,10 +546,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093484 */ cpu->r[12] = rbrew_read32(cpu->mem, _t99);
         /* 02093488 */ _t100 = cpu->r[1] + 0x00000010u;
         /* 02093488 */ cpu->r[8] = rbrew_read32(cpu->mem, _t100);
-        /* 0209348C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 0209348C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 02093490 */ _t101 = cpu->r[8] + 0x00000014u;
         /* 02093490 */ cpu->r[9] = rbrew_read32(cpu->mem, _t101);
-        /* 02093494 */ _t102 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02093494 */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02093494 */ _t103 = _t102 & 0x00000001u;
         /* 02093494 */ if (_t103) goto L_0209349C; else goto L_02093498;
   L_02093498: ; // 0x2093498
@@ -604,10 +604,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 0209351C */ rbrew_write32(cpu->mem, _t117, cpu->r[11]);
         /* 02093520 */ _t118 = cpu->r[28] + 0x00000014u;
         /* 02093520 */ cpu->r[12] = rbrew_read32(cpu->mem, _t118);
-        /* 02093524 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], 0x00000002u);
+        /* 02093524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], 0x00000002u));
         /* 02093528 */ _t119 = cpu->r[28] + 0x00000018u;
         /* 02093528 */ cpu->r[24] = rbrew_read32(cpu->mem, _t119);
-        /* 0209352C */ _t120 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209352C */ _t120 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209352C */ _t121 = _t120 & 0x00000001u;
         /* 0209352C */ if (_t121) goto L_02093530; else goto L_02093534;
   L_02093530: ; // 0x2093530
@@ -623,23 +623,23 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093548 */ _t124 = cpu->r[8] + 0x00000000u;
         /* 02093548 */ cpu->r[0] = rbrew_read8(cpu->mem, _t124);
         /* 0209354C */ cpu->r[31] = 0x00000000u;
-        /* 02093550 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[26]);
+        /* 02093550 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[26]));
         /* 02093554 */ cpu->r[9] = 0x00080000u;
-        /* 02093558 */ _t125 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093558 */ _t125 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093558 */ _t126 = _t125 & 0x00000001u;
         /* 02093558 */ if (_t126) goto L_02093580; else goto L_0209355C;
   L_0209355C: ; // 0x209355c
         /* 0209355C */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02093560 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 02093560 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 02093564 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 02093568 */ _t127 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02093568 */ _t127 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02093568 */ _t128 = _t127 & 0x00000001u;
         /* 02093568 */ if (_t128) goto L_0209357C; else goto L_0209356C;
   L_0209356C: ; // 0x209356c
         /* 0209356C */ _t129 = cpu->r[8] + 0x00000000u;
         /* 0209356C */ cpu->r[4] = rbrew_read8(cpu->mem, _t129);
-        /* 02093570 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[26]);
-        /* 02093574 */ _t130 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093570 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[26]));
+        /* 02093574 */ _t130 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093574 */ _t131 = _t130 & 0x00000001u;
         /* 02093574 */ if (_t131) goto L_02093578; else goto L_0209355C;
   L_02093578: ; // 0x2093578
@@ -649,10 +649,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
   L_02093580: ; // 0x2093580
         /* 02093580 */ _t132 = cpu->r[24] + 0x00000008u;
         /* 02093580 */ cpu->r[6] = rbrew_read32(cpu->mem, _t132);
-        /* 02093584 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 02093584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 02093588 */ _t133 = cpu->r[1] + 0x00000010u;
         /* 02093588 */ cpu->r[5] = rbrew_read32(cpu->mem, _t133);
-        /* 0209358C */ _t134 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209358C */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209358C */ _t135 = _t134 & 0x00000001u;
         /* 0209358C */ if (_t135) goto L_02093594; else goto L_02093590;
   L_02093590: ; // 0x2093590
@@ -709,10 +709,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093618 */ rbrew_write32(cpu->mem, _t150, cpu->r[0]);
         /* 0209361C */ _t151 = cpu->r[28] + 0x00000014u;
         /* 0209361C */ cpu->r[9] = rbrew_read32(cpu->mem, _t151);
-        /* 02093620 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000003u);
+        /* 02093620 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000003u));
         /* 02093624 */ _t152 = cpu->r[28] + 0x00000018u;
         /* 02093624 */ cpu->r[24] = rbrew_read32(cpu->mem, _t152);
-        /* 02093628 */ _t153 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02093628 */ _t153 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02093628 */ _t154 = _t153 & 0x00000001u;
         /* 02093628 */ if (_t154) goto L_0209362C; else goto L_02093630;
   L_0209362C: ; // 0x209362c
@@ -728,23 +728,23 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093644 */ _t157 = cpu->r[4] + 0x00000000u;
         /* 02093644 */ cpu->r[10] = rbrew_read8(cpu->mem, _t157);
         /* 02093648 */ cpu->r[31] = 0x00000000u;
-        /* 0209364C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[26]);
+        /* 0209364C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[26]));
         /* 02093650 */ cpu->r[5] = 0x00080000u;
-        /* 02093654 */ _t158 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093654 */ _t158 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093654 */ _t159 = _t158 & 0x00000001u;
         /* 02093654 */ if (_t159) goto L_0209367C; else goto L_02093658;
   L_02093658: ; // 0x2093658
         /* 02093658 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0209365C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 0209365C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 02093660 */ cpu->r[4] = cpu->r[4] + 0x00000001u;
-        /* 02093664 */ _t160 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02093664 */ _t160 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02093664 */ _t161 = _t160 & 0x00000001u;
         /* 02093664 */ if (_t161) goto L_02093678; else goto L_02093668;
   L_02093668: ; // 0x2093668
         /* 02093668 */ _t162 = cpu->r[4] + 0x00000000u;
         /* 02093668 */ cpu->r[0] = rbrew_read8(cpu->mem, _t162);
-        /* 0209366C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[26]);
-        /* 02093670 */ _t163 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209366C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[26]));
+        /* 02093670 */ _t163 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093670 */ _t164 = _t163 & 0x00000001u;
         /* 02093670 */ if (_t164) goto L_02093674; else goto L_02093658;
   L_02093674: ; // 0x2093674
@@ -756,10 +756,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 0209367C */ cpu->r[7] = rbrew_read32(cpu->mem, _t165);
         /* 02093680 */ _t166 = cpu->r[1] + 0x00000010u;
         /* 02093680 */ cpu->r[12] = rbrew_read32(cpu->mem, _t166);
-        /* 02093684 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 02093684 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 02093688 */ _t167 = cpu->r[12] + 0x00000014u;
         /* 02093688 */ cpu->r[4] = rbrew_read32(cpu->mem, _t167);
-        /* 0209368C */ _t168 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209368C */ _t168 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209368C */ _t169 = _t168 & 0x00000001u;
         /* 0209368C */ if (_t169) goto L_02093694; else goto L_02093690;
   L_02093690: ; // 0x2093690
@@ -814,10 +814,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093714 */ rbrew_write32(cpu->mem, _t183, cpu->r[6]);
         /* 02093718 */ _t184 = cpu->r[28] + 0x00000014u;
         /* 02093718 */ cpu->r[7] = rbrew_read32(cpu->mem, _t184);
-        /* 0209371C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x00000004u);
+        /* 0209371C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x00000004u));
         /* 02093720 */ _t185 = cpu->r[28] + 0x00000018u;
         /* 02093720 */ cpu->r[24] = rbrew_read32(cpu->mem, _t185);
-        /* 02093724 */ _t186 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02093724 */ _t186 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02093724 */ _t187 = _t186 & 0x00000001u;
         /* 02093724 */ if (_t187) goto L_02093728; else goto L_0209372C;
   L_02093728: ; // 0x2093728
@@ -833,23 +833,23 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093740 */ _t190 = cpu->r[9] + 0x00000000u;
         /* 02093740 */ cpu->r[8] = rbrew_read8(cpu->mem, _t190);
         /* 02093744 */ cpu->r[31] = 0x00000000u;
-        /* 02093748 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[26]);
+        /* 02093748 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[26]));
         /* 0209374C */ cpu->r[11] = 0x00080000u;
-        /* 02093750 */ _t191 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093750 */ _t191 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093750 */ _t192 = _t191 & 0x00000001u;
         /* 02093750 */ if (_t192) goto L_02093778; else goto L_02093754;
   L_02093754: ; // 0x2093754
         /* 02093754 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02093758 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 02093758 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 0209375C */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 02093760 */ _t193 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02093760 */ _t193 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02093760 */ _t194 = _t193 & 0x00000001u;
         /* 02093760 */ if (_t194) goto L_02093774; else goto L_02093764;
   L_02093764: ; // 0x2093764
         /* 02093764 */ _t195 = cpu->r[9] + 0x00000000u;
         /* 02093764 */ cpu->r[0] = rbrew_read8(cpu->mem, _t195);
-        /* 02093768 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[26]);
-        /* 0209376C */ _t196 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[26]));
+        /* 0209376C */ _t196 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209376C */ _t197 = _t196 & 0x00000001u;
         /* 0209376C */ if (_t197) goto L_02093770; else goto L_02093754;
   L_02093770: ; // 0x2093770
@@ -861,10 +861,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093778 */ cpu->r[9] = rbrew_read32(cpu->mem, _t198);
         /* 0209377C */ _t199 = cpu->r[1] + 0x00000010u;
         /* 0209377C */ cpu->r[10] = rbrew_read32(cpu->mem, _t199);
-        /* 02093780 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 02093780 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 02093784 */ _t200 = cpu->r[10] + 0x00000014u;
         /* 02093784 */ cpu->r[11] = rbrew_read32(cpu->mem, _t200);
-        /* 02093788 */ _t201 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02093788 */ _t201 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02093788 */ _t202 = _t201 & 0x00000001u;
         /* 02093788 */ if (_t202) goto L_02093790; else goto L_0209378C;
   L_0209378C: ; // 0x209378c
@@ -919,10 +919,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093810 */ rbrew_write32(cpu->mem, _t216, cpu->r[0]);
         /* 02093814 */ _t217 = cpu->r[28] + 0x00000014u;
         /* 02093814 */ cpu->r[4] = rbrew_read32(cpu->mem, _t217);
-        /* 02093818 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000005u);
+        /* 02093818 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000005u));
         /* 0209381C */ _t218 = cpu->r[28] + 0x00000018u;
         /* 0209381C */ cpu->r[24] = rbrew_read32(cpu->mem, _t218);
-        /* 02093820 */ _t219 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02093820 */ _t219 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02093820 */ _t220 = _t219 & 0x00000001u;
         /* 02093820 */ if (_t220) goto L_02093824; else goto L_02093828;
   L_02093824: ; // 0x2093824
@@ -938,23 +938,23 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 0209383C */ _t223 = cpu->r[12] + 0x00000000u;
         /* 0209383C */ cpu->r[5] = rbrew_read8(cpu->mem, _t223);
         /* 02093840 */ cpu->r[31] = 0x00000000u;
-        /* 02093844 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[26]);
+        /* 02093844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[26]));
         /* 02093848 */ cpu->r[5] = 0x00080000u;
-        /* 0209384C */ _t224 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209384C */ _t224 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209384C */ _t225 = _t224 & 0x00000001u;
         /* 0209384C */ if (_t225) goto L_02093874; else goto L_02093850;
   L_02093850: ; // 0x2093850
         /* 02093850 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02093854 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 02093854 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 02093858 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 0209385C */ _t226 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209385C */ _t226 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209385C */ _t227 = _t226 & 0x00000001u;
         /* 0209385C */ if (_t227) goto L_02093870; else goto L_02093860;
   L_02093860: ; // 0x2093860
         /* 02093860 */ _t228 = cpu->r[12] + 0x00000000u;
         /* 02093860 */ cpu->r[6] = rbrew_read8(cpu->mem, _t228);
-        /* 02093864 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[26]);
-        /* 02093868 */ _t229 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093864 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[26]));
+        /* 02093868 */ _t229 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093868 */ _t230 = _t229 & 0x00000001u;
         /* 02093868 */ if (_t230) goto L_0209386C; else goto L_02093850;
   L_0209386C: ; // 0x209386c
@@ -966,10 +966,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093874 */ cpu->r[11] = rbrew_read32(cpu->mem, _t231);
         /* 02093878 */ _t232 = cpu->r[1] + 0x00000010u;
         /* 02093878 */ cpu->r[7] = rbrew_read32(cpu->mem, _t232);
-        /* 0209387C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 0209387C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 02093880 */ _t233 = cpu->r[7] + 0x00000014u;
         /* 02093880 */ cpu->r[8] = rbrew_read32(cpu->mem, _t233);
-        /* 02093884 */ _t234 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02093884 */ _t234 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02093884 */ _t235 = _t234 & 0x00000001u;
         /* 02093884 */ if (_t235) goto L_0209388C; else goto L_02093888;
   L_02093888: ; // 0x2093888
@@ -1024,10 +1024,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 0209390C */ rbrew_write32(cpu->mem, _t249, cpu->r[0]);
         /* 02093910 */ _t250 = cpu->r[28] + 0x00000014u;
         /* 02093910 */ cpu->r[11] = rbrew_read32(cpu->mem, _t250);
-        /* 02093914 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000006u);
+        /* 02093914 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000006u));
         /* 02093918 */ _t251 = cpu->r[28] + 0x00000018u;
         /* 02093918 */ cpu->r[24] = rbrew_read32(cpu->mem, _t251);
-        /* 0209391C */ _t252 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209391C */ _t252 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209391C */ _t253 = _t252 & 0x00000001u;
         /* 0209391C */ if (_t253) goto L_02093920; else goto L_02093924;
   L_02093920: ; // 0x2093920
@@ -1043,23 +1043,23 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093938 */ _t256 = cpu->r[8] + 0x00000000u;
         /* 02093938 */ cpu->r[12] = rbrew_read8(cpu->mem, _t256);
         /* 0209393C */ cpu->r[31] = 0x00000000u;
-        /* 02093940 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[26]);
+        /* 02093940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[26]));
         /* 02093944 */ cpu->r[10] = 0x00080000u;
-        /* 02093948 */ _t257 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093948 */ _t257 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093948 */ _t258 = _t257 & 0x00000001u;
         /* 02093948 */ if (_t258) goto L_02093970; else goto L_0209394C;
   L_0209394C: ; // 0x209394c
         /* 0209394C */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02093950 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 02093950 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 02093954 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 02093958 */ _t259 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02093958 */ _t259 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02093958 */ _t260 = _t259 & 0x00000001u;
         /* 02093958 */ if (_t260) goto L_0209396C; else goto L_0209395C;
   L_0209395C: ; // 0x209395c
         /* 0209395C */ _t261 = cpu->r[8] + 0x00000000u;
         /* 0209395C */ cpu->r[0] = rbrew_read8(cpu->mem, _t261);
-        /* 02093960 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[26]);
-        /* 02093964 */ _t262 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093960 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[26]));
+        /* 02093964 */ _t262 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093964 */ _t263 = _t262 & 0x00000001u;
         /* 02093964 */ if (_t263) goto L_02093968; else goto L_0209394C;
   L_02093968: ; // 0x2093968
@@ -1071,10 +1071,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093970 */ cpu->r[12] = rbrew_read32(cpu->mem, _t264);
         /* 02093974 */ _t265 = cpu->r[1] + 0x00000010u;
         /* 02093974 */ cpu->r[4] = rbrew_read32(cpu->mem, _t265);
-        /* 02093978 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 02093978 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 0209397C */ _t266 = cpu->r[4] + 0x00000014u;
         /* 0209397C */ cpu->r[5] = rbrew_read32(cpu->mem, _t266);
-        /* 02093980 */ _t267 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02093980 */ _t267 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02093980 */ _t268 = _t267 & 0x00000001u;
         /* 02093980 */ if (_t268) goto L_02093988; else goto L_02093984;
   L_02093984: ; // 0x2093984
@@ -1129,10 +1129,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093A08 */ rbrew_write32(cpu->mem, _t282, cpu->r[7]);
         /* 02093A0C */ _t283 = cpu->r[28] + 0x00000014u;
         /* 02093A0C */ cpu->r[8] = rbrew_read32(cpu->mem, _t283);
-        /* 02093A10 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000007u);
+        /* 02093A10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000007u));
         /* 02093A14 */ _t284 = cpu->r[28] + 0x00000018u;
         /* 02093A14 */ cpu->r[24] = rbrew_read32(cpu->mem, _t284);
-        /* 02093A18 */ _t285 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02093A18 */ _t285 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02093A18 */ _t286 = _t285 & 0x00000001u;
         /* 02093A18 */ if (_t286) goto L_02093A1C; else goto L_02093A20;
   L_02093A1C: ; // 0x2093a1c
@@ -1148,23 +1148,23 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093A34 */ _t289 = cpu->r[5] + 0x00000000u;
         /* 02093A34 */ cpu->r[9] = rbrew_read8(cpu->mem, _t289);
         /* 02093A38 */ cpu->r[31] = 0x00000000u;
-        /* 02093A3C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[26]);
+        /* 02093A3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[26]));
         /* 02093A40 */ cpu->r[6] = 0x00080000u;
-        /* 02093A44 */ _t290 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093A44 */ _t290 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093A44 */ _t291 = _t290 & 0x00000001u;
         /* 02093A44 */ if (_t291) goto L_02093A6C; else goto L_02093A48;
   L_02093A48: ; // 0x2093a48
         /* 02093A48 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02093A4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 02093A4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 02093A50 */ cpu->r[5] = cpu->r[5] + 0x00000001u;
-        /* 02093A54 */ _t292 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02093A54 */ _t292 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02093A54 */ _t293 = _t292 & 0x00000001u;
         /* 02093A54 */ if (_t293) goto L_02093A68; else goto L_02093A58;
   L_02093A58: ; // 0x2093a58
         /* 02093A58 */ _t294 = cpu->r[5] + 0x00000000u;
         /* 02093A58 */ cpu->r[10] = rbrew_read8(cpu->mem, _t294);
-        /* 02093A5C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[26]);
-        /* 02093A60 */ _t295 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093A5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[26]));
+        /* 02093A60 */ _t295 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093A60 */ _t296 = _t295 & 0x00000001u;
         /* 02093A60 */ if (_t296) goto L_02093A64; else goto L_02093A48;
   L_02093A64: ; // 0x2093a64
@@ -1176,10 +1176,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093A6C */ cpu->r[4] = rbrew_read32(cpu->mem, _t297);
         /* 02093A70 */ _t298 = cpu->r[1] + 0x00000010u;
         /* 02093A70 */ cpu->r[12] = rbrew_read32(cpu->mem, _t298);
-        /* 02093A74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[4]);
+        /* 02093A74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[4]));
         /* 02093A78 */ _t299 = cpu->r[12] + 0x00000014u;
         /* 02093A78 */ cpu->r[0] = rbrew_read32(cpu->mem, _t299);
-        /* 02093A7C */ _t300 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02093A7C */ _t300 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02093A7C */ _t301 = _t300 & 0x00000001u;
         /* 02093A7C */ if (_t301) goto L_02093A84; else goto L_02093A80;
   L_02093A80: ; // 0x2093a80
@@ -1234,10 +1234,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093B04 */ rbrew_write32(cpu->mem, _t315, cpu->r[5]);
         /* 02093B08 */ _t316 = cpu->r[28] + 0x00000014u;
         /* 02093B08 */ cpu->r[6] = rbrew_read32(cpu->mem, _t316);
-        /* 02093B0C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], 0x00000008u);
+        /* 02093B0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], 0x00000008u));
         /* 02093B10 */ _t317 = cpu->r[28] + 0x00000018u;
         /* 02093B10 */ cpu->r[24] = rbrew_read32(cpu->mem, _t317);
-        /* 02093B14 */ _t318 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02093B14 */ _t318 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02093B14 */ _t319 = _t318 & 0x00000001u;
         /* 02093B14 */ if (_t319) goto L_02093B18; else goto L_02093B1C;
   L_02093B18: ; // 0x2093b18
@@ -1253,23 +1253,23 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093B30 */ _t322 = cpu->r[9] + 0x00000000u;
         /* 02093B30 */ cpu->r[7] = rbrew_read8(cpu->mem, _t322);
         /* 02093B34 */ cpu->r[31] = 0x00000000u;
-        /* 02093B38 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[26]);
+        /* 02093B38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[26]));
         /* 02093B3C */ cpu->r[0] = 0x00080000u;
-        /* 02093B40 */ _t323 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093B40 */ _t323 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093B40 */ _t324 = _t323 & 0x00000001u;
         /* 02093B40 */ if (_t324) goto L_02093B68; else goto L_02093B44;
   L_02093B44: ; // 0x2093b44
         /* 02093B44 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02093B48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 02093B48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 02093B4C */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 02093B50 */ _t325 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02093B50 */ _t325 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02093B50 */ _t326 = _t325 & 0x00000001u;
         /* 02093B50 */ if (_t326) goto L_02093B64; else goto L_02093B54;
   L_02093B54: ; // 0x2093b54
         /* 02093B54 */ _t327 = cpu->r[9] + 0x00000000u;
         /* 02093B54 */ cpu->r[8] = rbrew_read8(cpu->mem, _t327);
-        /* 02093B58 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[26]);
-        /* 02093B5C */ _t328 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093B58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[26]));
+        /* 02093B5C */ _t328 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093B5C */ _t329 = _t328 & 0x00000001u;
         /* 02093B5C */ if (_t329) goto L_02093B60; else goto L_02093B44;
   L_02093B60: ; // 0x2093b60
@@ -1281,10 +1281,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093B68 */ cpu->r[6] = rbrew_read32(cpu->mem, _t330);
         /* 02093B6C */ _t331 = cpu->r[1] + 0x00000010u;
         /* 02093B6C */ cpu->r[9] = rbrew_read32(cpu->mem, _t331);
-        /* 02093B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 02093B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 02093B74 */ _t332 = cpu->r[9] + 0x00000014u;
         /* 02093B74 */ cpu->r[0] = rbrew_read32(cpu->mem, _t332);
-        /* 02093B78 */ _t333 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02093B78 */ _t333 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02093B78 */ _t334 = _t333 & 0x00000001u;
         /* 02093B78 */ if (_t334) goto L_02093B80; else goto L_02093B7C;
   L_02093B7C: ; // 0x2093b7c
@@ -1339,10 +1339,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093C00 */ rbrew_write32(cpu->mem, _t348, cpu->r[0]);
         /* 02093C04 */ _t349 = cpu->r[28] + 0x00000014u;
         /* 02093C04 */ cpu->r[7] = rbrew_read32(cpu->mem, _t349);
-        /* 02093C08 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x00000009u);
+        /* 02093C08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x00000009u));
         /* 02093C0C */ _t350 = cpu->r[28] + 0x00000018u;
         /* 02093C0C */ cpu->r[24] = rbrew_read32(cpu->mem, _t350);
-        /* 02093C10 */ _t351 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02093C10 */ _t351 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02093C10 */ _t352 = _t351 & 0x00000001u;
         /* 02093C10 */ if (_t352) goto L_02093C14; else goto L_02093C18;
   L_02093C14: ; // 0x2093c14
@@ -1358,23 +1358,23 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093C2C */ _t355 = cpu->r[5] + 0x00000000u;
         /* 02093C2C */ cpu->r[9] = rbrew_read8(cpu->mem, _t355);
         /* 02093C30 */ cpu->r[31] = 0x00000000u;
-        /* 02093C34 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[26]);
+        /* 02093C34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[26]));
         /* 02093C38 */ cpu->r[7] = 0x00080000u;
-        /* 02093C3C */ _t356 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093C3C */ _t356 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093C3C */ _t357 = _t356 & 0x00000001u;
         /* 02093C3C */ if (_t357) goto L_02093C64; else goto L_02093C40;
   L_02093C40: ; // 0x2093c40
         /* 02093C40 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02093C44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 02093C44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 02093C48 */ cpu->r[5] = cpu->r[5] + 0x00000001u;
-        /* 02093C4C */ _t358 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02093C4C */ _t358 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02093C4C */ _t359 = _t358 & 0x00000001u;
         /* 02093C4C */ if (_t359) goto L_02093C60; else goto L_02093C50;
   L_02093C50: ; // 0x2093c50
         /* 02093C50 */ _t360 = cpu->r[5] + 0x00000000u;
         /* 02093C50 */ cpu->r[0] = rbrew_read8(cpu->mem, _t360);
-        /* 02093C54 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[26]);
-        /* 02093C58 */ _t361 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093C54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[26]));
+        /* 02093C58 */ _t361 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093C58 */ _t362 = _t361 & 0x00000001u;
         /* 02093C58 */ if (_t362) goto L_02093C5C; else goto L_02093C40;
   L_02093C5C: ; // 0x2093c5c
@@ -1386,10 +1386,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093C64 */ cpu->r[9] = rbrew_read32(cpu->mem, _t363);
         /* 02093C68 */ _t364 = cpu->r[1] + 0x00000010u;
         /* 02093C68 */ cpu->r[12] = rbrew_read32(cpu->mem, _t364);
-        /* 02093C6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 02093C6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 02093C70 */ _t365 = cpu->r[12] + 0x00000014u;
         /* 02093C70 */ cpu->r[5] = rbrew_read32(cpu->mem, _t365);
-        /* 02093C74 */ _t366 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02093C74 */ _t366 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02093C74 */ _t367 = _t366 & 0x00000001u;
         /* 02093C74 */ if (_t367) goto L_02093C7C; else goto L_02093C78;
   L_02093C78: ; // 0x2093c78
@@ -1444,10 +1444,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093CFC */ rbrew_write32(cpu->mem, _t381, cpu->r[10]);
         /* 02093D00 */ _t382 = cpu->r[28] + 0x00000014u;
         /* 02093D00 */ cpu->r[0] = rbrew_read32(cpu->mem, _t382);
-        /* 02093D04 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000000Au);
+        /* 02093D04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000000Au));
         /* 02093D08 */ _t383 = cpu->r[28] + 0x00000018u;
         /* 02093D08 */ cpu->r[24] = rbrew_read32(cpu->mem, _t383);
-        /* 02093D0C */ _t384 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02093D0C */ _t384 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02093D0C */ _t385 = _t384 & 0x00000001u;
         /* 02093D0C */ if (_t385) goto L_02093D10; else goto L_02093D14;
   L_02093D10: ; // 0x2093d10
@@ -1463,23 +1463,23 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093D28 */ _t388 = cpu->r[11] + 0x00000000u;
         /* 02093D28 */ cpu->r[5] = rbrew_read8(cpu->mem, _t388);
         /* 02093D2C */ cpu->r[31] = 0x00000000u;
-        /* 02093D30 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[26]);
+        /* 02093D30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[26]));
         /* 02093D34 */ cpu->r[0] = 0x00080000u;
-        /* 02093D38 */ _t389 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093D38 */ _t389 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093D38 */ _t390 = _t389 & 0x00000001u;
         /* 02093D38 */ if (_t390) goto L_02093D60; else goto L_02093D3C;
   L_02093D3C: ; // 0x2093d3c
         /* 02093D3C */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02093D40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 02093D40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 02093D44 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 02093D48 */ _t391 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02093D48 */ _t391 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02093D48 */ _t392 = _t391 & 0x00000001u;
         /* 02093D48 */ if (_t392) goto L_02093D5C; else goto L_02093D4C;
   L_02093D4C: ; // 0x2093d4c
         /* 02093D4C */ _t393 = cpu->r[11] + 0x00000000u;
         /* 02093D4C */ cpu->r[6] = rbrew_read8(cpu->mem, _t393);
-        /* 02093D50 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[26]);
-        /* 02093D54 */ _t394 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093D50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[26]));
+        /* 02093D54 */ _t394 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093D54 */ _t395 = _t394 & 0x00000001u;
         /* 02093D54 */ if (_t395) goto L_02093D58; else goto L_02093D3C;
   L_02093D58: ; // 0x2093d58
@@ -1489,10 +1489,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
   L_02093D60: ; // 0x2093d60
         /* 02093D60 */ _t396 = cpu->r[24] + 0x00000008u;
         /* 02093D60 */ cpu->r[10] = rbrew_read32(cpu->mem, _t396);
-        /* 02093D64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 02093D64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 02093D68 */ _t397 = cpu->r[1] + 0x00000010u;
         /* 02093D68 */ cpu->r[8] = rbrew_read32(cpu->mem, _t397);
-        /* 02093D6C */ _t398 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02093D6C */ _t398 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02093D6C */ _t399 = _t398 & 0x00000001u;
         /* 02093D6C */ if (_t399) goto L_02093D74; else goto L_02093D70;
   L_02093D70: ; // 0x2093d70
@@ -1549,10 +1549,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093DF8 */ rbrew_write32(cpu->mem, _t414, cpu->r[4]);
         /* 02093DFC */ _t415 = cpu->r[28] + 0x00000014u;
         /* 02093DFC */ cpu->r[6] = rbrew_read32(cpu->mem, _t415);
-        /* 02093E00 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], 0x0000000Bu);
+        /* 02093E00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], 0x0000000Bu));
         /* 02093E04 */ _t416 = cpu->r[28] + 0x00000018u;
         /* 02093E04 */ cpu->r[24] = rbrew_read32(cpu->mem, _t416);
-        /* 02093E08 */ _t417 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02093E08 */ _t417 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02093E08 */ _t418 = _t417 & 0x00000001u;
         /* 02093E08 */ if (_t418) goto L_02093E0C; else goto L_02093E10;
   L_02093E0C: ; // 0x2093e0c
@@ -1568,23 +1568,23 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093E24 */ _t421 = cpu->r[7] + 0x00000000u;
         /* 02093E24 */ cpu->r[8] = rbrew_read8(cpu->mem, _t421);
         /* 02093E28 */ cpu->r[31] = 0x00000000u;
-        /* 02093E2C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[26]);
+        /* 02093E2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[26]));
         /* 02093E30 */ cpu->r[9] = 0x00080000u;
-        /* 02093E34 */ _t422 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093E34 */ _t422 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093E34 */ _t423 = _t422 & 0x00000001u;
         /* 02093E34 */ if (_t423) goto L_02093E5C; else goto L_02093E38;
   L_02093E38: ; // 0x2093e38
         /* 02093E38 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02093E3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 02093E3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 02093E40 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02093E44 */ _t424 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02093E44 */ _t424 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02093E44 */ _t425 = _t424 & 0x00000001u;
         /* 02093E44 */ if (_t425) goto L_02093E58; else goto L_02093E48;
   L_02093E48: ; // 0x2093e48
         /* 02093E48 */ _t426 = cpu->r[7] + 0x00000000u;
         /* 02093E48 */ cpu->r[10] = rbrew_read8(cpu->mem, _t426);
-        /* 02093E4C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[26]);
-        /* 02093E50 */ _t427 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093E4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[26]));
+        /* 02093E50 */ _t427 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093E50 */ _t428 = _t427 & 0x00000001u;
         /* 02093E50 */ if (_t428) goto L_02093E54; else goto L_02093E38;
   L_02093E54: ; // 0x2093e54
@@ -1594,8 +1594,8 @@ void Gambit_fn_0209319C(CPUState* cpu) {
   L_02093E5C: ; // 0x2093e5c
         /* 02093E5C */ _t429 = cpu->r[24] + 0x00000008u;
         /* 02093E5C */ cpu->r[12] = rbrew_read32(cpu->mem, _t429);
-        /* 02093E60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
-        /* 02093E64 */ _t430 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02093E60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
+        /* 02093E64 */ _t430 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02093E64 */ _t431 = _t430 & 0x00000001u;
         /* 02093E64 */ if (_t431) goto L_02093E6C; else goto L_02093E68;
   L_02093E68: ; // 0x2093e68
@@ -1654,10 +1654,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093EF4 */ rbrew_write32(cpu->mem, _t447, cpu->r[9]);
         /* 02093EF8 */ _t448 = cpu->r[28] + 0x00000014u;
         /* 02093EF8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t448);
-        /* 02093EFC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000000Cu);
+        /* 02093EFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000000Cu));
         /* 02093F00 */ _t449 = cpu->r[28] + 0x00000018u;
         /* 02093F00 */ cpu->r[24] = rbrew_read32(cpu->mem, _t449);
-        /* 02093F04 */ _t450 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02093F04 */ _t450 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02093F04 */ _t451 = _t450 & 0x00000001u;
         /* 02093F04 */ if (_t451) goto L_02093F08; else goto L_02093F0C;
   L_02093F08: ; // 0x2093f08
@@ -1673,23 +1673,23 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093F20 */ _t454 = cpu->r[12] + 0x00000000u;
         /* 02093F20 */ cpu->r[4] = rbrew_read8(cpu->mem, _t454);
         /* 02093F24 */ cpu->r[31] = 0x00000000u;
-        /* 02093F28 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[26]);
+        /* 02093F28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[26]));
         /* 02093F2C */ cpu->r[4] = 0x00080000u;
-        /* 02093F30 */ _t455 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093F30 */ _t455 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093F30 */ _t456 = _t455 & 0x00000001u;
         /* 02093F30 */ if (_t456) goto L_02093F58; else goto L_02093F34;
   L_02093F34: ; // 0x2093f34
         /* 02093F34 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02093F38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[4]);
+        /* 02093F38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[4]));
         /* 02093F3C */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 02093F40 */ _t457 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02093F40 */ _t457 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02093F40 */ _t458 = _t457 & 0x00000001u;
         /* 02093F40 */ if (_t458) goto L_02093F54; else goto L_02093F44;
   L_02093F44: ; // 0x2093f44
         /* 02093F44 */ _t459 = cpu->r[12] + 0x00000000u;
         /* 02093F44 */ cpu->r[7] = rbrew_read8(cpu->mem, _t459);
-        /* 02093F48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[26]);
-        /* 02093F4C */ _t460 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02093F48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[26]));
+        /* 02093F4C */ _t460 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02093F4C */ _t461 = _t460 & 0x00000001u;
         /* 02093F4C */ if (_t461) goto L_02093F50; else goto L_02093F34;
   L_02093F50: ; // 0x2093f50
@@ -1701,10 +1701,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093F58 */ cpu->r[4] = rbrew_read32(cpu->mem, _t462);
         /* 02093F5C */ _t463 = cpu->r[1] + 0x00000010u;
         /* 02093F5C */ cpu->r[8] = rbrew_read32(cpu->mem, _t463);
-        /* 02093F60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[4]);
+        /* 02093F60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[4]));
         /* 02093F64 */ _t464 = cpu->r[8] + 0x00000014u;
         /* 02093F64 */ cpu->r[0] = rbrew_read32(cpu->mem, _t464);
-        /* 02093F68 */ _t465 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02093F68 */ _t465 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02093F68 */ _t466 = _t465 & 0x00000001u;
         /* 02093F68 */ if (_t466) goto L_02093F70; else goto L_02093F6C;
   L_02093F6C: ; // 0x2093f6c
@@ -1759,10 +1759,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02093FF0 */ rbrew_write32(cpu->mem, _t480, cpu->r[6]);
         /* 02093FF4 */ _t481 = cpu->r[28] + 0x00000014u;
         /* 02093FF4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t481);
-        /* 02093FF8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x0000000Du);
+        /* 02093FF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x0000000Du));
         /* 02093FFC */ _t482 = cpu->r[28] + 0x00000018u;
         /* 02093FFC */ cpu->r[24] = rbrew_read32(cpu->mem, _t482);
-        /* 02094000 */ _t483 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02094000 */ _t483 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02094000 */ _t484 = _t483 & 0x00000001u;
         /* 02094000 */ if (_t484) goto L_02094004; else goto L_02094008;
   L_02094004: ; // 0x2094004
@@ -1778,23 +1778,23 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 0209401C */ _t487 = cpu->r[8] + 0x00000000u;
         /* 0209401C */ cpu->r[10] = rbrew_read8(cpu->mem, _t487);
         /* 02094020 */ cpu->r[31] = 0x00000000u;
-        /* 02094024 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[26]);
+        /* 02094024 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[26]));
         /* 02094028 */ cpu->r[9] = 0x00080000u;
-        /* 0209402C */ _t488 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209402C */ _t488 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209402C */ _t489 = _t488 & 0x00000001u;
         /* 0209402C */ if (_t489) goto L_02094054; else goto L_02094030;
   L_02094030: ; // 0x2094030
         /* 02094030 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02094034 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 02094034 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 02094038 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 0209403C */ _t490 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209403C */ _t490 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209403C */ _t491 = _t490 & 0x00000001u;
         /* 0209403C */ if (_t491) goto L_02094050; else goto L_02094040;
   L_02094040: ; // 0x2094040
         /* 02094040 */ _t492 = cpu->r[8] + 0x00000000u;
         /* 02094040 */ cpu->r[0] = rbrew_read8(cpu->mem, _t492);
-        /* 02094044 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[26]);
-        /* 02094048 */ _t493 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094044 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[26]));
+        /* 02094048 */ _t493 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094048 */ _t494 = _t493 & 0x00000001u;
         /* 02094048 */ if (_t494) goto L_0209404C; else goto L_02094030;
   L_0209404C: ; // 0x209404c
@@ -1806,10 +1806,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02094054 */ cpu->r[5] = rbrew_read32(cpu->mem, _t495);
         /* 02094058 */ _t496 = cpu->r[1] + 0x00000010u;
         /* 02094058 */ cpu->r[4] = rbrew_read32(cpu->mem, _t496);
-        /* 0209405C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 0209405C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 02094060 */ _t497 = cpu->r[4] + 0x00000014u;
         /* 02094060 */ cpu->r[0] = rbrew_read32(cpu->mem, _t497);
-        /* 02094064 */ _t498 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02094064 */ _t498 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02094064 */ _t499 = _t498 & 0x00000001u;
         /* 02094064 */ if (_t499) goto L_0209406C; else goto L_02094068;
   L_02094068: ; // 0x2094068
@@ -1864,10 +1864,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 020940EC */ rbrew_write32(cpu->mem, _t513, cpu->r[12]);
         /* 020940F0 */ _t514 = cpu->r[28] + 0x00000014u;
         /* 020940F0 */ cpu->r[4] = rbrew_read32(cpu->mem, _t514);
-        /* 020940F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x0000000Eu);
+        /* 020940F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x0000000Eu));
         /* 020940F8 */ _t515 = cpu->r[28] + 0x00000018u;
         /* 020940F8 */ cpu->r[24] = rbrew_read32(cpu->mem, _t515);
-        /* 020940FC */ _t516 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020940FC */ _t516 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020940FC */ _t517 = _t516 & 0x00000001u;
         /* 020940FC */ if (_t517) goto L_02094100; else goto L_02094104;
   L_02094100: ; // 0x2094100
@@ -1883,23 +1883,23 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02094118 */ _t520 = cpu->r[4] + 0x00000000u;
         /* 02094118 */ cpu->r[7] = rbrew_read8(cpu->mem, _t520);
         /* 0209411C */ cpu->r[31] = 0x00000000u;
-        /* 02094120 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[26]);
+        /* 02094120 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[26]));
         /* 02094124 */ cpu->r[6] = 0x00080000u;
-        /* 02094128 */ _t521 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094128 */ _t521 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094128 */ _t522 = _t521 & 0x00000001u;
         /* 02094128 */ if (_t522) goto L_02094150; else goto L_0209412C;
   L_0209412C: ; // 0x209412c
         /* 0209412C */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02094130 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 02094130 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 02094134 */ cpu->r[4] = cpu->r[4] + 0x00000001u;
-        /* 02094138 */ _t523 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02094138 */ _t523 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02094138 */ _t524 = _t523 & 0x00000001u;
         /* 02094138 */ if (_t524) goto L_0209414C; else goto L_0209413C;
   L_0209413C: ; // 0x209413c
         /* 0209413C */ _t525 = cpu->r[4] + 0x00000000u;
         /* 0209413C */ cpu->r[8] = rbrew_read8(cpu->mem, _t525);
-        /* 02094140 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[26]);
-        /* 02094144 */ _t526 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094140 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[26]));
+        /* 02094144 */ _t526 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094144 */ _t527 = _t526 & 0x00000001u;
         /* 02094144 */ if (_t527) goto L_02094148; else goto L_0209412C;
   L_02094148: ; // 0x2094148
@@ -1911,10 +1911,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02094150 */ cpu->r[6] = rbrew_read32(cpu->mem, _t528);
         /* 02094154 */ _t529 = cpu->r[1] + 0x00000010u;
         /* 02094154 */ cpu->r[9] = rbrew_read32(cpu->mem, _t529);
-        /* 02094158 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 02094158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 0209415C */ _t530 = cpu->r[9] + 0x00000014u;
         /* 0209415C */ cpu->r[0] = rbrew_read32(cpu->mem, _t530);
-        /* 02094160 */ _t531 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02094160 */ _t531 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02094160 */ _t532 = _t531 & 0x00000001u;
         /* 02094160 */ if (_t532) goto L_02094168; else goto L_02094164;
   L_02094164: ; // 0x2094164
@@ -1969,10 +1969,10 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 020941E8 */ rbrew_write32(cpu->mem, _t546, cpu->r[8]);
         /* 020941EC */ _t547 = cpu->r[28] + 0x00000014u;
         /* 020941EC */ cpu->r[0] = rbrew_read32(cpu->mem, _t547);
-        /* 020941F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000000Fu);
+        /* 020941F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000000Fu));
         /* 020941F4 */ _t548 = cpu->r[28] + 0x00000018u;
         /* 020941F4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t548);
-        /* 020941F8 */ _t549 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020941F8 */ _t549 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020941F8 */ _t550 = _t549 & 0x00000001u;
         /* 020941F8 */ if (_t550) goto L_020941FC; else goto L_02094200;
   L_020941FC: ; // 0x20941fc
@@ -1988,23 +1988,23 @@ void Gambit_fn_0209319C(CPUState* cpu) {
         /* 02094214 */ _t553 = cpu->r[8] + 0x00000000u;
         /* 02094214 */ cpu->r[0] = rbrew_read8(cpu->mem, _t553);
         /* 02094218 */ cpu->r[27] = 0x00000000u;
-        /* 0209421C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[26]);
+        /* 0209421C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[26]));
         /* 02094220 */ cpu->r[10] = 0x00080000u;
-        /* 02094224 */ _t554 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094224 */ _t554 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094224 */ _t555 = _t554 & 0x00000001u;
         /* 02094224 */ if (_t555) goto L_0209424C; else goto L_02094228;
   L_02094228: ; // 0x2094228
         /* 02094228 */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 0209422C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[10]);
+        /* 0209422C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[10]));
         /* 02094230 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 02094234 */ _t556 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02094234 */ _t556 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02094234 */ _t557 = _t556 & 0x00000001u;
         /* 02094234 */ if (_t557) goto L_02094248; else goto L_02094238;
   L_02094238: ; // 0x2094238
         /* 02094238 */ _t558 = cpu->r[8] + 0x00000000u;
         /* 02094238 */ cpu->r[5] = rbrew_read8(cpu->mem, _t558);
-        /* 0209423C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[26]);
-        /* 02094240 */ _t559 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209423C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[26]));
+        /* 02094240 */ _t559 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094240 */ _t560 = _t559 & 0x00000001u;
         /* 02094240 */ if (_t560) goto L_02094244; else goto L_02094228;
   L_02094244: ; // 0x2094244
@@ -2014,8 +2014,8 @@ void Gambit_fn_0209319C(CPUState* cpu) {
   L_0209424C: ; // 0x209424c
         /* 0209424C */ _t561 = cpu->r[31] + 0x00000008u;
         /* 0209424C */ cpu->r[7] = rbrew_read32(cpu->mem, _t561);
-        /* 02094250 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[7]);
-        /* 02094254 */ _t562 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02094250 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[7]));
+        /* 02094254 */ _t562 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02094254 */ _t563 = _t562 & 0x00000001u;
         /* 02094254 */ if (_t563) goto L_0209425C; else goto L_02094258;
   L_02094258: ; // 0x2094258
@@ -2231,24 +2231,24 @@ void Gambit_fn_020943CC(CPUState* cpu) {
         /* 020943CC */ _t0 = cpu->r[3] + 0x000001E8u;
         /* 020943CC */ cpu->r[12] = rbrew_read8(cpu->mem, _t0);
         /* 020943D0 */ /* nop */
-        /* 020943D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], 0x00000002u);
+        /* 020943D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], 0x00000002u));
         /* 020943D8 */ cpu->r[0] = 0x00000001u;
-        /* 020943DC */ _t1 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020943DC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020943DC */ _t2 = _t1 & 0x00000001u;
         /* 020943DC */ if (_t2) goto L_020943F8; else goto L_020943E0;
   L_020943E0: ; // 0x20943e0
-        /* 020943E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], 0x00000005u);
-        /* 020943E4 */ _t3 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020943E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], 0x00000005u));
+        /* 020943E4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020943E4 */ _t4 = _t3 & 0x00000001u;
         /* 020943E4 */ if (_t4) goto L_020943E8; else goto L_020943FC;
   L_020943E8: ; // 0x20943e8
-        /* 020943E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], 0x00000007u);
-        /* 020943EC */ _t5 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020943E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], 0x00000007u));
+        /* 020943EC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020943EC */ _t6 = _t5 & 0x00000001u;
         /* 020943EC */ if (_t6) goto L_020943F8; else goto L_020943F0;
   L_020943F0: ; // 0x20943f0
-        /* 020943F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], 0x0000000Cu);
-        /* 020943F4 */ _t7 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020943F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], 0x0000000Cu));
+        /* 020943F4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020943F4 */ _t8 = _t7 & 0x00000001u;
         /* 020943F4 */ if (_t8) goto L_020943F8; else goto L_020943FC;
   L_020943F8: ; // 0x20943f8
@@ -2356,8 +2356,8 @@ void Gambit_fn_02094464(CPUState* cpu) {
         /* 02094478 */ _t3 = cpu->r[31] + 0x00000118u;
         /* 02094478 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 0209447C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0209447C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02094480 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209447C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02094480 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094480 */ _t5 = _t4 & 0x00000001u;
         /* 02094480 */ if (_t5) goto L_02094484; else goto L_0209448C;
   L_02094484: ; // 0x2094484
@@ -2395,8 +2395,8 @@ void Gambit_fn_02094468(CPUState* cpu) {
         /* 02094478 */ _t3 = cpu->r[31] + 0x00000118u;
         /* 02094478 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 0209447C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0209447C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02094480 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209447C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02094480 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094480 */ _t5 = _t4 & 0x00000001u;
         /* 02094480 */ if (_t5) goto L_02094484; else goto L_0209448C;
   L_02094484: ; // 0x2094484
@@ -2434,14 +2434,14 @@ void Gambit_fn_020944B4(CPUState* cpu) {
         /* 020944C4 */ _t3 = cpu->r[3] + 0x000001E8u;
         /* 020944C4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 020944C8 */ /* nop */
-        /* 020944CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000006u);
+        /* 020944CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000006u));
         /* 020944D0 */ cpu->r[31] = 0x00000001u;
-        /* 020944D4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020944D4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020944D4 */ _t5 = _t4 & 0x00000001u;
         /* 020944D4 */ if (_t5) goto L_02094500; else goto L_020944D8;
   L_020944D8: ; // 0x20944d8
-        /* 020944D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 020944DC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020944D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 020944DC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020944DC */ _t7 = _t6 & 0x00000001u;
         /* 020944DC */ if (_t7) goto L_020944E0; else goto L_020944FC;
   L_020944E0: ; // 0x20944e0
@@ -2453,8 +2453,8 @@ void Gambit_fn_020944B4(CPUState* cpu) {
         /* 020944E8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
         /* 020944EC */ cpu->ctr = cpu->r[12];
         /* 020944F0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020944F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020944F8 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020944F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020944F8 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020944F8 */ _t12 = _t11 & 0x00000001u;
         /* 020944F8 */ if (_t12) goto L_020944FC; else goto L_02094500;
   L_020944FC: ; // 0x20944fc
@@ -2485,14 +2485,14 @@ void Gambit_fn_020944B8(CPUState* cpu) {
         /* 020944C4 */ _t3 = cpu->r[3] + 0x000001E8u;
         /* 020944C4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 020944C8 */ /* nop */
-        /* 020944CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000006u);
+        /* 020944CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000006u));
         /* 020944D0 */ cpu->r[31] = 0x00000001u;
-        /* 020944D4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020944D4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020944D4 */ _t5 = _t4 & 0x00000001u;
         /* 020944D4 */ if (_t5) goto L_02094500; else goto L_020944D8;
   L_020944D8: ; // 0x20944d8
-        /* 020944D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 020944DC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020944D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 020944DC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020944DC */ _t7 = _t6 & 0x00000001u;
         /* 020944DC */ if (_t7) goto L_020944E0; else goto L_020944FC;
   L_020944E0: ; // 0x20944e0
@@ -2504,8 +2504,8 @@ void Gambit_fn_020944B8(CPUState* cpu) {
         /* 020944E8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
         /* 020944EC */ cpu->ctr = cpu->r[12];
         /* 020944F0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020944F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020944F8 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020944F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020944F8 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020944F8 */ _t12 = _t11 & 0x00000001u;
         /* 020944F8 */ if (_t12) goto L_020944FC; else goto L_02094500;
   L_020944FC: ; // 0x20944fc
@@ -2551,9 +2551,9 @@ void Gambit_fn_02094530(CPUState* cpu) {
         /* 02094540 */ _t3 = cpu->r[3] + 0x000001E8u;
         /* 02094540 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02094544 */ /* nop */
-        /* 02094548 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x0000000Eu);
+        /* 02094548 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x0000000Eu));
         /* 0209454C */ cpu->r[31] = 0x00000001u;
-        /* 02094550 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094550 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094550 */ _t5 = _t4 & 0x00000001u;
         /* 02094550 */ if (_t5) goto L_02094574; else goto L_02094554;
   L_02094554: ; // 0x2094554
@@ -2565,8 +2565,8 @@ void Gambit_fn_02094530(CPUState* cpu) {
         /* 0209455C */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
         /* 02094560 */ cpu->ctr = cpu->r[0];
         /* 02094564 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02094568 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209456C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094568 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209456C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209456C */ _t10 = _t9 & 0x00000001u;
         /* 0209456C */ if (_t10) goto L_02094570; else goto L_02094574;
   L_02094570: ; // 0x2094570
@@ -2597,9 +2597,9 @@ void Gambit_fn_02094534(CPUState* cpu) {
         /* 02094540 */ _t3 = cpu->r[3] + 0x000001E8u;
         /* 02094540 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02094544 */ /* nop */
-        /* 02094548 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x0000000Eu);
+        /* 02094548 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x0000000Eu));
         /* 0209454C */ cpu->r[31] = 0x00000001u;
-        /* 02094550 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094550 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094550 */ _t5 = _t4 & 0x00000001u;
         /* 02094550 */ if (_t5) goto L_02094574; else goto L_02094554;
   L_02094554: ; // 0x2094554
@@ -2611,8 +2611,8 @@ void Gambit_fn_02094534(CPUState* cpu) {
         /* 0209455C */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
         /* 02094560 */ cpu->ctr = cpu->r[0];
         /* 02094564 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02094568 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209456C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094568 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209456C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209456C */ _t10 = _t9 & 0x00000001u;
         /* 0209456C */ if (_t10) goto L_02094570; else goto L_02094574;
   L_02094570: ; // 0x2094570
@@ -2692,8 +2692,8 @@ void Gambit_fn_020945BC(CPUState* cpu) {
         /* 020945D0 */ _t3 = cpu->r[31] + 0x00000264u;
         /* 020945D0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 020945D4 */ Gambit_fn_020BE9AC(cpu);
-        /* 020945D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020945DC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020945D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020945DC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020945DC */ _t5 = _t4 & 0x00000001u;
         /* 020945DC */ if (_t5) goto L_020945E0; else goto L_02094634;
   L_020945E0: ; // 0x20945e0
@@ -2702,8 +2702,8 @@ void Gambit_fn_020945BC(CPUState* cpu) {
         /* 020945E8 */ cpu->r[12] = cpu->r[0];
         /* 020945EC */ goto L_020945F8;
   L_020945F0: ; // 0x20945f0
-        /* 020945F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000006u);
-        /* 020945F4 */ _t6 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020945F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000006u));
+        /* 020945F4 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020945F4 */ _t7 = _t6 & 0x00000001u;
         /* 020945F4 */ if (_t7) goto L_020945F8; else goto L_02094604;
   L_020945F8: ; // 0x20945f8
@@ -2717,10 +2717,10 @@ void Gambit_fn_020945BC(CPUState* cpu) {
         /* 02094608 */ cpu->r[10] = rbrew_read32(cpu->mem, _t8);
         /* 0209460C */ cpu->r[9] = cpu->r[9] + 0x00000001u;
         /* 02094610 */ cpu->r[12] = cpu->r[12] + 0x00000004u;
-        /* 02094614 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000006u);
+        /* 02094614 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000006u));
         /* 02094618 */ _t9 = cpu->r[10] + 0x00000100u;
         /* 02094618 */ rbrew_write8(cpu->mem, _t9, (uint8_t)cpu->r[8]);
-        /* 0209461C */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209461C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209461C */ _t11 = _t10 & 0x00000001u;
         /* 0209461C */ if (_t11) goto L_020945F0; else goto L_02094620;
   L_02094620: ; // 0x2094620
@@ -2759,8 +2759,8 @@ void Gambit_fn_020945C0(CPUState* cpu) {
         /* 020945D0 */ _t3 = cpu->r[31] + 0x00000264u;
         /* 020945D0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 020945D4 */ Gambit_fn_020BE9AC(cpu);
-        /* 020945D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020945DC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020945D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020945DC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020945DC */ _t5 = _t4 & 0x00000001u;
         /* 020945DC */ if (_t5) goto L_020945E0; else goto L_02094634;
   L_020945E0: ; // 0x20945e0
@@ -2769,8 +2769,8 @@ void Gambit_fn_020945C0(CPUState* cpu) {
         /* 020945E8 */ cpu->r[12] = cpu->r[0];
         /* 020945EC */ goto L_020945F8;
   L_020945F0: ; // 0x20945f0
-        /* 020945F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000006u);
-        /* 020945F4 */ _t6 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020945F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000006u));
+        /* 020945F4 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020945F4 */ _t7 = _t6 & 0x00000001u;
         /* 020945F4 */ if (_t7) goto L_020945F8; else goto L_02094604;
   L_020945F8: ; // 0x20945f8
@@ -2784,10 +2784,10 @@ void Gambit_fn_020945C0(CPUState* cpu) {
         /* 02094608 */ cpu->r[10] = rbrew_read32(cpu->mem, _t8);
         /* 0209460C */ cpu->r[9] = cpu->r[9] + 0x00000001u;
         /* 02094610 */ cpu->r[12] = cpu->r[12] + 0x00000004u;
-        /* 02094614 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000006u);
+        /* 02094614 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000006u));
         /* 02094618 */ _t9 = cpu->r[10] + 0x00000100u;
         /* 02094618 */ rbrew_write8(cpu->mem, _t9, (uint8_t)cpu->r[8]);
-        /* 0209461C */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209461C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209461C */ _t11 = _t10 & 0x00000001u;
         /* 0209461C */ if (_t11) goto L_020945F0; else goto L_02094620;
   L_02094620: ; // 0x2094620
@@ -2835,8 +2835,8 @@ void Gambit_fn_02094648(CPUState* cpu) {
         /* 02094670 */ cpu->r[29] = cpu->r[31];
         /* 02094674 */ goto L_02094680;
   L_02094678: ; // 0x2094678
-        /* 02094678 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000002u);
-        /* 0209467C */ _t6 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02094678 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000002u));
+        /* 0209467C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209467C */ _t7 = _t6 & 0x00000001u;
         /* 0209467C */ if (_t7) goto L_02094680; else goto L_02094688;
   L_02094680: ; // 0x2094680
@@ -2853,23 +2853,23 @@ void Gambit_fn_02094648(CPUState* cpu) {
         /* 02094694 */ cpu->r[0] = rbrew_read32(cpu->mem, _t10);
         /* 02094698 */ cpu->ctr = cpu->r[0];
         /* 0209469C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020946A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020946A4 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020946A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020946A4 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020946A4 */ _t12 = _t11 & 0x00000001u;
         /* 020946A4 */ if (_t12) goto L_020946A8; else goto L_02094710;
   L_020946A8: ; // 0x20946a8
         /* 020946A8 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
-        /* 020946AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000002u);
+        /* 020946AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000002u));
         /* 020946B0 */ cpu->r[29] = cpu->r[29] + 0x00000004u;
-        /* 020946B4 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020946B4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020946B4 */ _t14 = _t13 & 0x00000001u;
         /* 020946B4 */ if (_t14) goto L_02094678; else goto L_020946B8;
   L_020946B8: ; // 0x20946b8
         /* 020946B8 */ _t15 = cpu->r[30] + 0x00000264u;
         /* 020946B8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t15);
         /* 020946BC */ Gambit_fn_020BE9AC(cpu);
-        /* 020946C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020946C4 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020946C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020946C4 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020946C4 */ _t17 = _t16 & 0x00000001u;
         /* 020946C4 */ if (_t17) goto L_020946C8; else goto L_02094710;
   L_020946C8: ; // 0x20946c8
@@ -2877,8 +2877,8 @@ void Gambit_fn_02094648(CPUState* cpu) {
         /* 020946CC */ cpu->r[12] = cpu->r[31];
         /* 020946D0 */ goto L_020946DC;
   L_020946D4: ; // 0x20946d4
-        /* 020946D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000002u);
-        /* 020946D8 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020946D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000002u));
+        /* 020946D8 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020946D8 */ _t19 = _t18 & 0x00000001u;
         /* 020946D8 */ if (_t19) goto L_020946DC; else goto L_020946E8;
   L_020946DC: ; // 0x20946dc
@@ -2892,10 +2892,10 @@ void Gambit_fn_02094648(CPUState* cpu) {
         /* 020946EC */ cpu->r[9] = rbrew_read32(cpu->mem, _t20);
         /* 020946F0 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
         /* 020946F4 */ cpu->r[12] = cpu->r[12] + 0x00000004u;
-        /* 020946F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000002u);
+        /* 020946F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000002u));
         /* 020946FC */ _t21 = cpu->r[9] + 0x00000100u;
         /* 020946FC */ rbrew_write8(cpu->mem, _t21, (uint8_t)cpu->r[0]);
-        /* 02094700 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02094700 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02094700 */ _t23 = _t22 & 0x00000001u;
         /* 02094700 */ if (_t23) goto L_020946D4; else goto L_02094704;
   L_02094704: ; // 0x2094704
@@ -2944,8 +2944,8 @@ void Gambit_fn_0209464C(CPUState* cpu) {
         /* 02094670 */ cpu->r[29] = cpu->r[31];
         /* 02094674 */ goto L_02094680;
   L_02094678: ; // 0x2094678
-        /* 02094678 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000002u);
-        /* 0209467C */ _t6 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02094678 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000002u));
+        /* 0209467C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209467C */ _t7 = _t6 & 0x00000001u;
         /* 0209467C */ if (_t7) goto L_02094680; else goto L_02094688;
   L_02094680: ; // 0x2094680
@@ -2962,23 +2962,23 @@ void Gambit_fn_0209464C(CPUState* cpu) {
         /* 02094694 */ cpu->r[0] = rbrew_read32(cpu->mem, _t10);
         /* 02094698 */ cpu->ctr = cpu->r[0];
         /* 0209469C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020946A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020946A4 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020946A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020946A4 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020946A4 */ _t12 = _t11 & 0x00000001u;
         /* 020946A4 */ if (_t12) goto L_020946A8; else goto L_02094710;
   L_020946A8: ; // 0x20946a8
         /* 020946A8 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
-        /* 020946AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000002u);
+        /* 020946AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000002u));
         /* 020946B0 */ cpu->r[29] = cpu->r[29] + 0x00000004u;
-        /* 020946B4 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020946B4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020946B4 */ _t14 = _t13 & 0x00000001u;
         /* 020946B4 */ if (_t14) goto L_02094678; else goto L_020946B8;
   L_020946B8: ; // 0x20946b8
         /* 020946B8 */ _t15 = cpu->r[30] + 0x00000264u;
         /* 020946B8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t15);
         /* 020946BC */ Gambit_fn_020BE9AC(cpu);
-        /* 020946C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020946C4 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020946C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020946C4 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020946C4 */ _t17 = _t16 & 0x00000001u;
         /* 020946C4 */ if (_t17) goto L_020946C8; else goto L_02094710;
   L_020946C8: ; // 0x20946c8
@@ -2986,8 +2986,8 @@ void Gambit_fn_0209464C(CPUState* cpu) {
         /* 020946CC */ cpu->r[12] = cpu->r[31];
         /* 020946D0 */ goto L_020946DC;
   L_020946D4: ; // 0x20946d4
-        /* 020946D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000002u);
-        /* 020946D8 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020946D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000002u));
+        /* 020946D8 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020946D8 */ _t19 = _t18 & 0x00000001u;
         /* 020946D8 */ if (_t19) goto L_020946DC; else goto L_020946E8;
   L_020946DC: ; // 0x20946dc
@@ -3001,10 +3001,10 @@ void Gambit_fn_0209464C(CPUState* cpu) {
         /* 020946EC */ cpu->r[9] = rbrew_read32(cpu->mem, _t20);
         /* 020946F0 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
         /* 020946F4 */ cpu->r[12] = cpu->r[12] + 0x00000004u;
-        /* 020946F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000002u);
+        /* 020946F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000002u));
         /* 020946FC */ _t21 = cpu->r[9] + 0x00000100u;
         /* 020946FC */ rbrew_write8(cpu->mem, _t21, (uint8_t)cpu->r[0]);
-        /* 02094700 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02094700 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02094700 */ _t23 = _t22 & 0x00000001u;
         /* 02094700 */ if (_t23) goto L_020946D4; else goto L_02094704;
   L_02094704: ; // 0x2094704
@@ -3046,8 +3046,8 @@ void Gambit_fn_02094730(CPUState* cpu) {
         /* 02094744 */ _t3 = cpu->r[31] + 0x000001E8u;
         /* 02094744 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02094748 */ /* nop */
-        /* 0209474C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02094750 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209474C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02094750 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094750 */ _t5 = _t4 & 0x00000001u;
         /* 02094750 */ if (_t5) goto L_02094754; else goto L_02094764;
   L_02094754: ; // 0x2094754
@@ -3057,18 +3057,18 @@ void Gambit_fn_02094730(CPUState* cpu) {
         /* 0209475C */ cpu->r[0] = rbrew_read8(cpu->mem, _t6);
         /* 02094760 */ /* nop */
   L_02094764: ; // 0x2094764
-        /* 02094764 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 02094768 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094764 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 02094768 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094768 */ _t8 = _t7 & 0x00000001u;
         /* 02094768 */ if (_t8) goto L_0209477C; else goto L_0209476C;
   L_0209476C: ; // 0x209476c
-        /* 0209476C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000008u);
-        /* 02094770 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209476C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000008u));
+        /* 02094770 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094770 */ _t10 = _t9 & 0x00000001u;
         /* 02094770 */ if (_t10) goto L_0209477C; else goto L_02094774;
   L_02094774: ; // 0x2094774
-        /* 02094774 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x0000000Bu);
-        /* 02094778 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094774 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x0000000Bu));
+        /* 02094778 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094778 */ _t12 = _t11 & 0x00000001u;
         /* 02094778 */ if (_t12) goto L_0209477C; else goto L_02094784;
   L_0209477C: ; // 0x209477c
@@ -3100,8 +3100,8 @@ void Gambit_fn_02094734(CPUState* cpu) {
         /* 02094744 */ _t3 = cpu->r[31] + 0x000001E8u;
         /* 02094744 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02094748 */ /* nop */
-        /* 0209474C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02094750 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209474C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02094750 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094750 */ _t5 = _t4 & 0x00000001u;
         /* 02094750 */ if (_t5) goto L_02094754; else goto L_02094764;
   L_02094754: ; // 0x2094754
@@ -3111,18 +3111,18 @@ void Gambit_fn_02094734(CPUState* cpu) {
         /* 0209475C */ cpu->r[0] = rbrew_read8(cpu->mem, _t6);
         /* 02094760 */ /* nop */
   L_02094764: ; // 0x2094764
-        /* 02094764 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 02094768 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094764 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 02094768 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094768 */ _t8 = _t7 & 0x00000001u;
         /* 02094768 */ if (_t8) goto L_0209477C; else goto L_0209476C;
   L_0209476C: ; // 0x209476c
-        /* 0209476C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000008u);
-        /* 02094770 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209476C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000008u));
+        /* 02094770 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094770 */ _t10 = _t9 & 0x00000001u;
         /* 02094770 */ if (_t10) goto L_0209477C; else goto L_02094774;
   L_02094774: ; // 0x2094774
-        /* 02094774 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x0000000Bu);
-        /* 02094778 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094774 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x0000000Bu));
+        /* 02094778 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094778 */ _t12 = _t11 & 0x00000001u;
         /* 02094778 */ if (_t12) goto L_0209477C; else goto L_02094784;
   L_0209477C: ; // 0x209477c
@@ -3184,13 +3184,13 @@ void Gambit_fn_02094798(CPUState* cpu) {
         /* 02094808 */ cpu->r[5] = cpu->r[22];
         /* 0209480C */ cpu->r[4] = cpu->r[30] + 0xFFFFEC08u;
         /* 02094810 */ cpu->r[3] = cpu->r[1] + 0x00000010u;
-        /* 02094814 */ _t8 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02094814 */ _t8 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02094814 */ _t9 = _t8 & 0x00000001u;
         /* 02094814 */ if (_t9) goto L_02094818; // else: addr-0 trap, fall-through
   L_02094818: ; // 0x2094818
         /* 02094818 */ Gambit_fn_0282A5F4(cpu);
-        /* 0209481C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[22], 0x00000006u);
-        /* 02094820 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209481C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[22], 0x00000006u));
+        /* 02094820 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02094820 */ _t11 = _t10 & 0x00000001u;
         /* 02094820 */ if (_t11) goto L_02094824; else goto L_02094848;
   L_02094824: ; // 0x2094824
@@ -3200,9 +3200,9 @@ void Gambit_fn_02094798(CPUState* cpu) {
         /* 02094830 */ Gambit_fn_026D86C0(cpu);
         /* 02094834 */ _t12 = cpu->r[26] + 0xFFFFEDBCu;
         /* 02094834 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 02094838 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02094838 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0209483C */ cpu->r[31] = cpu->r[3];
-        /* 02094840 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094840 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094840 */ _t14 = _t13 & 0x00000001u;
         /* 02094840 */ if (_t14) goto L_02094844; else goto L_02094870;
   L_02094844: ; // 0x2094844
@@ -3214,9 +3214,9 @@ void Gambit_fn_02094798(CPUState* cpu) {
         /* 02094854 */ Gambit_fn_026D86C0(cpu);
         /* 02094858 */ _t15 = cpu->r[26] + 0xFFFFEDBCu;
         /* 02094858 */ cpu->r[0] = rbrew_read32(cpu->mem, _t15);
-        /* 0209485C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0209485C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02094860 */ cpu->r[31] = cpu->r[3];
-        /* 02094864 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094864 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094864 */ _t17 = _t16 & 0x00000001u;
         /* 02094864 */ if (_t17) goto L_02094868; else goto L_02094870;
   L_02094868: ; // 0x2094868
@@ -3225,8 +3225,8 @@ void Gambit_fn_02094798(CPUState* cpu) {
         /* 0209486C */ _t19 = cpu->r[26] + 0xFFFFEDBCu;
         /* 0209486C */ rbrew_write32(cpu->mem, _t19, cpu->r[23]);
   L_02094870: ; // 0x2094870
-        /* 02094870 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02094874 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094870 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02094874 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094874 */ _t21 = _t20 & 0x00000001u;
         /* 02094874 */ if (_t21) goto L_02094898; else goto L_02094878;
   L_02094878: ; // 0x2094878
@@ -3238,26 +3238,26 @@ void Gambit_fn_02094798(CPUState* cpu) {
         /* 02094884 */ cpu->r[3] = cpu->r[31];
         /* 02094888 */ cpu->r[4] = cpu->r[29] + 0xFFFFEE20u;
         /* 0209488C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02094890 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02094894 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094890 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02094894 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094894 */ _t25 = _t24 & 0x00000001u;
         /* 02094894 */ if (_t25) goto L_02094898; else goto L_0209489C;
   L_02094898: ; // 0x2094898
         /* 02094898 */ cpu->r[31] = 0x00000000u;
   L_0209489C: ; // 0x209489c
-        /* 0209489C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[22], 0x00000006u);
+        /* 0209489C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[22], 0x00000006u));
         /* 020948A0 */ _t26 = cpu->r[19] + 0x00000000u;
         /* 020948A0 */ rbrew_write32(cpu->mem, _t26, cpu->r[31]);
-        /* 020948A4 */ _t27 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020948A4 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020948A4 */ _t28 = _t27 & 0x00000001u;
         /* 020948A4 */ if (_t28) goto L_020948A8; else goto L_020948BC;
   L_020948A8: ; // 0x20948a8
         /* 020948A8 */ _t29 = cpu->r[24] + cpu->r[20];
         /* 020948A8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t29);
-        /* 020948AC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[22], 0x00000006u);
+        /* 020948AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[22], 0x00000006u));
         /* 020948B0 */ _t30 = cpu->r[6] + 0x000001B7u;
         /* 020948B0 */ rbrew_write8(cpu->mem, _t30, (uint8_t)cpu->r[23]);
-        /* 020948B4 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020948B4 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020948B4 */ _t32 = _t31 & 0x00000001u;
         /* 020948B4 */ if (_t32) goto L_020948CC; else goto L_020948B8;
   L_020948B8: ; // 0x20948b8
@@ -3265,10 +3265,10 @@ void Gambit_fn_02094798(CPUState* cpu) {
   L_020948BC: ; // 0x20948bc
         /* 020948BC */ _t33 = cpu->r[24] + 0x00000000u;
         /* 020948BC */ cpu->r[6] = rbrew_read32(cpu->mem, _t33);
-        /* 020948C0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[22], 0x00000006u);
+        /* 020948C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[22], 0x00000006u));
         /* 020948C4 */ _t34 = cpu->r[6] + 0x000001B7u;
         /* 020948C4 */ rbrew_write8(cpu->mem, _t34, (uint8_t)cpu->r[23]);
-        /* 020948C8 */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020948C8 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020948C8 */ _t36 = _t35 & 0x00000001u;
         /* 020948C8 */ if (_t36) goto L_020948CC; else goto L_020948E8;
   L_020948CC: ; // 0x20948cc
@@ -3276,11 +3276,11 @@ void Gambit_fn_02094798(CPUState* cpu) {
         /* 020948CC */ cpu->r[8] = rbrew_read32(cpu->mem, _t37);
         /* 020948D0 */ cpu->r[20] = cpu->r[20] + 0x00000004u;
         /* 020948D4 */ cpu->r[21] = cpu->r[21] + 0xFFFFFFFFu;
-        /* 020948D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
+        /* 020948D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
         /* 020948D8 */ cpu->r[22] = cpu->r[22] + 0x00000001u;
         /* 020948DC */ _t38 = cpu->r[8] + 0x000001B8u;
         /* 020948DC */ rbrew_write8(cpu->mem, _t38, (uint8_t)cpu->r[23]);
-        /* 020948E0 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020948E0 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020948E0 */ _t40 = _t39 & 0x00000001u;
         /* 020948E0 */ if (_t40) goto L_020948E4; else goto L_02094808;
   L_020948E4: ; // 0x20948e4
@@ -3290,11 +3290,11 @@ void Gambit_fn_02094798(CPUState* cpu) {
         /* 020948E8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t41);
         /* 020948EC */ cpu->r[20] = cpu->r[20] + 0x00000004u;
         /* 020948F0 */ cpu->r[21] = cpu->r[21] + 0xFFFFFFFFu;
-        /* 020948F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
+        /* 020948F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
         /* 020948F4 */ cpu->r[22] = cpu->r[22] + 0x00000001u;
         /* 020948F8 */ _t42 = cpu->r[8] + 0x000001B8u;
         /* 020948F8 */ rbrew_write8(cpu->mem, _t42, (uint8_t)cpu->r[23]);
-        /* 020948FC */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020948FC */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020948FC */ _t44 = _t43 & 0x00000001u;
         /* 020948FC */ if (_t44) goto L_02094900; else goto L_02094808;
   L_02094900: ; // 0x2094900
@@ -3313,9 +3313,9 @@ void Gambit_fn_02094798(CPUState* cpu) {
         /* 02094920 */ cpu->r[6] = _t47;
         /* 02094924 */ cpu->r[31] = cpu->r[3];
         /* 02094928 */ cpu->r[4] = 0x101D0000u;
-        /* 0209492C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0209492C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02094930 */ cpu->r[4] = cpu->r[4] + 0xFFFFEE40u;
-        /* 02094934 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094934 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094934 */ _t49 = _t48 & 0x00000001u;
         /* 02094934 */ if (_t49) goto L_02094938; else goto L_0209494C;
   L_02094938: ; // 0x2094938
@@ -3327,8 +3327,8 @@ void Gambit_fn_02094798(CPUState* cpu) {
         /* 02094948 */ _t51 = cpu->r[4] + 0x00000000u;
         /* 02094948 */ rbrew_write32(cpu->mem, _t51, cpu->r[8]);
   L_0209494C: ; // 0x209494c
-        /* 0209494C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02094950 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209494C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02094950 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094950 */ _t53 = _t52 & 0x00000001u;
         /* 02094950 */ if (_t53) goto L_02094970; else goto L_02094954;
   L_02094954: ; // 0x2094954
@@ -3339,8 +3339,8 @@ void Gambit_fn_02094798(CPUState* cpu) {
         /* 0209495C */ cpu->ctr = cpu->r[10];
         /* 02094960 */ cpu->r[3] = cpu->r[31];
         /* 02094964 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02094968 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209496C */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094968 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209496C */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209496C */ _t57 = _t56 & 0x00000001u;
         /* 0209496C */ if (_t57) goto L_02094970; else goto L_02094974;
   L_02094970: ; // 0x2094970
@@ -3368,9 +3368,9 @@ void Gambit_fn_02094798(CPUState* cpu) {
         /* 020949A8 */ Gambit_fn_026D86C0(cpu);
         /* 020949AC */ _t64 = cpu->r[26] + 0xFFFFEDBCu;
         /* 020949AC */ cpu->r[5] = rbrew_read32(cpu->mem, _t64);
-        /* 020949B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 020949B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 020949B4 */ cpu->r[31] = cpu->r[3];
-        /* 020949B8 */ _t65 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020949B8 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020949B8 */ _t66 = _t65 & 0x00000001u;
         /* 020949B8 */ if (_t66) goto L_020949BC; else goto L_020949C8;
   L_020949BC: ; // 0x20949bc
@@ -3380,8 +3380,8 @@ void Gambit_fn_02094798(CPUState* cpu) {
         /* 020949C4 */ _t68 = cpu->r[26] + 0xFFFFEDBCu;
         /* 020949C4 */ rbrew_write32(cpu->mem, _t68, cpu->r[7]);
   L_020949C8: ; // 0x20949c8
-        /* 020949C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020949CC */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020949C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020949CC */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020949CC */ _t70 = _t69 & 0x00000001u;
         /* 020949CC */ if (_t70) goto L_020949F0; else goto L_020949D0;
   L_020949D0: ; // 0x20949d0
@@ -3393,8 +3393,8 @@ void Gambit_fn_02094798(CPUState* cpu) {
         /* 020949DC */ cpu->r[3] = cpu->r[31];
         /* 020949E0 */ cpu->r[4] = cpu->r[29] + 0xFFFFEE20u;
         /* 020949E4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020949E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020949EC */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020949E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020949EC */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020949EC */ _t74 = _t73 & 0x00000001u;
         /* 020949EC */ if (_t74) goto L_020949F0; else goto L_020949F4;
   L_020949F0: ; // 0x20949f0
@@ -3413,9 +3413,9 @@ void Gambit_fn_02094798(CPUState* cpu) {
         /* 02094A10 */ Gambit_fn_026D86C0(cpu);
         /* 02094A14 */ _t78 = cpu->r[26] + 0xFFFFEDBCu;
         /* 02094A14 */ cpu->r[12] = rbrew_read32(cpu->mem, _t78);
-        /* 02094A18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02094A18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02094A1C */ cpu->r[31] = cpu->r[3];
-        /* 02094A20 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094A20 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094A20 */ _t80 = _t79 & 0x00000001u;
         /* 02094A20 */ if (_t80) goto L_02094A24; else goto L_02094A30;
   L_02094A24: ; // 0x2094a24
@@ -3425,8 +3425,8 @@ void Gambit_fn_02094798(CPUState* cpu) {
         /* 02094A2C */ _t82 = cpu->r[26] + 0xFFFFEDBCu;
         /* 02094A2C */ rbrew_write32(cpu->mem, _t82, cpu->r[0]);
   L_02094A30: ; // 0x2094a30
-        /* 02094A30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02094A34 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094A30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02094A34 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094A34 */ _t84 = _t83 & 0x00000001u;
         /* 02094A34 */ if (_t84) goto L_02094A58; else goto L_02094A38;
   L_02094A38: ; // 0x2094a38
@@ -3438,8 +3438,8 @@ void Gambit_fn_02094798(CPUState* cpu) {
         /* 02094A44 */ cpu->r[4] = cpu->r[29] + 0xFFFFEE20u;
         /* 02094A48 */ cpu->r[3] = cpu->r[31];
         /* 02094A4C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02094A50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02094A54 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094A50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02094A54 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094A54 */ _t88 = _t87 & 0x00000001u;
         /* 02094A54 */ if (_t88) goto L_02094A58; else goto L_02094A5C;
   L_02094A58: ; // 0x2094a58
@@ -3451,8 +3451,8 @@ void Gambit_fn_02094798(CPUState* cpu) {
         /* 02094A64 */ cpu->r[5] = cpu->r[30];
         /* 02094A68 */ goto L_02094A74;
   L_02094A6C: ; // 0x2094a6c
-        /* 02094A6C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x00000002u);
-        /* 02094A70 */ _t90 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02094A6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x00000002u));
+        /* 02094A70 */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02094A70 */ _t91 = _t90 & 0x00000001u;
         /* 02094A70 */ if (_t91) goto L_02094A74; else goto L_02094A80;
   L_02094A74: ; // 0x2094a74
@@ -3466,10 +3466,10 @@ void Gambit_fn_02094798(CPUState* cpu) {
         /* 02094A84 */ cpu->r[8] = rbrew_read32(cpu->mem, _t92);
         /* 02094A88 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
         /* 02094A8C */ cpu->r[5] = cpu->r[5] + 0x00000004u;
-        /* 02094A90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000002u);
+        /* 02094A90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000002u));
         /* 02094A94 */ _t93 = cpu->r[8] + 0x000001B7u;
         /* 02094A94 */ rbrew_write8(cpu->mem, _t93, (uint8_t)cpu->r[0]);
-        /* 02094A98 */ _t94 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02094A98 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02094A98 */ _t95 = _t94 & 0x00000001u;
         /* 02094A98 */ if (_t95) goto L_02094A6C; else goto L_02094A9C;
   L_02094A9C: ; // 0x2094a9c
@@ -3484,9 +3484,9 @@ void Gambit_fn_02094798(CPUState* cpu) {
         /* 02094AB4 */ Gambit_fn_026D86C0(cpu);
         /* 02094AB8 */ _t98 = cpu->r[26] + 0xFFFFEDBCu;
         /* 02094AB8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t98);
-        /* 02094ABC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02094ABC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02094AC0 */ cpu->r[31] = cpu->r[3];
-        /* 02094AC4 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094AC4 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094AC4 */ _t100 = _t99 & 0x00000001u;
         /* 02094AC4 */ if (_t100) goto L_02094AC8; else goto L_02094AD4;
   L_02094AC8: ; // 0x2094ac8
@@ -3496,8 +3496,8 @@ void Gambit_fn_02094798(CPUState* cpu) {
         /* 02094AD0 */ _t102 = cpu->r[26] + 0xFFFFEDBCu;
         /* 02094AD0 */ rbrew_write32(cpu->mem, _t102, cpu->r[10]);
   L_02094AD4: ; // 0x2094ad4
-        /* 02094AD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02094AD8 */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094AD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02094AD8 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094AD8 */ _t104 = _t103 & 0x00000001u;
         /* 02094AD8 */ if (_t104) goto L_02094AFC; else goto L_02094ADC;
   L_02094ADC: ; // 0x2094adc
@@ -3509,8 +3509,8 @@ void Gambit_fn_02094798(CPUState* cpu) {
         /* 02094AE8 */ cpu->r[3] = cpu->r[31];
         /* 02094AEC */ cpu->r[4] = cpu->r[29] + 0xFFFFEE20u;
         /* 02094AF0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02094AF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02094AF8 */ _t107 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094AF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02094AF8 */ _t107 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094AF8 */ _t108 = _t107 & 0x00000001u;
         /* 02094AF8 */ if (_t108) goto L_02094AFC; else goto L_02094B00;
   L_02094AFC: ; // 0x2094afc
@@ -3643,24 +3643,24 @@ void Gambit_fn_02094B2C(CPUState* cpu) {
         /* 02094C58 */ cpu->r[30] = cpu->r[30] + 0xFFFFEC4Cu;
         /* 02094C5C */ goto L_02094C84;
   L_02094C60: ; // 0x2094c60
-        /* 02094C60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000003u);
-        /* 02094C64 */ _t26 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02094C60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000003u));
+        /* 02094C64 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02094C64 */ _t27 = _t26 & 0x00000001u;
         /* 02094C64 */ if (_t27) goto L_02094C7C; else goto L_02094C68;
   L_02094C68: ; // 0x2094c68
         /* 02094C68 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 02094C6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000006u);
-        /* 02094C70 */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02094C6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000006u));
+        /* 02094C70 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02094C70 */ _t29 = _t28 & 0x00000001u;
         /* 02094C70 */ if (_t29) goto L_02094C74; else goto L_02094D40;
   L_02094C74: ; // 0x2094c74
-        /* 02094C74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000003u);
-        /* 02094C78 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02094C74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000003u));
+        /* 02094C78 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02094C78 */ _t31 = _t30 & 0x00000001u;
         /* 02094C78 */ if (_t31) goto L_02094C7C; else goto L_02094C68;
   L_02094C7C: ; // 0x2094c7c
-        /* 02094C7C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000006u);
-        /* 02094C80 */ _t32 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02094C7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000006u));
+        /* 02094C80 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02094C80 */ _t33 = _t32 & 0x00000001u;
         /* 02094C80 */ if (_t33) goto L_02094C84; else goto L_02094C90;
   L_02094C84: ; // 0x2094c84
@@ -3688,8 +3688,8 @@ void Gambit_fn_02094B2C(CPUState* cpu) {
         /* 02094CB4 */ cpu->r[5] = cpu->r[1] + 0x00000010u;
         /* 02094CB8 */ cpu->r[6] = cpu->r[1] + 0x00000018u;
         /* 02094CBC */ Gambit_fn_027ECE60(cpu);
-        /* 02094CC0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000006u);
-        /* 02094CC4 */ _t41 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02094CC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000006u));
+        /* 02094CC4 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02094CC4 */ _t42 = _t41 & 0x00000001u;
         /* 02094CC4 */ if (_t42) goto L_02094CC8; else goto L_02094D08;
   L_02094CC8: ; // 0x2094cc8
@@ -3713,8 +3713,8 @@ void Gambit_fn_02094B2C(CPUState* cpu) {
         /* 02094CF0 */ cpu->r[6] = cpu->r[1] + 0x00000008u;
         /* 02094CF4 */ Gambit_fn_027ECE60(cpu);
         /* 02094CF8 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 02094CFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000006u);
-        /* 02094D00 */ _t50 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02094CFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000006u));
+        /* 02094D00 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02094D00 */ _t51 = _t50 & 0x00000001u;
         /* 02094D00 */ if (_t51) goto L_02094C60; else goto L_02094D04;
   L_02094D04: ; // 0x2094d04
@@ -3739,8 +3739,8 @@ void Gambit_fn_02094B2C(CPUState* cpu) {
         /* 02094D2C */ cpu->r[6] = cpu->r[1] + 0x00000008u;
         /* 02094D30 */ Gambit_fn_027ECE60(cpu);
         /* 02094D34 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 02094D38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000006u);
-        /* 02094D3C */ _t59 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02094D38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000006u));
+        /* 02094D3C */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02094D3C */ _t60 = _t59 & 0x00000001u;
         /* 02094D3C */ if (_t60) goto L_02094C60; else goto L_02094D40;
   L_02094D40: ; // 0x2094d40
@@ -3794,10 +3794,10 @@ void Gambit_fn_02094D54(CPUState* cpu) {
         /* 02094DB8 */ rbrew_write32(cpu->mem, _t6, cpu->r[30]);
         /* 02094DBC */ Gambit_fn_020A7150(cpu);
         /* 02094DC0 */ cpu->r[28] = cpu->r[28] + 0xFFFFFFFFu;
-        /* 02094DC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 02094DC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 02094DC4 */ _t7 = cpu->r[31] + 0x00000000u;
         /* 02094DC4 */ rbrew_write32(cpu->mem, _t7, cpu->r[3]);
-        /* 02094DC8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094DC8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094DC8 */ _t9 = _t8 & 0x00000001u;
         /* 02094DC8 */ if (_t9) goto L_02094DCC; else goto L_02094D8C;
   L_02094DCC: ; // 0x2094dcc
@@ -3918,8 +3918,8 @@ void Gambit_fn_02094E94(CPUState* cpu) {
         /* 02094F00 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02094F04 */ _t13 = cpu->r[1] + 0x00000008u;
         /* 02094F04 */ cpu->r[0] = rbrew_read32(cpu->mem, _t13);
-        /* 02094F08 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
-        /* 02094F0C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094F08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
+        /* 02094F0C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094F0C */ _t15 = _t14 & 0x00000001u;
         /* 02094F0C */ if (_t15) goto L_02094F10; else goto L_02094F18;
   L_02094F10: ; // 0x2094f10
@@ -3945,13 +3945,13 @@ void Gambit_fn_02094E94(CPUState* cpu) {
         /* 02094F40 */ _t20 = cpu->r[11] + 0x00000001u;
         /* 02094F40 */ cpu->r[8] = rbrew_read8(cpu->mem, _t20);
         /* 02094F40 */ cpu->r[11] = _t20;
-        /* 02094F44 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
-        /* 02094F48 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094F44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
+        /* 02094F48 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094F48 */ _t22 = _t21 & 0x00000001u;
         /* 02094F48 */ if (_t22) goto L_02094F4C; else goto L_02094F58;
   L_02094F4C: ; // 0x2094f4c
-        /* 02094F4C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 02094F50 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094F4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 02094F50 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094F50 */ _t24 = _t23 & 0x00000001u;
         /* 02094F50 */ if (_t24) goto L_02094F10; else goto L_02094F54;
   L_02094F54: ; // 0x2094f54
@@ -4020,8 +4020,8 @@ void Gambit_fn_02094EA0(CPUState* cpu) {
         /* 02094F00 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02094F04 */ _t13 = cpu->r[1] + 0x00000008u;
         /* 02094F04 */ cpu->r[0] = rbrew_read32(cpu->mem, _t13);
-        /* 02094F08 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
-        /* 02094F0C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094F08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
+        /* 02094F0C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094F0C */ _t15 = _t14 & 0x00000001u;
         /* 02094F0C */ if (_t15) goto L_02094F10; else goto L_02094F18;
   L_02094F10: ; // 0x2094f10
@@ -4047,13 +4047,13 @@ void Gambit_fn_02094EA0(CPUState* cpu) {
         /* 02094F40 */ _t20 = cpu->r[11] + 0x00000001u;
         /* 02094F40 */ cpu->r[8] = rbrew_read8(cpu->mem, _t20);
         /* 02094F40 */ cpu->r[11] = _t20;
-        /* 02094F44 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
-        /* 02094F48 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094F44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
+        /* 02094F48 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094F48 */ _t22 = _t21 & 0x00000001u;
         /* 02094F48 */ if (_t22) goto L_02094F4C; else goto L_02094F58;
   L_02094F4C: ; // 0x2094f4c
-        /* 02094F4C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 02094F50 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094F4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 02094F50 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094F50 */ _t24 = _t23 & 0x00000001u;
         /* 02094F50 */ if (_t24) goto L_02094F10; else goto L_02094F54;
   L_02094F54: ; // 0x2094f54
@@ -4086,7 +4086,7 @@ void Gambit_fn_02094F74(CPUState* cpu) {
         /* 02094F7C */ cpu->r[10] = 0x10010000u;
         /* 02094F80 */ cpu->r[7] = cpu->r[7] + 0xFFFFE99Cu;
         /* 02094F84 */ cpu->r[10] = cpu->r[10] + 0xFFFFED40u;
-        /* 02094F88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000002u);
+        /* 02094F88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000002u));
         /* 02094F8C */ _t0 = cpu->r[1] + 0x00000004u;
         /* 02094F8C */ rbrew_write32(cpu->mem, _t0, cpu->r[0]);
         /* 02094F90 */ cpu->r[0] = 0x10010000u;
@@ -4094,25 +4094,25 @@ void Gambit_fn_02094F74(CPUState* cpu) {
         /* 02094F94 */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 02094F94 */ cpu->r[1] = _t1;
         /* 02094F98 */ cpu->r[0] = cpu->r[0] + 0xFFFFED48u;
-        /* 02094F9C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094F9C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094F9C */ _t3 = _t2 & 0x00000001u;
         /* 02094F9C */ if (_t3) goto L_02094FA8; else goto L_02094FA0;
   L_02094FA0: ; // 0x2094fa0
-        /* 02094FA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000003u);
-        /* 02094FA4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094FA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000003u));
+        /* 02094FA4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094FA4 */ _t5 = _t4 & 0x00000001u;
         /* 02094FA4 */ if (_t5) goto L_02094FA8; else goto L_02094FE4;
   L_02094FA8: ; // 0x2094fa8
-        /* 02094FA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 02094FAC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094FA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 02094FAC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094FAC */ _t7 = _t6 & 0x00000001u;
         /* 02094FAC */ if (_t7) goto L_02094FB4; else goto L_02094FB0;
   L_02094FB0: ; // 0x2094fb0
         /* 02094FB0 */ cpu->r[10] = cpu->r[0];
   L_02094FB4: ; // 0x2094fb4
-        /* 02094FB4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000006u);
+        /* 02094FB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000006u));
         /* 02094FB8 */ cpu->r[11] = cpu->r[3] + 0x00000218u;
-        /* 02094FBC */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02094FBC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02094FBC */ _t9 = _t8 & 0x00000001u;
         /* 02094FBC */ if (_t9) goto L_02094FC0; else goto L_02094FC8;
   L_02094FC0: ; // 0x2094fc0
@@ -4130,16 +4130,16 @@ void Gambit_fn_02094F74(CPUState* cpu) {
         /* 02094FDC */ Gambit_fn_027EDD5C(cpu);
         /* 02094FE0 */ goto L_0209501C;
   L_02094FE4: ; // 0x2094fe4
-        /* 02094FE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 02094FE8 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094FE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 02094FE8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094FE8 */ _t14 = _t13 & 0x00000001u;
         /* 02094FE8 */ if (_t14) goto L_02094FF0; else goto L_02094FEC;
   L_02094FEC: ; // 0x2094fec
         /* 02094FEC */ cpu->r[0] = cpu->r[10];
   L_02094FF0: ; // 0x2094ff0
-        /* 02094FF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000006u);
+        /* 02094FF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000006u));
         /* 02094FF4 */ cpu->r[12] = cpu->r[3] + 0x00000218u;
-        /* 02094FF8 */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02094FF8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02094FF8 */ _t16 = _t15 & 0x00000001u;
         /* 02094FF8 */ if (_t16) goto L_02094FFC; else goto L_02095004;
   L_02094FFC: ; // 0x2094ffc
@@ -4172,25 +4172,25 @@ void Gambit_fn_02094F94(CPUState* cpu) {
         /* 02094F94 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 02094F94 */ cpu->r[1] = _t0;
         /* 02094F98 */ cpu->r[0] = cpu->r[0] + 0xFFFFED48u;
-        /* 02094F9C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094F9C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094F9C */ _t2 = _t1 & 0x00000001u;
         /* 02094F9C */ if (_t2) goto L_02094FA8; else goto L_02094FA0;
   L_02094FA0: ; // 0x2094fa0
-        /* 02094FA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000003u);
-        /* 02094FA4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094FA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000003u));
+        /* 02094FA4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094FA4 */ _t4 = _t3 & 0x00000001u;
         /* 02094FA4 */ if (_t4) goto L_02094FA8; else goto L_02094FE4;
   L_02094FA8: ; // 0x2094fa8
-        /* 02094FA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 02094FAC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094FA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 02094FAC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094FAC */ _t6 = _t5 & 0x00000001u;
         /* 02094FAC */ if (_t6) goto L_02094FB4; else goto L_02094FB0;
   L_02094FB0: ; // 0x2094fb0
         /* 02094FB0 */ cpu->r[10] = cpu->r[0];
   L_02094FB4: ; // 0x2094fb4
-        /* 02094FB4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000006u);
+        /* 02094FB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000006u));
         /* 02094FB8 */ cpu->r[11] = cpu->r[3] + 0x00000218u;
-        /* 02094FBC */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02094FBC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02094FBC */ _t8 = _t7 & 0x00000001u;
         /* 02094FBC */ if (_t8) goto L_02094FC0; else goto L_02094FC8;
   L_02094FC0: ; // 0x2094fc0
@@ -4208,16 +4208,16 @@ void Gambit_fn_02094F94(CPUState* cpu) {
         /* 02094FDC */ Gambit_fn_027EDD5C(cpu);
         /* 02094FE0 */ goto L_0209501C;
   L_02094FE4: ; // 0x2094fe4
-        /* 02094FE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 02094FE8 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02094FE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 02094FE8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02094FE8 */ _t13 = _t12 & 0x00000001u;
         /* 02094FE8 */ if (_t13) goto L_02094FF0; else goto L_02094FEC;
   L_02094FEC: ; // 0x2094fec
         /* 02094FEC */ cpu->r[0] = cpu->r[10];
   L_02094FF0: ; // 0x2094ff0
-        /* 02094FF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000006u);
+        /* 02094FF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000006u));
         /* 02094FF4 */ cpu->r[12] = cpu->r[3] + 0x00000218u;
-        /* 02094FF8 */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02094FF8 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02094FF8 */ _t15 = _t14 & 0x00000001u;
         /* 02094FF8 */ if (_t15) goto L_02094FFC; else goto L_02095004;
   L_02094FFC: ; // 0x2094ffc
@@ -4258,8 +4258,8 @@ void Gambit_fn_02095030(CPUState* cpu) {
         /* 02095040 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 02095044 */ _t4 = cpu->r[30] + 0x000001E4u;
         /* 02095044 */ cpu->r[12] = rbrew_read32(cpu->mem, _t4);
-        /* 02095048 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0209504C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095048 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0209504C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209504C */ _t6 = _t5 & 0x00000001u;
         /* 0209504C */ if (_t6) goto L_02095050; else goto L_020953A8;
   L_02095050: ; // 0x2095050
@@ -4308,11 +4308,11 @@ void Gambit_fn_02095030(CPUState* cpu) {
         /* 020950D0 */ _t17 = cpu->r[30] + 0x00000240u;
         /* 020950D0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t17);
         /* 020950D4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000018u, 0x0000001Fu);
-        /* 020950D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020950D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020950D8 */ cpu->r[4] = 0x00000002u;
         /* 020950DC */ _t18 = cpu->r[30] + 0x00000261u;
         /* 020950DC */ rbrew_write8(cpu->mem, _t18, (uint8_t)cpu->r[0]);
-        /* 020950E0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020950E0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020950E0 */ _t20 = _t19 & 0x00000001u;
         /* 020950E0 */ if (_t20) goto L_020950E8; else goto L_020950E4;
   L_020950E4: ; // 0x20950e4
@@ -4326,10 +4326,10 @@ void Gambit_fn_02095030(CPUState* cpu) {
         /* 020950F8 */ _t22 = cpu->r[30] + 0x00000260u;
         /* 020950F8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t22);
         /* 020950FC */ cpu->r[4] = 0x00000004u;
-        /* 02095100 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02095100 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02095104 */ _t23 = cpu->r[30] + 0x00000244u;
         /* 02095104 */ cpu->r[3] = rbrew_read32(cpu->mem, _t23);
-        /* 02095108 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095108 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095108 */ _t25 = _t24 & 0x00000001u;
         /* 02095108 */ if (_t25) goto L_02095110; else goto L_0209510C;
   L_0209510C: ; // 0x209510c
@@ -4368,8 +4368,8 @@ void Gambit_fn_02095030(CPUState* cpu) {
         /* 0209516C */ cpu->r[12] = rbrew_read32(cpu->mem, _t32);
         /* 02095170 */ _t33 = cpu->r[12] + 0x00000018u;
         /* 02095170 */ cpu->r[0] = rbrew_read8(cpu->mem, _t33);
-        /* 02095174 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02095178 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095174 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02095178 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095178 */ _t35 = _t34 & 0x00000001u;
         /* 02095178 */ if (_t35) goto L_0209517C; else goto L_02095210;
   L_0209517C: ; // 0x209517c
@@ -4422,8 +4422,8 @@ void Gambit_fn_02095030(CPUState* cpu) {
         /* 020951FC */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02095200 */ _t50 = cpu->r[1] + 0x00000014u;
         /* 02095200 */ cpu->r[0] = rbrew_read32(cpu->mem, _t50);
-        /* 02095204 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 02095208 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095204 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 02095208 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095208 */ _t52 = _t51 & 0x00000001u;
         /* 02095208 */ if (_t52) goto L_0209538C; else goto L_0209520C;
   L_0209520C: ; // 0x209520c
@@ -4434,15 +4434,15 @@ void Gambit_fn_02095030(CPUState* cpu) {
         /* 02095214 */ cpu->r[10] = rbrew_read32(cpu->mem, _t53);
         /* 02095218 */ _t54 = cpu->r[10] + 0x0000001Cu;
         /* 02095218 */ cpu->r[0] = rbrew_read8(cpu->mem, _t54);
-        /* 0209521C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02095220 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209521C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02095220 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095220 */ _t56 = _t55 & 0x00000001u;
         /* 02095220 */ if (_t56) goto L_02095230; else goto L_02095224;
   L_02095224: ; // 0x2095224
         /* 02095224 */ _t57 = cpu->r[10] + 0x00000020u;
         /* 02095224 */ cpu->r[0] = rbrew_read32(cpu->mem, _t57);
-        /* 02095228 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 0209522C */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 0209522C */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209522C */ _t59 = _t58 & 0x00000001u;
         /* 0209522C */ if (_t59) goto L_02095230; else goto L_020952C4;
   L_02095230: ; // 0x2095230
@@ -4495,8 +4495,8 @@ void Gambit_fn_02095030(CPUState* cpu) {
         /* 020952B0 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020952B4 */ _t74 = cpu->r[1] + 0x00000014u;
         /* 020952B4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t74);
-        /* 020952B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 020952BC */ _t75 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020952B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 020952BC */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020952BC */ _t76 = _t75 & 0x00000001u;
         /* 020952BC */ if (_t76) goto L_0209538C; else goto L_020952C0;
   L_020952C0: ; // 0x20952c0
@@ -4543,8 +4543,8 @@ void Gambit_fn_02095030(CPUState* cpu) {
         /* 0209532C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02095330 */ _t89 = cpu->r[1] + 0x00000014u;
         /* 02095330 */ cpu->r[0] = rbrew_read32(cpu->mem, _t89);
-        /* 02095334 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 02095338 */ _t90 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095334 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 02095338 */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095338 */ _t91 = _t90 & 0x00000001u;
         /* 02095338 */ if (_t91) goto L_0209538C; else goto L_0209533C;
   L_0209533C: ; // 0x209533c
@@ -4565,13 +4565,13 @@ void Gambit_fn_02095030(CPUState* cpu) {
         /* 02095360 */ _t96 = cpu->r[12] + 0x00000001u;
         /* 02095360 */ cpu->r[8] = rbrew_read8(cpu->mem, _t96);
         /* 02095360 */ cpu->r[12] = _t96;
-        /* 02095364 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[8]);
-        /* 02095368 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095364 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[8]));
+        /* 02095368 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095368 */ _t98 = _t97 & 0x00000001u;
         /* 02095368 */ if (_t98) goto L_0209536C; else goto L_0209539C;
   L_0209536C: ; // 0x209536c
-        /* 0209536C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[9]);
-        /* 02095370 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209536C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[9]));
+        /* 02095370 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095370 */ _t100 = _t99 & 0x00000001u;
         /* 02095370 */ if (_t100) goto L_0209538C; else goto L_02095374;
   L_02095374: ; // 0x2095374
@@ -4600,8 +4600,8 @@ void Gambit_fn_02095030(CPUState* cpu) {
         /* 020953A8 */ cpu->r[3] = cpu->r[30];
         /* 020953AC */ cpu->r[4] = 0x00000000u;
         /* 020953B0 */ Gambit_fn_027EDF00(cpu);
-        /* 020953B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020953B8 */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020953B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020953B8 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020953B8 */ _t106 = _t105 & 0x00000001u;
         /* 020953B8 */ if (_t106) goto L_020953C8; else goto L_020953BC;
   L_020953BC: ; // 0x20953bc
@@ -4630,7 +4630,7 @@ void Gambit_fn_020953E0(CPUState* cpu) {
         /* 020953E8 */ cpu->r[10] = 0x10010000u;
         /* 020953EC */ cpu->r[7] = cpu->r[7] + 0xFFFFE99Cu;
         /* 020953F0 */ cpu->r[10] = cpu->r[10] + 0xFFFFED64u;
-        /* 020953F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000002u);
+        /* 020953F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000002u));
         /* 020953F8 */ _t0 = cpu->r[1] + 0x00000004u;
         /* 020953F8 */ rbrew_write32(cpu->mem, _t0, cpu->r[0]);
         /* 020953FC */ cpu->r[0] = 0x10010000u;
@@ -4638,25 +4638,25 @@ void Gambit_fn_020953E0(CPUState* cpu) {
         /* 02095400 */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 02095400 */ cpu->r[1] = _t1;
         /* 02095404 */ cpu->r[0] = cpu->r[0] + 0xFFFFED6Cu;
-        /* 02095408 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095408 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095408 */ _t3 = _t2 & 0x00000001u;
         /* 02095408 */ if (_t3) goto L_02095414; else goto L_0209540C;
   L_0209540C: ; // 0x209540c
-        /* 0209540C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000003u);
-        /* 02095410 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209540C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000003u));
+        /* 02095410 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095410 */ _t5 = _t4 & 0x00000001u;
         /* 02095410 */ if (_t5) goto L_02095414; else goto L_02095458;
   L_02095414: ; // 0x2095414
-        /* 02095414 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 02095418 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095414 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 02095418 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095418 */ _t7 = _t6 & 0x00000001u;
         /* 02095418 */ if (_t7) goto L_02095420; else goto L_0209541C;
   L_0209541C: ; // 0x209541c
         /* 0209541C */ cpu->r[10] = cpu->r[0];
   L_02095420: ; // 0x2095420
-        /* 02095420 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000006u);
+        /* 02095420 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000006u));
         /* 02095424 */ cpu->r[11] = cpu->r[3] + 0x00000218u;
-        /* 02095428 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02095428 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02095428 */ _t9 = _t8 & 0x00000001u;
         /* 02095428 */ if (_t9) goto L_0209542C; else goto L_02095434;
   L_0209542C: ; // 0x209542c
@@ -4677,16 +4677,16 @@ void Gambit_fn_020953E0(CPUState* cpu) {
         /* 02095450 */ Gambit_fn_027EDCA8(cpu);
         /* 02095454 */ goto L_02095498;
   L_02095458: ; // 0x2095458
-        /* 02095458 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 0209545C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095458 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 0209545C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209545C */ _t15 = _t14 & 0x00000001u;
         /* 0209545C */ if (_t15) goto L_02095464; else goto L_02095460;
   L_02095460: ; // 0x2095460
         /* 02095460 */ cpu->r[0] = cpu->r[10];
   L_02095464: ; // 0x2095464
-        /* 02095464 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000006u);
+        /* 02095464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000006u));
         /* 02095468 */ cpu->r[12] = cpu->r[3] + 0x00000218u;
-        /* 0209546C */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209546C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209546C */ _t17 = _t16 & 0x00000001u;
         /* 0209546C */ if (_t17) goto L_02095470; else goto L_02095478;
   L_02095470: ; // 0x2095470
@@ -4722,25 +4722,25 @@ void Gambit_fn_02095400(CPUState* cpu) {
         /* 02095400 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 02095400 */ cpu->r[1] = _t0;
         /* 02095404 */ cpu->r[0] = cpu->r[0] + 0xFFFFED6Cu;
-        /* 02095408 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095408 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095408 */ _t2 = _t1 & 0x00000001u;
         /* 02095408 */ if (_t2) goto L_02095414; else goto L_0209540C;
   L_0209540C: ; // 0x209540c
-        /* 0209540C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000003u);
-        /* 02095410 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209540C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000003u));
+        /* 02095410 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095410 */ _t4 = _t3 & 0x00000001u;
         /* 02095410 */ if (_t4) goto L_02095414; else goto L_02095458;
   L_02095414: ; // 0x2095414
-        /* 02095414 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 02095418 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095414 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 02095418 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095418 */ _t6 = _t5 & 0x00000001u;
         /* 02095418 */ if (_t6) goto L_02095420; else goto L_0209541C;
   L_0209541C: ; // 0x209541c
         /* 0209541C */ cpu->r[10] = cpu->r[0];
   L_02095420: ; // 0x2095420
-        /* 02095420 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000006u);
+        /* 02095420 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000006u));
         /* 02095424 */ cpu->r[11] = cpu->r[3] + 0x00000218u;
-        /* 02095428 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02095428 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02095428 */ _t8 = _t7 & 0x00000001u;
         /* 02095428 */ if (_t8) goto L_0209542C; else goto L_02095434;
   L_0209542C: ; // 0x209542c
@@ -4761,16 +4761,16 @@ void Gambit_fn_02095400(CPUState* cpu) {
         /* 02095450 */ Gambit_fn_027EDCA8(cpu);
         /* 02095454 */ goto L_02095498;
   L_02095458: ; // 0x2095458
-        /* 02095458 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 0209545C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095458 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 0209545C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209545C */ _t14 = _t13 & 0x00000001u;
         /* 0209545C */ if (_t14) goto L_02095464; else goto L_02095460;
   L_02095460: ; // 0x2095460
         /* 02095460 */ cpu->r[0] = cpu->r[10];
   L_02095464: ; // 0x2095464
-        /* 02095464 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000006u);
+        /* 02095464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000006u));
         /* 02095468 */ cpu->r[12] = cpu->r[3] + 0x00000218u;
-        /* 0209546C */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209546C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209546C */ _t16 = _t15 & 0x00000001u;
         /* 0209546C */ if (_t16) goto L_02095470; else goto L_02095478;
   L_02095470: ; // 0x2095470
@@ -4816,15 +4816,15 @@ void Gambit_fn_020954AC(CPUState* cpu) {
         /* 020954C0 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 020954C4 */ _t5 = cpu->r[31] + 0x000001E4u;
         /* 020954C4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t5);
-        /* 020954C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020954CC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020954C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020954CC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020954CC */ _t7 = _t6 & 0x00000001u;
         /* 020954CC */ if (_t7) goto L_020954D0; else goto L_020954E4;
   L_020954D0: ; // 0x20954d0
         /* 020954D0 */ _t8 = cpu->r[31] + 0x00000254u;
         /* 020954D0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t8);
-        /* 020954D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020954D8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020954D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020954D8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020954D8 */ _t10 = _t9 & 0x00000001u;
         /* 020954D8 */ if (_t10) goto L_020954DC; else goto L_020954E4;
   L_020954DC: ; // 0x20954dc
@@ -4839,8 +4839,8 @@ void Gambit_fn_020954AC(CPUState* cpu) {
         /* 020954EC */ cpu->r[12] = rbrew_read32(cpu->mem, _t13);
         /* 020954F0 */ cpu->ctr = cpu->r[12];
         /* 020954F4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020954F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020954FC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020954F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020954FC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020954FC */ _t15 = _t14 & 0x00000001u;
         /* 020954FC */ if (_t15) goto L_02095518; else goto L_02095500;
   L_02095500: ; // 0x2095500
@@ -4857,8 +4857,8 @@ void Gambit_fn_020954AC(CPUState* cpu) {
         /* 02095520 */ Gambit_fn_020C0340(cpu);
         /* 02095524 */ _t17 = cpu->r[31] + 0x00000258u;
         /* 02095524 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t17);
-        /* 02095528 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[1]);
-        /* 0209552C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095528 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[1]));
+        /* 0209552C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209552C */ _t19 = _t18 & 0x00000001u;
         /* 0209552C */ if (_t19) goto L_02095534; else goto L_02095530;
   L_02095530: ; // 0x2095530
@@ -4867,10 +4867,10 @@ void Gambit_fn_020954AC(CPUState* cpu) {
         /* 02095534 */ cpu->r[11] = 0x10010000u;
         /* 02095538 */ _t20 = cpu->r[11] + 0xFFFFED74u;
         /* 02095538 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t20);
-        /* 0209553C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
+        /* 0209553C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
         /* 02095540 */ _t21 = cpu->r[31] + 0x00000218u;
         /* 02095540 */ cpu->r[3] = rbrew_read32(cpu->mem, _t21);
-        /* 02095544 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02095544 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02095544 */ _t23 = _t22 & 0x00000001u;
         /* 02095544 */ if (_t23) goto L_02095548; else goto L_0209556C;
   L_02095548: ; // 0x2095548
@@ -4883,8 +4883,8 @@ void Gambit_fn_020954AC(CPUState* cpu) {
         /* 02095554 */ cpu->ctr = cpu->r[10];
         /* 02095558 */ cpu->r[30] = cpu->r[31] + 0x00000218u;
         /* 0209555C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02095560 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02095564 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095560 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02095564 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095564 */ _t28 = _t27 & 0x00000001u;
         /* 02095564 */ if (_t28) goto L_020955CC; else goto L_02095568;
   L_02095568: ; // 0x2095568
@@ -4893,8 +4893,8 @@ void Gambit_fn_020954AC(CPUState* cpu) {
         /* 0209556C */ cpu->r[10] = 0x10010000u;
         /* 02095570 */ _t29 = cpu->r[10] + 0xFFFFED50u;
         /* 02095570 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t29);
-        /* 02095574 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[13]);
-        /* 02095578 */ _t30 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02095574 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[13]));
+        /* 02095578 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02095578 */ _t31 = _t30 & 0x00000001u;
         /* 02095578 */ if (_t31) goto L_0209557C; else goto L_02095580;
   L_0209557C: ; // 0x209557c
@@ -4909,8 +4909,8 @@ void Gambit_fn_020954AC(CPUState* cpu) {
         /* 0209558C */ cpu->ctr = cpu->r[10];
         /* 02095590 */ cpu->r[30] = cpu->r[31] + 0x00000218u;
         /* 02095594 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02095598 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209559C */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095598 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209559C */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209559C */ _t36 = _t35 & 0x00000001u;
         /* 0209559C */ if (_t36) goto L_020955CC; else goto L_020955A0;
   L_020955A0: ; // 0x20955a0
@@ -4918,8 +4918,8 @@ void Gambit_fn_020954AC(CPUState* cpu) {
         /* 020955A0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t37);
         /* 020955A4 */ _t38 = cpu->r[11] + 0x000001B5u;
         /* 020955A4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t38);
-        /* 020955A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020955AC */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020955A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020955AC */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020955AC */ _t40 = _t39 & 0x00000001u;
         /* 020955AC */ if (_t40) goto L_020955CC; else goto L_020955B0;
   L_020955B0: ; // 0x20955b0
@@ -4941,8 +4941,8 @@ void Gambit_fn_020954AC(CPUState* cpu) {
         /* 020955D4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t45);
         /* 020955D8 */ cpu->ctr = cpu->r[12];
         /* 020955DC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020955E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020955E4 */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020955E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020955E4 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020955E4 */ _t47 = _t46 & 0x00000001u;
         /* 020955E4 */ if (_t47) goto L_02095608; else goto L_020955E8;
   L_020955E8: ; // 0x20955e8
@@ -4965,8 +4965,8 @@ void Gambit_fn_020954AC(CPUState* cpu) {
         /* 02095610 */ cpu->r[11] = rbrew_read32(cpu->mem, _t52);
         /* 02095614 */ cpu->ctr = cpu->r[11];
         /* 02095618 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0209561C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02095620 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209561C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02095620 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095620 */ _t54 = _t53 & 0x00000001u;
         /* 02095620 */ if (_t54) goto L_02095680; else goto L_02095624;
   L_02095624: ; // 0x2095624
@@ -4995,15 +4995,15 @@ void Gambit_fn_020954AC(CPUState* cpu) {
         /* 0209566C */ cpu->r[3] = 0x101C0000u;
         /* 02095670 */ _t59 = cpu->r[3] + 0x00001D34u;
         /* 02095670 */ cpu->r[3] = rbrew_read32(cpu->mem, _t59);
-        /* 02095674 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02095678 */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095674 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02095678 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095678 */ _t61 = _t60 & 0x00000001u;
         /* 02095678 */ if (_t61) goto L_020956BC; else goto L_0209567C;
   L_0209567C: ; // 0x209567c
         /* 0209567C */ goto L_020956B4;
   L_02095680: ; // 0x2095680
-        /* 02095680 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02095684 */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095680 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02095684 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095684 */ _t63 = _t62 & 0x00000001u;
         /* 02095684 */ if (_t63) goto L_020956D8; else goto L_02095688;
   L_02095688: ; // 0x2095688
@@ -5017,8 +5017,8 @@ void Gambit_fn_020954AC(CPUState* cpu) {
         /* 020956A4 */ cpu->r[3] = 0x101C0000u;
         /* 020956A8 */ _t64 = cpu->r[3] + 0x00001D34u;
         /* 020956A8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t64);
-        /* 020956AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020956B0 */ _t65 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020956AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020956B0 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020956B0 */ _t66 = _t65 & 0x00000001u;
         /* 020956B0 */ if (_t66) goto L_020956BC; else goto L_020956B4;
   L_020956B4: ; // 0x20956b4
@@ -5043,8 +5043,8 @@ void Gambit_fn_020954AC(CPUState* cpu) {
         /* 020956E0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t71);
         /* 020956E4 */ cpu->ctr = cpu->r[0];
         /* 020956E8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020956EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020956F0 */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020956EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020956F0 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020956F0 */ _t73 = _t72 & 0x00000001u;
         /* 020956F0 */ if (_t73) goto L_02095708; else goto L_020956F4;
   L_020956F4: ; // 0x20956f4
@@ -5062,8 +5062,8 @@ void Gambit_fn_020954AC(CPUState* cpu) {
         /* 02095710 */ cpu->r[0] = rbrew_read32(cpu->mem, _t76);
         /* 02095714 */ cpu->ctr = cpu->r[0];
         /* 02095718 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0209571C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02095720 */ _t77 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209571C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02095720 */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095720 */ _t78 = _t77 & 0x00000001u;
         /* 02095720 */ if (_t78) goto L_02095738; else goto L_02095724;
   L_02095724: ; // 0x2095724
@@ -5081,8 +5081,8 @@ void Gambit_fn_020954AC(CPUState* cpu) {
         /* 02095740 */ cpu->r[11] = rbrew_read32(cpu->mem, _t81);
         /* 02095744 */ cpu->ctr = cpu->r[11];
         /* 02095748 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0209574C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02095750 */ _t82 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209574C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02095750 */ _t82 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095750 */ _t83 = _t82 & 0x00000001u;
         /* 02095750 */ if (_t83) goto L_02095768; else goto L_02095754;
   L_02095754: ; // 0x2095754
@@ -5122,8 +5122,8 @@ void Gambit_fn_02095788(CPUState* cpu) {
         /* 02095798 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 0209579C */ _t4 = cpu->r[31] + 0x000001E4u;
         /* 0209579C */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
-        /* 020957A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020957A4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020957A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020957A4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020957A4 */ _t6 = _t5 & 0x00000001u;
         /* 020957A4 */ if (_t6) goto L_020957A8; else goto L_0209582C;
   L_020957A8: ; // 0x20957a8
@@ -5174,8 +5174,8 @@ void Gambit_fn_02095788(CPUState* cpu) {
         /* 0209582C */ cpu->r[3] = cpu->r[31];
         /* 02095830 */ cpu->r[4] = 0x00000001u;
         /* 02095834 */ Gambit_fn_027EDF00(cpu);
-        /* 02095838 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209583C */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095838 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209583C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209583C */ _t17 = _t16 & 0x00000001u;
         /* 0209583C */ if (_t17) goto L_0209584C; else goto L_02095840;
   L_02095840: ; // 0x2095840
@@ -5215,15 +5215,15 @@ void Gambit_fn_02095868(CPUState* cpu) {
         /* 02095880 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
         /* 02095884 */ _t6 = cpu->r[31] + 0x000001E4u;
         /* 02095884 */ cpu->r[8] = rbrew_read32(cpu->mem, _t6);
-        /* 02095888 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 0209588C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095888 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 0209588C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209588C */ _t8 = _t7 & 0x00000001u;
         /* 0209588C */ if (_t8) goto L_02095890; else goto L_020958A4;
   L_02095890: ; // 0x2095890
         /* 02095890 */ _t9 = cpu->r[31] + 0x00000254u;
         /* 02095890 */ cpu->r[0] = rbrew_read8(cpu->mem, _t9);
-        /* 02095894 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02095898 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095894 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02095898 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095898 */ _t11 = _t10 & 0x00000001u;
         /* 02095898 */ if (_t11) goto L_0209589C; else goto L_020958A4;
   L_0209589C: ; // 0x209589c
@@ -5238,8 +5238,8 @@ void Gambit_fn_02095868(CPUState* cpu) {
         /* 020958AC */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 020958B0 */ cpu->ctr = cpu->r[11];
         /* 020958B4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020958B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020958BC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020958B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020958BC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020958BC */ _t16 = _t15 & 0x00000001u;
         /* 020958BC */ if (_t16) goto L_020958D8; else goto L_020958C0;
   L_020958C0: ; // 0x20958c0
@@ -5255,8 +5255,8 @@ void Gambit_fn_02095868(CPUState* cpu) {
         /* 020958E0 */ cpu->r[29] = cpu->r[30];
         /* 020958E4 */ goto L_020958F0;
   L_020958E8: ; // 0x20958e8
-        /* 020958E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000002u);
-        /* 020958EC */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020958E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000002u));
+        /* 020958EC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020958EC */ _t18 = _t17 & 0x00000001u;
         /* 020958EC */ if (_t18) goto L_020958F0; else goto L_020958F8;
   L_020958F0: ; // 0x20958f0
@@ -5273,8 +5273,8 @@ void Gambit_fn_02095868(CPUState* cpu) {
         /* 02095904 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 02095908 */ cpu->ctr = cpu->r[0];
         /* 0209590C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02095910 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02095914 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02095914 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095914 */ _t23 = _t22 & 0x00000001u;
         /* 02095914 */ if (_t23) goto L_02095920; else goto L_02095918;
   L_02095918: ; // 0x2095918
@@ -5282,9 +5282,9 @@ void Gambit_fn_02095868(CPUState* cpu) {
         /* 0209591C */ Gambit_fn_0209458C(cpu);
   L_02095920: ; // 0x2095920
         /* 02095920 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
-        /* 02095924 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000002u);
+        /* 02095924 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000002u));
         /* 02095928 */ cpu->r[29] = cpu->r[29] + 0x00000004u;
-        /* 0209592C */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209592C */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209592C */ _t25 = _t24 & 0x00000001u;
         /* 0209592C */ if (_t25) goto L_020958E8; else goto L_02095930;
   L_02095930: ; // 0x2095930
@@ -5296,8 +5296,8 @@ void Gambit_fn_02095868(CPUState* cpu) {
         /* 02095938 */ cpu->r[0] = rbrew_read32(cpu->mem, _t28);
         /* 0209593C */ cpu->ctr = cpu->r[0];
         /* 02095940 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02095944 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02095948 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095944 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02095948 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095948 */ _t30 = _t29 & 0x00000001u;
         /* 02095948 */ if (_t30) goto L_02095958; else goto L_0209594C;
   L_0209594C: ; // 0x209594c
@@ -5313,8 +5313,8 @@ void Gambit_fn_02095868(CPUState* cpu) {
         /* 02095960 */ cpu->r[10] = rbrew_read32(cpu->mem, _t33);
         /* 02095964 */ cpu->ctr = cpu->r[10];
         /* 02095968 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0209596C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02095970 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209596C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02095970 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095970 */ _t35 = _t34 & 0x00000001u;
         /* 02095970 */ if (_t35) goto L_02095980; else goto L_02095974;
   L_02095974: ; // 0x2095974
@@ -5352,8 +5352,8 @@ void Gambit_fn_020959A0(CPUState* cpu) {
         /* 020959B0 */ cpu->r[31] = cpu->r[3];
         /* 020959B4 */ _t2 = cpu->r[31] + 0x000001E4u;
         /* 020959B4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t2);
-        /* 020959B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020959BC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020959B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020959BC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020959BC */ _t4 = _t3 & 0x00000001u;
         /* 020959BC */ if (_t4) goto L_020959C0; else goto L_020959F0;
   L_020959C0: ; // 0x20959c0
@@ -5376,8 +5376,8 @@ void Gambit_fn_020959A0(CPUState* cpu) {
         /* 020959F0 */ cpu->r[3] = cpu->r[31];
         /* 020959F4 */ cpu->r[4] = 0x00000001u;
         /* 020959F8 */ Gambit_fn_027EDF00(cpu);
-        /* 020959FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02095A00 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020959FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02095A00 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095A00 */ _t9 = _t8 & 0x00000001u;
         /* 02095A00 */ if (_t9) goto L_02095A9C; else goto L_02095A04;
   L_02095A04: ; // 0x2095a04
@@ -5386,8 +5386,8 @@ void Gambit_fn_020959A0(CPUState* cpu) {
         /* 02095A0C */ cpu->r[29] = cpu->r[28];
         /* 02095A10 */ goto L_02095A1C;
   L_02095A14: ; // 0x2095a14
-        /* 02095A14 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000002u);
-        /* 02095A18 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02095A14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000002u));
+        /* 02095A18 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02095A18 */ _t11 = _t10 & 0x00000001u;
         /* 02095A18 */ if (_t11) goto L_02095A1C; else goto L_02095A28;
   L_02095A1C: ; // 0x2095a1c
@@ -5405,13 +5405,13 @@ void Gambit_fn_020959A0(CPUState* cpu) {
         /* 02095A34 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 02095A38 */ cpu->ctr = cpu->r[0];
         /* 02095A3C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02095A40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02095A44 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095A40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02095A44 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095A44 */ _t16 = _t15 & 0x00000001u;
         /* 02095A44 */ if (_t16) goto L_02095A7C; else goto L_02095A48;
   L_02095A48: ; // 0x2095a48
-        /* 02095A48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000002u);
-        /* 02095A4C */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02095A48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000002u));
+        /* 02095A4C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02095A4C */ _t18 = _t17 & 0x00000001u;
         /* 02095A4C */ if (_t18) goto L_02095A50; else goto L_02095A68;
   L_02095A50: ; // 0x2095a50
@@ -5436,9 +5436,9 @@ void Gambit_fn_020959A0(CPUState* cpu) {
   L_02095A7C: ; // 0x2095a7c
         /* 02095A7C */ cpu->r[28] = cpu->r[28] + 0x00000001u;
         /* 02095A80 */ cpu->r[27] = cpu->r[27] + 0x00000004u;
-        /* 02095A84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000002u);
+        /* 02095A84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000002u));
         /* 02095A88 */ cpu->r[29] = cpu->r[29] + 0x00000004u;
-        /* 02095A8C */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02095A8C */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02095A8C */ _t26 = _t25 & 0x00000001u;
         /* 02095A8C */ if (_t26) goto L_02095A14; else goto L_02095A90;
   L_02095A90: ; // 0x2095a90
@@ -5471,8 +5471,8 @@ void Gambit_fn_02095AB4(CPUState* cpu) {
         /* 02095AC4 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 02095AC8 */ _t4 = cpu->r[31] + 0x000001E4u;
         /* 02095AC8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t4);
-        /* 02095ACC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02095AD0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095ACC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02095AD0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095AD0 */ _t6 = _t5 & 0x00000001u;
         /* 02095AD0 */ if (_t6) goto L_02095AD4; else goto L_02095B98;
   L_02095AD4: ; // 0x2095ad4
@@ -5530,10 +5530,10 @@ void Gambit_fn_02095AB4(CPUState* cpu) {
         /* 02095B70 */ _t18 = cpu->r[31] + 0x00000261u;
         /* 02095B70 */ cpu->r[0] = rbrew_read8(cpu->mem, _t18);
         /* 02095B74 */ cpu->r[4] = 0x00000002u;
-        /* 02095B78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02095B78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02095B7C */ _t19 = cpu->r[31] + 0x00000248u;
         /* 02095B7C */ cpu->r[3] = rbrew_read32(cpu->mem, _t19);
-        /* 02095B80 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095B80 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095B80 */ _t21 = _t20 & 0x00000001u;
         /* 02095B80 */ if (_t21) goto L_02095B88; else goto L_02095B84;
   L_02095B84: ; // 0x2095b84
@@ -5548,8 +5548,8 @@ void Gambit_fn_02095AB4(CPUState* cpu) {
         /* 02095B98 */ cpu->r[3] = cpu->r[31];
         /* 02095B9C */ cpu->r[4] = 0x00000001u;
         /* 02095BA0 */ Gambit_fn_027EDF00(cpu);
-        /* 02095BA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02095BA8 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095BA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02095BA8 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095BA8 */ _t24 = _t23 & 0x00000001u;
         /* 02095BA8 */ if (_t24) goto L_02095BB8; else goto L_02095BAC;
   L_02095BAC: ; // 0x2095bac
@@ -5589,15 +5589,15 @@ void Gambit_fn_02095BD4(CPUState* cpu) {
         /* 02095BEC */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
         /* 02095BF0 */ _t6 = cpu->r[31] + 0x000001E4u;
         /* 02095BF0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t6);
-        /* 02095BF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 02095BF8 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095BF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 02095BF8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095BF8 */ _t8 = _t7 & 0x00000001u;
         /* 02095BF8 */ if (_t8) goto L_02095BFC; else goto L_02095C10;
   L_02095BFC: ; // 0x2095bfc
         /* 02095BFC */ _t9 = cpu->r[31] + 0x00000254u;
         /* 02095BFC */ cpu->r[8] = rbrew_read8(cpu->mem, _t9);
-        /* 02095C00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02095C04 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095C00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02095C04 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095C04 */ _t11 = _t10 & 0x00000001u;
         /* 02095C04 */ if (_t11) goto L_02095C08; else goto L_02095C10;
   L_02095C08: ; // 0x2095c08
@@ -5612,8 +5612,8 @@ void Gambit_fn_02095BD4(CPUState* cpu) {
         /* 02095C18 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 02095C1C */ cpu->ctr = cpu->r[0];
         /* 02095C20 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02095C24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02095C28 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095C24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02095C28 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095C28 */ _t16 = _t15 & 0x00000001u;
         /* 02095C28 */ if (_t16) goto L_02095C44; else goto L_02095C2C;
   L_02095C2C: ; // 0x2095c2c
@@ -5629,8 +5629,8 @@ void Gambit_fn_02095BD4(CPUState* cpu) {
         /* 02095C4C */ cpu->r[29] = cpu->r[30];
         /* 02095C50 */ goto L_02095C5C;
   L_02095C54: ; // 0x2095c54
-        /* 02095C54 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000002u);
-        /* 02095C58 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02095C54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000002u));
+        /* 02095C58 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02095C58 */ _t18 = _t17 & 0x00000001u;
         /* 02095C58 */ if (_t18) goto L_02095C5C; else goto L_02095C64;
   L_02095C5C: ; // 0x2095c5c
@@ -5647,8 +5647,8 @@ void Gambit_fn_02095BD4(CPUState* cpu) {
         /* 02095C70 */ cpu->r[5] = rbrew_read32(cpu->mem, _t21);
         /* 02095C74 */ cpu->ctr = cpu->r[5];
         /* 02095C78 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02095C7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02095C80 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095C7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02095C80 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095C80 */ _t23 = _t22 & 0x00000001u;
         /* 02095C80 */ if (_t23) goto L_02095C8C; else goto L_02095C84;
   L_02095C84: ; // 0x2095c84
@@ -5656,16 +5656,16 @@ void Gambit_fn_02095BD4(CPUState* cpu) {
         /* 02095C88 */ Gambit_fn_0209458C(cpu);
   L_02095C8C: ; // 0x2095c8c
         /* 02095C8C */ cpu->r[28] = cpu->r[28] + 0x00000001u;
-        /* 02095C90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000002u);
+        /* 02095C90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000002u));
         /* 02095C94 */ cpu->r[29] = cpu->r[29] + 0x00000004u;
-        /* 02095C98 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02095C98 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02095C98 */ _t25 = _t24 & 0x00000001u;
         /* 02095C98 */ if (_t25) goto L_02095C54; else goto L_02095C9C;
   L_02095C9C: ; // 0x2095c9c
         /* 02095C9C */ _t26 = cpu->r[31] + 0x00000261u;
         /* 02095C9C */ cpu->r[7] = rbrew_read8(cpu->mem, _t26);
-        /* 02095CA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 02095CA4 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095CA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 02095CA4 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095CA4 */ _t28 = _t27 & 0x00000001u;
         /* 02095CA4 */ if (_t28) goto L_02095CA8; else goto L_02095CD0;
   L_02095CA8: ; // 0x2095ca8
@@ -5677,15 +5677,15 @@ void Gambit_fn_02095BD4(CPUState* cpu) {
         /* 02095CB0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t31);
         /* 02095CB4 */ cpu->ctr = cpu->r[0];
         /* 02095CB8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02095CBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02095CC0 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095CBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02095CC0 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095CC0 */ _t33 = _t32 & 0x00000001u;
         /* 02095CC0 */ if (_t33) goto L_02095CC4; else goto L_02095CEC;
   L_02095CC4: ; // 0x2095cc4
         /* 02095CC4 */ _t34 = cpu->r[31] + 0x00000261u;
         /* 02095CC4 */ cpu->r[10] = rbrew_read8(cpu->mem, _t34);
-        /* 02095CC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02095CCC */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095CC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02095CCC */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095CCC */ _t36 = _t35 & 0x00000001u;
         /* 02095CCC */ if (_t36) goto L_02095E30; else goto L_02095CD0;
   L_02095CD0: ; // 0x2095cd0
@@ -5697,8 +5697,8 @@ void Gambit_fn_02095BD4(CPUState* cpu) {
         /* 02095CD8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t39);
         /* 02095CDC */ cpu->ctr = cpu->r[0];
         /* 02095CE0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02095CE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02095CE8 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095CE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02095CE8 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095CE8 */ _t41 = _t40 & 0x00000001u;
         /* 02095CE8 */ if (_t41) goto L_02095DFC; else goto L_02095CEC;
   L_02095CEC: ; // 0x2095cec
@@ -5758,8 +5758,8 @@ void Gambit_fn_02095BD4(CPUState* cpu) {
         /* 02095D84 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02095D88 */ _t57 = cpu->r[1] + 0x00000010u;
         /* 02095D88 */ cpu->r[12] = rbrew_read32(cpu->mem, _t57);
-        /* 02095D8C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[12]);
-        /* 02095D90 */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095D8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[12]));
+        /* 02095D90 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095D90 */ _t59 = _t58 & 0x00000001u;
         /* 02095D90 */ if (_t59) goto L_02095DE4; else goto L_02095D94;
   L_02095D94: ; // 0x2095d94
@@ -5780,13 +5780,13 @@ void Gambit_fn_02095BD4(CPUState* cpu) {
         /* 02095DB8 */ _t64 = cpu->r[4] + 0x00000001u;
         /* 02095DB8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t64);
         /* 02095DB8 */ cpu->r[4] = _t64;
-        /* 02095DBC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[0]);
-        /* 02095DC0 */ _t65 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095DBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[0]));
+        /* 02095DC0 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095DC0 */ _t66 = _t65 & 0x00000001u;
         /* 02095DC0 */ if (_t66) goto L_02095DC4; else goto L_02095DF0;
   L_02095DC4: ; // 0x2095dc4
-        /* 02095DC4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[12]);
-        /* 02095DC8 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095DC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[12]));
+        /* 02095DC8 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095DC8 */ _t68 = _t67 & 0x00000001u;
         /* 02095DC8 */ if (_t68) goto L_02095DE4; else goto L_02095DCC;
   L_02095DCC: ; // 0x2095dcc
@@ -5812,8 +5812,8 @@ void Gambit_fn_02095BD4(CPUState* cpu) {
   L_02095DFC: ; // 0x2095dfc
         /* 02095DFC */ _t72 = cpu->r[31] + 0x00000261u;
         /* 02095DFC */ cpu->r[4] = rbrew_read8(cpu->mem, _t72);
-        /* 02095E00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 02095E04 */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095E00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 02095E04 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095E04 */ _t74 = _t73 & 0x00000001u;
         /* 02095E04 */ if (_t74) goto L_02095E30; else goto L_02095E08;
   L_02095E08: ; // 0x2095e08
@@ -5825,15 +5825,15 @@ void Gambit_fn_02095BD4(CPUState* cpu) {
         /* 02095E10 */ cpu->r[6] = rbrew_read32(cpu->mem, _t77);
         /* 02095E14 */ cpu->ctr = cpu->r[6];
         /* 02095E18 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02095E1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02095E20 */ _t78 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095E1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02095E20 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095E20 */ _t79 = _t78 & 0x00000001u;
         /* 02095E20 */ if (_t79) goto L_02095E24; else goto L_02095E4C;
   L_02095E24: ; // 0x2095e24
         /* 02095E24 */ _t80 = cpu->r[31] + 0x00000261u;
         /* 02095E24 */ cpu->r[7] = rbrew_read8(cpu->mem, _t80);
-        /* 02095E28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 02095E2C */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095E28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 02095E2C */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095E2C */ _t82 = _t81 & 0x00000001u;
         /* 02095E2C */ if (_t82) goto L_02095E30; else goto L_02095E58;
   L_02095E30: ; // 0x2095e30
@@ -5845,8 +5845,8 @@ void Gambit_fn_02095BD4(CPUState* cpu) {
         /* 02095E38 */ cpu->r[9] = rbrew_read32(cpu->mem, _t85);
         /* 02095E3C */ cpu->ctr = cpu->r[9];
         /* 02095E40 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02095E44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02095E48 */ _t86 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095E44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02095E48 */ _t86 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095E48 */ _t87 = _t86 & 0x00000001u;
         /* 02095E48 */ if (_t87) goto L_02095E58; else goto L_02095E4C;
   L_02095E4C: ; // 0x2095e4c
@@ -5884,8 +5884,8 @@ void Gambit_fn_02095E78(CPUState* cpu) {
         /* 02095E88 */ cpu->r[31] = cpu->r[3];
         /* 02095E8C */ _t2 = cpu->r[31] + 0x000001E4u;
         /* 02095E8C */ cpu->r[10] = rbrew_read32(cpu->mem, _t2);
-        /* 02095E90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02095E94 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095E90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02095E94 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095E94 */ _t4 = _t3 & 0x00000001u;
         /* 02095E94 */ if (_t4) goto L_02095E98; else goto L_02095EF0;
   L_02095E98: ; // 0x2095e98
@@ -5907,10 +5907,10 @@ void Gambit_fn_02095E78(CPUState* cpu) {
         /* 02095EC8 */ _t8 = cpu->r[31] + 0x00000261u;
         /* 02095EC8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t8);
         /* 02095ECC */ cpu->r[4] = 0x00000002u;
-        /* 02095ED0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02095ED0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02095ED4 */ _t9 = cpu->r[31] + 0x00000240u;
         /* 02095ED4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t9);
-        /* 02095ED8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095ED8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095ED8 */ _t11 = _t10 & 0x00000001u;
         /* 02095ED8 */ if (_t11) goto L_02095EE0; else goto L_02095EDC;
   L_02095EDC: ; // 0x2095edc
@@ -5925,8 +5925,8 @@ void Gambit_fn_02095E78(CPUState* cpu) {
         /* 02095EF0 */ cpu->r[3] = cpu->r[31];
         /* 02095EF4 */ cpu->r[4] = 0x00000001u;
         /* 02095EF8 */ Gambit_fn_027EDF00(cpu);
-        /* 02095EFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02095F00 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095EFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02095F00 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095F00 */ _t14 = _t13 & 0x00000001u;
         /* 02095F00 */ if (_t14) goto L_02095F9C; else goto L_02095F04;
   L_02095F04: ; // 0x2095f04
@@ -5935,8 +5935,8 @@ void Gambit_fn_02095E78(CPUState* cpu) {
         /* 02095F0C */ cpu->r[29] = cpu->r[27];
         /* 02095F10 */ goto L_02095F1C;
   L_02095F14: ; // 0x2095f14
-        /* 02095F14 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], 0x00000002u);
-        /* 02095F18 */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02095F14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], 0x00000002u));
+        /* 02095F18 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02095F18 */ _t16 = _t15 & 0x00000001u;
         /* 02095F18 */ if (_t16) goto L_02095F1C; else goto L_02095F28;
   L_02095F1C: ; // 0x2095f1c
@@ -5954,13 +5954,13 @@ void Gambit_fn_02095E78(CPUState* cpu) {
         /* 02095F34 */ cpu->r[8] = rbrew_read32(cpu->mem, _t19);
         /* 02095F38 */ cpu->ctr = cpu->r[8];
         /* 02095F3C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02095F40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02095F44 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095F40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02095F44 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095F44 */ _t21 = _t20 & 0x00000001u;
         /* 02095F44 */ if (_t21) goto L_02095F7C; else goto L_02095F48;
   L_02095F48: ; // 0x2095f48
-        /* 02095F48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], 0x00000002u);
-        /* 02095F4C */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02095F48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], 0x00000002u));
+        /* 02095F4C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02095F4C */ _t23 = _t22 & 0x00000001u;
         /* 02095F4C */ if (_t23) goto L_02095F50; else goto L_02095F68;
   L_02095F50: ; // 0x2095f50
@@ -5985,9 +5985,9 @@ void Gambit_fn_02095E78(CPUState* cpu) {
   L_02095F7C: ; // 0x2095f7c
         /* 02095F7C */ cpu->r[27] = cpu->r[27] + 0x00000001u;
         /* 02095F80 */ cpu->r[28] = cpu->r[28] + 0x00000004u;
-        /* 02095F84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000002u);
+        /* 02095F84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000002u));
         /* 02095F88 */ cpu->r[29] = cpu->r[29] + 0x00000004u;
-        /* 02095F8C */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02095F8C */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02095F8C */ _t31 = _t30 & 0x00000001u;
         /* 02095F8C */ if (_t31) goto L_02095F14; else goto L_02095F90;
   L_02095F90: ; // 0x2095f90
@@ -6020,8 +6020,8 @@ void Gambit_fn_02095FB4(CPUState* cpu) {
         /* 02095FC4 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 02095FC8 */ _t4 = cpu->r[31] + 0x000001E4u;
         /* 02095FC8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t4);
-        /* 02095FCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02095FD0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02095FCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02095FD0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02095FD0 */ _t6 = _t5 & 0x00000001u;
         /* 02095FD0 */ if (_t6) goto L_02095FD4; else goto L_02096098;
   L_02095FD4: ; // 0x2095fd4
@@ -6079,10 +6079,10 @@ void Gambit_fn_02095FB4(CPUState* cpu) {
         /* 02096070 */ _t18 = cpu->r[31] + 0x00000260u;
         /* 02096070 */ cpu->r[0] = rbrew_read8(cpu->mem, _t18);
         /* 02096074 */ cpu->r[4] = 0x00000004u;
-        /* 02096078 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02096078 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0209607C */ _t19 = cpu->r[31] + 0x00000248u;
         /* 0209607C */ cpu->r[3] = rbrew_read32(cpu->mem, _t19);
-        /* 02096080 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096080 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096080 */ _t21 = _t20 & 0x00000001u;
         /* 02096080 */ if (_t21) goto L_02096088; else goto L_02096084;
   L_02096084: ; // 0x2096084
@@ -6097,8 +6097,8 @@ void Gambit_fn_02095FB4(CPUState* cpu) {
         /* 02096098 */ cpu->r[3] = cpu->r[31];
         /* 0209609C */ cpu->r[4] = 0x00000001u;
         /* 020960A0 */ Gambit_fn_027EDF00(cpu);
-        /* 020960A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020960A8 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020960A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020960A8 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020960A8 */ _t24 = _t23 & 0x00000001u;
         /* 020960A8 */ if (_t24) goto L_020960B8; else goto L_020960AC;
   L_020960AC: ; // 0x20960ac
@@ -6138,15 +6138,15 @@ void Gambit_fn_020960D4(CPUState* cpu) {
         /* 020960EC */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
         /* 020960F0 */ _t6 = cpu->r[30] + 0x000001E4u;
         /* 020960F0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 020960F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020960F8 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020960F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020960F8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020960F8 */ _t8 = _t7 & 0x00000001u;
         /* 020960F8 */ if (_t8) goto L_020960FC; else goto L_02096110;
   L_020960FC: ; // 0x20960fc
         /* 020960FC */ _t9 = cpu->r[30] + 0x00000254u;
         /* 020960FC */ cpu->r[0] = rbrew_read8(cpu->mem, _t9);
-        /* 02096100 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02096104 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096100 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02096104 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096104 */ _t11 = _t10 & 0x00000001u;
         /* 02096104 */ if (_t11) goto L_02096108; else goto L_02096110;
   L_02096108: ; // 0x2096108
@@ -6161,8 +6161,8 @@ void Gambit_fn_020960D4(CPUState* cpu) {
         /* 02096118 */ cpu->r[6] = rbrew_read32(cpu->mem, _t14);
         /* 0209611C */ cpu->ctr = cpu->r[6];
         /* 02096120 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02096124 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02096128 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096124 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02096128 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096128 */ _t16 = _t15 & 0x00000001u;
         /* 02096128 */ if (_t16) goto L_02096144; else goto L_0209612C;
   L_0209612C: ; // 0x209612c
@@ -6178,8 +6178,8 @@ void Gambit_fn_020960D4(CPUState* cpu) {
         /* 0209614C */ cpu->r[31] = cpu->r[29];
         /* 02096150 */ goto L_0209615C;
   L_02096154: ; // 0x2096154
-        /* 02096154 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000002u);
-        /* 02096158 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02096154 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000002u));
+        /* 02096158 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02096158 */ _t18 = _t17 & 0x00000001u;
         /* 02096158 */ if (_t18) goto L_0209615C; else goto L_02096164;
   L_0209615C: ; // 0x209615c
@@ -6196,8 +6196,8 @@ void Gambit_fn_020960D4(CPUState* cpu) {
         /* 02096170 */ cpu->r[9] = rbrew_read32(cpu->mem, _t21);
         /* 02096174 */ cpu->ctr = cpu->r[9];
         /* 02096178 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0209617C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02096180 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209617C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02096180 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096180 */ _t23 = _t22 & 0x00000001u;
         /* 02096180 */ if (_t23) goto L_0209618C; else goto L_02096184;
   L_02096184: ; // 0x2096184
@@ -6205,17 +6205,17 @@ void Gambit_fn_020960D4(CPUState* cpu) {
         /* 02096188 */ Gambit_fn_0209458C(cpu);
   L_0209618C: ; // 0x209618c
         /* 0209618C */ cpu->r[28] = cpu->r[28] + 0x00000001u;
-        /* 02096190 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000002u);
+        /* 02096190 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000002u));
         /* 02096194 */ cpu->r[31] = cpu->r[31] + 0x00000004u;
-        /* 02096198 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02096198 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02096198 */ _t25 = _t24 & 0x00000001u;
         /* 02096198 */ if (_t25) goto L_02096154; else goto L_0209619C;
   L_0209619C: ; // 0x209619c
         /* 0209619C */ _t26 = cpu->r[30] + 0x00000260u;
         /* 0209619C */ cpu->r[0] = rbrew_read8(cpu->mem, _t26);
-        /* 020961A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020961A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020961A4 */ cpu->r[31] = cpu->r[29] + 0x00000004u;
-        /* 020961A8 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020961A8 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020961A8 */ _t28 = _t27 & 0x00000001u;
         /* 020961A8 */ if (_t28) goto L_020961AC; else goto L_020961D4;
   L_020961AC: ; // 0x20961ac
@@ -6227,15 +6227,15 @@ void Gambit_fn_020960D4(CPUState* cpu) {
         /* 020961B4 */ cpu->r[4] = rbrew_read32(cpu->mem, _t31);
         /* 020961B8 */ cpu->ctr = cpu->r[4];
         /* 020961BC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020961C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020961C4 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020961C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020961C4 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020961C4 */ _t33 = _t32 & 0x00000001u;
         /* 020961C4 */ if (_t33) goto L_020961C8; else goto L_020961F0;
   L_020961C8: ; // 0x20961c8
         /* 020961C8 */ _t34 = cpu->r[30] + 0x00000260u;
         /* 020961C8 */ cpu->r[5] = rbrew_read8(cpu->mem, _t34);
-        /* 020961CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 020961D0 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020961CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 020961D0 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020961D0 */ _t36 = _t35 & 0x00000001u;
         /* 020961D0 */ if (_t36) goto L_02096240; else goto L_020961D4;
   L_020961D4: ; // 0x20961d4
@@ -6247,8 +6247,8 @@ void Gambit_fn_020960D4(CPUState* cpu) {
         /* 020961DC */ cpu->r[7] = rbrew_read32(cpu->mem, _t39);
         /* 020961E0 */ cpu->ctr = cpu->r[7];
         /* 020961E4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020961E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020961EC */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020961E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020961EC */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020961EC */ _t41 = _t40 & 0x00000001u;
         /* 020961EC */ if (_t41) goto L_02096240; else goto L_020961F0;
   L_020961F0: ; // 0x20961f0
@@ -6287,8 +6287,8 @@ void Gambit_fn_020960D4(CPUState* cpu) {
         /* 02096248 */ cpu->r[0] = rbrew_read32(cpu->mem, _t50);
         /* 0209624C */ cpu->ctr = cpu->r[0];
         /* 02096250 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02096254 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02096258 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096254 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02096258 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096258 */ _t52 = _t51 & 0x00000001u;
         /* 02096258 */ if (_t52) goto L_0209625C; else goto L_02096278;
   L_0209625C: ; // 0x209625c
@@ -6300,8 +6300,8 @@ void Gambit_fn_020960D4(CPUState* cpu) {
         /* 02096264 */ cpu->r[12] = rbrew_read32(cpu->mem, _t55);
         /* 02096268 */ cpu->ctr = cpu->r[12];
         /* 0209626C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02096270 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02096274 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096270 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02096274 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096274 */ _t57 = _t56 & 0x00000001u;
         /* 02096274 */ if (_t57) goto L_02096284; else goto L_02096278;
   L_02096278: ; // 0x2096278
@@ -6339,8 +6339,8 @@ void Gambit_fn_020962A4(CPUState* cpu) {
         /* 020962B4 */ cpu->r[31] = cpu->r[3];
         /* 020962B8 */ _t2 = cpu->r[31] + 0x000001E4u;
         /* 020962B8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t2);
-        /* 020962BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020962C0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020962BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020962C0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020962C0 */ _t4 = _t3 & 0x00000001u;
         /* 020962C0 */ if (_t4) goto L_020962C4; else goto L_0209631C;
   L_020962C4: ; // 0x20962c4
@@ -6362,10 +6362,10 @@ void Gambit_fn_020962A4(CPUState* cpu) {
         /* 020962F4 */ _t8 = cpu->r[31] + 0x00000260u;
         /* 020962F4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t8);
         /* 020962F8 */ cpu->r[4] = 0x00000004u;
-        /* 020962FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020962FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02096300 */ _t9 = cpu->r[31] + 0x00000244u;
         /* 02096300 */ cpu->r[3] = rbrew_read32(cpu->mem, _t9);
-        /* 02096304 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096304 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096304 */ _t11 = _t10 & 0x00000001u;
         /* 02096304 */ if (_t11) goto L_0209630C; else goto L_02096308;
   L_02096308: ; // 0x2096308
@@ -6380,8 +6380,8 @@ void Gambit_fn_020962A4(CPUState* cpu) {
         /* 0209631C */ cpu->r[3] = cpu->r[31];
         /* 02096320 */ cpu->r[4] = 0x00000001u;
         /* 02096324 */ Gambit_fn_027EDF00(cpu);
-        /* 02096328 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209632C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096328 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209632C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209632C */ _t14 = _t13 & 0x00000001u;
         /* 0209632C */ if (_t14) goto L_020963C8; else goto L_02096330;
   L_02096330: ; // 0x2096330
@@ -6390,8 +6390,8 @@ void Gambit_fn_020962A4(CPUState* cpu) {
         /* 02096338 */ cpu->r[29] = cpu->r[27];
         /* 0209633C */ goto L_02096348;
   L_02096340: ; // 0x2096340
-        /* 02096340 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], 0x00000002u);
-        /* 02096344 */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02096340 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], 0x00000002u));
+        /* 02096344 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02096344 */ _t16 = _t15 & 0x00000001u;
         /* 02096344 */ if (_t16) goto L_02096348; else goto L_02096354;
   L_02096348: ; // 0x2096348
@@ -6409,13 +6409,13 @@ void Gambit_fn_020962A4(CPUState* cpu) {
         /* 02096360 */ cpu->r[8] = rbrew_read32(cpu->mem, _t19);
         /* 02096364 */ cpu->ctr = cpu->r[8];
         /* 02096368 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0209636C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02096370 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209636C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02096370 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096370 */ _t21 = _t20 & 0x00000001u;
         /* 02096370 */ if (_t21) goto L_020963A8; else goto L_02096374;
   L_02096374: ; // 0x2096374
-        /* 02096374 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], 0x00000002u);
-        /* 02096378 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02096374 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], 0x00000002u));
+        /* 02096378 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02096378 */ _t23 = _t22 & 0x00000001u;
         /* 02096378 */ if (_t23) goto L_0209637C; else goto L_02096394;
   L_0209637C: ; // 0x209637c
@@ -6440,9 +6440,9 @@ void Gambit_fn_020962A4(CPUState* cpu) {
   L_020963A8: ; // 0x20963a8
         /* 020963A8 */ cpu->r[27] = cpu->r[27] + 0x00000001u;
         /* 020963AC */ cpu->r[28] = cpu->r[28] + 0x00000004u;
-        /* 020963B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000002u);
+        /* 020963B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000002u));
         /* 020963B4 */ cpu->r[29] = cpu->r[29] + 0x00000004u;
-        /* 020963B8 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020963B8 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020963B8 */ _t31 = _t30 & 0x00000001u;
         /* 020963B8 */ if (_t31) goto L_02096340; else goto L_020963BC;
   L_020963BC: ; // 0x20963bc
@@ -6473,8 +6473,8 @@ void Gambit_fn_020963E0(CPUState* cpu) {
         /* 020963EC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020963F0 */ _t3 = cpu->r[31] + 0x000001E4u;
         /* 020963F0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t3);
-        /* 020963F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 020963F8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020963F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 020963F8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020963F8 */ _t5 = _t4 & 0x00000001u;
         /* 020963F8 */ if (_t5) goto L_020963FC; else goto L_0209642C;
   L_020963FC: ; // 0x20963fc
@@ -6497,8 +6497,8 @@ void Gambit_fn_020963E0(CPUState* cpu) {
         /* 0209642C */ cpu->r[3] = cpu->r[31];
         /* 02096430 */ cpu->r[4] = 0x00000000u;
         /* 02096434 */ Gambit_fn_027EDF00(cpu);
-        /* 02096438 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209643C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096438 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209643C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209643C */ _t10 = _t9 & 0x00000001u;
         /* 0209643C */ if (_t10) goto L_02096454; else goto L_02096440;
   L_02096440: ; // 0x2096440
@@ -6631,15 +6631,15 @@ void Gambit_fn_020964D4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020964D4: ; // 0x20964d4
-        /* 020964D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020964D8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020964D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020964D8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020964D8 */ _t1 = _t0 & 0x00000001u;
         /* 020964D8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020964D8 */ goto L_020964DC;
   L_020964DC: ; // 0x20964dc
         /* 020964DC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020964DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020964E0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020964DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020964E0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020964E0 */ _t3 = _t2 & 0x00000001u;
         /* 020964E0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020964E0 */ goto L_020964E4;
@@ -6658,8 +6658,8 @@ void Gambit_fn_020964D4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -6673,15 +6673,15 @@ void Gambit_fn_020964D4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -6718,11 +6718,11 @@ void Gambit_fn_020964E8(CPUState* cpu) {
         /* 020964F4 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020964F4 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020964F8 */ cpu->r[30] = cpu->r[3];
-        /* 020964F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020964F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020964FC */ cpu->r[31] = cpu->r[4];
         /* 02096500 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02096500 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02096504 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096504 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096504 */ _t5 = _t4 & 0x00000001u;
         /* 02096504 */ if (_t5) goto L_02096548; else goto L_02096508;
   L_02096508: ; // 0x2096508
@@ -6742,8 +6742,8 @@ void Gambit_fn_020964E8(CPUState* cpu) {
         /* 02096530 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 02096534 */ Gambit_fn_02068798(cpu);
         /* 02096538 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02096538 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209653C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096538 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209653C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209653C */ _t10 = _t9 & 0x00000001u;
         /* 0209653C */ if (_t10) goto L_02096548; else goto L_02096540;
   L_02096540: ; // 0x2096540
@@ -6774,11 +6774,11 @@ void Gambit_fn_020964EC(CPUState* cpu) {
         /* 020964F4 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020964F4 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020964F8 */ cpu->r[30] = cpu->r[3];
-        /* 020964F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020964F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020964FC */ cpu->r[31] = cpu->r[4];
         /* 02096500 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02096500 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02096504 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096504 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096504 */ _t5 = _t4 & 0x00000001u;
         /* 02096504 */ if (_t5) goto L_02096548; else goto L_02096508;
   L_02096508: ; // 0x2096508
@@ -6798,8 +6798,8 @@ void Gambit_fn_020964EC(CPUState* cpu) {
         /* 02096530 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 02096534 */ Gambit_fn_02068798(cpu);
         /* 02096538 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02096538 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209653C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096538 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209653C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209653C */ _t10 = _t9 & 0x00000001u;
         /* 0209653C */ if (_t10) goto L_02096548; else goto L_02096540;
   L_02096540: ; // 0x2096540
@@ -6854,15 +6854,15 @@ void Gambit_fn_02096578(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02096578: ; // 0x2096578
-        /* 02096578 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209657C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096578 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209657C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209657C */ _t1 = _t0 & 0x00000001u;
         /* 0209657C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209657C */ goto L_02096580;
   L_02096580: ; // 0x2096580
         /* 02096580 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02096580 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02096584 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096580 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02096584 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096584 */ _t3 = _t2 & 0x00000001u;
         /* 02096584 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02096584 */ goto L_02096588;
@@ -6881,8 +6881,8 @@ void Gambit_fn_02096578(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -6896,15 +6896,15 @@ void Gambit_fn_02096578(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -6950,15 +6950,15 @@ void Gambit_fn_020965A8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020965A8: ; // 0x20965a8
-        /* 020965A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020965AC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020965A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020965AC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020965AC */ _t1 = _t0 & 0x00000001u;
         /* 020965AC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020965AC */ goto L_020965B0;
   L_020965B0: ; // 0x20965b0
         /* 020965B0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020965B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020965B4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020965B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020965B4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020965B4 */ _t3 = _t2 & 0x00000001u;
         /* 020965B4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020965B4 */ goto L_020965B8;
@@ -6977,8 +6977,8 @@ void Gambit_fn_020965A8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -6992,15 +6992,15 @@ void Gambit_fn_020965A8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -7028,15 +7028,15 @@ void Gambit_fn_020965BC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020965BC: ; // 0x20965bc
-        /* 020965BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020965C0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020965BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020965C0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020965C0 */ _t1 = _t0 & 0x00000001u;
         /* 020965C0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020965C0 */ goto L_020965C4;
   L_020965C4: ; // 0x20965c4
         /* 020965C4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020965C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020965C8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020965C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020965C8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020965C8 */ _t3 = _t2 & 0x00000001u;
         /* 020965C8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020965C8 */ goto L_020965CC;
@@ -7055,8 +7055,8 @@ void Gambit_fn_020965BC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -7070,15 +7070,15 @@ void Gambit_fn_020965BC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -7106,15 +7106,15 @@ void Gambit_fn_020965D0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020965D0: ; // 0x20965d0
-        /* 020965D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020965D4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020965D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020965D4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020965D4 */ _t1 = _t0 & 0x00000001u;
         /* 020965D4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020965D4 */ goto L_020965D8;
   L_020965D8: ; // 0x20965d8
         /* 020965D8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020965D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020965DC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020965D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020965DC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020965DC */ _t3 = _t2 & 0x00000001u;
         /* 020965DC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020965DC */ goto L_020965E0;
@@ -7133,8 +7133,8 @@ void Gambit_fn_020965D0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -7148,15 +7148,15 @@ void Gambit_fn_020965D0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -7184,15 +7184,15 @@ void Gambit_fn_020965E4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020965E4: ; // 0x20965e4
-        /* 020965E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020965E8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020965E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020965E8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020965E8 */ _t1 = _t0 & 0x00000001u;
         /* 020965E8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020965E8 */ goto L_020965EC;
   L_020965EC: ; // 0x20965ec
         /* 020965EC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020965EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020965F0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020965EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020965F0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020965F0 */ _t3 = _t2 & 0x00000001u;
         /* 020965F0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020965F0 */ goto L_020965F4;
@@ -7211,8 +7211,8 @@ void Gambit_fn_020965E4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -7226,15 +7226,15 @@ void Gambit_fn_020965E4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -7340,9 +7340,9 @@ void Gambit_fn_02096638(CPUState* cpu) {
         /* 0209663C */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 0209663C */ cpu->r[9] = _t0;
         /* 02096640 */ cpu->r[12] = 0x101D0000u;
-        /* 02096644 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02096644 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02096648 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 0209664C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209664C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209664C */ _t2 = _t1 & 0x00000001u;
         /* 0209664C */ if (_t2) goto L_02096650; else goto L_02096664;
   L_02096650: ; // 0x2096650
@@ -7354,8 +7354,8 @@ void Gambit_fn_02096638(CPUState* cpu) {
         /* 02096660 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 02096660 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_02096664: ; // 0x2096664
-        /* 02096664 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02096668 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096664 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02096668 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096668 */ _t6 = _t5 & 0x00000001u;
         /* 02096668 */ if (_t6) goto L_0209666C; else goto L_02096674;
   L_0209666C: ; // 0x209666c
@@ -7367,9 +7367,9 @@ void Gambit_fn_02096638(CPUState* cpu) {
         /* 02096678 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 02096678 */ cpu->r[7] = _t7;
         /* 0209667C */ cpu->r[11] = 0x101D0000u;
-        /* 02096680 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02096680 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02096684 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 02096688 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096688 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096688 */ _t9 = _t8 & 0x00000001u;
         /* 02096688 */ if (_t9) goto L_0209668C; else goto L_020966A0;
   L_0209668C: ; // 0x209668c
@@ -7441,18 +7441,18 @@ void Gambit_fn_020966CC(CPUState* cpu) {
         /* 0209013C */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0209013C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02090140 */ cpu->r[12] = 0x00000000u;
-        /* 02090144 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02090144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02090148 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 02090148 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0209014C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209014C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209014C */ _t6 = _t5 & 0x00000001u;
         /* 0209014C */ if (_t6) goto L_02090174; else goto L_02090150;
   L_02090150: ; // 0x2090150
         /* 02090150 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02090150 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02090154 */ /* nop */
-        /* 02090158 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0209015C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02090158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0209015C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209015C */ _t9 = _t8 & 0x00000001u;
         /* 0209015C */ if (_t9) goto L_02090160; else goto L_02090174;
   L_02090160: ; // 0x2090160
@@ -7500,10 +7500,10 @@ void Gambit_fn_020966E4(CPUState* cpu) {
         /* 02096704 */ cpu->r[31] = 0x101D0000u;
         /* 02096708 */ _t3 = cpu->r[28] + 0x0000001Cu;
         /* 02096708 */ rbrew_write32(cpu->mem, _t3, cpu->r[4]);
-        /* 0209670C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0209670C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02096710 */ _t4 = cpu->r[28] + 0x0000000Fu;
         /* 02096710 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[27]);
-        /* 02096714 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096714 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096714 */ _t6 = _t5 & 0x00000001u;
         /* 02096714 */ if (_t6) goto L_02096758; else goto L_02096718;
   L_02096718: ; // 0x2096718
@@ -7518,16 +7518,16 @@ void Gambit_fn_020966E4(CPUState* cpu) {
         /* 0209672C */ cpu->r[5] = 0x00000004u;
         /* 02096730 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 02096734 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02096738 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02096738 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0209673C */ cpu->r[0] = cpu->r[27];
-        /* 02096740 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02096740 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02096740 */ _t11 = _t10 & 0x00000001u;
         /* 02096740 */ if (_t11) goto L_02096748; else goto L_02096744;
   L_02096744: ; // 0x2096744
         /* 02096744 */ cpu->r[0] = 0x00000001u;
   L_02096748: ; // 0x2096748
-        /* 02096748 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209674C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096748 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209674C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209674C */ _t13 = _t12 & 0x00000001u;
         /* 0209674C */ if (_t13) goto L_02096758; else goto L_02096750;
   L_02096750: ; // 0x2096750
@@ -7539,9 +7539,9 @@ void Gambit_fn_020966E4(CPUState* cpu) {
         /* 02096758 */ _t16 = cpu->r[28] + 0x00000020u;
         /* 02096758 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 0209675C */ cpu->r[0] = 0x00000000u;
-        /* 02096760 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02096760 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02096764 */ cpu->r[12] = cpu->r[0];
-        /* 02096768 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02096768 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02096768 */ _t18 = _t17 & 0x00000001u;
         /* 02096768 */ if (_t18) goto L_0209676C; else goto L_02096790;
   L_0209676C: ; // 0x209676c
@@ -7566,8 +7566,8 @@ void Gambit_fn_020966E4(CPUState* cpu) {
   L_02096790: ; // 0x2096790
         /* 02096790 */ _t26 = cpu->r[28] + 0x0000000Fu;
         /* 02096790 */ cpu->r[27] = rbrew_read8(cpu->mem, _t26);
-        /* 02096794 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 02096798 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096794 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 02096798 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096798 */ _t28 = _t27 & 0x00000001u;
         /* 02096798 */ if (_t28) goto L_020967DC; else goto L_0209679C;
   L_0209679C: ; // 0x209679c
@@ -7582,16 +7582,16 @@ void Gambit_fn_020966E4(CPUState* cpu) {
         /* 020967B0 */ cpu->r[5] = 0x00000004u;
         /* 020967B4 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020967B8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020967BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020967BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020967C0 */ cpu->r[11] = cpu->r[27];
-        /* 020967C4 */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020967C4 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020967C4 */ _t33 = _t32 & 0x00000001u;
         /* 020967C4 */ if (_t33) goto L_020967CC; else goto L_020967C8;
   L_020967C8: ; // 0x20967c8
         /* 020967C8 */ cpu->r[11] = 0x00000001u;
   L_020967CC: ; // 0x20967cc
-        /* 020967CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020967D0 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020967CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020967D0 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020967D0 */ _t35 = _t34 & 0x00000001u;
         /* 020967D0 */ if (_t35) goto L_020967DC; else goto L_020967D4;
   L_020967D4: ; // 0x20967d4
@@ -7603,9 +7603,9 @@ void Gambit_fn_020966E4(CPUState* cpu) {
         /* 020967DC */ _t38 = cpu->r[28] + 0x00000028u;
         /* 020967DC */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 020967E0 */ cpu->r[0] = 0x00000000u;
-        /* 020967E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 020967E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 020967E8 */ cpu->r[12] = cpu->r[0];
-        /* 020967EC */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020967EC */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020967EC */ _t40 = _t39 & 0x00000001u;
         /* 020967EC */ if (_t40) goto L_020967F0; else goto L_02096814;
   L_020967F0: ; // 0x20967f0
@@ -7630,8 +7630,8 @@ void Gambit_fn_020966E4(CPUState* cpu) {
   L_02096814: ; // 0x2096814
         /* 02096814 */ _t48 = cpu->r[28] + 0x0000000Fu;
         /* 02096814 */ cpu->r[27] = rbrew_read8(cpu->mem, _t48);
-        /* 02096818 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0209681C */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096818 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0209681C */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209681C */ _t50 = _t49 & 0x00000001u;
         /* 0209681C */ if (_t50) goto L_02096860; else goto L_02096820;
   L_02096820: ; // 0x2096820
@@ -7646,16 +7646,16 @@ void Gambit_fn_020966E4(CPUState* cpu) {
         /* 02096834 */ cpu->r[5] = 0x00000004u;
         /* 02096838 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 0209683C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02096840 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02096840 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02096844 */ cpu->r[10] = cpu->r[27];
-        /* 02096848 */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02096848 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02096848 */ _t55 = _t54 & 0x00000001u;
         /* 02096848 */ if (_t55) goto L_02096850; else goto L_0209684C;
   L_0209684C: ; // 0x209684c
         /* 0209684C */ cpu->r[10] = 0x00000001u;
   L_02096850: ; // 0x2096850
-        /* 02096850 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02096854 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096850 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02096854 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096854 */ _t57 = _t56 & 0x00000001u;
         /* 02096854 */ if (_t57) goto L_02096860; else goto L_02096858;
   L_02096858: ; // 0x2096858
@@ -7667,9 +7667,9 @@ void Gambit_fn_020966E4(CPUState* cpu) {
         /* 02096860 */ _t60 = cpu->r[28] + 0x00000030u;
         /* 02096860 */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
         /* 02096864 */ cpu->r[0] = 0x00000000u;
-        /* 02096868 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02096868 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0209686C */ cpu->r[5] = cpu->r[0];
-        /* 02096870 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02096870 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02096870 */ _t62 = _t61 & 0x00000001u;
         /* 02096870 */ if (_t62) goto L_02096874; else goto L_02096898;
   L_02096874: ; // 0x2096874
@@ -7694,8 +7694,8 @@ void Gambit_fn_020966E4(CPUState* cpu) {
   L_02096898: ; // 0x2096898
         /* 02096898 */ _t70 = cpu->r[30] + 0x00000000u;
         /* 02096898 */ cpu->r[25] = rbrew_read8(cpu->mem, _t70);
-        /* 0209689C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 020968A0 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209689C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 020968A0 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020968A0 */ _t72 = _t71 & 0x00000001u;
         /* 020968A0 */ if (_t72) goto L_0209697C; else goto L_020968A4;
   L_020968A4: ; // 0x20968a4
@@ -7711,10 +7711,10 @@ void Gambit_fn_020966E4(CPUState* cpu) {
         /* 020968BC */ cpu->r[4] = (uint32_t)((int32_t)cpu->r[25] * (int32_t)0x00000024u);
         /* 020968C0 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020968C4 */ cpu->r[24] = cpu->r[3];
-        /* 020968C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 020968C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 020968CC */ cpu->r[30] = cpu->r[25];
         /* 020968D0 */ cpu->r[7] = 0x00000000u;
-        /* 020968D4 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020968D4 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020968D4 */ _t77 = _t76 & 0x00000001u;
         /* 020968D4 */ if (_t77) goto L_020968DC; else goto L_020968D8;
   L_020968D8: ; // 0x20968d8
@@ -7727,36 +7727,36 @@ void Gambit_fn_020966E4(CPUState* cpu) {
         /* 020968E8 */ cpu->r[23] = 0x00000018u;
   L_020968EC: ; // 0x20968ec
         /* 020968EC */ cpu->r[27] = cpu->r[24] + cpu->r[22];
-        /* 020968EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020968F0 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020968EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020968F0 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020968F0 */ _t80 = _t79 & 0x00000001u;
         /* 020968F0 */ if (_t80) goto L_02096960; else goto L_020968F4;
   L_020968F4: ; // 0x20968f4
         /* 020968F4 */ cpu->r[26] = cpu->r[27];
-        /* 020968F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 020968F8 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020968F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 020968F8 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020968F8 */ _t82 = _t81 & 0x00000001u;
         /* 020968F8 */ if (_t82) goto L_020968FC; else goto L_0209690C;
   L_020968FC: ; // 0x20968fc
         /* 020968FC */ cpu->r[3] = 0x00000024u;
         /* 02096900 */ Gambit_fn_02801A78(cpu);
         /* 02096904 */ cpu->r[26] = cpu->r[3];
-        /* 02096904 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 02096908 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096904 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 02096908 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096908 */ _t84 = _t83 & 0x00000001u;
         /* 02096908 */ if (_t84) goto L_02096954; else goto L_0209690C;
   L_0209690C: ; // 0x209690c
         /* 0209690C */ cpu->r[11] = cpu->r[26];
-        /* 0209690C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02096910 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209690C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02096910 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096910 */ _t86 = _t85 & 0x00000001u;
         /* 02096910 */ if (_t86) goto L_02096914; else goto L_02096924;
   L_02096914: ; // 0x2096914
         /* 02096914 */ cpu->r[3] = 0x0000000Cu;
         /* 02096918 */ Gambit_fn_02801A78(cpu);
         /* 0209691C */ cpu->r[11] = cpu->r[3];
-        /* 0209691C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02096920 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209691C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02096920 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096920 */ _t88 = _t87 & 0x00000001u;
         /* 02096920 */ if (_t88) goto L_02096940; else goto L_02096924;
   L_02096924: ; // 0x2096924
@@ -7787,14 +7787,14 @@ void Gambit_fn_020966E4(CPUState* cpu) {
         /* 0209695C */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
   L_02096960: ; // 0x2096960
         /* 02096960 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 02096960 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02096960 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02096964 */ cpu->r[22] = cpu->r[22] + 0x00000024u;
-        /* 02096968 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096968 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096968 */ _t98 = _t97 & 0x00000001u;
         /* 02096968 */ if (_t98) goto L_0209696C; else goto L_020968EC;
   L_0209696C: ; // 0x209696c
-        /* 0209696C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 02096970 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209696C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 02096970 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096970 */ _t100 = _t99 & 0x00000001u;
         /* 02096970 */ if (_t100) goto L_0209697C; else goto L_02096974;
   L_02096974: ; // 0x2096974
@@ -7824,10 +7824,10 @@ void Gambit_fn_02096994(CPUState* cpu) {
         /* 02096998 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 0209699C */ _t2 = cpu->r[3] + 0x00000024u;
         /* 0209699C */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 020969A0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[12]);
+        /* 020969A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[12]));
         /* 020969A4 */ _t3 = cpu->r[4] + 0x00000000u;
         /* 020969A4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 020969A8 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020969A8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020969A8 */ _t5 = _t4 & 0x00000001u;
         /* 020969A8 */ if (_t5) goto L_020969AC; else goto L_020969B4;
   L_020969AC: ; // 0x20969ac
@@ -7844,10 +7844,10 @@ void Gambit_fn_02096994(CPUState* cpu) {
         /* 020969C0 */ cpu->r[9] = rbrew_read8(cpu->mem, _t9);
         /* 020969C4 */ _t10 = cpu->r[3] + 0x00000028u;
         /* 020969C4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 020969C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
+        /* 020969C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
         /* 020969CC */ _t11 = cpu->r[3] + 0x0000002Cu;
         /* 020969CC */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
-        /* 020969D0 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020969D0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020969D0 */ _t13 = _t12 & 0x00000001u;
         /* 020969D0 */ if (_t13) goto L_020969D4; else goto L_020969DC;
   L_020969D4: ; // 0x20969d4
@@ -7868,10 +7868,10 @@ void Gambit_fn_02096994(CPUState* cpu) {
         /* 020969F0 */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
         /* 020969F4 */ _t20 = cpu->r[3] + 0x00000034u;
         /* 020969F4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 020969F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
+        /* 020969F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
         /* 020969FC */ _t21 = cpu->r[6] + 0x00000000u;
         /* 020969FC */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
-        /* 02096A00 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02096A00 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02096A00 */ _t23 = _t22 & 0x00000001u;
         /* 02096A00 */ if (_t23) goto L_02096A04; else goto L_02096A0C;
   L_02096A04: ; // 0x2096a04
@@ -7904,11 +7904,11 @@ void Gambit_fn_02096A1C(CPUState* cpu) {
         /* 02097BF4 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02097BF4 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02097BF8 */ cpu->r[30] = cpu->r[3];
-        /* 02097BF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02097BF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02097BFC */ cpu->r[31] = cpu->r[4];
         /* 02097C00 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02097C00 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02097C04 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097C04 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097C04 */ _t5 = _t4 & 0x00000001u;
         /* 02097C04 */ if (_t5) goto L_02097C74; else goto L_02097C08;
   L_02097C08: ; // 0x2097c08
@@ -7922,10 +7922,10 @@ void Gambit_fn_02096A1C(CPUState* cpu) {
         /* 02097C20 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02097C20 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02097C24 */ cpu->r[11] = cpu->r[11] + 0xFFFFF390u;
-        /* 02097C28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02097C28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02097C2C */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02097C2C */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02097C30 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097C30 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097C30 */ _t10 = _t9 & 0x00000001u;
         /* 02097C30 */ if (_t10) goto L_02097C64; else goto L_02097C34;
   L_02097C34: ; // 0x2097c34
@@ -7946,8 +7946,8 @@ void Gambit_fn_02096A1C(CPUState* cpu) {
         /* 02097C60 */ Gambit_fn_02068798(cpu);
   L_02097C64: ; // 0x2097c64
         /* 02097C64 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02097C64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02097C68 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097C64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02097C68 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097C68 */ _t15 = _t14 & 0x00000001u;
         /* 02097C68 */ if (_t15) goto L_02097C74; else goto L_02097C6C;
   L_02097C6C: ; // 0x2097c6c
@@ -7975,8 +7975,8 @@ void Gambit_fn_02096A24(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -8027,18 +8027,18 @@ void Gambit_fn_02096A3C(CPUState* cpu) {
         /* 02096A44 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 02096A44 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02096A48 */ cpu->r[31] = cpu->r[3];
-        /* 02096A48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02096A48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02096A4C */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02096A4C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 02096A50 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096A50 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096A50 */ _t4 = _t3 & 0x00000001u;
         /* 02096A50 */ if (_t4) goto L_02096A54; else goto L_02096A64;
   L_02096A54: ; // 0x2096a54
         /* 02096A54 */ cpu->r[3] = 0x0000026Cu;
         /* 02096A58 */ Gambit_fn_02801A78(cpu);
         /* 02096A5C */ cpu->r[31] = cpu->r[3];
-        /* 02096A5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02096A60 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096A5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02096A60 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096A60 */ _t6 = _t5 & 0x00000001u;
         /* 02096A60 */ if (_t6) goto L_02096B24; else goto L_02096A64;
   L_02096A64: ; // 0x2096a64
@@ -8154,18 +8154,18 @@ void Gambit_fn_02096A40(CPUState* cpu) {
         /* 02096A44 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 02096A44 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02096A48 */ cpu->r[31] = cpu->r[3];
-        /* 02096A48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02096A48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02096A4C */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02096A4C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 02096A50 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096A50 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096A50 */ _t4 = _t3 & 0x00000001u;
         /* 02096A50 */ if (_t4) goto L_02096A54; else goto L_02096A64;
   L_02096A54: ; // 0x2096a54
         /* 02096A54 */ cpu->r[3] = 0x0000026Cu;
         /* 02096A58 */ Gambit_fn_02801A78(cpu);
         /* 02096A5C */ cpu->r[31] = cpu->r[3];
-        /* 02096A5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02096A60 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096A5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02096A60 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096A60 */ _t6 = _t5 & 0x00000001u;
         /* 02096A60 */ if (_t6) goto L_02096B24; else goto L_02096A64;
   L_02096A64: ; // 0x2096a64
@@ -8288,9 +8288,9 @@ void Gambit_fn_02096B3C(CPUState* cpu) {
         /* 02096B54 */ _t3 = cpu->r[31] + 0x00000118u;
         /* 02096B54 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
         /* 02096B58 */ cpu->r[0] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 02096B58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02096B58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02096B5C */ cpu->r[12] = 0x00000000u;
-        /* 02096B60 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096B60 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096B60 */ _t5 = _t4 & 0x00000001u;
         /* 02096B60 */ if (_t5) goto L_02096B64; else goto L_02096B68;
   L_02096B64: ; // 0x2096b64
@@ -8325,9 +8325,9 @@ void Gambit_fn_02096B40(CPUState* cpu) {
         /* 02096B54 */ _t3 = cpu->r[31] + 0x00000118u;
         /* 02096B54 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
         /* 02096B58 */ cpu->r[0] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 02096B58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02096B58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02096B5C */ cpu->r[12] = 0x00000000u;
-        /* 02096B60 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096B60 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096B60 */ _t5 = _t4 & 0x00000001u;
         /* 02096B60 */ if (_t5) goto L_02096B64; else goto L_02096B68;
   L_02096B64: ; // 0x2096b64
@@ -8363,9 +8363,9 @@ void Gambit_fn_02096B80(CPUState* cpu) {
         /* 02096B94 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 02096B98 */ _t4 = cpu->r[30] + 0x00000268u;
         /* 02096B98 */ cpu->r[10] = rbrew_read8(cpu->mem, _t4);
-        /* 02096B9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02096B9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02096BA0 */ cpu->r[31] = 0x00000001u;
-        /* 02096BA4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096BA4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096BA4 */ _t6 = _t5 & 0x00000001u;
         /* 02096BA4 */ if (_t6) goto L_02096BA8; else goto L_02096BC4;
   L_02096BA8: ; // 0x2096ba8
@@ -8376,8 +8376,8 @@ void Gambit_fn_02096B80(CPUState* cpu) {
         /* 02096BB0 */ cpu->ctr = cpu->r[9];
         /* 02096BB4 */ cpu->r[3] = cpu->r[30];
         /* 02096BB8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02096BBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02096BC0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096BBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02096BC0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096BC0 */ _t10 = _t9 & 0x00000001u;
         /* 02096BC0 */ if (_t10) goto L_02096BC4; else goto L_02096BE4;
   L_02096BC4: ; // 0x2096bc4
@@ -8389,8 +8389,8 @@ void Gambit_fn_02096B80(CPUState* cpu) {
         /* 02096BCC */ cpu->r[0] = rbrew_read32(cpu->mem, _t13);
         /* 02096BD0 */ cpu->ctr = cpu->r[0];
         /* 02096BD4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02096BD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02096BDC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096BD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02096BDC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096BDC */ _t15 = _t14 & 0x00000001u;
         /* 02096BDC */ if (_t15) goto L_02096BE0; else goto L_02096BE4;
   L_02096BE0: ; // 0x2096be0
@@ -8425,9 +8425,9 @@ void Gambit_fn_02096B84(CPUState* cpu) {
         /* 02096B94 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 02096B98 */ _t4 = cpu->r[30] + 0x00000268u;
         /* 02096B98 */ cpu->r[10] = rbrew_read8(cpu->mem, _t4);
-        /* 02096B9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02096B9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02096BA0 */ cpu->r[31] = 0x00000001u;
-        /* 02096BA4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096BA4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096BA4 */ _t6 = _t5 & 0x00000001u;
         /* 02096BA4 */ if (_t6) goto L_02096BA8; else goto L_02096BC4;
   L_02096BA8: ; // 0x2096ba8
@@ -8438,8 +8438,8 @@ void Gambit_fn_02096B84(CPUState* cpu) {
         /* 02096BB0 */ cpu->ctr = cpu->r[9];
         /* 02096BB4 */ cpu->r[3] = cpu->r[30];
         /* 02096BB8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02096BBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02096BC0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096BBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02096BC0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096BC0 */ _t10 = _t9 & 0x00000001u;
         /* 02096BC0 */ if (_t10) goto L_02096BC4; else goto L_02096BE4;
   L_02096BC4: ; // 0x2096bc4
@@ -8451,8 +8451,8 @@ void Gambit_fn_02096B84(CPUState* cpu) {
         /* 02096BCC */ cpu->r[0] = rbrew_read32(cpu->mem, _t13);
         /* 02096BD0 */ cpu->ctr = cpu->r[0];
         /* 02096BD4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02096BD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02096BDC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096BD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02096BDC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096BDC */ _t15 = _t14 & 0x00000001u;
         /* 02096BDC */ if (_t15) goto L_02096BE0; else goto L_02096BE4;
   L_02096BE0: ; // 0x2096be0
@@ -8700,10 +8700,10 @@ void Gambit_fn_02096C60(CPUState* cpu) {
         /* 02096DCC */ cpu->r[9] = 0x10010000u;
         /* 02096DD0 */ _t36 = cpu->r[11] + 0xFFFFF090u;
         /* 02096DD0 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t36);
-        /* 02096DD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02096DD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02096DD8 */ _t37 = cpu->r[9] + 0xFFFFF08Cu;
         /* 02096DD8 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t37);
-        /* 02096DDC */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096DDC */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096DDC */ _t39 = _t38 & 0x00000001u;
         /* 02096DDC */ if (_t39) goto L_02096E0C; else goto L_02096DE0;
   L_02096DE0: ; // 0x2096de0
@@ -8718,8 +8718,8 @@ void Gambit_fn_02096C60(CPUState* cpu) {
         /* 02096DF8 */ Gambit_fn_027ED914(cpu);
         /* 02096DFC */ Gambit_fn_027F69F8(cpu);
         /* 02096E00 */ cpu->r[27] = cpu->r[3];
-        /* 02096E00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 02096E04 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096E00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 02096E04 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096E04 */ _t43 = _t42 & 0x00000001u;
         /* 02096E04 */ if (_t43) goto L_02096E70; else goto L_02096E08;
   L_02096E08: ; // 0x2096e08
@@ -8736,8 +8736,8 @@ void Gambit_fn_02096C60(CPUState* cpu) {
         /* 02096E24 */ Gambit_fn_027ED914(cpu);
         /* 02096E28 */ Gambit_fn_027F69F8(cpu);
         /* 02096E2C */ cpu->r[27] = cpu->r[3];
-        /* 02096E2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 02096E30 */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096E2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 02096E30 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096E30 */ _t47 = _t46 & 0x00000001u;
         /* 02096E30 */ if (_t47) goto L_02096E70; else goto L_02096E34;
   L_02096E34: ; // 0x2096e34
@@ -8756,10 +8756,10 @@ void Gambit_fn_02096C60(CPUState* cpu) {
         /* 02096E58 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t50);
         /* 02096E5C */ _t51 = cpu->r[1] + 0x00000030u;
         /* 02096E5C */ rbrew_write32(cpu->mem, _t51, cpu->r[9]);
-        /* 02096E60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02096E60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02096E64 */ _t52 = cpu->r[1] + 0x00000020u;
         /* 02096E64 */ rbrew_write32(cpu->mem, _t52, cpu->r[9]);
-        /* 02096E68 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096E68 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096E68 */ _t54 = _t53 & 0x00000001u;
         /* 02096E68 */ if (_t54) goto L_02096F38; else goto L_02096E6C;
   L_02096E6C: ; // 0x2096e6c
@@ -8780,10 +8780,10 @@ void Gambit_fn_02096C60(CPUState* cpu) {
         /* 02096E94 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t57);
         /* 02096E98 */ _t58 = cpu->r[1] + 0x00000030u;
         /* 02096E98 */ rbrew_write32(cpu->mem, _t58, cpu->r[9]);
-        /* 02096E9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02096E9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02096EA0 */ _t59 = cpu->r[1] + 0x00000020u;
         /* 02096EA0 */ rbrew_write32(cpu->mem, _t59, cpu->r[9]);
-        /* 02096EA4 */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02096EA4 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02096EA4 */ _t61 = _t60 & 0x00000001u;
         /* 02096EA4 */ if (_t61) goto L_02096F38; else goto L_02096EA8;
   L_02096EA8: ; // 0x2096ea8
@@ -8809,8 +8809,8 @@ void Gambit_fn_02096C60(CPUState* cpu) {
         /* 02096EDC */ cpu->f[9] = cpu->f[0] - cpu->f[12];
         /* 02096EE0 */ cpu->f[10] = (double)(float)cpu->f[9];
         /* 02096EE4 */ cpu->f[1] = cpu->f[31] - cpu->f[10];
-        /* 02096EE8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
-        /* 02096EEC */ _t68 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02096EE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
+        /* 02096EEC */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02096EEC */ _t69 = _t68 & 0x00000001u;
         /* 02096EEC */ if (_t69) goto L_02096EF0; else goto L_02096F10;
   L_02096EF0: ; // 0x2096ef0
@@ -8825,8 +8825,8 @@ void Gambit_fn_02096C60(CPUState* cpu) {
         /* 02096F08 */ Gambit_fn_027ED914(cpu);
         /* 02096F0C */ goto L_02097078;
   L_02096F10: ; // 0x2096f10
-        /* 02096F10 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
-        /* 02096F14 */ _t72 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02096F10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
+        /* 02096F14 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02096F14 */ _t73 = _t72 & 0x00000001u;
         /* 02096F14 */ if (_t73) goto L_02096F18; else goto L_02096F1C;
   L_02096F18: ; // 0x2096f18
@@ -8869,8 +8869,8 @@ void Gambit_fn_02096C60(CPUState* cpu) {
         /* 02096F7C */ cpu->f[12] = cpu->f[11] - cpu->f[0];
         /* 02096F80 */ cpu->f[11] = (double)(float)cpu->f[12];
         /* 02096F84 */ cpu->f[1] = cpu->f[31] - cpu->f[11];
-        /* 02096F88 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
-        /* 02096F8C */ _t83 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02096F88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
+        /* 02096F8C */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02096F8C */ _t84 = _t83 & 0x00000001u;
         /* 02096F8C */ if (_t84) goto L_02096F90; else goto L_02096FE4;
   L_02096F90: ; // 0x2096f90
@@ -8899,15 +8899,15 @@ void Gambit_fn_02096C60(CPUState* cpu) {
         /* 02096FCC */ cpu->f[10] = cpu->f[8] - cpu->f[13];
         /* 02096FD0 */ cpu->f[13] = (double)(float)cpu->f[10];
         /* 02096FD4 */ cpu->f[1] = cpu->f[31] - cpu->f[13];
-        /* 02096FD8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
-        /* 02096FDC */ _t92 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02096FD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
+        /* 02096FDC */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02096FDC */ _t93 = _t92 & 0x00000001u;
         /* 02096FDC */ if (_t93) goto L_0209703C; else goto L_02096FE0;
   L_02096FE0: ; // 0x2096fe0
         /* 02096FE0 */ goto L_02097054;
   L_02096FE4: ; // 0x2096fe4
-        /* 02096FE4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
-        /* 02096FE8 */ _t94 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02096FE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
+        /* 02096FE8 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02096FE8 */ _t95 = _t94 & 0x00000001u;
         /* 02096FE8 */ if (_t95) goto L_02096FEC; else goto L_02096FF0;
   L_02096FEC: ; // 0x2096fec
@@ -8937,8 +8937,8 @@ void Gambit_fn_02096C60(CPUState* cpu) {
         /* 02097028 */ cpu->f[10] = cpu->f[8] - cpu->f[13];
         /* 0209702C */ cpu->f[13] = (double)(float)cpu->f[10];
         /* 02097030 */ cpu->f[1] = cpu->f[31] - cpu->f[13];
-        /* 02097034 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
-        /* 02097038 */ _t103 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02097034 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
+        /* 02097038 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02097038 */ _t104 = _t103 & 0x00000001u;
         /* 02097038 */ if (_t104) goto L_0209703C; else goto L_02097054;
   L_0209703C: ; // 0x209703c
@@ -8951,8 +8951,8 @@ void Gambit_fn_02096C60(CPUState* cpu) {
         /* 0209704C */ rbrew_write32(cpu->mem, _t106, cpu->r[29]);
         /* 02097050 */ goto L_02097070;
   L_02097054: ; // 0x2097054
-        /* 02097054 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
-        /* 02097058 */ _t107 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02097054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
+        /* 02097058 */ _t107 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02097058 */ _t108 = _t107 & 0x00000001u;
         /* 02097058 */ if (_t108) goto L_0209705C; else goto L_02097060;
   L_0209705C: ; // 0x209705c
@@ -8977,7 +8977,7 @@ void Gambit_fn_02096C60(CPUState* cpu) {
         /* 02097084 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t113);
         /* 02097088 */ _t114 = cpu->r[1] + 0x00000090u;
         /* 02097088 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t114);
-        /* 0209708C */ _t115 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209708C */ _t115 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209708C */ _t116 = _t115 & 0x00000001u;
         /* 0209708C */ if (_t116) goto L_02097090; // else: addr-0 trap, fall-through
   L_02097090: ; // 0x2097090
@@ -9006,10 +9006,10 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 020970BC */ _t2 = cpu->r[1] + 0x00000028u;
         /* 020970BC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020970C0 */ cpu->r[17] = cpu->r[3];
-        /* 020970C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[17], 0x00000000u);
+        /* 020970C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[17], 0x00000000u));
         /* 020970C4 */ _t3 = cpu->r[1] + 0x0000002Cu;
         /* 020970C4 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020970C8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020970C8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020970C8 */ _t5 = _t4 & 0x00000001u;
         /* 020970C8 */ if (_t5) goto L_02097188; else goto L_020970CC;
   L_020970CC: ; // 0x20970cc
@@ -9149,7 +9149,7 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 02097254 */ cpu->r[5] = cpu->r[28];
         /* 02097258 */ cpu->r[4] = cpu->r[27];
         /* 0209725C */ cpu->r[3] = cpu->r[1] + 0x00000040u;
-        /* 02097260 */ _t39 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02097260 */ _t39 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02097260 */ _t40 = _t39 & 0x00000001u;
         /* 02097260 */ if (_t40) goto L_02097264; // else: addr-0 trap, fall-through
   L_02097264: ; // 0x2097264
@@ -9157,13 +9157,13 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 02097268 */ cpu->r[5] = cpu->r[28];
         /* 0209726C */ cpu->r[4] = cpu->r[26];
         /* 02097270 */ cpu->r[3] = cpu->r[1] + 0x0000006Cu;
-        /* 02097274 */ _t41 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02097274 */ _t41 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02097274 */ _t42 = _t41 & 0x00000001u;
         /* 02097274 */ if (_t42) goto L_02097278; // else: addr-0 trap, fall-through
   L_02097278: ; // 0x2097278
         /* 02097278 */ Gambit_fn_0282A5F4(cpu);
-        /* 0209727C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000003u);
-        /* 02097280 */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209727C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000003u));
+        /* 02097280 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02097280 */ _t44 = _t43 & 0x00000001u;
         /* 02097280 */ if (_t44) goto L_02097284; else goto L_020972A8;
   L_02097284: ; // 0x2097284
@@ -9173,9 +9173,9 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 02097290 */ Gambit_fn_026D86B0(cpu);
         /* 02097294 */ _t45 = cpu->r[22] + 0x00000000u;
         /* 02097294 */ cpu->r[8] = rbrew_read32(cpu->mem, _t45);
-        /* 02097298 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02097298 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0209729C */ cpu->r[29] = cpu->r[3];
-        /* 020972A0 */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020972A0 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020972A0 */ _t47 = _t46 & 0x00000001u;
         /* 020972A0 */ if (_t47) goto L_020972A4; else goto L_020972D0;
   L_020972A4: ; // 0x20972a4
@@ -9187,9 +9187,9 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 020972B4 */ Gambit_fn_026D86B0(cpu);
         /* 020972B8 */ _t48 = cpu->r[22] + 0x00000000u;
         /* 020972B8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t48);
-        /* 020972BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020972BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020972C0 */ cpu->r[29] = cpu->r[3];
-        /* 020972C4 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020972C4 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020972C4 */ _t50 = _t49 & 0x00000001u;
         /* 020972C4 */ if (_t50) goto L_020972C8; else goto L_020972D0;
   L_020972C8: ; // 0x20972c8
@@ -9198,8 +9198,8 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 020972CC */ _t52 = cpu->r[22] + 0x00000000u;
         /* 020972CC */ rbrew_write32(cpu->mem, _t52, cpu->r[23]);
   L_020972D0: ; // 0x20972d0
-        /* 020972D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020972D4 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020972D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020972D4 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020972D4 */ _t54 = _t53 & 0x00000001u;
         /* 020972D4 */ if (_t54) goto L_02097308; else goto L_020972D8;
   L_020972D8: ; // 0x20972d8
@@ -9211,25 +9211,25 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 020972E4 */ cpu->r[3] = cpu->r[29];
         /* 020972E8 */ cpu->r[4] = cpu->r[19];
         /* 020972EC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020972F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020972F4 */ _t57 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020972F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020972F4 */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020972F4 */ _t58 = _t57 & 0x00000001u;
         /* 020972F4 */ if (_t58) goto L_02097308; else goto L_020972F8;
   L_020972F8: ; // 0x20972f8
-        /* 020972F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000003u);
+        /* 020972F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000003u));
         /* 020972FC */ _t59 = cpu->r[15] + 0x00000000u;
         /* 020972FC */ rbrew_write32(cpu->mem, _t59, cpu->r[29]);
-        /* 02097300 */ _t60 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02097300 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02097300 */ _t61 = _t60 & 0x00000001u;
         /* 02097300 */ if (_t61) goto L_02097318; else goto L_02097304;
   L_02097304: ; // 0x2097304
         /* 02097304 */ goto L_0209733C;
   L_02097308: ; // 0x2097308
         /* 02097308 */ cpu->r[12] = 0x00000000u;
-        /* 0209730C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000003u);
+        /* 0209730C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000003u));
         /* 02097310 */ _t62 = cpu->r[15] + 0x00000000u;
         /* 02097310 */ rbrew_write32(cpu->mem, _t62, cpu->r[12]);
-        /* 02097314 */ _t63 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02097314 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02097314 */ _t64 = _t63 & 0x00000001u;
         /* 02097314 */ if (_t64) goto L_02097318; else goto L_0209733C;
   L_02097318: ; // 0x2097318
@@ -9241,8 +9241,8 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 02097328 */ rbrew_write32(cpu->mem, _t65, cpu->r[3]);
         /* 0209732C */ _t66 = cpu->r[1] + 0x00000028u;
         /* 0209732C */ cpu->r[0] = rbrew_read32(cpu->mem, _t66);
-        /* 02097330 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], cpu->r[0]);
-        /* 02097334 */ _t67 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02097330 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], cpu->r[0]));
+        /* 02097334 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02097334 */ _t68 = _t67 & 0x00000001u;
         /* 02097334 */ if (_t68) goto L_02097338; else goto L_02097448;
   L_02097338: ; // 0x2097338
@@ -9256,18 +9256,18 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 0209734C */ rbrew_write32(cpu->mem, _t69, cpu->r[3]);
         /* 02097350 */ _t70 = cpu->r[1] + 0x00000028u;
         /* 02097350 */ cpu->r[0] = rbrew_read32(cpu->mem, _t70);
-        /* 02097354 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], cpu->r[0]);
-        /* 02097358 */ _t71 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02097354 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], cpu->r[0]));
+        /* 02097358 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02097358 */ _t72 = _t71 & 0x00000001u;
         /* 02097358 */ if (_t72) goto L_0209735C; else goto L_02097448;
   L_0209735C: ; // 0x209735c
-        /* 0209735C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[17], 0x00000000u);
-        /* 02097360 */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209735C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[17], 0x00000000u));
+        /* 02097360 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097360 */ _t74 = _t73 & 0x00000001u;
         /* 02097360 */ if (_t74) goto L_020973DC; else goto L_02097364;
   L_02097364: ; // 0x2097364
-        /* 02097364 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000003u);
-        /* 02097368 */ _t75 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02097364 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000003u));
+        /* 02097368 */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02097368 */ _t76 = _t75 & 0x00000001u;
         /* 02097368 */ if (_t76) goto L_0209736C; else goto L_020973A4;
   L_0209736C: ; // 0x209736c
@@ -9279,8 +9279,8 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 02097378 */ cpu->r[4] = cpu->r[1] + 0x00000018u;
         /* 0209737C */ cpu->r[6] = 0x00000000u;
         /* 02097380 */ Gambit_fn_020CF8DC(cpu);
-        /* 02097384 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000003u);
-        /* 02097388 */ _t79 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02097384 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000003u));
+        /* 02097388 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02097388 */ _t80 = _t79 & 0x00000001u;
         /* 02097388 */ if (_t80) goto L_020973C4; else goto L_0209738C;
   L_0209738C: ; // 0x209738c
@@ -9301,8 +9301,8 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 020973B0 */ cpu->r[4] = cpu->r[1] + 0x00000018u;
         /* 020973B4 */ cpu->r[6] = 0x00000000u;
         /* 020973B8 */ Gambit_fn_020CF8DC(cpu);
-        /* 020973BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000003u);
-        /* 020973C0 */ _t85 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020973BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000003u));
+        /* 020973C0 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020973C0 */ _t86 = _t85 & 0x00000001u;
         /* 020973C0 */ if (_t86) goto L_020973C4; else goto L_0209738C;
   L_020973C4: ; // 0x20973c4
@@ -9315,8 +9315,8 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 020973D4 */ Gambit_fn_020A900C(cpu);
         /* 020973D8 */ goto L_02097448;
   L_020973DC: ; // 0x20973dc
-        /* 020973DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000003u);
-        /* 020973E0 */ _t89 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020973DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000003u));
+        /* 020973E0 */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020973E0 */ _t90 = _t89 & 0x00000001u;
         /* 020973E0 */ if (_t90) goto L_020973E4; else goto L_02097414;
   L_020973E4: ; // 0x20973e4
@@ -9328,8 +9328,8 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 020973F0 */ cpu->r[4] = cpu->r[1] + 0x0000001Cu;
         /* 020973F4 */ cpu->r[6] = 0x00000000u;
         /* 020973F8 */ Gambit_fn_020CF8DC(cpu);
-        /* 020973FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000003u);
-        /* 02097400 */ _t93 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020973FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000003u));
+        /* 02097400 */ _t93 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02097400 */ _t94 = _t93 & 0x00000001u;
         /* 02097400 */ if (_t94) goto L_02097434; else goto L_02097404;
   L_02097404: ; // 0x2097404
@@ -9348,8 +9348,8 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 02097420 */ cpu->r[4] = cpu->r[1] + 0x0000001Cu;
         /* 02097424 */ cpu->r[6] = 0x00000000u;
         /* 02097428 */ Gambit_fn_020CF8DC(cpu);
-        /* 0209742C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000003u);
-        /* 02097430 */ _t99 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209742C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000003u));
+        /* 02097430 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02097430 */ _t100 = _t99 & 0x00000001u;
         /* 02097430 */ if (_t100) goto L_02097434; else goto L_02097404;
   L_02097434: ; // 0x2097434
@@ -9363,15 +9363,15 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 02097444 */ Gambit_fn_020A900C(cpu);
   L_02097448: ; // 0x2097448
         /* 02097448 */ cpu->r[16] = cpu->r[16] + 0xFFFFFFFFu;
-        /* 02097448 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[16], 0x00000000u);
+        /* 02097448 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[16], 0x00000000u));
         /* 0209744C */ cpu->r[28] = cpu->r[28] + 0x00000001u;
         /* 02097450 */ cpu->r[18] = cpu->r[18] + 0x00000004u;
-        /* 02097454 */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097454 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097454 */ _t104 = _t103 & 0x00000001u;
         /* 02097454 */ if (_t104) goto L_02097458; else goto L_02097254;
   L_02097458: ; // 0x2097458
-        /* 02097458 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[17], 0x00000000u);
-        /* 0209745C */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097458 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[17], 0x00000000u));
+        /* 0209745C */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209745C */ _t106 = _t105 & 0x00000001u;
         /* 0209745C */ if (_t106) goto L_02097460; else goto L_0209760C;
   L_02097460: ; // 0x2097460
@@ -9389,7 +9389,7 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 02097480 */ cpu->r[5] = cpu->r[28] + 0x00000003u;
         /* 02097484 */ cpu->r[4] = cpu->r[27];
         /* 02097488 */ cpu->r[3] = cpu->r[1] + 0x00000040u;
-        /* 0209748C */ _t109 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209748C */ _t109 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209748C */ _t110 = _t109 & 0x00000001u;
         /* 0209748C */ if (_t110) goto L_02097490; // else: addr-0 trap, fall-through
   L_02097490: ; // 0x2097490
@@ -9397,13 +9397,13 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 02097494 */ cpu->r[5] = cpu->r[28] + 0x00000003u;
         /* 02097498 */ cpu->r[4] = cpu->r[26];
         /* 0209749C */ cpu->r[3] = cpu->r[1] + 0x0000006Cu;
-        /* 020974A0 */ _t111 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020974A0 */ _t111 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020974A0 */ _t112 = _t111 & 0x00000001u;
         /* 020974A0 */ if (_t112) goto L_020974A4; // else: addr-0 trap, fall-through
   L_020974A4: ; // 0x20974a4
         /* 020974A4 */ Gambit_fn_0282A5F4(cpu);
-        /* 020974A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000003u);
-        /* 020974AC */ _t113 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020974A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000003u));
+        /* 020974AC */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020974AC */ _t114 = _t113 & 0x00000001u;
         /* 020974AC */ if (_t114) goto L_020974B0; else goto L_020974D4;
   L_020974B0: ; // 0x20974b0
@@ -9413,9 +9413,9 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 020974BC */ Gambit_fn_026D86B0(cpu);
         /* 020974C0 */ _t115 = cpu->r[23] + 0x00000000u;
         /* 020974C0 */ cpu->r[6] = rbrew_read32(cpu->mem, _t115);
-        /* 020974C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 020974C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 020974C8 */ cpu->r[29] = cpu->r[3];
-        /* 020974CC */ _t116 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020974CC */ _t116 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020974CC */ _t117 = _t116 & 0x00000001u;
         /* 020974CC */ if (_t117) goto L_020974D0; else goto L_020974FC;
   L_020974D0: ; // 0x20974d0
@@ -9427,9 +9427,9 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 020974E0 */ Gambit_fn_026D86B0(cpu);
         /* 020974E4 */ _t118 = cpu->r[23] + 0x00000000u;
         /* 020974E4 */ cpu->r[6] = rbrew_read32(cpu->mem, _t118);
-        /* 020974E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 020974E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 020974EC */ cpu->r[29] = cpu->r[3];
-        /* 020974F0 */ _t119 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020974F0 */ _t119 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020974F0 */ _t120 = _t119 & 0x00000001u;
         /* 020974F0 */ if (_t120) goto L_020974F4; else goto L_020974FC;
   L_020974F4: ; // 0x20974f4
@@ -9438,8 +9438,8 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 020974F8 */ _t122 = cpu->r[23] + 0x00000000u;
         /* 020974F8 */ rbrew_write32(cpu->mem, _t122, cpu->r[22]);
   L_020974FC: ; // 0x20974fc
-        /* 020974FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02097500 */ _t123 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020974FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02097500 */ _t123 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097500 */ _t124 = _t123 & 0x00000001u;
         /* 02097500 */ if (_t124) goto L_02097534; else goto L_02097504;
   L_02097504: ; // 0x2097504
@@ -9451,25 +9451,25 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 02097510 */ cpu->r[3] = cpu->r[29];
         /* 02097514 */ cpu->r[4] = cpu->r[21];
         /* 02097518 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0209751C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02097520 */ _t127 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209751C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02097520 */ _t127 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097520 */ _t128 = _t127 & 0x00000001u;
         /* 02097520 */ if (_t128) goto L_02097534; else goto L_02097524;
   L_02097524: ; // 0x2097524
-        /* 02097524 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000003u);
+        /* 02097524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000003u));
         /* 02097528 */ _t129 = cpu->r[18] + 0x00000000u;
         /* 02097528 */ rbrew_write32(cpu->mem, _t129, cpu->r[29]);
-        /* 0209752C */ _t130 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209752C */ _t130 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209752C */ _t131 = _t130 & 0x00000001u;
         /* 0209752C */ if (_t131) goto L_02097544; else goto L_02097530;
   L_02097530: ; // 0x2097530
         /* 02097530 */ goto L_02097568;
   L_02097534: ; // 0x2097534
         /* 02097534 */ cpu->r[0] = 0x00000000u;
-        /* 02097538 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000003u);
+        /* 02097538 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000003u));
         /* 0209753C */ _t132 = cpu->r[18] + 0x00000000u;
         /* 0209753C */ rbrew_write32(cpu->mem, _t132, cpu->r[0]);
-        /* 02097540 */ _t133 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02097540 */ _t133 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02097540 */ _t134 = _t133 & 0x00000001u;
         /* 02097540 */ if (_t134) goto L_02097544; else goto L_02097568;
   L_02097544: ; // 0x2097544
@@ -9481,8 +9481,8 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 02097554 */ rbrew_write32(cpu->mem, _t135, cpu->r[3]);
         /* 02097558 */ _t136 = cpu->r[1] + 0x0000002Cu;
         /* 02097558 */ cpu->r[9] = rbrew_read32(cpu->mem, _t136);
-        /* 0209755C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], cpu->r[9]);
-        /* 02097560 */ _t137 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209755C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], cpu->r[9]));
+        /* 02097560 */ _t137 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02097560 */ _t138 = _t137 & 0x00000001u;
         /* 02097560 */ if (_t138) goto L_02097564; else goto L_020975FC;
   L_02097564: ; // 0x2097564
@@ -9496,13 +9496,13 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 02097578 */ rbrew_write32(cpu->mem, _t139, cpu->r[3]);
         /* 0209757C */ _t140 = cpu->r[1] + 0x0000002Cu;
         /* 0209757C */ cpu->r[9] = rbrew_read32(cpu->mem, _t140);
-        /* 02097580 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], cpu->r[9]);
-        /* 02097584 */ _t141 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02097580 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], cpu->r[9]));
+        /* 02097584 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02097584 */ _t142 = _t141 & 0x00000001u;
         /* 02097584 */ if (_t142) goto L_02097588; else goto L_020975FC;
   L_02097588: ; // 0x2097588
-        /* 02097588 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000003u);
-        /* 0209758C */ _t143 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02097588 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000003u));
+        /* 0209758C */ _t143 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209758C */ _t144 = _t143 & 0x00000001u;
         /* 0209758C */ if (_t144) goto L_02097590; else goto L_020975C8;
   L_02097590: ; // 0x2097590
@@ -9514,8 +9514,8 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 0209759C */ cpu->r[4] = cpu->r[1] + 0x00000020u;
         /* 020975A0 */ cpu->r[6] = 0x00000000u;
         /* 020975A4 */ Gambit_fn_020CF8DC(cpu);
-        /* 020975A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000003u);
-        /* 020975AC */ _t147 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020975A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000003u));
+        /* 020975AC */ _t147 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020975AC */ _t148 = _t147 & 0x00000001u;
         /* 020975AC */ if (_t148) goto L_020975E8; else goto L_020975B0;
   L_020975B0: ; // 0x20975b0
@@ -9536,8 +9536,8 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 020975D4 */ cpu->r[4] = cpu->r[1] + 0x00000020u;
         /* 020975D8 */ cpu->r[6] = 0x00000000u;
         /* 020975DC */ Gambit_fn_020CF8DC(cpu);
-        /* 020975E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000003u);
-        /* 020975E4 */ _t153 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020975E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000003u));
+        /* 020975E4 */ _t153 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020975E4 */ _t154 = _t153 & 0x00000001u;
         /* 020975E4 */ if (_t154) goto L_020975E8; else goto L_020975B0;
   L_020975E8: ; // 0x20975e8
@@ -9550,10 +9550,10 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 020975F8 */ Gambit_fn_020A900C(cpu);
   L_020975FC: ; // 0x20975fc
         /* 020975FC */ cpu->r[19] = cpu->r[19] + 0xFFFFFFFFu;
-        /* 020975FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[19], 0x00000000u);
+        /* 020975FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[19], 0x00000000u));
         /* 02097600 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
         /* 02097604 */ cpu->r[20] = cpu->r[20] + 0x00000004u;
-        /* 02097608 */ _t157 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097608 */ _t157 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097608 */ _t158 = _t157 & 0x00000001u;
         /* 02097608 */ if (_t158) goto L_0209760C; else goto L_02097480;
   L_0209760C: ; // 0x209760c
@@ -9591,10 +9591,10 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 0209766C */ _t166 = cpu->r[1] + 0x00000030u;
         /* 0209766C */ rbrew_write32(cpu->mem, _t166, cpu->r[12]);
         /* 02097670 */ Gambit_fn_020A7150(cpu);
-        /* 02097674 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[17], 0x00000000u);
+        /* 02097674 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[17], 0x00000000u));
         /* 02097678 */ _t167 = cpu->r[31] + 0x00000250u;
         /* 02097678 */ rbrew_write32(cpu->mem, _t167, cpu->r[3]);
-        /* 0209767C */ _t168 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209767C */ _t168 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209767C */ _t169 = _t168 & 0x00000001u;
         /* 0209767C */ if (_t169) goto L_02097680; else goto L_020976E4;
   L_02097680: ; // 0x2097680
@@ -9627,9 +9627,9 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 020976C8 */ cpu->r[9] = _t176;
         /* 020976CC */ cpu->r[30] = cpu->r[3];
         /* 020976D0 */ cpu->r[4] = 0x101D0000u;
-        /* 020976D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020976D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020976D8 */ cpu->r[4] = cpu->r[4] + 0xFFFFEE20u;
-        /* 020976DC */ _t177 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020976DC */ _t177 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020976DC */ _t178 = _t177 & 0x00000001u;
         /* 020976DC */ if (_t178) goto L_020976E0; else goto L_02097848;
   L_020976E0: ; // 0x20976e0
@@ -9668,13 +9668,13 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 02097730 */ cpu->r[5] = cpu->r[28];
         /* 02097734 */ cpu->r[4] = cpu->r[30] + 0xFFFFF180u;
         /* 02097738 */ cpu->r[3] = cpu->r[1] + 0x000000A0u;
-        /* 0209773C */ _t189 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209773C */ _t189 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209773C */ _t190 = _t189 & 0x00000001u;
         /* 0209773C */ if (_t190) goto L_02097740; // else: addr-0 trap, fall-through
   L_02097740: ; // 0x2097740
         /* 02097740 */ Gambit_fn_0282A5F4(cpu);
-        /* 02097744 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000002u);
-        /* 02097748 */ _t191 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02097744 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000002u));
+        /* 02097748 */ _t191 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02097748 */ _t192 = _t191 & 0x00000001u;
         /* 02097748 */ if (_t192) goto L_0209774C; else goto L_0209776C;
   L_0209774C: ; // 0x209774c
@@ -9682,10 +9682,10 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 02097750 */ cpu->r[3] = 0x00000000u;
         /* 02097754 */ cpu->r[5] = cpu->r[1] + 0x000000A0u;
         /* 02097758 */ Gambit_fn_020A7150(cpu);
-        /* 0209775C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000002u);
+        /* 0209775C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000002u));
         /* 02097760 */ _t193 = cpu->r[27] + cpu->r[26];
         /* 02097760 */ rbrew_write32(cpu->mem, _t193, cpu->r[3]);
-        /* 02097764 */ _t194 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02097764 */ _t194 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02097764 */ _t195 = _t194 & 0x00000001u;
         /* 02097764 */ if (_t195) goto L_02097788; else goto L_02097768;
   L_02097768: ; // 0x2097768
@@ -9695,10 +9695,10 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 02097770 */ cpu->r[3] = 0x00000000u;
         /* 02097774 */ cpu->r[5] = cpu->r[1] + 0x000000A0u;
         /* 02097778 */ Gambit_fn_020A7150(cpu);
-        /* 0209777C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000002u);
+        /* 0209777C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000002u));
         /* 02097780 */ _t196 = cpu->r[27] + 0x00000000u;
         /* 02097780 */ rbrew_write32(cpu->mem, _t196, cpu->r[3]);
-        /* 02097784 */ _t197 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02097784 */ _t197 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02097784 */ _t198 = _t197 & 0x00000001u;
         /* 02097784 */ if (_t198) goto L_02097788; else goto L_020977B0;
   L_02097788: ; // 0x2097788
@@ -9710,10 +9710,10 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 02097794 */ cpu->r[4] = cpu->r[1] + 0x00000024u;
         /* 02097798 */ Gambit_fn_020A9AE4(cpu);
         /* 0209779C */ cpu->r[25] = cpu->r[25] + 0xFFFFFFFFu;
-        /* 0209779C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 0209779C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 020977A0 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
         /* 020977A4 */ cpu->r[26] = cpu->r[26] + 0x00000004u;
-        /* 020977A8 */ _t201 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020977A8 */ _t201 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020977A8 */ _t202 = _t201 & 0x00000001u;
         /* 020977A8 */ if (_t202) goto L_020977AC; else goto L_02097730;
   L_020977AC: ; // 0x20977ac
@@ -9727,10 +9727,10 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 020977BC */ cpu->r[4] = cpu->r[1] + 0x00000024u;
         /* 020977C0 */ Gambit_fn_020A9AE4(cpu);
         /* 020977C4 */ cpu->r[25] = cpu->r[25] + 0xFFFFFFFFu;
-        /* 020977C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 020977C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 020977C8 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
         /* 020977CC */ cpu->r[26] = cpu->r[26] + 0x00000004u;
-        /* 020977D0 */ _t205 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020977D0 */ _t205 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020977D0 */ _t206 = _t205 & 0x00000001u;
         /* 020977D0 */ if (_t206) goto L_020977D4; else goto L_02097730;
   L_020977D4: ; // 0x20977d4
@@ -9762,9 +9762,9 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 0209781C */ cpu->r[9] = _t212;
         /* 02097820 */ cpu->r[30] = cpu->r[3];
         /* 02097824 */ cpu->r[4] = 0x101D0000u;
-        /* 02097828 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02097828 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0209782C */ cpu->r[4] = cpu->r[4] + 0xFFFFEE20u;
-        /* 02097830 */ _t213 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097830 */ _t213 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097830 */ _t214 = _t213 & 0x00000001u;
         /* 02097830 */ if (_t214) goto L_02097834; else goto L_02097848;
   L_02097834: ; // 0x2097834
@@ -9776,8 +9776,8 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 02097844 */ _t216 = cpu->r[4] + 0x00000000u;
         /* 02097844 */ rbrew_write32(cpu->mem, _t216, cpu->r[0]);
   L_02097848: ; // 0x2097848
-        /* 02097848 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0209784C */ _t217 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097848 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0209784C */ _t217 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209784C */ _t218 = _t217 & 0x00000001u;
         /* 0209784C */ if (_t218) goto L_0209786C; else goto L_02097850;
   L_02097850: ; // 0x2097850
@@ -9788,8 +9788,8 @@ void Gambit_fn_020970A0(CPUState* cpu) {
         /* 02097858 */ cpu->ctr = cpu->r[0];
         /* 0209785C */ cpu->r[3] = cpu->r[30];
         /* 02097860 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02097864 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02097868 */ _t221 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097864 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02097868 */ _t221 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097868 */ _t222 = _t221 & 0x00000001u;
         /* 02097868 */ if (_t222) goto L_0209786C; else goto L_02097870;
   L_0209786C: ; // 0x209786c
@@ -9846,11 +9846,11 @@ void Gambit_fn_0209789C(CPUState* cpu) {
         /* 020978E0 */ cpu->r[8] = 0x10010000u;
         /* 020978E4 */ cpu->r[31] = 0x10010000u;
         /* 020978E8 */ cpu->r[29] = cpu->r[29] + 0xFFFFF19Cu;
-        /* 020978EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 020978EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 020978F0 */ cpu->r[31] = cpu->r[31] + 0xFFFFEFD8u;
         /* 020978F4 */ _t8 = cpu->r[8] + 0xFFFFF090u;
         /* 020978F4 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t8);
-        /* 020978F8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020978F8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020978F8 */ _t10 = _t9 & 0x00000001u;
         /* 020978F8 */ if (_t10) goto L_020978FC; else goto L_020979B4;
   L_020978FC: ; // 0x20978fc
@@ -9902,8 +9902,8 @@ void Gambit_fn_0209789C(CPUState* cpu) {
         /* 0209797C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02097980 */ _t24 = cpu->r[1] + 0x00000010u;
         /* 02097980 */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
-        /* 02097984 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 02097988 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097984 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 02097988 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097988 */ _t26 = _t25 & 0x00000001u;
         /* 02097988 */ if (_t26) goto L_0209798C; else goto L_02097AD8;
   L_0209798C: ; // 0x209798c
@@ -9915,10 +9915,10 @@ void Gambit_fn_0209789C(CPUState* cpu) {
         /* 0209799C */ _t28 = cpu->r[30] + 0x00000260u;
         /* 0209799C */ cpu->r[8] = rbrew_read8(cpu->mem, _t28);
         /* 020979A0 */ cpu->r[10] = 0x00000001u;
-        /* 020979A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020979A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020979A8 */ _t29 = cpu->r[30] + 0x00000268u;
         /* 020979A8 */ rbrew_write8(cpu->mem, _t29, (uint8_t)cpu->r[10]);
-        /* 020979AC */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020979AC */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020979AC */ _t31 = _t30 & 0x00000001u;
         /* 020979AC */ if (_t31) goto L_02097B34; else goto L_020979B0;
   L_020979B0: ; // 0x20979b0
@@ -9930,10 +9930,10 @@ void Gambit_fn_0209789C(CPUState* cpu) {
         /* 020979C0 */ _t32 = cpu->r[1] + 0x0000001Cu;
         /* 020979C0 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
         /* 020979C4 */ Gambit_fn_02172B08(cpu);
-        /* 020979C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 020979C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 020979CC */ cpu->r[3] = cpu->r[30];
         /* 020979D0 */ cpu->r[4] = 0x00000000u;
-        /* 020979D4 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020979D4 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020979D4 */ _t34 = _t33 & 0x00000001u;
         /* 020979D4 */ if (_t34) goto L_020979D8; else goto L_02097A64;
   L_020979D8: ; // 0x20979d8
@@ -9983,8 +9983,8 @@ void Gambit_fn_0209789C(CPUState* cpu) {
         /* 02097A50 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02097A54 */ _t48 = cpu->r[1] + 0x00000010u;
         /* 02097A54 */ cpu->r[0] = rbrew_read32(cpu->mem, _t48);
-        /* 02097A58 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 02097A5C */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097A58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 02097A5C */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097A5C */ _t50 = _t49 & 0x00000001u;
         /* 02097A5C */ if (_t50) goto L_0209798C; else goto L_02097A60;
   L_02097A60: ; // 0x2097a60
@@ -10030,8 +10030,8 @@ void Gambit_fn_0209789C(CPUState* cpu) {
         /* 02097AC8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02097ACC */ _t63 = cpu->r[1] + 0x00000010u;
         /* 02097ACC */ cpu->r[0] = rbrew_read32(cpu->mem, _t63);
-        /* 02097AD0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 02097AD4 */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097AD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 02097AD4 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097AD4 */ _t65 = _t64 & 0x00000001u;
         /* 02097AD4 */ if (_t65) goto L_0209798C; else goto L_02097AD8;
   L_02097AD8: ; // 0x2097ad8
@@ -10052,13 +10052,13 @@ void Gambit_fn_0209789C(CPUState* cpu) {
         /* 02097AFC */ _t70 = cpu->r[9] + 0x00000001u;
         /* 02097AFC */ cpu->r[11] = rbrew_read8(cpu->mem, _t70);
         /* 02097AFC */ cpu->r[9] = _t70;
-        /* 02097B00 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[11]);
-        /* 02097B04 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097B00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[11]));
+        /* 02097B04 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097B04 */ _t72 = _t71 & 0x00000001u;
         /* 02097B04 */ if (_t72) goto L_02097B08; else goto L_02097B18;
   L_02097B08: ; // 0x2097b08
-        /* 02097B08 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 02097B0C */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097B08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 02097B0C */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097B0C */ _t74 = _t73 & 0x00000001u;
         /* 02097B0C */ if (_t74) goto L_0209798C; else goto L_02097B10;
   L_02097B10: ; // 0x2097b10
@@ -10072,10 +10072,10 @@ void Gambit_fn_0209789C(CPUState* cpu) {
         /* 02097B18 */ _t78 = cpu->r[30] + 0x00000260u;
         /* 02097B18 */ cpu->r[8] = rbrew_read8(cpu->mem, _t78);
         /* 02097B1C */ cpu->r[10] = 0x00000000u;
-        /* 02097B20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02097B20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02097B24 */ _t79 = cpu->r[30] + 0x00000268u;
         /* 02097B24 */ rbrew_write8(cpu->mem, _t79, (uint8_t)cpu->r[10]);
-        /* 02097B28 */ _t80 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097B28 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097B28 */ _t81 = _t80 & 0x00000001u;
         /* 02097B28 */ if (_t81) goto L_02097B34; else goto L_02097B2C;
   L_02097B2C: ; // 0x2097b2c
@@ -10095,7 +10095,7 @@ void Gambit_fn_0209789C(CPUState* cpu) {
         /* 02097B4C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t85);
         /* 02097B50 */ _t86 = cpu->r[1] + 0x0000004Cu;
         /* 02097B50 */ cpu->r[31] = rbrew_read32(cpu->mem, _t86);
-        /* 02097B54 */ _t87 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02097B54 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02097B54 */ _t88 = _t87 & 0x00000001u;
         /* 02097B54 */ if (_t88) goto L_02097B58; // else: addr-0 trap, fall-through
   L_02097B58: ; // 0x2097b58
@@ -10139,11 +10139,11 @@ void Gambit_fn_020978A0(CPUState* cpu) {
         /* 020978E0 */ cpu->r[8] = 0x10010000u;
         /* 020978E4 */ cpu->r[31] = 0x10010000u;
         /* 020978E8 */ cpu->r[29] = cpu->r[29] + 0xFFFFF19Cu;
-        /* 020978EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 020978EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 020978F0 */ cpu->r[31] = cpu->r[31] + 0xFFFFEFD8u;
         /* 020978F4 */ _t8 = cpu->r[8] + 0xFFFFF090u;
         /* 020978F4 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t8);
-        /* 020978F8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020978F8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020978F8 */ _t10 = _t9 & 0x00000001u;
         /* 020978F8 */ if (_t10) goto L_020978FC; else goto L_020979B4;
   L_020978FC: ; // 0x20978fc
@@ -10195,8 +10195,8 @@ void Gambit_fn_020978A0(CPUState* cpu) {
         /* 0209797C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02097980 */ _t24 = cpu->r[1] + 0x00000010u;
         /* 02097980 */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
-        /* 02097984 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 02097988 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097984 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 02097988 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097988 */ _t26 = _t25 & 0x00000001u;
         /* 02097988 */ if (_t26) goto L_0209798C; else goto L_02097AD8;
   L_0209798C: ; // 0x209798c
@@ -10208,10 +10208,10 @@ void Gambit_fn_020978A0(CPUState* cpu) {
         /* 0209799C */ _t28 = cpu->r[30] + 0x00000260u;
         /* 0209799C */ cpu->r[8] = rbrew_read8(cpu->mem, _t28);
         /* 020979A0 */ cpu->r[10] = 0x00000001u;
-        /* 020979A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020979A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020979A8 */ _t29 = cpu->r[30] + 0x00000268u;
         /* 020979A8 */ rbrew_write8(cpu->mem, _t29, (uint8_t)cpu->r[10]);
-        /* 020979AC */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020979AC */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020979AC */ _t31 = _t30 & 0x00000001u;
         /* 020979AC */ if (_t31) goto L_02097B34; else goto L_020979B0;
   L_020979B0: ; // 0x20979b0
@@ -10223,10 +10223,10 @@ void Gambit_fn_020978A0(CPUState* cpu) {
         /* 020979C0 */ _t32 = cpu->r[1] + 0x0000001Cu;
         /* 020979C0 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
         /* 020979C4 */ Gambit_fn_02172B08(cpu);
-        /* 020979C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 020979C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 020979CC */ cpu->r[3] = cpu->r[30];
         /* 020979D0 */ cpu->r[4] = 0x00000000u;
-        /* 020979D4 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020979D4 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020979D4 */ _t34 = _t33 & 0x00000001u;
         /* 020979D4 */ if (_t34) goto L_020979D8; else goto L_02097A64;
   L_020979D8: ; // 0x20979d8
@@ -10276,8 +10276,8 @@ void Gambit_fn_020978A0(CPUState* cpu) {
         /* 02097A50 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02097A54 */ _t48 = cpu->r[1] + 0x00000010u;
         /* 02097A54 */ cpu->r[0] = rbrew_read32(cpu->mem, _t48);
-        /* 02097A58 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 02097A5C */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097A58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 02097A5C */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097A5C */ _t50 = _t49 & 0x00000001u;
         /* 02097A5C */ if (_t50) goto L_0209798C; else goto L_02097A60;
   L_02097A60: ; // 0x2097a60
@@ -10323,8 +10323,8 @@ void Gambit_fn_020978A0(CPUState* cpu) {
         /* 02097AC8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02097ACC */ _t63 = cpu->r[1] + 0x00000010u;
         /* 02097ACC */ cpu->r[0] = rbrew_read32(cpu->mem, _t63);
-        /* 02097AD0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 02097AD4 */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097AD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 02097AD4 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097AD4 */ _t65 = _t64 & 0x00000001u;
         /* 02097AD4 */ if (_t65) goto L_0209798C; else goto L_02097AD8;
   L_02097AD8: ; // 0x2097ad8
@@ -10345,13 +10345,13 @@ void Gambit_fn_020978A0(CPUState* cpu) {
         /* 02097AFC */ _t70 = cpu->r[9] + 0x00000001u;
         /* 02097AFC */ cpu->r[11] = rbrew_read8(cpu->mem, _t70);
         /* 02097AFC */ cpu->r[9] = _t70;
-        /* 02097B00 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[11]);
-        /* 02097B04 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097B00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[11]));
+        /* 02097B04 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097B04 */ _t72 = _t71 & 0x00000001u;
         /* 02097B04 */ if (_t72) goto L_02097B08; else goto L_02097B18;
   L_02097B08: ; // 0x2097b08
-        /* 02097B08 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 02097B0C */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097B08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 02097B0C */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097B0C */ _t74 = _t73 & 0x00000001u;
         /* 02097B0C */ if (_t74) goto L_0209798C; else goto L_02097B10;
   L_02097B10: ; // 0x2097b10
@@ -10365,10 +10365,10 @@ void Gambit_fn_020978A0(CPUState* cpu) {
         /* 02097B18 */ _t78 = cpu->r[30] + 0x00000260u;
         /* 02097B18 */ cpu->r[8] = rbrew_read8(cpu->mem, _t78);
         /* 02097B1C */ cpu->r[10] = 0x00000000u;
-        /* 02097B20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02097B20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02097B24 */ _t79 = cpu->r[30] + 0x00000268u;
         /* 02097B24 */ rbrew_write8(cpu->mem, _t79, (uint8_t)cpu->r[10]);
-        /* 02097B28 */ _t80 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097B28 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097B28 */ _t81 = _t80 & 0x00000001u;
         /* 02097B28 */ if (_t81) goto L_02097B34; else goto L_02097B2C;
   L_02097B2C: ; // 0x2097b2c
@@ -10388,7 +10388,7 @@ void Gambit_fn_020978A0(CPUState* cpu) {
         /* 02097B4C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t85);
         /* 02097B50 */ _t86 = cpu->r[1] + 0x0000004Cu;
         /* 02097B50 */ cpu->r[31] = rbrew_read32(cpu->mem, _t86);
-        /* 02097B54 */ _t87 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02097B54 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02097B54 */ _t88 = _t87 & 0x00000001u;
         /* 02097B54 */ if (_t88) goto L_02097B58; // else: addr-0 trap, fall-through
   L_02097B58: ; // 0x2097b58
@@ -10511,15 +10511,15 @@ void Gambit_fn_02097BD4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02097BD4: ; // 0x2097bd4
-        /* 02097BD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02097BD8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097BD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02097BD8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097BD8 */ _t1 = _t0 & 0x00000001u;
         /* 02097BD8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02097BD8 */ goto L_02097BDC;
   L_02097BDC: ; // 0x2097bdc
         /* 02097BDC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02097BDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02097BE0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097BDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02097BE0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097BE0 */ _t3 = _t2 & 0x00000001u;
         /* 02097BE0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02097BE0 */ goto L_02097BE4;
@@ -10538,8 +10538,8 @@ void Gambit_fn_02097BD4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -10553,15 +10553,15 @@ void Gambit_fn_02097BD4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -10598,11 +10598,11 @@ void Gambit_fn_02097BE8(CPUState* cpu) {
         /* 02097BF4 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02097BF4 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02097BF8 */ cpu->r[30] = cpu->r[3];
-        /* 02097BF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02097BF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02097BFC */ cpu->r[31] = cpu->r[4];
         /* 02097C00 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02097C00 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02097C04 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097C04 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097C04 */ _t5 = _t4 & 0x00000001u;
         /* 02097C04 */ if (_t5) goto L_02097C74; else goto L_02097C08;
   L_02097C08: ; // 0x2097c08
@@ -10616,10 +10616,10 @@ void Gambit_fn_02097BE8(CPUState* cpu) {
         /* 02097C20 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02097C20 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02097C24 */ cpu->r[11] = cpu->r[11] + 0xFFFFF390u;
-        /* 02097C28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02097C28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02097C2C */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02097C2C */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02097C30 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097C30 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097C30 */ _t10 = _t9 & 0x00000001u;
         /* 02097C30 */ if (_t10) goto L_02097C64; else goto L_02097C34;
   L_02097C34: ; // 0x2097c34
@@ -10640,8 +10640,8 @@ void Gambit_fn_02097BE8(CPUState* cpu) {
         /* 02097C60 */ Gambit_fn_02068798(cpu);
   L_02097C64: ; // 0x2097c64
         /* 02097C64 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02097C64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02097C68 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097C64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02097C68 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097C68 */ _t15 = _t14 & 0x00000001u;
         /* 02097C68 */ if (_t15) goto L_02097C74; else goto L_02097C6C;
   L_02097C6C: ; // 0x2097c6c
@@ -10672,11 +10672,11 @@ void Gambit_fn_02097BEC(CPUState* cpu) {
         /* 02097BF4 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02097BF4 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02097BF8 */ cpu->r[30] = cpu->r[3];
-        /* 02097BF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02097BF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02097BFC */ cpu->r[31] = cpu->r[4];
         /* 02097C00 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02097C00 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02097C04 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097C04 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097C04 */ _t5 = _t4 & 0x00000001u;
         /* 02097C04 */ if (_t5) goto L_02097C74; else goto L_02097C08;
   L_02097C08: ; // 0x2097c08
@@ -10690,10 +10690,10 @@ void Gambit_fn_02097BEC(CPUState* cpu) {
         /* 02097C20 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02097C20 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02097C24 */ cpu->r[11] = cpu->r[11] + 0xFFFFF390u;
-        /* 02097C28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02097C28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02097C2C */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02097C2C */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02097C30 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097C30 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097C30 */ _t10 = _t9 & 0x00000001u;
         /* 02097C30 */ if (_t10) goto L_02097C64; else goto L_02097C34;
   L_02097C34: ; // 0x2097c34
@@ -10714,8 +10714,8 @@ void Gambit_fn_02097BEC(CPUState* cpu) {
         /* 02097C60 */ Gambit_fn_02068798(cpu);
   L_02097C64: ; // 0x2097c64
         /* 02097C64 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02097C64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02097C68 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097C64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02097C68 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097C68 */ _t15 = _t14 & 0x00000001u;
         /* 02097C68 */ if (_t15) goto L_02097C74; else goto L_02097C6C;
   L_02097C6C: ; // 0x2097c6c
@@ -10770,15 +10770,15 @@ void Gambit_fn_02097CA4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02097CA4: ; // 0x2097ca4
-        /* 02097CA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02097CA8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097CA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02097CA8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097CA8 */ _t1 = _t0 & 0x00000001u;
         /* 02097CA8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02097CA8 */ goto L_02097CAC;
   L_02097CAC: ; // 0x2097cac
         /* 02097CAC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02097CAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02097CB0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097CAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02097CB0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097CB0 */ _t3 = _t2 & 0x00000001u;
         /* 02097CB0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02097CB0 */ goto L_02097CB4;
@@ -10797,8 +10797,8 @@ void Gambit_fn_02097CA4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -10812,15 +10812,15 @@ void Gambit_fn_02097CA4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -10866,15 +10866,15 @@ void Gambit_fn_02097CD4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02097CD4: ; // 0x2097cd4
-        /* 02097CD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02097CD8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097CD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02097CD8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097CD8 */ _t1 = _t0 & 0x00000001u;
         /* 02097CD8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02097CD8 */ goto L_02097CDC;
   L_02097CDC: ; // 0x2097cdc
         /* 02097CDC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02097CDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02097CE0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097CDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02097CE0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097CE0 */ _t3 = _t2 & 0x00000001u;
         /* 02097CE0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02097CE0 */ goto L_02097CE4;
@@ -10893,8 +10893,8 @@ void Gambit_fn_02097CD4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -10908,15 +10908,15 @@ void Gambit_fn_02097CD4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -10944,15 +10944,15 @@ void Gambit_fn_02097CE8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02097CE8: ; // 0x2097ce8
-        /* 02097CE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02097CEC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097CE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02097CEC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097CEC */ _t1 = _t0 & 0x00000001u;
         /* 02097CEC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02097CEC */ goto L_02097CF0;
   L_02097CF0: ; // 0x2097cf0
         /* 02097CF0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02097CF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02097CF4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097CF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02097CF4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097CF4 */ _t3 = _t2 & 0x00000001u;
         /* 02097CF4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02097CF4 */ goto L_02097CF8;
@@ -10971,8 +10971,8 @@ void Gambit_fn_02097CE8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -10986,15 +10986,15 @@ void Gambit_fn_02097CE8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -11100,9 +11100,9 @@ void Gambit_fn_02097D3C(CPUState* cpu) {
         /* 02097D40 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 02097D40 */ cpu->r[9] = _t0;
         /* 02097D44 */ cpu->r[12] = 0x101D0000u;
-        /* 02097D48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02097D48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02097D4C */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 02097D50 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097D50 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097D50 */ _t2 = _t1 & 0x00000001u;
         /* 02097D50 */ if (_t2) goto L_02097D54; else goto L_02097D68;
   L_02097D54: ; // 0x2097d54
@@ -11114,8 +11114,8 @@ void Gambit_fn_02097D3C(CPUState* cpu) {
         /* 02097D64 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 02097D64 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_02097D68: ; // 0x2097d68
-        /* 02097D68 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02097D6C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097D68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02097D6C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097D6C */ _t6 = _t5 & 0x00000001u;
         /* 02097D6C */ if (_t6) goto L_02097D70; else goto L_02097D78;
   L_02097D70: ; // 0x2097d70
@@ -11127,9 +11127,9 @@ void Gambit_fn_02097D3C(CPUState* cpu) {
         /* 02097D7C */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 02097D7C */ cpu->r[7] = _t7;
         /* 02097D80 */ cpu->r[11] = 0x101D0000u;
-        /* 02097D84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02097D84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02097D88 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 02097D8C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097D8C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097D8C */ _t9 = _t8 & 0x00000001u;
         /* 02097D8C */ if (_t9) goto L_02097D90; else goto L_02097DA4;
   L_02097D90: ; // 0x2097d90
@@ -11238,18 +11238,18 @@ void Gambit_fn_02097DEC(CPUState* cpu) {
         /* 0208A0DC */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0208A0DC */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0208A0E0 */ cpu->r[12] = 0x00000000u;
-        /* 0208A0E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208A0E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208A0E8 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0208A0E8 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0208A0EC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A0EC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A0EC */ _t6 = _t5 & 0x00000001u;
         /* 0208A0EC */ if (_t6) goto L_0208A114; else goto L_0208A0F0;
   L_0208A0F0: ; // 0x208a0f0
         /* 0208A0F0 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0208A0F0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0208A0F4 */ /* nop */
-        /* 0208A0F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0208A0FC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A0F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0208A0FC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A0FC */ _t9 = _t8 & 0x00000001u;
         /* 0208A0FC */ if (_t9) goto L_0208A100; else goto L_0208A114;
   L_0208A100: ; // 0x208a100
@@ -11310,8 +11310,8 @@ void Gambit_fn_02097DF4(CPUState* cpu) {
         /* 02097E40 */ Gambit_fn_026D6F40(cpu);
         /* 02097E44 */ cpu->r[3] = 0x0000021Cu;
         /* 02097E48 */ Gambit_fn_02801A78(cpu);
-        /* 02097E4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02097E50 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097E4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02097E50 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097E50 */ _t6 = _t5 & 0x00000001u;
         /* 02097E50 */ if (_t6) goto L_02097E58; else goto L_02097E54;
   L_02097E54: ; // 0x2097e54
@@ -11367,8 +11367,8 @@ void Gambit_fn_02097DF8(CPUState* cpu) {
         /* 02097E40 */ Gambit_fn_026D6F40(cpu);
         /* 02097E44 */ cpu->r[3] = 0x0000021Cu;
         /* 02097E48 */ Gambit_fn_02801A78(cpu);
-        /* 02097E4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02097E50 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097E4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02097E50 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097E50 */ _t6 = _t5 & 0x00000001u;
         /* 02097E50 */ if (_t6) goto L_02097E58; else goto L_02097E54;
   L_02097E54: ; // 0x2097e54
@@ -11425,8 +11425,8 @@ void Gambit_fn_02097E84(CPUState* cpu) {
         /* 02097E40 */ Gambit_fn_026D6F40(cpu);
         /* 02097E44 */ cpu->r[3] = 0x0000021Cu;
         /* 02097E48 */ Gambit_fn_02801A78(cpu);
-        /* 02097E4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02097E50 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097E4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02097E50 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097E50 */ _t6 = _t5 & 0x00000001u;
         /* 02097E50 */ if (_t6) goto L_02097E58; else goto L_02097E54;
   L_02097E54: ; // 0x2097e54
@@ -11494,17 +11494,17 @@ void Gambit_fn_02097E9C(CPUState* cpu) {
         /* 02097EBC */ cpu->r[11] = rbrew_read8(cpu->mem, _t5);
         /* 02097EC0 */ _t6 = cpu->r[12] + 0xFFFF9568u;
         /* 02097EC0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t6);
-        /* 02097EC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02097EC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02097EC8 */ cpu->r[29] = cpu->r[30] + 0x00000031u;
-        /* 02097ECC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097ECC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097ECC */ _t8 = _t7 & 0x00000001u;
         /* 02097ECC */ if (_t8) goto L_02097ED0; else goto L_02097F1C;
   L_02097ED0: ; // 0x2097ed0
         /* 02097ED0 */ _t9 = cpu->r[30] + 0x00000030u;
         /* 02097ED0 */ cpu->r[11] = rbrew_read8(cpu->mem, _t9);
-        /* 02097ED4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02097ED4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02097ED8 */ cpu->r[31] = cpu->r[30] + 0x00000030u;
-        /* 02097EDC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097EDC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097EDC */ _t11 = _t10 & 0x00000001u;
         /* 02097EDC */ if (_t11) goto L_02097F60; else goto L_02097EE0;
   L_02097EE0: ; // 0x2097ee0
@@ -11534,8 +11534,8 @@ void Gambit_fn_02097E9C(CPUState* cpu) {
   L_02097F1C: ; // 0x2097f1c
         /* 02097F1C */ _t20 = cpu->r[12] + 0x0000016Cu;
         /* 02097F1C */ cpu->r[0] = rbrew_read8(cpu->mem, _t20);
-        /* 02097F20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02097F24 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097F20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02097F24 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097F24 */ _t22 = _t21 & 0x00000001u;
         /* 02097F24 */ if (_t22) goto L_02097F28; else goto L_02097F60;
   L_02097F28: ; // 0x2097f28
@@ -11547,8 +11547,8 @@ void Gambit_fn_02097E9C(CPUState* cpu) {
         /* 02097F30 */ cpu->r[0] = rbrew_read32(cpu->mem, _t25);
         /* 02097F34 */ cpu->ctr = cpu->r[0];
         /* 02097F38 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02097F3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02097F40 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097F3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02097F40 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097F40 */ _t27 = _t26 & 0x00000001u;
         /* 02097F40 */ if (_t27) goto L_02097F60; else goto L_02097F44;
   L_02097F44: ; // 0x2097f44
@@ -11599,17 +11599,17 @@ void Gambit_fn_02097EA0(CPUState* cpu) {
         /* 02097EBC */ cpu->r[11] = rbrew_read8(cpu->mem, _t5);
         /* 02097EC0 */ _t6 = cpu->r[12] + 0xFFFF9568u;
         /* 02097EC0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t6);
-        /* 02097EC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02097EC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02097EC8 */ cpu->r[29] = cpu->r[30] + 0x00000031u;
-        /* 02097ECC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097ECC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097ECC */ _t8 = _t7 & 0x00000001u;
         /* 02097ECC */ if (_t8) goto L_02097ED0; else goto L_02097F1C;
   L_02097ED0: ; // 0x2097ed0
         /* 02097ED0 */ _t9 = cpu->r[30] + 0x00000030u;
         /* 02097ED0 */ cpu->r[11] = rbrew_read8(cpu->mem, _t9);
-        /* 02097ED4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02097ED4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02097ED8 */ cpu->r[31] = cpu->r[30] + 0x00000030u;
-        /* 02097EDC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097EDC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097EDC */ _t11 = _t10 & 0x00000001u;
         /* 02097EDC */ if (_t11) goto L_02097F60; else goto L_02097EE0;
   L_02097EE0: ; // 0x2097ee0
@@ -11639,8 +11639,8 @@ void Gambit_fn_02097EA0(CPUState* cpu) {
   L_02097F1C: ; // 0x2097f1c
         /* 02097F1C */ _t20 = cpu->r[12] + 0x0000016Cu;
         /* 02097F1C */ cpu->r[0] = rbrew_read8(cpu->mem, _t20);
-        /* 02097F20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02097F24 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097F20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02097F24 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097F24 */ _t22 = _t21 & 0x00000001u;
         /* 02097F24 */ if (_t22) goto L_02097F28; else goto L_02097F60;
   L_02097F28: ; // 0x2097f28
@@ -11652,8 +11652,8 @@ void Gambit_fn_02097EA0(CPUState* cpu) {
         /* 02097F30 */ cpu->r[0] = rbrew_read32(cpu->mem, _t25);
         /* 02097F34 */ cpu->ctr = cpu->r[0];
         /* 02097F38 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02097F3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02097F40 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097F3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02097F40 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097F40 */ _t27 = _t26 & 0x00000001u;
         /* 02097F40 */ if (_t27) goto L_02097F60; else goto L_02097F44;
   L_02097F44: ; // 0x2097f44
@@ -11705,17 +11705,17 @@ void Gambit_fn_02097F7C(CPUState* cpu) {
         /* 02097EBC */ cpu->r[11] = rbrew_read8(cpu->mem, _t5);
         /* 02097EC0 */ _t6 = cpu->r[12] + 0xFFFF9568u;
         /* 02097EC0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t6);
-        /* 02097EC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02097EC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02097EC8 */ cpu->r[29] = cpu->r[30] + 0x00000031u;
-        /* 02097ECC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097ECC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097ECC */ _t8 = _t7 & 0x00000001u;
         /* 02097ECC */ if (_t8) goto L_02097ED0; else goto L_02097F1C;
   L_02097ED0: ; // 0x2097ed0
         /* 02097ED0 */ _t9 = cpu->r[30] + 0x00000030u;
         /* 02097ED0 */ cpu->r[11] = rbrew_read8(cpu->mem, _t9);
-        /* 02097ED4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02097ED4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02097ED8 */ cpu->r[31] = cpu->r[30] + 0x00000030u;
-        /* 02097EDC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097EDC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097EDC */ _t11 = _t10 & 0x00000001u;
         /* 02097EDC */ if (_t11) goto L_02097F60; else goto L_02097EE0;
   L_02097EE0: ; // 0x2097ee0
@@ -11745,8 +11745,8 @@ void Gambit_fn_02097F7C(CPUState* cpu) {
   L_02097F1C: ; // 0x2097f1c
         /* 02097F1C */ _t20 = cpu->r[12] + 0x0000016Cu;
         /* 02097F1C */ cpu->r[0] = rbrew_read8(cpu->mem, _t20);
-        /* 02097F20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02097F24 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097F20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02097F24 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097F24 */ _t22 = _t21 & 0x00000001u;
         /* 02097F24 */ if (_t22) goto L_02097F28; else goto L_02097F60;
   L_02097F28: ; // 0x2097f28
@@ -11758,8 +11758,8 @@ void Gambit_fn_02097F7C(CPUState* cpu) {
         /* 02097F30 */ cpu->r[0] = rbrew_read32(cpu->mem, _t25);
         /* 02097F34 */ cpu->ctr = cpu->r[0];
         /* 02097F38 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02097F3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02097F40 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097F3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02097F40 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097F40 */ _t27 = _t26 & 0x00000001u;
         /* 02097F40 */ if (_t27) goto L_02097F60; else goto L_02097F44;
   L_02097F44: ; // 0x2097f44
@@ -11872,19 +11872,19 @@ void Gambit_fn_02097FB4(CPUState* cpu) {
         /* 02097FC0 */ _t2 = cpu->r[1] + 0x0000000Cu;
         /* 02097FC0 */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
         /* 02097FC4 */ cpu->r[31] = cpu->r[3];
-        /* 02097FC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02097FC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02097FC8 */ cpu->r[30] = cpu->r[4];
         /* 02097FCC */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02097FCC */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02097FD0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097FD0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097FD0 */ _t5 = _t4 & 0x00000001u;
         /* 02097FD0 */ if (_t5) goto L_02097FD4; else goto L_02097FE4;
   L_02097FD4: ; // 0x2097fd4
         /* 02097FD4 */ cpu->r[3] = 0x00000034u;
         /* 02097FD8 */ Gambit_fn_02801A78(cpu);
         /* 02097FDC */ cpu->r[31] = cpu->r[3];
-        /* 02097FDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02097FE0 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097FDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02097FE0 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097FE0 */ _t7 = _t6 & 0x00000001u;
         /* 02097FE0 */ if (_t7) goto L_02098030; else goto L_02097FE4;
   L_02097FE4: ; // 0x2097fe4
@@ -11940,19 +11940,19 @@ void Gambit_fn_02097FB8(CPUState* cpu) {
         /* 02097FC0 */ _t2 = cpu->r[1] + 0x0000000Cu;
         /* 02097FC0 */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
         /* 02097FC4 */ cpu->r[31] = cpu->r[3];
-        /* 02097FC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02097FC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02097FC8 */ cpu->r[30] = cpu->r[4];
         /* 02097FCC */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02097FCC */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02097FD0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097FD0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097FD0 */ _t5 = _t4 & 0x00000001u;
         /* 02097FD0 */ if (_t5) goto L_02097FD4; else goto L_02097FE4;
   L_02097FD4: ; // 0x2097fd4
         /* 02097FD4 */ cpu->r[3] = 0x00000034u;
         /* 02097FD8 */ Gambit_fn_02801A78(cpu);
         /* 02097FDC */ cpu->r[31] = cpu->r[3];
-        /* 02097FDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02097FE0 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02097FDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02097FE0 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02097FE0 */ _t7 = _t6 & 0x00000001u;
         /* 02097FE0 */ if (_t7) goto L_02098030; else goto L_02097FE4;
   L_02097FE4: ; // 0x2097fe4
@@ -12093,11 +12093,11 @@ void Gambit_fn_0209808C(CPUState* cpu) {
         /* 02098140 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02098140 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02098144 */ cpu->r[30] = cpu->r[3];
-        /* 02098144 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02098144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02098148 */ cpu->r[31] = cpu->r[4];
         /* 0209814C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209814C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02098150 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098150 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098150 */ _t5 = _t4 & 0x00000001u;
         /* 02098150 */ if (_t5) goto L_020981C0; else goto L_02098154;
   L_02098154: ; // 0x2098154
@@ -12111,10 +12111,10 @@ void Gambit_fn_0209808C(CPUState* cpu) {
         /* 0209816C */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0209816C */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02098170 */ cpu->r[11] = cpu->r[11] + 0xFFFFF738u;
-        /* 02098174 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02098174 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02098178 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02098178 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0209817C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209817C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209817C */ _t10 = _t9 & 0x00000001u;
         /* 0209817C */ if (_t10) goto L_020981B0; else goto L_02098180;
   L_02098180: ; // 0x2098180
@@ -12135,8 +12135,8 @@ void Gambit_fn_0209808C(CPUState* cpu) {
         /* 020981AC */ Gambit_fn_02068798(cpu);
   L_020981B0: ; // 0x20981b0
         /* 020981B0 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020981B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020981B4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020981B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020981B4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020981B4 */ _t15 = _t14 & 0x00000001u;
         /* 020981B4 */ if (_t15) goto L_020981C0; else goto L_020981B8;
   L_020981B8: ; // 0x20981b8
@@ -12164,8 +12164,8 @@ void Gambit_fn_02098094(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -12216,18 +12216,18 @@ void Gambit_fn_020980AC(CPUState* cpu) {
         /* 020980B4 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 020980B4 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 020980B8 */ cpu->r[31] = cpu->r[3];
-        /* 020980B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020980B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020980BC */ _t2 = cpu->r[1] + 0x00000014u;
         /* 020980BC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 020980C0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020980C0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020980C0 */ _t4 = _t3 & 0x00000001u;
         /* 020980C0 */ if (_t4) goto L_020980C4; else goto L_020980D4;
   L_020980C4: ; // 0x20980c4
         /* 020980C4 */ cpu->r[3] = 0x0000021Cu;
         /* 020980C8 */ Gambit_fn_02801A78(cpu);
         /* 020980CC */ cpu->r[31] = cpu->r[3];
-        /* 020980CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020980D0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020980CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020980D0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020980D0 */ _t6 = _t5 & 0x00000001u;
         /* 020980D0 */ if (_t6) goto L_0209811C; else goto L_020980D4;
   L_020980D4: ; // 0x20980d4
@@ -12275,18 +12275,18 @@ void Gambit_fn_020980B0(CPUState* cpu) {
         /* 020980B4 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 020980B4 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 020980B8 */ cpu->r[31] = cpu->r[3];
-        /* 020980B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020980B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020980BC */ _t2 = cpu->r[1] + 0x00000014u;
         /* 020980BC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 020980C0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020980C0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020980C0 */ _t4 = _t3 & 0x00000001u;
         /* 020980C0 */ if (_t4) goto L_020980C4; else goto L_020980D4;
   L_020980C4: ; // 0x20980c4
         /* 020980C4 */ cpu->r[3] = 0x0000021Cu;
         /* 020980C8 */ Gambit_fn_02801A78(cpu);
         /* 020980CC */ cpu->r[31] = cpu->r[3];
-        /* 020980CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020980D0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020980CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020980D0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020980D0 */ _t6 = _t5 & 0x00000001u;
         /* 020980D0 */ if (_t6) goto L_0209811C; else goto L_020980D4;
   L_020980D4: ; // 0x20980d4
@@ -12337,11 +12337,11 @@ void Gambit_fn_02098134(CPUState* cpu) {
         /* 02098140 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02098140 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02098144 */ cpu->r[30] = cpu->r[3];
-        /* 02098144 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02098144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02098148 */ cpu->r[31] = cpu->r[4];
         /* 0209814C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209814C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02098150 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098150 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098150 */ _t5 = _t4 & 0x00000001u;
         /* 02098150 */ if (_t5) goto L_020981C0; else goto L_02098154;
   L_02098154: ; // 0x2098154
@@ -12355,10 +12355,10 @@ void Gambit_fn_02098134(CPUState* cpu) {
         /* 0209816C */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0209816C */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02098170 */ cpu->r[11] = cpu->r[11] + 0xFFFFF738u;
-        /* 02098174 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02098174 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02098178 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02098178 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0209817C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209817C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209817C */ _t10 = _t9 & 0x00000001u;
         /* 0209817C */ if (_t10) goto L_020981B0; else goto L_02098180;
   L_02098180: ; // 0x2098180
@@ -12379,8 +12379,8 @@ void Gambit_fn_02098134(CPUState* cpu) {
         /* 020981AC */ Gambit_fn_02068798(cpu);
   L_020981B0: ; // 0x20981b0
         /* 020981B0 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020981B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020981B4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020981B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020981B4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020981B4 */ _t15 = _t14 & 0x00000001u;
         /* 020981B4 */ if (_t15) goto L_020981C0; else goto L_020981B8;
   L_020981B8: ; // 0x20981b8
@@ -12411,11 +12411,11 @@ void Gambit_fn_02098138(CPUState* cpu) {
         /* 02098140 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02098140 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02098144 */ cpu->r[30] = cpu->r[3];
-        /* 02098144 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02098144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02098148 */ cpu->r[31] = cpu->r[4];
         /* 0209814C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209814C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02098150 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098150 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098150 */ _t5 = _t4 & 0x00000001u;
         /* 02098150 */ if (_t5) goto L_020981C0; else goto L_02098154;
   L_02098154: ; // 0x2098154
@@ -12429,10 +12429,10 @@ void Gambit_fn_02098138(CPUState* cpu) {
         /* 0209816C */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0209816C */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02098170 */ cpu->r[11] = cpu->r[11] + 0xFFFFF738u;
-        /* 02098174 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02098174 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02098178 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02098178 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0209817C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209817C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209817C */ _t10 = _t9 & 0x00000001u;
         /* 0209817C */ if (_t10) goto L_020981B0; else goto L_02098180;
   L_02098180: ; // 0x2098180
@@ -12453,8 +12453,8 @@ void Gambit_fn_02098138(CPUState* cpu) {
         /* 020981AC */ Gambit_fn_02068798(cpu);
   L_020981B0: ; // 0x20981b0
         /* 020981B0 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020981B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020981B4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020981B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020981B4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020981B4 */ _t15 = _t14 & 0x00000001u;
         /* 020981B4 */ if (_t15) goto L_020981C0; else goto L_020981B8;
   L_020981B8: ; // 0x20981b8
@@ -12581,9 +12581,9 @@ void Gambit_fn_0209822C(CPUState* cpu) {
         /* 02098230 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 02098230 */ cpu->r[9] = _t0;
         /* 02098234 */ cpu->r[12] = 0x101D0000u;
-        /* 02098238 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02098238 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0209823C */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 02098240 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098240 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098240 */ _t2 = _t1 & 0x00000001u;
         /* 02098240 */ if (_t2) goto L_02098244; else goto L_02098258;
   L_02098244: ; // 0x2098244
@@ -12595,8 +12595,8 @@ void Gambit_fn_0209822C(CPUState* cpu) {
         /* 02098254 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 02098254 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_02098258: ; // 0x2098258
-        /* 02098258 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0209825C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098258 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0209825C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209825C */ _t6 = _t5 & 0x00000001u;
         /* 0209825C */ if (_t6) goto L_02098260; else goto L_02098268;
   L_02098260: ; // 0x2098260
@@ -12608,9 +12608,9 @@ void Gambit_fn_0209822C(CPUState* cpu) {
         /* 0209826C */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 0209826C */ cpu->r[7] = _t7;
         /* 02098270 */ cpu->r[11] = 0x101D0000u;
-        /* 02098274 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02098274 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02098278 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 0209827C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209827C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209827C */ _t9 = _t8 & 0x00000001u;
         /* 0209827C */ if (_t9) goto L_02098280; else goto L_02098294;
   L_02098280: ; // 0x2098280
@@ -12725,18 +12725,18 @@ void Gambit_fn_020982E0(CPUState* cpu) {
         /* 02008980 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02008980 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02008984 */ cpu->r[12] = 0x00000000u;
-        /* 02008988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02008988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0200898C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0200898C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02008990 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02008990 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02008990 */ _t6 = _t5 & 0x00000001u;
         /* 02008990 */ if (_t6) goto L_020089B8; else goto L_02008994;
   L_02008994: ; // 0x2008994
         /* 02008994 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02008994 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02008998 */ /* nop */
-        /* 0200899C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 020089A0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0200899C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 020089A0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020089A0 */ _t9 = _t8 & 0x00000001u;
         /* 020089A0 */ if (_t9) goto L_020089A4; else goto L_020089B8;
   L_020089A4: ; // 0x20089a4
@@ -12799,11 +12799,11 @@ void Gambit_fn_020982F4(CPUState* cpu) {
         /* 020986B4 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020986B4 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020986B8 */ cpu->r[30] = cpu->r[3];
-        /* 020986B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020986B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020986BC */ cpu->r[31] = cpu->r[4];
         /* 020986C0 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020986C0 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020986C4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020986C4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020986C4 */ _t5 = _t4 & 0x00000001u;
         /* 020986C4 */ if (_t5) goto L_02098734; else goto L_020986C8;
   L_020986C8: ; // 0x20986c8
@@ -12817,10 +12817,10 @@ void Gambit_fn_020982F4(CPUState* cpu) {
         /* 020986E0 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 020986E0 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 020986E4 */ cpu->r[11] = cpu->r[11] + 0xFFFFFA4Cu;
-        /* 020986E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020986E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020986EC */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 020986EC */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 020986F0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020986F0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020986F0 */ _t10 = _t9 & 0x00000001u;
         /* 020986F0 */ if (_t10) goto L_02098724; else goto L_020986F4;
   L_020986F4: ; // 0x20986f4
@@ -12841,8 +12841,8 @@ void Gambit_fn_020982F4(CPUState* cpu) {
         /* 02098720 */ Gambit_fn_02068798(cpu);
   L_02098724: ; // 0x2098724
         /* 02098724 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02098724 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02098728 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098724 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02098728 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098728 */ _t15 = _t14 & 0x00000001u;
         /* 02098728 */ if (_t15) goto L_02098734; else goto L_0209872C;
   L_0209872C: ; // 0x209872c
@@ -12870,8 +12870,8 @@ void Gambit_fn_020982FC(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -12922,18 +12922,18 @@ void Gambit_fn_02098314(CPUState* cpu) {
         /* 0209831C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0209831C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02098320 */ cpu->r[31] = cpu->r[3];
-        /* 02098320 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02098320 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02098324 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02098324 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 02098328 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098328 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098328 */ _t4 = _t3 & 0x00000001u;
         /* 02098328 */ if (_t4) goto L_0209832C; else goto L_0209833C;
   L_0209832C: ; // 0x209832c
         /* 0209832C */ cpu->r[3] = 0x00000224u;
         /* 02098330 */ Gambit_fn_02801A78(cpu);
         /* 02098334 */ cpu->r[31] = cpu->r[3];
-        /* 02098334 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02098338 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098334 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02098338 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098338 */ _t6 = _t5 & 0x00000001u;
         /* 02098338 */ if (_t6) goto L_02098390; else goto L_0209833C;
   L_0209833C: ; // 0x209833c
@@ -12987,18 +12987,18 @@ void Gambit_fn_02098318(CPUState* cpu) {
         /* 0209831C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0209831C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02098320 */ cpu->r[31] = cpu->r[3];
-        /* 02098320 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02098320 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02098324 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02098324 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 02098328 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098328 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098328 */ _t4 = _t3 & 0x00000001u;
         /* 02098328 */ if (_t4) goto L_0209832C; else goto L_0209833C;
   L_0209832C: ; // 0x209832c
         /* 0209832C */ cpu->r[3] = 0x00000224u;
         /* 02098330 */ Gambit_fn_02801A78(cpu);
         /* 02098334 */ cpu->r[31] = cpu->r[3];
-        /* 02098334 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02098338 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098334 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02098338 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098338 */ _t6 = _t5 & 0x00000001u;
         /* 02098338 */ if (_t6) goto L_02098390; else goto L_0209833C;
   L_0209833C: ; // 0x209833c
@@ -13049,8 +13049,8 @@ void Gambit_fn_020983A8(CPUState* cpu) {
         /* 020983A8 */ _t0 = cpu->r[3] + 0x00000118u;
         /* 020983A8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 020983AC */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 020983AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020983B0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020983AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020983B0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020983B0 */ _t2 = _t1 & 0x00000001u;
         /* 020983B0 */ if (_t2) goto L_020983B4; else goto L_020983BC;
   L_020983B4: ; // 0x20983b4
@@ -13220,8 +13220,8 @@ void Gambit_fn_02098480(CPUState* cpu) {
   L_02098480: ; // 0x2098480
         /* 02098480 */ _t5 = cpu->r[3] + 0x00000220u;
         /* 02098480 */ cpu->r[0] = rbrew_read8(cpu->mem, _t5);
-        /* 02098484 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02098488 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098484 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02098488 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098488 */ _t7 = _t6 & 0x00000001u;
         /* 02098488 */ if (_t7) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02098488 */ goto L_0209848C;
@@ -13261,9 +13261,9 @@ void Gambit_fn_02098490(CPUState* cpu) {
         /* 020984CC */ cpu->r[11] = _t6;
         /* 020984D0 */ cpu->r[31] = cpu->r[3];
         /* 020984D4 */ cpu->r[4] = 0x101D0000u;
-        /* 020984D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020984D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020984DC */ cpu->r[4] = cpu->r[4] + 0xFFFFEE20u;
-        /* 020984E0 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020984E0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020984E0 */ _t8 = _t7 & 0x00000001u;
         /* 020984E0 */ if (_t8) goto L_020984E4; else goto L_020984F8;
   L_020984E4: ; // 0x20984e4
@@ -13275,8 +13275,8 @@ void Gambit_fn_02098490(CPUState* cpu) {
         /* 020984F4 */ _t10 = cpu->r[4] + 0x00000000u;
         /* 020984F4 */ rbrew_write32(cpu->mem, _t10, cpu->r[8]);
   L_020984F8: ; // 0x20984f8
-        /* 020984F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020984FC */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020984F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020984FC */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020984FC */ _t12 = _t11 & 0x00000001u;
         /* 020984FC */ if (_t12) goto L_0209851C; else goto L_02098500;
   L_02098500: ; // 0x2098500
@@ -13287,8 +13287,8 @@ void Gambit_fn_02098490(CPUState* cpu) {
         /* 02098508 */ cpu->ctr = cpu->r[0];
         /* 0209850C */ cpu->r[3] = cpu->r[31];
         /* 02098510 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02098514 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02098518 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098514 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02098518 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098518 */ _t16 = _t15 & 0x00000001u;
         /* 02098518 */ if (_t16) goto L_0209851C; else goto L_02098520;
   L_0209851C: ; // 0x209851c
@@ -13345,9 +13345,9 @@ void Gambit_fn_02098494(CPUState* cpu) {
         /* 020984CC */ cpu->r[11] = _t6;
         /* 020984D0 */ cpu->r[31] = cpu->r[3];
         /* 020984D4 */ cpu->r[4] = 0x101D0000u;
-        /* 020984D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020984D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020984DC */ cpu->r[4] = cpu->r[4] + 0xFFFFEE20u;
-        /* 020984E0 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020984E0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020984E0 */ _t8 = _t7 & 0x00000001u;
         /* 020984E0 */ if (_t8) goto L_020984E4; else goto L_020984F8;
   L_020984E4: ; // 0x20984e4
@@ -13359,8 +13359,8 @@ void Gambit_fn_02098494(CPUState* cpu) {
         /* 020984F4 */ _t10 = cpu->r[4] + 0x00000000u;
         /* 020984F4 */ rbrew_write32(cpu->mem, _t10, cpu->r[8]);
   L_020984F8: ; // 0x20984f8
-        /* 020984F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020984FC */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020984F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020984FC */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020984FC */ _t12 = _t11 & 0x00000001u;
         /* 020984FC */ if (_t12) goto L_0209851C; else goto L_02098500;
   L_02098500: ; // 0x2098500
@@ -13371,8 +13371,8 @@ void Gambit_fn_02098494(CPUState* cpu) {
         /* 02098508 */ cpu->ctr = cpu->r[0];
         /* 0209850C */ cpu->r[3] = cpu->r[31];
         /* 02098510 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02098514 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02098518 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098514 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02098518 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098518 */ _t16 = _t15 & 0x00000001u;
         /* 02098518 */ if (_t16) goto L_0209851C; else goto L_02098520;
   L_0209851C: ; // 0x209851c
@@ -13675,15 +13675,15 @@ void Gambit_fn_02098694(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02098694: ; // 0x2098694
-        /* 02098694 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02098698 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098694 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02098698 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098698 */ _t1 = _t0 & 0x00000001u;
         /* 02098698 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02098698 */ goto L_0209869C;
   L_0209869C: ; // 0x209869c
         /* 0209869C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209869C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020986A0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209869C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020986A0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020986A0 */ _t3 = _t2 & 0x00000001u;
         /* 020986A0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020986A0 */ goto L_020986A4;
@@ -13702,8 +13702,8 @@ void Gambit_fn_02098694(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -13717,15 +13717,15 @@ void Gambit_fn_02098694(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -13762,11 +13762,11 @@ void Gambit_fn_020986A8(CPUState* cpu) {
         /* 020986B4 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020986B4 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020986B8 */ cpu->r[30] = cpu->r[3];
-        /* 020986B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020986B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020986BC */ cpu->r[31] = cpu->r[4];
         /* 020986C0 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020986C0 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020986C4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020986C4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020986C4 */ _t5 = _t4 & 0x00000001u;
         /* 020986C4 */ if (_t5) goto L_02098734; else goto L_020986C8;
   L_020986C8: ; // 0x20986c8
@@ -13780,10 +13780,10 @@ void Gambit_fn_020986A8(CPUState* cpu) {
         /* 020986E0 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 020986E0 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 020986E4 */ cpu->r[11] = cpu->r[11] + 0xFFFFFA4Cu;
-        /* 020986E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020986E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020986EC */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 020986EC */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 020986F0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020986F0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020986F0 */ _t10 = _t9 & 0x00000001u;
         /* 020986F0 */ if (_t10) goto L_02098724; else goto L_020986F4;
   L_020986F4: ; // 0x20986f4
@@ -13804,8 +13804,8 @@ void Gambit_fn_020986A8(CPUState* cpu) {
         /* 02098720 */ Gambit_fn_02068798(cpu);
   L_02098724: ; // 0x2098724
         /* 02098724 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02098724 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02098728 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098724 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02098728 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098728 */ _t15 = _t14 & 0x00000001u;
         /* 02098728 */ if (_t15) goto L_02098734; else goto L_0209872C;
   L_0209872C: ; // 0x209872c
@@ -13836,11 +13836,11 @@ void Gambit_fn_020986AC(CPUState* cpu) {
         /* 020986B4 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020986B4 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020986B8 */ cpu->r[30] = cpu->r[3];
-        /* 020986B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020986B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020986BC */ cpu->r[31] = cpu->r[4];
         /* 020986C0 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020986C0 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020986C4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020986C4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020986C4 */ _t5 = _t4 & 0x00000001u;
         /* 020986C4 */ if (_t5) goto L_02098734; else goto L_020986C8;
   L_020986C8: ; // 0x20986c8
@@ -13854,10 +13854,10 @@ void Gambit_fn_020986AC(CPUState* cpu) {
         /* 020986E0 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 020986E0 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 020986E4 */ cpu->r[11] = cpu->r[11] + 0xFFFFFA4Cu;
-        /* 020986E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020986E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020986EC */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 020986EC */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 020986F0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020986F0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020986F0 */ _t10 = _t9 & 0x00000001u;
         /* 020986F0 */ if (_t10) goto L_02098724; else goto L_020986F4;
   L_020986F4: ; // 0x20986f4
@@ -13878,8 +13878,8 @@ void Gambit_fn_020986AC(CPUState* cpu) {
         /* 02098720 */ Gambit_fn_02068798(cpu);
   L_02098724: ; // 0x2098724
         /* 02098724 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02098724 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02098728 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098724 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02098728 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098728 */ _t15 = _t14 & 0x00000001u;
         /* 02098728 */ if (_t15) goto L_02098734; else goto L_0209872C;
   L_0209872C: ; // 0x209872c
@@ -14012,9 +14012,9 @@ void Gambit_fn_020987A4(CPUState* cpu) {
         /* 020987A8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 020987A8 */ cpu->r[9] = _t0;
         /* 020987AC */ cpu->r[12] = 0x101D0000u;
-        /* 020987B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 020987B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 020987B4 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 020987B8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020987B8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020987B8 */ _t2 = _t1 & 0x00000001u;
         /* 020987B8 */ if (_t2) goto L_020987BC; else goto L_020987D0;
   L_020987BC: ; // 0x20987bc
@@ -14026,8 +14026,8 @@ void Gambit_fn_020987A4(CPUState* cpu) {
         /* 020987CC */ _t4 = cpu->r[12] + 0x00000000u;
         /* 020987CC */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_020987D0: ; // 0x20987d0
-        /* 020987D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 020987D4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020987D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 020987D4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020987D4 */ _t6 = _t5 & 0x00000001u;
         /* 020987D4 */ if (_t6) goto L_020987D8; else goto L_020987E0;
   L_020987D8: ; // 0x20987d8
@@ -14039,9 +14039,9 @@ void Gambit_fn_020987A4(CPUState* cpu) {
         /* 020987E4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 020987E4 */ cpu->r[7] = _t7;
         /* 020987E8 */ cpu->r[11] = 0x101D0000u;
-        /* 020987EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020987EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020987F0 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 020987F4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020987F4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020987F4 */ _t9 = _t8 & 0x00000001u;
         /* 020987F4 */ if (_t9) goto L_020987F8; else goto L_0209880C;
   L_020987F8: ; // 0x20987f8
@@ -14150,18 +14150,18 @@ void Gambit_fn_02098854(CPUState* cpu) {
         /* 0208A0DC */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0208A0DC */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0208A0E0 */ cpu->r[12] = 0x00000000u;
-        /* 0208A0E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208A0E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208A0E8 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0208A0E8 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0208A0EC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A0EC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A0EC */ _t6 = _t5 & 0x00000001u;
         /* 0208A0EC */ if (_t6) goto L_0208A114; else goto L_0208A0F0;
   L_0208A0F0: ; // 0x208a0f0
         /* 0208A0F0 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0208A0F0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0208A0F4 */ /* nop */
-        /* 0208A0F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0208A0FC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A0F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0208A0FC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A0FC */ _t9 = _t8 & 0x00000001u;
         /* 0208A0FC */ if (_t9) goto L_0208A100; else goto L_0208A114;
   L_0208A100: ; // 0x208a100
@@ -14206,11 +14206,11 @@ void Gambit_fn_0209885C(CPUState* cpu) {
         /* 02098CA0 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02098CA0 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02098CA4 */ cpu->r[30] = cpu->r[3];
-        /* 02098CA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02098CA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02098CA8 */ cpu->r[31] = cpu->r[4];
         /* 02098CAC */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02098CAC */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02098CB0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098CB0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098CB0 */ _t5 = _t4 & 0x00000001u;
         /* 02098CB0 */ if (_t5) goto L_02098D20; else goto L_02098CB4;
   L_02098CB4: ; // 0x2098cb4
@@ -14224,10 +14224,10 @@ void Gambit_fn_0209885C(CPUState* cpu) {
         /* 02098CCC */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02098CCC */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02098CD0 */ cpu->r[11] = cpu->r[11] + 0xFFFFFD40u;
-        /* 02098CD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02098CD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02098CD8 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02098CD8 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02098CDC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098CDC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098CDC */ _t10 = _t9 & 0x00000001u;
         /* 02098CDC */ if (_t10) goto L_02098D10; else goto L_02098CE0;
   L_02098CE0: ; // 0x2098ce0
@@ -14248,8 +14248,8 @@ void Gambit_fn_0209885C(CPUState* cpu) {
         /* 02098D0C */ Gambit_fn_02068798(cpu);
   L_02098D10: ; // 0x2098d10
         /* 02098D10 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02098D10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02098D14 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098D10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02098D14 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098D14 */ _t15 = _t14 & 0x00000001u;
         /* 02098D14 */ if (_t15) goto L_02098D20; else goto L_02098D18;
   L_02098D18: ; // 0x2098d18
@@ -14277,8 +14277,8 @@ void Gambit_fn_02098864(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -14329,18 +14329,18 @@ void Gambit_fn_0209887C(CPUState* cpu) {
         /* 02098884 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 02098884 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02098888 */ cpu->r[31] = cpu->r[3];
-        /* 02098888 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02098888 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209888C */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0209888C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 02098890 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098890 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098890 */ _t4 = _t3 & 0x00000001u;
         /* 02098890 */ if (_t4) goto L_02098894; else goto L_020988A4;
   L_02098894: ; // 0x2098894
         /* 02098894 */ cpu->r[3] = 0x0000021Cu;
         /* 02098898 */ Gambit_fn_02801A78(cpu);
         /* 0209889C */ cpu->r[31] = cpu->r[3];
-        /* 0209889C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020988A0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209889C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020988A0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020988A0 */ _t6 = _t5 & 0x00000001u;
         /* 020988A0 */ if (_t6) goto L_020988EC; else goto L_020988A4;
   L_020988A4: ; // 0x20988a4
@@ -14388,18 +14388,18 @@ void Gambit_fn_02098880(CPUState* cpu) {
         /* 02098884 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 02098884 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02098888 */ cpu->r[31] = cpu->r[3];
-        /* 02098888 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02098888 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209888C */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0209888C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 02098890 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098890 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098890 */ _t4 = _t3 & 0x00000001u;
         /* 02098890 */ if (_t4) goto L_02098894; else goto L_020988A4;
   L_02098894: ; // 0x2098894
         /* 02098894 */ cpu->r[3] = 0x0000021Cu;
         /* 02098898 */ Gambit_fn_02801A78(cpu);
         /* 0209889C */ cpu->r[31] = cpu->r[3];
-        /* 0209889C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020988A0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209889C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020988A0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020988A0 */ _t6 = _t5 & 0x00000001u;
         /* 020988A0 */ if (_t6) goto L_020988EC; else goto L_020988A4;
   L_020988A4: ; // 0x20988a4
@@ -14473,16 +14473,16 @@ void Gambit_fn_02098904(CPUState* cpu) {
         /* 02098954 */ _t8 = cpu->r[12] + 0xFFFF9578u;
         /* 02098954 */ cpu->r[12] = rbrew_read32(cpu->mem, _t8);
         /* 02098958 */ cpu->r[8] = 0x10010000u;
-        /* 0209895C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0209895C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02098960 */ _t9 = cpu->r[8] + 0xFFFFFB18u;
         /* 02098960 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t9);
-        /* 02098964 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098964 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098964 */ _t11 = _t10 & 0x00000001u;
         /* 02098964 */ if (_t11) goto L_02098BD8; else goto L_02098968;
   L_02098968: ; // 0x2098968
         /* 02098968 */ Gambit_fn_027FADD4(cpu);
-        /* 0209896C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02098970 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209896C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02098970 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02098970 */ _t13 = _t12 & 0x00000001u;
         /* 02098970 */ if (_t13) goto L_02098BD8; else goto L_02098974;
   L_02098974: ; // 0x2098974
@@ -14521,9 +14521,9 @@ void Gambit_fn_02098904(CPUState* cpu) {
         /* 020989CC */ cpu->r[0] = rbrew_read32(cpu->mem, _t23);
         /* 020989D0 */ cpu->r[26] = 0x00080000u;
         /* 020989D4 */ cpu->r[27] = 0x10110000u;
-        /* 020989D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
+        /* 020989D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
         /* 020989DC */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 020989E0 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020989E0 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020989E0 */ _t25 = _t24 & 0x00000001u;
         /* 020989E0 */ if (_t25) goto L_02098AA8; else goto L_020989E4;
   L_020989E4: ; // 0x20989e4
@@ -14541,13 +14541,13 @@ void Gambit_fn_02098904(CPUState* cpu) {
         /* 020989FC */ _t30 = cpu->r[10] + 0x00000001u;
         /* 020989FC */ cpu->r[6] = rbrew_read8(cpu->mem, _t30);
         /* 020989FC */ cpu->r[10] = _t30;
-        /* 02098A00 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[6]);
-        /* 02098A04 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098A00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[6]));
+        /* 02098A04 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098A04 */ _t32 = _t31 & 0x00000001u;
         /* 02098A04 */ if (_t32) goto L_02098A08; else goto L_02098A18;
   L_02098A08: ; // 0x2098a08
-        /* 02098A08 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[31]);
-        /* 02098A0C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098A08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[31]));
+        /* 02098A0C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098A0C */ _t34 = _t33 & 0x00000001u;
         /* 02098A0C */ if (_t34) goto L_02098AA8; else goto L_02098A10;
   L_02098A10: ; // 0x2098a10
@@ -14590,8 +14590,8 @@ void Gambit_fn_02098904(CPUState* cpu) {
         /* 02098A68 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02098A6C */ _t47 = cpu->r[1] + 0x00000028u;
         /* 02098A6C */ cpu->r[12] = rbrew_read32(cpu->mem, _t47);
-        /* 02098A70 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[24], cpu->r[12]);
-        /* 02098A74 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098A70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[24], cpu->r[12]));
+        /* 02098A74 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098A74 */ _t49 = _t48 & 0x00000001u;
         /* 02098A74 */ if (_t49) goto L_02098AA8; else goto L_02098A78;
   L_02098A78: ; // 0x2098a78
@@ -14605,13 +14605,13 @@ void Gambit_fn_02098904(CPUState* cpu) {
         /* 02098A88 */ _t52 = cpu->r[8] + 0x00000001u;
         /* 02098A88 */ cpu->r[6] = rbrew_read8(cpu->mem, _t52);
         /* 02098A88 */ cpu->r[8] = _t52;
-        /* 02098A8C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[6]);
-        /* 02098A90 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098A8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[6]));
+        /* 02098A90 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098A90 */ _t54 = _t53 & 0x00000001u;
         /* 02098A90 */ if (_t54) goto L_02098A94; else goto L_02098AA4;
   L_02098A94: ; // 0x2098a94
-        /* 02098A94 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[31]);
-        /* 02098A98 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098A94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[31]));
+        /* 02098A98 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098A98 */ _t56 = _t55 & 0x00000001u;
         /* 02098A98 */ if (_t56) goto L_02098AA8; else goto L_02098A9C;
   L_02098A9C: ; // 0x2098a9c
@@ -14624,8 +14624,8 @@ void Gambit_fn_02098904(CPUState* cpu) {
   L_02098AA4: ; // 0x2098aa4
         /* 02098AA4 */ cpu->r[25] = 0x00000000u;
   L_02098AA8: ; // 0x2098aa8
-        /* 02098AA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 02098AAC */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098AA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 02098AAC */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098AAC */ _t61 = _t60 & 0x00000001u;
         /* 02098AAC */ if (_t61) goto L_02098B20; else goto L_02098AB0;
   L_02098AB0: ; // 0x2098ab0
@@ -14634,8 +14634,8 @@ void Gambit_fn_02098904(CPUState* cpu) {
         /* 02098AB4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t62);
         /* 02098AB8 */ _t63 = cpu->r[11] + 0x00000238u;
         /* 02098AB8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t63);
-        /* 02098ABC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02098AC0 */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098ABC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02098AC0 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098AC0 */ _t65 = _t64 & 0x00000001u;
         /* 02098AC0 */ if (_t65) goto L_02098AC4; else goto L_02098AE8;
   L_02098AC4: ; // 0x2098ac4
@@ -14652,8 +14652,8 @@ void Gambit_fn_02098904(CPUState* cpu) {
         /* 02098AE0 */ Gambit_fn_027EDA78(cpu);
         /* 02098AE4 */ goto L_02098BF4;
   L_02098AE8: ; // 0x2098ae8
-        /* 02098AE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 02098AEC */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098AE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 02098AEC */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098AEC */ _t70 = _t69 & 0x00000001u;
         /* 02098AEC */ if (_t70) goto L_02098AF0; else goto L_02098B14;
   L_02098AF0: ; // 0x2098af0
@@ -14670,8 +14670,8 @@ void Gambit_fn_02098904(CPUState* cpu) {
         /* 02098B0C */ Gambit_fn_027EDA78(cpu);
         /* 02098B10 */ goto L_02098BF4;
   L_02098B14: ; // 0x2098b14
-        /* 02098B14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02098B18 */ _t74 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098B14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02098B18 */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098B18 */ _t75 = _t74 & 0x00000001u;
         /* 02098B18 */ if (_t75) goto L_02098B1C; else goto L_02098BD8;
   L_02098B1C: ; // 0x2098b1c
@@ -14708,8 +14708,8 @@ void Gambit_fn_02098904(CPUState* cpu) {
         /* 02098B6C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02098B70 */ _t85 = cpu->r[1] + 0x00000020u;
         /* 02098B70 */ cpu->r[0] = rbrew_read32(cpu->mem, _t85);
-        /* 02098B74 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 02098B78 */ _t86 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098B74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 02098B78 */ _t86 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098B78 */ _t87 = _t86 & 0x00000001u;
         /* 02098B78 */ if (_t87) goto L_02098BD0; else goto L_02098B7C;
   L_02098B7C: ; // 0x2098b7c
@@ -14727,13 +14727,13 @@ void Gambit_fn_02098904(CPUState* cpu) {
         /* 02098B94 */ _t92 = cpu->r[12] + 0x00000001u;
         /* 02098B94 */ cpu->r[9] = rbrew_read8(cpu->mem, _t92);
         /* 02098B94 */ cpu->r[12] = _t92;
-        /* 02098B98 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[9]);
-        /* 02098B9C */ _t93 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098B98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[9]));
+        /* 02098B9C */ _t93 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098B9C */ _t94 = _t93 & 0x00000001u;
         /* 02098B9C */ if (_t94) goto L_02098BA0; else goto L_02098BD8;
   L_02098BA0: ; // 0x2098ba0
-        /* 02098BA0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[11]);
-        /* 02098BA4 */ _t95 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098BA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[11]));
+        /* 02098BA4 */ _t95 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098BA4 */ _t96 = _t95 & 0x00000001u;
         /* 02098BA4 */ if (_t96) goto L_02098BD0; else goto L_02098BA8;
   L_02098BA8: ; // 0x2098ba8
@@ -14774,7 +14774,7 @@ void Gambit_fn_02098904(CPUState* cpu) {
         /* 02098BF8 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t105);
         /* 02098BFC */ _t106 = cpu->r[1] + 0x00000058u;
         /* 02098BFC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t106);
-        /* 02098C00 */ _t107 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02098C00 */ _t107 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02098C00 */ _t108 = _t107 & 0x00000001u;
         /* 02098C00 */ if (_t108) goto L_02098C04; // else: addr-0 trap, fall-through
   L_02098C04: ; // 0x2098c04
@@ -14897,15 +14897,15 @@ void Gambit_fn_02098C80(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02098C80: ; // 0x2098c80
-        /* 02098C80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02098C84 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098C80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02098C84 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098C84 */ _t1 = _t0 & 0x00000001u;
         /* 02098C84 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02098C84 */ goto L_02098C88;
   L_02098C88: ; // 0x2098c88
         /* 02098C88 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02098C88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02098C8C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098C88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02098C8C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098C8C */ _t3 = _t2 & 0x00000001u;
         /* 02098C8C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02098C8C */ goto L_02098C90;
@@ -14924,8 +14924,8 @@ void Gambit_fn_02098C80(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -14939,15 +14939,15 @@ void Gambit_fn_02098C80(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -14984,11 +14984,11 @@ void Gambit_fn_02098C94(CPUState* cpu) {
         /* 02098CA0 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02098CA0 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02098CA4 */ cpu->r[30] = cpu->r[3];
-        /* 02098CA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02098CA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02098CA8 */ cpu->r[31] = cpu->r[4];
         /* 02098CAC */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02098CAC */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02098CB0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098CB0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098CB0 */ _t5 = _t4 & 0x00000001u;
         /* 02098CB0 */ if (_t5) goto L_02098D20; else goto L_02098CB4;
   L_02098CB4: ; // 0x2098cb4
@@ -15002,10 +15002,10 @@ void Gambit_fn_02098C94(CPUState* cpu) {
         /* 02098CCC */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02098CCC */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02098CD0 */ cpu->r[11] = cpu->r[11] + 0xFFFFFD40u;
-        /* 02098CD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02098CD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02098CD8 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02098CD8 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02098CDC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098CDC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098CDC */ _t10 = _t9 & 0x00000001u;
         /* 02098CDC */ if (_t10) goto L_02098D10; else goto L_02098CE0;
   L_02098CE0: ; // 0x2098ce0
@@ -15026,8 +15026,8 @@ void Gambit_fn_02098C94(CPUState* cpu) {
         /* 02098D0C */ Gambit_fn_02068798(cpu);
   L_02098D10: ; // 0x2098d10
         /* 02098D10 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02098D10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02098D14 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098D10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02098D14 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098D14 */ _t15 = _t14 & 0x00000001u;
         /* 02098D14 */ if (_t15) goto L_02098D20; else goto L_02098D18;
   L_02098D18: ; // 0x2098d18
@@ -15058,11 +15058,11 @@ void Gambit_fn_02098C98(CPUState* cpu) {
         /* 02098CA0 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02098CA0 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02098CA4 */ cpu->r[30] = cpu->r[3];
-        /* 02098CA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02098CA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02098CA8 */ cpu->r[31] = cpu->r[4];
         /* 02098CAC */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02098CAC */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02098CB0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098CB0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098CB0 */ _t5 = _t4 & 0x00000001u;
         /* 02098CB0 */ if (_t5) goto L_02098D20; else goto L_02098CB4;
   L_02098CB4: ; // 0x2098cb4
@@ -15076,10 +15076,10 @@ void Gambit_fn_02098C98(CPUState* cpu) {
         /* 02098CCC */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02098CCC */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02098CD0 */ cpu->r[11] = cpu->r[11] + 0xFFFFFD40u;
-        /* 02098CD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02098CD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02098CD8 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02098CD8 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02098CDC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098CDC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098CDC */ _t10 = _t9 & 0x00000001u;
         /* 02098CDC */ if (_t10) goto L_02098D10; else goto L_02098CE0;
   L_02098CE0: ; // 0x2098ce0
@@ -15100,8 +15100,8 @@ void Gambit_fn_02098C98(CPUState* cpu) {
         /* 02098D0C */ Gambit_fn_02068798(cpu);
   L_02098D10: ; // 0x2098d10
         /* 02098D10 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02098D10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02098D14 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098D10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02098D14 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098D14 */ _t15 = _t14 & 0x00000001u;
         /* 02098D14 */ if (_t15) goto L_02098D20; else goto L_02098D18;
   L_02098D18: ; // 0x2098d18
@@ -15234,9 +15234,9 @@ void Gambit_fn_02098D90(CPUState* cpu) {
         /* 02098D94 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 02098D94 */ cpu->r[9] = _t0;
         /* 02098D98 */ cpu->r[12] = 0x101D0000u;
-        /* 02098D9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02098D9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02098DA0 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 02098DA4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098DA4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098DA4 */ _t2 = _t1 & 0x00000001u;
         /* 02098DA4 */ if (_t2) goto L_02098DA8; else goto L_02098DBC;
   L_02098DA8: ; // 0x2098da8
@@ -15248,8 +15248,8 @@ void Gambit_fn_02098D90(CPUState* cpu) {
         /* 02098DB8 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 02098DB8 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_02098DBC: ; // 0x2098dbc
-        /* 02098DBC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02098DC0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098DBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02098DC0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098DC0 */ _t6 = _t5 & 0x00000001u;
         /* 02098DC0 */ if (_t6) goto L_02098DC4; else goto L_02098DCC;
   L_02098DC4: ; // 0x2098dc4
@@ -15261,9 +15261,9 @@ void Gambit_fn_02098D90(CPUState* cpu) {
         /* 02098DD0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 02098DD0 */ cpu->r[7] = _t7;
         /* 02098DD4 */ cpu->r[11] = 0x101D0000u;
-        /* 02098DD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02098DD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02098DDC */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 02098DE0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098DE0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098DE0 */ _t9 = _t8 & 0x00000001u;
         /* 02098DE0 */ if (_t9) goto L_02098DE4; else goto L_02098DF8;
   L_02098DE4: ; // 0x2098de4
@@ -15384,18 +15384,18 @@ void Gambit_fn_02098E48(CPUState* cpu) {
         /* 02008980 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02008980 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02008984 */ cpu->r[12] = 0x00000000u;
-        /* 02008988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02008988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0200898C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0200898C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02008990 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02008990 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02008990 */ _t6 = _t5 & 0x00000001u;
         /* 02008990 */ if (_t6) goto L_020089B8; else goto L_02008994;
   L_02008994: ; // 0x2008994
         /* 02008994 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02008994 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02008998 */ /* nop */
-        /* 0200899C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 020089A0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0200899C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 020089A0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020089A0 */ _t9 = _t8 & 0x00000001u;
         /* 020089A0 */ if (_t9) goto L_020089A4; else goto L_020089B8;
   L_020089A4: ; // 0x20089a4
@@ -15446,11 +15446,11 @@ void Gambit_fn_02098E54(CPUState* cpu) {
         /* 02098FEC */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02098FEC */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02098FF0 */ cpu->r[30] = cpu->r[3];
-        /* 02098FF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02098FF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02098FF4 */ cpu->r[31] = cpu->r[4];
         /* 02098FF8 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02098FF8 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02098FFC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098FFC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098FFC */ _t5 = _t4 & 0x00000001u;
         /* 02098FFC */ if (_t5) goto L_0209906C; else goto L_02099000;
   L_02099000: ; // 0x2099000
@@ -15464,10 +15464,10 @@ void Gambit_fn_02098E54(CPUState* cpu) {
         /* 02099018 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02099018 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0209901C */ cpu->r[11] = cpu->r[11] + 0xFFFFFFECu;
-        /* 02099020 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02099020 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02099024 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02099024 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02099028 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099028 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099028 */ _t10 = _t9 & 0x00000001u;
         /* 02099028 */ if (_t10) goto L_0209905C; else goto L_0209902C;
   L_0209902C: ; // 0x209902c
@@ -15488,8 +15488,8 @@ void Gambit_fn_02098E54(CPUState* cpu) {
         /* 02099058 */ Gambit_fn_02068798(cpu);
   L_0209905C: ; // 0x209905c
         /* 0209905C */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209905C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02099060 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209905C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02099060 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099060 */ _t15 = _t14 & 0x00000001u;
         /* 02099060 */ if (_t15) goto L_0209906C; else goto L_02099064;
   L_02099064: ; // 0x2099064
@@ -15517,8 +15517,8 @@ void Gambit_fn_02098E5C(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -15569,18 +15569,18 @@ void Gambit_fn_02098E74(CPUState* cpu) {
         /* 02098E7C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 02098E7C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02098E80 */ cpu->r[31] = cpu->r[3];
-        /* 02098E80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02098E80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02098E84 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02098E84 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 02098E88 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098E88 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098E88 */ _t4 = _t3 & 0x00000001u;
         /* 02098E88 */ if (_t4) goto L_02098E8C; else goto L_02098E9C;
   L_02098E8C: ; // 0x2098e8c
         /* 02098E8C */ cpu->r[3] = 0x00000224u;
         /* 02098E90 */ Gambit_fn_02801A78(cpu);
         /* 02098E94 */ cpu->r[31] = cpu->r[3];
-        /* 02098E94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02098E98 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098E94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02098E98 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098E98 */ _t6 = _t5 & 0x00000001u;
         /* 02098E98 */ if (_t6) goto L_02098F08; else goto L_02098E9C;
   L_02098E9C: ; // 0x2098e9c
@@ -15644,18 +15644,18 @@ void Gambit_fn_02098E78(CPUState* cpu) {
         /* 02098E7C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 02098E7C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02098E80 */ cpu->r[31] = cpu->r[3];
-        /* 02098E80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02098E80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02098E84 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02098E84 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 02098E88 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098E88 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098E88 */ _t4 = _t3 & 0x00000001u;
         /* 02098E88 */ if (_t4) goto L_02098E8C; else goto L_02098E9C;
   L_02098E8C: ; // 0x2098e8c
         /* 02098E8C */ cpu->r[3] = 0x00000224u;
         /* 02098E90 */ Gambit_fn_02801A78(cpu);
         /* 02098E94 */ cpu->r[31] = cpu->r[3];
-        /* 02098E94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02098E98 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098E94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02098E98 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098E98 */ _t6 = _t5 & 0x00000001u;
         /* 02098E98 */ if (_t6) goto L_02098F08; else goto L_02098E9C;
   L_02098E9C: ; // 0x2098e9c
@@ -15743,9 +15743,9 @@ void Gambit_fn_02098F38(CPUState* cpu) {
         /* 02098F4C */ _t4 = cpu->r[3] + 0x0000021Cu;
         /* 02098F4C */ cpu->r[11] = rbrew_read32(cpu->mem, _t4);
         /* 02098F50 */ cpu->r[31] = cpu->r[4];
-        /* 02098F54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02098F54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02098F58 */ cpu->r[30] = cpu->r[3] + 0x0000021Cu;
-        /* 02098F5C */ _t5 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02098F5C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02098F5C */ _t6 = _t5 & 0x00000001u;
         /* 02098F5C */ if (_t6) goto L_02098F6C; else goto L_02098F60;
   L_02098F60: ; // 0x2098f60
@@ -15756,9 +15756,9 @@ void Gambit_fn_02098F38(CPUState* cpu) {
   L_02098F6C: ; // 0x2098f6c
         /* 02098F6C */ _t8 = cpu->r[30] + 0x00000004u;
         /* 02098F6C */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
-        /* 02098F70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02098F70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02098F74 */ cpu->r[12] = cpu->r[30] + 0x00000004u;
-        /* 02098F78 */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02098F78 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02098F78 */ _t10 = _t9 & 0x00000001u;
         /* 02098F78 */ if (_t10) goto L_02098F88; else goto L_02098F7C;
   L_02098F7C: ; // 0x2098f7c
@@ -15795,9 +15795,9 @@ void Gambit_fn_02098F3C(CPUState* cpu) {
         /* 02098F4C */ _t4 = cpu->r[3] + 0x0000021Cu;
         /* 02098F4C */ cpu->r[11] = rbrew_read32(cpu->mem, _t4);
         /* 02098F50 */ cpu->r[31] = cpu->r[4];
-        /* 02098F54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02098F54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02098F58 */ cpu->r[30] = cpu->r[3] + 0x0000021Cu;
-        /* 02098F5C */ _t5 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02098F5C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02098F5C */ _t6 = _t5 & 0x00000001u;
         /* 02098F5C */ if (_t6) goto L_02098F6C; else goto L_02098F60;
   L_02098F60: ; // 0x2098f60
@@ -15808,9 +15808,9 @@ void Gambit_fn_02098F3C(CPUState* cpu) {
   L_02098F6C: ; // 0x2098f6c
         /* 02098F6C */ _t8 = cpu->r[30] + 0x00000004u;
         /* 02098F6C */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
-        /* 02098F70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02098F70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02098F74 */ cpu->r[12] = cpu->r[30] + 0x00000004u;
-        /* 02098F78 */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02098F78 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02098F78 */ _t10 = _t9 & 0x00000001u;
         /* 02098F78 */ if (_t10) goto L_02098F88; else goto L_02098F7C;
   L_02098F7C: ; // 0x2098f7c
@@ -15901,9 +15901,9 @@ void Gambit_fn_02098FD8(CPUState* cpu) {
         /* 02098F4C */ _t4 = cpu->r[3] + 0x0000021Cu;
         /* 02098F4C */ cpu->r[11] = rbrew_read32(cpu->mem, _t4);
         /* 02098F50 */ cpu->r[31] = cpu->r[4];
-        /* 02098F54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02098F54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02098F58 */ cpu->r[30] = cpu->r[3] + 0x0000021Cu;
-        /* 02098F5C */ _t5 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02098F5C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02098F5C */ _t6 = _t5 & 0x00000001u;
         /* 02098F5C */ if (_t6) goto L_02098F6C; else goto L_02098F60;
   L_02098F60: ; // 0x2098f60
@@ -15914,9 +15914,9 @@ void Gambit_fn_02098FD8(CPUState* cpu) {
   L_02098F6C: ; // 0x2098f6c
         /* 02098F6C */ _t8 = cpu->r[30] + 0x00000004u;
         /* 02098F6C */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
-        /* 02098F70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02098F70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02098F74 */ cpu->r[12] = cpu->r[30] + 0x00000004u;
-        /* 02098F78 */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02098F78 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02098F78 */ _t10 = _t9 & 0x00000001u;
         /* 02098F78 */ if (_t10) goto L_02098F88; else goto L_02098F7C;
   L_02098F7C: ; // 0x2098f7c
@@ -15953,11 +15953,11 @@ void Gambit_fn_02098FE0(CPUState* cpu) {
         /* 02098FEC */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02098FEC */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02098FF0 */ cpu->r[30] = cpu->r[3];
-        /* 02098FF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02098FF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02098FF4 */ cpu->r[31] = cpu->r[4];
         /* 02098FF8 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02098FF8 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02098FFC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098FFC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098FFC */ _t5 = _t4 & 0x00000001u;
         /* 02098FFC */ if (_t5) goto L_0209906C; else goto L_02099000;
   L_02099000: ; // 0x2099000
@@ -15971,10 +15971,10 @@ void Gambit_fn_02098FE0(CPUState* cpu) {
         /* 02099018 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02099018 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0209901C */ cpu->r[11] = cpu->r[11] + 0xFFFFFFECu;
-        /* 02099020 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02099020 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02099024 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02099024 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02099028 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099028 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099028 */ _t10 = _t9 & 0x00000001u;
         /* 02099028 */ if (_t10) goto L_0209905C; else goto L_0209902C;
   L_0209902C: ; // 0x209902c
@@ -15995,8 +15995,8 @@ void Gambit_fn_02098FE0(CPUState* cpu) {
         /* 02099058 */ Gambit_fn_02068798(cpu);
   L_0209905C: ; // 0x209905c
         /* 0209905C */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209905C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02099060 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209905C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02099060 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099060 */ _t15 = _t14 & 0x00000001u;
         /* 02099060 */ if (_t15) goto L_0209906C; else goto L_02099064;
   L_02099064: ; // 0x2099064
@@ -16027,11 +16027,11 @@ void Gambit_fn_02098FE4(CPUState* cpu) {
         /* 02098FEC */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02098FEC */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02098FF0 */ cpu->r[30] = cpu->r[3];
-        /* 02098FF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02098FF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02098FF4 */ cpu->r[31] = cpu->r[4];
         /* 02098FF8 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02098FF8 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02098FFC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02098FFC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02098FFC */ _t5 = _t4 & 0x00000001u;
         /* 02098FFC */ if (_t5) goto L_0209906C; else goto L_02099000;
   L_02099000: ; // 0x2099000
@@ -16045,10 +16045,10 @@ void Gambit_fn_02098FE4(CPUState* cpu) {
         /* 02099018 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02099018 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0209901C */ cpu->r[11] = cpu->r[11] + 0xFFFFFFECu;
-        /* 02099020 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02099020 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02099024 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02099024 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02099028 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099028 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099028 */ _t10 = _t9 & 0x00000001u;
         /* 02099028 */ if (_t10) goto L_0209905C; else goto L_0209902C;
   L_0209902C: ; // 0x209902c
@@ -16069,8 +16069,8 @@ void Gambit_fn_02098FE4(CPUState* cpu) {
         /* 02099058 */ Gambit_fn_02068798(cpu);
   L_0209905C: ; // 0x209905c
         /* 0209905C */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209905C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02099060 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209905C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02099060 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099060 */ _t15 = _t14 & 0x00000001u;
         /* 02099060 */ if (_t15) goto L_0209906C; else goto L_02099064;
   L_02099064: ; // 0x2099064
@@ -16197,9 +16197,9 @@ void Gambit_fn_020990D8(CPUState* cpu) {
         /* 020990DC */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 020990DC */ cpu->r[9] = _t0;
         /* 020990E0 */ cpu->r[12] = 0x101D0000u;
-        /* 020990E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 020990E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 020990E8 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 020990EC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020990EC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020990EC */ _t2 = _t1 & 0x00000001u;
         /* 020990EC */ if (_t2) goto L_020990F0; else goto L_02099104;
   L_020990F0: ; // 0x20990f0
@@ -16211,8 +16211,8 @@ void Gambit_fn_020990D8(CPUState* cpu) {
         /* 02099100 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 02099100 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_02099104: ; // 0x2099104
-        /* 02099104 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02099108 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099104 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02099108 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099108 */ _t6 = _t5 & 0x00000001u;
         /* 02099108 */ if (_t6) goto L_0209910C; else goto L_02099114;
   L_0209910C: ; // 0x209910c
@@ -16224,9 +16224,9 @@ void Gambit_fn_020990D8(CPUState* cpu) {
         /* 02099118 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 02099118 */ cpu->r[7] = _t7;
         /* 0209911C */ cpu->r[11] = 0x101D0000u;
-        /* 02099120 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02099120 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02099124 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 02099128 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099128 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099128 */ _t9 = _t8 & 0x00000001u;
         /* 02099128 */ if (_t9) goto L_0209912C; else goto L_02099140;
   L_0209912C: ; // 0x209912c
@@ -16353,18 +16353,18 @@ void Gambit_fn_02099194(CPUState* cpu) {
         /* 02008980 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02008980 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02008984 */ cpu->r[12] = 0x00000000u;
-        /* 02008988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02008988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0200898C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0200898C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02008990 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02008990 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02008990 */ _t6 = _t5 & 0x00000001u;
         /* 02008990 */ if (_t6) goto L_020089B8; else goto L_02008994;
   L_02008994: ; // 0x2008994
         /* 02008994 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02008994 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02008998 */ /* nop */
-        /* 0200899C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 020089A0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0200899C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 020089A0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020089A0 */ _t9 = _t8 & 0x00000001u;
         /* 020089A0 */ if (_t9) goto L_020089A4; else goto L_020089B8;
   L_020089A4: ; // 0x20089a4
@@ -16409,11 +16409,11 @@ void Gambit_fn_0209919C(CPUState* cpu) {
         /* 020993FC */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020993FC */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02099400 */ cpu->r[30] = cpu->r[3];
-        /* 02099400 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02099400 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02099404 */ cpu->r[31] = cpu->r[4];
         /* 02099408 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02099408 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209940C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209940C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209940C */ _t5 = _t4 & 0x00000001u;
         /* 0209940C */ if (_t5) goto L_0209947C; else goto L_02099410;
   L_02099410: ; // 0x2099410
@@ -16427,10 +16427,10 @@ void Gambit_fn_0209919C(CPUState* cpu) {
         /* 02099428 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02099428 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0209942C */ cpu->r[11] = cpu->r[11] + 0x000002BCu;
-        /* 02099430 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02099430 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02099434 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02099434 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02099438 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099438 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099438 */ _t10 = _t9 & 0x00000001u;
         /* 02099438 */ if (_t10) goto L_0209946C; else goto L_0209943C;
   L_0209943C: ; // 0x209943c
@@ -16451,8 +16451,8 @@ void Gambit_fn_0209919C(CPUState* cpu) {
         /* 02099468 */ Gambit_fn_02068798(cpu);
   L_0209946C: ; // 0x209946c
         /* 0209946C */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209946C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02099470 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209946C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02099470 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099470 */ _t15 = _t14 & 0x00000001u;
         /* 02099470 */ if (_t15) goto L_0209947C; else goto L_02099474;
   L_02099474: ; // 0x2099474
@@ -16480,8 +16480,8 @@ void Gambit_fn_020991A4(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -16534,19 +16534,19 @@ void Gambit_fn_020991BC(CPUState* cpu) {
         /* 020991C8 */ _t2 = cpu->r[1] + 0x0000000Cu;
         /* 020991C8 */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
         /* 020991CC */ cpu->r[31] = cpu->r[3];
-        /* 020991CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020991CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020991D0 */ cpu->r[30] = cpu->r[4];
         /* 020991D4 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020991D4 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020991D8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020991D8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020991D8 */ _t5 = _t4 & 0x00000001u;
         /* 020991D8 */ if (_t5) goto L_020991DC; else goto L_020991EC;
   L_020991DC: ; // 0x20991dc
         /* 020991DC */ cpu->r[3] = 0x00000220u;
         /* 020991E0 */ Gambit_fn_02801A78(cpu);
         /* 020991E4 */ cpu->r[31] = cpu->r[3];
-        /* 020991E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020991E8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020991E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020991E8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020991E8 */ _t7 = _t6 & 0x00000001u;
         /* 020991E8 */ if (_t7) goto L_02099238; else goto L_020991EC;
   L_020991EC: ; // 0x20991ec
@@ -16601,19 +16601,19 @@ void Gambit_fn_020991C0(CPUState* cpu) {
         /* 020991C8 */ _t2 = cpu->r[1] + 0x0000000Cu;
         /* 020991C8 */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
         /* 020991CC */ cpu->r[31] = cpu->r[3];
-        /* 020991CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020991CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020991D0 */ cpu->r[30] = cpu->r[4];
         /* 020991D4 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020991D4 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020991D8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020991D8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020991D8 */ _t5 = _t4 & 0x00000001u;
         /* 020991D8 */ if (_t5) goto L_020991DC; else goto L_020991EC;
   L_020991DC: ; // 0x20991dc
         /* 020991DC */ cpu->r[3] = 0x00000220u;
         /* 020991E0 */ Gambit_fn_02801A78(cpu);
         /* 020991E4 */ cpu->r[31] = cpu->r[3];
-        /* 020991E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020991E8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020991E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020991E8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020991E8 */ _t7 = _t6 & 0x00000001u;
         /* 020991E8 */ if (_t7) goto L_02099238; else goto L_020991EC;
   L_020991EC: ; // 0x20991ec
@@ -16663,8 +16663,8 @@ void Gambit_fn_02099254(CPUState* cpu) {
         /* 02099254 */ _t0 = cpu->r[3] + 0x00000118u;
         /* 02099254 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02099258 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 02099258 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209925C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099258 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209925C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209925C */ _t2 = _t1 & 0x00000001u;
         /* 0209925C */ if (_t2) goto L_02099260; else goto L_02099268;
   L_02099260: ; // 0x2099260
@@ -16767,8 +16767,8 @@ void Gambit_fn_0209930C(CPUState* cpu) {
   L_0209930C: ; // 0x209930c
         /* 0209930C */ _t5 = cpu->r[3] + 0x0000021Cu;
         /* 0209930C */ cpu->r[0] = rbrew_read8(cpu->mem, _t5);
-        /* 02099310 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02099314 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099310 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02099314 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099314 */ _t7 = _t6 & 0x00000001u;
         /* 02099314 */ if (_t7) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02099314 */ goto L_02099318;
@@ -16808,9 +16808,9 @@ void Gambit_fn_0209931C(CPUState* cpu) {
         /* 02099358 */ cpu->r[11] = _t6;
         /* 0209935C */ cpu->r[31] = cpu->r[3];
         /* 02099360 */ cpu->r[4] = 0x101D0000u;
-        /* 02099364 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02099364 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02099368 */ cpu->r[4] = cpu->r[4] + 0xFFFFEE20u;
-        /* 0209936C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209936C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209936C */ _t8 = _t7 & 0x00000001u;
         /* 0209936C */ if (_t8) goto L_02099370; else goto L_02099384;
   L_02099370: ; // 0x2099370
@@ -16822,8 +16822,8 @@ void Gambit_fn_0209931C(CPUState* cpu) {
         /* 02099380 */ _t10 = cpu->r[4] + 0x00000000u;
         /* 02099380 */ rbrew_write32(cpu->mem, _t10, cpu->r[8]);
   L_02099384: ; // 0x2099384
-        /* 02099384 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02099388 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099384 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02099388 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099388 */ _t12 = _t11 & 0x00000001u;
         /* 02099388 */ if (_t12) goto L_020993A8; else goto L_0209938C;
   L_0209938C: ; // 0x209938c
@@ -16834,8 +16834,8 @@ void Gambit_fn_0209931C(CPUState* cpu) {
         /* 02099394 */ cpu->ctr = cpu->r[0];
         /* 02099398 */ cpu->r[3] = cpu->r[31];
         /* 0209939C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020993A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020993A4 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020993A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020993A4 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020993A4 */ _t16 = _t15 & 0x00000001u;
         /* 020993A4 */ if (_t16) goto L_020993A8; else goto L_020993AC;
   L_020993A8: ; // 0x20993a8
@@ -16892,9 +16892,9 @@ void Gambit_fn_02099320(CPUState* cpu) {
         /* 02099358 */ cpu->r[11] = _t6;
         /* 0209935C */ cpu->r[31] = cpu->r[3];
         /* 02099360 */ cpu->r[4] = 0x101D0000u;
-        /* 02099364 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02099364 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02099368 */ cpu->r[4] = cpu->r[4] + 0xFFFFEE20u;
-        /* 0209936C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209936C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209936C */ _t8 = _t7 & 0x00000001u;
         /* 0209936C */ if (_t8) goto L_02099370; else goto L_02099384;
   L_02099370: ; // 0x2099370
@@ -16906,8 +16906,8 @@ void Gambit_fn_02099320(CPUState* cpu) {
         /* 02099380 */ _t10 = cpu->r[4] + 0x00000000u;
         /* 02099380 */ rbrew_write32(cpu->mem, _t10, cpu->r[8]);
   L_02099384: ; // 0x2099384
-        /* 02099384 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02099388 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099384 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02099388 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099388 */ _t12 = _t11 & 0x00000001u;
         /* 02099388 */ if (_t12) goto L_020993A8; else goto L_0209938C;
   L_0209938C: ; // 0x209938c
@@ -16918,8 +16918,8 @@ void Gambit_fn_02099320(CPUState* cpu) {
         /* 02099394 */ cpu->ctr = cpu->r[0];
         /* 02099398 */ cpu->r[3] = cpu->r[31];
         /* 0209939C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020993A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020993A4 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020993A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020993A4 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020993A4 */ _t16 = _t15 & 0x00000001u;
         /* 020993A4 */ if (_t16) goto L_020993A8; else goto L_020993AC;
   L_020993A8: ; // 0x20993a8
@@ -16950,15 +16950,15 @@ void Gambit_fn_020993DC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020993DC: ; // 0x20993dc
-        /* 020993DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020993E0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020993DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020993E0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020993E0 */ _t1 = _t0 & 0x00000001u;
         /* 020993E0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020993E0 */ goto L_020993E4;
   L_020993E4: ; // 0x20993e4
         /* 020993E4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020993E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020993E8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020993E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020993E8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020993E8 */ _t3 = _t2 & 0x00000001u;
         /* 020993E8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020993E8 */ goto L_020993EC;
@@ -16977,8 +16977,8 @@ void Gambit_fn_020993DC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -16992,15 +16992,15 @@ void Gambit_fn_020993DC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -17037,11 +17037,11 @@ void Gambit_fn_020993F0(CPUState* cpu) {
         /* 020993FC */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020993FC */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02099400 */ cpu->r[30] = cpu->r[3];
-        /* 02099400 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02099400 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02099404 */ cpu->r[31] = cpu->r[4];
         /* 02099408 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02099408 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209940C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209940C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209940C */ _t5 = _t4 & 0x00000001u;
         /* 0209940C */ if (_t5) goto L_0209947C; else goto L_02099410;
   L_02099410: ; // 0x2099410
@@ -17055,10 +17055,10 @@ void Gambit_fn_020993F0(CPUState* cpu) {
         /* 02099428 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02099428 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0209942C */ cpu->r[11] = cpu->r[11] + 0x000002BCu;
-        /* 02099430 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02099430 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02099434 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02099434 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02099438 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099438 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099438 */ _t10 = _t9 & 0x00000001u;
         /* 02099438 */ if (_t10) goto L_0209946C; else goto L_0209943C;
   L_0209943C: ; // 0x209943c
@@ -17079,8 +17079,8 @@ void Gambit_fn_020993F0(CPUState* cpu) {
         /* 02099468 */ Gambit_fn_02068798(cpu);
   L_0209946C: ; // 0x209946c
         /* 0209946C */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209946C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02099470 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209946C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02099470 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099470 */ _t15 = _t14 & 0x00000001u;
         /* 02099470 */ if (_t15) goto L_0209947C; else goto L_02099474;
   L_02099474: ; // 0x2099474
@@ -17111,11 +17111,11 @@ void Gambit_fn_020993F4(CPUState* cpu) {
         /* 020993FC */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020993FC */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02099400 */ cpu->r[30] = cpu->r[3];
-        /* 02099400 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02099400 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02099404 */ cpu->r[31] = cpu->r[4];
         /* 02099408 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02099408 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209940C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209940C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209940C */ _t5 = _t4 & 0x00000001u;
         /* 0209940C */ if (_t5) goto L_0209947C; else goto L_02099410;
   L_02099410: ; // 0x2099410
@@ -17129,10 +17129,10 @@ void Gambit_fn_020993F4(CPUState* cpu) {
         /* 02099428 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 02099428 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0209942C */ cpu->r[11] = cpu->r[11] + 0x000002BCu;
-        /* 02099430 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02099430 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02099434 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02099434 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 02099438 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099438 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099438 */ _t10 = _t9 & 0x00000001u;
         /* 02099438 */ if (_t10) goto L_0209946C; else goto L_0209943C;
   L_0209943C: ; // 0x209943c
@@ -17153,8 +17153,8 @@ void Gambit_fn_020993F4(CPUState* cpu) {
         /* 02099468 */ Gambit_fn_02068798(cpu);
   L_0209946C: ; // 0x209946c
         /* 0209946C */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209946C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02099470 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209946C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02099470 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099470 */ _t15 = _t14 & 0x00000001u;
         /* 02099470 */ if (_t15) goto L_0209947C; else goto L_02099474;
   L_02099474: ; // 0x2099474
@@ -17287,9 +17287,9 @@ void Gambit_fn_020994EC(CPUState* cpu) {
         /* 020994F0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 020994F0 */ cpu->r[9] = _t0;
         /* 020994F4 */ cpu->r[12] = 0x101D0000u;
-        /* 020994F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 020994F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 020994FC */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 02099500 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099500 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099500 */ _t2 = _t1 & 0x00000001u;
         /* 02099500 */ if (_t2) goto L_02099504; else goto L_02099518;
   L_02099504: ; // 0x2099504
@@ -17301,8 +17301,8 @@ void Gambit_fn_020994EC(CPUState* cpu) {
         /* 02099514 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 02099514 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_02099518: ; // 0x2099518
-        /* 02099518 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0209951C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099518 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0209951C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209951C */ _t6 = _t5 & 0x00000001u;
         /* 0209951C */ if (_t6) goto L_02099520; else goto L_02099528;
   L_02099520: ; // 0x2099520
@@ -17314,9 +17314,9 @@ void Gambit_fn_020994EC(CPUState* cpu) {
         /* 0209952C */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 0209952C */ cpu->r[7] = _t7;
         /* 02099530 */ cpu->r[11] = 0x101D0000u;
-        /* 02099534 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02099534 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02099538 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 0209953C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209953C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209953C */ _t9 = _t8 & 0x00000001u;
         /* 0209953C */ if (_t9) goto L_02099540; else goto L_02099554;
   L_02099540: ; // 0x2099540
@@ -17431,18 +17431,18 @@ void Gambit_fn_020995A0(CPUState* cpu) {
         /* 0208A0DC */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0208A0DC */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0208A0E0 */ cpu->r[12] = 0x00000000u;
-        /* 0208A0E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208A0E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208A0E8 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0208A0E8 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0208A0EC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A0EC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A0EC */ _t6 = _t5 & 0x00000001u;
         /* 0208A0EC */ if (_t6) goto L_0208A114; else goto L_0208A0F0;
   L_0208A0F0: ; // 0x208a0f0
         /* 0208A0F0 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0208A0F0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0208A0F4 */ /* nop */
-        /* 0208A0F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0208A0FC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A0F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0208A0FC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A0FC */ _t9 = _t8 & 0x00000001u;
         /* 0208A0FC */ if (_t9) goto L_0208A100; else goto L_0208A114;
   L_0208A100: ; // 0x208a100
@@ -17487,11 +17487,11 @@ void Gambit_fn_020995A8(CPUState* cpu) {
         /* 02099740 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02099740 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02099744 */ cpu->r[30] = cpu->r[3];
-        /* 02099744 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02099744 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02099748 */ cpu->r[31] = cpu->r[4];
         /* 0209974C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209974C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02099750 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099750 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099750 */ _t5 = _t4 & 0x00000001u;
         /* 02099750 */ if (_t5) goto L_020997C0; else goto L_02099754;
   L_02099754: ; // 0x2099754
@@ -17505,10 +17505,10 @@ void Gambit_fn_020995A8(CPUState* cpu) {
         /* 0209976C */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0209976C */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02099770 */ cpu->r[11] = cpu->r[11] + 0x00000590u;
-        /* 02099774 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02099774 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02099778 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02099778 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0209977C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209977C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209977C */ _t10 = _t9 & 0x00000001u;
         /* 0209977C */ if (_t10) goto L_020997B0; else goto L_02099780;
   L_02099780: ; // 0x2099780
@@ -17529,8 +17529,8 @@ void Gambit_fn_020995A8(CPUState* cpu) {
         /* 020997AC */ Gambit_fn_02068798(cpu);
   L_020997B0: ; // 0x20997b0
         /* 020997B0 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020997B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020997B4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020997B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020997B4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020997B4 */ _t15 = _t14 & 0x00000001u;
         /* 020997B4 */ if (_t15) goto L_020997C0; else goto L_020997B8;
   L_020997B8: ; // 0x20997b8
@@ -17558,8 +17558,8 @@ void Gambit_fn_020995B0(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -17610,18 +17610,18 @@ void Gambit_fn_020995C8(CPUState* cpu) {
         /* 020995D0 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 020995D0 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 020995D4 */ cpu->r[31] = cpu->r[3];
-        /* 020995D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020995D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020995D8 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 020995D8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 020995DC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020995DC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020995DC */ _t4 = _t3 & 0x00000001u;
         /* 020995DC */ if (_t4) goto L_020995E0; else goto L_020995F0;
   L_020995E0: ; // 0x20995e0
         /* 020995E0 */ cpu->r[3] = 0x00000220u;
         /* 020995E4 */ Gambit_fn_02801A78(cpu);
         /* 020995E8 */ cpu->r[31] = cpu->r[3];
-        /* 020995E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020995EC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020995E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020995EC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020995EC */ _t6 = _t5 & 0x00000001u;
         /* 020995EC */ if (_t6) goto L_02099640; else goto L_020995F0;
   L_020995F0: ; // 0x20995f0
@@ -17672,18 +17672,18 @@ void Gambit_fn_020995CC(CPUState* cpu) {
         /* 020995D0 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 020995D0 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 020995D4 */ cpu->r[31] = cpu->r[3];
-        /* 020995D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020995D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020995D8 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 020995D8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 020995DC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020995DC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020995DC */ _t4 = _t3 & 0x00000001u;
         /* 020995DC */ if (_t4) goto L_020995E0; else goto L_020995F0;
   L_020995E0: ; // 0x20995e0
         /* 020995E0 */ cpu->r[3] = 0x00000220u;
         /* 020995E4 */ Gambit_fn_02801A78(cpu);
         /* 020995E8 */ cpu->r[31] = cpu->r[3];
-        /* 020995E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020995EC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020995E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020995EC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020995EC */ _t6 = _t5 & 0x00000001u;
         /* 020995EC */ if (_t6) goto L_02099640; else goto L_020995F0;
   L_020995F0: ; // 0x20995f0
@@ -17755,9 +17755,9 @@ void Gambit_fn_02099674(CPUState* cpu) {
         /* 020996B0 */ cpu->r[11] = _t6;
         /* 020996B4 */ cpu->r[4] = 0x101D0000u;
         /* 020996B8 */ cpu->r[31] = cpu->r[3];
-        /* 020996BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020996BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020996C0 */ cpu->r[4] = cpu->r[4] + 0xFFFFED90u;
-        /* 020996C4 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020996C4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020996C4 */ _t8 = _t7 & 0x00000001u;
         /* 020996C4 */ if (_t8) goto L_020996C8; else goto L_020996DC;
   L_020996C8: ; // 0x20996c8
@@ -17769,8 +17769,8 @@ void Gambit_fn_02099674(CPUState* cpu) {
         /* 020996D8 */ _t10 = cpu->r[4] + 0x00000000u;
         /* 020996D8 */ rbrew_write32(cpu->mem, _t10, cpu->r[8]);
   L_020996DC: ; // 0x20996dc
-        /* 020996DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020996E0 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020996DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020996E0 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020996E0 */ _t12 = _t11 & 0x00000001u;
         /* 020996E0 */ if (_t12) goto L_02099700; else goto L_020996E4;
   L_020996E4: ; // 0x20996e4
@@ -17781,8 +17781,8 @@ void Gambit_fn_02099674(CPUState* cpu) {
         /* 020996EC */ cpu->ctr = cpu->r[0];
         /* 020996F0 */ cpu->r[3] = cpu->r[31];
         /* 020996F4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020996F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020996FC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020996F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020996FC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020996FC */ _t16 = _t15 & 0x00000001u;
         /* 020996FC */ if (_t16) goto L_02099700; else goto L_02099704;
   L_02099700: ; // 0x2099700
@@ -17832,9 +17832,9 @@ void Gambit_fn_02099678(CPUState* cpu) {
         /* 020996B0 */ cpu->r[11] = _t6;
         /* 020996B4 */ cpu->r[4] = 0x101D0000u;
         /* 020996B8 */ cpu->r[31] = cpu->r[3];
-        /* 020996BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020996BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020996C0 */ cpu->r[4] = cpu->r[4] + 0xFFFFED90u;
-        /* 020996C4 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020996C4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020996C4 */ _t8 = _t7 & 0x00000001u;
         /* 020996C4 */ if (_t8) goto L_020996C8; else goto L_020996DC;
   L_020996C8: ; // 0x20996c8
@@ -17846,8 +17846,8 @@ void Gambit_fn_02099678(CPUState* cpu) {
         /* 020996D8 */ _t10 = cpu->r[4] + 0x00000000u;
         /* 020996D8 */ rbrew_write32(cpu->mem, _t10, cpu->r[8]);
   L_020996DC: ; // 0x20996dc
-        /* 020996DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020996E0 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020996DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020996E0 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020996E0 */ _t12 = _t11 & 0x00000001u;
         /* 020996E0 */ if (_t12) goto L_02099700; else goto L_020996E4;
   L_020996E4: ; // 0x20996e4
@@ -17858,8 +17858,8 @@ void Gambit_fn_02099678(CPUState* cpu) {
         /* 020996EC */ cpu->ctr = cpu->r[0];
         /* 020996F0 */ cpu->r[3] = cpu->r[31];
         /* 020996F4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020996F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020996FC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020996F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020996FC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020996FC */ _t16 = _t15 & 0x00000001u;
         /* 020996FC */ if (_t16) goto L_02099700; else goto L_02099704;
   L_02099700: ; // 0x2099700
@@ -17883,15 +17883,15 @@ void Gambit_fn_02099720(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02099720: ; // 0x2099720
-        /* 02099720 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02099724 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099720 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02099724 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099724 */ _t1 = _t0 & 0x00000001u;
         /* 02099724 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02099724 */ goto L_02099728;
   L_02099728: ; // 0x2099728
         /* 02099728 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02099728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209972C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209972C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209972C */ _t3 = _t2 & 0x00000001u;
         /* 0209972C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209972C */ goto L_02099730;
@@ -17910,8 +17910,8 @@ void Gambit_fn_02099720(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -17925,15 +17925,15 @@ void Gambit_fn_02099720(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -17970,11 +17970,11 @@ void Gambit_fn_02099734(CPUState* cpu) {
         /* 02099740 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02099740 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02099744 */ cpu->r[30] = cpu->r[3];
-        /* 02099744 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02099744 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02099748 */ cpu->r[31] = cpu->r[4];
         /* 0209974C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209974C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02099750 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099750 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099750 */ _t5 = _t4 & 0x00000001u;
         /* 02099750 */ if (_t5) goto L_020997C0; else goto L_02099754;
   L_02099754: ; // 0x2099754
@@ -17988,10 +17988,10 @@ void Gambit_fn_02099734(CPUState* cpu) {
         /* 0209976C */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0209976C */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02099770 */ cpu->r[11] = cpu->r[11] + 0x00000590u;
-        /* 02099774 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02099774 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02099778 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02099778 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0209977C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209977C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209977C */ _t10 = _t9 & 0x00000001u;
         /* 0209977C */ if (_t10) goto L_020997B0; else goto L_02099780;
   L_02099780: ; // 0x2099780
@@ -18012,8 +18012,8 @@ void Gambit_fn_02099734(CPUState* cpu) {
         /* 020997AC */ Gambit_fn_02068798(cpu);
   L_020997B0: ; // 0x20997b0
         /* 020997B0 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020997B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020997B4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020997B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020997B4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020997B4 */ _t15 = _t14 & 0x00000001u;
         /* 020997B4 */ if (_t15) goto L_020997C0; else goto L_020997B8;
   L_020997B8: ; // 0x20997b8
@@ -18044,11 +18044,11 @@ void Gambit_fn_02099738(CPUState* cpu) {
         /* 02099740 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02099740 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02099744 */ cpu->r[30] = cpu->r[3];
-        /* 02099744 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02099744 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02099748 */ cpu->r[31] = cpu->r[4];
         /* 0209974C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209974C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02099750 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099750 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099750 */ _t5 = _t4 & 0x00000001u;
         /* 02099750 */ if (_t5) goto L_020997C0; else goto L_02099754;
   L_02099754: ; // 0x2099754
@@ -18062,10 +18062,10 @@ void Gambit_fn_02099738(CPUState* cpu) {
         /* 0209976C */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0209976C */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 02099770 */ cpu->r[11] = cpu->r[11] + 0x00000590u;
-        /* 02099774 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02099774 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02099778 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 02099778 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0209977C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209977C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209977C */ _t10 = _t9 & 0x00000001u;
         /* 0209977C */ if (_t10) goto L_020997B0; else goto L_02099780;
   L_02099780: ; // 0x2099780
@@ -18086,8 +18086,8 @@ void Gambit_fn_02099738(CPUState* cpu) {
         /* 020997AC */ Gambit_fn_02068798(cpu);
   L_020997B0: ; // 0x20997b0
         /* 020997B0 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020997B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020997B4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020997B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020997B4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020997B4 */ _t15 = _t14 & 0x00000001u;
         /* 020997B4 */ if (_t15) goto L_020997C0; else goto L_020997B8;
   L_020997B8: ; // 0x20997b8
@@ -18220,9 +18220,9 @@ void Gambit_fn_02099830(CPUState* cpu) {
         /* 02099834 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 02099834 */ cpu->r[9] = _t0;
         /* 02099838 */ cpu->r[12] = 0x101D0000u;
-        /* 0209983C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0209983C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02099840 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 02099844 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099844 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099844 */ _t2 = _t1 & 0x00000001u;
         /* 02099844 */ if (_t2) goto L_02099848; else goto L_0209985C;
   L_02099848: ; // 0x2099848
@@ -18234,8 +18234,8 @@ void Gambit_fn_02099830(CPUState* cpu) {
         /* 02099858 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 02099858 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_0209985C: ; // 0x209985c
-        /* 0209985C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02099860 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209985C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02099860 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099860 */ _t6 = _t5 & 0x00000001u;
         /* 02099860 */ if (_t6) goto L_02099864; else goto L_0209986C;
   L_02099864: ; // 0x2099864
@@ -18247,9 +18247,9 @@ void Gambit_fn_02099830(CPUState* cpu) {
         /* 02099870 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 02099870 */ cpu->r[7] = _t7;
         /* 02099874 */ cpu->r[11] = 0x101D0000u;
-        /* 02099878 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02099878 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0209987C */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 02099880 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099880 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099880 */ _t9 = _t8 & 0x00000001u;
         /* 02099880 */ if (_t9) goto L_02099884; else goto L_02099898;
   L_02099884: ; // 0x2099884
@@ -18376,18 +18376,18 @@ void Gambit_fn_020998EC(CPUState* cpu) {
         /* 02008980 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02008980 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02008984 */ cpu->r[12] = 0x00000000u;
-        /* 02008988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02008988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0200898C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0200898C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02008990 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02008990 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02008990 */ _t6 = _t5 & 0x00000001u;
         /* 02008990 */ if (_t6) goto L_020089B8; else goto L_02008994;
   L_02008994: ; // 0x2008994
         /* 02008994 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02008994 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02008998 */ /* nop */
-        /* 0200899C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 020089A0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0200899C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 020089A0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020089A0 */ _t9 = _t8 & 0x00000001u;
         /* 020089A0 */ if (_t9) goto L_020089A4; else goto L_020089B8;
   L_020089A4: ; // 0x20089a4
@@ -18559,15 +18559,15 @@ void Gambit_fn_02099990(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02099990: ; // 0x2099990
-        /* 02099990 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02099994 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02099994 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099994 */ _t1 = _t0 & 0x00000001u;
         /* 02099994 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02099994 */ goto L_02099998;
   L_02099998: ; // 0x2099998
         /* 02099998 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02099998 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209999C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099998 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209999C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209999C */ _t3 = _t2 & 0x00000001u;
         /* 0209999C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209999C */ goto L_020999A0;
@@ -18586,8 +18586,8 @@ void Gambit_fn_02099990(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -18601,15 +18601,15 @@ void Gambit_fn_02099990(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -18643,15 +18643,15 @@ void Gambit_fn_020999A8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020999A8: ; // 0x20999a8
-        /* 020999A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020999AC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020999A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020999AC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020999AC */ _t1 = _t0 & 0x00000001u;
         /* 020999AC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020999AC */ goto L_020999B0;
   L_020999B0: ; // 0x20999b0
         /* 020999B0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020999B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020999B4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020999B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020999B4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020999B4 */ _t3 = _t2 & 0x00000001u;
         /* 020999B4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020999B4 */ goto L_020999B8;
@@ -18670,8 +18670,8 @@ void Gambit_fn_020999A8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -18685,15 +18685,15 @@ void Gambit_fn_020999A8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -18739,15 +18739,15 @@ void Gambit_fn_020999D8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020999D8: ; // 0x20999d8
-        /* 020999D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020999DC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020999D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020999DC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020999DC */ _t1 = _t0 & 0x00000001u;
         /* 020999DC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020999DC */ goto L_020999E0;
   L_020999E0: ; // 0x20999e0
         /* 020999E0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020999E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020999E4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020999E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020999E4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020999E4 */ _t3 = _t2 & 0x00000001u;
         /* 020999E4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020999E4 */ goto L_020999E8;
@@ -18766,8 +18766,8 @@ void Gambit_fn_020999D8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -18781,15 +18781,15 @@ void Gambit_fn_020999D8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -18817,15 +18817,15 @@ void Gambit_fn_020999EC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020999EC: ; // 0x20999ec
-        /* 020999EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020999F0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020999EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020999F0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020999F0 */ _t1 = _t0 & 0x00000001u;
         /* 020999F0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020999F0 */ goto L_020999F4;
   L_020999F4: ; // 0x20999f4
         /* 020999F4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020999F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020999F8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020999F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020999F8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020999F8 */ _t3 = _t2 & 0x00000001u;
         /* 020999F8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020999F8 */ goto L_020999FC;
@@ -18844,8 +18844,8 @@ void Gambit_fn_020999EC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -18859,15 +18859,15 @@ void Gambit_fn_020999EC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -18907,11 +18907,11 @@ void Gambit_fn_02099A00(CPUState* cpu) {
         /* 0209A148 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0209A148 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0209A14C */ cpu->r[30] = cpu->r[3];
-        /* 0209A14C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209A14C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209A150 */ cpu->r[31] = cpu->r[4];
         /* 0209A154 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209A154 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209A158 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A158 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A158 */ _t5 = _t4 & 0x00000001u;
         /* 0209A158 */ if (_t5) goto L_0209A1C8; else goto L_0209A15C;
   L_0209A15C: ; // 0x209a15c
@@ -18925,10 +18925,10 @@ void Gambit_fn_02099A00(CPUState* cpu) {
         /* 0209A174 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0209A174 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0209A178 */ cpu->r[11] = cpu->r[11] + 0x000009D8u;
-        /* 0209A17C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209A17C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209A180 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0209A180 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0209A184 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A184 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A184 */ _t10 = _t9 & 0x00000001u;
         /* 0209A184 */ if (_t10) goto L_0209A1B8; else goto L_0209A188;
   L_0209A188: ; // 0x209a188
@@ -18949,8 +18949,8 @@ void Gambit_fn_02099A00(CPUState* cpu) {
         /* 0209A1B4 */ Gambit_fn_02068798(cpu);
   L_0209A1B8: ; // 0x209a1b8
         /* 0209A1B8 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209A1B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209A1BC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A1B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209A1BC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A1BC */ _t15 = _t14 & 0x00000001u;
         /* 0209A1BC */ if (_t15) goto L_0209A1C8; else goto L_0209A1C0;
   L_0209A1C0: ; // 0x209a1c0
@@ -18978,8 +18978,8 @@ void Gambit_fn_02099A08(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -19030,18 +19030,18 @@ void Gambit_fn_02099A20(CPUState* cpu) {
         /* 02099A28 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 02099A28 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02099A2C */ cpu->r[31] = cpu->r[3];
-        /* 02099A2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02099A2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02099A30 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02099A30 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 02099A34 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099A34 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099A34 */ _t4 = _t3 & 0x00000001u;
         /* 02099A34 */ if (_t4) goto L_02099A38; else goto L_02099A48;
   L_02099A38: ; // 0x2099a38
         /* 02099A38 */ cpu->r[3] = 0x0000022Cu;
         /* 02099A3C */ Gambit_fn_02801A78(cpu);
         /* 02099A40 */ cpu->r[31] = cpu->r[3];
-        /* 02099A40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02099A44 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099A40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02099A44 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099A44 */ _t6 = _t5 & 0x00000001u;
         /* 02099A44 */ if (_t6) goto L_02099AAC; else goto L_02099A48;
   L_02099A48: ; // 0x2099a48
@@ -19100,18 +19100,18 @@ void Gambit_fn_02099A24(CPUState* cpu) {
         /* 02099A28 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 02099A28 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02099A2C */ cpu->r[31] = cpu->r[3];
-        /* 02099A2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02099A2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02099A30 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02099A30 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 02099A34 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099A34 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099A34 */ _t4 = _t3 & 0x00000001u;
         /* 02099A34 */ if (_t4) goto L_02099A38; else goto L_02099A48;
   L_02099A38: ; // 0x2099a38
         /* 02099A38 */ cpu->r[3] = 0x0000022Cu;
         /* 02099A3C */ Gambit_fn_02801A78(cpu);
         /* 02099A40 */ cpu->r[31] = cpu->r[3];
-        /* 02099A40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02099A44 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099A40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02099A44 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099A44 */ _t6 = _t5 & 0x00000001u;
         /* 02099A44 */ if (_t6) goto L_02099AAC; else goto L_02099A48;
   L_02099A48: ; // 0x2099a48
@@ -19194,11 +19194,11 @@ void Gambit_fn_02099AC4(CPUState* cpu) {
         /* 02099B08 */ cpu->r[3] = cpu->r[29];
         /* 02099B0C */ Gambit_fn_0209B4A8(cpu);
         /* 02099B10 */ cpu->r[31] = 0x10010000u;
-        /* 02099B14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02099B14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02099B18 */ cpu->r[30] = 0x10010000u;
         /* 02099B1C */ cpu->r[31] = cpu->r[31] + 0x00000728u;
         /* 02099B20 */ cpu->r[30] = cpu->r[30] + 0x000006F0u;
-        /* 02099B24 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099B24 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099B24 */ _t10 = _t9 & 0x00000001u;
         /* 02099B24 */ if (_t10) goto L_02099B68; else goto L_02099B28;
   L_02099B28: ; // 0x2099b28
@@ -19288,11 +19288,11 @@ void Gambit_fn_02099AC8(CPUState* cpu) {
         /* 02099B08 */ cpu->r[3] = cpu->r[29];
         /* 02099B0C */ Gambit_fn_0209B4A8(cpu);
         /* 02099B10 */ cpu->r[31] = 0x10010000u;
-        /* 02099B14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02099B14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02099B18 */ cpu->r[30] = 0x10010000u;
         /* 02099B1C */ cpu->r[31] = cpu->r[31] + 0x00000728u;
         /* 02099B20 */ cpu->r[30] = cpu->r[30] + 0x000006F0u;
-        /* 02099B24 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099B24 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099B24 */ _t10 = _t9 & 0x00000001u;
         /* 02099B24 */ if (_t10) goto L_02099B68; else goto L_02099B28;
   L_02099B28: ; // 0x2099b28
@@ -19517,17 +19517,17 @@ void Gambit_fn_02099C44(CPUState* cpu) {
         /* 020A9E24 */ _t7 = cpu->r[30] + 0x00000008u;
         /* 020A9E24 */ cpu->r[0] = rbrew_read32(cpu->mem, _t7);
         /* 020A9E28 */ cpu->r[29] = 0x00000000u;
-        /* 020A9E2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[0]);
-        /* 020A9E30 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020A9E2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[0]));
+        /* 020A9E30 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020A9E30 */ _t9 = _t8 & 0x00000001u;
         /* 020A9E30 */ if (_t9) goto L_020A9E34; else goto L_020A9E70;
   L_020A9E34: ; // 0x20a9e34
         /* 020A9E34 */ cpu->r[31] = 0x00000000u;
         /* 020A9E38 */ cpu->r[28] = cpu->r[31];
   L_020A9E3C: ; // 0x20a9e3c
-        /* 020A9E3C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[0]);
+        /* 020A9E3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[0]));
         /* 020A9E40 */ cpu->r[4] = 0x00000000u;
-        /* 020A9E44 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020A9E44 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020A9E44 */ _t11 = _t10 & 0x00000001u;
         /* 020A9E44 */ if (_t11) goto L_020A9E48; else goto L_020A9E50;
   L_020A9E48: ; // 0x20a9e48
@@ -19543,9 +19543,9 @@ void Gambit_fn_02099C44(CPUState* cpu) {
         /* 020A9E5C */ _t15 = cpu->r[30] + 0x00000008u;
         /* 020A9E5C */ cpu->r[0] = rbrew_read32(cpu->mem, _t15);
         /* 020A9E60 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 020A9E64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[0]);
+        /* 020A9E64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[0]));
         /* 020A9E68 */ cpu->r[31] = cpu->r[31] + 0x00000004u;
-        /* 020A9E6C */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020A9E6C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020A9E6C */ _t17 = _t16 & 0x00000001u;
         /* 020A9E6C */ if (_t17) goto L_020A9E3C; else goto L_020A9E70;
   L_020A9E70: ; // 0x20a9e70
@@ -19580,16 +19580,16 @@ void Gambit_fn_02099C4C(CPUState* cpu) {
         /* 02099C5C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02099C60 */ _t3 = cpu->r[31] + 0x0000021Cu;
         /* 02099C60 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02099C64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02099C68 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02099C64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02099C68 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02099C68 */ _t5 = _t4 & 0x00000001u;
         /* 02099C68 */ if (_t5) goto L_02099C8C; else goto L_02099C6C;
   L_02099C6C: ; // 0x2099c6c
         /* 02099C6C */ cpu->r[11] = cpu->r[11] + 0xFFFFFFFFu;
-        /* 02099C6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02099C6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02099C70 */ _t6 = cpu->r[31] + 0x0000021Cu;
         /* 02099C70 */ rbrew_write32(cpu->mem, _t6, cpu->r[11]);
-        /* 02099C74 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02099C74 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02099C74 */ _t8 = _t7 & 0x00000001u;
         /* 02099C74 */ if (_t8) goto L_02099C78; else goto L_02099C8C;
   L_02099C78: ; // 0x2099c78
@@ -19604,8 +19604,8 @@ void Gambit_fn_02099C4C(CPUState* cpu) {
         /* 02099C8C */ _t11 = cpu->r[31] + 0x00000224u;
         /* 02099C8C */ cpu->r[3] = rbrew_read32(cpu->mem, _t11);
         /* 02099C90 */ Gambit_fn_020A9D40(cpu);
-        /* 02099C94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02099C98 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099C94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02099C98 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099C98 */ _t13 = _t12 & 0x00000001u;
         /* 02099C98 */ if (_t13) goto L_02099CAC; else goto L_02099C9C;
   L_02099C9C: ; // 0x2099c9c
@@ -19640,16 +19640,16 @@ void Gambit_fn_02099C50(CPUState* cpu) {
         /* 02099C5C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02099C60 */ _t3 = cpu->r[31] + 0x0000021Cu;
         /* 02099C60 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02099C64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02099C68 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02099C64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02099C68 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02099C68 */ _t5 = _t4 & 0x00000001u;
         /* 02099C68 */ if (_t5) goto L_02099C8C; else goto L_02099C6C;
   L_02099C6C: ; // 0x2099c6c
         /* 02099C6C */ cpu->r[11] = cpu->r[11] + 0xFFFFFFFFu;
-        /* 02099C6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02099C6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02099C70 */ _t6 = cpu->r[31] + 0x0000021Cu;
         /* 02099C70 */ rbrew_write32(cpu->mem, _t6, cpu->r[11]);
-        /* 02099C74 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02099C74 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02099C74 */ _t8 = _t7 & 0x00000001u;
         /* 02099C74 */ if (_t8) goto L_02099C78; else goto L_02099C8C;
   L_02099C78: ; // 0x2099c78
@@ -19664,8 +19664,8 @@ void Gambit_fn_02099C50(CPUState* cpu) {
         /* 02099C8C */ _t11 = cpu->r[31] + 0x00000224u;
         /* 02099C8C */ cpu->r[3] = rbrew_read32(cpu->mem, _t11);
         /* 02099C90 */ Gambit_fn_020A9D40(cpu);
-        /* 02099C94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02099C98 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099C94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02099C98 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099C98 */ _t13 = _t12 & 0x00000001u;
         /* 02099C98 */ if (_t13) goto L_02099CAC; else goto L_02099C9C;
   L_02099C9C: ; // 0x2099c9c
@@ -20054,9 +20054,9 @@ void Gambit_fn_02099E80(CPUState* cpu) {
         /* 02099E98 */ _t4 = cpu->r[30] + 0x00000220u;
         /* 02099E98 */ cpu->r[0] = rbrew_read8(cpu->mem, _t4);
         /* 02099E9C */ cpu->r[10] = 0x10010000u;
-        /* 02099EA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02099EA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02099EA4 */ cpu->r[10] = cpu->r[10] + 0x000006F0u;
-        /* 02099EA8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099EA8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099EA8 */ _t6 = _t5 & 0x00000001u;
         /* 02099EA8 */ if (_t6) goto L_02099EE4; else goto L_02099EAC;
   L_02099EAC: ; // 0x2099eac
@@ -20124,9 +20124,9 @@ void Gambit_fn_02099E84(CPUState* cpu) {
         /* 02099E98 */ _t4 = cpu->r[30] + 0x00000220u;
         /* 02099E98 */ cpu->r[0] = rbrew_read8(cpu->mem, _t4);
         /* 02099E9C */ cpu->r[10] = 0x10010000u;
-        /* 02099EA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02099EA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02099EA4 */ cpu->r[10] = cpu->r[10] + 0x000006F0u;
-        /* 02099EA8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099EA8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099EA8 */ _t6 = _t5 & 0x00000001u;
         /* 02099EA8 */ if (_t6) goto L_02099EE4; else goto L_02099EAC;
   L_02099EAC: ; // 0x2099eac
@@ -20195,9 +20195,9 @@ void Gambit_fn_02099F30(CPUState* cpu) {
         /* 02099F48 */ _t4 = cpu->r[30] + 0x00000220u;
         /* 02099F48 */ cpu->r[0] = rbrew_read8(cpu->mem, _t4);
         /* 02099F4C */ cpu->r[10] = 0x10010000u;
-        /* 02099F50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02099F50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02099F54 */ cpu->r[10] = cpu->r[10] + 0x000006F0u;
-        /* 02099F58 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099F58 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099F58 */ _t6 = _t5 & 0x00000001u;
         /* 02099F58 */ if (_t6) goto L_02099F94; else goto L_02099F5C;
   L_02099F5C: ; // 0x2099f5c
@@ -20265,9 +20265,9 @@ void Gambit_fn_02099F34(CPUState* cpu) {
         /* 02099F48 */ _t4 = cpu->r[30] + 0x00000220u;
         /* 02099F48 */ cpu->r[0] = rbrew_read8(cpu->mem, _t4);
         /* 02099F4C */ cpu->r[10] = 0x10010000u;
-        /* 02099F50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02099F50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02099F54 */ cpu->r[10] = cpu->r[10] + 0x000006F0u;
-        /* 02099F58 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02099F58 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02099F58 */ _t6 = _t5 & 0x00000001u;
         /* 02099F58 */ if (_t6) goto L_02099F94; else goto L_02099F5C;
   L_02099F5C: ; // 0x2099f5c
@@ -20606,15 +20606,15 @@ void Gambit_fn_0209A128(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209A128: ; // 0x209a128
-        /* 0209A128 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A12C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A128 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A12C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A12C */ _t1 = _t0 & 0x00000001u;
         /* 0209A12C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209A12C */ goto L_0209A130;
   L_0209A130: ; // 0x209a130
         /* 0209A130 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209A130 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209A134 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A130 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209A134 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A134 */ _t3 = _t2 & 0x00000001u;
         /* 0209A134 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209A134 */ goto L_0209A138;
@@ -20633,8 +20633,8 @@ void Gambit_fn_0209A128(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -20648,15 +20648,15 @@ void Gambit_fn_0209A128(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -20693,11 +20693,11 @@ void Gambit_fn_0209A13C(CPUState* cpu) {
         /* 0209A148 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0209A148 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0209A14C */ cpu->r[30] = cpu->r[3];
-        /* 0209A14C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209A14C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209A150 */ cpu->r[31] = cpu->r[4];
         /* 0209A154 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209A154 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209A158 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A158 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A158 */ _t5 = _t4 & 0x00000001u;
         /* 0209A158 */ if (_t5) goto L_0209A1C8; else goto L_0209A15C;
   L_0209A15C: ; // 0x209a15c
@@ -20711,10 +20711,10 @@ void Gambit_fn_0209A13C(CPUState* cpu) {
         /* 0209A174 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0209A174 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0209A178 */ cpu->r[11] = cpu->r[11] + 0x000009D8u;
-        /* 0209A17C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209A17C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209A180 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0209A180 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0209A184 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A184 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A184 */ _t10 = _t9 & 0x00000001u;
         /* 0209A184 */ if (_t10) goto L_0209A1B8; else goto L_0209A188;
   L_0209A188: ; // 0x209a188
@@ -20735,8 +20735,8 @@ void Gambit_fn_0209A13C(CPUState* cpu) {
         /* 0209A1B4 */ Gambit_fn_02068798(cpu);
   L_0209A1B8: ; // 0x209a1b8
         /* 0209A1B8 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209A1B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209A1BC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A1B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209A1BC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A1BC */ _t15 = _t14 & 0x00000001u;
         /* 0209A1BC */ if (_t15) goto L_0209A1C8; else goto L_0209A1C0;
   L_0209A1C0: ; // 0x209a1c0
@@ -20767,11 +20767,11 @@ void Gambit_fn_0209A140(CPUState* cpu) {
         /* 0209A148 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0209A148 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0209A14C */ cpu->r[30] = cpu->r[3];
-        /* 0209A14C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209A14C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209A150 */ cpu->r[31] = cpu->r[4];
         /* 0209A154 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209A154 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209A158 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A158 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A158 */ _t5 = _t4 & 0x00000001u;
         /* 0209A158 */ if (_t5) goto L_0209A1C8; else goto L_0209A15C;
   L_0209A15C: ; // 0x209a15c
@@ -20785,10 +20785,10 @@ void Gambit_fn_0209A140(CPUState* cpu) {
         /* 0209A174 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0209A174 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0209A178 */ cpu->r[11] = cpu->r[11] + 0x000009D8u;
-        /* 0209A17C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209A17C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209A180 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0209A180 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0209A184 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A184 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A184 */ _t10 = _t9 & 0x00000001u;
         /* 0209A184 */ if (_t10) goto L_0209A1B8; else goto L_0209A188;
   L_0209A188: ; // 0x209a188
@@ -20809,8 +20809,8 @@ void Gambit_fn_0209A140(CPUState* cpu) {
         /* 0209A1B4 */ Gambit_fn_02068798(cpu);
   L_0209A1B8: ; // 0x209a1b8
         /* 0209A1B8 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209A1B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209A1BC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A1B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209A1BC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A1BC */ _t15 = _t14 & 0x00000001u;
         /* 0209A1BC */ if (_t15) goto L_0209A1C8; else goto L_0209A1C0;
   L_0209A1C0: ; // 0x209a1c0
@@ -20943,9 +20943,9 @@ void Gambit_fn_0209A238(CPUState* cpu) {
         /* 0209A23C */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 0209A23C */ cpu->r[9] = _t0;
         /* 0209A240 */ cpu->r[12] = 0x101D0000u;
-        /* 0209A244 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0209A244 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0209A248 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 0209A24C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A24C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A24C */ _t2 = _t1 & 0x00000001u;
         /* 0209A24C */ if (_t2) goto L_0209A250; else goto L_0209A264;
   L_0209A250: ; // 0x209a250
@@ -20957,8 +20957,8 @@ void Gambit_fn_0209A238(CPUState* cpu) {
         /* 0209A260 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 0209A260 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_0209A264: ; // 0x209a264
-        /* 0209A264 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0209A268 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A264 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0209A268 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A268 */ _t6 = _t5 & 0x00000001u;
         /* 0209A268 */ if (_t6) goto L_0209A26C; else goto L_0209A274;
   L_0209A26C: ; // 0x209a26c
@@ -20970,9 +20970,9 @@ void Gambit_fn_0209A238(CPUState* cpu) {
         /* 0209A278 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 0209A278 */ cpu->r[7] = _t7;
         /* 0209A27C */ cpu->r[11] = 0x101D0000u;
-        /* 0209A280 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0209A280 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0209A284 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 0209A288 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A288 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A288 */ _t9 = _t8 & 0x00000001u;
         /* 0209A288 */ if (_t9) goto L_0209A28C; else goto L_0209A2A0;
   L_0209A28C: ; // 0x209a28c
@@ -21081,18 +21081,18 @@ void Gambit_fn_0209A2E8(CPUState* cpu) {
         /* 02008980 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02008980 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02008984 */ cpu->r[12] = 0x00000000u;
-        /* 02008988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02008988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0200898C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0200898C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02008990 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02008990 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02008990 */ _t6 = _t5 & 0x00000001u;
         /* 02008990 */ if (_t6) goto L_020089B8; else goto L_02008994;
   L_02008994: ; // 0x2008994
         /* 02008994 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02008994 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02008998 */ /* nop */
-        /* 0200899C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 020089A0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0200899C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 020089A0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020089A0 */ _t9 = _t8 & 0x00000001u;
         /* 020089A0 */ if (_t9) goto L_020089A4; else goto L_020089B8;
   L_020089A4: ; // 0x20089a4
@@ -21157,8 +21157,8 @@ void Gambit_fn_0209A2F0(CPUState* cpu) {
         /* 0209A33C */ Gambit_fn_026D6F40(cpu);
         /* 0209A340 */ cpu->r[3] = 0x0000021Cu;
         /* 0209A344 */ Gambit_fn_02801A78(cpu);
-        /* 0209A348 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A34C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A348 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A34C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A34C */ _t10 = _t9 & 0x00000001u;
         /* 0209A34C */ if (_t10) goto L_0209A354; else goto L_0209A350;
   L_0209A350: ; // 0x209a350
@@ -21175,8 +21175,8 @@ void Gambit_fn_0209A2F0(CPUState* cpu) {
         /* 0209A368 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209A36C */ cpu->r[3] = 0x00000224u;
         /* 0209A370 */ Gambit_fn_02801A78(cpu);
-        /* 0209A374 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A378 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A374 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A378 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A378 */ _t15 = _t14 & 0x00000001u;
         /* 0209A378 */ if (_t15) goto L_0209A380; else goto L_0209A37C;
   L_0209A37C: ; // 0x209a37c
@@ -21198,8 +21198,8 @@ void Gambit_fn_0209A2F0(CPUState* cpu) {
         /* 0209A3A4 */ _t20 = cpu->r[10] + 0x00000100u;
         /* 0209A3A4 */ rbrew_write32(cpu->mem, _t20, cpu->r[11]);
         /* 0209A3A8 */ Gambit_fn_02801A78(cpu);
-        /* 0209A3AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A3B0 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A3AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A3B0 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A3B0 */ _t22 = _t21 & 0x00000001u;
         /* 0209A3B0 */ if (_t22) goto L_0209A3B8; else goto L_0209A3B4;
   L_0209A3B4: ; // 0x209a3b4
@@ -21216,8 +21216,8 @@ void Gambit_fn_0209A2F0(CPUState* cpu) {
         /* 0209A3CC */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209A3D0 */ cpu->r[3] = 0x0000022Cu;
         /* 0209A3D4 */ Gambit_fn_02801A78(cpu);
-        /* 0209A3D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A3DC */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A3D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A3DC */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A3DC */ _t27 = _t26 & 0x00000001u;
         /* 0209A3DC */ if (_t27) goto L_0209A3E4; else goto L_0209A3E0;
   L_0209A3E0: ; // 0x209a3e0
@@ -21234,8 +21234,8 @@ void Gambit_fn_0209A2F0(CPUState* cpu) {
         /* 0209A3F8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209A3FC */ cpu->r[3] = 0x0000022Cu;
         /* 0209A400 */ Gambit_fn_02801A78(cpu);
-        /* 0209A404 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A408 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A404 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A408 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A408 */ _t32 = _t31 & 0x00000001u;
         /* 0209A408 */ if (_t32) goto L_0209A410; else goto L_0209A40C;
   L_0209A40C: ; // 0x209a40c
@@ -21252,8 +21252,8 @@ void Gambit_fn_0209A2F0(CPUState* cpu) {
         /* 0209A424 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209A428 */ cpu->r[3] = 0x00000220u;
         /* 0209A42C */ Gambit_fn_02801A78(cpu);
-        /* 0209A430 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A434 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A430 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A434 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A434 */ _t37 = _t36 & 0x00000001u;
         /* 0209A434 */ if (_t37) goto L_0209A43C; else goto L_0209A438;
   L_0209A438: ; // 0x209a438
@@ -21270,8 +21270,8 @@ void Gambit_fn_0209A2F0(CPUState* cpu) {
         /* 0209A450 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209A454 */ cpu->r[3] = 0x00000224u;
         /* 0209A458 */ Gambit_fn_02801A78(cpu);
-        /* 0209A45C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A460 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A45C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A460 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A460 */ _t42 = _t41 & 0x00000001u;
         /* 0209A460 */ if (_t42) goto L_0209A468; else goto L_0209A464;
   L_0209A464: ; // 0x209a464
@@ -21288,8 +21288,8 @@ void Gambit_fn_0209A2F0(CPUState* cpu) {
         /* 0209A47C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209A480 */ cpu->r[3] = 0x00000220u;
         /* 0209A484 */ Gambit_fn_02801A78(cpu);
-        /* 0209A488 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A48C */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A488 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A48C */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A48C */ _t47 = _t46 & 0x00000001u;
         /* 0209A48C */ if (_t47) goto L_0209A49C; else goto L_0209A490;
   L_0209A490: ; // 0x209a490
@@ -21372,8 +21372,8 @@ void Gambit_fn_0209A2F4(CPUState* cpu) {
         /* 0209A33C */ Gambit_fn_026D6F40(cpu);
         /* 0209A340 */ cpu->r[3] = 0x0000021Cu;
         /* 0209A344 */ Gambit_fn_02801A78(cpu);
-        /* 0209A348 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A34C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A348 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A34C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A34C */ _t10 = _t9 & 0x00000001u;
         /* 0209A34C */ if (_t10) goto L_0209A354; else goto L_0209A350;
   L_0209A350: ; // 0x209a350
@@ -21390,8 +21390,8 @@ void Gambit_fn_0209A2F4(CPUState* cpu) {
         /* 0209A368 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209A36C */ cpu->r[3] = 0x00000224u;
         /* 0209A370 */ Gambit_fn_02801A78(cpu);
-        /* 0209A374 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A378 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A374 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A378 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A378 */ _t15 = _t14 & 0x00000001u;
         /* 0209A378 */ if (_t15) goto L_0209A380; else goto L_0209A37C;
   L_0209A37C: ; // 0x209a37c
@@ -21413,8 +21413,8 @@ void Gambit_fn_0209A2F4(CPUState* cpu) {
         /* 0209A3A4 */ _t20 = cpu->r[10] + 0x00000100u;
         /* 0209A3A4 */ rbrew_write32(cpu->mem, _t20, cpu->r[11]);
         /* 0209A3A8 */ Gambit_fn_02801A78(cpu);
-        /* 0209A3AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A3B0 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A3AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A3B0 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A3B0 */ _t22 = _t21 & 0x00000001u;
         /* 0209A3B0 */ if (_t22) goto L_0209A3B8; else goto L_0209A3B4;
   L_0209A3B4: ; // 0x209a3b4
@@ -21431,8 +21431,8 @@ void Gambit_fn_0209A2F4(CPUState* cpu) {
         /* 0209A3CC */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209A3D0 */ cpu->r[3] = 0x0000022Cu;
         /* 0209A3D4 */ Gambit_fn_02801A78(cpu);
-        /* 0209A3D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A3DC */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A3D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A3DC */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A3DC */ _t27 = _t26 & 0x00000001u;
         /* 0209A3DC */ if (_t27) goto L_0209A3E4; else goto L_0209A3E0;
   L_0209A3E0: ; // 0x209a3e0
@@ -21449,8 +21449,8 @@ void Gambit_fn_0209A2F4(CPUState* cpu) {
         /* 0209A3F8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209A3FC */ cpu->r[3] = 0x0000022Cu;
         /* 0209A400 */ Gambit_fn_02801A78(cpu);
-        /* 0209A404 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A408 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A404 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A408 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A408 */ _t32 = _t31 & 0x00000001u;
         /* 0209A408 */ if (_t32) goto L_0209A410; else goto L_0209A40C;
   L_0209A40C: ; // 0x209a40c
@@ -21467,8 +21467,8 @@ void Gambit_fn_0209A2F4(CPUState* cpu) {
         /* 0209A424 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209A428 */ cpu->r[3] = 0x00000220u;
         /* 0209A42C */ Gambit_fn_02801A78(cpu);
-        /* 0209A430 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A434 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A430 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A434 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A434 */ _t37 = _t36 & 0x00000001u;
         /* 0209A434 */ if (_t37) goto L_0209A43C; else goto L_0209A438;
   L_0209A438: ; // 0x209a438
@@ -21485,8 +21485,8 @@ void Gambit_fn_0209A2F4(CPUState* cpu) {
         /* 0209A450 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209A454 */ cpu->r[3] = 0x00000224u;
         /* 0209A458 */ Gambit_fn_02801A78(cpu);
-        /* 0209A45C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A460 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A45C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A460 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A460 */ _t42 = _t41 & 0x00000001u;
         /* 0209A460 */ if (_t42) goto L_0209A468; else goto L_0209A464;
   L_0209A464: ; // 0x209a464
@@ -21503,8 +21503,8 @@ void Gambit_fn_0209A2F4(CPUState* cpu) {
         /* 0209A47C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209A480 */ cpu->r[3] = 0x00000220u;
         /* 0209A484 */ Gambit_fn_02801A78(cpu);
-        /* 0209A488 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A48C */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A488 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A48C */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A48C */ _t47 = _t46 & 0x00000001u;
         /* 0209A48C */ if (_t47) goto L_0209A49C; else goto L_0209A490;
   L_0209A490: ; // 0x209a490
@@ -21588,8 +21588,8 @@ void Gambit_fn_0209A504(CPUState* cpu) {
         /* 0209A33C */ Gambit_fn_026D6F40(cpu);
         /* 0209A340 */ cpu->r[3] = 0x0000021Cu;
         /* 0209A344 */ Gambit_fn_02801A78(cpu);
-        /* 0209A348 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A34C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A348 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A34C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A34C */ _t10 = _t9 & 0x00000001u;
         /* 0209A34C */ if (_t10) goto L_0209A354; else goto L_0209A350;
   L_0209A350: ; // 0x209a350
@@ -21606,8 +21606,8 @@ void Gambit_fn_0209A504(CPUState* cpu) {
         /* 0209A368 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209A36C */ cpu->r[3] = 0x00000224u;
         /* 0209A370 */ Gambit_fn_02801A78(cpu);
-        /* 0209A374 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A378 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A374 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A378 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A378 */ _t15 = _t14 & 0x00000001u;
         /* 0209A378 */ if (_t15) goto L_0209A380; else goto L_0209A37C;
   L_0209A37C: ; // 0x209a37c
@@ -21629,8 +21629,8 @@ void Gambit_fn_0209A504(CPUState* cpu) {
         /* 0209A3A4 */ _t20 = cpu->r[10] + 0x00000100u;
         /* 0209A3A4 */ rbrew_write32(cpu->mem, _t20, cpu->r[11]);
         /* 0209A3A8 */ Gambit_fn_02801A78(cpu);
-        /* 0209A3AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A3B0 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A3AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A3B0 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A3B0 */ _t22 = _t21 & 0x00000001u;
         /* 0209A3B0 */ if (_t22) goto L_0209A3B8; else goto L_0209A3B4;
   L_0209A3B4: ; // 0x209a3b4
@@ -21647,8 +21647,8 @@ void Gambit_fn_0209A504(CPUState* cpu) {
         /* 0209A3CC */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209A3D0 */ cpu->r[3] = 0x0000022Cu;
         /* 0209A3D4 */ Gambit_fn_02801A78(cpu);
-        /* 0209A3D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A3DC */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A3D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A3DC */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A3DC */ _t27 = _t26 & 0x00000001u;
         /* 0209A3DC */ if (_t27) goto L_0209A3E4; else goto L_0209A3E0;
   L_0209A3E0: ; // 0x209a3e0
@@ -21665,8 +21665,8 @@ void Gambit_fn_0209A504(CPUState* cpu) {
         /* 0209A3F8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209A3FC */ cpu->r[3] = 0x0000022Cu;
         /* 0209A400 */ Gambit_fn_02801A78(cpu);
-        /* 0209A404 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A408 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A404 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A408 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A408 */ _t32 = _t31 & 0x00000001u;
         /* 0209A408 */ if (_t32) goto L_0209A410; else goto L_0209A40C;
   L_0209A40C: ; // 0x209a40c
@@ -21683,8 +21683,8 @@ void Gambit_fn_0209A504(CPUState* cpu) {
         /* 0209A424 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209A428 */ cpu->r[3] = 0x00000220u;
         /* 0209A42C */ Gambit_fn_02801A78(cpu);
-        /* 0209A430 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A434 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A430 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A434 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A434 */ _t37 = _t36 & 0x00000001u;
         /* 0209A434 */ if (_t37) goto L_0209A43C; else goto L_0209A438;
   L_0209A438: ; // 0x209a438
@@ -21701,8 +21701,8 @@ void Gambit_fn_0209A504(CPUState* cpu) {
         /* 0209A450 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209A454 */ cpu->r[3] = 0x00000224u;
         /* 0209A458 */ Gambit_fn_02801A78(cpu);
-        /* 0209A45C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A460 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A45C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A460 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A460 */ _t42 = _t41 & 0x00000001u;
         /* 0209A460 */ if (_t42) goto L_0209A468; else goto L_0209A464;
   L_0209A464: ; // 0x209a464
@@ -21719,8 +21719,8 @@ void Gambit_fn_0209A504(CPUState* cpu) {
         /* 0209A47C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209A480 */ cpu->r[3] = 0x00000220u;
         /* 0209A484 */ Gambit_fn_02801A78(cpu);
-        /* 0209A488 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A48C */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A488 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A48C */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A48C */ _t47 = _t46 & 0x00000001u;
         /* 0209A48C */ if (_t47) goto L_0209A49C; else goto L_0209A490;
   L_0209A490: ; // 0x209a490
@@ -86,19 +86,19 @@ void Gambit_fn_0209A554(CPUState* cpu) {
         /* 0209A560 */ _t2 = cpu->r[1] + 0x0000000Cu;
         /* 0209A560 */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
         /* 0209A564 */ cpu->r[31] = cpu->r[3];
-        /* 0209A564 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209A564 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209A568 */ cpu->r[30] = cpu->r[4];
         /* 0209A56C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209A56C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209A570 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A570 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A570 */ _t5 = _t4 & 0x00000001u;
         /* 0209A570 */ if (_t5) goto L_0209A574; else goto L_0209A584;
   L_0209A574: ; // 0x209a574
         /* 0209A574 */ cpu->r[3] = 0x0000005Cu;
         /* 0209A578 */ Gambit_fn_02801A78(cpu);
         /* 0209A57C */ cpu->r[31] = cpu->r[3];
-        /* 0209A57C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209A580 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A57C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209A580 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A580 */ _t7 = _t6 & 0x00000001u;
         /* 0209A580 */ if (_t7) goto L_0209A620; else goto L_0209A584;
   L_0209A584: ; // 0x209a584
@@ -118,17 +118,17 @@ void Gambit_fn_0209A554(CPUState* cpu) {
         /* 0209A5B0 */ rbrew_write32(cpu->mem, _t9, cpu->r[9]);
         /* 0209A5B4 */ cpu->r[8] = cpu->r[8] + 0x00000C18u;
         /* 0209A5B8 */ cpu->r[3] = cpu->r[31] + 0x00000028u;
-        /* 0209A5B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0209A5B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0209A5BC */ _t10 = cpu->r[31] + 0x0000000Cu;
         /* 0209A5BC */ rbrew_write32(cpu->mem, _t10, cpu->r[8]);
-        /* 0209A5C0 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A5C0 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A5C0 */ _t12 = _t11 & 0x00000001u;
         /* 0209A5C0 */ if (_t12) goto L_0209A5C4; else goto L_0209A5D4;
   L_0209A5C4: ; // 0x209a5c4
         /* 0209A5C4 */ cpu->r[3] = 0x00000010u;
         /* 0209A5C8 */ Gambit_fn_02801A78(cpu);
-        /* 0209A5CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A5D0 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A5CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A5D0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A5D0 */ _t14 = _t13 & 0x00000001u;
         /* 0209A5D0 */ if (_t14) goto L_0209A5F8; else goto L_0209A5D4;
   L_0209A5D4: ; // 0x209a5d4
@@ -194,19 +194,19 @@ void Gambit_fn_0209A558(CPUState* cpu) {
         /* 0209A560 */ _t2 = cpu->r[1] + 0x0000000Cu;
         /* 0209A560 */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
         /* 0209A564 */ cpu->r[31] = cpu->r[3];
-        /* 0209A564 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209A564 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209A568 */ cpu->r[30] = cpu->r[4];
         /* 0209A56C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209A56C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209A570 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A570 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A570 */ _t5 = _t4 & 0x00000001u;
         /* 0209A570 */ if (_t5) goto L_0209A574; else goto L_0209A584;
   L_0209A574: ; // 0x209a574
         /* 0209A574 */ cpu->r[3] = 0x0000005Cu;
         /* 0209A578 */ Gambit_fn_02801A78(cpu);
         /* 0209A57C */ cpu->r[31] = cpu->r[3];
-        /* 0209A57C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209A580 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A57C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209A580 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A580 */ _t7 = _t6 & 0x00000001u;
         /* 0209A580 */ if (_t7) goto L_0209A620; else goto L_0209A584;
   L_0209A584: ; // 0x209a584
@@ -226,17 +226,17 @@ void Gambit_fn_0209A558(CPUState* cpu) {
         /* 0209A5B0 */ rbrew_write32(cpu->mem, _t9, cpu->r[9]);
         /* 0209A5B4 */ cpu->r[8] = cpu->r[8] + 0x00000C18u;
         /* 0209A5B8 */ cpu->r[3] = cpu->r[31] + 0x00000028u;
-        /* 0209A5B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0209A5B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0209A5BC */ _t10 = cpu->r[31] + 0x0000000Cu;
         /* 0209A5BC */ rbrew_write32(cpu->mem, _t10, cpu->r[8]);
-        /* 0209A5C0 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A5C0 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A5C0 */ _t12 = _t11 & 0x00000001u;
         /* 0209A5C0 */ if (_t12) goto L_0209A5C4; else goto L_0209A5D4;
   L_0209A5C4: ; // 0x209a5c4
         /* 0209A5C4 */ cpu->r[3] = 0x00000010u;
         /* 0209A5C8 */ Gambit_fn_02801A78(cpu);
-        /* 0209A5CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A5D0 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A5CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A5D0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A5D0 */ _t14 = _t13 & 0x00000001u;
         /* 0209A5D0 */ if (_t14) goto L_0209A5F8; else goto L_0209A5D4;
   L_0209A5D4: ; // 0x209a5d4
@@ -426,8 +426,8 @@ void Gambit_fn_0209A6C0(CPUState* cpu) {
         /* 0209A6F0 */ _t6 = cpu->r[29] + 0x00000038u;
         /* 0209A6F0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t6);
         /* 0209A6F4 */ Gambit_fn_027ECBB4(cpu);
-        /* 0209A6F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0209A6FC */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209A6F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0209A6FC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209A6FC */ _t8 = _t7 & 0x00000001u;
         /* 0209A6FC */ if (_t8) goto L_0209A710; else goto L_0209A700;
   L_0209A700: ; // 0x209a700
@@ -437,8 +437,8 @@ void Gambit_fn_0209A6C0(CPUState* cpu) {
         /* 0209A708 */ cpu->r[5] = 0x00000001u;
         /* 0209A70C */ Gambit_fn_027ECB34(cpu);
   L_0209A710: ; // 0x209a710
-        /* 0209A710 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209A714 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209A710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209A714 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209A714 */ _t11 = _t10 & 0x00000001u;
         /* 0209A714 */ if (_t11) goto L_0209A728; else goto L_0209A718;
   L_0209A718: ; // 0x209a718
@@ -495,8 +495,8 @@ void Gambit_fn_0209A6C4(CPUState* cpu) {
         /* 0209A6F0 */ _t6 = cpu->r[29] + 0x00000038u;
         /* 0209A6F0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t6);
         /* 0209A6F4 */ Gambit_fn_027ECBB4(cpu);
-        /* 0209A6F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0209A6FC */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209A6F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0209A6FC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209A6FC */ _t8 = _t7 & 0x00000001u;
         /* 0209A6FC */ if (_t8) goto L_0209A710; else goto L_0209A700;
   L_0209A700: ; // 0x209a700
@@ -506,8 +506,8 @@ void Gambit_fn_0209A6C4(CPUState* cpu) {
         /* 0209A708 */ cpu->r[5] = 0x00000001u;
         /* 0209A70C */ Gambit_fn_027ECB34(cpu);
   L_0209A710: ; // 0x209a710
-        /* 0209A710 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209A714 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209A710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209A714 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209A714 */ _t11 = _t10 & 0x00000001u;
         /* 0209A714 */ if (_t11) goto L_0209A728; else goto L_0209A718;
   L_0209A718: ; // 0x209a718
@@ -571,8 +571,8 @@ void Gambit_fn_0209A76C(CPUState* cpu) {
         /* 0209A784 */ _t3 = cpu->r[3] + 0x00003400u;
         /* 0209A784 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0209A788 */ Gambit_fn_0206C030(cpu);
-        /* 0209A78C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A790 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A78C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A790 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A790 */ _t5 = _t4 & 0x00000001u;
         /* 0209A790 */ if (_t5) goto L_0209A79C; else goto L_0209A794;
   L_0209A794: ; // 0x209a794
@@ -613,8 +613,8 @@ void Gambit_fn_0209A770(CPUState* cpu) {
         /* 0209A784 */ _t3 = cpu->r[3] + 0x00003400u;
         /* 0209A784 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0209A788 */ Gambit_fn_0206C030(cpu);
-        /* 0209A78C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A790 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A78C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A790 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A790 */ _t5 = _t4 & 0x00000001u;
         /* 0209A790 */ if (_t5) goto L_0209A79C; else goto L_0209A794;
   L_0209A794: ; // 0x209a794
@@ -692,8 +692,8 @@ void Gambit_fn_0209A7E8(CPUState* cpu) {
         /* 0209A818 */ _t6 = cpu->r[29] + 0x0000003Cu;
         /* 0209A818 */ cpu->r[3] = rbrew_read32(cpu->mem, _t6);
         /* 0209A81C */ Gambit_fn_027ECBB4(cpu);
-        /* 0209A820 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0209A824 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209A820 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0209A824 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209A824 */ _t8 = _t7 & 0x00000001u;
         /* 0209A824 */ if (_t8) goto L_0209A838; else goto L_0209A828;
   L_0209A828: ; // 0x209a828
@@ -703,8 +703,8 @@ void Gambit_fn_0209A7E8(CPUState* cpu) {
         /* 0209A830 */ cpu->r[5] = 0x00000001u;
         /* 0209A834 */ Gambit_fn_027ECB34(cpu);
   L_0209A838: ; // 0x209a838
-        /* 0209A838 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209A83C */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209A838 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209A83C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209A83C */ _t11 = _t10 & 0x00000001u;
         /* 0209A83C */ if (_t11) goto L_0209A850; else goto L_0209A840;
   L_0209A840: ; // 0x209a840
@@ -763,8 +763,8 @@ void Gambit_fn_0209A7EC(CPUState* cpu) {
         /* 0209A818 */ _t6 = cpu->r[29] + 0x0000003Cu;
         /* 0209A818 */ cpu->r[3] = rbrew_read32(cpu->mem, _t6);
         /* 0209A81C */ Gambit_fn_027ECBB4(cpu);
-        /* 0209A820 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0209A824 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209A820 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0209A824 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209A824 */ _t8 = _t7 & 0x00000001u;
         /* 0209A824 */ if (_t8) goto L_0209A838; else goto L_0209A828;
   L_0209A828: ; // 0x209a828
@@ -774,8 +774,8 @@ void Gambit_fn_0209A7EC(CPUState* cpu) {
         /* 0209A830 */ cpu->r[5] = 0x00000001u;
         /* 0209A834 */ Gambit_fn_027ECB34(cpu);
   L_0209A838: ; // 0x209a838
-        /* 0209A838 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209A83C */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209A838 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209A83C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209A83C */ _t11 = _t10 & 0x00000001u;
         /* 0209A83C */ if (_t11) goto L_0209A850; else goto L_0209A840;
   L_0209A840: ; // 0x209a840
@@ -841,8 +841,8 @@ void Gambit_fn_0209A89C(CPUState* cpu) {
         /* 0209A8B4 */ _t3 = cpu->r[3] + 0x00003400u;
         /* 0209A8B4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0209A8B8 */ Gambit_fn_0206C030(cpu);
-        /* 0209A8BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A8C0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A8BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A8C0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A8C0 */ _t5 = _t4 & 0x00000001u;
         /* 0209A8C0 */ if (_t5) goto L_0209A8CC; else goto L_0209A8C4;
   L_0209A8C4: ; // 0x209a8c4
@@ -883,8 +883,8 @@ void Gambit_fn_0209A8A0(CPUState* cpu) {
         /* 0209A8B4 */ _t3 = cpu->r[3] + 0x00003400u;
         /* 0209A8B4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0209A8B8 */ Gambit_fn_0206C030(cpu);
-        /* 0209A8BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A8C0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A8BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A8C0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A8C0 */ _t5 = _t4 & 0x00000001u;
         /* 0209A8C0 */ if (_t5) goto L_0209A8CC; else goto L_0209A8C4;
   L_0209A8C4: ; // 0x209a8c4
@@ -953,8 +953,8 @@ void Gambit_fn_0209A920(CPUState* cpu) {
         /* 0209A930 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0209A930 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0209A934 */ Gambit_fn_0209A908(cpu);
-        /* 0209A938 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A93C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A938 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A93C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A93C */ _t4 = _t3 & 0x00000001u;
         /* 0209A93C */ if (_t4) goto L_0209A95C; else goto L_0209A940;
   L_0209A940: ; // 0x209a940
@@ -992,8 +992,8 @@ void Gambit_fn_0209A924(CPUState* cpu) {
         /* 0209A930 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0209A930 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0209A934 */ Gambit_fn_0209A908(cpu);
-        /* 0209A938 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A93C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A938 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A93C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A93C */ _t4 = _t3 & 0x00000001u;
         /* 0209A93C */ if (_t4) goto L_0209A95C; else goto L_0209A940;
   L_0209A940: ; // 0x209a940
@@ -1036,17 +1036,17 @@ void Gambit_fn_0209A970(CPUState* cpu) {
         /* 0209BD7C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 0209BD80 */ _t4 = cpu->r[3] + 0x00000228u;
         /* 0209BD80 */ cpu->r[0] = rbrew_read8(cpu->mem, _t4);
-        /* 0209BD84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0209BD84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0209BD88 */ cpu->r[31] = 0x00000000u;
-        /* 0209BD8C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BD8C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BD8C */ _t6 = _t5 & 0x00000001u;
         /* 0209BD8C */ if (_t6) goto L_0209BD90; else goto L_0209BDA4;
   L_0209BD90: ; // 0x209bd90
         /* 0209BD90 */ _t7 = cpu->r[3] + 0x00000224u;
         /* 0209BD90 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
         /* 0209BD94 */ Gambit_fn_020C3920(cpu);
-        /* 0209BD98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209BD9C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BD98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209BD9C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BD9C */ _t9 = _t8 & 0x00000001u;
         /* 0209BD9C */ if (_t9) goto L_0209BDA4; else goto L_0209BDA0;
   L_0209BDA0: ; // 0x209bda0
@@ -1077,8 +1077,8 @@ void Gambit_fn_0209A978(CPUState* cpu) {
         /* 0209A988 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0209A988 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0209A98C */ Gambit_fn_0209A970(cpu);
-        /* 0209A990 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A994 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A994 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A994 */ _t4 = _t3 & 0x00000001u;
         /* 0209A994 */ if (_t4) goto L_0209A9A0; else goto L_0209A998;
   L_0209A998: ; // 0x209a998
@@ -1109,8 +1109,8 @@ void Gambit_fn_0209A97C(CPUState* cpu) {
         /* 0209A988 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0209A988 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0209A98C */ Gambit_fn_0209A970(cpu);
-        /* 0209A990 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209A994 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209A990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209A994 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209A994 */ _t4 = _t3 & 0x00000001u;
         /* 0209A994 */ if (_t4) goto L_0209A9A0; else goto L_0209A998;
   L_0209A998: ; // 0x209a998
@@ -1299,8 +1299,8 @@ void Gambit_fn_0209AA68(CPUState* cpu) {
         /* 0209AA80 */ _t3 = cpu->r[3] + 0x00003400u;
         /* 0209AA80 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0209AA84 */ Gambit_fn_0206C030(cpu);
-        /* 0209AA88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209AA8C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209AA88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209AA8C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209AA8C */ _t5 = _t4 & 0x00000001u;
         /* 0209AA8C */ if (_t5) goto L_0209AA98; else goto L_0209AA90;
   L_0209AA90: ; // 0x209aa90
@@ -1341,8 +1341,8 @@ void Gambit_fn_0209AA6C(CPUState* cpu) {
         /* 0209AA80 */ _t3 = cpu->r[3] + 0x00003400u;
         /* 0209AA80 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0209AA84 */ Gambit_fn_0206C030(cpu);
-        /* 0209AA88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209AA8C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209AA88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209AA8C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209AA8C */ _t5 = _t4 & 0x00000001u;
         /* 0209AA8C */ if (_t5) goto L_0209AA98; else goto L_0209AA90;
   L_0209AA90: ; // 0x209aa90
@@ -1416,11 +1416,11 @@ void Gambit_fn_0209AAC0(CPUState* cpu) {
         /* 020D4950 */ cpu->r[29] = 0x10020000u;
         /* 020D4954 */ cpu->r[30] = 0x10020000u;
         /* 020D4958 */ cpu->r[28] = cpu->r[3];
-        /* 020D4958 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 020D4958 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 020D495C */ cpu->r[29] = cpu->r[29] + 0xFFFF8648u;
         /* 020D4960 */ cpu->r[30] = cpu->r[30] + 0xFFFF86C8u;
         /* 020D4964 */ cpu->r[3] = cpu->r[31];
-        /* 020D4968 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4968 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4968 */ _t16 = _t15 & 0x00000001u;
         /* 020D4968 */ if (_t16) goto L_020D49B4; else goto L_020D496C;
   L_020D496C: ; // 0x20d496c
@@ -1464,9 +1464,9 @@ void Gambit_fn_0209AAC0(CPUState* cpu) {
         /* 020D49D0 */ Gambit_fn_027ED700(cpu);
         /* 020D49D4 */ _t28 = cpu->r[31] + 0x00000234u;
         /* 020D49D4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t28);
-        /* 020D49D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020D49D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020D49DC */ cpu->r[3] = cpu->r[31];
-        /* 020D49E0 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D49E0 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D49E0 */ _t30 = _t29 & 0x00000001u;
         /* 020D49E0 */ if (_t30) goto L_020D4A14; else goto L_020D49E4;
   L_020D49E4: ; // 0x20d49e4
@@ -1548,15 +1548,15 @@ void Gambit_fn_0209AAC8(CPUState* cpu) {
         /* 020D4AB8 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D4ABC */ _t9 = cpu->r[31] + 0x00000235u;
         /* 020D4ABC */ cpu->r[0] = rbrew_read8(cpu->mem, _t9);
-        /* 020D4AC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020D4AC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020D4AC4 */ _t10 = cpu->r[31] + 0x0000021Cu;
         /* 020D4AC4 */ rbrew_write32(cpu->mem, _t10, cpu->r[4]);
-        /* 020D4AC8 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4AC8 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4AC8 */ _t12 = _t11 & 0x00000001u;
         /* 020D4AC8 */ if (_t12) goto L_020D4B20; else goto L_020D4ACC;
   L_020D4ACC: ; // 0x20d4acc
-        /* 020D4ACC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020D4AD0 */ _t13 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D4ACC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020D4AD0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D4AD0 */ _t14 = _t13 & 0x00000001u;
         /* 020D4AD0 */ if (_t14) goto L_020D4AD4; else goto L_020D4B2C;
   L_020D4AD4: ; // 0x20d4ad4
@@ -1567,8 +1567,8 @@ void Gambit_fn_0209AAC8(CPUState* cpu) {
         /* 020D4AE0 */ cpu->r[9] = (uint32_t)((int32_t)cpu->r[7] / (int32_t)cpu->r[10]);
         /* 020D4AE4 */ _t16 = cpu->r[31] + 0x00000218u;
         /* 020D4AE4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t16);
-        /* 020D4AE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], cpu->r[0]);
-        /* 020D4AEC */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D4AE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], cpu->r[0]));
+        /* 020D4AEC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D4AEC */ _t18 = _t17 & 0x00000001u;
         /* 020D4AEC */ if (_t18) goto L_020D4AF0; else goto L_020D4B30;
   L_020D4AF0: ; // 0x20d4af0
@@ -1581,10 +1581,10 @@ void Gambit_fn_0209AAC8(CPUState* cpu) {
         /* 020D4B04 */ cpu->r[29] = cpu->r[3];
         /* 020D4B08 */ cpu->r[30] = cpu->r[30] + 0xFFFF8648u;
         /* 020D4B0C */ cpu->r[10] = 0x10020000u;
-        /* 020D4B10 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[9]);
+        /* 020D4B10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[9]));
         /* 020D4B14 */ _t20 = cpu->r[10] + 0xFFFF86B8u;
         /* 020D4B14 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t20);
-        /* 020D4B18 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4B18 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4B18 */ _t22 = _t21 & 0x00000001u;
         /* 020D4B18 */ if (_t22) goto L_020D4BBC; else goto L_020D4B1C;
   L_020D4B1C: ; // 0x20d4b1c
@@ -1593,8 +1593,8 @@ void Gambit_fn_0209AAC8(CPUState* cpu) {
         /* 020D4B20 */ _t23 = cpu->r[31] + 0x0000022Cu;
         /* 020D4B20 */ cpu->r[8] = rbrew_read32(cpu->mem, _t23);
         /* 020D4B24 */ cpu->r[9] = (uint32_t)((int32_t)cpu->r[4] / (int32_t)cpu->r[8]);
-        /* 020D4B24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 020D4B28 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D4B24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 020D4B28 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D4B28 */ _t25 = _t24 & 0x00000001u;
         /* 020D4B28 */ if (_t25) goto L_020D4B2C; else goto L_020D4B30;
   L_020D4B2C: ; // 0x20d4b2c
@@ -1608,10 +1608,10 @@ void Gambit_fn_0209AAC8(CPUState* cpu) {
         /* 020D4B40 */ cpu->r[29] = cpu->r[3];
         /* 020D4B44 */ cpu->r[30] = cpu->r[30] + 0xFFFF8648u;
         /* 020D4B48 */ cpu->r[10] = 0x10020000u;
-        /* 020D4B4C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[9]);
+        /* 020D4B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[9]));
         /* 020D4B50 */ _t27 = cpu->r[10] + 0xFFFF86B8u;
         /* 020D4B50 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t27);
-        /* 020D4B54 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4B54 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4B54 */ _t29 = _t28 & 0x00000001u;
         /* 020D4B54 */ if (_t29) goto L_020D4BBC; else goto L_020D4B58;
   L_020D4B58: ; // 0x20d4b58
@@ -1619,10 +1619,10 @@ void Gambit_fn_0209AAC8(CPUState* cpu) {
         /* 020D4B5C */ _t30 = cpu->r[31] + 0x00000220u;
         /* 020D4B5C */ rbrew_write32(cpu->mem, _t30, cpu->r[9]);
         /* 020D4B60 */ Gambit_fn_020D48A4(cpu);
-        /* 020D4B64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020D4B64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020D4B68 */ _t31 = cpu->r[31] + 0x000001DCu;
         /* 020D4B68 */ cpu->r[12] = rbrew_read32(cpu->mem, _t31);
-        /* 020D4B6C */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4B6C */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4B6C */ _t33 = _t32 & 0x00000001u;
         /* 020D4B6C */ if (_t33) goto L_020D4B98; else goto L_020D4B70;
   L_020D4B70: ; // 0x20d4b70
@@ -1653,15 +1653,15 @@ void Gambit_fn_0209AAC8(CPUState* cpu) {
   L_020D4BBC: ; // 0x20d4bbc
         /* 020D4BBC */ _t38 = cpu->r[31] + 0x00000236u;
         /* 020D4BBC */ cpu->r[0] = rbrew_read8(cpu->mem, _t38);
-        /* 020D4BC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020D4BC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020D4BC4 */ cpu->r[0] = 0x10020000u;
         /* 020D4BC8 */ cpu->r[0] = cpu->r[0] + 0xFFFF86F8u;
-        /* 020D4BCC */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4BCC */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4BCC */ _t40 = _t39 & 0x00000001u;
         /* 020D4BCC */ if (_t40) goto L_020D4BD0; else goto L_020D4C00;
   L_020D4BD0: ; // 0x20d4bd0
-        /* 020D4BD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020D4BD4 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4BD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020D4BD4 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4BD4 */ _t42 = _t41 & 0x00000001u;
         /* 020D4BD4 */ if (_t42) goto L_020D4C5C; else goto L_020D4BD8;
   L_020D4BD8: ; // 0x20d4bd8
@@ -1681,16 +1681,16 @@ void Gambit_fn_0209AAC8(CPUState* cpu) {
         /* 020D4BF8 */ rbrew_write8(cpu->mem, _t47, (uint8_t)cpu->r[29]);
         /* 020D4BFC */ goto L_020D4C60;
   L_020D4C00: ; // 0x20d4c00
-        /* 020D4C00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020D4C04 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4C00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020D4C04 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4C04 */ _t49 = _t48 & 0x00000001u;
         /* 020D4C04 */ if (_t49) goto L_020D4C08; else goto L_020D4C5C;
   L_020D4C08: ; // 0x20d4c08
         /* 020D4C08 */ _t50 = cpu->r[31] + 0x00000234u;
         /* 020D4C08 */ cpu->r[6] = rbrew_read8(cpu->mem, _t50);
-        /* 020D4C0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 020D4C0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 020D4C10 */ cpu->r[3] = cpu->r[31];
-        /* 020D4C14 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4C14 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4C14 */ _t52 = _t51 & 0x00000001u;
         /* 020D4C14 */ if (_t52) goto L_020D4C44; else goto L_020D4C18;
   L_020D4C18: ; // 0x20d4c18
@@ -1733,7 +1733,7 @@ void Gambit_fn_0209AAC8(CPUState* cpu) {
         /* 020D4C6C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t64);
         /* 020D4C70 */ _t65 = cpu->r[1] + 0x0000003Cu;
         /* 020D4C70 */ cpu->r[31] = rbrew_read32(cpu->mem, _t65);
-        /* 020D4C74 */ _t66 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D4C74 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D4C74 */ _t67 = _t66 & 0x00000001u;
         /* 020D4C74 */ if (_t67) goto L_020D4C78; // else: addr-0 trap, fall-through
   L_020D4C78: ; // 0x20d4c78
@@ -1811,8 +1811,8 @@ void Gambit_fn_0209AB04(CPUState* cpu) {
         /* 0209AB20 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 0209AB24 */ cpu->r[29] = cpu->r[4];
         /* 0209AB28 */ Gambit_fn_0209AAD8(cpu);
-        /* 0209AB2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209AB30 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209AB2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209AB30 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209AB30 */ _t6 = _t5 & 0x00000001u;
         /* 0209AB30 */ if (_t6) goto L_0209AB34; else goto L_0209AB3C;
   L_0209AB34: ; // 0x209ab34
@@ -1864,8 +1864,8 @@ void Gambit_fn_0209AB08(CPUState* cpu) {
         /* 0209AB20 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 0209AB24 */ cpu->r[29] = cpu->r[4];
         /* 0209AB28 */ Gambit_fn_0209AAD8(cpu);
-        /* 0209AB2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209AB30 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209AB2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209AB30 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209AB30 */ _t6 = _t5 & 0x00000001u;
         /* 0209AB30 */ if (_t6) goto L_0209AB34; else goto L_0209AB3C;
   L_0209AB34: ; // 0x209ab34
@@ -1921,8 +1921,8 @@ void Gambit_fn_0209AB7C(CPUState* cpu) {
         /* 0209ABA0 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
         /* 0209ABA4 */ cpu->r[29] = cpu->r[5];
         /* 0209ABA8 */ Gambit_fn_0209AAD8(cpu);
-        /* 0209ABAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209ABB0 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209ABAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209ABB0 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209ABB0 */ _t7 = _t6 & 0x00000001u;
         /* 0209ABB0 */ if (_t7) goto L_0209ABB4; else goto L_0209ABBC;
   L_0209ABB4: ; // 0x209abb4
@@ -1980,8 +1980,8 @@ void Gambit_fn_0209AB80(CPUState* cpu) {
         /* 0209ABA0 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
         /* 0209ABA4 */ cpu->r[29] = cpu->r[5];
         /* 0209ABA8 */ Gambit_fn_0209AAD8(cpu);
-        /* 0209ABAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209ABB0 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209ABAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209ABB0 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209ABB0 */ _t7 = _t6 & 0x00000001u;
         /* 0209ABB0 */ if (_t7) goto L_0209ABB4; else goto L_0209ABBC;
   L_0209ABB4: ; // 0x209abb4
@@ -2049,8 +2049,8 @@ void Gambit_fn_0209AC18(CPUState* cpu) {
         /* 0209AC30 */ _t3 = cpu->r[3] + 0x00003400u;
         /* 0209AC30 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0209AC34 */ Gambit_fn_0206C030(cpu);
-        /* 0209AC38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209AC3C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209AC38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209AC3C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209AC3C */ _t5 = _t4 & 0x00000001u;
         /* 0209AC3C */ if (_t5) goto L_0209AC48; else goto L_0209AC40;
   L_0209AC40: ; // 0x209ac40
@@ -2091,8 +2091,8 @@ void Gambit_fn_0209AC1C(CPUState* cpu) {
         /* 0209AC30 */ _t3 = cpu->r[3] + 0x00003400u;
         /* 0209AC30 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0209AC34 */ Gambit_fn_0206C030(cpu);
-        /* 0209AC38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209AC3C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209AC38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209AC3C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209AC3C */ _t5 = _t4 & 0x00000001u;
         /* 0209AC3C */ if (_t5) goto L_0209AC48; else goto L_0209AC40;
   L_0209AC40: ; // 0x209ac40
@@ -2245,8 +2245,8 @@ void Gambit_fn_0209ACF4(CPUState* cpu) {
         /* 0209AD0C */ _t3 = cpu->r[3] + 0x00003400u;
         /* 0209AD0C */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0209AD10 */ Gambit_fn_0206C030(cpu);
-        /* 0209AD14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209AD18 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209AD14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209AD18 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209AD18 */ _t5 = _t4 & 0x00000001u;
         /* 0209AD18 */ if (_t5) goto L_0209AD24; else goto L_0209AD1C;
   L_0209AD1C: ; // 0x209ad1c
@@ -2287,8 +2287,8 @@ void Gambit_fn_0209ACF8(CPUState* cpu) {
         /* 0209AD0C */ _t3 = cpu->r[3] + 0x00003400u;
         /* 0209AD0C */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0209AD10 */ Gambit_fn_0206C030(cpu);
-        /* 0209AD14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209AD18 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209AD14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209AD18 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209AD18 */ _t5 = _t4 & 0x00000001u;
         /* 0209AD18 */ if (_t5) goto L_0209AD24; else goto L_0209AD1C;
   L_0209AD1C: ; // 0x209ad1c
@@ -2322,7 +2322,7 @@ void Gambit_fn_0209AD4C(CPUState* cpu) {
         /* 0209AD50 */ goto L_0209B734;
   L_0209B734: ; // 0x209b734
         /* 0209B734 */ cpu->r[0] = cpu->lr;
-        /* 0209B738 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000001u);
+        /* 0209B738 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000001u));
         /* 0209B73C */ _t1 = cpu->r[1] + 0x00000004u;
         /* 0209B73C */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 0209B740 */ cpu->r[0] = 0x10010000u;
@@ -2330,16 +2330,16 @@ void Gambit_fn_0209AD4C(CPUState* cpu) {
         /* 0209B744 */ rbrew_write32(cpu->mem, _t2, cpu->r[1]);
         /* 0209B744 */ cpu->r[1] = _t2;
         /* 0209B748 */ cpu->r[0] = cpu->r[0] + 0x00000CA0u;
-        /* 0209B74C */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209B74C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209B74C */ _t4 = _t3 & 0x00000001u;
         /* 0209B74C */ if (_t4) goto L_0209B76C; else goto L_0209B750;
   L_0209B750: ; // 0x209b750
-        /* 0209B750 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B750 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B750 */ _t6 = _t5 & 0x00000001u;
         /* 0209B750 */ if (_t6) goto L_0209B788; else goto L_0209B754;
   L_0209B754: ; // 0x209b754
-        /* 0209B754 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000002u);
-        /* 0209B758 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B754 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000002u));
+        /* 0209B758 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B758 */ _t8 = _t7 & 0x00000001u;
         /* 0209B758 */ if (_t8) goto L_0209B7A4; else goto L_0209B75C;
   L_0209B75C: ; // 0x209b75c
@@ -2421,8 +2421,8 @@ void Gambit_fn_0209AD6C(CPUState* cpu) {
         /* 0209AD88 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 0209AD8C */ cpu->r[29] = cpu->r[3];
         /* 0209AD90 */ Gambit_fn_0209AD54(cpu);
-        /* 0209AD94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209AD98 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209AD94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209AD98 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209AD98 */ _t6 = _t5 & 0x00000001u;
         /* 0209AD98 */ if (_t6) goto L_0209ADD4; else goto L_0209AD9C;
   L_0209AD9C: ; // 0x209ad9c
@@ -2480,8 +2480,8 @@ void Gambit_fn_0209AD70(CPUState* cpu) {
         /* 0209AD88 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 0209AD8C */ cpu->r[29] = cpu->r[3];
         /* 0209AD90 */ Gambit_fn_0209AD54(cpu);
-        /* 0209AD94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209AD98 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209AD94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209AD98 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209AD98 */ _t6 = _t5 & 0x00000001u;
         /* 0209AD98 */ if (_t6) goto L_0209ADD4; else goto L_0209AD9C;
   L_0209AD9C: ; // 0x209ad9c
@@ -2543,8 +2543,8 @@ void Gambit_fn_0209ADF0(CPUState* cpu) {
         /* 0209AE14 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
         /* 0209AE18 */ cpu->r[29] = cpu->r[3];
         /* 0209AE1C */ Gambit_fn_0209AD54(cpu);
-        /* 0209AE20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209AE24 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209AE20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209AE24 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209AE24 */ _t7 = _t6 & 0x00000001u;
         /* 0209AE24 */ if (_t7) goto L_0209AE70; else goto L_0209AE28;
   L_0209AE28: ; // 0x209ae28
@@ -2612,8 +2612,8 @@ void Gambit_fn_0209ADF4(CPUState* cpu) {
         /* 0209AE14 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
         /* 0209AE18 */ cpu->r[29] = cpu->r[3];
         /* 0209AE1C */ Gambit_fn_0209AD54(cpu);
-        /* 0209AE20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209AE24 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209AE20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209AE24 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209AE24 */ _t7 = _t6 & 0x00000001u;
         /* 0209AE24 */ if (_t7) goto L_0209AE70; else goto L_0209AE28;
   L_0209AE28: ; // 0x209ae28
@@ -2690,11 +2690,11 @@ void Gambit_fn_0209AEA4(CPUState* cpu) {
         /* 0209AEB8 */ Gambit_fn_0209AE90(cpu);
         /* 0209AEBC */ _t3 = cpu->r[31] + 0x00000050u;
         /* 0209AEBC */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0209AEC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0209AEC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0209AEC4 */ _t4 = cpu->r[11] + 0x00000000u;
         /* 0209AEC4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t4);
         /* 0209AEC8 */ cpu->r[3] = cpu->r[11];
-        /* 0209AECC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209AECC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209AECC */ _t6 = _t5 & 0x00000001u;
         /* 0209AECC */ if (_t6) goto L_0209AEF0; else goto L_0209AED0;
   L_0209AED0: ; // 0x209aed0
@@ -2739,11 +2739,11 @@ void Gambit_fn_0209AEA8(CPUState* cpu) {
         /* 0209AEB8 */ Gambit_fn_0209AE90(cpu);
         /* 0209AEBC */ _t3 = cpu->r[31] + 0x00000050u;
         /* 0209AEBC */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0209AEC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0209AEC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0209AEC4 */ _t4 = cpu->r[11] + 0x00000000u;
         /* 0209AEC4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t4);
         /* 0209AEC8 */ cpu->r[3] = cpu->r[11];
-        /* 0209AECC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209AECC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209AECC */ _t6 = _t5 & 0x00000001u;
         /* 0209AECC */ if (_t6) goto L_0209AEF0; else goto L_0209AED0;
   L_0209AED0: ; // 0x209aed0
@@ -3187,8 +3187,8 @@ void Gambit_fn_0209B07C(CPUState* cpu) {
         /* 0209B094 */ _t3 = cpu->r[3] + 0x00003400u;
         /* 0209B094 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0209B098 */ Gambit_fn_0206C030(cpu);
-        /* 0209B09C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209B0A0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B09C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209B0A0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B0A0 */ _t5 = _t4 & 0x00000001u;
         /* 0209B0A0 */ if (_t5) goto L_0209B0AC; else goto L_0209B0A4;
   L_0209B0A4: ; // 0x209b0a4
@@ -3229,8 +3229,8 @@ void Gambit_fn_0209B080(CPUState* cpu) {
         /* 0209B094 */ _t3 = cpu->r[3] + 0x00003400u;
         /* 0209B094 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0209B098 */ Gambit_fn_0206C030(cpu);
-        /* 0209B09C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209B0A0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B09C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209B0A0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B0A0 */ _t5 = _t4 & 0x00000001u;
         /* 0209B0A0 */ if (_t5) goto L_0209B0AC; else goto L_0209B0A4;
   L_0209B0A4: ; // 0x209b0a4
@@ -3394,8 +3394,8 @@ void Gambit_fn_0209B12C(CPUState* cpu) {
   L_020992F4: ; // 0x20992f4
         /* 020992F4 */ _t0 = cpu->r[3] + 0x00000218u;
         /* 020992F4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 020992F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020992FC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020992F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020992FC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020992FC */ _t2 = _t1 & 0x00000001u;
         /* 020992FC */ if (_t2) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020992FC */ goto L_02099300;
@@ -3473,18 +3473,18 @@ void Gambit_fn_0209B13C(CPUState* cpu) {
         /* 0209B13C */ cpu->r[0] = cpu->lr;
         /* 0209B140 */ _t0 = cpu->r[1] + 0x00000004u;
         /* 0209B140 */ rbrew_write32(cpu->mem, _t0, cpu->r[0]);
-        /* 0209B144 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0209B144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0209B148 */ _t1 = cpu->r[1] + 0xFFFFFFF8u;
         /* 0209B148 */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0209B148 */ cpu->r[1] = _t1;
-        /* 0209B14C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B14C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B14C */ _t3 = _t2 & 0x00000001u;
         /* 0209B14C */ if (_t3) goto L_0209B150; else goto L_0209B160;
   L_0209B150: ; // 0x209b150
         /* 0209B150 */ cpu->r[3] = 0x00000010u;
         /* 0209B154 */ Gambit_fn_02801A78(cpu);
-        /* 0209B158 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209B15C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209B15C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B15C */ _t5 = _t4 & 0x00000001u;
         /* 0209B15C */ if (_t5) goto L_0209B18C; else goto L_0209B160;
   L_0209B160: ; // 0x209b160
@@ -3525,14 +3525,14 @@ void Gambit_fn_0209B148(CPUState* cpu) {
         /* 0209B148 */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 0209B148 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 0209B148 */ cpu->r[1] = _t0;
-        /* 0209B14C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B14C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B14C */ _t2 = _t1 & 0x00000001u;
         /* 0209B14C */ if (_t2) goto L_0209B150; else goto L_0209B160;
   L_0209B150: ; // 0x209b150
         /* 0209B150 */ cpu->r[3] = 0x00000010u;
         /* 0209B154 */ Gambit_fn_02801A78(cpu);
-        /* 0209B158 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209B15C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209B15C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B15C */ _t4 = _t3 & 0x00000001u;
         /* 0209B15C */ if (_t4) goto L_0209B18C; else goto L_0209B160;
   L_0209B160: ; // 0x209b160
@@ -3576,20 +3576,20 @@ void Gambit_fn_0209B19C(CPUState* cpu) {
         /* 0209B1A0 */ cpu->r[0] = cpu->lr;
         /* 0209B1A4 */ /* nop */
         /* 0209B1A8 */ cpu->r[31] = cpu->r[3];
-        /* 0209B1A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209B1A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209B1AC */ cpu->r[30] = cpu->r[4];
         /* 0209B1B0 */ _t1 = cpu->r[1] + 0x0000002Cu;
         /* 0209B1B0 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 0209B1B4 */ cpu->r[29] = cpu->r[5];
-        /* 0209B1B8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B1B8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B1B8 */ _t3 = _t2 & 0x00000001u;
         /* 0209B1B8 */ if (_t3) goto L_0209B1BC; else goto L_0209B1CC;
   L_0209B1BC: ; // 0x209b1bc
         /* 0209B1BC */ cpu->r[3] = 0x0000008Cu;
         /* 0209B1C0 */ Gambit_fn_02801A78(cpu);
         /* 0209B1C4 */ cpu->r[31] = cpu->r[3];
-        /* 0209B1C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209B1C8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B1C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209B1C8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B1C8 */ _t5 = _t4 & 0x00000001u;
         /* 0209B1C8 */ if (_t5) goto L_0209B490; else goto L_0209B1CC;
   L_0209B1CC: ; // 0x209b1cc
@@ -3602,48 +3602,48 @@ void Gambit_fn_0209B19C(CPUState* cpu) {
         /* 0209B1E0 */ cpu->r[9] = 0x10010000u;
         /* 0209B1E4 */ cpu->r[27] = cpu->r[27] + 0x00000AB8u;
         /* 0209B1E8 */ cpu->r[25] = cpu->r[31] + 0x00000004u;
-        /* 0209B1E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 0209B1E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 0209B1EC */ cpu->r[9] = cpu->r[9] + 0x00000B10u;
         /* 0209B1F0 */ cpu->r[24] = cpu->r[24] + 0x00000A88u;
         /* 0209B1F4 */ cpu->r[28] = cpu->r[28] + 0x00000AA0u;
         /* 0209B1F8 */ _t7 = cpu->r[31] + 0x00000088u;
         /* 0209B1F8 */ rbrew_write32(cpu->mem, _t7, cpu->r[9]);
-        /* 0209B1FC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B1FC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B1FC */ _t9 = _t8 & 0x00000001u;
         /* 0209B1FC */ if (_t9) goto L_0209B200; else goto L_0209B210;
   L_0209B200: ; // 0x209b200
         /* 0209B200 */ cpu->r[3] = 0x0000002Cu;
         /* 0209B204 */ Gambit_fn_02801A78(cpu);
         /* 0209B208 */ cpu->r[25] = cpu->r[3];
-        /* 0209B208 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 0209B20C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 0209B20C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B20C */ _t11 = _t10 & 0x00000001u;
         /* 0209B20C */ if (_t11) goto L_0209B280; else goto L_0209B210;
   L_0209B210: ; // 0x209b210
         /* 0209B210 */ cpu->r[30] = cpu->r[25];
-        /* 0209B210 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0209B214 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B210 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0209B214 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B214 */ _t13 = _t12 & 0x00000001u;
         /* 0209B214 */ if (_t13) goto L_0209B218; else goto L_0209B228;
   L_0209B218: ; // 0x209b218
         /* 0209B218 */ cpu->r[3] = 0x0000002Cu;
         /* 0209B21C */ Gambit_fn_02801A78(cpu);
         /* 0209B220 */ cpu->r[30] = cpu->r[3];
-        /* 0209B220 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0209B224 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B220 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0209B224 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B224 */ _t15 = _t14 & 0x00000001u;
         /* 0209B224 */ if (_t15) goto L_0209B27C; else goto L_0209B228;
   L_0209B228: ; // 0x209b228
         /* 0209B228 */ cpu->r[3] = cpu->r[30];
-        /* 0209B228 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209B22C */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209B22C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B22C */ _t17 = _t16 & 0x00000001u;
         /* 0209B22C */ if (_t17) goto L_0209B230; else goto L_0209B254;
   L_0209B230: ; // 0x209b230
         /* 0209B230 */ cpu->r[3] = 0x0000000Cu;
         /* 0209B234 */ Gambit_fn_02801A78(cpu);
-        /* 0209B238 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209B23C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B238 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209B23C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B23C */ _t19 = _t18 & 0x00000001u;
         /* 0209B23C */ if (_t19) goto L_0209B240; else goto L_0209B254;
   L_0209B240: ; // 0x209b240
@@ -3680,43 +3680,43 @@ void Gambit_fn_0209B19C(CPUState* cpu) {
         /* 0209B27C */ rbrew_write32(cpu->mem, _t32, cpu->r[27]);
   L_0209B280: ; // 0x209b280
         /* 0209B280 */ cpu->r[25] = cpu->r[31] + 0x00000030u;
-        /* 0209B280 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 0209B284 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B280 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 0209B284 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B284 */ _t34 = _t33 & 0x00000001u;
         /* 0209B284 */ if (_t34) goto L_0209B288; else goto L_0209B298;
   L_0209B288: ; // 0x209b288
         /* 0209B288 */ cpu->r[3] = 0x0000002Cu;
         /* 0209B28C */ Gambit_fn_02801A78(cpu);
         /* 0209B290 */ cpu->r[25] = cpu->r[3];
-        /* 0209B290 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 0209B294 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B290 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 0209B294 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B294 */ _t36 = _t35 & 0x00000001u;
         /* 0209B294 */ if (_t36) goto L_0209B308; else goto L_0209B298;
   L_0209B298: ; // 0x209b298
         /* 0209B298 */ cpu->r[30] = cpu->r[25];
-        /* 0209B298 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0209B29C */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B298 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0209B29C */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B29C */ _t38 = _t37 & 0x00000001u;
         /* 0209B29C */ if (_t38) goto L_0209B2A0; else goto L_0209B2B0;
   L_0209B2A0: ; // 0x209b2a0
         /* 0209B2A0 */ cpu->r[3] = 0x0000002Cu;
         /* 0209B2A4 */ Gambit_fn_02801A78(cpu);
         /* 0209B2A8 */ cpu->r[30] = cpu->r[3];
-        /* 0209B2A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0209B2AC */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B2A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0209B2AC */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B2AC */ _t40 = _t39 & 0x00000001u;
         /* 0209B2AC */ if (_t40) goto L_0209B304; else goto L_0209B2B0;
   L_0209B2B0: ; // 0x209b2b0
         /* 0209B2B0 */ cpu->r[3] = cpu->r[30];
-        /* 0209B2B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209B2B4 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B2B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209B2B4 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B2B4 */ _t42 = _t41 & 0x00000001u;
         /* 0209B2B4 */ if (_t42) goto L_0209B2B8; else goto L_0209B2DC;
   L_0209B2B8: ; // 0x209b2b8
         /* 0209B2B8 */ cpu->r[3] = 0x0000000Cu;
         /* 0209B2BC */ Gambit_fn_02801A78(cpu);
-        /* 0209B2C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209B2C4 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B2C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209B2C4 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B2C4 */ _t44 = _t43 & 0x00000001u;
         /* 0209B2C4 */ if (_t44) goto L_0209B2C8; else goto L_0209B2DC;
   L_0209B2C8: ; // 0x209b2c8
@@ -3753,43 +3753,43 @@ void Gambit_fn_0209B19C(CPUState* cpu) {
         /* 0209B304 */ rbrew_write32(cpu->mem, _t57, cpu->r[27]);
   L_0209B308: ; // 0x209b308
         /* 0209B308 */ cpu->r[25] = cpu->r[31] + 0x0000005Cu;
-        /* 0209B308 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 0209B30C */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B308 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 0209B30C */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B30C */ _t59 = _t58 & 0x00000001u;
         /* 0209B30C */ if (_t59) goto L_0209B310; else goto L_0209B320;
   L_0209B310: ; // 0x209b310
         /* 0209B310 */ cpu->r[3] = 0x0000002Cu;
         /* 0209B314 */ Gambit_fn_02801A78(cpu);
         /* 0209B318 */ cpu->r[25] = cpu->r[3];
-        /* 0209B318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 0209B31C */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 0209B31C */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B31C */ _t61 = _t60 & 0x00000001u;
         /* 0209B31C */ if (_t61) goto L_0209B390; else goto L_0209B320;
   L_0209B320: ; // 0x209b320
         /* 0209B320 */ cpu->r[30] = cpu->r[25];
-        /* 0209B320 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0209B324 */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B320 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0209B324 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B324 */ _t63 = _t62 & 0x00000001u;
         /* 0209B324 */ if (_t63) goto L_0209B328; else goto L_0209B338;
   L_0209B328: ; // 0x209b328
         /* 0209B328 */ cpu->r[3] = 0x0000002Cu;
         /* 0209B32C */ Gambit_fn_02801A78(cpu);
         /* 0209B330 */ cpu->r[30] = cpu->r[3];
-        /* 0209B330 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0209B334 */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B330 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0209B334 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B334 */ _t65 = _t64 & 0x00000001u;
         /* 0209B334 */ if (_t65) goto L_0209B38C; else goto L_0209B338;
   L_0209B338: ; // 0x209b338
         /* 0209B338 */ cpu->r[3] = cpu->r[30];
-        /* 0209B338 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209B33C */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B338 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209B33C */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B33C */ _t67 = _t66 & 0x00000001u;
         /* 0209B33C */ if (_t67) goto L_0209B340; else goto L_0209B364;
   L_0209B340: ; // 0x209b340
         /* 0209B340 */ cpu->r[3] = 0x0000000Cu;
         /* 0209B344 */ Gambit_fn_02801A78(cpu);
-        /* 0209B348 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209B34C */ _t68 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B348 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209B34C */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B34C */ _t69 = _t68 & 0x00000001u;
         /* 0209B34C */ if (_t69) goto L_0209B350; else goto L_0209B364;
   L_0209B350: ; // 0x209b350
@@ -3828,13 +3828,13 @@ void Gambit_fn_0209B19C(CPUState* cpu) {
         /* 0209B390 */ cpu->r[4] = 0x10010000u;
         /* 0209B394 */ cpu->r[3] = cpu->r[31] + 0x00000004u;
         /* 0209B398 */ cpu->r[4] = cpu->r[4] + 0x00000B68u;
-        /* 0209B39C */ _t83 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209B39C */ _t83 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209B39C */ _t84 = _t83 & 0x00000001u;
         /* 0209B39C */ if (_t84) goto L_0209B3A0; // else: addr-0 trap, fall-through
   L_0209B3A0: ; // 0x209b3a0
         /* 0209B3A0 */ Gambit_fn_0282A5F4(cpu);
-        /* 0209B3A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000001u);
-        /* 0209B3A8 */ _t85 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209B3A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000001u));
+        /* 0209B3A8 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209B3A8 */ _t86 = _t85 & 0x00000001u;
         /* 0209B3A8 */ if (_t86) goto L_0209B3E0; else goto L_0209B3AC;
   L_0209B3AC: ; // 0x209b3ac
@@ -3843,7 +3843,7 @@ void Gambit_fn_0209B19C(CPUState* cpu) {
         /* 0209B3B0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t87);
         /* 0209B3B4 */ cpu->r[3] = cpu->r[31] + 0x00000030u;
         /* 0209B3B8 */ cpu->r[4] = cpu->r[4] + 0x00000B3Cu;
-        /* 0209B3BC */ _t88 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209B3BC */ _t88 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209B3BC */ _t89 = _t88 & 0x00000001u;
         /* 0209B3BC */ if (_t89) goto L_0209B3C0; // else: addr-0 trap, fall-through
   L_0209B3C0: ; // 0x209b3c0
@@ -3853,15 +3853,15 @@ void Gambit_fn_0209B19C(CPUState* cpu) {
         /* 0209B3C8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t90);
         /* 0209B3CC */ cpu->r[3] = cpu->r[31] + 0x0000005Cu;
         /* 0209B3D0 */ cpu->r[4] = cpu->r[4] + 0x00000B34u;
-        /* 0209B3D4 */ _t91 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209B3D4 */ _t91 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209B3D4 */ _t92 = _t91 & 0x00000001u;
         /* 0209B3D4 */ if (_t92) goto L_0209B3D8; // else: addr-0 trap, fall-through
   L_0209B3D8: ; // 0x209b3d8
         /* 0209B3D8 */ Gambit_fn_0282A5F4(cpu);
         /* 0209B3DC */ goto L_0209B490;
   L_0209B3E0: ; // 0x209b3e0
-        /* 0209B3E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000002u);
-        /* 0209B3E4 */ _t93 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B3E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000002u));
+        /* 0209B3E4 */ _t93 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B3E4 */ _t94 = _t93 & 0x00000001u;
         /* 0209B3E4 */ if (_t94) goto L_0209B3E8; else goto L_0209B41C;
   L_0209B3E8: ; // 0x209b3e8
@@ -3870,7 +3870,7 @@ void Gambit_fn_0209B19C(CPUState* cpu) {
         /* 0209B3EC */ cpu->r[5] = rbrew_read32(cpu->mem, _t95);
         /* 0209B3F0 */ cpu->r[3] = cpu->r[31] + 0x00000030u;
         /* 0209B3F4 */ cpu->r[4] = cpu->r[4] + 0x00000B7Cu;
-        /* 0209B3F8 */ _t96 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209B3F8 */ _t96 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209B3F8 */ _t97 = _t96 & 0x00000001u;
         /* 0209B3F8 */ if (_t97) goto L_0209B3FC; // else: addr-0 trap, fall-through
   L_0209B3FC: ; // 0x209b3fc
@@ -3880,15 +3880,15 @@ void Gambit_fn_0209B19C(CPUState* cpu) {
         /* 0209B404 */ cpu->r[5] = rbrew_read32(cpu->mem, _t98);
         /* 0209B408 */ cpu->r[3] = cpu->r[31] + 0x0000005Cu;
         /* 0209B40C */ cpu->r[4] = cpu->r[4] + 0x00000B44u;
-        /* 0209B410 */ _t99 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209B410 */ _t99 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209B410 */ _t100 = _t99 & 0x00000001u;
         /* 0209B410 */ if (_t100) goto L_0209B414; // else: addr-0 trap, fall-through
   L_0209B414: ; // 0x209b414
         /* 0209B414 */ Gambit_fn_0282A5F4(cpu);
         /* 0209B418 */ goto L_0209B490;
   L_0209B41C: ; // 0x209b41c
-        /* 0209B41C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000003u);
-        /* 0209B420 */ _t101 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B41C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000003u));
+        /* 0209B420 */ _t101 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B420 */ _t102 = _t101 & 0x00000001u;
         /* 0209B420 */ if (_t102) goto L_0209B424; else goto L_0209B458;
   L_0209B424: ; // 0x209b424
@@ -3897,7 +3897,7 @@ void Gambit_fn_0209B19C(CPUState* cpu) {
         /* 0209B428 */ cpu->r[5] = rbrew_read32(cpu->mem, _t103);
         /* 0209B42C */ cpu->r[3] = cpu->r[31] + 0x00000030u;
         /* 0209B430 */ cpu->r[4] = cpu->r[4] + 0x00000B88u;
-        /* 0209B434 */ _t104 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209B434 */ _t104 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209B434 */ _t105 = _t104 & 0x00000001u;
         /* 0209B434 */ if (_t105) goto L_0209B438; // else: addr-0 trap, fall-through
   L_0209B438: ; // 0x209b438
@@ -3907,15 +3907,15 @@ void Gambit_fn_0209B19C(CPUState* cpu) {
         /* 0209B440 */ cpu->r[5] = rbrew_read32(cpu->mem, _t106);
         /* 0209B444 */ cpu->r[3] = cpu->r[31] + 0x0000005Cu;
         /* 0209B448 */ cpu->r[4] = cpu->r[4] + 0x00000B50u;
-        /* 0209B44C */ _t107 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209B44C */ _t107 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209B44C */ _t108 = _t107 & 0x00000001u;
         /* 0209B44C */ if (_t108) goto L_0209B450; // else: addr-0 trap, fall-through
   L_0209B450: ; // 0x209b450
         /* 0209B450 */ Gambit_fn_0282A5F4(cpu);
         /* 0209B454 */ goto L_0209B490;
   L_0209B458: ; // 0x209b458
-        /* 0209B458 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000004u);
-        /* 0209B45C */ _t109 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B458 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000004u));
+        /* 0209B45C */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B45C */ _t110 = _t109 & 0x00000001u;
         /* 0209B45C */ if (_t110) goto L_0209B460; else goto L_0209B490;
   L_0209B460: ; // 0x209b460
@@ -3924,7 +3924,7 @@ void Gambit_fn_0209B19C(CPUState* cpu) {
         /* 0209B464 */ cpu->r[5] = rbrew_read32(cpu->mem, _t111);
         /* 0209B468 */ cpu->r[3] = cpu->r[31] + 0x00000030u;
         /* 0209B46C */ cpu->r[4] = cpu->r[4] + 0x00000B94u;
-        /* 0209B470 */ _t112 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209B470 */ _t112 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209B470 */ _t113 = _t112 & 0x00000001u;
         /* 0209B470 */ if (_t113) goto L_0209B474; // else: addr-0 trap, fall-through
   L_0209B474: ; // 0x209b474
@@ -3934,7 +3934,7 @@ void Gambit_fn_0209B19C(CPUState* cpu) {
         /* 0209B47C */ cpu->r[5] = rbrew_read32(cpu->mem, _t114);
         /* 0209B480 */ cpu->r[3] = cpu->r[31] + 0x0000005Cu;
         /* 0209B484 */ cpu->r[4] = cpu->r[4] + 0x00000B5Cu;
-        /* 0209B488 */ _t115 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209B488 */ _t115 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209B488 */ _t116 = _t115 & 0x00000001u;
         /* 0209B488 */ if (_t116) goto L_0209B48C; // else: addr-0 trap, fall-through
   L_0209B48C: ; // 0x209b48c
@@ -4087,15 +4087,15 @@ void Gambit_fn_0209B544(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209B544: ; // 0x209b544
-        /* 0209B544 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209B548 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B544 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209B548 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B548 */ _t1 = _t0 & 0x00000001u;
         /* 0209B548 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209B548 */ goto L_0209B54C;
   L_0209B54C: ; // 0x209b54c
         /* 0209B54C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209B54C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209B550 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B54C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209B550 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B550 */ _t3 = _t2 & 0x00000001u;
         /* 0209B550 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209B550 */ goto L_0209B554;
@@ -4114,8 +4114,8 @@ void Gambit_fn_0209B544(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4129,15 +4129,15 @@ void Gambit_fn_0209B544(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4248,15 +4248,15 @@ void Gambit_fn_0209B598(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209B598: ; // 0x209b598
-        /* 0209B598 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209B59C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B598 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209B59C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B59C */ _t1 = _t0 & 0x00000001u;
         /* 0209B59C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209B59C */ goto L_0209B5A0;
   L_0209B5A0: ; // 0x209b5a0
         /* 0209B5A0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209B5A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209B5A4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B5A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209B5A4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B5A4 */ _t3 = _t2 & 0x00000001u;
         /* 0209B5A4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209B5A4 */ goto L_0209B5A8;
@@ -4275,8 +4275,8 @@ void Gambit_fn_0209B598(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4290,15 +4290,15 @@ void Gambit_fn_0209B598(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4344,15 +4344,15 @@ void Gambit_fn_0209B5C8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209B5C8: ; // 0x209b5c8
-        /* 0209B5C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209B5CC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B5C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209B5CC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B5CC */ _t1 = _t0 & 0x00000001u;
         /* 0209B5CC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209B5CC */ goto L_0209B5D0;
   L_0209B5D0: ; // 0x209b5d0
         /* 0209B5D0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209B5D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209B5D4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B5D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209B5D4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B5D4 */ _t3 = _t2 & 0x00000001u;
         /* 0209B5D4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209B5D4 */ goto L_0209B5D8;
@@ -4371,8 +4371,8 @@ void Gambit_fn_0209B5C8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4386,15 +4386,15 @@ void Gambit_fn_0209B5C8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4422,15 +4422,15 @@ void Gambit_fn_0209B5DC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209B5DC: ; // 0x209b5dc
-        /* 0209B5DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209B5E0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B5DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209B5E0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B5E0 */ _t1 = _t0 & 0x00000001u;
         /* 0209B5E0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209B5E0 */ goto L_0209B5E4;
   L_0209B5E4: ; // 0x209b5e4
         /* 0209B5E4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209B5E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209B5E8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B5E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209B5E8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B5E8 */ _t3 = _t2 & 0x00000001u;
         /* 0209B5E8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209B5E8 */ goto L_0209B5EC;
@@ -4449,8 +4449,8 @@ void Gambit_fn_0209B5DC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4464,15 +4464,15 @@ void Gambit_fn_0209B5DC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4500,15 +4500,15 @@ void Gambit_fn_0209B5F0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209B5F0: ; // 0x209b5f0
-        /* 0209B5F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209B5F4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B5F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209B5F4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B5F4 */ _t1 = _t0 & 0x00000001u;
         /* 0209B5F4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209B5F4 */ goto L_0209B5F8;
   L_0209B5F8: ; // 0x209b5f8
         /* 0209B5F8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209B5F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209B5FC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B5F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209B5FC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B5FC */ _t3 = _t2 & 0x00000001u;
         /* 0209B5FC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209B5FC */ goto L_0209B600;
@@ -4527,8 +4527,8 @@ void Gambit_fn_0209B5F0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4542,15 +4542,15 @@ void Gambit_fn_0209B5F0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4578,15 +4578,15 @@ void Gambit_fn_0209B604(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209B604: ; // 0x209b604
-        /* 0209B604 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209B608 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209B608 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B608 */ _t1 = _t0 & 0x00000001u;
         /* 0209B608 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209B608 */ goto L_0209B60C;
   L_0209B60C: ; // 0x209b60c
         /* 0209B60C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209B60C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209B610 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B60C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209B610 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B610 */ _t3 = _t2 & 0x00000001u;
         /* 0209B610 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209B610 */ goto L_0209B614;
@@ -4605,8 +4605,8 @@ void Gambit_fn_0209B604(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4620,15 +4620,15 @@ void Gambit_fn_0209B604(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4678,11 +4678,11 @@ void Gambit_fn_0209B620(CPUState* cpu) {
         /* 0209BA58 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0209BA58 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0209BA5C */ cpu->r[30] = cpu->r[3];
-        /* 0209BA5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209BA5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209BA60 */ cpu->r[31] = cpu->r[4];
         /* 0209BA64 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209BA64 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209BA68 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BA68 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BA68 */ _t5 = _t4 & 0x00000001u;
         /* 0209BA68 */ if (_t5) goto L_0209BAD8; else goto L_0209BA6C;
   L_0209BA6C: ; // 0x209ba6c
@@ -4696,10 +4696,10 @@ void Gambit_fn_0209B620(CPUState* cpu) {
         /* 0209BA84 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0209BA84 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0209BA88 */ cpu->r[11] = cpu->r[11] + 0x00000F40u;
-        /* 0209BA8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209BA8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209BA90 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0209BA90 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0209BA94 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BA94 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BA94 */ _t10 = _t9 & 0x00000001u;
         /* 0209BA94 */ if (_t10) goto L_0209BAC8; else goto L_0209BA98;
   L_0209BA98: ; // 0x209ba98
@@ -4720,8 +4720,8 @@ void Gambit_fn_0209B620(CPUState* cpu) {
         /* 0209BAC4 */ Gambit_fn_02068798(cpu);
   L_0209BAC8: ; // 0x209bac8
         /* 0209BAC8 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209BAC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209BACC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BAC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209BACC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BACC */ _t15 = _t14 & 0x00000001u;
         /* 0209BACC */ if (_t15) goto L_0209BAD8; else goto L_0209BAD0;
   L_0209BAD0: ; // 0x209bad0
@@ -4749,8 +4749,8 @@ void Gambit_fn_0209B628(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -4801,18 +4801,18 @@ void Gambit_fn_0209B640(CPUState* cpu) {
         /* 0209B648 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0209B648 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0209B64C */ cpu->r[31] = cpu->r[3];
-        /* 0209B64C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209B64C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209B650 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0209B650 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0209B654 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B654 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B654 */ _t4 = _t3 & 0x00000001u;
         /* 0209B654 */ if (_t4) goto L_0209B658; else goto L_0209B668;
   L_0209B658: ; // 0x209b658
         /* 0209B658 */ cpu->r[3] = 0x0000022Cu;
         /* 0209B65C */ Gambit_fn_02801A78(cpu);
         /* 0209B660 */ cpu->r[31] = cpu->r[3];
-        /* 0209B660 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209B664 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B660 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209B664 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B664 */ _t6 = _t5 & 0x00000001u;
         /* 0209B664 */ if (_t6) goto L_0209B6C4; else goto L_0209B668;
   L_0209B668: ; // 0x209b668
@@ -4869,18 +4869,18 @@ void Gambit_fn_0209B644(CPUState* cpu) {
         /* 0209B648 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0209B648 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0209B64C */ cpu->r[31] = cpu->r[3];
-        /* 0209B64C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209B64C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209B650 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0209B650 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0209B654 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B654 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B654 */ _t4 = _t3 & 0x00000001u;
         /* 0209B654 */ if (_t4) goto L_0209B658; else goto L_0209B668;
   L_0209B658: ; // 0x209b658
         /* 0209B658 */ cpu->r[3] = 0x0000022Cu;
         /* 0209B65C */ Gambit_fn_02801A78(cpu);
         /* 0209B660 */ cpu->r[31] = cpu->r[3];
-        /* 0209B660 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209B664 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B660 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209B664 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B664 */ _t6 = _t5 & 0x00000001u;
         /* 0209B664 */ if (_t6) goto L_0209B6C4; else goto L_0209B668;
   L_0209B668: ; // 0x209b668
@@ -5014,16 +5014,16 @@ void Gambit_fn_0209B744(CPUState* cpu) {
         /* 0209B744 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 0209B744 */ cpu->r[1] = _t0;
         /* 0209B748 */ cpu->r[0] = cpu->r[0] + 0x00000CA0u;
-        /* 0209B74C */ _t1 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209B74C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209B74C */ _t2 = _t1 & 0x00000001u;
         /* 0209B74C */ if (_t2) goto L_0209B76C; else goto L_0209B750;
   L_0209B750: ; // 0x209b750
-        /* 0209B750 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B750 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B750 */ _t4 = _t3 & 0x00000001u;
         /* 0209B750 */ if (_t4) goto L_0209B788; else goto L_0209B754;
   L_0209B754: ; // 0x209b754
-        /* 0209B754 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000002u);
-        /* 0209B758 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209B754 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000002u));
+        /* 0209B758 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209B758 */ _t6 = _t5 & 0x00000001u;
         /* 0209B758 */ if (_t6) goto L_0209B7A4; else goto L_0209B75C;
   L_0209B75C: ; // 0x209b75c
@@ -5579,15 +5579,15 @@ void Gambit_fn_0209BA38(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209BA38: ; // 0x209ba38
-        /* 0209BA38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209BA3C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BA38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209BA3C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BA3C */ _t1 = _t0 & 0x00000001u;
         /* 0209BA3C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209BA3C */ goto L_0209BA40;
   L_0209BA40: ; // 0x209ba40
         /* 0209BA40 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209BA40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209BA44 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BA40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209BA44 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BA44 */ _t3 = _t2 & 0x00000001u;
         /* 0209BA44 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209BA44 */ goto L_0209BA48;
@@ -5606,8 +5606,8 @@ void Gambit_fn_0209BA38(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -5621,15 +5621,15 @@ void Gambit_fn_0209BA38(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -5666,11 +5666,11 @@ void Gambit_fn_0209BA4C(CPUState* cpu) {
         /* 0209BA58 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0209BA58 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0209BA5C */ cpu->r[30] = cpu->r[3];
-        /* 0209BA5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209BA5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209BA60 */ cpu->r[31] = cpu->r[4];
         /* 0209BA64 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209BA64 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209BA68 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BA68 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BA68 */ _t5 = _t4 & 0x00000001u;
         /* 0209BA68 */ if (_t5) goto L_0209BAD8; else goto L_0209BA6C;
   L_0209BA6C: ; // 0x209ba6c
@@ -5684,10 +5684,10 @@ void Gambit_fn_0209BA4C(CPUState* cpu) {
         /* 0209BA84 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0209BA84 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0209BA88 */ cpu->r[11] = cpu->r[11] + 0x00000F40u;
-        /* 0209BA8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209BA8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209BA90 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0209BA90 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0209BA94 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BA94 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BA94 */ _t10 = _t9 & 0x00000001u;
         /* 0209BA94 */ if (_t10) goto L_0209BAC8; else goto L_0209BA98;
   L_0209BA98: ; // 0x209ba98
@@ -5708,8 +5708,8 @@ void Gambit_fn_0209BA4C(CPUState* cpu) {
         /* 0209BAC4 */ Gambit_fn_02068798(cpu);
   L_0209BAC8: ; // 0x209bac8
         /* 0209BAC8 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209BAC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209BACC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BAC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209BACC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BACC */ _t15 = _t14 & 0x00000001u;
         /* 0209BACC */ if (_t15) goto L_0209BAD8; else goto L_0209BAD0;
   L_0209BAD0: ; // 0x209bad0
@@ -5740,11 +5740,11 @@ void Gambit_fn_0209BA50(CPUState* cpu) {
         /* 0209BA58 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0209BA58 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0209BA5C */ cpu->r[30] = cpu->r[3];
-        /* 0209BA5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209BA5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209BA60 */ cpu->r[31] = cpu->r[4];
         /* 0209BA64 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209BA64 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209BA68 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BA68 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BA68 */ _t5 = _t4 & 0x00000001u;
         /* 0209BA68 */ if (_t5) goto L_0209BAD8; else goto L_0209BA6C;
   L_0209BA6C: ; // 0x209ba6c
@@ -5758,10 +5758,10 @@ void Gambit_fn_0209BA50(CPUState* cpu) {
         /* 0209BA84 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0209BA84 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0209BA88 */ cpu->r[11] = cpu->r[11] + 0x00000F40u;
-        /* 0209BA8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209BA8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209BA90 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0209BA90 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0209BA94 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BA94 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BA94 */ _t10 = _t9 & 0x00000001u;
         /* 0209BA94 */ if (_t10) goto L_0209BAC8; else goto L_0209BA98;
   L_0209BA98: ; // 0x209ba98
@@ -5782,8 +5782,8 @@ void Gambit_fn_0209BA50(CPUState* cpu) {
         /* 0209BAC4 */ Gambit_fn_02068798(cpu);
   L_0209BAC8: ; // 0x209bac8
         /* 0209BAC8 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209BAC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209BACC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BAC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209BACC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BACC */ _t15 = _t14 & 0x00000001u;
         /* 0209BACC */ if (_t15) goto L_0209BAD8; else goto L_0209BAD0;
   L_0209BAD0: ; // 0x209bad0
@@ -5916,9 +5916,9 @@ void Gambit_fn_0209BB48(CPUState* cpu) {
         /* 0209BB4C */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 0209BB4C */ cpu->r[9] = _t0;
         /* 0209BB50 */ cpu->r[12] = 0x101D0000u;
-        /* 0209BB54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0209BB54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0209BB58 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 0209BB5C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BB5C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BB5C */ _t2 = _t1 & 0x00000001u;
         /* 0209BB5C */ if (_t2) goto L_0209BB60; else goto L_0209BB74;
   L_0209BB60: ; // 0x209bb60
@@ -5930,8 +5930,8 @@ void Gambit_fn_0209BB48(CPUState* cpu) {
         /* 0209BB70 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 0209BB70 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_0209BB74: ; // 0x209bb74
-        /* 0209BB74 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0209BB78 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BB74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0209BB78 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BB78 */ _t6 = _t5 & 0x00000001u;
         /* 0209BB78 */ if (_t6) goto L_0209BB7C; else goto L_0209BB84;
   L_0209BB7C: ; // 0x209bb7c
@@ -5943,9 +5943,9 @@ void Gambit_fn_0209BB48(CPUState* cpu) {
         /* 0209BB88 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 0209BB88 */ cpu->r[7] = _t7;
         /* 0209BB8C */ cpu->r[11] = 0x101D0000u;
-        /* 0209BB90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0209BB90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0209BB94 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 0209BB98 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BB98 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BB98 */ _t9 = _t8 & 0x00000001u;
         /* 0209BB98 */ if (_t9) goto L_0209BB9C; else goto L_0209BBB0;
   L_0209BB9C: ; // 0x209bb9c
@@ -6072,18 +6072,18 @@ void Gambit_fn_0209BC04(CPUState* cpu) {
         /* 02008980 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02008980 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02008984 */ cpu->r[12] = 0x00000000u;
-        /* 02008988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02008988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0200898C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0200898C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02008990 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02008990 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02008990 */ _t6 = _t5 & 0x00000001u;
         /* 02008990 */ if (_t6) goto L_020089B8; else goto L_02008994;
   L_02008994: ; // 0x2008994
         /* 02008994 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02008994 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02008998 */ /* nop */
-        /* 0200899C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 020089A0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0200899C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 020089A0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020089A0 */ _t9 = _t8 & 0x00000001u;
         /* 020089A0 */ if (_t9) goto L_020089A4; else goto L_020089B8;
   L_020089A4: ; // 0x20089a4
@@ -6128,11 +6128,11 @@ void Gambit_fn_0209BC0C(CPUState* cpu) {
         /* 0209BF8C */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0209BF8C */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0209BF90 */ cpu->r[30] = cpu->r[3];
-        /* 0209BF90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209BF90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209BF94 */ cpu->r[31] = cpu->r[4];
         /* 0209BF98 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209BF98 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209BF9C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BF9C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BF9C */ _t5 = _t4 & 0x00000001u;
         /* 0209BF9C */ if (_t5) goto L_0209C00C; else goto L_0209BFA0;
   L_0209BFA0: ; // 0x209bfa0
@@ -6146,10 +6146,10 @@ void Gambit_fn_0209BC0C(CPUState* cpu) {
         /* 0209BFB8 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0209BFB8 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0209BFBC */ cpu->r[11] = cpu->r[11] + 0x000011B8u;
-        /* 0209BFC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209BFC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209BFC4 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0209BFC4 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0209BFC8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BFC8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BFC8 */ _t10 = _t9 & 0x00000001u;
         /* 0209BFC8 */ if (_t10) goto L_0209BFFC; else goto L_0209BFCC;
   L_0209BFCC: ; // 0x209bfcc
@@ -6170,8 +6170,8 @@ void Gambit_fn_0209BC0C(CPUState* cpu) {
         /* 0209BFF8 */ Gambit_fn_02068798(cpu);
   L_0209BFFC: ; // 0x209bffc
         /* 0209BFFC */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209BFFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209C000 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BFFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209C000 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C000 */ _t15 = _t14 & 0x00000001u;
         /* 0209C000 */ if (_t15) goto L_0209C00C; else goto L_0209C004;
   L_0209C004: ; // 0x209c004
@@ -6199,8 +6199,8 @@ void Gambit_fn_0209BC14(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -6251,18 +6251,18 @@ void Gambit_fn_0209BC2C(CPUState* cpu) {
         /* 0209BC34 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0209BC34 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0209BC38 */ cpu->r[31] = cpu->r[3];
-        /* 0209BC38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209BC38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209BC3C */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0209BC3C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0209BC40 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BC40 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BC40 */ _t4 = _t3 & 0x00000001u;
         /* 0209BC40 */ if (_t4) goto L_0209BC44; else goto L_0209BC54;
   L_0209BC44: ; // 0x209bc44
         /* 0209BC44 */ cpu->r[3] = 0x0000022Cu;
         /* 0209BC48 */ Gambit_fn_02801A78(cpu);
         /* 0209BC4C */ cpu->r[31] = cpu->r[3];
-        /* 0209BC4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209BC50 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BC4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209BC50 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BC50 */ _t6 = _t5 & 0x00000001u;
         /* 0209BC50 */ if (_t6) goto L_0209BCB4; else goto L_0209BC54;
   L_0209BC54: ; // 0x209bc54
@@ -6319,18 +6319,18 @@ void Gambit_fn_0209BC30(CPUState* cpu) {
         /* 0209BC34 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0209BC34 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0209BC38 */ cpu->r[31] = cpu->r[3];
-        /* 0209BC38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209BC38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209BC3C */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0209BC3C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0209BC40 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BC40 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BC40 */ _t4 = _t3 & 0x00000001u;
         /* 0209BC40 */ if (_t4) goto L_0209BC44; else goto L_0209BC54;
   L_0209BC44: ; // 0x209bc44
         /* 0209BC44 */ cpu->r[3] = 0x0000022Cu;
         /* 0209BC48 */ Gambit_fn_02801A78(cpu);
         /* 0209BC4C */ cpu->r[31] = cpu->r[3];
-        /* 0209BC4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209BC50 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BC4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209BC50 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BC50 */ _t6 = _t5 & 0x00000001u;
         /* 0209BC50 */ if (_t6) goto L_0209BCB4; else goto L_0209BC54;
   L_0209BC54: ; // 0x209bc54
@@ -6540,17 +6540,17 @@ void Gambit_fn_0209BD74(CPUState* cpu) {
         /* 0209BD7C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0209BD80 */ _t3 = cpu->r[3] + 0x00000228u;
         /* 0209BD80 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 0209BD84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0209BD84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0209BD88 */ cpu->r[31] = 0x00000000u;
-        /* 0209BD8C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BD8C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BD8C */ _t5 = _t4 & 0x00000001u;
         /* 0209BD8C */ if (_t5) goto L_0209BD90; else goto L_0209BDA4;
   L_0209BD90: ; // 0x209bd90
         /* 0209BD90 */ _t6 = cpu->r[3] + 0x00000224u;
         /* 0209BD90 */ cpu->r[3] = rbrew_read32(cpu->mem, _t6);
         /* 0209BD94 */ Gambit_fn_020C3920(cpu);
-        /* 0209BD98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209BD9C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BD98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209BD9C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BD9C */ _t8 = _t7 & 0x00000001u;
         /* 0209BD9C */ if (_t8) goto L_0209BDA4; else goto L_0209BDA0;
   L_0209BDA0: ; // 0x209bda0
@@ -6673,9 +6673,9 @@ void Gambit_fn_0209BE14(CPUState* cpu) {
         /* 0209BE50 */ cpu->r[12] = _t6;
         /* 0209BE54 */ cpu->r[31] = cpu->r[3];
         /* 0209BE58 */ cpu->r[4] = 0x101D0000u;
-        /* 0209BE5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0209BE5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0209BE60 */ cpu->r[4] = cpu->r[4] + 0xFFFFEE1Cu;
-        /* 0209BE64 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BE64 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BE64 */ _t8 = _t7 & 0x00000001u;
         /* 0209BE64 */ if (_t8) goto L_0209BE68; else goto L_0209BE7C;
   L_0209BE68: ; // 0x209be68
@@ -6687,8 +6687,8 @@ void Gambit_fn_0209BE14(CPUState* cpu) {
         /* 0209BE78 */ _t10 = cpu->r[4] + 0x00000000u;
         /* 0209BE78 */ rbrew_write32(cpu->mem, _t10, cpu->r[9]);
   L_0209BE7C: ; // 0x209be7c
-        /* 0209BE7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209BE80 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BE7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209BE80 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BE80 */ _t12 = _t11 & 0x00000001u;
         /* 0209BE80 */ if (_t12) goto L_0209BEB4; else goto L_0209BE84;
   L_0209BE84: ; // 0x209be84
@@ -6699,8 +6699,8 @@ void Gambit_fn_0209BE14(CPUState* cpu) {
         /* 0209BE8C */ cpu->ctr = cpu->r[0];
         /* 0209BE90 */ cpu->r[3] = cpu->r[31];
         /* 0209BE94 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0209BE98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209BE9C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BE98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209BE9C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BE9C */ _t16 = _t15 & 0x00000001u;
         /* 0209BE9C */ if (_t16) goto L_0209BEB4; else goto L_0209BEA0;
   L_0209BEA0: ; // 0x209bea0
@@ -6759,9 +6759,9 @@ void Gambit_fn_0209BE18(CPUState* cpu) {
         /* 0209BE50 */ cpu->r[12] = _t6;
         /* 0209BE54 */ cpu->r[31] = cpu->r[3];
         /* 0209BE58 */ cpu->r[4] = 0x101D0000u;
-        /* 0209BE5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0209BE5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0209BE60 */ cpu->r[4] = cpu->r[4] + 0xFFFFEE1Cu;
-        /* 0209BE64 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BE64 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BE64 */ _t8 = _t7 & 0x00000001u;
         /* 0209BE64 */ if (_t8) goto L_0209BE68; else goto L_0209BE7C;
   L_0209BE68: ; // 0x209be68
@@ -6773,8 +6773,8 @@ void Gambit_fn_0209BE18(CPUState* cpu) {
         /* 0209BE78 */ _t10 = cpu->r[4] + 0x00000000u;
         /* 0209BE78 */ rbrew_write32(cpu->mem, _t10, cpu->r[9]);
   L_0209BE7C: ; // 0x209be7c
-        /* 0209BE7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209BE80 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BE7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209BE80 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BE80 */ _t12 = _t11 & 0x00000001u;
         /* 0209BE80 */ if (_t12) goto L_0209BEB4; else goto L_0209BE84;
   L_0209BE84: ; // 0x209be84
@@ -6785,8 +6785,8 @@ void Gambit_fn_0209BE18(CPUState* cpu) {
         /* 0209BE8C */ cpu->ctr = cpu->r[0];
         /* 0209BE90 */ cpu->r[3] = cpu->r[31];
         /* 0209BE94 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0209BE98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209BE9C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BE98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209BE9C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BE9C */ _t16 = _t15 & 0x00000001u;
         /* 0209BE9C */ if (_t16) goto L_0209BEB4; else goto L_0209BEA0;
   L_0209BEA0: ; // 0x209bea0
@@ -6831,10 +6831,10 @@ void Gambit_fn_0209BEDC(CPUState* cpu) {
         /* 0209BEF0 */ _t3 = cpu->r[31] + 0x00000228u;
         /* 0209BEF0 */ cpu->r[10] = rbrew_read8(cpu->mem, _t3);
         /* 0209BEF4 */ cpu->r[0] = 0x00000000u;
-        /* 0209BEF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0209BEF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0209BEFC */ _t4 = cpu->r[31] + 0x00000229u;
         /* 0209BEFC */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[0]);
-        /* 0209BF00 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BF00 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BF00 */ _t6 = _t5 & 0x00000001u;
         /* 0209BF00 */ if (_t6) goto L_0209BF04; else goto L_0209BF34;
   L_0209BF04: ; // 0x209bf04
@@ -6846,10 +6846,10 @@ void Gambit_fn_0209BEDC(CPUState* cpu) {
         /* 0209BF0C */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
         /* 0209BF10 */ cpu->ctr = cpu->r[0];
         /* 0209BF14 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0209BF18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0209BF18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0209BF1C */ _t10 = cpu->r[31] + 0x00000228u;
         /* 0209BF1C */ cpu->r[10] = rbrew_read8(cpu->mem, _t10);
-        /* 0209BF20 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BF20 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BF20 */ _t12 = _t11 & 0x00000001u;
         /* 0209BF20 */ if (_t12) goto L_0209BF2C; else goto L_0209BF24;
   L_0209BF24: ; // 0x209bf24
@@ -6857,16 +6857,16 @@ void Gambit_fn_0209BEDC(CPUState* cpu) {
         /* 0209BF28 */ _t13 = cpu->r[31] + 0x00000229u;
         /* 0209BF28 */ rbrew_write8(cpu->mem, _t13, (uint8_t)cpu->r[12]);
   L_0209BF2C: ; // 0x209bf2c
-        /* 0209BF2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0209BF30 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BF2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0209BF30 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BF30 */ _t15 = _t14 & 0x00000001u;
         /* 0209BF30 */ if (_t15) goto L_0209BF58; else goto L_0209BF34;
   L_0209BF34: ; // 0x209bf34
         /* 0209BF34 */ _t16 = cpu->r[31] + 0x00000224u;
         /* 0209BF34 */ cpu->r[3] = rbrew_read32(cpu->mem, _t16);
         /* 0209BF38 */ Gambit_fn_020C38CC(cpu);
-        /* 0209BF3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209BF40 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BF3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209BF40 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BF40 */ _t18 = _t17 & 0x00000001u;
         /* 0209BF40 */ if (_t18) goto L_0209BF58; else goto L_0209BF44;
   L_0209BF44: ; // 0x209bf44
@@ -6903,10 +6903,10 @@ void Gambit_fn_0209BEE0(CPUState* cpu) {
         /* 0209BEF0 */ _t3 = cpu->r[31] + 0x00000228u;
         /* 0209BEF0 */ cpu->r[10] = rbrew_read8(cpu->mem, _t3);
         /* 0209BEF4 */ cpu->r[0] = 0x00000000u;
-        /* 0209BEF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0209BEF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0209BEFC */ _t4 = cpu->r[31] + 0x00000229u;
         /* 0209BEFC */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[0]);
-        /* 0209BF00 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BF00 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BF00 */ _t6 = _t5 & 0x00000001u;
         /* 0209BF00 */ if (_t6) goto L_0209BF04; else goto L_0209BF34;
   L_0209BF04: ; // 0x209bf04
@@ -6918,10 +6918,10 @@ void Gambit_fn_0209BEE0(CPUState* cpu) {
         /* 0209BF0C */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
         /* 0209BF10 */ cpu->ctr = cpu->r[0];
         /* 0209BF14 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0209BF18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0209BF18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0209BF1C */ _t10 = cpu->r[31] + 0x00000228u;
         /* 0209BF1C */ cpu->r[10] = rbrew_read8(cpu->mem, _t10);
-        /* 0209BF20 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BF20 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BF20 */ _t12 = _t11 & 0x00000001u;
         /* 0209BF20 */ if (_t12) goto L_0209BF2C; else goto L_0209BF24;
   L_0209BF24: ; // 0x209bf24
@@ -6929,16 +6929,16 @@ void Gambit_fn_0209BEE0(CPUState* cpu) {
         /* 0209BF28 */ _t13 = cpu->r[31] + 0x00000229u;
         /* 0209BF28 */ rbrew_write8(cpu->mem, _t13, (uint8_t)cpu->r[12]);
   L_0209BF2C: ; // 0x209bf2c
-        /* 0209BF2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0209BF30 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BF2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0209BF30 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BF30 */ _t15 = _t14 & 0x00000001u;
         /* 0209BF30 */ if (_t15) goto L_0209BF58; else goto L_0209BF34;
   L_0209BF34: ; // 0x209bf34
         /* 0209BF34 */ _t16 = cpu->r[31] + 0x00000224u;
         /* 0209BF34 */ cpu->r[3] = rbrew_read32(cpu->mem, _t16);
         /* 0209BF38 */ Gambit_fn_020C38CC(cpu);
-        /* 0209BF3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209BF40 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BF3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209BF40 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BF40 */ _t18 = _t17 & 0x00000001u;
         /* 0209BF40 */ if (_t18) goto L_0209BF58; else goto L_0209BF44;
   L_0209BF44: ; // 0x209bf44
@@ -6964,15 +6964,15 @@ void Gambit_fn_0209BF6C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209BF6C: ; // 0x209bf6c
-        /* 0209BF6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209BF70 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BF6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209BF70 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BF70 */ _t1 = _t0 & 0x00000001u;
         /* 0209BF70 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209BF70 */ goto L_0209BF74;
   L_0209BF74: ; // 0x209bf74
         /* 0209BF74 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209BF74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209BF78 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BF74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209BF78 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BF78 */ _t3 = _t2 & 0x00000001u;
         /* 0209BF78 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209BF78 */ goto L_0209BF7C;
@@ -6991,8 +6991,8 @@ void Gambit_fn_0209BF6C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -7006,15 +7006,15 @@ void Gambit_fn_0209BF6C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -7051,11 +7051,11 @@ void Gambit_fn_0209BF80(CPUState* cpu) {
         /* 0209BF8C */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0209BF8C */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0209BF90 */ cpu->r[30] = cpu->r[3];
-        /* 0209BF90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209BF90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209BF94 */ cpu->r[31] = cpu->r[4];
         /* 0209BF98 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209BF98 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209BF9C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BF9C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BF9C */ _t5 = _t4 & 0x00000001u;
         /* 0209BF9C */ if (_t5) goto L_0209C00C; else goto L_0209BFA0;
   L_0209BFA0: ; // 0x209bfa0
@@ -7069,10 +7069,10 @@ void Gambit_fn_0209BF80(CPUState* cpu) {
         /* 0209BFB8 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0209BFB8 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0209BFBC */ cpu->r[11] = cpu->r[11] + 0x000011B8u;
-        /* 0209BFC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209BFC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209BFC4 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0209BFC4 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0209BFC8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BFC8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BFC8 */ _t10 = _t9 & 0x00000001u;
         /* 0209BFC8 */ if (_t10) goto L_0209BFFC; else goto L_0209BFCC;
   L_0209BFCC: ; // 0x209bfcc
@@ -7093,8 +7093,8 @@ void Gambit_fn_0209BF80(CPUState* cpu) {
         /* 0209BFF8 */ Gambit_fn_02068798(cpu);
   L_0209BFFC: ; // 0x209bffc
         /* 0209BFFC */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209BFFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209C000 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BFFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209C000 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C000 */ _t15 = _t14 & 0x00000001u;
         /* 0209C000 */ if (_t15) goto L_0209C00C; else goto L_0209C004;
   L_0209C004: ; // 0x209c004
@@ -7125,11 +7125,11 @@ void Gambit_fn_0209BF84(CPUState* cpu) {
         /* 0209BF8C */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0209BF8C */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0209BF90 */ cpu->r[30] = cpu->r[3];
-        /* 0209BF90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209BF90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209BF94 */ cpu->r[31] = cpu->r[4];
         /* 0209BF98 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209BF98 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209BF9C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BF9C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BF9C */ _t5 = _t4 & 0x00000001u;
         /* 0209BF9C */ if (_t5) goto L_0209C00C; else goto L_0209BFA0;
   L_0209BFA0: ; // 0x209bfa0
@@ -7143,10 +7143,10 @@ void Gambit_fn_0209BF84(CPUState* cpu) {
         /* 0209BFB8 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0209BFB8 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0209BFBC */ cpu->r[11] = cpu->r[11] + 0x000011B8u;
-        /* 0209BFC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209BFC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209BFC4 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0209BFC4 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0209BFC8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BFC8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209BFC8 */ _t10 = _t9 & 0x00000001u;
         /* 0209BFC8 */ if (_t10) goto L_0209BFFC; else goto L_0209BFCC;
   L_0209BFCC: ; // 0x209bfcc
@@ -7167,8 +7167,8 @@ void Gambit_fn_0209BF84(CPUState* cpu) {
         /* 0209BFF8 */ Gambit_fn_02068798(cpu);
   L_0209BFFC: ; // 0x209bffc
         /* 0209BFFC */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209BFFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209C000 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209BFFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209C000 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C000 */ _t15 = _t14 & 0x00000001u;
         /* 0209C000 */ if (_t15) goto L_0209C00C; else goto L_0209C004;
   L_0209C004: ; // 0x209c004
@@ -7264,9 +7264,9 @@ void Gambit_fn_0209C060(CPUState* cpu) {
         /* 0209C064 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 0209C064 */ cpu->r[9] = _t0;
         /* 0209C068 */ cpu->r[12] = 0x101D0000u;
-        /* 0209C06C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0209C06C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0209C070 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 0209C074 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C074 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C074 */ _t2 = _t1 & 0x00000001u;
         /* 0209C074 */ if (_t2) goto L_0209C078; else goto L_0209C08C;
   L_0209C078: ; // 0x209c078
@@ -7278,8 +7278,8 @@ void Gambit_fn_0209C060(CPUState* cpu) {
         /* 0209C088 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 0209C088 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_0209C08C: ; // 0x209c08c
-        /* 0209C08C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0209C090 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C08C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0209C090 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C090 */ _t6 = _t5 & 0x00000001u;
         /* 0209C090 */ if (_t6) goto L_0209C094; else goto L_0209C09C;
   L_0209C094: ; // 0x209c094
@@ -7291,9 +7291,9 @@ void Gambit_fn_0209C060(CPUState* cpu) {
         /* 0209C0A0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 0209C0A0 */ cpu->r[7] = _t7;
         /* 0209C0A4 */ cpu->r[11] = 0x101D0000u;
-        /* 0209C0A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0209C0A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0209C0AC */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 0209C0B0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C0B0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C0B0 */ _t9 = _t8 & 0x00000001u;
         /* 0209C0B0 */ if (_t9) goto L_0209C0B4; else goto L_0209C0C8;
   L_0209C0B4: ; // 0x209c0b4
@@ -7384,18 +7384,18 @@ void Gambit_fn_0209C104(CPUState* cpu) {
         /* 0206C8A8 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0206C8A8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0206C8AC */ cpu->r[12] = 0x00000000u;
-        /* 0206C8B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0206C8B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0206C8B4 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0206C8B4 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0206C8B8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206C8B8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206C8B8 */ _t6 = _t5 & 0x00000001u;
         /* 0206C8B8 */ if (_t6) goto L_0206C8E0; else goto L_0206C8BC;
   L_0206C8BC: ; // 0x206c8bc
         /* 0206C8BC */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0206C8BC */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0206C8C0 */ /* nop */
-        /* 0206C8C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0206C8C8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206C8C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0206C8C8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206C8C8 */ _t9 = _t8 & 0x00000001u;
         /* 0206C8C8 */ if (_t9) goto L_0206C8CC; else goto L_0206C8E0;
   L_0206C8CC: ; // 0x206c8cc
@@ -7487,8 +7487,8 @@ void Gambit_fn_0209C124(CPUState* cpu) {
         /* 0209C170 */ Gambit_fn_026D6F40(cpu);
         /* 0209C174 */ cpu->r[3] = 0x0000021Cu;
         /* 0209C178 */ Gambit_fn_02801A78(cpu);
-        /* 0209C17C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209C180 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C17C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209C180 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C180 */ _t6 = _t5 & 0x00000001u;
         /* 0209C180 */ if (_t6) goto L_0209C188; else goto L_0209C184;
   L_0209C184: ; // 0x209c184
@@ -7544,8 +7544,8 @@ void Gambit_fn_0209C128(CPUState* cpu) {
         /* 0209C170 */ Gambit_fn_026D6F40(cpu);
         /* 0209C174 */ cpu->r[3] = 0x0000021Cu;
         /* 0209C178 */ Gambit_fn_02801A78(cpu);
-        /* 0209C17C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209C180 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C17C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209C180 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C180 */ _t6 = _t5 & 0x00000001u;
         /* 0209C180 */ if (_t6) goto L_0209C188; else goto L_0209C184;
   L_0209C184: ; // 0x209c184
@@ -7602,8 +7602,8 @@ void Gambit_fn_0209C1B4(CPUState* cpu) {
         /* 0209C170 */ Gambit_fn_026D6F40(cpu);
         /* 0209C174 */ cpu->r[3] = 0x0000021Cu;
         /* 0209C178 */ Gambit_fn_02801A78(cpu);
-        /* 0209C17C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209C180 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C17C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209C180 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C180 */ _t6 = _t5 & 0x00000001u;
         /* 0209C180 */ if (_t6) goto L_0209C188; else goto L_0209C184;
   L_0209C184: ; // 0x209c184
@@ -7754,18 +7754,18 @@ void Gambit_fn_0209C20C(CPUState* cpu) {
         /* 0209C86C */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0209C86C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0209C870 */ cpu->r[12] = 0x00000000u;
-        /* 0209C874 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0209C874 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0209C878 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0209C878 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0209C87C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C87C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C87C */ _t6 = _t5 & 0x00000001u;
         /* 0209C87C */ if (_t6) goto L_0209C8A4; else goto L_0209C880;
   L_0209C880: ; // 0x209c880
         /* 0209C880 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0209C880 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0209C884 */ /* nop */
-        /* 0209C888 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0209C88C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C888 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0209C88C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C88C */ _t9 = _t8 & 0x00000001u;
         /* 0209C88C */ if (_t9) goto L_0209C890; else goto L_0209C8A4;
   L_0209C890: ; // 0x209c890
@@ -7870,17 +7870,17 @@ void Gambit_fn_0209C244(CPUState* cpu) {
         /* 0209C24C */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 0209C250 */ /* nop */
         /* 0209C254 */ cpu->r[29] = cpu->r[3];
-        /* 0209C254 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0209C254 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0209C258 */ cpu->r[28] = cpu->r[4];
-        /* 0209C25C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C25C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C25C */ _t3 = _t2 & 0x00000001u;
         /* 0209C25C */ if (_t3) goto L_0209C260; else goto L_0209C270;
   L_0209C260: ; // 0x209c260
         /* 0209C260 */ cpu->r[3] = 0x00000068u;
         /* 0209C264 */ Gambit_fn_02801A78(cpu);
         /* 0209C268 */ cpu->r[29] = cpu->r[3];
-        /* 0209C268 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0209C26C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C268 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0209C26C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C26C */ _t5 = _t4 & 0x00000001u;
         /* 0209C26C */ if (_t5) goto L_0209C51C; else goto L_0209C270;
   L_0209C270: ; // 0x209c270
@@ -7898,21 +7898,21 @@ void Gambit_fn_0209C244(CPUState* cpu) {
         /* 0209C298 */ rbrew_write32(cpu->mem, _t6, cpu->r[9]);
         /* 0209C29C */ cpu->r[0] = cpu->r[0] + 0x00001358u;
         /* 0209C2A0 */ cpu->r[31] = cpu->r[29] + 0x00000028u;
-        /* 0209C2A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209C2A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209C2A4 */ _t7 = cpu->r[29] + 0x0000000Cu;
         /* 0209C2A4 */ rbrew_write32(cpu->mem, _t7, cpu->r[10]);
         /* 0209C2A8 */ cpu->r[26] = 0x00000000u;
         /* 0209C2AC */ _t8 = cpu->r[29] + 0x00000010u;
         /* 0209C2AC */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
-        /* 0209C2B0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C2B0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C2B0 */ _t10 = _t9 & 0x00000001u;
         /* 0209C2B0 */ if (_t10) goto L_0209C2B4; else goto L_0209C2C4;
   L_0209C2B4: ; // 0x209c2b4
         /* 0209C2B4 */ cpu->r[3] = 0x00000038u;
         /* 0209C2B8 */ Gambit_fn_02801A78(cpu);
         /* 0209C2BC */ cpu->r[31] = cpu->r[3];
-        /* 0209C2BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209C2C0 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C2BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209C2C0 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C2C0 */ _t12 = _t11 & 0x00000001u;
         /* 0209C2C0 */ if (_t12) goto L_0209C2F4; else goto L_0209C2C4;
   L_0209C2C4: ; // 0x209c2c4
@@ -7974,23 +7974,23 @@ void Gambit_fn_0209C244(CPUState* cpu) {
         /* 0209C358 */ _t30 = cpu->r[12] + 0x00000000u;
         /* 0209C358 */ cpu->r[6] = rbrew_read8(cpu->mem, _t30);
         /* 0209C35C */ cpu->r[30] = 0x00000000u;
-        /* 0209C360 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[31]);
+        /* 0209C360 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[31]));
         /* 0209C364 */ cpu->r[5] = 0x00080000u;
-        /* 0209C368 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C368 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C368 */ _t32 = _t31 & 0x00000001u;
         /* 0209C368 */ if (_t32) goto L_0209C390; else goto L_0209C36C;
   L_0209C36C: ; // 0x209c36c
         /* 0209C36C */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0209C370 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[5]);
+        /* 0209C370 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[5]));
         /* 0209C374 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 0209C378 */ _t33 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209C378 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209C378 */ _t34 = _t33 & 0x00000001u;
         /* 0209C378 */ if (_t34) goto L_0209C38C; else goto L_0209C37C;
   L_0209C37C: ; // 0x209c37c
         /* 0209C37C */ _t35 = cpu->r[12] + 0x00000000u;
         /* 0209C37C */ cpu->r[8] = rbrew_read8(cpu->mem, _t35);
-        /* 0209C380 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[31]);
-        /* 0209C384 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C380 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[31]));
+        /* 0209C384 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C384 */ _t37 = _t36 & 0x00000001u;
         /* 0209C384 */ if (_t37) goto L_0209C388; else goto L_0209C36C;
   L_0209C388: ; // 0x209c388
@@ -8002,10 +8002,10 @@ void Gambit_fn_0209C244(CPUState* cpu) {
         /* 0209C390 */ cpu->r[7] = rbrew_read32(cpu->mem, _t38);
         /* 0209C394 */ _t39 = cpu->r[1] + 0x00000010u;
         /* 0209C394 */ cpu->r[10] = rbrew_read32(cpu->mem, _t39);
-        /* 0209C398 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 0209C398 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 0209C39C */ _t40 = cpu->r[10] + 0x00000014u;
         /* 0209C39C */ cpu->r[0] = rbrew_read32(cpu->mem, _t40);
-        /* 0209C3A0 */ _t41 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209C3A0 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209C3A0 */ _t42 = _t41 & 0x00000001u;
         /* 0209C3A0 */ if (_t42) goto L_0209C3A8; else goto L_0209C3A4;
   L_0209C3A4: ; // 0x209c3a4
@@ -8060,10 +8060,10 @@ void Gambit_fn_0209C244(CPUState* cpu) {
         /* 0209C428 */ rbrew_write32(cpu->mem, _t56, cpu->r[9]);
         /* 0209C42C */ _t57 = cpu->r[29] + 0x0000003Cu;
         /* 0209C42C */ cpu->r[12] = rbrew_read32(cpu->mem, _t57);
-        /* 0209C430 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], 0x00000001u);
+        /* 0209C430 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], 0x00000001u));
         /* 0209C434 */ _t58 = cpu->r[29] + 0x00000040u;
         /* 0209C434 */ cpu->r[27] = rbrew_read32(cpu->mem, _t58);
-        /* 0209C438 */ _t59 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209C438 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209C438 */ _t60 = _t59 & 0x00000001u;
         /* 0209C438 */ if (_t60) goto L_0209C43C; else goto L_0209C440;
   L_0209C43C: ; // 0x209c43c
@@ -8079,23 +8079,23 @@ void Gambit_fn_0209C244(CPUState* cpu) {
         /* 0209C454 */ _t63 = cpu->r[7] + 0x00000000u;
         /* 0209C454 */ cpu->r[5] = rbrew_read8(cpu->mem, _t63);
         /* 0209C458 */ cpu->r[30] = 0x00000000u;
-        /* 0209C45C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[31]);
+        /* 0209C45C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[31]));
         /* 0209C460 */ cpu->r[9] = 0x00080000u;
-        /* 0209C464 */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C464 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C464 */ _t65 = _t64 & 0x00000001u;
         /* 0209C464 */ if (_t65) goto L_0209C48C; else goto L_0209C468;
   L_0209C468: ; // 0x209c468
         /* 0209C468 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0209C46C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[9]);
+        /* 0209C46C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[9]));
         /* 0209C470 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 0209C474 */ _t66 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209C474 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209C474 */ _t67 = _t66 & 0x00000001u;
         /* 0209C474 */ if (_t67) goto L_0209C488; else goto L_0209C478;
   L_0209C478: ; // 0x209c478
         /* 0209C478 */ _t68 = cpu->r[7] + 0x00000000u;
         /* 0209C478 */ cpu->r[0] = rbrew_read8(cpu->mem, _t68);
-        /* 0209C47C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 0209C480 */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C47C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 0209C480 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C480 */ _t70 = _t69 & 0x00000001u;
         /* 0209C480 */ if (_t70) goto L_0209C484; else goto L_0209C468;
   L_0209C484: ; // 0x209c484
@@ -8105,10 +8105,10 @@ void Gambit_fn_0209C244(CPUState* cpu) {
   L_0209C48C: ; // 0x209c48c
         /* 0209C48C */ _t71 = cpu->r[27] + 0x00000008u;
         /* 0209C48C */ cpu->r[8] = rbrew_read32(cpu->mem, _t71);
-        /* 0209C490 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[8]);
+        /* 0209C490 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[8]));
         /* 0209C494 */ _t72 = cpu->r[1] + 0x00000010u;
         /* 0209C494 */ cpu->r[7] = rbrew_read32(cpu->mem, _t72);
-        /* 0209C498 */ _t73 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209C498 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209C498 */ _t74 = _t73 & 0x00000001u;
         /* 0209C498 */ if (_t74) goto L_0209C4A0; else goto L_0209C49C;
   L_0209C49C: ; // 0x209c49c
@@ -8181,17 +8181,17 @@ void Gambit_fn_0209C248(CPUState* cpu) {
         /* 0209C24C */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 0209C250 */ /* nop */
         /* 0209C254 */ cpu->r[29] = cpu->r[3];
-        /* 0209C254 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0209C254 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0209C258 */ cpu->r[28] = cpu->r[4];
-        /* 0209C25C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C25C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C25C */ _t3 = _t2 & 0x00000001u;
         /* 0209C25C */ if (_t3) goto L_0209C260; else goto L_0209C270;
   L_0209C260: ; // 0x209c260
         /* 0209C260 */ cpu->r[3] = 0x00000068u;
         /* 0209C264 */ Gambit_fn_02801A78(cpu);
         /* 0209C268 */ cpu->r[29] = cpu->r[3];
-        /* 0209C268 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0209C26C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C268 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0209C26C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C26C */ _t5 = _t4 & 0x00000001u;
         /* 0209C26C */ if (_t5) goto L_0209C51C; else goto L_0209C270;
   L_0209C270: ; // 0x209c270
@@ -8209,21 +8209,21 @@ void Gambit_fn_0209C248(CPUState* cpu) {
         /* 0209C298 */ rbrew_write32(cpu->mem, _t6, cpu->r[9]);
         /* 0209C29C */ cpu->r[0] = cpu->r[0] + 0x00001358u;
         /* 0209C2A0 */ cpu->r[31] = cpu->r[29] + 0x00000028u;
-        /* 0209C2A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209C2A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209C2A4 */ _t7 = cpu->r[29] + 0x0000000Cu;
         /* 0209C2A4 */ rbrew_write32(cpu->mem, _t7, cpu->r[10]);
         /* 0209C2A8 */ cpu->r[26] = 0x00000000u;
         /* 0209C2AC */ _t8 = cpu->r[29] + 0x00000010u;
         /* 0209C2AC */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
-        /* 0209C2B0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C2B0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C2B0 */ _t10 = _t9 & 0x00000001u;
         /* 0209C2B0 */ if (_t10) goto L_0209C2B4; else goto L_0209C2C4;
   L_0209C2B4: ; // 0x209c2b4
         /* 0209C2B4 */ cpu->r[3] = 0x00000038u;
         /* 0209C2B8 */ Gambit_fn_02801A78(cpu);
         /* 0209C2BC */ cpu->r[31] = cpu->r[3];
-        /* 0209C2BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209C2C0 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C2BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209C2C0 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C2C0 */ _t12 = _t11 & 0x00000001u;
         /* 0209C2C0 */ if (_t12) goto L_0209C2F4; else goto L_0209C2C4;
   L_0209C2C4: ; // 0x209c2c4
@@ -8285,23 +8285,23 @@ void Gambit_fn_0209C248(CPUState* cpu) {
         /* 0209C358 */ _t30 = cpu->r[12] + 0x00000000u;
         /* 0209C358 */ cpu->r[6] = rbrew_read8(cpu->mem, _t30);
         /* 0209C35C */ cpu->r[30] = 0x00000000u;
-        /* 0209C360 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[31]);
+        /* 0209C360 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[31]));
         /* 0209C364 */ cpu->r[5] = 0x00080000u;
-        /* 0209C368 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C368 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C368 */ _t32 = _t31 & 0x00000001u;
         /* 0209C368 */ if (_t32) goto L_0209C390; else goto L_0209C36C;
   L_0209C36C: ; // 0x209c36c
         /* 0209C36C */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0209C370 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[5]);
+        /* 0209C370 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[5]));
         /* 0209C374 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 0209C378 */ _t33 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209C378 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209C378 */ _t34 = _t33 & 0x00000001u;
         /* 0209C378 */ if (_t34) goto L_0209C38C; else goto L_0209C37C;
   L_0209C37C: ; // 0x209c37c
         /* 0209C37C */ _t35 = cpu->r[12] + 0x00000000u;
         /* 0209C37C */ cpu->r[8] = rbrew_read8(cpu->mem, _t35);
-        /* 0209C380 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[31]);
-        /* 0209C384 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C380 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[31]));
+        /* 0209C384 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C384 */ _t37 = _t36 & 0x00000001u;
         /* 0209C384 */ if (_t37) goto L_0209C388; else goto L_0209C36C;
   L_0209C388: ; // 0x209c388
@@ -8313,10 +8313,10 @@ void Gambit_fn_0209C248(CPUState* cpu) {
         /* 0209C390 */ cpu->r[7] = rbrew_read32(cpu->mem, _t38);
         /* 0209C394 */ _t39 = cpu->r[1] + 0x00000010u;
         /* 0209C394 */ cpu->r[10] = rbrew_read32(cpu->mem, _t39);
-        /* 0209C398 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 0209C398 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 0209C39C */ _t40 = cpu->r[10] + 0x00000014u;
         /* 0209C39C */ cpu->r[0] = rbrew_read32(cpu->mem, _t40);
-        /* 0209C3A0 */ _t41 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209C3A0 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209C3A0 */ _t42 = _t41 & 0x00000001u;
         /* 0209C3A0 */ if (_t42) goto L_0209C3A8; else goto L_0209C3A4;
   L_0209C3A4: ; // 0x209c3a4
@@ -8371,10 +8371,10 @@ void Gambit_fn_0209C248(CPUState* cpu) {
         /* 0209C428 */ rbrew_write32(cpu->mem, _t56, cpu->r[9]);
         /* 0209C42C */ _t57 = cpu->r[29] + 0x0000003Cu;
         /* 0209C42C */ cpu->r[12] = rbrew_read32(cpu->mem, _t57);
-        /* 0209C430 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], 0x00000001u);
+        /* 0209C430 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], 0x00000001u));
         /* 0209C434 */ _t58 = cpu->r[29] + 0x00000040u;
         /* 0209C434 */ cpu->r[27] = rbrew_read32(cpu->mem, _t58);
-        /* 0209C438 */ _t59 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209C438 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209C438 */ _t60 = _t59 & 0x00000001u;
         /* 0209C438 */ if (_t60) goto L_0209C43C; else goto L_0209C440;
   L_0209C43C: ; // 0x209c43c
@@ -8390,23 +8390,23 @@ void Gambit_fn_0209C248(CPUState* cpu) {
         /* 0209C454 */ _t63 = cpu->r[7] + 0x00000000u;
         /* 0209C454 */ cpu->r[5] = rbrew_read8(cpu->mem, _t63);
         /* 0209C458 */ cpu->r[30] = 0x00000000u;
-        /* 0209C45C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[31]);
+        /* 0209C45C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[31]));
         /* 0209C460 */ cpu->r[9] = 0x00080000u;
-        /* 0209C464 */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C464 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C464 */ _t65 = _t64 & 0x00000001u;
         /* 0209C464 */ if (_t65) goto L_0209C48C; else goto L_0209C468;
   L_0209C468: ; // 0x209c468
         /* 0209C468 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0209C46C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[9]);
+        /* 0209C46C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[9]));
         /* 0209C470 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 0209C474 */ _t66 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209C474 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209C474 */ _t67 = _t66 & 0x00000001u;
         /* 0209C474 */ if (_t67) goto L_0209C488; else goto L_0209C478;
   L_0209C478: ; // 0x209c478
         /* 0209C478 */ _t68 = cpu->r[7] + 0x00000000u;
         /* 0209C478 */ cpu->r[0] = rbrew_read8(cpu->mem, _t68);
-        /* 0209C47C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 0209C480 */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C47C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 0209C480 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C480 */ _t70 = _t69 & 0x00000001u;
         /* 0209C480 */ if (_t70) goto L_0209C484; else goto L_0209C468;
   L_0209C484: ; // 0x209c484
@@ -8416,10 +8416,10 @@ void Gambit_fn_0209C248(CPUState* cpu) {
   L_0209C48C: ; // 0x209c48c
         /* 0209C48C */ _t71 = cpu->r[27] + 0x00000008u;
         /* 0209C48C */ cpu->r[8] = rbrew_read32(cpu->mem, _t71);
-        /* 0209C490 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[8]);
+        /* 0209C490 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[8]));
         /* 0209C494 */ _t72 = cpu->r[1] + 0x00000010u;
         /* 0209C494 */ cpu->r[7] = rbrew_read32(cpu->mem, _t72);
-        /* 0209C498 */ _t73 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209C498 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209C498 */ _t74 = _t73 & 0x00000001u;
         /* 0209C498 */ if (_t74) goto L_0209C4A0; else goto L_0209C49C;
   L_0209C49C: ; // 0x209c49c
@@ -8576,8 +8576,8 @@ void Gambit_fn_0209C5A8(CPUState* cpu) {
         /* 0209C5B4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0209C5B8 */ _t3 = cpu->r[31] + 0x00000030u;
         /* 0209C5B8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 0209C5BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209C5C0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C5BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209C5C0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C5C0 */ _t5 = _t4 & 0x00000001u;
         /* 0209C5C0 */ if (_t5) goto L_0209C5C4; else goto L_0209C5EC;
   L_0209C5C4: ; // 0x209c5c4
@@ -8599,8 +8599,8 @@ void Gambit_fn_0209C5A8(CPUState* cpu) {
   L_0209C5EC: ; // 0x209c5ec
         /* 0209C5EC */ _t11 = cpu->r[31] + 0x00000064u;
         /* 0209C5EC */ cpu->r[0] = rbrew_read8(cpu->mem, _t11);
-        /* 0209C5F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209C5F4 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C5F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209C5F4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C5F4 */ _t13 = _t12 & 0x00000001u;
         /* 0209C5F4 */ if (_t13) goto L_0209C5F8; else goto L_0209C628;
   L_0209C5F8: ; // 0x209c5f8
@@ -8612,8 +8612,8 @@ void Gambit_fn_0209C5A8(CPUState* cpu) {
         /* 0209C600 */ cpu->r[0] = rbrew_read32(cpu->mem, _t16);
         /* 0209C604 */ cpu->ctr = cpu->r[0];
         /* 0209C608 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0209C60C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209C610 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C60C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209C610 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C610 */ _t18 = _t17 & 0x00000001u;
         /* 0209C610 */ if (_t18) goto L_0209C628; else goto L_0209C614;
   L_0209C614: ; // 0x209c614
@@ -8631,8 +8631,8 @@ void Gambit_fn_0209C5A8(CPUState* cpu) {
         /* 0209C62C */ _t23 = cpu->r[12] + 0x00000118u;
         /* 0209C62C */ cpu->r[0] = rbrew_read32(cpu->mem, _t23);
         /* 0209C630 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0209C630 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209C634 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C630 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209C634 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C634 */ _t25 = _t24 & 0x00000001u;
         /* 0209C634 */ if (_t25) goto L_0209C644; else goto L_0209C638;
   L_0209C638: ; // 0x209c638
@@ -8654,15 +8654,15 @@ void Gambit_fn_0209C658(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209C658: ; // 0x209c658
-        /* 0209C658 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209C65C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C658 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209C65C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C65C */ _t1 = _t0 & 0x00000001u;
         /* 0209C65C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209C65C */ goto L_0209C660;
   L_0209C660: ; // 0x209c660
         /* 0209C660 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209C660 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209C664 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C660 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209C664 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C664 */ _t3 = _t2 & 0x00000001u;
         /* 0209C664 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209C664 */ goto L_0209C668;
@@ -8681,8 +8681,8 @@ void Gambit_fn_0209C658(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -8696,15 +8696,15 @@ void Gambit_fn_0209C658(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -8810,18 +8810,18 @@ void Gambit_fn_0209C6AC(CPUState* cpu) {
         /* 0209C86C */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0209C86C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0209C870 */ cpu->r[12] = 0x00000000u;
-        /* 0209C874 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0209C874 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0209C878 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0209C878 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0209C87C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C87C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C87C */ _t6 = _t5 & 0x00000001u;
         /* 0209C87C */ if (_t6) goto L_0209C8A4; else goto L_0209C880;
   L_0209C880: ; // 0x209c880
         /* 0209C880 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0209C880 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0209C884 */ /* nop */
-        /* 0209C888 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0209C88C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C888 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0209C88C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C88C */ _t9 = _t8 & 0x00000001u;
         /* 0209C88C */ if (_t9) goto L_0209C890; else goto L_0209C8A4;
   L_0209C890: ; // 0x209c890
@@ -8916,15 +8916,15 @@ void Gambit_fn_0209C6E8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209C6E8: ; // 0x209c6e8
-        /* 0209C6E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209C6EC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C6E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209C6EC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C6EC */ _t1 = _t0 & 0x00000001u;
         /* 0209C6EC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209C6EC */ goto L_0209C6F0;
   L_0209C6F0: ; // 0x209c6f0
         /* 0209C6F0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209C6F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209C6F4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C6F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209C6F4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C6F4 */ _t3 = _t2 & 0x00000001u;
         /* 0209C6F4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209C6F4 */ goto L_0209C6F8;
@@ -8943,8 +8943,8 @@ void Gambit_fn_0209C6E8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -8958,15 +8958,15 @@ void Gambit_fn_0209C6E8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -9012,15 +9012,15 @@ void Gambit_fn_0209C718(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209C718: ; // 0x209c718
-        /* 0209C718 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209C71C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C718 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209C71C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C71C */ _t1 = _t0 & 0x00000001u;
         /* 0209C71C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209C71C */ goto L_0209C720;
   L_0209C720: ; // 0x209c720
         /* 0209C720 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209C720 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209C724 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C720 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209C724 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C724 */ _t3 = _t2 & 0x00000001u;
         /* 0209C724 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209C724 */ goto L_0209C728;
@@ -9039,8 +9039,8 @@ void Gambit_fn_0209C718(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -9054,15 +9054,15 @@ void Gambit_fn_0209C718(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -9090,15 +9090,15 @@ void Gambit_fn_0209C72C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209C72C: ; // 0x209c72c
-        /* 0209C72C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209C730 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C72C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209C730 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C730 */ _t1 = _t0 & 0x00000001u;
         /* 0209C730 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209C730 */ goto L_0209C734;
   L_0209C734: ; // 0x209c734
         /* 0209C734 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209C734 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209C738 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C734 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209C738 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C738 */ _t3 = _t2 & 0x00000001u;
         /* 0209C738 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209C738 */ goto L_0209C73C;
@@ -9117,8 +9117,8 @@ void Gambit_fn_0209C72C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -9132,15 +9132,15 @@ void Gambit_fn_0209C72C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -9184,10 +9184,10 @@ void Gambit_fn_0209C748(CPUState* cpu) {
         /* 0209C750 */ _t1 = cpu->r[3] + 0x00000020u;
         /* 0209C750 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 0209C754 */ cpu->r[8] = cpu->r[0];
-        /* 0209C758 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 0209C758 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 0209C75C */ _t2 = cpu->r[3] + 0x00000024u;
         /* 0209C75C */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0209C760 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209C760 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209C760 */ _t4 = _t3 & 0x00000001u;
         /* 0209C760 */ if (_t4) goto L_0209C764; else goto L_0209C77C;
   L_0209C764: ; // 0x209c764
@@ -9195,8 +9195,8 @@ void Gambit_fn_0209C748(CPUState* cpu) {
         /* 0209C768 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 0209C76C */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0209C76C */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0209C770 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0209C774 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C770 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0209C774 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C774 */ _t7 = _t6 & 0x00000001u;
         /* 0209C774 */ if (_t7) goto L_0209C778; else goto L_0209C788;
   L_0209C778: ; // 0x209c778
@@ -9204,16 +9204,16 @@ void Gambit_fn_0209C748(CPUState* cpu) {
   L_0209C77C: ; // 0x209c77c
         /* 0209C77C */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0209C77C */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0209C780 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0209C784 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C780 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0209C784 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C784 */ _t10 = _t9 & 0x00000001u;
         /* 0209C784 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209C784 */ goto L_0209C788;
   L_0209C788: ; // 0x209c788
-        /* 0209C788 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 0209C788 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 0209C78C */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0209C78C */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 0209C790 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209C790 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209C790 */ _t13 = _t12 & 0x00000001u;
         /* 0209C790 */ if (_t13) goto L_0209C794; else goto L_0209C79C;
   L_0209C794: ; // 0x209c794
@@ -9224,11 +9224,11 @@ void Gambit_fn_0209C748(CPUState* cpu) {
         /* 0209C79C */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0209C7A0 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0209C7A0 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0209C7A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0209C7A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0209C7A8 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0209C7A8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0209C7AC */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 0209C7B0 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209C7B0 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209C7B0 */ _t18 = _t17 & 0x00000001u;
         /* 0209C7B0 */ if (_t18) goto L_0209C7C8; else goto L_0209C7B4;
   L_0209C7B4: ; // 0x209c7b4
@@ -9255,10 +9255,10 @@ void Gambit_fn_0209C7D0(CPUState* cpu) {
         /* 0209C7D8 */ _t1 = cpu->r[3] + 0x00000028u;
         /* 0209C7D8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 0209C7DC */ cpu->r[8] = cpu->r[0];
-        /* 0209C7E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 0209C7E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 0209C7E4 */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 0209C7E4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0209C7E8 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209C7E8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209C7E8 */ _t4 = _t3 & 0x00000001u;
         /* 0209C7E8 */ if (_t4) goto L_0209C7EC; else goto L_0209C804;
   L_0209C7EC: ; // 0x209c7ec
@@ -9266,8 +9266,8 @@ void Gambit_fn_0209C7D0(CPUState* cpu) {
         /* 0209C7F0 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 0209C7F4 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0209C7F4 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0209C7F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0209C7FC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C7F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0209C7FC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C7FC */ _t7 = _t6 & 0x00000001u;
         /* 0209C7FC */ if (_t7) goto L_0209C800; else goto L_0209C810;
   L_0209C800: ; // 0x209c800
@@ -9275,16 +9275,16 @@ void Gambit_fn_0209C7D0(CPUState* cpu) {
   L_0209C804: ; // 0x209c804
         /* 0209C804 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0209C804 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0209C808 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0209C80C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C808 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0209C80C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C80C */ _t10 = _t9 & 0x00000001u;
         /* 0209C80C */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209C80C */ goto L_0209C810;
   L_0209C810: ; // 0x209c810
-        /* 0209C810 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 0209C810 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 0209C814 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0209C814 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 0209C818 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209C818 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209C818 */ _t13 = _t12 & 0x00000001u;
         /* 0209C818 */ if (_t13) goto L_0209C81C; else goto L_0209C824;
   L_0209C81C: ; // 0x209c81c
@@ -9295,11 +9295,11 @@ void Gambit_fn_0209C7D0(CPUState* cpu) {
         /* 0209C824 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0209C828 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0209C828 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0209C82C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0209C82C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0209C830 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0209C830 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0209C834 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 0209C838 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209C838 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209C838 */ _t18 = _t17 & 0x00000001u;
         /* 0209C838 */ if (_t18) goto L_0209C850; else goto L_0209C83C;
   L_0209C83C: ; // 0x209c83c
@@ -9332,18 +9332,18 @@ void Gambit_fn_0209C858(CPUState* cpu) {
         /* 0209C86C */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0209C86C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0209C870 */ cpu->r[12] = 0x00000000u;
-        /* 0209C874 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0209C874 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0209C878 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0209C878 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0209C87C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C87C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C87C */ _t6 = _t5 & 0x00000001u;
         /* 0209C87C */ if (_t6) goto L_0209C8A4; else goto L_0209C880;
   L_0209C880: ; // 0x209c880
         /* 0209C880 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0209C880 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0209C884 */ /* nop */
-        /* 0209C888 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0209C88C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C888 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0209C88C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C88C */ _t9 = _t8 & 0x00000001u;
         /* 0209C88C */ if (_t9) goto L_0209C890; else goto L_0209C8A4;
   L_0209C890: ; // 0x209c890
@@ -9384,18 +9384,18 @@ void Gambit_fn_0209C85C(CPUState* cpu) {
         /* 0209C86C */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0209C86C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0209C870 */ cpu->r[12] = 0x00000000u;
-        /* 0209C874 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0209C874 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0209C878 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0209C878 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0209C87C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C87C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C87C */ _t6 = _t5 & 0x00000001u;
         /* 0209C87C */ if (_t6) goto L_0209C8A4; else goto L_0209C880;
   L_0209C880: ; // 0x209c880
         /* 0209C880 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0209C880 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0209C884 */ /* nop */
-        /* 0209C888 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0209C88C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C888 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0209C88C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C88C */ _t9 = _t8 & 0x00000001u;
         /* 0209C88C */ if (_t9) goto L_0209C890; else goto L_0209C8A4;
   L_0209C890: ; // 0x209c890
@@ -9440,10 +9440,10 @@ void Gambit_fn_0209C8C8(CPUState* cpu) {
         /* 0209C8E8 */ cpu->r[31] = 0x101D0000u;
         /* 0209C8EC */ _t3 = cpu->r[28] + 0x0000001Cu;
         /* 0209C8EC */ rbrew_write32(cpu->mem, _t3, cpu->r[4]);
-        /* 0209C8F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0209C8F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0209C8F4 */ _t4 = cpu->r[28] + 0x0000000Fu;
         /* 0209C8F4 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[27]);
-        /* 0209C8F8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C8F8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C8F8 */ _t6 = _t5 & 0x00000001u;
         /* 0209C8F8 */ if (_t6) goto L_0209C93C; else goto L_0209C8FC;
   L_0209C8FC: ; // 0x209c8fc
@@ -9458,16 +9458,16 @@ void Gambit_fn_0209C8C8(CPUState* cpu) {
         /* 0209C910 */ cpu->r[5] = 0x00000004u;
         /* 0209C914 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 0209C918 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0209C91C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0209C91C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0209C920 */ cpu->r[0] = cpu->r[27];
-        /* 0209C924 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209C924 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209C924 */ _t11 = _t10 & 0x00000001u;
         /* 0209C924 */ if (_t11) goto L_0209C92C; else goto L_0209C928;
   L_0209C928: ; // 0x209c928
         /* 0209C928 */ cpu->r[0] = 0x00000001u;
   L_0209C92C: ; // 0x209c92c
-        /* 0209C92C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209C930 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C92C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209C930 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C930 */ _t13 = _t12 & 0x00000001u;
         /* 0209C930 */ if (_t13) goto L_0209C93C; else goto L_0209C934;
   L_0209C934: ; // 0x209c934
@@ -9479,9 +9479,9 @@ void Gambit_fn_0209C8C8(CPUState* cpu) {
         /* 0209C93C */ _t16 = cpu->r[28] + 0x00000020u;
         /* 0209C93C */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 0209C940 */ cpu->r[0] = 0x00000000u;
-        /* 0209C944 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0209C944 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0209C948 */ cpu->r[12] = cpu->r[0];
-        /* 0209C94C */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209C94C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209C94C */ _t18 = _t17 & 0x00000001u;
         /* 0209C94C */ if (_t18) goto L_0209C950; else goto L_0209C974;
   L_0209C950: ; // 0x209c950
@@ -9506,8 +9506,8 @@ void Gambit_fn_0209C8C8(CPUState* cpu) {
   L_0209C974: ; // 0x209c974
         /* 0209C974 */ _t26 = cpu->r[28] + 0x0000000Fu;
         /* 0209C974 */ cpu->r[27] = rbrew_read8(cpu->mem, _t26);
-        /* 0209C978 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0209C97C */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C978 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0209C97C */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C97C */ _t28 = _t27 & 0x00000001u;
         /* 0209C97C */ if (_t28) goto L_0209C9C0; else goto L_0209C980;
   L_0209C980: ; // 0x209c980
@@ -9522,16 +9522,16 @@ void Gambit_fn_0209C8C8(CPUState* cpu) {
         /* 0209C994 */ cpu->r[5] = 0x00000004u;
         /* 0209C998 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 0209C99C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0209C9A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0209C9A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0209C9A4 */ cpu->r[11] = cpu->r[27];
-        /* 0209C9A8 */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209C9A8 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209C9A8 */ _t33 = _t32 & 0x00000001u;
         /* 0209C9A8 */ if (_t33) goto L_0209C9B0; else goto L_0209C9AC;
   L_0209C9AC: ; // 0x209c9ac
         /* 0209C9AC */ cpu->r[11] = 0x00000001u;
   L_0209C9B0: ; // 0x209c9b0
-        /* 0209C9B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209C9B4 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C9B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209C9B4 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209C9B4 */ _t35 = _t34 & 0x00000001u;
         /* 0209C9B4 */ if (_t35) goto L_0209C9C0; else goto L_0209C9B8;
   L_0209C9B8: ; // 0x209c9b8
@@ -9543,9 +9543,9 @@ void Gambit_fn_0209C8C8(CPUState* cpu) {
         /* 0209C9C0 */ _t38 = cpu->r[28] + 0x00000028u;
         /* 0209C9C0 */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 0209C9C4 */ cpu->r[0] = 0x00000000u;
-        /* 0209C9C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 0209C9C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 0209C9CC */ cpu->r[12] = cpu->r[0];
-        /* 0209C9D0 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209C9D0 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209C9D0 */ _t40 = _t39 & 0x00000001u;
         /* 0209C9D0 */ if (_t40) goto L_0209C9D4; else goto L_0209C9F8;
   L_0209C9D4: ; // 0x209c9d4
@@ -9570,8 +9570,8 @@ void Gambit_fn_0209C8C8(CPUState* cpu) {
   L_0209C9F8: ; // 0x209c9f8
         /* 0209C9F8 */ _t48 = cpu->r[28] + 0x0000000Fu;
         /* 0209C9F8 */ cpu->r[27] = rbrew_read8(cpu->mem, _t48);
-        /* 0209C9FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0209CA00 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209C9FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0209CA00 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CA00 */ _t50 = _t49 & 0x00000001u;
         /* 0209CA00 */ if (_t50) goto L_0209CA44; else goto L_0209CA04;
   L_0209CA04: ; // 0x209ca04
@@ -9586,16 +9586,16 @@ void Gambit_fn_0209C8C8(CPUState* cpu) {
         /* 0209CA18 */ cpu->r[5] = 0x00000004u;
         /* 0209CA1C */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 0209CA20 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0209CA24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0209CA24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0209CA28 */ cpu->r[10] = cpu->r[27];
-        /* 0209CA2C */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209CA2C */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209CA2C */ _t55 = _t54 & 0x00000001u;
         /* 0209CA2C */ if (_t55) goto L_0209CA34; else goto L_0209CA30;
   L_0209CA30: ; // 0x209ca30
         /* 0209CA30 */ cpu->r[10] = 0x00000001u;
   L_0209CA34: ; // 0x209ca34
-        /* 0209CA34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209CA38 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CA34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209CA38 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CA38 */ _t57 = _t56 & 0x00000001u;
         /* 0209CA38 */ if (_t57) goto L_0209CA44; else goto L_0209CA3C;
   L_0209CA3C: ; // 0x209ca3c
@@ -9607,9 +9607,9 @@ void Gambit_fn_0209C8C8(CPUState* cpu) {
         /* 0209CA44 */ _t60 = cpu->r[28] + 0x00000030u;
         /* 0209CA44 */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
         /* 0209CA48 */ cpu->r[0] = 0x00000000u;
-        /* 0209CA4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0209CA4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0209CA50 */ cpu->r[5] = cpu->r[0];
-        /* 0209CA54 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209CA54 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209CA54 */ _t62 = _t61 & 0x00000001u;
         /* 0209CA54 */ if (_t62) goto L_0209CA58; else goto L_0209CA7C;
   L_0209CA58: ; // 0x209ca58
@@ -9634,8 +9634,8 @@ void Gambit_fn_0209C8C8(CPUState* cpu) {
   L_0209CA7C: ; // 0x209ca7c
         /* 0209CA7C */ _t70 = cpu->r[30] + 0x00000000u;
         /* 0209CA7C */ cpu->r[25] = rbrew_read8(cpu->mem, _t70);
-        /* 0209CA80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 0209CA84 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CA80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 0209CA84 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CA84 */ _t72 = _t71 & 0x00000001u;
         /* 0209CA84 */ if (_t72) goto L_0209CB60; else goto L_0209CA88;
   L_0209CA88: ; // 0x209ca88
@@ -9651,10 +9651,10 @@ void Gambit_fn_0209C8C8(CPUState* cpu) {
         /* 0209CAA0 */ cpu->r[4] = (uint32_t)((int32_t)cpu->r[25] * (int32_t)0x00000024u);
         /* 0209CAA4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209CAA8 */ cpu->r[24] = cpu->r[3];
-        /* 0209CAAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 0209CAAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 0209CAB0 */ cpu->r[30] = cpu->r[25];
         /* 0209CAB4 */ cpu->r[7] = 0x00000000u;
-        /* 0209CAB8 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209CAB8 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209CAB8 */ _t77 = _t76 & 0x00000001u;
         /* 0209CAB8 */ if (_t77) goto L_0209CAC0; else goto L_0209CABC;
   L_0209CABC: ; // 0x209cabc
@@ -9667,36 +9667,36 @@ void Gambit_fn_0209C8C8(CPUState* cpu) {
         /* 0209CACC */ cpu->r[23] = 0x00000018u;
   L_0209CAD0: ; // 0x209cad0
         /* 0209CAD0 */ cpu->r[27] = cpu->r[24] + cpu->r[22];
-        /* 0209CAD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0209CAD4 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CAD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0209CAD4 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CAD4 */ _t80 = _t79 & 0x00000001u;
         /* 0209CAD4 */ if (_t80) goto L_0209CB44; else goto L_0209CAD8;
   L_0209CAD8: ; // 0x209cad8
         /* 0209CAD8 */ cpu->r[26] = cpu->r[27];
-        /* 0209CAD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0209CADC */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CAD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0209CADC */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CADC */ _t82 = _t81 & 0x00000001u;
         /* 0209CADC */ if (_t82) goto L_0209CAE0; else goto L_0209CAF0;
   L_0209CAE0: ; // 0x209cae0
         /* 0209CAE0 */ cpu->r[3] = 0x00000024u;
         /* 0209CAE4 */ Gambit_fn_02801A78(cpu);
         /* 0209CAE8 */ cpu->r[26] = cpu->r[3];
-        /* 0209CAE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0209CAEC */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CAE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0209CAEC */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CAEC */ _t84 = _t83 & 0x00000001u;
         /* 0209CAEC */ if (_t84) goto L_0209CB38; else goto L_0209CAF0;
   L_0209CAF0: ; // 0x209caf0
         /* 0209CAF0 */ cpu->r[11] = cpu->r[26];
-        /* 0209CAF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209CAF4 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CAF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209CAF4 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CAF4 */ _t86 = _t85 & 0x00000001u;
         /* 0209CAF4 */ if (_t86) goto L_0209CAF8; else goto L_0209CB08;
   L_0209CAF8: ; // 0x209caf8
         /* 0209CAF8 */ cpu->r[3] = 0x0000000Cu;
         /* 0209CAFC */ Gambit_fn_02801A78(cpu);
         /* 0209CB00 */ cpu->r[11] = cpu->r[3];
-        /* 0209CB00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209CB04 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CB00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209CB04 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CB04 */ _t88 = _t87 & 0x00000001u;
         /* 0209CB04 */ if (_t88) goto L_0209CB24; else goto L_0209CB08;
   L_0209CB08: ; // 0x209cb08
@@ -9727,14 +9727,14 @@ void Gambit_fn_0209C8C8(CPUState* cpu) {
         /* 0209CB40 */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
   L_0209CB44: ; // 0x209cb44
         /* 0209CB44 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 0209CB44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209CB44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209CB48 */ cpu->r[22] = cpu->r[22] + 0x00000024u;
-        /* 0209CB4C */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CB4C */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CB4C */ _t98 = _t97 & 0x00000001u;
         /* 0209CB4C */ if (_t98) goto L_0209CB50; else goto L_0209CAD0;
   L_0209CB50: ; // 0x209cb50
-        /* 0209CB50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 0209CB54 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CB50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 0209CB54 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CB54 */ _t100 = _t99 & 0x00000001u;
         /* 0209CB54 */ if (_t100) goto L_0209CB60; else goto L_0209CB58;
   L_0209CB58: ; // 0x209cb58
@@ -9764,10 +9764,10 @@ void Gambit_fn_0209CB78(CPUState* cpu) {
         /* 0209CB7C */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 0209CB80 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 0209CB80 */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 0209CB84 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[12]);
+        /* 0209CB84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[12]));
         /* 0209CB88 */ _t3 = cpu->r[4] + 0x00000000u;
         /* 0209CB88 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 0209CB8C */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209CB8C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209CB8C */ _t5 = _t4 & 0x00000001u;
         /* 0209CB8C */ if (_t5) goto L_0209CB90; else goto L_0209CB98;
   L_0209CB90: ; // 0x209cb90
@@ -9784,10 +9784,10 @@ void Gambit_fn_0209CB78(CPUState* cpu) {
         /* 0209CBA4 */ cpu->r[9] = rbrew_read8(cpu->mem, _t9);
         /* 0209CBA8 */ _t10 = cpu->r[3] + 0x00000028u;
         /* 0209CBA8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 0209CBAC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
+        /* 0209CBAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
         /* 0209CBB0 */ _t11 = cpu->r[3] + 0x0000002Cu;
         /* 0209CBB0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
-        /* 0209CBB4 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209CBB4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209CBB4 */ _t13 = _t12 & 0x00000001u;
         /* 0209CBB4 */ if (_t13) goto L_0209CBB8; else goto L_0209CBC0;
   L_0209CBB8: ; // 0x209cbb8
@@ -9808,10 +9808,10 @@ void Gambit_fn_0209CB78(CPUState* cpu) {
         /* 0209CBD4 */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
         /* 0209CBD8 */ _t20 = cpu->r[3] + 0x00000034u;
         /* 0209CBD8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 0209CBDC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
+        /* 0209CBDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
         /* 0209CBE0 */ _t21 = cpu->r[6] + 0x00000000u;
         /* 0209CBE0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
-        /* 0209CBE4 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209CBE4 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209CBE4 */ _t23 = _t22 & 0x00000001u;
         /* 0209CBE4 */ if (_t23) goto L_0209CBE8; else goto L_0209CBF0;
   L_0209CBE8: ; // 0x209cbe8
@@ -9838,10 +9838,10 @@ void Gambit_fn_0209CC00(CPUState* cpu) {
         /* 0209CC08 */ _t1 = cpu->r[3] + 0x00000030u;
         /* 0209CC08 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 0209CC0C */ cpu->r[7] = cpu->r[0];
-        /* 0209CC10 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 0209CC10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 0209CC14 */ _t2 = cpu->r[3] + 0x00000034u;
         /* 0209CC14 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0209CC18 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209CC18 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209CC18 */ _t4 = _t3 & 0x00000001u;
         /* 0209CC18 */ if (_t4) goto L_0209CC1C; else goto L_0209CC34;
   L_0209CC1C: ; // 0x209cc1c
@@ -9849,8 +9849,8 @@ void Gambit_fn_0209CC00(CPUState* cpu) {
         /* 0209CC20 */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 0209CC24 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0209CC24 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0209CC28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209CC2C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CC28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209CC2C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CC2C */ _t7 = _t6 & 0x00000001u;
         /* 0209CC2C */ if (_t7) goto L_0209CC30; else goto L_0209CC40;
   L_0209CC30: ; // 0x209cc30
@@ -9858,16 +9858,16 @@ void Gambit_fn_0209CC00(CPUState* cpu) {
   L_0209CC34: ; // 0x209cc34
         /* 0209CC34 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0209CC34 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0209CC38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209CC3C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CC38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209CC3C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CC3C */ _t10 = _t9 & 0x00000001u;
         /* 0209CC3C */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209CC3C */ goto L_0209CC40;
   L_0209CC40: ; // 0x209cc40
-        /* 0209CC40 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 0209CC40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 0209CC44 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0209CC44 */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 0209CC48 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209CC48 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209CC48 */ _t13 = _t12 & 0x00000001u;
         /* 0209CC48 */ if (_t13) goto L_0209CC4C; else goto L_0209CC54;
   L_0209CC4C: ; // 0x209cc4c
@@ -9878,11 +9878,11 @@ void Gambit_fn_0209CC00(CPUState* cpu) {
         /* 0209CC54 */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0209CC58 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0209CC58 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0209CC5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0209CC5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0209CC60 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0209CC60 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0209CC64 */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 0209CC68 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209CC68 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209CC68 */ _t18 = _t17 & 0x00000001u;
         /* 0209CC68 */ if (_t18) goto L_0209CC80; else goto L_0209CC6C;
   L_0209CC6C: ; // 0x209cc6c
@@ -9917,9 +9917,9 @@ void Gambit_fn_0209CC88(CPUState* cpu) {
         /* 0209CCA0 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 0209CCA0 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 0209CCA4 */ /* nop */
-        /* 0209CCA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 0209CCA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 0209CCAC */ cpu->r[31] = cpu->r[4];
-        /* 0209CCB0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CCB0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CCB0 */ _t6 = _t5 & 0x00000001u;
         /* 0209CCB0 */ if (_t6) goto L_0209CCB4; else goto L_0209CCC8;
   L_0209CCB4: ; // 0x209ccb4
@@ -9968,9 +9968,9 @@ void Gambit_fn_0209CC8C(CPUState* cpu) {
         /* 0209CCA0 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 0209CCA0 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 0209CCA4 */ /* nop */
-        /* 0209CCA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 0209CCA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 0209CCAC */ cpu->r[31] = cpu->r[4];
-        /* 0209CCB0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CCB0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CCB0 */ _t6 = _t5 & 0x00000001u;
         /* 0209CCB0 */ if (_t6) goto L_0209CCB4; else goto L_0209CCC8;
   L_0209CCB4: ; // 0x209ccb4
@@ -10035,8 +10035,8 @@ void Gambit_fn_0209CD00(CPUState* cpu) {
         /* 0209CD48 */ _t7 = cpu->r[1] + 0x00000084u;
         /* 0209CD48 */ rbrew_write32(cpu->mem, _t7, cpu->r[0]);
         /* 0209CD4C */ Gambit_fn_02801A78(cpu);
-        /* 0209CD50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209CD54 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CD50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209CD54 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CD54 */ _t9 = _t8 & 0x00000001u;
         /* 0209CD54 */ if (_t9) goto L_0209CD5C; else goto L_0209CD58;
   L_0209CD58: ; // 0x209cd58
@@ -10053,8 +10053,8 @@ void Gambit_fn_0209CD00(CPUState* cpu) {
         /* 0209CD70 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209CD74 */ cpu->r[3] = 0x0000028Cu;
         /* 0209CD78 */ Gambit_fn_02801A78(cpu);
-        /* 0209CD7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209CD80 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CD7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209CD80 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CD80 */ _t14 = _t13 & 0x00000001u;
         /* 0209CD80 */ if (_t14) goto L_0209CD88; else goto L_0209CD84;
   L_0209CD84: ; // 0x209cd84
@@ -10071,8 +10071,8 @@ void Gambit_fn_0209CD00(CPUState* cpu) {
         /* 0209CD9C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209CDA0 */ cpu->r[3] = 0x00000290u;
         /* 0209CDA4 */ Gambit_fn_02801A78(cpu);
-        /* 0209CDA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209CDAC */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CDA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209CDAC */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CDAC */ _t19 = _t18 & 0x00000001u;
         /* 0209CDAC */ if (_t19) goto L_0209CDB4; else goto L_0209CDB0;
   L_0209CDB0: ; // 0x209cdb0
@@ -10129,8 +10129,8 @@ void Gambit_fn_0209CD04(CPUState* cpu) {
         /* 0209CD48 */ _t7 = cpu->r[1] + 0x00000084u;
         /* 0209CD48 */ rbrew_write32(cpu->mem, _t7, cpu->r[0]);
         /* 0209CD4C */ Gambit_fn_02801A78(cpu);
-        /* 0209CD50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209CD54 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CD50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209CD54 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CD54 */ _t9 = _t8 & 0x00000001u;
         /* 0209CD54 */ if (_t9) goto L_0209CD5C; else goto L_0209CD58;
   L_0209CD58: ; // 0x209cd58
@@ -10147,8 +10147,8 @@ void Gambit_fn_0209CD04(CPUState* cpu) {
         /* 0209CD70 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209CD74 */ cpu->r[3] = 0x0000028Cu;
         /* 0209CD78 */ Gambit_fn_02801A78(cpu);
-        /* 0209CD7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209CD80 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CD7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209CD80 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CD80 */ _t14 = _t13 & 0x00000001u;
         /* 0209CD80 */ if (_t14) goto L_0209CD88; else goto L_0209CD84;
   L_0209CD84: ; // 0x209cd84
@@ -10165,8 +10165,8 @@ void Gambit_fn_0209CD04(CPUState* cpu) {
         /* 0209CD9C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209CDA0 */ cpu->r[3] = 0x00000290u;
         /* 0209CDA4 */ Gambit_fn_02801A78(cpu);
-        /* 0209CDA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209CDAC */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CDA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209CDAC */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CDAC */ _t19 = _t18 & 0x00000001u;
         /* 0209CDAC */ if (_t19) goto L_0209CDB4; else goto L_0209CDB0;
   L_0209CDB0: ; // 0x209cdb0
@@ -10224,8 +10224,8 @@ void Gambit_fn_0209CDE0(CPUState* cpu) {
         /* 0209CD48 */ _t7 = cpu->r[1] + 0x00000084u;
         /* 0209CD48 */ rbrew_write32(cpu->mem, _t7, cpu->r[0]);
         /* 0209CD4C */ Gambit_fn_02801A78(cpu);
-        /* 0209CD50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209CD54 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CD50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209CD54 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CD54 */ _t9 = _t8 & 0x00000001u;
         /* 0209CD54 */ if (_t9) goto L_0209CD5C; else goto L_0209CD58;
   L_0209CD58: ; // 0x209cd58
@@ -10242,8 +10242,8 @@ void Gambit_fn_0209CDE0(CPUState* cpu) {
         /* 0209CD70 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209CD74 */ cpu->r[3] = 0x0000028Cu;
         /* 0209CD78 */ Gambit_fn_02801A78(cpu);
-        /* 0209CD7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209CD80 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CD7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209CD80 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CD80 */ _t14 = _t13 & 0x00000001u;
         /* 0209CD80 */ if (_t14) goto L_0209CD88; else goto L_0209CD84;
   L_0209CD84: ; // 0x209cd84
@@ -10260,8 +10260,8 @@ void Gambit_fn_0209CDE0(CPUState* cpu) {
         /* 0209CD9C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0209CDA0 */ cpu->r[3] = 0x00000290u;
         /* 0209CDA4 */ Gambit_fn_02801A78(cpu);
-        /* 0209CDA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209CDAC */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CDA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209CDAC */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CDAC */ _t19 = _t18 & 0x00000001u;
         /* 0209CDAC */ if (_t19) goto L_0209CDB4; else goto L_0209CDB0;
   L_0209CDB0: ; // 0x209cdb0
@@ -10396,19 +10396,19 @@ void Gambit_fn_0209CE30(CPUState* cpu) {
         /* 0209CE3C */ _t2 = cpu->r[1] + 0x0000000Cu;
         /* 0209CE3C */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
         /* 0209CE40 */ cpu->r[31] = cpu->r[3];
-        /* 0209CE40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209CE40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209CE44 */ cpu->r[30] = cpu->r[4];
         /* 0209CE48 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209CE48 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209CE4C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CE4C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CE4C */ _t5 = _t4 & 0x00000001u;
         /* 0209CE4C */ if (_t5) goto L_0209CE50; else goto L_0209CE60;
   L_0209CE50: ; // 0x209ce50
         /* 0209CE50 */ cpu->r[3] = 0x00000044u;
         /* 0209CE54 */ Gambit_fn_02801A78(cpu);
         /* 0209CE58 */ cpu->r[31] = cpu->r[3];
-        /* 0209CE58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209CE5C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CE58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209CE5C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CE5C */ _t7 = _t6 & 0x00000001u;
         /* 0209CE5C */ if (_t7) goto L_0209CEE4; else goto L_0209CE60;
   L_0209CE60: ; // 0x209ce60
@@ -10428,17 +10428,17 @@ void Gambit_fn_0209CE30(CPUState* cpu) {
         /* 0209CE8C */ rbrew_write32(cpu->mem, _t9, cpu->r[9]);
         /* 0209CE90 */ cpu->r[0] = cpu->r[0] + 0x00001488u;
         /* 0209CE94 */ cpu->r[3] = cpu->r[31] + 0x00000028u;
-        /* 0209CE94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0209CE94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0209CE98 */ _t10 = cpu->r[31] + 0x0000000Cu;
         /* 0209CE98 */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
-        /* 0209CE9C */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CE9C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CE9C */ _t12 = _t11 & 0x00000001u;
         /* 0209CE9C */ if (_t12) goto L_0209CEA0; else goto L_0209CEB0;
   L_0209CEA0: ; // 0x209cea0
         /* 0209CEA0 */ cpu->r[3] = 0x00000010u;
         /* 0209CEA4 */ Gambit_fn_02801A78(cpu);
-        /* 0209CEA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209CEAC */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CEA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209CEAC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CEAC */ _t14 = _t13 & 0x00000001u;
         /* 0209CEAC */ if (_t14) goto L_0209CED4; else goto L_0209CEB0;
   L_0209CEB0: ; // 0x209ceb0
@@ -10492,19 +10492,19 @@ void Gambit_fn_0209CE34(CPUState* cpu) {
         /* 0209CE3C */ _t2 = cpu->r[1] + 0x0000000Cu;
         /* 0209CE3C */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
         /* 0209CE40 */ cpu->r[31] = cpu->r[3];
-        /* 0209CE40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209CE40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209CE44 */ cpu->r[30] = cpu->r[4];
         /* 0209CE48 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209CE48 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209CE4C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CE4C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CE4C */ _t5 = _t4 & 0x00000001u;
         /* 0209CE4C */ if (_t5) goto L_0209CE50; else goto L_0209CE60;
   L_0209CE50: ; // 0x209ce50
         /* 0209CE50 */ cpu->r[3] = 0x00000044u;
         /* 0209CE54 */ Gambit_fn_02801A78(cpu);
         /* 0209CE58 */ cpu->r[31] = cpu->r[3];
-        /* 0209CE58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209CE5C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CE58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209CE5C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CE5C */ _t7 = _t6 & 0x00000001u;
         /* 0209CE5C */ if (_t7) goto L_0209CEE4; else goto L_0209CE60;
   L_0209CE60: ; // 0x209ce60
@@ -10524,17 +10524,17 @@ void Gambit_fn_0209CE34(CPUState* cpu) {
         /* 0209CE8C */ rbrew_write32(cpu->mem, _t9, cpu->r[9]);
         /* 0209CE90 */ cpu->r[0] = cpu->r[0] + 0x00001488u;
         /* 0209CE94 */ cpu->r[3] = cpu->r[31] + 0x00000028u;
-        /* 0209CE94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0209CE94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0209CE98 */ _t10 = cpu->r[31] + 0x0000000Cu;
         /* 0209CE98 */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
-        /* 0209CE9C */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CE9C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CE9C */ _t12 = _t11 & 0x00000001u;
         /* 0209CE9C */ if (_t12) goto L_0209CEA0; else goto L_0209CEB0;
   L_0209CEA0: ; // 0x209cea0
         /* 0209CEA0 */ cpu->r[3] = 0x00000010u;
         /* 0209CEA4 */ Gambit_fn_02801A78(cpu);
-        /* 0209CEA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209CEAC */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CEA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209CEAC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CEAC */ _t14 = _t13 & 0x00000001u;
         /* 0209CEAC */ if (_t14) goto L_0209CED4; else goto L_0209CEB0;
   L_0209CEB0: ; // 0x209ceb0
@@ -10616,8 +10616,8 @@ void Gambit_fn_0209CF18(CPUState* cpu) {
         /* 0209CF44 */ Gambit_fn_027ECBB4(cpu);
         /* 0209CF48 */ _t6 = cpu->r[31] + 0x0000047Fu;
         /* 0209CF48 */ cpu->r[0] = rbrew_read8(cpu->mem, _t6);
-        /* 0209CF4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209CF50 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CF4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209CF50 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CF50 */ _t8 = _t7 & 0x00000001u;
         /* 0209CF50 */ if (_t8) goto L_0209CF64; else goto L_0209CF54;
   L_0209CF54: ; // 0x209cf54
@@ -10630,8 +10630,8 @@ void Gambit_fn_0209CF18(CPUState* cpu) {
   L_0209CF64: ; // 0x209cf64
         /* 0209CF64 */ _t11 = cpu->r[31] + 0x00000480u;
         /* 0209CF64 */ cpu->r[0] = rbrew_read8(cpu->mem, _t11);
-        /* 0209CF68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209CF6C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CF68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209CF6C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CF6C */ _t13 = _t12 & 0x00000001u;
         /* 0209CF6C */ if (_t13) goto L_0209CF80; else goto L_0209CF70;
   L_0209CF70: ; // 0x209cf70
@@ -10687,8 +10687,8 @@ void Gambit_fn_0209CF1C(CPUState* cpu) {
         /* 0209CF44 */ Gambit_fn_027ECBB4(cpu);
         /* 0209CF48 */ _t6 = cpu->r[31] + 0x0000047Fu;
         /* 0209CF48 */ cpu->r[0] = rbrew_read8(cpu->mem, _t6);
-        /* 0209CF4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209CF50 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CF4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209CF50 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CF50 */ _t8 = _t7 & 0x00000001u;
         /* 0209CF50 */ if (_t8) goto L_0209CF64; else goto L_0209CF54;
   L_0209CF54: ; // 0x209cf54
@@ -10701,8 +10701,8 @@ void Gambit_fn_0209CF1C(CPUState* cpu) {
   L_0209CF64: ; // 0x209cf64
         /* 0209CF64 */ _t11 = cpu->r[31] + 0x00000480u;
         /* 0209CF64 */ cpu->r[0] = rbrew_read8(cpu->mem, _t11);
-        /* 0209CF68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209CF6C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CF68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209CF6C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CF6C */ _t13 = _t12 & 0x00000001u;
         /* 0209CF6C */ if (_t13) goto L_0209CF80; else goto L_0209CF70;
   L_0209CF70: ; // 0x209cf70
@@ -10755,8 +10755,8 @@ void Gambit_fn_0209CFB0(CPUState* cpu) {
         /* 0209CFD0 */ Gambit_fn_027ECBB4(cpu);
         /* 0209CFD4 */ _t5 = cpu->r[31] + 0x0000047Fu;
         /* 0209CFD4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t5);
-        /* 0209CFD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209CFDC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CFD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209CFDC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CFDC */ _t7 = _t6 & 0x00000001u;
         /* 0209CFDC */ if (_t7) goto L_0209CFF0; else goto L_0209CFE0;
   L_0209CFE0: ; // 0x209cfe0
@@ -10769,8 +10769,8 @@ void Gambit_fn_0209CFB0(CPUState* cpu) {
   L_0209CFF0: ; // 0x209cff0
         /* 0209CFF0 */ _t10 = cpu->r[31] + 0x00000480u;
         /* 0209CFF0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t10);
-        /* 0209CFF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209CFF8 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CFF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209CFF8 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CFF8 */ _t12 = _t11 & 0x00000001u;
         /* 0209CFF8 */ if (_t12) goto L_0209D00C; else goto L_0209CFFC;
   L_0209CFFC: ; // 0x209cffc
@@ -10822,8 +10822,8 @@ void Gambit_fn_0209CFB4(CPUState* cpu) {
         /* 0209CFD0 */ Gambit_fn_027ECBB4(cpu);
         /* 0209CFD4 */ _t5 = cpu->r[31] + 0x0000047Fu;
         /* 0209CFD4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t5);
-        /* 0209CFD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209CFDC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CFD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209CFDC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CFDC */ _t7 = _t6 & 0x00000001u;
         /* 0209CFDC */ if (_t7) goto L_0209CFF0; else goto L_0209CFE0;
   L_0209CFE0: ; // 0x209cfe0
@@ -10836,8 +10836,8 @@ void Gambit_fn_0209CFB4(CPUState* cpu) {
   L_0209CFF0: ; // 0x209cff0
         /* 0209CFF0 */ _t10 = cpu->r[31] + 0x00000480u;
         /* 0209CFF0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t10);
-        /* 0209CFF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209CFF8 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209CFF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209CFF8 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209CFF8 */ _t12 = _t11 & 0x00000001u;
         /* 0209CFF8 */ if (_t12) goto L_0209D00C; else goto L_0209CFFC;
   L_0209CFFC: ; // 0x209cffc
@@ -10901,8 +10901,8 @@ void Gambit_fn_0209D050(CPUState* cpu) {
         /* 0209D068 */ _t3 = cpu->r[3] + 0x00003400u;
         /* 0209D068 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0209D06C */ Gambit_fn_0206C030(cpu);
-        /* 0209D070 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209D074 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D070 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209D074 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D074 */ _t5 = _t4 & 0x00000001u;
         /* 0209D074 */ if (_t5) goto L_0209D080; else goto L_0209D078;
   L_0209D078: ; // 0x209d078
@@ -10943,8 +10943,8 @@ void Gambit_fn_0209D054(CPUState* cpu) {
         /* 0209D068 */ _t3 = cpu->r[3] + 0x00003400u;
         /* 0209D068 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0209D06C */ Gambit_fn_0206C030(cpu);
-        /* 0209D070 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209D074 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D070 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209D074 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D074 */ _t5 = _t4 & 0x00000001u;
         /* 0209D074 */ if (_t5) goto L_0209D080; else goto L_0209D078;
   L_0209D078: ; // 0x209d078
@@ -11016,8 +11016,8 @@ void Gambit_fn_0209D0BC(CPUState* cpu) {
         /* 020BAE40 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020BAE44 */ _t9 = cpu->r[29] + 0x0000027Cu;
         /* 020BAE44 */ cpu->r[3] = rbrew_read32(cpu->mem, _t9);
-        /* 020BAE48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BAE4C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAE48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BAE4C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAE4C */ _t11 = _t10 & 0x00000001u;
         /* 020BAE4C */ if (_t11) goto L_020BAE68; else goto L_020BAE50;
   L_020BAE50: ; // 0x20bae50
@@ -11043,15 +11043,15 @@ void Gambit_fn_0209D0BC(CPUState* cpu) {
         /* 020BAE80 */ rbrew_write32(cpu->mem, _t17, cpu->r[3]);
         /* 020BAE84 */ _t18 = cpu->r[31] + 0x0000047Cu;
         /* 020BAE84 */ cpu->r[0] = rbrew_read8(cpu->mem, _t18);
-        /* 020BAE88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BAE8C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAE88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BAE8C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAE8C */ _t20 = _t19 & 0x00000001u;
         /* 020BAE8C */ if (_t20) goto L_020BAF48; else goto L_020BAE90;
   L_020BAE90: ; // 0x20bae90
         /* 020BAE90 */ _t21 = cpu->r[31] + 0x00000444u;
         /* 020BAE90 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
-        /* 020BAE94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 020BAE98 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAE94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 020BAE98 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAE98 */ _t23 = _t22 & 0x00000001u;
         /* 020BAE98 */ if (_t23) goto L_020BAE9C; else goto L_020BAEE4;
   L_020BAE9C: ; // 0x20bae9c
@@ -11068,7 +11068,7 @@ void Gambit_fn_0209D0BC(CPUState* cpu) {
         /* 020BAEC0 */ cpu->r[6] = cpu->r[30];
         /* 020BAEC4 */ cpu->r[4] = cpu->r[31];
         /* 020BAEC8 */ cpu->r[3] = cpu->r[29];
-        /* 020BAECC */ _t25 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAECC */ _t25 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAECC */ _t26 = _t25 & 0x00000001u;
         /* 020BAECC */ if (_t26) goto L_020BAED0; // else: addr-0 trap, fall-through
   L_020BAED0: ; // 0x20baed0
@@ -11080,8 +11080,8 @@ void Gambit_fn_0209D0BC(CPUState* cpu) {
   L_020BAEE4: ; // 0x20baee4
         /* 020BAEE4 */ _t27 = cpu->r[31] + 0x00000444u;
         /* 020BAEE4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t27);
-        /* 020BAEE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000001u);
-        /* 020BAEEC */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAEE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000001u));
+        /* 020BAEEC */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAEEC */ _t29 = _t28 & 0x00000001u;
         /* 020BAEEC */ if (_t29) goto L_020BAEF0; else goto L_020BAF24;
   L_020BAEF0: ; // 0x20baef0
@@ -11092,7 +11092,7 @@ void Gambit_fn_0209D0BC(CPUState* cpu) {
         /* 020BAF00 */ cpu->r[5] = 0x00000001u;
         /* 020BAF04 */ cpu->r[4] = cpu->r[31];
         /* 020BAF08 */ cpu->r[3] = cpu->r[29];
-        /* 020BAF0C */ _t30 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAF0C */ _t30 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAF0C */ _t31 = _t30 & 0x00000001u;
         /* 020BAF0C */ if (_t31) goto L_020BAF10; // else: addr-0 trap, fall-through
   L_020BAF10: ; // 0x20baf10
@@ -11105,7 +11105,7 @@ void Gambit_fn_0209D0BC(CPUState* cpu) {
         /* 020BAF24 */ cpu->r[5] = 0x00000000u;
         /* 020BAF28 */ cpu->r[4] = cpu->r[31];
         /* 020BAF2C */ cpu->r[3] = cpu->r[29];
-        /* 020BAF30 */ _t32 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAF30 */ _t32 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAF30 */ _t33 = _t32 & 0x00000001u;
         /* 020BAF30 */ if (_t33) goto L_020BAF34; // else: addr-0 trap, fall-through
   L_020BAF34: ; // 0x20baf34
@@ -11118,7 +11118,7 @@ void Gambit_fn_0209D0BC(CPUState* cpu) {
         /* 020BAF48 */ cpu->r[5] = 0x00000000u;
         /* 020BAF4C */ cpu->r[4] = cpu->r[31] + 0x00000488u;
         /* 020BAF50 */ cpu->r[3] = cpu->r[29];
-        /* 020BAF54 */ _t34 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAF54 */ _t34 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAF54 */ _t35 = _t34 & 0x00000001u;
         /* 020BAF54 */ if (_t35) goto L_020BAF58; // else: addr-0 trap, fall-through
   L_020BAF58: ; // 0x20baf58
@@ -11180,8 +11180,8 @@ void Gambit_fn_0209D0DC(CPUState* cpu) {
   L_020BB008: ; // 0x20bb008
         /* 020BB008 */ _t1 = cpu->r[3] + 0x0000027Cu;
         /* 020BB008 */ cpu->r[3] = rbrew_read32(cpu->mem, _t1);
-        /* 020BB00C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BB010 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB00C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BB010 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB010 */ _t3 = _t2 & 0x00000001u;
         /* 020BB010 */ if (_t3) goto L_020BB024; else goto L_020BB014;
   L_020BB014: ; // 0x20bb014
@@ -11335,8 +11335,8 @@ void Gambit_fn_0209D15C(CPUState* cpu) {
         /* 0209D188 */ Gambit_fn_027ECBB4(cpu);
         /* 0209D18C */ _t6 = cpu->r[31] + 0x0000047Fu;
         /* 0209D18C */ cpu->r[0] = rbrew_read8(cpu->mem, _t6);
-        /* 0209D190 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209D194 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D190 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209D194 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D194 */ _t8 = _t7 & 0x00000001u;
         /* 0209D194 */ if (_t8) goto L_0209D1A8; else goto L_0209D198;
   L_0209D198: ; // 0x209d198
@@ -11349,8 +11349,8 @@ void Gambit_fn_0209D15C(CPUState* cpu) {
   L_0209D1A8: ; // 0x209d1a8
         /* 0209D1A8 */ _t11 = cpu->r[31] + 0x00000480u;
         /* 0209D1A8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t11);
-        /* 0209D1AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209D1B0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D1AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209D1B0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D1B0 */ _t13 = _t12 & 0x00000001u;
         /* 0209D1B0 */ if (_t13) goto L_0209D1C4; else goto L_0209D1B4;
   L_0209D1B4: ; // 0x209d1b4
@@ -11406,8 +11406,8 @@ void Gambit_fn_0209D160(CPUState* cpu) {
         /* 0209D188 */ Gambit_fn_027ECBB4(cpu);
         /* 0209D18C */ _t6 = cpu->r[31] + 0x0000047Fu;
         /* 0209D18C */ cpu->r[0] = rbrew_read8(cpu->mem, _t6);
-        /* 0209D190 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209D194 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D190 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209D194 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D194 */ _t8 = _t7 & 0x00000001u;
         /* 0209D194 */ if (_t8) goto L_0209D1A8; else goto L_0209D198;
   L_0209D198: ; // 0x209d198
@@ -11420,8 +11420,8 @@ void Gambit_fn_0209D160(CPUState* cpu) {
   L_0209D1A8: ; // 0x209d1a8
         /* 0209D1A8 */ _t11 = cpu->r[31] + 0x00000480u;
         /* 0209D1A8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t11);
-        /* 0209D1AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209D1B0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D1AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209D1B0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D1B0 */ _t13 = _t12 & 0x00000001u;
         /* 0209D1B0 */ if (_t13) goto L_0209D1C4; else goto L_0209D1B4;
   L_0209D1B4: ; // 0x209d1b4
@@ -11485,8 +11485,8 @@ void Gambit_fn_0209D208(CPUState* cpu) {
         /* 0209D220 */ _t3 = cpu->r[3] + 0x00003400u;
         /* 0209D220 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0209D224 */ Gambit_fn_0206C030(cpu);
-        /* 0209D228 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209D22C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209D22C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D22C */ _t5 = _t4 & 0x00000001u;
         /* 0209D22C */ if (_t5) goto L_0209D238; else goto L_0209D230;
   L_0209D230: ; // 0x209d230
@@ -11527,8 +11527,8 @@ void Gambit_fn_0209D20C(CPUState* cpu) {
         /* 0209D220 */ _t3 = cpu->r[3] + 0x00003400u;
         /* 0209D220 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0209D224 */ Gambit_fn_0206C030(cpu);
-        /* 0209D228 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209D22C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209D22C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D22C */ _t5 = _t4 & 0x00000001u;
         /* 0209D22C */ if (_t5) goto L_0209D238; else goto L_0209D230;
   L_0209D230: ; // 0x209d230
@@ -11585,8 +11585,8 @@ void Gambit_fn_0209D260(CPUState* cpu) {
         /* 020BAE40 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020BAE44 */ _t9 = cpu->r[29] + 0x0000027Cu;
         /* 020BAE44 */ cpu->r[3] = rbrew_read32(cpu->mem, _t9);
-        /* 020BAE48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BAE4C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAE48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BAE4C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAE4C */ _t11 = _t10 & 0x00000001u;
         /* 020BAE4C */ if (_t11) goto L_020BAE68; else goto L_020BAE50;
   L_020BAE50: ; // 0x20bae50
@@ -11612,15 +11612,15 @@ void Gambit_fn_0209D260(CPUState* cpu) {
         /* 020BAE80 */ rbrew_write32(cpu->mem, _t17, cpu->r[3]);
         /* 020BAE84 */ _t18 = cpu->r[31] + 0x0000047Cu;
         /* 020BAE84 */ cpu->r[0] = rbrew_read8(cpu->mem, _t18);
-        /* 020BAE88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BAE8C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAE88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BAE8C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAE8C */ _t20 = _t19 & 0x00000001u;
         /* 020BAE8C */ if (_t20) goto L_020BAF48; else goto L_020BAE90;
   L_020BAE90: ; // 0x20bae90
         /* 020BAE90 */ _t21 = cpu->r[31] + 0x00000444u;
         /* 020BAE90 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
-        /* 020BAE94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 020BAE98 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAE94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 020BAE98 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAE98 */ _t23 = _t22 & 0x00000001u;
         /* 020BAE98 */ if (_t23) goto L_020BAE9C; else goto L_020BAEE4;
   L_020BAE9C: ; // 0x20bae9c
@@ -11637,7 +11637,7 @@ void Gambit_fn_0209D260(CPUState* cpu) {
         /* 020BAEC0 */ cpu->r[6] = cpu->r[30];
         /* 020BAEC4 */ cpu->r[4] = cpu->r[31];
         /* 020BAEC8 */ cpu->r[3] = cpu->r[29];
-        /* 020BAECC */ _t25 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAECC */ _t25 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAECC */ _t26 = _t25 & 0x00000001u;
         /* 020BAECC */ if (_t26) goto L_020BAED0; // else: addr-0 trap, fall-through
   L_020BAED0: ; // 0x20baed0
@@ -11649,8 +11649,8 @@ void Gambit_fn_0209D260(CPUState* cpu) {
   L_020BAEE4: ; // 0x20baee4
         /* 020BAEE4 */ _t27 = cpu->r[31] + 0x00000444u;
         /* 020BAEE4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t27);
-        /* 020BAEE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000001u);
-        /* 020BAEEC */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAEE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000001u));
+        /* 020BAEEC */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAEEC */ _t29 = _t28 & 0x00000001u;
         /* 020BAEEC */ if (_t29) goto L_020BAEF0; else goto L_020BAF24;
   L_020BAEF0: ; // 0x20baef0
@@ -11661,7 +11661,7 @@ void Gambit_fn_0209D260(CPUState* cpu) {
         /* 020BAF00 */ cpu->r[5] = 0x00000001u;
         /* 020BAF04 */ cpu->r[4] = cpu->r[31];
         /* 020BAF08 */ cpu->r[3] = cpu->r[29];
-        /* 020BAF0C */ _t30 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAF0C */ _t30 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAF0C */ _t31 = _t30 & 0x00000001u;
         /* 020BAF0C */ if (_t31) goto L_020BAF10; // else: addr-0 trap, fall-through
   L_020BAF10: ; // 0x20baf10
@@ -11674,7 +11674,7 @@ void Gambit_fn_0209D260(CPUState* cpu) {
         /* 020BAF24 */ cpu->r[5] = 0x00000000u;
         /* 020BAF28 */ cpu->r[4] = cpu->r[31];
         /* 020BAF2C */ cpu->r[3] = cpu->r[29];
-        /* 020BAF30 */ _t32 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAF30 */ _t32 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAF30 */ _t33 = _t32 & 0x00000001u;
         /* 020BAF30 */ if (_t33) goto L_020BAF34; // else: addr-0 trap, fall-through
   L_020BAF34: ; // 0x20baf34
@@ -11687,7 +11687,7 @@ void Gambit_fn_0209D260(CPUState* cpu) {
         /* 020BAF48 */ cpu->r[5] = 0x00000000u;
         /* 020BAF4C */ cpu->r[4] = cpu->r[31] + 0x00000488u;
         /* 020BAF50 */ cpu->r[3] = cpu->r[29];
-        /* 020BAF54 */ _t34 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAF54 */ _t34 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAF54 */ _t35 = _t34 & 0x00000001u;
         /* 020BAF54 */ if (_t35) goto L_020BAF58; // else: addr-0 trap, fall-through
   L_020BAF58: ; // 0x20baf58
@@ -11727,7 +11727,7 @@ void Gambit_fn_0209D270(CPUState* cpu) {
         /* 020D9834 */ _t3 = cpu->r[3] + 0x000012FCu;
         /* 020D9834 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 020D9838 */ cpu->r[12] = cpu->r[11] + 0xFFFFFFFFu;
-        /* 020D983C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[12]);
+        /* 020D983C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[12]));
         /* 020D9840 */ /* nop */
         /* 020D9844 */ cpu->r[3] = rbrew_rlwinm(cpu->r[12], 0x00000001u, 0x0000001Fu, 0x0000001Fu);
         /* 020D9848 */ cpu->r[3] = cpu->r[3] ^ 0x00000001u;
@@ -11767,8 +11767,8 @@ void Gambit_fn_0209D280(CPUState* cpu) {
   L_020BB008: ; // 0x20bb008
         /* 020BB008 */ _t1 = cpu->r[3] + 0x0000027Cu;
         /* 020BB008 */ cpu->r[3] = rbrew_read32(cpu->mem, _t1);
-        /* 020BB00C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BB010 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB00C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BB010 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB010 */ _t3 = _t2 & 0x00000001u;
         /* 020BB010 */ if (_t3) goto L_020BB024; else goto L_020BB014;
   L_020BB014: ; // 0x20bb014
@@ -11860,16 +11860,16 @@ void Gambit_fn_0209D2B8(CPUState* cpu) {
         /* 020A8324 */ _t7 = cpu->r[28] + 0x00000008u;
         /* 020A8324 */ cpu->r[0] = rbrew_read32(cpu->mem, _t7);
         /* 020A8328 */ cpu->r[30] = 0x00000000u;
-        /* 020A832C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
-        /* 020A8330 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020A832C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
+        /* 020A8330 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020A8330 */ _t9 = _t8 & 0x00000001u;
         /* 020A8330 */ if (_t9) goto L_020A8334; else goto L_020A8368;
   L_020A8334: ; // 0x20a8334
         /* 020A8334 */ cpu->r[31] = 0x00000000u;
   L_020A8338: ; // 0x20a8338
-        /* 020A8338 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
+        /* 020A8338 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
         /* 020A833C */ cpu->r[3] = 0x00000000u;
-        /* 020A8340 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020A8340 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020A8340 */ _t11 = _t10 & 0x00000001u;
         /* 020A8340 */ if (_t11) goto L_020A8344; else goto L_020A834C;
   L_020A8344: ; // 0x20a8344
@@ -11883,9 +11883,9 @@ void Gambit_fn_0209D2B8(CPUState* cpu) {
         /* 020A8354 */ _t14 = cpu->r[28] + 0x00000008u;
         /* 020A8354 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 020A8358 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020A835C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 020A835C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 020A8360 */ cpu->r[31] = cpu->r[31] + 0x00000004u;
-        /* 020A8364 */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020A8364 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020A8364 */ _t16 = _t15 & 0x00000001u;
         /* 020A8364 */ if (_t16) goto L_020A8338; else goto L_020A8368;
   L_020A8368: ; // 0x20a8368
@@ -11946,8 +11946,8 @@ void Gambit_fn_0209D2D8(CPUState* cpu) {
         /* 0209D2F4 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 0209D2F8 */ cpu->r[29] = cpu->r[3];
         /* 0209D2FC */ Gambit_fn_0209D2C0(cpu);
-        /* 0209D300 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209D304 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D300 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209D304 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D304 */ _t6 = _t5 & 0x00000001u;
         /* 0209D304 */ if (_t6) goto L_0209D308; else goto L_0209D31C;
   L_0209D308: ; // 0x209d308
@@ -11965,8 +11965,8 @@ void Gambit_fn_0209D2D8(CPUState* cpu) {
         /* 0209D320 */ Gambit_fn_027ECBB4(cpu);
         /* 0209D324 */ _t11 = cpu->r[30] + 0x0000047Fu;
         /* 0209D324 */ cpu->r[10] = rbrew_read8(cpu->mem, _t11);
-        /* 0209D328 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0209D32C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D328 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0209D32C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D32C */ _t13 = _t12 & 0x00000001u;
         /* 0209D32C */ if (_t13) goto L_0209D340; else goto L_0209D330;
   L_0209D330: ; // 0x209d330
@@ -11979,8 +11979,8 @@ void Gambit_fn_0209D2D8(CPUState* cpu) {
   L_0209D340: ; // 0x209d340
         /* 0209D340 */ _t16 = cpu->r[30] + 0x00000480u;
         /* 0209D340 */ cpu->r[0] = rbrew_read8(cpu->mem, _t16);
-        /* 0209D344 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209D348 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D344 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209D348 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D348 */ _t18 = _t17 & 0x00000001u;
         /* 0209D348 */ if (_t18) goto L_0209D35C; else goto L_0209D34C;
   L_0209D34C: ; // 0x209d34c
@@ -12029,8 +12029,8 @@ void Gambit_fn_0209D2DC(CPUState* cpu) {
         /* 0209D2F4 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 0209D2F8 */ cpu->r[29] = cpu->r[3];
         /* 0209D2FC */ Gambit_fn_0209D2C0(cpu);
-        /* 0209D300 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209D304 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D300 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209D304 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D304 */ _t6 = _t5 & 0x00000001u;
         /* 0209D304 */ if (_t6) goto L_0209D308; else goto L_0209D31C;
   L_0209D308: ; // 0x209d308
@@ -12048,8 +12048,8 @@ void Gambit_fn_0209D2DC(CPUState* cpu) {
         /* 0209D320 */ Gambit_fn_027ECBB4(cpu);
         /* 0209D324 */ _t11 = cpu->r[30] + 0x0000047Fu;
         /* 0209D324 */ cpu->r[10] = rbrew_read8(cpu->mem, _t11);
-        /* 0209D328 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0209D32C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D328 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0209D32C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D32C */ _t13 = _t12 & 0x00000001u;
         /* 0209D32C */ if (_t13) goto L_0209D340; else goto L_0209D330;
   L_0209D330: ; // 0x209d330
@@ -12062,8 +12062,8 @@ void Gambit_fn_0209D2DC(CPUState* cpu) {
   L_0209D340: ; // 0x209d340
         /* 0209D340 */ _t16 = cpu->r[30] + 0x00000480u;
         /* 0209D340 */ cpu->r[0] = rbrew_read8(cpu->mem, _t16);
-        /* 0209D344 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209D348 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D344 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209D348 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D348 */ _t18 = _t17 & 0x00000001u;
         /* 0209D348 */ if (_t18) goto L_0209D35C; else goto L_0209D34C;
   L_0209D34C: ; // 0x209d34c
@@ -12124,11 +12124,11 @@ void Gambit_fn_0209D39C(CPUState* cpu) {
         /* 0209D3B0 */ Gambit_fn_0209D388(cpu);
         /* 0209D3B4 */ _t3 = cpu->r[31] + 0x00000040u;
         /* 0209D3B4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0209D3B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0209D3B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0209D3BC */ _t4 = cpu->r[11] + 0x00000000u;
         /* 0209D3BC */ cpu->r[12] = rbrew_read32(cpu->mem, _t4);
         /* 0209D3C0 */ cpu->r[3] = cpu->r[11];
-        /* 0209D3C4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D3C4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D3C4 */ _t6 = _t5 & 0x00000001u;
         /* 0209D3C4 */ if (_t6) goto L_0209D3E8; else goto L_0209D3C8;
   L_0209D3C8: ; // 0x209d3c8
@@ -12173,11 +12173,11 @@ void Gambit_fn_0209D3A0(CPUState* cpu) {
         /* 0209D3B0 */ Gambit_fn_0209D388(cpu);
         /* 0209D3B4 */ _t3 = cpu->r[31] + 0x00000040u;
         /* 0209D3B4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0209D3B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0209D3B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0209D3BC */ _t4 = cpu->r[11] + 0x00000000u;
         /* 0209D3BC */ cpu->r[12] = rbrew_read32(cpu->mem, _t4);
         /* 0209D3C0 */ cpu->r[3] = cpu->r[11];
-        /* 0209D3C4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D3C4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D3C4 */ _t6 = _t5 & 0x00000001u;
         /* 0209D3C4 */ if (_t6) goto L_0209D3E8; else goto L_0209D3C8;
   L_0209D3C8: ; // 0x209d3c8
@@ -12369,18 +12369,18 @@ void Gambit_fn_0209D45C(CPUState* cpu) {
         /* 0209D45C */ cpu->r[0] = cpu->lr;
         /* 0209D460 */ _t0 = cpu->r[1] + 0x00000004u;
         /* 0209D460 */ rbrew_write32(cpu->mem, _t0, cpu->r[0]);
-        /* 0209D464 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0209D464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0209D468 */ _t1 = cpu->r[1] + 0xFFFFFFF8u;
         /* 0209D468 */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0209D468 */ cpu->r[1] = _t1;
-        /* 0209D46C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D46C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D46C */ _t3 = _t2 & 0x00000001u;
         /* 0209D46C */ if (_t3) goto L_0209D470; else goto L_0209D480;
   L_0209D470: ; // 0x209d470
         /* 0209D470 */ cpu->r[3] = 0x00000010u;
         /* 0209D474 */ Gambit_fn_02801A78(cpu);
-        /* 0209D478 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209D47C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D478 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209D47C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D47C */ _t5 = _t4 & 0x00000001u;
         /* 0209D47C */ if (_t5) goto L_0209D4AC; else goto L_0209D480;
   L_0209D480: ; // 0x209d480
@@ -12421,14 +12421,14 @@ void Gambit_fn_0209D468(CPUState* cpu) {
         /* 0209D468 */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 0209D468 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 0209D468 */ cpu->r[1] = _t0;
-        /* 0209D46C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D46C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D46C */ _t2 = _t1 & 0x00000001u;
         /* 0209D46C */ if (_t2) goto L_0209D470; else goto L_0209D480;
   L_0209D470: ; // 0x209d470
         /* 0209D470 */ cpu->r[3] = 0x00000010u;
         /* 0209D474 */ Gambit_fn_02801A78(cpu);
-        /* 0209D478 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209D47C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D478 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209D47C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D47C */ _t4 = _t3 & 0x00000001u;
         /* 0209D47C */ if (_t4) goto L_0209D4AC; else goto L_0209D480;
   L_0209D480: ; // 0x209d480
@@ -12565,11 +12565,11 @@ void Gambit_fn_0209D500(CPUState* cpu) {
         /* 0209D650 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0209D650 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0209D654 */ cpu->r[30] = cpu->r[3];
-        /* 0209D654 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209D654 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209D658 */ cpu->r[31] = cpu->r[4];
         /* 0209D65C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209D65C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209D660 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D660 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D660 */ _t5 = _t4 & 0x00000001u;
         /* 0209D660 */ if (_t5) goto L_0209D6D0; else goto L_0209D664;
   L_0209D664: ; // 0x209d664
@@ -12583,10 +12583,10 @@ void Gambit_fn_0209D500(CPUState* cpu) {
         /* 0209D67C */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0209D67C */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0209D680 */ cpu->r[11] = cpu->r[11] + 0x0000178Cu;
-        /* 0209D684 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209D684 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209D688 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0209D688 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0209D68C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D68C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D68C */ _t10 = _t9 & 0x00000001u;
         /* 0209D68C */ if (_t10) goto L_0209D6C0; else goto L_0209D690;
   L_0209D690: ; // 0x209d690
@@ -12607,8 +12607,8 @@ void Gambit_fn_0209D500(CPUState* cpu) {
         /* 0209D6BC */ Gambit_fn_02068798(cpu);
   L_0209D6C0: ; // 0x209d6c0
         /* 0209D6C0 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209D6C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209D6C4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D6C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209D6C4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D6C4 */ _t15 = _t14 & 0x00000001u;
         /* 0209D6C4 */ if (_t15) goto L_0209D6D0; else goto L_0209D6C8;
   L_0209D6C8: ; // 0x209d6c8
@@ -12636,8 +12636,8 @@ void Gambit_fn_0209D508(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -12688,18 +12688,18 @@ void Gambit_fn_0209D520(CPUState* cpu) {
         /* 0209D528 */ _t1 = cpu->r[1] + 0x0000001Cu;
         /* 0209D528 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0209D52C */ cpu->r[31] = cpu->r[3];
-        /* 0209D52C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209D52C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209D530 */ _t2 = cpu->r[1] + 0x00000024u;
         /* 0209D530 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0209D534 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D534 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D534 */ _t4 = _t3 & 0x00000001u;
         /* 0209D534 */ if (_t4) goto L_0209D538; else goto L_0209D548;
   L_0209D538: ; // 0x209d538
         /* 0209D538 */ cpu->r[3] = 0x0000028Cu;
         /* 0209D53C */ Gambit_fn_02801A78(cpu);
         /* 0209D540 */ cpu->r[31] = cpu->r[3];
-        /* 0209D540 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209D544 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D540 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209D544 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D544 */ _t6 = _t5 & 0x00000001u;
         /* 0209D544 */ if (_t6) goto L_0209D5BC; else goto L_0209D548;
   L_0209D548: ; // 0x209d548
@@ -12762,18 +12762,18 @@ void Gambit_fn_0209D524(CPUState* cpu) {
         /* 0209D528 */ _t1 = cpu->r[1] + 0x0000001Cu;
         /* 0209D528 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0209D52C */ cpu->r[31] = cpu->r[3];
-        /* 0209D52C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209D52C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209D530 */ _t2 = cpu->r[1] + 0x00000024u;
         /* 0209D530 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0209D534 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D534 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D534 */ _t4 = _t3 & 0x00000001u;
         /* 0209D534 */ if (_t4) goto L_0209D538; else goto L_0209D548;
   L_0209D538: ; // 0x209d538
         /* 0209D538 */ cpu->r[3] = 0x0000028Cu;
         /* 0209D53C */ Gambit_fn_02801A78(cpu);
         /* 0209D540 */ cpu->r[31] = cpu->r[3];
-        /* 0209D540 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209D544 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D540 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209D544 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D544 */ _t6 = _t5 & 0x00000001u;
         /* 0209D544 */ if (_t6) goto L_0209D5BC; else goto L_0209D548;
   L_0209D548: ; // 0x209d548
@@ -12902,15 +12902,15 @@ void Gambit_fn_0209D630(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209D630: ; // 0x209d630
-        /* 0209D630 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209D634 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D630 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209D634 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D634 */ _t1 = _t0 & 0x00000001u;
         /* 0209D634 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209D634 */ goto L_0209D638;
   L_0209D638: ; // 0x209d638
         /* 0209D638 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209D638 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209D63C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D638 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209D63C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D63C */ _t3 = _t2 & 0x00000001u;
         /* 0209D63C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209D63C */ goto L_0209D640;
@@ -12929,8 +12929,8 @@ void Gambit_fn_0209D630(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -12944,15 +12944,15 @@ void Gambit_fn_0209D630(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -12989,11 +12989,11 @@ void Gambit_fn_0209D644(CPUState* cpu) {
         /* 0209D650 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0209D650 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0209D654 */ cpu->r[30] = cpu->r[3];
-        /* 0209D654 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209D654 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209D658 */ cpu->r[31] = cpu->r[4];
         /* 0209D65C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209D65C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209D660 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D660 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D660 */ _t5 = _t4 & 0x00000001u;
         /* 0209D660 */ if (_t5) goto L_0209D6D0; else goto L_0209D664;
   L_0209D664: ; // 0x209d664
@@ -13007,10 +13007,10 @@ void Gambit_fn_0209D644(CPUState* cpu) {
         /* 0209D67C */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0209D67C */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0209D680 */ cpu->r[11] = cpu->r[11] + 0x0000178Cu;
-        /* 0209D684 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209D684 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209D688 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0209D688 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0209D68C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D68C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D68C */ _t10 = _t9 & 0x00000001u;
         /* 0209D68C */ if (_t10) goto L_0209D6C0; else goto L_0209D690;
   L_0209D690: ; // 0x209d690
@@ -13031,8 +13031,8 @@ void Gambit_fn_0209D644(CPUState* cpu) {
         /* 0209D6BC */ Gambit_fn_02068798(cpu);
   L_0209D6C0: ; // 0x209d6c0
         /* 0209D6C0 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209D6C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209D6C4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D6C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209D6C4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D6C4 */ _t15 = _t14 & 0x00000001u;
         /* 0209D6C4 */ if (_t15) goto L_0209D6D0; else goto L_0209D6C8;
   L_0209D6C8: ; // 0x209d6c8
@@ -13063,11 +13063,11 @@ void Gambit_fn_0209D648(CPUState* cpu) {
         /* 0209D650 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0209D650 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0209D654 */ cpu->r[30] = cpu->r[3];
-        /* 0209D654 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209D654 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209D658 */ cpu->r[31] = cpu->r[4];
         /* 0209D65C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209D65C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209D660 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D660 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D660 */ _t5 = _t4 & 0x00000001u;
         /* 0209D660 */ if (_t5) goto L_0209D6D0; else goto L_0209D664;
   L_0209D664: ; // 0x209d664
@@ -13081,10 +13081,10 @@ void Gambit_fn_0209D648(CPUState* cpu) {
         /* 0209D67C */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0209D67C */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0209D680 */ cpu->r[11] = cpu->r[11] + 0x0000178Cu;
-        /* 0209D684 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209D684 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209D688 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0209D688 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0209D68C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D68C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D68C */ _t10 = _t9 & 0x00000001u;
         /* 0209D68C */ if (_t10) goto L_0209D6C0; else goto L_0209D690;
   L_0209D690: ; // 0x209d690
@@ -13105,8 +13105,8 @@ void Gambit_fn_0209D648(CPUState* cpu) {
         /* 0209D6BC */ Gambit_fn_02068798(cpu);
   L_0209D6C0: ; // 0x209d6c0
         /* 0209D6C0 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209D6C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209D6C4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D6C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209D6C4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D6C4 */ _t15 = _t14 & 0x00000001u;
         /* 0209D6C4 */ if (_t15) goto L_0209D6D0; else goto L_0209D6C8;
   L_0209D6C8: ; // 0x209d6c8
@@ -13281,10 +13281,10 @@ void Gambit_fn_0209D764(CPUState* cpu) {
         /* 0209D764 */ cpu->r[12] = 0x101D0000u;
         /* 0209D768 */ _t0 = cpu->r[12] + 0xFFFFE370u;
         /* 0209D768 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 0209D76C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0209D76C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0209D770 */ cpu->r[12] = 0x101D0000u;
         /* 0209D774 */ cpu->r[12] = cpu->r[12] + 0xFFFFEE18u;
-        /* 0209D778 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D778 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D778 */ _t2 = _t1 & 0x00000001u;
         /* 0209D778 */ if (_t2) goto L_0209D77C; else goto L_0209D794;
   L_0209D77C: ; // 0x209d77c
@@ -13297,8 +13297,8 @@ void Gambit_fn_0209D764(CPUState* cpu) {
         /* 0209D790 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 0209D790 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_0209D794: ; // 0x209d794
-        /* 0209D794 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0209D798 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D794 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0209D798 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D798 */ _t6 = _t5 & 0x00000001u;
         /* 0209D798 */ if (_t6) goto L_0209D79C; else goto L_0209D7A4;
   L_0209D79C: ; // 0x209d79c
@@ -13310,9 +13310,9 @@ void Gambit_fn_0209D764(CPUState* cpu) {
         /* 0209D7A8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 0209D7A8 */ cpu->r[11] = _t7;
         /* 0209D7AC */ cpu->r[10] = 0x101D0000u;
-        /* 0209D7B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0209D7B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0209D7B4 */ cpu->r[10] = cpu->r[10] + 0xFFFFED90u;
-        /* 0209D7B8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D7B8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D7B8 */ _t9 = _t8 & 0x00000001u;
         /* 0209D7B8 */ if (_t9) goto L_0209D7BC; else goto L_0209D7D0;
   L_0209D7BC: ; // 0x209d7bc
@@ -13324,8 +13324,8 @@ void Gambit_fn_0209D764(CPUState* cpu) {
         /* 0209D7CC */ _t11 = cpu->r[10] + 0x00000000u;
         /* 0209D7CC */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
   L_0209D7D0: ; // 0x209d7d0
-        /* 0209D7D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0209D7D4 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D7D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0209D7D4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D7D4 */ _t13 = _t12 & 0x00000001u;
         /* 0209D7D4 */ if (_t13) goto L_0209D7D8; else goto L_0209D7E0;
   L_0209D7D8: ; // 0x209d7d8
@@ -13337,9 +13337,9 @@ void Gambit_fn_0209D764(CPUState* cpu) {
         /* 0209D7E4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 0209D7E4 */ cpu->r[8] = _t14;
         /* 0209D7E8 */ cpu->r[11] = 0x101D0000u;
-        /* 0209D7EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0209D7EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0209D7F0 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 0209D7F4 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D7F4 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D7F4 */ _t16 = _t15 & 0x00000001u;
         /* 0209D7F4 */ if (_t16) goto L_0209D7F8; else goto L_0209D80C;
   L_0209D7F8: ; // 0x209d7f8
@@ -13412,18 +13412,18 @@ void Gambit_fn_0209D838(CPUState* cpu) {
         /* 02053FC4 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02053FC4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02053FC8 */ cpu->r[12] = 0x00000000u;
-        /* 02053FCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02053FCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02053FD0 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 02053FD0 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02053FD4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02053FD4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02053FD4 */ _t6 = _t5 & 0x00000001u;
         /* 02053FD4 */ if (_t6) goto L_02053FFC; else goto L_02053FD8;
   L_02053FD8: ; // 0x2053fd8
         /* 02053FD8 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02053FD8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02053FDC */ /* nop */
-        /* 02053FE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 02053FE4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02053FE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 02053FE4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02053FE4 */ _t9 = _t8 & 0x00000001u;
         /* 02053FE4 */ if (_t9) goto L_02053FE8; else goto L_02053FFC;
   L_02053FE8: ; // 0x2053fe8
@@ -13468,11 +13468,11 @@ void Gambit_fn_0209D840(CPUState* cpu) {
         /* 0209DD04 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0209DD04 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0209DD08 */ cpu->r[30] = cpu->r[3];
-        /* 0209DD08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209DD08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209DD0C */ cpu->r[31] = cpu->r[4];
         /* 0209DD10 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209DD10 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209DD14 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209DD14 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209DD14 */ _t5 = _t4 & 0x00000001u;
         /* 0209DD14 */ if (_t5) goto L_0209DD84; else goto L_0209DD18;
   L_0209DD18: ; // 0x209dd18
@@ -13486,10 +13486,10 @@ void Gambit_fn_0209D840(CPUState* cpu) {
         /* 0209DD30 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0209DD30 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0209DD34 */ cpu->r[11] = cpu->r[11] + 0x00001B4Cu;
-        /* 0209DD38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209DD38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209DD3C */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0209DD3C */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0209DD40 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209DD40 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209DD40 */ _t10 = _t9 & 0x00000001u;
         /* 0209DD40 */ if (_t10) goto L_0209DD74; else goto L_0209DD44;
   L_0209DD44: ; // 0x209dd44
@@ -13510,8 +13510,8 @@ void Gambit_fn_0209D840(CPUState* cpu) {
         /* 0209DD70 */ Gambit_fn_02068798(cpu);
   L_0209DD74: ; // 0x209dd74
         /* 0209DD74 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209DD74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209DD78 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209DD74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209DD78 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209DD78 */ _t15 = _t14 & 0x00000001u;
         /* 0209DD78 */ if (_t15) goto L_0209DD84; else goto L_0209DD7C;
   L_0209DD7C: ; // 0x209dd7c
@@ -13539,8 +13539,8 @@ void Gambit_fn_0209D848(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -13591,18 +13591,18 @@ void Gambit_fn_0209D860(CPUState* cpu) {
         /* 0209D868 */ _t1 = cpu->r[1] + 0x0000001Cu;
         /* 0209D868 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0209D86C */ cpu->r[31] = cpu->r[3];
-        /* 0209D86C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209D86C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209D870 */ _t2 = cpu->r[1] + 0x00000024u;
         /* 0209D870 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0209D874 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D874 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D874 */ _t4 = _t3 & 0x00000001u;
         /* 0209D874 */ if (_t4) goto L_0209D878; else goto L_0209D888;
   L_0209D878: ; // 0x209d878
         /* 0209D878 */ cpu->r[3] = 0x00000290u;
         /* 0209D87C */ Gambit_fn_02801A78(cpu);
         /* 0209D880 */ cpu->r[31] = cpu->r[3];
-        /* 0209D880 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209D884 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D880 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209D884 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D884 */ _t6 = _t5 & 0x00000001u;
         /* 0209D884 */ if (_t6) goto L_0209D904; else goto L_0209D888;
   L_0209D888: ; // 0x209d888
@@ -13668,18 +13668,18 @@ void Gambit_fn_0209D864(CPUState* cpu) {
         /* 0209D868 */ _t1 = cpu->r[1] + 0x0000001Cu;
         /* 0209D868 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0209D86C */ cpu->r[31] = cpu->r[3];
-        /* 0209D86C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209D86C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209D870 */ _t2 = cpu->r[1] + 0x00000024u;
         /* 0209D870 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0209D874 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D874 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D874 */ _t4 = _t3 & 0x00000001u;
         /* 0209D874 */ if (_t4) goto L_0209D878; else goto L_0209D888;
   L_0209D878: ; // 0x209d878
         /* 0209D878 */ cpu->r[3] = 0x00000290u;
         /* 0209D87C */ Gambit_fn_02801A78(cpu);
         /* 0209D880 */ cpu->r[31] = cpu->r[3];
-        /* 0209D880 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209D884 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209D880 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209D884 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209D884 */ _t6 = _t5 & 0x00000001u;
         /* 0209D884 */ if (_t6) goto L_0209D904; else goto L_0209D888;
   L_0209D888: ; // 0x209d888
@@ -13771,8 +13771,8 @@ void Gambit_fn_0209D91C(CPUState* cpu) {
         /* 020BA9A8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020BA9AC */ _t10 = cpu->r[29] + 0x0000027Cu;
         /* 020BA9AC */ cpu->r[3] = rbrew_read32(cpu->mem, _t10);
-        /* 020BA9B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BA9B4 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA9B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BA9B4 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA9B4 */ _t12 = _t11 & 0x00000001u;
         /* 020BA9B4 */ if (_t12) goto L_020BA9D0; else goto L_020BA9B8;
   L_020BA9B8: ; // 0x20ba9b8
@@ -13798,15 +13798,15 @@ void Gambit_fn_0209D91C(CPUState* cpu) {
         /* 020BA9E8 */ rbrew_write32(cpu->mem, _t18, cpu->r[3]);
         /* 020BA9EC */ _t19 = cpu->r[31] + 0x0000047Cu;
         /* 020BA9EC */ cpu->r[0] = rbrew_read8(cpu->mem, _t19);
-        /* 020BA9F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BA9F4 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA9F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BA9F4 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA9F4 */ _t21 = _t20 & 0x00000001u;
         /* 020BA9F4 */ if (_t21) goto L_020BAB04; else goto L_020BA9F8;
   L_020BA9F8: ; // 0x20ba9f8
         /* 020BA9F8 */ _t22 = cpu->r[31] + 0x00000444u;
         /* 020BA9F8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t22);
-        /* 020BA9FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 020BAA00 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA9FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 020BAA00 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAA00 */ _t24 = _t23 & 0x00000001u;
         /* 020BAA00 */ if (_t24) goto L_020BAA04; else goto L_020BAA68;
   L_020BAA04: ; // 0x20baa04
@@ -13823,7 +13823,7 @@ void Gambit_fn_0209D91C(CPUState* cpu) {
         /* 020BAA28 */ cpu->r[6] = cpu->r[30];
         /* 020BAA2C */ cpu->r[4] = cpu->r[31];
         /* 020BAA30 */ cpu->r[3] = cpu->r[29];
-        /* 020BAA34 */ _t26 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAA34 */ _t26 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAA34 */ _t27 = _t26 & 0x00000001u;
         /* 020BAA34 */ if (_t27) goto L_020BAA38; // else: addr-0 trap, fall-through
   L_020BAA38: ; // 0x20baa38
@@ -13845,8 +13845,8 @@ void Gambit_fn_0209D91C(CPUState* cpu) {
   L_020BAA68: ; // 0x20baa68
         /* 020BAA68 */ _t31 = cpu->r[31] + 0x00000444u;
         /* 020BAA68 */ cpu->r[12] = rbrew_read32(cpu->mem, _t31);
-        /* 020BAA6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000001u);
-        /* 020BAA70 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAA6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000001u));
+        /* 020BAA70 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAA70 */ _t33 = _t32 & 0x00000001u;
         /* 020BAA70 */ if (_t33) goto L_020BAA74; else goto L_020BAAC4;
   L_020BAA74: ; // 0x20baa74
@@ -13857,7 +13857,7 @@ void Gambit_fn_0209D91C(CPUState* cpu) {
         /* 020BAA84 */ cpu->r[5] = 0x00000001u;
         /* 020BAA88 */ cpu->r[4] = cpu->r[31];
         /* 020BAA8C */ cpu->r[3] = cpu->r[29];
-        /* 020BAA90 */ _t34 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAA90 */ _t34 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAA90 */ _t35 = _t34 & 0x00000001u;
         /* 020BAA90 */ if (_t35) goto L_020BAA94; // else: addr-0 trap, fall-through
   L_020BAA94: ; // 0x20baa94
@@ -13880,7 +13880,7 @@ void Gambit_fn_0209D91C(CPUState* cpu) {
         /* 020BAAC4 */ cpu->r[5] = 0x00000000u;
         /* 020BAAC8 */ cpu->r[4] = cpu->r[31];
         /* 020BAACC */ cpu->r[3] = cpu->r[29];
-        /* 020BAAD0 */ _t39 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAAD0 */ _t39 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAAD0 */ _t40 = _t39 & 0x00000001u;
         /* 020BAAD0 */ if (_t40) goto L_020BAAD4; // else: addr-0 trap, fall-through
   L_020BAAD4: ; // 0x20baad4
@@ -13903,7 +13903,7 @@ void Gambit_fn_0209D91C(CPUState* cpu) {
         /* 020BAB04 */ cpu->r[5] = 0x00000000u;
         /* 020BAB08 */ cpu->r[4] = cpu->r[31] + 0x00000488u;
         /* 020BAB0C */ cpu->r[3] = cpu->r[29];
-        /* 020BAB10 */ _t44 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAB10 */ _t44 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAB10 */ _t45 = _t44 & 0x00000001u;
         /* 020BAB10 */ if (_t45) goto L_020BAB14; // else: addr-0 trap, fall-through
   L_020BAB14: ; // 0x20bab14
@@ -13980,13 +13980,13 @@ void Gambit_fn_0209D924(CPUState* cpu) {
         /* 0209D988 */ Gambit_fn_027ED914(cpu);
         /* 0209D98C */ _t11 = cpu->r[31] + 0x00000000u;
         /* 0209D98C */ cpu->r[0] = rbrew_read32(cpu->mem, _t11);
-        /* 0209D990 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
-        /* 0209D994 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209D990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
+        /* 0209D994 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209D994 */ _t13 = _t12 & 0x00000001u;
         /* 0209D994 */ if (_t13) goto L_0209D9A0; else goto L_0209D998;
   L_0209D998: ; // 0x209d998
-        /* 0209D998 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
-        /* 0209D99C */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209D998 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
+        /* 0209D99C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209D99C */ _t15 = _t14 & 0x00000001u;
         /* 0209D99C */ if (_t15) goto L_0209D9A0; else goto L_0209D9C4;
   L_0209D9A0: ; // 0x209d9a0
@@ -14075,13 +14075,13 @@ void Gambit_fn_0209D928(CPUState* cpu) {
         /* 0209D988 */ Gambit_fn_027ED914(cpu);
         /* 0209D98C */ _t11 = cpu->r[31] + 0x00000000u;
         /* 0209D98C */ cpu->r[0] = rbrew_read32(cpu->mem, _t11);
-        /* 0209D990 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
-        /* 0209D994 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209D990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
+        /* 0209D994 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209D994 */ _t13 = _t12 & 0x00000001u;
         /* 0209D994 */ if (_t13) goto L_0209D9A0; else goto L_0209D998;
   L_0209D998: ; // 0x209d998
-        /* 0209D998 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
-        /* 0209D99C */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209D998 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
+        /* 0209D99C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209D99C */ _t15 = _t14 & 0x00000001u;
         /* 0209D99C */ if (_t15) goto L_0209D9A0; else goto L_0209D9C4;
   L_0209D9A0: ; // 0x209d9a0
@@ -14225,9 +14225,9 @@ void Gambit_fn_0209DACC(CPUState* cpu) {
         /* 0209DAE8 */ _t3 = cpu->r[1] + 0x00000008u;
         /* 0209DAE8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
         /* 0209DAEC */ cpu->r[10] = 0x10010000u;
-        /* 0209DAF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000007u);
+        /* 0209DAF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000007u));
         /* 0209DAF4 */ cpu->r[10] = cpu->r[10] + 0x00001828u;
-        /* 0209DAF8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209DAF8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209DAF8 */ _t5 = _t4 & 0x00000001u;
         /* 0209DAF8 */ if (_t5) goto L_0209DAFC; else goto L_0209DB28;
   L_0209DAFC: ; // 0x209dafc
@@ -14287,9 +14287,9 @@ void Gambit_fn_0209DAD0(CPUState* cpu) {
         /* 0209DAE8 */ _t3 = cpu->r[1] + 0x00000008u;
         /* 0209DAE8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
         /* 0209DAEC */ cpu->r[10] = 0x10010000u;
-        /* 0209DAF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000007u);
+        /* 0209DAF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000007u));
         /* 0209DAF4 */ cpu->r[10] = cpu->r[10] + 0x00001828u;
-        /* 0209DAF8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209DAF8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209DAF8 */ _t5 = _t4 & 0x00000001u;
         /* 0209DAF8 */ if (_t5) goto L_0209DAFC; else goto L_0209DB28;
   L_0209DAFC: ; // 0x209dafc
@@ -14338,18 +14338,18 @@ void Gambit_fn_0209DB64(CPUState* cpu) {
   L_0209DB64: ; // 0x209db64
         /* 0209DB64 */ _t0 = cpu->r[3] + 0x0000028Cu;
         /* 0209DB64 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 0209DB68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0209DB6C */ _t1 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209DB68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0209DB6C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209DB6C */ _t2 = _t1 & 0x00000001u;
         /* 0209DB6C */ _t3 = _t2 ^ 0x00000001u;
         /* 0209DB6C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209DB6C */ goto L_0209DB70;
   L_0209DB70: ; // 0x209db70
         /* 0209DB70 */ cpu->r[12] = cpu->r[12] + 0xFFFFFFFFu;
-        /* 0209DB70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0209DB70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0209DB74 */ _t4 = cpu->r[3] + 0x0000028Cu;
         /* 0209DB74 */ rbrew_write32(cpu->mem, _t4, cpu->r[12]);
-        /* 0209DB78 */ _t5 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209DB78 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209DB78 */ _t6 = _t5 & 0x00000001u;
         /* 0209DB78 */ if (_t6) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209DB78 */ goto L_0209DB7C;
@@ -14632,15 +14632,15 @@ void Gambit_fn_0209DCE4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209DCE4: ; // 0x209dce4
-        /* 0209DCE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209DCE8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209DCE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209DCE8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209DCE8 */ _t1 = _t0 & 0x00000001u;
         /* 0209DCE8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209DCE8 */ goto L_0209DCEC;
   L_0209DCEC: ; // 0x209dcec
         /* 0209DCEC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209DCEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209DCF0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209DCEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209DCF0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209DCF0 */ _t3 = _t2 & 0x00000001u;
         /* 0209DCF0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209DCF0 */ goto L_0209DCF4;
@@ -14659,8 +14659,8 @@ void Gambit_fn_0209DCE4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -14674,15 +14674,15 @@ void Gambit_fn_0209DCE4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -14719,11 +14719,11 @@ void Gambit_fn_0209DCF8(CPUState* cpu) {
         /* 0209DD04 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0209DD04 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0209DD08 */ cpu->r[30] = cpu->r[3];
-        /* 0209DD08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209DD08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209DD0C */ cpu->r[31] = cpu->r[4];
         /* 0209DD10 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209DD10 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209DD14 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209DD14 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209DD14 */ _t5 = _t4 & 0x00000001u;
         /* 0209DD14 */ if (_t5) goto L_0209DD84; else goto L_0209DD18;
   L_0209DD18: ; // 0x209dd18
@@ -14737,10 +14737,10 @@ void Gambit_fn_0209DCF8(CPUState* cpu) {
         /* 0209DD30 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0209DD30 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0209DD34 */ cpu->r[11] = cpu->r[11] + 0x00001B4Cu;
-        /* 0209DD38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209DD38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209DD3C */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0209DD3C */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0209DD40 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209DD40 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209DD40 */ _t10 = _t9 & 0x00000001u;
         /* 0209DD40 */ if (_t10) goto L_0209DD74; else goto L_0209DD44;
   L_0209DD44: ; // 0x209dd44
@@ -14761,8 +14761,8 @@ void Gambit_fn_0209DCF8(CPUState* cpu) {
         /* 0209DD70 */ Gambit_fn_02068798(cpu);
   L_0209DD74: ; // 0x209dd74
         /* 0209DD74 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209DD74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209DD78 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209DD74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209DD78 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209DD78 */ _t15 = _t14 & 0x00000001u;
         /* 0209DD78 */ if (_t15) goto L_0209DD84; else goto L_0209DD7C;
   L_0209DD7C: ; // 0x209dd7c
@@ -14793,11 +14793,11 @@ void Gambit_fn_0209DCFC(CPUState* cpu) {
         /* 0209DD04 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0209DD04 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0209DD08 */ cpu->r[30] = cpu->r[3];
-        /* 0209DD08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209DD08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209DD0C */ cpu->r[31] = cpu->r[4];
         /* 0209DD10 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209DD10 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209DD14 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209DD14 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209DD14 */ _t5 = _t4 & 0x00000001u;
         /* 0209DD14 */ if (_t5) goto L_0209DD84; else goto L_0209DD18;
   L_0209DD18: ; // 0x209dd18
@@ -14811,10 +14811,10 @@ void Gambit_fn_0209DCFC(CPUState* cpu) {
         /* 0209DD30 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0209DD30 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0209DD34 */ cpu->r[11] = cpu->r[11] + 0x00001B4Cu;
-        /* 0209DD38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209DD38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209DD3C */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0209DD3C */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0209DD40 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209DD40 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209DD40 */ _t10 = _t9 & 0x00000001u;
         /* 0209DD40 */ if (_t10) goto L_0209DD74; else goto L_0209DD44;
   L_0209DD44: ; // 0x209dd44
@@ -14835,8 +14835,8 @@ void Gambit_fn_0209DCFC(CPUState* cpu) {
         /* 0209DD70 */ Gambit_fn_02068798(cpu);
   L_0209DD74: ; // 0x209dd74
         /* 0209DD74 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209DD74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209DD78 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209DD74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209DD78 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209DD78 */ _t15 = _t14 & 0x00000001u;
         /* 0209DD78 */ if (_t15) goto L_0209DD84; else goto L_0209DD7C;
   L_0209DD7C: ; // 0x209dd7c
@@ -15011,10 +15011,10 @@ void Gambit_fn_0209DE18(CPUState* cpu) {
         /* 0209DE18 */ cpu->r[12] = 0x101D0000u;
         /* 0209DE1C */ _t0 = cpu->r[12] + 0xFFFFE370u;
         /* 0209DE1C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 0209DE20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0209DE20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0209DE24 */ cpu->r[12] = 0x101D0000u;
         /* 0209DE28 */ cpu->r[12] = cpu->r[12] + 0xFFFFEE18u;
-        /* 0209DE2C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209DE2C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209DE2C */ _t2 = _t1 & 0x00000001u;
         /* 0209DE2C */ if (_t2) goto L_0209DE30; else goto L_0209DE48;
   L_0209DE30: ; // 0x209de30
@@ -15027,8 +15027,8 @@ void Gambit_fn_0209DE18(CPUState* cpu) {
         /* 0209DE44 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 0209DE44 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_0209DE48: ; // 0x209de48
-        /* 0209DE48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0209DE4C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209DE48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0209DE4C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209DE4C */ _t6 = _t5 & 0x00000001u;
         /* 0209DE4C */ if (_t6) goto L_0209DE50; else goto L_0209DE58;
   L_0209DE50: ; // 0x209de50
@@ -15040,9 +15040,9 @@ void Gambit_fn_0209DE18(CPUState* cpu) {
         /* 0209DE5C */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 0209DE5C */ cpu->r[11] = _t7;
         /* 0209DE60 */ cpu->r[10] = 0x101D0000u;
-        /* 0209DE64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0209DE64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0209DE68 */ cpu->r[10] = cpu->r[10] + 0xFFFFED90u;
-        /* 0209DE6C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209DE6C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209DE6C */ _t9 = _t8 & 0x00000001u;
         /* 0209DE6C */ if (_t9) goto L_0209DE70; else goto L_0209DE84;
   L_0209DE70: ; // 0x209de70
@@ -15054,8 +15054,8 @@ void Gambit_fn_0209DE18(CPUState* cpu) {
         /* 0209DE80 */ _t11 = cpu->r[10] + 0x00000000u;
         /* 0209DE80 */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
   L_0209DE84: ; // 0x209de84
-        /* 0209DE84 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0209DE88 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209DE84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0209DE88 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209DE88 */ _t13 = _t12 & 0x00000001u;
         /* 0209DE88 */ if (_t13) goto L_0209DE8C; else goto L_0209DE94;
   L_0209DE8C: ; // 0x209de8c
@@ -15067,9 +15067,9 @@ void Gambit_fn_0209DE18(CPUState* cpu) {
         /* 0209DE98 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 0209DE98 */ cpu->r[8] = _t14;
         /* 0209DE9C */ cpu->r[11] = 0x101D0000u;
-        /* 0209DEA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0209DEA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0209DEA4 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 0209DEA8 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209DEA8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209DEA8 */ _t16 = _t15 & 0x00000001u;
         /* 0209DEA8 */ if (_t16) goto L_0209DEAC; else goto L_0209DEC0;
   L_0209DEAC: ; // 0x209deac
@@ -15130,18 +15130,18 @@ void Gambit_fn_0209DEE4(CPUState* cpu) {
         /* 02053FC4 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02053FC4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02053FC8 */ cpu->r[12] = 0x00000000u;
-        /* 02053FCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02053FCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02053FD0 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 02053FD0 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02053FD4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02053FD4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02053FD4 */ _t6 = _t5 & 0x00000001u;
         /* 02053FD4 */ if (_t6) goto L_02053FFC; else goto L_02053FD8;
   L_02053FD8: ; // 0x2053fd8
         /* 02053FD8 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02053FD8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02053FDC */ /* nop */
-        /* 02053FE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 02053FE4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02053FE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 02053FE4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02053FE4 */ _t9 = _t8 & 0x00000001u;
         /* 02053FE4 */ if (_t9) goto L_02053FE8; else goto L_02053FFC;
   L_02053FE8: ; // 0x2053fe8
@@ -15186,11 +15186,11 @@ void Gambit_fn_0209DEEC(CPUState* cpu) {
         /* 0209E148 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0209E148 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0209E14C */ cpu->r[30] = cpu->r[3];
-        /* 0209E14C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209E14C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209E150 */ cpu->r[31] = cpu->r[4];
         /* 0209E154 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209E154 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209E158 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E158 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E158 */ _t5 = _t4 & 0x00000001u;
         /* 0209E158 */ if (_t5) goto L_0209E1C8; else goto L_0209E15C;
   L_0209E15C: ; // 0x209e15c
@@ -15204,10 +15204,10 @@ void Gambit_fn_0209DEEC(CPUState* cpu) {
         /* 0209E174 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0209E174 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0209E178 */ cpu->r[11] = cpu->r[11] + 0x00001E78u;
-        /* 0209E17C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209E17C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209E180 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0209E180 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0209E184 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E184 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E184 */ _t10 = _t9 & 0x00000001u;
         /* 0209E184 */ if (_t10) goto L_0209E1B8; else goto L_0209E188;
   L_0209E188: ; // 0x209e188
@@ -15228,8 +15228,8 @@ void Gambit_fn_0209DEEC(CPUState* cpu) {
         /* 0209E1B4 */ Gambit_fn_02068798(cpu);
   L_0209E1B8: ; // 0x209e1b8
         /* 0209E1B8 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209E1B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209E1BC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E1B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209E1BC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E1BC */ _t15 = _t14 & 0x00000001u;
         /* 0209E1BC */ if (_t15) goto L_0209E1C8; else goto L_0209E1C0;
   L_0209E1C0: ; // 0x209e1c0
@@ -15257,8 +15257,8 @@ void Gambit_fn_0209DEF4(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -15309,18 +15309,18 @@ void Gambit_fn_0209DF0C(CPUState* cpu) {
         /* 0209DF14 */ _t1 = cpu->r[1] + 0x0000001Cu;
         /* 0209DF14 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0209DF18 */ cpu->r[31] = cpu->r[3];
-        /* 0209DF18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209DF18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209DF1C */ _t2 = cpu->r[1] + 0x00000024u;
         /* 0209DF1C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0209DF20 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209DF20 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209DF20 */ _t4 = _t3 & 0x00000001u;
         /* 0209DF20 */ if (_t4) goto L_0209DF24; else goto L_0209DF34;
   L_0209DF24: ; // 0x209df24
         /* 0209DF24 */ cpu->r[3] = 0x0000028Cu;
         /* 0209DF28 */ Gambit_fn_02801A78(cpu);
         /* 0209DF2C */ cpu->r[31] = cpu->r[3];
-        /* 0209DF2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209DF30 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209DF2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209DF30 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209DF30 */ _t6 = _t5 & 0x00000001u;
         /* 0209DF30 */ if (_t6) goto L_0209DFA8; else goto L_0209DF34;
   L_0209DF34: ; // 0x209df34
@@ -15383,18 +15383,18 @@ void Gambit_fn_0209DF10(CPUState* cpu) {
         /* 0209DF14 */ _t1 = cpu->r[1] + 0x0000001Cu;
         /* 0209DF14 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0209DF18 */ cpu->r[31] = cpu->r[3];
-        /* 0209DF18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209DF18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209DF1C */ _t2 = cpu->r[1] + 0x00000024u;
         /* 0209DF1C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0209DF20 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209DF20 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209DF20 */ _t4 = _t3 & 0x00000001u;
         /* 0209DF20 */ if (_t4) goto L_0209DF24; else goto L_0209DF34;
   L_0209DF24: ; // 0x209df24
         /* 0209DF24 */ cpu->r[3] = 0x0000028Cu;
         /* 0209DF28 */ Gambit_fn_02801A78(cpu);
         /* 0209DF2C */ cpu->r[31] = cpu->r[3];
-        /* 0209DF2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209DF30 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209DF2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209DF30 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209DF30 */ _t6 = _t5 & 0x00000001u;
         /* 0209DF30 */ if (_t6) goto L_0209DFA8; else goto L_0209DF34;
   L_0209DF34: ; // 0x209df34
@@ -15460,10 +15460,10 @@ void Gambit_fn_0209DFC0(CPUState* cpu) {
         /* 0209DFCC */ _t2 = cpu->r[4] + 0x00000000u;
         /* 0209DFCC */ cpu->r[0] = rbrew_read32(cpu->mem, _t2);
         /* 0209DFD0 */ cpu->r[12] = 0x10010000u;
-        /* 0209DFD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
+        /* 0209DFD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
         /* 0209DFD8 */ _t3 = cpu->r[12] + 0x00001C4Cu;
         /* 0209DFD8 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t3);
-        /* 0209DFDC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209DFDC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209DFDC */ _t5 = _t4 & 0x00000001u;
         /* 0209DFDC */ if (_t5) goto L_0209DFE0; else goto L_0209E010;
   L_0209DFE0: ; // 0x209dfe0
@@ -15483,8 +15483,8 @@ void Gambit_fn_0209DFC0(CPUState* cpu) {
         /* 0209E008 */ Gambit_fn_027ED914(cpu);
         /* 0209E00C */ goto L_0209E07C;
   L_0209E010: ; // 0x209e010
-        /* 0209E010 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 0209E014 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E010 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 0209E014 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E014 */ _t10 = _t9 & 0x00000001u;
         /* 0209E014 */ if (_t10) goto L_0209E018; else goto L_0209E048;
   L_0209E018: ; // 0x209e018
@@ -15504,8 +15504,8 @@ void Gambit_fn_0209DFC0(CPUState* cpu) {
         /* 0209E040 */ Gambit_fn_027ED914(cpu);
         /* 0209E044 */ goto L_0209E07C;
   L_0209E048: ; // 0x209e048
-        /* 0209E048 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 0209E04C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E048 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 0209E04C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E04C */ _t15 = _t14 & 0x00000001u;
         /* 0209E04C */ if (_t15) goto L_0209E050; else goto L_0209E058;
   L_0209E050: ; // 0x209e050
@@ -15543,10 +15543,10 @@ void Gambit_fn_0209DFC8(CPUState* cpu) {
         /* 0209DFCC */ _t1 = cpu->r[4] + 0x00000000u;
         /* 0209DFCC */ cpu->r[0] = rbrew_read32(cpu->mem, _t1);
         /* 0209DFD0 */ cpu->r[12] = 0x10010000u;
-        /* 0209DFD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
+        /* 0209DFD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
         /* 0209DFD8 */ _t2 = cpu->r[12] + 0x00001C4Cu;
         /* 0209DFD8 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t2);
-        /* 0209DFDC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209DFDC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209DFDC */ _t4 = _t3 & 0x00000001u;
         /* 0209DFDC */ if (_t4) goto L_0209DFE0; else goto L_0209E010;
   L_0209DFE0: ; // 0x209dfe0
@@ -15566,8 +15566,8 @@ void Gambit_fn_0209DFC8(CPUState* cpu) {
         /* 0209E008 */ Gambit_fn_027ED914(cpu);
         /* 0209E00C */ goto L_0209E07C;
   L_0209E010: ; // 0x209e010
-        /* 0209E010 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 0209E014 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E010 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 0209E014 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E014 */ _t9 = _t8 & 0x00000001u;
         /* 0209E014 */ if (_t9) goto L_0209E018; else goto L_0209E048;
   L_0209E018: ; // 0x209e018
@@ -15587,8 +15587,8 @@ void Gambit_fn_0209DFC8(CPUState* cpu) {
         /* 0209E040 */ Gambit_fn_027ED914(cpu);
         /* 0209E044 */ goto L_0209E07C;
   L_0209E048: ; // 0x209e048
-        /* 0209E048 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 0209E04C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E048 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 0209E04C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E04C */ _t14 = _t13 & 0x00000001u;
         /* 0209E04C */ if (_t14) goto L_0209E050; else goto L_0209E058;
   L_0209E050: ; // 0x209e050
@@ -15751,15 +15751,15 @@ void Gambit_fn_0209E128(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209E128: ; // 0x209e128
-        /* 0209E128 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209E12C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E128 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209E12C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E12C */ _t1 = _t0 & 0x00000001u;
         /* 0209E12C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209E12C */ goto L_0209E130;
   L_0209E130: ; // 0x209e130
         /* 0209E130 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209E130 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209E134 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E130 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209E134 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E134 */ _t3 = _t2 & 0x00000001u;
         /* 0209E134 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209E134 */ goto L_0209E138;
@@ -15778,8 +15778,8 @@ void Gambit_fn_0209E128(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -15793,15 +15793,15 @@ void Gambit_fn_0209E128(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -15838,11 +15838,11 @@ void Gambit_fn_0209E13C(CPUState* cpu) {
         /* 0209E148 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0209E148 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0209E14C */ cpu->r[30] = cpu->r[3];
-        /* 0209E14C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209E14C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209E150 */ cpu->r[31] = cpu->r[4];
         /* 0209E154 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209E154 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209E158 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E158 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E158 */ _t5 = _t4 & 0x00000001u;
         /* 0209E158 */ if (_t5) goto L_0209E1C8; else goto L_0209E15C;
   L_0209E15C: ; // 0x209e15c
@@ -15856,10 +15856,10 @@ void Gambit_fn_0209E13C(CPUState* cpu) {
         /* 0209E174 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0209E174 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0209E178 */ cpu->r[11] = cpu->r[11] + 0x00001E78u;
-        /* 0209E17C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209E17C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209E180 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0209E180 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0209E184 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E184 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E184 */ _t10 = _t9 & 0x00000001u;
         /* 0209E184 */ if (_t10) goto L_0209E1B8; else goto L_0209E188;
   L_0209E188: ; // 0x209e188
@@ -15880,8 +15880,8 @@ void Gambit_fn_0209E13C(CPUState* cpu) {
         /* 0209E1B4 */ Gambit_fn_02068798(cpu);
   L_0209E1B8: ; // 0x209e1b8
         /* 0209E1B8 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209E1B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209E1BC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E1B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209E1BC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E1BC */ _t15 = _t14 & 0x00000001u;
         /* 0209E1BC */ if (_t15) goto L_0209E1C8; else goto L_0209E1C0;
   L_0209E1C0: ; // 0x209e1c0
@@ -15912,11 +15912,11 @@ void Gambit_fn_0209E140(CPUState* cpu) {
         /* 0209E148 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 0209E148 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 0209E14C */ cpu->r[30] = cpu->r[3];
-        /* 0209E14C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209E14C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209E150 */ cpu->r[31] = cpu->r[4];
         /* 0209E154 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0209E154 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0209E158 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E158 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E158 */ _t5 = _t4 & 0x00000001u;
         /* 0209E158 */ if (_t5) goto L_0209E1C8; else goto L_0209E15C;
   L_0209E15C: ; // 0x209e15c
@@ -15930,10 +15930,10 @@ void Gambit_fn_0209E140(CPUState* cpu) {
         /* 0209E174 */ _t7 = cpu->r[30] + 0x000001C8u;
         /* 0209E174 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
         /* 0209E178 */ cpu->r[11] = cpu->r[11] + 0x00001E78u;
-        /* 0209E17C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0209E17C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0209E180 */ _t8 = cpu->r[30] + 0x0000001Cu;
         /* 0209E180 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 0209E184 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E184 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E184 */ _t10 = _t9 & 0x00000001u;
         /* 0209E184 */ if (_t10) goto L_0209E1B8; else goto L_0209E188;
   L_0209E188: ; // 0x209e188
@@ -15954,8 +15954,8 @@ void Gambit_fn_0209E140(CPUState* cpu) {
         /* 0209E1B4 */ Gambit_fn_02068798(cpu);
   L_0209E1B8: ; // 0x209e1b8
         /* 0209E1B8 */ cpu->r[11] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209E1B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209E1BC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E1B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209E1BC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E1BC */ _t15 = _t14 & 0x00000001u;
         /* 0209E1BC */ if (_t15) goto L_0209E1C8; else goto L_0209E1C0;
   L_0209E1C0: ; // 0x209e1c0
@@ -16130,10 +16130,10 @@ void Gambit_fn_0209E25C(CPUState* cpu) {
         /* 0209E25C */ cpu->r[12] = 0x101D0000u;
         /* 0209E260 */ _t0 = cpu->r[12] + 0xFFFFE370u;
         /* 0209E260 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 0209E264 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0209E264 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0209E268 */ cpu->r[12] = 0x101D0000u;
         /* 0209E26C */ cpu->r[12] = cpu->r[12] + 0xFFFFEE18u;
-        /* 0209E270 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E270 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E270 */ _t2 = _t1 & 0x00000001u;
         /* 0209E270 */ if (_t2) goto L_0209E274; else goto L_0209E28C;
   L_0209E274: ; // 0x209e274
@@ -16146,8 +16146,8 @@ void Gambit_fn_0209E25C(CPUState* cpu) {
         /* 0209E288 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 0209E288 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_0209E28C: ; // 0x209e28c
-        /* 0209E28C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0209E290 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E28C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0209E290 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E290 */ _t6 = _t5 & 0x00000001u;
         /* 0209E290 */ if (_t6) goto L_0209E294; else goto L_0209E29C;
   L_0209E294: ; // 0x209e294
@@ -16159,9 +16159,9 @@ void Gambit_fn_0209E25C(CPUState* cpu) {
         /* 0209E2A0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 0209E2A0 */ cpu->r[11] = _t7;
         /* 0209E2A4 */ cpu->r[10] = 0x101D0000u;
-        /* 0209E2A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0209E2A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0209E2AC */ cpu->r[10] = cpu->r[10] + 0xFFFFED90u;
-        /* 0209E2B0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E2B0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E2B0 */ _t9 = _t8 & 0x00000001u;
         /* 0209E2B0 */ if (_t9) goto L_0209E2B4; else goto L_0209E2C8;
   L_0209E2B4: ; // 0x209e2b4
@@ -16173,8 +16173,8 @@ void Gambit_fn_0209E25C(CPUState* cpu) {
         /* 0209E2C4 */ _t11 = cpu->r[10] + 0x00000000u;
         /* 0209E2C4 */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
   L_0209E2C8: ; // 0x209e2c8
-        /* 0209E2C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0209E2CC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E2C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0209E2CC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E2CC */ _t13 = _t12 & 0x00000001u;
         /* 0209E2CC */ if (_t13) goto L_0209E2D0; else goto L_0209E2D8;
   L_0209E2D0: ; // 0x209e2d0
@@ -16186,9 +16186,9 @@ void Gambit_fn_0209E25C(CPUState* cpu) {
         /* 0209E2DC */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 0209E2DC */ cpu->r[8] = _t14;
         /* 0209E2E0 */ cpu->r[11] = 0x101D0000u;
-        /* 0209E2E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0209E2E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0209E2E8 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 0209E2EC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E2EC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E2EC */ _t16 = _t15 & 0x00000001u;
         /* 0209E2EC */ if (_t16) goto L_0209E2F0; else goto L_0209E304;
   L_0209E2F0: ; // 0x209e2f0
@@ -16261,18 +16261,18 @@ void Gambit_fn_0209E330(CPUState* cpu) {
         /* 02053FC4 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02053FC4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02053FC8 */ cpu->r[12] = 0x00000000u;
-        /* 02053FCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02053FCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02053FD0 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 02053FD0 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02053FD4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02053FD4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02053FD4 */ _t6 = _t5 & 0x00000001u;
         /* 02053FD4 */ if (_t6) goto L_02053FFC; else goto L_02053FD8;
   L_02053FD8: ; // 0x2053fd8
         /* 02053FD8 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02053FD8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02053FDC */ /* nop */
-        /* 02053FE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 02053FE4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02053FE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 02053FE4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02053FE4 */ _t9 = _t8 & 0x00000001u;
         /* 02053FE4 */ if (_t9) goto L_02053FE8; else goto L_02053FFC;
   L_02053FE8: ; // 0x2053fe8
@@ -16312,18 +16312,18 @@ void Gambit_fn_0209E338(CPUState* cpu) {
         /* 0209E340 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0209E340 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0209E344 */ cpu->r[31] = cpu->r[3];
-        /* 0209E344 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209E344 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209E348 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0209E348 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0209E34C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E34C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E34C */ _t4 = _t3 & 0x00000001u;
         /* 0209E34C */ if (_t4) goto L_0209E350; else goto L_0209E360;
   L_0209E350: ; // 0x209e350
         /* 0209E350 */ cpu->r[3] = 0x00000004u;
         /* 0209E354 */ Gambit_fn_02801A78(cpu);
         /* 0209E358 */ cpu->r[31] = cpu->r[3];
-        /* 0209E358 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209E35C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E358 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209E35C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E35C */ _t6 = _t5 & 0x00000001u;
         /* 0209E35C */ if (_t6) goto L_0209E374; else goto L_0209E360;
   L_0209E360: ; // 0x209e360
@@ -16355,18 +16355,18 @@ void Gambit_fn_0209E33C(CPUState* cpu) {
         /* 0209E340 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0209E340 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0209E344 */ cpu->r[31] = cpu->r[3];
-        /* 0209E344 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209E344 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209E348 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0209E348 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0209E34C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E34C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E34C */ _t4 = _t3 & 0x00000001u;
         /* 0209E34C */ if (_t4) goto L_0209E350; else goto L_0209E360;
   L_0209E350: ; // 0x209e350
         /* 0209E350 */ cpu->r[3] = 0x00000004u;
         /* 0209E354 */ Gambit_fn_02801A78(cpu);
         /* 0209E358 */ cpu->r[31] = cpu->r[3];
-        /* 0209E358 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209E35C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E358 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209E35C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E35C */ _t6 = _t5 & 0x00000001u;
         /* 0209E35C */ if (_t6) goto L_0209E374; else goto L_0209E360;
   L_0209E360: ; // 0x209e360
@@ -16508,32 +16508,32 @@ void Gambit_fn_0209E408(CPUState* cpu) {
         /* 0209E410 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 0209E414 */ /* nop */
         /* 0209E418 */ cpu->r[31] = cpu->r[3];
-        /* 0209E418 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209E418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209E41C */ cpu->r[30] = cpu->r[4];
-        /* 0209E420 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E420 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E420 */ _t3 = _t2 & 0x00000001u;
         /* 0209E420 */ if (_t3) goto L_0209E424; else goto L_0209E434;
   L_0209E424: ; // 0x209e424
         /* 0209E424 */ cpu->r[3] = 0x00000148u;
         /* 0209E428 */ Gambit_fn_02801A78(cpu);
         /* 0209E42C */ cpu->r[31] = cpu->r[3];
-        /* 0209E42C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209E430 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E42C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209E430 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E430 */ _t5 = _t4 & 0x00000001u;
         /* 0209E430 */ if (_t5) goto L_0209E6C4; else goto L_0209E434;
   L_0209E434: ; // 0x209e434
         /* 0209E434 */ cpu->r[29] = cpu->r[31];
-        /* 0209E434 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0209E434 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0209E438 */ cpu->r[28] = 0x10110000u;
-        /* 0209E43C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E43C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E43C */ _t7 = _t6 & 0x00000001u;
         /* 0209E43C */ if (_t7) goto L_0209E440; else goto L_0209E46C;
   L_0209E440: ; // 0x209e440
         /* 0209E440 */ cpu->r[3] = 0x00000148u;
         /* 0209E444 */ Gambit_fn_02801A78(cpu);
         /* 0209E448 */ cpu->r[29] = cpu->r[3];
-        /* 0209E448 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0209E44C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E448 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0209E44C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E44C */ _t9 = _t8 & 0x00000001u;
         /* 0209E44C */ if (_t9) goto L_0209E450; else goto L_0209E46C;
   L_0209E450: ; // 0x209e450
@@ -16550,44 +16550,44 @@ void Gambit_fn_0209E408(CPUState* cpu) {
         /* 0209E468 */ goto L_0209E6C4;
   L_0209E46C: ; // 0x209e46c
         /* 0209E46C */ cpu->r[27] = cpu->r[29];
-        /* 0209E46C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0209E470 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E46C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0209E470 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E470 */ _t15 = _t14 & 0x00000001u;
         /* 0209E470 */ if (_t15) goto L_0209E474; else goto L_0209E4A4;
   L_0209E474: ; // 0x209e474
         /* 0209E474 */ cpu->r[3] = 0x0000008Cu;
         /* 0209E478 */ Gambit_fn_02801A78(cpu);
         /* 0209E47C */ cpu->r[27] = cpu->r[3];
-        /* 0209E47C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0209E480 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E47C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0209E480 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E480 */ _t17 = _t16 & 0x00000001u;
         /* 0209E480 */ if (_t17) goto L_0209E484; else goto L_0209E4A4;
   L_0209E484: ; // 0x209e484
         /* 0209E484 */ cpu->r[0] = 0x10010000u;
         /* 0209E488 */ cpu->r[26] = cpu->r[29] + 0x0000008Cu;
-        /* 0209E488 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 0209E488 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 0209E48C */ _t18 = cpu->r[28] + 0x0000739Au;
         /* 0209E48C */ cpu->r[28] = rbrew_read16(cpu->mem, _t18);
         /* 0209E490 */ cpu->r[0] = cpu->r[0] + 0x00002008u;
         /* 0209E494 */ cpu->r[27] = 0x00000000u;
         /* 0209E498 */ _t19 = cpu->r[29] + 0x00000004u;
         /* 0209E498 */ rbrew_write32(cpu->mem, _t19, cpu->r[0]);
-        /* 0209E49C */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E49C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E49C */ _t21 = _t20 & 0x00000001u;
         /* 0209E49C */ if (_t21) goto L_0209E528; else goto L_0209E4A0;
   L_0209E4A0: ; // 0x209e4a0
         /* 0209E4A0 */ goto L_0209E538;
   L_0209E4A4: ; // 0x209e4a4
         /* 0209E4A4 */ cpu->r[3] = cpu->r[27];
-        /* 0209E4A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209E4A8 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E4A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209E4A8 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E4A8 */ _t23 = _t22 & 0x00000001u;
         /* 0209E4A8 */ if (_t23) goto L_0209E4AC; else goto L_0209E4D8;
   L_0209E4AC: ; // 0x209e4ac
         /* 0209E4AC */ cpu->r[3] = 0x0000000Cu;
         /* 0209E4B0 */ Gambit_fn_02801A78(cpu);
-        /* 0209E4B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209E4B8 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E4B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209E4B8 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E4B8 */ _t25 = _t24 & 0x00000001u;
         /* 0209E4B8 */ if (_t25) goto L_0209E4BC; else goto L_0209E4D8;
   L_0209E4BC: ; // 0x209e4bc
@@ -16628,27 +16628,27 @@ void Gambit_fn_0209E408(CPUState* cpu) {
   L_0209E510: ; // 0x209e510
         /* 0209E510 */ cpu->r[0] = 0x10010000u;
         /* 0209E514 */ cpu->r[26] = cpu->r[29] + 0x0000008Cu;
-        /* 0209E514 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 0209E514 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 0209E518 */ cpu->r[0] = cpu->r[0] + 0x00002008u;
         /* 0209E51C */ cpu->r[27] = 0x00000000u;
         /* 0209E520 */ _t38 = cpu->r[29] + 0x00000004u;
         /* 0209E520 */ rbrew_write32(cpu->mem, _t38, cpu->r[0]);
-        /* 0209E524 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E524 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E524 */ _t40 = _t39 & 0x00000001u;
         /* 0209E524 */ if (_t40) goto L_0209E528; else goto L_0209E538;
   L_0209E528: ; // 0x209e528
         /* 0209E528 */ cpu->r[3] = 0x000000B4u;
         /* 0209E52C */ Gambit_fn_02801A78(cpu);
         /* 0209E530 */ cpu->r[26] = cpu->r[3];
-        /* 0209E530 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0209E534 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E530 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0209E534 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E534 */ _t42 = _t41 & 0x00000001u;
         /* 0209E534 */ if (_t42) goto L_0209E6A0; else goto L_0209E538;
   L_0209E538: ; // 0x209e538
         /* 0209E538 */ _t43 = cpu->r[26] + 0x00000000u;
         /* 0209E538 */ rbrew_write8(cpu->mem, _t43, (uint8_t)cpu->r[27]);
         /* 0209E53C */ cpu->r[21] = cpu->r[26] + 0x00000010u;
-        /* 0209E53C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
+        /* 0209E53C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
         /* 0209E540 */ cpu->r[23] = 0x10110000u;
         /* 0209E544 */ _t44 = cpu->r[26] + 0x00000004u;
         /* 0209E544 */ rbrew_write32(cpu->mem, _t44, cpu->r[27]);
@@ -16660,39 +16660,39 @@ void Gambit_fn_0209E408(CPUState* cpu) {
         /* 0209E558 */ cpu->r[25] = cpu->r[25] + 0x00001F90u;
         /* 0209E55C */ _t46 = cpu->r[26] + 0x0000000Cu;
         /* 0209E55C */ rbrew_write32(cpu->mem, _t46, cpu->r[27]);
-        /* 0209E560 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E560 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E560 */ _t48 = _t47 & 0x00000001u;
         /* 0209E560 */ if (_t48) goto L_0209E564; else goto L_0209E584;
   L_0209E564: ; // 0x209e564
         /* 0209E564 */ cpu->r[3] = 0x0000004Cu;
         /* 0209E568 */ Gambit_fn_02801A78(cpu);
         /* 0209E56C */ cpu->r[21] = cpu->r[3];
-        /* 0209E56C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 0209E570 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E56C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 0209E570 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E570 */ _t50 = _t49 & 0x00000001u;
         /* 0209E570 */ if (_t50) goto L_0209E574; else goto L_0209E584;
   L_0209E574: ; // 0x209e574
         /* 0209E574 */ cpu->r[21] = cpu->r[26] + 0x0000005Cu;
-        /* 0209E574 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
+        /* 0209E574 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
         /* 0209E578 */ _t51 = cpu->r[23] + 0x00007399u;
         /* 0209E578 */ cpu->r[23] = rbrew_read8(cpu->mem, _t51);
-        /* 0209E57C */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E57C */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E57C */ _t53 = _t52 & 0x00000001u;
         /* 0209E57C */ if (_t53) goto L_0209E580; else goto L_0209E620;
   L_0209E580: ; // 0x209e580
         /* 0209E580 */ goto L_0209E610;
   L_0209E584: ; // 0x209e584
         /* 0209E584 */ cpu->r[22] = cpu->r[21];
-        /* 0209E584 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 0209E588 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 0209E588 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E588 */ _t55 = _t54 & 0x00000001u;
         /* 0209E588 */ if (_t55) goto L_0209E58C; else goto L_0209E5A8;
   L_0209E58C: ; // 0x209e58c
         /* 0209E58C */ cpu->r[3] = 0x0000004Cu;
         /* 0209E590 */ Gambit_fn_02801A78(cpu);
         /* 0209E594 */ cpu->r[22] = cpu->r[3];
-        /* 0209E594 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 0209E598 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E594 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 0209E598 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E598 */ _t57 = _t56 & 0x00000001u;
         /* 0209E598 */ if (_t57) goto L_0209E59C; else goto L_0209E5A8;
   L_0209E59C: ; // 0x209e59c
@@ -16703,15 +16703,15 @@ void Gambit_fn_0209E408(CPUState* cpu) {
         /* 0209E5A4 */ goto L_0209E608;
   L_0209E5A8: ; // 0x209e5a8
         /* 0209E5A8 */ cpu->r[3] = cpu->r[22];
-        /* 0209E5A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209E5AC */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E5A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209E5AC */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E5AC */ _t61 = _t60 & 0x00000001u;
         /* 0209E5AC */ if (_t61) goto L_0209E5B0; else goto L_0209E5D4;
   L_0209E5B0: ; // 0x209e5b0
         /* 0209E5B0 */ cpu->r[3] = 0x0000000Cu;
         /* 0209E5B4 */ Gambit_fn_02801A78(cpu);
-        /* 0209E5B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209E5BC */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E5B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209E5BC */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E5BC */ _t63 = _t62 & 0x00000001u;
         /* 0209E5BC */ if (_t63) goto L_0209E5C0; else goto L_0209E5D4;
   L_0209E5C0: ; // 0x209e5c0
@@ -16750,43 +16750,43 @@ void Gambit_fn_0209E408(CPUState* cpu) {
         /* 0209E604 */ rbrew_write32(cpu->mem, _t76, cpu->r[24]);
   L_0209E608: ; // 0x209e608
         /* 0209E608 */ cpu->r[21] = cpu->r[26] + 0x0000005Cu;
-        /* 0209E608 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 0209E60C */ _t77 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E608 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 0209E60C */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E60C */ _t78 = _t77 & 0x00000001u;
         /* 0209E60C */ if (_t78) goto L_0209E610; else goto L_0209E620;
   L_0209E610: ; // 0x209e610
         /* 0209E610 */ cpu->r[3] = 0x0000004Cu;
         /* 0209E614 */ Gambit_fn_02801A78(cpu);
         /* 0209E618 */ cpu->r[21] = cpu->r[3];
-        /* 0209E618 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 0209E61C */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E618 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 0209E61C */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E61C */ _t80 = _t79 & 0x00000001u;
         /* 0209E61C */ if (_t80) goto L_0209E680; else goto L_0209E620;
   L_0209E620: ; // 0x209e620
         /* 0209E620 */ cpu->r[22] = cpu->r[21];
-        /* 0209E620 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 0209E624 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E620 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 0209E624 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E624 */ _t82 = _t81 & 0x00000001u;
         /* 0209E624 */ if (_t82) goto L_0209E628; else goto L_0209E638;
   L_0209E628: ; // 0x209e628
         /* 0209E628 */ cpu->r[3] = 0x0000004Cu;
         /* 0209E62C */ Gambit_fn_02801A78(cpu);
         /* 0209E630 */ cpu->r[22] = cpu->r[3];
-        /* 0209E630 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 0209E634 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E630 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 0209E634 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E634 */ _t84 = _t83 & 0x00000001u;
         /* 0209E634 */ if (_t84) goto L_0209E67C; else goto L_0209E638;
   L_0209E638: ; // 0x209e638
         /* 0209E638 */ cpu->r[3] = cpu->r[22];
-        /* 0209E638 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209E63C */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E638 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209E63C */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E63C */ _t86 = _t85 & 0x00000001u;
         /* 0209E63C */ if (_t86) goto L_0209E640; else goto L_0209E650;
   L_0209E640: ; // 0x209e640
         /* 0209E640 */ cpu->r[3] = 0x0000000Cu;
         /* 0209E644 */ Gambit_fn_02801A78(cpu);
-        /* 0209E648 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209E64C */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E648 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209E64C */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E64C */ _t88 = _t87 & 0x00000001u;
         /* 0209E64C */ if (_t88) goto L_0209E670; else goto L_0209E650;
   L_0209E650: ; // 0x209e650
@@ -16867,32 +16867,32 @@ void Gambit_fn_0209E40C(CPUState* cpu) {
         /* 0209E410 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 0209E414 */ /* nop */
         /* 0209E418 */ cpu->r[31] = cpu->r[3];
-        /* 0209E418 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209E418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209E41C */ cpu->r[30] = cpu->r[4];
-        /* 0209E420 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E420 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E420 */ _t3 = _t2 & 0x00000001u;
         /* 0209E420 */ if (_t3) goto L_0209E424; else goto L_0209E434;
   L_0209E424: ; // 0x209e424
         /* 0209E424 */ cpu->r[3] = 0x00000148u;
         /* 0209E428 */ Gambit_fn_02801A78(cpu);
         /* 0209E42C */ cpu->r[31] = cpu->r[3];
-        /* 0209E42C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209E430 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E42C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209E430 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E430 */ _t5 = _t4 & 0x00000001u;
         /* 0209E430 */ if (_t5) goto L_0209E6C4; else goto L_0209E434;
   L_0209E434: ; // 0x209e434
         /* 0209E434 */ cpu->r[29] = cpu->r[31];
-        /* 0209E434 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0209E434 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0209E438 */ cpu->r[28] = 0x10110000u;
-        /* 0209E43C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E43C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E43C */ _t7 = _t6 & 0x00000001u;
         /* 0209E43C */ if (_t7) goto L_0209E440; else goto L_0209E46C;
   L_0209E440: ; // 0x209e440
         /* 0209E440 */ cpu->r[3] = 0x00000148u;
         /* 0209E444 */ Gambit_fn_02801A78(cpu);
         /* 0209E448 */ cpu->r[29] = cpu->r[3];
-        /* 0209E448 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0209E44C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E448 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0209E44C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E44C */ _t9 = _t8 & 0x00000001u;
         /* 0209E44C */ if (_t9) goto L_0209E450; else goto L_0209E46C;
   L_0209E450: ; // 0x209e450
@@ -16909,44 +16909,44 @@ void Gambit_fn_0209E40C(CPUState* cpu) {
         /* 0209E468 */ goto L_0209E6C4;
   L_0209E46C: ; // 0x209e46c
         /* 0209E46C */ cpu->r[27] = cpu->r[29];
-        /* 0209E46C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0209E470 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E46C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0209E470 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E470 */ _t15 = _t14 & 0x00000001u;
         /* 0209E470 */ if (_t15) goto L_0209E474; else goto L_0209E4A4;
   L_0209E474: ; // 0x209e474
         /* 0209E474 */ cpu->r[3] = 0x0000008Cu;
         /* 0209E478 */ Gambit_fn_02801A78(cpu);
         /* 0209E47C */ cpu->r[27] = cpu->r[3];
-        /* 0209E47C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0209E480 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E47C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0209E480 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E480 */ _t17 = _t16 & 0x00000001u;
         /* 0209E480 */ if (_t17) goto L_0209E484; else goto L_0209E4A4;
   L_0209E484: ; // 0x209e484
         /* 0209E484 */ cpu->r[0] = 0x10010000u;
         /* 0209E488 */ cpu->r[26] = cpu->r[29] + 0x0000008Cu;
-        /* 0209E488 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 0209E488 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 0209E48C */ _t18 = cpu->r[28] + 0x0000739Au;
         /* 0209E48C */ cpu->r[28] = rbrew_read16(cpu->mem, _t18);
         /* 0209E490 */ cpu->r[0] = cpu->r[0] + 0x00002008u;
         /* 0209E494 */ cpu->r[27] = 0x00000000u;
         /* 0209E498 */ _t19 = cpu->r[29] + 0x00000004u;
         /* 0209E498 */ rbrew_write32(cpu->mem, _t19, cpu->r[0]);
-        /* 0209E49C */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E49C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E49C */ _t21 = _t20 & 0x00000001u;
         /* 0209E49C */ if (_t21) goto L_0209E528; else goto L_0209E4A0;
   L_0209E4A0: ; // 0x209e4a0
         /* 0209E4A0 */ goto L_0209E538;
   L_0209E4A4: ; // 0x209e4a4
         /* 0209E4A4 */ cpu->r[3] = cpu->r[27];
-        /* 0209E4A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209E4A8 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E4A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209E4A8 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E4A8 */ _t23 = _t22 & 0x00000001u;
         /* 0209E4A8 */ if (_t23) goto L_0209E4AC; else goto L_0209E4D8;
   L_0209E4AC: ; // 0x209e4ac
         /* 0209E4AC */ cpu->r[3] = 0x0000000Cu;
         /* 0209E4B0 */ Gambit_fn_02801A78(cpu);
-        /* 0209E4B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209E4B8 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E4B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209E4B8 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E4B8 */ _t25 = _t24 & 0x00000001u;
         /* 0209E4B8 */ if (_t25) goto L_0209E4BC; else goto L_0209E4D8;
   L_0209E4BC: ; // 0x209e4bc
@@ -16987,27 +16987,27 @@ void Gambit_fn_0209E40C(CPUState* cpu) {
   L_0209E510: ; // 0x209e510
         /* 0209E510 */ cpu->r[0] = 0x10010000u;
         /* 0209E514 */ cpu->r[26] = cpu->r[29] + 0x0000008Cu;
-        /* 0209E514 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 0209E514 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 0209E518 */ cpu->r[0] = cpu->r[0] + 0x00002008u;
         /* 0209E51C */ cpu->r[27] = 0x00000000u;
         /* 0209E520 */ _t38 = cpu->r[29] + 0x00000004u;
         /* 0209E520 */ rbrew_write32(cpu->mem, _t38, cpu->r[0]);
-        /* 0209E524 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E524 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E524 */ _t40 = _t39 & 0x00000001u;
         /* 0209E524 */ if (_t40) goto L_0209E528; else goto L_0209E538;
   L_0209E528: ; // 0x209e528
         /* 0209E528 */ cpu->r[3] = 0x000000B4u;
         /* 0209E52C */ Gambit_fn_02801A78(cpu);
         /* 0209E530 */ cpu->r[26] = cpu->r[3];
-        /* 0209E530 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0209E534 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E530 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0209E534 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E534 */ _t42 = _t41 & 0x00000001u;
         /* 0209E534 */ if (_t42) goto L_0209E6A0; else goto L_0209E538;
   L_0209E538: ; // 0x209e538
         /* 0209E538 */ _t43 = cpu->r[26] + 0x00000000u;
         /* 0209E538 */ rbrew_write8(cpu->mem, _t43, (uint8_t)cpu->r[27]);
         /* 0209E53C */ cpu->r[21] = cpu->r[26] + 0x00000010u;
-        /* 0209E53C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
+        /* 0209E53C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
         /* 0209E540 */ cpu->r[23] = 0x10110000u;
         /* 0209E544 */ _t44 = cpu->r[26] + 0x00000004u;
         /* 0209E544 */ rbrew_write32(cpu->mem, _t44, cpu->r[27]);
@@ -17019,39 +17019,39 @@ void Gambit_fn_0209E40C(CPUState* cpu) {
         /* 0209E558 */ cpu->r[25] = cpu->r[25] + 0x00001F90u;
         /* 0209E55C */ _t46 = cpu->r[26] + 0x0000000Cu;
         /* 0209E55C */ rbrew_write32(cpu->mem, _t46, cpu->r[27]);
-        /* 0209E560 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E560 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E560 */ _t48 = _t47 & 0x00000001u;
         /* 0209E560 */ if (_t48) goto L_0209E564; else goto L_0209E584;
   L_0209E564: ; // 0x209e564
         /* 0209E564 */ cpu->r[3] = 0x0000004Cu;
         /* 0209E568 */ Gambit_fn_02801A78(cpu);
         /* 0209E56C */ cpu->r[21] = cpu->r[3];
-        /* 0209E56C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 0209E570 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E56C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 0209E570 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E570 */ _t50 = _t49 & 0x00000001u;
         /* 0209E570 */ if (_t50) goto L_0209E574; else goto L_0209E584;
   L_0209E574: ; // 0x209e574
         /* 0209E574 */ cpu->r[21] = cpu->r[26] + 0x0000005Cu;
-        /* 0209E574 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
+        /* 0209E574 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
         /* 0209E578 */ _t51 = cpu->r[23] + 0x00007399u;
         /* 0209E578 */ cpu->r[23] = rbrew_read8(cpu->mem, _t51);
-        /* 0209E57C */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E57C */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E57C */ _t53 = _t52 & 0x00000001u;
         /* 0209E57C */ if (_t53) goto L_0209E580; else goto L_0209E620;
   L_0209E580: ; // 0x209e580
         /* 0209E580 */ goto L_0209E610;
   L_0209E584: ; // 0x209e584
         /* 0209E584 */ cpu->r[22] = cpu->r[21];
-        /* 0209E584 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 0209E588 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 0209E588 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E588 */ _t55 = _t54 & 0x00000001u;
         /* 0209E588 */ if (_t55) goto L_0209E58C; else goto L_0209E5A8;
   L_0209E58C: ; // 0x209e58c
         /* 0209E58C */ cpu->r[3] = 0x0000004Cu;
         /* 0209E590 */ Gambit_fn_02801A78(cpu);
         /* 0209E594 */ cpu->r[22] = cpu->r[3];
-        /* 0209E594 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 0209E598 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E594 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 0209E598 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E598 */ _t57 = _t56 & 0x00000001u;
         /* 0209E598 */ if (_t57) goto L_0209E59C; else goto L_0209E5A8;
   L_0209E59C: ; // 0x209e59c
@@ -17062,15 +17062,15 @@ void Gambit_fn_0209E40C(CPUState* cpu) {
         /* 0209E5A4 */ goto L_0209E608;
   L_0209E5A8: ; // 0x209e5a8
         /* 0209E5A8 */ cpu->r[3] = cpu->r[22];
-        /* 0209E5A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209E5AC */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E5A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209E5AC */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E5AC */ _t61 = _t60 & 0x00000001u;
         /* 0209E5AC */ if (_t61) goto L_0209E5B0; else goto L_0209E5D4;
   L_0209E5B0: ; // 0x209e5b0
         /* 0209E5B0 */ cpu->r[3] = 0x0000000Cu;
         /* 0209E5B4 */ Gambit_fn_02801A78(cpu);
-        /* 0209E5B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209E5BC */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E5B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209E5BC */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E5BC */ _t63 = _t62 & 0x00000001u;
         /* 0209E5BC */ if (_t63) goto L_0209E5C0; else goto L_0209E5D4;
   L_0209E5C0: ; // 0x209e5c0
@@ -17109,43 +17109,43 @@ void Gambit_fn_0209E40C(CPUState* cpu) {
         /* 0209E604 */ rbrew_write32(cpu->mem, _t76, cpu->r[24]);
   L_0209E608: ; // 0x209e608
         /* 0209E608 */ cpu->r[21] = cpu->r[26] + 0x0000005Cu;
-        /* 0209E608 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 0209E60C */ _t77 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E608 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 0209E60C */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E60C */ _t78 = _t77 & 0x00000001u;
         /* 0209E60C */ if (_t78) goto L_0209E610; else goto L_0209E620;
   L_0209E610: ; // 0x209e610
         /* 0209E610 */ cpu->r[3] = 0x0000004Cu;
         /* 0209E614 */ Gambit_fn_02801A78(cpu);
         /* 0209E618 */ cpu->r[21] = cpu->r[3];
-        /* 0209E618 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 0209E61C */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E618 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 0209E61C */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E61C */ _t80 = _t79 & 0x00000001u;
         /* 0209E61C */ if (_t80) goto L_0209E680; else goto L_0209E620;
   L_0209E620: ; // 0x209e620
         /* 0209E620 */ cpu->r[22] = cpu->r[21];
-        /* 0209E620 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 0209E624 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E620 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 0209E624 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E624 */ _t82 = _t81 & 0x00000001u;
         /* 0209E624 */ if (_t82) goto L_0209E628; else goto L_0209E638;
   L_0209E628: ; // 0x209e628
         /* 0209E628 */ cpu->r[3] = 0x0000004Cu;
         /* 0209E62C */ Gambit_fn_02801A78(cpu);
         /* 0209E630 */ cpu->r[22] = cpu->r[3];
-        /* 0209E630 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 0209E634 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E630 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 0209E634 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E634 */ _t84 = _t83 & 0x00000001u;
         /* 0209E634 */ if (_t84) goto L_0209E67C; else goto L_0209E638;
   L_0209E638: ; // 0x209e638
         /* 0209E638 */ cpu->r[3] = cpu->r[22];
-        /* 0209E638 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209E63C */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E638 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209E63C */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E63C */ _t86 = _t85 & 0x00000001u;
         /* 0209E63C */ if (_t86) goto L_0209E640; else goto L_0209E650;
   L_0209E640: ; // 0x209e640
         /* 0209E640 */ cpu->r[3] = 0x0000000Cu;
         /* 0209E644 */ Gambit_fn_02801A78(cpu);
-        /* 0209E648 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209E64C */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E648 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209E64C */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E64C */ _t88 = _t87 & 0x00000001u;
         /* 0209E64C */ if (_t88) goto L_0209E670; else goto L_0209E650;
   L_0209E650: ; // 0x209e650
@@ -17257,14 +17257,14 @@ void Gambit_fn_0209E6DC(CPUState* cpu) {
         /* 0209E72C */ cpu->r[7] = cpu->r[7] + 0x00002038u;
         /* 0209E730 */ _t14 = cpu->r[12] + 0x00000118u;
         /* 0209E730 */ cpu->r[9] = rbrew_read32(cpu->mem, _t14);
-        /* 0209E734 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000001u);
+        /* 0209E734 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000001u));
         /* 0209E738 */ cpu->r[0] = cpu->r[0] + 0x00002048u;
-        /* 0209E73C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E73C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E73C */ _t16 = _t15 & 0x00000001u;
         /* 0209E73C */ if (_t16) goto L_0209E740; else goto L_0209E810;
   L_0209E740: ; // 0x209e740
-        /* 0209E740 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000001u);
-        /* 0209E744 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E740 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000001u));
+        /* 0209E744 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E744 */ _t18 = _t17 & 0x00000001u;
         /* 0209E744 */ if (_t18) goto L_0209E748; else goto L_0209E810;
   L_0209E748: ; // 0x209e748
@@ -17276,8 +17276,8 @@ void Gambit_fn_0209E6DC(CPUState* cpu) {
         /* 0209E75C */ cpu->r[12] = cpu->r[12] - cpu->r[8];
         /* 0209E760 */ cpu->r[12] = (uint32_t)((int32_t)cpu->r[12] * (int32_t)0x0000000Cu);
         /* 0209E764 */ cpu->r[12] = cpu->r[10] - cpu->r[12];
-        /* 0209E764 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0209E768 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E764 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0209E768 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E768 */ _t20 = _t19 & 0x00000001u;
         /* 0209E768 */ if (_t20) goto L_0209E7BC; else goto L_0209E76C;
   L_0209E76C: ; // 0x209e76c
@@ -17304,7 +17304,7 @@ void Gambit_fn_0209E6DC(CPUState* cpu) {
         /* 0209E7A4 */ cpu->r[5] = cpu->r[1] + 0x00000030u;
         /* 0209E7A8 */ _t27 = cpu->r[1] + 0x0000000Cu;
         /* 0209E7A8 */ rbrew_write32(cpu->mem, _t27, cpu->r[12]);
-        /* 0209E7AC */ _t28 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209E7AC */ _t28 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209E7AC */ _t29 = _t28 & 0x00000001u;
         /* 0209E7AC */ if (_t29) goto L_0209E7B0; // else: addr-0 trap, fall-through
   L_0209E7B0: ; // 0x209e7b0
@@ -17336,7 +17336,7 @@ void Gambit_fn_0209E6DC(CPUState* cpu) {
         /* 0209E7F8 */ cpu->r[10] = cpu->r[1] + 0x00000024u;
         /* 0209E7FC */ _t36 = cpu->r[1] + 0x0000000Cu;
         /* 0209E7FC */ rbrew_write32(cpu->mem, _t36, cpu->r[12]);
-        /* 0209E800 */ _t37 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209E800 */ _t37 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209E800 */ _t38 = _t37 & 0x00000001u;
         /* 0209E800 */ if (_t38) goto L_0209E804; // else: addr-0 trap, fall-through
   L_0209E804: ; // 0x209e804
@@ -17362,7 +17362,7 @@ void Gambit_fn_0209E6DC(CPUState* cpu) {
         /* 0209E83C */ cpu->r[5] = cpu->r[1] + 0x00000040u;
         /* 0209E840 */ _t43 = cpu->r[1] + 0x00000008u;
         /* 0209E840 */ rbrew_write32(cpu->mem, _t43, cpu->r[11]);
-        /* 0209E844 */ _t44 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209E844 */ _t44 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209E844 */ _t45 = _t44 & 0x00000001u;
         /* 0209E844 */ if (_t45) goto L_0209E848; // else: addr-0 trap, fall-through
   L_0209E848: ; // 0x209e848
@@ -17416,14 +17416,14 @@ void Gambit_fn_0209E6E4(CPUState* cpu) {
         /* 0209E72C */ cpu->r[7] = cpu->r[7] + 0x00002038u;
         /* 0209E730 */ _t13 = cpu->r[12] + 0x00000118u;
         /* 0209E730 */ cpu->r[9] = rbrew_read32(cpu->mem, _t13);
-        /* 0209E734 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000001u);
+        /* 0209E734 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000001u));
         /* 0209E738 */ cpu->r[0] = cpu->r[0] + 0x00002048u;
-        /* 0209E73C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E73C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E73C */ _t15 = _t14 & 0x00000001u;
         /* 0209E73C */ if (_t15) goto L_0209E740; else goto L_0209E810;
   L_0209E740: ; // 0x209e740
-        /* 0209E740 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000001u);
-        /* 0209E744 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E740 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000001u));
+        /* 0209E744 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E744 */ _t17 = _t16 & 0x00000001u;
         /* 0209E744 */ if (_t17) goto L_0209E748; else goto L_0209E810;
   L_0209E748: ; // 0x209e748
@@ -17435,8 +17435,8 @@ void Gambit_fn_0209E6E4(CPUState* cpu) {
         /* 0209E75C */ cpu->r[12] = cpu->r[12] - cpu->r[8];
         /* 0209E760 */ cpu->r[12] = (uint32_t)((int32_t)cpu->r[12] * (int32_t)0x0000000Cu);
         /* 0209E764 */ cpu->r[12] = cpu->r[10] - cpu->r[12];
-        /* 0209E764 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0209E768 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E764 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0209E768 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E768 */ _t19 = _t18 & 0x00000001u;
         /* 0209E768 */ if (_t19) goto L_0209E7BC; else goto L_0209E76C;
   L_0209E76C: ; // 0x209e76c
@@ -17463,7 +17463,7 @@ void Gambit_fn_0209E6E4(CPUState* cpu) {
         /* 0209E7A4 */ cpu->r[5] = cpu->r[1] + 0x00000030u;
         /* 0209E7A8 */ _t26 = cpu->r[1] + 0x0000000Cu;
         /* 0209E7A8 */ rbrew_write32(cpu->mem, _t26, cpu->r[12]);
-        /* 0209E7AC */ _t27 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209E7AC */ _t27 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209E7AC */ _t28 = _t27 & 0x00000001u;
         /* 0209E7AC */ if (_t28) goto L_0209E7B0; // else: addr-0 trap, fall-through
   L_0209E7B0: ; // 0x209e7b0
@@ -17495,7 +17495,7 @@ void Gambit_fn_0209E6E4(CPUState* cpu) {
         /* 0209E7F8 */ cpu->r[10] = cpu->r[1] + 0x00000024u;
         /* 0209E7FC */ _t35 = cpu->r[1] + 0x0000000Cu;
         /* 0209E7FC */ rbrew_write32(cpu->mem, _t35, cpu->r[12]);
-        /* 0209E800 */ _t36 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209E800 */ _t36 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209E800 */ _t37 = _t36 & 0x00000001u;
         /* 0209E800 */ if (_t37) goto L_0209E804; // else: addr-0 trap, fall-through
   L_0209E804: ; // 0x209e804
@@ -17521,7 +17521,7 @@ void Gambit_fn_0209E6E4(CPUState* cpu) {
         /* 0209E83C */ cpu->r[5] = cpu->r[1] + 0x00000040u;
         /* 0209E840 */ _t42 = cpu->r[1] + 0x00000008u;
         /* 0209E840 */ rbrew_write32(cpu->mem, _t42, cpu->r[11]);
-        /* 0209E844 */ _t43 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209E844 */ _t43 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209E844 */ _t44 = _t43 & 0x00000001u;
         /* 0209E844 */ if (_t44) goto L_0209E848; // else: addr-0 trap, fall-through
   L_0209E848: ; // 0x209e848
@@ -17608,17 +17608,17 @@ void Gambit_fn_0209E908(CPUState* cpu) {
         /* 0209E920 */ cpu->r[31] = rbrew_read32(cpu->mem, _t4);
         /* 0209E924 */ _t5 = cpu->r[31] + 0x0000001Eu;
         /* 0209E924 */ cpu->r[0] = rbrew_read8(cpu->mem, _t5);
-        /* 0209E928 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0209E928 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0209E92C */ cpu->r[30] = cpu->r[3];
-        /* 0209E930 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E930 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E930 */ _t7 = _t6 & 0x00000001u;
         /* 0209E930 */ if (_t7) goto L_0209E968; else goto L_0209E934;
   L_0209E934: ; // 0x209e934
         /* 0209E934 */ _t8 = cpu->r[31] + 0x0000001Cu;
         /* 0209E934 */ cpu->r[3] = rbrew_read16(cpu->mem, _t8);
         /* 0209E938 */ Gambit_fn_0282A11C(cpu);
-        /* 0209E93C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000003u);
-        /* 0209E940 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E93C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000003u));
+        /* 0209E940 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E940 */ _t10 = _t9 & 0x00000001u;
         /* 0209E940 */ if (_t10) goto L_0209E944; else goto L_0209E968;
   L_0209E944: ; // 0x209e944
@@ -17666,17 +17666,17 @@ void Gambit_fn_0209E90C(CPUState* cpu) {
         /* 0209E920 */ cpu->r[31] = rbrew_read32(cpu->mem, _t4);
         /* 0209E924 */ _t5 = cpu->r[31] + 0x0000001Eu;
         /* 0209E924 */ cpu->r[0] = rbrew_read8(cpu->mem, _t5);
-        /* 0209E928 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0209E928 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0209E92C */ cpu->r[30] = cpu->r[3];
-        /* 0209E930 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E930 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E930 */ _t7 = _t6 & 0x00000001u;
         /* 0209E930 */ if (_t7) goto L_0209E968; else goto L_0209E934;
   L_0209E934: ; // 0x209e934
         /* 0209E934 */ _t8 = cpu->r[31] + 0x0000001Cu;
         /* 0209E934 */ cpu->r[3] = rbrew_read16(cpu->mem, _t8);
         /* 0209E938 */ Gambit_fn_0282A11C(cpu);
-        /* 0209E93C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000003u);
-        /* 0209E940 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E93C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000003u));
+        /* 0209E940 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E940 */ _t10 = _t9 & 0x00000001u;
         /* 0209E940 */ if (_t10) goto L_0209E944; else goto L_0209E968;
   L_0209E944: ; // 0x209e944
@@ -17725,17 +17725,17 @@ void Gambit_fn_0209E984(CPUState* cpu) {
         /* 0209E99C */ cpu->r[31] = rbrew_read32(cpu->mem, _t4);
         /* 0209E9A0 */ _t5 = cpu->r[31] + 0x0000001Eu;
         /* 0209E9A0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t5);
-        /* 0209E9A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0209E9A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0209E9A8 */ cpu->r[30] = cpu->r[3];
-        /* 0209E9AC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E9AC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E9AC */ _t7 = _t6 & 0x00000001u;
         /* 0209E9AC */ if (_t7) goto L_0209E9E4; else goto L_0209E9B0;
   L_0209E9B0: ; // 0x209e9b0
         /* 0209E9B0 */ _t8 = cpu->r[31] + 0x0000001Cu;
         /* 0209E9B0 */ cpu->r[3] = rbrew_read16(cpu->mem, _t8);
         /* 0209E9B4 */ Gambit_fn_0282A11C(cpu);
-        /* 0209E9B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000003u);
-        /* 0209E9BC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E9B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000003u));
+        /* 0209E9BC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E9BC */ _t10 = _t9 & 0x00000001u;
         /* 0209E9BC */ if (_t10) goto L_0209E9C0; else goto L_0209E9E4;
   L_0209E9C0: ; // 0x209e9c0
@@ -17783,17 +17783,17 @@ void Gambit_fn_0209E988(CPUState* cpu) {
         /* 0209E99C */ cpu->r[31] = rbrew_read32(cpu->mem, _t4);
         /* 0209E9A0 */ _t5 = cpu->r[31] + 0x0000001Eu;
         /* 0209E9A0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t5);
-        /* 0209E9A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0209E9A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0209E9A8 */ cpu->r[30] = cpu->r[3];
-        /* 0209E9AC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E9AC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E9AC */ _t7 = _t6 & 0x00000001u;
         /* 0209E9AC */ if (_t7) goto L_0209E9E4; else goto L_0209E9B0;
   L_0209E9B0: ; // 0x209e9b0
         /* 0209E9B0 */ _t8 = cpu->r[31] + 0x0000001Cu;
         /* 0209E9B0 */ cpu->r[3] = rbrew_read16(cpu->mem, _t8);
         /* 0209E9B4 */ Gambit_fn_0282A11C(cpu);
-        /* 0209E9B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000003u);
-        /* 0209E9BC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209E9B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000003u));
+        /* 0209E9BC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209E9BC */ _t10 = _t9 & 0x00000001u;
         /* 0209E9BC */ if (_t10) goto L_0209E9C0; else goto L_0209E9E4;
   L_0209E9C0: ; // 0x209e9c0
@@ -17934,15 +17934,15 @@ void Gambit_fn_0209EA6C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209EA6C: ; // 0x209ea6c
-        /* 0209EA6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209EA70 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EA6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209EA70 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EA70 */ _t1 = _t0 & 0x00000001u;
         /* 0209EA70 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209EA70 */ goto L_0209EA74;
   L_0209EA74: ; // 0x209ea74
         /* 0209EA74 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209EA74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209EA78 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EA74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209EA78 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EA78 */ _t3 = _t2 & 0x00000001u;
         /* 0209EA78 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209EA78 */ goto L_0209EA7C;
@@ -17961,8 +17961,8 @@ void Gambit_fn_0209EA6C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -17976,15 +17976,15 @@ void Gambit_fn_0209EA6C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -18018,15 +18018,15 @@ void Gambit_fn_0209EA84(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209EA84: ; // 0x209ea84
-        /* 0209EA84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209EA88 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EA84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209EA88 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EA88 */ _t1 = _t0 & 0x00000001u;
         /* 0209EA88 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209EA88 */ goto L_0209EA8C;
   L_0209EA8C: ; // 0x209ea8c
         /* 0209EA8C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209EA8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209EA90 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EA8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209EA90 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EA90 */ _t3 = _t2 & 0x00000001u;
         /* 0209EA90 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209EA90 */ goto L_0209EA94;
@@ -18045,8 +18045,8 @@ void Gambit_fn_0209EA84(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -18060,15 +18060,15 @@ void Gambit_fn_0209EA84(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -18139,15 +18139,15 @@ void Gambit_fn_0209EAD8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209EAD8: ; // 0x209ead8
-        /* 0209EAD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209EADC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EAD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209EADC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EADC */ _t1 = _t0 & 0x00000001u;
         /* 0209EADC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209EADC */ goto L_0209EAE0;
   L_0209EAE0: ; // 0x209eae0
         /* 0209EAE0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209EAE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209EAE4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EAE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209EAE4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EAE4 */ _t3 = _t2 & 0x00000001u;
         /* 0209EAE4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209EAE4 */ goto L_0209EAE8;
@@ -18166,8 +18166,8 @@ void Gambit_fn_0209EAD8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -18181,15 +18181,15 @@ void Gambit_fn_0209EAD8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -18217,15 +18217,15 @@ void Gambit_fn_0209EAEC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209EAEC: ; // 0x209eaec
-        /* 0209EAEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209EAF0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EAEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209EAF0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EAF0 */ _t1 = _t0 & 0x00000001u;
         /* 0209EAF0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209EAF0 */ goto L_0209EAF4;
   L_0209EAF4: ; // 0x209eaf4
         /* 0209EAF4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209EAF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209EAF8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EAF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209EAF8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EAF8 */ _t3 = _t2 & 0x00000001u;
         /* 0209EAF8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209EAF8 */ goto L_0209EAFC;
@@ -18244,8 +18244,8 @@ void Gambit_fn_0209EAEC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -18259,15 +18259,15 @@ void Gambit_fn_0209EAEC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -18318,7 +18318,7 @@ void Gambit_fn_0209EB00(CPUState* cpu) {
         /* 0209EB28 */ rbrew_write32(cpu->mem, _t8, cpu->r[10]);
         /* 0209EB2C */ _t9 = cpu->r[1] + 0x00000034u;
         /* 0209EB2C */ rbrew_write32(cpu->mem, _t9, cpu->r[6]);
-        /* 0209EB30 */ _t10 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209EB30 */ _t10 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209EB30 */ _t11 = _t10 & 0x00000001u;
         /* 0209EB30 */ if (_t11) goto L_0209EB34; else goto L_0209EB54;
   L_0209EB34: ; // 0x209eb34
@@ -18360,8 +18360,8 @@ void Gambit_fn_0209EB00(CPUState* cpu) {
         /* 0209EB8C */ Gambit_fn_027FD390(cpu);
         /* 0209EB90 */ _t24 = cpu->r[28] + 0x0000008Cu;
         /* 0209EB90 */ cpu->r[11] = rbrew_read8(cpu->mem, _t24);
-        /* 0209EB94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209EB98 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EB94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209EB98 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EB98 */ _t26 = _t25 & 0x00000001u;
         /* 0209EB98 */ if (_t26) goto L_0209EB9C; else goto L_0209EBA4;
   L_0209EB9C: ; // 0x209eb9c
@@ -18434,23 +18434,23 @@ void Gambit_fn_0209EB00(CPUState* cpu) {
         /* 0209EC4C */ _t48 = cpu->r[5] + 0x00000000u;
         /* 0209EC4C */ cpu->r[0] = rbrew_read16(cpu->mem, _t48);
         /* 0209EC50 */ cpu->r[30] = 0x00000000u;
-        /* 0209EC54 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 0209EC54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 0209EC58 */ cpu->r[0] = 0x00080000u;
-        /* 0209EC5C */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EC5C */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EC5C */ _t50 = _t49 & 0x00000001u;
         /* 0209EC5C */ if (_t50) goto L_0209EC84; else goto L_0209EC60;
   L_0209EC60: ; // 0x209ec60
         /* 0209EC60 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0209EC64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 0209EC64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 0209EC68 */ cpu->r[5] = cpu->r[5] + 0x00000002u;
-        /* 0209EC6C */ _t51 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209EC6C */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209EC6C */ _t52 = _t51 & 0x00000001u;
         /* 0209EC6C */ if (_t52) goto L_0209EC80; else goto L_0209EC70;
   L_0209EC70: ; // 0x209ec70
         /* 0209EC70 */ _t53 = cpu->r[5] + 0x00000000u;
         /* 0209EC70 */ cpu->r[6] = rbrew_read16(cpu->mem, _t53);
-        /* 0209EC74 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[31]);
-        /* 0209EC78 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EC74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[31]));
+        /* 0209EC78 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EC78 */ _t55 = _t54 & 0x00000001u;
         /* 0209EC78 */ if (_t55) goto L_0209EC7C; else goto L_0209EC60;
   L_0209EC7C: ; // 0x209ec7c
@@ -18458,22 +18458,22 @@ void Gambit_fn_0209EB00(CPUState* cpu) {
   L_0209EC80: ; // 0x209ec80
         /* 0209EC80 */ cpu->r[30] = 0x00000000u;
   L_0209EC84: ; // 0x209ec84
-        /* 0209EC84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0209EC88 */ _t56 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209EC84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0209EC88 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209EC88 */ _t57 = _t56 & 0x00000001u;
         /* 0209EC88 */ if (_t57) goto L_0209EC8C; else goto L_0209EC9C;
   L_0209EC8C: ; // 0x209ec8c
         /* 0209EC8C */ cpu->r[7] = cpu->r[30] + cpu->r[26];
         /* 0209EC90 */ cpu->r[26] = cpu->r[7] + 0x00000001u;
-        /* 0209EC90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0209EC94 */ _t58 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209EC90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0209EC94 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209EC94 */ _t59 = _t58 & 0x00000001u;
         /* 0209EC94 */ if (_t59) goto L_0209EC98; else goto L_0209EC9C;
   L_0209EC98: ; // 0x209ec98
         /* 0209EC98 */ cpu->r[26] = 0x00000000u;
   L_0209EC9C: ; // 0x209ec9c
-        /* 0209EC9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0209ECA0 */ _t60 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209EC9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0209ECA0 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209ECA0 */ _t61 = _t60 & 0x00000001u;
         /* 0209ECA0 */ if (_t61) goto L_0209ECA4; else goto L_0209ECF4;
   L_0209ECA4: ; // 0x209eca4
@@ -18489,23 +18489,23 @@ void Gambit_fn_0209EB00(CPUState* cpu) {
         /* 0209ECBC */ _t65 = cpu->r[12] + 0x00000000u;
         /* 0209ECBC */ cpu->r[0] = rbrew_read16(cpu->mem, _t65);
         /* 0209ECC0 */ cpu->r[29] = 0x00000000u;
-        /* 0209ECC4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 0209ECC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 0209ECC8 */ cpu->r[0] = 0x00080000u;
-        /* 0209ECCC */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209ECCC */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209ECCC */ _t67 = _t66 & 0x00000001u;
         /* 0209ECCC */ if (_t67) goto L_0209ECF4; else goto L_0209ECD0;
   L_0209ECD0: ; // 0x209ecd0
         /* 0209ECD0 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 0209ECD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[0]);
+        /* 0209ECD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[0]));
         /* 0209ECD8 */ cpu->r[12] = cpu->r[12] + 0x00000002u;
-        /* 0209ECDC */ _t68 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209ECDC */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209ECDC */ _t69 = _t68 & 0x00000001u;
         /* 0209ECDC */ if (_t69) goto L_0209ECF0; else goto L_0209ECE0;
   L_0209ECE0: ; // 0x209ece0
         /* 0209ECE0 */ _t70 = cpu->r[12] + 0x00000000u;
         /* 0209ECE0 */ cpu->r[11] = rbrew_read16(cpu->mem, _t70);
-        /* 0209ECE4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[31]);
-        /* 0209ECE8 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209ECE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[31]));
+        /* 0209ECE8 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209ECE8 */ _t72 = _t71 & 0x00000001u;
         /* 0209ECE8 */ if (_t72) goto L_0209ECEC; else goto L_0209ECD0;
   L_0209ECEC: ; // 0x209ecec
@@ -18516,15 +18516,15 @@ void Gambit_fn_0209EB00(CPUState* cpu) {
         /* 0209ECF4 */ _t73 = cpu->r[28] + 0x00000008u;
         /* 0209ECF4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t73);
         /* 0209ECF8 */ cpu->r[7] = cpu->r[0] - cpu->r[26];
-        /* 0209ECFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[7]);
-        /* 0209ED00 */ _t74 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209ECFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[7]));
+        /* 0209ED00 */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209ED00 */ _t75 = _t74 & 0x00000001u;
         /* 0209ED00 */ if (_t75) goto L_0209ED08; else goto L_0209ED04;
   L_0209ED04: ; // 0x209ed04
         /* 0209ED04 */ cpu->r[29] = cpu->r[7] + 0xFFFFFFFFu;
   L_0209ED08: ; // 0x209ed08
-        /* 0209ED08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0209ED0C */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209ED08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0209ED0C */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209ED0C */ _t77 = _t76 & 0x00000001u;
         /* 0209ED0C */ if (_t77) goto L_0209ED18; else goto L_0209ED10;
   L_0209ED10: ; // 0x209ed10
@@ -18547,8 +18547,8 @@ void Gambit_fn_0209EB00(CPUState* cpu) {
         /* 0209ED40 */ cpu->r[3] = cpu->r[25];
         /* 0209ED44 */ rbrew_dispatch(cpu, 0x02d0a6e8u);
         /* 0209ED48 */ cpu->r[0] = cpu->r[26] + cpu->r[29];
-        /* 0209ED4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[30]);
-        /* 0209ED50 */ _t81 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209ED4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[30]));
+        /* 0209ED50 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209ED50 */ _t82 = _t81 & 0x00000001u;
         /* 0209ED50 */ if (_t82) goto L_0209ED54; else goto L_0209ED5C;
   L_0209ED54: ; // 0x209ed54
@@ -18598,7 +18598,7 @@ void Gambit_fn_0209EB04(CPUState* cpu) {
         /* 0209EB28 */ rbrew_write32(cpu->mem, _t8, cpu->r[10]);
         /* 0209EB2C */ _t9 = cpu->r[1] + 0x00000034u;
         /* 0209EB2C */ rbrew_write32(cpu->mem, _t9, cpu->r[6]);
-        /* 0209EB30 */ _t10 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209EB30 */ _t10 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209EB30 */ _t11 = _t10 & 0x00000001u;
         /* 0209EB30 */ if (_t11) goto L_0209EB34; else goto L_0209EB54;
   L_0209EB34: ; // 0x209eb34
@@ -18640,8 +18640,8 @@ void Gambit_fn_0209EB04(CPUState* cpu) {
         /* 0209EB8C */ Gambit_fn_027FD390(cpu);
         /* 0209EB90 */ _t24 = cpu->r[28] + 0x0000008Cu;
         /* 0209EB90 */ cpu->r[11] = rbrew_read8(cpu->mem, _t24);
-        /* 0209EB94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209EB98 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EB94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209EB98 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EB98 */ _t26 = _t25 & 0x00000001u;
         /* 0209EB98 */ if (_t26) goto L_0209EB9C; else goto L_0209EBA4;
   L_0209EB9C: ; // 0x209eb9c
@@ -18714,23 +18714,23 @@ void Gambit_fn_0209EB04(CPUState* cpu) {
         /* 0209EC4C */ _t48 = cpu->r[5] + 0x00000000u;
         /* 0209EC4C */ cpu->r[0] = rbrew_read16(cpu->mem, _t48);
         /* 0209EC50 */ cpu->r[30] = 0x00000000u;
-        /* 0209EC54 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 0209EC54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 0209EC58 */ cpu->r[0] = 0x00080000u;
-        /* 0209EC5C */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EC5C */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EC5C */ _t50 = _t49 & 0x00000001u;
         /* 0209EC5C */ if (_t50) goto L_0209EC84; else goto L_0209EC60;
   L_0209EC60: ; // 0x209ec60
         /* 0209EC60 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0209EC64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 0209EC64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 0209EC68 */ cpu->r[5] = cpu->r[5] + 0x00000002u;
-        /* 0209EC6C */ _t51 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209EC6C */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209EC6C */ _t52 = _t51 & 0x00000001u;
         /* 0209EC6C */ if (_t52) goto L_0209EC80; else goto L_0209EC70;
   L_0209EC70: ; // 0x209ec70
         /* 0209EC70 */ _t53 = cpu->r[5] + 0x00000000u;
         /* 0209EC70 */ cpu->r[6] = rbrew_read16(cpu->mem, _t53);
-        /* 0209EC74 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[31]);
-        /* 0209EC78 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EC74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[31]));
+        /* 0209EC78 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EC78 */ _t55 = _t54 & 0x00000001u;
         /* 0209EC78 */ if (_t55) goto L_0209EC7C; else goto L_0209EC60;
   L_0209EC7C: ; // 0x209ec7c
@@ -18738,22 +18738,22 @@ void Gambit_fn_0209EB04(CPUState* cpu) {
   L_0209EC80: ; // 0x209ec80
         /* 0209EC80 */ cpu->r[30] = 0x00000000u;
   L_0209EC84: ; // 0x209ec84
-        /* 0209EC84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0209EC88 */ _t56 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209EC84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0209EC88 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209EC88 */ _t57 = _t56 & 0x00000001u;
         /* 0209EC88 */ if (_t57) goto L_0209EC8C; else goto L_0209EC9C;
   L_0209EC8C: ; // 0x209ec8c
         /* 0209EC8C */ cpu->r[7] = cpu->r[30] + cpu->r[26];
         /* 0209EC90 */ cpu->r[26] = cpu->r[7] + 0x00000001u;
-        /* 0209EC90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0209EC94 */ _t58 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209EC90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0209EC94 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209EC94 */ _t59 = _t58 & 0x00000001u;
         /* 0209EC94 */ if (_t59) goto L_0209EC98; else goto L_0209EC9C;
   L_0209EC98: ; // 0x209ec98
         /* 0209EC98 */ cpu->r[26] = 0x00000000u;
   L_0209EC9C: ; // 0x209ec9c
-        /* 0209EC9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0209ECA0 */ _t60 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209EC9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0209ECA0 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209ECA0 */ _t61 = _t60 & 0x00000001u;
         /* 0209ECA0 */ if (_t61) goto L_0209ECA4; else goto L_0209ECF4;
   L_0209ECA4: ; // 0x209eca4
@@ -18769,23 +18769,23 @@ void Gambit_fn_0209EB04(CPUState* cpu) {
         /* 0209ECBC */ _t65 = cpu->r[12] + 0x00000000u;
         /* 0209ECBC */ cpu->r[0] = rbrew_read16(cpu->mem, _t65);
         /* 0209ECC0 */ cpu->r[29] = 0x00000000u;
-        /* 0209ECC4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 0209ECC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 0209ECC8 */ cpu->r[0] = 0x00080000u;
-        /* 0209ECCC */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209ECCC */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209ECCC */ _t67 = _t66 & 0x00000001u;
         /* 0209ECCC */ if (_t67) goto L_0209ECF4; else goto L_0209ECD0;
   L_0209ECD0: ; // 0x209ecd0
         /* 0209ECD0 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 0209ECD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[0]);
+        /* 0209ECD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[0]));
         /* 0209ECD8 */ cpu->r[12] = cpu->r[12] + 0x00000002u;
-        /* 0209ECDC */ _t68 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209ECDC */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209ECDC */ _t69 = _t68 & 0x00000001u;
         /* 0209ECDC */ if (_t69) goto L_0209ECF0; else goto L_0209ECE0;
   L_0209ECE0: ; // 0x209ece0
         /* 0209ECE0 */ _t70 = cpu->r[12] + 0x00000000u;
         /* 0209ECE0 */ cpu->r[11] = rbrew_read16(cpu->mem, _t70);
-        /* 0209ECE4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[31]);
-        /* 0209ECE8 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209ECE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[31]));
+        /* 0209ECE8 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209ECE8 */ _t72 = _t71 & 0x00000001u;
         /* 0209ECE8 */ if (_t72) goto L_0209ECEC; else goto L_0209ECD0;
   L_0209ECEC: ; // 0x209ecec
@@ -18796,15 +18796,15 @@ void Gambit_fn_0209EB04(CPUState* cpu) {
         /* 0209ECF4 */ _t73 = cpu->r[28] + 0x00000008u;
         /* 0209ECF4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t73);
         /* 0209ECF8 */ cpu->r[7] = cpu->r[0] - cpu->r[26];
-        /* 0209ECFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[7]);
-        /* 0209ED00 */ _t74 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209ECFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[7]));
+        /* 0209ED00 */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209ED00 */ _t75 = _t74 & 0x00000001u;
         /* 0209ED00 */ if (_t75) goto L_0209ED08; else goto L_0209ED04;
   L_0209ED04: ; // 0x209ed04
         /* 0209ED04 */ cpu->r[29] = cpu->r[7] + 0xFFFFFFFFu;
   L_0209ED08: ; // 0x209ed08
-        /* 0209ED08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0209ED0C */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209ED08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0209ED0C */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209ED0C */ _t77 = _t76 & 0x00000001u;
         /* 0209ED0C */ if (_t77) goto L_0209ED18; else goto L_0209ED10;
   L_0209ED10: ; // 0x209ed10
@@ -18827,8 +18827,8 @@ void Gambit_fn_0209EB04(CPUState* cpu) {
         /* 0209ED40 */ cpu->r[3] = cpu->r[25];
         /* 0209ED44 */ rbrew_dispatch(cpu, 0x02d0a6e8u);
         /* 0209ED48 */ cpu->r[0] = cpu->r[26] + cpu->r[29];
-        /* 0209ED4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[30]);
-        /* 0209ED50 */ _t81 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209ED4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[30]));
+        /* 0209ED50 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209ED50 */ _t82 = _t81 & 0x00000001u;
         /* 0209ED50 */ if (_t82) goto L_0209ED54; else goto L_0209ED5C;
   L_0209ED54: ; // 0x209ed54
@@ -18864,32 +18864,32 @@ void Gambit_fn_0209ED80(CPUState* cpu) {
         /* 0209ED88 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 0209ED8C */ /* nop */
         /* 0209ED90 */ cpu->r[31] = cpu->r[3];
-        /* 0209ED90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209ED90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209ED94 */ cpu->r[30] = cpu->r[4];
-        /* 0209ED98 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209ED98 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209ED98 */ _t3 = _t2 & 0x00000001u;
         /* 0209ED98 */ if (_t3) goto L_0209ED9C; else goto L_0209EDAC;
   L_0209ED9C: ; // 0x209ed9c
         /* 0209ED9C */ cpu->r[3] = 0x000001C8u;
         /* 0209EDA0 */ Gambit_fn_02801A78(cpu);
         /* 0209EDA4 */ cpu->r[31] = cpu->r[3];
-        /* 0209EDA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209EDA8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EDA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209EDA8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EDA8 */ _t5 = _t4 & 0x00000001u;
         /* 0209EDA8 */ if (_t5) goto L_0209F03C; else goto L_0209EDAC;
   L_0209EDAC: ; // 0x209edac
         /* 0209EDAC */ cpu->r[29] = cpu->r[31];
-        /* 0209EDAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0209EDAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0209EDB0 */ cpu->r[28] = 0x10110000u;
-        /* 0209EDB4 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EDB4 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EDB4 */ _t7 = _t6 & 0x00000001u;
         /* 0209EDB4 */ if (_t7) goto L_0209EDB8; else goto L_0209EDE4;
   L_0209EDB8: ; // 0x209edb8
         /* 0209EDB8 */ cpu->r[3] = 0x000001C8u;
         /* 0209EDBC */ Gambit_fn_02801A78(cpu);
         /* 0209EDC0 */ cpu->r[29] = cpu->r[3];
-        /* 0209EDC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0209EDC4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EDC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0209EDC4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EDC4 */ _t9 = _t8 & 0x00000001u;
         /* 0209EDC4 */ if (_t9) goto L_0209EDC8; else goto L_0209EDE4;
   L_0209EDC8: ; // 0x209edc8
@@ -18906,44 +18906,44 @@ void Gambit_fn_0209ED80(CPUState* cpu) {
         /* 0209EDE0 */ goto L_0209F03C;
   L_0209EDE4: ; // 0x209ede4
         /* 0209EDE4 */ cpu->r[27] = cpu->r[29];
-        /* 0209EDE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0209EDE8 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EDE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0209EDE8 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EDE8 */ _t15 = _t14 & 0x00000001u;
         /* 0209EDE8 */ if (_t15) goto L_0209EDEC; else goto L_0209EE1C;
   L_0209EDEC: ; // 0x209edec
         /* 0209EDEC */ cpu->r[3] = 0x0000010Cu;
         /* 0209EDF0 */ Gambit_fn_02801A78(cpu);
         /* 0209EDF4 */ cpu->r[27] = cpu->r[3];
-        /* 0209EDF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0209EDF8 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EDF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0209EDF8 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EDF8 */ _t17 = _t16 & 0x00000001u;
         /* 0209EDF8 */ if (_t17) goto L_0209EDFC; else goto L_0209EE1C;
   L_0209EDFC: ; // 0x209edfc
         /* 0209EDFC */ cpu->r[0] = 0x10010000u;
         /* 0209EE00 */ cpu->r[26] = cpu->r[29] + 0x0000010Cu;
-        /* 0209EE00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 0209EE00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 0209EE04 */ _t18 = cpu->r[28] + 0x0000739Au;
         /* 0209EE04 */ cpu->r[28] = rbrew_read16(cpu->mem, _t18);
         /* 0209EE08 */ cpu->r[0] = cpu->r[0] + 0x00002148u;
         /* 0209EE0C */ cpu->r[27] = 0x00000000u;
         /* 0209EE10 */ _t19 = cpu->r[29] + 0x00000004u;
         /* 0209EE10 */ rbrew_write32(cpu->mem, _t19, cpu->r[0]);
-        /* 0209EE14 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EE14 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EE14 */ _t21 = _t20 & 0x00000001u;
         /* 0209EE14 */ if (_t21) goto L_0209EEA0; else goto L_0209EE18;
   L_0209EE18: ; // 0x209ee18
         /* 0209EE18 */ goto L_0209EEB0;
   L_0209EE1C: ; // 0x209ee1c
         /* 0209EE1C */ cpu->r[3] = cpu->r[27];
-        /* 0209EE1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209EE20 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EE1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209EE20 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EE20 */ _t23 = _t22 & 0x00000001u;
         /* 0209EE20 */ if (_t23) goto L_0209EE24; else goto L_0209EE50;
   L_0209EE24: ; // 0x209ee24
         /* 0209EE24 */ cpu->r[3] = 0x0000000Cu;
         /* 0209EE28 */ Gambit_fn_02801A78(cpu);
-        /* 0209EE2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209EE30 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EE2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209EE30 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EE30 */ _t25 = _t24 & 0x00000001u;
         /* 0209EE30 */ if (_t25) goto L_0209EE34; else goto L_0209EE50;
   L_0209EE34: ; // 0x209ee34
@@ -18984,27 +18984,27 @@ void Gambit_fn_0209ED80(CPUState* cpu) {
   L_0209EE88: ; // 0x209ee88
         /* 0209EE88 */ cpu->r[0] = 0x10010000u;
         /* 0209EE8C */ cpu->r[26] = cpu->r[29] + 0x0000010Cu;
-        /* 0209EE8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 0209EE8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 0209EE90 */ cpu->r[0] = cpu->r[0] + 0x00002148u;
         /* 0209EE94 */ cpu->r[27] = 0x00000000u;
         /* 0209EE98 */ _t38 = cpu->r[29] + 0x00000004u;
         /* 0209EE98 */ rbrew_write32(cpu->mem, _t38, cpu->r[0]);
-        /* 0209EE9C */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EE9C */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EE9C */ _t40 = _t39 & 0x00000001u;
         /* 0209EE9C */ if (_t40) goto L_0209EEA0; else goto L_0209EEB0;
   L_0209EEA0: ; // 0x209eea0
         /* 0209EEA0 */ cpu->r[3] = 0x000000B4u;
         /* 0209EEA4 */ Gambit_fn_02801A78(cpu);
         /* 0209EEA8 */ cpu->r[26] = cpu->r[3];
-        /* 0209EEA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0209EEAC */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EEA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0209EEAC */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EEAC */ _t42 = _t41 & 0x00000001u;
         /* 0209EEAC */ if (_t42) goto L_0209F018; else goto L_0209EEB0;
   L_0209EEB0: ; // 0x209eeb0
         /* 0209EEB0 */ _t43 = cpu->r[26] + 0x00000000u;
         /* 0209EEB0 */ rbrew_write8(cpu->mem, _t43, (uint8_t)cpu->r[27]);
         /* 0209EEB4 */ cpu->r[21] = cpu->r[26] + 0x00000010u;
-        /* 0209EEB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
+        /* 0209EEB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
         /* 0209EEB8 */ cpu->r[23] = 0x10110000u;
         /* 0209EEBC */ _t44 = cpu->r[26] + 0x00000004u;
         /* 0209EEBC */ rbrew_write32(cpu->mem, _t44, cpu->r[27]);
@@ -19016,39 +19016,39 @@ void Gambit_fn_0209ED80(CPUState* cpu) {
         /* 0209EED0 */ cpu->r[25] = cpu->r[25] + 0x000020D0u;
         /* 0209EED4 */ _t46 = cpu->r[26] + 0x0000000Cu;
         /* 0209EED4 */ rbrew_write32(cpu->mem, _t46, cpu->r[27]);
-        /* 0209EED8 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EED8 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EED8 */ _t48 = _t47 & 0x00000001u;
         /* 0209EED8 */ if (_t48) goto L_0209EEDC; else goto L_0209EEFC;
   L_0209EEDC: ; // 0x209eedc
         /* 0209EEDC */ cpu->r[3] = 0x0000004Cu;
         /* 0209EEE0 */ Gambit_fn_02801A78(cpu);
         /* 0209EEE4 */ cpu->r[21] = cpu->r[3];
-        /* 0209EEE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 0209EEE8 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EEE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 0209EEE8 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EEE8 */ _t50 = _t49 & 0x00000001u;
         /* 0209EEE8 */ if (_t50) goto L_0209EEEC; else goto L_0209EEFC;
   L_0209EEEC: ; // 0x209eeec
         /* 0209EEEC */ cpu->r[21] = cpu->r[26] + 0x0000005Cu;
-        /* 0209EEEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
+        /* 0209EEEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
         /* 0209EEF0 */ _t51 = cpu->r[23] + 0x00007399u;
         /* 0209EEF0 */ cpu->r[23] = rbrew_read8(cpu->mem, _t51);
-        /* 0209EEF4 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EEF4 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EEF4 */ _t53 = _t52 & 0x00000001u;
         /* 0209EEF4 */ if (_t53) goto L_0209EEF8; else goto L_0209EF98;
   L_0209EEF8: ; // 0x209eef8
         /* 0209EEF8 */ goto L_0209EF88;
   L_0209EEFC: ; // 0x209eefc
         /* 0209EEFC */ cpu->r[22] = cpu->r[21];
-        /* 0209EEFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 0209EF00 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EEFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 0209EF00 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EF00 */ _t55 = _t54 & 0x00000001u;
         /* 0209EF00 */ if (_t55) goto L_0209EF04; else goto L_0209EF20;
   L_0209EF04: ; // 0x209ef04
         /* 0209EF04 */ cpu->r[3] = 0x0000004Cu;
         /* 0209EF08 */ Gambit_fn_02801A78(cpu);
         /* 0209EF0C */ cpu->r[22] = cpu->r[3];
-        /* 0209EF0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 0209EF10 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EF0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 0209EF10 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EF10 */ _t57 = _t56 & 0x00000001u;
         /* 0209EF10 */ if (_t57) goto L_0209EF14; else goto L_0209EF20;
   L_0209EF14: ; // 0x209ef14
@@ -19059,15 +19059,15 @@ void Gambit_fn_0209ED80(CPUState* cpu) {
         /* 0209EF1C */ goto L_0209EF80;
   L_0209EF20: ; // 0x209ef20
         /* 0209EF20 */ cpu->r[3] = cpu->r[22];
-        /* 0209EF20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209EF24 */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EF20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209EF24 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EF24 */ _t61 = _t60 & 0x00000001u;
         /* 0209EF24 */ if (_t61) goto L_0209EF28; else goto L_0209EF4C;
   L_0209EF28: ; // 0x209ef28
         /* 0209EF28 */ cpu->r[3] = 0x0000000Cu;
         /* 0209EF2C */ Gambit_fn_02801A78(cpu);
-        /* 0209EF30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209EF34 */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EF30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209EF34 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EF34 */ _t63 = _t62 & 0x00000001u;
         /* 0209EF34 */ if (_t63) goto L_0209EF38; else goto L_0209EF4C;
   L_0209EF38: ; // 0x209ef38
@@ -19106,43 +19106,43 @@ void Gambit_fn_0209ED80(CPUState* cpu) {
         /* 0209EF7C */ rbrew_write32(cpu->mem, _t76, cpu->r[24]);
   L_0209EF80: ; // 0x209ef80
         /* 0209EF80 */ cpu->r[21] = cpu->r[26] + 0x0000005Cu;
-        /* 0209EF80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 0209EF84 */ _t77 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EF80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 0209EF84 */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EF84 */ _t78 = _t77 & 0x00000001u;
         /* 0209EF84 */ if (_t78) goto L_0209EF88; else goto L_0209EF98;
   L_0209EF88: ; // 0x209ef88
         /* 0209EF88 */ cpu->r[3] = 0x0000004Cu;
         /* 0209EF8C */ Gambit_fn_02801A78(cpu);
         /* 0209EF90 */ cpu->r[21] = cpu->r[3];
-        /* 0209EF90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 0209EF94 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EF90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 0209EF94 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EF94 */ _t80 = _t79 & 0x00000001u;
         /* 0209EF94 */ if (_t80) goto L_0209EFF8; else goto L_0209EF98;
   L_0209EF98: ; // 0x209ef98
         /* 0209EF98 */ cpu->r[22] = cpu->r[21];
-        /* 0209EF98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 0209EF9C */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EF98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 0209EF9C */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EF9C */ _t82 = _t81 & 0x00000001u;
         /* 0209EF9C */ if (_t82) goto L_0209EFA0; else goto L_0209EFB0;
   L_0209EFA0: ; // 0x209efa0
         /* 0209EFA0 */ cpu->r[3] = 0x0000004Cu;
         /* 0209EFA4 */ Gambit_fn_02801A78(cpu);
         /* 0209EFA8 */ cpu->r[22] = cpu->r[3];
-        /* 0209EFA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 0209EFAC */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EFA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 0209EFAC */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EFAC */ _t84 = _t83 & 0x00000001u;
         /* 0209EFAC */ if (_t84) goto L_0209EFF4; else goto L_0209EFB0;
   L_0209EFB0: ; // 0x209efb0
         /* 0209EFB0 */ cpu->r[3] = cpu->r[22];
-        /* 0209EFB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209EFB4 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EFB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209EFB4 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EFB4 */ _t86 = _t85 & 0x00000001u;
         /* 0209EFB4 */ if (_t86) goto L_0209EFB8; else goto L_0209EFC8;
   L_0209EFB8: ; // 0x209efb8
         /* 0209EFB8 */ cpu->r[3] = 0x0000000Cu;
         /* 0209EFBC */ Gambit_fn_02801A78(cpu);
-        /* 0209EFC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209EFC4 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EFC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209EFC4 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EFC4 */ _t88 = _t87 & 0x00000001u;
         /* 0209EFC4 */ if (_t88) goto L_0209EFE8; else goto L_0209EFC8;
   L_0209EFC8: ; // 0x209efc8
@@ -19223,32 +19223,32 @@ void Gambit_fn_0209ED84(CPUState* cpu) {
         /* 0209ED88 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 0209ED8C */ /* nop */
         /* 0209ED90 */ cpu->r[31] = cpu->r[3];
-        /* 0209ED90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209ED90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209ED94 */ cpu->r[30] = cpu->r[4];
-        /* 0209ED98 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209ED98 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209ED98 */ _t3 = _t2 & 0x00000001u;
         /* 0209ED98 */ if (_t3) goto L_0209ED9C; else goto L_0209EDAC;
   L_0209ED9C: ; // 0x209ed9c
         /* 0209ED9C */ cpu->r[3] = 0x000001C8u;
         /* 0209EDA0 */ Gambit_fn_02801A78(cpu);
         /* 0209EDA4 */ cpu->r[31] = cpu->r[3];
-        /* 0209EDA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209EDA8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EDA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209EDA8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EDA8 */ _t5 = _t4 & 0x00000001u;
         /* 0209EDA8 */ if (_t5) goto L_0209F03C; else goto L_0209EDAC;
   L_0209EDAC: ; // 0x209edac
         /* 0209EDAC */ cpu->r[29] = cpu->r[31];
-        /* 0209EDAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0209EDAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0209EDB0 */ cpu->r[28] = 0x10110000u;
-        /* 0209EDB4 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EDB4 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EDB4 */ _t7 = _t6 & 0x00000001u;
         /* 0209EDB4 */ if (_t7) goto L_0209EDB8; else goto L_0209EDE4;
   L_0209EDB8: ; // 0x209edb8
         /* 0209EDB8 */ cpu->r[3] = 0x000001C8u;
         /* 0209EDBC */ Gambit_fn_02801A78(cpu);
         /* 0209EDC0 */ cpu->r[29] = cpu->r[3];
-        /* 0209EDC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0209EDC4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EDC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0209EDC4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EDC4 */ _t9 = _t8 & 0x00000001u;
         /* 0209EDC4 */ if (_t9) goto L_0209EDC8; else goto L_0209EDE4;
   L_0209EDC8: ; // 0x209edc8
@@ -19265,44 +19265,44 @@ void Gambit_fn_0209ED84(CPUState* cpu) {
         /* 0209EDE0 */ goto L_0209F03C;
   L_0209EDE4: ; // 0x209ede4
         /* 0209EDE4 */ cpu->r[27] = cpu->r[29];
-        /* 0209EDE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0209EDE8 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EDE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0209EDE8 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EDE8 */ _t15 = _t14 & 0x00000001u;
         /* 0209EDE8 */ if (_t15) goto L_0209EDEC; else goto L_0209EE1C;
   L_0209EDEC: ; // 0x209edec
         /* 0209EDEC */ cpu->r[3] = 0x0000010Cu;
         /* 0209EDF0 */ Gambit_fn_02801A78(cpu);
         /* 0209EDF4 */ cpu->r[27] = cpu->r[3];
-        /* 0209EDF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0209EDF8 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EDF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0209EDF8 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EDF8 */ _t17 = _t16 & 0x00000001u;
         /* 0209EDF8 */ if (_t17) goto L_0209EDFC; else goto L_0209EE1C;
   L_0209EDFC: ; // 0x209edfc
         /* 0209EDFC */ cpu->r[0] = 0x10010000u;
         /* 0209EE00 */ cpu->r[26] = cpu->r[29] + 0x0000010Cu;
-        /* 0209EE00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 0209EE00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 0209EE04 */ _t18 = cpu->r[28] + 0x0000739Au;
         /* 0209EE04 */ cpu->r[28] = rbrew_read16(cpu->mem, _t18);
         /* 0209EE08 */ cpu->r[0] = cpu->r[0] + 0x00002148u;
         /* 0209EE0C */ cpu->r[27] = 0x00000000u;
         /* 0209EE10 */ _t19 = cpu->r[29] + 0x00000004u;
         /* 0209EE10 */ rbrew_write32(cpu->mem, _t19, cpu->r[0]);
-        /* 0209EE14 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EE14 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EE14 */ _t21 = _t20 & 0x00000001u;
         /* 0209EE14 */ if (_t21) goto L_0209EEA0; else goto L_0209EE18;
   L_0209EE18: ; // 0x209ee18
         /* 0209EE18 */ goto L_0209EEB0;
   L_0209EE1C: ; // 0x209ee1c
         /* 0209EE1C */ cpu->r[3] = cpu->r[27];
-        /* 0209EE1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209EE20 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EE1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209EE20 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EE20 */ _t23 = _t22 & 0x00000001u;
         /* 0209EE20 */ if (_t23) goto L_0209EE24; else goto L_0209EE50;
   L_0209EE24: ; // 0x209ee24
         /* 0209EE24 */ cpu->r[3] = 0x0000000Cu;
         /* 0209EE28 */ Gambit_fn_02801A78(cpu);
-        /* 0209EE2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209EE30 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EE2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209EE30 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EE30 */ _t25 = _t24 & 0x00000001u;
         /* 0209EE30 */ if (_t25) goto L_0209EE34; else goto L_0209EE50;
   L_0209EE34: ; // 0x209ee34
@@ -19343,27 +19343,27 @@ void Gambit_fn_0209ED84(CPUState* cpu) {
   L_0209EE88: ; // 0x209ee88
         /* 0209EE88 */ cpu->r[0] = 0x10010000u;
         /* 0209EE8C */ cpu->r[26] = cpu->r[29] + 0x0000010Cu;
-        /* 0209EE8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 0209EE8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 0209EE90 */ cpu->r[0] = cpu->r[0] + 0x00002148u;
         /* 0209EE94 */ cpu->r[27] = 0x00000000u;
         /* 0209EE98 */ _t38 = cpu->r[29] + 0x00000004u;
         /* 0209EE98 */ rbrew_write32(cpu->mem, _t38, cpu->r[0]);
-        /* 0209EE9C */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EE9C */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EE9C */ _t40 = _t39 & 0x00000001u;
         /* 0209EE9C */ if (_t40) goto L_0209EEA0; else goto L_0209EEB0;
   L_0209EEA0: ; // 0x209eea0
         /* 0209EEA0 */ cpu->r[3] = 0x000000B4u;
         /* 0209EEA4 */ Gambit_fn_02801A78(cpu);
         /* 0209EEA8 */ cpu->r[26] = cpu->r[3];
-        /* 0209EEA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0209EEAC */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EEA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0209EEAC */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EEAC */ _t42 = _t41 & 0x00000001u;
         /* 0209EEAC */ if (_t42) goto L_0209F018; else goto L_0209EEB0;
   L_0209EEB0: ; // 0x209eeb0
         /* 0209EEB0 */ _t43 = cpu->r[26] + 0x00000000u;
         /* 0209EEB0 */ rbrew_write8(cpu->mem, _t43, (uint8_t)cpu->r[27]);
         /* 0209EEB4 */ cpu->r[21] = cpu->r[26] + 0x00000010u;
-        /* 0209EEB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
+        /* 0209EEB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
         /* 0209EEB8 */ cpu->r[23] = 0x10110000u;
         /* 0209EEBC */ _t44 = cpu->r[26] + 0x00000004u;
         /* 0209EEBC */ rbrew_write32(cpu->mem, _t44, cpu->r[27]);
@@ -19375,39 +19375,39 @@ void Gambit_fn_0209ED84(CPUState* cpu) {
         /* 0209EED0 */ cpu->r[25] = cpu->r[25] + 0x000020D0u;
         /* 0209EED4 */ _t46 = cpu->r[26] + 0x0000000Cu;
         /* 0209EED4 */ rbrew_write32(cpu->mem, _t46, cpu->r[27]);
-        /* 0209EED8 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EED8 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EED8 */ _t48 = _t47 & 0x00000001u;
         /* 0209EED8 */ if (_t48) goto L_0209EEDC; else goto L_0209EEFC;
   L_0209EEDC: ; // 0x209eedc
         /* 0209EEDC */ cpu->r[3] = 0x0000004Cu;
         /* 0209EEE0 */ Gambit_fn_02801A78(cpu);
         /* 0209EEE4 */ cpu->r[21] = cpu->r[3];
-        /* 0209EEE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 0209EEE8 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EEE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 0209EEE8 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EEE8 */ _t50 = _t49 & 0x00000001u;
         /* 0209EEE8 */ if (_t50) goto L_0209EEEC; else goto L_0209EEFC;
   L_0209EEEC: ; // 0x209eeec
         /* 0209EEEC */ cpu->r[21] = cpu->r[26] + 0x0000005Cu;
-        /* 0209EEEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
+        /* 0209EEEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
         /* 0209EEF0 */ _t51 = cpu->r[23] + 0x00007399u;
         /* 0209EEF0 */ cpu->r[23] = rbrew_read8(cpu->mem, _t51);
-        /* 0209EEF4 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EEF4 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EEF4 */ _t53 = _t52 & 0x00000001u;
         /* 0209EEF4 */ if (_t53) goto L_0209EEF8; else goto L_0209EF98;
   L_0209EEF8: ; // 0x209eef8
         /* 0209EEF8 */ goto L_0209EF88;
   L_0209EEFC: ; // 0x209eefc
         /* 0209EEFC */ cpu->r[22] = cpu->r[21];
-        /* 0209EEFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 0209EF00 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EEFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 0209EF00 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EF00 */ _t55 = _t54 & 0x00000001u;
         /* 0209EF00 */ if (_t55) goto L_0209EF04; else goto L_0209EF20;
   L_0209EF04: ; // 0x209ef04
         /* 0209EF04 */ cpu->r[3] = 0x0000004Cu;
         /* 0209EF08 */ Gambit_fn_02801A78(cpu);
         /* 0209EF0C */ cpu->r[22] = cpu->r[3];
-        /* 0209EF0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 0209EF10 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EF0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 0209EF10 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EF10 */ _t57 = _t56 & 0x00000001u;
         /* 0209EF10 */ if (_t57) goto L_0209EF14; else goto L_0209EF20;
   L_0209EF14: ; // 0x209ef14
@@ -19418,15 +19418,15 @@ void Gambit_fn_0209ED84(CPUState* cpu) {
         /* 0209EF1C */ goto L_0209EF80;
   L_0209EF20: ; // 0x209ef20
         /* 0209EF20 */ cpu->r[3] = cpu->r[22];
-        /* 0209EF20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209EF24 */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EF20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209EF24 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EF24 */ _t61 = _t60 & 0x00000001u;
         /* 0209EF24 */ if (_t61) goto L_0209EF28; else goto L_0209EF4C;
   L_0209EF28: ; // 0x209ef28
         /* 0209EF28 */ cpu->r[3] = 0x0000000Cu;
         /* 0209EF2C */ Gambit_fn_02801A78(cpu);
-        /* 0209EF30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209EF34 */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EF30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209EF34 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EF34 */ _t63 = _t62 & 0x00000001u;
         /* 0209EF34 */ if (_t63) goto L_0209EF38; else goto L_0209EF4C;
   L_0209EF38: ; // 0x209ef38
@@ -19465,43 +19465,43 @@ void Gambit_fn_0209ED84(CPUState* cpu) {
         /* 0209EF7C */ rbrew_write32(cpu->mem, _t76, cpu->r[24]);
   L_0209EF80: ; // 0x209ef80
         /* 0209EF80 */ cpu->r[21] = cpu->r[26] + 0x0000005Cu;
-        /* 0209EF80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 0209EF84 */ _t77 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EF80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 0209EF84 */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EF84 */ _t78 = _t77 & 0x00000001u;
         /* 0209EF84 */ if (_t78) goto L_0209EF88; else goto L_0209EF98;
   L_0209EF88: ; // 0x209ef88
         /* 0209EF88 */ cpu->r[3] = 0x0000004Cu;
         /* 0209EF8C */ Gambit_fn_02801A78(cpu);
         /* 0209EF90 */ cpu->r[21] = cpu->r[3];
-        /* 0209EF90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 0209EF94 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EF90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 0209EF94 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EF94 */ _t80 = _t79 & 0x00000001u;
         /* 0209EF94 */ if (_t80) goto L_0209EFF8; else goto L_0209EF98;
   L_0209EF98: ; // 0x209ef98
         /* 0209EF98 */ cpu->r[22] = cpu->r[21];
-        /* 0209EF98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 0209EF9C */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EF98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 0209EF9C */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EF9C */ _t82 = _t81 & 0x00000001u;
         /* 0209EF9C */ if (_t82) goto L_0209EFA0; else goto L_0209EFB0;
   L_0209EFA0: ; // 0x209efa0
         /* 0209EFA0 */ cpu->r[3] = 0x0000004Cu;
         /* 0209EFA4 */ Gambit_fn_02801A78(cpu);
         /* 0209EFA8 */ cpu->r[22] = cpu->r[3];
-        /* 0209EFA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 0209EFAC */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EFA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 0209EFAC */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EFAC */ _t84 = _t83 & 0x00000001u;
         /* 0209EFAC */ if (_t84) goto L_0209EFF4; else goto L_0209EFB0;
   L_0209EFB0: ; // 0x209efb0
         /* 0209EFB0 */ cpu->r[3] = cpu->r[22];
-        /* 0209EFB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209EFB4 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EFB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209EFB4 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EFB4 */ _t86 = _t85 & 0x00000001u;
         /* 0209EFB4 */ if (_t86) goto L_0209EFB8; else goto L_0209EFC8;
   L_0209EFB8: ; // 0x209efb8
         /* 0209EFB8 */ cpu->r[3] = 0x0000000Cu;
         /* 0209EFBC */ Gambit_fn_02801A78(cpu);
-        /* 0209EFC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209EFC4 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209EFC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209EFC4 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209EFC4 */ _t88 = _t87 & 0x00000001u;
         /* 0209EFC4 */ if (_t88) goto L_0209EFE8; else goto L_0209EFC8;
   L_0209EFC8: ; // 0x209efc8
@@ -19613,13 +19613,13 @@ void Gambit_fn_0209F054(CPUState* cpu) {
         /* 0209F0B8 */ _t9 = cpu->r[1] + 0x00000050u;
         /* 0209F0B8 */ rbrew_write32(cpu->mem, _t9, cpu->r[25]);
         /* 0209F0BC */ cpu->r[4] = 0x10010000u;
-        /* 0209F0C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000001u);
+        /* 0209F0C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000001u));
         /* 0209F0C4 */ _t10 = cpu->r[1] + 0x00000077u;
         /* 0209F0C4 */ rbrew_write8(cpu->mem, _t10, (uint8_t)cpu->r[31]);
         /* 0209F0C8 */ cpu->r[4] = cpu->r[4] + 0x00002188u;
         /* 0209F0CC */ _t11 = cpu->r[1] + 0x0000004Cu;
         /* 0209F0CC */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
-        /* 0209F0D0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F0D0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F0D0 */ _t13 = _t12 & 0x00000001u;
         /* 0209F0D0 */ if (_t13) goto L_0209F0D4; else goto L_0209F0DC;
   L_0209F0D4: ; // 0x209f0d4
@@ -19628,7 +19628,7 @@ void Gambit_fn_0209F054(CPUState* cpu) {
   L_0209F0DC: ; // 0x209f0dc
         /* 0209F0DC */ cpu->r[3] = cpu->r[1] + 0x0000004Cu;
         /* 0209F0E0 */ cpu->r[5] = cpu->r[30];
-        /* 0209F0E4 */ _t14 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209F0E4 */ _t14 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209F0E4 */ _t15 = _t14 & 0x00000001u;
         /* 0209F0E4 */ if (_t15) goto L_0209F0E8; // else: addr-0 trap, fall-through
   L_0209F0E8: ; // 0x209f0e8
@@ -19643,15 +19643,15 @@ void Gambit_fn_0209F054(CPUState* cpu) {
         /* 0209F104 */ cpu->r[4] = cpu->r[1] + 0x00000018u;
         /* 0209F108 */ _t17 = cpu->r[1] + 0x00000018u;
         /* 0209F108 */ rbrew_write32(cpu->mem, _t17, cpu->r[7]);
-        /* 0209F10C */ _t18 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209F10C */ _t18 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209F10C */ _t19 = _t18 & 0x00000001u;
         /* 0209F10C */ if (_t19) goto L_0209F110; // else: addr-0 trap, fall-through
   L_0209F110: ; // 0x209f110
         /* 0209F110 */ Gambit_fn_0209F6E8(cpu);
-        /* 0209F114 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0209F114 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0209F118 */ cpu->r[26] = 0x10110000u;
         /* 0209F11C */ cpu->r[29] = cpu->r[3];
-        /* 0209F120 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F120 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F120 */ _t21 = _t20 & 0x00000001u;
         /* 0209F120 */ if (_t21) goto L_0209F158; else goto L_0209F124;
   L_0209F124: ; // 0x209f124
@@ -19669,9 +19669,9 @@ void Gambit_fn_0209F054(CPUState* cpu) {
         /* 0209F140 */ _t26 = cpu->r[11] + 0x00000000u;
         /* 0209F140 */ cpu->r[5] = rbrew_read16(cpu->mem, _t26);
         /* 0209F144 */ cpu->r[12] = 0x00000000u;
-        /* 0209F148 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[31]);
+        /* 0209F148 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[31]));
         /* 0209F14C */ cpu->r[5] = 0x00080000u;
-        /* 0209F150 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F150 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F150 */ _t28 = _t27 & 0x00000001u;
         /* 0209F150 */ if (_t28) goto L_0209F154; else goto L_0209F548;
   L_0209F154: ; // 0x209f154
@@ -19682,10 +19682,10 @@ void Gambit_fn_0209F054(CPUState* cpu) {
         /* 0209F15C */ cpu->r[11] = rbrew_read32(cpu->mem, _t29);
         /* 0209F160 */ _t30 = cpu->r[28] + 0x00000000u;
         /* 0209F160 */ cpu->r[10] = rbrew_read32(cpu->mem, _t30);
-        /* 0209F164 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0209F164 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0209F168 */ cpu->r[30] = 0x101D0000u;
         /* 0209F16C */ cpu->r[21] = cpu->r[10] + 0x00000001u;
-        /* 0209F170 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F170 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F170 */ _t32 = _t31 & 0x00000001u;
         /* 0209F170 */ if (_t32) goto L_0209F174; else goto L_0209F194;
   L_0209F174: ; // 0x209f174
@@ -19703,9 +19703,9 @@ void Gambit_fn_0209F054(CPUState* cpu) {
         /* 0209F198 */ _t34 = cpu->r[7] + 0xFFFFD8ECu;
         /* 0209F198 */ cpu->r[0] = rbrew_read32(cpu->mem, _t34);
         /* 0209F198 */ cpu->r[7] = _t34;
-        /* 0209F19C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0209F19C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0209F1A0 */ cpu->r[28] = 0x101D0000u;
-        /* 0209F1A4 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F1A4 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F1A4 */ _t36 = _t35 & 0x00000001u;
         /* 0209F1A4 */ if (_t36) goto L_0209F1A8; else goto L_0209F1B8;
   L_0209F1A8: ; // 0x209f1a8
@@ -19716,8 +19716,8 @@ void Gambit_fn_0209F054(CPUState* cpu) {
         /* 0209F1B4 */ _t38 = cpu->r[28] + 0xFFFFE350u;
         /* 0209F1B4 */ rbrew_write32(cpu->mem, _t38, cpu->r[6]);
   L_0209F1B8: ; // 0x209f1b8
-        /* 0209F1B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[21], 0x00000004u);
-        /* 0209F1BC */ _t39 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209F1B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[21], 0x00000004u));
+        /* 0209F1BC */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209F1BC */ _t40 = _t39 & 0x00000001u;
         /* 0209F1BC */ if (_t40) goto L_0209F2C8; else goto L_0209F1C0;
   L_0209F1C0: ; // 0x209f1c0
@@ -19745,7 +19745,7 @@ void Gambit_fn_0209F054(CPUState* cpu) {
         /* 0209F1F4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t48);
         /* 0209F1F8 */ cpu->r[3] = cpu->r[1] + 0x00000020u;
         /* 0209F1FC */ cpu->r[4] = cpu->r[4] + 0x00002054u;
-        /* 0209F200 */ _t49 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209F200 */ _t49 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209F200 */ _t50 = _t49 & 0x00000001u;
         /* 0209F200 */ if (_t50) goto L_0209F204; // else: addr-0 trap, fall-through
   L_0209F204: ; // 0x209f204
@@ -19816,9 +19816,9 @@ void Gambit_fn_0209F054(CPUState* cpu) {
         /* 0209F2B0 */ _t72 = cpu->r[11] + 0x00000000u;
         /* 0209F2B0 */ cpu->r[5] = rbrew_read16(cpu->mem, _t72);
         /* 0209F2B4 */ cpu->r[28] = 0x00000000u;
-        /* 0209F2B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[31]);
+        /* 0209F2B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[31]));
         /* 0209F2BC */ cpu->r[6] = 0x00080000u;
-        /* 0209F2C0 */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F2C0 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F2C0 */ _t74 = _t73 & 0x00000001u;
         /* 0209F2C0 */ if (_t74) goto L_0209F2C4; else goto L_0209F41C;
   L_0209F2C4: ; // 0x209f2c4
@@ -19826,8 +19826,8 @@ void Gambit_fn_0209F054(CPUState* cpu) {
   L_0209F2C8: ; // 0x209f2c8
         /* 0209F2C8 */ _t75 = cpu->r[28] + 0xFFFFE350u;
         /* 0209F2C8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t75);
-        /* 0209F2CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209F2D0 */ _t76 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F2CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209F2D0 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F2D0 */ _t77 = _t76 & 0x00000001u;
         /* 0209F2D0 */ if (_t77) goto L_0209F2D4; else goto L_0209F314;
   L_0209F2D4: ; // 0x209f2d4
@@ -19836,8 +19836,8 @@ void Gambit_fn_0209F054(CPUState* cpu) {
         /* 0209F2DC */ Gambit_fn_02836FFC(cpu);
         /* 0209F2E0 */ _t78 = cpu->r[28] + 0xFFFFE350u;
         /* 0209F2E0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t78);
-        /* 0209F2E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0209F2E8 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F2E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0209F2E8 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F2E8 */ _t80 = _t79 & 0x00000001u;
         /* 0209F2E8 */ if (_t80) goto L_0209F2EC; else goto L_0209F308;
   L_0209F2EC: ; // 0x209f2ec
@@ -19881,7 +19881,7 @@ void Gambit_fn_0209F054(CPUState* cpu) {
         /* 0209F34C */ cpu->r[5] = rbrew_read32(cpu->mem, _t91);
         /* 0209F350 */ cpu->r[3] = cpu->r[1] + 0x00000020u;
         /* 0209F354 */ cpu->r[4] = cpu->r[4] + 0x00002054u;
-        /* 0209F358 */ _t92 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209F358 */ _t92 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209F358 */ _t93 = _t92 & 0x00000001u;
         /* 0209F358 */ if (_t93) goto L_0209F35C; // else: addr-0 trap, fall-through
   L_0209F35C: ; // 0x209f35c
@@ -19952,23 +19952,23 @@ void Gambit_fn_0209F054(CPUState* cpu) {
         /* 0209F408 */ _t115 = cpu->r[11] + 0x00000000u;
         /* 0209F408 */ cpu->r[5] = rbrew_read16(cpu->mem, _t115);
         /* 0209F40C */ cpu->r[28] = 0x00000000u;
-        /* 0209F410 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[31]);
+        /* 0209F410 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[31]));
         /* 0209F414 */ cpu->r[6] = 0x00080000u;
-        /* 0209F418 */ _t116 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F418 */ _t116 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F418 */ _t117 = _t116 & 0x00000001u;
         /* 0209F418 */ if (_t117) goto L_0209F440; else goto L_0209F41C;
   L_0209F41C: ; // 0x209f41c
         /* 0209F41C */ cpu->r[28] = cpu->r[28] + 0x00000001u;
-        /* 0209F420 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], cpu->r[6]);
+        /* 0209F420 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], cpu->r[6]));
         /* 0209F424 */ cpu->r[11] = cpu->r[11] + 0x00000002u;
-        /* 0209F428 */ _t118 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209F428 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209F428 */ _t119 = _t118 & 0x00000001u;
         /* 0209F428 */ if (_t119) goto L_0209F43C; else goto L_0209F42C;
   L_0209F42C: ; // 0x209f42c
         /* 0209F42C */ _t120 = cpu->r[11] + 0x00000000u;
         /* 0209F42C */ cpu->r[0] = rbrew_read16(cpu->mem, _t120);
-        /* 0209F430 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 0209F434 */ _t121 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F430 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 0209F434 */ _t121 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F434 */ _t122 = _t121 & 0x00000001u;
         /* 0209F434 */ if (_t122) goto L_0209F438; else goto L_0209F41C;
   L_0209F438: ; // 0x209f438
@@ -19976,22 +19976,22 @@ void Gambit_fn_0209F054(CPUState* cpu) {
   L_0209F43C: ; // 0x209f43c
         /* 0209F43C */ cpu->r[28] = 0x00000000u;
   L_0209F440: ; // 0x209f440
-        /* 0209F440 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 0209F444 */ _t123 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209F440 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 0209F444 */ _t123 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209F444 */ _t124 = _t123 & 0x00000001u;
         /* 0209F444 */ if (_t124) goto L_0209F448; else goto L_0209F458;
   L_0209F448: ; // 0x209f448
         /* 0209F448 */ cpu->r[7] = cpu->r[28] + cpu->r[25];
         /* 0209F44C */ cpu->r[25] = cpu->r[7] + 0x00000001u;
-        /* 0209F44C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 0209F450 */ _t125 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209F44C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 0209F450 */ _t125 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209F450 */ _t126 = _t125 & 0x00000001u;
         /* 0209F450 */ if (_t126) goto L_0209F454; else goto L_0209F458;
   L_0209F454: ; // 0x209f454
         /* 0209F454 */ cpu->r[25] = 0x00000000u;
   L_0209F458: ; // 0x209f458
-        /* 0209F458 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0209F45C */ _t127 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209F458 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0209F45C */ _t127 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209F45C */ _t128 = _t127 & 0x00000001u;
         /* 0209F45C */ if (_t128) goto L_0209F460; else goto L_0209F4B0;
   L_0209F460: ; // 0x209f460
@@ -20007,23 +20007,23 @@ void Gambit_fn_0209F054(CPUState* cpu) {
         /* 0209F478 */ _t132 = cpu->r[7] + 0x00000000u;
         /* 0209F478 */ cpu->r[0] = rbrew_read16(cpu->mem, _t132);
         /* 0209F47C */ cpu->r[30] = 0x00000000u;
-        /* 0209F480 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 0209F480 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 0209F484 */ cpu->r[10] = 0x00080000u;
-        /* 0209F488 */ _t133 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F488 */ _t133 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F488 */ _t134 = _t133 & 0x00000001u;
         /* 0209F488 */ if (_t134) goto L_0209F4B0; else goto L_0209F48C;
   L_0209F48C: ; // 0x209f48c
         /* 0209F48C */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0209F490 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[10]);
+        /* 0209F490 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[10]));
         /* 0209F494 */ cpu->r[7] = cpu->r[7] + 0x00000002u;
-        /* 0209F498 */ _t135 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209F498 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209F498 */ _t136 = _t135 & 0x00000001u;
         /* 0209F498 */ if (_t136) goto L_0209F4AC; else goto L_0209F49C;
   L_0209F49C: ; // 0x209f49c
         /* 0209F49C */ _t137 = cpu->r[7] + 0x00000000u;
         /* 0209F49C */ cpu->r[0] = rbrew_read16(cpu->mem, _t137);
-        /* 0209F4A0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 0209F4A4 */ _t138 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F4A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 0209F4A4 */ _t138 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F4A4 */ _t139 = _t138 & 0x00000001u;
         /* 0209F4A4 */ if (_t139) goto L_0209F4A8; else goto L_0209F48C;
   L_0209F4A8: ; // 0x209f4a8
@@ -20034,15 +20034,15 @@ void Gambit_fn_0209F054(CPUState* cpu) {
         /* 0209F4B0 */ _t140 = cpu->r[27] + 0x00000008u;
         /* 0209F4B0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t140);
         /* 0209F4B4 */ cpu->r[11] = cpu->r[0] - cpu->r[25];
-        /* 0209F4B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[11]);
-        /* 0209F4BC */ _t141 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209F4B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[11]));
+        /* 0209F4BC */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209F4BC */ _t142 = _t141 & 0x00000001u;
         /* 0209F4BC */ if (_t142) goto L_0209F4C4; else goto L_0209F4C0;
   L_0209F4C0: ; // 0x209f4c0
         /* 0209F4C0 */ cpu->r[30] = cpu->r[11] + 0xFFFFFFFFu;
   L_0209F4C4: ; // 0x209f4c4
-        /* 0209F4C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0209F4C8 */ _t143 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209F4C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0209F4C8 */ _t143 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209F4C8 */ _t144 = _t143 & 0x00000001u;
         /* 0209F4C8 */ if (_t144) goto L_0209F4CC; else goto L_0209F51C;
   L_0209F4CC: ; // 0x209f4cc
@@ -20062,8 +20062,8 @@ void Gambit_fn_0209F054(CPUState* cpu) {
         /* 0209F4F4 */ cpu->r[3] = cpu->r[26];
         /* 0209F4F8 */ rbrew_dispatch(cpu, 0x02d0a6e8u);
         /* 0209F4FC */ cpu->r[10] = cpu->r[25] + cpu->r[30];
-        /* 0209F500 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], cpu->r[28]);
-        /* 0209F504 */ _t148 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209F500 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], cpu->r[28]));
+        /* 0209F504 */ _t148 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209F504 */ _t149 = _t148 & 0x00000001u;
         /* 0209F504 */ if (_t149) goto L_0209F508; else goto L_0209F510;
   L_0209F508: ; // 0x209f508
@@ -20089,23 +20089,23 @@ void Gambit_fn_0209F054(CPUState* cpu) {
         /* 0209F534 */ _t156 = cpu->r[11] + 0x00000000u;
         /* 0209F534 */ cpu->r[5] = rbrew_read16(cpu->mem, _t156);
         /* 0209F538 */ cpu->r[12] = 0x00000000u;
-        /* 0209F53C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[31]);
+        /* 0209F53C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[31]));
         /* 0209F540 */ cpu->r[5] = 0x00080000u;
-        /* 0209F544 */ _t157 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F544 */ _t157 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F544 */ _t158 = _t157 & 0x00000001u;
         /* 0209F544 */ if (_t158) goto L_0209F56C; else goto L_0209F548;
   L_0209F548: ; // 0x209f548
         /* 0209F548 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 0209F54C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[5]);
+        /* 0209F54C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[5]));
         /* 0209F550 */ cpu->r[11] = cpu->r[11] + 0x00000002u;
-        /* 0209F554 */ _t159 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209F554 */ _t159 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209F554 */ _t160 = _t159 & 0x00000001u;
         /* 0209F554 */ if (_t160) goto L_0209F568; else goto L_0209F558;
   L_0209F558: ; // 0x209f558
         /* 0209F558 */ _t161 = cpu->r[11] + 0x00000000u;
         /* 0209F558 */ cpu->r[0] = rbrew_read16(cpu->mem, _t161);
-        /* 0209F55C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 0209F560 */ _t162 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F55C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 0209F560 */ _t162 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F560 */ _t163 = _t162 & 0x00000001u;
         /* 0209F560 */ if (_t163) goto L_0209F564; else goto L_0209F548;
   L_0209F564: ; // 0x209f564
@@ -20290,15 +20290,15 @@ void Gambit_fn_0209F62C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209F62C: ; // 0x209f62c
-        /* 0209F62C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209F630 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F62C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209F630 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F630 */ _t1 = _t0 & 0x00000001u;
         /* 0209F630 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209F630 */ goto L_0209F634;
   L_0209F634: ; // 0x209f634
         /* 0209F634 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209F634 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209F638 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F634 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209F638 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F638 */ _t3 = _t2 & 0x00000001u;
         /* 0209F638 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209F638 */ goto L_0209F63C;
@@ -20317,8 +20317,8 @@ void Gambit_fn_0209F62C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -20332,15 +20332,15 @@ void Gambit_fn_0209F62C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -20374,15 +20374,15 @@ void Gambit_fn_0209F644(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209F644: ; // 0x209f644
-        /* 0209F644 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209F648 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F644 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209F648 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F648 */ _t1 = _t0 & 0x00000001u;
         /* 0209F648 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209F648 */ goto L_0209F64C;
   L_0209F64C: ; // 0x209f64c
         /* 0209F64C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209F64C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209F650 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F64C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209F650 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F650 */ _t3 = _t2 & 0x00000001u;
         /* 0209F650 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209F650 */ goto L_0209F654;
@@ -20401,8 +20401,8 @@ void Gambit_fn_0209F644(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -20416,15 +20416,15 @@ void Gambit_fn_0209F644(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -20495,15 +20495,15 @@ void Gambit_fn_0209F698(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209F698: ; // 0x209f698
-        /* 0209F698 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209F69C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F698 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209F69C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F69C */ _t1 = _t0 & 0x00000001u;
         /* 0209F69C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209F69C */ goto L_0209F6A0;
   L_0209F6A0: ; // 0x209f6a0
         /* 0209F6A0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209F6A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209F6A4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F6A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209F6A4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F6A4 */ _t3 = _t2 & 0x00000001u;
         /* 0209F6A4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209F6A4 */ goto L_0209F6A8;
@@ -20522,8 +20522,8 @@ void Gambit_fn_0209F698(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -20537,15 +20537,15 @@ void Gambit_fn_0209F698(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -20573,15 +20573,15 @@ void Gambit_fn_0209F6AC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209F6AC: ; // 0x209f6ac
-        /* 0209F6AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209F6B0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F6AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209F6B0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F6B0 */ _t1 = _t0 & 0x00000001u;
         /* 0209F6B0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209F6B0 */ goto L_0209F6B4;
   L_0209F6B4: ; // 0x209f6b4
         /* 0209F6B4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209F6B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209F6B8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F6B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209F6B8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F6B8 */ _t3 = _t2 & 0x00000001u;
         /* 0209F6B8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209F6B8 */ goto L_0209F6BC;
@@ -20600,8 +20600,8 @@ void Gambit_fn_0209F6AC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -20615,15 +20615,15 @@ void Gambit_fn_0209F6AC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -20651,15 +20651,15 @@ void Gambit_fn_0209F6C0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209F6C0: ; // 0x209f6c0
-        /* 0209F6C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209F6C4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F6C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209F6C4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F6C4 */ _t1 = _t0 & 0x00000001u;
         /* 0209F6C4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209F6C4 */ goto L_0209F6C8;
   L_0209F6C8: ; // 0x209f6c8
         /* 0209F6C8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209F6C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209F6CC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F6C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209F6CC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F6CC */ _t3 = _t2 & 0x00000001u;
         /* 0209F6CC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209F6CC */ goto L_0209F6D0;
@@ -20678,8 +20678,8 @@ void Gambit_fn_0209F6C0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -20693,15 +20693,15 @@ void Gambit_fn_0209F6C0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -20729,15 +20729,15 @@ void Gambit_fn_0209F6D4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0209F6D4: ; // 0x209f6d4
-        /* 0209F6D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209F6D8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F6D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209F6D8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F6D8 */ _t1 = _t0 & 0x00000001u;
         /* 0209F6D8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209F6D8 */ goto L_0209F6DC;
   L_0209F6DC: ; // 0x209f6dc
         /* 0209F6DC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0209F6DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209F6E0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F6DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209F6E0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F6E0 */ _t3 = _t2 & 0x00000001u;
         /* 0209F6E0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0209F6E0 */ goto L_0209F6E4;
@@ -20756,8 +20756,8 @@ void Gambit_fn_0209F6D4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -20771,15 +20771,15 @@ void Gambit_fn_0209F6D4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -20830,7 +20830,7 @@ void Gambit_fn_0209F6E8(CPUState* cpu) {
         /* 0209F710 */ rbrew_write32(cpu->mem, _t8, cpu->r[10]);
         /* 0209F714 */ _t9 = cpu->r[1] + 0x00000034u;
         /* 0209F714 */ rbrew_write32(cpu->mem, _t9, cpu->r[6]);
-        /* 0209F718 */ _t10 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209F718 */ _t10 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209F718 */ _t11 = _t10 & 0x00000001u;
         /* 0209F718 */ if (_t11) goto L_0209F71C; else goto L_0209F73C;
   L_0209F71C: ; // 0x209f71c
@@ -20872,8 +20872,8 @@ void Gambit_fn_0209F6E8(CPUState* cpu) {
         /* 0209F774 */ Gambit_fn_027FD390(cpu);
         /* 0209F778 */ _t24 = cpu->r[28] + 0x0000010Cu;
         /* 0209F778 */ cpu->r[11] = rbrew_read8(cpu->mem, _t24);
-        /* 0209F77C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209F780 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F77C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209F780 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F780 */ _t26 = _t25 & 0x00000001u;
         /* 0209F780 */ if (_t26) goto L_0209F784; else goto L_0209F78C;
   L_0209F784: ; // 0x209f784
@@ -20946,23 +20946,23 @@ void Gambit_fn_0209F6E8(CPUState* cpu) {
         /* 0209F834 */ _t48 = cpu->r[5] + 0x00000000u;
         /* 0209F834 */ cpu->r[0] = rbrew_read16(cpu->mem, _t48);
         /* 0209F838 */ cpu->r[30] = 0x00000000u;
-        /* 0209F83C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 0209F83C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 0209F840 */ cpu->r[0] = 0x00080000u;
-        /* 0209F844 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F844 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F844 */ _t50 = _t49 & 0x00000001u;
         /* 0209F844 */ if (_t50) goto L_0209F86C; else goto L_0209F848;
   L_0209F848: ; // 0x209f848
         /* 0209F848 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0209F84C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 0209F84C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 0209F850 */ cpu->r[5] = cpu->r[5] + 0x00000002u;
-        /* 0209F854 */ _t51 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209F854 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209F854 */ _t52 = _t51 & 0x00000001u;
         /* 0209F854 */ if (_t52) goto L_0209F868; else goto L_0209F858;
   L_0209F858: ; // 0x209f858
         /* 0209F858 */ _t53 = cpu->r[5] + 0x00000000u;
         /* 0209F858 */ cpu->r[6] = rbrew_read16(cpu->mem, _t53);
-        /* 0209F85C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[31]);
-        /* 0209F860 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F85C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[31]));
+        /* 0209F860 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F860 */ _t55 = _t54 & 0x00000001u;
         /* 0209F860 */ if (_t55) goto L_0209F864; else goto L_0209F848;
   L_0209F864: ; // 0x209f864
@@ -20970,22 +20970,22 @@ void Gambit_fn_0209F6E8(CPUState* cpu) {
   L_0209F868: ; // 0x209f868
         /* 0209F868 */ cpu->r[30] = 0x00000000u;
   L_0209F86C: ; // 0x209f86c
-        /* 0209F86C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0209F870 */ _t56 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209F86C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0209F870 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209F870 */ _t57 = _t56 & 0x00000001u;
         /* 0209F870 */ if (_t57) goto L_0209F874; else goto L_0209F884;
   L_0209F874: ; // 0x209f874
         /* 0209F874 */ cpu->r[7] = cpu->r[30] + cpu->r[26];
         /* 0209F878 */ cpu->r[26] = cpu->r[7] + 0x00000001u;
-        /* 0209F878 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0209F87C */ _t58 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209F878 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0209F87C */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209F87C */ _t59 = _t58 & 0x00000001u;
         /* 0209F87C */ if (_t59) goto L_0209F880; else goto L_0209F884;
   L_0209F880: ; // 0x209f880
         /* 0209F880 */ cpu->r[26] = 0x00000000u;
   L_0209F884: ; // 0x209f884
-        /* 0209F884 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0209F888 */ _t60 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209F884 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0209F888 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209F888 */ _t61 = _t60 & 0x00000001u;
         /* 0209F888 */ if (_t61) goto L_0209F88C; else goto L_0209F8DC;
   L_0209F88C: ; // 0x209f88c
@@ -21001,23 +21001,23 @@ void Gambit_fn_0209F6E8(CPUState* cpu) {
         /* 0209F8A4 */ _t65 = cpu->r[12] + 0x00000000u;
         /* 0209F8A4 */ cpu->r[0] = rbrew_read16(cpu->mem, _t65);
         /* 0209F8A8 */ cpu->r[29] = 0x00000000u;
-        /* 0209F8AC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 0209F8AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 0209F8B0 */ cpu->r[0] = 0x00080000u;
-        /* 0209F8B4 */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F8B4 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F8B4 */ _t67 = _t66 & 0x00000001u;
         /* 0209F8B4 */ if (_t67) goto L_0209F8DC; else goto L_0209F8B8;
   L_0209F8B8: ; // 0x209f8b8
         /* 0209F8B8 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 0209F8BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[0]);
+        /* 0209F8BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[0]));
         /* 0209F8C0 */ cpu->r[12] = cpu->r[12] + 0x00000002u;
-        /* 0209F8C4 */ _t68 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209F8C4 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209F8C4 */ _t69 = _t68 & 0x00000001u;
         /* 0209F8C4 */ if (_t69) goto L_0209F8D8; else goto L_0209F8C8;
   L_0209F8C8: ; // 0x209f8c8
         /* 0209F8C8 */ _t70 = cpu->r[12] + 0x00000000u;
         /* 0209F8C8 */ cpu->r[11] = rbrew_read16(cpu->mem, _t70);
-        /* 0209F8CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[31]);
-        /* 0209F8D0 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F8CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[31]));
+        /* 0209F8D0 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F8D0 */ _t72 = _t71 & 0x00000001u;
         /* 0209F8D0 */ if (_t72) goto L_0209F8D4; else goto L_0209F8B8;
   L_0209F8D4: ; // 0x209f8d4
@@ -21028,15 +21028,15 @@ void Gambit_fn_0209F6E8(CPUState* cpu) {
         /* 0209F8DC */ _t73 = cpu->r[28] + 0x00000008u;
         /* 0209F8DC */ cpu->r[0] = rbrew_read32(cpu->mem, _t73);
         /* 0209F8E0 */ cpu->r[7] = cpu->r[0] - cpu->r[26];
-        /* 0209F8E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[7]);
-        /* 0209F8E8 */ _t74 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209F8E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[7]));
+        /* 0209F8E8 */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209F8E8 */ _t75 = _t74 & 0x00000001u;
         /* 0209F8E8 */ if (_t75) goto L_0209F8F0; else goto L_0209F8EC;
   L_0209F8EC: ; // 0x209f8ec
         /* 0209F8EC */ cpu->r[29] = cpu->r[7] + 0xFFFFFFFFu;
   L_0209F8F0: ; // 0x209f8f0
-        /* 0209F8F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0209F8F4 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209F8F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0209F8F4 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209F8F4 */ _t77 = _t76 & 0x00000001u;
         /* 0209F8F4 */ if (_t77) goto L_0209F900; else goto L_0209F8F8;
   L_0209F8F8: ; // 0x209f8f8
@@ -21059,8 +21059,8 @@ void Gambit_fn_0209F6E8(CPUState* cpu) {
         /* 0209F928 */ cpu->r[3] = cpu->r[25];
         /* 0209F92C */ rbrew_dispatch(cpu, 0x02d0a6e8u);
         /* 0209F930 */ cpu->r[0] = cpu->r[26] + cpu->r[29];
-        /* 0209F934 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[30]);
-        /* 0209F938 */ _t81 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209F934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[30]));
+        /* 0209F938 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209F938 */ _t82 = _t81 & 0x00000001u;
         /* 0209F938 */ if (_t82) goto L_0209F93C; else goto L_0209F944;
   L_0209F93C: ; // 0x209f93c
@@ -21110,7 +21110,7 @@ void Gambit_fn_0209F6EC(CPUState* cpu) {
         /* 0209F710 */ rbrew_write32(cpu->mem, _t8, cpu->r[10]);
         /* 0209F714 */ _t9 = cpu->r[1] + 0x00000034u;
         /* 0209F714 */ rbrew_write32(cpu->mem, _t9, cpu->r[6]);
-        /* 0209F718 */ _t10 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209F718 */ _t10 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209F718 */ _t11 = _t10 & 0x00000001u;
         /* 0209F718 */ if (_t11) goto L_0209F71C; else goto L_0209F73C;
   L_0209F71C: ; // 0x209f71c
@@ -21152,8 +21152,8 @@ void Gambit_fn_0209F6EC(CPUState* cpu) {
         /* 0209F774 */ Gambit_fn_027FD390(cpu);
         /* 0209F778 */ _t24 = cpu->r[28] + 0x0000010Cu;
         /* 0209F778 */ cpu->r[11] = rbrew_read8(cpu->mem, _t24);
-        /* 0209F77C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0209F780 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F77C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0209F780 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F780 */ _t26 = _t25 & 0x00000001u;
         /* 0209F780 */ if (_t26) goto L_0209F784; else goto L_0209F78C;
   L_0209F784: ; // 0x209f784
@@ -21226,23 +21226,23 @@ void Gambit_fn_0209F6EC(CPUState* cpu) {
         /* 0209F834 */ _t48 = cpu->r[5] + 0x00000000u;
         /* 0209F834 */ cpu->r[0] = rbrew_read16(cpu->mem, _t48);
         /* 0209F838 */ cpu->r[30] = 0x00000000u;
-        /* 0209F83C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 0209F83C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 0209F840 */ cpu->r[0] = 0x00080000u;
-        /* 0209F844 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F844 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F844 */ _t50 = _t49 & 0x00000001u;
         /* 0209F844 */ if (_t50) goto L_0209F86C; else goto L_0209F848;
   L_0209F848: ; // 0x209f848
         /* 0209F848 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0209F84C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 0209F84C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 0209F850 */ cpu->r[5] = cpu->r[5] + 0x00000002u;
-        /* 0209F854 */ _t51 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209F854 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209F854 */ _t52 = _t51 & 0x00000001u;
         /* 0209F854 */ if (_t52) goto L_0209F868; else goto L_0209F858;
   L_0209F858: ; // 0x209f858
         /* 0209F858 */ _t53 = cpu->r[5] + 0x00000000u;
         /* 0209F858 */ cpu->r[6] = rbrew_read16(cpu->mem, _t53);
-        /* 0209F85C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[31]);
-        /* 0209F860 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F85C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[31]));
+        /* 0209F860 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F860 */ _t55 = _t54 & 0x00000001u;
         /* 0209F860 */ if (_t55) goto L_0209F864; else goto L_0209F848;
   L_0209F864: ; // 0x209f864
@@ -21250,22 +21250,22 @@ void Gambit_fn_0209F6EC(CPUState* cpu) {
   L_0209F868: ; // 0x209f868
         /* 0209F868 */ cpu->r[30] = 0x00000000u;
   L_0209F86C: ; // 0x209f86c
-        /* 0209F86C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0209F870 */ _t56 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209F86C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0209F870 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209F870 */ _t57 = _t56 & 0x00000001u;
         /* 0209F870 */ if (_t57) goto L_0209F874; else goto L_0209F884;
   L_0209F874: ; // 0x209f874
         /* 0209F874 */ cpu->r[7] = cpu->r[30] + cpu->r[26];
         /* 0209F878 */ cpu->r[26] = cpu->r[7] + 0x00000001u;
-        /* 0209F878 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0209F87C */ _t58 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209F878 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0209F87C */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209F87C */ _t59 = _t58 & 0x00000001u;
         /* 0209F87C */ if (_t59) goto L_0209F880; else goto L_0209F884;
   L_0209F880: ; // 0x209f880
         /* 0209F880 */ cpu->r[26] = 0x00000000u;
   L_0209F884: ; // 0x209f884
-        /* 0209F884 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0209F888 */ _t60 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209F884 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0209F888 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209F888 */ _t61 = _t60 & 0x00000001u;
         /* 0209F888 */ if (_t61) goto L_0209F88C; else goto L_0209F8DC;
   L_0209F88C: ; // 0x209f88c
@@ -21281,23 +21281,23 @@ void Gambit_fn_0209F6EC(CPUState* cpu) {
         /* 0209F8A4 */ _t65 = cpu->r[12] + 0x00000000u;
         /* 0209F8A4 */ cpu->r[0] = rbrew_read16(cpu->mem, _t65);
         /* 0209F8A8 */ cpu->r[29] = 0x00000000u;
-        /* 0209F8AC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 0209F8AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 0209F8B0 */ cpu->r[0] = 0x00080000u;
-        /* 0209F8B4 */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F8B4 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F8B4 */ _t67 = _t66 & 0x00000001u;
         /* 0209F8B4 */ if (_t67) goto L_0209F8DC; else goto L_0209F8B8;
   L_0209F8B8: ; // 0x209f8b8
         /* 0209F8B8 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 0209F8BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[0]);
+        /* 0209F8BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[0]));
         /* 0209F8C0 */ cpu->r[12] = cpu->r[12] + 0x00000002u;
-        /* 0209F8C4 */ _t68 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209F8C4 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209F8C4 */ _t69 = _t68 & 0x00000001u;
         /* 0209F8C4 */ if (_t69) goto L_0209F8D8; else goto L_0209F8C8;
   L_0209F8C8: ; // 0x209f8c8
         /* 0209F8C8 */ _t70 = cpu->r[12] + 0x00000000u;
         /* 0209F8C8 */ cpu->r[11] = rbrew_read16(cpu->mem, _t70);
-        /* 0209F8CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[31]);
-        /* 0209F8D0 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F8CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[31]));
+        /* 0209F8D0 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F8D0 */ _t72 = _t71 & 0x00000001u;
         /* 0209F8D0 */ if (_t72) goto L_0209F8D4; else goto L_0209F8B8;
   L_0209F8D4: ; // 0x209f8d4
@@ -21308,15 +21308,15 @@ void Gambit_fn_0209F6EC(CPUState* cpu) {
         /* 0209F8DC */ _t73 = cpu->r[28] + 0x00000008u;
         /* 0209F8DC */ cpu->r[0] = rbrew_read32(cpu->mem, _t73);
         /* 0209F8E0 */ cpu->r[7] = cpu->r[0] - cpu->r[26];
-        /* 0209F8E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[7]);
-        /* 0209F8E8 */ _t74 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209F8E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[7]));
+        /* 0209F8E8 */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209F8E8 */ _t75 = _t74 & 0x00000001u;
         /* 0209F8E8 */ if (_t75) goto L_0209F8F0; else goto L_0209F8EC;
   L_0209F8EC: ; // 0x209f8ec
         /* 0209F8EC */ cpu->r[29] = cpu->r[7] + 0xFFFFFFFFu;
   L_0209F8F0: ; // 0x209f8f0
-        /* 0209F8F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0209F8F4 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209F8F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0209F8F4 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209F8F4 */ _t77 = _t76 & 0x00000001u;
         /* 0209F8F4 */ if (_t77) goto L_0209F900; else goto L_0209F8F8;
   L_0209F8F8: ; // 0x209f8f8
@@ -21339,8 +21339,8 @@ void Gambit_fn_0209F6EC(CPUState* cpu) {
         /* 0209F928 */ cpu->r[3] = cpu->r[25];
         /* 0209F92C */ rbrew_dispatch(cpu, 0x02d0a6e8u);
         /* 0209F930 */ cpu->r[0] = cpu->r[26] + cpu->r[29];
-        /* 0209F934 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[30]);
-        /* 0209F938 */ _t81 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209F934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[30]));
+        /* 0209F938 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209F938 */ _t82 = _t81 & 0x00000001u;
         /* 0209F938 */ if (_t82) goto L_0209F93C; else goto L_0209F944;
   L_0209F93C: ; // 0x209f93c
@@ -21388,23 +21388,23 @@ void Gambit_fn_0209F80C(CPUState* cpu) {
         /* 0209F834 */ _t7 = cpu->r[5] + 0x00000000u;
         /* 0209F834 */ cpu->r[0] = rbrew_read16(cpu->mem, _t7);
         /* 0209F838 */ cpu->r[30] = 0x00000000u;
-        /* 0209F83C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 0209F83C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 0209F840 */ cpu->r[0] = 0x00080000u;
-        /* 0209F844 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F844 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F844 */ _t9 = _t8 & 0x00000001u;
         /* 0209F844 */ if (_t9) goto L_0209F86C; else goto L_0209F848;
   L_0209F848: ; // 0x209f848
         /* 0209F848 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0209F84C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 0209F84C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 0209F850 */ cpu->r[5] = cpu->r[5] + 0x00000002u;
-        /* 0209F854 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209F854 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209F854 */ _t11 = _t10 & 0x00000001u;
         /* 0209F854 */ if (_t11) goto L_0209F868; else goto L_0209F858;
   L_0209F858: ; // 0x209f858
         /* 0209F858 */ _t12 = cpu->r[5] + 0x00000000u;
         /* 0209F858 */ cpu->r[6] = rbrew_read16(cpu->mem, _t12);
-        /* 0209F85C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[31]);
-        /* 0209F860 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F85C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[31]));
+        /* 0209F860 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F860 */ _t14 = _t13 & 0x00000001u;
         /* 0209F860 */ if (_t14) goto L_0209F864; else goto L_0209F848;
   L_0209F864: ; // 0x209f864
@@ -21412,22 +21412,22 @@ void Gambit_fn_0209F80C(CPUState* cpu) {
   L_0209F868: ; // 0x209f868
         /* 0209F868 */ cpu->r[30] = 0x00000000u;
   L_0209F86C: ; // 0x209f86c
-        /* 0209F86C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0209F870 */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209F86C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0209F870 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209F870 */ _t16 = _t15 & 0x00000001u;
         /* 0209F870 */ if (_t16) goto L_0209F874; else goto L_0209F884;
   L_0209F874: ; // 0x209f874
         /* 0209F874 */ cpu->r[7] = cpu->r[30] + cpu->r[26];
         /* 0209F878 */ cpu->r[26] = cpu->r[7] + 0x00000001u;
-        /* 0209F878 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0209F87C */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209F878 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0209F87C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209F87C */ _t18 = _t17 & 0x00000001u;
         /* 0209F87C */ if (_t18) goto L_0209F880; else goto L_0209F884;
   L_0209F880: ; // 0x209f880
         /* 0209F880 */ cpu->r[26] = 0x00000000u;
   L_0209F884: ; // 0x209f884
-        /* 0209F884 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0209F888 */ _t19 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209F884 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0209F888 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209F888 */ _t20 = _t19 & 0x00000001u;
         /* 0209F888 */ if (_t20) goto L_0209F88C; else goto L_0209F8DC;
   L_0209F88C: ; // 0x209f88c
@@ -21443,23 +21443,23 @@ void Gambit_fn_0209F80C(CPUState* cpu) {
         /* 0209F8A4 */ _t24 = cpu->r[12] + 0x00000000u;
         /* 0209F8A4 */ cpu->r[0] = rbrew_read16(cpu->mem, _t24);
         /* 0209F8A8 */ cpu->r[29] = 0x00000000u;
-        /* 0209F8AC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 0209F8AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 0209F8B0 */ cpu->r[0] = 0x00080000u;
-        /* 0209F8B4 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F8B4 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F8B4 */ _t26 = _t25 & 0x00000001u;
         /* 0209F8B4 */ if (_t26) goto L_0209F8DC; else goto L_0209F8B8;
   L_0209F8B8: ; // 0x209f8b8
         /* 0209F8B8 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 0209F8BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[0]);
+        /* 0209F8BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[0]));
         /* 0209F8C0 */ cpu->r[12] = cpu->r[12] + 0x00000002u;
-        /* 0209F8C4 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209F8C4 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209F8C4 */ _t28 = _t27 & 0x00000001u;
         /* 0209F8C4 */ if (_t28) goto L_0209F8D8; else goto L_0209F8C8;
   L_0209F8C8: ; // 0x209f8c8
         /* 0209F8C8 */ _t29 = cpu->r[12] + 0x00000000u;
         /* 0209F8C8 */ cpu->r[11] = rbrew_read16(cpu->mem, _t29);
-        /* 0209F8CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[31]);
-        /* 0209F8D0 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F8CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[31]));
+        /* 0209F8D0 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F8D0 */ _t31 = _t30 & 0x00000001u;
         /* 0209F8D0 */ if (_t31) goto L_0209F8D4; else goto L_0209F8B8;
   L_0209F8D4: ; // 0x209f8d4
@@ -21470,15 +21470,15 @@ void Gambit_fn_0209F80C(CPUState* cpu) {
         /* 0209F8DC */ _t32 = cpu->r[28] + 0x00000008u;
         /* 0209F8DC */ cpu->r[0] = rbrew_read32(cpu->mem, _t32);
         /* 0209F8E0 */ cpu->r[7] = cpu->r[0] - cpu->r[26];
-        /* 0209F8E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[7]);
-        /* 0209F8E8 */ _t33 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209F8E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[7]));
+        /* 0209F8E8 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209F8E8 */ _t34 = _t33 & 0x00000001u;
         /* 0209F8E8 */ if (_t34) goto L_0209F8F0; else goto L_0209F8EC;
   L_0209F8EC: ; // 0x209f8ec
         /* 0209F8EC */ cpu->r[29] = cpu->r[7] + 0xFFFFFFFFu;
   L_0209F8F0: ; // 0x209f8f0
-        /* 0209F8F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0209F8F4 */ _t35 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209F8F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0209F8F4 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209F8F4 */ _t36 = _t35 & 0x00000001u;
         /* 0209F8F4 */ if (_t36) goto L_0209F900; else goto L_0209F8F8;
   L_0209F8F8: ; // 0x209f8f8
@@ -21501,8 +21501,8 @@ void Gambit_fn_0209F80C(CPUState* cpu) {
         /* 0209F928 */ cpu->r[3] = cpu->r[25];
         /* 0209F92C */ rbrew_dispatch(cpu, 0x02d0a6e8u);
         /* 0209F930 */ cpu->r[0] = cpu->r[26] + cpu->r[29];
-        /* 0209F934 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[30]);
-        /* 0209F938 */ _t40 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209F934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[30]));
+        /* 0209F938 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209F938 */ _t41 = _t40 & 0x00000001u;
         /* 0209F938 */ if (_t41) goto L_0209F93C; else goto L_0209F944;
   L_0209F93C: ; // 0x209f93c
@@ -21538,32 +21538,32 @@ void Gambit_fn_0209F968(CPUState* cpu) {
         /* 0209F970 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 0209F974 */ /* nop */
         /* 0209F978 */ cpu->r[31] = cpu->r[3];
-        /* 0209F978 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209F978 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209F97C */ cpu->r[30] = cpu->r[4];
-        /* 0209F980 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F980 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F980 */ _t3 = _t2 & 0x00000001u;
         /* 0209F980 */ if (_t3) goto L_0209F984; else goto L_0209F994;
   L_0209F984: ; // 0x209f984
         /* 0209F984 */ cpu->r[3] = 0x000001C8u;
         /* 0209F988 */ Gambit_fn_02801A78(cpu);
         /* 0209F98C */ cpu->r[31] = cpu->r[3];
-        /* 0209F98C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209F990 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F98C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209F990 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F990 */ _t5 = _t4 & 0x00000001u;
         /* 0209F990 */ if (_t5) goto L_0209FC24; else goto L_0209F994;
   L_0209F994: ; // 0x209f994
         /* 0209F994 */ cpu->r[29] = cpu->r[31];
-        /* 0209F994 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0209F994 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0209F998 */ cpu->r[28] = 0x10110000u;
-        /* 0209F99C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F99C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F99C */ _t7 = _t6 & 0x00000001u;
         /* 0209F99C */ if (_t7) goto L_0209F9A0; else goto L_0209F9CC;
   L_0209F9A0: ; // 0x209f9a0
         /* 0209F9A0 */ cpu->r[3] = 0x000001C8u;
         /* 0209F9A4 */ Gambit_fn_02801A78(cpu);
         /* 0209F9A8 */ cpu->r[29] = cpu->r[3];
-        /* 0209F9A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0209F9AC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F9A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0209F9AC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F9AC */ _t9 = _t8 & 0x00000001u;
         /* 0209F9AC */ if (_t9) goto L_0209F9B0; else goto L_0209F9CC;
   L_0209F9B0: ; // 0x209f9b0
@@ -21580,44 +21580,44 @@ void Gambit_fn_0209F968(CPUState* cpu) {
         /* 0209F9C8 */ goto L_0209FC24;
   L_0209F9CC: ; // 0x209f9cc
         /* 0209F9CC */ cpu->r[27] = cpu->r[29];
-        /* 0209F9CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0209F9D0 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F9CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0209F9D0 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F9D0 */ _t15 = _t14 & 0x00000001u;
         /* 0209F9D0 */ if (_t15) goto L_0209F9D4; else goto L_0209FA04;
   L_0209F9D4: ; // 0x209f9d4
         /* 0209F9D4 */ cpu->r[3] = 0x0000010Cu;
         /* 0209F9D8 */ Gambit_fn_02801A78(cpu);
         /* 0209F9DC */ cpu->r[27] = cpu->r[3];
-        /* 0209F9DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0209F9E0 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F9DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0209F9E0 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F9E0 */ _t17 = _t16 & 0x00000001u;
         /* 0209F9E0 */ if (_t17) goto L_0209F9E4; else goto L_0209FA04;
   L_0209F9E4: ; // 0x209f9e4
         /* 0209F9E4 */ cpu->r[0] = 0x10010000u;
         /* 0209F9E8 */ cpu->r[26] = cpu->r[29] + 0x0000010Cu;
-        /* 0209F9E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 0209F9E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 0209F9EC */ _t18 = cpu->r[28] + 0x0000739Au;
         /* 0209F9EC */ cpu->r[28] = rbrew_read16(cpu->mem, _t18);
         /* 0209F9F0 */ cpu->r[0] = cpu->r[0] + 0x0000229Cu;
         /* 0209F9F4 */ cpu->r[27] = 0x00000000u;
         /* 0209F9F8 */ _t19 = cpu->r[29] + 0x00000004u;
         /* 0209F9F8 */ rbrew_write32(cpu->mem, _t19, cpu->r[0]);
-        /* 0209F9FC */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F9FC */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F9FC */ _t21 = _t20 & 0x00000001u;
         /* 0209F9FC */ if (_t21) goto L_0209FA88; else goto L_0209FA00;
   L_0209FA00: ; // 0x209fa00
         /* 0209FA00 */ goto L_0209FA98;
   L_0209FA04: ; // 0x209fa04
         /* 0209FA04 */ cpu->r[3] = cpu->r[27];
-        /* 0209FA04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209FA08 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FA04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209FA08 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FA08 */ _t23 = _t22 & 0x00000001u;
         /* 0209FA08 */ if (_t23) goto L_0209FA0C; else goto L_0209FA38;
   L_0209FA0C: ; // 0x209fa0c
         /* 0209FA0C */ cpu->r[3] = 0x0000000Cu;
         /* 0209FA10 */ Gambit_fn_02801A78(cpu);
-        /* 0209FA14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209FA18 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FA14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209FA18 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FA18 */ _t25 = _t24 & 0x00000001u;
         /* 0209FA18 */ if (_t25) goto L_0209FA1C; else goto L_0209FA38;
   L_0209FA1C: ; // 0x209fa1c
@@ -21658,27 +21658,27 @@ void Gambit_fn_0209F968(CPUState* cpu) {
   L_0209FA70: ; // 0x209fa70
         /* 0209FA70 */ cpu->r[0] = 0x10010000u;
         /* 0209FA74 */ cpu->r[26] = cpu->r[29] + 0x0000010Cu;
-        /* 0209FA74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 0209FA74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 0209FA78 */ cpu->r[0] = cpu->r[0] + 0x0000229Cu;
         /* 0209FA7C */ cpu->r[27] = 0x00000000u;
         /* 0209FA80 */ _t38 = cpu->r[29] + 0x00000004u;
         /* 0209FA80 */ rbrew_write32(cpu->mem, _t38, cpu->r[0]);
-        /* 0209FA84 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FA84 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FA84 */ _t40 = _t39 & 0x00000001u;
         /* 0209FA84 */ if (_t40) goto L_0209FA88; else goto L_0209FA98;
   L_0209FA88: ; // 0x209fa88
         /* 0209FA88 */ cpu->r[3] = 0x000000B4u;
         /* 0209FA8C */ Gambit_fn_02801A78(cpu);
         /* 0209FA90 */ cpu->r[26] = cpu->r[3];
-        /* 0209FA90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0209FA94 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FA90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0209FA94 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FA94 */ _t42 = _t41 & 0x00000001u;
         /* 0209FA94 */ if (_t42) goto L_0209FC00; else goto L_0209FA98;
   L_0209FA98: ; // 0x209fa98
         /* 0209FA98 */ _t43 = cpu->r[26] + 0x00000000u;
         /* 0209FA98 */ rbrew_write8(cpu->mem, _t43, (uint8_t)cpu->r[27]);
         /* 0209FA9C */ cpu->r[21] = cpu->r[26] + 0x00000010u;
-        /* 0209FA9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
+        /* 0209FA9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
         /* 0209FAA0 */ cpu->r[23] = 0x10110000u;
         /* 0209FAA4 */ _t44 = cpu->r[26] + 0x00000004u;
         /* 0209FAA4 */ rbrew_write32(cpu->mem, _t44, cpu->r[27]);
@@ -21690,39 +21690,39 @@ void Gambit_fn_0209F968(CPUState* cpu) {
         /* 0209FAB8 */ cpu->r[25] = cpu->r[25] + 0x00002224u;
         /* 0209FABC */ _t46 = cpu->r[26] + 0x0000000Cu;
         /* 0209FABC */ rbrew_write32(cpu->mem, _t46, cpu->r[27]);
-        /* 0209FAC0 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FAC0 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FAC0 */ _t48 = _t47 & 0x00000001u;
         /* 0209FAC0 */ if (_t48) goto L_0209FAC4; else goto L_0209FAE4;
   L_0209FAC4: ; // 0x209fac4
         /* 0209FAC4 */ cpu->r[3] = 0x0000004Cu;
         /* 0209FAC8 */ Gambit_fn_02801A78(cpu);
         /* 0209FACC */ cpu->r[21] = cpu->r[3];
-        /* 0209FACC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 0209FAD0 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FACC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 0209FAD0 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FAD0 */ _t50 = _t49 & 0x00000001u;
         /* 0209FAD0 */ if (_t50) goto L_0209FAD4; else goto L_0209FAE4;
   L_0209FAD4: ; // 0x209fad4
         /* 0209FAD4 */ cpu->r[21] = cpu->r[26] + 0x0000005Cu;
-        /* 0209FAD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
+        /* 0209FAD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
         /* 0209FAD8 */ _t51 = cpu->r[23] + 0x00007399u;
         /* 0209FAD8 */ cpu->r[23] = rbrew_read8(cpu->mem, _t51);
-        /* 0209FADC */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FADC */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FADC */ _t53 = _t52 & 0x00000001u;
         /* 0209FADC */ if (_t53) goto L_0209FAE0; else goto L_0209FB80;
   L_0209FAE0: ; // 0x209fae0
         /* 0209FAE0 */ goto L_0209FB70;
   L_0209FAE4: ; // 0x209fae4
         /* 0209FAE4 */ cpu->r[22] = cpu->r[21];
-        /* 0209FAE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 0209FAE8 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FAE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 0209FAE8 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FAE8 */ _t55 = _t54 & 0x00000001u;
         /* 0209FAE8 */ if (_t55) goto L_0209FAEC; else goto L_0209FB08;
   L_0209FAEC: ; // 0x209faec
         /* 0209FAEC */ cpu->r[3] = 0x0000004Cu;
         /* 0209FAF0 */ Gambit_fn_02801A78(cpu);
         /* 0209FAF4 */ cpu->r[22] = cpu->r[3];
-        /* 0209FAF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 0209FAF8 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FAF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 0209FAF8 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FAF8 */ _t57 = _t56 & 0x00000001u;
         /* 0209FAF8 */ if (_t57) goto L_0209FAFC; else goto L_0209FB08;
   L_0209FAFC: ; // 0x209fafc
@@ -21733,15 +21733,15 @@ void Gambit_fn_0209F968(CPUState* cpu) {
         /* 0209FB04 */ goto L_0209FB68;
   L_0209FB08: ; // 0x209fb08
         /* 0209FB08 */ cpu->r[3] = cpu->r[22];
-        /* 0209FB08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209FB0C */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FB08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209FB0C */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FB0C */ _t61 = _t60 & 0x00000001u;
         /* 0209FB0C */ if (_t61) goto L_0209FB10; else goto L_0209FB34;
   L_0209FB10: ; // 0x209fb10
         /* 0209FB10 */ cpu->r[3] = 0x0000000Cu;
         /* 0209FB14 */ Gambit_fn_02801A78(cpu);
-        /* 0209FB18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209FB1C */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FB18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209FB1C */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FB1C */ _t63 = _t62 & 0x00000001u;
         /* 0209FB1C */ if (_t63) goto L_0209FB20; else goto L_0209FB34;
   L_0209FB20: ; // 0x209fb20
@@ -21780,43 +21780,43 @@ void Gambit_fn_0209F968(CPUState* cpu) {
         /* 0209FB64 */ rbrew_write32(cpu->mem, _t76, cpu->r[24]);
   L_0209FB68: ; // 0x209fb68
         /* 0209FB68 */ cpu->r[21] = cpu->r[26] + 0x0000005Cu;
-        /* 0209FB68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 0209FB6C */ _t77 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FB68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 0209FB6C */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FB6C */ _t78 = _t77 & 0x00000001u;
         /* 0209FB6C */ if (_t78) goto L_0209FB70; else goto L_0209FB80;
   L_0209FB70: ; // 0x209fb70
         /* 0209FB70 */ cpu->r[3] = 0x0000004Cu;
         /* 0209FB74 */ Gambit_fn_02801A78(cpu);
         /* 0209FB78 */ cpu->r[21] = cpu->r[3];
-        /* 0209FB78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 0209FB7C */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FB78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 0209FB7C */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FB7C */ _t80 = _t79 & 0x00000001u;
         /* 0209FB7C */ if (_t80) goto L_0209FBE0; else goto L_0209FB80;
   L_0209FB80: ; // 0x209fb80
         /* 0209FB80 */ cpu->r[22] = cpu->r[21];
-        /* 0209FB80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 0209FB84 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FB80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 0209FB84 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FB84 */ _t82 = _t81 & 0x00000001u;
         /* 0209FB84 */ if (_t82) goto L_0209FB88; else goto L_0209FB98;
   L_0209FB88: ; // 0x209fb88
         /* 0209FB88 */ cpu->r[3] = 0x0000004Cu;
         /* 0209FB8C */ Gambit_fn_02801A78(cpu);
         /* 0209FB90 */ cpu->r[22] = cpu->r[3];
-        /* 0209FB90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 0209FB94 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FB90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 0209FB94 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FB94 */ _t84 = _t83 & 0x00000001u;
         /* 0209FB94 */ if (_t84) goto L_0209FBDC; else goto L_0209FB98;
   L_0209FB98: ; // 0x209fb98
         /* 0209FB98 */ cpu->r[3] = cpu->r[22];
-        /* 0209FB98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209FB9C */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FB98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209FB9C */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FB9C */ _t86 = _t85 & 0x00000001u;
         /* 0209FB9C */ if (_t86) goto L_0209FBA0; else goto L_0209FBB0;
   L_0209FBA0: ; // 0x209fba0
         /* 0209FBA0 */ cpu->r[3] = 0x0000000Cu;
         /* 0209FBA4 */ Gambit_fn_02801A78(cpu);
-        /* 0209FBA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209FBAC */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FBA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209FBAC */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FBAC */ _t88 = _t87 & 0x00000001u;
         /* 0209FBAC */ if (_t88) goto L_0209FBD0; else goto L_0209FBB0;
   L_0209FBB0: ; // 0x209fbb0
@@ -21897,32 +21897,32 @@ void Gambit_fn_0209F96C(CPUState* cpu) {
         /* 0209F970 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 0209F974 */ /* nop */
         /* 0209F978 */ cpu->r[31] = cpu->r[3];
-        /* 0209F978 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0209F978 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0209F97C */ cpu->r[30] = cpu->r[4];
-        /* 0209F980 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F980 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F980 */ _t3 = _t2 & 0x00000001u;
         /* 0209F980 */ if (_t3) goto L_0209F984; else goto L_0209F994;
   L_0209F984: ; // 0x209f984
         /* 0209F984 */ cpu->r[3] = 0x000001C8u;
         /* 0209F988 */ Gambit_fn_02801A78(cpu);
         /* 0209F98C */ cpu->r[31] = cpu->r[3];
-        /* 0209F98C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209F990 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F98C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209F990 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F990 */ _t5 = _t4 & 0x00000001u;
         /* 0209F990 */ if (_t5) goto L_0209FC24; else goto L_0209F994;
   L_0209F994: ; // 0x209f994
         /* 0209F994 */ cpu->r[29] = cpu->r[31];
-        /* 0209F994 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0209F994 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0209F998 */ cpu->r[28] = 0x10110000u;
-        /* 0209F99C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F99C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F99C */ _t7 = _t6 & 0x00000001u;
         /* 0209F99C */ if (_t7) goto L_0209F9A0; else goto L_0209F9CC;
   L_0209F9A0: ; // 0x209f9a0
         /* 0209F9A0 */ cpu->r[3] = 0x000001C8u;
         /* 0209F9A4 */ Gambit_fn_02801A78(cpu);
         /* 0209F9A8 */ cpu->r[29] = cpu->r[3];
-        /* 0209F9A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0209F9AC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F9A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0209F9AC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F9AC */ _t9 = _t8 & 0x00000001u;
         /* 0209F9AC */ if (_t9) goto L_0209F9B0; else goto L_0209F9CC;
   L_0209F9B0: ; // 0x209f9b0
@@ -21939,44 +21939,44 @@ void Gambit_fn_0209F96C(CPUState* cpu) {
         /* 0209F9C8 */ goto L_0209FC24;
   L_0209F9CC: ; // 0x209f9cc
         /* 0209F9CC */ cpu->r[27] = cpu->r[29];
-        /* 0209F9CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0209F9D0 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F9CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0209F9D0 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F9D0 */ _t15 = _t14 & 0x00000001u;
         /* 0209F9D0 */ if (_t15) goto L_0209F9D4; else goto L_0209FA04;
   L_0209F9D4: ; // 0x209f9d4
         /* 0209F9D4 */ cpu->r[3] = 0x0000010Cu;
         /* 0209F9D8 */ Gambit_fn_02801A78(cpu);
         /* 0209F9DC */ cpu->r[27] = cpu->r[3];
-        /* 0209F9DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0209F9E0 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F9DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0209F9E0 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F9E0 */ _t17 = _t16 & 0x00000001u;
         /* 0209F9E0 */ if (_t17) goto L_0209F9E4; else goto L_0209FA04;
   L_0209F9E4: ; // 0x209f9e4
         /* 0209F9E4 */ cpu->r[0] = 0x10010000u;
         /* 0209F9E8 */ cpu->r[26] = cpu->r[29] + 0x0000010Cu;
-        /* 0209F9E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 0209F9E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 0209F9EC */ _t18 = cpu->r[28] + 0x0000739Au;
         /* 0209F9EC */ cpu->r[28] = rbrew_read16(cpu->mem, _t18);
         /* 0209F9F0 */ cpu->r[0] = cpu->r[0] + 0x0000229Cu;
         /* 0209F9F4 */ cpu->r[27] = 0x00000000u;
         /* 0209F9F8 */ _t19 = cpu->r[29] + 0x00000004u;
         /* 0209F9F8 */ rbrew_write32(cpu->mem, _t19, cpu->r[0]);
-        /* 0209F9FC */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209F9FC */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209F9FC */ _t21 = _t20 & 0x00000001u;
         /* 0209F9FC */ if (_t21) goto L_0209FA88; else goto L_0209FA00;
   L_0209FA00: ; // 0x209fa00
         /* 0209FA00 */ goto L_0209FA98;
   L_0209FA04: ; // 0x209fa04
         /* 0209FA04 */ cpu->r[3] = cpu->r[27];
-        /* 0209FA04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209FA08 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FA04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209FA08 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FA08 */ _t23 = _t22 & 0x00000001u;
         /* 0209FA08 */ if (_t23) goto L_0209FA0C; else goto L_0209FA38;
   L_0209FA0C: ; // 0x209fa0c
         /* 0209FA0C */ cpu->r[3] = 0x0000000Cu;
         /* 0209FA10 */ Gambit_fn_02801A78(cpu);
-        /* 0209FA14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209FA18 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FA14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209FA18 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FA18 */ _t25 = _t24 & 0x00000001u;
         /* 0209FA18 */ if (_t25) goto L_0209FA1C; else goto L_0209FA38;
   L_0209FA1C: ; // 0x209fa1c
@@ -22017,27 +22017,27 @@ void Gambit_fn_0209F96C(CPUState* cpu) {
   L_0209FA70: ; // 0x209fa70
         /* 0209FA70 */ cpu->r[0] = 0x10010000u;
         /* 0209FA74 */ cpu->r[26] = cpu->r[29] + 0x0000010Cu;
-        /* 0209FA74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 0209FA74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 0209FA78 */ cpu->r[0] = cpu->r[0] + 0x0000229Cu;
         /* 0209FA7C */ cpu->r[27] = 0x00000000u;
         /* 0209FA80 */ _t38 = cpu->r[29] + 0x00000004u;
         /* 0209FA80 */ rbrew_write32(cpu->mem, _t38, cpu->r[0]);
-        /* 0209FA84 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FA84 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FA84 */ _t40 = _t39 & 0x00000001u;
         /* 0209FA84 */ if (_t40) goto L_0209FA88; else goto L_0209FA98;
   L_0209FA88: ; // 0x209fa88
         /* 0209FA88 */ cpu->r[3] = 0x000000B4u;
         /* 0209FA8C */ Gambit_fn_02801A78(cpu);
         /* 0209FA90 */ cpu->r[26] = cpu->r[3];
-        /* 0209FA90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0209FA94 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FA90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0209FA94 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FA94 */ _t42 = _t41 & 0x00000001u;
         /* 0209FA94 */ if (_t42) goto L_0209FC00; else goto L_0209FA98;
   L_0209FA98: ; // 0x209fa98
         /* 0209FA98 */ _t43 = cpu->r[26] + 0x00000000u;
         /* 0209FA98 */ rbrew_write8(cpu->mem, _t43, (uint8_t)cpu->r[27]);
         /* 0209FA9C */ cpu->r[21] = cpu->r[26] + 0x00000010u;
-        /* 0209FA9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
+        /* 0209FA9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
         /* 0209FAA0 */ cpu->r[23] = 0x10110000u;
         /* 0209FAA4 */ _t44 = cpu->r[26] + 0x00000004u;
         /* 0209FAA4 */ rbrew_write32(cpu->mem, _t44, cpu->r[27]);
@@ -22049,39 +22049,39 @@ void Gambit_fn_0209F96C(CPUState* cpu) {
         /* 0209FAB8 */ cpu->r[25] = cpu->r[25] + 0x00002224u;
         /* 0209FABC */ _t46 = cpu->r[26] + 0x0000000Cu;
         /* 0209FABC */ rbrew_write32(cpu->mem, _t46, cpu->r[27]);
-        /* 0209FAC0 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FAC0 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FAC0 */ _t48 = _t47 & 0x00000001u;
         /* 0209FAC0 */ if (_t48) goto L_0209FAC4; else goto L_0209FAE4;
   L_0209FAC4: ; // 0x209fac4
         /* 0209FAC4 */ cpu->r[3] = 0x0000004Cu;
         /* 0209FAC8 */ Gambit_fn_02801A78(cpu);
         /* 0209FACC */ cpu->r[21] = cpu->r[3];
-        /* 0209FACC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 0209FAD0 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FACC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 0209FAD0 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FAD0 */ _t50 = _t49 & 0x00000001u;
         /* 0209FAD0 */ if (_t50) goto L_0209FAD4; else goto L_0209FAE4;
   L_0209FAD4: ; // 0x209fad4
         /* 0209FAD4 */ cpu->r[21] = cpu->r[26] + 0x0000005Cu;
-        /* 0209FAD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
+        /* 0209FAD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
         /* 0209FAD8 */ _t51 = cpu->r[23] + 0x00007399u;
         /* 0209FAD8 */ cpu->r[23] = rbrew_read8(cpu->mem, _t51);
-        /* 0209FADC */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FADC */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FADC */ _t53 = _t52 & 0x00000001u;
         /* 0209FADC */ if (_t53) goto L_0209FAE0; else goto L_0209FB80;
   L_0209FAE0: ; // 0x209fae0
         /* 0209FAE0 */ goto L_0209FB70;
   L_0209FAE4: ; // 0x209fae4
         /* 0209FAE4 */ cpu->r[22] = cpu->r[21];
-        /* 0209FAE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 0209FAE8 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FAE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 0209FAE8 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FAE8 */ _t55 = _t54 & 0x00000001u;
         /* 0209FAE8 */ if (_t55) goto L_0209FAEC; else goto L_0209FB08;
   L_0209FAEC: ; // 0x209faec
         /* 0209FAEC */ cpu->r[3] = 0x0000004Cu;
         /* 0209FAF0 */ Gambit_fn_02801A78(cpu);
         /* 0209FAF4 */ cpu->r[22] = cpu->r[3];
-        /* 0209FAF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 0209FAF8 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FAF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 0209FAF8 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FAF8 */ _t57 = _t56 & 0x00000001u;
         /* 0209FAF8 */ if (_t57) goto L_0209FAFC; else goto L_0209FB08;
   L_0209FAFC: ; // 0x209fafc
@@ -22092,15 +22092,15 @@ void Gambit_fn_0209F96C(CPUState* cpu) {
         /* 0209FB04 */ goto L_0209FB68;
   L_0209FB08: ; // 0x209fb08
         /* 0209FB08 */ cpu->r[3] = cpu->r[22];
-        /* 0209FB08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209FB0C */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FB08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209FB0C */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FB0C */ _t61 = _t60 & 0x00000001u;
         /* 0209FB0C */ if (_t61) goto L_0209FB10; else goto L_0209FB34;
   L_0209FB10: ; // 0x209fb10
         /* 0209FB10 */ cpu->r[3] = 0x0000000Cu;
         /* 0209FB14 */ Gambit_fn_02801A78(cpu);
-        /* 0209FB18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209FB1C */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FB18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209FB1C */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FB1C */ _t63 = _t62 & 0x00000001u;
         /* 0209FB1C */ if (_t63) goto L_0209FB20; else goto L_0209FB34;
   L_0209FB20: ; // 0x209fb20
@@ -22139,43 +22139,43 @@ void Gambit_fn_0209F96C(CPUState* cpu) {
         /* 0209FB64 */ rbrew_write32(cpu->mem, _t76, cpu->r[24]);
   L_0209FB68: ; // 0x209fb68
         /* 0209FB68 */ cpu->r[21] = cpu->r[26] + 0x0000005Cu;
-        /* 0209FB68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 0209FB6C */ _t77 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FB68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 0209FB6C */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FB6C */ _t78 = _t77 & 0x00000001u;
         /* 0209FB6C */ if (_t78) goto L_0209FB70; else goto L_0209FB80;
   L_0209FB70: ; // 0x209fb70
         /* 0209FB70 */ cpu->r[3] = 0x0000004Cu;
         /* 0209FB74 */ Gambit_fn_02801A78(cpu);
         /* 0209FB78 */ cpu->r[21] = cpu->r[3];
-        /* 0209FB78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 0209FB7C */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FB78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 0209FB7C */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FB7C */ _t80 = _t79 & 0x00000001u;
         /* 0209FB7C */ if (_t80) goto L_0209FBE0; else goto L_0209FB80;
   L_0209FB80: ; // 0x209fb80
         /* 0209FB80 */ cpu->r[22] = cpu->r[21];
-        /* 0209FB80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 0209FB84 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FB80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 0209FB84 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FB84 */ _t82 = _t81 & 0x00000001u;
         /* 0209FB84 */ if (_t82) goto L_0209FB88; else goto L_0209FB98;
   L_0209FB88: ; // 0x209fb88
         /* 0209FB88 */ cpu->r[3] = 0x0000004Cu;
         /* 0209FB8C */ Gambit_fn_02801A78(cpu);
         /* 0209FB90 */ cpu->r[22] = cpu->r[3];
-        /* 0209FB90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 0209FB94 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FB90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 0209FB94 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FB94 */ _t84 = _t83 & 0x00000001u;
         /* 0209FB94 */ if (_t84) goto L_0209FBDC; else goto L_0209FB98;
   L_0209FB98: ; // 0x209fb98
         /* 0209FB98 */ cpu->r[3] = cpu->r[22];
-        /* 0209FB98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209FB9C */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FB98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209FB9C */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FB9C */ _t86 = _t85 & 0x00000001u;
         /* 0209FB9C */ if (_t86) goto L_0209FBA0; else goto L_0209FBB0;
   L_0209FBA0: ; // 0x209fba0
         /* 0209FBA0 */ cpu->r[3] = 0x0000000Cu;
         /* 0209FBA4 */ Gambit_fn_02801A78(cpu);
-        /* 0209FBA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0209FBAC */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FBA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0209FBAC */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FBAC */ _t88 = _t87 & 0x00000001u;
         /* 0209FBAC */ if (_t88) goto L_0209FBD0; else goto L_0209FBB0;
   L_0209FBB0: ; // 0x209fbb0
@@ -22264,40 +22264,40 @@ void Gambit_fn_0209FC3C(CPUState* cpu) {
         /* 0209FC58 */ cpu->r[28] = cpu->r[3];
         /* 0209FC5C */ cpu->r[30] = cpu->r[4];
         /* 0209FC60 */ cpu->r[31] = cpu->r[5];
-        /* 0209FC64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0209FC64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0209FC68 */ cpu->r[26] = 0x10110000u;
-        /* 0209FC6C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FC6C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FC6C */ _t5 = _t4 & 0x00000001u;
         /* 0209FC6C */ if (_t5) goto L_0209FE54; else goto L_0209FC70;
   L_0209FC70: ; // 0x209fc70
         /* 0209FC70 */ _t6 = cpu->r[29] + 0x0000001Cu;
         /* 0209FC70 */ cpu->r[3] = rbrew_read16(cpu->mem, _t6);
         /* 0209FC74 */ Gambit_fn_0282A11C(cpu);
-        /* 0209FC78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000003u);
-        /* 0209FC7C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FC78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000003u));
+        /* 0209FC7C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FC7C */ _t8 = _t7 & 0x00000001u;
         /* 0209FC7C */ if (_t8) goto L_0209FC80; else goto L_0209FE54;
   L_0209FC80: ; // 0x209fc80
         /* 0209FC80 */ _t9 = cpu->r[30] + 0x00000000u;
         /* 0209FC80 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 0209FC84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0209FC88 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FC84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0209FC88 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FC88 */ _t11 = _t10 & 0x00000001u;
         /* 0209FC88 */ if (_t11) goto L_0209FC94; else goto L_0209FC8C;
   L_0209FC8C: ; // 0x209fc8c
-        /* 0209FC8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 0209FC90 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FC8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 0209FC90 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FC90 */ _t13 = _t12 & 0x00000001u;
         /* 0209FC90 */ if (_t13) goto L_0209FC94; else goto L_0209FE54;
   L_0209FC94: ; // 0x209fc94
-        /* 0209FC94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0209FC98 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FC94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0209FC98 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FC98 */ _t15 = _t14 & 0x00000001u;
         /* 0209FC98 */ if (_t15) goto L_0209FD78; else goto L_0209FC9C;
   L_0209FC9C: ; // 0x209fc9c
-        /* 0209FC9C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 0209FC9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 0209FCA0 */ cpu->r[27] = cpu->r[29] + 0x000002DCu;
-        /* 0209FCA4 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209FCA4 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209FCA4 */ _t17 = _t16 & 0x00000001u;
         /* 0209FCA4 */ if (_t17) goto L_0209FCA8; else goto L_0209FCB0;
   L_0209FCA8: ; // 0x209fca8
@@ -22320,23 +22320,23 @@ void Gambit_fn_0209FC3C(CPUState* cpu) {
         /* 0209FCD0 */ _t23 = cpu->r[11] + 0x00000000u;
         /* 0209FCD0 */ cpu->r[10] = rbrew_read16(cpu->mem, _t23);
         /* 0209FCD4 */ cpu->r[30] = 0x00000000u;
-        /* 0209FCD8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[31]);
+        /* 0209FCD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[31]));
         /* 0209FCDC */ cpu->r[5] = 0x00080000u;
-        /* 0209FCE0 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FCE0 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FCE0 */ _t25 = _t24 & 0x00000001u;
         /* 0209FCE0 */ if (_t25) goto L_0209FD08; else goto L_0209FCE4;
   L_0209FCE4: ; // 0x209fce4
         /* 0209FCE4 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0209FCE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[5]);
+        /* 0209FCE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[5]));
         /* 0209FCEC */ cpu->r[11] = cpu->r[11] + 0x00000002u;
-        /* 0209FCF0 */ _t26 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209FCF0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209FCF0 */ _t27 = _t26 & 0x00000001u;
         /* 0209FCF0 */ if (_t27) goto L_0209FD04; else goto L_0209FCF4;
   L_0209FCF4: ; // 0x209fcf4
         /* 0209FCF4 */ _t28 = cpu->r[11] + 0x00000000u;
         /* 0209FCF4 */ cpu->r[0] = rbrew_read16(cpu->mem, _t28);
-        /* 0209FCF8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 0209FCFC */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FCF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 0209FCFC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FCFC */ _t30 = _t29 & 0x00000001u;
         /* 0209FCFC */ if (_t30) goto L_0209FD00; else goto L_0209FCE4;
   L_0209FD00: ; // 0x209fd00
@@ -22348,10 +22348,10 @@ void Gambit_fn_0209FC3C(CPUState* cpu) {
         /* 0209FD08 */ cpu->r[11] = rbrew_read32(cpu->mem, _t31);
         /* 0209FD0C */ _t32 = cpu->r[27] + 0x00000004u;
         /* 0209FD0C */ cpu->r[12] = rbrew_read32(cpu->mem, _t32);
-        /* 0209FD10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[11]);
+        /* 0209FD10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[11]));
         /* 0209FD14 */ _t33 = cpu->r[12] + 0x00000014u;
         /* 0209FD14 */ cpu->r[0] = rbrew_read32(cpu->mem, _t33);
-        /* 0209FD18 */ _t34 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209FD18 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209FD18 */ _t35 = _t34 & 0x00000001u;
         /* 0209FD18 */ if (_t35) goto L_0209FD20; else goto L_0209FD1C;
   L_0209FD1C: ; // 0x209fd1c
@@ -22381,17 +22381,17 @@ void Gambit_fn_0209FC3C(CPUState* cpu) {
         /* 0209FD60 */ _t41 = cpu->r[7] + 0x00000000u;
         /* 0209FD60 */ cpu->r[10] = rbrew_read16(cpu->mem, _t41);
         /* 0209FD64 */ cpu->r[11] = 0x00000000u;
-        /* 0209FD68 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[31]);
+        /* 0209FD68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[31]));
         /* 0209FD6C */ cpu->r[9] = 0x00080000u;
-        /* 0209FD70 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FD70 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FD70 */ _t43 = _t42 & 0x00000001u;
         /* 0209FD70 */ if (_t43) goto L_0209FD74; else goto L_020A015C;
   L_0209FD74: ; // 0x209fd74
         /* 0209FD74 */ goto L_020A0180;
   L_0209FD78: ; // 0x209fd78
-        /* 0209FD78 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 0209FD78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 0209FD7C */ cpu->r[30] = cpu->r[29] + 0x00000060u;
-        /* 0209FD80 */ _t44 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209FD80 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209FD80 */ _t45 = _t44 & 0x00000001u;
         /* 0209FD80 */ if (_t45) goto L_0209FD84; else goto L_0209FD8C;
   L_0209FD84: ; // 0x209fd84
@@ -22414,23 +22414,23 @@ void Gambit_fn_0209FC3C(CPUState* cpu) {
         /* 0209FDAC */ _t51 = cpu->r[7] + 0x00000000u;
         /* 0209FDAC */ cpu->r[0] = rbrew_read16(cpu->mem, _t51);
         /* 0209FDB0 */ cpu->r[27] = 0x00000000u;
-        /* 0209FDB4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 0209FDB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 0209FDB8 */ cpu->r[0] = 0x00080000u;
-        /* 0209FDBC */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FDBC */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FDBC */ _t53 = _t52 & 0x00000001u;
         /* 0209FDBC */ if (_t53) goto L_0209FDE4; else goto L_0209FDC0;
   L_0209FDC0: ; // 0x209fdc0
         /* 0209FDC0 */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 0209FDC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[0]);
+        /* 0209FDC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[0]));
         /* 0209FDC8 */ cpu->r[7] = cpu->r[7] + 0x00000002u;
-        /* 0209FDCC */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0209FDCC */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0209FDCC */ _t55 = _t54 & 0x00000001u;
         /* 0209FDCC */ if (_t55) goto L_0209FDE0; else goto L_0209FDD0;
   L_0209FDD0: ; // 0x209fdd0
         /* 0209FDD0 */ _t56 = cpu->r[7] + 0x00000000u;
         /* 0209FDD0 */ cpu->r[11] = rbrew_read16(cpu->mem, _t56);
-        /* 0209FDD4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[31]);
-        /* 0209FDD8 */ _t57 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FDD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[31]));
+        /* 0209FDD8 */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FDD8 */ _t58 = _t57 & 0x00000001u;
         /* 0209FDD8 */ if (_t58) goto L_0209FDDC; else goto L_0209FDC0;
   L_0209FDDC: ; // 0x209fddc
@@ -22442,10 +22442,10 @@ void Gambit_fn_0209FC3C(CPUState* cpu) {
         /* 0209FDE4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t59);
         /* 0209FDE8 */ _t60 = cpu->r[30] + 0x00000004u;
         /* 0209FDE8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
-        /* 0209FDEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[11]);
+        /* 0209FDEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[11]));
         /* 0209FDF0 */ _t61 = cpu->r[12] + 0x00000014u;
         /* 0209FDF0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t61);
-        /* 0209FDF4 */ _t62 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209FDF4 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209FDF4 */ _t63 = _t62 & 0x00000001u;
         /* 0209FDF4 */ if (_t63) goto L_0209FDFC; else goto L_0209FDF8;
   L_0209FDF8: ; // 0x209fdf8
@@ -22475,9 +22475,9 @@ void Gambit_fn_0209FC3C(CPUState* cpu) {
         /* 0209FE3C */ _t69 = cpu->r[7] + 0x00000000u;
         /* 0209FE3C */ cpu->r[10] = rbrew_read16(cpu->mem, _t69);
         /* 0209FE40 */ cpu->r[11] = 0x00000000u;
-        /* 0209FE44 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[31]);
+        /* 0209FE44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[31]));
         /* 0209FE48 */ cpu->r[9] = 0x00080000u;
-        /* 0209FE4C */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FE4C */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FE4C */ _t71 = _t70 & 0x00000001u;
         /* 0209FE4C */ if (_t71) goto L_020A0180; else goto L_0209FE50;
   L_0209FE50: ; // 0x209fe50
@@ -22488,10 +22488,10 @@ void Gambit_fn_0209FC3C(CPUState* cpu) {
         /* 0209FE58 */ cpu->r[9] = rbrew_read32(cpu->mem, _t72);
         /* 0209FE5C */ _t73 = cpu->r[30] + 0x00000000u;
         /* 0209FE5C */ cpu->r[8] = rbrew_read32(cpu->mem, _t73);
-        /* 0209FE60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0209FE60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0209FE64 */ cpu->r[31] = 0x101D0000u;
         /* 0209FE68 */ cpu->r[24] = cpu->r[8] + 0x00000001u;
-        /* 0209FE6C */ _t74 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FE6C */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FE6C */ _t75 = _t74 & 0x00000001u;
         /* 0209FE6C */ if (_t75) goto L_0209FE70; else goto L_0209FE90;
   L_0209FE70: ; // 0x209fe70
@@ -22509,9 +22509,9 @@ void Gambit_fn_0209FC3C(CPUState* cpu) {
         /* 0209FE94 */ _t77 = cpu->r[8] + 0xFFFFD8ECu;
         /* 0209FE94 */ cpu->r[12] = rbrew_read32(cpu->mem, _t77);
         /* 0209FE94 */ cpu->r[8] = _t77;
-        /* 0209FE98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0209FE98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0209FE9C */ cpu->r[30] = 0x101D0000u;
-        /* 0209FEA0 */ _t78 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FEA0 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FEA0 */ _t79 = _t78 & 0x00000001u;
         /* 0209FEA0 */ if (_t79) goto L_0209FEA4; else goto L_0209FEB4;
   L_0209FEA4: ; // 0x209fea4
@@ -22522,8 +22522,8 @@ void Gambit_fn_0209FC3C(CPUState* cpu) {
         /* 0209FEB0 */ _t81 = cpu->r[30] + 0xFFFFE350u;
         /* 0209FEB0 */ rbrew_write32(cpu->mem, _t81, cpu->r[6]);
   L_0209FEB4: ; // 0x209feb4
-        /* 0209FEB4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[24], 0x00000004u);
-        /* 0209FEB8 */ _t82 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0209FEB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[24], 0x00000004u));
+        /* 0209FEB8 */ _t82 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0209FEB8 */ _t83 = _t82 & 0x00000001u;
         /* 0209FEB8 */ if (_t83) goto L_0209FEC4; else goto L_0209FEBC;
   L_0209FEBC: ; // 0x209febc
@@ -22532,8 +22532,8 @@ void Gambit_fn_0209FC3C(CPUState* cpu) {
   L_0209FEC4: ; // 0x209fec4
         /* 0209FEC4 */ _t84 = cpu->r[30] + 0xFFFFE350u;
         /* 0209FEC4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t84);
-        /* 0209FEC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0209FECC */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FEC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0209FECC */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FECC */ _t86 = _t85 & 0x00000001u;
         /* 0209FECC */ if (_t86) goto L_0209FED0; else goto L_0209FF10;
   L_0209FED0: ; // 0x209fed0
@@ -22542,8 +22542,8 @@ void Gambit_fn_0209FC3C(CPUState* cpu) {
         /* 0209FED8 */ Gambit_fn_02836FFC(cpu);
         /* 0209FEDC */ _t87 = cpu->r[30] + 0xFFFFE350u;
         /* 0209FEDC */ cpu->r[8] = rbrew_read32(cpu->mem, _t87);
-        /* 0209FEE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 0209FEE4 */ _t88 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0209FEE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 0209FEE4 */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0209FEE4 */ _t89 = _t88 & 0x00000001u;
         /* 0209FEE4 */ if (_t89) goto L_0209FEE8; else goto L_0209FF04;
   L_0209FEE8: ; // 0x209fee8
@@ -22595,7 +22595,7 @@ void Gambit_fn_0209FC3C(CPUState* cpu) {
         /* 0209FF60 */ cpu->r[5] = rbrew_read32(cpu->mem, _t101);
         /* 0209FF64 */ cpu->r[3] = cpu->r[1] + 0x00000018u;
         /* 0209FF68 */ cpu->r[4] = cpu->r[4] + 0x000021A8u;
-        /* 0209FF6C */ _t102 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0209FF6C */ _t102 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0209FF6C */ _t103 = _t102 & 0x00000001u;
         /* 0209FF6C */ if (_t103) goto L_0209FF70; // else: addr-0 trap, fall-through
   L_0209FF70: ; // 0x209ff70
@@ -22666,23 +22666,23 @@ void Gambit_fn_0209FC3C(CPUState* cpu) {
         /* 020A001C */ _t125 = cpu->r[7] + 0x00000000u;
         /* 020A001C */ cpu->r[0] = rbrew_read16(cpu->mem, _t125);
         /* 020A0020 */ cpu->r[30] = 0x00000000u;
-        /* 020A0024 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 020A0024 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 020A0028 */ cpu->r[9] = 0x00080000u;
-        /* 020A002C */ _t126 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020A002C */ _t126 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020A002C */ _t127 = _t126 & 0x00000001u;
         /* 020A002C */ if (_t127) goto L_020A0054; else goto L_020A0030;
   L_020A0030: ; // 0x20a0030
         /* 020A0030 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020A0034 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[9]);
+        /* 020A0034 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[9]));
         /* 020A0038 */ cpu->r[7] = cpu->r[7] + 0x00000002u;
-        /* 020A003C */ _t128 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020A003C */ _t128 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020A003C */ _t129 = _t128 & 0x00000001u;
         /* 020A003C */ if (_t129) goto L_020A0050; else goto L_020A0040;
   L_020A0040: ; // 0x20a0040
         /* 020A0040 */ _t130 = cpu->r[7] + 0x00000000u;
         /* 020A0040 */ cpu->r[0] = rbrew_read16(cpu->mem, _t130);
-        /* 020A0044 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020A0048 */ _t131 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020A0044 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020A0048 */ _t131 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020A0048 */ _t132 = _t131 & 0x00000001u;
         /* 020A0048 */ if (_t132) goto L_020A004C; else goto L_020A0030;
   L_020A004C: ; // 0x20a004c
@@ -22690,22 +22690,22 @@ void Gambit_fn_0209FC3C(CPUState* cpu) {
   L_020A0050: ; // 0x20a0050
         /* 020A0050 */ cpu->r[30] = 0x00000000u;
   L_020A0054: ; // 0x20a0054
-        /* 020A0054 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 020A0058 */ _t133 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020A0054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 020A0058 */ _t133 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020A0058 */ _t134 = _t133 & 0x00000001u;
         /* 020A0058 */ if (_t134) goto L_020A005C; else goto L_020A006C;
   L_020A005C: ; // 0x20a005c
         /* 020A005C */ cpu->r[12] = cpu->r[30] + cpu->r[24];
         /* 020A0060 */ cpu->r[24] = cpu->r[12] + 0x00000001u;
-        /* 020A0060 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 020A0064 */ _t135 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020A0060 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 020A0064 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020A0064 */ _t136 = _t135 & 0x00000001u;
         /* 020A0064 */ if (_t136) goto L_020A0068; else goto L_020A006C;
   L_020A0068: ; // 0x20a0068
         /* 020A0068 */ cpu->r[24] = 0x00000000u;
   L_020A006C: ; // 0x20a006c
-        /* 020A006C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020A0070 */ _t137 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020A006C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020A0070 */ _t137 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020A0070 */ _t138 = _t137 & 0x00000001u;
         /* 020A0070 */ if (_t138) goto L_020A0074; else goto L_020A00C4;
   L_020A0074: ; // 0x20a0074
@@ -22721,23 +22721,23 @@ void Gambit_fn_0209FC3C(CPUState* cpu) {
         /* 020A008C */ _t142 = cpu->r[10] + 0x00000000u;
         /* 020A008C */ cpu->r[8] = rbrew_read16(cpu->mem, _t142);
         /* 020A0090 */ cpu->r[27] = 0x00000000u;
-        /* 020A0094 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[31]);
+        /* 020A0094 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[31]));
         /* 020A0098 */ cpu->r[5] = 0x00080000u;
-        /* 020A009C */ _t143 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020A009C */ _t143 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020A009C */ _t144 = _t143 & 0x00000001u;
         /* 020A009C */ if (_t144) goto L_020A00C4; else goto L_020A00A0;
   L_020A00A0: ; // 0x20a00a0
         /* 020A00A0 */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 020A00A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[5]);
+        /* 020A00A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[5]));
         /* 020A00A8 */ cpu->r[10] = cpu->r[10] + 0x00000002u;
-        /* 020A00AC */ _t145 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020A00AC */ _t145 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020A00AC */ _t146 = _t145 & 0x00000001u;
         /* 020A00AC */ if (_t146) goto L_020A00C0; else goto L_020A00B0;
   L_020A00B0: ; // 0x20a00b0
         /* 020A00B0 */ _t147 = cpu->r[10] + 0x00000000u;
         /* 020A00B0 */ cpu->r[9] = rbrew_read16(cpu->mem, _t147);
-        /* 020A00B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[31]);
-        /* 020A00B8 */ _t148 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020A00B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[31]));
+        /* 020A00B8 */ _t148 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020A00B8 */ _t149 = _t148 & 0x00000001u;
         /* 020A00B8 */ if (_t149) goto L_020A00BC; else goto L_020A00A0;
   L_020A00BC: ; // 0x20a00bc
@@ -22748,15 +22748,15 @@ void Gambit_fn_0209FC3C(CPUState* cpu) {
         /* 020A00C4 */ _t150 = cpu->r[28] + 0x00000008u;
         /* 020A00C4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t150);
         /* 020A00C8 */ cpu->r[5] = cpu->r[11] - cpu->r[24];
-        /* 020A00CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[5]);
-        /* 020A00D0 */ _t151 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020A00CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[5]));
+        /* 020A00D0 */ _t151 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020A00D0 */ _t152 = _t151 & 0x00000001u;
         /* 020A00D0 */ if (_t152) goto L_020A00D8; else goto L_020A00D4;
   L_020A00D4: ; // 0x20a00d4
         /* 020A00D4 */ cpu->r[27] = cpu->r[5] + 0xFFFFFFFFu;
   L_020A00D8: ; // 0x20a00d8
-        /* 020A00D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020A00DC */ _t153 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020A00D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020A00DC */ _t153 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020A00DC */ _t154 = _t153 & 0x00000001u;
         /* 020A00DC */ if (_t154) goto L_020A00E0; else goto L_020A0130;
   L_020A00E0: ; // 0x20a00e0
@@ -22776,8 +22776,8 @@ void Gambit_fn_0209FC3C(CPUState* cpu) {
         /* 020A0108 */ cpu->r[3] = cpu->r[25];
         /* 020A010C */ rbrew_dispatch(cpu, 0x02d0a6e8u);
         /* 020A0110 */ cpu->r[0] = cpu->r[24] + cpu->r[27];
-        /* 020A0114 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[30]);
-        /* 020A0118 */ _t158 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020A0114 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[30]));
+        /* 020A0118 */ _t158 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020A0118 */ _t159 = _t158 & 0x00000001u;
         /* 020A0118 */ if (_t159) goto L_020A011C; else goto L_020A0124;
   L_020A011C: ; // 0x20a011c
@@ -22803,23 +22803,23 @@ void Gambit_fn_0209FC3C(CPUState* cpu) {
         /* 020A0148 */ _t166 = cpu->r[7] + 0x00000000u;
         /* 020A0148 */ cpu->r[10] = rbrew_read16(cpu->mem, _t166);
         /* 020A014C */ cpu->r[11] = 0x00000000u;
-        /* 020A0150 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[31]);
+        /* 020A0150 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[31]));
         /* 020A0154 */ cpu->r[9] = 0x00080000u;
-        /* 020A0158 */ _t167 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020A0158 */ _t167 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020A0158 */ _t168 = _t167 & 0x00000001u;
         /* 020A0158 */ if (_t168) goto L_020A0180; else goto L_020A015C;
   L_020A015C: ; // 0x20a015c
         /* 020A015C */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 020A0160 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], cpu->r[9]);
+        /* 020A0160 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], cpu->r[9]));
         /* 020A0164 */ cpu->r[7] = cpu->r[7] + 0x00000002u;
-        /* 020A0168 */ _t169 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020A0168 */ _t169 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020A0168 */ _t170 = _t169 & 0x00000001u;
         /* 020A0168 */ if (_t170) goto L_020A017C; else goto L_020A016C;
   L_020A016C: ; // 0x20a016c
         /* 020A016C */ _t171 = cpu->r[7] + 0x00000000u;
         /* 020A016C */ cpu->r[12] = rbrew_read16(cpu->mem, _t171);
-        /* 020A0170 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[31]);
-        /* 020A0174 */ _t172 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020A0170 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[31]));
+        /* 020A0174 */ _t172 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020A0174 */ _t173 = _t172 & 0x00000001u;
         /* 020A0174 */ if (_t173) goto L_020A0178; else goto L_020A015C;
   L_020A0178: ; // 0x20a0178
@@ -22831,17 +22831,17 @@ void Gambit_fn_0209FC3C(CPUState* cpu) {
         /* 020A0180 */ rbrew_write32(cpu->mem, _t174, cpu->r[11]);
         /* 020A0184 */ _t175 = cpu->r[29] + 0x0000001Eu;
         /* 020A0184 */ cpu->r[0] = rbrew_read8(cpu->mem, _t175);
-        /* 020A0188 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020A0188 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020A018C */ cpu->r[31] = 0x00000000u;
-        /* 020A0190 */ _t176 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020A0190 */ _t176 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020A0190 */ _t177 = _t176 & 0x00000001u;
         /* 020A0190 */ if (_t177) goto L_020A01A8; else goto L_020A0194;
   L_020A0194: ; // 0x20a0194
         /* 020A0194 */ _t178 = cpu->r[29] + 0x0000001Cu;
         /* 020A0194 */ cpu->r[3] = rbrew_read16(cpu->mem, _t178);
         /* 020A0198 */ Gambit_fn_0282A11C(cpu);
-        /* 020A019C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000003u);
-        /* 020A01A0 */ _t179 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020A019C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000003u));
+        /* 020A01A0 */ _t179 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020A01A0 */ _t180 = _t179 & 0x00000001u;
         /* 020A01A0 */ if (_t180) goto L_020A01A4; else goto L_020A01A8;
   L_020A01A4: ; // 0x20a01a4
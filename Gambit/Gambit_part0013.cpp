@@ -22,11 +22,11 @@ void Gambit_fn_020B3774(CPUState* cpu) {
         /* 020B4724 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020B4724 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020B4728 */ cpu->r[30] = cpu->r[3];
-        /* 020B4728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020B4728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020B472C */ cpu->r[31] = cpu->r[4];
         /* 020B4730 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020B4730 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020B4734 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4734 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4734 */ _t5 = _t4 & 0x00000001u;
         /* 020B4734 */ if (_t5) goto L_020B4778; else goto L_020B4738;
   L_020B4738: ; // 0x20b4738
@@ -46,8 +46,8 @@ void Gambit_fn_020B3774(CPUState* cpu) {
         /* 020B4760 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020B4764 */ Gambit_fn_02068798(cpu);
         /* 020B4768 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B4768 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B476C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B476C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B476C */ _t10 = _t9 & 0x00000001u;
         /* 020B476C */ if (_t10) goto L_020B4778; else goto L_020B4770;
   L_020B4770: ; // 0x20b4770
@@ -75,8 +75,8 @@ void Gambit_fn_020B377C(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -128,21 +128,21 @@ void Gambit_fn_020B3794(CPUState* cpu) {
         /* 020B379C */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020B37A0 */ /* nop */
         /* 020B37A4 */ cpu->r[29] = cpu->r[3];
-        /* 020B37A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020B37A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020B37A8 */ cpu->r[30] = cpu->r[4];
         /* 020B37AC */ cpu->r[23] = cpu->r[5];
         /* 020B37B0 */ cpu->r[25] = cpu->r[6];
         /* 020B37B4 */ cpu->r[31] = cpu->r[7];
         /* 020B37B8 */ cpu->r[21] = cpu->r[8];
-        /* 020B37BC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B37BC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B37BC */ _t3 = _t2 & 0x00000001u;
         /* 020B37BC */ if (_t3) goto L_020B37C0; else goto L_020B37D0;
   L_020B37C0: ; // 0x20b37c0
         /* 020B37C0 */ cpu->r[3] = 0x0000027Cu;
         /* 020B37C4 */ Gambit_fn_02801A78(cpu);
         /* 020B37C8 */ cpu->r[29] = cpu->r[3];
-        /* 020B37C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020B37CC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B37C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020B37CC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B37CC */ _t5 = _t4 & 0x00000001u;
         /* 020B37CC */ if (_t5) goto L_020B3F20; else goto L_020B37D0;
   L_020B37D0: ; // 0x20b37d0
@@ -169,22 +169,22 @@ void Gambit_fn_020B3794(CPUState* cpu) {
         /* 020B3810 */ rbrew_write32(cpu->mem, _t9, cpu->r[7]);
         /* 020B3814 */ cpu->r[9] = cpu->r[9] + 0x00003FFCu;
         /* 020B3818 */ cpu->r[26] = cpu->r[29] + 0x000001DCu;
-        /* 020B3818 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 020B3818 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 020B381C */ _t10 = cpu->r[29] + 0x0000001Cu;
         /* 020B381C */ rbrew_write32(cpu->mem, _t10, cpu->r[8]);
         /* 020B3820 */ cpu->r[27] = 0x00000000u;
         /* 020B3824 */ cpu->r[31] = cpu->r[26];
         /* 020B3828 */ _t11 = cpu->r[29] + 0x000001C8u;
         /* 020B3828 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
-        /* 020B382C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B382C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B382C */ _t13 = _t12 & 0x00000001u;
         /* 020B382C */ if (_t13) goto L_020B3830; else goto L_020B3840;
   L_020B3830: ; // 0x20b3830
         /* 020B3830 */ cpu->r[3] = 0x00000038u;
         /* 020B3834 */ Gambit_fn_02801A78(cpu);
         /* 020B3838 */ cpu->r[31] = cpu->r[3];
-        /* 020B3838 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020B383C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3838 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020B383C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B383C */ _t15 = _t14 & 0x00000001u;
         /* 020B383C */ if (_t15) goto L_020B3870; else goto L_020B3840;
   L_020B3840: ; // 0x20b3840
@@ -211,22 +211,22 @@ void Gambit_fn_020B3794(CPUState* cpu) {
   L_020B3870: ; // 0x20b3870
         /* 020B3870 */ cpu->r[22] = 0x10010000u;
         /* 020B3874 */ cpu->r[19] = cpu->r[29] + 0x00000214u;
-        /* 020B3874 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[19], 0x00000000u);
+        /* 020B3874 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[19], 0x00000000u));
         /* 020B3878 */ cpu->r[20] = 0x10010000u;
         /* 020B387C */ cpu->r[22] = cpu->r[22] + 0x00003D00u;
         /* 020B3880 */ cpu->r[24] = 0x10010000u;
         /* 020B3884 */ cpu->r[20] = cpu->r[20] + 0x00003CE8u;
         /* 020B3888 */ cpu->r[31] = 0x10110000u;
         /* 020B388C */ cpu->r[24] = cpu->r[24] + 0x00003D18u;
-        /* 020B3890 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3890 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3890 */ _t25 = _t24 & 0x00000001u;
         /* 020B3890 */ if (_t25) goto L_020B3894; else goto L_020B38D4;
   L_020B3894: ; // 0x20b3894
         /* 020B3894 */ cpu->r[3] = 0x0000002Cu;
         /* 020B3898 */ Gambit_fn_02801A78(cpu);
         /* 020B389C */ cpu->r[19] = cpu->r[3];
-        /* 020B389C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[19], 0x00000000u);
-        /* 020B38A0 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B389C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[19], 0x00000000u));
+        /* 020B38A0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B38A0 */ _t27 = _t26 & 0x00000001u;
         /* 020B38A0 */ if (_t27) goto L_020B38A4; else goto L_020B38D4;
   L_020B38A4: ; // 0x20b38a4
@@ -246,26 +246,26 @@ void Gambit_fn_020B3794(CPUState* cpu) {
         /* 020B38C0 */ _t34 = cpu->r[29] + 0x00000240u;
         /* 020B38C0 */ rbrew_write32(cpu->mem, _t34, cpu->r[27]);
         /* 020B38C4 */ cpu->r[23] = cpu->r[29] + 0x00000250u;
-        /* 020B38C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
+        /* 020B38C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
         /* 020B38C8 */ _t35 = cpu->r[29] + 0x00000248u;
         /* 020B38C8 */ rbrew_write_f32(cpu->mem, _t35, cpu->f[0]);
-        /* 020B38CC */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B38CC */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B38CC */ _t37 = _t36 & 0x00000001u;
         /* 020B38CC */ if (_t37) goto L_020B38D0; else goto L_020B3A38;
   L_020B38D0: ; // 0x20b38d0
         /* 020B38D0 */ goto L_020B3A28;
   L_020B38D4: ; // 0x20b38d4
         /* 020B38D4 */ cpu->r[17] = cpu->r[19];
-        /* 020B38D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[17], 0x00000000u);
-        /* 020B38D8 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B38D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[17], 0x00000000u));
+        /* 020B38D8 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B38D8 */ _t39 = _t38 & 0x00000001u;
         /* 020B38D8 */ if (_t39) goto L_020B38DC; else goto L_020B38F8;
   L_020B38DC: ; // 0x20b38dc
         /* 020B38DC */ cpu->r[3] = 0x0000002Cu;
         /* 020B38E0 */ Gambit_fn_02801A78(cpu);
         /* 020B38E4 */ cpu->r[17] = cpu->r[3];
-        /* 020B38E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[17], 0x00000000u);
-        /* 020B38E8 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B38E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[17], 0x00000000u));
+        /* 020B38E8 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B38E8 */ _t41 = _t40 & 0x00000001u;
         /* 020B38E8 */ if (_t41) goto L_020B38EC; else goto L_020B38F8;
   L_020B38EC: ; // 0x20b38ec
@@ -276,15 +276,15 @@ void Gambit_fn_020B3794(CPUState* cpu) {
         /* 020B38F4 */ goto L_020B3A00;
   L_020B38F8: ; // 0x20b38f8
         /* 020B38F8 */ cpu->r[3] = cpu->r[17];
-        /* 020B38F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B38FC */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B38F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B38FC */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B38FC */ _t45 = _t44 & 0x00000001u;
         /* 020B38FC */ if (_t45) goto L_020B3900; else goto L_020B394C;
   L_020B3900: ; // 0x20b3900
         /* 020B3900 */ cpu->r[3] = 0x0000000Cu;
         /* 020B3904 */ Gambit_fn_02801A78(cpu);
-        /* 020B3908 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B390C */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3908 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B390C */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B390C */ _t47 = _t46 & 0x00000001u;
         /* 020B390C */ if (_t47) goto L_020B3910; else goto L_020B394C;
   L_020B3910: ; // 0x20b3910
@@ -306,9 +306,9 @@ void Gambit_fn_020B3794(CPUState* cpu) {
         /* 020B3934 */ _t54 = cpu->r[10] + 0x00000000u;
         /* 020B3934 */ cpu->r[8] = rbrew_read8(cpu->mem, _t54);
         /* 020B3938 */ cpu->r[30] = 0x00000000u;
-        /* 020B393C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[31]);
+        /* 020B393C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[31]));
         /* 020B3940 */ cpu->r[12] = 0x00080000u;
-        /* 020B3944 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3944 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3944 */ _t56 = _t55 & 0x00000001u;
         /* 020B3944 */ if (_t56) goto L_020B3948; else goto L_020B399C;
   L_020B3948: ; // 0x20b3948
@@ -342,23 +342,23 @@ void Gambit_fn_020B3794(CPUState* cpu) {
         /* 020B3988 */ _t67 = cpu->r[10] + 0x00000000u;
         /* 020B3988 */ cpu->r[8] = rbrew_read8(cpu->mem, _t67);
         /* 020B398C */ cpu->r[30] = 0x00000000u;
-        /* 020B3990 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[31]);
+        /* 020B3990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[31]));
         /* 020B3994 */ cpu->r[12] = 0x00080000u;
-        /* 020B3998 */ _t68 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3998 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3998 */ _t69 = _t68 & 0x00000001u;
         /* 020B3998 */ if (_t69) goto L_020B3948; else goto L_020B399C;
   L_020B399C: ; // 0x20b399c
         /* 020B399C */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B39A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[12]);
+        /* 020B39A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[12]));
         /* 020B39A4 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 020B39A8 */ _t70 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B39A8 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B39A8 */ _t71 = _t70 & 0x00000001u;
         /* 020B39A8 */ if (_t71) goto L_020B39BC; else goto L_020B39AC;
   L_020B39AC: ; // 0x20b39ac
         /* 020B39AC */ _t72 = cpu->r[10] + 0x00000000u;
         /* 020B39AC */ cpu->r[0] = rbrew_read8(cpu->mem, _t72);
-        /* 020B39B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020B39B4 */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B39B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020B39B4 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B39B4 */ _t74 = _t73 & 0x00000001u;
         /* 020B39B4 */ if (_t74) goto L_020B39B8; else goto L_020B399C;
   L_020B39B8: ; // 0x20b39b8
@@ -370,10 +370,10 @@ void Gambit_fn_020B3794(CPUState* cpu) {
         /* 020B39C0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t75);
         /* 020B39C4 */ _t76 = cpu->r[23] + 0x00000004u;
         /* 020B39C4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t76);
-        /* 020B39C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[5]);
+        /* 020B39C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[5]));
         /* 020B39CC */ _t77 = cpu->r[10] + 0x00000014u;
         /* 020B39CC */ cpu->r[0] = rbrew_read32(cpu->mem, _t77);
-        /* 020B39D0 */ _t78 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B39D0 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B39D0 */ _t79 = _t78 & 0x00000001u;
         /* 020B39D0 */ if (_t79) goto L_020B39D8; else goto L_020B39D4;
   L_020B39D4: ; // 0x20b39d4
@@ -396,7 +396,7 @@ void Gambit_fn_020B3794(CPUState* cpu) {
         /* 020B3A00 */ _t83 = cpu->r[29] + 0x00000244u;
         /* 020B3A00 */ rbrew_write32(cpu->mem, _t83, cpu->r[21]);
         /* 020B3A04 */ cpu->r[23] = cpu->r[29] + 0x00000250u;
-        /* 020B3A04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
+        /* 020B3A04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
         /* 020B3A08 */ _t84 = cpu->r[29] + 0x00000240u;
         /* 020B3A08 */ rbrew_write32(cpu->mem, _t84, cpu->r[27]);
         /* 020B3A0C */ cpu->r[7] = 0x10010000u;
@@ -410,42 +410,42 @@ void Gambit_fn_020B3794(CPUState* cpu) {
         /* 020B3A1C */ rbrew_write8(cpu->mem, _t88, (uint8_t)cpu->r[27]);
         /* 020B3A20 */ _t89 = cpu->r[29] + 0x00000248u;
         /* 020B3A20 */ rbrew_write_f32(cpu->mem, _t89, cpu->f[0]);
-        /* 020B3A24 */ _t90 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3A24 */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3A24 */ _t91 = _t90 & 0x00000001u;
         /* 020B3A24 */ if (_t91) goto L_020B3A28; else goto L_020B3A38;
   L_020B3A28: ; // 0x20b3a28
         /* 020B3A28 */ cpu->r[3] = 0x0000002Cu;
         /* 020B3A2C */ Gambit_fn_02801A78(cpu);
         /* 020B3A30 */ cpu->r[23] = cpu->r[3];
-        /* 020B3A30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
-        /* 020B3A34 */ _t92 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3A30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
+        /* 020B3A34 */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3A34 */ _t93 = _t92 & 0x00000001u;
         /* 020B3A34 */ if (_t93) goto L_020B3B18; else goto L_020B3A38;
   L_020B3A38: ; // 0x20b3a38
         /* 020B3A38 */ cpu->r[21] = cpu->r[23];
-        /* 020B3A38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 020B3A3C */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3A38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 020B3A3C */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3A3C */ _t95 = _t94 & 0x00000001u;
         /* 020B3A3C */ if (_t95) goto L_020B3A40; else goto L_020B3A50;
   L_020B3A40: ; // 0x20b3a40
         /* 020B3A40 */ cpu->r[3] = 0x0000002Cu;
         /* 020B3A44 */ Gambit_fn_02801A78(cpu);
         /* 020B3A48 */ cpu->r[21] = cpu->r[3];
-        /* 020B3A48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 020B3A4C */ _t96 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3A48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 020B3A4C */ _t96 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3A4C */ _t97 = _t96 & 0x00000001u;
         /* 020B3A4C */ if (_t97) goto L_020B3B14; else goto L_020B3A50;
   L_020B3A50: ; // 0x20b3a50
         /* 020B3A50 */ cpu->r[3] = cpu->r[21];
-        /* 020B3A50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B3A54 */ _t98 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3A50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B3A54 */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3A54 */ _t99 = _t98 & 0x00000001u;
         /* 020B3A54 */ if (_t99) goto L_020B3A58; else goto L_020B3A68;
   L_020B3A58: ; // 0x20b3a58
         /* 020B3A58 */ cpu->r[3] = 0x0000000Cu;
         /* 020B3A5C */ Gambit_fn_02801A78(cpu);
-        /* 020B3A60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B3A64 */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3A60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B3A64 */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3A64 */ _t101 = _t100 & 0x00000001u;
         /* 020B3A64 */ if (_t101) goto L_020B3A80; else goto L_020B3A68;
   L_020B3A68: ; // 0x20b3a68
@@ -476,23 +476,23 @@ void Gambit_fn_020B3794(CPUState* cpu) {
         /* 020B3AA0 */ _t111 = cpu->r[5] + 0x00000000u;
         /* 020B3AA0 */ cpu->r[10] = rbrew_read8(cpu->mem, _t111);
         /* 020B3AA4 */ cpu->r[30] = 0x00000000u;
-        /* 020B3AA8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[31]);
+        /* 020B3AA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[31]));
         /* 020B3AAC */ cpu->r[8] = 0x00080000u;
-        /* 020B3AB0 */ _t112 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3AB0 */ _t112 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3AB0 */ _t113 = _t112 & 0x00000001u;
         /* 020B3AB0 */ if (_t113) goto L_020B3AD8; else goto L_020B3AB4;
   L_020B3AB4: ; // 0x20b3ab4
         /* 020B3AB4 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B3AB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[8]);
+        /* 020B3AB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[8]));
         /* 020B3ABC */ cpu->r[5] = cpu->r[5] + 0x00000001u;
-        /* 020B3AC0 */ _t114 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B3AC0 */ _t114 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B3AC0 */ _t115 = _t114 & 0x00000001u;
         /* 020B3AC0 */ if (_t115) goto L_020B3AD4; else goto L_020B3AC4;
   L_020B3AC4: ; // 0x20b3ac4
         /* 020B3AC4 */ _t116 = cpu->r[5] + 0x00000000u;
         /* 020B3AC4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t116);
-        /* 020B3AC8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020B3ACC */ _t117 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3AC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020B3ACC */ _t117 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3ACC */ _t118 = _t117 & 0x00000001u;
         /* 020B3ACC */ if (_t118) goto L_020B3AD0; else goto L_020B3AB4;
   L_020B3AD0: ; // 0x20b3ad0
@@ -502,10 +502,10 @@ void Gambit_fn_020B3794(CPUState* cpu) {
   L_020B3AD8: ; // 0x20b3ad8
         /* 020B3AD8 */ _t119 = cpu->r[21] + 0x00000008u;
         /* 020B3AD8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t119);
-        /* 020B3ADC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[6]);
+        /* 020B3ADC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[6]));
         /* 020B3AE0 */ _t120 = cpu->r[25] + 0x00000004u;
         /* 020B3AE0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t120);
-        /* 020B3AE4 */ _t121 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B3AE4 */ _t121 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B3AE4 */ _t122 = _t121 & 0x00000001u;
         /* 020B3AE4 */ if (_t122) goto L_020B3AEC; else goto L_020B3AE8;
   L_020B3AE8: ; // 0x20b3ae8
@@ -556,23 +556,23 @@ void Gambit_fn_020B3794(CPUState* cpu) {
         /* 020B3B64 */ _t133 = cpu->r[9] + 0x00000000u;
         /* 020B3B64 */ cpu->r[12] = rbrew_read8(cpu->mem, _t133);
         /* 020B3B68 */ cpu->r[30] = 0x00000000u;
-        /* 020B3B6C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[31]);
+        /* 020B3B6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[31]));
         /* 020B3B70 */ cpu->r[11] = 0x00080000u;
-        /* 020B3B74 */ _t134 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3B74 */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3B74 */ _t135 = _t134 & 0x00000001u;
         /* 020B3B74 */ if (_t135) goto L_020B3B9C; else goto L_020B3B78;
   L_020B3B78: ; // 0x20b3b78
         /* 020B3B78 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B3B7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[11]);
+        /* 020B3B7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[11]));
         /* 020B3B80 */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 020B3B84 */ _t136 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B3B84 */ _t136 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B3B84 */ _t137 = _t136 & 0x00000001u;
         /* 020B3B84 */ if (_t137) goto L_020B3B98; else goto L_020B3B88;
   L_020B3B88: ; // 0x20b3b88
         /* 020B3B88 */ _t138 = cpu->r[9] + 0x00000000u;
         /* 020B3B88 */ cpu->r[0] = rbrew_read8(cpu->mem, _t138);
-        /* 020B3B8C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020B3B90 */ _t139 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3B8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020B3B90 */ _t139 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3B90 */ _t140 = _t139 & 0x00000001u;
         /* 020B3B90 */ if (_t140) goto L_020B3B94; else goto L_020B3B78;
   L_020B3B94: ; // 0x20b3b94
@@ -582,8 +582,8 @@ void Gambit_fn_020B3794(CPUState* cpu) {
   L_020B3B9C: ; // 0x20b3b9c
         /* 020B3B9C */ _t141 = cpu->r[23] + 0x00000008u;
         /* 020B3B9C */ cpu->r[7] = rbrew_read32(cpu->mem, _t141);
-        /* 020B3BA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
-        /* 020B3BA4 */ _t142 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B3BA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
+        /* 020B3BA4 */ _t142 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B3BA4 */ _t143 = _t142 & 0x00000001u;
         /* 020B3BA4 */ if (_t143) goto L_020B3BAC; else goto L_020B3BA8;
   L_020B3BA8: ; // 0x20b3ba8
@@ -642,10 +642,10 @@ void Gambit_fn_020B3794(CPUState* cpu) {
         /* 020B3C34 */ rbrew_write32(cpu->mem, _t159, cpu->r[0]);
         /* 020B3C38 */ _t160 = cpu->r[26] + 0x00000014u;
         /* 020B3C38 */ cpu->r[10] = rbrew_read32(cpu->mem, _t160);
-        /* 020B3C3C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000001u);
+        /* 020B3C3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000001u));
         /* 020B3C40 */ _t161 = cpu->r[26] + 0x00000018u;
         /* 020B3C40 */ cpu->r[30] = rbrew_read32(cpu->mem, _t161);
-        /* 020B3C44 */ _t162 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B3C44 */ _t162 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B3C44 */ _t163 = _t162 & 0x00000001u;
         /* 020B3C44 */ if (_t163) goto L_020B3C48; else goto L_020B3C4C;
   L_020B3C48: ; // 0x20b3c48
@@ -661,23 +661,23 @@ void Gambit_fn_020B3794(CPUState* cpu) {
         /* 020B3C60 */ _t166 = cpu->r[7] + 0x00000000u;
         /* 020B3C60 */ cpu->r[0] = rbrew_read8(cpu->mem, _t166);
         /* 020B3C64 */ cpu->r[24] = 0x00000000u;
-        /* 020B3C68 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 020B3C68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 020B3C6C */ cpu->r[8] = 0x00080000u;
-        /* 020B3C70 */ _t167 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3C70 */ _t167 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3C70 */ _t168 = _t167 & 0x00000001u;
         /* 020B3C70 */ if (_t168) goto L_020B3C98; else goto L_020B3C74;
   L_020B3C74: ; // 0x20b3c74
         /* 020B3C74 */ cpu->r[24] = cpu->r[24] + 0x00000001u;
-        /* 020B3C78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], cpu->r[8]);
+        /* 020B3C78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], cpu->r[8]));
         /* 020B3C7C */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 020B3C80 */ _t169 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B3C80 */ _t169 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B3C80 */ _t170 = _t169 & 0x00000001u;
         /* 020B3C80 */ if (_t170) goto L_020B3C94; else goto L_020B3C84;
   L_020B3C84: ; // 0x20b3c84
         /* 020B3C84 */ _t171 = cpu->r[7] + 0x00000000u;
         /* 020B3C84 */ cpu->r[0] = rbrew_read8(cpu->mem, _t171);
-        /* 020B3C88 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020B3C8C */ _t172 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3C88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020B3C8C */ _t172 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3C8C */ _t173 = _t172 & 0x00000001u;
         /* 020B3C8C */ if (_t173) goto L_020B3C90; else goto L_020B3C74;
   L_020B3C90: ; // 0x20b3c90
@@ -689,10 +689,10 @@ void Gambit_fn_020B3794(CPUState* cpu) {
         /* 020B3C98 */ cpu->r[9] = rbrew_read32(cpu->mem, _t174);
         /* 020B3C9C */ _t175 = cpu->r[1] + 0x00000010u;
         /* 020B3C9C */ cpu->r[6] = rbrew_read32(cpu->mem, _t175);
-        /* 020B3CA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], cpu->r[9]);
+        /* 020B3CA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], cpu->r[9]));
         /* 020B3CA4 */ _t176 = cpu->r[6] + 0x00000014u;
         /* 020B3CA4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t176);
-        /* 020B3CA8 */ _t177 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B3CA8 */ _t177 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B3CA8 */ _t178 = _t177 & 0x00000001u;
         /* 020B3CA8 */ if (_t178) goto L_020B3CB0; else goto L_020B3CAC;
   L_020B3CAC: ; // 0x20b3cac
@@ -747,10 +747,10 @@ void Gambit_fn_020B3794(CPUState* cpu) {
         /* 020B3D30 */ rbrew_write32(cpu->mem, _t192, cpu->r[0]);
         /* 020B3D34 */ _t193 = cpu->r[26] + 0x00000014u;
         /* 020B3D34 */ cpu->r[10] = rbrew_read32(cpu->mem, _t193);
-        /* 020B3D38 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000002u);
+        /* 020B3D38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000002u));
         /* 020B3D3C */ _t194 = cpu->r[26] + 0x00000018u;
         /* 020B3D3C */ cpu->r[24] = rbrew_read32(cpu->mem, _t194);
-        /* 020B3D40 */ _t195 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B3D40 */ _t195 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B3D40 */ _t196 = _t195 & 0x00000001u;
         /* 020B3D40 */ if (_t196) goto L_020B3D44; else goto L_020B3D48;
   L_020B3D44: ; // 0x20b3d44
@@ -766,23 +766,23 @@ void Gambit_fn_020B3794(CPUState* cpu) {
         /* 020B3D5C */ _t199 = cpu->r[11] + 0x00000000u;
         /* 020B3D5C */ cpu->r[0] = rbrew_read8(cpu->mem, _t199);
         /* 020B3D60 */ cpu->r[30] = 0x00000000u;
-        /* 020B3D64 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 020B3D64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 020B3D68 */ cpu->r[0] = 0x00080000u;
-        /* 020B3D6C */ _t200 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3D6C */ _t200 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3D6C */ _t201 = _t200 & 0x00000001u;
         /* 020B3D6C */ if (_t201) goto L_020B3D94; else goto L_020B3D70;
   L_020B3D70: ; // 0x20b3d70
         /* 020B3D70 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B3D74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 020B3D74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 020B3D78 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 020B3D7C */ _t202 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B3D7C */ _t202 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B3D7C */ _t203 = _t202 & 0x00000001u;
         /* 020B3D7C */ if (_t203) goto L_020B3D90; else goto L_020B3D80;
   L_020B3D80: ; // 0x20b3d80
         /* 020B3D80 */ _t204 = cpu->r[11] + 0x00000000u;
         /* 020B3D80 */ cpu->r[12] = rbrew_read8(cpu->mem, _t204);
-        /* 020B3D84 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[31]);
-        /* 020B3D88 */ _t205 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3D84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[31]));
+        /* 020B3D88 */ _t205 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3D88 */ _t206 = _t205 & 0x00000001u;
         /* 020B3D88 */ if (_t206) goto L_020B3D8C; else goto L_020B3D70;
   L_020B3D8C: ; // 0x20b3d8c
@@ -794,10 +794,10 @@ void Gambit_fn_020B3794(CPUState* cpu) {
         /* 020B3D94 */ cpu->r[11] = rbrew_read32(cpu->mem, _t207);
         /* 020B3D98 */ _t208 = cpu->r[1] + 0x00000010u;
         /* 020B3D98 */ cpu->r[5] = rbrew_read32(cpu->mem, _t208);
-        /* 020B3D9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[11]);
+        /* 020B3D9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[11]));
         /* 020B3DA0 */ _t209 = cpu->r[5] + 0x00000014u;
         /* 020B3DA0 */ cpu->r[6] = rbrew_read32(cpu->mem, _t209);
-        /* 020B3DA4 */ _t210 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B3DA4 */ _t210 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B3DA4 */ _t211 = _t210 & 0x00000001u;
         /* 020B3DA4 */ if (_t211) goto L_020B3DAC; else goto L_020B3DA8;
   L_020B3DA8: ; // 0x20b3da8
@@ -852,10 +852,10 @@ void Gambit_fn_020B3794(CPUState* cpu) {
         /* 020B3E2C */ rbrew_write32(cpu->mem, _t225, cpu->r[8]);
         /* 020B3E30 */ _t226 = cpu->r[26] + 0x00000014u;
         /* 020B3E30 */ cpu->r[9] = rbrew_read32(cpu->mem, _t226);
-        /* 020B3E34 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000003u);
+        /* 020B3E34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000003u));
         /* 020B3E38 */ _t227 = cpu->r[26] + 0x00000018u;
         /* 020B3E38 */ cpu->r[28] = rbrew_read32(cpu->mem, _t227);
-        /* 020B3E3C */ _t228 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B3E3C */ _t228 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B3E3C */ _t229 = _t228 & 0x00000001u;
         /* 020B3E3C */ if (_t229) goto L_020B3E40; else goto L_020B3E44;
   L_020B3E40: ; // 0x20b3e40
@@ -871,23 +871,23 @@ void Gambit_fn_020B3794(CPUState* cpu) {
         /* 020B3E58 */ _t232 = cpu->r[6] + 0x00000000u;
         /* 020B3E58 */ cpu->r[10] = rbrew_read8(cpu->mem, _t232);
         /* 020B3E5C */ cpu->r[30] = 0x00000000u;
-        /* 020B3E60 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[31]);
+        /* 020B3E60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[31]));
         /* 020B3E64 */ cpu->r[8] = 0x00080000u;
-        /* 020B3E68 */ _t233 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3E68 */ _t233 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3E68 */ _t234 = _t233 & 0x00000001u;
         /* 020B3E68 */ if (_t234) goto L_020B3E90; else goto L_020B3E6C;
   L_020B3E6C: ; // 0x20b3e6c
         /* 020B3E6C */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B3E70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[8]);
+        /* 020B3E70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[8]));
         /* 020B3E74 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 020B3E78 */ _t235 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B3E78 */ _t235 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B3E78 */ _t236 = _t235 & 0x00000001u;
         /* 020B3E78 */ if (_t236) goto L_020B3E8C; else goto L_020B3E7C;
   L_020B3E7C: ; // 0x20b3e7c
         /* 020B3E7C */ _t237 = cpu->r[6] + 0x00000000u;
         /* 020B3E7C */ cpu->r[11] = rbrew_read8(cpu->mem, _t237);
-        /* 020B3E80 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[31]);
-        /* 020B3E84 */ _t238 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3E80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[31]));
+        /* 020B3E84 */ _t238 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3E84 */ _t239 = _t238 & 0x00000001u;
         /* 020B3E84 */ if (_t239) goto L_020B3E88; else goto L_020B3E6C;
   L_020B3E88: ; // 0x20b3e88
@@ -897,8 +897,8 @@ void Gambit_fn_020B3794(CPUState* cpu) {
   L_020B3E90: ; // 0x20b3e90
         /* 020B3E90 */ _t240 = cpu->r[28] + 0x00000008u;
         /* 020B3E90 */ cpu->r[12] = rbrew_read32(cpu->mem, _t240);
-        /* 020B3E94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[12]);
-        /* 020B3E98 */ _t241 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B3E94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[12]));
+        /* 020B3E98 */ _t241 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B3E98 */ _t242 = _t241 & 0x00000001u;
         /* 020B3E98 */ if (_t242) goto L_020B3EA0; else goto L_020B3E9C;
   L_020B3E9C: ; // 0x20b3e9c
@@ -973,21 +973,21 @@ void Gambit_fn_020B3798(CPUState* cpu) {
         /* 020B379C */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020B37A0 */ /* nop */
         /* 020B37A4 */ cpu->r[29] = cpu->r[3];
-        /* 020B37A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020B37A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020B37A8 */ cpu->r[30] = cpu->r[4];
         /* 020B37AC */ cpu->r[23] = cpu->r[5];
         /* 020B37B0 */ cpu->r[25] = cpu->r[6];
         /* 020B37B4 */ cpu->r[31] = cpu->r[7];
         /* 020B37B8 */ cpu->r[21] = cpu->r[8];
-        /* 020B37BC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B37BC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B37BC */ _t3 = _t2 & 0x00000001u;
         /* 020B37BC */ if (_t3) goto L_020B37C0; else goto L_020B37D0;
   L_020B37C0: ; // 0x20b37c0
         /* 020B37C0 */ cpu->r[3] = 0x0000027Cu;
         /* 020B37C4 */ Gambit_fn_02801A78(cpu);
         /* 020B37C8 */ cpu->r[29] = cpu->r[3];
-        /* 020B37C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020B37CC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B37C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020B37CC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B37CC */ _t5 = _t4 & 0x00000001u;
         /* 020B37CC */ if (_t5) goto L_020B3F20; else goto L_020B37D0;
   L_020B37D0: ; // 0x20b37d0
@@ -1014,22 +1014,22 @@ void Gambit_fn_020B3798(CPUState* cpu) {
         /* 020B3810 */ rbrew_write32(cpu->mem, _t9, cpu->r[7]);
         /* 020B3814 */ cpu->r[9] = cpu->r[9] + 0x00003FFCu;
         /* 020B3818 */ cpu->r[26] = cpu->r[29] + 0x000001DCu;
-        /* 020B3818 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 020B3818 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 020B381C */ _t10 = cpu->r[29] + 0x0000001Cu;
         /* 020B381C */ rbrew_write32(cpu->mem, _t10, cpu->r[8]);
         /* 020B3820 */ cpu->r[27] = 0x00000000u;
         /* 020B3824 */ cpu->r[31] = cpu->r[26];
         /* 020B3828 */ _t11 = cpu->r[29] + 0x000001C8u;
         /* 020B3828 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
-        /* 020B382C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B382C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B382C */ _t13 = _t12 & 0x00000001u;
         /* 020B382C */ if (_t13) goto L_020B3830; else goto L_020B3840;
   L_020B3830: ; // 0x20b3830
         /* 020B3830 */ cpu->r[3] = 0x00000038u;
         /* 020B3834 */ Gambit_fn_02801A78(cpu);
         /* 020B3838 */ cpu->r[31] = cpu->r[3];
-        /* 020B3838 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020B383C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3838 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020B383C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B383C */ _t15 = _t14 & 0x00000001u;
         /* 020B383C */ if (_t15) goto L_020B3870; else goto L_020B3840;
   L_020B3840: ; // 0x20b3840
@@ -1056,22 +1056,22 @@ void Gambit_fn_020B3798(CPUState* cpu) {
   L_020B3870: ; // 0x20b3870
         /* 020B3870 */ cpu->r[22] = 0x10010000u;
         /* 020B3874 */ cpu->r[19] = cpu->r[29] + 0x00000214u;
-        /* 020B3874 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[19], 0x00000000u);
+        /* 020B3874 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[19], 0x00000000u));
         /* 020B3878 */ cpu->r[20] = 0x10010000u;
         /* 020B387C */ cpu->r[22] = cpu->r[22] + 0x00003D00u;
         /* 020B3880 */ cpu->r[24] = 0x10010000u;
         /* 020B3884 */ cpu->r[20] = cpu->r[20] + 0x00003CE8u;
         /* 020B3888 */ cpu->r[31] = 0x10110000u;
         /* 020B388C */ cpu->r[24] = cpu->r[24] + 0x00003D18u;
-        /* 020B3890 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3890 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3890 */ _t25 = _t24 & 0x00000001u;
         /* 020B3890 */ if (_t25) goto L_020B3894; else goto L_020B38D4;
   L_020B3894: ; // 0x20b3894
         /* 020B3894 */ cpu->r[3] = 0x0000002Cu;
         /* 020B3898 */ Gambit_fn_02801A78(cpu);
         /* 020B389C */ cpu->r[19] = cpu->r[3];
-        /* 020B389C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[19], 0x00000000u);
-        /* 020B38A0 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B389C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[19], 0x00000000u));
+        /* 020B38A0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B38A0 */ _t27 = _t26 & 0x00000001u;
         /* 020B38A0 */ if (_t27) goto L_020B38A4; else goto L_020B38D4;
   L_020B38A4: ; // 0x20b38a4
@@ -1091,26 +1091,26 @@ void Gambit_fn_020B3798(CPUState* cpu) {
         /* 020B38C0 */ _t34 = cpu->r[29] + 0x00000240u;
         /* 020B38C0 */ rbrew_write32(cpu->mem, _t34, cpu->r[27]);
         /* 020B38C4 */ cpu->r[23] = cpu->r[29] + 0x00000250u;
-        /* 020B38C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
+        /* 020B38C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
         /* 020B38C8 */ _t35 = cpu->r[29] + 0x00000248u;
         /* 020B38C8 */ rbrew_write_f32(cpu->mem, _t35, cpu->f[0]);
-        /* 020B38CC */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B38CC */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B38CC */ _t37 = _t36 & 0x00000001u;
         /* 020B38CC */ if (_t37) goto L_020B38D0; else goto L_020B3A38;
   L_020B38D0: ; // 0x20b38d0
         /* 020B38D0 */ goto L_020B3A28;
   L_020B38D4: ; // 0x20b38d4
         /* 020B38D4 */ cpu->r[17] = cpu->r[19];
-        /* 020B38D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[17], 0x00000000u);
-        /* 020B38D8 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B38D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[17], 0x00000000u));
+        /* 020B38D8 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B38D8 */ _t39 = _t38 & 0x00000001u;
         /* 020B38D8 */ if (_t39) goto L_020B38DC; else goto L_020B38F8;
   L_020B38DC: ; // 0x20b38dc
         /* 020B38DC */ cpu->r[3] = 0x0000002Cu;
         /* 020B38E0 */ Gambit_fn_02801A78(cpu);
         /* 020B38E4 */ cpu->r[17] = cpu->r[3];
-        /* 020B38E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[17], 0x00000000u);
-        /* 020B38E8 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B38E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[17], 0x00000000u));
+        /* 020B38E8 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B38E8 */ _t41 = _t40 & 0x00000001u;
         /* 020B38E8 */ if (_t41) goto L_020B38EC; else goto L_020B38F8;
   L_020B38EC: ; // 0x20b38ec
@@ -1121,15 +1121,15 @@ void Gambit_fn_020B3798(CPUState* cpu) {
         /* 020B38F4 */ goto L_020B3A00;
   L_020B38F8: ; // 0x20b38f8
         /* 020B38F8 */ cpu->r[3] = cpu->r[17];
-        /* 020B38F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B38FC */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B38F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B38FC */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B38FC */ _t45 = _t44 & 0x00000001u;
         /* 020B38FC */ if (_t45) goto L_020B3900; else goto L_020B394C;
   L_020B3900: ; // 0x20b3900
         /* 020B3900 */ cpu->r[3] = 0x0000000Cu;
         /* 020B3904 */ Gambit_fn_02801A78(cpu);
-        /* 020B3908 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B390C */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3908 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B390C */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B390C */ _t47 = _t46 & 0x00000001u;
         /* 020B390C */ if (_t47) goto L_020B3910; else goto L_020B394C;
   L_020B3910: ; // 0x20b3910
@@ -1151,9 +1151,9 @@ void Gambit_fn_020B3798(CPUState* cpu) {
         /* 020B3934 */ _t54 = cpu->r[10] + 0x00000000u;
         /* 020B3934 */ cpu->r[8] = rbrew_read8(cpu->mem, _t54);
         /* 020B3938 */ cpu->r[30] = 0x00000000u;
-        /* 020B393C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[31]);
+        /* 020B393C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[31]));
         /* 020B3940 */ cpu->r[12] = 0x00080000u;
-        /* 020B3944 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3944 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3944 */ _t56 = _t55 & 0x00000001u;
         /* 020B3944 */ if (_t56) goto L_020B3948; else goto L_020B399C;
   L_020B3948: ; // 0x20b3948
@@ -1187,23 +1187,23 @@ void Gambit_fn_020B3798(CPUState* cpu) {
         /* 020B3988 */ _t67 = cpu->r[10] + 0x00000000u;
         /* 020B3988 */ cpu->r[8] = rbrew_read8(cpu->mem, _t67);
         /* 020B398C */ cpu->r[30] = 0x00000000u;
-        /* 020B3990 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[31]);
+        /* 020B3990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[31]));
         /* 020B3994 */ cpu->r[12] = 0x00080000u;
-        /* 020B3998 */ _t68 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3998 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3998 */ _t69 = _t68 & 0x00000001u;
         /* 020B3998 */ if (_t69) goto L_020B3948; else goto L_020B399C;
   L_020B399C: ; // 0x20b399c
         /* 020B399C */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B39A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[12]);
+        /* 020B39A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[12]));
         /* 020B39A4 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 020B39A8 */ _t70 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B39A8 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B39A8 */ _t71 = _t70 & 0x00000001u;
         /* 020B39A8 */ if (_t71) goto L_020B39BC; else goto L_020B39AC;
   L_020B39AC: ; // 0x20b39ac
         /* 020B39AC */ _t72 = cpu->r[10] + 0x00000000u;
         /* 020B39AC */ cpu->r[0] = rbrew_read8(cpu->mem, _t72);
-        /* 020B39B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020B39B4 */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B39B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020B39B4 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B39B4 */ _t74 = _t73 & 0x00000001u;
         /* 020B39B4 */ if (_t74) goto L_020B39B8; else goto L_020B399C;
   L_020B39B8: ; // 0x20b39b8
@@ -1215,10 +1215,10 @@ void Gambit_fn_020B3798(CPUState* cpu) {
         /* 020B39C0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t75);
         /* 020B39C4 */ _t76 = cpu->r[23] + 0x00000004u;
         /* 020B39C4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t76);
-        /* 020B39C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[5]);
+        /* 020B39C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[5]));
         /* 020B39CC */ _t77 = cpu->r[10] + 0x00000014u;
         /* 020B39CC */ cpu->r[0] = rbrew_read32(cpu->mem, _t77);
-        /* 020B39D0 */ _t78 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B39D0 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B39D0 */ _t79 = _t78 & 0x00000001u;
         /* 020B39D0 */ if (_t79) goto L_020B39D8; else goto L_020B39D4;
   L_020B39D4: ; // 0x20b39d4
@@ -1241,7 +1241,7 @@ void Gambit_fn_020B3798(CPUState* cpu) {
         /* 020B3A00 */ _t83 = cpu->r[29] + 0x00000244u;
         /* 020B3A00 */ rbrew_write32(cpu->mem, _t83, cpu->r[21]);
         /* 020B3A04 */ cpu->r[23] = cpu->r[29] + 0x00000250u;
-        /* 020B3A04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
+        /* 020B3A04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
         /* 020B3A08 */ _t84 = cpu->r[29] + 0x00000240u;
         /* 020B3A08 */ rbrew_write32(cpu->mem, _t84, cpu->r[27]);
         /* 020B3A0C */ cpu->r[7] = 0x10010000u;
@@ -1255,42 +1255,42 @@ void Gambit_fn_020B3798(CPUState* cpu) {
         /* 020B3A1C */ rbrew_write8(cpu->mem, _t88, (uint8_t)cpu->r[27]);
         /* 020B3A20 */ _t89 = cpu->r[29] + 0x00000248u;
         /* 020B3A20 */ rbrew_write_f32(cpu->mem, _t89, cpu->f[0]);
-        /* 020B3A24 */ _t90 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3A24 */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3A24 */ _t91 = _t90 & 0x00000001u;
         /* 020B3A24 */ if (_t91) goto L_020B3A28; else goto L_020B3A38;
   L_020B3A28: ; // 0x20b3a28
         /* 020B3A28 */ cpu->r[3] = 0x0000002Cu;
         /* 020B3A2C */ Gambit_fn_02801A78(cpu);
         /* 020B3A30 */ cpu->r[23] = cpu->r[3];
-        /* 020B3A30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
-        /* 020B3A34 */ _t92 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3A30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
+        /* 020B3A34 */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3A34 */ _t93 = _t92 & 0x00000001u;
         /* 020B3A34 */ if (_t93) goto L_020B3B18; else goto L_020B3A38;
   L_020B3A38: ; // 0x20b3a38
         /* 020B3A38 */ cpu->r[21] = cpu->r[23];
-        /* 020B3A38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 020B3A3C */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3A38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 020B3A3C */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3A3C */ _t95 = _t94 & 0x00000001u;
         /* 020B3A3C */ if (_t95) goto L_020B3A40; else goto L_020B3A50;
   L_020B3A40: ; // 0x20b3a40
         /* 020B3A40 */ cpu->r[3] = 0x0000002Cu;
         /* 020B3A44 */ Gambit_fn_02801A78(cpu);
         /* 020B3A48 */ cpu->r[21] = cpu->r[3];
-        /* 020B3A48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 020B3A4C */ _t96 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3A48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 020B3A4C */ _t96 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3A4C */ _t97 = _t96 & 0x00000001u;
         /* 020B3A4C */ if (_t97) goto L_020B3B14; else goto L_020B3A50;
   L_020B3A50: ; // 0x20b3a50
         /* 020B3A50 */ cpu->r[3] = cpu->r[21];
-        /* 020B3A50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B3A54 */ _t98 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3A50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B3A54 */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3A54 */ _t99 = _t98 & 0x00000001u;
         /* 020B3A54 */ if (_t99) goto L_020B3A58; else goto L_020B3A68;
   L_020B3A58: ; // 0x20b3a58
         /* 020B3A58 */ cpu->r[3] = 0x0000000Cu;
         /* 020B3A5C */ Gambit_fn_02801A78(cpu);
-        /* 020B3A60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B3A64 */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3A60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B3A64 */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3A64 */ _t101 = _t100 & 0x00000001u;
         /* 020B3A64 */ if (_t101) goto L_020B3A80; else goto L_020B3A68;
   L_020B3A68: ; // 0x20b3a68
@@ -1321,23 +1321,23 @@ void Gambit_fn_020B3798(CPUState* cpu) {
         /* 020B3AA0 */ _t111 = cpu->r[5] + 0x00000000u;
         /* 020B3AA0 */ cpu->r[10] = rbrew_read8(cpu->mem, _t111);
         /* 020B3AA4 */ cpu->r[30] = 0x00000000u;
-        /* 020B3AA8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[31]);
+        /* 020B3AA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[31]));
         /* 020B3AAC */ cpu->r[8] = 0x00080000u;
-        /* 020B3AB0 */ _t112 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3AB0 */ _t112 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3AB0 */ _t113 = _t112 & 0x00000001u;
         /* 020B3AB0 */ if (_t113) goto L_020B3AD8; else goto L_020B3AB4;
   L_020B3AB4: ; // 0x20b3ab4
         /* 020B3AB4 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B3AB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[8]);
+        /* 020B3AB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[8]));
         /* 020B3ABC */ cpu->r[5] = cpu->r[5] + 0x00000001u;
-        /* 020B3AC0 */ _t114 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B3AC0 */ _t114 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B3AC0 */ _t115 = _t114 & 0x00000001u;
         /* 020B3AC0 */ if (_t115) goto L_020B3AD4; else goto L_020B3AC4;
   L_020B3AC4: ; // 0x20b3ac4
         /* 020B3AC4 */ _t116 = cpu->r[5] + 0x00000000u;
         /* 020B3AC4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t116);
-        /* 020B3AC8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020B3ACC */ _t117 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3AC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020B3ACC */ _t117 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3ACC */ _t118 = _t117 & 0x00000001u;
         /* 020B3ACC */ if (_t118) goto L_020B3AD0; else goto L_020B3AB4;
   L_020B3AD0: ; // 0x20b3ad0
@@ -1347,10 +1347,10 @@ void Gambit_fn_020B3798(CPUState* cpu) {
   L_020B3AD8: ; // 0x20b3ad8
         /* 020B3AD8 */ _t119 = cpu->r[21] + 0x00000008u;
         /* 020B3AD8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t119);
-        /* 020B3ADC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[6]);
+        /* 020B3ADC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[6]));
         /* 020B3AE0 */ _t120 = cpu->r[25] + 0x00000004u;
         /* 020B3AE0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t120);
-        /* 020B3AE4 */ _t121 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B3AE4 */ _t121 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B3AE4 */ _t122 = _t121 & 0x00000001u;
         /* 020B3AE4 */ if (_t122) goto L_020B3AEC; else goto L_020B3AE8;
   L_020B3AE8: ; // 0x20b3ae8
@@ -1401,23 +1401,23 @@ void Gambit_fn_020B3798(CPUState* cpu) {
         /* 020B3B64 */ _t133 = cpu->r[9] + 0x00000000u;
         /* 020B3B64 */ cpu->r[12] = rbrew_read8(cpu->mem, _t133);
         /* 020B3B68 */ cpu->r[30] = 0x00000000u;
-        /* 020B3B6C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[31]);
+        /* 020B3B6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[31]));
         /* 020B3B70 */ cpu->r[11] = 0x00080000u;
-        /* 020B3B74 */ _t134 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3B74 */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3B74 */ _t135 = _t134 & 0x00000001u;
         /* 020B3B74 */ if (_t135) goto L_020B3B9C; else goto L_020B3B78;
   L_020B3B78: ; // 0x20b3b78
         /* 020B3B78 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B3B7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[11]);
+        /* 020B3B7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[11]));
         /* 020B3B80 */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 020B3B84 */ _t136 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B3B84 */ _t136 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B3B84 */ _t137 = _t136 & 0x00000001u;
         /* 020B3B84 */ if (_t137) goto L_020B3B98; else goto L_020B3B88;
   L_020B3B88: ; // 0x20b3b88
         /* 020B3B88 */ _t138 = cpu->r[9] + 0x00000000u;
         /* 020B3B88 */ cpu->r[0] = rbrew_read8(cpu->mem, _t138);
-        /* 020B3B8C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020B3B90 */ _t139 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3B8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020B3B90 */ _t139 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3B90 */ _t140 = _t139 & 0x00000001u;
         /* 020B3B90 */ if (_t140) goto L_020B3B94; else goto L_020B3B78;
   L_020B3B94: ; // 0x20b3b94
@@ -1427,8 +1427,8 @@ void Gambit_fn_020B3798(CPUState* cpu) {
   L_020B3B9C: ; // 0x20b3b9c
         /* 020B3B9C */ _t141 = cpu->r[23] + 0x00000008u;
         /* 020B3B9C */ cpu->r[7] = rbrew_read32(cpu->mem, _t141);
-        /* 020B3BA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
-        /* 020B3BA4 */ _t142 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B3BA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
+        /* 020B3BA4 */ _t142 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B3BA4 */ _t143 = _t142 & 0x00000001u;
         /* 020B3BA4 */ if (_t143) goto L_020B3BAC; else goto L_020B3BA8;
   L_020B3BA8: ; // 0x20b3ba8
@@ -1487,10 +1487,10 @@ void Gambit_fn_020B3798(CPUState* cpu) {
         /* 020B3C34 */ rbrew_write32(cpu->mem, _t159, cpu->r[0]);
         /* 020B3C38 */ _t160 = cpu->r[26] + 0x00000014u;
         /* 020B3C38 */ cpu->r[10] = rbrew_read32(cpu->mem, _t160);
-        /* 020B3C3C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000001u);
+        /* 020B3C3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000001u));
         /* 020B3C40 */ _t161 = cpu->r[26] + 0x00000018u;
         /* 020B3C40 */ cpu->r[30] = rbrew_read32(cpu->mem, _t161);
-        /* 020B3C44 */ _t162 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B3C44 */ _t162 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B3C44 */ _t163 = _t162 & 0x00000001u;
         /* 020B3C44 */ if (_t163) goto L_020B3C48; else goto L_020B3C4C;
   L_020B3C48: ; // 0x20b3c48
@@ -1506,23 +1506,23 @@ void Gambit_fn_020B3798(CPUState* cpu) {
         /* 020B3C60 */ _t166 = cpu->r[7] + 0x00000000u;
         /* 020B3C60 */ cpu->r[0] = rbrew_read8(cpu->mem, _t166);
         /* 020B3C64 */ cpu->r[24] = 0x00000000u;
-        /* 020B3C68 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 020B3C68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 020B3C6C */ cpu->r[8] = 0x00080000u;
-        /* 020B3C70 */ _t167 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3C70 */ _t167 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3C70 */ _t168 = _t167 & 0x00000001u;
         /* 020B3C70 */ if (_t168) goto L_020B3C98; else goto L_020B3C74;
   L_020B3C74: ; // 0x20b3c74
         /* 020B3C74 */ cpu->r[24] = cpu->r[24] + 0x00000001u;
-        /* 020B3C78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], cpu->r[8]);
+        /* 020B3C78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], cpu->r[8]));
         /* 020B3C7C */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 020B3C80 */ _t169 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B3C80 */ _t169 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B3C80 */ _t170 = _t169 & 0x00000001u;
         /* 020B3C80 */ if (_t170) goto L_020B3C94; else goto L_020B3C84;
   L_020B3C84: ; // 0x20b3c84
         /* 020B3C84 */ _t171 = cpu->r[7] + 0x00000000u;
         /* 020B3C84 */ cpu->r[0] = rbrew_read8(cpu->mem, _t171);
-        /* 020B3C88 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020B3C8C */ _t172 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3C88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020B3C8C */ _t172 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3C8C */ _t173 = _t172 & 0x00000001u;
         /* 020B3C8C */ if (_t173) goto L_020B3C90; else goto L_020B3C74;
   L_020B3C90: ; // 0x20b3c90
@@ -1534,10 +1534,10 @@ void Gambit_fn_020B3798(CPUState* cpu) {
         /* 020B3C98 */ cpu->r[9] = rbrew_read32(cpu->mem, _t174);
         /* 020B3C9C */ _t175 = cpu->r[1] + 0x00000010u;
         /* 020B3C9C */ cpu->r[6] = rbrew_read32(cpu->mem, _t175);
-        /* 020B3CA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], cpu->r[9]);
+        /* 020B3CA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], cpu->r[9]));
         /* 020B3CA4 */ _t176 = cpu->r[6] + 0x00000014u;
         /* 020B3CA4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t176);
-        /* 020B3CA8 */ _t177 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B3CA8 */ _t177 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B3CA8 */ _t178 = _t177 & 0x00000001u;
         /* 020B3CA8 */ if (_t178) goto L_020B3CB0; else goto L_020B3CAC;
   L_020B3CAC: ; // 0x20b3cac
@@ -1592,10 +1592,10 @@ void Gambit_fn_020B3798(CPUState* cpu) {
         /* 020B3D30 */ rbrew_write32(cpu->mem, _t192, cpu->r[0]);
         /* 020B3D34 */ _t193 = cpu->r[26] + 0x00000014u;
         /* 020B3D34 */ cpu->r[10] = rbrew_read32(cpu->mem, _t193);
-        /* 020B3D38 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000002u);
+        /* 020B3D38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000002u));
         /* 020B3D3C */ _t194 = cpu->r[26] + 0x00000018u;
         /* 020B3D3C */ cpu->r[24] = rbrew_read32(cpu->mem, _t194);
-        /* 020B3D40 */ _t195 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B3D40 */ _t195 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B3D40 */ _t196 = _t195 & 0x00000001u;
         /* 020B3D40 */ if (_t196) goto L_020B3D44; else goto L_020B3D48;
   L_020B3D44: ; // 0x20b3d44
@@ -1611,23 +1611,23 @@ void Gambit_fn_020B3798(CPUState* cpu) {
         /* 020B3D5C */ _t199 = cpu->r[11] + 0x00000000u;
         /* 020B3D5C */ cpu->r[0] = rbrew_read8(cpu->mem, _t199);
         /* 020B3D60 */ cpu->r[30] = 0x00000000u;
-        /* 020B3D64 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 020B3D64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 020B3D68 */ cpu->r[0] = 0x00080000u;
-        /* 020B3D6C */ _t200 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3D6C */ _t200 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3D6C */ _t201 = _t200 & 0x00000001u;
         /* 020B3D6C */ if (_t201) goto L_020B3D94; else goto L_020B3D70;
   L_020B3D70: ; // 0x20b3d70
         /* 020B3D70 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B3D74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 020B3D74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 020B3D78 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 020B3D7C */ _t202 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B3D7C */ _t202 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B3D7C */ _t203 = _t202 & 0x00000001u;
         /* 020B3D7C */ if (_t203) goto L_020B3D90; else goto L_020B3D80;
   L_020B3D80: ; // 0x20b3d80
         /* 020B3D80 */ _t204 = cpu->r[11] + 0x00000000u;
         /* 020B3D80 */ cpu->r[12] = rbrew_read8(cpu->mem, _t204);
-        /* 020B3D84 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[31]);
-        /* 020B3D88 */ _t205 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3D84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[31]));
+        /* 020B3D88 */ _t205 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3D88 */ _t206 = _t205 & 0x00000001u;
         /* 020B3D88 */ if (_t206) goto L_020B3D8C; else goto L_020B3D70;
   L_020B3D8C: ; // 0x20b3d8c
@@ -1639,10 +1639,10 @@ void Gambit_fn_020B3798(CPUState* cpu) {
         /* 020B3D94 */ cpu->r[11] = rbrew_read32(cpu->mem, _t207);
         /* 020B3D98 */ _t208 = cpu->r[1] + 0x00000010u;
         /* 020B3D98 */ cpu->r[5] = rbrew_read32(cpu->mem, _t208);
-        /* 020B3D9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[11]);
+        /* 020B3D9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[11]));
         /* 020B3DA0 */ _t209 = cpu->r[5] + 0x00000014u;
         /* 020B3DA0 */ cpu->r[6] = rbrew_read32(cpu->mem, _t209);
-        /* 020B3DA4 */ _t210 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B3DA4 */ _t210 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B3DA4 */ _t211 = _t210 & 0x00000001u;
         /* 020B3DA4 */ if (_t211) goto L_020B3DAC; else goto L_020B3DA8;
   L_020B3DA8: ; // 0x20b3da8
@@ -1697,10 +1697,10 @@ void Gambit_fn_020B3798(CPUState* cpu) {
         /* 020B3E2C */ rbrew_write32(cpu->mem, _t225, cpu->r[8]);
         /* 020B3E30 */ _t226 = cpu->r[26] + 0x00000014u;
         /* 020B3E30 */ cpu->r[9] = rbrew_read32(cpu->mem, _t226);
-        /* 020B3E34 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000003u);
+        /* 020B3E34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000003u));
         /* 020B3E38 */ _t227 = cpu->r[26] + 0x00000018u;
         /* 020B3E38 */ cpu->r[28] = rbrew_read32(cpu->mem, _t227);
-        /* 020B3E3C */ _t228 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B3E3C */ _t228 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B3E3C */ _t229 = _t228 & 0x00000001u;
         /* 020B3E3C */ if (_t229) goto L_020B3E40; else goto L_020B3E44;
   L_020B3E40: ; // 0x20b3e40
@@ -1716,23 +1716,23 @@ void Gambit_fn_020B3798(CPUState* cpu) {
         /* 020B3E58 */ _t232 = cpu->r[6] + 0x00000000u;
         /* 020B3E58 */ cpu->r[10] = rbrew_read8(cpu->mem, _t232);
         /* 020B3E5C */ cpu->r[30] = 0x00000000u;
-        /* 020B3E60 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[31]);
+        /* 020B3E60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[31]));
         /* 020B3E64 */ cpu->r[8] = 0x00080000u;
-        /* 020B3E68 */ _t233 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3E68 */ _t233 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3E68 */ _t234 = _t233 & 0x00000001u;
         /* 020B3E68 */ if (_t234) goto L_020B3E90; else goto L_020B3E6C;
   L_020B3E6C: ; // 0x20b3e6c
         /* 020B3E6C */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B3E70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[8]);
+        /* 020B3E70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[8]));
         /* 020B3E74 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 020B3E78 */ _t235 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B3E78 */ _t235 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B3E78 */ _t236 = _t235 & 0x00000001u;
         /* 020B3E78 */ if (_t236) goto L_020B3E8C; else goto L_020B3E7C;
   L_020B3E7C: ; // 0x20b3e7c
         /* 020B3E7C */ _t237 = cpu->r[6] + 0x00000000u;
         /* 020B3E7C */ cpu->r[11] = rbrew_read8(cpu->mem, _t237);
-        /* 020B3E80 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[31]);
-        /* 020B3E84 */ _t238 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3E80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[31]));
+        /* 020B3E84 */ _t238 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3E84 */ _t239 = _t238 & 0x00000001u;
         /* 020B3E84 */ if (_t239) goto L_020B3E88; else goto L_020B3E6C;
   L_020B3E88: ; // 0x20b3e88
@@ -1742,8 +1742,8 @@ void Gambit_fn_020B3798(CPUState* cpu) {
   L_020B3E90: ; // 0x20b3e90
         /* 020B3E90 */ _t240 = cpu->r[28] + 0x00000008u;
         /* 020B3E90 */ cpu->r[12] = rbrew_read32(cpu->mem, _t240);
-        /* 020B3E94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[12]);
-        /* 020B3E98 */ _t241 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B3E94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[12]));
+        /* 020B3E98 */ _t241 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B3E98 */ _t242 = _t241 & 0x00000001u;
         /* 020B3E98 */ if (_t242) goto L_020B3EA0; else goto L_020B3E9C;
   L_020B3E9C: ; // 0x20b3e9c
@@ -1919,8 +1919,8 @@ void Gambit_fn_020B3FA8(CPUState* cpu) {
         /* 020B3FC0 */ _t3 = cpu->r[3] + 0x00003400u;
         /* 020B3FC0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 020B3FC4 */ Gambit_fn_0206C030(cpu);
-        /* 020B3FC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B3FCC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3FC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B3FCC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3FCC */ _t5 = _t4 & 0x00000001u;
         /* 020B3FCC */ if (_t5) goto L_020B3FE4; else goto L_020B3FD0;
   L_020B3FD0: ; // 0x20b3fd0
@@ -1964,8 +1964,8 @@ void Gambit_fn_020B3FAC(CPUState* cpu) {
         /* 020B3FC0 */ _t3 = cpu->r[3] + 0x00003400u;
         /* 020B3FC0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 020B3FC4 */ Gambit_fn_0206C030(cpu);
-        /* 020B3FC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B3FCC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B3FC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B3FCC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B3FCC */ _t5 = _t4 & 0x00000001u;
         /* 020B3FCC */ if (_t5) goto L_020B3FE4; else goto L_020B3FD0;
   L_020B3FD0: ; // 0x20b3fd0
@@ -2155,23 +2155,23 @@ void Gambit_fn_020B406C(CPUState* cpu) {
         /* 020CB980 */ _t26 = cpu->r[9] + 0x00000000u;
         /* 020CB980 */ cpu->r[6] = rbrew_read16(cpu->mem, _t26);
         /* 020CB984 */ cpu->r[12] = 0x00080000u;
-        /* 020CB988 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[30]);
+        /* 020CB988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[30]));
         /* 020CB98C */ cpu->r[31] = 0x00000000u;
-        /* 020CB990 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CB990 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CB990 */ _t28 = _t27 & 0x00000001u;
         /* 020CB990 */ if (_t28) goto L_020CB9B8; else goto L_020CB994;
   L_020CB994: ; // 0x20cb994
         /* 020CB994 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020CB998 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 020CB998 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 020CB99C */ cpu->r[9] = cpu->r[9] + 0x00000002u;
-        /* 020CB9A0 */ _t29 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CB9A0 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CB9A0 */ _t30 = _t29 & 0x00000001u;
         /* 020CB9A0 */ if (_t30) goto L_020CB9B4; else goto L_020CB9A4;
   L_020CB9A4: ; // 0x20cb9a4
         /* 020CB9A4 */ _t31 = cpu->r[9] + 0x00000000u;
         /* 020CB9A4 */ cpu->r[0] = rbrew_read16(cpu->mem, _t31);
-        /* 020CB9A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
-        /* 020CB9AC */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CB9A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
+        /* 020CB9AC */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CB9AC */ _t33 = _t32 & 0x00000001u;
         /* 020CB9AC */ if (_t33) goto L_020CB9B0; else goto L_020CB994;
   L_020CB9B0: ; // 0x20cb9b0
@@ -2190,10 +2190,10 @@ void Gambit_fn_020B406C(CPUState* cpu) {
         /* 020CB9C8 */ rbrew_write_f32(cpu->mem, _t37, cpu->f[0]);
         /* 020CB9CC */ _t38 = cpu->r[6] + 0x000000BCu;
         /* 020CB9CC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t38);
-        /* 020CB9D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[31]);
+        /* 020CB9D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[31]));
         /* 020CB9D4 */ _t39 = cpu->r[1] + 0x0000000Cu;
         /* 020CB9D4 */ rbrew_write_f32(cpu->mem, _t39, cpu->f[0]);
-        /* 020CB9D8 */ _t40 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CB9D8 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CB9D8 */ _t41 = _t40 & 0x00000001u;
         /* 020CB9D8 */ if (_t41) goto L_020CB9DC; else goto L_020CBA38;
   L_020CB9DC: ; // 0x20cb9dc
@@ -2202,10 +2202,10 @@ void Gambit_fn_020B406C(CPUState* cpu) {
   L_020CB9E4: ; // 0x20cb9e4
         /* 020CB9E4 */ _t42 = cpu->r[29] + 0x00000234u;
         /* 020CB9E4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t42);
-        /* 020CB9E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], cpu->r[0]);
+        /* 020CB9E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], cpu->r[0]));
         /* 020CB9EC */ _t43 = cpu->r[29] + 0x00000238u;
         /* 020CB9EC */ cpu->r[10] = rbrew_read32(cpu->mem, _t43);
-        /* 020CB9F0 */ _t44 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CB9F0 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CB9F0 */ _t45 = _t44 & 0x00000001u;
         /* 020CB9F0 */ if (_t45) goto L_020CB9F4; else goto L_020CB9F8;
   L_020CB9F4: ; // 0x20cb9f4
@@ -2220,10 +2220,10 @@ void Gambit_fn_020B406C(CPUState* cpu) {
         /* 020CBA08 */ _t48 = cpu->r[30] + 0x00000002u;
         /* 020CBA08 */ cpu->r[4] = rbrew_read16(cpu->mem, _t48);
         /* 020CBA08 */ cpu->r[30] = _t48;
-        /* 020CBA0C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], cpu->r[11]);
+        /* 020CBA0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], cpu->r[11]));
         /* 020CBA10 */ _t49 = cpu->r[29] + 0x00000238u;
         /* 020CBA10 */ cpu->r[11] = rbrew_read32(cpu->mem, _t49);
-        /* 020CBA14 */ _t50 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CBA14 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CBA14 */ _t51 = _t50 & 0x00000001u;
         /* 020CBA14 */ if (_t51) goto L_020CBA18; else goto L_020CBA1C;
   L_020CBA18: ; // 0x20cba18
@@ -2235,16 +2235,16 @@ void Gambit_fn_020B406C(CPUState* cpu) {
         /* 020CBA24 */ _t53 = cpu->r[29] + 0x00000244u;
         /* 020CBA24 */ cpu->r[31] = rbrew_read32(cpu->mem, _t53);
         /* 020CBA28 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 020CBA2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[31]);
+        /* 020CBA2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[31]));
         /* 020CBA30 */ cpu->r[28] = cpu->r[28] + 0x00000004u;
-        /* 020CBA34 */ _t54 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CBA34 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CBA34 */ _t55 = _t54 & 0x00000001u;
         /* 020CBA34 */ if (_t55) goto L_020CB9E4; else goto L_020CBA38;
   L_020CBA38: ; // 0x20cba38
         /* 020CBA38 */ _t56 = cpu->r[29] + 0x00000240u;
         /* 020CBA38 */ cpu->r[0] = rbrew_read32(cpu->mem, _t56);
-        /* 020CBA3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
-        /* 020CBA40 */ _t57 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CBA3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
+        /* 020CBA40 */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CBA40 */ _t58 = _t57 & 0x00000001u;
         /* 020CBA40 */ if (_t58) goto L_020CBA44; else goto L_020CBA7C;
   L_020CBA44: ; // 0x20cba44
@@ -2252,10 +2252,10 @@ void Gambit_fn_020B406C(CPUState* cpu) {
   L_020CBA48: ; // 0x20cba48
         /* 020CBA48 */ _t59 = cpu->r[29] + 0x00000234u;
         /* 020CBA48 */ cpu->r[0] = rbrew_read32(cpu->mem, _t59);
-        /* 020CBA4C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
+        /* 020CBA4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
         /* 020CBA50 */ _t60 = cpu->r[29] + 0x00000238u;
         /* 020CBA50 */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
-        /* 020CBA54 */ _t61 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CBA54 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CBA54 */ _t62 = _t61 & 0x00000001u;
         /* 020CBA54 */ if (_t62) goto L_020CBA58; else goto L_020CBA5C;
   L_020CBA58: ; // 0x20cba58
@@ -2268,9 +2268,9 @@ void Gambit_fn_020B406C(CPUState* cpu) {
         /* 020CBA68 */ _t64 = cpu->r[29] + 0x00000240u;
         /* 020CBA68 */ cpu->r[6] = rbrew_read32(cpu->mem, _t64);
         /* 020CBA6C */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020CBA70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 020CBA70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 020CBA74 */ cpu->r[30] = cpu->r[30] + 0x00000004u;
-        /* 020CBA78 */ _t65 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CBA78 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CBA78 */ _t66 = _t65 & 0x00000001u;
         /* 020CBA78 */ if (_t66) goto L_020CBA48; else goto L_020CBA7C;
   L_020CBA7C: ; // 0x20cba7c
@@ -2281,8 +2281,8 @@ void Gambit_fn_020B406C(CPUState* cpu) {
         /* 020CBA84 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t68);
         /* 020CBA88 */ _t69 = cpu->r[10] + 0x00000040u;
         /* 020CBA88 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t69);
-        /* 020CBA8C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 020CBA90 */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CBA8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 020CBA90 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CBA90 */ _t71 = _t70 & 0x00000001u;
         /* 020CBA90 */ if (_t71) goto L_020CBA94; else goto L_020CBA9C;
   L_020CBA94: ; // 0x20cba94
@@ -2565,9 +2565,9 @@ void Gambit_fn_020B4128(CPUState* cpu) {
         /* 020B414C */ cpu->r[7] = _t4;
         /* 020B4150 */ cpu->r[31] = cpu->r[3];
         /* 020B4154 */ cpu->r[4] = 0x101D0000u;
-        /* 020B4158 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 020B4158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 020B415C */ cpu->r[4] = cpu->r[4] + 0xFFFFEED0u;
-        /* 020B4160 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4160 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4160 */ _t6 = _t5 & 0x00000001u;
         /* 020B4160 */ if (_t6) goto L_020B4164; else goto L_020B4178;
   L_020B4164: ; // 0x20b4164
@@ -2579,8 +2579,8 @@ void Gambit_fn_020B4128(CPUState* cpu) {
         /* 020B4174 */ _t8 = cpu->r[4] + 0x00000000u;
         /* 020B4174 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
   L_020B4178: ; // 0x20b4178
-        /* 020B4178 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020B417C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020B417C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B417C */ _t10 = _t9 & 0x00000001u;
         /* 020B417C */ if (_t10) goto L_020B419C; else goto L_020B4180;
   L_020B4180: ; // 0x20b4180
@@ -2591,8 +2591,8 @@ void Gambit_fn_020B4128(CPUState* cpu) {
         /* 020B4188 */ cpu->ctr = cpu->r[0];
         /* 020B418C */ cpu->r[3] = cpu->r[31];
         /* 020B4190 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020B4194 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B4198 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4194 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B4198 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4198 */ _t14 = _t13 & 0x00000001u;
         /* 020B4198 */ if (_t14) goto L_020B419C; else goto L_020B41A0;
   L_020B419C: ; // 0x20b419c
@@ -2607,8 +2607,8 @@ void Gambit_fn_020B4128(CPUState* cpu) {
         /* 020B41AC */ cpu->ctr = cpu->r[0];
         /* 020B41B0 */ cpu->r[3] = cpu->r[30];
         /* 020B41B4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020B41B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B41BC */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B41B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B41BC */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B41BC */ _t19 = _t18 & 0x00000001u;
         /* 020B41BC */ if (_t19) goto L_020B41C8; else goto L_020B41C0;
   L_020B41C0: ; // 0x20b41c0
@@ -2649,9 +2649,9 @@ void Gambit_fn_020B412C(CPUState* cpu) {
         /* 020B414C */ cpu->r[7] = _t4;
         /* 020B4150 */ cpu->r[31] = cpu->r[3];
         /* 020B4154 */ cpu->r[4] = 0x101D0000u;
-        /* 020B4158 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 020B4158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 020B415C */ cpu->r[4] = cpu->r[4] + 0xFFFFEED0u;
-        /* 020B4160 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4160 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4160 */ _t6 = _t5 & 0x00000001u;
         /* 020B4160 */ if (_t6) goto L_020B4164; else goto L_020B4178;
   L_020B4164: ; // 0x20b4164
@@ -2663,8 +2663,8 @@ void Gambit_fn_020B412C(CPUState* cpu) {
         /* 020B4174 */ _t8 = cpu->r[4] + 0x00000000u;
         /* 020B4174 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
   L_020B4178: ; // 0x20b4178
-        /* 020B4178 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020B417C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020B417C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B417C */ _t10 = _t9 & 0x00000001u;
         /* 020B417C */ if (_t10) goto L_020B419C; else goto L_020B4180;
   L_020B4180: ; // 0x20b4180
@@ -2675,8 +2675,8 @@ void Gambit_fn_020B412C(CPUState* cpu) {
         /* 020B4188 */ cpu->ctr = cpu->r[0];
         /* 020B418C */ cpu->r[3] = cpu->r[31];
         /* 020B4190 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020B4194 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B4198 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4194 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B4198 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4198 */ _t14 = _t13 & 0x00000001u;
         /* 020B4198 */ if (_t14) goto L_020B419C; else goto L_020B41A0;
   L_020B419C: ; // 0x20b419c
@@ -2691,8 +2691,8 @@ void Gambit_fn_020B412C(CPUState* cpu) {
         /* 020B41AC */ cpu->ctr = cpu->r[0];
         /* 020B41B0 */ cpu->r[3] = cpu->r[30];
         /* 020B41B4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020B41B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B41BC */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B41B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B41BC */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B41BC */ _t19 = _t18 & 0x00000001u;
         /* 020B41BC */ if (_t19) goto L_020B41C8; else goto L_020B41C0;
   L_020B41C0: ; // 0x20b41c0
@@ -2756,8 +2756,8 @@ void Gambit_fn_020B41EC(CPUState* cpu) {
         /* 020B4234 */ _t8 = cpu->r[1] + 0x00000010u;
         /* 020B4234 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020B4238 */ Gambit_fn_027ED060(cpu);
-        /* 020B423C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B4240 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B423C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B4240 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4240 */ _t10 = _t9 & 0x00000001u;
         /* 020B4240 */ if (_t10) goto L_020B4264; else goto L_020B4244;
   L_020B4244: ; // 0x20b4244
@@ -2819,8 +2819,8 @@ void Gambit_fn_020B41F0(CPUState* cpu) {
         /* 020B4234 */ _t8 = cpu->r[1] + 0x00000010u;
         /* 020B4234 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020B4238 */ Gambit_fn_027ED060(cpu);
-        /* 020B423C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B4240 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B423C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B4240 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4240 */ _t10 = _t9 & 0x00000001u;
         /* 020B4240 */ if (_t10) goto L_020B4264; else goto L_020B4244;
   L_020B4244: ; // 0x20b4244
@@ -2944,8 +2944,8 @@ void Gambit_fn_020B42D0(CPUState* cpu) {
         /* 020B4314 */ cpu->r[3] = cpu->r[29];
         /* 020B4318 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 020B431C */ Gambit_fn_027ED2B0(cpu);
-        /* 020B4320 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B4324 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4320 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B4324 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4324 */ _t9 = _t8 & 0x00000001u;
         /* 020B4324 */ if (_t9) goto L_020B4358; else goto L_020B4328;
   L_020B4328: ; // 0x20b4328
@@ -3017,8 +3017,8 @@ void Gambit_fn_020B42D4(CPUState* cpu) {
         /* 020B4314 */ cpu->r[3] = cpu->r[29];
         /* 020B4318 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 020B431C */ Gambit_fn_027ED2B0(cpu);
-        /* 020B4320 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B4324 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4320 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B4324 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4324 */ _t9 = _t8 & 0x00000001u;
         /* 020B4324 */ if (_t9) goto L_020B4358; else goto L_020B4328;
   L_020B4328: ; // 0x20b4328
@@ -3091,8 +3091,8 @@ void Gambit_fn_020B437C(CPUState* cpu) {
         /* 020B43C0 */ cpu->r[3] = cpu->r[29];
         /* 020B43C4 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 020B43C8 */ Gambit_fn_027ED2B0(cpu);
-        /* 020B43CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B43D0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B43CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B43D0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B43D0 */ _t9 = _t8 & 0x00000001u;
         /* 020B43D0 */ if (_t9) goto L_020B4404; else goto L_020B43D4;
   L_020B43D4: ; // 0x20b43d4
@@ -3164,8 +3164,8 @@ void Gambit_fn_020B4380(CPUState* cpu) {
         /* 020B43C0 */ cpu->r[3] = cpu->r[29];
         /* 020B43C4 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 020B43C8 */ Gambit_fn_027ED2B0(cpu);
-        /* 020B43CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B43D0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B43CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B43D0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B43D0 */ _t9 = _t8 & 0x00000001u;
         /* 020B43D0 */ if (_t9) goto L_020B4404; else goto L_020B43D4;
   L_020B43D4: ; // 0x20b43d4
@@ -3219,8 +3219,8 @@ void Gambit_fn_020B442C(CPUState* cpu) {
         /* 020B4438 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020B443C */ _t3 = cpu->r[31] + 0x000001E4u;
         /* 020B443C */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
-        /* 020B4440 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020B4444 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4440 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020B4444 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4444 */ _t5 = _t4 & 0x00000001u;
         /* 020B4444 */ if (_t5) goto L_020B4448; else goto L_020B449C;
   L_020B4448: ; // 0x20b4448
@@ -3263,9 +3263,9 @@ void Gambit_fn_020B442C(CPUState* cpu) {
         /* 020B44AC */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020B44B0 */ _t16 = cpu->r[31] + 0x0000024Cu;
         /* 020B44B0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t16);
-        /* 020B44B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020B44B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020B44B8 */ cpu->r[3] = cpu->r[31];
-        /* 020B44BC */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B44BC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B44BC */ _t18 = _t17 & 0x00000001u;
         /* 020B44BC */ if (_t18) goto L_020B44DC; else goto L_020B44C0;
   L_020B44C0: ; // 0x20b44c0
@@ -3273,8 +3273,8 @@ void Gambit_fn_020B442C(CPUState* cpu) {
         /* 020B44C4 */ cpu->r[4] = cpu->r[3];
         /* 020B44C8 */ cpu->r[3] = cpu->r[31];
         /* 020B44CC */ Gambit_fn_027EDF00(cpu);
-        /* 020B44D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B44D4 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B44D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B44D4 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B44D4 */ _t20 = _t19 & 0x00000001u;
         /* 020B44D4 */ if (_t20) goto L_020B4518; else goto L_020B44D8;
   L_020B44D8: ; // 0x20b44d8
@@ -3284,16 +3284,16 @@ void Gambit_fn_020B442C(CPUState* cpu) {
         /* 020B44E0 */ cpu->r[4] = cpu->r[3];
         /* 020B44E4 */ cpu->r[3] = cpu->r[31];
         /* 020B44E8 */ Gambit_fn_027EDF00(cpu);
-        /* 020B44EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B44F0 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B44EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B44F0 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B44F0 */ _t22 = _t21 & 0x00000001u;
         /* 020B44F0 */ if (_t22) goto L_020B4518; else goto L_020B44F4;
   L_020B44F4: ; // 0x20b44f4
         /* 020B44F4 */ _t23 = cpu->r[31] + 0x00000240u;
         /* 020B44F4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t23);
         /* 020B44F8 */ Gambit_fn_020CB41C(cpu);
-        /* 020B44FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B4500 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B44FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B4500 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4500 */ _t25 = _t24 & 0x00000001u;
         /* 020B4500 */ if (_t25) goto L_020B4518; else goto L_020B4504;
   L_020B4504: ; // 0x20b4504
@@ -3328,8 +3328,8 @@ void Gambit_fn_020B4530(CPUState* cpu) {
         /* 020B453C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020B4540 */ _t3 = cpu->r[31] + 0x000001E4u;
         /* 020B4540 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 020B4544 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B4548 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4544 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B4548 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4548 */ _t5 = _t4 & 0x00000001u;
         /* 020B4548 */ if (_t5) goto L_020B454C; else goto L_020B4574;
   L_020B454C: ; // 0x20b454c
@@ -3355,15 +3355,15 @@ void Gambit_fn_020B4530(CPUState* cpu) {
         /* 020B4584 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020B4588 */ _t10 = cpu->r[31] + 0x0000024Du;
         /* 020B4588 */ cpu->r[12] = rbrew_read8(cpu->mem, _t10);
-        /* 020B458C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020B4590 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B458C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020B4590 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4590 */ _t12 = _t11 & 0x00000001u;
         /* 020B4590 */ if (_t12) goto L_020B4594; else goto L_020B45A0;
   L_020B4594: ; // 0x20b4594
         /* 020B4594 */ _t13 = cpu->r[31] + 0x0000024Eu;
         /* 020B4594 */ cpu->r[0] = rbrew_read8(cpu->mem, _t13);
-        /* 020B4598 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B459C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4598 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B459C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B459C */ _t15 = _t14 & 0x00000001u;
         /* 020B459C */ if (_t15) goto L_020B45BC; else goto L_020B45A0;
   L_020B45A0: ; // 0x20b45a0
@@ -3401,8 +3401,8 @@ void Gambit_fn_020B45D4(CPUState* cpu) {
         /* 020B45E0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020B45E4 */ _t3 = cpu->r[31] + 0x000001E4u;
         /* 020B45E4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t3);
-        /* 020B45E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 020B45EC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B45E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 020B45EC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B45EC */ _t5 = _t4 & 0x00000001u;
         /* 020B45EC */ if (_t5) goto L_020B45F0; else goto L_020B461C;
   L_020B45F0: ; // 0x20b45f0
@@ -3426,8 +3426,8 @@ void Gambit_fn_020B45D4(CPUState* cpu) {
         /* 020B461C */ _t11 = cpu->r[31] + 0x00000240u;
         /* 020B461C */ cpu->r[3] = rbrew_read32(cpu->mem, _t11);
         /* 020B4620 */ Gambit_fn_020CB41C(cpu);
-        /* 020B4624 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B4628 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4624 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B4628 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4628 */ _t13 = _t12 & 0x00000001u;
         /* 020B4628 */ if (_t13) goto L_020B4648; else goto L_020B462C;
   L_020B462C: ; // 0x20b462c
@@ -3447,8 +3447,8 @@ void Gambit_fn_020B45D4(CPUState* cpu) {
         /* 020B4650 */ cpu->r[4] = cpu->r[3];
         /* 020B4654 */ cpu->r[3] = cpu->r[31];
         /* 020B4658 */ Gambit_fn_027EDF00(cpu);
-        /* 020B465C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B4660 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B465C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B4660 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4660 */ _t18 = _t17 & 0x00000001u;
         /* 020B4660 */ if (_t18) goto L_020B46DC; else goto L_020B4664;
   L_020B4664: ; // 0x20b4664
@@ -3457,15 +3457,15 @@ void Gambit_fn_020B45D4(CPUState* cpu) {
         /* 020B4668 */ _t20 = cpu->r[6] + 0x00000118u;
         /* 020B4668 */ cpu->r[8] = rbrew_read32(cpu->mem, _t20);
         /* 020B466C */ cpu->r[7] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 020B466C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 020B4670 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B466C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 020B4670 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4670 */ _t22 = _t21 & 0x00000001u;
         /* 020B4670 */ if (_t22) goto L_020B46DC; else goto L_020B4674;
   L_020B4674: ; // 0x20b4674
         /* 020B4674 */ _t23 = cpu->r[31] + 0x0000024Eu;
         /* 020B4674 */ cpu->r[9] = rbrew_read8(cpu->mem, _t23);
-        /* 020B4678 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 020B467C */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4678 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 020B467C */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B467C */ _t25 = _t24 & 0x00000001u;
         /* 020B467C */ if (_t25) goto L_020B46C8; else goto L_020B4680;
   L_020B4680: ; // 0x20b4680
@@ -3517,15 +3517,15 @@ void Gambit_fn_020B46F0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B46F0: ; // 0x20b46f0
-        /* 020B46F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B46F4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B46F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B46F4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B46F4 */ _t1 = _t0 & 0x00000001u;
         /* 020B46F4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B46F4 */ goto L_020B46F8;
   L_020B46F8: ; // 0x20b46f8
         /* 020B46F8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B46F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B46FC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B46F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B46FC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B46FC */ _t3 = _t2 & 0x00000001u;
         /* 020B46FC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B46FC */ goto L_020B4700;
@@ -3544,8 +3544,8 @@ void Gambit_fn_020B46F0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -3559,15 +3559,15 @@ void Gambit_fn_020B46F0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -3595,15 +3595,15 @@ void Gambit_fn_020B4704(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B4704: ; // 0x20b4704
-        /* 020B4704 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B4708 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4704 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B4708 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4708 */ _t1 = _t0 & 0x00000001u;
         /* 020B4708 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B4708 */ goto L_020B470C;
   L_020B470C: ; // 0x20b470c
         /* 020B470C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B470C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B4710 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B470C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B4710 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4710 */ _t3 = _t2 & 0x00000001u;
         /* 020B4710 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B4710 */ goto L_020B4714;
@@ -3622,8 +3622,8 @@ void Gambit_fn_020B4704(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -3637,15 +3637,15 @@ void Gambit_fn_020B4704(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -3682,11 +3682,11 @@ void Gambit_fn_020B4718(CPUState* cpu) {
         /* 020B4724 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020B4724 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020B4728 */ cpu->r[30] = cpu->r[3];
-        /* 020B4728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020B4728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020B472C */ cpu->r[31] = cpu->r[4];
         /* 020B4730 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020B4730 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020B4734 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4734 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4734 */ _t5 = _t4 & 0x00000001u;
         /* 020B4734 */ if (_t5) goto L_020B4778; else goto L_020B4738;
   L_020B4738: ; // 0x20b4738
@@ -3706,8 +3706,8 @@ void Gambit_fn_020B4718(CPUState* cpu) {
         /* 020B4760 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020B4764 */ Gambit_fn_02068798(cpu);
         /* 020B4768 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B4768 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B476C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B476C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B476C */ _t10 = _t9 & 0x00000001u;
         /* 020B476C */ if (_t10) goto L_020B4778; else goto L_020B4770;
   L_020B4770: ; // 0x20b4770
@@ -3738,11 +3738,11 @@ void Gambit_fn_020B471C(CPUState* cpu) {
         /* 020B4724 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020B4724 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020B4728 */ cpu->r[30] = cpu->r[3];
-        /* 020B4728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020B4728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020B472C */ cpu->r[31] = cpu->r[4];
         /* 020B4730 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020B4730 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020B4734 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4734 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4734 */ _t5 = _t4 & 0x00000001u;
         /* 020B4734 */ if (_t5) goto L_020B4778; else goto L_020B4738;
   L_020B4738: ; // 0x20b4738
@@ -3762,8 +3762,8 @@ void Gambit_fn_020B471C(CPUState* cpu) {
         /* 020B4760 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020B4764 */ Gambit_fn_02068798(cpu);
         /* 020B4768 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B4768 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B476C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B476C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B476C */ _t10 = _t9 & 0x00000001u;
         /* 020B476C */ if (_t10) goto L_020B4778; else goto L_020B4770;
   L_020B4770: ; // 0x20b4770
@@ -3818,15 +3818,15 @@ void Gambit_fn_020B47A8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B47A8: ; // 0x20b47a8
-        /* 020B47A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B47AC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B47A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B47AC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B47AC */ _t1 = _t0 & 0x00000001u;
         /* 020B47AC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B47AC */ goto L_020B47B0;
   L_020B47B0: ; // 0x20b47b0
         /* 020B47B0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B47B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B47B4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B47B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B47B4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B47B4 */ _t3 = _t2 & 0x00000001u;
         /* 020B47B4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B47B4 */ goto L_020B47B8;
@@ -3845,8 +3845,8 @@ void Gambit_fn_020B47A8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -3860,15 +3860,15 @@ void Gambit_fn_020B47A8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -3914,15 +3914,15 @@ void Gambit_fn_020B47D8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B47D8: ; // 0x20b47d8
-        /* 020B47D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B47DC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B47D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B47DC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B47DC */ _t1 = _t0 & 0x00000001u;
         /* 020B47DC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B47DC */ goto L_020B47E0;
   L_020B47E0: ; // 0x20b47e0
         /* 020B47E0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B47E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B47E4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B47E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B47E4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B47E4 */ _t3 = _t2 & 0x00000001u;
         /* 020B47E4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B47E4 */ goto L_020B47E8;
@@ -3941,8 +3941,8 @@ void Gambit_fn_020B47D8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -3956,15 +3956,15 @@ void Gambit_fn_020B47D8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -3992,15 +3992,15 @@ void Gambit_fn_020B47EC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B47EC: ; // 0x20b47ec
-        /* 020B47EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B47F0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B47EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B47F0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B47F0 */ _t1 = _t0 & 0x00000001u;
         /* 020B47F0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B47F0 */ goto L_020B47F4;
   L_020B47F4: ; // 0x20b47f4
         /* 020B47F4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B47F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B47F8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B47F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B47F8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B47F8 */ _t3 = _t2 & 0x00000001u;
         /* 020B47F8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B47F8 */ goto L_020B47FC;
@@ -4019,8 +4019,8 @@ void Gambit_fn_020B47EC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4034,15 +4034,15 @@ void Gambit_fn_020B47EC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4070,15 +4070,15 @@ void Gambit_fn_020B4800(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B4800: ; // 0x20b4800
-        /* 020B4800 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B4804 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4800 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B4804 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4804 */ _t1 = _t0 & 0x00000001u;
         /* 020B4804 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B4804 */ goto L_020B4808;
   L_020B4808: ; // 0x20b4808
         /* 020B4808 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B4808 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B480C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4808 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B480C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B480C */ _t3 = _t2 & 0x00000001u;
         /* 020B480C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B480C */ goto L_020B4810;
@@ -4097,8 +4097,8 @@ void Gambit_fn_020B4800(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4112,15 +4112,15 @@ void Gambit_fn_020B4800(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4243,10 +4243,10 @@ void Gambit_fn_020B4864(CPUState* cpu) {
         /* 020B4864 */ cpu->r[12] = 0x101D0000u;
         /* 020B4868 */ _t0 = cpu->r[12] + 0xFFFFEED4u;
         /* 020B4868 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 020B486C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 020B486C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 020B4870 */ cpu->r[12] = 0x101D0000u;
         /* 020B4874 */ cpu->r[12] = cpu->r[12] + 0xFFFFEED8u;
-        /* 020B4878 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4878 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4878 */ _t2 = _t1 & 0x00000001u;
         /* 020B4878 */ if (_t2) goto L_020B487C; else goto L_020B4894;
   L_020B487C: ; // 0x20b487c
@@ -4259,8 +4259,8 @@ void Gambit_fn_020B4864(CPUState* cpu) {
         /* 020B4890 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 020B4890 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_020B4894: ; // 0x20b4894
-        /* 020B4894 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 020B4898 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4894 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 020B4898 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4898 */ _t6 = _t5 & 0x00000001u;
         /* 020B4898 */ if (_t6) goto L_020B489C; else goto L_020B48A4;
   L_020B489C: ; // 0x20b489c
@@ -4272,9 +4272,9 @@ void Gambit_fn_020B4864(CPUState* cpu) {
         /* 020B48A8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 020B48A8 */ cpu->r[11] = _t7;
         /* 020B48AC */ cpu->r[10] = 0x101D0000u;
-        /* 020B48B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020B48B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020B48B4 */ cpu->r[10] = cpu->r[10] + 0xFFFFED90u;
-        /* 020B48B8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B48B8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B48B8 */ _t9 = _t8 & 0x00000001u;
         /* 020B48B8 */ if (_t9) goto L_020B48BC; else goto L_020B48D0;
   L_020B48BC: ; // 0x20b48bc
@@ -4286,8 +4286,8 @@ void Gambit_fn_020B4864(CPUState* cpu) {
         /* 020B48CC */ _t11 = cpu->r[10] + 0x00000000u;
         /* 020B48CC */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
   L_020B48D0: ; // 0x20b48d0
-        /* 020B48D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 020B48D4 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B48D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 020B48D4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B48D4 */ _t13 = _t12 & 0x00000001u;
         /* 020B48D4 */ if (_t13) goto L_020B48D8; else goto L_020B48E0;
   L_020B48D8: ; // 0x20b48d8
@@ -4299,9 +4299,9 @@ void Gambit_fn_020B4864(CPUState* cpu) {
         /* 020B48E4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 020B48E4 */ cpu->r[8] = _t14;
         /* 020B48E8 */ cpu->r[11] = 0x101D0000u;
-        /* 020B48EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020B48EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020B48F0 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 020B48F4 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B48F4 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B48F4 */ _t16 = _t15 & 0x00000001u;
         /* 020B48F4 */ if (_t16) goto L_020B48F8; else goto L_020B490C;
   L_020B48F8: ; // 0x20b48f8
@@ -4390,18 +4390,18 @@ void Gambit_fn_020B4944(CPUState* cpu) {
         /* 020B4F04 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 020B4F04 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 020B4F08 */ cpu->r[12] = 0x00000000u;
-        /* 020B4F0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020B4F0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020B4F10 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 020B4F10 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 020B4F14 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4F14 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4F14 */ _t6 = _t5 & 0x00000001u;
         /* 020B4F14 */ if (_t6) goto L_020B4F3C; else goto L_020B4F18;
   L_020B4F18: ; // 0x20b4f18
         /* 020B4F18 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 020B4F18 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 020B4F1C */ /* nop */
-        /* 020B4F20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 020B4F24 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4F20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 020B4F24 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4F24 */ _t9 = _t8 & 0x00000001u;
         /* 020B4F24 */ if (_t9) goto L_020B4F28; else goto L_020B4F3C;
   L_020B4F28: ; // 0x20b4f28
@@ -4540,10 +4540,10 @@ void Gambit_fn_020B49A8(CPUState* cpu) {
         /* 020B49C8 */ cpu->r[31] = 0x101D0000u;
         /* 020B49CC */ _t3 = cpu->r[28] + 0x0000001Cu;
         /* 020B49CC */ rbrew_write32(cpu->mem, _t3, cpu->r[4]);
-        /* 020B49D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B49D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B49D4 */ _t4 = cpu->r[28] + 0x0000000Fu;
         /* 020B49D4 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[27]);
-        /* 020B49D8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B49D8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B49D8 */ _t6 = _t5 & 0x00000001u;
         /* 020B49D8 */ if (_t6) goto L_020B4A1C; else goto L_020B49DC;
   L_020B49DC: ; // 0x20b49dc
@@ -4558,16 +4558,16 @@ void Gambit_fn_020B49A8(CPUState* cpu) {
         /* 020B49F0 */ cpu->r[5] = 0x00000004u;
         /* 020B49F4 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020B49F8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020B49FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B49FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B4A00 */ cpu->r[0] = cpu->r[27];
-        /* 020B4A04 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B4A04 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B4A04 */ _t11 = _t10 & 0x00000001u;
         /* 020B4A04 */ if (_t11) goto L_020B4A0C; else goto L_020B4A08;
   L_020B4A08: ; // 0x20b4a08
         /* 020B4A08 */ cpu->r[0] = 0x00000001u;
   L_020B4A0C: ; // 0x20b4a0c
-        /* 020B4A0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B4A10 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4A0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B4A10 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4A10 */ _t13 = _t12 & 0x00000001u;
         /* 020B4A10 */ if (_t13) goto L_020B4A1C; else goto L_020B4A14;
   L_020B4A14: ; // 0x20b4a14
@@ -4579,9 +4579,9 @@ void Gambit_fn_020B49A8(CPUState* cpu) {
         /* 020B4A1C */ _t16 = cpu->r[28] + 0x00000020u;
         /* 020B4A1C */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 020B4A20 */ cpu->r[0] = 0x00000000u;
-        /* 020B4A24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 020B4A24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 020B4A28 */ cpu->r[12] = cpu->r[0];
-        /* 020B4A2C */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B4A2C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B4A2C */ _t18 = _t17 & 0x00000001u;
         /* 020B4A2C */ if (_t18) goto L_020B4A30; else goto L_020B4A54;
   L_020B4A30: ; // 0x20b4a30
@@ -4606,8 +4606,8 @@ void Gambit_fn_020B49A8(CPUState* cpu) {
   L_020B4A54: ; // 0x20b4a54
         /* 020B4A54 */ _t26 = cpu->r[28] + 0x0000000Fu;
         /* 020B4A54 */ cpu->r[27] = rbrew_read8(cpu->mem, _t26);
-        /* 020B4A58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020B4A5C */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4A58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020B4A5C */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4A5C */ _t28 = _t27 & 0x00000001u;
         /* 020B4A5C */ if (_t28) goto L_020B4AA0; else goto L_020B4A60;
   L_020B4A60: ; // 0x20b4a60
@@ -4622,16 +4622,16 @@ void Gambit_fn_020B49A8(CPUState* cpu) {
         /* 020B4A74 */ cpu->r[5] = 0x00000004u;
         /* 020B4A78 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020B4A7C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020B4A80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B4A80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B4A84 */ cpu->r[11] = cpu->r[27];
-        /* 020B4A88 */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B4A88 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B4A88 */ _t33 = _t32 & 0x00000001u;
         /* 020B4A88 */ if (_t33) goto L_020B4A90; else goto L_020B4A8C;
   L_020B4A8C: ; // 0x20b4a8c
         /* 020B4A8C */ cpu->r[11] = 0x00000001u;
   L_020B4A90: ; // 0x20b4a90
-        /* 020B4A90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B4A94 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4A90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B4A94 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4A94 */ _t35 = _t34 & 0x00000001u;
         /* 020B4A94 */ if (_t35) goto L_020B4AA0; else goto L_020B4A98;
   L_020B4A98: ; // 0x20b4a98
@@ -4643,9 +4643,9 @@ void Gambit_fn_020B49A8(CPUState* cpu) {
         /* 020B4AA0 */ _t38 = cpu->r[28] + 0x00000028u;
         /* 020B4AA0 */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 020B4AA4 */ cpu->r[0] = 0x00000000u;
-        /* 020B4AA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 020B4AA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 020B4AAC */ cpu->r[12] = cpu->r[0];
-        /* 020B4AB0 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B4AB0 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B4AB0 */ _t40 = _t39 & 0x00000001u;
         /* 020B4AB0 */ if (_t40) goto L_020B4AB4; else goto L_020B4AD8;
   L_020B4AB4: ; // 0x20b4ab4
@@ -4670,8 +4670,8 @@ void Gambit_fn_020B49A8(CPUState* cpu) {
   L_020B4AD8: ; // 0x20b4ad8
         /* 020B4AD8 */ _t48 = cpu->r[28] + 0x0000000Fu;
         /* 020B4AD8 */ cpu->r[27] = rbrew_read8(cpu->mem, _t48);
-        /* 020B4ADC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020B4AE0 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4ADC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020B4AE0 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4AE0 */ _t50 = _t49 & 0x00000001u;
         /* 020B4AE0 */ if (_t50) goto L_020B4B24; else goto L_020B4AE4;
   L_020B4AE4: ; // 0x20b4ae4
@@ -4686,16 +4686,16 @@ void Gambit_fn_020B49A8(CPUState* cpu) {
         /* 020B4AF8 */ cpu->r[5] = 0x00000004u;
         /* 020B4AFC */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020B4B00 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020B4B04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B4B04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B4B08 */ cpu->r[10] = cpu->r[27];
-        /* 020B4B0C */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B4B0C */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B4B0C */ _t55 = _t54 & 0x00000001u;
         /* 020B4B0C */ if (_t55) goto L_020B4B14; else goto L_020B4B10;
   L_020B4B10: ; // 0x20b4b10
         /* 020B4B10 */ cpu->r[10] = 0x00000001u;
   L_020B4B14: ; // 0x20b4b14
-        /* 020B4B14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B4B18 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4B14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B4B18 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4B18 */ _t57 = _t56 & 0x00000001u;
         /* 020B4B18 */ if (_t57) goto L_020B4B24; else goto L_020B4B1C;
   L_020B4B1C: ; // 0x20b4b1c
@@ -4707,9 +4707,9 @@ void Gambit_fn_020B49A8(CPUState* cpu) {
         /* 020B4B24 */ _t60 = cpu->r[28] + 0x00000030u;
         /* 020B4B24 */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
         /* 020B4B28 */ cpu->r[0] = 0x00000000u;
-        /* 020B4B2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 020B4B2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 020B4B30 */ cpu->r[5] = cpu->r[0];
-        /* 020B4B34 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B4B34 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B4B34 */ _t62 = _t61 & 0x00000001u;
         /* 020B4B34 */ if (_t62) goto L_020B4B38; else goto L_020B4B5C;
   L_020B4B38: ; // 0x20b4b38
@@ -4734,8 +4734,8 @@ void Gambit_fn_020B49A8(CPUState* cpu) {
   L_020B4B5C: ; // 0x20b4b5c
         /* 020B4B5C */ _t70 = cpu->r[30] + 0x00000000u;
         /* 020B4B5C */ cpu->r[25] = rbrew_read8(cpu->mem, _t70);
-        /* 020B4B60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 020B4B64 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4B60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 020B4B64 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4B64 */ _t72 = _t71 & 0x00000001u;
         /* 020B4B64 */ if (_t72) goto L_020B4C40; else goto L_020B4B68;
   L_020B4B68: ; // 0x20b4b68
@@ -4751,10 +4751,10 @@ void Gambit_fn_020B49A8(CPUState* cpu) {
         /* 020B4B80 */ cpu->r[4] = (uint32_t)((int32_t)cpu->r[25] * (int32_t)0x00000024u);
         /* 020B4B84 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020B4B88 */ cpu->r[24] = cpu->r[3];
-        /* 020B4B8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 020B4B8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 020B4B90 */ cpu->r[30] = cpu->r[25];
         /* 020B4B94 */ cpu->r[7] = 0x00000000u;
-        /* 020B4B98 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B4B98 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B4B98 */ _t77 = _t76 & 0x00000001u;
         /* 020B4B98 */ if (_t77) goto L_020B4BA0; else goto L_020B4B9C;
   L_020B4B9C: ; // 0x20b4b9c
@@ -4767,36 +4767,36 @@ void Gambit_fn_020B49A8(CPUState* cpu) {
         /* 020B4BAC */ cpu->r[23] = 0x00000018u;
   L_020B4BB0: ; // 0x20b4bb0
         /* 020B4BB0 */ cpu->r[27] = cpu->r[24] + cpu->r[22];
-        /* 020B4BB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020B4BB4 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4BB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020B4BB4 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4BB4 */ _t80 = _t79 & 0x00000001u;
         /* 020B4BB4 */ if (_t80) goto L_020B4C24; else goto L_020B4BB8;
   L_020B4BB8: ; // 0x20b4bb8
         /* 020B4BB8 */ cpu->r[26] = cpu->r[27];
-        /* 020B4BB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 020B4BBC */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4BB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 020B4BBC */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4BBC */ _t82 = _t81 & 0x00000001u;
         /* 020B4BBC */ if (_t82) goto L_020B4BC0; else goto L_020B4BD0;
   L_020B4BC0: ; // 0x20b4bc0
         /* 020B4BC0 */ cpu->r[3] = 0x00000024u;
         /* 020B4BC4 */ Gambit_fn_02801A78(cpu);
         /* 020B4BC8 */ cpu->r[26] = cpu->r[3];
-        /* 020B4BC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 020B4BCC */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4BC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 020B4BCC */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4BCC */ _t84 = _t83 & 0x00000001u;
         /* 020B4BCC */ if (_t84) goto L_020B4C18; else goto L_020B4BD0;
   L_020B4BD0: ; // 0x20b4bd0
         /* 020B4BD0 */ cpu->r[11] = cpu->r[26];
-        /* 020B4BD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020B4BD4 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4BD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020B4BD4 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4BD4 */ _t86 = _t85 & 0x00000001u;
         /* 020B4BD4 */ if (_t86) goto L_020B4BD8; else goto L_020B4BE8;
   L_020B4BD8: ; // 0x20b4bd8
         /* 020B4BD8 */ cpu->r[3] = 0x0000000Cu;
         /* 020B4BDC */ Gambit_fn_02801A78(cpu);
         /* 020B4BE0 */ cpu->r[11] = cpu->r[3];
-        /* 020B4BE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020B4BE4 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4BE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020B4BE4 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4BE4 */ _t88 = _t87 & 0x00000001u;
         /* 020B4BE4 */ if (_t88) goto L_020B4C04; else goto L_020B4BE8;
   L_020B4BE8: ; // 0x20b4be8
@@ -4827,14 +4827,14 @@ void Gambit_fn_020B49A8(CPUState* cpu) {
         /* 020B4C20 */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
   L_020B4C24: ; // 0x20b4c24
         /* 020B4C24 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 020B4C24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020B4C24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020B4C28 */ cpu->r[22] = cpu->r[22] + 0x00000024u;
-        /* 020B4C2C */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4C2C */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4C2C */ _t98 = _t97 & 0x00000001u;
         /* 020B4C2C */ if (_t98) goto L_020B4C30; else goto L_020B4BB0;
   L_020B4C30: ; // 0x20b4c30
-        /* 020B4C30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 020B4C34 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4C30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 020B4C34 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4C34 */ _t100 = _t99 & 0x00000001u;
         /* 020B4C34 */ if (_t100) goto L_020B4C40; else goto L_020B4C38;
   L_020B4C38: ; // 0x20b4c38
@@ -4864,10 +4864,10 @@ void Gambit_fn_020B4C58(CPUState* cpu) {
         /* 020B4C5C */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 020B4C60 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 020B4C60 */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 020B4C64 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[12]);
+        /* 020B4C64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[12]));
         /* 020B4C68 */ _t3 = cpu->r[4] + 0x00000000u;
         /* 020B4C68 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 020B4C6C */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B4C6C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B4C6C */ _t5 = _t4 & 0x00000001u;
         /* 020B4C6C */ if (_t5) goto L_020B4C70; else goto L_020B4C78;
   L_020B4C70: ; // 0x20b4c70
@@ -4884,10 +4884,10 @@ void Gambit_fn_020B4C58(CPUState* cpu) {
         /* 020B4C84 */ cpu->r[9] = rbrew_read8(cpu->mem, _t9);
         /* 020B4C88 */ _t10 = cpu->r[3] + 0x00000028u;
         /* 020B4C88 */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 020B4C8C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
+        /* 020B4C8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
         /* 020B4C90 */ _t11 = cpu->r[3] + 0x0000002Cu;
         /* 020B4C90 */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
-        /* 020B4C94 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B4C94 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B4C94 */ _t13 = _t12 & 0x00000001u;
         /* 020B4C94 */ if (_t13) goto L_020B4C98; else goto L_020B4CA0;
   L_020B4C98: ; // 0x20b4c98
@@ -4908,10 +4908,10 @@ void Gambit_fn_020B4C58(CPUState* cpu) {
         /* 020B4CB4 */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
         /* 020B4CB8 */ _t20 = cpu->r[3] + 0x00000034u;
         /* 020B4CB8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 020B4CBC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
+        /* 020B4CBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
         /* 020B4CC0 */ _t21 = cpu->r[6] + 0x00000000u;
         /* 020B4CC0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
-        /* 020B4CC4 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B4CC4 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B4CC4 */ _t23 = _t22 & 0x00000001u;
         /* 020B4CC4 */ if (_t23) goto L_020B4CC8; else goto L_020B4CD0;
   L_020B4CC8: ; // 0x20b4cc8
@@ -4938,10 +4938,10 @@ void Gambit_fn_020B4CE0(CPUState* cpu) {
         /* 020B4CE8 */ _t1 = cpu->r[3] + 0x00000030u;
         /* 020B4CE8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 020B4CEC */ cpu->r[7] = cpu->r[0];
-        /* 020B4CF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 020B4CF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 020B4CF4 */ _t2 = cpu->r[3] + 0x00000034u;
         /* 020B4CF4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 020B4CF8 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B4CF8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B4CF8 */ _t4 = _t3 & 0x00000001u;
         /* 020B4CF8 */ if (_t4) goto L_020B4CFC; else goto L_020B4D14;
   L_020B4CFC: ; // 0x20b4cfc
@@ -4949,8 +4949,8 @@ void Gambit_fn_020B4CE0(CPUState* cpu) {
         /* 020B4D00 */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 020B4D04 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 020B4D04 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 020B4D08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020B4D0C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4D08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020B4D0C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4D0C */ _t7 = _t6 & 0x00000001u;
         /* 020B4D0C */ if (_t7) goto L_020B4D10; else goto L_020B4D20;
   L_020B4D10: ; // 0x20b4d10
@@ -4958,16 +4958,16 @@ void Gambit_fn_020B4CE0(CPUState* cpu) {
   L_020B4D14: ; // 0x20b4d14
         /* 020B4D14 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 020B4D14 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 020B4D18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020B4D1C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4D18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020B4D1C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4D1C */ _t10 = _t9 & 0x00000001u;
         /* 020B4D1C */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B4D1C */ goto L_020B4D20;
   L_020B4D20: ; // 0x20b4d20
-        /* 020B4D20 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 020B4D20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 020B4D24 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 020B4D24 */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 020B4D28 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B4D28 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B4D28 */ _t13 = _t12 & 0x00000001u;
         /* 020B4D28 */ if (_t13) goto L_020B4D2C; else goto L_020B4D34;
   L_020B4D2C: ; // 0x20b4d2c
@@ -4978,11 +4978,11 @@ void Gambit_fn_020B4CE0(CPUState* cpu) {
         /* 020B4D34 */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 020B4D38 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 020B4D38 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 020B4D3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 020B4D3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 020B4D40 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 020B4D40 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 020B4D44 */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 020B4D48 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B4D48 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B4D48 */ _t18 = _t17 & 0x00000001u;
         /* 020B4D48 */ if (_t18) goto L_020B4D60; else goto L_020B4D4C;
   L_020B4D4C: ; // 0x20b4d4c
@@ -5009,10 +5009,10 @@ void Gambit_fn_020B4D68(CPUState* cpu) {
         /* 020B4D70 */ _t1 = cpu->r[3] + 0x00000020u;
         /* 020B4D70 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 020B4D74 */ cpu->r[8] = cpu->r[0];
-        /* 020B4D78 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 020B4D78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 020B4D7C */ _t2 = cpu->r[3] + 0x00000024u;
         /* 020B4D7C */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 020B4D80 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B4D80 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B4D80 */ _t4 = _t3 & 0x00000001u;
         /* 020B4D80 */ if (_t4) goto L_020B4D84; else goto L_020B4D9C;
   L_020B4D84: ; // 0x20b4d84
@@ -5020,8 +5020,8 @@ void Gambit_fn_020B4D68(CPUState* cpu) {
         /* 020B4D88 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 020B4D8C */ _t5 = cpu->r[9] + 0x00000002u;
         /* 020B4D8C */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 020B4D90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020B4D94 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4D90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020B4D94 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4D94 */ _t7 = _t6 & 0x00000001u;
         /* 020B4D94 */ if (_t7) goto L_020B4D98; else goto L_020B4DA8;
   L_020B4D98: ; // 0x20b4d98
@@ -5029,16 +5029,16 @@ void Gambit_fn_020B4D68(CPUState* cpu) {
   L_020B4D9C: ; // 0x20b4d9c
         /* 020B4D9C */ _t8 = cpu->r[12] + 0x00000002u;
         /* 020B4D9C */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 020B4DA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020B4DA4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4DA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020B4DA4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4DA4 */ _t10 = _t9 & 0x00000001u;
         /* 020B4DA4 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B4DA4 */ goto L_020B4DA8;
   L_020B4DA8: ; // 0x20b4da8
-        /* 020B4DA8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 020B4DA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 020B4DAC */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 020B4DAC */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 020B4DB0 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B4DB0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B4DB0 */ _t13 = _t12 & 0x00000001u;
         /* 020B4DB0 */ if (_t13) goto L_020B4DB4; else goto L_020B4DBC;
   L_020B4DB4: ; // 0x20b4db4
@@ -5049,11 +5049,11 @@ void Gambit_fn_020B4D68(CPUState* cpu) {
         /* 020B4DBC */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 020B4DC0 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 020B4DC0 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 020B4DC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020B4DC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020B4DC8 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 020B4DC8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 020B4DCC */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 020B4DD0 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B4DD0 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B4DD0 */ _t18 = _t17 & 0x00000001u;
         /* 020B4DD0 */ if (_t18) goto L_020B4DE8; else goto L_020B4DD4;
   L_020B4DD4: ; // 0x20b4dd4
@@ -5088,9 +5088,9 @@ void Gambit_fn_020B4DF0(CPUState* cpu) {
         /* 020B4E08 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 020B4E08 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 020B4E0C */ /* nop */
-        /* 020B4E10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 020B4E10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 020B4E14 */ cpu->r[31] = cpu->r[4];
-        /* 020B4E18 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4E18 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4E18 */ _t6 = _t5 & 0x00000001u;
         /* 020B4E18 */ if (_t6) goto L_020B4E1C; else goto L_020B4E30;
   L_020B4E1C: ; // 0x20b4e1c
@@ -5139,9 +5139,9 @@ void Gambit_fn_020B4DF4(CPUState* cpu) {
         /* 020B4E08 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 020B4E08 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 020B4E0C */ /* nop */
-        /* 020B4E10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 020B4E10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 020B4E14 */ cpu->r[31] = cpu->r[4];
-        /* 020B4E18 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4E18 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4E18 */ _t6 = _t5 & 0x00000001u;
         /* 020B4E18 */ if (_t6) goto L_020B4E1C; else goto L_020B4E30;
   L_020B4E1C: ; // 0x20b4e1c
@@ -5183,10 +5183,10 @@ void Gambit_fn_020B4E68(CPUState* cpu) {
         /* 020B4E70 */ _t1 = cpu->r[3] + 0x00000028u;
         /* 020B4E70 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 020B4E74 */ cpu->r[8] = cpu->r[0];
-        /* 020B4E78 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 020B4E78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 020B4E7C */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 020B4E7C */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 020B4E80 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B4E80 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B4E80 */ _t4 = _t3 & 0x00000001u;
         /* 020B4E80 */ if (_t4) goto L_020B4E84; else goto L_020B4E9C;
   L_020B4E84: ; // 0x20b4e84
@@ -5194,8 +5194,8 @@ void Gambit_fn_020B4E68(CPUState* cpu) {
         /* 020B4E88 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 020B4E8C */ _t5 = cpu->r[9] + 0x00000002u;
         /* 020B4E8C */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 020B4E90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020B4E94 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4E90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020B4E94 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4E94 */ _t7 = _t6 & 0x00000001u;
         /* 020B4E94 */ if (_t7) goto L_020B4E98; else goto L_020B4EA8;
   L_020B4E98: ; // 0x20b4e98
@@ -5203,16 +5203,16 @@ void Gambit_fn_020B4E68(CPUState* cpu) {
   L_020B4E9C: ; // 0x20b4e9c
         /* 020B4E9C */ _t8 = cpu->r[12] + 0x00000002u;
         /* 020B4E9C */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 020B4EA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020B4EA4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4EA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020B4EA4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4EA4 */ _t10 = _t9 & 0x00000001u;
         /* 020B4EA4 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B4EA4 */ goto L_020B4EA8;
   L_020B4EA8: ; // 0x20b4ea8
-        /* 020B4EA8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 020B4EA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 020B4EAC */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 020B4EAC */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 020B4EB0 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B4EB0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B4EB0 */ _t13 = _t12 & 0x00000001u;
         /* 020B4EB0 */ if (_t13) goto L_020B4EB4; else goto L_020B4EBC;
   L_020B4EB4: ; // 0x20b4eb4
@@ -5223,11 +5223,11 @@ void Gambit_fn_020B4E68(CPUState* cpu) {
         /* 020B4EBC */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 020B4EC0 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 020B4EC0 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 020B4EC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020B4EC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020B4EC8 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 020B4EC8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 020B4ECC */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 020B4ED0 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B4ED0 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B4ED0 */ _t18 = _t17 & 0x00000001u;
         /* 020B4ED0 */ if (_t18) goto L_020B4EE8; else goto L_020B4ED4;
   L_020B4ED4: ; // 0x20b4ed4
@@ -5260,18 +5260,18 @@ void Gambit_fn_020B4EF0(CPUState* cpu) {
         /* 020B4F04 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 020B4F04 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 020B4F08 */ cpu->r[12] = 0x00000000u;
-        /* 020B4F0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020B4F0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020B4F10 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 020B4F10 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 020B4F14 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4F14 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4F14 */ _t6 = _t5 & 0x00000001u;
         /* 020B4F14 */ if (_t6) goto L_020B4F3C; else goto L_020B4F18;
   L_020B4F18: ; // 0x20b4f18
         /* 020B4F18 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 020B4F18 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 020B4F1C */ /* nop */
-        /* 020B4F20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 020B4F24 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4F20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 020B4F24 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4F24 */ _t9 = _t8 & 0x00000001u;
         /* 020B4F24 */ if (_t9) goto L_020B4F28; else goto L_020B4F3C;
   L_020B4F28: ; // 0x20b4f28
@@ -5312,18 +5312,18 @@ void Gambit_fn_020B4EF4(CPUState* cpu) {
         /* 020B4F04 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 020B4F04 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 020B4F08 */ cpu->r[12] = 0x00000000u;
-        /* 020B4F0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020B4F0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020B4F10 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 020B4F10 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 020B4F14 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4F14 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4F14 */ _t6 = _t5 & 0x00000001u;
         /* 020B4F14 */ if (_t6) goto L_020B4F3C; else goto L_020B4F18;
   L_020B4F18: ; // 0x20b4f18
         /* 020B4F18 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 020B4F18 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 020B4F1C */ /* nop */
-        /* 020B4F20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 020B4F24 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B4F20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 020B4F24 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B4F24 */ _t9 = _t8 & 0x00000001u;
         /* 020B4F24 */ if (_t9) goto L_020B4F28; else goto L_020B4F3C;
   L_020B4F28: ; // 0x20b4f28
@@ -5382,8 +5382,8 @@ void Gambit_fn_020B4F60(CPUState* cpu) {
         /* 020B4FAC */ cpu->r[29] = cpu->r[31];
         /* 020B4FB0 */ cpu->r[16] = cpu->r[26] + cpu->r[21];
   L_020B4FB4: ; // 0x20b4fb4
-        /* 020B4FB4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[17], 0x00000002u);
-        /* 020B4FB8 */ _t5 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B4FB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[17], 0x00000002u));
+        /* 020B4FB8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B4FB8 */ _t6 = _t5 & 0x00000001u;
         /* 020B4FB8 */ if (_t6) goto L_020B4FBC; else goto L_020B5014;
   L_020B4FBC: ; // 0x20b4fbc
@@ -5418,9 +5418,9 @@ void Gambit_fn_020B4F60(CPUState* cpu) {
         /* 020B4FFC */ _t19 = cpu->r[8] + 0x00000000u;
         /* 020B4FFC */ cpu->r[12] = rbrew_read8(cpu->mem, _t19);
         /* 020B5000 */ cpu->r[30] = 0x00000000u;
-        /* 020B5004 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[29]);
+        /* 020B5004 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[29]));
         /* 020B5008 */ cpu->r[9] = 0x00080000u;
-        /* 020B500C */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B500C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B500C */ _t21 = _t20 & 0x00000001u;
         /* 020B500C */ if (_t21) goto L_020B5010; else goto L_020B5068;
   L_020B5010: ; // 0x20b5010
@@ -5457,23 +5457,23 @@ void Gambit_fn_020B4F60(CPUState* cpu) {
         /* 020B5054 */ _t34 = cpu->r[8] + 0x00000000u;
         /* 020B5054 */ cpu->r[12] = rbrew_read8(cpu->mem, _t34);
         /* 020B5058 */ cpu->r[30] = 0x00000000u;
-        /* 020B505C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[29]);
+        /* 020B505C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[29]));
         /* 020B5060 */ cpu->r[9] = 0x00080000u;
-        /* 020B5064 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5064 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5064 */ _t36 = _t35 & 0x00000001u;
         /* 020B5064 */ if (_t36) goto L_020B5010; else goto L_020B5068;
   L_020B5068: ; // 0x20b5068
         /* 020B5068 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B506C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[9]);
+        /* 020B506C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[9]));
         /* 020B5070 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 020B5074 */ _t37 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B5074 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B5074 */ _t38 = _t37 & 0x00000001u;
         /* 020B5074 */ if (_t38) goto L_020B5088; else goto L_020B5078;
   L_020B5078: ; // 0x20b5078
         /* 020B5078 */ _t39 = cpu->r[8] + 0x00000000u;
         /* 020B5078 */ cpu->r[0] = rbrew_read8(cpu->mem, _t39);
-        /* 020B507C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[29]);
-        /* 020B5080 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B507C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[29]));
+        /* 020B5080 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5080 */ _t41 = _t40 & 0x00000001u;
         /* 020B5080 */ if (_t41) goto L_020B5084; else goto L_020B5068;
   L_020B5084: ; // 0x20b5084
@@ -5485,10 +5485,10 @@ void Gambit_fn_020B4F60(CPUState* cpu) {
         /* 020B508C */ cpu->r[8] = rbrew_read32(cpu->mem, _t42);
         /* 020B5090 */ _t43 = cpu->r[18] + 0x00000014u;
         /* 020B5090 */ cpu->r[4] = rbrew_read32(cpu->mem, _t43);
-        /* 020B5094 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[8]);
+        /* 020B5094 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[8]));
         /* 020B5098 */ _t44 = cpu->r[4] + 0x00000014u;
         /* 020B5098 */ cpu->r[5] = rbrew_read32(cpu->mem, _t44);
-        /* 020B509C */ _t45 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B509C */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B509C */ _t46 = _t45 & 0x00000001u;
         /* 020B509C */ if (_t46) goto L_020B50A4; else goto L_020B50A0;
   L_020B50A0: ; // 0x20b50a0
@@ -5519,23 +5519,23 @@ void Gambit_fn_020B4F60(CPUState* cpu) {
         /* 020B50E4 */ _t53 = cpu->r[6] + 0x00000000u;
         /* 020B50E4 */ cpu->r[12] = rbrew_read8(cpu->mem, _t53);
         /* 020B50E8 */ cpu->r[30] = 0x00000000u;
-        /* 020B50EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[29]);
+        /* 020B50EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[29]));
         /* 020B50F0 */ cpu->r[7] = 0x00080000u;
-        /* 020B50F4 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B50F4 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B50F4 */ _t55 = _t54 & 0x00000001u;
         /* 020B50F4 */ if (_t55) goto L_020B511C; else goto L_020B50F8;
   L_020B50F8: ; // 0x20b50f8
         /* 020B50F8 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B50FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 020B50FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 020B5100 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 020B5104 */ _t56 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B5104 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B5104 */ _t57 = _t56 & 0x00000001u;
         /* 020B5104 */ if (_t57) goto L_020B5118; else goto L_020B5108;
   L_020B5108: ; // 0x20b5108
         /* 020B5108 */ _t58 = cpu->r[6] + 0x00000000u;
         /* 020B5108 */ cpu->r[0] = rbrew_read8(cpu->mem, _t58);
-        /* 020B510C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[29]);
-        /* 020B5110 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B510C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[29]));
+        /* 020B5110 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5110 */ _t60 = _t59 & 0x00000001u;
         /* 020B5110 */ if (_t60) goto L_020B5114; else goto L_020B50F8;
   L_020B5114: ; // 0x20b5114
@@ -5547,10 +5547,10 @@ void Gambit_fn_020B4F60(CPUState* cpu) {
         /* 020B511C */ cpu->r[10] = rbrew_read32(cpu->mem, _t61);
         /* 020B5120 */ _t62 = cpu->r[18] + 0x00000060u;
         /* 020B5120 */ cpu->r[4] = rbrew_read32(cpu->mem, _t62);
-        /* 020B5124 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[10]);
+        /* 020B5124 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[10]));
         /* 020B5128 */ _t63 = cpu->r[4] + 0x00000014u;
         /* 020B5128 */ cpu->r[5] = rbrew_read32(cpu->mem, _t63);
-        /* 020B512C */ _t64 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B512C */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B512C */ _t65 = _t64 & 0x00000001u;
         /* 020B512C */ if (_t65) goto L_020B5134; else goto L_020B5130;
   L_020B5130: ; // 0x20b5130
@@ -5577,24 +5577,24 @@ void Gambit_fn_020B4F60(CPUState* cpu) {
         /* 020B5164 */ rbrew_write32(cpu->mem, _t71, cpu->r[7]);
         /* 020B5168 */ _t72 = cpu->r[18] + 0x000000B0u;
         /* 020B5168 */ cpu->r[9] = rbrew_read32(cpu->mem, _t72);
-        /* 020B516C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[17], 0x00000002u);
+        /* 020B516C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[17], 0x00000002u));
         /* 020B5170 */ _t73 = cpu->r[16] + 0x000000B0u;
         /* 020B5170 */ rbrew_write32(cpu->mem, _t73, cpu->r[9]);
-        /* 020B5174 */ _t74 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B5174 */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B5174 */ _t75 = _t74 & 0x00000001u;
         /* 020B5174 */ if (_t75) goto L_020B5178; else goto L_020B5188;
   L_020B5178: ; // 0x20b5178
-        /* 020B5178 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[17], 0x00000002u);
+        /* 020B5178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[17], 0x00000002u));
         /* 020B517C */ cpu->r[6] = cpu->r[24] + cpu->r[20];
-        /* 020B5180 */ _t76 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B5180 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B5180 */ _t77 = _t76 & 0x00000001u;
         /* 020B5180 */ if (_t77) goto L_020B5194; else goto L_020B5184;
   L_020B5184: ; // 0x20b5184
         /* 020B5184 */ goto L_020B51C8;
   L_020B5188: ; // 0x20b5188
-        /* 020B5188 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[17], 0x00000002u);
+        /* 020B5188 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[17], 0x00000002u));
         /* 020B518C */ cpu->r[6] = cpu->r[24];
-        /* 020B5190 */ _t78 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B5190 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B5190 */ _t79 = _t78 & 0x00000001u;
         /* 020B5190 */ if (_t79) goto L_020B5194; else goto L_020B51C8;
   L_020B5194: ; // 0x20b5194
@@ -5604,16 +5604,16 @@ void Gambit_fn_020B4F60(CPUState* cpu) {
         /* 020B519C */ cpu->r[17] = cpu->r[17] + 0x00000001u;
         /* 020B51A0 */ cpu->r[21] = cpu->r[21] + 0x000000B4u;
         /* 020B51A4 */ cpu->r[20] = cpu->r[20] + 0x00000004u;
-        /* 020B51A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[17], 0x00000002u);
+        /* 020B51A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[17], 0x00000002u));
         /* 020B51AC */ cpu->r[22] = cpu->r[22] + 0x00000004u;
         /* 020B51B0 */ _t81 = cpu->r[6] + 0x00000000u;
         /* 020B51B0 */ rbrew_write32(cpu->mem, _t81, cpu->r[11]);
-        /* 020B51B4 */ _t82 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B51B4 */ _t82 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B51B4 */ _t83 = _t82 & 0x00000001u;
         /* 020B51B4 */ if (_t83) goto L_020B51B8; else goto L_020B51EC;
   L_020B51B8: ; // 0x20b51b8
-        /* 020B51B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[17], 0x00000002u);
-        /* 020B51BC */ _t84 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B51B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[17], 0x00000002u));
+        /* 020B51BC */ _t84 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B51BC */ _t85 = _t84 & 0x00000001u;
         /* 020B51BC */ if (_t85) goto L_020B4FA4; else goto L_020B51C0;
   L_020B51C0: ; // 0x20b51c0
@@ -5627,10 +5627,10 @@ void Gambit_fn_020B4F60(CPUState* cpu) {
         /* 020B51D4 */ cpu->r[17] = cpu->r[17] + 0x00000001u;
         /* 020B51D8 */ _t87 = cpu->r[6] + 0x00000000u;
         /* 020B51D8 */ rbrew_write32(cpu->mem, _t87, cpu->r[11]);
-        /* 020B51DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[17], 0x00000002u);
+        /* 020B51DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[17], 0x00000002u));
         /* 020B51E0 */ cpu->r[22] = cpu->r[22] + 0x00000004u;
         /* 020B51E4 */ cpu->r[21] = cpu->r[21] + 0x000000B4u;
-        /* 020B51E8 */ _t88 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B51E8 */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B51E8 */ _t89 = _t88 & 0x00000001u;
         /* 020B51E8 */ if (_t89) goto L_020B51B8; else goto L_020B51EC;
   L_020B51EC: ; // 0x20b51ec
@@ -5673,8 +5673,8 @@ void Gambit_fn_020B521C(CPUState* cpu) {
         /* 020B5238 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 020B523C */ cpu->r[29] = 0x00000000u;
         /* 020B5240 */ Gambit_fn_0201A364(cpu);
-        /* 020B5244 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B5248 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5244 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B5248 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5248 */ _t5 = _t4 & 0x00000001u;
         /* 020B5248 */ if (_t5) goto L_020B5488; else goto L_020B524C;
   L_020B524C: ; // 0x20b524c
@@ -5683,11 +5683,11 @@ void Gambit_fn_020B521C(CPUState* cpu) {
         /* 020B5250 */ cpu->r[5] = 0x10110000u;
         /* 020B5254 */ cpu->r[6] = cpu->r[7] + 0xFFFFFFFFu;
         /* 020B5258 */ cpu->r[5] = cpu->r[5] + 0x00007399u;
-        /* 020B525C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000004u);
+        /* 020B525C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000004u));
         /* 020B5260 */ cpu->r[4] = cpu->r[5];
         /* 020B5264 */ _t7 = cpu->r[5] + 0x00000000u;
         /* 020B5264 */ cpu->r[31] = rbrew_read8(cpu->mem, _t7);
-        /* 020B5268 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B5268 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B5268 */ _t9 = _t8 & 0x00000001u;
         /* 020B5268 */ if (_t9) goto L_020B5274; else goto L_020B526C;
   L_020B526C: ; // 0x20b526c
@@ -5720,23 +5720,23 @@ void Gambit_fn_020B521C(CPUState* cpu) {
         /* 020B52B0 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 020B52B0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t18);
         /* 020B52B4 */ cpu->r[30] = 0x00000000u;
-        /* 020B52B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 020B52B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 020B52BC */ cpu->r[11] = 0x00080000u;
-        /* 020B52C0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B52C0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B52C0 */ _t20 = _t19 & 0x00000001u;
         /* 020B52C0 */ if (_t20) goto L_020B52E8; else goto L_020B52C4;
   L_020B52C4: ; // 0x20b52c4
         /* 020B52C4 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B52C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[11]);
+        /* 020B52C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[11]));
         /* 020B52CC */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 020B52D0 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B52D0 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B52D0 */ _t22 = _t21 & 0x00000001u;
         /* 020B52D0 */ if (_t22) goto L_020B52E4; else goto L_020B52D4;
   L_020B52D4: ; // 0x20b52d4
         /* 020B52D4 */ _t23 = cpu->r[10] + 0x00000000u;
         /* 020B52D4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t23);
-        /* 020B52D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020B52DC */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B52D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020B52DC */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B52DC */ _t25 = _t24 & 0x00000001u;
         /* 020B52DC */ if (_t25) goto L_020B52E0; else goto L_020B52C4;
   L_020B52E0: ; // 0x20b52e0
@@ -5748,10 +5748,10 @@ void Gambit_fn_020B521C(CPUState* cpu) {
         /* 020B52E8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t26);
         /* 020B52EC */ _t27 = cpu->r[1] + 0x00000014u;
         /* 020B52EC */ cpu->r[5] = rbrew_read32(cpu->mem, _t27);
-        /* 020B52F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[12]);
+        /* 020B52F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[12]));
         /* 020B52F4 */ _t28 = cpu->r[5] + 0x00000014u;
         /* 020B52F4 */ cpu->r[6] = rbrew_read32(cpu->mem, _t28);
-        /* 020B52F8 */ _t29 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B52F8 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B52F8 */ _t30 = _t29 & 0x00000001u;
         /* 020B52F8 */ if (_t30) goto L_020B5300; else goto L_020B52FC;
   L_020B52FC: ; // 0x20b52fc
@@ -5780,29 +5780,29 @@ void Gambit_fn_020B521C(CPUState* cpu) {
         /* 020B5340 */ cpu->r[7] = cpu->r[4];
         /* 020B5344 */ _t35 = cpu->r[7] + 0x00000000u;
         /* 020B5344 */ cpu->r[8] = rbrew_read8(cpu->mem, _t35);
-        /* 020B5348 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[31]);
+        /* 020B5348 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[31]));
         /* 020B534C */ cpu->r[11] = 0x00000000u;
         /* 020B5350 */ cpu->r[9] = 0x00080000u;
-        /* 020B5354 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5354 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5354 */ _t37 = _t36 & 0x00000001u;
         /* 020B5354 */ if (_t37) goto L_020B538C; else goto L_020B5358;
   L_020B5358: ; // 0x20b5358
         /* 020B5358 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 020B535C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], cpu->r[9]);
+        /* 020B535C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], cpu->r[9]));
         /* 020B5360 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 020B5364 */ _t38 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B5364 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B5364 */ _t39 = _t38 & 0x00000001u;
         /* 020B5364 */ if (_t39) goto L_020B5380; else goto L_020B5368;
   L_020B5368: ; // 0x20b5368
         /* 020B5368 */ _t40 = cpu->r[7] + 0x00000000u;
         /* 020B5368 */ cpu->r[0] = rbrew_read8(cpu->mem, _t40);
-        /* 020B536C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020B5370 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B536C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020B5370 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5370 */ _t42 = _t41 & 0x00000001u;
         /* 020B5370 */ if (_t42) goto L_020B5374; else goto L_020B5358;
   L_020B5374: ; // 0x20b5374
-        /* 020B5374 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000004u);
-        /* 020B5378 */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B5374 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000004u));
+        /* 020B5378 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B5378 */ _t44 = _t43 & 0x00000001u;
         /* 020B5378 */ if (_t44) goto L_020B5394; else goto L_020B537C;
   L_020B537C: ; // 0x20b537c
@@ -5812,8 +5812,8 @@ void Gambit_fn_020B521C(CPUState* cpu) {
         /* 020B5384 */ cpu->r[30] = cpu->r[11];
         /* 020B5388 */ goto L_020B5398;
   L_020B538C: ; // 0x20b538c
-        /* 020B538C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000004u);
-        /* 020B5390 */ _t45 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B538C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000004u));
+        /* 020B5390 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B5390 */ _t46 = _t45 & 0x00000001u;
         /* 020B5390 */ if (_t46) goto L_020B5394; else goto L_020B5398;
   L_020B5394: ; // 0x20b5394
@@ -5891,7 +5891,7 @@ void Gambit_fn_020B521C(CPUState* cpu) {
         /* 020B5440 */ cpu->r[6] = cpu->r[29];
         /* 020B5444 */ cpu->r[4] = cpu->r[27] + 0x00004208u;
         /* 020B5448 */ cpu->r[3] = cpu->r[1] + 0x000000F8u;
-        /* 020B544C */ _t73 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020B544C */ _t73 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020B544C */ _t74 = _t73 & 0x00000001u;
         /* 020B544C */ if (_t74) goto L_020B5450; // else: addr-0 trap, fall-through
   L_020B5450: ; // 0x20b5450
@@ -5909,8 +5909,8 @@ void Gambit_fn_020B521C(CPUState* cpu) {
         /* 020B5470 */ Gambit_fn_027FD390(cpu);
         /* 020B5474 */ _t78 = cpu->r[1] + 0x00000018u;
         /* 020B5474 */ cpu->r[11] = rbrew_read8(cpu->mem, _t78);
-        /* 020B5478 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020B547C */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5478 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020B547C */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B547C */ _t80 = _t79 & 0x00000001u;
         /* 020B547C */ if (_t80) goto L_020B5488; else goto L_020B5480;
   L_020B5480: ; // 0x20b5480
@@ -5957,23 +5957,23 @@ void Gambit_fn_020B54A0(CPUState* cpu) {
         /* 020B54DC */ _t7 = cpu->r[12] + 0x00000000u;
         /* 020B54DC */ cpu->r[10] = rbrew_read8(cpu->mem, _t7);
         /* 020B54E0 */ cpu->r[30] = 0x00000000u;
-        /* 020B54E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[31]);
+        /* 020B54E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[31]));
         /* 020B54E8 */ cpu->r[7] = 0x00080000u;
-        /* 020B54EC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B54EC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B54EC */ _t9 = _t8 & 0x00000001u;
         /* 020B54EC */ if (_t9) goto L_020B5514; else goto L_020B54F0;
   L_020B54F0: ; // 0x20b54f0
         /* 020B54F0 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B54F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 020B54F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 020B54F8 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 020B54FC */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B54FC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B54FC */ _t11 = _t10 & 0x00000001u;
         /* 020B54FC */ if (_t11) goto L_020B5510; else goto L_020B5500;
   L_020B5500: ; // 0x20b5500
         /* 020B5500 */ _t12 = cpu->r[12] + 0x00000000u;
         /* 020B5500 */ cpu->r[0] = rbrew_read8(cpu->mem, _t12);
-        /* 020B5504 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020B5508 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5504 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020B5508 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5508 */ _t14 = _t13 & 0x00000001u;
         /* 020B5508 */ if (_t14) goto L_020B550C; else goto L_020B54F0;
   L_020B550C: ; // 0x20b550c
@@ -5985,10 +5985,10 @@ void Gambit_fn_020B54A0(CPUState* cpu) {
         /* 020B5514 */ cpu->r[8] = rbrew_read32(cpu->mem, _t15);
         /* 020B5518 */ _t16 = cpu->r[28] + 0x00000004u;
         /* 020B5518 */ cpu->r[12] = rbrew_read32(cpu->mem, _t16);
-        /* 020B551C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[8]);
+        /* 020B551C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[8]));
         /* 020B5520 */ _t17 = cpu->r[12] + 0x00000014u;
         /* 020B5520 */ cpu->r[0] = rbrew_read32(cpu->mem, _t17);
-        /* 020B5524 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B5524 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B5524 */ _t19 = _t18 & 0x00000001u;
         /* 020B5524 */ if (_t19) goto L_020B552C; else goto L_020B5528;
   L_020B5528: ; // 0x20b5528
@@ -6039,7 +6039,7 @@ void Gambit_fn_020B54A0(CPUState* cpu) {
         /* 020B55A4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t31);
         /* 020B55A8 */ cpu->r[3] = cpu->r[1] + 0x00000010u;
         /* 020B55AC */ cpu->r[4] = cpu->r[4] + 0x0000421Cu;
-        /* 020B55B0 */ _t32 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020B55B0 */ _t32 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020B55B0 */ _t33 = _t32 & 0x00000001u;
         /* 020B55B0 */ if (_t33) goto L_020B55B4; // else: addr-0 trap, fall-through
   L_020B55B4: ; // 0x20b55b4
@@ -6060,8 +6060,8 @@ void Gambit_fn_020B54A0(CPUState* cpu) {
         /* 020B55DC */ Gambit_fn_027FD390(cpu);
         /* 020B55E0 */ _t37 = cpu->r[29] + 0x00000540u;
         /* 020B55E0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t37);
-        /* 020B55E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B55E8 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B55E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B55E8 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B55E8 */ _t39 = _t38 & 0x00000001u;
         /* 020B55E8 */ if (_t39) goto L_020B5600; else goto L_020B55EC;
   L_020B55EC: ; // 0x20b55ec
@@ -6095,7 +6095,7 @@ void Gambit_fn_020B54A0(CPUState* cpu) {
         /* 020B5634 */ cpu->r[5] = rbrew_read32(cpu->mem, _t47);
         /* 020B5638 */ cpu->r[4] = cpu->r[4] + 0x00004228u;
         /* 020B563C */ cpu->r[3] = cpu->r[1] + 0x00000010u;
-        /* 020B5640 */ _t48 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020B5640 */ _t48 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020B5640 */ _t49 = _t48 & 0x00000001u;
         /* 020B5640 */ if (_t49) goto L_020B5644; // else: addr-0 trap, fall-through
   L_020B5644: ; // 0x20b5644
@@ -6113,8 +6113,8 @@ void Gambit_fn_020B54A0(CPUState* cpu) {
         /* 020B5664 */ Gambit_fn_027FD390(cpu);
         /* 020B5668 */ _t53 = cpu->r[27] + 0x000000B4u;
         /* 020B5668 */ cpu->r[0] = rbrew_read8(cpu->mem, _t53);
-        /* 020B566C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B5670 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B566C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B5670 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5670 */ _t55 = _t54 & 0x00000001u;
         /* 020B5670 */ if (_t55) goto L_020B5688; else goto L_020B5674;
   L_020B5674: ; // 0x20b5674
@@ -6157,10 +6157,10 @@ void Gambit_fn_020B56A0(CPUState* cpu) {
         /* 020B56C4 */ _t6 = cpu->r[3] + 0x0000053Cu;
         /* 020B56C4 */ rbrew_write32(cpu->mem, _t6, cpu->r[4]);
         /* 020B56C8 */ cpu->r[8] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B56C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020B56C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020B56CC */ _t7 = cpu->r[3] + 0x000006B4u;
         /* 020B56CC */ rbrew_write32(cpu->mem, _t7, cpu->r[7]);
-        /* 020B56D0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B56D0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B56D0 */ _t9 = _t8 & 0x00000001u;
         /* 020B56D0 */ if (_t9) goto L_020B56DC; else goto L_020B56D4;
   L_020B56D4: ; // 0x20b56d4
@@ -6170,8 +6170,8 @@ void Gambit_fn_020B56A0(CPUState* cpu) {
         /* 020B56D8 */ rbrew_write32(cpu->mem, _t11, cpu->r[5]);
   L_020B56DC: ; // 0x20b56dc
         /* 020B56DC */ cpu->r[11] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 020B56DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020B56E0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B56DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020B56E0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B56E0 */ _t13 = _t12 & 0x00000001u;
         /* 020B56E0 */ if (_t13) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B56E0 */ goto L_020B56E4;
@@ -6204,8 +6204,8 @@ void Gambit_fn_020B56EC(CPUState* cpu) {
         /* 020B5714 */ cpu->r[4] = cpu->r[26];
         /* 020B5718 */ cpu->r[24] = cpu->r[6];
         /* 020B571C */ Gambit_fn_0201A364(cpu);
-        /* 020B5720 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B5724 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5720 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B5724 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5724 */ _t5 = _t4 & 0x00000001u;
         /* 020B5724 */ if (_t5) goto L_020B5A90; else goto L_020B5728;
   L_020B5728: ; // 0x20b5728
@@ -6213,11 +6213,11 @@ void Gambit_fn_020B56EC(CPUState* cpu) {
         /* 020B5728 */ cpu->r[7] = rbrew_read32(cpu->mem, _t6);
         /* 020B572C */ cpu->r[5] = cpu->r[7] + 0xFFFFFFFFu;
         /* 020B5730 */ cpu->r[12] = 0x10110000u;
-        /* 020B5734 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000004u);
+        /* 020B5734 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000004u));
         /* 020B5738 */ _t7 = cpu->r[12] + 0x00007399u;
         /* 020B5738 */ cpu->r[30] = rbrew_read8(cpu->mem, _t7);
         /* 020B573C */ cpu->r[6] = cpu->r[12] + 0x00007399u;
-        /* 020B5740 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B5740 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B5740 */ _t9 = _t8 & 0x00000001u;
         /* 020B5740 */ if (_t9) goto L_020B574C; else goto L_020B5744;
   L_020B5744: ; // 0x20b5744
@@ -6250,23 +6250,23 @@ void Gambit_fn_020B56EC(CPUState* cpu) {
         /* 020B5788 */ _t18 = cpu->r[7] + 0x00000000u;
         /* 020B5788 */ cpu->r[0] = rbrew_read8(cpu->mem, _t18);
         /* 020B578C */ cpu->r[31] = 0x00000000u;
-        /* 020B5790 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
+        /* 020B5790 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
         /* 020B5794 */ cpu->r[0] = 0x00080000u;
-        /* 020B5798 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5798 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5798 */ _t20 = _t19 & 0x00000001u;
         /* 020B5798 */ if (_t20) goto L_020B57C0; else goto L_020B579C;
   L_020B579C: ; // 0x20b579c
         /* 020B579C */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020B57A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 020B57A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 020B57A4 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 020B57A8 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B57A8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B57A8 */ _t22 = _t21 & 0x00000001u;
         /* 020B57A8 */ if (_t22) goto L_020B57BC; else goto L_020B57AC;
   L_020B57AC: ; // 0x20b57ac
         /* 020B57AC */ _t23 = cpu->r[7] + 0x00000000u;
         /* 020B57AC */ cpu->r[12] = rbrew_read8(cpu->mem, _t23);
-        /* 020B57B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[30]);
-        /* 020B57B4 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B57B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[30]));
+        /* 020B57B4 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B57B4 */ _t25 = _t24 & 0x00000001u;
         /* 020B57B4 */ if (_t25) goto L_020B57B8; else goto L_020B579C;
   L_020B57B8: ; // 0x20b57b8
@@ -6278,10 +6278,10 @@ void Gambit_fn_020B56EC(CPUState* cpu) {
         /* 020B57C0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t26);
         /* 020B57C4 */ _t27 = cpu->r[1] + 0x0000000Cu;
         /* 020B57C4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t27);
-        /* 020B57C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 020B57C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 020B57CC */ _t28 = cpu->r[5] + 0x00000014u;
         /* 020B57CC */ cpu->r[6] = rbrew_read32(cpu->mem, _t28);
-        /* 020B57D0 */ _t29 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B57D0 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B57D0 */ _t30 = _t29 & 0x00000001u;
         /* 020B57D0 */ if (_t30) goto L_020B57D8; else goto L_020B57D4;
   L_020B57D4: ; // 0x20b57d4
@@ -6310,29 +6310,29 @@ void Gambit_fn_020B56EC(CPUState* cpu) {
         /* 020B5818 */ cpu->r[11] = cpu->r[12];
         /* 020B581C */ _t35 = cpu->r[11] + 0x00000000u;
         /* 020B581C */ cpu->r[8] = rbrew_read8(cpu->mem, _t35);
-        /* 020B5820 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[30]);
+        /* 020B5820 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[30]));
         /* 020B5824 */ cpu->r[10] = 0x00000000u;
         /* 020B5828 */ cpu->r[5] = 0x00080000u;
-        /* 020B582C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B582C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B582C */ _t37 = _t36 & 0x00000001u;
         /* 020B582C */ if (_t37) goto L_020B5864; else goto L_020B5830;
   L_020B5830: ; // 0x20b5830
         /* 020B5830 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 020B5834 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], cpu->r[5]);
+        /* 020B5834 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], cpu->r[5]));
         /* 020B5838 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 020B583C */ _t38 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B583C */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B583C */ _t39 = _t38 & 0x00000001u;
         /* 020B583C */ if (_t39) goto L_020B5858; else goto L_020B5840;
   L_020B5840: ; // 0x20b5840
         /* 020B5840 */ _t40 = cpu->r[11] + 0x00000000u;
         /* 020B5840 */ cpu->r[9] = rbrew_read8(cpu->mem, _t40);
-        /* 020B5844 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[30]);
-        /* 020B5848 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[30]));
+        /* 020B5848 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5848 */ _t42 = _t41 & 0x00000001u;
         /* 020B5848 */ if (_t42) goto L_020B584C; else goto L_020B5830;
   L_020B584C: ; // 0x20b584c
-        /* 020B584C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000004u);
-        /* 020B5850 */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B584C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000004u));
+        /* 020B5850 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B5850 */ _t44 = _t43 & 0x00000001u;
         /* 020B5850 */ if (_t44) goto L_020B586C; else goto L_020B5854;
   L_020B5854: ; // 0x20b5854
@@ -6342,8 +6342,8 @@ void Gambit_fn_020B56EC(CPUState* cpu) {
         /* 020B585C */ cpu->r[31] = cpu->r[10];
         /* 020B5860 */ goto L_020B5870;
   L_020B5864: ; // 0x20b5864
-        /* 020B5864 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000004u);
-        /* 020B5868 */ _t45 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B5864 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000004u));
+        /* 020B5868 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B5868 */ _t46 = _t45 & 0x00000001u;
         /* 020B5868 */ if (_t46) goto L_020B586C; else goto L_020B5870;
   L_020B586C: ; // 0x20b586c
@@ -6379,7 +6379,7 @@ void Gambit_fn_020B56EC(CPUState* cpu) {
         /* 020B58B8 */ cpu->r[3] = cpu->r[1] + 0x00000048u;
         /* 020B58BC */ cpu->r[4] = cpu->r[4] + 0x00004234u;
         /* 020B58C0 */ cpu->r[6] = cpu->r[24];
-        /* 020B58C4 */ _t56 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020B58C4 */ _t56 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020B58C4 */ _t57 = _t56 & 0x00000001u;
         /* 020B58C4 */ if (_t57) goto L_020B58C8; // else: addr-0 trap, fall-through
   L_020B58C8: ; // 0x20b58c8
@@ -6398,23 +6398,23 @@ void Gambit_fn_020B56EC(CPUState* cpu) {
         /* 020B58E8 */ _t62 = cpu->r[7] + 0x00000000u;
         /* 020B58E8 */ cpu->r[9] = rbrew_read8(cpu->mem, _t62);
         /* 020B58EC */ cpu->r[31] = 0x00000000u;
-        /* 020B58F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[30]);
+        /* 020B58F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[30]));
         /* 020B58F4 */ cpu->r[9] = 0x00080000u;
-        /* 020B58F8 */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B58F8 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B58F8 */ _t64 = _t63 & 0x00000001u;
         /* 020B58F8 */ if (_t64) goto L_020B5920; else goto L_020B58FC;
   L_020B58FC: ; // 0x20b58fc
         /* 020B58FC */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020B5900 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 020B5900 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 020B5904 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 020B5908 */ _t65 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B5908 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B5908 */ _t66 = _t65 & 0x00000001u;
         /* 020B5908 */ if (_t66) goto L_020B591C; else goto L_020B590C;
   L_020B590C: ; // 0x20b590c
         /* 020B590C */ _t67 = cpu->r[7] + 0x00000000u;
         /* 020B590C */ cpu->r[10] = rbrew_read8(cpu->mem, _t67);
-        /* 020B5910 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[30]);
-        /* 020B5914 */ _t68 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[30]));
+        /* 020B5914 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5914 */ _t69 = _t68 & 0x00000001u;
         /* 020B5914 */ if (_t69) goto L_020B5918; else goto L_020B58FC;
   L_020B5918: ; // 0x20b5918
@@ -6426,10 +6426,10 @@ void Gambit_fn_020B56EC(CPUState* cpu) {
         /* 020B5920 */ cpu->r[8] = rbrew_read32(cpu->mem, _t70);
         /* 020B5924 */ _t71 = cpu->r[1] + 0x0000004Cu;
         /* 020B5924 */ cpu->r[11] = rbrew_read32(cpu->mem, _t71);
-        /* 020B5928 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[8]);
+        /* 020B5928 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[8]));
         /* 020B592C */ _t72 = cpu->r[11] + 0x00000014u;
         /* 020B592C */ cpu->r[12] = rbrew_read32(cpu->mem, _t72);
-        /* 020B5930 */ _t73 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B5930 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B5930 */ _t74 = _t73 & 0x00000001u;
         /* 020B5930 */ if (_t74) goto L_020B5938; else goto L_020B5934;
   L_020B5934: ; // 0x20b5934
@@ -6453,13 +6453,13 @@ void Gambit_fn_020B56EC(CPUState* cpu) {
         /* 020B5968 */ _t78 = cpu->r[28] + 0x000006B0u;
         /* 020B5968 */ rbrew_write8(cpu->mem, _t78, (uint8_t)cpu->r[5]);
         /* 020B596C */ cpu->r[6] = rbrew_rlwinm(cpu->r[29], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B596C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 020B596C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 020B5970 */ _t79 = cpu->r[28] + 0x00000448u;
         /* 020B5970 */ rbrew_write32(cpu->mem, _t79, cpu->r[26]);
         /* 020B5974 */ cpu->r[31] = 0x101C0000u;
         /* 020B5978 */ _t80 = cpu->r[28] + 0x0000047Cu;
         /* 020B5978 */ rbrew_write8(cpu->mem, _t80, (uint8_t)cpu->r[0]);
-        /* 020B597C */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B597C */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B597C */ _t82 = _t81 & 0x00000001u;
         /* 020B597C */ if (_t82) goto L_020B59EC; else goto L_020B5980;
   L_020B5980: ; // 0x20b5980
@@ -6487,7 +6487,7 @@ void Gambit_fn_020B56EC(CPUState* cpu) {
         /* 020B59B4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t90);
         /* 020B59B8 */ cpu->r[4] = cpu->r[4] + 0x00004244u;
         /* 020B59BC */ cpu->r[3] = cpu->r[1] + 0x00000094u;
-        /* 020B59C0 */ _t91 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020B59C0 */ _t91 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020B59C0 */ _t92 = _t91 & 0x00000001u;
         /* 020B59C0 */ if (_t92) goto L_020B59C4; // else: addr-0 trap, fall-through
   L_020B59C4: ; // 0x20b59c4
@@ -6507,8 +6507,8 @@ void Gambit_fn_020B56EC(CPUState* cpu) {
         /* 020B59E8 */ cpu->r[29] = rbrew_read32(cpu->mem, _t96);
   L_020B59EC: ; // 0x20b59ec
         /* 020B59EC */ cpu->r[0] = rbrew_rlwinm(cpu->r[29], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 020B59EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B59F0 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B59EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B59F0 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B59F0 */ _t98 = _t97 & 0x00000001u;
         /* 020B59F0 */ if (_t98) goto L_020B5AB0; else goto L_020B59F4;
   L_020B59F4: ; // 0x20b59f4
@@ -6536,7 +6536,7 @@ void Gambit_fn_020B56EC(CPUState* cpu) {
         /* 020B5A28 */ cpu->r[5] = rbrew_read32(cpu->mem, _t106);
         /* 020B5A2C */ cpu->r[3] = cpu->r[1] + 0x00000094u;
         /* 020B5A30 */ cpu->r[4] = cpu->r[4] + 0x00004250u;
-        /* 020B5A34 */ _t107 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020B5A34 */ _t107 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020B5A34 */ _t108 = _t107 & 0x00000001u;
         /* 020B5A34 */ if (_t108) goto L_020B5A38; // else: addr-0 trap, fall-through
   L_020B5A38: ; // 0x20b5a38
@@ -6611,15 +6611,15 @@ void Gambit_fn_020B5AE8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B5AE8: ; // 0x20b5ae8
-        /* 020B5AE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B5AEC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5AE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B5AEC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5AEC */ _t1 = _t0 & 0x00000001u;
         /* 020B5AEC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B5AEC */ goto L_020B5AF0;
   L_020B5AF0: ; // 0x20b5af0
         /* 020B5AF0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B5AF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B5AF4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5AF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B5AF4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5AF4 */ _t3 = _t2 & 0x00000001u;
         /* 020B5AF4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B5AF4 */ goto L_020B5AF8;
@@ -6638,8 +6638,8 @@ void Gambit_fn_020B5AE8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -6653,15 +6653,15 @@ void Gambit_fn_020B5AE8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -6689,15 +6689,15 @@ void Gambit_fn_020B5AFC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B5AFC: ; // 0x20b5afc
-        /* 020B5AFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B5B00 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5AFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B5B00 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5B00 */ _t1 = _t0 & 0x00000001u;
         /* 020B5B00 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B5B00 */ goto L_020B5B04;
   L_020B5B04: ; // 0x20b5b04
         /* 020B5B04 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B5B04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B5B08 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5B04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B5B08 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5B08 */ _t3 = _t2 & 0x00000001u;
         /* 020B5B08 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B5B08 */ goto L_020B5B0C;
@@ -6716,8 +6716,8 @@ void Gambit_fn_020B5AFC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -6731,15 +6731,15 @@ void Gambit_fn_020B5AFC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -6773,15 +6773,15 @@ void Gambit_fn_020B5B14(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B5B14: ; // 0x20b5b14
-        /* 020B5B14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B5B18 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5B14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B5B18 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5B18 */ _t1 = _t0 & 0x00000001u;
         /* 020B5B18 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B5B18 */ goto L_020B5B1C;
   L_020B5B1C: ; // 0x20b5b1c
         /* 020B5B1C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B5B1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B5B20 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5B1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B5B20 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5B20 */ _t3 = _t2 & 0x00000001u;
         /* 020B5B20 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B5B20 */ goto L_020B5B24;
@@ -6800,8 +6800,8 @@ void Gambit_fn_020B5B14(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -6815,15 +6815,15 @@ void Gambit_fn_020B5B14(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -6875,15 +6875,15 @@ void Gambit_fn_020B5B48(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B5B48: ; // 0x20b5b48
-        /* 020B5B48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B5B4C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5B48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B5B4C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5B4C */ _t1 = _t0 & 0x00000001u;
         /* 020B5B4C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B5B4C */ goto L_020B5B50;
   L_020B5B50: ; // 0x20b5b50
         /* 020B5B50 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B5B50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B5B54 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5B50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B5B54 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5B54 */ _t3 = _t2 & 0x00000001u;
         /* 020B5B54 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B5B54 */ goto L_020B5B58;
@@ -6902,8 +6902,8 @@ void Gambit_fn_020B5B48(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -6917,15 +6917,15 @@ void Gambit_fn_020B5B48(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -6953,15 +6953,15 @@ void Gambit_fn_020B5B5C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B5B5C: ; // 0x20b5b5c
-        /* 020B5B5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B5B60 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5B5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B5B60 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5B60 */ _t1 = _t0 & 0x00000001u;
         /* 020B5B60 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B5B60 */ goto L_020B5B64;
   L_020B5B64: ; // 0x20b5b64
         /* 020B5B64 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B5B64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B5B68 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5B64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B5B68 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5B68 */ _t3 = _t2 & 0x00000001u;
         /* 020B5B68 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B5B68 */ goto L_020B5B6C;
@@ -6980,8 +6980,8 @@ void Gambit_fn_020B5B5C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -6995,15 +6995,15 @@ void Gambit_fn_020B5B5C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -7031,15 +7031,15 @@ void Gambit_fn_020B5B70(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B5B70: ; // 0x20b5b70
-        /* 020B5B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B5B74 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B5B74 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5B74 */ _t1 = _t0 & 0x00000001u;
         /* 020B5B74 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B5B74 */ goto L_020B5B78;
   L_020B5B78: ; // 0x20b5b78
         /* 020B5B78 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B5B78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B5B7C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5B78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B5B7C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5B7C */ _t3 = _t2 & 0x00000001u;
         /* 020B5B7C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B5B7C */ goto L_020B5B80;
@@ -7058,8 +7058,8 @@ void Gambit_fn_020B5B70(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -7073,15 +7073,15 @@ void Gambit_fn_020B5B70(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -7109,15 +7109,15 @@ void Gambit_fn_020B5B84(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B5B84: ; // 0x20b5b84
-        /* 020B5B84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B5B88 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5B84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B5B88 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5B88 */ _t1 = _t0 & 0x00000001u;
         /* 020B5B88 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B5B88 */ goto L_020B5B8C;
   L_020B5B8C: ; // 0x20b5b8c
         /* 020B5B8C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B5B8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B5B90 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5B8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B5B90 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5B90 */ _t3 = _t2 & 0x00000001u;
         /* 020B5B90 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B5B90 */ goto L_020B5B94;
@@ -7136,8 +7136,8 @@ void Gambit_fn_020B5B84(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -7151,15 +7151,15 @@ void Gambit_fn_020B5B84(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -7187,15 +7187,15 @@ void Gambit_fn_020B5B98(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B5B98: ; // 0x20b5b98
-        /* 020B5B98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B5B9C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5B98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B5B9C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5B9C */ _t1 = _t0 & 0x00000001u;
         /* 020B5B9C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B5B9C */ goto L_020B5BA0;
   L_020B5BA0: ; // 0x20b5ba0
         /* 020B5BA0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B5BA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B5BA4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5BA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B5BA4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5BA4 */ _t3 = _t2 & 0x00000001u;
         /* 020B5BA4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B5BA4 */ goto L_020B5BA8;
@@ -7214,8 +7214,8 @@ void Gambit_fn_020B5B98(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -7229,15 +7229,15 @@ void Gambit_fn_020B5B98(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -7277,11 +7277,11 @@ void Gambit_fn_020B5BAC(CPUState* cpu) {
         /* 020B6A20 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020B6A20 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020B6A24 */ cpu->r[30] = cpu->r[3];
-        /* 020B6A24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020B6A24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020B6A28 */ cpu->r[31] = cpu->r[4];
         /* 020B6A2C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020B6A2C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020B6A30 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6A30 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6A30 */ _t5 = _t4 & 0x00000001u;
         /* 020B6A30 */ if (_t5) goto L_020B6A74; else goto L_020B6A34;
   L_020B6A34: ; // 0x20b6a34
@@ -7301,8 +7301,8 @@ void Gambit_fn_020B5BAC(CPUState* cpu) {
         /* 020B6A5C */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020B6A60 */ Gambit_fn_02068798(cpu);
         /* 020B6A64 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B6A64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B6A68 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6A64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B6A68 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6A68 */ _t10 = _t9 & 0x00000001u;
         /* 020B6A68 */ if (_t10) goto L_020B6A74; else goto L_020B6A6C;
   L_020B6A6C: ; // 0x20b6a6c
@@ -7330,8 +7330,8 @@ void Gambit_fn_020B5BB4(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -7356,14 +7356,14 @@ void Gambit_fn_020B5BBC(CPUState* cpu) {
         /* 020B5BBC */ _t0 = cpu->r[3] + 0x000001ECu;
         /* 020B5BBC */ cpu->r[12] = rbrew_read8(cpu->mem, _t0);
         /* 020B5BC0 */ /* nop */
-        /* 020B5BC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000003u);
+        /* 020B5BC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000003u));
         /* 020B5BC8 */ cpu->r[0] = 0x00000001u;
-        /* 020B5BCC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5BCC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5BCC */ _t2 = _t1 & 0x00000001u;
         /* 020B5BCC */ if (_t2) goto L_020B5BDC; else goto L_020B5BD0;
   L_020B5BD0: ; // 0x20b5bd0
-        /* 020B5BD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000004u);
-        /* 020B5BD4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5BD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000004u));
+        /* 020B5BD4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5BD4 */ _t4 = _t3 & 0x00000001u;
         /* 020B5BD4 */ if (_t4) goto L_020B5BDC; else goto L_020B5BD8;
   L_020B5BD8: ; // 0x20b5bd8
@@ -7381,16 +7381,16 @@ void Gambit_fn_020B5BE4(CPUState* cpu) {
         /* 020B5BE4 */ _t0 = cpu->r[3] + 0x000001ECu;
         /* 020B5BE4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t0);
         /* 020B5BE8 */ /* nop */
-        /* 020B5BEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
+        /* 020B5BEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
         /* 020B5BF0 */ cpu->r[12] = 0x00000000u;
-        /* 020B5BF4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5BF4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5BF4 */ _t2 = _t1 & 0x00000001u;
         /* 020B5BF4 */ if (_t2) goto L_020B5BF8; else goto L_020B5C08;
   L_020B5BF8: ; // 0x20b5bf8
         /* 020B5BF8 */ _t3 = cpu->r[3] + 0x000001E8u;
         /* 020B5BF8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 020B5BFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 020B5C00 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5BFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 020B5C00 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5C00 */ _t5 = _t4 & 0x00000001u;
         /* 020B5C00 */ if (_t5) goto L_020B5C04; else goto L_020B5C08;
   L_020B5C04: ; // 0x20b5c04
@@ -7449,18 +7449,18 @@ void Gambit_fn_020B5C38(CPUState* cpu) {
         /* 020B5C40 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020B5C44 */ /* nop */
         /* 020B5C48 */ cpu->r[28] = cpu->r[3];
-        /* 020B5C48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 020B5C48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 020B5C4C */ cpu->r[30] = cpu->r[4];
         /* 020B5C50 */ cpu->r[31] = cpu->r[5];
-        /* 020B5C54 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5C54 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5C54 */ _t3 = _t2 & 0x00000001u;
         /* 020B5C54 */ if (_t3) goto L_020B5C58; else goto L_020B5C68;
   L_020B5C58: ; // 0x20b5c58
         /* 020B5C58 */ cpu->r[3] = 0x00000218u;
         /* 020B5C5C */ Gambit_fn_02801A78(cpu);
         /* 020B5C60 */ cpu->r[28] = cpu->r[3];
-        /* 020B5C60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 020B5C64 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5C60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 020B5C64 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5C64 */ _t5 = _t4 & 0x00000001u;
         /* 020B5C64 */ if (_t5) goto L_020B6324; else goto L_020B5C68;
   L_020B5C68: ; // 0x20b5c68
@@ -7490,22 +7490,22 @@ void Gambit_fn_020B5C38(CPUState* cpu) {
         /* 020B5CB0 */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
         /* 020B5CB4 */ cpu->r[6] = 0xFFFFFFFFu;
         /* 020B5CB8 */ cpu->r[26] = cpu->r[28] + 0x000001E0u;
-        /* 020B5CB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 020B5CB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 020B5CBC */ _t11 = cpu->r[28] + 0x000001C8u;
         /* 020B5CBC */ rbrew_write32(cpu->mem, _t11, cpu->r[5]);
         /* 020B5CC0 */ cpu->r[27] = 0x00000000u;
         /* 020B5CC4 */ cpu->r[31] = cpu->r[26];
         /* 020B5CC8 */ _t12 = cpu->r[28] + 0x000001DCu;
         /* 020B5CC8 */ rbrew_write32(cpu->mem, _t12, cpu->r[6]);
-        /* 020B5CCC */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5CCC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5CCC */ _t14 = _t13 & 0x00000001u;
         /* 020B5CCC */ if (_t14) goto L_020B5CD0; else goto L_020B5CE0;
   L_020B5CD0: ; // 0x20b5cd0
         /* 020B5CD0 */ cpu->r[3] = 0x00000038u;
         /* 020B5CD4 */ Gambit_fn_02801A78(cpu);
         /* 020B5CD8 */ cpu->r[31] = cpu->r[3];
-        /* 020B5CD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020B5CDC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5CD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020B5CDC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5CDC */ _t16 = _t15 & 0x00000001u;
         /* 020B5CDC */ if (_t16) goto L_020B5D10; else goto L_020B5CE0;
   L_020B5CE0: ; // 0x20b5ce0
@@ -7564,23 +7564,23 @@ void Gambit_fn_020B5C38(CPUState* cpu) {
         /* 020B5D70 */ _t32 = cpu->r[12] + 0x00000000u;
         /* 020B5D70 */ cpu->r[10] = rbrew_read8(cpu->mem, _t32);
         /* 020B5D74 */ cpu->r[6] = 0x00080000u;
-        /* 020B5D78 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[31]);
+        /* 020B5D78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[31]));
         /* 020B5D7C */ cpu->r[30] = 0x00000000u;
-        /* 020B5D80 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5D80 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5D80 */ _t34 = _t33 & 0x00000001u;
         /* 020B5D80 */ if (_t34) goto L_020B5DA8; else goto L_020B5D84;
   L_020B5D84: ; // 0x20b5d84
         /* 020B5D84 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B5D88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[6]);
+        /* 020B5D88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[6]));
         /* 020B5D8C */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 020B5D90 */ _t35 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B5D90 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B5D90 */ _t36 = _t35 & 0x00000001u;
         /* 020B5D90 */ if (_t36) goto L_020B5DA4; else goto L_020B5D94;
   L_020B5D94: ; // 0x20b5d94
         /* 020B5D94 */ _t37 = cpu->r[12] + 0x00000000u;
         /* 020B5D94 */ cpu->r[0] = rbrew_read8(cpu->mem, _t37);
-        /* 020B5D98 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020B5D9C */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5D98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020B5D9C */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5D9C */ _t39 = _t38 & 0x00000001u;
         /* 020B5D9C */ if (_t39) goto L_020B5DA0; else goto L_020B5D84;
   L_020B5DA0: ; // 0x20b5da0
@@ -7592,10 +7592,10 @@ void Gambit_fn_020B5C38(CPUState* cpu) {
         /* 020B5DA8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t40);
         /* 020B5DAC */ _t41 = cpu->r[1] + 0x00000010u;
         /* 020B5DAC */ cpu->r[12] = rbrew_read32(cpu->mem, _t41);
-        /* 020B5DB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[9]);
+        /* 020B5DB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[9]));
         /* 020B5DB4 */ _t42 = cpu->r[12] + 0x00000014u;
         /* 020B5DB4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t42);
-        /* 020B5DB8 */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B5DB8 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B5DB8 */ _t44 = _t43 & 0x00000001u;
         /* 020B5DB8 */ if (_t44) goto L_020B5DC0; else goto L_020B5DBC;
   L_020B5DBC: ; // 0x20b5dbc
@@ -7650,10 +7650,10 @@ void Gambit_fn_020B5C38(CPUState* cpu) {
         /* 020B5E40 */ rbrew_write32(cpu->mem, _t58, cpu->r[8]);
         /* 020B5E44 */ _t59 = cpu->r[26] + 0x00000014u;
         /* 020B5E44 */ cpu->r[10] = rbrew_read32(cpu->mem, _t59);
-        /* 020B5E48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000001u);
+        /* 020B5E48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000001u));
         /* 020B5E4C */ _t60 = cpu->r[26] + 0x00000018u;
         /* 020B5E4C */ cpu->r[29] = rbrew_read32(cpu->mem, _t60);
-        /* 020B5E50 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B5E50 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B5E50 */ _t62 = _t61 & 0x00000001u;
         /* 020B5E50 */ if (_t62) goto L_020B5E54; else goto L_020B5E58;
   L_020B5E54: ; // 0x20b5e54
@@ -7669,23 +7669,23 @@ void Gambit_fn_020B5C38(CPUState* cpu) {
         /* 020B5E6C */ _t65 = cpu->r[6] + 0x00000000u;
         /* 020B5E6C */ cpu->r[12] = rbrew_read8(cpu->mem, _t65);
         /* 020B5E70 */ cpu->r[30] = 0x00000000u;
-        /* 020B5E74 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[31]);
+        /* 020B5E74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[31]));
         /* 020B5E78 */ cpu->r[8] = 0x00080000u;
-        /* 020B5E7C */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5E7C */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5E7C */ _t67 = _t66 & 0x00000001u;
         /* 020B5E7C */ if (_t67) goto L_020B5EA4; else goto L_020B5E80;
   L_020B5E80: ; // 0x20b5e80
         /* 020B5E80 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B5E84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[8]);
+        /* 020B5E84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[8]));
         /* 020B5E88 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 020B5E8C */ _t68 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B5E8C */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B5E8C */ _t69 = _t68 & 0x00000001u;
         /* 020B5E8C */ if (_t69) goto L_020B5EA0; else goto L_020B5E90;
   L_020B5E90: ; // 0x20b5e90
         /* 020B5E90 */ _t70 = cpu->r[6] + 0x00000000u;
         /* 020B5E90 */ cpu->r[5] = rbrew_read8(cpu->mem, _t70);
-        /* 020B5E94 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[31]);
-        /* 020B5E98 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5E94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[31]));
+        /* 020B5E98 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5E98 */ _t72 = _t71 & 0x00000001u;
         /* 020B5E98 */ if (_t72) goto L_020B5E9C; else goto L_020B5E80;
   L_020B5E9C: ; // 0x20b5e9c
@@ -7697,10 +7697,10 @@ void Gambit_fn_020B5C38(CPUState* cpu) {
         /* 020B5EA4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t73);
         /* 020B5EA8 */ _t74 = cpu->r[1] + 0x00000010u;
         /* 020B5EA8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t74);
-        /* 020B5EAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[11]);
+        /* 020B5EAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[11]));
         /* 020B5EB0 */ _t75 = cpu->r[6] + 0x00000014u;
         /* 020B5EB0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t75);
-        /* 020B5EB4 */ _t76 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B5EB4 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B5EB4 */ _t77 = _t76 & 0x00000001u;
         /* 020B5EB4 */ if (_t77) goto L_020B5EBC; else goto L_020B5EB8;
   L_020B5EB8: ; // 0x20b5eb8
@@ -7755,10 +7755,10 @@ void Gambit_fn_020B5C38(CPUState* cpu) {
         /* 020B5F3C */ rbrew_write32(cpu->mem, _t91, cpu->r[12]);
         /* 020B5F40 */ _t92 = cpu->r[26] + 0x00000014u;
         /* 020B5F40 */ cpu->r[5] = rbrew_read32(cpu->mem, _t92);
-        /* 020B5F44 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x00000002u);
+        /* 020B5F44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x00000002u));
         /* 020B5F48 */ _t93 = cpu->r[26] + 0x00000018u;
         /* 020B5F48 */ cpu->r[29] = rbrew_read32(cpu->mem, _t93);
-        /* 020B5F4C */ _t94 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B5F4C */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B5F4C */ _t95 = _t94 & 0x00000001u;
         /* 020B5F4C */ if (_t95) goto L_020B5F50; else goto L_020B5F54;
   L_020B5F50: ; // 0x20b5f50
@@ -7774,23 +7774,23 @@ void Gambit_fn_020B5C38(CPUState* cpu) {
         /* 020B5F68 */ _t98 = cpu->r[11] + 0x00000000u;
         /* 020B5F68 */ cpu->r[7] = rbrew_read8(cpu->mem, _t98);
         /* 020B5F6C */ cpu->r[30] = 0x00000000u;
-        /* 020B5F70 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[31]);
+        /* 020B5F70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[31]));
         /* 020B5F74 */ cpu->r[0] = 0x00080000u;
-        /* 020B5F78 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5F78 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5F78 */ _t100 = _t99 & 0x00000001u;
         /* 020B5F78 */ if (_t100) goto L_020B5FA0; else goto L_020B5F7C;
   L_020B5F7C: ; // 0x20b5f7c
         /* 020B5F7C */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B5F80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 020B5F80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 020B5F84 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 020B5F88 */ _t101 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B5F88 */ _t101 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B5F88 */ _t102 = _t101 & 0x00000001u;
         /* 020B5F88 */ if (_t102) goto L_020B5F9C; else goto L_020B5F8C;
   L_020B5F8C: ; // 0x20b5f8c
         /* 020B5F8C */ _t103 = cpu->r[11] + 0x00000000u;
         /* 020B5F8C */ cpu->r[9] = rbrew_read8(cpu->mem, _t103);
-        /* 020B5F90 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[31]);
-        /* 020B5F94 */ _t104 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5F90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[31]));
+        /* 020B5F94 */ _t104 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5F94 */ _t105 = _t104 & 0x00000001u;
         /* 020B5F94 */ if (_t105) goto L_020B5F98; else goto L_020B5F7C;
   L_020B5F98: ; // 0x20b5f98
@@ -7802,10 +7802,10 @@ void Gambit_fn_020B5C38(CPUState* cpu) {
         /* 020B5FA0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t106);
         /* 020B5FA4 */ _t107 = cpu->r[1] + 0x00000010u;
         /* 020B5FA4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t107);
-        /* 020B5FA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[12]);
+        /* 020B5FA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[12]));
         /* 020B5FAC */ _t108 = cpu->r[11] + 0x00000014u;
         /* 020B5FAC */ cpu->r[5] = rbrew_read32(cpu->mem, _t108);
-        /* 020B5FB0 */ _t109 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B5FB0 */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B5FB0 */ _t110 = _t109 & 0x00000001u;
         /* 020B5FB0 */ if (_t110) goto L_020B5FB8; else goto L_020B5FB4;
   L_020B5FB4: ; // 0x20b5fb4
@@ -7860,10 +7860,10 @@ void Gambit_fn_020B5C38(CPUState* cpu) {
         /* 020B6038 */ rbrew_write32(cpu->mem, _t124, cpu->r[8]);
         /* 020B603C */ _t125 = cpu->r[26] + 0x00000014u;
         /* 020B603C */ cpu->r[0] = rbrew_read32(cpu->mem, _t125);
-        /* 020B6040 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 020B6040 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 020B6044 */ _t126 = cpu->r[26] + 0x00000018u;
         /* 020B6044 */ cpu->r[30] = rbrew_read32(cpu->mem, _t126);
-        /* 020B6048 */ _t127 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B6048 */ _t127 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B6048 */ _t128 = _t127 & 0x00000001u;
         /* 020B6048 */ if (_t128) goto L_020B604C; else goto L_020B6050;
   L_020B604C: ; // 0x20b604c
@@ -7879,23 +7879,23 @@ void Gambit_fn_020B5C38(CPUState* cpu) {
         /* 020B6064 */ _t131 = cpu->r[8] + 0x00000000u;
         /* 020B6064 */ cpu->r[5] = rbrew_read8(cpu->mem, _t131);
         /* 020B6068 */ cpu->r[9] = 0x00080000u;
-        /* 020B606C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[31]);
+        /* 020B606C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[31]));
         /* 020B6070 */ cpu->r[29] = 0x00000000u;
-        /* 020B6074 */ _t132 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6074 */ _t132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6074 */ _t133 = _t132 & 0x00000001u;
         /* 020B6074 */ if (_t133) goto L_020B609C; else goto L_020B6078;
   L_020B6078: ; // 0x20b6078
         /* 020B6078 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 020B607C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[9]);
+        /* 020B607C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[9]));
         /* 020B6080 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 020B6084 */ _t134 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B6084 */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B6084 */ _t135 = _t134 & 0x00000001u;
         /* 020B6084 */ if (_t135) goto L_020B6098; else goto L_020B6088;
   L_020B6088: ; // 0x20b6088
         /* 020B6088 */ _t136 = cpu->r[8] + 0x00000000u;
         /* 020B6088 */ cpu->r[0] = rbrew_read8(cpu->mem, _t136);
-        /* 020B608C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020B6090 */ _t137 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B608C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020B6090 */ _t137 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6090 */ _t138 = _t137 & 0x00000001u;
         /* 020B6090 */ if (_t138) goto L_020B6094; else goto L_020B6078;
   L_020B6094: ; // 0x20b6094
@@ -7905,8 +7905,8 @@ void Gambit_fn_020B5C38(CPUState* cpu) {
   L_020B609C: ; // 0x20b609c
         /* 020B609C */ _t139 = cpu->r[30] + 0x00000008u;
         /* 020B609C */ cpu->r[6] = rbrew_read32(cpu->mem, _t139);
-        /* 020B60A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[6]);
-        /* 020B60A4 */ _t140 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B60A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[6]));
+        /* 020B60A4 */ _t140 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B60A4 */ _t141 = _t140 & 0x00000001u;
         /* 020B60A4 */ if (_t141) goto L_020B60AC; else goto L_020B60A8;
   L_020B60A8: ; // 0x20b60a8
@@ -7965,10 +7965,10 @@ void Gambit_fn_020B5C38(CPUState* cpu) {
         /* 020B6134 */ rbrew_write32(cpu->mem, _t157, cpu->r[0]);
         /* 020B6138 */ _t158 = cpu->r[26] + 0x00000014u;
         /* 020B6138 */ cpu->r[6] = rbrew_read32(cpu->mem, _t158);
-        /* 020B613C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], 0x00000004u);
+        /* 020B613C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], 0x00000004u));
         /* 020B6140 */ _t159 = cpu->r[26] + 0x00000018u;
         /* 020B6140 */ cpu->r[29] = rbrew_read32(cpu->mem, _t159);
-        /* 020B6144 */ _t160 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B6144 */ _t160 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B6144 */ _t161 = _t160 & 0x00000001u;
         /* 020B6144 */ if (_t161) goto L_020B6148; else goto L_020B614C;
   L_020B6148: ; // 0x20b6148
@@ -7984,23 +7984,23 @@ void Gambit_fn_020B5C38(CPUState* cpu) {
         /* 020B6160 */ _t164 = cpu->r[11] + 0x00000000u;
         /* 020B6160 */ cpu->r[7] = rbrew_read8(cpu->mem, _t164);
         /* 020B6164 */ cpu->r[30] = 0x00000000u;
-        /* 020B6168 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[31]);
+        /* 020B6168 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[31]));
         /* 020B616C */ cpu->r[0] = 0x00080000u;
-        /* 020B6170 */ _t165 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6170 */ _t165 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6170 */ _t166 = _t165 & 0x00000001u;
         /* 020B6170 */ if (_t166) goto L_020B6198; else goto L_020B6174;
   L_020B6174: ; // 0x20b6174
         /* 020B6174 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B6178 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 020B6178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 020B617C */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 020B6180 */ _t167 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B6180 */ _t167 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B6180 */ _t168 = _t167 & 0x00000001u;
         /* 020B6180 */ if (_t168) goto L_020B6194; else goto L_020B6184;
   L_020B6184: ; // 0x20b6184
         /* 020B6184 */ _t169 = cpu->r[11] + 0x00000000u;
         /* 020B6184 */ cpu->r[8] = rbrew_read8(cpu->mem, _t169);
-        /* 020B6188 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[31]);
-        /* 020B618C */ _t170 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6188 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[31]));
+        /* 020B618C */ _t170 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B618C */ _t171 = _t170 & 0x00000001u;
         /* 020B618C */ if (_t171) goto L_020B6190; else goto L_020B6174;
   L_020B6190: ; // 0x20b6190
@@ -8012,10 +8012,10 @@ void Gambit_fn_020B5C38(CPUState* cpu) {
         /* 020B6198 */ cpu->r[8] = rbrew_read32(cpu->mem, _t172);
         /* 020B619C */ _t173 = cpu->r[1] + 0x00000010u;
         /* 020B619C */ cpu->r[9] = rbrew_read32(cpu->mem, _t173);
-        /* 020B61A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[8]);
+        /* 020B61A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[8]));
         /* 020B61A4 */ _t174 = cpu->r[9] + 0x00000014u;
         /* 020B61A4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t174);
-        /* 020B61A8 */ _t175 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B61A8 */ _t175 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B61A8 */ _t176 = _t175 & 0x00000001u;
         /* 020B61A8 */ if (_t176) goto L_020B61B0; else goto L_020B61AC;
   L_020B61AC: ; // 0x20b61ac
@@ -8070,10 +8070,10 @@ void Gambit_fn_020B5C38(CPUState* cpu) {
         /* 020B6230 */ rbrew_write32(cpu->mem, _t190, cpu->r[12]);
         /* 020B6234 */ _t191 = cpu->r[26] + 0x00000014u;
         /* 020B6234 */ cpu->r[0] = rbrew_read32(cpu->mem, _t191);
-        /* 020B6238 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
+        /* 020B6238 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
         /* 020B623C */ _t192 = cpu->r[26] + 0x00000018u;
         /* 020B623C */ cpu->r[29] = rbrew_read32(cpu->mem, _t192);
-        /* 020B6240 */ _t193 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B6240 */ _t193 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B6240 */ _t194 = _t193 & 0x00000001u;
         /* 020B6240 */ if (_t194) goto L_020B6244; else goto L_020B6248;
   L_020B6244: ; // 0x20b6244
@@ -8089,23 +8089,23 @@ void Gambit_fn_020B5C38(CPUState* cpu) {
         /* 020B625C */ _t197 = cpu->r[7] + 0x00000000u;
         /* 020B625C */ cpu->r[5] = rbrew_read8(cpu->mem, _t197);
         /* 020B6260 */ cpu->r[30] = 0x00000000u;
-        /* 020B6264 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[31]);
+        /* 020B6264 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[31]));
         /* 020B6268 */ cpu->r[9] = 0x00080000u;
-        /* 020B626C */ _t198 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B626C */ _t198 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B626C */ _t199 = _t198 & 0x00000001u;
         /* 020B626C */ if (_t199) goto L_020B6294; else goto L_020B6270;
   L_020B6270: ; // 0x20b6270
         /* 020B6270 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B6274 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[9]);
+        /* 020B6274 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[9]));
         /* 020B6278 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 020B627C */ _t200 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B627C */ _t200 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B627C */ _t201 = _t200 & 0x00000001u;
         /* 020B627C */ if (_t201) goto L_020B6290; else goto L_020B6280;
   L_020B6280: ; // 0x20b6280
         /* 020B6280 */ _t202 = cpu->r[7] + 0x00000000u;
         /* 020B6280 */ cpu->r[6] = rbrew_read8(cpu->mem, _t202);
-        /* 020B6284 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[31]);
-        /* 020B6288 */ _t203 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6284 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[31]));
+        /* 020B6288 */ _t203 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6288 */ _t204 = _t203 & 0x00000001u;
         /* 020B6288 */ if (_t204) goto L_020B628C; else goto L_020B6270;
   L_020B628C: ; // 0x20b628c
@@ -8117,10 +8117,10 @@ void Gambit_fn_020B5C38(CPUState* cpu) {
         /* 020B6294 */ cpu->r[10] = rbrew_read32(cpu->mem, _t205);
         /* 020B6298 */ _t206 = cpu->r[1] + 0x00000010u;
         /* 020B6298 */ cpu->r[8] = rbrew_read32(cpu->mem, _t206);
-        /* 020B629C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[10]);
+        /* 020B629C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[10]));
         /* 020B62A0 */ _t207 = cpu->r[8] + 0x00000014u;
         /* 020B62A0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t207);
-        /* 020B62A4 */ _t208 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B62A4 */ _t208 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B62A4 */ _t209 = _t208 & 0x00000001u;
         /* 020B62A4 */ if (_t209) goto L_020B62AC; else goto L_020B62A8;
   L_020B62A8: ; // 0x20b62a8
@@ -8191,18 +8191,18 @@ void Gambit_fn_020B5C3C(CPUState* cpu) {
         /* 020B5C40 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020B5C44 */ /* nop */
         /* 020B5C48 */ cpu->r[28] = cpu->r[3];
-        /* 020B5C48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 020B5C48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 020B5C4C */ cpu->r[30] = cpu->r[4];
         /* 020B5C50 */ cpu->r[31] = cpu->r[5];
-        /* 020B5C54 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5C54 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5C54 */ _t3 = _t2 & 0x00000001u;
         /* 020B5C54 */ if (_t3) goto L_020B5C58; else goto L_020B5C68;
   L_020B5C58: ; // 0x20b5c58
         /* 020B5C58 */ cpu->r[3] = 0x00000218u;
         /* 020B5C5C */ Gambit_fn_02801A78(cpu);
         /* 020B5C60 */ cpu->r[28] = cpu->r[3];
-        /* 020B5C60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 020B5C64 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5C60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 020B5C64 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5C64 */ _t5 = _t4 & 0x00000001u;
         /* 020B5C64 */ if (_t5) goto L_020B6324; else goto L_020B5C68;
   L_020B5C68: ; // 0x20b5c68
@@ -8232,22 +8232,22 @@ void Gambit_fn_020B5C3C(CPUState* cpu) {
         /* 020B5CB0 */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
         /* 020B5CB4 */ cpu->r[6] = 0xFFFFFFFFu;
         /* 020B5CB8 */ cpu->r[26] = cpu->r[28] + 0x000001E0u;
-        /* 020B5CB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 020B5CB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 020B5CBC */ _t11 = cpu->r[28] + 0x000001C8u;
         /* 020B5CBC */ rbrew_write32(cpu->mem, _t11, cpu->r[5]);
         /* 020B5CC0 */ cpu->r[27] = 0x00000000u;
         /* 020B5CC4 */ cpu->r[31] = cpu->r[26];
         /* 020B5CC8 */ _t12 = cpu->r[28] + 0x000001DCu;
         /* 020B5CC8 */ rbrew_write32(cpu->mem, _t12, cpu->r[6]);
-        /* 020B5CCC */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5CCC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5CCC */ _t14 = _t13 & 0x00000001u;
         /* 020B5CCC */ if (_t14) goto L_020B5CD0; else goto L_020B5CE0;
   L_020B5CD0: ; // 0x20b5cd0
         /* 020B5CD0 */ cpu->r[3] = 0x00000038u;
         /* 020B5CD4 */ Gambit_fn_02801A78(cpu);
         /* 020B5CD8 */ cpu->r[31] = cpu->r[3];
-        /* 020B5CD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020B5CDC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5CD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020B5CDC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5CDC */ _t16 = _t15 & 0x00000001u;
         /* 020B5CDC */ if (_t16) goto L_020B5D10; else goto L_020B5CE0;
   L_020B5CE0: ; // 0x20b5ce0
@@ -8306,23 +8306,23 @@ void Gambit_fn_020B5C3C(CPUState* cpu) {
         /* 020B5D70 */ _t32 = cpu->r[12] + 0x00000000u;
         /* 020B5D70 */ cpu->r[10] = rbrew_read8(cpu->mem, _t32);
         /* 020B5D74 */ cpu->r[6] = 0x00080000u;
-        /* 020B5D78 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[31]);
+        /* 020B5D78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[31]));
         /* 020B5D7C */ cpu->r[30] = 0x00000000u;
-        /* 020B5D80 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5D80 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5D80 */ _t34 = _t33 & 0x00000001u;
         /* 020B5D80 */ if (_t34) goto L_020B5DA8; else goto L_020B5D84;
   L_020B5D84: ; // 0x20b5d84
         /* 020B5D84 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B5D88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[6]);
+        /* 020B5D88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[6]));
         /* 020B5D8C */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 020B5D90 */ _t35 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B5D90 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B5D90 */ _t36 = _t35 & 0x00000001u;
         /* 020B5D90 */ if (_t36) goto L_020B5DA4; else goto L_020B5D94;
   L_020B5D94: ; // 0x20b5d94
         /* 020B5D94 */ _t37 = cpu->r[12] + 0x00000000u;
         /* 020B5D94 */ cpu->r[0] = rbrew_read8(cpu->mem, _t37);
-        /* 020B5D98 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020B5D9C */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5D98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020B5D9C */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5D9C */ _t39 = _t38 & 0x00000001u;
         /* 020B5D9C */ if (_t39) goto L_020B5DA0; else goto L_020B5D84;
   L_020B5DA0: ; // 0x20b5da0
@@ -8334,10 +8334,10 @@ void Gambit_fn_020B5C3C(CPUState* cpu) {
         /* 020B5DA8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t40);
         /* 020B5DAC */ _t41 = cpu->r[1] + 0x00000010u;
         /* 020B5DAC */ cpu->r[12] = rbrew_read32(cpu->mem, _t41);
-        /* 020B5DB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[9]);
+        /* 020B5DB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[9]));
         /* 020B5DB4 */ _t42 = cpu->r[12] + 0x00000014u;
         /* 020B5DB4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t42);
-        /* 020B5DB8 */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B5DB8 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B5DB8 */ _t44 = _t43 & 0x00000001u;
         /* 020B5DB8 */ if (_t44) goto L_020B5DC0; else goto L_020B5DBC;
   L_020B5DBC: ; // 0x20b5dbc
@@ -8392,10 +8392,10 @@ void Gambit_fn_020B5C3C(CPUState* cpu) {
         /* 020B5E40 */ rbrew_write32(cpu->mem, _t58, cpu->r[8]);
         /* 020B5E44 */ _t59 = cpu->r[26] + 0x00000014u;
         /* 020B5E44 */ cpu->r[10] = rbrew_read32(cpu->mem, _t59);
-        /* 020B5E48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000001u);
+        /* 020B5E48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000001u));
         /* 020B5E4C */ _t60 = cpu->r[26] + 0x00000018u;
         /* 020B5E4C */ cpu->r[29] = rbrew_read32(cpu->mem, _t60);
-        /* 020B5E50 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B5E50 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B5E50 */ _t62 = _t61 & 0x00000001u;
         /* 020B5E50 */ if (_t62) goto L_020B5E54; else goto L_020B5E58;
   L_020B5E54: ; // 0x20b5e54
@@ -8411,23 +8411,23 @@ void Gambit_fn_020B5C3C(CPUState* cpu) {
         /* 020B5E6C */ _t65 = cpu->r[6] + 0x00000000u;
         /* 020B5E6C */ cpu->r[12] = rbrew_read8(cpu->mem, _t65);
         /* 020B5E70 */ cpu->r[30] = 0x00000000u;
-        /* 020B5E74 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[31]);
+        /* 020B5E74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[31]));
         /* 020B5E78 */ cpu->r[8] = 0x00080000u;
-        /* 020B5E7C */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5E7C */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5E7C */ _t67 = _t66 & 0x00000001u;
         /* 020B5E7C */ if (_t67) goto L_020B5EA4; else goto L_020B5E80;
   L_020B5E80: ; // 0x20b5e80
         /* 020B5E80 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B5E84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[8]);
+        /* 020B5E84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[8]));
         /* 020B5E88 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 020B5E8C */ _t68 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B5E8C */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B5E8C */ _t69 = _t68 & 0x00000001u;
         /* 020B5E8C */ if (_t69) goto L_020B5EA0; else goto L_020B5E90;
   L_020B5E90: ; // 0x20b5e90
         /* 020B5E90 */ _t70 = cpu->r[6] + 0x00000000u;
         /* 020B5E90 */ cpu->r[5] = rbrew_read8(cpu->mem, _t70);
-        /* 020B5E94 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[31]);
-        /* 020B5E98 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5E94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[31]));
+        /* 020B5E98 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5E98 */ _t72 = _t71 & 0x00000001u;
         /* 020B5E98 */ if (_t72) goto L_020B5E9C; else goto L_020B5E80;
   L_020B5E9C: ; // 0x20b5e9c
@@ -8439,10 +8439,10 @@ void Gambit_fn_020B5C3C(CPUState* cpu) {
         /* 020B5EA4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t73);
         /* 020B5EA8 */ _t74 = cpu->r[1] + 0x00000010u;
         /* 020B5EA8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t74);
-        /* 020B5EAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[11]);
+        /* 020B5EAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[11]));
         /* 020B5EB0 */ _t75 = cpu->r[6] + 0x00000014u;
         /* 020B5EB0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t75);
-        /* 020B5EB4 */ _t76 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B5EB4 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B5EB4 */ _t77 = _t76 & 0x00000001u;
         /* 020B5EB4 */ if (_t77) goto L_020B5EBC; else goto L_020B5EB8;
   L_020B5EB8: ; // 0x20b5eb8
@@ -8497,10 +8497,10 @@ void Gambit_fn_020B5C3C(CPUState* cpu) {
         /* 020B5F3C */ rbrew_write32(cpu->mem, _t91, cpu->r[12]);
         /* 020B5F40 */ _t92 = cpu->r[26] + 0x00000014u;
         /* 020B5F40 */ cpu->r[5] = rbrew_read32(cpu->mem, _t92);
-        /* 020B5F44 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x00000002u);
+        /* 020B5F44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x00000002u));
         /* 020B5F48 */ _t93 = cpu->r[26] + 0x00000018u;
         /* 020B5F48 */ cpu->r[29] = rbrew_read32(cpu->mem, _t93);
-        /* 020B5F4C */ _t94 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B5F4C */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B5F4C */ _t95 = _t94 & 0x00000001u;
         /* 020B5F4C */ if (_t95) goto L_020B5F50; else goto L_020B5F54;
   L_020B5F50: ; // 0x20b5f50
@@ -8516,23 +8516,23 @@ void Gambit_fn_020B5C3C(CPUState* cpu) {
         /* 020B5F68 */ _t98 = cpu->r[11] + 0x00000000u;
         /* 020B5F68 */ cpu->r[7] = rbrew_read8(cpu->mem, _t98);
         /* 020B5F6C */ cpu->r[30] = 0x00000000u;
-        /* 020B5F70 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[31]);
+        /* 020B5F70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[31]));
         /* 020B5F74 */ cpu->r[0] = 0x00080000u;
-        /* 020B5F78 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5F78 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5F78 */ _t100 = _t99 & 0x00000001u;
         /* 020B5F78 */ if (_t100) goto L_020B5FA0; else goto L_020B5F7C;
   L_020B5F7C: ; // 0x20b5f7c
         /* 020B5F7C */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B5F80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 020B5F80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 020B5F84 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 020B5F88 */ _t101 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B5F88 */ _t101 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B5F88 */ _t102 = _t101 & 0x00000001u;
         /* 020B5F88 */ if (_t102) goto L_020B5F9C; else goto L_020B5F8C;
   L_020B5F8C: ; // 0x20b5f8c
         /* 020B5F8C */ _t103 = cpu->r[11] + 0x00000000u;
         /* 020B5F8C */ cpu->r[9] = rbrew_read8(cpu->mem, _t103);
-        /* 020B5F90 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[31]);
-        /* 020B5F94 */ _t104 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B5F90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[31]));
+        /* 020B5F94 */ _t104 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B5F94 */ _t105 = _t104 & 0x00000001u;
         /* 020B5F94 */ if (_t105) goto L_020B5F98; else goto L_020B5F7C;
   L_020B5F98: ; // 0x20b5f98
@@ -8544,10 +8544,10 @@ void Gambit_fn_020B5C3C(CPUState* cpu) {
         /* 020B5FA0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t106);
         /* 020B5FA4 */ _t107 = cpu->r[1] + 0x00000010u;
         /* 020B5FA4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t107);
-        /* 020B5FA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[12]);
+        /* 020B5FA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[12]));
         /* 020B5FAC */ _t108 = cpu->r[11] + 0x00000014u;
         /* 020B5FAC */ cpu->r[5] = rbrew_read32(cpu->mem, _t108);
-        /* 020B5FB0 */ _t109 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B5FB0 */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B5FB0 */ _t110 = _t109 & 0x00000001u;
         /* 020B5FB0 */ if (_t110) goto L_020B5FB8; else goto L_020B5FB4;
   L_020B5FB4: ; // 0x20b5fb4
@@ -8602,10 +8602,10 @@ void Gambit_fn_020B5C3C(CPUState* cpu) {
         /* 020B6038 */ rbrew_write32(cpu->mem, _t124, cpu->r[8]);
         /* 020B603C */ _t125 = cpu->r[26] + 0x00000014u;
         /* 020B603C */ cpu->r[0] = rbrew_read32(cpu->mem, _t125);
-        /* 020B6040 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 020B6040 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 020B6044 */ _t126 = cpu->r[26] + 0x00000018u;
         /* 020B6044 */ cpu->r[30] = rbrew_read32(cpu->mem, _t126);
-        /* 020B6048 */ _t127 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B6048 */ _t127 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B6048 */ _t128 = _t127 & 0x00000001u;
         /* 020B6048 */ if (_t128) goto L_020B604C; else goto L_020B6050;
   L_020B604C: ; // 0x20b604c
@@ -8621,23 +8621,23 @@ void Gambit_fn_020B5C3C(CPUState* cpu) {
         /* 020B6064 */ _t131 = cpu->r[8] + 0x00000000u;
         /* 020B6064 */ cpu->r[5] = rbrew_read8(cpu->mem, _t131);
         /* 020B6068 */ cpu->r[9] = 0x00080000u;
-        /* 020B606C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[31]);
+        /* 020B606C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[31]));
         /* 020B6070 */ cpu->r[29] = 0x00000000u;
-        /* 020B6074 */ _t132 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6074 */ _t132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6074 */ _t133 = _t132 & 0x00000001u;
         /* 020B6074 */ if (_t133) goto L_020B609C; else goto L_020B6078;
   L_020B6078: ; // 0x20b6078
         /* 020B6078 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 020B607C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[9]);
+        /* 020B607C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[9]));
         /* 020B6080 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 020B6084 */ _t134 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B6084 */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B6084 */ _t135 = _t134 & 0x00000001u;
         /* 020B6084 */ if (_t135) goto L_020B6098; else goto L_020B6088;
   L_020B6088: ; // 0x20b6088
         /* 020B6088 */ _t136 = cpu->r[8] + 0x00000000u;
         /* 020B6088 */ cpu->r[0] = rbrew_read8(cpu->mem, _t136);
-        /* 020B608C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020B6090 */ _t137 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B608C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020B6090 */ _t137 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6090 */ _t138 = _t137 & 0x00000001u;
         /* 020B6090 */ if (_t138) goto L_020B6094; else goto L_020B6078;
   L_020B6094: ; // 0x20b6094
@@ -8647,8 +8647,8 @@ void Gambit_fn_020B5C3C(CPUState* cpu) {
   L_020B609C: ; // 0x20b609c
         /* 020B609C */ _t139 = cpu->r[30] + 0x00000008u;
         /* 020B609C */ cpu->r[6] = rbrew_read32(cpu->mem, _t139);
-        /* 020B60A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[6]);
-        /* 020B60A4 */ _t140 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B60A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[6]));
+        /* 020B60A4 */ _t140 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B60A4 */ _t141 = _t140 & 0x00000001u;
         /* 020B60A4 */ if (_t141) goto L_020B60AC; else goto L_020B60A8;
   L_020B60A8: ; // 0x20b60a8
@@ -8707,10 +8707,10 @@ void Gambit_fn_020B5C3C(CPUState* cpu) {
         /* 020B6134 */ rbrew_write32(cpu->mem, _t157, cpu->r[0]);
         /* 020B6138 */ _t158 = cpu->r[26] + 0x00000014u;
         /* 020B6138 */ cpu->r[6] = rbrew_read32(cpu->mem, _t158);
-        /* 020B613C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], 0x00000004u);
+        /* 020B613C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], 0x00000004u));
         /* 020B6140 */ _t159 = cpu->r[26] + 0x00000018u;
         /* 020B6140 */ cpu->r[29] = rbrew_read32(cpu->mem, _t159);
-        /* 020B6144 */ _t160 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B6144 */ _t160 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B6144 */ _t161 = _t160 & 0x00000001u;
         /* 020B6144 */ if (_t161) goto L_020B6148; else goto L_020B614C;
   L_020B6148: ; // 0x20b6148
@@ -8726,23 +8726,23 @@ void Gambit_fn_020B5C3C(CPUState* cpu) {
         /* 020B6160 */ _t164 = cpu->r[11] + 0x00000000u;
         /* 020B6160 */ cpu->r[7] = rbrew_read8(cpu->mem, _t164);
         /* 020B6164 */ cpu->r[30] = 0x00000000u;
-        /* 020B6168 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[31]);
+        /* 020B6168 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[31]));
         /* 020B616C */ cpu->r[0] = 0x00080000u;
-        /* 020B6170 */ _t165 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6170 */ _t165 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6170 */ _t166 = _t165 & 0x00000001u;
         /* 020B6170 */ if (_t166) goto L_020B6198; else goto L_020B6174;
   L_020B6174: ; // 0x20b6174
         /* 020B6174 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B6178 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 020B6178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 020B617C */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 020B6180 */ _t167 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B6180 */ _t167 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B6180 */ _t168 = _t167 & 0x00000001u;
         /* 020B6180 */ if (_t168) goto L_020B6194; else goto L_020B6184;
   L_020B6184: ; // 0x20b6184
         /* 020B6184 */ _t169 = cpu->r[11] + 0x00000000u;
         /* 020B6184 */ cpu->r[8] = rbrew_read8(cpu->mem, _t169);
-        /* 020B6188 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[31]);
-        /* 020B618C */ _t170 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6188 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[31]));
+        /* 020B618C */ _t170 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B618C */ _t171 = _t170 & 0x00000001u;
         /* 020B618C */ if (_t171) goto L_020B6190; else goto L_020B6174;
   L_020B6190: ; // 0x20b6190
@@ -8754,10 +8754,10 @@ void Gambit_fn_020B5C3C(CPUState* cpu) {
         /* 020B6198 */ cpu->r[8] = rbrew_read32(cpu->mem, _t172);
         /* 020B619C */ _t173 = cpu->r[1] + 0x00000010u;
         /* 020B619C */ cpu->r[9] = rbrew_read32(cpu->mem, _t173);
-        /* 020B61A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[8]);
+        /* 020B61A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[8]));
         /* 020B61A4 */ _t174 = cpu->r[9] + 0x00000014u;
         /* 020B61A4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t174);
-        /* 020B61A8 */ _t175 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B61A8 */ _t175 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B61A8 */ _t176 = _t175 & 0x00000001u;
         /* 020B61A8 */ if (_t176) goto L_020B61B0; else goto L_020B61AC;
   L_020B61AC: ; // 0x20b61ac
@@ -8812,10 +8812,10 @@ void Gambit_fn_020B5C3C(CPUState* cpu) {
         /* 020B6230 */ rbrew_write32(cpu->mem, _t190, cpu->r[12]);
         /* 020B6234 */ _t191 = cpu->r[26] + 0x00000014u;
         /* 020B6234 */ cpu->r[0] = rbrew_read32(cpu->mem, _t191);
-        /* 020B6238 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
+        /* 020B6238 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
         /* 020B623C */ _t192 = cpu->r[26] + 0x00000018u;
         /* 020B623C */ cpu->r[29] = rbrew_read32(cpu->mem, _t192);
-        /* 020B6240 */ _t193 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B6240 */ _t193 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B6240 */ _t194 = _t193 & 0x00000001u;
         /* 020B6240 */ if (_t194) goto L_020B6244; else goto L_020B6248;
   L_020B6244: ; // 0x20b6244
@@ -8831,23 +8831,23 @@ void Gambit_fn_020B5C3C(CPUState* cpu) {
         /* 020B625C */ _t197 = cpu->r[7] + 0x00000000u;
         /* 020B625C */ cpu->r[5] = rbrew_read8(cpu->mem, _t197);
         /* 020B6260 */ cpu->r[30] = 0x00000000u;
-        /* 020B6264 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[31]);
+        /* 020B6264 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[31]));
         /* 020B6268 */ cpu->r[9] = 0x00080000u;
-        /* 020B626C */ _t198 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B626C */ _t198 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B626C */ _t199 = _t198 & 0x00000001u;
         /* 020B626C */ if (_t199) goto L_020B6294; else goto L_020B6270;
   L_020B6270: ; // 0x20b6270
         /* 020B6270 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B6274 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[9]);
+        /* 020B6274 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[9]));
         /* 020B6278 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 020B627C */ _t200 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B627C */ _t200 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B627C */ _t201 = _t200 & 0x00000001u;
         /* 020B627C */ if (_t201) goto L_020B6290; else goto L_020B6280;
   L_020B6280: ; // 0x20b6280
         /* 020B6280 */ _t202 = cpu->r[7] + 0x00000000u;
         /* 020B6280 */ cpu->r[6] = rbrew_read8(cpu->mem, _t202);
-        /* 020B6284 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[31]);
-        /* 020B6288 */ _t203 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6284 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[31]));
+        /* 020B6288 */ _t203 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6288 */ _t204 = _t203 & 0x00000001u;
         /* 020B6288 */ if (_t204) goto L_020B628C; else goto L_020B6270;
   L_020B628C: ; // 0x20b628c
@@ -8859,10 +8859,10 @@ void Gambit_fn_020B5C3C(CPUState* cpu) {
         /* 020B6294 */ cpu->r[10] = rbrew_read32(cpu->mem, _t205);
         /* 020B6298 */ _t206 = cpu->r[1] + 0x00000010u;
         /* 020B6298 */ cpu->r[8] = rbrew_read32(cpu->mem, _t206);
-        /* 020B629C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[10]);
+        /* 020B629C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[10]));
         /* 020B62A0 */ _t207 = cpu->r[8] + 0x00000014u;
         /* 020B62A0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t207);
-        /* 020B62A4 */ _t208 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B62A4 */ _t208 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B62A4 */ _t209 = _t208 & 0x00000001u;
         /* 020B62A4 */ if (_t209) goto L_020B62AC; else goto L_020B62A8;
   L_020B62A8: ; // 0x20b62a8
@@ -9061,8 +9061,8 @@ void Gambit_fn_020B63DC(CPUState* cpu) {
         /* 020B63F4 */ _t3 = cpu->r[3] + 0x00003400u;
         /* 020B63F4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 020B63F8 */ Gambit_fn_0206C030(cpu);
-        /* 020B63FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B6400 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B63FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B6400 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6400 */ _t5 = _t4 & 0x00000001u;
         /* 020B6400 */ if (_t5) goto L_020B6418; else goto L_020B6404;
   L_020B6404: ; // 0x20b6404
@@ -9114,8 +9114,8 @@ void Gambit_fn_020B63E0(CPUState* cpu) {
         /* 020B63F4 */ _t3 = cpu->r[3] + 0x00003400u;
         /* 020B63F4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 020B63F8 */ Gambit_fn_0206C030(cpu);
-        /* 020B63FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B6400 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B63FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B6400 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6400 */ _t5 = _t4 & 0x00000001u;
         /* 020B6400 */ if (_t5) goto L_020B6418; else goto L_020B6404;
   L_020B6404: ; // 0x20b6404
@@ -9213,14 +9213,14 @@ void Gambit_fn_020B6494(CPUState* cpu) {
         /* 020B6494 */ _t0 = cpu->r[3] + 0x000001ECu;
         /* 020B6494 */ cpu->r[12] = rbrew_read8(cpu->mem, _t0);
         /* 020B6498 */ /* nop */
-        /* 020B649C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000002u);
+        /* 020B649C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000002u));
         /* 020B64A0 */ cpu->r[0] = 0x00000001u;
-        /* 020B64A4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B64A4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B64A4 */ _t2 = _t1 & 0x00000001u;
         /* 020B64A4 */ if (_t2) goto L_020B64B4; else goto L_020B64A8;
   L_020B64A8: ; // 0x20b64a8
-        /* 020B64A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000004u);
-        /* 020B64AC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B64A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000004u));
+        /* 020B64AC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B64AC */ _t4 = _t3 & 0x00000001u;
         /* 020B64AC */ if (_t4) goto L_020B64B4; else goto L_020B64B0;
   L_020B64B0: ; // 0x20b64b0
@@ -9488,8 +9488,8 @@ void Gambit_fn_020B65C4(CPUState* cpu) {
         /* 020B65EC */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020B65F0 */ cpu->r[4] = cpu->r[1] + 0x00000008u;
         /* 020B65F4 */ Gambit_fn_020DAE40(cpu);
-        /* 020B65F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B65FC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B65F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B65FC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B65FC */ _t7 = _t6 & 0x00000001u;
         /* 020B65FC */ if (_t7) goto L_020B6640; else goto L_020B6600;
   L_020B6600: ; // 0x20b6600
@@ -9551,8 +9551,8 @@ void Gambit_fn_020B65C8(CPUState* cpu) {
         /* 020B65EC */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020B65F0 */ cpu->r[4] = cpu->r[1] + 0x00000008u;
         /* 020B65F4 */ Gambit_fn_020DAE40(cpu);
-        /* 020B65F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B65FC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B65F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B65FC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B65FC */ _t7 = _t6 & 0x00000001u;
         /* 020B65FC */ if (_t7) goto L_020B6640; else goto L_020B6600;
   L_020B6600: ; // 0x20b6600
@@ -9766,8 +9766,8 @@ void Gambit_fn_020B6780(CPUState* cpu) {
         /* 020B678C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020B6790 */ _t3 = cpu->r[31] + 0x000001E8u;
         /* 020B6790 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 020B6794 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B6798 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6794 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B6798 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6798 */ _t5 = _t4 & 0x00000001u;
         /* 020B6798 */ if (_t5) goto L_020B679C; else goto L_020B67FC;
   L_020B679C: ; // 0x20b679c
@@ -9815,8 +9815,8 @@ void Gambit_fn_020B6780(CPUState* cpu) {
         /* 020B6818 */ cpu->r[4] = cpu->r[3];
         /* 020B681C */ cpu->r[3] = cpu->r[31];
         /* 020B6820 */ Gambit_fn_027EDF00(cpu);
-        /* 020B6824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B6828 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B6828 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6828 */ _t16 = _t15 & 0x00000001u;
         /* 020B6828 */ if (_t16) goto L_020B6840; else goto L_020B682C;
   L_020B682C: ; // 0x20b682c
@@ -9851,8 +9851,8 @@ void Gambit_fn_020B6858(CPUState* cpu) {
         /* 020B6864 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020B6868 */ _t3 = cpu->r[31] + 0x000001E8u;
         /* 020B6868 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 020B686C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B6870 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B686C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B6870 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6870 */ _t5 = _t4 & 0x00000001u;
         /* 020B6870 */ if (_t5) goto L_020B6874; else goto L_020B68B4;
   L_020B6874: ; // 0x20b6874
@@ -9891,8 +9891,8 @@ void Gambit_fn_020B6858(CPUState* cpu) {
         /* 020B68D0 */ cpu->ctr = cpu->r[12];
         /* 020B68D4 */ cpu->r[3] = cpu->r[31];
         /* 020B68D8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020B68DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B68E0 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B68DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B68E0 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B68E0 */ _t15 = _t14 & 0x00000001u;
         /* 020B68E0 */ if (_t15) goto L_020B68F0; else goto L_020B68E4;
   L_020B68E4: ; // 0x20b68e4
@@ -9928,8 +9928,8 @@ void Gambit_fn_020B6908(CPUState* cpu) {
         /* 020B691C */ cpu->ctr = cpu->r[0];
         /* 020B6920 */ cpu->r[31] = cpu->r[3];
         /* 020B6924 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020B6928 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B692C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6928 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B692C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B692C */ _t6 = _t5 & 0x00000001u;
         /* 020B692C */ if (_t6) goto L_020B693C; else goto L_020B6930;
   L_020B6930: ; // 0x20b6930
@@ -9961,8 +9961,8 @@ void Gambit_fn_020B6954(CPUState* cpu) {
         /* 020B6960 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020B6964 */ _t3 = cpu->r[31] + 0x000001E8u;
         /* 020B6964 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 020B6968 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B696C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6968 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B696C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B696C */ _t5 = _t4 & 0x00000001u;
         /* 020B696C */ if (_t5) goto L_020B6970; else goto L_020B69A8;
   L_020B6970: ; // 0x20b6970
@@ -9989,8 +9989,8 @@ void Gambit_fn_020B6954(CPUState* cpu) {
         /* 020B69B0 */ cpu->r[4] = cpu->r[3];
         /* 020B69B4 */ cpu->r[3] = cpu->r[31];
         /* 020B69B8 */ Gambit_fn_027EDF00(cpu);
-        /* 020B69BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B69C0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B69BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B69C0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B69C0 */ _t10 = _t9 & 0x00000001u;
         /* 020B69C0 */ if (_t10) goto L_020B69EC; else goto L_020B69C4;
   L_020B69C4: ; // 0x20b69c4
@@ -10023,15 +10023,15 @@ void Gambit_fn_020B6A00(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B6A00: ; // 0x20b6a00
-        /* 020B6A00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B6A04 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6A00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B6A04 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6A04 */ _t1 = _t0 & 0x00000001u;
         /* 020B6A04 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B6A04 */ goto L_020B6A08;
   L_020B6A08: ; // 0x20b6a08
         /* 020B6A08 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B6A08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B6A0C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6A08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B6A0C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6A0C */ _t3 = _t2 & 0x00000001u;
         /* 020B6A0C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B6A0C */ goto L_020B6A10;
@@ -10050,8 +10050,8 @@ void Gambit_fn_020B6A00(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -10065,15 +10065,15 @@ void Gambit_fn_020B6A00(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -10110,11 +10110,11 @@ void Gambit_fn_020B6A14(CPUState* cpu) {
         /* 020B6A20 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020B6A20 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020B6A24 */ cpu->r[30] = cpu->r[3];
-        /* 020B6A24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020B6A24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020B6A28 */ cpu->r[31] = cpu->r[4];
         /* 020B6A2C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020B6A2C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020B6A30 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6A30 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6A30 */ _t5 = _t4 & 0x00000001u;
         /* 020B6A30 */ if (_t5) goto L_020B6A74; else goto L_020B6A34;
   L_020B6A34: ; // 0x20b6a34
@@ -10134,8 +10134,8 @@ void Gambit_fn_020B6A14(CPUState* cpu) {
         /* 020B6A5C */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020B6A60 */ Gambit_fn_02068798(cpu);
         /* 020B6A64 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B6A64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B6A68 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6A64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B6A68 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6A68 */ _t10 = _t9 & 0x00000001u;
         /* 020B6A68 */ if (_t10) goto L_020B6A74; else goto L_020B6A6C;
   L_020B6A6C: ; // 0x20b6a6c
@@ -10166,11 +10166,11 @@ void Gambit_fn_020B6A18(CPUState* cpu) {
         /* 020B6A20 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020B6A20 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020B6A24 */ cpu->r[30] = cpu->r[3];
-        /* 020B6A24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020B6A24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020B6A28 */ cpu->r[31] = cpu->r[4];
         /* 020B6A2C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020B6A2C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020B6A30 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6A30 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6A30 */ _t5 = _t4 & 0x00000001u;
         /* 020B6A30 */ if (_t5) goto L_020B6A74; else goto L_020B6A34;
   L_020B6A34: ; // 0x20b6a34
@@ -10190,8 +10190,8 @@ void Gambit_fn_020B6A18(CPUState* cpu) {
         /* 020B6A5C */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020B6A60 */ Gambit_fn_02068798(cpu);
         /* 020B6A64 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B6A64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B6A68 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6A64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B6A68 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6A68 */ _t10 = _t9 & 0x00000001u;
         /* 020B6A68 */ if (_t10) goto L_020B6A74; else goto L_020B6A6C;
   L_020B6A6C: ; // 0x20b6a6c
@@ -10246,15 +10246,15 @@ void Gambit_fn_020B6AA4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B6AA4: ; // 0x20b6aa4
-        /* 020B6AA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B6AA8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6AA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B6AA8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6AA8 */ _t1 = _t0 & 0x00000001u;
         /* 020B6AA8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B6AA8 */ goto L_020B6AAC;
   L_020B6AAC: ; // 0x20b6aac
         /* 020B6AAC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B6AAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B6AB0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6AAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B6AB0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6AB0 */ _t3 = _t2 & 0x00000001u;
         /* 020B6AB0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B6AB0 */ goto L_020B6AB4;
@@ -10273,8 +10273,8 @@ void Gambit_fn_020B6AA4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -10288,15 +10288,15 @@ void Gambit_fn_020B6AA4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -10342,15 +10342,15 @@ void Gambit_fn_020B6AD4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B6AD4: ; // 0x20b6ad4
-        /* 020B6AD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B6AD8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6AD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B6AD8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6AD8 */ _t1 = _t0 & 0x00000001u;
         /* 020B6AD8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B6AD8 */ goto L_020B6ADC;
   L_020B6ADC: ; // 0x20b6adc
         /* 020B6ADC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B6ADC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B6AE0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6ADC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B6AE0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6AE0 */ _t3 = _t2 & 0x00000001u;
         /* 020B6AE0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B6AE0 */ goto L_020B6AE4;
@@ -10369,8 +10369,8 @@ void Gambit_fn_020B6AD4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -10384,15 +10384,15 @@ void Gambit_fn_020B6AD4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -10420,15 +10420,15 @@ void Gambit_fn_020B6AE8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B6AE8: ; // 0x20b6ae8
-        /* 020B6AE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B6AEC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6AE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B6AEC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6AEC */ _t1 = _t0 & 0x00000001u;
         /* 020B6AEC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B6AEC */ goto L_020B6AF0;
   L_020B6AF0: ; // 0x20b6af0
         /* 020B6AF0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B6AF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B6AF4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6AF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B6AF4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6AF4 */ _t3 = _t2 & 0x00000001u;
         /* 020B6AF4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B6AF4 */ goto L_020B6AF8;
@@ -10447,8 +10447,8 @@ void Gambit_fn_020B6AE8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -10462,15 +10462,15 @@ void Gambit_fn_020B6AE8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -10576,9 +10576,9 @@ void Gambit_fn_020B6B3C(CPUState* cpu) {
         /* 020B6B40 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 020B6B40 */ cpu->r[9] = _t0;
         /* 020B6B44 */ cpu->r[12] = 0x101D0000u;
-        /* 020B6B48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 020B6B48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 020B6B4C */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 020B6B50 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6B50 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6B50 */ _t2 = _t1 & 0x00000001u;
         /* 020B6B50 */ if (_t2) goto L_020B6B54; else goto L_020B6B68;
   L_020B6B54: ; // 0x20b6b54
@@ -10590,8 +10590,8 @@ void Gambit_fn_020B6B3C(CPUState* cpu) {
         /* 020B6B64 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 020B6B64 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_020B6B68: ; // 0x20b6b68
-        /* 020B6B68 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 020B6B6C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6B68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 020B6B6C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6B6C */ _t6 = _t5 & 0x00000001u;
         /* 020B6B6C */ if (_t6) goto L_020B6B70; else goto L_020B6B78;
   L_020B6B70: ; // 0x20b6b70
@@ -10603,9 +10603,9 @@ void Gambit_fn_020B6B3C(CPUState* cpu) {
         /* 020B6B7C */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 020B6B7C */ cpu->r[7] = _t7;
         /* 020B6B80 */ cpu->r[11] = 0x101D0000u;
-        /* 020B6B84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020B6B84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020B6B88 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 020B6B8C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6B8C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6B8C */ _t9 = _t8 & 0x00000001u;
         /* 020B6B8C */ if (_t9) goto L_020B6B90; else goto L_020B6BA4;
   L_020B6B90: ; // 0x20b6b90
@@ -10732,18 +10732,18 @@ void Gambit_fn_020B6BF8(CPUState* cpu) {
         /* 0208A0DC */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0208A0DC */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0208A0E0 */ cpu->r[12] = 0x00000000u;
-        /* 0208A0E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0208A0E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0208A0E8 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0208A0E8 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0208A0EC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A0EC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A0EC */ _t6 = _t5 & 0x00000001u;
         /* 0208A0EC */ if (_t6) goto L_0208A114; else goto L_0208A0F0;
   L_0208A0F0: ; // 0x208a0f0
         /* 0208A0F0 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0208A0F0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0208A0F4 */ /* nop */
-        /* 0208A0F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0208A0FC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0208A0F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0208A0FC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0208A0FC */ _t9 = _t8 & 0x00000001u;
         /* 0208A0FC */ if (_t9) goto L_0208A100; else goto L_0208A114;
   L_0208A100: ; // 0x208a100
@@ -10791,10 +10791,10 @@ void Gambit_fn_020B6C08(CPUState* cpu) {
         /* 020B6C28 */ cpu->r[31] = 0x101D0000u;
         /* 020B6C2C */ _t3 = cpu->r[28] + 0x0000001Cu;
         /* 020B6C2C */ rbrew_write32(cpu->mem, _t3, cpu->r[4]);
-        /* 020B6C30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B6C30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B6C34 */ _t4 = cpu->r[28] + 0x0000000Fu;
         /* 020B6C34 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[27]);
-        /* 020B6C38 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6C38 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6C38 */ _t6 = _t5 & 0x00000001u;
         /* 020B6C38 */ if (_t6) goto L_020B6C7C; else goto L_020B6C3C;
   L_020B6C3C: ; // 0x20b6c3c
@@ -10809,16 +10809,16 @@ void Gambit_fn_020B6C08(CPUState* cpu) {
         /* 020B6C50 */ cpu->r[5] = 0x00000004u;
         /* 020B6C54 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020B6C58 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020B6C5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B6C5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B6C60 */ cpu->r[0] = cpu->r[27];
-        /* 020B6C64 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B6C64 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B6C64 */ _t11 = _t10 & 0x00000001u;
         /* 020B6C64 */ if (_t11) goto L_020B6C6C; else goto L_020B6C68;
   L_020B6C68: ; // 0x20b6c68
         /* 020B6C68 */ cpu->r[0] = 0x00000001u;
   L_020B6C6C: ; // 0x20b6c6c
-        /* 020B6C6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B6C70 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6C6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B6C70 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6C70 */ _t13 = _t12 & 0x00000001u;
         /* 020B6C70 */ if (_t13) goto L_020B6C7C; else goto L_020B6C74;
   L_020B6C74: ; // 0x20b6c74
@@ -10830,9 +10830,9 @@ void Gambit_fn_020B6C08(CPUState* cpu) {
         /* 020B6C7C */ _t16 = cpu->r[28] + 0x00000020u;
         /* 020B6C7C */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 020B6C80 */ cpu->r[0] = 0x00000000u;
-        /* 020B6C84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 020B6C84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 020B6C88 */ cpu->r[12] = cpu->r[0];
-        /* 020B6C8C */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B6C8C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B6C8C */ _t18 = _t17 & 0x00000001u;
         /* 020B6C8C */ if (_t18) goto L_020B6C90; else goto L_020B6CB4;
   L_020B6C90: ; // 0x20b6c90
@@ -10857,8 +10857,8 @@ void Gambit_fn_020B6C08(CPUState* cpu) {
   L_020B6CB4: ; // 0x20b6cb4
         /* 020B6CB4 */ _t26 = cpu->r[28] + 0x0000000Fu;
         /* 020B6CB4 */ cpu->r[27] = rbrew_read8(cpu->mem, _t26);
-        /* 020B6CB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020B6CBC */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6CB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020B6CBC */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6CBC */ _t28 = _t27 & 0x00000001u;
         /* 020B6CBC */ if (_t28) goto L_020B6D00; else goto L_020B6CC0;
   L_020B6CC0: ; // 0x20b6cc0
@@ -10873,16 +10873,16 @@ void Gambit_fn_020B6C08(CPUState* cpu) {
         /* 020B6CD4 */ cpu->r[5] = 0x00000004u;
         /* 020B6CD8 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020B6CDC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020B6CE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B6CE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B6CE4 */ cpu->r[11] = cpu->r[27];
-        /* 020B6CE8 */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B6CE8 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B6CE8 */ _t33 = _t32 & 0x00000001u;
         /* 020B6CE8 */ if (_t33) goto L_020B6CF0; else goto L_020B6CEC;
   L_020B6CEC: ; // 0x20b6cec
         /* 020B6CEC */ cpu->r[11] = 0x00000001u;
   L_020B6CF0: ; // 0x20b6cf0
-        /* 020B6CF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B6CF4 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6CF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B6CF4 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6CF4 */ _t35 = _t34 & 0x00000001u;
         /* 020B6CF4 */ if (_t35) goto L_020B6D00; else goto L_020B6CF8;
   L_020B6CF8: ; // 0x20b6cf8
@@ -10894,9 +10894,9 @@ void Gambit_fn_020B6C08(CPUState* cpu) {
         /* 020B6D00 */ _t38 = cpu->r[28] + 0x00000028u;
         /* 020B6D00 */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 020B6D04 */ cpu->r[0] = 0x00000000u;
-        /* 020B6D08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 020B6D08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 020B6D0C */ cpu->r[12] = cpu->r[0];
-        /* 020B6D10 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B6D10 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B6D10 */ _t40 = _t39 & 0x00000001u;
         /* 020B6D10 */ if (_t40) goto L_020B6D14; else goto L_020B6D38;
   L_020B6D14: ; // 0x20b6d14
@@ -10921,8 +10921,8 @@ void Gambit_fn_020B6C08(CPUState* cpu) {
   L_020B6D38: ; // 0x20b6d38
         /* 020B6D38 */ _t48 = cpu->r[28] + 0x0000000Fu;
         /* 020B6D38 */ cpu->r[27] = rbrew_read8(cpu->mem, _t48);
-        /* 020B6D3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020B6D40 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6D3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020B6D40 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6D40 */ _t50 = _t49 & 0x00000001u;
         /* 020B6D40 */ if (_t50) goto L_020B6D84; else goto L_020B6D44;
   L_020B6D44: ; // 0x20b6d44
@@ -10937,16 +10937,16 @@ void Gambit_fn_020B6C08(CPUState* cpu) {
         /* 020B6D58 */ cpu->r[5] = 0x00000004u;
         /* 020B6D5C */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020B6D60 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020B6D64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B6D64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B6D68 */ cpu->r[10] = cpu->r[27];
-        /* 020B6D6C */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B6D6C */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B6D6C */ _t55 = _t54 & 0x00000001u;
         /* 020B6D6C */ if (_t55) goto L_020B6D74; else goto L_020B6D70;
   L_020B6D70: ; // 0x20b6d70
         /* 020B6D70 */ cpu->r[10] = 0x00000001u;
   L_020B6D74: ; // 0x20b6d74
-        /* 020B6D74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B6D78 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6D74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B6D78 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6D78 */ _t57 = _t56 & 0x00000001u;
         /* 020B6D78 */ if (_t57) goto L_020B6D84; else goto L_020B6D7C;
   L_020B6D7C: ; // 0x20b6d7c
@@ -10958,9 +10958,9 @@ void Gambit_fn_020B6C08(CPUState* cpu) {
         /* 020B6D84 */ _t60 = cpu->r[28] + 0x00000030u;
         /* 020B6D84 */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
         /* 020B6D88 */ cpu->r[0] = 0x00000000u;
-        /* 020B6D8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 020B6D8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 020B6D90 */ cpu->r[5] = cpu->r[0];
-        /* 020B6D94 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B6D94 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B6D94 */ _t62 = _t61 & 0x00000001u;
         /* 020B6D94 */ if (_t62) goto L_020B6D98; else goto L_020B6DBC;
   L_020B6D98: ; // 0x20b6d98
@@ -10985,8 +10985,8 @@ void Gambit_fn_020B6C08(CPUState* cpu) {
   L_020B6DBC: ; // 0x20b6dbc
         /* 020B6DBC */ _t70 = cpu->r[30] + 0x00000000u;
         /* 020B6DBC */ cpu->r[25] = rbrew_read8(cpu->mem, _t70);
-        /* 020B6DC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 020B6DC4 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6DC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 020B6DC4 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6DC4 */ _t72 = _t71 & 0x00000001u;
         /* 020B6DC4 */ if (_t72) goto L_020B6EA0; else goto L_020B6DC8;
   L_020B6DC8: ; // 0x20b6dc8
@@ -11002,10 +11002,10 @@ void Gambit_fn_020B6C08(CPUState* cpu) {
         /* 020B6DE0 */ cpu->r[4] = (uint32_t)((int32_t)cpu->r[25] * (int32_t)0x00000024u);
         /* 020B6DE4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020B6DE8 */ cpu->r[24] = cpu->r[3];
-        /* 020B6DEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 020B6DEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 020B6DF0 */ cpu->r[30] = cpu->r[25];
         /* 020B6DF4 */ cpu->r[7] = 0x00000000u;
-        /* 020B6DF8 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B6DF8 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B6DF8 */ _t77 = _t76 & 0x00000001u;
         /* 020B6DF8 */ if (_t77) goto L_020B6E00; else goto L_020B6DFC;
   L_020B6DFC: ; // 0x20b6dfc
@@ -11018,36 +11018,36 @@ void Gambit_fn_020B6C08(CPUState* cpu) {
         /* 020B6E0C */ cpu->r[23] = 0x00000018u;
   L_020B6E10: ; // 0x20b6e10
         /* 020B6E10 */ cpu->r[27] = cpu->r[24] + cpu->r[22];
-        /* 020B6E10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020B6E14 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6E10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020B6E14 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6E14 */ _t80 = _t79 & 0x00000001u;
         /* 020B6E14 */ if (_t80) goto L_020B6E84; else goto L_020B6E18;
   L_020B6E18: ; // 0x20b6e18
         /* 020B6E18 */ cpu->r[26] = cpu->r[27];
-        /* 020B6E18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 020B6E1C */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6E18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 020B6E1C */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6E1C */ _t82 = _t81 & 0x00000001u;
         /* 020B6E1C */ if (_t82) goto L_020B6E20; else goto L_020B6E30;
   L_020B6E20: ; // 0x20b6e20
         /* 020B6E20 */ cpu->r[3] = 0x00000024u;
         /* 020B6E24 */ Gambit_fn_02801A78(cpu);
         /* 020B6E28 */ cpu->r[26] = cpu->r[3];
-        /* 020B6E28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 020B6E2C */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6E28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 020B6E2C */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6E2C */ _t84 = _t83 & 0x00000001u;
         /* 020B6E2C */ if (_t84) goto L_020B6E78; else goto L_020B6E30;
   L_020B6E30: ; // 0x20b6e30
         /* 020B6E30 */ cpu->r[11] = cpu->r[26];
-        /* 020B6E30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020B6E34 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6E30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020B6E34 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6E34 */ _t86 = _t85 & 0x00000001u;
         /* 020B6E34 */ if (_t86) goto L_020B6E38; else goto L_020B6E48;
   L_020B6E38: ; // 0x20b6e38
         /* 020B6E38 */ cpu->r[3] = 0x0000000Cu;
         /* 020B6E3C */ Gambit_fn_02801A78(cpu);
         /* 020B6E40 */ cpu->r[11] = cpu->r[3];
-        /* 020B6E40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020B6E44 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6E40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020B6E44 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6E44 */ _t88 = _t87 & 0x00000001u;
         /* 020B6E44 */ if (_t88) goto L_020B6E64; else goto L_020B6E48;
   L_020B6E48: ; // 0x20b6e48
@@ -11078,14 +11078,14 @@ void Gambit_fn_020B6C08(CPUState* cpu) {
         /* 020B6E80 */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
   L_020B6E84: ; // 0x20b6e84
         /* 020B6E84 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 020B6E84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020B6E84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020B6E88 */ cpu->r[22] = cpu->r[22] + 0x00000024u;
-        /* 020B6E8C */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6E8C */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6E8C */ _t98 = _t97 & 0x00000001u;
         /* 020B6E8C */ if (_t98) goto L_020B6E90; else goto L_020B6E10;
   L_020B6E90: ; // 0x20b6e90
-        /* 020B6E90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 020B6E94 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6E90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 020B6E94 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6E94 */ _t100 = _t99 & 0x00000001u;
         /* 020B6E94 */ if (_t100) goto L_020B6EA0; else goto L_020B6E98;
   L_020B6E98: ; // 0x20b6e98
@@ -11115,10 +11115,10 @@ void Gambit_fn_020B6EB8(CPUState* cpu) {
         /* 020B6EBC */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 020B6EC0 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 020B6EC0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 020B6EC4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[12]);
+        /* 020B6EC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[12]));
         /* 020B6EC8 */ _t3 = cpu->r[4] + 0x00000000u;
         /* 020B6EC8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 020B6ECC */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B6ECC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B6ECC */ _t5 = _t4 & 0x00000001u;
         /* 020B6ECC */ if (_t5) goto L_020B6ED0; else goto L_020B6ED8;
   L_020B6ED0: ; // 0x20b6ed0
@@ -11135,10 +11135,10 @@ void Gambit_fn_020B6EB8(CPUState* cpu) {
         /* 020B6EE4 */ cpu->r[9] = rbrew_read8(cpu->mem, _t9);
         /* 020B6EE8 */ _t10 = cpu->r[3] + 0x00000028u;
         /* 020B6EE8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 020B6EEC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
+        /* 020B6EEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
         /* 020B6EF0 */ _t11 = cpu->r[3] + 0x0000002Cu;
         /* 020B6EF0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
-        /* 020B6EF4 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B6EF4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B6EF4 */ _t13 = _t12 & 0x00000001u;
         /* 020B6EF4 */ if (_t13) goto L_020B6EF8; else goto L_020B6F00;
   L_020B6EF8: ; // 0x20b6ef8
@@ -11159,10 +11159,10 @@ void Gambit_fn_020B6EB8(CPUState* cpu) {
         /* 020B6F14 */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
         /* 020B6F18 */ _t20 = cpu->r[3] + 0x00000034u;
         /* 020B6F18 */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 020B6F1C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
+        /* 020B6F1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
         /* 020B6F20 */ _t21 = cpu->r[6] + 0x00000000u;
         /* 020B6F20 */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
-        /* 020B6F24 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B6F24 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B6F24 */ _t23 = _t22 & 0x00000001u;
         /* 020B6F24 */ if (_t23) goto L_020B6F28; else goto L_020B6F30;
   L_020B6F28: ; // 0x20b6f28
@@ -11195,11 +11195,11 @@ void Gambit_fn_020B6F40(CPUState* cpu) {
         /* 020B7DB0 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020B7DB0 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020B7DB4 */ cpu->r[30] = cpu->r[3];
-        /* 020B7DB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020B7DB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020B7DB8 */ cpu->r[31] = cpu->r[4];
         /* 020B7DBC */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020B7DBC */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020B7DC0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7DC0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7DC0 */ _t5 = _t4 & 0x00000001u;
         /* 020B7DC0 */ if (_t5) goto L_020B7E04; else goto L_020B7DC4;
   L_020B7DC4: ; // 0x20b7dc4
@@ -11219,8 +11219,8 @@ void Gambit_fn_020B6F40(CPUState* cpu) {
         /* 020B7DEC */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020B7DF0 */ Gambit_fn_02068798(cpu);
         /* 020B7DF4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B7DF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B7DF8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7DF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B7DF8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7DF8 */ _t10 = _t9 & 0x00000001u;
         /* 020B7DF8 */ if (_t10) goto L_020B7E04; else goto L_020B7DFC;
   L_020B7DFC: ; // 0x20b7dfc
@@ -11248,8 +11248,8 @@ void Gambit_fn_020B6F48(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -11301,19 +11301,19 @@ void Gambit_fn_020B6F60(CPUState* cpu) {
         /* 020B6F68 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020B6F6C */ /* nop */
         /* 020B6F70 */ cpu->r[29] = cpu->r[3];
-        /* 020B6F70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020B6F70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020B6F74 */ cpu->r[28] = cpu->r[4];
         /* 020B6F78 */ cpu->r[30] = cpu->r[5];
         /* 020B6F7C */ cpu->r[31] = cpu->r[6];
-        /* 020B6F80 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6F80 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6F80 */ _t3 = _t2 & 0x00000001u;
         /* 020B6F80 */ if (_t3) goto L_020B6F84; else goto L_020B6F94;
   L_020B6F84: ; // 0x20b6f84
         /* 020B6F84 */ cpu->r[3] = 0x0000021Cu;
         /* 020B6F88 */ Gambit_fn_02801A78(cpu);
         /* 020B6F8C */ cpu->r[29] = cpu->r[3];
-        /* 020B6F8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020B6F90 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6F8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020B6F90 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6F90 */ _t5 = _t4 & 0x00000001u;
         /* 020B6F90 */ if (_t5) goto L_020B7550; else goto L_020B6F94;
   L_020B6F94: ; // 0x20b6f94
@@ -11340,22 +11340,22 @@ void Gambit_fn_020B6F60(CPUState* cpu) {
         /* 020B6FD4 */ rbrew_write32(cpu->mem, _t9, cpu->r[8]);
         /* 020B6FD8 */ cpu->r[10] = cpu->r[10] + 0x0000490Cu;
         /* 020B6FDC */ cpu->r[27] = cpu->r[29] + 0x000001DCu;
-        /* 020B6FDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B6FDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B6FE0 */ _t10 = cpu->r[29] + 0x0000001Cu;
         /* 020B6FE0 */ rbrew_write32(cpu->mem, _t10, cpu->r[9]);
         /* 020B6FE4 */ cpu->r[28] = 0x00000000u;
         /* 020B6FE8 */ cpu->r[30] = cpu->r[27];
         /* 020B6FEC */ _t11 = cpu->r[29] + 0x000001C8u;
         /* 020B6FEC */ rbrew_write32(cpu->mem, _t11, cpu->r[10]);
-        /* 020B6FF0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6FF0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6FF0 */ _t13 = _t12 & 0x00000001u;
         /* 020B6FF0 */ if (_t13) goto L_020B6FF4; else goto L_020B7004;
   L_020B6FF4: ; // 0x20b6ff4
         /* 020B6FF4 */ cpu->r[3] = 0x00000038u;
         /* 020B6FF8 */ Gambit_fn_02801A78(cpu);
         /* 020B6FFC */ cpu->r[30] = cpu->r[3];
-        /* 020B6FFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 020B7000 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6FFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 020B7000 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7000 */ _t15 = _t14 & 0x00000001u;
         /* 020B7000 */ if (_t15) goto L_020B7034; else goto L_020B7004;
   L_020B7004: ; // 0x20b7004
@@ -11419,23 +11419,23 @@ void Gambit_fn_020B6F60(CPUState* cpu) {
         /* 020B7098 */ _t35 = cpu->r[11] + 0x00000000u;
         /* 020B7098 */ cpu->r[0] = rbrew_read8(cpu->mem, _t35);
         /* 020B709C */ cpu->r[31] = 0x00000000u;
-        /* 020B70A0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
+        /* 020B70A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
         /* 020B70A4 */ cpu->r[0] = 0x00080000u;
-        /* 020B70A8 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B70A8 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B70A8 */ _t37 = _t36 & 0x00000001u;
         /* 020B70A8 */ if (_t37) goto L_020B70D0; else goto L_020B70AC;
   L_020B70AC: ; // 0x20b70ac
         /* 020B70AC */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020B70B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 020B70B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 020B70B4 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 020B70B8 */ _t38 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B70B8 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B70B8 */ _t39 = _t38 & 0x00000001u;
         /* 020B70B8 */ if (_t39) goto L_020B70CC; else goto L_020B70BC;
   L_020B70BC: ; // 0x20b70bc
         /* 020B70BC */ _t40 = cpu->r[11] + 0x00000000u;
         /* 020B70BC */ cpu->r[5] = rbrew_read8(cpu->mem, _t40);
-        /* 020B70C0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[30]);
-        /* 020B70C4 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B70C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[30]));
+        /* 020B70C4 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B70C4 */ _t42 = _t41 & 0x00000001u;
         /* 020B70C4 */ if (_t42) goto L_020B70C8; else goto L_020B70AC;
   L_020B70C8: ; // 0x20b70c8
@@ -11445,10 +11445,10 @@ void Gambit_fn_020B6F60(CPUState* cpu) {
   L_020B70D0: ; // 0x20b70d0
         /* 020B70D0 */ _t43 = cpu->r[23] + 0x00000008u;
         /* 020B70D0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t43);
-        /* 020B70D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 020B70D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 020B70D8 */ _t44 = cpu->r[1] + 0x00000010u;
         /* 020B70D8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t44);
-        /* 020B70DC */ _t45 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B70DC */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B70DC */ _t46 = _t45 & 0x00000001u;
         /* 020B70DC */ if (_t46) goto L_020B70E4; else goto L_020B70E0;
   L_020B70E0: ; // 0x20b70e0
@@ -11505,10 +11505,10 @@ void Gambit_fn_020B6F60(CPUState* cpu) {
         /* 020B7168 */ rbrew_write32(cpu->mem, _t61, cpu->r[9]);
         /* 020B716C */ _t62 = cpu->r[27] + 0x00000014u;
         /* 020B716C */ cpu->r[10] = rbrew_read32(cpu->mem, _t62);
-        /* 020B7170 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000001u);
+        /* 020B7170 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000001u));
         /* 020B7174 */ _t63 = cpu->r[27] + 0x00000018u;
         /* 020B7174 */ cpu->r[24] = rbrew_read32(cpu->mem, _t63);
-        /* 020B7178 */ _t64 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B7178 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B7178 */ _t65 = _t64 & 0x00000001u;
         /* 020B7178 */ if (_t65) goto L_020B717C; else goto L_020B7180;
   L_020B717C: ; // 0x20b717c
@@ -11524,23 +11524,23 @@ void Gambit_fn_020B6F60(CPUState* cpu) {
         /* 020B7194 */ _t68 = cpu->r[6] + 0x00000000u;
         /* 020B7194 */ cpu->r[11] = rbrew_read8(cpu->mem, _t68);
         /* 020B7198 */ cpu->r[31] = 0x00000000u;
-        /* 020B719C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[30]);
+        /* 020B719C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[30]));
         /* 020B71A0 */ cpu->r[8] = 0x00080000u;
-        /* 020B71A4 */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B71A4 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B71A4 */ _t70 = _t69 & 0x00000001u;
         /* 020B71A4 */ if (_t70) goto L_020B71CC; else goto L_020B71A8;
   L_020B71A8: ; // 0x20b71a8
         /* 020B71A8 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020B71AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[8]);
+        /* 020B71AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[8]));
         /* 020B71B0 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 020B71B4 */ _t71 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B71B4 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B71B4 */ _t72 = _t71 & 0x00000001u;
         /* 020B71B4 */ if (_t72) goto L_020B71C8; else goto L_020B71B8;
   L_020B71B8: ; // 0x20b71b8
         /* 020B71B8 */ _t73 = cpu->r[6] + 0x00000000u;
         /* 020B71B8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t73);
-        /* 020B71BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
-        /* 020B71C0 */ _t74 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B71BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
+        /* 020B71C0 */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B71C0 */ _t75 = _t74 & 0x00000001u;
         /* 020B71C0 */ if (_t75) goto L_020B71C4; else goto L_020B71A8;
   L_020B71C4: ; // 0x20b71c4
@@ -11552,10 +11552,10 @@ void Gambit_fn_020B6F60(CPUState* cpu) {
         /* 020B71CC */ cpu->r[9] = rbrew_read32(cpu->mem, _t76);
         /* 020B71D0 */ _t77 = cpu->r[1] + 0x00000010u;
         /* 020B71D0 */ cpu->r[6] = rbrew_read32(cpu->mem, _t77);
-        /* 020B71D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 020B71D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 020B71D8 */ _t78 = cpu->r[6] + 0x00000014u;
         /* 020B71D8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t78);
-        /* 020B71DC */ _t79 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B71DC */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B71DC */ _t80 = _t79 & 0x00000001u;
         /* 020B71DC */ if (_t80) goto L_020B71E4; else goto L_020B71E0;
   L_020B71E0: ; // 0x20b71e0
@@ -11610,10 +11610,10 @@ void Gambit_fn_020B6F60(CPUState* cpu) {
         /* 020B7264 */ rbrew_write32(cpu->mem, _t94, cpu->r[12]);
         /* 020B7268 */ _t95 = cpu->r[27] + 0x00000014u;
         /* 020B7268 */ cpu->r[5] = rbrew_read32(cpu->mem, _t95);
-        /* 020B726C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x00000002u);
+        /* 020B726C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x00000002u));
         /* 020B7270 */ _t96 = cpu->r[27] + 0x00000018u;
         /* 020B7270 */ cpu->r[24] = rbrew_read32(cpu->mem, _t96);
-        /* 020B7274 */ _t97 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B7274 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B7274 */ _t98 = _t97 & 0x00000001u;
         /* 020B7274 */ if (_t98) goto L_020B7278; else goto L_020B727C;
   L_020B7278: ; // 0x20b7278
@@ -11629,23 +11629,23 @@ void Gambit_fn_020B6F60(CPUState* cpu) {
         /* 020B7290 */ _t101 = cpu->r[11] + 0x00000000u;
         /* 020B7290 */ cpu->r[7] = rbrew_read8(cpu->mem, _t101);
         /* 020B7294 */ cpu->r[31] = 0x00000000u;
-        /* 020B7298 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[30]);
+        /* 020B7298 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[30]));
         /* 020B729C */ cpu->r[0] = 0x00080000u;
-        /* 020B72A0 */ _t102 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B72A0 */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B72A0 */ _t103 = _t102 & 0x00000001u;
         /* 020B72A0 */ if (_t103) goto L_020B72C8; else goto L_020B72A4;
   L_020B72A4: ; // 0x20b72a4
         /* 020B72A4 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020B72A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 020B72A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 020B72AC */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 020B72B0 */ _t104 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B72B0 */ _t104 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B72B0 */ _t105 = _t104 & 0x00000001u;
         /* 020B72B0 */ if (_t105) goto L_020B72C4; else goto L_020B72B4;
   L_020B72B4: ; // 0x20b72b4
         /* 020B72B4 */ _t106 = cpu->r[11] + 0x00000000u;
         /* 020B72B4 */ cpu->r[9] = rbrew_read8(cpu->mem, _t106);
-        /* 020B72B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[30]);
-        /* 020B72BC */ _t107 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B72B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[30]));
+        /* 020B72BC */ _t107 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B72BC */ _t108 = _t107 & 0x00000001u;
         /* 020B72BC */ if (_t108) goto L_020B72C0; else goto L_020B72A4;
   L_020B72C0: ; // 0x20b72c0
@@ -11655,8 +11655,8 @@ void Gambit_fn_020B6F60(CPUState* cpu) {
   L_020B72C8: ; // 0x20b72c8
         /* 020B72C8 */ _t109 = cpu->r[24] + 0x00000008u;
         /* 020B72C8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t109);
-        /* 020B72CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
-        /* 020B72D0 */ _t110 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B72CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
+        /* 020B72D0 */ _t110 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B72D0 */ _t111 = _t110 & 0x00000001u;
         /* 020B72D0 */ if (_t111) goto L_020B72D8; else goto L_020B72D4;
   L_020B72D4: ; // 0x20b72d4
@@ -11715,10 +11715,10 @@ void Gambit_fn_020B6F60(CPUState* cpu) {
         /* 020B7360 */ rbrew_write32(cpu->mem, _t127, cpu->r[6]);
         /* 020B7364 */ _t128 = cpu->r[27] + 0x00000014u;
         /* 020B7364 */ cpu->r[8] = rbrew_read32(cpu->mem, _t128);
-        /* 020B7368 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000003u);
+        /* 020B7368 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000003u));
         /* 020B736C */ _t129 = cpu->r[27] + 0x00000018u;
         /* 020B736C */ cpu->r[31] = rbrew_read32(cpu->mem, _t129);
-        /* 020B7370 */ _t130 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B7370 */ _t130 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B7370 */ _t131 = _t130 & 0x00000001u;
         /* 020B7370 */ if (_t131) goto L_020B7374; else goto L_020B7378;
   L_020B7374: ; // 0x20b7374
@@ -11734,23 +11734,23 @@ void Gambit_fn_020B6F60(CPUState* cpu) {
         /* 020B738C */ _t134 = cpu->r[8] + 0x00000000u;
         /* 020B738C */ cpu->r[0] = rbrew_read8(cpu->mem, _t134);
         /* 020B7390 */ cpu->r[24] = 0x00000000u;
-        /* 020B7394 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
+        /* 020B7394 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
         /* 020B7398 */ cpu->r[9] = 0x00080000u;
-        /* 020B739C */ _t135 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B739C */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B739C */ _t136 = _t135 & 0x00000001u;
         /* 020B739C */ if (_t136) goto L_020B73C4; else goto L_020B73A0;
   L_020B73A0: ; // 0x20b73a0
         /* 020B73A0 */ cpu->r[24] = cpu->r[24] + 0x00000001u;
-        /* 020B73A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], cpu->r[9]);
+        /* 020B73A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], cpu->r[9]));
         /* 020B73A8 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 020B73AC */ _t137 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B73AC */ _t137 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B73AC */ _t138 = _t137 & 0x00000001u;
         /* 020B73AC */ if (_t138) goto L_020B73C0; else goto L_020B73B0;
   L_020B73B0: ; // 0x20b73b0
         /* 020B73B0 */ _t139 = cpu->r[8] + 0x00000000u;
         /* 020B73B0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t139);
-        /* 020B73B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
-        /* 020B73B8 */ _t140 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B73B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
+        /* 020B73B8 */ _t140 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B73B8 */ _t141 = _t140 & 0x00000001u;
         /* 020B73B8 */ if (_t141) goto L_020B73BC; else goto L_020B73A0;
   L_020B73BC: ; // 0x20b73bc
@@ -11762,10 +11762,10 @@ void Gambit_fn_020B6F60(CPUState* cpu) {
         /* 020B73C4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t142);
         /* 020B73C8 */ _t143 = cpu->r[1] + 0x00000010u;
         /* 020B73C8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t143);
-        /* 020B73CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], cpu->r[12]);
+        /* 020B73CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], cpu->r[12]));
         /* 020B73D0 */ _t144 = cpu->r[6] + 0x00000014u;
         /* 020B73D0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t144);
-        /* 020B73D4 */ _t145 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B73D4 */ _t145 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B73D4 */ _t146 = _t145 & 0x00000001u;
         /* 020B73D4 */ if (_t146) goto L_020B73DC; else goto L_020B73D8;
   L_020B73D8: ; // 0x20b73d8
@@ -11820,10 +11820,10 @@ void Gambit_fn_020B6F60(CPUState* cpu) {
         /* 020B745C */ rbrew_write32(cpu->mem, _t160, cpu->r[0]);
         /* 020B7460 */ _t161 = cpu->r[27] + 0x00000014u;
         /* 020B7460 */ cpu->r[10] = rbrew_read32(cpu->mem, _t161);
-        /* 020B7464 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000004u);
+        /* 020B7464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000004u));
         /* 020B7468 */ _t162 = cpu->r[27] + 0x00000018u;
         /* 020B7468 */ cpu->r[26] = rbrew_read32(cpu->mem, _t162);
-        /* 020B746C */ _t163 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B746C */ _t163 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B746C */ _t164 = _t163 & 0x00000001u;
         /* 020B746C */ if (_t164) goto L_020B7470; else goto L_020B7474;
   L_020B7470: ; // 0x20b7470
@@ -11839,23 +11839,23 @@ void Gambit_fn_020B6F60(CPUState* cpu) {
         /* 020B7488 */ _t167 = cpu->r[12] + 0x00000000u;
         /* 020B7488 */ cpu->r[11] = rbrew_read8(cpu->mem, _t167);
         /* 020B748C */ cpu->r[31] = 0x00000000u;
-        /* 020B7490 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[30]);
+        /* 020B7490 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[30]));
         /* 020B7494 */ cpu->r[5] = 0x00080000u;
-        /* 020B7498 */ _t168 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7498 */ _t168 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7498 */ _t169 = _t168 & 0x00000001u;
         /* 020B7498 */ if (_t169) goto L_020B74C0; else goto L_020B749C;
   L_020B749C: ; // 0x20b749c
         /* 020B749C */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020B74A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 020B74A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 020B74A4 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 020B74A8 */ _t170 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B74A8 */ _t170 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B74A8 */ _t171 = _t170 & 0x00000001u;
         /* 020B74A8 */ if (_t171) goto L_020B74BC; else goto L_020B74AC;
   L_020B74AC: ; // 0x20b74ac
         /* 020B74AC */ _t172 = cpu->r[12] + 0x00000000u;
         /* 020B74AC */ cpu->r[10] = rbrew_read8(cpu->mem, _t172);
-        /* 020B74B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[30]);
-        /* 020B74B4 */ _t173 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B74B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[30]));
+        /* 020B74B4 */ _t173 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B74B4 */ _t174 = _t173 & 0x00000001u;
         /* 020B74B4 */ if (_t174) goto L_020B74B8; else goto L_020B749C;
   L_020B74B8: ; // 0x20b74b8
@@ -11867,10 +11867,10 @@ void Gambit_fn_020B6F60(CPUState* cpu) {
         /* 020B74C0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t175);
         /* 020B74C4 */ _t176 = cpu->r[1] + 0x00000010u;
         /* 020B74C4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t176);
-        /* 020B74C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 020B74C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 020B74CC */ _t177 = cpu->r[11] + 0x00000014u;
         /* 020B74CC */ cpu->r[12] = rbrew_read32(cpu->mem, _t177);
-        /* 020B74D0 */ _t178 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B74D0 */ _t178 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B74D0 */ _t179 = _t178 & 0x00000001u;
         /* 020B74D0 */ if (_t179) goto L_020B74D8; else goto L_020B74D4;
   L_020B74D4: ; // 0x20b74d4
@@ -11941,19 +11941,19 @@ void Gambit_fn_020B6F64(CPUState* cpu) {
         /* 020B6F68 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020B6F6C */ /* nop */
         /* 020B6F70 */ cpu->r[29] = cpu->r[3];
-        /* 020B6F70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020B6F70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020B6F74 */ cpu->r[28] = cpu->r[4];
         /* 020B6F78 */ cpu->r[30] = cpu->r[5];
         /* 020B6F7C */ cpu->r[31] = cpu->r[6];
-        /* 020B6F80 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6F80 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6F80 */ _t3 = _t2 & 0x00000001u;
         /* 020B6F80 */ if (_t3) goto L_020B6F84; else goto L_020B6F94;
   L_020B6F84: ; // 0x20b6f84
         /* 020B6F84 */ cpu->r[3] = 0x0000021Cu;
         /* 020B6F88 */ Gambit_fn_02801A78(cpu);
         /* 020B6F8C */ cpu->r[29] = cpu->r[3];
-        /* 020B6F8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020B6F90 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6F8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020B6F90 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6F90 */ _t5 = _t4 & 0x00000001u;
         /* 020B6F90 */ if (_t5) goto L_020B7550; else goto L_020B6F94;
   L_020B6F94: ; // 0x20b6f94
@@ -11980,22 +11980,22 @@ void Gambit_fn_020B6F64(CPUState* cpu) {
         /* 020B6FD4 */ rbrew_write32(cpu->mem, _t9, cpu->r[8]);
         /* 020B6FD8 */ cpu->r[10] = cpu->r[10] + 0x0000490Cu;
         /* 020B6FDC */ cpu->r[27] = cpu->r[29] + 0x000001DCu;
-        /* 020B6FDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B6FDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B6FE0 */ _t10 = cpu->r[29] + 0x0000001Cu;
         /* 020B6FE0 */ rbrew_write32(cpu->mem, _t10, cpu->r[9]);
         /* 020B6FE4 */ cpu->r[28] = 0x00000000u;
         /* 020B6FE8 */ cpu->r[30] = cpu->r[27];
         /* 020B6FEC */ _t11 = cpu->r[29] + 0x000001C8u;
         /* 020B6FEC */ rbrew_write32(cpu->mem, _t11, cpu->r[10]);
-        /* 020B6FF0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6FF0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B6FF0 */ _t13 = _t12 & 0x00000001u;
         /* 020B6FF0 */ if (_t13) goto L_020B6FF4; else goto L_020B7004;
   L_020B6FF4: ; // 0x20b6ff4
         /* 020B6FF4 */ cpu->r[3] = 0x00000038u;
         /* 020B6FF8 */ Gambit_fn_02801A78(cpu);
         /* 020B6FFC */ cpu->r[30] = cpu->r[3];
-        /* 020B6FFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 020B7000 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B6FFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 020B7000 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7000 */ _t15 = _t14 & 0x00000001u;
         /* 020B7000 */ if (_t15) goto L_020B7034; else goto L_020B7004;
   L_020B7004: ; // 0x20b7004
@@ -12059,23 +12059,23 @@ void Gambit_fn_020B6F64(CPUState* cpu) {
         /* 020B7098 */ _t35 = cpu->r[11] + 0x00000000u;
         /* 020B7098 */ cpu->r[0] = rbrew_read8(cpu->mem, _t35);
         /* 020B709C */ cpu->r[31] = 0x00000000u;
-        /* 020B70A0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
+        /* 020B70A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
         /* 020B70A4 */ cpu->r[0] = 0x00080000u;
-        /* 020B70A8 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B70A8 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B70A8 */ _t37 = _t36 & 0x00000001u;
         /* 020B70A8 */ if (_t37) goto L_020B70D0; else goto L_020B70AC;
   L_020B70AC: ; // 0x20b70ac
         /* 020B70AC */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020B70B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 020B70B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 020B70B4 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 020B70B8 */ _t38 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B70B8 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B70B8 */ _t39 = _t38 & 0x00000001u;
         /* 020B70B8 */ if (_t39) goto L_020B70CC; else goto L_020B70BC;
   L_020B70BC: ; // 0x20b70bc
         /* 020B70BC */ _t40 = cpu->r[11] + 0x00000000u;
         /* 020B70BC */ cpu->r[5] = rbrew_read8(cpu->mem, _t40);
-        /* 020B70C0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[30]);
-        /* 020B70C4 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B70C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[30]));
+        /* 020B70C4 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B70C4 */ _t42 = _t41 & 0x00000001u;
         /* 020B70C4 */ if (_t42) goto L_020B70C8; else goto L_020B70AC;
   L_020B70C8: ; // 0x20b70c8
@@ -12085,10 +12085,10 @@ void Gambit_fn_020B6F64(CPUState* cpu) {
   L_020B70D0: ; // 0x20b70d0
         /* 020B70D0 */ _t43 = cpu->r[23] + 0x00000008u;
         /* 020B70D0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t43);
-        /* 020B70D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 020B70D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 020B70D8 */ _t44 = cpu->r[1] + 0x00000010u;
         /* 020B70D8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t44);
-        /* 020B70DC */ _t45 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B70DC */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B70DC */ _t46 = _t45 & 0x00000001u;
         /* 020B70DC */ if (_t46) goto L_020B70E4; else goto L_020B70E0;
   L_020B70E0: ; // 0x20b70e0
@@ -12145,10 +12145,10 @@ void Gambit_fn_020B6F64(CPUState* cpu) {
         /* 020B7168 */ rbrew_write32(cpu->mem, _t61, cpu->r[9]);
         /* 020B716C */ _t62 = cpu->r[27] + 0x00000014u;
         /* 020B716C */ cpu->r[10] = rbrew_read32(cpu->mem, _t62);
-        /* 020B7170 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000001u);
+        /* 020B7170 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000001u));
         /* 020B7174 */ _t63 = cpu->r[27] + 0x00000018u;
         /* 020B7174 */ cpu->r[24] = rbrew_read32(cpu->mem, _t63);
-        /* 020B7178 */ _t64 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B7178 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B7178 */ _t65 = _t64 & 0x00000001u;
         /* 020B7178 */ if (_t65) goto L_020B717C; else goto L_020B7180;
   L_020B717C: ; // 0x20b717c
@@ -12164,23 +12164,23 @@ void Gambit_fn_020B6F64(CPUState* cpu) {
         /* 020B7194 */ _t68 = cpu->r[6] + 0x00000000u;
         /* 020B7194 */ cpu->r[11] = rbrew_read8(cpu->mem, _t68);
         /* 020B7198 */ cpu->r[31] = 0x00000000u;
-        /* 020B719C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[30]);
+        /* 020B719C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[30]));
         /* 020B71A0 */ cpu->r[8] = 0x00080000u;
-        /* 020B71A4 */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B71A4 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B71A4 */ _t70 = _t69 & 0x00000001u;
         /* 020B71A4 */ if (_t70) goto L_020B71CC; else goto L_020B71A8;
   L_020B71A8: ; // 0x20b71a8
         /* 020B71A8 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020B71AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[8]);
+        /* 020B71AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[8]));
         /* 020B71B0 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 020B71B4 */ _t71 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B71B4 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B71B4 */ _t72 = _t71 & 0x00000001u;
         /* 020B71B4 */ if (_t72) goto L_020B71C8; else goto L_020B71B8;
   L_020B71B8: ; // 0x20b71b8
         /* 020B71B8 */ _t73 = cpu->r[6] + 0x00000000u;
         /* 020B71B8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t73);
-        /* 020B71BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
-        /* 020B71C0 */ _t74 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B71BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
+        /* 020B71C0 */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B71C0 */ _t75 = _t74 & 0x00000001u;
         /* 020B71C0 */ if (_t75) goto L_020B71C4; else goto L_020B71A8;
   L_020B71C4: ; // 0x20b71c4
@@ -12192,10 +12192,10 @@ void Gambit_fn_020B6F64(CPUState* cpu) {
         /* 020B71CC */ cpu->r[9] = rbrew_read32(cpu->mem, _t76);
         /* 020B71D0 */ _t77 = cpu->r[1] + 0x00000010u;
         /* 020B71D0 */ cpu->r[6] = rbrew_read32(cpu->mem, _t77);
-        /* 020B71D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 020B71D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 020B71D8 */ _t78 = cpu->r[6] + 0x00000014u;
         /* 020B71D8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t78);
-        /* 020B71DC */ _t79 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B71DC */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B71DC */ _t80 = _t79 & 0x00000001u;
         /* 020B71DC */ if (_t80) goto L_020B71E4; else goto L_020B71E0;
   L_020B71E0: ; // 0x20b71e0
@@ -12250,10 +12250,10 @@ void Gambit_fn_020B6F64(CPUState* cpu) {
         /* 020B7264 */ rbrew_write32(cpu->mem, _t94, cpu->r[12]);
         /* 020B7268 */ _t95 = cpu->r[27] + 0x00000014u;
         /* 020B7268 */ cpu->r[5] = rbrew_read32(cpu->mem, _t95);
-        /* 020B726C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x00000002u);
+        /* 020B726C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x00000002u));
         /* 020B7270 */ _t96 = cpu->r[27] + 0x00000018u;
         /* 020B7270 */ cpu->r[24] = rbrew_read32(cpu->mem, _t96);
-        /* 020B7274 */ _t97 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B7274 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B7274 */ _t98 = _t97 & 0x00000001u;
         /* 020B7274 */ if (_t98) goto L_020B7278; else goto L_020B727C;
   L_020B7278: ; // 0x20b7278
@@ -12269,23 +12269,23 @@ void Gambit_fn_020B6F64(CPUState* cpu) {
         /* 020B7290 */ _t101 = cpu->r[11] + 0x00000000u;
         /* 020B7290 */ cpu->r[7] = rbrew_read8(cpu->mem, _t101);
         /* 020B7294 */ cpu->r[31] = 0x00000000u;
-        /* 020B7298 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[30]);
+        /* 020B7298 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[30]));
         /* 020B729C */ cpu->r[0] = 0x00080000u;
-        /* 020B72A0 */ _t102 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B72A0 */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B72A0 */ _t103 = _t102 & 0x00000001u;
         /* 020B72A0 */ if (_t103) goto L_020B72C8; else goto L_020B72A4;
   L_020B72A4: ; // 0x20b72a4
         /* 020B72A4 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020B72A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 020B72A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 020B72AC */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 020B72B0 */ _t104 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B72B0 */ _t104 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B72B0 */ _t105 = _t104 & 0x00000001u;
         /* 020B72B0 */ if (_t105) goto L_020B72C4; else goto L_020B72B4;
   L_020B72B4: ; // 0x20b72b4
         /* 020B72B4 */ _t106 = cpu->r[11] + 0x00000000u;
         /* 020B72B4 */ cpu->r[9] = rbrew_read8(cpu->mem, _t106);
-        /* 020B72B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[30]);
-        /* 020B72BC */ _t107 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B72B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[30]));
+        /* 020B72BC */ _t107 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B72BC */ _t108 = _t107 & 0x00000001u;
         /* 020B72BC */ if (_t108) goto L_020B72C0; else goto L_020B72A4;
   L_020B72C0: ; // 0x20b72c0
@@ -12295,8 +12295,8 @@ void Gambit_fn_020B6F64(CPUState* cpu) {
   L_020B72C8: ; // 0x20b72c8
         /* 020B72C8 */ _t109 = cpu->r[24] + 0x00000008u;
         /* 020B72C8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t109);
-        /* 020B72CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
-        /* 020B72D0 */ _t110 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B72CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
+        /* 020B72D0 */ _t110 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B72D0 */ _t111 = _t110 & 0x00000001u;
         /* 020B72D0 */ if (_t111) goto L_020B72D8; else goto L_020B72D4;
   L_020B72D4: ; // 0x20b72d4
@@ -12355,10 +12355,10 @@ void Gambit_fn_020B6F64(CPUState* cpu) {
         /* 020B7360 */ rbrew_write32(cpu->mem, _t127, cpu->r[6]);
         /* 020B7364 */ _t128 = cpu->r[27] + 0x00000014u;
         /* 020B7364 */ cpu->r[8] = rbrew_read32(cpu->mem, _t128);
-        /* 020B7368 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000003u);
+        /* 020B7368 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000003u));
         /* 020B736C */ _t129 = cpu->r[27] + 0x00000018u;
         /* 020B736C */ cpu->r[31] = rbrew_read32(cpu->mem, _t129);
-        /* 020B7370 */ _t130 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B7370 */ _t130 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B7370 */ _t131 = _t130 & 0x00000001u;
         /* 020B7370 */ if (_t131) goto L_020B7374; else goto L_020B7378;
   L_020B7374: ; // 0x20b7374
@@ -12374,23 +12374,23 @@ void Gambit_fn_020B6F64(CPUState* cpu) {
         /* 020B738C */ _t134 = cpu->r[8] + 0x00000000u;
         /* 020B738C */ cpu->r[0] = rbrew_read8(cpu->mem, _t134);
         /* 020B7390 */ cpu->r[24] = 0x00000000u;
-        /* 020B7394 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
+        /* 020B7394 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
         /* 020B7398 */ cpu->r[9] = 0x00080000u;
-        /* 020B739C */ _t135 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B739C */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B739C */ _t136 = _t135 & 0x00000001u;
         /* 020B739C */ if (_t136) goto L_020B73C4; else goto L_020B73A0;
   L_020B73A0: ; // 0x20b73a0
         /* 020B73A0 */ cpu->r[24] = cpu->r[24] + 0x00000001u;
-        /* 020B73A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], cpu->r[9]);
+        /* 020B73A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], cpu->r[9]));
         /* 020B73A8 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 020B73AC */ _t137 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B73AC */ _t137 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B73AC */ _t138 = _t137 & 0x00000001u;
         /* 020B73AC */ if (_t138) goto L_020B73C0; else goto L_020B73B0;
   L_020B73B0: ; // 0x20b73b0
         /* 020B73B0 */ _t139 = cpu->r[8] + 0x00000000u;
         /* 020B73B0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t139);
-        /* 020B73B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
-        /* 020B73B8 */ _t140 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B73B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
+        /* 020B73B8 */ _t140 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B73B8 */ _t141 = _t140 & 0x00000001u;
         /* 020B73B8 */ if (_t141) goto L_020B73BC; else goto L_020B73A0;
   L_020B73BC: ; // 0x20b73bc
@@ -12402,10 +12402,10 @@ void Gambit_fn_020B6F64(CPUState* cpu) {
         /* 020B73C4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t142);
         /* 020B73C8 */ _t143 = cpu->r[1] + 0x00000010u;
         /* 020B73C8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t143);
-        /* 020B73CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], cpu->r[12]);
+        /* 020B73CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], cpu->r[12]));
         /* 020B73D0 */ _t144 = cpu->r[6] + 0x00000014u;
         /* 020B73D0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t144);
-        /* 020B73D4 */ _t145 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B73D4 */ _t145 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B73D4 */ _t146 = _t145 & 0x00000001u;
         /* 020B73D4 */ if (_t146) goto L_020B73DC; else goto L_020B73D8;
   L_020B73D8: ; // 0x20b73d8
@@ -12460,10 +12460,10 @@ void Gambit_fn_020B6F64(CPUState* cpu) {
         /* 020B745C */ rbrew_write32(cpu->mem, _t160, cpu->r[0]);
         /* 020B7460 */ _t161 = cpu->r[27] + 0x00000014u;
         /* 020B7460 */ cpu->r[10] = rbrew_read32(cpu->mem, _t161);
-        /* 020B7464 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000004u);
+        /* 020B7464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000004u));
         /* 020B7468 */ _t162 = cpu->r[27] + 0x00000018u;
         /* 020B7468 */ cpu->r[26] = rbrew_read32(cpu->mem, _t162);
-        /* 020B746C */ _t163 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B746C */ _t163 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B746C */ _t164 = _t163 & 0x00000001u;
         /* 020B746C */ if (_t164) goto L_020B7470; else goto L_020B7474;
   L_020B7470: ; // 0x20b7470
@@ -12479,23 +12479,23 @@ void Gambit_fn_020B6F64(CPUState* cpu) {
         /* 020B7488 */ _t167 = cpu->r[12] + 0x00000000u;
         /* 020B7488 */ cpu->r[11] = rbrew_read8(cpu->mem, _t167);
         /* 020B748C */ cpu->r[31] = 0x00000000u;
-        /* 020B7490 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[30]);
+        /* 020B7490 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[30]));
         /* 020B7494 */ cpu->r[5] = 0x00080000u;
-        /* 020B7498 */ _t168 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7498 */ _t168 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7498 */ _t169 = _t168 & 0x00000001u;
         /* 020B7498 */ if (_t169) goto L_020B74C0; else goto L_020B749C;
   L_020B749C: ; // 0x20b749c
         /* 020B749C */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020B74A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 020B74A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 020B74A4 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 020B74A8 */ _t170 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B74A8 */ _t170 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B74A8 */ _t171 = _t170 & 0x00000001u;
         /* 020B74A8 */ if (_t171) goto L_020B74BC; else goto L_020B74AC;
   L_020B74AC: ; // 0x20b74ac
         /* 020B74AC */ _t172 = cpu->r[12] + 0x00000000u;
         /* 020B74AC */ cpu->r[10] = rbrew_read8(cpu->mem, _t172);
-        /* 020B74B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[30]);
-        /* 020B74B4 */ _t173 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B74B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[30]));
+        /* 020B74B4 */ _t173 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B74B4 */ _t174 = _t173 & 0x00000001u;
         /* 020B74B4 */ if (_t174) goto L_020B74B8; else goto L_020B749C;
   L_020B74B8: ; // 0x20b74b8
@@ -12507,10 +12507,10 @@ void Gambit_fn_020B6F64(CPUState* cpu) {
         /* 020B74C0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t175);
         /* 020B74C4 */ _t176 = cpu->r[1] + 0x00000010u;
         /* 020B74C4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t176);
-        /* 020B74C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 020B74C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 020B74CC */ _t177 = cpu->r[11] + 0x00000014u;
         /* 020B74CC */ cpu->r[12] = rbrew_read32(cpu->mem, _t177);
-        /* 020B74D0 */ _t178 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B74D0 */ _t178 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B74D0 */ _t179 = _t178 & 0x00000001u;
         /* 020B74D0 */ if (_t179) goto L_020B74D8; else goto L_020B74D4;
   L_020B74D4: ; // 0x20b74d4
@@ -12666,8 +12666,8 @@ void Gambit_fn_020B75C4(CPUState* cpu) {
         /* 020B75DC */ _t3 = cpu->r[3] + 0x00003400u;
         /* 020B75DC */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 020B75E0 */ Gambit_fn_0206C030(cpu);
-        /* 020B75E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B75E8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B75E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B75E8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B75E8 */ _t5 = _t4 & 0x00000001u;
         /* 020B75E8 */ if (_t5) goto L_020B7600; else goto L_020B75EC;
   L_020B75EC: ; // 0x20b75ec
@@ -12711,8 +12711,8 @@ void Gambit_fn_020B75C8(CPUState* cpu) {
         /* 020B75DC */ _t3 = cpu->r[3] + 0x00003400u;
         /* 020B75DC */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 020B75E0 */ Gambit_fn_0206C030(cpu);
-        /* 020B75E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B75E8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B75E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B75E8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B75E8 */ _t5 = _t4 & 0x00000001u;
         /* 020B75E8 */ if (_t5) goto L_020B7600; else goto L_020B75EC;
   L_020B75EC: ; // 0x20b75ec
@@ -13131,8 +13131,8 @@ void Gambit_fn_020B7784(CPUState* cpu) {
         /* 020B779C */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 020B77A0 */ _t5 = cpu->r[31] + 0x00000216u;
         /* 020B77A0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t5);
-        /* 020B77A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B77A8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B77A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B77A8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B77A8 */ _t7 = _t6 & 0x00000001u;
         /* 020B77A8 */ if (_t7) goto L_020B77AC; else goto L_020B7818;
   L_020B77AC: ; // 0x20b77ac
@@ -13204,8 +13204,8 @@ void Gambit_fn_020B7788(CPUState* cpu) {
         /* 020B779C */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 020B77A0 */ _t5 = cpu->r[31] + 0x00000216u;
         /* 020B77A0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t5);
-        /* 020B77A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B77A8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B77A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B77A8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B77A8 */ _t7 = _t6 & 0x00000001u;
         /* 020B77A8 */ if (_t7) goto L_020B77AC; else goto L_020B7818;
   L_020B77AC: ; // 0x20b77ac
@@ -13271,8 +13271,8 @@ void Gambit_fn_020B7834(CPUState* cpu) {
         /* 020B783C */ cpu->r[1] = _t1;
         /* 020B7840 */ _t2 = cpu->r[3] + 0x00000216u;
         /* 020B7840 */ cpu->r[0] = rbrew_read8(cpu->mem, _t2);
-        /* 020B7844 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B7848 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B7848 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7848 */ _t4 = _t3 & 0x00000001u;
         /* 020B7848 */ if (_t4) goto L_020B784C; else goto L_020B7894;
   L_020B784C: ; // 0x20b784c
@@ -13318,8 +13318,8 @@ void Gambit_fn_020B783C(CPUState* cpu) {
         /* 020B783C */ cpu->r[1] = _t0;
         /* 020B7840 */ _t1 = cpu->r[3] + 0x00000216u;
         /* 020B7840 */ cpu->r[0] = rbrew_read8(cpu->mem, _t1);
-        /* 020B7844 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B7848 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B7848 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7848 */ _t3 = _t2 & 0x00000001u;
         /* 020B7848 */ if (_t3) goto L_020B784C; else goto L_020B7894;
   L_020B784C: ; // 0x20b784c
@@ -13369,8 +13369,8 @@ void Gambit_fn_020B78A4(CPUState* cpu) {
         /* 020B78B0 */ cpu->r[1] = _t1;
         /* 020B78B4 */ _t2 = cpu->r[10] + 0x00000216u;
         /* 020B78B4 */ cpu->r[11] = rbrew_read8(cpu->mem, _t2);
-        /* 020B78B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020B78BC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B78B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020B78BC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B78BC */ _t4 = _t3 & 0x00000001u;
         /* 020B78BC */ if (_t4) goto L_020B78D8; else goto L_020B78C0;
   L_020B78C0: ; // 0x20b78c0
@@ -13417,8 +13417,8 @@ void Gambit_fn_020B78B0(CPUState* cpu) {
         /* 020B78B0 */ cpu->r[1] = _t0;
         /* 020B78B4 */ _t1 = cpu->r[10] + 0x00000216u;
         /* 020B78B4 */ cpu->r[11] = rbrew_read8(cpu->mem, _t1);
-        /* 020B78B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020B78BC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B78B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020B78BC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B78BC */ _t3 = _t2 & 0x00000001u;
         /* 020B78BC */ if (_t3) goto L_020B78D8; else goto L_020B78C0;
   L_020B78C0: ; // 0x20b78c0
@@ -13469,8 +13469,8 @@ void Gambit_fn_020B7920(CPUState* cpu) {
         /* 020B792C */ cpu->r[1] = _t1;
         /* 020B7930 */ _t2 = cpu->r[10] + 0x00000216u;
         /* 020B7930 */ cpu->r[11] = rbrew_read8(cpu->mem, _t2);
-        /* 020B7934 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020B7938 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020B7938 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7938 */ _t4 = _t3 & 0x00000001u;
         /* 020B7938 */ if (_t4) goto L_020B7954; else goto L_020B793C;
   L_020B793C: ; // 0x20b793c
@@ -13517,8 +13517,8 @@ void Gambit_fn_020B792C(CPUState* cpu) {
         /* 020B792C */ cpu->r[1] = _t0;
         /* 020B7930 */ _t1 = cpu->r[10] + 0x00000216u;
         /* 020B7930 */ cpu->r[11] = rbrew_read8(cpu->mem, _t1);
-        /* 020B7934 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020B7938 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020B7938 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7938 */ _t3 = _t2 & 0x00000001u;
         /* 020B7938 */ if (_t3) goto L_020B7954; else goto L_020B793C;
   L_020B793C: ; // 0x20b793c
@@ -13569,8 +13569,8 @@ void Gambit_fn_020B799C(CPUState* cpu) {
         /* 020B79A8 */ cpu->r[1] = _t1;
         /* 020B79AC */ _t2 = cpu->r[10] + 0x00000216u;
         /* 020B79AC */ cpu->r[12] = rbrew_read8(cpu->mem, _t2);
-        /* 020B79B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020B79B4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B79B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020B79B4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B79B4 */ _t4 = _t3 & 0x00000001u;
         /* 020B79B4 */ if (_t4) goto L_020B79B8; else goto L_020B79E8;
   L_020B79B8: ; // 0x20b79b8
@@ -13606,8 +13606,8 @@ void Gambit_fn_020B79A8(CPUState* cpu) {
         /* 020B79A8 */ cpu->r[1] = _t0;
         /* 020B79AC */ _t1 = cpu->r[10] + 0x00000216u;
         /* 020B79AC */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 020B79B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020B79B4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B79B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020B79B4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B79B4 */ _t3 = _t2 & 0x00000001u;
         /* 020B79B4 */ if (_t3) goto L_020B79B8; else goto L_020B79E8;
   L_020B79B8: ; // 0x20b79b8
@@ -13733,9 +13733,9 @@ void Gambit_fn_020B7A50(CPUState* cpu) {
         /* 020B7A70 */ cpu->r[9] = _t4;
         /* 020B7A74 */ cpu->r[31] = cpu->r[3];
         /* 020B7A78 */ cpu->r[4] = 0x101D0000u;
-        /* 020B7A7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020B7A7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020B7A80 */ cpu->r[4] = cpu->r[4] + 0xFFFFED90u;
-        /* 020B7A84 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7A84 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7A84 */ _t6 = _t5 & 0x00000001u;
         /* 020B7A84 */ if (_t6) goto L_020B7A88; else goto L_020B7A9C;
   L_020B7A88: ; // 0x20b7a88
@@ -13747,8 +13747,8 @@ void Gambit_fn_020B7A50(CPUState* cpu) {
         /* 020B7A98 */ _t8 = cpu->r[4] + 0x00000000u;
         /* 020B7A98 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
   L_020B7A9C: ; // 0x20b7a9c
-        /* 020B7A9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020B7AA0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7A9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020B7AA0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7AA0 */ _t10 = _t9 & 0x00000001u;
         /* 020B7AA0 */ if (_t10) goto L_020B7AC0; else goto L_020B7AA4;
   L_020B7AA4: ; // 0x20b7aa4
@@ -13759,8 +13759,8 @@ void Gambit_fn_020B7A50(CPUState* cpu) {
         /* 020B7AAC */ cpu->ctr = cpu->r[7];
         /* 020B7AB0 */ cpu->r[3] = cpu->r[31];
         /* 020B7AB4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020B7AB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B7ABC */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7AB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B7ABC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7ABC */ _t14 = _t13 & 0x00000001u;
         /* 020B7ABC */ if (_t14) goto L_020B7AC0; else goto L_020B7AC4;
   L_020B7AC0: ; // 0x20b7ac0
@@ -13801,9 +13801,9 @@ void Gambit_fn_020B7A54(CPUState* cpu) {
         /* 020B7A70 */ cpu->r[9] = _t4;
         /* 020B7A74 */ cpu->r[31] = cpu->r[3];
         /* 020B7A78 */ cpu->r[4] = 0x101D0000u;
-        /* 020B7A7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020B7A7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020B7A80 */ cpu->r[4] = cpu->r[4] + 0xFFFFED90u;
-        /* 020B7A84 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7A84 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7A84 */ _t6 = _t5 & 0x00000001u;
         /* 020B7A84 */ if (_t6) goto L_020B7A88; else goto L_020B7A9C;
   L_020B7A88: ; // 0x20b7a88
@@ -13815,8 +13815,8 @@ void Gambit_fn_020B7A54(CPUState* cpu) {
         /* 020B7A98 */ _t8 = cpu->r[4] + 0x00000000u;
         /* 020B7A98 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
   L_020B7A9C: ; // 0x20b7a9c
-        /* 020B7A9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020B7AA0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7A9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020B7AA0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7AA0 */ _t10 = _t9 & 0x00000001u;
         /* 020B7AA0 */ if (_t10) goto L_020B7AC0; else goto L_020B7AA4;
   L_020B7AA4: ; // 0x20b7aa4
@@ -13827,8 +13827,8 @@ void Gambit_fn_020B7A54(CPUState* cpu) {
         /* 020B7AAC */ cpu->ctr = cpu->r[7];
         /* 020B7AB0 */ cpu->r[3] = cpu->r[31];
         /* 020B7AB4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020B7AB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B7ABC */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7AB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B7ABC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7ABC */ _t14 = _t13 & 0x00000001u;
         /* 020B7ABC */ if (_t14) goto L_020B7AC0; else goto L_020B7AC4;
   L_020B7AC0: ; // 0x20b7ac0
@@ -13862,8 +13862,8 @@ void Gambit_fn_020B7AE4(CPUState* cpu) {
         /* 020B7AF0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020B7AF4 */ _t3 = cpu->r[31] + 0x000001E4u;
         /* 020B7AF4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 020B7AF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B7AFC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7AF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B7AFC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7AFC */ _t5 = _t4 & 0x00000001u;
         /* 020B7AFC */ if (_t5) goto L_020B7B00; else goto L_020B7B3C;
   L_020B7B00: ; // 0x20b7b00
@@ -13898,16 +13898,16 @@ void Gambit_fn_020B7AE4(CPUState* cpu) {
         /* 020B7B4C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020B7B50 */ _t14 = cpu->r[31] + 0x00000216u;
         /* 020B7B50 */ cpu->r[0] = rbrew_read8(cpu->mem, _t14);
-        /* 020B7B54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B7B58 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7B54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B7B58 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7B58 */ _t16 = _t15 & 0x00000001u;
         /* 020B7B58 */ if (_t16) goto L_020B7B70; else goto L_020B7B5C;
   L_020B7B5C: ; // 0x20b7b5c
         /* 020B7B5C */ _t17 = cpu->r[31] + 0x00000218u;
         /* 020B7B5C */ cpu->r[3] = rbrew_read32(cpu->mem, _t17);
         /* 020B7B60 */ Gambit_fn_020D0A1C(cpu);
-        /* 020B7B64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B7B68 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7B64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B7B68 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7B68 */ _t19 = _t18 & 0x00000001u;
         /* 020B7B68 */ if (_t19) goto L_020B7BA0; else goto L_020B7B6C;
   L_020B7B6C: ; // 0x20b7b6c
@@ -13918,8 +13918,8 @@ void Gambit_fn_020B7AE4(CPUState* cpu) {
         /* 020B7B78 */ cpu->r[4] = cpu->r[3];
         /* 020B7B7C */ cpu->r[3] = cpu->r[31];
         /* 020B7B80 */ Gambit_fn_027EDF00(cpu);
-        /* 020B7B84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B7B88 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7B84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B7B88 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7B88 */ _t21 = _t20 & 0x00000001u;
         /* 020B7B88 */ if (_t21) goto L_020B7BA0; else goto L_020B7B8C;
   L_020B7B8C: ; // 0x20b7b8c
@@ -13956,8 +13956,8 @@ void Gambit_fn_020B7BB8(CPUState* cpu) {
         /* 020B7BCC */ cpu->r[4] = cpu->r[3];
         /* 020B7BD0 */ cpu->r[3] = cpu->r[31];
         /* 020B7BD4 */ Gambit_fn_027EDF00(cpu);
-        /* 020B7BD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B7BDC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7BD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B7BDC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7BDC */ _t4 = _t3 & 0x00000001u;
         /* 020B7BDC */ if (_t4) goto L_020B7BF4; else goto L_020B7BE0;
   L_020B7BE0: ; // 0x20b7be0
@@ -13992,8 +13992,8 @@ void Gambit_fn_020B7C0C(CPUState* cpu) {
         /* 020B7C18 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020B7C1C */ _t3 = cpu->r[31] + 0x000001E4u;
         /* 020B7C1C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 020B7C20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B7C24 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7C20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B7C24 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7C24 */ _t5 = _t4 & 0x00000001u;
         /* 020B7C24 */ if (_t5) goto L_020B7C28; else goto L_020B7C3C;
   L_020B7C28: ; // 0x20b7c28
@@ -14014,15 +14014,15 @@ void Gambit_fn_020B7C0C(CPUState* cpu) {
         /* 020B7C4C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020B7C50 */ _t10 = cpu->r[31] + 0x00000214u;
         /* 020B7C50 */ cpu->r[12] = rbrew_read8(cpu->mem, _t10);
-        /* 020B7C54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020B7C58 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7C54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020B7C58 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7C58 */ _t12 = _t11 & 0x00000001u;
         /* 020B7C58 */ if (_t12) goto L_020B7C5C; else goto L_020B7C68;
   L_020B7C5C: ; // 0x20b7c5c
         /* 020B7C5C */ _t13 = cpu->r[31] + 0x00000215u;
         /* 020B7C5C */ cpu->r[0] = rbrew_read8(cpu->mem, _t13);
-        /* 020B7C60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B7C64 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7C60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B7C64 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7C64 */ _t15 = _t14 & 0x00000001u;
         /* 020B7C64 */ if (_t15) goto L_020B7C7C; else goto L_020B7C68;
   L_020B7C68: ; // 0x20b7c68
@@ -14057,8 +14057,8 @@ void Gambit_fn_020B7C94(CPUState* cpu) {
         /* 020B7CA0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020B7CA4 */ _t3 = cpu->r[31] + 0x000001E4u;
         /* 020B7CA4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 020B7CA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020B7CAC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7CA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020B7CAC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7CAC */ _t5 = _t4 & 0x00000001u;
         /* 020B7CAC */ if (_t5) goto L_020B7CB0; else goto L_020B7CD8;
   L_020B7CB0: ; // 0x20b7cb0
@@ -14079,8 +14079,8 @@ void Gambit_fn_020B7C94(CPUState* cpu) {
   L_020B7CD8: ; // 0x20b7cd8
         /* 020B7CD8 */ _t10 = cpu->r[31] + 0x00000216u;
         /* 020B7CD8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t10);
-        /* 020B7CDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B7CE0 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7CDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B7CE0 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7CE0 */ _t12 = _t11 & 0x00000001u;
         /* 020B7CE0 */ if (_t12) goto L_020B7D00; else goto L_020B7CE4;
   L_020B7CE4: ; // 0x20b7ce4
@@ -14091,8 +14091,8 @@ void Gambit_fn_020B7C94(CPUState* cpu) {
         /* 020B7CEC */ cpu->r[11] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
         /* 020B7CF0 */ cpu->r[0] = cpu->r[11] + 0xFFFFFFFFu;
         /* 020B7CF4 */ cpu->r[3] = cpu->r[11] - cpu->r[0];
-        /* 020B7CF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B7CF8 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7CF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B7CF8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7CF8 */ _t16 = _t15 & 0x00000001u;
         /* 020B7CF8 */ if (_t16) goto L_020B7D7C; else goto L_020B7CFC;
   L_020B7CFC: ; // 0x20b7cfc
@@ -14103,15 +14103,15 @@ void Gambit_fn_020B7C94(CPUState* cpu) {
         /* 020B7D08 */ cpu->r[4] = cpu->r[3];
         /* 020B7D0C */ cpu->r[3] = cpu->r[31];
         /* 020B7D10 */ Gambit_fn_027EDF00(cpu);
-        /* 020B7D14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B7D18 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7D14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B7D18 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7D18 */ _t18 = _t17 & 0x00000001u;
         /* 020B7D18 */ if (_t18) goto L_020B7D7C; else goto L_020B7D1C;
   L_020B7D1C: ; // 0x20b7d1c
         /* 020B7D1C */ _t19 = cpu->r[31] + 0x00000215u;
         /* 020B7D1C */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
-        /* 020B7D20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020B7D24 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7D20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020B7D24 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7D24 */ _t21 = _t20 & 0x00000001u;
         /* 020B7D24 */ if (_t21) goto L_020B7D68; else goto L_020B7D28;
   L_020B7D28: ; // 0x20b7d28
@@ -14160,15 +14160,15 @@ void Gambit_fn_020B7D90(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B7D90: ; // 0x20b7d90
-        /* 020B7D90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B7D94 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7D90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B7D94 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7D94 */ _t1 = _t0 & 0x00000001u;
         /* 020B7D94 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B7D94 */ goto L_020B7D98;
   L_020B7D98: ; // 0x20b7d98
         /* 020B7D98 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B7D98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B7D9C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7D98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B7D9C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7D9C */ _t3 = _t2 & 0x00000001u;
         /* 020B7D9C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B7D9C */ goto L_020B7DA0;
@@ -14187,8 +14187,8 @@ void Gambit_fn_020B7D90(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -14202,15 +14202,15 @@ void Gambit_fn_020B7D90(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -14247,11 +14247,11 @@ void Gambit_fn_020B7DA4(CPUState* cpu) {
         /* 020B7DB0 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020B7DB0 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020B7DB4 */ cpu->r[30] = cpu->r[3];
-        /* 020B7DB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020B7DB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020B7DB8 */ cpu->r[31] = cpu->r[4];
         /* 020B7DBC */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020B7DBC */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020B7DC0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7DC0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7DC0 */ _t5 = _t4 & 0x00000001u;
         /* 020B7DC0 */ if (_t5) goto L_020B7E04; else goto L_020B7DC4;
   L_020B7DC4: ; // 0x20b7dc4
@@ -14271,8 +14271,8 @@ void Gambit_fn_020B7DA4(CPUState* cpu) {
         /* 020B7DEC */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020B7DF0 */ Gambit_fn_02068798(cpu);
         /* 020B7DF4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B7DF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B7DF8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7DF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B7DF8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7DF8 */ _t10 = _t9 & 0x00000001u;
         /* 020B7DF8 */ if (_t10) goto L_020B7E04; else goto L_020B7DFC;
   L_020B7DFC: ; // 0x20b7dfc
@@ -14303,11 +14303,11 @@ void Gambit_fn_020B7DA8(CPUState* cpu) {
         /* 020B7DB0 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020B7DB0 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020B7DB4 */ cpu->r[30] = cpu->r[3];
-        /* 020B7DB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020B7DB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020B7DB8 */ cpu->r[31] = cpu->r[4];
         /* 020B7DBC */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020B7DBC */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020B7DC0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7DC0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7DC0 */ _t5 = _t4 & 0x00000001u;
         /* 020B7DC0 */ if (_t5) goto L_020B7E04; else goto L_020B7DC4;
   L_020B7DC4: ; // 0x20b7dc4
@@ -14327,8 +14327,8 @@ void Gambit_fn_020B7DA8(CPUState* cpu) {
         /* 020B7DEC */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020B7DF0 */ Gambit_fn_02068798(cpu);
         /* 020B7DF4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B7DF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B7DF8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7DF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B7DF8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7DF8 */ _t10 = _t9 & 0x00000001u;
         /* 020B7DF8 */ if (_t10) goto L_020B7E04; else goto L_020B7DFC;
   L_020B7DFC: ; // 0x20b7dfc
@@ -14383,15 +14383,15 @@ void Gambit_fn_020B7E34(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B7E34: ; // 0x20b7e34
-        /* 020B7E34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B7E38 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7E34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B7E38 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7E38 */ _t1 = _t0 & 0x00000001u;
         /* 020B7E38 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B7E38 */ goto L_020B7E3C;
   L_020B7E3C: ; // 0x20b7e3c
         /* 020B7E3C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B7E3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B7E40 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7E3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B7E40 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7E40 */ _t3 = _t2 & 0x00000001u;
         /* 020B7E40 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B7E40 */ goto L_020B7E44;
@@ -14410,8 +14410,8 @@ void Gambit_fn_020B7E34(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -14425,15 +14425,15 @@ void Gambit_fn_020B7E34(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -14479,15 +14479,15 @@ void Gambit_fn_020B7E64(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B7E64: ; // 0x20b7e64
-        /* 020B7E64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B7E68 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7E64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B7E68 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7E68 */ _t1 = _t0 & 0x00000001u;
         /* 020B7E68 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B7E68 */ goto L_020B7E6C;
   L_020B7E6C: ; // 0x20b7e6c
         /* 020B7E6C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B7E6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B7E70 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7E6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B7E70 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7E70 */ _t3 = _t2 & 0x00000001u;
         /* 020B7E70 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B7E70 */ goto L_020B7E74;
@@ -14506,8 +14506,8 @@ void Gambit_fn_020B7E64(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -14521,15 +14521,15 @@ void Gambit_fn_020B7E64(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -14557,15 +14557,15 @@ void Gambit_fn_020B7E78(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B7E78: ; // 0x20b7e78
-        /* 020B7E78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B7E7C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7E78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B7E7C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7E7C */ _t1 = _t0 & 0x00000001u;
         /* 020B7E7C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B7E7C */ goto L_020B7E80;
   L_020B7E80: ; // 0x20b7e80
         /* 020B7E80 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B7E80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B7E84 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7E80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B7E84 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7E84 */ _t3 = _t2 & 0x00000001u;
         /* 020B7E84 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B7E84 */ goto L_020B7E88;
@@ -14584,8 +14584,8 @@ void Gambit_fn_020B7E78(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -14599,15 +14599,15 @@ void Gambit_fn_020B7E78(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -14676,9 +14676,9 @@ void Gambit_fn_020B7EB0(CPUState* cpu) {
         /* 020B7EB4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 020B7EB4 */ cpu->r[9] = _t0;
         /* 020B7EB8 */ cpu->r[12] = 0x101D0000u;
-        /* 020B7EBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 020B7EBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 020B7EC0 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 020B7EC4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7EC4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7EC4 */ _t2 = _t1 & 0x00000001u;
         /* 020B7EC4 */ if (_t2) goto L_020B7EC8; else goto L_020B7EDC;
   L_020B7EC8: ; // 0x20b7ec8
@@ -14690,8 +14690,8 @@ void Gambit_fn_020B7EB0(CPUState* cpu) {
         /* 020B7ED8 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 020B7ED8 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_020B7EDC: ; // 0x20b7edc
-        /* 020B7EDC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 020B7EE0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7EDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 020B7EE0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7EE0 */ _t6 = _t5 & 0x00000001u;
         /* 020B7EE0 */ if (_t6) goto L_020B7EE4; else goto L_020B7EEC;
   L_020B7EE4: ; // 0x20b7ee4
@@ -14703,9 +14703,9 @@ void Gambit_fn_020B7EB0(CPUState* cpu) {
         /* 020B7EF0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 020B7EF0 */ cpu->r[7] = _t7;
         /* 020B7EF4 */ cpu->r[11] = 0x101D0000u;
-        /* 020B7EF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020B7EF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020B7EFC */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 020B7F00 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7F00 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7F00 */ _t9 = _t8 & 0x00000001u;
         /* 020B7F00 */ if (_t9) goto L_020B7F04; else goto L_020B7F18;
   L_020B7F04: ; // 0x20b7f04
@@ -14838,18 +14838,18 @@ void Gambit_fn_020B7F70(CPUState* cpu) {
         /* 02008980 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02008980 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02008984 */ cpu->r[12] = 0x00000000u;
-        /* 02008988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02008988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0200898C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0200898C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02008990 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02008990 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02008990 */ _t6 = _t5 & 0x00000001u;
         /* 02008990 */ if (_t6) goto L_020089B8; else goto L_02008994;
   L_02008994: ; // 0x2008994
         /* 02008994 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02008994 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02008998 */ /* nop */
-        /* 0200899C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 020089A0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0200899C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 020089A0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020089A0 */ _t9 = _t8 & 0x00000001u;
         /* 020089A0 */ if (_t9) goto L_020089A4; else goto L_020089B8;
   L_020089A4: ; // 0x20089a4
@@ -14934,10 +14934,10 @@ void Gambit_fn_020B7F98(CPUState* cpu) {
         /* 020B7FB8 */ cpu->r[31] = 0x101D0000u;
         /* 020B7FBC */ _t3 = cpu->r[28] + 0x0000001Cu;
         /* 020B7FBC */ rbrew_write32(cpu->mem, _t3, cpu->r[4]);
-        /* 020B7FC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B7FC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B7FC4 */ _t4 = cpu->r[28] + 0x0000000Fu;
         /* 020B7FC4 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[27]);
-        /* 020B7FC8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7FC8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B7FC8 */ _t6 = _t5 & 0x00000001u;
         /* 020B7FC8 */ if (_t6) goto L_020B800C; else goto L_020B7FCC;
   L_020B7FCC: ; // 0x20b7fcc
@@ -14952,16 +14952,16 @@ void Gambit_fn_020B7F98(CPUState* cpu) {
         /* 020B7FE0 */ cpu->r[5] = 0x00000004u;
         /* 020B7FE4 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020B7FE8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020B7FEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B7FEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B7FF0 */ cpu->r[0] = cpu->r[27];
-        /* 020B7FF4 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B7FF4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B7FF4 */ _t11 = _t10 & 0x00000001u;
         /* 020B7FF4 */ if (_t11) goto L_020B7FFC; else goto L_020B7FF8;
   L_020B7FF8: ; // 0x20b7ff8
         /* 020B7FF8 */ cpu->r[0] = 0x00000001u;
   L_020B7FFC: ; // 0x20b7ffc
-        /* 020B7FFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B8000 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B7FFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B8000 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8000 */ _t13 = _t12 & 0x00000001u;
         /* 020B8000 */ if (_t13) goto L_020B800C; else goto L_020B8004;
   L_020B8004: ; // 0x20b8004
@@ -14973,9 +14973,9 @@ void Gambit_fn_020B7F98(CPUState* cpu) {
         /* 020B800C */ _t16 = cpu->r[28] + 0x00000020u;
         /* 020B800C */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 020B8010 */ cpu->r[0] = 0x00000000u;
-        /* 020B8014 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 020B8014 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 020B8018 */ cpu->r[12] = cpu->r[0];
-        /* 020B801C */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B801C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B801C */ _t18 = _t17 & 0x00000001u;
         /* 020B801C */ if (_t18) goto L_020B8020; else goto L_020B8044;
   L_020B8020: ; // 0x20b8020
@@ -15000,8 +15000,8 @@ void Gambit_fn_020B7F98(CPUState* cpu) {
   L_020B8044: ; // 0x20b8044
         /* 020B8044 */ _t26 = cpu->r[28] + 0x0000000Fu;
         /* 020B8044 */ cpu->r[27] = rbrew_read8(cpu->mem, _t26);
-        /* 020B8048 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020B804C */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8048 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020B804C */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B804C */ _t28 = _t27 & 0x00000001u;
         /* 020B804C */ if (_t28) goto L_020B8090; else goto L_020B8050;
   L_020B8050: ; // 0x20b8050
@@ -15016,16 +15016,16 @@ void Gambit_fn_020B7F98(CPUState* cpu) {
         /* 020B8064 */ cpu->r[5] = 0x00000004u;
         /* 020B8068 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020B806C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020B8070 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B8070 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B8074 */ cpu->r[11] = cpu->r[27];
-        /* 020B8078 */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B8078 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B8078 */ _t33 = _t32 & 0x00000001u;
         /* 020B8078 */ if (_t33) goto L_020B8080; else goto L_020B807C;
   L_020B807C: ; // 0x20b807c
         /* 020B807C */ cpu->r[11] = 0x00000001u;
   L_020B8080: ; // 0x20b8080
-        /* 020B8080 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B8084 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8080 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B8084 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8084 */ _t35 = _t34 & 0x00000001u;
         /* 020B8084 */ if (_t35) goto L_020B8090; else goto L_020B8088;
   L_020B8088: ; // 0x20b8088
@@ -15037,9 +15037,9 @@ void Gambit_fn_020B7F98(CPUState* cpu) {
         /* 020B8090 */ _t38 = cpu->r[28] + 0x00000028u;
         /* 020B8090 */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 020B8094 */ cpu->r[0] = 0x00000000u;
-        /* 020B8098 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 020B8098 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 020B809C */ cpu->r[12] = cpu->r[0];
-        /* 020B80A0 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B80A0 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B80A0 */ _t40 = _t39 & 0x00000001u;
         /* 020B80A0 */ if (_t40) goto L_020B80A4; else goto L_020B80C8;
   L_020B80A4: ; // 0x20b80a4
@@ -15064,8 +15064,8 @@ void Gambit_fn_020B7F98(CPUState* cpu) {
   L_020B80C8: ; // 0x20b80c8
         /* 020B80C8 */ _t48 = cpu->r[28] + 0x0000000Fu;
         /* 020B80C8 */ cpu->r[27] = rbrew_read8(cpu->mem, _t48);
-        /* 020B80CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020B80D0 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B80CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020B80D0 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B80D0 */ _t50 = _t49 & 0x00000001u;
         /* 020B80D0 */ if (_t50) goto L_020B8114; else goto L_020B80D4;
   L_020B80D4: ; // 0x20b80d4
@@ -15080,16 +15080,16 @@ void Gambit_fn_020B7F98(CPUState* cpu) {
         /* 020B80E8 */ cpu->r[5] = 0x00000004u;
         /* 020B80EC */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020B80F0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020B80F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B80F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B80F8 */ cpu->r[10] = cpu->r[27];
-        /* 020B80FC */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B80FC */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B80FC */ _t55 = _t54 & 0x00000001u;
         /* 020B80FC */ if (_t55) goto L_020B8104; else goto L_020B8100;
   L_020B8100: ; // 0x20b8100
         /* 020B8100 */ cpu->r[10] = 0x00000001u;
   L_020B8104: ; // 0x20b8104
-        /* 020B8104 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B8108 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8104 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B8108 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8108 */ _t57 = _t56 & 0x00000001u;
         /* 020B8108 */ if (_t57) goto L_020B8114; else goto L_020B810C;
   L_020B810C: ; // 0x20b810c
@@ -15101,9 +15101,9 @@ void Gambit_fn_020B7F98(CPUState* cpu) {
         /* 020B8114 */ _t60 = cpu->r[28] + 0x00000030u;
         /* 020B8114 */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
         /* 020B8118 */ cpu->r[0] = 0x00000000u;
-        /* 020B811C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 020B811C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 020B8120 */ cpu->r[5] = cpu->r[0];
-        /* 020B8124 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B8124 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B8124 */ _t62 = _t61 & 0x00000001u;
         /* 020B8124 */ if (_t62) goto L_020B8128; else goto L_020B814C;
   L_020B8128: ; // 0x20b8128
@@ -15128,8 +15128,8 @@ void Gambit_fn_020B7F98(CPUState* cpu) {
   L_020B814C: ; // 0x20b814c
         /* 020B814C */ _t70 = cpu->r[30] + 0x00000000u;
         /* 020B814C */ cpu->r[25] = rbrew_read8(cpu->mem, _t70);
-        /* 020B8150 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 020B8154 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8150 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 020B8154 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8154 */ _t72 = _t71 & 0x00000001u;
         /* 020B8154 */ if (_t72) goto L_020B8230; else goto L_020B8158;
   L_020B8158: ; // 0x20b8158
@@ -15145,10 +15145,10 @@ void Gambit_fn_020B7F98(CPUState* cpu) {
         /* 020B8170 */ cpu->r[4] = (uint32_t)((int32_t)cpu->r[25] * (int32_t)0x00000024u);
         /* 020B8174 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020B8178 */ cpu->r[24] = cpu->r[3];
-        /* 020B817C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 020B817C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 020B8180 */ cpu->r[30] = cpu->r[25];
         /* 020B8184 */ cpu->r[7] = 0x00000000u;
-        /* 020B8188 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B8188 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B8188 */ _t77 = _t76 & 0x00000001u;
         /* 020B8188 */ if (_t77) goto L_020B8190; else goto L_020B818C;
   L_020B818C: ; // 0x20b818c
@@ -15161,36 +15161,36 @@ void Gambit_fn_020B7F98(CPUState* cpu) {
         /* 020B819C */ cpu->r[23] = 0x00000018u;
   L_020B81A0: ; // 0x20b81a0
         /* 020B81A0 */ cpu->r[27] = cpu->r[24] + cpu->r[22];
-        /* 020B81A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020B81A4 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B81A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020B81A4 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B81A4 */ _t80 = _t79 & 0x00000001u;
         /* 020B81A4 */ if (_t80) goto L_020B8214; else goto L_020B81A8;
   L_020B81A8: ; // 0x20b81a8
         /* 020B81A8 */ cpu->r[26] = cpu->r[27];
-        /* 020B81A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 020B81AC */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B81A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 020B81AC */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B81AC */ _t82 = _t81 & 0x00000001u;
         /* 020B81AC */ if (_t82) goto L_020B81B0; else goto L_020B81C0;
   L_020B81B0: ; // 0x20b81b0
         /* 020B81B0 */ cpu->r[3] = 0x00000024u;
         /* 020B81B4 */ Gambit_fn_02801A78(cpu);
         /* 020B81B8 */ cpu->r[26] = cpu->r[3];
-        /* 020B81B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 020B81BC */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B81B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 020B81BC */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B81BC */ _t84 = _t83 & 0x00000001u;
         /* 020B81BC */ if (_t84) goto L_020B8208; else goto L_020B81C0;
   L_020B81C0: ; // 0x20b81c0
         /* 020B81C0 */ cpu->r[11] = cpu->r[26];
-        /* 020B81C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020B81C4 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B81C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020B81C4 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B81C4 */ _t86 = _t85 & 0x00000001u;
         /* 020B81C4 */ if (_t86) goto L_020B81C8; else goto L_020B81D8;
   L_020B81C8: ; // 0x20b81c8
         /* 020B81C8 */ cpu->r[3] = 0x0000000Cu;
         /* 020B81CC */ Gambit_fn_02801A78(cpu);
         /* 020B81D0 */ cpu->r[11] = cpu->r[3];
-        /* 020B81D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020B81D4 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B81D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020B81D4 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B81D4 */ _t88 = _t87 & 0x00000001u;
         /* 020B81D4 */ if (_t88) goto L_020B81F4; else goto L_020B81D8;
   L_020B81D8: ; // 0x20b81d8
@@ -15221,14 +15221,14 @@ void Gambit_fn_020B7F98(CPUState* cpu) {
         /* 020B8210 */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
   L_020B8214: ; // 0x20b8214
         /* 020B8214 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 020B8214 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020B8214 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020B8218 */ cpu->r[22] = cpu->r[22] + 0x00000024u;
-        /* 020B821C */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B821C */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B821C */ _t98 = _t97 & 0x00000001u;
         /* 020B821C */ if (_t98) goto L_020B8220; else goto L_020B81A0;
   L_020B8220: ; // 0x20b8220
-        /* 020B8220 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 020B8224 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8220 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 020B8224 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8224 */ _t100 = _t99 & 0x00000001u;
         /* 020B8224 */ if (_t100) goto L_020B8230; else goto L_020B8228;
   L_020B8228: ; // 0x20b8228
@@ -15258,10 +15258,10 @@ void Gambit_fn_020B8248(CPUState* cpu) {
         /* 020B824C */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 020B8250 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 020B8250 */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 020B8254 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[12]);
+        /* 020B8254 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[12]));
         /* 020B8258 */ _t3 = cpu->r[4] + 0x00000000u;
         /* 020B8258 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 020B825C */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B825C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B825C */ _t5 = _t4 & 0x00000001u;
         /* 020B825C */ if (_t5) goto L_020B8260; else goto L_020B8268;
   L_020B8260: ; // 0x20b8260
@@ -15278,10 +15278,10 @@ void Gambit_fn_020B8248(CPUState* cpu) {
         /* 020B8274 */ cpu->r[9] = rbrew_read8(cpu->mem, _t9);
         /* 020B8278 */ _t10 = cpu->r[3] + 0x00000028u;
         /* 020B8278 */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 020B827C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
+        /* 020B827C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
         /* 020B8280 */ _t11 = cpu->r[3] + 0x0000002Cu;
         /* 020B8280 */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
-        /* 020B8284 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B8284 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B8284 */ _t13 = _t12 & 0x00000001u;
         /* 020B8284 */ if (_t13) goto L_020B8288; else goto L_020B8290;
   L_020B8288: ; // 0x20b8288
@@ -15302,10 +15302,10 @@ void Gambit_fn_020B8248(CPUState* cpu) {
         /* 020B82A4 */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
         /* 020B82A8 */ _t20 = cpu->r[3] + 0x00000034u;
         /* 020B82A8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 020B82AC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
+        /* 020B82AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
         /* 020B82B0 */ _t21 = cpu->r[6] + 0x00000000u;
         /* 020B82B0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
-        /* 020B82B4 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B82B4 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B82B4 */ _t23 = _t22 & 0x00000001u;
         /* 020B82B4 */ if (_t23) goto L_020B82B8; else goto L_020B82C0;
   L_020B82B8: ; // 0x20b82b8
@@ -15338,11 +15338,11 @@ void Gambit_fn_020B82D0(CPUState* cpu) {
         /* 020B87F8 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020B87F8 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020B87FC */ cpu->r[30] = cpu->r[3];
-        /* 020B87FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020B87FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020B8800 */ cpu->r[31] = cpu->r[4];
         /* 020B8804 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020B8804 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020B8808 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8808 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8808 */ _t5 = _t4 & 0x00000001u;
         /* 020B8808 */ if (_t5) goto L_020B884C; else goto L_020B880C;
   L_020B880C: ; // 0x20b880c
@@ -15362,8 +15362,8 @@ void Gambit_fn_020B82D0(CPUState* cpu) {
         /* 020B8834 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020B8838 */ Gambit_fn_02068798(cpu);
         /* 020B883C */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B883C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B8840 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B883C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B8840 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8840 */ _t10 = _t9 & 0x00000001u;
         /* 020B8840 */ if (_t10) goto L_020B884C; else goto L_020B8844;
   L_020B8844: ; // 0x20b8844
@@ -15391,8 +15391,8 @@ void Gambit_fn_020B82D8(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -15444,18 +15444,18 @@ void Gambit_fn_020B82F0(CPUState* cpu) {
         /* 020B82F8 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020B82FC */ /* nop */
         /* 020B8300 */ cpu->r[29] = cpu->r[3];
-        /* 020B8300 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020B8300 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020B8304 */ cpu->r[30] = cpu->r[4];
         /* 020B8308 */ cpu->r[31] = cpu->r[5];
-        /* 020B830C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B830C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B830C */ _t3 = _t2 & 0x00000001u;
         /* 020B830C */ if (_t3) goto L_020B8310; else goto L_020B8320;
   L_020B8310: ; // 0x20b8310
         /* 020B8310 */ cpu->r[3] = 0x00000224u;
         /* 020B8314 */ Gambit_fn_02801A78(cpu);
         /* 020B8318 */ cpu->r[29] = cpu->r[3];
-        /* 020B8318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020B831C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020B831C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B831C */ _t5 = _t4 & 0x00000001u;
         /* 020B831C */ if (_t5) goto L_020B85F8; else goto L_020B8320;
   L_020B8320: ; // 0x20b8320
@@ -15482,22 +15482,22 @@ void Gambit_fn_020B82F0(CPUState* cpu) {
         /* 020B8360 */ rbrew_write32(cpu->mem, _t9, cpu->r[9]);
         /* 020B8364 */ cpu->r[0] = cpu->r[0] + 0x00004BA8u;
         /* 020B8368 */ cpu->r[26] = cpu->r[29] + 0x000001DCu;
-        /* 020B8368 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 020B8368 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 020B836C */ _t10 = cpu->r[29] + 0x0000001Cu;
         /* 020B836C */ rbrew_write32(cpu->mem, _t10, cpu->r[11]);
         /* 020B8370 */ cpu->r[27] = 0x00000000u;
         /* 020B8374 */ cpu->r[31] = cpu->r[26];
         /* 020B8378 */ _t11 = cpu->r[29] + 0x000001C8u;
         /* 020B8378 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
-        /* 020B837C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B837C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B837C */ _t13 = _t12 & 0x00000001u;
         /* 020B837C */ if (_t13) goto L_020B8380; else goto L_020B8390;
   L_020B8380: ; // 0x20b8380
         /* 020B8380 */ cpu->r[3] = 0x00000038u;
         /* 020B8384 */ Gambit_fn_02801A78(cpu);
         /* 020B8388 */ cpu->r[31] = cpu->r[3];
-        /* 020B8388 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020B838C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8388 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020B838C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B838C */ _t15 = _t14 & 0x00000001u;
         /* 020B838C */ if (_t15) goto L_020B83C0; else goto L_020B8390;
   L_020B8390: ; // 0x20b8390
@@ -15523,8 +15523,8 @@ void Gambit_fn_020B82F0(CPUState* cpu) {
         /* 020B83BC */ rbrew_write32(cpu->mem, _t23, cpu->r[27]);
   L_020B83C0: ; // 0x20b83c0
         /* 020B83C0 */ cpu->r[7] = cpu->r[29] + 0x00000214u;
-        /* 020B83C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 020B83C4 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B83C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 020B83C4 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B83C4 */ _t25 = _t24 & 0x00000001u;
         /* 020B83C4 */ if (_t25) goto L_020B83C8; else goto L_020B83D0;
   L_020B83C8: ; // 0x20b83c8
@@ -15532,8 +15532,8 @@ void Gambit_fn_020B82F0(CPUState* cpu) {
         /* 020B83CC */ Gambit_fn_02801A78(cpu);
   L_020B83D0: ; // 0x20b83d0
         /* 020B83D0 */ cpu->r[8] = cpu->r[29] + 0x0000021Cu;
-        /* 020B83D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 020B83D4 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B83D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 020B83D4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B83D4 */ _t27 = _t26 & 0x00000001u;
         /* 020B83D4 */ if (_t27) goto L_020B83D8; else goto L_020B83E0;
   L_020B83D8: ; // 0x20b83d8
@@ -15571,23 +15571,23 @@ void Gambit_fn_020B82F0(CPUState* cpu) {
         /* 020B8434 */ _t35 = cpu->r[12] + 0x00000000u;
         /* 020B8434 */ cpu->r[6] = rbrew_read8(cpu->mem, _t35);
         /* 020B8438 */ cpu->r[30] = 0x00000000u;
-        /* 020B843C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[31]);
+        /* 020B843C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[31]));
         /* 020B8440 */ cpu->r[0] = 0x00080000u;
-        /* 020B8444 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8444 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8444 */ _t37 = _t36 & 0x00000001u;
         /* 020B8444 */ if (_t37) goto L_020B846C; else goto L_020B8448;
   L_020B8448: ; // 0x20b8448
         /* 020B8448 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B844C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 020B844C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 020B8450 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 020B8454 */ _t38 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B8454 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B8454 */ _t39 = _t38 & 0x00000001u;
         /* 020B8454 */ if (_t39) goto L_020B8468; else goto L_020B8458;
   L_020B8458: ; // 0x20b8458
         /* 020B8458 */ _t40 = cpu->r[12] + 0x00000000u;
         /* 020B8458 */ cpu->r[7] = rbrew_read8(cpu->mem, _t40);
-        /* 020B845C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[31]);
-        /* 020B8460 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B845C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[31]));
+        /* 020B8460 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8460 */ _t42 = _t41 & 0x00000001u;
         /* 020B8460 */ if (_t42) goto L_020B8464; else goto L_020B8448;
   L_020B8464: ; // 0x20b8464
@@ -15597,10 +15597,10 @@ void Gambit_fn_020B82F0(CPUState* cpu) {
   L_020B846C: ; // 0x20b846c
         /* 020B846C */ _t43 = cpu->r[23] + 0x00000008u;
         /* 020B846C */ cpu->r[8] = rbrew_read32(cpu->mem, _t43);
-        /* 020B8470 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[8]);
+        /* 020B8470 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[8]));
         /* 020B8474 */ _t44 = cpu->r[1] + 0x00000010u;
         /* 020B8474 */ cpu->r[9] = rbrew_read32(cpu->mem, _t44);
-        /* 020B8478 */ _t45 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B8478 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B8478 */ _t46 = _t45 & 0x00000001u;
         /* 020B8478 */ if (_t46) goto L_020B8480; else goto L_020B847C;
   L_020B847C: ; // 0x20b847c
@@ -15657,10 +15657,10 @@ void Gambit_fn_020B82F0(CPUState* cpu) {
         /* 020B8504 */ rbrew_write32(cpu->mem, _t61, cpu->r[0]);
         /* 020B8508 */ _t62 = cpu->r[26] + 0x00000014u;
         /* 020B8508 */ cpu->r[12] = rbrew_read32(cpu->mem, _t62);
-        /* 020B850C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], 0x00000001u);
+        /* 020B850C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], 0x00000001u));
         /* 020B8510 */ _t63 = cpu->r[26] + 0x00000018u;
         /* 020B8510 */ cpu->r[28] = rbrew_read32(cpu->mem, _t63);
-        /* 020B8514 */ _t64 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B8514 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B8514 */ _t65 = _t64 & 0x00000001u;
         /* 020B8514 */ if (_t65) goto L_020B8518; else goto L_020B851C;
   L_020B8518: ; // 0x20b8518
@@ -15676,23 +15676,23 @@ void Gambit_fn_020B82F0(CPUState* cpu) {
         /* 020B8530 */ _t68 = cpu->r[9] + 0x00000000u;
         /* 020B8530 */ cpu->r[6] = rbrew_read8(cpu->mem, _t68);
         /* 020B8534 */ cpu->r[30] = 0x00000000u;
-        /* 020B8538 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[31]);
+        /* 020B8538 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[31]));
         /* 020B853C */ cpu->r[10] = 0x00080000u;
-        /* 020B8540 */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8540 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8540 */ _t70 = _t69 & 0x00000001u;
         /* 020B8540 */ if (_t70) goto L_020B8568; else goto L_020B8544;
   L_020B8544: ; // 0x20b8544
         /* 020B8544 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B8548 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[10]);
+        /* 020B8548 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[10]));
         /* 020B854C */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 020B8550 */ _t71 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B8550 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B8550 */ _t72 = _t71 & 0x00000001u;
         /* 020B8550 */ if (_t72) goto L_020B8564; else goto L_020B8554;
   L_020B8554: ; // 0x20b8554
         /* 020B8554 */ _t73 = cpu->r[9] + 0x00000000u;
         /* 020B8554 */ cpu->r[8] = rbrew_read8(cpu->mem, _t73);
-        /* 020B8558 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[31]);
-        /* 020B855C */ _t74 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8558 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[31]));
+        /* 020B855C */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B855C */ _t75 = _t74 & 0x00000001u;
         /* 020B855C */ if (_t75) goto L_020B8560; else goto L_020B8544;
   L_020B8560: ; // 0x20b8560
@@ -15704,10 +15704,10 @@ void Gambit_fn_020B82F0(CPUState* cpu) {
         /* 020B8568 */ cpu->r[9] = rbrew_read32(cpu->mem, _t76);
         /* 020B856C */ _t77 = cpu->r[1] + 0x00000010u;
         /* 020B856C */ cpu->r[10] = rbrew_read32(cpu->mem, _t77);
-        /* 020B8570 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[9]);
+        /* 020B8570 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[9]));
         /* 020B8574 */ _t78 = cpu->r[10] + 0x00000014u;
         /* 020B8574 */ cpu->r[12] = rbrew_read32(cpu->mem, _t78);
-        /* 020B8578 */ _t79 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B8578 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B8578 */ _t80 = _t79 & 0x00000001u;
         /* 020B8578 */ if (_t80) goto L_020B8580; else goto L_020B857C;
   L_020B857C: ; // 0x20b857c
@@ -15778,18 +15778,18 @@ void Gambit_fn_020B82F4(CPUState* cpu) {
         /* 020B82F8 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020B82FC */ /* nop */
         /* 020B8300 */ cpu->r[29] = cpu->r[3];
-        /* 020B8300 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020B8300 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020B8304 */ cpu->r[30] = cpu->r[4];
         /* 020B8308 */ cpu->r[31] = cpu->r[5];
-        /* 020B830C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B830C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B830C */ _t3 = _t2 & 0x00000001u;
         /* 020B830C */ if (_t3) goto L_020B8310; else goto L_020B8320;
   L_020B8310: ; // 0x20b8310
         /* 020B8310 */ cpu->r[3] = 0x00000224u;
         /* 020B8314 */ Gambit_fn_02801A78(cpu);
         /* 020B8318 */ cpu->r[29] = cpu->r[3];
-        /* 020B8318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020B831C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020B831C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B831C */ _t5 = _t4 & 0x00000001u;
         /* 020B831C */ if (_t5) goto L_020B85F8; else goto L_020B8320;
   L_020B8320: ; // 0x20b8320
@@ -15816,22 +15816,22 @@ void Gambit_fn_020B82F4(CPUState* cpu) {
         /* 020B8360 */ rbrew_write32(cpu->mem, _t9, cpu->r[9]);
         /* 020B8364 */ cpu->r[0] = cpu->r[0] + 0x00004BA8u;
         /* 020B8368 */ cpu->r[26] = cpu->r[29] + 0x000001DCu;
-        /* 020B8368 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 020B8368 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 020B836C */ _t10 = cpu->r[29] + 0x0000001Cu;
         /* 020B836C */ rbrew_write32(cpu->mem, _t10, cpu->r[11]);
         /* 020B8370 */ cpu->r[27] = 0x00000000u;
         /* 020B8374 */ cpu->r[31] = cpu->r[26];
         /* 020B8378 */ _t11 = cpu->r[29] + 0x000001C8u;
         /* 020B8378 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
-        /* 020B837C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B837C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B837C */ _t13 = _t12 & 0x00000001u;
         /* 020B837C */ if (_t13) goto L_020B8380; else goto L_020B8390;
   L_020B8380: ; // 0x20b8380
         /* 020B8380 */ cpu->r[3] = 0x00000038u;
         /* 020B8384 */ Gambit_fn_02801A78(cpu);
         /* 020B8388 */ cpu->r[31] = cpu->r[3];
-        /* 020B8388 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020B838C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8388 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020B838C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B838C */ _t15 = _t14 & 0x00000001u;
         /* 020B838C */ if (_t15) goto L_020B83C0; else goto L_020B8390;
   L_020B8390: ; // 0x20b8390
@@ -15857,8 +15857,8 @@ void Gambit_fn_020B82F4(CPUState* cpu) {
         /* 020B83BC */ rbrew_write32(cpu->mem, _t23, cpu->r[27]);
   L_020B83C0: ; // 0x20b83c0
         /* 020B83C0 */ cpu->r[7] = cpu->r[29] + 0x00000214u;
-        /* 020B83C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 020B83C4 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B83C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 020B83C4 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B83C4 */ _t25 = _t24 & 0x00000001u;
         /* 020B83C4 */ if (_t25) goto L_020B83C8; else goto L_020B83D0;
   L_020B83C8: ; // 0x20b83c8
@@ -15866,8 +15866,8 @@ void Gambit_fn_020B82F4(CPUState* cpu) {
         /* 020B83CC */ Gambit_fn_02801A78(cpu);
   L_020B83D0: ; // 0x20b83d0
         /* 020B83D0 */ cpu->r[8] = cpu->r[29] + 0x0000021Cu;
-        /* 020B83D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 020B83D4 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B83D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 020B83D4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B83D4 */ _t27 = _t26 & 0x00000001u;
         /* 020B83D4 */ if (_t27) goto L_020B83D8; else goto L_020B83E0;
   L_020B83D8: ; // 0x20b83d8
@@ -15905,23 +15905,23 @@ void Gambit_fn_020B82F4(CPUState* cpu) {
         /* 020B8434 */ _t35 = cpu->r[12] + 0x00000000u;
         /* 020B8434 */ cpu->r[6] = rbrew_read8(cpu->mem, _t35);
         /* 020B8438 */ cpu->r[30] = 0x00000000u;
-        /* 020B843C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[31]);
+        /* 020B843C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[31]));
         /* 020B8440 */ cpu->r[0] = 0x00080000u;
-        /* 020B8444 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8444 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8444 */ _t37 = _t36 & 0x00000001u;
         /* 020B8444 */ if (_t37) goto L_020B846C; else goto L_020B8448;
   L_020B8448: ; // 0x20b8448
         /* 020B8448 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B844C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 020B844C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 020B8450 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 020B8454 */ _t38 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B8454 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B8454 */ _t39 = _t38 & 0x00000001u;
         /* 020B8454 */ if (_t39) goto L_020B8468; else goto L_020B8458;
   L_020B8458: ; // 0x20b8458
         /* 020B8458 */ _t40 = cpu->r[12] + 0x00000000u;
         /* 020B8458 */ cpu->r[7] = rbrew_read8(cpu->mem, _t40);
-        /* 020B845C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[31]);
-        /* 020B8460 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B845C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[31]));
+        /* 020B8460 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8460 */ _t42 = _t41 & 0x00000001u;
         /* 020B8460 */ if (_t42) goto L_020B8464; else goto L_020B8448;
   L_020B8464: ; // 0x20b8464
@@ -15931,10 +15931,10 @@ void Gambit_fn_020B82F4(CPUState* cpu) {
   L_020B846C: ; // 0x20b846c
         /* 020B846C */ _t43 = cpu->r[23] + 0x00000008u;
         /* 020B846C */ cpu->r[8] = rbrew_read32(cpu->mem, _t43);
-        /* 020B8470 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[8]);
+        /* 020B8470 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[8]));
         /* 020B8474 */ _t44 = cpu->r[1] + 0x00000010u;
         /* 020B8474 */ cpu->r[9] = rbrew_read32(cpu->mem, _t44);
-        /* 020B8478 */ _t45 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B8478 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B8478 */ _t46 = _t45 & 0x00000001u;
         /* 020B8478 */ if (_t46) goto L_020B8480; else goto L_020B847C;
   L_020B847C: ; // 0x20b847c
@@ -15991,10 +15991,10 @@ void Gambit_fn_020B82F4(CPUState* cpu) {
         /* 020B8504 */ rbrew_write32(cpu->mem, _t61, cpu->r[0]);
         /* 020B8508 */ _t62 = cpu->r[26] + 0x00000014u;
         /* 020B8508 */ cpu->r[12] = rbrew_read32(cpu->mem, _t62);
-        /* 020B850C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], 0x00000001u);
+        /* 020B850C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], 0x00000001u));
         /* 020B8510 */ _t63 = cpu->r[26] + 0x00000018u;
         /* 020B8510 */ cpu->r[28] = rbrew_read32(cpu->mem, _t63);
-        /* 020B8514 */ _t64 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B8514 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B8514 */ _t65 = _t64 & 0x00000001u;
         /* 020B8514 */ if (_t65) goto L_020B8518; else goto L_020B851C;
   L_020B8518: ; // 0x20b8518
@@ -16010,23 +16010,23 @@ void Gambit_fn_020B82F4(CPUState* cpu) {
         /* 020B8530 */ _t68 = cpu->r[9] + 0x00000000u;
         /* 020B8530 */ cpu->r[6] = rbrew_read8(cpu->mem, _t68);
         /* 020B8534 */ cpu->r[30] = 0x00000000u;
-        /* 020B8538 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[31]);
+        /* 020B8538 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[31]));
         /* 020B853C */ cpu->r[10] = 0x00080000u;
-        /* 020B8540 */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8540 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8540 */ _t70 = _t69 & 0x00000001u;
         /* 020B8540 */ if (_t70) goto L_020B8568; else goto L_020B8544;
   L_020B8544: ; // 0x20b8544
         /* 020B8544 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B8548 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[10]);
+        /* 020B8548 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[10]));
         /* 020B854C */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 020B8550 */ _t71 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B8550 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B8550 */ _t72 = _t71 & 0x00000001u;
         /* 020B8550 */ if (_t72) goto L_020B8564; else goto L_020B8554;
   L_020B8554: ; // 0x20b8554
         /* 020B8554 */ _t73 = cpu->r[9] + 0x00000000u;
         /* 020B8554 */ cpu->r[8] = rbrew_read8(cpu->mem, _t73);
-        /* 020B8558 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[31]);
-        /* 020B855C */ _t74 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8558 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[31]));
+        /* 020B855C */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B855C */ _t75 = _t74 & 0x00000001u;
         /* 020B855C */ if (_t75) goto L_020B8560; else goto L_020B8544;
   L_020B8560: ; // 0x20b8560
@@ -16038,10 +16038,10 @@ void Gambit_fn_020B82F4(CPUState* cpu) {
         /* 020B8568 */ cpu->r[9] = rbrew_read32(cpu->mem, _t76);
         /* 020B856C */ _t77 = cpu->r[1] + 0x00000010u;
         /* 020B856C */ cpu->r[10] = rbrew_read32(cpu->mem, _t77);
-        /* 020B8570 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[9]);
+        /* 020B8570 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[9]));
         /* 020B8574 */ _t78 = cpu->r[10] + 0x00000014u;
         /* 020B8574 */ cpu->r[12] = rbrew_read32(cpu->mem, _t78);
-        /* 020B8578 */ _t79 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B8578 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B8578 */ _t80 = _t79 & 0x00000001u;
         /* 020B8578 */ if (_t80) goto L_020B8580; else goto L_020B857C;
   L_020B857C: ; // 0x20b857c
@@ -16117,12 +16117,12 @@ void Gambit_fn_020B8610(CPUState* cpu) {
         /* 020B8624 */ _t3 = cpu->r[31] + 0x000001E8u;
         /* 020B8624 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 020B8628 */ /* nop */
-        /* 020B862C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B862C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B862C */ _t5 = _t4 & 0x00000001u;
         /* 020B862C */ if (_t5) goto L_020B8630; else goto L_020B8668;
   L_020B8630: ; // 0x20b8630
-        /* 020B8630 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020B8634 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8630 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020B8634 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8634 */ _t7 = _t6 & 0x00000001u;
         /* 020B8634 */ if (_t7) goto L_020B868C; else goto L_020B8638;
   L_020B8638: ; // 0x20b8638
@@ -16142,13 +16142,13 @@ void Gambit_fn_020B8610(CPUState* cpu) {
         /* 020B8660 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 020B8664 */ return;
   L_020B8668: ; // 0x20b8668
-        /* 020B8668 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 020B866C */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8668 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 020B866C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B866C */ _t12 = _t11 & 0x00000001u;
         /* 020B866C */ if (_t12) goto L_020B8670; else goto L_020B868C;
   L_020B8670: ; // 0x20b8670
-        /* 020B8670 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020B8674 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8670 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020B8674 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8674 */ _t14 = _t13 & 0x00000001u;
         /* 020B8674 */ if (_t14) goto L_020B8678; else goto L_020B868C;
   L_020B8678: ; // 0x20b8678
@@ -16185,12 +16185,12 @@ void Gambit_fn_020B8614(CPUState* cpu) {
         /* 020B8624 */ _t3 = cpu->r[31] + 0x000001E8u;
         /* 020B8624 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 020B8628 */ /* nop */
-        /* 020B862C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B862C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B862C */ _t5 = _t4 & 0x00000001u;
         /* 020B862C */ if (_t5) goto L_020B8630; else goto L_020B8668;
   L_020B8630: ; // 0x20b8630
-        /* 020B8630 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020B8634 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8630 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020B8634 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8634 */ _t7 = _t6 & 0x00000001u;
         /* 020B8634 */ if (_t7) goto L_020B868C; else goto L_020B8638;
   L_020B8638: ; // 0x20b8638
@@ -16210,13 +16210,13 @@ void Gambit_fn_020B8614(CPUState* cpu) {
         /* 020B8660 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 020B8664 */ return;
   L_020B8668: ; // 0x20b8668
-        /* 020B8668 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 020B866C */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8668 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 020B866C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B866C */ _t12 = _t11 & 0x00000001u;
         /* 020B866C */ if (_t12) goto L_020B8670; else goto L_020B868C;
   L_020B8670: ; // 0x20b8670
-        /* 020B8670 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020B8674 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8670 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020B8674 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8674 */ _t14 = _t13 & 0x00000001u;
         /* 020B8674 */ if (_t14) goto L_020B8678; else goto L_020B868C;
   L_020B8678: ; // 0x20b8678
@@ -16425,8 +16425,8 @@ void Gambit_fn_020B8700(CPUState* cpu) {
         /* 02068CD8 */ cpu->r[30] = cpu->r[4];
         /* 02068CDC */ cpu->r[31] = cpu->r[3];
         /* 02068CE0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02068CE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02068CE8 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068CE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02068CE8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068CE8 */ _t8 = _t7 & 0x00000001u;
         /* 02068CE8 */ if (_t8) goto L_02068D10; else goto L_02068CEC;
   L_02068CEC: ; // 0x2068cec
@@ -16480,8 +16480,8 @@ void Gambit_fn_020B8700(CPUState* cpu) {
         /* 02068D74 */ _t21 = cpu->r[1] + 0x00000008u;
         /* 02068D74 */ rbrew_write32(cpu->mem, _t21, cpu->r[0]);
         /* 02068D78 */ Gambit_fn_027ED060(cpu);
-        /* 02068D7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02068D80 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068D7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02068D80 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068D80 */ _t23 = _t22 & 0x00000001u;
         /* 02068D80 */ if (_t23) goto L_02068D90; else goto L_02068D84;
   L_02068D84: ; // 0x2068d84
@@ -16505,10 +16505,10 @@ void Gambit_fn_020B8700(CPUState* cpu) {
         /* 02068DB0 */ _t29 = cpu->r[1] + 0x00000008u;
         /* 02068DB0 */ rbrew_write32(cpu->mem, _t29, cpu->r[7]);
         /* 02068DB4 */ Gambit_fn_027ED060(cpu);
-        /* 02068DB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02068DB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02068DBC */ _t30 = cpu->r[31] + 0x00000000u;
         /* 02068DBC */ cpu->r[7] = rbrew_read32(cpu->mem, _t30);
-        /* 02068DC0 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068DC0 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068DC0 */ _t32 = _t31 & 0x00000001u;
         /* 02068DC0 */ if (_t32) goto L_02068DD0; else goto L_02068DC4;
   L_02068DC4: ; // 0x2068dc4
@@ -16682,8 +16682,8 @@ void Gambit_fn_020B8780(CPUState* cpu) {
         /* 020B878C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020B8790 */ _t3 = cpu->r[31] + 0x000001E4u;
         /* 020B8790 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 020B8794 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B8798 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8794 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B8798 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8798 */ _t5 = _t4 & 0x00000001u;
         /* 020B8798 */ if (_t5) goto L_020B879C; else goto L_020B87C4;
   L_020B879C: ; // 0x20b879c
@@ -16716,15 +16716,15 @@ void Gambit_fn_020B87D8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B87D8: ; // 0x20b87d8
-        /* 020B87D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B87DC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B87D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B87DC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B87DC */ _t1 = _t0 & 0x00000001u;
         /* 020B87DC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B87DC */ goto L_020B87E0;
   L_020B87E0: ; // 0x20b87e0
         /* 020B87E0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B87E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B87E4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B87E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B87E4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B87E4 */ _t3 = _t2 & 0x00000001u;
         /* 020B87E4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B87E4 */ goto L_020B87E8;
@@ -16743,8 +16743,8 @@ void Gambit_fn_020B87D8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -16758,15 +16758,15 @@ void Gambit_fn_020B87D8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -16803,11 +16803,11 @@ void Gambit_fn_020B87EC(CPUState* cpu) {
         /* 020B87F8 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020B87F8 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020B87FC */ cpu->r[30] = cpu->r[3];
-        /* 020B87FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020B87FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020B8800 */ cpu->r[31] = cpu->r[4];
         /* 020B8804 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020B8804 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020B8808 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8808 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8808 */ _t5 = _t4 & 0x00000001u;
         /* 020B8808 */ if (_t5) goto L_020B884C; else goto L_020B880C;
   L_020B880C: ; // 0x20b880c
@@ -16827,8 +16827,8 @@ void Gambit_fn_020B87EC(CPUState* cpu) {
         /* 020B8834 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020B8838 */ Gambit_fn_02068798(cpu);
         /* 020B883C */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B883C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B8840 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B883C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B8840 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8840 */ _t10 = _t9 & 0x00000001u;
         /* 020B8840 */ if (_t10) goto L_020B884C; else goto L_020B8844;
   L_020B8844: ; // 0x20b8844
@@ -16859,11 +16859,11 @@ void Gambit_fn_020B87F0(CPUState* cpu) {
         /* 020B87F8 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020B87F8 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020B87FC */ cpu->r[30] = cpu->r[3];
-        /* 020B87FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020B87FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020B8800 */ cpu->r[31] = cpu->r[4];
         /* 020B8804 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020B8804 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020B8808 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8808 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8808 */ _t5 = _t4 & 0x00000001u;
         /* 020B8808 */ if (_t5) goto L_020B884C; else goto L_020B880C;
   L_020B880C: ; // 0x20b880c
@@ -16883,8 +16883,8 @@ void Gambit_fn_020B87F0(CPUState* cpu) {
         /* 020B8834 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020B8838 */ Gambit_fn_02068798(cpu);
         /* 020B883C */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B883C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B8840 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B883C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B8840 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8840 */ _t10 = _t9 & 0x00000001u;
         /* 020B8840 */ if (_t10) goto L_020B884C; else goto L_020B8844;
   L_020B8844: ; // 0x20b8844
@@ -16939,15 +16939,15 @@ void Gambit_fn_020B887C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B887C: ; // 0x20b887c
-        /* 020B887C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B8880 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B887C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B8880 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8880 */ _t1 = _t0 & 0x00000001u;
         /* 020B8880 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B8880 */ goto L_020B8884;
   L_020B8884: ; // 0x20b8884
         /* 020B8884 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B8884 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B8888 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8884 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B8888 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8888 */ _t3 = _t2 & 0x00000001u;
         /* 020B8888 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B8888 */ goto L_020B888C;
@@ -16966,8 +16966,8 @@ void Gambit_fn_020B887C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -16981,15 +16981,15 @@ void Gambit_fn_020B887C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -17035,15 +17035,15 @@ void Gambit_fn_020B88AC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B88AC: ; // 0x20b88ac
-        /* 020B88AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B88B0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B88AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B88B0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B88B0 */ _t1 = _t0 & 0x00000001u;
         /* 020B88B0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B88B0 */ goto L_020B88B4;
   L_020B88B4: ; // 0x20b88b4
         /* 020B88B4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B88B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B88B8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B88B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B88B8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B88B8 */ _t3 = _t2 & 0x00000001u;
         /* 020B88B8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B88B8 */ goto L_020B88BC;
@@ -17062,8 +17062,8 @@ void Gambit_fn_020B88AC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -17077,15 +17077,15 @@ void Gambit_fn_020B88AC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -17113,15 +17113,15 @@ void Gambit_fn_020B88C0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B88C0: ; // 0x20b88c0
-        /* 020B88C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B88C4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B88C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B88C4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B88C4 */ _t1 = _t0 & 0x00000001u;
         /* 020B88C4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B88C4 */ goto L_020B88C8;
   L_020B88C8: ; // 0x20b88c8
         /* 020B88C8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B88C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B88CC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B88C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B88CC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B88CC */ _t3 = _t2 & 0x00000001u;
         /* 020B88CC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B88CC */ goto L_020B88D0;
@@ -17140,8 +17140,8 @@ void Gambit_fn_020B88C0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -17155,15 +17155,15 @@ void Gambit_fn_020B88C0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -17269,9 +17269,9 @@ void Gambit_fn_020B8914(CPUState* cpu) {
         /* 020B8918 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 020B8918 */ cpu->r[9] = _t0;
         /* 020B891C */ cpu->r[12] = 0x101D0000u;
-        /* 020B8920 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 020B8920 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 020B8924 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 020B8928 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8928 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8928 */ _t2 = _t1 & 0x00000001u;
         /* 020B8928 */ if (_t2) goto L_020B892C; else goto L_020B8940;
   L_020B892C: ; // 0x20b892c
@@ -17283,8 +17283,8 @@ void Gambit_fn_020B8914(CPUState* cpu) {
         /* 020B893C */ _t4 = cpu->r[12] + 0x00000000u;
         /* 020B893C */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_020B8940: ; // 0x20b8940
-        /* 020B8940 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 020B8944 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 020B8944 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8944 */ _t6 = _t5 & 0x00000001u;
         /* 020B8944 */ if (_t6) goto L_020B8948; else goto L_020B8950;
   L_020B8948: ; // 0x20b8948
@@ -17296,9 +17296,9 @@ void Gambit_fn_020B8914(CPUState* cpu) {
         /* 020B8954 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 020B8954 */ cpu->r[7] = _t7;
         /* 020B8958 */ cpu->r[11] = 0x101D0000u;
-        /* 020B895C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020B895C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020B8960 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 020B8964 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8964 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8964 */ _t9 = _t8 & 0x00000001u;
         /* 020B8964 */ if (_t9) goto L_020B8968; else goto L_020B897C;
   L_020B8968: ; // 0x20b8968
@@ -17401,18 +17401,18 @@ void Gambit_fn_020B89C0(CPUState* cpu) {
         /* 0206C8A8 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0206C8A8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0206C8AC */ cpu->r[12] = 0x00000000u;
-        /* 0206C8B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0206C8B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0206C8B4 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0206C8B4 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0206C8B8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206C8B8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206C8B8 */ _t6 = _t5 & 0x00000001u;
         /* 0206C8B8 */ if (_t6) goto L_0206C8E0; else goto L_0206C8BC;
   L_0206C8BC: ; // 0x206c8bc
         /* 0206C8BC */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0206C8BC */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0206C8C0 */ /* nop */
-        /* 0206C8C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0206C8C8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206C8C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0206C8C8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206C8C8 */ _t9 = _t8 & 0x00000001u;
         /* 0206C8C8 */ if (_t9) goto L_0206C8CC; else goto L_0206C8E0;
   L_0206C8CC: ; // 0x206c8cc
@@ -17460,10 +17460,10 @@ void Gambit_fn_020B89CC(CPUState* cpu) {
         /* 020B89EC */ cpu->r[31] = 0x101D0000u;
         /* 020B89F0 */ _t3 = cpu->r[28] + 0x0000001Cu;
         /* 020B89F0 */ rbrew_write32(cpu->mem, _t3, cpu->r[4]);
-        /* 020B89F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B89F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B89F8 */ _t4 = cpu->r[28] + 0x0000000Fu;
         /* 020B89F8 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[27]);
-        /* 020B89FC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B89FC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B89FC */ _t6 = _t5 & 0x00000001u;
         /* 020B89FC */ if (_t6) goto L_020B8A40; else goto L_020B8A00;
   L_020B8A00: ; // 0x20b8a00
@@ -17478,16 +17478,16 @@ void Gambit_fn_020B89CC(CPUState* cpu) {
         /* 020B8A14 */ cpu->r[5] = 0x00000004u;
         /* 020B8A18 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020B8A1C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020B8A20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B8A20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B8A24 */ cpu->r[0] = cpu->r[27];
-        /* 020B8A28 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B8A28 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B8A28 */ _t11 = _t10 & 0x00000001u;
         /* 020B8A28 */ if (_t11) goto L_020B8A30; else goto L_020B8A2C;
   L_020B8A2C: ; // 0x20b8a2c
         /* 020B8A2C */ cpu->r[0] = 0x00000001u;
   L_020B8A30: ; // 0x20b8a30
-        /* 020B8A30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B8A34 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8A30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B8A34 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8A34 */ _t13 = _t12 & 0x00000001u;
         /* 020B8A34 */ if (_t13) goto L_020B8A40; else goto L_020B8A38;
   L_020B8A38: ; // 0x20b8a38
@@ -17499,9 +17499,9 @@ void Gambit_fn_020B89CC(CPUState* cpu) {
         /* 020B8A40 */ _t16 = cpu->r[28] + 0x00000020u;
         /* 020B8A40 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 020B8A44 */ cpu->r[0] = 0x00000000u;
-        /* 020B8A48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 020B8A48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 020B8A4C */ cpu->r[12] = cpu->r[0];
-        /* 020B8A50 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B8A50 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B8A50 */ _t18 = _t17 & 0x00000001u;
         /* 020B8A50 */ if (_t18) goto L_020B8A54; else goto L_020B8A78;
   L_020B8A54: ; // 0x20b8a54
@@ -17526,8 +17526,8 @@ void Gambit_fn_020B89CC(CPUState* cpu) {
   L_020B8A78: ; // 0x20b8a78
         /* 020B8A78 */ _t26 = cpu->r[28] + 0x0000000Fu;
         /* 020B8A78 */ cpu->r[27] = rbrew_read8(cpu->mem, _t26);
-        /* 020B8A7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020B8A80 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8A7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020B8A80 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8A80 */ _t28 = _t27 & 0x00000001u;
         /* 020B8A80 */ if (_t28) goto L_020B8AC4; else goto L_020B8A84;
   L_020B8A84: ; // 0x20b8a84
@@ -17542,16 +17542,16 @@ void Gambit_fn_020B89CC(CPUState* cpu) {
         /* 020B8A98 */ cpu->r[5] = 0x00000004u;
         /* 020B8A9C */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020B8AA0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020B8AA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B8AA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B8AA8 */ cpu->r[11] = cpu->r[27];
-        /* 020B8AAC */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B8AAC */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B8AAC */ _t33 = _t32 & 0x00000001u;
         /* 020B8AAC */ if (_t33) goto L_020B8AB4; else goto L_020B8AB0;
   L_020B8AB0: ; // 0x20b8ab0
         /* 020B8AB0 */ cpu->r[11] = 0x00000001u;
   L_020B8AB4: ; // 0x20b8ab4
-        /* 020B8AB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B8AB8 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8AB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B8AB8 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8AB8 */ _t35 = _t34 & 0x00000001u;
         /* 020B8AB8 */ if (_t35) goto L_020B8AC4; else goto L_020B8ABC;
   L_020B8ABC: ; // 0x20b8abc
@@ -17563,9 +17563,9 @@ void Gambit_fn_020B89CC(CPUState* cpu) {
         /* 020B8AC4 */ _t38 = cpu->r[28] + 0x00000028u;
         /* 020B8AC4 */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 020B8AC8 */ cpu->r[0] = 0x00000000u;
-        /* 020B8ACC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 020B8ACC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 020B8AD0 */ cpu->r[12] = cpu->r[0];
-        /* 020B8AD4 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B8AD4 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B8AD4 */ _t40 = _t39 & 0x00000001u;
         /* 020B8AD4 */ if (_t40) goto L_020B8AD8; else goto L_020B8AFC;
   L_020B8AD8: ; // 0x20b8ad8
@@ -17590,8 +17590,8 @@ void Gambit_fn_020B89CC(CPUState* cpu) {
   L_020B8AFC: ; // 0x20b8afc
         /* 020B8AFC */ _t48 = cpu->r[28] + 0x0000000Fu;
         /* 020B8AFC */ cpu->r[27] = rbrew_read8(cpu->mem, _t48);
-        /* 020B8B00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020B8B04 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8B00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020B8B04 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8B04 */ _t50 = _t49 & 0x00000001u;
         /* 020B8B04 */ if (_t50) goto L_020B8B48; else goto L_020B8B08;
   L_020B8B08: ; // 0x20b8b08
@@ -17606,16 +17606,16 @@ void Gambit_fn_020B89CC(CPUState* cpu) {
         /* 020B8B1C */ cpu->r[5] = 0x00000004u;
         /* 020B8B20 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020B8B24 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020B8B28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B8B28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B8B2C */ cpu->r[10] = cpu->r[27];
-        /* 020B8B30 */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B8B30 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B8B30 */ _t55 = _t54 & 0x00000001u;
         /* 020B8B30 */ if (_t55) goto L_020B8B38; else goto L_020B8B34;
   L_020B8B34: ; // 0x20b8b34
         /* 020B8B34 */ cpu->r[10] = 0x00000001u;
   L_020B8B38: ; // 0x20b8b38
-        /* 020B8B38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B8B3C */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8B38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B8B3C */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8B3C */ _t57 = _t56 & 0x00000001u;
         /* 020B8B3C */ if (_t57) goto L_020B8B48; else goto L_020B8B40;
   L_020B8B40: ; // 0x20b8b40
@@ -17627,9 +17627,9 @@ void Gambit_fn_020B89CC(CPUState* cpu) {
         /* 020B8B48 */ _t60 = cpu->r[28] + 0x00000030u;
         /* 020B8B48 */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
         /* 020B8B4C */ cpu->r[0] = 0x00000000u;
-        /* 020B8B50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 020B8B50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 020B8B54 */ cpu->r[5] = cpu->r[0];
-        /* 020B8B58 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B8B58 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B8B58 */ _t62 = _t61 & 0x00000001u;
         /* 020B8B58 */ if (_t62) goto L_020B8B5C; else goto L_020B8B80;
   L_020B8B5C: ; // 0x20b8b5c
@@ -17654,8 +17654,8 @@ void Gambit_fn_020B89CC(CPUState* cpu) {
   L_020B8B80: ; // 0x20b8b80
         /* 020B8B80 */ _t70 = cpu->r[30] + 0x00000000u;
         /* 020B8B80 */ cpu->r[25] = rbrew_read8(cpu->mem, _t70);
-        /* 020B8B84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 020B8B88 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8B84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 020B8B88 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8B88 */ _t72 = _t71 & 0x00000001u;
         /* 020B8B88 */ if (_t72) goto L_020B8C64; else goto L_020B8B8C;
   L_020B8B8C: ; // 0x20b8b8c
@@ -17671,10 +17671,10 @@ void Gambit_fn_020B89CC(CPUState* cpu) {
         /* 020B8BA4 */ cpu->r[4] = (uint32_t)((int32_t)cpu->r[25] * (int32_t)0x00000024u);
         /* 020B8BA8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020B8BAC */ cpu->r[24] = cpu->r[3];
-        /* 020B8BB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 020B8BB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 020B8BB4 */ cpu->r[30] = cpu->r[25];
         /* 020B8BB8 */ cpu->r[7] = 0x00000000u;
-        /* 020B8BBC */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B8BBC */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B8BBC */ _t77 = _t76 & 0x00000001u;
         /* 020B8BBC */ if (_t77) goto L_020B8BC4; else goto L_020B8BC0;
   L_020B8BC0: ; // 0x20b8bc0
@@ -17687,36 +17687,36 @@ void Gambit_fn_020B89CC(CPUState* cpu) {
         /* 020B8BD0 */ cpu->r[23] = 0x00000018u;
   L_020B8BD4: ; // 0x20b8bd4
         /* 020B8BD4 */ cpu->r[27] = cpu->r[24] + cpu->r[22];
-        /* 020B8BD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020B8BD8 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8BD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020B8BD8 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8BD8 */ _t80 = _t79 & 0x00000001u;
         /* 020B8BD8 */ if (_t80) goto L_020B8C48; else goto L_020B8BDC;
   L_020B8BDC: ; // 0x20b8bdc
         /* 020B8BDC */ cpu->r[26] = cpu->r[27];
-        /* 020B8BDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 020B8BE0 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8BDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 020B8BE0 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8BE0 */ _t82 = _t81 & 0x00000001u;
         /* 020B8BE0 */ if (_t82) goto L_020B8BE4; else goto L_020B8BF4;
   L_020B8BE4: ; // 0x20b8be4
         /* 020B8BE4 */ cpu->r[3] = 0x00000024u;
         /* 020B8BE8 */ Gambit_fn_02801A78(cpu);
         /* 020B8BEC */ cpu->r[26] = cpu->r[3];
-        /* 020B8BEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 020B8BF0 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8BEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 020B8BF0 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8BF0 */ _t84 = _t83 & 0x00000001u;
         /* 020B8BF0 */ if (_t84) goto L_020B8C3C; else goto L_020B8BF4;
   L_020B8BF4: ; // 0x20b8bf4
         /* 020B8BF4 */ cpu->r[11] = cpu->r[26];
-        /* 020B8BF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020B8BF8 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8BF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020B8BF8 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8BF8 */ _t86 = _t85 & 0x00000001u;
         /* 020B8BF8 */ if (_t86) goto L_020B8BFC; else goto L_020B8C0C;
   L_020B8BFC: ; // 0x20b8bfc
         /* 020B8BFC */ cpu->r[3] = 0x0000000Cu;
         /* 020B8C00 */ Gambit_fn_02801A78(cpu);
         /* 020B8C04 */ cpu->r[11] = cpu->r[3];
-        /* 020B8C04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020B8C08 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8C04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020B8C08 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8C08 */ _t88 = _t87 & 0x00000001u;
         /* 020B8C08 */ if (_t88) goto L_020B8C28; else goto L_020B8C0C;
   L_020B8C0C: ; // 0x20b8c0c
@@ -17747,14 +17747,14 @@ void Gambit_fn_020B89CC(CPUState* cpu) {
         /* 020B8C44 */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
   L_020B8C48: ; // 0x20b8c48
         /* 020B8C48 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 020B8C48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020B8C48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020B8C4C */ cpu->r[22] = cpu->r[22] + 0x00000024u;
-        /* 020B8C50 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8C50 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8C50 */ _t98 = _t97 & 0x00000001u;
         /* 020B8C50 */ if (_t98) goto L_020B8C54; else goto L_020B8BD4;
   L_020B8C54: ; // 0x20b8c54
-        /* 020B8C54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 020B8C58 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8C54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 020B8C58 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8C58 */ _t100 = _t99 & 0x00000001u;
         /* 020B8C58 */ if (_t100) goto L_020B8C64; else goto L_020B8C5C;
   L_020B8C5C: ; // 0x20b8c5c
@@ -17784,10 +17784,10 @@ void Gambit_fn_020B8C7C(CPUState* cpu) {
         /* 020B8C80 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 020B8C84 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 020B8C84 */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 020B8C88 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[12]);
+        /* 020B8C88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[12]));
         /* 020B8C8C */ _t3 = cpu->r[4] + 0x00000000u;
         /* 020B8C8C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 020B8C90 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B8C90 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B8C90 */ _t5 = _t4 & 0x00000001u;
         /* 020B8C90 */ if (_t5) goto L_020B8C94; else goto L_020B8C9C;
   L_020B8C94: ; // 0x20b8c94
@@ -17804,10 +17804,10 @@ void Gambit_fn_020B8C7C(CPUState* cpu) {
         /* 020B8CA8 */ cpu->r[9] = rbrew_read8(cpu->mem, _t9);
         /* 020B8CAC */ _t10 = cpu->r[3] + 0x00000028u;
         /* 020B8CAC */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 020B8CB0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
+        /* 020B8CB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
         /* 020B8CB4 */ _t11 = cpu->r[3] + 0x0000002Cu;
         /* 020B8CB4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
-        /* 020B8CB8 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B8CB8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B8CB8 */ _t13 = _t12 & 0x00000001u;
         /* 020B8CB8 */ if (_t13) goto L_020B8CBC; else goto L_020B8CC4;
   L_020B8CBC: ; // 0x20b8cbc
@@ -17828,10 +17828,10 @@ void Gambit_fn_020B8C7C(CPUState* cpu) {
         /* 020B8CD8 */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
         /* 020B8CDC */ _t20 = cpu->r[3] + 0x00000034u;
         /* 020B8CDC */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 020B8CE0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
+        /* 020B8CE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
         /* 020B8CE4 */ _t21 = cpu->r[6] + 0x00000000u;
         /* 020B8CE4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
-        /* 020B8CE8 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B8CE8 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B8CE8 */ _t23 = _t22 & 0x00000001u;
         /* 020B8CE8 */ if (_t23) goto L_020B8CEC; else goto L_020B8CF4;
   L_020B8CEC: ; // 0x20b8cec
@@ -17852,15 +17852,15 @@ void Gambit_fn_020B8D04(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B8D04: ; // 0x20b8d04
-        /* 020B8D04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B8D08 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8D04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B8D08 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8D08 */ _t1 = _t0 & 0x00000001u;
         /* 020B8D08 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B8D08 */ goto L_020B8D0C;
   L_020B8D0C: ; // 0x20b8d0c
         /* 020B8D0C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B8D0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B8D10 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8D0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B8D10 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8D10 */ _t3 = _t2 & 0x00000001u;
         /* 020B8D10 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B8D10 */ goto L_020B8D14;
@@ -17879,8 +17879,8 @@ void Gambit_fn_020B8D04(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -17894,15 +17894,15 @@ void Gambit_fn_020B8D04(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -17936,15 +17936,15 @@ void Gambit_fn_020B8D1C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B8D1C: ; // 0x20b8d1c
-        /* 020B8D1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B8D20 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8D1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B8D20 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8D20 */ _t1 = _t0 & 0x00000001u;
         /* 020B8D20 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B8D20 */ goto L_020B8D24;
   L_020B8D24: ; // 0x20b8d24
         /* 020B8D24 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B8D24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B8D28 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8D24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B8D28 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8D28 */ _t3 = _t2 & 0x00000001u;
         /* 020B8D28 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B8D28 */ goto L_020B8D2C;
@@ -17963,8 +17963,8 @@ void Gambit_fn_020B8D1C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -17978,15 +17978,15 @@ void Gambit_fn_020B8D1C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -18032,15 +18032,15 @@ void Gambit_fn_020B8D4C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B8D4C: ; // 0x20b8d4c
-        /* 020B8D4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B8D50 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8D4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B8D50 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8D50 */ _t1 = _t0 & 0x00000001u;
         /* 020B8D50 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B8D50 */ goto L_020B8D54;
   L_020B8D54: ; // 0x20b8d54
         /* 020B8D54 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B8D54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B8D58 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8D54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B8D58 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8D58 */ _t3 = _t2 & 0x00000001u;
         /* 020B8D58 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B8D58 */ goto L_020B8D5C;
@@ -18059,8 +18059,8 @@ void Gambit_fn_020B8D4C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -18074,15 +18074,15 @@ void Gambit_fn_020B8D4C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -18110,15 +18110,15 @@ void Gambit_fn_020B8D60(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B8D60: ; // 0x20b8d60
-        /* 020B8D60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B8D64 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8D60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B8D64 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8D64 */ _t1 = _t0 & 0x00000001u;
         /* 020B8D64 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B8D64 */ goto L_020B8D68;
   L_020B8D68: ; // 0x20b8d68
         /* 020B8D68 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B8D68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B8D6C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8D68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B8D6C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8D6C */ _t3 = _t2 & 0x00000001u;
         /* 020B8D6C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B8D6C */ goto L_020B8D70;
@@ -18137,8 +18137,8 @@ void Gambit_fn_020B8D60(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -18152,15 +18152,15 @@ void Gambit_fn_020B8D60(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -18200,11 +18200,11 @@ void Gambit_fn_020B8D74(CPUState* cpu) {
         /* 020B9588 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020B9588 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020B958C */ cpu->r[30] = cpu->r[3];
-        /* 020B958C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020B958C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020B9590 */ cpu->r[31] = cpu->r[4];
         /* 020B9594 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020B9594 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020B9598 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9598 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9598 */ _t5 = _t4 & 0x00000001u;
         /* 020B9598 */ if (_t5) goto L_020B95DC; else goto L_020B959C;
   L_020B959C: ; // 0x20b959c
@@ -18224,8 +18224,8 @@ void Gambit_fn_020B8D74(CPUState* cpu) {
         /* 020B95C4 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020B95C8 */ Gambit_fn_02068798(cpu);
         /* 020B95CC */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B95CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B95D0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B95CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B95D0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B95D0 */ _t10 = _t9 & 0x00000001u;
         /* 020B95D0 */ if (_t10) goto L_020B95DC; else goto L_020B95D4;
   L_020B95D4: ; // 0x20b95d4
@@ -18253,8 +18253,8 @@ void Gambit_fn_020B8D7C(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -18306,20 +18306,20 @@ void Gambit_fn_020B8D94(CPUState* cpu) {
         /* 020B8D9C */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020B8DA0 */ /* nop */
         /* 020B8DA4 */ cpu->r[29] = cpu->r[3];
-        /* 020B8DA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020B8DA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020B8DA8 */ cpu->r[30] = cpu->r[4];
         /* 020B8DAC */ cpu->r[31] = cpu->r[5];
         /* 020B8DB0 */ cpu->r[24] = cpu->r[6];
         /* 020B8DB4 */ cpu->r[25] = cpu->r[7];
-        /* 020B8DB8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8DB8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8DB8 */ _t3 = _t2 & 0x00000001u;
         /* 020B8DB8 */ if (_t3) goto L_020B8DBC; else goto L_020B8DCC;
   L_020B8DBC: ; // 0x20b8dbc
         /* 020B8DBC */ cpu->r[3] = 0x00000250u;
         /* 020B8DC0 */ Gambit_fn_02801A78(cpu);
         /* 020B8DC4 */ cpu->r[29] = cpu->r[3];
-        /* 020B8DC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020B8DC8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8DC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020B8DC8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8DC8 */ _t5 = _t4 & 0x00000001u;
         /* 020B8DC8 */ if (_t5) goto L_020B92F0; else goto L_020B8DCC;
   L_020B8DCC: ; // 0x20b8dcc
@@ -18355,22 +18355,22 @@ void Gambit_fn_020B8D94(CPUState* cpu) {
         /* 020B8E24 */ rbrew_write32(cpu->mem, _t12, cpu->r[6]);
         /* 020B8E28 */ cpu->r[8] = cpu->r[8] + 0x00004F38u;
         /* 020B8E2C */ cpu->r[27] = cpu->r[29] + 0x000001DCu;
-        /* 020B8E2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B8E2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B8E30 */ _t13 = cpu->r[29] + 0x0000001Cu;
         /* 020B8E30 */ rbrew_write32(cpu->mem, _t13, cpu->r[7]);
         /* 020B8E34 */ cpu->r[28] = 0x00000000u;
         /* 020B8E38 */ cpu->r[31] = cpu->r[27];
         /* 020B8E3C */ _t14 = cpu->r[29] + 0x000001C8u;
         /* 020B8E3C */ rbrew_write32(cpu->mem, _t14, cpu->r[8]);
-        /* 020B8E40 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8E40 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8E40 */ _t16 = _t15 & 0x00000001u;
         /* 020B8E40 */ if (_t16) goto L_020B8E44; else goto L_020B8E54;
   L_020B8E44: ; // 0x20b8e44
         /* 020B8E44 */ cpu->r[3] = 0x00000038u;
         /* 020B8E48 */ Gambit_fn_02801A78(cpu);
         /* 020B8E4C */ cpu->r[31] = cpu->r[3];
-        /* 020B8E4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020B8E50 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8E4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020B8E50 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8E50 */ _t18 = _t17 & 0x00000001u;
         /* 020B8E50 */ if (_t18) goto L_020B8E84; else goto L_020B8E54;
   L_020B8E54: ; // 0x20b8e54
@@ -18397,46 +18397,46 @@ void Gambit_fn_020B8D94(CPUState* cpu) {
   L_020B8E84: ; // 0x20b8e84
         /* 020B8E84 */ cpu->r[23] = 0x10010000u;
         /* 020B8E88 */ cpu->r[20] = cpu->r[29] + 0x00000214u;
-        /* 020B8E88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
+        /* 020B8E88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
         /* 020B8E8C */ cpu->r[30] = 0x10010000u;
         /* 020B8E90 */ cpu->r[23] = cpu->r[23] + 0x00004CE0u;
         /* 020B8E94 */ cpu->r[22] = 0x10010000u;
         /* 020B8E98 */ cpu->r[30] = cpu->r[30] + 0x00004CC8u;
         /* 020B8E9C */ cpu->r[31] = 0x10110000u;
         /* 020B8EA0 */ cpu->r[22] = cpu->r[22] + 0x00004CF8u;
-        /* 020B8EA4 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8EA4 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8EA4 */ _t28 = _t27 & 0x00000001u;
         /* 020B8EA4 */ if (_t28) goto L_020B8EA8; else goto L_020B8EC8;
   L_020B8EA8: ; // 0x20b8ea8
         /* 020B8EA8 */ cpu->r[3] = 0x0000001Cu;
         /* 020B8EAC */ Gambit_fn_02801A78(cpu);
         /* 020B8EB0 */ cpu->r[20] = cpu->r[3];
-        /* 020B8EB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
-        /* 020B8EB4 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8EB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
+        /* 020B8EB4 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8EB4 */ _t30 = _t29 & 0x00000001u;
         /* 020B8EB4 */ if (_t30) goto L_020B8EB8; else goto L_020B8EC8;
   L_020B8EB8: ; // 0x20b8eb8
         /* 020B8EB8 */ cpu->r[20] = cpu->r[29] + 0x00000230u;
-        /* 020B8EB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
+        /* 020B8EB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
         /* 020B8EBC */ _t31 = cpu->r[31] + 0x00007399u;
         /* 020B8EBC */ cpu->r[31] = rbrew_read8(cpu->mem, _t31);
-        /* 020B8EC0 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8EC0 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8EC0 */ _t33 = _t32 & 0x00000001u;
         /* 020B8EC0 */ if (_t33) goto L_020B8EC4; else goto L_020B8F5C;
   L_020B8EC4: ; // 0x20b8ec4
         /* 020B8EC4 */ goto L_020B8F4C;
   L_020B8EC8: ; // 0x20b8ec8
         /* 020B8EC8 */ cpu->r[21] = cpu->r[20];
-        /* 020B8EC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 020B8ECC */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8EC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 020B8ECC */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8ECC */ _t35 = _t34 & 0x00000001u;
         /* 020B8ECC */ if (_t35) goto L_020B8ED0; else goto L_020B8EEC;
   L_020B8ED0: ; // 0x20b8ed0
         /* 020B8ED0 */ cpu->r[3] = 0x0000001Cu;
         /* 020B8ED4 */ Gambit_fn_02801A78(cpu);
         /* 020B8ED8 */ cpu->r[21] = cpu->r[3];
-        /* 020B8ED8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 020B8EDC */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8ED8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 020B8EDC */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8EDC */ _t37 = _t36 & 0x00000001u;
         /* 020B8EDC */ if (_t37) goto L_020B8EE0; else goto L_020B8EEC;
   L_020B8EE0: ; // 0x20b8ee0
@@ -18447,15 +18447,15 @@ void Gambit_fn_020B8D94(CPUState* cpu) {
         /* 020B8EE8 */ goto L_020B8F44;
   L_020B8EEC: ; // 0x20b8eec
         /* 020B8EEC */ cpu->r[3] = cpu->r[21];
-        /* 020B8EEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B8EF0 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8EEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B8EF0 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8EF0 */ _t41 = _t40 & 0x00000001u;
         /* 020B8EF0 */ if (_t41) goto L_020B8EF4; else goto L_020B8F18;
   L_020B8EF4: ; // 0x20b8ef4
         /* 020B8EF4 */ cpu->r[3] = 0x0000000Cu;
         /* 020B8EF8 */ Gambit_fn_02801A78(cpu);
-        /* 020B8EFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B8F00 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8EFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B8F00 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8F00 */ _t43 = _t42 & 0x00000001u;
         /* 020B8F00 */ if (_t43) goto L_020B8F04; else goto L_020B8F18;
   L_020B8F04: ; // 0x20b8f04
@@ -18492,43 +18492,43 @@ void Gambit_fn_020B8D94(CPUState* cpu) {
         /* 020B8F40 */ rbrew_write32(cpu->mem, _t56, cpu->r[22]);
   L_020B8F44: ; // 0x20b8f44
         /* 020B8F44 */ cpu->r[20] = cpu->r[29] + 0x00000230u;
-        /* 020B8F44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
-        /* 020B8F48 */ _t57 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8F44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
+        /* 020B8F48 */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8F48 */ _t58 = _t57 & 0x00000001u;
         /* 020B8F48 */ if (_t58) goto L_020B8F4C; else goto L_020B8F5C;
   L_020B8F4C: ; // 0x20b8f4c
         /* 020B8F4C */ cpu->r[3] = 0x0000001Cu;
         /* 020B8F50 */ Gambit_fn_02801A78(cpu);
         /* 020B8F54 */ cpu->r[20] = cpu->r[3];
-        /* 020B8F54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
-        /* 020B8F58 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8F54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
+        /* 020B8F58 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8F58 */ _t60 = _t59 & 0x00000001u;
         /* 020B8F58 */ if (_t60) goto L_020B8FB4; else goto L_020B8F5C;
   L_020B8F5C: ; // 0x20b8f5c
         /* 020B8F5C */ cpu->r[21] = cpu->r[20];
-        /* 020B8F5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 020B8F60 */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8F5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 020B8F60 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8F60 */ _t62 = _t61 & 0x00000001u;
         /* 020B8F60 */ if (_t62) goto L_020B8F64; else goto L_020B8F74;
   L_020B8F64: ; // 0x20b8f64
         /* 020B8F64 */ cpu->r[3] = 0x0000001Cu;
         /* 020B8F68 */ Gambit_fn_02801A78(cpu);
         /* 020B8F6C */ cpu->r[21] = cpu->r[3];
-        /* 020B8F6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 020B8F70 */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8F6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 020B8F70 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8F70 */ _t64 = _t63 & 0x00000001u;
         /* 020B8F70 */ if (_t64) goto L_020B8FB0; else goto L_020B8F74;
   L_020B8F74: ; // 0x20b8f74
         /* 020B8F74 */ cpu->r[3] = cpu->r[21];
-        /* 020B8F74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B8F78 */ _t65 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8F74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B8F78 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8F78 */ _t66 = _t65 & 0x00000001u;
         /* 020B8F78 */ if (_t66) goto L_020B8F7C; else goto L_020B8F8C;
   L_020B8F7C: ; // 0x20b8f7c
         /* 020B8F7C */ cpu->r[3] = 0x0000000Cu;
         /* 020B8F80 */ Gambit_fn_02801A78(cpu);
-        /* 020B8F84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B8F88 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8F84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B8F88 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8F88 */ _t68 = _t67 & 0x00000001u;
         /* 020B8F88 */ if (_t68) goto L_020B8FA4; else goto L_020B8F8C;
   L_020B8F8C: ; // 0x20b8f8c
@@ -18572,23 +18572,23 @@ void Gambit_fn_020B8D94(CPUState* cpu) {
         /* 020B8FDC */ _t83 = cpu->r[6] + 0x00000000u;
         /* 020B8FDC */ cpu->r[0] = rbrew_read8(cpu->mem, _t83);
         /* 020B8FE0 */ cpu->r[30] = 0x00000000u;
-        /* 020B8FE4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 020B8FE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 020B8FE8 */ cpu->r[0] = 0x00080000u;
-        /* 020B8FEC */ _t84 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8FEC */ _t84 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8FEC */ _t85 = _t84 & 0x00000001u;
         /* 020B8FEC */ if (_t85) goto L_020B9014; else goto L_020B8FF0;
   L_020B8FF0: ; // 0x20b8ff0
         /* 020B8FF0 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B8FF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 020B8FF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 020B8FF8 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 020B8FFC */ _t86 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B8FFC */ _t86 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B8FFC */ _t87 = _t86 & 0x00000001u;
         /* 020B8FFC */ if (_t87) goto L_020B9010; else goto L_020B9000;
   L_020B9000: ; // 0x20b9000
         /* 020B9000 */ _t88 = cpu->r[6] + 0x00000000u;
         /* 020B9000 */ cpu->r[12] = rbrew_read8(cpu->mem, _t88);
-        /* 020B9004 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[31]);
-        /* 020B9008 */ _t89 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9004 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[31]));
+        /* 020B9008 */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9008 */ _t90 = _t89 & 0x00000001u;
         /* 020B9008 */ if (_t90) goto L_020B900C; else goto L_020B8FF0;
   L_020B900C: ; // 0x20b900c
@@ -18600,10 +18600,10 @@ void Gambit_fn_020B8D94(CPUState* cpu) {
         /* 020B9014 */ cpu->r[10] = rbrew_read32(cpu->mem, _t91);
         /* 020B9018 */ _t92 = cpu->r[24] + 0x00000004u;
         /* 020B9018 */ cpu->r[5] = rbrew_read32(cpu->mem, _t92);
-        /* 020B901C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[10]);
+        /* 020B901C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[10]));
         /* 020B9020 */ _t93 = cpu->r[5] + 0x00000014u;
         /* 020B9020 */ cpu->r[6] = rbrew_read32(cpu->mem, _t93);
-        /* 020B9024 */ _t94 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B9024 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B9024 */ _t95 = _t94 & 0x00000001u;
         /* 020B9024 */ if (_t95) goto L_020B902C; else goto L_020B9028;
   L_020B9028: ; // 0x20b9028
@@ -18634,23 +18634,23 @@ void Gambit_fn_020B8D94(CPUState* cpu) {
         /* 020B906C */ _t102 = cpu->r[10] + 0x00000000u;
         /* 020B906C */ cpu->r[9] = rbrew_read8(cpu->mem, _t102);
         /* 020B9070 */ cpu->r[30] = 0x00000000u;
-        /* 020B9074 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[31]);
+        /* 020B9074 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[31]));
         /* 020B9078 */ cpu->r[12] = 0x00080000u;
-        /* 020B907C */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B907C */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B907C */ _t104 = _t103 & 0x00000001u;
         /* 020B907C */ if (_t104) goto L_020B90A4; else goto L_020B9080;
   L_020B9080: ; // 0x20b9080
         /* 020B9080 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B9084 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[12]);
+        /* 020B9084 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[12]));
         /* 020B9088 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 020B908C */ _t105 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B908C */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B908C */ _t106 = _t105 & 0x00000001u;
         /* 020B908C */ if (_t106) goto L_020B90A0; else goto L_020B9090;
   L_020B9090: ; // 0x20b9090
         /* 020B9090 */ _t107 = cpu->r[10] + 0x00000000u;
         /* 020B9090 */ cpu->r[0] = rbrew_read8(cpu->mem, _t107);
-        /* 020B9094 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020B9098 */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9094 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020B9098 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9098 */ _t109 = _t108 & 0x00000001u;
         /* 020B9098 */ if (_t109) goto L_020B909C; else goto L_020B9080;
   L_020B909C: ; // 0x20b909c
@@ -18660,8 +18660,8 @@ void Gambit_fn_020B8D94(CPUState* cpu) {
   L_020B90A4: ; // 0x20b90a4
         /* 020B90A4 */ _t110 = cpu->r[29] + 0x00000238u;
         /* 020B90A4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t110);
-        /* 020B90A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[11]);
-        /* 020B90AC */ _t111 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B90A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[11]));
+        /* 020B90AC */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B90AC */ _t112 = _t111 & 0x00000001u;
         /* 020B90AC */ if (_t112) goto L_020B90B4; else goto L_020B90B0;
   L_020B90B0: ; // 0x20b90b0
@@ -18710,23 +18710,23 @@ void Gambit_fn_020B8D94(CPUState* cpu) {
         /* 020B912C */ _t123 = cpu->r[7] + 0x00000000u;
         /* 020B912C */ cpu->r[11] = rbrew_read8(cpu->mem, _t123);
         /* 020B9130 */ cpu->r[30] = 0x00000000u;
-        /* 020B9134 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[31]);
+        /* 020B9134 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[31]));
         /* 020B9138 */ cpu->r[8] = 0x00080000u;
-        /* 020B913C */ _t124 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B913C */ _t124 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B913C */ _t125 = _t124 & 0x00000001u;
         /* 020B913C */ if (_t125) goto L_020B9164; else goto L_020B9140;
   L_020B9140: ; // 0x20b9140
         /* 020B9140 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B9144 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[8]);
+        /* 020B9144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[8]));
         /* 020B9148 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 020B914C */ _t126 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B914C */ _t126 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B914C */ _t127 = _t126 & 0x00000001u;
         /* 020B914C */ if (_t127) goto L_020B9160; else goto L_020B9150;
   L_020B9150: ; // 0x20b9150
         /* 020B9150 */ _t128 = cpu->r[7] + 0x00000000u;
         /* 020B9150 */ cpu->r[0] = rbrew_read8(cpu->mem, _t128);
-        /* 020B9154 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020B9158 */ _t129 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9154 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020B9158 */ _t129 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9158 */ _t130 = _t129 & 0x00000001u;
         /* 020B9158 */ if (_t130) goto L_020B915C; else goto L_020B9140;
   L_020B915C: ; // 0x20b915c
@@ -18738,10 +18738,10 @@ void Gambit_fn_020B8D94(CPUState* cpu) {
         /* 020B9164 */ cpu->r[12] = rbrew_read32(cpu->mem, _t131);
         /* 020B9168 */ _t132 = cpu->r[1] + 0x00000010u;
         /* 020B9168 */ cpu->r[5] = rbrew_read32(cpu->mem, _t132);
-        /* 020B916C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[12]);
+        /* 020B916C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[12]));
         /* 020B9170 */ _t133 = cpu->r[5] + 0x00000014u;
         /* 020B9170 */ cpu->r[7] = rbrew_read32(cpu->mem, _t133);
-        /* 020B9174 */ _t134 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B9174 */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B9174 */ _t135 = _t134 & 0x00000001u;
         /* 020B9174 */ if (_t135) goto L_020B917C; else goto L_020B9178;
   L_020B9178: ; // 0x20b9178
@@ -18796,10 +18796,10 @@ void Gambit_fn_020B8D94(CPUState* cpu) {
         /* 020B91FC */ rbrew_write32(cpu->mem, _t149, cpu->r[0]);
         /* 020B9200 */ _t150 = cpu->r[27] + 0x00000014u;
         /* 020B9200 */ cpu->r[0] = rbrew_read32(cpu->mem, _t150);
-        /* 020B9204 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 020B9204 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 020B9208 */ _t151 = cpu->r[27] + 0x00000018u;
         /* 020B9208 */ cpu->r[26] = rbrew_read32(cpu->mem, _t151);
-        /* 020B920C */ _t152 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B920C */ _t152 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B920C */ _t153 = _t152 & 0x00000001u;
         /* 020B920C */ if (_t153) goto L_020B9210; else goto L_020B9214;
   L_020B9210: ; // 0x20b9210
@@ -18815,23 +18815,23 @@ void Gambit_fn_020B8D94(CPUState* cpu) {
         /* 020B9228 */ _t156 = cpu->r[12] + 0x00000000u;
         /* 020B9228 */ cpu->r[0] = rbrew_read8(cpu->mem, _t156);
         /* 020B922C */ cpu->r[30] = 0x00000000u;
-        /* 020B9230 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 020B9230 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 020B9234 */ cpu->r[6] = 0x00080000u;
-        /* 020B9238 */ _t157 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9238 */ _t157 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9238 */ _t158 = _t157 & 0x00000001u;
         /* 020B9238 */ if (_t158) goto L_020B9260; else goto L_020B923C;
   L_020B923C: ; // 0x20b923c
         /* 020B923C */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B9240 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[6]);
+        /* 020B9240 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[6]));
         /* 020B9244 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 020B9248 */ _t159 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B9248 */ _t159 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B9248 */ _t160 = _t159 & 0x00000001u;
         /* 020B9248 */ if (_t160) goto L_020B925C; else goto L_020B924C;
   L_020B924C: ; // 0x20b924c
         /* 020B924C */ _t161 = cpu->r[12] + 0x00000000u;
         /* 020B924C */ cpu->r[0] = rbrew_read8(cpu->mem, _t161);
-        /* 020B9250 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020B9254 */ _t162 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9250 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020B9254 */ _t162 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9254 */ _t163 = _t162 & 0x00000001u;
         /* 020B9254 */ if (_t163) goto L_020B9258; else goto L_020B923C;
   L_020B9258: ; // 0x20b9258
@@ -18843,10 +18843,10 @@ void Gambit_fn_020B8D94(CPUState* cpu) {
         /* 020B9260 */ cpu->r[5] = rbrew_read32(cpu->mem, _t164);
         /* 020B9264 */ _t165 = cpu->r[1] + 0x00000010u;
         /* 020B9264 */ cpu->r[12] = rbrew_read32(cpu->mem, _t165);
-        /* 020B9268 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[5]);
+        /* 020B9268 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[5]));
         /* 020B926C */ _t166 = cpu->r[12] + 0x00000014u;
         /* 020B926C */ cpu->r[0] = rbrew_read32(cpu->mem, _t166);
-        /* 020B9270 */ _t167 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B9270 */ _t167 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B9270 */ _t168 = _t167 & 0x00000001u;
         /* 020B9270 */ if (_t168) goto L_020B9278; else goto L_020B9274;
   L_020B9274: ; // 0x20b9274
@@ -18917,20 +18917,20 @@ void Gambit_fn_020B8D98(CPUState* cpu) {
         /* 020B8D9C */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020B8DA0 */ /* nop */
         /* 020B8DA4 */ cpu->r[29] = cpu->r[3];
-        /* 020B8DA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020B8DA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020B8DA8 */ cpu->r[30] = cpu->r[4];
         /* 020B8DAC */ cpu->r[31] = cpu->r[5];
         /* 020B8DB0 */ cpu->r[24] = cpu->r[6];
         /* 020B8DB4 */ cpu->r[25] = cpu->r[7];
-        /* 020B8DB8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8DB8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8DB8 */ _t3 = _t2 & 0x00000001u;
         /* 020B8DB8 */ if (_t3) goto L_020B8DBC; else goto L_020B8DCC;
   L_020B8DBC: ; // 0x20b8dbc
         /* 020B8DBC */ cpu->r[3] = 0x00000250u;
         /* 020B8DC0 */ Gambit_fn_02801A78(cpu);
         /* 020B8DC4 */ cpu->r[29] = cpu->r[3];
-        /* 020B8DC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020B8DC8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8DC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020B8DC8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8DC8 */ _t5 = _t4 & 0x00000001u;
         /* 020B8DC8 */ if (_t5) goto L_020B92F0; else goto L_020B8DCC;
   L_020B8DCC: ; // 0x20b8dcc
@@ -18966,22 +18966,22 @@ void Gambit_fn_020B8D98(CPUState* cpu) {
         /* 020B8E24 */ rbrew_write32(cpu->mem, _t12, cpu->r[6]);
         /* 020B8E28 */ cpu->r[8] = cpu->r[8] + 0x00004F38u;
         /* 020B8E2C */ cpu->r[27] = cpu->r[29] + 0x000001DCu;
-        /* 020B8E2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B8E2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B8E30 */ _t13 = cpu->r[29] + 0x0000001Cu;
         /* 020B8E30 */ rbrew_write32(cpu->mem, _t13, cpu->r[7]);
         /* 020B8E34 */ cpu->r[28] = 0x00000000u;
         /* 020B8E38 */ cpu->r[31] = cpu->r[27];
         /* 020B8E3C */ _t14 = cpu->r[29] + 0x000001C8u;
         /* 020B8E3C */ rbrew_write32(cpu->mem, _t14, cpu->r[8]);
-        /* 020B8E40 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8E40 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8E40 */ _t16 = _t15 & 0x00000001u;
         /* 020B8E40 */ if (_t16) goto L_020B8E44; else goto L_020B8E54;
   L_020B8E44: ; // 0x20b8e44
         /* 020B8E44 */ cpu->r[3] = 0x00000038u;
         /* 020B8E48 */ Gambit_fn_02801A78(cpu);
         /* 020B8E4C */ cpu->r[31] = cpu->r[3];
-        /* 020B8E4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020B8E50 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8E4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020B8E50 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8E50 */ _t18 = _t17 & 0x00000001u;
         /* 020B8E50 */ if (_t18) goto L_020B8E84; else goto L_020B8E54;
   L_020B8E54: ; // 0x20b8e54
@@ -19008,46 +19008,46 @@ void Gambit_fn_020B8D98(CPUState* cpu) {
   L_020B8E84: ; // 0x20b8e84
         /* 020B8E84 */ cpu->r[23] = 0x10010000u;
         /* 020B8E88 */ cpu->r[20] = cpu->r[29] + 0x00000214u;
-        /* 020B8E88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
+        /* 020B8E88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
         /* 020B8E8C */ cpu->r[30] = 0x10010000u;
         /* 020B8E90 */ cpu->r[23] = cpu->r[23] + 0x00004CE0u;
         /* 020B8E94 */ cpu->r[22] = 0x10010000u;
         /* 020B8E98 */ cpu->r[30] = cpu->r[30] + 0x00004CC8u;
         /* 020B8E9C */ cpu->r[31] = 0x10110000u;
         /* 020B8EA0 */ cpu->r[22] = cpu->r[22] + 0x00004CF8u;
-        /* 020B8EA4 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8EA4 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8EA4 */ _t28 = _t27 & 0x00000001u;
         /* 020B8EA4 */ if (_t28) goto L_020B8EA8; else goto L_020B8EC8;
   L_020B8EA8: ; // 0x20b8ea8
         /* 020B8EA8 */ cpu->r[3] = 0x0000001Cu;
         /* 020B8EAC */ Gambit_fn_02801A78(cpu);
         /* 020B8EB0 */ cpu->r[20] = cpu->r[3];
-        /* 020B8EB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
-        /* 020B8EB4 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8EB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
+        /* 020B8EB4 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8EB4 */ _t30 = _t29 & 0x00000001u;
         /* 020B8EB4 */ if (_t30) goto L_020B8EB8; else goto L_020B8EC8;
   L_020B8EB8: ; // 0x20b8eb8
         /* 020B8EB8 */ cpu->r[20] = cpu->r[29] + 0x00000230u;
-        /* 020B8EB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
+        /* 020B8EB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
         /* 020B8EBC */ _t31 = cpu->r[31] + 0x00007399u;
         /* 020B8EBC */ cpu->r[31] = rbrew_read8(cpu->mem, _t31);
-        /* 020B8EC0 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8EC0 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8EC0 */ _t33 = _t32 & 0x00000001u;
         /* 020B8EC0 */ if (_t33) goto L_020B8EC4; else goto L_020B8F5C;
   L_020B8EC4: ; // 0x20b8ec4
         /* 020B8EC4 */ goto L_020B8F4C;
   L_020B8EC8: ; // 0x20b8ec8
         /* 020B8EC8 */ cpu->r[21] = cpu->r[20];
-        /* 020B8EC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 020B8ECC */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8EC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 020B8ECC */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8ECC */ _t35 = _t34 & 0x00000001u;
         /* 020B8ECC */ if (_t35) goto L_020B8ED0; else goto L_020B8EEC;
   L_020B8ED0: ; // 0x20b8ed0
         /* 020B8ED0 */ cpu->r[3] = 0x0000001Cu;
         /* 020B8ED4 */ Gambit_fn_02801A78(cpu);
         /* 020B8ED8 */ cpu->r[21] = cpu->r[3];
-        /* 020B8ED8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 020B8EDC */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8ED8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 020B8EDC */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8EDC */ _t37 = _t36 & 0x00000001u;
         /* 020B8EDC */ if (_t37) goto L_020B8EE0; else goto L_020B8EEC;
   L_020B8EE0: ; // 0x20b8ee0
@@ -19058,15 +19058,15 @@ void Gambit_fn_020B8D98(CPUState* cpu) {
         /* 020B8EE8 */ goto L_020B8F44;
   L_020B8EEC: ; // 0x20b8eec
         /* 020B8EEC */ cpu->r[3] = cpu->r[21];
-        /* 020B8EEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B8EF0 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8EEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B8EF0 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8EF0 */ _t41 = _t40 & 0x00000001u;
         /* 020B8EF0 */ if (_t41) goto L_020B8EF4; else goto L_020B8F18;
   L_020B8EF4: ; // 0x20b8ef4
         /* 020B8EF4 */ cpu->r[3] = 0x0000000Cu;
         /* 020B8EF8 */ Gambit_fn_02801A78(cpu);
-        /* 020B8EFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B8F00 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8EFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B8F00 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8F00 */ _t43 = _t42 & 0x00000001u;
         /* 020B8F00 */ if (_t43) goto L_020B8F04; else goto L_020B8F18;
   L_020B8F04: ; // 0x20b8f04
@@ -19103,43 +19103,43 @@ void Gambit_fn_020B8D98(CPUState* cpu) {
         /* 020B8F40 */ rbrew_write32(cpu->mem, _t56, cpu->r[22]);
   L_020B8F44: ; // 0x20b8f44
         /* 020B8F44 */ cpu->r[20] = cpu->r[29] + 0x00000230u;
-        /* 020B8F44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
-        /* 020B8F48 */ _t57 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8F44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
+        /* 020B8F48 */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8F48 */ _t58 = _t57 & 0x00000001u;
         /* 020B8F48 */ if (_t58) goto L_020B8F4C; else goto L_020B8F5C;
   L_020B8F4C: ; // 0x20b8f4c
         /* 020B8F4C */ cpu->r[3] = 0x0000001Cu;
         /* 020B8F50 */ Gambit_fn_02801A78(cpu);
         /* 020B8F54 */ cpu->r[20] = cpu->r[3];
-        /* 020B8F54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
-        /* 020B8F58 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8F54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
+        /* 020B8F58 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8F58 */ _t60 = _t59 & 0x00000001u;
         /* 020B8F58 */ if (_t60) goto L_020B8FB4; else goto L_020B8F5C;
   L_020B8F5C: ; // 0x20b8f5c
         /* 020B8F5C */ cpu->r[21] = cpu->r[20];
-        /* 020B8F5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 020B8F60 */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8F5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 020B8F60 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8F60 */ _t62 = _t61 & 0x00000001u;
         /* 020B8F60 */ if (_t62) goto L_020B8F64; else goto L_020B8F74;
   L_020B8F64: ; // 0x20b8f64
         /* 020B8F64 */ cpu->r[3] = 0x0000001Cu;
         /* 020B8F68 */ Gambit_fn_02801A78(cpu);
         /* 020B8F6C */ cpu->r[21] = cpu->r[3];
-        /* 020B8F6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 020B8F70 */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8F6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 020B8F70 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8F70 */ _t64 = _t63 & 0x00000001u;
         /* 020B8F70 */ if (_t64) goto L_020B8FB0; else goto L_020B8F74;
   L_020B8F74: ; // 0x20b8f74
         /* 020B8F74 */ cpu->r[3] = cpu->r[21];
-        /* 020B8F74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B8F78 */ _t65 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8F74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B8F78 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8F78 */ _t66 = _t65 & 0x00000001u;
         /* 020B8F78 */ if (_t66) goto L_020B8F7C; else goto L_020B8F8C;
   L_020B8F7C: ; // 0x20b8f7c
         /* 020B8F7C */ cpu->r[3] = 0x0000000Cu;
         /* 020B8F80 */ Gambit_fn_02801A78(cpu);
-        /* 020B8F84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B8F88 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8F84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B8F88 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8F88 */ _t68 = _t67 & 0x00000001u;
         /* 020B8F88 */ if (_t68) goto L_020B8FA4; else goto L_020B8F8C;
   L_020B8F8C: ; // 0x20b8f8c
@@ -19183,23 +19183,23 @@ void Gambit_fn_020B8D98(CPUState* cpu) {
         /* 020B8FDC */ _t83 = cpu->r[6] + 0x00000000u;
         /* 020B8FDC */ cpu->r[0] = rbrew_read8(cpu->mem, _t83);
         /* 020B8FE0 */ cpu->r[30] = 0x00000000u;
-        /* 020B8FE4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 020B8FE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 020B8FE8 */ cpu->r[0] = 0x00080000u;
-        /* 020B8FEC */ _t84 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B8FEC */ _t84 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B8FEC */ _t85 = _t84 & 0x00000001u;
         /* 020B8FEC */ if (_t85) goto L_020B9014; else goto L_020B8FF0;
   L_020B8FF0: ; // 0x20b8ff0
         /* 020B8FF0 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B8FF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 020B8FF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 020B8FF8 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 020B8FFC */ _t86 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B8FFC */ _t86 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B8FFC */ _t87 = _t86 & 0x00000001u;
         /* 020B8FFC */ if (_t87) goto L_020B9010; else goto L_020B9000;
   L_020B9000: ; // 0x20b9000
         /* 020B9000 */ _t88 = cpu->r[6] + 0x00000000u;
         /* 020B9000 */ cpu->r[12] = rbrew_read8(cpu->mem, _t88);
-        /* 020B9004 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[31]);
-        /* 020B9008 */ _t89 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9004 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[31]));
+        /* 020B9008 */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9008 */ _t90 = _t89 & 0x00000001u;
         /* 020B9008 */ if (_t90) goto L_020B900C; else goto L_020B8FF0;
   L_020B900C: ; // 0x20b900c
@@ -19211,10 +19211,10 @@ void Gambit_fn_020B8D98(CPUState* cpu) {
         /* 020B9014 */ cpu->r[10] = rbrew_read32(cpu->mem, _t91);
         /* 020B9018 */ _t92 = cpu->r[24] + 0x00000004u;
         /* 020B9018 */ cpu->r[5] = rbrew_read32(cpu->mem, _t92);
-        /* 020B901C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[10]);
+        /* 020B901C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[10]));
         /* 020B9020 */ _t93 = cpu->r[5] + 0x00000014u;
         /* 020B9020 */ cpu->r[6] = rbrew_read32(cpu->mem, _t93);
-        /* 020B9024 */ _t94 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B9024 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B9024 */ _t95 = _t94 & 0x00000001u;
         /* 020B9024 */ if (_t95) goto L_020B902C; else goto L_020B9028;
   L_020B9028: ; // 0x20b9028
@@ -19245,23 +19245,23 @@ void Gambit_fn_020B8D98(CPUState* cpu) {
         /* 020B906C */ _t102 = cpu->r[10] + 0x00000000u;
         /* 020B906C */ cpu->r[9] = rbrew_read8(cpu->mem, _t102);
         /* 020B9070 */ cpu->r[30] = 0x00000000u;
-        /* 020B9074 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[31]);
+        /* 020B9074 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[31]));
         /* 020B9078 */ cpu->r[12] = 0x00080000u;
-        /* 020B907C */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B907C */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B907C */ _t104 = _t103 & 0x00000001u;
         /* 020B907C */ if (_t104) goto L_020B90A4; else goto L_020B9080;
   L_020B9080: ; // 0x20b9080
         /* 020B9080 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B9084 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[12]);
+        /* 020B9084 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[12]));
         /* 020B9088 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 020B908C */ _t105 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B908C */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B908C */ _t106 = _t105 & 0x00000001u;
         /* 020B908C */ if (_t106) goto L_020B90A0; else goto L_020B9090;
   L_020B9090: ; // 0x20b9090
         /* 020B9090 */ _t107 = cpu->r[10] + 0x00000000u;
         /* 020B9090 */ cpu->r[0] = rbrew_read8(cpu->mem, _t107);
-        /* 020B9094 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020B9098 */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9094 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020B9098 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9098 */ _t109 = _t108 & 0x00000001u;
         /* 020B9098 */ if (_t109) goto L_020B909C; else goto L_020B9080;
   L_020B909C: ; // 0x20b909c
@@ -19271,8 +19271,8 @@ void Gambit_fn_020B8D98(CPUState* cpu) {
   L_020B90A4: ; // 0x20b90a4
         /* 020B90A4 */ _t110 = cpu->r[29] + 0x00000238u;
         /* 020B90A4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t110);
-        /* 020B90A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[11]);
-        /* 020B90AC */ _t111 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B90A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[11]));
+        /* 020B90AC */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B90AC */ _t112 = _t111 & 0x00000001u;
         /* 020B90AC */ if (_t112) goto L_020B90B4; else goto L_020B90B0;
   L_020B90B0: ; // 0x20b90b0
@@ -19321,23 +19321,23 @@ void Gambit_fn_020B8D98(CPUState* cpu) {
         /* 020B912C */ _t123 = cpu->r[7] + 0x00000000u;
         /* 020B912C */ cpu->r[11] = rbrew_read8(cpu->mem, _t123);
         /* 020B9130 */ cpu->r[30] = 0x00000000u;
-        /* 020B9134 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[31]);
+        /* 020B9134 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[31]));
         /* 020B9138 */ cpu->r[8] = 0x00080000u;
-        /* 020B913C */ _t124 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B913C */ _t124 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B913C */ _t125 = _t124 & 0x00000001u;
         /* 020B913C */ if (_t125) goto L_020B9164; else goto L_020B9140;
   L_020B9140: ; // 0x20b9140
         /* 020B9140 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B9144 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[8]);
+        /* 020B9144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[8]));
         /* 020B9148 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 020B914C */ _t126 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B914C */ _t126 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B914C */ _t127 = _t126 & 0x00000001u;
         /* 020B914C */ if (_t127) goto L_020B9160; else goto L_020B9150;
   L_020B9150: ; // 0x20b9150
         /* 020B9150 */ _t128 = cpu->r[7] + 0x00000000u;
         /* 020B9150 */ cpu->r[0] = rbrew_read8(cpu->mem, _t128);
-        /* 020B9154 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020B9158 */ _t129 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9154 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020B9158 */ _t129 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9158 */ _t130 = _t129 & 0x00000001u;
         /* 020B9158 */ if (_t130) goto L_020B915C; else goto L_020B9140;
   L_020B915C: ; // 0x20b915c
@@ -19349,10 +19349,10 @@ void Gambit_fn_020B8D98(CPUState* cpu) {
         /* 020B9164 */ cpu->r[12] = rbrew_read32(cpu->mem, _t131);
         /* 020B9168 */ _t132 = cpu->r[1] + 0x00000010u;
         /* 020B9168 */ cpu->r[5] = rbrew_read32(cpu->mem, _t132);
-        /* 020B916C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[12]);
+        /* 020B916C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[12]));
         /* 020B9170 */ _t133 = cpu->r[5] + 0x00000014u;
         /* 020B9170 */ cpu->r[7] = rbrew_read32(cpu->mem, _t133);
-        /* 020B9174 */ _t134 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B9174 */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B9174 */ _t135 = _t134 & 0x00000001u;
         /* 020B9174 */ if (_t135) goto L_020B917C; else goto L_020B9178;
   L_020B9178: ; // 0x20b9178
@@ -19407,10 +19407,10 @@ void Gambit_fn_020B8D98(CPUState* cpu) {
         /* 020B91FC */ rbrew_write32(cpu->mem, _t149, cpu->r[0]);
         /* 020B9200 */ _t150 = cpu->r[27] + 0x00000014u;
         /* 020B9200 */ cpu->r[0] = rbrew_read32(cpu->mem, _t150);
-        /* 020B9204 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 020B9204 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 020B9208 */ _t151 = cpu->r[27] + 0x00000018u;
         /* 020B9208 */ cpu->r[26] = rbrew_read32(cpu->mem, _t151);
-        /* 020B920C */ _t152 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B920C */ _t152 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B920C */ _t153 = _t152 & 0x00000001u;
         /* 020B920C */ if (_t153) goto L_020B9210; else goto L_020B9214;
   L_020B9210: ; // 0x20b9210
@@ -19426,23 +19426,23 @@ void Gambit_fn_020B8D98(CPUState* cpu) {
         /* 020B9228 */ _t156 = cpu->r[12] + 0x00000000u;
         /* 020B9228 */ cpu->r[0] = rbrew_read8(cpu->mem, _t156);
         /* 020B922C */ cpu->r[30] = 0x00000000u;
-        /* 020B9230 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 020B9230 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 020B9234 */ cpu->r[6] = 0x00080000u;
-        /* 020B9238 */ _t157 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9238 */ _t157 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9238 */ _t158 = _t157 & 0x00000001u;
         /* 020B9238 */ if (_t158) goto L_020B9260; else goto L_020B923C;
   L_020B923C: ; // 0x20b923c
         /* 020B923C */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020B9240 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[6]);
+        /* 020B9240 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[6]));
         /* 020B9244 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 020B9248 */ _t159 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B9248 */ _t159 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B9248 */ _t160 = _t159 & 0x00000001u;
         /* 020B9248 */ if (_t160) goto L_020B925C; else goto L_020B924C;
   L_020B924C: ; // 0x20b924c
         /* 020B924C */ _t161 = cpu->r[12] + 0x00000000u;
         /* 020B924C */ cpu->r[0] = rbrew_read8(cpu->mem, _t161);
-        /* 020B9250 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020B9254 */ _t162 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9250 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020B9254 */ _t162 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9254 */ _t163 = _t162 & 0x00000001u;
         /* 020B9254 */ if (_t163) goto L_020B9258; else goto L_020B923C;
   L_020B9258: ; // 0x20b9258
@@ -19454,10 +19454,10 @@ void Gambit_fn_020B8D98(CPUState* cpu) {
         /* 020B9260 */ cpu->r[5] = rbrew_read32(cpu->mem, _t164);
         /* 020B9264 */ _t165 = cpu->r[1] + 0x00000010u;
         /* 020B9264 */ cpu->r[12] = rbrew_read32(cpu->mem, _t165);
-        /* 020B9268 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[5]);
+        /* 020B9268 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[5]));
         /* 020B926C */ _t166 = cpu->r[12] + 0x00000014u;
         /* 020B926C */ cpu->r[0] = rbrew_read32(cpu->mem, _t166);
-        /* 020B9270 */ _t167 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B9270 */ _t167 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B9270 */ _t168 = _t167 & 0x00000001u;
         /* 020B9270 */ if (_t168) goto L_020B9278; else goto L_020B9274;
   L_020B9274: ; // 0x20b9274
@@ -19544,8 +19544,8 @@ void Gambit_fn_020B9314(CPUState* cpu) {
         /* 020B9328 */ _t3 = cpu->r[31] + 0x00000118u;
         /* 020B9328 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
         /* 020B932C */ cpu->r[10] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 020B932C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020B9330 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B932C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020B9330 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9330 */ _t5 = _t4 & 0x00000001u;
         /* 020B9330 */ if (_t5) goto L_020B933C; else goto L_020B9334;
   L_020B9334: ; // 0x20b9334
@@ -19599,8 +19599,8 @@ void Gambit_fn_020B9318(CPUState* cpu) {
         /* 020B9328 */ _t3 = cpu->r[31] + 0x00000118u;
         /* 020B9328 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
         /* 020B932C */ cpu->r[10] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 020B932C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020B9330 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B932C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020B9330 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9330 */ _t5 = _t4 & 0x00000001u;
         /* 020B9330 */ if (_t5) goto L_020B933C; else goto L_020B9334;
   L_020B9334: ; // 0x20b9334
@@ -19914,8 +19914,8 @@ void Gambit_fn_020B94CC(CPUState* cpu) {
         /* 020B94D8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020B94DC */ _t3 = cpu->r[31] + 0x000001E4u;
         /* 020B94DC */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 020B94E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B94E4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B94E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B94E4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B94E4 */ _t5 = _t4 & 0x00000001u;
         /* 020B94E4 */ if (_t5) goto L_020B94E8; else goto L_020B9510;
   L_020B94E8: ; // 0x20b94e8
@@ -19939,8 +19939,8 @@ void Gambit_fn_020B94CC(CPUState* cpu) {
         /* 020B9518 */ cpu->r[4] = cpu->r[3];
         /* 020B951C */ cpu->r[3] = cpu->r[31];
         /* 020B9520 */ Gambit_fn_027EDF00(cpu);
-        /* 020B9524 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B9528 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B9528 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9528 */ _t11 = _t10 & 0x00000001u;
         /* 020B9528 */ if (_t11) goto L_020B9540; else goto L_020B952C;
   L_020B952C: ; // 0x20b952c
@@ -19966,15 +19966,15 @@ void Gambit_fn_020B9554(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B9554: ; // 0x20b9554
-        /* 020B9554 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B9558 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9554 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B9558 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9558 */ _t1 = _t0 & 0x00000001u;
         /* 020B9558 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B9558 */ goto L_020B955C;
   L_020B955C: ; // 0x20b955c
         /* 020B955C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B955C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B9560 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B955C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B9560 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9560 */ _t3 = _t2 & 0x00000001u;
         /* 020B9560 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B9560 */ goto L_020B9564;
@@ -19993,8 +19993,8 @@ void Gambit_fn_020B9554(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -20008,15 +20008,15 @@ void Gambit_fn_020B9554(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -20044,15 +20044,15 @@ void Gambit_fn_020B9568(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B9568: ; // 0x20b9568
-        /* 020B9568 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B956C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9568 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B956C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B956C */ _t1 = _t0 & 0x00000001u;
         /* 020B956C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B956C */ goto L_020B9570;
   L_020B9570: ; // 0x20b9570
         /* 020B9570 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B9570 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B9574 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9570 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B9574 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9574 */ _t3 = _t2 & 0x00000001u;
         /* 020B9574 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B9574 */ goto L_020B9578;
@@ -20071,8 +20071,8 @@ void Gambit_fn_020B9568(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -20086,15 +20086,15 @@ void Gambit_fn_020B9568(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -20131,11 +20131,11 @@ void Gambit_fn_020B957C(CPUState* cpu) {
         /* 020B9588 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020B9588 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020B958C */ cpu->r[30] = cpu->r[3];
-        /* 020B958C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020B958C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020B9590 */ cpu->r[31] = cpu->r[4];
         /* 020B9594 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020B9594 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020B9598 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9598 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9598 */ _t5 = _t4 & 0x00000001u;
         /* 020B9598 */ if (_t5) goto L_020B95DC; else goto L_020B959C;
   L_020B959C: ; // 0x20b959c
@@ -20155,8 +20155,8 @@ void Gambit_fn_020B957C(CPUState* cpu) {
         /* 020B95C4 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020B95C8 */ Gambit_fn_02068798(cpu);
         /* 020B95CC */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B95CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B95D0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B95CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B95D0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B95D0 */ _t10 = _t9 & 0x00000001u;
         /* 020B95D0 */ if (_t10) goto L_020B95DC; else goto L_020B95D4;
   L_020B95D4: ; // 0x20b95d4
@@ -20187,11 +20187,11 @@ void Gambit_fn_020B9580(CPUState* cpu) {
         /* 020B9588 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020B9588 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020B958C */ cpu->r[30] = cpu->r[3];
-        /* 020B958C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020B958C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020B9590 */ cpu->r[31] = cpu->r[4];
         /* 020B9594 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020B9594 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020B9598 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9598 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9598 */ _t5 = _t4 & 0x00000001u;
         /* 020B9598 */ if (_t5) goto L_020B95DC; else goto L_020B959C;
   L_020B959C: ; // 0x20b959c
@@ -20211,8 +20211,8 @@ void Gambit_fn_020B9580(CPUState* cpu) {
         /* 020B95C4 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020B95C8 */ Gambit_fn_02068798(cpu);
         /* 020B95CC */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B95CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B95D0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B95CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B95D0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B95D0 */ _t10 = _t9 & 0x00000001u;
         /* 020B95D0 */ if (_t10) goto L_020B95DC; else goto L_020B95D4;
   L_020B95D4: ; // 0x20b95d4
@@ -20267,15 +20267,15 @@ void Gambit_fn_020B960C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B960C: ; // 0x20b960c
-        /* 020B960C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B9610 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B960C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B9610 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9610 */ _t1 = _t0 & 0x00000001u;
         /* 020B9610 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B9610 */ goto L_020B9614;
   L_020B9614: ; // 0x20b9614
         /* 020B9614 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B9614 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B9618 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9614 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B9618 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9618 */ _t3 = _t2 & 0x00000001u;
         /* 020B9618 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B9618 */ goto L_020B961C;
@@ -20294,8 +20294,8 @@ void Gambit_fn_020B960C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -20309,15 +20309,15 @@ void Gambit_fn_020B960C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -20363,15 +20363,15 @@ void Gambit_fn_020B963C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B963C: ; // 0x20b963c
-        /* 020B963C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B9640 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B963C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B9640 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9640 */ _t1 = _t0 & 0x00000001u;
         /* 020B9640 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B9640 */ goto L_020B9644;
   L_020B9644: ; // 0x20b9644
         /* 020B9644 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B9644 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B9648 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9644 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B9648 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9648 */ _t3 = _t2 & 0x00000001u;
         /* 020B9648 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B9648 */ goto L_020B964C;
@@ -20390,8 +20390,8 @@ void Gambit_fn_020B963C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -20405,15 +20405,15 @@ void Gambit_fn_020B963C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -20441,15 +20441,15 @@ void Gambit_fn_020B9650(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B9650: ; // 0x20b9650
-        /* 020B9650 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B9654 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9650 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B9654 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9654 */ _t1 = _t0 & 0x00000001u;
         /* 020B9654 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B9654 */ goto L_020B9658;
   L_020B9658: ; // 0x20b9658
         /* 020B9658 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B9658 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B965C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9658 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B965C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B965C */ _t3 = _t2 & 0x00000001u;
         /* 020B965C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B965C */ goto L_020B9660;
@@ -20468,8 +20468,8 @@ void Gambit_fn_020B9650(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -20483,15 +20483,15 @@ void Gambit_fn_020B9650(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -20519,15 +20519,15 @@ void Gambit_fn_020B9664(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020B9664: ; // 0x20b9664
-        /* 020B9664 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B9668 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9664 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B9668 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9668 */ _t1 = _t0 & 0x00000001u;
         /* 020B9668 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B9668 */ goto L_020B966C;
   L_020B966C: ; // 0x20b966c
         /* 020B966C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020B966C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020B9670 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B966C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020B9670 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9670 */ _t3 = _t2 & 0x00000001u;
         /* 020B9670 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B9670 */ goto L_020B9674;
@@ -20546,8 +20546,8 @@ void Gambit_fn_020B9664(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -20561,15 +20561,15 @@ void Gambit_fn_020B9664(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -20675,9 +20675,9 @@ void Gambit_fn_020B96B8(CPUState* cpu) {
         /* 020B96BC */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 020B96BC */ cpu->r[9] = _t0;
         /* 020B96C0 */ cpu->r[12] = 0x101D0000u;
-        /* 020B96C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 020B96C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 020B96C8 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 020B96CC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B96CC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B96CC */ _t2 = _t1 & 0x00000001u;
         /* 020B96CC */ if (_t2) goto L_020B96D0; else goto L_020B96E4;
   L_020B96D0: ; // 0x20b96d0
@@ -20689,8 +20689,8 @@ void Gambit_fn_020B96B8(CPUState* cpu) {
         /* 020B96E0 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 020B96E0 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_020B96E4: ; // 0x20b96e4
-        /* 020B96E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 020B96E8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B96E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 020B96E8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B96E8 */ _t6 = _t5 & 0x00000001u;
         /* 020B96E8 */ if (_t6) goto L_020B96EC; else goto L_020B96F4;
   L_020B96EC: ; // 0x20b96ec
@@ -20702,9 +20702,9 @@ void Gambit_fn_020B96B8(CPUState* cpu) {
         /* 020B96F8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 020B96F8 */ cpu->r[7] = _t7;
         /* 020B96FC */ cpu->r[11] = 0x101D0000u;
-        /* 020B9700 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020B9700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020B9704 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 020B9708 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9708 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9708 */ _t9 = _t8 & 0x00000001u;
         /* 020B9708 */ if (_t9) goto L_020B970C; else goto L_020B9720;
   L_020B970C: ; // 0x20b970c
@@ -20867,18 +20867,18 @@ void Gambit_fn_020B97A0(CPUState* cpu) {
         /* 020B9D08 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 020B9D08 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 020B9D0C */ cpu->r[12] = 0x00000000u;
-        /* 020B9D10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020B9D10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020B9D14 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 020B9D14 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 020B9D18 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9D18 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9D18 */ _t6 = _t5 & 0x00000001u;
         /* 020B9D18 */ if (_t6) goto L_020B9D40; else goto L_020B9D1C;
   L_020B9D1C: ; // 0x20b9d1c
         /* 020B9D1C */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 020B9D1C */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 020B9D20 */ /* nop */
-        /* 020B9D24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 020B9D28 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9D24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 020B9D28 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9D28 */ _t9 = _t8 & 0x00000001u;
         /* 020B9D28 */ if (_t9) goto L_020B9D2C; else goto L_020B9D40;
   L_020B9D2C: ; // 0x20b9d2c
@@ -20923,10 +20923,10 @@ void Gambit_fn_020B97AC(CPUState* cpu) {
         /* 020B97CC */ cpu->r[31] = 0x101D0000u;
         /* 020B97D0 */ _t3 = cpu->r[28] + 0x0000001Cu;
         /* 020B97D0 */ rbrew_write32(cpu->mem, _t3, cpu->r[4]);
-        /* 020B97D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B97D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B97D8 */ _t4 = cpu->r[28] + 0x0000000Fu;
         /* 020B97D8 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[27]);
-        /* 020B97DC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B97DC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B97DC */ _t6 = _t5 & 0x00000001u;
         /* 020B97DC */ if (_t6) goto L_020B9820; else goto L_020B97E0;
   L_020B97E0: ; // 0x20b97e0
@@ -20941,16 +20941,16 @@ void Gambit_fn_020B97AC(CPUState* cpu) {
         /* 020B97F4 */ cpu->r[5] = 0x00000004u;
         /* 020B97F8 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020B97FC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020B9800 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B9800 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B9804 */ cpu->r[0] = cpu->r[27];
-        /* 020B9808 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B9808 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B9808 */ _t11 = _t10 & 0x00000001u;
         /* 020B9808 */ if (_t11) goto L_020B9810; else goto L_020B980C;
   L_020B980C: ; // 0x20b980c
         /* 020B980C */ cpu->r[0] = 0x00000001u;
   L_020B9810: ; // 0x20b9810
-        /* 020B9810 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B9814 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9810 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B9814 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9814 */ _t13 = _t12 & 0x00000001u;
         /* 020B9814 */ if (_t13) goto L_020B9820; else goto L_020B9818;
   L_020B9818: ; // 0x20b9818
@@ -20962,9 +20962,9 @@ void Gambit_fn_020B97AC(CPUState* cpu) {
         /* 020B9820 */ _t16 = cpu->r[28] + 0x00000020u;
         /* 020B9820 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 020B9824 */ cpu->r[0] = 0x00000000u;
-        /* 020B9828 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 020B9828 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 020B982C */ cpu->r[12] = cpu->r[0];
-        /* 020B9830 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B9830 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B9830 */ _t18 = _t17 & 0x00000001u;
         /* 020B9830 */ if (_t18) goto L_020B9834; else goto L_020B9858;
   L_020B9834: ; // 0x20b9834
@@ -20989,8 +20989,8 @@ void Gambit_fn_020B97AC(CPUState* cpu) {
   L_020B9858: ; // 0x20b9858
         /* 020B9858 */ _t26 = cpu->r[28] + 0x0000000Fu;
         /* 020B9858 */ cpu->r[27] = rbrew_read8(cpu->mem, _t26);
-        /* 020B985C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020B9860 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B985C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020B9860 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9860 */ _t28 = _t27 & 0x00000001u;
         /* 020B9860 */ if (_t28) goto L_020B98A4; else goto L_020B9864;
   L_020B9864: ; // 0x20b9864
@@ -21005,16 +21005,16 @@ void Gambit_fn_020B97AC(CPUState* cpu) {
         /* 020B9878 */ cpu->r[5] = 0x00000004u;
         /* 020B987C */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020B9880 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020B9884 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B9884 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B9888 */ cpu->r[11] = cpu->r[27];
-        /* 020B988C */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B988C */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B988C */ _t33 = _t32 & 0x00000001u;
         /* 020B988C */ if (_t33) goto L_020B9894; else goto L_020B9890;
   L_020B9890: ; // 0x20b9890
         /* 020B9890 */ cpu->r[11] = 0x00000001u;
   L_020B9894: ; // 0x20b9894
-        /* 020B9894 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B9898 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9894 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B9898 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9898 */ _t35 = _t34 & 0x00000001u;
         /* 020B9898 */ if (_t35) goto L_020B98A4; else goto L_020B989C;
   L_020B989C: ; // 0x20b989c
@@ -21026,9 +21026,9 @@ void Gambit_fn_020B97AC(CPUState* cpu) {
         /* 020B98A4 */ _t38 = cpu->r[28] + 0x00000028u;
         /* 020B98A4 */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 020B98A8 */ cpu->r[0] = 0x00000000u;
-        /* 020B98AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 020B98AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 020B98B0 */ cpu->r[12] = cpu->r[0];
-        /* 020B98B4 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B98B4 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B98B4 */ _t40 = _t39 & 0x00000001u;
         /* 020B98B4 */ if (_t40) goto L_020B98B8; else goto L_020B98DC;
   L_020B98B8: ; // 0x20b98b8
@@ -21053,8 +21053,8 @@ void Gambit_fn_020B97AC(CPUState* cpu) {
   L_020B98DC: ; // 0x20b98dc
         /* 020B98DC */ _t48 = cpu->r[28] + 0x0000000Fu;
         /* 020B98DC */ cpu->r[27] = rbrew_read8(cpu->mem, _t48);
-        /* 020B98E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020B98E4 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B98E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020B98E4 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B98E4 */ _t50 = _t49 & 0x00000001u;
         /* 020B98E4 */ if (_t50) goto L_020B9928; else goto L_020B98E8;
   L_020B98E8: ; // 0x20b98e8
@@ -21069,16 +21069,16 @@ void Gambit_fn_020B97AC(CPUState* cpu) {
         /* 020B98FC */ cpu->r[5] = 0x00000004u;
         /* 020B9900 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020B9904 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020B9908 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B9908 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B990C */ cpu->r[10] = cpu->r[27];
-        /* 020B9910 */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B9910 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B9910 */ _t55 = _t54 & 0x00000001u;
         /* 020B9910 */ if (_t55) goto L_020B9918; else goto L_020B9914;
   L_020B9914: ; // 0x20b9914
         /* 020B9914 */ cpu->r[10] = 0x00000001u;
   L_020B9918: ; // 0x20b9918
-        /* 020B9918 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B991C */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B991C */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B991C */ _t57 = _t56 & 0x00000001u;
         /* 020B991C */ if (_t57) goto L_020B9928; else goto L_020B9920;
   L_020B9920: ; // 0x20b9920
@@ -21090,9 +21090,9 @@ void Gambit_fn_020B97AC(CPUState* cpu) {
         /* 020B9928 */ _t60 = cpu->r[28] + 0x00000030u;
         /* 020B9928 */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
         /* 020B992C */ cpu->r[0] = 0x00000000u;
-        /* 020B9930 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 020B9930 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 020B9934 */ cpu->r[5] = cpu->r[0];
-        /* 020B9938 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B9938 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B9938 */ _t62 = _t61 & 0x00000001u;
         /* 020B9938 */ if (_t62) goto L_020B993C; else goto L_020B9960;
   L_020B993C: ; // 0x20b993c
@@ -21117,8 +21117,8 @@ void Gambit_fn_020B97AC(CPUState* cpu) {
   L_020B9960: ; // 0x20b9960
         /* 020B9960 */ _t70 = cpu->r[30] + 0x00000000u;
         /* 020B9960 */ cpu->r[25] = rbrew_read8(cpu->mem, _t70);
-        /* 020B9964 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 020B9968 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9964 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 020B9968 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9968 */ _t72 = _t71 & 0x00000001u;
         /* 020B9968 */ if (_t72) goto L_020B9A44; else goto L_020B996C;
   L_020B996C: ; // 0x20b996c
@@ -21134,10 +21134,10 @@ void Gambit_fn_020B97AC(CPUState* cpu) {
         /* 020B9984 */ cpu->r[4] = (uint32_t)((int32_t)cpu->r[25] * (int32_t)0x00000024u);
         /* 020B9988 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020B998C */ cpu->r[24] = cpu->r[3];
-        /* 020B9990 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 020B9990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 020B9994 */ cpu->r[30] = cpu->r[25];
         /* 020B9998 */ cpu->r[7] = 0x00000000u;
-        /* 020B999C */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B999C */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B999C */ _t77 = _t76 & 0x00000001u;
         /* 020B999C */ if (_t77) goto L_020B99A4; else goto L_020B99A0;
   L_020B99A0: ; // 0x20b99a0
@@ -21150,36 +21150,36 @@ void Gambit_fn_020B97AC(CPUState* cpu) {
         /* 020B99B0 */ cpu->r[23] = 0x00000018u;
   L_020B99B4: ; // 0x20b99b4
         /* 020B99B4 */ cpu->r[27] = cpu->r[24] + cpu->r[22];
-        /* 020B99B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020B99B8 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B99B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020B99B8 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B99B8 */ _t80 = _t79 & 0x00000001u;
         /* 020B99B8 */ if (_t80) goto L_020B9A28; else goto L_020B99BC;
   L_020B99BC: ; // 0x20b99bc
         /* 020B99BC */ cpu->r[26] = cpu->r[27];
-        /* 020B99BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 020B99C0 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B99BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 020B99C0 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B99C0 */ _t82 = _t81 & 0x00000001u;
         /* 020B99C0 */ if (_t82) goto L_020B99C4; else goto L_020B99D4;
   L_020B99C4: ; // 0x20b99c4
         /* 020B99C4 */ cpu->r[3] = 0x00000024u;
         /* 020B99C8 */ Gambit_fn_02801A78(cpu);
         /* 020B99CC */ cpu->r[26] = cpu->r[3];
-        /* 020B99CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 020B99D0 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B99CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 020B99D0 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B99D0 */ _t84 = _t83 & 0x00000001u;
         /* 020B99D0 */ if (_t84) goto L_020B9A1C; else goto L_020B99D4;
   L_020B99D4: ; // 0x20b99d4
         /* 020B99D4 */ cpu->r[11] = cpu->r[26];
-        /* 020B99D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020B99D8 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B99D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020B99D8 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B99D8 */ _t86 = _t85 & 0x00000001u;
         /* 020B99D8 */ if (_t86) goto L_020B99DC; else goto L_020B99EC;
   L_020B99DC: ; // 0x20b99dc
         /* 020B99DC */ cpu->r[3] = 0x0000000Cu;
         /* 020B99E0 */ Gambit_fn_02801A78(cpu);
         /* 020B99E4 */ cpu->r[11] = cpu->r[3];
-        /* 020B99E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020B99E8 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B99E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020B99E8 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B99E8 */ _t88 = _t87 & 0x00000001u;
         /* 020B99E8 */ if (_t88) goto L_020B9A08; else goto L_020B99EC;
   L_020B99EC: ; // 0x20b99ec
@@ -21210,14 +21210,14 @@ void Gambit_fn_020B97AC(CPUState* cpu) {
         /* 020B9A24 */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
   L_020B9A28: ; // 0x20b9a28
         /* 020B9A28 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 020B9A28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020B9A28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020B9A2C */ cpu->r[22] = cpu->r[22] + 0x00000024u;
-        /* 020B9A30 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9A30 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9A30 */ _t98 = _t97 & 0x00000001u;
         /* 020B9A30 */ if (_t98) goto L_020B9A34; else goto L_020B99B4;
   L_020B9A34: ; // 0x20b9a34
-        /* 020B9A34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 020B9A38 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9A34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 020B9A38 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9A38 */ _t100 = _t99 & 0x00000001u;
         /* 020B9A38 */ if (_t100) goto L_020B9A44; else goto L_020B9A3C;
   L_020B9A3C: ; // 0x20b9a3c
@@ -21247,10 +21247,10 @@ void Gambit_fn_020B9A5C(CPUState* cpu) {
         /* 020B9A60 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 020B9A64 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 020B9A64 */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 020B9A68 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[12]);
+        /* 020B9A68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[12]));
         /* 020B9A6C */ _t3 = cpu->r[4] + 0x00000000u;
         /* 020B9A6C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 020B9A70 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B9A70 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B9A70 */ _t5 = _t4 & 0x00000001u;
         /* 020B9A70 */ if (_t5) goto L_020B9A74; else goto L_020B9A7C;
   L_020B9A74: ; // 0x20b9a74
@@ -21267,10 +21267,10 @@ void Gambit_fn_020B9A5C(CPUState* cpu) {
         /* 020B9A88 */ cpu->r[9] = rbrew_read8(cpu->mem, _t9);
         /* 020B9A8C */ _t10 = cpu->r[3] + 0x00000028u;
         /* 020B9A8C */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 020B9A90 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
+        /* 020B9A90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
         /* 020B9A94 */ _t11 = cpu->r[3] + 0x0000002Cu;
         /* 020B9A94 */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
-        /* 020B9A98 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B9A98 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B9A98 */ _t13 = _t12 & 0x00000001u;
         /* 020B9A98 */ if (_t13) goto L_020B9A9C; else goto L_020B9AA4;
   L_020B9A9C: ; // 0x20b9a9c
@@ -21291,10 +21291,10 @@ void Gambit_fn_020B9A5C(CPUState* cpu) {
         /* 020B9AB8 */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
         /* 020B9ABC */ _t20 = cpu->r[3] + 0x00000034u;
         /* 020B9ABC */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 020B9AC0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
+        /* 020B9AC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
         /* 020B9AC4 */ _t21 = cpu->r[6] + 0x00000000u;
         /* 020B9AC4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
-        /* 020B9AC8 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B9AC8 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B9AC8 */ _t23 = _t22 & 0x00000001u;
         /* 020B9AC8 */ if (_t23) goto L_020B9ACC; else goto L_020B9AD4;
   L_020B9ACC: ; // 0x20b9acc
@@ -21321,10 +21321,10 @@ void Gambit_fn_020B9AE4(CPUState* cpu) {
         /* 020B9AEC */ _t1 = cpu->r[3] + 0x00000030u;
         /* 020B9AEC */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 020B9AF0 */ cpu->r[7] = cpu->r[0];
-        /* 020B9AF4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 020B9AF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 020B9AF8 */ _t2 = cpu->r[3] + 0x00000034u;
         /* 020B9AF8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 020B9AFC */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B9AFC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B9AFC */ _t4 = _t3 & 0x00000001u;
         /* 020B9AFC */ if (_t4) goto L_020B9B00; else goto L_020B9B18;
   L_020B9B00: ; // 0x20b9b00
@@ -21332,8 +21332,8 @@ void Gambit_fn_020B9AE4(CPUState* cpu) {
         /* 020B9B04 */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 020B9B08 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 020B9B08 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 020B9B0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020B9B10 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9B0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020B9B10 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9B10 */ _t7 = _t6 & 0x00000001u;
         /* 020B9B10 */ if (_t7) goto L_020B9B14; else goto L_020B9B24;
   L_020B9B14: ; // 0x20b9b14
@@ -21341,16 +21341,16 @@ void Gambit_fn_020B9AE4(CPUState* cpu) {
   L_020B9B18: ; // 0x20b9b18
         /* 020B9B18 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 020B9B18 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 020B9B1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020B9B20 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9B1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020B9B20 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9B20 */ _t10 = _t9 & 0x00000001u;
         /* 020B9B20 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B9B20 */ goto L_020B9B24;
   L_020B9B24: ; // 0x20b9b24
-        /* 020B9B24 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 020B9B24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 020B9B28 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 020B9B28 */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 020B9B2C */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B9B2C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B9B2C */ _t13 = _t12 & 0x00000001u;
         /* 020B9B2C */ if (_t13) goto L_020B9B30; else goto L_020B9B38;
   L_020B9B30: ; // 0x20b9b30
@@ -21361,11 +21361,11 @@ void Gambit_fn_020B9AE4(CPUState* cpu) {
         /* 020B9B38 */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 020B9B3C */ _t15 = cpu->r[12] + 0x00000000u;
         /* 020B9B3C */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 020B9B40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 020B9B40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 020B9B44 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 020B9B44 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 020B9B48 */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 020B9B4C */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B9B4C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B9B4C */ _t18 = _t17 & 0x00000001u;
         /* 020B9B4C */ if (_t18) goto L_020B9B64; else goto L_020B9B50;
   L_020B9B50: ; // 0x20b9b50
@@ -21392,10 +21392,10 @@ void Gambit_fn_020B9B6C(CPUState* cpu) {
         /* 020B9B74 */ _t1 = cpu->r[3] + 0x00000020u;
         /* 020B9B74 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 020B9B78 */ cpu->r[8] = cpu->r[0];
-        /* 020B9B7C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 020B9B7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 020B9B80 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 020B9B80 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 020B9B84 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B9B84 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B9B84 */ _t4 = _t3 & 0x00000001u;
         /* 020B9B84 */ if (_t4) goto L_020B9B88; else goto L_020B9BA0;
   L_020B9B88: ; // 0x20b9b88
@@ -21403,8 +21403,8 @@ void Gambit_fn_020B9B6C(CPUState* cpu) {
         /* 020B9B8C */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 020B9B90 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 020B9B90 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 020B9B94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020B9B98 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9B94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020B9B98 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9B98 */ _t7 = _t6 & 0x00000001u;
         /* 020B9B98 */ if (_t7) goto L_020B9B9C; else goto L_020B9BAC;
   L_020B9B9C: ; // 0x20b9b9c
@@ -21412,16 +21412,16 @@ void Gambit_fn_020B9B6C(CPUState* cpu) {
   L_020B9BA0: ; // 0x20b9ba0
         /* 020B9BA0 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 020B9BA0 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 020B9BA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020B9BA8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9BA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020B9BA8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9BA8 */ _t10 = _t9 & 0x00000001u;
         /* 020B9BA8 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B9BA8 */ goto L_020B9BAC;
   L_020B9BAC: ; // 0x20b9bac
-        /* 020B9BAC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 020B9BAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 020B9BB0 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 020B9BB0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 020B9BB4 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B9BB4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B9BB4 */ _t13 = _t12 & 0x00000001u;
         /* 020B9BB4 */ if (_t13) goto L_020B9BB8; else goto L_020B9BC0;
   L_020B9BB8: ; // 0x20b9bb8
@@ -21432,11 +21432,11 @@ void Gambit_fn_020B9B6C(CPUState* cpu) {
         /* 020B9BC0 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 020B9BC4 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 020B9BC4 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 020B9BC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020B9BC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020B9BCC */ _t16 = cpu->r[12] + 0x00000004u;
         /* 020B9BCC */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 020B9BD0 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 020B9BD4 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B9BD4 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B9BD4 */ _t18 = _t17 & 0x00000001u;
         /* 020B9BD4 */ if (_t18) goto L_020B9BEC; else goto L_020B9BD8;
   L_020B9BD8: ; // 0x20b9bd8
@@ -21471,9 +21471,9 @@ void Gambit_fn_020B9BF4(CPUState* cpu) {
         /* 020B9C0C */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 020B9C0C */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 020B9C10 */ /* nop */
-        /* 020B9C14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 020B9C14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 020B9C18 */ cpu->r[31] = cpu->r[4];
-        /* 020B9C1C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9C1C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9C1C */ _t6 = _t5 & 0x00000001u;
         /* 020B9C1C */ if (_t6) goto L_020B9C20; else goto L_020B9C34;
   L_020B9C20: ; // 0x20b9c20
@@ -21522,9 +21522,9 @@ void Gambit_fn_020B9BF8(CPUState* cpu) {
         /* 020B9C0C */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 020B9C0C */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 020B9C10 */ /* nop */
-        /* 020B9C14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 020B9C14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 020B9C18 */ cpu->r[31] = cpu->r[4];
-        /* 020B9C1C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9C1C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9C1C */ _t6 = _t5 & 0x00000001u;
         /* 020B9C1C */ if (_t6) goto L_020B9C20; else goto L_020B9C34;
   L_020B9C20: ; // 0x20b9c20
@@ -21566,10 +21566,10 @@ void Gambit_fn_020B9C6C(CPUState* cpu) {
         /* 020B9C74 */ _t1 = cpu->r[3] + 0x00000028u;
         /* 020B9C74 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 020B9C78 */ cpu->r[8] = cpu->r[0];
-        /* 020B9C7C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 020B9C7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 020B9C80 */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 020B9C80 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 020B9C84 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B9C84 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B9C84 */ _t4 = _t3 & 0x00000001u;
         /* 020B9C84 */ if (_t4) goto L_020B9C88; else goto L_020B9CA0;
   L_020B9C88: ; // 0x20b9c88
@@ -21577,8 +21577,8 @@ void Gambit_fn_020B9C6C(CPUState* cpu) {
         /* 020B9C8C */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 020B9C90 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 020B9C90 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 020B9C94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020B9C98 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9C94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020B9C98 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9C98 */ _t7 = _t6 & 0x00000001u;
         /* 020B9C98 */ if (_t7) goto L_020B9C9C; else goto L_020B9CAC;
   L_020B9C9C: ; // 0x20b9c9c
@@ -21586,16 +21586,16 @@ void Gambit_fn_020B9C6C(CPUState* cpu) {
   L_020B9CA0: ; // 0x20b9ca0
         /* 020B9CA0 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 020B9CA0 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 020B9CA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020B9CA8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9CA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020B9CA8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9CA8 */ _t10 = _t9 & 0x00000001u;
         /* 020B9CA8 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020B9CA8 */ goto L_020B9CAC;
   L_020B9CAC: ; // 0x20b9cac
-        /* 020B9CAC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 020B9CAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 020B9CB0 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 020B9CB0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 020B9CB4 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B9CB4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B9CB4 */ _t13 = _t12 & 0x00000001u;
         /* 020B9CB4 */ if (_t13) goto L_020B9CB8; else goto L_020B9CC0;
   L_020B9CB8: ; // 0x20b9cb8
@@ -21606,11 +21606,11 @@ void Gambit_fn_020B9C6C(CPUState* cpu) {
         /* 020B9CC0 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 020B9CC4 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 020B9CC4 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 020B9CC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020B9CC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020B9CCC */ _t16 = cpu->r[12] + 0x00000004u;
         /* 020B9CCC */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 020B9CD0 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 020B9CD4 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B9CD4 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B9CD4 */ _t18 = _t17 & 0x00000001u;
         /* 020B9CD4 */ if (_t18) goto L_020B9CEC; else goto L_020B9CD8;
   L_020B9CD8: ; // 0x20b9cd8
@@ -21643,18 +21643,18 @@ void Gambit_fn_020B9CF4(CPUState* cpu) {
         /* 020B9D08 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 020B9D08 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 020B9D0C */ cpu->r[12] = 0x00000000u;
-        /* 020B9D10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020B9D10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020B9D14 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 020B9D14 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 020B9D18 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9D18 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9D18 */ _t6 = _t5 & 0x00000001u;
         /* 020B9D18 */ if (_t6) goto L_020B9D40; else goto L_020B9D1C;
   L_020B9D1C: ; // 0x20b9d1c
         /* 020B9D1C */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 020B9D1C */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 020B9D20 */ /* nop */
-        /* 020B9D24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 020B9D28 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9D24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 020B9D28 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9D28 */ _t9 = _t8 & 0x00000001u;
         /* 020B9D28 */ if (_t9) goto L_020B9D2C; else goto L_020B9D40;
   L_020B9D2C: ; // 0x20b9d2c
@@ -21695,18 +21695,18 @@ void Gambit_fn_020B9CF8(CPUState* cpu) {
         /* 020B9D08 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 020B9D08 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 020B9D0C */ cpu->r[12] = 0x00000000u;
-        /* 020B9D10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020B9D10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020B9D14 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 020B9D14 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 020B9D18 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9D18 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9D18 */ _t6 = _t5 & 0x00000001u;
         /* 020B9D18 */ if (_t6) goto L_020B9D40; else goto L_020B9D1C;
   L_020B9D1C: ; // 0x20b9d1c
         /* 020B9D1C */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 020B9D1C */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 020B9D20 */ /* nop */
-        /* 020B9D24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 020B9D28 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9D24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 020B9D28 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9D28 */ _t9 = _t8 & 0x00000001u;
         /* 020B9D28 */ if (_t9) goto L_020B9D2C; else goto L_020B9D40;
   L_020B9D2C: ; // 0x20b9d2c
@@ -21748,11 +21748,11 @@ void Gambit_fn_020B9D64(CPUState* cpu) {
         /* 020BBC6C */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020BBC6C */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020BBC70 */ cpu->r[30] = cpu->r[3];
-        /* 020BBC70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020BBC70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020BBC74 */ cpu->r[31] = cpu->r[4];
         /* 020BBC78 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020BBC78 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020BBC7C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBC7C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBC7C */ _t5 = _t4 & 0x00000001u;
         /* 020BBC7C */ if (_t5) goto L_020BBCC0; else goto L_020BBC80;
   L_020BBC80: ; // 0x20bbc80
@@ -21772,8 +21772,8 @@ void Gambit_fn_020B9D64(CPUState* cpu) {
         /* 020BBCA8 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020BBCAC */ Gambit_fn_02068798(cpu);
         /* 020BBCB0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020BBCB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BBCB4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBCB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BBCB4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBCB4 */ _t10 = _t9 & 0x00000001u;
         /* 020BBCB4 */ if (_t10) goto L_020BBCC0; else goto L_020BBCB8;
   L_020BBCB8: ; // 0x20bbcb8
@@ -21801,8 +21801,8 @@ void Gambit_fn_020B9D6C(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -21854,20 +21854,20 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020B9D8C */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020B9D90 */ /* nop */
         /* 020B9D94 */ cpu->r[29] = cpu->r[3];
-        /* 020B9D94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020B9D94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020B9D98 */ cpu->r[28] = cpu->r[4];
         /* 020B9D9C */ cpu->r[25] = cpu->r[5];
         /* 020B9DA0 */ cpu->r[30] = cpu->r[6];
         /* 020B9DA4 */ cpu->r[31] = cpu->r[7];
-        /* 020B9DA8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9DA8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9DA8 */ _t3 = _t2 & 0x00000001u;
         /* 020B9DA8 */ if (_t3) goto L_020B9DAC; else goto L_020B9DBC;
   L_020B9DAC: ; // 0x20b9dac
         /* 020B9DAC */ cpu->r[3] = 0x0000028Cu;
         /* 020B9DB0 */ Gambit_fn_02801A78(cpu);
         /* 020B9DB4 */ cpu->r[29] = cpu->r[3];
-        /* 020B9DB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020B9DB8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9DB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020B9DB8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9DB8 */ _t5 = _t4 & 0x00000001u;
         /* 020B9DB8 */ if (_t5) goto L_020BA870; else goto L_020B9DBC;
   L_020B9DBC: ; // 0x20b9dbc
@@ -21894,22 +21894,22 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020B9DFC */ rbrew_write32(cpu->mem, _t9, cpu->r[6]);
         /* 020B9E00 */ cpu->r[8] = cpu->r[8] + 0x0000534Cu;
         /* 020B9E04 */ cpu->r[27] = cpu->r[29] + 0x000001DCu;
-        /* 020B9E04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B9E04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B9E08 */ _t10 = cpu->r[29] + 0x0000001Cu;
         /* 020B9E08 */ rbrew_write32(cpu->mem, _t10, cpu->r[7]);
         /* 020B9E0C */ cpu->r[28] = 0x00000000u;
         /* 020B9E10 */ cpu->r[31] = cpu->r[27];
         /* 020B9E14 */ _t11 = cpu->r[29] + 0x000001C8u;
         /* 020B9E14 */ rbrew_write32(cpu->mem, _t11, cpu->r[8]);
-        /* 020B9E18 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9E18 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9E18 */ _t13 = _t12 & 0x00000001u;
         /* 020B9E18 */ if (_t13) goto L_020B9E1C; else goto L_020B9E2C;
   L_020B9E1C: ; // 0x20b9e1c
         /* 020B9E1C */ cpu->r[3] = 0x00000038u;
         /* 020B9E20 */ Gambit_fn_02801A78(cpu);
         /* 020B9E24 */ cpu->r[31] = cpu->r[3];
-        /* 020B9E24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020B9E28 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9E24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020B9E28 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9E28 */ _t15 = _t14 & 0x00000001u;
         /* 020B9E28 */ if (_t15) goto L_020B9E5C; else goto L_020B9E2C;
   L_020B9E2C: ; // 0x20b9e2c
@@ -21943,48 +21943,48 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020B9E70 */ cpu->r[10] = 0xFFFFFFFFu;
         /* 020B9E74 */ cpu->r[23] = 0x10010000u;
         /* 020B9E78 */ cpu->r[20] = cpu->r[29] + 0x00000220u;
-        /* 020B9E78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
+        /* 020B9E78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
         /* 020B9E7C */ _t25 = cpu->r[29] + 0x00000218u;
         /* 020B9E7C */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
         /* 020B9E80 */ cpu->r[23] = cpu->r[23] + 0x00004FD8u;
         /* 020B9E84 */ cpu->r[22] = cpu->r[22] + 0x00004FF0u;
         /* 020B9E88 */ _t26 = cpu->r[29] + 0x0000021Cu;
         /* 020B9E88 */ rbrew_write32(cpu->mem, _t26, cpu->r[10]);
-        /* 020B9E8C */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9E8C */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9E8C */ _t28 = _t27 & 0x00000001u;
         /* 020B9E8C */ if (_t28) goto L_020B9E90; else goto L_020B9EB4;
   L_020B9E90: ; // 0x20b9e90
         /* 020B9E90 */ cpu->r[3] = 0x0000002Cu;
         /* 020B9E94 */ Gambit_fn_02801A78(cpu);
         /* 020B9E98 */ cpu->r[20] = cpu->r[3];
-        /* 020B9E98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
-        /* 020B9E9C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9E98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
+        /* 020B9E9C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9E9C */ _t30 = _t29 & 0x00000001u;
         /* 020B9E9C */ if (_t30) goto L_020B9EA0; else goto L_020B9EB4;
   L_020B9EA0: ; // 0x20b9ea0
         /* 020B9EA0 */ _t31 = cpu->r[31] + 0x00007399u;
         /* 020B9EA0 */ cpu->r[24] = rbrew_read8(cpu->mem, _t31);
         /* 020B9EA4 */ cpu->r[25] = cpu->r[29] + 0x00000250u;
-        /* 020B9EA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 020B9EA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 020B9EA8 */ _t32 = cpu->r[29] + 0x0000024Cu;
         /* 020B9EA8 */ rbrew_write32(cpu->mem, _t32, cpu->r[28]);
-        /* 020B9EAC */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9EAC */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9EAC */ _t34 = _t33 & 0x00000001u;
         /* 020B9EAC */ if (_t34) goto L_020B9EB0; else goto L_020B9FFC;
   L_020B9EB0: ; // 0x20b9eb0
         /* 020B9EB0 */ goto L_020B9FEC;
   L_020B9EB4: ; // 0x20b9eb4
         /* 020B9EB4 */ cpu->r[19] = cpu->r[20];
-        /* 020B9EB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[19], 0x00000000u);
-        /* 020B9EB8 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9EB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[19], 0x00000000u));
+        /* 020B9EB8 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9EB8 */ _t36 = _t35 & 0x00000001u;
         /* 020B9EB8 */ if (_t36) goto L_020B9EBC; else goto L_020B9ED8;
   L_020B9EBC: ; // 0x20b9ebc
         /* 020B9EBC */ cpu->r[3] = 0x0000002Cu;
         /* 020B9EC0 */ Gambit_fn_02801A78(cpu);
         /* 020B9EC4 */ cpu->r[19] = cpu->r[3];
-        /* 020B9EC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[19], 0x00000000u);
-        /* 020B9EC8 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9EC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[19], 0x00000000u));
+        /* 020B9EC8 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9EC8 */ _t38 = _t37 & 0x00000001u;
         /* 020B9EC8 */ if (_t38) goto L_020B9ECC; else goto L_020B9ED8;
   L_020B9ECC: ; // 0x20b9ecc
@@ -21995,15 +21995,15 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020B9ED4 */ goto L_020B9FE0;
   L_020B9ED8: ; // 0x20b9ed8
         /* 020B9ED8 */ cpu->r[3] = cpu->r[19];
-        /* 020B9ED8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B9EDC */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9ED8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B9EDC */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9EDC */ _t42 = _t41 & 0x00000001u;
         /* 020B9EDC */ if (_t42) goto L_020B9EE0; else goto L_020B9F2C;
   L_020B9EE0: ; // 0x20b9ee0
         /* 020B9EE0 */ cpu->r[3] = 0x0000000Cu;
         /* 020B9EE4 */ Gambit_fn_02801A78(cpu);
-        /* 020B9EE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B9EEC */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9EE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B9EEC */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9EEC */ _t44 = _t43 & 0x00000001u;
         /* 020B9EEC */ if (_t44) goto L_020B9EF0; else goto L_020B9F2C;
   L_020B9EF0: ; // 0x20b9ef0
@@ -22025,9 +22025,9 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020B9F14 */ _t51 = cpu->r[4] + 0x00000000u;
         /* 020B9F14 */ cpu->r[11] = rbrew_read8(cpu->mem, _t51);
         /* 020B9F18 */ cpu->r[31] = 0x00000000u;
-        /* 020B9F1C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[24]);
+        /* 020B9F1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[24]));
         /* 020B9F20 */ cpu->r[5] = 0x00080000u;
-        /* 020B9F24 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9F24 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9F24 */ _t53 = _t52 & 0x00000001u;
         /* 020B9F24 */ if (_t53) goto L_020B9F28; else goto L_020B9F7C;
   L_020B9F28: ; // 0x20b9f28
@@ -22061,23 +22061,23 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020B9F68 */ _t64 = cpu->r[4] + 0x00000000u;
         /* 020B9F68 */ cpu->r[11] = rbrew_read8(cpu->mem, _t64);
         /* 020B9F6C */ cpu->r[31] = 0x00000000u;
-        /* 020B9F70 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[24]);
+        /* 020B9F70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[24]));
         /* 020B9F74 */ cpu->r[5] = 0x00080000u;
-        /* 020B9F78 */ _t65 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9F78 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9F78 */ _t66 = _t65 & 0x00000001u;
         /* 020B9F78 */ if (_t66) goto L_020B9F28; else goto L_020B9F7C;
   L_020B9F7C: ; // 0x20b9f7c
         /* 020B9F7C */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020B9F80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 020B9F80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 020B9F84 */ cpu->r[4] = cpu->r[4] + 0x00000001u;
-        /* 020B9F88 */ _t67 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B9F88 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B9F88 */ _t68 = _t67 & 0x00000001u;
         /* 020B9F88 */ if (_t68) goto L_020B9F9C; else goto L_020B9F8C;
   L_020B9F8C: ; // 0x20b9f8c
         /* 020B9F8C */ _t69 = cpu->r[4] + 0x00000000u;
         /* 020B9F8C */ cpu->r[0] = rbrew_read8(cpu->mem, _t69);
-        /* 020B9F90 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[24]);
-        /* 020B9F94 */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9F90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[24]));
+        /* 020B9F94 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9F94 */ _t71 = _t70 & 0x00000001u;
         /* 020B9F94 */ if (_t71) goto L_020B9F98; else goto L_020B9F7C;
   L_020B9F98: ; // 0x20b9f98
@@ -22089,10 +22089,10 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020B9FA0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t72);
         /* 020B9FA4 */ _t73 = cpu->r[25] + 0x00000004u;
         /* 020B9FA4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t73);
-        /* 020B9FA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 020B9FA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 020B9FAC */ _t74 = cpu->r[5] + 0x00000014u;
         /* 020B9FAC */ cpu->r[6] = rbrew_read32(cpu->mem, _t74);
-        /* 020B9FB0 */ _t75 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B9FB0 */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B9FB0 */ _t76 = _t75 & 0x00000001u;
         /* 020B9FB0 */ if (_t76) goto L_020B9FB8; else goto L_020B9FB4;
   L_020B9FB4: ; // 0x20b9fb4
@@ -22113,45 +22113,45 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020B9FDC */ rbrew_write32(cpu->mem, _t79, cpu->r[21]);
   L_020B9FE0: ; // 0x20b9fe0
         /* 020B9FE0 */ cpu->r[25] = cpu->r[29] + 0x00000250u;
-        /* 020B9FE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 020B9FE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 020B9FE4 */ _t80 = cpu->r[29] + 0x0000024Cu;
         /* 020B9FE4 */ rbrew_write32(cpu->mem, _t80, cpu->r[28]);
-        /* 020B9FE8 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9FE8 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9FE8 */ _t82 = _t81 & 0x00000001u;
         /* 020B9FE8 */ if (_t82) goto L_020B9FEC; else goto L_020B9FFC;
   L_020B9FEC: ; // 0x20b9fec
         /* 020B9FEC */ cpu->r[3] = 0x0000002Cu;
         /* 020B9FF0 */ Gambit_fn_02801A78(cpu);
         /* 020B9FF4 */ cpu->r[25] = cpu->r[3];
-        /* 020B9FF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 020B9FF8 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9FF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 020B9FF8 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9FF8 */ _t84 = _t83 & 0x00000001u;
         /* 020B9FF8 */ if (_t84) goto L_020BA0DC; else goto L_020B9FFC;
   L_020B9FFC: ; // 0x20b9ffc
         /* 020B9FFC */ cpu->r[20] = cpu->r[25];
-        /* 020B9FFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
-        /* 020BA000 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9FFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
+        /* 020BA000 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA000 */ _t86 = _t85 & 0x00000001u;
         /* 020BA000 */ if (_t86) goto L_020BA004; else goto L_020BA014;
   L_020BA004: ; // 0x20ba004
         /* 020BA004 */ cpu->r[3] = 0x0000002Cu;
         /* 020BA008 */ Gambit_fn_02801A78(cpu);
         /* 020BA00C */ cpu->r[20] = cpu->r[3];
-        /* 020BA00C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
-        /* 020BA010 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA00C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
+        /* 020BA010 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA010 */ _t88 = _t87 & 0x00000001u;
         /* 020BA010 */ if (_t88) goto L_020BA0D8; else goto L_020BA014;
   L_020BA014: ; // 0x20ba014
         /* 020BA014 */ cpu->r[3] = cpu->r[20];
-        /* 020BA014 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BA018 */ _t89 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA014 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BA018 */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA018 */ _t90 = _t89 & 0x00000001u;
         /* 020BA018 */ if (_t90) goto L_020BA01C; else goto L_020BA02C;
   L_020BA01C: ; // 0x20ba01c
         /* 020BA01C */ cpu->r[3] = 0x0000000Cu;
         /* 020BA020 */ Gambit_fn_02801A78(cpu);
-        /* 020BA024 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BA028 */ _t91 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA024 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BA028 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA028 */ _t92 = _t91 & 0x00000001u;
         /* 020BA028 */ if (_t92) goto L_020BA044; else goto L_020BA02C;
   L_020BA02C: ; // 0x20ba02c
@@ -22182,23 +22182,23 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020BA064 */ _t102 = cpu->r[9] + 0x00000000u;
         /* 020BA064 */ cpu->r[0] = rbrew_read8(cpu->mem, _t102);
         /* 020BA068 */ cpu->r[31] = 0x00000000u;
-        /* 020BA06C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[24]);
+        /* 020BA06C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[24]));
         /* 020BA070 */ cpu->r[0] = 0x00080000u;
-        /* 020BA074 */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA074 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA074 */ _t104 = _t103 & 0x00000001u;
         /* 020BA074 */ if (_t104) goto L_020BA09C; else goto L_020BA078;
   L_020BA078: ; // 0x20ba078
         /* 020BA078 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020BA07C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 020BA07C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 020BA080 */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 020BA084 */ _t105 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA084 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA084 */ _t106 = _t105 & 0x00000001u;
         /* 020BA084 */ if (_t106) goto L_020BA098; else goto L_020BA088;
   L_020BA088: ; // 0x20ba088
         /* 020BA088 */ _t107 = cpu->r[9] + 0x00000000u;
         /* 020BA088 */ cpu->r[11] = rbrew_read8(cpu->mem, _t107);
-        /* 020BA08C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[24]);
-        /* 020BA090 */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA08C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[24]));
+        /* 020BA090 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA090 */ _t109 = _t108 & 0x00000001u;
         /* 020BA090 */ if (_t109) goto L_020BA094; else goto L_020BA078;
   L_020BA094: ; // 0x20ba094
@@ -22210,10 +22210,10 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020BA09C */ cpu->r[9] = rbrew_read32(cpu->mem, _t110);
         /* 020BA0A0 */ _t111 = cpu->r[30] + 0x00000004u;
         /* 020BA0A0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t111);
-        /* 020BA0A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 020BA0A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 020BA0A8 */ _t112 = cpu->r[12] + 0x00000014u;
         /* 020BA0A8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t112);
-        /* 020BA0AC */ _t113 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BA0AC */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BA0AC */ _t114 = _t113 & 0x00000001u;
         /* 020BA0AC */ if (_t114) goto L_020BA0B4; else goto L_020BA0B0;
   L_020BA0B0: ; // 0x20ba0b0
@@ -22255,8 +22255,8 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020BA108 */ cpu->r[10] = rbrew_read32(cpu->mem, _t124);
         /* 020BA10C */ _t125 = cpu->r[10] + 0x00000178u;
         /* 020BA10C */ cpu->r[8] = rbrew_read32(cpu->mem, _t125);
-        /* 020BA110 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 020BA114 */ _t126 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA110 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 020BA114 */ _t126 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA114 */ _t127 = _t126 & 0x00000001u;
         /* 020BA114 */ if (_t127) goto L_020BA150; else goto L_020BA118;
   L_020BA118: ; // 0x20ba118
@@ -22264,10 +22264,10 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020BA118 */ cpu->r[9] = rbrew_read32(cpu->mem, _t128);
         /* 020BA11C */ _t129 = cpu->r[10] + 0x00000170u;
         /* 020BA11C */ cpu->r[0] = rbrew_read32(cpu->mem, _t129);
-        /* 020BA120 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], cpu->r[0]);
+        /* 020BA120 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], cpu->r[0]));
         /* 020BA124 */ _t130 = cpu->r[10] + 0x0000016Cu;
         /* 020BA124 */ cpu->r[12] = rbrew_read32(cpu->mem, _t130);
-        /* 020BA128 */ _t131 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BA128 */ _t131 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BA128 */ _t132 = _t131 & 0x00000001u;
         /* 020BA128 */ if (_t132) goto L_020BA130; else goto L_020BA12C;
   L_020BA12C: ; // 0x20ba12c
@@ -22280,8 +22280,8 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020BA13C */ _t134 = cpu->r[29] + 0x00000288u;
         /* 020BA13C */ rbrew_write32(cpu->mem, _t134, cpu->r[9]);
         /* 020BA140 */ Gambit_fn_02801A78(cpu);
-        /* 020BA144 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BA148 */ _t135 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BA148 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA148 */ _t136 = _t135 & 0x00000001u;
         /* 020BA148 */ if (_t136) goto L_020BA170; else goto L_020BA14C;
   L_020BA14C: ; // 0x20ba14c
@@ -22295,8 +22295,8 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020BA15C */ _t139 = cpu->r[29] + 0x00000288u;
         /* 020BA15C */ rbrew_write32(cpu->mem, _t139, cpu->r[9]);
         /* 020BA160 */ Gambit_fn_02801A78(cpu);
-        /* 020BA164 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BA168 */ _t140 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA164 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BA168 */ _t140 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA168 */ _t141 = _t140 & 0x00000001u;
         /* 020BA168 */ if (_t141) goto L_020BA170; else goto L_020BA16C;
   L_020BA16C: ; // 0x20ba16c
@@ -22332,23 +22332,23 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020BA1C0 */ _t149 = cpu->r[4] + 0x00000000u;
         /* 020BA1C0 */ cpu->r[8] = rbrew_read8(cpu->mem, _t149);
         /* 020BA1C4 */ cpu->r[31] = 0x00000000u;
-        /* 020BA1C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[24]);
+        /* 020BA1C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[24]));
         /* 020BA1CC */ cpu->r[6] = 0x00080000u;
-        /* 020BA1D0 */ _t150 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA1D0 */ _t150 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA1D0 */ _t151 = _t150 & 0x00000001u;
         /* 020BA1D0 */ if (_t151) goto L_020BA1F8; else goto L_020BA1D4;
   L_020BA1D4: ; // 0x20ba1d4
         /* 020BA1D4 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020BA1D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 020BA1D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 020BA1DC */ cpu->r[4] = cpu->r[4] + 0x00000001u;
-        /* 020BA1E0 */ _t152 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA1E0 */ _t152 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA1E0 */ _t153 = _t152 & 0x00000001u;
         /* 020BA1E0 */ if (_t153) goto L_020BA1F4; else goto L_020BA1E4;
   L_020BA1E4: ; // 0x20ba1e4
         /* 020BA1E4 */ _t154 = cpu->r[4] + 0x00000000u;
         /* 020BA1E4 */ cpu->r[10] = rbrew_read8(cpu->mem, _t154);
-        /* 020BA1E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[24]);
-        /* 020BA1EC */ _t155 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA1E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[24]));
+        /* 020BA1EC */ _t155 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA1EC */ _t156 = _t155 & 0x00000001u;
         /* 020BA1EC */ if (_t156) goto L_020BA1F0; else goto L_020BA1D4;
   L_020BA1F0: ; // 0x20ba1f0
@@ -22360,10 +22360,10 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020BA1F8 */ cpu->r[4] = rbrew_read32(cpu->mem, _t157);
         /* 020BA1FC */ _t158 = cpu->r[1] + 0x00000010u;
         /* 020BA1FC */ cpu->r[12] = rbrew_read32(cpu->mem, _t158);
-        /* 020BA200 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[4]);
+        /* 020BA200 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[4]));
         /* 020BA204 */ _t159 = cpu->r[12] + 0x00000014u;
         /* 020BA204 */ cpu->r[5] = rbrew_read32(cpu->mem, _t159);
-        /* 020BA208 */ _t160 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BA208 */ _t160 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BA208 */ _t161 = _t160 & 0x00000001u;
         /* 020BA208 */ if (_t161) goto L_020BA210; else goto L_020BA20C;
   L_020BA20C: ; // 0x20ba20c
@@ -22418,10 +22418,10 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020BA290 */ rbrew_write32(cpu->mem, _t175, cpu->r[0]);
         /* 020BA294 */ _t176 = cpu->r[27] + 0x00000014u;
         /* 020BA294 */ cpu->r[0] = rbrew_read32(cpu->mem, _t176);
-        /* 020BA298 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 020BA298 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 020BA29C */ _t177 = cpu->r[27] + 0x00000018u;
         /* 020BA29C */ cpu->r[30] = rbrew_read32(cpu->mem, _t177);
-        /* 020BA2A0 */ _t178 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA2A0 */ _t178 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA2A0 */ _t179 = _t178 & 0x00000001u;
         /* 020BA2A0 */ if (_t179) goto L_020BA2A4; else goto L_020BA2A8;
   L_020BA2A4: ; // 0x20ba2a4
@@ -22437,23 +22437,23 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020BA2BC */ _t182 = cpu->r[8] + 0x00000000u;
         /* 020BA2BC */ cpu->r[6] = rbrew_read8(cpu->mem, _t182);
         /* 020BA2C0 */ cpu->r[31] = 0x00000000u;
-        /* 020BA2C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[24]);
+        /* 020BA2C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[24]));
         /* 020BA2C8 */ cpu->r[10] = 0x00080000u;
-        /* 020BA2CC */ _t183 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA2CC */ _t183 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA2CC */ _t184 = _t183 & 0x00000001u;
         /* 020BA2CC */ if (_t184) goto L_020BA2F4; else goto L_020BA2D0;
   L_020BA2D0: ; // 0x20ba2d0
         /* 020BA2D0 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020BA2D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 020BA2D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 020BA2D8 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 020BA2DC */ _t185 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA2DC */ _t185 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA2DC */ _t186 = _t185 & 0x00000001u;
         /* 020BA2DC */ if (_t186) goto L_020BA2F0; else goto L_020BA2E0;
   L_020BA2E0: ; // 0x20ba2e0
         /* 020BA2E0 */ _t187 = cpu->r[8] + 0x00000000u;
         /* 020BA2E0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t187);
-        /* 020BA2E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[24]);
-        /* 020BA2E8 */ _t188 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA2E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[24]));
+        /* 020BA2E8 */ _t188 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA2E8 */ _t189 = _t188 & 0x00000001u;
         /* 020BA2E8 */ if (_t189) goto L_020BA2EC; else goto L_020BA2D0;
   L_020BA2EC: ; // 0x20ba2ec
@@ -22465,10 +22465,10 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020BA2F4 */ cpu->r[6] = rbrew_read32(cpu->mem, _t190);
         /* 020BA2F8 */ _t191 = cpu->r[1] + 0x00000010u;
         /* 020BA2F8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t191);
-        /* 020BA2FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 020BA2FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 020BA300 */ _t192 = cpu->r[8] + 0x00000014u;
         /* 020BA300 */ cpu->r[0] = rbrew_read32(cpu->mem, _t192);
-        /* 020BA304 */ _t193 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BA304 */ _t193 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BA304 */ _t194 = _t193 & 0x00000001u;
         /* 020BA304 */ if (_t194) goto L_020BA30C; else goto L_020BA308;
   L_020BA308: ; // 0x20ba308
@@ -22523,10 +22523,10 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020BA38C */ rbrew_write32(cpu->mem, _t208, cpu->r[11]);
         /* 020BA390 */ _t209 = cpu->r[27] + 0x00000014u;
         /* 020BA390 */ cpu->r[0] = rbrew_read32(cpu->mem, _t209);
-        /* 020BA394 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000002u);
+        /* 020BA394 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000002u));
         /* 020BA398 */ _t210 = cpu->r[27] + 0x00000018u;
         /* 020BA398 */ cpu->r[30] = rbrew_read32(cpu->mem, _t210);
-        /* 020BA39C */ _t211 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA39C */ _t211 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA39C */ _t212 = _t211 & 0x00000001u;
         /* 020BA39C */ if (_t212) goto L_020BA3A0; else goto L_020BA3A4;
   L_020BA3A0: ; // 0x20ba3a0
@@ -22542,23 +22542,23 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020BA3B8 */ _t215 = cpu->r[12] + 0x00000000u;
         /* 020BA3B8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t215);
         /* 020BA3BC */ cpu->r[31] = 0x00000000u;
-        /* 020BA3C0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[24]);
+        /* 020BA3C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[24]));
         /* 020BA3C4 */ cpu->r[5] = 0x00080000u;
-        /* 020BA3C8 */ _t216 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA3C8 */ _t216 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA3C8 */ _t217 = _t216 & 0x00000001u;
         /* 020BA3C8 */ if (_t217) goto L_020BA3F0; else goto L_020BA3CC;
   L_020BA3CC: ; // 0x20ba3cc
         /* 020BA3CC */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020BA3D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 020BA3D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 020BA3D4 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 020BA3D8 */ _t218 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA3D8 */ _t218 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA3D8 */ _t219 = _t218 & 0x00000001u;
         /* 020BA3D8 */ if (_t219) goto L_020BA3EC; else goto L_020BA3DC;
   L_020BA3DC: ; // 0x20ba3dc
         /* 020BA3DC */ _t220 = cpu->r[12] + 0x00000000u;
         /* 020BA3DC */ cpu->r[4] = rbrew_read8(cpu->mem, _t220);
-        /* 020BA3E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[24]);
-        /* 020BA3E4 */ _t221 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA3E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[24]));
+        /* 020BA3E4 */ _t221 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA3E4 */ _t222 = _t221 & 0x00000001u;
         /* 020BA3E4 */ if (_t222) goto L_020BA3E8; else goto L_020BA3CC;
   L_020BA3E8: ; // 0x20ba3e8
@@ -22570,10 +22570,10 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020BA3F0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t223);
         /* 020BA3F4 */ _t224 = cpu->r[1] + 0x00000010u;
         /* 020BA3F4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t224);
-        /* 020BA3F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 020BA3F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 020BA3FC */ _t225 = cpu->r[5] + 0x00000014u;
         /* 020BA3FC */ cpu->r[6] = rbrew_read32(cpu->mem, _t225);
-        /* 020BA400 */ _t226 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BA400 */ _t226 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BA400 */ _t227 = _t226 & 0x00000001u;
         /* 020BA400 */ if (_t227) goto L_020BA408; else goto L_020BA404;
   L_020BA404: ; // 0x20ba404
@@ -22628,10 +22628,10 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020BA488 */ rbrew_write32(cpu->mem, _t241, cpu->r[8]);
         /* 020BA48C */ _t242 = cpu->r[27] + 0x00000014u;
         /* 020BA48C */ cpu->r[9] = rbrew_read32(cpu->mem, _t242);
-        /* 020BA490 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000003u);
+        /* 020BA490 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000003u));
         /* 020BA494 */ _t243 = cpu->r[27] + 0x00000018u;
         /* 020BA494 */ cpu->r[30] = rbrew_read32(cpu->mem, _t243);
-        /* 020BA498 */ _t244 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA498 */ _t244 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA498 */ _t245 = _t244 & 0x00000001u;
         /* 020BA498 */ if (_t245) goto L_020BA49C; else goto L_020BA4A0;
   L_020BA49C: ; // 0x20ba49c
@@ -22647,23 +22647,23 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020BA4B4 */ _t248 = cpu->r[8] + 0x00000000u;
         /* 020BA4B4 */ cpu->r[10] = rbrew_read8(cpu->mem, _t248);
         /* 020BA4B8 */ cpu->r[31] = 0x00000000u;
-        /* 020BA4BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[24]);
+        /* 020BA4BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[24]));
         /* 020BA4C0 */ cpu->r[10] = 0x00080000u;
-        /* 020BA4C4 */ _t249 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA4C4 */ _t249 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA4C4 */ _t250 = _t249 & 0x00000001u;
         /* 020BA4C4 */ if (_t250) goto L_020BA4EC; else goto L_020BA4C8;
   L_020BA4C8: ; // 0x20ba4c8
         /* 020BA4C8 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020BA4CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 020BA4CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 020BA4D0 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 020BA4D4 */ _t251 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA4D4 */ _t251 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA4D4 */ _t252 = _t251 & 0x00000001u;
         /* 020BA4D4 */ if (_t252) goto L_020BA4E8; else goto L_020BA4D8;
   L_020BA4D8: ; // 0x20ba4d8
         /* 020BA4D8 */ _t253 = cpu->r[8] + 0x00000000u;
         /* 020BA4D8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t253);
-        /* 020BA4DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[24]);
-        /* 020BA4E0 */ _t254 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA4DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[24]));
+        /* 020BA4E0 */ _t254 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA4E0 */ _t255 = _t254 & 0x00000001u;
         /* 020BA4E0 */ if (_t255) goto L_020BA4E4; else goto L_020BA4C8;
   L_020BA4E4: ; // 0x20ba4e4
@@ -22675,10 +22675,10 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020BA4EC */ cpu->r[9] = rbrew_read32(cpu->mem, _t256);
         /* 020BA4F0 */ _t257 = cpu->r[1] + 0x00000010u;
         /* 020BA4F0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t257);
-        /* 020BA4F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 020BA4F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 020BA4F8 */ _t258 = cpu->r[12] + 0x00000014u;
         /* 020BA4F8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t258);
-        /* 020BA4FC */ _t259 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BA4FC */ _t259 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BA4FC */ _t260 = _t259 & 0x00000001u;
         /* 020BA4FC */ if (_t260) goto L_020BA504; else goto L_020BA500;
   L_020BA500: ; // 0x20ba500
@@ -22733,10 +22733,10 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020BA584 */ rbrew_write32(cpu->mem, _t274, cpu->r[6]);
         /* 020BA588 */ _t275 = cpu->r[27] + 0x00000014u;
         /* 020BA588 */ cpu->r[7] = rbrew_read32(cpu->mem, _t275);
-        /* 020BA58C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x00000004u);
+        /* 020BA58C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x00000004u));
         /* 020BA590 */ _t276 = cpu->r[27] + 0x00000018u;
         /* 020BA590 */ cpu->r[30] = rbrew_read32(cpu->mem, _t276);
-        /* 020BA594 */ _t277 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA594 */ _t277 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA594 */ _t278 = _t277 & 0x00000001u;
         /* 020BA594 */ if (_t278) goto L_020BA598; else goto L_020BA59C;
   L_020BA598: ; // 0x20ba598
@@ -22752,23 +22752,23 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020BA5B0 */ _t281 = cpu->r[12] + 0x00000000u;
         /* 020BA5B0 */ cpu->r[8] = rbrew_read8(cpu->mem, _t281);
         /* 020BA5B4 */ cpu->r[31] = 0x00000000u;
-        /* 020BA5B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[24]);
+        /* 020BA5B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[24]));
         /* 020BA5BC */ cpu->r[4] = 0x00080000u;
-        /* 020BA5C0 */ _t282 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA5C0 */ _t282 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA5C0 */ _t283 = _t282 & 0x00000001u;
         /* 020BA5C0 */ if (_t283) goto L_020BA5E8; else goto L_020BA5C4;
   L_020BA5C4: ; // 0x20ba5c4
         /* 020BA5C4 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020BA5C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[4]);
+        /* 020BA5C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[4]));
         /* 020BA5CC */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 020BA5D0 */ _t284 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA5D0 */ _t284 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA5D0 */ _t285 = _t284 & 0x00000001u;
         /* 020BA5D0 */ if (_t285) goto L_020BA5E4; else goto L_020BA5D4;
   L_020BA5D4: ; // 0x20ba5d4
         /* 020BA5D4 */ _t286 = cpu->r[12] + 0x00000000u;
         /* 020BA5D4 */ cpu->r[9] = rbrew_read8(cpu->mem, _t286);
-        /* 020BA5D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[24]);
-        /* 020BA5DC */ _t287 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA5D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[24]));
+        /* 020BA5DC */ _t287 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA5DC */ _t288 = _t287 & 0x00000001u;
         /* 020BA5DC */ if (_t288) goto L_020BA5E0; else goto L_020BA5C4;
   L_020BA5E0: ; // 0x20ba5e0
@@ -22778,8 +22778,8 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
   L_020BA5E8: ; // 0x20ba5e8
         /* 020BA5E8 */ _t289 = cpu->r[30] + 0x00000008u;
         /* 020BA5E8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t289);
-        /* 020BA5EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
-        /* 020BA5F0 */ _t290 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BA5EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
+        /* 020BA5F0 */ _t290 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BA5F0 */ _t291 = _t290 & 0x00000001u;
         /* 020BA5F0 */ if (_t291) goto L_020BA5F8; else goto L_020BA5F4;
   L_020BA5F4: ; // 0x20ba5f4
@@ -22838,10 +22838,10 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020BA680 */ rbrew_write32(cpu->mem, _t307, cpu->r[0]);
         /* 020BA684 */ _t308 = cpu->r[27] + 0x00000014u;
         /* 020BA684 */ cpu->r[0] = rbrew_read32(cpu->mem, _t308);
-        /* 020BA688 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
+        /* 020BA688 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
         /* 020BA68C */ _t309 = cpu->r[27] + 0x00000018u;
         /* 020BA68C */ cpu->r[30] = rbrew_read32(cpu->mem, _t309);
-        /* 020BA690 */ _t310 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA690 */ _t310 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA690 */ _t311 = _t310 & 0x00000001u;
         /* 020BA690 */ if (_t311) goto L_020BA694; else goto L_020BA698;
   L_020BA694: ; // 0x20ba694
@@ -22857,23 +22857,23 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020BA6AC */ _t314 = cpu->r[8] + 0x00000000u;
         /* 020BA6AC */ cpu->r[5] = rbrew_read8(cpu->mem, _t314);
         /* 020BA6B0 */ cpu->r[31] = 0x00000000u;
-        /* 020BA6B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[24]);
+        /* 020BA6B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[24]));
         /* 020BA6B8 */ cpu->r[10] = 0x00080000u;
-        /* 020BA6BC */ _t315 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA6BC */ _t315 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA6BC */ _t316 = _t315 & 0x00000001u;
         /* 020BA6BC */ if (_t316) goto L_020BA6E4; else goto L_020BA6C0;
   L_020BA6C0: ; // 0x20ba6c0
         /* 020BA6C0 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020BA6C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 020BA6C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 020BA6C8 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 020BA6CC */ _t317 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA6CC */ _t317 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA6CC */ _t318 = _t317 & 0x00000001u;
         /* 020BA6CC */ if (_t318) goto L_020BA6E0; else goto L_020BA6D0;
   L_020BA6D0: ; // 0x20ba6d0
         /* 020BA6D0 */ _t319 = cpu->r[8] + 0x00000000u;
         /* 020BA6D0 */ cpu->r[6] = rbrew_read8(cpu->mem, _t319);
-        /* 020BA6D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[24]);
-        /* 020BA6D8 */ _t320 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA6D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[24]));
+        /* 020BA6D8 */ _t320 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA6D8 */ _t321 = _t320 & 0x00000001u;
         /* 020BA6D8 */ if (_t321) goto L_020BA6DC; else goto L_020BA6C0;
   L_020BA6DC: ; // 0x20ba6dc
@@ -22885,10 +22885,10 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020BA6E4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t322);
         /* 020BA6E8 */ _t323 = cpu->r[1] + 0x00000010u;
         /* 020BA6E8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t323);
-        /* 020BA6EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 020BA6EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 020BA6F0 */ _t324 = cpu->r[7] + 0x00000014u;
         /* 020BA6F0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t324);
-        /* 020BA6F4 */ _t325 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BA6F4 */ _t325 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BA6F4 */ _t326 = _t325 & 0x00000001u;
         /* 020BA6F4 */ if (_t326) goto L_020BA6FC; else goto L_020BA6F8;
   L_020BA6F8: ; // 0x20ba6f8
@@ -22943,10 +22943,10 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020BA77C */ rbrew_write32(cpu->mem, _t340, cpu->r[7]);
         /* 020BA780 */ _t341 = cpu->r[27] + 0x00000014u;
         /* 020BA780 */ cpu->r[8] = rbrew_read32(cpu->mem, _t341);
-        /* 020BA784 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000006u);
+        /* 020BA784 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000006u));
         /* 020BA788 */ _t342 = cpu->r[27] + 0x00000018u;
         /* 020BA788 */ cpu->r[30] = rbrew_read32(cpu->mem, _t342);
-        /* 020BA78C */ _t343 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA78C */ _t343 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA78C */ _t344 = _t343 & 0x00000001u;
         /* 020BA78C */ if (_t344) goto L_020BA790; else goto L_020BA794;
   L_020BA790: ; // 0x20ba790
@@ -22962,23 +22962,23 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
         /* 020BA7A8 */ _t347 = cpu->r[12] + 0x00000000u;
         /* 020BA7A8 */ cpu->r[10] = rbrew_read8(cpu->mem, _t347);
         /* 020BA7AC */ cpu->r[31] = 0x00000000u;
-        /* 020BA7B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[24]);
+        /* 020BA7B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[24]));
         /* 020BA7B4 */ cpu->r[5] = 0x00080000u;
-        /* 020BA7B8 */ _t348 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA7B8 */ _t348 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA7B8 */ _t349 = _t348 & 0x00000001u;
         /* 020BA7B8 */ if (_t349) goto L_020BA7E0; else goto L_020BA7BC;
   L_020BA7BC: ; // 0x20ba7bc
         /* 020BA7BC */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020BA7C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 020BA7C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 020BA7C4 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 020BA7C8 */ _t350 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA7C8 */ _t350 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA7C8 */ _t351 = _t350 & 0x00000001u;
         /* 020BA7C8 */ if (_t351) goto L_020BA7DC; else goto L_020BA7CC;
   L_020BA7CC: ; // 0x20ba7cc
         /* 020BA7CC */ _t352 = cpu->r[12] + 0x00000000u;
         /* 020BA7CC */ cpu->r[11] = rbrew_read8(cpu->mem, _t352);
-        /* 020BA7D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[24]);
-        /* 020BA7D4 */ _t353 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA7D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[24]));
+        /* 020BA7D4 */ _t353 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA7D4 */ _t354 = _t353 & 0x00000001u;
         /* 020BA7D4 */ if (_t354) goto L_020BA7D8; else goto L_020BA7BC;
   L_020BA7D8: ; // 0x20ba7d8
@@ -22988,8 +22988,8 @@ void Gambit_fn_020B9D84(CPUState* cpu) {
   L_020BA7E0: ; // 0x20ba7e0
         /* 020BA7E0 */ _t355 = cpu->r[30] + 0x00000008u;
         /* 020BA7E0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t355);
-        /* 020BA7E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
-        /* 020BA7E8 */ _t356 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BA7E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
+        /* 020BA7E8 */ _t356 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BA7E8 */ _t357 = _t356 & 0x00000001u;
         /* 020BA7E8 */ if (_t357) goto L_020BA7F0; else goto L_020BA7EC;
   L_020BA7EC: ; // 0x20ba7ec
@@ -23064,20 +23064,20 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020B9D8C */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020B9D90 */ /* nop */
         /* 020B9D94 */ cpu->r[29] = cpu->r[3];
-        /* 020B9D94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020B9D94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020B9D98 */ cpu->r[28] = cpu->r[4];
         /* 020B9D9C */ cpu->r[25] = cpu->r[5];
         /* 020B9DA0 */ cpu->r[30] = cpu->r[6];
         /* 020B9DA4 */ cpu->r[31] = cpu->r[7];
-        /* 020B9DA8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9DA8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9DA8 */ _t3 = _t2 & 0x00000001u;
         /* 020B9DA8 */ if (_t3) goto L_020B9DAC; else goto L_020B9DBC;
   L_020B9DAC: ; // 0x20b9dac
         /* 020B9DAC */ cpu->r[3] = 0x0000028Cu;
         /* 020B9DB0 */ Gambit_fn_02801A78(cpu);
         /* 020B9DB4 */ cpu->r[29] = cpu->r[3];
-        /* 020B9DB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020B9DB8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9DB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020B9DB8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9DB8 */ _t5 = _t4 & 0x00000001u;
         /* 020B9DB8 */ if (_t5) goto L_020BA870; else goto L_020B9DBC;
   L_020B9DBC: ; // 0x20b9dbc
@@ -23104,22 +23104,22 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020B9DFC */ rbrew_write32(cpu->mem, _t9, cpu->r[6]);
         /* 020B9E00 */ cpu->r[8] = cpu->r[8] + 0x0000534Cu;
         /* 020B9E04 */ cpu->r[27] = cpu->r[29] + 0x000001DCu;
-        /* 020B9E04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020B9E04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020B9E08 */ _t10 = cpu->r[29] + 0x0000001Cu;
         /* 020B9E08 */ rbrew_write32(cpu->mem, _t10, cpu->r[7]);
         /* 020B9E0C */ cpu->r[28] = 0x00000000u;
         /* 020B9E10 */ cpu->r[31] = cpu->r[27];
         /* 020B9E14 */ _t11 = cpu->r[29] + 0x000001C8u;
         /* 020B9E14 */ rbrew_write32(cpu->mem, _t11, cpu->r[8]);
-        /* 020B9E18 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9E18 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9E18 */ _t13 = _t12 & 0x00000001u;
         /* 020B9E18 */ if (_t13) goto L_020B9E1C; else goto L_020B9E2C;
   L_020B9E1C: ; // 0x20b9e1c
         /* 020B9E1C */ cpu->r[3] = 0x00000038u;
         /* 020B9E20 */ Gambit_fn_02801A78(cpu);
         /* 020B9E24 */ cpu->r[31] = cpu->r[3];
-        /* 020B9E24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020B9E28 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9E24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020B9E28 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9E28 */ _t15 = _t14 & 0x00000001u;
         /* 020B9E28 */ if (_t15) goto L_020B9E5C; else goto L_020B9E2C;
   L_020B9E2C: ; // 0x20b9e2c
@@ -23153,48 +23153,48 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020B9E70 */ cpu->r[10] = 0xFFFFFFFFu;
         /* 020B9E74 */ cpu->r[23] = 0x10010000u;
         /* 020B9E78 */ cpu->r[20] = cpu->r[29] + 0x00000220u;
-        /* 020B9E78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
+        /* 020B9E78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
         /* 020B9E7C */ _t25 = cpu->r[29] + 0x00000218u;
         /* 020B9E7C */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
         /* 020B9E80 */ cpu->r[23] = cpu->r[23] + 0x00004FD8u;
         /* 020B9E84 */ cpu->r[22] = cpu->r[22] + 0x00004FF0u;
         /* 020B9E88 */ _t26 = cpu->r[29] + 0x0000021Cu;
         /* 020B9E88 */ rbrew_write32(cpu->mem, _t26, cpu->r[10]);
-        /* 020B9E8C */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9E8C */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9E8C */ _t28 = _t27 & 0x00000001u;
         /* 020B9E8C */ if (_t28) goto L_020B9E90; else goto L_020B9EB4;
   L_020B9E90: ; // 0x20b9e90
         /* 020B9E90 */ cpu->r[3] = 0x0000002Cu;
         /* 020B9E94 */ Gambit_fn_02801A78(cpu);
         /* 020B9E98 */ cpu->r[20] = cpu->r[3];
-        /* 020B9E98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
-        /* 020B9E9C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9E98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
+        /* 020B9E9C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9E9C */ _t30 = _t29 & 0x00000001u;
         /* 020B9E9C */ if (_t30) goto L_020B9EA0; else goto L_020B9EB4;
   L_020B9EA0: ; // 0x20b9ea0
         /* 020B9EA0 */ _t31 = cpu->r[31] + 0x00007399u;
         /* 020B9EA0 */ cpu->r[24] = rbrew_read8(cpu->mem, _t31);
         /* 020B9EA4 */ cpu->r[25] = cpu->r[29] + 0x00000250u;
-        /* 020B9EA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 020B9EA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 020B9EA8 */ _t32 = cpu->r[29] + 0x0000024Cu;
         /* 020B9EA8 */ rbrew_write32(cpu->mem, _t32, cpu->r[28]);
-        /* 020B9EAC */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9EAC */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9EAC */ _t34 = _t33 & 0x00000001u;
         /* 020B9EAC */ if (_t34) goto L_020B9EB0; else goto L_020B9FFC;
   L_020B9EB0: ; // 0x20b9eb0
         /* 020B9EB0 */ goto L_020B9FEC;
   L_020B9EB4: ; // 0x20b9eb4
         /* 020B9EB4 */ cpu->r[19] = cpu->r[20];
-        /* 020B9EB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[19], 0x00000000u);
-        /* 020B9EB8 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9EB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[19], 0x00000000u));
+        /* 020B9EB8 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9EB8 */ _t36 = _t35 & 0x00000001u;
         /* 020B9EB8 */ if (_t36) goto L_020B9EBC; else goto L_020B9ED8;
   L_020B9EBC: ; // 0x20b9ebc
         /* 020B9EBC */ cpu->r[3] = 0x0000002Cu;
         /* 020B9EC0 */ Gambit_fn_02801A78(cpu);
         /* 020B9EC4 */ cpu->r[19] = cpu->r[3];
-        /* 020B9EC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[19], 0x00000000u);
-        /* 020B9EC8 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9EC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[19], 0x00000000u));
+        /* 020B9EC8 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9EC8 */ _t38 = _t37 & 0x00000001u;
         /* 020B9EC8 */ if (_t38) goto L_020B9ECC; else goto L_020B9ED8;
   L_020B9ECC: ; // 0x20b9ecc
@@ -23205,15 +23205,15 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020B9ED4 */ goto L_020B9FE0;
   L_020B9ED8: ; // 0x20b9ed8
         /* 020B9ED8 */ cpu->r[3] = cpu->r[19];
-        /* 020B9ED8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B9EDC */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9ED8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B9EDC */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9EDC */ _t42 = _t41 & 0x00000001u;
         /* 020B9EDC */ if (_t42) goto L_020B9EE0; else goto L_020B9F2C;
   L_020B9EE0: ; // 0x20b9ee0
         /* 020B9EE0 */ cpu->r[3] = 0x0000000Cu;
         /* 020B9EE4 */ Gambit_fn_02801A78(cpu);
-        /* 020B9EE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020B9EEC */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9EE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020B9EEC */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9EEC */ _t44 = _t43 & 0x00000001u;
         /* 020B9EEC */ if (_t44) goto L_020B9EF0; else goto L_020B9F2C;
   L_020B9EF0: ; // 0x20b9ef0
@@ -23235,9 +23235,9 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020B9F14 */ _t51 = cpu->r[4] + 0x00000000u;
         /* 020B9F14 */ cpu->r[11] = rbrew_read8(cpu->mem, _t51);
         /* 020B9F18 */ cpu->r[31] = 0x00000000u;
-        /* 020B9F1C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[24]);
+        /* 020B9F1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[24]));
         /* 020B9F20 */ cpu->r[5] = 0x00080000u;
-        /* 020B9F24 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9F24 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9F24 */ _t53 = _t52 & 0x00000001u;
         /* 020B9F24 */ if (_t53) goto L_020B9F28; else goto L_020B9F7C;
   L_020B9F28: ; // 0x20b9f28
@@ -23271,23 +23271,23 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020B9F68 */ _t64 = cpu->r[4] + 0x00000000u;
         /* 020B9F68 */ cpu->r[11] = rbrew_read8(cpu->mem, _t64);
         /* 020B9F6C */ cpu->r[31] = 0x00000000u;
-        /* 020B9F70 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[24]);
+        /* 020B9F70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[24]));
         /* 020B9F74 */ cpu->r[5] = 0x00080000u;
-        /* 020B9F78 */ _t65 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9F78 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9F78 */ _t66 = _t65 & 0x00000001u;
         /* 020B9F78 */ if (_t66) goto L_020B9F28; else goto L_020B9F7C;
   L_020B9F7C: ; // 0x20b9f7c
         /* 020B9F7C */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020B9F80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 020B9F80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 020B9F84 */ cpu->r[4] = cpu->r[4] + 0x00000001u;
-        /* 020B9F88 */ _t67 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020B9F88 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020B9F88 */ _t68 = _t67 & 0x00000001u;
         /* 020B9F88 */ if (_t68) goto L_020B9F9C; else goto L_020B9F8C;
   L_020B9F8C: ; // 0x20b9f8c
         /* 020B9F8C */ _t69 = cpu->r[4] + 0x00000000u;
         /* 020B9F8C */ cpu->r[0] = rbrew_read8(cpu->mem, _t69);
-        /* 020B9F90 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[24]);
-        /* 020B9F94 */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9F90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[24]));
+        /* 020B9F94 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9F94 */ _t71 = _t70 & 0x00000001u;
         /* 020B9F94 */ if (_t71) goto L_020B9F98; else goto L_020B9F7C;
   L_020B9F98: ; // 0x20b9f98
@@ -23299,10 +23299,10 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020B9FA0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t72);
         /* 020B9FA4 */ _t73 = cpu->r[25] + 0x00000004u;
         /* 020B9FA4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t73);
-        /* 020B9FA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 020B9FA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 020B9FAC */ _t74 = cpu->r[5] + 0x00000014u;
         /* 020B9FAC */ cpu->r[6] = rbrew_read32(cpu->mem, _t74);
-        /* 020B9FB0 */ _t75 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020B9FB0 */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020B9FB0 */ _t76 = _t75 & 0x00000001u;
         /* 020B9FB0 */ if (_t76) goto L_020B9FB8; else goto L_020B9FB4;
   L_020B9FB4: ; // 0x20b9fb4
@@ -23323,45 +23323,45 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020B9FDC */ rbrew_write32(cpu->mem, _t79, cpu->r[21]);
   L_020B9FE0: ; // 0x20b9fe0
         /* 020B9FE0 */ cpu->r[25] = cpu->r[29] + 0x00000250u;
-        /* 020B9FE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 020B9FE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 020B9FE4 */ _t80 = cpu->r[29] + 0x0000024Cu;
         /* 020B9FE4 */ rbrew_write32(cpu->mem, _t80, cpu->r[28]);
-        /* 020B9FE8 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9FE8 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9FE8 */ _t82 = _t81 & 0x00000001u;
         /* 020B9FE8 */ if (_t82) goto L_020B9FEC; else goto L_020B9FFC;
   L_020B9FEC: ; // 0x20b9fec
         /* 020B9FEC */ cpu->r[3] = 0x0000002Cu;
         /* 020B9FF0 */ Gambit_fn_02801A78(cpu);
         /* 020B9FF4 */ cpu->r[25] = cpu->r[3];
-        /* 020B9FF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 020B9FF8 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9FF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 020B9FF8 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020B9FF8 */ _t84 = _t83 & 0x00000001u;
         /* 020B9FF8 */ if (_t84) goto L_020BA0DC; else goto L_020B9FFC;
   L_020B9FFC: ; // 0x20b9ffc
         /* 020B9FFC */ cpu->r[20] = cpu->r[25];
-        /* 020B9FFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
-        /* 020BA000 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020B9FFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
+        /* 020BA000 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA000 */ _t86 = _t85 & 0x00000001u;
         /* 020BA000 */ if (_t86) goto L_020BA004; else goto L_020BA014;
   L_020BA004: ; // 0x20ba004
         /* 020BA004 */ cpu->r[3] = 0x0000002Cu;
         /* 020BA008 */ Gambit_fn_02801A78(cpu);
         /* 020BA00C */ cpu->r[20] = cpu->r[3];
-        /* 020BA00C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
-        /* 020BA010 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA00C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
+        /* 020BA010 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA010 */ _t88 = _t87 & 0x00000001u;
         /* 020BA010 */ if (_t88) goto L_020BA0D8; else goto L_020BA014;
   L_020BA014: ; // 0x20ba014
         /* 020BA014 */ cpu->r[3] = cpu->r[20];
-        /* 020BA014 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BA018 */ _t89 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA014 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BA018 */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA018 */ _t90 = _t89 & 0x00000001u;
         /* 020BA018 */ if (_t90) goto L_020BA01C; else goto L_020BA02C;
   L_020BA01C: ; // 0x20ba01c
         /* 020BA01C */ cpu->r[3] = 0x0000000Cu;
         /* 020BA020 */ Gambit_fn_02801A78(cpu);
-        /* 020BA024 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BA028 */ _t91 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA024 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BA028 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA028 */ _t92 = _t91 & 0x00000001u;
         /* 020BA028 */ if (_t92) goto L_020BA044; else goto L_020BA02C;
   L_020BA02C: ; // 0x20ba02c
@@ -23392,23 +23392,23 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020BA064 */ _t102 = cpu->r[9] + 0x00000000u;
         /* 020BA064 */ cpu->r[0] = rbrew_read8(cpu->mem, _t102);
         /* 020BA068 */ cpu->r[31] = 0x00000000u;
-        /* 020BA06C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[24]);
+        /* 020BA06C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[24]));
         /* 020BA070 */ cpu->r[0] = 0x00080000u;
-        /* 020BA074 */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA074 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA074 */ _t104 = _t103 & 0x00000001u;
         /* 020BA074 */ if (_t104) goto L_020BA09C; else goto L_020BA078;
   L_020BA078: ; // 0x20ba078
         /* 020BA078 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020BA07C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 020BA07C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 020BA080 */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 020BA084 */ _t105 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA084 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA084 */ _t106 = _t105 & 0x00000001u;
         /* 020BA084 */ if (_t106) goto L_020BA098; else goto L_020BA088;
   L_020BA088: ; // 0x20ba088
         /* 020BA088 */ _t107 = cpu->r[9] + 0x00000000u;
         /* 020BA088 */ cpu->r[11] = rbrew_read8(cpu->mem, _t107);
-        /* 020BA08C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[24]);
-        /* 020BA090 */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA08C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[24]));
+        /* 020BA090 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA090 */ _t109 = _t108 & 0x00000001u;
         /* 020BA090 */ if (_t109) goto L_020BA094; else goto L_020BA078;
   L_020BA094: ; // 0x20ba094
@@ -23420,10 +23420,10 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020BA09C */ cpu->r[9] = rbrew_read32(cpu->mem, _t110);
         /* 020BA0A0 */ _t111 = cpu->r[30] + 0x00000004u;
         /* 020BA0A0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t111);
-        /* 020BA0A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 020BA0A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 020BA0A8 */ _t112 = cpu->r[12] + 0x00000014u;
         /* 020BA0A8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t112);
-        /* 020BA0AC */ _t113 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BA0AC */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BA0AC */ _t114 = _t113 & 0x00000001u;
         /* 020BA0AC */ if (_t114) goto L_020BA0B4; else goto L_020BA0B0;
   L_020BA0B0: ; // 0x20ba0b0
@@ -23465,8 +23465,8 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020BA108 */ cpu->r[10] = rbrew_read32(cpu->mem, _t124);
         /* 020BA10C */ _t125 = cpu->r[10] + 0x00000178u;
         /* 020BA10C */ cpu->r[8] = rbrew_read32(cpu->mem, _t125);
-        /* 020BA110 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 020BA114 */ _t126 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA110 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 020BA114 */ _t126 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA114 */ _t127 = _t126 & 0x00000001u;
         /* 020BA114 */ if (_t127) goto L_020BA150; else goto L_020BA118;
   L_020BA118: ; // 0x20ba118
@@ -23474,10 +23474,10 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020BA118 */ cpu->r[9] = rbrew_read32(cpu->mem, _t128);
         /* 020BA11C */ _t129 = cpu->r[10] + 0x00000170u;
         /* 020BA11C */ cpu->r[0] = rbrew_read32(cpu->mem, _t129);
-        /* 020BA120 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], cpu->r[0]);
+        /* 020BA120 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], cpu->r[0]));
         /* 020BA124 */ _t130 = cpu->r[10] + 0x0000016Cu;
         /* 020BA124 */ cpu->r[12] = rbrew_read32(cpu->mem, _t130);
-        /* 020BA128 */ _t131 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BA128 */ _t131 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BA128 */ _t132 = _t131 & 0x00000001u;
         /* 020BA128 */ if (_t132) goto L_020BA130; else goto L_020BA12C;
   L_020BA12C: ; // 0x20ba12c
@@ -23490,8 +23490,8 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020BA13C */ _t134 = cpu->r[29] + 0x00000288u;
         /* 020BA13C */ rbrew_write32(cpu->mem, _t134, cpu->r[9]);
         /* 020BA140 */ Gambit_fn_02801A78(cpu);
-        /* 020BA144 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BA148 */ _t135 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BA148 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA148 */ _t136 = _t135 & 0x00000001u;
         /* 020BA148 */ if (_t136) goto L_020BA170; else goto L_020BA14C;
   L_020BA14C: ; // 0x20ba14c
@@ -23505,8 +23505,8 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020BA15C */ _t139 = cpu->r[29] + 0x00000288u;
         /* 020BA15C */ rbrew_write32(cpu->mem, _t139, cpu->r[9]);
         /* 020BA160 */ Gambit_fn_02801A78(cpu);
-        /* 020BA164 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BA168 */ _t140 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA164 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BA168 */ _t140 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA168 */ _t141 = _t140 & 0x00000001u;
         /* 020BA168 */ if (_t141) goto L_020BA170; else goto L_020BA16C;
   L_020BA16C: ; // 0x20ba16c
@@ -23542,23 +23542,23 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020BA1C0 */ _t149 = cpu->r[4] + 0x00000000u;
         /* 020BA1C0 */ cpu->r[8] = rbrew_read8(cpu->mem, _t149);
         /* 020BA1C4 */ cpu->r[31] = 0x00000000u;
-        /* 020BA1C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[24]);
+        /* 020BA1C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[24]));
         /* 020BA1CC */ cpu->r[6] = 0x00080000u;
-        /* 020BA1D0 */ _t150 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA1D0 */ _t150 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA1D0 */ _t151 = _t150 & 0x00000001u;
         /* 020BA1D0 */ if (_t151) goto L_020BA1F8; else goto L_020BA1D4;
   L_020BA1D4: ; // 0x20ba1d4
         /* 020BA1D4 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020BA1D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 020BA1D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 020BA1DC */ cpu->r[4] = cpu->r[4] + 0x00000001u;
-        /* 020BA1E0 */ _t152 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA1E0 */ _t152 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA1E0 */ _t153 = _t152 & 0x00000001u;
         /* 020BA1E0 */ if (_t153) goto L_020BA1F4; else goto L_020BA1E4;
   L_020BA1E4: ; // 0x20ba1e4
         /* 020BA1E4 */ _t154 = cpu->r[4] + 0x00000000u;
         /* 020BA1E4 */ cpu->r[10] = rbrew_read8(cpu->mem, _t154);
-        /* 020BA1E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[24]);
-        /* 020BA1EC */ _t155 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA1E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[24]));
+        /* 020BA1EC */ _t155 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA1EC */ _t156 = _t155 & 0x00000001u;
         /* 020BA1EC */ if (_t156) goto L_020BA1F0; else goto L_020BA1D4;
   L_020BA1F0: ; // 0x20ba1f0
@@ -23570,10 +23570,10 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020BA1F8 */ cpu->r[4] = rbrew_read32(cpu->mem, _t157);
         /* 020BA1FC */ _t158 = cpu->r[1] + 0x00000010u;
         /* 020BA1FC */ cpu->r[12] = rbrew_read32(cpu->mem, _t158);
-        /* 020BA200 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[4]);
+        /* 020BA200 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[4]));
         /* 020BA204 */ _t159 = cpu->r[12] + 0x00000014u;
         /* 020BA204 */ cpu->r[5] = rbrew_read32(cpu->mem, _t159);
-        /* 020BA208 */ _t160 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BA208 */ _t160 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BA208 */ _t161 = _t160 & 0x00000001u;
         /* 020BA208 */ if (_t161) goto L_020BA210; else goto L_020BA20C;
   L_020BA20C: ; // 0x20ba20c
@@ -23628,10 +23628,10 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020BA290 */ rbrew_write32(cpu->mem, _t175, cpu->r[0]);
         /* 020BA294 */ _t176 = cpu->r[27] + 0x00000014u;
         /* 020BA294 */ cpu->r[0] = rbrew_read32(cpu->mem, _t176);
-        /* 020BA298 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 020BA298 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 020BA29C */ _t177 = cpu->r[27] + 0x00000018u;
         /* 020BA29C */ cpu->r[30] = rbrew_read32(cpu->mem, _t177);
-        /* 020BA2A0 */ _t178 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA2A0 */ _t178 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA2A0 */ _t179 = _t178 & 0x00000001u;
         /* 020BA2A0 */ if (_t179) goto L_020BA2A4; else goto L_020BA2A8;
   L_020BA2A4: ; // 0x20ba2a4
@@ -23647,23 +23647,23 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020BA2BC */ _t182 = cpu->r[8] + 0x00000000u;
         /* 020BA2BC */ cpu->r[6] = rbrew_read8(cpu->mem, _t182);
         /* 020BA2C0 */ cpu->r[31] = 0x00000000u;
-        /* 020BA2C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[24]);
+        /* 020BA2C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[24]));
         /* 020BA2C8 */ cpu->r[10] = 0x00080000u;
-        /* 020BA2CC */ _t183 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA2CC */ _t183 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA2CC */ _t184 = _t183 & 0x00000001u;
         /* 020BA2CC */ if (_t184) goto L_020BA2F4; else goto L_020BA2D0;
   L_020BA2D0: ; // 0x20ba2d0
         /* 020BA2D0 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020BA2D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 020BA2D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 020BA2D8 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 020BA2DC */ _t185 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA2DC */ _t185 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA2DC */ _t186 = _t185 & 0x00000001u;
         /* 020BA2DC */ if (_t186) goto L_020BA2F0; else goto L_020BA2E0;
   L_020BA2E0: ; // 0x20ba2e0
         /* 020BA2E0 */ _t187 = cpu->r[8] + 0x00000000u;
         /* 020BA2E0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t187);
-        /* 020BA2E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[24]);
-        /* 020BA2E8 */ _t188 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA2E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[24]));
+        /* 020BA2E8 */ _t188 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA2E8 */ _t189 = _t188 & 0x00000001u;
         /* 020BA2E8 */ if (_t189) goto L_020BA2EC; else goto L_020BA2D0;
   L_020BA2EC: ; // 0x20ba2ec
@@ -23675,10 +23675,10 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020BA2F4 */ cpu->r[6] = rbrew_read32(cpu->mem, _t190);
         /* 020BA2F8 */ _t191 = cpu->r[1] + 0x00000010u;
         /* 020BA2F8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t191);
-        /* 020BA2FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 020BA2FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 020BA300 */ _t192 = cpu->r[8] + 0x00000014u;
         /* 020BA300 */ cpu->r[0] = rbrew_read32(cpu->mem, _t192);
-        /* 020BA304 */ _t193 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BA304 */ _t193 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BA304 */ _t194 = _t193 & 0x00000001u;
         /* 020BA304 */ if (_t194) goto L_020BA30C; else goto L_020BA308;
   L_020BA308: ; // 0x20ba308
@@ -23733,10 +23733,10 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020BA38C */ rbrew_write32(cpu->mem, _t208, cpu->r[11]);
         /* 020BA390 */ _t209 = cpu->r[27] + 0x00000014u;
         /* 020BA390 */ cpu->r[0] = rbrew_read32(cpu->mem, _t209);
-        /* 020BA394 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000002u);
+        /* 020BA394 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000002u));
         /* 020BA398 */ _t210 = cpu->r[27] + 0x00000018u;
         /* 020BA398 */ cpu->r[30] = rbrew_read32(cpu->mem, _t210);
-        /* 020BA39C */ _t211 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA39C */ _t211 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA39C */ _t212 = _t211 & 0x00000001u;
         /* 020BA39C */ if (_t212) goto L_020BA3A0; else goto L_020BA3A4;
   L_020BA3A0: ; // 0x20ba3a0
@@ -23752,23 +23752,23 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020BA3B8 */ _t215 = cpu->r[12] + 0x00000000u;
         /* 020BA3B8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t215);
         /* 020BA3BC */ cpu->r[31] = 0x00000000u;
-        /* 020BA3C0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[24]);
+        /* 020BA3C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[24]));
         /* 020BA3C4 */ cpu->r[5] = 0x00080000u;
-        /* 020BA3C8 */ _t216 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA3C8 */ _t216 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA3C8 */ _t217 = _t216 & 0x00000001u;
         /* 020BA3C8 */ if (_t217) goto L_020BA3F0; else goto L_020BA3CC;
   L_020BA3CC: ; // 0x20ba3cc
         /* 020BA3CC */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020BA3D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 020BA3D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 020BA3D4 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 020BA3D8 */ _t218 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA3D8 */ _t218 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA3D8 */ _t219 = _t218 & 0x00000001u;
         /* 020BA3D8 */ if (_t219) goto L_020BA3EC; else goto L_020BA3DC;
   L_020BA3DC: ; // 0x20ba3dc
         /* 020BA3DC */ _t220 = cpu->r[12] + 0x00000000u;
         /* 020BA3DC */ cpu->r[4] = rbrew_read8(cpu->mem, _t220);
-        /* 020BA3E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[24]);
-        /* 020BA3E4 */ _t221 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA3E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[24]));
+        /* 020BA3E4 */ _t221 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA3E4 */ _t222 = _t221 & 0x00000001u;
         /* 020BA3E4 */ if (_t222) goto L_020BA3E8; else goto L_020BA3CC;
   L_020BA3E8: ; // 0x20ba3e8
@@ -23780,10 +23780,10 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020BA3F0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t223);
         /* 020BA3F4 */ _t224 = cpu->r[1] + 0x00000010u;
         /* 020BA3F4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t224);
-        /* 020BA3F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 020BA3F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 020BA3FC */ _t225 = cpu->r[5] + 0x00000014u;
         /* 020BA3FC */ cpu->r[6] = rbrew_read32(cpu->mem, _t225);
-        /* 020BA400 */ _t226 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BA400 */ _t226 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BA400 */ _t227 = _t226 & 0x00000001u;
         /* 020BA400 */ if (_t227) goto L_020BA408; else goto L_020BA404;
   L_020BA404: ; // 0x20ba404
@@ -23838,10 +23838,10 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020BA488 */ rbrew_write32(cpu->mem, _t241, cpu->r[8]);
         /* 020BA48C */ _t242 = cpu->r[27] + 0x00000014u;
         /* 020BA48C */ cpu->r[9] = rbrew_read32(cpu->mem, _t242);
-        /* 020BA490 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000003u);
+        /* 020BA490 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000003u));
         /* 020BA494 */ _t243 = cpu->r[27] + 0x00000018u;
         /* 020BA494 */ cpu->r[30] = rbrew_read32(cpu->mem, _t243);
-        /* 020BA498 */ _t244 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA498 */ _t244 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA498 */ _t245 = _t244 & 0x00000001u;
         /* 020BA498 */ if (_t245) goto L_020BA49C; else goto L_020BA4A0;
   L_020BA49C: ; // 0x20ba49c
@@ -23857,23 +23857,23 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020BA4B4 */ _t248 = cpu->r[8] + 0x00000000u;
         /* 020BA4B4 */ cpu->r[10] = rbrew_read8(cpu->mem, _t248);
         /* 020BA4B8 */ cpu->r[31] = 0x00000000u;
-        /* 020BA4BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[24]);
+        /* 020BA4BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[24]));
         /* 020BA4C0 */ cpu->r[10] = 0x00080000u;
-        /* 020BA4C4 */ _t249 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA4C4 */ _t249 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA4C4 */ _t250 = _t249 & 0x00000001u;
         /* 020BA4C4 */ if (_t250) goto L_020BA4EC; else goto L_020BA4C8;
   L_020BA4C8: ; // 0x20ba4c8
         /* 020BA4C8 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020BA4CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 020BA4CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 020BA4D0 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 020BA4D4 */ _t251 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA4D4 */ _t251 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA4D4 */ _t252 = _t251 & 0x00000001u;
         /* 020BA4D4 */ if (_t252) goto L_020BA4E8; else goto L_020BA4D8;
   L_020BA4D8: ; // 0x20ba4d8
         /* 020BA4D8 */ _t253 = cpu->r[8] + 0x00000000u;
         /* 020BA4D8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t253);
-        /* 020BA4DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[24]);
-        /* 020BA4E0 */ _t254 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA4DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[24]));
+        /* 020BA4E0 */ _t254 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA4E0 */ _t255 = _t254 & 0x00000001u;
         /* 020BA4E0 */ if (_t255) goto L_020BA4E4; else goto L_020BA4C8;
   L_020BA4E4: ; // 0x20ba4e4
@@ -23885,10 +23885,10 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020BA4EC */ cpu->r[9] = rbrew_read32(cpu->mem, _t256);
         /* 020BA4F0 */ _t257 = cpu->r[1] + 0x00000010u;
         /* 020BA4F0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t257);
-        /* 020BA4F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 020BA4F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 020BA4F8 */ _t258 = cpu->r[12] + 0x00000014u;
         /* 020BA4F8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t258);
-        /* 020BA4FC */ _t259 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BA4FC */ _t259 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BA4FC */ _t260 = _t259 & 0x00000001u;
         /* 020BA4FC */ if (_t260) goto L_020BA504; else goto L_020BA500;
   L_020BA500: ; // 0x20ba500
@@ -23943,10 +23943,10 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020BA584 */ rbrew_write32(cpu->mem, _t274, cpu->r[6]);
         /* 020BA588 */ _t275 = cpu->r[27] + 0x00000014u;
         /* 020BA588 */ cpu->r[7] = rbrew_read32(cpu->mem, _t275);
-        /* 020BA58C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x00000004u);
+        /* 020BA58C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x00000004u));
         /* 020BA590 */ _t276 = cpu->r[27] + 0x00000018u;
         /* 020BA590 */ cpu->r[30] = rbrew_read32(cpu->mem, _t276);
-        /* 020BA594 */ _t277 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA594 */ _t277 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA594 */ _t278 = _t277 & 0x00000001u;
         /* 020BA594 */ if (_t278) goto L_020BA598; else goto L_020BA59C;
   L_020BA598: ; // 0x20ba598
@@ -23962,23 +23962,23 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020BA5B0 */ _t281 = cpu->r[12] + 0x00000000u;
         /* 020BA5B0 */ cpu->r[8] = rbrew_read8(cpu->mem, _t281);
         /* 020BA5B4 */ cpu->r[31] = 0x00000000u;
-        /* 020BA5B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[24]);
+        /* 020BA5B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[24]));
         /* 020BA5BC */ cpu->r[4] = 0x00080000u;
-        /* 020BA5C0 */ _t282 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA5C0 */ _t282 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA5C0 */ _t283 = _t282 & 0x00000001u;
         /* 020BA5C0 */ if (_t283) goto L_020BA5E8; else goto L_020BA5C4;
   L_020BA5C4: ; // 0x20ba5c4
         /* 020BA5C4 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020BA5C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[4]);
+        /* 020BA5C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[4]));
         /* 020BA5CC */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 020BA5D0 */ _t284 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA5D0 */ _t284 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA5D0 */ _t285 = _t284 & 0x00000001u;
         /* 020BA5D0 */ if (_t285) goto L_020BA5E4; else goto L_020BA5D4;
   L_020BA5D4: ; // 0x20ba5d4
         /* 020BA5D4 */ _t286 = cpu->r[12] + 0x00000000u;
         /* 020BA5D4 */ cpu->r[9] = rbrew_read8(cpu->mem, _t286);
-        /* 020BA5D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[24]);
-        /* 020BA5DC */ _t287 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA5D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[24]));
+        /* 020BA5DC */ _t287 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA5DC */ _t288 = _t287 & 0x00000001u;
         /* 020BA5DC */ if (_t288) goto L_020BA5E0; else goto L_020BA5C4;
   L_020BA5E0: ; // 0x20ba5e0
@@ -23988,8 +23988,8 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
   L_020BA5E8: ; // 0x20ba5e8
         /* 020BA5E8 */ _t289 = cpu->r[30] + 0x00000008u;
         /* 020BA5E8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t289);
-        /* 020BA5EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
-        /* 020BA5F0 */ _t290 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BA5EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
+        /* 020BA5F0 */ _t290 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BA5F0 */ _t291 = _t290 & 0x00000001u;
         /* 020BA5F0 */ if (_t291) goto L_020BA5F8; else goto L_020BA5F4;
   L_020BA5F4: ; // 0x20ba5f4
@@ -24048,10 +24048,10 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020BA680 */ rbrew_write32(cpu->mem, _t307, cpu->r[0]);
         /* 020BA684 */ _t308 = cpu->r[27] + 0x00000014u;
         /* 020BA684 */ cpu->r[0] = rbrew_read32(cpu->mem, _t308);
-        /* 020BA688 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
+        /* 020BA688 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
         /* 020BA68C */ _t309 = cpu->r[27] + 0x00000018u;
         /* 020BA68C */ cpu->r[30] = rbrew_read32(cpu->mem, _t309);
-        /* 020BA690 */ _t310 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA690 */ _t310 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA690 */ _t311 = _t310 & 0x00000001u;
         /* 020BA690 */ if (_t311) goto L_020BA694; else goto L_020BA698;
   L_020BA694: ; // 0x20ba694
@@ -24067,23 +24067,23 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020BA6AC */ _t314 = cpu->r[8] + 0x00000000u;
         /* 020BA6AC */ cpu->r[5] = rbrew_read8(cpu->mem, _t314);
         /* 020BA6B0 */ cpu->r[31] = 0x00000000u;
-        /* 020BA6B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[24]);
+        /* 020BA6B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[24]));
         /* 020BA6B8 */ cpu->r[10] = 0x00080000u;
-        /* 020BA6BC */ _t315 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA6BC */ _t315 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA6BC */ _t316 = _t315 & 0x00000001u;
         /* 020BA6BC */ if (_t316) goto L_020BA6E4; else goto L_020BA6C0;
   L_020BA6C0: ; // 0x20ba6c0
         /* 020BA6C0 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020BA6C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 020BA6C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 020BA6C8 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 020BA6CC */ _t317 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA6CC */ _t317 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA6CC */ _t318 = _t317 & 0x00000001u;
         /* 020BA6CC */ if (_t318) goto L_020BA6E0; else goto L_020BA6D0;
   L_020BA6D0: ; // 0x20ba6d0
         /* 020BA6D0 */ _t319 = cpu->r[8] + 0x00000000u;
         /* 020BA6D0 */ cpu->r[6] = rbrew_read8(cpu->mem, _t319);
-        /* 020BA6D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[24]);
-        /* 020BA6D8 */ _t320 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA6D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[24]));
+        /* 020BA6D8 */ _t320 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA6D8 */ _t321 = _t320 & 0x00000001u;
         /* 020BA6D8 */ if (_t321) goto L_020BA6DC; else goto L_020BA6C0;
   L_020BA6DC: ; // 0x20ba6dc
@@ -24095,10 +24095,10 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020BA6E4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t322);
         /* 020BA6E8 */ _t323 = cpu->r[1] + 0x00000010u;
         /* 020BA6E8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t323);
-        /* 020BA6EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 020BA6EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 020BA6F0 */ _t324 = cpu->r[7] + 0x00000014u;
         /* 020BA6F0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t324);
-        /* 020BA6F4 */ _t325 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BA6F4 */ _t325 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BA6F4 */ _t326 = _t325 & 0x00000001u;
         /* 020BA6F4 */ if (_t326) goto L_020BA6FC; else goto L_020BA6F8;
   L_020BA6F8: ; // 0x20ba6f8
@@ -24153,10 +24153,10 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020BA77C */ rbrew_write32(cpu->mem, _t340, cpu->r[7]);
         /* 020BA780 */ _t341 = cpu->r[27] + 0x00000014u;
         /* 020BA780 */ cpu->r[8] = rbrew_read32(cpu->mem, _t341);
-        /* 020BA784 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000006u);
+        /* 020BA784 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000006u));
         /* 020BA788 */ _t342 = cpu->r[27] + 0x00000018u;
         /* 020BA788 */ cpu->r[30] = rbrew_read32(cpu->mem, _t342);
-        /* 020BA78C */ _t343 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA78C */ _t343 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA78C */ _t344 = _t343 & 0x00000001u;
         /* 020BA78C */ if (_t344) goto L_020BA790; else goto L_020BA794;
   L_020BA790: ; // 0x20ba790
@@ -24172,23 +24172,23 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
         /* 020BA7A8 */ _t347 = cpu->r[12] + 0x00000000u;
         /* 020BA7A8 */ cpu->r[10] = rbrew_read8(cpu->mem, _t347);
         /* 020BA7AC */ cpu->r[31] = 0x00000000u;
-        /* 020BA7B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[24]);
+        /* 020BA7B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[24]));
         /* 020BA7B4 */ cpu->r[5] = 0x00080000u;
-        /* 020BA7B8 */ _t348 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA7B8 */ _t348 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA7B8 */ _t349 = _t348 & 0x00000001u;
         /* 020BA7B8 */ if (_t349) goto L_020BA7E0; else goto L_020BA7BC;
   L_020BA7BC: ; // 0x20ba7bc
         /* 020BA7BC */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020BA7C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 020BA7C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 020BA7C4 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 020BA7C8 */ _t350 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BA7C8 */ _t350 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BA7C8 */ _t351 = _t350 & 0x00000001u;
         /* 020BA7C8 */ if (_t351) goto L_020BA7DC; else goto L_020BA7CC;
   L_020BA7CC: ; // 0x20ba7cc
         /* 020BA7CC */ _t352 = cpu->r[12] + 0x00000000u;
         /* 020BA7CC */ cpu->r[11] = rbrew_read8(cpu->mem, _t352);
-        /* 020BA7D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[24]);
-        /* 020BA7D4 */ _t353 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA7D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[24]));
+        /* 020BA7D4 */ _t353 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA7D4 */ _t354 = _t353 & 0x00000001u;
         /* 020BA7D4 */ if (_t354) goto L_020BA7D8; else goto L_020BA7BC;
   L_020BA7D8: ; // 0x20ba7d8
@@ -24198,8 +24198,8 @@ void Gambit_fn_020B9D88(CPUState* cpu) {
   L_020BA7E0: ; // 0x20ba7e0
         /* 020BA7E0 */ _t355 = cpu->r[30] + 0x00000008u;
         /* 020BA7E0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t355);
-        /* 020BA7E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
-        /* 020BA7E8 */ _t356 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BA7E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
+        /* 020BA7E8 */ _t356 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BA7E8 */ _t357 = _t356 & 0x00000001u;
         /* 020BA7E8 */ if (_t357) goto L_020BA7F0; else goto L_020BA7EC;
   L_020BA7EC: ; // 0x20ba7ec
@@ -24295,7 +24295,7 @@ void Gambit_fn_020BA888(CPUState* cpu) {
         /* 020BA8B8 */ rbrew_write32(cpu->mem, _t11, cpu->r[4]);
         /* 020BA8BC */ _t12 = cpu->r[1] + 0x00000020u;
         /* 020BA8BC */ rbrew_write32(cpu->mem, _t12, cpu->r[5]);
-        /* 020BA8C0 */ _t13 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BA8C0 */ _t13 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BA8C0 */ _t14 = _t13 & 0x00000001u;
         /* 020BA8C0 */ if (_t14) goto L_020BA8C4; else goto L_020BA8E4;
   L_020BA8C4: ; // 0x20ba8c4
@@ -24347,8 +24347,8 @@ void Gambit_fn_020BA888(CPUState* cpu) {
         /* 020BA934 */ _t31 = cpu->r[29] + 0x000001E8u;
         /* 020BA934 */ cpu->r[10] = rbrew_read8(cpu->mem, _t31);
         /* 020BA938 */ /* nop */
-        /* 020BA93C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000004u);
-        /* 020BA940 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA93C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000004u));
+        /* 020BA940 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA940 */ _t33 = _t32 & 0x00000001u;
         /* 020BA940 */ if (_t33) goto L_020BA944; else goto L_020BA950;
   L_020BA944: ; // 0x20ba944
@@ -24401,7 +24401,7 @@ void Gambit_fn_020BA88C(CPUState* cpu) {
         /* 020BA8B8 */ rbrew_write32(cpu->mem, _t11, cpu->r[4]);
         /* 020BA8BC */ _t12 = cpu->r[1] + 0x00000020u;
         /* 020BA8BC */ rbrew_write32(cpu->mem, _t12, cpu->r[5]);
-        /* 020BA8C0 */ _t13 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BA8C0 */ _t13 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BA8C0 */ _t14 = _t13 & 0x00000001u;
         /* 020BA8C0 */ if (_t14) goto L_020BA8C4; else goto L_020BA8E4;
   L_020BA8C4: ; // 0x20ba8c4
@@ -24453,8 +24453,8 @@ void Gambit_fn_020BA88C(CPUState* cpu) {
         /* 020BA934 */ _t31 = cpu->r[29] + 0x000001E8u;
         /* 020BA934 */ cpu->r[10] = rbrew_read8(cpu->mem, _t31);
         /* 020BA938 */ /* nop */
-        /* 020BA93C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000004u);
-        /* 020BA940 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA93C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000004u));
+        /* 020BA940 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA940 */ _t33 = _t32 & 0x00000001u;
         /* 020BA940 */ if (_t33) goto L_020BA944; else goto L_020BA950;
   L_020BA944: ; // 0x20ba944
@@ -24508,8 +24508,8 @@ void Gambit_fn_020BA96C(CPUState* cpu) {
         /* 020BA9A8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020BA9AC */ _t9 = cpu->r[29] + 0x0000027Cu;
         /* 020BA9AC */ cpu->r[3] = rbrew_read32(cpu->mem, _t9);
-        /* 020BA9B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BA9B4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA9B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BA9B4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA9B4 */ _t11 = _t10 & 0x00000001u;
         /* 020BA9B4 */ if (_t11) goto L_020BA9D0; else goto L_020BA9B8;
   L_020BA9B8: ; // 0x20ba9b8
@@ -24535,15 +24535,15 @@ void Gambit_fn_020BA96C(CPUState* cpu) {
         /* 020BA9E8 */ rbrew_write32(cpu->mem, _t17, cpu->r[3]);
         /* 020BA9EC */ _t18 = cpu->r[31] + 0x0000047Cu;
         /* 020BA9EC */ cpu->r[0] = rbrew_read8(cpu->mem, _t18);
-        /* 020BA9F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BA9F4 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA9F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BA9F4 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA9F4 */ _t20 = _t19 & 0x00000001u;
         /* 020BA9F4 */ if (_t20) goto L_020BAB04; else goto L_020BA9F8;
   L_020BA9F8: ; // 0x20ba9f8
         /* 020BA9F8 */ _t21 = cpu->r[31] + 0x00000444u;
         /* 020BA9F8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
-        /* 020BA9FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 020BAA00 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA9FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 020BAA00 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAA00 */ _t23 = _t22 & 0x00000001u;
         /* 020BAA00 */ if (_t23) goto L_020BAA04; else goto L_020BAA68;
   L_020BAA04: ; // 0x20baa04
@@ -24560,7 +24560,7 @@ void Gambit_fn_020BA96C(CPUState* cpu) {
         /* 020BAA28 */ cpu->r[6] = cpu->r[30];
         /* 020BAA2C */ cpu->r[4] = cpu->r[31];
         /* 020BAA30 */ cpu->r[3] = cpu->r[29];
-        /* 020BAA34 */ _t25 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAA34 */ _t25 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAA34 */ _t26 = _t25 & 0x00000001u;
         /* 020BAA34 */ if (_t26) goto L_020BAA38; // else: addr-0 trap, fall-through
   L_020BAA38: ; // 0x20baa38
@@ -24582,8 +24582,8 @@ void Gambit_fn_020BA96C(CPUState* cpu) {
   L_020BAA68: ; // 0x20baa68
         /* 020BAA68 */ _t30 = cpu->r[31] + 0x00000444u;
         /* 020BAA68 */ cpu->r[12] = rbrew_read32(cpu->mem, _t30);
-        /* 020BAA6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000001u);
-        /* 020BAA70 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAA6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000001u));
+        /* 020BAA70 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAA70 */ _t32 = _t31 & 0x00000001u;
         /* 020BAA70 */ if (_t32) goto L_020BAA74; else goto L_020BAAC4;
   L_020BAA74: ; // 0x20baa74
@@ -24594,7 +24594,7 @@ void Gambit_fn_020BA96C(CPUState* cpu) {
         /* 020BAA84 */ cpu->r[5] = 0x00000001u;
         /* 020BAA88 */ cpu->r[4] = cpu->r[31];
         /* 020BAA8C */ cpu->r[3] = cpu->r[29];
-        /* 020BAA90 */ _t33 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAA90 */ _t33 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAA90 */ _t34 = _t33 & 0x00000001u;
         /* 020BAA90 */ if (_t34) goto L_020BAA94; // else: addr-0 trap, fall-through
   L_020BAA94: ; // 0x20baa94
@@ -24617,7 +24617,7 @@ void Gambit_fn_020BA96C(CPUState* cpu) {
         /* 020BAAC4 */ cpu->r[5] = 0x00000000u;
         /* 020BAAC8 */ cpu->r[4] = cpu->r[31];
         /* 020BAACC */ cpu->r[3] = cpu->r[29];
-        /* 020BAAD0 */ _t38 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAAD0 */ _t38 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAAD0 */ _t39 = _t38 & 0x00000001u;
         /* 020BAAD0 */ if (_t39) goto L_020BAAD4; // else: addr-0 trap, fall-through
   L_020BAAD4: ; // 0x20baad4
@@ -24640,7 +24640,7 @@ void Gambit_fn_020BA96C(CPUState* cpu) {
         /* 020BAB04 */ cpu->r[5] = 0x00000000u;
         /* 020BAB08 */ cpu->r[4] = cpu->r[31] + 0x00000488u;
         /* 020BAB0C */ cpu->r[3] = cpu->r[29];
-        /* 020BAB10 */ _t43 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAB10 */ _t43 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAB10 */ _t44 = _t43 & 0x00000001u;
         /* 020BAB10 */ if (_t44) goto L_020BAB14; // else: addr-0 trap, fall-through
   L_020BAB14: ; // 0x20bab14
@@ -24704,8 +24704,8 @@ void Gambit_fn_020BA970(CPUState* cpu) {
         /* 020BA9A8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020BA9AC */ _t9 = cpu->r[29] + 0x0000027Cu;
         /* 020BA9AC */ cpu->r[3] = rbrew_read32(cpu->mem, _t9);
-        /* 020BA9B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BA9B4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA9B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BA9B4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA9B4 */ _t11 = _t10 & 0x00000001u;
         /* 020BA9B4 */ if (_t11) goto L_020BA9D0; else goto L_020BA9B8;
   L_020BA9B8: ; // 0x20ba9b8
@@ -24731,15 +24731,15 @@ void Gambit_fn_020BA970(CPUState* cpu) {
         /* 020BA9E8 */ rbrew_write32(cpu->mem, _t17, cpu->r[3]);
         /* 020BA9EC */ _t18 = cpu->r[31] + 0x0000047Cu;
         /* 020BA9EC */ cpu->r[0] = rbrew_read8(cpu->mem, _t18);
-        /* 020BA9F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BA9F4 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA9F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BA9F4 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BA9F4 */ _t20 = _t19 & 0x00000001u;
         /* 020BA9F4 */ if (_t20) goto L_020BAB04; else goto L_020BA9F8;
   L_020BA9F8: ; // 0x20ba9f8
         /* 020BA9F8 */ _t21 = cpu->r[31] + 0x00000444u;
         /* 020BA9F8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
-        /* 020BA9FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 020BAA00 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BA9FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 020BAA00 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAA00 */ _t23 = _t22 & 0x00000001u;
         /* 020BAA00 */ if (_t23) goto L_020BAA04; else goto L_020BAA68;
   L_020BAA04: ; // 0x20baa04
@@ -24756,7 +24756,7 @@ void Gambit_fn_020BA970(CPUState* cpu) {
         /* 020BAA28 */ cpu->r[6] = cpu->r[30];
         /* 020BAA2C */ cpu->r[4] = cpu->r[31];
         /* 020BAA30 */ cpu->r[3] = cpu->r[29];
-        /* 020BAA34 */ _t25 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAA34 */ _t25 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAA34 */ _t26 = _t25 & 0x00000001u;
         /* 020BAA34 */ if (_t26) goto L_020BAA38; // else: addr-0 trap, fall-through
   L_020BAA38: ; // 0x20baa38
@@ -24778,8 +24778,8 @@ void Gambit_fn_020BA970(CPUState* cpu) {
   L_020BAA68: ; // 0x20baa68
         /* 020BAA68 */ _t30 = cpu->r[31] + 0x00000444u;
         /* 020BAA68 */ cpu->r[12] = rbrew_read32(cpu->mem, _t30);
-        /* 020BAA6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000001u);
-        /* 020BAA70 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAA6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000001u));
+        /* 020BAA70 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAA70 */ _t32 = _t31 & 0x00000001u;
         /* 020BAA70 */ if (_t32) goto L_020BAA74; else goto L_020BAAC4;
   L_020BAA74: ; // 0x20baa74
@@ -24790,7 +24790,7 @@ void Gambit_fn_020BA970(CPUState* cpu) {
         /* 020BAA84 */ cpu->r[5] = 0x00000001u;
         /* 020BAA88 */ cpu->r[4] = cpu->r[31];
         /* 020BAA8C */ cpu->r[3] = cpu->r[29];
-        /* 020BAA90 */ _t33 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAA90 */ _t33 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAA90 */ _t34 = _t33 & 0x00000001u;
         /* 020BAA90 */ if (_t34) goto L_020BAA94; // else: addr-0 trap, fall-through
   L_020BAA94: ; // 0x20baa94
@@ -24813,7 +24813,7 @@ void Gambit_fn_020BA970(CPUState* cpu) {
         /* 020BAAC4 */ cpu->r[5] = 0x00000000u;
         /* 020BAAC8 */ cpu->r[4] = cpu->r[31];
         /* 020BAACC */ cpu->r[3] = cpu->r[29];
-        /* 020BAAD0 */ _t38 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAAD0 */ _t38 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAAD0 */ _t39 = _t38 & 0x00000001u;
         /* 020BAAD0 */ if (_t39) goto L_020BAAD4; // else: addr-0 trap, fall-through
   L_020BAAD4: ; // 0x20baad4
@@ -24836,7 +24836,7 @@ void Gambit_fn_020BA970(CPUState* cpu) {
         /* 020BAB04 */ cpu->r[5] = 0x00000000u;
         /* 020BAB08 */ cpu->r[4] = cpu->r[31] + 0x00000488u;
         /* 020BAB0C */ cpu->r[3] = cpu->r[29];
-        /* 020BAB10 */ _t43 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAB10 */ _t43 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAB10 */ _t44 = _t43 & 0x00000001u;
         /* 020BAB10 */ if (_t44) goto L_020BAB14; // else: addr-0 trap, fall-through
   L_020BAB14: ; // 0x20bab14
@@ -24899,8 +24899,8 @@ void Gambit_fn_020BAB5C(CPUState* cpu) {
         /* 020BAB94 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020BAB98 */ _t8 = cpu->r[31] + 0x0000027Cu;
         /* 020BAB98 */ cpu->r[3] = rbrew_read32(cpu->mem, _t8);
-        /* 020BAB9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BABA0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAB9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BABA0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BABA0 */ _t10 = _t9 & 0x00000001u;
         /* 020BABA0 */ if (_t10) goto L_020BABBC; else goto L_020BABA4;
   L_020BABA4: ; // 0x20baba4
@@ -24972,8 +24972,8 @@ void Gambit_fn_020BAB60(CPUState* cpu) {
         /* 020BAB94 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020BAB98 */ _t8 = cpu->r[31] + 0x0000027Cu;
         /* 020BAB98 */ cpu->r[3] = rbrew_read32(cpu->mem, _t8);
-        /* 020BAB9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BABA0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAB9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BABA0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BABA0 */ _t10 = _t9 & 0x00000001u;
         /* 020BABA0 */ if (_t10) goto L_020BABBC; else goto L_020BABA4;
   L_020BABA4: ; // 0x20baba4
@@ -25033,8 +25033,8 @@ void Gambit_fn_020BAC08(CPUState* cpu) {
         /* 020BAC20 */ _t3 = cpu->r[3] + 0x00003400u;
         /* 020BAC20 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 020BAC24 */ Gambit_fn_0206C030(cpu);
-        /* 020BAC28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BAC2C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAC28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BAC2C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAC2C */ _t5 = _t4 & 0x00000001u;
         /* 020BAC2C */ if (_t5) goto L_020BAC44; else goto L_020BAC30;
   L_020BAC30: ; // 0x20bac30
@@ -25075,8 +25075,8 @@ void Gambit_fn_020BAC0C(CPUState* cpu) {
         /* 020BAC20 */ _t3 = cpu->r[3] + 0x00003400u;
         /* 020BAC20 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 020BAC24 */ Gambit_fn_0206C030(cpu);
-        /* 020BAC28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BAC2C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAC28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BAC2C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAC2C */ _t5 = _t4 & 0x00000001u;
         /* 020BAC2C */ if (_t5) goto L_020BAC44; else goto L_020BAC30;
   L_020BAC30: ; // 0x20bac30
@@ -25189,10 +25189,10 @@ void Gambit_fn_020BACAC(CPUState* cpu) {
         /* 020BACD4 */ cpu->r[0] = cpu->r[12] + 0xFFFFFFFFu;
         /* 020BACD8 */ _t5 = cpu->r[30] + 0x00000281u;
         /* 020BACD8 */ rbrew_write8(cpu->mem, _t5, (uint8_t)cpu->r[11]);
-        /* 020BACDC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 020BACDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 020BACE0 */ _t6 = cpu->r[30] + 0x00000282u;
         /* 020BACE0 */ rbrew_write8(cpu->mem, _t6, (uint8_t)cpu->r[11]);
-        /* 020BACE4 */ _t7 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BACE4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BACE4 */ _t8 = _t7 & 0x00000001u;
         /* 020BACE4 */ if (_t8) goto L_020BAD04; else goto L_020BACE8;
   L_020BACE8: ; // 0x20bace8
@@ -25207,8 +25207,8 @@ void Gambit_fn_020BACAC(CPUState* cpu) {
         /* 020BACFC */ cpu->r[12] = rbrew_read8(cpu->mem, _t11);
         /* 020BAD00 */ /* nop */
   L_020BAD04: ; // 0x20bad04
-        /* 020BAD04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000005u);
-        /* 020BAD08 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAD04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000005u));
+        /* 020BAD08 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAD08 */ _t13 = _t12 & 0x00000001u;
         /* 020BAD08 */ if (_t13) goto L_020BAD0C; else goto L_020BAD28;
   L_020BAD0C: ; // 0x20bad0c
@@ -25223,8 +25223,8 @@ void Gambit_fn_020BACAC(CPUState* cpu) {
         /* 020BAD20 */ cpu->r[12] = rbrew_read8(cpu->mem, _t16);
         /* 020BAD24 */ /* nop */
   L_020BAD28: ; // 0x20bad28
-        /* 020BAD28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000006u);
-        /* 020BAD2C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAD28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000006u));
+        /* 020BAD2C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAD2C */ _t18 = _t17 & 0x00000001u;
         /* 020BAD2C */ if (_t18) goto L_020BAD30; else goto L_020BAD44;
   L_020BAD30: ; // 0x20bad30
@@ -25278,10 +25278,10 @@ void Gambit_fn_020BACB0(CPUState* cpu) {
         /* 020BACD4 */ cpu->r[0] = cpu->r[12] + 0xFFFFFFFFu;
         /* 020BACD8 */ _t5 = cpu->r[30] + 0x00000281u;
         /* 020BACD8 */ rbrew_write8(cpu->mem, _t5, (uint8_t)cpu->r[11]);
-        /* 020BACDC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 020BACDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 020BACE0 */ _t6 = cpu->r[30] + 0x00000282u;
         /* 020BACE0 */ rbrew_write8(cpu->mem, _t6, (uint8_t)cpu->r[11]);
-        /* 020BACE4 */ _t7 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BACE4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BACE4 */ _t8 = _t7 & 0x00000001u;
         /* 020BACE4 */ if (_t8) goto L_020BAD04; else goto L_020BACE8;
   L_020BACE8: ; // 0x20bace8
@@ -25296,8 +25296,8 @@ void Gambit_fn_020BACB0(CPUState* cpu) {
         /* 020BACFC */ cpu->r[12] = rbrew_read8(cpu->mem, _t11);
         /* 020BAD00 */ /* nop */
   L_020BAD04: ; // 0x20bad04
-        /* 020BAD04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000005u);
-        /* 020BAD08 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAD04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000005u));
+        /* 020BAD08 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAD08 */ _t13 = _t12 & 0x00000001u;
         /* 020BAD08 */ if (_t13) goto L_020BAD0C; else goto L_020BAD28;
   L_020BAD0C: ; // 0x20bad0c
@@ -25312,8 +25312,8 @@ void Gambit_fn_020BACB0(CPUState* cpu) {
         /* 020BAD20 */ cpu->r[12] = rbrew_read8(cpu->mem, _t16);
         /* 020BAD24 */ /* nop */
   L_020BAD28: ; // 0x20bad28
-        /* 020BAD28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000006u);
-        /* 020BAD2C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAD28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000006u));
+        /* 020BAD2C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAD2C */ _t18 = _t17 & 0x00000001u;
         /* 020BAD2C */ if (_t18) goto L_020BAD30; else goto L_020BAD44;
   L_020BAD30: ; // 0x20bad30
@@ -25367,9 +25367,9 @@ void Gambit_fn_020BAD8C(CPUState* cpu) {
         /* 020BAD8C */ cpu->r[12] = rbrew_read8(cpu->mem, _t0);
         /* 020BAD90 */ /* nop */
         /* 020BAD94 */ cpu->r[0] = cpu->r[12] + 0xFFFFFFFFu;
-        /* 020BAD98 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000002u);
+        /* 020BAD98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000002u));
         /* 020BAD9C */ cpu->r[0] = 0x00000001u;
-        /* 020BADA0 */ _t1 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BADA0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BADA0 */ _t2 = _t1 & 0x00000001u;
         /* 020BADA0 */ if (_t2) goto L_020BADA4; else goto L_020BADA8;
   L_020BADA4: ; // 0x20bada4
@@ -25390,8 +25390,8 @@ void Gambit_fn_020BADB0(CPUState* cpu) {
   L_020D8F14: ; // 0x20d8f14
         /* 020D8F14 */ _t1 = cpu->r[3] + 0x00001308u;
         /* 020D8F14 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
-        /* 020D8F18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020D8F1C */ _t2 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D8F18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020D8F1C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D8F1C */ _t3 = _t2 & 0x00000001u;
         /* 020D8F1C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D8F1C */ goto L_020D8F20;
@@ -25399,8 +25399,8 @@ void Gambit_fn_020BADB0(CPUState* cpu) {
         /* 020D8F20 */ _t4 = cpu->r[3] + 0x000001E8u;
         /* 020D8F20 */ cpu->r[0] = rbrew_read8(cpu->mem, _t4);
         /* 020D8F24 */ /* nop */
-        /* 020D8F28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 020D8F2C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D8F28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 020D8F2C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D8F2C */ _t6 = _t5 & 0x00000001u;
         /* 020D8F2C */ _t7 = _t6 ^ 0x00000001u;
         /* 020D8F2C */ if (_t7) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -25485,7 +25485,7 @@ void Gambit_fn_020BADF4(CPUState* cpu) {
         /* 020D9834 */ _t2 = cpu->r[3] + 0x000012FCu;
         /* 020D9834 */ cpu->r[0] = rbrew_read32(cpu->mem, _t2);
         /* 020D9838 */ cpu->r[12] = cpu->r[11] + 0xFFFFFFFFu;
-        /* 020D983C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[12]);
+        /* 020D983C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[12]));
         /* 020D9840 */ /* nop */
         /* 020D9844 */ cpu->r[3] = rbrew_rlwinm(cpu->r[12], 0x00000001u, 0x0000001Fu, 0x0000001Fu);
         /* 020D9848 */ cpu->r[3] = cpu->r[3] ^ 0x00000001u;
@@ -25539,8 +25539,8 @@ void Gambit_fn_020BAE10(CPUState* cpu) {
         /* 020BAE40 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020BAE44 */ _t8 = cpu->r[29] + 0x0000027Cu;
         /* 020BAE44 */ cpu->r[3] = rbrew_read32(cpu->mem, _t8);
-        /* 020BAE48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BAE4C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAE48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BAE4C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAE4C */ _t10 = _t9 & 0x00000001u;
         /* 020BAE4C */ if (_t10) goto L_020BAE68; else goto L_020BAE50;
   L_020BAE50: ; // 0x20bae50
@@ -25566,15 +25566,15 @@ void Gambit_fn_020BAE10(CPUState* cpu) {
         /* 020BAE80 */ rbrew_write32(cpu->mem, _t16, cpu->r[3]);
         /* 020BAE84 */ _t17 = cpu->r[31] + 0x0000047Cu;
         /* 020BAE84 */ cpu->r[0] = rbrew_read8(cpu->mem, _t17);
-        /* 020BAE88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BAE8C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAE88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BAE8C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAE8C */ _t19 = _t18 & 0x00000001u;
         /* 020BAE8C */ if (_t19) goto L_020BAF48; else goto L_020BAE90;
   L_020BAE90: ; // 0x20bae90
         /* 020BAE90 */ _t20 = cpu->r[31] + 0x00000444u;
         /* 020BAE90 */ cpu->r[0] = rbrew_read32(cpu->mem, _t20);
-        /* 020BAE94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 020BAE98 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAE94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 020BAE98 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAE98 */ _t22 = _t21 & 0x00000001u;
         /* 020BAE98 */ if (_t22) goto L_020BAE9C; else goto L_020BAEE4;
   L_020BAE9C: ; // 0x20bae9c
@@ -25591,7 +25591,7 @@ void Gambit_fn_020BAE10(CPUState* cpu) {
         /* 020BAEC0 */ cpu->r[6] = cpu->r[30];
         /* 020BAEC4 */ cpu->r[4] = cpu->r[31];
         /* 020BAEC8 */ cpu->r[3] = cpu->r[29];
-        /* 020BAECC */ _t24 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAECC */ _t24 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAECC */ _t25 = _t24 & 0x00000001u;
         /* 020BAECC */ if (_t25) goto L_020BAED0; // else: addr-0 trap, fall-through
   L_020BAED0: ; // 0x20baed0
@@ -25603,8 +25603,8 @@ void Gambit_fn_020BAE10(CPUState* cpu) {
   L_020BAEE4: ; // 0x20baee4
         /* 020BAEE4 */ _t26 = cpu->r[31] + 0x00000444u;
         /* 020BAEE4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t26);
-        /* 020BAEE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000001u);
-        /* 020BAEEC */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAEE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000001u));
+        /* 020BAEEC */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAEEC */ _t28 = _t27 & 0x00000001u;
         /* 020BAEEC */ if (_t28) goto L_020BAEF0; else goto L_020BAF24;
   L_020BAEF0: ; // 0x20baef0
@@ -25615,7 +25615,7 @@ void Gambit_fn_020BAE10(CPUState* cpu) {
         /* 020BAF00 */ cpu->r[5] = 0x00000001u;
         /* 020BAF04 */ cpu->r[4] = cpu->r[31];
         /* 020BAF08 */ cpu->r[3] = cpu->r[29];
-        /* 020BAF0C */ _t29 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAF0C */ _t29 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAF0C */ _t30 = _t29 & 0x00000001u;
         /* 020BAF0C */ if (_t30) goto L_020BAF10; // else: addr-0 trap, fall-through
   L_020BAF10: ; // 0x20baf10
@@ -25628,7 +25628,7 @@ void Gambit_fn_020BAE10(CPUState* cpu) {
         /* 020BAF24 */ cpu->r[5] = 0x00000000u;
         /* 020BAF28 */ cpu->r[4] = cpu->r[31];
         /* 020BAF2C */ cpu->r[3] = cpu->r[29];
-        /* 020BAF30 */ _t31 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAF30 */ _t31 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAF30 */ _t32 = _t31 & 0x00000001u;
         /* 020BAF30 */ if (_t32) goto L_020BAF34; // else: addr-0 trap, fall-through
   L_020BAF34: ; // 0x20baf34
@@ -25641,7 +25641,7 @@ void Gambit_fn_020BAE10(CPUState* cpu) {
         /* 020BAF48 */ cpu->r[5] = 0x00000000u;
         /* 020BAF4C */ cpu->r[4] = cpu->r[31] + 0x00000488u;
         /* 020BAF50 */ cpu->r[3] = cpu->r[29];
-        /* 020BAF54 */ _t33 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAF54 */ _t33 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAF54 */ _t34 = _t33 & 0x00000001u;
         /* 020BAF54 */ if (_t34) goto L_020BAF58; // else: addr-0 trap, fall-through
   L_020BAF58: ; // 0x20baf58
@@ -25691,8 +25691,8 @@ void Gambit_fn_020BAE14(CPUState* cpu) {
         /* 020BAE40 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020BAE44 */ _t8 = cpu->r[29] + 0x0000027Cu;
         /* 020BAE44 */ cpu->r[3] = rbrew_read32(cpu->mem, _t8);
-        /* 020BAE48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BAE4C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAE48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BAE4C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAE4C */ _t10 = _t9 & 0x00000001u;
         /* 020BAE4C */ if (_t10) goto L_020BAE68; else goto L_020BAE50;
   L_020BAE50: ; // 0x20bae50
@@ -25718,15 +25718,15 @@ void Gambit_fn_020BAE14(CPUState* cpu) {
         /* 020BAE80 */ rbrew_write32(cpu->mem, _t16, cpu->r[3]);
         /* 020BAE84 */ _t17 = cpu->r[31] + 0x0000047Cu;
         /* 020BAE84 */ cpu->r[0] = rbrew_read8(cpu->mem, _t17);
-        /* 020BAE88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BAE8C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAE88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BAE8C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAE8C */ _t19 = _t18 & 0x00000001u;
         /* 020BAE8C */ if (_t19) goto L_020BAF48; else goto L_020BAE90;
   L_020BAE90: ; // 0x20bae90
         /* 020BAE90 */ _t20 = cpu->r[31] + 0x00000444u;
         /* 020BAE90 */ cpu->r[0] = rbrew_read32(cpu->mem, _t20);
-        /* 020BAE94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 020BAE98 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAE94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 020BAE98 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAE98 */ _t22 = _t21 & 0x00000001u;
         /* 020BAE98 */ if (_t22) goto L_020BAE9C; else goto L_020BAEE4;
   L_020BAE9C: ; // 0x20bae9c
@@ -25743,7 +25743,7 @@ void Gambit_fn_020BAE14(CPUState* cpu) {
         /* 020BAEC0 */ cpu->r[6] = cpu->r[30];
         /* 020BAEC4 */ cpu->r[4] = cpu->r[31];
         /* 020BAEC8 */ cpu->r[3] = cpu->r[29];
-        /* 020BAECC */ _t24 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAECC */ _t24 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAECC */ _t25 = _t24 & 0x00000001u;
         /* 020BAECC */ if (_t25) goto L_020BAED0; // else: addr-0 trap, fall-through
   L_020BAED0: ; // 0x20baed0
@@ -25755,8 +25755,8 @@ void Gambit_fn_020BAE14(CPUState* cpu) {
   L_020BAEE4: ; // 0x20baee4
         /* 020BAEE4 */ _t26 = cpu->r[31] + 0x00000444u;
         /* 020BAEE4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t26);
-        /* 020BAEE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000001u);
-        /* 020BAEEC */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAEE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000001u));
+        /* 020BAEEC */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAEEC */ _t28 = _t27 & 0x00000001u;
         /* 020BAEEC */ if (_t28) goto L_020BAEF0; else goto L_020BAF24;
   L_020BAEF0: ; // 0x20baef0
@@ -25767,7 +25767,7 @@ void Gambit_fn_020BAE14(CPUState* cpu) {
         /* 020BAF00 */ cpu->r[5] = 0x00000001u;
         /* 020BAF04 */ cpu->r[4] = cpu->r[31];
         /* 020BAF08 */ cpu->r[3] = cpu->r[29];
-        /* 020BAF0C */ _t29 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAF0C */ _t29 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAF0C */ _t30 = _t29 & 0x00000001u;
         /* 020BAF0C */ if (_t30) goto L_020BAF10; // else: addr-0 trap, fall-through
   L_020BAF10: ; // 0x20baf10
@@ -25780,7 +25780,7 @@ void Gambit_fn_020BAE14(CPUState* cpu) {
         /* 020BAF24 */ cpu->r[5] = 0x00000000u;
         /* 020BAF28 */ cpu->r[4] = cpu->r[31];
         /* 020BAF2C */ cpu->r[3] = cpu->r[29];
-        /* 020BAF30 */ _t31 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAF30 */ _t31 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAF30 */ _t32 = _t31 & 0x00000001u;
         /* 020BAF30 */ if (_t32) goto L_020BAF34; // else: addr-0 trap, fall-through
   L_020BAF34: ; // 0x20baf34
@@ -25793,7 +25793,7 @@ void Gambit_fn_020BAE14(CPUState* cpu) {
         /* 020BAF48 */ cpu->r[5] = 0x00000000u;
         /* 020BAF4C */ cpu->r[4] = cpu->r[31] + 0x00000488u;
         /* 020BAF50 */ cpu->r[3] = cpu->r[29];
-        /* 020BAF54 */ _t33 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BAF54 */ _t33 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BAF54 */ _t34 = _t33 & 0x00000001u;
         /* 020BAF54 */ if (_t34) goto L_020BAF58; // else: addr-0 trap, fall-through
   L_020BAF58: ; // 0x20baf58
@@ -25842,8 +25842,8 @@ void Gambit_fn_020BAF84(CPUState* cpu) {
         /* 020BAFB0 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020BAFB4 */ _t7 = cpu->r[31] + 0x0000027Cu;
         /* 020BAFB4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 020BAFB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BAFBC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAFB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BAFBC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAFBC */ _t9 = _t8 & 0x00000001u;
         /* 020BAFBC */ if (_t9) goto L_020BAFD8; else goto L_020BAFC0;
   L_020BAFC0: ; // 0x20bafc0
@@ -25901,8 +25901,8 @@ void Gambit_fn_020BAF88(CPUState* cpu) {
         /* 020BAFB0 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020BAFB4 */ _t7 = cpu->r[31] + 0x0000027Cu;
         /* 020BAFB4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 020BAFB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BAFBC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BAFB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BAFBC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BAFBC */ _t9 = _t8 & 0x00000001u;
         /* 020BAFBC */ if (_t9) goto L_020BAFD8; else goto L_020BAFC0;
   L_020BAFC0: ; // 0x20bafc0
@@ -25961,18 +25961,18 @@ void Gambit_fn_020BB02C(CPUState* cpu) {
         /* 020BB058 */ Gambit_fn_020D9A30(cpu);
         /* 020BB05C */ _t7 = cpu->r[31] + 0x00000000u;
         /* 020BB05C */ cpu->r[11] = rbrew_read32(cpu->mem, _t7);
-        /* 020BB060 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x0000000Du);
-        /* 020BB064 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB060 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x0000000Du));
+        /* 020BB064 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB064 */ _t9 = _t8 & 0x00000001u;
         /* 020BB064 */ if (_t9) goto L_020BB08C; else goto L_020BB068;
   L_020BB068: ; // 0x20bb068
-        /* 020BB068 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x0000000Eu);
-        /* 020BB06C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB068 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x0000000Eu));
+        /* 020BB06C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB06C */ _t11 = _t10 & 0x00000001u;
         /* 020BB06C */ if (_t11) goto L_020BB08C; else goto L_020BB070;
   L_020BB070: ; // 0x20bb070
-        /* 020BB070 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x0000000Fu);
-        /* 020BB074 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB070 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x0000000Fu));
+        /* 020BB074 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB074 */ _t13 = _t12 & 0x00000001u;
         /* 020BB074 */ if (_t13) goto L_020BB08C; else goto L_020BB078;
   L_020BB078: ; // 0x20bb078
@@ -26022,18 +26022,18 @@ void Gambit_fn_020BB030(CPUState* cpu) {
         /* 020BB058 */ Gambit_fn_020D9A30(cpu);
         /* 020BB05C */ _t7 = cpu->r[31] + 0x00000000u;
         /* 020BB05C */ cpu->r[11] = rbrew_read32(cpu->mem, _t7);
-        /* 020BB060 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x0000000Du);
-        /* 020BB064 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB060 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x0000000Du));
+        /* 020BB064 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB064 */ _t9 = _t8 & 0x00000001u;
         /* 020BB064 */ if (_t9) goto L_020BB08C; else goto L_020BB068;
   L_020BB068: ; // 0x20bb068
-        /* 020BB068 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x0000000Eu);
-        /* 020BB06C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB068 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x0000000Eu));
+        /* 020BB06C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB06C */ _t11 = _t10 & 0x00000001u;
         /* 020BB06C */ if (_t11) goto L_020BB08C; else goto L_020BB070;
   L_020BB070: ; // 0x20bb070
-        /* 020BB070 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x0000000Fu);
-        /* 020BB074 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB070 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x0000000Fu));
+        /* 020BB074 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB074 */ _t13 = _t12 & 0x00000001u;
         /* 020BB074 */ if (_t13) goto L_020BB08C; else goto L_020BB078;
   L_020BB078: ; // 0x20bb078
@@ -26068,20 +26068,20 @@ void Gambit_fn_020BB0A4(CPUState* cpu) {
         /* 020BB0A8 */ cpu->r[1] = _t0;
         /* 020BB0AC */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 020BB0AC */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
-        /* 020BB0B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 020BB0B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 020BB0B4 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 020BB0B4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020BB0B8 */ _t3 = cpu->r[3] + 0x0000024Cu;
         /* 020BB0B8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t3);
-        /* 020BB0BC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB0BC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB0BC */ _t5 = _t4 & 0x00000001u;
         /* 020BB0BC */ if (_t5) goto L_020BB0C0; else goto L_020BB0D0;
   L_020BB0C0: ; // 0x20bb0c0
         /* 020BB0C0 */ cpu->r[3] = 0x00000004u;
         /* 020BB0C4 */ Gambit_fn_02801A78(cpu);
         /* 020BB0C8 */ cpu->r[4] = cpu->r[3];
-        /* 020BB0C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020BB0CC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB0C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020BB0CC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB0CC */ _t7 = _t6 & 0x00000001u;
         /* 020BB0CC */ if (_t7) goto L_020BB0D8; else goto L_020BB0D0;
   L_020BB0D0: ; // 0x20bb0d0
@@ -26109,20 +26109,20 @@ void Gambit_fn_020BB0A8(CPUState* cpu) {
         /* 020BB0A8 */ cpu->r[1] = _t0;
         /* 020BB0AC */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 020BB0AC */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
-        /* 020BB0B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 020BB0B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 020BB0B4 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 020BB0B4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020BB0B8 */ _t3 = cpu->r[3] + 0x0000024Cu;
         /* 020BB0B8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t3);
-        /* 020BB0BC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB0BC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB0BC */ _t5 = _t4 & 0x00000001u;
         /* 020BB0BC */ if (_t5) goto L_020BB0C0; else goto L_020BB0D0;
   L_020BB0C0: ; // 0x20bb0c0
         /* 020BB0C0 */ cpu->r[3] = 0x00000004u;
         /* 020BB0C4 */ Gambit_fn_02801A78(cpu);
         /* 020BB0C8 */ cpu->r[4] = cpu->r[3];
-        /* 020BB0C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020BB0CC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB0C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020BB0CC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB0CC */ _t7 = _t6 & 0x00000001u;
         /* 020BB0CC */ if (_t7) goto L_020BB0D8; else goto L_020BB0D0;
   L_020BB0D0: ; // 0x20bb0d0
@@ -26239,8 +26239,8 @@ void Gambit_fn_020BB148(CPUState* cpu) {
         /* 0206A208 */ cpu->ctr = cpu->r[0];
         /* 0206A20C */ cpu->r[3] = cpu->r[31];
         /* 0206A210 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0206A214 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0206A218 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206A214 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0206A218 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206A218 */ _t6 = _t5 & 0x00000001u;
         /* 0206A218 */ if (_t6) goto L_0206A24C; else goto L_0206A21C;
   L_0206A21C: ; // 0x206a21c
@@ -26313,9 +26313,9 @@ void Gambit_fn_020BB164(CPUState* cpu) {
         /* 020BB188 */ cpu->r[12] = _t4;
         /* 020BB18C */ cpu->r[31] = cpu->r[3];
         /* 020BB190 */ cpu->r[4] = 0x101D0000u;
-        /* 020BB194 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 020BB194 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 020BB198 */ cpu->r[4] = cpu->r[4] + 0xFFFFED90u;
-        /* 020BB19C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB19C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB19C */ _t6 = _t5 & 0x00000001u;
         /* 020BB19C */ if (_t6) goto L_020BB1A0; else goto L_020BB1B4;
   L_020BB1A0: ; // 0x20bb1a0
@@ -26327,8 +26327,8 @@ void Gambit_fn_020BB164(CPUState* cpu) {
         /* 020BB1B0 */ _t8 = cpu->r[4] + 0x00000000u;
         /* 020BB1B0 */ rbrew_write32(cpu->mem, _t8, cpu->r[9]);
   L_020BB1B4: ; // 0x20bb1b4
-        /* 020BB1B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020BB1B8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB1B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020BB1B8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB1B8 */ _t10 = _t9 & 0x00000001u;
         /* 020BB1B8 */ if (_t10) goto L_020BB1D8; else goto L_020BB1BC;
   L_020BB1BC: ; // 0x20bb1bc
@@ -26339,8 +26339,8 @@ void Gambit_fn_020BB164(CPUState* cpu) {
         /* 020BB1C4 */ cpu->ctr = cpu->r[11];
         /* 020BB1C8 */ cpu->r[3] = cpu->r[31];
         /* 020BB1CC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020BB1D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BB1D4 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB1D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BB1D4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB1D4 */ _t14 = _t13 & 0x00000001u;
         /* 020BB1D4 */ if (_t14) goto L_020BB1D8; else goto L_020BB1DC;
   L_020BB1D8: ; // 0x20bb1d8
@@ -26357,9 +26357,9 @@ void Gambit_fn_020BB164(CPUState* cpu) {
         /* 020BB1F0 */ cpu->r[12] = _t16;
         /* 020BB1F4 */ cpu->r[4] = 0x101D0000u;
         /* 020BB1F8 */ cpu->r[31] = cpu->r[3];
-        /* 020BB1FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020BB1FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020BB200 */ cpu->r[4] = cpu->r[4] + 0xFFFFEE1Cu;
-        /* 020BB204 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB204 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB204 */ _t18 = _t17 & 0x00000001u;
         /* 020BB204 */ if (_t18) goto L_020BB208; else goto L_020BB21C;
   L_020BB208: ; // 0x20bb208
@@ -26371,8 +26371,8 @@ void Gambit_fn_020BB164(CPUState* cpu) {
         /* 020BB218 */ _t20 = cpu->r[4] + 0x00000000u;
         /* 020BB218 */ rbrew_write32(cpu->mem, _t20, cpu->r[0]);
   L_020BB21C: ; // 0x20bb21c
-        /* 020BB21C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020BB220 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB21C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020BB220 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB220 */ _t22 = _t21 & 0x00000001u;
         /* 020BB220 */ if (_t22) goto L_020BB240; else goto L_020BB224;
   L_020BB224: ; // 0x20bb224
@@ -26383,8 +26383,8 @@ void Gambit_fn_020BB164(CPUState* cpu) {
         /* 020BB22C */ cpu->ctr = cpu->r[0];
         /* 020BB230 */ cpu->r[3] = cpu->r[31];
         /* 020BB234 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020BB238 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BB23C */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB238 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BB23C */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB23C */ _t26 = _t25 & 0x00000001u;
         /* 020BB23C */ if (_t26) goto L_020BB240; else goto L_020BB244;
   L_020BB240: ; // 0x20bb240
@@ -26426,9 +26426,9 @@ void Gambit_fn_020BB168(CPUState* cpu) {
         /* 020BB188 */ cpu->r[12] = _t4;
         /* 020BB18C */ cpu->r[31] = cpu->r[3];
         /* 020BB190 */ cpu->r[4] = 0x101D0000u;
-        /* 020BB194 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 020BB194 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 020BB198 */ cpu->r[4] = cpu->r[4] + 0xFFFFED90u;
-        /* 020BB19C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB19C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB19C */ _t6 = _t5 & 0x00000001u;
         /* 020BB19C */ if (_t6) goto L_020BB1A0; else goto L_020BB1B4;
   L_020BB1A0: ; // 0x20bb1a0
@@ -26440,8 +26440,8 @@ void Gambit_fn_020BB168(CPUState* cpu) {
         /* 020BB1B0 */ _t8 = cpu->r[4] + 0x00000000u;
         /* 020BB1B0 */ rbrew_write32(cpu->mem, _t8, cpu->r[9]);
   L_020BB1B4: ; // 0x20bb1b4
-        /* 020BB1B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020BB1B8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB1B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020BB1B8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB1B8 */ _t10 = _t9 & 0x00000001u;
         /* 020BB1B8 */ if (_t10) goto L_020BB1D8; else goto L_020BB1BC;
   L_020BB1BC: ; // 0x20bb1bc
@@ -26452,8 +26452,8 @@ void Gambit_fn_020BB168(CPUState* cpu) {
         /* 020BB1C4 */ cpu->ctr = cpu->r[11];
         /* 020BB1C8 */ cpu->r[3] = cpu->r[31];
         /* 020BB1CC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020BB1D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BB1D4 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB1D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BB1D4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB1D4 */ _t14 = _t13 & 0x00000001u;
         /* 020BB1D4 */ if (_t14) goto L_020BB1D8; else goto L_020BB1DC;
   L_020BB1D8: ; // 0x20bb1d8
@@ -26470,9 +26470,9 @@ void Gambit_fn_020BB168(CPUState* cpu) {
         /* 020BB1F0 */ cpu->r[12] = _t16;
         /* 020BB1F4 */ cpu->r[4] = 0x101D0000u;
         /* 020BB1F8 */ cpu->r[31] = cpu->r[3];
-        /* 020BB1FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020BB1FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020BB200 */ cpu->r[4] = cpu->r[4] + 0xFFFFEE1Cu;
-        /* 020BB204 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB204 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB204 */ _t18 = _t17 & 0x00000001u;
         /* 020BB204 */ if (_t18) goto L_020BB208; else goto L_020BB21C;
   L_020BB208: ; // 0x20bb208
@@ -26484,8 +26484,8 @@ void Gambit_fn_020BB168(CPUState* cpu) {
         /* 020BB218 */ _t20 = cpu->r[4] + 0x00000000u;
         /* 020BB218 */ rbrew_write32(cpu->mem, _t20, cpu->r[0]);
   L_020BB21C: ; // 0x20bb21c
-        /* 020BB21C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020BB220 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB21C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020BB220 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB220 */ _t22 = _t21 & 0x00000001u;
         /* 020BB220 */ if (_t22) goto L_020BB240; else goto L_020BB224;
   L_020BB224: ; // 0x20bb224
@@ -26496,8 +26496,8 @@ void Gambit_fn_020BB168(CPUState* cpu) {
         /* 020BB22C */ cpu->ctr = cpu->r[0];
         /* 020BB230 */ cpu->r[3] = cpu->r[31];
         /* 020BB234 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020BB238 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BB23C */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB238 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BB23C */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB23C */ _t26 = _t25 & 0x00000001u;
         /* 020BB23C */ if (_t26) goto L_020BB240; else goto L_020BB244;
   L_020BB240: ; // 0x20bb240
@@ -26553,8 +26553,8 @@ void Gambit_fn_020BB260(CPUState* cpu) {
         /* 020BB2AC */ Gambit_fn_027EC044(cpu);
         /* 020BB2B0 */ cpu->r[12] = cpu->r[3] + 0xFFFFFFFFu;
         /* 020BB2B4 */ cpu->r[0] = cpu->r[3] - cpu->r[12];
-        /* 020BB2B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BB2B8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB2B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BB2B8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB2B8 */ _t10 = _t9 & 0x00000001u;
         /* 020BB2B8 */ if (_t10) goto L_020BB2D8; else goto L_020BB2BC;
   L_020BB2BC: ; // 0x20bb2bc
@@ -26618,8 +26618,8 @@ void Gambit_fn_020BB264(CPUState* cpu) {
         /* 020BB2AC */ Gambit_fn_027EC044(cpu);
         /* 020BB2B0 */ cpu->r[12] = cpu->r[3] + 0xFFFFFFFFu;
         /* 020BB2B4 */ cpu->r[0] = cpu->r[3] - cpu->r[12];
-        /* 020BB2B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BB2B8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB2B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BB2B8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB2B8 */ _t10 = _t9 & 0x00000001u;
         /* 020BB2B8 */ if (_t10) goto L_020BB2D8; else goto L_020BB2BC;
   L_020BB2BC: ; // 0x20bb2bc
@@ -26869,8 +26869,8 @@ void Gambit_fn_020BB3DC(CPUState* cpu) {
         /* 020BB420 */ cpu->r[3] = cpu->r[29];
         /* 020BB424 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 020BB428 */ Gambit_fn_027ED2B0(cpu);
-        /* 020BB42C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BB430 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB42C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BB430 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB430 */ _t9 = _t8 & 0x00000001u;
         /* 020BB430 */ if (_t9) goto L_020BB464; else goto L_020BB434;
   L_020BB434: ; // 0x20bb434
@@ -26942,8 +26942,8 @@ void Gambit_fn_020BB3E0(CPUState* cpu) {
         /* 020BB420 */ cpu->r[3] = cpu->r[29];
         /* 020BB424 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 020BB428 */ Gambit_fn_027ED2B0(cpu);
-        /* 020BB42C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BB430 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB42C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BB430 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB430 */ _t9 = _t8 & 0x00000001u;
         /* 020BB430 */ if (_t9) goto L_020BB464; else goto L_020BB434;
   L_020BB434: ; // 0x20bb434
@@ -27016,8 +27016,8 @@ void Gambit_fn_020BB488(CPUState* cpu) {
         /* 020BB4CC */ cpu->r[3] = cpu->r[29];
         /* 020BB4D0 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 020BB4D4 */ Gambit_fn_027ED2B0(cpu);
-        /* 020BB4D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BB4DC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB4D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BB4DC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB4DC */ _t9 = _t8 & 0x00000001u;
         /* 020BB4DC */ if (_t9) goto L_020BB510; else goto L_020BB4E0;
   L_020BB4E0: ; // 0x20bb4e0
@@ -27089,8 +27089,8 @@ void Gambit_fn_020BB48C(CPUState* cpu) {
         /* 020BB4CC */ cpu->r[3] = cpu->r[29];
         /* 020BB4D0 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 020BB4D4 */ Gambit_fn_027ED2B0(cpu);
-        /* 020BB4D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BB4DC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB4D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BB4DC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB4DC */ _t9 = _t8 & 0x00000001u;
         /* 020BB4DC */ if (_t9) goto L_020BB510; else goto L_020BB4E0;
   L_020BB4E0: ; // 0x20bb4e0
@@ -27144,20 +27144,20 @@ void Gambit_fn_020BB534(CPUState* cpu) {
         /* 020BB544 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 020BB544 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020BB548 */ Gambit_fn_020BADF4(cpu);
-        /* 020BB54C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 020BB54C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 020BB550 */ _t3 = cpu->r[31] + 0x0000021Cu;
         /* 020BB550 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 020BB554 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB554 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB554 */ _t5 = _t4 & 0x00000001u;
         /* 020BB554 */ if (_t5) goto L_020BB558; else goto L_020BB56C;
   L_020BB558: ; // 0x20bb558
-        /* 020BB558 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 020BB55C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB558 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 020BB55C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB55C */ _t7 = _t6 & 0x00000001u;
         /* 020BB55C */ if (_t7) goto L_020BB568; else goto L_020BB560;
   L_020BB560: ; // 0x20bb560
-        /* 020BB560 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 020BB564 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB560 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 020BB564 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB564 */ _t9 = _t8 & 0x00000001u;
         /* 020BB564 */ if (_t9) goto L_020BB568; else goto L_020BB56C;
   L_020BB568: ; // 0x20bb568
@@ -27188,20 +27188,20 @@ void Gambit_fn_020BB538(CPUState* cpu) {
         /* 020BB544 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 020BB544 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020BB548 */ Gambit_fn_020BADF4(cpu);
-        /* 020BB54C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 020BB54C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 020BB550 */ _t3 = cpu->r[31] + 0x0000021Cu;
         /* 020BB550 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 020BB554 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB554 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB554 */ _t5 = _t4 & 0x00000001u;
         /* 020BB554 */ if (_t5) goto L_020BB558; else goto L_020BB56C;
   L_020BB558: ; // 0x20bb558
-        /* 020BB558 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 020BB55C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB558 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 020BB55C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB55C */ _t7 = _t6 & 0x00000001u;
         /* 020BB55C */ if (_t7) goto L_020BB568; else goto L_020BB560;
   L_020BB560: ; // 0x20bb560
-        /* 020BB560 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 020BB564 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB560 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 020BB564 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB564 */ _t9 = _t8 & 0x00000001u;
         /* 020BB564 */ if (_t9) goto L_020BB568; else goto L_020BB56C;
   L_020BB568: ; // 0x20bb568
@@ -27235,8 +27235,8 @@ void Gambit_fn_020BB588(CPUState* cpu) {
         /* 020BB598 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 020BB59C */ _t4 = cpu->r[30] + 0x000001E4u;
         /* 020BB59C */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
-        /* 020BB5A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BB5A4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB5A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BB5A4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB5A4 */ _t6 = _t5 & 0x00000001u;
         /* 020BB5A4 */ if (_t6) goto L_020BB5A8; else goto L_020BB604;
   L_020BB5A8: ; // 0x20bb5a8
@@ -27269,15 +27269,15 @@ void Gambit_fn_020BB588(CPUState* cpu) {
         /* 020BB5F4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020BB5F8 */ _t14 = cpu->r[30] + 0x000001E4u;
         /* 020BB5F8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
-        /* 020BB5FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020BB600 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB5FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020BB600 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB600 */ _t16 = _t15 & 0x00000001u;
         /* 020BB600 */ if (_t16) goto L_020BB670; else goto L_020BB604;
   L_020BB604: ; // 0x20bb604
         /* 020BB604 */ _t17 = cpu->r[30] + 0x00000280u;
         /* 020BB604 */ cpu->r[0] = rbrew_read8(cpu->mem, _t17);
-        /* 020BB608 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BB60C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB608 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BB60C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB60C */ _t19 = _t18 & 0x00000001u;
         /* 020BB60C */ if (_t19) goto L_020BB670; else goto L_020BB610;
   L_020BB610: ; // 0x20bb610
@@ -27285,8 +27285,8 @@ void Gambit_fn_020BB588(CPUState* cpu) {
         /* 020BB610 */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
         /* 020BB614 */ _t21 = cpu->r[12] + 0x0000047Eu;
         /* 020BB614 */ cpu->r[0] = rbrew_read8(cpu->mem, _t21);
-        /* 020BB618 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BB61C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB618 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BB61C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB61C */ _t23 = _t22 & 0x00000001u;
         /* 020BB61C */ if (_t23) goto L_020BB670; else goto L_020BB620;
   L_020BB620: ; // 0x20bb620
@@ -27295,8 +27295,8 @@ void Gambit_fn_020BB588(CPUState* cpu) {
         /* 020BB628 */ cpu->r[4] = cpu->r[3];
         /* 020BB62C */ cpu->r[3] = cpu->r[30];
         /* 020BB630 */ Gambit_fn_027EDF00(cpu);
-        /* 020BB634 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BB638 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB634 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BB638 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB638 */ _t25 = _t24 & 0x00000001u;
         /* 020BB638 */ if (_t25) goto L_020BB670; else goto L_020BB63C;
   L_020BB63C: ; // 0x20bb63c
@@ -27309,15 +27309,15 @@ void Gambit_fn_020BB588(CPUState* cpu) {
         /* 020BB64C */ _t28 = cpu->r[31] + 0x0000008Cu;
         /* 020BB64C */ cpu->r[0] = rbrew_read32(cpu->mem, _t28);
         /* 020BB650 */ cpu->r[12] = cpu->r[3] & cpu->r[0];
-        /* 020BB650 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020BB654 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB650 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020BB654 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB654 */ _t30 = _t29 & 0x00000001u;
         /* 020BB654 */ if (_t30) goto L_020BB670; else goto L_020BB658;
   L_020BB658: ; // 0x20bb658
         /* 020BB658 */ cpu->r[3] = cpu->r[30];
         /* 020BB65C */ Gambit_fn_020BAE08(cpu);
-        /* 020BB660 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BB664 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB660 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BB664 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB664 */ _t32 = _t31 & 0x00000001u;
         /* 020BB664 */ if (_t32) goto L_020BB668; else goto L_020BB670;
   L_020BB668: ; // 0x20bb668
@@ -27336,16 +27336,16 @@ void Gambit_fn_020BB588(CPUState* cpu) {
         /* 020BB68C */ cpu->r[4] = cpu->r[3];
         /* 020BB690 */ cpu->r[3] = cpu->r[30];
         /* 020BB694 */ Gambit_fn_027EDF00(cpu);
-        /* 020BB698 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BB69C */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB698 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BB69C */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB69C */ _t36 = _t35 & 0x00000001u;
         /* 020BB69C */ if (_t36) goto L_020BB6BC; else goto L_020BB6A0;
   L_020BB6A0: ; // 0x20bb6a0
         /* 020BB6A0 */ _t37 = cpu->r[30] + 0x0000024Cu;
         /* 020BB6A0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t37);
         /* 020BB6A4 */ Gambit_fn_020D8E9C(cpu);
-        /* 020BB6A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BB6AC */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB6A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BB6AC */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB6AC */ _t39 = _t38 & 0x00000001u;
         /* 020BB6AC */ if (_t39) goto L_020BB6BC; else goto L_020BB6B0;
   L_020BB6B0: ; // 0x20bb6b0
@@ -27381,8 +27381,8 @@ void Gambit_fn_020BB6D8(CPUState* cpu) {
         /* 020BB6E8 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 020BB6EC */ _t4 = cpu->r[30] + 0x000001E4u;
         /* 020BB6EC */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
-        /* 020BB6F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BB6F4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB6F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BB6F4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB6F4 */ _t6 = _t5 & 0x00000001u;
         /* 020BB6F4 */ if (_t6) goto L_020BB6F8; else goto L_020BB760;
   L_020BB6F8: ; // 0x20bb6f8
@@ -27401,24 +27401,24 @@ void Gambit_fn_020BB6D8(CPUState* cpu) {
         /* 020BB71C */ Gambit_fn_020DACF0(cpu);
         /* 020BB720 */ _t10 = cpu->r[30] + 0x0000027Cu;
         /* 020BB720 */ cpu->r[3] = rbrew_read32(cpu->mem, _t10);
-        /* 020BB724 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BB728 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB724 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BB728 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB728 */ _t12 = _t11 & 0x00000001u;
         /* 020BB728 */ if (_t12) goto L_020BB754; else goto L_020BB72C;
   L_020BB72C: ; // 0x20bb72c
         /* 020BB72C */ Gambit_fn_020C3920(cpu);
-        /* 020BB730 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 020BB730 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 020BB734 */ _t13 = cpu->r[30] + 0x0000027Cu;
         /* 020BB734 */ cpu->r[3] = rbrew_read32(cpu->mem, _t13);
-        /* 020BB738 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB738 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB738 */ _t15 = _t14 & 0x00000001u;
         /* 020BB738 */ if (_t15) goto L_020BB750; else goto L_020BB73C;
   L_020BB73C: ; // 0x20bb73c
         /* 020BB73C */ Gambit_fn_020C3948(cpu);
         /* 020BB740 */ _t16 = cpu->r[30] + 0x000001E4u;
         /* 020BB740 */ cpu->r[12] = rbrew_read32(cpu->mem, _t16);
-        /* 020BB744 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020BB748 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB744 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020BB748 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB748 */ _t18 = _t17 & 0x00000001u;
         /* 020BB748 */ if (_t18) goto L_020BB74C; else goto L_020BB760;
   L_020BB74C: ; // 0x20bb74c
@@ -27428,15 +27428,15 @@ void Gambit_fn_020BB6D8(CPUState* cpu) {
   L_020BB754: ; // 0x20bb754
         /* 020BB754 */ _t19 = cpu->r[30] + 0x000001E4u;
         /* 020BB754 */ cpu->r[12] = rbrew_read32(cpu->mem, _t19);
-        /* 020BB758 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020BB75C */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB758 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020BB75C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB75C */ _t21 = _t20 & 0x00000001u;
         /* 020BB75C */ if (_t21) goto L_020BB7B0; else goto L_020BB760;
   L_020BB760: ; // 0x20bb760
         /* 020BB760 */ _t22 = cpu->r[30] + 0x00000280u;
         /* 020BB760 */ cpu->r[0] = rbrew_read8(cpu->mem, _t22);
-        /* 020BB764 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BB768 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB764 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BB768 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB768 */ _t24 = _t23 & 0x00000001u;
         /* 020BB768 */ if (_t24) goto L_020BB7B0; else goto L_020BB76C;
   L_020BB76C: ; // 0x20bb76c
@@ -27444,8 +27444,8 @@ void Gambit_fn_020BB6D8(CPUState* cpu) {
         /* 020BB76C */ cpu->r[12] = rbrew_read32(cpu->mem, _t25);
         /* 020BB770 */ _t26 = cpu->r[12] + 0x0000047Eu;
         /* 020BB770 */ cpu->r[0] = rbrew_read8(cpu->mem, _t26);
-        /* 020BB774 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BB778 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB774 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BB778 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB778 */ _t28 = _t27 & 0x00000001u;
         /* 020BB778 */ if (_t28) goto L_020BB7B0; else goto L_020BB77C;
   L_020BB77C: ; // 0x20bb77c
@@ -27458,15 +27458,15 @@ void Gambit_fn_020BB6D8(CPUState* cpu) {
         /* 020BB78C */ _t31 = cpu->r[31] + 0x0000008Cu;
         /* 020BB78C */ cpu->r[0] = rbrew_read32(cpu->mem, _t31);
         /* 020BB790 */ cpu->r[12] = cpu->r[3] & cpu->r[0];
-        /* 020BB790 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020BB794 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB790 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020BB794 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB794 */ _t33 = _t32 & 0x00000001u;
         /* 020BB794 */ if (_t33) goto L_020BB7B0; else goto L_020BB798;
   L_020BB798: ; // 0x20bb798
         /* 020BB798 */ cpu->r[3] = cpu->r[30];
         /* 020BB79C */ Gambit_fn_020BAE08(cpu);
-        /* 020BB7A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BB7A4 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB7A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BB7A4 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB7A4 */ _t35 = _t34 & 0x00000001u;
         /* 020BB7A4 */ if (_t35) goto L_020BB7A8; else goto L_020BB7B0;
   L_020BB7A8: ; // 0x20bb7a8
@@ -27476,16 +27476,16 @@ void Gambit_fn_020BB6D8(CPUState* cpu) {
         /* 020BB7B0 */ _t36 = cpu->r[30] + 0x0000024Cu;
         /* 020BB7B0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t36);
         /* 020BB7B4 */ Gambit_fn_020D8E9C(cpu);
-        /* 020BB7B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BB7BC */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB7B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BB7BC */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB7BC */ _t38 = _t37 & 0x00000001u;
         /* 020BB7BC */ if (_t38) goto L_020BB800; else goto L_020BB7C0;
   L_020BB7C0: ; // 0x20bb7c0
         /* 020BB7C0 */ _t39 = cpu->r[30] + 0x00000218u;
         /* 020BB7C0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t39);
-        /* 020BB7C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 020BB7C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 020BB7C8 */ cpu->r[3] = cpu->r[30] + 0x000001DCu;
-        /* 020BB7CC */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB7CC */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB7CC */ _t41 = _t40 & 0x00000001u;
         /* 020BB7CC */ if (_t41) goto L_020BB7D0; else goto L_020BB7F0;
   L_020BB7D0: ; // 0x20bb7d0
@@ -27533,8 +27533,8 @@ void Gambit_fn_020BB81C(CPUState* cpu) {
         /* 020BB828 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020BB82C */ _t3 = cpu->r[31] + 0x000001E4u;
         /* 020BB82C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 020BB830 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BB834 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB830 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BB834 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB834 */ _t5 = _t4 & 0x00000001u;
         /* 020BB834 */ if (_t5) goto L_020BB838; else goto L_020BB878;
   L_020BB838: ; // 0x20bb838
@@ -27548,8 +27548,8 @@ void Gambit_fn_020BB81C(CPUState* cpu) {
         /* 020BB84C */ Gambit_fn_020DACF0(cpu);
         /* 020BB850 */ _t8 = cpu->r[31] + 0x0000027Cu;
         /* 020BB850 */ cpu->r[3] = rbrew_read32(cpu->mem, _t8);
-        /* 020BB854 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BB858 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB854 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BB858 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB858 */ _t10 = _t9 & 0x00000001u;
         /* 020BB858 */ if (_t10) goto L_020BB890; else goto L_020BB85C;
   L_020BB85C: ; // 0x20bb85c
@@ -27557,8 +27557,8 @@ void Gambit_fn_020BB81C(CPUState* cpu) {
         /* 020BB85C */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
         /* 020BB860 */ _t12 = cpu->r[10] + 0x0000047Eu;
         /* 020BB860 */ cpu->r[0] = rbrew_read8(cpu->mem, _t12);
-        /* 020BB864 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BB868 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB864 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BB868 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB868 */ _t14 = _t13 & 0x00000001u;
         /* 020BB868 */ if (_t14) goto L_020BB890; else goto L_020BB86C;
   L_020BB86C: ; // 0x20bb86c
@@ -27569,14 +27569,14 @@ void Gambit_fn_020BB81C(CPUState* cpu) {
   L_020BB878: ; // 0x20bb878
         /* 020BB878 */ _t16 = cpu->r[31] + 0x0000027Cu;
         /* 020BB878 */ cpu->r[3] = rbrew_read32(cpu->mem, _t16);
-        /* 020BB87C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BB880 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB87C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BB880 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB880 */ _t18 = _t17 & 0x00000001u;
         /* 020BB880 */ if (_t18) goto L_020BB8A4; else goto L_020BB884;
   L_020BB884: ; // 0x20bb884
         /* 020BB884 */ Gambit_fn_020C3920(cpu);
-        /* 020BB888 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BB88C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB888 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BB88C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB88C */ _t20 = _t19 & 0x00000001u;
         /* 020BB88C */ if (_t20) goto L_020BB8A4; else goto L_020BB890;
   L_020BB890: ; // 0x20bb890
@@ -27613,8 +27613,8 @@ void Gambit_fn_020BB8BC(CPUState* cpu) {
         /* 020BB8CC */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 020BB8D0 */ _t4 = cpu->r[31] + 0x000001E4u;
         /* 020BB8D0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t4);
-        /* 020BB8D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020BB8D8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB8D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020BB8D8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB8D8 */ _t6 = _t5 & 0x00000001u;
         /* 020BB8D8 */ if (_t6) goto L_020BB8DC; else goto L_020BB914;
   L_020BB8DC: ; // 0x20bb8dc
@@ -27627,8 +27627,8 @@ void Gambit_fn_020BB8BC(CPUState* cpu) {
         /* 020BB8EC */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020BB8F0 */ _t9 = cpu->r[31] + 0x00000280u;
         /* 020BB8F0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t9);
-        /* 020BB8F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BB8F8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB8F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BB8F8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB8F8 */ _t11 = _t10 & 0x00000001u;
         /* 020BB8F8 */ if (_t11) goto L_020BB914; else goto L_020BB8FC;
   L_020BB8FC: ; // 0x20bb8fc
@@ -27650,8 +27650,8 @@ void Gambit_fn_020BB8BC(CPUState* cpu) {
         /* 020BB924 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020BB928 */ _t16 = cpu->r[31] + 0x00000280u;
         /* 020BB928 */ cpu->r[11] = rbrew_read8(cpu->mem, _t16);
-        /* 020BB92C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020BB930 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB92C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020BB930 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB930 */ _t18 = _t17 & 0x00000001u;
         /* 020BB930 */ if (_t18) goto L_020BB9DC; else goto L_020BB934;
   L_020BB934: ; // 0x20bb934
@@ -27659,22 +27659,22 @@ void Gambit_fn_020BB8BC(CPUState* cpu) {
         /* 020BB934 */ cpu->r[12] = rbrew_read32(cpu->mem, _t19);
         /* 020BB938 */ _t20 = cpu->r[12] + 0x0000047Eu;
         /* 020BB938 */ cpu->r[0] = rbrew_read8(cpu->mem, _t20);
-        /* 020BB93C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BB940 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB93C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BB940 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB940 */ _t22 = _t21 & 0x00000001u;
         /* 020BB940 */ if (_t22) goto L_020BB9DC; else goto L_020BB944;
   L_020BB944: ; // 0x20bb944
         /* 020BB944 */ _t23 = cpu->r[31] + 0x00000218u;
         /* 020BB944 */ cpu->r[0] = rbrew_read32(cpu->mem, _t23);
-        /* 020BB948 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BB94C */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB948 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BB94C */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB94C */ _t25 = _t24 & 0x00000001u;
         /* 020BB94C */ if (_t25) goto L_020BB950; else goto L_020BB978;
   L_020BB950: ; // 0x20bb950
         /* 020BB950 */ _t26 = cpu->r[31] + 0x0000027Cu;
         /* 020BB950 */ cpu->r[3] = rbrew_read32(cpu->mem, _t26);
-        /* 020BB954 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BB958 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB954 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BB958 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB958 */ _t28 = _t27 & 0x00000001u;
         /* 020BB958 */ if (_t28) goto L_020BB9DC; else goto L_020BB95C;
   L_020BB95C: ; // 0x20bb95c
@@ -27684,8 +27684,8 @@ void Gambit_fn_020BB8BC(CPUState* cpu) {
         /* 020BB960 */ cpu->r[12] = rbrew_read32(cpu->mem, _t30);
         /* 020BB964 */ cpu->ctr = cpu->r[12];
         /* 020BB968 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020BB96C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BB970 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB96C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BB970 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB970 */ _t32 = _t31 & 0x00000001u;
         /* 020BB970 */ if (_t32) goto L_020BB9DC; else goto L_020BB974;
   L_020BB974: ; // 0x20bb974
@@ -27700,15 +27700,15 @@ void Gambit_fn_020BB8BC(CPUState* cpu) {
         /* 020BB988 */ _t35 = cpu->r[30] + 0x0000008Cu;
         /* 020BB988 */ cpu->r[11] = rbrew_read32(cpu->mem, _t35);
         /* 020BB98C */ cpu->r[0] = cpu->r[3] & cpu->r[11];
-        /* 020BB98C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BB990 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB98C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BB990 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB990 */ _t37 = _t36 & 0x00000001u;
         /* 020BB990 */ if (_t37) goto L_020BB9DC; else goto L_020BB994;
   L_020BB994: ; // 0x20bb994
         /* 020BB994 */ cpu->r[3] = cpu->r[31];
         /* 020BB998 */ Gambit_fn_020BADF4(cpu);
-        /* 020BB99C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BB9A0 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB99C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BB9A0 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB9A0 */ _t39 = _t38 & 0x00000001u;
         /* 020BB9A0 */ if (_t39) goto L_020BB9D4; else goto L_020BB9A4;
   L_020BB9A4: ; // 0x20bb9a4
@@ -27716,8 +27716,8 @@ void Gambit_fn_020BB8BC(CPUState* cpu) {
         /* 020BB9A4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t40);
         /* 020BB9A8 */ _t41 = cpu->r[11] + 0x0000047Du;
         /* 020BB9A8 */ cpu->r[12] = rbrew_read8(cpu->mem, _t41);
-        /* 020BB9AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020BB9B0 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB9AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020BB9B0 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB9B0 */ _t43 = _t42 & 0x00000001u;
         /* 020BB9B0 */ if (_t43) goto L_020BB9B4; else goto L_020BB9DC;
   L_020BB9B4: ; // 0x20bb9b4
@@ -27737,15 +27737,15 @@ void Gambit_fn_020BB8BC(CPUState* cpu) {
   L_020BB9DC: ; // 0x20bb9dc
         /* 020BB9DC */ _t46 = cpu->r[31] + 0x00000281u;
         /* 020BB9DC */ cpu->r[11] = rbrew_read8(cpu->mem, _t46);
-        /* 020BB9E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020BB9E4 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB9E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020BB9E4 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB9E4 */ _t48 = _t47 & 0x00000001u;
         /* 020BB9E4 */ if (_t48) goto L_020BB9E8; else goto L_020BB9F4;
   L_020BB9E8: ; // 0x20bb9e8
         /* 020BB9E8 */ _t49 = cpu->r[31] + 0x00000282u;
         /* 020BB9E8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t49);
-        /* 020BB9EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BB9F0 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BB9EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BB9F0 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BB9F0 */ _t51 = _t50 & 0x00000001u;
         /* 020BB9F0 */ if (_t51) goto L_020BBA08; else goto L_020BB9F4;
   L_020BB9F4: ; // 0x20bb9f4
@@ -27782,8 +27782,8 @@ void Gambit_fn_020BBA24(CPUState* cpu) {
         /* 020BBA30 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020BBA34 */ _t3 = cpu->r[31] + 0x000001E4u;
         /* 020BBA34 */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
-        /* 020BBA38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020BBA3C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBA38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020BBA3C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBA3C */ _t5 = _t4 & 0x00000001u;
         /* 020BBA3C */ if (_t5) goto L_020BBA40; else goto L_020BBA8C;
   L_020BBA40: ; // 0x20bba40
@@ -27797,24 +27797,24 @@ void Gambit_fn_020BBA24(CPUState* cpu) {
         /* 020BBA54 */ Gambit_fn_020DACF0(cpu);
         /* 020BBA58 */ _t8 = cpu->r[31] + 0x0000027Cu;
         /* 020BBA58 */ cpu->r[3] = rbrew_read32(cpu->mem, _t8);
-        /* 020BBA5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BBA60 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBA5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BBA60 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBA60 */ _t10 = _t9 & 0x00000001u;
         /* 020BBA60 */ if (_t10) goto L_020BBAB0; else goto L_020BBA64;
   L_020BBA64: ; // 0x20bba64
         /* 020BBA64 */ Gambit_fn_020C3920(cpu);
-        /* 020BBA68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 020BBA68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 020BBA6C */ _t11 = cpu->r[31] + 0x0000027Cu;
         /* 020BBA6C */ cpu->r[3] = rbrew_read32(cpu->mem, _t11);
-        /* 020BBA70 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBA70 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBA70 */ _t13 = _t12 & 0x00000001u;
         /* 020BBA70 */ if (_t13) goto L_020BBA88; else goto L_020BBA74;
   L_020BBA74: ; // 0x20bba74
         /* 020BBA74 */ Gambit_fn_020C3948(cpu);
         /* 020BBA78 */ _t14 = cpu->r[31] + 0x0000027Cu;
         /* 020BBA78 */ cpu->r[3] = rbrew_read32(cpu->mem, _t14);
-        /* 020BBA7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BBA80 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBA7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BBA80 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBA80 */ _t16 = _t15 & 0x00000001u;
         /* 020BBA80 */ if (_t16) goto L_020BBAB0; else goto L_020BBA84;
   L_020BBA84: ; // 0x20bba84
@@ -27824,21 +27824,21 @@ void Gambit_fn_020BBA24(CPUState* cpu) {
   L_020BBA8C: ; // 0x20bba8c
         /* 020BBA8C */ _t17 = cpu->r[31] + 0x0000027Cu;
         /* 020BBA8C */ cpu->r[3] = rbrew_read32(cpu->mem, _t17);
-        /* 020BBA90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BBA94 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBA90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BBA94 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBA94 */ _t19 = _t18 & 0x00000001u;
         /* 020BBA94 */ if (_t19) goto L_020BBAB0; else goto L_020BBA98;
   L_020BBA98: ; // 0x20bba98
         /* 020BBA98 */ _t20 = cpu->r[31] + 0x00000280u;
         /* 020BBA98 */ cpu->r[0] = rbrew_read8(cpu->mem, _t20);
-        /* 020BBA9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BBAA0 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBA9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BBAA0 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBAA0 */ _t22 = _t21 & 0x00000001u;
         /* 020BBAA0 */ if (_t22) goto L_020BBAB0; else goto L_020BBAA4;
   L_020BBAA4: ; // 0x20bbaa4
         /* 020BBAA4 */ Gambit_fn_020C38CC(cpu);
-        /* 020BBAA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BBAAC */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBAA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BBAAC */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBAAC */ _t24 = _t23 & 0x00000001u;
         /* 020BBAAC */ if (_t24) goto L_020BBAC4; else goto L_020BBAB0;
   L_020BBAB0: ; // 0x20bbab0
@@ -27873,8 +27873,8 @@ void Gambit_fn_020BBADC(CPUState* cpu) {
         /* 020BBAE8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020BBAEC */ _t3 = cpu->r[31] + 0x000001E4u;
         /* 020BBAEC */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 020BBAF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BBAF4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBAF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BBAF4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBAF4 */ _t5 = _t4 & 0x00000001u;
         /* 020BBAF4 */ if (_t5) goto L_020BBAF8; else goto L_020BBB20;
   L_020BBAF8: ; // 0x20bbaf8
@@ -27898,15 +27898,15 @@ void Gambit_fn_020BBADC(CPUState* cpu) {
         /* 020BBB28 */ cpu->r[4] = cpu->r[3];
         /* 020BBB2C */ cpu->r[3] = cpu->r[31];
         /* 020BBB30 */ Gambit_fn_027EDF00(cpu);
-        /* 020BBB34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BBB38 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBB34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BBB38 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBB38 */ _t11 = _t10 & 0x00000001u;
         /* 020BBB38 */ if (_t11) goto L_020BBBB8; else goto L_020BBB3C;
   L_020BBB3C: ; // 0x20bbb3c
         /* 020BBB3C */ _t12 = cpu->r[31] + 0x00000282u;
         /* 020BBB3C */ cpu->r[11] = rbrew_read8(cpu->mem, _t12);
-        /* 020BBB40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020BBB44 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBB40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020BBB44 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBB44 */ _t14 = _t13 & 0x00000001u;
         /* 020BBB44 */ if (_t14) goto L_020BBBA4; else goto L_020BBB48;
   L_020BBB48: ; // 0x20bbb48
@@ -28073,15 +28073,15 @@ void Gambit_fn_020BBC38(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020BBC38: ; // 0x20bbc38
-        /* 020BBC38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BBC3C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBC38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BBC3C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBC3C */ _t1 = _t0 & 0x00000001u;
         /* 020BBC3C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BBC3C */ goto L_020BBC40;
   L_020BBC40: ; // 0x20bbc40
         /* 020BBC40 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020BBC40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BBC44 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBC40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BBC44 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBC44 */ _t3 = _t2 & 0x00000001u;
         /* 020BBC44 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BBC44 */ goto L_020BBC48;
@@ -28100,8 +28100,8 @@ void Gambit_fn_020BBC38(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -28115,15 +28115,15 @@ void Gambit_fn_020BBC38(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -28151,15 +28151,15 @@ void Gambit_fn_020BBC4C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020BBC4C: ; // 0x20bbc4c
-        /* 020BBC4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BBC50 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBC4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BBC50 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBC50 */ _t1 = _t0 & 0x00000001u;
         /* 020BBC50 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BBC50 */ goto L_020BBC54;
   L_020BBC54: ; // 0x20bbc54
         /* 020BBC54 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020BBC54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BBC58 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBC54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BBC58 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBC58 */ _t3 = _t2 & 0x00000001u;
         /* 020BBC58 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BBC58 */ goto L_020BBC5C;
@@ -28178,8 +28178,8 @@ void Gambit_fn_020BBC4C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -28193,15 +28193,15 @@ void Gambit_fn_020BBC4C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -28238,11 +28238,11 @@ void Gambit_fn_020BBC60(CPUState* cpu) {
         /* 020BBC6C */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020BBC6C */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020BBC70 */ cpu->r[30] = cpu->r[3];
-        /* 020BBC70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020BBC70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020BBC74 */ cpu->r[31] = cpu->r[4];
         /* 020BBC78 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020BBC78 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020BBC7C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBC7C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBC7C */ _t5 = _t4 & 0x00000001u;
         /* 020BBC7C */ if (_t5) goto L_020BBCC0; else goto L_020BBC80;
   L_020BBC80: ; // 0x20bbc80
@@ -28262,8 +28262,8 @@ void Gambit_fn_020BBC60(CPUState* cpu) {
         /* 020BBCA8 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020BBCAC */ Gambit_fn_02068798(cpu);
         /* 020BBCB0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020BBCB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BBCB4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBCB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BBCB4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBCB4 */ _t10 = _t9 & 0x00000001u;
         /* 020BBCB4 */ if (_t10) goto L_020BBCC0; else goto L_020BBCB8;
   L_020BBCB8: ; // 0x20bbcb8
@@ -28294,11 +28294,11 @@ void Gambit_fn_020BBC64(CPUState* cpu) {
         /* 020BBC6C */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020BBC6C */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020BBC70 */ cpu->r[30] = cpu->r[3];
-        /* 020BBC70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020BBC70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020BBC74 */ cpu->r[31] = cpu->r[4];
         /* 020BBC78 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020BBC78 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020BBC7C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBC7C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBC7C */ _t5 = _t4 & 0x00000001u;
         /* 020BBC7C */ if (_t5) goto L_020BBCC0; else goto L_020BBC80;
   L_020BBC80: ; // 0x20bbc80
@@ -28318,8 +28318,8 @@ void Gambit_fn_020BBC64(CPUState* cpu) {
         /* 020BBCA8 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020BBCAC */ Gambit_fn_02068798(cpu);
         /* 020BBCB0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020BBCB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BBCB4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBCB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BBCB4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBCB4 */ _t10 = _t9 & 0x00000001u;
         /* 020BBCB4 */ if (_t10) goto L_020BBCC0; else goto L_020BBCB8;
   L_020BBCB8: ; // 0x20bbcb8
@@ -28374,15 +28374,15 @@ void Gambit_fn_020BBCF0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020BBCF0: ; // 0x20bbcf0
-        /* 020BBCF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BBCF4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBCF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BBCF4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBCF4 */ _t1 = _t0 & 0x00000001u;
         /* 020BBCF4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BBCF4 */ goto L_020BBCF8;
   L_020BBCF8: ; // 0x20bbcf8
         /* 020BBCF8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020BBCF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BBCFC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBCF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BBCFC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBCFC */ _t3 = _t2 & 0x00000001u;
         /* 020BBCFC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BBCFC */ goto L_020BBD00;
@@ -28401,8 +28401,8 @@ void Gambit_fn_020BBCF0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -28416,15 +28416,15 @@ void Gambit_fn_020BBCF0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -28470,15 +28470,15 @@ void Gambit_fn_020BBD20(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020BBD20: ; // 0x20bbd20
-        /* 020BBD20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BBD24 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBD20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BBD24 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBD24 */ _t1 = _t0 & 0x00000001u;
         /* 020BBD24 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BBD24 */ goto L_020BBD28;
   L_020BBD28: ; // 0x20bbd28
         /* 020BBD28 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020BBD28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BBD2C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBD28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BBD2C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBD2C */ _t3 = _t2 & 0x00000001u;
         /* 020BBD2C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BBD2C */ goto L_020BBD30;
@@ -28497,8 +28497,8 @@ void Gambit_fn_020BBD20(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -28512,15 +28512,15 @@ void Gambit_fn_020BBD20(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -28548,15 +28548,15 @@ void Gambit_fn_020BBD34(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020BBD34: ; // 0x20bbd34
-        /* 020BBD34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BBD38 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBD34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BBD38 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBD38 */ _t1 = _t0 & 0x00000001u;
         /* 020BBD38 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BBD38 */ goto L_020BBD3C;
   L_020BBD3C: ; // 0x20bbd3c
         /* 020BBD3C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020BBD3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BBD40 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBD3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BBD40 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBD40 */ _t3 = _t2 & 0x00000001u;
         /* 020BBD40 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BBD40 */ goto L_020BBD44;
@@ -28575,8 +28575,8 @@ void Gambit_fn_020BBD34(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -28590,15 +28590,15 @@ void Gambit_fn_020BBD34(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -28626,15 +28626,15 @@ void Gambit_fn_020BBD48(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020BBD48: ; // 0x20bbd48
-        /* 020BBD48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BBD4C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBD48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BBD4C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBD4C */ _t1 = _t0 & 0x00000001u;
         /* 020BBD4C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BBD4C */ goto L_020BBD50;
   L_020BBD50: ; // 0x20bbd50
         /* 020BBD50 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020BBD50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BBD54 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBD50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BBD54 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBD54 */ _t3 = _t2 & 0x00000001u;
         /* 020BBD54 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BBD54 */ goto L_020BBD58;
@@ -28653,8 +28653,8 @@ void Gambit_fn_020BBD48(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -28668,15 +28668,15 @@ void Gambit_fn_020BBD48(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -28793,10 +28793,10 @@ void Gambit_fn_020BBDA8(CPUState* cpu) {
         /* 020BBDA8 */ cpu->r[12] = 0x101D0000u;
         /* 020BBDAC */ _t0 = cpu->r[12] + 0xFFFFE370u;
         /* 020BBDAC */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 020BBDB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 020BBDB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 020BBDB4 */ cpu->r[12] = 0x101D0000u;
         /* 020BBDB8 */ cpu->r[12] = cpu->r[12] + 0xFFFFEE18u;
-        /* 020BBDBC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBDBC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBDBC */ _t2 = _t1 & 0x00000001u;
         /* 020BBDBC */ if (_t2) goto L_020BBDC0; else goto L_020BBDD8;
   L_020BBDC0: ; // 0x20bbdc0
@@ -28809,8 +28809,8 @@ void Gambit_fn_020BBDA8(CPUState* cpu) {
         /* 020BBDD4 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 020BBDD4 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_020BBDD8: ; // 0x20bbdd8
-        /* 020BBDD8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 020BBDDC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBDD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 020BBDDC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBDDC */ _t6 = _t5 & 0x00000001u;
         /* 020BBDDC */ if (_t6) goto L_020BBDE0; else goto L_020BBDE8;
   L_020BBDE0: ; // 0x20bbde0
@@ -28822,9 +28822,9 @@ void Gambit_fn_020BBDA8(CPUState* cpu) {
         /* 020BBDEC */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 020BBDEC */ cpu->r[11] = _t7;
         /* 020BBDF0 */ cpu->r[10] = 0x101D0000u;
-        /* 020BBDF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020BBDF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020BBDF8 */ cpu->r[10] = cpu->r[10] + 0xFFFFED90u;
-        /* 020BBDFC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBDFC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBDFC */ _t9 = _t8 & 0x00000001u;
         /* 020BBDFC */ if (_t9) goto L_020BBE00; else goto L_020BBE14;
   L_020BBE00: ; // 0x20bbe00
@@ -28836,8 +28836,8 @@ void Gambit_fn_020BBDA8(CPUState* cpu) {
         /* 020BBE10 */ _t11 = cpu->r[10] + 0x00000000u;
         /* 020BBE10 */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
   L_020BBE14: ; // 0x20bbe14
-        /* 020BBE14 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 020BBE18 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBE14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 020BBE18 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBE18 */ _t13 = _t12 & 0x00000001u;
         /* 020BBE18 */ if (_t13) goto L_020BBE1C; else goto L_020BBE24;
   L_020BBE1C: ; // 0x20bbe1c
@@ -28849,9 +28849,9 @@ void Gambit_fn_020BBDA8(CPUState* cpu) {
         /* 020BBE28 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 020BBE28 */ cpu->r[8] = _t14;
         /* 020BBE2C */ cpu->r[11] = 0x101D0000u;
-        /* 020BBE30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020BBE30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020BBE34 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 020BBE38 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBE38 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBE38 */ _t16 = _t15 & 0x00000001u;
         /* 020BBE38 */ if (_t16) goto L_020BBE3C; else goto L_020BBE50;
   L_020BBE3C: ; // 0x20bbe3c
@@ -28924,18 +28924,18 @@ void Gambit_fn_020BBE7C(CPUState* cpu) {
         /* 02053FC4 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02053FC4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02053FC8 */ cpu->r[12] = 0x00000000u;
-        /* 02053FCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02053FCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02053FD0 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 02053FD0 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02053FD4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02053FD4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02053FD4 */ _t6 = _t5 & 0x00000001u;
         /* 02053FD4 */ if (_t6) goto L_02053FFC; else goto L_02053FD8;
   L_02053FD8: ; // 0x2053fd8
         /* 02053FD8 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02053FD8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02053FDC */ /* nop */
-        /* 02053FE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 02053FE4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02053FE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 02053FE4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02053FE4 */ _t9 = _t8 & 0x00000001u;
         /* 02053FE4 */ if (_t9) goto L_02053FE8; else goto L_02053FFC;
   L_02053FE8: ; // 0x2053fe8
@@ -29020,10 +29020,10 @@ void Gambit_fn_020BBEA4(CPUState* cpu) {
         /* 020BBEC4 */ cpu->r[31] = 0x101D0000u;
         /* 020BBEC8 */ _t3 = cpu->r[28] + 0x0000001Cu;
         /* 020BBEC8 */ rbrew_write32(cpu->mem, _t3, cpu->r[4]);
-        /* 020BBECC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020BBECC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020BBED0 */ _t4 = cpu->r[28] + 0x0000000Fu;
         /* 020BBED0 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[27]);
-        /* 020BBED4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBED4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBED4 */ _t6 = _t5 & 0x00000001u;
         /* 020BBED4 */ if (_t6) goto L_020BBF18; else goto L_020BBED8;
   L_020BBED8: ; // 0x20bbed8
@@ -29038,16 +29038,16 @@ void Gambit_fn_020BBEA4(CPUState* cpu) {
         /* 020BBEEC */ cpu->r[5] = 0x00000004u;
         /* 020BBEF0 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020BBEF4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020BBEF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020BBEF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020BBEFC */ cpu->r[0] = cpu->r[27];
-        /* 020BBF00 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BBF00 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BBF00 */ _t11 = _t10 & 0x00000001u;
         /* 020BBF00 */ if (_t11) goto L_020BBF08; else goto L_020BBF04;
   L_020BBF04: ; // 0x20bbf04
         /* 020BBF04 */ cpu->r[0] = 0x00000001u;
   L_020BBF08: ; // 0x20bbf08
-        /* 020BBF08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BBF0C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBF08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BBF0C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBF0C */ _t13 = _t12 & 0x00000001u;
         /* 020BBF0C */ if (_t13) goto L_020BBF18; else goto L_020BBF10;
   L_020BBF10: ; // 0x20bbf10
@@ -29059,9 +29059,9 @@ void Gambit_fn_020BBEA4(CPUState* cpu) {
         /* 020BBF18 */ _t16 = cpu->r[28] + 0x00000020u;
         /* 020BBF18 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 020BBF1C */ cpu->r[0] = 0x00000000u;
-        /* 020BBF20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 020BBF20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 020BBF24 */ cpu->r[12] = cpu->r[0];
-        /* 020BBF28 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BBF28 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BBF28 */ _t18 = _t17 & 0x00000001u;
         /* 020BBF28 */ if (_t18) goto L_020BBF2C; else goto L_020BBF50;
   L_020BBF2C: ; // 0x20bbf2c
@@ -29086,8 +29086,8 @@ void Gambit_fn_020BBEA4(CPUState* cpu) {
   L_020BBF50: ; // 0x20bbf50
         /* 020BBF50 */ _t26 = cpu->r[28] + 0x0000000Fu;
         /* 020BBF50 */ cpu->r[27] = rbrew_read8(cpu->mem, _t26);
-        /* 020BBF54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020BBF58 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBF54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020BBF58 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBF58 */ _t28 = _t27 & 0x00000001u;
         /* 020BBF58 */ if (_t28) goto L_020BBF9C; else goto L_020BBF5C;
   L_020BBF5C: ; // 0x20bbf5c
@@ -29102,16 +29102,16 @@ void Gambit_fn_020BBEA4(CPUState* cpu) {
         /* 020BBF70 */ cpu->r[5] = 0x00000004u;
         /* 020BBF74 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020BBF78 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020BBF7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020BBF7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020BBF80 */ cpu->r[11] = cpu->r[27];
-        /* 020BBF84 */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BBF84 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BBF84 */ _t33 = _t32 & 0x00000001u;
         /* 020BBF84 */ if (_t33) goto L_020BBF8C; else goto L_020BBF88;
   L_020BBF88: ; // 0x20bbf88
         /* 020BBF88 */ cpu->r[11] = 0x00000001u;
   L_020BBF8C: ; // 0x20bbf8c
-        /* 020BBF8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BBF90 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBF8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BBF90 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBF90 */ _t35 = _t34 & 0x00000001u;
         /* 020BBF90 */ if (_t35) goto L_020BBF9C; else goto L_020BBF94;
   L_020BBF94: ; // 0x20bbf94
@@ -29123,9 +29123,9 @@ void Gambit_fn_020BBEA4(CPUState* cpu) {
         /* 020BBF9C */ _t38 = cpu->r[28] + 0x00000028u;
         /* 020BBF9C */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 020BBFA0 */ cpu->r[0] = 0x00000000u;
-        /* 020BBFA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 020BBFA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 020BBFA8 */ cpu->r[12] = cpu->r[0];
-        /* 020BBFAC */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BBFAC */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BBFAC */ _t40 = _t39 & 0x00000001u;
         /* 020BBFAC */ if (_t40) goto L_020BBFB0; else goto L_020BBFD4;
   L_020BBFB0: ; // 0x20bbfb0
@@ -29150,8 +29150,8 @@ void Gambit_fn_020BBEA4(CPUState* cpu) {
   L_020BBFD4: ; // 0x20bbfd4
         /* 020BBFD4 */ _t48 = cpu->r[28] + 0x0000000Fu;
         /* 020BBFD4 */ cpu->r[27] = rbrew_read8(cpu->mem, _t48);
-        /* 020BBFD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020BBFDC */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BBFD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020BBFDC */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BBFDC */ _t50 = _t49 & 0x00000001u;
         /* 020BBFDC */ if (_t50) goto L_020BC020; else goto L_020BBFE0;
   L_020BBFE0: ; // 0x20bbfe0
@@ -29166,16 +29166,16 @@ void Gambit_fn_020BBEA4(CPUState* cpu) {
         /* 020BBFF4 */ cpu->r[5] = 0x00000004u;
         /* 020BBFF8 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020BBFFC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020BC000 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020BC000 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020BC004 */ cpu->r[10] = cpu->r[27];
-        /* 020BC008 */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BC008 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BC008 */ _t55 = _t54 & 0x00000001u;
         /* 020BC008 */ if (_t55) goto L_020BC010; else goto L_020BC00C;
   L_020BC00C: ; // 0x20bc00c
         /* 020BC00C */ cpu->r[10] = 0x00000001u;
   L_020BC010: ; // 0x20bc010
-        /* 020BC010 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BC014 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC010 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BC014 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC014 */ _t57 = _t56 & 0x00000001u;
         /* 020BC014 */ if (_t57) goto L_020BC020; else goto L_020BC018;
   L_020BC018: ; // 0x20bc018
@@ -29187,9 +29187,9 @@ void Gambit_fn_020BBEA4(CPUState* cpu) {
         /* 020BC020 */ _t60 = cpu->r[28] + 0x00000030u;
         /* 020BC020 */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
         /* 020BC024 */ cpu->r[0] = 0x00000000u;
-        /* 020BC028 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 020BC028 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 020BC02C */ cpu->r[5] = cpu->r[0];
-        /* 020BC030 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BC030 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BC030 */ _t62 = _t61 & 0x00000001u;
         /* 020BC030 */ if (_t62) goto L_020BC034; else goto L_020BC058;
   L_020BC034: ; // 0x20bc034
@@ -29214,8 +29214,8 @@ void Gambit_fn_020BBEA4(CPUState* cpu) {
   L_020BC058: ; // 0x20bc058
         /* 020BC058 */ _t70 = cpu->r[30] + 0x00000000u;
         /* 020BC058 */ cpu->r[25] = rbrew_read8(cpu->mem, _t70);
-        /* 020BC05C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 020BC060 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC05C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 020BC060 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC060 */ _t72 = _t71 & 0x00000001u;
         /* 020BC060 */ if (_t72) goto L_020BC13C; else goto L_020BC064;
   L_020BC064: ; // 0x20bc064
@@ -29231,10 +29231,10 @@ void Gambit_fn_020BBEA4(CPUState* cpu) {
         /* 020BC07C */ cpu->r[4] = (uint32_t)((int32_t)cpu->r[25] * (int32_t)0x00000024u);
         /* 020BC080 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020BC084 */ cpu->r[24] = cpu->r[3];
-        /* 020BC088 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 020BC088 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 020BC08C */ cpu->r[30] = cpu->r[25];
         /* 020BC090 */ cpu->r[7] = 0x00000000u;
-        /* 020BC094 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BC094 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BC094 */ _t77 = _t76 & 0x00000001u;
         /* 020BC094 */ if (_t77) goto L_020BC09C; else goto L_020BC098;
   L_020BC098: ; // 0x20bc098
@@ -29247,36 +29247,36 @@ void Gambit_fn_020BBEA4(CPUState* cpu) {
         /* 020BC0A8 */ cpu->r[23] = 0x00000018u;
   L_020BC0AC: ; // 0x20bc0ac
         /* 020BC0AC */ cpu->r[27] = cpu->r[24] + cpu->r[22];
-        /* 020BC0AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020BC0B0 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC0AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020BC0B0 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC0B0 */ _t80 = _t79 & 0x00000001u;
         /* 020BC0B0 */ if (_t80) goto L_020BC120; else goto L_020BC0B4;
   L_020BC0B4: ; // 0x20bc0b4
         /* 020BC0B4 */ cpu->r[26] = cpu->r[27];
-        /* 020BC0B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 020BC0B8 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC0B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 020BC0B8 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC0B8 */ _t82 = _t81 & 0x00000001u;
         /* 020BC0B8 */ if (_t82) goto L_020BC0BC; else goto L_020BC0CC;
   L_020BC0BC: ; // 0x20bc0bc
         /* 020BC0BC */ cpu->r[3] = 0x00000024u;
         /* 020BC0C0 */ Gambit_fn_02801A78(cpu);
         /* 020BC0C4 */ cpu->r[26] = cpu->r[3];
-        /* 020BC0C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 020BC0C8 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC0C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 020BC0C8 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC0C8 */ _t84 = _t83 & 0x00000001u;
         /* 020BC0C8 */ if (_t84) goto L_020BC114; else goto L_020BC0CC;
   L_020BC0CC: ; // 0x20bc0cc
         /* 020BC0CC */ cpu->r[11] = cpu->r[26];
-        /* 020BC0CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020BC0D0 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC0CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020BC0D0 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC0D0 */ _t86 = _t85 & 0x00000001u;
         /* 020BC0D0 */ if (_t86) goto L_020BC0D4; else goto L_020BC0E4;
   L_020BC0D4: ; // 0x20bc0d4
         /* 020BC0D4 */ cpu->r[3] = 0x0000000Cu;
         /* 020BC0D8 */ Gambit_fn_02801A78(cpu);
         /* 020BC0DC */ cpu->r[11] = cpu->r[3];
-        /* 020BC0DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020BC0E0 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC0DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020BC0E0 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC0E0 */ _t88 = _t87 & 0x00000001u;
         /* 020BC0E0 */ if (_t88) goto L_020BC100; else goto L_020BC0E4;
   L_020BC0E4: ; // 0x20bc0e4
@@ -29307,14 +29307,14 @@ void Gambit_fn_020BBEA4(CPUState* cpu) {
         /* 020BC11C */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
   L_020BC120: ; // 0x20bc120
         /* 020BC120 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 020BC120 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020BC120 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020BC124 */ cpu->r[22] = cpu->r[22] + 0x00000024u;
-        /* 020BC128 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC128 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC128 */ _t98 = _t97 & 0x00000001u;
         /* 020BC128 */ if (_t98) goto L_020BC12C; else goto L_020BC0AC;
   L_020BC12C: ; // 0x20bc12c
-        /* 020BC12C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 020BC130 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC12C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 020BC130 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC130 */ _t100 = _t99 & 0x00000001u;
         /* 020BC130 */ if (_t100) goto L_020BC13C; else goto L_020BC134;
   L_020BC134: ; // 0x20bc134
@@ -29344,10 +29344,10 @@ void Gambit_fn_020BC154(CPUState* cpu) {
         /* 020BC158 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 020BC15C */ _t2 = cpu->r[3] + 0x00000024u;
         /* 020BC15C */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 020BC160 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[12]);
+        /* 020BC160 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[12]));
         /* 020BC164 */ _t3 = cpu->r[4] + 0x00000000u;
         /* 020BC164 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 020BC168 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BC168 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BC168 */ _t5 = _t4 & 0x00000001u;
         /* 020BC168 */ if (_t5) goto L_020BC16C; else goto L_020BC174;
   L_020BC16C: ; // 0x20bc16c
@@ -29364,10 +29364,10 @@ void Gambit_fn_020BC154(CPUState* cpu) {
         /* 020BC180 */ cpu->r[9] = rbrew_read8(cpu->mem, _t9);
         /* 020BC184 */ _t10 = cpu->r[3] + 0x00000028u;
         /* 020BC184 */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 020BC188 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
+        /* 020BC188 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
         /* 020BC18C */ _t11 = cpu->r[3] + 0x0000002Cu;
         /* 020BC18C */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
-        /* 020BC190 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BC190 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BC190 */ _t13 = _t12 & 0x00000001u;
         /* 020BC190 */ if (_t13) goto L_020BC194; else goto L_020BC19C;
   L_020BC194: ; // 0x20bc194
@@ -29388,10 +29388,10 @@ void Gambit_fn_020BC154(CPUState* cpu) {
         /* 020BC1B0 */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
         /* 020BC1B4 */ _t20 = cpu->r[3] + 0x00000034u;
         /* 020BC1B4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 020BC1B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
+        /* 020BC1B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
         /* 020BC1BC */ _t21 = cpu->r[6] + 0x00000000u;
         /* 020BC1BC */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
-        /* 020BC1C0 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BC1C0 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BC1C0 */ _t23 = _t22 & 0x00000001u;
         /* 020BC1C0 */ if (_t23) goto L_020BC1C4; else goto L_020BC1CC;
   L_020BC1C4: ; // 0x20bc1c4
@@ -29420,16 +29420,16 @@ void Gambit_fn_020BC1DC(CPUState* cpu) {
         /* 020BC1E4 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020BC1E8 */ /* nop */
         /* 020BC1EC */ cpu->r[31] = cpu->r[3];
-        /* 020BC1EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020BC1F0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC1EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020BC1F0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC1F0 */ _t3 = _t2 & 0x00000001u;
         /* 020BC1F0 */ if (_t3) goto L_020BC1F4; else goto L_020BC204;
   L_020BC1F4: ; // 0x20bc1f4
         /* 020BC1F4 */ cpu->r[3] = 0x0000053Cu;
         /* 020BC1F8 */ Gambit_fn_02801A78(cpu);
         /* 020BC1FC */ cpu->r[31] = cpu->r[3];
-        /* 020BC1FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020BC200 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC1FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020BC200 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC200 */ _t5 = _t4 & 0x00000001u;
         /* 020BC200 */ if (_t5) goto L_020BC528; else goto L_020BC204;
   L_020BC204: ; // 0x20bc204
@@ -29444,7 +29444,7 @@ void Gambit_fn_020BC1DC(CPUState* cpu) {
         /* 020BC224 */ _t6 = cpu->r[31] + 0x0000044Cu;
         /* 020BC224 */ rbrew_write32(cpu->mem, _t6, cpu->r[12]);
         /* 020BC228 */ cpu->r[24] = cpu->r[31] + 0x00000450u;
-        /* 020BC228 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 020BC228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 020BC22C */ cpu->r[0] = cpu->r[0] + 0x000054E4u;
         /* 020BC230 */ _t7 = cpu->r[1] + 0x0000000Cu;
         /* 020BC230 */ rbrew_write32(cpu->mem, _t7, cpu->r[10]);
@@ -29453,42 +29453,42 @@ void Gambit_fn_020BC1DC(CPUState* cpu) {
         /* 020BC23C */ _t8 = cpu->r[1] + 0x00000008u;
         /* 020BC23C */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020BC240 */ cpu->r[27] = cpu->r[27] + 0x000053DCu;
-        /* 020BC244 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC244 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC244 */ _t10 = _t9 & 0x00000001u;
         /* 020BC244 */ if (_t10) goto L_020BC248; else goto L_020BC258;
   L_020BC248: ; // 0x20bc248
         /* 020BC248 */ cpu->r[3] = 0x0000002Cu;
         /* 020BC24C */ Gambit_fn_02801A78(cpu);
         /* 020BC250 */ cpu->r[24] = cpu->r[3];
-        /* 020BC250 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 020BC254 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC250 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 020BC254 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC254 */ _t12 = _t11 & 0x00000001u;
         /* 020BC254 */ if (_t12) goto L_020BC390; else goto L_020BC258;
   L_020BC258: ; // 0x20bc258
         /* 020BC258 */ cpu->r[23] = cpu->r[24];
-        /* 020BC258 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
-        /* 020BC25C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC258 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
+        /* 020BC25C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC25C */ _t14 = _t13 & 0x00000001u;
         /* 020BC25C */ if (_t14) goto L_020BC260; else goto L_020BC270;
   L_020BC260: ; // 0x20bc260
         /* 020BC260 */ cpu->r[3] = 0x0000002Cu;
         /* 020BC264 */ Gambit_fn_02801A78(cpu);
         /* 020BC268 */ cpu->r[23] = cpu->r[3];
-        /* 020BC268 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
-        /* 020BC26C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC268 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
+        /* 020BC26C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC26C */ _t16 = _t15 & 0x00000001u;
         /* 020BC26C */ if (_t16) goto L_020BC384; else goto L_020BC270;
   L_020BC270: ; // 0x20bc270
         /* 020BC270 */ cpu->r[3] = cpu->r[23];
-        /* 020BC270 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BC274 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC270 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BC274 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC274 */ _t18 = _t17 & 0x00000001u;
         /* 020BC274 */ if (_t18) goto L_020BC278; else goto L_020BC2CC;
   L_020BC278: ; // 0x20bc278
         /* 020BC278 */ cpu->r[3] = 0x0000000Cu;
         /* 020BC27C */ Gambit_fn_02801A78(cpu);
-        /* 020BC280 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BC284 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC280 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BC284 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC284 */ _t20 = _t19 & 0x00000001u;
         /* 020BC284 */ if (_t20) goto L_020BC288; else goto L_020BC2CC;
   L_020BC288: ; // 0x20bc288
@@ -29512,9 +29512,9 @@ void Gambit_fn_020BC1DC(CPUState* cpu) {
         /* 020BC2B4 */ _t27 = cpu->r[8] + 0x00000000u;
         /* 020BC2B4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t27);
         /* 020BC2B8 */ cpu->r[30] = 0x00000000u;
-        /* 020BC2BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[29]);
+        /* 020BC2BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[29]));
         /* 020BC2C0 */ cpu->r[0] = 0x00080000u;
-        /* 020BC2C4 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC2C4 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC2C4 */ _t29 = _t28 & 0x00000001u;
         /* 020BC2C4 */ if (_t29) goto L_020BC2C8; else goto L_020BC324;
   L_020BC2C8: ; // 0x20bc2c8
@@ -29550,23 +29550,23 @@ void Gambit_fn_020BC1DC(CPUState* cpu) {
         /* 020BC310 */ _t40 = cpu->r[8] + 0x00000000u;
         /* 020BC310 */ cpu->r[0] = rbrew_read8(cpu->mem, _t40);
         /* 020BC314 */ cpu->r[30] = 0x00000000u;
-        /* 020BC318 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[29]);
+        /* 020BC318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[29]));
         /* 020BC31C */ cpu->r[0] = 0x00080000u;
-        /* 020BC320 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC320 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC320 */ _t42 = _t41 & 0x00000001u;
         /* 020BC320 */ if (_t42) goto L_020BC2C8; else goto L_020BC324;
   L_020BC324: ; // 0x20bc324
         /* 020BC324 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020BC328 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 020BC328 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 020BC32C */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 020BC330 */ _t43 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BC330 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BC330 */ _t44 = _t43 & 0x00000001u;
         /* 020BC330 */ if (_t44) goto L_020BC344; else goto L_020BC334;
   L_020BC334: ; // 0x20bc334
         /* 020BC334 */ _t45 = cpu->r[8] + 0x00000000u;
         /* 020BC334 */ cpu->r[9] = rbrew_read8(cpu->mem, _t45);
-        /* 020BC338 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[29]);
-        /* 020BC33C */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC338 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[29]));
+        /* 020BC33C */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC33C */ _t47 = _t46 & 0x00000001u;
         /* 020BC33C */ if (_t47) goto L_020BC340; else goto L_020BC324;
   L_020BC340: ; // 0x20bc340
@@ -29576,10 +29576,10 @@ void Gambit_fn_020BC1DC(CPUState* cpu) {
   L_020BC348: ; // 0x20bc348
         /* 020BC348 */ _t48 = cpu->r[23] + 0x00000008u;
         /* 020BC348 */ cpu->r[11] = rbrew_read32(cpu->mem, _t48);
-        /* 020BC34C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[11]);
+        /* 020BC34C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[11]));
         /* 020BC350 */ _t49 = cpu->r[1] + 0x0000000Cu;
         /* 020BC350 */ cpu->r[10] = rbrew_read32(cpu->mem, _t49);
-        /* 020BC354 */ _t50 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BC354 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BC354 */ _t51 = _t50 & 0x00000001u;
         /* 020BC354 */ if (_t51) goto L_020BC35C; else goto L_020BC358;
   L_020BC358: ; // 0x20bc358
@@ -29622,23 +29622,23 @@ void Gambit_fn_020BC1DC(CPUState* cpu) {
         /* 020BC3B4 */ rbrew_write8(cpu->mem, _t61, (uint8_t)cpu->r[26]);
         /* 020BC3B8 */ Gambit_fn_02C89380(cpu);
         /* 020BC3BC */ cpu->r[22] = cpu->r[31] + 0x00000488u;
-        /* 020BC3BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 020BC3C0 */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC3BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 020BC3C0 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC3C0 */ _t63 = _t62 & 0x00000001u;
         /* 020BC3C0 */ if (_t63) goto L_020BC3C4; else goto L_020BC3D4;
   L_020BC3C4: ; // 0x20bc3c4
         /* 020BC3C4 */ cpu->r[3] = 0x000000B4u;
         /* 020BC3C8 */ Gambit_fn_02801A78(cpu);
         /* 020BC3CC */ cpu->r[22] = cpu->r[3];
-        /* 020BC3CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 020BC3D0 */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC3CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 020BC3D0 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC3D0 */ _t65 = _t64 & 0x00000001u;
         /* 020BC3D0 */ if (_t65) goto L_020BC528; else goto L_020BC3D4;
   L_020BC3D4: ; // 0x20bc3d4
         /* 020BC3D4 */ _t66 = cpu->r[22] + 0x00000000u;
         /* 020BC3D4 */ rbrew_write8(cpu->mem, _t66, (uint8_t)cpu->r[26]);
         /* 020BC3D8 */ cpu->r[23] = cpu->r[22] + 0x00000010u;
-        /* 020BC3D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
+        /* 020BC3D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
         /* 020BC3DC */ _t67 = cpu->r[22] + 0x00000004u;
         /* 020BC3DC */ rbrew_write32(cpu->mem, _t67, cpu->r[26]);
         /* 020BC3E0 */ cpu->r[30] = 0x10010000u;
@@ -29649,39 +29649,39 @@ void Gambit_fn_020BC1DC(CPUState* cpu) {
         /* 020BC3F0 */ cpu->r[28] = cpu->r[28] + 0x0000543Cu;
         /* 020BC3F4 */ _t69 = cpu->r[22] + 0x0000000Cu;
         /* 020BC3F4 */ rbrew_write32(cpu->mem, _t69, cpu->r[26]);
-        /* 020BC3F8 */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC3F8 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC3F8 */ _t71 = _t70 & 0x00000001u;
         /* 020BC3F8 */ if (_t71) goto L_020BC3FC; else goto L_020BC41C;
   L_020BC3FC: ; // 0x20bc3fc
         /* 020BC3FC */ cpu->r[3] = 0x0000004Cu;
         /* 020BC400 */ Gambit_fn_02801A78(cpu);
         /* 020BC404 */ cpu->r[23] = cpu->r[3];
-        /* 020BC404 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
-        /* 020BC408 */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC404 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
+        /* 020BC408 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC408 */ _t73 = _t72 & 0x00000001u;
         /* 020BC408 */ if (_t73) goto L_020BC40C; else goto L_020BC41C;
   L_020BC40C: ; // 0x20bc40c
         /* 020BC40C */ cpu->r[24] = cpu->r[22] + 0x0000005Cu;
-        /* 020BC40C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 020BC40C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 020BC410 */ _t74 = cpu->r[25] + 0x00007399u;
         /* 020BC410 */ cpu->r[29] = rbrew_read8(cpu->mem, _t74);
-        /* 020BC414 */ _t75 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC414 */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC414 */ _t76 = _t75 & 0x00000001u;
         /* 020BC414 */ if (_t76) goto L_020BC4A0; else goto L_020BC418;
   L_020BC418: ; // 0x20bc418
         /* 020BC418 */ goto L_020BC4B0;
   L_020BC41C: ; // 0x20bc41c
         /* 020BC41C */ cpu->r[24] = cpu->r[23];
-        /* 020BC41C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 020BC420 */ _t77 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC41C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 020BC420 */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC420 */ _t78 = _t77 & 0x00000001u;
         /* 020BC420 */ if (_t78) goto L_020BC424; else goto L_020BC440;
   L_020BC424: ; // 0x20bc424
         /* 020BC424 */ cpu->r[3] = 0x0000004Cu;
         /* 020BC428 */ Gambit_fn_02801A78(cpu);
         /* 020BC42C */ cpu->r[24] = cpu->r[3];
-        /* 020BC42C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 020BC430 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC42C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 020BC430 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC430 */ _t80 = _t79 & 0x00000001u;
         /* 020BC430 */ if (_t80) goto L_020BC434; else goto L_020BC440;
   L_020BC434: ; // 0x20bc434
@@ -29692,15 +29692,15 @@ void Gambit_fn_020BC1DC(CPUState* cpu) {
         /* 020BC43C */ goto L_020BC498;
   L_020BC440: ; // 0x20bc440
         /* 020BC440 */ cpu->r[3] = cpu->r[24];
-        /* 020BC440 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BC444 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC440 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BC444 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC444 */ _t84 = _t83 & 0x00000001u;
         /* 020BC444 */ if (_t84) goto L_020BC448; else goto L_020BC46C;
   L_020BC448: ; // 0x20bc448
         /* 020BC448 */ cpu->r[3] = 0x0000000Cu;
         /* 020BC44C */ Gambit_fn_02801A78(cpu);
-        /* 020BC450 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BC454 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC450 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BC454 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC454 */ _t86 = _t85 & 0x00000001u;
         /* 020BC454 */ if (_t86) goto L_020BC458; else goto L_020BC46C;
   L_020BC458: ; // 0x20bc458
@@ -29737,43 +29737,43 @@ void Gambit_fn_020BC1DC(CPUState* cpu) {
         /* 020BC494 */ rbrew_write32(cpu->mem, _t99, cpu->r[28]);
   L_020BC498: ; // 0x20bc498
         /* 020BC498 */ cpu->r[24] = cpu->r[22] + 0x0000005Cu;
-        /* 020BC498 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 020BC49C */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC498 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 020BC49C */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC49C */ _t101 = _t100 & 0x00000001u;
         /* 020BC49C */ if (_t101) goto L_020BC4A0; else goto L_020BC4B0;
   L_020BC4A0: ; // 0x20bc4a0
         /* 020BC4A0 */ cpu->r[3] = 0x0000004Cu;
         /* 020BC4A4 */ Gambit_fn_02801A78(cpu);
         /* 020BC4A8 */ cpu->r[24] = cpu->r[3];
-        /* 020BC4A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 020BC4AC */ _t102 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC4A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 020BC4AC */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC4AC */ _t103 = _t102 & 0x00000001u;
         /* 020BC4AC */ if (_t103) goto L_020BC508; else goto L_020BC4B0;
   L_020BC4B0: ; // 0x20bc4b0
         /* 020BC4B0 */ cpu->r[25] = cpu->r[24];
-        /* 020BC4B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 020BC4B4 */ _t104 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC4B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 020BC4B4 */ _t104 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC4B4 */ _t105 = _t104 & 0x00000001u;
         /* 020BC4B4 */ if (_t105) goto L_020BC4B8; else goto L_020BC4C8;
   L_020BC4B8: ; // 0x20bc4b8
         /* 020BC4B8 */ cpu->r[3] = 0x0000004Cu;
         /* 020BC4BC */ Gambit_fn_02801A78(cpu);
         /* 020BC4C0 */ cpu->r[25] = cpu->r[3];
-        /* 020BC4C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 020BC4C4 */ _t106 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC4C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 020BC4C4 */ _t106 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC4C4 */ _t107 = _t106 & 0x00000001u;
         /* 020BC4C4 */ if (_t107) goto L_020BC504; else goto L_020BC4C8;
   L_020BC4C8: ; // 0x20bc4c8
         /* 020BC4C8 */ cpu->r[3] = cpu->r[25];
-        /* 020BC4C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BC4CC */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC4C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BC4CC */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC4CC */ _t109 = _t108 & 0x00000001u;
         /* 020BC4CC */ if (_t109) goto L_020BC4D0; else goto L_020BC4E0;
   L_020BC4D0: ; // 0x20bc4d0
         /* 020BC4D0 */ cpu->r[3] = 0x0000000Cu;
         /* 020BC4D4 */ Gambit_fn_02801A78(cpu);
-        /* 020BC4D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BC4DC */ _t110 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC4D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BC4DC */ _t110 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC4DC */ _t111 = _t110 & 0x00000001u;
         /* 020BC4DC */ if (_t111) goto L_020BC4F8; else goto L_020BC4E0;
   L_020BC4E0: ; // 0x20bc4e0
@@ -29835,16 +29835,16 @@ void Gambit_fn_020BC1E0(CPUState* cpu) {
         /* 020BC1E4 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020BC1E8 */ /* nop */
         /* 020BC1EC */ cpu->r[31] = cpu->r[3];
-        /* 020BC1EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020BC1F0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC1EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020BC1F0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC1F0 */ _t3 = _t2 & 0x00000001u;
         /* 020BC1F0 */ if (_t3) goto L_020BC1F4; else goto L_020BC204;
   L_020BC1F4: ; // 0x20bc1f4
         /* 020BC1F4 */ cpu->r[3] = 0x0000053Cu;
         /* 020BC1F8 */ Gambit_fn_02801A78(cpu);
         /* 020BC1FC */ cpu->r[31] = cpu->r[3];
-        /* 020BC1FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020BC200 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC1FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020BC200 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC200 */ _t5 = _t4 & 0x00000001u;
         /* 020BC200 */ if (_t5) goto L_020BC528; else goto L_020BC204;
   L_020BC204: ; // 0x20bc204
@@ -29859,7 +29859,7 @@ void Gambit_fn_020BC1E0(CPUState* cpu) {
         /* 020BC224 */ _t6 = cpu->r[31] + 0x0000044Cu;
         /* 020BC224 */ rbrew_write32(cpu->mem, _t6, cpu->r[12]);
         /* 020BC228 */ cpu->r[24] = cpu->r[31] + 0x00000450u;
-        /* 020BC228 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 020BC228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 020BC22C */ cpu->r[0] = cpu->r[0] + 0x000054E4u;
         /* 020BC230 */ _t7 = cpu->r[1] + 0x0000000Cu;
         /* 020BC230 */ rbrew_write32(cpu->mem, _t7, cpu->r[10]);
@@ -29868,42 +29868,42 @@ void Gambit_fn_020BC1E0(CPUState* cpu) {
         /* 020BC23C */ _t8 = cpu->r[1] + 0x00000008u;
         /* 020BC23C */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020BC240 */ cpu->r[27] = cpu->r[27] + 0x000053DCu;
-        /* 020BC244 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC244 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC244 */ _t10 = _t9 & 0x00000001u;
         /* 020BC244 */ if (_t10) goto L_020BC248; else goto L_020BC258;
   L_020BC248: ; // 0x20bc248
         /* 020BC248 */ cpu->r[3] = 0x0000002Cu;
         /* 020BC24C */ Gambit_fn_02801A78(cpu);
         /* 020BC250 */ cpu->r[24] = cpu->r[3];
-        /* 020BC250 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 020BC254 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC250 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 020BC254 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC254 */ _t12 = _t11 & 0x00000001u;
         /* 020BC254 */ if (_t12) goto L_020BC390; else goto L_020BC258;
   L_020BC258: ; // 0x20bc258
         /* 020BC258 */ cpu->r[23] = cpu->r[24];
-        /* 020BC258 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
-        /* 020BC25C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC258 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
+        /* 020BC25C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC25C */ _t14 = _t13 & 0x00000001u;
         /* 020BC25C */ if (_t14) goto L_020BC260; else goto L_020BC270;
   L_020BC260: ; // 0x20bc260
         /* 020BC260 */ cpu->r[3] = 0x0000002Cu;
         /* 020BC264 */ Gambit_fn_02801A78(cpu);
         /* 020BC268 */ cpu->r[23] = cpu->r[3];
-        /* 020BC268 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
-        /* 020BC26C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC268 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
+        /* 020BC26C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC26C */ _t16 = _t15 & 0x00000001u;
         /* 020BC26C */ if (_t16) goto L_020BC384; else goto L_020BC270;
   L_020BC270: ; // 0x20bc270
         /* 020BC270 */ cpu->r[3] = cpu->r[23];
-        /* 020BC270 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BC274 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC270 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BC274 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC274 */ _t18 = _t17 & 0x00000001u;
         /* 020BC274 */ if (_t18) goto L_020BC278; else goto L_020BC2CC;
   L_020BC278: ; // 0x20bc278
         /* 020BC278 */ cpu->r[3] = 0x0000000Cu;
         /* 020BC27C */ Gambit_fn_02801A78(cpu);
-        /* 020BC280 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BC284 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC280 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BC284 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC284 */ _t20 = _t19 & 0x00000001u;
         /* 020BC284 */ if (_t20) goto L_020BC288; else goto L_020BC2CC;
   L_020BC288: ; // 0x20bc288
@@ -29927,9 +29927,9 @@ void Gambit_fn_020BC1E0(CPUState* cpu) {
         /* 020BC2B4 */ _t27 = cpu->r[8] + 0x00000000u;
         /* 020BC2B4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t27);
         /* 020BC2B8 */ cpu->r[30] = 0x00000000u;
-        /* 020BC2BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[29]);
+        /* 020BC2BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[29]));
         /* 020BC2C0 */ cpu->r[0] = 0x00080000u;
-        /* 020BC2C4 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC2C4 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC2C4 */ _t29 = _t28 & 0x00000001u;
         /* 020BC2C4 */ if (_t29) goto L_020BC2C8; else goto L_020BC324;
   L_020BC2C8: ; // 0x20bc2c8
@@ -29965,23 +29965,23 @@ void Gambit_fn_020BC1E0(CPUState* cpu) {
         /* 020BC310 */ _t40 = cpu->r[8] + 0x00000000u;
         /* 020BC310 */ cpu->r[0] = rbrew_read8(cpu->mem, _t40);
         /* 020BC314 */ cpu->r[30] = 0x00000000u;
-        /* 020BC318 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[29]);
+        /* 020BC318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[29]));
         /* 020BC31C */ cpu->r[0] = 0x00080000u;
-        /* 020BC320 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC320 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC320 */ _t42 = _t41 & 0x00000001u;
         /* 020BC320 */ if (_t42) goto L_020BC2C8; else goto L_020BC324;
   L_020BC324: ; // 0x20bc324
         /* 020BC324 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020BC328 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 020BC328 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 020BC32C */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 020BC330 */ _t43 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BC330 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BC330 */ _t44 = _t43 & 0x00000001u;
         /* 020BC330 */ if (_t44) goto L_020BC344; else goto L_020BC334;
   L_020BC334: ; // 0x20bc334
         /* 020BC334 */ _t45 = cpu->r[8] + 0x00000000u;
         /* 020BC334 */ cpu->r[9] = rbrew_read8(cpu->mem, _t45);
-        /* 020BC338 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[29]);
-        /* 020BC33C */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC338 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[29]));
+        /* 020BC33C */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC33C */ _t47 = _t46 & 0x00000001u;
         /* 020BC33C */ if (_t47) goto L_020BC340; else goto L_020BC324;
   L_020BC340: ; // 0x20bc340
@@ -29991,10 +29991,10 @@ void Gambit_fn_020BC1E0(CPUState* cpu) {
   L_020BC348: ; // 0x20bc348
         /* 020BC348 */ _t48 = cpu->r[23] + 0x00000008u;
         /* 020BC348 */ cpu->r[11] = rbrew_read32(cpu->mem, _t48);
-        /* 020BC34C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[11]);
+        /* 020BC34C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[11]));
         /* 020BC350 */ _t49 = cpu->r[1] + 0x0000000Cu;
         /* 020BC350 */ cpu->r[10] = rbrew_read32(cpu->mem, _t49);
-        /* 020BC354 */ _t50 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BC354 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BC354 */ _t51 = _t50 & 0x00000001u;
         /* 020BC354 */ if (_t51) goto L_020BC35C; else goto L_020BC358;
   L_020BC358: ; // 0x20bc358
@@ -30037,23 +30037,23 @@ void Gambit_fn_020BC1E0(CPUState* cpu) {
         /* 020BC3B4 */ rbrew_write8(cpu->mem, _t61, (uint8_t)cpu->r[26]);
         /* 020BC3B8 */ Gambit_fn_02C89380(cpu);
         /* 020BC3BC */ cpu->r[22] = cpu->r[31] + 0x00000488u;
-        /* 020BC3BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 020BC3C0 */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC3BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 020BC3C0 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC3C0 */ _t63 = _t62 & 0x00000001u;
         /* 020BC3C0 */ if (_t63) goto L_020BC3C4; else goto L_020BC3D4;
   L_020BC3C4: ; // 0x20bc3c4
         /* 020BC3C4 */ cpu->r[3] = 0x000000B4u;
         /* 020BC3C8 */ Gambit_fn_02801A78(cpu);
         /* 020BC3CC */ cpu->r[22] = cpu->r[3];
-        /* 020BC3CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 020BC3D0 */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC3CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 020BC3D0 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC3D0 */ _t65 = _t64 & 0x00000001u;
         /* 020BC3D0 */ if (_t65) goto L_020BC528; else goto L_020BC3D4;
   L_020BC3D4: ; // 0x20bc3d4
         /* 020BC3D4 */ _t66 = cpu->r[22] + 0x00000000u;
         /* 020BC3D4 */ rbrew_write8(cpu->mem, _t66, (uint8_t)cpu->r[26]);
         /* 020BC3D8 */ cpu->r[23] = cpu->r[22] + 0x00000010u;
-        /* 020BC3D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
+        /* 020BC3D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
         /* 020BC3DC */ _t67 = cpu->r[22] + 0x00000004u;
         /* 020BC3DC */ rbrew_write32(cpu->mem, _t67, cpu->r[26]);
         /* 020BC3E0 */ cpu->r[30] = 0x10010000u;
@@ -30064,39 +30064,39 @@ void Gambit_fn_020BC1E0(CPUState* cpu) {
         /* 020BC3F0 */ cpu->r[28] = cpu->r[28] + 0x0000543Cu;
         /* 020BC3F4 */ _t69 = cpu->r[22] + 0x0000000Cu;
         /* 020BC3F4 */ rbrew_write32(cpu->mem, _t69, cpu->r[26]);
-        /* 020BC3F8 */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC3F8 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC3F8 */ _t71 = _t70 & 0x00000001u;
         /* 020BC3F8 */ if (_t71) goto L_020BC3FC; else goto L_020BC41C;
   L_020BC3FC: ; // 0x20bc3fc
         /* 020BC3FC */ cpu->r[3] = 0x0000004Cu;
         /* 020BC400 */ Gambit_fn_02801A78(cpu);
         /* 020BC404 */ cpu->r[23] = cpu->r[3];
-        /* 020BC404 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
-        /* 020BC408 */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC404 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
+        /* 020BC408 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC408 */ _t73 = _t72 & 0x00000001u;
         /* 020BC408 */ if (_t73) goto L_020BC40C; else goto L_020BC41C;
   L_020BC40C: ; // 0x20bc40c
         /* 020BC40C */ cpu->r[24] = cpu->r[22] + 0x0000005Cu;
-        /* 020BC40C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 020BC40C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 020BC410 */ _t74 = cpu->r[25] + 0x00007399u;
         /* 020BC410 */ cpu->r[29] = rbrew_read8(cpu->mem, _t74);
-        /* 020BC414 */ _t75 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC414 */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC414 */ _t76 = _t75 & 0x00000001u;
         /* 020BC414 */ if (_t76) goto L_020BC4A0; else goto L_020BC418;
   L_020BC418: ; // 0x20bc418
         /* 020BC418 */ goto L_020BC4B0;
   L_020BC41C: ; // 0x20bc41c
         /* 020BC41C */ cpu->r[24] = cpu->r[23];
-        /* 020BC41C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 020BC420 */ _t77 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC41C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 020BC420 */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC420 */ _t78 = _t77 & 0x00000001u;
         /* 020BC420 */ if (_t78) goto L_020BC424; else goto L_020BC440;
   L_020BC424: ; // 0x20bc424
         /* 020BC424 */ cpu->r[3] = 0x0000004Cu;
         /* 020BC428 */ Gambit_fn_02801A78(cpu);
         /* 020BC42C */ cpu->r[24] = cpu->r[3];
-        /* 020BC42C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 020BC430 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC42C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 020BC430 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC430 */ _t80 = _t79 & 0x00000001u;
         /* 020BC430 */ if (_t80) goto L_020BC434; else goto L_020BC440;
   L_020BC434: ; // 0x20bc434
@@ -30107,15 +30107,15 @@ void Gambit_fn_020BC1E0(CPUState* cpu) {
         /* 020BC43C */ goto L_020BC498;
   L_020BC440: ; // 0x20bc440
         /* 020BC440 */ cpu->r[3] = cpu->r[24];
-        /* 020BC440 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BC444 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC440 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BC444 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC444 */ _t84 = _t83 & 0x00000001u;
         /* 020BC444 */ if (_t84) goto L_020BC448; else goto L_020BC46C;
   L_020BC448: ; // 0x20bc448
         /* 020BC448 */ cpu->r[3] = 0x0000000Cu;
         /* 020BC44C */ Gambit_fn_02801A78(cpu);
-        /* 020BC450 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BC454 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC450 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BC454 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC454 */ _t86 = _t85 & 0x00000001u;
         /* 020BC454 */ if (_t86) goto L_020BC458; else goto L_020BC46C;
   L_020BC458: ; // 0x20bc458
@@ -30152,43 +30152,43 @@ void Gambit_fn_020BC1E0(CPUState* cpu) {
         /* 020BC494 */ rbrew_write32(cpu->mem, _t99, cpu->r[28]);
   L_020BC498: ; // 0x20bc498
         /* 020BC498 */ cpu->r[24] = cpu->r[22] + 0x0000005Cu;
-        /* 020BC498 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 020BC49C */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC498 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 020BC49C */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC49C */ _t101 = _t100 & 0x00000001u;
         /* 020BC49C */ if (_t101) goto L_020BC4A0; else goto L_020BC4B0;
   L_020BC4A0: ; // 0x20bc4a0
         /* 020BC4A0 */ cpu->r[3] = 0x0000004Cu;
         /* 020BC4A4 */ Gambit_fn_02801A78(cpu);
         /* 020BC4A8 */ cpu->r[24] = cpu->r[3];
-        /* 020BC4A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 020BC4AC */ _t102 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC4A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 020BC4AC */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC4AC */ _t103 = _t102 & 0x00000001u;
         /* 020BC4AC */ if (_t103) goto L_020BC508; else goto L_020BC4B0;
   L_020BC4B0: ; // 0x20bc4b0
         /* 020BC4B0 */ cpu->r[25] = cpu->r[24];
-        /* 020BC4B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 020BC4B4 */ _t104 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC4B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 020BC4B4 */ _t104 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC4B4 */ _t105 = _t104 & 0x00000001u;
         /* 020BC4B4 */ if (_t105) goto L_020BC4B8; else goto L_020BC4C8;
   L_020BC4B8: ; // 0x20bc4b8
         /* 020BC4B8 */ cpu->r[3] = 0x0000004Cu;
         /* 020BC4BC */ Gambit_fn_02801A78(cpu);
         /* 020BC4C0 */ cpu->r[25] = cpu->r[3];
-        /* 020BC4C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 020BC4C4 */ _t106 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC4C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 020BC4C4 */ _t106 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC4C4 */ _t107 = _t106 & 0x00000001u;
         /* 020BC4C4 */ if (_t107) goto L_020BC504; else goto L_020BC4C8;
   L_020BC4C8: ; // 0x20bc4c8
         /* 020BC4C8 */ cpu->r[3] = cpu->r[25];
-        /* 020BC4C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BC4CC */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC4C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BC4CC */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC4CC */ _t109 = _t108 & 0x00000001u;
         /* 020BC4CC */ if (_t109) goto L_020BC4D0; else goto L_020BC4E0;
   L_020BC4D0: ; // 0x20bc4d0
         /* 020BC4D0 */ cpu->r[3] = 0x0000000Cu;
         /* 020BC4D4 */ Gambit_fn_02801A78(cpu);
-        /* 020BC4D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BC4DC */ _t110 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC4D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BC4DC */ _t110 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC4DC */ _t111 = _t110 & 0x00000001u;
         /* 020BC4DC */ if (_t111) goto L_020BC4F8; else goto L_020BC4E0;
   L_020BC4E0: ; // 0x20bc4e0
@@ -30269,23 +30269,23 @@ void Gambit_fn_020BC540(CPUState* cpu) {
         /* 020BC57C */ _t7 = cpu->r[12] + 0x00000000u;
         /* 020BC57C */ cpu->r[10] = rbrew_read8(cpu->mem, _t7);
         /* 020BC580 */ cpu->r[30] = 0x00000000u;
-        /* 020BC584 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[31]);
+        /* 020BC584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[31]));
         /* 020BC588 */ cpu->r[0] = 0x00080000u;
-        /* 020BC58C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC58C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC58C */ _t9 = _t8 & 0x00000001u;
         /* 020BC58C */ if (_t9) goto L_020BC5B4; else goto L_020BC590;
   L_020BC590: ; // 0x20bc590
         /* 020BC590 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020BC594 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 020BC594 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 020BC598 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 020BC59C */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BC59C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BC59C */ _t11 = _t10 & 0x00000001u;
         /* 020BC59C */ if (_t11) goto L_020BC5B0; else goto L_020BC5A0;
   L_020BC5A0: ; // 0x20bc5a0
         /* 020BC5A0 */ _t12 = cpu->r[12] + 0x00000000u;
         /* 020BC5A0 */ cpu->r[11] = rbrew_read8(cpu->mem, _t12);
-        /* 020BC5A4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[31]);
-        /* 020BC5A8 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC5A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[31]));
+        /* 020BC5A8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC5A8 */ _t14 = _t13 & 0x00000001u;
         /* 020BC5A8 */ if (_t14) goto L_020BC5AC; else goto L_020BC590;
   L_020BC5AC: ; // 0x20bc5ac
@@ -30297,10 +30297,10 @@ void Gambit_fn_020BC540(CPUState* cpu) {
         /* 020BC5B4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t15);
         /* 020BC5B8 */ _t16 = cpu->r[29] + 0x00000454u;
         /* 020BC5B8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t16);
-        /* 020BC5BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[5]);
+        /* 020BC5BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[5]));
         /* 020BC5C0 */ _t17 = cpu->r[12] + 0x00000014u;
         /* 020BC5C0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t17);
-        /* 020BC5C4 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BC5C4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BC5C4 */ _t19 = _t18 & 0x00000001u;
         /* 020BC5C4 */ if (_t19) goto L_020BC5CC; else goto L_020BC5C8;
   L_020BC5C8: ; // 0x20bc5c8
@@ -30371,23 +30371,23 @@ void Gambit_fn_020BC540(CPUState* cpu) {
         /* 020BC65C */ _t46 = cpu->r[10] + 0x00000000u;
         /* 020BC65C */ cpu->r[0] = rbrew_read8(cpu->mem, _t46);
         /* 020BC660 */ cpu->r[30] = 0x00000000u;
-        /* 020BC664 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 020BC664 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 020BC668 */ cpu->r[11] = 0x00080000u;
-        /* 020BC66C */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC66C */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC66C */ _t48 = _t47 & 0x00000001u;
         /* 020BC66C */ if (_t48) goto L_020BC694; else goto L_020BC670;
   L_020BC670: ; // 0x20bc670
         /* 020BC670 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020BC674 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[11]);
+        /* 020BC674 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[11]));
         /* 020BC678 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 020BC67C */ _t49 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BC67C */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BC67C */ _t50 = _t49 & 0x00000001u;
         /* 020BC67C */ if (_t50) goto L_020BC690; else goto L_020BC680;
   L_020BC680: ; // 0x20bc680
         /* 020BC680 */ _t51 = cpu->r[10] + 0x00000000u;
         /* 020BC680 */ cpu->r[0] = rbrew_read8(cpu->mem, _t51);
-        /* 020BC684 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020BC688 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC684 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020BC688 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC688 */ _t53 = _t52 & 0x00000001u;
         /* 020BC688 */ if (_t53) goto L_020BC68C; else goto L_020BC670;
   L_020BC68C: ; // 0x20bc68c
@@ -30397,8 +30397,8 @@ void Gambit_fn_020BC540(CPUState* cpu) {
   L_020BC694: ; // 0x20bc694
         /* 020BC694 */ _t54 = cpu->r[28] + 0x000004A0u;
         /* 020BC694 */ cpu->r[6] = rbrew_read32(cpu->mem, _t54);
-        /* 020BC698 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[6]);
-        /* 020BC69C */ _t55 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BC698 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[6]));
+        /* 020BC69C */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BC69C */ _t56 = _t55 & 0x00000001u;
         /* 020BC69C */ if (_t56) goto L_020BC6A4; else goto L_020BC6A0;
   L_020BC6A0: ; // 0x20bc6a0
@@ -30433,23 +30433,23 @@ void Gambit_fn_020BC540(CPUState* cpu) {
         /* 020BC6EC */ _t65 = cpu->r[8] + 0x00000000u;
         /* 020BC6EC */ cpu->r[10] = rbrew_read8(cpu->mem, _t65);
         /* 020BC6F0 */ cpu->r[30] = 0x00000000u;
-        /* 020BC6F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[31]);
+        /* 020BC6F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[31]));
         /* 020BC6F8 */ cpu->r[9] = 0x00080000u;
-        /* 020BC6FC */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC6FC */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC6FC */ _t67 = _t66 & 0x00000001u;
         /* 020BC6FC */ if (_t67) goto L_020BC724; else goto L_020BC700;
   L_020BC700: ; // 0x20bc700
         /* 020BC700 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020BC704 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[9]);
+        /* 020BC704 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[9]));
         /* 020BC708 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 020BC70C */ _t68 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BC70C */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BC70C */ _t69 = _t68 & 0x00000001u;
         /* 020BC70C */ if (_t69) goto L_020BC720; else goto L_020BC710;
   L_020BC710: ; // 0x20bc710
         /* 020BC710 */ _t70 = cpu->r[8] + 0x00000000u;
         /* 020BC710 */ cpu->r[11] = rbrew_read8(cpu->mem, _t70);
-        /* 020BC714 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[31]);
-        /* 020BC718 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC714 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[31]));
+        /* 020BC718 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC718 */ _t72 = _t71 & 0x00000001u;
         /* 020BC718 */ if (_t72) goto L_020BC71C; else goto L_020BC700;
   L_020BC71C: ; // 0x20bc71c
@@ -30461,10 +30461,10 @@ void Gambit_fn_020BC540(CPUState* cpu) {
         /* 020BC724 */ cpu->r[7] = rbrew_read32(cpu->mem, _t73);
         /* 020BC728 */ _t74 = cpu->r[29] + 0x000004E8u;
         /* 020BC728 */ cpu->r[12] = rbrew_read32(cpu->mem, _t74);
-        /* 020BC72C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 020BC72C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 020BC730 */ _t75 = cpu->r[12] + 0x00000014u;
         /* 020BC730 */ cpu->r[0] = rbrew_read32(cpu->mem, _t75);
-        /* 020BC734 */ _t76 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BC734 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BC734 */ _t77 = _t76 & 0x00000001u;
         /* 020BC734 */ if (_t77) goto L_020BC73C; else goto L_020BC738;
   L_020BC738: ; // 0x20bc738
@@ -30511,16 +30511,16 @@ void Gambit_fn_020BC798(CPUState* cpu) {
   L_020BC798: ; // 0x20bc798
         /* 020BC798 */ _t0 = cpu->r[3] + 0x0000047Cu;
         /* 020BC798 */ cpu->r[0] = rbrew_read8(cpu->mem, _t0);
-        /* 020BC79C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020BC79C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020BC7A0 */ cpu->r[0] = 0x00000000u;
-        /* 020BC7A4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC7A4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC7A4 */ _t2 = _t1 & 0x00000001u;
         /* 020BC7A4 */ if (_t2) goto L_020BC7BC; else goto L_020BC7A8;
   L_020BC7A8: ; // 0x20bc7a8
         /* 020BC7A8 */ _t3 = cpu->r[3] + 0x00000000u;
         /* 020BC7A8 */ cpu->r[9] = rbrew_read8(cpu->mem, _t3);
-        /* 020BC7AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 020BC7B0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC7AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 020BC7B0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC7B0 */ _t5 = _t4 & 0x00000001u;
         /* 020BC7B0 */ if (_t5) goto L_020BC7BC; else goto L_020BC7B4;
   L_020BC7B4: ; // 0x20bc7b4
@@ -30529,29 +30529,29 @@ void Gambit_fn_020BC798(CPUState* cpu) {
         /* 020BC7B8 */ _t7 = cpu->r[11] + 0x00000002u;
         /* 020BC7B8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
   L_020BC7BC: ; // 0x20bc7bc
-        /* 020BC7BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020BC7BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020BC7C0 */ cpu->r[10] = 0x00000001u;
-        /* 020BC7C4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC7C4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC7C4 */ _t9 = _t8 & 0x00000001u;
         /* 020BC7C4 */ if (_t9) goto L_020BC7D4; else goto L_020BC7C8;
   L_020BC7C8: ; // 0x20bc7c8
-        /* 020BC7C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 020BC7CC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC7C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 020BC7CC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC7CC */ _t11 = _t10 & 0x00000001u;
         /* 020BC7CC */ if (_t11) goto L_020BC7D4; else goto L_020BC7D0;
   L_020BC7D0: ; // 0x20bc7d0
         /* 020BC7D0 */ cpu->r[10] = 0x00000000u;
   L_020BC7D4: ; // 0x20bc7d4
-        /* 020BC7D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020BC7D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020BC7D8 */ cpu->r[12] = 0x00000001u;
         /* 020BC7DC */ _t12 = cpu->r[3] + 0x0000047Fu;
         /* 020BC7DC */ rbrew_write8(cpu->mem, _t12, (uint8_t)cpu->r[10]);
-        /* 020BC7E0 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC7E0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC7E0 */ _t14 = _t13 & 0x00000001u;
         /* 020BC7E0 */ if (_t14) goto L_020BC7F0; else goto L_020BC7E4;
   L_020BC7E4: ; // 0x20bc7e4
-        /* 020BC7E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 020BC7E8 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC7E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 020BC7E8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC7E8 */ _t16 = _t15 & 0x00000001u;
         /* 020BC7E8 */ if (_t16) goto L_020BC7F0; else goto L_020BC7EC;
   L_020BC7EC: ; // 0x20bc7ec
@@ -30593,23 +30593,23 @@ void Gambit_fn_020BC7F8(CPUState* cpu) {
         /* 020BC834 */ _t7 = cpu->r[7] + 0x00000000u;
         /* 020BC834 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 020BC838 */ cpu->r[31] = 0x00000000u;
-        /* 020BC83C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
+        /* 020BC83C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
         /* 020BC840 */ cpu->r[0] = 0x00080000u;
-        /* 020BC844 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC844 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC844 */ _t9 = _t8 & 0x00000001u;
         /* 020BC844 */ if (_t9) goto L_020BC86C; else goto L_020BC848;
   L_020BC848: ; // 0x20bc848
         /* 020BC848 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020BC84C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 020BC84C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 020BC850 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 020BC854 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BC854 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BC854 */ _t11 = _t10 & 0x00000001u;
         /* 020BC854 */ if (_t11) goto L_020BC868; else goto L_020BC858;
   L_020BC858: ; // 0x20bc858
         /* 020BC858 */ _t12 = cpu->r[7] + 0x00000000u;
         /* 020BC858 */ cpu->r[6] = rbrew_read8(cpu->mem, _t12);
-        /* 020BC85C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[30]);
-        /* 020BC860 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC85C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[30]));
+        /* 020BC860 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC860 */ _t14 = _t13 & 0x00000001u;
         /* 020BC860 */ if (_t14) goto L_020BC864; else goto L_020BC848;
   L_020BC864: ; // 0x20bc864
@@ -30621,10 +30621,10 @@ void Gambit_fn_020BC7F8(CPUState* cpu) {
         /* 020BC86C */ cpu->r[10] = rbrew_read32(cpu->mem, _t15);
         /* 020BC870 */ _t16 = cpu->r[29] + 0x00000004u;
         /* 020BC870 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
-        /* 020BC874 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 020BC874 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 020BC878 */ _t17 = cpu->r[7] + 0x00000014u;
         /* 020BC878 */ cpu->r[8] = rbrew_read32(cpu->mem, _t17);
-        /* 020BC87C */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BC87C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BC87C */ _t19 = _t18 & 0x00000001u;
         /* 020BC87C */ if (_t19) goto L_020BC884; else goto L_020BC880;
   L_020BC880: ; // 0x20bc880
@@ -30672,7 +30672,7 @@ void Gambit_fn_020BC7F8(CPUState* cpu) {
         /* 020BC8F4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t30);
         /* 020BC8F8 */ cpu->r[3] = cpu->r[1] + 0x00000010u;
         /* 020BC8FC */ cpu->r[4] = cpu->r[4] + 0x000054E8u;
-        /* 020BC900 */ _t31 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BC900 */ _t31 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BC900 */ _t32 = _t31 & 0x00000001u;
         /* 020BC900 */ if (_t32) goto L_020BC904; // else: addr-0 trap, fall-through
   L_020BC904: ; // 0x20bc904
@@ -30690,8 +30690,8 @@ void Gambit_fn_020BC7F8(CPUState* cpu) {
         /* 020BC924 */ Gambit_fn_020A54C4(cpu);
         /* 020BC928 */ _t36 = cpu->r[28] + 0x00000000u;
         /* 020BC928 */ cpu->r[8] = rbrew_read8(cpu->mem, _t36);
-        /* 020BC92C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 020BC930 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC92C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 020BC930 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC930 */ _t38 = _t37 & 0x00000001u;
         /* 020BC930 */ if (_t38) goto L_020BC93C; else goto L_020BC934;
   L_020BC934: ; // 0x20bc934
@@ -30737,23 +30737,23 @@ void Gambit_fn_020BC950(CPUState* cpu) {
         /* 020BC98C */ _t7 = cpu->r[7] + 0x00000000u;
         /* 020BC98C */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 020BC990 */ cpu->r[31] = 0x00000000u;
-        /* 020BC994 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
+        /* 020BC994 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
         /* 020BC998 */ cpu->r[0] = 0x00080000u;
-        /* 020BC99C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC99C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC99C */ _t9 = _t8 & 0x00000001u;
         /* 020BC99C */ if (_t9) goto L_020BC9C4; else goto L_020BC9A0;
   L_020BC9A0: ; // 0x20bc9a0
         /* 020BC9A0 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020BC9A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 020BC9A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 020BC9A8 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 020BC9AC */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BC9AC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BC9AC */ _t11 = _t10 & 0x00000001u;
         /* 020BC9AC */ if (_t11) goto L_020BC9C0; else goto L_020BC9B0;
   L_020BC9B0: ; // 0x20bc9b0
         /* 020BC9B0 */ _t12 = cpu->r[7] + 0x00000000u;
         /* 020BC9B0 */ cpu->r[6] = rbrew_read8(cpu->mem, _t12);
-        /* 020BC9B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[30]);
-        /* 020BC9B8 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BC9B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[30]));
+        /* 020BC9B8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BC9B8 */ _t14 = _t13 & 0x00000001u;
         /* 020BC9B8 */ if (_t14) goto L_020BC9BC; else goto L_020BC9A0;
   L_020BC9BC: ; // 0x20bc9bc
@@ -30765,10 +30765,10 @@ void Gambit_fn_020BC950(CPUState* cpu) {
         /* 020BC9C4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t15);
         /* 020BC9C8 */ _t16 = cpu->r[29] + 0x00000004u;
         /* 020BC9C8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
-        /* 020BC9CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 020BC9CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 020BC9D0 */ _t17 = cpu->r[7] + 0x00000014u;
         /* 020BC9D0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t17);
-        /* 020BC9D4 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BC9D4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BC9D4 */ _t19 = _t18 & 0x00000001u;
         /* 020BC9D4 */ if (_t19) goto L_020BC9DC; else goto L_020BC9D8;
   L_020BC9D8: ; // 0x20bc9d8
@@ -30816,7 +30816,7 @@ void Gambit_fn_020BC950(CPUState* cpu) {
         /* 020BCA4C */ cpu->r[5] = rbrew_read32(cpu->mem, _t30);
         /* 020BCA50 */ cpu->r[3] = cpu->r[1] + 0x00000010u;
         /* 020BCA54 */ cpu->r[4] = cpu->r[4] + 0x000054F0u;
-        /* 020BCA58 */ _t31 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BCA58 */ _t31 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BCA58 */ _t32 = _t31 & 0x00000001u;
         /* 020BCA58 */ if (_t32) goto L_020BCA5C; // else: addr-0 trap, fall-through
   L_020BCA5C: ; // 0x20bca5c
@@ -30834,8 +30834,8 @@ void Gambit_fn_020BC950(CPUState* cpu) {
         /* 020BCA7C */ Gambit_fn_020A54C4(cpu);
         /* 020BCA80 */ _t36 = cpu->r[28] + 0x00000000u;
         /* 020BCA80 */ cpu->r[8] = rbrew_read8(cpu->mem, _t36);
-        /* 020BCA84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 020BCA88 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BCA84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 020BCA88 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BCA88 */ _t38 = _t37 & 0x00000001u;
         /* 020BCA88 */ if (_t38) goto L_020BCA94; else goto L_020BCA8C;
   L_020BCA8C: ; // 0x20bca8c
@@ -30881,23 +30881,23 @@ void Gambit_fn_020BCAA8(CPUState* cpu) {
         /* 020BCAE4 */ _t7 = cpu->r[7] + 0x00000000u;
         /* 020BCAE4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 020BCAE8 */ cpu->r[31] = 0x00000000u;
-        /* 020BCAEC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
+        /* 020BCAEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
         /* 020BCAF0 */ cpu->r[0] = 0x00080000u;
-        /* 020BCAF4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BCAF4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BCAF4 */ _t9 = _t8 & 0x00000001u;
         /* 020BCAF4 */ if (_t9) goto L_020BCB1C; else goto L_020BCAF8;
   L_020BCAF8: ; // 0x20bcaf8
         /* 020BCAF8 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020BCAFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 020BCAFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 020BCB00 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 020BCB04 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BCB04 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BCB04 */ _t11 = _t10 & 0x00000001u;
         /* 020BCB04 */ if (_t11) goto L_020BCB18; else goto L_020BCB08;
   L_020BCB08: ; // 0x20bcb08
         /* 020BCB08 */ _t12 = cpu->r[7] + 0x00000000u;
         /* 020BCB08 */ cpu->r[6] = rbrew_read8(cpu->mem, _t12);
-        /* 020BCB0C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[30]);
-        /* 020BCB10 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BCB0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[30]));
+        /* 020BCB10 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BCB10 */ _t14 = _t13 & 0x00000001u;
         /* 020BCB10 */ if (_t14) goto L_020BCB14; else goto L_020BCAF8;
   L_020BCB14: ; // 0x20bcb14
@@ -30909,10 +30909,10 @@ void Gambit_fn_020BCAA8(CPUState* cpu) {
         /* 020BCB1C */ cpu->r[10] = rbrew_read32(cpu->mem, _t15);
         /* 020BCB20 */ _t16 = cpu->r[29] + 0x00000004u;
         /* 020BCB20 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
-        /* 020BCB24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 020BCB24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 020BCB28 */ _t17 = cpu->r[7] + 0x00000014u;
         /* 020BCB28 */ cpu->r[8] = rbrew_read32(cpu->mem, _t17);
-        /* 020BCB2C */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BCB2C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BCB2C */ _t19 = _t18 & 0x00000001u;
         /* 020BCB2C */ if (_t19) goto L_020BCB34; else goto L_020BCB30;
   L_020BCB30: ; // 0x20bcb30
@@ -30960,7 +30960,7 @@ void Gambit_fn_020BCAA8(CPUState* cpu) {
         /* 020BCBA4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t30);
         /* 020BCBA8 */ cpu->r[3] = cpu->r[1] + 0x00000010u;
         /* 020BCBAC */ cpu->r[4] = cpu->r[4] + 0x000054F4u;
-        /* 020BCBB0 */ _t31 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BCBB0 */ _t31 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BCBB0 */ _t32 = _t31 & 0x00000001u;
         /* 020BCBB0 */ if (_t32) goto L_020BCBB4; // else: addr-0 trap, fall-through
   L_020BCBB4: ; // 0x20bcbb4
@@ -30978,8 +30978,8 @@ void Gambit_fn_020BCAA8(CPUState* cpu) {
         /* 020BCBD4 */ Gambit_fn_020A54C4(cpu);
         /* 020BCBD8 */ _t36 = cpu->r[28] + 0x00000000u;
         /* 020BCBD8 */ cpu->r[8] = rbrew_read8(cpu->mem, _t36);
-        /* 020BCBDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 020BCBE0 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BCBDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 020BCBE0 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BCBE0 */ _t38 = _t37 & 0x00000001u;
         /* 020BCBE0 */ if (_t38) goto L_020BCBEC; else goto L_020BCBE4;
   L_020BCBE4: ; // 0x20bcbe4
@@ -31025,23 +31025,23 @@ void Gambit_fn_020BCC00(CPUState* cpu) {
         /* 020BCC3C */ _t7 = cpu->r[7] + 0x00000000u;
         /* 020BCC3C */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 020BCC40 */ cpu->r[31] = 0x00000000u;
-        /* 020BCC44 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
+        /* 020BCC44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
         /* 020BCC48 */ cpu->r[0] = 0x00080000u;
-        /* 020BCC4C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BCC4C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BCC4C */ _t9 = _t8 & 0x00000001u;
         /* 020BCC4C */ if (_t9) goto L_020BCC74; else goto L_020BCC50;
   L_020BCC50: ; // 0x20bcc50
         /* 020BCC50 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020BCC54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 020BCC54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 020BCC58 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 020BCC5C */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BCC5C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BCC5C */ _t11 = _t10 & 0x00000001u;
         /* 020BCC5C */ if (_t11) goto L_020BCC70; else goto L_020BCC60;
   L_020BCC60: ; // 0x20bcc60
         /* 020BCC60 */ _t12 = cpu->r[7] + 0x00000000u;
         /* 020BCC60 */ cpu->r[6] = rbrew_read8(cpu->mem, _t12);
-        /* 020BCC64 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[30]);
-        /* 020BCC68 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BCC64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[30]));
+        /* 020BCC68 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BCC68 */ _t14 = _t13 & 0x00000001u;
         /* 020BCC68 */ if (_t14) goto L_020BCC6C; else goto L_020BCC50;
   L_020BCC6C: ; // 0x20bcc6c
@@ -31053,10 +31053,10 @@ void Gambit_fn_020BCC00(CPUState* cpu) {
         /* 020BCC74 */ cpu->r[10] = rbrew_read32(cpu->mem, _t15);
         /* 020BCC78 */ _t16 = cpu->r[29] + 0x00000004u;
         /* 020BCC78 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
-        /* 020BCC7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 020BCC7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 020BCC80 */ _t17 = cpu->r[7] + 0x00000014u;
         /* 020BCC80 */ cpu->r[8] = rbrew_read32(cpu->mem, _t17);
-        /* 020BCC84 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BCC84 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BCC84 */ _t19 = _t18 & 0x00000001u;
         /* 020BCC84 */ if (_t19) goto L_020BCC8C; else goto L_020BCC88;
   L_020BCC88: ; // 0x20bcc88
@@ -31104,7 +31104,7 @@ void Gambit_fn_020BCC00(CPUState* cpu) {
         /* 020BCCFC */ cpu->r[5] = rbrew_read32(cpu->mem, _t30);
         /* 020BCD00 */ cpu->r[3] = cpu->r[1] + 0x00000010u;
         /* 020BCD04 */ cpu->r[4] = cpu->r[4] + 0x00005504u;
-        /* 020BCD08 */ _t31 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BCD08 */ _t31 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BCD08 */ _t32 = _t31 & 0x00000001u;
         /* 020BCD08 */ if (_t32) goto L_020BCD0C; // else: addr-0 trap, fall-through
   L_020BCD0C: ; // 0x20bcd0c
@@ -31122,8 +31122,8 @@ void Gambit_fn_020BCC00(CPUState* cpu) {
         /* 020BCD2C */ Gambit_fn_020A54C4(cpu);
         /* 020BCD30 */ _t36 = cpu->r[28] + 0x00000000u;
         /* 020BCD30 */ cpu->r[8] = rbrew_read8(cpu->mem, _t36);
-        /* 020BCD34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 020BCD38 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BCD34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 020BCD38 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BCD38 */ _t38 = _t37 & 0x00000001u;
         /* 020BCD38 */ if (_t38) goto L_020BCD44; else goto L_020BCD3C;
   L_020BCD3C: ; // 0x20bcd3c
@@ -31169,23 +31169,23 @@ void Gambit_fn_020BCD58(CPUState* cpu) {
         /* 020BCD94 */ _t7 = cpu->r[7] + 0x00000000u;
         /* 020BCD94 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 020BCD98 */ cpu->r[31] = 0x00000000u;
-        /* 020BCD9C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
+        /* 020BCD9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
         /* 020BCDA0 */ cpu->r[0] = 0x00080000u;
-        /* 020BCDA4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BCDA4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BCDA4 */ _t9 = _t8 & 0x00000001u;
         /* 020BCDA4 */ if (_t9) goto L_020BCDCC; else goto L_020BCDA8;
   L_020BCDA8: ; // 0x20bcda8
         /* 020BCDA8 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020BCDAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 020BCDAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 020BCDB0 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 020BCDB4 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BCDB4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BCDB4 */ _t11 = _t10 & 0x00000001u;
         /* 020BCDB4 */ if (_t11) goto L_020BCDC8; else goto L_020BCDB8;
   L_020BCDB8: ; // 0x20bcdb8
         /* 020BCDB8 */ _t12 = cpu->r[7] + 0x00000000u;
         /* 020BCDB8 */ cpu->r[6] = rbrew_read8(cpu->mem, _t12);
-        /* 020BCDBC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[30]);
-        /* 020BCDC0 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BCDBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[30]));
+        /* 020BCDC0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BCDC0 */ _t14 = _t13 & 0x00000001u;
         /* 020BCDC0 */ if (_t14) goto L_020BCDC4; else goto L_020BCDA8;
   L_020BCDC4: ; // 0x20bcdc4
@@ -31197,10 +31197,10 @@ void Gambit_fn_020BCD58(CPUState* cpu) {
         /* 020BCDCC */ cpu->r[10] = rbrew_read32(cpu->mem, _t15);
         /* 020BCDD0 */ _t16 = cpu->r[29] + 0x00000004u;
         /* 020BCDD0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
-        /* 020BCDD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 020BCDD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 020BCDD8 */ _t17 = cpu->r[7] + 0x00000014u;
         /* 020BCDD8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t17);
-        /* 020BCDDC */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BCDDC */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BCDDC */ _t19 = _t18 & 0x00000001u;
         /* 020BCDDC */ if (_t19) goto L_020BCDE4; else goto L_020BCDE0;
   L_020BCDE0: ; // 0x20bcde0
@@ -31248,7 +31248,7 @@ void Gambit_fn_020BCD58(CPUState* cpu) {
         /* 020BCE54 */ cpu->r[5] = rbrew_read32(cpu->mem, _t30);
         /* 020BCE58 */ cpu->r[3] = cpu->r[1] + 0x00000010u;
         /* 020BCE5C */ cpu->r[4] = cpu->r[4] + 0x0000550Cu;
-        /* 020BCE60 */ _t31 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BCE60 */ _t31 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BCE60 */ _t32 = _t31 & 0x00000001u;
         /* 020BCE60 */ if (_t32) goto L_020BCE64; // else: addr-0 trap, fall-through
   L_020BCE64: ; // 0x20bce64
@@ -31266,8 +31266,8 @@ void Gambit_fn_020BCD58(CPUState* cpu) {
         /* 020BCE84 */ Gambit_fn_020A54C4(cpu);
         /* 020BCE88 */ _t36 = cpu->r[28] + 0x00000000u;
         /* 020BCE88 */ cpu->r[8] = rbrew_read8(cpu->mem, _t36);
-        /* 020BCE8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 020BCE90 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BCE8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 020BCE90 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BCE90 */ _t38 = _t37 & 0x00000001u;
         /* 020BCE90 */ if (_t38) goto L_020BCE9C; else goto L_020BCE94;
   L_020BCE94: ; // 0x20bce94
@@ -31313,23 +31313,23 @@ void Gambit_fn_020BCEB0(CPUState* cpu) {
         /* 020BCEEC */ _t7 = cpu->r[7] + 0x00000000u;
         /* 020BCEEC */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 020BCEF0 */ cpu->r[31] = 0x00000000u;
-        /* 020BCEF4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
+        /* 020BCEF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
         /* 020BCEF8 */ cpu->r[0] = 0x00080000u;
-        /* 020BCEFC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BCEFC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BCEFC */ _t9 = _t8 & 0x00000001u;
         /* 020BCEFC */ if (_t9) goto L_020BCF24; else goto L_020BCF00;
   L_020BCF00: ; // 0x20bcf00
         /* 020BCF00 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020BCF04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 020BCF04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 020BCF08 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 020BCF0C */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020BCF0C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020BCF0C */ _t11 = _t10 & 0x00000001u;
         /* 020BCF0C */ if (_t11) goto L_020BCF20; else goto L_020BCF10;
   L_020BCF10: ; // 0x20bcf10
         /* 020BCF10 */ _t12 = cpu->r[7] + 0x00000000u;
         /* 020BCF10 */ cpu->r[6] = rbrew_read8(cpu->mem, _t12);
-        /* 020BCF14 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[30]);
-        /* 020BCF18 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BCF14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[30]));
+        /* 020BCF18 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BCF18 */ _t14 = _t13 & 0x00000001u;
         /* 020BCF18 */ if (_t14) goto L_020BCF1C; else goto L_020BCF00;
   L_020BCF1C: ; // 0x20bcf1c
@@ -31341,10 +31341,10 @@ void Gambit_fn_020BCEB0(CPUState* cpu) {
         /* 020BCF24 */ cpu->r[10] = rbrew_read32(cpu->mem, _t15);
         /* 020BCF28 */ _t16 = cpu->r[29] + 0x00000004u;
         /* 020BCF28 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
-        /* 020BCF2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 020BCF2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 020BCF30 */ _t17 = cpu->r[7] + 0x00000014u;
         /* 020BCF30 */ cpu->r[8] = rbrew_read32(cpu->mem, _t17);
-        /* 020BCF34 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020BCF34 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020BCF34 */ _t19 = _t18 & 0x00000001u;
         /* 020BCF34 */ if (_t19) goto L_020BCF3C; else goto L_020BCF38;
   L_020BCF38: ; // 0x20bcf38
@@ -31392,7 +31392,7 @@ void Gambit_fn_020BCEB0(CPUState* cpu) {
         /* 020BCFAC */ cpu->r[5] = rbrew_read32(cpu->mem, _t30);
         /* 020BCFB0 */ cpu->r[3] = cpu->r[1] + 0x00000010u;
         /* 020BCFB4 */ cpu->r[4] = cpu->r[4] + 0x00005514u;
-        /* 020BCFB8 */ _t31 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020BCFB8 */ _t31 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020BCFB8 */ _t32 = _t31 & 0x00000001u;
         /* 020BCFB8 */ if (_t32) goto L_020BCFBC; // else: addr-0 trap, fall-through
   L_020BCFBC: ; // 0x20bcfbc
@@ -31410,8 +31410,8 @@ void Gambit_fn_020BCEB0(CPUState* cpu) {
         /* 020BCFDC */ Gambit_fn_020A54C4(cpu);
         /* 020BCFE0 */ _t36 = cpu->r[28] + 0x00000000u;
         /* 020BCFE0 */ cpu->r[8] = rbrew_read8(cpu->mem, _t36);
-        /* 020BCFE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 020BCFE8 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BCFE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 020BCFE8 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BCFE8 */ _t38 = _t37 & 0x00000001u;
         /* 020BCFE8 */ if (_t38) goto L_020BCFF4; else goto L_020BCFEC;
   L_020BCFEC: ; // 0x20bcfec
@@ -31433,15 +31433,15 @@ void Gambit_fn_020BD008(CPUState* cpu) {
   L_020BD008: ; // 0x20bd008
         /* 020BD008 */ _t0 = cpu->r[3] + 0x0000047Cu;
         /* 020BD008 */ cpu->r[0] = rbrew_read8(cpu->mem, _t0);
-        /* 020BD00C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BD010 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BD00C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BD010 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BD010 */ _t2 = _t1 & 0x00000001u;
         /* 020BD010 */ if (_t2) goto L_020BD02C; else goto L_020BD014;
   L_020BD014: ; // 0x20bd014
         /* 020BD014 */ _t3 = cpu->r[3] + 0x00000000u;
         /* 020BD014 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 020BD018 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BD01C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BD018 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BD01C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BD01C */ _t5 = _t4 & 0x00000001u;
         /* 020BD01C */ if (_t5) goto L_020BD02C; else goto L_020BD020;
   L_020BD020: ; // 0x20bd020
@@ -31460,15 +31460,15 @@ void Gambit_fn_020BD034(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020BD034: ; // 0x20bd034
-        /* 020BD034 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BD038 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BD034 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BD038 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BD038 */ _t1 = _t0 & 0x00000001u;
         /* 020BD038 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BD038 */ goto L_020BD03C;
   L_020BD03C: ; // 0x20bd03c
         /* 020BD03C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020BD03C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BD040 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BD03C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BD040 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BD040 */ _t3 = _t2 & 0x00000001u;
         /* 020BD040 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BD040 */ goto L_020BD044;
@@ -31487,8 +31487,8 @@ void Gambit_fn_020BD034(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -31502,15 +31502,15 @@ void Gambit_fn_020BD034(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -31544,15 +31544,15 @@ void Gambit_fn_020BD04C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020BD04C: ; // 0x20bd04c
-        /* 020BD04C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BD050 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BD04C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BD050 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BD050 */ _t1 = _t0 & 0x00000001u;
         /* 020BD050 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BD050 */ goto L_020BD054;
   L_020BD054: ; // 0x20bd054
         /* 020BD054 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020BD054 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BD058 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BD054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BD058 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BD058 */ _t3 = _t2 & 0x00000001u;
         /* 020BD058 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BD058 */ goto L_020BD05C;
@@ -31571,8 +31571,8 @@ void Gambit_fn_020BD04C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -31586,15 +31586,15 @@ void Gambit_fn_020BD04C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -31640,15 +31640,15 @@ void Gambit_fn_020BD07C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020BD07C: ; // 0x20bd07c
-        /* 020BD07C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BD080 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BD07C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BD080 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BD080 */ _t1 = _t0 & 0x00000001u;
         /* 020BD080 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BD080 */ goto L_020BD084;
   L_020BD084: ; // 0x20bd084
         /* 020BD084 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020BD084 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BD088 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BD084 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BD088 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BD088 */ _t3 = _t2 & 0x00000001u;
         /* 020BD088 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BD088 */ goto L_020BD08C;
@@ -31667,8 +31667,8 @@ void Gambit_fn_020BD07C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -31682,15 +31682,15 @@ void Gambit_fn_020BD07C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -31718,15 +31718,15 @@ void Gambit_fn_020BD090(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020BD090: ; // 0x20bd090
-        /* 020BD090 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BD094 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BD090 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BD094 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BD094 */ _t1 = _t0 & 0x00000001u;
         /* 020BD094 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BD094 */ goto L_020BD098;
   L_020BD098: ; // 0x20bd098
         /* 020BD098 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020BD098 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BD09C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BD098 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BD09C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BD09C */ _t3 = _t2 & 0x00000001u;
         /* 020BD09C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BD09C */ goto L_020BD0A0;
@@ -31745,8 +31745,8 @@ void Gambit_fn_020BD090(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -31760,15 +31760,15 @@ void Gambit_fn_020BD090(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -31796,15 +31796,15 @@ void Gambit_fn_020BD0A4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020BD0A4: ; // 0x20bd0a4
-        /* 020BD0A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BD0A8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BD0A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BD0A8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BD0A8 */ _t1 = _t0 & 0x00000001u;
         /* 020BD0A8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BD0A8 */ goto L_020BD0AC;
   L_020BD0AC: ; // 0x20bd0ac
         /* 020BD0AC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020BD0AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BD0B0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BD0AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BD0B0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BD0B0 */ _t3 = _t2 & 0x00000001u;
         /* 020BD0B0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BD0B0 */ goto L_020BD0B4;
@@ -31823,8 +31823,8 @@ void Gambit_fn_020BD0A4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -31838,15 +31838,15 @@ void Gambit_fn_020BD0A4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -31874,15 +31874,15 @@ void Gambit_fn_020BD0B8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020BD0B8: ; // 0x20bd0b8
-        /* 020BD0B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BD0BC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BD0B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BD0BC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BD0BC */ _t1 = _t0 & 0x00000001u;
         /* 020BD0BC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BD0BC */ goto L_020BD0C0;
   L_020BD0C0: ; // 0x20bd0c0
         /* 020BD0C0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020BD0C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BD0C4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BD0C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BD0C4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BD0C4 */ _t3 = _t2 & 0x00000001u;
         /* 020BD0C4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BD0C4 */ goto L_020BD0C8;
@@ -31901,8 +31901,8 @@ void Gambit_fn_020BD0B8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -31916,15 +31916,15 @@ void Gambit_fn_020BD0B8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -31952,15 +31952,15 @@ void Gambit_fn_020BD0CC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020BD0CC: ; // 0x20bd0cc
-        /* 020BD0CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BD0D0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BD0CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BD0D0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BD0D0 */ _t1 = _t0 & 0x00000001u;
         /* 020BD0D0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BD0D0 */ goto L_020BD0D4;
   L_020BD0D4: ; // 0x20bd0d4
         /* 020BD0D4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020BD0D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BD0D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BD0D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BD0D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BD0D8 */ _t3 = _t2 & 0x00000001u;
         /* 020BD0D8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BD0D8 */ goto L_020BD0DC;
@@ -31979,8 +31979,8 @@ void Gambit_fn_020BD0CC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -31994,15 +31994,15 @@ void Gambit_fn_020BD0CC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -32030,15 +32030,15 @@ void Gambit_fn_020BD0E0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020BD0E0: ; // 0x20bd0e0
-        /* 020BD0E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020BD0E4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BD0E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020BD0E4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BD0E4 */ _t1 = _t0 & 0x00000001u;
         /* 020BD0E4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BD0E4 */ goto L_020BD0E8;
   L_020BD0E8: ; // 0x20bd0e8
         /* 020BD0E8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020BD0E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020BD0EC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020BD0E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020BD0EC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020BD0EC */ _t3 = _t2 & 0x00000001u;
         /* 020BD0EC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020BD0EC */ goto L_020BD0F0;
@@ -32057,8 +32057,8 @@ void Gambit_fn_020BD0E0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -32072,15 +32072,15 @@ void Gambit_fn_020BD0E0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
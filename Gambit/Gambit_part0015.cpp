@@ -26,9 +26,9 @@ void Gambit_fn_020CE938(CPUState* cpu) {
         /* 020CE954 */ cpu->r[31] = cpu->r[3];
         /* 020CE958 */ _t5 = cpu->r[12] + 0x0000001Cu;
         /* 020CE958 */ cpu->r[3] = rbrew_read32(cpu->mem, _t5);
-        /* 020CE95C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 020CE95C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 020CE960 */ cpu->r[30] = cpu->r[4];
-        /* 020CE964 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CE964 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CE964 */ _t7 = _t6 & 0x00000001u;
         /* 020CE964 */ if (_t7) goto L_020CE994; else goto L_020CE968;
   L_020CE968: ; // 0x20ce968
@@ -39,8 +39,8 @@ void Gambit_fn_020CE938(CPUState* cpu) {
         /* 020CE970 */ rbrew_write32(cpu->mem, _t9, cpu->r[10]);
         /* 020CE974 */ Gambit_fn_02022118(cpu);
         /* 020CE978 */ cpu->r[5] = cpu->r[3];
-        /* 020CE978 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 020CE97C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CE978 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 020CE97C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CE97C */ _t11 = _t10 & 0x00000001u;
         /* 020CE97C */ if (_t11) goto L_020CE994; else goto L_020CE980;
   L_020CE980: ; // 0x20ce980
@@ -83,9 +83,9 @@ void Gambit_fn_020CE93C(CPUState* cpu) {
         /* 020CE954 */ cpu->r[31] = cpu->r[3];
         /* 020CE958 */ _t5 = cpu->r[12] + 0x0000001Cu;
         /* 020CE958 */ cpu->r[3] = rbrew_read32(cpu->mem, _t5);
-        /* 020CE95C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 020CE95C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 020CE960 */ cpu->r[30] = cpu->r[4];
-        /* 020CE964 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CE964 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CE964 */ _t7 = _t6 & 0x00000001u;
         /* 020CE964 */ if (_t7) goto L_020CE994; else goto L_020CE968;
   L_020CE968: ; // 0x20ce968
@@ -96,8 +96,8 @@ void Gambit_fn_020CE93C(CPUState* cpu) {
         /* 020CE970 */ rbrew_write32(cpu->mem, _t9, cpu->r[10]);
         /* 020CE974 */ Gambit_fn_02022118(cpu);
         /* 020CE978 */ cpu->r[5] = cpu->r[3];
-        /* 020CE978 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 020CE97C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CE978 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 020CE97C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CE97C */ _t11 = _t10 & 0x00000001u;
         /* 020CE97C */ if (_t11) goto L_020CE994; else goto L_020CE980;
   L_020CE980: ; // 0x20ce980
@@ -135,11 +135,11 @@ void Gambit_fn_020CE9AC(CPUState* cpu) {
         /* 020CE9C0 */ cpu->r[28] = cpu->r[28] + 0x00007418u;
         /* 020CE9C4 */ cpu->r[30] = cpu->r[30] + 0x00007300u;
         /* 020CE9C8 */ cpu->r[27] = cpu->r[5];
-        /* 020CE9C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020CE9C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020CE9CC */ _t1 = cpu->r[1] + 0x0000006Cu;
         /* 020CE9CC */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020CE9D0 */ cpu->r[29] = cpu->r[3];
-        /* 020CE9D4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CE9D4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CE9D4 */ _t3 = _t2 & 0x00000001u;
         /* 020CE9D4 */ if (_t3) goto L_020CE9D8; else goto L_020CE9F8;
   L_020CE9D8: ; // 0x20ce9d8
@@ -150,8 +150,8 @@ void Gambit_fn_020CE9AC(CPUState* cpu) {
         /* 020CE9E4 */ _t5 = cpu->r[1] + 0x00000010u;
         /* 020CE9E4 */ rbrew_write32(cpu->mem, _t5, cpu->r[28]);
         /* 020CE9E8 */ Gambit_fn_02800CA8(cpu);
-        /* 020CE9EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CE9F0 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CE9EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CE9F0 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CE9F0 */ _t7 = _t6 & 0x00000001u;
         /* 020CE9F0 */ if (_t7) goto L_020CEC20; else goto L_020CE9F4;
   L_020CE9F4: ; // 0x20ce9f4
@@ -174,10 +174,10 @@ void Gambit_fn_020CE9AC(CPUState* cpu) {
         /* 020CEA1C */ rbrew_write8(cpu->mem, _t12, (uint8_t)cpu->r[31]);
         /* 020CEA20 */ _t13 = cpu->r[1] + 0x00000024u;
         /* 020CEA20 */ rbrew_write32(cpu->mem, _t13, cpu->r[8]);
-        /* 020CEA24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000001u);
+        /* 020CEA24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000001u));
         /* 020CEA28 */ _t14 = cpu->r[1] + 0x0000004Bu;
         /* 020CEA28 */ rbrew_write8(cpu->mem, _t14, (uint8_t)cpu->r[31]);
-        /* 020CEA2C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEA2C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEA2C */ _t16 = _t15 & 0x00000001u;
         /* 020CEA2C */ if (_t16) goto L_020CEA30; else goto L_020CEA74;
   L_020CEA30: ; // 0x20cea30
@@ -193,7 +193,7 @@ void Gambit_fn_020CE9AC(CPUState* cpu) {
         /* 020CEA4C */ _t19 = cpu->r[27] + 0x000000A4u;
         /* 020CEA4C */ cpu->r[5] = rbrew_read32(cpu->mem, _t19);
         /* 020CEA50 */ cpu->r[4] = cpu->r[4] + 0x000073E8u;
-        /* 020CEA54 */ _t20 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020CEA54 */ _t20 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020CEA54 */ _t21 = _t20 & 0x00000001u;
         /* 020CEA54 */ if (_t21) goto L_020CEA58; // else: addr-0 trap, fall-through
   L_020CEA58: ; // 0x20cea58
@@ -201,15 +201,15 @@ void Gambit_fn_020CE9AC(CPUState* cpu) {
         /* 020CEA5C */ cpu->r[3] = cpu->r[29];
         /* 020CEA60 */ cpu->r[4] = cpu->r[1] + 0x00000020u;
         /* 020CEA64 */ Gambit_fn_02800CA8(cpu);
-        /* 020CEA68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CEA6C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEA68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CEA6C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEA6C */ _t23 = _t22 & 0x00000001u;
         /* 020CEA6C */ if (_t23) goto L_020CEA70; else goto L_020CEC14;
   L_020CEA70: ; // 0x20cea70
         /* 020CEA70 */ goto L_020CEBF8;
   L_020CEA74: ; // 0x20cea74
-        /* 020CEA74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000002u);
-        /* 020CEA78 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEA74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000002u));
+        /* 020CEA78 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEA78 */ _t25 = _t24 & 0x00000001u;
         /* 020CEA78 */ if (_t25) goto L_020CEA7C; else goto L_020CEBB8;
   L_020CEA7C: ; // 0x20cea7c
@@ -244,8 +244,8 @@ void Gambit_fn_020CE9AC(CPUState* cpu) {
         /* 020CEAC8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020CEACC */ _t35 = cpu->r[1] + 0x00000008u;
         /* 020CEACC */ cpu->r[0] = rbrew_read32(cpu->mem, _t35);
-        /* 020CEAD0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], cpu->r[0]);
-        /* 020CEAD4 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEAD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], cpu->r[0]));
+        /* 020CEAD4 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEAD4 */ _t37 = _t36 & 0x00000001u;
         /* 020CEAD4 */ if (_t37) goto L_020CEAD8; else goto L_020CEB3C;
   L_020CEAD8: ; // 0x20cead8
@@ -272,7 +272,7 @@ void Gambit_fn_020CE9AC(CPUState* cpu) {
         /* 020CEB10 */ cpu->r[3] = cpu->r[1] + 0x00000020u;
         /* 020CEB14 */ cpu->r[4] = cpu->r[4] + 0x0000740Cu;
         /* 020CEB18 */ cpu->r[5] = cpu->r[31];
-        /* 020CEB1C */ _t44 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020CEB1C */ _t44 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020CEB1C */ _t45 = _t44 & 0x00000001u;
         /* 020CEB1C */ if (_t45) goto L_020CEB20; // else: addr-0 trap, fall-through
   L_020CEB20: ; // 0x20ceb20
@@ -280,8 +280,8 @@ void Gambit_fn_020CE9AC(CPUState* cpu) {
         /* 020CEB24 */ cpu->r[4] = cpu->r[1] + 0x00000020u;
         /* 020CEB28 */ cpu->r[3] = cpu->r[29];
         /* 020CEB2C */ Gambit_fn_02800CA8(cpu);
-        /* 020CEB30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CEB34 */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEB30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CEB34 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEB34 */ _t47 = _t46 & 0x00000001u;
         /* 020CEB34 */ if (_t47) goto L_020CEB38; else goto L_020CEC14;
   L_020CEB38: ; // 0x20ceb38
@@ -303,13 +303,13 @@ void Gambit_fn_020CE9AC(CPUState* cpu) {
         /* 020CEB5C */ _t51 = cpu->r[9] + 0x00000001u;
         /* 020CEB5C */ cpu->r[6] = rbrew_read8(cpu->mem, _t51);
         /* 020CEB5C */ cpu->r[9] = _t51;
-        /* 020CEB60 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[6]);
-        /* 020CEB64 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEB60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[6]));
+        /* 020CEB64 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEB64 */ _t53 = _t52 & 0x00000001u;
         /* 020CEB64 */ if (_t53) goto L_020CEB68; else goto L_020CEB74;
   L_020CEB68: ; // 0x20ceb68
-        /* 020CEB68 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[31]);
-        /* 020CEB6C */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEB68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[31]));
+        /* 020CEB6C */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEB6C */ _t55 = _t54 & 0x00000001u;
         /* 020CEB6C */ if (_t55) goto L_020CEAD8; else goto L_020CEB70;
   L_020CEB70: ; // 0x20ceb70
@@ -331,7 +331,7 @@ void Gambit_fn_020CE9AC(CPUState* cpu) {
         /* 020CEB8C */ cpu->r[5] = rbrew_read32(cpu->mem, _t61);
         /* 020CEB90 */ cpu->r[3] = cpu->r[1] + 0x00000020u;
         /* 020CEB94 */ cpu->r[4] = cpu->r[4] + 0x000073F0u;
-        /* 020CEB98 */ _t62 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020CEB98 */ _t62 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020CEB98 */ _t63 = _t62 & 0x00000001u;
         /* 020CEB98 */ if (_t63) goto L_020CEB9C; // else: addr-0 trap, fall-through
   L_020CEB9C: ; // 0x20ceb9c
@@ -339,8 +339,8 @@ void Gambit_fn_020CE9AC(CPUState* cpu) {
         /* 020CEBA0 */ cpu->r[4] = cpu->r[1] + 0x00000020u;
         /* 020CEBA4 */ cpu->r[3] = cpu->r[29];
         /* 020CEBA8 */ Gambit_fn_02800CA8(cpu);
-        /* 020CEBAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CEBB0 */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEBAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CEBB0 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEBB0 */ _t65 = _t64 & 0x00000001u;
         /* 020CEBB0 */ if (_t65) goto L_020CEBB4; else goto L_020CEC14;
   L_020CEBB4: ; // 0x20cebb4
@@ -358,7 +358,7 @@ void Gambit_fn_020CE9AC(CPUState* cpu) {
         /* 020CEBD4 */ _t68 = cpu->r[27] + 0x0000000Cu;
         /* 020CEBD4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t68);
         /* 020CEBD8 */ cpu->r[4] = cpu->r[4] + 0x000073F8u;
-        /* 020CEBDC */ _t69 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020CEBDC */ _t69 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020CEBDC */ _t70 = _t69 & 0x00000001u;
         /* 020CEBDC */ if (_t70) goto L_020CEBE0; // else: addr-0 trap, fall-through
   L_020CEBE0: ; // 0x20cebe0
@@ -366,8 +366,8 @@ void Gambit_fn_020CE9AC(CPUState* cpu) {
         /* 020CEBE4 */ cpu->r[3] = cpu->r[29];
         /* 020CEBE8 */ cpu->r[4] = cpu->r[1] + 0x00000020u;
         /* 020CEBEC */ Gambit_fn_02800CA8(cpu);
-        /* 020CEBF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CEBF4 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEBF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CEBF4 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEBF4 */ _t72 = _t71 & 0x00000001u;
         /* 020CEBF4 */ if (_t72) goto L_020CEBF8; else goto L_020CEC14;
   L_020CEBF8: ; // 0x20cebf8
@@ -378,8 +378,8 @@ void Gambit_fn_020CE9AC(CPUState* cpu) {
         /* 020CEC04 */ _t74 = cpu->r[1] + 0x00000018u;
         /* 020CEC04 */ rbrew_write32(cpu->mem, _t74, cpu->r[28]);
         /* 020CEC08 */ Gambit_fn_02800CA8(cpu);
-        /* 020CEC0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CEC10 */ _t75 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEC0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CEC10 */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEC10 */ _t76 = _t75 & 0x00000001u;
         /* 020CEC10 */ if (_t76) goto L_020CEC20; else goto L_020CEC14;
   L_020CEC14: ; // 0x20cec14
@@ -417,16 +417,16 @@ void Gambit_fn_020CEC34(CPUState* cpu) {
         /* 020CEC54 */ _t5 = cpu->r[12] + 0x00000020u;
         /* 020CEC54 */ cpu->r[3] = rbrew_read32(cpu->mem, _t5);
         /* 020CEC58 */ cpu->r[31] = cpu->r[4];
-        /* 020CEC5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 020CEC5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 020CEC60 */ cpu->r[4] = cpu->r[5];
-        /* 020CEC64 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEC64 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEC64 */ _t7 = _t6 & 0x00000001u;
         /* 020CEC64 */ if (_t7) goto L_020CEC88; else goto L_020CEC68;
   L_020CEC68: ; // 0x20cec68
         /* 020CEC68 */ Gambit_fn_0202457C(cpu);
         /* 020CEC6C */ cpu->r[5] = cpu->r[3];
-        /* 020CEC6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 020CEC70 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEC6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 020CEC70 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEC70 */ _t9 = _t8 & 0x00000001u;
         /* 020CEC70 */ if (_t9) goto L_020CEC88; else goto L_020CEC74;
   L_020CEC74: ; // 0x20cec74
@@ -470,16 +470,16 @@ void Gambit_fn_020CEC38(CPUState* cpu) {
         /* 020CEC54 */ _t5 = cpu->r[12] + 0x00000020u;
         /* 020CEC54 */ cpu->r[3] = rbrew_read32(cpu->mem, _t5);
         /* 020CEC58 */ cpu->r[31] = cpu->r[4];
-        /* 020CEC5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 020CEC5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 020CEC60 */ cpu->r[4] = cpu->r[5];
-        /* 020CEC64 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEC64 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEC64 */ _t7 = _t6 & 0x00000001u;
         /* 020CEC64 */ if (_t7) goto L_020CEC88; else goto L_020CEC68;
   L_020CEC68: ; // 0x20cec68
         /* 020CEC68 */ Gambit_fn_0202457C(cpu);
         /* 020CEC6C */ cpu->r[5] = cpu->r[3];
-        /* 020CEC6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 020CEC70 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEC6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 020CEC70 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEC70 */ _t9 = _t8 & 0x00000001u;
         /* 020CEC70 */ if (_t9) goto L_020CEC88; else goto L_020CEC74;
   L_020CEC74: ; // 0x20cec74
@@ -522,13 +522,13 @@ void Gambit_fn_020CECA0(CPUState* cpu) {
         /* 020CECB8 */ rbrew_write32(cpu->mem, _t4, cpu->r[29]);
         /* 020CECBC */ cpu->r[31] = cpu->r[31] + 0x00007300u;
         /* 020CECC0 */ cpu->r[28] = cpu->r[4];
-        /* 020CECC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 020CECC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 020CECC4 */ _t5 = cpu->r[1] + 0x0000005Cu;
         /* 020CECC4 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
         /* 020CECC8 */ cpu->r[29] = 0x10010000u;
         /* 020CECCC */ cpu->r[30] = cpu->r[3];
         /* 020CECD0 */ cpu->r[29] = cpu->r[29] + 0x0000742Cu;
-        /* 020CECD4 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CECD4 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CECD4 */ _t7 = _t6 & 0x00000001u;
         /* 020CECD4 */ if (_t7) goto L_020CECD8; else goto L_020CECF8;
   L_020CECD8: ; // 0x20cecd8
@@ -539,8 +539,8 @@ void Gambit_fn_020CECA0(CPUState* cpu) {
         /* 020CECE4 */ _t9 = cpu->r[1] + 0x00000008u;
         /* 020CECE4 */ rbrew_write32(cpu->mem, _t9, cpu->r[29]);
         /* 020CECE8 */ Gambit_fn_02800CA8(cpu);
-        /* 020CECEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CECF0 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CECEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CECF0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CECF0 */ _t11 = _t10 & 0x00000001u;
         /* 020CECF0 */ if (_t11) goto L_020CED8C; else goto L_020CECF4;
   L_020CECF4: ; // 0x20cecf4
@@ -575,7 +575,7 @@ void Gambit_fn_020CECA0(CPUState* cpu) {
         /* 020CED3C */ cpu->r[5] = rbrew_read32(cpu->mem, _t20);
         /* 020CED40 */ cpu->r[4] = cpu->r[4] + 0x00007424u;
         /* 020CED44 */ cpu->r[3] = cpu->r[1] + 0x00000018u;
-        /* 020CED48 */ _t21 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020CED48 */ _t21 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020CED48 */ _t22 = _t21 & 0x00000001u;
         /* 020CED48 */ if (_t22) goto L_020CED4C; // else: addr-0 trap, fall-through
   L_020CED4C: ; // 0x20ced4c
@@ -583,8 +583,8 @@ void Gambit_fn_020CECA0(CPUState* cpu) {
         /* 020CED50 */ cpu->r[4] = cpu->r[1] + 0x00000018u;
         /* 020CED54 */ cpu->r[3] = cpu->r[30];
         /* 020CED58 */ Gambit_fn_02800CA8(cpu);
-        /* 020CED5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CED60 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CED5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CED60 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CED60 */ _t24 = _t23 & 0x00000001u;
         /* 020CED60 */ if (_t24) goto L_020CED64; else goto L_020CED80;
   L_020CED64: ; // 0x20ced64
@@ -595,8 +595,8 @@ void Gambit_fn_020CECA0(CPUState* cpu) {
         /* 020CED70 */ _t26 = cpu->r[1] + 0x00000010u;
         /* 020CED70 */ rbrew_write32(cpu->mem, _t26, cpu->r[29]);
         /* 020CED74 */ Gambit_fn_02800CA8(cpu);
-        /* 020CED78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CED7C */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CED78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CED7C */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CED7C */ _t28 = _t27 & 0x00000001u;
         /* 020CED7C */ if (_t28) goto L_020CED8C; else goto L_020CED80;
   L_020CED80: ; // 0x20ced80
@@ -638,13 +638,13 @@ void Gambit_fn_020CECA4(CPUState* cpu) {
         /* 020CECB8 */ rbrew_write32(cpu->mem, _t4, cpu->r[29]);
         /* 020CECBC */ cpu->r[31] = cpu->r[31] + 0x00007300u;
         /* 020CECC0 */ cpu->r[28] = cpu->r[4];
-        /* 020CECC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 020CECC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 020CECC4 */ _t5 = cpu->r[1] + 0x0000005Cu;
         /* 020CECC4 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
         /* 020CECC8 */ cpu->r[29] = 0x10010000u;
         /* 020CECCC */ cpu->r[30] = cpu->r[3];
         /* 020CECD0 */ cpu->r[29] = cpu->r[29] + 0x0000742Cu;
-        /* 020CECD4 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CECD4 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CECD4 */ _t7 = _t6 & 0x00000001u;
         /* 020CECD4 */ if (_t7) goto L_020CECD8; else goto L_020CECF8;
   L_020CECD8: ; // 0x20cecd8
@@ -655,8 +655,8 @@ void Gambit_fn_020CECA4(CPUState* cpu) {
         /* 020CECE4 */ _t9 = cpu->r[1] + 0x00000008u;
         /* 020CECE4 */ rbrew_write32(cpu->mem, _t9, cpu->r[29]);
         /* 020CECE8 */ Gambit_fn_02800CA8(cpu);
-        /* 020CECEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CECF0 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CECEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CECF0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CECF0 */ _t11 = _t10 & 0x00000001u;
         /* 020CECF0 */ if (_t11) goto L_020CED8C; else goto L_020CECF4;
   L_020CECF4: ; // 0x20cecf4
@@ -691,7 +691,7 @@ void Gambit_fn_020CECA4(CPUState* cpu) {
         /* 020CED3C */ cpu->r[5] = rbrew_read32(cpu->mem, _t20);
         /* 020CED40 */ cpu->r[4] = cpu->r[4] + 0x00007424u;
         /* 020CED44 */ cpu->r[3] = cpu->r[1] + 0x00000018u;
-        /* 020CED48 */ _t21 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020CED48 */ _t21 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020CED48 */ _t22 = _t21 & 0x00000001u;
         /* 020CED48 */ if (_t22) goto L_020CED4C; // else: addr-0 trap, fall-through
   L_020CED4C: ; // 0x20ced4c
@@ -699,8 +699,8 @@ void Gambit_fn_020CECA4(CPUState* cpu) {
         /* 020CED50 */ cpu->r[4] = cpu->r[1] + 0x00000018u;
         /* 020CED54 */ cpu->r[3] = cpu->r[30];
         /* 020CED58 */ Gambit_fn_02800CA8(cpu);
-        /* 020CED5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CED60 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CED5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CED60 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CED60 */ _t24 = _t23 & 0x00000001u;
         /* 020CED60 */ if (_t24) goto L_020CED64; else goto L_020CED80;
   L_020CED64: ; // 0x20ced64
@@ -711,8 +711,8 @@ void Gambit_fn_020CECA4(CPUState* cpu) {
         /* 020CED70 */ _t26 = cpu->r[1] + 0x00000010u;
         /* 020CED70 */ rbrew_write32(cpu->mem, _t26, cpu->r[29]);
         /* 020CED74 */ Gambit_fn_02800CA8(cpu);
-        /* 020CED78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CED7C */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CED78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CED7C */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CED7C */ _t28 = _t27 & 0x00000001u;
         /* 020CED7C */ if (_t28) goto L_020CED8C; else goto L_020CED80;
   L_020CED80: ; // 0x20ced80
@@ -754,15 +754,15 @@ void Gambit_fn_020CEDAC(CPUState* cpu) {
         /* 020CEDC4 */ cpu->r[31] = cpu->r[3];
         /* 020CEDC8 */ _t4 = cpu->r[12] + 0x00000020u;
         /* 020CEDC8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t4);
-        /* 020CEDCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CEDD0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEDCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CEDD0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEDD0 */ _t6 = _t5 & 0x00000001u;
         /* 020CEDD0 */ if (_t6) goto L_020CEDE8; else goto L_020CEDD4;
   L_020CEDD4: ; // 0x20cedd4
         /* 020CEDD4 */ Gambit_fn_0202457C(cpu);
         /* 020CEDD8 */ cpu->r[4] = cpu->r[3];
-        /* 020CEDD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020CEDDC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEDD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020CEDDC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEDDC */ _t8 = _t7 & 0x00000001u;
         /* 020CEDDC */ if (_t8) goto L_020CEDE8; else goto L_020CEDE0;
   L_020CEDE0: ; // 0x20cede0
@@ -796,15 +796,15 @@ void Gambit_fn_020CEDB0(CPUState* cpu) {
         /* 020CEDC4 */ cpu->r[31] = cpu->r[3];
         /* 020CEDC8 */ _t4 = cpu->r[12] + 0x00000020u;
         /* 020CEDC8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t4);
-        /* 020CEDCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CEDD0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEDCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CEDD0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEDD0 */ _t6 = _t5 & 0x00000001u;
         /* 020CEDD0 */ if (_t6) goto L_020CEDE8; else goto L_020CEDD4;
   L_020CEDD4: ; // 0x20cedd4
         /* 020CEDD4 */ Gambit_fn_0202457C(cpu);
         /* 020CEDD8 */ cpu->r[4] = cpu->r[3];
-        /* 020CEDD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020CEDDC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEDD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020CEDDC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEDDC */ _t8 = _t7 & 0x00000001u;
         /* 020CEDDC */ if (_t8) goto L_020CEDE8; else goto L_020CEDE0;
   L_020CEDE0: ; // 0x20cede0
@@ -827,7 +827,7 @@ void Gambit_fn_020CEDFC(CPUState* cpu) {
   L_020CEDFC: ; // 0x20cedfc
         /* 020CEDFC */ cpu->r[0] = cpu->lr;
         /* 020CEE00 */ cpu->r[12] = 0x10010000u;
-        /* 020CEE04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 020CEE04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 020CEE08 */ cpu->r[12] = cpu->r[12] + 0x00007300u;
         /* 020CEE0C */ cpu->r[4] = 0x00000001u;
         /* 020CEE10 */ _t0 = cpu->r[1] + 0x00000004u;
@@ -837,7 +837,7 @@ void Gambit_fn_020CEDFC(CPUState* cpu) {
         /* 020CEE18 */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 020CEE18 */ cpu->r[1] = _t1;
         /* 020CEE1C */ cpu->r[0] = cpu->r[0] + 0x00007438u;
-        /* 020CEE20 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEE20 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEE20 */ _t3 = _t2 & 0x00000001u;
         /* 020CEE20 */ if (_t3) goto L_020CEE44; else goto L_020CEE24;
   L_020CEE24: ; // 0x20cee24
@@ -880,7 +880,7 @@ void Gambit_fn_020CEE08(CPUState* cpu) {
         /* 020CEE18 */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 020CEE18 */ cpu->r[1] = _t1;
         /* 020CEE1C */ cpu->r[0] = cpu->r[0] + 0x00007438u;
-        /* 020CEE20 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEE20 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEE20 */ _t3 = _t2 & 0x00000001u;
         /* 020CEE20 */ if (_t3) goto L_020CEE44; else goto L_020CEE24;
   L_020CEE24: ; // 0x20cee24
@@ -918,7 +918,7 @@ void Gambit_fn_020CEE18(CPUState* cpu) {
         /* 020CEE18 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 020CEE18 */ cpu->r[1] = _t0;
         /* 020CEE1C */ cpu->r[0] = cpu->r[0] + 0x00007438u;
-        /* 020CEE20 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEE20 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEE20 */ _t2 = _t1 & 0x00000001u;
         /* 020CEE20 */ if (_t2) goto L_020CEE44; else goto L_020CEE24;
   L_020CEE24: ; // 0x20cee24
@@ -962,8 +962,8 @@ void Gambit_fn_020CEE64(CPUState* cpu) {
         /* 020CEE74 */ _t2 = cpu->r[1] + 0x0000001Cu;
         /* 020CEE74 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020CEE78 */ Gambit_fn_02800CA8(cpu);
-        /* 020CEE7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CEE80 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEE7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CEE80 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEE80 */ _t4 = _t3 & 0x00000001u;
         /* 020CEE80 */ if (_t4) goto L_020CEE84; else goto L_020CEEB0;
   L_020CEE84: ; // 0x20cee84
@@ -978,8 +978,8 @@ void Gambit_fn_020CEE64(CPUState* cpu) {
         /* 020CEEA0 */ _t6 = cpu->r[1] + 0x00000008u;
         /* 020CEEA0 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 020CEEA4 */ Gambit_fn_02800CA8(cpu);
-        /* 020CEEA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CEEAC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEEA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CEEAC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEEAC */ _t8 = _t7 & 0x00000001u;
         /* 020CEEAC */ if (_t8) goto L_020CEEBC; else goto L_020CEEB0;
   L_020CEEB0: ; // 0x20ceeb0
@@ -1010,8 +1010,8 @@ void Gambit_fn_020CEE68(CPUState* cpu) {
         /* 020CEE74 */ _t2 = cpu->r[1] + 0x0000001Cu;
         /* 020CEE74 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020CEE78 */ Gambit_fn_02800CA8(cpu);
-        /* 020CEE7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CEE80 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEE7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CEE80 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEE80 */ _t4 = _t3 & 0x00000001u;
         /* 020CEE80 */ if (_t4) goto L_020CEE84; else goto L_020CEEB0;
   L_020CEE84: ; // 0x20cee84
@@ -1026,8 +1026,8 @@ void Gambit_fn_020CEE68(CPUState* cpu) {
         /* 020CEEA0 */ _t6 = cpu->r[1] + 0x00000008u;
         /* 020CEEA0 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 020CEEA4 */ Gambit_fn_02800CA8(cpu);
-        /* 020CEEA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CEEAC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEEA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CEEAC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEEAC */ _t8 = _t7 & 0x00000001u;
         /* 020CEEAC */ if (_t8) goto L_020CEEBC; else goto L_020CEEB0;
   L_020CEEB0: ; // 0x20ceeb0
@@ -1059,11 +1059,11 @@ void Gambit_fn_020CEED0(CPUState* cpu) {
         /* 020CEEE4 */ cpu->r[28] = cpu->r[28] + 0x00007460u;
         /* 020CEEE8 */ cpu->r[31] = cpu->r[31] + 0x00007300u;
         /* 020CEEEC */ cpu->r[30] = cpu->r[4];
-        /* 020CEEEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020CEEEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020CEEF0 */ _t1 = cpu->r[1] + 0x0000004Cu;
         /* 020CEEF0 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020CEEF4 */ cpu->r[29] = cpu->r[3];
-        /* 020CEEF8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEEF8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEEF8 */ _t3 = _t2 & 0x00000001u;
         /* 020CEEF8 */ if (_t3) goto L_020CEEFC; else goto L_020CEF1C;
   L_020CEEFC: ; // 0x20ceefc
@@ -1074,8 +1074,8 @@ void Gambit_fn_020CEED0(CPUState* cpu) {
         /* 020CEF08 */ _t5 = cpu->r[1] + 0x00000010u;
         /* 020CEF08 */ rbrew_write32(cpu->mem, _t5, cpu->r[28]);
         /* 020CEF0C */ Gambit_fn_02800CA8(cpu);
-        /* 020CEF10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CEF14 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEF10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CEF14 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEF14 */ _t7 = _t6 & 0x00000001u;
         /* 020CEF14 */ if (_t7) goto L_020CF05C; else goto L_020CEF18;
   L_020CEF18: ; // 0x20cef18
@@ -1112,10 +1112,10 @@ void Gambit_fn_020CEED0(CPUState* cpu) {
         /* 020CEF68 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020CEF6C */ _t17 = cpu->r[1] + 0x00000008u;
         /* 020CEF6C */ cpu->r[0] = rbrew_read32(cpu->mem, _t17);
-        /* 020CEF70 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], cpu->r[0]);
+        /* 020CEF70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], cpu->r[0]));
         /* 020CEF74 */ cpu->r[0] = 0x10010000u;
         /* 020CEF78 */ cpu->r[0] = cpu->r[0] + 0x00007458u;
-        /* 020CEF7C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEF7C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEF7C */ _t19 = _t18 & 0x00000001u;
         /* 020CEF7C */ if (_t19) goto L_020CEFC4; else goto L_020CEF80;
   L_020CEF80: ; // 0x20cef80
@@ -1138,13 +1138,13 @@ void Gambit_fn_020CEED0(CPUState* cpu) {
         /* 020CEFA8 */ _t24 = cpu->r[11] + 0x00000001u;
         /* 020CEFA8 */ cpu->r[7] = rbrew_read8(cpu->mem, _t24);
         /* 020CEFA8 */ cpu->r[11] = _t24;
-        /* 020CEFAC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[7]);
-        /* 020CEFB0 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEFAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[7]));
+        /* 020CEFB0 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEFB0 */ _t26 = _t25 & 0x00000001u;
         /* 020CEFB0 */ if (_t26) goto L_020CEFB4; else goto L_020CEFFC;
   L_020CEFB4: ; // 0x20cefb4
-        /* 020CEFB4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[12]);
-        /* 020CEFB8 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CEFB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[12]));
+        /* 020CEFB8 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CEFB8 */ _t28 = _t27 & 0x00000001u;
         /* 020CEFB8 */ if (_t28) goto L_020CEFC4; else goto L_020CEFBC;
   L_020CEFBC: ; // 0x20cefbc
@@ -1192,8 +1192,8 @@ void Gambit_fn_020CEED0(CPUState* cpu) {
         /* 020CF020 */ cpu->r[3] = cpu->r[29];
         /* 020CF024 */ cpu->r[4] = cpu->r[30] + 0x0000000Cu;
         /* 020CF028 */ Gambit_fn_02800CA8(cpu);
-        /* 020CF02C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CF030 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CF02C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CF030 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CF030 */ _t42 = _t41 & 0x00000001u;
         /* 020CF030 */ if (_t42) goto L_020CF034; else goto L_020CF050;
   L_020CF034: ; // 0x20cf034
@@ -1204,8 +1204,8 @@ void Gambit_fn_020CEED0(CPUState* cpu) {
         /* 020CF040 */ _t44 = cpu->r[1] + 0x00000028u;
         /* 020CF040 */ rbrew_write32(cpu->mem, _t44, cpu->r[28]);
         /* 020CF044 */ Gambit_fn_02800CA8(cpu);
-        /* 020CF048 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CF04C */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CF048 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CF04C */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CF04C */ _t46 = _t45 & 0x00000001u;
         /* 020CF04C */ if (_t46) goto L_020CF05C; else goto L_020CF050;
   L_020CF050: ; // 0x20cf050
@@ -1240,15 +1240,15 @@ void Gambit_fn_020CF070(CPUState* cpu) {
         /* 020CF088 */ cpu->r[31] = cpu->r[3];
         /* 020CF08C */ _t4 = cpu->r[12] + 0x00000030u;
         /* 020CF08C */ cpu->r[3] = rbrew_read32(cpu->mem, _t4);
-        /* 020CF090 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CF094 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CF090 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CF094 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CF094 */ _t6 = _t5 & 0x00000001u;
         /* 020CF094 */ if (_t6) goto L_020CF0AC; else goto L_020CF098;
   L_020CF098: ; // 0x20cf098
         /* 020CF098 */ Gambit_fn_02026870(cpu);
         /* 020CF09C */ cpu->r[4] = cpu->r[3];
-        /* 020CF09C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020CF0A0 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CF09C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020CF0A0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CF0A0 */ _t8 = _t7 & 0x00000001u;
         /* 020CF0A0 */ if (_t8) goto L_020CF0AC; else goto L_020CF0A4;
   L_020CF0A4: ; // 0x20cf0a4
@@ -1282,15 +1282,15 @@ void Gambit_fn_020CF074(CPUState* cpu) {
         /* 020CF088 */ cpu->r[31] = cpu->r[3];
         /* 020CF08C */ _t4 = cpu->r[12] + 0x00000030u;
         /* 020CF08C */ cpu->r[3] = rbrew_read32(cpu->mem, _t4);
-        /* 020CF090 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CF094 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CF090 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CF094 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CF094 */ _t6 = _t5 & 0x00000001u;
         /* 020CF094 */ if (_t6) goto L_020CF0AC; else goto L_020CF098;
   L_020CF098: ; // 0x20cf098
         /* 020CF098 */ Gambit_fn_02026870(cpu);
         /* 020CF09C */ cpu->r[4] = cpu->r[3];
-        /* 020CF09C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020CF0A0 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CF09C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020CF0A0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CF0A0 */ _t8 = _t7 & 0x00000001u;
         /* 020CF0A0 */ if (_t8) goto L_020CF0AC; else goto L_020CF0A4;
   L_020CF0A4: ; // 0x20cf0a4
@@ -1574,7 +1574,7 @@ void Gambit_fn_020CF1BC(CPUState* cpu) {
         /* 020CF24C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t15);
         /* 020CF250 */ _t16 = cpu->r[1] + 0x00000014u;
         /* 020CF250 */ cpu->r[31] = rbrew_read32(cpu->mem, _t16);
-        /* 020CF254 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CF254 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CF254 */ _t18 = _t17 & 0x00000001u;
         /* 020CF254 */ if (_t18) goto L_020CF258; // else: addr-0 trap, fall-through
   L_020CF258: ; // 0x20cf258
@@ -1644,7 +1644,7 @@ void Gambit_fn_020CF268(CPUState* cpu) {
         /* 020CF2F0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t15);
         /* 020CF2F4 */ _t16 = cpu->r[1] + 0x00000014u;
         /* 020CF2F4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t16);
-        /* 020CF2F8 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CF2F8 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CF2F8 */ _t18 = _t17 & 0x00000001u;
         /* 020CF2F8 */ if (_t18) goto L_020CF2FC; // else: addr-0 trap, fall-through
   L_020CF2FC: ; // 0x20cf2fc
@@ -1713,7 +1713,7 @@ void Gambit_fn_020CF26C(CPUState* cpu) {
         /* 020CF2F0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t15);
         /* 020CF2F4 */ _t16 = cpu->r[1] + 0x00000014u;
         /* 020CF2F4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t16);
-        /* 020CF2F8 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CF2F8 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CF2F8 */ _t18 = _t17 & 0x00000001u;
         /* 020CF2F8 */ if (_t18) goto L_020CF2FC; // else: addr-0 trap, fall-through
   L_020CF2FC: ; // 0x20cf2fc
@@ -1782,7 +1782,7 @@ void Gambit_fn_020CF310(CPUState* cpu) {
         /* 020CF394 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t15);
         /* 020CF398 */ _t16 = cpu->r[1] + 0x00000014u;
         /* 020CF398 */ cpu->r[31] = rbrew_read32(cpu->mem, _t16);
-        /* 020CF39C */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CF39C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CF39C */ _t18 = _t17 & 0x00000001u;
         /* 020CF39C */ if (_t18) goto L_020CF3A0; // else: addr-0 trap, fall-through
   L_020CF3A0: ; // 0x20cf3a0
@@ -1852,7 +1852,7 @@ void Gambit_fn_020CF3B0(CPUState* cpu) {
         /* 020CF438 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t15);
         /* 020CF43C */ _t16 = cpu->r[1] + 0x00000014u;
         /* 020CF43C */ cpu->r[31] = rbrew_read32(cpu->mem, _t16);
-        /* 020CF440 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CF440 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CF440 */ _t18 = _t17 & 0x00000001u;
         /* 020CF440 */ if (_t18) goto L_020CF444; // else: addr-0 trap, fall-through
   L_020CF444: ; // 0x20cf444
@@ -1921,7 +1921,7 @@ void Gambit_fn_020CF3B4(CPUState* cpu) {
         /* 020CF438 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t15);
         /* 020CF43C */ _t16 = cpu->r[1] + 0x00000014u;
         /* 020CF43C */ cpu->r[31] = rbrew_read32(cpu->mem, _t16);
-        /* 020CF440 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CF440 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CF440 */ _t18 = _t17 & 0x00000001u;
         /* 020CF440 */ if (_t18) goto L_020CF444; // else: addr-0 trap, fall-through
   L_020CF444: ; // 0x20cf444
@@ -2051,7 +2051,7 @@ void Gambit_fn_020CF4E4(CPUState* cpu) {
         /* 020CF570 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t17);
         /* 020CF574 */ _t18 = cpu->r[1] + 0x0000001Cu;
         /* 020CF574 */ cpu->r[31] = rbrew_read32(cpu->mem, _t18);
-        /* 020CF578 */ _t19 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CF578 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CF578 */ _t20 = _t19 & 0x00000001u;
         /* 020CF578 */ if (_t20) goto L_020CF57C; // else: addr-0 trap, fall-through
   L_020CF57C: ; // 0x20cf57c
@@ -2091,10 +2091,10 @@ void Gambit_fn_020CF58C(CPUState* cpu) {
         /* 020CF5C0 */ cpu->r[31] = cpu->r[3];
         /* 020CF5C4 */ _t7 = cpu->r[1] + 0x00000033u;
         /* 020CF5C4 */ rbrew_write8(cpu->mem, _t7, (uint8_t)cpu->r[12]);
-        /* 020CF5C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 020CF5C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 020CF5CC */ _t8 = cpu->r[1] + 0x00000014u;
         /* 020CF5CC */ rbrew_write8(cpu->mem, _t8, (uint8_t)cpu->r[12]);
-        /* 020CF5D0 */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CF5D0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CF5D0 */ _t10 = _t9 & 0x00000001u;
         /* 020CF5D0 */ if (_t10) goto L_020CF5D4; else goto L_020CF604;
   L_020CF5D4: ; // 0x20cf5d4
@@ -2102,7 +2102,7 @@ void Gambit_fn_020CF58C(CPUState* cpu) {
         /* 020CF5D8 */ cpu->r[5] = 0x00000000u;
         /* 020CF5DC */ cpu->r[4] = cpu->r[4] + 0x000074F0u;
         /* 020CF5E0 */ cpu->r[3] = cpu->r[1] + 0x00000008u;
-        /* 020CF5E4 */ _t11 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020CF5E4 */ _t11 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020CF5E4 */ _t12 = _t11 & 0x00000001u;
         /* 020CF5E4 */ if (_t12) goto L_020CF5E8; // else: addr-0 trap, fall-through
   L_020CF5E8: ; // 0x20cf5e8
@@ -2110,15 +2110,15 @@ void Gambit_fn_020CF58C(CPUState* cpu) {
         /* 020CF5EC */ cpu->r[3] = cpu->r[31];
         /* 020CF5F0 */ cpu->r[4] = cpu->r[1] + 0x00000008u;
         /* 020CF5F4 */ Gambit_fn_02800CA8(cpu);
-        /* 020CF5F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CF5FC */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CF5F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CF5FC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CF5FC */ _t14 = _t13 & 0x00000001u;
         /* 020CF5FC */ if (_t14) goto L_020CF600; else goto L_020CF63C;
   L_020CF600: ; // 0x20cf600
         /* 020CF600 */ goto L_020CF648;
   L_020CF604: ; // 0x20cf604
-        /* 020CF604 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000003u);
-        /* 020CF608 */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CF604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000003u));
+        /* 020CF608 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CF608 */ _t16 = _t15 & 0x00000001u;
         /* 020CF608 */ if (_t16) goto L_020CF60C; else goto L_020CF610;
   L_020CF60C: ; // 0x20cf60c
@@ -2128,7 +2128,7 @@ void Gambit_fn_020CF58C(CPUState* cpu) {
         /* 020CF614 */ cpu->r[4] = 0x10010000u;
         /* 020CF618 */ cpu->r[3] = cpu->r[1] + 0x00000008u;
         /* 020CF61C */ cpu->r[4] = cpu->r[4] + 0x000074F0u;
-        /* 020CF620 */ _t17 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020CF620 */ _t17 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020CF620 */ _t18 = _t17 & 0x00000001u;
         /* 020CF620 */ if (_t18) goto L_020CF624; // else: addr-0 trap, fall-through
   L_020CF624: ; // 0x20cf624
@@ -2136,8 +2136,8 @@ void Gambit_fn_020CF58C(CPUState* cpu) {
         /* 020CF628 */ cpu->r[3] = cpu->r[31];
         /* 020CF62C */ cpu->r[4] = cpu->r[1] + 0x00000008u;
         /* 020CF630 */ Gambit_fn_02800CA8(cpu);
-        /* 020CF634 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CF638 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CF634 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CF638 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CF638 */ _t20 = _t19 & 0x00000001u;
         /* 020CF638 */ if (_t20) goto L_020CF648; else goto L_020CF63C;
   L_020CF63C: ; // 0x20cf63c
@@ -2182,10 +2182,10 @@ void Gambit_fn_020CF590(CPUState* cpu) {
         /* 020CF5C0 */ cpu->r[31] = cpu->r[3];
         /* 020CF5C4 */ _t7 = cpu->r[1] + 0x00000033u;
         /* 020CF5C4 */ rbrew_write8(cpu->mem, _t7, (uint8_t)cpu->r[12]);
-        /* 020CF5C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 020CF5C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 020CF5CC */ _t8 = cpu->r[1] + 0x00000014u;
         /* 020CF5CC */ rbrew_write8(cpu->mem, _t8, (uint8_t)cpu->r[12]);
-        /* 020CF5D0 */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CF5D0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CF5D0 */ _t10 = _t9 & 0x00000001u;
         /* 020CF5D0 */ if (_t10) goto L_020CF5D4; else goto L_020CF604;
   L_020CF5D4: ; // 0x20cf5d4
@@ -2193,7 +2193,7 @@ void Gambit_fn_020CF590(CPUState* cpu) {
         /* 020CF5D8 */ cpu->r[5] = 0x00000000u;
         /* 020CF5DC */ cpu->r[4] = cpu->r[4] + 0x000074F0u;
         /* 020CF5E0 */ cpu->r[3] = cpu->r[1] + 0x00000008u;
-        /* 020CF5E4 */ _t11 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020CF5E4 */ _t11 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020CF5E4 */ _t12 = _t11 & 0x00000001u;
         /* 020CF5E4 */ if (_t12) goto L_020CF5E8; // else: addr-0 trap, fall-through
   L_020CF5E8: ; // 0x20cf5e8
@@ -2201,15 +2201,15 @@ void Gambit_fn_020CF590(CPUState* cpu) {
         /* 020CF5EC */ cpu->r[3] = cpu->r[31];
         /* 020CF5F0 */ cpu->r[4] = cpu->r[1] + 0x00000008u;
         /* 020CF5F4 */ Gambit_fn_02800CA8(cpu);
-        /* 020CF5F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CF5FC */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CF5F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CF5FC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CF5FC */ _t14 = _t13 & 0x00000001u;
         /* 020CF5FC */ if (_t14) goto L_020CF600; else goto L_020CF63C;
   L_020CF600: ; // 0x20cf600
         /* 020CF600 */ goto L_020CF648;
   L_020CF604: ; // 0x20cf604
-        /* 020CF604 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000003u);
-        /* 020CF608 */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CF604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000003u));
+        /* 020CF608 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CF608 */ _t16 = _t15 & 0x00000001u;
         /* 020CF608 */ if (_t16) goto L_020CF60C; else goto L_020CF610;
   L_020CF60C: ; // 0x20cf60c
@@ -2219,7 +2219,7 @@ void Gambit_fn_020CF590(CPUState* cpu) {
         /* 020CF614 */ cpu->r[4] = 0x10010000u;
         /* 020CF618 */ cpu->r[3] = cpu->r[1] + 0x00000008u;
         /* 020CF61C */ cpu->r[4] = cpu->r[4] + 0x000074F0u;
-        /* 020CF620 */ _t17 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020CF620 */ _t17 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020CF620 */ _t18 = _t17 & 0x00000001u;
         /* 020CF620 */ if (_t18) goto L_020CF624; // else: addr-0 trap, fall-through
   L_020CF624: ; // 0x20cf624
@@ -2227,8 +2227,8 @@ void Gambit_fn_020CF590(CPUState* cpu) {
         /* 020CF628 */ cpu->r[3] = cpu->r[31];
         /* 020CF62C */ cpu->r[4] = cpu->r[1] + 0x00000008u;
         /* 020CF630 */ Gambit_fn_02800CA8(cpu);
-        /* 020CF634 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CF638 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CF634 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CF638 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CF638 */ _t20 = _t19 & 0x00000001u;
         /* 020CF638 */ if (_t20) goto L_020CF648; else goto L_020CF63C;
   L_020CF63C: ; // 0x20cf63c
@@ -2274,10 +2274,10 @@ void Gambit_fn_020CF65C(CPUState* cpu) {
         /* 020CF690 */ cpu->r[31] = cpu->r[3];
         /* 020CF694 */ _t7 = cpu->r[1] + 0x00000033u;
         /* 020CF694 */ rbrew_write8(cpu->mem, _t7, (uint8_t)cpu->r[12]);
-        /* 020CF698 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 020CF698 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 020CF69C */ _t8 = cpu->r[1] + 0x00000014u;
         /* 020CF69C */ rbrew_write8(cpu->mem, _t8, (uint8_t)cpu->r[12]);
-        /* 020CF6A0 */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CF6A0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CF6A0 */ _t10 = _t9 & 0x00000001u;
         /* 020CF6A0 */ if (_t10) goto L_020CF6A4; else goto L_020CF6D4;
   L_020CF6A4: ; // 0x20cf6a4
@@ -2285,7 +2285,7 @@ void Gambit_fn_020CF65C(CPUState* cpu) {
         /* 020CF6A8 */ cpu->r[5] = 0x00000000u;
         /* 020CF6AC */ cpu->r[4] = cpu->r[4] + 0x00007500u;
         /* 020CF6B0 */ cpu->r[3] = cpu->r[1] + 0x00000008u;
-        /* 020CF6B4 */ _t11 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020CF6B4 */ _t11 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020CF6B4 */ _t12 = _t11 & 0x00000001u;
         /* 020CF6B4 */ if (_t12) goto L_020CF6B8; // else: addr-0 trap, fall-through
   L_020CF6B8: ; // 0x20cf6b8
@@ -2293,15 +2293,15 @@ void Gambit_fn_020CF65C(CPUState* cpu) {
         /* 020CF6BC */ cpu->r[3] = cpu->r[31];
         /* 020CF6C0 */ cpu->r[4] = cpu->r[1] + 0x00000008u;
         /* 020CF6C4 */ Gambit_fn_02800CA8(cpu);
-        /* 020CF6C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CF6CC */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CF6C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CF6CC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CF6CC */ _t14 = _t13 & 0x00000001u;
         /* 020CF6CC */ if (_t14) goto L_020CF6D0; else goto L_020CF70C;
   L_020CF6D0: ; // 0x20cf6d0
         /* 020CF6D0 */ goto L_020CF718;
   L_020CF6D4: ; // 0x20cf6d4
-        /* 020CF6D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000003u);
-        /* 020CF6D8 */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CF6D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000003u));
+        /* 020CF6D8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CF6D8 */ _t16 = _t15 & 0x00000001u;
         /* 020CF6D8 */ if (_t16) goto L_020CF6DC; else goto L_020CF6E0;
   L_020CF6DC: ; // 0x20cf6dc
@@ -2311,7 +2311,7 @@ void Gambit_fn_020CF65C(CPUState* cpu) {
         /* 020CF6E4 */ cpu->r[4] = 0x10010000u;
         /* 020CF6E8 */ cpu->r[3] = cpu->r[1] + 0x00000008u;
         /* 020CF6EC */ cpu->r[4] = cpu->r[4] + 0x00007500u;
-        /* 020CF6F0 */ _t17 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020CF6F0 */ _t17 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020CF6F0 */ _t18 = _t17 & 0x00000001u;
         /* 020CF6F0 */ if (_t18) goto L_020CF6F4; // else: addr-0 trap, fall-through
   L_020CF6F4: ; // 0x20cf6f4
@@ -2319,8 +2319,8 @@ void Gambit_fn_020CF65C(CPUState* cpu) {
         /* 020CF6F8 */ cpu->r[3] = cpu->r[31];
         /* 020CF6FC */ cpu->r[4] = cpu->r[1] + 0x00000008u;
         /* 020CF700 */ Gambit_fn_02800CA8(cpu);
-        /* 020CF704 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CF708 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CF704 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CF708 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CF708 */ _t20 = _t19 & 0x00000001u;
         /* 020CF708 */ if (_t20) goto L_020CF718; else goto L_020CF70C;
   L_020CF70C: ; // 0x20cf70c
@@ -2365,10 +2365,10 @@ void Gambit_fn_020CF660(CPUState* cpu) {
         /* 020CF690 */ cpu->r[31] = cpu->r[3];
         /* 020CF694 */ _t7 = cpu->r[1] + 0x00000033u;
         /* 020CF694 */ rbrew_write8(cpu->mem, _t7, (uint8_t)cpu->r[12]);
-        /* 020CF698 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 020CF698 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 020CF69C */ _t8 = cpu->r[1] + 0x00000014u;
         /* 020CF69C */ rbrew_write8(cpu->mem, _t8, (uint8_t)cpu->r[12]);
-        /* 020CF6A0 */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CF6A0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CF6A0 */ _t10 = _t9 & 0x00000001u;
         /* 020CF6A0 */ if (_t10) goto L_020CF6A4; else goto L_020CF6D4;
   L_020CF6A4: ; // 0x20cf6a4
@@ -2376,7 +2376,7 @@ void Gambit_fn_020CF660(CPUState* cpu) {
         /* 020CF6A8 */ cpu->r[5] = 0x00000000u;
         /* 020CF6AC */ cpu->r[4] = cpu->r[4] + 0x00007500u;
         /* 020CF6B0 */ cpu->r[3] = cpu->r[1] + 0x00000008u;
-        /* 020CF6B4 */ _t11 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020CF6B4 */ _t11 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020CF6B4 */ _t12 = _t11 & 0x00000001u;
         /* 020CF6B4 */ if (_t12) goto L_020CF6B8; // else: addr-0 trap, fall-through
   L_020CF6B8: ; // 0x20cf6b8
@@ -2384,15 +2384,15 @@ void Gambit_fn_020CF660(CPUState* cpu) {
         /* 020CF6BC */ cpu->r[3] = cpu->r[31];
         /* 020CF6C0 */ cpu->r[4] = cpu->r[1] + 0x00000008u;
         /* 020CF6C4 */ Gambit_fn_02800CA8(cpu);
-        /* 020CF6C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CF6CC */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CF6C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CF6CC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CF6CC */ _t14 = _t13 & 0x00000001u;
         /* 020CF6CC */ if (_t14) goto L_020CF6D0; else goto L_020CF70C;
   L_020CF6D0: ; // 0x20cf6d0
         /* 020CF6D0 */ goto L_020CF718;
   L_020CF6D4: ; // 0x20cf6d4
-        /* 020CF6D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000003u);
-        /* 020CF6D8 */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CF6D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000003u));
+        /* 020CF6D8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CF6D8 */ _t16 = _t15 & 0x00000001u;
         /* 020CF6D8 */ if (_t16) goto L_020CF6DC; else goto L_020CF6E0;
   L_020CF6DC: ; // 0x20cf6dc
@@ -2402,7 +2402,7 @@ void Gambit_fn_020CF660(CPUState* cpu) {
         /* 020CF6E4 */ cpu->r[4] = 0x10010000u;
         /* 020CF6E8 */ cpu->r[3] = cpu->r[1] + 0x00000008u;
         /* 020CF6EC */ cpu->r[4] = cpu->r[4] + 0x00007500u;
-        /* 020CF6F0 */ _t17 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020CF6F0 */ _t17 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020CF6F0 */ _t18 = _t17 & 0x00000001u;
         /* 020CF6F0 */ if (_t18) goto L_020CF6F4; // else: addr-0 trap, fall-through
   L_020CF6F4: ; // 0x20cf6f4
@@ -2410,8 +2410,8 @@ void Gambit_fn_020CF660(CPUState* cpu) {
         /* 020CF6F8 */ cpu->r[3] = cpu->r[31];
         /* 020CF6FC */ cpu->r[4] = cpu->r[1] + 0x00000008u;
         /* 020CF700 */ Gambit_fn_02800CA8(cpu);
-        /* 020CF704 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CF708 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CF704 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CF708 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CF708 */ _t20 = _t19 & 0x00000001u;
         /* 020CF708 */ if (_t20) goto L_020CF718; else goto L_020CF70C;
   L_020CF70C: ; // 0x20cf70c
@@ -2458,10 +2458,10 @@ void Gambit_fn_020CF72C(CPUState* cpu) {
         /* 020CF764 */ _t7 = cpu->r[1] + 0x00000033u;
         /* 020CF764 */ rbrew_write8(cpu->mem, _t7, (uint8_t)cpu->r[12]);
         /* 020CF768 */ cpu->r[6] = cpu->r[5];
-        /* 020CF768 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 020CF768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 020CF76C */ _t8 = cpu->r[1] + 0x0000000Cu;
         /* 020CF76C */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
-        /* 020CF770 */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CF770 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CF770 */ _t10 = _t9 & 0x00000001u;
         /* 020CF770 */ if (_t10) goto L_020CF774; else goto L_020CF7A8;
   L_020CF774: ; // 0x20cf774
@@ -2470,7 +2470,7 @@ void Gambit_fn_020CF72C(CPUState* cpu) {
         /* 020CF77C */ cpu->r[3] = cpu->r[1] + 0x00000008u;
         /* 020CF780 */ cpu->r[4] = cpu->r[4] + 0x00007510u;
         /* 020CF784 */ cpu->r[6] = 0x00000000u;
-        /* 020CF788 */ _t11 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020CF788 */ _t11 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020CF788 */ _t12 = _t11 & 0x00000001u;
         /* 020CF788 */ if (_t12) goto L_020CF78C; // else: addr-0 trap, fall-through
   L_020CF78C: ; // 0x20cf78c
@@ -2478,15 +2478,15 @@ void Gambit_fn_020CF72C(CPUState* cpu) {
         /* 020CF790 */ cpu->r[3] = cpu->r[31];
         /* 020CF794 */ cpu->r[4] = cpu->r[1] + 0x00000008u;
         /* 020CF798 */ Gambit_fn_02800CA8(cpu);
-        /* 020CF79C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CF7A0 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CF79C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CF7A0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CF7A0 */ _t14 = _t13 & 0x00000001u;
         /* 020CF7A0 */ if (_t14) goto L_020CF7A4; else goto L_020CF7E0;
   L_020CF7A4: ; // 0x20cf7a4
         /* 020CF7A4 */ goto L_020CF7EC;
   L_020CF7A8: ; // 0x20cf7a8
-        /* 020CF7A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000003u);
-        /* 020CF7AC */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CF7A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000003u));
+        /* 020CF7AC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CF7AC */ _t16 = _t15 & 0x00000001u;
         /* 020CF7AC */ if (_t16) goto L_020CF7B0; else goto L_020CF7B4;
   L_020CF7B0: ; // 0x20cf7b0
@@ -2496,7 +2496,7 @@ void Gambit_fn_020CF72C(CPUState* cpu) {
         /* 020CF7B8 */ cpu->r[4] = 0x10010000u;
         /* 020CF7BC */ cpu->r[3] = cpu->r[1] + 0x00000008u;
         /* 020CF7C0 */ cpu->r[4] = cpu->r[4] + 0x00007510u;
-        /* 020CF7C4 */ _t17 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020CF7C4 */ _t17 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020CF7C4 */ _t18 = _t17 & 0x00000001u;
         /* 020CF7C4 */ if (_t18) goto L_020CF7C8; // else: addr-0 trap, fall-through
   L_020CF7C8: ; // 0x20cf7c8
@@ -2504,8 +2504,8 @@ void Gambit_fn_020CF72C(CPUState* cpu) {
         /* 020CF7CC */ cpu->r[3] = cpu->r[31];
         /* 020CF7D0 */ cpu->r[4] = cpu->r[1] + 0x00000008u;
         /* 020CF7D4 */ Gambit_fn_02800CA8(cpu);
-        /* 020CF7D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CF7DC */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CF7D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CF7DC */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CF7DC */ _t20 = _t19 & 0x00000001u;
         /* 020CF7DC */ if (_t20) goto L_020CF7EC; else goto L_020CF7E0;
   L_020CF7E0: ; // 0x20cf7e0
@@ -2549,10 +2549,10 @@ void Gambit_fn_020CF738(CPUState* cpu) {
         /* 020CF764 */ _t7 = cpu->r[1] + 0x00000033u;
         /* 020CF764 */ rbrew_write8(cpu->mem, _t7, (uint8_t)cpu->r[12]);
         /* 020CF768 */ cpu->r[6] = cpu->r[5];
-        /* 020CF768 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 020CF768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 020CF76C */ _t8 = cpu->r[1] + 0x0000000Cu;
         /* 020CF76C */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
-        /* 020CF770 */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CF770 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CF770 */ _t10 = _t9 & 0x00000001u;
         /* 020CF770 */ if (_t10) goto L_020CF774; else goto L_020CF7A8;
   L_020CF774: ; // 0x20cf774
@@ -2561,7 +2561,7 @@ void Gambit_fn_020CF738(CPUState* cpu) {
         /* 020CF77C */ cpu->r[3] = cpu->r[1] + 0x00000008u;
         /* 020CF780 */ cpu->r[4] = cpu->r[4] + 0x00007510u;
         /* 020CF784 */ cpu->r[6] = 0x00000000u;
-        /* 020CF788 */ _t11 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020CF788 */ _t11 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020CF788 */ _t12 = _t11 & 0x00000001u;
         /* 020CF788 */ if (_t12) goto L_020CF78C; // else: addr-0 trap, fall-through
   L_020CF78C: ; // 0x20cf78c
@@ -2569,15 +2569,15 @@ void Gambit_fn_020CF738(CPUState* cpu) {
         /* 020CF790 */ cpu->r[3] = cpu->r[31];
         /* 020CF794 */ cpu->r[4] = cpu->r[1] + 0x00000008u;
         /* 020CF798 */ Gambit_fn_02800CA8(cpu);
-        /* 020CF79C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CF7A0 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CF79C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CF7A0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CF7A0 */ _t14 = _t13 & 0x00000001u;
         /* 020CF7A0 */ if (_t14) goto L_020CF7A4; else goto L_020CF7E0;
   L_020CF7A4: ; // 0x20cf7a4
         /* 020CF7A4 */ goto L_020CF7EC;
   L_020CF7A8: ; // 0x20cf7a8
-        /* 020CF7A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000003u);
-        /* 020CF7AC */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CF7A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000003u));
+        /* 020CF7AC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CF7AC */ _t16 = _t15 & 0x00000001u;
         /* 020CF7AC */ if (_t16) goto L_020CF7B0; else goto L_020CF7B4;
   L_020CF7B0: ; // 0x20cf7b0
@@ -2587,7 +2587,7 @@ void Gambit_fn_020CF738(CPUState* cpu) {
         /* 020CF7B8 */ cpu->r[4] = 0x10010000u;
         /* 020CF7BC */ cpu->r[3] = cpu->r[1] + 0x00000008u;
         /* 020CF7C0 */ cpu->r[4] = cpu->r[4] + 0x00007510u;
-        /* 020CF7C4 */ _t17 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020CF7C4 */ _t17 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020CF7C4 */ _t18 = _t17 & 0x00000001u;
         /* 020CF7C4 */ if (_t18) goto L_020CF7C8; // else: addr-0 trap, fall-through
   L_020CF7C8: ; // 0x20cf7c8
@@ -2595,8 +2595,8 @@ void Gambit_fn_020CF738(CPUState* cpu) {
         /* 020CF7CC */ cpu->r[3] = cpu->r[31];
         /* 020CF7D0 */ cpu->r[4] = cpu->r[1] + 0x00000008u;
         /* 020CF7D4 */ Gambit_fn_02800CA8(cpu);
-        /* 020CF7D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CF7DC */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CF7D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CF7DC */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CF7DC */ _t20 = _t19 & 0x00000001u;
         /* 020CF7DC */ if (_t20) goto L_020CF7EC; else goto L_020CF7E0;
   L_020CF7E0: ; // 0x20cf7e0
@@ -2662,8 +2662,8 @@ void Gambit_fn_020CF800(CPUState* cpu) {
         /* 020CF868 */ rbrew_write32(cpu->mem, _t13, cpu->r[31]);
         /* 020CF86C */ cpu->r[29] = cpu->r[3];
         /* 020CF870 */ Gambit_fn_027EE100(cpu);
-        /* 020CF874 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[1]);
-        /* 020CF878 */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CF874 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[1]));
+        /* 020CF878 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CF878 */ _t15 = _t14 & 0x00000001u;
         /* 020CF878 */ if (_t15) goto L_020CF87C; else goto L_020CF880;
   L_020CF87C: ; // 0x20cf87c
@@ -2679,8 +2679,8 @@ void Gambit_fn_020CF800(CPUState* cpu) {
         /* 020CF894 */ _t18 = cpu->r[1] + 0x00000008u;
         /* 020CF894 */ rbrew_write32(cpu->mem, _t18, cpu->r[31]);
         /* 020CF898 */ Gambit_fn_027ED914(cpu);
-        /* 020CF89C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 020CF8A0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CF89C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 020CF8A0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CF8A0 */ _t20 = _t19 & 0x00000001u;
         /* 020CF8A0 */ if (_t20) goto L_020CF8B0; else goto L_020CF8A4;
   L_020CF8A4: ; // 0x20cf8a4
@@ -2701,7 +2701,7 @@ void Gambit_fn_020CF800(CPUState* cpu) {
         /* 020CF8C0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t26);
         /* 020CF8C4 */ _t27 = cpu->r[1] + 0x00000024u;
         /* 020CF8C4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t27);
-        /* 020CF8C8 */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CF8C8 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CF8C8 */ _t29 = _t28 & 0x00000001u;
         /* 020CF8C8 */ if (_t29) goto L_020CF8CC; // else: addr-0 trap, fall-through
   L_020CF8CC: ; // 0x20cf8cc
@@ -2759,8 +2759,8 @@ void Gambit_fn_020CF808(CPUState* cpu) {
         /* 020CF868 */ rbrew_write32(cpu->mem, _t13, cpu->r[31]);
         /* 020CF86C */ cpu->r[29] = cpu->r[3];
         /* 020CF870 */ Gambit_fn_027EE100(cpu);
-        /* 020CF874 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[1]);
-        /* 020CF878 */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CF874 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[1]));
+        /* 020CF878 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CF878 */ _t15 = _t14 & 0x00000001u;
         /* 020CF878 */ if (_t15) goto L_020CF87C; else goto L_020CF880;
   L_020CF87C: ; // 0x20cf87c
@@ -2776,8 +2776,8 @@ void Gambit_fn_020CF808(CPUState* cpu) {
         /* 020CF894 */ _t18 = cpu->r[1] + 0x00000008u;
         /* 020CF894 */ rbrew_write32(cpu->mem, _t18, cpu->r[31]);
         /* 020CF898 */ Gambit_fn_027ED914(cpu);
-        /* 020CF89C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 020CF8A0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CF89C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 020CF8A0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CF8A0 */ _t20 = _t19 & 0x00000001u;
         /* 020CF8A0 */ if (_t20) goto L_020CF8B0; else goto L_020CF8A4;
   L_020CF8A4: ; // 0x20cf8a4
@@ -2798,7 +2798,7 @@ void Gambit_fn_020CF808(CPUState* cpu) {
         /* 020CF8C0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t26);
         /* 020CF8C4 */ _t27 = cpu->r[1] + 0x00000024u;
         /* 020CF8C4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t27);
-        /* 020CF8C8 */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CF8C8 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CF8C8 */ _t29 = _t28 & 0x00000001u;
         /* 020CF8C8 */ if (_t29) goto L_020CF8CC; // else: addr-0 trap, fall-through
   L_020CF8CC: ; // 0x20cf8cc
@@ -2838,13 +2838,13 @@ void Gambit_fn_020CF8DC(CPUState* cpu) {
         /* 020CF910 */ Gambit_fn_027F76D0(cpu);
         /* 020CF914 */ _t7 = cpu->r[1] + 0x00000008u;
         /* 020CF914 */ cpu->r[4] = rbrew_read32(cpu->mem, _t7);
-        /* 020CF918 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020CF91C */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CF918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020CF91C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CF91C */ _t9 = _t8 & 0x00000001u;
         /* 020CF91C */ if (_t9) goto L_020CF934; else goto L_020CF920;
   L_020CF920: ; // 0x20cf920
-        /* 020CF920 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CF924 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CF920 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CF924 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CF924 */ _t11 = _t10 & 0x00000001u;
         /* 020CF924 */ if (_t11) goto L_020CF934; else goto L_020CF928;
   L_020CF928: ; // 0x20cf928
@@ -2891,13 +2891,13 @@ void Gambit_fn_020CF8E0(CPUState* cpu) {
         /* 020CF910 */ Gambit_fn_027F76D0(cpu);
         /* 020CF914 */ _t7 = cpu->r[1] + 0x00000008u;
         /* 020CF914 */ cpu->r[4] = rbrew_read32(cpu->mem, _t7);
-        /* 020CF918 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020CF91C */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CF918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020CF91C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CF91C */ _t9 = _t8 & 0x00000001u;
         /* 020CF91C */ if (_t9) goto L_020CF934; else goto L_020CF920;
   L_020CF920: ; // 0x20cf920
-        /* 020CF920 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CF924 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CF920 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CF924 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CF924 */ _t11 = _t10 & 0x00000001u;
         /* 020CF924 */ if (_t11) goto L_020CF934; else goto L_020CF928;
   L_020CF928: ; // 0x20cf928
@@ -2937,12 +2937,12 @@ void Gambit_fn_020CF94C(CPUState* cpu) {
         /* 020CF968 */ rbrew_write_f32(cpu->mem, _t4, cpu->f[31]);
         /* 020CF96C */ _t5 = cpu->r[1] + 0x00000064u;
         /* 020CF96C */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
-        /* 020CF970 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000064u);
+        /* 020CF970 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000064u));
         /* 020CF974 */ /* nop */
         /* 020CF978 */ cpu->r[29] = cpu->r[3];
         /* 020CF97C */ cpu->r[30] = cpu->r[5];
         /* 020CF980 */ cpu->r[31] = cpu->r[6];
-        /* 020CF984 */ _t6 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CF984 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CF984 */ _t7 = _t6 & 0x00000001u;
         /* 020CF984 */ if (_t7) goto L_020CF9EC; else goto L_020CF988;
   L_020CF988: ; // 0x20cf988
@@ -2975,8 +2975,8 @@ void Gambit_fn_020CF94C(CPUState* cpu) {
         /* 020CF9D4 */ cpu->r[3] = cpu->r[29];
         /* 020CF9D8 */ cpu->f[31] = cpu->f[13] + cpu->f[0];
         /* 020CF9DC */ Gambit_fn_027EE100(cpu);
-        /* 020CF9E0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[1]);
-        /* 020CF9E4 */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CF9E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[1]));
+        /* 020CF9E4 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CF9E4 */ _t16 = _t15 & 0x00000001u;
         /* 020CF9E4 */ if (_t16) goto L_020CFA40; else goto L_020CF9E8;
   L_020CF9E8: ; // 0x20cf9e8
@@ -3007,8 +3007,8 @@ void Gambit_fn_020CF94C(CPUState* cpu) {
         /* 020CFA30 */ _t22 = cpu->r[1] + 0x00000008u;
         /* 020CFA30 */ rbrew_write32(cpu->mem, _t22, cpu->r[28]);
         /* 020CFA34 */ Gambit_fn_027EE100(cpu);
-        /* 020CFA38 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[1]);
-        /* 020CFA3C */ _t23 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CFA38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[1]));
+        /* 020CFA3C */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CFA3C */ _t24 = _t23 & 0x00000001u;
         /* 020CFA3C */ if (_t24) goto L_020CFA40; else goto L_020CFA44;
   L_020CFA40: ; // 0x20cfa40
@@ -3026,9 +3026,9 @@ void Gambit_fn_020CF94C(CPUState* cpu) {
         /* 020CFA5C */ Gambit_fn_027ED914(cpu);
         /* 020CFA60 */ cpu->r[0] = 0x10010000u;
         /* 020CFA64 */ cpu->r[3] = cpu->r[29];
-        /* 020CFA68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020CFA68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020CFA6C */ cpu->r[0] = cpu->r[0] + 0x0000753Cu;
-        /* 020CFA70 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CFA70 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CFA70 */ _t29 = _t28 & 0x00000001u;
         /* 020CFA70 */ if (_t29) goto L_020CFA98; else goto L_020CFA74;
   L_020CFA74: ; // 0x20cfa74
@@ -3041,8 +3041,8 @@ void Gambit_fn_020CF94C(CPUState* cpu) {
         /* 020CFA84 */ _t32 = cpu->r[1] + 0x00000018u;
         /* 020CFA84 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
         /* 020CFA88 */ Gambit_fn_027ED624(cpu);
-        /* 020CFA8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 020CFA90 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CFA8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 020CFA90 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CFA90 */ _t34 = _t33 & 0x00000001u;
         /* 020CFA90 */ if (_t34) goto L_020CFAD4; else goto L_020CFA94;
   L_020CFA94: ; // 0x20cfa94
@@ -3057,8 +3057,8 @@ void Gambit_fn_020CF94C(CPUState* cpu) {
         /* 020CFAA8 */ _t37 = cpu->r[1] + 0x00000020u;
         /* 020CFAA8 */ rbrew_write32(cpu->mem, _t37, cpu->r[0]);
         /* 020CFAAC */ Gambit_fn_027ED798(cpu);
-        /* 020CFAB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 020CFAB4 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CFAB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 020CFAB4 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CFAB4 */ _t39 = _t38 & 0x00000001u;
         /* 020CFAB4 */ if (_t39) goto L_020CFAD4; else goto L_020CFAB8;
   L_020CFAB8: ; // 0x20cfab8
@@ -3081,7 +3081,7 @@ void Gambit_fn_020CF94C(CPUState* cpu) {
         /* 020CFAE0 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t44);
         /* 020CFAE4 */ _t45 = cpu->r[1] + 0x00000050u;
         /* 020CFAE4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t45);
-        /* 020CFAE8 */ _t46 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CFAE8 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CFAE8 */ _t47 = _t46 & 0x00000001u;
         /* 020CFAE8 */ if (_t47) goto L_020CFAEC; // else: addr-0 trap, fall-through
   L_020CFAEC: ; // 0x20cfaec
@@ -3112,12 +3112,12 @@ void Gambit_fn_020CF950(CPUState* cpu) {
         /* 020CF968 */ rbrew_write_f32(cpu->mem, _t4, cpu->f[31]);
         /* 020CF96C */ _t5 = cpu->r[1] + 0x00000064u;
         /* 020CF96C */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
-        /* 020CF970 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000064u);
+        /* 020CF970 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000064u));
         /* 020CF974 */ /* nop */
         /* 020CF978 */ cpu->r[29] = cpu->r[3];
         /* 020CF97C */ cpu->r[30] = cpu->r[5];
         /* 020CF980 */ cpu->r[31] = cpu->r[6];
-        /* 020CF984 */ _t6 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CF984 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CF984 */ _t7 = _t6 & 0x00000001u;
         /* 020CF984 */ if (_t7) goto L_020CF9EC; else goto L_020CF988;
   L_020CF988: ; // 0x20cf988
@@ -3150,8 +3150,8 @@ void Gambit_fn_020CF950(CPUState* cpu) {
         /* 020CF9D4 */ cpu->r[3] = cpu->r[29];
         /* 020CF9D8 */ cpu->f[31] = cpu->f[13] + cpu->f[0];
         /* 020CF9DC */ Gambit_fn_027EE100(cpu);
-        /* 020CF9E0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[1]);
-        /* 020CF9E4 */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CF9E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[1]));
+        /* 020CF9E4 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CF9E4 */ _t16 = _t15 & 0x00000001u;
         /* 020CF9E4 */ if (_t16) goto L_020CFA40; else goto L_020CF9E8;
   L_020CF9E8: ; // 0x20cf9e8
@@ -3182,8 +3182,8 @@ void Gambit_fn_020CF950(CPUState* cpu) {
         /* 020CFA30 */ _t22 = cpu->r[1] + 0x00000008u;
         /* 020CFA30 */ rbrew_write32(cpu->mem, _t22, cpu->r[28]);
         /* 020CFA34 */ Gambit_fn_027EE100(cpu);
-        /* 020CFA38 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[1]);
-        /* 020CFA3C */ _t23 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CFA38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[1]));
+        /* 020CFA3C */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CFA3C */ _t24 = _t23 & 0x00000001u;
         /* 020CFA3C */ if (_t24) goto L_020CFA40; else goto L_020CFA44;
   L_020CFA40: ; // 0x20cfa40
@@ -3201,9 +3201,9 @@ void Gambit_fn_020CF950(CPUState* cpu) {
         /* 020CFA5C */ Gambit_fn_027ED914(cpu);
         /* 020CFA60 */ cpu->r[0] = 0x10010000u;
         /* 020CFA64 */ cpu->r[3] = cpu->r[29];
-        /* 020CFA68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020CFA68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020CFA6C */ cpu->r[0] = cpu->r[0] + 0x0000753Cu;
-        /* 020CFA70 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CFA70 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CFA70 */ _t29 = _t28 & 0x00000001u;
         /* 020CFA70 */ if (_t29) goto L_020CFA98; else goto L_020CFA74;
   L_020CFA74: ; // 0x20cfa74
@@ -3216,8 +3216,8 @@ void Gambit_fn_020CF950(CPUState* cpu) {
         /* 020CFA84 */ _t32 = cpu->r[1] + 0x00000018u;
         /* 020CFA84 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
         /* 020CFA88 */ Gambit_fn_027ED624(cpu);
-        /* 020CFA8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 020CFA90 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CFA8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 020CFA90 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CFA90 */ _t34 = _t33 & 0x00000001u;
         /* 020CFA90 */ if (_t34) goto L_020CFAD4; else goto L_020CFA94;
   L_020CFA94: ; // 0x20cfa94
@@ -3232,8 +3232,8 @@ void Gambit_fn_020CF950(CPUState* cpu) {
         /* 020CFAA8 */ _t37 = cpu->r[1] + 0x00000020u;
         /* 020CFAA8 */ rbrew_write32(cpu->mem, _t37, cpu->r[0]);
         /* 020CFAAC */ Gambit_fn_027ED798(cpu);
-        /* 020CFAB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 020CFAB4 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CFAB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 020CFAB4 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CFAB4 */ _t39 = _t38 & 0x00000001u;
         /* 020CFAB4 */ if (_t39) goto L_020CFAD4; else goto L_020CFAB8;
   L_020CFAB8: ; // 0x20cfab8
@@ -3256,7 +3256,7 @@ void Gambit_fn_020CF950(CPUState* cpu) {
         /* 020CFAE0 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t44);
         /* 020CFAE4 */ _t45 = cpu->r[1] + 0x00000050u;
         /* 020CFAE4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t45);
-        /* 020CFAE8 */ _t46 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CFAE8 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CFAE8 */ _t47 = _t46 & 0x00000001u;
         /* 020CFAE8 */ if (_t47) goto L_020CFAEC; // else: addr-0 trap, fall-through
   L_020CFAEC: ; // 0x20cfaec
@@ -3359,27 +3359,27 @@ void Gambit_fn_020CFB48(CPUState* cpu) {
         /* 020CFB74 */ rbrew_write32(cpu->mem, _t8, cpu->r[29]);
         /* 020CFB78 */ _t9 = cpu->r[4] + 0x00000000u;
         /* 020CFB78 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 020CFB7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
+        /* 020CFB7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
         /* 020CFB80 */ cpu->r[31] = cpu->r[3];
-        /* 020CFB84 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CFB84 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CFB84 */ _t11 = _t10 & 0x00000001u;
         /* 020CFB84 */ if (_t11) goto L_020CFD30; else goto L_020CFB88;
   L_020CFB88: ; // 0x20cfb88
         /* 020CFB88 */ cpu->r[8] = 0x10010000u;
         /* 020CFB8C */ _t12 = cpu->r[8] + 0x0000744Cu;
         /* 020CFB8C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t12);
-        /* 020CFB90 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 020CFB90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 020CFB94 */ cpu->f[31] = cpu->f[0];
-        /* 020CFB98 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CFB98 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CFB98 */ _t14 = _t13 & 0x00000001u;
         /* 020CFB98 */ if (_t14) goto L_020CFB9C; else goto L_020CFBB4;
   L_020CFB9C: ; // 0x20cfb9c
-        /* 020CFB9C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
-        /* 020CFBA0 */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CFB9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
+        /* 020CFBA0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CFBA0 */ _t16 = _t15 & 0x00000001u;
         /* 020CFBA0 */ if (_t16) goto L_020CFBFC; else goto L_020CFBA4;
   L_020CFBA4: ; // 0x20cfba4
-        /* 020CFBA4 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CFBA4 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CFBA4 */ _t18 = _t17 & 0x00000001u;
         /* 020CFBA4 */ if (_t18) goto L_020CFC30; else goto L_020CFBA8;
   L_020CFBA8: ; // 0x20cfba8
@@ -3388,17 +3388,17 @@ void Gambit_fn_020CFB48(CPUState* cpu) {
         /* 020CFBAC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t19);
         /* 020CFBB0 */ goto L_020CFCE0;
   L_020CFBB4: ; // 0x20cfbb4
-        /* 020CFBB4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000004u);
-        /* 020CFBB8 */ _t20 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CFBB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000004u));
+        /* 020CFBB8 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CFBB8 */ _t21 = _t20 & 0x00000001u;
         /* 020CFBB8 */ if (_t21) goto L_020CFCA0; else goto L_020CFBBC;
   L_020CFBBC: ; // 0x20cfbbc
-        /* 020CFBBC */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CFBBC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CFBBC */ _t23 = _t22 & 0x00000001u;
         /* 020CFBBC */ if (_t23) goto L_020CFC68; else goto L_020CFBC0;
   L_020CFBC0: ; // 0x20cfbc0
-        /* 020CFBC0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
-        /* 020CFBC4 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CFBC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
+        /* 020CFBC4 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CFBC4 */ _t25 = _t24 & 0x00000001u;
         /* 020CFBC4 */ if (_t25) goto L_020CFCD8; else goto L_020CFBC8;
   L_020CFBC8: ; // 0x20cfbc8
@@ -3414,8 +3414,8 @@ void Gambit_fn_020CFB48(CPUState* cpu) {
         /* 020CFBE8 */ _t27 = cpu->r[1] + 0x00000008u;
         /* 020CFBE8 */ rbrew_write32(cpu->mem, _t27, cpu->r[29]);
         /* 020CFBEC */ Gambit_fn_027EE100(cpu);
-        /* 020CFBF0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[1]);
-        /* 020CFBF4 */ _t28 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CFBF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[1]));
+        /* 020CFBF4 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CFBF4 */ _t29 = _t28 & 0x00000001u;
         /* 020CFBF4 */ if (_t29) goto L_020CFD10; else goto L_020CFBF8;
   L_020CFBF8: ; // 0x20cfbf8
@@ -3433,8 +3433,8 @@ void Gambit_fn_020CFB48(CPUState* cpu) {
         /* 020CFC1C */ _t31 = cpu->r[1] + 0x00000008u;
         /* 020CFC1C */ rbrew_write32(cpu->mem, _t31, cpu->r[29]);
         /* 020CFC20 */ Gambit_fn_027EE100(cpu);
-        /* 020CFC24 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[1]);
-        /* 020CFC28 */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CFC24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[1]));
+        /* 020CFC28 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CFC28 */ _t33 = _t32 & 0x00000001u;
         /* 020CFC28 */ if (_t33) goto L_020CFD10; else goto L_020CFC2C;
   L_020CFC2C: ; // 0x20cfc2c
@@ -3454,8 +3454,8 @@ void Gambit_fn_020CFB48(CPUState* cpu) {
         /* 020CFC54 */ _t36 = cpu->r[1] + 0x00000008u;
         /* 020CFC54 */ rbrew_write32(cpu->mem, _t36, cpu->r[29]);
         /* 020CFC58 */ Gambit_fn_027EE100(cpu);
-        /* 020CFC5C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[1]);
-        /* 020CFC60 */ _t37 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CFC5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[1]));
+        /* 020CFC60 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CFC60 */ _t38 = _t37 & 0x00000001u;
         /* 020CFC60 */ if (_t38) goto L_020CFD10; else goto L_020CFC64;
   L_020CFC64: ; // 0x20cfc64
@@ -3475,8 +3475,8 @@ void Gambit_fn_020CFB48(CPUState* cpu) {
         /* 020CFC8C */ _t41 = cpu->r[1] + 0x00000008u;
         /* 020CFC8C */ rbrew_write32(cpu->mem, _t41, cpu->r[29]);
         /* 020CFC90 */ Gambit_fn_027EE100(cpu);
-        /* 020CFC94 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[1]);
-        /* 020CFC98 */ _t42 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CFC94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[1]));
+        /* 020CFC98 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CFC98 */ _t43 = _t42 & 0x00000001u;
         /* 020CFC98 */ if (_t43) goto L_020CFD10; else goto L_020CFC9C;
   L_020CFC9C: ; // 0x20cfc9c
@@ -3496,8 +3496,8 @@ void Gambit_fn_020CFB48(CPUState* cpu) {
         /* 020CFCC4 */ _t46 = cpu->r[1] + 0x00000008u;
         /* 020CFCC4 */ rbrew_write32(cpu->mem, _t46, cpu->r[29]);
         /* 020CFCC8 */ Gambit_fn_027EE100(cpu);
-        /* 020CFCCC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[1]);
-        /* 020CFCD0 */ _t47 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CFCCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[1]));
+        /* 020CFCD0 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CFCD0 */ _t48 = _t47 & 0x00000001u;
         /* 020CFCD0 */ if (_t48) goto L_020CFD10; else goto L_020CFCD4;
   L_020CFCD4: ; // 0x20cfcd4
@@ -3519,8 +3519,8 @@ void Gambit_fn_020CFB48(CPUState* cpu) {
         /* 020CFD00 */ _t51 = cpu->r[1] + 0x00000008u;
         /* 020CFD00 */ rbrew_write32(cpu->mem, _t51, cpu->r[29]);
         /* 020CFD04 */ Gambit_fn_027EE100(cpu);
-        /* 020CFD08 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[1]);
-        /* 020CFD0C */ _t52 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CFD08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[1]));
+        /* 020CFD0C */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CFD0C */ _t53 = _t52 & 0x00000001u;
         /* 020CFD0C */ if (_t53) goto L_020CFD10; else goto L_020CFD14;
   L_020CFD10: ; // 0x20cfd10
@@ -3551,7 +3551,7 @@ void Gambit_fn_020CFB48(CPUState* cpu) {
         /* 020CFD44 */ cpu->r[31] = rbrew_read32(cpu->mem, _t62);
         /* 020CFD48 */ _t63 = cpu->r[1] + 0x00000018u;
         /* 020CFD48 */ cpu->r[30] = rbrew_read32(cpu->mem, _t63);
-        /* 020CFD4C */ _t64 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CFD4C */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CFD4C */ _t65 = _t64 & 0x00000001u;
         /* 020CFD4C */ if (_t65) goto L_020CFD50; // else: addr-0 trap, fall-through
   L_020CFD50: ; // 0x20cfd50
@@ -3590,27 +3590,27 @@ void Gambit_fn_020CFB4C(CPUState* cpu) {
         /* 020CFB74 */ rbrew_write32(cpu->mem, _t8, cpu->r[29]);
         /* 020CFB78 */ _t9 = cpu->r[4] + 0x00000000u;
         /* 020CFB78 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 020CFB7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
+        /* 020CFB7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
         /* 020CFB80 */ cpu->r[31] = cpu->r[3];
-        /* 020CFB84 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CFB84 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CFB84 */ _t11 = _t10 & 0x00000001u;
         /* 020CFB84 */ if (_t11) goto L_020CFD30; else goto L_020CFB88;
   L_020CFB88: ; // 0x20cfb88
         /* 020CFB88 */ cpu->r[8] = 0x10010000u;
         /* 020CFB8C */ _t12 = cpu->r[8] + 0x0000744Cu;
         /* 020CFB8C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t12);
-        /* 020CFB90 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 020CFB90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 020CFB94 */ cpu->f[31] = cpu->f[0];
-        /* 020CFB98 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CFB98 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CFB98 */ _t14 = _t13 & 0x00000001u;
         /* 020CFB98 */ if (_t14) goto L_020CFB9C; else goto L_020CFBB4;
   L_020CFB9C: ; // 0x20cfb9c
-        /* 020CFB9C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
-        /* 020CFBA0 */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CFB9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
+        /* 020CFBA0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CFBA0 */ _t16 = _t15 & 0x00000001u;
         /* 020CFBA0 */ if (_t16) goto L_020CFBFC; else goto L_020CFBA4;
   L_020CFBA4: ; // 0x20cfba4
-        /* 020CFBA4 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CFBA4 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CFBA4 */ _t18 = _t17 & 0x00000001u;
         /* 020CFBA4 */ if (_t18) goto L_020CFC30; else goto L_020CFBA8;
   L_020CFBA8: ; // 0x20cfba8
@@ -3619,17 +3619,17 @@ void Gambit_fn_020CFB4C(CPUState* cpu) {
         /* 020CFBAC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t19);
         /* 020CFBB0 */ goto L_020CFCE0;
   L_020CFBB4: ; // 0x20cfbb4
-        /* 020CFBB4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000004u);
-        /* 020CFBB8 */ _t20 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CFBB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000004u));
+        /* 020CFBB8 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CFBB8 */ _t21 = _t20 & 0x00000001u;
         /* 020CFBB8 */ if (_t21) goto L_020CFCA0; else goto L_020CFBBC;
   L_020CFBBC: ; // 0x20cfbbc
-        /* 020CFBBC */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CFBBC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CFBBC */ _t23 = _t22 & 0x00000001u;
         /* 020CFBBC */ if (_t23) goto L_020CFC68; else goto L_020CFBC0;
   L_020CFBC0: ; // 0x20cfbc0
-        /* 020CFBC0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
-        /* 020CFBC4 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CFBC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
+        /* 020CFBC4 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CFBC4 */ _t25 = _t24 & 0x00000001u;
         /* 020CFBC4 */ if (_t25) goto L_020CFCD8; else goto L_020CFBC8;
   L_020CFBC8: ; // 0x20cfbc8
@@ -3645,8 +3645,8 @@ void Gambit_fn_020CFB4C(CPUState* cpu) {
         /* 020CFBE8 */ _t27 = cpu->r[1] + 0x00000008u;
         /* 020CFBE8 */ rbrew_write32(cpu->mem, _t27, cpu->r[29]);
         /* 020CFBEC */ Gambit_fn_027EE100(cpu);
-        /* 020CFBF0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[1]);
-        /* 020CFBF4 */ _t28 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CFBF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[1]));
+        /* 020CFBF4 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CFBF4 */ _t29 = _t28 & 0x00000001u;
         /* 020CFBF4 */ if (_t29) goto L_020CFD10; else goto L_020CFBF8;
   L_020CFBF8: ; // 0x20cfbf8
@@ -3664,8 +3664,8 @@ void Gambit_fn_020CFB4C(CPUState* cpu) {
         /* 020CFC1C */ _t31 = cpu->r[1] + 0x00000008u;
         /* 020CFC1C */ rbrew_write32(cpu->mem, _t31, cpu->r[29]);
         /* 020CFC20 */ Gambit_fn_027EE100(cpu);
-        /* 020CFC24 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[1]);
-        /* 020CFC28 */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CFC24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[1]));
+        /* 020CFC28 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CFC28 */ _t33 = _t32 & 0x00000001u;
         /* 020CFC28 */ if (_t33) goto L_020CFD10; else goto L_020CFC2C;
   L_020CFC2C: ; // 0x20cfc2c
@@ -3685,8 +3685,8 @@ void Gambit_fn_020CFB4C(CPUState* cpu) {
         /* 020CFC54 */ _t36 = cpu->r[1] + 0x00000008u;
         /* 020CFC54 */ rbrew_write32(cpu->mem, _t36, cpu->r[29]);
         /* 020CFC58 */ Gambit_fn_027EE100(cpu);
-        /* 020CFC5C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[1]);
-        /* 020CFC60 */ _t37 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CFC5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[1]));
+        /* 020CFC60 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CFC60 */ _t38 = _t37 & 0x00000001u;
         /* 020CFC60 */ if (_t38) goto L_020CFD10; else goto L_020CFC64;
   L_020CFC64: ; // 0x20cfc64
@@ -3706,8 +3706,8 @@ void Gambit_fn_020CFB4C(CPUState* cpu) {
         /* 020CFC8C */ _t41 = cpu->r[1] + 0x00000008u;
         /* 020CFC8C */ rbrew_write32(cpu->mem, _t41, cpu->r[29]);
         /* 020CFC90 */ Gambit_fn_027EE100(cpu);
-        /* 020CFC94 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[1]);
-        /* 020CFC98 */ _t42 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CFC94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[1]));
+        /* 020CFC98 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CFC98 */ _t43 = _t42 & 0x00000001u;
         /* 020CFC98 */ if (_t43) goto L_020CFD10; else goto L_020CFC9C;
   L_020CFC9C: ; // 0x20cfc9c
@@ -3727,8 +3727,8 @@ void Gambit_fn_020CFB4C(CPUState* cpu) {
         /* 020CFCC4 */ _t46 = cpu->r[1] + 0x00000008u;
         /* 020CFCC4 */ rbrew_write32(cpu->mem, _t46, cpu->r[29]);
         /* 020CFCC8 */ Gambit_fn_027EE100(cpu);
-        /* 020CFCCC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[1]);
-        /* 020CFCD0 */ _t47 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CFCCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[1]));
+        /* 020CFCD0 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CFCD0 */ _t48 = _t47 & 0x00000001u;
         /* 020CFCD0 */ if (_t48) goto L_020CFD10; else goto L_020CFCD4;
   L_020CFCD4: ; // 0x20cfcd4
@@ -3750,8 +3750,8 @@ void Gambit_fn_020CFB4C(CPUState* cpu) {
         /* 020CFD00 */ _t51 = cpu->r[1] + 0x00000008u;
         /* 020CFD00 */ rbrew_write32(cpu->mem, _t51, cpu->r[29]);
         /* 020CFD04 */ Gambit_fn_027EE100(cpu);
-        /* 020CFD08 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[1]);
-        /* 020CFD0C */ _t52 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CFD08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[1]));
+        /* 020CFD0C */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CFD0C */ _t53 = _t52 & 0x00000001u;
         /* 020CFD0C */ if (_t53) goto L_020CFD10; else goto L_020CFD14;
   L_020CFD10: ; // 0x20cfd10
@@ -3782,7 +3782,7 @@ void Gambit_fn_020CFB4C(CPUState* cpu) {
         /* 020CFD44 */ cpu->r[31] = rbrew_read32(cpu->mem, _t62);
         /* 020CFD48 */ _t63 = cpu->r[1] + 0x00000018u;
         /* 020CFD48 */ cpu->r[30] = rbrew_read32(cpu->mem, _t63);
-        /* 020CFD4C */ _t64 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CFD4C */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CFD4C */ _t65 = _t64 & 0x00000001u;
         /* 020CFD4C */ if (_t65) goto L_020CFD50; // else: addr-0 trap, fall-through
   L_020CFD50: ; // 0x20cfd50
@@ -3822,31 +3822,31 @@ void Gambit_fn_020CFD60(CPUState* cpu) {
         /* 020CFD8C */ rbrew_write32(cpu->mem, _t8, cpu->r[31]);
         /* 020CFD90 */ _t9 = cpu->r[4] + 0x00000000u;
         /* 020CFD90 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 020CFD94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
+        /* 020CFD94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
         /* 020CFD98 */ cpu->r[30] = cpu->r[3];
-        /* 020CFD9C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CFD9C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CFD9C */ _t11 = _t10 & 0x00000001u;
         /* 020CFD9C */ if (_t11) goto L_020CFEF0; else goto L_020CFDA0;
   L_020CFDA0: ; // 0x20cfda0
         /* 020CFDA0 */ cpu->r[12] = 0x10010000u;
         /* 020CFDA4 */ _t12 = cpu->r[12] + 0x0000744Cu;
         /* 020CFDA4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t12);
-        /* 020CFDA8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 020CFDA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 020CFDAC */ cpu->f[31] = cpu->f[0];
-        /* 020CFDB0 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CFDB0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CFDB0 */ _t14 = _t13 & 0x00000001u;
         /* 020CFDB0 */ if (_t14) goto L_020CFDF8; else goto L_020CFDB4;
   L_020CFDB4: ; // 0x20cfdb4
-        /* 020CFDB4 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CFDB4 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CFDB4 */ _t16 = _t15 & 0x00000001u;
         /* 020CFDB4 */ if (_t16) goto L_020CFE2C; else goto L_020CFDB8;
   L_020CFDB8: ; // 0x20cfdb8
-        /* 020CFDB8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
-        /* 020CFDBC */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CFDB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
+        /* 020CFDBC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CFDBC */ _t18 = _t17 & 0x00000001u;
         /* 020CFDBC */ if (_t18) goto L_020CFE64; else goto L_020CFDC0;
   L_020CFDC0: ; // 0x20cfdc0
-        /* 020CFDC0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CFDC0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CFDC0 */ _t20 = _t19 & 0x00000001u;
         /* 020CFDC0 */ if (_t20) goto L_020CFE9C; else goto L_020CFDC4;
   L_020CFDC4: ; // 0x20cfdc4
@@ -3862,8 +3862,8 @@ void Gambit_fn_020CFD60(CPUState* cpu) {
         /* 020CFDE4 */ _t22 = cpu->r[1] + 0x00000008u;
         /* 020CFDE4 */ rbrew_write32(cpu->mem, _t22, cpu->r[31]);
         /* 020CFDE8 */ Gambit_fn_027EE100(cpu);
-        /* 020CFDEC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[1]);
-        /* 020CFDF0 */ _t23 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CFDEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[1]));
+        /* 020CFDF0 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CFDF0 */ _t24 = _t23 & 0x00000001u;
         /* 020CFDF0 */ if (_t24) goto L_020CFED0; else goto L_020CFDF4;
   L_020CFDF4: ; // 0x20cfdf4
@@ -3881,8 +3881,8 @@ void Gambit_fn_020CFD60(CPUState* cpu) {
         /* 020CFE18 */ _t26 = cpu->r[1] + 0x00000008u;
         /* 020CFE18 */ rbrew_write32(cpu->mem, _t26, cpu->r[31]);
         /* 020CFE1C */ Gambit_fn_027EE100(cpu);
-        /* 020CFE20 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[1]);
-        /* 020CFE24 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CFE20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[1]));
+        /* 020CFE24 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CFE24 */ _t28 = _t27 & 0x00000001u;
         /* 020CFE24 */ if (_t28) goto L_020CFED0; else goto L_020CFE28;
   L_020CFE28: ; // 0x20cfe28
@@ -3902,8 +3902,8 @@ void Gambit_fn_020CFD60(CPUState* cpu) {
         /* 020CFE50 */ _t31 = cpu->r[1] + 0x0000000Cu;
         /* 020CFE50 */ rbrew_write32(cpu->mem, _t31, cpu->r[29]);
         /* 020CFE54 */ Gambit_fn_027EE100(cpu);
-        /* 020CFE58 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[1]);
-        /* 020CFE5C */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CFE58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[1]));
+        /* 020CFE5C */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CFE5C */ _t33 = _t32 & 0x00000001u;
         /* 020CFE5C */ if (_t33) goto L_020CFED0; else goto L_020CFE60;
   L_020CFE60: ; // 0x20cfe60
@@ -3923,8 +3923,8 @@ void Gambit_fn_020CFD60(CPUState* cpu) {
         /* 020CFE88 */ _t36 = cpu->r[1] + 0x0000000Cu;
         /* 020CFE88 */ rbrew_write32(cpu->mem, _t36, cpu->r[29]);
         /* 020CFE8C */ Gambit_fn_027EE100(cpu);
-        /* 020CFE90 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[1]);
-        /* 020CFE94 */ _t37 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CFE90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[1]));
+        /* 020CFE94 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CFE94 */ _t38 = _t37 & 0x00000001u;
         /* 020CFE94 */ if (_t38) goto L_020CFED0; else goto L_020CFE98;
   L_020CFE98: ; // 0x20cfe98
@@ -3944,8 +3944,8 @@ void Gambit_fn_020CFD60(CPUState* cpu) {
         /* 020CFEC0 */ _t41 = cpu->r[1] + 0x0000000Cu;
         /* 020CFEC0 */ rbrew_write32(cpu->mem, _t41, cpu->r[29]);
         /* 020CFEC4 */ Gambit_fn_027EE100(cpu);
-        /* 020CFEC8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[1]);
-        /* 020CFECC */ _t42 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CFEC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[1]));
+        /* 020CFECC */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CFECC */ _t43 = _t42 & 0x00000001u;
         /* 020CFECC */ if (_t43) goto L_020CFED0; else goto L_020CFED4;
   L_020CFED0: ; // 0x20cfed0
@@ -3976,7 +3976,7 @@ void Gambit_fn_020CFD60(CPUState* cpu) {
         /* 020CFF04 */ cpu->r[31] = rbrew_read32(cpu->mem, _t52);
         /* 020CFF08 */ _t53 = cpu->r[1] + 0x00000018u;
         /* 020CFF08 */ cpu->r[30] = rbrew_read32(cpu->mem, _t53);
-        /* 020CFF0C */ _t54 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CFF0C */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CFF0C */ _t55 = _t54 & 0x00000001u;
         /* 020CFF0C */ if (_t55) goto L_020CFF10; // else: addr-0 trap, fall-through
   L_020CFF10: ; // 0x20cff10
@@ -4015,31 +4015,31 @@ void Gambit_fn_020CFD64(CPUState* cpu) {
         /* 020CFD8C */ rbrew_write32(cpu->mem, _t8, cpu->r[31]);
         /* 020CFD90 */ _t9 = cpu->r[4] + 0x00000000u;
         /* 020CFD90 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 020CFD94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
+        /* 020CFD94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
         /* 020CFD98 */ cpu->r[30] = cpu->r[3];
-        /* 020CFD9C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CFD9C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CFD9C */ _t11 = _t10 & 0x00000001u;
         /* 020CFD9C */ if (_t11) goto L_020CFEF0; else goto L_020CFDA0;
   L_020CFDA0: ; // 0x20cfda0
         /* 020CFDA0 */ cpu->r[12] = 0x10010000u;
         /* 020CFDA4 */ _t12 = cpu->r[12] + 0x0000744Cu;
         /* 020CFDA4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t12);
-        /* 020CFDA8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 020CFDA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 020CFDAC */ cpu->f[31] = cpu->f[0];
-        /* 020CFDB0 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CFDB0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CFDB0 */ _t14 = _t13 & 0x00000001u;
         /* 020CFDB0 */ if (_t14) goto L_020CFDF8; else goto L_020CFDB4;
   L_020CFDB4: ; // 0x20cfdb4
-        /* 020CFDB4 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CFDB4 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CFDB4 */ _t16 = _t15 & 0x00000001u;
         /* 020CFDB4 */ if (_t16) goto L_020CFE2C; else goto L_020CFDB8;
   L_020CFDB8: ; // 0x20cfdb8
-        /* 020CFDB8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
-        /* 020CFDBC */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CFDB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
+        /* 020CFDBC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CFDBC */ _t18 = _t17 & 0x00000001u;
         /* 020CFDBC */ if (_t18) goto L_020CFE64; else goto L_020CFDC0;
   L_020CFDC0: ; // 0x20cfdc0
-        /* 020CFDC0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CFDC0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CFDC0 */ _t20 = _t19 & 0x00000001u;
         /* 020CFDC0 */ if (_t20) goto L_020CFE9C; else goto L_020CFDC4;
   L_020CFDC4: ; // 0x20cfdc4
@@ -4055,8 +4055,8 @@ void Gambit_fn_020CFD64(CPUState* cpu) {
         /* 020CFDE4 */ _t22 = cpu->r[1] + 0x00000008u;
         /* 020CFDE4 */ rbrew_write32(cpu->mem, _t22, cpu->r[31]);
         /* 020CFDE8 */ Gambit_fn_027EE100(cpu);
-        /* 020CFDEC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[1]);
-        /* 020CFDF0 */ _t23 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CFDEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[1]));
+        /* 020CFDF0 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CFDF0 */ _t24 = _t23 & 0x00000001u;
         /* 020CFDF0 */ if (_t24) goto L_020CFED0; else goto L_020CFDF4;
   L_020CFDF4: ; // 0x20cfdf4
@@ -4074,8 +4074,8 @@ void Gambit_fn_020CFD64(CPUState* cpu) {
         /* 020CFE18 */ _t26 = cpu->r[1] + 0x00000008u;
         /* 020CFE18 */ rbrew_write32(cpu->mem, _t26, cpu->r[31]);
         /* 020CFE1C */ Gambit_fn_027EE100(cpu);
-        /* 020CFE20 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[1]);
-        /* 020CFE24 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CFE20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[1]));
+        /* 020CFE24 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CFE24 */ _t28 = _t27 & 0x00000001u;
         /* 020CFE24 */ if (_t28) goto L_020CFED0; else goto L_020CFE28;
   L_020CFE28: ; // 0x20cfe28
@@ -4095,8 +4095,8 @@ void Gambit_fn_020CFD64(CPUState* cpu) {
         /* 020CFE50 */ _t31 = cpu->r[1] + 0x0000000Cu;
         /* 020CFE50 */ rbrew_write32(cpu->mem, _t31, cpu->r[29]);
         /* 020CFE54 */ Gambit_fn_027EE100(cpu);
-        /* 020CFE58 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[1]);
-        /* 020CFE5C */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CFE58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[1]));
+        /* 020CFE5C */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CFE5C */ _t33 = _t32 & 0x00000001u;
         /* 020CFE5C */ if (_t33) goto L_020CFED0; else goto L_020CFE60;
   L_020CFE60: ; // 0x20cfe60
@@ -4116,8 +4116,8 @@ void Gambit_fn_020CFD64(CPUState* cpu) {
         /* 020CFE88 */ _t36 = cpu->r[1] + 0x0000000Cu;
         /* 020CFE88 */ rbrew_write32(cpu->mem, _t36, cpu->r[29]);
         /* 020CFE8C */ Gambit_fn_027EE100(cpu);
-        /* 020CFE90 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[1]);
-        /* 020CFE94 */ _t37 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CFE90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[1]));
+        /* 020CFE94 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CFE94 */ _t38 = _t37 & 0x00000001u;
         /* 020CFE94 */ if (_t38) goto L_020CFED0; else goto L_020CFE98;
   L_020CFE98: ; // 0x20cfe98
@@ -4137,8 +4137,8 @@ void Gambit_fn_020CFD64(CPUState* cpu) {
         /* 020CFEC0 */ _t41 = cpu->r[1] + 0x0000000Cu;
         /* 020CFEC0 */ rbrew_write32(cpu->mem, _t41, cpu->r[29]);
         /* 020CFEC4 */ Gambit_fn_027EE100(cpu);
-        /* 020CFEC8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[1]);
-        /* 020CFECC */ _t42 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020CFEC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[1]));
+        /* 020CFECC */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020CFECC */ _t43 = _t42 & 0x00000001u;
         /* 020CFECC */ if (_t43) goto L_020CFED0; else goto L_020CFED4;
   L_020CFED0: ; // 0x20cfed0
@@ -4169,7 +4169,7 @@ void Gambit_fn_020CFD64(CPUState* cpu) {
         /* 020CFF04 */ cpu->r[31] = rbrew_read32(cpu->mem, _t52);
         /* 020CFF08 */ _t53 = cpu->r[1] + 0x00000018u;
         /* 020CFF08 */ cpu->r[30] = rbrew_read32(cpu->mem, _t53);
-        /* 020CFF0C */ _t54 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CFF0C */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CFF0C */ _t55 = _t54 & 0x00000001u;
         /* 020CFF0C */ if (_t55) goto L_020CFF10; // else: addr-0 trap, fall-through
   L_020CFF10: ; // 0x20cff10
@@ -4218,17 +4218,17 @@ void Gambit_fn_020CFF20(CPUState* cpu) {
         /* 020CFF74 */ _t6 = cpu->r[1] + 0x00000014u;
         /* 020CFF74 */ rbrew_write32(cpu->mem, _t6, cpu->r[28]);
         /* 020CFF78 */ Gambit_fn_027EBCFC(cpu);
-        /* 020CFF7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020CFF80 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CFF7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020CFF80 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CFF80 */ _t8 = _t7 & 0x00000001u;
         /* 020CFF80 */ if (_t8) goto L_020CFFC0; else goto L_020CFF84;
   L_020CFF84: ; // 0x20cff84
         /* 020CFF84 */ _t9 = cpu->r[30] + 0x000001DCu;
         /* 020CFF84 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 020CFF88 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], cpu->r[0]);
+        /* 020CFF88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], cpu->r[0]));
         /* 020CFF8C */ _t10 = cpu->r[30] + 0x000001E0u;
         /* 020CFF8C */ cpu->r[31] = rbrew_read32(cpu->mem, _t10);
-        /* 020CFF90 */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020CFF90 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020CFF90 */ _t12 = _t11 & 0x00000001u;
         /* 020CFF90 */ if (_t12) goto L_020CFF94; else goto L_020CFF98;
   L_020CFF94: ; // 0x20cff94
@@ -4252,10 +4252,10 @@ void Gambit_fn_020CFF20(CPUState* cpu) {
         /* 020CFFBC */ rbrew_write32(cpu->mem, _t18, cpu->r[3]);
   L_020CFFC0: ; // 0x20cffc0
         /* 020CFFC0 */ cpu->r[24] = cpu->r[24] + 0xFFFFFFFFu;
-        /* 020CFFC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 020CFFC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 020CFFC4 */ cpu->r[25] = cpu->r[25] + 0x00000001u;
         /* 020CFFC8 */ cpu->r[27] = cpu->r[27] + 0x00000004u;
-        /* 020CFFCC */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020CFFCC */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020CFFCC */ _t20 = _t19 & 0x00000001u;
         /* 020CFFCC */ if (_t20) goto L_020CFFD0; else goto L_020CFF58;
   L_020CFFD0: ; // 0x20cffd0
@@ -4756,15 +4756,15 @@ void Gambit_fn_020D0250(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D0250: ; // 0x20d0250
-        /* 020D0250 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D0254 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0250 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D0254 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0254 */ _t1 = _t0 & 0x00000001u;
         /* 020D0254 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D0254 */ goto L_020D0258;
   L_020D0258: ; // 0x20d0258
         /* 020D0258 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D0258 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D025C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0258 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D025C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D025C */ _t3 = _t2 & 0x00000001u;
         /* 020D025C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D025C */ goto L_020D0260;
@@ -4783,8 +4783,8 @@ void Gambit_fn_020D0250(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4798,15 +4798,15 @@ void Gambit_fn_020D0250(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4843,11 +4843,11 @@ void Gambit_fn_020D0264(CPUState* cpu) {
         /* 020D0270 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D0270 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D0274 */ cpu->r[30] = cpu->r[3];
-        /* 020D0274 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D0274 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D0278 */ cpu->r[31] = cpu->r[4];
         /* 020D027C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D027C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D0280 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0280 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0280 */ _t5 = _t4 & 0x00000001u;
         /* 020D0280 */ if (_t5) goto L_020D02C4; else goto L_020D0284;
   L_020D0284: ; // 0x20d0284
@@ -4867,8 +4867,8 @@ void Gambit_fn_020D0264(CPUState* cpu) {
         /* 020D02AC */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D02B0 */ Gambit_fn_02068798(cpu);
         /* 020D02B4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D02B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D02B8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D02B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D02B8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D02B8 */ _t10 = _t9 & 0x00000001u;
         /* 020D02B8 */ if (_t10) goto L_020D02C4; else goto L_020D02BC;
   L_020D02BC: ; // 0x20d02bc
@@ -4899,11 +4899,11 @@ void Gambit_fn_020D0268(CPUState* cpu) {
         /* 020D0270 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D0270 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D0274 */ cpu->r[30] = cpu->r[3];
-        /* 020D0274 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D0274 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D0278 */ cpu->r[31] = cpu->r[4];
         /* 020D027C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D027C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D0280 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0280 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0280 */ _t5 = _t4 & 0x00000001u;
         /* 020D0280 */ if (_t5) goto L_020D02C4; else goto L_020D0284;
   L_020D0284: ; // 0x20d0284
@@ -4923,8 +4923,8 @@ void Gambit_fn_020D0268(CPUState* cpu) {
         /* 020D02AC */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D02B0 */ Gambit_fn_02068798(cpu);
         /* 020D02B4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D02B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D02B8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D02B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D02B8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D02B8 */ _t10 = _t9 & 0x00000001u;
         /* 020D02B8 */ if (_t10) goto L_020D02C4; else goto L_020D02BC;
   L_020D02BC: ; // 0x20d02bc
@@ -4979,15 +4979,15 @@ void Gambit_fn_020D02F4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D02F4: ; // 0x20d02f4
-        /* 020D02F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D02F8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D02F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D02F8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D02F8 */ _t1 = _t0 & 0x00000001u;
         /* 020D02F8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D02F8 */ goto L_020D02FC;
   L_020D02FC: ; // 0x20d02fc
         /* 020D02FC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D02FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D0300 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D02FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D0300 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0300 */ _t3 = _t2 & 0x00000001u;
         /* 020D0300 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D0300 */ goto L_020D0304;
@@ -5006,8 +5006,8 @@ void Gambit_fn_020D02F4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -5021,15 +5021,15 @@ void Gambit_fn_020D02F4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -5075,15 +5075,15 @@ void Gambit_fn_020D0324(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D0324: ; // 0x20d0324
-        /* 020D0324 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D0328 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0324 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D0328 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0328 */ _t1 = _t0 & 0x00000001u;
         /* 020D0328 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D0328 */ goto L_020D032C;
   L_020D032C: ; // 0x20d032c
         /* 020D032C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D032C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D0330 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D032C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D0330 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0330 */ _t3 = _t2 & 0x00000001u;
         /* 020D0330 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D0330 */ goto L_020D0334;
@@ -5102,8 +5102,8 @@ void Gambit_fn_020D0324(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -5117,15 +5117,15 @@ void Gambit_fn_020D0324(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -5153,15 +5153,15 @@ void Gambit_fn_020D0338(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D0338: ; // 0x20d0338
-        /* 020D0338 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D033C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0338 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D033C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D033C */ _t1 = _t0 & 0x00000001u;
         /* 020D033C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D033C */ goto L_020D0340;
   L_020D0340: ; // 0x20d0340
         /* 020D0340 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D0340 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D0344 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0340 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D0344 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0344 */ _t3 = _t2 & 0x00000001u;
         /* 020D0344 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D0344 */ goto L_020D0348;
@@ -5180,8 +5180,8 @@ void Gambit_fn_020D0338(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -5195,15 +5195,15 @@ void Gambit_fn_020D0338(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -5356,10 +5356,10 @@ void Gambit_fn_020D03B0(CPUState* cpu) {
         /* 020D03B0 */ cpu->r[12] = 0x101D0000u;
         /* 020D03B4 */ _t0 = cpu->r[12] + 0xFFFFED9Cu;
         /* 020D03B4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 020D03B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 020D03B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 020D03BC */ cpu->r[12] = 0x101D0000u;
         /* 020D03C0 */ cpu->r[12] = cpu->r[12] + 0xFFFFEDDCu;
-        /* 020D03C4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D03C4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D03C4 */ _t2 = _t1 & 0x00000001u;
         /* 020D03C4 */ if (_t2) goto L_020D03C8; else goto L_020D03E0;
   L_020D03C8: ; // 0x20d03c8
@@ -5372,8 +5372,8 @@ void Gambit_fn_020D03B0(CPUState* cpu) {
         /* 020D03DC */ _t4 = cpu->r[12] + 0x00000000u;
         /* 020D03DC */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_020D03E0: ; // 0x20d03e0
-        /* 020D03E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 020D03E4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D03E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 020D03E4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D03E4 */ _t6 = _t5 & 0x00000001u;
         /* 020D03E4 */ if (_t6) goto L_020D03E8; else goto L_020D03F0;
   L_020D03E8: ; // 0x20d03e8
@@ -5385,9 +5385,9 @@ void Gambit_fn_020D03B0(CPUState* cpu) {
         /* 020D03F4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 020D03F4 */ cpu->r[11] = _t7;
         /* 020D03F8 */ cpu->r[10] = 0x101D0000u;
-        /* 020D03FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020D03FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020D0400 */ cpu->r[10] = cpu->r[10] + 0xFFFFED90u;
-        /* 020D0404 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0404 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0404 */ _t9 = _t8 & 0x00000001u;
         /* 020D0404 */ if (_t9) goto L_020D0408; else goto L_020D041C;
   L_020D0408: ; // 0x20d0408
@@ -5399,8 +5399,8 @@ void Gambit_fn_020D03B0(CPUState* cpu) {
         /* 020D0418 */ _t11 = cpu->r[10] + 0x00000000u;
         /* 020D0418 */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
   L_020D041C: ; // 0x20d041c
-        /* 020D041C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 020D0420 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D041C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 020D0420 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0420 */ _t13 = _t12 & 0x00000001u;
         /* 020D0420 */ if (_t13) goto L_020D0424; else goto L_020D042C;
   L_020D0424: ; // 0x20d0424
@@ -5412,9 +5412,9 @@ void Gambit_fn_020D03B0(CPUState* cpu) {
         /* 020D0430 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 020D0430 */ cpu->r[8] = _t14;
         /* 020D0434 */ cpu->r[11] = 0x101D0000u;
-        /* 020D0438 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020D0438 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020D043C */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 020D0440 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0440 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0440 */ _t16 = _t15 & 0x00000001u;
         /* 020D0440 */ if (_t16) goto L_020D0444; else goto L_020D0458;
   L_020D0444: ; // 0x20d0444
@@ -5458,11 +5458,11 @@ void Gambit_fn_020D0474(CPUState* cpu) {
         /* 020D0E18 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D0E18 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D0E1C */ cpu->r[30] = cpu->r[3];
-        /* 020D0E1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D0E1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D0E20 */ cpu->r[31] = cpu->r[4];
         /* 020D0E24 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D0E24 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D0E28 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0E28 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0E28 */ _t5 = _t4 & 0x00000001u;
         /* 020D0E28 */ if (_t5) goto L_020D0E6C; else goto L_020D0E2C;
   L_020D0E2C: ; // 0x20d0e2c
@@ -5482,8 +5482,8 @@ void Gambit_fn_020D0474(CPUState* cpu) {
         /* 020D0E54 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D0E58 */ Gambit_fn_02068798(cpu);
         /* 020D0E5C */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D0E5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D0E60 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0E5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D0E60 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0E60 */ _t10 = _t9 & 0x00000001u;
         /* 020D0E60 */ if (_t10) goto L_020D0E6C; else goto L_020D0E64;
   L_020D0E64: ; // 0x20d0e64
@@ -5511,8 +5511,8 @@ void Gambit_fn_020D047C(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -5564,18 +5564,18 @@ void Gambit_fn_020D0494(CPUState* cpu) {
         /* 020D049C */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020D04A0 */ /* nop */
         /* 020D04A4 */ cpu->r[30] = cpu->r[3];
-        /* 020D04A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D04A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D04A8 */ cpu->r[29] = cpu->r[4];
         /* 020D04AC */ cpu->r[31] = cpu->r[5];
-        /* 020D04B0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D04B0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D04B0 */ _t3 = _t2 & 0x00000001u;
         /* 020D04B0 */ if (_t3) goto L_020D04B4; else goto L_020D04C4;
   L_020D04B4: ; // 0x20d04b4
         /* 020D04B4 */ cpu->r[3] = 0x0000021Cu;
         /* 020D04B8 */ Gambit_fn_02801A78(cpu);
         /* 020D04BC */ cpu->r[30] = cpu->r[3];
-        /* 020D04BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 020D04C0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D04BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 020D04C0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D04C0 */ _t5 = _t4 & 0x00000001u;
         /* 020D04C0 */ if (_t5) goto L_020D0980; else goto L_020D04C4;
   L_020D04C4: ; // 0x20d04c4
@@ -5599,7 +5599,7 @@ void Gambit_fn_020D0494(CPUState* cpu) {
         /* 020D04FC */ rbrew_write32(cpu->mem, _t8, cpu->r[6]);
         /* 020D0500 */ cpu->r[9] = 0x10010000u;
         /* 020D0504 */ cpu->r[27] = cpu->r[30] + 0x000001DCu;
-        /* 020D0504 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020D0504 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020D0508 */ _t9 = cpu->r[30] + 0x0000000Cu;
         /* 020D0508 */ rbrew_write32(cpu->mem, _t9, cpu->r[7]);
         /* 020D050C */ cpu->r[9] = cpu->r[9] + 0x00007A64u;
@@ -5609,15 +5609,15 @@ void Gambit_fn_020D0494(CPUState* cpu) {
         /* 020D0518 */ cpu->r[28] = 0x00000000u;
         /* 020D051C */ _t11 = cpu->r[30] + 0x000001C8u;
         /* 020D051C */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
-        /* 020D0520 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0520 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0520 */ _t13 = _t12 & 0x00000001u;
         /* 020D0520 */ if (_t13) goto L_020D0524; else goto L_020D0534;
   L_020D0524: ; // 0x20d0524
         /* 020D0524 */ cpu->r[3] = 0x00000038u;
         /* 020D0528 */ Gambit_fn_02801A78(cpu);
         /* 020D052C */ cpu->r[29] = cpu->r[3];
-        /* 020D052C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020D0530 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D052C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020D0530 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0530 */ _t15 = _t14 & 0x00000001u;
         /* 020D0530 */ if (_t15) goto L_020D0564; else goto L_020D0534;
   L_020D0534: ; // 0x20d0534
@@ -5679,23 +5679,23 @@ void Gambit_fn_020D0494(CPUState* cpu) {
         /* 020D05C4 */ _t34 = cpu->r[9] + 0x00000000u;
         /* 020D05C4 */ cpu->r[12] = rbrew_read8(cpu->mem, _t34);
         /* 020D05C8 */ cpu->r[31] = 0x00000000u;
-        /* 020D05CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[29]);
+        /* 020D05CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[29]));
         /* 020D05D0 */ cpu->r[11] = 0x00080000u;
-        /* 020D05D4 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D05D4 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D05D4 */ _t36 = _t35 & 0x00000001u;
         /* 020D05D4 */ if (_t36) goto L_020D05FC; else goto L_020D05D8;
   L_020D05D8: ; // 0x20d05d8
         /* 020D05D8 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020D05DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 020D05DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 020D05E0 */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 020D05E4 */ _t37 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D05E4 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D05E4 */ _t38 = _t37 & 0x00000001u;
         /* 020D05E4 */ if (_t38) goto L_020D05F8; else goto L_020D05E8;
   L_020D05E8: ; // 0x20d05e8
         /* 020D05E8 */ _t39 = cpu->r[9] + 0x00000000u;
         /* 020D05E8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t39);
-        /* 020D05EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[29]);
-        /* 020D05F0 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D05EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[29]));
+        /* 020D05F0 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D05F0 */ _t41 = _t40 & 0x00000001u;
         /* 020D05F0 */ if (_t41) goto L_020D05F4; else goto L_020D05D8;
   L_020D05F4: ; // 0x20d05f4
@@ -5705,8 +5705,8 @@ void Gambit_fn_020D0494(CPUState* cpu) {
   L_020D05FC: ; // 0x20d05fc
         /* 020D05FC */ _t42 = cpu->r[23] + 0x00000008u;
         /* 020D05FC */ cpu->r[5] = rbrew_read32(cpu->mem, _t42);
-        /* 020D0600 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
-        /* 020D0604 */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D0600 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
+        /* 020D0604 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D0604 */ _t44 = _t43 & 0x00000001u;
         /* 020D0604 */ if (_t44) goto L_020D060C; else goto L_020D0608;
   L_020D0608: ; // 0x20d0608
@@ -5765,10 +5765,10 @@ void Gambit_fn_020D0494(CPUState* cpu) {
         /* 020D0694 */ rbrew_write32(cpu->mem, _t60, cpu->r[0]);
         /* 020D0698 */ _t61 = cpu->r[27] + 0x00000014u;
         /* 020D0698 */ cpu->r[8] = rbrew_read32(cpu->mem, _t61);
-        /* 020D069C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000001u);
+        /* 020D069C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000001u));
         /* 020D06A0 */ _t62 = cpu->r[27] + 0x00000018u;
         /* 020D06A0 */ cpu->r[24] = rbrew_read32(cpu->mem, _t62);
-        /* 020D06A4 */ _t63 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D06A4 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D06A4 */ _t64 = _t63 & 0x00000001u;
         /* 020D06A4 */ if (_t64) goto L_020D06A8; else goto L_020D06AC;
   L_020D06A8: ; // 0x20d06a8
@@ -5784,23 +5784,23 @@ void Gambit_fn_020D0494(CPUState* cpu) {
         /* 020D06C0 */ _t67 = cpu->r[5] + 0x00000000u;
         /* 020D06C0 */ cpu->r[9] = rbrew_read8(cpu->mem, _t67);
         /* 020D06C4 */ cpu->r[31] = 0x00000000u;
-        /* 020D06C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[29]);
+        /* 020D06C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[29]));
         /* 020D06CC */ cpu->r[7] = 0x00080000u;
-        /* 020D06D0 */ _t68 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D06D0 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D06D0 */ _t69 = _t68 & 0x00000001u;
         /* 020D06D0 */ if (_t69) goto L_020D06F8; else goto L_020D06D4;
   L_020D06D4: ; // 0x20d06d4
         /* 020D06D4 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020D06D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 020D06D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 020D06DC */ cpu->r[5] = cpu->r[5] + 0x00000001u;
-        /* 020D06E0 */ _t70 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D06E0 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D06E0 */ _t71 = _t70 & 0x00000001u;
         /* 020D06E0 */ if (_t71) goto L_020D06F4; else goto L_020D06E4;
   L_020D06E4: ; // 0x20d06e4
         /* 020D06E4 */ _t72 = cpu->r[5] + 0x00000000u;
         /* 020D06E4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t72);
-        /* 020D06E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[29]);
-        /* 020D06EC */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D06E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[29]));
+        /* 020D06EC */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D06EC */ _t74 = _t73 & 0x00000001u;
         /* 020D06EC */ if (_t74) goto L_020D06F0; else goto L_020D06D4;
   L_020D06F0: ; // 0x20d06f0
@@ -5812,10 +5812,10 @@ void Gambit_fn_020D0494(CPUState* cpu) {
         /* 020D06F8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t75);
         /* 020D06FC */ _t76 = cpu->r[1] + 0x00000010u;
         /* 020D06FC */ cpu->r[11] = rbrew_read32(cpu->mem, _t76);
-        /* 020D0700 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 020D0700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 020D0704 */ _t77 = cpu->r[11] + 0x00000014u;
         /* 020D0704 */ cpu->r[12] = rbrew_read32(cpu->mem, _t77);
-        /* 020D0708 */ _t78 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D0708 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D0708 */ _t79 = _t78 & 0x00000001u;
         /* 020D0708 */ if (_t79) goto L_020D0710; else goto L_020D070C;
   L_020D070C: ; // 0x20d070c
@@ -5870,10 +5870,10 @@ void Gambit_fn_020D0494(CPUState* cpu) {
         /* 020D0790 */ rbrew_write32(cpu->mem, _t93, cpu->r[8]);
         /* 020D0794 */ _t94 = cpu->r[27] + 0x00000014u;
         /* 020D0794 */ cpu->r[9] = rbrew_read32(cpu->mem, _t94);
-        /* 020D0798 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000002u);
+        /* 020D0798 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000002u));
         /* 020D079C */ _t95 = cpu->r[27] + 0x00000018u;
         /* 020D079C */ cpu->r[24] = rbrew_read32(cpu->mem, _t95);
-        /* 020D07A0 */ _t96 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D07A0 */ _t96 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D07A0 */ _t97 = _t96 & 0x00000001u;
         /* 020D07A0 */ if (_t97) goto L_020D07A4; else goto L_020D07A8;
   L_020D07A4: ; // 0x20d07a4
@@ -5889,23 +5889,23 @@ void Gambit_fn_020D0494(CPUState* cpu) {
         /* 020D07BC */ _t100 = cpu->r[10] + 0x00000000u;
         /* 020D07BC */ cpu->r[0] = rbrew_read8(cpu->mem, _t100);
         /* 020D07C0 */ cpu->r[31] = 0x00000000u;
-        /* 020D07C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[29]);
+        /* 020D07C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[29]));
         /* 020D07C8 */ cpu->r[11] = 0x00080000u;
-        /* 020D07CC */ _t101 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D07CC */ _t101 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D07CC */ _t102 = _t101 & 0x00000001u;
         /* 020D07CC */ if (_t102) goto L_020D07F4; else goto L_020D07D0;
   L_020D07D0: ; // 0x20d07d0
         /* 020D07D0 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020D07D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 020D07D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 020D07D8 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 020D07DC */ _t103 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D07DC */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D07DC */ _t104 = _t103 & 0x00000001u;
         /* 020D07DC */ if (_t104) goto L_020D07F0; else goto L_020D07E0;
   L_020D07E0: ; // 0x20d07e0
         /* 020D07E0 */ _t105 = cpu->r[10] + 0x00000000u;
         /* 020D07E0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t105);
-        /* 020D07E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[29]);
-        /* 020D07E8 */ _t106 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D07E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[29]));
+        /* 020D07E8 */ _t106 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D07E8 */ _t107 = _t106 & 0x00000001u;
         /* 020D07E8 */ if (_t107) goto L_020D07EC; else goto L_020D07D0;
   L_020D07EC: ; // 0x20d07ec
@@ -5917,10 +5917,10 @@ void Gambit_fn_020D0494(CPUState* cpu) {
         /* 020D07F4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t108);
         /* 020D07F8 */ _t109 = cpu->r[1] + 0x00000010u;
         /* 020D07F8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t109);
-        /* 020D07FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 020D07FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 020D0800 */ _t110 = cpu->r[6] + 0x00000014u;
         /* 020D0800 */ cpu->r[8] = rbrew_read32(cpu->mem, _t110);
-        /* 020D0804 */ _t111 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D0804 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D0804 */ _t112 = _t111 & 0x00000001u;
         /* 020D0804 */ if (_t112) goto L_020D080C; else goto L_020D0808;
   L_020D0808: ; // 0x20d0808
@@ -5975,10 +5975,10 @@ void Gambit_fn_020D0494(CPUState* cpu) {
         /* 020D088C */ rbrew_write32(cpu->mem, _t126, cpu->r[12]);
         /* 020D0890 */ _t127 = cpu->r[27] + 0x00000014u;
         /* 020D0890 */ cpu->r[0] = rbrew_read32(cpu->mem, _t127);
-        /* 020D0894 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 020D0894 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 020D0898 */ _t128 = cpu->r[27] + 0x00000018u;
         /* 020D0898 */ cpu->r[31] = rbrew_read32(cpu->mem, _t128);
-        /* 020D089C */ _t129 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D089C */ _t129 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D089C */ _t130 = _t129 & 0x00000001u;
         /* 020D089C */ if (_t130) goto L_020D08A0; else goto L_020D08A4;
   L_020D08A0: ; // 0x20d08a0
@@ -5994,23 +5994,23 @@ void Gambit_fn_020D0494(CPUState* cpu) {
         /* 020D08B8 */ _t133 = cpu->r[5] + 0x00000000u;
         /* 020D08B8 */ cpu->r[6] = rbrew_read8(cpu->mem, _t133);
         /* 020D08BC */ cpu->r[26] = 0x00000000u;
-        /* 020D08C0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[29]);
+        /* 020D08C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[29]));
         /* 020D08C4 */ cpu->r[7] = 0x00080000u;
-        /* 020D08C8 */ _t134 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D08C8 */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D08C8 */ _t135 = _t134 & 0x00000001u;
         /* 020D08C8 */ if (_t135) goto L_020D08F0; else goto L_020D08CC;
   L_020D08CC: ; // 0x20d08cc
         /* 020D08CC */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 020D08D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[7]);
+        /* 020D08D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[7]));
         /* 020D08D4 */ cpu->r[5] = cpu->r[5] + 0x00000001u;
-        /* 020D08D8 */ _t136 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D08D8 */ _t136 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D08D8 */ _t137 = _t136 & 0x00000001u;
         /* 020D08D8 */ if (_t137) goto L_020D08EC; else goto L_020D08DC;
   L_020D08DC: ; // 0x20d08dc
         /* 020D08DC */ _t138 = cpu->r[5] + 0x00000000u;
         /* 020D08DC */ cpu->r[8] = rbrew_read8(cpu->mem, _t138);
-        /* 020D08E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[29]);
-        /* 020D08E4 */ _t139 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D08E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[29]));
+        /* 020D08E4 */ _t139 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D08E4 */ _t140 = _t139 & 0x00000001u;
         /* 020D08E4 */ if (_t140) goto L_020D08E8; else goto L_020D08CC;
   L_020D08E8: ; // 0x20d08e8
@@ -6022,10 +6022,10 @@ void Gambit_fn_020D0494(CPUState* cpu) {
         /* 020D08F0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t141);
         /* 020D08F4 */ _t142 = cpu->r[1] + 0x00000010u;
         /* 020D08F4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t142);
-        /* 020D08F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[12]);
+        /* 020D08F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[12]));
         /* 020D08FC */ _t143 = cpu->r[10] + 0x00000014u;
         /* 020D08FC */ cpu->r[0] = rbrew_read32(cpu->mem, _t143);
-        /* 020D0900 */ _t144 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D0900 */ _t144 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D0900 */ _t145 = _t144 & 0x00000001u;
         /* 020D0900 */ if (_t145) goto L_020D0908; else goto L_020D0904;
   L_020D0904: ; // 0x20d0904
@@ -6096,18 +6096,18 @@ void Gambit_fn_020D0498(CPUState* cpu) {
         /* 020D049C */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020D04A0 */ /* nop */
         /* 020D04A4 */ cpu->r[30] = cpu->r[3];
-        /* 020D04A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D04A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D04A8 */ cpu->r[29] = cpu->r[4];
         /* 020D04AC */ cpu->r[31] = cpu->r[5];
-        /* 020D04B0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D04B0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D04B0 */ _t3 = _t2 & 0x00000001u;
         /* 020D04B0 */ if (_t3) goto L_020D04B4; else goto L_020D04C4;
   L_020D04B4: ; // 0x20d04b4
         /* 020D04B4 */ cpu->r[3] = 0x0000021Cu;
         /* 020D04B8 */ Gambit_fn_02801A78(cpu);
         /* 020D04BC */ cpu->r[30] = cpu->r[3];
-        /* 020D04BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 020D04C0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D04BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 020D04C0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D04C0 */ _t5 = _t4 & 0x00000001u;
         /* 020D04C0 */ if (_t5) goto L_020D0980; else goto L_020D04C4;
   L_020D04C4: ; // 0x20d04c4
@@ -6131,7 +6131,7 @@ void Gambit_fn_020D0498(CPUState* cpu) {
         /* 020D04FC */ rbrew_write32(cpu->mem, _t8, cpu->r[6]);
         /* 020D0500 */ cpu->r[9] = 0x10010000u;
         /* 020D0504 */ cpu->r[27] = cpu->r[30] + 0x000001DCu;
-        /* 020D0504 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020D0504 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020D0508 */ _t9 = cpu->r[30] + 0x0000000Cu;
         /* 020D0508 */ rbrew_write32(cpu->mem, _t9, cpu->r[7]);
         /* 020D050C */ cpu->r[9] = cpu->r[9] + 0x00007A64u;
@@ -6141,15 +6141,15 @@ void Gambit_fn_020D0498(CPUState* cpu) {
         /* 020D0518 */ cpu->r[28] = 0x00000000u;
         /* 020D051C */ _t11 = cpu->r[30] + 0x000001C8u;
         /* 020D051C */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
-        /* 020D0520 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0520 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0520 */ _t13 = _t12 & 0x00000001u;
         /* 020D0520 */ if (_t13) goto L_020D0524; else goto L_020D0534;
   L_020D0524: ; // 0x20d0524
         /* 020D0524 */ cpu->r[3] = 0x00000038u;
         /* 020D0528 */ Gambit_fn_02801A78(cpu);
         /* 020D052C */ cpu->r[29] = cpu->r[3];
-        /* 020D052C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020D0530 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D052C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020D0530 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0530 */ _t15 = _t14 & 0x00000001u;
         /* 020D0530 */ if (_t15) goto L_020D0564; else goto L_020D0534;
   L_020D0534: ; // 0x20d0534
@@ -6211,23 +6211,23 @@ void Gambit_fn_020D0498(CPUState* cpu) {
         /* 020D05C4 */ _t34 = cpu->r[9] + 0x00000000u;
         /* 020D05C4 */ cpu->r[12] = rbrew_read8(cpu->mem, _t34);
         /* 020D05C8 */ cpu->r[31] = 0x00000000u;
-        /* 020D05CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[29]);
+        /* 020D05CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[29]));
         /* 020D05D0 */ cpu->r[11] = 0x00080000u;
-        /* 020D05D4 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D05D4 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D05D4 */ _t36 = _t35 & 0x00000001u;
         /* 020D05D4 */ if (_t36) goto L_020D05FC; else goto L_020D05D8;
   L_020D05D8: ; // 0x20d05d8
         /* 020D05D8 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020D05DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 020D05DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 020D05E0 */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 020D05E4 */ _t37 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D05E4 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D05E4 */ _t38 = _t37 & 0x00000001u;
         /* 020D05E4 */ if (_t38) goto L_020D05F8; else goto L_020D05E8;
   L_020D05E8: ; // 0x20d05e8
         /* 020D05E8 */ _t39 = cpu->r[9] + 0x00000000u;
         /* 020D05E8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t39);
-        /* 020D05EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[29]);
-        /* 020D05F0 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D05EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[29]));
+        /* 020D05F0 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D05F0 */ _t41 = _t40 & 0x00000001u;
         /* 020D05F0 */ if (_t41) goto L_020D05F4; else goto L_020D05D8;
   L_020D05F4: ; // 0x20d05f4
@@ -6237,8 +6237,8 @@ void Gambit_fn_020D0498(CPUState* cpu) {
   L_020D05FC: ; // 0x20d05fc
         /* 020D05FC */ _t42 = cpu->r[23] + 0x00000008u;
         /* 020D05FC */ cpu->r[5] = rbrew_read32(cpu->mem, _t42);
-        /* 020D0600 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
-        /* 020D0604 */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D0600 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
+        /* 020D0604 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D0604 */ _t44 = _t43 & 0x00000001u;
         /* 020D0604 */ if (_t44) goto L_020D060C; else goto L_020D0608;
   L_020D0608: ; // 0x20d0608
@@ -6297,10 +6297,10 @@ void Gambit_fn_020D0498(CPUState* cpu) {
         /* 020D0694 */ rbrew_write32(cpu->mem, _t60, cpu->r[0]);
         /* 020D0698 */ _t61 = cpu->r[27] + 0x00000014u;
         /* 020D0698 */ cpu->r[8] = rbrew_read32(cpu->mem, _t61);
-        /* 020D069C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000001u);
+        /* 020D069C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000001u));
         /* 020D06A0 */ _t62 = cpu->r[27] + 0x00000018u;
         /* 020D06A0 */ cpu->r[24] = rbrew_read32(cpu->mem, _t62);
-        /* 020D06A4 */ _t63 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D06A4 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D06A4 */ _t64 = _t63 & 0x00000001u;
         /* 020D06A4 */ if (_t64) goto L_020D06A8; else goto L_020D06AC;
   L_020D06A8: ; // 0x20d06a8
@@ -6316,23 +6316,23 @@ void Gambit_fn_020D0498(CPUState* cpu) {
         /* 020D06C0 */ _t67 = cpu->r[5] + 0x00000000u;
         /* 020D06C0 */ cpu->r[9] = rbrew_read8(cpu->mem, _t67);
         /* 020D06C4 */ cpu->r[31] = 0x00000000u;
-        /* 020D06C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[29]);
+        /* 020D06C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[29]));
         /* 020D06CC */ cpu->r[7] = 0x00080000u;
-        /* 020D06D0 */ _t68 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D06D0 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D06D0 */ _t69 = _t68 & 0x00000001u;
         /* 020D06D0 */ if (_t69) goto L_020D06F8; else goto L_020D06D4;
   L_020D06D4: ; // 0x20d06d4
         /* 020D06D4 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020D06D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 020D06D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 020D06DC */ cpu->r[5] = cpu->r[5] + 0x00000001u;
-        /* 020D06E0 */ _t70 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D06E0 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D06E0 */ _t71 = _t70 & 0x00000001u;
         /* 020D06E0 */ if (_t71) goto L_020D06F4; else goto L_020D06E4;
   L_020D06E4: ; // 0x20d06e4
         /* 020D06E4 */ _t72 = cpu->r[5] + 0x00000000u;
         /* 020D06E4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t72);
-        /* 020D06E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[29]);
-        /* 020D06EC */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D06E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[29]));
+        /* 020D06EC */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D06EC */ _t74 = _t73 & 0x00000001u;
         /* 020D06EC */ if (_t74) goto L_020D06F0; else goto L_020D06D4;
   L_020D06F0: ; // 0x20d06f0
@@ -6344,10 +6344,10 @@ void Gambit_fn_020D0498(CPUState* cpu) {
         /* 020D06F8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t75);
         /* 020D06FC */ _t76 = cpu->r[1] + 0x00000010u;
         /* 020D06FC */ cpu->r[11] = rbrew_read32(cpu->mem, _t76);
-        /* 020D0700 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 020D0700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 020D0704 */ _t77 = cpu->r[11] + 0x00000014u;
         /* 020D0704 */ cpu->r[12] = rbrew_read32(cpu->mem, _t77);
-        /* 020D0708 */ _t78 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D0708 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D0708 */ _t79 = _t78 & 0x00000001u;
         /* 020D0708 */ if (_t79) goto L_020D0710; else goto L_020D070C;
   L_020D070C: ; // 0x20d070c
@@ -6402,10 +6402,10 @@ void Gambit_fn_020D0498(CPUState* cpu) {
         /* 020D0790 */ rbrew_write32(cpu->mem, _t93, cpu->r[8]);
         /* 020D0794 */ _t94 = cpu->r[27] + 0x00000014u;
         /* 020D0794 */ cpu->r[9] = rbrew_read32(cpu->mem, _t94);
-        /* 020D0798 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000002u);
+        /* 020D0798 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000002u));
         /* 020D079C */ _t95 = cpu->r[27] + 0x00000018u;
         /* 020D079C */ cpu->r[24] = rbrew_read32(cpu->mem, _t95);
-        /* 020D07A0 */ _t96 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D07A0 */ _t96 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D07A0 */ _t97 = _t96 & 0x00000001u;
         /* 020D07A0 */ if (_t97) goto L_020D07A4; else goto L_020D07A8;
   L_020D07A4: ; // 0x20d07a4
@@ -6421,23 +6421,23 @@ void Gambit_fn_020D0498(CPUState* cpu) {
         /* 020D07BC */ _t100 = cpu->r[10] + 0x00000000u;
         /* 020D07BC */ cpu->r[0] = rbrew_read8(cpu->mem, _t100);
         /* 020D07C0 */ cpu->r[31] = 0x00000000u;
-        /* 020D07C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[29]);
+        /* 020D07C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[29]));
         /* 020D07C8 */ cpu->r[11] = 0x00080000u;
-        /* 020D07CC */ _t101 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D07CC */ _t101 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D07CC */ _t102 = _t101 & 0x00000001u;
         /* 020D07CC */ if (_t102) goto L_020D07F4; else goto L_020D07D0;
   L_020D07D0: ; // 0x20d07d0
         /* 020D07D0 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020D07D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 020D07D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 020D07D8 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 020D07DC */ _t103 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D07DC */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D07DC */ _t104 = _t103 & 0x00000001u;
         /* 020D07DC */ if (_t104) goto L_020D07F0; else goto L_020D07E0;
   L_020D07E0: ; // 0x20d07e0
         /* 020D07E0 */ _t105 = cpu->r[10] + 0x00000000u;
         /* 020D07E0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t105);
-        /* 020D07E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[29]);
-        /* 020D07E8 */ _t106 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D07E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[29]));
+        /* 020D07E8 */ _t106 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D07E8 */ _t107 = _t106 & 0x00000001u;
         /* 020D07E8 */ if (_t107) goto L_020D07EC; else goto L_020D07D0;
   L_020D07EC: ; // 0x20d07ec
@@ -6449,10 +6449,10 @@ void Gambit_fn_020D0498(CPUState* cpu) {
         /* 020D07F4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t108);
         /* 020D07F8 */ _t109 = cpu->r[1] + 0x00000010u;
         /* 020D07F8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t109);
-        /* 020D07FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[9]);
+        /* 020D07FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[9]));
         /* 020D0800 */ _t110 = cpu->r[6] + 0x00000014u;
         /* 020D0800 */ cpu->r[8] = rbrew_read32(cpu->mem, _t110);
-        /* 020D0804 */ _t111 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D0804 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D0804 */ _t112 = _t111 & 0x00000001u;
         /* 020D0804 */ if (_t112) goto L_020D080C; else goto L_020D0808;
   L_020D0808: ; // 0x20d0808
@@ -6507,10 +6507,10 @@ void Gambit_fn_020D0498(CPUState* cpu) {
         /* 020D088C */ rbrew_write32(cpu->mem, _t126, cpu->r[12]);
         /* 020D0890 */ _t127 = cpu->r[27] + 0x00000014u;
         /* 020D0890 */ cpu->r[0] = rbrew_read32(cpu->mem, _t127);
-        /* 020D0894 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 020D0894 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 020D0898 */ _t128 = cpu->r[27] + 0x00000018u;
         /* 020D0898 */ cpu->r[31] = rbrew_read32(cpu->mem, _t128);
-        /* 020D089C */ _t129 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D089C */ _t129 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D089C */ _t130 = _t129 & 0x00000001u;
         /* 020D089C */ if (_t130) goto L_020D08A0; else goto L_020D08A4;
   L_020D08A0: ; // 0x20d08a0
@@ -6526,23 +6526,23 @@ void Gambit_fn_020D0498(CPUState* cpu) {
         /* 020D08B8 */ _t133 = cpu->r[5] + 0x00000000u;
         /* 020D08B8 */ cpu->r[6] = rbrew_read8(cpu->mem, _t133);
         /* 020D08BC */ cpu->r[26] = 0x00000000u;
-        /* 020D08C0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[29]);
+        /* 020D08C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[29]));
         /* 020D08C4 */ cpu->r[7] = 0x00080000u;
-        /* 020D08C8 */ _t134 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D08C8 */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D08C8 */ _t135 = _t134 & 0x00000001u;
         /* 020D08C8 */ if (_t135) goto L_020D08F0; else goto L_020D08CC;
   L_020D08CC: ; // 0x20d08cc
         /* 020D08CC */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 020D08D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[7]);
+        /* 020D08D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[7]));
         /* 020D08D4 */ cpu->r[5] = cpu->r[5] + 0x00000001u;
-        /* 020D08D8 */ _t136 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D08D8 */ _t136 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D08D8 */ _t137 = _t136 & 0x00000001u;
         /* 020D08D8 */ if (_t137) goto L_020D08EC; else goto L_020D08DC;
   L_020D08DC: ; // 0x20d08dc
         /* 020D08DC */ _t138 = cpu->r[5] + 0x00000000u;
         /* 020D08DC */ cpu->r[8] = rbrew_read8(cpu->mem, _t138);
-        /* 020D08E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[29]);
-        /* 020D08E4 */ _t139 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D08E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[29]));
+        /* 020D08E4 */ _t139 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D08E4 */ _t140 = _t139 & 0x00000001u;
         /* 020D08E4 */ if (_t140) goto L_020D08E8; else goto L_020D08CC;
   L_020D08E8: ; // 0x20d08e8
@@ -6554,10 +6554,10 @@ void Gambit_fn_020D0498(CPUState* cpu) {
         /* 020D08F0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t141);
         /* 020D08F4 */ _t142 = cpu->r[1] + 0x00000010u;
         /* 020D08F4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t142);
-        /* 020D08F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[12]);
+        /* 020D08F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[12]));
         /* 020D08FC */ _t143 = cpu->r[10] + 0x00000014u;
         /* 020D08FC */ cpu->r[0] = rbrew_read32(cpu->mem, _t143);
-        /* 020D0900 */ _t144 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D0900 */ _t144 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D0900 */ _t145 = _t144 & 0x00000001u;
         /* 020D0900 */ if (_t145) goto L_020D0908; else goto L_020D0904;
   L_020D0904: ; // 0x20d0904
@@ -6869,8 +6869,8 @@ void Gambit_fn_020D0A90(CPUState* cpu) {
         /* 020D0A90 */ _t12 = cpu->r[3] + 0x00000118u;
         /* 020D0A90 */ cpu->r[12] = rbrew_read32(cpu->mem, _t12);
         /* 020D0A94 */ cpu->r[0] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 020D0A94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D0A98 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0A94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D0A98 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0A98 */ _t14 = _t13 & 0x00000001u;
         /* 020D0A98 */ if (_t14) goto L_020D0AA0; else goto L_020D0A9C;
   L_020D0A9C: ; // 0x20d0a9c
@@ -6913,8 +6913,8 @@ void Gambit_fn_020D0AB4(CPUState* cpu) {
         /* 020D0AE8 */ _t6 = cpu->r[1] + 0x00000008u;
         /* 020D0AE8 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 020D0AEC */ Gambit_fn_027ED700(cpu);
-        /* 020D0AF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D0AF4 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0AF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D0AF4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0AF4 */ _t8 = _t7 & 0x00000001u;
         /* 020D0AF4 */ if (_t8) goto L_020D0AF8; else goto L_020D0B18;
   L_020D0AF8: ; // 0x20d0af8
@@ -6978,8 +6978,8 @@ void Gambit_fn_020D0AB8(CPUState* cpu) {
         /* 020D0AE8 */ _t6 = cpu->r[1] + 0x00000008u;
         /* 020D0AE8 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 020D0AEC */ Gambit_fn_027ED700(cpu);
-        /* 020D0AF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D0AF4 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0AF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D0AF4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0AF4 */ _t8 = _t7 & 0x00000001u;
         /* 020D0AF4 */ if (_t8) goto L_020D0AF8; else goto L_020D0B18;
   L_020D0AF8: ; // 0x20d0af8
@@ -7168,8 +7168,8 @@ void Gambit_fn_020D0C0C(CPUState* cpu) {
         /* 020D0C18 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020D0C1C */ _t3 = cpu->r[31] + 0x000001E4u;
         /* 020D0C1C */ cpu->r[10] = rbrew_read32(cpu->mem, _t3);
-        /* 020D0C20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020D0C24 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0C20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020D0C24 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0C24 */ _t5 = _t4 & 0x00000001u;
         /* 020D0C24 */ if (_t5) goto L_020D0C28; else goto L_020D0C58;
   L_020D0C28: ; // 0x20d0c28
@@ -7194,8 +7194,8 @@ void Gambit_fn_020D0C0C(CPUState* cpu) {
         /* 020D0C58 */ cpu->r[4] = rbrew_read32(cpu->mem, _t10);
         /* 020D0C5C */ cpu->r[3] = cpu->r[31];
         /* 020D0C60 */ Gambit_fn_027EDF00(cpu);
-        /* 020D0C64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D0C68 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0C64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D0C68 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0C68 */ _t12 = _t11 & 0x00000001u;
         /* 020D0C68 */ if (_t12) goto L_020D0C80; else goto L_020D0C6C;
   L_020D0C6C: ; // 0x20d0c6c
@@ -7230,15 +7230,15 @@ void Gambit_fn_020D0C98(CPUState* cpu) {
         /* 020D0CA4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020D0CA8 */ _t3 = cpu->r[31] + 0x00000218u;
         /* 020D0CA8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 020D0CAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D0CB0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0CAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D0CB0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0CB0 */ _t5 = _t4 & 0x00000001u;
         /* 020D0CB0 */ if (_t5) goto L_020D0CB4; else goto L_020D0CC0;
   L_020D0CB4: ; // 0x20d0cb4
         /* 020D0CB4 */ _t6 = cpu->r[31] + 0x00000219u;
         /* 020D0CB4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t6);
-        /* 020D0CB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D0CBC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0CB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D0CBC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0CBC */ _t8 = _t7 & 0x00000001u;
         /* 020D0CBC */ if (_t8) goto L_020D0CDC; else goto L_020D0CC0;
   L_020D0CC0: ; // 0x20d0cc0
@@ -7278,8 +7278,8 @@ void Gambit_fn_020D0CF4(CPUState* cpu) {
         /* 020D0D04 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 020D0D08 */ _t4 = cpu->r[31] + 0x000001E4u;
         /* 020D0D08 */ cpu->r[10] = rbrew_read32(cpu->mem, _t4);
-        /* 020D0D0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020D0D10 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0D0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020D0D10 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0D10 */ _t6 = _t5 & 0x00000001u;
         /* 020D0D10 */ if (_t6) goto L_020D0D14; else goto L_020D0D74;
   L_020D0D14: ; // 0x20d0d14
@@ -7299,8 +7299,8 @@ void Gambit_fn_020D0CF4(CPUState* cpu) {
         /* 020D0D3C */ _t10 = cpu->r[1] + 0x00000008u;
         /* 020D0D3C */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
         /* 020D0D40 */ Gambit_fn_027ED2B0(cpu);
-        /* 020D0D44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D0D48 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0D44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D0D48 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0D48 */ _t12 = _t11 & 0x00000001u;
         /* 020D0D48 */ if (_t12) goto L_020D0D4C; else goto L_020D0D74;
   L_020D0D4C: ; // 0x20d0d4c
@@ -7323,15 +7323,15 @@ void Gambit_fn_020D0CF4(CPUState* cpu) {
         /* 020D0D74 */ cpu->r[4] = rbrew_read32(cpu->mem, _t17);
         /* 020D0D78 */ cpu->r[3] = cpu->r[31];
         /* 020D0D7C */ Gambit_fn_027EDF00(cpu);
-        /* 020D0D80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D0D84 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0D80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D0D84 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0D84 */ _t19 = _t18 & 0x00000001u;
         /* 020D0D84 */ if (_t19) goto L_020D0DE0; else goto L_020D0D88;
   L_020D0D88: ; // 0x20d0d88
         /* 020D0D88 */ _t20 = cpu->r[31] + 0x00000219u;
         /* 020D0D88 */ cpu->r[0] = rbrew_read8(cpu->mem, _t20);
-        /* 020D0D8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D0D90 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0D8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D0D90 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0D90 */ _t22 = _t21 & 0x00000001u;
         /* 020D0D90 */ if (_t22) goto L_020D0DCC; else goto L_020D0D94;
   L_020D0D94: ; // 0x20d0d94
@@ -7380,15 +7380,15 @@ void Gambit_fn_020D0DF8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D0DF8: ; // 0x20d0df8
-        /* 020D0DF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D0DFC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0DF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D0DFC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0DFC */ _t1 = _t0 & 0x00000001u;
         /* 020D0DFC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D0DFC */ goto L_020D0E00;
   L_020D0E00: ; // 0x20d0e00
         /* 020D0E00 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D0E00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D0E04 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0E00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D0E04 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0E04 */ _t3 = _t2 & 0x00000001u;
         /* 020D0E04 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D0E04 */ goto L_020D0E08;
@@ -7407,8 +7407,8 @@ void Gambit_fn_020D0DF8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -7422,15 +7422,15 @@ void Gambit_fn_020D0DF8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -7467,11 +7467,11 @@ void Gambit_fn_020D0E0C(CPUState* cpu) {
         /* 020D0E18 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D0E18 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D0E1C */ cpu->r[30] = cpu->r[3];
-        /* 020D0E1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D0E1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D0E20 */ cpu->r[31] = cpu->r[4];
         /* 020D0E24 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D0E24 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D0E28 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0E28 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0E28 */ _t5 = _t4 & 0x00000001u;
         /* 020D0E28 */ if (_t5) goto L_020D0E6C; else goto L_020D0E2C;
   L_020D0E2C: ; // 0x20d0e2c
@@ -7491,8 +7491,8 @@ void Gambit_fn_020D0E0C(CPUState* cpu) {
         /* 020D0E54 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D0E58 */ Gambit_fn_02068798(cpu);
         /* 020D0E5C */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D0E5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D0E60 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0E5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D0E60 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0E60 */ _t10 = _t9 & 0x00000001u;
         /* 020D0E60 */ if (_t10) goto L_020D0E6C; else goto L_020D0E64;
   L_020D0E64: ; // 0x20d0e64
@@ -7523,11 +7523,11 @@ void Gambit_fn_020D0E10(CPUState* cpu) {
         /* 020D0E18 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D0E18 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D0E1C */ cpu->r[30] = cpu->r[3];
-        /* 020D0E1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D0E1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D0E20 */ cpu->r[31] = cpu->r[4];
         /* 020D0E24 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D0E24 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D0E28 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0E28 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0E28 */ _t5 = _t4 & 0x00000001u;
         /* 020D0E28 */ if (_t5) goto L_020D0E6C; else goto L_020D0E2C;
   L_020D0E2C: ; // 0x20d0e2c
@@ -7547,8 +7547,8 @@ void Gambit_fn_020D0E10(CPUState* cpu) {
         /* 020D0E54 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D0E58 */ Gambit_fn_02068798(cpu);
         /* 020D0E5C */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D0E5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D0E60 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0E5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D0E60 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0E60 */ _t10 = _t9 & 0x00000001u;
         /* 020D0E60 */ if (_t10) goto L_020D0E6C; else goto L_020D0E64;
   L_020D0E64: ; // 0x20d0e64
@@ -7603,15 +7603,15 @@ void Gambit_fn_020D0E9C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D0E9C: ; // 0x20d0e9c
-        /* 020D0E9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D0EA0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0E9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D0EA0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0EA0 */ _t1 = _t0 & 0x00000001u;
         /* 020D0EA0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D0EA0 */ goto L_020D0EA4;
   L_020D0EA4: ; // 0x20d0ea4
         /* 020D0EA4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D0EA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D0EA8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0EA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D0EA8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0EA8 */ _t3 = _t2 & 0x00000001u;
         /* 020D0EA8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D0EA8 */ goto L_020D0EAC;
@@ -7630,8 +7630,8 @@ void Gambit_fn_020D0E9C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -7645,15 +7645,15 @@ void Gambit_fn_020D0E9C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -7699,15 +7699,15 @@ void Gambit_fn_020D0ECC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D0ECC: ; // 0x20d0ecc
-        /* 020D0ECC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D0ED0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0ECC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D0ED0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0ED0 */ _t1 = _t0 & 0x00000001u;
         /* 020D0ED0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D0ED0 */ goto L_020D0ED4;
   L_020D0ED4: ; // 0x20d0ed4
         /* 020D0ED4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D0ED4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D0ED8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0ED4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D0ED8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0ED8 */ _t3 = _t2 & 0x00000001u;
         /* 020D0ED8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D0ED8 */ goto L_020D0EDC;
@@ -7726,8 +7726,8 @@ void Gambit_fn_020D0ECC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -7741,15 +7741,15 @@ void Gambit_fn_020D0ECC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -7777,15 +7777,15 @@ void Gambit_fn_020D0EE0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D0EE0: ; // 0x20d0ee0
-        /* 020D0EE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D0EE4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0EE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D0EE4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0EE4 */ _t1 = _t0 & 0x00000001u;
         /* 020D0EE4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D0EE4 */ goto L_020D0EE8;
   L_020D0EE8: ; // 0x20d0ee8
         /* 020D0EE8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D0EE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D0EEC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0EE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D0EEC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0EEC */ _t3 = _t2 & 0x00000001u;
         /* 020D0EEC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D0EEC */ goto L_020D0EF0;
@@ -7804,8 +7804,8 @@ void Gambit_fn_020D0EE0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -7819,15 +7819,15 @@ void Gambit_fn_020D0EE0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -7933,9 +7933,9 @@ void Gambit_fn_020D0F34(CPUState* cpu) {
         /* 020D0F38 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 020D0F38 */ cpu->r[9] = _t0;
         /* 020D0F3C */ cpu->r[12] = 0x101D0000u;
-        /* 020D0F40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 020D0F40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 020D0F44 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 020D0F48 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0F48 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0F48 */ _t2 = _t1 & 0x00000001u;
         /* 020D0F48 */ if (_t2) goto L_020D0F4C; else goto L_020D0F60;
   L_020D0F4C: ; // 0x20d0f4c
@@ -7947,8 +7947,8 @@ void Gambit_fn_020D0F34(CPUState* cpu) {
         /* 020D0F5C */ _t4 = cpu->r[12] + 0x00000000u;
         /* 020D0F5C */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_020D0F60: ; // 0x20d0f60
-        /* 020D0F60 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 020D0F64 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0F60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 020D0F64 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0F64 */ _t6 = _t5 & 0x00000001u;
         /* 020D0F64 */ if (_t6) goto L_020D0F68; else goto L_020D0F70;
   L_020D0F68: ; // 0x20d0f68
@@ -7960,9 +7960,9 @@ void Gambit_fn_020D0F34(CPUState* cpu) {
         /* 020D0F74 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 020D0F74 */ cpu->r[7] = _t7;
         /* 020D0F78 */ cpu->r[11] = 0x101D0000u;
-        /* 020D0F7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020D0F7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020D0F80 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 020D0F84 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D0F84 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D0F84 */ _t9 = _t8 & 0x00000001u;
         /* 020D0F84 */ if (_t9) goto L_020D0F88; else goto L_020D0F9C;
   L_020D0F88: ; // 0x20d0f88
@@ -8053,18 +8053,18 @@ void Gambit_fn_020D0FD8(CPUState* cpu) {
         /* 0206AB40 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0206AB40 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0206AB44 */ cpu->r[12] = 0x00000000u;
-        /* 0206AB48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0206AB48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0206AB4C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0206AB4C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0206AB50 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206AB50 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206AB50 */ _t6 = _t5 & 0x00000001u;
         /* 0206AB50 */ if (_t6) goto L_0206AB78; else goto L_0206AB54;
   L_0206AB54: ; // 0x206ab54
         /* 0206AB54 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0206AB54 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0206AB58 */ /* nop */
-        /* 0206AB5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0206AB60 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206AB5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0206AB60 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206AB60 */ _t9 = _t8 & 0x00000001u;
         /* 0206AB60 */ if (_t9) goto L_0206AB64; else goto L_0206AB78;
   L_0206AB64: ; // 0x206ab64
@@ -8112,10 +8112,10 @@ void Gambit_fn_020D0FE4(CPUState* cpu) {
         /* 020D1004 */ cpu->r[31] = 0x101D0000u;
         /* 020D1008 */ _t3 = cpu->r[28] + 0x0000001Cu;
         /* 020D1008 */ rbrew_write32(cpu->mem, _t3, cpu->r[4]);
-        /* 020D100C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020D100C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020D1010 */ _t4 = cpu->r[28] + 0x0000000Fu;
         /* 020D1010 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[27]);
-        /* 020D1014 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1014 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1014 */ _t6 = _t5 & 0x00000001u;
         /* 020D1014 */ if (_t6) goto L_020D1058; else goto L_020D1018;
   L_020D1018: ; // 0x20d1018
@@ -8130,16 +8130,16 @@ void Gambit_fn_020D0FE4(CPUState* cpu) {
         /* 020D102C */ cpu->r[5] = 0x00000004u;
         /* 020D1030 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020D1034 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020D1038 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020D1038 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020D103C */ cpu->r[0] = cpu->r[27];
-        /* 020D1040 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D1040 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D1040 */ _t11 = _t10 & 0x00000001u;
         /* 020D1040 */ if (_t11) goto L_020D1048; else goto L_020D1044;
   L_020D1044: ; // 0x20d1044
         /* 020D1044 */ cpu->r[0] = 0x00000001u;
   L_020D1048: ; // 0x20d1048
-        /* 020D1048 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D104C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1048 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D104C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D104C */ _t13 = _t12 & 0x00000001u;
         /* 020D104C */ if (_t13) goto L_020D1058; else goto L_020D1050;
   L_020D1050: ; // 0x20d1050
@@ -8151,9 +8151,9 @@ void Gambit_fn_020D0FE4(CPUState* cpu) {
         /* 020D1058 */ _t16 = cpu->r[28] + 0x00000020u;
         /* 020D1058 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 020D105C */ cpu->r[0] = 0x00000000u;
-        /* 020D1060 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 020D1060 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 020D1064 */ cpu->r[12] = cpu->r[0];
-        /* 020D1068 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D1068 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D1068 */ _t18 = _t17 & 0x00000001u;
         /* 020D1068 */ if (_t18) goto L_020D106C; else goto L_020D1090;
   L_020D106C: ; // 0x20d106c
@@ -8178,8 +8178,8 @@ void Gambit_fn_020D0FE4(CPUState* cpu) {
   L_020D1090: ; // 0x20d1090
         /* 020D1090 */ _t26 = cpu->r[28] + 0x0000000Fu;
         /* 020D1090 */ cpu->r[27] = rbrew_read8(cpu->mem, _t26);
-        /* 020D1094 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020D1098 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1094 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020D1098 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1098 */ _t28 = _t27 & 0x00000001u;
         /* 020D1098 */ if (_t28) goto L_020D10DC; else goto L_020D109C;
   L_020D109C: ; // 0x20d109c
@@ -8194,16 +8194,16 @@ void Gambit_fn_020D0FE4(CPUState* cpu) {
         /* 020D10B0 */ cpu->r[5] = 0x00000004u;
         /* 020D10B4 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020D10B8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020D10BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020D10BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020D10C0 */ cpu->r[11] = cpu->r[27];
-        /* 020D10C4 */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D10C4 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D10C4 */ _t33 = _t32 & 0x00000001u;
         /* 020D10C4 */ if (_t33) goto L_020D10CC; else goto L_020D10C8;
   L_020D10C8: ; // 0x20d10c8
         /* 020D10C8 */ cpu->r[11] = 0x00000001u;
   L_020D10CC: ; // 0x20d10cc
-        /* 020D10CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D10D0 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D10CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D10D0 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D10D0 */ _t35 = _t34 & 0x00000001u;
         /* 020D10D0 */ if (_t35) goto L_020D10DC; else goto L_020D10D4;
   L_020D10D4: ; // 0x20d10d4
@@ -8215,9 +8215,9 @@ void Gambit_fn_020D0FE4(CPUState* cpu) {
         /* 020D10DC */ _t38 = cpu->r[28] + 0x00000028u;
         /* 020D10DC */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 020D10E0 */ cpu->r[0] = 0x00000000u;
-        /* 020D10E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 020D10E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 020D10E8 */ cpu->r[12] = cpu->r[0];
-        /* 020D10EC */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D10EC */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D10EC */ _t40 = _t39 & 0x00000001u;
         /* 020D10EC */ if (_t40) goto L_020D10F0; else goto L_020D1114;
   L_020D10F0: ; // 0x20d10f0
@@ -8242,8 +8242,8 @@ void Gambit_fn_020D0FE4(CPUState* cpu) {
   L_020D1114: ; // 0x20d1114
         /* 020D1114 */ _t48 = cpu->r[28] + 0x0000000Fu;
         /* 020D1114 */ cpu->r[27] = rbrew_read8(cpu->mem, _t48);
-        /* 020D1118 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020D111C */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1118 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020D111C */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D111C */ _t50 = _t49 & 0x00000001u;
         /* 020D111C */ if (_t50) goto L_020D1160; else goto L_020D1120;
   L_020D1120: ; // 0x20d1120
@@ -8258,16 +8258,16 @@ void Gambit_fn_020D0FE4(CPUState* cpu) {
         /* 020D1134 */ cpu->r[5] = 0x00000004u;
         /* 020D1138 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020D113C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020D1140 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020D1140 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020D1144 */ cpu->r[10] = cpu->r[27];
-        /* 020D1148 */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D1148 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D1148 */ _t55 = _t54 & 0x00000001u;
         /* 020D1148 */ if (_t55) goto L_020D1150; else goto L_020D114C;
   L_020D114C: ; // 0x20d114c
         /* 020D114C */ cpu->r[10] = 0x00000001u;
   L_020D1150: ; // 0x20d1150
-        /* 020D1150 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D1154 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1150 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D1154 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1154 */ _t57 = _t56 & 0x00000001u;
         /* 020D1154 */ if (_t57) goto L_020D1160; else goto L_020D1158;
   L_020D1158: ; // 0x20d1158
@@ -8279,9 +8279,9 @@ void Gambit_fn_020D0FE4(CPUState* cpu) {
         /* 020D1160 */ _t60 = cpu->r[28] + 0x00000030u;
         /* 020D1160 */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
         /* 020D1164 */ cpu->r[0] = 0x00000000u;
-        /* 020D1168 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 020D1168 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 020D116C */ cpu->r[5] = cpu->r[0];
-        /* 020D1170 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D1170 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D1170 */ _t62 = _t61 & 0x00000001u;
         /* 020D1170 */ if (_t62) goto L_020D1174; else goto L_020D1198;
   L_020D1174: ; // 0x20d1174
@@ -8306,8 +8306,8 @@ void Gambit_fn_020D0FE4(CPUState* cpu) {
   L_020D1198: ; // 0x20d1198
         /* 020D1198 */ _t70 = cpu->r[30] + 0x00000000u;
         /* 020D1198 */ cpu->r[25] = rbrew_read8(cpu->mem, _t70);
-        /* 020D119C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 020D11A0 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D119C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 020D11A0 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D11A0 */ _t72 = _t71 & 0x00000001u;
         /* 020D11A0 */ if (_t72) goto L_020D127C; else goto L_020D11A4;
   L_020D11A4: ; // 0x20d11a4
@@ -8323,10 +8323,10 @@ void Gambit_fn_020D0FE4(CPUState* cpu) {
         /* 020D11BC */ cpu->r[4] = (uint32_t)((int32_t)cpu->r[25] * (int32_t)0x00000024u);
         /* 020D11C0 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020D11C4 */ cpu->r[24] = cpu->r[3];
-        /* 020D11C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 020D11C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 020D11CC */ cpu->r[30] = cpu->r[25];
         /* 020D11D0 */ cpu->r[7] = 0x00000000u;
-        /* 020D11D4 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D11D4 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D11D4 */ _t77 = _t76 & 0x00000001u;
         /* 020D11D4 */ if (_t77) goto L_020D11DC; else goto L_020D11D8;
   L_020D11D8: ; // 0x20d11d8
@@ -8339,36 +8339,36 @@ void Gambit_fn_020D0FE4(CPUState* cpu) {
         /* 020D11E8 */ cpu->r[23] = 0x00000018u;
   L_020D11EC: ; // 0x20d11ec
         /* 020D11EC */ cpu->r[27] = cpu->r[24] + cpu->r[22];
-        /* 020D11EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020D11F0 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D11EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020D11F0 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D11F0 */ _t80 = _t79 & 0x00000001u;
         /* 020D11F0 */ if (_t80) goto L_020D1260; else goto L_020D11F4;
   L_020D11F4: ; // 0x20d11f4
         /* 020D11F4 */ cpu->r[26] = cpu->r[27];
-        /* 020D11F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 020D11F8 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D11F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 020D11F8 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D11F8 */ _t82 = _t81 & 0x00000001u;
         /* 020D11F8 */ if (_t82) goto L_020D11FC; else goto L_020D120C;
   L_020D11FC: ; // 0x20d11fc
         /* 020D11FC */ cpu->r[3] = 0x00000024u;
         /* 020D1200 */ Gambit_fn_02801A78(cpu);
         /* 020D1204 */ cpu->r[26] = cpu->r[3];
-        /* 020D1204 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 020D1208 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1204 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 020D1208 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1208 */ _t84 = _t83 & 0x00000001u;
         /* 020D1208 */ if (_t84) goto L_020D1254; else goto L_020D120C;
   L_020D120C: ; // 0x20d120c
         /* 020D120C */ cpu->r[11] = cpu->r[26];
-        /* 020D120C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020D1210 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D120C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020D1210 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1210 */ _t86 = _t85 & 0x00000001u;
         /* 020D1210 */ if (_t86) goto L_020D1214; else goto L_020D1224;
   L_020D1214: ; // 0x20d1214
         /* 020D1214 */ cpu->r[3] = 0x0000000Cu;
         /* 020D1218 */ Gambit_fn_02801A78(cpu);
         /* 020D121C */ cpu->r[11] = cpu->r[3];
-        /* 020D121C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020D1220 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D121C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020D1220 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1220 */ _t88 = _t87 & 0x00000001u;
         /* 020D1220 */ if (_t88) goto L_020D1240; else goto L_020D1224;
   L_020D1224: ; // 0x20d1224
@@ -8399,14 +8399,14 @@ void Gambit_fn_020D0FE4(CPUState* cpu) {
         /* 020D125C */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
   L_020D1260: ; // 0x20d1260
         /* 020D1260 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 020D1260 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D1260 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D1264 */ cpu->r[22] = cpu->r[22] + 0x00000024u;
-        /* 020D1268 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1268 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1268 */ _t98 = _t97 & 0x00000001u;
         /* 020D1268 */ if (_t98) goto L_020D126C; else goto L_020D11EC;
   L_020D126C: ; // 0x20d126c
-        /* 020D126C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 020D1270 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D126C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 020D1270 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1270 */ _t100 = _t99 & 0x00000001u;
         /* 020D1270 */ if (_t100) goto L_020D127C; else goto L_020D1274;
   L_020D1274: ; // 0x20d1274
@@ -8436,10 +8436,10 @@ void Gambit_fn_020D1294(CPUState* cpu) {
         /* 020D1298 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 020D129C */ _t2 = cpu->r[3] + 0x00000024u;
         /* 020D129C */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 020D12A0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[12]);
+        /* 020D12A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[12]));
         /* 020D12A4 */ _t3 = cpu->r[4] + 0x00000000u;
         /* 020D12A4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 020D12A8 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D12A8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D12A8 */ _t5 = _t4 & 0x00000001u;
         /* 020D12A8 */ if (_t5) goto L_020D12AC; else goto L_020D12B4;
   L_020D12AC: ; // 0x20d12ac
@@ -8456,10 +8456,10 @@ void Gambit_fn_020D1294(CPUState* cpu) {
         /* 020D12C0 */ cpu->r[9] = rbrew_read8(cpu->mem, _t9);
         /* 020D12C4 */ _t10 = cpu->r[3] + 0x00000028u;
         /* 020D12C4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 020D12C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
+        /* 020D12C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
         /* 020D12CC */ _t11 = cpu->r[3] + 0x0000002Cu;
         /* 020D12CC */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
-        /* 020D12D0 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D12D0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D12D0 */ _t13 = _t12 & 0x00000001u;
         /* 020D12D0 */ if (_t13) goto L_020D12D4; else goto L_020D12DC;
   L_020D12D4: ; // 0x20d12d4
@@ -8480,10 +8480,10 @@ void Gambit_fn_020D1294(CPUState* cpu) {
         /* 020D12F0 */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
         /* 020D12F4 */ _t20 = cpu->r[3] + 0x00000034u;
         /* 020D12F4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 020D12F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
+        /* 020D12F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
         /* 020D12FC */ _t21 = cpu->r[6] + 0x00000000u;
         /* 020D12FC */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
-        /* 020D1300 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D1300 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D1300 */ _t23 = _t22 & 0x00000001u;
         /* 020D1300 */ if (_t23) goto L_020D1304; else goto L_020D130C;
   L_020D1304: ; // 0x20d1304
@@ -8516,11 +8516,11 @@ void Gambit_fn_020D131C(CPUState* cpu) {
         /* 020D242C */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D242C */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D2430 */ cpu->r[30] = cpu->r[3];
-        /* 020D2430 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D2430 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D2434 */ cpu->r[31] = cpu->r[4];
         /* 020D2438 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D2438 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D243C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D243C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D243C */ _t5 = _t4 & 0x00000001u;
         /* 020D243C */ if (_t5) goto L_020D2480; else goto L_020D2440;
   L_020D2440: ; // 0x20d2440
@@ -8540,8 +8540,8 @@ void Gambit_fn_020D131C(CPUState* cpu) {
         /* 020D2468 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D246C */ Gambit_fn_02068798(cpu);
         /* 020D2470 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D2470 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D2474 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2470 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D2474 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2474 */ _t10 = _t9 & 0x00000001u;
         /* 020D2474 */ if (_t10) goto L_020D2480; else goto L_020D2478;
   L_020D2478: ; // 0x20d2478
@@ -8569,8 +8569,8 @@ void Gambit_fn_020D1324(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -8622,18 +8622,18 @@ void Gambit_fn_020D133C(CPUState* cpu) {
         /* 020D1344 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020D1348 */ /* nop */
         /* 020D134C */ cpu->r[29] = cpu->r[3];
-        /* 020D134C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020D134C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020D1350 */ cpu->r[30] = cpu->r[4];
         /* 020D1354 */ cpu->r[31] = cpu->r[5];
-        /* 020D1358 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1358 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1358 */ _t3 = _t2 & 0x00000001u;
         /* 020D1358 */ if (_t3) goto L_020D135C; else goto L_020D136C;
   L_020D135C: ; // 0x20d135c
         /* 020D135C */ cpu->r[3] = 0x00000228u;
         /* 020D1360 */ Gambit_fn_02801A78(cpu);
         /* 020D1364 */ cpu->r[29] = cpu->r[3];
-        /* 020D1364 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020D1368 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1364 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020D1368 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1368 */ _t5 = _t4 & 0x00000001u;
         /* 020D1368 */ if (_t5) goto L_020D18AC; else goto L_020D136C;
   L_020D136C: ; // 0x20d136c
@@ -8660,22 +8660,22 @@ void Gambit_fn_020D133C(CPUState* cpu) {
         /* 020D13AC */ rbrew_write32(cpu->mem, _t9, cpu->r[5]);
         /* 020D13B0 */ cpu->r[7] = cpu->r[7] + 0x00007DD8u;
         /* 020D13B4 */ cpu->r[27] = cpu->r[29] + 0x000001DCu;
-        /* 020D13B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020D13B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020D13B8 */ _t10 = cpu->r[29] + 0x0000001Cu;
         /* 020D13B8 */ rbrew_write32(cpu->mem, _t10, cpu->r[6]);
         /* 020D13BC */ cpu->r[28] = 0x00000000u;
         /* 020D13C0 */ cpu->r[30] = cpu->r[27];
         /* 020D13C4 */ _t11 = cpu->r[29] + 0x000001C8u;
         /* 020D13C4 */ rbrew_write32(cpu->mem, _t11, cpu->r[7]);
-        /* 020D13C8 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D13C8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D13C8 */ _t13 = _t12 & 0x00000001u;
         /* 020D13C8 */ if (_t13) goto L_020D13CC; else goto L_020D13DC;
   L_020D13CC: ; // 0x20d13cc
         /* 020D13CC */ cpu->r[3] = 0x00000038u;
         /* 020D13D0 */ Gambit_fn_02801A78(cpu);
         /* 020D13D4 */ cpu->r[30] = cpu->r[3];
-        /* 020D13D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 020D13D8 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D13D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 020D13D8 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D13D8 */ _t15 = _t14 & 0x00000001u;
         /* 020D13D8 */ if (_t15) goto L_020D140C; else goto L_020D13DC;
   L_020D13DC: ; // 0x20d13dc
@@ -8703,21 +8703,21 @@ void Gambit_fn_020D133C(CPUState* cpu) {
         /* 020D140C */ _t24 = cpu->r[29] + 0x0000021Cu;
         /* 020D140C */ rbrew_write32(cpu->mem, _t24, cpu->r[28]);
         /* 020D1410 */ cpu->r[3] = cpu->r[29] + 0x00000220u;
-        /* 020D1410 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 020D1410 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 020D1414 */ _t25 = cpu->r[29] + 0x00000218u;
         /* 020D1414 */ rbrew_write8(cpu->mem, _t25, (uint8_t)cpu->r[28]);
         /* 020D1418 */ _t26 = cpu->r[29] + 0x00000219u;
         /* 020D1418 */ rbrew_write8(cpu->mem, _t26, (uint8_t)cpu->r[28]);
         /* 020D141C */ _t27 = cpu->r[29] + 0x00000214u;
         /* 020D141C */ rbrew_write32(cpu->mem, _t27, cpu->r[31]);
-        /* 020D1420 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1420 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1420 */ _t29 = _t28 & 0x00000001u;
         /* 020D1420 */ if (_t29) goto L_020D1424; else goto L_020D1434;
   L_020D1424: ; // 0x20d1424
         /* 020D1424 */ cpu->r[3] = 0x00000008u;
         /* 020D1428 */ Gambit_fn_02801A78(cpu);
-        /* 020D142C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D1430 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D142C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D1430 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1430 */ _t31 = _t30 & 0x00000001u;
         /* 020D1430 */ if (_t31) goto L_020D143C; else goto L_020D1434;
   L_020D1434: ; // 0x20d1434
@@ -8757,23 +8757,23 @@ void Gambit_fn_020D133C(CPUState* cpu) {
         /* 020D1490 */ _t41 = cpu->r[5] + 0x00000000u;
         /* 020D1490 */ cpu->r[10] = rbrew_read8(cpu->mem, _t41);
         /* 020D1494 */ cpu->r[31] = 0x00000000u;
-        /* 020D1498 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[30]);
+        /* 020D1498 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[30]));
         /* 020D149C */ cpu->r[7] = 0x00080000u;
-        /* 020D14A0 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D14A0 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D14A0 */ _t43 = _t42 & 0x00000001u;
         /* 020D14A0 */ if (_t43) goto L_020D14C8; else goto L_020D14A4;
   L_020D14A4: ; // 0x20d14a4
         /* 020D14A4 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020D14A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 020D14A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 020D14AC */ cpu->r[5] = cpu->r[5] + 0x00000001u;
-        /* 020D14B0 */ _t44 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D14B0 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D14B0 */ _t45 = _t44 & 0x00000001u;
         /* 020D14B0 */ if (_t45) goto L_020D14C4; else goto L_020D14B4;
   L_020D14B4: ; // 0x20d14b4
         /* 020D14B4 */ _t46 = cpu->r[5] + 0x00000000u;
         /* 020D14B4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t46);
-        /* 020D14B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
-        /* 020D14BC */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D14B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
+        /* 020D14BC */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D14BC */ _t48 = _t47 & 0x00000001u;
         /* 020D14BC */ if (_t48) goto L_020D14C0; else goto L_020D14A4;
   L_020D14C0: ; // 0x20d14c0
@@ -8785,10 +8785,10 @@ void Gambit_fn_020D133C(CPUState* cpu) {
         /* 020D14C8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t49);
         /* 020D14CC */ _t50 = cpu->r[1] + 0x00000010u;
         /* 020D14CC */ cpu->r[12] = rbrew_read32(cpu->mem, _t50);
-        /* 020D14D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 020D14D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 020D14D4 */ _t51 = cpu->r[12] + 0x00000014u;
         /* 020D14D4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t51);
-        /* 020D14D8 */ _t52 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D14D8 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D14D8 */ _t53 = _t52 & 0x00000001u;
         /* 020D14D8 */ if (_t53) goto L_020D14E0; else goto L_020D14DC;
   L_020D14DC: ; // 0x20d14dc
@@ -8843,10 +8843,10 @@ void Gambit_fn_020D133C(CPUState* cpu) {
         /* 020D1560 */ rbrew_write32(cpu->mem, _t67, cpu->r[7]);
         /* 020D1564 */ _t68 = cpu->r[27] + 0x00000014u;
         /* 020D1564 */ cpu->r[8] = rbrew_read32(cpu->mem, _t68);
-        /* 020D1568 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000001u);
+        /* 020D1568 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000001u));
         /* 020D156C */ _t69 = cpu->r[27] + 0x00000018u;
         /* 020D156C */ cpu->r[26] = rbrew_read32(cpu->mem, _t69);
-        /* 020D1570 */ _t70 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D1570 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D1570 */ _t71 = _t70 & 0x00000001u;
         /* 020D1570 */ if (_t71) goto L_020D1574; else goto L_020D1578;
   L_020D1574: ; // 0x20d1574
@@ -8862,23 +8862,23 @@ void Gambit_fn_020D133C(CPUState* cpu) {
         /* 020D158C */ _t74 = cpu->r[10] + 0x00000000u;
         /* 020D158C */ cpu->r[9] = rbrew_read8(cpu->mem, _t74);
         /* 020D1590 */ cpu->r[31] = 0x00000000u;
-        /* 020D1594 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[30]);
+        /* 020D1594 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[30]));
         /* 020D1598 */ cpu->r[12] = 0x00080000u;
-        /* 020D159C */ _t75 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D159C */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D159C */ _t76 = _t75 & 0x00000001u;
         /* 020D159C */ if (_t76) goto L_020D15C4; else goto L_020D15A0;
   L_020D15A0: ; // 0x20d15a0
         /* 020D15A0 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020D15A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 020D15A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 020D15A8 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 020D15AC */ _t77 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D15AC */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D15AC */ _t78 = _t77 & 0x00000001u;
         /* 020D15AC */ if (_t78) goto L_020D15C0; else goto L_020D15B0;
   L_020D15B0: ; // 0x20d15b0
         /* 020D15B0 */ _t79 = cpu->r[10] + 0x00000000u;
         /* 020D15B0 */ cpu->r[11] = rbrew_read8(cpu->mem, _t79);
-        /* 020D15B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[30]);
-        /* 020D15B8 */ _t80 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D15B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[30]));
+        /* 020D15B8 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D15B8 */ _t81 = _t80 & 0x00000001u;
         /* 020D15B8 */ if (_t81) goto L_020D15BC; else goto L_020D15A0;
   L_020D15BC: ; // 0x20d15bc
@@ -8890,10 +8890,10 @@ void Gambit_fn_020D133C(CPUState* cpu) {
         /* 020D15C4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t82);
         /* 020D15C8 */ _t83 = cpu->r[1] + 0x00000010u;
         /* 020D15C8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t83);
-        /* 020D15CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 020D15CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 020D15D0 */ _t84 = cpu->r[5] + 0x00000014u;
         /* 020D15D0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t84);
-        /* 020D15D4 */ _t85 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D15D4 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D15D4 */ _t86 = _t85 & 0x00000001u;
         /* 020D15D4 */ if (_t86) goto L_020D15DC; else goto L_020D15D8;
   L_020D15D8: ; // 0x20d15d8
@@ -8948,10 +8948,10 @@ void Gambit_fn_020D133C(CPUState* cpu) {
         /* 020D165C */ rbrew_write32(cpu->mem, _t100, cpu->r[0]);
         /* 020D1660 */ _t101 = cpu->r[27] + 0x00000014u;
         /* 020D1660 */ cpu->r[5] = rbrew_read32(cpu->mem, _t101);
-        /* 020D1664 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x00000002u);
+        /* 020D1664 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x00000002u));
         /* 020D1668 */ _t102 = cpu->r[27] + 0x00000018u;
         /* 020D1668 */ cpu->r[26] = rbrew_read32(cpu->mem, _t102);
-        /* 020D166C */ _t103 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D166C */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D166C */ _t104 = _t103 & 0x00000001u;
         /* 020D166C */ if (_t104) goto L_020D1670; else goto L_020D1674;
   L_020D1670: ; // 0x20d1670
@@ -8967,23 +8967,23 @@ void Gambit_fn_020D133C(CPUState* cpu) {
         /* 020D1688 */ _t107 = cpu->r[6] + 0x00000000u;
         /* 020D1688 */ cpu->r[8] = rbrew_read8(cpu->mem, _t107);
         /* 020D168C */ cpu->r[31] = 0x00000000u;
-        /* 020D1690 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[30]);
+        /* 020D1690 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[30]));
         /* 020D1694 */ cpu->r[7] = 0x00080000u;
-        /* 020D1698 */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1698 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1698 */ _t109 = _t108 & 0x00000001u;
         /* 020D1698 */ if (_t109) goto L_020D16C0; else goto L_020D169C;
   L_020D169C: ; // 0x20d169c
         /* 020D169C */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020D16A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 020D16A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 020D16A4 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 020D16A8 */ _t110 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D16A8 */ _t110 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D16A8 */ _t111 = _t110 & 0x00000001u;
         /* 020D16A8 */ if (_t111) goto L_020D16BC; else goto L_020D16AC;
   L_020D16AC: ; // 0x20d16ac
         /* 020D16AC */ _t112 = cpu->r[6] + 0x00000000u;
         /* 020D16AC */ cpu->r[0] = rbrew_read8(cpu->mem, _t112);
-        /* 020D16B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
-        /* 020D16B4 */ _t113 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D16B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
+        /* 020D16B4 */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D16B4 */ _t114 = _t113 & 0x00000001u;
         /* 020D16B4 */ if (_t114) goto L_020D16B8; else goto L_020D169C;
   L_020D16B8: ; // 0x20d16b8
@@ -8995,10 +8995,10 @@ void Gambit_fn_020D133C(CPUState* cpu) {
         /* 020D16C0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t115);
         /* 020D16C4 */ _t116 = cpu->r[1] + 0x00000010u;
         /* 020D16C4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t116);
-        /* 020D16C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 020D16C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 020D16CC */ _t117 = cpu->r[11] + 0x00000014u;
         /* 020D16CC */ cpu->r[0] = rbrew_read32(cpu->mem, _t117);
-        /* 020D16D0 */ _t118 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D16D0 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D16D0 */ _t119 = _t118 & 0x00000001u;
         /* 020D16D0 */ if (_t119) goto L_020D16D8; else goto L_020D16D4;
   L_020D16D4: ; // 0x20d16d4
@@ -9053,10 +9053,10 @@ void Gambit_fn_020D133C(CPUState* cpu) {
         /* 020D1758 */ rbrew_write32(cpu->mem, _t133, cpu->r[8]);
         /* 020D175C */ _t134 = cpu->r[27] + 0x00000014u;
         /* 020D175C */ cpu->r[9] = rbrew_read32(cpu->mem, _t134);
-        /* 020D1760 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000003u);
+        /* 020D1760 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000003u));
         /* 020D1764 */ _t135 = cpu->r[27] + 0x00000018u;
         /* 020D1764 */ cpu->r[26] = rbrew_read32(cpu->mem, _t135);
-        /* 020D1768 */ _t136 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D1768 */ _t136 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D1768 */ _t137 = _t136 & 0x00000001u;
         /* 020D1768 */ if (_t137) goto L_020D176C; else goto L_020D1770;
   L_020D176C: ; // 0x20d176c
@@ -9072,23 +9072,23 @@ void Gambit_fn_020D133C(CPUState* cpu) {
         /* 020D1784 */ _t140 = cpu->r[10] + 0x00000000u;
         /* 020D1784 */ cpu->r[11] = rbrew_read8(cpu->mem, _t140);
         /* 020D1788 */ cpu->r[31] = 0x00000000u;
-        /* 020D178C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[30]);
+        /* 020D178C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[30]));
         /* 020D1790 */ cpu->r[12] = 0x00080000u;
-        /* 020D1794 */ _t141 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1794 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1794 */ _t142 = _t141 & 0x00000001u;
         /* 020D1794 */ if (_t142) goto L_020D17BC; else goto L_020D1798;
   L_020D1798: ; // 0x20d1798
         /* 020D1798 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020D179C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 020D179C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 020D17A0 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 020D17A4 */ _t143 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D17A4 */ _t143 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D17A4 */ _t144 = _t143 & 0x00000001u;
         /* 020D17A4 */ if (_t144) goto L_020D17B8; else goto L_020D17A8;
   L_020D17A8: ; // 0x20d17a8
         /* 020D17A8 */ _t145 = cpu->r[10] + 0x00000000u;
         /* 020D17A8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t145);
-        /* 020D17AC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
-        /* 020D17B0 */ _t146 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D17AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
+        /* 020D17B0 */ _t146 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D17B0 */ _t147 = _t146 & 0x00000001u;
         /* 020D17B0 */ if (_t147) goto L_020D17B4; else goto L_020D1798;
   L_020D17B4: ; // 0x20d17b4
@@ -9100,10 +9100,10 @@ void Gambit_fn_020D133C(CPUState* cpu) {
         /* 020D17BC */ cpu->r[7] = rbrew_read32(cpu->mem, _t148);
         /* 020D17C0 */ _t149 = cpu->r[1] + 0x00000010u;
         /* 020D17C0 */ cpu->r[6] = rbrew_read32(cpu->mem, _t149);
-        /* 020D17C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 020D17C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 020D17C8 */ _t150 = cpu->r[6] + 0x00000014u;
         /* 020D17C8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t150);
-        /* 020D17CC */ _t151 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D17CC */ _t151 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D17CC */ _t152 = _t151 & 0x00000001u;
         /* 020D17CC */ if (_t152) goto L_020D17D4; else goto L_020D17D0;
   L_020D17D0: ; // 0x20d17d0
@@ -9164,8 +9164,8 @@ void Gambit_fn_020D133C(CPUState* cpu) {
         /* 020D1864 */ cpu->r[4] = 0x00000008u;
         /* 020D1868 */ cpu->r[5] = 0x00000004u;
         /* 020D186C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020D1870 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D1874 */ _t169 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1870 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D1874 */ _t169 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1874 */ _t170 = _t169 & 0x00000001u;
         /* 020D1874 */ if (_t170) goto L_020D1884; else goto L_020D1878;
   L_020D1878: ; // 0x20d1878
@@ -9177,8 +9177,8 @@ void Gambit_fn_020D133C(CPUState* cpu) {
   L_020D1884: ; // 0x20d1884
         /* 020D1884 */ _t173 = cpu->r[29] + 0x00000220u;
         /* 020D1884 */ cpu->r[10] = rbrew_read32(cpu->mem, _t173);
-        /* 020D1888 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020D188C */ _t174 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D1888 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020D188C */ _t174 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D188C */ _t175 = _t174 & 0x00000001u;
         /* 020D188C */ if (_t175) goto L_020D1890; else goto L_020D18AC;
   L_020D1890: ; // 0x20d1890
@@ -9218,18 +9218,18 @@ void Gambit_fn_020D1340(CPUState* cpu) {
         /* 020D1344 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020D1348 */ /* nop */
         /* 020D134C */ cpu->r[29] = cpu->r[3];
-        /* 020D134C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020D134C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020D1350 */ cpu->r[30] = cpu->r[4];
         /* 020D1354 */ cpu->r[31] = cpu->r[5];
-        /* 020D1358 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1358 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1358 */ _t3 = _t2 & 0x00000001u;
         /* 020D1358 */ if (_t3) goto L_020D135C; else goto L_020D136C;
   L_020D135C: ; // 0x20d135c
         /* 020D135C */ cpu->r[3] = 0x00000228u;
         /* 020D1360 */ Gambit_fn_02801A78(cpu);
         /* 020D1364 */ cpu->r[29] = cpu->r[3];
-        /* 020D1364 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020D1368 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1364 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020D1368 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1368 */ _t5 = _t4 & 0x00000001u;
         /* 020D1368 */ if (_t5) goto L_020D18AC; else goto L_020D136C;
   L_020D136C: ; // 0x20d136c
@@ -9256,22 +9256,22 @@ void Gambit_fn_020D1340(CPUState* cpu) {
         /* 020D13AC */ rbrew_write32(cpu->mem, _t9, cpu->r[5]);
         /* 020D13B0 */ cpu->r[7] = cpu->r[7] + 0x00007DD8u;
         /* 020D13B4 */ cpu->r[27] = cpu->r[29] + 0x000001DCu;
-        /* 020D13B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020D13B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020D13B8 */ _t10 = cpu->r[29] + 0x0000001Cu;
         /* 020D13B8 */ rbrew_write32(cpu->mem, _t10, cpu->r[6]);
         /* 020D13BC */ cpu->r[28] = 0x00000000u;
         /* 020D13C0 */ cpu->r[30] = cpu->r[27];
         /* 020D13C4 */ _t11 = cpu->r[29] + 0x000001C8u;
         /* 020D13C4 */ rbrew_write32(cpu->mem, _t11, cpu->r[7]);
-        /* 020D13C8 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D13C8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D13C8 */ _t13 = _t12 & 0x00000001u;
         /* 020D13C8 */ if (_t13) goto L_020D13CC; else goto L_020D13DC;
   L_020D13CC: ; // 0x20d13cc
         /* 020D13CC */ cpu->r[3] = 0x00000038u;
         /* 020D13D0 */ Gambit_fn_02801A78(cpu);
         /* 020D13D4 */ cpu->r[30] = cpu->r[3];
-        /* 020D13D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 020D13D8 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D13D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 020D13D8 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D13D8 */ _t15 = _t14 & 0x00000001u;
         /* 020D13D8 */ if (_t15) goto L_020D140C; else goto L_020D13DC;
   L_020D13DC: ; // 0x20d13dc
@@ -9299,21 +9299,21 @@ void Gambit_fn_020D1340(CPUState* cpu) {
         /* 020D140C */ _t24 = cpu->r[29] + 0x0000021Cu;
         /* 020D140C */ rbrew_write32(cpu->mem, _t24, cpu->r[28]);
         /* 020D1410 */ cpu->r[3] = cpu->r[29] + 0x00000220u;
-        /* 020D1410 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 020D1410 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 020D1414 */ _t25 = cpu->r[29] + 0x00000218u;
         /* 020D1414 */ rbrew_write8(cpu->mem, _t25, (uint8_t)cpu->r[28]);
         /* 020D1418 */ _t26 = cpu->r[29] + 0x00000219u;
         /* 020D1418 */ rbrew_write8(cpu->mem, _t26, (uint8_t)cpu->r[28]);
         /* 020D141C */ _t27 = cpu->r[29] + 0x00000214u;
         /* 020D141C */ rbrew_write32(cpu->mem, _t27, cpu->r[31]);
-        /* 020D1420 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1420 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1420 */ _t29 = _t28 & 0x00000001u;
         /* 020D1420 */ if (_t29) goto L_020D1424; else goto L_020D1434;
   L_020D1424: ; // 0x20d1424
         /* 020D1424 */ cpu->r[3] = 0x00000008u;
         /* 020D1428 */ Gambit_fn_02801A78(cpu);
-        /* 020D142C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D1430 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D142C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D1430 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1430 */ _t31 = _t30 & 0x00000001u;
         /* 020D1430 */ if (_t31) goto L_020D143C; else goto L_020D1434;
   L_020D1434: ; // 0x20d1434
@@ -9353,23 +9353,23 @@ void Gambit_fn_020D1340(CPUState* cpu) {
         /* 020D1490 */ _t41 = cpu->r[5] + 0x00000000u;
         /* 020D1490 */ cpu->r[10] = rbrew_read8(cpu->mem, _t41);
         /* 020D1494 */ cpu->r[31] = 0x00000000u;
-        /* 020D1498 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[30]);
+        /* 020D1498 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[30]));
         /* 020D149C */ cpu->r[7] = 0x00080000u;
-        /* 020D14A0 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D14A0 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D14A0 */ _t43 = _t42 & 0x00000001u;
         /* 020D14A0 */ if (_t43) goto L_020D14C8; else goto L_020D14A4;
   L_020D14A4: ; // 0x20d14a4
         /* 020D14A4 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020D14A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 020D14A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 020D14AC */ cpu->r[5] = cpu->r[5] + 0x00000001u;
-        /* 020D14B0 */ _t44 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D14B0 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D14B0 */ _t45 = _t44 & 0x00000001u;
         /* 020D14B0 */ if (_t45) goto L_020D14C4; else goto L_020D14B4;
   L_020D14B4: ; // 0x20d14b4
         /* 020D14B4 */ _t46 = cpu->r[5] + 0x00000000u;
         /* 020D14B4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t46);
-        /* 020D14B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
-        /* 020D14BC */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D14B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
+        /* 020D14BC */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D14BC */ _t48 = _t47 & 0x00000001u;
         /* 020D14BC */ if (_t48) goto L_020D14C0; else goto L_020D14A4;
   L_020D14C0: ; // 0x20d14c0
@@ -9381,10 +9381,10 @@ void Gambit_fn_020D1340(CPUState* cpu) {
         /* 020D14C8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t49);
         /* 020D14CC */ _t50 = cpu->r[1] + 0x00000010u;
         /* 020D14CC */ cpu->r[12] = rbrew_read32(cpu->mem, _t50);
-        /* 020D14D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 020D14D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 020D14D4 */ _t51 = cpu->r[12] + 0x00000014u;
         /* 020D14D4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t51);
-        /* 020D14D8 */ _t52 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D14D8 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D14D8 */ _t53 = _t52 & 0x00000001u;
         /* 020D14D8 */ if (_t53) goto L_020D14E0; else goto L_020D14DC;
   L_020D14DC: ; // 0x20d14dc
@@ -9439,10 +9439,10 @@ void Gambit_fn_020D1340(CPUState* cpu) {
         /* 020D1560 */ rbrew_write32(cpu->mem, _t67, cpu->r[7]);
         /* 020D1564 */ _t68 = cpu->r[27] + 0x00000014u;
         /* 020D1564 */ cpu->r[8] = rbrew_read32(cpu->mem, _t68);
-        /* 020D1568 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000001u);
+        /* 020D1568 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000001u));
         /* 020D156C */ _t69 = cpu->r[27] + 0x00000018u;
         /* 020D156C */ cpu->r[26] = rbrew_read32(cpu->mem, _t69);
-        /* 020D1570 */ _t70 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D1570 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D1570 */ _t71 = _t70 & 0x00000001u;
         /* 020D1570 */ if (_t71) goto L_020D1574; else goto L_020D1578;
   L_020D1574: ; // 0x20d1574
@@ -9458,23 +9458,23 @@ void Gambit_fn_020D1340(CPUState* cpu) {
         /* 020D158C */ _t74 = cpu->r[10] + 0x00000000u;
         /* 020D158C */ cpu->r[9] = rbrew_read8(cpu->mem, _t74);
         /* 020D1590 */ cpu->r[31] = 0x00000000u;
-        /* 020D1594 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[30]);
+        /* 020D1594 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[30]));
         /* 020D1598 */ cpu->r[12] = 0x00080000u;
-        /* 020D159C */ _t75 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D159C */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D159C */ _t76 = _t75 & 0x00000001u;
         /* 020D159C */ if (_t76) goto L_020D15C4; else goto L_020D15A0;
   L_020D15A0: ; // 0x20d15a0
         /* 020D15A0 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020D15A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 020D15A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 020D15A8 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 020D15AC */ _t77 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D15AC */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D15AC */ _t78 = _t77 & 0x00000001u;
         /* 020D15AC */ if (_t78) goto L_020D15C0; else goto L_020D15B0;
   L_020D15B0: ; // 0x20d15b0
         /* 020D15B0 */ _t79 = cpu->r[10] + 0x00000000u;
         /* 020D15B0 */ cpu->r[11] = rbrew_read8(cpu->mem, _t79);
-        /* 020D15B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[30]);
-        /* 020D15B8 */ _t80 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D15B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[30]));
+        /* 020D15B8 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D15B8 */ _t81 = _t80 & 0x00000001u;
         /* 020D15B8 */ if (_t81) goto L_020D15BC; else goto L_020D15A0;
   L_020D15BC: ; // 0x20d15bc
@@ -9486,10 +9486,10 @@ void Gambit_fn_020D1340(CPUState* cpu) {
         /* 020D15C4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t82);
         /* 020D15C8 */ _t83 = cpu->r[1] + 0x00000010u;
         /* 020D15C8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t83);
-        /* 020D15CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 020D15CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 020D15D0 */ _t84 = cpu->r[5] + 0x00000014u;
         /* 020D15D0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t84);
-        /* 020D15D4 */ _t85 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D15D4 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D15D4 */ _t86 = _t85 & 0x00000001u;
         /* 020D15D4 */ if (_t86) goto L_020D15DC; else goto L_020D15D8;
   L_020D15D8: ; // 0x20d15d8
@@ -9544,10 +9544,10 @@ void Gambit_fn_020D1340(CPUState* cpu) {
         /* 020D165C */ rbrew_write32(cpu->mem, _t100, cpu->r[0]);
         /* 020D1660 */ _t101 = cpu->r[27] + 0x00000014u;
         /* 020D1660 */ cpu->r[5] = rbrew_read32(cpu->mem, _t101);
-        /* 020D1664 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x00000002u);
+        /* 020D1664 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x00000002u));
         /* 020D1668 */ _t102 = cpu->r[27] + 0x00000018u;
         /* 020D1668 */ cpu->r[26] = rbrew_read32(cpu->mem, _t102);
-        /* 020D166C */ _t103 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D166C */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D166C */ _t104 = _t103 & 0x00000001u;
         /* 020D166C */ if (_t104) goto L_020D1670; else goto L_020D1674;
   L_020D1670: ; // 0x20d1670
@@ -9563,23 +9563,23 @@ void Gambit_fn_020D1340(CPUState* cpu) {
         /* 020D1688 */ _t107 = cpu->r[6] + 0x00000000u;
         /* 020D1688 */ cpu->r[8] = rbrew_read8(cpu->mem, _t107);
         /* 020D168C */ cpu->r[31] = 0x00000000u;
-        /* 020D1690 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[30]);
+        /* 020D1690 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[30]));
         /* 020D1694 */ cpu->r[7] = 0x00080000u;
-        /* 020D1698 */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1698 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1698 */ _t109 = _t108 & 0x00000001u;
         /* 020D1698 */ if (_t109) goto L_020D16C0; else goto L_020D169C;
   L_020D169C: ; // 0x20d169c
         /* 020D169C */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020D16A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 020D16A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 020D16A4 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 020D16A8 */ _t110 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D16A8 */ _t110 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D16A8 */ _t111 = _t110 & 0x00000001u;
         /* 020D16A8 */ if (_t111) goto L_020D16BC; else goto L_020D16AC;
   L_020D16AC: ; // 0x20d16ac
         /* 020D16AC */ _t112 = cpu->r[6] + 0x00000000u;
         /* 020D16AC */ cpu->r[0] = rbrew_read8(cpu->mem, _t112);
-        /* 020D16B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
-        /* 020D16B4 */ _t113 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D16B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
+        /* 020D16B4 */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D16B4 */ _t114 = _t113 & 0x00000001u;
         /* 020D16B4 */ if (_t114) goto L_020D16B8; else goto L_020D169C;
   L_020D16B8: ; // 0x20d16b8
@@ -9591,10 +9591,10 @@ void Gambit_fn_020D1340(CPUState* cpu) {
         /* 020D16C0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t115);
         /* 020D16C4 */ _t116 = cpu->r[1] + 0x00000010u;
         /* 020D16C4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t116);
-        /* 020D16C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 020D16C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 020D16CC */ _t117 = cpu->r[11] + 0x00000014u;
         /* 020D16CC */ cpu->r[0] = rbrew_read32(cpu->mem, _t117);
-        /* 020D16D0 */ _t118 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D16D0 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D16D0 */ _t119 = _t118 & 0x00000001u;
         /* 020D16D0 */ if (_t119) goto L_020D16D8; else goto L_020D16D4;
   L_020D16D4: ; // 0x20d16d4
@@ -9649,10 +9649,10 @@ void Gambit_fn_020D1340(CPUState* cpu) {
         /* 020D1758 */ rbrew_write32(cpu->mem, _t133, cpu->r[8]);
         /* 020D175C */ _t134 = cpu->r[27] + 0x00000014u;
         /* 020D175C */ cpu->r[9] = rbrew_read32(cpu->mem, _t134);
-        /* 020D1760 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000003u);
+        /* 020D1760 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000003u));
         /* 020D1764 */ _t135 = cpu->r[27] + 0x00000018u;
         /* 020D1764 */ cpu->r[26] = rbrew_read32(cpu->mem, _t135);
-        /* 020D1768 */ _t136 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D1768 */ _t136 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D1768 */ _t137 = _t136 & 0x00000001u;
         /* 020D1768 */ if (_t137) goto L_020D176C; else goto L_020D1770;
   L_020D176C: ; // 0x20d176c
@@ -9668,23 +9668,23 @@ void Gambit_fn_020D1340(CPUState* cpu) {
         /* 020D1784 */ _t140 = cpu->r[10] + 0x00000000u;
         /* 020D1784 */ cpu->r[11] = rbrew_read8(cpu->mem, _t140);
         /* 020D1788 */ cpu->r[31] = 0x00000000u;
-        /* 020D178C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[30]);
+        /* 020D178C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[30]));
         /* 020D1790 */ cpu->r[12] = 0x00080000u;
-        /* 020D1794 */ _t141 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1794 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1794 */ _t142 = _t141 & 0x00000001u;
         /* 020D1794 */ if (_t142) goto L_020D17BC; else goto L_020D1798;
   L_020D1798: ; // 0x20d1798
         /* 020D1798 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020D179C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 020D179C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 020D17A0 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 020D17A4 */ _t143 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D17A4 */ _t143 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D17A4 */ _t144 = _t143 & 0x00000001u;
         /* 020D17A4 */ if (_t144) goto L_020D17B8; else goto L_020D17A8;
   L_020D17A8: ; // 0x20d17a8
         /* 020D17A8 */ _t145 = cpu->r[10] + 0x00000000u;
         /* 020D17A8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t145);
-        /* 020D17AC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
-        /* 020D17B0 */ _t146 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D17AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
+        /* 020D17B0 */ _t146 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D17B0 */ _t147 = _t146 & 0x00000001u;
         /* 020D17B0 */ if (_t147) goto L_020D17B4; else goto L_020D1798;
   L_020D17B4: ; // 0x20d17b4
@@ -9696,10 +9696,10 @@ void Gambit_fn_020D1340(CPUState* cpu) {
         /* 020D17BC */ cpu->r[7] = rbrew_read32(cpu->mem, _t148);
         /* 020D17C0 */ _t149 = cpu->r[1] + 0x00000010u;
         /* 020D17C0 */ cpu->r[6] = rbrew_read32(cpu->mem, _t149);
-        /* 020D17C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 020D17C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 020D17C8 */ _t150 = cpu->r[6] + 0x00000014u;
         /* 020D17C8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t150);
-        /* 020D17CC */ _t151 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D17CC */ _t151 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D17CC */ _t152 = _t151 & 0x00000001u;
         /* 020D17CC */ if (_t152) goto L_020D17D4; else goto L_020D17D0;
   L_020D17D0: ; // 0x20d17d0
@@ -9760,8 +9760,8 @@ void Gambit_fn_020D1340(CPUState* cpu) {
         /* 020D1864 */ cpu->r[4] = 0x00000008u;
         /* 020D1868 */ cpu->r[5] = 0x00000004u;
         /* 020D186C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020D1870 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D1874 */ _t169 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1870 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D1874 */ _t169 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1874 */ _t170 = _t169 & 0x00000001u;
         /* 020D1874 */ if (_t170) goto L_020D1884; else goto L_020D1878;
   L_020D1878: ; // 0x20d1878
@@ -9773,8 +9773,8 @@ void Gambit_fn_020D1340(CPUState* cpu) {
   L_020D1884: ; // 0x20d1884
         /* 020D1884 */ _t173 = cpu->r[29] + 0x00000220u;
         /* 020D1884 */ cpu->r[10] = rbrew_read32(cpu->mem, _t173);
-        /* 020D1888 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020D188C */ _t174 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D1888 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020D188C */ _t174 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D188C */ _t175 = _t174 & 0x00000001u;
         /* 020D188C */ if (_t175) goto L_020D1890; else goto L_020D18AC;
   L_020D1890: ; // 0x20d1890
@@ -9863,7 +9863,7 @@ void Gambit_fn_020D18C4(CPUState* cpu) {
         /* 020D194C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t17);
         /* 020D1950 */ _t18 = cpu->r[1] + 0x0000001Cu;
         /* 020D1950 */ cpu->r[31] = rbrew_read32(cpu->mem, _t18);
-        /* 020D1954 */ _t19 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D1954 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D1954 */ _t20 = _t19 & 0x00000001u;
         /* 020D1954 */ if (_t20) goto L_020D1958; // else: addr-0 trap, fall-through
   L_020D1958: ; // 0x20d1958
@@ -9911,9 +9911,9 @@ void Gambit_fn_020D196C(CPUState* cpu) {
         /* 020D19BC */ _t8 = cpu->r[31] + 0x00000218u;
         /* 020D19BC */ rbrew_write8(cpu->mem, _t8, (uint8_t)cpu->r[0]);
         /* 020D19C0 */ Gambit_fn_027ED858(cpu);
-        /* 020D19C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 020D19C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 020D19C8 */ cpu->r[4] = 0x00000002u;
-        /* 020D19CC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D19CC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D19CC */ _t10 = _t9 & 0x00000001u;
         /* 020D19CC */ if (_t10) goto L_020D19D4; else goto L_020D19D0;
   L_020D19D0: ; // 0x20d19d0
@@ -9962,8 +9962,8 @@ void Gambit_fn_020D1A14(CPUState* cpu) {
         /* 020D1A4C */ _t6 = cpu->r[1] + 0x00000008u;
         /* 020D1A4C */ rbrew_write32(cpu->mem, _t6, cpu->r[12]);
         /* 020D1A50 */ Gambit_fn_027EDE90(cpu);
-        /* 020D1A54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D1A58 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1A54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D1A58 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1A58 */ _t8 = _t7 & 0x00000001u;
         /* 020D1A58 */ if (_t8) goto L_020D1A5C; else goto L_020D1A88;
   L_020D1A5C: ; // 0x20d1a5c
@@ -9977,15 +9977,15 @@ void Gambit_fn_020D1A14(CPUState* cpu) {
         /* 020D1A74 */ _t10 = cpu->r[1] + 0x00000010u;
         /* 020D1A74 */ rbrew_write32(cpu->mem, _t10, cpu->r[10]);
         /* 020D1A78 */ Gambit_fn_027EDE90(cpu);
-        /* 020D1A7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D1A80 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1A7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D1A80 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1A80 */ _t12 = _t11 & 0x00000001u;
         /* 020D1A80 */ if (_t12) goto L_020D1A84; else goto L_020D1A88;
   L_020D1A84: ; // 0x20d1a84
         /* 020D1A84 */ cpu->r[29] = 0x00000001u;
   L_020D1A88: ; // 0x20d1a88
-        /* 020D1A88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020D1A8C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1A88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020D1A8C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1A8C */ _t14 = _t13 & 0x00000001u;
         /* 020D1A8C */ if (_t14) goto L_020D1AA4; else goto L_020D1A90;
   L_020D1A90: ; // 0x20d1a90
@@ -10051,8 +10051,8 @@ void Gambit_fn_020D1AE0(CPUState* cpu) {
         /* 020D1B1C */ _t7 = cpu->r[1] + 0x00000008u;
         /* 020D1B1C */ rbrew_write32(cpu->mem, _t7, cpu->r[0]);
         /* 020D1B20 */ Gambit_fn_027ED700(cpu);
-        /* 020D1B24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D1B28 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1B24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D1B28 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1B28 */ _t9 = _t8 & 0x00000001u;
         /* 020D1B28 */ if (_t9) goto L_020D1B2C; else goto L_020D1B4C;
   L_020D1B2C: ; // 0x20d1b2c
@@ -10120,8 +10120,8 @@ void Gambit_fn_020D1AE4(CPUState* cpu) {
         /* 020D1B1C */ _t7 = cpu->r[1] + 0x00000008u;
         /* 020D1B1C */ rbrew_write32(cpu->mem, _t7, cpu->r[0]);
         /* 020D1B20 */ Gambit_fn_027ED700(cpu);
-        /* 020D1B24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D1B28 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1B24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D1B28 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1B28 */ _t9 = _t8 & 0x00000001u;
         /* 020D1B28 */ if (_t9) goto L_020D1B2C; else goto L_020D1B4C;
   L_020D1B2C: ; // 0x20d1b2c
@@ -10171,7 +10171,7 @@ void Gambit_fn_020D1B88(CPUState* cpu) {
         /* 020D1B90 */ _t1 = cpu->r[1] + 0x00000024u;
         /* 020D1B90 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 020D1B94 */ cpu->r[31] = 0x10010000u;
-        /* 020D1B98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 020D1B98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 020D1B9C */ _t2 = cpu->r[1] + 0x00000020u;
         /* 020D1B9C */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D1BA0 */ cpu->r[30] = 0x10010000u;
@@ -10184,7 +10184,7 @@ void Gambit_fn_020D1B88(CPUState* cpu) {
         /* 020D1BB4 */ cpu->r[0] = 0x10010000u;
         /* 020D1BB8 */ cpu->r[29] = cpu->r[3];
         /* 020D1BBC */ cpu->r[0] = cpu->r[0] + 0x00007BFCu;
-        /* 020D1BC0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1BC0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1BC0 */ _t6 = _t5 & 0x00000001u;
         /* 020D1BC0 */ if (_t6) goto L_020D1C1C; else goto L_020D1BC4;
   L_020D1BC4: ; // 0x20d1bc4
@@ -10265,7 +10265,7 @@ void Gambit_fn_020D1B8C(CPUState* cpu) {
         /* 020D1B90 */ _t1 = cpu->r[1] + 0x00000024u;
         /* 020D1B90 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 020D1B94 */ cpu->r[31] = 0x10010000u;
-        /* 020D1B98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 020D1B98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 020D1B9C */ _t2 = cpu->r[1] + 0x00000020u;
         /* 020D1B9C */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D1BA0 */ cpu->r[30] = 0x10010000u;
@@ -10278,7 +10278,7 @@ void Gambit_fn_020D1B8C(CPUState* cpu) {
         /* 020D1BB4 */ cpu->r[0] = 0x10010000u;
         /* 020D1BB8 */ cpu->r[29] = cpu->r[3];
         /* 020D1BBC */ cpu->r[0] = cpu->r[0] + 0x00007BFCu;
-        /* 020D1BC0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1BC0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1BC0 */ _t6 = _t5 & 0x00000001u;
         /* 020D1BC0 */ if (_t6) goto L_020D1C1C; else goto L_020D1BC4;
   L_020D1BC4: ; // 0x20d1bc4
@@ -10373,17 +10373,17 @@ void Gambit_fn_020D1C6C(CPUState* cpu) {
         /* 020D1C90 */ _t7 = cpu->r[12] + 0x00000000u;
         /* 020D1C90 */ cpu->r[0] = rbrew_read32(cpu->mem, _t7);
         /* 020D1C94 */ cpu->r[30] = cpu->r[4];
-        /* 020D1C98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020D1C98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020D1C9C */ cpu->r[31] = cpu->r[5];
-        /* 020D1CA0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1CA0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1CA0 */ _t9 = _t8 & 0x00000001u;
         /* 020D1CA0 */ if (_t9) goto L_020D1CBC; else goto L_020D1CA4;
   L_020D1CA4: ; // 0x20d1ca4
         /* 020D1CA4 */ cpu->r[4] = cpu->r[30] + 0x00000001u;
-        /* 020D1CA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000014u);
+        /* 020D1CA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000014u));
         /* 020D1CAC */ _t10 = cpu->r[12] + 0x00000000u;
         /* 020D1CAC */ cpu->r[3] = rbrew_read32(cpu->mem, _t10);
-        /* 020D1CB0 */ _t11 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D1CB0 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D1CB0 */ _t12 = _t11 & 0x00000001u;
         /* 020D1CB0 */ if (_t12) goto L_020D1CB4; else goto L_020D1CB8;
   L_020D1CB4: ; // 0x20d1cb4
@@ -10391,15 +10391,15 @@ void Gambit_fn_020D1C6C(CPUState* cpu) {
   L_020D1CB8: ; // 0x20d1cb8
         /* 020D1CB8 */ Gambit_fn_020A7EFC(cpu);
   L_020D1CBC: ; // 0x20d1cbc
-        /* 020D1CBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000013u);
+        /* 020D1CBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000013u));
         /* 020D1CC0 */ /* nop */
         /* 020D1CC4 */ cpu->r[4] = rbrew_rlwinm(cpu->r[0], 0x00000001u, 0x0000001Fu, 0x0000001Fu);
         /* 020D1CC8 */ cpu->r[3] = cpu->r[29];
         /* 020D1CCC */ cpu->r[4] = cpu->r[4] ^ 0x00000001u;
         /* 020D1CD0 */ Gambit_fn_020D1B88(cpu);
-        /* 020D1CD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000013u);
+        /* 020D1CD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000013u));
         /* 020D1CD8 */ cpu->r[28] = 0x00000000u;
-        /* 020D1CDC */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D1CDC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D1CDC */ _t14 = _t13 & 0x00000001u;
         /* 020D1CDC */ if (_t14) goto L_020D1CE0; else goto L_020D1D2C;
   L_020D1CE0: ; // 0x20d1ce0
@@ -10410,8 +10410,8 @@ void Gambit_fn_020D1C6C(CPUState* cpu) {
         /* 020D1CE8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t16);
         /* 020D1CEC */ _t17 = cpu->r[9] + 0x0000000Cu;
         /* 020D1CEC */ cpu->r[12] = rbrew_read32(cpu->mem, _t17);
-        /* 020D1CF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[12]);
-        /* 020D1CF4 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D1CF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[12]));
+        /* 020D1CF4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D1CF4 */ _t19 = _t18 & 0x00000001u;
         /* 020D1CF4 */ if (_t19) goto L_020D1CF8; else goto L_020D1D24;
   L_020D1CF8: ; // 0x20d1cf8
@@ -10420,10 +10420,10 @@ void Gambit_fn_020D1C6C(CPUState* cpu) {
         /* 020D1CFC */ _t21 = cpu->r[9] + 0x00000004u;
         /* 020D1CFC */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
         /* 020D1D00 */ cpu->r[0] = cpu->r[6] + cpu->r[30];
-        /* 020D1D04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[7]);
+        /* 020D1D04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[7]));
         /* 020D1D08 */ _t22 = cpu->r[9] + 0x00000000u;
         /* 020D1D08 */ cpu->r[10] = rbrew_read32(cpu->mem, _t22);
-        /* 020D1D0C */ _t23 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D1D0C */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D1D0C */ _t24 = _t23 & 0x00000001u;
         /* 020D1D0C */ if (_t24) goto L_020D1D14; else goto L_020D1D10;
   L_020D1D10: ; // 0x20d1d10
@@ -10442,17 +10442,17 @@ void Gambit_fn_020D1C6C(CPUState* cpu) {
   L_020D1D2C: ; // 0x20d1d2c
         /* 020D1D2C */ _t28 = cpu->r[29] + 0x00000220u;
         /* 020D1D2C */ cpu->r[0] = rbrew_read32(cpu->mem, _t28);
-        /* 020D1D30 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 020D1D30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 020D1D34 */ _t29 = cpu->r[29] + 0x00000224u;
         /* 020D1D34 */ cpu->r[12] = rbrew_read32(cpu->mem, _t29);
-        /* 020D1D38 */ _t30 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D1D38 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D1D38 */ _t31 = _t30 & 0x00000001u;
         /* 020D1D38 */ if (_t31) goto L_020D1D3C; else goto L_020D1D4C;
   L_020D1D3C: ; // 0x20d1d3c
         /* 020D1D3C */ _t32 = cpu->r[12] + 0x00000004u;
         /* 020D1D3C */ cpu->r[11] = rbrew_read32(cpu->mem, _t32);
-        /* 020D1D40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020D1D44 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1D40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020D1D44 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1D44 */ _t34 = _t33 & 0x00000001u;
         /* 020D1D44 */ if (_t34) goto L_020D1D74; else goto L_020D1D48;
   L_020D1D48: ; // 0x20d1d48
@@ -10460,13 +10460,13 @@ void Gambit_fn_020D1C6C(CPUState* cpu) {
   L_020D1D4C: ; // 0x20d1d4c
         /* 020D1D4C */ _t35 = cpu->r[12] + 0x00000000u;
         /* 020D1D4C */ cpu->r[11] = rbrew_read32(cpu->mem, _t35);
-        /* 020D1D50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020D1D54 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1D50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020D1D54 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1D54 */ _t37 = _t36 & 0x00000001u;
         /* 020D1D54 */ if (_t37) goto L_020D1D74; else goto L_020D1D58;
   L_020D1D58: ; // 0x20d1d58
-        /* 020D1D58 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
-        /* 020D1D5C */ _t38 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D1D58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
+        /* 020D1D5C */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D1D5C */ _t39 = _t38 & 0x00000001u;
         /* 020D1D5C */ if (_t39) goto L_020D1D60; else goto L_020D1D64;
   L_020D1D60: ; // 0x20d1d60
@@ -10478,8 +10478,8 @@ void Gambit_fn_020D1C6C(CPUState* cpu) {
         /* 020D1D6C */ cpu->r[5] = cpu->r[28];
         /* 020D1D70 */ Gambit_fn_020A7FA0(cpu);
   L_020D1D74: ; // 0x20d1d74
-        /* 020D1D74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 020D1D78 */ _t41 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D1D74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 020D1D78 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D1D78 */ _t42 = _t41 & 0x00000001u;
         /* 020D1D78 */ if (_t42) goto L_020D1D7C; else goto L_020D1DC4;
   L_020D1D7C: ; // 0x20d1d7c
@@ -10553,17 +10553,17 @@ void Gambit_fn_020D1C70(CPUState* cpu) {
         /* 020D1C90 */ _t7 = cpu->r[12] + 0x00000000u;
         /* 020D1C90 */ cpu->r[0] = rbrew_read32(cpu->mem, _t7);
         /* 020D1C94 */ cpu->r[30] = cpu->r[4];
-        /* 020D1C98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020D1C98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020D1C9C */ cpu->r[31] = cpu->r[5];
-        /* 020D1CA0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1CA0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1CA0 */ _t9 = _t8 & 0x00000001u;
         /* 020D1CA0 */ if (_t9) goto L_020D1CBC; else goto L_020D1CA4;
   L_020D1CA4: ; // 0x20d1ca4
         /* 020D1CA4 */ cpu->r[4] = cpu->r[30] + 0x00000001u;
-        /* 020D1CA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000014u);
+        /* 020D1CA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000014u));
         /* 020D1CAC */ _t10 = cpu->r[12] + 0x00000000u;
         /* 020D1CAC */ cpu->r[3] = rbrew_read32(cpu->mem, _t10);
-        /* 020D1CB0 */ _t11 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D1CB0 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D1CB0 */ _t12 = _t11 & 0x00000001u;
         /* 020D1CB0 */ if (_t12) goto L_020D1CB4; else goto L_020D1CB8;
   L_020D1CB4: ; // 0x20d1cb4
@@ -10571,15 +10571,15 @@ void Gambit_fn_020D1C70(CPUState* cpu) {
   L_020D1CB8: ; // 0x20d1cb8
         /* 020D1CB8 */ Gambit_fn_020A7EFC(cpu);
   L_020D1CBC: ; // 0x20d1cbc
-        /* 020D1CBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000013u);
+        /* 020D1CBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000013u));
         /* 020D1CC0 */ /* nop */
         /* 020D1CC4 */ cpu->r[4] = rbrew_rlwinm(cpu->r[0], 0x00000001u, 0x0000001Fu, 0x0000001Fu);
         /* 020D1CC8 */ cpu->r[3] = cpu->r[29];
         /* 020D1CCC */ cpu->r[4] = cpu->r[4] ^ 0x00000001u;
         /* 020D1CD0 */ Gambit_fn_020D1B88(cpu);
-        /* 020D1CD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000013u);
+        /* 020D1CD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000013u));
         /* 020D1CD8 */ cpu->r[28] = 0x00000000u;
-        /* 020D1CDC */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D1CDC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D1CDC */ _t14 = _t13 & 0x00000001u;
         /* 020D1CDC */ if (_t14) goto L_020D1CE0; else goto L_020D1D2C;
   L_020D1CE0: ; // 0x20d1ce0
@@ -10590,8 +10590,8 @@ void Gambit_fn_020D1C70(CPUState* cpu) {
         /* 020D1CE8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t16);
         /* 020D1CEC */ _t17 = cpu->r[9] + 0x0000000Cu;
         /* 020D1CEC */ cpu->r[12] = rbrew_read32(cpu->mem, _t17);
-        /* 020D1CF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[12]);
-        /* 020D1CF4 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D1CF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[12]));
+        /* 020D1CF4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D1CF4 */ _t19 = _t18 & 0x00000001u;
         /* 020D1CF4 */ if (_t19) goto L_020D1CF8; else goto L_020D1D24;
   L_020D1CF8: ; // 0x20d1cf8
@@ -10600,10 +10600,10 @@ void Gambit_fn_020D1C70(CPUState* cpu) {
         /* 020D1CFC */ _t21 = cpu->r[9] + 0x00000004u;
         /* 020D1CFC */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
         /* 020D1D00 */ cpu->r[0] = cpu->r[6] + cpu->r[30];
-        /* 020D1D04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[7]);
+        /* 020D1D04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[7]));
         /* 020D1D08 */ _t22 = cpu->r[9] + 0x00000000u;
         /* 020D1D08 */ cpu->r[10] = rbrew_read32(cpu->mem, _t22);
-        /* 020D1D0C */ _t23 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D1D0C */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D1D0C */ _t24 = _t23 & 0x00000001u;
         /* 020D1D0C */ if (_t24) goto L_020D1D14; else goto L_020D1D10;
   L_020D1D10: ; // 0x20d1d10
@@ -10622,17 +10622,17 @@ void Gambit_fn_020D1C70(CPUState* cpu) {
   L_020D1D2C: ; // 0x20d1d2c
         /* 020D1D2C */ _t28 = cpu->r[29] + 0x00000220u;
         /* 020D1D2C */ cpu->r[0] = rbrew_read32(cpu->mem, _t28);
-        /* 020D1D30 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 020D1D30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 020D1D34 */ _t29 = cpu->r[29] + 0x00000224u;
         /* 020D1D34 */ cpu->r[12] = rbrew_read32(cpu->mem, _t29);
-        /* 020D1D38 */ _t30 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D1D38 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D1D38 */ _t31 = _t30 & 0x00000001u;
         /* 020D1D38 */ if (_t31) goto L_020D1D3C; else goto L_020D1D4C;
   L_020D1D3C: ; // 0x20d1d3c
         /* 020D1D3C */ _t32 = cpu->r[12] + 0x00000004u;
         /* 020D1D3C */ cpu->r[11] = rbrew_read32(cpu->mem, _t32);
-        /* 020D1D40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020D1D44 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1D40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020D1D44 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1D44 */ _t34 = _t33 & 0x00000001u;
         /* 020D1D44 */ if (_t34) goto L_020D1D74; else goto L_020D1D48;
   L_020D1D48: ; // 0x20d1d48
@@ -10640,13 +10640,13 @@ void Gambit_fn_020D1C70(CPUState* cpu) {
   L_020D1D4C: ; // 0x20d1d4c
         /* 020D1D4C */ _t35 = cpu->r[12] + 0x00000000u;
         /* 020D1D4C */ cpu->r[11] = rbrew_read32(cpu->mem, _t35);
-        /* 020D1D50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020D1D54 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1D50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020D1D54 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1D54 */ _t37 = _t36 & 0x00000001u;
         /* 020D1D54 */ if (_t37) goto L_020D1D74; else goto L_020D1D58;
   L_020D1D58: ; // 0x20d1d58
-        /* 020D1D58 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
-        /* 020D1D5C */ _t38 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D1D58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
+        /* 020D1D5C */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D1D5C */ _t39 = _t38 & 0x00000001u;
         /* 020D1D5C */ if (_t39) goto L_020D1D60; else goto L_020D1D64;
   L_020D1D60: ; // 0x20d1d60
@@ -10658,8 +10658,8 @@ void Gambit_fn_020D1C70(CPUState* cpu) {
         /* 020D1D6C */ cpu->r[5] = cpu->r[28];
         /* 020D1D70 */ Gambit_fn_020A7FA0(cpu);
   L_020D1D74: ; // 0x20d1d74
-        /* 020D1D74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 020D1D78 */ _t41 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D1D74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 020D1D78 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D1D78 */ _t42 = _t41 & 0x00000001u;
         /* 020D1D78 */ if (_t42) goto L_020D1D7C; else goto L_020D1DC4;
   L_020D1D7C: ; // 0x20d1d7c
@@ -11009,7 +11009,7 @@ void Gambit_fn_020D1F50(CPUState* cpu) {
         /* 020D1FB8 */ rbrew_write32(cpu->mem, _t7, cpu->r[30]);
         /* 020D1FBC */ _t8 = cpu->r[30] + 0x00000000u;
         /* 020D1FBC */ rbrew_write8(cpu->mem, _t8, (uint8_t)cpu->r[31]);
-        /* 020D1FC0 */ _t9 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020D1FC0 */ _t9 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020D1FC0 */ _t10 = _t9 & 0x00000001u;
         /* 020D1FC0 */ if (_t10) goto L_020D1FC4; // else: addr-0 trap, fall-through
   L_020D1FC4: ; // 0x20d1fc4
@@ -11020,8 +11020,8 @@ void Gambit_fn_020D1F50(CPUState* cpu) {
         /* 020D1FD4 */ _t11 = cpu->r[1] + 0x00000008u;
         /* 020D1FD4 */ rbrew_write32(cpu->mem, _t11, cpu->r[18]);
         /* 020D1FD8 */ Gambit_fn_026D6F78(cpu);
-        /* 020D1FDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D1FE0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D1FDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D1FE0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D1FE0 */ _t13 = _t12 & 0x00000001u;
         /* 020D1FE0 */ if (_t13) goto L_020D204C; else goto L_020D1FE4;
   L_020D1FE4: ; // 0x20d1fe4
@@ -11043,17 +11043,17 @@ void Gambit_fn_020D1F50(CPUState* cpu) {
         /* 020D200C */ Gambit_fn_027EC044(cpu);
         /* 020D2010 */ _t19 = cpu->r[3] + 0x000000A8u;
         /* 020D2010 */ cpu->r[0] = rbrew_read32(cpu->mem, _t19);
-        /* 020D2014 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D2018 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2014 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D2018 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2018 */ _t21 = _t20 & 0x00000001u;
         /* 020D2018 */ if (_t21) goto L_020D204C; else goto L_020D201C;
   L_020D201C: ; // 0x20d201c
         /* 020D201C */ _t22 = cpu->r[25] + 0x00000220u;
         /* 020D201C */ cpu->r[9] = rbrew_read32(cpu->mem, _t22);
-        /* 020D2020 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], cpu->r[9]);
+        /* 020D2020 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], cpu->r[9]));
         /* 020D2024 */ _t23 = cpu->r[25] + 0x00000224u;
         /* 020D2024 */ cpu->r[29] = rbrew_read32(cpu->mem, _t23);
-        /* 020D2028 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D2028 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D2028 */ _t25 = _t24 & 0x00000001u;
         /* 020D2028 */ if (_t25) goto L_020D202C; else goto L_020D2030;
   L_020D202C: ; // 0x20d202c
@@ -11071,10 +11071,10 @@ void Gambit_fn_020D1F50(CPUState* cpu) {
         /* 020D2048 */ rbrew_write32(cpu->mem, _t28, cpu->r[3]);
   L_020D204C: ; // 0x20d204c
         /* 020D204C */ cpu->r[27] = cpu->r[27] + 0xFFFFFFFFu;
-        /* 020D204C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020D204C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020D2050 */ cpu->r[23] = cpu->r[23] + 0x00000001u;
         /* 020D2054 */ cpu->r[28] = cpu->r[28] + 0x00000004u;
-        /* 020D2058 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2058 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2058 */ _t30 = _t29 & 0x00000001u;
         /* 020D2058 */ if (_t30) goto L_020D205C; else goto L_020D1FA0;
   L_020D205C: ; // 0x20d205c
@@ -11117,8 +11117,8 @@ void Gambit_fn_020D2070(CPUState* cpu) {
         /* 020D20B0 */ _t6 = cpu->r[1] + 0x0000001Cu;
         /* 020D20B0 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 020D20B4 */ Gambit_fn_026D6F78(cpu);
-        /* 020D20B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D20BC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D20B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D20BC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D20BC */ _t8 = _t7 & 0x00000001u;
         /* 020D20BC */ if (_t8) goto L_020D2184; else goto L_020D20C0;
   L_020D20C0: ; // 0x20d20c0
@@ -11154,8 +11154,8 @@ void Gambit_fn_020D2070(CPUState* cpu) {
         /* 020D210C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020D2110 */ _t19 = cpu->r[1] + 0x00000014u;
         /* 020D2110 */ cpu->r[0] = rbrew_read32(cpu->mem, _t19);
-        /* 020D2114 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 020D2118 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2114 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 020D2118 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2118 */ _t21 = _t20 & 0x00000001u;
         /* 020D2118 */ if (_t21) goto L_020D216C; else goto L_020D211C;
   L_020D211C: ; // 0x20d211c
@@ -11176,13 +11176,13 @@ void Gambit_fn_020D2070(CPUState* cpu) {
         /* 020D2140 */ _t26 = cpu->r[11] + 0x00000001u;
         /* 020D2140 */ cpu->r[9] = rbrew_read8(cpu->mem, _t26);
         /* 020D2140 */ cpu->r[11] = _t26;
-        /* 020D2144 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[9]);
-        /* 020D2148 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[9]));
+        /* 020D2148 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2148 */ _t28 = _t27 & 0x00000001u;
         /* 020D2148 */ if (_t28) goto L_020D214C; else goto L_020D2184;
   L_020D214C: ; // 0x20d214c
-        /* 020D214C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 020D2150 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D214C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 020D2150 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2150 */ _t30 = _t29 & 0x00000001u;
         /* 020D2150 */ if (_t30) goto L_020D216C; else goto L_020D2154;
   L_020D2154: ; // 0x20d2154
@@ -11195,8 +11195,8 @@ void Gambit_fn_020D2070(CPUState* cpu) {
   L_020D215C: ; // 0x20d215c
         /* 020D215C */ _t34 = cpu->r[30] + 0x0000021Cu;
         /* 020D215C */ cpu->r[8] = rbrew_read32(cpu->mem, _t34);
-        /* 020D2160 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000001u);
-        /* 020D2164 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2160 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000001u));
+        /* 020D2164 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2164 */ _t36 = _t35 & 0x00000001u;
         /* 020D2164 */ if (_t36) goto L_020D2168; else goto L_020D2198;
   L_020D2168: ; // 0x20d2168
@@ -11213,8 +11213,8 @@ void Gambit_fn_020D2070(CPUState* cpu) {
   L_020D2184: ; // 0x20d2184
         /* 020D2184 */ _t39 = cpu->r[30] + 0x0000021Cu;
         /* 020D2184 */ cpu->r[8] = rbrew_read32(cpu->mem, _t39);
-        /* 020D2188 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000001u);
-        /* 020D218C */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2188 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000001u));
+        /* 020D218C */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D218C */ _t41 = _t40 & 0x00000001u;
         /* 020D218C */ if (_t41) goto L_020D2190; else goto L_020D2198;
   L_020D2190: ; // 0x20d2190
@@ -11262,8 +11262,8 @@ void Gambit_fn_020D2074(CPUState* cpu) {
         /* 020D20B0 */ _t6 = cpu->r[1] + 0x0000001Cu;
         /* 020D20B0 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 020D20B4 */ Gambit_fn_026D6F78(cpu);
-        /* 020D20B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D20BC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D20B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D20BC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D20BC */ _t8 = _t7 & 0x00000001u;
         /* 020D20BC */ if (_t8) goto L_020D2184; else goto L_020D20C0;
   L_020D20C0: ; // 0x20d20c0
@@ -11299,8 +11299,8 @@ void Gambit_fn_020D2074(CPUState* cpu) {
         /* 020D210C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020D2110 */ _t19 = cpu->r[1] + 0x00000014u;
         /* 020D2110 */ cpu->r[0] = rbrew_read32(cpu->mem, _t19);
-        /* 020D2114 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 020D2118 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2114 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 020D2118 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2118 */ _t21 = _t20 & 0x00000001u;
         /* 020D2118 */ if (_t21) goto L_020D216C; else goto L_020D211C;
   L_020D211C: ; // 0x20d211c
@@ -11321,13 +11321,13 @@ void Gambit_fn_020D2074(CPUState* cpu) {
         /* 020D2140 */ _t26 = cpu->r[11] + 0x00000001u;
         /* 020D2140 */ cpu->r[9] = rbrew_read8(cpu->mem, _t26);
         /* 020D2140 */ cpu->r[11] = _t26;
-        /* 020D2144 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[9]);
-        /* 020D2148 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[9]));
+        /* 020D2148 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2148 */ _t28 = _t27 & 0x00000001u;
         /* 020D2148 */ if (_t28) goto L_020D214C; else goto L_020D2184;
   L_020D214C: ; // 0x20d214c
-        /* 020D214C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 020D2150 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D214C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 020D2150 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2150 */ _t30 = _t29 & 0x00000001u;
         /* 020D2150 */ if (_t30) goto L_020D216C; else goto L_020D2154;
   L_020D2154: ; // 0x20d2154
@@ -11340,8 +11340,8 @@ void Gambit_fn_020D2074(CPUState* cpu) {
   L_020D215C: ; // 0x20d215c
         /* 020D215C */ _t34 = cpu->r[30] + 0x0000021Cu;
         /* 020D215C */ cpu->r[8] = rbrew_read32(cpu->mem, _t34);
-        /* 020D2160 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000001u);
-        /* 020D2164 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2160 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000001u));
+        /* 020D2164 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2164 */ _t36 = _t35 & 0x00000001u;
         /* 020D2164 */ if (_t36) goto L_020D2168; else goto L_020D2198;
   L_020D2168: ; // 0x20d2168
@@ -11358,8 +11358,8 @@ void Gambit_fn_020D2074(CPUState* cpu) {
   L_020D2184: ; // 0x20d2184
         /* 020D2184 */ _t39 = cpu->r[30] + 0x0000021Cu;
         /* 020D2184 */ cpu->r[8] = rbrew_read32(cpu->mem, _t39);
-        /* 020D2188 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000001u);
-        /* 020D218C */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2188 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000001u));
+        /* 020D218C */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D218C */ _t41 = _t40 & 0x00000001u;
         /* 020D218C */ if (_t41) goto L_020D2190; else goto L_020D2198;
   L_020D2190: ; // 0x20d2190
@@ -11392,8 +11392,8 @@ void Gambit_fn_020D21B4(CPUState* cpu) {
         /* 020D21C0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020D21C4 */ _t3 = cpu->r[31] + 0x000001E4u;
         /* 020D21C4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t3);
-        /* 020D21C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020D21CC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D21C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020D21CC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D21CC */ _t5 = _t4 & 0x00000001u;
         /* 020D21CC */ if (_t5) goto L_020D21D0; else goto L_020D2200;
   L_020D21D0: ; // 0x20d21d0
@@ -11418,8 +11418,8 @@ void Gambit_fn_020D21B4(CPUState* cpu) {
         /* 020D2200 */ cpu->r[4] = rbrew_read32(cpu->mem, _t10);
         /* 020D2204 */ cpu->r[3] = cpu->r[31];
         /* 020D2208 */ Gambit_fn_027EDF00(cpu);
-        /* 020D220C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D2210 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D220C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D2210 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2210 */ _t12 = _t11 & 0x00000001u;
         /* 020D2210 */ if (_t12) goto L_020D2228; else goto L_020D2214;
   L_020D2214: ; // 0x20d2214
@@ -11454,15 +11454,15 @@ void Gambit_fn_020D2240(CPUState* cpu) {
         /* 020D224C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020D2250 */ _t3 = cpu->r[31] + 0x00000218u;
         /* 020D2250 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 020D2254 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D2258 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2254 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D2258 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2258 */ _t5 = _t4 & 0x00000001u;
         /* 020D2258 */ if (_t5) goto L_020D225C; else goto L_020D2268;
   L_020D225C: ; // 0x20d225c
         /* 020D225C */ _t6 = cpu->r[31] + 0x00000219u;
         /* 020D225C */ cpu->r[0] = rbrew_read8(cpu->mem, _t6);
-        /* 020D2260 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D2264 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2260 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D2264 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2264 */ _t8 = _t7 & 0x00000001u;
         /* 020D2264 */ if (_t8) goto L_020D2284; else goto L_020D2268;
   L_020D2268: ; // 0x20d2268
@@ -11502,8 +11502,8 @@ void Gambit_fn_020D229C(CPUState* cpu) {
         /* 020D22AC */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 020D22B0 */ _t4 = cpu->r[31] + 0x000001E4u;
         /* 020D22B0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t4);
-        /* 020D22B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020D22B8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D22B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020D22B8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D22B8 */ _t6 = _t5 & 0x00000001u;
         /* 020D22B8 */ if (_t6) goto L_020D22BC; else goto L_020D231C;
   L_020D22BC: ; // 0x20d22bc
@@ -11523,8 +11523,8 @@ void Gambit_fn_020D229C(CPUState* cpu) {
         /* 020D22E4 */ _t10 = cpu->r[1] + 0x00000008u;
         /* 020D22E4 */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
         /* 020D22E8 */ Gambit_fn_027ED2B0(cpu);
-        /* 020D22EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D22F0 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D22EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D22F0 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D22F0 */ _t12 = _t11 & 0x00000001u;
         /* 020D22F0 */ if (_t12) goto L_020D22F4; else goto L_020D231C;
   L_020D22F4: ; // 0x20d22f4
@@ -11547,15 +11547,15 @@ void Gambit_fn_020D229C(CPUState* cpu) {
         /* 020D231C */ cpu->r[4] = rbrew_read32(cpu->mem, _t17);
         /* 020D2320 */ cpu->r[3] = cpu->r[31];
         /* 020D2324 */ Gambit_fn_027EDF00(cpu);
-        /* 020D2328 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D232C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2328 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D232C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D232C */ _t19 = _t18 & 0x00000001u;
         /* 020D232C */ if (_t19) goto L_020D2388; else goto L_020D2330;
   L_020D2330: ; // 0x20d2330
         /* 020D2330 */ _t20 = cpu->r[31] + 0x00000219u;
         /* 020D2330 */ cpu->r[0] = rbrew_read8(cpu->mem, _t20);
-        /* 020D2334 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D2338 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2334 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D2338 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2338 */ _t22 = _t21 & 0x00000001u;
         /* 020D2338 */ if (_t22) goto L_020D2374; else goto L_020D233C;
   L_020D233C: ; // 0x20d233c
@@ -11613,15 +11613,15 @@ void Gambit_fn_020D230C(CPUState* cpu) {
         /* 020D231C */ cpu->r[4] = rbrew_read32(cpu->mem, _t1);
         /* 020D2320 */ cpu->r[3] = cpu->r[31];
         /* 020D2324 */ Gambit_fn_027EDF00(cpu);
-        /* 020D2328 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D232C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2328 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D232C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D232C */ _t3 = _t2 & 0x00000001u;
         /* 020D232C */ if (_t3) goto L_020D2388; else goto L_020D2330;
   L_020D2330: ; // 0x20d2330
         /* 020D2330 */ _t4 = cpu->r[31] + 0x00000219u;
         /* 020D2330 */ cpu->r[0] = rbrew_read8(cpu->mem, _t4);
-        /* 020D2334 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D2338 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2334 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D2338 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2338 */ _t6 = _t5 & 0x00000001u;
         /* 020D2338 */ if (_t6) goto L_020D2374; else goto L_020D233C;
   L_020D233C: ; // 0x20d233c
@@ -11777,15 +11777,15 @@ void Gambit_fn_020D240C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D240C: ; // 0x20d240c
-        /* 020D240C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D2410 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D240C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D2410 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2410 */ _t1 = _t0 & 0x00000001u;
         /* 020D2410 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D2410 */ goto L_020D2414;
   L_020D2414: ; // 0x20d2414
         /* 020D2414 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D2414 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D2418 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2414 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D2418 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2418 */ _t3 = _t2 & 0x00000001u;
         /* 020D2418 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D2418 */ goto L_020D241C;
@@ -11804,8 +11804,8 @@ void Gambit_fn_020D240C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -11819,15 +11819,15 @@ void Gambit_fn_020D240C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -11864,11 +11864,11 @@ void Gambit_fn_020D2420(CPUState* cpu) {
         /* 020D242C */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D242C */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D2430 */ cpu->r[30] = cpu->r[3];
-        /* 020D2430 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D2430 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D2434 */ cpu->r[31] = cpu->r[4];
         /* 020D2438 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D2438 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D243C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D243C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D243C */ _t5 = _t4 & 0x00000001u;
         /* 020D243C */ if (_t5) goto L_020D2480; else goto L_020D2440;
   L_020D2440: ; // 0x20d2440
@@ -11888,8 +11888,8 @@ void Gambit_fn_020D2420(CPUState* cpu) {
         /* 020D2468 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D246C */ Gambit_fn_02068798(cpu);
         /* 020D2470 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D2470 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D2474 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2470 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D2474 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2474 */ _t10 = _t9 & 0x00000001u;
         /* 020D2474 */ if (_t10) goto L_020D2480; else goto L_020D2478;
   L_020D2478: ; // 0x20d2478
@@ -11920,11 +11920,11 @@ void Gambit_fn_020D2424(CPUState* cpu) {
         /* 020D242C */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D242C */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D2430 */ cpu->r[30] = cpu->r[3];
-        /* 020D2430 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D2430 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D2434 */ cpu->r[31] = cpu->r[4];
         /* 020D2438 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D2438 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D243C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D243C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D243C */ _t5 = _t4 & 0x00000001u;
         /* 020D243C */ if (_t5) goto L_020D2480; else goto L_020D2440;
   L_020D2440: ; // 0x20d2440
@@ -11944,8 +11944,8 @@ void Gambit_fn_020D2424(CPUState* cpu) {
         /* 020D2468 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D246C */ Gambit_fn_02068798(cpu);
         /* 020D2470 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D2470 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D2474 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2470 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D2474 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2474 */ _t10 = _t9 & 0x00000001u;
         /* 020D2474 */ if (_t10) goto L_020D2480; else goto L_020D2478;
   L_020D2478: ; // 0x20d2478
@@ -12000,15 +12000,15 @@ void Gambit_fn_020D24B0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D24B0: ; // 0x20d24b0
-        /* 020D24B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D24B4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D24B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D24B4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D24B4 */ _t1 = _t0 & 0x00000001u;
         /* 020D24B4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D24B4 */ goto L_020D24B8;
   L_020D24B8: ; // 0x20d24b8
         /* 020D24B8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D24B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D24BC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D24B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D24BC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D24BC */ _t3 = _t2 & 0x00000001u;
         /* 020D24BC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D24BC */ goto L_020D24C0;
@@ -12027,8 +12027,8 @@ void Gambit_fn_020D24B0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -12042,15 +12042,15 @@ void Gambit_fn_020D24B0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -12096,15 +12096,15 @@ void Gambit_fn_020D24E0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D24E0: ; // 0x20d24e0
-        /* 020D24E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D24E4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D24E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D24E4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D24E4 */ _t1 = _t0 & 0x00000001u;
         /* 020D24E4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D24E4 */ goto L_020D24E8;
   L_020D24E8: ; // 0x20d24e8
         /* 020D24E8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D24E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D24EC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D24E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D24EC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D24EC */ _t3 = _t2 & 0x00000001u;
         /* 020D24EC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D24EC */ goto L_020D24F0;
@@ -12123,8 +12123,8 @@ void Gambit_fn_020D24E0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -12138,15 +12138,15 @@ void Gambit_fn_020D24E0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -12174,15 +12174,15 @@ void Gambit_fn_020D24F4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D24F4: ; // 0x20d24f4
-        /* 020D24F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D24F8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D24F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D24F8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D24F8 */ _t1 = _t0 & 0x00000001u;
         /* 020D24F8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D24F8 */ goto L_020D24FC;
   L_020D24FC: ; // 0x20d24fc
         /* 020D24FC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D24FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D2500 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D24FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D2500 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2500 */ _t3 = _t2 & 0x00000001u;
         /* 020D2500 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D2500 */ goto L_020D2504;
@@ -12201,8 +12201,8 @@ void Gambit_fn_020D24F4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -12216,15 +12216,15 @@ void Gambit_fn_020D24F4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -12252,15 +12252,15 @@ void Gambit_fn_020D2508(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D2508: ; // 0x20d2508
-        /* 020D2508 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D250C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2508 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D250C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D250C */ _t1 = _t0 & 0x00000001u;
         /* 020D250C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D250C */ goto L_020D2510;
   L_020D2510: ; // 0x20d2510
         /* 020D2510 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D2510 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D2514 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2510 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D2514 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2514 */ _t3 = _t2 & 0x00000001u;
         /* 020D2514 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D2514 */ goto L_020D2518;
@@ -12279,8 +12279,8 @@ void Gambit_fn_020D2508(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -12294,15 +12294,15 @@ void Gambit_fn_020D2508(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -12330,15 +12330,15 @@ void Gambit_fn_020D251C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D251C: ; // 0x20d251c
-        /* 020D251C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D2520 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D251C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D2520 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2520 */ _t1 = _t0 & 0x00000001u;
         /* 020D2520 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D2520 */ goto L_020D2524;
   L_020D2524: ; // 0x20d2524
         /* 020D2524 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D2524 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D2528 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D2528 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2528 */ _t3 = _t2 & 0x00000001u;
         /* 020D2528 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D2528 */ goto L_020D252C;
@@ -12357,8 +12357,8 @@ void Gambit_fn_020D251C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -12372,15 +12372,15 @@ void Gambit_fn_020D251C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -12486,9 +12486,9 @@ void Gambit_fn_020D2570(CPUState* cpu) {
         /* 020D2574 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 020D2574 */ cpu->r[9] = _t0;
         /* 020D2578 */ cpu->r[12] = 0x101D0000u;
-        /* 020D257C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 020D257C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 020D2580 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 020D2584 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2584 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2584 */ _t2 = _t1 & 0x00000001u;
         /* 020D2584 */ if (_t2) goto L_020D2588; else goto L_020D259C;
   L_020D2588: ; // 0x20d2588
@@ -12500,8 +12500,8 @@ void Gambit_fn_020D2570(CPUState* cpu) {
         /* 020D2598 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 020D2598 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_020D259C: ; // 0x20d259c
-        /* 020D259C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 020D25A0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D259C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 020D25A0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D25A0 */ _t6 = _t5 & 0x00000001u;
         /* 020D25A0 */ if (_t6) goto L_020D25A4; else goto L_020D25AC;
   L_020D25A4: ; // 0x20d25a4
@@ -12513,9 +12513,9 @@ void Gambit_fn_020D2570(CPUState* cpu) {
         /* 020D25B0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 020D25B0 */ cpu->r[7] = _t7;
         /* 020D25B4 */ cpu->r[11] = 0x101D0000u;
-        /* 020D25B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020D25B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020D25BC */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 020D25C0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D25C0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D25C0 */ _t9 = _t8 & 0x00000001u;
         /* 020D25C0 */ if (_t9) goto L_020D25C4; else goto L_020D25D8;
   L_020D25C4: ; // 0x20d25c4
@@ -12594,18 +12594,18 @@ void Gambit_fn_020D260C(CPUState* cpu) {
         /* 0206ADC0 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0206ADC0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0206ADC4 */ cpu->r[12] = 0x00000000u;
-        /* 0206ADC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0206ADC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0206ADCC */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0206ADCC */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0206ADD0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206ADD0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206ADD0 */ _t6 = _t5 & 0x00000001u;
         /* 0206ADD0 */ if (_t6) goto L_0206ADF8; else goto L_0206ADD4;
   L_0206ADD4: ; // 0x206add4
         /* 0206ADD4 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0206ADD4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0206ADD8 */ /* nop */
-        /* 0206ADDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0206ADE0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206ADDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0206ADE0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206ADE0 */ _t9 = _t8 & 0x00000001u;
         /* 0206ADE0 */ if (_t9) goto L_0206ADE4; else goto L_0206ADF8;
   L_0206ADE4: ; // 0x206ade4
@@ -12653,10 +12653,10 @@ void Gambit_fn_020D2618(CPUState* cpu) {
         /* 020D2638 */ cpu->r[31] = 0x101D0000u;
         /* 020D263C */ _t3 = cpu->r[28] + 0x0000001Cu;
         /* 020D263C */ rbrew_write32(cpu->mem, _t3, cpu->r[4]);
-        /* 020D2640 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020D2640 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020D2644 */ _t4 = cpu->r[28] + 0x0000000Fu;
         /* 020D2644 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[27]);
-        /* 020D2648 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2648 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2648 */ _t6 = _t5 & 0x00000001u;
         /* 020D2648 */ if (_t6) goto L_020D268C; else goto L_020D264C;
   L_020D264C: ; // 0x20d264c
@@ -12671,16 +12671,16 @@ void Gambit_fn_020D2618(CPUState* cpu) {
         /* 020D2660 */ cpu->r[5] = 0x00000004u;
         /* 020D2664 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020D2668 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020D266C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020D266C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020D2670 */ cpu->r[0] = cpu->r[27];
-        /* 020D2674 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D2674 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D2674 */ _t11 = _t10 & 0x00000001u;
         /* 020D2674 */ if (_t11) goto L_020D267C; else goto L_020D2678;
   L_020D2678: ; // 0x20d2678
         /* 020D2678 */ cpu->r[0] = 0x00000001u;
   L_020D267C: ; // 0x20d267c
-        /* 020D267C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D2680 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D267C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D2680 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2680 */ _t13 = _t12 & 0x00000001u;
         /* 020D2680 */ if (_t13) goto L_020D268C; else goto L_020D2684;
   L_020D2684: ; // 0x20d2684
@@ -12692,9 +12692,9 @@ void Gambit_fn_020D2618(CPUState* cpu) {
         /* 020D268C */ _t16 = cpu->r[28] + 0x00000020u;
         /* 020D268C */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 020D2690 */ cpu->r[0] = 0x00000000u;
-        /* 020D2694 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 020D2694 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 020D2698 */ cpu->r[12] = cpu->r[0];
-        /* 020D269C */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D269C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D269C */ _t18 = _t17 & 0x00000001u;
         /* 020D269C */ if (_t18) goto L_020D26A0; else goto L_020D26C4;
   L_020D26A0: ; // 0x20d26a0
@@ -12719,8 +12719,8 @@ void Gambit_fn_020D2618(CPUState* cpu) {
   L_020D26C4: ; // 0x20d26c4
         /* 020D26C4 */ _t26 = cpu->r[28] + 0x0000000Fu;
         /* 020D26C4 */ cpu->r[27] = rbrew_read8(cpu->mem, _t26);
-        /* 020D26C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020D26CC */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D26C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020D26CC */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D26CC */ _t28 = _t27 & 0x00000001u;
         /* 020D26CC */ if (_t28) goto L_020D2710; else goto L_020D26D0;
   L_020D26D0: ; // 0x20d26d0
@@ -12735,16 +12735,16 @@ void Gambit_fn_020D2618(CPUState* cpu) {
         /* 020D26E4 */ cpu->r[5] = 0x00000004u;
         /* 020D26E8 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020D26EC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020D26F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020D26F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020D26F4 */ cpu->r[11] = cpu->r[27];
-        /* 020D26F8 */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D26F8 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D26F8 */ _t33 = _t32 & 0x00000001u;
         /* 020D26F8 */ if (_t33) goto L_020D2700; else goto L_020D26FC;
   L_020D26FC: ; // 0x20d26fc
         /* 020D26FC */ cpu->r[11] = 0x00000001u;
   L_020D2700: ; // 0x20d2700
-        /* 020D2700 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D2704 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D2704 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2704 */ _t35 = _t34 & 0x00000001u;
         /* 020D2704 */ if (_t35) goto L_020D2710; else goto L_020D2708;
   L_020D2708: ; // 0x20d2708
@@ -12756,9 +12756,9 @@ void Gambit_fn_020D2618(CPUState* cpu) {
         /* 020D2710 */ _t38 = cpu->r[28] + 0x00000028u;
         /* 020D2710 */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 020D2714 */ cpu->r[0] = 0x00000000u;
-        /* 020D2718 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 020D2718 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 020D271C */ cpu->r[12] = cpu->r[0];
-        /* 020D2720 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D2720 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D2720 */ _t40 = _t39 & 0x00000001u;
         /* 020D2720 */ if (_t40) goto L_020D2724; else goto L_020D2748;
   L_020D2724: ; // 0x20d2724
@@ -12783,8 +12783,8 @@ void Gambit_fn_020D2618(CPUState* cpu) {
   L_020D2748: ; // 0x20d2748
         /* 020D2748 */ _t48 = cpu->r[28] + 0x0000000Fu;
         /* 020D2748 */ cpu->r[27] = rbrew_read8(cpu->mem, _t48);
-        /* 020D274C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020D2750 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D274C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020D2750 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2750 */ _t50 = _t49 & 0x00000001u;
         /* 020D2750 */ if (_t50) goto L_020D2794; else goto L_020D2754;
   L_020D2754: ; // 0x20d2754
@@ -12799,16 +12799,16 @@ void Gambit_fn_020D2618(CPUState* cpu) {
         /* 020D2768 */ cpu->r[5] = 0x00000004u;
         /* 020D276C */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020D2770 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020D2774 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020D2774 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020D2778 */ cpu->r[10] = cpu->r[27];
-        /* 020D277C */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D277C */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D277C */ _t55 = _t54 & 0x00000001u;
         /* 020D277C */ if (_t55) goto L_020D2784; else goto L_020D2780;
   L_020D2780: ; // 0x20d2780
         /* 020D2780 */ cpu->r[10] = 0x00000001u;
   L_020D2784: ; // 0x20d2784
-        /* 020D2784 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D2788 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2784 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D2788 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2788 */ _t57 = _t56 & 0x00000001u;
         /* 020D2788 */ if (_t57) goto L_020D2794; else goto L_020D278C;
   L_020D278C: ; // 0x20d278c
@@ -12820,9 +12820,9 @@ void Gambit_fn_020D2618(CPUState* cpu) {
         /* 020D2794 */ _t60 = cpu->r[28] + 0x00000030u;
         /* 020D2794 */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
         /* 020D2798 */ cpu->r[0] = 0x00000000u;
-        /* 020D279C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 020D279C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 020D27A0 */ cpu->r[5] = cpu->r[0];
-        /* 020D27A4 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D27A4 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D27A4 */ _t62 = _t61 & 0x00000001u;
         /* 020D27A4 */ if (_t62) goto L_020D27A8; else goto L_020D27CC;
   L_020D27A8: ; // 0x20d27a8
@@ -12847,8 +12847,8 @@ void Gambit_fn_020D2618(CPUState* cpu) {
   L_020D27CC: ; // 0x20d27cc
         /* 020D27CC */ _t70 = cpu->r[30] + 0x00000000u;
         /* 020D27CC */ cpu->r[25] = rbrew_read8(cpu->mem, _t70);
-        /* 020D27D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 020D27D4 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D27D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 020D27D4 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D27D4 */ _t72 = _t71 & 0x00000001u;
         /* 020D27D4 */ if (_t72) goto L_020D28B0; else goto L_020D27D8;
   L_020D27D8: ; // 0x20d27d8
@@ -12864,10 +12864,10 @@ void Gambit_fn_020D2618(CPUState* cpu) {
         /* 020D27F0 */ cpu->r[4] = (uint32_t)((int32_t)cpu->r[25] * (int32_t)0x00000024u);
         /* 020D27F4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020D27F8 */ cpu->r[24] = cpu->r[3];
-        /* 020D27FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 020D27FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 020D2800 */ cpu->r[30] = cpu->r[25];
         /* 020D2804 */ cpu->r[7] = 0x00000000u;
-        /* 020D2808 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D2808 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D2808 */ _t77 = _t76 & 0x00000001u;
         /* 020D2808 */ if (_t77) goto L_020D2810; else goto L_020D280C;
   L_020D280C: ; // 0x20d280c
@@ -12880,36 +12880,36 @@ void Gambit_fn_020D2618(CPUState* cpu) {
         /* 020D281C */ cpu->r[23] = 0x00000018u;
   L_020D2820: ; // 0x20d2820
         /* 020D2820 */ cpu->r[27] = cpu->r[24] + cpu->r[22];
-        /* 020D2820 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020D2824 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2820 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020D2824 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2824 */ _t80 = _t79 & 0x00000001u;
         /* 020D2824 */ if (_t80) goto L_020D2894; else goto L_020D2828;
   L_020D2828: ; // 0x20d2828
         /* 020D2828 */ cpu->r[26] = cpu->r[27];
-        /* 020D2828 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 020D282C */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2828 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 020D282C */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D282C */ _t82 = _t81 & 0x00000001u;
         /* 020D282C */ if (_t82) goto L_020D2830; else goto L_020D2840;
   L_020D2830: ; // 0x20d2830
         /* 020D2830 */ cpu->r[3] = 0x00000024u;
         /* 020D2834 */ Gambit_fn_02801A78(cpu);
         /* 020D2838 */ cpu->r[26] = cpu->r[3];
-        /* 020D2838 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 020D283C */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2838 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 020D283C */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D283C */ _t84 = _t83 & 0x00000001u;
         /* 020D283C */ if (_t84) goto L_020D2888; else goto L_020D2840;
   L_020D2840: ; // 0x20d2840
         /* 020D2840 */ cpu->r[11] = cpu->r[26];
-        /* 020D2840 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020D2844 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2840 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020D2844 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2844 */ _t86 = _t85 & 0x00000001u;
         /* 020D2844 */ if (_t86) goto L_020D2848; else goto L_020D2858;
   L_020D2848: ; // 0x20d2848
         /* 020D2848 */ cpu->r[3] = 0x0000000Cu;
         /* 020D284C */ Gambit_fn_02801A78(cpu);
         /* 020D2850 */ cpu->r[11] = cpu->r[3];
-        /* 020D2850 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020D2854 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2850 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020D2854 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2854 */ _t88 = _t87 & 0x00000001u;
         /* 020D2854 */ if (_t88) goto L_020D2874; else goto L_020D2858;
   L_020D2858: ; // 0x20d2858
@@ -12940,14 +12940,14 @@ void Gambit_fn_020D2618(CPUState* cpu) {
         /* 020D2890 */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
   L_020D2894: ; // 0x20d2894
         /* 020D2894 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 020D2894 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D2894 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D2898 */ cpu->r[22] = cpu->r[22] + 0x00000024u;
-        /* 020D289C */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D289C */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D289C */ _t98 = _t97 & 0x00000001u;
         /* 020D289C */ if (_t98) goto L_020D28A0; else goto L_020D2820;
   L_020D28A0: ; // 0x20d28a0
-        /* 020D28A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 020D28A4 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D28A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 020D28A4 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D28A4 */ _t100 = _t99 & 0x00000001u;
         /* 020D28A4 */ if (_t100) goto L_020D28B0; else goto L_020D28A8;
   L_020D28A8: ; // 0x20d28a8
@@ -12977,10 +12977,10 @@ void Gambit_fn_020D28C8(CPUState* cpu) {
         /* 020D28CC */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 020D28D0 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 020D28D0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 020D28D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[12]);
+        /* 020D28D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[12]));
         /* 020D28D8 */ _t3 = cpu->r[4] + 0x00000000u;
         /* 020D28D8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 020D28DC */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D28DC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D28DC */ _t5 = _t4 & 0x00000001u;
         /* 020D28DC */ if (_t5) goto L_020D28E0; else goto L_020D28E8;
   L_020D28E0: ; // 0x20d28e0
@@ -12997,10 +12997,10 @@ void Gambit_fn_020D28C8(CPUState* cpu) {
         /* 020D28F4 */ cpu->r[9] = rbrew_read8(cpu->mem, _t9);
         /* 020D28F8 */ _t10 = cpu->r[3] + 0x00000028u;
         /* 020D28F8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 020D28FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
+        /* 020D28FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
         /* 020D2900 */ _t11 = cpu->r[3] + 0x0000002Cu;
         /* 020D2900 */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
-        /* 020D2904 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D2904 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D2904 */ _t13 = _t12 & 0x00000001u;
         /* 020D2904 */ if (_t13) goto L_020D2908; else goto L_020D2910;
   L_020D2908: ; // 0x20d2908
@@ -13021,10 +13021,10 @@ void Gambit_fn_020D28C8(CPUState* cpu) {
         /* 020D2924 */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
         /* 020D2928 */ _t20 = cpu->r[3] + 0x00000034u;
         /* 020D2928 */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 020D292C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
+        /* 020D292C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
         /* 020D2930 */ _t21 = cpu->r[6] + 0x00000000u;
         /* 020D2930 */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
-        /* 020D2934 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D2934 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D2934 */ _t23 = _t22 & 0x00000001u;
         /* 020D2934 */ if (_t23) goto L_020D2938; else goto L_020D2940;
   L_020D2938: ; // 0x20d2938
@@ -13057,11 +13057,11 @@ void Gambit_fn_020D2950(CPUState* cpu) {
         /* 020D2AF8 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D2AF8 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D2AFC */ cpu->r[30] = cpu->r[3];
-        /* 020D2AFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D2AFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D2B00 */ cpu->r[31] = cpu->r[4];
         /* 020D2B04 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D2B04 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D2B08 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2B08 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2B08 */ _t5 = _t4 & 0x00000001u;
         /* 020D2B08 */ if (_t5) goto L_020D2B4C; else goto L_020D2B0C;
   L_020D2B0C: ; // 0x20d2b0c
@@ -13081,8 +13081,8 @@ void Gambit_fn_020D2950(CPUState* cpu) {
         /* 020D2B34 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D2B38 */ Gambit_fn_02068798(cpu);
         /* 020D2B3C */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D2B3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D2B40 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2B3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D2B40 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2B40 */ _t10 = _t9 & 0x00000001u;
         /* 020D2B40 */ if (_t10) goto L_020D2B4C; else goto L_020D2B44;
   L_020D2B44: ; // 0x20d2b44
@@ -13110,8 +13110,8 @@ void Gambit_fn_020D2958(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -13165,21 +13165,21 @@ void Gambit_fn_020D2970(CPUState* cpu) {
         /* 020D297C */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D2980 */ cpu->r[30] = cpu->r[5];
         /* 020D2984 */ cpu->r[31] = cpu->r[3];
-        /* 020D2984 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020D2984 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020D2988 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D2988 */ rbrew_write32(cpu->mem, _t3, cpu->r[29]);
         /* 020D298C */ _t4 = cpu->r[1] + 0x00000024u;
         /* 020D298C */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 020D2990 */ cpu->r[29] = cpu->r[4];
-        /* 020D2994 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2994 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2994 */ _t6 = _t5 & 0x00000001u;
         /* 020D2994 */ if (_t6) goto L_020D2998; else goto L_020D29A8;
   L_020D2998: ; // 0x20d2998
         /* 020D2998 */ cpu->r[3] = 0x000001E0u;
         /* 020D299C */ Gambit_fn_02801A78(cpu);
         /* 020D29A0 */ cpu->r[31] = cpu->r[3];
-        /* 020D29A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D29A4 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D29A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D29A4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D29A4 */ _t8 = _t7 & 0x00000001u;
         /* 020D29A4 */ if (_t8) goto L_020D29FC; else goto L_020D29A8;
   L_020D29A8: ; // 0x20d29a8
@@ -13240,21 +13240,21 @@ void Gambit_fn_020D2974(CPUState* cpu) {
         /* 020D297C */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D2980 */ cpu->r[30] = cpu->r[5];
         /* 020D2984 */ cpu->r[31] = cpu->r[3];
-        /* 020D2984 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020D2984 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020D2988 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D2988 */ rbrew_write32(cpu->mem, _t3, cpu->r[29]);
         /* 020D298C */ _t4 = cpu->r[1] + 0x00000024u;
         /* 020D298C */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 020D2990 */ cpu->r[29] = cpu->r[4];
-        /* 020D2994 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2994 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2994 */ _t6 = _t5 & 0x00000001u;
         /* 020D2994 */ if (_t6) goto L_020D2998; else goto L_020D29A8;
   L_020D2998: ; // 0x20d2998
         /* 020D2998 */ cpu->r[3] = 0x000001E0u;
         /* 020D299C */ Gambit_fn_02801A78(cpu);
         /* 020D29A0 */ cpu->r[31] = cpu->r[3];
-        /* 020D29A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D29A4 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D29A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D29A4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D29A4 */ _t8 = _t7 & 0x00000001u;
         /* 020D29A4 */ if (_t8) goto L_020D29FC; else goto L_020D29A8;
   L_020D29A8: ; // 0x20d29a8
@@ -13324,9 +13324,9 @@ void Gambit_fn_020D2A1C(CPUState* cpu) {
         /* 020D2A3C */ cpu->r[4] = 0x101D0000u;
         /* 020D2A40 */ _t5 = cpu->r[30] + 0x00000098u;
         /* 020D2A40 */ cpu->r[31] = rbrew_read32(cpu->mem, _t5);
-        /* 020D2A44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 020D2A44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 020D2A48 */ cpu->r[4] = cpu->r[4] + 0xFFFFED90u;
-        /* 020D2A4C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2A4C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2A4C */ _t7 = _t6 & 0x00000001u;
         /* 020D2A4C */ if (_t7) goto L_020D2A50; else goto L_020D2A64;
   L_020D2A50: ; // 0x20d2a50
@@ -13338,8 +13338,8 @@ void Gambit_fn_020D2A1C(CPUState* cpu) {
         /* 020D2A60 */ _t9 = cpu->r[4] + 0x00000000u;
         /* 020D2A60 */ rbrew_write32(cpu->mem, _t9, cpu->r[0]);
   L_020D2A64: ; // 0x20d2a64
-        /* 020D2A64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D2A68 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2A64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D2A68 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2A68 */ _t11 = _t10 & 0x00000001u;
         /* 020D2A68 */ if (_t11) goto L_020D2ABC; else goto L_020D2A6C;
   L_020D2A6C: ; // 0x20d2a6c
@@ -13350,14 +13350,14 @@ void Gambit_fn_020D2A1C(CPUState* cpu) {
         /* 020D2A74 */ cpu->ctr = cpu->r[7];
         /* 020D2A78 */ cpu->r[3] = cpu->r[31];
         /* 020D2A7C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020D2A80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D2A84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2A80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D2A84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2A84 */ _t15 = _t14 & 0x00000001u;
         /* 020D2A84 */ if (_t15) goto L_020D2ABC; else goto L_020D2A88;
   L_020D2A88: ; // 0x20d2a88
         /* 020D2A88 */ cpu->r[3] = cpu->r[31];
-        /* 020D2A88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D2A8C */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2A88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D2A8C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2A8C */ _t17 = _t16 & 0x00000001u;
         /* 020D2A8C */ if (_t17) goto L_020D2ABC; else goto L_020D2A90;
   L_020D2A90: ; // 0x20d2a90
@@ -13412,9 +13412,9 @@ void Gambit_fn_020D2A20(CPUState* cpu) {
         /* 020D2A3C */ cpu->r[4] = 0x101D0000u;
         /* 020D2A40 */ _t5 = cpu->r[30] + 0x00000098u;
         /* 020D2A40 */ cpu->r[31] = rbrew_read32(cpu->mem, _t5);
-        /* 020D2A44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 020D2A44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 020D2A48 */ cpu->r[4] = cpu->r[4] + 0xFFFFED90u;
-        /* 020D2A4C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2A4C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2A4C */ _t7 = _t6 & 0x00000001u;
         /* 020D2A4C */ if (_t7) goto L_020D2A50; else goto L_020D2A64;
   L_020D2A50: ; // 0x20d2a50
@@ -13426,8 +13426,8 @@ void Gambit_fn_020D2A20(CPUState* cpu) {
         /* 020D2A60 */ _t9 = cpu->r[4] + 0x00000000u;
         /* 020D2A60 */ rbrew_write32(cpu->mem, _t9, cpu->r[0]);
   L_020D2A64: ; // 0x20d2a64
-        /* 020D2A64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D2A68 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2A64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D2A68 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2A68 */ _t11 = _t10 & 0x00000001u;
         /* 020D2A68 */ if (_t11) goto L_020D2ABC; else goto L_020D2A6C;
   L_020D2A6C: ; // 0x20d2a6c
@@ -13438,14 +13438,14 @@ void Gambit_fn_020D2A20(CPUState* cpu) {
         /* 020D2A74 */ cpu->ctr = cpu->r[7];
         /* 020D2A78 */ cpu->r[3] = cpu->r[31];
         /* 020D2A7C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020D2A80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D2A84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2A80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D2A84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2A84 */ _t15 = _t14 & 0x00000001u;
         /* 020D2A84 */ if (_t15) goto L_020D2ABC; else goto L_020D2A88;
   L_020D2A88: ; // 0x20d2a88
         /* 020D2A88 */ cpu->r[3] = cpu->r[31];
-        /* 020D2A88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D2A8C */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2A88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D2A8C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2A8C */ _t17 = _t16 & 0x00000001u;
         /* 020D2A8C */ if (_t17) goto L_020D2ABC; else goto L_020D2A90;
   L_020D2A90: ; // 0x20d2a90
@@ -13483,15 +13483,15 @@ void Gambit_fn_020D2AD8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D2AD8: ; // 0x20d2ad8
-        /* 020D2AD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D2ADC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2AD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D2ADC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2ADC */ _t1 = _t0 & 0x00000001u;
         /* 020D2ADC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D2ADC */ goto L_020D2AE0;
   L_020D2AE0: ; // 0x20d2ae0
         /* 020D2AE0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D2AE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D2AE4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2AE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D2AE4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2AE4 */ _t3 = _t2 & 0x00000001u;
         /* 020D2AE4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D2AE4 */ goto L_020D2AE8;
@@ -13510,8 +13510,8 @@ void Gambit_fn_020D2AD8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -13525,15 +13525,15 @@ void Gambit_fn_020D2AD8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -13570,11 +13570,11 @@ void Gambit_fn_020D2AEC(CPUState* cpu) {
         /* 020D2AF8 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D2AF8 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D2AFC */ cpu->r[30] = cpu->r[3];
-        /* 020D2AFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D2AFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D2B00 */ cpu->r[31] = cpu->r[4];
         /* 020D2B04 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D2B04 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D2B08 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2B08 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2B08 */ _t5 = _t4 & 0x00000001u;
         /* 020D2B08 */ if (_t5) goto L_020D2B4C; else goto L_020D2B0C;
   L_020D2B0C: ; // 0x20d2b0c
@@ -13594,8 +13594,8 @@ void Gambit_fn_020D2AEC(CPUState* cpu) {
         /* 020D2B34 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D2B38 */ Gambit_fn_02068798(cpu);
         /* 020D2B3C */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D2B3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D2B40 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2B3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D2B40 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2B40 */ _t10 = _t9 & 0x00000001u;
         /* 020D2B40 */ if (_t10) goto L_020D2B4C; else goto L_020D2B44;
   L_020D2B44: ; // 0x20d2b44
@@ -13626,11 +13626,11 @@ void Gambit_fn_020D2AF0(CPUState* cpu) {
         /* 020D2AF8 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D2AF8 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D2AFC */ cpu->r[30] = cpu->r[3];
-        /* 020D2AFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D2AFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D2B00 */ cpu->r[31] = cpu->r[4];
         /* 020D2B04 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D2B04 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D2B08 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2B08 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2B08 */ _t5 = _t4 & 0x00000001u;
         /* 020D2B08 */ if (_t5) goto L_020D2B4C; else goto L_020D2B0C;
   L_020D2B0C: ; // 0x20d2b0c
@@ -13650,8 +13650,8 @@ void Gambit_fn_020D2AF0(CPUState* cpu) {
         /* 020D2B34 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D2B38 */ Gambit_fn_02068798(cpu);
         /* 020D2B3C */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D2B3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D2B40 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2B3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D2B40 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2B40 */ _t10 = _t9 & 0x00000001u;
         /* 020D2B40 */ if (_t10) goto L_020D2B4C; else goto L_020D2B44;
   L_020D2B44: ; // 0x20d2b44
@@ -13836,10 +13836,10 @@ void Gambit_fn_020D2BE0(CPUState* cpu) {
         /* 020D2BE0 */ cpu->r[12] = 0x101D0000u;
         /* 020D2BE4 */ _t0 = cpu->r[12] + 0xFFFFED98u;
         /* 020D2BE4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 020D2BE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 020D2BE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 020D2BEC */ cpu->r[12] = 0x101D0000u;
         /* 020D2BF0 */ cpu->r[12] = cpu->r[12] + 0xFFFFEDE0u;
-        /* 020D2BF4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2BF4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2BF4 */ _t2 = _t1 & 0x00000001u;
         /* 020D2BF4 */ if (_t2) goto L_020D2BF8; else goto L_020D2C10;
   L_020D2BF8: ; // 0x20d2bf8
@@ -13852,8 +13852,8 @@ void Gambit_fn_020D2BE0(CPUState* cpu) {
         /* 020D2C0C */ _t4 = cpu->r[12] + 0x00000000u;
         /* 020D2C0C */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_020D2C10: ; // 0x20d2c10
-        /* 020D2C10 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 020D2C14 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2C10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 020D2C14 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2C14 */ _t6 = _t5 & 0x00000001u;
         /* 020D2C14 */ if (_t6) goto L_020D2C18; else goto L_020D2C20;
   L_020D2C18: ; // 0x20d2c18
@@ -13865,9 +13865,9 @@ void Gambit_fn_020D2BE0(CPUState* cpu) {
         /* 020D2C24 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 020D2C24 */ cpu->r[11] = _t7;
         /* 020D2C28 */ cpu->r[10] = 0x101D0000u;
-        /* 020D2C2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020D2C2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020D2C30 */ cpu->r[10] = cpu->r[10] + 0xFFFFED90u;
-        /* 020D2C34 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2C34 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2C34 */ _t9 = _t8 & 0x00000001u;
         /* 020D2C34 */ if (_t9) goto L_020D2C38; else goto L_020D2C4C;
   L_020D2C38: ; // 0x20d2c38
@@ -13879,8 +13879,8 @@ void Gambit_fn_020D2BE0(CPUState* cpu) {
         /* 020D2C48 */ _t11 = cpu->r[10] + 0x00000000u;
         /* 020D2C48 */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
   L_020D2C4C: ; // 0x20d2c4c
-        /* 020D2C4C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 020D2C50 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2C4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 020D2C50 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2C50 */ _t13 = _t12 & 0x00000001u;
         /* 020D2C50 */ if (_t13) goto L_020D2C54; else goto L_020D2C5C;
   L_020D2C54: ; // 0x20d2c54
@@ -13892,9 +13892,9 @@ void Gambit_fn_020D2BE0(CPUState* cpu) {
         /* 020D2C60 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 020D2C60 */ cpu->r[8] = _t14;
         /* 020D2C64 */ cpu->r[11] = 0x101D0000u;
-        /* 020D2C68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020D2C68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020D2C6C */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 020D2C70 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2C70 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2C70 */ _t16 = _t15 & 0x00000001u;
         /* 020D2C70 */ if (_t16) goto L_020D2C74; else goto L_020D2C88;
   L_020D2C74: ; // 0x20d2c74
@@ -13938,11 +13938,11 @@ void Gambit_fn_020D2CA4(CPUState* cpu) {
         /* 020D3364 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D3364 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D3368 */ cpu->r[30] = cpu->r[3];
-        /* 020D3368 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D3368 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D336C */ cpu->r[31] = cpu->r[4];
         /* 020D3370 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D3370 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D3374 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3374 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3374 */ _t5 = _t4 & 0x00000001u;
         /* 020D3374 */ if (_t5) goto L_020D33B8; else goto L_020D3378;
   L_020D3378: ; // 0x20d3378
@@ -13962,8 +13962,8 @@ void Gambit_fn_020D2CA4(CPUState* cpu) {
         /* 020D33A0 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D33A4 */ Gambit_fn_02068798(cpu);
         /* 020D33A8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D33A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D33AC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D33A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D33AC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D33AC */ _t10 = _t9 & 0x00000001u;
         /* 020D33AC */ if (_t10) goto L_020D33B8; else goto L_020D33B0;
   L_020D33B0: ; // 0x20d33b0
@@ -13991,8 +13991,8 @@ void Gambit_fn_020D2CAC(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -14046,21 +14046,21 @@ void Gambit_fn_020D2CC4(CPUState* cpu) {
         /* 020D2CD0 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D2CD4 */ cpu->r[30] = cpu->r[5];
         /* 020D2CD8 */ cpu->r[31] = cpu->r[3];
-        /* 020D2CD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020D2CD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020D2CDC */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D2CDC */ rbrew_write32(cpu->mem, _t3, cpu->r[29]);
         /* 020D2CE0 */ _t4 = cpu->r[1] + 0x00000024u;
         /* 020D2CE0 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 020D2CE4 */ cpu->r[29] = cpu->r[4];
-        /* 020D2CE8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2CE8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2CE8 */ _t6 = _t5 & 0x00000001u;
         /* 020D2CE8 */ if (_t6) goto L_020D2CEC; else goto L_020D2CFC;
   L_020D2CEC: ; // 0x20d2cec
         /* 020D2CEC */ cpu->r[3] = 0x000001E4u;
         /* 020D2CF0 */ Gambit_fn_02801A78(cpu);
         /* 020D2CF4 */ cpu->r[31] = cpu->r[3];
-        /* 020D2CF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D2CF8 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2CF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D2CF8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2CF8 */ _t8 = _t7 & 0x00000001u;
         /* 020D2CF8 */ if (_t8) goto L_020D2D58; else goto L_020D2CFC;
   L_020D2CFC: ; // 0x20d2cfc
@@ -14124,21 +14124,21 @@ void Gambit_fn_020D2CC8(CPUState* cpu) {
         /* 020D2CD0 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D2CD4 */ cpu->r[30] = cpu->r[5];
         /* 020D2CD8 */ cpu->r[31] = cpu->r[3];
-        /* 020D2CD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020D2CD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020D2CDC */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D2CDC */ rbrew_write32(cpu->mem, _t3, cpu->r[29]);
         /* 020D2CE0 */ _t4 = cpu->r[1] + 0x00000024u;
         /* 020D2CE0 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 020D2CE4 */ cpu->r[29] = cpu->r[4];
-        /* 020D2CE8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2CE8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2CE8 */ _t6 = _t5 & 0x00000001u;
         /* 020D2CE8 */ if (_t6) goto L_020D2CEC; else goto L_020D2CFC;
   L_020D2CEC: ; // 0x20d2cec
         /* 020D2CEC */ cpu->r[3] = 0x000001E4u;
         /* 020D2CF0 */ Gambit_fn_02801A78(cpu);
         /* 020D2CF4 */ cpu->r[31] = cpu->r[3];
-        /* 020D2CF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D2CF8 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2CF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D2CF8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2CF8 */ _t8 = _t7 & 0x00000001u;
         /* 020D2CF8 */ if (_t8) goto L_020D2D58; else goto L_020D2CFC;
   L_020D2CFC: ; // 0x20d2cfc
@@ -14289,7 +14289,7 @@ void Gambit_fn_020D2DE8(CPUState* cpu) {
         /* 020D2DE8 */ cpu->r[0] = cpu->lr;
         /* 020D2DEC */ cpu->r[9] = 0x10020000u;
         /* 020D2DF0 */ cpu->r[9] = cpu->r[9] + 0xFFFF80A0u;
-        /* 020D2DF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 020D2DF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 020D2DF8 */ _t0 = cpu->r[1] + 0x00000004u;
         /* 020D2DF8 */ rbrew_write32(cpu->mem, _t0, cpu->r[0]);
         /* 020D2DFC */ cpu->r[0] = 0x10020000u;
@@ -14297,7 +14297,7 @@ void Gambit_fn_020D2DE8(CPUState* cpu) {
         /* 020D2E00 */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 020D2E00 */ cpu->r[1] = _t1;
         /* 020D2E04 */ cpu->r[0] = cpu->r[0] + 0xFFFF80E8u;
-        /* 020D2E08 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2E08 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2E08 */ _t3 = _t2 & 0x00000001u;
         /* 020D2E08 */ if (_t3) goto L_020D2E34; else goto L_020D2E0C;
   L_020D2E0C: ; // 0x20d2e0c
@@ -14341,7 +14341,7 @@ void Gambit_fn_020D2E00(CPUState* cpu) {
         /* 020D2E00 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 020D2E00 */ cpu->r[1] = _t0;
         /* 020D2E04 */ cpu->r[0] = cpu->r[0] + 0xFFFF80E8u;
-        /* 020D2E08 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2E08 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2E08 */ _t2 = _t1 & 0x00000001u;
         /* 020D2E08 */ if (_t2) goto L_020D2E34; else goto L_020D2E0C;
   L_020D2E0C: ; // 0x20d2e0c
@@ -14387,7 +14387,7 @@ void Gambit_fn_020D2E74(CPUState* cpu) {
         /* 020D2E78 */ cpu->r[0] = cpu->r[0] + 0xFFFF80F8u;
         /* 020D2E7C */ _t1 = cpu->r[3] + 0x000001DCu;
         /* 020D2E7C */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
-        /* 020D2E80 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2E80 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2E80 */ _t3 = _t2 & 0x00000001u;
         /* 020D2E80 */ if (_t3) goto L_020D2EA4; else goto L_020D2E84;
   L_020D2E84: ; // 0x20d2e84
@@ -14449,9 +14449,9 @@ void Gambit_fn_020D2EDC(CPUState* cpu) {
         /* 020D2F14 */ cpu->r[12] = rbrew_read32(cpu->mem, _t4);
         /* 020D2F18 */ cpu->r[31] = cpu->r[3];
         /* 020D2F1C */ cpu->r[4] = 0x101D0000u;
-        /* 020D2F20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 020D2F20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 020D2F24 */ cpu->r[4] = cpu->r[4] + 0xFFFFEEECu;
-        /* 020D2F28 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2F28 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2F28 */ _t6 = _t5 & 0x00000001u;
         /* 020D2F28 */ if (_t6) goto L_020D2F2C; else goto L_020D2F44;
   L_020D2F2C: ; // 0x20d2f2c
@@ -14464,8 +14464,8 @@ void Gambit_fn_020D2EDC(CPUState* cpu) {
         /* 020D2F40 */ _t8 = cpu->r[4] + 0x00000000u;
         /* 020D2F40 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
   L_020D2F44: ; // 0x20d2f44
-        /* 020D2F44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D2F48 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2F44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D2F48 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2F48 */ _t10 = _t9 & 0x00000001u;
         /* 020D2F48 */ if (_t10) goto L_020D2F68; else goto L_020D2F4C;
   L_020D2F4C: ; // 0x20d2f4c
@@ -14476,15 +14476,15 @@ void Gambit_fn_020D2EDC(CPUState* cpu) {
         /* 020D2F54 */ cpu->ctr = cpu->r[6];
         /* 020D2F58 */ cpu->r[3] = cpu->r[31];
         /* 020D2F5C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020D2F60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D2F64 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2F60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D2F64 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2F64 */ _t14 = _t13 & 0x00000001u;
         /* 020D2F64 */ if (_t14) goto L_020D2F68; else goto L_020D2F6C;
   L_020D2F68: ; // 0x20d2f68
         /* 020D2F68 */ cpu->r[31] = 0x00000000u;
   L_020D2F6C: ; // 0x20d2f6c
-        /* 020D2F6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D2F70 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2F6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D2F70 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2F70 */ _t16 = _t15 & 0x00000001u;
         /* 020D2F70 */ if (_t16) goto L_020D2F84; else goto L_020D2F74;
   L_020D2F74: ; // 0x20d2f74
@@ -14509,9 +14509,9 @@ void Gambit_fn_020D2EDC(CPUState* cpu) {
         /* 020D2FA8 */ cpu->r[31] = cpu->r[3];
         /* 020D2FAC */ cpu->r[27] = 0x101D0000u;
         /* 020D2FB0 */ cpu->r[29] = 0x10020000u;
-        /* 020D2FB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020D2FB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020D2FB8 */ cpu->r[29] = cpu->r[29] + 0xFFFF80B8u;
-        /* 020D2FBC */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2FBC */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2FBC */ _t21 = _t20 & 0x00000001u;
         /* 020D2FBC */ if (_t21) goto L_020D2FC0; else goto L_020D2FCC;
   L_020D2FC0: ; // 0x20d2fc0
@@ -14521,8 +14521,8 @@ void Gambit_fn_020D2EDC(CPUState* cpu) {
         /* 020D2FC8 */ _t23 = cpu->r[28] + 0x00000000u;
         /* 020D2FC8 */ rbrew_write32(cpu->mem, _t23, cpu->r[9]);
   L_020D2FCC: ; // 0x20d2fcc
-        /* 020D2FCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D2FD0 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2FCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D2FD0 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2FD0 */ _t25 = _t24 & 0x00000001u;
         /* 020D2FD0 */ if (_t25) goto L_020D3000; else goto L_020D2FD4;
   L_020D2FD4: ; // 0x20d2fd4
@@ -14534,14 +14534,14 @@ void Gambit_fn_020D2EDC(CPUState* cpu) {
         /* 020D2FE0 */ cpu->r[3] = cpu->r[31];
         /* 020D2FE4 */ cpu->r[4] = cpu->r[27] + 0xFFFFED90u;
         /* 020D2FE8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020D2FEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D2FF0 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2FEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D2FF0 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2FF0 */ _t29 = _t28 & 0x00000001u;
         /* 020D2FF0 */ if (_t29) goto L_020D3000; else goto L_020D2FF4;
   L_020D2FF4: ; // 0x20d2ff4
         /* 020D2FF4 */ cpu->r[3] = cpu->r[31];
-        /* 020D2FF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D2FF8 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D2FF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D2FF8 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D2FF8 */ _t31 = _t30 & 0x00000001u;
         /* 020D2FF8 */ if (_t31) goto L_020D3038; else goto L_020D2FFC;
   L_020D2FFC: ; // 0x20d2ffc
@@ -14559,9 +14559,9 @@ void Gambit_fn_020D2EDC(CPUState* cpu) {
         /* 020D301C */ Gambit_fn_026D86B0(cpu);
         /* 020D3020 */ _t34 = cpu->r[28] + 0x00000000u;
         /* 020D3020 */ cpu->r[6] = rbrew_read32(cpu->mem, _t34);
-        /* 020D3024 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 020D3024 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 020D3028 */ cpu->r[31] = cpu->r[3];
-        /* 020D302C */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D302C */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D302C */ _t36 = _t35 & 0x00000001u;
         /* 020D302C */ if (_t36) goto L_020D3030; else goto L_020D3070;
   L_020D3030: ; // 0x20d3030
@@ -14580,9 +14580,9 @@ void Gambit_fn_020D2EDC(CPUState* cpu) {
         /* 020D3050 */ Gambit_fn_026D86B0(cpu);
         /* 020D3054 */ _t39 = cpu->r[28] + 0x00000000u;
         /* 020D3054 */ cpu->r[6] = rbrew_read32(cpu->mem, _t39);
-        /* 020D3058 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 020D3058 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 020D305C */ cpu->r[31] = cpu->r[3];
-        /* 020D3060 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3060 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3060 */ _t41 = _t40 & 0x00000001u;
         /* 020D3060 */ if (_t41) goto L_020D3064; else goto L_020D3070;
   L_020D3064: ; // 0x20d3064
@@ -14592,8 +14592,8 @@ void Gambit_fn_020D2EDC(CPUState* cpu) {
         /* 020D306C */ _t43 = cpu->r[28] + 0x00000000u;
         /* 020D306C */ rbrew_write32(cpu->mem, _t43, cpu->r[0]);
   L_020D3070: ; // 0x20d3070
-        /* 020D3070 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D3074 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3070 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D3074 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3074 */ _t45 = _t44 & 0x00000001u;
         /* 020D3074 */ if (_t45) goto L_020D3098; else goto L_020D3078;
   L_020D3078: ; // 0x20d3078
@@ -14605,15 +14605,15 @@ void Gambit_fn_020D2EDC(CPUState* cpu) {
         /* 020D3084 */ cpu->r[3] = cpu->r[31];
         /* 020D3088 */ cpu->r[4] = cpu->r[27] + 0xFFFFED90u;
         /* 020D308C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020D3090 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D3094 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3090 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D3094 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3094 */ _t49 = _t48 & 0x00000001u;
         /* 020D3094 */ if (_t49) goto L_020D3098; else goto L_020D309C;
   L_020D3098: ; // 0x20d3098
         /* 020D3098 */ cpu->r[31] = 0x00000000u;
   L_020D309C: ; // 0x20d309c
-        /* 020D309C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D30A0 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D309C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D30A0 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D30A0 */ _t51 = _t50 & 0x00000001u;
         /* 020D30A0 */ if (_t51) goto L_020D30AC; else goto L_020D30A4;
   L_020D30A4: ; // 0x20d30a4
@@ -14766,21 +14766,21 @@ void Gambit_fn_020D317C(CPUState* cpu) {
         /* 020D318C */ _t2 = cpu->r[1] + 0x00000024u;
         /* 020D318C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020D3190 */ Gambit_fn_027F69F8(cpu);
-        /* 020D3194 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D3198 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3194 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D3198 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3198 */ _t4 = _t3 & 0x00000001u;
         /* 020D3198 */ if (_t4) goto L_020D31D4; else goto L_020D319C;
   L_020D319C: ; // 0x20d319c
-        /* 020D319C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020D319C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020D31A0 */ cpu->r[3] = cpu->r[31];
-        /* 020D31A4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D31A4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D31A4 */ _t6 = _t5 & 0x00000001u;
         /* 020D31A4 */ if (_t6) goto L_020D31A8; else goto L_020D31B8;
   L_020D31A8: ; // 0x20d31a8
         /* 020D31A8 */ cpu->r[3] = 0x00000004u;
         /* 020D31AC */ Gambit_fn_02801A78(cpu);
-        /* 020D31B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D31B4 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D31B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D31B4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D31B4 */ _t8 = _t7 & 0x00000001u;
         /* 020D31B4 */ if (_t8) goto L_020D3254; else goto L_020D31B8;
   L_020D31B8: ; // 0x20d31b8
@@ -14803,21 +14803,21 @@ void Gambit_fn_020D317C(CPUState* cpu) {
         /* 020D31E8 */ _t12 = cpu->r[1] + 0x00000008u;
         /* 020D31E8 */ rbrew_write32(cpu->mem, _t12, cpu->r[12]);
         /* 020D31EC */ Gambit_fn_02172B08(cpu);
-        /* 020D31F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D31F4 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D31F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D31F4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D31F4 */ _t14 = _t13 & 0x00000001u;
         /* 020D31F4 */ if (_t14) goto L_020D3228; else goto L_020D31F8;
   L_020D31F8: ; // 0x20d31f8
-        /* 020D31F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D31FC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D31F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D31FC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D31FC */ _t16 = _t15 & 0x00000001u;
         /* 020D31FC */ if (_t16) goto L_020D3200; else goto L_020D3210;
   L_020D3200: ; // 0x20d3200
         /* 020D3200 */ cpu->r[3] = 0x00000004u;
         /* 020D3204 */ Gambit_fn_02801A78(cpu);
         /* 020D3208 */ cpu->r[31] = cpu->r[3];
-        /* 020D3208 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D320C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D320C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D320C */ _t18 = _t17 & 0x00000001u;
         /* 020D320C */ if (_t18) goto L_020D3248; else goto L_020D3210;
   L_020D3210: ; // 0x20d3210
@@ -14829,16 +14829,16 @@ void Gambit_fn_020D317C(CPUState* cpu) {
         /* 020D3220 */ Gambit_fn_02172A44(cpu);
         /* 020D3224 */ goto L_020D3254;
   L_020D3228: ; // 0x20d3228
-        /* 020D3228 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D322C */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D322C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D322C */ _t21 = _t20 & 0x00000001u;
         /* 020D322C */ if (_t21) goto L_020D3230; else goto L_020D3240;
   L_020D3230: ; // 0x20d3230
         /* 020D3230 */ cpu->r[3] = 0x00000004u;
         /* 020D3234 */ Gambit_fn_02801A78(cpu);
         /* 020D3238 */ cpu->r[31] = cpu->r[3];
-        /* 020D3238 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D323C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3238 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D323C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D323C */ _t23 = _t22 & 0x00000001u;
         /* 020D323C */ if (_t23) goto L_020D3248; else goto L_020D3240;
   L_020D3240: ; // 0x20d3240
@@ -14873,21 +14873,21 @@ void Gambit_fn_020D3180(CPUState* cpu) {
         /* 020D318C */ _t2 = cpu->r[1] + 0x00000024u;
         /* 020D318C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020D3190 */ Gambit_fn_027F69F8(cpu);
-        /* 020D3194 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D3198 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3194 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D3198 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3198 */ _t4 = _t3 & 0x00000001u;
         /* 020D3198 */ if (_t4) goto L_020D31D4; else goto L_020D319C;
   L_020D319C: ; // 0x20d319c
-        /* 020D319C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020D319C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020D31A0 */ cpu->r[3] = cpu->r[31];
-        /* 020D31A4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D31A4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D31A4 */ _t6 = _t5 & 0x00000001u;
         /* 020D31A4 */ if (_t6) goto L_020D31A8; else goto L_020D31B8;
   L_020D31A8: ; // 0x20d31a8
         /* 020D31A8 */ cpu->r[3] = 0x00000004u;
         /* 020D31AC */ Gambit_fn_02801A78(cpu);
-        /* 020D31B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D31B4 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D31B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D31B4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D31B4 */ _t8 = _t7 & 0x00000001u;
         /* 020D31B4 */ if (_t8) goto L_020D3254; else goto L_020D31B8;
   L_020D31B8: ; // 0x20d31b8
@@ -14910,21 +14910,21 @@ void Gambit_fn_020D3180(CPUState* cpu) {
         /* 020D31E8 */ _t12 = cpu->r[1] + 0x00000008u;
         /* 020D31E8 */ rbrew_write32(cpu->mem, _t12, cpu->r[12]);
         /* 020D31EC */ Gambit_fn_02172B08(cpu);
-        /* 020D31F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D31F4 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D31F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D31F4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D31F4 */ _t14 = _t13 & 0x00000001u;
         /* 020D31F4 */ if (_t14) goto L_020D3228; else goto L_020D31F8;
   L_020D31F8: ; // 0x20d31f8
-        /* 020D31F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D31FC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D31F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D31FC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D31FC */ _t16 = _t15 & 0x00000001u;
         /* 020D31FC */ if (_t16) goto L_020D3200; else goto L_020D3210;
   L_020D3200: ; // 0x20d3200
         /* 020D3200 */ cpu->r[3] = 0x00000004u;
         /* 020D3204 */ Gambit_fn_02801A78(cpu);
         /* 020D3208 */ cpu->r[31] = cpu->r[3];
-        /* 020D3208 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D320C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D320C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D320C */ _t18 = _t17 & 0x00000001u;
         /* 020D320C */ if (_t18) goto L_020D3248; else goto L_020D3210;
   L_020D3210: ; // 0x20d3210
@@ -14936,16 +14936,16 @@ void Gambit_fn_020D3180(CPUState* cpu) {
         /* 020D3220 */ Gambit_fn_02172A44(cpu);
         /* 020D3224 */ goto L_020D3254;
   L_020D3228: ; // 0x20d3228
-        /* 020D3228 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D322C */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D322C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D322C */ _t21 = _t20 & 0x00000001u;
         /* 020D322C */ if (_t21) goto L_020D3230; else goto L_020D3240;
   L_020D3230: ; // 0x20d3230
         /* 020D3230 */ cpu->r[3] = 0x00000004u;
         /* 020D3234 */ Gambit_fn_02801A78(cpu);
         /* 020D3238 */ cpu->r[31] = cpu->r[3];
-        /* 020D3238 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D323C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3238 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D323C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D323C */ _t23 = _t22 & 0x00000001u;
         /* 020D323C */ if (_t23) goto L_020D3248; else goto L_020D3240;
   L_020D3240: ; // 0x20d3240
@@ -15161,15 +15161,15 @@ void Gambit_fn_020D3344(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D3344: ; // 0x20d3344
-        /* 020D3344 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D3348 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3344 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D3348 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3348 */ _t1 = _t0 & 0x00000001u;
         /* 020D3348 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D3348 */ goto L_020D334C;
   L_020D334C: ; // 0x20d334c
         /* 020D334C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D334C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D3350 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D334C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D3350 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3350 */ _t3 = _t2 & 0x00000001u;
         /* 020D3350 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D3350 */ goto L_020D3354;
@@ -15188,8 +15188,8 @@ void Gambit_fn_020D3344(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -15203,15 +15203,15 @@ void Gambit_fn_020D3344(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -15248,11 +15248,11 @@ void Gambit_fn_020D3358(CPUState* cpu) {
         /* 020D3364 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D3364 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D3368 */ cpu->r[30] = cpu->r[3];
-        /* 020D3368 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D3368 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D336C */ cpu->r[31] = cpu->r[4];
         /* 020D3370 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D3370 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D3374 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3374 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3374 */ _t5 = _t4 & 0x00000001u;
         /* 020D3374 */ if (_t5) goto L_020D33B8; else goto L_020D3378;
   L_020D3378: ; // 0x20d3378
@@ -15272,8 +15272,8 @@ void Gambit_fn_020D3358(CPUState* cpu) {
         /* 020D33A0 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D33A4 */ Gambit_fn_02068798(cpu);
         /* 020D33A8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D33A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D33AC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D33A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D33AC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D33AC */ _t10 = _t9 & 0x00000001u;
         /* 020D33AC */ if (_t10) goto L_020D33B8; else goto L_020D33B0;
   L_020D33B0: ; // 0x20d33b0
@@ -15304,11 +15304,11 @@ void Gambit_fn_020D335C(CPUState* cpu) {
         /* 020D3364 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D3364 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D3368 */ cpu->r[30] = cpu->r[3];
-        /* 020D3368 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D3368 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D336C */ cpu->r[31] = cpu->r[4];
         /* 020D3370 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D3370 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D3374 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3374 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3374 */ _t5 = _t4 & 0x00000001u;
         /* 020D3374 */ if (_t5) goto L_020D33B8; else goto L_020D3378;
   L_020D3378: ; // 0x20d3378
@@ -15328,8 +15328,8 @@ void Gambit_fn_020D335C(CPUState* cpu) {
         /* 020D33A0 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D33A4 */ Gambit_fn_02068798(cpu);
         /* 020D33A8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D33A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D33AC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D33A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D33AC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D33AC */ _t10 = _t9 & 0x00000001u;
         /* 020D33AC */ if (_t10) goto L_020D33B8; else goto L_020D33B0;
   L_020D33B0: ; // 0x20d33b0
@@ -15509,10 +15509,10 @@ void Gambit_fn_020D344C(CPUState* cpu) {
         /* 020D344C */ cpu->r[12] = 0x101D0000u;
         /* 020D3450 */ _t0 = cpu->r[12] + 0xFFFFEDA8u;
         /* 020D3450 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 020D3454 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 020D3454 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 020D3458 */ cpu->r[12] = 0x101D0000u;
         /* 020D345C */ cpu->r[12] = cpu->r[12] + 0xFFFFEDF4u;
-        /* 020D3460 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3460 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3460 */ _t2 = _t1 & 0x00000001u;
         /* 020D3460 */ if (_t2) goto L_020D3464; else goto L_020D347C;
   L_020D3464: ; // 0x20d3464
@@ -15525,8 +15525,8 @@ void Gambit_fn_020D344C(CPUState* cpu) {
         /* 020D3478 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 020D3478 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_020D347C: ; // 0x20d347c
-        /* 020D347C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 020D3480 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D347C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 020D3480 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3480 */ _t6 = _t5 & 0x00000001u;
         /* 020D3480 */ if (_t6) goto L_020D3484; else goto L_020D348C;
   L_020D3484: ; // 0x20d3484
@@ -15538,9 +15538,9 @@ void Gambit_fn_020D344C(CPUState* cpu) {
         /* 020D3490 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 020D3490 */ cpu->r[11] = _t7;
         /* 020D3494 */ cpu->r[10] = 0x101D0000u;
-        /* 020D3498 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020D3498 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020D349C */ cpu->r[10] = cpu->r[10] + 0xFFFFED90u;
-        /* 020D34A0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D34A0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D34A0 */ _t9 = _t8 & 0x00000001u;
         /* 020D34A0 */ if (_t9) goto L_020D34A4; else goto L_020D34B8;
   L_020D34A4: ; // 0x20d34a4
@@ -15552,8 +15552,8 @@ void Gambit_fn_020D344C(CPUState* cpu) {
         /* 020D34B4 */ _t11 = cpu->r[10] + 0x00000000u;
         /* 020D34B4 */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
   L_020D34B8: ; // 0x20d34b8
-        /* 020D34B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 020D34BC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D34B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 020D34BC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D34BC */ _t13 = _t12 & 0x00000001u;
         /* 020D34BC */ if (_t13) goto L_020D34C0; else goto L_020D34C8;
   L_020D34C0: ; // 0x20d34c0
@@ -15565,9 +15565,9 @@ void Gambit_fn_020D344C(CPUState* cpu) {
         /* 020D34CC */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 020D34CC */ cpu->r[8] = _t14;
         /* 020D34D0 */ cpu->r[11] = 0x101D0000u;
-        /* 020D34D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020D34D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020D34D8 */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 020D34DC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D34DC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D34DC */ _t16 = _t15 & 0x00000001u;
         /* 020D34DC */ if (_t16) goto L_020D34E0; else goto L_020D34F4;
   L_020D34E0: ; // 0x20d34e0
@@ -15611,11 +15611,11 @@ void Gambit_fn_020D3510(CPUState* cpu) {
         /* 020D41A4 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D41A4 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D41A8 */ cpu->r[30] = cpu->r[3];
-        /* 020D41A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D41A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D41AC */ cpu->r[31] = cpu->r[4];
         /* 020D41B0 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D41B0 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D41B4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D41B4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D41B4 */ _t5 = _t4 & 0x00000001u;
         /* 020D41B4 */ if (_t5) goto L_020D41F8; else goto L_020D41B8;
   L_020D41B8: ; // 0x20d41b8
@@ -15635,8 +15635,8 @@ void Gambit_fn_020D3510(CPUState* cpu) {
         /* 020D41E0 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D41E4 */ Gambit_fn_02068798(cpu);
         /* 020D41E8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D41E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D41EC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D41E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D41EC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D41EC */ _t10 = _t9 & 0x00000001u;
         /* 020D41EC */ if (_t10) goto L_020D41F8; else goto L_020D41F0;
   L_020D41F0: ; // 0x20d41f0
@@ -15664,8 +15664,8 @@ void Gambit_fn_020D3518(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -15717,18 +15717,18 @@ void Gambit_fn_020D3530(CPUState* cpu) {
         /* 020D3538 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020D353C */ /* nop */
         /* 020D3540 */ cpu->r[29] = cpu->r[3];
-        /* 020D3540 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020D3540 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020D3544 */ cpu->r[30] = cpu->r[4];
         /* 020D3548 */ cpu->r[31] = cpu->r[5];
-        /* 020D354C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D354C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D354C */ _t3 = _t2 & 0x00000001u;
         /* 020D354C */ if (_t3) goto L_020D3550; else goto L_020D3560;
   L_020D3550: ; // 0x20d3550
         /* 020D3550 */ cpu->r[3] = 0x00000224u;
         /* 020D3554 */ Gambit_fn_02801A78(cpu);
         /* 020D3558 */ cpu->r[29] = cpu->r[3];
-        /* 020D3558 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020D355C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3558 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020D355C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D355C */ _t5 = _t4 & 0x00000001u;
         /* 020D355C */ if (_t5) goto L_020D3A9C; else goto L_020D3560;
   L_020D3560: ; // 0x20d3560
@@ -15755,22 +15755,22 @@ void Gambit_fn_020D3530(CPUState* cpu) {
         /* 020D35A0 */ rbrew_write32(cpu->mem, _t9, cpu->r[5]);
         /* 020D35A4 */ cpu->r[7] = cpu->r[7] + 0xFFFF85C0u;
         /* 020D35A8 */ cpu->r[27] = cpu->r[29] + 0x000001DCu;
-        /* 020D35A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020D35A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020D35AC */ _t10 = cpu->r[29] + 0x0000001Cu;
         /* 020D35AC */ rbrew_write32(cpu->mem, _t10, cpu->r[6]);
         /* 020D35B0 */ cpu->r[28] = 0x00000000u;
         /* 020D35B4 */ cpu->r[30] = cpu->r[27];
         /* 020D35B8 */ _t11 = cpu->r[29] + 0x000001C8u;
         /* 020D35B8 */ rbrew_write32(cpu->mem, _t11, cpu->r[7]);
-        /* 020D35BC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D35BC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D35BC */ _t13 = _t12 & 0x00000001u;
         /* 020D35BC */ if (_t13) goto L_020D35C0; else goto L_020D35D0;
   L_020D35C0: ; // 0x20d35c0
         /* 020D35C0 */ cpu->r[3] = 0x00000038u;
         /* 020D35C4 */ Gambit_fn_02801A78(cpu);
         /* 020D35C8 */ cpu->r[30] = cpu->r[3];
-        /* 020D35C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 020D35CC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D35C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 020D35CC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D35CC */ _t15 = _t14 & 0x00000001u;
         /* 020D35CC */ if (_t15) goto L_020D3600; else goto L_020D35D0;
   L_020D35D0: ; // 0x20d35d0
@@ -15796,17 +15796,17 @@ void Gambit_fn_020D3530(CPUState* cpu) {
         /* 020D35FC */ rbrew_write32(cpu->mem, _t23, cpu->r[28]);
   L_020D3600: ; // 0x20d3600
         /* 020D3600 */ cpu->r[3] = cpu->r[29] + 0x00000218u;
-        /* 020D3600 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 020D3600 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 020D3604 */ _t24 = cpu->r[29] + 0x00000214u;
         /* 020D3604 */ rbrew_write32(cpu->mem, _t24, cpu->r[31]);
-        /* 020D3608 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3608 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3608 */ _t26 = _t25 & 0x00000001u;
         /* 020D3608 */ if (_t26) goto L_020D360C; else goto L_020D361C;
   L_020D360C: ; // 0x20d360c
         /* 020D360C */ cpu->r[3] = 0x00000008u;
         /* 020D3610 */ Gambit_fn_02801A78(cpu);
-        /* 020D3614 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D3618 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3614 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D3618 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3618 */ _t28 = _t27 & 0x00000001u;
         /* 020D3618 */ if (_t28) goto L_020D3624; else goto L_020D361C;
   L_020D361C: ; // 0x20d361c
@@ -15850,23 +15850,23 @@ void Gambit_fn_020D3530(CPUState* cpu) {
         /* 020D3680 */ _t40 = cpu->r[5] + 0x00000000u;
         /* 020D3680 */ cpu->r[10] = rbrew_read8(cpu->mem, _t40);
         /* 020D3684 */ cpu->r[31] = 0x00000000u;
-        /* 020D3688 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[30]);
+        /* 020D3688 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[30]));
         /* 020D368C */ cpu->r[7] = 0x00080000u;
-        /* 020D3690 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3690 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3690 */ _t42 = _t41 & 0x00000001u;
         /* 020D3690 */ if (_t42) goto L_020D36B8; else goto L_020D3694;
   L_020D3694: ; // 0x20d3694
         /* 020D3694 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020D3698 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 020D3698 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 020D369C */ cpu->r[5] = cpu->r[5] + 0x00000001u;
-        /* 020D36A0 */ _t43 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D36A0 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D36A0 */ _t44 = _t43 & 0x00000001u;
         /* 020D36A0 */ if (_t44) goto L_020D36B4; else goto L_020D36A4;
   L_020D36A4: ; // 0x20d36a4
         /* 020D36A4 */ _t45 = cpu->r[5] + 0x00000000u;
         /* 020D36A4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t45);
-        /* 020D36A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
-        /* 020D36AC */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D36A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
+        /* 020D36AC */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D36AC */ _t47 = _t46 & 0x00000001u;
         /* 020D36AC */ if (_t47) goto L_020D36B0; else goto L_020D3694;
   L_020D36B0: ; // 0x20d36b0
@@ -15878,10 +15878,10 @@ void Gambit_fn_020D3530(CPUState* cpu) {
         /* 020D36B8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t48);
         /* 020D36BC */ _t49 = cpu->r[1] + 0x00000010u;
         /* 020D36BC */ cpu->r[12] = rbrew_read32(cpu->mem, _t49);
-        /* 020D36C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 020D36C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 020D36C4 */ _t50 = cpu->r[12] + 0x00000014u;
         /* 020D36C4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t50);
-        /* 020D36C8 */ _t51 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D36C8 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D36C8 */ _t52 = _t51 & 0x00000001u;
         /* 020D36C8 */ if (_t52) goto L_020D36D0; else goto L_020D36CC;
   L_020D36CC: ; // 0x20d36cc
@@ -15936,10 +15936,10 @@ void Gambit_fn_020D3530(CPUState* cpu) {
         /* 020D3750 */ rbrew_write32(cpu->mem, _t66, cpu->r[7]);
         /* 020D3754 */ _t67 = cpu->r[27] + 0x00000014u;
         /* 020D3754 */ cpu->r[8] = rbrew_read32(cpu->mem, _t67);
-        /* 020D3758 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000001u);
+        /* 020D3758 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000001u));
         /* 020D375C */ _t68 = cpu->r[27] + 0x00000018u;
         /* 020D375C */ cpu->r[26] = rbrew_read32(cpu->mem, _t68);
-        /* 020D3760 */ _t69 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D3760 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D3760 */ _t70 = _t69 & 0x00000001u;
         /* 020D3760 */ if (_t70) goto L_020D3764; else goto L_020D3768;
   L_020D3764: ; // 0x20d3764
@@ -15955,23 +15955,23 @@ void Gambit_fn_020D3530(CPUState* cpu) {
         /* 020D377C */ _t73 = cpu->r[10] + 0x00000000u;
         /* 020D377C */ cpu->r[9] = rbrew_read8(cpu->mem, _t73);
         /* 020D3780 */ cpu->r[31] = 0x00000000u;
-        /* 020D3784 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[30]);
+        /* 020D3784 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[30]));
         /* 020D3788 */ cpu->r[12] = 0x00080000u;
-        /* 020D378C */ _t74 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D378C */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D378C */ _t75 = _t74 & 0x00000001u;
         /* 020D378C */ if (_t75) goto L_020D37B4; else goto L_020D3790;
   L_020D3790: ; // 0x20d3790
         /* 020D3790 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020D3794 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 020D3794 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 020D3798 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 020D379C */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D379C */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D379C */ _t77 = _t76 & 0x00000001u;
         /* 020D379C */ if (_t77) goto L_020D37B0; else goto L_020D37A0;
   L_020D37A0: ; // 0x20d37a0
         /* 020D37A0 */ _t78 = cpu->r[10] + 0x00000000u;
         /* 020D37A0 */ cpu->r[11] = rbrew_read8(cpu->mem, _t78);
-        /* 020D37A4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[30]);
-        /* 020D37A8 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D37A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[30]));
+        /* 020D37A8 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D37A8 */ _t80 = _t79 & 0x00000001u;
         /* 020D37A8 */ if (_t80) goto L_020D37AC; else goto L_020D3790;
   L_020D37AC: ; // 0x20d37ac
@@ -15983,10 +15983,10 @@ void Gambit_fn_020D3530(CPUState* cpu) {
         /* 020D37B4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t81);
         /* 020D37B8 */ _t82 = cpu->r[1] + 0x00000010u;
         /* 020D37B8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t82);
-        /* 020D37BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 020D37BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 020D37C0 */ _t83 = cpu->r[5] + 0x00000014u;
         /* 020D37C0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t83);
-        /* 020D37C4 */ _t84 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D37C4 */ _t84 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D37C4 */ _t85 = _t84 & 0x00000001u;
         /* 020D37C4 */ if (_t85) goto L_020D37CC; else goto L_020D37C8;
   L_020D37C8: ; // 0x20d37c8
@@ -16041,10 +16041,10 @@ void Gambit_fn_020D3530(CPUState* cpu) {
         /* 020D384C */ rbrew_write32(cpu->mem, _t99, cpu->r[0]);
         /* 020D3850 */ _t100 = cpu->r[27] + 0x00000014u;
         /* 020D3850 */ cpu->r[5] = rbrew_read32(cpu->mem, _t100);
-        /* 020D3854 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x00000002u);
+        /* 020D3854 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x00000002u));
         /* 020D3858 */ _t101 = cpu->r[27] + 0x00000018u;
         /* 020D3858 */ cpu->r[26] = rbrew_read32(cpu->mem, _t101);
-        /* 020D385C */ _t102 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D385C */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D385C */ _t103 = _t102 & 0x00000001u;
         /* 020D385C */ if (_t103) goto L_020D3860; else goto L_020D3864;
   L_020D3860: ; // 0x20d3860
@@ -16060,23 +16060,23 @@ void Gambit_fn_020D3530(CPUState* cpu) {
         /* 020D3878 */ _t106 = cpu->r[6] + 0x00000000u;
         /* 020D3878 */ cpu->r[8] = rbrew_read8(cpu->mem, _t106);
         /* 020D387C */ cpu->r[31] = 0x00000000u;
-        /* 020D3880 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[30]);
+        /* 020D3880 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[30]));
         /* 020D3884 */ cpu->r[7] = 0x00080000u;
-        /* 020D3888 */ _t107 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3888 */ _t107 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3888 */ _t108 = _t107 & 0x00000001u;
         /* 020D3888 */ if (_t108) goto L_020D38B0; else goto L_020D388C;
   L_020D388C: ; // 0x20d388c
         /* 020D388C */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020D3890 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 020D3890 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 020D3894 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 020D3898 */ _t109 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D3898 */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D3898 */ _t110 = _t109 & 0x00000001u;
         /* 020D3898 */ if (_t110) goto L_020D38AC; else goto L_020D389C;
   L_020D389C: ; // 0x20d389c
         /* 020D389C */ _t111 = cpu->r[6] + 0x00000000u;
         /* 020D389C */ cpu->r[0] = rbrew_read8(cpu->mem, _t111);
-        /* 020D38A0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
-        /* 020D38A4 */ _t112 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D38A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
+        /* 020D38A4 */ _t112 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D38A4 */ _t113 = _t112 & 0x00000001u;
         /* 020D38A4 */ if (_t113) goto L_020D38A8; else goto L_020D388C;
   L_020D38A8: ; // 0x20d38a8
@@ -16088,10 +16088,10 @@ void Gambit_fn_020D3530(CPUState* cpu) {
         /* 020D38B0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t114);
         /* 020D38B4 */ _t115 = cpu->r[1] + 0x00000010u;
         /* 020D38B4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t115);
-        /* 020D38B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 020D38B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 020D38BC */ _t116 = cpu->r[11] + 0x00000014u;
         /* 020D38BC */ cpu->r[0] = rbrew_read32(cpu->mem, _t116);
-        /* 020D38C0 */ _t117 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D38C0 */ _t117 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D38C0 */ _t118 = _t117 & 0x00000001u;
         /* 020D38C0 */ if (_t118) goto L_020D38C8; else goto L_020D38C4;
   L_020D38C4: ; // 0x20d38c4
@@ -16146,10 +16146,10 @@ void Gambit_fn_020D3530(CPUState* cpu) {
         /* 020D3948 */ rbrew_write32(cpu->mem, _t132, cpu->r[8]);
         /* 020D394C */ _t133 = cpu->r[27] + 0x00000014u;
         /* 020D394C */ cpu->r[9] = rbrew_read32(cpu->mem, _t133);
-        /* 020D3950 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000003u);
+        /* 020D3950 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000003u));
         /* 020D3954 */ _t134 = cpu->r[27] + 0x00000018u;
         /* 020D3954 */ cpu->r[26] = rbrew_read32(cpu->mem, _t134);
-        /* 020D3958 */ _t135 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D3958 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D3958 */ _t136 = _t135 & 0x00000001u;
         /* 020D3958 */ if (_t136) goto L_020D395C; else goto L_020D3960;
   L_020D395C: ; // 0x20d395c
@@ -16165,23 +16165,23 @@ void Gambit_fn_020D3530(CPUState* cpu) {
         /* 020D3974 */ _t139 = cpu->r[10] + 0x00000000u;
         /* 020D3974 */ cpu->r[11] = rbrew_read8(cpu->mem, _t139);
         /* 020D3978 */ cpu->r[31] = 0x00000000u;
-        /* 020D397C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[30]);
+        /* 020D397C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[30]));
         /* 020D3980 */ cpu->r[12] = 0x00080000u;
-        /* 020D3984 */ _t140 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3984 */ _t140 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3984 */ _t141 = _t140 & 0x00000001u;
         /* 020D3984 */ if (_t141) goto L_020D39AC; else goto L_020D3988;
   L_020D3988: ; // 0x20d3988
         /* 020D3988 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020D398C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 020D398C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 020D3990 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 020D3994 */ _t142 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D3994 */ _t142 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D3994 */ _t143 = _t142 & 0x00000001u;
         /* 020D3994 */ if (_t143) goto L_020D39A8; else goto L_020D3998;
   L_020D3998: ; // 0x20d3998
         /* 020D3998 */ _t144 = cpu->r[10] + 0x00000000u;
         /* 020D3998 */ cpu->r[0] = rbrew_read8(cpu->mem, _t144);
-        /* 020D399C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
-        /* 020D39A0 */ _t145 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D399C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
+        /* 020D39A0 */ _t145 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D39A0 */ _t146 = _t145 & 0x00000001u;
         /* 020D39A0 */ if (_t146) goto L_020D39A4; else goto L_020D3988;
   L_020D39A4: ; // 0x20d39a4
@@ -16193,10 +16193,10 @@ void Gambit_fn_020D3530(CPUState* cpu) {
         /* 020D39AC */ cpu->r[7] = rbrew_read32(cpu->mem, _t147);
         /* 020D39B0 */ _t148 = cpu->r[1] + 0x00000010u;
         /* 020D39B0 */ cpu->r[6] = rbrew_read32(cpu->mem, _t148);
-        /* 020D39B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 020D39B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 020D39B8 */ _t149 = cpu->r[6] + 0x00000014u;
         /* 020D39B8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t149);
-        /* 020D39BC */ _t150 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D39BC */ _t150 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D39BC */ _t151 = _t150 & 0x00000001u;
         /* 020D39BC */ if (_t151) goto L_020D39C4; else goto L_020D39C0;
   L_020D39C0: ; // 0x20d39c0
@@ -16257,8 +16257,8 @@ void Gambit_fn_020D3530(CPUState* cpu) {
         /* 020D3A54 */ cpu->r[4] = 0x00000008u;
         /* 020D3A58 */ cpu->r[5] = 0x00000004u;
         /* 020D3A5C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020D3A60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D3A64 */ _t168 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3A60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D3A64 */ _t168 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3A64 */ _t169 = _t168 & 0x00000001u;
         /* 020D3A64 */ if (_t169) goto L_020D3A74; else goto L_020D3A68;
   L_020D3A68: ; // 0x20d3a68
@@ -16270,8 +16270,8 @@ void Gambit_fn_020D3530(CPUState* cpu) {
   L_020D3A74: ; // 0x20d3a74
         /* 020D3A74 */ _t172 = cpu->r[29] + 0x00000218u;
         /* 020D3A74 */ cpu->r[10] = rbrew_read32(cpu->mem, _t172);
-        /* 020D3A78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020D3A7C */ _t173 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D3A78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020D3A7C */ _t173 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D3A7C */ _t174 = _t173 & 0x00000001u;
         /* 020D3A7C */ if (_t174) goto L_020D3A80; else goto L_020D3A9C;
   L_020D3A80: ; // 0x20d3a80
@@ -16311,18 +16311,18 @@ void Gambit_fn_020D3534(CPUState* cpu) {
         /* 020D3538 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020D353C */ /* nop */
         /* 020D3540 */ cpu->r[29] = cpu->r[3];
-        /* 020D3540 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020D3540 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020D3544 */ cpu->r[30] = cpu->r[4];
         /* 020D3548 */ cpu->r[31] = cpu->r[5];
-        /* 020D354C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D354C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D354C */ _t3 = _t2 & 0x00000001u;
         /* 020D354C */ if (_t3) goto L_020D3550; else goto L_020D3560;
   L_020D3550: ; // 0x20d3550
         /* 020D3550 */ cpu->r[3] = 0x00000224u;
         /* 020D3554 */ Gambit_fn_02801A78(cpu);
         /* 020D3558 */ cpu->r[29] = cpu->r[3];
-        /* 020D3558 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020D355C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3558 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020D355C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D355C */ _t5 = _t4 & 0x00000001u;
         /* 020D355C */ if (_t5) goto L_020D3A9C; else goto L_020D3560;
   L_020D3560: ; // 0x20d3560
@@ -16349,22 +16349,22 @@ void Gambit_fn_020D3534(CPUState* cpu) {
         /* 020D35A0 */ rbrew_write32(cpu->mem, _t9, cpu->r[5]);
         /* 020D35A4 */ cpu->r[7] = cpu->r[7] + 0xFFFF85C0u;
         /* 020D35A8 */ cpu->r[27] = cpu->r[29] + 0x000001DCu;
-        /* 020D35A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020D35A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020D35AC */ _t10 = cpu->r[29] + 0x0000001Cu;
         /* 020D35AC */ rbrew_write32(cpu->mem, _t10, cpu->r[6]);
         /* 020D35B0 */ cpu->r[28] = 0x00000000u;
         /* 020D35B4 */ cpu->r[30] = cpu->r[27];
         /* 020D35B8 */ _t11 = cpu->r[29] + 0x000001C8u;
         /* 020D35B8 */ rbrew_write32(cpu->mem, _t11, cpu->r[7]);
-        /* 020D35BC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D35BC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D35BC */ _t13 = _t12 & 0x00000001u;
         /* 020D35BC */ if (_t13) goto L_020D35C0; else goto L_020D35D0;
   L_020D35C0: ; // 0x20d35c0
         /* 020D35C0 */ cpu->r[3] = 0x00000038u;
         /* 020D35C4 */ Gambit_fn_02801A78(cpu);
         /* 020D35C8 */ cpu->r[30] = cpu->r[3];
-        /* 020D35C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 020D35CC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D35C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 020D35CC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D35CC */ _t15 = _t14 & 0x00000001u;
         /* 020D35CC */ if (_t15) goto L_020D3600; else goto L_020D35D0;
   L_020D35D0: ; // 0x20d35d0
@@ -16390,17 +16390,17 @@ void Gambit_fn_020D3534(CPUState* cpu) {
         /* 020D35FC */ rbrew_write32(cpu->mem, _t23, cpu->r[28]);
   L_020D3600: ; // 0x20d3600
         /* 020D3600 */ cpu->r[3] = cpu->r[29] + 0x00000218u;
-        /* 020D3600 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 020D3600 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 020D3604 */ _t24 = cpu->r[29] + 0x00000214u;
         /* 020D3604 */ rbrew_write32(cpu->mem, _t24, cpu->r[31]);
-        /* 020D3608 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3608 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3608 */ _t26 = _t25 & 0x00000001u;
         /* 020D3608 */ if (_t26) goto L_020D360C; else goto L_020D361C;
   L_020D360C: ; // 0x20d360c
         /* 020D360C */ cpu->r[3] = 0x00000008u;
         /* 020D3610 */ Gambit_fn_02801A78(cpu);
-        /* 020D3614 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D3618 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3614 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D3618 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3618 */ _t28 = _t27 & 0x00000001u;
         /* 020D3618 */ if (_t28) goto L_020D3624; else goto L_020D361C;
   L_020D361C: ; // 0x20d361c
@@ -16444,23 +16444,23 @@ void Gambit_fn_020D3534(CPUState* cpu) {
         /* 020D3680 */ _t40 = cpu->r[5] + 0x00000000u;
         /* 020D3680 */ cpu->r[10] = rbrew_read8(cpu->mem, _t40);
         /* 020D3684 */ cpu->r[31] = 0x00000000u;
-        /* 020D3688 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[30]);
+        /* 020D3688 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[30]));
         /* 020D368C */ cpu->r[7] = 0x00080000u;
-        /* 020D3690 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3690 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3690 */ _t42 = _t41 & 0x00000001u;
         /* 020D3690 */ if (_t42) goto L_020D36B8; else goto L_020D3694;
   L_020D3694: ; // 0x20d3694
         /* 020D3694 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020D3698 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 020D3698 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 020D369C */ cpu->r[5] = cpu->r[5] + 0x00000001u;
-        /* 020D36A0 */ _t43 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D36A0 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D36A0 */ _t44 = _t43 & 0x00000001u;
         /* 020D36A0 */ if (_t44) goto L_020D36B4; else goto L_020D36A4;
   L_020D36A4: ; // 0x20d36a4
         /* 020D36A4 */ _t45 = cpu->r[5] + 0x00000000u;
         /* 020D36A4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t45);
-        /* 020D36A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
-        /* 020D36AC */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D36A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
+        /* 020D36AC */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D36AC */ _t47 = _t46 & 0x00000001u;
         /* 020D36AC */ if (_t47) goto L_020D36B0; else goto L_020D3694;
   L_020D36B0: ; // 0x20d36b0
@@ -16472,10 +16472,10 @@ void Gambit_fn_020D3534(CPUState* cpu) {
         /* 020D36B8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t48);
         /* 020D36BC */ _t49 = cpu->r[1] + 0x00000010u;
         /* 020D36BC */ cpu->r[12] = rbrew_read32(cpu->mem, _t49);
-        /* 020D36C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 020D36C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 020D36C4 */ _t50 = cpu->r[12] + 0x00000014u;
         /* 020D36C4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t50);
-        /* 020D36C8 */ _t51 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D36C8 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D36C8 */ _t52 = _t51 & 0x00000001u;
         /* 020D36C8 */ if (_t52) goto L_020D36D0; else goto L_020D36CC;
   L_020D36CC: ; // 0x20d36cc
@@ -16530,10 +16530,10 @@ void Gambit_fn_020D3534(CPUState* cpu) {
         /* 020D3750 */ rbrew_write32(cpu->mem, _t66, cpu->r[7]);
         /* 020D3754 */ _t67 = cpu->r[27] + 0x00000014u;
         /* 020D3754 */ cpu->r[8] = rbrew_read32(cpu->mem, _t67);
-        /* 020D3758 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000001u);
+        /* 020D3758 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000001u));
         /* 020D375C */ _t68 = cpu->r[27] + 0x00000018u;
         /* 020D375C */ cpu->r[26] = rbrew_read32(cpu->mem, _t68);
-        /* 020D3760 */ _t69 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D3760 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D3760 */ _t70 = _t69 & 0x00000001u;
         /* 020D3760 */ if (_t70) goto L_020D3764; else goto L_020D3768;
   L_020D3764: ; // 0x20d3764
@@ -16549,23 +16549,23 @@ void Gambit_fn_020D3534(CPUState* cpu) {
         /* 020D377C */ _t73 = cpu->r[10] + 0x00000000u;
         /* 020D377C */ cpu->r[9] = rbrew_read8(cpu->mem, _t73);
         /* 020D3780 */ cpu->r[31] = 0x00000000u;
-        /* 020D3784 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[30]);
+        /* 020D3784 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[30]));
         /* 020D3788 */ cpu->r[12] = 0x00080000u;
-        /* 020D378C */ _t74 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D378C */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D378C */ _t75 = _t74 & 0x00000001u;
         /* 020D378C */ if (_t75) goto L_020D37B4; else goto L_020D3790;
   L_020D3790: ; // 0x20d3790
         /* 020D3790 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020D3794 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 020D3794 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 020D3798 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 020D379C */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D379C */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D379C */ _t77 = _t76 & 0x00000001u;
         /* 020D379C */ if (_t77) goto L_020D37B0; else goto L_020D37A0;
   L_020D37A0: ; // 0x20d37a0
         /* 020D37A0 */ _t78 = cpu->r[10] + 0x00000000u;
         /* 020D37A0 */ cpu->r[11] = rbrew_read8(cpu->mem, _t78);
-        /* 020D37A4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[30]);
-        /* 020D37A8 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D37A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[30]));
+        /* 020D37A8 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D37A8 */ _t80 = _t79 & 0x00000001u;
         /* 020D37A8 */ if (_t80) goto L_020D37AC; else goto L_020D3790;
   L_020D37AC: ; // 0x20d37ac
@@ -16577,10 +16577,10 @@ void Gambit_fn_020D3534(CPUState* cpu) {
         /* 020D37B4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t81);
         /* 020D37B8 */ _t82 = cpu->r[1] + 0x00000010u;
         /* 020D37B8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t82);
-        /* 020D37BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 020D37BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 020D37C0 */ _t83 = cpu->r[5] + 0x00000014u;
         /* 020D37C0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t83);
-        /* 020D37C4 */ _t84 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D37C4 */ _t84 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D37C4 */ _t85 = _t84 & 0x00000001u;
         /* 020D37C4 */ if (_t85) goto L_020D37CC; else goto L_020D37C8;
   L_020D37C8: ; // 0x20d37c8
@@ -16635,10 +16635,10 @@ void Gambit_fn_020D3534(CPUState* cpu) {
         /* 020D384C */ rbrew_write32(cpu->mem, _t99, cpu->r[0]);
         /* 020D3850 */ _t100 = cpu->r[27] + 0x00000014u;
         /* 020D3850 */ cpu->r[5] = rbrew_read32(cpu->mem, _t100);
-        /* 020D3854 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x00000002u);
+        /* 020D3854 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x00000002u));
         /* 020D3858 */ _t101 = cpu->r[27] + 0x00000018u;
         /* 020D3858 */ cpu->r[26] = rbrew_read32(cpu->mem, _t101);
-        /* 020D385C */ _t102 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D385C */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D385C */ _t103 = _t102 & 0x00000001u;
         /* 020D385C */ if (_t103) goto L_020D3860; else goto L_020D3864;
   L_020D3860: ; // 0x20d3860
@@ -16654,23 +16654,23 @@ void Gambit_fn_020D3534(CPUState* cpu) {
         /* 020D3878 */ _t106 = cpu->r[6] + 0x00000000u;
         /* 020D3878 */ cpu->r[8] = rbrew_read8(cpu->mem, _t106);
         /* 020D387C */ cpu->r[31] = 0x00000000u;
-        /* 020D3880 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[30]);
+        /* 020D3880 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[30]));
         /* 020D3884 */ cpu->r[7] = 0x00080000u;
-        /* 020D3888 */ _t107 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3888 */ _t107 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3888 */ _t108 = _t107 & 0x00000001u;
         /* 020D3888 */ if (_t108) goto L_020D38B0; else goto L_020D388C;
   L_020D388C: ; // 0x20d388c
         /* 020D388C */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020D3890 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 020D3890 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 020D3894 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 020D3898 */ _t109 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D3898 */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D3898 */ _t110 = _t109 & 0x00000001u;
         /* 020D3898 */ if (_t110) goto L_020D38AC; else goto L_020D389C;
   L_020D389C: ; // 0x20d389c
         /* 020D389C */ _t111 = cpu->r[6] + 0x00000000u;
         /* 020D389C */ cpu->r[0] = rbrew_read8(cpu->mem, _t111);
-        /* 020D38A0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
-        /* 020D38A4 */ _t112 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D38A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
+        /* 020D38A4 */ _t112 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D38A4 */ _t113 = _t112 & 0x00000001u;
         /* 020D38A4 */ if (_t113) goto L_020D38A8; else goto L_020D388C;
   L_020D38A8: ; // 0x20d38a8
@@ -16682,10 +16682,10 @@ void Gambit_fn_020D3534(CPUState* cpu) {
         /* 020D38B0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t114);
         /* 020D38B4 */ _t115 = cpu->r[1] + 0x00000010u;
         /* 020D38B4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t115);
-        /* 020D38B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[5]);
+        /* 020D38B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[5]));
         /* 020D38BC */ _t116 = cpu->r[11] + 0x00000014u;
         /* 020D38BC */ cpu->r[0] = rbrew_read32(cpu->mem, _t116);
-        /* 020D38C0 */ _t117 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D38C0 */ _t117 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D38C0 */ _t118 = _t117 & 0x00000001u;
         /* 020D38C0 */ if (_t118) goto L_020D38C8; else goto L_020D38C4;
   L_020D38C4: ; // 0x20d38c4
@@ -16740,10 +16740,10 @@ void Gambit_fn_020D3534(CPUState* cpu) {
         /* 020D3948 */ rbrew_write32(cpu->mem, _t132, cpu->r[8]);
         /* 020D394C */ _t133 = cpu->r[27] + 0x00000014u;
         /* 020D394C */ cpu->r[9] = rbrew_read32(cpu->mem, _t133);
-        /* 020D3950 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000003u);
+        /* 020D3950 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000003u));
         /* 020D3954 */ _t134 = cpu->r[27] + 0x00000018u;
         /* 020D3954 */ cpu->r[26] = rbrew_read32(cpu->mem, _t134);
-        /* 020D3958 */ _t135 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D3958 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D3958 */ _t136 = _t135 & 0x00000001u;
         /* 020D3958 */ if (_t136) goto L_020D395C; else goto L_020D3960;
   L_020D395C: ; // 0x20d395c
@@ -16759,23 +16759,23 @@ void Gambit_fn_020D3534(CPUState* cpu) {
         /* 020D3974 */ _t139 = cpu->r[10] + 0x00000000u;
         /* 020D3974 */ cpu->r[11] = rbrew_read8(cpu->mem, _t139);
         /* 020D3978 */ cpu->r[31] = 0x00000000u;
-        /* 020D397C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[30]);
+        /* 020D397C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[30]));
         /* 020D3980 */ cpu->r[12] = 0x00080000u;
-        /* 020D3984 */ _t140 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3984 */ _t140 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3984 */ _t141 = _t140 & 0x00000001u;
         /* 020D3984 */ if (_t141) goto L_020D39AC; else goto L_020D3988;
   L_020D3988: ; // 0x20d3988
         /* 020D3988 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 020D398C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 020D398C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 020D3990 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 020D3994 */ _t142 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D3994 */ _t142 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D3994 */ _t143 = _t142 & 0x00000001u;
         /* 020D3994 */ if (_t143) goto L_020D39A8; else goto L_020D3998;
   L_020D3998: ; // 0x20d3998
         /* 020D3998 */ _t144 = cpu->r[10] + 0x00000000u;
         /* 020D3998 */ cpu->r[0] = rbrew_read8(cpu->mem, _t144);
-        /* 020D399C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
-        /* 020D39A0 */ _t145 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D399C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
+        /* 020D39A0 */ _t145 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D39A0 */ _t146 = _t145 & 0x00000001u;
         /* 020D39A0 */ if (_t146) goto L_020D39A4; else goto L_020D3988;
   L_020D39A4: ; // 0x20d39a4
@@ -16787,10 +16787,10 @@ void Gambit_fn_020D3534(CPUState* cpu) {
         /* 020D39AC */ cpu->r[7] = rbrew_read32(cpu->mem, _t147);
         /* 020D39B0 */ _t148 = cpu->r[1] + 0x00000010u;
         /* 020D39B0 */ cpu->r[6] = rbrew_read32(cpu->mem, _t148);
-        /* 020D39B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 020D39B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 020D39B8 */ _t149 = cpu->r[6] + 0x00000014u;
         /* 020D39B8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t149);
-        /* 020D39BC */ _t150 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D39BC */ _t150 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D39BC */ _t151 = _t150 & 0x00000001u;
         /* 020D39BC */ if (_t151) goto L_020D39C4; else goto L_020D39C0;
   L_020D39C0: ; // 0x20d39c0
@@ -16851,8 +16851,8 @@ void Gambit_fn_020D3534(CPUState* cpu) {
         /* 020D3A54 */ cpu->r[4] = 0x00000008u;
         /* 020D3A58 */ cpu->r[5] = 0x00000004u;
         /* 020D3A5C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020D3A60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D3A64 */ _t168 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3A60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D3A64 */ _t168 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3A64 */ _t169 = _t168 & 0x00000001u;
         /* 020D3A64 */ if (_t169) goto L_020D3A74; else goto L_020D3A68;
   L_020D3A68: ; // 0x20d3a68
@@ -16864,8 +16864,8 @@ void Gambit_fn_020D3534(CPUState* cpu) {
   L_020D3A74: ; // 0x20d3a74
         /* 020D3A74 */ _t172 = cpu->r[29] + 0x00000218u;
         /* 020D3A74 */ cpu->r[10] = rbrew_read32(cpu->mem, _t172);
-        /* 020D3A78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020D3A7C */ _t173 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D3A78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020D3A7C */ _t173 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D3A7C */ _t174 = _t173 & 0x00000001u;
         /* 020D3A7C */ if (_t174) goto L_020D3A80; else goto L_020D3A9C;
   L_020D3A80: ; // 0x20d3a80
@@ -17026,8 +17026,8 @@ void Gambit_fn_020D3B38(CPUState* cpu) {
         /* 020D3B6C */ _t6 = cpu->r[1] + 0x00000008u;
         /* 020D3B6C */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 020D3B70 */ Gambit_fn_027ED700(cpu);
-        /* 020D3B74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D3B78 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3B74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D3B78 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3B78 */ _t8 = _t7 & 0x00000001u;
         /* 020D3B78 */ if (_t8) goto L_020D3B7C; else goto L_020D3B9C;
   L_020D3B7C: ; // 0x20d3b7c
@@ -17091,8 +17091,8 @@ void Gambit_fn_020D3B3C(CPUState* cpu) {
         /* 020D3B6C */ _t6 = cpu->r[1] + 0x00000008u;
         /* 020D3B6C */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 020D3B70 */ Gambit_fn_027ED700(cpu);
-        /* 020D3B74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D3B78 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3B74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D3B78 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3B78 */ _t8 = _t7 & 0x00000001u;
         /* 020D3B78 */ if (_t8) goto L_020D3B7C; else goto L_020D3B9C;
   L_020D3B7C: ; // 0x20d3b7c
@@ -17176,10 +17176,10 @@ void Gambit_fn_020D3BD4(CPUState* cpu) {
         /* 020D3C3C */ cpu->f[0] = (double)(float)cpu->f[12];
         /* 020D3C40 */ _t12 = cpu->r[12] + 0xFFFF8410u;
         /* 020D3C40 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t12);
-        /* 020D3C44 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
+        /* 020D3C44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
         /* 020D3C48 */ _t13 = cpu->r[31] + 0x00000214u;
         /* 020D3C48 */ cpu->r[11] = rbrew_read32(cpu->mem, _t13);
-        /* 020D3C4C */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D3C4C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D3C4C */ _t15 = _t14 & 0x00000001u;
         /* 020D3C4C */ if (_t15) goto L_020D3C50; else goto L_020D3C84;
   L_020D3C50: ; // 0x20d3c50
@@ -17194,18 +17194,18 @@ void Gambit_fn_020D3BD4(CPUState* cpu) {
         /* 020D3C68 */ Gambit_fn_027ED914(cpu);
         /* 020D3C6C */ /* nop */
         /* 020D3C70 */ cpu->r[5] = rbrew_rlwinm(cpu->r[28], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D3C70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 020D3C70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 020D3C74 */ _t18 = cpu->r[31] + 0x00000218u;
         /* 020D3C74 */ cpu->r[0] = rbrew_read32(cpu->mem, _t18);
         /* 020D3C78 */ cpu->r[4] = cpu->r[9];
-        /* 020D3C7C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3C7C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3C7C */ _t20 = _t19 & 0x00000001u;
         /* 020D3C7C */ if (_t20) goto L_020D3CC4; else goto L_020D3C80;
   L_020D3C80: ; // 0x20d3c80
         /* 020D3C80 */ goto L_020D3CC0;
   L_020D3C84: ; // 0x20d3c84
-        /* 020D3C84 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[1]);
-        /* 020D3C88 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D3C84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[1]));
+        /* 020D3C88 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D3C88 */ _t22 = _t21 & 0x00000001u;
         /* 020D3C88 */ if (_t22) goto L_020D3C8C; else goto L_020D3C90;
   L_020D3C8C: ; // 0x20d3c8c
@@ -17222,20 +17222,20 @@ void Gambit_fn_020D3BD4(CPUState* cpu) {
         /* 020D3CA8 */ Gambit_fn_027ED914(cpu);
         /* 020D3CAC */ /* nop */
         /* 020D3CB0 */ cpu->r[5] = rbrew_rlwinm(cpu->r[28], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D3CB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 020D3CB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 020D3CB4 */ _t25 = cpu->r[31] + 0x00000218u;
         /* 020D3CB4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t25);
         /* 020D3CB8 */ cpu->r[4] = cpu->r[9];
-        /* 020D3CBC */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3CBC */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3CBC */ _t27 = _t26 & 0x00000001u;
         /* 020D3CBC */ if (_t27) goto L_020D3CC4; else goto L_020D3CC0;
   L_020D3CC0: ; // 0x20d3cc0
         /* 020D3CC0 */ cpu->r[5] = 0x00000005u;
   L_020D3CC4: ; // 0x20d3cc4
-        /* 020D3CC4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 020D3CC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 020D3CC8 */ _t28 = cpu->r[31] + 0x0000021Cu;
         /* 020D3CC8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t28);
-        /* 020D3CCC */ _t29 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D3CCC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D3CCC */ _t30 = _t29 & 0x00000001u;
         /* 020D3CCC */ if (_t30) goto L_020D3CD0; else goto L_020D3CD4;
   L_020D3CD0: ; // 0x20d3cd0
@@ -17311,10 +17311,10 @@ void Gambit_fn_020D3BD8(CPUState* cpu) {
         /* 020D3C3C */ cpu->f[0] = (double)(float)cpu->f[12];
         /* 020D3C40 */ _t12 = cpu->r[12] + 0xFFFF8410u;
         /* 020D3C40 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t12);
-        /* 020D3C44 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
+        /* 020D3C44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
         /* 020D3C48 */ _t13 = cpu->r[31] + 0x00000214u;
         /* 020D3C48 */ cpu->r[11] = rbrew_read32(cpu->mem, _t13);
-        /* 020D3C4C */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D3C4C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D3C4C */ _t15 = _t14 & 0x00000001u;
         /* 020D3C4C */ if (_t15) goto L_020D3C50; else goto L_020D3C84;
   L_020D3C50: ; // 0x20d3c50
@@ -17329,18 +17329,18 @@ void Gambit_fn_020D3BD8(CPUState* cpu) {
         /* 020D3C68 */ Gambit_fn_027ED914(cpu);
         /* 020D3C6C */ /* nop */
         /* 020D3C70 */ cpu->r[5] = rbrew_rlwinm(cpu->r[28], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D3C70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 020D3C70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 020D3C74 */ _t18 = cpu->r[31] + 0x00000218u;
         /* 020D3C74 */ cpu->r[0] = rbrew_read32(cpu->mem, _t18);
         /* 020D3C78 */ cpu->r[4] = cpu->r[9];
-        /* 020D3C7C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3C7C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3C7C */ _t20 = _t19 & 0x00000001u;
         /* 020D3C7C */ if (_t20) goto L_020D3CC4; else goto L_020D3C80;
   L_020D3C80: ; // 0x20d3c80
         /* 020D3C80 */ goto L_020D3CC0;
   L_020D3C84: ; // 0x20d3c84
-        /* 020D3C84 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[1]);
-        /* 020D3C88 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D3C84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[1]));
+        /* 020D3C88 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D3C88 */ _t22 = _t21 & 0x00000001u;
         /* 020D3C88 */ if (_t22) goto L_020D3C8C; else goto L_020D3C90;
   L_020D3C8C: ; // 0x20d3c8c
@@ -17357,20 +17357,20 @@ void Gambit_fn_020D3BD8(CPUState* cpu) {
         /* 020D3CA8 */ Gambit_fn_027ED914(cpu);
         /* 020D3CAC */ /* nop */
         /* 020D3CB0 */ cpu->r[5] = rbrew_rlwinm(cpu->r[28], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D3CB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 020D3CB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 020D3CB4 */ _t25 = cpu->r[31] + 0x00000218u;
         /* 020D3CB4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t25);
         /* 020D3CB8 */ cpu->r[4] = cpu->r[9];
-        /* 020D3CBC */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3CBC */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3CBC */ _t27 = _t26 & 0x00000001u;
         /* 020D3CBC */ if (_t27) goto L_020D3CC4; else goto L_020D3CC0;
   L_020D3CC0: ; // 0x20d3cc0
         /* 020D3CC0 */ cpu->r[5] = 0x00000005u;
   L_020D3CC4: ; // 0x20d3cc4
-        /* 020D3CC4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 020D3CC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 020D3CC8 */ _t28 = cpu->r[31] + 0x0000021Cu;
         /* 020D3CC8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t28);
-        /* 020D3CCC */ _t29 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D3CCC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D3CCC */ _t30 = _t29 & 0x00000001u;
         /* 020D3CCC */ if (_t30) goto L_020D3CD0; else goto L_020D3CD4;
   L_020D3CD0: ; // 0x20d3cd0
@@ -17418,16 +17418,16 @@ void Gambit_fn_020D3D0C(CPUState* cpu) {
         /* 020D3D20 */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
         /* 020D3D24 */ _t4 = cpu->r[12] + 0x00000019u;
         /* 020D3D24 */ cpu->r[0] = rbrew_read8(cpu->mem, _t4);
-        /* 020D3D28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020D3D28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020D3D2C */ cpu->r[31] = cpu->r[3];
-        /* 020D3D30 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3D30 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3D30 */ _t6 = _t5 & 0x00000001u;
         /* 020D3D30 */ if (_t6) goto L_020D3D7C; else goto L_020D3D34;
   L_020D3D34: ; // 0x20d3d34
         /* 020D3D34 */ _t7 = cpu->r[12] + 0x00000018u;
         /* 020D3D34 */ cpu->r[10] = rbrew_read8(cpu->mem, _t7);
-        /* 020D3D38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020D3D3C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3D38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020D3D3C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3D3C */ _t9 = _t8 & 0x00000001u;
         /* 020D3D3C */ if (_t9) goto L_020D3D7C; else goto L_020D3D40;
   L_020D3D40: ; // 0x20d3d40
@@ -17478,16 +17478,16 @@ void Gambit_fn_020D3D10(CPUState* cpu) {
         /* 020D3D20 */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
         /* 020D3D24 */ _t4 = cpu->r[12] + 0x00000019u;
         /* 020D3D24 */ cpu->r[0] = rbrew_read8(cpu->mem, _t4);
-        /* 020D3D28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020D3D28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020D3D2C */ cpu->r[31] = cpu->r[3];
-        /* 020D3D30 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3D30 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3D30 */ _t6 = _t5 & 0x00000001u;
         /* 020D3D30 */ if (_t6) goto L_020D3D7C; else goto L_020D3D34;
   L_020D3D34: ; // 0x20d3d34
         /* 020D3D34 */ _t7 = cpu->r[12] + 0x00000018u;
         /* 020D3D34 */ cpu->r[10] = rbrew_read8(cpu->mem, _t7);
-        /* 020D3D38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020D3D3C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3D38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020D3D3C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3D3C */ _t9 = _t8 & 0x00000001u;
         /* 020D3D3C */ if (_t9) goto L_020D3D7C; else goto L_020D3D40;
   L_020D3D40: ; // 0x20d3d40
@@ -17712,10 +17712,10 @@ void Gambit_fn_020D3E48(CPUState* cpu) {
         /* 020D3ED8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 020D3EDC */ _t15 = cpu->r[3] + 0x000000A8u;
         /* 020D3EDC */ cpu->r[0] = rbrew_read32(cpu->mem, _t15);
-        /* 020D3EE0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], 0x00000001u);
+        /* 020D3EE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], 0x00000001u));
         /* 020D3EE4 */ _t16 = cpu->r[30] + 0x0000021Cu;
         /* 020D3EE4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t16);
-        /* 020D3EE8 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D3EE8 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D3EE8 */ _t18 = _t17 & 0x00000001u;
         /* 020D3EE8 */ if (_t18) goto L_020D3EEC; else goto L_020D3EF0;
   L_020D3EEC: ; // 0x20d3eec
@@ -17756,8 +17756,8 @@ void Gambit_fn_020D3F2C(CPUState* cpu) {
         /* 020D3F38 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020D3F3C */ _t3 = cpu->r[31] + 0x000001E4u;
         /* 020D3F3C */ cpu->r[10] = rbrew_read32(cpu->mem, _t3);
-        /* 020D3F40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020D3F44 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3F40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020D3F44 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3F44 */ _t5 = _t4 & 0x00000001u;
         /* 020D3F44 */ if (_t5) goto L_020D3F48; else goto L_020D3F78;
   L_020D3F48: ; // 0x20d3f48
@@ -17782,8 +17782,8 @@ void Gambit_fn_020D3F2C(CPUState* cpu) {
         /* 020D3F78 */ cpu->r[4] = rbrew_read32(cpu->mem, _t10);
         /* 020D3F7C */ cpu->r[3] = cpu->r[31];
         /* 020D3F80 */ Gambit_fn_027EDF00(cpu);
-        /* 020D3F84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D3F88 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3F84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D3F88 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3F88 */ _t12 = _t11 & 0x00000001u;
         /* 020D3F88 */ if (_t12) goto L_020D3FA0; else goto L_020D3F8C;
   L_020D3F8C: ; // 0x20d3f8c
@@ -17818,15 +17818,15 @@ void Gambit_fn_020D3FB8(CPUState* cpu) {
         /* 020D3FC4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020D3FC8 */ _t3 = cpu->r[31] + 0x00000220u;
         /* 020D3FC8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 020D3FCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D3FD0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3FCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D3FD0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3FD0 */ _t5 = _t4 & 0x00000001u;
         /* 020D3FD0 */ if (_t5) goto L_020D3FD4; else goto L_020D3FE0;
   L_020D3FD4: ; // 0x20d3fd4
         /* 020D3FD4 */ _t6 = cpu->r[31] + 0x00000221u;
         /* 020D3FD4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t6);
-        /* 020D3FD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D3FDC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D3FD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D3FDC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D3FDC */ _t8 = _t7 & 0x00000001u;
         /* 020D3FDC */ if (_t8) goto L_020D3FFC; else goto L_020D3FE0;
   L_020D3FE0: ; // 0x20d3fe0
@@ -17866,8 +17866,8 @@ void Gambit_fn_020D4014(CPUState* cpu) {
         /* 020D4024 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 020D4028 */ _t4 = cpu->r[31] + 0x000001E4u;
         /* 020D4028 */ cpu->r[10] = rbrew_read32(cpu->mem, _t4);
-        /* 020D402C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020D4030 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D402C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020D4030 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4030 */ _t6 = _t5 & 0x00000001u;
         /* 020D4030 */ if (_t6) goto L_020D4034; else goto L_020D4094;
   L_020D4034: ; // 0x20d4034
@@ -17887,8 +17887,8 @@ void Gambit_fn_020D4014(CPUState* cpu) {
         /* 020D405C */ _t10 = cpu->r[1] + 0x00000008u;
         /* 020D405C */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
         /* 020D4060 */ Gambit_fn_027ED2B0(cpu);
-        /* 020D4064 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D4068 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4064 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D4068 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4068 */ _t12 = _t11 & 0x00000001u;
         /* 020D4068 */ if (_t12) goto L_020D406C; else goto L_020D4094;
   L_020D406C: ; // 0x20d406c
@@ -17911,15 +17911,15 @@ void Gambit_fn_020D4014(CPUState* cpu) {
         /* 020D4094 */ cpu->r[4] = rbrew_read32(cpu->mem, _t17);
         /* 020D4098 */ cpu->r[3] = cpu->r[31];
         /* 020D409C */ Gambit_fn_027EDF00(cpu);
-        /* 020D40A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D40A4 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D40A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D40A4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D40A4 */ _t19 = _t18 & 0x00000001u;
         /* 020D40A4 */ if (_t19) goto L_020D4100; else goto L_020D40A8;
   L_020D40A8: ; // 0x20d40a8
         /* 020D40A8 */ _t20 = cpu->r[31] + 0x00000221u;
         /* 020D40A8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t20);
-        /* 020D40AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D40B0 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D40AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D40B0 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D40B0 */ _t22 = _t21 & 0x00000001u;
         /* 020D40B0 */ if (_t22) goto L_020D40EC; else goto L_020D40B4;
   L_020D40B4: ; // 0x20d40b4
@@ -18075,15 +18075,15 @@ void Gambit_fn_020D4184(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D4184: ; // 0x20d4184
-        /* 020D4184 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D4188 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4184 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D4188 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4188 */ _t1 = _t0 & 0x00000001u;
         /* 020D4188 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D4188 */ goto L_020D418C;
   L_020D418C: ; // 0x20d418c
         /* 020D418C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D418C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D4190 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D418C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D4190 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4190 */ _t3 = _t2 & 0x00000001u;
         /* 020D4190 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D4190 */ goto L_020D4194;
@@ -18102,8 +18102,8 @@ void Gambit_fn_020D4184(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -18117,15 +18117,15 @@ void Gambit_fn_020D4184(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -18162,11 +18162,11 @@ void Gambit_fn_020D4198(CPUState* cpu) {
         /* 020D41A4 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D41A4 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D41A8 */ cpu->r[30] = cpu->r[3];
-        /* 020D41A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D41A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D41AC */ cpu->r[31] = cpu->r[4];
         /* 020D41B0 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D41B0 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D41B4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D41B4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D41B4 */ _t5 = _t4 & 0x00000001u;
         /* 020D41B4 */ if (_t5) goto L_020D41F8; else goto L_020D41B8;
   L_020D41B8: ; // 0x20d41b8
@@ -18186,8 +18186,8 @@ void Gambit_fn_020D4198(CPUState* cpu) {
         /* 020D41E0 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D41E4 */ Gambit_fn_02068798(cpu);
         /* 020D41E8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D41E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D41EC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D41E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D41EC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D41EC */ _t10 = _t9 & 0x00000001u;
         /* 020D41EC */ if (_t10) goto L_020D41F8; else goto L_020D41F0;
   L_020D41F0: ; // 0x20d41f0
@@ -18218,11 +18218,11 @@ void Gambit_fn_020D419C(CPUState* cpu) {
         /* 020D41A4 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D41A4 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D41A8 */ cpu->r[30] = cpu->r[3];
-        /* 020D41A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D41A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D41AC */ cpu->r[31] = cpu->r[4];
         /* 020D41B0 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D41B0 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D41B4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D41B4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D41B4 */ _t5 = _t4 & 0x00000001u;
         /* 020D41B4 */ if (_t5) goto L_020D41F8; else goto L_020D41B8;
   L_020D41B8: ; // 0x20d41b8
@@ -18242,8 +18242,8 @@ void Gambit_fn_020D419C(CPUState* cpu) {
         /* 020D41E0 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D41E4 */ Gambit_fn_02068798(cpu);
         /* 020D41E8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D41E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D41EC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D41E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D41EC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D41EC */ _t10 = _t9 & 0x00000001u;
         /* 020D41EC */ if (_t10) goto L_020D41F8; else goto L_020D41F0;
   L_020D41F0: ; // 0x20d41f0
@@ -18298,15 +18298,15 @@ void Gambit_fn_020D4228(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D4228: ; // 0x20d4228
-        /* 020D4228 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D422C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D422C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D422C */ _t1 = _t0 & 0x00000001u;
         /* 020D422C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D422C */ goto L_020D4230;
   L_020D4230: ; // 0x20d4230
         /* 020D4230 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D4230 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D4234 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4230 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D4234 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4234 */ _t3 = _t2 & 0x00000001u;
         /* 020D4234 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D4234 */ goto L_020D4238;
@@ -18325,8 +18325,8 @@ void Gambit_fn_020D4228(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -18340,15 +18340,15 @@ void Gambit_fn_020D4228(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -18394,15 +18394,15 @@ void Gambit_fn_020D4258(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D4258: ; // 0x20d4258
-        /* 020D4258 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D425C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4258 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D425C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D425C */ _t1 = _t0 & 0x00000001u;
         /* 020D425C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D425C */ goto L_020D4260;
   L_020D4260: ; // 0x20d4260
         /* 020D4260 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D4260 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D4264 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4260 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D4264 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4264 */ _t3 = _t2 & 0x00000001u;
         /* 020D4264 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D4264 */ goto L_020D4268;
@@ -18421,8 +18421,8 @@ void Gambit_fn_020D4258(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -18436,15 +18436,15 @@ void Gambit_fn_020D4258(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -18472,15 +18472,15 @@ void Gambit_fn_020D426C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D426C: ; // 0x20d426c
-        /* 020D426C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D4270 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D426C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D4270 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4270 */ _t1 = _t0 & 0x00000001u;
         /* 020D4270 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D4270 */ goto L_020D4274;
   L_020D4274: ; // 0x20d4274
         /* 020D4274 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D4274 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D4278 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4274 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D4278 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4278 */ _t3 = _t2 & 0x00000001u;
         /* 020D4278 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D4278 */ goto L_020D427C;
@@ -18499,8 +18499,8 @@ void Gambit_fn_020D426C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -18514,15 +18514,15 @@ void Gambit_fn_020D426C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -18628,9 +18628,9 @@ void Gambit_fn_020D42C0(CPUState* cpu) {
         /* 020D42C4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 020D42C4 */ cpu->r[9] = _t0;
         /* 020D42C8 */ cpu->r[12] = 0x101D0000u;
-        /* 020D42CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 020D42CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 020D42D0 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 020D42D4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D42D4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D42D4 */ _t2 = _t1 & 0x00000001u;
         /* 020D42D4 */ if (_t2) goto L_020D42D8; else goto L_020D42EC;
   L_020D42D8: ; // 0x20d42d8
@@ -18642,8 +18642,8 @@ void Gambit_fn_020D42C0(CPUState* cpu) {
         /* 020D42E8 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 020D42E8 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_020D42EC: ; // 0x20d42ec
-        /* 020D42EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 020D42F0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D42EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 020D42F0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D42F0 */ _t6 = _t5 & 0x00000001u;
         /* 020D42F0 */ if (_t6) goto L_020D42F4; else goto L_020D42FC;
   L_020D42F4: ; // 0x20d42f4
@@ -18655,9 +18655,9 @@ void Gambit_fn_020D42C0(CPUState* cpu) {
         /* 020D4300 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 020D4300 */ cpu->r[7] = _t7;
         /* 020D4304 */ cpu->r[11] = 0x101D0000u;
-        /* 020D4308 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020D4308 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020D430C */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 020D4310 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4310 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4310 */ _t9 = _t8 & 0x00000001u;
         /* 020D4310 */ if (_t9) goto L_020D4314; else goto L_020D4328;
   L_020D4314: ; // 0x20d4314
@@ -18742,18 +18742,18 @@ void Gambit_fn_020D4360(CPUState* cpu) {
         /* 0206B040 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0206B040 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0206B044 */ cpu->r[12] = 0x00000000u;
-        /* 0206B048 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0206B048 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0206B04C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0206B04C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0206B050 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206B050 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206B050 */ _t6 = _t5 & 0x00000001u;
         /* 0206B050 */ if (_t6) goto L_0206B078; else goto L_0206B054;
   L_0206B054: ; // 0x206b054
         /* 0206B054 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0206B054 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0206B058 */ /* nop */
-        /* 0206B05C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0206B060 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0206B05C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0206B060 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0206B060 */ _t9 = _t8 & 0x00000001u;
         /* 0206B060 */ if (_t9) goto L_0206B064; else goto L_0206B078;
   L_0206B064: ; // 0x206b064
@@ -18801,10 +18801,10 @@ void Gambit_fn_020D436C(CPUState* cpu) {
         /* 020D438C */ cpu->r[31] = 0x101D0000u;
         /* 020D4390 */ _t3 = cpu->r[28] + 0x0000001Cu;
         /* 020D4390 */ rbrew_write32(cpu->mem, _t3, cpu->r[4]);
-        /* 020D4394 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020D4394 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020D4398 */ _t4 = cpu->r[28] + 0x0000000Fu;
         /* 020D4398 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[27]);
-        /* 020D439C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D439C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D439C */ _t6 = _t5 & 0x00000001u;
         /* 020D439C */ if (_t6) goto L_020D43E0; else goto L_020D43A0;
   L_020D43A0: ; // 0x20d43a0
@@ -18819,16 +18819,16 @@ void Gambit_fn_020D436C(CPUState* cpu) {
         /* 020D43B4 */ cpu->r[5] = 0x00000004u;
         /* 020D43B8 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020D43BC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020D43C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020D43C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020D43C4 */ cpu->r[0] = cpu->r[27];
-        /* 020D43C8 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D43C8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D43C8 */ _t11 = _t10 & 0x00000001u;
         /* 020D43C8 */ if (_t11) goto L_020D43D0; else goto L_020D43CC;
   L_020D43CC: ; // 0x20d43cc
         /* 020D43CC */ cpu->r[0] = 0x00000001u;
   L_020D43D0: ; // 0x20d43d0
-        /* 020D43D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D43D4 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D43D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D43D4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D43D4 */ _t13 = _t12 & 0x00000001u;
         /* 020D43D4 */ if (_t13) goto L_020D43E0; else goto L_020D43D8;
   L_020D43D8: ; // 0x20d43d8
@@ -18840,9 +18840,9 @@ void Gambit_fn_020D436C(CPUState* cpu) {
         /* 020D43E0 */ _t16 = cpu->r[28] + 0x00000020u;
         /* 020D43E0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 020D43E4 */ cpu->r[0] = 0x00000000u;
-        /* 020D43E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 020D43E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 020D43EC */ cpu->r[12] = cpu->r[0];
-        /* 020D43F0 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D43F0 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D43F0 */ _t18 = _t17 & 0x00000001u;
         /* 020D43F0 */ if (_t18) goto L_020D43F4; else goto L_020D4418;
   L_020D43F4: ; // 0x20d43f4
@@ -18867,8 +18867,8 @@ void Gambit_fn_020D436C(CPUState* cpu) {
   L_020D4418: ; // 0x20d4418
         /* 020D4418 */ _t26 = cpu->r[28] + 0x0000000Fu;
         /* 020D4418 */ cpu->r[27] = rbrew_read8(cpu->mem, _t26);
-        /* 020D441C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020D4420 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D441C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020D4420 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4420 */ _t28 = _t27 & 0x00000001u;
         /* 020D4420 */ if (_t28) goto L_020D4464; else goto L_020D4424;
   L_020D4424: ; // 0x20d4424
@@ -18883,16 +18883,16 @@ void Gambit_fn_020D436C(CPUState* cpu) {
         /* 020D4438 */ cpu->r[5] = 0x00000004u;
         /* 020D443C */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020D4440 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020D4444 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020D4444 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020D4448 */ cpu->r[11] = cpu->r[27];
-        /* 020D444C */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D444C */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D444C */ _t33 = _t32 & 0x00000001u;
         /* 020D444C */ if (_t33) goto L_020D4454; else goto L_020D4450;
   L_020D4450: ; // 0x20d4450
         /* 020D4450 */ cpu->r[11] = 0x00000001u;
   L_020D4454: ; // 0x20d4454
-        /* 020D4454 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D4458 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4454 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D4458 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4458 */ _t35 = _t34 & 0x00000001u;
         /* 020D4458 */ if (_t35) goto L_020D4464; else goto L_020D445C;
   L_020D445C: ; // 0x20d445c
@@ -18904,9 +18904,9 @@ void Gambit_fn_020D436C(CPUState* cpu) {
         /* 020D4464 */ _t38 = cpu->r[28] + 0x00000028u;
         /* 020D4464 */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 020D4468 */ cpu->r[0] = 0x00000000u;
-        /* 020D446C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 020D446C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 020D4470 */ cpu->r[12] = cpu->r[0];
-        /* 020D4474 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D4474 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D4474 */ _t40 = _t39 & 0x00000001u;
         /* 020D4474 */ if (_t40) goto L_020D4478; else goto L_020D449C;
   L_020D4478: ; // 0x20d4478
@@ -18931,8 +18931,8 @@ void Gambit_fn_020D436C(CPUState* cpu) {
   L_020D449C: ; // 0x20d449c
         /* 020D449C */ _t48 = cpu->r[28] + 0x0000000Fu;
         /* 020D449C */ cpu->r[27] = rbrew_read8(cpu->mem, _t48);
-        /* 020D44A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020D44A4 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D44A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020D44A4 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D44A4 */ _t50 = _t49 & 0x00000001u;
         /* 020D44A4 */ if (_t50) goto L_020D44E8; else goto L_020D44A8;
   L_020D44A8: ; // 0x20d44a8
@@ -18947,16 +18947,16 @@ void Gambit_fn_020D436C(CPUState* cpu) {
         /* 020D44BC */ cpu->r[5] = 0x00000004u;
         /* 020D44C0 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 020D44C4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020D44C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020D44C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020D44CC */ cpu->r[10] = cpu->r[27];
-        /* 020D44D0 */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D44D0 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D44D0 */ _t55 = _t54 & 0x00000001u;
         /* 020D44D0 */ if (_t55) goto L_020D44D8; else goto L_020D44D4;
   L_020D44D4: ; // 0x20d44d4
         /* 020D44D4 */ cpu->r[10] = 0x00000001u;
   L_020D44D8: ; // 0x20d44d8
-        /* 020D44D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D44DC */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D44D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D44DC */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D44DC */ _t57 = _t56 & 0x00000001u;
         /* 020D44DC */ if (_t57) goto L_020D44E8; else goto L_020D44E0;
   L_020D44E0: ; // 0x20d44e0
@@ -18968,9 +18968,9 @@ void Gambit_fn_020D436C(CPUState* cpu) {
         /* 020D44E8 */ _t60 = cpu->r[28] + 0x00000030u;
         /* 020D44E8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
         /* 020D44EC */ cpu->r[0] = 0x00000000u;
-        /* 020D44F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 020D44F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 020D44F4 */ cpu->r[5] = cpu->r[0];
-        /* 020D44F8 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D44F8 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D44F8 */ _t62 = _t61 & 0x00000001u;
         /* 020D44F8 */ if (_t62) goto L_020D44FC; else goto L_020D4520;
   L_020D44FC: ; // 0x20d44fc
@@ -18995,8 +18995,8 @@ void Gambit_fn_020D436C(CPUState* cpu) {
   L_020D4520: ; // 0x20d4520
         /* 020D4520 */ _t70 = cpu->r[30] + 0x00000000u;
         /* 020D4520 */ cpu->r[25] = rbrew_read8(cpu->mem, _t70);
-        /* 020D4524 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 020D4528 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 020D4528 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4528 */ _t72 = _t71 & 0x00000001u;
         /* 020D4528 */ if (_t72) goto L_020D4604; else goto L_020D452C;
   L_020D452C: ; // 0x20d452c
@@ -19012,10 +19012,10 @@ void Gambit_fn_020D436C(CPUState* cpu) {
         /* 020D4544 */ cpu->r[4] = (uint32_t)((int32_t)cpu->r[25] * (int32_t)0x00000024u);
         /* 020D4548 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020D454C */ cpu->r[24] = cpu->r[3];
-        /* 020D4550 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 020D4550 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 020D4554 */ cpu->r[30] = cpu->r[25];
         /* 020D4558 */ cpu->r[7] = 0x00000000u;
-        /* 020D455C */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D455C */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D455C */ _t77 = _t76 & 0x00000001u;
         /* 020D455C */ if (_t77) goto L_020D4564; else goto L_020D4560;
   L_020D4560: ; // 0x20d4560
@@ -19028,36 +19028,36 @@ void Gambit_fn_020D436C(CPUState* cpu) {
         /* 020D4570 */ cpu->r[23] = 0x00000018u;
   L_020D4574: ; // 0x20d4574
         /* 020D4574 */ cpu->r[27] = cpu->r[24] + cpu->r[22];
-        /* 020D4574 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 020D4578 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4574 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 020D4578 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4578 */ _t80 = _t79 & 0x00000001u;
         /* 020D4578 */ if (_t80) goto L_020D45E8; else goto L_020D457C;
   L_020D457C: ; // 0x20d457c
         /* 020D457C */ cpu->r[26] = cpu->r[27];
-        /* 020D457C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 020D4580 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D457C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 020D4580 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4580 */ _t82 = _t81 & 0x00000001u;
         /* 020D4580 */ if (_t82) goto L_020D4584; else goto L_020D4594;
   L_020D4584: ; // 0x20d4584
         /* 020D4584 */ cpu->r[3] = 0x00000024u;
         /* 020D4588 */ Gambit_fn_02801A78(cpu);
         /* 020D458C */ cpu->r[26] = cpu->r[3];
-        /* 020D458C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 020D4590 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D458C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 020D4590 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4590 */ _t84 = _t83 & 0x00000001u;
         /* 020D4590 */ if (_t84) goto L_020D45DC; else goto L_020D4594;
   L_020D4594: ; // 0x20d4594
         /* 020D4594 */ cpu->r[11] = cpu->r[26];
-        /* 020D4594 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020D4598 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4594 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020D4598 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4598 */ _t86 = _t85 & 0x00000001u;
         /* 020D4598 */ if (_t86) goto L_020D459C; else goto L_020D45AC;
   L_020D459C: ; // 0x20d459c
         /* 020D459C */ cpu->r[3] = 0x0000000Cu;
         /* 020D45A0 */ Gambit_fn_02801A78(cpu);
         /* 020D45A4 */ cpu->r[11] = cpu->r[3];
-        /* 020D45A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 020D45A8 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D45A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 020D45A8 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D45A8 */ _t88 = _t87 & 0x00000001u;
         /* 020D45A8 */ if (_t88) goto L_020D45C8; else goto L_020D45AC;
   L_020D45AC: ; // 0x20d45ac
@@ -19088,14 +19088,14 @@ void Gambit_fn_020D436C(CPUState* cpu) {
         /* 020D45E4 */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
   L_020D45E8: ; // 0x20d45e8
         /* 020D45E8 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 020D45E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D45E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D45EC */ cpu->r[22] = cpu->r[22] + 0x00000024u;
-        /* 020D45F0 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D45F0 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D45F0 */ _t98 = _t97 & 0x00000001u;
         /* 020D45F0 */ if (_t98) goto L_020D45F4; else goto L_020D4574;
   L_020D45F4: ; // 0x20d45f4
-        /* 020D45F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 020D45F8 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D45F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 020D45F8 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D45F8 */ _t100 = _t99 & 0x00000001u;
         /* 020D45F8 */ if (_t100) goto L_020D4604; else goto L_020D45FC;
   L_020D45FC: ; // 0x20d45fc
@@ -19125,10 +19125,10 @@ void Gambit_fn_020D461C(CPUState* cpu) {
         /* 020D4620 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 020D4624 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 020D4624 */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 020D4628 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[12]);
+        /* 020D4628 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[12]));
         /* 020D462C */ _t3 = cpu->r[4] + 0x00000000u;
         /* 020D462C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 020D4630 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D4630 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D4630 */ _t5 = _t4 & 0x00000001u;
         /* 020D4630 */ if (_t5) goto L_020D4634; else goto L_020D463C;
   L_020D4634: ; // 0x20d4634
@@ -19145,10 +19145,10 @@ void Gambit_fn_020D461C(CPUState* cpu) {
         /* 020D4648 */ cpu->r[9] = rbrew_read8(cpu->mem, _t9);
         /* 020D464C */ _t10 = cpu->r[3] + 0x00000028u;
         /* 020D464C */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 020D4650 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
+        /* 020D4650 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
         /* 020D4654 */ _t11 = cpu->r[3] + 0x0000002Cu;
         /* 020D4654 */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
-        /* 020D4658 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D4658 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D4658 */ _t13 = _t12 & 0x00000001u;
         /* 020D4658 */ if (_t13) goto L_020D465C; else goto L_020D4664;
   L_020D465C: ; // 0x20d465c
@@ -19169,10 +19169,10 @@ void Gambit_fn_020D461C(CPUState* cpu) {
         /* 020D4678 */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
         /* 020D467C */ _t20 = cpu->r[3] + 0x00000034u;
         /* 020D467C */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 020D4680 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
+        /* 020D4680 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
         /* 020D4684 */ _t21 = cpu->r[6] + 0x00000000u;
         /* 020D4684 */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
-        /* 020D4688 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D4688 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D4688 */ _t23 = _t22 & 0x00000001u;
         /* 020D4688 */ if (_t23) goto L_020D468C; else goto L_020D4694;
   L_020D468C: ; // 0x20d468c
@@ -19205,11 +19205,11 @@ void Gambit_fn_020D46A4(CPUState* cpu) {
         /* 020D5140 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D5140 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D5144 */ cpu->r[30] = cpu->r[3];
-        /* 020D5144 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D5144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D5148 */ cpu->r[31] = cpu->r[4];
         /* 020D514C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D514C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D5150 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5150 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5150 */ _t5 = _t4 & 0x00000001u;
         /* 020D5150 */ if (_t5) goto L_020D5194; else goto L_020D5154;
   L_020D5154: ; // 0x20d5154
@@ -19229,8 +19229,8 @@ void Gambit_fn_020D46A4(CPUState* cpu) {
         /* 020D517C */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D5180 */ Gambit_fn_02068798(cpu);
         /* 020D5184 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D5184 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D5188 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5184 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D5188 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5188 */ _t10 = _t9 & 0x00000001u;
         /* 020D5188 */ if (_t10) goto L_020D5194; else goto L_020D518C;
   L_020D518C: ; // 0x20d518c
@@ -19258,8 +19258,8 @@ void Gambit_fn_020D46AC(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -19310,7 +19310,7 @@ void Gambit_fn_020D46C4(CPUState* cpu) {
         /* 020D46CC */ _t1 = cpu->r[1] + 0x0000001Cu;
         /* 020D46CC */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 020D46D0 */ cpu->r[31] = cpu->r[3];
-        /* 020D46D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020D46D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020D46D4 */ _t2 = cpu->r[1] + 0x00000018u;
         /* 020D46D4 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D46D8 */ _t3 = cpu->r[1] + 0x00000010u;
@@ -19321,15 +19321,15 @@ void Gambit_fn_020D46C4(CPUState* cpu) {
         /* 020D46E4 */ _t5 = cpu->r[1] + 0x00000024u;
         /* 020D46E4 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
         /* 020D46E8 */ cpu->r[29] = cpu->r[4];
-        /* 020D46EC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D46EC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D46EC */ _t7 = _t6 & 0x00000001u;
         /* 020D46EC */ if (_t7) goto L_020D46F0; else goto L_020D4700;
   L_020D46F0: ; // 0x20d46f0
         /* 020D46F0 */ cpu->r[3] = 0x00000238u;
         /* 020D46F4 */ Gambit_fn_02801A78(cpu);
         /* 020D46F8 */ cpu->r[31] = cpu->r[3];
-        /* 020D46F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D46FC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D46F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D46FC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D46FC */ _t9 = _t8 & 0x00000001u;
         /* 020D46FC */ if (_t9) goto L_020D4848; else goto L_020D4700;
   L_020D4700: ; // 0x20d4700
@@ -19360,46 +19360,46 @@ void Gambit_fn_020D46C4(CPUState* cpu) {
         /* 020D4748 */ rbrew_write32(cpu->mem, _t15, cpu->r[12]);
         /* 020D474C */ cpu->r[6] = cpu->r[6] + 0xFFFF8914u;
         /* 020D4750 */ cpu->r[28] = cpu->r[31] + 0x000001E0u;
-        /* 020D4750 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 020D4750 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 020D4754 */ _t16 = cpu->r[31] + 0x0000001Cu;
         /* 020D4754 */ rbrew_write32(cpu->mem, _t16, cpu->r[6]);
-        /* 020D4758 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4758 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4758 */ _t18 = _t17 & 0x00000001u;
         /* 020D4758 */ if (_t18) goto L_020D475C; else goto L_020D476C;
   L_020D475C: ; // 0x20d475c
         /* 020D475C */ cpu->r[3] = 0x0000002Cu;
         /* 020D4760 */ Gambit_fn_02801A78(cpu);
         /* 020D4764 */ cpu->r[28] = cpu->r[3];
-        /* 020D4764 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 020D4768 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4764 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 020D4768 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4768 */ _t20 = _t19 & 0x00000001u;
         /* 020D4768 */ if (_t20) goto L_020D4800; else goto L_020D476C;
   L_020D476C: ; // 0x20d476c
         /* 020D476C */ cpu->r[29] = cpu->r[28];
-        /* 020D476C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020D4770 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D476C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020D4770 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4770 */ _t22 = _t21 & 0x00000001u;
         /* 020D4770 */ if (_t22) goto L_020D4774; else goto L_020D4784;
   L_020D4774: ; // 0x20d4774
         /* 020D4774 */ cpu->r[3] = 0x0000002Cu;
         /* 020D4778 */ Gambit_fn_02801A78(cpu);
         /* 020D477C */ cpu->r[29] = cpu->r[3];
-        /* 020D477C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020D4780 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D477C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020D4780 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4780 */ _t24 = _t23 & 0x00000001u;
         /* 020D4780 */ if (_t24) goto L_020D47F4; else goto L_020D4784;
   L_020D4784: ; // 0x20d4784
         /* 020D4784 */ cpu->r[3] = cpu->r[29];
-        /* 020D4784 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 020D4784 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 020D4788 */ cpu->r[30] = 0x10110000u;
-        /* 020D478C */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D478C */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D478C */ _t26 = _t25 & 0x00000001u;
         /* 020D478C */ if (_t26) goto L_020D4790; else goto L_020D47BC;
   L_020D4790: ; // 0x20d4790
         /* 020D4790 */ cpu->r[3] = 0x0000000Cu;
         /* 020D4794 */ Gambit_fn_02801A78(cpu);
-        /* 020D4798 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D479C */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4798 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D479C */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D479C */ _t28 = _t27 & 0x00000001u;
         /* 020D479C */ if (_t28) goto L_020D47A0; else goto L_020D47BC;
   L_020D47A0: ; // 0x20d47a0
@@ -19503,7 +19503,7 @@ void Gambit_fn_020D46C8(CPUState* cpu) {
         /* 020D46CC */ _t1 = cpu->r[1] + 0x0000001Cu;
         /* 020D46CC */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 020D46D0 */ cpu->r[31] = cpu->r[3];
-        /* 020D46D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020D46D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020D46D4 */ _t2 = cpu->r[1] + 0x00000018u;
         /* 020D46D4 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D46D8 */ _t3 = cpu->r[1] + 0x00000010u;
@@ -19514,15 +19514,15 @@ void Gambit_fn_020D46C8(CPUState* cpu) {
         /* 020D46E4 */ _t5 = cpu->r[1] + 0x00000024u;
         /* 020D46E4 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
         /* 020D46E8 */ cpu->r[29] = cpu->r[4];
-        /* 020D46EC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D46EC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D46EC */ _t7 = _t6 & 0x00000001u;
         /* 020D46EC */ if (_t7) goto L_020D46F0; else goto L_020D4700;
   L_020D46F0: ; // 0x20d46f0
         /* 020D46F0 */ cpu->r[3] = 0x00000238u;
         /* 020D46F4 */ Gambit_fn_02801A78(cpu);
         /* 020D46F8 */ cpu->r[31] = cpu->r[3];
-        /* 020D46F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D46FC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D46F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D46FC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D46FC */ _t9 = _t8 & 0x00000001u;
         /* 020D46FC */ if (_t9) goto L_020D4848; else goto L_020D4700;
   L_020D4700: ; // 0x20d4700
@@ -19553,46 +19553,46 @@ void Gambit_fn_020D46C8(CPUState* cpu) {
         /* 020D4748 */ rbrew_write32(cpu->mem, _t15, cpu->r[12]);
         /* 020D474C */ cpu->r[6] = cpu->r[6] + 0xFFFF8914u;
         /* 020D4750 */ cpu->r[28] = cpu->r[31] + 0x000001E0u;
-        /* 020D4750 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 020D4750 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 020D4754 */ _t16 = cpu->r[31] + 0x0000001Cu;
         /* 020D4754 */ rbrew_write32(cpu->mem, _t16, cpu->r[6]);
-        /* 020D4758 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4758 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4758 */ _t18 = _t17 & 0x00000001u;
         /* 020D4758 */ if (_t18) goto L_020D475C; else goto L_020D476C;
   L_020D475C: ; // 0x20d475c
         /* 020D475C */ cpu->r[3] = 0x0000002Cu;
         /* 020D4760 */ Gambit_fn_02801A78(cpu);
         /* 020D4764 */ cpu->r[28] = cpu->r[3];
-        /* 020D4764 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 020D4768 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4764 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 020D4768 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4768 */ _t20 = _t19 & 0x00000001u;
         /* 020D4768 */ if (_t20) goto L_020D4800; else goto L_020D476C;
   L_020D476C: ; // 0x20d476c
         /* 020D476C */ cpu->r[29] = cpu->r[28];
-        /* 020D476C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020D4770 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D476C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020D4770 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4770 */ _t22 = _t21 & 0x00000001u;
         /* 020D4770 */ if (_t22) goto L_020D4774; else goto L_020D4784;
   L_020D4774: ; // 0x20d4774
         /* 020D4774 */ cpu->r[3] = 0x0000002Cu;
         /* 020D4778 */ Gambit_fn_02801A78(cpu);
         /* 020D477C */ cpu->r[29] = cpu->r[3];
-        /* 020D477C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020D4780 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D477C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020D4780 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4780 */ _t24 = _t23 & 0x00000001u;
         /* 020D4780 */ if (_t24) goto L_020D47F4; else goto L_020D4784;
   L_020D4784: ; // 0x20d4784
         /* 020D4784 */ cpu->r[3] = cpu->r[29];
-        /* 020D4784 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 020D4784 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 020D4788 */ cpu->r[30] = 0x10110000u;
-        /* 020D478C */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D478C */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D478C */ _t26 = _t25 & 0x00000001u;
         /* 020D478C */ if (_t26) goto L_020D4790; else goto L_020D47BC;
   L_020D4790: ; // 0x20d4790
         /* 020D4790 */ cpu->r[3] = 0x0000000Cu;
         /* 020D4794 */ Gambit_fn_02801A78(cpu);
-        /* 020D4798 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D479C */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4798 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D479C */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D479C */ _t28 = _t27 & 0x00000001u;
         /* 020D479C */ if (_t28) goto L_020D47A0; else goto L_020D47BC;
   L_020D47A0: ; // 0x20d47a0
@@ -19694,20 +19694,20 @@ void Gambit_fn_020D486C(CPUState* cpu) {
         /* 020D486C */ cpu->r[0] = rbrew_read8(cpu->mem, _t0);
         /* 020D4870 */ _t1 = cpu->r[3] + 0x0000021Cu;
         /* 020D4870 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
-        /* 020D4874 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020D4874 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020D4878 */ _t2 = cpu->r[3] + 0x00000224u;
         /* 020D4878 */ cpu->r[10] = rbrew_read32(cpu->mem, _t2);
-        /* 020D487C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D487C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D487C */ _t4 = _t3 & 0x00000001u;
         /* 020D487C */ if (_t4) goto L_020D4894; else goto L_020D4880;
   L_020D4880: ; // 0x20d4880
-        /* 020D4880 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[10]);
+        /* 020D4880 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[10]));
         /* 020D4884 */ /* nop */
         /* 020D4888 */ cpu->r[3] = rbrew_rlwinm(cpu->r[11], 0x00000002u, 0x0000001Fu, 0x0000001Fu);
         /* 020D488C */ cpu->r[3] = cpu->r[3] ^ 0x00000001u;
         /* 020D4890 */ return;
   L_020D4894: ; // 0x20d4894
-        /* 020D4894 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[10]);
+        /* 020D4894 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[10]));
         /* 020D4898 */ /* nop */
         /* 020D489C */ cpu->r[3] = rbrew_rlwinm(cpu->r[12], 0x00000002u, 0x0000001Fu, 0x0000001Fu);
         /* 020D48A0 */ return;
@@ -19737,24 +19737,24 @@ void Gambit_fn_020D48A4(CPUState* cpu) {
         /* 020A7FC4 */ _t6 = cpu->r[1] + 0x0000000Cu;
         /* 020A7FC4 */ rbrew_write32(cpu->mem, _t6, cpu->r[5]);
         /* 020A7FC8 */ Gambit_fn_020A7E08(cpu);
-        /* 020A7FCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020A7FD0 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020A7FCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020A7FD0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020A7FD0 */ _t8 = _t7 & 0x00000001u;
         /* 020A7FD0 */ if (_t8) goto L_020A8030; else goto L_020A7FD4;
   L_020A7FD4: ; // 0x20a7fd4
         /* 020A7FD4 */ _t9 = cpu->r[29] + 0x00000008u;
         /* 020A7FD4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
         /* 020A7FD8 */ cpu->r[30] = 0x00000000u;
-        /* 020A7FDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
-        /* 020A7FE0 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020A7FDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
+        /* 020A7FE0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020A7FE0 */ _t11 = _t10 & 0x00000001u;
         /* 020A7FE0 */ if (_t11) goto L_020A7FE4; else goto L_020A8028;
   L_020A7FE4: ; // 0x20a7fe4
         /* 020A7FE4 */ cpu->r[31] = 0x00000000u;
   L_020A7FE8: ; // 0x20a7fe8
-        /* 020A7FE8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
+        /* 020A7FE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
         /* 020A7FEC */ cpu->r[3] = 0x00000000u;
-        /* 020A7FF0 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020A7FF0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020A7FF0 */ _t13 = _t12 & 0x00000001u;
         /* 020A7FF0 */ if (_t13) goto L_020A7FF4; else goto L_020A7FFC;
   L_020A7FF4: ; // 0x20a7ff4
@@ -19767,7 +19767,7 @@ void Gambit_fn_020D48A4(CPUState* cpu) {
         /* 020A8000 */ cpu->r[6] = cpu->r[1] + 0x00000008u;
         /* 020A8004 */ cpu->r[5] = 0x00000002u;
         /* 020A8008 */ cpu->r[4] = cpu->r[29] + 0x00000054u;
-        /* 020A800C */ _t16 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020A800C */ _t16 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020A800C */ _t17 = _t16 & 0x00000001u;
         /* 020A800C */ if (_t17) goto L_020A8010; // else: addr-0 trap, fall-through
   L_020A8010: ; // 0x20a8010
@@ -19775,9 +19775,9 @@ void Gambit_fn_020D48A4(CPUState* cpu) {
         /* 020A8014 */ _t18 = cpu->r[29] + 0x00000008u;
         /* 020A8014 */ cpu->r[0] = rbrew_read32(cpu->mem, _t18);
         /* 020A8018 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020A801C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 020A801C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 020A8020 */ cpu->r[31] = cpu->r[31] + 0x00000004u;
-        /* 020A8024 */ _t19 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020A8024 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020A8024 */ _t20 = _t19 & 0x00000001u;
         /* 020A8024 */ if (_t20) goto L_020A7FE8; else goto L_020A8028;
   L_020A8028: ; // 0x20a8028
@@ -19847,7 +19847,7 @@ void Gambit_fn_020D48A4(CPUState* cpu) {
         /* 020A840C */ rbrew_write32(cpu->mem, _t40, cpu->r[0]);
         /* 020A8410 */ _t41 = cpu->r[1] + 0x00000038u;
         /* 020A8410 */ rbrew_write32(cpu->mem, _t41, cpu->r[7]);
-        /* 020A8414 */ _t42 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020A8414 */ _t42 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020A8414 */ _t43 = _t42 & 0x00000001u;
         /* 020A8414 */ if (_t43) goto L_020A8418; // else: addr-0 trap, fall-through
   L_020A8418: ; // 0x20a8418
@@ -19875,8 +19875,8 @@ void Gambit_fn_020D48A4(CPUState* cpu) {
         /* 020A8450 */ cpu->r[5] = rbrew_read32(cpu->mem, _t50);
         /* 020A8454 */ cpu->r[3] = cpu->r[29];
         /* 020A8458 */ Gambit_fn_0282C89C(cpu);
-        /* 020A845C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020A8460 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020A845C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020A8460 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020A8460 */ _t52 = _t51 & 0x00000001u;
         /* 020A8460 */ if (_t52) goto L_020A846C; else goto L_020A8464;
   L_020A8464: ; // 0x20a8464
@@ -19901,20 +19901,20 @@ void Gambit_fn_020D48A4(CPUState* cpu) {
         /* 020D48A4 */ cpu->r[12] = cpu->r[3];
         /* 020D48A8 */ _t57 = cpu->r[12] + 0x0000020Cu;
         /* 020D48A8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t57);
-        /* 020D48AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D48B0 */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D48AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D48B0 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D48B0 */ _t59 = _t58 & 0x00000001u;
         /* 020D48B0 */ if (_t59) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D48B0 */ goto L_020D48B4;
   L_020D48B4: ; // 0x20d48b4
         /* 020D48B4 */ _t60 = cpu->r[12] + 0x00000210u;
         /* 020D48B4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t60);
-        /* 020D48B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
-        /* 020D48BC */ _t61 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D48B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
+        /* 020D48BC */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D48BC */ _t62 = _t61 & 0x00000001u;
         /* 020D48BC */ if (_t62) goto L_020D48C8; else goto L_020D48C0;
   L_020D48C0: ; // 0x20d48c0
-        /* 020D48C0 */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D48C0 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D48C0 */ _t64 = _t63 & 0x00000001u;
         /* 020D48C0 */ if (_t64) goto L_020D48D4; else goto L_020D48C4;
   L_020D48C4: ; // 0x20d48c4
@@ -19981,11 +19981,11 @@ void Gambit_fn_020D4900(CPUState* cpu) {
         /* 020D4950 */ cpu->r[29] = 0x10020000u;
         /* 020D4954 */ cpu->r[30] = 0x10020000u;
         /* 020D4958 */ cpu->r[28] = cpu->r[3];
-        /* 020D4958 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 020D4958 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 020D495C */ cpu->r[29] = cpu->r[29] + 0xFFFF8648u;
         /* 020D4960 */ cpu->r[30] = cpu->r[30] + 0xFFFF86C8u;
         /* 020D4964 */ cpu->r[3] = cpu->r[31];
-        /* 020D4968 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4968 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4968 */ _t14 = _t13 & 0x00000001u;
         /* 020D4968 */ if (_t14) goto L_020D49B4; else goto L_020D496C;
   L_020D496C: ; // 0x20d496c
@@ -20029,9 +20029,9 @@ void Gambit_fn_020D4900(CPUState* cpu) {
         /* 020D49D0 */ Gambit_fn_027ED700(cpu);
         /* 020D49D4 */ _t26 = cpu->r[31] + 0x00000234u;
         /* 020D49D4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t26);
-        /* 020D49D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020D49D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020D49DC */ cpu->r[3] = cpu->r[31];
-        /* 020D49E0 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D49E0 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D49E0 */ _t28 = _t27 & 0x00000001u;
         /* 020D49E0 */ if (_t28) goto L_020D4A14; else goto L_020D49E4;
   L_020D49E4: ; // 0x20d49e4
@@ -20121,11 +20121,11 @@ void Gambit_fn_020D4904(CPUState* cpu) {
         /* 020D4950 */ cpu->r[29] = 0x10020000u;
         /* 020D4954 */ cpu->r[30] = 0x10020000u;
         /* 020D4958 */ cpu->r[28] = cpu->r[3];
-        /* 020D4958 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 020D4958 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 020D495C */ cpu->r[29] = cpu->r[29] + 0xFFFF8648u;
         /* 020D4960 */ cpu->r[30] = cpu->r[30] + 0xFFFF86C8u;
         /* 020D4964 */ cpu->r[3] = cpu->r[31];
-        /* 020D4968 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4968 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4968 */ _t14 = _t13 & 0x00000001u;
         /* 020D4968 */ if (_t14) goto L_020D49B4; else goto L_020D496C;
   L_020D496C: ; // 0x20d496c
@@ -20169,9 +20169,9 @@ void Gambit_fn_020D4904(CPUState* cpu) {
         /* 020D49D0 */ Gambit_fn_027ED700(cpu);
         /* 020D49D4 */ _t26 = cpu->r[31] + 0x00000234u;
         /* 020D49D4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t26);
-        /* 020D49D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020D49D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020D49DC */ cpu->r[3] = cpu->r[31];
-        /* 020D49E0 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D49E0 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D49E0 */ _t28 = _t27 & 0x00000001u;
         /* 020D49E0 */ if (_t28) goto L_020D4A14; else goto L_020D49E4;
   L_020D49E4: ; // 0x20d49e4
@@ -20312,15 +20312,15 @@ void Gambit_fn_020D4A94(CPUState* cpu) {
         /* 020D4AB8 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 020D4ABC */ _t7 = cpu->r[31] + 0x00000235u;
         /* 020D4ABC */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
-        /* 020D4AC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020D4AC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020D4AC4 */ _t8 = cpu->r[31] + 0x0000021Cu;
         /* 020D4AC4 */ rbrew_write32(cpu->mem, _t8, cpu->r[4]);
-        /* 020D4AC8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4AC8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4AC8 */ _t10 = _t9 & 0x00000001u;
         /* 020D4AC8 */ if (_t10) goto L_020D4B20; else goto L_020D4ACC;
   L_020D4ACC: ; // 0x20d4acc
-        /* 020D4ACC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020D4AD0 */ _t11 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D4ACC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020D4AD0 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D4AD0 */ _t12 = _t11 & 0x00000001u;
         /* 020D4AD0 */ if (_t12) goto L_020D4AD4; else goto L_020D4B2C;
   L_020D4AD4: ; // 0x20d4ad4
@@ -20331,8 +20331,8 @@ void Gambit_fn_020D4A94(CPUState* cpu) {
         /* 020D4AE0 */ cpu->r[9] = (uint32_t)((int32_t)cpu->r[7] / (int32_t)cpu->r[10]);
         /* 020D4AE4 */ _t14 = cpu->r[31] + 0x00000218u;
         /* 020D4AE4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
-        /* 020D4AE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], cpu->r[0]);
-        /* 020D4AEC */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D4AE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], cpu->r[0]));
+        /* 020D4AEC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D4AEC */ _t16 = _t15 & 0x00000001u;
         /* 020D4AEC */ if (_t16) goto L_020D4AF0; else goto L_020D4B30;
   L_020D4AF0: ; // 0x20d4af0
@@ -20345,10 +20345,10 @@ void Gambit_fn_020D4A94(CPUState* cpu) {
         /* 020D4B04 */ cpu->r[29] = cpu->r[3];
         /* 020D4B08 */ cpu->r[30] = cpu->r[30] + 0xFFFF8648u;
         /* 020D4B0C */ cpu->r[10] = 0x10020000u;
-        /* 020D4B10 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[9]);
+        /* 020D4B10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[9]));
         /* 020D4B14 */ _t18 = cpu->r[10] + 0xFFFF86B8u;
         /* 020D4B14 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t18);
-        /* 020D4B18 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4B18 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4B18 */ _t20 = _t19 & 0x00000001u;
         /* 020D4B18 */ if (_t20) goto L_020D4BBC; else goto L_020D4B1C;
   L_020D4B1C: ; // 0x20d4b1c
@@ -20357,8 +20357,8 @@ void Gambit_fn_020D4A94(CPUState* cpu) {
         /* 020D4B20 */ _t21 = cpu->r[31] + 0x0000022Cu;
         /* 020D4B20 */ cpu->r[8] = rbrew_read32(cpu->mem, _t21);
         /* 020D4B24 */ cpu->r[9] = (uint32_t)((int32_t)cpu->r[4] / (int32_t)cpu->r[8]);
-        /* 020D4B24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 020D4B28 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D4B24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 020D4B28 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D4B28 */ _t23 = _t22 & 0x00000001u;
         /* 020D4B28 */ if (_t23) goto L_020D4B2C; else goto L_020D4B30;
   L_020D4B2C: ; // 0x20d4b2c
@@ -20372,10 +20372,10 @@ void Gambit_fn_020D4A94(CPUState* cpu) {
         /* 020D4B40 */ cpu->r[29] = cpu->r[3];
         /* 020D4B44 */ cpu->r[30] = cpu->r[30] + 0xFFFF8648u;
         /* 020D4B48 */ cpu->r[10] = 0x10020000u;
-        /* 020D4B4C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[9]);
+        /* 020D4B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[9]));
         /* 020D4B50 */ _t25 = cpu->r[10] + 0xFFFF86B8u;
         /* 020D4B50 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t25);
-        /* 020D4B54 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4B54 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4B54 */ _t27 = _t26 & 0x00000001u;
         /* 020D4B54 */ if (_t27) goto L_020D4BBC; else goto L_020D4B58;
   L_020D4B58: ; // 0x20d4b58
@@ -20383,10 +20383,10 @@ void Gambit_fn_020D4A94(CPUState* cpu) {
         /* 020D4B5C */ _t28 = cpu->r[31] + 0x00000220u;
         /* 020D4B5C */ rbrew_write32(cpu->mem, _t28, cpu->r[9]);
         /* 020D4B60 */ Gambit_fn_020D48A4(cpu);
-        /* 020D4B64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020D4B64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020D4B68 */ _t29 = cpu->r[31] + 0x000001DCu;
         /* 020D4B68 */ cpu->r[12] = rbrew_read32(cpu->mem, _t29);
-        /* 020D4B6C */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4B6C */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4B6C */ _t31 = _t30 & 0x00000001u;
         /* 020D4B6C */ if (_t31) goto L_020D4B98; else goto L_020D4B70;
   L_020D4B70: ; // 0x20d4b70
@@ -20417,15 +20417,15 @@ void Gambit_fn_020D4A94(CPUState* cpu) {
   L_020D4BBC: ; // 0x20d4bbc
         /* 020D4BBC */ _t36 = cpu->r[31] + 0x00000236u;
         /* 020D4BBC */ cpu->r[0] = rbrew_read8(cpu->mem, _t36);
-        /* 020D4BC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020D4BC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020D4BC4 */ cpu->r[0] = 0x10020000u;
         /* 020D4BC8 */ cpu->r[0] = cpu->r[0] + 0xFFFF86F8u;
-        /* 020D4BCC */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4BCC */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4BCC */ _t38 = _t37 & 0x00000001u;
         /* 020D4BCC */ if (_t38) goto L_020D4BD0; else goto L_020D4C00;
   L_020D4BD0: ; // 0x20d4bd0
-        /* 020D4BD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020D4BD4 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4BD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020D4BD4 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4BD4 */ _t40 = _t39 & 0x00000001u;
         /* 020D4BD4 */ if (_t40) goto L_020D4C5C; else goto L_020D4BD8;
   L_020D4BD8: ; // 0x20d4bd8
@@ -20445,16 +20445,16 @@ void Gambit_fn_020D4A94(CPUState* cpu) {
         /* 020D4BF8 */ rbrew_write8(cpu->mem, _t45, (uint8_t)cpu->r[29]);
         /* 020D4BFC */ goto L_020D4C60;
   L_020D4C00: ; // 0x20d4c00
-        /* 020D4C00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020D4C04 */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4C00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020D4C04 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4C04 */ _t47 = _t46 & 0x00000001u;
         /* 020D4C04 */ if (_t47) goto L_020D4C08; else goto L_020D4C5C;
   L_020D4C08: ; // 0x20d4c08
         /* 020D4C08 */ _t48 = cpu->r[31] + 0x00000234u;
         /* 020D4C08 */ cpu->r[6] = rbrew_read8(cpu->mem, _t48);
-        /* 020D4C0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 020D4C0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 020D4C10 */ cpu->r[3] = cpu->r[31];
-        /* 020D4C14 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4C14 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4C14 */ _t50 = _t49 & 0x00000001u;
         /* 020D4C14 */ if (_t50) goto L_020D4C44; else goto L_020D4C18;
   L_020D4C18: ; // 0x20d4c18
@@ -20497,7 +20497,7 @@ void Gambit_fn_020D4A94(CPUState* cpu) {
         /* 020D4C6C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t62);
         /* 020D4C70 */ _t63 = cpu->r[1] + 0x0000003Cu;
         /* 020D4C70 */ cpu->r[31] = rbrew_read32(cpu->mem, _t63);
-        /* 020D4C74 */ _t64 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D4C74 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D4C74 */ _t65 = _t64 & 0x00000001u;
         /* 020D4C74 */ if (_t65) goto L_020D4C78; // else: addr-0 trap, fall-through
   L_020D4C78: ; // 0x20d4c78
@@ -20532,15 +20532,15 @@ void Gambit_fn_020D4A98(CPUState* cpu) {
         /* 020D4AB8 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 020D4ABC */ _t7 = cpu->r[31] + 0x00000235u;
         /* 020D4ABC */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
-        /* 020D4AC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020D4AC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020D4AC4 */ _t8 = cpu->r[31] + 0x0000021Cu;
         /* 020D4AC4 */ rbrew_write32(cpu->mem, _t8, cpu->r[4]);
-        /* 020D4AC8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4AC8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4AC8 */ _t10 = _t9 & 0x00000001u;
         /* 020D4AC8 */ if (_t10) goto L_020D4B20; else goto L_020D4ACC;
   L_020D4ACC: ; // 0x20d4acc
-        /* 020D4ACC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020D4AD0 */ _t11 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D4ACC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020D4AD0 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D4AD0 */ _t12 = _t11 & 0x00000001u;
         /* 020D4AD0 */ if (_t12) goto L_020D4AD4; else goto L_020D4B2C;
   L_020D4AD4: ; // 0x20d4ad4
@@ -20551,8 +20551,8 @@ void Gambit_fn_020D4A98(CPUState* cpu) {
         /* 020D4AE0 */ cpu->r[9] = (uint32_t)((int32_t)cpu->r[7] / (int32_t)cpu->r[10]);
         /* 020D4AE4 */ _t14 = cpu->r[31] + 0x00000218u;
         /* 020D4AE4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
-        /* 020D4AE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], cpu->r[0]);
-        /* 020D4AEC */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D4AE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], cpu->r[0]));
+        /* 020D4AEC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D4AEC */ _t16 = _t15 & 0x00000001u;
         /* 020D4AEC */ if (_t16) goto L_020D4AF0; else goto L_020D4B30;
   L_020D4AF0: ; // 0x20d4af0
@@ -20565,10 +20565,10 @@ void Gambit_fn_020D4A98(CPUState* cpu) {
         /* 020D4B04 */ cpu->r[29] = cpu->r[3];
         /* 020D4B08 */ cpu->r[30] = cpu->r[30] + 0xFFFF8648u;
         /* 020D4B0C */ cpu->r[10] = 0x10020000u;
-        /* 020D4B10 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[9]);
+        /* 020D4B10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[9]));
         /* 020D4B14 */ _t18 = cpu->r[10] + 0xFFFF86B8u;
         /* 020D4B14 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t18);
-        /* 020D4B18 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4B18 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4B18 */ _t20 = _t19 & 0x00000001u;
         /* 020D4B18 */ if (_t20) goto L_020D4BBC; else goto L_020D4B1C;
   L_020D4B1C: ; // 0x20d4b1c
@@ -20577,8 +20577,8 @@ void Gambit_fn_020D4A98(CPUState* cpu) {
         /* 020D4B20 */ _t21 = cpu->r[31] + 0x0000022Cu;
         /* 020D4B20 */ cpu->r[8] = rbrew_read32(cpu->mem, _t21);
         /* 020D4B24 */ cpu->r[9] = (uint32_t)((int32_t)cpu->r[4] / (int32_t)cpu->r[8]);
-        /* 020D4B24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 020D4B28 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D4B24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 020D4B28 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D4B28 */ _t23 = _t22 & 0x00000001u;
         /* 020D4B28 */ if (_t23) goto L_020D4B2C; else goto L_020D4B30;
   L_020D4B2C: ; // 0x20d4b2c
@@ -20592,10 +20592,10 @@ void Gambit_fn_020D4A98(CPUState* cpu) {
         /* 020D4B40 */ cpu->r[29] = cpu->r[3];
         /* 020D4B44 */ cpu->r[30] = cpu->r[30] + 0xFFFF8648u;
         /* 020D4B48 */ cpu->r[10] = 0x10020000u;
-        /* 020D4B4C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[9]);
+        /* 020D4B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[9]));
         /* 020D4B50 */ _t25 = cpu->r[10] + 0xFFFF86B8u;
         /* 020D4B50 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t25);
-        /* 020D4B54 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4B54 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4B54 */ _t27 = _t26 & 0x00000001u;
         /* 020D4B54 */ if (_t27) goto L_020D4BBC; else goto L_020D4B58;
   L_020D4B58: ; // 0x20d4b58
@@ -20603,10 +20603,10 @@ void Gambit_fn_020D4A98(CPUState* cpu) {
         /* 020D4B5C */ _t28 = cpu->r[31] + 0x00000220u;
         /* 020D4B5C */ rbrew_write32(cpu->mem, _t28, cpu->r[9]);
         /* 020D4B60 */ Gambit_fn_020D48A4(cpu);
-        /* 020D4B64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020D4B64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020D4B68 */ _t29 = cpu->r[31] + 0x000001DCu;
         /* 020D4B68 */ cpu->r[12] = rbrew_read32(cpu->mem, _t29);
-        /* 020D4B6C */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4B6C */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4B6C */ _t31 = _t30 & 0x00000001u;
         /* 020D4B6C */ if (_t31) goto L_020D4B98; else goto L_020D4B70;
   L_020D4B70: ; // 0x20d4b70
@@ -20637,15 +20637,15 @@ void Gambit_fn_020D4A98(CPUState* cpu) {
   L_020D4BBC: ; // 0x20d4bbc
         /* 020D4BBC */ _t36 = cpu->r[31] + 0x00000236u;
         /* 020D4BBC */ cpu->r[0] = rbrew_read8(cpu->mem, _t36);
-        /* 020D4BC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020D4BC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020D4BC4 */ cpu->r[0] = 0x10020000u;
         /* 020D4BC8 */ cpu->r[0] = cpu->r[0] + 0xFFFF86F8u;
-        /* 020D4BCC */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4BCC */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4BCC */ _t38 = _t37 & 0x00000001u;
         /* 020D4BCC */ if (_t38) goto L_020D4BD0; else goto L_020D4C00;
   L_020D4BD0: ; // 0x20d4bd0
-        /* 020D4BD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020D4BD4 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4BD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020D4BD4 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4BD4 */ _t40 = _t39 & 0x00000001u;
         /* 020D4BD4 */ if (_t40) goto L_020D4C5C; else goto L_020D4BD8;
   L_020D4BD8: ; // 0x20d4bd8
@@ -20665,16 +20665,16 @@ void Gambit_fn_020D4A98(CPUState* cpu) {
         /* 020D4BF8 */ rbrew_write8(cpu->mem, _t45, (uint8_t)cpu->r[29]);
         /* 020D4BFC */ goto L_020D4C60;
   L_020D4C00: ; // 0x20d4c00
-        /* 020D4C00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020D4C04 */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4C00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020D4C04 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4C04 */ _t47 = _t46 & 0x00000001u;
         /* 020D4C04 */ if (_t47) goto L_020D4C08; else goto L_020D4C5C;
   L_020D4C08: ; // 0x20d4c08
         /* 020D4C08 */ _t48 = cpu->r[31] + 0x00000234u;
         /* 020D4C08 */ cpu->r[6] = rbrew_read8(cpu->mem, _t48);
-        /* 020D4C0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 020D4C0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 020D4C10 */ cpu->r[3] = cpu->r[31];
-        /* 020D4C14 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4C14 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4C14 */ _t50 = _t49 & 0x00000001u;
         /* 020D4C14 */ if (_t50) goto L_020D4C44; else goto L_020D4C18;
   L_020D4C18: ; // 0x20d4c18
@@ -20717,7 +20717,7 @@ void Gambit_fn_020D4A98(CPUState* cpu) {
         /* 020D4C6C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t62);
         /* 020D4C70 */ _t63 = cpu->r[1] + 0x0000003Cu;
         /* 020D4C70 */ cpu->r[31] = rbrew_read32(cpu->mem, _t63);
-        /* 020D4C74 */ _t64 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D4C74 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D4C74 */ _t65 = _t64 & 0x00000001u;
         /* 020D4C74 */ if (_t65) goto L_020D4C78; // else: addr-0 trap, fall-through
   L_020D4C78: ; // 0x20d4c78
@@ -20736,7 +20736,7 @@ void Gambit_fn_020D4C88(CPUState* cpu) {
         /* 020D4C88 */ cpu->r[0] = cpu->lr;
         /* 020D4C8C */ cpu->r[12] = 0x10020000u;
         /* 020D4C90 */ cpu->r[12] = cpu->r[12] + 0xFFFF8648u;
-        /* 020D4C94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 020D4C94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 020D4C98 */ _t0 = cpu->r[1] + 0x00000004u;
         /* 020D4C98 */ rbrew_write32(cpu->mem, _t0, cpu->r[0]);
         /* 020D4C9C */ cpu->r[0] = 0x10020000u;
@@ -20744,7 +20744,7 @@ void Gambit_fn_020D4C88(CPUState* cpu) {
         /* 020D4CA0 */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 020D4CA0 */ cpu->r[1] = _t1;
         /* 020D4CA4 */ cpu->r[0] = cpu->r[0] + 0xFFFF871Cu;
-        /* 020D4CA8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4CA8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4CA8 */ _t3 = _t2 & 0x00000001u;
         /* 020D4CA8 */ if (_t3) goto L_020D4CD0; else goto L_020D4CAC;
   L_020D4CAC: ; // 0x20d4cac
@@ -20786,7 +20786,7 @@ void Gambit_fn_020D4CA0(CPUState* cpu) {
         /* 020D4CA0 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 020D4CA0 */ cpu->r[1] = _t0;
         /* 020D4CA4 */ cpu->r[0] = cpu->r[0] + 0xFFFF871Cu;
-        /* 020D4CA8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4CA8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4CA8 */ _t2 = _t1 & 0x00000001u;
         /* 020D4CA8 */ if (_t2) goto L_020D4CD0; else goto L_020D4CAC;
   L_020D4CAC: ; // 0x20d4cac
@@ -20827,7 +20827,7 @@ void Gambit_fn_020D4CF4(CPUState* cpu) {
         /* 020D4CF4 */ cpu->r[0] = cpu->lr;
         /* 020D4CF8 */ cpu->r[9] = 0x10020000u;
         /* 020D4CFC */ cpu->r[9] = cpu->r[9] + 0xFFFF8648u;
-        /* 020D4D00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 020D4D00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 020D4D04 */ _t0 = cpu->r[1] + 0x00000004u;
         /* 020D4D04 */ rbrew_write32(cpu->mem, _t0, cpu->r[0]);
         /* 020D4D08 */ cpu->r[0] = 0x10020000u;
@@ -20835,7 +20835,7 @@ void Gambit_fn_020D4CF4(CPUState* cpu) {
         /* 020D4D0C */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 020D4D0C */ cpu->r[1] = _t1;
         /* 020D4D10 */ cpu->r[0] = cpu->r[0] + 0xFFFF8728u;
-        /* 020D4D14 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4D14 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4D14 */ _t3 = _t2 & 0x00000001u;
         /* 020D4D14 */ if (_t3) goto L_020D4D40; else goto L_020D4D18;
   L_020D4D18: ; // 0x20d4d18
@@ -20879,7 +20879,7 @@ void Gambit_fn_020D4D0C(CPUState* cpu) {
         /* 020D4D0C */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 020D4D0C */ cpu->r[1] = _t0;
         /* 020D4D10 */ cpu->r[0] = cpu->r[0] + 0xFFFF8728u;
-        /* 020D4D14 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4D14 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4D14 */ _t2 = _t1 & 0x00000001u;
         /* 020D4D14 */ if (_t2) goto L_020D4D40; else goto L_020D4D18;
   L_020D4D18: ; // 0x20d4d18
@@ -20927,13 +20927,13 @@ void Gambit_fn_020D4D68(CPUState* cpu) {
         /* 020D4D74 */ cpu->r[10] = cpu->r[10] + 0xFFFF8648u;
         /* 020D4D78 */ _t1 = cpu->r[1] + 0x0000001Cu;
         /* 020D4D78 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
-        /* 020D4D7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 020D4D7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 020D4D80 */ _t2 = cpu->r[1] + 0x00000024u;
         /* 020D4D80 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020D4D84 */ cpu->r[0] = 0x10020000u;
         /* 020D4D88 */ cpu->r[31] = cpu->r[3];
         /* 020D4D8C */ cpu->r[0] = cpu->r[0] + 0xFFFF8730u;
-        /* 020D4D90 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4D90 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4D90 */ _t4 = _t3 & 0x00000001u;
         /* 020D4D90 */ if (_t4) goto L_020D4DD8; else goto L_020D4D94;
   L_020D4D94: ; // 0x20d4d94
@@ -20995,13 +20995,13 @@ void Gambit_fn_020D4D6C(CPUState* cpu) {
         /* 020D4D74 */ cpu->r[10] = cpu->r[10] + 0xFFFF8648u;
         /* 020D4D78 */ _t1 = cpu->r[1] + 0x0000001Cu;
         /* 020D4D78 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
-        /* 020D4D7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 020D4D7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 020D4D80 */ _t2 = cpu->r[1] + 0x00000024u;
         /* 020D4D80 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 020D4D84 */ cpu->r[0] = 0x10020000u;
         /* 020D4D88 */ cpu->r[31] = cpu->r[3];
         /* 020D4D8C */ cpu->r[0] = cpu->r[0] + 0xFFFF8730u;
-        /* 020D4D90 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4D90 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4D90 */ _t4 = _t3 & 0x00000001u;
         /* 020D4D90 */ if (_t4) goto L_020D4DD8; else goto L_020D4D94;
   L_020D4D94: ; // 0x20d4d94
@@ -21075,9 +21075,9 @@ void Gambit_fn_020D4E0C(CPUState* cpu) {
         /* 020D4E34 */ cpu->r[0] = cpu->r[0] + 0xFFFF8648u;
         /* 020D4E38 */ _t5 = cpu->r[31] + 0x00000230u;
         /* 020D4E38 */ rbrew_write_f32(cpu->mem, _t5, cpu->f[1]);
-        /* 020D4E3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 020D4E3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 020D4E40 */ cpu->r[3] = cpu->r[31];
-        /* 020D4E44 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4E44 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4E44 */ _t7 = _t6 & 0x00000001u;
         /* 020D4E44 */ if (_t7) goto L_020D4E7C; else goto L_020D4E48;
   L_020D4E48: ; // 0x20d4e48
@@ -21143,9 +21143,9 @@ void Gambit_fn_020D4E10(CPUState* cpu) {
         /* 020D4E34 */ cpu->r[0] = cpu->r[0] + 0xFFFF8648u;
         /* 020D4E38 */ _t5 = cpu->r[31] + 0x00000230u;
         /* 020D4E38 */ rbrew_write_f32(cpu->mem, _t5, cpu->f[1]);
-        /* 020D4E3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 020D4E3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 020D4E40 */ cpu->r[3] = cpu->r[31];
-        /* 020D4E44 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D4E44 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D4E44 */ _t7 = _t6 & 0x00000001u;
         /* 020D4E44 */ if (_t7) goto L_020D4E7C; else goto L_020D4E48;
   L_020D4E48: ; // 0x20d4e48
@@ -21457,15 +21457,15 @@ void Gambit_fn_020D4FDC(CPUState* cpu) {
         /* 020D5020 */ cpu->r[12] = rbrew_read8(cpu->mem, _t7);
         /* 020D5024 */ _t8 = cpu->r[8] + 0x00000000u;
         /* 020D5024 */ cpu->r[9] = rbrew_read8(cpu->mem, _t8);
-        /* 020D5028 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
-        /* 020D502C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5028 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
+        /* 020D502C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D502C */ _t10 = _t9 & 0x00000001u;
         /* 020D502C */ if (_t10) goto L_020D506C; else goto L_020D5030;
   L_020D5030: ; // 0x20d5030
         /* 020D5030 */ _t11 = cpu->r[3] + 0x00000000u;
         /* 020D5030 */ cpu->r[0] = rbrew_read8(cpu->mem, _t11);
-        /* 020D5034 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 020D5038 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5034 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 020D5038 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5038 */ _t13 = _t12 & 0x00000001u;
         /* 020D5038 */ if (_t13) goto L_020D506C; else goto L_020D503C;
   L_020D503C: ; // 0x20d503c
@@ -21563,15 +21563,15 @@ void Gambit_fn_020D510C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D510C: ; // 0x20d510c
-        /* 020D510C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D5110 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D510C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D5110 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5110 */ _t1 = _t0 & 0x00000001u;
         /* 020D5110 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D5110 */ goto L_020D5114;
   L_020D5114: ; // 0x20d5114
         /* 020D5114 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D5114 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D5118 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5114 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D5118 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5118 */ _t3 = _t2 & 0x00000001u;
         /* 020D5118 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D5118 */ goto L_020D511C;
@@ -21590,8 +21590,8 @@ void Gambit_fn_020D510C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -21605,15 +21605,15 @@ void Gambit_fn_020D510C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -21641,15 +21641,15 @@ void Gambit_fn_020D5120(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D5120: ; // 0x20d5120
-        /* 020D5120 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D5124 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5120 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D5124 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5124 */ _t1 = _t0 & 0x00000001u;
         /* 020D5124 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D5124 */ goto L_020D5128;
   L_020D5128: ; // 0x20d5128
         /* 020D5128 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D5128 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D512C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5128 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D512C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D512C */ _t3 = _t2 & 0x00000001u;
         /* 020D512C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D512C */ goto L_020D5130;
@@ -21668,8 +21668,8 @@ void Gambit_fn_020D5120(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -21683,15 +21683,15 @@ void Gambit_fn_020D5120(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -21728,11 +21728,11 @@ void Gambit_fn_020D5134(CPUState* cpu) {
         /* 020D5140 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D5140 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D5144 */ cpu->r[30] = cpu->r[3];
-        /* 020D5144 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D5144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D5148 */ cpu->r[31] = cpu->r[4];
         /* 020D514C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D514C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D5150 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5150 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5150 */ _t5 = _t4 & 0x00000001u;
         /* 020D5150 */ if (_t5) goto L_020D5194; else goto L_020D5154;
   L_020D5154: ; // 0x20d5154
@@ -21752,8 +21752,8 @@ void Gambit_fn_020D5134(CPUState* cpu) {
         /* 020D517C */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D5180 */ Gambit_fn_02068798(cpu);
         /* 020D5184 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D5184 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D5188 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5184 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D5188 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5188 */ _t10 = _t9 & 0x00000001u;
         /* 020D5188 */ if (_t10) goto L_020D5194; else goto L_020D518C;
   L_020D518C: ; // 0x20d518c
@@ -21784,11 +21784,11 @@ void Gambit_fn_020D5138(CPUState* cpu) {
         /* 020D5140 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D5140 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D5144 */ cpu->r[30] = cpu->r[3];
-        /* 020D5144 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D5144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D5148 */ cpu->r[31] = cpu->r[4];
         /* 020D514C */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D514C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D5150 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5150 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5150 */ _t5 = _t4 & 0x00000001u;
         /* 020D5150 */ if (_t5) goto L_020D5194; else goto L_020D5154;
   L_020D5154: ; // 0x20d5154
@@ -21808,8 +21808,8 @@ void Gambit_fn_020D5138(CPUState* cpu) {
         /* 020D517C */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D5180 */ Gambit_fn_02068798(cpu);
         /* 020D5184 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D5184 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D5188 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5184 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D5188 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5188 */ _t10 = _t9 & 0x00000001u;
         /* 020D5188 */ if (_t10) goto L_020D5194; else goto L_020D518C;
   L_020D518C: ; // 0x20d518c
@@ -21864,15 +21864,15 @@ void Gambit_fn_020D51C4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D51C4: ; // 0x20d51c4
-        /* 020D51C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D51C8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D51C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D51C8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D51C8 */ _t1 = _t0 & 0x00000001u;
         /* 020D51C8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D51C8 */ goto L_020D51CC;
   L_020D51CC: ; // 0x20d51cc
         /* 020D51CC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D51CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D51D0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D51CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D51D0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D51D0 */ _t3 = _t2 & 0x00000001u;
         /* 020D51D0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D51D0 */ goto L_020D51D4;
@@ -21891,8 +21891,8 @@ void Gambit_fn_020D51C4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -21906,15 +21906,15 @@ void Gambit_fn_020D51C4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -21960,15 +21960,15 @@ void Gambit_fn_020D51F4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D51F4: ; // 0x20d51f4
-        /* 020D51F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D51F8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D51F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D51F8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D51F8 */ _t1 = _t0 & 0x00000001u;
         /* 020D51F8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D51F8 */ goto L_020D51FC;
   L_020D51FC: ; // 0x20d51fc
         /* 020D51FC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D51FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D5200 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D51FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D5200 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5200 */ _t3 = _t2 & 0x00000001u;
         /* 020D5200 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D5200 */ goto L_020D5204;
@@ -21987,8 +21987,8 @@ void Gambit_fn_020D51F4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -22002,15 +22002,15 @@ void Gambit_fn_020D51F4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -22109,9 +22109,9 @@ void Gambit_fn_020D5240(CPUState* cpu) {
         /* 020D5244 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 020D5244 */ cpu->r[9] = _t0;
         /* 020D5248 */ cpu->r[12] = 0x101D0000u;
-        /* 020D524C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 020D524C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 020D5250 */ cpu->r[12] = cpu->r[12] + 0xFFFFED90u;
-        /* 020D5254 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5254 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5254 */ _t2 = _t1 & 0x00000001u;
         /* 020D5254 */ if (_t2) goto L_020D5258; else goto L_020D526C;
   L_020D5258: ; // 0x20d5258
@@ -22123,8 +22123,8 @@ void Gambit_fn_020D5240(CPUState* cpu) {
         /* 020D5268 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 020D5268 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_020D526C: ; // 0x20d526c
-        /* 020D526C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 020D5270 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D526C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 020D5270 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5270 */ _t6 = _t5 & 0x00000001u;
         /* 020D5270 */ if (_t6) goto L_020D5274; else goto L_020D527C;
   L_020D5274: ; // 0x20d5274
@@ -22136,9 +22136,9 @@ void Gambit_fn_020D5240(CPUState* cpu) {
         /* 020D5280 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 020D5280 */ cpu->r[7] = _t7;
         /* 020D5284 */ cpu->r[11] = 0x101D0000u;
-        /* 020D5288 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020D5288 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020D528C */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 020D5290 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5290 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5290 */ _t9 = _t8 & 0x00000001u;
         /* 020D5290 */ if (_t9) goto L_020D5294; else goto L_020D52A8;
   L_020D5294: ; // 0x20d5294
@@ -22230,11 +22230,11 @@ void Gambit_fn_020D52E8(CPUState* cpu) {
         /* 020D5A74 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D5A74 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D5A78 */ cpu->r[30] = cpu->r[3];
-        /* 020D5A78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D5A78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D5A7C */ cpu->r[31] = cpu->r[4];
         /* 020D5A80 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D5A80 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D5A84 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5A84 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5A84 */ _t5 = _t4 & 0x00000001u;
         /* 020D5A84 */ if (_t5) goto L_020D5AC8; else goto L_020D5A88;
   L_020D5A88: ; // 0x20d5a88
@@ -22254,8 +22254,8 @@ void Gambit_fn_020D52E8(CPUState* cpu) {
         /* 020D5AB0 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D5AB4 */ Gambit_fn_02068798(cpu);
         /* 020D5AB8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D5AB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D5ABC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5AB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D5ABC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5ABC */ _t10 = _t9 & 0x00000001u;
         /* 020D5ABC */ if (_t10) goto L_020D5AC8; else goto L_020D5AC0;
   L_020D5AC0: ; // 0x20d5ac0
@@ -22283,8 +22283,8 @@ void Gambit_fn_020D52F0(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -22338,21 +22338,21 @@ void Gambit_fn_020D5308(CPUState* cpu) {
         /* 020D5314 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D5318 */ cpu->r[30] = cpu->r[5];
         /* 020D531C */ cpu->r[31] = cpu->r[3];
-        /* 020D531C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020D531C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020D5320 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D5320 */ rbrew_write32(cpu->mem, _t3, cpu->r[29]);
         /* 020D5324 */ _t4 = cpu->r[1] + 0x00000024u;
         /* 020D5324 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 020D5328 */ cpu->r[29] = cpu->r[4];
-        /* 020D532C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D532C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D532C */ _t6 = _t5 & 0x00000001u;
         /* 020D532C */ if (_t6) goto L_020D5330; else goto L_020D5340;
   L_020D5330: ; // 0x20d5330
         /* 020D5330 */ cpu->r[3] = 0x000001ECu;
         /* 020D5334 */ Gambit_fn_02801A78(cpu);
         /* 020D5338 */ cpu->r[31] = cpu->r[3];
-        /* 020D5338 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D533C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5338 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D533C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D533C */ _t8 = _t7 & 0x00000001u;
         /* 020D533C */ if (_t8) goto L_020D541C; else goto L_020D5340;
   L_020D5340: ; // 0x20d5340
@@ -22386,17 +22386,17 @@ void Gambit_fn_020D5308(CPUState* cpu) {
         /* 020D5394 */ _t15 = cpu->r[31] + 0x0000000Cu;
         /* 020D5394 */ rbrew_write32(cpu->mem, _t15, cpu->r[0]);
         /* 020D5398 */ cpu->r[3] = cpu->r[31] + 0x000001E4u;
-        /* 020D5398 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 020D5398 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 020D539C */ _t16 = cpu->r[31] + 0x00000000u;
         /* 020D539C */ rbrew_write32(cpu->mem, _t16, cpu->r[11]);
-        /* 020D53A0 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D53A0 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D53A0 */ _t18 = _t17 & 0x00000001u;
         /* 020D53A0 */ if (_t18) goto L_020D53A4; else goto L_020D53B4;
   L_020D53A4: ; // 0x20d53a4
         /* 020D53A4 */ cpu->r[3] = 0x00000008u;
         /* 020D53A8 */ Gambit_fn_02801A78(cpu);
-        /* 020D53AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D53B0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D53AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D53B0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D53B0 */ _t20 = _t19 & 0x00000001u;
         /* 020D53B0 */ if (_t20) goto L_020D53BC; else goto L_020D53B4;
   L_020D53B4: ; // 0x20d53b4
@@ -22417,8 +22417,8 @@ void Gambit_fn_020D5308(CPUState* cpu) {
         /* 020D53D4 */ cpu->r[4] = 0x00000008u;
         /* 020D53D8 */ cpu->r[5] = 0x00000004u;
         /* 020D53DC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020D53E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D53E4 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D53E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D53E4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D53E4 */ _t27 = _t26 & 0x00000001u;
         /* 020D53E4 */ if (_t27) goto L_020D53F4; else goto L_020D53E8;
   L_020D53E8: ; // 0x20d53e8
@@ -22430,8 +22430,8 @@ void Gambit_fn_020D5308(CPUState* cpu) {
   L_020D53F4: ; // 0x20d53f4
         /* 020D53F4 */ _t30 = cpu->r[31] + 0x000001E4u;
         /* 020D53F4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t30);
-        /* 020D53F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020D53FC */ _t31 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D53F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020D53FC */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D53FC */ _t32 = _t31 & 0x00000001u;
         /* 020D53FC */ if (_t32) goto L_020D5400; else goto L_020D541C;
   L_020D5400: ; // 0x20d5400
@@ -22478,21 +22478,21 @@ void Gambit_fn_020D530C(CPUState* cpu) {
         /* 020D5314 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D5318 */ cpu->r[30] = cpu->r[5];
         /* 020D531C */ cpu->r[31] = cpu->r[3];
-        /* 020D531C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 020D531C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 020D5320 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D5320 */ rbrew_write32(cpu->mem, _t3, cpu->r[29]);
         /* 020D5324 */ _t4 = cpu->r[1] + 0x00000024u;
         /* 020D5324 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 020D5328 */ cpu->r[29] = cpu->r[4];
-        /* 020D532C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D532C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D532C */ _t6 = _t5 & 0x00000001u;
         /* 020D532C */ if (_t6) goto L_020D5330; else goto L_020D5340;
   L_020D5330: ; // 0x20d5330
         /* 020D5330 */ cpu->r[3] = 0x000001ECu;
         /* 020D5334 */ Gambit_fn_02801A78(cpu);
         /* 020D5338 */ cpu->r[31] = cpu->r[3];
-        /* 020D5338 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D533C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5338 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D533C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D533C */ _t8 = _t7 & 0x00000001u;
         /* 020D533C */ if (_t8) goto L_020D541C; else goto L_020D5340;
   L_020D5340: ; // 0x20d5340
@@ -22526,17 +22526,17 @@ void Gambit_fn_020D530C(CPUState* cpu) {
         /* 020D5394 */ _t15 = cpu->r[31] + 0x0000000Cu;
         /* 020D5394 */ rbrew_write32(cpu->mem, _t15, cpu->r[0]);
         /* 020D5398 */ cpu->r[3] = cpu->r[31] + 0x000001E4u;
-        /* 020D5398 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 020D5398 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 020D539C */ _t16 = cpu->r[31] + 0x00000000u;
         /* 020D539C */ rbrew_write32(cpu->mem, _t16, cpu->r[11]);
-        /* 020D53A0 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D53A0 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D53A0 */ _t18 = _t17 & 0x00000001u;
         /* 020D53A0 */ if (_t18) goto L_020D53A4; else goto L_020D53B4;
   L_020D53A4: ; // 0x20d53a4
         /* 020D53A4 */ cpu->r[3] = 0x00000008u;
         /* 020D53A8 */ Gambit_fn_02801A78(cpu);
-        /* 020D53AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D53B0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D53AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D53B0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D53B0 */ _t20 = _t19 & 0x00000001u;
         /* 020D53B0 */ if (_t20) goto L_020D53BC; else goto L_020D53B4;
   L_020D53B4: ; // 0x20d53b4
@@ -22557,8 +22557,8 @@ void Gambit_fn_020D530C(CPUState* cpu) {
         /* 020D53D4 */ cpu->r[4] = 0x00000008u;
         /* 020D53D8 */ cpu->r[5] = 0x00000004u;
         /* 020D53DC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020D53E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D53E4 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D53E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D53E4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D53E4 */ _t27 = _t26 & 0x00000001u;
         /* 020D53E4 */ if (_t27) goto L_020D53F4; else goto L_020D53E8;
   L_020D53E8: ; // 0x20d53e8
@@ -22570,8 +22570,8 @@ void Gambit_fn_020D530C(CPUState* cpu) {
   L_020D53F4: ; // 0x20d53f4
         /* 020D53F4 */ _t30 = cpu->r[31] + 0x000001E4u;
         /* 020D53F4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t30);
-        /* 020D53F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020D53FC */ _t31 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D53F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020D53FC */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D53FC */ _t32 = _t31 & 0x00000001u;
         /* 020D53FC */ if (_t32) goto L_020D5400; else goto L_020D541C;
   L_020D5400: ; // 0x20d5400
@@ -22616,7 +22616,7 @@ void Gambit_fn_020D543C(CPUState* cpu) {
         /* 020D5444 */ _t1 = cpu->r[1] + 0x00000024u;
         /* 020D5444 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 020D5448 */ cpu->r[31] = 0x10020000u;
-        /* 020D544C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 020D544C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 020D5450 */ _t2 = cpu->r[1] + 0x00000020u;
         /* 020D5450 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D5454 */ cpu->r[30] = 0x10020000u;
@@ -22629,7 +22629,7 @@ void Gambit_fn_020D543C(CPUState* cpu) {
         /* 020D5468 */ cpu->r[0] = 0x10020000u;
         /* 020D546C */ cpu->r[29] = cpu->r[3];
         /* 020D5470 */ cpu->r[0] = cpu->r[0] + 0xFFFF8A38u;
-        /* 020D5474 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5474 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5474 */ _t6 = _t5 & 0x00000001u;
         /* 020D5474 */ if (_t6) goto L_020D54CC; else goto L_020D5478;
   L_020D5478: ; // 0x20d5478
@@ -22708,7 +22708,7 @@ void Gambit_fn_020D5440(CPUState* cpu) {
         /* 020D5444 */ _t1 = cpu->r[1] + 0x00000024u;
         /* 020D5444 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 020D5448 */ cpu->r[31] = 0x10020000u;
-        /* 020D544C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 020D544C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 020D5450 */ _t2 = cpu->r[1] + 0x00000020u;
         /* 020D5450 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D5454 */ cpu->r[30] = 0x10020000u;
@@ -22721,7 +22721,7 @@ void Gambit_fn_020D5440(CPUState* cpu) {
         /* 020D5468 */ cpu->r[0] = 0x10020000u;
         /* 020D546C */ cpu->r[29] = cpu->r[3];
         /* 020D5470 */ cpu->r[0] = cpu->r[0] + 0xFFFF8A38u;
-        /* 020D5474 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5474 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5474 */ _t6 = _t5 & 0x00000001u;
         /* 020D5474 */ if (_t6) goto L_020D54CC; else goto L_020D5478;
   L_020D5478: ; // 0x20d5478
@@ -22804,13 +22804,13 @@ void Gambit_fn_020D5518(CPUState* cpu) {
         /* 020D5528 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 020D5528 */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
         /* 020D552C */ cpu->r[31] = cpu->r[5];
-        /* 020D5530 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000008u);
+        /* 020D5530 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000008u));
         /* 020D5534 */ _t3 = cpu->r[1] + 0x0000000Cu;
         /* 020D5534 */ rbrew_write32(cpu->mem, _t3, cpu->r[29]);
         /* 020D5538 */ _t4 = cpu->r[1] + 0x0000001Cu;
         /* 020D5538 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 020D553C */ cpu->r[29] = cpu->r[3];
-        /* 020D5540 */ _t5 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D5540 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D5540 */ _t6 = _t5 & 0x00000001u;
         /* 020D5540 */ if (_t6) goto L_020D5544; else goto L_020D5548;
   L_020D5544: ; // 0x20d5544
@@ -22818,17 +22818,17 @@ void Gambit_fn_020D5518(CPUState* cpu) {
   L_020D5548: ; // 0x20d5548
         /* 020D5548 */ _t7 = cpu->r[29] + 0x000001E8u;
         /* 020D5548 */ cpu->r[11] = rbrew_read32(cpu->mem, _t7);
-        /* 020D554C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000063u);
+        /* 020D554C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000063u));
         /* 020D5550 */ _t8 = cpu->r[11] + 0x00000000u;
         /* 020D5550 */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
-        /* 020D5554 */ _t9 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D5554 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D5554 */ _t10 = _t9 & 0x00000001u;
         /* 020D5554 */ if (_t10) goto L_020D5558; else goto L_020D555C;
   L_020D5558: ; // 0x20d5558
         /* 020D5558 */ cpu->r[31] = 0x00000063u;
   L_020D555C: ; // 0x20d555c
-        /* 020D555C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D5560 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D555C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D5560 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5560 */ _t12 = _t11 & 0x00000001u;
         /* 020D5560 */ if (_t12) goto L_020D5570; else goto L_020D5564;
   L_020D5564: ; // 0x20d5564
@@ -22837,14 +22837,14 @@ void Gambit_fn_020D5518(CPUState* cpu) {
         /* 020D5568 */ cpu->r[4] = cpu->r[30];
         /* 020D556C */ Gambit_fn_020A9A14(cpu);
   L_020D5570: ; // 0x20d5570
-        /* 020D5570 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000008u);
+        /* 020D5570 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000008u));
         /* 020D5574 */ cpu->r[0] = 0x00000000u;
-        /* 020D5578 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5578 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5578 */ _t15 = _t14 & 0x00000001u;
         /* 020D5578 */ if (_t15) goto L_020D557C; else goto L_020D5588;
   L_020D557C: ; // 0x20d557c
-        /* 020D557C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000063u);
-        /* 020D5580 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D557C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000063u));
+        /* 020D5580 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5580 */ _t17 = _t16 & 0x00000001u;
         /* 020D5580 */ if (_t17) goto L_020D5584; else goto L_020D5588;
   L_020D5584: ; // 0x20d5584
@@ -22880,13 +22880,13 @@ void Gambit_fn_020D551C(CPUState* cpu) {
         /* 020D5528 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 020D5528 */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
         /* 020D552C */ cpu->r[31] = cpu->r[5];
-        /* 020D5530 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000008u);
+        /* 020D5530 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000008u));
         /* 020D5534 */ _t3 = cpu->r[1] + 0x0000000Cu;
         /* 020D5534 */ rbrew_write32(cpu->mem, _t3, cpu->r[29]);
         /* 020D5538 */ _t4 = cpu->r[1] + 0x0000001Cu;
         /* 020D5538 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 020D553C */ cpu->r[29] = cpu->r[3];
-        /* 020D5540 */ _t5 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D5540 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D5540 */ _t6 = _t5 & 0x00000001u;
         /* 020D5540 */ if (_t6) goto L_020D5544; else goto L_020D5548;
   L_020D5544: ; // 0x20d5544
@@ -22894,17 +22894,17 @@ void Gambit_fn_020D551C(CPUState* cpu) {
   L_020D5548: ; // 0x20d5548
         /* 020D5548 */ _t7 = cpu->r[29] + 0x000001E8u;
         /* 020D5548 */ cpu->r[11] = rbrew_read32(cpu->mem, _t7);
-        /* 020D554C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000063u);
+        /* 020D554C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000063u));
         /* 020D5550 */ _t8 = cpu->r[11] + 0x00000000u;
         /* 020D5550 */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
-        /* 020D5554 */ _t9 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D5554 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D5554 */ _t10 = _t9 & 0x00000001u;
         /* 020D5554 */ if (_t10) goto L_020D5558; else goto L_020D555C;
   L_020D5558: ; // 0x20d5558
         /* 020D5558 */ cpu->r[31] = 0x00000063u;
   L_020D555C: ; // 0x20d555c
-        /* 020D555C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D5560 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D555C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D5560 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5560 */ _t12 = _t11 & 0x00000001u;
         /* 020D5560 */ if (_t12) goto L_020D5570; else goto L_020D5564;
   L_020D5564: ; // 0x20d5564
@@ -22913,14 +22913,14 @@ void Gambit_fn_020D551C(CPUState* cpu) {
         /* 020D5568 */ cpu->r[4] = cpu->r[30];
         /* 020D556C */ Gambit_fn_020A9A14(cpu);
   L_020D5570: ; // 0x20d5570
-        /* 020D5570 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000008u);
+        /* 020D5570 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000008u));
         /* 020D5574 */ cpu->r[0] = 0x00000000u;
-        /* 020D5578 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5578 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5578 */ _t15 = _t14 & 0x00000001u;
         /* 020D5578 */ if (_t15) goto L_020D557C; else goto L_020D5588;
   L_020D557C: ; // 0x20d557c
-        /* 020D557C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000063u);
-        /* 020D5580 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D557C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000063u));
+        /* 020D5580 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5580 */ _t17 = _t16 & 0x00000001u;
         /* 020D5580 */ if (_t17) goto L_020D5584; else goto L_020D5588;
   L_020D5584: ; // 0x20d5584
@@ -23047,24 +23047,24 @@ void Gambit_fn_020D5618(CPUState* cpu) {
         /* 020A7FC4 */ _t6 = cpu->r[1] + 0x0000000Cu;
         /* 020A7FC4 */ rbrew_write32(cpu->mem, _t6, cpu->r[5]);
         /* 020A7FC8 */ Gambit_fn_020A7E08(cpu);
-        /* 020A7FCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020A7FD0 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020A7FCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020A7FD0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020A7FD0 */ _t8 = _t7 & 0x00000001u;
         /* 020A7FD0 */ if (_t8) goto L_020A8030; else goto L_020A7FD4;
   L_020A7FD4: ; // 0x20a7fd4
         /* 020A7FD4 */ _t9 = cpu->r[29] + 0x00000008u;
         /* 020A7FD4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
         /* 020A7FD8 */ cpu->r[30] = 0x00000000u;
-        /* 020A7FDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
-        /* 020A7FE0 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020A7FDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
+        /* 020A7FE0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020A7FE0 */ _t11 = _t10 & 0x00000001u;
         /* 020A7FE0 */ if (_t11) goto L_020A7FE4; else goto L_020A8028;
   L_020A7FE4: ; // 0x20a7fe4
         /* 020A7FE4 */ cpu->r[31] = 0x00000000u;
   L_020A7FE8: ; // 0x20a7fe8
-        /* 020A7FE8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
+        /* 020A7FE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
         /* 020A7FEC */ cpu->r[3] = 0x00000000u;
-        /* 020A7FF0 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020A7FF0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020A7FF0 */ _t13 = _t12 & 0x00000001u;
         /* 020A7FF0 */ if (_t13) goto L_020A7FF4; else goto L_020A7FFC;
   L_020A7FF4: ; // 0x20a7ff4
@@ -23077,7 +23077,7 @@ void Gambit_fn_020D5618(CPUState* cpu) {
         /* 020A8000 */ cpu->r[6] = cpu->r[1] + 0x00000008u;
         /* 020A8004 */ cpu->r[5] = 0x00000002u;
         /* 020A8008 */ cpu->r[4] = cpu->r[29] + 0x00000054u;
-        /* 020A800C */ _t16 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020A800C */ _t16 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020A800C */ _t17 = _t16 & 0x00000001u;
         /* 020A800C */ if (_t17) goto L_020A8010; // else: addr-0 trap, fall-through
   L_020A8010: ; // 0x20a8010
@@ -23085,9 +23085,9 @@ void Gambit_fn_020D5618(CPUState* cpu) {
         /* 020A8014 */ _t18 = cpu->r[29] + 0x00000008u;
         /* 020A8014 */ cpu->r[0] = rbrew_read32(cpu->mem, _t18);
         /* 020A8018 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020A801C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 020A801C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 020A8020 */ cpu->r[31] = cpu->r[31] + 0x00000004u;
-        /* 020A8024 */ _t19 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020A8024 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020A8024 */ _t20 = _t19 & 0x00000001u;
         /* 020A8024 */ if (_t20) goto L_020A7FE8; else goto L_020A8028;
   L_020A8028: ; // 0x20a8028
@@ -23106,42 +23106,42 @@ void Gambit_fn_020D5618(CPUState* cpu) {
         /* 020A8044 */ cpu->r[1] = cpu->r[1] + 0x00000020u;
         /* 020A8048 */ return;
   L_020D5618: ; // 0x20d5618
-        /* 020D5618 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000008u);
+        /* 020D5618 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000008u));
         /* 020D561C */ cpu->r[0] = cpu->r[5];
-        /* 020D5620 */ _t25 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D5620 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D5620 */ _t26 = _t25 & 0x00000001u;
         /* 020D5620 */ if (_t26) goto L_020D5624; else goto L_020D5628;
   L_020D5624: ; // 0x20d5624
         /* 020D5624 */ cpu->r[4] = 0x00000008u;
   L_020D5628: ; // 0x20d5628
-        /* 020D5628 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000063u);
-        /* 020D562C */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D5628 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000063u));
+        /* 020D562C */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D562C */ _t28 = _t27 & 0x00000001u;
         /* 020D562C */ if (_t28) goto L_020D5630; else goto L_020D5634;
   L_020D5630: ; // 0x20d5630
         /* 020D5630 */ cpu->r[0] = 0x00000063u;
   L_020D5634: ; // 0x20d5634
-        /* 020D5634 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000008u);
+        /* 020D5634 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000008u));
         /* 020D5638 */ cpu->r[5] = 0x00000000u;
         /* 020D563C */ _t29 = cpu->r[3] + 0x000001E4u;
         /* 020D563C */ cpu->r[11] = rbrew_read32(cpu->mem, _t29);
-        /* 020D5640 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D5640 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D5640 */ _t31 = _t30 & 0x00000001u;
         /* 020D5640 */ if (_t31) goto L_020D5644; else goto L_020D5648;
   L_020D5644: ; // 0x20d5644
         /* 020D5644 */ cpu->r[5] = 0x00000064u;
   L_020D5648: ; // 0x20d5648
-        /* 020D5648 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000001u);
+        /* 020D5648 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000001u));
         /* 020D564C */ _t32 = cpu->r[3] + 0x000001E8u;
         /* 020D564C */ cpu->r[12] = rbrew_read32(cpu->mem, _t32);
-        /* 020D5650 */ _t33 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D5650 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D5650 */ _t34 = _t33 & 0x00000001u;
         /* 020D5650 */ if (_t34) goto L_020D5654; else goto L_020D5664;
   L_020D5654: ; // 0x20d5654
         /* 020D5654 */ _t35 = cpu->r[12] + 0x00000004u;
         /* 020D5654 */ cpu->r[9] = rbrew_read32(cpu->mem, _t35);
-        /* 020D5658 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 020D565C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5658 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 020D565C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D565C */ _t37 = _t36 & 0x00000001u;
         /* 020D565C */ if (_t37) goto L_020D5660; else goto L_020D5670;
   L_020D5660: ; // 0x20d5660
@@ -23149,14 +23149,14 @@ void Gambit_fn_020D5618(CPUState* cpu) {
   L_020D5664: ; // 0x20d5664
         /* 020D5664 */ _t38 = cpu->r[12] + 0x00000000u;
         /* 020D5664 */ cpu->r[9] = rbrew_read32(cpu->mem, _t38);
-        /* 020D5668 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 020D566C */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5668 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 020D566C */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D566C */ _t40 = _t39 & 0x00000001u;
         /* 020D566C */ if (_t40) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D566C */ goto L_020D5670;
   L_020D5670: ; // 0x20d5670
-        /* 020D5670 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000001u);
-        /* 020D5674 */ _t41 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D5670 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000001u));
+        /* 020D5674 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D5674 */ _t42 = _t41 & 0x00000001u;
         /* 020D5674 */ if (_t42) goto L_020D5678; else goto L_020D567C;
   L_020D5678: ; // 0x20d5678
@@ -23402,7 +23402,7 @@ void Gambit_fn_020D5778(CPUState* cpu) {
         /* 020D57E0 */ rbrew_write32(cpu->mem, _t7, cpu->r[30]);
         /* 020D57E4 */ _t8 = cpu->r[30] + 0x00000000u;
         /* 020D57E4 */ rbrew_write8(cpu->mem, _t8, (uint8_t)cpu->r[31]);
-        /* 020D57E8 */ _t9 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020D57E8 */ _t9 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020D57E8 */ _t10 = _t9 & 0x00000001u;
         /* 020D57E8 */ if (_t10) goto L_020D57EC; // else: addr-0 trap, fall-through
   L_020D57EC: ; // 0x20d57ec
@@ -23413,8 +23413,8 @@ void Gambit_fn_020D5778(CPUState* cpu) {
         /* 020D57FC */ _t11 = cpu->r[1] + 0x00000008u;
         /* 020D57FC */ rbrew_write32(cpu->mem, _t11, cpu->r[18]);
         /* 020D5800 */ Gambit_fn_026D6F78(cpu);
-        /* 020D5804 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D5808 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5804 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D5808 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5808 */ _t13 = _t12 & 0x00000001u;
         /* 020D5808 */ if (_t13) goto L_020D5874; else goto L_020D580C;
   L_020D580C: ; // 0x20d580c
@@ -23436,17 +23436,17 @@ void Gambit_fn_020D5778(CPUState* cpu) {
         /* 020D5834 */ Gambit_fn_027EC044(cpu);
         /* 020D5838 */ _t19 = cpu->r[3] + 0x000000A8u;
         /* 020D5838 */ cpu->r[0] = rbrew_read32(cpu->mem, _t19);
-        /* 020D583C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D5840 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D583C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D5840 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5840 */ _t21 = _t20 & 0x00000001u;
         /* 020D5840 */ if (_t21) goto L_020D5874; else goto L_020D5844;
   L_020D5844: ; // 0x20d5844
         /* 020D5844 */ _t22 = cpu->r[25] + 0x000001E4u;
         /* 020D5844 */ cpu->r[9] = rbrew_read32(cpu->mem, _t22);
-        /* 020D5848 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], cpu->r[9]);
+        /* 020D5848 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], cpu->r[9]));
         /* 020D584C */ _t23 = cpu->r[25] + 0x000001E8u;
         /* 020D584C */ cpu->r[29] = rbrew_read32(cpu->mem, _t23);
-        /* 020D5850 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D5850 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D5850 */ _t25 = _t24 & 0x00000001u;
         /* 020D5850 */ if (_t25) goto L_020D5854; else goto L_020D5858;
   L_020D5854: ; // 0x20d5854
@@ -23464,10 +23464,10 @@ void Gambit_fn_020D5778(CPUState* cpu) {
         /* 020D5870 */ rbrew_write32(cpu->mem, _t28, cpu->r[3]);
   L_020D5874: ; // 0x20d5874
         /* 020D5874 */ cpu->r[27] = cpu->r[27] + 0xFFFFFFFFu;
-        /* 020D5874 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020D5874 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020D5878 */ cpu->r[23] = cpu->r[23] + 0x00000001u;
         /* 020D587C */ cpu->r[28] = cpu->r[28] + 0x00000004u;
-        /* 020D5880 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5880 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5880 */ _t30 = _t29 & 0x00000001u;
         /* 020D5880 */ if (_t30) goto L_020D5884; else goto L_020D57C8;
   L_020D5884: ; // 0x20d5884
@@ -23510,8 +23510,8 @@ void Gambit_fn_020D5898(CPUState* cpu) {
         /* 020D58D8 */ _t6 = cpu->r[1] + 0x0000001Cu;
         /* 020D58D8 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 020D58DC */ Gambit_fn_026D6F78(cpu);
-        /* 020D58E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D58E4 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D58E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D58E4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D58E4 */ _t8 = _t7 & 0x00000001u;
         /* 020D58E4 */ if (_t8) goto L_020D59B4; else goto L_020D58E8;
   L_020D58E8: ; // 0x20d58e8
@@ -23547,8 +23547,8 @@ void Gambit_fn_020D5898(CPUState* cpu) {
         /* 020D5934 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020D5938 */ _t19 = cpu->r[1] + 0x00000014u;
         /* 020D5938 */ cpu->r[0] = rbrew_read32(cpu->mem, _t19);
-        /* 020D593C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 020D5940 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D593C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 020D5940 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5940 */ _t21 = _t20 & 0x00000001u;
         /* 020D5940 */ if (_t21) goto L_020D5994; else goto L_020D5944;
   L_020D5944: ; // 0x20d5944
@@ -23569,13 +23569,13 @@ void Gambit_fn_020D5898(CPUState* cpu) {
         /* 020D5968 */ _t26 = cpu->r[11] + 0x00000001u;
         /* 020D5968 */ cpu->r[9] = rbrew_read8(cpu->mem, _t26);
         /* 020D5968 */ cpu->r[11] = _t26;
-        /* 020D596C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[9]);
-        /* 020D5970 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D596C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[9]));
+        /* 020D5970 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5970 */ _t28 = _t27 & 0x00000001u;
         /* 020D5970 */ if (_t28) goto L_020D5974; else goto L_020D59B4;
   L_020D5974: ; // 0x20d5974
-        /* 020D5974 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 020D5978 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 020D5978 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5978 */ _t30 = _t29 & 0x00000001u;
         /* 020D5978 */ if (_t30) goto L_020D5994; else goto L_020D597C;
   L_020D597C: ; // 0x20d597c
@@ -23588,8 +23588,8 @@ void Gambit_fn_020D5898(CPUState* cpu) {
   L_020D5984: ; // 0x20d5984
         /* 020D5984 */ _t34 = cpu->r[30] + 0x000001E0u;
         /* 020D5984 */ cpu->r[8] = rbrew_read32(cpu->mem, _t34);
-        /* 020D5988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000001u);
-        /* 020D598C */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000001u));
+        /* 020D598C */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D598C */ _t36 = _t35 & 0x00000001u;
         /* 020D598C */ if (_t36) goto L_020D5990; else goto L_020D59D0;
   L_020D5990: ; // 0x20d5990
@@ -23608,8 +23608,8 @@ void Gambit_fn_020D5898(CPUState* cpu) {
   L_020D59B4: ; // 0x20d59b4
         /* 020D59B4 */ _t39 = cpu->r[30] + 0x000001E0u;
         /* 020D59B4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t39);
-        /* 020D59B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000001u);
-        /* 020D59BC */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D59B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000001u));
+        /* 020D59BC */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D59BC */ _t41 = _t40 & 0x00000001u;
         /* 020D59BC */ if (_t41) goto L_020D59C0; else goto L_020D59D0;
   L_020D59C0: ; // 0x20d59c0
@@ -23659,8 +23659,8 @@ void Gambit_fn_020D589C(CPUState* cpu) {
         /* 020D58D8 */ _t6 = cpu->r[1] + 0x0000001Cu;
         /* 020D58D8 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 020D58DC */ Gambit_fn_026D6F78(cpu);
-        /* 020D58E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D58E4 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D58E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D58E4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D58E4 */ _t8 = _t7 & 0x00000001u;
         /* 020D58E4 */ if (_t8) goto L_020D59B4; else goto L_020D58E8;
   L_020D58E8: ; // 0x20d58e8
@@ -23696,8 +23696,8 @@ void Gambit_fn_020D589C(CPUState* cpu) {
         /* 020D5934 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020D5938 */ _t19 = cpu->r[1] + 0x00000014u;
         /* 020D5938 */ cpu->r[0] = rbrew_read32(cpu->mem, _t19);
-        /* 020D593C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 020D5940 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D593C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 020D5940 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5940 */ _t21 = _t20 & 0x00000001u;
         /* 020D5940 */ if (_t21) goto L_020D5994; else goto L_020D5944;
   L_020D5944: ; // 0x20d5944
@@ -23718,13 +23718,13 @@ void Gambit_fn_020D589C(CPUState* cpu) {
         /* 020D5968 */ _t26 = cpu->r[11] + 0x00000001u;
         /* 020D5968 */ cpu->r[9] = rbrew_read8(cpu->mem, _t26);
         /* 020D5968 */ cpu->r[11] = _t26;
-        /* 020D596C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[9]);
-        /* 020D5970 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D596C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[9]));
+        /* 020D5970 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5970 */ _t28 = _t27 & 0x00000001u;
         /* 020D5970 */ if (_t28) goto L_020D5974; else goto L_020D59B4;
   L_020D5974: ; // 0x20d5974
-        /* 020D5974 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 020D5978 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 020D5978 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5978 */ _t30 = _t29 & 0x00000001u;
         /* 020D5978 */ if (_t30) goto L_020D5994; else goto L_020D597C;
   L_020D597C: ; // 0x20d597c
@@ -23737,8 +23737,8 @@ void Gambit_fn_020D589C(CPUState* cpu) {
   L_020D5984: ; // 0x20d5984
         /* 020D5984 */ _t34 = cpu->r[30] + 0x000001E0u;
         /* 020D5984 */ cpu->r[8] = rbrew_read32(cpu->mem, _t34);
-        /* 020D5988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000001u);
-        /* 020D598C */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000001u));
+        /* 020D598C */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D598C */ _t36 = _t35 & 0x00000001u;
         /* 020D598C */ if (_t36) goto L_020D5990; else goto L_020D59D0;
   L_020D5990: ; // 0x20d5990
@@ -23757,8 +23757,8 @@ void Gambit_fn_020D589C(CPUState* cpu) {
   L_020D59B4: ; // 0x20d59b4
         /* 020D59B4 */ _t39 = cpu->r[30] + 0x000001E0u;
         /* 020D59B4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t39);
-        /* 020D59B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000001u);
-        /* 020D59BC */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D59B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000001u));
+        /* 020D59BC */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D59BC */ _t41 = _t40 & 0x00000001u;
         /* 020D59BC */ if (_t41) goto L_020D59C0; else goto L_020D59D0;
   L_020D59C0: ; // 0x20d59c0
@@ -23890,15 +23890,15 @@ void Gambit_fn_020D5A54(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D5A54: ; // 0x20d5a54
-        /* 020D5A54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D5A58 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5A54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D5A58 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5A58 */ _t1 = _t0 & 0x00000001u;
         /* 020D5A58 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D5A58 */ goto L_020D5A5C;
   L_020D5A5C: ; // 0x20d5a5c
         /* 020D5A5C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D5A5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D5A60 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5A5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D5A60 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5A60 */ _t3 = _t2 & 0x00000001u;
         /* 020D5A60 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D5A60 */ goto L_020D5A64;
@@ -23917,8 +23917,8 @@ void Gambit_fn_020D5A54(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -23932,15 +23932,15 @@ void Gambit_fn_020D5A54(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -23977,11 +23977,11 @@ void Gambit_fn_020D5A68(CPUState* cpu) {
         /* 020D5A74 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D5A74 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D5A78 */ cpu->r[30] = cpu->r[3];
-        /* 020D5A78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D5A78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D5A7C */ cpu->r[31] = cpu->r[4];
         /* 020D5A80 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D5A80 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D5A84 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5A84 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5A84 */ _t5 = _t4 & 0x00000001u;
         /* 020D5A84 */ if (_t5) goto L_020D5AC8; else goto L_020D5A88;
   L_020D5A88: ; // 0x20d5a88
@@ -24001,8 +24001,8 @@ void Gambit_fn_020D5A68(CPUState* cpu) {
         /* 020D5AB0 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D5AB4 */ Gambit_fn_02068798(cpu);
         /* 020D5AB8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D5AB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D5ABC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5AB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D5ABC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5ABC */ _t10 = _t9 & 0x00000001u;
         /* 020D5ABC */ if (_t10) goto L_020D5AC8; else goto L_020D5AC0;
   L_020D5AC0: ; // 0x20d5ac0
@@ -24033,11 +24033,11 @@ void Gambit_fn_020D5A6C(CPUState* cpu) {
         /* 020D5A74 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D5A74 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D5A78 */ cpu->r[30] = cpu->r[3];
-        /* 020D5A78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D5A78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D5A7C */ cpu->r[31] = cpu->r[4];
         /* 020D5A80 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D5A80 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D5A84 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5A84 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5A84 */ _t5 = _t4 & 0x00000001u;
         /* 020D5A84 */ if (_t5) goto L_020D5AC8; else goto L_020D5A88;
   L_020D5A88: ; // 0x20d5a88
@@ -24057,8 +24057,8 @@ void Gambit_fn_020D5A6C(CPUState* cpu) {
         /* 020D5AB0 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D5AB4 */ Gambit_fn_02068798(cpu);
         /* 020D5AB8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D5AB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D5ABC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5AB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D5ABC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5ABC */ _t10 = _t9 & 0x00000001u;
         /* 020D5ABC */ if (_t10) goto L_020D5AC8; else goto L_020D5AC0;
   L_020D5AC0: ; // 0x20d5ac0
@@ -24113,15 +24113,15 @@ void Gambit_fn_020D5AF8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D5AF8: ; // 0x20d5af8
-        /* 020D5AF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D5AFC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5AF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D5AFC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5AFC */ _t1 = _t0 & 0x00000001u;
         /* 020D5AFC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D5AFC */ goto L_020D5B00;
   L_020D5B00: ; // 0x20d5b00
         /* 020D5B00 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D5B00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D5B04 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5B00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D5B04 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5B04 */ _t3 = _t2 & 0x00000001u;
         /* 020D5B04 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D5B04 */ goto L_020D5B08;
@@ -24140,8 +24140,8 @@ void Gambit_fn_020D5AF8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -24155,15 +24155,15 @@ void Gambit_fn_020D5AF8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -24209,15 +24209,15 @@ void Gambit_fn_020D5B28(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D5B28: ; // 0x20d5b28
-        /* 020D5B28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D5B2C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5B28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D5B2C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5B2C */ _t1 = _t0 & 0x00000001u;
         /* 020D5B2C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D5B2C */ goto L_020D5B30;
   L_020D5B30: ; // 0x20d5b30
         /* 020D5B30 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D5B30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D5B34 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5B30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D5B34 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5B34 */ _t3 = _t2 & 0x00000001u;
         /* 020D5B34 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D5B34 */ goto L_020D5B38;
@@ -24236,8 +24236,8 @@ void Gambit_fn_020D5B28(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -24251,15 +24251,15 @@ void Gambit_fn_020D5B28(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -24287,15 +24287,15 @@ void Gambit_fn_020D5B3C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D5B3C: ; // 0x20d5b3c
-        /* 020D5B3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D5B40 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5B3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D5B40 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5B40 */ _t1 = _t0 & 0x00000001u;
         /* 020D5B40 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D5B40 */ goto L_020D5B44;
   L_020D5B44: ; // 0x20d5b44
         /* 020D5B44 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D5B44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D5B48 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5B44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D5B48 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5B48 */ _t3 = _t2 & 0x00000001u;
         /* 020D5B48 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D5B48 */ goto L_020D5B4C;
@@ -24314,8 +24314,8 @@ void Gambit_fn_020D5B3C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -24329,15 +24329,15 @@ void Gambit_fn_020D5B3C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -24484,10 +24484,10 @@ void Gambit_fn_020D5BB0(CPUState* cpu) {
         /* 020D5BB0 */ cpu->r[12] = 0x101D0000u;
         /* 020D5BB4 */ _t0 = cpu->r[12] + 0xFFFFEDA0u;
         /* 020D5BB4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 020D5BB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 020D5BB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 020D5BBC */ cpu->r[12] = 0x101D0000u;
         /* 020D5BC0 */ cpu->r[12] = cpu->r[12] + 0xFFFFEEF4u;
-        /* 020D5BC4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5BC4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5BC4 */ _t2 = _t1 & 0x00000001u;
         /* 020D5BC4 */ if (_t2) goto L_020D5BC8; else goto L_020D5BE0;
   L_020D5BC8: ; // 0x20d5bc8
@@ -24500,8 +24500,8 @@ void Gambit_fn_020D5BB0(CPUState* cpu) {
         /* 020D5BDC */ _t4 = cpu->r[12] + 0x00000000u;
         /* 020D5BDC */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_020D5BE0: ; // 0x20d5be0
-        /* 020D5BE0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 020D5BE4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5BE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 020D5BE4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5BE4 */ _t6 = _t5 & 0x00000001u;
         /* 020D5BE4 */ if (_t6) goto L_020D5BE8; else goto L_020D5BF0;
   L_020D5BE8: ; // 0x20d5be8
@@ -24513,9 +24513,9 @@ void Gambit_fn_020D5BB0(CPUState* cpu) {
         /* 020D5BF4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 020D5BF4 */ cpu->r[11] = _t7;
         /* 020D5BF8 */ cpu->r[10] = 0x101D0000u;
-        /* 020D5BFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 020D5BFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 020D5C00 */ cpu->r[10] = cpu->r[10] + 0xFFFFED90u;
-        /* 020D5C04 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5C04 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5C04 */ _t9 = _t8 & 0x00000001u;
         /* 020D5C04 */ if (_t9) goto L_020D5C08; else goto L_020D5C1C;
   L_020D5C08: ; // 0x20d5c08
@@ -24527,8 +24527,8 @@ void Gambit_fn_020D5BB0(CPUState* cpu) {
         /* 020D5C18 */ _t11 = cpu->r[10] + 0x00000000u;
         /* 020D5C18 */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
   L_020D5C1C: ; // 0x20d5c1c
-        /* 020D5C1C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 020D5C20 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5C1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 020D5C20 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5C20 */ _t13 = _t12 & 0x00000001u;
         /* 020D5C20 */ if (_t13) goto L_020D5C24; else goto L_020D5C2C;
   L_020D5C24: ; // 0x20d5c24
@@ -24540,9 +24540,9 @@ void Gambit_fn_020D5BB0(CPUState* cpu) {
         /* 020D5C30 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 020D5C30 */ cpu->r[8] = _t14;
         /* 020D5C34 */ cpu->r[11] = 0x101D0000u;
-        /* 020D5C38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020D5C38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020D5C3C */ cpu->r[11] = cpu->r[11] + 0xFFFFED94u;
-        /* 020D5C40 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5C40 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5C40 */ _t16 = _t15 & 0x00000001u;
         /* 020D5C40 */ if (_t16) goto L_020D5C44; else goto L_020D5C58;
   L_020D5C44: ; // 0x20d5c44
@@ -24586,11 +24586,11 @@ void Gambit_fn_020D5C74(CPUState* cpu) {
         /* 020D70B0 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D70B0 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D70B4 */ cpu->r[30] = cpu->r[3];
-        /* 020D70B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D70B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D70B8 */ cpu->r[31] = cpu->r[4];
         /* 020D70BC */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D70BC */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D70C0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D70C0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D70C0 */ _t5 = _t4 & 0x00000001u;
         /* 020D70C0 */ if (_t5) goto L_020D7104; else goto L_020D70C4;
   L_020D70C4: ; // 0x20d70c4
@@ -24610,8 +24610,8 @@ void Gambit_fn_020D5C74(CPUState* cpu) {
         /* 020D70EC */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D70F0 */ Gambit_fn_02068798(cpu);
         /* 020D70F4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D70F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D70F8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D70F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D70F8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D70F8 */ _t10 = _t9 & 0x00000001u;
         /* 020D70F8 */ if (_t10) goto L_020D7104; else goto L_020D70FC;
   L_020D70FC: ; // 0x20d70fc
@@ -24639,8 +24639,8 @@ void Gambit_fn_020D5C7C(CPUState* cpu) {
         /* 0206881C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02068820 */ _t1 = cpu->r[12] + 0x0000018Cu;
         /* 02068820 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1);
-        /* 02068824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02068828 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02068824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02068828 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02068828 */ _t3 = _t2 & 0x00000001u;
         /* 02068828 */ if (_t3) goto L_0206883C; else goto L_0206882C;
   L_0206882C: ; // 0x206882c
@@ -24692,18 +24692,18 @@ void Gambit_fn_020D5C94(CPUState* cpu) {
         /* 020D5C9C */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020D5CA0 */ /* nop */
         /* 020D5CA4 */ cpu->r[29] = cpu->r[3];
-        /* 020D5CA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020D5CA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020D5CA8 */ cpu->r[31] = cpu->r[4];
         /* 020D5CAC */ cpu->r[30] = cpu->r[5];
-        /* 020D5CB0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5CB0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5CB0 */ _t3 = _t2 & 0x00000001u;
         /* 020D5CB0 */ if (_t3) goto L_020D5CB4; else goto L_020D5CC4;
   L_020D5CB4: ; // 0x20d5cb4
         /* 020D5CB4 */ cpu->r[3] = 0x00000250u;
         /* 020D5CB8 */ Gambit_fn_02801A78(cpu);
         /* 020D5CBC */ cpu->r[29] = cpu->r[3];
-        /* 020D5CBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020D5CC0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5CBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020D5CC0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5CC0 */ _t5 = _t4 & 0x00000001u;
         /* 020D5CC0 */ if (_t5) goto L_020D5FBC; else goto L_020D5CC4;
   L_020D5CC4: ; // 0x20d5cc4
@@ -24730,22 +24730,22 @@ void Gambit_fn_020D5C94(CPUState* cpu) {
         /* 020D5D04 */ rbrew_write32(cpu->mem, _t9, cpu->r[9]);
         /* 020D5D08 */ cpu->r[11] = cpu->r[11] + 0xFFFF8F54u;
         /* 020D5D0C */ cpu->r[27] = cpu->r[29] + 0x000001DCu;
-        /* 020D5D0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020D5D0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020D5D10 */ _t10 = cpu->r[29] + 0x0000001Cu;
         /* 020D5D10 */ rbrew_write32(cpu->mem, _t10, cpu->r[10]);
         /* 020D5D14 */ cpu->r[28] = 0x00000000u;
         /* 020D5D18 */ cpu->r[31] = cpu->r[27];
         /* 020D5D1C */ _t11 = cpu->r[29] + 0x000001C8u;
         /* 020D5D1C */ rbrew_write32(cpu->mem, _t11, cpu->r[11]);
-        /* 020D5D20 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5D20 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5D20 */ _t13 = _t12 & 0x00000001u;
         /* 020D5D20 */ if (_t13) goto L_020D5D24; else goto L_020D5D34;
   L_020D5D24: ; // 0x20d5d24
         /* 020D5D24 */ cpu->r[3] = 0x00000038u;
         /* 020D5D28 */ Gambit_fn_02801A78(cpu);
         /* 020D5D2C */ cpu->r[31] = cpu->r[3];
-        /* 020D5D2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D5D30 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5D2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D5D30 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5D30 */ _t15 = _t14 & 0x00000001u;
         /* 020D5D30 */ if (_t15) goto L_020D5D64; else goto L_020D5D34;
   L_020D5D34: ; // 0x20d5d34
@@ -24819,23 +24819,23 @@ void Gambit_fn_020D5C94(CPUState* cpu) {
         /* 020D5DE0 */ _t39 = cpu->r[8] + 0x00000000u;
         /* 020D5DE0 */ cpu->r[5] = rbrew_read8(cpu->mem, _t39);
         /* 020D5DE4 */ cpu->r[30] = 0x00000000u;
-        /* 020D5DE8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[31]);
+        /* 020D5DE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[31]));
         /* 020D5DEC */ cpu->r[0] = 0x00080000u;
-        /* 020D5DF0 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5DF0 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5DF0 */ _t41 = _t40 & 0x00000001u;
         /* 020D5DF0 */ if (_t41) goto L_020D5E18; else goto L_020D5DF4;
   L_020D5DF4: ; // 0x20d5df4
         /* 020D5DF4 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020D5DF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 020D5DF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 020D5DFC */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 020D5E00 */ _t42 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D5E00 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D5E00 */ _t43 = _t42 & 0x00000001u;
         /* 020D5E00 */ if (_t43) goto L_020D5E14; else goto L_020D5E04;
   L_020D5E04: ; // 0x20d5e04
         /* 020D5E04 */ _t44 = cpu->r[8] + 0x00000000u;
         /* 020D5E04 */ cpu->r[6] = rbrew_read8(cpu->mem, _t44);
-        /* 020D5E08 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[31]);
-        /* 020D5E0C */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5E08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[31]));
+        /* 020D5E0C */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5E0C */ _t46 = _t45 & 0x00000001u;
         /* 020D5E0C */ if (_t46) goto L_020D5E10; else goto L_020D5DF4;
   L_020D5E10: ; // 0x20d5e10
@@ -24847,10 +24847,10 @@ void Gambit_fn_020D5C94(CPUState* cpu) {
         /* 020D5E18 */ cpu->r[6] = rbrew_read32(cpu->mem, _t47);
         /* 020D5E1C */ _t48 = cpu->r[1] + 0x00000010u;
         /* 020D5E1C */ cpu->r[7] = rbrew_read32(cpu->mem, _t48);
-        /* 020D5E20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[6]);
+        /* 020D5E20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[6]));
         /* 020D5E24 */ _t49 = cpu->r[7] + 0x00000014u;
         /* 020D5E24 */ cpu->r[8] = rbrew_read32(cpu->mem, _t49);
-        /* 020D5E28 */ _t50 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D5E28 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D5E28 */ _t51 = _t50 & 0x00000001u;
         /* 020D5E28 */ if (_t51) goto L_020D5E30; else goto L_020D5E2C;
   L_020D5E2C: ; // 0x20d5e2c
@@ -24905,10 +24905,10 @@ void Gambit_fn_020D5C94(CPUState* cpu) {
         /* 020D5EB0 */ rbrew_write32(cpu->mem, _t65, cpu->r[0]);
         /* 020D5EB4 */ _t66 = cpu->r[27] + 0x00000014u;
         /* 020D5EB4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t66);
-        /* 020D5EB8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000001u);
+        /* 020D5EB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000001u));
         /* 020D5EBC */ _t67 = cpu->r[27] + 0x00000018u;
         /* 020D5EBC */ cpu->r[26] = rbrew_read32(cpu->mem, _t67);
-        /* 020D5EC0 */ _t68 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D5EC0 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D5EC0 */ _t69 = _t68 & 0x00000001u;
         /* 020D5EC0 */ if (_t69) goto L_020D5EC4; else goto L_020D5EC8;
   L_020D5EC4: ; // 0x20d5ec4
@@ -24924,23 +24924,23 @@ void Gambit_fn_020D5C94(CPUState* cpu) {
         /* 020D5EDC */ _t72 = cpu->r[6] + 0x00000000u;
         /* 020D5EDC */ cpu->r[0] = rbrew_read8(cpu->mem, _t72);
         /* 020D5EE0 */ cpu->r[30] = 0x00000000u;
-        /* 020D5EE4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 020D5EE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 020D5EE8 */ cpu->r[7] = 0x00080000u;
-        /* 020D5EEC */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5EEC */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5EEC */ _t74 = _t73 & 0x00000001u;
         /* 020D5EEC */ if (_t74) goto L_020D5F14; else goto L_020D5EF0;
   L_020D5EF0: ; // 0x20d5ef0
         /* 020D5EF0 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020D5EF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 020D5EF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 020D5EF8 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 020D5EFC */ _t75 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D5EFC */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D5EFC */ _t76 = _t75 & 0x00000001u;
         /* 020D5EFC */ if (_t76) goto L_020D5F10; else goto L_020D5F00;
   L_020D5F00: ; // 0x20d5f00
         /* 020D5F00 */ _t77 = cpu->r[6] + 0x00000000u;
         /* 020D5F00 */ cpu->r[5] = rbrew_read8(cpu->mem, _t77);
-        /* 020D5F04 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[31]);
-        /* 020D5F08 */ _t78 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5F04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[31]));
+        /* 020D5F08 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5F08 */ _t79 = _t78 & 0x00000001u;
         /* 020D5F08 */ if (_t79) goto L_020D5F0C; else goto L_020D5EF0;
   L_020D5F0C: ; // 0x20d5f0c
@@ -24950,10 +24950,10 @@ void Gambit_fn_020D5C94(CPUState* cpu) {
   L_020D5F14: ; // 0x20d5f14
         /* 020D5F14 */ _t80 = cpu->r[26] + 0x00000008u;
         /* 020D5F14 */ cpu->r[7] = rbrew_read32(cpu->mem, _t80);
-        /* 020D5F18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 020D5F18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 020D5F1C */ _t81 = cpu->r[1] + 0x00000010u;
         /* 020D5F1C */ cpu->r[6] = rbrew_read32(cpu->mem, _t81);
-        /* 020D5F20 */ _t82 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D5F20 */ _t82 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D5F20 */ _t83 = _t82 & 0x00000001u;
         /* 020D5F20 */ if (_t83) goto L_020D5F28; else goto L_020D5F24;
   L_020D5F24: ; // 0x20d5f24
@@ -25039,18 +25039,18 @@ void Gambit_fn_020D5C98(CPUState* cpu) {
         /* 020D5C9C */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 020D5CA0 */ /* nop */
         /* 020D5CA4 */ cpu->r[29] = cpu->r[3];
-        /* 020D5CA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 020D5CA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 020D5CA8 */ cpu->r[31] = cpu->r[4];
         /* 020D5CAC */ cpu->r[30] = cpu->r[5];
-        /* 020D5CB0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5CB0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5CB0 */ _t3 = _t2 & 0x00000001u;
         /* 020D5CB0 */ if (_t3) goto L_020D5CB4; else goto L_020D5CC4;
   L_020D5CB4: ; // 0x20d5cb4
         /* 020D5CB4 */ cpu->r[3] = 0x00000250u;
         /* 020D5CB8 */ Gambit_fn_02801A78(cpu);
         /* 020D5CBC */ cpu->r[29] = cpu->r[3];
-        /* 020D5CBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020D5CC0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5CBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020D5CC0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5CC0 */ _t5 = _t4 & 0x00000001u;
         /* 020D5CC0 */ if (_t5) goto L_020D5FBC; else goto L_020D5CC4;
   L_020D5CC4: ; // 0x20d5cc4
@@ -25077,22 +25077,22 @@ void Gambit_fn_020D5C98(CPUState* cpu) {
         /* 020D5D04 */ rbrew_write32(cpu->mem, _t9, cpu->r[9]);
         /* 020D5D08 */ cpu->r[11] = cpu->r[11] + 0xFFFF8F54u;
         /* 020D5D0C */ cpu->r[27] = cpu->r[29] + 0x000001DCu;
-        /* 020D5D0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 020D5D0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 020D5D10 */ _t10 = cpu->r[29] + 0x0000001Cu;
         /* 020D5D10 */ rbrew_write32(cpu->mem, _t10, cpu->r[10]);
         /* 020D5D14 */ cpu->r[28] = 0x00000000u;
         /* 020D5D18 */ cpu->r[31] = cpu->r[27];
         /* 020D5D1C */ _t11 = cpu->r[29] + 0x000001C8u;
         /* 020D5D1C */ rbrew_write32(cpu->mem, _t11, cpu->r[11]);
-        /* 020D5D20 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5D20 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5D20 */ _t13 = _t12 & 0x00000001u;
         /* 020D5D20 */ if (_t13) goto L_020D5D24; else goto L_020D5D34;
   L_020D5D24: ; // 0x20d5d24
         /* 020D5D24 */ cpu->r[3] = 0x00000038u;
         /* 020D5D28 */ Gambit_fn_02801A78(cpu);
         /* 020D5D2C */ cpu->r[31] = cpu->r[3];
-        /* 020D5D2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 020D5D30 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5D2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 020D5D30 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5D30 */ _t15 = _t14 & 0x00000001u;
         /* 020D5D30 */ if (_t15) goto L_020D5D64; else goto L_020D5D34;
   L_020D5D34: ; // 0x20d5d34
@@ -25166,23 +25166,23 @@ void Gambit_fn_020D5C98(CPUState* cpu) {
         /* 020D5DE0 */ _t39 = cpu->r[8] + 0x00000000u;
         /* 020D5DE0 */ cpu->r[5] = rbrew_read8(cpu->mem, _t39);
         /* 020D5DE4 */ cpu->r[30] = 0x00000000u;
-        /* 020D5DE8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[31]);
+        /* 020D5DE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[31]));
         /* 020D5DEC */ cpu->r[0] = 0x00080000u;
-        /* 020D5DF0 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5DF0 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5DF0 */ _t41 = _t40 & 0x00000001u;
         /* 020D5DF0 */ if (_t41) goto L_020D5E18; else goto L_020D5DF4;
   L_020D5DF4: ; // 0x20d5df4
         /* 020D5DF4 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020D5DF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 020D5DF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 020D5DFC */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 020D5E00 */ _t42 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D5E00 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D5E00 */ _t43 = _t42 & 0x00000001u;
         /* 020D5E00 */ if (_t43) goto L_020D5E14; else goto L_020D5E04;
   L_020D5E04: ; // 0x20d5e04
         /* 020D5E04 */ _t44 = cpu->r[8] + 0x00000000u;
         /* 020D5E04 */ cpu->r[6] = rbrew_read8(cpu->mem, _t44);
-        /* 020D5E08 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[31]);
-        /* 020D5E0C */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5E08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[31]));
+        /* 020D5E0C */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5E0C */ _t46 = _t45 & 0x00000001u;
         /* 020D5E0C */ if (_t46) goto L_020D5E10; else goto L_020D5DF4;
   L_020D5E10: ; // 0x20d5e10
@@ -25194,10 +25194,10 @@ void Gambit_fn_020D5C98(CPUState* cpu) {
         /* 020D5E18 */ cpu->r[6] = rbrew_read32(cpu->mem, _t47);
         /* 020D5E1C */ _t48 = cpu->r[1] + 0x00000010u;
         /* 020D5E1C */ cpu->r[7] = rbrew_read32(cpu->mem, _t48);
-        /* 020D5E20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[6]);
+        /* 020D5E20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[6]));
         /* 020D5E24 */ _t49 = cpu->r[7] + 0x00000014u;
         /* 020D5E24 */ cpu->r[8] = rbrew_read32(cpu->mem, _t49);
-        /* 020D5E28 */ _t50 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D5E28 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D5E28 */ _t51 = _t50 & 0x00000001u;
         /* 020D5E28 */ if (_t51) goto L_020D5E30; else goto L_020D5E2C;
   L_020D5E2C: ; // 0x20d5e2c
@@ -25252,10 +25252,10 @@ void Gambit_fn_020D5C98(CPUState* cpu) {
         /* 020D5EB0 */ rbrew_write32(cpu->mem, _t65, cpu->r[0]);
         /* 020D5EB4 */ _t66 = cpu->r[27] + 0x00000014u;
         /* 020D5EB4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t66);
-        /* 020D5EB8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000001u);
+        /* 020D5EB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000001u));
         /* 020D5EBC */ _t67 = cpu->r[27] + 0x00000018u;
         /* 020D5EBC */ cpu->r[26] = rbrew_read32(cpu->mem, _t67);
-        /* 020D5EC0 */ _t68 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D5EC0 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D5EC0 */ _t69 = _t68 & 0x00000001u;
         /* 020D5EC0 */ if (_t69) goto L_020D5EC4; else goto L_020D5EC8;
   L_020D5EC4: ; // 0x20d5ec4
@@ -25271,23 +25271,23 @@ void Gambit_fn_020D5C98(CPUState* cpu) {
         /* 020D5EDC */ _t72 = cpu->r[6] + 0x00000000u;
         /* 020D5EDC */ cpu->r[0] = rbrew_read8(cpu->mem, _t72);
         /* 020D5EE0 */ cpu->r[30] = 0x00000000u;
-        /* 020D5EE4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 020D5EE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 020D5EE8 */ cpu->r[7] = 0x00080000u;
-        /* 020D5EEC */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5EEC */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5EEC */ _t74 = _t73 & 0x00000001u;
         /* 020D5EEC */ if (_t74) goto L_020D5F14; else goto L_020D5EF0;
   L_020D5EF0: ; // 0x20d5ef0
         /* 020D5EF0 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020D5EF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 020D5EF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 020D5EF8 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 020D5EFC */ _t75 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D5EFC */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D5EFC */ _t76 = _t75 & 0x00000001u;
         /* 020D5EFC */ if (_t76) goto L_020D5F10; else goto L_020D5F00;
   L_020D5F00: ; // 0x20d5f00
         /* 020D5F00 */ _t77 = cpu->r[6] + 0x00000000u;
         /* 020D5F00 */ cpu->r[5] = rbrew_read8(cpu->mem, _t77);
-        /* 020D5F04 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[31]);
-        /* 020D5F08 */ _t78 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D5F04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[31]));
+        /* 020D5F08 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D5F08 */ _t79 = _t78 & 0x00000001u;
         /* 020D5F08 */ if (_t79) goto L_020D5F0C; else goto L_020D5EF0;
   L_020D5F0C: ; // 0x20d5f0c
@@ -25297,10 +25297,10 @@ void Gambit_fn_020D5C98(CPUState* cpu) {
   L_020D5F14: ; // 0x20d5f14
         /* 020D5F14 */ _t80 = cpu->r[26] + 0x00000008u;
         /* 020D5F14 */ cpu->r[7] = rbrew_read32(cpu->mem, _t80);
-        /* 020D5F18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 020D5F18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 020D5F1C */ _t81 = cpu->r[1] + 0x00000010u;
         /* 020D5F1C */ cpu->r[6] = rbrew_read32(cpu->mem, _t81);
-        /* 020D5F20 */ _t82 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D5F20 */ _t82 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D5F20 */ _t83 = _t82 & 0x00000001u;
         /* 020D5F20 */ if (_t83) goto L_020D5F28; else goto L_020D5F24;
   L_020D5F24: ; // 0x20d5f24
@@ -25396,9 +25396,9 @@ void Gambit_fn_020D5FD4(CPUState* cpu) {
         /* 020D5FF8 */ _t4 = cpu->r[30] + 0x00000218u;
         /* 020D5FF8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
         /* 020D5FFC */ cpu->r[31] = cpu->r[4];
-        /* 020D6000 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], cpu->r[0]);
+        /* 020D6000 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], cpu->r[0]));
         /* 020D6004 */ cpu->r[24] = 0x00000001u;
-        /* 020D6008 */ _t5 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D6008 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D6008 */ _t6 = _t5 & 0x00000001u;
         /* 020D6008 */ if (_t6) goto L_020D600C; else goto L_020D615C;
   L_020D600C: ; // 0x20d600c
@@ -25411,9 +25411,9 @@ void Gambit_fn_020D5FD4(CPUState* cpu) {
         /* 020D601C */ cpu->r[3] = cpu->r[31];
         /* 020D6020 */ cpu->r[4] = cpu->r[25];
         /* 020D6024 */ Gambit_fn_027F0D58(cpu);
-        /* 020D6028 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], 0x00000008u);
+        /* 020D6028 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], 0x00000008u));
         /* 020D602C */ cpu->r[27] = cpu->r[3];
-        /* 020D6030 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D6030 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D6030 */ _t9 = _t8 & 0x00000001u;
         /* 020D6030 */ if (_t9) goto L_020D6034; else goto L_020D6048;
   L_020D6034: ; // 0x20d6034
@@ -25421,8 +25421,8 @@ void Gambit_fn_020D5FD4(CPUState* cpu) {
         /* 020D6034 */ cpu->r[11] = rbrew_read32(cpu->mem, _t10);
         /* 020D6038 */ _t11 = cpu->r[11] + 0x000001E4u;
         /* 020D6038 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t11);
-        /* 020D603C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[31]);
-        /* 020D6040 */ _t12 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D603C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[31]));
+        /* 020D6040 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D6040 */ _t13 = _t12 & 0x00000001u;
         /* 020D6040 */ if (_t13) goto L_020D6058; else goto L_020D6044;
   L_020D6044: ; // 0x20d6044
@@ -25432,13 +25432,13 @@ void Gambit_fn_020D5FD4(CPUState* cpu) {
         /* 020D6048 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 020D604C */ _t15 = cpu->r[11] + 0x000001E4u;
         /* 020D604C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t15);
-        /* 020D6050 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[31]);
-        /* 020D6054 */ _t16 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D6050 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[31]));
+        /* 020D6054 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D6054 */ _t17 = _t16 & 0x00000001u;
         /* 020D6054 */ if (_t17) goto L_020D6058; else goto L_020D6094;
   L_020D6058: ; // 0x20d6058
-        /* 020D6058 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], 0x00000008u);
-        /* 020D605C */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D6058 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], 0x00000008u));
+        /* 020D605C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D605C */ _t19 = _t18 & 0x00000001u;
         /* 020D605C */ if (_t19) goto L_020D6060; else goto L_020D607C;
   L_020D6060: ; // 0x20d6060
@@ -25459,13 +25459,13 @@ void Gambit_fn_020D5FD4(CPUState* cpu) {
         /* 020D608C */ cpu->r[3] = cpu->r[26];
         /* 020D6090 */ Gambit_fn_020D76D0(cpu);
   L_020D6094: ; // 0x20d6094
-        /* 020D6094 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 020D6098 */ _t22 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D6094 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 020D6098 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D6098 */ _t23 = _t22 & 0x00000001u;
         /* 020D6098 */ if (_t23) goto L_020D609C; else goto L_020D60F4;
   L_020D609C: ; // 0x20d609c
-        /* 020D609C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], 0x00000008u);
-        /* 020D60A0 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D609C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], 0x00000008u));
+        /* 020D60A0 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D60A0 */ _t25 = _t24 & 0x00000001u;
         /* 020D60A0 */ if (_t25) goto L_020D60A4; else goto L_020D60B8;
   L_020D60A4: ; // 0x20d60a4
@@ -25473,8 +25473,8 @@ void Gambit_fn_020D5FD4(CPUState* cpu) {
         /* 020D60A4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t26);
         /* 020D60A8 */ _t27 = cpu->r[11] + 0x000001E9u;
         /* 020D60A8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t27);
-        /* 020D60AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D60B0 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D60AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D60B0 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D60B0 */ _t29 = _t28 & 0x00000001u;
         /* 020D60B0 */ if (_t29) goto L_020D60F4; else goto L_020D60B4;
   L_020D60B4: ; // 0x20d60b4
@@ -25484,17 +25484,17 @@ void Gambit_fn_020D5FD4(CPUState* cpu) {
         /* 020D60B8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t30);
         /* 020D60BC */ _t31 = cpu->r[11] + 0x000001E9u;
         /* 020D60BC */ cpu->r[0] = rbrew_read8(cpu->mem, _t31);
-        /* 020D60C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D60C4 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D60C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D60C4 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D60C4 */ _t33 = _t32 & 0x00000001u;
         /* 020D60C4 */ if (_t33) goto L_020D60F4; else goto L_020D60C8;
   L_020D60C8: ; // 0x20d60c8
-        /* 020D60C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], cpu->r[31]);
+        /* 020D60C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], cpu->r[31]));
         /* 020D60CC */ /* nop */
         /* 020D60D0 */ cpu->r[4] = rbrew_rlwinm(cpu->r[0], 0x00000002u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D60D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], 0x00000008u);
+        /* 020D60D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], 0x00000008u));
         /* 020D60D8 */ cpu->r[4] = cpu->r[4] ^ 0x00000001u;
-        /* 020D60DC */ _t34 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D60DC */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D60DC */ _t35 = _t34 & 0x00000001u;
         /* 020D60DC */ if (_t35) goto L_020D60E0; else goto L_020D60EC;
   L_020D60E0: ; // 0x20d60e0
@@ -25507,16 +25507,16 @@ void Gambit_fn_020D5FD4(CPUState* cpu) {
         /* 020D60EC */ cpu->r[3] = rbrew_read32(cpu->mem, _t37);
         /* 020D60F0 */ Gambit_fn_020D77B0(cpu);
   L_020D60F4: ; // 0x20d60f4
-        /* 020D60F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], 0x00000008u);
-        /* 020D60F8 */ _t38 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D60F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], 0x00000008u));
+        /* 020D60F8 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D60F8 */ _t39 = _t38 & 0x00000001u;
         /* 020D60F8 */ if (_t39) goto L_020D60FC; else goto L_020D6110;
   L_020D60FC: ; // 0x20d60fc
         /* 020D60FC */ _t40 = cpu->r[29] + cpu->r[28];
         /* 020D60FC */ cpu->r[3] = rbrew_read32(cpu->mem, _t40);
         /* 020D6100 */ Gambit_fn_020D76C0(cpu);
-        /* 020D6104 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D6108 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6104 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D6108 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6108 */ _t42 = _t41 & 0x00000001u;
         /* 020D6108 */ if (_t42) goto L_020D6144; else goto L_020D610C;
   L_020D610C: ; // 0x20d610c
@@ -25525,13 +25525,13 @@ void Gambit_fn_020D5FD4(CPUState* cpu) {
         /* 020D6110 */ _t43 = cpu->r[29] + 0x00000000u;
         /* 020D6110 */ cpu->r[3] = rbrew_read32(cpu->mem, _t43);
         /* 020D6114 */ Gambit_fn_020D76C0(cpu);
-        /* 020D6118 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D611C */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6118 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D611C */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D611C */ _t45 = _t44 & 0x00000001u;
         /* 020D611C */ if (_t45) goto L_020D6144; else goto L_020D6120;
   L_020D6120: ; // 0x20d6120
-        /* 020D6120 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], 0x00000008u);
-        /* 020D6124 */ _t46 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D6120 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], 0x00000008u));
+        /* 020D6124 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D6124 */ _t47 = _t46 & 0x00000001u;
         /* 020D6124 */ if (_t47) goto L_020D6128; else goto L_020D6138;
   L_020D6128: ; // 0x20d6128
@@ -25550,9 +25550,9 @@ void Gambit_fn_020D5FD4(CPUState* cpu) {
         /* 020D6144 */ cpu->r[0] = rbrew_read32(cpu->mem, _t50);
         /* 020D6148 */ cpu->r[25] = cpu->r[25] + 0x00000001u;
         /* 020D614C */ cpu->r[28] = cpu->r[28] + 0x00000004u;
-        /* 020D6150 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], cpu->r[0]);
+        /* 020D6150 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], cpu->r[0]));
         /* 020D6154 */ cpu->r[24] = (uint32_t)((int32_t)cpu->r[24] * (int32_t)0x0000000Au);
-        /* 020D6158 */ _t51 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D6158 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D6158 */ _t52 = _t51 & 0x00000001u;
         /* 020D6158 */ if (_t52) goto L_020D601C; else goto L_020D615C;
   L_020D615C: ; // 0x20d615c
@@ -25561,7 +25561,7 @@ void Gambit_fn_020D5FD4(CPUState* cpu) {
         /* 020D6160 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t53);
         /* 020D6164 */ _t54 = cpu->r[1] + 0x00000028u;
         /* 020D6164 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t54);
-        /* 020D6168 */ _t55 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D6168 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D6168 */ _t56 = _t55 & 0x00000001u;
         /* 020D6168 */ if (_t56) goto L_020D616C; // else: addr-0 trap, fall-through
   L_020D616C: ; // 0x20d616c
@@ -25682,8 +25682,8 @@ void Gambit_fn_020D61EC(CPUState* cpu) {
         /* 020D6200 */ _t2 = cpu->r[29] + 0x0000023Cu;
         /* 020D6200 */ cpu->r[0] = rbrew_read32(cpu->mem, _t2);
         /* 020D6204 */ cpu->r[30] = cpu->r[4];
-        /* 020D6208 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
-        /* 020D620C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
+        /* 020D620C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D620C */ _t4 = _t3 & 0x00000001u;
         /* 020D620C */ if (_t4) goto L_020D639C; else goto L_020D6210;
   L_020D6210: ; // 0x20d6210
@@ -25695,10 +25695,10 @@ void Gambit_fn_020D61EC(CPUState* cpu) {
         /* 020D621C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t6);
         /* 020D6220 */ cpu->r[25] = cpu->r[26];
         /* 020D6224 */ cpu->r[24] = 0x00000001u;
-        /* 020D6228 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], cpu->r[0]);
+        /* 020D6228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], cpu->r[0]));
         /* 020D622C */ _t7 = cpu->r[29] + 0x00000244u;
         /* 020D622C */ rbrew_write_f32(cpu->mem, _t7, cpu->f[0]);
-        /* 020D6230 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D6230 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D6230 */ _t9 = _t8 & 0x00000001u;
         /* 020D6230 */ if (_t9) goto L_020D6234; else goto L_020D632C;
   L_020D6234: ; // 0x20d6234
@@ -25712,27 +25712,27 @@ void Gambit_fn_020D61EC(CPUState* cpu) {
         /* 020D6248 */ cpu->r[3] = rbrew_read32(cpu->mem, _t10);
         /* 020D624C */ cpu->r[4] = cpu->r[25];
         /* 020D6250 */ Gambit_fn_027F0D58(cpu);
-        /* 020D6254 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], cpu->r[3]);
-        /* 020D6258 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6254 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], cpu->r[3]));
+        /* 020D6258 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6258 */ _t12 = _t11 & 0x00000001u;
         /* 020D6258 */ if (_t12) goto L_020D6314; else goto L_020D625C;
   L_020D625C: ; // 0x20d625c
-        /* 020D625C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 020D625C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 020D6260 */ cpu->r[31] = cpu->r[29] + 0x0000021Cu;
         /* 020D6264 */ cpu->r[26] = cpu->r[25];
-        /* 020D6268 */ _t13 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D6268 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D6268 */ _t14 = _t13 & 0x00000001u;
         /* 020D6268 */ if (_t14) goto L_020D6278; else goto L_020D626C;
   L_020D626C: ; // 0x20d626c
-        /* 020D626C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], 0x00000008u);
-        /* 020D6270 */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D626C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], 0x00000008u));
+        /* 020D6270 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D6270 */ _t16 = _t15 & 0x00000001u;
         /* 020D6270 */ if (_t16) goto L_020D62D8; else goto L_020D6274;
   L_020D6274: ; // 0x20d6274
         /* 020D6274 */ goto L_020D62EC;
   L_020D6278: ; // 0x20d6278
-        /* 020D6278 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], 0x00000008u);
-        /* 020D627C */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D6278 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], 0x00000008u));
+        /* 020D627C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D627C */ _t18 = _t17 & 0x00000001u;
         /* 020D627C */ if (_t18) goto L_020D6280; else goto L_020D6294;
   L_020D6280: ; // 0x20d6280
@@ -25740,8 +25740,8 @@ void Gambit_fn_020D61EC(CPUState* cpu) {
         /* 020D6280 */ cpu->r[12] = rbrew_read32(cpu->mem, _t19);
         /* 020D6284 */ _t20 = cpu->r[12] + 0x000001E9u;
         /* 020D6284 */ cpu->r[0] = rbrew_read8(cpu->mem, _t20);
-        /* 020D6288 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D628C */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6288 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D628C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D628C */ _t22 = _t21 & 0x00000001u;
         /* 020D628C */ if (_t22) goto L_020D62D0; else goto L_020D6290;
   L_020D6290: ; // 0x20d6290
@@ -25751,17 +25751,17 @@ void Gambit_fn_020D61EC(CPUState* cpu) {
         /* 020D6294 */ cpu->r[12] = rbrew_read32(cpu->mem, _t23);
         /* 020D6298 */ _t24 = cpu->r[12] + 0x000001E9u;
         /* 020D6298 */ cpu->r[0] = rbrew_read8(cpu->mem, _t24);
-        /* 020D629C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D62A0 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D629C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D62A0 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D62A0 */ _t26 = _t25 & 0x00000001u;
         /* 020D62A0 */ if (_t26) goto L_020D62D0; else goto L_020D62A4;
   L_020D62A4: ; // 0x20d62a4
-        /* 020D62A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], cpu->r[30]);
+        /* 020D62A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], cpu->r[30]));
         /* 020D62A8 */ /* nop */
         /* 020D62AC */ cpu->r[4] = rbrew_rlwinm(cpu->r[0], 0x00000002u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D62B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], 0x00000008u);
+        /* 020D62B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], 0x00000008u));
         /* 020D62B4 */ cpu->r[4] = cpu->r[4] ^ 0x00000001u;
-        /* 020D62B8 */ _t27 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D62B8 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D62B8 */ _t28 = _t27 & 0x00000001u;
         /* 020D62B8 */ if (_t28) goto L_020D62BC; else goto L_020D62C8;
   L_020D62BC: ; // 0x20d62bc
@@ -25774,16 +25774,16 @@ void Gambit_fn_020D61EC(CPUState* cpu) {
         /* 020D62C8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t30);
         /* 020D62CC */ Gambit_fn_020D781C(cpu);
   L_020D62D0: ; // 0x20d62d0
-        /* 020D62D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], 0x00000008u);
-        /* 020D62D4 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D62D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], 0x00000008u));
+        /* 020D62D4 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D62D4 */ _t32 = _t31 & 0x00000001u;
         /* 020D62D4 */ if (_t32) goto L_020D62D8; else goto L_020D62EC;
   L_020D62D8: ; // 0x20d62d8
         /* 020D62D8 */ _t33 = cpu->r[31] + cpu->r[28];
         /* 020D62D8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t33);
         /* 020D62DC */ Gambit_fn_020D76C0(cpu);
-        /* 020D62E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D62E4 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D62E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D62E4 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D62E4 */ _t35 = _t34 & 0x00000001u;
         /* 020D62E4 */ if (_t35) goto L_020D6314; else goto L_020D62E8;
   L_020D62E8: ; // 0x20d62e8
@@ -25792,13 +25792,13 @@ void Gambit_fn_020D61EC(CPUState* cpu) {
         /* 020D62EC */ _t36 = cpu->r[31] + 0x00000000u;
         /* 020D62EC */ cpu->r[3] = rbrew_read32(cpu->mem, _t36);
         /* 020D62F0 */ Gambit_fn_020D76C0(cpu);
-        /* 020D62F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D62F8 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D62F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D62F8 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D62F8 */ _t38 = _t37 & 0x00000001u;
         /* 020D62F8 */ if (_t38) goto L_020D6314; else goto L_020D62FC;
   L_020D62FC: ; // 0x20d62fc
-        /* 020D62FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], 0x00000008u);
-        /* 020D6300 */ _t39 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D62FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], 0x00000008u));
+        /* 020D6300 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D6300 */ _t40 = _t39 & 0x00000001u;
         /* 020D6300 */ if (_t40) goto L_020D6304; else goto L_020D6308;
   L_020D6304: ; // 0x20d6304
@@ -25813,28 +25813,28 @@ void Gambit_fn_020D61EC(CPUState* cpu) {
         /* 020D6314 */ cpu->r[0] = rbrew_read32(cpu->mem, _t42);
         /* 020D6318 */ cpu->r[25] = cpu->r[25] + 0x00000001u;
         /* 020D631C */ cpu->r[28] = cpu->r[28] + 0x00000004u;
-        /* 020D6320 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], cpu->r[0]);
+        /* 020D6320 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], cpu->r[0]));
         /* 020D6324 */ cpu->r[24] = (uint32_t)((int32_t)cpu->r[24] * (int32_t)0x0000000Au);
-        /* 020D6328 */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D6328 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D6328 */ _t44 = _t43 & 0x00000001u;
         /* 020D6328 */ if (_t44) goto L_020D6238; else goto L_020D632C;
   L_020D632C: ; // 0x20d632c
         /* 020D632C */ cpu->r[27] = 0x00000000u;
-        /* 020D6330 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[0]);
-        /* 020D6334 */ _t45 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D6330 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[0]));
+        /* 020D6334 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D6334 */ _t46 = _t45 & 0x00000001u;
         /* 020D6334 */ if (_t46) goto L_020D6338; else goto L_020D639C;
   L_020D6338: ; // 0x20d6338
         /* 020D6338 */ cpu->r[28] = 0x00000000u;
   L_020D633C: ; // 0x20d633c
-        /* 020D633C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[26]);
-        /* 020D6340 */ _t47 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D633C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[26]));
+        /* 020D6340 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D6340 */ _t48 = _t47 & 0x00000001u;
         /* 020D6340 */ if (_t48) goto L_020D638C; else goto L_020D6344;
   L_020D6344: ; // 0x20d6344
-        /* 020D6344 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], 0x00000008u);
+        /* 020D6344 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], 0x00000008u));
         /* 020D6348 */ cpu->r[31] = cpu->r[29] + 0x0000021Cu;
-        /* 020D634C */ _t49 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D634C */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D634C */ _t50 = _t49 & 0x00000001u;
         /* 020D634C */ if (_t50) goto L_020D6350; else goto L_020D6364;
   L_020D6350: ; // 0x20d6350
@@ -25842,8 +25842,8 @@ void Gambit_fn_020D61EC(CPUState* cpu) {
         /* 020D6350 */ cpu->r[9] = rbrew_read32(cpu->mem, _t51);
         /* 020D6354 */ _t52 = cpu->r[9] + 0x000001E8u;
         /* 020D6354 */ cpu->r[12] = rbrew_read8(cpu->mem, _t52);
-        /* 020D6358 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020D635C */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6358 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020D635C */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D635C */ _t54 = _t53 & 0x00000001u;
         /* 020D635C */ if (_t54) goto L_020D638C; else goto L_020D6360;
   L_020D6360: ; // 0x20d6360
@@ -25853,13 +25853,13 @@ void Gambit_fn_020D61EC(CPUState* cpu) {
         /* 020D6364 */ cpu->r[9] = rbrew_read32(cpu->mem, _t55);
         /* 020D6368 */ _t56 = cpu->r[9] + 0x000001E8u;
         /* 020D6368 */ cpu->r[12] = rbrew_read8(cpu->mem, _t56);
-        /* 020D636C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 020D6370 */ _t57 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D636C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 020D6370 */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6370 */ _t58 = _t57 & 0x00000001u;
         /* 020D6370 */ if (_t58) goto L_020D638C; else goto L_020D6374;
   L_020D6374: ; // 0x20d6374
-        /* 020D6374 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], 0x00000008u);
-        /* 020D6378 */ _t59 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D6374 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], 0x00000008u));
+        /* 020D6378 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D6378 */ _t60 = _t59 & 0x00000001u;
         /* 020D6378 */ if (_t60) goto L_020D637C; else goto L_020D6380;
   L_020D637C: ; // 0x20d637c
@@ -25872,9 +25872,9 @@ void Gambit_fn_020D61EC(CPUState* cpu) {
         /* 020D6388 */ cpu->r[0] = rbrew_read32(cpu->mem, _t62);
   L_020D638C: ; // 0x20d638c
         /* 020D638C */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 020D6390 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[0]);
+        /* 020D6390 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[0]));
         /* 020D6394 */ cpu->r[28] = cpu->r[28] + 0x00000004u;
-        /* 020D6398 */ _t63 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D6398 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D6398 */ _t64 = _t63 & 0x00000001u;
         /* 020D6398 */ if (_t64) goto L_020D633C; else goto L_020D639C;
   L_020D639C: ; // 0x20d639c
@@ -25920,10 +25920,10 @@ void Gambit_fn_020D63B8(CPUState* cpu) {
         /* 020D63F0 */ cpu->f[30] = cpu->f[1];
         /* 020D63F4 */ _t9 = cpu->r[10] + 0xFFFF8D4Cu;
         /* 020D63F4 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t9);
-        /* 020D63F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 020D63F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 020D63FC */ _t10 = cpu->r[30] + 0x000001ACu;
         /* 020D63FC */ cpu->r[3] = rbrew_read32(cpu->mem, _t10);
-        /* 020D6400 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6400 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6400 */ _t12 = _t11 & 0x00000001u;
         /* 020D6400 */ if (_t12) goto L_020D6474; else goto L_020D6404;
   L_020D6404: ; // 0x20d6404
@@ -25959,8 +25959,8 @@ void Gambit_fn_020D63B8(CPUState* cpu) {
         /* 020D645C */ cpu->r[3] = cpu->r[30];
         /* 020D6460 */ cpu->r[4] = cpu->r[31];
         /* 020D6464 */ Gambit_fn_020D61EC(cpu);
-        /* 020D6468 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[30]);
-        /* 020D646C */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D6468 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[30]));
+        /* 020D646C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D646C */ _t21 = _t20 & 0x00000001u;
         /* 020D646C */ if (_t21) goto L_020D6470; else goto L_020D649C;
   L_020D6470: ; // 0x20d6470
@@ -25972,8 +25972,8 @@ void Gambit_fn_020D63B8(CPUState* cpu) {
         /* 020D6480 */ cpu->r[3] = cpu->r[30];
         /* 020D6484 */ cpu->r[4] = cpu->r[31];
         /* 020D6488 */ Gambit_fn_020D61EC(cpu);
-        /* 020D648C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[30]);
-        /* 020D6490 */ _t22 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D648C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[30]));
+        /* 020D6490 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D6490 */ _t23 = _t22 & 0x00000001u;
         /* 020D6490 */ if (_t23) goto L_020D6494; else goto L_020D649C;
   L_020D6494: ; // 0x20d6494
@@ -25993,7 +25993,7 @@ void Gambit_fn_020D63B8(CPUState* cpu) {
         /* 020D64AC */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t29);
         /* 020D64B0 */ _t30 = cpu->r[1] + 0x00000010u;
         /* 020D64B0 */ cpu->r[30] = rbrew_read32(cpu->mem, _t30);
-        /* 020D64B4 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D64B4 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D64B4 */ _t32 = _t31 & 0x00000001u;
         /* 020D64B4 */ if (_t32) goto L_020D64B8; // else: addr-0 trap, fall-through
   L_020D64B8: ; // 0x20d64b8
@@ -26105,8 +26105,8 @@ void Gambit_fn_020D6500(CPUState* cpu) {
         /* 020D61E4 */ cpu->r[1] = cpu->r[1] + 0x00000018u;
         /* 020D61E8 */ return;
   L_020D6500: ; // 0x20d6500
-        /* 020D6500 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020D6504 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D6500 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020D6504 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D6504 */ _t14 = _t13 & 0x00000001u;
         /* 020D6504 */ if (_t14) goto L_020D6508; else goto L_020D6510;
   L_020D6508: ; // 0x20d6508
@@ -26115,8 +26115,8 @@ void Gambit_fn_020D6500(CPUState* cpu) {
   L_020D6510: ; // 0x20d6510
         /* 020D6510 */ cpu->r[0] = 0x00980000u;
         /* 020D6514 */ cpu->r[0] = cpu->r[0] | 0x0000967Fu;
-        /* 020D6518 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], cpu->r[0]);
-        /* 020D651C */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D6518 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], cpu->r[0]));
+        /* 020D651C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D651C */ _t16 = _t15 & 0x00000001u;
         /* 020D651C */ if (_t16) goto L_020D6520; else goto L_020D6528;
   L_020D6520: ; // 0x20d6520
@@ -26224,10 +26224,10 @@ void Gambit_fn_020D657C(CPUState* cpu) {
         /* 020D63F0 */ cpu->f[30] = cpu->f[1];
         /* 020D63F4 */ _t9 = cpu->r[10] + 0xFFFF8D4Cu;
         /* 020D63F4 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t9);
-        /* 020D63F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 020D63F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 020D63FC */ _t10 = cpu->r[30] + 0x000001ACu;
         /* 020D63FC */ cpu->r[3] = rbrew_read32(cpu->mem, _t10);
-        /* 020D6400 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6400 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6400 */ _t12 = _t11 & 0x00000001u;
         /* 020D6400 */ if (_t12) goto L_020D6474; else goto L_020D6404;
   L_020D6404: ; // 0x20d6404
@@ -26263,8 +26263,8 @@ void Gambit_fn_020D657C(CPUState* cpu) {
         /* 020D645C */ cpu->r[3] = cpu->r[30];
         /* 020D6460 */ cpu->r[4] = cpu->r[31];
         /* 020D6464 */ Gambit_fn_020D61EC(cpu);
-        /* 020D6468 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[30]);
-        /* 020D646C */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D6468 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[30]));
+        /* 020D646C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D646C */ _t21 = _t20 & 0x00000001u;
         /* 020D646C */ if (_t21) goto L_020D6470; else goto L_020D649C;
   L_020D6470: ; // 0x20d6470
@@ -26276,8 +26276,8 @@ void Gambit_fn_020D657C(CPUState* cpu) {
         /* 020D6480 */ cpu->r[3] = cpu->r[30];
         /* 020D6484 */ cpu->r[4] = cpu->r[31];
         /* 020D6488 */ Gambit_fn_020D61EC(cpu);
-        /* 020D648C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[30]);
-        /* 020D6490 */ _t22 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D648C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[30]));
+        /* 020D6490 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D6490 */ _t23 = _t22 & 0x00000001u;
         /* 020D6490 */ if (_t23) goto L_020D6494; else goto L_020D649C;
   L_020D6494: ; // 0x20d6494
@@ -26297,7 +26297,7 @@ void Gambit_fn_020D657C(CPUState* cpu) {
         /* 020D64AC */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t29);
         /* 020D64B0 */ _t30 = cpu->r[1] + 0x00000010u;
         /* 020D64B0 */ cpu->r[30] = rbrew_read32(cpu->mem, _t30);
-        /* 020D64B4 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D64B4 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D64B4 */ _t32 = _t31 & 0x00000001u;
         /* 020D64B4 */ if (_t32) goto L_020D64B8; // else: addr-0 trap, fall-through
   L_020D64B8: ; // 0x20d64b8
@@ -26307,8 +26307,8 @@ void Gambit_fn_020D657C(CPUState* cpu) {
         /* 020D64C0 */ cpu->r[1] = cpu->r[1] + 0x00000038u;
         /* 020D64C4 */ return;
   L_020D657C: ; // 0x20d657c
-        /* 020D657C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020D6580 */ _t34 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D657C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020D6580 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D6580 */ _t35 = _t34 & 0x00000001u;
         /* 020D6580 */ if (_t35) goto L_020D6584; else goto L_020D658C;
   L_020D6584: ; // 0x20d6584
@@ -26317,8 +26317,8 @@ void Gambit_fn_020D657C(CPUState* cpu) {
   L_020D658C: ; // 0x20d658c
         /* 020D658C */ cpu->r[0] = 0x00980000u;
         /* 020D6590 */ cpu->r[0] = cpu->r[0] | 0x0000967Fu;
-        /* 020D6594 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], cpu->r[0]);
-        /* 020D6598 */ _t36 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D6594 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], cpu->r[0]));
+        /* 020D6598 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D6598 */ _t37 = _t36 & 0x00000001u;
         /* 020D6598 */ if (_t37) goto L_020D659C; else goto L_020D65A4;
   L_020D659C: ; // 0x20d659c
@@ -26376,16 +26376,16 @@ void Gambit_fn_020D65A8(CPUState* cpu) {
         /* 020D61E4 */ cpu->r[1] = cpu->r[1] + 0x00000018u;
         /* 020D61E8 */ return;
   L_020D65A8: ; // 0x20d65a8
-        /* 020D65A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020D65AC */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D65A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020D65AC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D65AC */ _t14 = _t13 & 0x00000001u;
         /* 020D65AC */ if (_t14) goto L_020D65B0; else goto L_020D65B8;
   L_020D65B0: ; // 0x20d65b0
         /* 020D65B0 */ cpu->r[4] = 0x00000000u;
         /* 020D65B4 */ goto L_020D617C;
   L_020D65B8: ; // 0x20d65b8
-        /* 020D65B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x0000270Fu);
-        /* 020D65BC */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D65B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x0000270Fu));
+        /* 020D65BC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D65BC */ _t16 = _t15 & 0x00000001u;
         /* 020D65BC */ if (_t16) goto L_020D65C0; else goto L_020D65C4;
   L_020D65C0: ; // 0x20d65c0
@@ -26507,16 +26507,16 @@ void Gambit_fn_020D6618(CPUState* cpu) {
         /* 020D61E4 */ cpu->r[1] = cpu->r[1] + 0x00000018u;
         /* 020D61E8 */ return;
   L_020D6618: ; // 0x20d6618
-        /* 020D6618 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 020D661C */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D6618 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 020D661C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D661C */ _t14 = _t13 & 0x00000001u;
         /* 020D661C */ if (_t14) goto L_020D6620; else goto L_020D6628;
   L_020D6620: ; // 0x20d6620
         /* 020D6620 */ cpu->r[4] = 0x00000000u;
         /* 020D6624 */ goto L_020D617C;
   L_020D6628: ; // 0x20d6628
-        /* 020D6628 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000003E7u);
-        /* 020D662C */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D6628 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000003E7u));
+        /* 020D662C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D662C */ _t16 = _t15 & 0x00000001u;
         /* 020D662C */ if (_t16) goto L_020D6630; else goto L_020D6634;
   L_020D6630: ; // 0x20d6630
@@ -26639,23 +26639,23 @@ void Gambit_fn_020D6688(CPUState* cpu) {
         /* 020D66F4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t12);
         /* 020D66F8 */ _t13 = cpu->r[8] + 0x00000000u;
         /* 020D66F8 */ cpu->r[6] = rbrew_read8(cpu->mem, _t13);
-        /* 020D66FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[31]);
+        /* 020D66FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[31]));
         /* 020D6700 */ cpu->r[10] = 0x00080000u;
-        /* 020D6704 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6704 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6704 */ _t15 = _t14 & 0x00000001u;
         /* 020D6704 */ if (_t15) goto L_020D672C; else goto L_020D6708;
   L_020D6708: ; // 0x20d6708
         /* 020D6708 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020D670C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[10]);
+        /* 020D670C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[10]));
         /* 020D6710 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 020D6714 */ _t16 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D6714 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D6714 */ _t17 = _t16 & 0x00000001u;
         /* 020D6714 */ if (_t17) goto L_020D6728; else goto L_020D6718;
   L_020D6718: ; // 0x20d6718
         /* 020D6718 */ _t18 = cpu->r[8] + 0x00000000u;
         /* 020D6718 */ cpu->r[7] = rbrew_read8(cpu->mem, _t18);
-        /* 020D671C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[31]);
-        /* 020D6720 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D671C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[31]));
+        /* 020D6720 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6720 */ _t20 = _t19 & 0x00000001u;
         /* 020D6720 */ if (_t20) goto L_020D6724; else goto L_020D6708;
   L_020D6724: ; // 0x20d6724
@@ -26667,10 +26667,10 @@ void Gambit_fn_020D6688(CPUState* cpu) {
         /* 020D672C */ cpu->r[12] = rbrew_read32(cpu->mem, _t21);
         /* 020D6730 */ _t22 = cpu->r[1] + 0x0000000Cu;
         /* 020D6730 */ cpu->r[9] = rbrew_read32(cpu->mem, _t22);
-        /* 020D6734 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[12]);
+        /* 020D6734 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[12]));
         /* 020D6738 */ _t23 = cpu->r[9] + 0x00000014u;
         /* 020D6738 */ cpu->r[0] = rbrew_read32(cpu->mem, _t23);
-        /* 020D673C */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D673C */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D673C */ _t25 = _t24 & 0x00000001u;
         /* 020D673C */ if (_t25) goto L_020D6744; else goto L_020D6740;
   L_020D6740: ; // 0x20d6740
@@ -26701,28 +26701,28 @@ void Gambit_fn_020D6688(CPUState* cpu) {
         /* 020D6788 */ _t31 = cpu->r[11] + 0x00000000u;
         /* 020D6788 */ cpu->r[7] = rbrew_read8(cpu->mem, _t31);
         /* 020D678C */ cpu->r[12] = 0x00000000u;
-        /* 020D6790 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[31]);
+        /* 020D6790 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[31]));
         /* 020D6794 */ cpu->r[5] = 0x00080000u;
-        /* 020D6798 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6798 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6798 */ _t33 = _t32 & 0x00000001u;
         /* 020D6798 */ if (_t33) goto L_020D67D0; else goto L_020D679C;
   L_020D679C: ; // 0x20d679c
         /* 020D679C */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 020D67A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[5]);
+        /* 020D67A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[5]));
         /* 020D67A4 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 020D67A8 */ _t34 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D67A8 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D67A8 */ _t35 = _t34 & 0x00000001u;
         /* 020D67A8 */ if (_t35) goto L_020D67C4; else goto L_020D67AC;
   L_020D67AC: ; // 0x20d67ac
         /* 020D67AC */ _t36 = cpu->r[11] + 0x00000000u;
         /* 020D67AC */ cpu->r[9] = rbrew_read8(cpu->mem, _t36);
-        /* 020D67B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[31]);
-        /* 020D67B4 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D67B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[31]));
+        /* 020D67B4 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D67B4 */ _t38 = _t37 & 0x00000001u;
         /* 020D67B4 */ if (_t38) goto L_020D67B8; else goto L_020D679C;
   L_020D67B8: ; // 0x20d67b8
-        /* 020D67B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000002u);
-        /* 020D67BC */ _t39 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D67B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000002u));
+        /* 020D67BC */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D67BC */ _t40 = _t39 & 0x00000001u;
         /* 020D67BC */ if (_t40) goto L_020D67D8; else goto L_020D67C0;
   L_020D67C0: ; // 0x20d67c0
@@ -26732,8 +26732,8 @@ void Gambit_fn_020D6688(CPUState* cpu) {
         /* 020D67C8 */ cpu->r[30] = cpu->r[12];
         /* 020D67CC */ goto L_020D67DC;
   L_020D67D0: ; // 0x20d67d0
-        /* 020D67D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000002u);
-        /* 020D67D4 */ _t41 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D67D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000002u));
+        /* 020D67D4 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D67D4 */ _t42 = _t41 & 0x00000001u;
         /* 020D67D4 */ if (_t42) goto L_020D67D8; else goto L_020D67DC;
   L_020D67D8: ; // 0x20d67d8
@@ -26772,7 +26772,7 @@ void Gambit_fn_020D6688(CPUState* cpu) {
         /* 020D682C */ _t52 = cpu->r[28] + 0x00000218u;
         /* 020D682C */ cpu->r[6] = rbrew_read32(cpu->mem, _t52);
         /* 020D6830 */ cpu->r[3] = cpu->r[1] + 0x00000010u;
-        /* 020D6834 */ _t53 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 020D6834 */ _t53 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 020D6834 */ _t54 = _t53 & 0x00000001u;
         /* 020D6834 */ if (_t54) goto L_020D6838; // else: addr-0 trap, fall-through
   L_020D6838: ; // 0x20d6838
@@ -26782,9 +26782,9 @@ void Gambit_fn_020D6688(CPUState* cpu) {
         /* 020D6844 */ Gambit_fn_026D86B0(cpu);
         /* 020D6848 */ _t55 = cpu->r[23] + 0xFFFFDBA0u;
         /* 020D6848 */ cpu->r[10] = rbrew_read32(cpu->mem, _t55);
-        /* 020D684C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 020D684C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 020D6850 */ cpu->r[29] = cpu->r[3];
-        /* 020D6854 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6854 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6854 */ _t57 = _t56 & 0x00000001u;
         /* 020D6854 */ if (_t57) goto L_020D6858; else goto L_020D6868;
   L_020D6858: ; // 0x20d6858
@@ -26795,8 +26795,8 @@ void Gambit_fn_020D6688(CPUState* cpu) {
         /* 020D6864 */ _t59 = cpu->r[22] + 0xFFFFED90u;
         /* 020D6864 */ rbrew_write32(cpu->mem, _t59, cpu->r[0]);
   L_020D6868: ; // 0x20d6868
-        /* 020D6868 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020D686C */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6868 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020D686C */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D686C */ _t61 = _t60 & 0x00000001u;
         /* 020D686C */ if (_t61) goto L_020D68C4; else goto L_020D6870;
   L_020D6870: ; // 0x20d6870
@@ -26808,21 +26808,21 @@ void Gambit_fn_020D6688(CPUState* cpu) {
         /* 020D687C */ cpu->r[3] = cpu->r[29];
         /* 020D6880 */ cpu->r[4] = cpu->r[22] + 0xFFFFED90u;
         /* 020D6884 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 020D6888 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D688C */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6888 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D688C */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D688C */ _t65 = _t64 & 0x00000001u;
         /* 020D688C */ if (_t65) goto L_020D68C4; else goto L_020D6890;
   L_020D6890: ; // 0x20d6890
-        /* 020D6890 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 020D6894 */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6890 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 020D6894 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6894 */ _t67 = _t66 & 0x00000001u;
         /* 020D6894 */ if (_t67) goto L_020D68C4; else goto L_020D6898;
   L_020D6898: ; // 0x20d6898
         /* 020D6898 */ _t68 = cpu->r[28] + 0x00000218u;
         /* 020D6898 */ cpu->r[8] = rbrew_read32(cpu->mem, _t68);
-        /* 020D689C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000008u);
+        /* 020D689C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000008u));
         /* 020D68A0 */ cpu->r[11] = cpu->r[28] + 0x0000021Cu;
-        /* 020D68A4 */ _t69 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D68A4 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D68A4 */ _t70 = _t69 & 0x00000001u;
         /* 020D68A4 */ if (_t70) goto L_020D68A8; else goto L_020D68B0;
   L_020D68A8: ; // 0x20d68a8
@@ -26927,8 +26927,8 @@ void Gambit_fn_020D6910(CPUState* cpu) {
         /* 020D694C */ _t4 = cpu->r[1] + 0x00000034u;
         /* 020D694C */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 020D6950 */ Gambit_fn_026D6F78(cpu);
-        /* 020D6954 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D6958 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6954 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D6958 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6958 */ _t6 = _t5 & 0x00000001u;
         /* 020D6958 */ if (_t6) goto L_020D6C4C; else goto L_020D695C;
   L_020D695C: ; // 0x20d695c
@@ -26964,8 +26964,8 @@ void Gambit_fn_020D6910(CPUState* cpu) {
         /* 020D69A8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020D69AC */ _t17 = cpu->r[1] + 0x00000014u;
         /* 020D69AC */ cpu->r[7] = rbrew_read32(cpu->mem, _t17);
-        /* 020D69B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[7]);
-        /* 020D69B4 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D69B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[7]));
+        /* 020D69B4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D69B4 */ _t19 = _t18 & 0x00000001u;
         /* 020D69B4 */ if (_t19) goto L_020D69FC; else goto L_020D69B8;
   L_020D69B8: ; // 0x20d69b8
@@ -26986,13 +26986,13 @@ void Gambit_fn_020D6910(CPUState* cpu) {
         /* 020D69DC */ _t24 = cpu->r[10] + 0x00000001u;
         /* 020D69DC */ cpu->r[8] = rbrew_read8(cpu->mem, _t24);
         /* 020D69DC */ cpu->r[10] = _t24;
-        /* 020D69E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[8]);
-        /* 020D69E4 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D69E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[8]));
+        /* 020D69E4 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D69E4 */ _t26 = _t25 & 0x00000001u;
         /* 020D69E4 */ if (_t26) goto L_020D69E8; else goto L_020D6A34;
   L_020D69E8: ; // 0x20d69e8
-        /* 020D69E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[31]);
-        /* 020D69EC */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D69E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[31]));
+        /* 020D69EC */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D69EC */ _t28 = _t27 & 0x00000001u;
         /* 020D69EC */ if (_t28) goto L_020D69FC; else goto L_020D69F0;
   L_020D69F0: ; // 0x20d69f0
@@ -27057,8 +27057,8 @@ void Gambit_fn_020D6910(CPUState* cpu) {
         /* 020D6A88 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020D6A8C */ _t45 = cpu->r[1] + 0x0000001Cu;
         /* 020D6A8C */ cpu->r[9] = rbrew_read32(cpu->mem, _t45);
-        /* 020D6A90 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[9]);
-        /* 020D6A94 */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6A90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[9]));
+        /* 020D6A94 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6A94 */ _t47 = _t46 & 0x00000001u;
         /* 020D6A94 */ if (_t47) goto L_020D6B58; else goto L_020D6A98;
   L_020D6A98: ; // 0x20d6a98
@@ -27074,13 +27074,13 @@ void Gambit_fn_020D6910(CPUState* cpu) {
         /* 020D6AAC */ _t51 = cpu->r[7] + 0x00000001u;
         /* 020D6AAC */ cpu->r[10] = rbrew_read8(cpu->mem, _t51);
         /* 020D6AAC */ cpu->r[7] = _t51;
-        /* 020D6AB0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[10]);
-        /* 020D6AB4 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6AB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[10]));
+        /* 020D6AB4 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6AB4 */ _t53 = _t52 & 0x00000001u;
         /* 020D6AB4 */ if (_t53) goto L_020D6AB8; else goto L_020D6AC8;
   L_020D6AB8: ; // 0x20d6ab8
-        /* 020D6AB8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[31]);
-        /* 020D6ABC */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6AB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[31]));
+        /* 020D6ABC */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6ABC */ _t55 = _t54 & 0x00000001u;
         /* 020D6ABC */ if (_t55) goto L_020D6B58; else goto L_020D6AC0;
   L_020D6AC0: ; // 0x20d6ac0
@@ -27123,8 +27123,8 @@ void Gambit_fn_020D6910(CPUState* cpu) {
         /* 020D6B18 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020D6B1C */ _t68 = cpu->r[1] + 0x0000002Cu;
         /* 020D6B1C */ cpu->r[12] = rbrew_read32(cpu->mem, _t68);
-        /* 020D6B20 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[12]);
-        /* 020D6B24 */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6B20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[12]));
+        /* 020D6B24 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6B24 */ _t70 = _t69 & 0x00000001u;
         /* 020D6B24 */ if (_t70) goto L_020D6B58; else goto L_020D6B28;
   L_020D6B28: ; // 0x20d6b28
@@ -27138,13 +27138,13 @@ void Gambit_fn_020D6910(CPUState* cpu) {
         /* 020D6B38 */ _t73 = cpu->r[9] + 0x00000001u;
         /* 020D6B38 */ cpu->r[12] = rbrew_read8(cpu->mem, _t73);
         /* 020D6B38 */ cpu->r[9] = _t73;
-        /* 020D6B3C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 020D6B40 */ _t74 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6B3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 020D6B40 */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6B40 */ _t75 = _t74 & 0x00000001u;
         /* 020D6B40 */ if (_t75) goto L_020D6B44; else goto L_020D6B54;
   L_020D6B44: ; // 0x20d6b44
-        /* 020D6B44 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020D6B48 */ _t76 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6B44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020D6B48 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6B48 */ _t77 = _t76 & 0x00000001u;
         /* 020D6B48 */ if (_t77) goto L_020D6B58; else goto L_020D6B4C;
   L_020D6B4C: ; // 0x20d6b4c
@@ -27157,8 +27157,8 @@ void Gambit_fn_020D6910(CPUState* cpu) {
   L_020D6B54: ; // 0x20d6b54
         /* 020D6B54 */ cpu->r[26] = 0x00000000u;
   L_020D6B58: ; // 0x20d6b58
-        /* 020D6B58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 020D6B5C */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6B58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 020D6B5C */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6B5C */ _t82 = _t81 & 0x00000001u;
         /* 020D6B5C */ if (_t82) goto L_020D6B98; else goto L_020D6B60;
   L_020D6B60: ; // 0x20d6b60
@@ -27212,8 +27212,8 @@ void Gambit_fn_020D6910(CPUState* cpu) {
         /* 020D6BE4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 020D6BE8 */ _t96 = cpu->r[1] + 0x00000024u;
         /* 020D6BE8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t96);
-        /* 020D6BEC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
-        /* 020D6BF0 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6BEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
+        /* 020D6BF0 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6BF0 */ _t98 = _t97 & 0x00000001u;
         /* 020D6BF0 */ if (_t98) goto L_020D6C34; else goto L_020D6BF4;
   L_020D6BF4: ; // 0x20d6bf4
@@ -27229,13 +27229,13 @@ void Gambit_fn_020D6910(CPUState* cpu) {
         /* 020D6C08 */ _t102 = cpu->r[11] + 0x00000001u;
         /* 020D6C08 */ cpu->r[12] = rbrew_read8(cpu->mem, _t102);
         /* 020D6C08 */ cpu->r[11] = _t102;
-        /* 020D6C0C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 020D6C10 */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6C0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 020D6C10 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6C10 */ _t104 = _t103 & 0x00000001u;
         /* 020D6C10 */ if (_t104) goto L_020D6C14; else goto L_020D6C4C;
   L_020D6C14: ; // 0x20d6c14
-        /* 020D6C14 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 020D6C18 */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6C14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 020D6C18 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6C18 */ _t106 = _t105 & 0x00000001u;
         /* 020D6C18 */ if (_t106) goto L_020D6C34; else goto L_020D6C1C;
   L_020D6C1C: ; // 0x20d6c1c
@@ -27248,8 +27248,8 @@ void Gambit_fn_020D6910(CPUState* cpu) {
   L_020D6C24: ; // 0x20d6c24
         /* 020D6C24 */ _t110 = cpu->r[29] + 0x00000240u;
         /* 020D6C24 */ cpu->r[0] = rbrew_read32(cpu->mem, _t110);
-        /* 020D6C28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 020D6C2C */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6C28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 020D6C2C */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6C2C */ _t112 = _t111 & 0x00000001u;
         /* 020D6C2C */ if (_t112) goto L_020D6C30; else goto L_020D6C84;
   L_020D6C30: ; // 0x20d6c30
@@ -27266,8 +27266,8 @@ void Gambit_fn_020D6910(CPUState* cpu) {
   L_020D6C4C: ; // 0x20d6c4c
         /* 020D6C4C */ _t115 = cpu->r[29] + 0x00000240u;
         /* 020D6C4C */ cpu->r[0] = rbrew_read32(cpu->mem, _t115);
-        /* 020D6C50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 020D6C54 */ _t116 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6C50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 020D6C54 */ _t116 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6C54 */ _t117 = _t116 & 0x00000001u;
         /* 020D6C54 */ if (_t117) goto L_020D6C58; else goto L_020D6C84;
   L_020D6C58: ; // 0x20d6c58
@@ -27285,8 +27285,8 @@ void Gambit_fn_020D6910(CPUState* cpu) {
         /* 020D6C7C */ Gambit_fn_027B70B8(cpu);
         /* 020D6C80 */ goto L_020D6CE8;
   L_020D6C84: ; // 0x20d6c84
-        /* 020D6C84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 020D6C88 */ _t120 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6C84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 020D6C88 */ _t120 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6C88 */ _t121 = _t120 & 0x00000001u;
         /* 020D6C88 */ if (_t121) goto L_020D6C8C; else goto L_020D6CB8;
   L_020D6C8C: ; // 0x20d6c8c
@@ -27304,8 +27304,8 @@ void Gambit_fn_020D6910(CPUState* cpu) {
         /* 020D6CB0 */ Gambit_fn_027B70B8(cpu);
         /* 020D6CB4 */ goto L_020D6CE8;
   L_020D6CB8: ; // 0x20d6cb8
-        /* 020D6CB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 020D6CBC */ _t124 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6CB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 020D6CBC */ _t124 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6CBC */ _t125 = _t124 & 0x00000001u;
         /* 020D6CBC */ if (_t125) goto L_020D6CC0; else goto L_020D6CC8;
   L_020D6CC0: ; // 0x20d6cc0
@@ -27420,10 +27420,10 @@ void Gambit_fn_020D6CFC(CPUState* cpu) {
         /* 020D6DC4 */ cpu->f[31] = cpu->f[10] - cpu->f[13];
         /* 020D6DC8 */ _t30 = cpu->r[11] + 0xFFFF8D98u;
         /* 020D6DC8 */ cpu->f[12] = rbrew_read_f64(cpu->mem, _t30);
-        /* 020D6DCC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[11]);
+        /* 020D6DCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[11]));
         /* 020D6DD0 */ cpu->f[27] = cpu->f[12] * cpu->f[28];
         /* 020D6DD4 */ cpu->r[30] = cpu->r[31] + 0x0000021Cu;
-        /* 020D6DD8 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D6DD8 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D6DD8 */ _t32 = _t31 & 0x00000001u;
         /* 020D6DD8 */ if (_t32) goto L_020D6E08; else goto L_020D6DDC;
   L_020D6DDC: ; // 0x20d6ddc
@@ -27432,8 +27432,8 @@ void Gambit_fn_020D6CFC(CPUState* cpu) {
         /* 020D6DE0 */ cpu->f[13] = cpu->f[31] - cpu->f[11];
         /* 020D6DE4 */ cpu->f[9] = fabs(cpu->f[7]);
         /* 020D6DE8 */ cpu->f[0] = fabs(cpu->f[13]);
-        /* 020D6DEC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[9]);
-        /* 020D6DF0 */ _t34 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D6DEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[9]));
+        /* 020D6DF0 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D6DF0 */ _t35 = _t34 & 0x00000001u;
         /* 020D6DF0 */ if (_t35) goto L_020D6E08; else goto L_020D6DF4;
   L_020D6DF4: ; // 0x20d6df4
@@ -27445,8 +27445,8 @@ void Gambit_fn_020D6CFC(CPUState* cpu) {
         /* 020D6E04 */ _t37 = cpu->r[31] + 0x00000248u;
         /* 020D6E04 */ cpu->f[11] = rbrew_read_f64(cpu->mem, _t37);
   L_020D6E08: ; // 0x20d6e08
-        /* 020D6E08 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
-        /* 020D6E0C */ _t38 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D6E08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
+        /* 020D6E0C */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D6E0C */ _t39 = _t38 & 0x00000001u;
         /* 020D6E0C */ if (_t39) goto L_020D6E10; else goto L_020D6E28;
   L_020D6E10: ; // 0x20d6e10
@@ -27459,8 +27459,8 @@ void Gambit_fn_020D6CFC(CPUState* cpu) {
         /* 020D6E20 */ rbrew_write_f64(cpu->mem, _t41, cpu->f[11]);
         /* 020D6E24 */ goto L_020D6E44;
   L_020D6E28: ; // 0x20d6e28
-        /* 020D6E28 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
-        /* 020D6E2C */ _t42 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D6E28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
+        /* 020D6E2C */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D6E2C */ _t43 = _t42 & 0x00000001u;
         /* 020D6E2C */ if (_t43) goto L_020D6E30; else goto L_020D6E44;
   L_020D6E30: ; // 0x20d6e30
@@ -27500,20 +27500,20 @@ void Gambit_fn_020D6CFC(CPUState* cpu) {
         /* 020D6E8C */ cpu->r[3] = rbrew_read32(cpu->mem, _t52);
         /* 020D6E90 */ Gambit_fn_020D76D0(cpu);
         /* 020D6E94 */ cpu->r[11] = 0x10020000u;
-        /* 020D6E98 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[26], cpu->f[27]);
+        /* 020D6E98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[26], cpu->f[27]));
         /* 020D6E9C */ _t53 = cpu->r[11] + 0xFFFF8D20u;
         /* 020D6E9C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t53);
         /* 020D6EA0 */ _t54 = cpu->r[31] + 0x00000218u;
         /* 020D6EA0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t54);
-        /* 020D6EA4 */ _t55 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D6EA4 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D6EA4 */ _t56 = _t55 & 0x00000001u;
         /* 020D6EA4 */ if (_t56) goto L_020D6EA8; else goto L_020D6EC0;
   L_020D6EA8: ; // 0x20d6ea8
         /* 020D6EA8 */ cpu->r[28] = 0x00000001u;
         /* 020D6EAC */ cpu->f[0] = cpu->f[26] - cpu->f[27];
-        /* 020D6EB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], cpu->r[7]);
+        /* 020D6EB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], cpu->r[7]));
         /* 020D6EB4 */ cpu->f[25] = cpu->f[29];
-        /* 020D6EB8 */ _t57 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D6EB8 */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D6EB8 */ _t58 = _t57 & 0x00000001u;
         /* 020D6EB8 */ if (_t58) goto L_020D6EBC; else goto L_020D6FF8;
   L_020D6EBC: ; // 0x20d6ebc
@@ -27521,9 +27521,9 @@ void Gambit_fn_020D6CFC(CPUState* cpu) {
   L_020D6EC0: ; // 0x20d6ec0
         /* 020D6EC0 */ cpu->r[28] = 0x00000001u;
         /* 020D6EC4 */ cpu->f[0] = cpu->f[31];
-        /* 020D6EC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], cpu->r[7]);
+        /* 020D6EC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], cpu->r[7]));
         /* 020D6ECC */ cpu->f[25] = cpu->f[29];
-        /* 020D6ED0 */ _t59 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D6ED0 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D6ED0 */ _t60 = _t59 & 0x00000001u;
         /* 020D6ED0 */ if (_t60) goto L_020D6ED4; else goto L_020D6FF8;
   L_020D6ED4: ; // 0x20d6ed4
@@ -27545,9 +27545,9 @@ void Gambit_fn_020D6CFC(CPUState* cpu) {
         /* 020D6F04 */ /* nop */
         /* 020D6F08 */ cpu->r[12] = cpu->r[12] - cpu->r[8];
         /* 020D6F0C */ cpu->r[12] = (uint32_t)((int32_t)cpu->r[12] * (int32_t)0x0000000Au);
-        /* 020D6F10 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000008u);
+        /* 020D6F10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000008u));
         /* 020D6F14 */ cpu->r[0] = cpu->r[11] - cpu->r[12];
-        /* 020D6F18 */ _t63 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D6F18 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D6F18 */ _t64 = _t63 & 0x00000001u;
         /* 020D6F18 */ if (_t64) goto L_020D6F1C; else goto L_020D6F58;
   L_020D6F1C: ; // 0x20d6f1c
@@ -27568,9 +27568,9 @@ void Gambit_fn_020D6CFC(CPUState* cpu) {
         /* 020D6F40 */ _t70 = cpu->r[1] + 0x00000008u;
         /* 020D6F40 */ cpu->f[13] = rbrew_read_f64(cpu->mem, _t70);
         /* 020D6F44 */ cpu->f[8] = cpu->f[13] - cpu->f[10];
-        /* 020D6F48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000008u);
+        /* 020D6F48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000008u));
         /* 020D6F4C */ cpu->f[26] = fma(cpu->f[8], cpu->f[7], cpu->f[0]);
-        /* 020D6F50 */ _t71 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D6F50 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D6F50 */ _t72 = _t71 & 0x00000001u;
         /* 020D6F50 */ if (_t72) goto L_020D6F90; else goto L_020D6F54;
   L_020D6F54: ; // 0x20d6f54
@@ -27593,9 +27593,9 @@ void Gambit_fn_020D6CFC(CPUState* cpu) {
         /* 020D6F7C */ _t78 = cpu->r[1] + 0x00000008u;
         /* 020D6F7C */ cpu->f[13] = rbrew_read_f64(cpu->mem, _t78);
         /* 020D6F80 */ cpu->f[8] = cpu->f[13] - cpu->f[10];
-        /* 020D6F84 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000008u);
+        /* 020D6F84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000008u));
         /* 020D6F88 */ cpu->f[26] = fma(cpu->f[8], cpu->f[7], cpu->f[0]);
-        /* 020D6F8C */ _t79 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D6F8C */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D6F8C */ _t80 = _t79 & 0x00000001u;
         /* 020D6F8C */ if (_t80) goto L_020D6F90; else goto L_020D6FAC;
   L_020D6F90: ; // 0x20d6f90
@@ -27603,10 +27603,10 @@ void Gambit_fn_020D6CFC(CPUState* cpu) {
         /* 020D6F94 */ _t81 = cpu->r[30] + cpu->r[29];
         /* 020D6F94 */ cpu->r[3] = rbrew_read32(cpu->mem, _t81);
         /* 020D6F98 */ Gambit_fn_020D76D0(cpu);
-        /* 020D6F9C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[26], cpu->f[27]);
+        /* 020D6F9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[26], cpu->f[27]));
         /* 020D6FA0 */ _t82 = cpu->r[31] + 0x00000218u;
         /* 020D6FA0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t82);
-        /* 020D6FA4 */ _t83 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D6FA4 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D6FA4 */ _t84 = _t83 & 0x00000001u;
         /* 020D6FA4 */ if (_t84) goto L_020D6FA8; else goto L_020D6FE0;
   L_020D6FA8: ; // 0x20d6fa8
@@ -27616,19 +27616,19 @@ void Gambit_fn_020D6CFC(CPUState* cpu) {
         /* 020D6FB0 */ _t85 = cpu->r[30] + 0x00000000u;
         /* 020D6FB0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t85);
         /* 020D6FB4 */ Gambit_fn_020D76D0(cpu);
-        /* 020D6FB8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[26], cpu->f[27]);
+        /* 020D6FB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[26], cpu->f[27]));
         /* 020D6FBC */ _t86 = cpu->r[31] + 0x00000218u;
         /* 020D6FBC */ cpu->r[7] = rbrew_read32(cpu->mem, _t86);
-        /* 020D6FC0 */ _t87 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020D6FC0 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020D6FC0 */ _t88 = _t87 & 0x00000001u;
         /* 020D6FC0 */ if (_t88) goto L_020D6FC4; else goto L_020D6FE0;
   L_020D6FC4: ; // 0x20d6fc4
         /* 020D6FC4 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
         /* 020D6FC8 */ cpu->f[0] = cpu->f[26] - cpu->f[27];
         /* 020D6FCC */ cpu->r[29] = cpu->r[29] + 0x00000004u;
-        /* 020D6FD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], cpu->r[7]);
+        /* 020D6FD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], cpu->r[7]));
         /* 020D6FD4 */ cpu->f[25] = cpu->f[25] * cpu->f[29];
-        /* 020D6FD8 */ _t89 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D6FD8 */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D6FD8 */ _t90 = _t89 & 0x00000001u;
         /* 020D6FD8 */ if (_t90) goto L_020D6ED8; else goto L_020D6FDC;
   L_020D6FDC: ; // 0x20d6fdc
@@ -27637,9 +27637,9 @@ void Gambit_fn_020D6CFC(CPUState* cpu) {
         /* 020D6FE0 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
         /* 020D6FE4 */ cpu->f[0] = cpu->f[31];
         /* 020D6FE8 */ cpu->r[29] = cpu->r[29] + 0x00000004u;
-        /* 020D6FEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], cpu->r[7]);
+        /* 020D6FEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], cpu->r[7]));
         /* 020D6FF0 */ cpu->f[25] = cpu->f[25] * cpu->f[29];
-        /* 020D6FF4 */ _t91 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D6FF4 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D6FF4 */ _t92 = _t91 & 0x00000001u;
         /* 020D6FF4 */ if (_t92) goto L_020D6ED8; else goto L_020D6FF8;
   L_020D6FF8: ; // 0x20d6ff8
@@ -27679,7 +27679,7 @@ void Gambit_fn_020D6CFC(CPUState* cpu) {
         /* 020D7038 */ cpu->r[31] = rbrew_read32(cpu->mem, _t109);
         /* 020D703C */ _t110 = cpu->r[1] + 0x00000018u;
         /* 020D703C */ cpu->r[30] = rbrew_read32(cpu->mem, _t110);
-        /* 020D7040 */ _t111 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020D7040 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020D7040 */ _t112 = _t111 & 0x00000001u;
         /* 020D7040 */ if (_t112) goto L_020D7044; // else: addr-0 trap, fall-through
   L_020D7044: ; // 0x20d7044
@@ -27721,15 +27721,15 @@ void Gambit_fn_020D7090(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D7090: ; // 0x20d7090
-        /* 020D7090 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D7094 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D7090 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D7094 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D7094 */ _t1 = _t0 & 0x00000001u;
         /* 020D7094 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D7094 */ goto L_020D7098;
   L_020D7098: ; // 0x20d7098
         /* 020D7098 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D7098 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D709C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D7098 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D709C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D709C */ _t3 = _t2 & 0x00000001u;
         /* 020D709C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D709C */ goto L_020D70A0;
@@ -27748,8 +27748,8 @@ void Gambit_fn_020D7090(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -27763,15 +27763,15 @@ void Gambit_fn_020D7090(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -27808,11 +27808,11 @@ void Gambit_fn_020D70A4(CPUState* cpu) {
         /* 020D70B0 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D70B0 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D70B4 */ cpu->r[30] = cpu->r[3];
-        /* 020D70B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D70B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D70B8 */ cpu->r[31] = cpu->r[4];
         /* 020D70BC */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D70BC */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D70C0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D70C0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D70C0 */ _t5 = _t4 & 0x00000001u;
         /* 020D70C0 */ if (_t5) goto L_020D7104; else goto L_020D70C4;
   L_020D70C4: ; // 0x20d70c4
@@ -27832,8 +27832,8 @@ void Gambit_fn_020D70A4(CPUState* cpu) {
         /* 020D70EC */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D70F0 */ Gambit_fn_02068798(cpu);
         /* 020D70F4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D70F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D70F8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D70F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D70F8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D70F8 */ _t10 = _t9 & 0x00000001u;
         /* 020D70F8 */ if (_t10) goto L_020D7104; else goto L_020D70FC;
   L_020D70FC: ; // 0x20d70fc
@@ -27864,11 +27864,11 @@ void Gambit_fn_020D70A8(CPUState* cpu) {
         /* 020D70B0 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 020D70B0 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 020D70B4 */ cpu->r[30] = cpu->r[3];
-        /* 020D70B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 020D70B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 020D70B8 */ cpu->r[31] = cpu->r[4];
         /* 020D70BC */ _t3 = cpu->r[1] + 0x00000014u;
         /* 020D70BC */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 020D70C0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D70C0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D70C0 */ _t5 = _t4 & 0x00000001u;
         /* 020D70C0 */ if (_t5) goto L_020D7104; else goto L_020D70C4;
   L_020D70C4: ; // 0x20d70c4
@@ -27888,8 +27888,8 @@ void Gambit_fn_020D70A8(CPUState* cpu) {
         /* 020D70EC */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 020D70F0 */ Gambit_fn_02068798(cpu);
         /* 020D70F4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[31], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D70F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D70F8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D70F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D70F8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D70F8 */ _t10 = _t9 & 0x00000001u;
         /* 020D70F8 */ if (_t10) goto L_020D7104; else goto L_020D70FC;
   L_020D70FC: ; // 0x20d70fc
@@ -27944,15 +27944,15 @@ void Gambit_fn_020D7134(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D7134: ; // 0x20d7134
-        /* 020D7134 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D7138 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D7134 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D7138 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D7138 */ _t1 = _t0 & 0x00000001u;
         /* 020D7138 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D7138 */ goto L_020D713C;
   L_020D713C: ; // 0x20d713c
         /* 020D713C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D713C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D7140 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D713C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D7140 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D7140 */ _t3 = _t2 & 0x00000001u;
         /* 020D7140 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D7140 */ goto L_020D7144;
@@ -27971,8 +27971,8 @@ void Gambit_fn_020D7134(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -27986,15 +27986,15 @@ void Gambit_fn_020D7134(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -28040,15 +28040,15 @@ void Gambit_fn_020D7164(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D7164: ; // 0x20d7164
-        /* 020D7164 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D7168 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D7164 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D7168 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D7168 */ _t1 = _t0 & 0x00000001u;
         /* 020D7168 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D7168 */ goto L_020D716C;
   L_020D716C: ; // 0x20d716c
         /* 020D716C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D716C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D7170 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D716C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D7170 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D7170 */ _t3 = _t2 & 0x00000001u;
         /* 020D7170 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D7170 */ goto L_020D7174;
@@ -28067,8 +28067,8 @@ void Gambit_fn_020D7164(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -28082,15 +28082,15 @@ void Gambit_fn_020D7164(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -28118,15 +28118,15 @@ void Gambit_fn_020D7178(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D7178: ; // 0x20d7178
-        /* 020D7178 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D717C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D7178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D717C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D717C */ _t1 = _t0 & 0x00000001u;
         /* 020D717C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D717C */ goto L_020D7180;
   L_020D7180: ; // 0x20d7180
         /* 020D7180 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D7180 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D7184 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D7180 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D7184 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D7184 */ _t3 = _t2 & 0x00000001u;
         /* 020D7184 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D7184 */ goto L_020D7188;
@@ -28145,8 +28145,8 @@ void Gambit_fn_020D7178(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -28160,15 +28160,15 @@ void Gambit_fn_020D7178(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -28196,15 +28196,15 @@ void Gambit_fn_020D718C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D718C: ; // 0x20d718c
-        /* 020D718C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D7190 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D718C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D7190 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D7190 */ _t1 = _t0 & 0x00000001u;
         /* 020D7190 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D7190 */ goto L_020D7194;
   L_020D7194: ; // 0x20d7194
         /* 020D7194 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D7194 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D7198 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D7194 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D7198 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D7198 */ _t3 = _t2 & 0x00000001u;
         /* 020D7198 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D7198 */ goto L_020D719C;
@@ -28223,8 +28223,8 @@ void Gambit_fn_020D718C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -28238,15 +28238,15 @@ void Gambit_fn_020D718C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -28274,15 +28274,15 @@ void Gambit_fn_020D71A0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_020D71A0: ; // 0x20d71a0
-        /* 020D71A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 020D71A4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D71A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 020D71A4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D71A4 */ _t1 = _t0 & 0x00000001u;
         /* 020D71A4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D71A4 */ goto L_020D71A8;
   L_020D71A8: ; // 0x20d71a8
         /* 020D71A8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 020D71A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020D71AC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020D71A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020D71AC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020D71AC */ _t3 = _t2 & 0x00000001u;
         /* 020D71AC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 020D71AC */ goto L_020D71B0;
@@ -28301,8 +28301,8 @@ void Gambit_fn_020D71A0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -28316,15 +28316,15 @@ void Gambit_fn_020D71A0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
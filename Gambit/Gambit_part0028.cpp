@@ -35,10 +35,10 @@ void Gambit_fn_021BF50C(CPUState* cpu) {
         /* 021BF50C */ cpu->r[12] = 0x101D0000u;
         /* 021BF510 */ _t0 = cpu->r[12] + 0xFFFFD9ECu;
         /* 021BF510 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 021BF514 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021BF514 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021BF518 */ cpu->r[12] = 0x101D0000u;
         /* 021BF51C */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021BF520 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF520 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF520 */ _t2 = _t1 & 0x00000001u;
         /* 021BF520 */ if (_t2) goto L_021BF524; else goto L_021BF53C;
   L_021BF524: ; // 0x21bf524
@@ -51,8 +51,8 @@ void Gambit_fn_021BF50C(CPUState* cpu) {
         /* 021BF538 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 021BF538 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_021BF53C: ; // 0x21bf53c
-        /* 021BF53C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021BF540 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF53C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021BF540 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF540 */ _t6 = _t5 & 0x00000001u;
         /* 021BF540 */ if (_t6) goto L_021BF544; else goto L_021BF54C;
   L_021BF544: ; // 0x21bf544
@@ -64,9 +64,9 @@ void Gambit_fn_021BF50C(CPUState* cpu) {
         /* 021BF550 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 021BF550 */ cpu->r[11] = _t7;
         /* 021BF554 */ cpu->r[10] = 0x101D0000u;
-        /* 021BF558 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021BF558 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021BF55C */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021BF560 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF560 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF560 */ _t9 = _t8 & 0x00000001u;
         /* 021BF560 */ if (_t9) goto L_021BF564; else goto L_021BF578;
   L_021BF564: ; // 0x21bf564
@@ -78,8 +78,8 @@ void Gambit_fn_021BF50C(CPUState* cpu) {
         /* 021BF574 */ _t11 = cpu->r[10] + 0x00000000u;
         /* 021BF574 */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
   L_021BF578: ; // 0x21bf578
-        /* 021BF578 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021BF57C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF578 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021BF57C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF57C */ _t13 = _t12 & 0x00000001u;
         /* 021BF57C */ if (_t13) goto L_021BF580; else goto L_021BF588;
   L_021BF580: ; // 0x21bf580
@@ -91,9 +91,9 @@ void Gambit_fn_021BF50C(CPUState* cpu) {
         /* 021BF58C */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 021BF58C */ cpu->r[8] = _t14;
         /* 021BF590 */ cpu->r[11] = 0x101D0000u;
-        /* 021BF594 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021BF594 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021BF598 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021BF59C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF59C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF59C */ _t16 = _t15 & 0x00000001u;
         /* 021BF59C */ if (_t16) goto L_021BF5A0; else goto L_021BF5B4;
   L_021BF5A0: ; // 0x21bf5a0
@@ -280,15 +280,15 @@ void Gambit_fn_021BF66C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021BF66C: ; // 0x21bf66c
-        /* 021BF66C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021BF670 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF66C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021BF670 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF670 */ _t1 = _t0 & 0x00000001u;
         /* 021BF670 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021BF670 */ goto L_021BF674;
   L_021BF674: ; // 0x21bf674
         /* 021BF674 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021BF674 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021BF678 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF674 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021BF678 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF678 */ _t3 = _t2 & 0x00000001u;
         /* 021BF678 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021BF678 */ goto L_021BF67C;
@@ -307,8 +307,8 @@ void Gambit_fn_021BF66C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -322,15 +322,15 @@ void Gambit_fn_021BF66C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -358,15 +358,15 @@ void Gambit_fn_021BF680(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021BF680: ; // 0x21bf680
-        /* 021BF680 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021BF684 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF680 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021BF684 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF684 */ _t1 = _t0 & 0x00000001u;
         /* 021BF684 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021BF684 */ goto L_021BF688;
   L_021BF688: ; // 0x21bf688
         /* 021BF688 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021BF688 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021BF68C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF688 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021BF68C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF68C */ _t3 = _t2 & 0x00000001u;
         /* 021BF68C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021BF68C */ goto L_021BF690;
@@ -385,8 +385,8 @@ void Gambit_fn_021BF680(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -400,15 +400,15 @@ void Gambit_fn_021BF680(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -436,15 +436,15 @@ void Gambit_fn_021BF694(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021BF694: ; // 0x21bf694
-        /* 021BF694 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021BF698 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF694 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021BF698 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF698 */ _t1 = _t0 & 0x00000001u;
         /* 021BF698 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021BF698 */ goto L_021BF69C;
   L_021BF69C: ; // 0x21bf69c
         /* 021BF69C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021BF69C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021BF6A0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF69C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021BF6A0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF6A0 */ _t3 = _t2 & 0x00000001u;
         /* 021BF6A0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021BF6A0 */ goto L_021BF6A4;
@@ -463,8 +463,8 @@ void Gambit_fn_021BF694(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -478,15 +478,15 @@ void Gambit_fn_021BF694(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -528,20 +528,20 @@ void Gambit_fn_021BF6A8(CPUState* cpu) {
         /* 021BF6C0 */ _t4 = cpu->r[1] + 0x00000020u;
         /* 021BF6C0 */ rbrew_write_f32(cpu->mem, _t4, cpu->f[31]);
         /* 021BF6C4 */ cpu->r[31] = cpu->r[3];
-        /* 021BF6C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021BF6C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021BF6C8 */ _t5 = cpu->r[1] + 0x00000010u;
         /* 021BF6C8 */ rbrew_write32(cpu->mem, _t5, cpu->r[30]);
         /* 021BF6CC */ _t6 = cpu->r[1] + 0x0000002Cu;
         /* 021BF6CC */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
-        /* 021BF6D0 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF6D0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF6D0 */ _t8 = _t7 & 0x00000001u;
         /* 021BF6D0 */ if (_t8) goto L_021BF6D4; else goto L_021BF6E4;
   L_021BF6D4: ; // 0x21bf6d4
         /* 021BF6D4 */ cpu->r[3] = 0x00000240u;
         /* 021BF6D8 */ Gambit_fn_02801A78(cpu);
         /* 021BF6DC */ cpu->r[31] = cpu->r[3];
-        /* 021BF6DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021BF6E0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF6DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021BF6E0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF6E0 */ _t10 = _t9 & 0x00000001u;
         /* 021BF6E0 */ if (_t10) goto L_021BF8A4; else goto L_021BF6E4;
   L_021BF6E4: ; // 0x21bf6e4
@@ -574,10 +574,10 @@ void Gambit_fn_021BF6A8(CPUState* cpu) {
         /* 021BF734 */ _t17 = cpu->r[31] + 0x000001A4u;
         /* 021BF734 */ rbrew_write_f32(cpu->mem, _t17, cpu->f[0]);
         /* 021BF738 */ cpu->r[12] = cpu->r[31] + 0x000001A8u;
-        /* 021BF738 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021BF738 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021BF73C */ _t18 = cpu->r[31] + 0x00000198u;
         /* 021BF73C */ rbrew_write8(cpu->mem, _t18, (uint8_t)cpu->r[29]);
-        /* 021BF740 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF740 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF740 */ _t20 = _t19 & 0x00000001u;
         /* 021BF740 */ if (_t20) goto L_021BF744; else goto L_021BF74C;
   L_021BF744: ; // 0x21bf744
@@ -585,8 +585,8 @@ void Gambit_fn_021BF6A8(CPUState* cpu) {
         /* 021BF748 */ Gambit_fn_02801A78(cpu);
   L_021BF74C: ; // 0x21bf74c
         /* 021BF74C */ cpu->r[0] = cpu->r[31] + 0x000001B4u;
-        /* 021BF74C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021BF750 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF74C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021BF750 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF750 */ _t22 = _t21 & 0x00000001u;
         /* 021BF750 */ if (_t22) goto L_021BF754; else goto L_021BF75C;
   L_021BF754: ; // 0x21bf754
@@ -594,8 +594,8 @@ void Gambit_fn_021BF6A8(CPUState* cpu) {
         /* 021BF758 */ Gambit_fn_02801A78(cpu);
   L_021BF75C: ; // 0x21bf75c
         /* 021BF75C */ cpu->r[11] = cpu->r[31] + 0x000001C0u;
-        /* 021BF75C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021BF760 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF75C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021BF760 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF760 */ _t24 = _t23 & 0x00000001u;
         /* 021BF760 */ if (_t24) goto L_021BF764; else goto L_021BF76C;
   L_021BF764: ; // 0x21bf764
@@ -612,10 +612,10 @@ void Gambit_fn_021BF6A8(CPUState* cpu) {
         /* 021BF780 */ _t27 = cpu->r[31] + 0x000001CCu;
         /* 021BF780 */ rbrew_write32(cpu->mem, _t27, cpu->r[12]);
         /* 021BF784 */ cpu->r[0] = cpu->r[31] + 0x000001D0u;
-        /* 021BF784 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021BF784 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021BF788 */ _t28 = cpu->r[31] + 0x000001CFu;
         /* 021BF788 */ rbrew_write8(cpu->mem, _t28, (uint8_t)cpu->r[29]);
-        /* 021BF78C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF78C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF78C */ _t30 = _t29 & 0x00000001u;
         /* 021BF78C */ if (_t30) goto L_021BF790; else goto L_021BF798;
   L_021BF790: ; // 0x21bf790
@@ -624,29 +624,29 @@ void Gambit_fn_021BF6A8(CPUState* cpu) {
   L_021BF798: ; // 0x21bf798
         /* 021BF798 */ cpu->r[11] = 0x10030000u;
         /* 021BF79C */ cpu->r[3] = cpu->r[31] + 0x000001DCu;
-        /* 021BF79C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021BF79C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021BF7A0 */ _t31 = cpu->r[11] + 0xFFFFB5F8u;
         /* 021BF7A0 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t31);
-        /* 021BF7A4 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF7A4 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF7A4 */ _t33 = _t32 & 0x00000001u;
         /* 021BF7A4 */ if (_t33) goto L_021BF7A8; else goto L_021BF7B8;
   L_021BF7A8: ; // 0x21bf7a8
         /* 021BF7A8 */ cpu->r[3] = 0x0000000Cu;
         /* 021BF7AC */ Gambit_fn_02801A78(cpu);
-        /* 021BF7B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021BF7B4 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF7B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021BF7B4 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF7B4 */ _t35 = _t34 & 0x00000001u;
         /* 021BF7B4 */ if (_t35) goto L_021BF7DC; else goto L_021BF7B8;
   L_021BF7B8: ; // 0x21bf7b8
-        /* 021BF7B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021BF7BC */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF7B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021BF7BC */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF7BC */ _t37 = _t36 & 0x00000001u;
         /* 021BF7BC */ if (_t37) goto L_021BF7C0; else goto L_021BF7D0;
   L_021BF7C0: ; // 0x21bf7c0
         /* 021BF7C0 */ cpu->r[3] = 0x0000000Cu;
         /* 021BF7C4 */ Gambit_fn_02801A78(cpu);
-        /* 021BF7C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021BF7CC */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF7C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021BF7CC */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF7CC */ _t39 = _t38 & 0x00000001u;
         /* 021BF7CC */ if (_t39) goto L_021BF7DC; else goto L_021BF7D0;
   L_021BF7D0: ; // 0x21bf7d0
@@ -658,8 +658,8 @@ void Gambit_fn_021BF6A8(CPUState* cpu) {
         /* 021BF7D8 */ rbrew_write_f32(cpu->mem, _t42, cpu->f[31]);
   L_021BF7DC: ; // 0x21bf7dc
         /* 021BF7DC */ cpu->r[0] = cpu->r[31] + 0x000001E8u;
-        /* 021BF7DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021BF7E0 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF7DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021BF7E0 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF7E0 */ _t44 = _t43 & 0x00000001u;
         /* 021BF7E0 */ if (_t44) goto L_021BF7E4; else goto L_021BF7EC;
   L_021BF7E4: ; // 0x21bf7e4
@@ -669,33 +669,33 @@ void Gambit_fn_021BF6A8(CPUState* cpu) {
         /* 021BF7EC */ _t45 = cpu->r[31] + 0x000001F6u;
         /* 021BF7EC */ rbrew_write8(cpu->mem, _t45, (uint8_t)cpu->r[29]);
         /* 021BF7F0 */ cpu->r[30] = cpu->r[31] + 0x000001F8u;
-        /* 021BF7F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021BF7F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021BF7F4 */ _t46 = cpu->r[31] + 0x000001F7u;
         /* 021BF7F4 */ rbrew_write8(cpu->mem, _t46, (uint8_t)cpu->r[29]);
         /* 021BF7F8 */ _t47 = cpu->r[31] + 0x000001F4u;
         /* 021BF7F8 */ rbrew_write16(cpu->mem, _t47, (uint16_t)cpu->r[29]);
-        /* 021BF7FC */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF7FC */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF7FC */ _t49 = _t48 & 0x00000001u;
         /* 021BF7FC */ if (_t49) goto L_021BF800; else goto L_021BF810;
   L_021BF800: ; // 0x21bf800
         /* 021BF800 */ cpu->r[3] = 0x00000018u;
         /* 021BF804 */ Gambit_fn_02801A78(cpu);
         /* 021BF808 */ cpu->r[30] = cpu->r[3];
-        /* 021BF808 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021BF80C */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF808 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021BF80C */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF80C */ _t51 = _t50 & 0x00000001u;
         /* 021BF80C */ if (_t51) goto L_021BF858; else goto L_021BF810;
   L_021BF810: ; // 0x21bf810
         /* 021BF810 */ cpu->r[3] = cpu->r[30];
-        /* 021BF810 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021BF814 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF810 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021BF814 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF814 */ _t53 = _t52 & 0x00000001u;
         /* 021BF814 */ if (_t53) goto L_021BF818; else goto L_021BF828;
   L_021BF818: ; // 0x21bf818
         /* 021BF818 */ cpu->r[3] = 0x0000000Cu;
         /* 021BF81C */ Gambit_fn_02801A78(cpu);
-        /* 021BF820 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021BF824 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF820 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021BF824 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF824 */ _t55 = _t54 & 0x00000001u;
         /* 021BF824 */ if (_t55) goto L_021BF834; else goto L_021BF828;
   L_021BF828: ; // 0x21bf828
@@ -707,15 +707,15 @@ void Gambit_fn_021BF6A8(CPUState* cpu) {
         /* 021BF830 */ rbrew_write_f32(cpu->mem, _t58, cpu->f[31]);
   L_021BF834: ; // 0x21bf834
         /* 021BF834 */ cpu->r[3] = cpu->r[30] + 0x0000000Cu;
-        /* 021BF834 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021BF838 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF834 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021BF838 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF838 */ _t60 = _t59 & 0x00000001u;
         /* 021BF838 */ if (_t60) goto L_021BF83C; else goto L_021BF84C;
   L_021BF83C: ; // 0x21bf83c
         /* 021BF83C */ cpu->r[3] = 0x0000000Cu;
         /* 021BF840 */ Gambit_fn_02801A78(cpu);
-        /* 021BF844 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021BF848 */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021BF848 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF848 */ _t62 = _t61 & 0x00000001u;
         /* 021BF848 */ if (_t62) goto L_021BF858; else goto L_021BF84C;
   L_021BF84C: ; // 0x21bf84c
@@ -727,8 +727,8 @@ void Gambit_fn_021BF6A8(CPUState* cpu) {
         /* 021BF854 */ rbrew_write_f32(cpu->mem, _t65, cpu->f[31]);
   L_021BF858: ; // 0x21bf858
         /* 021BF858 */ cpu->r[0] = cpu->r[31] + 0x00000210u;
-        /* 021BF858 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021BF85C */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF858 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021BF85C */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF85C */ _t67 = _t66 & 0x00000001u;
         /* 021BF85C */ if (_t67) goto L_021BF860; else goto L_021BF868;
   L_021BF860: ; // 0x21bf860
@@ -762,7 +762,7 @@ void Gambit_fn_021BF6A8(CPUState* cpu) {
         /* 021BF8B4 */ cpu->r[3] = cpu->r[31];
         /* 021BF8B8 */ _t72 = cpu->r[1] + 0x00000014u;
         /* 021BF8B8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t72);
-        /* 021BF8BC */ _t73 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021BF8BC */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021BF8BC */ _t74 = _t73 & 0x00000001u;
         /* 021BF8BC */ if (_t74) goto L_021BF8C0; // else: addr-0 trap, fall-through
   L_021BF8C0: ; // 0x21bf8c0
@@ -791,20 +791,20 @@ void Gambit_fn_021BF6AC(CPUState* cpu) {
         /* 021BF6C0 */ _t4 = cpu->r[1] + 0x00000020u;
         /* 021BF6C0 */ rbrew_write_f32(cpu->mem, _t4, cpu->f[31]);
         /* 021BF6C4 */ cpu->r[31] = cpu->r[3];
-        /* 021BF6C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021BF6C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021BF6C8 */ _t5 = cpu->r[1] + 0x00000010u;
         /* 021BF6C8 */ rbrew_write32(cpu->mem, _t5, cpu->r[30]);
         /* 021BF6CC */ _t6 = cpu->r[1] + 0x0000002Cu;
         /* 021BF6CC */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
-        /* 021BF6D0 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF6D0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF6D0 */ _t8 = _t7 & 0x00000001u;
         /* 021BF6D0 */ if (_t8) goto L_021BF6D4; else goto L_021BF6E4;
   L_021BF6D4: ; // 0x21bf6d4
         /* 021BF6D4 */ cpu->r[3] = 0x00000240u;
         /* 021BF6D8 */ Gambit_fn_02801A78(cpu);
         /* 021BF6DC */ cpu->r[31] = cpu->r[3];
-        /* 021BF6DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021BF6E0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF6DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021BF6E0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF6E0 */ _t10 = _t9 & 0x00000001u;
         /* 021BF6E0 */ if (_t10) goto L_021BF8A4; else goto L_021BF6E4;
   L_021BF6E4: ; // 0x21bf6e4
@@ -837,10 +837,10 @@ void Gambit_fn_021BF6AC(CPUState* cpu) {
         /* 021BF734 */ _t17 = cpu->r[31] + 0x000001A4u;
         /* 021BF734 */ rbrew_write_f32(cpu->mem, _t17, cpu->f[0]);
         /* 021BF738 */ cpu->r[12] = cpu->r[31] + 0x000001A8u;
-        /* 021BF738 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021BF738 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021BF73C */ _t18 = cpu->r[31] + 0x00000198u;
         /* 021BF73C */ rbrew_write8(cpu->mem, _t18, (uint8_t)cpu->r[29]);
-        /* 021BF740 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF740 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF740 */ _t20 = _t19 & 0x00000001u;
         /* 021BF740 */ if (_t20) goto L_021BF744; else goto L_021BF74C;
   L_021BF744: ; // 0x21bf744
@@ -848,8 +848,8 @@ void Gambit_fn_021BF6AC(CPUState* cpu) {
         /* 021BF748 */ Gambit_fn_02801A78(cpu);
   L_021BF74C: ; // 0x21bf74c
         /* 021BF74C */ cpu->r[0] = cpu->r[31] + 0x000001B4u;
-        /* 021BF74C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021BF750 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF74C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021BF750 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF750 */ _t22 = _t21 & 0x00000001u;
         /* 021BF750 */ if (_t22) goto L_021BF754; else goto L_021BF75C;
   L_021BF754: ; // 0x21bf754
@@ -857,8 +857,8 @@ void Gambit_fn_021BF6AC(CPUState* cpu) {
         /* 021BF758 */ Gambit_fn_02801A78(cpu);
   L_021BF75C: ; // 0x21bf75c
         /* 021BF75C */ cpu->r[11] = cpu->r[31] + 0x000001C0u;
-        /* 021BF75C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021BF760 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF75C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021BF760 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF760 */ _t24 = _t23 & 0x00000001u;
         /* 021BF760 */ if (_t24) goto L_021BF764; else goto L_021BF76C;
   L_021BF764: ; // 0x21bf764
@@ -875,10 +875,10 @@ void Gambit_fn_021BF6AC(CPUState* cpu) {
         /* 021BF780 */ _t27 = cpu->r[31] + 0x000001CCu;
         /* 021BF780 */ rbrew_write32(cpu->mem, _t27, cpu->r[12]);
         /* 021BF784 */ cpu->r[0] = cpu->r[31] + 0x000001D0u;
-        /* 021BF784 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021BF784 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021BF788 */ _t28 = cpu->r[31] + 0x000001CFu;
         /* 021BF788 */ rbrew_write8(cpu->mem, _t28, (uint8_t)cpu->r[29]);
-        /* 021BF78C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF78C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF78C */ _t30 = _t29 & 0x00000001u;
         /* 021BF78C */ if (_t30) goto L_021BF790; else goto L_021BF798;
   L_021BF790: ; // 0x21bf790
@@ -887,29 +887,29 @@ void Gambit_fn_021BF6AC(CPUState* cpu) {
   L_021BF798: ; // 0x21bf798
         /* 021BF798 */ cpu->r[11] = 0x10030000u;
         /* 021BF79C */ cpu->r[3] = cpu->r[31] + 0x000001DCu;
-        /* 021BF79C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021BF79C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021BF7A0 */ _t31 = cpu->r[11] + 0xFFFFB5F8u;
         /* 021BF7A0 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t31);
-        /* 021BF7A4 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF7A4 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF7A4 */ _t33 = _t32 & 0x00000001u;
         /* 021BF7A4 */ if (_t33) goto L_021BF7A8; else goto L_021BF7B8;
   L_021BF7A8: ; // 0x21bf7a8
         /* 021BF7A8 */ cpu->r[3] = 0x0000000Cu;
         /* 021BF7AC */ Gambit_fn_02801A78(cpu);
-        /* 021BF7B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021BF7B4 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF7B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021BF7B4 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF7B4 */ _t35 = _t34 & 0x00000001u;
         /* 021BF7B4 */ if (_t35) goto L_021BF7DC; else goto L_021BF7B8;
   L_021BF7B8: ; // 0x21bf7b8
-        /* 021BF7B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021BF7BC */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF7B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021BF7BC */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF7BC */ _t37 = _t36 & 0x00000001u;
         /* 021BF7BC */ if (_t37) goto L_021BF7C0; else goto L_021BF7D0;
   L_021BF7C0: ; // 0x21bf7c0
         /* 021BF7C0 */ cpu->r[3] = 0x0000000Cu;
         /* 021BF7C4 */ Gambit_fn_02801A78(cpu);
-        /* 021BF7C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021BF7CC */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF7C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021BF7CC */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF7CC */ _t39 = _t38 & 0x00000001u;
         /* 021BF7CC */ if (_t39) goto L_021BF7DC; else goto L_021BF7D0;
   L_021BF7D0: ; // 0x21bf7d0
@@ -921,8 +921,8 @@ void Gambit_fn_021BF6AC(CPUState* cpu) {
         /* 021BF7D8 */ rbrew_write_f32(cpu->mem, _t42, cpu->f[31]);
   L_021BF7DC: ; // 0x21bf7dc
         /* 021BF7DC */ cpu->r[0] = cpu->r[31] + 0x000001E8u;
-        /* 021BF7DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021BF7E0 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF7DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021BF7E0 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF7E0 */ _t44 = _t43 & 0x00000001u;
         /* 021BF7E0 */ if (_t44) goto L_021BF7E4; else goto L_021BF7EC;
   L_021BF7E4: ; // 0x21bf7e4
@@ -932,33 +932,33 @@ void Gambit_fn_021BF6AC(CPUState* cpu) {
         /* 021BF7EC */ _t45 = cpu->r[31] + 0x000001F6u;
         /* 021BF7EC */ rbrew_write8(cpu->mem, _t45, (uint8_t)cpu->r[29]);
         /* 021BF7F0 */ cpu->r[30] = cpu->r[31] + 0x000001F8u;
-        /* 021BF7F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021BF7F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021BF7F4 */ _t46 = cpu->r[31] + 0x000001F7u;
         /* 021BF7F4 */ rbrew_write8(cpu->mem, _t46, (uint8_t)cpu->r[29]);
         /* 021BF7F8 */ _t47 = cpu->r[31] + 0x000001F4u;
         /* 021BF7F8 */ rbrew_write16(cpu->mem, _t47, (uint16_t)cpu->r[29]);
-        /* 021BF7FC */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF7FC */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF7FC */ _t49 = _t48 & 0x00000001u;
         /* 021BF7FC */ if (_t49) goto L_021BF800; else goto L_021BF810;
   L_021BF800: ; // 0x21bf800
         /* 021BF800 */ cpu->r[3] = 0x00000018u;
         /* 021BF804 */ Gambit_fn_02801A78(cpu);
         /* 021BF808 */ cpu->r[30] = cpu->r[3];
-        /* 021BF808 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021BF80C */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF808 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021BF80C */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF80C */ _t51 = _t50 & 0x00000001u;
         /* 021BF80C */ if (_t51) goto L_021BF858; else goto L_021BF810;
   L_021BF810: ; // 0x21bf810
         /* 021BF810 */ cpu->r[3] = cpu->r[30];
-        /* 021BF810 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021BF814 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF810 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021BF814 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF814 */ _t53 = _t52 & 0x00000001u;
         /* 021BF814 */ if (_t53) goto L_021BF818; else goto L_021BF828;
   L_021BF818: ; // 0x21bf818
         /* 021BF818 */ cpu->r[3] = 0x0000000Cu;
         /* 021BF81C */ Gambit_fn_02801A78(cpu);
-        /* 021BF820 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021BF824 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF820 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021BF824 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF824 */ _t55 = _t54 & 0x00000001u;
         /* 021BF824 */ if (_t55) goto L_021BF834; else goto L_021BF828;
   L_021BF828: ; // 0x21bf828
@@ -970,15 +970,15 @@ void Gambit_fn_021BF6AC(CPUState* cpu) {
         /* 021BF830 */ rbrew_write_f32(cpu->mem, _t58, cpu->f[31]);
   L_021BF834: ; // 0x21bf834
         /* 021BF834 */ cpu->r[3] = cpu->r[30] + 0x0000000Cu;
-        /* 021BF834 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021BF838 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF834 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021BF838 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF838 */ _t60 = _t59 & 0x00000001u;
         /* 021BF838 */ if (_t60) goto L_021BF83C; else goto L_021BF84C;
   L_021BF83C: ; // 0x21bf83c
         /* 021BF83C */ cpu->r[3] = 0x0000000Cu;
         /* 021BF840 */ Gambit_fn_02801A78(cpu);
-        /* 021BF844 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021BF848 */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021BF848 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF848 */ _t62 = _t61 & 0x00000001u;
         /* 021BF848 */ if (_t62) goto L_021BF858; else goto L_021BF84C;
   L_021BF84C: ; // 0x21bf84c
@@ -990,8 +990,8 @@ void Gambit_fn_021BF6AC(CPUState* cpu) {
         /* 021BF854 */ rbrew_write_f32(cpu->mem, _t65, cpu->f[31]);
   L_021BF858: ; // 0x21bf858
         /* 021BF858 */ cpu->r[0] = cpu->r[31] + 0x00000210u;
-        /* 021BF858 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021BF85C */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF858 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021BF85C */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF85C */ _t67 = _t66 & 0x00000001u;
         /* 021BF85C */ if (_t67) goto L_021BF860; else goto L_021BF868;
   L_021BF860: ; // 0x21bf860
@@ -1025,7 +1025,7 @@ void Gambit_fn_021BF6AC(CPUState* cpu) {
         /* 021BF8B4 */ cpu->r[3] = cpu->r[31];
         /* 021BF8B8 */ _t72 = cpu->r[1] + 0x00000014u;
         /* 021BF8B8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t72);
-        /* 021BF8BC */ _t73 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021BF8BC */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021BF8BC */ _t74 = _t73 & 0x00000001u;
         /* 021BF8BC */ if (_t74) goto L_021BF8C0; // else: addr-0 trap, fall-through
   L_021BF8C0: ; // 0x21bf8c0
@@ -1250,8 +1250,8 @@ void Gambit_fn_021BF9A0(CPUState* cpu) {
         /* 021BF9E0 */ cpu->r[3] = cpu->r[30];
         /* 021BF9E4 */ Gambit_fn_02022118(cpu);
         /* 021BF9E8 */ cpu->r[31] = cpu->r[3];
-        /* 021BF9E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021BF9EC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF9E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021BF9EC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF9EC */ _t10 = _t9 & 0x00000001u;
         /* 021BF9EC */ if (_t10) goto L_021BF9F0; else goto L_021BFA0C;
   L_021BF9F0: ; // 0x21bf9f0
@@ -1317,8 +1317,8 @@ void Gambit_fn_021BF9A4(CPUState* cpu) {
         /* 021BF9E0 */ cpu->r[3] = cpu->r[30];
         /* 021BF9E4 */ Gambit_fn_02022118(cpu);
         /* 021BF9E8 */ cpu->r[31] = cpu->r[3];
-        /* 021BF9E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021BF9EC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BF9E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021BF9EC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BF9EC */ _t10 = _t9 & 0x00000001u;
         /* 021BF9EC */ if (_t10) goto L_021BF9F0; else goto L_021BFA0C;
   L_021BF9F0: ; // 0x21bf9f0
@@ -1385,8 +1385,8 @@ void Gambit_fn_021BFA3C(CPUState* cpu) {
         /* 021BFA7C */ cpu->r[3] = cpu->r[30];
         /* 021BFA80 */ Gambit_fn_02022118(cpu);
         /* 021BFA84 */ cpu->r[31] = cpu->r[3];
-        /* 021BFA84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021BFA88 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BFA84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021BFA88 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BFA88 */ _t10 = _t9 & 0x00000001u;
         /* 021BFA88 */ if (_t10) goto L_021BFA8C; else goto L_021BFAA8;
   L_021BFA8C: ; // 0x21bfa8c
@@ -1452,8 +1452,8 @@ void Gambit_fn_021BFA40(CPUState* cpu) {
         /* 021BFA7C */ cpu->r[3] = cpu->r[30];
         /* 021BFA80 */ Gambit_fn_02022118(cpu);
         /* 021BFA84 */ cpu->r[31] = cpu->r[3];
-        /* 021BFA84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021BFA88 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BFA84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021BFA88 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BFA88 */ _t10 = _t9 & 0x00000001u;
         /* 021BFA88 */ if (_t10) goto L_021BFA8C; else goto L_021BFAA8;
   L_021BFA8C: ; // 0x21bfa8c
@@ -1513,8 +1513,8 @@ void Gambit_fn_021BFAD8(CPUState* cpu) {
         /* 021BFB04 */ cpu->ctr = cpu->r[0];
         /* 021BFB08 */ cpu->r[3] = cpu->r[29];
         /* 021BFB0C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021BFB10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021BFB14 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BFB10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021BFB14 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BFB14 */ _t8 = _t7 & 0x00000001u;
         /* 021BFB14 */ if (_t8) goto L_021BFBF0; else goto L_021BFB18;
   L_021BFB18: ; // 0x21bfb18
@@ -1591,8 +1591,8 @@ void Gambit_fn_021BFAD8(CPUState* cpu) {
         /* 021BFBDC */ cpu->r[3] = 0x00000028u;
         /* 021BFBE0 */ Gambit_fn_02801A78(cpu);
         /* 021BFBE4 */ cpu->r[11] = cpu->r[3];
-        /* 021BFBE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021BFBE8 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BFBE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021BFBE8 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BFBE8 */ _t31 = _t30 & 0x00000001u;
         /* 021BFBE8 */ if (_t31) goto L_021BFCE0; else goto L_021BFBEC;
   L_021BFBEC: ; // 0x21bfbec
@@ -1673,8 +1673,8 @@ void Gambit_fn_021BFAD8(CPUState* cpu) {
         /* 021BFCBC */ cpu->r[3] = 0x00000028u;
         /* 021BFCC0 */ Gambit_fn_02801A78(cpu);
         /* 021BFCC4 */ cpu->r[11] = cpu->r[3];
-        /* 021BFCC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021BFCC8 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BFCC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021BFCC8 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BFCC8 */ _t54 = _t53 & 0x00000001u;
         /* 021BFCC8 */ if (_t54) goto L_021BFCE0; else goto L_021BFCCC;
   L_021BFCCC: ; // 0x21bfccc
@@ -1692,8 +1692,8 @@ void Gambit_fn_021BFAD8(CPUState* cpu) {
         /* 021BFCEC */ _t57 = cpu->r[11] + 0x00000000u;
         /* 021BFCEC */ rbrew_write32(cpu->mem, _t57, cpu->r[9]);
         /* 021BFCF0 */ Gambit_fn_02801A78(cpu);
-        /* 021BFCF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021BFCF8 */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BFCF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021BFCF8 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BFCF8 */ _t59 = _t58 & 0x00000001u;
         /* 021BFCF8 */ if (_t59) goto L_021BFD00; else goto L_021BFCFC;
   L_021BFCFC: ; // 0x21bfcfc
@@ -1744,8 +1744,8 @@ void Gambit_fn_021BFADC(CPUState* cpu) {
         /* 021BFB04 */ cpu->ctr = cpu->r[0];
         /* 021BFB08 */ cpu->r[3] = cpu->r[29];
         /* 021BFB0C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021BFB10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021BFB14 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BFB10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021BFB14 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BFB14 */ _t8 = _t7 & 0x00000001u;
         /* 021BFB14 */ if (_t8) goto L_021BFBF0; else goto L_021BFB18;
   L_021BFB18: ; // 0x21bfb18
@@ -1822,8 +1822,8 @@ void Gambit_fn_021BFADC(CPUState* cpu) {
         /* 021BFBDC */ cpu->r[3] = 0x00000028u;
         /* 021BFBE0 */ Gambit_fn_02801A78(cpu);
         /* 021BFBE4 */ cpu->r[11] = cpu->r[3];
-        /* 021BFBE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021BFBE8 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BFBE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021BFBE8 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BFBE8 */ _t31 = _t30 & 0x00000001u;
         /* 021BFBE8 */ if (_t31) goto L_021BFCE0; else goto L_021BFBEC;
   L_021BFBEC: ; // 0x21bfbec
@@ -1904,8 +1904,8 @@ void Gambit_fn_021BFADC(CPUState* cpu) {
         /* 021BFCBC */ cpu->r[3] = 0x00000028u;
         /* 021BFCC0 */ Gambit_fn_02801A78(cpu);
         /* 021BFCC4 */ cpu->r[11] = cpu->r[3];
-        /* 021BFCC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021BFCC8 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BFCC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021BFCC8 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BFCC8 */ _t54 = _t53 & 0x00000001u;
         /* 021BFCC8 */ if (_t54) goto L_021BFCE0; else goto L_021BFCCC;
   L_021BFCCC: ; // 0x21bfccc
@@ -1923,8 +1923,8 @@ void Gambit_fn_021BFADC(CPUState* cpu) {
         /* 021BFCEC */ _t57 = cpu->r[11] + 0x00000000u;
         /* 021BFCEC */ rbrew_write32(cpu->mem, _t57, cpu->r[9]);
         /* 021BFCF0 */ Gambit_fn_02801A78(cpu);
-        /* 021BFCF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021BFCF8 */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BFCF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021BFCF8 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BFCF8 */ _t59 = _t58 & 0x00000001u;
         /* 021BFCF8 */ if (_t59) goto L_021BFD00; else goto L_021BFCFC;
   L_021BFCFC: ; // 0x21bfcfc
@@ -1971,7 +1971,7 @@ void Gambit_fn_021BFD28(CPUState* cpu) {
         /* 021BFD48 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021BFD4C */ _t5 = cpu->r[31] + 0x00000164u;
         /* 021BFD4C */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
-        /* 021BFD50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[3]);
+        /* 021BFD50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[3]));
         /* 021BFD54 */ /* nop */
         /* 021BFD58 */ cpu->r[3] = rbrew_rlwinm(cpu->r[0], 0x00000001u, 0x0000001Fu, 0x0000001Fu);
         /* 021BFD5C */ _t6 = cpu->r[1] + 0x00000014u;
@@ -2005,7 +2005,7 @@ void Gambit_fn_021BFD2C(CPUState* cpu) {
         /* 021BFD48 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021BFD4C */ _t5 = cpu->r[31] + 0x00000164u;
         /* 021BFD4C */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
-        /* 021BFD50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[3]);
+        /* 021BFD50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[3]));
         /* 021BFD54 */ /* nop */
         /* 021BFD58 */ cpu->r[3] = rbrew_rlwinm(cpu->r[0], 0x00000001u, 0x0000001Fu, 0x0000001Fu);
         /* 021BFD5C */ _t6 = cpu->r[1] + 0x00000014u;
@@ -2064,7 +2064,7 @@ void Gambit_fn_021BFD74(CPUState* cpu) {
         /* 021BFDD8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t11);
         /* 021BFDDC */ _t12 = cpu->r[1] + 0x00000010u;
         /* 021BFDDC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t12);
-        /* 021BFDE0 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021BFDE0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021BFDE0 */ _t14 = _t13 & 0x00000001u;
         /* 021BFDE0 */ if (_t14) goto L_021BFDE4; // else: addr-0 trap, fall-through
   L_021BFDE4: ; // 0x21bfde4
@@ -2120,7 +2120,7 @@ void Gambit_fn_021BFD78(CPUState* cpu) {
         /* 021BFDD8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t11);
         /* 021BFDDC */ _t12 = cpu->r[1] + 0x00000010u;
         /* 021BFDDC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t12);
-        /* 021BFDE0 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021BFDE0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021BFDE0 */ _t14 = _t13 & 0x00000001u;
         /* 021BFDE0 */ if (_t14) goto L_021BFDE4; // else: addr-0 trap, fall-through
   L_021BFDE4: ; // 0x21bfde4
@@ -2163,9 +2163,9 @@ void Gambit_fn_021BFDF4(CPUState* cpu) {
         /* 021BFE2C */ _t9 = cpu->r[31] + 0x000001CCu;
         /* 021BFE2C */ cpu->r[9] = rbrew_read32(cpu->mem, _t9);
         /* 021BFE30 */ cpu->r[9] = rbrew_rlwinm(cpu->r[9], 0x00000000u, 0x00000010u, 0x00000011u);
-        /* 021BFE30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021BFE30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021BFE34 */ cpu->r[3] = cpu->r[31];
-        /* 021BFE38 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BFE38 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BFE38 */ _t11 = _t10 & 0x00000001u;
         /* 021BFE38 */ if (_t11) goto L_021BFED0; else goto L_021BFE3C;
   L_021BFE3C: ; // 0x21bfe3c
@@ -2232,7 +2232,7 @@ void Gambit_fn_021BFDF4(CPUState* cpu) {
         /* 021BFEB4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t41);
         /* 021BFEB8 */ _t42 = cpu->r[1] + 0x00000048u;
         /* 021BFEB8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t42);
-        /* 021BFEBC */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021BFEBC */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021BFEBC */ _t44 = _t43 & 0x00000001u;
         /* 021BFEBC */ if (_t44) goto L_021BFEC0; // else: addr-0 trap, fall-through
   L_021BFEC0: ; // 0x21bfec0
@@ -2243,11 +2243,11 @@ void Gambit_fn_021BFDF4(CPUState* cpu) {
         /* 021BFECC */ return;
   L_021BFED0: ; // 0x21bfed0
         /* 021BFED0 */ Gambit_fn_021BFD28(cpu);
-        /* 021BFED4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021BFED4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021BFED8 */ cpu->r[3] = cpu->r[31];
         /* 021BFEDC */ _t46 = cpu->r[31] + 0x00000004u;
         /* 021BFEDC */ cpu->r[12] = rbrew_read32(cpu->mem, _t46);
-        /* 021BFEE0 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BFEE0 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BFEE0 */ _t48 = _t47 & 0x00000001u;
         /* 021BFEE0 */ if (_t48) goto L_021BFF68; else goto L_021BFEE4;
   L_021BFEE4: ; // 0x21bfee4
@@ -2299,11 +2299,11 @@ void Gambit_fn_021BFDF4(CPUState* cpu) {
         /* 021BFF48 */ Gambit_fn_02050B24(cpu);
         /* 021BFF4C */ cpu->r[3] = cpu->r[31];
         /* 021BFF50 */ Gambit_fn_021BFD28(cpu);
-        /* 021BFF54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021BFF54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021BFF58 */ cpu->r[3] = cpu->r[31];
         /* 021BFF5C */ _t69 = cpu->r[31] + 0x00000004u;
         /* 021BFF5C */ cpu->r[10] = rbrew_read32(cpu->mem, _t69);
-        /* 021BFF60 */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BFF60 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BFF60 */ _t71 = _t70 & 0x00000001u;
         /* 021BFF60 */ if (_t71) goto L_021C0048; else goto L_021BFF64;
   L_021BFF64: ; // 0x21bff64
@@ -2357,11 +2357,11 @@ void Gambit_fn_021BFDF4(CPUState* cpu) {
         /* 021BFFCC */ Gambit_fn_02050B24(cpu);
         /* 021BFFD0 */ cpu->r[3] = cpu->r[31];
         /* 021BFFD4 */ Gambit_fn_021BFD28(cpu);
-        /* 021BFFD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021BFFD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021BFFDC */ cpu->r[3] = cpu->r[31];
         /* 021BFFE0 */ _t92 = cpu->r[31] + 0x00000004u;
         /* 021BFFE0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t92);
-        /* 021BFFE4 */ _t93 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BFFE4 */ _t93 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BFFE4 */ _t94 = _t93 & 0x00000001u;
         /* 021BFFE4 */ if (_t94) goto L_021C0048; else goto L_021BFFE8;
   L_021BFFE8: ; // 0x21bffe8
@@ -2397,10 +2397,10 @@ void Gambit_fn_021BFDF4(CPUState* cpu) {
         /* 021C0030 */ rbrew_write_f32(cpu->mem, _t105, cpu->f[13]);
         /* 021C0034 */ _t106 = cpu->r[3] + 0x00000008u;
         /* 021C0034 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t106);
-        /* 021C0038 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021C0038 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021C003C */ _t107 = cpu->r[31] + 0x000001BCu;
         /* 021C003C */ rbrew_write_f32(cpu->mem, _t107, cpu->f[0]);
-        /* 021C0040 */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0040 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0040 */ _t109 = _t108 & 0x00000001u;
         /* 021C0040 */ if (_t109) goto L_021C0118; else goto L_021C0044;
   L_021C0044: ; // 0x21c0044
@@ -2438,10 +2438,10 @@ void Gambit_fn_021BFDF4(CPUState* cpu) {
         /* 021C0090 */ rbrew_write_f32(cpu->mem, _t120, cpu->f[13]);
         /* 021C0094 */ _t121 = cpu->r[3] + 0x00000008u;
         /* 021C0094 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t121);
-        /* 021C0098 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021C0098 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021C009C */ _t122 = cpu->r[31] + 0x000001BCu;
         /* 021C009C */ rbrew_write_f32(cpu->mem, _t122, cpu->f[0]);
-        /* 021C00A0 */ _t123 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C00A0 */ _t123 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C00A0 */ _t124 = _t123 & 0x00000001u;
         /* 021C00A0 */ if (_t124) goto L_021C0118; else goto L_021C00A4;
   L_021C00A4: ; // 0x21c00a4
@@ -2482,9 +2482,9 @@ void Gambit_fn_021BFDF4(CPUState* cpu) {
         /* 021C00FC */ Gambit_fn_02050DCC(cpu);
         /* 021C0100 */ cpu->r[3] = cpu->r[31];
         /* 021C0104 */ Gambit_fn_021BFD28(cpu);
-        /* 021C0108 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021C0108 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021C010C */ cpu->r[3] = cpu->r[31];
-        /* 021C0110 */ _t137 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0110 */ _t137 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0110 */ _t138 = _t137 & 0x00000001u;
         /* 021C0110 */ if (_t138) goto L_021C01D8; else goto L_021C0114;
   L_021C0114: ; // 0x21c0114
@@ -2496,8 +2496,8 @@ void Gambit_fn_021BFDF4(CPUState* cpu) {
         /* 021C0120 */ _t140 = cpu->r[12] + 0x00006338u;
         /* 021C0120 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t140);
         /* 021C0120 */ cpu->r[12] = _t140;
-        /* 021C0124 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[10]);
-        /* 021C0128 */ _t141 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0124 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[10]));
+        /* 021C0128 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0128 */ _t142 = _t141 & 0x00000001u;
         /* 021C0128 */ if (_t142) goto L_021C012C; else goto L_021C014C;
   L_021C012C: ; // 0x21c012c
@@ -2505,8 +2505,8 @@ void Gambit_fn_021BFDF4(CPUState* cpu) {
         /* 021C012C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t143);
         /* 021C0130 */ _t144 = cpu->r[12] + 0x00000004u;
         /* 021C0130 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t144);
-        /* 021C0134 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[12]);
-        /* 021C0138 */ _t145 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0134 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[12]));
+        /* 021C0138 */ _t145 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0138 */ _t146 = _t145 & 0x00000001u;
         /* 021C0138 */ if (_t146) goto L_021C013C; else goto L_021C014C;
   L_021C013C: ; // 0x21c013c
@@ -2514,8 +2514,8 @@ void Gambit_fn_021BFDF4(CPUState* cpu) {
         /* 021C013C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t147);
         /* 021C0140 */ _t148 = cpu->r[12] + 0x00000008u;
         /* 021C0140 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t148);
-        /* 021C0144 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[9]);
-        /* 021C0148 */ _t149 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[9]));
+        /* 021C0148 */ _t149 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0148 */ _t150 = _t149 & 0x00000001u;
         /* 021C0148 */ if (_t150) goto L_021C0180; else goto L_021C014C;
   L_021C014C: ; // 0x21c014c
@@ -2548,9 +2548,9 @@ void Gambit_fn_021BFDF4(CPUState* cpu) {
         /* 021C0198 */ Gambit_fn_02050DCC(cpu);
         /* 021C019C */ cpu->r[3] = cpu->r[31];
         /* 021C01A0 */ Gambit_fn_021BFD28(cpu);
-        /* 021C01A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021C01A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021C01A8 */ cpu->r[3] = cpu->r[31];
-        /* 021C01AC */ _t157 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C01AC */ _t157 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C01AC */ _t158 = _t157 & 0x00000001u;
         /* 021C01AC */ if (_t158) goto L_021C01D8; else goto L_021C01B0;
   L_021C01B0: ; // 0x21c01b0
@@ -2571,8 +2571,8 @@ void Gambit_fn_021BFDF4(CPUState* cpu) {
         /* 021C01D4 */ goto L_021C0324;
   L_021C01D8: ; // 0x21c01d8
         /* 021C01D8 */ Gambit_fn_021BFD28(cpu);
-        /* 021C01DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C01E0 */ _t164 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C01DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C01E0 */ _t164 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C01E0 */ _t165 = _t164 & 0x00000001u;
         /* 021C01E0 */ if (_t165) goto L_021C01E4; else goto L_021C0290;
   L_021C01E4: ; // 0x21c01e4
@@ -2784,7 +2784,7 @@ void Gambit_fn_021BFDF4(CPUState* cpu) {
         /* 021C03FC */ cpu->r[0] = rbrew_read32(cpu->mem, _t232);
         /* 021C0400 */ _t233 = cpu->r[31] + 0x00000218u;
         /* 021C0400 */ rbrew_write_f32(cpu->mem, _t233, cpu->f[13]);
-        /* 021C0404 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
+        /* 021C0404 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
         /* 021C0408 */ _t234 = cpu->r[31] + 0x000000A4u;
         /* 021C0408 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t234);
         /* 021C040C */ _t235 = cpu->r[31] + 0x000000A8u;
@@ -2811,12 +2811,12 @@ void Gambit_fn_021BFDF4(CPUState* cpu) {
         /* 021C0434 */ rbrew_write_f32(cpu->mem, _t245, cpu->f[0]);
         /* 021C0438 */ _t246 = cpu->r[31] + 0x00000220u;
         /* 021C0438 */ rbrew_write_f32(cpu->mem, _t246, cpu->f[10]);
-        /* 021C043C */ _t247 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C043C */ _t247 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C043C */ _t248 = _t247 & 0x00000001u;
         /* 021C043C */ if (_t248) goto L_021C0448; else goto L_021C0440;
   L_021C0440: ; // 0x21c0440
-        /* 021C0440 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021C0444 */ _t249 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0440 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021C0444 */ _t249 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0444 */ _t250 = _t249 & 0x00000001u;
         /* 021C0444 */ if (_t250) goto L_021C0448; else goto L_021C04B0;
   L_021C0448: ; // 0x21c0448
@@ -2868,7 +2868,7 @@ void Gambit_fn_021BFDF4(CPUState* cpu) {
         /* 021C04C4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t263);
         /* 021C04C8 */ _t264 = cpu->r[1] + 0x00000048u;
         /* 021C04C8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t264);
-        /* 021C04CC */ _t265 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C04CC */ _t265 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C04CC */ _t266 = _t265 & 0x00000001u;
         /* 021C04CC */ if (_t266) goto L_021C04D0; // else: addr-0 trap, fall-through
   L_021C04D0: ; // 0x21c04d0
@@ -2905,8 +2905,8 @@ void Gambit_fn_021C04E0(CPUState* cpu) {
         /* 021C0508 */ Gambit_fn_021BF004(cpu);
         /* 021C050C */ _t7 = cpu->r[29] + 0x00000198u;
         /* 021C050C */ cpu->r[12] = rbrew_read8(cpu->mem, _t7);
-        /* 021C0510 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021C0514 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0510 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021C0514 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0514 */ _t9 = _t8 & 0x00000001u;
         /* 021C0514 */ if (_t9) goto L_021C0528; else goto L_021C0518;
   L_021C0518: ; // 0x21c0518
@@ -2920,8 +2920,8 @@ void Gambit_fn_021C04E0(CPUState* cpu) {
         /* 021C0528 */ _t12 = cpu->r[29] + 0x000001CCu;
         /* 021C0528 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
         /* 021C052C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000014u, 0x00000014u);
-        /* 021C052C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021C0530 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C052C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021C0530 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0530 */ _t14 = _t13 & 0x00000001u;
         /* 021C0530 */ if (_t14) goto L_021C05A8; else goto L_021C0534;
   L_021C0534: ; // 0x21c0534
@@ -2932,8 +2932,8 @@ void Gambit_fn_021C04E0(CPUState* cpu) {
         /* 021C053C */ cpu->ctr = cpu->r[0];
         /* 021C0540 */ cpu->r[3] = cpu->r[29];
         /* 021C0544 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021C0548 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C054C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0548 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C054C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C054C */ _t18 = _t17 & 0x00000001u;
         /* 021C054C */ if (_t18) goto L_021C0570; else goto L_021C0550;
   L_021C0550: ; // 0x21c0550
@@ -3046,8 +3046,8 @@ void Gambit_fn_021C04E0(CPUState* cpu) {
         /* 021C0674 */ Gambit_fn_021620C4(cpu);
         /* 021C0678 */ _t50 = cpu->r[29] + 0x000001CCu;
         /* 021C0678 */ cpu->r[5] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t50);
-        /* 021C067C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x0000000Bu);
-        /* 021C0680 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C067C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x0000000Bu));
+        /* 021C0680 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0680 */ _t52 = _t51 & 0x00000001u;
         /* 021C0680 */ if (_t52) goto L_021C0690; else goto L_021C0684;
   L_021C0684: ; // 0x21c0684
@@ -3059,8 +3059,8 @@ void Gambit_fn_021C04E0(CPUState* cpu) {
         /* 021C0690 */ _t54 = cpu->r[29] + 0x000001CCu;
         /* 021C0690 */ cpu->r[10] = rbrew_read32(cpu->mem, _t54);
         /* 021C0694 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000010u, 0x00000011u);
-        /* 021C0694 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021C0698 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0694 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021C0698 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0698 */ _t56 = _t55 & 0x00000001u;
         /* 021C0698 */ if (_t56) goto L_021C069C; else goto L_021C0750;
   L_021C069C: ; // 0x21c069c
@@ -3083,9 +3083,9 @@ void Gambit_fn_021C04E0(CPUState* cpu) {
         /* 021C06C8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021C06CC */ _t62 = cpu->r[29] + 0x00000008u;
         /* 021C06CC */ cpu->r[31] = rbrew_read32(cpu->mem, _t62);
-        /* 021C06D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021C06D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021C06D4 */ cpu->r[3] = cpu->r[31];
-        /* 021C06D8 */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C06D8 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C06D8 */ _t64 = _t63 & 0x00000001u;
         /* 021C06D8 */ if (_t64) goto L_021C06DC; else goto L_021C070C;
   L_021C06DC: ; // 0x21c06dc
@@ -3100,8 +3100,8 @@ void Gambit_fn_021C04E0(CPUState* cpu) {
         /* 021C06F4 */ cpu->r[3] = cpu->r[29];
         /* 021C06F8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021C06FC */ Gambit_fn_027E3F3C(cpu);
-        /* 021C0700 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C0704 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C0704 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0704 */ _t68 = _t67 & 0x00000001u;
         /* 021C0704 */ if (_t68) goto L_021C0758; else goto L_021C0708;
   L_021C0708: ; // 0x21c0708
@@ -3116,8 +3116,8 @@ void Gambit_fn_021C04E0(CPUState* cpu) {
         /* 021C071C */ cpu->r[3] = cpu->r[29];
         /* 021C0720 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021C0724 */ Gambit_fn_027E3F3C(cpu);
-        /* 021C0728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C072C */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C072C */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C072C */ _t72 = _t71 & 0x00000001u;
         /* 021C072C */ if (_t72) goto L_021C0758; else goto L_021C0730;
   L_021C0730: ; // 0x21c0730
@@ -3145,7 +3145,7 @@ void Gambit_fn_021C04E0(CPUState* cpu) {
         /* 021C0764 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t78);
         /* 021C0768 */ _t79 = cpu->r[1] + 0x0000002Cu;
         /* 021C0768 */ cpu->r[31] = rbrew_read32(cpu->mem, _t79);
-        /* 021C076C */ _t80 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C076C */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C076C */ _t81 = _t80 & 0x00000001u;
         /* 021C076C */ if (_t81) goto L_021C0770; // else: addr-0 trap, fall-through
   L_021C0770: ; // 0x21c0770
@@ -3181,8 +3181,8 @@ void Gambit_fn_021C04E4(CPUState* cpu) {
         /* 021C0508 */ Gambit_fn_021BF004(cpu);
         /* 021C050C */ _t7 = cpu->r[29] + 0x00000198u;
         /* 021C050C */ cpu->r[12] = rbrew_read8(cpu->mem, _t7);
-        /* 021C0510 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021C0514 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0510 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021C0514 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0514 */ _t9 = _t8 & 0x00000001u;
         /* 021C0514 */ if (_t9) goto L_021C0528; else goto L_021C0518;
   L_021C0518: ; // 0x21c0518
@@ -3196,8 +3196,8 @@ void Gambit_fn_021C04E4(CPUState* cpu) {
         /* 021C0528 */ _t12 = cpu->r[29] + 0x000001CCu;
         /* 021C0528 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
         /* 021C052C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000014u, 0x00000014u);
-        /* 021C052C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021C0530 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C052C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021C0530 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0530 */ _t14 = _t13 & 0x00000001u;
         /* 021C0530 */ if (_t14) goto L_021C05A8; else goto L_021C0534;
   L_021C0534: ; // 0x21c0534
@@ -3208,8 +3208,8 @@ void Gambit_fn_021C04E4(CPUState* cpu) {
         /* 021C053C */ cpu->ctr = cpu->r[0];
         /* 021C0540 */ cpu->r[3] = cpu->r[29];
         /* 021C0544 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021C0548 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C054C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0548 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C054C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C054C */ _t18 = _t17 & 0x00000001u;
         /* 021C054C */ if (_t18) goto L_021C0570; else goto L_021C0550;
   L_021C0550: ; // 0x21c0550
@@ -3322,8 +3322,8 @@ void Gambit_fn_021C04E4(CPUState* cpu) {
         /* 021C0674 */ Gambit_fn_021620C4(cpu);
         /* 021C0678 */ _t50 = cpu->r[29] + 0x000001CCu;
         /* 021C0678 */ cpu->r[5] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t50);
-        /* 021C067C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x0000000Bu);
-        /* 021C0680 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C067C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x0000000Bu));
+        /* 021C0680 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0680 */ _t52 = _t51 & 0x00000001u;
         /* 021C0680 */ if (_t52) goto L_021C0690; else goto L_021C0684;
   L_021C0684: ; // 0x21c0684
@@ -3335,8 +3335,8 @@ void Gambit_fn_021C04E4(CPUState* cpu) {
         /* 021C0690 */ _t54 = cpu->r[29] + 0x000001CCu;
         /* 021C0690 */ cpu->r[10] = rbrew_read32(cpu->mem, _t54);
         /* 021C0694 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000010u, 0x00000011u);
-        /* 021C0694 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021C0698 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0694 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021C0698 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0698 */ _t56 = _t55 & 0x00000001u;
         /* 021C0698 */ if (_t56) goto L_021C069C; else goto L_021C0750;
   L_021C069C: ; // 0x21c069c
@@ -3359,9 +3359,9 @@ void Gambit_fn_021C04E4(CPUState* cpu) {
         /* 021C06C8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021C06CC */ _t62 = cpu->r[29] + 0x00000008u;
         /* 021C06CC */ cpu->r[31] = rbrew_read32(cpu->mem, _t62);
-        /* 021C06D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021C06D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021C06D4 */ cpu->r[3] = cpu->r[31];
-        /* 021C06D8 */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C06D8 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C06D8 */ _t64 = _t63 & 0x00000001u;
         /* 021C06D8 */ if (_t64) goto L_021C06DC; else goto L_021C070C;
   L_021C06DC: ; // 0x21c06dc
@@ -3376,8 +3376,8 @@ void Gambit_fn_021C04E4(CPUState* cpu) {
         /* 021C06F4 */ cpu->r[3] = cpu->r[29];
         /* 021C06F8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021C06FC */ Gambit_fn_027E3F3C(cpu);
-        /* 021C0700 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C0704 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C0704 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0704 */ _t68 = _t67 & 0x00000001u;
         /* 021C0704 */ if (_t68) goto L_021C0758; else goto L_021C0708;
   L_021C0708: ; // 0x21c0708
@@ -3392,8 +3392,8 @@ void Gambit_fn_021C04E4(CPUState* cpu) {
         /* 021C071C */ cpu->r[3] = cpu->r[29];
         /* 021C0720 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021C0724 */ Gambit_fn_027E3F3C(cpu);
-        /* 021C0728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C072C */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C072C */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C072C */ _t72 = _t71 & 0x00000001u;
         /* 021C072C */ if (_t72) goto L_021C0758; else goto L_021C0730;
   L_021C0730: ; // 0x21c0730
@@ -3421,7 +3421,7 @@ void Gambit_fn_021C04E4(CPUState* cpu) {
         /* 021C0764 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t78);
         /* 021C0768 */ _t79 = cpu->r[1] + 0x0000002Cu;
         /* 021C0768 */ cpu->r[31] = rbrew_read32(cpu->mem, _t79);
-        /* 021C076C */ _t80 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C076C */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C076C */ _t81 = _t80 & 0x00000001u;
         /* 021C076C */ if (_t81) goto L_021C0770; // else: addr-0 trap, fall-through
   L_021C0770: ; // 0x21c0770
@@ -3479,8 +3479,8 @@ void Gambit_fn_021C0780(CPUState* cpu) {
         /* 021C07EC */ cpu->r[3] = cpu->r[29];
         /* 021C07F0 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021C07F4 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 021C07F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021C07F8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C07F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021C07F8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C07F8 */ _t11 = _t10 & 0x00000001u;
         /* 021C07F8 */ if (_t11) goto L_021C07FC; else goto L_021C07C8;
   L_021C07FC: ; // 0x21c07fc
@@ -3489,9 +3489,9 @@ void Gambit_fn_021C0780(CPUState* cpu) {
         /* 021C0804 */ cpu->r[30] = 0x00000000u;
   L_021C0808: ; // 0x21c0808
         /* 021C0808 */ cpu->r[0] = cpu->r[30] + 0x00000001u;
-        /* 021C080C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
+        /* 021C080C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
         /* 021C0810 */ cpu->r[31] = cpu->r[28] + 0x00000001u;
-        /* 021C0814 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C0814 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C0814 */ _t13 = _t12 & 0x00000001u;
         /* 021C0814 */ if (_t13) goto L_021C081C; else goto L_021C0818;
   L_021C0818: ; // 0x21c0818
@@ -3505,16 +3505,16 @@ void Gambit_fn_021C0780(CPUState* cpu) {
         /* 021C0828 */ cpu->r[3] = cpu->r[29];
         /* 021C082C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021C0830 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 021C0830 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021C0834 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0830 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021C0834 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0834 */ _t17 = _t16 & 0x00000001u;
         /* 021C0834 */ if (_t17) goto L_021C0838; else goto L_021C081C;
   L_021C0838: ; // 0x21c0838
         /* 021C0838 */ cpu->r[27] = cpu->r[27] + 0xFFFFFFFFu;
-        /* 021C0838 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 021C0838 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 021C083C */ cpu->r[30] = cpu->r[30] + 0x00000001u;
         /* 021C0840 */ cpu->r[28] = cpu->r[28] + 0xFFFFFFFFu;
-        /* 021C0844 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0844 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0844 */ _t19 = _t18 & 0x00000001u;
         /* 021C0844 */ if (_t19) goto L_021C0848; else goto L_021C0808;
   L_021C0848: ; // 0x21c0848
@@ -3544,9 +3544,9 @@ void Gambit_fn_021C085C(CPUState* cpu) {
         /* 021C0870 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 021C0874 */ _t4 = cpu->r[31] + 0x00000000u;
         /* 021C0874 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
-        /* 021C0878 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
+        /* 021C0878 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
         /* 021C087C */ cpu->r[30] = cpu->r[3];
-        /* 021C0880 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0880 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0880 */ _t6 = _t5 & 0x00000001u;
         /* 021C0880 */ if (_t6) goto L_021C0884; else goto L_021C08AC;
   L_021C0884: ; // 0x21c0884
@@ -3557,8 +3557,8 @@ void Gambit_fn_021C085C(CPUState* cpu) {
         /* 021C088C */ cpu->ctr = cpu->r[0];
         /* 021C0890 */ cpu->r[3] = cpu->r[30];
         /* 021C0894 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021C0898 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C089C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0898 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C089C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C089C */ _t10 = _t9 & 0x00000001u;
         /* 021C089C */ if (_t10) goto L_021C08AC; else goto L_021C08A0;
   L_021C08A0: ; // 0x21c08a0
@@ -3594,9 +3594,9 @@ void Gambit_fn_021C0860(CPUState* cpu) {
         /* 021C0870 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 021C0874 */ _t4 = cpu->r[31] + 0x00000000u;
         /* 021C0874 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
-        /* 021C0878 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
+        /* 021C0878 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
         /* 021C087C */ cpu->r[30] = cpu->r[3];
-        /* 021C0880 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0880 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0880 */ _t6 = _t5 & 0x00000001u;
         /* 021C0880 */ if (_t6) goto L_021C0884; else goto L_021C08AC;
   L_021C0884: ; // 0x21c0884
@@ -3607,8 +3607,8 @@ void Gambit_fn_021C0860(CPUState* cpu) {
         /* 021C088C */ cpu->ctr = cpu->r[0];
         /* 021C0890 */ cpu->r[3] = cpu->r[30];
         /* 021C0894 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021C0898 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C089C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0898 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C089C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C089C */ _t10 = _t9 & 0x00000001u;
         /* 021C089C */ if (_t10) goto L_021C08AC; else goto L_021C08A0;
   L_021C08A0: ; // 0x21c08a0
@@ -3750,9 +3750,9 @@ void Gambit_fn_021C0924(CPUState* cpu) {
         /* 02055CA0 */ cpu->r[7] = _t2;
         /* 02055CA4 */ cpu->r[31] = 0x101E0000u;
         /* 02055CA8 */ cpu->r[22] = cpu->r[3];
-        /* 02055CAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02055CAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02055CB0 */ cpu->r[31] = cpu->r[31] + 0xFFFFA07Cu;
-        /* 02055CB4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02055CB4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02055CB4 */ _t4 = _t3 & 0x00000001u;
         /* 02055CB4 */ if (_t4) goto L_02055CB8; else goto L_02055D00;
   L_02055CB8: ; // 0x2055cb8
@@ -3778,8 +3778,8 @@ void Gambit_fn_021C0924(CPUState* cpu) {
   L_02055D00: ; // 0x2055d00
         /* 02055D00 */ _t6 = cpu->r[31] + 0x00000054u;
         /* 02055D00 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 02055D04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02055D08 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02055D04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02055D08 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02055D08 */ _t8 = _t7 & 0x00000001u;
         /* 02055D08 */ if (_t8) goto L_02055D0C; else goto L_02055E00;
   L_02055D0C: ; // 0x2055d0c
@@ -3795,9 +3795,9 @@ void Gambit_fn_021C0924(CPUState* cpu) {
   L_02055D30: ; // 0x2055d30
         /* 02055D30 */ _t9 = cpu->r[24] + 0xFFFFE4A8u;
         /* 02055D30 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 02055D34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02055D34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02055D38 */ cpu->r[29] = cpu->r[30];
-        /* 02055D3C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02055D3C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02055D3C */ _t11 = _t10 & 0x00000001u;
         /* 02055D3C */ if (_t11) goto L_02055D40; else goto L_02055D58;
   L_02055D40: ; // 0x2055d40
@@ -3811,8 +3811,8 @@ void Gambit_fn_021C0924(CPUState* cpu) {
   L_02055D58: ; // 0x2055d58
         /* 02055D58 */ _t13 = cpu->r[20] + 0xFFFFE4A4u;
         /* 02055D58 */ cpu->r[11] = rbrew_read32(cpu->mem, _t13);
-        /* 02055D5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02055D60 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02055D5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02055D60 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02055D60 */ _t15 = _t14 & 0x00000001u;
         /* 02055D60 */ if (_t15) goto L_02055D64; else goto L_02055D6C;
   L_02055D64: ; // 0x2055d64
@@ -3821,8 +3821,8 @@ void Gambit_fn_021C0924(CPUState* cpu) {
         /* 02055D68 */ _t17 = cpu->r[20] + 0xFFFFE4A4u;
         /* 02055D68 */ rbrew_write32(cpu->mem, _t17, cpu->r[21]);
   L_02055D6C: ; // 0x2055d6c
-        /* 02055D6C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], 0x00000003u);
-        /* 02055D70 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02055D6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], 0x00000003u));
+        /* 02055D70 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02055D70 */ _t19 = _t18 & 0x00000001u;
         /* 02055D70 */ if (_t19) goto L_02055D98; else goto L_02055D74;
   L_02055D74: ; // 0x2055d74
@@ -3831,12 +3831,12 @@ void Gambit_fn_021C0924(CPUState* cpu) {
         /* 02055D7C */ cpu->r[5] = 0x00000000u;
         /* 02055D80 */ Gambit_fn_028A6634(cpu);
         /* 02055D84 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02055D88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000003u);
-        /* 02055D8C */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02055D88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000003u));
+        /* 02055D8C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02055D8C */ _t21 = _t20 & 0x00000001u;
         /* 02055D8C */ if (_t21) goto L_02055E00; else goto L_02055D90;
   L_02055D90: ; // 0x2055d90
-        /* 02055D90 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02055D90 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02055D90 */ _t23 = _t22 & 0x00000001u;
         /* 02055D90 */ if (_t23) goto L_02055D30; else goto L_02055D94;
   L_02055D94: ; // 0x2055d94
@@ -3844,8 +3844,8 @@ void Gambit_fn_021C0924(CPUState* cpu) {
   L_02055D98: ; // 0x2055d98
         /* 02055D98 */ _t24 = cpu->r[19] + 0xFFFFE4A0u;
         /* 02055D98 */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
-        /* 02055D9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02055DA0 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02055D9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02055DA0 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02055DA0 */ _t26 = _t25 & 0x00000001u;
         /* 02055DA0 */ if (_t26) goto L_02055DA4; else goto L_02055DDC;
   L_02055DA4: ; // 0x2055da4
@@ -3854,8 +3854,8 @@ void Gambit_fn_021C0924(CPUState* cpu) {
         /* 02055DAC */ Gambit_fn_02836FFC(cpu);
         /* 02055DB0 */ _t27 = cpu->r[19] + 0xFFFFE4A0u;
         /* 02055DB0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t27);
-        /* 02055DB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02055DB8 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02055DB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02055DB8 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02055DB8 */ _t29 = _t28 & 0x00000001u;
         /* 02055DB8 */ if (_t29) goto L_02055DBC; else goto L_02055DD0;
   L_02055DBC: ; // 0x2055dbc
@@ -3878,12 +3878,12 @@ void Gambit_fn_021C0924(CPUState* cpu) {
         /* 02055DE8 */ cpu->r[4] = cpu->r[30];
         /* 02055DEC */ Gambit_fn_028A6634(cpu);
         /* 02055DF0 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02055DF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000003u);
-        /* 02055DF8 */ _t33 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02055DF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000003u));
+        /* 02055DF8 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02055DF8 */ _t34 = _t33 & 0x00000001u;
         /* 02055DF8 */ if (_t34) goto L_02055E00; else goto L_02055DFC;
   L_02055DFC: ; // 0x2055dfc
-        /* 02055DFC */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02055DFC */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02055DFC */ _t36 = _t35 & 0x00000001u;
         /* 02055DFC */ if (_t36) goto L_02055D30; else goto L_02055E00;
   L_02055E00: ; // 0x2055e00
@@ -3922,9 +3922,9 @@ void Gambit_fn_021C0930(CPUState* cpu) {
         /* 02031BE4 */ _t4 = cpu->r[4] + 0x00000000u;
         /* 02031BE4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t4);
         /* 02031BE8 */ cpu->r[31] = cpu->r[4];
-        /* 02031BEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02031BEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02031BF0 */ cpu->r[30] = cpu->r[3];
-        /* 02031BF4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02031BF4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02031BF4 */ _t6 = _t5 & 0x00000001u;
         /* 02031BF4 */ if (_t6) goto L_02031C58; else goto L_02031BF8;
   L_02031BF8: ; // 0x2031bf8
@@ -3932,8 +3932,8 @@ void Gambit_fn_021C0930(CPUState* cpu) {
         /* 02031BF8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
         /* 02031BFC */ _t8 = cpu->r[3] + 0x0000011Cu;
         /* 02031BFC */ cpu->r[11] = rbrew_read8(cpu->mem, _t8);
-        /* 02031C00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02031C04 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02031C00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02031C04 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02031C04 */ _t10 = _t9 & 0x00000001u;
         /* 02031C04 */ if (_t10) goto L_02031C58; else goto L_02031C08;
   L_02031C08: ; // 0x2031c08
@@ -4058,7 +4058,7 @@ void Gambit_fn_021C0940(CPUState* cpu) {
         /* 021C09F4 */ cpu->r[29] = rbrew_read32(cpu->mem, _t20);
         /* 021C09F8 */ _t21 = cpu->r[1] + 0x0000001Cu;
         /* 021C09F8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t21);
-        /* 021C09FC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[13]);
+        /* 021C09FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[13]));
         /* 021C0A00 */ _t22 = cpu->r[1] + 0x00000038u;
         /* 021C0A00 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t22);
         /* 021C0A04 */ _t23 = cpu->r[1] + 0x00000028u;
@@ -4072,7 +4072,7 @@ void Gambit_fn_021C0940(CPUState* cpu) {
         /* 021C0A18 */ _t26 = cpu->r[1] + 0x00000020u;
         /* 021C0A18 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t26);
         /* 021C0A1C */ cpu->r[3] = cpu->r[3] ^ 0x00000001u;
-        /* 021C0A20 */ _t27 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C0A20 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C0A20 */ _t28 = _t27 & 0x00000001u;
         /* 021C0A20 */ if (_t28) goto L_021C0A24; // else: addr-0 trap, fall-through
   L_021C0A24: ; // 0x21c0a24
@@ -4157,7 +4157,7 @@ void Gambit_fn_021C0944(CPUState* cpu) {
         /* 021C09F4 */ cpu->r[29] = rbrew_read32(cpu->mem, _t20);
         /* 021C09F8 */ _t21 = cpu->r[1] + 0x0000001Cu;
         /* 021C09F8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t21);
-        /* 021C09FC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[13]);
+        /* 021C09FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[13]));
         /* 021C0A00 */ _t22 = cpu->r[1] + 0x00000038u;
         /* 021C0A00 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t22);
         /* 021C0A04 */ _t23 = cpu->r[1] + 0x00000028u;
@@ -4171,7 +4171,7 @@ void Gambit_fn_021C0944(CPUState* cpu) {
         /* 021C0A18 */ _t26 = cpu->r[1] + 0x00000020u;
         /* 021C0A18 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t26);
         /* 021C0A1C */ cpu->r[3] = cpu->r[3] ^ 0x00000001u;
-        /* 021C0A20 */ _t27 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C0A20 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C0A20 */ _t28 = _t27 & 0x00000001u;
         /* 021C0A20 */ if (_t28) goto L_021C0A24; // else: addr-0 trap, fall-through
   L_021C0A24: ; // 0x21c0a24
@@ -4214,10 +4214,10 @@ void Gambit_fn_021C0A34(CPUState* cpu) {
         /* 021C0A74 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021C0A78 */ _t7 = cpu->r[31] + 0x000001F6u;
         /* 021C0A78 */ cpu->r[12] = rbrew_read8(cpu->mem, _t7);
-        /* 021C0A7C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], 0x000000FFu);
+        /* 021C0A7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], 0x000000FFu));
         /* 021C0A80 */ _t8 = cpu->r[31] + 0x00000004u;
         /* 021C0A80 */ cpu->r[11] = rbrew_read32(cpu->mem, _t8);
-        /* 021C0A84 */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C0A84 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C0A84 */ _t10 = _t9 & 0x00000001u;
         /* 021C0A84 */ if (_t10) goto L_021C0A88; else goto L_021C0A90;
   L_021C0A88: ; // 0x21c0a88
@@ -4272,10 +4272,10 @@ void Gambit_fn_021C0A38(CPUState* cpu) {
         /* 021C0A74 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021C0A78 */ _t7 = cpu->r[31] + 0x000001F6u;
         /* 021C0A78 */ cpu->r[12] = rbrew_read8(cpu->mem, _t7);
-        /* 021C0A7C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], 0x000000FFu);
+        /* 021C0A7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], 0x000000FFu));
         /* 021C0A80 */ _t8 = cpu->r[31] + 0x00000004u;
         /* 021C0A80 */ cpu->r[11] = rbrew_read32(cpu->mem, _t8);
-        /* 021C0A84 */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C0A84 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C0A84 */ _t10 = _t9 & 0x00000001u;
         /* 021C0A84 */ if (_t10) goto L_021C0A88; else goto L_021C0A90;
   L_021C0A88: ; // 0x21c0a88
@@ -4328,8 +4328,8 @@ void Gambit_fn_021C0AB8(CPUState* cpu) {
         /* 021C0AE4 */ cpu->r[30] = cpu->r[3];
         /* 021C0AE8 */ cpu->r[31] = cpu->r[4];
         /* 021C0AEC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021C0AF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C0AF4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0AF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C0AF4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0AF4 */ _t9 = _t8 & 0x00000001u;
         /* 021C0AF4 */ if (_t9) goto L_021C0AF8; else goto L_021C0F00;
   L_021C0AF8: ; // 0x21c0af8
@@ -4352,14 +4352,14 @@ void Gambit_fn_021C0AB8(CPUState* cpu) {
         /* 021C0B24 */ /* nop */
         /* 021C0B28 */ _t15 = cpu->r[3] + 0x00000008u;
         /* 021C0B28 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t15);
-        /* 021C0B2C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[10]);
+        /* 021C0B2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[10]));
         /* 021C0B30 */ cpu->r[7] = 0x10030000u;
         /* 021C0B34 */ cpu->f[12] = cpu->f[13] - cpu->f[7];
         /* 021C0B38 */ _t16 = cpu->r[7] + 0xFFFFB5F8u;
         /* 021C0B38 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t16);
         /* 021C0B3C */ _t17 = cpu->r[1] + 0x00000028u;
         /* 021C0B3C */ rbrew_write_f32(cpu->mem, _t17, cpu->f[12]);
-        /* 021C0B40 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0B40 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0B40 */ _t19 = _t18 & 0x00000001u;
         /* 021C0B40 */ if (_t19) goto L_021C0B44; else goto L_021C0B54;
   L_021C0B44: ; // 0x21c0b44
@@ -4367,8 +4367,8 @@ void Gambit_fn_021C0AB8(CPUState* cpu) {
         /* 021C0B44 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t20);
         /* 021C0B48 */ _t21 = cpu->r[31] + 0x00000014u;
         /* 021C0B48 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t21);
-        /* 021C0B4C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[12]);
-        /* 021C0B50 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[12]));
+        /* 021C0B50 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0B50 */ _t23 = _t22 & 0x00000001u;
         /* 021C0B50 */ if (_t23) goto L_021C0C20; else goto L_021C0B54;
   L_021C0B54: ; // 0x21c0b54
@@ -4417,11 +4417,11 @@ void Gambit_fn_021C0AB8(CPUState* cpu) {
         /* 021C0BC8 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t36);
         /* 021C0BCC */ cpu->f[11] = fma(cpu->f[8], cpu->f[10], cpu->f[7]);
         /* 021C0BD0 */ /* nop */
-        /* 021C0BD4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
+        /* 021C0BD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
         /* 021C0BD8 */ _t37 = cpu->r[1] + 0x00000040u;
         /* 021C0BD8 */ rbrew_write_f32(cpu->mem, _t37, cpu->f[10]);
         /* 021C0BDC */ /* nop */
-        /* 021C0BE0 */ _t38 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C0BE0 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C0BE0 */ _t39 = _t38 & 0x00000001u;
         /* 021C0BE0 */ if (_t39) goto L_021C0BE4; else goto L_021C0CB8;
   L_021C0BE4: ; // 0x21c0be4
@@ -4446,8 +4446,8 @@ void Gambit_fn_021C0AB8(CPUState* cpu) {
         /* 021C0C0C */ _t48 = cpu->r[1] + 0x00000010u;
         /* 021C0C0C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t48);
         /* 021C0C10 */ cpu->f[7] = fma(cpu->f[10], cpu->f[10], cpu->f[12]);
-        /* 021C0C14 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[31]);
-        /* 021C0C18 */ _t49 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C0C14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[31]));
+        /* 021C0C18 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C0C18 */ _t50 = _t49 & 0x00000001u;
         /* 021C0C18 */ if (_t50) goto L_021C0C1C; else goto L_021C0D84;
   L_021C0C1C: ; // 0x21c0c1c
@@ -4457,8 +4457,8 @@ void Gambit_fn_021C0AB8(CPUState* cpu) {
         /* 021C0C20 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t51);
         /* 021C0C24 */ _t52 = cpu->r[31] + 0x00000018u;
         /* 021C0C24 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t52);
-        /* 021C0C28 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[11]);
-        /* 021C0C2C */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0C28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[11]));
+        /* 021C0C2C */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0C2C */ _t54 = _t53 & 0x00000001u;
         /* 021C0C2C */ if (_t54) goto L_021C0D10; else goto L_021C0C30;
   L_021C0C30: ; // 0x21c0c30
@@ -4504,11 +4504,11 @@ void Gambit_fn_021C0AB8(CPUState* cpu) {
         /* 021C0C9C */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t66);
         /* 021C0CA0 */ cpu->f[11] = fma(cpu->f[8], cpu->f[10], cpu->f[7]);
         /* 021C0CA4 */ /* nop */
-        /* 021C0CA8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
+        /* 021C0CA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
         /* 021C0CAC */ _t67 = cpu->r[1] + 0x00000040u;
         /* 021C0CAC */ rbrew_write_f32(cpu->mem, _t67, cpu->f[10]);
         /* 021C0CB0 */ /* nop */
-        /* 021C0CB4 */ _t68 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C0CB4 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C0CB4 */ _t69 = _t68 & 0x00000001u;
         /* 021C0CB4 */ if (_t69) goto L_021C0BE4; else goto L_021C0CB8;
   L_021C0CB8: ; // 0x21c0cb8
@@ -4517,8 +4517,8 @@ void Gambit_fn_021C0AB8(CPUState* cpu) {
         /* 021C0CBC */ _t71 = cpu->r[1] + 0x00000028u;
         /* 021C0CBC */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t71);
         /* 021C0CC0 */ cpu->f[12] = fma(cpu->f[8], cpu->f[9], cpu->f[10]);
-        /* 021C0CC4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[31]);
-        /* 021C0CC8 */ _t72 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C0CC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[31]));
+        /* 021C0CC8 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C0CC8 */ _t73 = _t72 & 0x00000001u;
         /* 021C0CC8 */ if (_t73) goto L_021C0D10; else goto L_021C0CCC;
   L_021C0CCC: ; // 0x21c0ccc
@@ -4539,8 +4539,8 @@ void Gambit_fn_021C0AB8(CPUState* cpu) {
         /* 021C0CFC */ _t76 = cpu->r[1] + 0x00000010u;
         /* 021C0CFC */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t76);
         /* 021C0D00 */ cpu->f[7] = fma(cpu->f[10], cpu->f[10], cpu->f[12]);
-        /* 021C0D04 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[31]);
-        /* 021C0D08 */ _t77 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C0D04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[31]));
+        /* 021C0D08 */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C0D08 */ _t78 = _t77 & 0x00000001u;
         /* 021C0D08 */ if (_t78) goto L_021C0D0C; else goto L_021C0D84;
   L_021C0D0C: ; // 0x21c0d0c
@@ -4567,8 +4567,8 @@ void Gambit_fn_021C0AB8(CPUState* cpu) {
         /* 021C0D38 */ _t87 = cpu->r[1] + 0x00000010u;
         /* 021C0D38 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t87);
         /* 021C0D3C */ cpu->f[7] = fma(cpu->f[10], cpu->f[10], cpu->f[12]);
-        /* 021C0D40 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[31]);
-        /* 021C0D44 */ _t88 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C0D40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[31]));
+        /* 021C0D44 */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C0D44 */ _t89 = _t88 & 0x00000001u;
         /* 021C0D44 */ if (_t89) goto L_021C0D48; else goto L_021C0D84;
   L_021C0D48: ; // 0x21c0d48
@@ -4611,8 +4611,8 @@ void Gambit_fn_021C0AB8(CPUState* cpu) {
         /* 021C0DAC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t99);
         /* 021C0DB0 */ /* nop */
         /* 021C0DB4 */ cpu->f[7] = fma(cpu->f[13], cpu->f[0], cpu->f[11]);
-        /* 021C0DB8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[31]);
-        /* 021C0DBC */ _t100 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C0DB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[31]));
+        /* 021C0DBC */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C0DBC */ _t101 = _t100 & 0x00000001u;
         /* 021C0DBC */ if (_t101) goto L_021C0DC0; else goto L_021C0F00;
   L_021C0DC0: ; // 0x21c0dc0
@@ -4704,23 +4704,23 @@ void Gambit_fn_021C0AB8(CPUState* cpu) {
         /* 021C0E9C */ cpu->r[0] = rbrew_read32(cpu->mem, _t131);
         /* 021C0EA0 */ /* nop */
         /* 021C0EA4 */ /* nop */
-        /* 021C0EA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
+        /* 021C0EA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
         /* 021C0EAC */ _t132 = cpu->r[1] + 0x0000001Cu;
         /* 021C0EAC */ rbrew_write_f32(cpu->mem, _t132, cpu->f[0]);
-        /* 021C0EB0 */ _t133 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0EB0 */ _t133 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0EB0 */ _t134 = _t133 & 0x00000001u;
         /* 021C0EB0 */ if (_t134) goto L_021C0EBC; else goto L_021C0EB4;
   L_021C0EB4: ; // 0x21c0eb4
-        /* 021C0EB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021C0EB8 */ _t135 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0EB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021C0EB8 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0EB8 */ _t136 = _t135 & 0x00000001u;
         /* 021C0EB8 */ if (_t136) goto L_021C0EBC; else goto L_021C0EEC;
   L_021C0EBC: ; // 0x21c0ebc
         /* 021C0EBC */ _t137 = cpu->r[30] + 0x000001CCu;
         /* 021C0EBC */ cpu->r[5] = rbrew_read32(cpu->mem, _t137);
         /* 021C0EC0 */ cpu->r[5] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x00000010u, 0x00000011u);
-        /* 021C0EC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 021C0EC4 */ _t138 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0EC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 021C0EC4 */ _t138 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0EC4 */ _t139 = _t138 & 0x00000001u;
         /* 021C0EC4 */ if (_t139) goto L_021C0EC8; else goto L_021C0EEC;
   L_021C0EC8: ; // 0x21c0ec8
@@ -4728,8 +4728,8 @@ void Gambit_fn_021C0AB8(CPUState* cpu) {
         /* 021C0ECC */ cpu->r[4] = cpu->r[31];
         /* 021C0ED0 */ cpu->r[3] = cpu->r[30];
         /* 021C0ED4 */ Gambit_fn_021C0940(cpu);
-        /* 021C0ED8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C0EDC */ _t140 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0ED8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C0EDC */ _t140 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0EDC */ _t141 = _t140 & 0x00000001u;
         /* 021C0EDC */ if (_t141) goto L_021C0EE8; else goto L_021C0EE0;
   L_021C0EE0: ; // 0x21c0ee0
@@ -4758,7 +4758,7 @@ void Gambit_fn_021C0AB8(CPUState* cpu) {
         /* 021C0F08 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t150);
         /* 021C0F0C */ _t151 = cpu->r[1] + 0x000000C0u;
         /* 021C0F0C */ cpu->r[30] = rbrew_read32(cpu->mem, _t151);
-        /* 021C0F10 */ _t152 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C0F10 */ _t152 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C0F10 */ _t153 = _t152 & 0x00000001u;
         /* 021C0F10 */ if (_t153) goto L_021C0F14; // else: addr-0 trap, fall-through
   L_021C0F14: ; // 0x21c0f14
@@ -4797,8 +4797,8 @@ void Gambit_fn_021C0ABC(CPUState* cpu) {
         /* 021C0AE4 */ cpu->r[30] = cpu->r[3];
         /* 021C0AE8 */ cpu->r[31] = cpu->r[4];
         /* 021C0AEC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021C0AF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C0AF4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0AF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C0AF4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0AF4 */ _t9 = _t8 & 0x00000001u;
         /* 021C0AF4 */ if (_t9) goto L_021C0AF8; else goto L_021C0F00;
   L_021C0AF8: ; // 0x21c0af8
@@ -4821,14 +4821,14 @@ void Gambit_fn_021C0ABC(CPUState* cpu) {
         /* 021C0B24 */ /* nop */
         /* 021C0B28 */ _t15 = cpu->r[3] + 0x00000008u;
         /* 021C0B28 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t15);
-        /* 021C0B2C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[10]);
+        /* 021C0B2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[10]));
         /* 021C0B30 */ cpu->r[7] = 0x10030000u;
         /* 021C0B34 */ cpu->f[12] = cpu->f[13] - cpu->f[7];
         /* 021C0B38 */ _t16 = cpu->r[7] + 0xFFFFB5F8u;
         /* 021C0B38 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t16);
         /* 021C0B3C */ _t17 = cpu->r[1] + 0x00000028u;
         /* 021C0B3C */ rbrew_write_f32(cpu->mem, _t17, cpu->f[12]);
-        /* 021C0B40 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0B40 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0B40 */ _t19 = _t18 & 0x00000001u;
         /* 021C0B40 */ if (_t19) goto L_021C0B44; else goto L_021C0B54;
   L_021C0B44: ; // 0x21c0b44
@@ -4836,8 +4836,8 @@ void Gambit_fn_021C0ABC(CPUState* cpu) {
         /* 021C0B44 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t20);
         /* 021C0B48 */ _t21 = cpu->r[31] + 0x00000014u;
         /* 021C0B48 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t21);
-        /* 021C0B4C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[12]);
-        /* 021C0B50 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[12]));
+        /* 021C0B50 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0B50 */ _t23 = _t22 & 0x00000001u;
         /* 021C0B50 */ if (_t23) goto L_021C0C20; else goto L_021C0B54;
   L_021C0B54: ; // 0x21c0b54
@@ -4886,11 +4886,11 @@ void Gambit_fn_021C0ABC(CPUState* cpu) {
         /* 021C0BC8 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t36);
         /* 021C0BCC */ cpu->f[11] = fma(cpu->f[8], cpu->f[10], cpu->f[7]);
         /* 021C0BD0 */ /* nop */
-        /* 021C0BD4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
+        /* 021C0BD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
         /* 021C0BD8 */ _t37 = cpu->r[1] + 0x00000040u;
         /* 021C0BD8 */ rbrew_write_f32(cpu->mem, _t37, cpu->f[10]);
         /* 021C0BDC */ /* nop */
-        /* 021C0BE0 */ _t38 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C0BE0 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C0BE0 */ _t39 = _t38 & 0x00000001u;
         /* 021C0BE0 */ if (_t39) goto L_021C0BE4; else goto L_021C0CB8;
   L_021C0BE4: ; // 0x21c0be4
@@ -4915,8 +4915,8 @@ void Gambit_fn_021C0ABC(CPUState* cpu) {
         /* 021C0C0C */ _t48 = cpu->r[1] + 0x00000010u;
         /* 021C0C0C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t48);
         /* 021C0C10 */ cpu->f[7] = fma(cpu->f[10], cpu->f[10], cpu->f[12]);
-        /* 021C0C14 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[31]);
-        /* 021C0C18 */ _t49 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C0C14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[31]));
+        /* 021C0C18 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C0C18 */ _t50 = _t49 & 0x00000001u;
         /* 021C0C18 */ if (_t50) goto L_021C0C1C; else goto L_021C0D84;
   L_021C0C1C: ; // 0x21c0c1c
@@ -4926,8 +4926,8 @@ void Gambit_fn_021C0ABC(CPUState* cpu) {
         /* 021C0C20 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t51);
         /* 021C0C24 */ _t52 = cpu->r[31] + 0x00000018u;
         /* 021C0C24 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t52);
-        /* 021C0C28 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[11]);
-        /* 021C0C2C */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0C28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[11]));
+        /* 021C0C2C */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0C2C */ _t54 = _t53 & 0x00000001u;
         /* 021C0C2C */ if (_t54) goto L_021C0D10; else goto L_021C0C30;
   L_021C0C30: ; // 0x21c0c30
@@ -4973,11 +4973,11 @@ void Gambit_fn_021C0ABC(CPUState* cpu) {
         /* 021C0C9C */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t66);
         /* 021C0CA0 */ cpu->f[11] = fma(cpu->f[8], cpu->f[10], cpu->f[7]);
         /* 021C0CA4 */ /* nop */
-        /* 021C0CA8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
+        /* 021C0CA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
         /* 021C0CAC */ _t67 = cpu->r[1] + 0x00000040u;
         /* 021C0CAC */ rbrew_write_f32(cpu->mem, _t67, cpu->f[10]);
         /* 021C0CB0 */ /* nop */
-        /* 021C0CB4 */ _t68 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C0CB4 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C0CB4 */ _t69 = _t68 & 0x00000001u;
         /* 021C0CB4 */ if (_t69) goto L_021C0BE4; else goto L_021C0CB8;
   L_021C0CB8: ; // 0x21c0cb8
@@ -4986,8 +4986,8 @@ void Gambit_fn_021C0ABC(CPUState* cpu) {
         /* 021C0CBC */ _t71 = cpu->r[1] + 0x00000028u;
         /* 021C0CBC */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t71);
         /* 021C0CC0 */ cpu->f[12] = fma(cpu->f[8], cpu->f[9], cpu->f[10]);
-        /* 021C0CC4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[31]);
-        /* 021C0CC8 */ _t72 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C0CC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[31]));
+        /* 021C0CC8 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C0CC8 */ _t73 = _t72 & 0x00000001u;
         /* 021C0CC8 */ if (_t73) goto L_021C0D10; else goto L_021C0CCC;
   L_021C0CCC: ; // 0x21c0ccc
@@ -5008,8 +5008,8 @@ void Gambit_fn_021C0ABC(CPUState* cpu) {
         /* 021C0CFC */ _t76 = cpu->r[1] + 0x00000010u;
         /* 021C0CFC */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t76);
         /* 021C0D00 */ cpu->f[7] = fma(cpu->f[10], cpu->f[10], cpu->f[12]);
-        /* 021C0D04 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[31]);
-        /* 021C0D08 */ _t77 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C0D04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[31]));
+        /* 021C0D08 */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C0D08 */ _t78 = _t77 & 0x00000001u;
         /* 021C0D08 */ if (_t78) goto L_021C0D0C; else goto L_021C0D84;
   L_021C0D0C: ; // 0x21c0d0c
@@ -5036,8 +5036,8 @@ void Gambit_fn_021C0ABC(CPUState* cpu) {
         /* 021C0D38 */ _t87 = cpu->r[1] + 0x00000010u;
         /* 021C0D38 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t87);
         /* 021C0D3C */ cpu->f[7] = fma(cpu->f[10], cpu->f[10], cpu->f[12]);
-        /* 021C0D40 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[31]);
-        /* 021C0D44 */ _t88 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C0D40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[31]));
+        /* 021C0D44 */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C0D44 */ _t89 = _t88 & 0x00000001u;
         /* 021C0D44 */ if (_t89) goto L_021C0D48; else goto L_021C0D84;
   L_021C0D48: ; // 0x21c0d48
@@ -5080,8 +5080,8 @@ void Gambit_fn_021C0ABC(CPUState* cpu) {
         /* 021C0DAC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t99);
         /* 021C0DB0 */ /* nop */
         /* 021C0DB4 */ cpu->f[7] = fma(cpu->f[13], cpu->f[0], cpu->f[11]);
-        /* 021C0DB8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[31]);
-        /* 021C0DBC */ _t100 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C0DB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[31]));
+        /* 021C0DBC */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C0DBC */ _t101 = _t100 & 0x00000001u;
         /* 021C0DBC */ if (_t101) goto L_021C0DC0; else goto L_021C0F00;
   L_021C0DC0: ; // 0x21c0dc0
@@ -5173,23 +5173,23 @@ void Gambit_fn_021C0ABC(CPUState* cpu) {
         /* 021C0E9C */ cpu->r[0] = rbrew_read32(cpu->mem, _t131);
         /* 021C0EA0 */ /* nop */
         /* 021C0EA4 */ /* nop */
-        /* 021C0EA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
+        /* 021C0EA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
         /* 021C0EAC */ _t132 = cpu->r[1] + 0x0000001Cu;
         /* 021C0EAC */ rbrew_write_f32(cpu->mem, _t132, cpu->f[0]);
-        /* 021C0EB0 */ _t133 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0EB0 */ _t133 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0EB0 */ _t134 = _t133 & 0x00000001u;
         /* 021C0EB0 */ if (_t134) goto L_021C0EBC; else goto L_021C0EB4;
   L_021C0EB4: ; // 0x21c0eb4
-        /* 021C0EB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021C0EB8 */ _t135 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0EB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021C0EB8 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0EB8 */ _t136 = _t135 & 0x00000001u;
         /* 021C0EB8 */ if (_t136) goto L_021C0EBC; else goto L_021C0EEC;
   L_021C0EBC: ; // 0x21c0ebc
         /* 021C0EBC */ _t137 = cpu->r[30] + 0x000001CCu;
         /* 021C0EBC */ cpu->r[5] = rbrew_read32(cpu->mem, _t137);
         /* 021C0EC0 */ cpu->r[5] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x00000010u, 0x00000011u);
-        /* 021C0EC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 021C0EC4 */ _t138 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0EC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 021C0EC4 */ _t138 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0EC4 */ _t139 = _t138 & 0x00000001u;
         /* 021C0EC4 */ if (_t139) goto L_021C0EC8; else goto L_021C0EEC;
   L_021C0EC8: ; // 0x21c0ec8
@@ -5197,8 +5197,8 @@ void Gambit_fn_021C0ABC(CPUState* cpu) {
         /* 021C0ECC */ cpu->r[4] = cpu->r[31];
         /* 021C0ED0 */ cpu->r[3] = cpu->r[30];
         /* 021C0ED4 */ Gambit_fn_021C0940(cpu);
-        /* 021C0ED8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C0EDC */ _t140 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0ED8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C0EDC */ _t140 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0EDC */ _t141 = _t140 & 0x00000001u;
         /* 021C0EDC */ if (_t141) goto L_021C0EE8; else goto L_021C0EE0;
   L_021C0EE0: ; // 0x21c0ee0
@@ -5227,7 +5227,7 @@ void Gambit_fn_021C0ABC(CPUState* cpu) {
         /* 021C0F08 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t150);
         /* 021C0F0C */ _t151 = cpu->r[1] + 0x000000C0u;
         /* 021C0F0C */ cpu->r[30] = rbrew_read32(cpu->mem, _t151);
-        /* 021C0F10 */ _t152 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C0F10 */ _t152 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C0F10 */ _t153 = _t152 & 0x00000001u;
         /* 021C0F10 */ if (_t153) goto L_021C0F14; // else: addr-0 trap, fall-through
   L_021C0F14: ; // 0x21c0f14
@@ -5357,12 +5357,12 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C1044 */ _t37 = cpu->r[1] + 0x00000230u;
         /* 021C1044 */ rbrew_write_f32(cpu->mem, _t37, cpu->f[12]);
         /* 021C1048 */ cpu->r[0] = rbrew_rlwinm(cpu->r[21], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021C1048 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021C1048 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021C104C */ _t38 = cpu->r[1] + 0x00000224u;
         /* 021C104C */ rbrew_write_f32(cpu->mem, _t38, cpu->f[7]);
         /* 021C1050 */ _t39 = cpu->r[1] + 0x00000224u;
         /* 021C1050 */ cpu->r[5] = rbrew_read32(cpu->mem, _t39);
-        /* 021C1054 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1054 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1054 */ _t41 = _t40 & 0x00000001u;
         /* 021C1054 */ if (_t41) goto L_021C10D8; else goto L_021C1058;
   L_021C1058: ; // 0x21c1058
@@ -5404,7 +5404,7 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C10B0 */ _t55 = cpu->r[1] + 0x00000028u;
         /* 021C10B0 */ rbrew_write32(cpu->mem, _t55, cpu->r[12]);
         /* 021C10B4 */ cpu->r[12] = cpu->r[0] ^ 0x00000001u;
-        /* 021C10B8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[30]);
+        /* 021C10B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[30]));
         /* 021C10BC */ _t56 = cpu->r[8] + 0xFFFFB604u;
         /* 021C10BC */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t56);
         /* 021C10C0 */ cpu->r[0] = 0x00000001u;
@@ -5413,7 +5413,7 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C10C8 */ cpu->r[18] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000018u, 0x0000001Fu);
         /* 021C10CC */ _t58 = cpu->r[1] + 0x00000018u;
         /* 021C10CC */ rbrew_write8(cpu->mem, _t58, (uint8_t)cpu->r[0]);
-        /* 021C10D0 */ _t59 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C10D0 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C10D0 */ _t60 = _t59 & 0x00000001u;
         /* 021C10D0 */ if (_t60) goto L_021C10D4; else goto L_021C1154;
   L_021C10D4: ; // 0x21c10d4
@@ -5459,14 +5459,14 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C1134 */ _t75 = cpu->r[1] + 0x00000028u;
         /* 021C1134 */ rbrew_write32(cpu->mem, _t75, cpu->r[12]);
         /* 021C1138 */ cpu->r[12] = cpu->r[0] ^ 0x00000001u;
-        /* 021C113C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[30]);
+        /* 021C113C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[30]));
         /* 021C1140 */ _t76 = cpu->r[8] + 0xFFFFB604u;
         /* 021C1140 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t76);
         /* 021C1144 */ cpu->r[0] = 0x00000001u;
         /* 021C1148 */ cpu->r[18] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000018u, 0x0000001Fu);
         /* 021C114C */ _t77 = cpu->r[1] + 0x00000018u;
         /* 021C114C */ rbrew_write8(cpu->mem, _t77, (uint8_t)cpu->r[0]);
-        /* 021C1150 */ _t78 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C1150 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C1150 */ _t79 = _t78 & 0x00000001u;
         /* 021C1150 */ if (_t79) goto L_021C1178; else goto L_021C1154;
   L_021C1154: ; // 0x21c1154
@@ -5477,9 +5477,9 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C115C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t81);
         /* 021C1160 */ /* nop */
         /* 021C1164 */ cpu->f[8] = cpu->f[11] * cpu->f[13];
-        /* 021C1168 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[8]);
+        /* 021C1168 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[8]));
         /* 021C116C */ /* nop */
-        /* 021C1170 */ _t82 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C1170 */ _t82 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C1170 */ _t83 = _t82 & 0x00000001u;
         /* 021C1170 */ if (_t83) goto L_021C11C8; else goto L_021C1174;
   L_021C1174: ; // 0x21c1174
@@ -5507,10 +5507,10 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C11B0 */ _t89 = cpu->r[1] + 0x000000C4u;
         /* 021C11B0 */ rbrew_write_f32(cpu->mem, _t89, cpu->f[9]);
         /* 021C11B4 */ /* nop */
-        /* 021C11B8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[8]);
+        /* 021C11B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[8]));
         /* 021C11BC */ /* nop */
         /* 021C11C0 */ cpu->r[24] = cpu->r[1] + 0x0000021Cu;
-        /* 021C11C4 */ _t90 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C11C4 */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C11C4 */ _t91 = _t90 & 0x00000001u;
         /* 021C11C4 */ if (_t91) goto L_021C11C8; else goto L_021C11CC;
   L_021C11C8: ; // 0x21c11c8
@@ -5550,7 +5550,7 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C1214 */ cpu->f[10] = cpu->f[10] + cpu->f[11];
         /* 021C1218 */ _t105 = cpu->r[28] + 0x00000004u;
         /* 021C1218 */ cpu->f[26] = rbrew_read_f32(cpu->mem, _t105);
-        /* 021C121C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[19], cpu->r[0]);
+        /* 021C121C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[19], cpu->r[0]));
         /* 021C1220 */ _t106 = cpu->r[28] + 0x0000000Cu;
         /* 021C1220 */ cpu->r[21] = rbrew_read32(cpu->mem, _t106);
         /* 021C1224 */ _t107 = cpu->r[1] + 0x00000030u;
@@ -5565,7 +5565,7 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C123C */ cpu->r[3] = cpu->r[1] + 0x00000140u;
         /* 021C1240 */ _t110 = cpu->r[1] + 0x0000001Cu;
         /* 021C1240 */ rbrew_write32(cpu->mem, _t110, cpu->r[7]);
-        /* 021C1244 */ _t111 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C1244 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C1244 */ _t112 = _t111 & 0x00000001u;
         /* 021C1244 */ if (_t112) goto L_021C1248; else goto L_021C124C;
   L_021C1248: ; // 0x21c1248
@@ -5631,8 +5631,8 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C12C8 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t138);
         /* 021C12CC */ cpu->f[10] = fma(cpu->f[7], cpu->f[7], cpu->f[9]);
         /* 021C12D0 */ cpu->f[0] = fma(cpu->f[11], cpu->f[11], cpu->f[10]);
-        /* 021C12D4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[30]);
-        /* 021C12D8 */ _t139 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C12D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[30]));
+        /* 021C12D8 */ _t139 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C12D8 */ _t140 = _t139 & 0x00000001u;
         /* 021C12D8 */ if (_t140) goto L_021C12DC; else goto L_021C130C;
   L_021C12DC: ; // 0x21c12dc
@@ -5719,8 +5719,8 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C13C0 */ _t162 = cpu->r[1] + 0x0000000Cu;
         /* 021C13C0 */ rbrew_write32(cpu->mem, _t162, cpu->r[15]);
         /* 021C13C4 */ Gambit_fn_021F4570(cpu);
-        /* 021C13C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C13CC */ _t163 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C13C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C13CC */ _t163 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C13CC */ _t164 = _t163 & 0x00000001u;
         /* 021C13CC */ if (_t164) goto L_021C156C; else goto L_021C13D0;
   L_021C13D0: ; // 0x21c13d0
@@ -5733,8 +5733,8 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C13E4 */ _t166 = cpu->r[1] + 0x00000070u;
         /* 021C13E4 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t166);
         /* 021C13E8 */ cpu->f[7] = fma(cpu->f[6], cpu->f[13], cpu->f[12]);
-        /* 021C13EC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[24]);
-        /* 021C13F0 */ _t167 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C13EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[24]));
+        /* 021C13F0 */ _t167 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C13F0 */ _t168 = _t167 & 0x00000001u;
         /* 021C13F0 */ if (_t168) goto L_021C1494; else goto L_021C13F4;
   L_021C13F4: ; // 0x21c13f4
@@ -5795,10 +5795,10 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C1480 */ _t188 = cpu->r[1] + 0x00000058u;
         /* 021C1480 */ rbrew_write_f32(cpu->mem, _t188, cpu->f[8]);
         /* 021C1484 */ cpu->r[14] = cpu->r[14] + 0xFFFFFFFFu;
-        /* 021C1484 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[14], 0x00000000u);
+        /* 021C1484 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[14], 0x00000000u));
         /* 021C1488 */ _t189 = cpu->r[1] + 0x0000005Cu;
         /* 021C1488 */ rbrew_write_f32(cpu->mem, _t189, cpu->f[0]);
-        /* 021C148C */ _t190 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C148C */ _t190 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C148C */ _t191 = _t190 & 0x00000001u;
         /* 021C148C */ if (_t191) goto L_021C1490; else goto L_021C1388;
   L_021C1490: ; // 0x21c1490
@@ -5880,18 +5880,18 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C1554 */ _t217 = cpu->r[1] + 0x00000058u;
         /* 021C1554 */ rbrew_write_f32(cpu->mem, _t217, cpu->f[8]);
         /* 021C1558 */ cpu->r[14] = cpu->r[14] + 0xFFFFFFFFu;
-        /* 021C1558 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[14], 0x00000000u);
+        /* 021C1558 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[14], 0x00000000u));
         /* 021C155C */ /* nop */
         /* 021C1560 */ _t218 = cpu->r[1] + 0x000000D0u;
         /* 021C1560 */ rbrew_write_f32(cpu->mem, _t218, cpu->f[10]);
         /* 021C1564 */ _t219 = cpu->r[1] + 0x0000005Cu;
         /* 021C1564 */ rbrew_write_f32(cpu->mem, _t219, cpu->f[0]);
-        /* 021C1568 */ _t220 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1568 */ _t220 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1568 */ _t221 = _t220 & 0x00000001u;
         /* 021C1568 */ if (_t221) goto L_021C156C; else goto L_021C1388;
   L_021C156C: ; // 0x21c156c
-        /* 021C156C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021C1570 */ _t222 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C156C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021C1570 */ _t222 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1570 */ _t223 = _t222 & 0x00000001u;
         /* 021C1570 */ if (_t223) goto L_021C158C; else goto L_021C1574;
   L_021C1574: ; // 0x21c1574
@@ -5908,8 +5908,8 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C1588 */ _t229 = cpu->r[29] + 0x00000004u;
         /* 021C1588 */ rbrew_write32(cpu->mem, _t229, cpu->r[12]);
   L_021C158C: ; // 0x21c158c
-        /* 021C158C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021C1590 */ _t230 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C158C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021C1590 */ _t230 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1590 */ _t231 = _t230 & 0x00000001u;
         /* 021C1590 */ if (_t231) goto L_021C15AC; else goto L_021C1594;
   L_021C1594: ; // 0x21c1594
@@ -5927,8 +5927,8 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C15A8 */ rbrew_write32(cpu->mem, _t237, cpu->r[9]);
   L_021C15AC: ; // 0x21c15ac
         /* 021C15AC */ cpu->r[27] = 0x00000000u;
-        /* 021C15B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[17]);
-        /* 021C15B4 */ _t238 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C15B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[17]));
+        /* 021C15B4 */ _t238 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C15B4 */ _t239 = _t238 & 0x00000001u;
         /* 021C15B4 */ if (_t239) goto L_021C15B8; else goto L_021C1910;
   L_021C15B8: ; // 0x21c15b8
@@ -5974,10 +5974,10 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C162C */ _t249 = cpu->r[1] + 0x0000003Cu;
         /* 021C162C */ rbrew_write_f32(cpu->mem, _t249, cpu->f[26]);
         /* 021C1630 */ Gambit_fn_02050DF0(cpu);
-        /* 021C1634 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[19]);
+        /* 021C1634 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[19]));
         /* 021C1638 */ cpu->r[14] = cpu->r[25];
         /* 021C163C */ cpu->r[21] = cpu->r[21] + 0xFFFFFFFFu;
-        /* 021C1640 */ _t250 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C1640 */ _t250 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C1640 */ _t251 = _t250 & 0x00000001u;
         /* 021C1640 */ if (_t251) goto L_021C1644; else goto L_021C1664;
   L_021C1644: ; // 0x21c1644
@@ -5996,8 +5996,8 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C165C */ rbrew_write_f32(cpu->mem, _t257, cpu->f[8]);
         /* 021C1660 */ cpu->r[24] = cpu->r[24] + 0x0000000Cu;
   L_021C1664: ; // 0x21c1664
-        /* 021C1664 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 021C1668 */ _t258 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1664 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 021C1668 */ _t258 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1668 */ _t259 = _t258 & 0x00000001u;
         /* 021C1668 */ if (_t259) goto L_021C166C; else goto L_021C18E4;
   L_021C166C: ; // 0x21c166c
@@ -6017,10 +6017,10 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C1690 */ cpu->f[13] = cpu->f[13] - cpu->f[0];
         /* 021C1694 */ cpu->f[8] = fma(cpu->f[6], cpu->f[6], cpu->f[7]);
         /* 021C1698 */ cpu->f[1] = fma(cpu->f[13], cpu->f[13], cpu->f[8]);
-        /* 021C169C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[27]);
+        /* 021C169C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[27]));
         /* 021C16A0 */ _t264 = cpu->r[1] + 0x00000054u;
         /* 021C16A0 */ rbrew_write_f32(cpu->mem, _t264, cpu->f[13]);
-        /* 021C16A4 */ _t265 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C16A4 */ _t265 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C16A4 */ _t266 = _t265 & 0x00000001u;
         /* 021C16A4 */ if (_t266) goto L_021C16A8; else goto L_021C16D8;
   L_021C16A8: ; // 0x21c16a8
@@ -6041,8 +6041,8 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C16D4 */ _t270 = cpu->r[1] + 0x00000054u;
         /* 021C16D4 */ rbrew_write_f32(cpu->mem, _t270, cpu->f[11]);
   L_021C16D8: ; // 0x21c16d8
-        /* 021C16D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[18], 0x00000000u);
-        /* 021C16DC */ _t271 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C16D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[18], 0x00000000u));
+        /* 021C16DC */ _t271 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C16DC */ _t272 = _t271 & 0x00000001u;
         /* 021C16DC */ if (_t272) goto L_021C16E0; else goto L_021C18C4;
   L_021C16E0: ; // 0x21c16e0
@@ -6066,20 +6066,20 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C1714 */ _t277 = cpu->r[1] + 0x00000010u;
         /* 021C1714 */ rbrew_write32(cpu->mem, _t277, cpu->r[23]);
         /* 021C1718 */ Gambit_fn_021F4570(cpu);
-        /* 021C171C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C1720 */ _t278 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C171C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C1720 */ _t278 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1720 */ _t279 = _t278 & 0x00000001u;
         /* 021C1720 */ if (_t279) goto L_021C18C4; else goto L_021C1724;
   L_021C1724: ; // 0x21c1724
         /* 021C1724 */ cpu->r[10] = cpu->r[25] + 0xFFFFFFFFu;
         /* 021C1728 */ cpu->r[0] = cpu->r[25] + 0xFFFFFFFEu;
         /* 021C172C */ cpu->f[29] = cpu->f[30];
-        /* 021C1730 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], cpu->r[10]);
+        /* 021C1730 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], cpu->r[10]));
         /* 021C1734 */ cpu->r[12] = cpu->r[0] - cpu->r[20];
         /* 021C1738 */ cpu->r[30] = cpu->r[20];
         /* 021C173C */ cpu->r[29] = 0xFFFFFFFFu;
         /* 021C1740 */ cpu->r[27] = cpu->r[12] + 0x00000001u;
-        /* 021C1744 */ _t280 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C1744 */ _t280 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C1744 */ _t281 = _t280 & 0x00000001u;
         /* 021C1744 */ if (_t281) goto L_021C1748; else goto L_021C1A3C;
   L_021C1748: ; // 0x21c1748
@@ -6118,13 +6118,13 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C1794 */ _t293 = cpu->r[1] + 0x000000F4u;
         /* 021C1794 */ rbrew_write32(cpu->mem, _t293, cpu->r[0]);
         /* 021C1798 */ Gambit_fn_02819764(cpu);
-        /* 021C179C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[29]);
-        /* 021C17A0 */ _t294 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C179C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[29]));
+        /* 021C17A0 */ _t294 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C17A0 */ _t295 = _t294 & 0x00000001u;
         /* 021C17A0 */ if (_t295) goto L_021C17AC; else goto L_021C17A4;
   L_021C17A4: ; // 0x21c17a4
-        /* 021C17A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021C17A8 */ _t296 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C17A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021C17A8 */ _t296 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C17A8 */ _t297 = _t296 & 0x00000001u;
         /* 021C17A8 */ if (_t297) goto L_021C17AC; else goto L_021C17B8;
   L_021C17AC: ; // 0x21c17ac
@@ -6134,26 +6134,26 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C17B4 */ cpu->r[29] = cpu->r[30];
   L_021C17B8: ; // 0x21c17b8
         /* 021C17B8 */ cpu->r[27] = cpu->r[27] + 0xFFFFFFFFu;
-        /* 021C17B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 021C17B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 021C17BC */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 021C17C0 */ _t299 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C17C0 */ _t299 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C17C0 */ _t300 = _t299 & 0x00000001u;
         /* 021C17C0 */ if (_t300) goto L_021C17C4; else goto L_021C1758;
   L_021C17C4: ; // 0x21c17c4
-        /* 021C17C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021C17C8 */ _t301 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C17C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021C17C8 */ _t301 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C17C8 */ _t302 = _t301 & 0x00000001u;
         /* 021C17C8 */ if (_t302) goto L_021C1A3C; else goto L_021C17CC;
   L_021C17CC: ; // 0x21c17cc
-        /* 021C17CC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[30]);
+        /* 021C17CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[30]));
         /* 021C17D0 */ cpu->r[0] = cpu->r[29] + 0x00000001u;
-        /* 021C17D4 */ _t303 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C17D4 */ _t303 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C17D4 */ _t304 = _t303 & 0x00000001u;
         /* 021C17D4 */ if (_t304) goto L_021C17D8; else goto L_021C1810;
   L_021C17D8: ; // 0x21c17d8
-        /* 021C17D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021C17D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021C17DC */ cpu->r[25] = cpu->r[0];
-        /* 021C17E0 */ _t305 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C17E0 */ _t305 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C17E0 */ _t306 = _t305 & 0x00000001u;
         /* 021C17E0 */ if (_t306) goto L_021C1A3C; else goto L_021C17E4;
   L_021C17E4: ; // 0x21c17e4
@@ -6169,17 +6169,17 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C17F8 */ rbrew_write_f32(cpu->mem, _t310, cpu->f[9]);
         /* 021C17FC */ _t311 = cpu->r[31] + 0x00000004u;
         /* 021C17FC */ rbrew_write_f32(cpu->mem, _t311, cpu->f[10]);
-        /* 021C1800 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 021C1800 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 021C1804 */ _t312 = cpu->r[31] + 0x00000008u;
         /* 021C1804 */ rbrew_write_f32(cpu->mem, _t312, cpu->f[11]);
-        /* 021C1808 */ _t313 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C1808 */ _t313 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C1808 */ _t314 = _t313 & 0x00000001u;
         /* 021C1808 */ if (_t314) goto L_021C180C; else goto L_021C1A80;
   L_021C180C: ; // 0x21c180c
         /* 021C180C */ goto L_021C1A44;
   L_021C1810: ; // 0x21c1810
-        /* 021C1810 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[25]);
-        /* 021C1814 */ _t315 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C1810 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[25]));
+        /* 021C1814 */ _t315 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C1814 */ _t316 = _t315 & 0x00000001u;
         /* 021C1814 */ if (_t316) goto L_021C1890; else goto L_021C1818;
   L_021C1818: ; // 0x21c1818
@@ -6195,7 +6195,7 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C1834 */ /* nop */
         /* 021C1838 */ cpu->f[10] = fma(cpu->f[8], cpu->f[31], cpu->f[6]);
         /* 021C183C */ /* nop */
-        /* 021C1840 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021C1840 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021C1844 */ /* nop */
         /* 021C1848 */ _t319 = cpu->r[1] + 0x000000DCu;
         /* 021C1848 */ rbrew_write_f32(cpu->mem, _t319, cpu->f[10]);
@@ -6203,7 +6203,7 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C1850 */ /* nop */
         /* 021C1854 */ _t320 = cpu->r[1] + 0x000000D4u;
         /* 021C1854 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t320);
-        /* 021C1858 */ _t321 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1858 */ _t321 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1858 */ _t322 = _t321 & 0x00000001u;
         /* 021C1858 */ if (_t322) goto L_021C1874; else goto L_021C185C;
   L_021C185C: ; // 0x21c185c
@@ -6227,17 +6227,17 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C187C */ _t331 = cpu->r[6] + 0x00000008u;
         /* 021C187C */ rbrew_write_f32(cpu->mem, _t331, cpu->f[10]);
         /* 021C1880 */ cpu->r[25] = cpu->r[29] + 0x00000002u;
-        /* 021C1880 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 021C1880 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 021C1884 */ _t332 = cpu->r[6] + 0x00000004u;
         /* 021C1884 */ rbrew_write_f32(cpu->mem, _t332, cpu->f[7]);
-        /* 021C1888 */ _t333 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C1888 */ _t333 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C1888 */ _t334 = _t333 & 0x00000001u;
         /* 021C1888 */ if (_t334) goto L_021C188C; else goto L_021C1A80;
   L_021C188C: ; // 0x21c188c
         /* 021C188C */ goto L_021C1A44;
   L_021C1890: ; // 0x21c1890
-        /* 021C1890 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021C1894 */ _t335 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1890 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021C1894 */ _t335 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1894 */ _t336 = _t335 & 0x00000001u;
         /* 021C1894 */ if (_t336) goto L_021C1A3C; else goto L_021C1898;
   L_021C1898: ; // 0x21c1898
@@ -6254,10 +6254,10 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C18AC */ rbrew_write_f32(cpu->mem, _t340, cpu->f[9]);
         /* 021C18B0 */ _t341 = cpu->r[7] + 0x00000008u;
         /* 021C18B0 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t341);
-        /* 021C18B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 021C18B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 021C18B8 */ _t342 = cpu->r[31] + 0x00000008u;
         /* 021C18B8 */ rbrew_write_f32(cpu->mem, _t342, cpu->f[10]);
-        /* 021C18BC */ _t343 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C18BC */ _t343 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C18BC */ _t344 = _t343 & 0x00000001u;
         /* 021C18BC */ if (_t344) goto L_021C18C0; else goto L_021C1A80;
   L_021C18C0: ; // 0x21c18c0
@@ -6279,15 +6279,15 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C18E0 */ _t351 = cpu->r[1] + 0x00000028u;
         /* 021C18E0 */ rbrew_write_f32(cpu->mem, _t351, cpu->f[11]);
   L_021C18E4: ; // 0x21c18e4
-        /* 021C18E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[18], 0x00000000u);
-        /* 021C18E8 */ _t352 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C18E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[18], 0x00000000u));
+        /* 021C18E8 */ _t352 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C18E8 */ _t353 = _t352 & 0x00000001u;
         /* 021C18E8 */ if (_t353) goto L_021C18EC; else goto L_021C1904;
   L_021C18EC: ; // 0x21c18ec
         /* 021C18EC */ _t354 = cpu->r[28] + 0x00000010u;
         /* 021C18EC */ cpu->r[9] = rbrew_read32(cpu->mem, _t354);
-        /* 021C18F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], cpu->r[9]);
-        /* 021C18F4 */ _t355 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C18F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], cpu->r[9]));
+        /* 021C18F4 */ _t355 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C18F4 */ _t356 = _t355 & 0x00000001u;
         /* 021C18F4 */ if (_t356) goto L_021C18F8; else goto L_021C1904;
   L_021C18F8: ; // 0x21c18f8
@@ -6297,13 +6297,13 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C1900 */ rbrew_write8(cpu->mem, _t357, (uint8_t)cpu->r[0]);
   L_021C1904: ; // 0x21c1904
         /* 021C1904 */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 021C1908 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[17]);
-        /* 021C190C */ _t358 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C1908 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[17]));
+        /* 021C190C */ _t358 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C190C */ _t359 = _t358 & 0x00000001u;
         /* 021C190C */ if (_t359) goto L_021C15D4; else goto L_021C1910;
   L_021C1910: ; // 0x21c1910
-        /* 021C1910 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[18], 0x00000000u);
-        /* 021C1914 */ _t360 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[18], 0x00000000u));
+        /* 021C1914 */ _t360 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1914 */ _t361 = _t360 & 0x00000001u;
         /* 021C1914 */ if (_t361) goto L_021C1918; else goto L_021C1A3C;
   L_021C1918: ; // 0x21c1918
@@ -6311,8 +6311,8 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C1918 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t362);
         /* 021C191C */ _t363 = cpu->r[1] + 0x0000001Cu;
         /* 021C191C */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t363);
-        /* 021C1920 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[6]);
-        /* 021C1924 */ _t364 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1920 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[6]));
+        /* 021C1924 */ _t364 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1924 */ _t365 = _t364 & 0x00000001u;
         /* 021C1924 */ if (_t365) goto L_021C1928; else goto L_021C1938;
   L_021C1928: ; // 0x21c1928
@@ -6320,8 +6320,8 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C1928 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t366);
         /* 021C192C */ _t367 = cpu->r[1] + 0x00000020u;
         /* 021C192C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t367);
-        /* 021C1930 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[10]);
-        /* 021C1934 */ _t368 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1930 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[10]));
+        /* 021C1934 */ _t368 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1934 */ _t369 = _t368 & 0x00000001u;
         /* 021C1934 */ if (_t369) goto L_021C1978; else goto L_021C1938;
   L_021C1938: ; // 0x21c1938
@@ -6341,10 +6341,10 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C195C */ cpu->f[12] = cpu->f[13] - cpu->f[11];
         /* 021C1960 */ cpu->f[11] = fma(cpu->f[9], cpu->f[9], cpu->f[10]);
         /* 021C1964 */ cpu->f[1] = fma(cpu->f[12], cpu->f[12], cpu->f[11]);
-        /* 021C1968 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 021C1968 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 021C196C */ _t374 = cpu->r[1] + 0x000000B8u;
         /* 021C196C */ rbrew_write_f32(cpu->mem, _t374, cpu->f[12]);
-        /* 021C1970 */ _t375 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C1970 */ _t375 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C1970 */ _t376 = _t375 & 0x00000001u;
         /* 021C1970 */ if (_t376) goto L_021C1974; else goto L_021C19EC;
   L_021C1974: ; // 0x21c1974
@@ -6354,8 +6354,8 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C1978 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t377);
         /* 021C197C */ _t378 = cpu->r[1] + 0x00000024u;
         /* 021C197C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t378);
-        /* 021C1980 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[13]);
-        /* 021C1984 */ _t379 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1980 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[13]));
+        /* 021C1984 */ _t379 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1984 */ _t380 = _t379 & 0x00000001u;
         /* 021C1984 */ if (_t380) goto L_021C1A34; else goto L_021C1988;
   L_021C1988: ; // 0x21c1988
@@ -6371,10 +6371,10 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C19A4 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t382);
         /* 021C19A8 */ cpu->f[11] = fma(cpu->f[9], cpu->f[9], cpu->f[10]);
         /* 021C19AC */ cpu->f[1] = fma(cpu->f[12], cpu->f[12], cpu->f[11]);
-        /* 021C19B0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 021C19B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 021C19B4 */ _t383 = cpu->r[1] + 0x000000B8u;
         /* 021C19B4 */ rbrew_write_f32(cpu->mem, _t383, cpu->f[12]);
-        /* 021C19B8 */ _t384 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C19B8 */ _t384 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C19B8 */ _t385 = _t384 & 0x00000001u;
         /* 021C19B8 */ if (_t385) goto L_021C19BC; else goto L_021C19EC;
   L_021C19BC: ; // 0x21c19bc
@@ -6416,8 +6416,8 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C1A24 */ _t394 = cpu->r[1] + 0x00000010u;
         /* 021C1A24 */ rbrew_write32(cpu->mem, _t394, cpu->r[0]);
         /* 021C1A28 */ Gambit_fn_021F4570(cpu);
-        /* 021C1A2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C1A30 */ _t395 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1A2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C1A30 */ _t395 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1A30 */ _t396 = _t395 & 0x00000001u;
         /* 021C1A30 */ if (_t396) goto L_021C1A34; else goto L_021C1A3C;
   L_021C1A34: ; // 0x21c1a34
@@ -6425,8 +6425,8 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C1A38 */ _t397 = cpu->r[1] + 0x00000018u;
         /* 021C1A38 */ rbrew_write8(cpu->mem, _t397, (uint8_t)cpu->r[5]);
   L_021C1A3C: ; // 0x21c1a3c
-        /* 021C1A3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 021C1A40 */ _t398 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C1A3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 021C1A40 */ _t398 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C1A40 */ _t399 = _t398 & 0x00000001u;
         /* 021C1A40 */ if (_t399) goto L_021C1A44; else goto L_021C1A80;
   L_021C1A44: ; // 0x21c1a44
@@ -6488,7 +6488,7 @@ void Gambit_fn_021C0F24(CPUState* cpu) {
         /* 021C1AC8 */ cpu->f[23] = rbrew_read_f64(cpu->mem, _t420);
         /* 021C1ACC */ _t421 = cpu->r[1] + 0x000008A0u;
         /* 021C1ACC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t421);
-        /* 021C1AD0 */ _t422 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C1AD0 */ _t422 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C1AD0 */ _t423 = _t422 & 0x00000001u;
         /* 021C1AD0 */ if (_t423) goto L_021C1AD4; // else: addr-0 trap, fall-through
   L_021C1AD4: ; // 0x21c1ad4
@@ -6945,32 +6945,32 @@ void Gambit_fn_021C1CB0(CPUState* cpu) {
         /* 021C1CB8 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021C1CB8 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021C1CBC */ cpu->r[31] = cpu->r[3];
-        /* 021C1CC0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x0000000Bu);
+        /* 021C1CC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x0000000Bu));
         /* 021C1CC4 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021C1CC4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021C1CC8 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C1CC8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C1CC8 */ _t4 = _t3 & 0x00000001u;
         /* 021C1CC8 */ if (_t4) goto L_021C1CCC; else goto L_021C1D0C;
   L_021C1CCC: ; // 0x21c1ccc
-        /* 021C1CCC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000001u);
-        /* 021C1CD0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1CCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000001u));
+        /* 021C1CD0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1CD0 */ _t6 = _t5 & 0x00000001u;
         /* 021C1CD0 */ if (_t6) goto L_021C1D64; else goto L_021C1CD4;
   L_021C1CD4: ; // 0x21c1cd4
-        /* 021C1CD4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000006u);
-        /* 021C1CD8 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1CD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000006u));
+        /* 021C1CD8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1CD8 */ _t8 = _t7 & 0x00000001u;
         /* 021C1CD8 */ if (_t8) goto L_021C1D64; else goto L_021C1CDC;
   L_021C1CDC: ; // 0x21c1cdc
-        /* 021C1CDC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000009u);
-        /* 021C1CE0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1CDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000009u));
+        /* 021C1CE0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1CE0 */ _t10 = _t9 & 0x00000001u;
         /* 021C1CE0 */ if (_t10) goto L_021C1D64; else goto L_021C1CE4;
   L_021C1CE4: ; // 0x21c1ce4
         /* 021C1CE4 */ cpu->r[3] = cpu->r[4];
         /* 021C1CE8 */ Gambit_fn_021BCF9C(cpu);
-        /* 021C1CEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C1CF0 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1CEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C1CF0 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1CF0 */ _t12 = _t11 & 0x00000001u;
         /* 021C1CF0 */ if (_t12) goto L_021C1CF4; else goto L_021C1D64;
   L_021C1CF4: ; // 0x21c1cf4
@@ -6983,24 +6983,24 @@ void Gambit_fn_021C1CB0(CPUState* cpu) {
         /* 021C1D04 */ cpu->r[3] = 0x00000000u;
         /* 021C1D08 */ return;
   L_021C1D0C: ; // 0x21c1d0c
-        /* 021C1D0C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x0000000Bu);
-        /* 021C1D10 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1D0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x0000000Bu));
+        /* 021C1D10 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1D10 */ _t16 = _t15 & 0x00000001u;
         /* 021C1D10 */ if (_t16) goto L_021C1D34; else goto L_021C1D14;
   L_021C1D14: ; // 0x21c1d14
-        /* 021C1D14 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x0000000Eu);
-        /* 021C1D18 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C1D14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x0000000Eu));
+        /* 021C1D18 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C1D18 */ _t18 = _t17 & 0x00000001u;
         /* 021C1D18 */ if (_t18) goto L_021C1D64; else goto L_021C1D1C;
   L_021C1D1C: ; // 0x21c1d1c
-        /* 021C1D1C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1D1C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1D1C */ _t20 = _t19 & 0x00000001u;
         /* 021C1D1C */ if (_t20) goto L_021C1DC8; else goto L_021C1D20;
   L_021C1D20: ; // 0x21c1d20
         /* 021C1D20 */ cpu->r[3] = cpu->r[4];
         /* 021C1D24 */ Gambit_fn_021BCF9C(cpu);
-        /* 021C1D28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C1D2C */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1D28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C1D2C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1D2C */ _t22 = _t21 & 0x00000001u;
         /* 021C1D2C */ if (_t22) goto L_021C1CF4; else goto L_021C1D30;
   L_021C1D30: ; // 0x21c1d30
@@ -7010,8 +7010,8 @@ void Gambit_fn_021C1CB0(CPUState* cpu) {
         /* 021C1D34 */ cpu->r[11] = rbrew_read32(cpu->mem, _t23);
         /* 021C1D38 */ _t24 = cpu->r[5] + 0x00000000u;
         /* 021C1D38 */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
-        /* 021C1D3C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[11]);
-        /* 021C1D40 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1D3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[11]));
+        /* 021C1D40 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1D40 */ _t26 = _t25 & 0x00000001u;
         /* 021C1D40 */ if (_t26) goto L_021C1CF4; else goto L_021C1D44;
   L_021C1D44: ; // 0x21c1d44
@@ -7028,13 +7028,13 @@ void Gambit_fn_021C1CB0(CPUState* cpu) {
   L_021C1D64: ; // 0x21c1d64
         /* 021C1D64 */ _t29 = cpu->r[31] + 0x0000001Cu;
         /* 021C1D64 */ cpu->r[0] = rbrew_read32(cpu->mem, _t29);
-        /* 021C1D68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021C1D6C */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1D68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021C1D6C */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1D6C */ _t31 = _t30 & 0x00000001u;
         /* 021C1D6C */ if (_t31) goto L_021C1D78; else goto L_021C1D70;
   L_021C1D70: ; // 0x21c1d70
-        /* 021C1D70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021C1D74 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1D70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021C1D74 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1D74 */ _t33 = _t32 & 0x00000001u;
         /* 021C1D74 */ if (_t33) goto L_021C1D78; else goto L_021C1DEC;
   L_021C1D78: ; // 0x21c1d78
@@ -7045,8 +7045,8 @@ void Gambit_fn_021C1CB0(CPUState* cpu) {
         /* 021C1D80 */ cpu->ctr = cpu->r[0];
         /* 021C1D84 */ cpu->r[3] = cpu->r[31];
         /* 021C1D88 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021C1D8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C1D90 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1D8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C1D90 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1D90 */ _t37 = _t36 & 0x00000001u;
         /* 021C1D90 */ if (_t37) goto L_021C1D94; else goto L_021C1DEC;
   L_021C1D94: ; // 0x21c1d94
@@ -7072,8 +7072,8 @@ void Gambit_fn_021C1CB0(CPUState* cpu) {
         /* 021C1DC8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t42);
         /* 021C1DCC */ _t43 = cpu->r[5] + 0x00000000u;
         /* 021C1DCC */ cpu->r[10] = rbrew_read32(cpu->mem, _t43);
-        /* 021C1DD0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[11]);
-        /* 021C1DD4 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1DD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[11]));
+        /* 021C1DD4 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1DD4 */ _t45 = _t44 & 0x00000001u;
         /* 021C1DD4 */ if (_t45) goto L_021C1DEC; else goto L_021C1DD8;
   L_021C1DD8: ; // 0x21c1dd8
@@ -7106,32 +7106,32 @@ void Gambit_fn_021C1CB4(CPUState* cpu) {
         /* 021C1CB8 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021C1CB8 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021C1CBC */ cpu->r[31] = cpu->r[3];
-        /* 021C1CC0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x0000000Bu);
+        /* 021C1CC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x0000000Bu));
         /* 021C1CC4 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021C1CC4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021C1CC8 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C1CC8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C1CC8 */ _t4 = _t3 & 0x00000001u;
         /* 021C1CC8 */ if (_t4) goto L_021C1CCC; else goto L_021C1D0C;
   L_021C1CCC: ; // 0x21c1ccc
-        /* 021C1CCC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000001u);
-        /* 021C1CD0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1CCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000001u));
+        /* 021C1CD0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1CD0 */ _t6 = _t5 & 0x00000001u;
         /* 021C1CD0 */ if (_t6) goto L_021C1D64; else goto L_021C1CD4;
   L_021C1CD4: ; // 0x21c1cd4
-        /* 021C1CD4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000006u);
-        /* 021C1CD8 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1CD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000006u));
+        /* 021C1CD8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1CD8 */ _t8 = _t7 & 0x00000001u;
         /* 021C1CD8 */ if (_t8) goto L_021C1D64; else goto L_021C1CDC;
   L_021C1CDC: ; // 0x21c1cdc
-        /* 021C1CDC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000009u);
-        /* 021C1CE0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1CDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000009u));
+        /* 021C1CE0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1CE0 */ _t10 = _t9 & 0x00000001u;
         /* 021C1CE0 */ if (_t10) goto L_021C1D64; else goto L_021C1CE4;
   L_021C1CE4: ; // 0x21c1ce4
         /* 021C1CE4 */ cpu->r[3] = cpu->r[4];
         /* 021C1CE8 */ Gambit_fn_021BCF9C(cpu);
-        /* 021C1CEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C1CF0 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1CEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C1CF0 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1CF0 */ _t12 = _t11 & 0x00000001u;
         /* 021C1CF0 */ if (_t12) goto L_021C1CF4; else goto L_021C1D64;
   L_021C1CF4: ; // 0x21c1cf4
@@ -7144,24 +7144,24 @@ void Gambit_fn_021C1CB4(CPUState* cpu) {
         /* 021C1D04 */ cpu->r[3] = 0x00000000u;
         /* 021C1D08 */ return;
   L_021C1D0C: ; // 0x21c1d0c
-        /* 021C1D0C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x0000000Bu);
-        /* 021C1D10 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1D0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x0000000Bu));
+        /* 021C1D10 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1D10 */ _t16 = _t15 & 0x00000001u;
         /* 021C1D10 */ if (_t16) goto L_021C1D34; else goto L_021C1D14;
   L_021C1D14: ; // 0x21c1d14
-        /* 021C1D14 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x0000000Eu);
-        /* 021C1D18 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C1D14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x0000000Eu));
+        /* 021C1D18 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C1D18 */ _t18 = _t17 & 0x00000001u;
         /* 021C1D18 */ if (_t18) goto L_021C1D64; else goto L_021C1D1C;
   L_021C1D1C: ; // 0x21c1d1c
-        /* 021C1D1C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1D1C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1D1C */ _t20 = _t19 & 0x00000001u;
         /* 021C1D1C */ if (_t20) goto L_021C1DC8; else goto L_021C1D20;
   L_021C1D20: ; // 0x21c1d20
         /* 021C1D20 */ cpu->r[3] = cpu->r[4];
         /* 021C1D24 */ Gambit_fn_021BCF9C(cpu);
-        /* 021C1D28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C1D2C */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1D28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C1D2C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1D2C */ _t22 = _t21 & 0x00000001u;
         /* 021C1D2C */ if (_t22) goto L_021C1CF4; else goto L_021C1D30;
   L_021C1D30: ; // 0x21c1d30
@@ -7171,8 +7171,8 @@ void Gambit_fn_021C1CB4(CPUState* cpu) {
         /* 021C1D34 */ cpu->r[11] = rbrew_read32(cpu->mem, _t23);
         /* 021C1D38 */ _t24 = cpu->r[5] + 0x00000000u;
         /* 021C1D38 */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
-        /* 021C1D3C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[11]);
-        /* 021C1D40 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1D3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[11]));
+        /* 021C1D40 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1D40 */ _t26 = _t25 & 0x00000001u;
         /* 021C1D40 */ if (_t26) goto L_021C1CF4; else goto L_021C1D44;
   L_021C1D44: ; // 0x21c1d44
@@ -7189,13 +7189,13 @@ void Gambit_fn_021C1CB4(CPUState* cpu) {
   L_021C1D64: ; // 0x21c1d64
         /* 021C1D64 */ _t29 = cpu->r[31] + 0x0000001Cu;
         /* 021C1D64 */ cpu->r[0] = rbrew_read32(cpu->mem, _t29);
-        /* 021C1D68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021C1D6C */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1D68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021C1D6C */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1D6C */ _t31 = _t30 & 0x00000001u;
         /* 021C1D6C */ if (_t31) goto L_021C1D78; else goto L_021C1D70;
   L_021C1D70: ; // 0x21c1d70
-        /* 021C1D70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021C1D74 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1D70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021C1D74 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1D74 */ _t33 = _t32 & 0x00000001u;
         /* 021C1D74 */ if (_t33) goto L_021C1D78; else goto L_021C1DEC;
   L_021C1D78: ; // 0x21c1d78
@@ -7206,8 +7206,8 @@ void Gambit_fn_021C1CB4(CPUState* cpu) {
         /* 021C1D80 */ cpu->ctr = cpu->r[0];
         /* 021C1D84 */ cpu->r[3] = cpu->r[31];
         /* 021C1D88 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021C1D8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C1D90 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1D8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C1D90 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1D90 */ _t37 = _t36 & 0x00000001u;
         /* 021C1D90 */ if (_t37) goto L_021C1D94; else goto L_021C1DEC;
   L_021C1D94: ; // 0x21c1d94
@@ -7233,8 +7233,8 @@ void Gambit_fn_021C1CB4(CPUState* cpu) {
         /* 021C1DC8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t42);
         /* 021C1DCC */ _t43 = cpu->r[5] + 0x00000000u;
         /* 021C1DCC */ cpu->r[10] = rbrew_read32(cpu->mem, _t43);
-        /* 021C1DD0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[11]);
-        /* 021C1DD4 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1DD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[11]));
+        /* 021C1DD4 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1DD4 */ _t45 = _t44 & 0x00000001u;
         /* 021C1DD4 */ if (_t45) goto L_021C1DEC; else goto L_021C1DD8;
   L_021C1DD8: ; // 0x21c1dd8
@@ -7284,9 +7284,9 @@ void Gambit_fn_021C1E04(CPUState* cpu) {
         /* 021C1E3C */ _t5 = cpu->r[5] + 0x00000104u;
         /* 021C1E3C */ cpu->r[4] = rbrew_read8(cpu->mem, _t5);
         /* 021C1E40 */ cpu->r[28] = cpu->r[6];
-        /* 021C1E44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 021C1E44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 021C1E48 */ cpu->r[31] = cpu->r[8];
-        /* 021C1E4C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1E4C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1E4C */ _t7 = _t6 & 0x00000001u;
         /* 021C1E4C */ if (_t7) goto L_021C2080; else goto L_021C1E50;
   L_021C1E50: ; // 0x21c1e50
@@ -7296,8 +7296,8 @@ void Gambit_fn_021C1E04(CPUState* cpu) {
         /* 021C1E5C */ cpu->r[5] = cpu->r[31];
         /* 021C1E60 */ Gambit_fn_021F000C(cpu);
         /* 021C1E64 */ cpu->r[25] = cpu->r[3];
-        /* 021C1E64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 021C1E68 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1E64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 021C1E68 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1E68 */ _t9 = _t8 & 0x00000001u;
         /* 021C1E68 */ if (_t9) goto L_021C2080; else goto L_021C1E6C;
   L_021C1E6C: ; // 0x21c1e6c
@@ -7408,10 +7408,10 @@ void Gambit_fn_021C1E04(CPUState* cpu) {
         /* 021C1F84 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021C1F88 */ _t44 = cpu->r[29] + 0x00000004u;
         /* 021C1F88 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t44);
-        /* 021C1F8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021C1F8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021C1F90 */ _t45 = cpu->r[30] + 0x00000004u;
         /* 021C1F90 */ cpu->r[12] = rbrew_read32(cpu->mem, _t45);
-        /* 021C1F94 */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C1F94 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C1F94 */ _t47 = _t46 & 0x00000001u;
         /* 021C1F94 */ if (_t47) goto L_021C1FA0; else goto L_021C1F98;
   L_021C1F98: ; // 0x21c1f98
@@ -7469,10 +7469,10 @@ void Gambit_fn_021C1E04(CPUState* cpu) {
         /* 021C201C */ cpu->r[3] = cpu->r[25];
         /* 021C2020 */ _t65 = cpu->r[1] + 0x0000009Cu;
         /* 021C2020 */ rbrew_write_f32(cpu->mem, _t65, cpu->f[1]);
-        /* 021C2024 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021C2024 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021C2028 */ cpu->r[7] = cpu->r[26];
         /* 021C202C */ cpu->r[6] = cpu->r[28];
-        /* 021C2030 */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C2030 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C2030 */ _t67 = _t66 & 0x00000001u;
         /* 021C2030 */ if (_t67) goto L_021C205C; else goto L_021C2034;
   L_021C2034: ; // 0x21c2034
@@ -7827,8 +7827,8 @@ void Gambit_fn_021C224C(CPUState* cpu) {
         /* 021C238C */ cpu->r[11] = 0x10030000u;
         /* 021C2390 */ _t42 = cpu->r[11] + 0xFFFFB6D4u;
         /* 021C2390 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t42);
-        /* 021C2394 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
-        /* 021C2398 */ _t43 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C2394 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
+        /* 021C2398 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C2398 */ _t44 = _t43 & 0x00000001u;
         /* 021C2398 */ if (_t44) goto L_021C239C; else goto L_021C23A0;
   L_021C239C: ; // 0x21c239c
@@ -7984,8 +7984,8 @@ void Gambit_fn_021C2250(CPUState* cpu) {
         /* 021C238C */ cpu->r[11] = 0x10030000u;
         /* 021C2390 */ _t42 = cpu->r[11] + 0xFFFFB6D4u;
         /* 021C2390 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t42);
-        /* 021C2394 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
-        /* 021C2398 */ _t43 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C2394 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
+        /* 021C2398 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C2398 */ _t44 = _t43 & 0x00000001u;
         /* 021C2398 */ if (_t44) goto L_021C239C; else goto L_021C23A0;
   L_021C239C: ; // 0x21c239c
@@ -8041,16 +8041,16 @@ void Gambit_fn_021C23D8(CPUState* cpu) {
         /* 021C240C */ cpu->r[10] = 0x10030000u;
         /* 021C2410 */ _t8 = cpu->r[10] + 0xFFFFB6D8u;
         /* 021C2410 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t8);
-        /* 021C2414 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[1]);
-        /* 021C2418 */ _t9 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C2414 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[1]));
+        /* 021C2418 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C2418 */ _t10 = _t9 & 0x00000001u;
         /* 021C2418 */ if (_t10) goto L_021C2454; else goto L_021C241C;
   L_021C241C: ; // 0x21c241c
         /* 021C241C */ cpu->r[8] = 0x10030000u;
         /* 021C2420 */ _t11 = cpu->r[8] + 0xFFFFB5FCu;
         /* 021C2420 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t11);
-        /* 021C2424 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[12]);
-        /* 021C2428 */ _t12 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C2424 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[12]));
+        /* 021C2428 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C2428 */ _t13 = _t12 & 0x00000001u;
         /* 021C2428 */ if (_t13) goto L_021C2454; else goto L_021C242C;
   L_021C242C: ; // 0x21c242c
@@ -8065,7 +8065,7 @@ void Gambit_fn_021C23D8(CPUState* cpu) {
         /* 021C243C */ _t18 = cpu->r[30] + 0x00000000u;
         /* 021C243C */ rbrew_write16(cpu->mem, _t18, (uint16_t)cpu->r[31]);
         /* 021C2440 */ cpu->r[9] = cpu->r[8] & 0x0000FEFFu;
-        /* 021C2440 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021C2440 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021C2444 */ cpu->r[11] = 0x00000000u;
         /* 021C2448 */ _t19 = cpu->r[30] + 0x00000002u;
         /* 021C2448 */ rbrew_write16(cpu->mem, _t19, (uint16_t)cpu->r[9]);
@@ -8095,16 +8095,16 @@ void Gambit_fn_021C23D8(CPUState* cpu) {
         /* 021C2488 */ cpu->f[12] = rbrew_read_f64(cpu->mem, _t26);
         /* 021C248C */ cpu->f[0] = cpu->f[12] - cpu->f[11];
         /* 021C2490 */ cpu->f[9] = (double)(float)cpu->f[0];
-        /* 021C2494 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[13]);
-        /* 021C2498 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C2494 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[13]));
+        /* 021C2498 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C2498 */ _t28 = _t27 & 0x00000001u;
         /* 021C2498 */ if (_t28) goto L_021C24B0; else goto L_021C249C;
   L_021C249C: ; // 0x21c249c
         /* 021C249C */ cpu->r[10] = 0x10030000u;
         /* 021C24A0 */ _t29 = cpu->r[10] + 0xFFFFB5F8u;
         /* 021C24A0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t29);
-        /* 021C24A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 021C24A8 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C24A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 021C24A8 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C24A8 */ _t31 = _t30 & 0x00000001u;
         /* 021C24A8 */ if (_t31) goto L_021C24B0; else goto L_021C24AC;
   L_021C24AC: ; // 0x21c24ac
@@ -8121,7 +8121,7 @@ void Gambit_fn_021C23D8(CPUState* cpu) {
         /* 021C24C0 */ _t36 = cpu->r[30] + 0x00000000u;
         /* 021C24C0 */ rbrew_write16(cpu->mem, _t36, (uint16_t)cpu->r[31]);
         /* 021C24C4 */ cpu->r[9] = cpu->r[8] & 0x0000FEFFu;
-        /* 021C24C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021C24C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021C24C8 */ cpu->r[11] = cpu->r[11] + 0xFFFFFFFFu;
         /* 021C24CC */ _t37 = cpu->r[30] + 0x00000002u;
         /* 021C24CC */ rbrew_write16(cpu->mem, _t37, (uint16_t)cpu->r[9]);
@@ -8168,16 +8168,16 @@ void Gambit_fn_021C23DC(CPUState* cpu) {
         /* 021C240C */ cpu->r[10] = 0x10030000u;
         /* 021C2410 */ _t8 = cpu->r[10] + 0xFFFFB6D8u;
         /* 021C2410 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t8);
-        /* 021C2414 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[1]);
-        /* 021C2418 */ _t9 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C2414 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[1]));
+        /* 021C2418 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C2418 */ _t10 = _t9 & 0x00000001u;
         /* 021C2418 */ if (_t10) goto L_021C2454; else goto L_021C241C;
   L_021C241C: ; // 0x21c241c
         /* 021C241C */ cpu->r[8] = 0x10030000u;
         /* 021C2420 */ _t11 = cpu->r[8] + 0xFFFFB5FCu;
         /* 021C2420 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t11);
-        /* 021C2424 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[12]);
-        /* 021C2428 */ _t12 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C2424 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[12]));
+        /* 021C2428 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C2428 */ _t13 = _t12 & 0x00000001u;
         /* 021C2428 */ if (_t13) goto L_021C2454; else goto L_021C242C;
   L_021C242C: ; // 0x21c242c
@@ -8192,7 +8192,7 @@ void Gambit_fn_021C23DC(CPUState* cpu) {
         /* 021C243C */ _t18 = cpu->r[30] + 0x00000000u;
         /* 021C243C */ rbrew_write16(cpu->mem, _t18, (uint16_t)cpu->r[31]);
         /* 021C2440 */ cpu->r[9] = cpu->r[8] & 0x0000FEFFu;
-        /* 021C2440 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021C2440 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021C2444 */ cpu->r[11] = 0x00000000u;
         /* 021C2448 */ _t19 = cpu->r[30] + 0x00000002u;
         /* 021C2448 */ rbrew_write16(cpu->mem, _t19, (uint16_t)cpu->r[9]);
@@ -8222,16 +8222,16 @@ void Gambit_fn_021C23DC(CPUState* cpu) {
         /* 021C2488 */ cpu->f[12] = rbrew_read_f64(cpu->mem, _t26);
         /* 021C248C */ cpu->f[0] = cpu->f[12] - cpu->f[11];
         /* 021C2490 */ cpu->f[9] = (double)(float)cpu->f[0];
-        /* 021C2494 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[13]);
-        /* 021C2498 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C2494 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[13]));
+        /* 021C2498 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C2498 */ _t28 = _t27 & 0x00000001u;
         /* 021C2498 */ if (_t28) goto L_021C24B0; else goto L_021C249C;
   L_021C249C: ; // 0x21c249c
         /* 021C249C */ cpu->r[10] = 0x10030000u;
         /* 021C24A0 */ _t29 = cpu->r[10] + 0xFFFFB5F8u;
         /* 021C24A0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t29);
-        /* 021C24A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 021C24A8 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C24A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 021C24A8 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C24A8 */ _t31 = _t30 & 0x00000001u;
         /* 021C24A8 */ if (_t31) goto L_021C24B0; else goto L_021C24AC;
   L_021C24AC: ; // 0x21c24ac
@@ -8248,7 +8248,7 @@ void Gambit_fn_021C23DC(CPUState* cpu) {
         /* 021C24C0 */ _t36 = cpu->r[30] + 0x00000000u;
         /* 021C24C0 */ rbrew_write16(cpu->mem, _t36, (uint16_t)cpu->r[31]);
         /* 021C24C4 */ cpu->r[9] = cpu->r[8] & 0x0000FEFFu;
-        /* 021C24C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021C24C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021C24C8 */ cpu->r[11] = cpu->r[11] + 0xFFFFFFFFu;
         /* 021C24CC */ _t37 = cpu->r[30] + 0x00000002u;
         /* 021C24CC */ rbrew_write16(cpu->mem, _t37, (uint16_t)cpu->r[9]);
@@ -8311,7 +8311,7 @@ void Gambit_fn_021C24EC(CPUState* cpu) {
         /* 021C2548 */ cpu->r[31] = rbrew_read32(cpu->mem, _t12);
         /* 021C254C */ _t13 = cpu->r[1] + 0x00000010u;
         /* 021C254C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t13);
-        /* 021C2550 */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C2550 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C2550 */ _t15 = _t14 & 0x00000001u;
         /* 021C2550 */ if (_t15) goto L_021C2554; // else: addr-0 trap, fall-through
   L_021C2554: ; // 0x21c2554
@@ -8366,7 +8366,7 @@ void Gambit_fn_021C24F0(CPUState* cpu) {
         /* 021C2548 */ cpu->r[31] = rbrew_read32(cpu->mem, _t12);
         /* 021C254C */ _t13 = cpu->r[1] + 0x00000010u;
         /* 021C254C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t13);
-        /* 021C2550 */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C2550 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C2550 */ _t15 = _t14 & 0x00000001u;
         /* 021C2550 */ if (_t15) goto L_021C2554; // else: addr-0 trap, fall-through
   L_021C2554: ; // 0x21c2554
@@ -8461,10 +8461,10 @@ void Gambit_fn_021C2564(CPUState* cpu) {
         /* 021C2638 */ cpu->f[13] = cpu->f[13] + cpu->f[0];
         /* 021C263C */ cpu->r[28] = cpu->r[28] + 0x0000000Cu;
         /* 021C2640 */ cpu->r[27] = cpu->r[27] + 0xFFFFFFFFu;
-        /* 021C2640 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 021C2640 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 021C2644 */ _t21 = cpu->r[10] + 0x00000008u;
         /* 021C2644 */ rbrew_write_f32(cpu->mem, _t21, cpu->f[13]);
-        /* 021C2648 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C2648 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C2648 */ _t23 = _t22 & 0x00000001u;
         /* 021C2648 */ if (_t23) goto L_021C264C; else goto L_021C258C;
   L_021C264C: ; // 0x21c264c
@@ -8654,15 +8654,15 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C280C */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t60);
         /* 021C2810 */ _t61 = cpu->r[1] + 0x00000010u;
         /* 021C2810 */ rbrew_write_f32(cpu->mem, _t61, cpu->f[6]);
-        /* 021C2814 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 021C2818 */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C2814 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 021C2818 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C2818 */ _t63 = _t62 & 0x00000001u;
         /* 021C2818 */ if (_t63) goto L_021C3428; else goto L_021C281C;
   L_021C281C: ; // 0x21c281c
         /* 021C281C */ goto L_021C28BC;
   L_021C2820: ; // 0x21c2820
-        /* 021C2820 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 021C2824 */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C2820 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 021C2824 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C2824 */ _t65 = _t64 & 0x00000001u;
         /* 021C2824 */ if (_t65) goto L_021C2828; else goto L_021C28A4;
   L_021C2828: ; // 0x21c2828
@@ -8709,10 +8709,10 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C288C */ cpu->r[23] = 0x00000000u;
         /* 021C2890 */ _t81 = cpu->r[1] + 0x00000028u;
         /* 021C2890 */ rbrew_write_f64(cpu->mem, _t81, cpu->f[8]);
-        /* 021C2894 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 021C2894 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 021C2898 */ _t82 = cpu->r[1] + 0x00000034u;
         /* 021C2898 */ rbrew_write_f32(cpu->mem, _t82, cpu->f[11]);
-        /* 021C289C */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C289C */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C289C */ _t84 = _t83 & 0x00000001u;
         /* 021C289C */ if (_t84) goto L_021C3428; else goto L_021C28A0;
   L_021C28A0: ; // 0x21c28a0
@@ -8723,22 +8723,22 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C28A8 */ cpu->r[4] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x00000018u, 0x0000001Bu);
         /* 021C28AC */ cpu->r[6] = cpu->r[4] + 0xFFFFFFFFu;
         /* 021C28B0 */ cpu->r[4] = cpu->r[4] - cpu->r[6];
-        /* 021C28B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 021C28B8 */ _t86 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C28B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 021C28B8 */ _t86 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C28B8 */ _t87 = _t86 & 0x00000001u;
         /* 021C28B8 */ if (_t87) goto L_021C3428; else goto L_021C28BC;
   L_021C28BC: ; // 0x21c28bc
-        /* 021C28BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 021C28BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 021C28C0 */ _t88 = cpu->r[28] + 0x00000000u;
         /* 021C28C0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t88);
-        /* 021C28C4 */ _t89 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C28C4 */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C28C4 */ _t90 = _t89 & 0x00000001u;
         /* 021C28C4 */ if (_t90) goto L_021C28C8; else goto L_021C2930;
   L_021C28C8: ; // 0x21c28c8
         /* 021C28C8 */ cpu->r[7] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C28C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021C28C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021C28CC */ cpu->r[22] = cpu->r[28] + 0x00000048u;
-        /* 021C28D0 */ _t91 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C28D0 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C28D0 */ _t92 = _t91 & 0x00000001u;
         /* 021C28D0 */ if (_t92) goto L_021C2998; else goto L_021C28D4;
   L_021C28D4: ; // 0x21c28d4
@@ -8747,10 +8747,10 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C28DC */ cpu->f[0] = cpu->f[1];
         /* 021C28E0 */ _t93 = cpu->r[1] + 0x00000010u;
         /* 021C28E0 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t93);
-        /* 021C28E4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[10]);
+        /* 021C28E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[10]));
         /* 021C28E8 */ _t94 = cpu->r[28] + 0x00000000u;
         /* 021C28E8 */ cpu->r[4] = rbrew_read32(cpu->mem, _t94);
-        /* 021C28EC */ _t95 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C28EC */ _t95 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C28EC */ _t96 = _t95 & 0x00000001u;
         /* 021C28EC */ if (_t96) goto L_021C28F0; else goto L_021C290C;
   L_021C28F0: ; // 0x21c28f0
@@ -8772,18 +8772,18 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C2918 */ rbrew_write32(cpu->mem, _t100, cpu->r[4]);
         /* 021C291C */ /* nop */
         /* 021C2920 */ cpu->r[0] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000004u, 0x00000004u);
-        /* 021C2920 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021C2920 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021C2924 */ /* nop */
-        /* 021C2928 */ _t101 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C2928 */ _t101 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C2928 */ _t102 = _t101 & 0x00000001u;
         /* 021C2928 */ if (_t102) goto L_021C29F8; else goto L_021C292C;
   L_021C292C: ; // 0x21c292c
         /* 021C292C */ goto L_021C29CC;
   L_021C2930: ; // 0x21c2930
         /* 021C2930 */ cpu->r[5] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021C2930 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021C2930 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021C2934 */ cpu->r[22] = cpu->r[28] + 0x000000A8u;
-        /* 021C2938 */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C2938 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C2938 */ _t104 = _t103 & 0x00000001u;
         /* 021C2938 */ if (_t104) goto L_021C29B4; else goto L_021C293C;
   L_021C293C: ; // 0x21c293c
@@ -8792,10 +8792,10 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C2944 */ cpu->f[6] = cpu->f[1];
         /* 021C2948 */ _t105 = cpu->r[1] + 0x00000010u;
         /* 021C2948 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t105);
-        /* 021C294C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[9]);
+        /* 021C294C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[9]));
         /* 021C2950 */ _t106 = cpu->r[28] + 0x00000000u;
         /* 021C2950 */ cpu->r[8] = rbrew_read32(cpu->mem, _t106);
-        /* 021C2954 */ _t107 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C2954 */ _t107 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C2954 */ _t108 = _t107 & 0x00000001u;
         /* 021C2954 */ if (_t108) goto L_021C2958; else goto L_021C2974;
   L_021C2958: ; // 0x21c2958
@@ -8817,9 +8817,9 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C2980 */ rbrew_write32(cpu->mem, _t112, cpu->r[8]);
         /* 021C2984 */ /* nop */
         /* 021C2988 */ cpu->r[0] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000004u, 0x00000004u);
-        /* 021C2988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021C2988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021C298C */ /* nop */
-        /* 021C2990 */ _t113 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C2990 */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C2990 */ _t114 = _t113 & 0x00000001u;
         /* 021C2990 */ if (_t114) goto L_021C29F8; else goto L_021C2994;
   L_021C2994: ; // 0x21c2994
@@ -8830,9 +8830,9 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C299C */ cpu->r[21] = cpu->r[28] + 0x00000060u;
         /* 021C29A0 */ /* nop */
         /* 021C29A4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000004u, 0x00000004u);
-        /* 021C29A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021C29A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021C29A8 */ /* nop */
-        /* 021C29AC */ _t116 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C29AC */ _t116 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C29AC */ _t117 = _t116 & 0x00000001u;
         /* 021C29AC */ if (_t117) goto L_021C29F8; else goto L_021C29B0;
   L_021C29B0: ; // 0x21c29b0
@@ -8843,9 +8843,9 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C29B8 */ cpu->r[21] = cpu->r[28] + 0x000000C0u;
         /* 021C29BC */ /* nop */
         /* 021C29C0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000004u, 0x00000004u);
-        /* 021C29C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021C29C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021C29C4 */ /* nop */
-        /* 021C29C8 */ _t119 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C29C8 */ _t119 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C29C8 */ _t120 = _t119 & 0x00000001u;
         /* 021C29C8 */ if (_t120) goto L_021C29F8; else goto L_021C29CC;
   L_021C29CC: ; // 0x21c29cc
@@ -8859,10 +8859,10 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C29E0 */ cpu->f[9] = cpu->f[8];
         /* 021C29E4 */ _t123 = cpu->r[1] + 0x00000028u;
         /* 021C29E4 */ cpu->f[8] = rbrew_read_f64(cpu->mem, _t123);
-        /* 021C29E8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[8]);
+        /* 021C29E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[8]));
         /* 021C29EC */ _t124 = cpu->r[28] + 0x00000044u;
         /* 021C29EC */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t124);
-        /* 021C29F0 */ _t125 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C29F0 */ _t125 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C29F0 */ _t126 = _t125 & 0x00000001u;
         /* 021C29F0 */ if (_t126) goto L_021C29F4; else goto L_021C2E34;
   L_021C29F4: ; // 0x21c29f4
@@ -8878,10 +8878,10 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C2A0C */ cpu->f[9] = cpu->f[8];
         /* 021C2A10 */ _t129 = cpu->r[1] + 0x00000028u;
         /* 021C2A10 */ cpu->f[8] = rbrew_read_f64(cpu->mem, _t129);
-        /* 021C2A14 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[8]);
+        /* 021C2A14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[8]));
         /* 021C2A18 */ _t130 = cpu->r[1] + 0x00000010u;
         /* 021C2A18 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t130);
-        /* 021C2A1C */ _t131 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C2A1C */ _t131 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C2A1C */ _t132 = _t131 & 0x00000001u;
         /* 021C2A1C */ if (_t132) goto L_021C2A20; else goto L_021C2E34;
   L_021C2A20: ; // 0x21c2a20
@@ -8900,11 +8900,11 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C2A3C */ cpu->f[13] = fma(cpu->f[12], cpu->f[12], cpu->f[11]);
         /* 021C2A40 */ _t138 = cpu->r[1] + 0x00000010u;
         /* 021C2A40 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t138);
-        /* 021C2A44 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[7]);
+        /* 021C2A44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[7]));
         /* 021C2A48 */ _t139 = cpu->r[1] + 0x0000006Cu;
         /* 021C2A48 */ rbrew_write_f32(cpu->mem, _t139, cpu->f[12]);
         /* 021C2A4C */ cpu->r[5] = cpu->r[1] + 0x00000064u;
-        /* 021C2A50 */ _t140 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C2A50 */ _t140 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C2A50 */ _t141 = _t140 & 0x00000001u;
         /* 021C2A50 */ if (_t141) goto L_021C2A54; else goto L_021C2A80;
   L_021C2A54: ; // 0x21c2a54
@@ -8960,9 +8960,9 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C2AD0 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t158);
         /* 021C2AD4 */ _t159 = cpu->r[1] + 0x00000024u;
         /* 021C2AD4 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t159);
-        /* 021C2AD8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[6]);
+        /* 021C2AD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[6]));
         /* 021C2ADC */ cpu->f[27] = cpu->f[28] - cpu->f[12];
-        /* 021C2AE0 */ _t160 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C2AE0 */ _t160 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C2AE0 */ _t161 = _t160 & 0x00000001u;
         /* 021C2AE0 */ if (_t161) goto L_021C2B2C; else goto L_021C2AE4;
   L_021C2AE4: ; // 0x21c2ae4
@@ -8984,10 +8984,10 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C2B14 */ cpu->f[11] = cpu->f[9] - cpu->f[0];
         /* 021C2B18 */ _t165 = cpu->r[1] + 0x00000010u;
         /* 021C2B18 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t165);
-        /* 021C2B1C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[10]);
+        /* 021C2B1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[10]));
         /* 021C2B20 */ _t166 = cpu->r[1] + 0x0000007Cu;
         /* 021C2B20 */ rbrew_write_f32(cpu->mem, _t166, cpu->f[8]);
-        /* 021C2B24 */ _t167 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C2B24 */ _t167 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C2B24 */ _t168 = _t167 & 0x00000001u;
         /* 021C2B24 */ if (_t168) goto L_021C2B28; else goto L_021C2E34;
   L_021C2B28: ; // 0x21c2b28
@@ -9026,19 +9026,19 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C2B88 */ cpu->f[11] = cpu->f[9] - cpu->f[0];
         /* 021C2B8C */ _t176 = cpu->r[1] + 0x00000010u;
         /* 021C2B8C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t176);
-        /* 021C2B90 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[10]);
+        /* 021C2B90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[10]));
         /* 021C2B94 */ _t177 = cpu->r[1] + 0x0000007Cu;
         /* 021C2B94 */ rbrew_write_f32(cpu->mem, _t177, cpu->f[8]);
-        /* 021C2B98 */ _t178 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C2B98 */ _t178 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C2B98 */ _t179 = _t178 & 0x00000001u;
         /* 021C2B98 */ if (_t179) goto L_021C2B9C; else goto L_021C2E34;
   L_021C2B9C: ; // 0x21c2b9c
         /* 021C2B9C */ cpu->r[3] = cpu->r[1] + 0x00000098u;
         /* 021C2BA0 */ Gambit_fn_02043B24(cpu);
-        /* 021C2BA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 021C2BA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 021C2BA8 */ cpu->r[12] = 0x00000000u;
         /* 021C2BAC */ cpu->f[7] = cpu->f[28] - cpu->f[27];
-        /* 021C2BB0 */ _t180 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C2BB0 */ _t180 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C2BB0 */ _t181 = _t180 & 0x00000001u;
         /* 021C2BB0 */ if (_t181) goto L_021C2BB8; else goto L_021C2BB4;
   L_021C2BB4: ; // 0x21c2bb4
@@ -9053,11 +9053,11 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C2BC4 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t184);
         /* 021C2BC8 */ _t185 = cpu->r[31] + 0x00000000u;
         /* 021C2BC8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t185);
-        /* 021C2BCC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[6]);
+        /* 021C2BCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[6]));
         /* 021C2BD0 */ _t186 = cpu->r[1] + 0x0000003Cu;
         /* 021C2BD0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t186);
         /* 021C2BD4 */ cpu->r[7] = cpu->r[12] | 0x00000001u;
-        /* 021C2BD8 */ _t187 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C2BD8 */ _t187 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C2BD8 */ _t188 = _t187 & 0x00000001u;
         /* 021C2BD8 */ if (_t188) goto L_021C2C18; else goto L_021C2BDC;
   L_021C2BDC: ; // 0x21c2bdc
@@ -9075,10 +9075,10 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C2C00 */ rbrew_write32(cpu->mem, _t190, cpu->r[12]);
         /* 021C2C04 */ Gambit_fn_0204A4DC(cpu);
         /* 021C2C08 */ cpu->r[8] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C2C08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021C2C08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021C2C0C */ _t191 = cpu->r[1] + 0x00000098u;
         /* 021C2C0C */ rbrew_write32(cpu->mem, _t191, cpu->r[3]);
-        /* 021C2C10 */ _t192 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C2C10 */ _t192 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C2C10 */ _t193 = _t192 & 0x00000001u;
         /* 021C2C10 */ if (_t193) goto L_021C2E34; else goto L_021C2C14;
   L_021C2C14: ; // 0x21c2c14
@@ -9097,15 +9097,15 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C2C3C */ cpu->r[4] = cpu->r[1] + 0x00000074u;
         /* 021C2C40 */ Gambit_fn_0204A864(cpu);
         /* 021C2C44 */ cpu->r[8] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C2C44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021C2C44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021C2C48 */ _t195 = cpu->r[1] + 0x00000098u;
         /* 021C2C48 */ rbrew_write32(cpu->mem, _t195, cpu->r[3]);
-        /* 021C2C4C */ _t196 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C2C4C */ _t196 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C2C4C */ _t197 = _t196 & 0x00000001u;
         /* 021C2C4C */ if (_t197) goto L_021C2E34; else goto L_021C2C50;
   L_021C2C50: ; // 0x21c2c50
-        /* 021C2C50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021C2C54 */ _t198 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C2C50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021C2C54 */ _t198 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C2C54 */ _t199 = _t198 & 0x00000001u;
         /* 021C2C54 */ if (_t199) goto L_021C3438; else goto L_021C2C58;
   L_021C2C58: ; // 0x21c2c58
@@ -9114,8 +9114,8 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C2C5C */ _t201 = cpu->r[29] + 0x0000015Cu;
         /* 021C2C5C */ cpu->r[12] = rbrew_read32(cpu->mem, _t201);
         /* 021C2C60 */ cpu->r[10] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021C2C60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021C2C64 */ _t202 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C2C60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021C2C64 */ _t202 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C2C64 */ _t203 = _t202 & 0x00000001u;
         /* 021C2C64 */ if (_t203) goto L_021C3438; else goto L_021C2C68;
   L_021C2C68: ; // 0x21c2c68
@@ -9134,9 +9134,9 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C2C80 */ _t210 = cpu->r[29] + 0x00000000u;
         /* 021C2C80 */ cpu->r[9] = rbrew_read32(cpu->mem, _t210);
         /* 021C2C84 */ cpu->r[8] = rbrew_rlwinm(cpu->r[9], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021C2C84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021C2C84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021C2C88 */ cpu->r[30] = cpu->r[29] + 0x000000A8u;
-        /* 021C2C8C */ _t211 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C2C8C */ _t211 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C2C8C */ _t212 = _t211 & 0x00000001u;
         /* 021C2C8C */ if (_t212) goto L_021C2CD0; else goto L_021C2C90;
   L_021C2C90: ; // 0x21c2c90
@@ -9145,10 +9145,10 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C2C98 */ cpu->f[13] = cpu->f[1];
         /* 021C2C9C */ _t213 = cpu->r[1] + 0x00000010u;
         /* 021C2C9C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t213);
-        /* 021C2CA0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
+        /* 021C2CA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
         /* 021C2CA4 */ _t214 = cpu->r[29] + 0x00000000u;
         /* 021C2CA4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t214);
-        /* 021C2CA8 */ _t215 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C2CA8 */ _t215 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C2CA8 */ _t216 = _t215 & 0x00000001u;
         /* 021C2CA8 */ if (_t216) goto L_021C2CAC; else goto L_021C2CC8;
   L_021C2CAC: ; // 0x21c2cac
@@ -9233,10 +9233,10 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C2D74 */ cpu->r[7] = 0x000000FFu;
         /* 021C2D78 */ Gambit_fn_0204A864(cpu);
         /* 021C2D7C */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C2D7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021C2D7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021C2D80 */ _t243 = cpu->r[1] + 0x00000070u;
         /* 021C2D80 */ rbrew_write32(cpu->mem, _t243, cpu->r[3]);
-        /* 021C2D84 */ _t244 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C2D84 */ _t244 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C2D84 */ _t245 = _t244 & 0x00000001u;
         /* 021C2D84 */ if (_t245) goto L_021C34F4; else goto L_021C2D88;
   L_021C2D88: ; // 0x21c2d88
@@ -9314,7 +9314,7 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C2E18 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t280);
         /* 021C2E1C */ _t281 = cpu->r[1] + 0x00000218u;
         /* 021C2E1C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t281);
-        /* 021C2E20 */ _t282 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C2E20 */ _t282 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C2E20 */ _t283 = _t282 & 0x00000001u;
         /* 021C2E20 */ if (_t283) goto L_021C2E24; // else: addr-0 trap, fall-through
   L_021C2E24: ; // 0x21c2e24
@@ -9349,8 +9349,8 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C2E68 */ cpu->f[13] = fma(cpu->f[7], cpu->f[7], cpu->f[9]);
         /* 021C2E6C */ _t294 = cpu->r[1] + 0x00000010u;
         /* 021C2E6C */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t294);
-        /* 021C2E70 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[12]);
-        /* 021C2E74 */ _t295 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C2E70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[12]));
+        /* 021C2E74 */ _t295 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C2E74 */ _t296 = _t295 & 0x00000001u;
         /* 021C2E74 */ if (_t296) goto L_021C2F64; else goto L_021C2E78;
   L_021C2E78: ; // 0x21c2e78
@@ -9436,10 +9436,10 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C2F4C */ cpu->f[13] = fma(cpu->f[10], cpu->f[10], cpu->f[6]);
         /* 021C2F50 */ _t323 = cpu->r[1] + 0x00000010u;
         /* 021C2F50 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t323);
-        /* 021C2F54 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
+        /* 021C2F54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
         /* 021C2F58 */ _t324 = cpu->r[1] + 0x00000060u;
         /* 021C2F58 */ rbrew_write_f32(cpu->mem, _t324, cpu->f[10]);
-        /* 021C2F5C */ _t325 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C2F5C */ _t325 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C2F5C */ _t326 = _t325 & 0x00000001u;
         /* 021C2F5C */ if (_t326) goto L_021C2F60; else goto L_021C30A8;
   L_021C2F60: ; // 0x21c2f60
@@ -9542,10 +9542,10 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C3064 */ cpu->f[13] = fma(cpu->f[10], cpu->f[10], cpu->f[6]);
         /* 021C3068 */ _t357 = cpu->r[1] + 0x00000010u;
         /* 021C3068 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t357);
-        /* 021C306C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
+        /* 021C306C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
         /* 021C3070 */ _t358 = cpu->r[1] + 0x00000060u;
         /* 021C3070 */ rbrew_write_f32(cpu->mem, _t358, cpu->f[10]);
-        /* 021C3074 */ _t359 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3074 */ _t359 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3074 */ _t360 = _t359 & 0x00000001u;
         /* 021C3074 */ if (_t360) goto L_021C3078; else goto L_021C30A8;
   L_021C3078: ; // 0x21c3078
@@ -9566,9 +9566,9 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C30A4 */ _t364 = cpu->r[1] + 0x00000060u;
         /* 021C30A4 */ rbrew_write_f32(cpu->mem, _t364, cpu->f[12]);
   L_021C30A8: ; // 0x21c30a8
-        /* 021C30A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 021C30A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 021C30AC */ cpu->r[9] = 0x00000000u;
-        /* 021C30B0 */ _t365 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C30B0 */ _t365 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C30B0 */ _t366 = _t365 & 0x00000001u;
         /* 021C30B0 */ if (_t366) goto L_021C30B8; else goto L_021C30B4;
   L_021C30B4: ; // 0x21c30b4
@@ -9583,11 +9583,11 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C30C4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t369);
         /* 021C30C8 */ _t370 = cpu->r[31] + 0x00000000u;
         /* 021C30C8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t370);
-        /* 021C30CC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[10]);
+        /* 021C30CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[10]));
         /* 021C30D0 */ _t371 = cpu->r[1] + 0x0000003Cu;
         /* 021C30D0 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t371);
         /* 021C30D4 */ cpu->r[7] = cpu->r[9] | 0x00000002u;
-        /* 021C30D8 */ _t372 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C30D8 */ _t372 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C30D8 */ _t373 = _t372 & 0x00000001u;
         /* 021C30D8 */ if (_t373) goto L_021C3118; else goto L_021C30DC;
   L_021C30DC: ; // 0x21c30dc
@@ -9605,10 +9605,10 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C3100 */ cpu->r[10] = cpu->r[23];
         /* 021C3104 */ Gambit_fn_0204A4DC(cpu);
         /* 021C3108 */ cpu->r[11] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C3108 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021C3108 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021C310C */ _t376 = cpu->r[1] + 0x00000088u;
         /* 021C310C */ rbrew_write32(cpu->mem, _t376, cpu->r[3]);
-        /* 021C3110 */ _t377 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3110 */ _t377 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3110 */ _t378 = _t377 & 0x00000001u;
         /* 021C3110 */ if (_t378) goto L_021C3428; else goto L_021C3114;
   L_021C3114: ; // 0x21c3114
@@ -9627,10 +9627,10 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C313C */ cpu->r[7] = 0x000000FFu;
         /* 021C3140 */ Gambit_fn_0204A864(cpu);
         /* 021C3144 */ cpu->r[11] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C3144 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021C3144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021C3148 */ _t380 = cpu->r[1] + 0x00000088u;
         /* 021C3148 */ rbrew_write32(cpu->mem, _t380, cpu->r[3]);
-        /* 021C314C */ _t381 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C314C */ _t381 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C314C */ _t382 = _t381 & 0x00000001u;
         /* 021C314C */ if (_t382) goto L_021C3428; else goto L_021C3150;
   L_021C3150: ; // 0x21c3150
@@ -9652,17 +9652,17 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C3174 */ _t389 = cpu->r[1] + 0x00000018u;
         /* 021C3174 */ cpu->f[27] = rbrew_read_f32(cpu->mem, _t389);
         /* 021C3178 */ cpu->r[19] = 0x00000000u;
-        /* 021C317C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021C317C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021C3180 */ _t390 = cpu->r[1] + 0x0000001Cu;
         /* 021C3180 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t390);
-        /* 021C3184 */ _t391 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3184 */ _t391 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3184 */ _t392 = _t391 & 0x00000001u;
         /* 021C3184 */ if (_t392) goto L_021C3414; else goto L_021C3188;
   L_021C3188: ; // 0x21c3188
         /* 021C3188 */ goto L_021C31D0;
   L_021C318C: ; // 0x21c318c
-        /* 021C318C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[19], 0x00000000u);
-        /* 021C3190 */ _t393 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C318C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[19], 0x00000000u));
+        /* 021C3190 */ _t393 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3190 */ _t394 = _t393 & 0x00000001u;
         /* 021C3190 */ if (_t394) goto L_021C3194; else goto L_021C31B8;
   L_021C3194: ; // 0x21c3194
@@ -9673,10 +9673,10 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C31A0 */ cpu->r[8] = cpu->r[4] - cpu->r[0];
         /* 021C31A4 */ _t396 = cpu->r[1] + 0x00000018u;
         /* 021C31A4 */ cpu->f[27] = rbrew_read_f32(cpu->mem, _t396);
-        /* 021C31A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021C31A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021C31AC */ _t397 = cpu->r[1] + 0x0000001Cu;
         /* 021C31AC */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t397);
-        /* 021C31B0 */ _t398 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C31B0 */ _t398 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C31B0 */ _t399 = _t398 & 0x00000001u;
         /* 021C31B0 */ if (_t399) goto L_021C3414; else goto L_021C31B4;
   L_021C31B4: ; // 0x21c31b4
@@ -9687,32 +9687,32 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C31BC */ cpu->r[7] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x00000018u, 0x0000001Bu);
         /* 021C31C0 */ cpu->r[10] = cpu->r[7] + 0xFFFFFFFFu;
         /* 021C31C4 */ cpu->r[8] = cpu->r[7] - cpu->r[10];
-        /* 021C31C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021C31CC */ _t401 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C31C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021C31CC */ _t401 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C31CC */ _t402 = _t401 & 0x00000001u;
         /* 021C31CC */ if (_t402) goto L_021C3414; else goto L_021C31D0;
   L_021C31D0: ; // 0x21c31d0
-        /* 021C31D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[19], 0x00000000u);
+        /* 021C31D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[19], 0x00000000u));
         /* 021C31D4 */ _t403 = cpu->r[21] + 0x00000000u;
         /* 021C31D4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t403);
-        /* 021C31D8 */ _t404 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C31D8 */ _t404 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C31D8 */ _t405 = _t404 & 0x00000001u;
         /* 021C31D8 */ if (_t405) goto L_021C31DC; else goto L_021C324C;
   L_021C31DC: ; // 0x21c31dc
         /* 021C31DC */ cpu->r[0] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C31DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021C31DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021C31E0 */ cpu->r[18] = cpu->r[21] + 0x00000048u;
-        /* 021C31E4 */ _t406 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C31E4 */ _t406 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C31E4 */ _t407 = _t406 & 0x00000001u;
         /* 021C31E4 */ if (_t407) goto L_021C3224; else goto L_021C31E8;
   L_021C31E8: ; // 0x21c31e8
         /* 021C31E8 */ cpu->r[3] = cpu->r[21] + 0x0000012Cu;
         /* 021C31EC */ Gambit_fn_02C69350(cpu);
         /* 021C31F0 */ cpu->f[0] = cpu->f[1];
-        /* 021C31F4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[27]);
+        /* 021C31F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[27]));
         /* 021C31F8 */ _t408 = cpu->r[21] + 0x00000000u;
         /* 021C31F8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t408);
-        /* 021C31FC */ _t409 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C31FC */ _t409 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C31FC */ _t410 = _t409 & 0x00000001u;
         /* 021C31FC */ if (_t410) goto L_021C3200; else goto L_021C321C;
   L_021C3200: ; // 0x21c3200
@@ -9739,26 +9739,26 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C3238 */ _t415 = cpu->r[1] + 0x00000060u;
         /* 021C3238 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t415);
         /* 021C323C */ cpu->f[11] = fma(cpu->f[5], cpu->f[10], cpu->f[8]);
-        /* 021C3240 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[27]);
-        /* 021C3244 */ _t416 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3240 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[27]));
+        /* 021C3244 */ _t416 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3244 */ _t417 = _t416 & 0x00000001u;
         /* 021C3244 */ if (_t417) goto L_021C3248; else goto L_021C3414;
   L_021C3248: ; // 0x21c3248
         /* 021C3248 */ goto L_021C32B4;
   L_021C324C: ; // 0x21c324c
         /* 021C324C */ cpu->r[7] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021C324C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021C324C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021C3250 */ cpu->r[18] = cpu->r[21] + 0x000000A8u;
-        /* 021C3254 */ _t418 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3254 */ _t418 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3254 */ _t419 = _t418 & 0x00000001u;
         /* 021C3254 */ if (_t419) goto L_021C3290; else goto L_021C3258;
   L_021C3258: ; // 0x21c3258
         /* 021C3258 */ cpu->r[3] = cpu->r[21] + 0x00000138u;
         /* 021C325C */ Gambit_fn_02C69350(cpu);
-        /* 021C3260 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[27]);
+        /* 021C3260 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[27]));
         /* 021C3264 */ _t420 = cpu->r[21] + 0x00000000u;
         /* 021C3264 */ cpu->r[10] = rbrew_read32(cpu->mem, _t420);
-        /* 021C3268 */ _t421 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3268 */ _t421 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3268 */ _t422 = _t421 & 0x00000001u;
         /* 021C3268 */ if (_t422) goto L_021C326C; else goto L_021C3288;
   L_021C326C: ; // 0x21c326c
@@ -9785,8 +9785,8 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C32A4 */ _t427 = cpu->r[1] + 0x00000060u;
         /* 021C32A4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t427);
         /* 021C32A8 */ cpu->f[11] = fma(cpu->f[5], cpu->f[10], cpu->f[8]);
-        /* 021C32AC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[27]);
-        /* 021C32B0 */ _t428 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C32AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[27]));
+        /* 021C32B0 */ _t428 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C32B0 */ _t429 = _t428 & 0x00000001u;
         /* 021C32B0 */ if (_t429) goto L_021C32B4; else goto L_021C3414;
   L_021C32B4: ; // 0x21c32b4
@@ -9800,21 +9800,21 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C32CC */ Gambit_fn_02C8866C(cpu);
         /* 021C32D0 */ cpu->f[8] = cpu->f[29] / cpu->f[1];
         /* 021C32D4 */ cpu->f[9] = -cpu->f[8];
-        /* 021C32D8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[14], cpu->f[9]);
-        /* 021C32DC */ _t431 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C32D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[14], cpu->f[9]));
+        /* 021C32DC */ _t431 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C32DC */ _t432 = _t431 & 0x00000001u;
         /* 021C32DC */ if (_t432) goto L_021C32E0; else goto L_021C3414;
   L_021C32E0: ; // 0x21c32e0
-        /* 021C32E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021C32E4 */ _t433 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C32E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021C32E4 */ _t433 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C32E4 */ _t434 = _t433 & 0x00000001u;
         /* 021C32E4 */ if (_t434) goto L_021C3438; else goto L_021C32E8;
   L_021C32E8: ; // 0x21c32e8
         /* 021C32E8 */ _t435 = cpu->r[21] + 0x0000015Cu;
         /* 021C32E8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t435);
         /* 021C32EC */ cpu->r[9] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021C32EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 021C32F0 */ _t436 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C32EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 021C32F0 */ _t436 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C32F0 */ _t437 = _t436 & 0x00000001u;
         /* 021C32F0 */ if (_t437) goto L_021C3438; else goto L_021C32F4;
   L_021C32F4: ; // 0x21c32f4
@@ -9833,19 +9833,19 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C330C */ _t444 = cpu->r[21] + 0x00000000u;
         /* 021C330C */ cpu->r[0] = rbrew_read32(cpu->mem, _t444);
         /* 021C3310 */ cpu->r[11] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021C3310 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021C3310 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021C3314 */ cpu->r[18] = cpu->r[21] + 0x000000A8u;
-        /* 021C3318 */ _t445 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3318 */ _t445 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3318 */ _t446 = _t445 & 0x00000001u;
         /* 021C3318 */ if (_t446) goto L_021C3358; else goto L_021C331C;
   L_021C331C: ; // 0x21c331c
         /* 021C331C */ cpu->r[3] = cpu->r[21] + 0x00000138u;
         /* 021C3320 */ Gambit_fn_02C69350(cpu);
         /* 021C3324 */ cpu->f[13] = cpu->f[1];
-        /* 021C3328 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[27]);
+        /* 021C3328 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[27]));
         /* 021C332C */ _t447 = cpu->r[21] + 0x00000000u;
         /* 021C332C */ cpu->r[0] = rbrew_read32(cpu->mem, _t447);
-        /* 021C3330 */ _t448 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3330 */ _t448 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3330 */ _t449 = _t448 & 0x00000001u;
         /* 021C3330 */ if (_t449) goto L_021C3334; else goto L_021C3350;
   L_021C3334: ; // 0x21c3334
@@ -9930,48 +9930,48 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C33FC */ cpu->r[7] = 0x000000FFu;
         /* 021C3400 */ Gambit_fn_0204A864(cpu);
         /* 021C3404 */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C3404 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021C3404 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021C3408 */ _t476 = cpu->r[1] + 0x00000070u;
         /* 021C3408 */ rbrew_write32(cpu->mem, _t476, cpu->r[3]);
-        /* 021C340C */ _t477 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C340C */ _t477 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C340C */ _t478 = _t477 & 0x00000001u;
         /* 021C340C */ if (_t478) goto L_021C3410; else goto L_021C2D88;
   L_021C3410: ; // 0x21c3410
         /* 021C3410 */ goto L_021C34F4;
   L_021C3414: ; // 0x21c3414
         /* 021C3414 */ cpu->r[19] = cpu->r[19] + 0x00000001u;
-        /* 021C3418 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[19], 0x00000002u);
-        /* 021C341C */ _t479 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[19], 0x00000002u));
+        /* 021C341C */ _t479 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C341C */ _t480 = _t479 & 0x00000001u;
         /* 021C341C */ if (_t480) goto L_021C318C; else goto L_021C3420;
   L_021C3420: ; // 0x21c3420
-        /* 021C3420 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021C3424 */ _t481 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3420 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021C3424 */ _t481 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3424 */ _t482 = _t481 & 0x00000001u;
         /* 021C3424 */ if (_t482) goto L_021C3428; else goto L_021C3438;
   L_021C3428: ; // 0x21c3428
         /* 021C3428 */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 021C342C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000002u);
-        /* 021C3430 */ _t483 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C342C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000002u));
+        /* 021C3430 */ _t483 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3430 */ _t484 = _t483 & 0x00000001u;
         /* 021C3430 */ if (_t484) goto L_021C2820; else goto L_021C3434;
   L_021C3434: ; // 0x21c3434
         /* 021C3434 */ goto L_021C3444;
   L_021C3438: ; // 0x21c3438
-        /* 021C3438 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021C343C */ _t485 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3438 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021C343C */ _t485 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C343C */ _t486 = _t485 & 0x00000001u;
         /* 021C343C */ if (_t486) goto L_021C34F4; else goto L_021C3440;
   L_021C3440: ; // 0x21c3440
         /* 021C3440 */ goto L_021C3454;
   L_021C3444: ; // 0x21c3444
-        /* 021C3444 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021C3448 */ _t487 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3444 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021C3448 */ _t487 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3448 */ _t488 = _t487 & 0x00000001u;
         /* 021C3448 */ if (_t488) goto L_021C2D88; else goto L_021C344C;
   L_021C344C: ; // 0x21c344c
-        /* 021C344C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021C3450 */ _t489 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C344C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021C3450 */ _t489 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3450 */ _t490 = _t489 & 0x00000001u;
         /* 021C3450 */ if (_t490) goto L_021C34F4; else goto L_021C3454;
   L_021C3454: ; // 0x21c3454
@@ -10030,17 +10030,17 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C34E0 */ cpu->r[6] = 0x00000000u;
         /* 021C34E4 */ Gambit_fn_0204A864(cpu);
         /* 021C34E8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C34E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021C34E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021C34EC */ _t508 = cpu->r[1] + 0x00000070u;
         /* 021C34EC */ rbrew_write32(cpu->mem, _t508, cpu->r[3]);
-        /* 021C34F0 */ _t509 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C34F0 */ _t509 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C34F0 */ _t510 = _t509 & 0x00000001u;
         /* 021C34F0 */ if (_t510) goto L_021C34F4; else goto L_021C2D88;
   L_021C34F4: ; // 0x21c34f4
-        /* 021C34F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 021C34F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 021C34F8 */ _t511 = cpu->r[20] + 0x00000030u;
         /* 021C34F8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t511);
-        /* 021C34FC */ _t512 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C34FC */ _t512 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C34FC */ _t513 = _t512 & 0x00000001u;
         /* 021C34FC */ if (_t513) goto L_021C3500; else goto L_021C35BC;
   L_021C3500: ; // 0x21c3500
@@ -10123,7 +10123,7 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C35A0 */ _t550 = cpu->r[1] + 0x000001B8u;
         /* 021C35A0 */ cpu->f[25] = rbrew_read_f64(cpu->mem, _t550);
         /* 021C35A4 */ cpu->r[3] = 0x00000001u;
-        /* 021C35A8 */ _t551 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C35A8 */ _t551 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C35A8 */ _t552 = _t551 & 0x00000001u;
         /* 021C35A8 */ if (_t552) goto L_021C35AC; // else: addr-0 trap, fall-through
   L_021C35AC: ; // 0x21c35ac
@@ -10212,7 +10212,7 @@ void Gambit_fn_021C2660(CPUState* cpu) {
         /* 021C365C */ _t590 = cpu->r[1] + 0x000001B8u;
         /* 021C365C */ cpu->f[25] = rbrew_read_f64(cpu->mem, _t590);
         /* 021C3660 */ cpu->r[3] = 0x00000001u;
-        /* 021C3664 */ _t591 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3664 */ _t591 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3664 */ _t592 = _t591 & 0x00000001u;
         /* 021C3664 */ if (_t592) goto L_021C3668; // else: addr-0 trap, fall-through
   L_021C3668: ; // 0x21c3668
@@ -10332,9 +10332,9 @@ void Gambit_fn_021C36D0(CPUState* cpu) {
         /* 021C3714 */ _t10 = cpu->r[29] + 0x000001F4u;
         /* 021C3714 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t10);
         /* 021C3718 */ cpu->r[30] = cpu->r[4];
-        /* 021C371C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021C371C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021C3720 */ cpu->r[31] = cpu->r[5];
-        /* 021C3724 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3724 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3724 */ _t12 = _t11 & 0x00000001u;
         /* 021C3724 */ if (_t12) goto L_021C3728; else goto L_021C38F8;
   L_021C3728: ; // 0x21c3728
@@ -10347,8 +10347,8 @@ void Gambit_fn_021C36D0(CPUState* cpu) {
         /* 021C373C */ cpu->r[0] = cpu->r[12] + 0xFFFFFFFFu;
         /* 021C3740 */ cpu->r[28] = cpu->r[12] - cpu->r[0];
         /* 021C3744 */ cpu->r[9] = cpu->r[27] | cpu->r[28];
-        /* 021C3744 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 021C3748 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3744 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 021C3748 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3748 */ _t15 = _t14 & 0x00000001u;
         /* 021C3748 */ if (_t15) goto L_021C38F8; else goto L_021C374C;
   L_021C374C: ; // 0x21c374c
@@ -10375,32 +10375,32 @@ void Gambit_fn_021C36D0(CPUState* cpu) {
         /* 021C3780 */ cpu->f[2] = (double)(float)cpu->f[10];
         /* 021C3784 */ Gambit_fn_02C88860(cpu);
         /* 021C3788 */ cpu->r[12] = 0x10030000u;
-        /* 021C378C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 021C378C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 021C3790 */ _t23 = cpu->r[12] + 0xFFFFB5F4u;
         /* 021C3790 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t23);
         /* 021C3794 */ cpu->r[12] = 0x10030000u;
         /* 021C3798 */ cpu->f[29] = cpu->f[1];
         /* 021C379C */ _t24 = cpu->r[12] + 0xFFFFB5F8u;
         /* 021C379C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t24);
-        /* 021C37A0 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C37A0 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C37A0 */ _t26 = _t25 & 0x00000001u;
         /* 021C37A0 */ if (_t26) goto L_021C382C; else goto L_021C37A4;
   L_021C37A4: ; // 0x21c37a4
         /* 021C37A4 */ _t27 = cpu->r[30] + 0x00000000u;
         /* 021C37A4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t27);
         /* 021C37A8 */ cpu->r[8] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C37A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021C37A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021C37AC */ cpu->r[27] = cpu->r[30] + 0x00000048u;
-        /* 021C37B0 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C37B0 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C37B0 */ _t29 = _t28 & 0x00000001u;
         /* 021C37B0 */ if (_t29) goto L_021C37EC; else goto L_021C37B4;
   L_021C37B4: ; // 0x21c37b4
         /* 021C37B4 */ cpu->r[3] = cpu->r[30] + 0x0000012Cu;
         /* 021C37B8 */ Gambit_fn_02C69350(cpu);
-        /* 021C37BC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
+        /* 021C37BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
         /* 021C37C0 */ _t30 = cpu->r[30] + 0x00000000u;
         /* 021C37C0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t30);
-        /* 021C37C4 */ _t31 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C37C4 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C37C4 */ _t32 = _t31 & 0x00000001u;
         /* 021C37C4 */ if (_t32) goto L_021C37C8; else goto L_021C37E4;
   L_021C37C8: ; // 0x21c37c8
@@ -10436,31 +10436,31 @@ void Gambit_fn_021C36D0(CPUState* cpu) {
         /* 021C3818 */ cpu->r[3] = cpu->r[29];
         /* 021C381C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021C3820 */ cpu->f[9] = cpu->f[1] * cpu->f[29];
-        /* 021C3824 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[9]);
-        /* 021C3828 */ _t40 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[9]));
+        /* 021C3828 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3828 */ _t41 = _t40 & 0x00000001u;
         /* 021C3828 */ if (_t41) goto L_021C382C; else goto L_021C38BC;
   L_021C382C: ; // 0x21c382c
-        /* 021C382C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021C3830 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C382C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021C3830 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3830 */ _t43 = _t42 & 0x00000001u;
         /* 021C3830 */ if (_t43) goto L_021C38F8; else goto L_021C3834;
   L_021C3834: ; // 0x21c3834
         /* 021C3834 */ _t44 = cpu->r[30] + 0x00000000u;
         /* 021C3834 */ cpu->r[8] = rbrew_read32(cpu->mem, _t44);
         /* 021C3838 */ cpu->r[12] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021C3838 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021C3838 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021C383C */ cpu->r[28] = cpu->r[30] + 0x000000A8u;
-        /* 021C3840 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3840 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3840 */ _t46 = _t45 & 0x00000001u;
         /* 021C3840 */ if (_t46) goto L_021C387C; else goto L_021C3844;
   L_021C3844: ; // 0x21c3844
         /* 021C3844 */ cpu->r[3] = cpu->r[30] + 0x00000138u;
         /* 021C3848 */ Gambit_fn_02C69350(cpu);
-        /* 021C384C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
+        /* 021C384C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
         /* 021C3850 */ _t47 = cpu->r[30] + 0x00000000u;
         /* 021C3850 */ cpu->r[0] = rbrew_read32(cpu->mem, _t47);
-        /* 021C3854 */ _t48 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3854 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3854 */ _t49 = _t48 & 0x00000001u;
         /* 021C3854 */ if (_t49) goto L_021C3858; else goto L_021C3874;
   L_021C3858: ; // 0x21c3858
@@ -10496,8 +10496,8 @@ void Gambit_fn_021C36D0(CPUState* cpu) {
         /* 021C38A8 */ cpu->r[3] = cpu->r[29];
         /* 021C38AC */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021C38B0 */ cpu->f[11] = cpu->f[1] * cpu->f[29];
-        /* 021C38B4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[11]);
-        /* 021C38B8 */ _t57 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C38B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[11]));
+        /* 021C38B8 */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C38B8 */ _t58 = _t57 & 0x00000001u;
         /* 021C38B8 */ if (_t58) goto L_021C38F8; else goto L_021C38BC;
   L_021C38BC: ; // 0x21c38bc
@@ -10519,7 +10519,7 @@ void Gambit_fn_021C36D0(CPUState* cpu) {
         /* 021C38DC */ _t66 = cpu->r[1] + 0x00000038u;
         /* 021C38DC */ cpu->f[29] = rbrew_read_f64(cpu->mem, _t66);
         /* 021C38E0 */ cpu->r[3] = 0x00000001u;
-        /* 021C38E4 */ _t67 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C38E4 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C38E4 */ _t68 = _t67 & 0x00000001u;
         /* 021C38E4 */ if (_t68) goto L_021C38E8; // else: addr-0 trap, fall-through
   L_021C38E8: ; // 0x21c38e8
@@ -10547,7 +10547,7 @@ void Gambit_fn_021C36D0(CPUState* cpu) {
         /* 021C3918 */ _t77 = cpu->r[1] + 0x00000038u;
         /* 021C3918 */ cpu->f[29] = rbrew_read_f64(cpu->mem, _t77);
         /* 021C391C */ cpu->r[3] = 0x00000000u;
-        /* 021C3920 */ _t78 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3920 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3920 */ _t79 = _t78 & 0x00000001u;
         /* 021C3920 */ if (_t79) goto L_021C3924; // else: addr-0 trap, fall-through
   L_021C3924: ; // 0x21c3924
@@ -10586,8 +10586,8 @@ void Gambit_fn_021C3934(CPUState* cpu) {
         /* 021C3960 */ rbrew_write32(cpu->mem, _t7, cpu->r[30]);
         /* 021C3964 */ _t8 = cpu->r[31] + 0x000001CCu;
         /* 021C3964 */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021C3968 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x0000000Bu);
-        /* 021C396C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3968 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x0000000Bu));
+        /* 021C396C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C396C */ _t10 = _t9 & 0x00000001u;
         /* 021C396C */ if (_t10) goto L_021C39A0; else goto L_021C3970;
   L_021C3970: ; // 0x21c3970
@@ -10604,7 +10604,7 @@ void Gambit_fn_021C3934(CPUState* cpu) {
         /* 021C3984 */ cpu->r[31] = rbrew_read32(cpu->mem, _t15);
         /* 021C3988 */ _t16 = cpu->r[1] + 0x00000018u;
         /* 021C3988 */ cpu->r[30] = rbrew_read32(cpu->mem, _t16);
-        /* 021C398C */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C398C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C398C */ _t18 = _t17 & 0x00000001u;
         /* 021C398C */ if (_t18) goto L_021C3990; // else: addr-0 trap, fall-through
   L_021C3990: ; // 0x21c3990
@@ -10617,8 +10617,8 @@ void Gambit_fn_021C3934(CPUState* cpu) {
         /* 021C39A0 */ _t20 = cpu->r[4] + 0x00000000u;
         /* 021C39A0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t20);
         /* 021C39A4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[10], 0x0000000Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021C39A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021C39A8 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C39A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021C39A8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C39A8 */ _t22 = _t21 & 0x00000001u;
         /* 021C39A8 */ if (_t22) goto L_021C39AC; else goto L_021C39DC;
   L_021C39AC: ; // 0x21c39ac
@@ -10635,7 +10635,7 @@ void Gambit_fn_021C3934(CPUState* cpu) {
         /* 021C39C0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t27);
         /* 021C39C4 */ _t28 = cpu->r[1] + 0x00000018u;
         /* 021C39C4 */ cpu->r[30] = rbrew_read32(cpu->mem, _t28);
-        /* 021C39C8 */ _t29 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C39C8 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C39C8 */ _t30 = _t29 & 0x00000001u;
         /* 021C39C8 */ if (_t30) goto L_021C39CC; // else: addr-0 trap, fall-through
   L_021C39CC: ; // 0x21c39cc
@@ -10665,8 +10665,8 @@ void Gambit_fn_021C3934(CPUState* cpu) {
         /* 021C3A08 */ cpu->f[10] = fabs(cpu->f[13]);
         /* 021C3A0C */ _t38 = cpu->r[10] + 0xFFFFB6F4u;
         /* 021C3A0C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t38);
-        /* 021C3A10 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
-        /* 021C3A14 */ _t39 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3A10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
+        /* 021C3A14 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3A14 */ _t40 = _t39 & 0x00000001u;
         /* 021C3A14 */ if (_t40) goto L_021C3A30; else goto L_021C3A18;
   L_021C3A18: ; // 0x21c3a18
@@ -10675,8 +10675,8 @@ void Gambit_fn_021C3934(CPUState* cpu) {
         /* 021C3A20 */ cpu->f[31] = cpu->f[12] / cpu->f[13];
         /* 021C3A24 */ _t41 = cpu->r[8] + 0xFFFFB5F4u;
         /* 021C3A24 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t41);
-        /* 021C3A28 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[13]);
-        /* 021C3A2C */ _t42 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3A28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[13]));
+        /* 021C3A2C */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3A2C */ _t43 = _t42 & 0x00000001u;
         /* 021C3A2C */ if (_t43) goto L_021C3A30; else goto L_021C3AA8;
   L_021C3A30: ; // 0x21c3a30
@@ -10785,7 +10785,7 @@ void Gambit_fn_021C3934(CPUState* cpu) {
         /* 021C3B34 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t78);
         /* 021C3B38 */ _t79 = cpu->r[1] + 0x00000018u;
         /* 021C3B38 */ cpu->r[30] = rbrew_read32(cpu->mem, _t79);
-        /* 021C3B3C */ _t80 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3B3C */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3B3C */ _t81 = _t80 & 0x00000001u;
         /* 021C3B3C */ if (_t81) goto L_021C3B40; // else: addr-0 trap, fall-through
   L_021C3B40: ; // 0x21c3b40
@@ -10823,8 +10823,8 @@ void Gambit_fn_021C3938(CPUState* cpu) {
         /* 021C3960 */ rbrew_write32(cpu->mem, _t7, cpu->r[30]);
         /* 021C3964 */ _t8 = cpu->r[31] + 0x000001CCu;
         /* 021C3964 */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021C3968 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x0000000Bu);
-        /* 021C396C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3968 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x0000000Bu));
+        /* 021C396C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C396C */ _t10 = _t9 & 0x00000001u;
         /* 021C396C */ if (_t10) goto L_021C39A0; else goto L_021C3970;
   L_021C3970: ; // 0x21c3970
@@ -10841,7 +10841,7 @@ void Gambit_fn_021C3938(CPUState* cpu) {
         /* 021C3984 */ cpu->r[31] = rbrew_read32(cpu->mem, _t15);
         /* 021C3988 */ _t16 = cpu->r[1] + 0x00000018u;
         /* 021C3988 */ cpu->r[30] = rbrew_read32(cpu->mem, _t16);
-        /* 021C398C */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C398C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C398C */ _t18 = _t17 & 0x00000001u;
         /* 021C398C */ if (_t18) goto L_021C3990; // else: addr-0 trap, fall-through
   L_021C3990: ; // 0x21c3990
@@ -10854,8 +10854,8 @@ void Gambit_fn_021C3938(CPUState* cpu) {
         /* 021C39A0 */ _t20 = cpu->r[4] + 0x00000000u;
         /* 021C39A0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t20);
         /* 021C39A4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[10], 0x0000000Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021C39A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021C39A8 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C39A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021C39A8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C39A8 */ _t22 = _t21 & 0x00000001u;
         /* 021C39A8 */ if (_t22) goto L_021C39AC; else goto L_021C39DC;
   L_021C39AC: ; // 0x21c39ac
@@ -10872,7 +10872,7 @@ void Gambit_fn_021C3938(CPUState* cpu) {
         /* 021C39C0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t27);
         /* 021C39C4 */ _t28 = cpu->r[1] + 0x00000018u;
         /* 021C39C4 */ cpu->r[30] = rbrew_read32(cpu->mem, _t28);
-        /* 021C39C8 */ _t29 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C39C8 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C39C8 */ _t30 = _t29 & 0x00000001u;
         /* 021C39C8 */ if (_t30) goto L_021C39CC; // else: addr-0 trap, fall-through
   L_021C39CC: ; // 0x21c39cc
@@ -10902,8 +10902,8 @@ void Gambit_fn_021C3938(CPUState* cpu) {
         /* 021C3A08 */ cpu->f[10] = fabs(cpu->f[13]);
         /* 021C3A0C */ _t38 = cpu->r[10] + 0xFFFFB6F4u;
         /* 021C3A0C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t38);
-        /* 021C3A10 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
-        /* 021C3A14 */ _t39 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3A10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
+        /* 021C3A14 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3A14 */ _t40 = _t39 & 0x00000001u;
         /* 021C3A14 */ if (_t40) goto L_021C3A30; else goto L_021C3A18;
   L_021C3A18: ; // 0x21c3a18
@@ -10912,8 +10912,8 @@ void Gambit_fn_021C3938(CPUState* cpu) {
         /* 021C3A20 */ cpu->f[31] = cpu->f[12] / cpu->f[13];
         /* 021C3A24 */ _t41 = cpu->r[8] + 0xFFFFB5F4u;
         /* 021C3A24 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t41);
-        /* 021C3A28 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[13]);
-        /* 021C3A2C */ _t42 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3A28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[13]));
+        /* 021C3A2C */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3A2C */ _t43 = _t42 & 0x00000001u;
         /* 021C3A2C */ if (_t43) goto L_021C3A30; else goto L_021C3AA8;
   L_021C3A30: ; // 0x21c3a30
@@ -11022,7 +11022,7 @@ void Gambit_fn_021C3938(CPUState* cpu) {
         /* 021C3B34 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t78);
         /* 021C3B38 */ _t79 = cpu->r[1] + 0x00000018u;
         /* 021C3B38 */ cpu->r[30] = rbrew_read32(cpu->mem, _t79);
-        /* 021C3B3C */ _t80 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3B3C */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3B3C */ _t81 = _t80 & 0x00000001u;
         /* 021C3B3C */ if (_t81) goto L_021C3B40; // else: addr-0 trap, fall-through
   L_021C3B40: ; // 0x21c3b40
@@ -11125,15 +11125,15 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C3C14 */ cpu->r[29] = cpu->r[3];
         /* 021C3C18 */ _t32 = cpu->r[1] + 0x00000034u;
         /* 021C3C18 */ rbrew_write32(cpu->mem, _t32, cpu->r[7]);
-        /* 021C3C1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 021C3C1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 021C3C20 */ _t33 = cpu->r[1] + 0x00000028u;
         /* 021C3C20 */ rbrew_write32(cpu->mem, _t33, cpu->r[7]);
-        /* 021C3C24 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3C24 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3C24 */ _t35 = _t34 & 0x00000001u;
         /* 021C3C24 */ if (_t35) goto L_021C4128; else goto L_021C3C28;
   L_021C3C28: ; // 0x21c3c28
-        /* 021C3C28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021C3C2C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3C28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021C3C2C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3C2C */ _t37 = _t36 & 0x00000001u;
         /* 021C3C2C */ if (_t37) goto L_021C4128; else goto L_021C3C30;
   L_021C3C30: ; // 0x21c3c30
@@ -11150,8 +11150,8 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
   L_021C3C50: ; // 0x21c3c50
         /* 021C3C50 */ _t40 = cpu->r[10] + 0x00000004u;
         /* 021C3C50 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t40);
-        /* 021C3C54 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[0]);
-        /* 021C3C58 */ _t41 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3C54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[0]));
+        /* 021C3C58 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3C58 */ _t42 = _t41 & 0x00000001u;
         /* 021C3C58 */ if (_t42) goto L_021C3EF0; else goto L_021C3C5C;
   L_021C3C5C: ; // 0x21c3c5c
@@ -11159,8 +11159,8 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C3C5C */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t43);
         /* 021C3C60 */ _t44 = cpu->r[12] + 0x00000000u;
         /* 021C3C60 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t44);
-        /* 021C3C64 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[9]);
-        /* 021C3C68 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3C64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[9]));
+        /* 021C3C68 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3C68 */ _t46 = _t45 & 0x00000001u;
         /* 021C3C68 */ if (_t46) goto L_021C3C6C; else goto L_021C3C8C;
   L_021C3C6C: ; // 0x21c3c6c
@@ -11168,8 +11168,8 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C3C6C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t47);
         /* 021C3C70 */ _t48 = cpu->r[12] + 0x00000004u;
         /* 021C3C70 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t48);
-        /* 021C3C74 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[12]);
-        /* 021C3C78 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3C74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[12]));
+        /* 021C3C78 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3C78 */ _t50 = _t49 & 0x00000001u;
         /* 021C3C78 */ if (_t50) goto L_021C3C7C; else goto L_021C3C8C;
   L_021C3C7C: ; // 0x21c3c7c
@@ -11177,13 +11177,13 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C3C7C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t51);
         /* 021C3C80 */ _t52 = cpu->r[12] + 0x00000008u;
         /* 021C3C80 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t52);
-        /* 021C3C84 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[6]);
-        /* 021C3C88 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3C84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[6]));
+        /* 021C3C88 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3C88 */ _t54 = _t53 & 0x00000001u;
         /* 021C3C88 */ if (_t54) goto L_021C3EF0; else goto L_021C3C8C;
   L_021C3C8C: ; // 0x21c3c8c
-        /* 021C3C8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021C3C90 */ _t55 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3C8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021C3C90 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3C90 */ _t56 = _t55 & 0x00000001u;
         /* 021C3C90 */ if (_t56) goto L_021C3C94; else goto L_021C3EF0;
   L_021C3C94: ; // 0x21c3c94
@@ -11194,8 +11194,8 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
   L_021C3CA4: ; // 0x21c3ca4
         /* 021C3CA4 */ _t57 = cpu->r[9] + 0x00000004u;
         /* 021C3CA4 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t57);
-        /* 021C3CA8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[5]);
-        /* 021C3CAC */ _t58 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3CA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[5]));
+        /* 021C3CAC */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3CAC */ _t59 = _t58 & 0x00000001u;
         /* 021C3CAC */ if (_t59) goto L_021C3EE8; else goto L_021C3CB0;
   L_021C3CB0: ; // 0x21c3cb0
@@ -11203,8 +11203,8 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C3CB0 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t60);
         /* 021C3CB4 */ _t61 = cpu->r[12] + 0x00000000u;
         /* 021C3CB4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t61);
-        /* 021C3CB8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[10]);
-        /* 021C3CBC */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3CB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[10]));
+        /* 021C3CBC */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3CBC */ _t63 = _t62 & 0x00000001u;
         /* 021C3CBC */ if (_t63) goto L_021C3CC0; else goto L_021C3CE0;
   L_021C3CC0: ; // 0x21c3cc0
@@ -11212,8 +11212,8 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C3CC0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t64);
         /* 021C3CC4 */ _t65 = cpu->r[12] + 0x00000004u;
         /* 021C3CC4 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t65);
-        /* 021C3CC8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[13]);
-        /* 021C3CCC */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3CC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[13]));
+        /* 021C3CCC */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3CCC */ _t67 = _t66 & 0x00000001u;
         /* 021C3CCC */ if (_t67) goto L_021C3CD0; else goto L_021C3CE0;
   L_021C3CD0: ; // 0x21c3cd0
@@ -11221,8 +11221,8 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C3CD0 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t68);
         /* 021C3CD4 */ _t69 = cpu->r[12] + 0x00000008u;
         /* 021C3CD4 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t69);
-        /* 021C3CD8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[7]);
-        /* 021C3CDC */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3CD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[7]));
+        /* 021C3CDC */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3CDC */ _t71 = _t70 & 0x00000001u;
         /* 021C3CDC */ if (_t71) goto L_021C3EE8; else goto L_021C3CE0;
   L_021C3CE0: ; // 0x21c3ce0
@@ -11257,10 +11257,10 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C3D1C */ rbrew_write32(cpu->mem, _t84, cpu->r[0]);
         /* 021C3D20 */ _t85 = cpu->r[9] + 0x00000008u;
         /* 021C3D20 */ cpu->r[4] = rbrew_read32(cpu->mem, _t85);
-        /* 021C3D24 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[27]);
+        /* 021C3D24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[27]));
         /* 021C3D28 */ _t86 = cpu->r[1] + 0x0000001Cu;
         /* 021C3D28 */ rbrew_write32(cpu->mem, _t86, cpu->r[4]);
-        /* 021C3D2C */ _t87 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3D2C */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3D2C */ _t88 = _t87 & 0x00000001u;
         /* 021C3D2C */ if (_t88) goto L_021C3D30; else goto L_021C3D6C;
   L_021C3D30: ; // 0x21c3d30
@@ -11295,8 +11295,8 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C3D7C */ _t97 = cpu->r[1] + 0x0000001Cu;
         /* 021C3D7C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t97);
         /* 021C3D80 */ cpu->f[9] = fma(cpu->f[13], cpu->f[13], cpu->f[10]);
-        /* 021C3D84 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[27]);
-        /* 021C3D88 */ _t98 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3D84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[27]));
+        /* 021C3D88 */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3D88 */ _t99 = _t98 & 0x00000001u;
         /* 021C3D88 */ if (_t99) goto L_021C3DAC; else goto L_021C3D8C;
   L_021C3D8C: ; // 0x21c3d8c
@@ -11305,8 +11305,8 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C3D94 */ /* nop */
         /* 021C3D98 */ /* nop */
         /* 021C3D9C */ cpu->f[12] = fma(cpu->f[26], cpu->f[13], cpu->f[9]);
-        /* 021C3DA0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[5]);
-        /* 021C3DA4 */ _t100 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3DA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[5]));
+        /* 021C3DA4 */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3DA4 */ _t101 = _t100 & 0x00000001u;
         /* 021C3DA4 */ if (_t101) goto L_021C3DA8; else goto L_021C3EE8;
   L_021C3DA8: ; // 0x21c3da8
@@ -11337,10 +11337,10 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C3DEC */ /* nop */
         /* 021C3DF0 */ /* nop */
         /* 021C3DF4 */ cpu->f[12] = fma(cpu->f[26], cpu->f[13], cpu->f[9]);
-        /* 021C3DF8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[5]);
+        /* 021C3DF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[5]));
         /* 021C3DFC */ _t108 = cpu->r[1] + 0x0000001Cu;
         /* 021C3DFC */ rbrew_write_f32(cpu->mem, _t108, cpu->f[13]);
-        /* 021C3E00 */ _t109 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3E00 */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3E00 */ _t110 = _t109 & 0x00000001u;
         /* 021C3E00 */ if (_t110) goto L_021C3E04; else goto L_021C3EE8;
   L_021C3E04: ; // 0x21c3e04
@@ -11348,14 +11348,14 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C3E04 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t111);
         /* 021C3E08 */ _t112 = cpu->r[9] + 0x00000004u;
         /* 021C3E08 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t112);
-        /* 021C3E0C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[27]);
+        /* 021C3E0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[27]));
         /* 021C3E10 */ cpu->r[30] = 0x00000001u;
-        /* 021C3E14 */ _t113 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3E14 */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3E14 */ _t114 = _t113 & 0x00000001u;
         /* 021C3E14 */ if (_t114) goto L_021C3E20; else goto L_021C3E18;
   L_021C3E18: ; // 0x21c3e18
-        /* 021C3E18 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[27]);
-        /* 021C3E1C */ _t115 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3E18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[27]));
+        /* 021C3E1C */ _t115 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3E1C */ _t116 = _t115 & 0x00000001u;
         /* 021C3E1C */ if (_t116) goto L_021C3E20; else goto L_021C3E38;
   L_021C3E20: ; // 0x21c3e20
@@ -11370,15 +11370,15 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
   L_021C3E38: ; // 0x21c3e38
         /* 021C3E38 */ _t119 = cpu->r[10] + 0x00000000u;
         /* 021C3E38 */ cpu->f[26] = rbrew_read_f32(cpu->mem, _t119);
-        /* 021C3E3C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[26], cpu->f[27]);
+        /* 021C3E3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[26], cpu->f[27]));
         /* 021C3E40 */ _t120 = cpu->r[9] + 0x00000000u;
         /* 021C3E40 */ cpu->f[25] = rbrew_read_f32(cpu->mem, _t120);
-        /* 021C3E44 */ _t121 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3E44 */ _t121 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3E44 */ _t122 = _t121 & 0x00000001u;
         /* 021C3E44 */ if (_t122) goto L_021C3E50; else goto L_021C3E48;
   L_021C3E48: ; // 0x21c3e48
-        /* 021C3E48 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[25], cpu->f[27]);
-        /* 021C3E4C */ _t123 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3E48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[25], cpu->f[27]));
+        /* 021C3E4C */ _t123 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3E4C */ _t124 = _t123 & 0x00000001u;
         /* 021C3E4C */ if (_t124) goto L_021C3E50; else goto L_021C3E68;
   L_021C3E50: ; // 0x21c3e50
@@ -11393,15 +11393,15 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
   L_021C3E68: ; // 0x21c3e68
         /* 021C3E68 */ _t127 = cpu->r[10] + 0x00000008u;
         /* 021C3E68 */ cpu->f[24] = rbrew_read_f32(cpu->mem, _t127);
-        /* 021C3E6C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[24], cpu->f[27]);
+        /* 021C3E6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[24], cpu->f[27]));
         /* 021C3E70 */ _t128 = cpu->r[9] + 0x00000008u;
         /* 021C3E70 */ cpu->f[23] = rbrew_read_f32(cpu->mem, _t128);
-        /* 021C3E74 */ _t129 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3E74 */ _t129 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3E74 */ _t130 = _t129 & 0x00000001u;
         /* 021C3E74 */ if (_t130) goto L_021C3E80; else goto L_021C3E78;
   L_021C3E78: ; // 0x21c3e78
-        /* 021C3E78 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[23], cpu->f[27]);
-        /* 021C3E7C */ _t131 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3E78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[23], cpu->f[27]));
+        /* 021C3E7C */ _t131 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3E7C */ _t132 = _t131 & 0x00000001u;
         /* 021C3E7C */ if (_t132) goto L_021C3E80; else goto L_021C3E98;
   L_021C3E80: ; // 0x21c3e80
@@ -11414,13 +11414,13 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C3E94 */ _t134 = cpu->r[1] + 0x00000028u;
         /* 021C3E94 */ rbrew_write_f32(cpu->mem, _t134, cpu->f[10]);
   L_021C3E98: ; // 0x21c3e98
-        /* 021C3E98 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[26], cpu->f[27]);
-        /* 021C3E9C */ _t135 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3E98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[26], cpu->f[27]));
+        /* 021C3E9C */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3E9C */ _t136 = _t135 & 0x00000001u;
         /* 021C3E9C */ if (_t136) goto L_021C3EA8; else goto L_021C3EA0;
   L_021C3EA0: ; // 0x21c3ea0
-        /* 021C3EA0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[25], cpu->f[27]);
-        /* 021C3EA4 */ _t137 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3EA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[25], cpu->f[27]));
+        /* 021C3EA4 */ _t137 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3EA4 */ _t138 = _t137 & 0x00000001u;
         /* 021C3EA4 */ if (_t138) goto L_021C3EA8; else goto L_021C3EC0;
   L_021C3EA8: ; // 0x21c3ea8
@@ -11433,13 +11433,13 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C3EBC */ _t140 = cpu->r[1] + 0x0000002Cu;
         /* 021C3EBC */ rbrew_write_f32(cpu->mem, _t140, cpu->f[7]);
   L_021C3EC0: ; // 0x21c3ec0
-        /* 021C3EC0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[24], cpu->f[27]);
-        /* 021C3EC4 */ _t141 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3EC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[24], cpu->f[27]));
+        /* 021C3EC4 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3EC4 */ _t142 = _t141 & 0x00000001u;
         /* 021C3EC4 */ if (_t142) goto L_021C3ED0; else goto L_021C3EC8;
   L_021C3EC8: ; // 0x21c3ec8
-        /* 021C3EC8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[23], cpu->f[27]);
-        /* 021C3ECC */ _t143 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3EC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[23], cpu->f[27]));
+        /* 021C3ECC */ _t143 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3ECC */ _t144 = _t143 & 0x00000001u;
         /* 021C3ECC */ if (_t144) goto L_021C3ED0; else goto L_021C3EE8;
   L_021C3ED0: ; // 0x21c3ed0
@@ -11460,15 +11460,15 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C3EEC */ if (_t149) goto L_021C3CA4; else goto L_021C3EF0;
   L_021C3EF0: ; // 0x21c3ef0
         /* 021C3EF0 */ cpu->r[5] = cpu->r[5] + 0xFFFFFFFFu;
-        /* 021C3EF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021C3EF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021C3EF4 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
         /* 021C3EF8 */ cpu->r[10] = cpu->r[10] + 0x0000000Cu;
-        /* 021C3EFC */ _t150 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3EFC */ _t150 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3EFC */ _t151 = _t150 & 0x00000001u;
         /* 021C3EFC */ if (_t151) goto L_021C3F00; else goto L_021C3C50;
   L_021C3F00: ; // 0x21c3f00
-        /* 021C3F00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021C3F04 */ _t152 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3F00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021C3F04 */ _t152 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3F04 */ _t153 = _t152 & 0x00000001u;
         /* 021C3F04 */ if (_t153) goto L_021C4128; else goto L_021C3F08;
   L_021C3F08: ; // 0x21c3f08
@@ -11489,7 +11489,7 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C3F24 */ cpu->r[0] = rbrew_read32(cpu->mem, _t160);
         /* 021C3F28 */ _t161 = cpu->r[1] + 0x00000024u;
         /* 021C3F28 */ cpu->f[5] = rbrew_read_f32(cpu->mem, _t161);
-        /* 021C3F2C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[9]);
+        /* 021C3F2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[9]));
         /* 021C3F30 */ _t162 = cpu->r[1] + 0x00000040u;
         /* 021C3F30 */ rbrew_write32(cpu->mem, _t162, cpu->r[0]);
         /* 021C3F34 */ cpu->f[0] = cpu->f[5];
@@ -11497,16 +11497,16 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C3F38 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t163);
         /* 021C3F3C */ _t164 = cpu->r[1] + 0x00000034u;
         /* 021C3F3C */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t164);
-        /* 021C3F40 */ _t165 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3F40 */ _t165 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3F40 */ _t166 = _t165 & 0x00000001u;
         /* 021C3F40 */ if (_t166) goto L_021C3F44; else goto L_021C3F48;
   L_021C3F44: ; // 0x21c3f44
         /* 021C3F44 */ cpu->f[10] = cpu->f[9];
   L_021C3F48: ; // 0x21c3f48
         /* 021C3F48 */ cpu->f[6] = -cpu->f[8];
-        /* 021C3F4C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[7]);
+        /* 021C3F4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[7]));
         /* 021C3F50 */ cpu->f[9] = cpu->f[10];
-        /* 021C3F54 */ _t167 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3F54 */ _t167 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3F54 */ _t168 = _t167 & 0x00000001u;
         /* 021C3F54 */ if (_t168) goto L_021C3F58; else goto L_021C3F5C;
   L_021C3F58: ; // 0x21c3f58
@@ -11515,24 +11515,24 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C3F5C */ cpu->f[6] = fabs(cpu->f[10]);
         /* 021C3F60 */ cpu->f[4] = fabs(cpu->f[5]);
         /* 021C3F64 */ cpu->f[7] = cpu->f[8];
-        /* 021C3F68 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[4], cpu->f[6]);
+        /* 021C3F68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[4], cpu->f[6]));
         /* 021C3F6C */ cpu->f[13] = fabs(cpu->f[8]);
-        /* 021C3F70 */ _t169 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3F70 */ _t169 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3F70 */ _t170 = _t169 & 0x00000001u;
         /* 021C3F70 */ if (_t170) goto L_021C3F74; else goto L_021C3F88;
   L_021C3F74: ; // 0x21c3f74
-        /* 021C3F74 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[4]);
+        /* 021C3F74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[4]));
         /* 021C3F78 */ cpu->r[8] = 0x10030000u;
         /* 021C3F7C */ _t171 = cpu->r[8] + 0xFFFFB6A0u;
         /* 021C3F7C */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t171);
-        /* 021C3F80 */ _t172 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3F80 */ _t172 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3F80 */ _t173 = _t172 & 0x00000001u;
         /* 021C3F80 */ if (_t173) goto L_021C4040; else goto L_021C3F84;
   L_021C3F84: ; // 0x21c3f84
         /* 021C3F84 */ goto L_021C3FE0;
   L_021C3F88: ; // 0x21c3f88
-        /* 021C3F88 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[4], cpu->f[13]);
-        /* 021C3F8C */ _t174 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3F88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[4], cpu->f[13]));
+        /* 021C3F8C */ _t174 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3F8C */ _t175 = _t174 & 0x00000001u;
         /* 021C3F8C */ if (_t175) goto L_021C3FD0; else goto L_021C3F90;
   L_021C3F90: ; // 0x21c3f90
@@ -11552,27 +11552,27 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C3FB4 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t179);
         /* 021C3FB8 */ _t180 = cpu->r[1] + 0x00000040u;
         /* 021C3FB8 */ rbrew_write_f32(cpu->mem, _t180, cpu->f[8]);
-        /* 021C3FBC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[7]);
+        /* 021C3FBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[7]));
         /* 021C3FC0 */ _t181 = cpu->r[1] + 0x0000003Cu;
         /* 021C3FC0 */ rbrew_write_f32(cpu->mem, _t181, cpu->f[5]);
         /* 021C3FC4 */ _t182 = cpu->r[31] + 0x00000138u;
         /* 021C3FC4 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t182);
-        /* 021C3FC8 */ _t183 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3FC8 */ _t183 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3FC8 */ _t184 = _t183 & 0x00000001u;
         /* 021C3FC8 */ if (_t184) goto L_021C3FCC; else goto L_021C40D4;
   L_021C3FCC: ; // 0x21c3fcc
         /* 021C3FCC */ goto L_021C40CC;
   L_021C3FD0: ; // 0x21c3fd0
-        /* 021C3FD0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[4]);
+        /* 021C3FD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[4]));
         /* 021C3FD4 */ cpu->r[8] = 0x10030000u;
         /* 021C3FD8 */ _t185 = cpu->r[8] + 0xFFFFB6A0u;
         /* 021C3FD8 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t185);
-        /* 021C3FDC */ _t186 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3FDC */ _t186 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3FDC */ _t187 = _t186 & 0x00000001u;
         /* 021C3FDC */ if (_t187) goto L_021C4040; else goto L_021C3FE0;
   L_021C3FE0: ; // 0x21c3fe0
-        /* 021C3FE0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[13]);
-        /* 021C3FE4 */ _t188 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3FE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[13]));
+        /* 021C3FE4 */ _t188 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3FE4 */ _t189 = _t188 & 0x00000001u;
         /* 021C3FE4 */ if (_t189) goto L_021C4040; else goto L_021C3FE8;
   L_021C3FE8: ; // 0x21c3fe8
@@ -11585,7 +11585,7 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C3FF8 */ cpu->f[8] = cpu->f[8] * cpu->f[13];
         /* 021C3FFC */ cpu->f[10] = cpu->f[10] * cpu->f[9];
         /* 021C4000 */ /* nop */
-        /* 021C4004 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[11]);
+        /* 021C4004 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[11]));
         /* 021C4008 */ _t192 = cpu->r[1] + 0x0000003Cu;
         /* 021C4008 */ rbrew_write_f32(cpu->mem, _t192, cpu->f[5]);
         /* 021C400C */ cpu->f[10] = fma(cpu->f[30], cpu->f[6], cpu->f[10]);
@@ -11593,7 +11593,7 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C4010 */ rbrew_write_f32(cpu->mem, _t193, cpu->f[8]);
         /* 021C4014 */ _t194 = cpu->r[1] + 0x00000038u;
         /* 021C4014 */ rbrew_write_f32(cpu->mem, _t194, cpu->f[10]);
-        /* 021C4018 */ _t195 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4018 */ _t195 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4018 */ _t196 = _t195 & 0x00000001u;
         /* 021C4018 */ if (_t196) goto L_021C40BC; else goto L_021C401C;
   L_021C401C: ; // 0x21c401c
@@ -11602,25 +11602,25 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C4020 */ _t198 = cpu->r[31] + 0x00000134u;
         /* 021C4020 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t198);
         /* 021C4024 */ /* nop */
-        /* 021C4028 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[7]);
+        /* 021C4028 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[7]));
         /* 021C402C */ cpu->f[8] = fma(cpu->f[30], cpu->f[9], cpu->f[8]);
         /* 021C4030 */ _t199 = cpu->r[31] + 0x00000138u;
         /* 021C4030 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t199);
         /* 021C4034 */ _t200 = cpu->r[1] + 0x00000040u;
         /* 021C4034 */ rbrew_write_f32(cpu->mem, _t200, cpu->f[8]);
-        /* 021C4038 */ _t201 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C4038 */ _t201 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C4038 */ _t202 = _t201 & 0x00000001u;
         /* 021C4038 */ if (_t202) goto L_021C403C; else goto L_021C40D4;
   L_021C403C: ; // 0x21c403c
         /* 021C403C */ goto L_021C40CC;
   L_021C4040: ; // 0x21c4040
-        /* 021C4040 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[4]);
-        /* 021C4044 */ _t203 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C4040 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[4]));
+        /* 021C4044 */ _t203 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C4044 */ _t204 = _t203 & 0x00000001u;
         /* 021C4044 */ if (_t204) goto L_021C4050; else goto L_021C4048;
   L_021C4048: ; // 0x21c4048
-        /* 021C4048 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[6]);
-        /* 021C404C */ _t205 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C4048 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[6]));
+        /* 021C404C */ _t205 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C404C */ _t206 = _t205 & 0x00000001u;
         /* 021C404C */ if (_t206) goto L_021C4050; else goto L_021C4070;
   L_021C4050: ; // 0x21c4050
@@ -11630,12 +11630,12 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C4054 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t208);
         /* 021C4058 */ _t209 = cpu->r[1] + 0x0000003Cu;
         /* 021C4058 */ rbrew_write_f32(cpu->mem, _t209, cpu->f[0]);
-        /* 021C405C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[7]);
+        /* 021C405C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[7]));
         /* 021C4060 */ _t210 = cpu->r[1] + 0x00000038u;
         /* 021C4060 */ rbrew_write_f32(cpu->mem, _t210, cpu->f[9]);
         /* 021C4064 */ _t211 = cpu->r[31] + 0x00000138u;
         /* 021C4064 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t211);
-        /* 021C4068 */ _t212 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C4068 */ _t212 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C4068 */ _t213 = _t212 & 0x00000001u;
         /* 021C4068 */ if (_t213) goto L_021C406C; else goto L_021C40D4;
   L_021C406C: ; // 0x21c406c
@@ -11651,13 +11651,13 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C4084 */ cpu->f[8] = cpu->f[8] * cpu->f[6];
         /* 021C4088 */ _t216 = cpu->r[1] + 0x0000003Cu;
         /* 021C4088 */ rbrew_write_f32(cpu->mem, _t216, cpu->f[5]);
-        /* 021C408C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[11]);
+        /* 021C408C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[11]));
         /* 021C4090 */ _t217 = cpu->r[1] + 0x00000040u;
         /* 021C4090 */ rbrew_write_f32(cpu->mem, _t217, cpu->f[8]);
         /* 021C4094 */ cpu->f[6] = cpu->f[8];
         /* 021C4098 */ _t218 = cpu->r[1] + 0x00000038u;
         /* 021C4098 */ rbrew_write_f32(cpu->mem, _t218, cpu->f[10]);
-        /* 021C409C */ _t219 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C409C */ _t219 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C409C */ _t220 = _t219 & 0x00000001u;
         /* 021C409C */ if (_t220) goto L_021C40B0; else goto L_021C40A0;
   L_021C40A0: ; // 0x21c40a0
@@ -11675,10 +11675,10 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
   L_021C40BC: ; // 0x21c40bc
         /* 021C40BC */ _t224 = cpu->r[31] + 0x00000134u;
         /* 021C40BC */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t224);
-        /* 021C40C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[7]);
+        /* 021C40C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[7]));
         /* 021C40C4 */ _t225 = cpu->r[31] + 0x00000138u;
         /* 021C40C4 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t225);
-        /* 021C40C8 */ _t226 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C40C8 */ _t226 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C40C8 */ _t227 = _t226 & 0x00000001u;
         /* 021C40C8 */ if (_t227) goto L_021C40CC; else goto L_021C40D4;
   L_021C40CC: ; // 0x21c40cc
@@ -11687,10 +11687,10 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C40D0 */ _t229 = cpu->r[1] + 0x00000038u;
         /* 021C40D0 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t229);
   L_021C40D4: ; // 0x21c40d4
-        /* 021C40D4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[5], cpu->f[9]);
+        /* 021C40D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[5], cpu->f[9]));
         /* 021C40D8 */ _t230 = cpu->r[31] + 0x0000013Cu;
         /* 021C40D8 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t230);
-        /* 021C40DC */ _t231 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C40DC */ _t231 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C40DC */ _t232 = _t231 & 0x00000001u;
         /* 021C40DC */ if (_t232) goto L_021C40E0; else goto L_021C40E8;
   L_021C40E0: ; // 0x21c40e0
@@ -11699,10 +11699,10 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C40E4 */ _t234 = cpu->r[1] + 0x0000003Cu;
         /* 021C40E4 */ cpu->f[5] = rbrew_read_f32(cpu->mem, _t234);
   L_021C40E8: ; // 0x21c40e8
-        /* 021C40E8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[11]);
+        /* 021C40E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[11]));
         /* 021C40EC */ _t235 = cpu->r[31] + 0x00000140u;
         /* 021C40EC */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t235);
-        /* 021C40F0 */ _t236 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C40F0 */ _t236 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C40F0 */ _t237 = _t236 & 0x00000001u;
         /* 021C40F0 */ if (_t237) goto L_021C40F4; else goto L_021C40FC;
   L_021C40F4: ; // 0x21c40f4
@@ -11711,28 +11711,28 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C40F8 */ _t239 = cpu->r[1] + 0x00000040u;
         /* 021C40F8 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t239);
   L_021C40FC: ; // 0x21c40fc
-        /* 021C40FC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[12]);
+        /* 021C40FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[12]));
         /* 021C4100 */ _t240 = cpu->r[31] + 0x00000144u;
         /* 021C4100 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t240);
-        /* 021C4104 */ _t241 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4104 */ _t241 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4104 */ _t242 = _t241 & 0x00000001u;
         /* 021C4104 */ if (_t242) goto L_021C4108; else goto L_021C410C;
   L_021C4108: ; // 0x21c4108
         /* 021C4108 */ _t243 = cpu->r[31] + 0x00000140u;
         /* 021C4108 */ rbrew_write_f32(cpu->mem, _t243, cpu->f[10]);
   L_021C410C: ; // 0x21c410c
-        /* 021C410C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[5], cpu->f[13]);
+        /* 021C410C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[5], cpu->f[13]));
         /* 021C4110 */ _t244 = cpu->r[31] + 0x00000148u;
         /* 021C4110 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t244);
-        /* 021C4114 */ _t245 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4114 */ _t245 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4114 */ _t246 = _t245 & 0x00000001u;
         /* 021C4114 */ if (_t246) goto L_021C4118; else goto L_021C411C;
   L_021C4118: ; // 0x21c4118
         /* 021C4118 */ _t247 = cpu->r[31] + 0x00000144u;
         /* 021C4118 */ rbrew_write_f32(cpu->mem, _t247, cpu->f[5]);
   L_021C411C: ; // 0x21c411c
-        /* 021C411C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
-        /* 021C4120 */ _t248 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C411C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
+        /* 021C4120 */ _t248 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4120 */ _t249 = _t248 & 0x00000001u;
         /* 021C4120 */ if (_t249) goto L_021C4124; else goto L_021C4128;
   L_021C4124: ; // 0x21c4124
@@ -11748,11 +11748,11 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C4138 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021C413C */ cpu->r[3] = cpu->r[31] + 0x00000084u;
         /* 021C4140 */ Gambit_fn_020510A8(cpu);
-        /* 021C4144 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 021C4144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 021C4148 */ _t253 = cpu->r[31] + 0x00000004u;
         /* 021C4148 */ cpu->r[29] = rbrew_read32(cpu->mem, _t253);
         /* 021C414C */ cpu->r[3] = cpu->r[31];
-        /* 021C4150 */ _t254 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4150 */ _t254 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4150 */ _t255 = _t254 & 0x00000001u;
         /* 021C4150 */ if (_t255) goto L_021C41B0; else goto L_021C4154;
   L_021C4154: ; // 0x21c4154
@@ -11885,7 +11885,7 @@ void Gambit_fn_021C3B50(CPUState* cpu) {
         /* 021C4280 */ cpu->r[31] = rbrew_read32(cpu->mem, _t304);
         /* 021C4284 */ _t305 = cpu->r[1] + 0x00000080u;
         /* 021C4284 */ cpu->r[30] = rbrew_read32(cpu->mem, _t305);
-        /* 021C4288 */ _t306 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C4288 */ _t306 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C4288 */ _t307 = _t306 & 0x00000001u;
         /* 021C4288 */ if (_t307) goto L_021C428C; // else: addr-0 trap, fall-through
   L_021C428C: ; // 0x21c428c
@@ -11996,10 +11996,10 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4374 */ cpu->r[15] = cpu->r[16];
         /* 021C4378 */ _t35 = cpu->r[1] + 0x00000058u;
         /* 021C4378 */ rbrew_write32(cpu->mem, _t35, cpu->r[9]);
-        /* 021C437C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021C437C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021C4380 */ _t36 = cpu->r[1] + 0x0000005Cu;
         /* 021C4380 */ rbrew_write32(cpu->mem, _t36, cpu->r[10]);
-        /* 021C4384 */ _t37 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4384 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4384 */ _t38 = _t37 & 0x00000001u;
         /* 021C4384 */ if (_t38) goto L_021C4388; else goto L_021C4390;
   L_021C4388: ; // 0x21c4388
@@ -12093,13 +12093,13 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4494 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t54);
         /* 021C4498 */ _t55 = cpu->r[27] + 0x00000004u;
         /* 021C4498 */ rbrew_write_f32(cpu->mem, _t55, cpu->f[12]);
-        /* 021C449C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000004u);
+        /* 021C449C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000004u));
         /* 021C44A0 */ _t56 = cpu->r[27] + 0x00000008u;
         /* 021C44A0 */ rbrew_write_f32(cpu->mem, _t56, cpu->f[0]);
         /* 021C44A4 */ cpu->r[19] = cpu->r[31] + 0x00000168u;
         /* 021C44A8 */ _t57 = cpu->r[26] + 0x00000008u;
         /* 021C44A8 */ rbrew_write_f32(cpu->mem, _t57, cpu->f[0]);
-        /* 021C44AC */ _t58 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C44AC */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C44AC */ _t59 = _t58 & 0x00000001u;
         /* 021C44AC */ if (_t59) goto L_021C44B0; else goto L_021C44EC;
   L_021C44B0: ; // 0x21c44b0
@@ -12117,8 +12117,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C44D4 */ cpu->r[5] = cpu->r[1] + 0x0000001Cu;
         /* 021C44D8 */ cpu->f[19] = cpu->f[1];
         /* 021C44DC */ Gambit_fn_02043998(cpu);
-        /* 021C44E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000004u);
-        /* 021C44E4 */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C44E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000004u));
+        /* 021C44E4 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C44E4 */ _t63 = _t62 & 0x00000001u;
         /* 021C44E4 */ if (_t63) goto L_021C44E8; else goto L_021C4768;
   L_021C44E8: ; // 0x21c44e8
@@ -12149,9 +12149,9 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4520 */ cpu->f[0] = cpu->f[0] + cpu->f[9];
         /* 021C4524 */ cpu->r[19] = cpu->r[19] + 0x0000000Cu;
         /* 021C4528 */ cpu->r[12] = cpu->r[12] + 0xFFFFFFFFu;
-        /* 021C4528 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021C4528 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021C452C */ cpu->f[6] = cpu->f[0];
-        /* 021C4530 */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4530 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4530 */ _t73 = _t72 & 0x00000001u;
         /* 021C4530 */ if (_t73) goto L_021C453C; else goto L_021C4534;
   L_021C4534: ; // 0x21c4534
@@ -12181,13 +12181,13 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4574 */ cpu->r[5] = cpu->r[1] + 0x0000001Cu;
         /* 021C4578 */ cpu->f[19] = cpu->f[1];
         /* 021C457C */ Gambit_fn_02043998(cpu);
-        /* 021C4580 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000004u);
-        /* 021C4584 */ _t80 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4580 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000004u));
+        /* 021C4584 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4584 */ _t81 = _t80 & 0x00000001u;
         /* 021C4584 */ if (_t81) goto L_021C4588; else goto L_021C4768;
   L_021C4588: ; // 0x21c4588
-        /* 021C4588 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[17], 0x00000000u);
-        /* 021C458C */ _t82 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4588 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[17], 0x00000000u));
+        /* 021C458C */ _t82 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C458C */ _t83 = _t82 & 0x00000001u;
         /* 021C458C */ if (_t83) goto L_021C4768; else goto L_021C4590;
   L_021C4590: ; // 0x21c4590
@@ -12207,10 +12207,10 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C45B4 */ cpu->f[6] = cpu->f[0] - cpu->f[7];
         /* 021C45B8 */ cpu->f[12] = fma(cpu->f[11], cpu->f[11], cpu->f[9]);
         /* 021C45BC */ cpu->f[20] = fma(cpu->f[6], cpu->f[6], cpu->f[12]);
-        /* 021C45C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[20], cpu->f[25]);
+        /* 021C45C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[20], cpu->f[25]));
         /* 021C45C4 */ _t88 = cpu->r[1] + 0x00000028u;
         /* 021C45C4 */ rbrew_write_f32(cpu->mem, _t88, cpu->f[6]);
-        /* 021C45C8 */ _t89 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C45C8 */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C45C8 */ _t90 = _t89 & 0x00000001u;
         /* 021C45C8 */ if (_t90) goto L_021C45CC; else goto L_021C4604;
   L_021C45CC: ; // 0x21c45cc
@@ -12234,13 +12234,13 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4600 */ _t95 = cpu->r[1] + 0x00000028u;
         /* 021C4600 */ rbrew_write_f32(cpu->mem, _t95, cpu->f[7]);
   L_021C4604: ; // 0x21c4604
-        /* 021C4604 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[20], cpu->f[25]);
-        /* 021C4608 */ _t96 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[20], cpu->f[25]));
+        /* 021C4608 */ _t96 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4608 */ _t97 = _t96 & 0x00000001u;
         /* 021C4608 */ if (_t97) goto L_021C460C; else goto L_021C4768;
   L_021C460C: ; // 0x21c460c
         /* 021C460C */ cpu->r[6] = 0x10030000u;
-        /* 021C4610 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[20], cpu->f[25]);
+        /* 021C4610 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[20], cpu->f[25]));
         /* 021C4614 */ _t98 = cpu->r[6] + 0xFFFFB70Cu;
         /* 021C4614 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t98);
         /* 021C4618 */ cpu->f[3] = cpu->f[29];
@@ -12248,7 +12248,7 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4620 */ _t99 = cpu->r[21] + 0x00000000u;
         /* 021C4620 */ cpu->r[3] = rbrew_read32(cpu->mem, _t99);
         /* 021C4624 */ cpu->f[18] = cpu->f[19] / cpu->f[9];
-        /* 021C4628 */ _t100 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4628 */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4628 */ _t101 = _t100 & 0x00000001u;
         /* 021C4628 */ if (_t101) goto L_021C4668; else goto L_021C462C;
   L_021C462C: ; // 0x21c462c
@@ -12266,10 +12266,10 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4650 */ rbrew_write32(cpu->mem, _t103, cpu->r[12]);
         /* 021C4654 */ Gambit_fn_0204A4DC(cpu);
         /* 021C4658 */ cpu->r[11] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C4658 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021C4658 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021C465C */ _t104 = cpu->r[1] + 0x0000002Cu;
         /* 021C465C */ rbrew_write32(cpu->mem, _t104, cpu->r[3]);
-        /* 021C4660 */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4660 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4660 */ _t106 = _t105 & 0x00000001u;
         /* 021C4660 */ if (_t106) goto L_021C4768; else goto L_021C4664;
   L_021C4664: ; // 0x21c4664
@@ -12286,28 +12286,28 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4684 */ cpu->r[9] = cpu->r[1] + 0x0000002Cu;
         /* 021C4688 */ Gambit_fn_0204A864(cpu);
         /* 021C468C */ cpu->r[11] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C468C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021C468C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021C4690 */ _t108 = cpu->r[1] + 0x0000002Cu;
         /* 021C4690 */ rbrew_write32(cpu->mem, _t108, cpu->r[3]);
-        /* 021C4694 */ _t109 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4694 */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4694 */ _t110 = _t109 & 0x00000001u;
         /* 021C4694 */ if (_t110) goto L_021C4768; else goto L_021C4698;
   L_021C4698: ; // 0x21c4698
         /* 021C4698 */ _t111 = cpu->r[31] + 0x000001CCu;
         /* 021C4698 */ cpu->r[0] = rbrew_read32(cpu->mem, _t111);
         /* 021C469C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000015u, 0x00000015u);
-        /* 021C469C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021C469C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021C46A0 */ _t112 = cpu->r[1] + 0x00000030u;
         /* 021C46A0 */ cpu->r[19] = rbrew_read32(cpu->mem, _t112);
-        /* 021C46A4 */ _t113 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C46A4 */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C46A4 */ _t114 = _t113 & 0x00000001u;
         /* 021C46A4 */ if (_t114) goto L_021C46DC; else goto L_021C46A8;
   L_021C46A8: ; // 0x21c46a8
         /* 021C46A8 */ _t115 = cpu->r[19] + 0x0000015Cu;
         /* 021C46A8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t115);
         /* 021C46AC */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021C46AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021C46B0 */ _t116 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C46AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021C46B0 */ _t116 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C46B0 */ _t117 = _t116 & 0x00000001u;
         /* 021C46B0 */ if (_t117) goto L_021C46E0; else goto L_021C46B4;
   L_021C46B4: ; // 0x21c46b4
@@ -12319,8 +12319,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C46C8 */ cpu->r[6] = cpu->r[1] + 0x00000020u;
         /* 021C46CC */ cpu->r[3] = cpu->r[31];
         /* 021C46D0 */ Gambit_fn_021C2660(cpu);
-        /* 021C46D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C46D8 */ _t118 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C46D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C46D8 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C46D8 */ _t119 = _t118 & 0x00000001u;
         /* 021C46D8 */ if (_t119) goto L_021C46DC; else goto L_021C4F30;
   L_021C46DC: ; // 0x21c46dc
@@ -12330,14 +12330,14 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C46E0 */ _t121 = cpu->r[31] + 0x000001CCu;
         /* 021C46E0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t121);
         /* 021C46E4 */ cpu->r[8] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 021C46E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021C46E8 */ _t122 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C46E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021C46E8 */ _t122 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C46E8 */ _t123 = _t122 & 0x00000001u;
         /* 021C46E8 */ if (_t123) goto L_021C4720; else goto L_021C46EC;
   L_021C46EC: ; // 0x21c46ec
         /* 021C46EC */ cpu->r[10] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 021C46EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021C46F0 */ _t124 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C46EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021C46F0 */ _t124 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C46F0 */ _t125 = _t124 & 0x00000001u;
         /* 021C46F0 */ if (_t125) goto L_021C4720; else goto L_021C46F4;
   L_021C46F4: ; // 0x21c46f4
@@ -12349,8 +12349,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4708 */ cpu->r[6] = cpu->r[1] + 0x00000020u;
         /* 021C470C */ cpu->r[3] = cpu->r[31];
         /* 021C4710 */ Gambit_fn_021C2660(cpu);
-        /* 021C4714 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C4718 */ _t126 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4714 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C4718 */ _t126 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4718 */ _t127 = _t126 & 0x00000001u;
         /* 021C4718 */ if (_t127) goto L_021C471C; else goto L_021C4F30;
   L_021C471C: ; // 0x21c471c
@@ -12358,8 +12358,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C471C */ cpu->r[0] = rbrew_read32(cpu->mem, _t128);
   L_021C4720: ; // 0x21c4720
         /* 021C4720 */ cpu->r[4] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021C4720 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 021C4724 */ _t129 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4720 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 021C4724 */ _t129 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4724 */ _t130 = _t129 & 0x00000001u;
         /* 021C4724 */ if (_t130) goto L_021C4754; else goto L_021C4728;
   L_021C4728: ; // 0x21c4728
@@ -12375,16 +12375,16 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C473C */ cpu->ctr = cpu->r[11];
         /* 021C4740 */ cpu->r[3] = cpu->r[31];
         /* 021C4744 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021C4748 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C474C */ _t135 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4748 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C474C */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C474C */ _t136 = _t135 & 0x00000001u;
         /* 021C474C */ if (_t136) goto L_021C4784; else goto L_021C4750;
   L_021C4750: ; // 0x21c4750
         /* 021C4750 */ goto L_021C51B4;
   L_021C4754: ; // 0x21c4754
         /* 021C4754 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 021C4754 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021C4758 */ _t137 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4754 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021C4758 */ _t137 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4758 */ _t138 = _t137 & 0x00000001u;
         /* 021C4758 */ if (_t138) goto L_021C4768; else goto L_021C475C;
   L_021C475C: ; // 0x21c475c
@@ -12401,18 +12401,18 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4770 */ cpu->ctr = cpu->r[11];
         /* 021C4774 */ cpu->r[3] = cpu->r[31];
         /* 021C4778 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021C477C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C4780 */ _t143 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C477C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C4780 */ _t143 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4780 */ _t144 = _t143 & 0x00000001u;
         /* 021C4780 */ if (_t144) goto L_021C4784; else goto L_021C51B4;
   L_021C4784: ; // 0x21c4784
         /* 021C4784 */ _t145 = cpu->r[1] + 0x0000001Cu;
         /* 021C4784 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t145);
-        /* 021C4788 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[25]);
+        /* 021C4788 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[25]));
         /* 021C478C */ _t146 = cpu->r[21] + 0x00000000u;
         /* 021C478C */ cpu->r[3] = rbrew_read32(cpu->mem, _t146);
         /* 021C4790 */ cpu->f[3] = cpu->f[29];
-        /* 021C4794 */ _t147 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4794 */ _t147 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4794 */ _t148 = _t147 & 0x00000001u;
         /* 021C4794 */ if (_t148) goto L_021C47D8; else goto L_021C4798;
   L_021C4798: ; // 0x21c4798
@@ -12431,10 +12431,10 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C47C0 */ rbrew_write32(cpu->mem, _t150, cpu->r[12]);
         /* 021C47C4 */ Gambit_fn_0204A4DC(cpu);
         /* 021C47C8 */ cpu->r[5] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C47C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021C47C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021C47CC */ _t151 = cpu->r[1] + 0x0000002Cu;
         /* 021C47CC */ rbrew_write32(cpu->mem, _t151, cpu->r[3]);
-        /* 021C47D0 */ _t152 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C47D0 */ _t152 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C47D0 */ _t153 = _t152 & 0x00000001u;
         /* 021C47D0 */ if (_t153) goto L_021C51A0; else goto L_021C47D4;
   L_021C47D4: ; // 0x21c47d4
@@ -12451,10 +12451,10 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C47F4 */ cpu->r[9] = cpu->r[1] + 0x0000002Cu;
         /* 021C47F8 */ Gambit_fn_0204A864(cpu);
         /* 021C47FC */ cpu->r[5] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C47FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021C47FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021C4800 */ _t155 = cpu->r[1] + 0x0000002Cu;
         /* 021C4800 */ rbrew_write32(cpu->mem, _t155, cpu->r[3]);
-        /* 021C4804 */ _t156 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4804 */ _t156 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4804 */ _t157 = _t156 & 0x00000001u;
         /* 021C4804 */ if (_t157) goto L_021C51A0; else goto L_021C4808;
   L_021C4808: ; // 0x21c4808
@@ -12467,12 +12467,12 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4818 */ cpu->r[8] = rbrew_read32(cpu->mem, _t159);
         /* 021C481C */ /* nop */
         /* 021C4820 */ cpu->r[7] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x00000004u, 0x00000004u);
-        /* 021C4820 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021C4820 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021C4824 */ _t160 = cpu->r[1] + 0x0000001Cu;
         /* 021C4824 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t160);
         /* 021C4828 */ _t161 = cpu->r[1] + 0x00000050u;
         /* 021C4828 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t161);
-        /* 021C482C */ _t162 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C482C */ _t162 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C482C */ _t163 = _t162 & 0x00000001u;
         /* 021C482C */ if (_t163) goto L_021C48B8; else goto L_021C4830;
   L_021C4830: ; // 0x21c4830
@@ -12531,8 +12531,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C48A8 */ _t186 = cpu->r[19] + 0x00000168u;
         /* 021C48A8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t186);
         /* 021C48AC */ cpu->r[7] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000004u, 0x00000004u);
-        /* 021C48AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021C48B0 */ _t187 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C48AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021C48B0 */ _t187 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C48B0 */ _t188 = _t187 & 0x00000001u;
         /* 021C48B0 */ if (_t188) goto L_021C4988; else goto L_021C48B4;
   L_021C48B4: ; // 0x21c48b4
@@ -12591,8 +12591,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C492C */ _t210 = cpu->r[19] + 0x00000168u;
         /* 021C492C */ cpu->r[0] = rbrew_read32(cpu->mem, _t210);
         /* 021C4930 */ cpu->r[7] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000004u, 0x00000004u);
-        /* 021C4930 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021C4934 */ _t211 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4930 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021C4934 */ _t211 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4934 */ _t212 = _t211 & 0x00000001u;
         /* 021C4934 */ if (_t212) goto L_021C4988; else goto L_021C4938;
   L_021C4938: ; // 0x21c4938
@@ -12622,12 +12622,12 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C496C */ rbrew_write32(cpu->mem, _t222, cpu->r[5]);
         /* 021C4970 */ _t223 = cpu->r[1] + 0x00000040u;
         /* 021C4970 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t223);
-        /* 021C4974 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[11]);
+        /* 021C4974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[11]));
         /* 021C4978 */ _t224 = cpu->r[1] + 0x00000044u;
         /* 021C4978 */ rbrew_write32(cpu->mem, _t224, cpu->r[6]);
         /* 021C497C */ _t225 = cpu->r[31] + 0x00000138u;
         /* 021C497C */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t225);
-        /* 021C4980 */ _t226 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C4980 */ _t226 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C4980 */ _t227 = _t226 & 0x00000001u;
         /* 021C4980 */ if (_t227) goto L_021C4984; else goto L_021C49D8;
   L_021C4984: ; // 0x21c4984
@@ -12657,12 +12657,12 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C49B8 */ rbrew_write32(cpu->mem, _t236, cpu->r[5]);
         /* 021C49BC */ _t237 = cpu->r[1] + 0x00000040u;
         /* 021C49BC */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t237);
-        /* 021C49C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[11]);
+        /* 021C49C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[11]));
         /* 021C49C4 */ _t238 = cpu->r[1] + 0x00000044u;
         /* 021C49C4 */ rbrew_write32(cpu->mem, _t238, cpu->r[6]);
         /* 021C49C8 */ _t239 = cpu->r[31] + 0x00000138u;
         /* 021C49C8 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t239);
-        /* 021C49CC */ _t240 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C49CC */ _t240 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C49CC */ _t241 = _t240 & 0x00000001u;
         /* 021C49CC */ if (_t241) goto L_021C49D0; else goto L_021C49D8;
   L_021C49D0: ; // 0x21c49d0
@@ -12671,12 +12671,12 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C49D4 */ _t243 = cpu->r[1] + 0x0000003Cu;
         /* 021C49D4 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t243);
   L_021C49D8: ; // 0x21c49d8
-        /* 021C49D8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[12]);
+        /* 021C49D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[12]));
         /* 021C49DC */ _t244 = cpu->r[1] + 0x00000044u;
         /* 021C49DC */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t244);
         /* 021C49E0 */ _t245 = cpu->r[31] + 0x0000013Cu;
         /* 021C49E0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t245);
-        /* 021C49E4 */ _t246 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C49E4 */ _t246 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C49E4 */ _t247 = _t246 & 0x00000001u;
         /* 021C49E4 */ if (_t247) goto L_021C49E8; else goto L_021C49F0;
   L_021C49E8: ; // 0x21c49e8
@@ -12685,10 +12685,10 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C49EC */ _t249 = cpu->r[1] + 0x00000040u;
         /* 021C49EC */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t249);
   L_021C49F0: ; // 0x21c49f0
-        /* 021C49F0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
+        /* 021C49F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
         /* 021C49F4 */ _t250 = cpu->r[31] + 0x00000140u;
         /* 021C49F4 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t250);
-        /* 021C49F8 */ _t251 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C49F8 */ _t251 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C49F8 */ _t252 = _t251 & 0x00000001u;
         /* 021C49F8 */ if (_t252) goto L_021C49FC; else goto L_021C4A04;
   L_021C49FC: ; // 0x21c49fc
@@ -12697,18 +12697,18 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4A00 */ _t254 = cpu->r[1] + 0x00000044u;
         /* 021C4A00 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t254);
   L_021C4A04: ; // 0x21c4a04
-        /* 021C4A04 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[6]);
+        /* 021C4A04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[6]));
         /* 021C4A08 */ _t255 = cpu->r[31] + 0x00000144u;
         /* 021C4A08 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t255);
-        /* 021C4A0C */ _t256 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4A0C */ _t256 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4A0C */ _t257 = _t256 & 0x00000001u;
         /* 021C4A0C */ if (_t257) goto L_021C4A10; else goto L_021C4A14;
   L_021C4A10: ; // 0x21c4a10
         /* 021C4A10 */ _t258 = cpu->r[31] + 0x00000140u;
         /* 021C4A10 */ rbrew_write_f32(cpu->mem, _t258, cpu->f[13]);
   L_021C4A14: ; // 0x21c4a14
-        /* 021C4A14 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[7]);
-        /* 021C4A18 */ _t259 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4A14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[7]));
+        /* 021C4A18 */ _t259 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4A18 */ _t260 = _t259 & 0x00000001u;
         /* 021C4A18 */ if (_t260) goto L_021C4A1C; else goto L_021C4A20;
   L_021C4A1C: ; // 0x21c4a1c
@@ -12717,8 +12717,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
   L_021C4A20: ; // 0x21c4a20
         /* 021C4A20 */ _t262 = cpu->r[31] + 0x00000148u;
         /* 021C4A20 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t262);
-        /* 021C4A24 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[8]);
-        /* 021C4A28 */ _t263 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4A24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[8]));
+        /* 021C4A28 */ _t263 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4A28 */ _t264 = _t263 & 0x00000001u;
         /* 021C4A28 */ if (_t264) goto L_021C4A2C; else goto L_021C4A30;
   L_021C4A2C: ; // 0x21c4a2c
@@ -12727,8 +12727,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
   L_021C4A30: ; // 0x21c4a30
         /* 021C4A30 */ _t266 = cpu->r[19] + 0x00000040u;
         /* 021C4A30 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t266);
-        /* 021C4A34 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[25], cpu->f[10]);
-        /* 021C4A38 */ _t267 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4A34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[25], cpu->f[10]));
+        /* 021C4A38 */ _t267 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4A38 */ _t268 = _t267 & 0x00000001u;
         /* 021C4A38 */ if (_t268) goto L_021C4A60; else goto L_021C4A3C;
   L_021C4A3C: ; // 0x21c4a3c
@@ -12737,7 +12737,7 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4A40 */ _t270 = cpu->r[19] + 0x00000038u;
         /* 021C4A40 */ rbrew_write_f32(cpu->mem, _t270, cpu->f[25]);
         /* 021C4A44 */ cpu->r[4] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 021C4A44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 021C4A44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 021C4A48 */ _t271 = cpu->r[19] + 0x0000003Cu;
         /* 021C4A48 */ rbrew_write_f32(cpu->mem, _t271, cpu->f[25]);
         /* 021C4A4C */ _t272 = cpu->r[19] + 0x00000034u;
@@ -12745,7 +12745,7 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4A50 */ cpu->r[12] = cpu->r[19] + 0x00000034u;
         /* 021C4A54 */ _t273 = cpu->r[19] + 0x00000040u;
         /* 021C4A54 */ rbrew_write_f32(cpu->mem, _t273, cpu->f[25]);
-        /* 021C4A58 */ _t274 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4A58 */ _t274 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4A58 */ _t275 = _t274 & 0x00000001u;
         /* 021C4A58 */ if (_t275) goto L_021C4A5C; else goto L_021C4AA4;
   L_021C4A5C: ; // 0x21c4a5c
@@ -12754,8 +12754,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4A60 */ _t276 = cpu->r[19] + 0x00000000u;
         /* 021C4A60 */ cpu->r[12] = rbrew_read32(cpu->mem, _t276);
         /* 021C4A64 */ cpu->r[11] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x0000001Bu, 0x0000001Cu);
-        /* 021C4A64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021C4A68 */ _t277 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4A64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021C4A68 */ _t277 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4A68 */ _t278 = _t277 & 0x00000001u;
         /* 021C4A68 */ if (_t278) goto L_021C4A6C; else goto L_021C4A88;
   L_021C4A6C: ; // 0x21c4a6c
@@ -12763,11 +12763,11 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4A6C */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t279);
         /* 021C4A70 */ _t280 = cpu->r[31] + 0x00000134u;
         /* 021C4A70 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t280);
-        /* 021C4A74 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[11]);
+        /* 021C4A74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[11]));
         /* 021C4A78 */ _t281 = cpu->r[31] + 0x00000138u;
         /* 021C4A78 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t281);
         /* 021C4A7C */ cpu->r[12] = cpu->r[19] + 0x00000034u;
-        /* 021C4A80 */ _t282 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C4A80 */ _t282 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C4A80 */ _t283 = _t282 & 0x00000001u;
         /* 021C4A80 */ if (_t283) goto L_021C4A84; else goto L_021C4C34;
   L_021C4A84: ; // 0x21c4a84
@@ -12778,13 +12778,13 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4A8C */ _t285 = cpu->r[19] + 0x00000038u;
         /* 021C4A8C */ rbrew_write_f32(cpu->mem, _t285, cpu->f[25]);
         /* 021C4A90 */ cpu->r[4] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 021C4A90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 021C4A90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 021C4A94 */ _t286 = cpu->r[19] + 0x00000034u;
         /* 021C4A94 */ rbrew_write_f32(cpu->mem, _t286, cpu->f[25]);
         /* 021C4A98 */ cpu->r[12] = cpu->r[19] + 0x00000034u;
         /* 021C4A9C */ _t287 = cpu->r[19] + 0x0000003Cu;
         /* 021C4A9C */ rbrew_write_f32(cpu->mem, _t287, cpu->f[25]);
-        /* 021C4AA0 */ _t288 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4AA0 */ _t288 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4AA0 */ _t289 = _t288 & 0x00000001u;
         /* 021C4AA0 */ if (_t289) goto L_021C4AC8; else goto L_021C4AA4;
   L_021C4AA4: ; // 0x21c4aa4
@@ -12803,8 +12803,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4AC4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t293);
   L_021C4AC8: ; // 0x21c4ac8
         /* 021C4AC8 */ cpu->r[10] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Bu, 0x0000001Bu);
-        /* 021C4AC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021C4ACC */ _t294 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4AC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021C4ACC */ _t294 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4ACC */ _t295 = _t294 & 0x00000001u;
         /* 021C4ACC */ if (_t295) goto L_021C4C14; else goto L_021C4AD0;
   L_021C4AD0: ; // 0x21c4ad0
@@ -12812,12 +12812,12 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4AD0 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t296);
         /* 021C4AD4 */ _t297 = cpu->r[19] + 0x00000040u;
         /* 021C4AD4 */ cpu->f[5] = rbrew_read_f32(cpu->mem, _t297);
-        /* 021C4AD8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[25]);
+        /* 021C4AD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[25]));
         /* 021C4ADC */ _t298 = cpu->r[19] + 0x0000001Cu;
         /* 021C4ADC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t298);
         /* 021C4AE0 */ _t299 = cpu->r[19] + 0x00000028u;
         /* 021C4AE0 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t299);
-        /* 021C4AE4 */ _t300 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4AE4 */ _t300 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4AE4 */ _t301 = _t300 & 0x00000001u;
         /* 021C4AE4 */ if (_t301) goto L_021C4AE8; else goto L_021C4B0C;
   L_021C4AE8: ; // 0x21c4ae8
@@ -12825,20 +12825,20 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4AEC */ _t302 = cpu->r[12] + 0x00000004u;
         /* 021C4AEC */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t302);
         /* 021C4AF0 */ /* nop */
-        /* 021C4AF4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[25]);
+        /* 021C4AF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[25]));
         /* 021C4AF8 */ _t303 = cpu->r[19] + 0x00000020u;
         /* 021C4AF8 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t303);
         /* 021C4AFC */ cpu->f[4] = fma(cpu->f[0], cpu->f[5], cpu->f[9]);
         /* 021C4B00 */ _t304 = cpu->r[19] + 0x0000002Cu;
         /* 021C4B00 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t304);
-        /* 021C4B04 */ _t305 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4B04 */ _t305 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4B04 */ _t306 = _t305 & 0x00000001u;
         /* 021C4B04 */ if (_t306) goto L_021C4B08; else goto L_021C4B74;
   L_021C4B08: ; // 0x21c4b08
         /* 021C4B08 */ goto L_021C4B50;
   L_021C4B0C: ; // 0x21c4b0c
-        /* 021C4B0C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[25]);
-        /* 021C4B10 */ _t307 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C4B0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[25]));
+        /* 021C4B10 */ _t307 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C4B10 */ _t308 = _t307 & 0x00000001u;
         /* 021C4B10 */ if (_t308) goto L_021C4B14; else goto L_021C4B38;
   L_021C4B14: ; // 0x21c4b14
@@ -12846,13 +12846,13 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4B18 */ _t309 = cpu->r[12] + 0x00000004u;
         /* 021C4B18 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t309);
         /* 021C4B1C */ /* nop */
-        /* 021C4B20 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[25]);
+        /* 021C4B20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[25]));
         /* 021C4B24 */ _t310 = cpu->r[19] + 0x0000002Cu;
         /* 021C4B24 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t310);
         /* 021C4B28 */ cpu->f[4] = fma(cpu->f[7], cpu->f[5], cpu->f[12]);
         /* 021C4B2C */ _t311 = cpu->r[19] + 0x00000020u;
         /* 021C4B2C */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t311);
-        /* 021C4B30 */ _t312 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4B30 */ _t312 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4B30 */ _t313 = _t312 & 0x00000001u;
         /* 021C4B30 */ if (_t313) goto L_021C4B34; else goto L_021C4B74;
   L_021C4B34: ; // 0x21c4b34
@@ -12863,10 +12863,10 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4B3C */ cpu->f[4] = cpu->f[0] + cpu->f[7];
         /* 021C4B40 */ _t315 = cpu->r[19] + 0x0000002Cu;
         /* 021C4B40 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t315);
-        /* 021C4B44 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[25]);
+        /* 021C4B44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[25]));
         /* 021C4B48 */ _t316 = cpu->r[19] + 0x00000020u;
         /* 021C4B48 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t316);
-        /* 021C4B4C */ _t317 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4B4C */ _t317 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4B4C */ _t318 = _t317 & 0x00000001u;
         /* 021C4B4C */ if (_t318) goto L_021C4B50; else goto L_021C4B74;
   L_021C4B50: ; // 0x21c4b50
@@ -12874,20 +12874,20 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4B54 */ _t319 = cpu->r[12] + 0x00000008u;
         /* 021C4B54 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t319);
         /* 021C4B58 */ /* nop */
-        /* 021C4B5C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[25]);
+        /* 021C4B5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[25]));
         /* 021C4B60 */ _t320 = cpu->r[19] + 0x00000030u;
         /* 021C4B60 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t320);
         /* 021C4B64 */ cpu->f[13] = fma(cpu->f[7], cpu->f[5], cpu->f[12]);
         /* 021C4B68 */ _t321 = cpu->r[19] + 0x00000024u;
         /* 021C4B68 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t321);
-        /* 021C4B6C */ _t322 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4B6C */ _t322 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4B6C */ _t323 = _t322 & 0x00000001u;
         /* 021C4B6C */ if (_t323) goto L_021C4B70; else goto L_021C4BD8;
   L_021C4B70: ; // 0x21c4b70
         /* 021C4B70 */ goto L_021C4BB8;
   L_021C4B74: ; // 0x21c4b74
-        /* 021C4B74 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[25]);
-        /* 021C4B78 */ _t324 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C4B74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[25]));
+        /* 021C4B78 */ _t324 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C4B78 */ _t325 = _t324 & 0x00000001u;
         /* 021C4B78 */ if (_t325) goto L_021C4B7C; else goto L_021C4BA0;
   L_021C4B7C: ; // 0x21c4b7c
@@ -12895,13 +12895,13 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4B80 */ _t326 = cpu->r[12] + 0x00000008u;
         /* 021C4B80 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t326);
         /* 021C4B84 */ /* nop */
-        /* 021C4B88 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[25]);
+        /* 021C4B88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[25]));
         /* 021C4B8C */ _t327 = cpu->r[19] + 0x00000030u;
         /* 021C4B8C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t327);
         /* 021C4B90 */ cpu->f[13] = fma(cpu->f[9], cpu->f[5], cpu->f[11]);
         /* 021C4B94 */ _t328 = cpu->r[19] + 0x00000024u;
         /* 021C4B94 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t328);
-        /* 021C4B98 */ _t329 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4B98 */ _t329 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4B98 */ _t330 = _t329 & 0x00000001u;
         /* 021C4B98 */ if (_t330) goto L_021C4B9C; else goto L_021C4BD8;
   L_021C4B9C: ; // 0x21c4b9c
@@ -12912,10 +12912,10 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4BA4 */ cpu->f[13] = cpu->f[7] + cpu->f[9];
         /* 021C4BA8 */ _t332 = cpu->r[19] + 0x00000030u;
         /* 021C4BA8 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t332);
-        /* 021C4BAC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[25]);
+        /* 021C4BAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[25]));
         /* 021C4BB0 */ _t333 = cpu->r[19] + 0x00000024u;
         /* 021C4BB0 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t333);
-        /* 021C4BB4 */ _t334 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4BB4 */ _t334 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4BB4 */ _t335 = _t334 & 0x00000001u;
         /* 021C4BB4 */ if (_t335) goto L_021C4BB8; else goto L_021C4BD8;
   L_021C4BB8: ; // 0x21c4bb8
@@ -12932,8 +12932,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4BD0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t339);
         /* 021C4BD4 */ goto L_021C4C14;
   L_021C4BD8: ; // 0x21c4bd8
-        /* 021C4BD8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[25]);
-        /* 021C4BDC */ _t340 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C4BD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[25]));
+        /* 021C4BDC */ _t340 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C4BDC */ _t341 = _t340 & 0x00000001u;
         /* 021C4BDC */ if (_t341) goto L_021C4BE0; else goto L_021C4C00;
   L_021C4BE0: ; // 0x21c4be0
@@ -12967,10 +12967,10 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4C1C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t351);
         /* 021C4C20 */ _t352 = cpu->r[12] + 0x00000000u;
         /* 021C4C20 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t352);
-        /* 021C4C24 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[11]);
+        /* 021C4C24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[11]));
         /* 021C4C28 */ _t353 = cpu->r[31] + 0x00000138u;
         /* 021C4C28 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t353);
-        /* 021C4C2C */ _t354 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C4C2C */ _t354 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C4C2C */ _t355 = _t354 & 0x00000001u;
         /* 021C4C2C */ if (_t355) goto L_021C4C30; else goto L_021C4C34;
   L_021C4C30: ; // 0x21c4c30
@@ -12979,10 +12979,10 @@ void Gambit_fn_021C429C(CPUState* cpu) {
   L_021C4C34: ; // 0x21c4c34
         /* 021C4C34 */ _t357 = cpu->r[12] + 0x00000004u;
         /* 021C4C34 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t357);
-        /* 021C4C38 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[12]);
+        /* 021C4C38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[12]));
         /* 021C4C3C */ _t358 = cpu->r[31] + 0x0000013Cu;
         /* 021C4C3C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t358);
-        /* 021C4C40 */ _t359 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C4C40 */ _t359 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C4C40 */ _t360 = _t359 & 0x00000001u;
         /* 021C4C40 */ if (_t360) goto L_021C4C44; else goto L_021C4C48;
   L_021C4C44: ; // 0x21c4c44
@@ -12991,10 +12991,10 @@ void Gambit_fn_021C429C(CPUState* cpu) {
   L_021C4C48: ; // 0x21c4c48
         /* 021C4C48 */ _t362 = cpu->r[12] + 0x00000008u;
         /* 021C4C48 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t362);
-        /* 021C4C4C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[13]);
+        /* 021C4C4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[13]));
         /* 021C4C50 */ _t363 = cpu->r[31] + 0x00000140u;
         /* 021C4C50 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t363);
-        /* 021C4C54 */ _t364 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C4C54 */ _t364 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C4C54 */ _t365 = _t364 & 0x00000001u;
         /* 021C4C54 */ if (_t365) goto L_021C4C58; else goto L_021C4C5C;
   L_021C4C58: ; // 0x21c4c58
@@ -13003,10 +13003,10 @@ void Gambit_fn_021C429C(CPUState* cpu) {
   L_021C4C5C: ; // 0x21c4c5c
         /* 021C4C5C */ _t367 = cpu->r[12] + 0x00000000u;
         /* 021C4C5C */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t367);
-        /* 021C4C60 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
+        /* 021C4C60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
         /* 021C4C64 */ _t368 = cpu->r[31] + 0x00000144u;
         /* 021C4C64 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t368);
-        /* 021C4C68 */ _t369 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4C68 */ _t369 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4C68 */ _t370 = _t369 & 0x00000001u;
         /* 021C4C68 */ if (_t370) goto L_021C4C6C; else goto L_021C4C70;
   L_021C4C6C: ; // 0x21c4c6c
@@ -13015,10 +13015,10 @@ void Gambit_fn_021C429C(CPUState* cpu) {
   L_021C4C70: ; // 0x21c4c70
         /* 021C4C70 */ _t372 = cpu->r[12] + 0x00000004u;
         /* 021C4C70 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t372);
-        /* 021C4C74 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[6]);
+        /* 021C4C74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[6]));
         /* 021C4C78 */ _t373 = cpu->r[31] + 0x00000148u;
         /* 021C4C78 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t373);
-        /* 021C4C7C */ _t374 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4C7C */ _t374 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4C7C */ _t375 = _t374 & 0x00000001u;
         /* 021C4C7C */ if (_t375) goto L_021C4C80; else goto L_021C4C84;
   L_021C4C80: ; // 0x21c4c80
@@ -13027,31 +13027,31 @@ void Gambit_fn_021C429C(CPUState* cpu) {
   L_021C4C84: ; // 0x21c4c84
         /* 021C4C84 */ _t377 = cpu->r[12] + 0x00000008u;
         /* 021C4C84 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t377);
-        /* 021C4C88 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[7]);
-        /* 021C4C8C */ _t378 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4C88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[7]));
+        /* 021C4C8C */ _t378 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4C8C */ _t379 = _t378 & 0x00000001u;
         /* 021C4C8C */ if (_t379) goto L_021C4C90; else goto L_021C4C94;
   L_021C4C90: ; // 0x21c4c90
         /* 021C4C90 */ _t380 = cpu->r[31] + 0x00000148u;
         /* 021C4C90 */ rbrew_write_f32(cpu->mem, _t380, cpu->f[12]);
   L_021C4C94: ; // 0x21c4c94
-        /* 021C4C94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000004u);
-        /* 021C4C98 */ _t381 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C4C94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000004u));
+        /* 021C4C98 */ _t381 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C4C98 */ _t382 = _t381 & 0x00000001u;
         /* 021C4C98 */ if (_t382) goto L_021C4C9C; else goto L_021C4E88;
   L_021C4C9C: ; // 0x21c4c9c
         /* 021C4C9C */ _t383 = cpu->r[19] + 0x0000015Cu;
         /* 021C4C9C */ cpu->r[0] = rbrew_read32(cpu->mem, _t383);
         /* 021C4CA0 */ cpu->r[11] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021C4CA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021C4CA4 */ _t384 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4CA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021C4CA4 */ _t384 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4CA4 */ _t385 = _t384 & 0x00000001u;
         /* 021C4CA4 */ if (_t385) goto L_021C4E88; else goto L_021C4CA8;
   L_021C4CA8: ; // 0x21c4ca8
         /* 021C4CA8 */ _t386 = cpu->r[19] + 0x00000040u;
         /* 021C4CA8 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t386);
-        /* 021C4CAC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[25], cpu->f[12]);
-        /* 021C4CB0 */ _t387 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4CAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[25], cpu->f[12]));
+        /* 021C4CB0 */ _t387 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4CB0 */ _t388 = _t387 & 0x00000001u;
         /* 021C4CB0 */ if (_t388) goto L_021C4CD4; else goto L_021C4CB4;
   L_021C4CB4: ; // 0x21c4cb4
@@ -13066,8 +13066,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4CC4 */ _t393 = cpu->r[19] + 0x00000000u;
         /* 021C4CC4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t393);
         /* 021C4CC8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 021C4CC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021C4CCC */ _t394 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4CC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021C4CCC */ _t394 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4CCC */ _t395 = _t394 & 0x00000001u;
         /* 021C4CCC */ if (_t395) goto L_021C4CD0; else goto L_021C4CF8;
   L_021C4CD0: ; // 0x21c4cd0
@@ -13076,8 +13076,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4CD4 */ _t396 = cpu->r[19] + 0x00000000u;
         /* 021C4CD4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t396);
         /* 021C4CD8 */ cpu->r[7] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x0000001Bu, 0x0000001Cu);
-        /* 021C4CD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021C4CDC */ _t397 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4CD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021C4CDC */ _t397 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4CDC */ _t398 = _t397 & 0x00000001u;
         /* 021C4CDC */ if (_t398) goto L_021C4E70; else goto L_021C4CE0;
   L_021C4CE0: ; // 0x21c4ce0
@@ -13090,8 +13090,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4CEC */ _t402 = cpu->r[19] + 0x00000000u;
         /* 021C4CEC */ cpu->r[5] = rbrew_read32(cpu->mem, _t402);
         /* 021C4CF0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 021C4CF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021C4CF4 */ _t403 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4CF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021C4CF4 */ _t403 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4CF4 */ _t404 = _t403 & 0x00000001u;
         /* 021C4CF4 */ if (_t404) goto L_021C4D1C; else goto L_021C4CF8;
   L_021C4CF8: ; // 0x21c4cf8
@@ -13110,8 +13110,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4D18 */ cpu->r[5] = rbrew_read32(cpu->mem, _t408);
   L_021C4D1C: ; // 0x21c4d1c
         /* 021C4D1C */ cpu->r[0] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Bu, 0x0000001Bu);
-        /* 021C4D1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021C4D20 */ _t409 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4D1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021C4D20 */ _t409 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4D20 */ _t410 = _t409 & 0x00000001u;
         /* 021C4D20 */ if (_t410) goto L_021C4E68; else goto L_021C4D24;
   L_021C4D24: ; // 0x21c4d24
@@ -13119,12 +13119,12 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4D24 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t411);
         /* 021C4D28 */ _t412 = cpu->r[19] + 0x00000040u;
         /* 021C4D28 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t412);
-        /* 021C4D2C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[25]);
+        /* 021C4D2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[25]));
         /* 021C4D30 */ _t413 = cpu->r[19] + 0x0000001Cu;
         /* 021C4D30 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t413);
         /* 021C4D34 */ _t414 = cpu->r[19] + 0x00000028u;
         /* 021C4D34 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t414);
-        /* 021C4D38 */ _t415 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4D38 */ _t415 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4D38 */ _t416 = _t415 & 0x00000001u;
         /* 021C4D38 */ if (_t416) goto L_021C4D3C; else goto L_021C4D60;
   L_021C4D3C: ; // 0x21c4d3c
@@ -13132,20 +13132,20 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4D40 */ _t417 = cpu->r[12] + 0x00000004u;
         /* 021C4D40 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t417);
         /* 021C4D44 */ /* nop */
-        /* 021C4D48 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[25]);
+        /* 021C4D48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[25]));
         /* 021C4D4C */ _t418 = cpu->r[19] + 0x00000020u;
         /* 021C4D4C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t418);
         /* 021C4D50 */ cpu->f[10] = fma(cpu->f[6], cpu->f[8], cpu->f[12]);
         /* 021C4D54 */ _t419 = cpu->r[19] + 0x0000002Cu;
         /* 021C4D54 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t419);
-        /* 021C4D58 */ _t420 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4D58 */ _t420 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4D58 */ _t421 = _t420 & 0x00000001u;
         /* 021C4D58 */ if (_t421) goto L_021C4D5C; else goto L_021C4DC8;
   L_021C4D5C: ; // 0x21c4d5c
         /* 021C4D5C */ goto L_021C4DA4;
   L_021C4D60: ; // 0x21c4d60
-        /* 021C4D60 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[25]);
-        /* 021C4D64 */ _t422 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C4D60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[25]));
+        /* 021C4D64 */ _t422 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C4D64 */ _t423 = _t422 & 0x00000001u;
         /* 021C4D64 */ if (_t423) goto L_021C4D68; else goto L_021C4D8C;
   L_021C4D68: ; // 0x21c4d68
@@ -13153,13 +13153,13 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4D6C */ /* nop */
         /* 021C4D70 */ _t424 = cpu->r[12] + 0x00000004u;
         /* 021C4D70 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t424);
-        /* 021C4D74 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[25]);
+        /* 021C4D74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[25]));
         /* 021C4D78 */ _t425 = cpu->r[19] + 0x0000002Cu;
         /* 021C4D78 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t425);
         /* 021C4D7C */ cpu->f[10] = fma(cpu->f[7], cpu->f[8], cpu->f[0]);
         /* 021C4D80 */ _t426 = cpu->r[19] + 0x00000020u;
         /* 021C4D80 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t426);
-        /* 021C4D84 */ _t427 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4D84 */ _t427 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4D84 */ _t428 = _t427 & 0x00000001u;
         /* 021C4D84 */ if (_t428) goto L_021C4D88; else goto L_021C4DC8;
   L_021C4D88: ; // 0x21c4d88
@@ -13170,10 +13170,10 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4D90 */ cpu->f[10] = cpu->f[6] + cpu->f[7];
         /* 021C4D94 */ _t430 = cpu->r[19] + 0x00000020u;
         /* 021C4D94 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t430);
-        /* 021C4D98 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[25]);
+        /* 021C4D98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[25]));
         /* 021C4D9C */ _t431 = cpu->r[19] + 0x0000002Cu;
         /* 021C4D9C */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t431);
-        /* 021C4DA0 */ _t432 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4DA0 */ _t432 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4DA0 */ _t433 = _t432 & 0x00000001u;
         /* 021C4DA0 */ if (_t433) goto L_021C4DA4; else goto L_021C4DC8;
   L_021C4DA4: ; // 0x21c4da4
@@ -13181,20 +13181,20 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4DA8 */ /* nop */
         /* 021C4DAC */ _t434 = cpu->r[12] + 0x00000008u;
         /* 021C4DAC */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t434);
-        /* 021C4DB0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[25]);
+        /* 021C4DB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[25]));
         /* 021C4DB4 */ _t435 = cpu->r[19] + 0x00000024u;
         /* 021C4DB4 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t435);
         /* 021C4DB8 */ cpu->f[0] = fma(cpu->f[0], cpu->f[8], cpu->f[11]);
         /* 021C4DBC */ _t436 = cpu->r[19] + 0x00000030u;
         /* 021C4DBC */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t436);
-        /* 021C4DC0 */ _t437 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4DC0 */ _t437 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4DC0 */ _t438 = _t437 & 0x00000001u;
         /* 021C4DC0 */ if (_t438) goto L_021C4DC4; else goto L_021C4E2C;
   L_021C4DC4: ; // 0x21c4dc4
         /* 021C4DC4 */ goto L_021C4E0C;
   L_021C4DC8: ; // 0x21c4dc8
-        /* 021C4DC8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[25]);
-        /* 021C4DCC */ _t439 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C4DC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[25]));
+        /* 021C4DCC */ _t439 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C4DCC */ _t440 = _t439 & 0x00000001u;
         /* 021C4DCC */ if (_t440) goto L_021C4DD0; else goto L_021C4DF4;
   L_021C4DD0: ; // 0x21c4dd0
@@ -13205,10 +13205,10 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4DDC */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t441);
         /* 021C4DE0 */ _t442 = cpu->r[19] + 0x00000024u;
         /* 021C4DE0 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t442);
-        /* 021C4DE4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[25]);
+        /* 021C4DE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[25]));
         /* 021C4DE8 */ _t443 = cpu->r[19] + 0x00000030u;
         /* 021C4DE8 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t443);
-        /* 021C4DEC */ _t444 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4DEC */ _t444 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4DEC */ _t445 = _t444 & 0x00000001u;
         /* 021C4DEC */ if (_t445) goto L_021C4DF0; else goto L_021C4E2C;
   L_021C4DF0: ; // 0x21c4df0
@@ -13219,10 +13219,10 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4DF8 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t446);
         /* 021C4DFC */ _t447 = cpu->r[19] + 0x00000024u;
         /* 021C4DFC */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t447);
-        /* 021C4E00 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[25]);
+        /* 021C4E00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[25]));
         /* 021C4E04 */ _t448 = cpu->r[19] + 0x00000030u;
         /* 021C4E04 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t448);
-        /* 021C4E08 */ _t449 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4E08 */ _t449 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4E08 */ _t450 = _t449 & 0x00000001u;
         /* 021C4E08 */ if (_t450) goto L_021C4E0C; else goto L_021C4E2C;
   L_021C4E0C: ; // 0x21c4e0c
@@ -13239,8 +13239,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4E24 */ cpu->r[5] = rbrew_read32(cpu->mem, _t454);
         /* 021C4E28 */ goto L_021C4E68;
   L_021C4E2C: ; // 0x21c4e2c
-        /* 021C4E2C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[25]);
-        /* 021C4E30 */ _t455 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C4E2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[25]));
+        /* 021C4E30 */ _t455 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C4E30 */ _t456 = _t455 & 0x00000001u;
         /* 021C4E30 */ if (_t456) goto L_021C4E34; else goto L_021C4E54;
   L_021C4E34: ; // 0x21c4e34
@@ -13289,28 +13289,28 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4E8C */ _t473 = rbrew_rlwinm(cpu->r[29], 0x0000000Cu, 0x00000012u, 0x00000013u);
         /* 021C4E8C */ _t474 = cpu->r[10] & 0xFFFFCFFFu;
         /* 021C4E8C */ cpu->r[10] = _t474 | _t473;
-        /* 021C4E90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000004u);
+        /* 021C4E90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000004u));
         /* 021C4E94 */ _t475 = cpu->r[31] + 0x000001CCu;
         /* 021C4E94 */ rbrew_write32(cpu->mem, _t475, cpu->r[10]);
-        /* 021C4E98 */ _t476 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4E98 */ _t476 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4E98 */ _t477 = _t476 & 0x00000001u;
         /* 021C4E98 */ if (_t477) goto L_021C4E9C; else goto L_021C4FF8;
   L_021C4E9C: ; // 0x21c4e9c
         /* 021C4E9C */ _t478 = cpu->r[31] + 0x000001CCu;
         /* 021C4E9C */ cpu->r[11] = rbrew_read32(cpu->mem, _t478);
         /* 021C4EA0 */ cpu->r[11] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000015u, 0x00000015u);
-        /* 021C4EA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021C4EA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021C4EA4 */ _t479 = cpu->r[1] + 0x00000030u;
         /* 021C4EA4 */ cpu->r[14] = rbrew_read32(cpu->mem, _t479);
-        /* 021C4EA8 */ _t480 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4EA8 */ _t480 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4EA8 */ _t481 = _t480 & 0x00000001u;
         /* 021C4EA8 */ if (_t481) goto L_021C4EE0; else goto L_021C4EAC;
   L_021C4EAC: ; // 0x21c4eac
         /* 021C4EAC */ _t482 = cpu->r[14] + 0x0000015Cu;
         /* 021C4EAC */ cpu->r[7] = rbrew_read32(cpu->mem, _t482);
         /* 021C4EB0 */ cpu->r[12] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021C4EB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021C4EB4 */ _t483 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4EB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021C4EB4 */ _t483 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4EB4 */ _t484 = _t483 & 0x00000001u;
         /* 021C4EB4 */ if (_t484) goto L_021C4EE4; else goto L_021C4EB8;
   L_021C4EB8: ; // 0x21c4eb8
@@ -13323,8 +13323,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4ECC */ cpu->r[4] = cpu->r[14];
         /* 021C4ED0 */ cpu->r[3] = cpu->r[31];
         /* 021C4ED4 */ Gambit_fn_021C2660(cpu);
-        /* 021C4ED8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C4EDC */ _t486 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4ED8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C4EDC */ _t486 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4EDC */ _t487 = _t486 & 0x00000001u;
         /* 021C4EDC */ if (_t487) goto L_021C4EE0; else goto L_021C4F30;
   L_021C4EE0: ; // 0x21c4ee0
@@ -13334,14 +13334,14 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4EE4 */ _t489 = cpu->r[31] + 0x000001CCu;
         /* 021C4EE4 */ cpu->r[4] = rbrew_read32(cpu->mem, _t489);
         /* 021C4EE8 */ cpu->r[4] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 021C4EE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 021C4EEC */ _t490 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4EE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 021C4EEC */ _t490 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4EEC */ _t491 = _t490 & 0x00000001u;
         /* 021C4EEC */ if (_t491) goto L_021C4FC0; else goto L_021C4EF0;
   L_021C4EF0: ; // 0x21c4ef0
         /* 021C4EF0 */ cpu->r[5] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 021C4EF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 021C4EF4 */ _t492 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4EF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 021C4EF4 */ _t492 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4EF4 */ _t493 = _t492 & 0x00000001u;
         /* 021C4EF4 */ if (_t493) goto L_021C4FC0; else goto L_021C4EF8;
   L_021C4EF8: ; // 0x21c4ef8
@@ -13354,16 +13354,16 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4F0C */ cpu->r[4] = cpu->r[14];
         /* 021C4F10 */ cpu->r[3] = cpu->r[31];
         /* 021C4F14 */ Gambit_fn_021C2660(cpu);
-        /* 021C4F18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C4F1C */ _t495 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4F18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C4F1C */ _t495 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4F1C */ _t496 = _t495 & 0x00000001u;
         /* 021C4F1C */ if (_t496) goto L_021C4F20; else goto L_021C4F30;
   L_021C4F20: ; // 0x21c4f20
         /* 021C4F20 */ _t497 = cpu->r[14] + 0x0000015Cu;
         /* 021C4F20 */ cpu->r[7] = rbrew_read32(cpu->mem, _t497);
         /* 021C4F24 */ cpu->r[6] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021C4F24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 021C4F28 */ _t498 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4F24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 021C4F28 */ _t498 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4F28 */ _t499 = _t498 & 0x00000001u;
         /* 021C4F28 */ if (_t499) goto L_021C4FE4; else goto L_021C4F2C;
   L_021C4F2C: ; // 0x21c4f2c
@@ -13428,7 +13428,7 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4FA4 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t526);
         /* 021C4FA8 */ _t527 = cpu->r[1] + 0x00000240u;
         /* 021C4FA8 */ cpu->f[25] = rbrew_read_f64(cpu->mem, _t527);
-        /* 021C4FAC */ _t528 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C4FAC */ _t528 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C4FAC */ _t529 = _t528 & 0x00000001u;
         /* 021C4FAC */ if (_t529) goto L_021C4FB0; // else: addr-0 trap, fall-through
   L_021C4FB0: ; // 0x21c4fb0
@@ -13439,8 +13439,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4FBC */ return;
   L_021C4FC0: ; // 0x21c4fc0
         /* 021C4FC0 */ cpu->r[6] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021C4FC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 021C4FC4 */ _t531 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4FC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 021C4FC4 */ _t531 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4FC4 */ _t532 = _t531 & 0x00000001u;
         /* 021C4FC4 */ if (_t532) goto L_021C4FE4; else goto L_021C4FC8;
   L_021C4FC8: ; // 0x21c4fc8
@@ -13452,16 +13452,16 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4FD4 */ _t535 = cpu->r[19] + 0x0000015Cu;
         /* 021C4FD4 */ cpu->r[4] = rbrew_read32(cpu->mem, _t535);
         /* 021C4FD8 */ cpu->r[10] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 021C4FD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021C4FDC */ _t536 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4FD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021C4FDC */ _t536 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4FDC */ _t537 = _t536 & 0x00000001u;
         /* 021C4FDC */ if (_t537) goto L_021C510C; else goto L_021C4FE0;
   L_021C4FE0: ; // 0x21c4fe0
         /* 021C4FE0 */ goto L_021C5004;
   L_021C4FE4: ; // 0x21c4fe4
         /* 021C4FE4 */ cpu->r[8] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 021C4FE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021C4FE8 */ _t538 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4FE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021C4FE8 */ _t538 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4FE8 */ _t539 = _t538 & 0x00000001u;
         /* 021C4FE8 */ if (_t539) goto L_021C4FF8; else goto L_021C4FEC;
   L_021C4FEC: ; // 0x21c4fec
@@ -13474,8 +13474,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C4FF8 */ _t542 = cpu->r[19] + 0x0000015Cu;
         /* 021C4FF8 */ cpu->r[4] = rbrew_read32(cpu->mem, _t542);
         /* 021C4FFC */ cpu->r[10] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 021C4FFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021C5000 */ _t543 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4FFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021C5000 */ _t543 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C5000 */ _t544 = _t543 & 0x00000001u;
         /* 021C5000 */ if (_t544) goto L_021C510C; else goto L_021C5004;
   L_021C5004: ; // 0x21c5004
@@ -13491,18 +13491,18 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C5020 */ _t547 = cpu->r[19] + 0x00000000u;
         /* 021C5020 */ cpu->r[6] = rbrew_read32(cpu->mem, _t547);
         /* 021C5024 */ cpu->r[5] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C5024 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021C5024 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021C5028 */ cpu->r[14] = cpu->r[19] + 0x00000048u;
-        /* 021C502C */ _t548 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C502C */ _t548 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C502C */ _t549 = _t548 & 0x00000001u;
         /* 021C502C */ if (_t549) goto L_021C5068; else goto L_021C5030;
   L_021C5030: ; // 0x21c5030
         /* 021C5030 */ cpu->r[3] = cpu->r[19] + 0x0000012Cu;
         /* 021C5034 */ Gambit_fn_02C69350(cpu);
-        /* 021C5038 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[25]);
+        /* 021C5038 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[25]));
         /* 021C503C */ _t550 = cpu->r[19] + 0x00000000u;
         /* 021C503C */ cpu->r[7] = rbrew_read32(cpu->mem, _t550);
-        /* 021C5040 */ _t551 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C5040 */ _t551 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C5040 */ _t552 = _t551 & 0x00000001u;
         /* 021C5040 */ if (_t552) goto L_021C5044; else goto L_021C5060;
   L_021C5044: ; // 0x21c5044
@@ -13537,11 +13537,11 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C508C */ rbrew_write_f32(cpu->mem, _t560, cpu->f[9]);
         /* 021C5090 */ _t561 = cpu->r[19] + 0x0000006Cu;
         /* 021C5090 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t561);
-        /* 021C5094 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[12]);
+        /* 021C5094 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[12]));
         /* 021C5098 */ _t562 = cpu->r[31] + 0x000001FCu;
         /* 021C5098 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t562);
         /* 021C509C */ cpu->r[16] = cpu->r[16] + 0x00000001u;
-        /* 021C50A0 */ _t563 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C50A0 */ _t563 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C50A0 */ _t564 = _t563 & 0x00000001u;
         /* 021C50A0 */ if (_t564) goto L_021C50A4; else goto L_021C50A8;
   L_021C50A4: ; // 0x21c50a4
@@ -13550,8 +13550,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
   L_021C50A8: ; // 0x21c50a8
         /* 021C50A8 */ _t566 = cpu->r[19] + 0x00000070u;
         /* 021C50A8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t566);
-        /* 021C50AC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
-        /* 021C50B0 */ _t567 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C50AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
+        /* 021C50B0 */ _t567 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C50B0 */ _t568 = _t567 & 0x00000001u;
         /* 021C50B0 */ if (_t568) goto L_021C50B4; else goto L_021C50B8;
   L_021C50B4: ; // 0x21c50b4
@@ -13562,8 +13562,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C50B8 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t570);
         /* 021C50BC */ _t571 = cpu->r[31] + 0x00000200u;
         /* 021C50BC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t571);
-        /* 021C50C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[0]);
-        /* 021C50C4 */ _t572 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C50C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[0]));
+        /* 021C50C4 */ _t572 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C50C4 */ _t573 = _t572 & 0x00000001u;
         /* 021C50C4 */ if (_t573) goto L_021C50C8; else goto L_021C50CC;
   L_021C50C8: ; // 0x21c50c8
@@ -13574,10 +13574,10 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C50CC */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t575);
         /* 021C50D0 */ _t576 = cpu->r[31] + 0x00000204u;
         /* 021C50D0 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t576);
-        /* 021C50D4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[6]);
+        /* 021C50D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[6]));
         /* 021C50D8 */ _t577 = cpu->r[31] + 0x00000208u;
         /* 021C50D8 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t577);
-        /* 021C50DC */ _t578 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C50DC */ _t578 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C50DC */ _t579 = _t578 & 0x00000001u;
         /* 021C50DC */ if (_t579) goto L_021C50E0; else goto L_021C50E4;
   L_021C50E0: ; // 0x21c50e0
@@ -13586,10 +13586,10 @@ void Gambit_fn_021C429C(CPUState* cpu) {
   L_021C50E4: ; // 0x21c50e4
         /* 021C50E4 */ _t581 = cpu->r[19] + 0x00000070u;
         /* 021C50E4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t581);
-        /* 021C50E8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[7]);
+        /* 021C50E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[7]));
         /* 021C50EC */ _t582 = cpu->r[31] + 0x0000020Cu;
         /* 021C50EC */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t582);
-        /* 021C50F0 */ _t583 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C50F0 */ _t583 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C50F0 */ _t584 = _t583 & 0x00000001u;
         /* 021C50F0 */ if (_t584) goto L_021C50F4; else goto L_021C50F8;
   L_021C50F4: ; // 0x21c50f4
@@ -13598,8 +13598,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
   L_021C50F8: ; // 0x21c50f8
         /* 021C50F8 */ _t586 = cpu->r[19] + 0x00000074u;
         /* 021C50F8 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t586);
-        /* 021C50FC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[8]);
-        /* 021C5100 */ _t587 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C50FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[8]));
+        /* 021C5100 */ _t587 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C5100 */ _t588 = _t587 & 0x00000001u;
         /* 021C5100 */ if (_t588) goto L_021C5104; else goto L_021C5108;
   L_021C5104: ; // 0x21c5104
@@ -13610,8 +13610,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C5108 */ cpu->r[4] = rbrew_read32(cpu->mem, _t590);
   L_021C510C: ; // 0x21c510c
         /* 021C510C */ cpu->r[9] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021C510C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 021C5110 */ _t591 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C510C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 021C5110 */ _t591 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C5110 */ _t592 = _t591 & 0x00000001u;
         /* 021C5110 */ if (_t592) goto L_021C5138; else goto L_021C5114;
   L_021C5114: ; // 0x21c5114
@@ -13627,8 +13627,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C5130 */ cpu->r[20] = cpu->r[20] + 0x00000001u;
         /* 021C5134 */ cpu->r[20] = rbrew_rlwinm(cpu->r[20], 0x00000000u, 0x00000018u, 0x0000001Fu);
   L_021C5138: ; // 0x21c5138
-        /* 021C5138 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[15], 0x00000000u);
-        /* 021C513C */ _t595 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C5138 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[15], 0x00000000u));
+        /* 021C513C */ _t595 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C513C */ _t596 = _t595 & 0x00000001u;
         /* 021C513C */ if (_t596) goto L_021C5140; else goto L_021C51B4;
   L_021C5140: ; // 0x21c5140
@@ -13661,10 +13661,10 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C5184 */ cpu->r[15] = cpu->r[3];
         /* 021C5188 */ cpu->r[25] = cpu->r[25] + 0x0000000Cu;
         /* 021C518C */ cpu->r[18] = cpu->r[18] + 0xFFFFFFFFu;
-        /* 021C518C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[18], 0x00000000u);
+        /* 021C518C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[18], 0x00000000u));
         /* 021C5190 */ cpu->r[24] = cpu->r[24] + 0x00000001u;
         /* 021C5194 */ cpu->r[30] = cpu->r[30] + 0x0000000Cu;
-        /* 021C5198 */ _t606 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C5198 */ _t606 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C5198 */ _t607 = _t606 & 0x00000001u;
         /* 021C5198 */ if (_t607) goto L_021C519C; else goto L_021C4480;
   L_021C519C: ; // 0x21c519c
@@ -13673,25 +13673,25 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C51A0 */ cpu->r[3] = cpu->r[31];
         /* 021C51A4 */ cpu->r[4] = cpu->r[1] + 0x0000002Cu;
         /* 021C51A8 */ Gambit_fn_021C3934(cpu);
-        /* 021C51AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C51B0 */ _t608 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C51AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C51B0 */ _t608 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C51B0 */ _t609 = _t608 & 0x00000001u;
         /* 021C51B0 */ if (_t609) goto L_021C51B4; else goto L_021C56D4;
   L_021C51B4: ; // 0x21c51b4
         /* 021C51B4 */ cpu->r[25] = cpu->r[25] + 0x0000000Cu;
         /* 021C51B8 */ cpu->r[18] = cpu->r[18] + 0xFFFFFFFFu;
-        /* 021C51B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[18], 0x00000000u);
+        /* 021C51B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[18], 0x00000000u));
         /* 021C51BC */ cpu->r[24] = cpu->r[24] + 0x00000001u;
         /* 021C51C0 */ cpu->r[30] = cpu->r[30] + 0x0000000Cu;
-        /* 021C51C4 */ _t610 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C51C4 */ _t610 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C51C4 */ _t611 = _t610 & 0x00000001u;
         /* 021C51C4 */ if (_t611) goto L_021C51C8; else goto L_021C4480;
   L_021C51C8: ; // 0x21c51c8
         /* 021C51C8 */ _t612 = cpu->r[31] + 0x000001CCu;
         /* 021C51C8 */ cpu->r[4] = rbrew_read32(cpu->mem, _t612);
         /* 021C51CC */ cpu->r[4] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 021C51CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 021C51D0 */ _t613 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C51CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 021C51D0 */ _t613 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C51D0 */ _t614 = _t613 & 0x00000001u;
         /* 021C51D0 */ if (_t614) goto L_021C5270; else goto L_021C51D4;
   L_021C51D4: ; // 0x21c51d4
@@ -13715,9 +13715,9 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C5208 */ /* nop */
         /* 021C520C */ cpu->f[12] = fma(cpu->f[7], cpu->f[9], cpu->f[12]);
         /* 021C5210 */ cpu->f[8] = -cpu->f[12];
-        /* 021C5214 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[8]);
+        /* 021C5214 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[8]));
         /* 021C5218 */ cpu->r[8] = cpu->r[8] + 0x0000000Cu;
-        /* 021C521C */ _t618 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C521C */ _t618 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C521C */ _t619 = _t618 & 0x00000001u;
         /* 021C521C */ if (_t619) goto L_021C5220; else goto L_021C5224;
   L_021C5220: ; // 0x21c5220
@@ -13758,8 +13758,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C526C */ _t632 = cpu->r[31] + 0x000001F0u;
         /* 021C526C */ rbrew_write_f32(cpu->mem, _t632, cpu->f[11]);
   L_021C5270: ; // 0x21c5270
-        /* 021C5270 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[16], 0x00000000u);
-        /* 021C5274 */ _t633 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C5270 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[16], 0x00000000u));
+        /* 021C5274 */ _t633 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C5274 */ _t634 = _t633 & 0x00000001u;
         /* 021C5274 */ if (_t634) goto L_021C5278; else goto L_021C529C;
   L_021C5278: ; // 0x21c5278
@@ -13770,10 +13770,10 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C5284 */ _t636 = cpu->r[31] + 0x000001CFu;
         /* 021C5284 */ rbrew_write8(cpu->mem, _t636, (uint8_t)cpu->r[9]);
         /* 021C5288 */ Gambit_fn_021BFD28(cpu);
-        /* 021C528C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021C528C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021C5290 */ _t637 = cpu->r[31] + 0x00000198u;
         /* 021C5290 */ cpu->r[7] = rbrew_read8(cpu->mem, _t637);
-        /* 021C5294 */ _t638 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C5294 */ _t638 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C5294 */ _t639 = _t638 & 0x00000001u;
         /* 021C5294 */ if (_t639) goto L_021C535C; else goto L_021C5298;
   L_021C5298: ; // 0x21c5298
@@ -13782,10 +13782,10 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C529C */ _t640 = cpu->r[31] + 0x00000164u;
         /* 021C529C */ cpu->r[11] = rbrew_read32(cpu->mem, _t640);
         /* 021C52A0 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 021C52A4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[20], 0x00000002u);
+        /* 021C52A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[20], 0x00000002u));
         /* 021C52A8 */ _t641 = cpu->r[31] + 0x00000164u;
         /* 021C52A8 */ rbrew_write32(cpu->mem, _t641, cpu->r[11]);
-        /* 021C52AC */ _t642 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C52AC */ _t642 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C52AC */ _t643 = _t642 & 0x00000001u;
         /* 021C52AC */ if (_t643) goto L_021C533C; else goto L_021C52B0;
   L_021C52B0: ; // 0x21c52b0
@@ -13801,8 +13801,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C52C8 */ _t647 = cpu->r[31] + 0x000001B8u;
         /* 021C52C8 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t647);
         /* 021C52CC */ cpu->f[10] = cpu->f[6] - cpu->f[7];
-        /* 021C52D0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[30]);
-        /* 021C52D4 */ _t648 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C52D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[30]));
+        /* 021C52D4 */ _t648 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C52D4 */ _t649 = _t648 & 0x00000001u;
         /* 021C52D4 */ if (_t649) goto L_021C52D8; else goto L_021C533C;
   L_021C52D8: ; // 0x21c52d8
@@ -13816,8 +13816,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C52EC */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021C52F0 */ _t652 = cpu->r[3] + 0x00000004u;
         /* 021C52F0 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t652);
-        /* 021C52F4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[9]);
-        /* 021C52F8 */ _t653 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C52F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[9]));
+        /* 021C52F8 */ _t653 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C52F8 */ _t654 = _t653 & 0x00000001u;
         /* 021C52F8 */ if (_t654) goto L_021C52FC; else goto L_021C533C;
   L_021C52FC: ; // 0x21c52fc
@@ -13834,8 +13834,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C5314 */ cpu->ctr = cpu->r[10];
         /* 021C5318 */ cpu->r[3] = cpu->r[31];
         /* 021C531C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021C5320 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[3]);
-        /* 021C5324 */ _t659 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C5320 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[3]));
+        /* 021C5324 */ _t659 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C5324 */ _t660 = _t659 & 0x00000001u;
         /* 021C5324 */ if (_t660) goto L_021C533C; else goto L_021C5328;
   L_021C5328: ; // 0x21c5328
@@ -13850,17 +13850,17 @@ void Gambit_fn_021C429C(CPUState* cpu) {
   L_021C533C: ; // 0x21c533c
         /* 021C533C */ cpu->r[3] = cpu->r[31];
         /* 021C5340 */ Gambit_fn_021BFD28(cpu);
-        /* 021C5344 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021C5344 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021C5348 */ _t664 = cpu->r[31] + 0x00000198u;
         /* 021C5348 */ cpu->r[7] = rbrew_read8(cpu->mem, _t664);
-        /* 021C534C */ _t665 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C534C */ _t665 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C534C */ _t666 = _t665 & 0x00000001u;
         /* 021C534C */ if (_t666) goto L_021C535C; else goto L_021C5350;
   L_021C5350: ; // 0x21c5350
         /* 021C5350 */ _t667 = cpu->r[1] + 0x0000000Cu;
         /* 021C5350 */ cpu->r[6] = rbrew_read8(cpu->mem, _t667);
-        /* 021C5354 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 021C5358 */ _t668 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C5354 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 021C5358 */ _t668 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C5358 */ _t669 = _t668 & 0x00000001u;
         /* 021C5358 */ if (_t669) goto L_021C5368; else goto L_021C535C;
   L_021C535C: ; // 0x21c535c
@@ -13870,8 +13870,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C5364 */ _t671 = cpu->r[31] + 0x00000160u;
         /* 021C5364 */ rbrew_write32(cpu->mem, _t671, cpu->r[5]);
   L_021C5368: ; // 0x21c5368
-        /* 021C5368 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021C536C */ _t672 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C5368 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021C536C */ _t672 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C536C */ _t673 = _t672 & 0x00000001u;
         /* 021C536C */ if (_t673) goto L_021C5370; else goto L_021C53FC;
   L_021C5370: ; // 0x21c5370
@@ -13882,8 +13882,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C5378 */ cpu->ctr = cpu->r[0];
         /* 021C537C */ cpu->r[3] = cpu->r[31];
         /* 021C5380 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021C5384 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C5388 */ _t676 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C5384 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C5388 */ _t676 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C5388 */ _t677 = _t676 & 0x00000001u;
         /* 021C5388 */ if (_t677) goto L_021C53F0; else goto L_021C538C;
   L_021C538C: ; // 0x21c538c
@@ -13896,8 +13896,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C539C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021C53A0 */ _t680 = cpu->r[31] + 0x00000160u;
         /* 021C53A0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t680);
-        /* 021C53A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], cpu->r[3]);
-        /* 021C53A8 */ _t681 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C53A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], cpu->r[3]));
+        /* 021C53A8 */ _t681 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C53A8 */ _t682 = _t681 & 0x00000001u;
         /* 021C53A8 */ if (_t682) goto L_021C53AC; else goto L_021C53F0;
   L_021C53AC: ; // 0x21c53ac
@@ -13918,10 +13918,10 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C53D8 */ Gambit_fn_021BFD28(cpu);
         /* 021C53DC */ _t686 = cpu->r[31] + 0x0000019Cu;
         /* 021C53DC */ cpu->r[6] = rbrew_read32(cpu->mem, _t686);
-        /* 021C53E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021C53E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021C53E4 */ _t687 = cpu->r[6] + 0x00000008u;
         /* 021C53E4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t687);
-        /* 021C53E8 */ _t688 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C53E8 */ _t688 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C53E8 */ _t689 = _t688 & 0x00000001u;
         /* 021C53E8 */ if (_t689) goto L_021C53EC; else goto L_021C5418;
   L_021C53EC: ; // 0x21c53ec
@@ -13929,8 +13929,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
   L_021C53F0: ; // 0x21c53f0
         /* 021C53F0 */ _t690 = cpu->r[31] + 0x00000198u;
         /* 021C53F0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t690);
-        /* 021C53F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021C53F8 */ _t691 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C53F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021C53F8 */ _t691 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C53F8 */ _t692 = _t691 & 0x00000001u;
         /* 021C53F8 */ if (_t692) goto L_021C5438; else goto L_021C53FC;
   L_021C53FC: ; // 0x21c53fc
@@ -13938,10 +13938,10 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C5400 */ Gambit_fn_021BFD28(cpu);
         /* 021C5404 */ _t693 = cpu->r[31] + 0x0000019Cu;
         /* 021C5404 */ cpu->r[6] = rbrew_read32(cpu->mem, _t693);
-        /* 021C5408 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021C5408 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021C540C */ _t694 = cpu->r[6] + 0x00000008u;
         /* 021C540C */ cpu->r[11] = rbrew_read32(cpu->mem, _t694);
-        /* 021C5410 */ _t695 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C5410 */ _t695 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C5410 */ _t696 = _t695 & 0x00000001u;
         /* 021C5410 */ if (_t696) goto L_021C5414; else goto L_021C5418;
   L_021C5414: ; // 0x21c5414
@@ -13965,12 +13965,12 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C5434 */ if (_t702) goto L_021C542C; else goto L_021C5438;
   L_021C5438: ; // 0x21c5438
         /* 021C5438 */ cpu->r[30] = 0x101F0000u;
-        /* 021C543C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[16], 0x00000000u);
+        /* 021C543C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[16], 0x00000000u));
         /* 021C5440 */ cpu->r[0] = cpu->r[16] ^ 0x80000000u;
         /* 021C5444 */ cpu->r[30] = cpu->r[30] + 0x00006350u;
         /* 021C5448 */ _t703 = cpu->r[1] + 0x000000C4u;
         /* 021C5448 */ rbrew_write32(cpu->mem, _t703, cpu->r[0]);
-        /* 021C544C */ _t704 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C544C */ _t704 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C544C */ _t705 = _t704 & 0x00000001u;
         /* 021C544C */ if (_t705) goto L_021C5450; else goto L_021C54FC;
   L_021C5450: ; // 0x21c5450
@@ -14029,7 +14029,7 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C54D8 */ _t724 = cpu->r[1] + 0x0000005Cu;
         /* 021C54D8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t724);
         /* 021C54DC */ cpu->f[13] = cpu->f[0] - cpu->f[7];
-        /* 021C54E0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[28]);
+        /* 021C54E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[28]));
         /* 021C54E4 */ cpu->f[7] = fma(cpu->f[13], cpu->f[1], cpu->f[7]);
         /* 021C54E8 */ _t725 = cpu->r[31] + 0x00000004u;
         /* 021C54E8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t725);
@@ -14037,7 +14037,7 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C54EC */ rbrew_write_f32(cpu->mem, _t726, cpu->f[7]);
         /* 021C54F0 */ _t727 = cpu->r[9] + 0x00000484u;
         /* 021C54F0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t727);
-        /* 021C54F4 */ _t728 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C54F4 */ _t728 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C54F4 */ _t729 = _t728 & 0x00000001u;
         /* 021C54F4 */ if (_t729) goto L_021C557C; else goto L_021C54F8;
   L_021C54F8: ; // 0x21c54f8
@@ -14082,7 +14082,7 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C555C */ _t742 = cpu->r[30] + 0x00000008u;
         /* 021C555C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t742);
         /* 021C5560 */ cpu->f[13] = cpu->f[0] - cpu->f[7];
-        /* 021C5564 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[28]);
+        /* 021C5564 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[28]));
         /* 021C5568 */ cpu->f[7] = fma(cpu->f[13], cpu->f[1], cpu->f[7]);
         /* 021C556C */ _t743 = cpu->r[31] + 0x00000004u;
         /* 021C556C */ cpu->r[9] = rbrew_read32(cpu->mem, _t743);
@@ -14090,7 +14090,7 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C5570 */ rbrew_write_f32(cpu->mem, _t744, cpu->f[7]);
         /* 021C5574 */ _t745 = cpu->r[9] + 0x00000484u;
         /* 021C5574 */ cpu->r[0] = rbrew_read32(cpu->mem, _t745);
-        /* 021C5578 */ _t746 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C5578 */ _t746 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C5578 */ _t747 = _t746 & 0x00000001u;
         /* 021C5578 */ if (_t747) goto L_021C557C; else goto L_021C5580;
   L_021C557C: ; // 0x21c557c
@@ -14120,28 +14120,28 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C55C0 */ cpu->r[3] = cpu->r[31];
         /* 021C55C4 */ cpu->r[4] = cpu->r[1] + 0x0000011Cu;
         /* 021C55C8 */ Gambit_fn_021C3B50(cpu);
-        /* 021C55CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[15], 0x00000000u);
-        /* 021C55D0 */ _t753 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C55CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[15], 0x00000000u));
+        /* 021C55D0 */ _t753 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C55D0 */ _t754 = _t753 & 0x00000001u;
         /* 021C55D0 */ if (_t754) goto L_021C55FC; else goto L_021C55D4;
   L_021C55D4: ; // 0x21c55d4
         /* 021C55D4 */ _t755 = cpu->r[31] + 0x0000001Cu;
         /* 021C55D4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t755);
-        /* 021C55D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000002u);
-        /* 021C55DC */ _t756 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C55D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000002u));
+        /* 021C55DC */ _t756 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C55DC */ _t757 = _t756 & 0x00000001u;
         /* 021C55DC */ if (_t757) goto L_021C55E8; else goto L_021C55E0;
   L_021C55E0: ; // 0x21c55e0
-        /* 021C55E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000003u);
-        /* 021C55E4 */ _t758 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C55E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000003u));
+        /* 021C55E4 */ _t758 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C55E4 */ _t759 = _t758 & 0x00000001u;
         /* 021C55E4 */ if (_t759) goto L_021C55E8; else goto L_021C55FC;
   L_021C55E8: ; // 0x21c55e8
         /* 021C55E8 */ _t760 = cpu->r[31] + 0x000001CCu;
         /* 021C55E8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t760);
         /* 021C55EC */ cpu->r[8] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x00000010u, 0x00000011u);
-        /* 021C55EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021C55F0 */ _t761 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C55EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021C55F0 */ _t761 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C55F0 */ _t762 = _t761 & 0x00000001u;
         /* 021C55F0 */ if (_t762) goto L_021C55F4; else goto L_021C55FC;
   L_021C55F4: ; // 0x21c55f4
@@ -14160,8 +14160,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C5618 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021C561C */ _t765 = cpu->r[31] + 0x00000160u;
         /* 021C561C */ cpu->r[0] = rbrew_read32(cpu->mem, _t765);
-        /* 021C5620 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[3]);
-        /* 021C5624 */ _t766 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C5620 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[3]));
+        /* 021C5624 */ _t766 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C5624 */ _t767 = _t766 & 0x00000001u;
         /* 021C5624 */ if (_t767) goto L_021C5628; else goto L_021C5638;
   L_021C5628: ; // 0x21c5628
@@ -14187,20 +14187,20 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C5660 */ _t772 = cpu->r[31] + 0x00000160u;
         /* 021C5660 */ cpu->r[0] = rbrew_read32(cpu->mem, _t772);
         /* 021C5664 */ cpu->r[9] = cpu->r[29] + cpu->r[3];
-        /* 021C5668 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[9]);
-        /* 021C566C */ _t773 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C5668 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[9]));
+        /* 021C566C */ _t773 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C566C */ _t774 = _t773 & 0x00000001u;
         /* 021C566C */ if (_t774) goto L_021C5670; else goto L_021C56D4;
   L_021C5670: ; // 0x21c5670
-        /* 021C5670 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[16], 0x00000000u);
-        /* 021C5674 */ _t775 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C5670 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[16], 0x00000000u));
+        /* 021C5674 */ _t775 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C5674 */ _t776 = _t775 & 0x00000001u;
         /* 021C5674 */ if (_t776) goto L_021C5688; else goto L_021C5678;
   L_021C5678: ; // 0x21c5678
         /* 021C5678 */ _t777 = cpu->r[1] + 0x0000000Cu;
         /* 021C5678 */ cpu->r[5] = rbrew_read8(cpu->mem, _t777);
-        /* 021C567C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 021C5680 */ _t778 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C567C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 021C5680 */ _t778 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C5680 */ _t779 = _t778 & 0x00000001u;
         /* 021C5680 */ if (_t779) goto L_021C56D4; else goto L_021C5684;
   L_021C5684: ; // 0x21c5684
@@ -14210,13 +14210,13 @@ void Gambit_fn_021C429C(CPUState* cpu) {
   L_021C568C: ; // 0x21c568c
         /* 021C568C */ _t780 = cpu->r[31] + 0x0000001Cu;
         /* 021C568C */ cpu->r[8] = rbrew_read32(cpu->mem, _t780);
-        /* 021C5690 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000002u);
-        /* 021C5694 */ _t781 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C5690 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000002u));
+        /* 021C5694 */ _t781 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C5694 */ _t782 = _t781 & 0x00000001u;
         /* 021C5694 */ if (_t782) goto L_021C56A0; else goto L_021C5698;
   L_021C5698: ; // 0x21c5698
-        /* 021C5698 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000003u);
-        /* 021C569C */ _t783 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C5698 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000003u));
+        /* 021C569C */ _t783 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C569C */ _t784 = _t783 & 0x00000001u;
         /* 021C569C */ if (_t784) goto L_021C56A0; else goto L_021C56D4;
   L_021C56A0: ; // 0x21c56a0
@@ -14227,8 +14227,8 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C56A8 */ cpu->ctr = cpu->r[0];
         /* 021C56AC */ cpu->r[3] = cpu->r[31];
         /* 021C56B0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021C56B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C56B8 */ _t787 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C56B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C56B8 */ _t787 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C56B8 */ _t788 = _t787 & 0x00000001u;
         /* 021C56B8 */ if (_t788) goto L_021C56BC; else goto L_021C56D4;
   L_021C56BC: ; // 0x21c56bc
@@ -14298,7 +14298,7 @@ void Gambit_fn_021C429C(CPUState* cpu) {
         /* 021C5740 */ cpu->f[27] = rbrew_read_f64(cpu->mem, _t817);
         /* 021C5744 */ _t818 = cpu->r[1] + 0x00000290u;
         /* 021C5744 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t818);
-        /* 021C5748 */ _t819 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C5748 */ _t819 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C5748 */ _t820 = _t819 & 0x00000001u;
         /* 021C5748 */ if (_t820) goto L_021C574C; // else: addr-0 trap, fall-through
   L_021C574C: ; // 0x21c574c
@@ -14401,15 +14401,15 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C3C14 */ cpu->r[29] = cpu->r[3];
         /* 021C3C18 */ _t32 = cpu->r[1] + 0x00000034u;
         /* 021C3C18 */ rbrew_write32(cpu->mem, _t32, cpu->r[7]);
-        /* 021C3C1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 021C3C1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 021C3C20 */ _t33 = cpu->r[1] + 0x00000028u;
         /* 021C3C20 */ rbrew_write32(cpu->mem, _t33, cpu->r[7]);
-        /* 021C3C24 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3C24 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3C24 */ _t35 = _t34 & 0x00000001u;
         /* 021C3C24 */ if (_t35) goto L_021C4128; else goto L_021C3C28;
   L_021C3C28: ; // 0x21c3c28
-        /* 021C3C28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021C3C2C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3C28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021C3C2C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3C2C */ _t37 = _t36 & 0x00000001u;
         /* 021C3C2C */ if (_t37) goto L_021C4128; else goto L_021C3C30;
   L_021C3C30: ; // 0x21c3c30
@@ -14426,8 +14426,8 @@ void Gambit_fn_021C575C(CPUState* cpu) {
   L_021C3C50: ; // 0x21c3c50
         /* 021C3C50 */ _t40 = cpu->r[10] + 0x00000004u;
         /* 021C3C50 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t40);
-        /* 021C3C54 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[0]);
-        /* 021C3C58 */ _t41 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3C54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[0]));
+        /* 021C3C58 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3C58 */ _t42 = _t41 & 0x00000001u;
         /* 021C3C58 */ if (_t42) goto L_021C3EF0; else goto L_021C3C5C;
   L_021C3C5C: ; // 0x21c3c5c
@@ -14435,8 +14435,8 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C3C5C */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t43);
         /* 021C3C60 */ _t44 = cpu->r[12] + 0x00000000u;
         /* 021C3C60 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t44);
-        /* 021C3C64 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[9]);
-        /* 021C3C68 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3C64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[9]));
+        /* 021C3C68 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3C68 */ _t46 = _t45 & 0x00000001u;
         /* 021C3C68 */ if (_t46) goto L_021C3C6C; else goto L_021C3C8C;
   L_021C3C6C: ; // 0x21c3c6c
@@ -14444,8 +14444,8 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C3C6C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t47);
         /* 021C3C70 */ _t48 = cpu->r[12] + 0x00000004u;
         /* 021C3C70 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t48);
-        /* 021C3C74 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[12]);
-        /* 021C3C78 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3C74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[12]));
+        /* 021C3C78 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3C78 */ _t50 = _t49 & 0x00000001u;
         /* 021C3C78 */ if (_t50) goto L_021C3C7C; else goto L_021C3C8C;
   L_021C3C7C: ; // 0x21c3c7c
@@ -14453,13 +14453,13 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C3C7C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t51);
         /* 021C3C80 */ _t52 = cpu->r[12] + 0x00000008u;
         /* 021C3C80 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t52);
-        /* 021C3C84 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[6]);
-        /* 021C3C88 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3C84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[6]));
+        /* 021C3C88 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3C88 */ _t54 = _t53 & 0x00000001u;
         /* 021C3C88 */ if (_t54) goto L_021C3EF0; else goto L_021C3C8C;
   L_021C3C8C: ; // 0x21c3c8c
-        /* 021C3C8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021C3C90 */ _t55 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3C8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021C3C90 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3C90 */ _t56 = _t55 & 0x00000001u;
         /* 021C3C90 */ if (_t56) goto L_021C3C94; else goto L_021C3EF0;
   L_021C3C94: ; // 0x21c3c94
@@ -14470,8 +14470,8 @@ void Gambit_fn_021C575C(CPUState* cpu) {
   L_021C3CA4: ; // 0x21c3ca4
         /* 021C3CA4 */ _t57 = cpu->r[9] + 0x00000004u;
         /* 021C3CA4 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t57);
-        /* 021C3CA8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[5]);
-        /* 021C3CAC */ _t58 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3CA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[5]));
+        /* 021C3CAC */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3CAC */ _t59 = _t58 & 0x00000001u;
         /* 021C3CAC */ if (_t59) goto L_021C3EE8; else goto L_021C3CB0;
   L_021C3CB0: ; // 0x21c3cb0
@@ -14479,8 +14479,8 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C3CB0 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t60);
         /* 021C3CB4 */ _t61 = cpu->r[12] + 0x00000000u;
         /* 021C3CB4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t61);
-        /* 021C3CB8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[10]);
-        /* 021C3CBC */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3CB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[10]));
+        /* 021C3CBC */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3CBC */ _t63 = _t62 & 0x00000001u;
         /* 021C3CBC */ if (_t63) goto L_021C3CC0; else goto L_021C3CE0;
   L_021C3CC0: ; // 0x21c3cc0
@@ -14488,8 +14488,8 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C3CC0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t64);
         /* 021C3CC4 */ _t65 = cpu->r[12] + 0x00000004u;
         /* 021C3CC4 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t65);
-        /* 021C3CC8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[13]);
-        /* 021C3CCC */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3CC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[13]));
+        /* 021C3CCC */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3CCC */ _t67 = _t66 & 0x00000001u;
         /* 021C3CCC */ if (_t67) goto L_021C3CD0; else goto L_021C3CE0;
   L_021C3CD0: ; // 0x21c3cd0
@@ -14497,8 +14497,8 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C3CD0 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t68);
         /* 021C3CD4 */ _t69 = cpu->r[12] + 0x00000008u;
         /* 021C3CD4 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t69);
-        /* 021C3CD8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[7]);
-        /* 021C3CDC */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3CD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[7]));
+        /* 021C3CDC */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3CDC */ _t71 = _t70 & 0x00000001u;
         /* 021C3CDC */ if (_t71) goto L_021C3EE8; else goto L_021C3CE0;
   L_021C3CE0: ; // 0x21c3ce0
@@ -14533,10 +14533,10 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C3D1C */ rbrew_write32(cpu->mem, _t84, cpu->r[0]);
         /* 021C3D20 */ _t85 = cpu->r[9] + 0x00000008u;
         /* 021C3D20 */ cpu->r[4] = rbrew_read32(cpu->mem, _t85);
-        /* 021C3D24 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[27]);
+        /* 021C3D24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[27]));
         /* 021C3D28 */ _t86 = cpu->r[1] + 0x0000001Cu;
         /* 021C3D28 */ rbrew_write32(cpu->mem, _t86, cpu->r[4]);
-        /* 021C3D2C */ _t87 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3D2C */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3D2C */ _t88 = _t87 & 0x00000001u;
         /* 021C3D2C */ if (_t88) goto L_021C3D30; else goto L_021C3D6C;
   L_021C3D30: ; // 0x21c3d30
@@ -14571,8 +14571,8 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C3D7C */ _t97 = cpu->r[1] + 0x0000001Cu;
         /* 021C3D7C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t97);
         /* 021C3D80 */ cpu->f[9] = fma(cpu->f[13], cpu->f[13], cpu->f[10]);
-        /* 021C3D84 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[27]);
-        /* 021C3D88 */ _t98 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3D84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[27]));
+        /* 021C3D88 */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3D88 */ _t99 = _t98 & 0x00000001u;
         /* 021C3D88 */ if (_t99) goto L_021C3DAC; else goto L_021C3D8C;
   L_021C3D8C: ; // 0x21c3d8c
@@ -14581,8 +14581,8 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C3D94 */ /* nop */
         /* 021C3D98 */ /* nop */
         /* 021C3D9C */ cpu->f[12] = fma(cpu->f[26], cpu->f[13], cpu->f[9]);
-        /* 021C3DA0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[5]);
-        /* 021C3DA4 */ _t100 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3DA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[5]));
+        /* 021C3DA4 */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3DA4 */ _t101 = _t100 & 0x00000001u;
         /* 021C3DA4 */ if (_t101) goto L_021C3DA8; else goto L_021C3EE8;
   L_021C3DA8: ; // 0x21c3da8
@@ -14613,10 +14613,10 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C3DEC */ /* nop */
         /* 021C3DF0 */ /* nop */
         /* 021C3DF4 */ cpu->f[12] = fma(cpu->f[26], cpu->f[13], cpu->f[9]);
-        /* 021C3DF8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[5]);
+        /* 021C3DF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[5]));
         /* 021C3DFC */ _t108 = cpu->r[1] + 0x0000001Cu;
         /* 021C3DFC */ rbrew_write_f32(cpu->mem, _t108, cpu->f[13]);
-        /* 021C3E00 */ _t109 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3E00 */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3E00 */ _t110 = _t109 & 0x00000001u;
         /* 021C3E00 */ if (_t110) goto L_021C3E04; else goto L_021C3EE8;
   L_021C3E04: ; // 0x21c3e04
@@ -14624,14 +14624,14 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C3E04 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t111);
         /* 021C3E08 */ _t112 = cpu->r[9] + 0x00000004u;
         /* 021C3E08 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t112);
-        /* 021C3E0C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[27]);
+        /* 021C3E0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[27]));
         /* 021C3E10 */ cpu->r[30] = 0x00000001u;
-        /* 021C3E14 */ _t113 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3E14 */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3E14 */ _t114 = _t113 & 0x00000001u;
         /* 021C3E14 */ if (_t114) goto L_021C3E20; else goto L_021C3E18;
   L_021C3E18: ; // 0x21c3e18
-        /* 021C3E18 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[27]);
-        /* 021C3E1C */ _t115 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3E18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[27]));
+        /* 021C3E1C */ _t115 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3E1C */ _t116 = _t115 & 0x00000001u;
         /* 021C3E1C */ if (_t116) goto L_021C3E20; else goto L_021C3E38;
   L_021C3E20: ; // 0x21c3e20
@@ -14646,15 +14646,15 @@ void Gambit_fn_021C575C(CPUState* cpu) {
   L_021C3E38: ; // 0x21c3e38
         /* 021C3E38 */ _t119 = cpu->r[10] + 0x00000000u;
         /* 021C3E38 */ cpu->f[26] = rbrew_read_f32(cpu->mem, _t119);
-        /* 021C3E3C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[26], cpu->f[27]);
+        /* 021C3E3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[26], cpu->f[27]));
         /* 021C3E40 */ _t120 = cpu->r[9] + 0x00000000u;
         /* 021C3E40 */ cpu->f[25] = rbrew_read_f32(cpu->mem, _t120);
-        /* 021C3E44 */ _t121 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3E44 */ _t121 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3E44 */ _t122 = _t121 & 0x00000001u;
         /* 021C3E44 */ if (_t122) goto L_021C3E50; else goto L_021C3E48;
   L_021C3E48: ; // 0x21c3e48
-        /* 021C3E48 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[25], cpu->f[27]);
-        /* 021C3E4C */ _t123 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3E48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[25], cpu->f[27]));
+        /* 021C3E4C */ _t123 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3E4C */ _t124 = _t123 & 0x00000001u;
         /* 021C3E4C */ if (_t124) goto L_021C3E50; else goto L_021C3E68;
   L_021C3E50: ; // 0x21c3e50
@@ -14669,15 +14669,15 @@ void Gambit_fn_021C575C(CPUState* cpu) {
   L_021C3E68: ; // 0x21c3e68
         /* 021C3E68 */ _t127 = cpu->r[10] + 0x00000008u;
         /* 021C3E68 */ cpu->f[24] = rbrew_read_f32(cpu->mem, _t127);
-        /* 021C3E6C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[24], cpu->f[27]);
+        /* 021C3E6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[24], cpu->f[27]));
         /* 021C3E70 */ _t128 = cpu->r[9] + 0x00000008u;
         /* 021C3E70 */ cpu->f[23] = rbrew_read_f32(cpu->mem, _t128);
-        /* 021C3E74 */ _t129 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3E74 */ _t129 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3E74 */ _t130 = _t129 & 0x00000001u;
         /* 021C3E74 */ if (_t130) goto L_021C3E80; else goto L_021C3E78;
   L_021C3E78: ; // 0x21c3e78
-        /* 021C3E78 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[23], cpu->f[27]);
-        /* 021C3E7C */ _t131 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3E78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[23], cpu->f[27]));
+        /* 021C3E7C */ _t131 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3E7C */ _t132 = _t131 & 0x00000001u;
         /* 021C3E7C */ if (_t132) goto L_021C3E80; else goto L_021C3E98;
   L_021C3E80: ; // 0x21c3e80
@@ -14690,13 +14690,13 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C3E94 */ _t134 = cpu->r[1] + 0x00000028u;
         /* 021C3E94 */ rbrew_write_f32(cpu->mem, _t134, cpu->f[10]);
   L_021C3E98: ; // 0x21c3e98
-        /* 021C3E98 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[26], cpu->f[27]);
-        /* 021C3E9C */ _t135 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3E98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[26], cpu->f[27]));
+        /* 021C3E9C */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3E9C */ _t136 = _t135 & 0x00000001u;
         /* 021C3E9C */ if (_t136) goto L_021C3EA8; else goto L_021C3EA0;
   L_021C3EA0: ; // 0x21c3ea0
-        /* 021C3EA0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[25], cpu->f[27]);
-        /* 021C3EA4 */ _t137 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3EA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[25], cpu->f[27]));
+        /* 021C3EA4 */ _t137 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3EA4 */ _t138 = _t137 & 0x00000001u;
         /* 021C3EA4 */ if (_t138) goto L_021C3EA8; else goto L_021C3EC0;
   L_021C3EA8: ; // 0x21c3ea8
@@ -14709,13 +14709,13 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C3EBC */ _t140 = cpu->r[1] + 0x0000002Cu;
         /* 021C3EBC */ rbrew_write_f32(cpu->mem, _t140, cpu->f[7]);
   L_021C3EC0: ; // 0x21c3ec0
-        /* 021C3EC0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[24], cpu->f[27]);
-        /* 021C3EC4 */ _t141 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3EC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[24], cpu->f[27]));
+        /* 021C3EC4 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3EC4 */ _t142 = _t141 & 0x00000001u;
         /* 021C3EC4 */ if (_t142) goto L_021C3ED0; else goto L_021C3EC8;
   L_021C3EC8: ; // 0x21c3ec8
-        /* 021C3EC8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[23], cpu->f[27]);
-        /* 021C3ECC */ _t143 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C3EC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[23], cpu->f[27]));
+        /* 021C3ECC */ _t143 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C3ECC */ _t144 = _t143 & 0x00000001u;
         /* 021C3ECC */ if (_t144) goto L_021C3ED0; else goto L_021C3EE8;
   L_021C3ED0: ; // 0x21c3ed0
@@ -14736,15 +14736,15 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C3EEC */ if (_t149) goto L_021C3CA4; else goto L_021C3EF0;
   L_021C3EF0: ; // 0x21c3ef0
         /* 021C3EF0 */ cpu->r[5] = cpu->r[5] + 0xFFFFFFFFu;
-        /* 021C3EF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021C3EF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021C3EF4 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
         /* 021C3EF8 */ cpu->r[10] = cpu->r[10] + 0x0000000Cu;
-        /* 021C3EFC */ _t150 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3EFC */ _t150 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3EFC */ _t151 = _t150 & 0x00000001u;
         /* 021C3EFC */ if (_t151) goto L_021C3F00; else goto L_021C3C50;
   L_021C3F00: ; // 0x21c3f00
-        /* 021C3F00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021C3F04 */ _t152 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C3F00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021C3F04 */ _t152 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C3F04 */ _t153 = _t152 & 0x00000001u;
         /* 021C3F04 */ if (_t153) goto L_021C4128; else goto L_021C3F08;
   L_021C3F08: ; // 0x21c3f08
@@ -14765,7 +14765,7 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C3F24 */ cpu->r[0] = rbrew_read32(cpu->mem, _t160);
         /* 021C3F28 */ _t161 = cpu->r[1] + 0x00000024u;
         /* 021C3F28 */ cpu->f[5] = rbrew_read_f32(cpu->mem, _t161);
-        /* 021C3F2C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[9]);
+        /* 021C3F2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[9]));
         /* 021C3F30 */ _t162 = cpu->r[1] + 0x00000040u;
         /* 021C3F30 */ rbrew_write32(cpu->mem, _t162, cpu->r[0]);
         /* 021C3F34 */ cpu->f[0] = cpu->f[5];
@@ -14773,16 +14773,16 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C3F38 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t163);
         /* 021C3F3C */ _t164 = cpu->r[1] + 0x00000034u;
         /* 021C3F3C */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t164);
-        /* 021C3F40 */ _t165 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3F40 */ _t165 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3F40 */ _t166 = _t165 & 0x00000001u;
         /* 021C3F40 */ if (_t166) goto L_021C3F44; else goto L_021C3F48;
   L_021C3F44: ; // 0x21c3f44
         /* 021C3F44 */ cpu->f[10] = cpu->f[9];
   L_021C3F48: ; // 0x21c3f48
         /* 021C3F48 */ cpu->f[6] = -cpu->f[8];
-        /* 021C3F4C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[7]);
+        /* 021C3F4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[7]));
         /* 021C3F50 */ cpu->f[9] = cpu->f[10];
-        /* 021C3F54 */ _t167 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3F54 */ _t167 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3F54 */ _t168 = _t167 & 0x00000001u;
         /* 021C3F54 */ if (_t168) goto L_021C3F58; else goto L_021C3F5C;
   L_021C3F58: ; // 0x21c3f58
@@ -14791,24 +14791,24 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C3F5C */ cpu->f[6] = fabs(cpu->f[10]);
         /* 021C3F60 */ cpu->f[4] = fabs(cpu->f[5]);
         /* 021C3F64 */ cpu->f[7] = cpu->f[8];
-        /* 021C3F68 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[4], cpu->f[6]);
+        /* 021C3F68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[4], cpu->f[6]));
         /* 021C3F6C */ cpu->f[13] = fabs(cpu->f[8]);
-        /* 021C3F70 */ _t169 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3F70 */ _t169 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3F70 */ _t170 = _t169 & 0x00000001u;
         /* 021C3F70 */ if (_t170) goto L_021C3F74; else goto L_021C3F88;
   L_021C3F74: ; // 0x21c3f74
-        /* 021C3F74 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[4]);
+        /* 021C3F74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[4]));
         /* 021C3F78 */ cpu->r[8] = 0x10030000u;
         /* 021C3F7C */ _t171 = cpu->r[8] + 0xFFFFB6A0u;
         /* 021C3F7C */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t171);
-        /* 021C3F80 */ _t172 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3F80 */ _t172 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3F80 */ _t173 = _t172 & 0x00000001u;
         /* 021C3F80 */ if (_t173) goto L_021C4040; else goto L_021C3F84;
   L_021C3F84: ; // 0x21c3f84
         /* 021C3F84 */ goto L_021C3FE0;
   L_021C3F88: ; // 0x21c3f88
-        /* 021C3F88 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[4], cpu->f[13]);
-        /* 021C3F8C */ _t174 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3F88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[4], cpu->f[13]));
+        /* 021C3F8C */ _t174 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3F8C */ _t175 = _t174 & 0x00000001u;
         /* 021C3F8C */ if (_t175) goto L_021C3FD0; else goto L_021C3F90;
   L_021C3F90: ; // 0x21c3f90
@@ -14828,27 +14828,27 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C3FB4 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t179);
         /* 021C3FB8 */ _t180 = cpu->r[1] + 0x00000040u;
         /* 021C3FB8 */ rbrew_write_f32(cpu->mem, _t180, cpu->f[8]);
-        /* 021C3FBC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[7]);
+        /* 021C3FBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[7]));
         /* 021C3FC0 */ _t181 = cpu->r[1] + 0x0000003Cu;
         /* 021C3FC0 */ rbrew_write_f32(cpu->mem, _t181, cpu->f[5]);
         /* 021C3FC4 */ _t182 = cpu->r[31] + 0x00000138u;
         /* 021C3FC4 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t182);
-        /* 021C3FC8 */ _t183 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3FC8 */ _t183 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3FC8 */ _t184 = _t183 & 0x00000001u;
         /* 021C3FC8 */ if (_t184) goto L_021C3FCC; else goto L_021C40D4;
   L_021C3FCC: ; // 0x21c3fcc
         /* 021C3FCC */ goto L_021C40CC;
   L_021C3FD0: ; // 0x21c3fd0
-        /* 021C3FD0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[4]);
+        /* 021C3FD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[4]));
         /* 021C3FD4 */ cpu->r[8] = 0x10030000u;
         /* 021C3FD8 */ _t185 = cpu->r[8] + 0xFFFFB6A0u;
         /* 021C3FD8 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t185);
-        /* 021C3FDC */ _t186 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3FDC */ _t186 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3FDC */ _t187 = _t186 & 0x00000001u;
         /* 021C3FDC */ if (_t187) goto L_021C4040; else goto L_021C3FE0;
   L_021C3FE0: ; // 0x21c3fe0
-        /* 021C3FE0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[13]);
-        /* 021C3FE4 */ _t188 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C3FE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[13]));
+        /* 021C3FE4 */ _t188 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C3FE4 */ _t189 = _t188 & 0x00000001u;
         /* 021C3FE4 */ if (_t189) goto L_021C4040; else goto L_021C3FE8;
   L_021C3FE8: ; // 0x21c3fe8
@@ -14861,7 +14861,7 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C3FF8 */ cpu->f[8] = cpu->f[8] * cpu->f[13];
         /* 021C3FFC */ cpu->f[10] = cpu->f[10] * cpu->f[9];
         /* 021C4000 */ /* nop */
-        /* 021C4004 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[11]);
+        /* 021C4004 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[11]));
         /* 021C4008 */ _t192 = cpu->r[1] + 0x0000003Cu;
         /* 021C4008 */ rbrew_write_f32(cpu->mem, _t192, cpu->f[5]);
         /* 021C400C */ cpu->f[10] = fma(cpu->f[30], cpu->f[6], cpu->f[10]);
@@ -14869,7 +14869,7 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C4010 */ rbrew_write_f32(cpu->mem, _t193, cpu->f[8]);
         /* 021C4014 */ _t194 = cpu->r[1] + 0x00000038u;
         /* 021C4014 */ rbrew_write_f32(cpu->mem, _t194, cpu->f[10]);
-        /* 021C4018 */ _t195 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4018 */ _t195 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4018 */ _t196 = _t195 & 0x00000001u;
         /* 021C4018 */ if (_t196) goto L_021C40BC; else goto L_021C401C;
   L_021C401C: ; // 0x21c401c
@@ -14878,25 +14878,25 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C4020 */ _t198 = cpu->r[31] + 0x00000134u;
         /* 021C4020 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t198);
         /* 021C4024 */ /* nop */
-        /* 021C4028 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[7]);
+        /* 021C4028 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[7]));
         /* 021C402C */ cpu->f[8] = fma(cpu->f[30], cpu->f[9], cpu->f[8]);
         /* 021C4030 */ _t199 = cpu->r[31] + 0x00000138u;
         /* 021C4030 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t199);
         /* 021C4034 */ _t200 = cpu->r[1] + 0x00000040u;
         /* 021C4034 */ rbrew_write_f32(cpu->mem, _t200, cpu->f[8]);
-        /* 021C4038 */ _t201 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C4038 */ _t201 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C4038 */ _t202 = _t201 & 0x00000001u;
         /* 021C4038 */ if (_t202) goto L_021C403C; else goto L_021C40D4;
   L_021C403C: ; // 0x21c403c
         /* 021C403C */ goto L_021C40CC;
   L_021C4040: ; // 0x21c4040
-        /* 021C4040 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[4]);
-        /* 021C4044 */ _t203 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C4040 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[4]));
+        /* 021C4044 */ _t203 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C4044 */ _t204 = _t203 & 0x00000001u;
         /* 021C4044 */ if (_t204) goto L_021C4050; else goto L_021C4048;
   L_021C4048: ; // 0x21c4048
-        /* 021C4048 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[6]);
-        /* 021C404C */ _t205 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C4048 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[6]));
+        /* 021C404C */ _t205 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C404C */ _t206 = _t205 & 0x00000001u;
         /* 021C404C */ if (_t206) goto L_021C4050; else goto L_021C4070;
   L_021C4050: ; // 0x21c4050
@@ -14906,12 +14906,12 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C4054 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t208);
         /* 021C4058 */ _t209 = cpu->r[1] + 0x0000003Cu;
         /* 021C4058 */ rbrew_write_f32(cpu->mem, _t209, cpu->f[0]);
-        /* 021C405C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[7]);
+        /* 021C405C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[7]));
         /* 021C4060 */ _t210 = cpu->r[1] + 0x00000038u;
         /* 021C4060 */ rbrew_write_f32(cpu->mem, _t210, cpu->f[9]);
         /* 021C4064 */ _t211 = cpu->r[31] + 0x00000138u;
         /* 021C4064 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t211);
-        /* 021C4068 */ _t212 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C4068 */ _t212 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C4068 */ _t213 = _t212 & 0x00000001u;
         /* 021C4068 */ if (_t213) goto L_021C406C; else goto L_021C40D4;
   L_021C406C: ; // 0x21c406c
@@ -14927,13 +14927,13 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C4084 */ cpu->f[8] = cpu->f[8] * cpu->f[6];
         /* 021C4088 */ _t216 = cpu->r[1] + 0x0000003Cu;
         /* 021C4088 */ rbrew_write_f32(cpu->mem, _t216, cpu->f[5]);
-        /* 021C408C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[11]);
+        /* 021C408C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[11]));
         /* 021C4090 */ _t217 = cpu->r[1] + 0x00000040u;
         /* 021C4090 */ rbrew_write_f32(cpu->mem, _t217, cpu->f[8]);
         /* 021C4094 */ cpu->f[6] = cpu->f[8];
         /* 021C4098 */ _t218 = cpu->r[1] + 0x00000038u;
         /* 021C4098 */ rbrew_write_f32(cpu->mem, _t218, cpu->f[10]);
-        /* 021C409C */ _t219 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C409C */ _t219 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C409C */ _t220 = _t219 & 0x00000001u;
         /* 021C409C */ if (_t220) goto L_021C40B0; else goto L_021C40A0;
   L_021C40A0: ; // 0x21c40a0
@@ -14951,10 +14951,10 @@ void Gambit_fn_021C575C(CPUState* cpu) {
   L_021C40BC: ; // 0x21c40bc
         /* 021C40BC */ _t224 = cpu->r[31] + 0x00000134u;
         /* 021C40BC */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t224);
-        /* 021C40C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[7]);
+        /* 021C40C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[7]));
         /* 021C40C4 */ _t225 = cpu->r[31] + 0x00000138u;
         /* 021C40C4 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t225);
-        /* 021C40C8 */ _t226 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C40C8 */ _t226 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C40C8 */ _t227 = _t226 & 0x00000001u;
         /* 021C40C8 */ if (_t227) goto L_021C40CC; else goto L_021C40D4;
   L_021C40CC: ; // 0x21c40cc
@@ -14963,10 +14963,10 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C40D0 */ _t229 = cpu->r[1] + 0x00000038u;
         /* 021C40D0 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t229);
   L_021C40D4: ; // 0x21c40d4
-        /* 021C40D4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[5], cpu->f[9]);
+        /* 021C40D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[5], cpu->f[9]));
         /* 021C40D8 */ _t230 = cpu->r[31] + 0x0000013Cu;
         /* 021C40D8 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t230);
-        /* 021C40DC */ _t231 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C40DC */ _t231 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C40DC */ _t232 = _t231 & 0x00000001u;
         /* 021C40DC */ if (_t232) goto L_021C40E0; else goto L_021C40E8;
   L_021C40E0: ; // 0x21c40e0
@@ -14975,10 +14975,10 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C40E4 */ _t234 = cpu->r[1] + 0x0000003Cu;
         /* 021C40E4 */ cpu->f[5] = rbrew_read_f32(cpu->mem, _t234);
   L_021C40E8: ; // 0x21c40e8
-        /* 021C40E8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[11]);
+        /* 021C40E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[11]));
         /* 021C40EC */ _t235 = cpu->r[31] + 0x00000140u;
         /* 021C40EC */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t235);
-        /* 021C40F0 */ _t236 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C40F0 */ _t236 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C40F0 */ _t237 = _t236 & 0x00000001u;
         /* 021C40F0 */ if (_t237) goto L_021C40F4; else goto L_021C40FC;
   L_021C40F4: ; // 0x21c40f4
@@ -14987,28 +14987,28 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C40F8 */ _t239 = cpu->r[1] + 0x00000040u;
         /* 021C40F8 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t239);
   L_021C40FC: ; // 0x21c40fc
-        /* 021C40FC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[12]);
+        /* 021C40FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[12]));
         /* 021C4100 */ _t240 = cpu->r[31] + 0x00000144u;
         /* 021C4100 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t240);
-        /* 021C4104 */ _t241 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4104 */ _t241 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4104 */ _t242 = _t241 & 0x00000001u;
         /* 021C4104 */ if (_t242) goto L_021C4108; else goto L_021C410C;
   L_021C4108: ; // 0x21c4108
         /* 021C4108 */ _t243 = cpu->r[31] + 0x00000140u;
         /* 021C4108 */ rbrew_write_f32(cpu->mem, _t243, cpu->f[10]);
   L_021C410C: ; // 0x21c410c
-        /* 021C410C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[5], cpu->f[13]);
+        /* 021C410C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[5], cpu->f[13]));
         /* 021C4110 */ _t244 = cpu->r[31] + 0x00000148u;
         /* 021C4110 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t244);
-        /* 021C4114 */ _t245 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C4114 */ _t245 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4114 */ _t246 = _t245 & 0x00000001u;
         /* 021C4114 */ if (_t246) goto L_021C4118; else goto L_021C411C;
   L_021C4118: ; // 0x21c4118
         /* 021C4118 */ _t247 = cpu->r[31] + 0x00000144u;
         /* 021C4118 */ rbrew_write_f32(cpu->mem, _t247, cpu->f[5]);
   L_021C411C: ; // 0x21c411c
-        /* 021C411C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
-        /* 021C4120 */ _t248 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C411C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
+        /* 021C4120 */ _t248 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C4120 */ _t249 = _t248 & 0x00000001u;
         /* 021C4120 */ if (_t249) goto L_021C4124; else goto L_021C4128;
   L_021C4124: ; // 0x21c4124
@@ -15024,11 +15024,11 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C4138 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021C413C */ cpu->r[3] = cpu->r[31] + 0x00000084u;
         /* 021C4140 */ Gambit_fn_020510A8(cpu);
-        /* 021C4144 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 021C4144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 021C4148 */ _t253 = cpu->r[31] + 0x00000004u;
         /* 021C4148 */ cpu->r[29] = rbrew_read32(cpu->mem, _t253);
         /* 021C414C */ cpu->r[3] = cpu->r[31];
-        /* 021C4150 */ _t254 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C4150 */ _t254 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C4150 */ _t255 = _t254 & 0x00000001u;
         /* 021C4150 */ if (_t255) goto L_021C41B0; else goto L_021C4154;
   L_021C4154: ; // 0x21c4154
@@ -15161,7 +15161,7 @@ void Gambit_fn_021C575C(CPUState* cpu) {
         /* 021C4280 */ cpu->r[31] = rbrew_read32(cpu->mem, _t304);
         /* 021C4284 */ _t305 = cpu->r[1] + 0x00000080u;
         /* 021C4284 */ cpu->r[30] = rbrew_read32(cpu->mem, _t305);
-        /* 021C4288 */ _t306 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C4288 */ _t306 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C4288 */ _t307 = _t306 & 0x00000001u;
         /* 021C4288 */ if (_t307) goto L_021C428C; // else: addr-0 trap, fall-through
   L_021C428C: ; // 0x21c428c
@@ -15203,9 +15203,9 @@ void Gambit_fn_021C576C(CPUState* cpu) {
         /* 021C5790 */ cpu->r[7] = rbrew_read32(cpu->mem, _t6);
         /* 021C5794 */ cpu->r[30] = cpu->r[4];
         /* 021C5798 */ cpu->r[10] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C5798 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021C5798 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021C579C */ cpu->r[28] = cpu->r[31] + 0x00000048u;
-        /* 021C57A0 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C57A0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C57A0 */ _t8 = _t7 & 0x00000001u;
         /* 021C57A0 */ if (_t8) goto L_021C57EC; else goto L_021C57A4;
   L_021C57A4: ; // 0x21c57a4
@@ -15214,10 +15214,10 @@ void Gambit_fn_021C576C(CPUState* cpu) {
         /* 021C57AC */ cpu->r[10] = 0x10030000u;
         /* 021C57B0 */ _t9 = cpu->r[10] + 0xFFFFB5F8u;
         /* 021C57B0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t9);
-        /* 021C57B4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
+        /* 021C57B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
         /* 021C57B8 */ _t10 = cpu->r[31] + 0x00000000u;
         /* 021C57B8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t10);
-        /* 021C57BC */ _t11 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C57BC */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C57BC */ _t12 = _t11 & 0x00000001u;
         /* 021C57BC */ if (_t12) goto L_021C57C0; else goto L_021C57E4;
   L_021C57C0: ; // 0x21c57c0
@@ -15325,9 +15325,9 @@ void Gambit_fn_021C5770(CPUState* cpu) {
         /* 021C5790 */ cpu->r[7] = rbrew_read32(cpu->mem, _t6);
         /* 021C5794 */ cpu->r[30] = cpu->r[4];
         /* 021C5798 */ cpu->r[10] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C5798 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021C5798 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021C579C */ cpu->r[28] = cpu->r[31] + 0x00000048u;
-        /* 021C57A0 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C57A0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C57A0 */ _t8 = _t7 & 0x00000001u;
         /* 021C57A0 */ if (_t8) goto L_021C57EC; else goto L_021C57A4;
   L_021C57A4: ; // 0x21c57a4
@@ -15336,10 +15336,10 @@ void Gambit_fn_021C5770(CPUState* cpu) {
         /* 021C57AC */ cpu->r[10] = 0x10030000u;
         /* 021C57B0 */ _t9 = cpu->r[10] + 0xFFFFB5F8u;
         /* 021C57B0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t9);
-        /* 021C57B4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
+        /* 021C57B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
         /* 021C57B8 */ _t10 = cpu->r[31] + 0x00000000u;
         /* 021C57B8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t10);
-        /* 021C57BC */ _t11 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C57BC */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C57BC */ _t12 = _t11 & 0x00000001u;
         /* 021C57BC */ if (_t12) goto L_021C57C0; else goto L_021C57E4;
   L_021C57C0: ; // 0x21c57c0
@@ -15475,10 +15475,10 @@ void Gambit_fn_021C589C(CPUState* cpu) {
         /* 021C5908 */ cpu->r[12] = 0x10030000u;
         /* 021C590C */ _t16 = cpu->r[10] + 0xFFFFB5F8u;
         /* 021C590C */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t16);
-        /* 021C5910 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021C5910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021C5914 */ _t17 = cpu->r[12] + 0xFFFFB5F4u;
         /* 021C5914 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t17);
-        /* 021C5918 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C5918 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C5918 */ _t19 = _t18 & 0x00000001u;
         /* 021C5918 */ if (_t19) goto L_021C59D8; else goto L_021C591C;
   L_021C591C: ; // 0x21c591c
@@ -15487,27 +15487,27 @@ void Gambit_fn_021C589C(CPUState* cpu) {
         /* 021C5920 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t20);
         /* 021C5924 */ _t21 = cpu->r[10] + 0xFFFFB71Cu;
         /* 021C5924 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t21);
-        /* 021C5928 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[0]);
+        /* 021C5928 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[0]));
         /* 021C592C */ cpu->r[31] = cpu->r[30] + 0x000000B4u;
-        /* 021C5930 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C5930 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C5930 */ _t23 = _t22 & 0x00000001u;
         /* 021C5930 */ if (_t23) goto L_021C597C; else goto L_021C5934;
   L_021C5934: ; // 0x21c5934
         /* 021C5934 */ _t24 = cpu->r[30] + 0x00000000u;
         /* 021C5934 */ cpu->r[12] = rbrew_read32(cpu->mem, _t24);
         /* 021C5938 */ cpu->r[10] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021C5938 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021C5938 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021C593C */ cpu->r[31] = cpu->r[30] + 0x000000A8u;
-        /* 021C5940 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C5940 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C5940 */ _t26 = _t25 & 0x00000001u;
         /* 021C5940 */ if (_t26) goto L_021C597C; else goto L_021C5944;
   L_021C5944: ; // 0x21c5944
         /* 021C5944 */ cpu->r[3] = cpu->r[30] + 0x00000138u;
         /* 021C5948 */ Gambit_fn_02C69350(cpu);
-        /* 021C594C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 021C594C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 021C5950 */ _t27 = cpu->r[30] + 0x00000000u;
         /* 021C5950 */ cpu->r[11] = rbrew_read32(cpu->mem, _t27);
-        /* 021C5954 */ _t28 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C5954 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C5954 */ _t29 = _t28 & 0x00000001u;
         /* 021C5954 */ if (_t29) goto L_021C5958; else goto L_021C5974;
   L_021C5958: ; // 0x21c5958
@@ -15555,9 +15555,9 @@ void Gambit_fn_021C589C(CPUState* cpu) {
         /* 021C59C0 */ _t43 = cpu->r[1] + 0x0000000Cu;
         /* 021C59C0 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t43);
         /* 021C59C4 */ cpu->f[29] = cpu->f[1];
-        /* 021C59C8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[30]);
+        /* 021C59C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[30]));
         /* 021C59CC */ cpu->f[31] = cpu->f[29];
-        /* 021C59D0 */ _t44 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C59D0 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C59D0 */ _t45 = _t44 & 0x00000001u;
         /* 021C59D0 */ if (_t45) goto L_021C59D4; else goto L_021C5AC0;
   L_021C59D4: ; // 0x21c59d4
@@ -15566,18 +15566,18 @@ void Gambit_fn_021C589C(CPUState* cpu) {
         /* 021C59D8 */ _t46 = cpu->r[30] + 0x00000000u;
         /* 021C59D8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t46);
         /* 021C59DC */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021C59DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021C59DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021C59E0 */ cpu->r[31] = cpu->r[30] + 0x000000A8u;
-        /* 021C59E4 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C59E4 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C59E4 */ _t48 = _t47 & 0x00000001u;
         /* 021C59E4 */ if (_t48) goto L_021C5A20; else goto L_021C59E8;
   L_021C59E8: ; // 0x21c59e8
         /* 021C59E8 */ cpu->r[3] = cpu->r[30] + 0x00000138u;
         /* 021C59EC */ Gambit_fn_02C69350(cpu);
-        /* 021C59F0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 021C59F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 021C59F4 */ _t49 = cpu->r[30] + 0x00000000u;
         /* 021C59F4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t49);
-        /* 021C59F8 */ _t50 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C59F8 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C59F8 */ _t51 = _t50 & 0x00000001u;
         /* 021C59F8 */ if (_t51) goto L_021C59FC; else goto L_021C5A18;
   L_021C59FC: ; // 0x21c59fc
@@ -15625,9 +15625,9 @@ void Gambit_fn_021C589C(CPUState* cpu) {
         /* 021C5A64 */ _t65 = cpu->r[1] + 0x0000000Cu;
         /* 021C5A64 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t65);
         /* 021C5A68 */ cpu->f[29] = cpu->f[1];
-        /* 021C5A6C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[30]);
+        /* 021C5A6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[30]));
         /* 021C5A70 */ cpu->f[31] = cpu->f[29];
-        /* 021C5A74 */ _t66 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C5A74 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C5A74 */ _t67 = _t66 & 0x00000001u;
         /* 021C5A74 */ if (_t67) goto L_021C5A78; else goto L_021C5AC0;
   L_021C5A78: ; // 0x21c5a78
@@ -15737,7 +15737,7 @@ void Gambit_fn_021C589C(CPUState* cpu) {
         /* 021C5B8C */ cpu->r[31] = rbrew_read32(cpu->mem, _t99);
         /* 021C5B90 */ _t100 = cpu->r[1] + 0x00000040u;
         /* 021C5B90 */ cpu->r[30] = rbrew_read32(cpu->mem, _t100);
-        /* 021C5B94 */ _t101 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C5B94 */ _t101 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C5B94 */ _t102 = _t101 & 0x00000001u;
         /* 021C5B94 */ if (_t102) goto L_021C5B98; // else: addr-0 trap, fall-through
   L_021C5B98: ; // 0x21c5b98
@@ -15918,10 +15918,10 @@ void Gambit_fn_021C5BA8(CPUState* cpu) {
         /* 021C5D38 */ _t60 = cpu->r[5] + 0xFFFFB604u;
         /* 021C5D38 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t60);
         /* 021C5D3C */ cpu->r[7] = 0x10030000u;
-        /* 021C5D40 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[29]);
+        /* 021C5D40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[29]));
         /* 021C5D44 */ _t61 = cpu->r[7] + 0xFFFFB600u;
         /* 021C5D44 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t61);
-        /* 021C5D48 */ _t62 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C5D48 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C5D48 */ _t63 = _t62 & 0x00000001u;
         /* 021C5D48 */ if (_t63) goto L_021C5D4C; else goto L_021C5D7C;
   L_021C5D4C: ; // 0x21c5d4c
@@ -15964,8 +15964,8 @@ void Gambit_fn_021C5BA8(CPUState* cpu) {
         /* 021C5DA8 */ cpu->f[12] = cpu->f[27] * cpu->f[27];
         /* 021C5DAC */ cpu->f[13] = fma(cpu->f[28], cpu->f[28], cpu->f[12]);
         /* 021C5DB0 */ cpu->f[6] = fma(cpu->f[26], cpu->f[26], cpu->f[13]);
-        /* 021C5DB4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[29]);
-        /* 021C5DB8 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C5DB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[29]));
+        /* 021C5DB8 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C5DB8 */ _t77 = _t76 & 0x00000001u;
         /* 021C5DB8 */ if (_t77) goto L_021C5DC4; else goto L_021C5DBC;
   L_021C5DBC: ; // 0x21c5dbc
@@ -16159,13 +16159,13 @@ void Gambit_fn_021C5BA8(CPUState* cpu) {
         /* 021C5F74 */ Gambit_fn_023C9CBC(cpu);
         /* 021C5F78 */ _t151 = cpu->r[28] + 0x0000001Cu;
         /* 021C5F78 */ cpu->r[0] = rbrew_read32(cpu->mem, _t151);
-        /* 021C5F7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021C5F80 */ _t152 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C5F7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021C5F80 */ _t152 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C5F80 */ _t153 = _t152 & 0x00000001u;
         /* 021C5F80 */ if (_t153) goto L_021C5F8C; else goto L_021C5F84;
   L_021C5F84: ; // 0x21c5f84
-        /* 021C5F84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021C5F88 */ _t154 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C5F84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021C5F88 */ _t154 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C5F88 */ _t155 = _t154 & 0x00000001u;
         /* 021C5F88 */ if (_t155) goto L_021C5F8C; else goto L_021C5FE8;
   L_021C5F8C: ; // 0x21c5f8c
@@ -16224,9 +16224,9 @@ void Gambit_fn_021C5BA8(CPUState* cpu) {
         /* 021C6014 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t172);
         /* 021C6018 */ cpu->f[12] = fma(cpu->f[7], cpu->f[7], cpu->f[10]);
         /* 021C601C */ cpu->f[8] = fma(cpu->f[6], cpu->f[6], cpu->f[12]);
-        /* 021C6020 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[29]);
+        /* 021C6020 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[29]));
         /* 021C6024 */ cpu->f[28] = cpu->f[1];
-        /* 021C6028 */ _t173 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6028 */ _t173 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C6028 */ _t174 = _t173 & 0x00000001u;
         /* 021C6028 */ if (_t174) goto L_021C602C; else goto L_021C6058;
   L_021C602C: ; // 0x21c602c
@@ -16276,7 +16276,7 @@ void Gambit_fn_021C5BA8(CPUState* cpu) {
         /* 021C60A4 */ cpu->r[5] = 0x10030000u;
         /* 021C60A8 */ _t187 = cpu->r[8] + 0xFFFF958Cu;
         /* 021C60A8 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t187);
-        /* 021C60AC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[27], cpu->f[29]);
+        /* 021C60AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[27], cpu->f[29]));
         /* 021C60B0 */ _t188 = cpu->r[1] + 0x000000E0u;
         /* 021C60B0 */ rbrew_write32(cpu->mem, _t188, cpu->r[12]);
         /* 021C60B4 */ /* nop */
@@ -16304,11 +16304,11 @@ void Gambit_fn_021C5BA8(CPUState* cpu) {
   L_021C60F8: ; // 0x21c60f8
         /* 021C60F8 */ cpu->r[3] = cpu->r[1] + 0x00000024u;
         /* 021C60FC */ Gambit_fn_02043AC4(cpu);
-        /* 021C6100 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021C6100 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021C6104 */ _t194 = cpu->r[25] + 0x00000000u;
         /* 021C6104 */ cpu->r[3] = rbrew_read32(cpu->mem, _t194);
         /* 021C6108 */ cpu->f[3] = cpu->f[31];
-        /* 021C610C */ _t195 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C610C */ _t195 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C610C */ _t196 = _t195 & 0x00000001u;
         /* 021C610C */ if (_t196) goto L_021C6150; else goto L_021C6110;
   L_021C6110: ; // 0x21c6110
@@ -16327,10 +16327,10 @@ void Gambit_fn_021C5BA8(CPUState* cpu) {
         /* 021C6138 */ rbrew_write32(cpu->mem, _t198, cpu->r[0]);
         /* 021C613C */ Gambit_fn_0204A4DC(cpu);
         /* 021C6140 */ cpu->r[9] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C6140 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021C6140 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021C6144 */ _t199 = cpu->r[1] + 0x00000024u;
         /* 021C6144 */ rbrew_write32(cpu->mem, _t199, cpu->r[3]);
-        /* 021C6148 */ _t200 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6148 */ _t200 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6148 */ _t201 = _t200 & 0x00000001u;
         /* 021C6148 */ if (_t201) goto L_021C64AC; else goto L_021C614C;
   L_021C614C: ; // 0x21c614c
@@ -16348,10 +16348,10 @@ void Gambit_fn_021C5BA8(CPUState* cpu) {
         /* 021C6170 */ cpu->r[9] = cpu->r[1] + 0x00000024u;
         /* 021C6174 */ Gambit_fn_0204A864(cpu);
         /* 021C6178 */ cpu->r[9] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C6178 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021C6178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021C617C */ _t203 = cpu->r[1] + 0x00000024u;
         /* 021C617C */ rbrew_write32(cpu->mem, _t203, cpu->r[3]);
-        /* 021C6180 */ _t204 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6180 */ _t204 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6180 */ _t205 = _t204 & 0x00000001u;
         /* 021C6180 */ if (_t205) goto L_021C64AC; else goto L_021C6184;
   L_021C6184: ; // 0x21c6184
@@ -16360,25 +16360,25 @@ void Gambit_fn_021C5BA8(CPUState* cpu) {
         /* 021C6188 */ _t207 = cpu->r[31] + 0x0000015Cu;
         /* 021C6188 */ cpu->r[4] = rbrew_read32(cpu->mem, _t207);
         /* 021C618C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021C618C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021C618C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021C6190 */ _t208 = cpu->r[31] + 0x00000000u;
         /* 021C6190 */ cpu->r[7] = rbrew_read32(cpu->mem, _t208);
-        /* 021C6194 */ _t209 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6194 */ _t209 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6194 */ _t210 = _t209 & 0x00000001u;
         /* 021C6194 */ if (_t210) goto L_021C6224; else goto L_021C6198;
   L_021C6198: ; // 0x21c6198
         /* 021C6198 */ cpu->r[7] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021C6198 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021C619C */ _t211 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6198 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021C619C */ _t211 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C619C */ _t212 = _t211 & 0x00000001u;
         /* 021C619C */ if (_t212) goto L_021C61D8; else goto L_021C61A0;
   L_021C61A0: ; // 0x21c61a0
         /* 021C61A0 */ cpu->r[3] = cpu->r[31] + 0x00000138u;
         /* 021C61A4 */ Gambit_fn_02C69350(cpu);
-        /* 021C61A8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[29]);
+        /* 021C61A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[29]));
         /* 021C61AC */ _t213 = cpu->r[31] + 0x00000000u;
         /* 021C61AC */ cpu->r[6] = rbrew_read32(cpu->mem, _t213);
-        /* 021C61B0 */ _t214 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C61B0 */ _t214 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C61B0 */ _t215 = _t214 & 0x00000001u;
         /* 021C61B0 */ if (_t215) goto L_021C61B4; else goto L_021C61D0;
   L_021C61B4: ; // 0x21c61b4
@@ -16421,27 +16421,27 @@ void Gambit_fn_021C5BA8(CPUState* cpu) {
         /* 021C620C */ _t228 = cpu->r[1] + 0x0000003Cu;
         /* 021C620C */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t228);
         /* 021C6210 */ cpu->f[10] = fma(cpu->f[7], cpu->f[8], cpu->f[0]);
-        /* 021C6214 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[29]);
+        /* 021C6214 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[29]));
         /* 021C6218 */ _t229 = cpu->r[1] + 0x00000060u;
         /* 021C6218 */ rbrew_write32(cpu->mem, _t229, cpu->r[5]);
-        /* 021C621C */ _t230 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C621C */ _t230 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C621C */ _t231 = _t230 & 0x00000001u;
         /* 021C621C */ if (_t231) goto L_021C6310; else goto L_021C6220;
   L_021C6220: ; // 0x21c6220
         /* 021C6220 */ goto L_021C62AC;
   L_021C6224: ; // 0x21c6224
         /* 021C6224 */ cpu->r[6] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C6224 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 021C6228 */ _t232 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6224 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 021C6228 */ _t232 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6228 */ _t233 = _t232 & 0x00000001u;
         /* 021C6228 */ if (_t233) goto L_021C6264; else goto L_021C622C;
   L_021C622C: ; // 0x21c622c
         /* 021C622C */ cpu->r[3] = cpu->r[31] + 0x0000012Cu;
         /* 021C6230 */ Gambit_fn_02C69350(cpu);
-        /* 021C6234 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[29]);
+        /* 021C6234 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[29]));
         /* 021C6238 */ _t234 = cpu->r[31] + 0x00000000u;
         /* 021C6238 */ cpu->r[11] = rbrew_read32(cpu->mem, _t234);
-        /* 021C623C */ _t235 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C623C */ _t235 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C623C */ _t236 = _t235 & 0x00000001u;
         /* 021C623C */ if (_t236) goto L_021C6240; else goto L_021C625C;
   L_021C6240: ; // 0x21c6240
@@ -16484,10 +16484,10 @@ void Gambit_fn_021C5BA8(CPUState* cpu) {
         /* 021C6298 */ _t249 = cpu->r[1] + 0x0000003Cu;
         /* 021C6298 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t249);
         /* 021C629C */ cpu->f[10] = fma(cpu->f[7], cpu->f[8], cpu->f[0]);
-        /* 021C62A0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[29]);
+        /* 021C62A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[29]));
         /* 021C62A4 */ _t250 = cpu->r[1] + 0x00000060u;
         /* 021C62A4 */ rbrew_write32(cpu->mem, _t250, cpu->r[5]);
-        /* 021C62A8 */ _t251 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C62A8 */ _t251 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C62A8 */ _t252 = _t251 & 0x00000001u;
         /* 021C62A8 */ if (_t252) goto L_021C6310; else goto L_021C62AC;
   L_021C62AC: ; // 0x21c62ac
@@ -16531,10 +16531,10 @@ void Gambit_fn_021C5BA8(CPUState* cpu) {
         /* 021C62FC */ _t270 = cpu->r[28] + 0x000001D4u;
         /* 021C62FC */ rbrew_write_f32(cpu->mem, _t270, cpu->f[8]);
         /* 021C6300 */ cpu->r[24] = cpu->r[24] + 0xFFFFFFFFu;
-        /* 021C6300 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 021C6300 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 021C6304 */ _t271 = cpu->r[1] + 0x00000020u;
         /* 021C6304 */ rbrew_write_f32(cpu->mem, _t271, cpu->f[9]);
-        /* 021C6308 */ _t272 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6308 */ _t272 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6308 */ _t273 = _t272 & 0x00000001u;
         /* 021C6308 */ if (_t273) goto L_021C630C; else goto L_021C60F8;
   L_021C630C: ; // 0x21c630c
@@ -16545,27 +16545,27 @@ void Gambit_fn_021C5BA8(CPUState* cpu) {
         /* 021C6314 */ _t275 = cpu->r[29] + 0x0000015Cu;
         /* 021C6314 */ cpu->r[6] = rbrew_read32(cpu->mem, _t275);
         /* 021C6318 */ cpu->r[5] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021C6318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021C6318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021C631C */ _t276 = cpu->r[29] + 0x00000000u;
         /* 021C631C */ cpu->r[0] = rbrew_read32(cpu->mem, _t276);
-        /* 021C6320 */ _t277 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6320 */ _t277 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6320 */ _t278 = _t277 & 0x00000001u;
         /* 021C6320 */ if (_t278) goto L_021C63C4; else goto L_021C6324;
   L_021C6324: ; // 0x21c6324
         /* 021C6324 */ cpu->r[7] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021C6324 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021C6324 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021C6328 */ cpu->r[31] = cpu->r[29] + 0x000000A8u;
         /* 021C632C */ cpu->r[30] = cpu->r[29] + 0x000000C0u;
-        /* 021C6330 */ _t279 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6330 */ _t279 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6330 */ _t280 = _t279 & 0x00000001u;
         /* 021C6330 */ if (_t280) goto L_021C636C; else goto L_021C6334;
   L_021C6334: ; // 0x21c6334
         /* 021C6334 */ cpu->r[3] = cpu->r[29] + 0x00000138u;
         /* 021C6338 */ Gambit_fn_02C69350(cpu);
-        /* 021C633C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[29]);
+        /* 021C633C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[29]));
         /* 021C6340 */ _t281 = cpu->r[29] + 0x00000000u;
         /* 021C6340 */ cpu->r[9] = rbrew_read32(cpu->mem, _t281);
-        /* 021C6344 */ _t282 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6344 */ _t282 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C6344 */ _t283 = _t282 & 0x00000001u;
         /* 021C6344 */ if (_t283) goto L_021C6348; else goto L_021C6364;
   L_021C6348: ; // 0x21c6348
@@ -16619,19 +16619,19 @@ void Gambit_fn_021C5BA8(CPUState* cpu) {
         /* 021C63C0 */ goto L_021C6460;
   L_021C63C4: ; // 0x21c63c4
         /* 021C63C4 */ cpu->r[11] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C63C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021C63C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021C63C8 */ cpu->r[31] = cpu->r[29] + 0x00000048u;
         /* 021C63CC */ cpu->r[30] = cpu->r[29] + 0x00000060u;
-        /* 021C63D0 */ _t299 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C63D0 */ _t299 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C63D0 */ _t300 = _t299 & 0x00000001u;
         /* 021C63D0 */ if (_t300) goto L_021C640C; else goto L_021C63D4;
   L_021C63D4: ; // 0x21c63d4
         /* 021C63D4 */ cpu->r[3] = cpu->r[29] + 0x0000012Cu;
         /* 021C63D8 */ Gambit_fn_02C69350(cpu);
-        /* 021C63DC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[29]);
+        /* 021C63DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[29]));
         /* 021C63E0 */ _t301 = cpu->r[29] + 0x00000000u;
         /* 021C63E0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t301);
-        /* 021C63E4 */ _t302 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C63E4 */ _t302 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C63E4 */ _t303 = _t302 & 0x00000001u;
         /* 021C63E4 */ if (_t303) goto L_021C63E8; else goto L_021C6404;
   L_021C63E8: ; // 0x21c63e8
@@ -16713,10 +16713,10 @@ void Gambit_fn_021C5BA8(CPUState* cpu) {
         /* 021C649C */ _t331 = cpu->r[28] + 0x000001D4u;
         /* 021C649C */ rbrew_write_f32(cpu->mem, _t331, cpu->f[8]);
         /* 021C64A0 */ cpu->r[24] = cpu->r[24] + 0xFFFFFFFFu;
-        /* 021C64A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 021C64A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 021C64A4 */ _t332 = cpu->r[1] + 0x00000020u;
         /* 021C64A4 */ rbrew_write_f32(cpu->mem, _t332, cpu->f[9]);
-        /* 021C64A8 */ _t333 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C64A8 */ _t333 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C64A8 */ _t334 = _t333 & 0x00000001u;
         /* 021C64A8 */ if (_t334) goto L_021C64AC; else goto L_021C60F8;
   L_021C64AC: ; // 0x21c64ac
@@ -16750,7 +16750,7 @@ void Gambit_fn_021C5BA8(CPUState* cpu) {
         /* 021C64E8 */ cpu->f[26] = rbrew_read_f64(cpu->mem, _t346);
         /* 021C64EC */ _t347 = cpu->r[1] + 0x00000158u;
         /* 021C64EC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t347);
-        /* 021C64F0 */ _t348 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C64F0 */ _t348 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C64F0 */ _t349 = _t348 & 0x00000001u;
         /* 021C64F0 */ if (_t349) goto L_021C64F4; // else: addr-0 trap, fall-through
   L_021C64F4: ; // 0x21c64f4
@@ -16787,23 +16787,23 @@ void Gambit_fn_021C6504(CPUState* cpu) {
         /* 021C652C */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
         /* 021C6530 */ _t7 = cpu->r[12] + 0xFFFFB5F8u;
         /* 021C6530 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t7);
-        /* 021C6534 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000004u);
+        /* 021C6534 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000004u));
         /* 021C6538 */ cpu->f[30] = cpu->f[31];
-        /* 021C653C */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C653C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C653C */ _t9 = _t8 & 0x00000001u;
         /* 021C653C */ if (_t9) goto L_021C6540; else goto L_021C6568;
   L_021C6540: ; // 0x21c6540
-        /* 021C6540 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
-        /* 021C6544 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C6540 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
+        /* 021C6544 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C6544 */ _t11 = _t10 & 0x00000001u;
         /* 021C6544 */ if (_t11) goto L_021C659C; else goto L_021C6548;
   L_021C6548: ; // 0x21c6548
-        /* 021C6548 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6548 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6548 */ _t13 = _t12 & 0x00000001u;
         /* 021C6548 */ if (_t13) goto L_021C65C0; else goto L_021C654C;
   L_021C654C: ; // 0x21c654c
-        /* 021C654C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000002u);
-        /* 021C6550 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C654C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000002u));
+        /* 021C6550 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6550 */ _t15 = _t14 & 0x00000001u;
         /* 021C6550 */ if (_t15) goto L_021C65E4; else goto L_021C6554;
   L_021C6554: ; // 0x21c6554
@@ -16813,23 +16813,23 @@ void Gambit_fn_021C6504(CPUState* cpu) {
         /* 021C6560 */ cpu->f[1] = fma(cpu->f[30], cpu->f[1], cpu->f[31]);
         /* 021C6564 */ goto L_021C664C;
   L_021C6568: ; // 0x21c6568
-        /* 021C6568 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000007u);
-        /* 021C656C */ _t16 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6568 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000007u));
+        /* 021C656C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C656C */ _t17 = _t16 & 0x00000001u;
         /* 021C656C */ if (_t17) goto L_021C6570; else goto L_021C6608;
   L_021C6570: ; // 0x21c6570
-        /* 021C6570 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000000Bu);
-        /* 021C6574 */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6570 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000000Bu));
+        /* 021C6574 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C6574 */ _t19 = _t18 & 0x00000001u;
         /* 021C6574 */ if (_t19) goto L_021C6578; else goto L_021C65C0;
   L_021C6578: ; // 0x21c6578
-        /* 021C6578 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000010u);
-        /* 021C657C */ _t20 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C6578 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000010u));
+        /* 021C657C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C657C */ _t21 = _t20 & 0x00000001u;
         /* 021C657C */ if (_t21) goto L_021C663C; else goto L_021C6580;
   L_021C6580: ; // 0x21c6580
-        /* 021C6580 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000013u);
-        /* 021C6584 */ _t22 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6580 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000013u));
+        /* 021C6584 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C6584 */ _t23 = _t22 & 0x00000001u;
         /* 021C6584 */ if (_t23) goto L_021C6588; else goto L_021C662C;
   L_021C6588: ; // 0x21c6588
@@ -16897,7 +16897,7 @@ void Gambit_fn_021C6504(CPUState* cpu) {
         /* 021C6654 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t26);
         /* 021C6658 */ _t27 = cpu->r[1] + 0x00000018u;
         /* 021C6658 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t27);
-        /* 021C665C */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C665C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C665C */ _t29 = _t28 & 0x00000001u;
         /* 021C665C */ if (_t29) goto L_021C6660; // else: addr-0 trap, fall-through
   L_021C6660: ; // 0x21c6660
@@ -16933,23 +16933,23 @@ void Gambit_fn_021C6508(CPUState* cpu) {
         /* 021C652C */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
         /* 021C6530 */ _t7 = cpu->r[12] + 0xFFFFB5F8u;
         /* 021C6530 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t7);
-        /* 021C6534 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000004u);
+        /* 021C6534 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000004u));
         /* 021C6538 */ cpu->f[30] = cpu->f[31];
-        /* 021C653C */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C653C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C653C */ _t9 = _t8 & 0x00000001u;
         /* 021C653C */ if (_t9) goto L_021C6540; else goto L_021C6568;
   L_021C6540: ; // 0x21c6540
-        /* 021C6540 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
-        /* 021C6544 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C6540 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
+        /* 021C6544 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C6544 */ _t11 = _t10 & 0x00000001u;
         /* 021C6544 */ if (_t11) goto L_021C659C; else goto L_021C6548;
   L_021C6548: ; // 0x21c6548
-        /* 021C6548 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6548 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6548 */ _t13 = _t12 & 0x00000001u;
         /* 021C6548 */ if (_t13) goto L_021C65C0; else goto L_021C654C;
   L_021C654C: ; // 0x21c654c
-        /* 021C654C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000002u);
-        /* 021C6550 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C654C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000002u));
+        /* 021C6550 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6550 */ _t15 = _t14 & 0x00000001u;
         /* 021C6550 */ if (_t15) goto L_021C65E4; else goto L_021C6554;
   L_021C6554: ; // 0x21c6554
@@ -16959,23 +16959,23 @@ void Gambit_fn_021C6508(CPUState* cpu) {
         /* 021C6560 */ cpu->f[1] = fma(cpu->f[30], cpu->f[1], cpu->f[31]);
         /* 021C6564 */ goto L_021C664C;
   L_021C6568: ; // 0x21c6568
-        /* 021C6568 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000007u);
-        /* 021C656C */ _t16 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6568 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000007u));
+        /* 021C656C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C656C */ _t17 = _t16 & 0x00000001u;
         /* 021C656C */ if (_t17) goto L_021C6570; else goto L_021C6608;
   L_021C6570: ; // 0x21c6570
-        /* 021C6570 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000000Bu);
-        /* 021C6574 */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6570 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000000Bu));
+        /* 021C6574 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C6574 */ _t19 = _t18 & 0x00000001u;
         /* 021C6574 */ if (_t19) goto L_021C6578; else goto L_021C65C0;
   L_021C6578: ; // 0x21c6578
-        /* 021C6578 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000010u);
-        /* 021C657C */ _t20 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C6578 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000010u));
+        /* 021C657C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C657C */ _t21 = _t20 & 0x00000001u;
         /* 021C657C */ if (_t21) goto L_021C663C; else goto L_021C6580;
   L_021C6580: ; // 0x21c6580
-        /* 021C6580 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000013u);
-        /* 021C6584 */ _t22 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6580 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000013u));
+        /* 021C6584 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C6584 */ _t23 = _t22 & 0x00000001u;
         /* 021C6584 */ if (_t23) goto L_021C6588; else goto L_021C662C;
   L_021C6588: ; // 0x21c6588
@@ -17043,7 +17043,7 @@ void Gambit_fn_021C6508(CPUState* cpu) {
         /* 021C6654 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t26);
         /* 021C6658 */ _t27 = cpu->r[1] + 0x00000018u;
         /* 021C6658 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t27);
-        /* 021C665C */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C665C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C665C */ _t29 = _t28 & 0x00000001u;
         /* 021C665C */ if (_t29) goto L_021C6660; // else: addr-0 trap, fall-through
   L_021C6660: ; // 0x21c6660
@@ -17080,9 +17080,9 @@ void Gambit_fn_021C6670(CPUState* cpu) {
         /* 021C6698 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
         /* 021C669C */ _t7 = cpu->r[12] + 0xFFFFB5F8u;
         /* 021C669C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t7);
-        /* 021C66A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000005u);
+        /* 021C66A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000005u));
         /* 021C66A4 */ cpu->f[30] = cpu->f[31];
-        /* 021C66A8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C66A8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C66A8 */ _t9 = _t8 & 0x00000001u;
         /* 021C66A8 */ if (_t9) goto L_021C66AC; else goto L_021C66D0;
   L_021C66AC: ; // 0x21c66ac
@@ -17096,8 +17096,8 @@ void Gambit_fn_021C6670(CPUState* cpu) {
         /* 021C66C8 */ cpu->f[1] = fma(cpu->f[30], cpu->f[1], cpu->f[31]);
         /* 021C66CC */ goto L_021C6724;
   L_021C66D0: ; // 0x21c66d0
-        /* 021C66D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x0000000Au);
-        /* 021C66D4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C66D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x0000000Au));
+        /* 021C66D4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C66D4 */ _t11 = _t10 & 0x00000001u;
         /* 021C66D4 */ if (_t11) goto L_021C66D8; else goto L_021C66FC;
   L_021C66D8: ; // 0x21c66d8
@@ -17111,8 +17111,8 @@ void Gambit_fn_021C6670(CPUState* cpu) {
         /* 021C66F4 */ cpu->f[1] = fma(cpu->f[30], cpu->f[1], cpu->f[31]);
         /* 021C66F8 */ goto L_021C6724;
   L_021C66FC: ; // 0x21c66fc
-        /* 021C66FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000007u);
-        /* 021C6700 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C66FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000007u));
+        /* 021C6700 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6700 */ _t13 = _t12 & 0x00000001u;
         /* 021C6700 */ if (_t13) goto L_021C6704; else goto L_021C6714;
   L_021C6704: ; // 0x21c6704
@@ -17134,7 +17134,7 @@ void Gambit_fn_021C6670(CPUState* cpu) {
         /* 021C672C */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t16);
         /* 021C6730 */ _t17 = cpu->r[1] + 0x00000018u;
         /* 021C6730 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t17);
-        /* 021C6734 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C6734 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C6734 */ _t19 = _t18 & 0x00000001u;
         /* 021C6734 */ if (_t19) goto L_021C6738; // else: addr-0 trap, fall-through
   L_021C6738: ; // 0x21c6738
@@ -17170,9 +17170,9 @@ void Gambit_fn_021C6674(CPUState* cpu) {
         /* 021C6698 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
         /* 021C669C */ _t7 = cpu->r[12] + 0xFFFFB5F8u;
         /* 021C669C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t7);
-        /* 021C66A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000005u);
+        /* 021C66A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000005u));
         /* 021C66A4 */ cpu->f[30] = cpu->f[31];
-        /* 021C66A8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C66A8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C66A8 */ _t9 = _t8 & 0x00000001u;
         /* 021C66A8 */ if (_t9) goto L_021C66AC; else goto L_021C66D0;
   L_021C66AC: ; // 0x21c66ac
@@ -17186,8 +17186,8 @@ void Gambit_fn_021C6674(CPUState* cpu) {
         /* 021C66C8 */ cpu->f[1] = fma(cpu->f[30], cpu->f[1], cpu->f[31]);
         /* 021C66CC */ goto L_021C6724;
   L_021C66D0: ; // 0x21c66d0
-        /* 021C66D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x0000000Au);
-        /* 021C66D4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C66D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x0000000Au));
+        /* 021C66D4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C66D4 */ _t11 = _t10 & 0x00000001u;
         /* 021C66D4 */ if (_t11) goto L_021C66D8; else goto L_021C66FC;
   L_021C66D8: ; // 0x21c66d8
@@ -17201,8 +17201,8 @@ void Gambit_fn_021C6674(CPUState* cpu) {
         /* 021C66F4 */ cpu->f[1] = fma(cpu->f[30], cpu->f[1], cpu->f[31]);
         /* 021C66F8 */ goto L_021C6724;
   L_021C66FC: ; // 0x21c66fc
-        /* 021C66FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000007u);
-        /* 021C6700 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C66FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000007u));
+        /* 021C6700 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6700 */ _t13 = _t12 & 0x00000001u;
         /* 021C6700 */ if (_t13) goto L_021C6704; else goto L_021C6714;
   L_021C6704: ; // 0x21c6704
@@ -17224,7 +17224,7 @@ void Gambit_fn_021C6674(CPUState* cpu) {
         /* 021C672C */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t16);
         /* 021C6730 */ _t17 = cpu->r[1] + 0x00000018u;
         /* 021C6730 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t17);
-        /* 021C6734 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C6734 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C6734 */ _t19 = _t18 & 0x00000001u;
         /* 021C6734 */ if (_t19) goto L_021C6738; // else: addr-0 trap, fall-through
   L_021C6738: ; // 0x21c6738
@@ -17249,46 +17249,46 @@ void Gambit_fn_021C6748(CPUState* cpu) {
         /* 021C6754 */ _t2 = cpu->r[3] + 0x00000000u;
         /* 021C6754 */ cpu->r[0] = rbrew_read32(cpu->mem, _t2);
         /* 021C6758 */ cpu->r[12] = 0x10030000u;
-        /* 021C675C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000004u);
+        /* 021C675C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000004u));
         /* 021C6760 */ _t3 = cpu->r[12] + 0xFFFFB5F4u;
         /* 021C6760 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t3);
-        /* 021C6764 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C6764 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C6764 */ _t5 = _t4 & 0x00000001u;
         /* 021C6764 */ if (_t5) goto L_021C6768; else goto L_021C6780;
   L_021C6768: ; // 0x21c6768
-        /* 021C6768 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
-        /* 021C676C */ _t6 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C6768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
+        /* 021C676C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C676C */ _t7 = _t6 & 0x00000001u;
         /* 021C676C */ if (_t7) goto L_021C67A4; else goto L_021C6770;
   L_021C6770: ; // 0x21c6770
-        /* 021C6770 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6770 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6770 */ _t9 = _t8 & 0x00000001u;
         /* 021C6770 */ if (_t9) goto L_021C67AC; else goto L_021C6774;
   L_021C6774: ; // 0x21c6774
-        /* 021C6774 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000002u);
-        /* 021C6778 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6774 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000002u));
+        /* 021C6778 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6778 */ _t11 = _t10 & 0x00000001u;
         /* 021C6778 */ if (_t11) goto L_021C67B4; else goto L_021C677C;
   L_021C677C: ; // 0x21c677c
         /* 021C677C */ goto L_021C67C8;
   L_021C6780: ; // 0x21c6780
-        /* 021C6780 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000007u);
-        /* 021C6784 */ _t12 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6780 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000007u));
+        /* 021C6784 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C6784 */ _t13 = _t12 & 0x00000001u;
         /* 021C6784 */ if (_t13) goto L_021C6788; else goto L_021C67BC;
   L_021C6788: ; // 0x21c6788
-        /* 021C6788 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000000Bu);
-        /* 021C678C */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6788 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000000Bu));
+        /* 021C678C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C678C */ _t15 = _t14 & 0x00000001u;
         /* 021C678C */ if (_t15) goto L_021C6790; else goto L_021C67AC;
   L_021C6790: ; // 0x21c6790
-        /* 021C6790 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000010u);
-        /* 021C6794 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C6790 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000010u));
+        /* 021C6794 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C6794 */ _t17 = _t16 & 0x00000001u;
         /* 021C6794 */ if (_t17) goto L_021C67C8; else goto L_021C6798;
   L_021C6798: ; // 0x21c6798
-        /* 021C6798 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000013u);
-        /* 021C679C */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6798 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000013u));
+        /* 021C679C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C679C */ _t19 = _t18 & 0x00000001u;
         /* 021C679C */ if (_t19) goto L_021C67A0; else goto L_021C67C4;
   L_021C67A0: ; // 0x21c67a0
@@ -17326,46 +17326,46 @@ void Gambit_fn_021C6750(CPUState* cpu) {
         /* 021C6754 */ _t1 = cpu->r[3] + 0x00000000u;
         /* 021C6754 */ cpu->r[0] = rbrew_read32(cpu->mem, _t1);
         /* 021C6758 */ cpu->r[12] = 0x10030000u;
-        /* 021C675C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000004u);
+        /* 021C675C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000004u));
         /* 021C6760 */ _t2 = cpu->r[12] + 0xFFFFB5F4u;
         /* 021C6760 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t2);
-        /* 021C6764 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C6764 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C6764 */ _t4 = _t3 & 0x00000001u;
         /* 021C6764 */ if (_t4) goto L_021C6768; else goto L_021C6780;
   L_021C6768: ; // 0x21c6768
-        /* 021C6768 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
-        /* 021C676C */ _t5 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C6768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
+        /* 021C676C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C676C */ _t6 = _t5 & 0x00000001u;
         /* 021C676C */ if (_t6) goto L_021C67A4; else goto L_021C6770;
   L_021C6770: ; // 0x21c6770
-        /* 021C6770 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6770 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6770 */ _t8 = _t7 & 0x00000001u;
         /* 021C6770 */ if (_t8) goto L_021C67AC; else goto L_021C6774;
   L_021C6774: ; // 0x21c6774
-        /* 021C6774 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000002u);
-        /* 021C6778 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6774 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000002u));
+        /* 021C6778 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6778 */ _t10 = _t9 & 0x00000001u;
         /* 021C6778 */ if (_t10) goto L_021C67B4; else goto L_021C677C;
   L_021C677C: ; // 0x21c677c
         /* 021C677C */ goto L_021C67C8;
   L_021C6780: ; // 0x21c6780
-        /* 021C6780 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000007u);
-        /* 021C6784 */ _t11 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6780 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000007u));
+        /* 021C6784 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C6784 */ _t12 = _t11 & 0x00000001u;
         /* 021C6784 */ if (_t12) goto L_021C6788; else goto L_021C67BC;
   L_021C6788: ; // 0x21c6788
-        /* 021C6788 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000000Bu);
-        /* 021C678C */ _t13 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6788 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000000Bu));
+        /* 021C678C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C678C */ _t14 = _t13 & 0x00000001u;
         /* 021C678C */ if (_t14) goto L_021C6790; else goto L_021C67AC;
   L_021C6790: ; // 0x21c6790
-        /* 021C6790 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000010u);
-        /* 021C6794 */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C6790 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000010u));
+        /* 021C6794 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C6794 */ _t16 = _t15 & 0x00000001u;
         /* 021C6794 */ if (_t16) goto L_021C67C8; else goto L_021C6798;
   L_021C6798: ; // 0x21c6798
-        /* 021C6798 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000013u);
-        /* 021C679C */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6798 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000013u));
+        /* 021C679C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C679C */ _t18 = _t17 & 0x00000001u;
         /* 021C679C */ if (_t18) goto L_021C67A0; else goto L_021C67C4;
   L_021C67A0: ; // 0x21c67a0
@@ -17406,26 +17406,26 @@ void Gambit_fn_021C67D8(CPUState* cpu) {
         /* 021C67E4 */ _t2 = cpu->r[3] + 0x00000000u;
         /* 021C67E4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t2);
         /* 021C67E8 */ cpu->r[12] = 0x10030000u;
-        /* 021C67EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000005u);
+        /* 021C67EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000005u));
         /* 021C67F0 */ _t3 = cpu->r[12] + 0xFFFFB5F4u;
         /* 021C67F0 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t3);
-        /* 021C67F4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C67F4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C67F4 */ _t5 = _t4 & 0x00000001u;
         /* 021C67F4 */ if (_t5) goto L_021C67F8; else goto L_021C6800;
   L_021C67F8: ; // 0x21c67f8
         /* 021C67F8 */ Gambit_fn_021D0B34(cpu);
         /* 021C67FC */ goto L_021C681C;
   L_021C6800: ; // 0x21c6800
-        /* 021C6800 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x0000000Au);
-        /* 021C6804 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6800 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x0000000Au));
+        /* 021C6804 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6804 */ _t7 = _t6 & 0x00000001u;
         /* 021C6804 */ if (_t7) goto L_021C6808; else goto L_021C6810;
   L_021C6808: ; // 0x21c6808
         /* 021C6808 */ Gambit_fn_021CC1D0(cpu);
         /* 021C680C */ goto L_021C681C;
   L_021C6810: ; // 0x21c6810
-        /* 021C6810 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000007u);
-        /* 021C6814 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6810 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000007u));
+        /* 021C6814 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6814 */ _t9 = _t8 & 0x00000001u;
         /* 021C6814 */ if (_t9) goto L_021C6818; else goto L_021C681C;
   L_021C6818: ; // 0x21c6818
@@ -17449,26 +17449,26 @@ void Gambit_fn_021C67E0(CPUState* cpu) {
         /* 021C67E4 */ _t1 = cpu->r[3] + 0x00000000u;
         /* 021C67E4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t1);
         /* 021C67E8 */ cpu->r[12] = 0x10030000u;
-        /* 021C67EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000005u);
+        /* 021C67EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000005u));
         /* 021C67F0 */ _t2 = cpu->r[12] + 0xFFFFB5F4u;
         /* 021C67F0 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t2);
-        /* 021C67F4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C67F4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C67F4 */ _t4 = _t3 & 0x00000001u;
         /* 021C67F4 */ if (_t4) goto L_021C67F8; else goto L_021C6800;
   L_021C67F8: ; // 0x21c67f8
         /* 021C67F8 */ Gambit_fn_021D0B34(cpu);
         /* 021C67FC */ goto L_021C681C;
   L_021C6800: ; // 0x21c6800
-        /* 021C6800 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x0000000Au);
-        /* 021C6804 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6800 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x0000000Au));
+        /* 021C6804 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6804 */ _t6 = _t5 & 0x00000001u;
         /* 021C6804 */ if (_t6) goto L_021C6808; else goto L_021C6810;
   L_021C6808: ; // 0x21c6808
         /* 021C6808 */ Gambit_fn_021CC1D0(cpu);
         /* 021C680C */ goto L_021C681C;
   L_021C6810: ; // 0x21c6810
-        /* 021C6810 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000007u);
-        /* 021C6814 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6810 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000007u));
+        /* 021C6814 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6814 */ _t8 = _t7 & 0x00000001u;
         /* 021C6814 */ if (_t8) goto L_021C6818; else goto L_021C681C;
   L_021C6818: ; // 0x21c6818
@@ -17722,15 +17722,15 @@ void Gambit_fn_021C6940(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021C6940: ; // 0x21c6940
-        /* 021C6940 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C6944 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C6944 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6944 */ _t1 = _t0 & 0x00000001u;
         /* 021C6944 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021C6944 */ goto L_021C6948;
   L_021C6948: ; // 0x21c6948
         /* 021C6948 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C6948 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021C694C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6948 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021C694C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C694C */ _t3 = _t2 & 0x00000001u;
         /* 021C694C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021C694C */ goto L_021C6950;
@@ -17749,8 +17749,8 @@ void Gambit_fn_021C6940(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -17764,15 +17764,15 @@ void Gambit_fn_021C6940(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -17809,7 +17809,7 @@ void Gambit_fn_021C6964(CPUState* cpu) {
         /* 021C6964 */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 021C6964 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 021C6964 */ cpu->r[1] = _t0;
-        /* 021C6968 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6968 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6968 */ _t2 = _t1 & 0x00000001u;
         /* 021C6968 */ if (_t2) goto L_021C696C; else goto L_021C6974;
   L_021C696C: ; // 0x21c696c
@@ -17861,8 +17861,8 @@ void Gambit_fn_021C6998(CPUState* cpu) {
         /* 021C6998 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021C6998 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021C699C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021C699C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021C69A0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C699C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021C69A0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C69A0 */ _t2 = _t1 & 0x00000001u;
         /* 021C69A0 */ _t3 = _t2 ^ 0x00000001u;
         /* 021C69A0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -17884,8 +17884,8 @@ void Gambit_fn_021C69B4(CPUState* cpu) {
         /* 021C69B4 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021C69B4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021C69B8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021C69B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021C69BC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C69B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021C69BC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C69BC */ _t2 = _t1 & 0x00000001u;
         /* 021C69BC */ _t3 = _t2 ^ 0x00000001u;
         /* 021C69BC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -17907,8 +17907,8 @@ void Gambit_fn_021C69D0(CPUState* cpu) {
         /* 021C69D0 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021C69D0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021C69D4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021C69D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021C69D8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C69D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021C69D8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C69D8 */ _t2 = _t1 & 0x00000001u;
         /* 021C69D8 */ _t3 = _t2 ^ 0x00000001u;
         /* 021C69D8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -17951,8 +17951,8 @@ void Gambit_fn_021C69FC(CPUState* cpu) {
         /* 021C6A0C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021C6A10 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021C6A10 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021C6A14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021C6A18 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6A14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021C6A18 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6A18 */ _t5 = _t4 & 0x00000001u;
         /* 021C6A18 */ if (_t5) goto L_021C6A1C; else goto L_021C6A38;
   L_021C6A1C: ; // 0x21c6a1c
@@ -17991,8 +17991,8 @@ void Gambit_fn_021C6A00(CPUState* cpu) {
         /* 021C6A0C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021C6A10 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021C6A10 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021C6A14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021C6A18 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6A14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021C6A18 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6A18 */ _t5 = _t4 & 0x00000001u;
         /* 021C6A18 */ if (_t5) goto L_021C6A1C; else goto L_021C6A38;
   L_021C6A1C: ; // 0x21c6a1c
@@ -18127,8 +18127,8 @@ void Gambit_fn_021C6AB0(CPUState* cpu) {
         /* 021C6AB0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t0);
         /* 021C6AB4 */ _t1 = cpu->r[3] + 0x00000000u;
         /* 021C6AB4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t1);
-        /* 021C6AB8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 021C6ABC */ _t2 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C6AB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 021C6ABC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C6ABC */ _t3 = _t2 & 0x00000001u;
         /* 021C6ABC */ if (_t3) goto L_021C6AC0; else goto L_021C6AC4;
   L_021C6AC0: ; // 0x21c6ac0
@@ -18139,10 +18139,10 @@ void Gambit_fn_021C6AB0(CPUState* cpu) {
         /* 021C6AC4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t5);
         /* 021C6AC8 */ _t6 = cpu->r[3] + 0x00000004u;
         /* 021C6AC8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t6);
-        /* 021C6ACC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
+        /* 021C6ACC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
         /* 021C6AD0 */ _t7 = cpu->r[3] + 0x00000008u;
         /* 021C6AD0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t7);
-        /* 021C6AD4 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C6AD4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C6AD4 */ _t9 = _t8 & 0x00000001u;
         /* 021C6AD4 */ if (_t9) goto L_021C6AD8; else goto L_021C6ADC;
   L_021C6AD8: ; // 0x21c6ad8
@@ -18151,8 +18151,8 @@ void Gambit_fn_021C6AB0(CPUState* cpu) {
   L_021C6ADC: ; // 0x21c6adc
         /* 021C6ADC */ _t11 = cpu->r[4] + 0x00000008u;
         /* 021C6ADC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t11);
-        /* 021C6AE0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
-        /* 021C6AE4 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C6AE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
+        /* 021C6AE4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C6AE4 */ _t13 = _t12 & 0x00000001u;
         /* 021C6AE4 */ if (_t13) goto L_021C6AE8; else goto L_021C6AEC;
   L_021C6AE8: ; // 0x21c6ae8
@@ -18163,8 +18163,8 @@ void Gambit_fn_021C6AB0(CPUState* cpu) {
         /* 021C6AEC */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t15);
         /* 021C6AF0 */ _t16 = cpu->r[3] + 0x0000000Cu;
         /* 021C6AF0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t16);
-        /* 021C6AF4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 021C6AF8 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6AF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 021C6AF8 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C6AF8 */ _t18 = _t17 & 0x00000001u;
         /* 021C6AF8 */ if (_t18) goto L_021C6AFC; else goto L_021C6B00;
   L_021C6AFC: ; // 0x21c6afc
@@ -18175,10 +18175,10 @@ void Gambit_fn_021C6AB0(CPUState* cpu) {
         /* 021C6B00 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t20);
         /* 021C6B04 */ _t21 = cpu->r[3] + 0x00000010u;
         /* 021C6B04 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t21);
-        /* 021C6B08 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
+        /* 021C6B08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
         /* 021C6B0C */ _t22 = cpu->r[3] + 0x00000014u;
         /* 021C6B0C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t22);
-        /* 021C6B10 */ _t23 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6B10 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C6B10 */ _t24 = _t23 & 0x00000001u;
         /* 021C6B10 */ if (_t24) goto L_021C6B14; else goto L_021C6B18;
   L_021C6B14: ; // 0x21c6b14
@@ -18187,8 +18187,8 @@ void Gambit_fn_021C6AB0(CPUState* cpu) {
   L_021C6B18: ; // 0x21c6b18
         /* 021C6B18 */ _t26 = cpu->r[4] + 0x00000008u;
         /* 021C6B18 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t26);
-        /* 021C6B1C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
-        /* 021C6B20 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6B1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
+        /* 021C6B20 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C6B20 */ _t28 = _t27 & 0x00000001u;
         /* 021C6B20 */ _t29 = _t28 ^ 0x00000001u;
         /* 021C6B20 */ if (_t29) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -18366,9 +18366,9 @@ void Gambit_fn_021C6BD4(CPUState* cpu) {
         /* 021C6BD8 */ _t0 = cpu->r[9] + 0xFFFFE5E4u;
         /* 021C6BD8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t0);
         /* 021C6BDC */ cpu->r[11] = 0x101D0000u;
-        /* 021C6BE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021C6BE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021C6BE4 */ cpu->r[11] = cpu->r[11] + 0xFFFFFB60u;
-        /* 021C6BE8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6BE8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6BE8 */ _t2 = _t1 & 0x00000001u;
         /* 021C6BE8 */ if (_t2) goto L_021C6BEC; else goto L_021C6C04;
   L_021C6BEC: ; // 0x21c6bec
@@ -18381,8 +18381,8 @@ void Gambit_fn_021C6BD4(CPUState* cpu) {
         /* 021C6C00 */ _t4 = cpu->r[11] + 0x00000000u;
         /* 021C6C00 */ rbrew_write32(cpu->mem, _t4, cpu->r[9]);
   L_021C6C04: ; // 0x21c6c04
-        /* 021C6C04 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021C6C08 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6C04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021C6C08 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6C08 */ _t6 = _t5 & 0x00000001u;
         /* 021C6C08 */ if (_t6) goto L_021C6C0C; else goto L_021C6C14;
   L_021C6C0C: ; // 0x21c6c0c
@@ -18392,10 +18392,10 @@ void Gambit_fn_021C6BD4(CPUState* cpu) {
         /* 021C6C14 */ cpu->r[12] = 0x101D0000u;
         /* 021C6C18 */ _t7 = cpu->r[12] + 0xFFFFD9ECu;
         /* 021C6C18 */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 021C6C1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021C6C1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021C6C20 */ cpu->r[12] = 0x101D0000u;
         /* 021C6C24 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021C6C28 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6C28 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6C28 */ _t9 = _t8 & 0x00000001u;
         /* 021C6C28 */ if (_t9) goto L_021C6C2C; else goto L_021C6C44;
   L_021C6C2C: ; // 0x21c6c2c
@@ -18408,8 +18408,8 @@ void Gambit_fn_021C6BD4(CPUState* cpu) {
         /* 021C6C40 */ _t11 = cpu->r[12] + 0x00000000u;
         /* 021C6C40 */ rbrew_write32(cpu->mem, _t11, cpu->r[11]);
   L_021C6C44: ; // 0x21c6c44
-        /* 021C6C44 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021C6C48 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6C44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021C6C48 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6C48 */ _t13 = _t12 & 0x00000001u;
         /* 021C6C48 */ if (_t13) goto L_021C6C4C; else goto L_021C6C54;
   L_021C6C4C: ; // 0x21c6c4c
@@ -18421,9 +18421,9 @@ void Gambit_fn_021C6BD4(CPUState* cpu) {
         /* 021C6C58 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 021C6C58 */ cpu->r[10] = _t14;
         /* 021C6C5C */ cpu->r[11] = 0x101D0000u;
-        /* 021C6C60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021C6C60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021C6C64 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4ECu;
-        /* 021C6C68 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6C68 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6C68 */ _t16 = _t15 & 0x00000001u;
         /* 021C6C68 */ if (_t16) goto L_021C6C6C; else goto L_021C6C80;
   L_021C6C6C: ; // 0x21c6c6c
@@ -18435,8 +18435,8 @@ void Gambit_fn_021C6BD4(CPUState* cpu) {
         /* 021C6C7C */ _t18 = cpu->r[11] + 0x00000000u;
         /* 021C6C7C */ rbrew_write32(cpu->mem, _t18, cpu->r[9]);
   L_021C6C80: ; // 0x21c6c80
-        /* 021C6C80 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021C6C84 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6C80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021C6C84 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6C84 */ _t20 = _t19 & 0x00000001u;
         /* 021C6C84 */ if (_t20) goto L_021C6C88; else goto L_021C6C90;
   L_021C6C88: ; // 0x21c6c88
@@ -18448,9 +18448,9 @@ void Gambit_fn_021C6BD4(CPUState* cpu) {
         /* 021C6C94 */ cpu->r[10] = rbrew_read32(cpu->mem, _t21);
         /* 021C6C94 */ cpu->r[9] = _t21;
         /* 021C6C98 */ cpu->r[12] = 0x101D0000u;
-        /* 021C6C9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021C6C9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021C6CA0 */ cpu->r[12] = cpu->r[12] + 0xFFFFD4E4u;
-        /* 021C6CA4 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6CA4 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6CA4 */ _t23 = _t22 & 0x00000001u;
         /* 021C6CA4 */ if (_t23) goto L_021C6CA8; else goto L_021C6CBC;
   L_021C6CA8: ; // 0x21c6ca8
@@ -18627,13 +18627,13 @@ void Gambit_fn_021C6D64(CPUState* cpu) {
         /* 021C6D74 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021C6D78 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021C6D78 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021C6D7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021C6D80 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6D7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021C6D80 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6D80 */ _t5 = _t4 & 0x00000001u;
         /* 021C6D80 */ if (_t5) goto L_021C6D8C; else goto L_021C6D84;
   L_021C6D84: ; // 0x21c6d84
-        /* 021C6D84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021C6D88 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6D84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021C6D88 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6D88 */ _t7 = _t6 & 0x00000001u;
         /* 021C6D88 */ if (_t7) goto L_021C6D8C; else goto L_021C6DC4;
   L_021C6D8C: ; // 0x21c6d8c
@@ -18644,8 +18644,8 @@ void Gambit_fn_021C6D64(CPUState* cpu) {
         /* 021C6D94 */ cpu->ctr = cpu->r[0];
         /* 021C6D98 */ cpu->r[3] = cpu->r[31];
         /* 021C6D9C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021C6DA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C6DA4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6DA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C6DA4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6DA4 */ _t11 = _t10 & 0x00000001u;
         /* 021C6DA4 */ if (_t11) goto L_021C6DA8; else goto L_021C6DC4;
   L_021C6DA8: ; // 0x21c6da8
@@ -18683,13 +18683,13 @@ void Gambit_fn_021C6D68(CPUState* cpu) {
         /* 021C6D74 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021C6D78 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021C6D78 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021C6D7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021C6D80 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6D7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021C6D80 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6D80 */ _t5 = _t4 & 0x00000001u;
         /* 021C6D80 */ if (_t5) goto L_021C6D8C; else goto L_021C6D84;
   L_021C6D84: ; // 0x21c6d84
-        /* 021C6D84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021C6D88 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6D84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021C6D88 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6D88 */ _t7 = _t6 & 0x00000001u;
         /* 021C6D88 */ if (_t7) goto L_021C6D8C; else goto L_021C6DC4;
   L_021C6D8C: ; // 0x21c6d8c
@@ -18700,8 +18700,8 @@ void Gambit_fn_021C6D68(CPUState* cpu) {
         /* 021C6D94 */ cpu->ctr = cpu->r[0];
         /* 021C6D98 */ cpu->r[3] = cpu->r[31];
         /* 021C6D9C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021C6DA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C6DA4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6DA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C6DA4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6DA4 */ _t11 = _t10 & 0x00000001u;
         /* 021C6DA4 */ if (_t11) goto L_021C6DA8; else goto L_021C6DC4;
   L_021C6DA8: ; // 0x21c6da8
@@ -18765,8 +18765,8 @@ void Gambit_fn_021C6DD8(CPUState* cpu) {
         /* 021C6E34 */ cpu->f[10] = cpu->f[13] + cpu->f[10];
         /* 021C6E38 */ _t8 = cpu->r[12] + 0xFFFFB5FCu;
         /* 021C6E38 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t8);
-        /* 021C6E3C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[11]);
-        /* 021C6E40 */ _t9 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6E3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[11]));
+        /* 021C6E40 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C6E40 */ _t10 = _t9 & 0x00000001u;
         /* 021C6E40 */ if (_t10) goto L_021C6E44; else goto L_021C6ECC;
   L_021C6E44: ; // 0x21c6e44
@@ -18775,10 +18775,10 @@ void Gambit_fn_021C6DD8(CPUState* cpu) {
         /* 021C6E4C */ _t11 = cpu->r[11] + 0xFFFFB5F8u;
         /* 021C6E4C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t11);
         /* 021C6E50 */ cpu->r[12] = 0x10030000u;
-        /* 021C6E54 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
+        /* 021C6E54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
         /* 021C6E58 */ _t12 = cpu->r[12] + 0xFFFFB600u;
         /* 021C6E58 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t12);
-        /* 021C6E5C */ _t13 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6E5C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C6E5C */ _t14 = _t13 & 0x00000001u;
         /* 021C6E5C */ if (_t14) goto L_021C6E60; else goto L_021C6E7C;
   L_021C6E60: ; // 0x21c6e60
@@ -18890,8 +18890,8 @@ void Gambit_fn_021C6DDC(CPUState* cpu) {
         /* 021C6E34 */ cpu->f[10] = cpu->f[13] + cpu->f[10];
         /* 021C6E38 */ _t8 = cpu->r[12] + 0xFFFFB5FCu;
         /* 021C6E38 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t8);
-        /* 021C6E3C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[11]);
-        /* 021C6E40 */ _t9 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6E3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[11]));
+        /* 021C6E40 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C6E40 */ _t10 = _t9 & 0x00000001u;
         /* 021C6E40 */ if (_t10) goto L_021C6E44; else goto L_021C6ECC;
   L_021C6E44: ; // 0x21c6e44
@@ -18900,10 +18900,10 @@ void Gambit_fn_021C6DDC(CPUState* cpu) {
         /* 021C6E4C */ _t11 = cpu->r[11] + 0xFFFFB5F8u;
         /* 021C6E4C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t11);
         /* 021C6E50 */ cpu->r[12] = 0x10030000u;
-        /* 021C6E54 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
+        /* 021C6E54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
         /* 021C6E58 */ _t12 = cpu->r[12] + 0xFFFFB600u;
         /* 021C6E58 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t12);
-        /* 021C6E5C */ _t13 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6E5C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C6E5C */ _t14 = _t13 & 0x00000001u;
         /* 021C6E5C */ if (_t14) goto L_021C6E60; else goto L_021C6E7C;
   L_021C6E60: ; // 0x21c6e60
@@ -19035,9 +19035,9 @@ void Gambit_fn_021C6F28(CPUState* cpu) {
         /* 021C6FAC */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t17);
         /* 021C6FAC */ cpu->r[4] = _t17;
         /* 021C6FB0 */ cpu->r[20] = 0x00000000u;
-        /* 021C6FB4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[12]);
+        /* 021C6FB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[12]));
         /* 021C6FB8 */ cpu->r[24] = cpu->r[20];
-        /* 021C6FBC */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6FBC */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6FBC */ _t19 = _t18 & 0x00000001u;
         /* 021C6FBC */ if (_t19) goto L_021C6FC0; else goto L_021C6FE0;
   L_021C6FC0: ; // 0x21c6fc0
@@ -19045,8 +19045,8 @@ void Gambit_fn_021C6F28(CPUState* cpu) {
         /* 021C6FC0 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t20);
         /* 021C6FC4 */ _t21 = cpu->r[4] + 0x00000004u;
         /* 021C6FC4 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t21);
-        /* 021C6FC8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[7]);
-        /* 021C6FCC */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6FC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[7]));
+        /* 021C6FCC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6FCC */ _t23 = _t22 & 0x00000001u;
         /* 021C6FCC */ if (_t23) goto L_021C6FD0; else goto L_021C6FE0;
   L_021C6FD0: ; // 0x21c6fd0
@@ -19054,25 +19054,25 @@ void Gambit_fn_021C6F28(CPUState* cpu) {
         /* 021C6FD0 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t24);
         /* 021C6FD4 */ _t25 = cpu->r[4] + 0x00000008u;
         /* 021C6FD4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t25);
-        /* 021C6FD8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[10]);
-        /* 021C6FDC */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6FD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[10]));
+        /* 021C6FDC */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6FDC */ _t27 = _t26 & 0x00000001u;
         /* 021C6FDC */ if (_t27) goto L_021C7010; else goto L_021C6FE0;
   L_021C6FE0: ; // 0x21c6fe0
         /* 021C6FE0 */ cpu->r[5] = cpu->r[22] + 0x00000044u;
         /* 021C6FE4 */ cpu->r[3] = cpu->r[1] + 0x00000080u;
         /* 021C6FE8 */ Gambit_fn_021C6DD8(cpu);
-        /* 021C6FEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C6FF0 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6FEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C6FF0 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6FF0 */ _t29 = _t28 & 0x00000001u;
         /* 021C6FF0 */ if (_t29) goto L_021C6FF4; else goto L_021C700C;
   L_021C6FF4: ; // 0x21c6ff4
         /* 021C6FF4 */ _t30 = cpu->r[22] + 0x00000004u;
         /* 021C6FF4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t30);
         /* 021C6FF8 */ cpu->r[18] = 0x00000000u;
-        /* 021C6FFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[18], cpu->r[0]);
+        /* 021C6FFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[18], cpu->r[0]));
         /* 021C7000 */ cpu->r[24] = 0x00000001u;
-        /* 021C7004 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C7004 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C7004 */ _t32 = _t31 & 0x00000001u;
         /* 021C7004 */ if (_t32) goto L_021C7008; else goto L_021C7318;
   L_021C7008: ; // 0x21c7008
@@ -19083,8 +19083,8 @@ void Gambit_fn_021C6F28(CPUState* cpu) {
         /* 021C7010 */ _t33 = cpu->r[22] + 0x00000004u;
         /* 021C7010 */ cpu->r[0] = rbrew_read32(cpu->mem, _t33);
         /* 021C7014 */ cpu->r[18] = 0x00000000u;
-        /* 021C7018 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[18], cpu->r[0]);
-        /* 021C701C */ _t34 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C7018 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[18], cpu->r[0]));
+        /* 021C701C */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C701C */ _t35 = _t34 & 0x00000001u;
         /* 021C701C */ if (_t35) goto L_021C7020; else goto L_021C7318;
   L_021C7020: ; // 0x21c7020
@@ -19180,9 +19180,9 @@ void Gambit_fn_021C6F28(CPUState* cpu) {
         /* 021C7100 */ _t68 = cpu->r[22] + 0x00000034u;
         /* 021C7100 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t68);
         /* 021C7104 */ cpu->f[27] = cpu->f[0] - cpu->f[29];
-        /* 021C7108 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[30]);
+        /* 021C7108 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[30]));
         /* 021C710C */ cpu->f[26] = fma(cpu->f[6], cpu->f[27], cpu->f[13]);
-        /* 021C7110 */ _t69 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C7110 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C7110 */ _t70 = _t69 & 0x00000001u;
         /* 021C7110 */ if (_t70) goto L_021C7114; else goto L_021C713C;
   L_021C7114: ; // 0x21c7114
@@ -19261,8 +19261,8 @@ void Gambit_fn_021C6F28(CPUState* cpu) {
         /* 021C71E0 */ _t91 = cpu->r[1] + 0x0000006Cu;
         /* 021C71E0 */ rbrew_write32(cpu->mem, _t91, cpu->r[0]);
         /* 021C71E4 */ Gambit_fn_0204EFD8(cpu);
-        /* 021C71E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
-        /* 021C71EC */ _t92 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C71E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
+        /* 021C71EC */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C71EC */ _t93 = _t92 & 0x00000001u;
         /* 021C71EC */ if (_t93) goto L_021C7234; else goto L_021C71F0;
   L_021C71F0: ; // 0x21c71f0
@@ -19282,17 +19282,17 @@ void Gambit_fn_021C6F28(CPUState* cpu) {
         /* 021C7218 */ /* nop */
         /* 021C721C */ cpu->f[10] = cpu->f[12] * cpu->f[10];
         /* 021C7220 */ /* nop */
-        /* 021C7224 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
+        /* 021C7224 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
         /* 021C7228 */ _t97 = cpu->r[1] + 0x00000020u;
         /* 021C7228 */ rbrew_write_f32(cpu->mem, _t97, cpu->f[10]);
-        /* 021C722C */ _t98 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C722C */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C722C */ _t99 = _t98 & 0x00000001u;
         /* 021C722C */ if (_t99) goto L_021C7294; else goto L_021C7230;
   L_021C7230: ; // 0x21c7230
         /* 021C7230 */ goto L_021C7278;
   L_021C7234: ; // 0x21c7234
-        /* 021C7234 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 021C7238 */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C7234 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 021C7238 */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C7238 */ _t101 = _t100 & 0x00000001u;
         /* 021C7238 */ if (_t101) goto L_021C7248; else goto L_021C723C;
   L_021C723C: ; // 0x21c723c
@@ -19314,10 +19314,10 @@ void Gambit_fn_021C6F28(CPUState* cpu) {
         /* 021C7260 */ /* nop */
         /* 021C7264 */ cpu->f[10] = cpu->f[12] * cpu->f[10];
         /* 021C7268 */ /* nop */
-        /* 021C726C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
+        /* 021C726C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
         /* 021C7270 */ _t107 = cpu->r[1] + 0x00000020u;
         /* 021C7270 */ rbrew_write_f32(cpu->mem, _t107, cpu->f[10]);
-        /* 021C7274 */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C7274 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C7274 */ _t109 = _t108 & 0x00000001u;
         /* 021C7274 */ if (_t109) goto L_021C7294; else goto L_021C7278;
   L_021C7278: ; // 0x21c7278
@@ -19327,8 +19327,8 @@ void Gambit_fn_021C6F28(CPUState* cpu) {
         /* 021C7280 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t110);
         /* 021C7284 */ /* nop */
         /* 021C7288 */ cpu->f[13] = fma(cpu->f[12], cpu->f[10], cpu->f[9]);
-        /* 021C728C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[30]);
-        /* 021C7290 */ _t111 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C728C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[30]));
+        /* 021C7290 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C7290 */ _t112 = _t111 & 0x00000001u;
         /* 021C7290 */ if (_t112) goto L_021C7294; else goto L_021C7308;
   L_021C7294: ; // 0x21c7294
@@ -19337,10 +19337,10 @@ void Gambit_fn_021C6F28(CPUState* cpu) {
         /* 021C7298 */ cpu->r[11] = cpu->r[19] + cpu->r[12];
         /* 021C729C */ _t114 = cpu->r[11] + 0x00000104u;
         /* 021C729C */ cpu->r[4] = rbrew_read8(cpu->mem, _t114);
-        /* 021C72A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 021C72A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 021C72A4 */ _t115 = cpu->r[22] + 0x00000040u;
         /* 021C72A4 */ cpu->r[5] = rbrew_read8(cpu->mem, _t115);
-        /* 021C72A8 */ _t116 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C72A8 */ _t116 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C72A8 */ _t117 = _t116 & 0x00000001u;
         /* 021C72A8 */ if (_t117) goto L_021C7308; else goto L_021C72AC;
   L_021C72AC: ; // 0x21c72ac
@@ -19348,8 +19348,8 @@ void Gambit_fn_021C6F28(CPUState* cpu) {
         /* 021C72B0 */ cpu->r[6] = cpu->r[1] + 0x00000024u;
         /* 021C72B4 */ cpu->r[3] = cpu->r[19];
         /* 021C72B8 */ Gambit_fn_021F000C(cpu);
-        /* 021C72BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C72C0 */ _t118 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C72BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C72C0 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C72C0 */ _t119 = _t118 & 0x00000001u;
         /* 021C72C0 */ if (_t119) goto L_021C7308; else goto L_021C72C4;
   L_021C72C4: ; // 0x21c72c4
@@ -19385,8 +19385,8 @@ void Gambit_fn_021C6F28(CPUState* cpu) {
         /* 021C7308 */ _t131 = cpu->r[22] + 0x00000004u;
         /* 021C7308 */ cpu->r[10] = rbrew_read32(cpu->mem, _t131);
         /* 021C730C */ cpu->r[18] = cpu->r[18] + 0x00000001u;
-        /* 021C7310 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[18], cpu->r[10]);
-        /* 021C7314 */ _t132 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C7310 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[18], cpu->r[10]));
+        /* 021C7314 */ _t132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C7314 */ _t133 = _t132 & 0x00000001u;
         /* 021C7314 */ if (_t133) goto L_021C7054; else goto L_021C7318;
   L_021C7318: ; // 0x21c7318
@@ -19415,7 +19415,7 @@ void Gambit_fn_021C6F28(CPUState* cpu) {
         /* 021C7344 */ cpu->f[26] = rbrew_read_f64(cpu->mem, _t144);
         /* 021C7348 */ _t145 = cpu->r[1] + 0x00000138u;
         /* 021C7348 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t145);
-        /* 021C734C */ _t146 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C734C */ _t146 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C734C */ _t147 = _t146 & 0x00000001u;
         /* 021C734C */ if (_t147) goto L_021C7350; // else: addr-0 trap, fall-through
   L_021C7350: ; // 0x21c7350
@@ -19434,18 +19434,18 @@ void Gambit_fn_021C7360(CPUState* cpu) {
         /* 021C7360 */ cpu->r[0] = cpu->lr;
         /* 021C7364 */ _t0 = cpu->r[1] + 0x00000004u;
         /* 021C7364 */ rbrew_write32(cpu->mem, _t0, cpu->r[0]);
-        /* 021C7368 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021C7368 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021C736C */ _t1 = cpu->r[1] + 0xFFFFFFF8u;
         /* 021C736C */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 021C736C */ cpu->r[1] = _t1;
-        /* 021C7370 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C7370 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C7370 */ _t3 = _t2 & 0x00000001u;
         /* 021C7370 */ if (_t3) goto L_021C7374; else goto L_021C7384;
   L_021C7374: ; // 0x21c7374
         /* 021C7374 */ cpu->r[3] = 0x00000064u;
         /* 021C7378 */ Gambit_fn_02801A78(cpu);
-        /* 021C737C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C7380 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C737C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C7380 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C7380 */ _t5 = _t4 & 0x00000001u;
         /* 021C7380 */ if (_t5) goto L_021C7440; else goto L_021C7384;
   L_021C7384: ; // 0x21c7384
@@ -19551,14 +19551,14 @@ void Gambit_fn_021C736C(CPUState* cpu) {
         /* 021C736C */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 021C736C */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 021C736C */ cpu->r[1] = _t0;
-        /* 021C7370 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C7370 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C7370 */ _t2 = _t1 & 0x00000001u;
         /* 021C7370 */ if (_t2) goto L_021C7374; else goto L_021C7384;
   L_021C7374: ; // 0x21c7374
         /* 021C7374 */ cpu->r[3] = 0x00000064u;
         /* 021C7378 */ Gambit_fn_02801A78(cpu);
-        /* 021C737C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C7380 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C737C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C7380 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C7380 */ _t4 = _t3 & 0x00000001u;
         /* 021C7380 */ if (_t4) goto L_021C7440; else goto L_021C7384;
   L_021C7384: ; // 0x21c7384
@@ -19667,18 +19667,18 @@ void Gambit_fn_021C7454(CPUState* cpu) {
         /* 021C7458 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021C7458 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021C745C */ cpu->r[31] = cpu->r[3];
-        /* 021C745C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021C745C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021C7460 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021C7460 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021C7464 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C7464 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C7464 */ _t4 = _t3 & 0x00000001u;
         /* 021C7464 */ if (_t4) goto L_021C7468; else goto L_021C7478;
   L_021C7468: ; // 0x21c7468
         /* 021C7468 */ cpu->r[3] = 0x00000170u;
         /* 021C746C */ Gambit_fn_02801A78(cpu);
         /* 021C7470 */ cpu->r[31] = cpu->r[3];
-        /* 021C7470 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021C7474 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C7470 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021C7474 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C7474 */ _t6 = _t5 & 0x00000001u;
         /* 021C7474 */ if (_t6) goto L_021C755C; else goto L_021C7478;
   L_021C7478: ; // 0x21c7478
@@ -19840,10 +19840,10 @@ void Gambit_fn_021C7574(CPUState* cpu) {
         /* 021C75D0 */ Gambit_fn_027E3E54(cpu);
         /* 021C75D4 */ _t10 = cpu->r[27] + 0x0000011Eu;
         /* 021C75D4 */ cpu->r[9] = rbrew_read8(cpu->mem, _t10);
-        /* 021C75D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021C75D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021C75DC */ _t11 = cpu->r[1] + 0x00000024u;
         /* 021C75DC */ cpu->r[0] = rbrew_read32(cpu->mem, _t11);
-        /* 021C75E0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C75E0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C75E0 */ _t13 = _t12 & 0x00000001u;
         /* 021C75E0 */ if (_t13) goto L_021C75E4; else goto L_021C7634;
   L_021C75E4: ; // 0x21c75e4
@@ -19876,10 +19876,10 @@ void Gambit_fn_021C7574(CPUState* cpu) {
         /* 021C761C */ rbrew_write_f32(cpu->mem, _t25, cpu->f[10]);
         /* 021C7620 */ _t26 = cpu->r[28] + 0x00000008u;
         /* 021C7620 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t26);
-        /* 021C7624 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
+        /* 021C7624 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
         /* 021C7628 */ _t27 = cpu->r[27] + 0x0000012Cu;
         /* 021C7628 */ rbrew_write_f32(cpu->mem, _t27, cpu->f[10]);
-        /* 021C762C */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C762C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C762C */ _t29 = _t28 & 0x00000001u;
         /* 021C762C */ if (_t29) goto L_021C7630; else goto L_021C7684;
   L_021C7630: ; // 0x21c7630
@@ -19915,15 +19915,15 @@ void Gambit_fn_021C7574(CPUState* cpu) {
         /* 021C7670 */ rbrew_write_f32(cpu->mem, _t41, cpu->f[10]);
         /* 021C7674 */ _t42 = cpu->r[28] + 0x00000008u;
         /* 021C7674 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t42);
-        /* 021C7678 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
+        /* 021C7678 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
         /* 021C767C */ _t43 = cpu->r[27] + 0x0000012Cu;
         /* 021C767C */ rbrew_write_f32(cpu->mem, _t43, cpu->f[10]);
-        /* 021C7680 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C7680 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C7680 */ _t45 = _t44 & 0x00000001u;
         /* 021C7680 */ if (_t45) goto L_021C768C; else goto L_021C7684;
   L_021C7684: ; // 0x21c7684
-        /* 021C7684 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021C7688 */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C7684 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021C7688 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C7688 */ _t47 = _t46 & 0x00000001u;
         /* 021C7688 */ if (_t47) goto L_021C768C; else goto L_021C76C8;
   L_021C768C: ; // 0x21c768c
@@ -20470,7 +20470,7 @@ void Gambit_fn_021C78AC(CPUState* cpu) {
         /* 021C79E0 */ /* nop */
         /* 021C79E4 */ _t68 = cpu->r[24] + 0x00000120u;
         /* 021C79E4 */ rbrew_write8(cpu->mem, _t68, (uint8_t)cpu->r[6]);
-        /* 021C79E8 */ _t69 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C79E8 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C79E8 */ _t70 = _t69 & 0x00000001u;
         /* 021C79E8 */ if (_t70) goto L_021C79EC; else goto L_021C79FC;
   L_021C79EC: ; // 0x21c79ec
@@ -20652,7 +20652,7 @@ void Gambit_fn_021C7A40(CPUState* cpu) {
         /* 021C7B70 */ /* nop */
         /* 021C7B74 */ _t65 = cpu->r[24] + 0x00000120u;
         /* 021C7B74 */ rbrew_write8(cpu->mem, _t65, (uint8_t)cpu->r[10]);
-        /* 021C7B78 */ _t66 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C7B78 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C7B78 */ _t67 = _t66 & 0x00000001u;
         /* 021C7B78 */ if (_t67) goto L_021C7B7C; else goto L_021C7B8C;
   L_021C7B7C: ; // 0x21c7b7c
@@ -21136,7 +21136,7 @@ void Gambit_fn_021C7D00(CPUState* cpu) {
         /* 021C7E34 */ /* nop */
         /* 021C7E38 */ _t68 = cpu->r[24] + 0x00000120u;
         /* 021C7E38 */ rbrew_write8(cpu->mem, _t68, (uint8_t)cpu->r[6]);
-        /* 021C7E3C */ _t69 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C7E3C */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C7E3C */ _t70 = _t69 & 0x00000001u;
         /* 021C7E3C */ if (_t70) goto L_021C7E40; else goto L_021C7E50;
   L_021C7E40: ; // 0x21c7e40
@@ -21318,7 +21318,7 @@ void Gambit_fn_021C7E94(CPUState* cpu) {
         /* 021C7FC4 */ /* nop */
         /* 021C7FC8 */ _t65 = cpu->r[24] + 0x00000120u;
         /* 021C7FC8 */ rbrew_write8(cpu->mem, _t65, (uint8_t)cpu->r[10]);
-        /* 021C7FCC */ _t66 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C7FCC */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C7FCC */ _t67 = _t66 & 0x00000001u;
         /* 021C7FCC */ if (_t67) goto L_021C7FD0; else goto L_021C7FE0;
   L_021C7FD0: ; // 0x21c7fd0
@@ -21387,9 +21387,9 @@ void Gambit_fn_021C8040(CPUState* cpu) {
         /* 021C8054 */ _t2 = cpu->r[29] + 0x00000051u;
         /* 021C8054 */ cpu->r[7] = rbrew_read8(cpu->mem, _t2);
         /* 021C8058 */ cpu->r[27] = cpu->r[4];
-        /* 021C805C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021C805C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021C8060 */ cpu->r[28] = cpu->r[5];
-        /* 021C8064 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C8064 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C8064 */ _t4 = _t3 & 0x00000001u;
         /* 021C8064 */ if (_t4) goto L_021C8370; else goto L_021C8068;
   L_021C8068: ; // 0x21c8068
@@ -21399,9 +21399,9 @@ void Gambit_fn_021C8040(CPUState* cpu) {
         /* 021C8070 */ _t6 = cpu->r[12] + 0x000002C4u;
         /* 021C8070 */ cpu->r[8] = rbrew_read32(cpu->mem, _t6);
         /* 021C8074 */ cpu->r[26] = 0x00000000u;
-        /* 021C8078 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021C8078 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021C807C */ cpu->r[31] = cpu->r[26];
-        /* 021C8080 */ _t7 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C8080 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C8080 */ _t8 = _t7 & 0x00000001u;
         /* 021C8080 */ if (_t8) goto L_021C8084; else goto L_021C8370;
   L_021C8084: ; // 0x21c8084
@@ -21412,9 +21412,9 @@ void Gambit_fn_021C8040(CPUState* cpu) {
         /* 021C808C */ cpu->r[8] = rbrew_read32(cpu->mem, _t10);
         /* 021C8090 */ cpu->r[9] = 0x00000000u;
   L_021C8094: ; // 0x21c8094
-        /* 021C8094 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], 0x00000002u);
+        /* 021C8094 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], 0x00000002u));
         /* 021C8098 */ cpu->r[10] = cpu->r[11] + 0x000002B0u;
-        /* 021C809C */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C809C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C809C */ _t12 = _t11 & 0x00000001u;
         /* 021C809C */ if (_t12) goto L_021C80A0; else goto L_021C80A4;
   L_021C80A0: ; // 0x21c80a0
@@ -21422,8 +21422,8 @@ void Gambit_fn_021C8040(CPUState* cpu) {
   L_021C80A4: ; // 0x21c80a4
         /* 021C80A4 */ _t13 = cpu->r[10] + 0x00000000u;
         /* 021C80A4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t13);
-        /* 021C80A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[10]);
-        /* 021C80AC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C80A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[10]));
+        /* 021C80AC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C80AC */ _t15 = _t14 & 0x00000001u;
         /* 021C80AC */ if (_t15) goto L_021C80D0; else goto L_021C80B0;
   L_021C80B0: ; // 0x21c80b0
@@ -21442,28 +21442,28 @@ void Gambit_fn_021C8040(CPUState* cpu) {
         /* 021C80C8 */ cpu->r[1] = cpu->r[1] + 0x00000068u;
         /* 021C80CC */ return;
   L_021C80D0: ; // 0x21c80d0
-        /* 021C80D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021C80D4 */ _t20 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C80D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021C80D4 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C80D4 */ _t21 = _t20 & 0x00000001u;
         /* 021C80D4 */ if (_t21) goto L_021C8370; else goto L_021C80D8;
   L_021C80D8: ; // 0x21c80d8
         /* 021C80D8 */ _t22 = cpu->r[29] + 0x00000150u;
         /* 021C80D8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t22);
-        /* 021C80DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021C80E0 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C80DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021C80E0 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C80E0 */ _t24 = _t23 & 0x00000001u;
         /* 021C80E0 */ if (_t24) goto L_021C8138; else goto L_021C80E4;
   L_021C80E4: ; // 0x21c80e4
-        /* 021C80E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000001u);
-        /* 021C80E8 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C80E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000001u));
+        /* 021C80E8 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C80E8 */ _t26 = _t25 & 0x00000001u;
         /* 021C80E8 */ if (_t26) goto L_021C80EC; else goto L_021C8370;
   L_021C80EC: ; // 0x21c80ec
         /* 021C80EC */ Gambit_fn_021CD59C(cpu);
         /* 021C80F0 */ _t27 = cpu->r[29] + 0x00000064u;
         /* 021C80F0 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t27);
-        /* 021C80F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[3]);
-        /* 021C80F8 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C80F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[3]));
+        /* 021C80F8 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C80F8 */ _t29 = _t28 & 0x00000001u;
         /* 021C80F8 */ if (_t29) goto L_021C8138; else goto L_021C80FC;
   L_021C80FC: ; // 0x21c80fc
@@ -21474,15 +21474,15 @@ void Gambit_fn_021C8040(CPUState* cpu) {
         /* 021C8108 */ Gambit_fn_021CEB64(cpu);
         /* 021C810C */ _t30 = cpu->r[29] + 0x00000064u;
         /* 021C810C */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t30);
-        /* 021C8110 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[3]);
-        /* 021C8114 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C8110 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[3]));
+        /* 021C8114 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C8114 */ _t32 = _t31 & 0x00000001u;
         /* 021C8114 */ if (_t32) goto L_021C8138; else goto L_021C8118;
   L_021C8118: ; // 0x21c8118
         /* 021C8118 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 021C8118 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021C8118 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021C811C */ cpu->r[25] = cpu->r[25] + 0x00000001u;
-        /* 021C8120 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C8120 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C8120 */ _t34 = _t33 & 0x00000001u;
         /* 021C8120 */ if (_t34) goto L_021C8124; else goto L_021C8104;
   L_021C8124: ; // 0x21c8124
@@ -21519,9 +21519,9 @@ void Gambit_fn_021C8040(CPUState* cpu) {
         /* 021C817C */ cpu->f[8] = fma(cpu->f[9], cpu->f[9], cpu->f[10]);
         /* 021C8180 */ _t42 = cpu->r[5] + 0xFFFFBCD0u;
         /* 021C8180 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t42);
-        /* 021C8184 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
+        /* 021C8184 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
         /* 021C8188 */ cpu->f[10] = cpu->f[9];
-        /* 021C818C */ _t43 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C818C */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C818C */ _t44 = _t43 & 0x00000001u;
         /* 021C818C */ if (_t44) goto L_021C8190; else goto L_021C81CC;
   L_021C8190: ; // 0x21c8190
@@ -21550,12 +21550,12 @@ void Gambit_fn_021C8040(CPUState* cpu) {
         /* 021C81CC */ cpu->r[10] = 0x10030000u;
         /* 021C81D0 */ _t51 = cpu->r[10] + 0xFFFFBD84u;
         /* 021C81D0 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t51);
-        /* 021C81D4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[10]);
+        /* 021C81D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[10]));
         /* 021C81D8 */ cpu->f[9] = cpu->f[9] * cpu->f[10];
         /* 021C81DC */ /* nop */
         /* 021C81E0 */ _t52 = cpu->r[1] + 0x0000001Cu;
         /* 021C81E0 */ rbrew_write_f32(cpu->mem, _t52, cpu->f[9]);
-        /* 021C81E4 */ _t53 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C81E4 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C81E4 */ _t54 = _t53 & 0x00000001u;
         /* 021C81E4 */ if (_t54) goto L_021C823C; else goto L_021C81E8;
   L_021C81E8: ; // 0x21c81e8
@@ -21580,14 +21580,14 @@ void Gambit_fn_021C8040(CPUState* cpu) {
         /* 021C8218 */ /* nop */
         /* 021C821C */ _t61 = cpu->r[1] + 0x00000040u;
         /* 021C821C */ rbrew_write32(cpu->mem, _t61, cpu->r[26]);
-        /* 021C8220 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 021C8220 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 021C8224 */ _t62 = cpu->r[1] + 0x00000044u;
         /* 021C8224 */ rbrew_write32(cpu->mem, _t62, cpu->r[0]);
         /* 021C8228 */ cpu->r[5] = 0x00000004u;
         /* 021C822C */ _t63 = cpu->r[1] + 0x00000010u;
         /* 021C822C */ rbrew_write_f32(cpu->mem, _t63, cpu->f[8]);
         /* 021C8230 */ /* nop */
-        /* 021C8234 */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C8234 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C8234 */ _t65 = _t64 & 0x00000001u;
         /* 021C8234 */ if (_t65) goto L_021C82A4; else goto L_021C8238;
   L_021C8238: ; // 0x21c8238
@@ -21626,13 +21626,13 @@ void Gambit_fn_021C8040(CPUState* cpu) {
         /* 021C8284 */ rbrew_write32(cpu->mem, _t77, cpu->r[26]);
         /* 021C8288 */ _t78 = cpu->r[1] + 0x00000038u;
         /* 021C8288 */ rbrew_write32(cpu->mem, _t78, cpu->r[12]);
-        /* 021C828C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 021C828C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 021C8290 */ _t79 = cpu->r[1] + 0x00000030u;
         /* 021C8290 */ rbrew_write32(cpu->mem, _t79, cpu->r[26]);
         /* 021C8294 */ cpu->r[5] = 0x00000004u;
         /* 021C8298 */ _t80 = cpu->r[1] + 0x0000003Cu;
         /* 021C8298 */ rbrew_write32(cpu->mem, _t80, cpu->r[26]);
-        /* 021C829C */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C829C */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C829C */ _t82 = _t81 & 0x00000001u;
         /* 021C829C */ if (_t82) goto L_021C82A4; else goto L_021C82A0;
   L_021C82A0: ; // 0x21c82a0
@@ -21666,8 +21666,8 @@ void Gambit_fn_021C8040(CPUState* cpu) {
         /* 021C82F4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021C82F8 */ _t88 = cpu->r[1] + 0x00000030u;
         /* 021C82F8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t88);
-        /* 021C82FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021C8300 */ _t89 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C82FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021C8300 */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C8300 */ _t90 = _t89 & 0x00000001u;
         /* 021C8300 */ if (_t90) goto L_021C8364; else goto L_021C8304;
   L_021C8304: ; // 0x21c8304
@@ -21675,8 +21675,8 @@ void Gambit_fn_021C8040(CPUState* cpu) {
         /* 021C8304 */ cpu->r[8] = rbrew_read32(cpu->mem, _t91);
         /* 021C8308 */ _t92 = cpu->r[1] + 0x00000034u;
         /* 021C8308 */ cpu->r[0] = rbrew_read32(cpu->mem, _t92);
-        /* 021C830C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[0]);
-        /* 021C8310 */ _t93 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C830C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[0]));
+        /* 021C8310 */ _t93 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C8310 */ _t94 = _t93 & 0x00000001u;
         /* 021C8310 */ if (_t94) goto L_021C8314; else goto L_021C8364;
   L_021C8314: ; // 0x21c8314
@@ -21838,17 +21838,17 @@ void Gambit_fn_021C83CC(CPUState* cpu) {
         /* 021C8400 */ cpu->r[30] = cpu->r[7];
         /* 021C8404 */ cpu->r[24] = cpu->r[8];
         /* 021C8408 */ cpu->r[25] = cpu->r[10];
-        /* 021C840C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021C840C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021C8410 */ cpu->f[31] = cpu->f[1];
-        /* 021C8414 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C8414 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C8414 */ _t6 = _t5 & 0x00000001u;
         /* 021C8414 */ if (_t6) goto L_021C85D4; else goto L_021C8418;
   L_021C8418: ; // 0x21c8418
         /* 021C8418 */ _t7 = cpu->r[9] + 0x00000000u;
         /* 021C8418 */ cpu->r[0] = rbrew_read32(cpu->mem, _t7);
         /* 021C841C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021C841C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021C8420 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C841C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021C8420 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C8420 */ _t9 = _t8 & 0x00000001u;
         /* 021C8420 */ if (_t9) goto L_021C84F4; else goto L_021C8424;
   L_021C8424: ; // 0x21c8424
@@ -21893,9 +21893,9 @@ void Gambit_fn_021C83CC(CPUState* cpu) {
         /* 021C8488 */ /* nop */
         /* 021C848C */ _t23 = cpu->r[1] + 0x00000058u;
         /* 021C848C */ rbrew_write_f32(cpu->mem, _t23, cpu->f[13]);
-        /* 021C8490 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021C8490 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021C8494 */ /* nop */
-        /* 021C8498 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C8498 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C8498 */ _t25 = _t24 & 0x00000001u;
         /* 021C8498 */ if (_t25) goto L_021C849C; else goto L_021C8530;
   L_021C849C: ; // 0x21c849c
@@ -21923,10 +21923,10 @@ void Gambit_fn_021C83CC(CPUState* cpu) {
         /* 021C84DC */ cpu->f[0] = fma(cpu->f[7], cpu->f[7], cpu->f[10]);
         /* 021C84E0 */ _t31 = cpu->r[5] + 0xFFFFBCD0u;
         /* 021C84E0 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t31);
-        /* 021C84E4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[9]);
+        /* 021C84E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[9]));
         /* 021C84E8 */ _t32 = cpu->r[1] + 0x0000002Cu;
         /* 021C84E8 */ rbrew_write_f32(cpu->mem, _t32, cpu->f[6]);
-        /* 021C84EC */ _t33 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C84EC */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C84EC */ _t34 = _t33 & 0x00000001u;
         /* 021C84EC */ if (_t34) goto L_021C84F0; else goto L_021C867C;
   L_021C84F0: ; // 0x21c84f0
@@ -21953,9 +21953,9 @@ void Gambit_fn_021C83CC(CPUState* cpu) {
         /* 021C851C */ /* nop */
         /* 021C8520 */ _t43 = cpu->r[1] + 0x00000058u;
         /* 021C8520 */ rbrew_write_f32(cpu->mem, _t43, cpu->f[13]);
-        /* 021C8524 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021C8524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021C8528 */ /* nop */
-        /* 021C852C */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C852C */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C852C */ _t45 = _t44 & 0x00000001u;
         /* 021C852C */ if (_t45) goto L_021C849C; else goto L_021C8530;
   L_021C8530: ; // 0x21c8530
@@ -22012,10 +22012,10 @@ void Gambit_fn_021C83CC(CPUState* cpu) {
         /* 021C85BC */ cpu->f[0] = fma(cpu->f[7], cpu->f[7], cpu->f[10]);
         /* 021C85C0 */ _t61 = cpu->r[5] + 0xFFFFBCD0u;
         /* 021C85C0 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t61);
-        /* 021C85C4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[9]);
+        /* 021C85C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[9]));
         /* 021C85C8 */ _t62 = cpu->r[1] + 0x0000002Cu;
         /* 021C85C8 */ rbrew_write_f32(cpu->mem, _t62, cpu->f[6]);
-        /* 021C85CC */ _t63 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C85CC */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C85CC */ _t64 = _t63 & 0x00000001u;
         /* 021C85CC */ if (_t64) goto L_021C85D0; else goto L_021C867C;
   L_021C85D0: ; // 0x21c85d0
@@ -22062,10 +22062,10 @@ void Gambit_fn_021C83CC(CPUState* cpu) {
         /* 021C8630 */ cpu->f[0] = fma(cpu->f[7], cpu->f[7], cpu->f[10]);
         /* 021C8634 */ _t80 = cpu->r[1] + 0x00000020u;
         /* 021C8634 */ rbrew_write_f32(cpu->mem, _t80, cpu->f[13]);
-        /* 021C8638 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[9]);
+        /* 021C8638 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[9]));
         /* 021C863C */ _t81 = cpu->r[1] + 0x00000040u;
         /* 021C863C */ rbrew_write_f32(cpu->mem, _t81, cpu->f[7]);
-        /* 021C8640 */ _t82 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C8640 */ _t82 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C8640 */ _t83 = _t82 & 0x00000001u;
         /* 021C8640 */ if (_t83) goto L_021C8644; else goto L_021C867C;
   L_021C8644: ; // 0x21c8644
@@ -22099,8 +22099,8 @@ void Gambit_fn_021C83CC(CPUState* cpu) {
         /* 021C8690 */ cpu->f[0] = fma(cpu->f[13], cpu->f[7], cpu->f[11]);
         /* 021C8694 */ _t91 = cpu->r[8] + 0xFFFFBD94u;
         /* 021C8694 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t91);
-        /* 021C8698 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
-        /* 021C869C */ _t92 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C8698 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
+        /* 021C869C */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C869C */ _t93 = _t92 & 0x00000001u;
         /* 021C869C */ if (_t93) goto L_021C87E4; else goto L_021C86A0;
   L_021C86A0: ; // 0x21c86a0
@@ -22146,8 +22146,8 @@ void Gambit_fn_021C83CC(CPUState* cpu) {
   L_021C8718: ; // 0x21c8718
         /* 021C8718 */ /* nop */
         /* 021C871C */ cpu->r[6] = cpu->r[23] & cpu->r[0];
-        /* 021C871C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 021C8720 */ _t102 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C871C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 021C8720 */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C8720 */ _t103 = _t102 & 0x00000001u;
         /* 021C8720 */ if (_t103) goto L_021C87D8; else goto L_021C8724;
   L_021C8724: ; // 0x21c8724
@@ -22199,9 +22199,9 @@ void Gambit_fn_021C83CC(CPUState* cpu) {
         /* 021C8794 */ cpu->r[7] = rbrew_read32(cpu->mem, _t120);
         /* 021C8798 */ _t121 = cpu->r[7] + 0x00000078u;
         /* 021C8798 */ cpu->r[10] = rbrew_read32(cpu->mem, _t121);
-        /* 021C879C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[10]);
+        /* 021C879C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[10]));
         /* 021C87A0 */ cpu->r[3] = 0x00000000u;
-        /* 021C87A4 */ _t122 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C87A4 */ _t122 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C87A4 */ _t123 = _t122 & 0x00000001u;
         /* 021C87A4 */ if (_t123) goto L_021C87A8; else goto L_021C87B0;
   L_021C87A8: ; // 0x21c87a8
@@ -22217,8 +22217,8 @@ void Gambit_fn_021C83CC(CPUState* cpu) {
         /* 021C87BC */ cpu->r[9] = rbrew_read32(cpu->mem, _t126);
         /* 021C87C0 */ _t127 = cpu->r[9] + 0x00000044u;
         /* 021C87C0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t127);
-        /* 021C87C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021C87C8 */ _t128 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C87C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021C87C8 */ _t128 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C87C8 */ _t129 = _t128 & 0x00000001u;
         /* 021C87C8 */ if (_t129) goto L_021C87D8; else goto L_021C87CC;
   L_021C87CC: ; // 0x21c87cc
@@ -22228,9 +22228,9 @@ void Gambit_fn_021C83CC(CPUState* cpu) {
         /* 021C87D4 */ Gambit_fn_023EEED0(cpu);
   L_021C87D8: ; // 0x21c87d8
         /* 021C87D8 */ cpu->r[17] = cpu->r[17] + 0xFFFFFFFFu;
-        /* 021C87D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[17], 0x00000000u);
+        /* 021C87D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[17], 0x00000000u));
         /* 021C87DC */ cpu->r[24] = cpu->r[24] + 0x00000001u;
-        /* 021C87E0 */ _t131 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C87E0 */ _t131 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C87E0 */ _t132 = _t131 & 0x00000001u;
         /* 021C87E0 */ if (_t132) goto L_021C87E4; else goto L_021C8718;
   L_021C87E4: ; // 0x21c87e4
@@ -22239,7 +22239,7 @@ void Gambit_fn_021C83CC(CPUState* cpu) {
         /* 021C87E8 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t133);
         /* 021C87EC */ _t134 = cpu->r[1] + 0x000000E0u;
         /* 021C87EC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t134);
-        /* 021C87F0 */ _t135 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C87F0 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C87F0 */ _t136 = _t135 & 0x00000001u;
         /* 021C87F0 */ if (_t136) goto L_021C87F4; // else: addr-0 trap, fall-through
   L_021C87F4: ; // 0x21c87f4
@@ -22357,9 +22357,9 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C88F0 */ _t38 = cpu->r[31] + 0x00000051u;
         /* 021C88F0 */ cpu->r[6] = rbrew_read8(cpu->mem, _t38);
         /* 021C88F4 */ cpu->r[19] = 0x101C0000u;
-        /* 021C88F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 021C88F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 021C88FC */ cpu->r[19] = cpu->r[19] + 0x00001EF8u;
-        /* 021C8900 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C8900 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C8900 */ _t40 = _t39 & 0x00000001u;
         /* 021C8900 */ if (_t40) goto L_021C9B20; else goto L_021C8904;
   L_021C8904: ; // 0x21c8904
@@ -22388,10 +22388,10 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C8938 */ _t50 = cpu->r[8] + 0xFFFFBCD0u;
         /* 021C8938 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t50);
         /* 021C893C */ cpu->r[5] = 0x10030000u;
-        /* 021C8940 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[30]);
+        /* 021C8940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[30]));
         /* 021C8944 */ _t51 = cpu->r[5] + 0xFFFFBD80u;
         /* 021C8944 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t51);
-        /* 021C8948 */ _t52 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C8948 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C8948 */ _t53 = _t52 & 0x00000001u;
         /* 021C8948 */ if (_t53) goto L_021C894C; else goto L_021C8980;
   L_021C894C: ; // 0x21c894c
@@ -22421,7 +22421,7 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C898C */ cpu->r[18] = 0x101E0000u;
         /* 021C8990 */ _t60 = cpu->r[8] + 0xFFFFBCD4u;
         /* 021C8990 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t60);
-        /* 021C8994 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[30]);
+        /* 021C8994 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[30]));
         /* 021C8998 */ _t61 = cpu->r[7] + 0xFFFFBCD8u;
         /* 021C8998 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t61);
         /* 021C899C */ cpu->r[18] = cpu->r[18] + 0xFFFF9484u;
@@ -22432,7 +22432,7 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C89AC */ cpu->r[14] = cpu->r[14] + 0xFFFF9594u;
         /* 021C89B0 */ _t63 = cpu->r[1] + 0x0000000Cu;
         /* 021C89B0 */ rbrew_write_f32(cpu->mem, _t63, cpu->f[12]);
-        /* 021C89B4 */ _t64 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C89B4 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C89B4 */ _t65 = _t64 & 0x00000001u;
         /* 021C89B4 */ if (_t65) goto L_021C89B8; else goto L_021C94B0;
   L_021C89B8: ; // 0x21c89b8
@@ -22523,11 +22523,11 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C8A88 */ Gambit_fn_0204A864(cpu);
         /* 021C8A8C */ cpu->r[27] = 0x00000000u;
         /* 021C8A90 */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C8A90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021C8A90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021C8A94 */ _t98 = cpu->r[31] + 0x00000140u;
         /* 021C8A94 */ rbrew_write32(cpu->mem, _t98, cpu->r[3]);
         /* 021C8A98 */ cpu->r[29] = cpu->r[27];
-        /* 021C8A9C */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C8A9C */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C8A9C */ _t100 = _t99 & 0x00000001u;
         /* 021C8A9C */ if (_t100) goto L_021C8AA0; else goto L_021C8B78;
   L_021C8AA0: ; // 0x21c8aa0
@@ -22628,10 +22628,10 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C8B84 */ _t137 = cpu->r[7] + cpu->r[18];
         /* 021C8B84 */ cpu->r[23] = rbrew_read32(cpu->mem, _t137);
         /* 021C8B88 */ cpu->r[24] = 0x00000000u;
-        /* 021C8B8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
+        /* 021C8B8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
         /* 021C8B90 */ _t138 = cpu->r[1] + 0x00000078u;
         /* 021C8B90 */ rbrew_write32(cpu->mem, _t138, cpu->r[30]);
-        /* 021C8B94 */ _t139 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C8B94 */ _t139 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C8B94 */ _t140 = _t139 & 0x00000001u;
         /* 021C8B94 */ if (_t140) goto L_021C8B98; else goto L_021C8E08;
   L_021C8B98: ; // 0x21c8b98
@@ -22649,10 +22649,10 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C8BC0 */ Gambit_fn_02040F70(cpu);
         /* 021C8BC4 */ _t141 = cpu->r[1] + 0x00000078u;
         /* 021C8BC4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t141);
-        /* 021C8BC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021C8BC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021C8BCC */ _t142 = cpu->r[1] + 0x000000CCu;
         /* 021C8BCC */ cpu->r[9] = rbrew_read32(cpu->mem, _t142);
-        /* 021C8BD0 */ _t143 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C8BD0 */ _t143 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C8BD0 */ _t144 = _t143 & 0x00000001u;
         /* 021C8BD0 */ if (_t144) goto L_021C8BD4; else goto L_021C8BE0;
   L_021C8BD4: ; // 0x21c8bd4
@@ -22665,8 +22665,8 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C8BE0 */ _t147 = cpu->r[9] + 0x00000000u;
         /* 021C8BE0 */ cpu->r[6] = rbrew_read32(cpu->mem, _t147);
         /* 021C8BE4 */ cpu->r[5] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021C8BE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 021C8BE8 */ _t148 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C8BE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 021C8BE8 */ _t148 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C8BE8 */ _t149 = _t148 & 0x00000001u;
         /* 021C8BE8 */ if (_t149) goto L_021C8C74; else goto L_021C8BEC;
   L_021C8BEC: ; // 0x21c8bec
@@ -22719,8 +22719,8 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C8C64 */ _t166 = cpu->r[9] + 0x00000000u;
         /* 021C8C64 */ cpu->r[11] = rbrew_read32(cpu->mem, _t166);
         /* 021C8C68 */ cpu->r[10] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021C8C68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021C8C6C */ _t167 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C8C68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021C8C6C */ _t167 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C8C6C */ _t168 = _t167 & 0x00000001u;
         /* 021C8C6C */ if (_t168) goto L_021C8C70; else goto L_021C8CB4;
   L_021C8C70: ; // 0x21c8c70
@@ -22751,8 +22751,8 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C8CA8 */ _t178 = cpu->r[9] + 0x00000000u;
         /* 021C8CA8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t178);
         /* 021C8CAC */ cpu->r[10] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021C8CAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021C8CB0 */ _t179 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C8CAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021C8CB0 */ _t179 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C8CB0 */ _t180 = _t179 & 0x00000001u;
         /* 021C8CB0 */ if (_t180) goto L_021C8D30; else goto L_021C8CB4;
   L_021C8CB4: ; // 0x21c8cb4
@@ -22797,10 +22797,10 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C8D18 */ _t194 = cpu->r[9] + 0x00000030u;
         /* 021C8D18 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t194);
         /* 021C8D1C */ cpu->f[6] = cpu->f[8] + cpu->f[7];
-        /* 021C8D20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 021C8D20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 021C8D24 */ _t195 = cpu->r[1] + 0x00000058u;
         /* 021C8D24 */ rbrew_write_f32(cpu->mem, _t195, cpu->f[6]);
-        /* 021C8D28 */ _t196 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C8D28 */ _t196 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C8D28 */ _t197 = _t196 & 0x00000001u;
         /* 021C8D28 */ if (_t197) goto L_021C8D2C; else goto L_021C8D50;
   L_021C8D2C: ; // 0x21c8d2c
@@ -22812,10 +22812,10 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C8D3C */ _t198 = cpu->r[9] + 0x00000030u;
         /* 021C8D3C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t198);
         /* 021C8D40 */ cpu->f[10] = cpu->f[6] + cpu->f[11];
-        /* 021C8D44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 021C8D44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 021C8D48 */ _t199 = cpu->r[1] + 0x00000058u;
         /* 021C8D48 */ rbrew_write_f32(cpu->mem, _t199, cpu->f[10]);
-        /* 021C8D4C */ _t200 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C8D4C */ _t200 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C8D4C */ _t201 = _t200 & 0x00000001u;
         /* 021C8D4C */ if (_t201) goto L_021C8D88; else goto L_021C8D50;
   L_021C8D50: ; // 0x21c8d50
@@ -22834,8 +22834,8 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C8D74 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t204);
         /* 021C8D78 */ cpu->f[11] = fma(cpu->f[0], cpu->f[10], cpu->f[9]);
         /* 021C8D7C */ cpu->f[0] = fma(cpu->f[0], cpu->f[13], cpu->f[8]);
-        /* 021C8D80 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[0]);
-        /* 021C8D84 */ _t205 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C8D80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[0]));
+        /* 021C8D84 */ _t205 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C8D84 */ _t206 = _t205 & 0x00000001u;
         /* 021C8D84 */ if (_t206) goto L_021C8D88; else goto L_021C8DF4;
   L_021C8D88: ; // 0x21c8d88
@@ -22893,14 +22893,14 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C8DF0 */ rbrew_write_f32(cpu->mem, _t231, cpu->f[7]);
   L_021C8DF4: ; // 0x21c8df4
         /* 021C8DF4 */ cpu->r[23] = cpu->r[23] + 0xFFFFFFFFu;
-        /* 021C8DF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
+        /* 021C8DF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
         /* 021C8DF8 */ cpu->r[24] = cpu->r[24] + 0x00000001u;
-        /* 021C8DFC */ _t232 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C8DFC */ _t232 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C8DFC */ _t233 = _t232 & 0x00000001u;
         /* 021C8DFC */ if (_t233) goto L_021C8E00; else goto L_021C8BA0;
   L_021C8E00: ; // 0x21c8e00
-        /* 021C8E00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 021C8E04 */ _t234 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C8E00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 021C8E04 */ _t234 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C8E04 */ _t235 = _t234 & 0x00000001u;
         /* 021C8E04 */ if (_t235) goto L_021C8E08; else goto L_021C8EE0;
   L_021C8E08: ; // 0x21c8e08
@@ -23084,10 +23084,10 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C8FC8 */ Gambit_fn_023ED8D8(cpu);
         /* 021C8FCC */ _t299 = cpu->r[1] + 0x00000088u;
         /* 021C8FCC */ rbrew_write32(cpu->mem, _t299, cpu->r[3]);
-        /* 021C8FD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021C8FD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021C8FD4 */ _t300 = cpu->r[1] + 0x0000008Cu;
         /* 021C8FD4 */ rbrew_write32(cpu->mem, _t300, cpu->r[4]);
-        /* 021C8FD8 */ _t301 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C8FD8 */ _t301 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C8FD8 */ _t302 = _t301 & 0x00000001u;
         /* 021C8FD8 */ if (_t302) goto L_021C8FDC; else goto L_021C9004;
   L_021C8FDC: ; // 0x21c8fdc
@@ -23099,9 +23099,9 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C8FEC */ _t304 = cpu->r[1] + 0x0000008Cu;
         /* 021C8FEC */ cpu->f[14] = rbrew_read_f32(cpu->mem, _t304);
         /* 021C8FF0 */ cpu->f[8] = cpu->f[14] - cpu->f[12];
-        /* 021C8FF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021C8FF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021C8FF8 */ /* nop */
-        /* 021C8FFC */ _t305 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C8FFC */ _t305 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C8FFC */ _t306 = _t305 & 0x00000001u;
         /* 021C8FFC */ if (_t306) goto L_021C9000; else goto L_021C903C;
   L_021C9000: ; // 0x21c9000
@@ -23116,23 +23116,23 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C9014 */ cpu->f[7] = cpu->f[6] - cpu->f[27];
         /* 021C9018 */ /* nop */
         /* 021C901C */ cpu->f[8] = cpu->f[14] - cpu->f[12];
-        /* 021C9020 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021C9020 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021C9024 */ /* nop */
-        /* 021C9028 */ _t309 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9028 */ _t309 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9028 */ _t310 = _t309 & 0x00000001u;
         /* 021C9028 */ if (_t310) goto L_021C902C; else goto L_021C903C;
   L_021C902C: ; // 0x21c902c
         /* 021C902C */ cpu->f[16] = cpu->f[22];
-        /* 021C9030 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[16], cpu->f[14]);
-        /* 021C9034 */ _t311 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C9030 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[16], cpu->f[14]));
+        /* 021C9034 */ _t311 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C9034 */ _t312 = _t311 & 0x00000001u;
         /* 021C9034 */ if (_t312) goto L_021C9038; else goto L_021C904C;
   L_021C9038: ; // 0x21c9038
         /* 021C9038 */ goto L_021C9048;
   L_021C903C: ; // 0x21c903c
         /* 021C903C */ cpu->f[16] = cpu->f[15];
-        /* 021C9040 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[16], cpu->f[14]);
-        /* 021C9044 */ _t313 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C9040 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[16], cpu->f[14]));
+        /* 021C9044 */ _t313 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C9044 */ _t314 = _t313 & 0x00000001u;
         /* 021C9044 */ if (_t314) goto L_021C9048; else goto L_021C904C;
   L_021C9048: ; // 0x21c9048
@@ -23148,14 +23148,14 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C9064 */ cpu->f[21] = cpu->f[22];
         /* 021C9068 */ cpu->r[28] = cpu->r[16];
         /* 021C906C */ cpu->f[9] = cpu->f[16] + cpu->f[0];
-        /* 021C9070 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[17], cpu->f[9]);
-        /* 021C9074 */ _t316 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9070 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[17], cpu->f[9]));
+        /* 021C9074 */ _t316 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9074 */ _t317 = _t316 & 0x00000001u;
         /* 021C9074 */ if (_t317) goto L_021C9078; else goto L_021C9088;
   L_021C9078: ; // 0x21c9078
         /* 021C9078 */ cpu->f[0] = cpu->f[17] - cpu->f[16];
-        /* 021C907C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[21]);
-        /* 021C9080 */ _t318 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C907C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[21]));
+        /* 021C9080 */ _t318 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C9080 */ _t319 = _t318 & 0x00000001u;
         /* 021C9080 */ if (_t319) goto L_021C9084; else goto L_021C94A4;
   L_021C9084: ; // 0x21c9084
@@ -23163,10 +23163,10 @@ void Gambit_fn_021C8804(CPUState* cpu) {
   L_021C9088: ; // 0x21c9088
         /* 021C9088 */ _t320 = cpu->r[1] + 0x00000040u;
         /* 021C9088 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t320);
-        /* 021C908C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021C908C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021C9090 */ /* nop */
         /* 021C9094 */ /* nop */
-        /* 021C9098 */ _t321 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9098 */ _t321 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9098 */ _t322 = _t321 & 0x00000001u;
         /* 021C9098 */ if (_t322) goto L_021C909C; else goto L_021C9140;
   L_021C909C: ; // 0x21c909c
@@ -23227,10 +23227,10 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C9128 */ rbrew_write32(cpu->mem, _t341, cpu->r[12]);
         /* 021C912C */ Gambit_fn_0204A4DC(cpu);
         /* 021C9130 */ cpu->r[5] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C9130 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021C9130 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021C9134 */ _t342 = cpu->r[31] + 0x00000140u;
         /* 021C9134 */ rbrew_write32(cpu->mem, _t342, cpu->r[3]);
-        /* 021C9138 */ _t343 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9138 */ _t343 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9138 */ _t344 = _t343 & 0x00000001u;
         /* 021C9138 */ if (_t344) goto L_021C9460; else goto L_021C913C;
   L_021C913C: ; // 0x21c913c
@@ -23293,10 +23293,10 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C91CC */ rbrew_write32(cpu->mem, _t363, cpu->r[12]);
         /* 021C91D0 */ Gambit_fn_0204A4DC(cpu);
         /* 021C91D4 */ cpu->r[5] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C91D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021C91D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021C91D8 */ _t364 = cpu->r[31] + 0x00000140u;
         /* 021C91D8 */ rbrew_write32(cpu->mem, _t364, cpu->r[3]);
-        /* 021C91DC */ _t365 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C91DC */ _t365 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C91DC */ _t366 = _t365 & 0x00000001u;
         /* 021C91DC */ if (_t366) goto L_021C9460; else goto L_021C91E0;
   L_021C91E0: ; // 0x21c91e0
@@ -23308,10 +23308,10 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C91EC */ _t369 = cpu->r[6] + cpu->r[18];
         /* 021C91EC */ cpu->r[22] = rbrew_read32(cpu->mem, _t369);
         /* 021C91F0 */ cpu->r[21] = 0x00000000u;
-        /* 021C91F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
+        /* 021C91F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
         /* 021C91F8 */ _t370 = cpu->r[1] + 0x00000034u;
         /* 021C91F8 */ rbrew_write32(cpu->mem, _t370, cpu->r[28]);
-        /* 021C91FC */ _t371 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C91FC */ _t371 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C91FC */ _t372 = _t371 & 0x00000001u;
         /* 021C91FC */ if (_t372) goto L_021C9200; else goto L_021C9460;
   L_021C9200: ; // 0x21c9200
@@ -23329,10 +23329,10 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C9228 */ cpu->r[3] = cpu->r[20];
         /* 021C922C */ Gambit_fn_02040F70(cpu);
         /* 021C9230 */ cpu->r[11] = cpu->r[23];
-        /* 021C9230 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021C9230 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021C9234 */ _t373 = cpu->r[1] + 0x00000018u;
         /* 021C9234 */ cpu->r[9] = rbrew_read8(cpu->mem, _t373);
-        /* 021C9238 */ _t374 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C9238 */ _t374 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C9238 */ _t375 = _t374 & 0x00000001u;
         /* 021C9238 */ if (_t375) goto L_021C9250; else goto L_021C923C;
   L_021C923C: ; // 0x21c923c
@@ -23341,8 +23341,8 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C9240 */ _t377 = cpu->r[12] + 0x00000000u;
         /* 021C9240 */ cpu->r[0] = rbrew_read32(cpu->mem, _t377);
         /* 021C9244 */ cpu->r[11] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021C9244 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021C9248 */ _t378 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9244 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021C9248 */ _t378 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9248 */ _t379 = _t378 & 0x00000001u;
         /* 021C9248 */ if (_t379) goto L_021C924C; else goto L_021C927C;
   L_021C924C: ; // 0x21c924c
@@ -23355,8 +23355,8 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C925C */ _t380 = cpu->r[5] + 0x00000004u;
         /* 021C925C */ cpu->r[8] = rbrew_read32(cpu->mem, _t380);
         /* 021C925C */ cpu->r[5] = _t380;
-        /* 021C9260 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[0]);
-        /* 021C9264 */ _t381 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9260 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[0]));
+        /* 021C9264 */ _t381 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9264 */ _t382 = _t381 & 0x00000001u;
         /* 021C9264 */ if (_t382) goto L_021C9454; else goto L_021C9268;
   L_021C9268: ; // 0x21c9268
@@ -23371,8 +23371,8 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C9270 */ _t387 = cpu->r[12] + 0x00000000u;
         /* 021C9270 */ cpu->r[0] = rbrew_read32(cpu->mem, _t387);
         /* 021C9274 */ cpu->r[11] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021C9274 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021C9278 */ _t388 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9274 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021C9278 */ _t388 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9278 */ _t389 = _t388 & 0x00000001u;
         /* 021C9278 */ if (_t389) goto L_021C92E4; else goto L_021C927C;
   L_021C927C: ; // 0x21c927c
@@ -23407,9 +23407,9 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C92D0 */ _t397 = cpu->r[10] + 0x00000000u;
         /* 021C92D0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t397);
         /* 021C92D4 */ cpu->r[6] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021C92D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 021C92D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 021C92D8 */ /* nop */
-        /* 021C92DC */ _t398 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C92DC */ _t398 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C92DC */ _t399 = _t398 & 0x00000001u;
         /* 021C92DC */ if (_t399) goto L_021C92E0; else goto L_021C9310;
   L_021C92E0: ; // 0x21c92e0
@@ -23431,9 +23431,9 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C9300 */ _t406 = cpu->r[10] + 0x00000000u;
         /* 021C9300 */ cpu->r[0] = rbrew_read32(cpu->mem, _t406);
         /* 021C9304 */ cpu->r[6] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021C9304 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 021C9304 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 021C9308 */ /* nop */
-        /* 021C930C */ _t407 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C930C */ _t407 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C930C */ _t408 = _t407 & 0x00000001u;
         /* 021C930C */ if (_t408) goto L_021C93A8; else goto L_021C9310;
   L_021C9310: ; // 0x21c9310
@@ -23484,10 +23484,10 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C9390 */ cpu->f[12] = cpu->f[6] * cpu->f[8];
         /* 021C9394 */ _t421 = cpu->r[1] + 0x00000020u;
         /* 021C9394 */ rbrew_write_f32(cpu->mem, _t421, cpu->f[11]);
-        /* 021C9398 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021C9398 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021C939C */ _t422 = cpu->r[1] + 0x00000024u;
         /* 021C939C */ rbrew_write_f32(cpu->mem, _t422, cpu->f[12]);
-        /* 021C93A0 */ _t423 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C93A0 */ _t423 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C93A0 */ _t424 = _t423 & 0x00000001u;
         /* 021C93A0 */ if (_t424) goto L_021C93A4; else goto L_021C93FC;
   L_021C93A4: ; // 0x21c93a4
@@ -23518,10 +23518,10 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C93E0 */ cpu->f[12] = cpu->f[6] * cpu->f[8];
         /* 021C93E4 */ _t433 = cpu->r[1] + 0x00000020u;
         /* 021C93E4 */ rbrew_write_f32(cpu->mem, _t433, cpu->f[11]);
-        /* 021C93E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021C93E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021C93EC */ _t434 = cpu->r[1] + 0x00000024u;
         /* 021C93EC */ rbrew_write_f32(cpu->mem, _t434, cpu->f[12]);
-        /* 021C93F0 */ _t435 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C93F0 */ _t435 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C93F0 */ _t436 = _t435 & 0x00000001u;
         /* 021C93F0 */ if (_t436) goto L_021C93F4; else goto L_021C93FC;
   L_021C93F4: ; // 0x21c93f4
@@ -23552,8 +23552,8 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C942C */ _t446 = cpu->r[1] + 0x00000060u;
         /* 021C942C */ rbrew_write32(cpu->mem, _t446, cpu->r[11]);
         /* 021C9430 */ Gambit_fn_021C83CC(cpu);
-        /* 021C9434 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000020u);
-        /* 021C9438 */ _t447 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9434 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000020u));
+        /* 021C9438 */ _t447 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9438 */ _t448 = _t447 & 0x00000001u;
         /* 021C9438 */ if (_t448) goto L_021C943C; else goto L_021C9454;
   L_021C943C: ; // 0x21c943c
@@ -23567,33 +23567,33 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C9450 */ cpu->r[27] = cpu->r[27] + 0x00000004u;
   L_021C9454: ; // 0x21c9454
         /* 021C9454 */ cpu->r[22] = cpu->r[22] + 0xFFFFFFFFu;
-        /* 021C9454 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
+        /* 021C9454 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
         /* 021C9458 */ cpu->r[21] = cpu->r[21] + 0x00000001u;
-        /* 021C945C */ _t451 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C945C */ _t451 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C945C */ _t452 = _t451 & 0x00000001u;
         /* 021C945C */ if (_t452) goto L_021C9460; else goto L_021C920C;
   L_021C9460: ; // 0x21c9460
-        /* 021C9460 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[16], cpu->f[14]);
-        /* 021C9464 */ _t453 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9460 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[16], cpu->f[14]));
+        /* 021C9464 */ _t453 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9464 */ _t454 = _t453 & 0x00000001u;
         /* 021C9464 */ if (_t454) goto L_021C94A4; else goto L_021C9468;
   L_021C9468: ; // 0x21c9468
-        /* 021C9468 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[16], 0x00000000u);
-        /* 021C946C */ _t455 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9468 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[16], 0x00000000u));
+        /* 021C946C */ _t455 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C946C */ _t456 = _t455 & 0x00000001u;
         /* 021C946C */ if (_t456) goto L_021C9470; else goto L_021C94A4;
   L_021C9470: ; // 0x21c9470
         /* 021C9470 */ cpu->f[16] = cpu->f[16] + cpu->f[15];
-        /* 021C9474 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[16], cpu->f[14]);
+        /* 021C9474 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[16], cpu->f[14]));
         /* 021C9478 */ _t457 = cpu->r[31] + 0x000000C0u;
         /* 021C9478 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t457);
-        /* 021C947C */ _t458 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C947C */ _t458 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C947C */ _t459 = _t458 & 0x00000001u;
         /* 021C947C */ if (_t459) goto L_021C9490; else goto L_021C9480;
   L_021C9480: ; // 0x21c9480
         /* 021C9480 */ cpu->f[9] = cpu->f[16] + cpu->f[0];
-        /* 021C9484 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[17], cpu->f[9]);
-        /* 021C9488 */ _t460 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9484 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[17], cpu->f[9]));
+        /* 021C9488 */ _t460 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9488 */ _t461 = _t460 & 0x00000001u;
         /* 021C9488 */ if (_t461) goto L_021C948C; else goto L_021C9088;
   L_021C948C: ; // 0x21c948c
@@ -23601,38 +23601,38 @@ void Gambit_fn_021C8804(CPUState* cpu) {
   L_021C9490: ; // 0x21c9490
         /* 021C9490 */ cpu->f[16] = cpu->f[14];
         /* 021C9494 */ cpu->f[9] = cpu->f[16] + cpu->f[0];
-        /* 021C9498 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[17], cpu->f[9]);
-        /* 021C949C */ _t462 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9498 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[17], cpu->f[9]));
+        /* 021C949C */ _t462 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C949C */ _t463 = _t462 & 0x00000001u;
         /* 021C949C */ if (_t463) goto L_021C94A0; else goto L_021C9088;
   L_021C94A0: ; // 0x21c94a0
         /* 021C94A0 */ goto L_021C9078;
   L_021C94A4: ; // 0x21c94a4
         /* 021C94A4 */ cpu->r[15] = cpu->r[15] + 0xFFFFFFFFu;
-        /* 021C94A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[15], 0x00000000u);
+        /* 021C94A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[15], 0x00000000u));
         /* 021C94A8 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 021C94AC */ _t464 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C94AC */ _t464 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C94AC */ _t465 = _t464 & 0x00000001u;
         /* 021C94AC */ if (_t465) goto L_021C94B0; else goto L_021C8FB8;
   L_021C94B0: ; // 0x21c94b0
         /* 021C94B0 */ _t466 = cpu->r[31] + 0x000000DCu;
         /* 021C94B0 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t466);
-        /* 021C94B4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[30]);
-        /* 021C94B8 */ _t467 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C94B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[30]));
+        /* 021C94B8 */ _t467 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C94B8 */ _t468 = _t467 & 0x00000001u;
         /* 021C94B8 */ if (_t468) goto L_021C94BC; else goto L_021C9B20;
   L_021C94BC: ; // 0x21c94bc
         /* 021C94BC */ _t469 = cpu->r[31] + 0x000000E0u;
         /* 021C94BC */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t469);
-        /* 021C94C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[30]);
-        /* 021C94C4 */ _t470 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C94C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[30]));
+        /* 021C94C4 */ _t470 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C94C4 */ _t471 = _t470 & 0x00000001u;
         /* 021C94C4 */ if (_t471) goto L_021C94C8; else goto L_021C9B20;
   L_021C94C8: ; // 0x21c94c8
         /* 021C94C8 */ _t472 = cpu->r[31] + 0x000000E4u;
         /* 021C94C8 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t472);
-        /* 021C94CC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[30]);
-        /* 021C94D0 */ _t473 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C94CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[30]));
+        /* 021C94D0 */ _t473 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C94D0 */ _t474 = _t473 & 0x00000001u;
         /* 021C94D0 */ if (_t474) goto L_021C94D4; else goto L_021C9B20;
   L_021C94D4: ; // 0x21c94d4
@@ -23657,8 +23657,8 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C94FC */ _t483 = cpu->r[1] + 0x00000024u;
         /* 021C94FC */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t483);
         /* 021C9500 */ cpu->f[11] = fma(cpu->f[9], cpu->f[9], cpu->f[0]);
-        /* 021C9504 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[30]);
-        /* 021C9508 */ _t484 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C9504 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[30]));
+        /* 021C9508 */ _t484 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C9508 */ _t485 = _t484 & 0x00000001u;
         /* 021C9508 */ if (_t485) goto L_021C950C; else goto L_021C9540;
   L_021C950C: ; // 0x21c950c
@@ -23693,8 +23693,8 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C9560 */ cpu->f[0] = fabs(cpu->f[6]);
         /* 021C9564 */ _t492 = cpu->r[8] + 0xFFFFBDA4u;
         /* 021C9564 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t492);
-        /* 021C9568 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[10]);
-        /* 021C956C */ _t493 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C9568 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[10]));
+        /* 021C956C */ _t493 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C956C */ _t494 = _t493 & 0x00000001u;
         /* 021C956C */ if (_t494) goto L_021C9570; else goto L_021C9710;
   L_021C9570: ; // 0x21c9570
@@ -23887,8 +23887,8 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C9734 */ _t566 = cpu->r[1] + 0x00000160u;
         /* 021C9734 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t566);
         /* 021C9738 */ cpu->f[13] = fma(cpu->f[10], cpu->f[10], cpu->f[8]);
-        /* 021C973C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[30]);
-        /* 021C9740 */ _t567 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C973C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[30]));
+        /* 021C9740 */ _t567 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C9740 */ _t568 = _t567 & 0x00000001u;
         /* 021C9740 */ if (_t568) goto L_021C97E8; else goto L_021C9744;
   L_021C9744: ; // 0x21c9744
@@ -24175,7 +24175,7 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C99EC */ rbrew_write32(cpu->mem, _t675, cpu->r[0]);
         /* 021C99F0 */ _t676 = cpu->r[1] + 0x00000140u;
         /* 021C99F0 */ rbrew_write32(cpu->mem, _t676, cpu->r[4]);
-        /* 021C99F4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 021C99F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 021C99F8 */ _t677 = cpu->r[1] + 0x00000108u;
         /* 021C99F8 */ rbrew_write_f32(cpu->mem, _t677, cpu->f[8]);
         /* 021C99FC */ _t678 = cpu->r[1] + 0x00000108u;
@@ -24185,7 +24185,7 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C9A04 */ cpu->f[3] = cpu->f[28];
         /* 021C9A08 */ _t680 = cpu->r[1] + 0x00000144u;
         /* 021C9A08 */ rbrew_write32(cpu->mem, _t680, cpu->r[6]);
-        /* 021C9A0C */ _t681 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C9A0C */ _t681 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C9A0C */ _t682 = _t681 & 0x00000001u;
         /* 021C9A0C */ if (_t682) goto L_021C9A4C; else goto L_021C9A10;
   L_021C9A10: ; // 0x21c9a10
@@ -24202,10 +24202,10 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C9A34 */ cpu->r[8] = 0x000001FFu;
         /* 021C9A38 */ Gambit_fn_0204A4DC(cpu);
         /* 021C9A3C */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C9A3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021C9A3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021C9A40 */ _t684 = cpu->r[31] + 0x00000140u;
         /* 021C9A40 */ rbrew_write32(cpu->mem, _t684, cpu->r[3]);
-        /* 021C9A44 */ _t685 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9A44 */ _t685 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9A44 */ _t686 = _t685 & 0x00000001u;
         /* 021C9A44 */ if (_t686) goto L_021C9B0C; else goto L_021C9A48;
   L_021C9A48: ; // 0x21c9a48
@@ -24221,10 +24221,10 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C9A68 */ cpu->r[5] = cpu->r[27];
         /* 021C9A6C */ Gambit_fn_0204A864(cpu);
         /* 021C9A70 */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C9A70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021C9A70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021C9A74 */ _t687 = cpu->r[31] + 0x00000140u;
         /* 021C9A74 */ rbrew_write32(cpu->mem, _t687, cpu->r[3]);
-        /* 021C9A78 */ _t688 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9A78 */ _t688 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9A78 */ _t689 = _t688 & 0x00000001u;
         /* 021C9A78 */ if (_t689) goto L_021C9B0C; else goto L_021C9A7C;
   L_021C9A7C: ; // 0x21c9a7c
@@ -24235,8 +24235,8 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C9A84 */ cpu->r[9] = rbrew_rlwinm(cpu->r[0], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 021C9A88 */ _t692 = cpu->r[9] + cpu->r[30];
         /* 021C9A88 */ cpu->r[12] = rbrew_read32(cpu->mem, _t692);
-        /* 021C9A8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021C9A90 */ _t693 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C9A8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021C9A90 */ _t693 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C9A90 */ _t694 = _t693 & 0x00000001u;
         /* 021C9A90 */ if (_t694) goto L_021C9A94; else goto L_021C9B0C;
   L_021C9A94: ; // 0x21c9a94
@@ -24252,8 +24252,8 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C9AB4 */ Gambit_fn_02040F70(cpu);
         /* 021C9AB8 */ _t696 = cpu->r[1] + 0x00000074u;
         /* 021C9AB8 */ cpu->r[4] = rbrew_read32(cpu->mem, _t696);
-        /* 021C9ABC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 021C9AC0 */ _t697 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9ABC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 021C9AC0 */ _t697 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9AC0 */ _t698 = _t697 & 0x00000001u;
         /* 021C9AC0 */ if (_t698) goto L_021C9AC4; else goto L_021C9ACC;
   L_021C9AC4: ; // 0x21c9ac4
@@ -24290,9 +24290,9 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C9B08 */ Gambit_fn_021C83CC(cpu);
   L_021C9B0C: ; // 0x21c9b0c
         /* 021C9B0C */ cpu->r[26] = cpu->r[26] + 0xFFFFFFFFu;
-        /* 021C9B0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021C9B0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021C9B10 */ cpu->r[27] = cpu->r[27] + 0x0000000Cu;
-        /* 021C9B14 */ _t711 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9B14 */ _t711 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9B14 */ _t712 = _t711 & 0x00000001u;
         /* 021C9B14 */ if (_t712) goto L_021C9B20; else goto L_021C9B18;
   L_021C9B18: ; // 0x21c9b18
@@ -24305,9 +24305,9 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C9B24 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t714);
         /* 021C9B28 */ _t715 = cpu->r[12] + 0xFFFFBDB0u;
         /* 021C9B28 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t715);
-        /* 021C9B2C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[11]);
+        /* 021C9B2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[11]));
         /* 021C9B30 */ cpu->r[7] = 0x00000100u;
-        /* 021C9B34 */ _t716 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9B34 */ _t716 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9B34 */ _t717 = _t716 & 0x00000001u;
         /* 021C9B34 */ if (_t717) goto L_021C9B3C; else goto L_021C9B38;
   L_021C9B38: ; // 0x21c9b38
@@ -24330,10 +24330,10 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C9B64 */ rbrew_write32(cpu->mem, _t721, cpu->r[0]);
         /* 021C9B68 */ Gambit_fn_0204A4DC(cpu);
         /* 021C9B6C */ cpu->r[4] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C9B6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 021C9B6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 021C9B70 */ _t722 = cpu->r[31] + 0x00000130u;
         /* 021C9B70 */ rbrew_write32(cpu->mem, _t722, cpu->r[3]);
-        /* 021C9B74 */ _t723 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9B74 */ _t723 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9B74 */ _t724 = _t723 & 0x00000001u;
         /* 021C9B74 */ if (_t724) goto L_021C9B84; else goto L_021C9B78;
   L_021C9B78: ; // 0x21c9b78
@@ -24427,7 +24427,7 @@ void Gambit_fn_021C8804(CPUState* cpu) {
         /* 021C9C34 */ cpu->f[20] = rbrew_read_f64(cpu->mem, _t763);
         /* 021C9C38 */ _t764 = cpu->r[1] + 0x000003A0u;
         /* 021C9C38 */ cpu->f[23] = rbrew_read_f64(cpu->mem, _t764);
-        /* 021C9C3C */ _t765 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9C3C */ _t765 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9C3C */ _t766 = _t765 & 0x00000001u;
         /* 021C9C3C */ if (_t766) goto L_021C9C40; // else: addr-0 trap, fall-through
   L_021C9C40: ; // 0x21c9c40
@@ -24456,9 +24456,9 @@ void Gambit_fn_021C9C50(CPUState* cpu) {
         /* 02031BE4 */ _t4 = cpu->r[4] + 0x00000000u;
         /* 02031BE4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t4);
         /* 02031BE8 */ cpu->r[31] = cpu->r[4];
-        /* 02031BEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02031BEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02031BF0 */ cpu->r[30] = cpu->r[3];
-        /* 02031BF4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02031BF4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02031BF4 */ _t6 = _t5 & 0x00000001u;
         /* 02031BF4 */ if (_t6) goto L_02031C58; else goto L_02031BF8;
   L_02031BF8: ; // 0x2031bf8
@@ -24466,8 +24466,8 @@ void Gambit_fn_021C9C50(CPUState* cpu) {
         /* 02031BF8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
         /* 02031BFC */ _t8 = cpu->r[3] + 0x0000011Cu;
         /* 02031BFC */ cpu->r[11] = rbrew_read8(cpu->mem, _t8);
-        /* 02031C00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02031C04 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02031C00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02031C04 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02031C04 */ _t10 = _t9 & 0x00000001u;
         /* 02031C04 */ if (_t10) goto L_02031C58; else goto L_02031C08;
   L_02031C08: ; // 0x2031c08
@@ -24552,9 +24552,9 @@ void Gambit_fn_021C9C60(CPUState* cpu) {
         /* 021C9C9C */ _t10 = cpu->r[29] + 0x00000120u;
         /* 021C9C9C */ cpu->r[12] = rbrew_read8(cpu->mem, _t10);
         /* 021C9CA0 */ cpu->r[31] = cpu->r[5];
-        /* 021C9CA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021C9CA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021C9CA8 */ cpu->r[30] = cpu->r[4];
-        /* 021C9CAC */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9CAC */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9CAC */ _t12 = _t11 & 0x00000001u;
         /* 021C9CAC */ if (_t12) goto L_021C9E00; else goto L_021C9CB0;
   L_021C9CB0: ; // 0x21c9cb0
@@ -24571,11 +24571,11 @@ void Gambit_fn_021C9C60(CPUState* cpu) {
         /* 021C9CC8 */ cpu->f[11] = fma(cpu->f[10], cpu->f[10], cpu->f[8]);
         /* 021C9CCC */ _t17 = cpu->r[1] + 0x0000000Cu;
         /* 021C9CCC */ rbrew_write_f32(cpu->mem, _t17, cpu->f[9]);
-        /* 021C9CD0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
+        /* 021C9CD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
         /* 021C9CD4 */ _t18 = cpu->r[1] + 0x00000008u;
         /* 021C9CD4 */ rbrew_write_f32(cpu->mem, _t18, cpu->f[12]);
         /* 021C9CD8 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
-        /* 021C9CDC */ _t19 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C9CDC */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C9CDC */ _t20 = _t19 & 0x00000001u;
         /* 021C9CDC */ if (_t20) goto L_021C9D38; else goto L_021C9CE0;
   L_021C9CE0: ; // 0x21c9ce0
@@ -24605,8 +24605,8 @@ void Gambit_fn_021C9C60(CPUState* cpu) {
         /* 021C9D24 */ cpu->f[10] = cpu->f[12] - cpu->f[10];
         /* 021C9D28 */ _t27 = cpu->r[29] + 0x00000108u;
         /* 021C9D28 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t27);
-        /* 021C9D2C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[11]);
-        /* 021C9D30 */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9D2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[11]));
+        /* 021C9D30 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9D30 */ _t29 = _t28 & 0x00000001u;
         /* 021C9D30 */ if (_t29) goto L_021C9D34; else goto L_021C9E00;
   L_021C9D34: ; // 0x21c9d34
@@ -24656,15 +24656,15 @@ void Gambit_fn_021C9C60(CPUState* cpu) {
         /* 021C9DB0 */ cpu->f[10] = cpu->f[12] - cpu->f[10];
         /* 021C9DB4 */ _t41 = cpu->r[29] + 0x00000108u;
         /* 021C9DB4 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t41);
-        /* 021C9DB8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[11]);
-        /* 021C9DBC */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9DB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[11]));
+        /* 021C9DBC */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9DBC */ _t43 = _t42 & 0x00000001u;
         /* 021C9DBC */ if (_t43) goto L_021C9DC0; else goto L_021C9E00;
   L_021C9DC0: ; // 0x21c9dc0
         /* 021C9DC0 */ _t44 = cpu->r[29] + 0x0000010Cu;
         /* 021C9DC0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t44);
-        /* 021C9DC4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[12]);
-        /* 021C9DC8 */ _t45 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9DC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[12]));
+        /* 021C9DC8 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9DC8 */ _t46 = _t45 & 0x00000001u;
         /* 021C9DC8 */ if (_t46) goto L_021C9FC0; else goto L_021C9DCC;
   L_021C9DCC: ; // 0x21c9dcc
@@ -24684,7 +24684,7 @@ void Gambit_fn_021C9C60(CPUState* cpu) {
         /* 021C9DE4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t53);
         /* 021C9DE8 */ _t54 = cpu->r[1] + 0x00000020u;
         /* 021C9DE8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t54);
-        /* 021C9DEC */ _t55 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9DEC */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9DEC */ _t56 = _t55 & 0x00000001u;
         /* 021C9DEC */ if (_t56) goto L_021C9DF0; // else: addr-0 trap, fall-through
   L_021C9DF0: ; // 0x21c9df0
@@ -24697,67 +24697,67 @@ void Gambit_fn_021C9C60(CPUState* cpu) {
         /* 021C9E00 */ _t58 = cpu->r[29] + 0x00000154u;
         /* 021C9E00 */ cpu->r[11] = rbrew_read32(cpu->mem, _t58);
         /* 021C9E04 */ cpu->r[11] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x0000000Au, 0x0000000Bu);
-        /* 021C9E04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021C9E08 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9E04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021C9E08 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9E08 */ _t60 = _t59 & 0x00000001u;
         /* 021C9E08 */ if (_t60) goto L_021C9FC0; else goto L_021C9E0C;
   L_021C9E0C: ; // 0x21c9e0c
         /* 021C9E0C */ _t61 = cpu->r[29] + 0x0000011Du;
         /* 021C9E0C */ cpu->r[0] = rbrew_read8(cpu->mem, _t61);
         /* 021C9E10 */ cpu->r[3] = cpu->r[29] + 0x00000124u;
-        /* 021C9E14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021C9E14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021C9E18 */ cpu->r[4] = cpu->r[6];
-        /* 021C9E1C */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9E1C */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9E1C */ _t63 = _t62 & 0x00000001u;
         /* 021C9E1C */ if (_t63) goto L_021C9E20; else goto L_021C9E84;
   L_021C9E20: ; // 0x21c9e20
         /* 021C9E20 */ Gambit_fn_02C69328(cpu);
         /* 021C9E24 */ _t64 = cpu->r[29] + 0x000000C4u;
         /* 021C9E24 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t64);
-        /* 021C9E28 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[31]);
+        /* 021C9E28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[31]));
         /* 021C9E2C */ _t65 = cpu->r[29] + 0x000000C8u;
         /* 021C9E2C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t65);
-        /* 021C9E30 */ _t66 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C9E30 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C9E30 */ _t67 = _t66 & 0x00000001u;
         /* 021C9E30 */ if (_t67) goto L_021C9E34; else goto L_021C9E44;
   L_021C9E34: ; // 0x21c9e34
-        /* 021C9E34 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[31]);
+        /* 021C9E34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[31]));
         /* 021C9E38 */ cpu->f[10] = cpu->f[0] * cpu->f[0];
-        /* 021C9E3C */ _t68 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C9E3C */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C9E3C */ _t69 = _t68 & 0x00000001u;
         /* 021C9E3C */ if (_t69) goto L_021C9E40; else goto L_021C9E60;
   L_021C9E40: ; // 0x21c9e40
         /* 021C9E40 */ goto L_021C9E50;
   L_021C9E44: ; // 0x21c9e44
-        /* 021C9E44 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[31]);
+        /* 021C9E44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[31]));
         /* 021C9E48 */ cpu->f[10] = cpu->f[31];
-        /* 021C9E4C */ _t70 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C9E4C */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C9E4C */ _t71 = _t70 & 0x00000001u;
         /* 021C9E4C */ if (_t71) goto L_021C9E50; else goto L_021C9E60;
   L_021C9E50: ; // 0x21c9e50
-        /* 021C9E50 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[10]);
+        /* 021C9E50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[10]));
         /* 021C9E54 */ cpu->f[12] = cpu->f[13] * cpu->f[13];
-        /* 021C9E58 */ _t72 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9E58 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9E58 */ _t73 = _t72 & 0x00000001u;
         /* 021C9E58 */ if (_t73) goto L_021C9E5C; else goto L_021C9E6C;
   L_021C9E5C: ; // 0x21c9e5c
         /* 021C9E5C */ goto L_021C9EA0;
   L_021C9E60: ; // 0x21c9e60
-        /* 021C9E60 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[10]);
+        /* 021C9E60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[10]));
         /* 021C9E64 */ cpu->f[12] = cpu->f[31];
-        /* 021C9E68 */ _t74 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9E68 */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9E68 */ _t75 = _t74 & 0x00000001u;
         /* 021C9E68 */ if (_t75) goto L_021C9EA0; else goto L_021C9E6C;
   L_021C9E6C: ; // 0x21c9e6c
-        /* 021C9E6C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[12]);
-        /* 021C9E70 */ _t76 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9E6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[12]));
+        /* 021C9E70 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9E70 */ _t77 = _t76 & 0x00000001u;
         /* 021C9E70 */ if (_t77) goto L_021C9E74; else goto L_021C9EF0;
   L_021C9E74: ; // 0x21c9e74
-        /* 021C9E74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x0000000Au);
+        /* 021C9E74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x0000000Au));
         /* 021C9E78 */ _t78 = cpu->r[29] + 0x000000D4u;
         /* 021C9E78 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t78);
-        /* 021C9E7C */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9E7C */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9E7C */ _t80 = _t79 & 0x00000001u;
         /* 021C9E7C */ if (_t80) goto L_021C9F34; else goto L_021C9E80;
   L_021C9E80: ; // 0x21c9e80
@@ -24769,23 +24769,23 @@ void Gambit_fn_021C9C60(CPUState* cpu) {
         /* 021C9E8C */ /* nop */
         /* 021C9E90 */ _t82 = cpu->r[29] + 0x000000C8u;
         /* 021C9E90 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t82);
-        /* 021C9E94 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[8]);
+        /* 021C9E94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[8]));
         /* 021C9E98 */ /* nop */
-        /* 021C9E9C */ _t83 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C9E9C */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C9E9C */ _t84 = _t83 & 0x00000001u;
         /* 021C9E9C */ if (_t84) goto L_021C9EB0; else goto L_021C9EA0;
   L_021C9EA0: ; // 0x21c9ea0
-        /* 021C9EA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x0000000Au);
+        /* 021C9EA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x0000000Au));
         /* 021C9EA4 */ _t85 = cpu->r[29] + 0x000000D0u;
         /* 021C9EA4 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t85);
-        /* 021C9EA8 */ _t86 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9EA8 */ _t86 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9EA8 */ _t87 = _t86 & 0x00000001u;
         /* 021C9EA8 */ if (_t87) goto L_021C9F34; else goto L_021C9EAC;
   L_021C9EAC: ; // 0x21c9eac
         /* 021C9EAC */ goto L_021C9F78;
   L_021C9EB0: ; // 0x21c9eb0
-        /* 021C9EB0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[11]);
-        /* 021C9EB4 */ _t88 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C9EB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[11]));
+        /* 021C9EB4 */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C9EB4 */ _t89 = _t88 & 0x00000001u;
         /* 021C9EB4 */ if (_t89) goto L_021C9EE0; else goto L_021C9EB8;
   L_021C9EB8: ; // 0x21c9eb8
@@ -24797,9 +24797,9 @@ void Gambit_fn_021C9C60(CPUState* cpu) {
         /* 021C9EC4 */ cpu->f[0] = cpu->f[1] - cpu->f[8];
         /* 021C9EC8 */ cpu->f[8] = cpu->f[9] - cpu->f[10];
         /* 021C9ECC */ cpu->f[11] = cpu->f[0] / cpu->f[13];
-        /* 021C9ED0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x0000000Au);
+        /* 021C9ED0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x0000000Au));
         /* 021C9ED4 */ cpu->f[30] = fma(cpu->f[8], cpu->f[11], cpu->f[10]);
-        /* 021C9ED8 */ _t92 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9ED8 */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9ED8 */ _t93 = _t92 & 0x00000001u;
         /* 021C9ED8 */ if (_t93) goto L_021C9F34; else goto L_021C9EDC;
   L_021C9EDC: ; // 0x21c9edc
@@ -24808,15 +24808,15 @@ void Gambit_fn_021C9C60(CPUState* cpu) {
         /* 021C9EE0 */ _t94 = cpu->r[29] + 0x000000CCu;
         /* 021C9EE0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t94);
         /* 021C9EE4 */ cpu->f[10] = cpu->f[12] - cpu->f[11];
-        /* 021C9EE8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
-        /* 021C9EEC */ _t95 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9EE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
+        /* 021C9EEC */ _t95 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9EEC */ _t96 = _t95 & 0x00000001u;
         /* 021C9EEC */ if (_t96) goto L_021C9EF0; else goto L_021C9F00;
   L_021C9EF0: ; // 0x21c9ef0
-        /* 021C9EF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x0000000Au);
+        /* 021C9EF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x0000000Au));
         /* 021C9EF4 */ _t97 = cpu->r[29] + 0x000000D8u;
         /* 021C9EF4 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t97);
-        /* 021C9EF8 */ _t98 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9EF8 */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9EF8 */ _t99 = _t98 & 0x00000001u;
         /* 021C9EF8 */ if (_t99) goto L_021C9F34; else goto L_021C9EFC;
   L_021C9EFC: ; // 0x21c9efc
@@ -24829,19 +24829,19 @@ void Gambit_fn_021C9C60(CPUState* cpu) {
         /* 021C9F0C */ _t101 = cpu->r[7] + 0xFFFFBCD4u;
         /* 021C9F0C */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t101);
         /* 021C9F10 */ cpu->f[13] = cpu->f[13] / cpu->f[10];
-        /* 021C9F14 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[12]);
+        /* 021C9F14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[12]));
         /* 021C9F18 */ _t102 = cpu->r[29] + 0x000000D8u;
         /* 021C9F18 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t102);
-        /* 021C9F1C */ _t103 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C9F1C */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C9F1C */ _t104 = _t103 & 0x00000001u;
         /* 021C9F1C */ if (_t104) goto L_021C9F20; else goto L_021C9F24;
   L_021C9F20: ; // 0x21c9f20
         /* 021C9F20 */ cpu->f[13] = cpu->f[12];
   L_021C9F24: ; // 0x21c9f24
         /* 021C9F24 */ cpu->f[0] = cpu->f[8] - cpu->f[9];
-        /* 021C9F28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x0000000Au);
+        /* 021C9F28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x0000000Au));
         /* 021C9F2C */ cpu->f[30] = fma(cpu->f[0], cpu->f[13], cpu->f[9]);
-        /* 021C9F30 */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9F30 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9F30 */ _t106 = _t105 & 0x00000001u;
         /* 021C9F30 */ if (_t106) goto L_021C9F34; else goto L_021C9F78;
   L_021C9F34: ; // 0x21c9f34
@@ -24849,8 +24849,8 @@ void Gambit_fn_021C9C60(CPUState* cpu) {
         /* 021C9F34 */ cpu->r[0] = rbrew_read32(cpu->mem, _t107);
         /* 021C9F38 */ _t108 = cpu->r[31] + 0x00000000u;
         /* 021C9F38 */ cpu->r[10] = rbrew_read32(cpu->mem, _t108);
-        /* 021C9F3C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[0]);
-        /* 021C9F40 */ _t109 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9F3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[0]));
+        /* 021C9F40 */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9F40 */ _t110 = _t109 & 0x00000001u;
         /* 021C9F40 */ if (_t110) goto L_021C9F44; else goto L_021C9FB4;
   L_021C9F44: ; // 0x21c9f44
@@ -24869,7 +24869,7 @@ void Gambit_fn_021C9C60(CPUState* cpu) {
         /* 021C9F5C */ cpu->r[31] = rbrew_read32(cpu->mem, _t116);
         /* 021C9F60 */ _t117 = cpu->r[1] + 0x00000020u;
         /* 021C9F60 */ cpu->r[30] = rbrew_read32(cpu->mem, _t117);
-        /* 021C9F64 */ _t118 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9F64 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9F64 */ _t119 = _t118 & 0x00000001u;
         /* 021C9F64 */ if (_t119) goto L_021C9F68; // else: addr-0 trap, fall-through
   L_021C9F68: ; // 0x21c9f68
@@ -24881,20 +24881,20 @@ void Gambit_fn_021C9C60(CPUState* cpu) {
   L_021C9F78: ; // 0x21c9f78
         /* 021C9F78 */ cpu->r[3] = cpu->r[30];
         /* 021C9F7C */ Gambit_fn_021BCFBC(cpu);
-        /* 021C9F80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C9F84 */ _t121 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9F80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C9F84 */ _t121 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9F84 */ _t122 = _t121 & 0x00000001u;
         /* 021C9F84 */ if (_t122) goto L_021C9FB0; else goto L_021C9F88;
   L_021C9F88: ; // 0x21c9f88
-        /* 021C9F88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x0000000Cu);
-        /* 021C9F8C */ _t123 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9F88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x0000000Cu));
+        /* 021C9F8C */ _t123 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9F8C */ _t124 = _t123 & 0x00000001u;
         /* 021C9F8C */ if (_t124) goto L_021C9F90; else goto L_021C9FA8;
   L_021C9F90: ; // 0x21c9f90
         /* 021C9F90 */ _t125 = cpu->r[29] + 0x000000ECu;
         /* 021C9F90 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t125);
-        /* 021C9F94 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
-        /* 021C9F98 */ _t126 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9F94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
+        /* 021C9F98 */ _t126 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9F98 */ _t127 = _t126 & 0x00000001u;
         /* 021C9F98 */ if (_t127) goto L_021C9FA8; else goto L_021C9F9C;
   L_021C9F9C: ; // 0x21c9f9c
@@ -24912,8 +24912,8 @@ void Gambit_fn_021C9C60(CPUState* cpu) {
   L_021C9FB4: ; // 0x21c9fb4
         /* 021C9FB4 */ _t131 = cpu->r[29] + 0x0000002Cu;
         /* 021C9FB4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t131);
-        /* 021C9FB8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[0]);
-        /* 021C9FBC */ _t132 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9FB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[0]));
+        /* 021C9FBC */ _t132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9FBC */ _t133 = _t132 & 0x00000001u;
         /* 021C9FBC */ if (_t133) goto L_021C9FC0; else goto L_021C9FC4;
   L_021C9FC0: ; // 0x21c9fc0
@@ -24934,7 +24934,7 @@ void Gambit_fn_021C9C60(CPUState* cpu) {
         /* 021C9FDC */ cpu->r[31] = rbrew_read32(cpu->mem, _t139);
         /* 021C9FE0 */ _t140 = cpu->r[1] + 0x00000020u;
         /* 021C9FE0 */ cpu->r[30] = rbrew_read32(cpu->mem, _t140);
-        /* 021C9FE4 */ _t141 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9FE4 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9FE4 */ _t142 = _t141 & 0x00000001u;
         /* 021C9FE4 */ if (_t142) goto L_021C9FE8; // else: addr-0 trap, fall-through
   L_021C9FE8: ; // 0x21c9fe8
@@ -24979,9 +24979,9 @@ void Gambit_fn_021C9C64(CPUState* cpu) {
         /* 021C9C9C */ _t10 = cpu->r[29] + 0x00000120u;
         /* 021C9C9C */ cpu->r[12] = rbrew_read8(cpu->mem, _t10);
         /* 021C9CA0 */ cpu->r[31] = cpu->r[5];
-        /* 021C9CA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021C9CA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021C9CA8 */ cpu->r[30] = cpu->r[4];
-        /* 021C9CAC */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9CAC */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9CAC */ _t12 = _t11 & 0x00000001u;
         /* 021C9CAC */ if (_t12) goto L_021C9E00; else goto L_021C9CB0;
   L_021C9CB0: ; // 0x21c9cb0
@@ -24998,11 +24998,11 @@ void Gambit_fn_021C9C64(CPUState* cpu) {
         /* 021C9CC8 */ cpu->f[11] = fma(cpu->f[10], cpu->f[10], cpu->f[8]);
         /* 021C9CCC */ _t17 = cpu->r[1] + 0x0000000Cu;
         /* 021C9CCC */ rbrew_write_f32(cpu->mem, _t17, cpu->f[9]);
-        /* 021C9CD0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
+        /* 021C9CD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
         /* 021C9CD4 */ _t18 = cpu->r[1] + 0x00000008u;
         /* 021C9CD4 */ rbrew_write_f32(cpu->mem, _t18, cpu->f[12]);
         /* 021C9CD8 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
-        /* 021C9CDC */ _t19 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C9CDC */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C9CDC */ _t20 = _t19 & 0x00000001u;
         /* 021C9CDC */ if (_t20) goto L_021C9D38; else goto L_021C9CE0;
   L_021C9CE0: ; // 0x21c9ce0
@@ -25032,8 +25032,8 @@ void Gambit_fn_021C9C64(CPUState* cpu) {
         /* 021C9D24 */ cpu->f[10] = cpu->f[12] - cpu->f[10];
         /* 021C9D28 */ _t27 = cpu->r[29] + 0x00000108u;
         /* 021C9D28 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t27);
-        /* 021C9D2C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[11]);
-        /* 021C9D30 */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9D2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[11]));
+        /* 021C9D30 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9D30 */ _t29 = _t28 & 0x00000001u;
         /* 021C9D30 */ if (_t29) goto L_021C9D34; else goto L_021C9E00;
   L_021C9D34: ; // 0x21c9d34
@@ -25083,15 +25083,15 @@ void Gambit_fn_021C9C64(CPUState* cpu) {
         /* 021C9DB0 */ cpu->f[10] = cpu->f[12] - cpu->f[10];
         /* 021C9DB4 */ _t41 = cpu->r[29] + 0x00000108u;
         /* 021C9DB4 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t41);
-        /* 021C9DB8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[11]);
-        /* 021C9DBC */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9DB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[11]));
+        /* 021C9DBC */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9DBC */ _t43 = _t42 & 0x00000001u;
         /* 021C9DBC */ if (_t43) goto L_021C9DC0; else goto L_021C9E00;
   L_021C9DC0: ; // 0x21c9dc0
         /* 021C9DC0 */ _t44 = cpu->r[29] + 0x0000010Cu;
         /* 021C9DC0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t44);
-        /* 021C9DC4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[12]);
-        /* 021C9DC8 */ _t45 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9DC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[12]));
+        /* 021C9DC8 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9DC8 */ _t46 = _t45 & 0x00000001u;
         /* 021C9DC8 */ if (_t46) goto L_021C9FC0; else goto L_021C9DCC;
   L_021C9DCC: ; // 0x21c9dcc
@@ -25111,7 +25111,7 @@ void Gambit_fn_021C9C64(CPUState* cpu) {
         /* 021C9DE4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t53);
         /* 021C9DE8 */ _t54 = cpu->r[1] + 0x00000020u;
         /* 021C9DE8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t54);
-        /* 021C9DEC */ _t55 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9DEC */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9DEC */ _t56 = _t55 & 0x00000001u;
         /* 021C9DEC */ if (_t56) goto L_021C9DF0; // else: addr-0 trap, fall-through
   L_021C9DF0: ; // 0x21c9df0
@@ -25124,67 +25124,67 @@ void Gambit_fn_021C9C64(CPUState* cpu) {
         /* 021C9E00 */ _t58 = cpu->r[29] + 0x00000154u;
         /* 021C9E00 */ cpu->r[11] = rbrew_read32(cpu->mem, _t58);
         /* 021C9E04 */ cpu->r[11] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x0000000Au, 0x0000000Bu);
-        /* 021C9E04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021C9E08 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9E04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021C9E08 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9E08 */ _t60 = _t59 & 0x00000001u;
         /* 021C9E08 */ if (_t60) goto L_021C9FC0; else goto L_021C9E0C;
   L_021C9E0C: ; // 0x21c9e0c
         /* 021C9E0C */ _t61 = cpu->r[29] + 0x0000011Du;
         /* 021C9E0C */ cpu->r[0] = rbrew_read8(cpu->mem, _t61);
         /* 021C9E10 */ cpu->r[3] = cpu->r[29] + 0x00000124u;
-        /* 021C9E14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021C9E14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021C9E18 */ cpu->r[4] = cpu->r[6];
-        /* 021C9E1C */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9E1C */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9E1C */ _t63 = _t62 & 0x00000001u;
         /* 021C9E1C */ if (_t63) goto L_021C9E20; else goto L_021C9E84;
   L_021C9E20: ; // 0x21c9e20
         /* 021C9E20 */ Gambit_fn_02C69328(cpu);
         /* 021C9E24 */ _t64 = cpu->r[29] + 0x000000C4u;
         /* 021C9E24 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t64);
-        /* 021C9E28 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[31]);
+        /* 021C9E28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[31]));
         /* 021C9E2C */ _t65 = cpu->r[29] + 0x000000C8u;
         /* 021C9E2C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t65);
-        /* 021C9E30 */ _t66 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C9E30 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C9E30 */ _t67 = _t66 & 0x00000001u;
         /* 021C9E30 */ if (_t67) goto L_021C9E34; else goto L_021C9E44;
   L_021C9E34: ; // 0x21c9e34
-        /* 021C9E34 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[31]);
+        /* 021C9E34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[31]));
         /* 021C9E38 */ cpu->f[10] = cpu->f[0] * cpu->f[0];
-        /* 021C9E3C */ _t68 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C9E3C */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C9E3C */ _t69 = _t68 & 0x00000001u;
         /* 021C9E3C */ if (_t69) goto L_021C9E40; else goto L_021C9E60;
   L_021C9E40: ; // 0x21c9e40
         /* 021C9E40 */ goto L_021C9E50;
   L_021C9E44: ; // 0x21c9e44
-        /* 021C9E44 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[31]);
+        /* 021C9E44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[31]));
         /* 021C9E48 */ cpu->f[10] = cpu->f[31];
-        /* 021C9E4C */ _t70 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C9E4C */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C9E4C */ _t71 = _t70 & 0x00000001u;
         /* 021C9E4C */ if (_t71) goto L_021C9E50; else goto L_021C9E60;
   L_021C9E50: ; // 0x21c9e50
-        /* 021C9E50 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[10]);
+        /* 021C9E50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[10]));
         /* 021C9E54 */ cpu->f[12] = cpu->f[13] * cpu->f[13];
-        /* 021C9E58 */ _t72 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9E58 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9E58 */ _t73 = _t72 & 0x00000001u;
         /* 021C9E58 */ if (_t73) goto L_021C9E5C; else goto L_021C9E6C;
   L_021C9E5C: ; // 0x21c9e5c
         /* 021C9E5C */ goto L_021C9EA0;
   L_021C9E60: ; // 0x21c9e60
-        /* 021C9E60 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[10]);
+        /* 021C9E60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[10]));
         /* 021C9E64 */ cpu->f[12] = cpu->f[31];
-        /* 021C9E68 */ _t74 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9E68 */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9E68 */ _t75 = _t74 & 0x00000001u;
         /* 021C9E68 */ if (_t75) goto L_021C9EA0; else goto L_021C9E6C;
   L_021C9E6C: ; // 0x21c9e6c
-        /* 021C9E6C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[12]);
-        /* 021C9E70 */ _t76 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9E6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[12]));
+        /* 021C9E70 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9E70 */ _t77 = _t76 & 0x00000001u;
         /* 021C9E70 */ if (_t77) goto L_021C9E74; else goto L_021C9EF0;
   L_021C9E74: ; // 0x21c9e74
-        /* 021C9E74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x0000000Au);
+        /* 021C9E74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x0000000Au));
         /* 021C9E78 */ _t78 = cpu->r[29] + 0x000000D4u;
         /* 021C9E78 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t78);
-        /* 021C9E7C */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9E7C */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9E7C */ _t80 = _t79 & 0x00000001u;
         /* 021C9E7C */ if (_t80) goto L_021C9F34; else goto L_021C9E80;
   L_021C9E80: ; // 0x21c9e80
@@ -25196,23 +25196,23 @@ void Gambit_fn_021C9C64(CPUState* cpu) {
         /* 021C9E8C */ /* nop */
         /* 021C9E90 */ _t82 = cpu->r[29] + 0x000000C8u;
         /* 021C9E90 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t82);
-        /* 021C9E94 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[8]);
+        /* 021C9E94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[8]));
         /* 021C9E98 */ /* nop */
-        /* 021C9E9C */ _t83 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C9E9C */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C9E9C */ _t84 = _t83 & 0x00000001u;
         /* 021C9E9C */ if (_t84) goto L_021C9EB0; else goto L_021C9EA0;
   L_021C9EA0: ; // 0x21c9ea0
-        /* 021C9EA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x0000000Au);
+        /* 021C9EA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x0000000Au));
         /* 021C9EA4 */ _t85 = cpu->r[29] + 0x000000D0u;
         /* 021C9EA4 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t85);
-        /* 021C9EA8 */ _t86 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9EA8 */ _t86 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9EA8 */ _t87 = _t86 & 0x00000001u;
         /* 021C9EA8 */ if (_t87) goto L_021C9F34; else goto L_021C9EAC;
   L_021C9EAC: ; // 0x21c9eac
         /* 021C9EAC */ goto L_021C9F78;
   L_021C9EB0: ; // 0x21c9eb0
-        /* 021C9EB0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[11]);
-        /* 021C9EB4 */ _t88 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C9EB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[11]));
+        /* 021C9EB4 */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C9EB4 */ _t89 = _t88 & 0x00000001u;
         /* 021C9EB4 */ if (_t89) goto L_021C9EE0; else goto L_021C9EB8;
   L_021C9EB8: ; // 0x21c9eb8
@@ -25224,9 +25224,9 @@ void Gambit_fn_021C9C64(CPUState* cpu) {
         /* 021C9EC4 */ cpu->f[0] = cpu->f[1] - cpu->f[8];
         /* 021C9EC8 */ cpu->f[8] = cpu->f[9] - cpu->f[10];
         /* 021C9ECC */ cpu->f[11] = cpu->f[0] / cpu->f[13];
-        /* 021C9ED0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x0000000Au);
+        /* 021C9ED0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x0000000Au));
         /* 021C9ED4 */ cpu->f[30] = fma(cpu->f[8], cpu->f[11], cpu->f[10]);
-        /* 021C9ED8 */ _t92 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9ED8 */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9ED8 */ _t93 = _t92 & 0x00000001u;
         /* 021C9ED8 */ if (_t93) goto L_021C9F34; else goto L_021C9EDC;
   L_021C9EDC: ; // 0x21c9edc
@@ -25235,15 +25235,15 @@ void Gambit_fn_021C9C64(CPUState* cpu) {
         /* 021C9EE0 */ _t94 = cpu->r[29] + 0x000000CCu;
         /* 021C9EE0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t94);
         /* 021C9EE4 */ cpu->f[10] = cpu->f[12] - cpu->f[11];
-        /* 021C9EE8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
-        /* 021C9EEC */ _t95 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9EE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
+        /* 021C9EEC */ _t95 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9EEC */ _t96 = _t95 & 0x00000001u;
         /* 021C9EEC */ if (_t96) goto L_021C9EF0; else goto L_021C9F00;
   L_021C9EF0: ; // 0x21c9ef0
-        /* 021C9EF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x0000000Au);
+        /* 021C9EF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x0000000Au));
         /* 021C9EF4 */ _t97 = cpu->r[29] + 0x000000D8u;
         /* 021C9EF4 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t97);
-        /* 021C9EF8 */ _t98 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9EF8 */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9EF8 */ _t99 = _t98 & 0x00000001u;
         /* 021C9EF8 */ if (_t99) goto L_021C9F34; else goto L_021C9EFC;
   L_021C9EFC: ; // 0x21c9efc
@@ -25256,19 +25256,19 @@ void Gambit_fn_021C9C64(CPUState* cpu) {
         /* 021C9F0C */ _t101 = cpu->r[7] + 0xFFFFBCD4u;
         /* 021C9F0C */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t101);
         /* 021C9F10 */ cpu->f[13] = cpu->f[13] / cpu->f[10];
-        /* 021C9F14 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[12]);
+        /* 021C9F14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[12]));
         /* 021C9F18 */ _t102 = cpu->r[29] + 0x000000D8u;
         /* 021C9F18 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t102);
-        /* 021C9F1C */ _t103 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C9F1C */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C9F1C */ _t104 = _t103 & 0x00000001u;
         /* 021C9F1C */ if (_t104) goto L_021C9F20; else goto L_021C9F24;
   L_021C9F20: ; // 0x21c9f20
         /* 021C9F20 */ cpu->f[13] = cpu->f[12];
   L_021C9F24: ; // 0x21c9f24
         /* 021C9F24 */ cpu->f[0] = cpu->f[8] - cpu->f[9];
-        /* 021C9F28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x0000000Au);
+        /* 021C9F28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x0000000Au));
         /* 021C9F2C */ cpu->f[30] = fma(cpu->f[0], cpu->f[13], cpu->f[9]);
-        /* 021C9F30 */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9F30 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9F30 */ _t106 = _t105 & 0x00000001u;
         /* 021C9F30 */ if (_t106) goto L_021C9F34; else goto L_021C9F78;
   L_021C9F34: ; // 0x21c9f34
@@ -25276,8 +25276,8 @@ void Gambit_fn_021C9C64(CPUState* cpu) {
         /* 021C9F34 */ cpu->r[0] = rbrew_read32(cpu->mem, _t107);
         /* 021C9F38 */ _t108 = cpu->r[31] + 0x00000000u;
         /* 021C9F38 */ cpu->r[10] = rbrew_read32(cpu->mem, _t108);
-        /* 021C9F3C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[0]);
-        /* 021C9F40 */ _t109 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9F3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[0]));
+        /* 021C9F40 */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9F40 */ _t110 = _t109 & 0x00000001u;
         /* 021C9F40 */ if (_t110) goto L_021C9F44; else goto L_021C9FB4;
   L_021C9F44: ; // 0x21c9f44
@@ -25296,7 +25296,7 @@ void Gambit_fn_021C9C64(CPUState* cpu) {
         /* 021C9F5C */ cpu->r[31] = rbrew_read32(cpu->mem, _t116);
         /* 021C9F60 */ _t117 = cpu->r[1] + 0x00000020u;
         /* 021C9F60 */ cpu->r[30] = rbrew_read32(cpu->mem, _t117);
-        /* 021C9F64 */ _t118 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9F64 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9F64 */ _t119 = _t118 & 0x00000001u;
         /* 021C9F64 */ if (_t119) goto L_021C9F68; // else: addr-0 trap, fall-through
   L_021C9F68: ; // 0x21c9f68
@@ -25308,20 +25308,20 @@ void Gambit_fn_021C9C64(CPUState* cpu) {
   L_021C9F78: ; // 0x21c9f78
         /* 021C9F78 */ cpu->r[3] = cpu->r[30];
         /* 021C9F7C */ Gambit_fn_021BCFBC(cpu);
-        /* 021C9F80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C9F84 */ _t121 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9F80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C9F84 */ _t121 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9F84 */ _t122 = _t121 & 0x00000001u;
         /* 021C9F84 */ if (_t122) goto L_021C9FB0; else goto L_021C9F88;
   L_021C9F88: ; // 0x21c9f88
-        /* 021C9F88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x0000000Cu);
-        /* 021C9F8C */ _t123 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9F88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x0000000Cu));
+        /* 021C9F8C */ _t123 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9F8C */ _t124 = _t123 & 0x00000001u;
         /* 021C9F8C */ if (_t124) goto L_021C9F90; else goto L_021C9FA8;
   L_021C9F90: ; // 0x21c9f90
         /* 021C9F90 */ _t125 = cpu->r[29] + 0x000000ECu;
         /* 021C9F90 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t125);
-        /* 021C9F94 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
-        /* 021C9F98 */ _t126 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9F94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
+        /* 021C9F98 */ _t126 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9F98 */ _t127 = _t126 & 0x00000001u;
         /* 021C9F98 */ if (_t127) goto L_021C9FA8; else goto L_021C9F9C;
   L_021C9F9C: ; // 0x21c9f9c
@@ -25339,8 +25339,8 @@ void Gambit_fn_021C9C64(CPUState* cpu) {
   L_021C9FB4: ; // 0x21c9fb4
         /* 021C9FB4 */ _t131 = cpu->r[29] + 0x0000002Cu;
         /* 021C9FB4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t131);
-        /* 021C9FB8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[0]);
-        /* 021C9FBC */ _t132 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C9FB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[0]));
+        /* 021C9FBC */ _t132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C9FBC */ _t133 = _t132 & 0x00000001u;
         /* 021C9FBC */ if (_t133) goto L_021C9FC0; else goto L_021C9FC4;
   L_021C9FC0: ; // 0x21c9fc0
@@ -25361,7 +25361,7 @@ void Gambit_fn_021C9C64(CPUState* cpu) {
         /* 021C9FDC */ cpu->r[31] = rbrew_read32(cpu->mem, _t139);
         /* 021C9FE0 */ _t140 = cpu->r[1] + 0x00000020u;
         /* 021C9FE0 */ cpu->r[30] = rbrew_read32(cpu->mem, _t140);
-        /* 021C9FE4 */ _t141 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C9FE4 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C9FE4 */ _t142 = _t141 & 0x00000001u;
         /* 021C9FE4 */ if (_t142) goto L_021C9FE8; // else: addr-0 trap, fall-through
   L_021C9FE8: ; // 0x21c9fe8
@@ -25420,9 +25420,9 @@ void Gambit_fn_021C9FF8(CPUState* cpu) {
         /* 021CA054 */ _t15 = cpu->r[30] + 0x00000154u;
         /* 021CA054 */ cpu->r[0] = rbrew_read32(cpu->mem, _t15);
         /* 021CA058 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000000Au, 0x0000000Bu);
-        /* 021CA058 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021CA058 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021CA05C */ cpu->r[31] = cpu->r[4];
-        /* 021CA060 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CA060 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CA060 */ _t17 = _t16 & 0x00000001u;
         /* 021CA060 */ if (_t17) goto L_021CA2F8; else goto L_021CA064;
   L_021CA064: ; // 0x21ca064
@@ -25502,10 +25502,10 @@ void Gambit_fn_021C9FF8(CPUState* cpu) {
         /* 021CA124 */ cpu->f[1] = fma(cpu->f[8], cpu->f[8], cpu->f[9]);
         /* 021CA128 */ _t43 = cpu->r[8] + 0xFFFFBCE0u;
         /* 021CA128 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t43);
-        /* 021CA12C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 021CA12C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 021CA130 */ _t44 = cpu->r[1] + 0x00000014u;
         /* 021CA130 */ rbrew_write_f32(cpu->mem, _t44, cpu->f[8]);
-        /* 021CA134 */ _t45 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CA134 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CA134 */ _t46 = _t45 & 0x00000001u;
         /* 021CA134 */ if (_t46) goto L_021CA138; else goto L_021CA168;
   L_021CA138: ; // 0x21ca138
@@ -25526,9 +25526,9 @@ void Gambit_fn_021C9FF8(CPUState* cpu) {
         /* 021CA164 */ _t50 = cpu->r[1] + 0x00000014u;
         /* 021CA164 */ rbrew_write_f32(cpu->mem, _t50, cpu->f[13]);
   L_021CA168: ; // 0x21ca168
-        /* 021CA168 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 021CA168 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 021CA16C */ cpu->r[0] = 0x00000000u;
-        /* 021CA170 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CA170 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CA170 */ _t52 = _t51 & 0x00000001u;
         /* 021CA170 */ if (_t52) goto L_021CA178; else goto L_021CA174;
   L_021CA174: ; // 0x21ca174
@@ -25536,13 +25536,13 @@ void Gambit_fn_021C9FF8(CPUState* cpu) {
   L_021CA178: ; // 0x21ca178
         /* 021CA178 */ cpu->r[9] = 0x101E0000u;
         /* 021CA17C */ cpu->r[12] = 0x101C0000u;
-        /* 021CA180 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 021CA180 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 021CA184 */ _t53 = cpu->r[9] + 0xFFFF958Cu;
         /* 021CA184 */ cpu->f[3] = rbrew_read_f32(cpu->mem, _t53);
         /* 021CA188 */ _t54 = cpu->r[12] + 0x00001EF8u;
         /* 021CA188 */ cpu->r[3] = rbrew_read32(cpu->mem, _t54);
         /* 021CA18C */ cpu->r[8] = cpu->r[0] | 0x000001FFu;
-        /* 021CA190 */ _t55 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CA190 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CA190 */ _t56 = _t55 & 0x00000001u;
         /* 021CA190 */ if (_t56) goto L_021CA1D0; else goto L_021CA194;
   L_021CA194: ; // 0x21ca194
@@ -25560,10 +25560,10 @@ void Gambit_fn_021C9FF8(CPUState* cpu) {
         /* 021CA1B8 */ cpu->r[10] = cpu->r[5];
         /* 021CA1BC */ Gambit_fn_0204A4DC(cpu);
         /* 021CA1C0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021CA1C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021CA1C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021CA1C4 */ _t59 = cpu->r[1] + 0x00000054u;
         /* 021CA1C4 */ rbrew_write32(cpu->mem, _t59, cpu->r[3]);
-        /* 021CA1C8 */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CA1C8 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CA1C8 */ _t61 = _t60 & 0x00000001u;
         /* 021CA1C8 */ if (_t61) goto L_021CA200; else goto L_021CA1CC;
   L_021CA1CC: ; // 0x21ca1cc
@@ -25580,18 +25580,18 @@ void Gambit_fn_021C9FF8(CPUState* cpu) {
         /* 021CA1EC */ cpu->r[6] = 0x0000000Au;
         /* 021CA1F0 */ Gambit_fn_0204A864(cpu);
         /* 021CA1F4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021CA1F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021CA1F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021CA1F8 */ _t63 = cpu->r[1] + 0x00000054u;
         /* 021CA1F8 */ rbrew_write32(cpu->mem, _t63, cpu->r[3]);
-        /* 021CA1FC */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CA1FC */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CA1FC */ _t65 = _t64 & 0x00000001u;
         /* 021CA1FC */ if (_t65) goto L_021CA200; else goto L_021CA2F8;
   L_021CA200: ; // 0x21ca200
         /* 021CA200 */ cpu->r[3] = 0x101C0000u;
         /* 021CA204 */ _t66 = cpu->r[3] + 0x00005B90u;
         /* 021CA204 */ cpu->r[3] = rbrew_read32(cpu->mem, _t66);
-        /* 021CA208 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CA20C */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CA208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CA20C */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CA20C */ _t68 = _t67 & 0x00000001u;
         /* 021CA20C */ if (_t68) goto L_021CA344; else goto L_021CA210;
   L_021CA210: ; // 0x21ca210
@@ -25654,9 +25654,9 @@ void Gambit_fn_021C9FF8(CPUState* cpu) {
         /* 021CA29C */ cpu->f[1] = fma(cpu->f[9], cpu->f[9], cpu->f[11]);
         /* 021CA2A0 */ _t90 = cpu->r[1] + 0x00000038u;
         /* 021CA2A0 */ rbrew_write_f32(cpu->mem, _t90, cpu->f[12]);
-        /* 021CA2A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 021CA2A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 021CA2A8 */ /* nop */
-        /* 021CA2AC */ _t91 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CA2AC */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CA2AC */ _t92 = _t91 & 0x00000001u;
         /* 021CA2AC */ if (_t92) goto L_021CA2B0; else goto L_021CA2E0;
   L_021CA2B0: ; // 0x21ca2b0
@@ -25681,8 +25681,8 @@ void Gambit_fn_021C9FF8(CPUState* cpu) {
         /* 021CA2E4 */ cpu->r[5] = cpu->r[1] + 0x00000018u;
         /* 021CA2E8 */ cpu->r[4] = cpu->r[1] + 0x00000030u;
         /* 021CA2EC */ Gambit_fn_02399D90(cpu);
-        /* 021CA2F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CA2F4 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CA2F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CA2F4 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CA2F4 */ _t98 = _t97 & 0x00000001u;
         /* 021CA2F4 */ if (_t98) goto L_021CA344; else goto L_021CA2F8;
   L_021CA2F8: ; // 0x21ca2f8
@@ -25713,7 +25713,7 @@ void Gambit_fn_021C9FF8(CPUState* cpu) {
         /* 021CA328 */ _t111 = cpu->r[1] + 0x00000080u;
         /* 021CA328 */ cpu->r[30] = rbrew_read32(cpu->mem, _t111);
         /* 021CA32C */ cpu->r[3] = 0x00000001u;
-        /* 021CA330 */ _t112 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CA330 */ _t112 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CA330 */ _t113 = _t112 & 0x00000001u;
         /* 021CA330 */ if (_t113) goto L_021CA334; // else: addr-0 trap, fall-through
   L_021CA334: ; // 0x21ca334
@@ -25750,7 +25750,7 @@ void Gambit_fn_021C9FF8(CPUState* cpu) {
         /* 021CA374 */ _t127 = cpu->r[1] + 0x00000080u;
         /* 021CA374 */ cpu->r[30] = rbrew_read32(cpu->mem, _t127);
         /* 021CA378 */ cpu->r[3] = 0x00000000u;
-        /* 021CA37C */ _t128 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CA37C */ _t128 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CA37C */ _t129 = _t128 & 0x00000001u;
         /* 021CA37C */ if (_t129) goto L_021CA380; // else: addr-0 trap, fall-through
   L_021CA380: ; // 0x21ca380
@@ -25807,8 +25807,8 @@ void Gambit_fn_021CA3C4(CPUState* cpu) {
         /* 021CA3C4 */ cpu->r[1] = _t0;
         /* 021CA3C8 */ _t1 = cpu->r[3] + 0x0000011Eu;
         /* 021CA3C8 */ cpu->r[8] = rbrew_read8(cpu->mem, _t1);
-        /* 021CA3CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021CA3D0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CA3CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021CA3D0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CA3D0 */ _t3 = _t2 & 0x00000001u;
         /* 021CA3D0 */ if (_t3) goto L_021CA3F4; else goto L_021CA3D4;
   L_021CA3D4: ; // 0x21ca3d4
@@ -25828,8 +25828,8 @@ void Gambit_fn_021CA3C4(CPUState* cpu) {
   L_021CA3F4: ; // 0x21ca3f4
         /* 021CA3F4 */ _t9 = cpu->r[3] + 0x0000011Fu;
         /* 021CA3F4 */ cpu->r[7] = rbrew_read8(cpu->mem, _t9);
-        /* 021CA3F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021CA3FC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CA3F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021CA3FC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CA3FC */ _t11 = _t10 & 0x00000001u;
         /* 021CA3FC */ if (_t11) goto L_021CA420; else goto L_021CA400;
   L_021CA400: ; // 0x21ca400
@@ -25849,9 +25849,9 @@ void Gambit_fn_021CA3C4(CPUState* cpu) {
   L_021CA420: ; // 0x21ca420
         /* 021CA420 */ _t17 = cpu->r[3] + 0x00000150u;
         /* 021CA420 */ cpu->r[9] = rbrew_read32(cpu->mem, _t17);
-        /* 021CA424 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0xFFFFFFFFu);
+        /* 021CA424 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0xFFFFFFFFu));
         /* 021CA428 */ cpu->r[5] = 0x00000000u;
-        /* 021CA42C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CA42C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CA42C */ _t19 = _t18 & 0x00000001u;
         /* 021CA42C */ if (_t19) goto L_021CA430; else goto L_021CA44C;
   L_021CA430: ; // 0x21ca430
@@ -25871,10 +25871,10 @@ void Gambit_fn_021CA3C4(CPUState* cpu) {
         /* 021CA44C */ _t25 = cpu->r[3] + 0x00000154u;
         /* 021CA44C */ cpu->r[12] = rbrew_read32(cpu->mem, _t25);
         /* 021CA450 */ cpu->r[12] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 021CA450 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021CA450 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021CA454 */ _t26 = cpu->r[3] + 0x00000150u;
         /* 021CA454 */ cpu->r[0] = rbrew_read32(cpu->mem, _t26);
-        /* 021CA458 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CA458 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CA458 */ _t28 = _t27 & 0x00000001u;
         /* 021CA458 */ if (_t28) goto L_021CA49C; else goto L_021CA45C;
   L_021CA45C: ; // 0x21ca45c
@@ -25915,18 +25915,18 @@ void Gambit_fn_021CA3C4(CPUState* cpu) {
         /* 021CA4A4 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t43);
         /* 021CA4A8 */ _t44 = cpu->r[1] + 0x00000008u;
         /* 021CA4A8 */ rbrew_write32(cpu->mem, _t44, cpu->r[0]);
-        /* 021CA4AC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[8]);
+        /* 021CA4AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[8]));
         /* 021CA4B0 */ _t45 = cpu->r[3] + 0x00000064u;
         /* 021CA4B0 */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t45);
-        /* 021CA4B4 */ _t46 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CA4B4 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CA4B4 */ _t47 = _t46 & 0x00000001u;
         /* 021CA4B4 */ if (_t47) goto L_021CA4F0; else goto L_021CA4B8;
   L_021CA4B8: ; // 0x21ca4b8
         /* 021CA4B8 */ cpu->r[12] = 0x10030000u;
         /* 021CA4BC */ _t48 = cpu->r[12] + 0xFFFFBDB8u;
         /* 021CA4BC */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t48);
-        /* 021CA4C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[11]);
-        /* 021CA4C4 */ _t49 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CA4C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[11]));
+        /* 021CA4C4 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CA4C4 */ _t50 = _t49 & 0x00000001u;
         /* 021CA4C4 */ if (_t50) goto L_021CA4F0; else goto L_021CA4C8;
   L_021CA4C8: ; // 0x21ca4c8
@@ -25941,7 +25941,7 @@ void Gambit_fn_021CA3C4(CPUState* cpu) {
         /* 021CA4D8 */ _t55 = cpu->r[4] + 0x00000000u;
         /* 021CA4D8 */ rbrew_write16(cpu->mem, _t55, (uint16_t)cpu->r[7]);
         /* 021CA4DC */ cpu->r[10] = cpu->r[9] & 0x0000FEFFu;
-        /* 021CA4DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021CA4DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021CA4E0 */ _t56 = cpu->r[4] + 0x00000002u;
         /* 021CA4E0 */ rbrew_write16(cpu->mem, _t56, (uint16_t)cpu->r[10]);
         /* 021CA4E4 */ _t57 = cpu->r[4] + 0x00000003u;
@@ -25971,16 +25971,16 @@ void Gambit_fn_021CA3C4(CPUState* cpu) {
         /* 021CA524 */ cpu->f[12] = rbrew_read_f64(cpu->mem, _t63);
         /* 021CA528 */ cpu->f[0] = cpu->f[12] - cpu->f[13];
         /* 021CA52C */ cpu->f[10] = (double)(float)cpu->f[0];
-        /* 021CA530 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[11]);
-        /* 021CA534 */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CA530 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[11]));
+        /* 021CA534 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CA534 */ _t65 = _t64 & 0x00000001u;
         /* 021CA534 */ if (_t65) goto L_021CA54C; else goto L_021CA538;
   L_021CA538: ; // 0x21ca538
         /* 021CA538 */ cpu->r[6] = 0x10030000u;
         /* 021CA53C */ _t66 = cpu->r[6] + 0xFFFFBCD0u;
         /* 021CA53C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t66);
-        /* 021CA540 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[0]);
-        /* 021CA544 */ _t67 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CA540 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[0]));
+        /* 021CA544 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CA544 */ _t68 = _t67 & 0x00000001u;
         /* 021CA544 */ if (_t68) goto L_021CA54C; else goto L_021CA548;
   L_021CA548: ; // 0x21ca548
@@ -25997,7 +25997,7 @@ void Gambit_fn_021CA3C4(CPUState* cpu) {
         /* 021CA55C */ _t73 = cpu->r[4] + 0x00000000u;
         /* 021CA55C */ rbrew_write16(cpu->mem, _t73, (uint16_t)cpu->r[7]);
         /* 021CA560 */ cpu->r[12] = cpu->r[9] & 0x0000FEFFu;
-        /* 021CA560 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021CA560 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021CA564 */ cpu->r[5] = cpu->r[10] + 0xFFFFFFFFu;
         /* 021CA568 */ _t74 = cpu->r[4] + 0x00000002u;
         /* 021CA568 */ rbrew_write16(cpu->mem, _t74, (uint16_t)cpu->r[12]);
@@ -26031,10 +26031,10 @@ void Gambit_fn_021CA578(CPUState* cpu) {
         /* 021CA5A8 */ cpu->r[8] = 0x00000000u;
         /* 021CA5AC */ /* nop */
         /* 021CA5B0 */ cpu->r[27] = cpu->r[10];
-        /* 021CA5B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], cpu->r[0]);
+        /* 021CA5B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], cpu->r[0]));
         /* 021CA5B8 */ _t3 = cpu->r[1] + 0x00000043u;
         /* 021CA5B8 */ cpu->r[28] = rbrew_read8(cpu->mem, _t3);
-        /* 021CA5BC */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CA5BC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CA5BC */ _t5 = _t4 & 0x00000001u;
         /* 021CA5BC */ if (_t5) goto L_021CA5C0; else goto L_021CA628;
   L_021CA5C0: ; // 0x21ca5c0
@@ -26044,15 +26044,15 @@ void Gambit_fn_021CA578(CPUState* cpu) {
         /* 021CA5C8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t6);
         /* 021CA5CC */ cpu->r[10] = 0x00000000u;
   L_021CA5D0: ; // 0x21ca5d0
-        /* 021CA5D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000004u);
-        /* 021CA5D4 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CA5D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000004u));
+        /* 021CA5D4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CA5D4 */ _t8 = _t7 & 0x00000001u;
         /* 021CA5D4 */ if (_t8) goto L_021CA5D8; else goto L_021CA5E8;
   L_021CA5D8: ; // 0x21ca5d8
         /* 021CA5D8 */ _t9 = cpu->r[11] + cpu->r[10];
         /* 021CA5D8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t9);
-        /* 021CA5DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[30]);
-        /* 021CA5E0 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CA5DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[30]));
+        /* 021CA5E0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CA5E0 */ _t11 = _t10 & 0x00000001u;
         /* 021CA5E0 */ if (_t11) goto L_021CA5E4; else goto L_021CA618;
   L_021CA5E4: ; // 0x21ca5e4
@@ -26060,13 +26060,13 @@ void Gambit_fn_021CA578(CPUState* cpu) {
   L_021CA5E8: ; // 0x21ca5e8
         /* 021CA5E8 */ _t12 = cpu->r[11] + 0x00000000u;
         /* 021CA5E8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t12);
-        /* 021CA5EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[30]);
-        /* 021CA5F0 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CA5EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[30]));
+        /* 021CA5F0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CA5F0 */ _t14 = _t13 & 0x00000001u;
         /* 021CA5F0 */ if (_t14) goto L_021CA5F4; else goto L_021CA618;
   L_021CA5F4: ; // 0x21ca5f4
-        /* 021CA5F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021CA5F8 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CA5F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021CA5F8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CA5F8 */ _t16 = _t15 & 0x00000001u;
         /* 021CA5F8 */ if (_t16) goto L_021CA600; else goto L_021CA5FC;
   L_021CA5FC: ; // 0x21ca5fc
@@ -26082,9 +26082,9 @@ void Gambit_fn_021CA578(CPUState* cpu) {
         /* 021CA614 */ return;
   L_021CA618: ; // 0x21ca618
         /* 021CA618 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 021CA61C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], cpu->r[0]);
+        /* 021CA61C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], cpu->r[0]));
         /* 021CA620 */ cpu->r[10] = cpu->r[10] + 0x00000004u;
-        /* 021CA624 */ _t19 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CA624 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CA624 */ _t20 = _t19 & 0x00000001u;
         /* 021CA624 */ if (_t20) goto L_021CA5D0; else goto L_021CA628;
   L_021CA628: ; // 0x21ca628
@@ -26093,9 +26093,9 @@ void Gambit_fn_021CA578(CPUState* cpu) {
         /* 021CA62C */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 021CA62C */ cpu->r[12] = _t21;
         /* 021CA630 */ cpu->r[4] = 0x101D0000u;
-        /* 021CA634 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021CA634 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021CA638 */ cpu->r[4] = cpu->r[4] + 0xFFFFE310u;
-        /* 021CA63C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CA63C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CA63C */ _t23 = _t22 & 0x00000001u;
         /* 021CA63C */ if (_t23) goto L_021CA640; else goto L_021CA654;
   L_021CA640: ; // 0x21ca640
@@ -26107,8 +26107,8 @@ void Gambit_fn_021CA578(CPUState* cpu) {
         /* 021CA650 */ _t25 = cpu->r[4] + 0x00000000u;
         /* 021CA650 */ rbrew_write32(cpu->mem, _t25, cpu->r[8]);
   L_021CA654: ; // 0x21ca654
-        /* 021CA654 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021CA658 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CA654 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021CA658 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CA658 */ _t27 = _t26 & 0x00000001u;
         /* 021CA658 */ if (_t27) goto L_021CA670; else goto L_021CA65C;
   L_021CA65C: ; // 0x21ca65c
@@ -26396,17 +26396,17 @@ void Gambit_fn_021CA6B4(CPUState* cpu) {
         /* 021CA8C8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t100);
         /* 021CA8CC */ _t101 = cpu->r[11] + 0xFFFFBCE8u;
         /* 021CA8CC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t101);
-        /* 021CA8D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u);
+        /* 021CA8D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u));
         /* 021CA8D4 */ _t102 = cpu->r[31] + 0x000000ACu;
         /* 021CA8D4 */ rbrew_write32(cpu->mem, _t102, cpu->r[10]);
-        /* 021CA8D8 */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CA8D8 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CA8D8 */ _t104 = _t103 & 0x00000001u;
         /* 021CA8D8 */ if (_t104) goto L_021CA8DC; else goto L_021CA8EC;
   L_021CA8DC: ; // 0x21ca8dc
         /* 021CA8DC */ cpu->r[3] = 0x00000010u;
         /* 021CA8E0 */ Gambit_fn_02801A78(cpu);
-        /* 021CA8E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CA8E8 */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CA8E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CA8E8 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CA8E8 */ _t106 = _t105 & 0x00000001u;
         /* 021CA8E8 */ if (_t106) goto L_021CA8FC; else goto L_021CA8EC;
   L_021CA8EC: ; // 0x21ca8ec
@@ -26419,16 +26419,16 @@ void Gambit_fn_021CA6B4(CPUState* cpu) {
         /* 021CA8F8 */ _t110 = cpu->r[3] + 0x0000000Cu;
         /* 021CA8F8 */ rbrew_write_f32(cpu->mem, _t110, cpu->f[30]);
   L_021CA8FC: ; // 0x21ca8fc
-        /* 021CA8FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u);
+        /* 021CA8FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u));
         /* 021CA900 */ cpu->r[3] = cpu->r[31] + 0x000000D0u;
-        /* 021CA904 */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CA904 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CA904 */ _t112 = _t111 & 0x00000001u;
         /* 021CA904 */ if (_t112) goto L_021CA908; else goto L_021CA918;
   L_021CA908: ; // 0x21ca908
         /* 021CA908 */ cpu->r[3] = 0x00000010u;
         /* 021CA90C */ Gambit_fn_02801A78(cpu);
-        /* 021CA910 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CA914 */ _t113 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CA910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CA914 */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CA914 */ _t114 = _t113 & 0x00000001u;
         /* 021CA914 */ if (_t114) goto L_021CA928; else goto L_021CA918;
   L_021CA918: ; // 0x21ca918
@@ -26476,7 +26476,7 @@ void Gambit_fn_021CA6B4(CPUState* cpu) {
         /* 021CA96C */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t133);
         /* 021CA970 */ _t134 = cpu->r[1] + 0x00000058u;
         /* 021CA970 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t134);
-        /* 021CA974 */ _t135 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CA974 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CA974 */ _t136 = _t135 & 0x00000001u;
         /* 021CA974 */ if (_t136) goto L_021CA978; // else: addr-0 trap, fall-through
   L_021CA978: ; // 0x21ca978
@@ -26495,7 +26495,7 @@ void Gambit_fn_021CA994(CPUState* cpu) {
         /* 021CA994 */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 021CA994 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 021CA994 */ cpu->r[1] = _t0;
-        /* 021CA998 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CA998 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CA998 */ _t2 = _t1 & 0x00000001u;
         /* 021CA998 */ if (_t2) goto L_021CA99C; else goto L_021CA9A4;
   L_021CA99C: ; // 0x21ca99c
@@ -26565,8 +26565,8 @@ void Gambit_fn_021CA9D4(CPUState* cpu) {
         /* 021CA9D4 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021CA9D4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021CA9D8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021CA9D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021CA9DC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CA9D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021CA9DC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CA9DC */ _t2 = _t1 & 0x00000001u;
         /* 021CA9DC */ _t3 = _t2 ^ 0x00000001u;
         /* 021CA9DC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -26588,8 +26588,8 @@ void Gambit_fn_021CA9F0(CPUState* cpu) {
         /* 021CA9F0 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021CA9F0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021CA9F4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021CA9F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021CA9F8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CA9F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021CA9F8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CA9F8 */ _t2 = _t1 & 0x00000001u;
         /* 021CA9F8 */ _t3 = _t2 ^ 0x00000001u;
         /* 021CA9F8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -26611,8 +26611,8 @@ void Gambit_fn_021CAA0C(CPUState* cpu) {
         /* 021CAA0C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021CAA0C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021CAA10 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021CAA10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021CAA14 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CAA10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021CAA14 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CAA14 */ _t2 = _t1 & 0x00000001u;
         /* 021CAA14 */ _t3 = _t2 ^ 0x00000001u;
         /* 021CAA14 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -26655,8 +26655,8 @@ void Gambit_fn_021CAA38(CPUState* cpu) {
         /* 021CAA48 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021CAA4C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021CAA4C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021CAA50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021CAA54 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CAA50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021CAA54 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CAA54 */ _t5 = _t4 & 0x00000001u;
         /* 021CAA54 */ if (_t5) goto L_021CAA58; else goto L_021CAA74;
   L_021CAA58: ; // 0x21caa58
@@ -26695,8 +26695,8 @@ void Gambit_fn_021CAA3C(CPUState* cpu) {
         /* 021CAA48 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021CAA4C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021CAA4C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021CAA50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021CAA54 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CAA50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021CAA54 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CAA54 */ _t5 = _t4 & 0x00000001u;
         /* 021CAA54 */ if (_t5) goto L_021CAA58; else goto L_021CAA74;
   L_021CAA58: ; // 0x21caa58
@@ -26961,9 +26961,9 @@ void Gambit_fn_021CAB74(CPUState* cpu) {
         /* 021CAB78 */ _t0 = cpu->r[9] + 0xFFFFFB94u;
         /* 021CAB78 */ cpu->r[9] = rbrew_read32(cpu->mem, _t0);
         /* 021CAB7C */ cpu->r[11] = 0x101D0000u;
-        /* 021CAB80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021CAB80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021CAB84 */ cpu->r[11] = cpu->r[11] + 0xFFFFFB98u;
-        /* 021CAB88 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CAB88 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CAB88 */ _t2 = _t1 & 0x00000001u;
         /* 021CAB88 */ if (_t2) goto L_021CAB8C; else goto L_021CABA4;
   L_021CAB8C: ; // 0x21cab8c
@@ -26976,8 +26976,8 @@ void Gambit_fn_021CAB74(CPUState* cpu) {
         /* 021CABA0 */ _t4 = cpu->r[11] + 0x00000000u;
         /* 021CABA0 */ rbrew_write32(cpu->mem, _t4, cpu->r[9]);
   L_021CABA4: ; // 0x21caba4
-        /* 021CABA4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021CABA8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CABA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021CABA8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CABA8 */ _t6 = _t5 & 0x00000001u;
         /* 021CABA8 */ if (_t6) goto L_021CABAC; else goto L_021CABB4;
   L_021CABAC: ; // 0x21cabac
@@ -26987,10 +26987,10 @@ void Gambit_fn_021CAB74(CPUState* cpu) {
         /* 021CABB4 */ cpu->r[12] = 0x101D0000u;
         /* 021CABB8 */ _t7 = cpu->r[12] + 0xFFFFD9ECu;
         /* 021CABB8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 021CABBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021CABBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021CABC0 */ cpu->r[12] = 0x101D0000u;
         /* 021CABC4 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021CABC8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CABC8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CABC8 */ _t9 = _t8 & 0x00000001u;
         /* 021CABC8 */ if (_t9) goto L_021CABCC; else goto L_021CABE4;
   L_021CABCC: ; // 0x21cabcc
@@ -27003,8 +27003,8 @@ void Gambit_fn_021CAB74(CPUState* cpu) {
         /* 021CABE0 */ _t11 = cpu->r[12] + 0x00000000u;
         /* 021CABE0 */ rbrew_write32(cpu->mem, _t11, cpu->r[11]);
   L_021CABE4: ; // 0x21cabe4
-        /* 021CABE4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021CABE8 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CABE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021CABE8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CABE8 */ _t13 = _t12 & 0x00000001u;
         /* 021CABE8 */ if (_t13) goto L_021CABEC; else goto L_021CABF4;
   L_021CABEC: ; // 0x21cabec
@@ -27016,9 +27016,9 @@ void Gambit_fn_021CAB74(CPUState* cpu) {
         /* 021CABF8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 021CABF8 */ cpu->r[10] = _t14;
         /* 021CABFC */ cpu->r[11] = 0x101D0000u;
-        /* 021CAC00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021CAC00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021CAC04 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4ECu;
-        /* 021CAC08 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CAC08 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CAC08 */ _t16 = _t15 & 0x00000001u;
         /* 021CAC08 */ if (_t16) goto L_021CAC0C; else goto L_021CAC20;
   L_021CAC0C: ; // 0x21cac0c
@@ -27030,8 +27030,8 @@ void Gambit_fn_021CAB74(CPUState* cpu) {
         /* 021CAC1C */ _t18 = cpu->r[11] + 0x00000000u;
         /* 021CAC1C */ rbrew_write32(cpu->mem, _t18, cpu->r[9]);
   L_021CAC20: ; // 0x21cac20
-        /* 021CAC20 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021CAC24 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CAC20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021CAC24 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CAC24 */ _t20 = _t19 & 0x00000001u;
         /* 021CAC24 */ if (_t20) goto L_021CAC28; else goto L_021CAC30;
   L_021CAC28: ; // 0x21cac28
@@ -27043,9 +27043,9 @@ void Gambit_fn_021CAB74(CPUState* cpu) {
         /* 021CAC34 */ cpu->r[10] = rbrew_read32(cpu->mem, _t21);
         /* 021CAC34 */ cpu->r[9] = _t21;
         /* 021CAC38 */ cpu->r[12] = 0x101D0000u;
-        /* 021CAC3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021CAC3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021CAC40 */ cpu->r[12] = cpu->r[12] + 0xFFFFD4E4u;
-        /* 021CAC44 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CAC44 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CAC44 */ _t23 = _t22 & 0x00000001u;
         /* 021CAC44 */ if (_t23) goto L_021CAC48; else goto L_021CAC5C;
   L_021CAC48: ; // 0x21cac48
@@ -27133,15 +27133,15 @@ void Gambit_fn_021CACB8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021CACB8: ; // 0x21cacb8
-        /* 021CACB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CACBC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CACB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CACBC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CACBC */ _t1 = _t0 & 0x00000001u;
         /* 021CACBC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021CACBC */ goto L_021CACC0;
   L_021CACC0: ; // 0x21cacc0
         /* 021CACC0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021CACC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021CACC4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CACC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021CACC4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CACC4 */ _t3 = _t2 & 0x00000001u;
         /* 021CACC4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021CACC4 */ goto L_021CACC8;
@@ -27160,8 +27160,8 @@ void Gambit_fn_021CACB8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -27175,15 +27175,15 @@ void Gambit_fn_021CACB8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -27211,15 +27211,15 @@ void Gambit_fn_021CACCC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021CACCC: ; // 0x21caccc
-        /* 021CACCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CACD0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CACCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CACD0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CACD0 */ _t1 = _t0 & 0x00000001u;
         /* 021CACD0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021CACD0 */ goto L_021CACD4;
   L_021CACD4: ; // 0x21cacd4
         /* 021CACD4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021CACD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021CACD8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CACD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021CACD8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CACD8 */ _t3 = _t2 & 0x00000001u;
         /* 021CACD8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021CACD8 */ goto L_021CACDC;
@@ -27238,8 +27238,8 @@ void Gambit_fn_021CACCC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -27253,15 +27253,15 @@ void Gambit_fn_021CACCC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -27289,15 +27289,15 @@ void Gambit_fn_021CACE0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021CACE0: ; // 0x21cace0
-        /* 021CACE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CACE4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CACE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CACE4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CACE4 */ _t1 = _t0 & 0x00000001u;
         /* 021CACE4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021CACE4 */ goto L_021CACE8;
   L_021CACE8: ; // 0x21cace8
         /* 021CACE8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021CACE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021CACEC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CACE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021CACEC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CACEC */ _t3 = _t2 & 0x00000001u;
         /* 021CACEC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021CACEC */ goto L_021CACF0;
@@ -27316,8 +27316,8 @@ void Gambit_fn_021CACE0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -27331,15 +27331,15 @@ void Gambit_fn_021CACE0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -27492,18 +27492,18 @@ void Gambit_fn_021CAD7C(CPUState* cpu) {
         /* 021CAD80 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021CAD80 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021CAD84 */ cpu->r[31] = cpu->r[3];
-        /* 021CAD84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021CAD84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021CAD88 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021CAD88 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021CAD8C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CAD8C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CAD8C */ _t4 = _t3 & 0x00000001u;
         /* 021CAD8C */ if (_t4) goto L_021CAD90; else goto L_021CADA0;
   L_021CAD90: ; // 0x21cad90
         /* 021CAD90 */ cpu->r[3] = 0x00000244u;
         /* 021CAD94 */ Gambit_fn_02801A78(cpu);
         /* 021CAD98 */ cpu->r[31] = cpu->r[3];
-        /* 021CAD98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021CAD9C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CAD98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021CAD9C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CAD9C */ _t6 = _t5 & 0x00000001u;
         /* 021CAD9C */ if (_t6) goto L_021CADB4; else goto L_021CADA0;
   L_021CADA0: ; // 0x21cada0
@@ -27540,8 +27540,8 @@ void Gambit_fn_021CADCC(CPUState* cpu) {
         /* 021CADDC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021CADE0 */ _t3 = cpu->r[31] + 0x00000024u;
         /* 021CADE0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021CADE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021CADE8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CADE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021CADE8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CADE8 */ _t5 = _t4 & 0x00000001u;
         /* 021CADE8 */ if (_t5) goto L_021CADEC; else goto L_021CAE30;
   L_021CADEC: ; // 0x21cadec
@@ -27596,8 +27596,8 @@ void Gambit_fn_021CADD0(CPUState* cpu) {
         /* 021CADDC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021CADE0 */ _t3 = cpu->r[31] + 0x00000024u;
         /* 021CADE0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021CADE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021CADE8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CADE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021CADE8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CADE8 */ _t5 = _t4 & 0x00000001u;
         /* 021CADE8 */ if (_t5) goto L_021CADEC; else goto L_021CAE30;
   L_021CADEC: ; // 0x21cadec
@@ -27717,9 +27717,9 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CAF00 */ cpu->f[6] = cpu->f[6] + cpu->f[11];
         /* 021CAF04 */ cpu->r[4] = cpu->r[4] + 0x0000000Cu;
         /* 021CAF08 */ cpu->r[11] = cpu->r[11] + 0xFFFFFFFFu;
-        /* 021CAF08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021CAF08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021CAF0C */ cpu->f[12] = cpu->f[6];
-        /* 021CAF10 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CAF10 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CAF10 */ _t18 = _t17 & 0x00000001u;
         /* 021CAF10 */ if (_t18) goto L_021CAF1C; else goto L_021CAF14;
   L_021CAF14: ; // 0x21caf14
@@ -27758,13 +27758,13 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CAF70 */ cpu->r[6] = 0x101E0000u;
         /* 021CAF74 */ _t27 = cpu->r[11] + 0xFFFFC18Cu;
         /* 021CAF74 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t27);
-        /* 021CAF78 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 021CAF78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 021CAF7C */ _t28 = cpu->r[6] + 0xFFFF958Cu;
         /* 021CAF7C */ cpu->f[3] = rbrew_read_f32(cpu->mem, _t28);
         /* 021CAF80 */ cpu->r[12] = 0x101C0000u;
         /* 021CAF84 */ _t29 = cpu->r[12] + 0x00001EF8u;
         /* 021CAF84 */ cpu->r[3] = rbrew_read32(cpu->mem, _t29);
-        /* 021CAF88 */ _t30 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CAF88 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CAF88 */ _t31 = _t30 & 0x00000001u;
         /* 021CAF88 */ if (_t31) goto L_021CAFD0; else goto L_021CAF8C;
   L_021CAF8C: ; // 0x21caf8c
@@ -27784,10 +27784,10 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CAFB8 */ rbrew_write32(cpu->mem, _t33, cpu->r[0]);
         /* 021CAFBC */ Gambit_fn_0204A4DC(cpu);
         /* 021CAFC0 */ cpu->r[4] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021CAFC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 021CAFC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 021CAFC4 */ _t34 = cpu->r[1] + 0x00000060u;
         /* 021CAFC4 */ rbrew_write32(cpu->mem, _t34, cpu->r[3]);
-        /* 021CAFC8 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CAFC8 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CAFC8 */ _t36 = _t35 & 0x00000001u;
         /* 021CAFC8 */ if (_t36) goto L_021CB49C; else goto L_021CAFCC;
   L_021CAFCC: ; // 0x21cafcc
@@ -27807,10 +27807,10 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CAFF4 */ cpu->r[9] = cpu->r[1] + 0x00000060u;
         /* 021CAFF8 */ Gambit_fn_0204A864(cpu);
         /* 021CAFFC */ cpu->r[4] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021CAFFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 021CAFFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 021CB000 */ _t39 = cpu->r[1] + 0x00000060u;
         /* 021CB000 */ rbrew_write32(cpu->mem, _t39, cpu->r[3]);
-        /* 021CB004 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB004 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB004 */ _t41 = _t40 & 0x00000001u;
         /* 021CB004 */ if (_t41) goto L_021CB49C; else goto L_021CB008;
   L_021CB008: ; // 0x21cb008
@@ -27824,9 +27824,9 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB01C */ _t44 = cpu->r[1] + 0x00000034u;
         /* 021CB01C */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t44);
         /* 021CB020 */ cpu->r[6] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x00000004u, 0x00000004u);
-        /* 021CB020 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 021CB020 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 021CB024 */ /* nop */
-        /* 021CB028 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB028 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB028 */ _t46 = _t45 & 0x00000001u;
         /* 021CB028 */ if (_t46) goto L_021CB07C; else goto L_021CB02C;
   L_021CB02C: ; // 0x21cb02c
@@ -27854,14 +27854,14 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB05C */ rbrew_write_f32(cpu->mem, _t55, cpu->f[0]);
         /* 021CB060 */ _t56 = cpu->r[1] + 0x00000088u;
         /* 021CB060 */ cpu->r[5] = rbrew_read32(cpu->mem, _t56);
-        /* 021CB064 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[10]);
+        /* 021CB064 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[10]));
         /* 021CB068 */ _t57 = cpu->r[1] + 0x00000058u;
         /* 021CB068 */ rbrew_write32(cpu->mem, _t57, cpu->r[4]);
         /* 021CB06C */ _t58 = cpu->r[1] + 0x00000058u;
         /* 021CB06C */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t58);
         /* 021CB070 */ _t59 = cpu->r[1] + 0x0000005Cu;
         /* 021CB070 */ rbrew_write32(cpu->mem, _t59, cpu->r[5]);
-        /* 021CB074 */ _t60 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CB074 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CB074 */ _t61 = _t60 & 0x00000001u;
         /* 021CB074 */ if (_t61) goto L_021CB078; else goto L_021CB0CC;
   L_021CB078: ; // 0x21cb078
@@ -27889,14 +27889,14 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB0A8 */ rbrew_write_f32(cpu->mem, _t69, cpu->f[0]);
         /* 021CB0AC */ _t70 = cpu->r[1] + 0x00000088u;
         /* 021CB0AC */ cpu->r[5] = rbrew_read32(cpu->mem, _t70);
-        /* 021CB0B0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[10]);
+        /* 021CB0B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[10]));
         /* 021CB0B4 */ _t71 = cpu->r[1] + 0x00000058u;
         /* 021CB0B4 */ rbrew_write32(cpu->mem, _t71, cpu->r[4]);
         /* 021CB0B8 */ _t72 = cpu->r[1] + 0x00000058u;
         /* 021CB0B8 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t72);
         /* 021CB0BC */ _t73 = cpu->r[1] + 0x0000005Cu;
         /* 021CB0BC */ rbrew_write32(cpu->mem, _t73, cpu->r[5]);
-        /* 021CB0C0 */ _t74 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CB0C0 */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CB0C0 */ _t75 = _t74 & 0x00000001u;
         /* 021CB0C0 */ if (_t75) goto L_021CB0C4; else goto L_021CB0CC;
   L_021CB0C4: ; // 0x21cb0c4
@@ -27905,12 +27905,12 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB0C8 */ _t77 = cpu->r[1] + 0x00000054u;
         /* 021CB0C8 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t77);
   L_021CB0CC: ; // 0x21cb0cc
-        /* 021CB0CC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[12]);
+        /* 021CB0CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[12]));
         /* 021CB0D0 */ _t78 = cpu->r[1] + 0x0000005Cu;
         /* 021CB0D0 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t78);
         /* 021CB0D4 */ _t79 = cpu->r[29] + 0x0000013Cu;
         /* 021CB0D4 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t79);
-        /* 021CB0D8 */ _t80 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CB0D8 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CB0D8 */ _t81 = _t80 & 0x00000001u;
         /* 021CB0D8 */ if (_t81) goto L_021CB0DC; else goto L_021CB0E4;
   L_021CB0DC: ; // 0x21cb0dc
@@ -27919,10 +27919,10 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB0E0 */ _t83 = cpu->r[1] + 0x00000058u;
         /* 021CB0E0 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t83);
   L_021CB0E4: ; // 0x21cb0e4
-        /* 021CB0E4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[13]);
+        /* 021CB0E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[13]));
         /* 021CB0E8 */ _t84 = cpu->r[29] + 0x00000140u;
         /* 021CB0E8 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t84);
-        /* 021CB0EC */ _t85 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CB0EC */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CB0EC */ _t86 = _t85 & 0x00000001u;
         /* 021CB0EC */ if (_t86) goto L_021CB0F0; else goto L_021CB0F8;
   L_021CB0F0: ; // 0x21cb0f0
@@ -27931,8 +27931,8 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB0F4 */ _t88 = cpu->r[1] + 0x0000005Cu;
         /* 021CB0F4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t88);
   L_021CB0F8: ; // 0x21cb0f8
-        /* 021CB0F8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[6]);
-        /* 021CB0FC */ _t89 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CB0F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[6]));
+        /* 021CB0FC */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CB0FC */ _t90 = _t89 & 0x00000001u;
         /* 021CB0FC */ if (_t90) goto L_021CB100; else goto L_021CB104;
   L_021CB100: ; // 0x21cb100
@@ -27941,18 +27941,18 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
   L_021CB104: ; // 0x21cb104
         /* 021CB104 */ _t92 = cpu->r[29] + 0x00000144u;
         /* 021CB104 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t92);
-        /* 021CB108 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[9]);
+        /* 021CB108 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[9]));
         /* 021CB10C */ _t93 = cpu->r[29] + 0x00000148u;
         /* 021CB10C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t93);
-        /* 021CB110 */ _t94 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CB110 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CB110 */ _t95 = _t94 & 0x00000001u;
         /* 021CB110 */ if (_t95) goto L_021CB114; else goto L_021CB118;
   L_021CB114: ; // 0x21cb114
         /* 021CB114 */ _t96 = cpu->r[29] + 0x00000144u;
         /* 021CB114 */ rbrew_write_f32(cpu->mem, _t96, cpu->f[8]);
   L_021CB118: ; // 0x21cb118
-        /* 021CB118 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[11]);
-        /* 021CB11C */ _t97 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CB118 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[11]));
+        /* 021CB11C */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CB11C */ _t98 = _t97 & 0x00000001u;
         /* 021CB11C */ if (_t98) goto L_021CB120; else goto L_021CB124;
   L_021CB120: ; // 0x21cb120
@@ -27961,8 +27961,8 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
   L_021CB124: ; // 0x21cb124
         /* 021CB124 */ _t100 = cpu->r[27] + 0x00000040u;
         /* 021CB124 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t100);
-        /* 021CB128 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[13]);
-        /* 021CB12C */ _t101 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB128 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[13]));
+        /* 021CB12C */ _t101 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB12C */ _t102 = _t101 & 0x00000001u;
         /* 021CB12C */ if (_t102) goto L_021CB154; else goto L_021CB130;
   L_021CB130: ; // 0x21cb130
@@ -27971,7 +27971,7 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB134 */ _t104 = cpu->r[27] + 0x00000034u;
         /* 021CB134 */ rbrew_write_f32(cpu->mem, _t104, cpu->f[30]);
         /* 021CB138 */ cpu->r[7] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 021CB138 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021CB138 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021CB13C */ _t105 = cpu->r[27] + 0x0000003Cu;
         /* 021CB13C */ rbrew_write_f32(cpu->mem, _t105, cpu->f[30]);
         /* 021CB140 */ _t106 = cpu->r[27] + 0x00000040u;
@@ -27979,7 +27979,7 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB144 */ cpu->r[12] = cpu->r[27] + 0x00000034u;
         /* 021CB148 */ _t107 = cpu->r[27] + 0x00000038u;
         /* 021CB148 */ rbrew_write_f32(cpu->mem, _t107, cpu->f[30]);
-        /* 021CB14C */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB14C */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB14C */ _t109 = _t108 & 0x00000001u;
         /* 021CB14C */ if (_t109) goto L_021CB150; else goto L_021CB198;
   L_021CB150: ; // 0x21cb150
@@ -27988,8 +27988,8 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB154 */ _t110 = cpu->r[27] + 0x00000000u;
         /* 021CB154 */ cpu->r[0] = rbrew_read32(cpu->mem, _t110);
         /* 021CB158 */ cpu->r[8] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Bu, 0x0000001Cu);
-        /* 021CB158 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021CB15C */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021CB15C */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB15C */ _t112 = _t111 & 0x00000001u;
         /* 021CB15C */ if (_t112) goto L_021CB160; else goto L_021CB17C;
   L_021CB160: ; // 0x21cb160
@@ -27997,11 +27997,11 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB160 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t113);
         /* 021CB164 */ _t114 = cpu->r[29] + 0x00000134u;
         /* 021CB164 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t114);
-        /* 021CB168 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[13]);
+        /* 021CB168 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[13]));
         /* 021CB16C */ _t115 = cpu->r[29] + 0x00000138u;
         /* 021CB16C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t115);
         /* 021CB170 */ cpu->r[12] = cpu->r[27] + 0x00000034u;
-        /* 021CB174 */ _t116 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CB174 */ _t116 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CB174 */ _t117 = _t116 & 0x00000001u;
         /* 021CB174 */ if (_t117) goto L_021CB178; else goto L_021CB32C;
   L_021CB178: ; // 0x21cb178
@@ -28012,13 +28012,13 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB180 */ _t119 = cpu->r[27] + 0x00000038u;
         /* 021CB180 */ rbrew_write_f32(cpu->mem, _t119, cpu->f[30]);
         /* 021CB184 */ cpu->r[7] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 021CB184 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021CB184 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021CB188 */ _t120 = cpu->r[27] + 0x00000034u;
         /* 021CB188 */ rbrew_write_f32(cpu->mem, _t120, cpu->f[30]);
         /* 021CB18C */ cpu->r[12] = cpu->r[27] + 0x00000034u;
         /* 021CB190 */ _t121 = cpu->r[27] + 0x0000003Cu;
         /* 021CB190 */ rbrew_write_f32(cpu->mem, _t121, cpu->f[30]);
-        /* 021CB194 */ _t122 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB194 */ _t122 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB194 */ _t123 = _t122 & 0x00000001u;
         /* 021CB194 */ if (_t123) goto L_021CB1BC; else goto L_021CB198;
   L_021CB198: ; // 0x21cb198
@@ -28037,8 +28037,8 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB1B8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t127);
   L_021CB1BC: ; // 0x21cb1bc
         /* 021CB1BC */ cpu->r[9] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x0000001Bu, 0x0000001Bu);
-        /* 021CB1BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 021CB1C0 */ _t128 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB1BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 021CB1C0 */ _t128 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB1C0 */ _t129 = _t128 & 0x00000001u;
         /* 021CB1C0 */ if (_t129) goto L_021CB308; else goto L_021CB1C4;
   L_021CB1C4: ; // 0x21cb1c4
@@ -28046,12 +28046,12 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB1C4 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t130);
         /* 021CB1C8 */ _t131 = cpu->r[27] + 0x00000040u;
         /* 021CB1C8 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t131);
-        /* 021CB1CC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[30]);
+        /* 021CB1CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[30]));
         /* 021CB1D0 */ _t132 = cpu->r[27] + 0x0000001Cu;
         /* 021CB1D0 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t132);
         /* 021CB1D4 */ _t133 = cpu->r[27] + 0x00000028u;
         /* 021CB1D4 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t133);
-        /* 021CB1D8 */ _t134 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CB1D8 */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CB1D8 */ _t135 = _t134 & 0x00000001u;
         /* 021CB1D8 */ if (_t135) goto L_021CB1DC; else goto L_021CB200;
   L_021CB1DC: ; // 0x21cb1dc
@@ -28062,17 +28062,17 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB1E8 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t136);
         /* 021CB1EC */ _t137 = cpu->r[27] + 0x0000002Cu;
         /* 021CB1EC */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t137);
-        /* 021CB1F0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[30]);
+        /* 021CB1F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[30]));
         /* 021CB1F4 */ _t138 = cpu->r[27] + 0x00000020u;
         /* 021CB1F4 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t138);
-        /* 021CB1F8 */ _t139 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CB1F8 */ _t139 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CB1F8 */ _t140 = _t139 & 0x00000001u;
         /* 021CB1F8 */ if (_t140) goto L_021CB1FC; else goto L_021CB268;
   L_021CB1FC: ; // 0x21cb1fc
         /* 021CB1FC */ goto L_021CB244;
   L_021CB200: ; // 0x21cb200
-        /* 021CB200 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[30]);
-        /* 021CB204 */ _t141 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CB200 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[30]));
+        /* 021CB204 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CB204 */ _t142 = _t141 & 0x00000001u;
         /* 021CB204 */ if (_t142) goto L_021CB208; else goto L_021CB22C;
   L_021CB208: ; // 0x21cb208
@@ -28080,13 +28080,13 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB20C */ /* nop */
         /* 021CB210 */ _t143 = cpu->r[12] + 0x00000004u;
         /* 021CB210 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t143);
-        /* 021CB214 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[30]);
+        /* 021CB214 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[30]));
         /* 021CB218 */ _t144 = cpu->r[27] + 0x00000020u;
         /* 021CB218 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t144);
         /* 021CB21C */ cpu->f[0] = fma(cpu->f[12], cpu->f[8], cpu->f[10]);
         /* 021CB220 */ _t145 = cpu->r[27] + 0x0000002Cu;
         /* 021CB220 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t145);
-        /* 021CB224 */ _t146 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CB224 */ _t146 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CB224 */ _t147 = _t146 & 0x00000001u;
         /* 021CB224 */ if (_t147) goto L_021CB228; else goto L_021CB268;
   L_021CB228: ; // 0x21cb228
@@ -28097,10 +28097,10 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB230 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t148);
         /* 021CB234 */ _t149 = cpu->r[27] + 0x00000020u;
         /* 021CB234 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t149);
-        /* 021CB238 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[30]);
+        /* 021CB238 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[30]));
         /* 021CB23C */ _t150 = cpu->r[27] + 0x0000002Cu;
         /* 021CB23C */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t150);
-        /* 021CB240 */ _t151 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CB240 */ _t151 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CB240 */ _t152 = _t151 & 0x00000001u;
         /* 021CB240 */ if (_t152) goto L_021CB244; else goto L_021CB268;
   L_021CB244: ; // 0x21cb244
@@ -28108,20 +28108,20 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB248 */ _t153 = cpu->r[12] + 0x00000008u;
         /* 021CB248 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t153);
         /* 021CB24C */ /* nop */
-        /* 021CB250 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[30]);
+        /* 021CB250 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[30]));
         /* 021CB254 */ _t154 = cpu->r[27] + 0x00000030u;
         /* 021CB254 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t154);
         /* 021CB258 */ cpu->f[7] = fma(cpu->f[6], cpu->f[8], cpu->f[9]);
         /* 021CB25C */ _t155 = cpu->r[27] + 0x00000024u;
         /* 021CB25C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t155);
-        /* 021CB260 */ _t156 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CB260 */ _t156 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CB260 */ _t157 = _t156 & 0x00000001u;
         /* 021CB260 */ if (_t157) goto L_021CB264; else goto L_021CB2CC;
   L_021CB264: ; // 0x21cb264
         /* 021CB264 */ goto L_021CB2AC;
   L_021CB268: ; // 0x21cb268
-        /* 021CB268 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[30]);
-        /* 021CB26C */ _t158 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CB268 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[30]));
+        /* 021CB26C */ _t158 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CB26C */ _t159 = _t158 & 0x00000001u;
         /* 021CB26C */ if (_t159) goto L_021CB270; else goto L_021CB294;
   L_021CB270: ; // 0x21cb270
@@ -28129,13 +28129,13 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB274 */ _t160 = cpu->r[12] + 0x00000008u;
         /* 021CB274 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t160);
         /* 021CB278 */ /* nop */
-        /* 021CB27C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[30]);
+        /* 021CB27C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[30]));
         /* 021CB280 */ _t161 = cpu->r[27] + 0x00000030u;
         /* 021CB280 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t161);
         /* 021CB284 */ cpu->f[7] = fma(cpu->f[7], cpu->f[8], cpu->f[13]);
         /* 021CB288 */ _t162 = cpu->r[27] + 0x00000024u;
         /* 021CB288 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t162);
-        /* 021CB28C */ _t163 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CB28C */ _t163 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CB28C */ _t164 = _t163 & 0x00000001u;
         /* 021CB28C */ if (_t164) goto L_021CB290; else goto L_021CB2CC;
   L_021CB290: ; // 0x21cb290
@@ -28145,11 +28145,11 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB294 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t165);
         /* 021CB298 */ _t166 = cpu->r[27] + 0x00000024u;
         /* 021CB298 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t166);
-        /* 021CB29C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[30]);
+        /* 021CB29C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[30]));
         /* 021CB2A0 */ _t167 = cpu->r[27] + 0x00000030u;
         /* 021CB2A0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t167);
         /* 021CB2A4 */ cpu->f[7] = cpu->f[6] + cpu->f[7];
-        /* 021CB2A8 */ _t168 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CB2A8 */ _t168 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CB2A8 */ _t169 = _t168 & 0x00000001u;
         /* 021CB2A8 */ if (_t169) goto L_021CB2AC; else goto L_021CB2CC;
   L_021CB2AC: ; // 0x21cb2ac
@@ -28166,8 +28166,8 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB2C4 */ cpu->r[6] = rbrew_read32(cpu->mem, _t173);
         /* 021CB2C8 */ goto L_021CB308;
   L_021CB2CC: ; // 0x21cb2cc
-        /* 021CB2CC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[30]);
-        /* 021CB2D0 */ _t174 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CB2CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[30]));
+        /* 021CB2D0 */ _t174 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CB2D0 */ _t175 = _t174 & 0x00000001u;
         /* 021CB2D0 */ if (_t175) goto L_021CB2D4; else goto L_021CB2F4;
   L_021CB2D4: ; // 0x21cb2d4
@@ -28203,10 +28203,10 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB314 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t186);
         /* 021CB318 */ _t187 = cpu->r[29] + 0x00000138u;
         /* 021CB318 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t187);
-        /* 021CB31C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[13]);
+        /* 021CB31C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[13]));
         /* 021CB320 */ _t188 = cpu->r[1] + 0x00000034u;
         /* 021CB320 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t188);
-        /* 021CB324 */ _t189 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CB324 */ _t189 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CB324 */ _t190 = _t189 & 0x00000001u;
         /* 021CB324 */ if (_t190) goto L_021CB328; else goto L_021CB32C;
   L_021CB328: ; // 0x21cb328
@@ -28215,10 +28215,10 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
   L_021CB32C: ; // 0x21cb32c
         /* 021CB32C */ _t192 = cpu->r[12] + 0x00000004u;
         /* 021CB32C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t192);
-        /* 021CB330 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
+        /* 021CB330 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
         /* 021CB334 */ _t193 = cpu->r[29] + 0x0000013Cu;
         /* 021CB334 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t193);
-        /* 021CB338 */ _t194 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CB338 */ _t194 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CB338 */ _t195 = _t194 & 0x00000001u;
         /* 021CB338 */ if (_t195) goto L_021CB33C; else goto L_021CB340;
   L_021CB33C: ; // 0x21cb33c
@@ -28227,10 +28227,10 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
   L_021CB340: ; // 0x21cb340
         /* 021CB340 */ _t197 = cpu->r[12] + 0x00000008u;
         /* 021CB340 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t197);
-        /* 021CB344 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[6]);
+        /* 021CB344 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[6]));
         /* 021CB348 */ _t198 = cpu->r[29] + 0x00000140u;
         /* 021CB348 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t198);
-        /* 021CB34C */ _t199 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CB34C */ _t199 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CB34C */ _t200 = _t199 & 0x00000001u;
         /* 021CB34C */ if (_t200) goto L_021CB350; else goto L_021CB354;
   L_021CB350: ; // 0x21cb350
@@ -28239,10 +28239,10 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
   L_021CB354: ; // 0x21cb354
         /* 021CB354 */ _t202 = cpu->r[12] + 0x00000000u;
         /* 021CB354 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t202);
-        /* 021CB358 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[7]);
+        /* 021CB358 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[7]));
         /* 021CB35C */ _t203 = cpu->r[29] + 0x00000144u;
         /* 021CB35C */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t203);
-        /* 021CB360 */ _t204 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CB360 */ _t204 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CB360 */ _t205 = _t204 & 0x00000001u;
         /* 021CB360 */ if (_t205) goto L_021CB364; else goto L_021CB368;
   L_021CB364: ; // 0x21cb364
@@ -28251,10 +28251,10 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
   L_021CB368: ; // 0x21cb368
         /* 021CB368 */ _t207 = cpu->r[12] + 0x00000004u;
         /* 021CB368 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t207);
-        /* 021CB36C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[8]);
+        /* 021CB36C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[8]));
         /* 021CB370 */ _t208 = cpu->r[29] + 0x00000148u;
         /* 021CB370 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t208);
-        /* 021CB374 */ _t209 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CB374 */ _t209 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CB374 */ _t210 = _t209 & 0x00000001u;
         /* 021CB374 */ if (_t210) goto L_021CB378; else goto L_021CB37C;
   L_021CB378: ; // 0x21cb378
@@ -28263,8 +28263,8 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
   L_021CB37C: ; // 0x21cb37c
         /* 021CB37C */ _t212 = cpu->r[12] + 0x00000008u;
         /* 021CB37C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t212);
-        /* 021CB380 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[9]);
-        /* 021CB384 */ _t213 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CB380 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[9]));
+        /* 021CB384 */ _t213 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CB384 */ _t214 = _t213 & 0x00000001u;
         /* 021CB384 */ if (_t214) goto L_021CB388; else goto L_021CB38C;
   L_021CB388: ; // 0x21cb388
@@ -28278,8 +28278,8 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB39C */ cpu->r[5] = cpu->r[1] + 0x0000008Cu;
         /* 021CB3A0 */ cpu->r[3] = cpu->r[29];
         /* 021CB3A4 */ Gambit_fn_021C2660(cpu);
-        /* 021CB3A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CB3AC */ _t216 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB3A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CB3AC */ _t216 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB3AC */ _t217 = _t216 & 0x00000001u;
         /* 021CB3AC */ if (_t217) goto L_021CB3E8; else goto L_021CB3B0;
   L_021CB3B0: ; // 0x21cb3b0
@@ -28298,7 +28298,7 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB3CC */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t222);
         /* 021CB3D0 */ _t223 = cpu->r[1] + 0x00000128u;
         /* 021CB3D0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t223);
-        /* 021CB3D4 */ _t224 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CB3D4 */ _t224 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CB3D4 */ _t225 = _t224 & 0x00000001u;
         /* 021CB3D4 */ if (_t225) goto L_021CB3D8; // else: addr-0 trap, fall-through
   L_021CB3D8: ; // 0x21cb3d8
@@ -28311,8 +28311,8 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB3E8 */ _t227 = cpu->r[27] + 0x0000015Cu;
         /* 021CB3E8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t227);
         /* 021CB3EC */ cpu->r[6] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 021CB3EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 021CB3F0 */ _t228 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB3EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 021CB3F0 */ _t228 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB3F0 */ _t229 = _t228 & 0x00000001u;
         /* 021CB3F0 */ if (_t229) goto L_021CB414; else goto L_021CB3F4;
   L_021CB3F4: ; // 0x21cb3f4
@@ -28329,8 +28329,8 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB410 */ cpu->r[7] = rbrew_read32(cpu->mem, _t232);
   L_021CB414: ; // 0x21cb414
         /* 021CB414 */ cpu->r[11] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021CB414 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021CB418 */ _t233 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB414 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021CB418 */ _t233 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB418 */ _t234 = _t233 & 0x00000001u;
         /* 021CB418 */ if (_t234) goto L_021CB438; else goto L_021CB41C;
   L_021CB41C: ; // 0x21cb41c
@@ -28350,8 +28350,8 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB440 */ cpu->r[6] = cpu->r[7] + 0x101E0000u;
         /* 021CB444 */ _t238 = cpu->r[6] + 0xFFFF9484u;
         /* 021CB444 */ cpu->r[9] = rbrew_read32(cpu->mem, _t238);
-        /* 021CB448 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 021CB44C */ _t239 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CB448 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 021CB44C */ _t239 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CB44C */ _t240 = _t239 & 0x00000001u;
         /* 021CB44C */ if (_t240) goto L_021CB450; else goto L_021CB4B0;
   L_021CB450: ; // 0x21cb450
@@ -28374,8 +28374,8 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB484 */ cpu->r[3] = cpu->r[29];
         /* 021CB488 */ cpu->r[28] = 0x00000001u;
         /* 021CB48C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CB490 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CB494 */ _t244 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB490 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CB494 */ _t244 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB494 */ _t245 = _t244 & 0x00000001u;
         /* 021CB494 */ if (_t245) goto L_021CB5A0; else goto L_021CB498;
   L_021CB498: ; // 0x21cb498
@@ -28384,8 +28384,8 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB49C */ cpu->r[3] = cpu->r[29];
         /* 021CB4A0 */ cpu->r[4] = cpu->r[1] + 0x00000060u;
         /* 021CB4A4 */ Gambit_fn_021C3934(cpu);
-        /* 021CB4A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CB4AC */ _t246 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB4A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CB4AC */ _t246 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB4AC */ _t247 = _t246 & 0x00000001u;
         /* 021CB4AC */ if (_t247) goto L_021CB4B0; else goto L_021CB750;
   L_021CB4B0: ; // 0x21cb4b0
@@ -28396,8 +28396,8 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB4B8 */ cpu->ctr = cpu->r[0];
         /* 021CB4BC */ cpu->r[3] = cpu->r[29];
         /* 021CB4C0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CB4C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CB4C8 */ _t250 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB4C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CB4C8 */ _t250 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB4C8 */ _t251 = _t250 & 0x00000001u;
         /* 021CB4C8 */ if (_t251) goto L_021CB5A0; else goto L_021CB4CC;
   L_021CB4CC: ; // 0x21cb4cc
@@ -28424,11 +28424,11 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB4F8 */ /* nop */
         /* 021CB4FC */ cpu->f[29] = cpu->f[29] + cpu->f[8];
         /* 021CB500 */ cpu->r[10] = cpu->r[10] + 0xFFFFFFFFu;
-        /* 021CB500 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021CB500 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021CB504 */ /* nop */
         /* 021CB508 */ cpu->r[31] = cpu->r[31] + 0x0000000Cu;
         /* 021CB50C */ cpu->f[8] = cpu->f[29];
-        /* 021CB510 */ _t260 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB510 */ _t260 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB510 */ _t261 = _t260 & 0x00000001u;
         /* 021CB510 */ if (_t261) goto L_021CB51C; else goto L_021CB514;
   L_021CB514: ; // 0x21cb514
@@ -28485,23 +28485,23 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB5A8 */ cpu->r[3] = cpu->r[29];
         /* 021CB5AC */ cpu->r[4] = cpu->r[29] + 0x00000168u;
         /* 021CB5B0 */ Gambit_fn_021C2564(cpu);
-        /* 021CB5B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021CB5B8 */ _t273 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB5B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021CB5B8 */ _t273 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB5B8 */ _t274 = _t273 & 0x00000001u;
         /* 021CB5B8 */ if (_t274) goto L_021CB730; else goto L_021CB5BC;
   L_021CB5BC: ; // 0x21cb5bc
         /* 021CB5BC */ _t275 = cpu->r[1] + 0x00000050u;
         /* 021CB5BC */ cpu->r[11] = rbrew_read32(cpu->mem, _t275);
-        /* 021CB5C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021CB5C4 */ _t276 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB5C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021CB5C4 */ _t276 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB5C4 */ _t277 = _t276 & 0x00000001u;
         /* 021CB5C4 */ if (_t277) goto L_021CB6D0; else goto L_021CB5C8;
   L_021CB5C8: ; // 0x21cb5c8
         /* 021CB5C8 */ _t278 = cpu->r[11] + 0x00000000u;
         /* 021CB5C8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t278);
         /* 021CB5CC */ cpu->r[5] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021CB5CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 021CB5D0 */ _t279 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB5CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 021CB5D0 */ _t279 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB5D0 */ _t280 = _t279 & 0x00000001u;
         /* 021CB5D0 */ if (_t280) goto L_021CB678; else goto L_021CB5D4;
   L_021CB5D4: ; // 0x21cb5d4
@@ -28567,10 +28567,10 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB660 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t304);
         /* 021CB664 */ _t305 = cpu->r[1] + 0x0000003Cu;
         /* 021CB664 */ rbrew_write_f32(cpu->mem, _t305, cpu->f[10]);
-        /* 021CB668 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000002u);
+        /* 021CB668 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000002u));
         /* 021CB66C */ _t306 = cpu->r[1] + 0x00000040u;
         /* 021CB66C */ rbrew_write_f32(cpu->mem, _t306, cpu->f[7]);
-        /* 021CB670 */ _t307 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB670 */ _t307 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB670 */ _t308 = _t307 & 0x00000001u;
         /* 021CB670 */ if (_t308) goto L_021CB6FC; else goto L_021CB674;
   L_021CB674: ; // 0x21cb674
@@ -28612,10 +28612,10 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB6B8 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t325);
         /* 021CB6BC */ _t326 = cpu->r[1] + 0x0000003Cu;
         /* 021CB6BC */ rbrew_write_f32(cpu->mem, _t326, cpu->f[10]);
-        /* 021CB6C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000002u);
+        /* 021CB6C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000002u));
         /* 021CB6C4 */ _t327 = cpu->r[1] + 0x00000040u;
         /* 021CB6C4 */ rbrew_write_f32(cpu->mem, _t327, cpu->f[7]);
-        /* 021CB6C8 */ _t328 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB6C8 */ _t328 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB6C8 */ _t329 = _t328 & 0x00000001u;
         /* 021CB6C8 */ if (_t329) goto L_021CB6FC; else goto L_021CB6CC;
   L_021CB6CC: ; // 0x21cb6cc
@@ -28633,15 +28633,15 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB6E0 */ rbrew_write_f32(cpu->mem, _t334, cpu->f[0]);
         /* 021CB6E4 */ _t335 = cpu->r[1] + 0x00000038u;
         /* 021CB6E4 */ rbrew_write_f32(cpu->mem, _t335, cpu->f[12]);
-        /* 021CB6E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000002u);
+        /* 021CB6E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000002u));
         /* 021CB6EC */ _t336 = cpu->r[1] + 0x00000040u;
         /* 021CB6EC */ rbrew_write_f32(cpu->mem, _t336, cpu->f[7]);
-        /* 021CB6F0 */ _t337 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB6F0 */ _t337 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB6F0 */ _t338 = _t337 & 0x00000001u;
         /* 021CB6F0 */ if (_t338) goto L_021CB6FC; else goto L_021CB6F4;
   L_021CB6F4: ; // 0x21cb6f4
-        /* 021CB6F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000003u);
-        /* 021CB6F8 */ _t339 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB6F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000003u));
+        /* 021CB6F8 */ _t339 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB6F8 */ _t340 = _t339 & 0x00000001u;
         /* 021CB6F8 */ if (_t340) goto L_021CB6FC; else goto L_021CB730;
   L_021CB6FC: ; // 0x21cb6fc
@@ -28652,8 +28652,8 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB704 */ cpu->ctr = cpu->r[12];
         /* 021CB708 */ cpu->r[3] = cpu->r[29];
         /* 021CB70C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CB710 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CB714 */ _t343 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CB714 */ _t343 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB714 */ _t344 = _t343 & 0x00000001u;
         /* 021CB714 */ if (_t344) goto L_021CB718; else goto L_021CB730;
   L_021CB718: ; // 0x21cb718
@@ -28670,10 +28670,10 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB730 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t347);
         /* 021CB734 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
         /* 021CB738 */ /* nop */
-        /* 021CB73C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000708u);
+        /* 021CB73C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000708u));
         /* 021CB740 */ _t348 = cpu->r[29] + 0x00000240u;
         /* 021CB740 */ rbrew_write16(cpu->mem, _t348, (uint16_t)cpu->r[10]);
-        /* 021CB744 */ _t349 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CB744 */ _t349 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CB744 */ _t350 = _t349 & 0x00000001u;
         /* 021CB744 */ if (_t350) goto L_021CB748; else goto L_021CB750;
   L_021CB748: ; // 0x21cb748
@@ -28693,7 +28693,7 @@ void Gambit_fn_021CAE50(CPUState* cpu) {
         /* 021CB764 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t355);
         /* 021CB768 */ _t356 = cpu->r[1] + 0x00000128u;
         /* 021CB768 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t356);
-        /* 021CB76C */ _t357 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CB76C */ _t357 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CB76C */ _t358 = _t357 & 0x00000001u;
         /* 021CB76C */ if (_t358) goto L_021CB770; // else: addr-0 trap, fall-through
   L_021CB770: ; // 0x21cb770
@@ -28775,30 +28775,30 @@ void Gambit_fn_021CB7B4(CPUState* cpu) {
         /* 021CB7C8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 021CB7CC */ _t4 = cpu->r[31] + 0x0000002Cu;
         /* 021CB7CC */ cpu->r[10] = rbrew_read32(cpu->mem, _t4);
-        /* 021CB7D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[10]);
-        /* 021CB7D4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB7D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[10]));
+        /* 021CB7D4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB7D4 */ _t6 = _t5 & 0x00000001u;
         /* 021CB7D4 */ if (_t6) goto L_021CB834; else goto L_021CB7D8;
   L_021CB7D8: ; // 0x21cb7d8
-        /* 021CB7D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x0000000Bu);
-        /* 021CB7DC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB7D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x0000000Bu));
+        /* 021CB7DC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB7DC */ _t8 = _t7 & 0x00000001u;
         /* 021CB7DC */ if (_t8) goto L_021CB834; else goto L_021CB7E0;
   L_021CB7E0: ; // 0x21cb7e0
-        /* 021CB7E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x0000000Fu);
-        /* 021CB7E4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB7E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x0000000Fu));
+        /* 021CB7E4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB7E4 */ _t10 = _t9 & 0x00000001u;
         /* 021CB7E4 */ if (_t10) goto L_021CB834; else goto L_021CB7E8;
   L_021CB7E8: ; // 0x21cb7e8
         /* 021CB7E8 */ _t11 = cpu->r[31] + 0x0000001Cu;
         /* 021CB7E8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t11);
-        /* 021CB7EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021CB7F0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB7EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021CB7F0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB7F0 */ _t13 = _t12 & 0x00000001u;
         /* 021CB7F0 */ if (_t13) goto L_021CB7FC; else goto L_021CB7F4;
   L_021CB7F4: ; // 0x21cb7f4
-        /* 021CB7F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021CB7F8 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB7F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021CB7F8 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB7F8 */ _t15 = _t14 & 0x00000001u;
         /* 021CB7F8 */ if (_t15) goto L_021CB7FC; else goto L_021CB834;
   L_021CB7FC: ; // 0x21cb7fc
@@ -28809,8 +28809,8 @@ void Gambit_fn_021CB7B4(CPUState* cpu) {
         /* 021CB804 */ cpu->ctr = cpu->r[12];
         /* 021CB808 */ cpu->r[3] = cpu->r[31];
         /* 021CB80C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CB810 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CB814 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB810 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CB814 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB814 */ _t19 = _t18 & 0x00000001u;
         /* 021CB814 */ if (_t19) goto L_021CB818; else goto L_021CB834;
   L_021CB818: ; // 0x21cb818
@@ -28850,30 +28850,30 @@ void Gambit_fn_021CB7B8(CPUState* cpu) {
         /* 021CB7C8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 021CB7CC */ _t4 = cpu->r[31] + 0x0000002Cu;
         /* 021CB7CC */ cpu->r[10] = rbrew_read32(cpu->mem, _t4);
-        /* 021CB7D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[10]);
-        /* 021CB7D4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB7D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[10]));
+        /* 021CB7D4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB7D4 */ _t6 = _t5 & 0x00000001u;
         /* 021CB7D4 */ if (_t6) goto L_021CB834; else goto L_021CB7D8;
   L_021CB7D8: ; // 0x21cb7d8
-        /* 021CB7D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x0000000Bu);
-        /* 021CB7DC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB7D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x0000000Bu));
+        /* 021CB7DC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB7DC */ _t8 = _t7 & 0x00000001u;
         /* 021CB7DC */ if (_t8) goto L_021CB834; else goto L_021CB7E0;
   L_021CB7E0: ; // 0x21cb7e0
-        /* 021CB7E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x0000000Fu);
-        /* 021CB7E4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB7E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x0000000Fu));
+        /* 021CB7E4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB7E4 */ _t10 = _t9 & 0x00000001u;
         /* 021CB7E4 */ if (_t10) goto L_021CB834; else goto L_021CB7E8;
   L_021CB7E8: ; // 0x21cb7e8
         /* 021CB7E8 */ _t11 = cpu->r[31] + 0x0000001Cu;
         /* 021CB7E8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t11);
-        /* 021CB7EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021CB7F0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB7EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021CB7F0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB7F0 */ _t13 = _t12 & 0x00000001u;
         /* 021CB7F0 */ if (_t13) goto L_021CB7FC; else goto L_021CB7F4;
   L_021CB7F4: ; // 0x21cb7f4
-        /* 021CB7F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021CB7F8 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB7F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021CB7F8 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB7F8 */ _t15 = _t14 & 0x00000001u;
         /* 021CB7F8 */ if (_t15) goto L_021CB7FC; else goto L_021CB834;
   L_021CB7FC: ; // 0x21cb7fc
@@ -28884,8 +28884,8 @@ void Gambit_fn_021CB7B8(CPUState* cpu) {
         /* 021CB804 */ cpu->ctr = cpu->r[12];
         /* 021CB808 */ cpu->r[3] = cpu->r[31];
         /* 021CB80C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CB810 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CB814 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB810 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CB814 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB814 */ _t19 = _t18 & 0x00000001u;
         /* 021CB814 */ if (_t19) goto L_021CB818; else goto L_021CB834;
   L_021CB818: ; // 0x21cb818
@@ -28936,10 +28936,10 @@ void Gambit_fn_021CB848(CPUState* cpu) {
         /* 021CB87C */ cpu->r[29] = cpu->r[30] + 0x00000084u;
         /* 021CB880 */ _t6 = cpu->r[30] + 0x00000051u;
         /* 021CB880 */ cpu->r[27] = rbrew_read8(cpu->mem, _t6);
-        /* 021CB884 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 021CB884 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 021CB888 */ _t7 = cpu->r[30] + 0x000000C8u;
         /* 021CB888 */ cpu->r[6] = rbrew_read32(cpu->mem, _t7);
-        /* 021CB88C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB88C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB88C */ _t9 = _t8 & 0x00000001u;
         /* 021CB88C */ if (_t9) goto L_021CB9F8; else goto L_021CB890;
   L_021CB890: ; // 0x21cb890
@@ -28948,8 +28948,8 @@ void Gambit_fn_021CB848(CPUState* cpu) {
         /* 021CB898 */ cpu->r[7] = cpu->r[7] + 0x00006338u;
         /* 021CB89C */ Gambit_fn_021F000C(cpu);
         /* 021CB8A0 */ cpu->r[28] = cpu->r[3];
-        /* 021CB8A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021CB8A4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB8A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021CB8A4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB8A4 */ _t11 = _t10 & 0x00000001u;
         /* 021CB8A4 */ if (_t11) goto L_021CB9F8; else goto L_021CB8A8;
   L_021CB8A8: ; // 0x21cb8a8
@@ -28988,7 +28988,7 @@ void Gambit_fn_021CB848(CPUState* cpu) {
         /* 021CB8FC */ Gambit_fn_021BFD74(cpu);
         /* 021CB900 */ _t23 = cpu->r[29] + 0x00000044u;
         /* 021CB900 */ cpu->r[7] = rbrew_read32(cpu->mem, _t23);
-        /* 021CB904 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 021CB904 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 021CB908 */ _t24 = cpu->r[30] + 0x00000064u;
         /* 021CB908 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t24);
         /* 021CB90C */ _t25 = cpu->r[30] + 0x00000054u;
@@ -29001,7 +29001,7 @@ void Gambit_fn_021CB848(CPUState* cpu) {
         /* 021CB91C */ cpu->r[3] = cpu->r[28];
         /* 021CB920 */ _t28 = cpu->r[1] + 0x00000010u;
         /* 021CB920 */ rbrew_write_f32(cpu->mem, _t28, cpu->f[1]);
-        /* 021CB924 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB924 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB924 */ _t30 = _t29 & 0x00000001u;
         /* 021CB924 */ if (_t30) goto L_021CB9F0; else goto L_021CB928;
   L_021CB928: ; // 0x21cb928
@@ -29074,9 +29074,9 @@ void Gambit_fn_021CB848(CPUState* cpu) {
         /* 021CB9BC */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021CB9C0 */ _t60 = cpu->r[30] + 0x00000008u;
         /* 021CB9C0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t60);
-        /* 021CB9C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021CB9C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021CB9C8 */ cpu->r[3] = cpu->r[31];
-        /* 021CB9CC */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CB9CC */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CB9CC */ _t62 = _t61 & 0x00000001u;
         /* 021CB9CC */ if (_t62) goto L_021CBA98; else goto L_021CB9D0;
   L_021CB9D0: ; // 0x21cb9d0
@@ -29160,9 +29160,9 @@ void Gambit_fn_021CB848(CPUState* cpu) {
         /* 021CBA84 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021CBA88 */ _t93 = cpu->r[30] + 0x00000008u;
         /* 021CBA88 */ cpu->r[31] = rbrew_read32(cpu->mem, _t93);
-        /* 021CBA8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021CBA8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021CBA90 */ cpu->r[3] = cpu->r[31];
-        /* 021CBA94 */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CBA94 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CBA94 */ _t95 = _t94 & 0x00000001u;
         /* 021CBA94 */ if (_t95) goto L_021CBA98; else goto L_021CB9D0;
   L_021CBA98: ; // 0x21cba98
@@ -29190,15 +29190,15 @@ void Gambit_fn_021CBAD0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021CBAD0: ; // 0x21cbad0
-        /* 021CBAD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CBAD4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CBAD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CBAD4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CBAD4 */ _t1 = _t0 & 0x00000001u;
         /* 021CBAD4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021CBAD4 */ goto L_021CBAD8;
   L_021CBAD8: ; // 0x21cbad8
         /* 021CBAD8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021CBAD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021CBADC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CBAD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021CBADC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CBADC */ _t3 = _t2 & 0x00000001u;
         /* 021CBADC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021CBADC */ goto L_021CBAE0;
@@ -29217,8 +29217,8 @@ void Gambit_fn_021CBAD0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -29232,15 +29232,15 @@ void Gambit_fn_021CBAD0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -29277,7 +29277,7 @@ void Gambit_fn_021CBAF4(CPUState* cpu) {
         /* 021CBAF4 */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 021CBAF4 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 021CBAF4 */ cpu->r[1] = _t0;
-        /* 021CBAF8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CBAF8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CBAF8 */ _t2 = _t1 & 0x00000001u;
         /* 021CBAF8 */ if (_t2) goto L_021CBAFC; else goto L_021CBB04;
   L_021CBAFC: ; // 0x21cbafc
@@ -29329,8 +29329,8 @@ void Gambit_fn_021CBB28(CPUState* cpu) {
         /* 021CBB28 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021CBB28 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021CBB2C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021CBB2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021CBB30 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CBB2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021CBB30 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CBB30 */ _t2 = _t1 & 0x00000001u;
         /* 021CBB30 */ _t3 = _t2 ^ 0x00000001u;
         /* 021CBB30 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -29352,8 +29352,8 @@ void Gambit_fn_021CBB44(CPUState* cpu) {
         /* 021CBB44 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021CBB44 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021CBB48 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021CBB48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021CBB4C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CBB48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021CBB4C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CBB4C */ _t2 = _t1 & 0x00000001u;
         /* 021CBB4C */ _t3 = _t2 ^ 0x00000001u;
         /* 021CBB4C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -29375,8 +29375,8 @@ void Gambit_fn_021CBB60(CPUState* cpu) {
         /* 021CBB60 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021CBB60 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021CBB64 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021CBB64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021CBB68 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CBB64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021CBB68 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CBB68 */ _t2 = _t1 & 0x00000001u;
         /* 021CBB68 */ _t3 = _t2 ^ 0x00000001u;
         /* 021CBB68 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -29419,8 +29419,8 @@ void Gambit_fn_021CBB8C(CPUState* cpu) {
         /* 021CBB9C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021CBBA0 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021CBBA0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021CBBA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021CBBA8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CBBA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021CBBA8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CBBA8 */ _t5 = _t4 & 0x00000001u;
         /* 021CBBA8 */ if (_t5) goto L_021CBBAC; else goto L_021CBBC8;
   L_021CBBAC: ; // 0x21cbbac
@@ -29459,8 +29459,8 @@ void Gambit_fn_021CBB90(CPUState* cpu) {
         /* 021CBB9C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021CBBA0 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021CBBA0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021CBBA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021CBBA8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CBBA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021CBBA8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CBBA8 */ _t5 = _t4 & 0x00000001u;
         /* 021CBBA8 */ if (_t5) goto L_021CBBAC; else goto L_021CBBC8;
   L_021CBBAC: ; // 0x21cbbac
@@ -29860,13 +29860,13 @@ void Gambit_fn_021CBD50(CPUState* cpu) {
         /* 021CBD60 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021CBD64 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021CBD64 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021CBD68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021CBD6C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CBD68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021CBD6C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CBD6C */ _t5 = _t4 & 0x00000001u;
         /* 021CBD6C */ if (_t5) goto L_021CBD78; else goto L_021CBD70;
   L_021CBD70: ; // 0x21cbd70
-        /* 021CBD70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021CBD74 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CBD70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021CBD74 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CBD74 */ _t7 = _t6 & 0x00000001u;
         /* 021CBD74 */ if (_t7) goto L_021CBD78; else goto L_021CBDB0;
   L_021CBD78: ; // 0x21cbd78
@@ -29877,8 +29877,8 @@ void Gambit_fn_021CBD50(CPUState* cpu) {
         /* 021CBD80 */ cpu->ctr = cpu->r[0];
         /* 021CBD84 */ cpu->r[3] = cpu->r[31];
         /* 021CBD88 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CBD8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CBD90 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CBD8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CBD90 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CBD90 */ _t11 = _t10 & 0x00000001u;
         /* 021CBD90 */ if (_t11) goto L_021CBD94; else goto L_021CBDB0;
   L_021CBD94: ; // 0x21cbd94
@@ -29916,13 +29916,13 @@ void Gambit_fn_021CBD54(CPUState* cpu) {
         /* 021CBD60 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021CBD64 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021CBD64 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021CBD68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021CBD6C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CBD68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021CBD6C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CBD6C */ _t5 = _t4 & 0x00000001u;
         /* 021CBD6C */ if (_t5) goto L_021CBD78; else goto L_021CBD70;
   L_021CBD70: ; // 0x21cbd70
-        /* 021CBD70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021CBD74 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CBD70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021CBD74 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CBD74 */ _t7 = _t6 & 0x00000001u;
         /* 021CBD74 */ if (_t7) goto L_021CBD78; else goto L_021CBDB0;
   L_021CBD78: ; // 0x21cbd78
@@ -29933,8 +29933,8 @@ void Gambit_fn_021CBD54(CPUState* cpu) {
         /* 021CBD80 */ cpu->ctr = cpu->r[0];
         /* 021CBD84 */ cpu->r[3] = cpu->r[31];
         /* 021CBD88 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CBD8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CBD90 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CBD8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CBD90 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CBD90 */ _t11 = _t10 & 0x00000001u;
         /* 021CBD90 */ if (_t11) goto L_021CBD94; else goto L_021CBDB0;
   L_021CBD94: ; // 0x21cbd94
@@ -29973,10 +29973,10 @@ void Gambit_fn_021CBDD0(CPUState* cpu) {
         /* 021CBDD0 */ cpu->r[10] = 0x101D0000u;
         /* 021CBDD4 */ _t0 = cpu->r[10] + 0xFFFFFB8Cu;
         /* 021CBDD4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 021CBDD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021CBDD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021CBDDC */ cpu->r[10] = 0x101D0000u;
         /* 021CBDE0 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBB0u;
-        /* 021CBDE4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CBDE4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CBDE4 */ _t2 = _t1 & 0x00000001u;
         /* 021CBDE4 */ if (_t2) goto L_021CBDE8; else goto L_021CBE00;
   L_021CBDE8: ; // 0x21cbde8
@@ -29989,8 +29989,8 @@ void Gambit_fn_021CBDD0(CPUState* cpu) {
         /* 021CBDFC */ _t4 = cpu->r[10] + 0x00000000u;
         /* 021CBDFC */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_021CBE00: ; // 0x21cbe00
-        /* 021CBE00 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021CBE04 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CBE00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021CBE04 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CBE04 */ _t6 = _t5 & 0x00000001u;
         /* 021CBE04 */ if (_t6) goto L_021CBE08; else goto L_021CBE10;
   L_021CBE08: ; // 0x21cbe08
@@ -30001,9 +30001,9 @@ void Gambit_fn_021CBDD0(CPUState* cpu) {
         /* 021CBE14 */ _t7 = cpu->r[9] + 0xFFFFE5E4u;
         /* 021CBE14 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 021CBE18 */ cpu->r[11] = 0x101D0000u;
-        /* 021CBE1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021CBE1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021CBE20 */ cpu->r[11] = cpu->r[11] + 0xFFFFFB60u;
-        /* 021CBE24 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CBE24 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CBE24 */ _t9 = _t8 & 0x00000001u;
         /* 021CBE24 */ if (_t9) goto L_021CBE28; else goto L_021CBE40;
   L_021CBE28: ; // 0x21cbe28
@@ -30016,8 +30016,8 @@ void Gambit_fn_021CBDD0(CPUState* cpu) {
         /* 021CBE3C */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021CBE3C */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021CBE40: ; // 0x21cbe40
-        /* 021CBE40 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021CBE44 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CBE40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021CBE44 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CBE44 */ _t13 = _t12 & 0x00000001u;
         /* 021CBE44 */ if (_t13) goto L_021CBE48; else goto L_021CBE50;
   L_021CBE48: ; // 0x21cbe48
@@ -30028,9 +30028,9 @@ void Gambit_fn_021CBDD0(CPUState* cpu) {
         /* 021CBE54 */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021CBE54 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 021CBE58 */ cpu->r[9] = 0x101D0000u;
-        /* 021CBE5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021CBE5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021CBE60 */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 021CBE64 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CBE64 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CBE64 */ _t16 = _t15 & 0x00000001u;
         /* 021CBE64 */ if (_t16) goto L_021CBE68; else goto L_021CBE80;
   L_021CBE68: ; // 0x21cbe68
@@ -30043,8 +30043,8 @@ void Gambit_fn_021CBDD0(CPUState* cpu) {
         /* 021CBE7C */ _t18 = cpu->r[9] + 0x00000000u;
         /* 021CBE7C */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_021CBE80: ; // 0x21cbe80
-        /* 021CBE80 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 021CBE84 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CBE80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 021CBE84 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CBE84 */ _t20 = _t19 & 0x00000001u;
         /* 021CBE84 */ if (_t20) goto L_021CBE88; else goto L_021CBE90;
   L_021CBE88: ; // 0x21cbe88
@@ -30056,9 +30056,9 @@ void Gambit_fn_021CBDD0(CPUState* cpu) {
         /* 021CBE94 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 021CBE94 */ cpu->r[9] = _t21;
         /* 021CBE98 */ cpu->r[10] = 0x101D0000u;
-        /* 021CBE9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021CBE9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021CBEA0 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021CBEA4 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CBEA4 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CBEA4 */ _t23 = _t22 & 0x00000001u;
         /* 021CBEA4 */ if (_t23) goto L_021CBEA8; else goto L_021CBEBC;
   L_021CBEA8: ; // 0x21cbea8
@@ -30070,8 +30070,8 @@ void Gambit_fn_021CBDD0(CPUState* cpu) {
         /* 021CBEB8 */ _t25 = cpu->r[10] + 0x00000000u;
         /* 021CBEB8 */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_021CBEBC: ; // 0x21cbebc
-        /* 021CBEBC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021CBEC0 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CBEBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021CBEC0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CBEC0 */ _t27 = _t26 & 0x00000001u;
         /* 021CBEC0 */ if (_t27) goto L_021CBEC4; else goto L_021CBECC;
   L_021CBEC4: ; // 0x21cbec4
@@ -30083,9 +30083,9 @@ void Gambit_fn_021CBDD0(CPUState* cpu) {
         /* 021CBED0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 021CBED0 */ cpu->r[10] = _t28;
         /* 021CBED4 */ cpu->r[11] = 0x101D0000u;
-        /* 021CBED8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021CBED8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021CBEDC */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021CBEE0 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CBEE0 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CBEE0 */ _t30 = _t29 & 0x00000001u;
         /* 021CBEE0 */ if (_t30) goto L_021CBEE4; else goto L_021CBEF8;
   L_021CBEE4: ; // 0x21cbee4
@@ -30791,24 +30791,24 @@ void Gambit_fn_021CC1F0(CPUState* cpu) {
         /* 021CC1F8 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021CC1F8 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021CC1FC */ cpu->r[31] = cpu->r[3];
-        /* 021CC1FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021CC1FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021CC200 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021CC200 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021CC204 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC204 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC204 */ _t4 = _t3 & 0x00000001u;
         /* 021CC204 */ if (_t4) goto L_021CC208; else goto L_021CC218;
   L_021CC208: ; // 0x21cc208
         /* 021CC208 */ cpu->r[3] = 0x00000028u;
         /* 021CC20C */ Gambit_fn_02801A78(cpu);
         /* 021CC210 */ cpu->r[31] = cpu->r[3];
-        /* 021CC210 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021CC214 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC210 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021CC214 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC214 */ _t6 = _t5 & 0x00000001u;
         /* 021CC214 */ if (_t6) goto L_021CC290; else goto L_021CC218;
   L_021CC218: ; // 0x21cc218
         /* 021CC218 */ cpu->r[0] = cpu->r[31] + 0x00000018u;
-        /* 021CC218 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021CC21C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC218 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021CC21C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC21C */ _t8 = _t7 & 0x00000001u;
         /* 021CC21C */ if (_t8) goto L_021CC220; else goto L_021CC228;
   L_021CC220: ; // 0x21cc220
@@ -30883,24 +30883,24 @@ void Gambit_fn_021CC1F4(CPUState* cpu) {
         /* 021CC1F8 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021CC1F8 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021CC1FC */ cpu->r[31] = cpu->r[3];
-        /* 021CC1FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021CC1FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021CC200 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021CC200 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021CC204 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC204 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC204 */ _t4 = _t3 & 0x00000001u;
         /* 021CC204 */ if (_t4) goto L_021CC208; else goto L_021CC218;
   L_021CC208: ; // 0x21cc208
         /* 021CC208 */ cpu->r[3] = 0x00000028u;
         /* 021CC20C */ Gambit_fn_02801A78(cpu);
         /* 021CC210 */ cpu->r[31] = cpu->r[3];
-        /* 021CC210 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021CC214 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC210 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021CC214 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC214 */ _t6 = _t5 & 0x00000001u;
         /* 021CC214 */ if (_t6) goto L_021CC290; else goto L_021CC218;
   L_021CC218: ; // 0x21cc218
         /* 021CC218 */ cpu->r[0] = cpu->r[31] + 0x00000018u;
-        /* 021CC218 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021CC21C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC218 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021CC21C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC21C */ _t8 = _t7 & 0x00000001u;
         /* 021CC21C */ if (_t8) goto L_021CC220; else goto L_021CC228;
   L_021CC220: ; // 0x21cc220
@@ -30975,18 +30975,18 @@ void Gambit_fn_021CC2AC(CPUState* cpu) {
         /* 021CC2B0 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021CC2B0 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021CC2B4 */ cpu->r[31] = cpu->r[3];
-        /* 021CC2B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021CC2B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021CC2B8 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021CC2B8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021CC2BC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC2BC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC2BC */ _t4 = _t3 & 0x00000001u;
         /* 021CC2BC */ if (_t4) goto L_021CC2C0; else goto L_021CC2D0;
   L_021CC2C0: ; // 0x21cc2c0
         /* 021CC2C0 */ cpu->r[3] = 0x000000F8u;
         /* 021CC2C4 */ Gambit_fn_02801A78(cpu);
         /* 021CC2C8 */ cpu->r[31] = cpu->r[3];
-        /* 021CC2C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021CC2CC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC2C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021CC2CC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC2CC */ _t6 = _t5 & 0x00000001u;
         /* 021CC2CC */ if (_t6) goto L_021CC324; else goto L_021CC2D0;
   L_021CC2D0: ; // 0x21cc2d0
@@ -30995,10 +30995,10 @@ void Gambit_fn_021CC2AC(CPUState* cpu) {
         /* 021CC2D8 */ cpu->r[12] = 0x10030000u;
         /* 021CC2DC */ cpu->r[12] = cpu->r[12] + 0xFFFFC7E4u;
         /* 021CC2E0 */ cpu->r[0] = cpu->r[31] + 0x00000084u;
-        /* 021CC2E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021CC2E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021CC2E4 */ _t7 = cpu->r[31] + 0x00000004u;
         /* 021CC2E4 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
-        /* 021CC2E8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC2E8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC2E8 */ _t9 = _t8 & 0x00000001u;
         /* 021CC2E8 */ if (_t9) goto L_021CC2EC; else goto L_021CC2F4;
   L_021CC2EC: ; // 0x21cc2ec
@@ -31006,8 +31006,8 @@ void Gambit_fn_021CC2AC(CPUState* cpu) {
         /* 021CC2F0 */ Gambit_fn_02801A78(cpu);
   L_021CC2F4: ; // 0x21cc2f4
         /* 021CC2F4 */ cpu->r[12] = cpu->r[31] + 0x000000B4u;
-        /* 021CC2F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021CC2F8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC2F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021CC2F8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC2F8 */ _t11 = _t10 & 0x00000001u;
         /* 021CC2F8 */ if (_t11) goto L_021CC2FC; else goto L_021CC304;
   L_021CC2FC: ; // 0x21cc2fc
@@ -31017,8 +31017,8 @@ void Gambit_fn_021CC2AC(CPUState* cpu) {
         /* 021CC304 */ cpu->r[3] = cpu->r[31] + 0x000000C0u;
         /* 021CC308 */ Gambit_fn_021CC1F0(cpu);
         /* 021CC30C */ cpu->r[0] = cpu->r[31] + 0x000000E8u;
-        /* 021CC30C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021CC310 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC30C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021CC310 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC310 */ _t13 = _t12 & 0x00000001u;
         /* 021CC310 */ if (_t13) goto L_021CC314; else goto L_021CC31C;
   L_021CC314: ; // 0x21cc314
@@ -31059,7 +31059,7 @@ void Gambit_fn_021CC33C(CPUState* cpu) {
         /* 021CC360 */ cpu->r[28] = cpu->r[8];
         /* 021CC364 */ _t2 = cpu->r[1] + 0x00000038u;
         /* 021CC364 */ rbrew_write_f32(cpu->mem, _t2, cpu->f[31]);
-        /* 021CC368 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021CC368 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021CC36C */ _t3 = cpu->r[1] + 0x00000044u;
         /* 021CC36C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 021CC370 */ cpu->r[29] = cpu->r[9];
@@ -31067,7 +31067,7 @@ void Gambit_fn_021CC33C(CPUState* cpu) {
         /* 021CC378 */ cpu->r[26] = cpu->r[6];
         /* 021CC37C */ _t4 = cpu->r[9] + 0xFFFFC758u;
         /* 021CC37C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t4);
-        /* 021CC380 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC380 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC380 */ _t6 = _t5 & 0x00000001u;
         /* 021CC380 */ if (_t6) goto L_021CC388; else goto L_021CC384;
   L_021CC384: ; // 0x21cc384
@@ -31079,9 +31079,9 @@ void Gambit_fn_021CC33C(CPUState* cpu) {
         /* 021CC38C */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
         /* 021CC38C */ cpu->r[12] = _t8;
         /* 021CC390 */ cpu->r[4] = 0x101D0000u;
-        /* 021CC394 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021CC394 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021CC398 */ cpu->r[4] = cpu->r[4] + 0xFFFFFBC0u;
-        /* 021CC39C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC39C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC39C */ _t10 = _t9 & 0x00000001u;
         /* 021CC39C */ if (_t10) goto L_021CC3A0; else goto L_021CC3B4;
   L_021CC3A0: ; // 0x21cc3a0
@@ -31093,8 +31093,8 @@ void Gambit_fn_021CC33C(CPUState* cpu) {
         /* 021CC3B0 */ _t12 = cpu->r[4] + 0x00000000u;
         /* 021CC3B0 */ rbrew_write32(cpu->mem, _t12, cpu->r[0]);
   L_021CC3B4: ; // 0x21cc3b4
-        /* 021CC3B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021CC3B8 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC3B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021CC3B8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC3B8 */ _t14 = _t13 & 0x00000001u;
         /* 021CC3B8 */ if (_t14) goto L_021CC458; else goto L_021CC3BC;
   L_021CC3BC: ; // 0x21cc3bc
@@ -31105,14 +31105,14 @@ void Gambit_fn_021CC33C(CPUState* cpu) {
         /* 021CC3C4 */ cpu->ctr = cpu->r[6];
         /* 021CC3C8 */ cpu->r[3] = cpu->r[31];
         /* 021CC3CC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CC3D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CC3D4 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC3D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CC3D4 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC3D4 */ _t18 = _t17 & 0x00000001u;
         /* 021CC3D4 */ if (_t18) goto L_021CC458; else goto L_021CC3D8;
   L_021CC3D8: ; // 0x21cc3d8
         /* 021CC3D8 */ cpu->r[3] = cpu->r[31];
-        /* 021CC3D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CC3DC */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC3D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CC3DC */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC3DC */ _t20 = _t19 & 0x00000001u;
         /* 021CC3DC */ if (_t20) goto L_021CC458; else goto L_021CC3E0;
   L_021CC3E0: ; // 0x21cc3e0
@@ -31151,7 +31151,7 @@ void Gambit_fn_021CC33C(CPUState* cpu) {
         /* 021CC43C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t29);
         /* 021CC440 */ _t30 = cpu->r[1] + 0x00000030u;
         /* 021CC440 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t30);
-        /* 021CC444 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CC444 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CC444 */ _t32 = _t31 & 0x00000001u;
         /* 021CC444 */ if (_t32) goto L_021CC448; // else: addr-0 trap, fall-through
   L_021CC448: ; // 0x21cc448
@@ -31166,9 +31166,9 @@ void Gambit_fn_021CC33C(CPUState* cpu) {
         /* 021CC45C */ cpu->r[12] = rbrew_read32(cpu->mem, _t34);
         /* 021CC45C */ cpu->r[8] = _t34;
         /* 021CC460 */ cpu->r[4] = 0x101D0000u;
-        /* 021CC464 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021CC464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021CC468 */ cpu->r[4] = cpu->r[4] + 0xFFFFE310u;
-        /* 021CC46C */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC46C */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC46C */ _t36 = _t35 & 0x00000001u;
         /* 021CC46C */ if (_t36) goto L_021CC470; else goto L_021CC484;
   L_021CC470: ; // 0x21cc470
@@ -31180,8 +31180,8 @@ void Gambit_fn_021CC33C(CPUState* cpu) {
         /* 021CC480 */ _t38 = cpu->r[4] + 0x00000000u;
         /* 021CC480 */ rbrew_write32(cpu->mem, _t38, cpu->r[5]);
   L_021CC484: ; // 0x21cc484
-        /* 021CC484 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021CC488 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC484 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021CC488 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC488 */ _t40 = _t39 & 0x00000001u;
         /* 021CC488 */ if (_t40) goto L_021CC4B0; else goto L_021CC48C;
   L_021CC48C: ; // 0x21cc48c
@@ -31192,13 +31192,13 @@ void Gambit_fn_021CC33C(CPUState* cpu) {
         /* 021CC494 */ cpu->ctr = cpu->r[7];
         /* 021CC498 */ cpu->r[3] = cpu->r[31];
         /* 021CC49C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CC4A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CC4A4 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC4A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CC4A4 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC4A4 */ _t44 = _t43 & 0x00000001u;
         /* 021CC4A4 */ if (_t44) goto L_021CC4B0; else goto L_021CC4A8;
   L_021CC4A8: ; // 0x21cc4a8
-        /* 021CC4A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021CC4AC */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC4A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021CC4AC */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC4AC */ _t46 = _t45 & 0x00000001u;
         /* 021CC4AC */ if (_t46) goto L_021CC4B0; else goto L_021CC4D4;
   L_021CC4B0: ; // 0x21cc4b0
@@ -31208,7 +31208,7 @@ void Gambit_fn_021CC33C(CPUState* cpu) {
         /* 021CC4B8 */ _t48 = cpu->r[1] + 0x00000030u;
         /* 021CC4B8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t48);
         /* 021CC4BC */ cpu->r[3] = 0x00000000u;
-        /* 021CC4C0 */ _t49 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CC4C0 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CC4C0 */ _t50 = _t49 & 0x00000001u;
         /* 021CC4C0 */ if (_t50) goto L_021CC4C4; // else: addr-0 trap, fall-through
   L_021CC4C4: ; // 0x21cc4c4
@@ -31232,33 +31232,33 @@ void Gambit_fn_021CC33C(CPUState* cpu) {
         /* 021CC4F0 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 021CC4F4 */ cpu->r[3] = cpu->r[25];
         /* 021CC4F8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CC4FC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
+        /* 021CC4FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
         /* 021CC500 */ /* nop */
         /* 021CC504 */ cpu->r[7] = rbrew_rlwinm(cpu->r[12], 0x00000002u, 0x0000001Fu, 0x0000001Fu);
-        /* 021CC504 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021CC508 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC504 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021CC508 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC508 */ _t57 = _t56 & 0x00000001u;
         /* 021CC508 */ if (_t57) goto L_021CC568; else goto L_021CC50C;
   L_021CC50C: ; // 0x21cc50c
-        /* 021CC50C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021CC510 */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC50C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021CC510 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC510 */ _t59 = _t58 & 0x00000001u;
         /* 021CC510 */ if (_t59) goto L_021CC55C; else goto L_021CC514;
   L_021CC514: ; // 0x21cc514
         /* 021CC514 */ _t60 = cpu->r[29] + 0x00000000u;
         /* 021CC514 */ cpu->r[0] = rbrew_read8(cpu->mem, _t60);
-        /* 021CC518 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021CC51C */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC518 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021CC51C */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC51C */ _t62 = _t61 & 0x00000001u;
         /* 021CC51C */ if (_t62) goto L_021CC55C; else goto L_021CC520;
   L_021CC520: ; // 0x21cc520
         /* 021CC520 */ _t63 = cpu->r[25] + 0x00000004u;
         /* 021CC520 */ cpu->r[5] = rbrew_read32(cpu->mem, _t63);
-        /* 021CC524 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021CC524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021CC528 */ _t64 = cpu->r[5] + 0x000002C4u;
         /* 021CC528 */ cpu->r[6] = rbrew_read32(cpu->mem, _t64);
         /* 021CC52C */ cpu->r[9] = cpu->r[5] + 0x000002C0u;
-        /* 021CC530 */ _t65 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC530 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC530 */ _t66 = _t65 & 0x00000001u;
         /* 021CC530 */ if (_t66) goto L_021CC534; else goto L_021CC538;
   L_021CC534: ; // 0x21cc534
@@ -31269,8 +31269,8 @@ void Gambit_fn_021CC33C(CPUState* cpu) {
         /* 021CC540 */ cpu->r[4] = cpu->r[30];
         /* 021CC544 */ cpu->r[3] = cpu->r[25];
         /* 021CC548 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CC54C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CC550 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC54C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CC550 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC550 */ _t68 = _t67 & 0x00000001u;
         /* 021CC550 */ if (_t68) goto L_021CC554; else goto L_021CC55C;
   L_021CC554: ; // 0x21cc554
@@ -31315,7 +31315,7 @@ void Gambit_fn_021CC33C(CPUState* cpu) {
         /* 021CC5BC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t78);
         /* 021CC5C0 */ _t79 = cpu->r[1] + 0x00000030u;
         /* 021CC5C0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t79);
-        /* 021CC5C4 */ _t80 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CC5C4 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CC5C4 */ _t81 = _t80 & 0x00000001u;
         /* 021CC5C4 */ if (_t81) goto L_021CC5C8; // else: addr-0 trap, fall-through
   L_021CC5C8: ; // 0x21cc5c8
@@ -31391,15 +31391,15 @@ void Gambit_fn_021CC5D8(CPUState* cpu) {
         /* 021CC668 */ rbrew_write_f32(cpu->mem, _t19, cpu->f[0]);
         /* 021CC66C */ _t20 = cpu->r[26] + 0x00000008u;
         /* 021CC66C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t20);
-        /* 021CC670 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
+        /* 021CC670 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
         /* 021CC674 */ _t21 = cpu->r[28] + 0x000000F0u;
         /* 021CC674 */ rbrew_write_f32(cpu->mem, _t21, cpu->f[13]);
-        /* 021CC678 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC678 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC678 */ _t23 = _t22 & 0x00000001u;
         /* 021CC678 */ if (_t23) goto L_021CC684; else goto L_021CC67C;
   L_021CC67C: ; // 0x21cc67c
-        /* 021CC67C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000003u);
-        /* 021CC680 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC67C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000003u));
+        /* 021CC680 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC680 */ _t25 = _t24 & 0x00000001u;
         /* 021CC680 */ if (_t25) goto L_021CC684; else goto L_021CC6C0;
   L_021CC684: ; // 0x21cc684
@@ -31514,15 +31514,15 @@ void Gambit_fn_021CC6F4(CPUState* cpu) {
         /* 021CC668 */ rbrew_write_f32(cpu->mem, _t19, cpu->f[0]);
         /* 021CC66C */ _t20 = cpu->r[26] + 0x00000008u;
         /* 021CC66C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t20);
-        /* 021CC670 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
+        /* 021CC670 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
         /* 021CC674 */ _t21 = cpu->r[28] + 0x000000F0u;
         /* 021CC674 */ rbrew_write_f32(cpu->mem, _t21, cpu->f[13]);
-        /* 021CC678 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC678 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC678 */ _t23 = _t22 & 0x00000001u;
         /* 021CC678 */ if (_t23) goto L_021CC684; else goto L_021CC67C;
   L_021CC67C: ; // 0x21cc67c
-        /* 021CC67C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000003u);
-        /* 021CC680 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC67C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000003u));
+        /* 021CC680 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC680 */ _t25 = _t24 & 0x00000001u;
         /* 021CC680 */ if (_t25) goto L_021CC684; else goto L_021CC6C0;
   L_021CC684: ; // 0x21cc684
@@ -31680,15 +31680,15 @@ void Gambit_fn_021CC74C(CPUState* cpu) {
         /* 021CC668 */ rbrew_write_f32(cpu->mem, _t19, cpu->f[0]);
         /* 021CC66C */ _t20 = cpu->r[26] + 0x00000008u;
         /* 021CC66C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t20);
-        /* 021CC670 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
+        /* 021CC670 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
         /* 021CC674 */ _t21 = cpu->r[28] + 0x000000F0u;
         /* 021CC674 */ rbrew_write_f32(cpu->mem, _t21, cpu->f[13]);
-        /* 021CC678 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC678 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC678 */ _t23 = _t22 & 0x00000001u;
         /* 021CC678 */ if (_t23) goto L_021CC684; else goto L_021CC67C;
   L_021CC67C: ; // 0x21cc67c
-        /* 021CC67C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000003u);
-        /* 021CC680 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC67C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000003u));
+        /* 021CC680 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC680 */ _t25 = _t24 & 0x00000001u;
         /* 021CC680 */ if (_t25) goto L_021CC684; else goto L_021CC6C0;
   L_021CC684: ; // 0x21cc684
@@ -31947,9 +31947,9 @@ void Gambit_fn_021CC844(CPUState* cpu) {
         /* 02031BE4 */ _t4 = cpu->r[4] + 0x00000000u;
         /* 02031BE4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t4);
         /* 02031BE8 */ cpu->r[31] = cpu->r[4];
-        /* 02031BEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02031BEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02031BF0 */ cpu->r[30] = cpu->r[3];
-        /* 02031BF4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02031BF4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02031BF4 */ _t6 = _t5 & 0x00000001u;
         /* 02031BF4 */ if (_t6) goto L_02031C58; else goto L_02031BF8;
   L_02031BF8: ; // 0x2031bf8
@@ -31957,8 +31957,8 @@ void Gambit_fn_021CC844(CPUState* cpu) {
         /* 02031BF8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
         /* 02031BFC */ _t8 = cpu->r[3] + 0x0000011Cu;
         /* 02031BFC */ cpu->r[11] = rbrew_read8(cpu->mem, _t8);
-        /* 02031C00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02031C04 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02031C00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02031C04 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02031C04 */ _t10 = _t9 & 0x00000001u;
         /* 02031C04 */ if (_t10) goto L_02031C58; else goto L_02031C08;
   L_02031C08: ; // 0x2031c08
@@ -32036,10 +32036,10 @@ void Gambit_fn_021CC854(CPUState* cpu) {
         /* 021CC880 */ cpu->r[10] = rbrew_read8(cpu->mem, _t7);
         /* 021CC884 */ cpu->r[4] = cpu->r[6];
         /* 021CC888 */ cpu->r[11] = 0x10030000u;
-        /* 021CC88C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021CC88C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021CC890 */ _t8 = cpu->r[11] + 0xFFFFC758u;
         /* 021CC890 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t8);
-        /* 021CC894 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC894 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC894 */ _t10 = _t9 & 0x00000001u;
         /* 021CC894 */ if (_t10) goto L_021CC968; else goto L_021CC898;
   L_021CC898: ; // 0x21cc898
@@ -32047,21 +32047,21 @@ void Gambit_fn_021CC854(CPUState* cpu) {
         /* 021CC89C */ Gambit_fn_02C69328(cpu);
         /* 021CC8A0 */ _t11 = cpu->r[30] + 0x000000C0u;
         /* 021CC8A0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t11);
-        /* 021CC8A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[31]);
-        /* 021CC8A8 */ _t12 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CC8A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[31]));
+        /* 021CC8A8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CC8A8 */ _t13 = _t12 & 0x00000001u;
         /* 021CC8A8 */ if (_t13) goto L_021CC8AC; else goto L_021CC8BC;
   L_021CC8AC: ; // 0x21cc8ac
         /* 021CC8AC */ cpu->f[0] = cpu->f[13] * cpu->f[13];
-        /* 021CC8B0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
-        /* 021CC8B4 */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CC8B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
+        /* 021CC8B4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CC8B4 */ _t15 = _t14 & 0x00000001u;
         /* 021CC8B4 */ if (_t15) goto L_021CC8C4; else goto L_021CC8B8;
   L_021CC8B8: ; // 0x21cc8b8
         /* 021CC8B8 */ goto L_021CC968;
   L_021CC8BC: ; // 0x21cc8bc
-        /* 021CC8BC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
-        /* 021CC8C0 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CC8BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
+        /* 021CC8C0 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CC8C0 */ _t17 = _t16 & 0x00000001u;
         /* 021CC8C0 */ if (_t17) goto L_021CC8C4; else goto L_021CC968;
   L_021CC8C4: ; // 0x21cc8c4
@@ -32072,8 +32072,8 @@ void Gambit_fn_021CC854(CPUState* cpu) {
         /* 021CC8CC */ cpu->ctr = cpu->r[0];
         /* 021CC8D0 */ cpu->r[3] = cpu->r[30];
         /* 021CC8D4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CC8D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CC8DC */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC8D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CC8DC */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC8DC */ _t21 = _t20 & 0x00000001u;
         /* 021CC8DC */ if (_t21) goto L_021CC950; else goto L_021CC8E0;
   L_021CC8E0: ; // 0x21cc8e0
@@ -32087,9 +32087,9 @@ void Gambit_fn_021CC854(CPUState* cpu) {
         /* 021CC8F0 */ _t24 = cpu->r[12] + 0x000002A4u;
         /* 021CC8F0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t24);
         /* 021CC8F4 */ cpu->r[4] = 0x101D0000u;
-        /* 021CC8F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021CC8F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021CC8FC */ cpu->r[4] = cpu->r[4] + 0xFFFFDD68u;
-        /* 021CC900 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC900 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC900 */ _t26 = _t25 & 0x00000001u;
         /* 021CC900 */ if (_t26) goto L_021CC904; else goto L_021CC918;
   L_021CC904: ; // 0x21cc904
@@ -32101,8 +32101,8 @@ void Gambit_fn_021CC854(CPUState* cpu) {
         /* 021CC914 */ _t28 = cpu->r[4] + 0x00000000u;
         /* 021CC914 */ rbrew_write32(cpu->mem, _t28, cpu->r[0]);
   L_021CC918: ; // 0x21cc918
-        /* 021CC918 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021CC91C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021CC91C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC91C */ _t30 = _t29 & 0x00000001u;
         /* 021CC91C */ if (_t30) goto L_021CC950; else goto L_021CC920;
   L_021CC920: ; // 0x21cc920
@@ -32113,20 +32113,20 @@ void Gambit_fn_021CC854(CPUState* cpu) {
         /* 021CC928 */ cpu->ctr = cpu->r[12];
         /* 021CC92C */ cpu->r[3] = cpu->r[31];
         /* 021CC930 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CC934 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CC938 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CC938 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC938 */ _t34 = _t33 & 0x00000001u;
         /* 021CC938 */ if (_t34) goto L_021CC950; else goto L_021CC93C;
   L_021CC93C: ; // 0x21cc93c
         /* 021CC93C */ cpu->r[3] = cpu->r[31];
-        /* 021CC93C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CC940 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC93C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CC940 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC940 */ _t36 = _t35 & 0x00000001u;
         /* 021CC940 */ if (_t36) goto L_021CC950; else goto L_021CC944;
   L_021CC944: ; // 0x21cc944
         /* 021CC944 */ Gambit_fn_026A97E8(cpu);
-        /* 021CC948 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CC94C */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC948 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CC94C */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC94C */ _t38 = _t37 & 0x00000001u;
         /* 021CC94C */ if (_t38) goto L_021CC950; else goto L_021CC8B8;
   L_021CC950: ; // 0x21cc950
@@ -32134,8 +32134,8 @@ void Gambit_fn_021CC854(CPUState* cpu) {
         /* 021CC950 */ cpu->r[0] = rbrew_read32(cpu->mem, _t39);
         /* 021CC954 */ _t40 = cpu->r[29] + 0x00000000u;
         /* 021CC954 */ cpu->r[7] = rbrew_read32(cpu->mem, _t40);
-        /* 021CC958 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[0]);
-        /* 021CC95C */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC958 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[0]));
+        /* 021CC95C */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC95C */ _t42 = _t41 & 0x00000001u;
         /* 021CC95C */ if (_t42) goto L_021CC968; else goto L_021CC960;
   L_021CC960: ; // 0x21cc960
@@ -32154,7 +32154,7 @@ void Gambit_fn_021CC854(CPUState* cpu) {
         /* 021CC978 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t47);
         /* 021CC97C */ _t48 = cpu->r[1] + 0x00000014u;
         /* 021CC97C */ cpu->r[31] = rbrew_read32(cpu->mem, _t48);
-        /* 021CC980 */ _t49 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CC980 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CC980 */ _t50 = _t49 & 0x00000001u;
         /* 021CC980 */ if (_t50) goto L_021CC984; // else: addr-0 trap, fall-through
   L_021CC984: ; // 0x21cc984
@@ -32192,10 +32192,10 @@ void Gambit_fn_021CC858(CPUState* cpu) {
         /* 021CC880 */ cpu->r[10] = rbrew_read8(cpu->mem, _t7);
         /* 021CC884 */ cpu->r[4] = cpu->r[6];
         /* 021CC888 */ cpu->r[11] = 0x10030000u;
-        /* 021CC88C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021CC88C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021CC890 */ _t8 = cpu->r[11] + 0xFFFFC758u;
         /* 021CC890 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t8);
-        /* 021CC894 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC894 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC894 */ _t10 = _t9 & 0x00000001u;
         /* 021CC894 */ if (_t10) goto L_021CC968; else goto L_021CC898;
   L_021CC898: ; // 0x21cc898
@@ -32203,21 +32203,21 @@ void Gambit_fn_021CC858(CPUState* cpu) {
         /* 021CC89C */ Gambit_fn_02C69328(cpu);
         /* 021CC8A0 */ _t11 = cpu->r[30] + 0x000000C0u;
         /* 021CC8A0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t11);
-        /* 021CC8A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[31]);
-        /* 021CC8A8 */ _t12 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CC8A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[31]));
+        /* 021CC8A8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CC8A8 */ _t13 = _t12 & 0x00000001u;
         /* 021CC8A8 */ if (_t13) goto L_021CC8AC; else goto L_021CC8BC;
   L_021CC8AC: ; // 0x21cc8ac
         /* 021CC8AC */ cpu->f[0] = cpu->f[13] * cpu->f[13];
-        /* 021CC8B0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
-        /* 021CC8B4 */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CC8B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
+        /* 021CC8B4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CC8B4 */ _t15 = _t14 & 0x00000001u;
         /* 021CC8B4 */ if (_t15) goto L_021CC8C4; else goto L_021CC8B8;
   L_021CC8B8: ; // 0x21cc8b8
         /* 021CC8B8 */ goto L_021CC968;
   L_021CC8BC: ; // 0x21cc8bc
-        /* 021CC8BC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
-        /* 021CC8C0 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CC8BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
+        /* 021CC8C0 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CC8C0 */ _t17 = _t16 & 0x00000001u;
         /* 021CC8C0 */ if (_t17) goto L_021CC8C4; else goto L_021CC968;
   L_021CC8C4: ; // 0x21cc8c4
@@ -32228,8 +32228,8 @@ void Gambit_fn_021CC858(CPUState* cpu) {
         /* 021CC8CC */ cpu->ctr = cpu->r[0];
         /* 021CC8D0 */ cpu->r[3] = cpu->r[30];
         /* 021CC8D4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CC8D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CC8DC */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC8D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CC8DC */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC8DC */ _t21 = _t20 & 0x00000001u;
         /* 021CC8DC */ if (_t21) goto L_021CC950; else goto L_021CC8E0;
   L_021CC8E0: ; // 0x21cc8e0
@@ -32243,9 +32243,9 @@ void Gambit_fn_021CC858(CPUState* cpu) {
         /* 021CC8F0 */ _t24 = cpu->r[12] + 0x000002A4u;
         /* 021CC8F0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t24);
         /* 021CC8F4 */ cpu->r[4] = 0x101D0000u;
-        /* 021CC8F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021CC8F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021CC8FC */ cpu->r[4] = cpu->r[4] + 0xFFFFDD68u;
-        /* 021CC900 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC900 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC900 */ _t26 = _t25 & 0x00000001u;
         /* 021CC900 */ if (_t26) goto L_021CC904; else goto L_021CC918;
   L_021CC904: ; // 0x21cc904
@@ -32257,8 +32257,8 @@ void Gambit_fn_021CC858(CPUState* cpu) {
         /* 021CC914 */ _t28 = cpu->r[4] + 0x00000000u;
         /* 021CC914 */ rbrew_write32(cpu->mem, _t28, cpu->r[0]);
   L_021CC918: ; // 0x21cc918
-        /* 021CC918 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021CC91C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021CC91C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC91C */ _t30 = _t29 & 0x00000001u;
         /* 021CC91C */ if (_t30) goto L_021CC950; else goto L_021CC920;
   L_021CC920: ; // 0x21cc920
@@ -32269,20 +32269,20 @@ void Gambit_fn_021CC858(CPUState* cpu) {
         /* 021CC928 */ cpu->ctr = cpu->r[12];
         /* 021CC92C */ cpu->r[3] = cpu->r[31];
         /* 021CC930 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CC934 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CC938 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CC938 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC938 */ _t34 = _t33 & 0x00000001u;
         /* 021CC938 */ if (_t34) goto L_021CC950; else goto L_021CC93C;
   L_021CC93C: ; // 0x21cc93c
         /* 021CC93C */ cpu->r[3] = cpu->r[31];
-        /* 021CC93C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CC940 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC93C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CC940 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC940 */ _t36 = _t35 & 0x00000001u;
         /* 021CC940 */ if (_t36) goto L_021CC950; else goto L_021CC944;
   L_021CC944: ; // 0x21cc944
         /* 021CC944 */ Gambit_fn_026A97E8(cpu);
-        /* 021CC948 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CC94C */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC948 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CC94C */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC94C */ _t38 = _t37 & 0x00000001u;
         /* 021CC94C */ if (_t38) goto L_021CC950; else goto L_021CC8B8;
   L_021CC950: ; // 0x21cc950
@@ -32290,8 +32290,8 @@ void Gambit_fn_021CC858(CPUState* cpu) {
         /* 021CC950 */ cpu->r[0] = rbrew_read32(cpu->mem, _t39);
         /* 021CC954 */ _t40 = cpu->r[29] + 0x00000000u;
         /* 021CC954 */ cpu->r[7] = rbrew_read32(cpu->mem, _t40);
-        /* 021CC958 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[0]);
-        /* 021CC95C */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC958 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[0]));
+        /* 021CC95C */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC95C */ _t42 = _t41 & 0x00000001u;
         /* 021CC95C */ if (_t42) goto L_021CC968; else goto L_021CC960;
   L_021CC960: ; // 0x21cc960
@@ -32310,7 +32310,7 @@ void Gambit_fn_021CC858(CPUState* cpu) {
         /* 021CC978 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t47);
         /* 021CC97C */ _t48 = cpu->r[1] + 0x00000014u;
         /* 021CC97C */ cpu->r[31] = rbrew_read32(cpu->mem, _t48);
-        /* 021CC980 */ _t49 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CC980 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CC980 */ _t50 = _t49 & 0x00000001u;
         /* 021CC980 */ if (_t50) goto L_021CC984; // else: addr-0 trap, fall-through
   L_021CC984: ; // 0x21cc984
@@ -32365,9 +32365,9 @@ void Gambit_fn_021CC994(CPUState* cpu) {
         /* 021CC9E4 */ rbrew_write32(cpu->mem, _t13, cpu->r[30]);
         /* 021CC9E8 */ _t14 = cpu->r[31] + 0x000000F4u;
         /* 021CC9E8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t14);
-        /* 021CC9EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021CC9EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021CC9F0 */ cpu->r[30] = cpu->r[4];
-        /* 021CC9F4 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CC9F4 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CC9F4 */ _t16 = _t15 & 0x00000001u;
         /* 021CC9F4 */ if (_t16) goto L_021CCCC4; else goto L_021CC9F8;
   L_021CC9F8: ; // 0x21cc9f8
@@ -32447,10 +32447,10 @@ void Gambit_fn_021CC994(CPUState* cpu) {
         /* 021CCAB8 */ cpu->f[1] = fma(cpu->f[8], cpu->f[8], cpu->f[9]);
         /* 021CCABC */ _t42 = cpu->r[8] + 0xFFFFC760u;
         /* 021CCABC */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t42);
-        /* 021CCAC0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 021CCAC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 021CCAC4 */ _t43 = cpu->r[1] + 0x00000014u;
         /* 021CCAC4 */ rbrew_write_f32(cpu->mem, _t43, cpu->f[8]);
-        /* 021CCAC8 */ _t44 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CCAC8 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CCAC8 */ _t45 = _t44 & 0x00000001u;
         /* 021CCAC8 */ if (_t45) goto L_021CCACC; else goto L_021CCAFC;
   L_021CCACC: ; // 0x21ccacc
@@ -32472,13 +32472,13 @@ void Gambit_fn_021CC994(CPUState* cpu) {
         /* 021CCAF8 */ rbrew_write_f32(cpu->mem, _t49, cpu->f[13]);
   L_021CCAFC: ; // 0x21ccafc
         /* 021CCAFC */ cpu->r[12] = 0x101C0000u;
-        /* 021CCB00 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 021CCB00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 021CCB04 */ cpu->r[10] = 0x101E0000u;
         /* 021CCB08 */ _t50 = cpu->r[12] + 0x00001EF8u;
         /* 021CCB08 */ cpu->r[3] = rbrew_read32(cpu->mem, _t50);
         /* 021CCB0C */ _t51 = cpu->r[10] + 0xFFFF958Cu;
         /* 021CCB0C */ cpu->f[3] = rbrew_read_f32(cpu->mem, _t51);
-        /* 021CCB10 */ _t52 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CCB10 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CCB10 */ _t53 = _t52 & 0x00000001u;
         /* 021CCB10 */ if (_t53) goto L_021CCB54; else goto L_021CCB14;
   L_021CCB14: ; // 0x21ccb14
@@ -32497,10 +32497,10 @@ void Gambit_fn_021CC994(CPUState* cpu) {
         /* 021CCB3C */ rbrew_write32(cpu->mem, _t55, cpu->r[0]);
         /* 021CCB40 */ Gambit_fn_0204A4DC(cpu);
         /* 021CCB44 */ cpu->r[9] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021CCB44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021CCB44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021CCB48 */ _t56 = cpu->r[1] + 0x00000054u;
         /* 021CCB48 */ rbrew_write32(cpu->mem, _t56, cpu->r[3]);
-        /* 021CCB4C */ _t57 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CCB4C */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CCB4C */ _t58 = _t57 & 0x00000001u;
         /* 021CCB4C */ if (_t58) goto L_021CCB84; else goto L_021CCB50;
   L_021CCB50: ; // 0x21ccb50
@@ -32517,18 +32517,18 @@ void Gambit_fn_021CC994(CPUState* cpu) {
         /* 021CCB70 */ cpu->r[7] = 0x000001FFu;
         /* 021CCB74 */ Gambit_fn_0204A864(cpu);
         /* 021CCB78 */ cpu->r[9] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021CCB78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021CCB78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021CCB7C */ _t60 = cpu->r[1] + 0x00000054u;
         /* 021CCB7C */ rbrew_write32(cpu->mem, _t60, cpu->r[3]);
-        /* 021CCB80 */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CCB80 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CCB80 */ _t62 = _t61 & 0x00000001u;
         /* 021CCB80 */ if (_t62) goto L_021CCB84; else goto L_021CCC7C;
   L_021CCB84: ; // 0x21ccb84
         /* 021CCB84 */ cpu->r[3] = 0x101C0000u;
         /* 021CCB88 */ _t63 = cpu->r[3] + 0x00005B90u;
         /* 021CCB88 */ cpu->r[3] = rbrew_read32(cpu->mem, _t63);
-        /* 021CCB8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CCB90 */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CCB8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CCB90 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CCB90 */ _t65 = _t64 & 0x00000001u;
         /* 021CCB90 */ if (_t65) goto L_021CCCC4; else goto L_021CCB94;
   L_021CCB94: ; // 0x21ccb94
@@ -32591,9 +32591,9 @@ void Gambit_fn_021CC994(CPUState* cpu) {
         /* 021CCC20 */ cpu->f[1] = fma(cpu->f[9], cpu->f[9], cpu->f[11]);
         /* 021CCC24 */ _t87 = cpu->r[1] + 0x00000038u;
         /* 021CCC24 */ rbrew_write_f32(cpu->mem, _t87, cpu->f[12]);
-        /* 021CCC28 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 021CCC28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 021CCC2C */ /* nop */
-        /* 021CCC30 */ _t88 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CCC30 */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CCC30 */ _t89 = _t88 & 0x00000001u;
         /* 021CCC30 */ if (_t89) goto L_021CCC34; else goto L_021CCC64;
   L_021CCC34: ; // 0x21ccc34
@@ -32618,8 +32618,8 @@ void Gambit_fn_021CC994(CPUState* cpu) {
         /* 021CCC68 */ cpu->r[5] = cpu->r[1] + 0x00000018u;
         /* 021CCC6C */ cpu->r[4] = cpu->r[1] + 0x00000030u;
         /* 021CCC70 */ Gambit_fn_02399D90(cpu);
-        /* 021CCC74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CCC78 */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CCC74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CCC78 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CCC78 */ _t95 = _t94 & 0x00000001u;
         /* 021CCC78 */ if (_t95) goto L_021CCCC4; else goto L_021CCC7C;
   L_021CCC7C: ; // 0x21ccc7c
@@ -32648,7 +32648,7 @@ void Gambit_fn_021CC994(CPUState* cpu) {
         /* 021CCCA8 */ cpu->f[27] = rbrew_read_f64(cpu->mem, _t106);
         /* 021CCCAC */ _t107 = cpu->r[1] + 0x00000080u;
         /* 021CCCAC */ cpu->r[30] = rbrew_read32(cpu->mem, _t107);
-        /* 021CCCB0 */ _t108 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CCCB0 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CCCB0 */ _t109 = _t108 & 0x00000001u;
         /* 021CCCB0 */ if (_t109) goto L_021CCCB4; // else: addr-0 trap, fall-through
   L_021CCCB4: ; // 0x21cccb4
@@ -32683,7 +32683,7 @@ void Gambit_fn_021CC994(CPUState* cpu) {
         /* 021CCCF0 */ cpu->f[27] = rbrew_read_f64(cpu->mem, _t121);
         /* 021CCCF4 */ _t122 = cpu->r[1] + 0x00000080u;
         /* 021CCCF4 */ cpu->r[30] = rbrew_read32(cpu->mem, _t122);
-        /* 021CCCF8 */ _t123 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CCCF8 */ _t123 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CCCF8 */ _t124 = _t123 & 0x00000001u;
         /* 021CCCF8 */ if (_t124) goto L_021CCCFC; // else: addr-0 trap, fall-through
   L_021CCCFC: ; // 0x21cccfc
@@ -32734,7 +32734,7 @@ void Gambit_fn_021CCD30(CPUState* cpu) {
         /* 021CCD40 */ _t4 = cpu->r[4] + 0x00000000u;
         /* 021CCD40 */ rbrew_write16(cpu->mem, _t4, (uint16_t)cpu->r[0]);
         /* 021CCD44 */ cpu->r[11] = cpu->r[9] & 0x0000FEFFu;
-        /* 021CCD44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021CCD44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021CCD48 */ cpu->r[12] = 0x00000000u;
         /* 021CCD4C */ _t5 = cpu->r[4] + 0x00000002u;
         /* 021CCD4C */ rbrew_write16(cpu->mem, _t5, (uint16_t)cpu->r[11]);
@@ -32996,17 +32996,17 @@ void Gambit_fn_021CCD58(CPUState* cpu) {
         /* 021CCF6C */ cpu->r[10] = rbrew_read32(cpu->mem, _t100);
         /* 021CCF70 */ _t101 = cpu->r[11] + 0xFFFFC7D8u;
         /* 021CCF70 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t101);
-        /* 021CCF74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u);
+        /* 021CCF74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u));
         /* 021CCF78 */ _t102 = cpu->r[31] + 0x000000ACu;
         /* 021CCF78 */ rbrew_write32(cpu->mem, _t102, cpu->r[10]);
-        /* 021CCF7C */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CCF7C */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CCF7C */ _t104 = _t103 & 0x00000001u;
         /* 021CCF7C */ if (_t104) goto L_021CCF80; else goto L_021CCF90;
   L_021CCF80: ; // 0x21ccf80
         /* 021CCF80 */ cpu->r[3] = 0x00000010u;
         /* 021CCF84 */ Gambit_fn_02801A78(cpu);
-        /* 021CCF88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CCF8C */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CCF88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CCF8C */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CCF8C */ _t106 = _t105 & 0x00000001u;
         /* 021CCF8C */ if (_t106) goto L_021CCFA0; else goto L_021CCF90;
   L_021CCF90: ; // 0x21ccf90
@@ -33019,16 +33019,16 @@ void Gambit_fn_021CCD58(CPUState* cpu) {
         /* 021CCF9C */ _t110 = cpu->r[3] + 0x0000000Cu;
         /* 021CCF9C */ rbrew_write_f32(cpu->mem, _t110, cpu->f[30]);
   L_021CCFA0: ; // 0x21ccfa0
-        /* 021CCFA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u);
+        /* 021CCFA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u));
         /* 021CCFA4 */ cpu->r[3] = cpu->r[31] + 0x000000D0u;
-        /* 021CCFA8 */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CCFA8 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CCFA8 */ _t112 = _t111 & 0x00000001u;
         /* 021CCFA8 */ if (_t112) goto L_021CCFAC; else goto L_021CCFBC;
   L_021CCFAC: ; // 0x21ccfac
         /* 021CCFAC */ cpu->r[3] = 0x00000010u;
         /* 021CCFB0 */ Gambit_fn_02801A78(cpu);
-        /* 021CCFB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CCFB8 */ _t113 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CCFB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CCFB8 */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CCFB8 */ _t114 = _t113 & 0x00000001u;
         /* 021CCFB8 */ if (_t114) goto L_021CCFCC; else goto L_021CCFBC;
   L_021CCFBC: ; // 0x21ccfbc
@@ -33076,7 +33076,7 @@ void Gambit_fn_021CCD58(CPUState* cpu) {
         /* 021CD010 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t133);
         /* 021CD014 */ _t134 = cpu->r[1] + 0x00000058u;
         /* 021CD014 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t134);
-        /* 021CD018 */ _t135 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CD018 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CD018 */ _t136 = _t135 & 0x00000001u;
         /* 021CD018 */ if (_t136) goto L_021CD01C; // else: addr-0 trap, fall-through
   L_021CD01C: ; // 0x21cd01c
@@ -33143,8 +33143,8 @@ void Gambit_fn_021CD04C(CPUState* cpu) {
         /* 021CD04C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021CD04C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021CD050 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021CD050 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021CD054 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD050 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021CD054 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD054 */ _t2 = _t1 & 0x00000001u;
         /* 021CD054 */ _t3 = _t2 ^ 0x00000001u;
         /* 021CD054 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -33166,8 +33166,8 @@ void Gambit_fn_021CD068(CPUState* cpu) {
         /* 021CD068 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021CD068 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021CD06C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021CD06C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021CD070 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD06C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021CD070 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD070 */ _t2 = _t1 & 0x00000001u;
         /* 021CD070 */ _t3 = _t2 ^ 0x00000001u;
         /* 021CD070 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -33189,8 +33189,8 @@ void Gambit_fn_021CD084(CPUState* cpu) {
         /* 021CD084 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021CD084 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021CD088 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021CD088 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021CD08C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD088 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021CD08C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD08C */ _t2 = _t1 & 0x00000001u;
         /* 021CD08C */ _t3 = _t2 ^ 0x00000001u;
         /* 021CD08C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -33233,8 +33233,8 @@ void Gambit_fn_021CD0B0(CPUState* cpu) {
         /* 021CD0C0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021CD0C4 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021CD0C4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021CD0C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021CD0CC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD0C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021CD0CC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD0CC */ _t5 = _t4 & 0x00000001u;
         /* 021CD0CC */ if (_t5) goto L_021CD0D0; else goto L_021CD0EC;
   L_021CD0D0: ; // 0x21cd0d0
@@ -33273,8 +33273,8 @@ void Gambit_fn_021CD0B4(CPUState* cpu) {
         /* 021CD0C0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021CD0C4 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021CD0C4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021CD0C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021CD0CC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD0C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021CD0CC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD0CC */ _t5 = _t4 & 0x00000001u;
         /* 021CD0CC */ if (_t5) goto L_021CD0D0; else goto L_021CD0EC;
   L_021CD0D0: ; // 0x21cd0d0
@@ -33553,9 +33553,9 @@ void Gambit_fn_021CD1FC(CPUState* cpu) {
         /* 021CD200 */ _t0 = cpu->r[9] + 0xFFFFFBB4u;
         /* 021CD200 */ cpu->r[9] = rbrew_read32(cpu->mem, _t0);
         /* 021CD204 */ cpu->r[11] = 0x101D0000u;
-        /* 021CD208 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021CD208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021CD20C */ cpu->r[11] = cpu->r[11] + 0xFFFFFBB8u;
-        /* 021CD210 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD210 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD210 */ _t2 = _t1 & 0x00000001u;
         /* 021CD210 */ if (_t2) goto L_021CD214; else goto L_021CD22C;
   L_021CD214: ; // 0x21cd214
@@ -33568,8 +33568,8 @@ void Gambit_fn_021CD1FC(CPUState* cpu) {
         /* 021CD228 */ _t4 = cpu->r[11] + 0x00000000u;
         /* 021CD228 */ rbrew_write32(cpu->mem, _t4, cpu->r[9]);
   L_021CD22C: ; // 0x21cd22c
-        /* 021CD22C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021CD230 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD22C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021CD230 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD230 */ _t6 = _t5 & 0x00000001u;
         /* 021CD230 */ if (_t6) goto L_021CD234; else goto L_021CD23C;
   L_021CD234: ; // 0x21cd234
@@ -33579,10 +33579,10 @@ void Gambit_fn_021CD1FC(CPUState* cpu) {
         /* 021CD23C */ cpu->r[12] = 0x101D0000u;
         /* 021CD240 */ _t7 = cpu->r[12] + 0xFFFFD9ECu;
         /* 021CD240 */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 021CD244 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021CD244 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021CD248 */ cpu->r[12] = 0x101D0000u;
         /* 021CD24C */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021CD250 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD250 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD250 */ _t9 = _t8 & 0x00000001u;
         /* 021CD250 */ if (_t9) goto L_021CD254; else goto L_021CD26C;
   L_021CD254: ; // 0x21cd254
@@ -33595,8 +33595,8 @@ void Gambit_fn_021CD1FC(CPUState* cpu) {
         /* 021CD268 */ _t11 = cpu->r[12] + 0x00000000u;
         /* 021CD268 */ rbrew_write32(cpu->mem, _t11, cpu->r[11]);
   L_021CD26C: ; // 0x21cd26c
-        /* 021CD26C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021CD270 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD26C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021CD270 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD270 */ _t13 = _t12 & 0x00000001u;
         /* 021CD270 */ if (_t13) goto L_021CD274; else goto L_021CD27C;
   L_021CD274: ; // 0x21cd274
@@ -33608,9 +33608,9 @@ void Gambit_fn_021CD1FC(CPUState* cpu) {
         /* 021CD280 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 021CD280 */ cpu->r[10] = _t14;
         /* 021CD284 */ cpu->r[11] = 0x101D0000u;
-        /* 021CD288 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021CD288 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021CD28C */ cpu->r[11] = cpu->r[11] + 0xFFFFD4ECu;
-        /* 021CD290 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD290 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD290 */ _t16 = _t15 & 0x00000001u;
         /* 021CD290 */ if (_t16) goto L_021CD294; else goto L_021CD2A8;
   L_021CD294: ; // 0x21cd294
@@ -33622,8 +33622,8 @@ void Gambit_fn_021CD1FC(CPUState* cpu) {
         /* 021CD2A4 */ _t18 = cpu->r[11] + 0x00000000u;
         /* 021CD2A4 */ rbrew_write32(cpu->mem, _t18, cpu->r[9]);
   L_021CD2A8: ; // 0x21cd2a8
-        /* 021CD2A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021CD2AC */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD2A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021CD2AC */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD2AC */ _t20 = _t19 & 0x00000001u;
         /* 021CD2AC */ if (_t20) goto L_021CD2B0; else goto L_021CD2B8;
   L_021CD2B0: ; // 0x21cd2b0
@@ -33635,9 +33635,9 @@ void Gambit_fn_021CD1FC(CPUState* cpu) {
         /* 021CD2BC */ cpu->r[10] = rbrew_read32(cpu->mem, _t21);
         /* 021CD2BC */ cpu->r[9] = _t21;
         /* 021CD2C0 */ cpu->r[12] = 0x101D0000u;
-        /* 021CD2C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021CD2C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021CD2C8 */ cpu->r[12] = cpu->r[12] + 0xFFFFD4E4u;
-        /* 021CD2CC */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD2CC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD2CC */ _t23 = _t22 & 0x00000001u;
         /* 021CD2CC */ if (_t23) goto L_021CD2D0; else goto L_021CD2E4;
   L_021CD2D0: ; // 0x21cd2d0
@@ -33727,8 +33727,8 @@ void Gambit_fn_021CD340(CPUState* cpu) {
   L_021CD340: ; // 0x21cd340
         /* 021CD340 */ _t0 = cpu->r[3] + 0x00000242u;
         /* 021CD340 */ cpu->r[0] = rbrew_read8(cpu->mem, _t0);
-        /* 021CD344 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021CD348 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD344 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021CD348 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD348 */ _t2 = _t1 & 0x00000001u;
         /* 021CD348 */ if (_t2) goto L_021CD35C; else goto L_021CD34C;
   L_021CD34C: ; // 0x21cd34c
@@ -33752,8 +33752,8 @@ void Gambit_fn_021CD368(CPUState* cpu) {
   L_021CD368: ; // 0x21cd368
         /* 021CD368 */ _t0 = cpu->r[3] + 0x00000242u;
         /* 021CD368 */ cpu->r[0] = rbrew_read8(cpu->mem, _t0);
-        /* 021CD36C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021CD370 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD36C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021CD370 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD370 */ _t2 = _t1 & 0x00000001u;
         /* 021CD370 */ if (_t2) goto L_021CD384; else goto L_021CD374;
   L_021CD374: ; // 0x21cd374
@@ -33885,18 +33885,18 @@ void Gambit_fn_021CD404(CPUState* cpu) {
         /* 021CD40C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021CD40C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021CD410 */ cpu->r[31] = cpu->r[3];
-        /* 021CD410 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021CD410 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021CD414 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021CD414 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021CD418 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD418 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD418 */ _t4 = _t3 & 0x00000001u;
         /* 021CD418 */ if (_t4) goto L_021CD41C; else goto L_021CD42C;
   L_021CD41C: ; // 0x21cd41c
         /* 021CD41C */ cpu->r[3] = 0x00000248u;
         /* 021CD420 */ Gambit_fn_02801A78(cpu);
         /* 021CD424 */ cpu->r[31] = cpu->r[3];
-        /* 021CD424 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021CD428 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD424 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021CD428 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD428 */ _t6 = _t5 & 0x00000001u;
         /* 021CD428 */ if (_t6) goto L_021CD46C; else goto L_021CD42C;
   L_021CD42C: ; // 0x21cd42c
@@ -33944,18 +33944,18 @@ void Gambit_fn_021CD408(CPUState* cpu) {
         /* 021CD40C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021CD40C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021CD410 */ cpu->r[31] = cpu->r[3];
-        /* 021CD410 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021CD410 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021CD414 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021CD414 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021CD418 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD418 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD418 */ _t4 = _t3 & 0x00000001u;
         /* 021CD418 */ if (_t4) goto L_021CD41C; else goto L_021CD42C;
   L_021CD41C: ; // 0x21cd41c
         /* 021CD41C */ cpu->r[3] = 0x00000248u;
         /* 021CD420 */ Gambit_fn_02801A78(cpu);
         /* 021CD424 */ cpu->r[31] = cpu->r[3];
-        /* 021CD424 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021CD428 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD424 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021CD428 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD428 */ _t6 = _t5 & 0x00000001u;
         /* 021CD428 */ if (_t6) goto L_021CD46C; else goto L_021CD42C;
   L_021CD42C: ; // 0x21cd42c
@@ -34019,9 +34019,9 @@ void Gambit_fn_021CD484(CPUState* cpu) {
         /* 021CD4B8 */ cpu->r[4] = 0x101D0000u;
         /* 021CD4BC */ cpu->r[31] = cpu->r[10];
         /* 021CD4C0 */ cpu->r[30] = cpu->r[9];
-        /* 021CD4C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021CD4C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021CD4C8 */ cpu->r[4] = cpu->r[4] + 0xFFFFFBC4u;
-        /* 021CD4CC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD4CC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD4CC */ _t5 = _t4 & 0x00000001u;
         /* 021CD4CC */ if (_t5) goto L_021CD4D0; else goto L_021CD4E4;
   L_021CD4D0: ; // 0x21cd4d0
@@ -34033,8 +34033,8 @@ void Gambit_fn_021CD484(CPUState* cpu) {
         /* 021CD4E0 */ _t7 = cpu->r[4] + 0x00000000u;
         /* 021CD4E0 */ rbrew_write32(cpu->mem, _t7, cpu->r[0]);
   L_021CD4E4: ; // 0x21cd4e4
-        /* 021CD4E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 021CD4E8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD4E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 021CD4E8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD4E8 */ _t9 = _t8 & 0x00000001u;
         /* 021CD4E8 */ if (_t9) goto L_021CD548; else goto L_021CD4EC;
   L_021CD4EC: ; // 0x21cd4ec
@@ -34045,8 +34045,8 @@ void Gambit_fn_021CD484(CPUState* cpu) {
         /* 021CD4F4 */ cpu->ctr = cpu->r[0];
         /* 021CD4F8 */ cpu->r[3] = cpu->r[25];
         /* 021CD4FC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CD500 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CD504 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD500 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CD504 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD504 */ _t13 = _t12 & 0x00000001u;
         /* 021CD504 */ if (_t13) goto L_021CD548; else goto L_021CD508;
   L_021CD508: ; // 0x21cd508
@@ -34200,9 +34200,9 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CD66C */ cpu->f[12] = cpu->f[12] + cpu->f[7];
         /* 021CD670 */ cpu->r[6] = cpu->r[6] + 0x0000000Cu;
         /* 021CD674 */ cpu->r[5] = cpu->r[5] + 0xFFFFFFFFu;
-        /* 021CD674 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021CD674 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021CD678 */ cpu->f[6] = cpu->f[12];
-        /* 021CD67C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD67C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD67C */ _t20 = _t19 & 0x00000001u;
         /* 021CD67C */ if (_t20) goto L_021CD688; else goto L_021CD680;
   L_021CD680: ; // 0x21cd680
@@ -34243,11 +34243,11 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CD6E0 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t29);
         /* 021CD6E4 */ _t30 = cpu->r[8] + 0xFFFF958Cu;
         /* 021CD6E4 */ cpu->f[3] = rbrew_read_f32(cpu->mem, _t30);
-        /* 021CD6E8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
+        /* 021CD6E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
         /* 021CD6EC */ cpu->r[8] = 0x101C0000u;
         /* 021CD6F0 */ _t31 = cpu->r[8] + 0x00001EF8u;
         /* 021CD6F0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t31);
-        /* 021CD6F4 */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CD6F4 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CD6F4 */ _t33 = _t32 & 0x00000001u;
         /* 021CD6F4 */ if (_t33) goto L_021CD73C; else goto L_021CD6F8;
   L_021CD6F8: ; // 0x21cd6f8
@@ -34267,10 +34267,10 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CD724 */ rbrew_write32(cpu->mem, _t35, cpu->r[0]);
         /* 021CD728 */ Gambit_fn_0204A4DC(cpu);
         /* 021CD72C */ cpu->r[8] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021CD72C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021CD72C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021CD730 */ _t36 = cpu->r[1] + 0x00000090u;
         /* 021CD730 */ rbrew_write32(cpu->mem, _t36, cpu->r[3]);
-        /* 021CD734 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD734 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD734 */ _t38 = _t37 & 0x00000001u;
         /* 021CD734 */ if (_t38) goto L_021CDC14; else goto L_021CD738;
   L_021CD738: ; // 0x21cd738
@@ -34290,10 +34290,10 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CD760 */ cpu->r[9] = cpu->r[1] + 0x00000090u;
         /* 021CD764 */ Gambit_fn_0204A864(cpu);
         /* 021CD768 */ cpu->r[8] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021CD768 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021CD768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021CD76C */ _t41 = cpu->r[1] + 0x00000090u;
         /* 021CD76C */ rbrew_write32(cpu->mem, _t41, cpu->r[3]);
-        /* 021CD770 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD770 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD770 */ _t43 = _t42 & 0x00000001u;
         /* 021CD770 */ if (_t43) goto L_021CDC14; else goto L_021CD774;
   L_021CD774: ; // 0x21cd774
@@ -34312,13 +34312,13 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CD794 */ _t48 = cpu->r[1] + 0x0000004Cu;
         /* 021CD794 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t48);
         /* 021CD798 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000004u, 0x00000004u);
-        /* 021CD798 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021CD798 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021CD79C */ /* nop */
         /* 021CD7A0 */ _t49 = cpu->r[30] + 0x00000134u;
         /* 021CD7A0 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t49);
         /* 021CD7A4 */ _t50 = cpu->r[1] + 0x000000B8u;
         /* 021CD7A4 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t50);
-        /* 021CD7A8 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD7A8 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD7A8 */ _t52 = _t51 & 0x00000001u;
         /* 021CD7A8 */ if (_t52) goto L_021CD7F4; else goto L_021CD7AC;
   L_021CD7AC: ; // 0x21cd7ac
@@ -34342,14 +34342,14 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CD7D4 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t59);
         /* 021CD7D8 */ _t60 = cpu->r[1] + 0x000000C0u;
         /* 021CD7D8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t60);
-        /* 021CD7DC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[11]);
+        /* 021CD7DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[11]));
         /* 021CD7E0 */ _t61 = cpu->r[1] + 0x00000080u;
         /* 021CD7E0 */ rbrew_write32(cpu->mem, _t61, cpu->r[0]);
         /* 021CD7E4 */ _t62 = cpu->r[1] + 0x0000007Cu;
         /* 021CD7E4 */ rbrew_write32(cpu->mem, _t62, cpu->r[10]);
         /* 021CD7E8 */ _t63 = cpu->r[1] + 0x0000007Cu;
         /* 021CD7E8 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t63);
-        /* 021CD7EC */ _t64 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CD7EC */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CD7EC */ _t65 = _t64 & 0x00000001u;
         /* 021CD7EC */ if (_t65) goto L_021CD7F0; else goto L_021CD83C;
   L_021CD7F0: ; // 0x21cd7f0
@@ -34373,14 +34373,14 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CD818 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t71);
         /* 021CD81C */ _t72 = cpu->r[1] + 0x000000C0u;
         /* 021CD81C */ cpu->r[10] = rbrew_read32(cpu->mem, _t72);
-        /* 021CD820 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[11]);
+        /* 021CD820 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[11]));
         /* 021CD824 */ _t73 = cpu->r[1] + 0x00000080u;
         /* 021CD824 */ rbrew_write32(cpu->mem, _t73, cpu->r[0]);
         /* 021CD828 */ _t74 = cpu->r[1] + 0x0000007Cu;
         /* 021CD828 */ rbrew_write32(cpu->mem, _t74, cpu->r[10]);
         /* 021CD82C */ _t75 = cpu->r[1] + 0x0000007Cu;
         /* 021CD82C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t75);
-        /* 021CD830 */ _t76 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CD830 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CD830 */ _t77 = _t76 & 0x00000001u;
         /* 021CD830 */ if (_t77) goto L_021CD834; else goto L_021CD83C;
   L_021CD834: ; // 0x21cd834
@@ -34389,12 +34389,12 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CD838 */ _t79 = cpu->r[1] + 0x00000078u;
         /* 021CD838 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t79);
   L_021CD83C: ; // 0x21cd83c
-        /* 021CD83C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[12]);
+        /* 021CD83C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[12]));
         /* 021CD840 */ _t80 = cpu->r[30] + 0x0000013Cu;
         /* 021CD840 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t80);
         /* 021CD844 */ _t81 = cpu->r[1] + 0x00000080u;
         /* 021CD844 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t81);
-        /* 021CD848 */ _t82 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CD848 */ _t82 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CD848 */ _t83 = _t82 & 0x00000001u;
         /* 021CD848 */ if (_t83) goto L_021CD84C; else goto L_021CD854;
   L_021CD84C: ; // 0x21cd84c
@@ -34403,10 +34403,10 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CD850 */ _t85 = cpu->r[1] + 0x0000007Cu;
         /* 021CD850 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t85);
   L_021CD854: ; // 0x21cd854
-        /* 021CD854 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[13]);
+        /* 021CD854 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[13]));
         /* 021CD858 */ _t86 = cpu->r[30] + 0x00000140u;
         /* 021CD858 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t86);
-        /* 021CD85C */ _t87 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CD85C */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CD85C */ _t88 = _t87 & 0x00000001u;
         /* 021CD85C */ if (_t88) goto L_021CD860; else goto L_021CD868;
   L_021CD860: ; // 0x21cd860
@@ -34415,28 +34415,28 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CD864 */ _t90 = cpu->r[1] + 0x00000080u;
         /* 021CD864 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t90);
   L_021CD868: ; // 0x21cd868
-        /* 021CD868 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
+        /* 021CD868 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
         /* 021CD86C */ _t91 = cpu->r[30] + 0x00000144u;
         /* 021CD86C */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t91);
-        /* 021CD870 */ _t92 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CD870 */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CD870 */ _t93 = _t92 & 0x00000001u;
         /* 021CD870 */ if (_t93) goto L_021CD874; else goto L_021CD878;
   L_021CD874: ; // 0x21cd874
         /* 021CD874 */ _t94 = cpu->r[30] + 0x00000140u;
         /* 021CD874 */ rbrew_write_f32(cpu->mem, _t94, cpu->f[8]);
   L_021CD878: ; // 0x21cd878
-        /* 021CD878 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[6]);
+        /* 021CD878 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[6]));
         /* 021CD87C */ _t95 = cpu->r[30] + 0x00000148u;
         /* 021CD87C */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t95);
-        /* 021CD880 */ _t96 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CD880 */ _t96 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CD880 */ _t97 = _t96 & 0x00000001u;
         /* 021CD880 */ if (_t97) goto L_021CD884; else goto L_021CD888;
   L_021CD884: ; // 0x21cd884
         /* 021CD884 */ _t98 = cpu->r[30] + 0x00000144u;
         /* 021CD884 */ rbrew_write_f32(cpu->mem, _t98, cpu->f[11]);
   L_021CD888: ; // 0x21cd888
-        /* 021CD888 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[7]);
-        /* 021CD88C */ _t99 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CD888 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[7]));
+        /* 021CD88C */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CD88C */ _t100 = _t99 & 0x00000001u;
         /* 021CD88C */ if (_t100) goto L_021CD890; else goto L_021CD894;
   L_021CD890: ; // 0x21cd890
@@ -34445,8 +34445,8 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
   L_021CD894: ; // 0x21cd894
         /* 021CD894 */ _t102 = cpu->r[26] + 0x00000040u;
         /* 021CD894 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t102);
-        /* 021CD898 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[8]);
-        /* 021CD89C */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD898 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[8]));
+        /* 021CD89C */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD89C */ _t104 = _t103 & 0x00000001u;
         /* 021CD89C */ if (_t104) goto L_021CD8C4; else goto L_021CD8A0;
   L_021CD8A0: ; // 0x21cd8a0
@@ -34455,7 +34455,7 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CD8A4 */ _t106 = cpu->r[26] + 0x00000034u;
         /* 021CD8A4 */ rbrew_write_f32(cpu->mem, _t106, cpu->f[31]);
         /* 021CD8A8 */ cpu->r[6] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 021CD8A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 021CD8A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 021CD8AC */ _t107 = cpu->r[26] + 0x0000003Cu;
         /* 021CD8AC */ rbrew_write_f32(cpu->mem, _t107, cpu->f[31]);
         /* 021CD8B0 */ _t108 = cpu->r[26] + 0x00000040u;
@@ -34463,7 +34463,7 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CD8B4 */ cpu->r[12] = cpu->r[26] + 0x00000034u;
         /* 021CD8B8 */ _t109 = cpu->r[26] + 0x00000038u;
         /* 021CD8B8 */ rbrew_write_f32(cpu->mem, _t109, cpu->f[31]);
-        /* 021CD8BC */ _t110 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD8BC */ _t110 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD8BC */ _t111 = _t110 & 0x00000001u;
         /* 021CD8BC */ if (_t111) goto L_021CD8C0; else goto L_021CD908;
   L_021CD8C0: ; // 0x21cd8c0
@@ -34472,8 +34472,8 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CD8C4 */ _t112 = cpu->r[26] + 0x00000000u;
         /* 021CD8C4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t112);
         /* 021CD8C8 */ cpu->r[4] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Bu, 0x0000001Cu);
-        /* 021CD8C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 021CD8CC */ _t113 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD8C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 021CD8CC */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD8CC */ _t114 = _t113 & 0x00000001u;
         /* 021CD8CC */ if (_t114) goto L_021CD8D0; else goto L_021CD8EC;
   L_021CD8D0: ; // 0x21cd8d0
@@ -34481,11 +34481,11 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CD8D0 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t115);
         /* 021CD8D4 */ _t116 = cpu->r[30] + 0x00000134u;
         /* 021CD8D4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t116);
-        /* 021CD8D8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
+        /* 021CD8D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
         /* 021CD8DC */ _t117 = cpu->r[30] + 0x00000138u;
         /* 021CD8DC */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t117);
         /* 021CD8E0 */ cpu->r[12] = cpu->r[26] + 0x00000034u;
-        /* 021CD8E4 */ _t118 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CD8E4 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CD8E4 */ _t119 = _t118 & 0x00000001u;
         /* 021CD8E4 */ if (_t119) goto L_021CD8E8; else goto L_021CDA9C;
   L_021CD8E8: ; // 0x21cd8e8
@@ -34496,13 +34496,13 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CD8F0 */ _t121 = cpu->r[26] + 0x00000038u;
         /* 021CD8F0 */ rbrew_write_f32(cpu->mem, _t121, cpu->f[31]);
         /* 021CD8F4 */ cpu->r[6] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 021CD8F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 021CD8F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 021CD8F8 */ _t122 = cpu->r[26] + 0x00000034u;
         /* 021CD8F8 */ rbrew_write_f32(cpu->mem, _t122, cpu->f[31]);
         /* 021CD8FC */ cpu->r[12] = cpu->r[26] + 0x00000034u;
         /* 021CD900 */ _t123 = cpu->r[26] + 0x0000003Cu;
         /* 021CD900 */ rbrew_write_f32(cpu->mem, _t123, cpu->f[31]);
-        /* 021CD904 */ _t124 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD904 */ _t124 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD904 */ _t125 = _t124 & 0x00000001u;
         /* 021CD904 */ if (_t125) goto L_021CD92C; else goto L_021CD908;
   L_021CD908: ; // 0x21cd908
@@ -34521,8 +34521,8 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CD928 */ cpu->r[7] = rbrew_read32(cpu->mem, _t129);
   L_021CD92C: ; // 0x21cd92c
         /* 021CD92C */ cpu->r[6] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Bu, 0x0000001Bu);
-        /* 021CD92C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 021CD930 */ _t130 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CD92C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 021CD930 */ _t130 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CD930 */ _t131 = _t130 & 0x00000001u;
         /* 021CD930 */ if (_t131) goto L_021CDA78; else goto L_021CD934;
   L_021CD934: ; // 0x21cd934
@@ -34530,12 +34530,12 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CD934 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t132);
         /* 021CD938 */ _t133 = cpu->r[26] + 0x00000040u;
         /* 021CD938 */ cpu->f[4] = rbrew_read_f32(cpu->mem, _t133);
-        /* 021CD93C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 021CD93C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 021CD940 */ _t134 = cpu->r[26] + 0x0000001Cu;
         /* 021CD940 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t134);
         /* 021CD944 */ _t135 = cpu->r[26] + 0x00000028u;
         /* 021CD944 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t135);
-        /* 021CD948 */ _t136 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CD948 */ _t136 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CD948 */ _t137 = _t136 & 0x00000001u;
         /* 021CD948 */ if (_t137) goto L_021CD94C; else goto L_021CD970;
   L_021CD94C: ; // 0x21cd94c
@@ -34546,17 +34546,17 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CD958 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t138);
         /* 021CD95C */ _t139 = cpu->r[26] + 0x0000002Cu;
         /* 021CD95C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t139);
-        /* 021CD960 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
+        /* 021CD960 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
         /* 021CD964 */ _t140 = cpu->r[26] + 0x00000020u;
         /* 021CD964 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t140);
-        /* 021CD968 */ _t141 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CD968 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CD968 */ _t142 = _t141 & 0x00000001u;
         /* 021CD968 */ if (_t142) goto L_021CD96C; else goto L_021CD9D8;
   L_021CD96C: ; // 0x21cd96c
         /* 021CD96C */ goto L_021CD9B4;
   L_021CD970: ; // 0x21cd970
-        /* 021CD970 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
-        /* 021CD974 */ _t143 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CD970 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
+        /* 021CD974 */ _t143 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CD974 */ _t144 = _t143 & 0x00000001u;
         /* 021CD974 */ if (_t144) goto L_021CD978; else goto L_021CD99C;
   L_021CD978: ; // 0x21cd978
@@ -34564,13 +34564,13 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CD97C */ /* nop */
         /* 021CD980 */ _t145 = cpu->r[12] + 0x00000004u;
         /* 021CD980 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t145);
-        /* 021CD984 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
+        /* 021CD984 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
         /* 021CD988 */ cpu->f[5] = fma(cpu->f[11], cpu->f[4], cpu->f[9]);
         /* 021CD98C */ _t146 = cpu->r[26] + 0x0000002Cu;
         /* 021CD98C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t146);
         /* 021CD990 */ _t147 = cpu->r[26] + 0x00000020u;
         /* 021CD990 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t147);
-        /* 021CD994 */ _t148 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CD994 */ _t148 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CD994 */ _t149 = _t148 & 0x00000001u;
         /* 021CD994 */ if (_t149) goto L_021CD998; else goto L_021CD9D8;
   L_021CD998: ; // 0x21cd998
@@ -34581,10 +34581,10 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CD9A0 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t150);
         /* 021CD9A4 */ _t151 = cpu->r[26] + 0x00000020u;
         /* 021CD9A4 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t151);
-        /* 021CD9A8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
+        /* 021CD9A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
         /* 021CD9AC */ _t152 = cpu->r[26] + 0x0000002Cu;
         /* 021CD9AC */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t152);
-        /* 021CD9B0 */ _t153 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CD9B0 */ _t153 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CD9B0 */ _t154 = _t153 & 0x00000001u;
         /* 021CD9B0 */ if (_t154) goto L_021CD9B4; else goto L_021CD9D8;
   L_021CD9B4: ; // 0x21cd9b4
@@ -34592,20 +34592,20 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CD9B8 */ /* nop */
         /* 021CD9BC */ _t155 = cpu->r[12] + 0x00000008u;
         /* 021CD9BC */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t155);
-        /* 021CD9C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
+        /* 021CD9C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
         /* 021CD9C4 */ _t156 = cpu->r[26] + 0x00000030u;
         /* 021CD9C4 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t156);
         /* 021CD9C8 */ cpu->f[9] = fma(cpu->f[9], cpu->f[4], cpu->f[6]);
         /* 021CD9CC */ _t157 = cpu->r[26] + 0x00000024u;
         /* 021CD9CC */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t157);
-        /* 021CD9D0 */ _t158 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CD9D0 */ _t158 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CD9D0 */ _t159 = _t158 & 0x00000001u;
         /* 021CD9D0 */ if (_t159) goto L_021CD9D4; else goto L_021CDA3C;
   L_021CD9D4: ; // 0x21cd9d4
         /* 021CD9D4 */ goto L_021CDA1C;
   L_021CD9D8: ; // 0x21cd9d8
-        /* 021CD9D8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
-        /* 021CD9DC */ _t160 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CD9D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
+        /* 021CD9DC */ _t160 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CD9DC */ _t161 = _t160 & 0x00000001u;
         /* 021CD9DC */ if (_t161) goto L_021CD9E0; else goto L_021CDA04;
   L_021CD9E0: ; // 0x21cd9e0
@@ -34616,10 +34616,10 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CD9EC */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t162);
         /* 021CD9F0 */ _t163 = cpu->r[26] + 0x00000024u;
         /* 021CD9F0 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t163);
-        /* 021CD9F4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
+        /* 021CD9F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
         /* 021CD9F8 */ _t164 = cpu->r[26] + 0x00000030u;
         /* 021CD9F8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t164);
-        /* 021CD9FC */ _t165 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CD9FC */ _t165 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CD9FC */ _t166 = _t165 & 0x00000001u;
         /* 021CD9FC */ if (_t166) goto L_021CDA00; else goto L_021CDA3C;
   L_021CDA00: ; // 0x21cda00
@@ -34630,10 +34630,10 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CDA08 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t167);
         /* 021CDA0C */ _t168 = cpu->r[26] + 0x00000024u;
         /* 021CDA0C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t168);
-        /* 021CDA10 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
+        /* 021CDA10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
         /* 021CDA14 */ _t169 = cpu->r[26] + 0x00000030u;
         /* 021CDA14 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t169);
-        /* 021CDA18 */ _t170 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CDA18 */ _t170 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CDA18 */ _t171 = _t170 & 0x00000001u;
         /* 021CDA18 */ if (_t171) goto L_021CDA1C; else goto L_021CDA3C;
   L_021CDA1C: ; // 0x21cda1c
@@ -34650,8 +34650,8 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CDA34 */ cpu->r[7] = rbrew_read32(cpu->mem, _t175);
         /* 021CDA38 */ goto L_021CDA78;
   L_021CDA3C: ; // 0x21cda3c
-        /* 021CDA3C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
-        /* 021CDA40 */ _t176 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CDA3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
+        /* 021CDA40 */ _t176 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CDA40 */ _t177 = _t176 & 0x00000001u;
         /* 021CDA40 */ if (_t177) goto L_021CDA44; else goto L_021CDA64;
   L_021CDA44: ; // 0x21cda44
@@ -34687,10 +34687,10 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CDA84 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t188);
         /* 021CDA88 */ _t189 = cpu->r[30] + 0x00000138u;
         /* 021CDA88 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t189);
-        /* 021CDA8C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
+        /* 021CDA8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
         /* 021CDA90 */ _t190 = cpu->r[1] + 0x0000004Cu;
         /* 021CDA90 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t190);
-        /* 021CDA94 */ _t191 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CDA94 */ _t191 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CDA94 */ _t192 = _t191 & 0x00000001u;
         /* 021CDA94 */ if (_t192) goto L_021CDA98; else goto L_021CDA9C;
   L_021CDA98: ; // 0x21cda98
@@ -34699,8 +34699,8 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
   L_021CDA9C: ; // 0x21cda9c
         /* 021CDA9C */ _t194 = cpu->r[12] + 0x00000004u;
         /* 021CDA9C */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t194);
-        /* 021CDAA0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[6]);
-        /* 021CDAA4 */ _t195 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CDAA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[6]));
+        /* 021CDAA4 */ _t195 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CDAA4 */ _t196 = _t195 & 0x00000001u;
         /* 021CDAA4 */ if (_t196) goto L_021CDAA8; else goto L_021CDAAC;
   L_021CDAA8: ; // 0x21cdaa8
@@ -34711,8 +34711,8 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CDAAC */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t198);
         /* 021CDAB0 */ _t199 = cpu->r[30] + 0x0000013Cu;
         /* 021CDAB0 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t199);
-        /* 021CDAB4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[7]);
-        /* 021CDAB8 */ _t200 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CDAB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[7]));
+        /* 021CDAB8 */ _t200 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CDAB8 */ _t201 = _t200 & 0x00000001u;
         /* 021CDAB8 */ if (_t201) goto L_021CDABC; else goto L_021CDAC0;
   L_021CDABC: ; // 0x21cdabc
@@ -34723,10 +34723,10 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CDAC0 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t203);
         /* 021CDAC4 */ _t204 = cpu->r[30] + 0x00000140u;
         /* 021CDAC4 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t204);
-        /* 021CDAC8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[8]);
+        /* 021CDAC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[8]));
         /* 021CDACC */ _t205 = cpu->r[30] + 0x00000144u;
         /* 021CDACC */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t205);
-        /* 021CDAD0 */ _t206 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CDAD0 */ _t206 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CDAD0 */ _t207 = _t206 & 0x00000001u;
         /* 021CDAD0 */ if (_t207) goto L_021CDAD4; else goto L_021CDAD8;
   L_021CDAD4: ; // 0x21cdad4
@@ -34735,10 +34735,10 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
   L_021CDAD8: ; // 0x21cdad8
         /* 021CDAD8 */ _t209 = cpu->r[12] + 0x00000004u;
         /* 021CDAD8 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t209);
-        /* 021CDADC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[10]);
+        /* 021CDADC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[10]));
         /* 021CDAE0 */ _t210 = cpu->r[30] + 0x00000148u;
         /* 021CDAE0 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t210);
-        /* 021CDAE4 */ _t211 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CDAE4 */ _t211 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CDAE4 */ _t212 = _t211 & 0x00000001u;
         /* 021CDAE4 */ if (_t212) goto L_021CDAE8; else goto L_021CDAEC;
   L_021CDAE8: ; // 0x21cdae8
@@ -34747,8 +34747,8 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
   L_021CDAEC: ; // 0x21cdaec
         /* 021CDAEC */ _t214 = cpu->r[12] + 0x00000008u;
         /* 021CDAEC */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t214);
-        /* 021CDAF0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[11]);
-        /* 021CDAF4 */ _t215 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CDAF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[11]));
+        /* 021CDAF4 */ _t215 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CDAF4 */ _t216 = _t215 & 0x00000001u;
         /* 021CDAF4 */ if (_t216) goto L_021CDAF8; else goto L_021CDAFC;
   L_021CDAF8: ; // 0x21cdaf8
@@ -34762,8 +34762,8 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CDB0C */ cpu->r[5] = cpu->r[1] + 0x000000E0u;
         /* 021CDB10 */ cpu->r[3] = cpu->r[30];
         /* 021CDB14 */ Gambit_fn_021C2660(cpu);
-        /* 021CDB18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CDB1C */ _t218 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CDB18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CDB1C */ _t218 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CDB1C */ _t219 = _t218 & 0x00000001u;
         /* 021CDB1C */ if (_t219) goto L_021CDB60; else goto L_021CDB20;
   L_021CDB20: ; // 0x21cdb20
@@ -34786,7 +34786,7 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CDB44 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t226);
         /* 021CDB48 */ _t227 = cpu->r[1] + 0x00000188u;
         /* 021CDB48 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t227);
-        /* 021CDB4C */ _t228 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CDB4C */ _t228 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CDB4C */ _t229 = _t228 & 0x00000001u;
         /* 021CDB4C */ if (_t229) goto L_021CDB50; // else: addr-0 trap, fall-through
   L_021CDB50: ; // 0x21cdb50
@@ -34799,8 +34799,8 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CDB60 */ _t231 = cpu->r[26] + 0x0000015Cu;
         /* 021CDB60 */ cpu->r[8] = rbrew_read32(cpu->mem, _t231);
         /* 021CDB64 */ cpu->r[0] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 021CDB64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021CDB68 */ _t232 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CDB64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021CDB68 */ _t232 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CDB68 */ _t233 = _t232 & 0x00000001u;
         /* 021CDB68 */ if (_t233) goto L_021CDB8C; else goto L_021CDB6C;
   L_021CDB6C: ; // 0x21cdb6c
@@ -34817,8 +34817,8 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CDB88 */ cpu->r[8] = rbrew_read32(cpu->mem, _t236);
   L_021CDB8C: ; // 0x21cdb8c
         /* 021CDB8C */ cpu->r[0] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021CDB8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021CDB90 */ _t237 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CDB8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021CDB90 */ _t237 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CDB90 */ _t238 = _t237 & 0x00000001u;
         /* 021CDB90 */ if (_t238) goto L_021CDBB0; else goto L_021CDB94;
   L_021CDB94: ; // 0x21cdb94
@@ -34838,8 +34838,8 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CDBB8 */ cpu->r[9] = cpu->r[7] + 0x101E0000u;
         /* 021CDBBC */ _t242 = cpu->r[9] + 0xFFFF9484u;
         /* 021CDBBC */ cpu->r[0] = rbrew_read32(cpu->mem, _t242);
-        /* 021CDBC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021CDBC4 */ _t243 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CDBC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021CDBC4 */ _t243 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CDBC4 */ _t244 = _t243 & 0x00000001u;
         /* 021CDBC4 */ if (_t244) goto L_021CDBC8; else goto L_021CDC28;
   L_021CDBC8: ; // 0x21cdbc8
@@ -34862,8 +34862,8 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CDBFC */ cpu->ctr = cpu->r[4];
         /* 021CDC00 */ cpu->r[3] = cpu->r[30];
         /* 021CDC04 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CDC08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CDC0C */ _t248 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CDC08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CDC0C */ _t248 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CDC0C */ _t249 = _t248 & 0x00000001u;
         /* 021CDC0C */ if (_t249) goto L_021CDD18; else goto L_021CDC10;
   L_021CDC10: ; // 0x21cdc10
@@ -34872,8 +34872,8 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CDC14 */ cpu->r[3] = cpu->r[30];
         /* 021CDC18 */ cpu->r[4] = cpu->r[1] + 0x00000090u;
         /* 021CDC1C */ Gambit_fn_021C3934(cpu);
-        /* 021CDC20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CDC24 */ _t250 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CDC20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CDC24 */ _t250 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CDC24 */ _t251 = _t250 & 0x00000001u;
         /* 021CDC24 */ if (_t251) goto L_021CDC28; else goto L_021CE1BC;
   L_021CDC28: ; // 0x21cdc28
@@ -34884,8 +34884,8 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CDC30 */ cpu->ctr = cpu->r[4];
         /* 021CDC34 */ cpu->r[3] = cpu->r[30];
         /* 021CDC38 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CDC3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CDC40 */ _t254 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CDC3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CDC40 */ _t254 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CDC40 */ _t255 = _t254 & 0x00000001u;
         /* 021CDC40 */ if (_t255) goto L_021CDD18; else goto L_021CDC44;
   L_021CDC44: ; // 0x21cdc44
@@ -34912,11 +34912,11 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CDC70 */ /* nop */
         /* 021CDC74 */ cpu->f[28] = cpu->f[28] + cpu->f[10];
         /* 021CDC78 */ cpu->r[12] = cpu->r[12] + 0xFFFFFFFFu;
-        /* 021CDC78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021CDC78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021CDC7C */ /* nop */
         /* 021CDC80 */ cpu->r[31] = cpu->r[31] + 0x0000000Cu;
         /* 021CDC84 */ cpu->f[13] = cpu->f[28];
-        /* 021CDC88 */ _t264 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CDC88 */ _t264 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CDC88 */ _t265 = _t264 & 0x00000001u;
         /* 021CDC88 */ if (_t265) goto L_021CDC94; else goto L_021CDC8C;
   L_021CDC8C: ; // 0x21cdc8c
@@ -34973,8 +34973,8 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CDD20 */ cpu->r[3] = cpu->r[30];
         /* 021CDD24 */ cpu->r[4] = cpu->r[30] + 0x00000168u;
         /* 021CDD28 */ Gambit_fn_021C2564(cpu);
-        /* 021CDD2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021CDD30 */ _t277 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CDD2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021CDD30 */ _t277 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CDD30 */ _t278 = _t277 & 0x00000001u;
         /* 021CDD30 */ if (_t278) goto L_021CE19C; else goto L_021CDD34;
   L_021CDD34: ; // 0x21cdd34
@@ -34985,23 +34985,23 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CDD3C */ cpu->ctr = cpu->r[11];
         /* 021CDD40 */ cpu->r[3] = cpu->r[30];
         /* 021CDD44 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CDD48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CDD4C */ _t281 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CDD48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CDD4C */ _t281 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CDD4C */ _t282 = _t281 & 0x00000001u;
         /* 021CDD4C */ if (_t282) goto L_021CDD50; else goto L_021CE19C;
   L_021CDD50: ; // 0x21cdd50
         /* 021CDD50 */ _t283 = cpu->r[1] + 0x00000068u;
         /* 021CDD50 */ cpu->r[11] = rbrew_read32(cpu->mem, _t283);
-        /* 021CDD54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021CDD58 */ _t284 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CDD54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021CDD58 */ _t284 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CDD58 */ _t285 = _t284 & 0x00000001u;
         /* 021CDD58 */ if (_t285) goto L_021CE0A8; else goto L_021CDD5C;
   L_021CDD5C: ; // 0x21cdd5c
         /* 021CDD5C */ _t286 = cpu->r[11] + 0x00000000u;
         /* 021CDD5C */ cpu->r[5] = rbrew_read32(cpu->mem, _t286);
         /* 021CDD60 */ cpu->r[4] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021CDD60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 021CDD64 */ _t287 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CDD60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 021CDD64 */ _t287 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CDD64 */ _t288 = _t287 & 0x00000001u;
         /* 021CDD64 */ if (_t288) goto L_021CDEFC; else goto L_021CDD68;
   L_021CDD68: ; // 0x21cdd68
@@ -35080,8 +35080,8 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CDE18 */ _t317 = cpu->r[11] + 0x00000000u;
         /* 021CDE18 */ cpu->r[0] = rbrew_read32(cpu->mem, _t317);
         /* 021CDE1C */ cpu->r[7] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021CDE1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021CDE20 */ _t318 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CDE1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021CDE20 */ _t318 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CDE20 */ _t319 = _t318 & 0x00000001u;
         /* 021CDE20 */ if (_t319) goto L_021CDE24; else goto L_021CDF6C;
   L_021CDE24: ; // 0x21cde24
@@ -35174,8 +35174,8 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CDEE8 */ rbrew_write_f32(cpu->mem, _t356, cpu->f[10]);
         /* 021CDEEC */ _t357 = cpu->r[30] + 0x0000001Cu;
         /* 021CDEEC */ cpu->r[10] = rbrew_read32(cpu->mem, _t357);
-        /* 021CDEF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
-        /* 021CDEF4 */ _t358 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CDEF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
+        /* 021CDEF4 */ _t358 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CDEF4 */ _t359 = _t358 & 0x00000001u;
         /* 021CDEF4 */ if (_t359) goto L_021CE168; else goto L_021CDEF8;
   L_021CDEF8: ; // 0x21cdef8
@@ -35230,8 +35230,8 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CDF60 */ _t381 = cpu->r[11] + 0x00000000u;
         /* 021CDF60 */ cpu->r[0] = rbrew_read32(cpu->mem, _t381);
         /* 021CDF64 */ cpu->r[7] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021CDF64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021CDF68 */ _t382 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CDF64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021CDF68 */ _t382 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CDF68 */ _t383 = _t382 & 0x00000001u;
         /* 021CDF68 */ if (_t383) goto L_021CDE24; else goto L_021CDF6C;
   L_021CDF6C: ; // 0x21cdf6c
@@ -35362,8 +35362,8 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CE094 */ rbrew_write_f32(cpu->mem, _t433, cpu->f[10]);
         /* 021CE098 */ _t434 = cpu->r[30] + 0x0000001Cu;
         /* 021CE098 */ cpu->r[10] = rbrew_read32(cpu->mem, _t434);
-        /* 021CE09C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
-        /* 021CE0A0 */ _t435 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE09C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
+        /* 021CE0A0 */ _t435 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE0A0 */ _t436 = _t435 & 0x00000001u;
         /* 021CE0A0 */ if (_t436) goto L_021CE168; else goto L_021CE0A4;
   L_021CE0A4: ; // 0x21ce0a4
@@ -35448,13 +35448,13 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CE150 */ rbrew_write_f32(cpu->mem, _t470, cpu->f[10]);
         /* 021CE154 */ _t471 = cpu->r[30] + 0x0000001Cu;
         /* 021CE154 */ cpu->r[10] = rbrew_read32(cpu->mem, _t471);
-        /* 021CE158 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
-        /* 021CE15C */ _t472 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
+        /* 021CE15C */ _t472 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE15C */ _t473 = _t472 & 0x00000001u;
         /* 021CE15C */ if (_t473) goto L_021CE168; else goto L_021CE160;
   L_021CE160: ; // 0x21ce160
-        /* 021CE160 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000003u);
-        /* 021CE164 */ _t474 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE160 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000003u));
+        /* 021CE164 */ _t474 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE164 */ _t475 = _t474 & 0x00000001u;
         /* 021CE164 */ if (_t475) goto L_021CE168; else goto L_021CE19C;
   L_021CE168: ; // 0x21ce168
@@ -35465,8 +35465,8 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CE170 */ cpu->ctr = cpu->r[6];
         /* 021CE174 */ cpu->r[3] = cpu->r[30];
         /* 021CE178 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CE17C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CE180 */ _t478 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE17C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CE180 */ _t478 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE180 */ _t479 = _t478 & 0x00000001u;
         /* 021CE180 */ if (_t479) goto L_021CE184; else goto L_021CE19C;
   L_021CE184: ; // 0x21ce184
@@ -35483,10 +35483,10 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CE19C */ cpu->r[12] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t482);
         /* 021CE1A0 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
         /* 021CE1A4 */ /* nop */
-        /* 021CE1A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000708u);
+        /* 021CE1A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000708u));
         /* 021CE1AC */ _t483 = cpu->r[30] + 0x00000240u;
         /* 021CE1AC */ rbrew_write16(cpu->mem, _t483, (uint16_t)cpu->r[12]);
-        /* 021CE1B0 */ _t484 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CE1B0 */ _t484 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CE1B0 */ _t485 = _t484 & 0x00000001u;
         /* 021CE1B0 */ if (_t485) goto L_021CE1B4; else goto L_021CE1BC;
   L_021CE1B4: ; // 0x21ce1b4
@@ -35510,7 +35510,7 @@ void Gambit_fn_021CD5B0(CPUState* cpu) {
         /* 021CE1D8 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t492);
         /* 021CE1DC */ _t493 = cpu->r[1] + 0x00000188u;
         /* 021CE1DC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t493);
-        /* 021CE1E0 */ _t494 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CE1E0 */ _t494 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CE1E0 */ _t495 = _t494 & 0x00000001u;
         /* 021CE1E0 */ if (_t495) goto L_021CE1E4; // else: addr-0 trap, fall-through
   L_021CE1E4: ; // 0x21ce1e4
@@ -35596,18 +35596,18 @@ void Gambit_fn_021CE22C(CPUState* cpu) {
         /* 021CE240 */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
         /* 021CE244 */ _t4 = cpu->r[31] + 0x0000002Cu;
         /* 021CE244 */ cpu->r[11] = rbrew_read32(cpu->mem, _t4);
-        /* 021CE248 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[11]);
-        /* 021CE24C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE248 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[11]));
+        /* 021CE24C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE24C */ _t6 = _t5 & 0x00000001u;
         /* 021CE24C */ if (_t6) goto L_021CE2FC; else goto L_021CE250;
   L_021CE250: ; // 0x21ce250
-        /* 021CE250 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x0000000Bu);
-        /* 021CE254 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE250 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x0000000Bu));
+        /* 021CE254 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE254 */ _t8 = _t7 & 0x00000001u;
         /* 021CE254 */ if (_t8) goto L_021CE2FC; else goto L_021CE258;
   L_021CE258: ; // 0x21ce258
-        /* 021CE258 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x0000000Fu);
-        /* 021CE25C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE258 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x0000000Fu));
+        /* 021CE25C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE25C */ _t10 = _t9 & 0x00000001u;
         /* 021CE25C */ if (_t10) goto L_021CE2FC; else goto L_021CE260;
   L_021CE260: ; // 0x21ce260
@@ -35625,10 +35625,10 @@ void Gambit_fn_021CE22C(CPUState* cpu) {
         /* 021CE278 */ rbrew_write32(cpu->mem, _t15, cpu->r[10]);
         /* 021CE27C */ _t16 = cpu->r[1] + 0x0000000Cu;
         /* 021CE27C */ rbrew_write32(cpu->mem, _t16, cpu->r[12]);
-        /* 021CE280 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021CE280 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021CE284 */ _t17 = cpu->r[1] + 0x00000010u;
         /* 021CE284 */ rbrew_write32(cpu->mem, _t17, cpu->r[0]);
-        /* 021CE288 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE288 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE288 */ _t19 = _t18 & 0x00000001u;
         /* 021CE288 */ if (_t19) goto L_021CE2B4; else goto L_021CE28C;
   L_021CE28C: ; // 0x21ce28c
@@ -35653,13 +35653,13 @@ void Gambit_fn_021CE22C(CPUState* cpu) {
   L_021CE2B4: ; // 0x21ce2b4
         /* 021CE2B4 */ _t28 = cpu->r[31] + 0x0000001Cu;
         /* 021CE2B4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t28);
-        /* 021CE2B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021CE2BC */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE2B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021CE2BC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE2BC */ _t30 = _t29 & 0x00000001u;
         /* 021CE2BC */ if (_t30) goto L_021CE2C8; else goto L_021CE2C0;
   L_021CE2C0: ; // 0x21ce2c0
-        /* 021CE2C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021CE2C4 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE2C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021CE2C4 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE2C4 */ _t32 = _t31 & 0x00000001u;
         /* 021CE2C4 */ if (_t32) goto L_021CE2C8; else goto L_021CE2FC;
   L_021CE2C8: ; // 0x21ce2c8
@@ -35670,8 +35670,8 @@ void Gambit_fn_021CE22C(CPUState* cpu) {
         /* 021CE2D0 */ cpu->ctr = cpu->r[0];
         /* 021CE2D4 */ cpu->r[3] = cpu->r[31];
         /* 021CE2D8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CE2DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CE2E0 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE2DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CE2E0 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE2E0 */ _t36 = _t35 & 0x00000001u;
         /* 021CE2E0 */ if (_t36) goto L_021CE2E4; else goto L_021CE2FC;
   L_021CE2E4: ; // 0x21ce2e4
@@ -35710,18 +35710,18 @@ void Gambit_fn_021CE230(CPUState* cpu) {
         /* 021CE240 */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
         /* 021CE244 */ _t4 = cpu->r[31] + 0x0000002Cu;
         /* 021CE244 */ cpu->r[11] = rbrew_read32(cpu->mem, _t4);
-        /* 021CE248 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[11]);
-        /* 021CE24C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE248 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[11]));
+        /* 021CE24C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE24C */ _t6 = _t5 & 0x00000001u;
         /* 021CE24C */ if (_t6) goto L_021CE2FC; else goto L_021CE250;
   L_021CE250: ; // 0x21ce250
-        /* 021CE250 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x0000000Bu);
-        /* 021CE254 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE250 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x0000000Bu));
+        /* 021CE254 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE254 */ _t8 = _t7 & 0x00000001u;
         /* 021CE254 */ if (_t8) goto L_021CE2FC; else goto L_021CE258;
   L_021CE258: ; // 0x21ce258
-        /* 021CE258 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x0000000Fu);
-        /* 021CE25C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE258 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x0000000Fu));
+        /* 021CE25C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE25C */ _t10 = _t9 & 0x00000001u;
         /* 021CE25C */ if (_t10) goto L_021CE2FC; else goto L_021CE260;
   L_021CE260: ; // 0x21ce260
@@ -35739,10 +35739,10 @@ void Gambit_fn_021CE230(CPUState* cpu) {
         /* 021CE278 */ rbrew_write32(cpu->mem, _t15, cpu->r[10]);
         /* 021CE27C */ _t16 = cpu->r[1] + 0x0000000Cu;
         /* 021CE27C */ rbrew_write32(cpu->mem, _t16, cpu->r[12]);
-        /* 021CE280 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021CE280 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021CE284 */ _t17 = cpu->r[1] + 0x00000010u;
         /* 021CE284 */ rbrew_write32(cpu->mem, _t17, cpu->r[0]);
-        /* 021CE288 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE288 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE288 */ _t19 = _t18 & 0x00000001u;
         /* 021CE288 */ if (_t19) goto L_021CE2B4; else goto L_021CE28C;
   L_021CE28C: ; // 0x21ce28c
@@ -35767,13 +35767,13 @@ void Gambit_fn_021CE230(CPUState* cpu) {
   L_021CE2B4: ; // 0x21ce2b4
         /* 021CE2B4 */ _t28 = cpu->r[31] + 0x0000001Cu;
         /* 021CE2B4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t28);
-        /* 021CE2B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021CE2BC */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE2B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021CE2BC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE2BC */ _t30 = _t29 & 0x00000001u;
         /* 021CE2BC */ if (_t30) goto L_021CE2C8; else goto L_021CE2C0;
   L_021CE2C0: ; // 0x21ce2c0
-        /* 021CE2C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021CE2C4 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE2C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021CE2C4 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE2C4 */ _t32 = _t31 & 0x00000001u;
         /* 021CE2C4 */ if (_t32) goto L_021CE2C8; else goto L_021CE2FC;
   L_021CE2C8: ; // 0x21ce2c8
@@ -35784,8 +35784,8 @@ void Gambit_fn_021CE230(CPUState* cpu) {
         /* 021CE2D0 */ cpu->ctr = cpu->r[0];
         /* 021CE2D4 */ cpu->r[3] = cpu->r[31];
         /* 021CE2D8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CE2DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CE2E0 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE2DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CE2E0 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE2E0 */ _t36 = _t35 & 0x00000001u;
         /* 021CE2E0 */ if (_t36) goto L_021CE2E4; else goto L_021CE2FC;
   L_021CE2E4: ; // 0x21ce2e4
@@ -35829,8 +35829,8 @@ void Gambit_fn_021CE314(CPUState* cpu) {
   L_021CE314: ; // 0x21ce314
         /* 021CE314 */ _t0 = cpu->r[3] + 0x00000242u;
         /* 021CE314 */ cpu->r[0] = rbrew_read8(cpu->mem, _t0);
-        /* 021CE318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021CE31C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021CE31C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE31C */ _t2 = _t1 & 0x00000001u;
         /* 021CE31C */ if (_t2) goto L_021CE32C; else goto L_021CE320;
   L_021CE320: ; // 0x21ce320
@@ -35868,14 +35868,14 @@ void Gambit_fn_021CE33C(CPUState* cpu) {
         /* 021CE358 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 021CE35C */ _t6 = cpu->r[3] + 0x0000002Cu;
         /* 021CE35C */ cpu->r[12] = rbrew_read32(cpu->mem, _t6);
-        /* 021CE360 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
+        /* 021CE360 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
         /* 021CE364 */ cpu->r[31] = cpu->r[4];
-        /* 021CE368 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE368 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE368 */ _t8 = _t7 & 0x00000001u;
         /* 021CE368 */ if (_t8) goto L_021CE36C; else goto L_021CE3D8;
   L_021CE36C: ; // 0x21ce36c
-        /* 021CE36C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x0000000Au);
-        /* 021CE370 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE36C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x0000000Au));
+        /* 021CE370 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE370 */ _t10 = _t9 & 0x00000001u;
         /* 021CE370 */ if (_t10) goto L_021CE374; else goto L_021CE3B0;
   L_021CE374: ; // 0x21ce374
@@ -35895,7 +35895,7 @@ void Gambit_fn_021CE33C(CPUState* cpu) {
         /* 021CE394 */ _t16 = cpu->r[1] + 0x00000010u;
         /* 021CE394 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t16);
         /* 021CE398 */ cpu->f[1] = cpu->f[1] * cpu->f[0];
-        /* 021CE39C */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CE39C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CE39C */ _t18 = _t17 & 0x00000001u;
         /* 021CE39C */ if (_t18) goto L_021CE3A0; // else: addr-0 trap, fall-through
   L_021CE3A0: ; // 0x21ce3a0
@@ -35914,7 +35914,7 @@ void Gambit_fn_021CE33C(CPUState* cpu) {
         /* 021CE3BC */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t22);
         /* 021CE3C0 */ _t23 = cpu->r[1] + 0x00000010u;
         /* 021CE3C0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t23);
-        /* 021CE3C4 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CE3C4 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CE3C4 */ _t25 = _t24 & 0x00000001u;
         /* 021CE3C4 */ if (_t25) goto L_021CE3C8; // else: addr-0 trap, fall-through
   L_021CE3C8: ; // 0x21ce3c8
@@ -35933,8 +35933,8 @@ void Gambit_fn_021CE33C(CPUState* cpu) {
         /* 021CE3E8 */ cpu->r[3] = cpu->r[31];
         /* 021CE3EC */ cpu->f[31] = cpu->f[1];
         /* 021CE3F0 */ Gambit_fn_021BCFBC(cpu);
-        /* 021CE3F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CE3F8 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE3F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CE3F8 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE3F8 */ _t30 = _t29 & 0x00000001u;
         /* 021CE3F8 */ if (_t30) goto L_021CE400; else goto L_021CE3FC;
   L_021CE3FC: ; // 0x21ce3fc
@@ -35947,7 +35947,7 @@ void Gambit_fn_021CE33C(CPUState* cpu) {
         /* 021CE408 */ cpu->r[31] = rbrew_read32(cpu->mem, _t32);
         /* 021CE40C */ _t33 = cpu->r[1] + 0x00000010u;
         /* 021CE40C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t33);
-        /* 021CE410 */ _t34 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CE410 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CE410 */ _t35 = _t34 & 0x00000001u;
         /* 021CE410 */ if (_t35) goto L_021CE414; // else: addr-0 trap, fall-through
   L_021CE414: ; // 0x21ce414
@@ -35979,14 +35979,14 @@ void Gambit_fn_021CE340(CPUState* cpu) {
         /* 021CE358 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 021CE35C */ _t6 = cpu->r[3] + 0x0000002Cu;
         /* 021CE35C */ cpu->r[12] = rbrew_read32(cpu->mem, _t6);
-        /* 021CE360 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
+        /* 021CE360 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
         /* 021CE364 */ cpu->r[31] = cpu->r[4];
-        /* 021CE368 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE368 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE368 */ _t8 = _t7 & 0x00000001u;
         /* 021CE368 */ if (_t8) goto L_021CE36C; else goto L_021CE3D8;
   L_021CE36C: ; // 0x21ce36c
-        /* 021CE36C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x0000000Au);
-        /* 021CE370 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE36C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x0000000Au));
+        /* 021CE370 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE370 */ _t10 = _t9 & 0x00000001u;
         /* 021CE370 */ if (_t10) goto L_021CE374; else goto L_021CE3B0;
   L_021CE374: ; // 0x21ce374
@@ -36006,7 +36006,7 @@ void Gambit_fn_021CE340(CPUState* cpu) {
         /* 021CE394 */ _t16 = cpu->r[1] + 0x00000010u;
         /* 021CE394 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t16);
         /* 021CE398 */ cpu->f[1] = cpu->f[1] * cpu->f[0];
-        /* 021CE39C */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CE39C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CE39C */ _t18 = _t17 & 0x00000001u;
         /* 021CE39C */ if (_t18) goto L_021CE3A0; // else: addr-0 trap, fall-through
   L_021CE3A0: ; // 0x21ce3a0
@@ -36025,7 +36025,7 @@ void Gambit_fn_021CE340(CPUState* cpu) {
         /* 021CE3BC */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t22);
         /* 021CE3C0 */ _t23 = cpu->r[1] + 0x00000010u;
         /* 021CE3C0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t23);
-        /* 021CE3C4 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CE3C4 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CE3C4 */ _t25 = _t24 & 0x00000001u;
         /* 021CE3C4 */ if (_t25) goto L_021CE3C8; // else: addr-0 trap, fall-through
   L_021CE3C8: ; // 0x21ce3c8
@@ -36044,8 +36044,8 @@ void Gambit_fn_021CE340(CPUState* cpu) {
         /* 021CE3E8 */ cpu->r[3] = cpu->r[31];
         /* 021CE3EC */ cpu->f[31] = cpu->f[1];
         /* 021CE3F0 */ Gambit_fn_021BCFBC(cpu);
-        /* 021CE3F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CE3F8 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE3F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CE3F8 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE3F8 */ _t30 = _t29 & 0x00000001u;
         /* 021CE3F8 */ if (_t30) goto L_021CE400; else goto L_021CE3FC;
   L_021CE3FC: ; // 0x21ce3fc
@@ -36058,7 +36058,7 @@ void Gambit_fn_021CE340(CPUState* cpu) {
         /* 021CE408 */ cpu->r[31] = rbrew_read32(cpu->mem, _t32);
         /* 021CE40C */ _t33 = cpu->r[1] + 0x00000010u;
         /* 021CE40C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t33);
-        /* 021CE410 */ _t34 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CE410 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CE410 */ _t35 = _t34 & 0x00000001u;
         /* 021CE410 */ if (_t35) goto L_021CE414; // else: addr-0 trap, fall-through
   L_021CE414: ; // 0x21ce414
@@ -136,8 +136,8 @@ void Gambit_fn_021CE424(CPUState* cpu) {
         /* 021C238C */ cpu->r[11] = 0x10030000u;
         /* 021C2390 */ _t42 = cpu->r[11] + 0xFFFFB6D4u;
         /* 021C2390 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t42);
-        /* 021C2394 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
-        /* 021C2398 */ _t43 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C2394 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
+        /* 021C2398 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C2398 */ _t44 = _t43 & 0x00000001u;
         /* 021C2398 */ if (_t44) goto L_021C239C; else goto L_021C23A0;
   L_021C239C: ; // 0x21c239c
@@ -164,8 +164,8 @@ void Gambit_fn_021CE424(CPUState* cpu) {
   L_021CE424: ; // 0x21ce424
         /* 021CE424 */ _t49 = cpu->r[3] + 0x00000243u;
         /* 021CE424 */ cpu->r[0] = rbrew_read8(cpu->mem, _t49);
-        /* 021CE428 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021CE42C */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE428 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021CE42C */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE42C */ _t51 = _t50 & 0x00000001u;
         /* 021CE42C */ _t52 = _t51 ^ 0x00000001u;
         /* 021CE42C */ if (_t52) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -182,7 +182,7 @@ void Gambit_fn_021CE440(CPUState* cpu) {
         /* 021CE440 */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 021CE440 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 021CE440 */ cpu->r[1] = _t0;
-        /* 021CE444 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE444 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE444 */ _t2 = _t1 & 0x00000001u;
         /* 021CE444 */ if (_t2) goto L_021CE448; else goto L_021CE450;
   L_021CE448: ; // 0x21ce448
@@ -234,8 +234,8 @@ void Gambit_fn_021CE474(CPUState* cpu) {
         /* 021CE474 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021CE474 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021CE478 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021CE478 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021CE47C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE478 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021CE47C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE47C */ _t2 = _t1 & 0x00000001u;
         /* 021CE47C */ _t3 = _t2 ^ 0x00000001u;
         /* 021CE47C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -257,8 +257,8 @@ void Gambit_fn_021CE490(CPUState* cpu) {
         /* 021CE490 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021CE490 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021CE494 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021CE494 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021CE498 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE494 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021CE498 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE498 */ _t2 = _t1 & 0x00000001u;
         /* 021CE498 */ _t3 = _t2 ^ 0x00000001u;
         /* 021CE498 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -280,8 +280,8 @@ void Gambit_fn_021CE4AC(CPUState* cpu) {
         /* 021CE4AC */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021CE4AC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021CE4B0 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021CE4B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021CE4B4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE4B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021CE4B4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE4B4 */ _t2 = _t1 & 0x00000001u;
         /* 021CE4B4 */ _t3 = _t2 ^ 0x00000001u;
         /* 021CE4B4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -324,8 +324,8 @@ void Gambit_fn_021CE4D8(CPUState* cpu) {
         /* 021CE4E8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021CE4EC */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021CE4EC */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021CE4F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021CE4F4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE4F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021CE4F4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE4F4 */ _t5 = _t4 & 0x00000001u;
         /* 021CE4F4 */ if (_t5) goto L_021CE4F8; else goto L_021CE514;
   L_021CE4F8: ; // 0x21ce4f8
@@ -364,8 +364,8 @@ void Gambit_fn_021CE4DC(CPUState* cpu) {
         /* 021CE4E8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021CE4EC */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021CE4EC */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021CE4F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021CE4F4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE4F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021CE4F4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE4F4 */ _t5 = _t4 & 0x00000001u;
         /* 021CE4F4 */ if (_t5) goto L_021CE4F8; else goto L_021CE514;
   L_021CE4F8: ; // 0x21ce4f8
@@ -734,13 +734,13 @@ void Gambit_fn_021CE678(CPUState* cpu) {
         /* 021CE688 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021CE68C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021CE68C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021CE690 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021CE694 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE690 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021CE694 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE694 */ _t5 = _t4 & 0x00000001u;
         /* 021CE694 */ if (_t5) goto L_021CE6A0; else goto L_021CE698;
   L_021CE698: ; // 0x21ce698
-        /* 021CE698 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021CE69C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE698 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021CE69C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE69C */ _t7 = _t6 & 0x00000001u;
         /* 021CE69C */ if (_t7) goto L_021CE6A0; else goto L_021CE6D8;
   L_021CE6A0: ; // 0x21ce6a0
@@ -751,8 +751,8 @@ void Gambit_fn_021CE678(CPUState* cpu) {
         /* 021CE6A8 */ cpu->ctr = cpu->r[0];
         /* 021CE6AC */ cpu->r[3] = cpu->r[31];
         /* 021CE6B0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CE6B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CE6B8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE6B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CE6B8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE6B8 */ _t11 = _t10 & 0x00000001u;
         /* 021CE6B8 */ if (_t11) goto L_021CE6BC; else goto L_021CE6D8;
   L_021CE6BC: ; // 0x21ce6bc
@@ -790,13 +790,13 @@ void Gambit_fn_021CE67C(CPUState* cpu) {
         /* 021CE688 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021CE68C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021CE68C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021CE690 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021CE694 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE690 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021CE694 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE694 */ _t5 = _t4 & 0x00000001u;
         /* 021CE694 */ if (_t5) goto L_021CE6A0; else goto L_021CE698;
   L_021CE698: ; // 0x21ce698
-        /* 021CE698 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021CE69C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE698 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021CE69C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE69C */ _t7 = _t6 & 0x00000001u;
         /* 021CE69C */ if (_t7) goto L_021CE6A0; else goto L_021CE6D8;
   L_021CE6A0: ; // 0x21ce6a0
@@ -807,8 +807,8 @@ void Gambit_fn_021CE67C(CPUState* cpu) {
         /* 021CE6A8 */ cpu->ctr = cpu->r[0];
         /* 021CE6AC */ cpu->r[3] = cpu->r[31];
         /* 021CE6B0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CE6B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CE6B8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE6B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CE6B8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE6B8 */ _t11 = _t10 & 0x00000001u;
         /* 021CE6B8 */ if (_t11) goto L_021CE6BC; else goto L_021CE6D8;
   L_021CE6BC: ; // 0x21ce6bc
@@ -847,10 +847,10 @@ void Gambit_fn_021CE6F8(CPUState* cpu) {
         /* 021CE6F8 */ cpu->r[10] = 0x101D0000u;
         /* 021CE6FC */ _t0 = cpu->r[10] + 0xFFFFFB6Cu;
         /* 021CE6FC */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 021CE700 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021CE700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021CE704 */ cpu->r[10] = 0x101D0000u;
         /* 021CE708 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBC8u;
-        /* 021CE70C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE70C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE70C */ _t2 = _t1 & 0x00000001u;
         /* 021CE70C */ if (_t2) goto L_021CE710; else goto L_021CE728;
   L_021CE710: ; // 0x21ce710
@@ -863,8 +863,8 @@ void Gambit_fn_021CE6F8(CPUState* cpu) {
         /* 021CE724 */ _t4 = cpu->r[10] + 0x00000000u;
         /* 021CE724 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_021CE728: ; // 0x21ce728
-        /* 021CE728 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021CE72C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021CE72C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE72C */ _t6 = _t5 & 0x00000001u;
         /* 021CE72C */ if (_t6) goto L_021CE730; else goto L_021CE738;
   L_021CE730: ; // 0x21ce730
@@ -875,9 +875,9 @@ void Gambit_fn_021CE6F8(CPUState* cpu) {
         /* 021CE73C */ _t7 = cpu->r[9] + 0xFFFFE5E4u;
         /* 021CE73C */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 021CE740 */ cpu->r[11] = 0x101D0000u;
-        /* 021CE744 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021CE744 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021CE748 */ cpu->r[11] = cpu->r[11] + 0xFFFFFB60u;
-        /* 021CE74C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE74C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE74C */ _t9 = _t8 & 0x00000001u;
         /* 021CE74C */ if (_t9) goto L_021CE750; else goto L_021CE768;
   L_021CE750: ; // 0x21ce750
@@ -890,8 +890,8 @@ void Gambit_fn_021CE6F8(CPUState* cpu) {
         /* 021CE764 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021CE764 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021CE768: ; // 0x21ce768
-        /* 021CE768 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021CE76C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021CE76C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE76C */ _t13 = _t12 & 0x00000001u;
         /* 021CE76C */ if (_t13) goto L_021CE770; else goto L_021CE778;
   L_021CE770: ; // 0x21ce770
@@ -902,9 +902,9 @@ void Gambit_fn_021CE6F8(CPUState* cpu) {
         /* 021CE77C */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021CE77C */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 021CE780 */ cpu->r[9] = 0x101D0000u;
-        /* 021CE784 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021CE784 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021CE788 */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 021CE78C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE78C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE78C */ _t16 = _t15 & 0x00000001u;
         /* 021CE78C */ if (_t16) goto L_021CE790; else goto L_021CE7A8;
   L_021CE790: ; // 0x21ce790
@@ -917,8 +917,8 @@ void Gambit_fn_021CE6F8(CPUState* cpu) {
         /* 021CE7A4 */ _t18 = cpu->r[9] + 0x00000000u;
         /* 021CE7A4 */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_021CE7A8: ; // 0x21ce7a8
-        /* 021CE7A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 021CE7AC */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE7A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 021CE7AC */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE7AC */ _t20 = _t19 & 0x00000001u;
         /* 021CE7AC */ if (_t20) goto L_021CE7B0; else goto L_021CE7B8;
   L_021CE7B0: ; // 0x21ce7b0
@@ -930,9 +930,9 @@ void Gambit_fn_021CE6F8(CPUState* cpu) {
         /* 021CE7BC */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 021CE7BC */ cpu->r[9] = _t21;
         /* 021CE7C0 */ cpu->r[10] = 0x101D0000u;
-        /* 021CE7C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021CE7C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021CE7C8 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021CE7CC */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE7CC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE7CC */ _t23 = _t22 & 0x00000001u;
         /* 021CE7CC */ if (_t23) goto L_021CE7D0; else goto L_021CE7E4;
   L_021CE7D0: ; // 0x21ce7d0
@@ -944,8 +944,8 @@ void Gambit_fn_021CE6F8(CPUState* cpu) {
         /* 021CE7E0 */ _t25 = cpu->r[10] + 0x00000000u;
         /* 021CE7E0 */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_021CE7E4: ; // 0x21ce7e4
-        /* 021CE7E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021CE7E8 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE7E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021CE7E8 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE7E8 */ _t27 = _t26 & 0x00000001u;
         /* 021CE7E8 */ if (_t27) goto L_021CE7EC; else goto L_021CE7F4;
   L_021CE7EC: ; // 0x21ce7ec
@@ -957,9 +957,9 @@ void Gambit_fn_021CE6F8(CPUState* cpu) {
         /* 021CE7F8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 021CE7F8 */ cpu->r[10] = _t28;
         /* 021CE7FC */ cpu->r[11] = 0x101D0000u;
-        /* 021CE800 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021CE800 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021CE804 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021CE808 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CE808 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CE808 */ _t30 = _t29 & 0x00000001u;
         /* 021CE808 */ if (_t30) goto L_021CE80C; else goto L_021CE820;
   L_021CE80C: ; // 0x21ce80c
@@ -1650,18 +1650,18 @@ void Gambit_fn_021CEB08(CPUState* cpu) {
         /* 021CEB10 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021CEB10 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021CEB14 */ cpu->r[31] = cpu->r[3];
-        /* 021CEB14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021CEB14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021CEB18 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021CEB18 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021CEB1C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CEB1C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CEB1C */ _t4 = _t3 & 0x00000001u;
         /* 021CEB1C */ if (_t4) goto L_021CEB20; else goto L_021CEB30;
   L_021CEB20: ; // 0x21ceb20
         /* 021CEB20 */ cpu->r[3] = 0x0000024Cu;
         /* 021CEB24 */ Gambit_fn_02801A78(cpu);
         /* 021CEB28 */ cpu->r[31] = cpu->r[3];
-        /* 021CEB28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021CEB2C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CEB28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021CEB2C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CEB2C */ _t6 = _t5 & 0x00000001u;
         /* 021CEB2C */ if (_t6) goto L_021CEB4C; else goto L_021CEB30;
   L_021CEB30: ; // 0x21ceb30
@@ -1696,18 +1696,18 @@ void Gambit_fn_021CEB0C(CPUState* cpu) {
         /* 021CEB10 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021CEB10 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021CEB14 */ cpu->r[31] = cpu->r[3];
-        /* 021CEB14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021CEB14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021CEB18 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021CEB18 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021CEB1C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CEB1C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CEB1C */ _t4 = _t3 & 0x00000001u;
         /* 021CEB1C */ if (_t4) goto L_021CEB20; else goto L_021CEB30;
   L_021CEB20: ; // 0x21ceb20
         /* 021CEB20 */ cpu->r[3] = 0x0000024Cu;
         /* 021CEB24 */ Gambit_fn_02801A78(cpu);
         /* 021CEB28 */ cpu->r[31] = cpu->r[3];
-        /* 021CEB28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021CEB2C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CEB28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021CEB2C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CEB2C */ _t6 = _t5 & 0x00000001u;
         /* 021CEB2C */ if (_t6) goto L_021CEB4C; else goto L_021CEB30;
   L_021CEB30: ; // 0x21ceb30
@@ -1747,21 +1747,21 @@ void Gambit_fn_021CEB64(CPUState* cpu) {
         /* 021CEB78 */ _t2 = cpu->r[1] + 0x00000024u;
         /* 021CEB78 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021CEB7C */ Gambit_fn_0203092C(cpu);
-        /* 021CEB80 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], 0x00000001u);
-        /* 021CEB84 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CEB80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], 0x00000001u));
+        /* 021CEB84 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CEB84 */ _t4 = _t3 & 0x00000001u;
         /* 021CEB84 */ if (_t4) goto L_021CEBB4; else goto L_021CEB88;
   L_021CEB88: ; // 0x21ceb88
-        /* 021CEB88 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CEB88 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CEB88 */ _t6 = _t5 & 0x00000001u;
         /* 021CEB88 */ if (_t6) goto L_021CEBE8; else goto L_021CEB8C;
   L_021CEB8C: ; // 0x21ceb8c
-        /* 021CEB8C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], 0x00000003u);
-        /* 021CEB90 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CEB8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], 0x00000003u));
+        /* 021CEB90 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CEB90 */ _t8 = _t7 & 0x00000001u;
         /* 021CEB90 */ if (_t8) goto L_021CEC20; else goto L_021CEB94;
   L_021CEB94: ; // 0x21ceb94
-        /* 021CEB94 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CEB94 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CEB94 */ _t10 = _t9 & 0x00000001u;
         /* 021CEB94 */ if (_t10) goto L_021CEC58; else goto L_021CEB98;
   L_021CEB98: ; // 0x21ceb98
@@ -1770,9 +1770,9 @@ void Gambit_fn_021CEB64(CPUState* cpu) {
         /* 021CEB9C */ cpu->r[12] = 0x101C0000u;
         /* 021CEBA0 */ _t12 = cpu->r[12] + 0x00001838u;
         /* 021CEBA0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t12);
-        /* 021CEBA4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000014u);
+        /* 021CEBA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000014u));
         /* 021CEBA8 */ cpu->r[11] = cpu->r[12] + 0x000000B2u;
-        /* 021CEBAC */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CEBAC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CEBAC */ _t14 = _t13 & 0x00000001u;
         /* 021CEBAC */ if (_t14) goto L_021CEC8C; else goto L_021CEBB0;
   L_021CEBB0: ; // 0x21cebb0
@@ -1792,9 +1792,9 @@ void Gambit_fn_021CEB64(CPUState* cpu) {
         /* 021CEBD0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t18);
         /* 021CEBD4 */ _t19 = cpu->r[1] + 0x0000000Cu;
         /* 021CEBD4 */ rbrew_write32(cpu->mem, _t19, cpu->r[11]);
-        /* 021CEBD8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000014u);
+        /* 021CEBD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000014u));
         /* 021CEBDC */ cpu->r[11] = cpu->r[12] + 0x000000B2u;
-        /* 021CEBE0 */ _t20 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CEBE0 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CEBE0 */ _t21 = _t20 & 0x00000001u;
         /* 021CEBE0 */ if (_t21) goto L_021CEBE4; else goto L_021CEC94;
   L_021CEBE4: ; // 0x21cebe4
@@ -1812,13 +1812,13 @@ void Gambit_fn_021CEB64(CPUState* cpu) {
         /* 021CEC00 */ cpu->r[12] = 0x101C0000u;
         /* 021CEC04 */ _t25 = cpu->r[3] + 0x00000004u;
         /* 021CEC04 */ cpu->r[0] = rbrew_read32(cpu->mem, _t25);
-        /* 021CEC08 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000014u);
+        /* 021CEC08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000014u));
         /* 021CEC0C */ _t26 = cpu->r[12] + 0x00001838u;
         /* 021CEC0C */ cpu->r[12] = rbrew_read32(cpu->mem, _t26);
         /* 021CEC10 */ _t27 = cpu->r[1] + 0x0000000Cu;
         /* 021CEC10 */ rbrew_write32(cpu->mem, _t27, cpu->r[0]);
         /* 021CEC14 */ cpu->r[11] = cpu->r[12] + 0x000000B2u;
-        /* 021CEC18 */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CEC18 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CEC18 */ _t29 = _t28 & 0x00000001u;
         /* 021CEC18 */ if (_t29) goto L_021CEC1C; else goto L_021CEC94;
   L_021CEC1C: ; // 0x21cec1c
@@ -1839,9 +1839,9 @@ void Gambit_fn_021CEB64(CPUState* cpu) {
         /* 021CEC40 */ _t34 = cpu->r[1] + 0x0000000Cu;
         /* 021CEC40 */ rbrew_write32(cpu->mem, _t34, cpu->r[10]);
         /* 021CEC44 */ cpu->r[10] = cpu->r[0];
-        /* 021CEC48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000014u);
+        /* 021CEC48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000014u));
         /* 021CEC4C */ cpu->r[11] = cpu->r[12] + 0x000000B2u;
-        /* 021CEC50 */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CEC50 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CEC50 */ _t36 = _t35 & 0x00000001u;
         /* 021CEC50 */ if (_t36) goto L_021CEC54; else goto L_021CEC94;
   L_021CEC54: ; // 0x21cec54
@@ -1859,13 +1859,13 @@ void Gambit_fn_021CEB64(CPUState* cpu) {
         /* 021CEC70 */ cpu->r[12] = 0x101C0000u;
         /* 021CEC74 */ _t40 = cpu->r[3] + 0x00000004u;
         /* 021CEC74 */ cpu->r[0] = rbrew_read32(cpu->mem, _t40);
-        /* 021CEC78 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000014u);
+        /* 021CEC78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000014u));
         /* 021CEC7C */ _t41 = cpu->r[12] + 0x00001838u;
         /* 021CEC7C */ cpu->r[12] = rbrew_read32(cpu->mem, _t41);
         /* 021CEC80 */ _t42 = cpu->r[1] + 0x0000000Cu;
         /* 021CEC80 */ rbrew_write32(cpu->mem, _t42, cpu->r[0]);
         /* 021CEC84 */ cpu->r[11] = cpu->r[12] + 0x000000B2u;
-        /* 021CEC88 */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CEC88 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CEC88 */ _t44 = _t43 & 0x00000001u;
         /* 021CEC88 */ if (_t44) goto L_021CEC8C; else goto L_021CEC94;
   L_021CEC8C: ; // 0x21cec8c
@@ -1898,21 +1898,21 @@ void Gambit_fn_021CEB68(CPUState* cpu) {
         /* 021CEB78 */ _t2 = cpu->r[1] + 0x00000024u;
         /* 021CEB78 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021CEB7C */ Gambit_fn_0203092C(cpu);
-        /* 021CEB80 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], 0x00000001u);
-        /* 021CEB84 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CEB80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], 0x00000001u));
+        /* 021CEB84 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CEB84 */ _t4 = _t3 & 0x00000001u;
         /* 021CEB84 */ if (_t4) goto L_021CEBB4; else goto L_021CEB88;
   L_021CEB88: ; // 0x21ceb88
-        /* 021CEB88 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CEB88 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CEB88 */ _t6 = _t5 & 0x00000001u;
         /* 021CEB88 */ if (_t6) goto L_021CEBE8; else goto L_021CEB8C;
   L_021CEB8C: ; // 0x21ceb8c
-        /* 021CEB8C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], 0x00000003u);
-        /* 021CEB90 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CEB8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], 0x00000003u));
+        /* 021CEB90 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CEB90 */ _t8 = _t7 & 0x00000001u;
         /* 021CEB90 */ if (_t8) goto L_021CEC20; else goto L_021CEB94;
   L_021CEB94: ; // 0x21ceb94
-        /* 021CEB94 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CEB94 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CEB94 */ _t10 = _t9 & 0x00000001u;
         /* 021CEB94 */ if (_t10) goto L_021CEC58; else goto L_021CEB98;
   L_021CEB98: ; // 0x21ceb98
@@ -1921,9 +1921,9 @@ void Gambit_fn_021CEB68(CPUState* cpu) {
         /* 021CEB9C */ cpu->r[12] = 0x101C0000u;
         /* 021CEBA0 */ _t12 = cpu->r[12] + 0x00001838u;
         /* 021CEBA0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t12);
-        /* 021CEBA4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000014u);
+        /* 021CEBA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000014u));
         /* 021CEBA8 */ cpu->r[11] = cpu->r[12] + 0x000000B2u;
-        /* 021CEBAC */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CEBAC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CEBAC */ _t14 = _t13 & 0x00000001u;
         /* 021CEBAC */ if (_t14) goto L_021CEC8C; else goto L_021CEBB0;
   L_021CEBB0: ; // 0x21cebb0
@@ -1943,9 +1943,9 @@ void Gambit_fn_021CEB68(CPUState* cpu) {
         /* 021CEBD0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t18);
         /* 021CEBD4 */ _t19 = cpu->r[1] + 0x0000000Cu;
         /* 021CEBD4 */ rbrew_write32(cpu->mem, _t19, cpu->r[11]);
-        /* 021CEBD8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000014u);
+        /* 021CEBD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000014u));
         /* 021CEBDC */ cpu->r[11] = cpu->r[12] + 0x000000B2u;
-        /* 021CEBE0 */ _t20 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CEBE0 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CEBE0 */ _t21 = _t20 & 0x00000001u;
         /* 021CEBE0 */ if (_t21) goto L_021CEBE4; else goto L_021CEC94;
   L_021CEBE4: ; // 0x21cebe4
@@ -1963,13 +1963,13 @@ void Gambit_fn_021CEB68(CPUState* cpu) {
         /* 021CEC00 */ cpu->r[12] = 0x101C0000u;
         /* 021CEC04 */ _t25 = cpu->r[3] + 0x00000004u;
         /* 021CEC04 */ cpu->r[0] = rbrew_read32(cpu->mem, _t25);
-        /* 021CEC08 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000014u);
+        /* 021CEC08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000014u));
         /* 021CEC0C */ _t26 = cpu->r[12] + 0x00001838u;
         /* 021CEC0C */ cpu->r[12] = rbrew_read32(cpu->mem, _t26);
         /* 021CEC10 */ _t27 = cpu->r[1] + 0x0000000Cu;
         /* 021CEC10 */ rbrew_write32(cpu->mem, _t27, cpu->r[0]);
         /* 021CEC14 */ cpu->r[11] = cpu->r[12] + 0x000000B2u;
-        /* 021CEC18 */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CEC18 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CEC18 */ _t29 = _t28 & 0x00000001u;
         /* 021CEC18 */ if (_t29) goto L_021CEC1C; else goto L_021CEC94;
   L_021CEC1C: ; // 0x21cec1c
@@ -1990,9 +1990,9 @@ void Gambit_fn_021CEB68(CPUState* cpu) {
         /* 021CEC40 */ _t34 = cpu->r[1] + 0x0000000Cu;
         /* 021CEC40 */ rbrew_write32(cpu->mem, _t34, cpu->r[10]);
         /* 021CEC44 */ cpu->r[10] = cpu->r[0];
-        /* 021CEC48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000014u);
+        /* 021CEC48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000014u));
         /* 021CEC4C */ cpu->r[11] = cpu->r[12] + 0x000000B2u;
-        /* 021CEC50 */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CEC50 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CEC50 */ _t36 = _t35 & 0x00000001u;
         /* 021CEC50 */ if (_t36) goto L_021CEC54; else goto L_021CEC94;
   L_021CEC54: ; // 0x21cec54
@@ -2010,13 +2010,13 @@ void Gambit_fn_021CEB68(CPUState* cpu) {
         /* 021CEC70 */ cpu->r[12] = 0x101C0000u;
         /* 021CEC74 */ _t40 = cpu->r[3] + 0x00000004u;
         /* 021CEC74 */ cpu->r[0] = rbrew_read32(cpu->mem, _t40);
-        /* 021CEC78 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000014u);
+        /* 021CEC78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000014u));
         /* 021CEC7C */ _t41 = cpu->r[12] + 0x00001838u;
         /* 021CEC7C */ cpu->r[12] = rbrew_read32(cpu->mem, _t41);
         /* 021CEC80 */ _t42 = cpu->r[1] + 0x0000000Cu;
         /* 021CEC80 */ rbrew_write32(cpu->mem, _t42, cpu->r[0]);
         /* 021CEC84 */ cpu->r[11] = cpu->r[12] + 0x000000B2u;
-        /* 021CEC88 */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CEC88 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CEC88 */ _t44 = _t43 & 0x00000001u;
         /* 021CEC88 */ if (_t44) goto L_021CEC8C; else goto L_021CEC94;
   L_021CEC8C: ; // 0x21cec8c
@@ -3236,15 +3236,15 @@ void Gambit_fn_021CF1AC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021CF1AC: ; // 0x21cf1ac
-        /* 021CF1AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CF1B0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF1AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CF1B0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF1B0 */ _t1 = _t0 & 0x00000001u;
         /* 021CF1B0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021CF1B0 */ goto L_021CF1B4;
   L_021CF1B4: ; // 0x21cf1b4
         /* 021CF1B4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021CF1B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021CF1B8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF1B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021CF1B8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF1B8 */ _t3 = _t2 & 0x00000001u;
         /* 021CF1B8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021CF1B8 */ goto L_021CF1BC;
@@ -3263,8 +3263,8 @@ void Gambit_fn_021CF1AC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -3278,15 +3278,15 @@ void Gambit_fn_021CF1AC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -3353,8 +3353,8 @@ void Gambit_fn_021CF1D8(CPUState* cpu) {
         /* 021CF1D8 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021CF1D8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021CF1DC */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021CF1DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021CF1E0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF1DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021CF1E0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF1E0 */ _t2 = _t1 & 0x00000001u;
         /* 021CF1E0 */ _t3 = _t2 ^ 0x00000001u;
         /* 021CF1E0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -3376,8 +3376,8 @@ void Gambit_fn_021CF1F4(CPUState* cpu) {
         /* 021CF1F4 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021CF1F4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021CF1F8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021CF1F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021CF1FC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF1F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021CF1FC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF1FC */ _t2 = _t1 & 0x00000001u;
         /* 021CF1FC */ _t3 = _t2 ^ 0x00000001u;
         /* 021CF1FC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -3399,8 +3399,8 @@ void Gambit_fn_021CF210(CPUState* cpu) {
         /* 021CF210 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021CF210 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021CF214 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021CF214 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021CF218 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF214 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021CF218 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF218 */ _t2 = _t1 & 0x00000001u;
         /* 021CF218 */ _t3 = _t2 ^ 0x00000001u;
         /* 021CF218 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -3443,8 +3443,8 @@ void Gambit_fn_021CF23C(CPUState* cpu) {
         /* 021CF24C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021CF250 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021CF250 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021CF254 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021CF258 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF254 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021CF258 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF258 */ _t5 = _t4 & 0x00000001u;
         /* 021CF258 */ if (_t5) goto L_021CF25C; else goto L_021CF278;
   L_021CF25C: ; // 0x21cf25c
@@ -3483,8 +3483,8 @@ void Gambit_fn_021CF240(CPUState* cpu) {
         /* 021CF24C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021CF250 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021CF250 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021CF254 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021CF258 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF254 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021CF258 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF258 */ _t5 = _t4 & 0x00000001u;
         /* 021CF258 */ if (_t5) goto L_021CF25C; else goto L_021CF278;
   L_021CF25C: ; // 0x21cf25c
@@ -3833,13 +3833,13 @@ void Gambit_fn_021CF3C8(CPUState* cpu) {
         /* 021CF3D8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021CF3DC */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021CF3DC */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021CF3E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021CF3E4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF3E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021CF3E4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF3E4 */ _t5 = _t4 & 0x00000001u;
         /* 021CF3E4 */ if (_t5) goto L_021CF3F0; else goto L_021CF3E8;
   L_021CF3E8: ; // 0x21cf3e8
-        /* 021CF3E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021CF3EC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF3E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021CF3EC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF3EC */ _t7 = _t6 & 0x00000001u;
         /* 021CF3EC */ if (_t7) goto L_021CF3F0; else goto L_021CF428;
   L_021CF3F0: ; // 0x21cf3f0
@@ -3850,8 +3850,8 @@ void Gambit_fn_021CF3C8(CPUState* cpu) {
         /* 021CF3F8 */ cpu->ctr = cpu->r[0];
         /* 021CF3FC */ cpu->r[3] = cpu->r[31];
         /* 021CF400 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CF404 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CF408 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF404 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CF408 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF408 */ _t11 = _t10 & 0x00000001u;
         /* 021CF408 */ if (_t11) goto L_021CF40C; else goto L_021CF428;
   L_021CF40C: ; // 0x21cf40c
@@ -3889,13 +3889,13 @@ void Gambit_fn_021CF3CC(CPUState* cpu) {
         /* 021CF3D8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021CF3DC */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021CF3DC */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021CF3E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021CF3E4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF3E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021CF3E4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF3E4 */ _t5 = _t4 & 0x00000001u;
         /* 021CF3E4 */ if (_t5) goto L_021CF3F0; else goto L_021CF3E8;
   L_021CF3E8: ; // 0x21cf3e8
-        /* 021CF3E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021CF3EC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF3E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021CF3EC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF3EC */ _t7 = _t6 & 0x00000001u;
         /* 021CF3EC */ if (_t7) goto L_021CF3F0; else goto L_021CF428;
   L_021CF3F0: ; // 0x21cf3f0
@@ -3906,8 +3906,8 @@ void Gambit_fn_021CF3CC(CPUState* cpu) {
         /* 021CF3F8 */ cpu->ctr = cpu->r[0];
         /* 021CF3FC */ cpu->r[3] = cpu->r[31];
         /* 021CF400 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CF404 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CF408 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF404 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CF408 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF408 */ _t11 = _t10 & 0x00000001u;
         /* 021CF408 */ if (_t11) goto L_021CF40C; else goto L_021CF428;
   L_021CF40C: ; // 0x21cf40c
@@ -3961,9 +3961,9 @@ void Gambit_fn_021CF458(CPUState* cpu) {
         /* 021CF45C */ _t0 = cpu->r[8] + 0xFFFFFB9Cu;
         /* 021CF45C */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 021CF460 */ cpu->r[6] = 0x101D0000u;
-        /* 021CF464 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021CF464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021CF468 */ cpu->r[6] = cpu->r[6] + 0xFFFFFBCCu;
-        /* 021CF46C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF46C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF46C */ _t2 = _t1 & 0x00000001u;
         /* 021CF46C */ if (_t2) goto L_021CF470; else goto L_021CF488;
   L_021CF470: ; // 0x21cf470
@@ -3976,8 +3976,8 @@ void Gambit_fn_021CF458(CPUState* cpu) {
         /* 021CF484 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 021CF484 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_021CF488: ; // 0x21cf488
-        /* 021CF488 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 021CF48C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF488 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 021CF48C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF48C */ _t6 = _t5 & 0x00000001u;
         /* 021CF48C */ if (_t6) goto L_021CF490; else goto L_021CF498;
   L_021CF490: ; // 0x21cf490
@@ -3988,9 +3988,9 @@ void Gambit_fn_021CF458(CPUState* cpu) {
         /* 021CF49C */ _t7 = cpu->r[10] + 0xFFFFFB6Cu;
         /* 021CF49C */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 021CF4A0 */ cpu->r[8] = 0x101D0000u;
-        /* 021CF4A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021CF4A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021CF4A8 */ cpu->r[8] = cpu->r[8] + 0xFFFFFBC8u;
-        /* 021CF4AC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF4AC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF4AC */ _t9 = _t8 & 0x00000001u;
         /* 021CF4AC */ if (_t9) goto L_021CF4B0; else goto L_021CF4C8;
   L_021CF4B0: ; // 0x21cf4b0
@@ -4003,8 +4003,8 @@ void Gambit_fn_021CF458(CPUState* cpu) {
         /* 021CF4C4 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 021CF4C4 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_021CF4C8: ; // 0x21cf4c8
-        /* 021CF4C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021CF4CC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF4C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021CF4CC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF4CC */ _t13 = _t12 & 0x00000001u;
         /* 021CF4CC */ if (_t13) goto L_021CF4D0; else goto L_021CF4D8;
   L_021CF4D0: ; // 0x21cf4d0
@@ -4015,9 +4015,9 @@ void Gambit_fn_021CF458(CPUState* cpu) {
         /* 021CF4DC */ _t14 = cpu->r[12] + 0xFFFFE5E4u;
         /* 021CF4DC */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 021CF4E0 */ cpu->r[10] = 0x101D0000u;
-        /* 021CF4E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021CF4E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021CF4E8 */ cpu->r[10] = cpu->r[10] + 0xFFFFFB60u;
-        /* 021CF4EC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF4EC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF4EC */ _t16 = _t15 & 0x00000001u;
         /* 021CF4EC */ if (_t16) goto L_021CF4F0; else goto L_021CF508;
   L_021CF4F0: ; // 0x21cf4f0
@@ -4030,8 +4030,8 @@ void Gambit_fn_021CF458(CPUState* cpu) {
         /* 021CF504 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 021CF504 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_021CF508: ; // 0x21cf508
-        /* 021CF508 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021CF50C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF508 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021CF50C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF50C */ _t20 = _t19 & 0x00000001u;
         /* 021CF50C */ if (_t20) goto L_021CF510; else goto L_021CF518;
   L_021CF510: ; // 0x21cf510
@@ -4042,9 +4042,9 @@ void Gambit_fn_021CF458(CPUState* cpu) {
         /* 021CF51C */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021CF51C */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021CF520 */ cpu->r[12] = 0x101D0000u;
-        /* 021CF524 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021CF524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021CF528 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021CF52C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF52C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF52C */ _t23 = _t22 & 0x00000001u;
         /* 021CF52C */ if (_t23) goto L_021CF530; else goto L_021CF548;
   L_021CF530: ; // 0x21cf530
@@ -4057,8 +4057,8 @@ void Gambit_fn_021CF458(CPUState* cpu) {
         /* 021CF544 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 021CF544 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_021CF548: ; // 0x21cf548
-        /* 021CF548 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021CF54C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF548 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021CF54C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF54C */ _t27 = _t26 & 0x00000001u;
         /* 021CF54C */ if (_t27) goto L_021CF550; else goto L_021CF558;
   L_021CF550: ; // 0x21cf550
@@ -4070,9 +4070,9 @@ void Gambit_fn_021CF458(CPUState* cpu) {
         /* 021CF55C */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 021CF55C */ cpu->r[10] = _t28;
         /* 021CF560 */ cpu->r[7] = 0x101D0000u;
-        /* 021CF564 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021CF564 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021CF568 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 021CF56C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF56C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF56C */ _t30 = _t29 & 0x00000001u;
         /* 021CF56C */ if (_t30) goto L_021CF570; else goto L_021CF584;
   L_021CF570: ; // 0x21cf570
@@ -4084,8 +4084,8 @@ void Gambit_fn_021CF458(CPUState* cpu) {
         /* 021CF580 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 021CF580 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_021CF584: ; // 0x21cf584
-        /* 021CF584 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 021CF588 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 021CF588 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF588 */ _t34 = _t33 & 0x00000001u;
         /* 021CF588 */ if (_t34) goto L_021CF58C; else goto L_021CF594;
   L_021CF58C: ; // 0x21cf58c
@@ -4097,9 +4097,9 @@ void Gambit_fn_021CF458(CPUState* cpu) {
         /* 021CF598 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 021CF598 */ cpu->r[8] = _t35;
         /* 021CF59C */ cpu->r[6] = 0x101D0000u;
-        /* 021CF5A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021CF5A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021CF5A4 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 021CF5A8 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF5A8 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF5A8 */ _t37 = _t36 & 0x00000001u;
         /* 021CF5A8 */ if (_t37) goto L_021CF5AC; else goto L_021CF5C0;
   L_021CF5AC: ; // 0x21cf5ac
@@ -4334,18 +4334,18 @@ void Gambit_fn_021CF6B8(CPUState* cpu) {
         /* 021CF6BC */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021CF6BC */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021CF6C0 */ cpu->r[31] = cpu->r[3];
-        /* 021CF6C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021CF6C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021CF6C4 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021CF6C4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021CF6C8 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF6C8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF6C8 */ _t4 = _t3 & 0x00000001u;
         /* 021CF6C8 */ if (_t4) goto L_021CF6CC; else goto L_021CF6DC;
   L_021CF6CC: ; // 0x21cf6cc
         /* 021CF6CC */ cpu->r[3] = 0x00000244u;
         /* 021CF6D0 */ Gambit_fn_02801A78(cpu);
         /* 021CF6D4 */ cpu->r[31] = cpu->r[3];
-        /* 021CF6D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021CF6D8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF6D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021CF6D8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF6D8 */ _t6 = _t5 & 0x00000001u;
         /* 021CF6D8 */ if (_t6) goto L_021CF6F0; else goto L_021CF6DC;
   L_021CF6DC: ; // 0x21cf6dc
@@ -4382,8 +4382,8 @@ void Gambit_fn_021CF708(CPUState* cpu) {
         /* 021CF718 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021CF71C */ _t3 = cpu->r[31] + 0x00000024u;
         /* 021CF71C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021CF720 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021CF724 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF720 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021CF724 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF724 */ _t5 = _t4 & 0x00000001u;
         /* 021CF724 */ if (_t5) goto L_021CF728; else goto L_021CF76C;
   L_021CF728: ; // 0x21cf728
@@ -4438,8 +4438,8 @@ void Gambit_fn_021CF70C(CPUState* cpu) {
         /* 021CF718 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021CF71C */ _t3 = cpu->r[31] + 0x00000024u;
         /* 021CF71C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021CF720 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021CF724 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF720 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021CF724 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF724 */ _t5 = _t4 & 0x00000001u;
         /* 021CF724 */ if (_t5) goto L_021CF728; else goto L_021CF76C;
   L_021CF728: ; // 0x21cf728
@@ -4559,9 +4559,9 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CF83C */ cpu->f[6] = cpu->f[6] + cpu->f[11];
         /* 021CF840 */ cpu->r[4] = cpu->r[4] + 0x0000000Cu;
         /* 021CF844 */ cpu->r[11] = cpu->r[11] + 0xFFFFFFFFu;
-        /* 021CF844 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021CF844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021CF848 */ cpu->f[12] = cpu->f[6];
-        /* 021CF84C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF84C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF84C */ _t18 = _t17 & 0x00000001u;
         /* 021CF84C */ if (_t18) goto L_021CF858; else goto L_021CF850;
   L_021CF850: ; // 0x21cf850
@@ -4600,13 +4600,13 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CF8AC */ cpu->r[6] = 0x101E0000u;
         /* 021CF8B0 */ _t27 = cpu->r[11] + 0xFFFFD8E0u;
         /* 021CF8B0 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t27);
-        /* 021CF8B4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 021CF8B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 021CF8B8 */ _t28 = cpu->r[6] + 0xFFFF958Cu;
         /* 021CF8B8 */ cpu->f[3] = rbrew_read_f32(cpu->mem, _t28);
         /* 021CF8BC */ cpu->r[12] = 0x101C0000u;
         /* 021CF8C0 */ _t29 = cpu->r[12] + 0x00001EF8u;
         /* 021CF8C0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t29);
-        /* 021CF8C4 */ _t30 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CF8C4 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CF8C4 */ _t31 = _t30 & 0x00000001u;
         /* 021CF8C4 */ if (_t31) goto L_021CF90C; else goto L_021CF8C8;
   L_021CF8C8: ; // 0x21cf8c8
@@ -4626,10 +4626,10 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CF8F4 */ rbrew_write32(cpu->mem, _t33, cpu->r[0]);
         /* 021CF8F8 */ Gambit_fn_0204A4DC(cpu);
         /* 021CF8FC */ cpu->r[4] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021CF8FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 021CF8FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 021CF900 */ _t34 = cpu->r[1] + 0x00000060u;
         /* 021CF900 */ rbrew_write32(cpu->mem, _t34, cpu->r[3]);
-        /* 021CF904 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF904 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF904 */ _t36 = _t35 & 0x00000001u;
         /* 021CF904 */ if (_t36) goto L_021CFDD8; else goto L_021CF908;
   L_021CF908: ; // 0x21cf908
@@ -4649,10 +4649,10 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CF930 */ cpu->r[9] = cpu->r[1] + 0x00000060u;
         /* 021CF934 */ Gambit_fn_0204A864(cpu);
         /* 021CF938 */ cpu->r[4] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021CF938 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 021CF938 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 021CF93C */ _t39 = cpu->r[1] + 0x00000060u;
         /* 021CF93C */ rbrew_write32(cpu->mem, _t39, cpu->r[3]);
-        /* 021CF940 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF940 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF940 */ _t41 = _t40 & 0x00000001u;
         /* 021CF940 */ if (_t41) goto L_021CFDD8; else goto L_021CF944;
   L_021CF944: ; // 0x21cf944
@@ -4666,9 +4666,9 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CF958 */ _t44 = cpu->r[1] + 0x00000034u;
         /* 021CF958 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t44);
         /* 021CF95C */ cpu->r[6] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x00000004u, 0x00000004u);
-        /* 021CF95C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 021CF95C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 021CF960 */ /* nop */
-        /* 021CF964 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CF964 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CF964 */ _t46 = _t45 & 0x00000001u;
         /* 021CF964 */ if (_t46) goto L_021CF9B8; else goto L_021CF968;
   L_021CF968: ; // 0x21cf968
@@ -4696,14 +4696,14 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CF998 */ rbrew_write_f32(cpu->mem, _t55, cpu->f[0]);
         /* 021CF99C */ _t56 = cpu->r[1] + 0x00000088u;
         /* 021CF99C */ cpu->r[5] = rbrew_read32(cpu->mem, _t56);
-        /* 021CF9A0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[10]);
+        /* 021CF9A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[10]));
         /* 021CF9A4 */ _t57 = cpu->r[1] + 0x00000058u;
         /* 021CF9A4 */ rbrew_write32(cpu->mem, _t57, cpu->r[4]);
         /* 021CF9A8 */ _t58 = cpu->r[1] + 0x00000058u;
         /* 021CF9A8 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t58);
         /* 021CF9AC */ _t59 = cpu->r[1] + 0x0000005Cu;
         /* 021CF9AC */ rbrew_write32(cpu->mem, _t59, cpu->r[5]);
-        /* 021CF9B0 */ _t60 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CF9B0 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CF9B0 */ _t61 = _t60 & 0x00000001u;
         /* 021CF9B0 */ if (_t61) goto L_021CF9B4; else goto L_021CFA08;
   L_021CF9B4: ; // 0x21cf9b4
@@ -4731,14 +4731,14 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CF9E4 */ rbrew_write_f32(cpu->mem, _t69, cpu->f[0]);
         /* 021CF9E8 */ _t70 = cpu->r[1] + 0x00000088u;
         /* 021CF9E8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t70);
-        /* 021CF9EC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[10]);
+        /* 021CF9EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[10]));
         /* 021CF9F0 */ _t71 = cpu->r[1] + 0x00000058u;
         /* 021CF9F0 */ rbrew_write32(cpu->mem, _t71, cpu->r[4]);
         /* 021CF9F4 */ _t72 = cpu->r[1] + 0x00000058u;
         /* 021CF9F4 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t72);
         /* 021CF9F8 */ _t73 = cpu->r[1] + 0x0000005Cu;
         /* 021CF9F8 */ rbrew_write32(cpu->mem, _t73, cpu->r[5]);
-        /* 021CF9FC */ _t74 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CF9FC */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CF9FC */ _t75 = _t74 & 0x00000001u;
         /* 021CF9FC */ if (_t75) goto L_021CFA00; else goto L_021CFA08;
   L_021CFA00: ; // 0x21cfa00
@@ -4747,12 +4747,12 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFA04 */ _t77 = cpu->r[1] + 0x00000054u;
         /* 021CFA04 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t77);
   L_021CFA08: ; // 0x21cfa08
-        /* 021CFA08 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[12]);
+        /* 021CFA08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[12]));
         /* 021CFA0C */ _t78 = cpu->r[1] + 0x0000005Cu;
         /* 021CFA0C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t78);
         /* 021CFA10 */ _t79 = cpu->r[29] + 0x0000013Cu;
         /* 021CFA10 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t79);
-        /* 021CFA14 */ _t80 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CFA14 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CFA14 */ _t81 = _t80 & 0x00000001u;
         /* 021CFA14 */ if (_t81) goto L_021CFA18; else goto L_021CFA20;
   L_021CFA18: ; // 0x21cfa18
@@ -4761,10 +4761,10 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFA1C */ _t83 = cpu->r[1] + 0x00000058u;
         /* 021CFA1C */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t83);
   L_021CFA20: ; // 0x21cfa20
-        /* 021CFA20 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[13]);
+        /* 021CFA20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[13]));
         /* 021CFA24 */ _t84 = cpu->r[29] + 0x00000140u;
         /* 021CFA24 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t84);
-        /* 021CFA28 */ _t85 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CFA28 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CFA28 */ _t86 = _t85 & 0x00000001u;
         /* 021CFA28 */ if (_t86) goto L_021CFA2C; else goto L_021CFA34;
   L_021CFA2C: ; // 0x21cfa2c
@@ -4773,8 +4773,8 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFA30 */ _t88 = cpu->r[1] + 0x0000005Cu;
         /* 021CFA30 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t88);
   L_021CFA34: ; // 0x21cfa34
-        /* 021CFA34 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[6]);
-        /* 021CFA38 */ _t89 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CFA34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[6]));
+        /* 021CFA38 */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CFA38 */ _t90 = _t89 & 0x00000001u;
         /* 021CFA38 */ if (_t90) goto L_021CFA3C; else goto L_021CFA40;
   L_021CFA3C: ; // 0x21cfa3c
@@ -4783,18 +4783,18 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
   L_021CFA40: ; // 0x21cfa40
         /* 021CFA40 */ _t92 = cpu->r[29] + 0x00000144u;
         /* 021CFA40 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t92);
-        /* 021CFA44 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[9]);
+        /* 021CFA44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[9]));
         /* 021CFA48 */ _t93 = cpu->r[29] + 0x00000148u;
         /* 021CFA48 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t93);
-        /* 021CFA4C */ _t94 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CFA4C */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CFA4C */ _t95 = _t94 & 0x00000001u;
         /* 021CFA4C */ if (_t95) goto L_021CFA50; else goto L_021CFA54;
   L_021CFA50: ; // 0x21cfa50
         /* 021CFA50 */ _t96 = cpu->r[29] + 0x00000144u;
         /* 021CFA50 */ rbrew_write_f32(cpu->mem, _t96, cpu->f[8]);
   L_021CFA54: ; // 0x21cfa54
-        /* 021CFA54 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[11]);
-        /* 021CFA58 */ _t97 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CFA54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[11]));
+        /* 021CFA58 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CFA58 */ _t98 = _t97 & 0x00000001u;
         /* 021CFA58 */ if (_t98) goto L_021CFA5C; else goto L_021CFA60;
   L_021CFA5C: ; // 0x21cfa5c
@@ -4803,8 +4803,8 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
   L_021CFA60: ; // 0x21cfa60
         /* 021CFA60 */ _t100 = cpu->r[27] + 0x00000040u;
         /* 021CFA60 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t100);
-        /* 021CFA64 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[13]);
-        /* 021CFA68 */ _t101 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CFA64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[13]));
+        /* 021CFA68 */ _t101 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CFA68 */ _t102 = _t101 & 0x00000001u;
         /* 021CFA68 */ if (_t102) goto L_021CFA90; else goto L_021CFA6C;
   L_021CFA6C: ; // 0x21cfa6c
@@ -4813,7 +4813,7 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFA70 */ _t104 = cpu->r[27] + 0x00000034u;
         /* 021CFA70 */ rbrew_write_f32(cpu->mem, _t104, cpu->f[30]);
         /* 021CFA74 */ cpu->r[7] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 021CFA74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021CFA74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021CFA78 */ _t105 = cpu->r[27] + 0x0000003Cu;
         /* 021CFA78 */ rbrew_write_f32(cpu->mem, _t105, cpu->f[30]);
         /* 021CFA7C */ _t106 = cpu->r[27] + 0x00000040u;
@@ -4821,7 +4821,7 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFA80 */ cpu->r[12] = cpu->r[27] + 0x00000034u;
         /* 021CFA84 */ _t107 = cpu->r[27] + 0x00000038u;
         /* 021CFA84 */ rbrew_write_f32(cpu->mem, _t107, cpu->f[30]);
-        /* 021CFA88 */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CFA88 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CFA88 */ _t109 = _t108 & 0x00000001u;
         /* 021CFA88 */ if (_t109) goto L_021CFA8C; else goto L_021CFAD4;
   L_021CFA8C: ; // 0x21cfa8c
@@ -4830,8 +4830,8 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFA90 */ _t110 = cpu->r[27] + 0x00000000u;
         /* 021CFA90 */ cpu->r[0] = rbrew_read32(cpu->mem, _t110);
         /* 021CFA94 */ cpu->r[8] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Bu, 0x0000001Cu);
-        /* 021CFA94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021CFA98 */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CFA94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021CFA98 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CFA98 */ _t112 = _t111 & 0x00000001u;
         /* 021CFA98 */ if (_t112) goto L_021CFA9C; else goto L_021CFAB8;
   L_021CFA9C: ; // 0x21cfa9c
@@ -4839,11 +4839,11 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFA9C */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t113);
         /* 021CFAA0 */ _t114 = cpu->r[29] + 0x00000134u;
         /* 021CFAA0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t114);
-        /* 021CFAA4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[13]);
+        /* 021CFAA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[13]));
         /* 021CFAA8 */ _t115 = cpu->r[29] + 0x00000138u;
         /* 021CFAA8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t115);
         /* 021CFAAC */ cpu->r[12] = cpu->r[27] + 0x00000034u;
-        /* 021CFAB0 */ _t116 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CFAB0 */ _t116 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CFAB0 */ _t117 = _t116 & 0x00000001u;
         /* 021CFAB0 */ if (_t117) goto L_021CFAB4; else goto L_021CFC68;
   L_021CFAB4: ; // 0x21cfab4
@@ -4854,13 +4854,13 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFABC */ _t119 = cpu->r[27] + 0x00000038u;
         /* 021CFABC */ rbrew_write_f32(cpu->mem, _t119, cpu->f[30]);
         /* 021CFAC0 */ cpu->r[7] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 021CFAC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021CFAC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021CFAC4 */ _t120 = cpu->r[27] + 0x00000034u;
         /* 021CFAC4 */ rbrew_write_f32(cpu->mem, _t120, cpu->f[30]);
         /* 021CFAC8 */ cpu->r[12] = cpu->r[27] + 0x00000034u;
         /* 021CFACC */ _t121 = cpu->r[27] + 0x0000003Cu;
         /* 021CFACC */ rbrew_write_f32(cpu->mem, _t121, cpu->f[30]);
-        /* 021CFAD0 */ _t122 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CFAD0 */ _t122 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CFAD0 */ _t123 = _t122 & 0x00000001u;
         /* 021CFAD0 */ if (_t123) goto L_021CFAF8; else goto L_021CFAD4;
   L_021CFAD4: ; // 0x21cfad4
@@ -4879,8 +4879,8 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFAF4 */ cpu->r[6] = rbrew_read32(cpu->mem, _t127);
   L_021CFAF8: ; // 0x21cfaf8
         /* 021CFAF8 */ cpu->r[9] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x0000001Bu, 0x0000001Bu);
-        /* 021CFAF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 021CFAFC */ _t128 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CFAF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 021CFAFC */ _t128 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CFAFC */ _t129 = _t128 & 0x00000001u;
         /* 021CFAFC */ if (_t129) goto L_021CFC44; else goto L_021CFB00;
   L_021CFB00: ; // 0x21cfb00
@@ -4888,12 +4888,12 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFB00 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t130);
         /* 021CFB04 */ _t131 = cpu->r[27] + 0x00000040u;
         /* 021CFB04 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t131);
-        /* 021CFB08 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[30]);
+        /* 021CFB08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[30]));
         /* 021CFB0C */ _t132 = cpu->r[27] + 0x0000001Cu;
         /* 021CFB0C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t132);
         /* 021CFB10 */ _t133 = cpu->r[27] + 0x00000028u;
         /* 021CFB10 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t133);
-        /* 021CFB14 */ _t134 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CFB14 */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CFB14 */ _t135 = _t134 & 0x00000001u;
         /* 021CFB14 */ if (_t135) goto L_021CFB18; else goto L_021CFB3C;
   L_021CFB18: ; // 0x21cfb18
@@ -4904,17 +4904,17 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFB24 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t136);
         /* 021CFB28 */ _t137 = cpu->r[27] + 0x0000002Cu;
         /* 021CFB28 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t137);
-        /* 021CFB2C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[30]);
+        /* 021CFB2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[30]));
         /* 021CFB30 */ _t138 = cpu->r[27] + 0x00000020u;
         /* 021CFB30 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t138);
-        /* 021CFB34 */ _t139 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CFB34 */ _t139 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CFB34 */ _t140 = _t139 & 0x00000001u;
         /* 021CFB34 */ if (_t140) goto L_021CFB38; else goto L_021CFBA4;
   L_021CFB38: ; // 0x21cfb38
         /* 021CFB38 */ goto L_021CFB80;
   L_021CFB3C: ; // 0x21cfb3c
-        /* 021CFB3C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[30]);
-        /* 021CFB40 */ _t141 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CFB3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[30]));
+        /* 021CFB40 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CFB40 */ _t142 = _t141 & 0x00000001u;
         /* 021CFB40 */ if (_t142) goto L_021CFB44; else goto L_021CFB68;
   L_021CFB44: ; // 0x21cfb44
@@ -4922,13 +4922,13 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFB48 */ /* nop */
         /* 021CFB4C */ _t143 = cpu->r[12] + 0x00000004u;
         /* 021CFB4C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t143);
-        /* 021CFB50 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[30]);
+        /* 021CFB50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[30]));
         /* 021CFB54 */ _t144 = cpu->r[27] + 0x00000020u;
         /* 021CFB54 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t144);
         /* 021CFB58 */ cpu->f[0] = fma(cpu->f[12], cpu->f[8], cpu->f[10]);
         /* 021CFB5C */ _t145 = cpu->r[27] + 0x0000002Cu;
         /* 021CFB5C */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t145);
-        /* 021CFB60 */ _t146 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CFB60 */ _t146 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CFB60 */ _t147 = _t146 & 0x00000001u;
         /* 021CFB60 */ if (_t147) goto L_021CFB64; else goto L_021CFBA4;
   L_021CFB64: ; // 0x21cfb64
@@ -4939,10 +4939,10 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFB6C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t148);
         /* 021CFB70 */ _t149 = cpu->r[27] + 0x00000020u;
         /* 021CFB70 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t149);
-        /* 021CFB74 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[30]);
+        /* 021CFB74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[30]));
         /* 021CFB78 */ _t150 = cpu->r[27] + 0x0000002Cu;
         /* 021CFB78 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t150);
-        /* 021CFB7C */ _t151 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CFB7C */ _t151 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CFB7C */ _t152 = _t151 & 0x00000001u;
         /* 021CFB7C */ if (_t152) goto L_021CFB80; else goto L_021CFBA4;
   L_021CFB80: ; // 0x21cfb80
@@ -4950,20 +4950,20 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFB84 */ _t153 = cpu->r[12] + 0x00000008u;
         /* 021CFB84 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t153);
         /* 021CFB88 */ /* nop */
-        /* 021CFB8C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[30]);
+        /* 021CFB8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[30]));
         /* 021CFB90 */ _t154 = cpu->r[27] + 0x00000030u;
         /* 021CFB90 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t154);
         /* 021CFB94 */ cpu->f[7] = fma(cpu->f[6], cpu->f[8], cpu->f[9]);
         /* 021CFB98 */ _t155 = cpu->r[27] + 0x00000024u;
         /* 021CFB98 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t155);
-        /* 021CFB9C */ _t156 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CFB9C */ _t156 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CFB9C */ _t157 = _t156 & 0x00000001u;
         /* 021CFB9C */ if (_t157) goto L_021CFBA0; else goto L_021CFC08;
   L_021CFBA0: ; // 0x21cfba0
         /* 021CFBA0 */ goto L_021CFBE8;
   L_021CFBA4: ; // 0x21cfba4
-        /* 021CFBA4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[30]);
-        /* 021CFBA8 */ _t158 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CFBA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[30]));
+        /* 021CFBA8 */ _t158 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CFBA8 */ _t159 = _t158 & 0x00000001u;
         /* 021CFBA8 */ if (_t159) goto L_021CFBAC; else goto L_021CFBD0;
   L_021CFBAC: ; // 0x21cfbac
@@ -4971,13 +4971,13 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFBB0 */ _t160 = cpu->r[12] + 0x00000008u;
         /* 021CFBB0 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t160);
         /* 021CFBB4 */ /* nop */
-        /* 021CFBB8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[30]);
+        /* 021CFBB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[30]));
         /* 021CFBBC */ _t161 = cpu->r[27] + 0x00000030u;
         /* 021CFBBC */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t161);
         /* 021CFBC0 */ cpu->f[7] = fma(cpu->f[7], cpu->f[8], cpu->f[13]);
         /* 021CFBC4 */ _t162 = cpu->r[27] + 0x00000024u;
         /* 021CFBC4 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t162);
-        /* 021CFBC8 */ _t163 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CFBC8 */ _t163 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CFBC8 */ _t164 = _t163 & 0x00000001u;
         /* 021CFBC8 */ if (_t164) goto L_021CFBCC; else goto L_021CFC08;
   L_021CFBCC: ; // 0x21cfbcc
@@ -4987,11 +4987,11 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFBD0 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t165);
         /* 021CFBD4 */ _t166 = cpu->r[27] + 0x00000024u;
         /* 021CFBD4 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t166);
-        /* 021CFBD8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[30]);
+        /* 021CFBD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[30]));
         /* 021CFBDC */ _t167 = cpu->r[27] + 0x00000030u;
         /* 021CFBDC */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t167);
         /* 021CFBE0 */ cpu->f[7] = cpu->f[6] + cpu->f[7];
-        /* 021CFBE4 */ _t168 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CFBE4 */ _t168 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CFBE4 */ _t169 = _t168 & 0x00000001u;
         /* 021CFBE4 */ if (_t169) goto L_021CFBE8; else goto L_021CFC08;
   L_021CFBE8: ; // 0x21cfbe8
@@ -5008,8 +5008,8 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFC00 */ cpu->r[6] = rbrew_read32(cpu->mem, _t173);
         /* 021CFC04 */ goto L_021CFC44;
   L_021CFC08: ; // 0x21cfc08
-        /* 021CFC08 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[30]);
-        /* 021CFC0C */ _t174 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CFC08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[30]));
+        /* 021CFC0C */ _t174 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CFC0C */ _t175 = _t174 & 0x00000001u;
         /* 021CFC0C */ if (_t175) goto L_021CFC10; else goto L_021CFC30;
   L_021CFC10: ; // 0x21cfc10
@@ -5045,10 +5045,10 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFC50 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t186);
         /* 021CFC54 */ _t187 = cpu->r[29] + 0x00000138u;
         /* 021CFC54 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t187);
-        /* 021CFC58 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[13]);
+        /* 021CFC58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[13]));
         /* 021CFC5C */ _t188 = cpu->r[1] + 0x00000034u;
         /* 021CFC5C */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t188);
-        /* 021CFC60 */ _t189 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CFC60 */ _t189 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CFC60 */ _t190 = _t189 & 0x00000001u;
         /* 021CFC60 */ if (_t190) goto L_021CFC64; else goto L_021CFC68;
   L_021CFC64: ; // 0x21cfc64
@@ -5057,10 +5057,10 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
   L_021CFC68: ; // 0x21cfc68
         /* 021CFC68 */ _t192 = cpu->r[12] + 0x00000004u;
         /* 021CFC68 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t192);
-        /* 021CFC6C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
+        /* 021CFC6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
         /* 021CFC70 */ _t193 = cpu->r[29] + 0x0000013Cu;
         /* 021CFC70 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t193);
-        /* 021CFC74 */ _t194 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CFC74 */ _t194 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CFC74 */ _t195 = _t194 & 0x00000001u;
         /* 021CFC74 */ if (_t195) goto L_021CFC78; else goto L_021CFC7C;
   L_021CFC78: ; // 0x21cfc78
@@ -5069,10 +5069,10 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
   L_021CFC7C: ; // 0x21cfc7c
         /* 021CFC7C */ _t197 = cpu->r[12] + 0x00000008u;
         /* 021CFC7C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t197);
-        /* 021CFC80 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[6]);
+        /* 021CFC80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[6]));
         /* 021CFC84 */ _t198 = cpu->r[29] + 0x00000140u;
         /* 021CFC84 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t198);
-        /* 021CFC88 */ _t199 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CFC88 */ _t199 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CFC88 */ _t200 = _t199 & 0x00000001u;
         /* 021CFC88 */ if (_t200) goto L_021CFC8C; else goto L_021CFC90;
   L_021CFC8C: ; // 0x21cfc8c
@@ -5081,10 +5081,10 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
   L_021CFC90: ; // 0x21cfc90
         /* 021CFC90 */ _t202 = cpu->r[12] + 0x00000000u;
         /* 021CFC90 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t202);
-        /* 021CFC94 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[7]);
+        /* 021CFC94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[7]));
         /* 021CFC98 */ _t203 = cpu->r[29] + 0x00000144u;
         /* 021CFC98 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t203);
-        /* 021CFC9C */ _t204 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CFC9C */ _t204 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CFC9C */ _t205 = _t204 & 0x00000001u;
         /* 021CFC9C */ if (_t205) goto L_021CFCA0; else goto L_021CFCA4;
   L_021CFCA0: ; // 0x21cfca0
@@ -5093,10 +5093,10 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
   L_021CFCA4: ; // 0x21cfca4
         /* 021CFCA4 */ _t207 = cpu->r[12] + 0x00000004u;
         /* 021CFCA4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t207);
-        /* 021CFCA8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[8]);
+        /* 021CFCA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[8]));
         /* 021CFCAC */ _t208 = cpu->r[29] + 0x00000148u;
         /* 021CFCAC */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t208);
-        /* 021CFCB0 */ _t209 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CFCB0 */ _t209 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CFCB0 */ _t210 = _t209 & 0x00000001u;
         /* 021CFCB0 */ if (_t210) goto L_021CFCB4; else goto L_021CFCB8;
   L_021CFCB4: ; // 0x21cfcb4
@@ -5105,8 +5105,8 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
   L_021CFCB8: ; // 0x21cfcb8
         /* 021CFCB8 */ _t212 = cpu->r[12] + 0x00000008u;
         /* 021CFCB8 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t212);
-        /* 021CFCBC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[9]);
-        /* 021CFCC0 */ _t213 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CFCBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[9]));
+        /* 021CFCC0 */ _t213 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CFCC0 */ _t214 = _t213 & 0x00000001u;
         /* 021CFCC0 */ if (_t214) goto L_021CFCC4; else goto L_021CFCC8;
   L_021CFCC4: ; // 0x21cfcc4
@@ -5120,8 +5120,8 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFCD8 */ cpu->r[5] = cpu->r[1] + 0x0000008Cu;
         /* 021CFCDC */ cpu->r[3] = cpu->r[29];
         /* 021CFCE0 */ Gambit_fn_021C2660(cpu);
-        /* 021CFCE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CFCE8 */ _t216 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CFCE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CFCE8 */ _t216 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CFCE8 */ _t217 = _t216 & 0x00000001u;
         /* 021CFCE8 */ if (_t217) goto L_021CFD24; else goto L_021CFCEC;
   L_021CFCEC: ; // 0x21cfcec
@@ -5140,7 +5140,7 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFD08 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t222);
         /* 021CFD0C */ _t223 = cpu->r[1] + 0x00000128u;
         /* 021CFD0C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t223);
-        /* 021CFD10 */ _t224 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021CFD10 */ _t224 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021CFD10 */ _t225 = _t224 & 0x00000001u;
         /* 021CFD10 */ if (_t225) goto L_021CFD14; // else: addr-0 trap, fall-through
   L_021CFD14: ; // 0x21cfd14
@@ -5153,8 +5153,8 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFD24 */ _t227 = cpu->r[27] + 0x0000015Cu;
         /* 021CFD24 */ cpu->r[7] = rbrew_read32(cpu->mem, _t227);
         /* 021CFD28 */ cpu->r[6] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 021CFD28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 021CFD2C */ _t228 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CFD28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 021CFD2C */ _t228 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CFD2C */ _t229 = _t228 & 0x00000001u;
         /* 021CFD2C */ if (_t229) goto L_021CFD50; else goto L_021CFD30;
   L_021CFD30: ; // 0x21cfd30
@@ -5171,8 +5171,8 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFD4C */ cpu->r[7] = rbrew_read32(cpu->mem, _t232);
   L_021CFD50: ; // 0x21cfd50
         /* 021CFD50 */ cpu->r[11] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021CFD50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021CFD54 */ _t233 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CFD50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021CFD54 */ _t233 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CFD54 */ _t234 = _t233 & 0x00000001u;
         /* 021CFD54 */ if (_t234) goto L_021CFD74; else goto L_021CFD58;
   L_021CFD58: ; // 0x21cfd58
@@ -5192,8 +5192,8 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFD7C */ cpu->r[6] = cpu->r[7] + 0x101E0000u;
         /* 021CFD80 */ _t238 = cpu->r[6] + 0xFFFF9484u;
         /* 021CFD80 */ cpu->r[9] = rbrew_read32(cpu->mem, _t238);
-        /* 021CFD84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 021CFD88 */ _t239 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021CFD84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 021CFD88 */ _t239 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021CFD88 */ _t240 = _t239 & 0x00000001u;
         /* 021CFD88 */ if (_t240) goto L_021CFD8C; else goto L_021CFDEC;
   L_021CFD8C: ; // 0x21cfd8c
@@ -5216,8 +5216,8 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFDC0 */ cpu->r[3] = cpu->r[29];
         /* 021CFDC4 */ cpu->r[28] = 0x00000001u;
         /* 021CFDC8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CFDCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CFDD0 */ _t244 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CFDCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CFDD0 */ _t244 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CFDD0 */ _t245 = _t244 & 0x00000001u;
         /* 021CFDD0 */ if (_t245) goto L_021CFEDC; else goto L_021CFDD4;
   L_021CFDD4: ; // 0x21cfdd4
@@ -5226,8 +5226,8 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFDD8 */ cpu->r[3] = cpu->r[29];
         /* 021CFDDC */ cpu->r[4] = cpu->r[1] + 0x00000060u;
         /* 021CFDE0 */ Gambit_fn_021C3934(cpu);
-        /* 021CFDE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CFDE8 */ _t246 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CFDE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CFDE8 */ _t246 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CFDE8 */ _t247 = _t246 & 0x00000001u;
         /* 021CFDE8 */ if (_t247) goto L_021CFDEC; else goto L_021D008C;
   L_021CFDEC: ; // 0x21cfdec
@@ -5238,8 +5238,8 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFDF4 */ cpu->ctr = cpu->r[0];
         /* 021CFDF8 */ cpu->r[3] = cpu->r[29];
         /* 021CFDFC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021CFE00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021CFE04 */ _t250 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CFE00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021CFE04 */ _t250 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CFE04 */ _t251 = _t250 & 0x00000001u;
         /* 021CFE04 */ if (_t251) goto L_021CFEDC; else goto L_021CFE08;
   L_021CFE08: ; // 0x21cfe08
@@ -5266,11 +5266,11 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFE34 */ /* nop */
         /* 021CFE38 */ cpu->f[29] = cpu->f[29] + cpu->f[8];
         /* 021CFE3C */ cpu->r[10] = cpu->r[10] + 0xFFFFFFFFu;
-        /* 021CFE3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021CFE3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021CFE40 */ /* nop */
         /* 021CFE44 */ cpu->r[31] = cpu->r[31] + 0x0000000Cu;
         /* 021CFE48 */ cpu->f[8] = cpu->f[29];
-        /* 021CFE4C */ _t260 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CFE4C */ _t260 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CFE4C */ _t261 = _t260 & 0x00000001u;
         /* 021CFE4C */ if (_t261) goto L_021CFE58; else goto L_021CFE50;
   L_021CFE50: ; // 0x21cfe50
@@ -5327,23 +5327,23 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFEE4 */ cpu->r[3] = cpu->r[29];
         /* 021CFEE8 */ cpu->r[4] = cpu->r[29] + 0x00000168u;
         /* 021CFEEC */ Gambit_fn_021C2564(cpu);
-        /* 021CFEF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021CFEF4 */ _t273 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CFEF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021CFEF4 */ _t273 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CFEF4 */ _t274 = _t273 & 0x00000001u;
         /* 021CFEF4 */ if (_t274) goto L_021D006C; else goto L_021CFEF8;
   L_021CFEF8: ; // 0x21cfef8
         /* 021CFEF8 */ _t275 = cpu->r[1] + 0x00000050u;
         /* 021CFEF8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t275);
-        /* 021CFEFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021CFF00 */ _t276 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CFEFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021CFF00 */ _t276 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CFF00 */ _t277 = _t276 & 0x00000001u;
         /* 021CFF00 */ if (_t277) goto L_021D000C; else goto L_021CFF04;
   L_021CFF04: ; // 0x21cff04
         /* 021CFF04 */ _t278 = cpu->r[11] + 0x00000000u;
         /* 021CFF04 */ cpu->r[7] = rbrew_read32(cpu->mem, _t278);
         /* 021CFF08 */ cpu->r[5] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021CFF08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 021CFF0C */ _t279 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CFF08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 021CFF0C */ _t279 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CFF0C */ _t280 = _t279 & 0x00000001u;
         /* 021CFF0C */ if (_t280) goto L_021CFFB4; else goto L_021CFF10;
   L_021CFF10: ; // 0x21cff10
@@ -5409,10 +5409,10 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFF9C */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t304);
         /* 021CFFA0 */ _t305 = cpu->r[1] + 0x0000003Cu;
         /* 021CFFA0 */ rbrew_write_f32(cpu->mem, _t305, cpu->f[10]);
-        /* 021CFFA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000002u);
+        /* 021CFFA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000002u));
         /* 021CFFA8 */ _t306 = cpu->r[1] + 0x00000040u;
         /* 021CFFA8 */ rbrew_write_f32(cpu->mem, _t306, cpu->f[7]);
-        /* 021CFFAC */ _t307 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021CFFAC */ _t307 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021CFFAC */ _t308 = _t307 & 0x00000001u;
         /* 021CFFAC */ if (_t308) goto L_021D0038; else goto L_021CFFB0;
   L_021CFFB0: ; // 0x21cffb0
@@ -5454,10 +5454,10 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021CFFF4 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t325);
         /* 021CFFF8 */ _t326 = cpu->r[1] + 0x0000003Cu;
         /* 021CFFF8 */ rbrew_write_f32(cpu->mem, _t326, cpu->f[10]);
-        /* 021CFFFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000002u);
+        /* 021CFFFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000002u));
         /* 021D0000 */ _t327 = cpu->r[1] + 0x00000040u;
         /* 021D0000 */ rbrew_write_f32(cpu->mem, _t327, cpu->f[7]);
-        /* 021D0004 */ _t328 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0004 */ _t328 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0004 */ _t329 = _t328 & 0x00000001u;
         /* 021D0004 */ if (_t329) goto L_021D0038; else goto L_021D0008;
   L_021D0008: ; // 0x21d0008
@@ -5475,15 +5475,15 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021D001C */ rbrew_write_f32(cpu->mem, _t334, cpu->f[0]);
         /* 021D0020 */ _t335 = cpu->r[1] + 0x00000038u;
         /* 021D0020 */ rbrew_write_f32(cpu->mem, _t335, cpu->f[12]);
-        /* 021D0024 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000002u);
+        /* 021D0024 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000002u));
         /* 021D0028 */ _t336 = cpu->r[1] + 0x00000040u;
         /* 021D0028 */ rbrew_write_f32(cpu->mem, _t336, cpu->f[7]);
-        /* 021D002C */ _t337 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D002C */ _t337 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D002C */ _t338 = _t337 & 0x00000001u;
         /* 021D002C */ if (_t338) goto L_021D0038; else goto L_021D0030;
   L_021D0030: ; // 0x21d0030
-        /* 021D0030 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000003u);
-        /* 021D0034 */ _t339 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0030 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000003u));
+        /* 021D0034 */ _t339 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0034 */ _t340 = _t339 & 0x00000001u;
         /* 021D0034 */ if (_t340) goto L_021D0038; else goto L_021D006C;
   L_021D0038: ; // 0x21d0038
@@ -5494,8 +5494,8 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021D0040 */ cpu->ctr = cpu->r[12];
         /* 021D0044 */ cpu->r[3] = cpu->r[29];
         /* 021D0048 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D004C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D0050 */ _t343 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D004C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D0050 */ _t343 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0050 */ _t344 = _t343 & 0x00000001u;
         /* 021D0050 */ if (_t344) goto L_021D0054; else goto L_021D006C;
   L_021D0054: ; // 0x21d0054
@@ -5512,10 +5512,10 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021D006C */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t347);
         /* 021D0070 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
         /* 021D0074 */ /* nop */
-        /* 021D0078 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000708u);
+        /* 021D0078 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000708u));
         /* 021D007C */ _t348 = cpu->r[29] + 0x00000240u;
         /* 021D007C */ rbrew_write16(cpu->mem, _t348, (uint16_t)cpu->r[10]);
-        /* 021D0080 */ _t349 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D0080 */ _t349 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D0080 */ _t350 = _t349 & 0x00000001u;
         /* 021D0080 */ if (_t350) goto L_021D0084; else goto L_021D008C;
   L_021D0084: ; // 0x21d0084
@@ -5535,7 +5535,7 @@ void Gambit_fn_021CF78C(CPUState* cpu) {
         /* 021D00A0 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t355);
         /* 021D00A4 */ _t356 = cpu->r[1] + 0x00000128u;
         /* 021D00A4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t356);
-        /* 021D00A8 */ _t357 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D00A8 */ _t357 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D00A8 */ _t358 = _t357 & 0x00000001u;
         /* 021D00A8 */ if (_t358) goto L_021D00AC; // else: addr-0 trap, fall-through
   L_021D00AC: ; // 0x21d00ac
@@ -5649,30 +5649,30 @@ void Gambit_fn_021D0118(CPUState* cpu) {
         /* 021D012C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 021D0130 */ _t4 = cpu->r[31] + 0x0000002Cu;
         /* 021D0130 */ cpu->r[10] = rbrew_read32(cpu->mem, _t4);
-        /* 021D0134 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[10]);
-        /* 021D0138 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0134 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[10]));
+        /* 021D0138 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0138 */ _t6 = _t5 & 0x00000001u;
         /* 021D0138 */ if (_t6) goto L_021D0198; else goto L_021D013C;
   L_021D013C: ; // 0x21d013c
-        /* 021D013C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x0000000Bu);
-        /* 021D0140 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D013C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x0000000Bu));
+        /* 021D0140 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0140 */ _t8 = _t7 & 0x00000001u;
         /* 021D0140 */ if (_t8) goto L_021D0198; else goto L_021D0144;
   L_021D0144: ; // 0x21d0144
-        /* 021D0144 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x0000000Fu);
-        /* 021D0148 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x0000000Fu));
+        /* 021D0148 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0148 */ _t10 = _t9 & 0x00000001u;
         /* 021D0148 */ if (_t10) goto L_021D0198; else goto L_021D014C;
   L_021D014C: ; // 0x21d014c
         /* 021D014C */ _t11 = cpu->r[31] + 0x0000001Cu;
         /* 021D014C */ cpu->r[0] = rbrew_read32(cpu->mem, _t11);
-        /* 021D0150 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021D0154 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0150 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021D0154 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0154 */ _t13 = _t12 & 0x00000001u;
         /* 021D0154 */ if (_t13) goto L_021D0160; else goto L_021D0158;
   L_021D0158: ; // 0x21d0158
-        /* 021D0158 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021D015C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021D015C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D015C */ _t15 = _t14 & 0x00000001u;
         /* 021D015C */ if (_t15) goto L_021D0160; else goto L_021D0198;
   L_021D0160: ; // 0x21d0160
@@ -5683,8 +5683,8 @@ void Gambit_fn_021D0118(CPUState* cpu) {
         /* 021D0168 */ cpu->ctr = cpu->r[12];
         /* 021D016C */ cpu->r[3] = cpu->r[31];
         /* 021D0170 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D0174 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D0178 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0174 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D0178 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0178 */ _t19 = _t18 & 0x00000001u;
         /* 021D0178 */ if (_t19) goto L_021D017C; else goto L_021D0198;
   L_021D017C: ; // 0x21d017c
@@ -5724,30 +5724,30 @@ void Gambit_fn_021D011C(CPUState* cpu) {
         /* 021D012C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 021D0130 */ _t4 = cpu->r[31] + 0x0000002Cu;
         /* 021D0130 */ cpu->r[10] = rbrew_read32(cpu->mem, _t4);
-        /* 021D0134 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[10]);
-        /* 021D0138 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0134 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[10]));
+        /* 021D0138 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0138 */ _t6 = _t5 & 0x00000001u;
         /* 021D0138 */ if (_t6) goto L_021D0198; else goto L_021D013C;
   L_021D013C: ; // 0x21d013c
-        /* 021D013C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x0000000Bu);
-        /* 021D0140 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D013C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x0000000Bu));
+        /* 021D0140 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0140 */ _t8 = _t7 & 0x00000001u;
         /* 021D0140 */ if (_t8) goto L_021D0198; else goto L_021D0144;
   L_021D0144: ; // 0x21d0144
-        /* 021D0144 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x0000000Fu);
-        /* 021D0148 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x0000000Fu));
+        /* 021D0148 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0148 */ _t10 = _t9 & 0x00000001u;
         /* 021D0148 */ if (_t10) goto L_021D0198; else goto L_021D014C;
   L_021D014C: ; // 0x21d014c
         /* 021D014C */ _t11 = cpu->r[31] + 0x0000001Cu;
         /* 021D014C */ cpu->r[0] = rbrew_read32(cpu->mem, _t11);
-        /* 021D0150 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021D0154 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0150 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021D0154 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0154 */ _t13 = _t12 & 0x00000001u;
         /* 021D0154 */ if (_t13) goto L_021D0160; else goto L_021D0158;
   L_021D0158: ; // 0x21d0158
-        /* 021D0158 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021D015C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021D015C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D015C */ _t15 = _t14 & 0x00000001u;
         /* 021D015C */ if (_t15) goto L_021D0160; else goto L_021D0198;
   L_021D0160: ; // 0x21d0160
@@ -5758,8 +5758,8 @@ void Gambit_fn_021D011C(CPUState* cpu) {
         /* 021D0168 */ cpu->ctr = cpu->r[12];
         /* 021D016C */ cpu->r[3] = cpu->r[31];
         /* 021D0170 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D0174 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D0178 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0174 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D0178 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0178 */ _t19 = _t18 & 0x00000001u;
         /* 021D0178 */ if (_t19) goto L_021D017C; else goto L_021D0198;
   L_021D017C: ; // 0x21d017c
@@ -5810,10 +5810,10 @@ void Gambit_fn_021D01AC(CPUState* cpu) {
         /* 021D01E0 */ cpu->r[29] = cpu->r[30] + 0x00000084u;
         /* 021D01E4 */ _t6 = cpu->r[30] + 0x00000051u;
         /* 021D01E4 */ cpu->r[27] = rbrew_read8(cpu->mem, _t6);
-        /* 021D01E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 021D01E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 021D01EC */ _t7 = cpu->r[30] + 0x000000C8u;
         /* 021D01EC */ cpu->r[6] = rbrew_read32(cpu->mem, _t7);
-        /* 021D01F0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D01F0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D01F0 */ _t9 = _t8 & 0x00000001u;
         /* 021D01F0 */ if (_t9) goto L_021D035C; else goto L_021D01F4;
   L_021D01F4: ; // 0x21d01f4
@@ -5822,8 +5822,8 @@ void Gambit_fn_021D01AC(CPUState* cpu) {
         /* 021D01FC */ cpu->r[7] = cpu->r[7] + 0x00006338u;
         /* 021D0200 */ Gambit_fn_021F000C(cpu);
         /* 021D0204 */ cpu->r[28] = cpu->r[3];
-        /* 021D0204 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021D0208 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0204 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021D0208 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0208 */ _t11 = _t10 & 0x00000001u;
         /* 021D0208 */ if (_t11) goto L_021D035C; else goto L_021D020C;
   L_021D020C: ; // 0x21d020c
@@ -5862,7 +5862,7 @@ void Gambit_fn_021D01AC(CPUState* cpu) {
         /* 021D0260 */ Gambit_fn_021BFD74(cpu);
         /* 021D0264 */ _t23 = cpu->r[29] + 0x00000044u;
         /* 021D0264 */ cpu->r[7] = rbrew_read32(cpu->mem, _t23);
-        /* 021D0268 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 021D0268 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 021D026C */ _t24 = cpu->r[30] + 0x00000064u;
         /* 021D026C */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t24);
         /* 021D0270 */ _t25 = cpu->r[30] + 0x00000054u;
@@ -5875,7 +5875,7 @@ void Gambit_fn_021D01AC(CPUState* cpu) {
         /* 021D0280 */ cpu->r[3] = cpu->r[28];
         /* 021D0284 */ _t28 = cpu->r[1] + 0x00000010u;
         /* 021D0284 */ rbrew_write_f32(cpu->mem, _t28, cpu->f[1]);
-        /* 021D0288 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0288 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0288 */ _t30 = _t29 & 0x00000001u;
         /* 021D0288 */ if (_t30) goto L_021D0354; else goto L_021D028C;
   L_021D028C: ; // 0x21d028c
@@ -5948,9 +5948,9 @@ void Gambit_fn_021D01AC(CPUState* cpu) {
         /* 021D0320 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021D0324 */ _t60 = cpu->r[30] + 0x00000008u;
         /* 021D0324 */ cpu->r[31] = rbrew_read32(cpu->mem, _t60);
-        /* 021D0328 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021D0328 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021D032C */ cpu->r[3] = cpu->r[31];
-        /* 021D0330 */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0330 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0330 */ _t62 = _t61 & 0x00000001u;
         /* 021D0330 */ if (_t62) goto L_021D03FC; else goto L_021D0334;
   L_021D0334: ; // 0x21d0334
@@ -6034,9 +6034,9 @@ void Gambit_fn_021D01AC(CPUState* cpu) {
         /* 021D03E8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021D03EC */ _t93 = cpu->r[30] + 0x00000008u;
         /* 021D03EC */ cpu->r[31] = rbrew_read32(cpu->mem, _t93);
-        /* 021D03F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021D03F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021D03F4 */ cpu->r[3] = cpu->r[31];
-        /* 021D03F8 */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D03F8 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D03F8 */ _t95 = _t94 & 0x00000001u;
         /* 021D03F8 */ if (_t95) goto L_021D03FC; else goto L_021D0334;
   L_021D03FC: ; // 0x21d03fc
@@ -6064,15 +6064,15 @@ void Gambit_fn_021D0434(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021D0434: ; // 0x21d0434
-        /* 021D0434 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D0438 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0434 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D0438 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0438 */ _t1 = _t0 & 0x00000001u;
         /* 021D0438 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021D0438 */ goto L_021D043C;
   L_021D043C: ; // 0x21d043c
         /* 021D043C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021D043C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D0440 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D043C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D0440 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0440 */ _t3 = _t2 & 0x00000001u;
         /* 021D0440 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021D0440 */ goto L_021D0444;
@@ -6091,8 +6091,8 @@ void Gambit_fn_021D0434(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -6106,15 +6106,15 @@ void Gambit_fn_021D0434(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -6151,7 +6151,7 @@ void Gambit_fn_021D0458(CPUState* cpu) {
         /* 021D0458 */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 021D0458 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 021D0458 */ cpu->r[1] = _t0;
-        /* 021D045C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D045C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D045C */ _t2 = _t1 & 0x00000001u;
         /* 021D045C */ if (_t2) goto L_021D0460; else goto L_021D0468;
   L_021D0460: ; // 0x21d0460
@@ -6203,8 +6203,8 @@ void Gambit_fn_021D048C(CPUState* cpu) {
         /* 021D048C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D048C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D0490 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021D0490 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D0494 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0490 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D0494 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0494 */ _t2 = _t1 & 0x00000001u;
         /* 021D0494 */ _t3 = _t2 ^ 0x00000001u;
         /* 021D0494 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -6226,8 +6226,8 @@ void Gambit_fn_021D04A8(CPUState* cpu) {
         /* 021D04A8 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D04A8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D04AC */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021D04AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D04B0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D04AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D04B0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D04B0 */ _t2 = _t1 & 0x00000001u;
         /* 021D04B0 */ _t3 = _t2 ^ 0x00000001u;
         /* 021D04B0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -6249,8 +6249,8 @@ void Gambit_fn_021D04C4(CPUState* cpu) {
         /* 021D04C4 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D04C4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D04C8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021D04C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D04CC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D04C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D04CC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D04CC */ _t2 = _t1 & 0x00000001u;
         /* 021D04CC */ _t3 = _t2 ^ 0x00000001u;
         /* 021D04CC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -6293,8 +6293,8 @@ void Gambit_fn_021D04F0(CPUState* cpu) {
         /* 021D0500 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D0504 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D0504 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021D0508 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021D050C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0508 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021D050C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D050C */ _t5 = _t4 & 0x00000001u;
         /* 021D050C */ if (_t5) goto L_021D0510; else goto L_021D052C;
   L_021D0510: ; // 0x21d0510
@@ -6333,8 +6333,8 @@ void Gambit_fn_021D04F4(CPUState* cpu) {
         /* 021D0500 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D0504 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D0504 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021D0508 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021D050C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0508 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021D050C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D050C */ _t5 = _t4 & 0x00000001u;
         /* 021D050C */ if (_t5) goto L_021D0510; else goto L_021D052C;
   L_021D0510: ; // 0x21d0510
@@ -6734,13 +6734,13 @@ void Gambit_fn_021D06B4(CPUState* cpu) {
         /* 021D06C4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D06C8 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D06C8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021D06CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021D06D0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D06CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021D06D0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D06D0 */ _t5 = _t4 & 0x00000001u;
         /* 021D06D0 */ if (_t5) goto L_021D06DC; else goto L_021D06D4;
   L_021D06D4: ; // 0x21d06d4
-        /* 021D06D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021D06D8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D06D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021D06D8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D06D8 */ _t7 = _t6 & 0x00000001u;
         /* 021D06D8 */ if (_t7) goto L_021D06DC; else goto L_021D0714;
   L_021D06DC: ; // 0x21d06dc
@@ -6751,8 +6751,8 @@ void Gambit_fn_021D06B4(CPUState* cpu) {
         /* 021D06E4 */ cpu->ctr = cpu->r[0];
         /* 021D06E8 */ cpu->r[3] = cpu->r[31];
         /* 021D06EC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D06F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D06F4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D06F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D06F4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D06F4 */ _t11 = _t10 & 0x00000001u;
         /* 021D06F4 */ if (_t11) goto L_021D06F8; else goto L_021D0714;
   L_021D06F8: ; // 0x21d06f8
@@ -6790,13 +6790,13 @@ void Gambit_fn_021D06B8(CPUState* cpu) {
         /* 021D06C4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D06C8 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D06C8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021D06CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021D06D0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D06CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021D06D0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D06D0 */ _t5 = _t4 & 0x00000001u;
         /* 021D06D0 */ if (_t5) goto L_021D06DC; else goto L_021D06D4;
   L_021D06D4: ; // 0x21d06d4
-        /* 021D06D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021D06D8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D06D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021D06D8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D06D8 */ _t7 = _t6 & 0x00000001u;
         /* 021D06D8 */ if (_t7) goto L_021D06DC; else goto L_021D0714;
   L_021D06DC: ; // 0x21d06dc
@@ -6807,8 +6807,8 @@ void Gambit_fn_021D06B8(CPUState* cpu) {
         /* 021D06E4 */ cpu->ctr = cpu->r[0];
         /* 021D06E8 */ cpu->r[3] = cpu->r[31];
         /* 021D06EC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D06F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D06F4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D06F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D06F4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D06F4 */ _t11 = _t10 & 0x00000001u;
         /* 021D06F4 */ if (_t11) goto L_021D06F8; else goto L_021D0714;
   L_021D06F8: ; // 0x21d06f8
@@ -6847,10 +6847,10 @@ void Gambit_fn_021D0734(CPUState* cpu) {
         /* 021D0734 */ cpu->r[10] = 0x101D0000u;
         /* 021D0738 */ _t0 = cpu->r[10] + 0xFFFFFB88u;
         /* 021D0738 */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 021D073C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021D073C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021D0740 */ cpu->r[10] = 0x101D0000u;
         /* 021D0744 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBD0u;
-        /* 021D0748 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0748 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0748 */ _t2 = _t1 & 0x00000001u;
         /* 021D0748 */ if (_t2) goto L_021D074C; else goto L_021D0764;
   L_021D074C: ; // 0x21d074c
@@ -6863,8 +6863,8 @@ void Gambit_fn_021D0734(CPUState* cpu) {
         /* 021D0760 */ _t4 = cpu->r[10] + 0x00000000u;
         /* 021D0760 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_021D0764: ; // 0x21d0764
-        /* 021D0764 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021D0768 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0764 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021D0768 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0768 */ _t6 = _t5 & 0x00000001u;
         /* 021D0768 */ if (_t6) goto L_021D076C; else goto L_021D0774;
   L_021D076C: ; // 0x21d076c
@@ -6875,9 +6875,9 @@ void Gambit_fn_021D0734(CPUState* cpu) {
         /* 021D0778 */ _t7 = cpu->r[9] + 0xFFFFE5E4u;
         /* 021D0778 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 021D077C */ cpu->r[11] = 0x101D0000u;
-        /* 021D0780 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021D0780 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021D0784 */ cpu->r[11] = cpu->r[11] + 0xFFFFFB60u;
-        /* 021D0788 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0788 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0788 */ _t9 = _t8 & 0x00000001u;
         /* 021D0788 */ if (_t9) goto L_021D078C; else goto L_021D07A4;
   L_021D078C: ; // 0x21d078c
@@ -6890,8 +6890,8 @@ void Gambit_fn_021D0734(CPUState* cpu) {
         /* 021D07A0 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021D07A0 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021D07A4: ; // 0x21d07a4
-        /* 021D07A4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021D07A8 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D07A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021D07A8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D07A8 */ _t13 = _t12 & 0x00000001u;
         /* 021D07A8 */ if (_t13) goto L_021D07AC; else goto L_021D07B4;
   L_021D07AC: ; // 0x21d07ac
@@ -6902,9 +6902,9 @@ void Gambit_fn_021D0734(CPUState* cpu) {
         /* 021D07B8 */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021D07B8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 021D07BC */ cpu->r[9] = 0x101D0000u;
-        /* 021D07C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D07C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D07C4 */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 021D07C8 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D07C8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D07C8 */ _t16 = _t15 & 0x00000001u;
         /* 021D07C8 */ if (_t16) goto L_021D07CC; else goto L_021D07E4;
   L_021D07CC: ; // 0x21d07cc
@@ -6917,8 +6917,8 @@ void Gambit_fn_021D0734(CPUState* cpu) {
         /* 021D07E0 */ _t18 = cpu->r[9] + 0x00000000u;
         /* 021D07E0 */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_021D07E4: ; // 0x21d07e4
-        /* 021D07E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 021D07E8 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D07E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 021D07E8 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D07E8 */ _t20 = _t19 & 0x00000001u;
         /* 021D07E8 */ if (_t20) goto L_021D07EC; else goto L_021D07F4;
   L_021D07EC: ; // 0x21d07ec
@@ -6930,9 +6930,9 @@ void Gambit_fn_021D0734(CPUState* cpu) {
         /* 021D07F8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 021D07F8 */ cpu->r[9] = _t21;
         /* 021D07FC */ cpu->r[10] = 0x101D0000u;
-        /* 021D0800 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021D0800 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021D0804 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021D0808 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0808 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0808 */ _t23 = _t22 & 0x00000001u;
         /* 021D0808 */ if (_t23) goto L_021D080C; else goto L_021D0820;
   L_021D080C: ; // 0x21d080c
@@ -6944,8 +6944,8 @@ void Gambit_fn_021D0734(CPUState* cpu) {
         /* 021D081C */ _t25 = cpu->r[10] + 0x00000000u;
         /* 021D081C */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_021D0820: ; // 0x21d0820
-        /* 021D0820 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021D0824 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0820 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021D0824 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0824 */ _t27 = _t26 & 0x00000001u;
         /* 021D0824 */ if (_t27) goto L_021D0828; else goto L_021D0830;
   L_021D0828: ; // 0x21d0828
@@ -6957,9 +6957,9 @@ void Gambit_fn_021D0734(CPUState* cpu) {
         /* 021D0834 */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 021D0834 */ cpu->r[10] = _t28;
         /* 021D0838 */ cpu->r[11] = 0x101D0000u;
-        /* 021D083C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021D083C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021D0840 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021D0844 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0844 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0844 */ _t30 = _t29 & 0x00000001u;
         /* 021D0844 */ if (_t30) goto L_021D0848; else goto L_021D085C;
   L_021D0848: ; // 0x21d0848
@@ -7665,24 +7665,24 @@ void Gambit_fn_021D0B54(CPUState* cpu) {
         /* 021D0B5C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021D0B5C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021D0B60 */ cpu->r[31] = cpu->r[3];
-        /* 021D0B60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021D0B60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021D0B64 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021D0B64 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021D0B68 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0B68 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0B68 */ _t4 = _t3 & 0x00000001u;
         /* 021D0B68 */ if (_t4) goto L_021D0B6C; else goto L_021D0B7C;
   L_021D0B6C: ; // 0x21d0b6c
         /* 021D0B6C */ cpu->r[3] = 0x00000028u;
         /* 021D0B70 */ Gambit_fn_02801A78(cpu);
         /* 021D0B74 */ cpu->r[31] = cpu->r[3];
-        /* 021D0B74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021D0B78 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0B74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021D0B78 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0B78 */ _t6 = _t5 & 0x00000001u;
         /* 021D0B78 */ if (_t6) goto L_021D0BF4; else goto L_021D0B7C;
   L_021D0B7C: ; // 0x21d0b7c
         /* 021D0B7C */ cpu->r[0] = cpu->r[31] + 0x00000018u;
-        /* 021D0B7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D0B80 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0B7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D0B80 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0B80 */ _t8 = _t7 & 0x00000001u;
         /* 021D0B80 */ if (_t8) goto L_021D0B84; else goto L_021D0B8C;
   L_021D0B84: ; // 0x21d0b84
@@ -7757,24 +7757,24 @@ void Gambit_fn_021D0B58(CPUState* cpu) {
         /* 021D0B5C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021D0B5C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021D0B60 */ cpu->r[31] = cpu->r[3];
-        /* 021D0B60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021D0B60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021D0B64 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021D0B64 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021D0B68 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0B68 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0B68 */ _t4 = _t3 & 0x00000001u;
         /* 021D0B68 */ if (_t4) goto L_021D0B6C; else goto L_021D0B7C;
   L_021D0B6C: ; // 0x21d0b6c
         /* 021D0B6C */ cpu->r[3] = 0x00000028u;
         /* 021D0B70 */ Gambit_fn_02801A78(cpu);
         /* 021D0B74 */ cpu->r[31] = cpu->r[3];
-        /* 021D0B74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021D0B78 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0B74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021D0B78 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0B78 */ _t6 = _t5 & 0x00000001u;
         /* 021D0B78 */ if (_t6) goto L_021D0BF4; else goto L_021D0B7C;
   L_021D0B7C: ; // 0x21d0b7c
         /* 021D0B7C */ cpu->r[0] = cpu->r[31] + 0x00000018u;
-        /* 021D0B7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D0B80 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0B7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D0B80 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0B80 */ _t8 = _t7 & 0x00000001u;
         /* 021D0B80 */ if (_t8) goto L_021D0B84; else goto L_021D0B8C;
   L_021D0B84: ; // 0x21d0b84
@@ -7849,18 +7849,18 @@ void Gambit_fn_021D0C10(CPUState* cpu) {
         /* 021D0C14 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021D0C14 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021D0C18 */ cpu->r[31] = cpu->r[3];
-        /* 021D0C18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021D0C18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021D0C1C */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021D0C1C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021D0C20 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0C20 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0C20 */ _t4 = _t3 & 0x00000001u;
         /* 021D0C20 */ if (_t4) goto L_021D0C24; else goto L_021D0C34;
   L_021D0C24: ; // 0x21d0c24
         /* 021D0C24 */ cpu->r[3] = 0x000000F8u;
         /* 021D0C28 */ Gambit_fn_02801A78(cpu);
         /* 021D0C2C */ cpu->r[31] = cpu->r[3];
-        /* 021D0C2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021D0C30 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0C2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021D0C30 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0C30 */ _t6 = _t5 & 0x00000001u;
         /* 021D0C30 */ if (_t6) goto L_021D0C88; else goto L_021D0C34;
   L_021D0C34: ; // 0x21d0c34
@@ -7869,10 +7869,10 @@ void Gambit_fn_021D0C10(CPUState* cpu) {
         /* 021D0C3C */ cpu->r[12] = 0x10030000u;
         /* 021D0C40 */ cpu->r[12] = cpu->r[12] + 0xFFFFDF34u;
         /* 021D0C44 */ cpu->r[0] = cpu->r[31] + 0x00000084u;
-        /* 021D0C44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021D0C44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021D0C48 */ _t7 = cpu->r[31] + 0x00000004u;
         /* 021D0C48 */ rbrew_write32(cpu->mem, _t7, cpu->r[12]);
-        /* 021D0C4C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0C4C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0C4C */ _t9 = _t8 & 0x00000001u;
         /* 021D0C4C */ if (_t9) goto L_021D0C50; else goto L_021D0C58;
   L_021D0C50: ; // 0x21d0c50
@@ -7880,8 +7880,8 @@ void Gambit_fn_021D0C10(CPUState* cpu) {
         /* 021D0C54 */ Gambit_fn_02801A78(cpu);
   L_021D0C58: ; // 0x21d0c58
         /* 021D0C58 */ cpu->r[12] = cpu->r[31] + 0x000000B4u;
-        /* 021D0C58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D0C5C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0C58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D0C5C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0C5C */ _t11 = _t10 & 0x00000001u;
         /* 021D0C5C */ if (_t11) goto L_021D0C60; else goto L_021D0C68;
   L_021D0C60: ; // 0x21d0c60
@@ -7891,8 +7891,8 @@ void Gambit_fn_021D0C10(CPUState* cpu) {
         /* 021D0C68 */ cpu->r[3] = cpu->r[31] + 0x000000C0u;
         /* 021D0C6C */ Gambit_fn_021D0B54(cpu);
         /* 021D0C70 */ cpu->r[0] = cpu->r[31] + 0x000000E8u;
-        /* 021D0C70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D0C74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0C70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D0C74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0C74 */ _t13 = _t12 & 0x00000001u;
         /* 021D0C74 */ if (_t13) goto L_021D0C78; else goto L_021D0C80;
   L_021D0C78: ; // 0x21d0c78
@@ -7933,7 +7933,7 @@ void Gambit_fn_021D0CA0(CPUState* cpu) {
         /* 021D0CC4 */ cpu->r[28] = cpu->r[8];
         /* 021D0CC8 */ _t2 = cpu->r[1] + 0x00000038u;
         /* 021D0CC8 */ rbrew_write_f32(cpu->mem, _t2, cpu->f[31]);
-        /* 021D0CCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021D0CCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021D0CD0 */ _t3 = cpu->r[1] + 0x00000044u;
         /* 021D0CD0 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 021D0CD4 */ cpu->r[29] = cpu->r[9];
@@ -7941,7 +7941,7 @@ void Gambit_fn_021D0CA0(CPUState* cpu) {
         /* 021D0CDC */ cpu->r[26] = cpu->r[6];
         /* 021D0CE0 */ _t4 = cpu->r[9] + 0xFFFFDEA4u;
         /* 021D0CE0 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t4);
-        /* 021D0CE4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0CE4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0CE4 */ _t6 = _t5 & 0x00000001u;
         /* 021D0CE4 */ if (_t6) goto L_021D0CEC; else goto L_021D0CE8;
   L_021D0CE8: ; // 0x21d0ce8
@@ -7953,9 +7953,9 @@ void Gambit_fn_021D0CA0(CPUState* cpu) {
         /* 021D0CF0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
         /* 021D0CF0 */ cpu->r[12] = _t8;
         /* 021D0CF4 */ cpu->r[4] = 0x101D0000u;
-        /* 021D0CF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021D0CF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021D0CFC */ cpu->r[4] = cpu->r[4] + 0xFFFFFBC0u;
-        /* 021D0D00 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0D00 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0D00 */ _t10 = _t9 & 0x00000001u;
         /* 021D0D00 */ if (_t10) goto L_021D0D04; else goto L_021D0D18;
   L_021D0D04: ; // 0x21d0d04
@@ -7967,8 +7967,8 @@ void Gambit_fn_021D0CA0(CPUState* cpu) {
         /* 021D0D14 */ _t12 = cpu->r[4] + 0x00000000u;
         /* 021D0D14 */ rbrew_write32(cpu->mem, _t12, cpu->r[0]);
   L_021D0D18: ; // 0x21d0d18
-        /* 021D0D18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021D0D1C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0D18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021D0D1C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0D1C */ _t14 = _t13 & 0x00000001u;
         /* 021D0D1C */ if (_t14) goto L_021D0DBC; else goto L_021D0D20;
   L_021D0D20: ; // 0x21d0d20
@@ -7979,14 +7979,14 @@ void Gambit_fn_021D0CA0(CPUState* cpu) {
         /* 021D0D28 */ cpu->ctr = cpu->r[6];
         /* 021D0D2C */ cpu->r[3] = cpu->r[31];
         /* 021D0D30 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D0D34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D0D38 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0D34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D0D38 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0D38 */ _t18 = _t17 & 0x00000001u;
         /* 021D0D38 */ if (_t18) goto L_021D0DBC; else goto L_021D0D3C;
   L_021D0D3C: ; // 0x21d0d3c
         /* 021D0D3C */ cpu->r[3] = cpu->r[31];
-        /* 021D0D3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D0D40 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0D3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D0D40 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0D40 */ _t20 = _t19 & 0x00000001u;
         /* 021D0D40 */ if (_t20) goto L_021D0DBC; else goto L_021D0D44;
   L_021D0D44: ; // 0x21d0d44
@@ -8025,7 +8025,7 @@ void Gambit_fn_021D0CA0(CPUState* cpu) {
         /* 021D0DA0 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t29);
         /* 021D0DA4 */ _t30 = cpu->r[1] + 0x00000030u;
         /* 021D0DA4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t30);
-        /* 021D0DA8 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D0DA8 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D0DA8 */ _t32 = _t31 & 0x00000001u;
         /* 021D0DA8 */ if (_t32) goto L_021D0DAC; // else: addr-0 trap, fall-through
   L_021D0DAC: ; // 0x21d0dac
@@ -8040,9 +8040,9 @@ void Gambit_fn_021D0CA0(CPUState* cpu) {
         /* 021D0DC0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t34);
         /* 021D0DC0 */ cpu->r[8] = _t34;
         /* 021D0DC4 */ cpu->r[4] = 0x101D0000u;
-        /* 021D0DC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021D0DC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021D0DCC */ cpu->r[4] = cpu->r[4] + 0xFFFFE310u;
-        /* 021D0DD0 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0DD0 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0DD0 */ _t36 = _t35 & 0x00000001u;
         /* 021D0DD0 */ if (_t36) goto L_021D0DD4; else goto L_021D0DE8;
   L_021D0DD4: ; // 0x21d0dd4
@@ -8054,8 +8054,8 @@ void Gambit_fn_021D0CA0(CPUState* cpu) {
         /* 021D0DE4 */ _t38 = cpu->r[4] + 0x00000000u;
         /* 021D0DE4 */ rbrew_write32(cpu->mem, _t38, cpu->r[5]);
   L_021D0DE8: ; // 0x21d0de8
-        /* 021D0DE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021D0DEC */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0DE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021D0DEC */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0DEC */ _t40 = _t39 & 0x00000001u;
         /* 021D0DEC */ if (_t40) goto L_021D0E14; else goto L_021D0DF0;
   L_021D0DF0: ; // 0x21d0df0
@@ -8066,13 +8066,13 @@ void Gambit_fn_021D0CA0(CPUState* cpu) {
         /* 021D0DF8 */ cpu->ctr = cpu->r[7];
         /* 021D0DFC */ cpu->r[3] = cpu->r[31];
         /* 021D0E00 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D0E04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D0E08 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0E04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D0E08 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0E08 */ _t44 = _t43 & 0x00000001u;
         /* 021D0E08 */ if (_t44) goto L_021D0E14; else goto L_021D0E0C;
   L_021D0E0C: ; // 0x21d0e0c
-        /* 021D0E0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021D0E10 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0E0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021D0E10 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0E10 */ _t46 = _t45 & 0x00000001u;
         /* 021D0E10 */ if (_t46) goto L_021D0E14; else goto L_021D0E38;
   L_021D0E14: ; // 0x21d0e14
@@ -8082,7 +8082,7 @@ void Gambit_fn_021D0CA0(CPUState* cpu) {
         /* 021D0E1C */ _t48 = cpu->r[1] + 0x00000030u;
         /* 021D0E1C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t48);
         /* 021D0E20 */ cpu->r[3] = 0x00000000u;
-        /* 021D0E24 */ _t49 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D0E24 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D0E24 */ _t50 = _t49 & 0x00000001u;
         /* 021D0E24 */ if (_t50) goto L_021D0E28; // else: addr-0 trap, fall-through
   L_021D0E28: ; // 0x21d0e28
@@ -8106,33 +8106,33 @@ void Gambit_fn_021D0CA0(CPUState* cpu) {
         /* 021D0E54 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 021D0E58 */ cpu->r[3] = cpu->r[25];
         /* 021D0E5C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D0E60 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
+        /* 021D0E60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
         /* 021D0E64 */ /* nop */
         /* 021D0E68 */ cpu->r[7] = rbrew_rlwinm(cpu->r[12], 0x00000002u, 0x0000001Fu, 0x0000001Fu);
-        /* 021D0E68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021D0E6C */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0E68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021D0E6C */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0E6C */ _t57 = _t56 & 0x00000001u;
         /* 021D0E6C */ if (_t57) goto L_021D0ECC; else goto L_021D0E70;
   L_021D0E70: ; // 0x21d0e70
-        /* 021D0E70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021D0E74 */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0E70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021D0E74 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0E74 */ _t59 = _t58 & 0x00000001u;
         /* 021D0E74 */ if (_t59) goto L_021D0EC0; else goto L_021D0E78;
   L_021D0E78: ; // 0x21d0e78
         /* 021D0E78 */ _t60 = cpu->r[29] + 0x00000000u;
         /* 021D0E78 */ cpu->r[0] = rbrew_read8(cpu->mem, _t60);
-        /* 021D0E7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D0E80 */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0E7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D0E80 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0E80 */ _t62 = _t61 & 0x00000001u;
         /* 021D0E80 */ if (_t62) goto L_021D0EC0; else goto L_021D0E84;
   L_021D0E84: ; // 0x21d0e84
         /* 021D0E84 */ _t63 = cpu->r[25] + 0x00000004u;
         /* 021D0E84 */ cpu->r[5] = rbrew_read32(cpu->mem, _t63);
-        /* 021D0E88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021D0E88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021D0E8C */ _t64 = cpu->r[5] + 0x000002C4u;
         /* 021D0E8C */ cpu->r[6] = rbrew_read32(cpu->mem, _t64);
         /* 021D0E90 */ cpu->r[9] = cpu->r[5] + 0x000002C0u;
-        /* 021D0E94 */ _t65 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0E94 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0E94 */ _t66 = _t65 & 0x00000001u;
         /* 021D0E94 */ if (_t66) goto L_021D0E98; else goto L_021D0E9C;
   L_021D0E98: ; // 0x21d0e98
@@ -8143,8 +8143,8 @@ void Gambit_fn_021D0CA0(CPUState* cpu) {
         /* 021D0EA4 */ cpu->r[4] = cpu->r[30];
         /* 021D0EA8 */ cpu->r[3] = cpu->r[25];
         /* 021D0EAC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D0EB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D0EB4 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0EB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D0EB4 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0EB4 */ _t68 = _t67 & 0x00000001u;
         /* 021D0EB4 */ if (_t68) goto L_021D0EB8; else goto L_021D0EC0;
   L_021D0EB8: ; // 0x21d0eb8
@@ -8189,7 +8189,7 @@ void Gambit_fn_021D0CA0(CPUState* cpu) {
         /* 021D0F20 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t78);
         /* 021D0F24 */ _t79 = cpu->r[1] + 0x00000030u;
         /* 021D0F24 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t79);
-        /* 021D0F28 */ _t80 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D0F28 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D0F28 */ _t81 = _t80 & 0x00000001u;
         /* 021D0F28 */ if (_t81) goto L_021D0F2C; // else: addr-0 trap, fall-through
   L_021D0F2C: ; // 0x21d0f2c
@@ -8265,15 +8265,15 @@ void Gambit_fn_021D0F3C(CPUState* cpu) {
         /* 021D0FCC */ rbrew_write_f32(cpu->mem, _t19, cpu->f[0]);
         /* 021D0FD0 */ _t20 = cpu->r[26] + 0x00000008u;
         /* 021D0FD0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t20);
-        /* 021D0FD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
+        /* 021D0FD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
         /* 021D0FD8 */ _t21 = cpu->r[28] + 0x000000F0u;
         /* 021D0FD8 */ rbrew_write_f32(cpu->mem, _t21, cpu->f[13]);
-        /* 021D0FDC */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0FDC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0FDC */ _t23 = _t22 & 0x00000001u;
         /* 021D0FDC */ if (_t23) goto L_021D0FE8; else goto L_021D0FE0;
   L_021D0FE0: ; // 0x21d0fe0
-        /* 021D0FE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000003u);
-        /* 021D0FE4 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0FE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000003u));
+        /* 021D0FE4 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0FE4 */ _t25 = _t24 & 0x00000001u;
         /* 021D0FE4 */ if (_t25) goto L_021D0FE8; else goto L_021D1024;
   L_021D0FE8: ; // 0x21d0fe8
@@ -8388,15 +8388,15 @@ void Gambit_fn_021D1058(CPUState* cpu) {
         /* 021D0FCC */ rbrew_write_f32(cpu->mem, _t19, cpu->f[0]);
         /* 021D0FD0 */ _t20 = cpu->r[26] + 0x00000008u;
         /* 021D0FD0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t20);
-        /* 021D0FD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
+        /* 021D0FD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
         /* 021D0FD8 */ _t21 = cpu->r[28] + 0x000000F0u;
         /* 021D0FD8 */ rbrew_write_f32(cpu->mem, _t21, cpu->f[13]);
-        /* 021D0FDC */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0FDC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0FDC */ _t23 = _t22 & 0x00000001u;
         /* 021D0FDC */ if (_t23) goto L_021D0FE8; else goto L_021D0FE0;
   L_021D0FE0: ; // 0x21d0fe0
-        /* 021D0FE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000003u);
-        /* 021D0FE4 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0FE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000003u));
+        /* 021D0FE4 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0FE4 */ _t25 = _t24 & 0x00000001u;
         /* 021D0FE4 */ if (_t25) goto L_021D0FE8; else goto L_021D1024;
   L_021D0FE8: ; // 0x21d0fe8
@@ -8554,15 +8554,15 @@ void Gambit_fn_021D10B0(CPUState* cpu) {
         /* 021D0FCC */ rbrew_write_f32(cpu->mem, _t19, cpu->f[0]);
         /* 021D0FD0 */ _t20 = cpu->r[26] + 0x00000008u;
         /* 021D0FD0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t20);
-        /* 021D0FD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
+        /* 021D0FD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
         /* 021D0FD8 */ _t21 = cpu->r[28] + 0x000000F0u;
         /* 021D0FD8 */ rbrew_write_f32(cpu->mem, _t21, cpu->f[13]);
-        /* 021D0FDC */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0FDC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0FDC */ _t23 = _t22 & 0x00000001u;
         /* 021D0FDC */ if (_t23) goto L_021D0FE8; else goto L_021D0FE0;
   L_021D0FE0: ; // 0x21d0fe0
-        /* 021D0FE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000003u);
-        /* 021D0FE4 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D0FE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000003u));
+        /* 021D0FE4 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D0FE4 */ _t25 = _t24 & 0x00000001u;
         /* 021D0FE4 */ if (_t25) goto L_021D0FE8; else goto L_021D1024;
   L_021D0FE8: ; // 0x21d0fe8
@@ -8821,9 +8821,9 @@ void Gambit_fn_021D11A8(CPUState* cpu) {
         /* 02031BE4 */ _t4 = cpu->r[4] + 0x00000000u;
         /* 02031BE4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t4);
         /* 02031BE8 */ cpu->r[31] = cpu->r[4];
-        /* 02031BEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02031BEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02031BF0 */ cpu->r[30] = cpu->r[3];
-        /* 02031BF4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02031BF4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02031BF4 */ _t6 = _t5 & 0x00000001u;
         /* 02031BF4 */ if (_t6) goto L_02031C58; else goto L_02031BF8;
   L_02031BF8: ; // 0x2031bf8
@@ -8831,8 +8831,8 @@ void Gambit_fn_021D11A8(CPUState* cpu) {
         /* 02031BF8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
         /* 02031BFC */ _t8 = cpu->r[3] + 0x0000011Cu;
         /* 02031BFC */ cpu->r[11] = rbrew_read8(cpu->mem, _t8);
-        /* 02031C00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02031C04 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02031C00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02031C04 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02031C04 */ _t10 = _t9 & 0x00000001u;
         /* 02031C04 */ if (_t10) goto L_02031C58; else goto L_02031C08;
   L_02031C08: ; // 0x2031c08
@@ -8910,10 +8910,10 @@ void Gambit_fn_021D11B8(CPUState* cpu) {
         /* 021D11E4 */ cpu->r[10] = rbrew_read8(cpu->mem, _t7);
         /* 021D11E8 */ cpu->r[4] = cpu->r[6];
         /* 021D11EC */ cpu->r[11] = 0x10030000u;
-        /* 021D11F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021D11F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021D11F4 */ _t8 = cpu->r[11] + 0xFFFFDEA4u;
         /* 021D11F4 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t8);
-        /* 021D11F8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D11F8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D11F8 */ _t10 = _t9 & 0x00000001u;
         /* 021D11F8 */ if (_t10) goto L_021D12CC; else goto L_021D11FC;
   L_021D11FC: ; // 0x21d11fc
@@ -8921,21 +8921,21 @@ void Gambit_fn_021D11B8(CPUState* cpu) {
         /* 021D1200 */ Gambit_fn_02C69328(cpu);
         /* 021D1204 */ _t11 = cpu->r[30] + 0x000000C0u;
         /* 021D1204 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t11);
-        /* 021D1208 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[31]);
-        /* 021D120C */ _t12 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D1208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[31]));
+        /* 021D120C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D120C */ _t13 = _t12 & 0x00000001u;
         /* 021D120C */ if (_t13) goto L_021D1210; else goto L_021D1220;
   L_021D1210: ; // 0x21d1210
         /* 021D1210 */ cpu->f[0] = cpu->f[13] * cpu->f[13];
-        /* 021D1214 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
-        /* 021D1218 */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D1214 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
+        /* 021D1218 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D1218 */ _t15 = _t14 & 0x00000001u;
         /* 021D1218 */ if (_t15) goto L_021D1228; else goto L_021D121C;
   L_021D121C: ; // 0x21d121c
         /* 021D121C */ goto L_021D12CC;
   L_021D1220: ; // 0x21d1220
-        /* 021D1220 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
-        /* 021D1224 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D1220 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
+        /* 021D1224 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D1224 */ _t17 = _t16 & 0x00000001u;
         /* 021D1224 */ if (_t17) goto L_021D1228; else goto L_021D12CC;
   L_021D1228: ; // 0x21d1228
@@ -8946,8 +8946,8 @@ void Gambit_fn_021D11B8(CPUState* cpu) {
         /* 021D1230 */ cpu->ctr = cpu->r[0];
         /* 021D1234 */ cpu->r[3] = cpu->r[30];
         /* 021D1238 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D123C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D1240 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D123C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D1240 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D1240 */ _t21 = _t20 & 0x00000001u;
         /* 021D1240 */ if (_t21) goto L_021D12B4; else goto L_021D1244;
   L_021D1244: ; // 0x21d1244
@@ -8961,9 +8961,9 @@ void Gambit_fn_021D11B8(CPUState* cpu) {
         /* 021D1254 */ _t24 = cpu->r[12] + 0x000002A4u;
         /* 021D1254 */ cpu->r[31] = rbrew_read32(cpu->mem, _t24);
         /* 021D1258 */ cpu->r[4] = 0x101D0000u;
-        /* 021D125C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021D125C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021D1260 */ cpu->r[4] = cpu->r[4] + 0xFFFFDD68u;
-        /* 021D1264 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D1264 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D1264 */ _t26 = _t25 & 0x00000001u;
         /* 021D1264 */ if (_t26) goto L_021D1268; else goto L_021D127C;
   L_021D1268: ; // 0x21d1268
@@ -8975,8 +8975,8 @@ void Gambit_fn_021D11B8(CPUState* cpu) {
         /* 021D1278 */ _t28 = cpu->r[4] + 0x00000000u;
         /* 021D1278 */ rbrew_write32(cpu->mem, _t28, cpu->r[0]);
   L_021D127C: ; // 0x21d127c
-        /* 021D127C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021D1280 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D127C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021D1280 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D1280 */ _t30 = _t29 & 0x00000001u;
         /* 021D1280 */ if (_t30) goto L_021D12B4; else goto L_021D1284;
   L_021D1284: ; // 0x21d1284
@@ -8987,20 +8987,20 @@ void Gambit_fn_021D11B8(CPUState* cpu) {
         /* 021D128C */ cpu->ctr = cpu->r[12];
         /* 021D1290 */ cpu->r[3] = cpu->r[31];
         /* 021D1294 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D1298 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D129C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D1298 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D129C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D129C */ _t34 = _t33 & 0x00000001u;
         /* 021D129C */ if (_t34) goto L_021D12B4; else goto L_021D12A0;
   L_021D12A0: ; // 0x21d12a0
         /* 021D12A0 */ cpu->r[3] = cpu->r[31];
-        /* 021D12A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D12A4 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D12A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D12A4 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D12A4 */ _t36 = _t35 & 0x00000001u;
         /* 021D12A4 */ if (_t36) goto L_021D12B4; else goto L_021D12A8;
   L_021D12A8: ; // 0x21d12a8
         /* 021D12A8 */ Gambit_fn_026A97E8(cpu);
-        /* 021D12AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D12B0 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D12AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D12B0 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D12B0 */ _t38 = _t37 & 0x00000001u;
         /* 021D12B0 */ if (_t38) goto L_021D12B4; else goto L_021D121C;
   L_021D12B4: ; // 0x21d12b4
@@ -9008,8 +9008,8 @@ void Gambit_fn_021D11B8(CPUState* cpu) {
         /* 021D12B4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t39);
         /* 021D12B8 */ _t40 = cpu->r[29] + 0x00000000u;
         /* 021D12B8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t40);
-        /* 021D12BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[0]);
-        /* 021D12C0 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D12BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[0]));
+        /* 021D12C0 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D12C0 */ _t42 = _t41 & 0x00000001u;
         /* 021D12C0 */ if (_t42) goto L_021D12CC; else goto L_021D12C4;
   L_021D12C4: ; // 0x21d12c4
@@ -9028,7 +9028,7 @@ void Gambit_fn_021D11B8(CPUState* cpu) {
         /* 021D12DC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t47);
         /* 021D12E0 */ _t48 = cpu->r[1] + 0x00000014u;
         /* 021D12E0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t48);
-        /* 021D12E4 */ _t49 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D12E4 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D12E4 */ _t50 = _t49 & 0x00000001u;
         /* 021D12E4 */ if (_t50) goto L_021D12E8; // else: addr-0 trap, fall-through
   L_021D12E8: ; // 0x21d12e8
@@ -9066,10 +9066,10 @@ void Gambit_fn_021D11BC(CPUState* cpu) {
         /* 021D11E4 */ cpu->r[10] = rbrew_read8(cpu->mem, _t7);
         /* 021D11E8 */ cpu->r[4] = cpu->r[6];
         /* 021D11EC */ cpu->r[11] = 0x10030000u;
-        /* 021D11F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021D11F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021D11F4 */ _t8 = cpu->r[11] + 0xFFFFDEA4u;
         /* 021D11F4 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t8);
-        /* 021D11F8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D11F8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D11F8 */ _t10 = _t9 & 0x00000001u;
         /* 021D11F8 */ if (_t10) goto L_021D12CC; else goto L_021D11FC;
   L_021D11FC: ; // 0x21d11fc
@@ -9077,21 +9077,21 @@ void Gambit_fn_021D11BC(CPUState* cpu) {
         /* 021D1200 */ Gambit_fn_02C69328(cpu);
         /* 021D1204 */ _t11 = cpu->r[30] + 0x000000C0u;
         /* 021D1204 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t11);
-        /* 021D1208 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[31]);
-        /* 021D120C */ _t12 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D1208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[31]));
+        /* 021D120C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D120C */ _t13 = _t12 & 0x00000001u;
         /* 021D120C */ if (_t13) goto L_021D1210; else goto L_021D1220;
   L_021D1210: ; // 0x21d1210
         /* 021D1210 */ cpu->f[0] = cpu->f[13] * cpu->f[13];
-        /* 021D1214 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
-        /* 021D1218 */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D1214 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
+        /* 021D1218 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D1218 */ _t15 = _t14 & 0x00000001u;
         /* 021D1218 */ if (_t15) goto L_021D1228; else goto L_021D121C;
   L_021D121C: ; // 0x21d121c
         /* 021D121C */ goto L_021D12CC;
   L_021D1220: ; // 0x21d1220
-        /* 021D1220 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
-        /* 021D1224 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D1220 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
+        /* 021D1224 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D1224 */ _t17 = _t16 & 0x00000001u;
         /* 021D1224 */ if (_t17) goto L_021D1228; else goto L_021D12CC;
   L_021D1228: ; // 0x21d1228
@@ -9102,8 +9102,8 @@ void Gambit_fn_021D11BC(CPUState* cpu) {
         /* 021D1230 */ cpu->ctr = cpu->r[0];
         /* 021D1234 */ cpu->r[3] = cpu->r[30];
         /* 021D1238 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D123C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D1240 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D123C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D1240 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D1240 */ _t21 = _t20 & 0x00000001u;
         /* 021D1240 */ if (_t21) goto L_021D12B4; else goto L_021D1244;
   L_021D1244: ; // 0x21d1244
@@ -9117,9 +9117,9 @@ void Gambit_fn_021D11BC(CPUState* cpu) {
         /* 021D1254 */ _t24 = cpu->r[12] + 0x000002A4u;
         /* 021D1254 */ cpu->r[31] = rbrew_read32(cpu->mem, _t24);
         /* 021D1258 */ cpu->r[4] = 0x101D0000u;
-        /* 021D125C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021D125C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021D1260 */ cpu->r[4] = cpu->r[4] + 0xFFFFDD68u;
-        /* 021D1264 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D1264 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D1264 */ _t26 = _t25 & 0x00000001u;
         /* 021D1264 */ if (_t26) goto L_021D1268; else goto L_021D127C;
   L_021D1268: ; // 0x21d1268
@@ -9131,8 +9131,8 @@ void Gambit_fn_021D11BC(CPUState* cpu) {
         /* 021D1278 */ _t28 = cpu->r[4] + 0x00000000u;
         /* 021D1278 */ rbrew_write32(cpu->mem, _t28, cpu->r[0]);
   L_021D127C: ; // 0x21d127c
-        /* 021D127C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021D1280 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D127C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021D1280 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D1280 */ _t30 = _t29 & 0x00000001u;
         /* 021D1280 */ if (_t30) goto L_021D12B4; else goto L_021D1284;
   L_021D1284: ; // 0x21d1284
@@ -9143,20 +9143,20 @@ void Gambit_fn_021D11BC(CPUState* cpu) {
         /* 021D128C */ cpu->ctr = cpu->r[12];
         /* 021D1290 */ cpu->r[3] = cpu->r[31];
         /* 021D1294 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D1298 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D129C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D1298 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D129C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D129C */ _t34 = _t33 & 0x00000001u;
         /* 021D129C */ if (_t34) goto L_021D12B4; else goto L_021D12A0;
   L_021D12A0: ; // 0x21d12a0
         /* 021D12A0 */ cpu->r[3] = cpu->r[31];
-        /* 021D12A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D12A4 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D12A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D12A4 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D12A4 */ _t36 = _t35 & 0x00000001u;
         /* 021D12A4 */ if (_t36) goto L_021D12B4; else goto L_021D12A8;
   L_021D12A8: ; // 0x21d12a8
         /* 021D12A8 */ Gambit_fn_026A97E8(cpu);
-        /* 021D12AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D12B0 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D12AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D12B0 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D12B0 */ _t38 = _t37 & 0x00000001u;
         /* 021D12B0 */ if (_t38) goto L_021D12B4; else goto L_021D121C;
   L_021D12B4: ; // 0x21d12b4
@@ -9164,8 +9164,8 @@ void Gambit_fn_021D11BC(CPUState* cpu) {
         /* 021D12B4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t39);
         /* 021D12B8 */ _t40 = cpu->r[29] + 0x00000000u;
         /* 021D12B8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t40);
-        /* 021D12BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[0]);
-        /* 021D12C0 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D12BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[0]));
+        /* 021D12C0 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D12C0 */ _t42 = _t41 & 0x00000001u;
         /* 021D12C0 */ if (_t42) goto L_021D12CC; else goto L_021D12C4;
   L_021D12C4: ; // 0x21d12c4
@@ -9184,7 +9184,7 @@ void Gambit_fn_021D11BC(CPUState* cpu) {
         /* 021D12DC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t47);
         /* 021D12E0 */ _t48 = cpu->r[1] + 0x00000014u;
         /* 021D12E0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t48);
-        /* 021D12E4 */ _t49 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D12E4 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D12E4 */ _t50 = _t49 & 0x00000001u;
         /* 021D12E4 */ if (_t50) goto L_021D12E8; // else: addr-0 trap, fall-through
   L_021D12E8: ; // 0x21d12e8
@@ -9239,9 +9239,9 @@ void Gambit_fn_021D12F8(CPUState* cpu) {
         /* 021D1348 */ rbrew_write32(cpu->mem, _t13, cpu->r[30]);
         /* 021D134C */ _t14 = cpu->r[31] + 0x000000F4u;
         /* 021D134C */ cpu->r[0] = rbrew_read8(cpu->mem, _t14);
-        /* 021D1350 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021D1350 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021D1354 */ cpu->r[30] = cpu->r[4];
-        /* 021D1358 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D1358 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D1358 */ _t16 = _t15 & 0x00000001u;
         /* 021D1358 */ if (_t16) goto L_021D1628; else goto L_021D135C;
   L_021D135C: ; // 0x21d135c
@@ -9321,10 +9321,10 @@ void Gambit_fn_021D12F8(CPUState* cpu) {
         /* 021D141C */ cpu->f[1] = fma(cpu->f[8], cpu->f[8], cpu->f[9]);
         /* 021D1420 */ _t42 = cpu->r[8] + 0xFFFFDEACu;
         /* 021D1420 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t42);
-        /* 021D1424 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 021D1424 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 021D1428 */ _t43 = cpu->r[1] + 0x00000014u;
         /* 021D1428 */ rbrew_write_f32(cpu->mem, _t43, cpu->f[8]);
-        /* 021D142C */ _t44 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D142C */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D142C */ _t45 = _t44 & 0x00000001u;
         /* 021D142C */ if (_t45) goto L_021D1430; else goto L_021D1460;
   L_021D1430: ; // 0x21d1430
@@ -9346,13 +9346,13 @@ void Gambit_fn_021D12F8(CPUState* cpu) {
         /* 021D145C */ rbrew_write_f32(cpu->mem, _t49, cpu->f[13]);
   L_021D1460: ; // 0x21d1460
         /* 021D1460 */ cpu->r[12] = 0x101C0000u;
-        /* 021D1464 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 021D1464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 021D1468 */ cpu->r[10] = 0x101E0000u;
         /* 021D146C */ _t50 = cpu->r[12] + 0x00001EF8u;
         /* 021D146C */ cpu->r[3] = rbrew_read32(cpu->mem, _t50);
         /* 021D1470 */ _t51 = cpu->r[10] + 0xFFFF958Cu;
         /* 021D1470 */ cpu->f[3] = rbrew_read_f32(cpu->mem, _t51);
-        /* 021D1474 */ _t52 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D1474 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D1474 */ _t53 = _t52 & 0x00000001u;
         /* 021D1474 */ if (_t53) goto L_021D14B8; else goto L_021D1478;
   L_021D1478: ; // 0x21d1478
@@ -9371,10 +9371,10 @@ void Gambit_fn_021D12F8(CPUState* cpu) {
         /* 021D14A0 */ rbrew_write32(cpu->mem, _t55, cpu->r[0]);
         /* 021D14A4 */ Gambit_fn_0204A4DC(cpu);
         /* 021D14A8 */ cpu->r[9] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021D14A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021D14A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021D14AC */ _t56 = cpu->r[1] + 0x00000054u;
         /* 021D14AC */ rbrew_write32(cpu->mem, _t56, cpu->r[3]);
-        /* 021D14B0 */ _t57 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D14B0 */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D14B0 */ _t58 = _t57 & 0x00000001u;
         /* 021D14B0 */ if (_t58) goto L_021D14E8; else goto L_021D14B4;
   L_021D14B4: ; // 0x21d14b4
@@ -9391,18 +9391,18 @@ void Gambit_fn_021D12F8(CPUState* cpu) {
         /* 021D14D4 */ cpu->r[7] = 0x000001FFu;
         /* 021D14D8 */ Gambit_fn_0204A864(cpu);
         /* 021D14DC */ cpu->r[9] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021D14DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021D14DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021D14E0 */ _t60 = cpu->r[1] + 0x00000054u;
         /* 021D14E0 */ rbrew_write32(cpu->mem, _t60, cpu->r[3]);
-        /* 021D14E4 */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D14E4 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D14E4 */ _t62 = _t61 & 0x00000001u;
         /* 021D14E4 */ if (_t62) goto L_021D14E8; else goto L_021D15E0;
   L_021D14E8: ; // 0x21d14e8
         /* 021D14E8 */ cpu->r[3] = 0x101C0000u;
         /* 021D14EC */ _t63 = cpu->r[3] + 0x00005B90u;
         /* 021D14EC */ cpu->r[3] = rbrew_read32(cpu->mem, _t63);
-        /* 021D14F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D14F4 */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D14F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D14F4 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D14F4 */ _t65 = _t64 & 0x00000001u;
         /* 021D14F4 */ if (_t65) goto L_021D1628; else goto L_021D14F8;
   L_021D14F8: ; // 0x21d14f8
@@ -9465,9 +9465,9 @@ void Gambit_fn_021D12F8(CPUState* cpu) {
         /* 021D1584 */ cpu->f[1] = fma(cpu->f[9], cpu->f[9], cpu->f[11]);
         /* 021D1588 */ _t87 = cpu->r[1] + 0x00000038u;
         /* 021D1588 */ rbrew_write_f32(cpu->mem, _t87, cpu->f[12]);
-        /* 021D158C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 021D158C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 021D1590 */ /* nop */
-        /* 021D1594 */ _t88 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D1594 */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D1594 */ _t89 = _t88 & 0x00000001u;
         /* 021D1594 */ if (_t89) goto L_021D1598; else goto L_021D15C8;
   L_021D1598: ; // 0x21d1598
@@ -9492,8 +9492,8 @@ void Gambit_fn_021D12F8(CPUState* cpu) {
         /* 021D15CC */ cpu->r[5] = cpu->r[1] + 0x00000018u;
         /* 021D15D0 */ cpu->r[4] = cpu->r[1] + 0x00000030u;
         /* 021D15D4 */ Gambit_fn_02399D90(cpu);
-        /* 021D15D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D15DC */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D15D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D15DC */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D15DC */ _t95 = _t94 & 0x00000001u;
         /* 021D15DC */ if (_t95) goto L_021D1628; else goto L_021D15E0;
   L_021D15E0: ; // 0x21d15e0
@@ -9522,7 +9522,7 @@ void Gambit_fn_021D12F8(CPUState* cpu) {
         /* 021D160C */ cpu->f[27] = rbrew_read_f64(cpu->mem, _t106);
         /* 021D1610 */ _t107 = cpu->r[1] + 0x00000080u;
         /* 021D1610 */ cpu->r[30] = rbrew_read32(cpu->mem, _t107);
-        /* 021D1614 */ _t108 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D1614 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D1614 */ _t109 = _t108 & 0x00000001u;
         /* 021D1614 */ if (_t109) goto L_021D1618; // else: addr-0 trap, fall-through
   L_021D1618: ; // 0x21d1618
@@ -9557,7 +9557,7 @@ void Gambit_fn_021D12F8(CPUState* cpu) {
         /* 021D1654 */ cpu->f[27] = rbrew_read_f64(cpu->mem, _t121);
         /* 021D1658 */ _t122 = cpu->r[1] + 0x00000080u;
         /* 021D1658 */ cpu->r[30] = rbrew_read32(cpu->mem, _t122);
-        /* 021D165C */ _t123 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D165C */ _t123 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D165C */ _t124 = _t123 & 0x00000001u;
         /* 021D165C */ if (_t124) goto L_021D1660; // else: addr-0 trap, fall-through
   L_021D1660: ; // 0x21d1660
@@ -9608,7 +9608,7 @@ void Gambit_fn_021D1694(CPUState* cpu) {
         /* 021D16A4 */ _t4 = cpu->r[4] + 0x00000000u;
         /* 021D16A4 */ rbrew_write16(cpu->mem, _t4, (uint16_t)cpu->r[0]);
         /* 021D16A8 */ cpu->r[11] = cpu->r[9] & 0x0000FEFFu;
-        /* 021D16A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D16A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D16AC */ cpu->r[12] = 0x00000000u;
         /* 021D16B0 */ _t5 = cpu->r[4] + 0x00000002u;
         /* 021D16B0 */ rbrew_write16(cpu->mem, _t5, (uint16_t)cpu->r[11]);
@@ -9870,17 +9870,17 @@ void Gambit_fn_021D16BC(CPUState* cpu) {
         /* 021D18D0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t100);
         /* 021D18D4 */ _t101 = cpu->r[11] + 0xFFFFDF28u;
         /* 021D18D4 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t101);
-        /* 021D18D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u);
+        /* 021D18D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u));
         /* 021D18DC */ _t102 = cpu->r[31] + 0x000000ACu;
         /* 021D18DC */ rbrew_write32(cpu->mem, _t102, cpu->r[10]);
-        /* 021D18E0 */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D18E0 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D18E0 */ _t104 = _t103 & 0x00000001u;
         /* 021D18E0 */ if (_t104) goto L_021D18E4; else goto L_021D18F4;
   L_021D18E4: ; // 0x21d18e4
         /* 021D18E4 */ cpu->r[3] = 0x00000010u;
         /* 021D18E8 */ Gambit_fn_02801A78(cpu);
-        /* 021D18EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D18F0 */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D18EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D18F0 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D18F0 */ _t106 = _t105 & 0x00000001u;
         /* 021D18F0 */ if (_t106) goto L_021D1904; else goto L_021D18F4;
   L_021D18F4: ; // 0x21d18f4
@@ -9893,16 +9893,16 @@ void Gambit_fn_021D16BC(CPUState* cpu) {
         /* 021D1900 */ _t110 = cpu->r[3] + 0x0000000Cu;
         /* 021D1900 */ rbrew_write_f32(cpu->mem, _t110, cpu->f[30]);
   L_021D1904: ; // 0x21d1904
-        /* 021D1904 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u);
+        /* 021D1904 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u));
         /* 021D1908 */ cpu->r[3] = cpu->r[31] + 0x000000D0u;
-        /* 021D190C */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D190C */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D190C */ _t112 = _t111 & 0x00000001u;
         /* 021D190C */ if (_t112) goto L_021D1910; else goto L_021D1920;
   L_021D1910: ; // 0x21d1910
         /* 021D1910 */ cpu->r[3] = 0x00000010u;
         /* 021D1914 */ Gambit_fn_02801A78(cpu);
-        /* 021D1918 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D191C */ _t113 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D1918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D191C */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D191C */ _t114 = _t113 & 0x00000001u;
         /* 021D191C */ if (_t114) goto L_021D1930; else goto L_021D1920;
   L_021D1920: ; // 0x21d1920
@@ -9950,7 +9950,7 @@ void Gambit_fn_021D16BC(CPUState* cpu) {
         /* 021D1974 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t133);
         /* 021D1978 */ _t134 = cpu->r[1] + 0x00000058u;
         /* 021D1978 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t134);
-        /* 021D197C */ _t135 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D197C */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D197C */ _t136 = _t135 & 0x00000001u;
         /* 021D197C */ if (_t136) goto L_021D1980; // else: addr-0 trap, fall-through
   L_021D1980: ; // 0x21d1980
@@ -10017,8 +10017,8 @@ void Gambit_fn_021D19B0(CPUState* cpu) {
         /* 021D19B0 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D19B0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D19B4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021D19B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D19B8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D19B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D19B8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D19B8 */ _t2 = _t1 & 0x00000001u;
         /* 021D19B8 */ _t3 = _t2 ^ 0x00000001u;
         /* 021D19B8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -10040,8 +10040,8 @@ void Gambit_fn_021D19CC(CPUState* cpu) {
         /* 021D19CC */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D19CC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D19D0 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021D19D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D19D4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D19D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D19D4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D19D4 */ _t2 = _t1 & 0x00000001u;
         /* 021D19D4 */ _t3 = _t2 ^ 0x00000001u;
         /* 021D19D4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -10063,8 +10063,8 @@ void Gambit_fn_021D19E8(CPUState* cpu) {
         /* 021D19E8 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D19E8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D19EC */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021D19EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D19F0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D19EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D19F0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D19F0 */ _t2 = _t1 & 0x00000001u;
         /* 021D19F0 */ _t3 = _t2 ^ 0x00000001u;
         /* 021D19F0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -10107,8 +10107,8 @@ void Gambit_fn_021D1A14(CPUState* cpu) {
         /* 021D1A24 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D1A28 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D1A28 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021D1A2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021D1A30 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D1A2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021D1A30 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D1A30 */ _t5 = _t4 & 0x00000001u;
         /* 021D1A30 */ if (_t5) goto L_021D1A34; else goto L_021D1A50;
   L_021D1A34: ; // 0x21d1a34
@@ -10147,8 +10147,8 @@ void Gambit_fn_021D1A18(CPUState* cpu) {
         /* 021D1A24 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D1A28 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D1A28 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021D1A2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021D1A30 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D1A2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021D1A30 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D1A30 */ _t5 = _t4 & 0x00000001u;
         /* 021D1A30 */ if (_t5) goto L_021D1A34; else goto L_021D1A50;
   L_021D1A34: ; // 0x21d1a34
@@ -10427,9 +10427,9 @@ void Gambit_fn_021D1B60(CPUState* cpu) {
         /* 021D1B64 */ _t0 = cpu->r[9] + 0xFFFFFBD4u;
         /* 021D1B64 */ cpu->r[9] = rbrew_read32(cpu->mem, _t0);
         /* 021D1B68 */ cpu->r[11] = 0x101D0000u;
-        /* 021D1B6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021D1B6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021D1B70 */ cpu->r[11] = cpu->r[11] + 0xFFFFFBD8u;
-        /* 021D1B74 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D1B74 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D1B74 */ _t2 = _t1 & 0x00000001u;
         /* 021D1B74 */ if (_t2) goto L_021D1B78; else goto L_021D1B90;
   L_021D1B78: ; // 0x21d1b78
@@ -10442,8 +10442,8 @@ void Gambit_fn_021D1B60(CPUState* cpu) {
         /* 021D1B8C */ _t4 = cpu->r[11] + 0x00000000u;
         /* 021D1B8C */ rbrew_write32(cpu->mem, _t4, cpu->r[9]);
   L_021D1B90: ; // 0x21d1b90
-        /* 021D1B90 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021D1B94 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D1B90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021D1B94 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D1B94 */ _t6 = _t5 & 0x00000001u;
         /* 021D1B94 */ if (_t6) goto L_021D1B98; else goto L_021D1BA0;
   L_021D1B98: ; // 0x21d1b98
@@ -10453,10 +10453,10 @@ void Gambit_fn_021D1B60(CPUState* cpu) {
         /* 021D1BA0 */ cpu->r[12] = 0x101D0000u;
         /* 021D1BA4 */ _t7 = cpu->r[12] + 0xFFFFD9ECu;
         /* 021D1BA4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 021D1BA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021D1BA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021D1BAC */ cpu->r[12] = 0x101D0000u;
         /* 021D1BB0 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021D1BB4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D1BB4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D1BB4 */ _t9 = _t8 & 0x00000001u;
         /* 021D1BB4 */ if (_t9) goto L_021D1BB8; else goto L_021D1BD0;
   L_021D1BB8: ; // 0x21d1bb8
@@ -10469,8 +10469,8 @@ void Gambit_fn_021D1B60(CPUState* cpu) {
         /* 021D1BCC */ _t11 = cpu->r[12] + 0x00000000u;
         /* 021D1BCC */ rbrew_write32(cpu->mem, _t11, cpu->r[11]);
   L_021D1BD0: ; // 0x21d1bd0
-        /* 021D1BD0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021D1BD4 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D1BD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021D1BD4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D1BD4 */ _t13 = _t12 & 0x00000001u;
         /* 021D1BD4 */ if (_t13) goto L_021D1BD8; else goto L_021D1BE0;
   L_021D1BD8: ; // 0x21d1bd8
@@ -10482,9 +10482,9 @@ void Gambit_fn_021D1B60(CPUState* cpu) {
         /* 021D1BE4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 021D1BE4 */ cpu->r[10] = _t14;
         /* 021D1BE8 */ cpu->r[11] = 0x101D0000u;
-        /* 021D1BEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021D1BEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021D1BF0 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4ECu;
-        /* 021D1BF4 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D1BF4 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D1BF4 */ _t16 = _t15 & 0x00000001u;
         /* 021D1BF4 */ if (_t16) goto L_021D1BF8; else goto L_021D1C0C;
   L_021D1BF8: ; // 0x21d1bf8
@@ -10496,8 +10496,8 @@ void Gambit_fn_021D1B60(CPUState* cpu) {
         /* 021D1C08 */ _t18 = cpu->r[11] + 0x00000000u;
         /* 021D1C08 */ rbrew_write32(cpu->mem, _t18, cpu->r[9]);
   L_021D1C0C: ; // 0x21d1c0c
-        /* 021D1C0C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021D1C10 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D1C0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021D1C10 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D1C10 */ _t20 = _t19 & 0x00000001u;
         /* 021D1C10 */ if (_t20) goto L_021D1C14; else goto L_021D1C1C;
   L_021D1C14: ; // 0x21d1c14
@@ -10509,9 +10509,9 @@ void Gambit_fn_021D1B60(CPUState* cpu) {
         /* 021D1C20 */ cpu->r[10] = rbrew_read32(cpu->mem, _t21);
         /* 021D1C20 */ cpu->r[9] = _t21;
         /* 021D1C24 */ cpu->r[12] = 0x101D0000u;
-        /* 021D1C28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021D1C28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021D1C2C */ cpu->r[12] = cpu->r[12] + 0xFFFFD4E4u;
-        /* 021D1C30 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D1C30 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D1C30 */ _t23 = _t22 & 0x00000001u;
         /* 021D1C30 */ if (_t23) goto L_021D1C34; else goto L_021D1C48;
   L_021D1C34: ; // 0x21d1c34
@@ -12051,18 +12051,18 @@ void Gambit_fn_021D22EC(CPUState* cpu) {
         /* 021D22F4 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021D22F4 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021D22F8 */ cpu->r[31] = cpu->r[3];
-        /* 021D22F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021D22F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021D22FC */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021D22FC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021D2300 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2300 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2300 */ _t4 = _t3 & 0x00000001u;
         /* 021D2300 */ if (_t4) goto L_021D2304; else goto L_021D2314;
   L_021D2304: ; // 0x21d2304
         /* 021D2304 */ cpu->r[3] = 0x00000244u;
         /* 021D2308 */ Gambit_fn_02801A78(cpu);
         /* 021D230C */ cpu->r[31] = cpu->r[3];
-        /* 021D230C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021D2310 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D230C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021D2310 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2310 */ _t6 = _t5 & 0x00000001u;
         /* 021D2310 */ if (_t6) goto L_021D2330; else goto L_021D2314;
   L_021D2314: ; // 0x21d2314
@@ -12097,18 +12097,18 @@ void Gambit_fn_021D22F0(CPUState* cpu) {
         /* 021D22F4 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021D22F4 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021D22F8 */ cpu->r[31] = cpu->r[3];
-        /* 021D22F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021D22F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021D22FC */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021D22FC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021D2300 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2300 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2300 */ _t4 = _t3 & 0x00000001u;
         /* 021D2300 */ if (_t4) goto L_021D2304; else goto L_021D2314;
   L_021D2304: ; // 0x21d2304
         /* 021D2304 */ cpu->r[3] = 0x00000244u;
         /* 021D2308 */ Gambit_fn_02801A78(cpu);
         /* 021D230C */ cpu->r[31] = cpu->r[3];
-        /* 021D230C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021D2310 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D230C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021D2310 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2310 */ _t6 = _t5 & 0x00000001u;
         /* 021D2310 */ if (_t6) goto L_021D2330; else goto L_021D2314;
   L_021D2314: ; // 0x21d2314
@@ -12302,10 +12302,10 @@ void Gambit_fn_021D2348(CPUState* cpu) {
         /* 021C5D38 */ _t60 = cpu->r[5] + 0xFFFFB604u;
         /* 021C5D38 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t60);
         /* 021C5D3C */ cpu->r[7] = 0x10030000u;
-        /* 021C5D40 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[29]);
+        /* 021C5D40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[29]));
         /* 021C5D44 */ _t61 = cpu->r[7] + 0xFFFFB600u;
         /* 021C5D44 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t61);
-        /* 021C5D48 */ _t62 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C5D48 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C5D48 */ _t63 = _t62 & 0x00000001u;
         /* 021C5D48 */ if (_t63) goto L_021C5D4C; else goto L_021C5D7C;
   L_021C5D4C: ; // 0x21c5d4c
@@ -12348,8 +12348,8 @@ void Gambit_fn_021D2348(CPUState* cpu) {
         /* 021C5DA8 */ cpu->f[12] = cpu->f[27] * cpu->f[27];
         /* 021C5DAC */ cpu->f[13] = fma(cpu->f[28], cpu->f[28], cpu->f[12]);
         /* 021C5DB0 */ cpu->f[6] = fma(cpu->f[26], cpu->f[26], cpu->f[13]);
-        /* 021C5DB4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[29]);
-        /* 021C5DB8 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C5DB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[29]));
+        /* 021C5DB8 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C5DB8 */ _t77 = _t76 & 0x00000001u;
         /* 021C5DB8 */ if (_t77) goto L_021C5DC4; else goto L_021C5DBC;
   L_021C5DBC: ; // 0x21c5dbc
@@ -12543,13 +12543,13 @@ void Gambit_fn_021D2348(CPUState* cpu) {
         /* 021C5F74 */ Gambit_fn_023C9CBC(cpu);
         /* 021C5F78 */ _t151 = cpu->r[28] + 0x0000001Cu;
         /* 021C5F78 */ cpu->r[0] = rbrew_read32(cpu->mem, _t151);
-        /* 021C5F7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021C5F80 */ _t152 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C5F7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021C5F80 */ _t152 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C5F80 */ _t153 = _t152 & 0x00000001u;
         /* 021C5F80 */ if (_t153) goto L_021C5F8C; else goto L_021C5F84;
   L_021C5F84: ; // 0x21c5f84
-        /* 021C5F84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021C5F88 */ _t154 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C5F84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021C5F88 */ _t154 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C5F88 */ _t155 = _t154 & 0x00000001u;
         /* 021C5F88 */ if (_t155) goto L_021C5F8C; else goto L_021C5FE8;
   L_021C5F8C: ; // 0x21c5f8c
@@ -12608,9 +12608,9 @@ void Gambit_fn_021D2348(CPUState* cpu) {
         /* 021C6014 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t172);
         /* 021C6018 */ cpu->f[12] = fma(cpu->f[7], cpu->f[7], cpu->f[10]);
         /* 021C601C */ cpu->f[8] = fma(cpu->f[6], cpu->f[6], cpu->f[12]);
-        /* 021C6020 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[29]);
+        /* 021C6020 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[29]));
         /* 021C6024 */ cpu->f[28] = cpu->f[1];
-        /* 021C6028 */ _t173 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6028 */ _t173 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C6028 */ _t174 = _t173 & 0x00000001u;
         /* 021C6028 */ if (_t174) goto L_021C602C; else goto L_021C6058;
   L_021C602C: ; // 0x21c602c
@@ -12660,7 +12660,7 @@ void Gambit_fn_021D2348(CPUState* cpu) {
         /* 021C60A4 */ cpu->r[5] = 0x10030000u;
         /* 021C60A8 */ _t187 = cpu->r[8] + 0xFFFF958Cu;
         /* 021C60A8 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t187);
-        /* 021C60AC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[27], cpu->f[29]);
+        /* 021C60AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[27], cpu->f[29]));
         /* 021C60B0 */ _t188 = cpu->r[1] + 0x000000E0u;
         /* 021C60B0 */ rbrew_write32(cpu->mem, _t188, cpu->r[12]);
         /* 021C60B4 */ /* nop */
@@ -12688,11 +12688,11 @@ void Gambit_fn_021D2348(CPUState* cpu) {
   L_021C60F8: ; // 0x21c60f8
         /* 021C60F8 */ cpu->r[3] = cpu->r[1] + 0x00000024u;
         /* 021C60FC */ Gambit_fn_02043AC4(cpu);
-        /* 021C6100 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021C6100 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021C6104 */ _t194 = cpu->r[25] + 0x00000000u;
         /* 021C6104 */ cpu->r[3] = rbrew_read32(cpu->mem, _t194);
         /* 021C6108 */ cpu->f[3] = cpu->f[31];
-        /* 021C610C */ _t195 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C610C */ _t195 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C610C */ _t196 = _t195 & 0x00000001u;
         /* 021C610C */ if (_t196) goto L_021C6150; else goto L_021C6110;
   L_021C6110: ; // 0x21c6110
@@ -12711,10 +12711,10 @@ void Gambit_fn_021D2348(CPUState* cpu) {
         /* 021C6138 */ rbrew_write32(cpu->mem, _t198, cpu->r[0]);
         /* 021C613C */ Gambit_fn_0204A4DC(cpu);
         /* 021C6140 */ cpu->r[9] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C6140 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021C6140 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021C6144 */ _t199 = cpu->r[1] + 0x00000024u;
         /* 021C6144 */ rbrew_write32(cpu->mem, _t199, cpu->r[3]);
-        /* 021C6148 */ _t200 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6148 */ _t200 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6148 */ _t201 = _t200 & 0x00000001u;
         /* 021C6148 */ if (_t201) goto L_021C64AC; else goto L_021C614C;
   L_021C614C: ; // 0x21c614c
@@ -12732,10 +12732,10 @@ void Gambit_fn_021D2348(CPUState* cpu) {
         /* 021C6170 */ cpu->r[9] = cpu->r[1] + 0x00000024u;
         /* 021C6174 */ Gambit_fn_0204A864(cpu);
         /* 021C6178 */ cpu->r[9] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C6178 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021C6178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021C617C */ _t203 = cpu->r[1] + 0x00000024u;
         /* 021C617C */ rbrew_write32(cpu->mem, _t203, cpu->r[3]);
-        /* 021C6180 */ _t204 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6180 */ _t204 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6180 */ _t205 = _t204 & 0x00000001u;
         /* 021C6180 */ if (_t205) goto L_021C64AC; else goto L_021C6184;
   L_021C6184: ; // 0x21c6184
@@ -12744,25 +12744,25 @@ void Gambit_fn_021D2348(CPUState* cpu) {
         /* 021C6188 */ _t207 = cpu->r[31] + 0x0000015Cu;
         /* 021C6188 */ cpu->r[4] = rbrew_read32(cpu->mem, _t207);
         /* 021C618C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021C618C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021C618C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021C6190 */ _t208 = cpu->r[31] + 0x00000000u;
         /* 021C6190 */ cpu->r[7] = rbrew_read32(cpu->mem, _t208);
-        /* 021C6194 */ _t209 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6194 */ _t209 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6194 */ _t210 = _t209 & 0x00000001u;
         /* 021C6194 */ if (_t210) goto L_021C6224; else goto L_021C6198;
   L_021C6198: ; // 0x21c6198
         /* 021C6198 */ cpu->r[7] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021C6198 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021C619C */ _t211 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6198 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021C619C */ _t211 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C619C */ _t212 = _t211 & 0x00000001u;
         /* 021C619C */ if (_t212) goto L_021C61D8; else goto L_021C61A0;
   L_021C61A0: ; // 0x21c61a0
         /* 021C61A0 */ cpu->r[3] = cpu->r[31] + 0x00000138u;
         /* 021C61A4 */ Gambit_fn_02C69350(cpu);
-        /* 021C61A8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[29]);
+        /* 021C61A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[29]));
         /* 021C61AC */ _t213 = cpu->r[31] + 0x00000000u;
         /* 021C61AC */ cpu->r[6] = rbrew_read32(cpu->mem, _t213);
-        /* 021C61B0 */ _t214 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C61B0 */ _t214 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C61B0 */ _t215 = _t214 & 0x00000001u;
         /* 021C61B0 */ if (_t215) goto L_021C61B4; else goto L_021C61D0;
   L_021C61B4: ; // 0x21c61b4
@@ -12805,27 +12805,27 @@ void Gambit_fn_021D2348(CPUState* cpu) {
         /* 021C620C */ _t228 = cpu->r[1] + 0x0000003Cu;
         /* 021C620C */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t228);
         /* 021C6210 */ cpu->f[10] = fma(cpu->f[7], cpu->f[8], cpu->f[0]);
-        /* 021C6214 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[29]);
+        /* 021C6214 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[29]));
         /* 021C6218 */ _t229 = cpu->r[1] + 0x00000060u;
         /* 021C6218 */ rbrew_write32(cpu->mem, _t229, cpu->r[5]);
-        /* 021C621C */ _t230 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C621C */ _t230 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C621C */ _t231 = _t230 & 0x00000001u;
         /* 021C621C */ if (_t231) goto L_021C6310; else goto L_021C6220;
   L_021C6220: ; // 0x21c6220
         /* 021C6220 */ goto L_021C62AC;
   L_021C6224: ; // 0x21c6224
         /* 021C6224 */ cpu->r[6] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C6224 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 021C6228 */ _t232 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6224 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 021C6228 */ _t232 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6228 */ _t233 = _t232 & 0x00000001u;
         /* 021C6228 */ if (_t233) goto L_021C6264; else goto L_021C622C;
   L_021C622C: ; // 0x21c622c
         /* 021C622C */ cpu->r[3] = cpu->r[31] + 0x0000012Cu;
         /* 021C6230 */ Gambit_fn_02C69350(cpu);
-        /* 021C6234 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[29]);
+        /* 021C6234 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[29]));
         /* 021C6238 */ _t234 = cpu->r[31] + 0x00000000u;
         /* 021C6238 */ cpu->r[11] = rbrew_read32(cpu->mem, _t234);
-        /* 021C623C */ _t235 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C623C */ _t235 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C623C */ _t236 = _t235 & 0x00000001u;
         /* 021C623C */ if (_t236) goto L_021C6240; else goto L_021C625C;
   L_021C6240: ; // 0x21c6240
@@ -12868,10 +12868,10 @@ void Gambit_fn_021D2348(CPUState* cpu) {
         /* 021C6298 */ _t249 = cpu->r[1] + 0x0000003Cu;
         /* 021C6298 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t249);
         /* 021C629C */ cpu->f[10] = fma(cpu->f[7], cpu->f[8], cpu->f[0]);
-        /* 021C62A0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[29]);
+        /* 021C62A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[29]));
         /* 021C62A4 */ _t250 = cpu->r[1] + 0x00000060u;
         /* 021C62A4 */ rbrew_write32(cpu->mem, _t250, cpu->r[5]);
-        /* 021C62A8 */ _t251 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C62A8 */ _t251 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C62A8 */ _t252 = _t251 & 0x00000001u;
         /* 021C62A8 */ if (_t252) goto L_021C6310; else goto L_021C62AC;
   L_021C62AC: ; // 0x21c62ac
@@ -12915,10 +12915,10 @@ void Gambit_fn_021D2348(CPUState* cpu) {
         /* 021C62FC */ _t270 = cpu->r[28] + 0x000001D4u;
         /* 021C62FC */ rbrew_write_f32(cpu->mem, _t270, cpu->f[8]);
         /* 021C6300 */ cpu->r[24] = cpu->r[24] + 0xFFFFFFFFu;
-        /* 021C6300 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 021C6300 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 021C6304 */ _t271 = cpu->r[1] + 0x00000020u;
         /* 021C6304 */ rbrew_write_f32(cpu->mem, _t271, cpu->f[9]);
-        /* 021C6308 */ _t272 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6308 */ _t272 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6308 */ _t273 = _t272 & 0x00000001u;
         /* 021C6308 */ if (_t273) goto L_021C630C; else goto L_021C60F8;
   L_021C630C: ; // 0x21c630c
@@ -12929,27 +12929,27 @@ void Gambit_fn_021D2348(CPUState* cpu) {
         /* 021C6314 */ _t275 = cpu->r[29] + 0x0000015Cu;
         /* 021C6314 */ cpu->r[6] = rbrew_read32(cpu->mem, _t275);
         /* 021C6318 */ cpu->r[5] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021C6318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021C6318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021C631C */ _t276 = cpu->r[29] + 0x00000000u;
         /* 021C631C */ cpu->r[0] = rbrew_read32(cpu->mem, _t276);
-        /* 021C6320 */ _t277 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6320 */ _t277 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6320 */ _t278 = _t277 & 0x00000001u;
         /* 021C6320 */ if (_t278) goto L_021C63C4; else goto L_021C6324;
   L_021C6324: ; // 0x21c6324
         /* 021C6324 */ cpu->r[7] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021C6324 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021C6324 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021C6328 */ cpu->r[31] = cpu->r[29] + 0x000000A8u;
         /* 021C632C */ cpu->r[30] = cpu->r[29] + 0x000000C0u;
-        /* 021C6330 */ _t279 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6330 */ _t279 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6330 */ _t280 = _t279 & 0x00000001u;
         /* 021C6330 */ if (_t280) goto L_021C636C; else goto L_021C6334;
   L_021C6334: ; // 0x21c6334
         /* 021C6334 */ cpu->r[3] = cpu->r[29] + 0x00000138u;
         /* 021C6338 */ Gambit_fn_02C69350(cpu);
-        /* 021C633C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[29]);
+        /* 021C633C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[29]));
         /* 021C6340 */ _t281 = cpu->r[29] + 0x00000000u;
         /* 021C6340 */ cpu->r[9] = rbrew_read32(cpu->mem, _t281);
-        /* 021C6344 */ _t282 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6344 */ _t282 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C6344 */ _t283 = _t282 & 0x00000001u;
         /* 021C6344 */ if (_t283) goto L_021C6348; else goto L_021C6364;
   L_021C6348: ; // 0x21c6348
@@ -13003,19 +13003,19 @@ void Gambit_fn_021D2348(CPUState* cpu) {
         /* 021C63C0 */ goto L_021C6460;
   L_021C63C4: ; // 0x21c63c4
         /* 021C63C4 */ cpu->r[11] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C63C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021C63C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021C63C8 */ cpu->r[31] = cpu->r[29] + 0x00000048u;
         /* 021C63CC */ cpu->r[30] = cpu->r[29] + 0x00000060u;
-        /* 021C63D0 */ _t299 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C63D0 */ _t299 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C63D0 */ _t300 = _t299 & 0x00000001u;
         /* 021C63D0 */ if (_t300) goto L_021C640C; else goto L_021C63D4;
   L_021C63D4: ; // 0x21c63d4
         /* 021C63D4 */ cpu->r[3] = cpu->r[29] + 0x0000012Cu;
         /* 021C63D8 */ Gambit_fn_02C69350(cpu);
-        /* 021C63DC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[29]);
+        /* 021C63DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[29]));
         /* 021C63E0 */ _t301 = cpu->r[29] + 0x00000000u;
         /* 021C63E0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t301);
-        /* 021C63E4 */ _t302 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C63E4 */ _t302 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C63E4 */ _t303 = _t302 & 0x00000001u;
         /* 021C63E4 */ if (_t303) goto L_021C63E8; else goto L_021C6404;
   L_021C63E8: ; // 0x21c63e8
@@ -13097,10 +13097,10 @@ void Gambit_fn_021D2348(CPUState* cpu) {
         /* 021C649C */ _t331 = cpu->r[28] + 0x000001D4u;
         /* 021C649C */ rbrew_write_f32(cpu->mem, _t331, cpu->f[8]);
         /* 021C64A0 */ cpu->r[24] = cpu->r[24] + 0xFFFFFFFFu;
-        /* 021C64A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 021C64A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 021C64A4 */ _t332 = cpu->r[1] + 0x00000020u;
         /* 021C64A4 */ rbrew_write_f32(cpu->mem, _t332, cpu->f[9]);
-        /* 021C64A8 */ _t333 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C64A8 */ _t333 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C64A8 */ _t334 = _t333 & 0x00000001u;
         /* 021C64A8 */ if (_t334) goto L_021C64AC; else goto L_021C60F8;
   L_021C64AC: ; // 0x21c64ac
@@ -13134,7 +13134,7 @@ void Gambit_fn_021D2348(CPUState* cpu) {
         /* 021C64E8 */ cpu->f[26] = rbrew_read_f64(cpu->mem, _t346);
         /* 021C64EC */ _t347 = cpu->r[1] + 0x00000158u;
         /* 021C64EC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t347);
-        /* 021C64F0 */ _t348 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C64F0 */ _t348 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C64F0 */ _t349 = _t348 & 0x00000001u;
         /* 021C64F0 */ if (_t349) goto L_021C64F4; // else: addr-0 trap, fall-through
   L_021C64F4: ; // 0x21c64f4
@@ -13178,8 +13178,8 @@ void Gambit_fn_021D2358(CPUState* cpu) {
         /* 021D2370 */ cpu->ctr = cpu->r[0];
         /* 021D2374 */ cpu->r[31] = 0xFFFFFFFFu;
         /* 021D2378 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D237C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000003u);
-        /* 021D2380 */ _t5 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D237C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000003u));
+        /* 021D2380 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D2380 */ _t6 = _t5 & 0x00000001u;
         /* 021D2380 */ if (_t6) goto L_021D2394; else goto L_021D2384;
   L_021D2384: ; // 0x21d2384
@@ -13194,9 +13194,9 @@ void Gambit_fn_021D2358(CPUState* cpu) {
         /* 021D2394 */ cpu->r[11] = 0x101C0000u;
         /* 021D2398 */ _t10 = cpu->r[11] + 0x00001838u;
         /* 021D2398 */ cpu->r[11] = rbrew_read32(cpu->mem, _t10);
-        /* 021D239C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], 0x00000014u);
+        /* 021D239C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], 0x00000014u));
         /* 021D23A0 */ cpu->r[12] = cpu->r[11] + 0x000000B2u;
-        /* 021D23A4 */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D23A4 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D23A4 */ _t12 = _t11 & 0x00000001u;
         /* 021D23A4 */ if (_t12) goto L_021D23A8; else goto L_021D23B0;
   L_021D23A8: ; // 0x21d23a8
@@ -13233,8 +13233,8 @@ void Gambit_fn_021D235C(CPUState* cpu) {
         /* 021D2370 */ cpu->ctr = cpu->r[0];
         /* 021D2374 */ cpu->r[31] = 0xFFFFFFFFu;
         /* 021D2378 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D237C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000003u);
-        /* 021D2380 */ _t5 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D237C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000003u));
+        /* 021D2380 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D2380 */ _t6 = _t5 & 0x00000001u;
         /* 021D2380 */ if (_t6) goto L_021D2394; else goto L_021D2384;
   L_021D2384: ; // 0x21d2384
@@ -13249,9 +13249,9 @@ void Gambit_fn_021D235C(CPUState* cpu) {
         /* 021D2394 */ cpu->r[11] = 0x101C0000u;
         /* 021D2398 */ _t10 = cpu->r[11] + 0x00001838u;
         /* 021D2398 */ cpu->r[11] = rbrew_read32(cpu->mem, _t10);
-        /* 021D239C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], 0x00000014u);
+        /* 021D239C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], 0x00000014u));
         /* 021D23A0 */ cpu->r[12] = cpu->r[11] + 0x000000B2u;
-        /* 021D23A4 */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D23A4 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D23A4 */ _t12 = _t11 & 0x00000001u;
         /* 021D23A4 */ if (_t12) goto L_021D23A8; else goto L_021D23B0;
   L_021D23A8: ; // 0x21d23a8
@@ -13307,8 +13307,8 @@ void Gambit_fn_021D23DC(CPUState* cpu) {
         /* 021D23DC */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D23DC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D23E0 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021D23E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D23E4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D23E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D23E4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D23E4 */ _t2 = _t1 & 0x00000001u;
         /* 021D23E4 */ _t3 = _t2 ^ 0x00000001u;
         /* 021D23E4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -13330,8 +13330,8 @@ void Gambit_fn_021D23F8(CPUState* cpu) {
         /* 021D23F8 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D23F8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D23FC */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021D23FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D2400 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D23FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D2400 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2400 */ _t2 = _t1 & 0x00000001u;
         /* 021D2400 */ _t3 = _t2 ^ 0x00000001u;
         /* 021D2400 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -13353,8 +13353,8 @@ void Gambit_fn_021D2414(CPUState* cpu) {
         /* 021D2414 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D2414 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D2418 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021D2418 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D241C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D241C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D241C */ _t2 = _t1 & 0x00000001u;
         /* 021D241C */ _t3 = _t2 ^ 0x00000001u;
         /* 021D241C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -13397,8 +13397,8 @@ void Gambit_fn_021D2440(CPUState* cpu) {
         /* 021D2450 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D2454 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D2454 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021D2458 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021D245C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2458 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021D245C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D245C */ _t5 = _t4 & 0x00000001u;
         /* 021D245C */ if (_t5) goto L_021D2460; else goto L_021D247C;
   L_021D2460: ; // 0x21d2460
@@ -13437,8 +13437,8 @@ void Gambit_fn_021D2444(CPUState* cpu) {
         /* 021D2450 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D2454 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D2454 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021D2458 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021D245C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2458 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021D245C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D245C */ _t5 = _t4 & 0x00000001u;
         /* 021D245C */ if (_t5) goto L_021D2460; else goto L_021D247C;
   L_021D2460: ; // 0x21d2460
@@ -315,13 +315,13 @@ void Gambit_fn_021D25F0(CPUState* cpu) {
         /* 021D2600 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D2604 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D2604 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021D2608 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021D260C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2608 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021D260C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D260C */ _t5 = _t4 & 0x00000001u;
         /* 021D260C */ if (_t5) goto L_021D2618; else goto L_021D2610;
   L_021D2610: ; // 0x21d2610
-        /* 021D2610 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021D2614 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2610 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021D2614 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2614 */ _t7 = _t6 & 0x00000001u;
         /* 021D2614 */ if (_t7) goto L_021D2618; else goto L_021D2650;
   L_021D2618: ; // 0x21d2618
@@ -332,8 +332,8 @@ void Gambit_fn_021D25F0(CPUState* cpu) {
         /* 021D2620 */ cpu->ctr = cpu->r[0];
         /* 021D2624 */ cpu->r[3] = cpu->r[31];
         /* 021D2628 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D262C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D2630 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D262C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D2630 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2630 */ _t11 = _t10 & 0x00000001u;
         /* 021D2630 */ if (_t11) goto L_021D2634; else goto L_021D2650;
   L_021D2634: ; // 0x21d2634
@@ -371,13 +371,13 @@ void Gambit_fn_021D25F4(CPUState* cpu) {
         /* 021D2600 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D2604 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D2604 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021D2608 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021D260C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2608 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021D260C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D260C */ _t5 = _t4 & 0x00000001u;
         /* 021D260C */ if (_t5) goto L_021D2618; else goto L_021D2610;
   L_021D2610: ; // 0x21d2610
-        /* 021D2610 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021D2614 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2610 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021D2614 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2614 */ _t7 = _t6 & 0x00000001u;
         /* 021D2614 */ if (_t7) goto L_021D2618; else goto L_021D2650;
   L_021D2618: ; // 0x21d2618
@@ -388,8 +388,8 @@ void Gambit_fn_021D25F4(CPUState* cpu) {
         /* 021D2620 */ cpu->ctr = cpu->r[0];
         /* 021D2624 */ cpu->r[3] = cpu->r[31];
         /* 021D2628 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D262C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D2630 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D262C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D2630 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2630 */ _t11 = _t10 & 0x00000001u;
         /* 021D2630 */ if (_t11) goto L_021D2634; else goto L_021D2650;
   L_021D2634: ; // 0x21d2634
@@ -428,10 +428,10 @@ void Gambit_fn_021D2670(CPUState* cpu) {
         /* 021D2670 */ cpu->r[10] = 0x101D0000u;
         /* 021D2674 */ _t0 = cpu->r[10] + 0xFFFFFB70u;
         /* 021D2674 */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 021D2678 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021D2678 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021D267C */ cpu->r[10] = 0x101D0000u;
         /* 021D2680 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBDCu;
-        /* 021D2684 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2684 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2684 */ _t2 = _t1 & 0x00000001u;
         /* 021D2684 */ if (_t2) goto L_021D2688; else goto L_021D26A0;
   L_021D2688: ; // 0x21d2688
@@ -444,8 +444,8 @@ void Gambit_fn_021D2670(CPUState* cpu) {
         /* 021D269C */ _t4 = cpu->r[10] + 0x00000000u;
         /* 021D269C */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_021D26A0: ; // 0x21d26a0
-        /* 021D26A0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021D26A4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D26A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021D26A4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D26A4 */ _t6 = _t5 & 0x00000001u;
         /* 021D26A4 */ if (_t6) goto L_021D26A8; else goto L_021D26B0;
   L_021D26A8: ; // 0x21d26a8
@@ -456,9 +456,9 @@ void Gambit_fn_021D2670(CPUState* cpu) {
         /* 021D26B4 */ _t7 = cpu->r[9] + 0xFFFFE5E4u;
         /* 021D26B4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 021D26B8 */ cpu->r[11] = 0x101D0000u;
-        /* 021D26BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021D26BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021D26C0 */ cpu->r[11] = cpu->r[11] + 0xFFFFFB60u;
-        /* 021D26C4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D26C4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D26C4 */ _t9 = _t8 & 0x00000001u;
         /* 021D26C4 */ if (_t9) goto L_021D26C8; else goto L_021D26E0;
   L_021D26C8: ; // 0x21d26c8
@@ -471,8 +471,8 @@ void Gambit_fn_021D2670(CPUState* cpu) {
         /* 021D26DC */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021D26DC */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021D26E0: ; // 0x21d26e0
-        /* 021D26E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021D26E4 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D26E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021D26E4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D26E4 */ _t13 = _t12 & 0x00000001u;
         /* 021D26E4 */ if (_t13) goto L_021D26E8; else goto L_021D26F0;
   L_021D26E8: ; // 0x21d26e8
@@ -483,9 +483,9 @@ void Gambit_fn_021D2670(CPUState* cpu) {
         /* 021D26F4 */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021D26F4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 021D26F8 */ cpu->r[9] = 0x101D0000u;
-        /* 021D26FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D26FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D2700 */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 021D2704 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2704 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2704 */ _t16 = _t15 & 0x00000001u;
         /* 021D2704 */ if (_t16) goto L_021D2708; else goto L_021D2720;
   L_021D2708: ; // 0x21d2708
@@ -498,8 +498,8 @@ void Gambit_fn_021D2670(CPUState* cpu) {
         /* 021D271C */ _t18 = cpu->r[9] + 0x00000000u;
         /* 021D271C */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_021D2720: ; // 0x21d2720
-        /* 021D2720 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 021D2724 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2720 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 021D2724 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2724 */ _t20 = _t19 & 0x00000001u;
         /* 021D2724 */ if (_t20) goto L_021D2728; else goto L_021D2730;
   L_021D2728: ; // 0x21d2728
@@ -511,9 +511,9 @@ void Gambit_fn_021D2670(CPUState* cpu) {
         /* 021D2734 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 021D2734 */ cpu->r[9] = _t21;
         /* 021D2738 */ cpu->r[10] = 0x101D0000u;
-        /* 021D273C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021D273C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021D2740 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021D2744 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2744 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2744 */ _t23 = _t22 & 0x00000001u;
         /* 021D2744 */ if (_t23) goto L_021D2748; else goto L_021D275C;
   L_021D2748: ; // 0x21d2748
@@ -525,8 +525,8 @@ void Gambit_fn_021D2670(CPUState* cpu) {
         /* 021D2758 */ _t25 = cpu->r[10] + 0x00000000u;
         /* 021D2758 */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_021D275C: ; // 0x21d275c
-        /* 021D275C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021D2760 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D275C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021D2760 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2760 */ _t27 = _t26 & 0x00000001u;
         /* 021D2760 */ if (_t27) goto L_021D2764; else goto L_021D276C;
   L_021D2764: ; // 0x21d2764
@@ -538,9 +538,9 @@ void Gambit_fn_021D2670(CPUState* cpu) {
         /* 021D2770 */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 021D2770 */ cpu->r[10] = _t28;
         /* 021D2774 */ cpu->r[11] = 0x101D0000u;
-        /* 021D2778 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021D2778 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021D277C */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021D2780 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2780 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2780 */ _t30 = _t29 & 0x00000001u;
         /* 021D2780 */ if (_t30) goto L_021D2784; else goto L_021D2798;
   L_021D2784: ; // 0x21d2784
@@ -1194,18 +1194,18 @@ void Gambit_fn_021D2A58(CPUState* cpu) {
         /* 021D2A60 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021D2A60 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021D2A64 */ cpu->r[31] = cpu->r[3];
-        /* 021D2A64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021D2A64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021D2A68 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021D2A68 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021D2A6C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2A6C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2A6C */ _t4 = _t3 & 0x00000001u;
         /* 021D2A6C */ if (_t4) goto L_021D2A70; else goto L_021D2A80;
   L_021D2A70: ; // 0x21d2a70
         /* 021D2A70 */ cpu->r[3] = 0x00000240u;
         /* 021D2A74 */ Gambit_fn_02801A78(cpu);
         /* 021D2A78 */ cpu->r[31] = cpu->r[3];
-        /* 021D2A78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021D2A7C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2A78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021D2A7C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2A7C */ _t6 = _t5 & 0x00000001u;
         /* 021D2A7C */ if (_t6) goto L_021D2A94; else goto L_021D2A80;
   L_021D2A80: ; // 0x21d2a80
@@ -1237,18 +1237,18 @@ void Gambit_fn_021D2A5C(CPUState* cpu) {
         /* 021D2A60 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021D2A60 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021D2A64 */ cpu->r[31] = cpu->r[3];
-        /* 021D2A64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021D2A64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021D2A68 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021D2A68 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021D2A6C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2A6C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2A6C */ _t4 = _t3 & 0x00000001u;
         /* 021D2A6C */ if (_t4) goto L_021D2A70; else goto L_021D2A80;
   L_021D2A70: ; // 0x21d2a70
         /* 021D2A70 */ cpu->r[3] = 0x00000240u;
         /* 021D2A74 */ Gambit_fn_02801A78(cpu);
         /* 021D2A78 */ cpu->r[31] = cpu->r[3];
-        /* 021D2A78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021D2A7C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2A78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021D2A7C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2A7C */ _t6 = _t5 & 0x00000001u;
         /* 021D2A7C */ if (_t6) goto L_021D2A94; else goto L_021D2A80;
   L_021D2A80: ; // 0x21d2a80
@@ -1328,8 +1328,8 @@ void Gambit_fn_021D2AD4(CPUState* cpu) {
         /* 021D2AD4 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D2AD4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D2AD8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021D2AD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D2ADC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2AD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D2ADC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2ADC */ _t2 = _t1 & 0x00000001u;
         /* 021D2ADC */ _t3 = _t2 ^ 0x00000001u;
         /* 021D2ADC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -1351,8 +1351,8 @@ void Gambit_fn_021D2AF0(CPUState* cpu) {
         /* 021D2AF0 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D2AF0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D2AF4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021D2AF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D2AF8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2AF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D2AF8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2AF8 */ _t2 = _t1 & 0x00000001u;
         /* 021D2AF8 */ _t3 = _t2 ^ 0x00000001u;
         /* 021D2AF8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -1374,8 +1374,8 @@ void Gambit_fn_021D2B0C(CPUState* cpu) {
         /* 021D2B0C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D2B0C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D2B10 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021D2B10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D2B14 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2B10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D2B14 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2B14 */ _t2 = _t1 & 0x00000001u;
         /* 021D2B14 */ _t3 = _t2 ^ 0x00000001u;
         /* 021D2B14 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -1418,8 +1418,8 @@ void Gambit_fn_021D2B38(CPUState* cpu) {
         /* 021D2B48 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D2B4C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D2B4C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021D2B50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021D2B54 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2B50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021D2B54 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2B54 */ _t5 = _t4 & 0x00000001u;
         /* 021D2B54 */ if (_t5) goto L_021D2B58; else goto L_021D2B74;
   L_021D2B58: ; // 0x21d2b58
@@ -1458,8 +1458,8 @@ void Gambit_fn_021D2B3C(CPUState* cpu) {
         /* 021D2B48 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D2B4C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D2B4C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021D2B50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021D2B54 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2B50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021D2B54 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2B54 */ _t5 = _t4 & 0x00000001u;
         /* 021D2B54 */ if (_t5) goto L_021D2B58; else goto L_021D2B74;
   L_021D2B58: ; // 0x21d2b58
@@ -1859,13 +1859,13 @@ void Gambit_fn_021D2CFC(CPUState* cpu) {
         /* 021D2D0C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D2D10 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D2D10 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021D2D14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021D2D18 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2D14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021D2D18 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2D18 */ _t5 = _t4 & 0x00000001u;
         /* 021D2D18 */ if (_t5) goto L_021D2D24; else goto L_021D2D1C;
   L_021D2D1C: ; // 0x21d2d1c
-        /* 021D2D1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021D2D20 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2D1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021D2D20 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2D20 */ _t7 = _t6 & 0x00000001u;
         /* 021D2D20 */ if (_t7) goto L_021D2D24; else goto L_021D2D5C;
   L_021D2D24: ; // 0x21d2d24
@@ -1876,8 +1876,8 @@ void Gambit_fn_021D2CFC(CPUState* cpu) {
         /* 021D2D2C */ cpu->ctr = cpu->r[0];
         /* 021D2D30 */ cpu->r[3] = cpu->r[31];
         /* 021D2D34 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D2D38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D2D3C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2D38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D2D3C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2D3C */ _t11 = _t10 & 0x00000001u;
         /* 021D2D3C */ if (_t11) goto L_021D2D40; else goto L_021D2D5C;
   L_021D2D40: ; // 0x21d2d40
@@ -1915,13 +1915,13 @@ void Gambit_fn_021D2D00(CPUState* cpu) {
         /* 021D2D0C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D2D10 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D2D10 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021D2D14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021D2D18 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2D14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021D2D18 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2D18 */ _t5 = _t4 & 0x00000001u;
         /* 021D2D18 */ if (_t5) goto L_021D2D24; else goto L_021D2D1C;
   L_021D2D1C: ; // 0x21d2d1c
-        /* 021D2D1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021D2D20 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2D1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021D2D20 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2D20 */ _t7 = _t6 & 0x00000001u;
         /* 021D2D20 */ if (_t7) goto L_021D2D24; else goto L_021D2D5C;
   L_021D2D24: ; // 0x21d2d24
@@ -1932,8 +1932,8 @@ void Gambit_fn_021D2D00(CPUState* cpu) {
         /* 021D2D2C */ cpu->ctr = cpu->r[0];
         /* 021D2D30 */ cpu->r[3] = cpu->r[31];
         /* 021D2D34 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D2D38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D2D3C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2D38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D2D3C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2D3C */ _t11 = _t10 & 0x00000001u;
         /* 021D2D3C */ if (_t11) goto L_021D2D40; else goto L_021D2D5C;
   L_021D2D40: ; // 0x21d2d40
@@ -1972,10 +1972,10 @@ void Gambit_fn_021D2D7C(CPUState* cpu) {
         /* 021D2D7C */ cpu->r[10] = 0x101D0000u;
         /* 021D2D80 */ _t0 = cpu->r[10] + 0xFFFFFB64u;
         /* 021D2D80 */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 021D2D84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021D2D84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021D2D88 */ cpu->r[10] = 0x101D0000u;
         /* 021D2D8C */ cpu->r[10] = cpu->r[10] + 0xFFFFFBE0u;
-        /* 021D2D90 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2D90 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2D90 */ _t2 = _t1 & 0x00000001u;
         /* 021D2D90 */ if (_t2) goto L_021D2D94; else goto L_021D2DAC;
   L_021D2D94: ; // 0x21d2d94
@@ -1988,8 +1988,8 @@ void Gambit_fn_021D2D7C(CPUState* cpu) {
         /* 021D2DA8 */ _t4 = cpu->r[10] + 0x00000000u;
         /* 021D2DA8 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_021D2DAC: ; // 0x21d2dac
-        /* 021D2DAC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021D2DB0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2DAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021D2DB0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2DB0 */ _t6 = _t5 & 0x00000001u;
         /* 021D2DB0 */ if (_t6) goto L_021D2DB4; else goto L_021D2DBC;
   L_021D2DB4: ; // 0x21d2db4
@@ -2000,9 +2000,9 @@ void Gambit_fn_021D2D7C(CPUState* cpu) {
         /* 021D2DC0 */ _t7 = cpu->r[9] + 0xFFFFE5E4u;
         /* 021D2DC0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 021D2DC4 */ cpu->r[11] = 0x101D0000u;
-        /* 021D2DC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021D2DC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021D2DCC */ cpu->r[11] = cpu->r[11] + 0xFFFFFB60u;
-        /* 021D2DD0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2DD0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2DD0 */ _t9 = _t8 & 0x00000001u;
         /* 021D2DD0 */ if (_t9) goto L_021D2DD4; else goto L_021D2DEC;
   L_021D2DD4: ; // 0x21d2dd4
@@ -2015,8 +2015,8 @@ void Gambit_fn_021D2D7C(CPUState* cpu) {
         /* 021D2DE8 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021D2DE8 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021D2DEC: ; // 0x21d2dec
-        /* 021D2DEC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021D2DF0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2DEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021D2DF0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2DF0 */ _t13 = _t12 & 0x00000001u;
         /* 021D2DF0 */ if (_t13) goto L_021D2DF4; else goto L_021D2DFC;
   L_021D2DF4: ; // 0x21d2df4
@@ -2027,9 +2027,9 @@ void Gambit_fn_021D2D7C(CPUState* cpu) {
         /* 021D2E00 */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021D2E00 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 021D2E04 */ cpu->r[9] = 0x101D0000u;
-        /* 021D2E08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D2E08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D2E0C */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 021D2E10 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2E10 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2E10 */ _t16 = _t15 & 0x00000001u;
         /* 021D2E10 */ if (_t16) goto L_021D2E14; else goto L_021D2E2C;
   L_021D2E14: ; // 0x21d2e14
@@ -2042,8 +2042,8 @@ void Gambit_fn_021D2D7C(CPUState* cpu) {
         /* 021D2E28 */ _t18 = cpu->r[9] + 0x00000000u;
         /* 021D2E28 */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_021D2E2C: ; // 0x21d2e2c
-        /* 021D2E2C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 021D2E30 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2E2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 021D2E30 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2E30 */ _t20 = _t19 & 0x00000001u;
         /* 021D2E30 */ if (_t20) goto L_021D2E34; else goto L_021D2E3C;
   L_021D2E34: ; // 0x21d2e34
@@ -2055,9 +2055,9 @@ void Gambit_fn_021D2D7C(CPUState* cpu) {
         /* 021D2E40 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 021D2E40 */ cpu->r[9] = _t21;
         /* 021D2E44 */ cpu->r[10] = 0x101D0000u;
-        /* 021D2E48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021D2E48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021D2E4C */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021D2E50 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2E50 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2E50 */ _t23 = _t22 & 0x00000001u;
         /* 021D2E50 */ if (_t23) goto L_021D2E54; else goto L_021D2E68;
   L_021D2E54: ; // 0x21d2e54
@@ -2069,8 +2069,8 @@ void Gambit_fn_021D2D7C(CPUState* cpu) {
         /* 021D2E64 */ _t25 = cpu->r[10] + 0x00000000u;
         /* 021D2E64 */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_021D2E68: ; // 0x21d2e68
-        /* 021D2E68 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021D2E6C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2E68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021D2E6C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2E6C */ _t27 = _t26 & 0x00000001u;
         /* 021D2E6C */ if (_t27) goto L_021D2E70; else goto L_021D2E78;
   L_021D2E70: ; // 0x21d2e70
@@ -2082,9 +2082,9 @@ void Gambit_fn_021D2D7C(CPUState* cpu) {
         /* 021D2E7C */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 021D2E7C */ cpu->r[10] = _t28;
         /* 021D2E80 */ cpu->r[11] = 0x101D0000u;
-        /* 021D2E84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021D2E84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021D2E88 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021D2E8C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D2E8C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D2E8C */ _t30 = _t29 & 0x00000001u;
         /* 021D2E8C */ if (_t30) goto L_021D2E90; else goto L_021D2EA4;
   L_021D2E90: ; // 0x21d2e90
@@ -3943,18 +3943,18 @@ void Gambit_fn_021D3718(CPUState* cpu) {
         /* 021D371C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021D371C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021D3720 */ cpu->r[31] = cpu->r[3];
-        /* 021D3720 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021D3720 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021D3724 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021D3724 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021D3728 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3728 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3728 */ _t4 = _t3 & 0x00000001u;
         /* 021D3728 */ if (_t4) goto L_021D372C; else goto L_021D373C;
   L_021D372C: ; // 0x21d372c
         /* 021D372C */ cpu->r[3] = 0x00000244u;
         /* 021D3730 */ Gambit_fn_02801A78(cpu);
         /* 021D3734 */ cpu->r[31] = cpu->r[3];
-        /* 021D3734 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021D3738 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3734 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021D3738 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3738 */ _t6 = _t5 & 0x00000001u;
         /* 021D3738 */ if (_t6) goto L_021D3758; else goto L_021D373C;
   L_021D373C: ; // 0x21d373c
@@ -4077,9 +4077,9 @@ void Gambit_fn_021D378C(CPUState* cpu) {
         /* 021D3790 */ _t1 = cpu->r[3] + 0x00000240u;
         /* 021D3790 */ cpu->r[11] = rbrew_read8(cpu->mem, _t1);
         /* 021D3794 */ /* nop */
-        /* 021D3798 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000003u);
+        /* 021D3798 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000003u));
         /* 021D379C */ cpu->r[0] = 0xFFFFFFFFu;
-        /* 021D37A0 */ _t2 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D37A0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D37A0 */ _t3 = _t2 & 0x00000001u;
         /* 021D37A0 */ if (_t3) goto L_021D37B4; else goto L_021D37A4;
   L_021D37A4: ; // 0x21d37a4
@@ -4094,9 +4094,9 @@ void Gambit_fn_021D378C(CPUState* cpu) {
         /* 021D37B4 */ cpu->r[11] = 0x101C0000u;
         /* 021D37B8 */ _t7 = cpu->r[11] + 0x00001838u;
         /* 021D37B8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t7);
-        /* 021D37BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000014u);
+        /* 021D37BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000014u));
         /* 021D37C0 */ cpu->r[12] = cpu->r[11] + 0x000000B2u;
-        /* 021D37C4 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D37C4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D37C4 */ _t9 = _t8 & 0x00000001u;
         /* 021D37C4 */ if (_t9) goto L_021D37C8; else goto L_021D37D0;
   L_021D37C8: ; // 0x21d37c8
@@ -4147,8 +4147,8 @@ void Gambit_fn_021D37F0(CPUState* cpu) {
         /* 021D37F0 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D37F0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D37F4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021D37F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D37F8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D37F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D37F8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D37F8 */ _t2 = _t1 & 0x00000001u;
         /* 021D37F8 */ _t3 = _t2 ^ 0x00000001u;
         /* 021D37F8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -4170,8 +4170,8 @@ void Gambit_fn_021D380C(CPUState* cpu) {
         /* 021D380C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D380C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D3810 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021D3810 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D3814 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3810 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D3814 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3814 */ _t2 = _t1 & 0x00000001u;
         /* 021D3814 */ _t3 = _t2 ^ 0x00000001u;
         /* 021D3814 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -4193,8 +4193,8 @@ void Gambit_fn_021D3828(CPUState* cpu) {
         /* 021D3828 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D3828 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D382C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021D382C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D3830 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D382C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D3830 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3830 */ _t2 = _t1 & 0x00000001u;
         /* 021D3830 */ _t3 = _t2 ^ 0x00000001u;
         /* 021D3830 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -4237,8 +4237,8 @@ void Gambit_fn_021D3854(CPUState* cpu) {
         /* 021D3864 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D3868 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D3868 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021D386C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021D3870 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D386C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021D3870 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3870 */ _t5 = _t4 & 0x00000001u;
         /* 021D3870 */ if (_t5) goto L_021D3874; else goto L_021D3890;
   L_021D3874: ; // 0x21d3874
@@ -4277,8 +4277,8 @@ void Gambit_fn_021D3858(CPUState* cpu) {
         /* 021D3864 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D3868 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D3868 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021D386C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021D3870 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D386C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021D3870 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3870 */ _t5 = _t4 & 0x00000001u;
         /* 021D3870 */ if (_t5) goto L_021D3874; else goto L_021D3890;
   L_021D3874: ; // 0x21d3874
@@ -4678,13 +4678,13 @@ void Gambit_fn_021D3A18(CPUState* cpu) {
         /* 021D3A28 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D3A2C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D3A2C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021D3A30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021D3A34 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3A30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021D3A34 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3A34 */ _t5 = _t4 & 0x00000001u;
         /* 021D3A34 */ if (_t5) goto L_021D3A40; else goto L_021D3A38;
   L_021D3A38: ; // 0x21d3a38
-        /* 021D3A38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021D3A3C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3A38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021D3A3C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3A3C */ _t7 = _t6 & 0x00000001u;
         /* 021D3A3C */ if (_t7) goto L_021D3A40; else goto L_021D3A78;
   L_021D3A40: ; // 0x21d3a40
@@ -4695,8 +4695,8 @@ void Gambit_fn_021D3A18(CPUState* cpu) {
         /* 021D3A48 */ cpu->ctr = cpu->r[0];
         /* 021D3A4C */ cpu->r[3] = cpu->r[31];
         /* 021D3A50 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D3A54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D3A58 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3A54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D3A58 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3A58 */ _t11 = _t10 & 0x00000001u;
         /* 021D3A58 */ if (_t11) goto L_021D3A5C; else goto L_021D3A78;
   L_021D3A5C: ; // 0x21d3a5c
@@ -4734,13 +4734,13 @@ void Gambit_fn_021D3A1C(CPUState* cpu) {
         /* 021D3A28 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D3A2C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D3A2C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021D3A30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021D3A34 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3A30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021D3A34 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3A34 */ _t5 = _t4 & 0x00000001u;
         /* 021D3A34 */ if (_t5) goto L_021D3A40; else goto L_021D3A38;
   L_021D3A38: ; // 0x21d3a38
-        /* 021D3A38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021D3A3C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3A38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021D3A3C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3A3C */ _t7 = _t6 & 0x00000001u;
         /* 021D3A3C */ if (_t7) goto L_021D3A40; else goto L_021D3A78;
   L_021D3A40: ; // 0x21d3a40
@@ -4751,8 +4751,8 @@ void Gambit_fn_021D3A1C(CPUState* cpu) {
         /* 021D3A48 */ cpu->ctr = cpu->r[0];
         /* 021D3A4C */ cpu->r[3] = cpu->r[31];
         /* 021D3A50 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D3A54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D3A58 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3A54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D3A58 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3A58 */ _t11 = _t10 & 0x00000001u;
         /* 021D3A58 */ if (_t11) goto L_021D3A5C; else goto L_021D3A78;
   L_021D3A5C: ; // 0x21d3a5c
@@ -4791,10 +4791,10 @@ void Gambit_fn_021D3A98(CPUState* cpu) {
         /* 021D3A98 */ cpu->r[10] = 0x101D0000u;
         /* 021D3A9C */ _t0 = cpu->r[10] + 0xFFFFFB84u;
         /* 021D3A9C */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 021D3AA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021D3AA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021D3AA4 */ cpu->r[10] = 0x101D0000u;
         /* 021D3AA8 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBE4u;
-        /* 021D3AAC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3AAC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3AAC */ _t2 = _t1 & 0x00000001u;
         /* 021D3AAC */ if (_t2) goto L_021D3AB0; else goto L_021D3AC8;
   L_021D3AB0: ; // 0x21d3ab0
@@ -4807,8 +4807,8 @@ void Gambit_fn_021D3A98(CPUState* cpu) {
         /* 021D3AC4 */ _t4 = cpu->r[10] + 0x00000000u;
         /* 021D3AC4 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_021D3AC8: ; // 0x21d3ac8
-        /* 021D3AC8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021D3ACC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3AC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021D3ACC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3ACC */ _t6 = _t5 & 0x00000001u;
         /* 021D3ACC */ if (_t6) goto L_021D3AD0; else goto L_021D3AD8;
   L_021D3AD0: ; // 0x21d3ad0
@@ -4819,9 +4819,9 @@ void Gambit_fn_021D3A98(CPUState* cpu) {
         /* 021D3ADC */ _t7 = cpu->r[9] + 0xFFFFE5E4u;
         /* 021D3ADC */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 021D3AE0 */ cpu->r[11] = 0x101D0000u;
-        /* 021D3AE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021D3AE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021D3AE8 */ cpu->r[11] = cpu->r[11] + 0xFFFFFB60u;
-        /* 021D3AEC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3AEC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3AEC */ _t9 = _t8 & 0x00000001u;
         /* 021D3AEC */ if (_t9) goto L_021D3AF0; else goto L_021D3B08;
   L_021D3AF0: ; // 0x21d3af0
@@ -4834,8 +4834,8 @@ void Gambit_fn_021D3A98(CPUState* cpu) {
         /* 021D3B04 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021D3B04 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021D3B08: ; // 0x21d3b08
-        /* 021D3B08 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021D3B0C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3B08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021D3B0C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3B0C */ _t13 = _t12 & 0x00000001u;
         /* 021D3B0C */ if (_t13) goto L_021D3B10; else goto L_021D3B18;
   L_021D3B10: ; // 0x21d3b10
@@ -4846,9 +4846,9 @@ void Gambit_fn_021D3A98(CPUState* cpu) {
         /* 021D3B1C */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021D3B1C */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 021D3B20 */ cpu->r[9] = 0x101D0000u;
-        /* 021D3B24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D3B24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D3B28 */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 021D3B2C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3B2C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3B2C */ _t16 = _t15 & 0x00000001u;
         /* 021D3B2C */ if (_t16) goto L_021D3B30; else goto L_021D3B48;
   L_021D3B30: ; // 0x21d3b30
@@ -4861,8 +4861,8 @@ void Gambit_fn_021D3A98(CPUState* cpu) {
         /* 021D3B44 */ _t18 = cpu->r[9] + 0x00000000u;
         /* 021D3B44 */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_021D3B48: ; // 0x21d3b48
-        /* 021D3B48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 021D3B4C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3B48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 021D3B4C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3B4C */ _t20 = _t19 & 0x00000001u;
         /* 021D3B4C */ if (_t20) goto L_021D3B50; else goto L_021D3B58;
   L_021D3B50: ; // 0x21d3b50
@@ -4874,9 +4874,9 @@ void Gambit_fn_021D3A98(CPUState* cpu) {
         /* 021D3B5C */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 021D3B5C */ cpu->r[9] = _t21;
         /* 021D3B60 */ cpu->r[10] = 0x101D0000u;
-        /* 021D3B64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021D3B64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021D3B68 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021D3B6C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3B6C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3B6C */ _t23 = _t22 & 0x00000001u;
         /* 021D3B6C */ if (_t23) goto L_021D3B70; else goto L_021D3B84;
   L_021D3B70: ; // 0x21d3b70
@@ -4888,8 +4888,8 @@ void Gambit_fn_021D3A98(CPUState* cpu) {
         /* 021D3B80 */ _t25 = cpu->r[10] + 0x00000000u;
         /* 021D3B80 */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_021D3B84: ; // 0x21d3b84
-        /* 021D3B84 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021D3B88 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3B84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021D3B88 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3B88 */ _t27 = _t26 & 0x00000001u;
         /* 021D3B88 */ if (_t27) goto L_021D3B8C; else goto L_021D3B94;
   L_021D3B8C: ; // 0x21d3b8c
@@ -4901,9 +4901,9 @@ void Gambit_fn_021D3A98(CPUState* cpu) {
         /* 021D3B98 */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 021D3B98 */ cpu->r[10] = _t28;
         /* 021D3B9C */ cpu->r[11] = 0x101D0000u;
-        /* 021D3BA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021D3BA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021D3BA4 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021D3BA8 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3BA8 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3BA8 */ _t30 = _t29 & 0x00000001u;
         /* 021D3BA8 */ if (_t30) goto L_021D3BAC; else goto L_021D3BC0;
   L_021D3BAC: ; // 0x21d3bac
@@ -5620,15 +5620,15 @@ void Gambit_fn_021D3ED8(CPUState* cpu) {
         /* 021D3EE0 */ cpu->r[1] = _t1;
         /* 021D3EE4 */ _t2 = cpu->r[3] + 0x00000054u;
         /* 021D3EE4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t2);
-        /* 021D3EE8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[4]);
-        /* 021D3EEC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3EE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[4]));
+        /* 021D3EEC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3EEC */ _t4 = _t3 & 0x00000001u;
         /* 021D3EEC */ if (_t4) goto L_021D3EF0; else goto L_021D3EFC;
   L_021D3EF0: ; // 0x21d3ef0
         /* 021D3EF0 */ _t5 = cpu->r[3] + 0x00000243u;
         /* 021D3EF0 */ cpu->r[12] = rbrew_read8(cpu->mem, _t5);
-        /* 021D3EF4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[5]);
-        /* 021D3EF8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3EF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[5]));
+        /* 021D3EF8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3EF8 */ _t7 = _t6 & 0x00000001u;
         /* 021D3EF8 */ if (_t7) goto L_021D3F10; else goto L_021D3EFC;
   L_021D3EFC: ; // 0x21d3efc
@@ -5658,15 +5658,15 @@ void Gambit_fn_021D3EE0(CPUState* cpu) {
         /* 021D3EE0 */ cpu->r[1] = _t0;
         /* 021D3EE4 */ _t1 = cpu->r[3] + 0x00000054u;
         /* 021D3EE4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t1);
-        /* 021D3EE8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[4]);
-        /* 021D3EEC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3EE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[4]));
+        /* 021D3EEC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3EEC */ _t3 = _t2 & 0x00000001u;
         /* 021D3EEC */ if (_t3) goto L_021D3EF0; else goto L_021D3EFC;
   L_021D3EF0: ; // 0x21d3ef0
         /* 021D3EF0 */ _t4 = cpu->r[3] + 0x00000243u;
         /* 021D3EF0 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
-        /* 021D3EF4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[5]);
-        /* 021D3EF8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3EF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[5]));
+        /* 021D3EF8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3EF8 */ _t6 = _t5 & 0x00000001u;
         /* 021D3EF8 */ if (_t6) goto L_021D3F10; else goto L_021D3EFC;
   L_021D3EFC: ; // 0x21d3efc
@@ -5697,18 +5697,18 @@ void Gambit_fn_021D3F2C(CPUState* cpu) {
         /* 021D3F30 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021D3F30 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021D3F34 */ cpu->r[31] = cpu->r[3];
-        /* 021D3F34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021D3F34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021D3F38 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021D3F38 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021D3F3C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3F3C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3F3C */ _t4 = _t3 & 0x00000001u;
         /* 021D3F3C */ if (_t4) goto L_021D3F40; else goto L_021D3F50;
   L_021D3F40: ; // 0x21d3f40
         /* 021D3F40 */ cpu->r[3] = 0x00000244u;
         /* 021D3F44 */ Gambit_fn_02801A78(cpu);
         /* 021D3F48 */ cpu->r[31] = cpu->r[3];
-        /* 021D3F48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021D3F4C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3F48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021D3F4C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3F4C */ _t6 = _t5 & 0x00000001u;
         /* 021D3F4C */ if (_t6) goto L_021D3F6C; else goto L_021D3F50;
   L_021D3F50: ; // 0x21d3f50
@@ -5739,8 +5739,8 @@ void Gambit_fn_021D3F84(CPUState* cpu) {
   L_021D3F84: ; // 0x21d3f84
         /* 021D3F84 */ _t0 = cpu->r[3] + 0x00000054u;
         /* 021D3F84 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
-        /* 021D3F88 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[5]);
-        /* 021D3F8C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3F88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[5]));
+        /* 021D3F8C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3F8C */ _t2 = _t1 & 0x00000001u;
         /* 021D3F8C */ _t3 = _t2 ^ 0x00000001u;
         /* 021D3F8C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -5759,8 +5759,8 @@ void Gambit_fn_021D3F9C(CPUState* cpu) {
   L_021D3F9C: ; // 0x21d3f9c
         /* 021D3F9C */ _t0 = cpu->r[3] + 0x00000054u;
         /* 021D3F9C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
-        /* 021D3FA0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[4]);
-        /* 021D3FA4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3FA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[4]));
+        /* 021D3FA4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3FA4 */ _t2 = _t1 & 0x00000001u;
         /* 021D3FA4 */ _t3 = _t2 ^ 0x00000001u;
         /* 021D3FA4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -5788,8 +5788,8 @@ void Gambit_fn_021D3FB4(CPUState* cpu) {
         /* 021D3FC4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D3FC8 */ _t3 = cpu->r[31] + 0x00000024u;
         /* 021D3FC8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021D3FCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D3FD0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3FCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D3FD0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3FD0 */ _t5 = _t4 & 0x00000001u;
         /* 021D3FD0 */ if (_t5) goto L_021D3FD4; else goto L_021D4018;
   L_021D3FD4: ; // 0x21d3fd4
@@ -5844,8 +5844,8 @@ void Gambit_fn_021D3FB8(CPUState* cpu) {
         /* 021D3FC4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D3FC8 */ _t3 = cpu->r[31] + 0x00000024u;
         /* 021D3FC8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021D3FCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D3FD0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D3FCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D3FD0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D3FD0 */ _t5 = _t4 & 0x00000001u;
         /* 021D3FD0 */ if (_t5) goto L_021D3FD4; else goto L_021D4018;
   L_021D3FD4: ; // 0x21d3fd4
@@ -5911,9 +5911,9 @@ void Gambit_fn_021D4038(CPUState* cpu) {
         /* 021D4054 */ _t2 = cpu->r[27] + 0x00000051u;
         /* 021D4054 */ cpu->r[7] = rbrew_read8(cpu->mem, _t2);
         /* 021D4058 */ cpu->r[28] = cpu->r[4];
-        /* 021D405C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021D405C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021D4060 */ cpu->r[30] = cpu->r[6];
-        /* 021D4064 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4064 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4064 */ _t4 = _t3 & 0x00000001u;
         /* 021D4064 */ if (_t4) goto L_021D4424; else goto L_021D4068;
   L_021D4068: ; // 0x21d4068
@@ -5938,12 +5938,12 @@ void Gambit_fn_021D4038(CPUState* cpu) {
         /* 021D4094 */ _t11 = cpu->r[28] + 0x00000000u;
         /* 021D4094 */ cpu->r[0] = rbrew_read32(cpu->mem, _t11);
         /* 021D4098 */ cpu->r[10] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021D4098 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021D4098 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021D409C */ /* nop */
         /* 021D40A0 */ cpu->r[30] = cpu->r[3];
         /* 021D40A4 */ _t12 = cpu->r[1] + 0x00000044u;
         /* 021D40A4 */ rbrew_write_f32(cpu->mem, _t12, cpu->f[8]);
-        /* 021D40A8 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D40A8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D40A8 */ _t14 = _t13 & 0x00000001u;
         /* 021D40A8 */ if (_t14) goto L_021D4154; else goto L_021D40AC;
   L_021D40AC: ; // 0x21d40ac
@@ -6003,10 +6003,10 @@ void Gambit_fn_021D4038(CPUState* cpu) {
         /* 021D413C */ /* nop */
         /* 021D4140 */ /* nop */
         /* 021D4144 */ cpu->r[11] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021D4144 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D4144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D4148 */ _t32 = cpu->r[1] + 0x00000014u;
         /* 021D4148 */ rbrew_write_f32(cpu->mem, _t32, cpu->f[8]);
-        /* 021D414C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D414C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D414C */ _t34 = _t33 & 0x00000001u;
         /* 021D414C */ if (_t34) goto L_021D4150; else goto L_021D418C;
   L_021D4150: ; // 0x21d4150
@@ -6031,10 +6031,10 @@ void Gambit_fn_021D4038(CPUState* cpu) {
         /* 021D417C */ _t41 = cpu->r[1] + 0x0000000Cu;
         /* 021D417C */ rbrew_write_f32(cpu->mem, _t41, cpu->f[9]);
         /* 021D4180 */ cpu->r[11] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021D4180 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D4180 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D4184 */ _t42 = cpu->r[1] + 0x00000010u;
         /* 021D4184 */ rbrew_write_f32(cpu->mem, _t42, cpu->f[11]);
-        /* 021D4188 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4188 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4188 */ _t44 = _t43 & 0x00000001u;
         /* 021D4188 */ if (_t44) goto L_021D4218; else goto L_021D418C;
   L_021D418C: ; // 0x21d418c
@@ -6079,10 +6079,10 @@ void Gambit_fn_021D4038(CPUState* cpu) {
         /* 021D4200 */ cpu->f[0] = cpu->f[0] * cpu->f[11];
         /* 021D4204 */ _t54 = cpu->r[1] + 0x00000028u;
         /* 021D4204 */ rbrew_write_f32(cpu->mem, _t54, cpu->f[13]);
-        /* 021D4208 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D4208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D420C */ _t55 = cpu->r[1] + 0x0000002Cu;
         /* 021D420C */ rbrew_write_f32(cpu->mem, _t55, cpu->f[0]);
-        /* 021D4210 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4210 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4210 */ _t57 = _t56 & 0x00000001u;
         /* 021D4210 */ if (_t57) goto L_021D4214; else goto L_021D4264;
   L_021D4214: ; // 0x21d4214
@@ -6112,10 +6112,10 @@ void Gambit_fn_021D4038(CPUState* cpu) {
         /* 021D4250 */ cpu->f[0] = cpu->f[0] * cpu->f[11];
         /* 021D4254 */ _t65 = cpu->r[1] + 0x00000028u;
         /* 021D4254 */ rbrew_write_f32(cpu->mem, _t65, cpu->f[13]);
-        /* 021D4258 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D4258 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D425C */ _t66 = cpu->r[1] + 0x0000002Cu;
         /* 021D425C */ rbrew_write_f32(cpu->mem, _t66, cpu->f[0]);
-        /* 021D4260 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4260 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4260 */ _t68 = _t67 & 0x00000001u;
         /* 021D4260 */ if (_t68) goto L_021D42C8; else goto L_021D4264;
   L_021D4264: ; // 0x21d4264
@@ -6146,10 +6146,10 @@ void Gambit_fn_021D4038(CPUState* cpu) {
         /* 021D42B0 */ cpu->f[10] = fma(cpu->f[6], cpu->f[9], cpu->f[8]);
         /* 021D42B4 */ _t74 = cpu->r[1] + 0x0000001Cu;
         /* 021D42B4 */ rbrew_write_f32(cpu->mem, _t74, cpu->f[0]);
-        /* 021D42B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021D42B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021D42BC */ _t75 = cpu->r[1] + 0x00000020u;
         /* 021D42BC */ rbrew_write_f32(cpu->mem, _t75, cpu->f[10]);
-        /* 021D42C0 */ _t76 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D42C0 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D42C0 */ _t77 = _t76 & 0x00000001u;
         /* 021D42C0 */ if (_t77) goto L_021D4328; else goto L_021D42C4;
   L_021D42C4: ; // 0x21d42c4
@@ -6165,10 +6165,10 @@ void Gambit_fn_021D4038(CPUState* cpu) {
         /* 021D42D4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t81);
         /* 021D42D8 */ _t82 = cpu->r[1] + 0x0000001Cu;
         /* 021D42D8 */ rbrew_write_f32(cpu->mem, _t82, cpu->f[11]);
-        /* 021D42DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021D42DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021D42E0 */ _t83 = cpu->r[1] + 0x00000020u;
         /* 021D42E0 */ rbrew_write_f32(cpu->mem, _t83, cpu->f[10]);
-        /* 021D42E4 */ _t84 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D42E4 */ _t84 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D42E4 */ _t85 = _t84 & 0x00000001u;
         /* 021D42E4 */ if (_t85) goto L_021D4328; else goto L_021D42E8;
   L_021D42E8: ; // 0x21d42e8
@@ -6206,10 +6206,10 @@ void Gambit_fn_021D4038(CPUState* cpu) {
         /* 021D4334 */ _t97 = cpu->r[12] + 0x00000078u;
         /* 021D4334 */ cpu->r[0] = rbrew_read32(cpu->mem, _t97);
         /* 021D4338 */ cpu->r[3] = 0x00000000u;
-        /* 021D433C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[0]);
+        /* 021D433C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[0]));
         /* 021D4340 */ _t98 = cpu->r[28] + 0x000001ACu;
         /* 021D4340 */ cpu->r[7] = rbrew_read32(cpu->mem, _t98);
-        /* 021D4344 */ _t99 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D4344 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D4344 */ _t100 = _t99 & 0x00000001u;
         /* 021D4344 */ if (_t100) goto L_021D4348; else goto L_021D4354;
   L_021D4348: ; // 0x21d4348
@@ -6293,9 +6293,9 @@ void Gambit_fn_021D4038(CPUState* cpu) {
         /* 021D43F4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021D43F8 */ _t134 = cpu->r[27] + 0x00000008u;
         /* 021D43F8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t134);
-        /* 021D43FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021D43FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021D4400 */ cpu->r[3] = cpu->r[31];
-        /* 021D4404 */ _t135 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4404 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4404 */ _t136 = _t135 & 0x00000001u;
         /* 021D4404 */ if (_t136) goto L_021D4408; else goto L_021D4420;
   L_021D4408: ; // 0x21d4408
@@ -6389,9 +6389,9 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D44E8 */ cpu->f[12] = cpu->f[12] + cpu->f[9];
         /* 021D44EC */ cpu->r[5] = cpu->r[5] + 0x0000000Cu;
         /* 021D44F0 */ cpu->r[12] = cpu->r[12] + 0xFFFFFFFFu;
-        /* 021D44F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021D44F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021D44F4 */ cpu->f[7] = cpu->f[12];
-        /* 021D44F8 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D44F8 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D44F8 */ _t19 = _t18 & 0x00000001u;
         /* 021D44F8 */ if (_t19) goto L_021D4524; else goto L_021D44FC;
   L_021D44FC: ; // 0x21d44fc
@@ -6405,9 +6405,9 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D4510 */ cpu->f[12] = cpu->f[12] + cpu->f[9];
         /* 021D4514 */ cpu->r[5] = cpu->r[5] + 0x0000000Cu;
         /* 021D4518 */ cpu->r[12] = cpu->r[12] + 0xFFFFFFFFu;
-        /* 021D4518 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021D4518 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021D451C */ cpu->f[7] = cpu->f[12];
-        /* 021D4520 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4520 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4520 */ _t23 = _t22 & 0x00000001u;
         /* 021D4520 */ if (_t23) goto L_021D4524; else goto L_021D44FC;
   L_021D4524: ; // 0x21d4524
@@ -6442,13 +6442,13 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D4578 */ cpu->r[8] = 0x101E0000u;
         /* 021D457C */ _t31 = cpu->r[10] + 0xFFFFF6ECu;
         /* 021D457C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t31);
-        /* 021D4580 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
+        /* 021D4580 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
         /* 021D4584 */ _t32 = cpu->r[8] + 0xFFFF958Cu;
         /* 021D4584 */ cpu->f[3] = rbrew_read_f32(cpu->mem, _t32);
         /* 021D4588 */ cpu->r[7] = 0x101C0000u;
         /* 021D458C */ _t33 = cpu->r[7] + 0x00001EF8u;
         /* 021D458C */ cpu->r[3] = rbrew_read32(cpu->mem, _t33);
-        /* 021D4590 */ _t34 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D4590 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D4590 */ _t35 = _t34 & 0x00000001u;
         /* 021D4590 */ if (_t35) goto L_021D45D8; else goto L_021D4594;
   L_021D4594: ; // 0x21d4594
@@ -6468,10 +6468,10 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D45C0 */ rbrew_write32(cpu->mem, _t37, cpu->r[0]);
         /* 021D45C4 */ Gambit_fn_0204A4DC(cpu);
         /* 021D45C8 */ cpu->r[9] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021D45C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021D45C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021D45CC */ _t38 = cpu->r[1] + 0x0000002Cu;
         /* 021D45CC */ rbrew_write32(cpu->mem, _t38, cpu->r[3]);
-        /* 021D45D0 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D45D0 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D45D0 */ _t40 = _t39 & 0x00000001u;
         /* 021D45D0 */ if (_t40) goto L_021D4B0C; else goto L_021D45D4;
   L_021D45D4: ; // 0x21d45d4
@@ -6491,10 +6491,10 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D45FC */ cpu->r[9] = cpu->r[1] + 0x0000002Cu;
         /* 021D4600 */ Gambit_fn_0204A864(cpu);
         /* 021D4604 */ cpu->r[9] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021D4604 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021D4604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021D4608 */ _t43 = cpu->r[1] + 0x0000002Cu;
         /* 021D4608 */ rbrew_write32(cpu->mem, _t43, cpu->r[3]);
-        /* 021D460C */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D460C */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D460C */ _t45 = _t44 & 0x00000001u;
         /* 021D460C */ if (_t45) goto L_021D4B0C; else goto L_021D4610;
   L_021D4610: ; // 0x21d4610
@@ -6508,9 +6508,9 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D4624 */ _t48 = cpu->r[1] + 0x0000001Cu;
         /* 021D4624 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t48);
         /* 021D4628 */ cpu->r[10] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000004u, 0x00000004u);
-        /* 021D4628 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021D4628 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021D462C */ /* nop */
-        /* 021D4630 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4630 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4630 */ _t50 = _t49 & 0x00000001u;
         /* 021D4630 */ if (_t50) goto L_021D4684; else goto L_021D4634;
   L_021D4634: ; // 0x21d4634
@@ -6534,7 +6534,7 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D465C */ rbrew_write_f32(cpu->mem, _t57, cpu->f[10]);
         /* 021D4660 */ _t58 = cpu->r[1] + 0x0000005Cu;
         /* 021D4660 */ cpu->r[11] = rbrew_read32(cpu->mem, _t58);
-        /* 021D4664 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[9]);
+        /* 021D4664 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[9]));
         /* 021D4668 */ _t59 = cpu->r[30] + 0x00000138u;
         /* 021D4668 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t59);
         /* 021D466C */ _t60 = cpu->r[1] + 0x00000058u;
@@ -6545,7 +6545,7 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D4674 */ rbrew_write32(cpu->mem, _t62, cpu->r[9]);
         /* 021D4678 */ _t63 = cpu->r[1] + 0x00000024u;
         /* 021D4678 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t63);
-        /* 021D467C */ _t64 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D467C */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D467C */ _t65 = _t64 & 0x00000001u;
         /* 021D467C */ if (_t65) goto L_021D4680; else goto L_021D46D4;
   L_021D4680: ; // 0x21d4680
@@ -6569,7 +6569,7 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D46A8 */ rbrew_write_f32(cpu->mem, _t71, cpu->f[10]);
         /* 021D46AC */ _t72 = cpu->r[1] + 0x0000005Cu;
         /* 021D46AC */ cpu->r[11] = rbrew_read32(cpu->mem, _t72);
-        /* 021D46B0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[9]);
+        /* 021D46B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[9]));
         /* 021D46B4 */ _t73 = cpu->r[30] + 0x00000138u;
         /* 021D46B4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t73);
         /* 021D46B8 */ _t74 = cpu->r[1] + 0x00000058u;
@@ -6580,7 +6580,7 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D46C0 */ rbrew_write32(cpu->mem, _t76, cpu->r[9]);
         /* 021D46C4 */ _t77 = cpu->r[1] + 0x00000024u;
         /* 021D46C4 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t77);
-        /* 021D46C8 */ _t78 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D46C8 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D46C8 */ _t79 = _t78 & 0x00000001u;
         /* 021D46C8 */ if (_t79) goto L_021D46CC; else goto L_021D46D4;
   L_021D46CC: ; // 0x21d46cc
@@ -6589,12 +6589,12 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D46D0 */ _t81 = cpu->r[1] + 0x00000020u;
         /* 021D46D0 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t81);
   L_021D46D4: ; // 0x21d46d4
-        /* 021D46D4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[10]);
+        /* 021D46D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[10]));
         /* 021D46D8 */ _t82 = cpu->r[30] + 0x0000013Cu;
         /* 021D46D8 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t82);
         /* 021D46DC */ _t83 = cpu->r[1] + 0x00000028u;
         /* 021D46DC */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t83);
-        /* 021D46E0 */ _t84 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D46E0 */ _t84 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D46E0 */ _t85 = _t84 & 0x00000001u;
         /* 021D46E0 */ if (_t85) goto L_021D46E4; else goto L_021D46EC;
   L_021D46E4: ; // 0x21d46e4
@@ -6603,10 +6603,10 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D46E8 */ _t87 = cpu->r[1] + 0x00000024u;
         /* 021D46E8 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t87);
   L_021D46EC: ; // 0x21d46ec
-        /* 021D46EC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[11]);
+        /* 021D46EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[11]));
         /* 021D46F0 */ _t88 = cpu->r[30] + 0x00000140u;
         /* 021D46F0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t88);
-        /* 021D46F4 */ _t89 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D46F4 */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D46F4 */ _t90 = _t89 & 0x00000001u;
         /* 021D46F4 */ if (_t90) goto L_021D46F8; else goto L_021D4700;
   L_021D46F8: ; // 0x21d46f8
@@ -6615,28 +6615,28 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D46FC */ _t92 = cpu->r[1] + 0x00000028u;
         /* 021D46FC */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t92);
   L_021D4700: ; // 0x21d4700
-        /* 021D4700 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[12]);
+        /* 021D4700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[12]));
         /* 021D4704 */ _t93 = cpu->r[30] + 0x00000144u;
         /* 021D4704 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t93);
-        /* 021D4708 */ _t94 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D4708 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D4708 */ _t95 = _t94 & 0x00000001u;
         /* 021D4708 */ if (_t95) goto L_021D470C; else goto L_021D4710;
   L_021D470C: ; // 0x21d470c
         /* 021D470C */ _t96 = cpu->r[30] + 0x00000140u;
         /* 021D470C */ rbrew_write_f32(cpu->mem, _t96, cpu->f[8]);
   L_021D4710: ; // 0x21d4710
-        /* 021D4710 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[13]);
+        /* 021D4710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[13]));
         /* 021D4714 */ _t97 = cpu->r[30] + 0x00000148u;
         /* 021D4714 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t97);
-        /* 021D4718 */ _t98 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D4718 */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D4718 */ _t99 = _t98 & 0x00000001u;
         /* 021D4718 */ if (_t99) goto L_021D471C; else goto L_021D4720;
   L_021D471C: ; // 0x21d471c
         /* 021D471C */ _t100 = cpu->r[30] + 0x00000144u;
         /* 021D471C */ rbrew_write_f32(cpu->mem, _t100, cpu->f[7]);
   L_021D4720: ; // 0x21d4720
-        /* 021D4720 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
-        /* 021D4724 */ _t101 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D4720 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
+        /* 021D4724 */ _t101 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D4724 */ _t102 = _t101 & 0x00000001u;
         /* 021D4724 */ if (_t102) goto L_021D4728; else goto L_021D472C;
   L_021D4728: ; // 0x21d4728
@@ -6645,8 +6645,8 @@ void Gambit_fn_021D4440(CPUState* cpu) {
   L_021D472C: ; // 0x21d472c
         /* 021D472C */ _t104 = cpu->r[31] + 0x00000040u;
         /* 021D472C */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t104);
-        /* 021D4730 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[7]);
-        /* 021D4734 */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4730 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[7]));
+        /* 021D4734 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4734 */ _t106 = _t105 & 0x00000001u;
         /* 021D4734 */ if (_t106) goto L_021D475C; else goto L_021D4738;
   L_021D4738: ; // 0x21d4738
@@ -6655,7 +6655,7 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D473C */ _t108 = cpu->r[31] + 0x00000034u;
         /* 021D473C */ rbrew_write_f32(cpu->mem, _t108, cpu->f[31]);
         /* 021D4740 */ cpu->r[0] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 021D4740 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021D4740 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021D4744 */ _t109 = cpu->r[31] + 0x0000003Cu;
         /* 021D4744 */ rbrew_write_f32(cpu->mem, _t109, cpu->f[31]);
         /* 021D4748 */ _t110 = cpu->r[31] + 0x00000040u;
@@ -6663,7 +6663,7 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D474C */ cpu->r[12] = cpu->r[31] + 0x00000034u;
         /* 021D4750 */ _t111 = cpu->r[31] + 0x00000038u;
         /* 021D4750 */ rbrew_write_f32(cpu->mem, _t111, cpu->f[31]);
-        /* 021D4754 */ _t112 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4754 */ _t112 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4754 */ _t113 = _t112 & 0x00000001u;
         /* 021D4754 */ if (_t113) goto L_021D4758; else goto L_021D47A0;
   L_021D4758: ; // 0x21d4758
@@ -6672,8 +6672,8 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D475C */ _t114 = cpu->r[31] + 0x00000000u;
         /* 021D475C */ cpu->r[0] = rbrew_read32(cpu->mem, _t114);
         /* 021D4760 */ cpu->r[9] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Bu, 0x0000001Cu);
-        /* 021D4760 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 021D4764 */ _t115 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4760 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 021D4764 */ _t115 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4764 */ _t116 = _t115 & 0x00000001u;
         /* 021D4764 */ if (_t116) goto L_021D4768; else goto L_021D4784;
   L_021D4768: ; // 0x21d4768
@@ -6681,11 +6681,11 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D4768 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t117);
         /* 021D476C */ _t118 = cpu->r[30] + 0x00000134u;
         /* 021D476C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t118);
-        /* 021D4770 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[13]);
+        /* 021D4770 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[13]));
         /* 021D4774 */ _t119 = cpu->r[30] + 0x00000138u;
         /* 021D4774 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t119);
         /* 021D4778 */ cpu->r[12] = cpu->r[31] + 0x00000034u;
-        /* 021D477C */ _t120 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D477C */ _t120 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D477C */ _t121 = _t120 & 0x00000001u;
         /* 021D477C */ if (_t121) goto L_021D4780; else goto L_021D4974;
   L_021D4780: ; // 0x21d4780
@@ -6696,13 +6696,13 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D4788 */ _t123 = cpu->r[31] + 0x00000038u;
         /* 021D4788 */ rbrew_write_f32(cpu->mem, _t123, cpu->f[31]);
         /* 021D478C */ cpu->r[0] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 021D478C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021D478C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021D4790 */ _t124 = cpu->r[31] + 0x00000034u;
         /* 021D4790 */ rbrew_write_f32(cpu->mem, _t124, cpu->f[31]);
         /* 021D4794 */ cpu->r[12] = cpu->r[31] + 0x00000034u;
         /* 021D4798 */ _t125 = cpu->r[31] + 0x0000003Cu;
         /* 021D4798 */ rbrew_write_f32(cpu->mem, _t125, cpu->f[31]);
-        /* 021D479C */ _t126 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D479C */ _t126 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D479C */ _t127 = _t126 & 0x00000001u;
         /* 021D479C */ if (_t127) goto L_021D47C4; else goto L_021D47A0;
   L_021D47A0: ; // 0x21d47a0
@@ -6721,8 +6721,8 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D47C0 */ cpu->r[6] = rbrew_read32(cpu->mem, _t131);
   L_021D47C4: ; // 0x21d47c4
         /* 021D47C4 */ cpu->r[10] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x0000001Bu, 0x0000001Bu);
-        /* 021D47C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021D47C8 */ _t132 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D47C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021D47C8 */ _t132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D47C8 */ _t133 = _t132 & 0x00000001u;
         /* 021D47C8 */ if (_t133) goto L_021D4950; else goto L_021D47CC;
   L_021D47CC: ; // 0x21d47cc
@@ -6730,12 +6730,12 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D47CC */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t134);
         /* 021D47D0 */ _t135 = cpu->r[31] + 0x00000040u;
         /* 021D47D0 */ cpu->f[5] = rbrew_read_f32(cpu->mem, _t135);
-        /* 021D47D4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
+        /* 021D47D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
         /* 021D47D8 */ _t136 = cpu->r[31] + 0x0000001Cu;
         /* 021D47D8 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t136);
         /* 021D47DC */ _t137 = cpu->r[31] + 0x00000028u;
         /* 021D47DC */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t137);
-        /* 021D47E0 */ _t138 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D47E0 */ _t138 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D47E0 */ _t139 = _t138 & 0x00000001u;
         /* 021D47E0 */ if (_t139) goto L_021D47E4; else goto L_021D4808;
   L_021D47E4: ; // 0x21d47e4
@@ -6743,20 +6743,20 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D47E8 */ _t140 = cpu->r[12] + 0x00000004u;
         /* 021D47E8 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t140);
         /* 021D47EC */ /* nop */
-        /* 021D47F0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[31]);
+        /* 021D47F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[31]));
         /* 021D47F4 */ _t141 = cpu->r[31] + 0x00000020u;
         /* 021D47F4 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t141);
         /* 021D47F8 */ cpu->f[6] = fma(cpu->f[12], cpu->f[5], cpu->f[10]);
         /* 021D47FC */ _t142 = cpu->r[31] + 0x0000002Cu;
         /* 021D47FC */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t142);
-        /* 021D4800 */ _t143 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D4800 */ _t143 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D4800 */ _t144 = _t143 & 0x00000001u;
         /* 021D4800 */ if (_t144) goto L_021D4804; else goto L_021D4870;
   L_021D4804: ; // 0x21d4804
         /* 021D4804 */ goto L_021D484C;
   L_021D4808: ; // 0x21d4808
-        /* 021D4808 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
-        /* 021D480C */ _t145 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D4808 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
+        /* 021D480C */ _t145 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D480C */ _t146 = _t145 & 0x00000001u;
         /* 021D480C */ if (_t146) goto L_021D4810; else goto L_021D4834;
   L_021D4810: ; // 0x21d4810
@@ -6764,13 +6764,13 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D4814 */ /* nop */
         /* 021D4818 */ _t147 = cpu->r[12] + 0x00000004u;
         /* 021D4818 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t147);
-        /* 021D481C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[31]);
+        /* 021D481C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[31]));
         /* 021D4820 */ _t148 = cpu->r[31] + 0x0000002Cu;
         /* 021D4820 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t148);
         /* 021D4824 */ cpu->f[6] = fma(cpu->f[13], cpu->f[5], cpu->f[11]);
         /* 021D4828 */ _t149 = cpu->r[31] + 0x00000020u;
         /* 021D4828 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t149);
-        /* 021D482C */ _t150 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D482C */ _t150 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D482C */ _t151 = _t150 & 0x00000001u;
         /* 021D482C */ if (_t151) goto L_021D4830; else goto L_021D4870;
   L_021D4830: ; // 0x21d4830
@@ -6781,10 +6781,10 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D4838 */ cpu->f[6] = cpu->f[12] + cpu->f[13];
         /* 021D483C */ _t153 = cpu->r[31] + 0x00000020u;
         /* 021D483C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t153);
-        /* 021D4840 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[31]);
+        /* 021D4840 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[31]));
         /* 021D4844 */ _t154 = cpu->r[31] + 0x0000002Cu;
         /* 021D4844 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t154);
-        /* 021D4848 */ _t155 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D4848 */ _t155 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D4848 */ _t156 = _t155 & 0x00000001u;
         /* 021D4848 */ if (_t156) goto L_021D484C; else goto L_021D4870;
   L_021D484C: ; // 0x21d484c
@@ -6792,20 +6792,20 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D4850 */ _t157 = cpu->r[12] + 0x00000008u;
         /* 021D4850 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t157);
         /* 021D4854 */ /* nop */
-        /* 021D4858 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
+        /* 021D4858 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
         /* 021D485C */ cpu->f[8] = fma(cpu->f[11], cpu->f[5], cpu->f[7]);
         /* 021D4860 */ _t158 = cpu->r[31] + 0x00000030u;
         /* 021D4860 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t158);
         /* 021D4864 */ _t159 = cpu->r[31] + 0x00000024u;
         /* 021D4864 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t159);
-        /* 021D4868 */ _t160 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D4868 */ _t160 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D4868 */ _t161 = _t160 & 0x00000001u;
         /* 021D4868 */ if (_t161) goto L_021D486C; else goto L_021D48F4;
   L_021D486C: ; // 0x21d486c
         /* 021D486C */ goto L_021D48B4;
   L_021D4870: ; // 0x21d4870
-        /* 021D4870 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[31]);
-        /* 021D4874 */ _t162 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D4870 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[31]));
+        /* 021D4874 */ _t162 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D4874 */ _t163 = _t162 & 0x00000001u;
         /* 021D4874 */ if (_t163) goto L_021D4878; else goto L_021D489C;
   L_021D4878: ; // 0x21d4878
@@ -6816,10 +6816,10 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D4884 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t164);
         /* 021D4888 */ _t165 = cpu->r[31] + 0x00000024u;
         /* 021D4888 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t165);
-        /* 021D488C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
+        /* 021D488C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
         /* 021D4890 */ _t166 = cpu->r[31] + 0x00000030u;
         /* 021D4890 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t166);
-        /* 021D4894 */ _t167 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D4894 */ _t167 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D4894 */ _t168 = _t167 & 0x00000001u;
         /* 021D4894 */ if (_t168) goto L_021D4898; else goto L_021D48F4;
   L_021D4898: ; // 0x21d4898
@@ -6830,10 +6830,10 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D48A0 */ cpu->f[8] = cpu->f[11] + cpu->f[12];
         /* 021D48A4 */ _t170 = cpu->r[31] + 0x00000030u;
         /* 021D48A4 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t170);
-        /* 021D48A8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
+        /* 021D48A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
         /* 021D48AC */ _t171 = cpu->r[31] + 0x00000024u;
         /* 021D48AC */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t171);
-        /* 021D48B0 */ _t172 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D48B0 */ _t172 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D48B0 */ _t173 = _t172 & 0x00000001u;
         /* 021D48B0 */ if (_t173) goto L_021D48B4; else goto L_021D48F4;
   L_021D48B4: ; // 0x21d48b4
@@ -6857,17 +6857,17 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D48DC */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t180);
         /* 021D48E0 */ _t181 = cpu->r[30] + 0x00000138u;
         /* 021D48E0 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t181);
-        /* 021D48E4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[13]);
+        /* 021D48E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[13]));
         /* 021D48E8 */ _t182 = cpu->r[1] + 0x0000001Cu;
         /* 021D48E8 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t182);
-        /* 021D48EC */ _t183 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D48EC */ _t183 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D48EC */ _t184 = _t183 & 0x00000001u;
         /* 021D48EC */ if (_t184) goto L_021D48F0; else goto L_021D4974;
   L_021D48F0: ; // 0x21d48f0
         /* 021D48F0 */ goto L_021D4970;
   L_021D48F4: ; // 0x21d48f4
-        /* 021D48F4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
-        /* 021D48F8 */ _t185 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D48F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
+        /* 021D48F8 */ _t185 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D48F8 */ _t186 = _t185 & 0x00000001u;
         /* 021D48F8 */ if (_t186) goto L_021D48FC; else goto L_021D493C;
   L_021D48FC: ; // 0x21d48fc
@@ -6891,10 +6891,10 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D4924 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t193);
         /* 021D4928 */ _t194 = cpu->r[30] + 0x00000138u;
         /* 021D4928 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t194);
-        /* 021D492C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[13]);
+        /* 021D492C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[13]));
         /* 021D4930 */ _t195 = cpu->r[1] + 0x0000001Cu;
         /* 021D4930 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t195);
-        /* 021D4934 */ _t196 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D4934 */ _t196 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D4934 */ _t197 = _t196 & 0x00000001u;
         /* 021D4934 */ if (_t197) goto L_021D4938; else goto L_021D4974;
   L_021D4938: ; // 0x21d4938
@@ -6919,10 +6919,10 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D495C */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t204);
         /* 021D4960 */ _t205 = cpu->r[30] + 0x00000138u;
         /* 021D4960 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t205);
-        /* 021D4964 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[13]);
+        /* 021D4964 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[13]));
         /* 021D4968 */ _t206 = cpu->r[1] + 0x0000001Cu;
         /* 021D4968 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t206);
-        /* 021D496C */ _t207 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D496C */ _t207 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D496C */ _t208 = _t207 & 0x00000001u;
         /* 021D496C */ if (_t208) goto L_021D4970; else goto L_021D4974;
   L_021D4970: ; // 0x21d4970
@@ -6931,10 +6931,10 @@ void Gambit_fn_021D4440(CPUState* cpu) {
   L_021D4974: ; // 0x21d4974
         /* 021D4974 */ _t210 = cpu->r[12] + 0x00000004u;
         /* 021D4974 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t210);
-        /* 021D4978 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[8]);
+        /* 021D4978 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[8]));
         /* 021D497C */ _t211 = cpu->r[30] + 0x0000013Cu;
         /* 021D497C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t211);
-        /* 021D4980 */ _t212 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D4980 */ _t212 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D4980 */ _t213 = _t212 & 0x00000001u;
         /* 021D4980 */ if (_t213) goto L_021D4984; else goto L_021D4988;
   L_021D4984: ; // 0x21d4984
@@ -6943,10 +6943,10 @@ void Gambit_fn_021D4440(CPUState* cpu) {
   L_021D4988: ; // 0x21d4988
         /* 021D4988 */ _t215 = cpu->r[12] + 0x00000008u;
         /* 021D4988 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t215);
-        /* 021D498C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[11]);
+        /* 021D498C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[11]));
         /* 021D4990 */ _t216 = cpu->r[30] + 0x00000140u;
         /* 021D4990 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t216);
-        /* 021D4994 */ _t217 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D4994 */ _t217 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D4994 */ _t218 = _t217 & 0x00000001u;
         /* 021D4994 */ if (_t218) goto L_021D4998; else goto L_021D499C;
   L_021D4998: ; // 0x21d4998
@@ -6955,10 +6955,10 @@ void Gambit_fn_021D4440(CPUState* cpu) {
   L_021D499C: ; // 0x21d499c
         /* 021D499C */ _t220 = cpu->r[12] + 0x00000000u;
         /* 021D499C */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t220);
-        /* 021D49A0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[13]);
+        /* 021D49A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[13]));
         /* 021D49A4 */ _t221 = cpu->r[30] + 0x00000144u;
         /* 021D49A4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t221);
-        /* 021D49A8 */ _t222 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D49A8 */ _t222 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D49A8 */ _t223 = _t222 & 0x00000001u;
         /* 021D49A8 */ if (_t223) goto L_021D49AC; else goto L_021D49B0;
   L_021D49AC: ; // 0x21d49ac
@@ -6967,10 +6967,10 @@ void Gambit_fn_021D4440(CPUState* cpu) {
   L_021D49B0: ; // 0x21d49b0
         /* 021D49B0 */ _t225 = cpu->r[12] + 0x00000004u;
         /* 021D49B0 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t225);
-        /* 021D49B4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
+        /* 021D49B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
         /* 021D49B8 */ _t226 = cpu->r[30] + 0x00000148u;
         /* 021D49B8 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t226);
-        /* 021D49BC */ _t227 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D49BC */ _t227 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D49BC */ _t228 = _t227 & 0x00000001u;
         /* 021D49BC */ if (_t228) goto L_021D49C0; else goto L_021D49C4;
   L_021D49C0: ; // 0x21d49c0
@@ -6979,8 +6979,8 @@ void Gambit_fn_021D4440(CPUState* cpu) {
   L_021D49C4: ; // 0x21d49c4
         /* 021D49C4 */ _t230 = cpu->r[12] + 0x00000008u;
         /* 021D49C4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t230);
-        /* 021D49C8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[8]);
-        /* 021D49CC */ _t231 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D49C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[8]));
+        /* 021D49CC */ _t231 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D49CC */ _t232 = _t231 & 0x00000001u;
         /* 021D49CC */ if (_t232) goto L_021D49D0; else goto L_021D49D4;
   L_021D49D0: ; // 0x21d49d0
@@ -6994,16 +6994,16 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D49E4 */ cpu->r[5] = cpu->r[1] + 0x00000060u;
         /* 021D49E8 */ cpu->r[3] = cpu->r[30];
         /* 021D49EC */ Gambit_fn_021C2660(cpu);
-        /* 021D49F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D49F4 */ _t234 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D49F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D49F4 */ _t234 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D49F4 */ _t235 = _t234 & 0x00000001u;
         /* 021D49F4 */ if (_t235) goto L_021D49F8; else goto L_021D4A60;
   L_021D49F8: ; // 0x21d49f8
         /* 021D49F8 */ _t236 = cpu->r[31] + 0x0000015Cu;
         /* 021D49F8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t236);
         /* 021D49FC */ cpu->r[10] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 021D49FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021D4A00 */ _t237 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D49FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021D4A00 */ _t237 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4A00 */ _t238 = _t237 & 0x00000001u;
         /* 021D4A00 */ if (_t238) goto L_021D4A30; else goto L_021D4A04;
   L_021D4A04: ; // 0x21d4a04
@@ -7019,8 +7019,8 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D4A20 */ _t241 = cpu->r[31] + 0x0000008Cu;
         /* 021D4A20 */ cpu->r[5] = rbrew_read16(cpu->mem, _t241);
         /* 021D4A24 */ cpu->r[6] = rbrew_rlwinm(cpu->r[5], 0x00000017u, 0x0000001Fu, 0x0000001Fu);
-        /* 021D4A24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 021D4A28 */ _t242 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4A24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 021D4A28 */ _t242 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4A28 */ _t243 = _t242 & 0x00000001u;
         /* 021D4A28 */ if (_t243) goto L_021D4A2C; else goto L_021D4A60;
   L_021D4A2C: ; // 0x21d4a2c
@@ -7028,8 +7028,8 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D4A2C */ cpu->r[7] = rbrew_read32(cpu->mem, _t244);
   L_021D4A30: ; // 0x21d4a30
         /* 021D4A30 */ cpu->r[7] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021D4A30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021D4A34 */ _t245 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4A30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021D4A34 */ _t245 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4A34 */ _t246 = _t245 & 0x00000001u;
         /* 021D4A34 */ if (_t246) goto L_021D4A9C; else goto L_021D4A38;
   L_021D4A38: ; // 0x21d4a38
@@ -7045,8 +7045,8 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D4A54 */ _t249 = cpu->r[31] + 0x000000D8u;
         /* 021D4A54 */ cpu->r[5] = rbrew_read16(cpu->mem, _t249);
         /* 021D4A58 */ cpu->r[0] = rbrew_rlwinm(cpu->r[5], 0x00000017u, 0x0000001Fu, 0x0000001Fu);
-        /* 021D4A58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D4A5C */ _t250 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4A58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D4A5C */ _t250 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4A5C */ _t251 = _t250 & 0x00000001u;
         /* 021D4A5C */ if (_t251) goto L_021D4A9C; else goto L_021D4A60;
   L_021D4A60: ; // 0x21d4a60
@@ -7068,7 +7068,7 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D4A80 */ cpu->r[31] = rbrew_read32(cpu->mem, _t258);
         /* 021D4A84 */ _t259 = cpu->r[1] + 0x000000C8u;
         /* 021D4A84 */ cpu->r[30] = rbrew_read32(cpu->mem, _t259);
-        /* 021D4A88 */ _t260 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D4A88 */ _t260 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D4A88 */ _t261 = _t260 & 0x00000001u;
         /* 021D4A88 */ if (_t261) goto L_021D4A8C; // else: addr-0 trap, fall-through
   L_021D4A8C: ; // 0x21d4a8c
@@ -7084,8 +7084,8 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D4AA4 */ cpu->r[5] = cpu->r[11] + 0x101E0000u;
         /* 021D4AA8 */ _t264 = cpu->r[5] + 0xFFFF9484u;
         /* 021D4AA8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t264);
-        /* 021D4AAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021D4AB0 */ _t265 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D4AAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021D4AB0 */ _t265 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D4AB0 */ _t266 = _t265 & 0x00000001u;
         /* 021D4AB0 */ if (_t266) goto L_021D4AB4; else goto L_021D4B20;
   L_021D4AB4: ; // 0x21d4ab4
@@ -7118,8 +7118,8 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D4B0C */ cpu->r[3] = cpu->r[30];
         /* 021D4B10 */ cpu->r[4] = cpu->r[1] + 0x0000002Cu;
         /* 021D4B14 */ Gambit_fn_021C3934(cpu);
-        /* 021D4B18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D4B1C */ _t270 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4B18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D4B1C */ _t270 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4B1C */ _t271 = _t270 & 0x00000001u;
         /* 021D4B1C */ if (_t271) goto L_021D4B20; else goto L_021D4B74;
   L_021D4B20: ; // 0x21d4b20
@@ -7128,8 +7128,8 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D4B28 */ cpu->r[3] = cpu->r[30];
         /* 021D4B2C */ cpu->r[4] = cpu->r[30] + 0x00000168u;
         /* 021D4B30 */ Gambit_fn_021C2564(cpu);
-        /* 021D4B34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021D4B38 */ _t272 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4B34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021D4B38 */ _t272 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4B38 */ _t273 = _t272 & 0x00000001u;
         /* 021D4B38 */ if (_t273) goto L_021D4B54; else goto L_021D4B3C;
   L_021D4B3C: ; // 0x21d4b3c
@@ -7146,10 +7146,10 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D4B54 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t276);
         /* 021D4B58 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
         /* 021D4B5C */ /* nop */
-        /* 021D4B60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000708u);
+        /* 021D4B60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000708u));
         /* 021D4B64 */ _t277 = cpu->r[30] + 0x00000240u;
         /* 021D4B64 */ rbrew_write16(cpu->mem, _t277, (uint16_t)cpu->r[8]);
-        /* 021D4B68 */ _t278 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D4B68 */ _t278 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D4B68 */ _t279 = _t278 & 0x00000001u;
         /* 021D4B68 */ if (_t279) goto L_021D4B6C; else goto L_021D4B74;
   L_021D4B6C: ; // 0x21d4b6c
@@ -7172,7 +7172,7 @@ void Gambit_fn_021D4440(CPUState* cpu) {
         /* 021D4B8C */ cpu->r[31] = rbrew_read32(cpu->mem, _t286);
         /* 021D4B90 */ _t287 = cpu->r[1] + 0x000000C8u;
         /* 021D4B90 */ cpu->r[30] = rbrew_read32(cpu->mem, _t287);
-        /* 021D4B94 */ _t288 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D4B94 */ _t288 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D4B94 */ _t289 = _t288 & 0x00000001u;
         /* 021D4B94 */ if (_t289) goto L_021D4B98; // else: addr-0 trap, fall-through
   L_021D4B98: ; // 0x21d4b98
@@ -7538,17 +7538,17 @@ void Gambit_fn_021D4BE4(CPUState* cpu) {
         /* 021D4DF8 */ cpu->r[10] = 0x10030000u;
         /* 021D4DFC */ _t101 = cpu->r[5] + 0xFFFFF6E4u;
         /* 021D4DFC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t101);
-        /* 021D4E00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u);
+        /* 021D4E00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u));
         /* 021D4E04 */ _t102 = cpu->r[10] + 0xFFFFF6F8u;
         /* 021D4E04 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t102);
-        /* 021D4E08 */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4E08 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4E08 */ _t104 = _t103 & 0x00000001u;
         /* 021D4E08 */ if (_t104) goto L_021D4E0C; else goto L_021D4E1C;
   L_021D4E0C: ; // 0x21d4e0c
         /* 021D4E0C */ cpu->r[3] = 0x00000010u;
         /* 021D4E10 */ Gambit_fn_02801A78(cpu);
-        /* 021D4E14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D4E18 */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4E14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D4E18 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4E18 */ _t106 = _t105 & 0x00000001u;
         /* 021D4E18 */ if (_t106) goto L_021D4E2C; else goto L_021D4E1C;
   L_021D4E1C: ; // 0x21d4e1c
@@ -7561,16 +7561,16 @@ void Gambit_fn_021D4BE4(CPUState* cpu) {
         /* 021D4E28 */ _t110 = cpu->r[3] + 0x0000000Cu;
         /* 021D4E28 */ rbrew_write_f32(cpu->mem, _t110, cpu->f[31]);
   L_021D4E2C: ; // 0x21d4e2c
-        /* 021D4E2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u);
+        /* 021D4E2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u));
         /* 021D4E30 */ cpu->r[3] = cpu->r[31] + 0x000000D0u;
-        /* 021D4E34 */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4E34 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4E34 */ _t112 = _t111 & 0x00000001u;
         /* 021D4E34 */ if (_t112) goto L_021D4E38; else goto L_021D4E48;
   L_021D4E38: ; // 0x21d4e38
         /* 021D4E38 */ cpu->r[3] = 0x00000010u;
         /* 021D4E3C */ Gambit_fn_02801A78(cpu);
-        /* 021D4E40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D4E44 */ _t113 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4E40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D4E44 */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4E44 */ _t114 = _t113 & 0x00000001u;
         /* 021D4E44 */ if (_t114) goto L_021D4E58; else goto L_021D4E48;
   L_021D4E48: ; // 0x21d4e48
@@ -7652,7 +7652,7 @@ void Gambit_fn_021D4BE4(CPUState* cpu) {
         /* 021D4EF4 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t145);
         /* 021D4EF8 */ _t146 = cpu->r[1] + 0x00000050u;
         /* 021D4EF8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t146);
-        /* 021D4EFC */ _t147 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D4EFC */ _t147 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D4EFC */ _t148 = _t147 & 0x00000001u;
         /* 021D4EFC */ if (_t148) goto L_021D4F00; // else: addr-0 trap, fall-through
   L_021D4F00: ; // 0x21d4f00
@@ -7668,15 +7668,15 @@ void Gambit_fn_021D4F10(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021D4F10: ; // 0x21d4f10
-        /* 021D4F10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D4F14 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4F10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D4F14 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4F14 */ _t1 = _t0 & 0x00000001u;
         /* 021D4F14 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021D4F14 */ goto L_021D4F18;
   L_021D4F18: ; // 0x21d4f18
         /* 021D4F18 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021D4F18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D4F1C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4F18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D4F1C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4F1C */ _t3 = _t2 & 0x00000001u;
         /* 021D4F1C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021D4F1C */ goto L_021D4F20;
@@ -7695,8 +7695,8 @@ void Gambit_fn_021D4F10(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -7710,15 +7710,15 @@ void Gambit_fn_021D4F10(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -7755,7 +7755,7 @@ void Gambit_fn_021D4F34(CPUState* cpu) {
         /* 021D4F34 */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 021D4F34 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 021D4F34 */ cpu->r[1] = _t0;
-        /* 021D4F38 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4F38 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4F38 */ _t2 = _t1 & 0x00000001u;
         /* 021D4F38 */ if (_t2) goto L_021D4F3C; else goto L_021D4F44;
   L_021D4F3C: ; // 0x21d4f3c
@@ -7807,8 +7807,8 @@ void Gambit_fn_021D4F68(CPUState* cpu) {
         /* 021D4F68 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D4F68 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D4F6C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021D4F6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D4F70 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4F6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D4F70 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4F70 */ _t2 = _t1 & 0x00000001u;
         /* 021D4F70 */ _t3 = _t2 ^ 0x00000001u;
         /* 021D4F70 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -7830,8 +7830,8 @@ void Gambit_fn_021D4F84(CPUState* cpu) {
         /* 021D4F84 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D4F84 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D4F88 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021D4F88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D4F8C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4F88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D4F8C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4F8C */ _t2 = _t1 & 0x00000001u;
         /* 021D4F8C */ _t3 = _t2 ^ 0x00000001u;
         /* 021D4F8C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -7853,8 +7853,8 @@ void Gambit_fn_021D4FA0(CPUState* cpu) {
         /* 021D4FA0 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D4FA0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D4FA4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021D4FA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D4FA8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4FA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D4FA8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4FA8 */ _t2 = _t1 & 0x00000001u;
         /* 021D4FA8 */ _t3 = _t2 ^ 0x00000001u;
         /* 021D4FA8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -7897,8 +7897,8 @@ void Gambit_fn_021D4FCC(CPUState* cpu) {
         /* 021D4FDC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D4FE0 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D4FE0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021D4FE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021D4FE8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4FE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021D4FE8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4FE8 */ _t5 = _t4 & 0x00000001u;
         /* 021D4FE8 */ if (_t5) goto L_021D4FEC; else goto L_021D5008;
   L_021D4FEC: ; // 0x21d4fec
@@ -7937,8 +7937,8 @@ void Gambit_fn_021D4FD0(CPUState* cpu) {
         /* 021D4FDC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D4FE0 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D4FE0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021D4FE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021D4FE8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D4FE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021D4FE8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D4FE8 */ _t5 = _t4 & 0x00000001u;
         /* 021D4FE8 */ if (_t5) goto L_021D4FEC; else goto L_021D5008;
   L_021D4FEC: ; // 0x21d4fec
@@ -8345,10 +8345,10 @@ void Gambit_fn_021D51A4(CPUState* cpu) {
         /* 021D51A4 */ cpu->r[10] = 0x101D0000u;
         /* 021D51A8 */ _t0 = cpu->r[10] + 0xFFFFFB90u;
         /* 021D51A8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 021D51AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021D51AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021D51B0 */ cpu->r[10] = 0x101D0000u;
         /* 021D51B4 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBE8u;
-        /* 021D51B8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D51B8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D51B8 */ _t2 = _t1 & 0x00000001u;
         /* 021D51B8 */ if (_t2) goto L_021D51BC; else goto L_021D51D4;
   L_021D51BC: ; // 0x21d51bc
@@ -8361,8 +8361,8 @@ void Gambit_fn_021D51A4(CPUState* cpu) {
         /* 021D51D0 */ _t4 = cpu->r[10] + 0x00000000u;
         /* 021D51D0 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_021D51D4: ; // 0x21d51d4
-        /* 021D51D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021D51D8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D51D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021D51D8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D51D8 */ _t6 = _t5 & 0x00000001u;
         /* 021D51D8 */ if (_t6) goto L_021D51DC; else goto L_021D51E4;
   L_021D51DC: ; // 0x21d51dc
@@ -8373,9 +8373,9 @@ void Gambit_fn_021D51A4(CPUState* cpu) {
         /* 021D51E8 */ _t7 = cpu->r[9] + 0xFFFFE5E4u;
         /* 021D51E8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 021D51EC */ cpu->r[11] = 0x101D0000u;
-        /* 021D51F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021D51F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021D51F4 */ cpu->r[11] = cpu->r[11] + 0xFFFFFB60u;
-        /* 021D51F8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D51F8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D51F8 */ _t9 = _t8 & 0x00000001u;
         /* 021D51F8 */ if (_t9) goto L_021D51FC; else goto L_021D5214;
   L_021D51FC: ; // 0x21d51fc
@@ -8388,8 +8388,8 @@ void Gambit_fn_021D51A4(CPUState* cpu) {
         /* 021D5210 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021D5210 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021D5214: ; // 0x21d5214
-        /* 021D5214 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021D5218 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5214 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021D5218 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5218 */ _t13 = _t12 & 0x00000001u;
         /* 021D5218 */ if (_t13) goto L_021D521C; else goto L_021D5224;
   L_021D521C: ; // 0x21d521c
@@ -8400,9 +8400,9 @@ void Gambit_fn_021D51A4(CPUState* cpu) {
         /* 021D5228 */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021D5228 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 021D522C */ cpu->r[9] = 0x101D0000u;
-        /* 021D5230 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D5230 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D5234 */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 021D5238 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5238 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5238 */ _t16 = _t15 & 0x00000001u;
         /* 021D5238 */ if (_t16) goto L_021D523C; else goto L_021D5254;
   L_021D523C: ; // 0x21d523c
@@ -8415,8 +8415,8 @@ void Gambit_fn_021D51A4(CPUState* cpu) {
         /* 021D5250 */ _t18 = cpu->r[9] + 0x00000000u;
         /* 021D5250 */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_021D5254: ; // 0x21d5254
-        /* 021D5254 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 021D5258 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5254 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 021D5258 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5258 */ _t20 = _t19 & 0x00000001u;
         /* 021D5258 */ if (_t20) goto L_021D525C; else goto L_021D5264;
   L_021D525C: ; // 0x21d525c
@@ -8428,9 +8428,9 @@ void Gambit_fn_021D51A4(CPUState* cpu) {
         /* 021D5268 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 021D5268 */ cpu->r[9] = _t21;
         /* 021D526C */ cpu->r[10] = 0x101D0000u;
-        /* 021D5270 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021D5270 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021D5274 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021D5278 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5278 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5278 */ _t23 = _t22 & 0x00000001u;
         /* 021D5278 */ if (_t23) goto L_021D527C; else goto L_021D5290;
   L_021D527C: ; // 0x21d527c
@@ -8442,8 +8442,8 @@ void Gambit_fn_021D51A4(CPUState* cpu) {
         /* 021D528C */ _t25 = cpu->r[10] + 0x00000000u;
         /* 021D528C */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_021D5290: ; // 0x21d5290
-        /* 021D5290 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021D5294 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5290 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021D5294 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5294 */ _t27 = _t26 & 0x00000001u;
         /* 021D5294 */ if (_t27) goto L_021D5298; else goto L_021D52A0;
   L_021D5298: ; // 0x21d5298
@@ -8455,9 +8455,9 @@ void Gambit_fn_021D51A4(CPUState* cpu) {
         /* 021D52A4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 021D52A4 */ cpu->r[10] = _t28;
         /* 021D52A8 */ cpu->r[11] = 0x101D0000u;
-        /* 021D52AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021D52AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021D52B0 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021D52B4 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D52B4 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D52B4 */ _t30 = _t29 & 0x00000001u;
         /* 021D52B4 */ if (_t30) goto L_021D52B8; else goto L_021D52CC;
   L_021D52B8: ; // 0x21d52b8
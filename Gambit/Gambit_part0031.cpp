@@ -338,18 +338,18 @@ void Gambit_fn_021D5638(CPUState* cpu) {
         /* 021D5640 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 021D5640 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 021D5644 */ cpu->r[31] = cpu->r[3];
-        /* 021D5644 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021D5644 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021D5648 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 021D5648 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 021D564C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D564C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D564C */ _t5 = _t4 & 0x00000001u;
         /* 021D564C */ if (_t5) goto L_021D5650; else goto L_021D5660;
   L_021D5650: ; // 0x21d5650
         /* 021D5650 */ cpu->r[3] = 0x00000284u;
         /* 021D5654 */ Gambit_fn_02801A78(cpu);
         /* 021D5658 */ cpu->r[31] = cpu->r[3];
-        /* 021D5658 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021D565C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5658 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021D565C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D565C */ _t7 = _t6 & 0x00000001u;
         /* 021D565C */ if (_t7) goto L_021D56DC; else goto L_021D5660;
   L_021D5660: ; // 0x21d5660
@@ -358,10 +358,10 @@ void Gambit_fn_021D5638(CPUState* cpu) {
         /* 021D5668 */ cpu->r[12] = 0x10030000u;
         /* 021D566C */ cpu->r[12] = cpu->r[12] + 0xFFFFFE58u;
         /* 021D5670 */ cpu->r[0] = cpu->r[31] + 0x00000240u;
-        /* 021D5670 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021D5670 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021D5674 */ _t8 = cpu->r[31] + 0x00000004u;
         /* 021D5674 */ rbrew_write32(cpu->mem, _t8, cpu->r[12]);
-        /* 021D5678 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5678 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5678 */ _t10 = _t9 & 0x00000001u;
         /* 021D5678 */ if (_t10) goto L_021D567C; else goto L_021D5684;
   L_021D567C: ; // 0x21d567c
@@ -369,8 +369,8 @@ void Gambit_fn_021D5638(CPUState* cpu) {
         /* 021D5680 */ Gambit_fn_02801A78(cpu);
   L_021D5684: ; // 0x21d5684
         /* 021D5684 */ cpu->r[11] = cpu->r[31] + 0x0000024Cu;
-        /* 021D5684 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021D5688 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5684 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021D5688 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5688 */ _t12 = _t11 & 0x00000001u;
         /* 021D5688 */ if (_t12) goto L_021D568C; else goto L_021D5694;
   L_021D568C: ; // 0x21d568c
@@ -378,21 +378,21 @@ void Gambit_fn_021D5638(CPUState* cpu) {
         /* 021D5690 */ Gambit_fn_02801A78(cpu);
   L_021D5694: ; // 0x21d5694
         /* 021D5694 */ cpu->r[30] = cpu->r[31] + 0x0000025Cu;
-        /* 021D5694 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021D5698 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5694 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021D5698 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5698 */ _t14 = _t13 & 0x00000001u;
         /* 021D5698 */ if (_t14) goto L_021D569C; else goto L_021D56AC;
   L_021D569C: ; // 0x21d569c
         /* 021D569C */ cpu->r[3] = 0x00000024u;
         /* 021D56A0 */ Gambit_fn_02801A78(cpu);
         /* 021D56A4 */ cpu->r[30] = cpu->r[3];
-        /* 021D56A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021D56A8 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D56A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021D56A8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D56A8 */ _t16 = _t15 & 0x00000001u;
         /* 021D56A8 */ if (_t16) goto L_021D56DC; else goto L_021D56AC;
   L_021D56AC: ; // 0x21d56ac
-        /* 021D56AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021D56B0 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D56AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021D56B0 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D56B0 */ _t18 = _t17 & 0x00000001u;
         /* 021D56B0 */ if (_t18) goto L_021D56B4; else goto L_021D56BC;
   L_021D56B4: ; // 0x21d56b4
@@ -400,8 +400,8 @@ void Gambit_fn_021D5638(CPUState* cpu) {
         /* 021D56B8 */ Gambit_fn_02801A78(cpu);
   L_021D56BC: ; // 0x21d56bc
         /* 021D56BC */ cpu->r[12] = cpu->r[30] + 0x0000000Cu;
-        /* 021D56BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D56C0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D56BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D56C0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D56C0 */ _t20 = _t19 & 0x00000001u;
         /* 021D56C0 */ if (_t20) goto L_021D56C4; else goto L_021D56CC;
   L_021D56C4: ; // 0x21d56c4
@@ -409,8 +409,8 @@ void Gambit_fn_021D5638(CPUState* cpu) {
         /* 021D56C8 */ Gambit_fn_02801A78(cpu);
   L_021D56CC: ; // 0x21d56cc
         /* 021D56CC */ cpu->r[0] = cpu->r[30] + 0x00000018u;
-        /* 021D56CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D56D0 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D56CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D56D0 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D56D0 */ _t22 = _t21 & 0x00000001u;
         /* 021D56D0 */ if (_t22) goto L_021D56D4; else goto L_021D56DC;
   L_021D56D4: ; // 0x21d56d4
@@ -454,8 +454,8 @@ void Gambit_fn_021D56FC(CPUState* cpu) {
         /* 021D5710 */ Gambit_fn_021BFAD8(cpu);
         /* 021D5714 */ cpu->r[3] = 0x00000028u;
         /* 021D5718 */ Gambit_fn_02801A78(cpu);
-        /* 021D571C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D5720 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D571C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D5720 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5720 */ _t4 = _t3 & 0x00000001u;
         /* 021D5720 */ if (_t4) goto L_021D5730; else goto L_021D5724;
   L_021D5724: ; // 0x21d5724
@@ -494,8 +494,8 @@ void Gambit_fn_021D5700(CPUState* cpu) {
         /* 021D5710 */ Gambit_fn_021BFAD8(cpu);
         /* 021D5714 */ cpu->r[3] = 0x00000028u;
         /* 021D5718 */ Gambit_fn_02801A78(cpu);
-        /* 021D571C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D5720 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D571C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D5720 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5720 */ _t4 = _t3 & 0x00000001u;
         /* 021D5720 */ if (_t4) goto L_021D5730; else goto L_021D5724;
   L_021D5724: ; // 0x21d5724
@@ -560,10 +560,10 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D57A0 */ _t12 = cpu->r[31] + 0x00000160u;
         /* 021D57A0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t12);
         /* 021D57A4 */ cpu->r[4] = 0x10030000u;
-        /* 021D57A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D57A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D57AC */ _t13 = cpu->r[4] + 0xFFFFFD4Cu;
         /* 021D57AC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t13);
-        /* 021D57B0 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D57B0 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D57B0 */ _t15 = _t14 & 0x00000001u;
         /* 021D57B0 */ if (_t15) goto L_021D57B4; else goto L_021D6A88;
   L_021D57B4: ; // 0x21d57b4
@@ -607,9 +607,9 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5824 */ cpu->f[8] = cpu->f[8] + cpu->f[0];
         /* 021D5828 */ cpu->r[10] = cpu->r[10] + 0x0000000Cu;
         /* 021D582C */ cpu->r[11] = cpu->r[11] + 0xFFFFFFFFu;
-        /* 021D582C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D582C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D5830 */ cpu->f[10] = cpu->f[8];
-        /* 021D5834 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5834 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5834 */ _t25 = _t24 & 0x00000001u;
         /* 021D5834 */ if (_t25) goto L_021D5860; else goto L_021D5838;
   L_021D5838: ; // 0x21d5838
@@ -623,9 +623,9 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D584C */ cpu->f[8] = cpu->f[8] + cpu->f[0];
         /* 021D5850 */ cpu->r[10] = cpu->r[10] + 0x0000000Cu;
         /* 021D5854 */ cpu->r[11] = cpu->r[11] + 0xFFFFFFFFu;
-        /* 021D5854 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D5854 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D5858 */ cpu->f[10] = cpu->f[8];
-        /* 021D585C */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D585C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D585C */ _t29 = _t28 & 0x00000001u;
         /* 021D585C */ if (_t29) goto L_021D5860; else goto L_021D5838;
   L_021D5860: ; // 0x21d5860
@@ -660,13 +660,13 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D58B4 */ cpu->r[9] = 0x101E0000u;
         /* 021D58B8 */ _t37 = cpu->r[10] + 0xFFFFFD54u;
         /* 021D58B8 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t37);
-        /* 021D58BC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[29]);
+        /* 021D58BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[29]));
         /* 021D58C0 */ _t38 = cpu->r[9] + 0xFFFF958Cu;
         /* 021D58C0 */ cpu->f[3] = rbrew_read_f32(cpu->mem, _t38);
         /* 021D58C4 */ cpu->r[12] = 0x101C0000u;
         /* 021D58C8 */ _t39 = cpu->r[12] + 0x00001EF8u;
         /* 021D58C8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t39);
-        /* 021D58CC */ _t40 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D58CC */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D58CC */ _t41 = _t40 & 0x00000001u;
         /* 021D58CC */ if (_t41) goto L_021D5924; else goto L_021D58D0;
   L_021D58D0: ; // 0x21d58d0
@@ -690,11 +690,11 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5908 */ rbrew_write32(cpu->mem, _t44, cpu->r[3]);
         /* 021D590C */ cpu->r[8] = 0x10030000u;
         /* 021D5910 */ cpu->r[6] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021D5910 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 021D5910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 021D5914 */ cpu->r[30] = cpu->r[30] + 0x00006344u;
         /* 021D5918 */ _t45 = cpu->r[8] + 0xFFFFFD58u;
         /* 021D5918 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t45);
-        /* 021D591C */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D591C */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D591C */ _t47 = _t46 & 0x00000001u;
         /* 021D591C */ if (_t47) goto L_021D6534; else goto L_021D5920;
   L_021D5920: ; // 0x21d5920
@@ -715,12 +715,12 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D594C */ rbrew_write32(cpu->mem, _t49, cpu->r[3]);
         /* 021D5950 */ cpu->r[8] = 0x10030000u;
         /* 021D5954 */ cpu->r[6] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021D5954 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 021D5954 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 021D5958 */ cpu->r[30] = 0x101F0000u;
         /* 021D595C */ _t50 = cpu->r[8] + 0xFFFFFD58u;
         /* 021D595C */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t50);
         /* 021D5960 */ cpu->r[30] = cpu->r[30] + 0x00006344u;
-        /* 021D5964 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5964 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5964 */ _t52 = _t51 & 0x00000001u;
         /* 021D5964 */ if (_t52) goto L_021D6534; else goto L_021D5968;
   L_021D5968: ; // 0x21d5968
@@ -734,13 +734,13 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D597C */ _t55 = cpu->r[1] + 0x0000007Cu;
         /* 021D597C */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t55);
         /* 021D5980 */ cpu->r[10] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000004u, 0x00000004u);
-        /* 021D5980 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021D5980 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021D5984 */ /* nop */
         /* 021D5988 */ _t56 = cpu->r[31] + 0x00000134u;
         /* 021D5988 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t56);
         /* 021D598C */ _t57 = cpu->r[1] + 0x00000120u;
         /* 021D598C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t57);
-        /* 021D5990 */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5990 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5990 */ _t59 = _t58 & 0x00000001u;
         /* 021D5990 */ if (_t59) goto L_021D59DC; else goto L_021D5994;
   L_021D5994: ; // 0x21d5994
@@ -760,7 +760,7 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D59B4 */ rbrew_write_f32(cpu->mem, _t64, cpu->f[12]);
         /* 021D59B8 */ _t65 = cpu->r[1] + 0x0000012Cu;
         /* 021D59B8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t65);
-        /* 021D59BC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[9]);
+        /* 021D59BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[9]));
         /* 021D59C0 */ _t66 = cpu->r[31] + 0x00000138u;
         /* 021D59C0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t66);
         /* 021D59C4 */ _t67 = cpu->r[1] + 0x00000128u;
@@ -771,7 +771,7 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D59CC */ rbrew_write32(cpu->mem, _t69, cpu->r[7]);
         /* 021D59D0 */ _t70 = cpu->r[1] + 0x00000084u;
         /* 021D59D0 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t70);
-        /* 021D59D4 */ _t71 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D59D4 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D59D4 */ _t72 = _t71 & 0x00000001u;
         /* 021D59D4 */ if (_t72) goto L_021D59D8; else goto L_021D5A24;
   L_021D59D8: ; // 0x21d59d8
@@ -791,7 +791,7 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D59F8 */ rbrew_write_f32(cpu->mem, _t76, cpu->f[12]);
         /* 021D59FC */ _t77 = cpu->r[1] + 0x0000012Cu;
         /* 021D59FC */ cpu->r[8] = rbrew_read32(cpu->mem, _t77);
-        /* 021D5A00 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[9]);
+        /* 021D5A00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[9]));
         /* 021D5A04 */ _t78 = cpu->r[31] + 0x00000138u;
         /* 021D5A04 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t78);
         /* 021D5A08 */ _t79 = cpu->r[1] + 0x00000128u;
@@ -802,7 +802,7 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5A10 */ rbrew_write32(cpu->mem, _t81, cpu->r[7]);
         /* 021D5A14 */ _t82 = cpu->r[1] + 0x00000084u;
         /* 021D5A14 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t82);
-        /* 021D5A18 */ _t83 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D5A18 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D5A18 */ _t84 = _t83 & 0x00000001u;
         /* 021D5A18 */ if (_t84) goto L_021D5A1C; else goto L_021D5A24;
   L_021D5A1C: ; // 0x21d5a1c
@@ -811,12 +811,12 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5A20 */ _t86 = cpu->r[1] + 0x00000080u;
         /* 021D5A20 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t86);
   L_021D5A24: ; // 0x21d5a24
-        /* 021D5A24 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[12]);
+        /* 021D5A24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[12]));
         /* 021D5A28 */ _t87 = cpu->r[1] + 0x00000088u;
         /* 021D5A28 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t87);
         /* 021D5A2C */ _t88 = cpu->r[31] + 0x0000013Cu;
         /* 021D5A2C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t88);
-        /* 021D5A30 */ _t89 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D5A30 */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D5A30 */ _t90 = _t89 & 0x00000001u;
         /* 021D5A30 */ if (_t90) goto L_021D5A34; else goto L_021D5A3C;
   L_021D5A34: ; // 0x21d5a34
@@ -825,10 +825,10 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5A38 */ _t92 = cpu->r[1] + 0x00000084u;
         /* 021D5A38 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t92);
   L_021D5A3C: ; // 0x21d5a3c
-        /* 021D5A3C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
+        /* 021D5A3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
         /* 021D5A40 */ _t93 = cpu->r[31] + 0x00000140u;
         /* 021D5A40 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t93);
-        /* 021D5A44 */ _t94 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D5A44 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D5A44 */ _t95 = _t94 & 0x00000001u;
         /* 021D5A44 */ if (_t95) goto L_021D5A48; else goto L_021D5A50;
   L_021D5A48: ; // 0x21d5a48
@@ -837,28 +837,28 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5A4C */ _t97 = cpu->r[1] + 0x00000088u;
         /* 021D5A4C */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t97);
   L_021D5A50: ; // 0x21d5a50
-        /* 021D5A50 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[8]);
+        /* 021D5A50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[8]));
         /* 021D5A54 */ _t98 = cpu->r[31] + 0x00000144u;
         /* 021D5A54 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t98);
-        /* 021D5A58 */ _t99 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D5A58 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D5A58 */ _t100 = _t99 & 0x00000001u;
         /* 021D5A58 */ if (_t100) goto L_021D5A5C; else goto L_021D5A60;
   L_021D5A5C: ; // 0x21d5a5c
         /* 021D5A5C */ _t101 = cpu->r[31] + 0x00000140u;
         /* 021D5A5C */ rbrew_write_f32(cpu->mem, _t101, cpu->f[7]);
   L_021D5A60: ; // 0x21d5a60
-        /* 021D5A60 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[10]);
+        /* 021D5A60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[10]));
         /* 021D5A64 */ _t102 = cpu->r[31] + 0x00000148u;
         /* 021D5A64 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t102);
-        /* 021D5A68 */ _t103 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D5A68 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D5A68 */ _t104 = _t103 & 0x00000001u;
         /* 021D5A68 */ if (_t104) goto L_021D5A6C; else goto L_021D5A70;
   L_021D5A6C: ; // 0x21d5a6c
         /* 021D5A6C */ _t105 = cpu->r[31] + 0x00000144u;
         /* 021D5A6C */ rbrew_write_f32(cpu->mem, _t105, cpu->f[6]);
   L_021D5A70: ; // 0x21d5a70
-        /* 021D5A70 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[12]);
-        /* 021D5A74 */ _t106 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D5A70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[12]));
+        /* 021D5A74 */ _t106 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D5A74 */ _t107 = _t106 & 0x00000001u;
         /* 021D5A74 */ if (_t107) goto L_021D5A78; else goto L_021D5A7C;
   L_021D5A78: ; // 0x21d5a78
@@ -867,8 +867,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
   L_021D5A7C: ; // 0x21d5a7c
         /* 021D5A7C */ _t109 = cpu->r[26] + 0x00000040u;
         /* 021D5A7C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t109);
-        /* 021D5A80 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[13]);
-        /* 021D5A84 */ _t110 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5A80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[13]));
+        /* 021D5A84 */ _t110 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5A84 */ _t111 = _t110 & 0x00000001u;
         /* 021D5A84 */ if (_t111) goto L_021D5AAC; else goto L_021D5A88;
   L_021D5A88: ; // 0x21d5a88
@@ -877,7 +877,7 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5A8C */ _t113 = cpu->r[26] + 0x00000034u;
         /* 021D5A8C */ rbrew_write_f32(cpu->mem, _t113, cpu->f[29]);
         /* 021D5A90 */ cpu->r[6] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 021D5A90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 021D5A90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 021D5A94 */ _t114 = cpu->r[26] + 0x0000003Cu;
         /* 021D5A94 */ rbrew_write_f32(cpu->mem, _t114, cpu->f[29]);
         /* 021D5A98 */ _t115 = cpu->r[26] + 0x00000040u;
@@ -885,7 +885,7 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5A9C */ cpu->r[11] = cpu->r[26] + 0x00000034u;
         /* 021D5AA0 */ _t116 = cpu->r[26] + 0x00000038u;
         /* 021D5AA0 */ rbrew_write_f32(cpu->mem, _t116, cpu->f[29]);
-        /* 021D5AA4 */ _t117 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5AA4 */ _t117 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5AA4 */ _t118 = _t117 & 0x00000001u;
         /* 021D5AA4 */ if (_t118) goto L_021D5AA8; else goto L_021D5AF0;
   L_021D5AA8: ; // 0x21d5aa8
@@ -894,8 +894,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5AAC */ _t119 = cpu->r[26] + 0x00000000u;
         /* 021D5AAC */ cpu->r[5] = rbrew_read32(cpu->mem, _t119);
         /* 021D5AB0 */ cpu->r[4] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Bu, 0x0000001Cu);
-        /* 021D5AB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 021D5AB4 */ _t120 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5AB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 021D5AB4 */ _t120 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5AB4 */ _t121 = _t120 & 0x00000001u;
         /* 021D5AB4 */ if (_t121) goto L_021D5AB8; else goto L_021D5AD4;
   L_021D5AB8: ; // 0x21d5ab8
@@ -903,11 +903,11 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5AB8 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t122);
         /* 021D5ABC */ _t123 = cpu->r[31] + 0x00000134u;
         /* 021D5ABC */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t123);
-        /* 021D5AC0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[7]);
+        /* 021D5AC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[7]));
         /* 021D5AC4 */ _t124 = cpu->r[31] + 0x00000138u;
         /* 021D5AC4 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t124);
         /* 021D5AC8 */ cpu->r[11] = cpu->r[26] + 0x00000034u;
-        /* 021D5ACC */ _t125 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D5ACC */ _t125 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D5ACC */ _t126 = _t125 & 0x00000001u;
         /* 021D5ACC */ if (_t126) goto L_021D5AD0; else goto L_021D5CC4;
   L_021D5AD0: ; // 0x21d5ad0
@@ -918,13 +918,13 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5AD8 */ _t128 = cpu->r[26] + 0x00000038u;
         /* 021D5AD8 */ rbrew_write_f32(cpu->mem, _t128, cpu->f[29]);
         /* 021D5ADC */ cpu->r[6] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 021D5ADC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 021D5ADC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 021D5AE0 */ _t129 = cpu->r[26] + 0x00000034u;
         /* 021D5AE0 */ rbrew_write_f32(cpu->mem, _t129, cpu->f[29]);
         /* 021D5AE4 */ cpu->r[11] = cpu->r[26] + 0x00000034u;
         /* 021D5AE8 */ _t130 = cpu->r[26] + 0x0000003Cu;
         /* 021D5AE8 */ rbrew_write_f32(cpu->mem, _t130, cpu->f[29]);
-        /* 021D5AEC */ _t131 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5AEC */ _t131 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5AEC */ _t132 = _t131 & 0x00000001u;
         /* 021D5AEC */ if (_t132) goto L_021D5B14; else goto L_021D5AF0;
   L_021D5AF0: ; // 0x21d5af0
@@ -943,8 +943,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5B10 */ cpu->r[5] = rbrew_read32(cpu->mem, _t136);
   L_021D5B14: ; // 0x21d5b14
         /* 021D5B14 */ cpu->r[9] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Bu, 0x0000001Bu);
-        /* 021D5B14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 021D5B18 */ _t137 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5B14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 021D5B18 */ _t137 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5B18 */ _t138 = _t137 & 0x00000001u;
         /* 021D5B18 */ if (_t138) goto L_021D5CA0; else goto L_021D5B1C;
   L_021D5B1C: ; // 0x21d5b1c
@@ -952,12 +952,12 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5B1C */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t139);
         /* 021D5B20 */ _t140 = cpu->r[26] + 0x00000040u;
         /* 021D5B20 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t140);
-        /* 021D5B24 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[29]);
+        /* 021D5B24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[29]));
         /* 021D5B28 */ _t141 = cpu->r[26] + 0x0000001Cu;
         /* 021D5B28 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t141);
         /* 021D5B2C */ _t142 = cpu->r[26] + 0x00000028u;
         /* 021D5B2C */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t142);
-        /* 021D5B30 */ _t143 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D5B30 */ _t143 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D5B30 */ _t144 = _t143 & 0x00000001u;
         /* 021D5B30 */ if (_t144) goto L_021D5B34; else goto L_021D5B58;
   L_021D5B34: ; // 0x21d5b34
@@ -965,20 +965,20 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5B38 */ _t145 = cpu->r[11] + 0x00000004u;
         /* 021D5B38 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t145);
         /* 021D5B3C */ /* nop */
-        /* 021D5B40 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[29]);
+        /* 021D5B40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[29]));
         /* 021D5B44 */ _t146 = cpu->r[26] + 0x0000002Cu;
         /* 021D5B44 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t146);
         /* 021D5B48 */ cpu->f[10] = fma(cpu->f[10], cpu->f[7], cpu->f[13]);
         /* 021D5B4C */ _t147 = cpu->r[26] + 0x00000020u;
         /* 021D5B4C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t147);
-        /* 021D5B50 */ _t148 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D5B50 */ _t148 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D5B50 */ _t149 = _t148 & 0x00000001u;
         /* 021D5B50 */ if (_t149) goto L_021D5B54; else goto L_021D5BC0;
   L_021D5B54: ; // 0x21d5b54
         /* 021D5B54 */ goto L_021D5B9C;
   L_021D5B58: ; // 0x21d5b58
-        /* 021D5B58 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[29]);
-        /* 021D5B5C */ _t150 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D5B58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[29]));
+        /* 021D5B5C */ _t150 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D5B5C */ _t151 = _t150 & 0x00000001u;
         /* 021D5B5C */ if (_t151) goto L_021D5B60; else goto L_021D5B84;
   L_021D5B60: ; // 0x21d5b60
@@ -986,13 +986,13 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5B64 */ _t152 = cpu->r[11] + 0x00000004u;
         /* 021D5B64 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t152);
         /* 021D5B68 */ /* nop */
-        /* 021D5B6C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[29]);
+        /* 021D5B6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[29]));
         /* 021D5B70 */ _t153 = cpu->r[26] + 0x00000020u;
         /* 021D5B70 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t153);
         /* 021D5B74 */ cpu->f[10] = fma(cpu->f[12], cpu->f[7], cpu->f[6]);
         /* 021D5B78 */ _t154 = cpu->r[26] + 0x0000002Cu;
         /* 021D5B78 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t154);
-        /* 021D5B7C */ _t155 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D5B7C */ _t155 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D5B7C */ _t156 = _t155 & 0x00000001u;
         /* 021D5B7C */ if (_t156) goto L_021D5B80; else goto L_021D5BC0;
   L_021D5B80: ; // 0x21d5b80
@@ -1002,11 +1002,11 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5B84 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t157);
         /* 021D5B88 */ _t158 = cpu->r[26] + 0x00000020u;
         /* 021D5B88 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t158);
-        /* 021D5B8C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[29]);
+        /* 021D5B8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[29]));
         /* 021D5B90 */ _t159 = cpu->r[26] + 0x0000002Cu;
         /* 021D5B90 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t159);
         /* 021D5B94 */ cpu->f[10] = cpu->f[10] + cpu->f[12];
-        /* 021D5B98 */ _t160 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D5B98 */ _t160 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D5B98 */ _t161 = _t160 & 0x00000001u;
         /* 021D5B98 */ if (_t161) goto L_021D5B9C; else goto L_021D5BC0;
   L_021D5B9C: ; // 0x21d5b9c
@@ -1017,17 +1017,17 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5BA8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t162);
         /* 021D5BAC */ _t163 = cpu->r[26] + 0x00000024u;
         /* 021D5BAC */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t163);
-        /* 021D5BB0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[29]);
+        /* 021D5BB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[29]));
         /* 021D5BB4 */ _t164 = cpu->r[26] + 0x00000030u;
         /* 021D5BB4 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t164);
-        /* 021D5BB8 */ _t165 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D5BB8 */ _t165 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D5BB8 */ _t166 = _t165 & 0x00000001u;
         /* 021D5BB8 */ if (_t166) goto L_021D5BBC; else goto L_021D5C44;
   L_021D5BBC: ; // 0x21d5bbc
         /* 021D5BBC */ goto L_021D5C04;
   L_021D5BC0: ; // 0x21d5bc0
-        /* 021D5BC0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[29]);
-        /* 021D5BC4 */ _t167 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D5BC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[29]));
+        /* 021D5BC4 */ _t167 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D5BC4 */ _t168 = _t167 & 0x00000001u;
         /* 021D5BC4 */ if (_t168) goto L_021D5BC8; else goto L_021D5BEC;
   L_021D5BC8: ; // 0x21d5bc8
@@ -1035,13 +1035,13 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5BCC */ /* nop */
         /* 021D5BD0 */ _t169 = cpu->r[11] + 0x00000008u;
         /* 021D5BD0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t169);
-        /* 021D5BD4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[29]);
+        /* 021D5BD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[29]));
         /* 021D5BD8 */ _t170 = cpu->r[26] + 0x00000024u;
         /* 021D5BD8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t170);
         /* 021D5BDC */ cpu->f[11] = fma(cpu->f[6], cpu->f[7], cpu->f[9]);
         /* 021D5BE0 */ _t171 = cpu->r[26] + 0x00000030u;
         /* 021D5BE0 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t171);
-        /* 021D5BE4 */ _t172 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D5BE4 */ _t172 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D5BE4 */ _t173 = _t172 & 0x00000001u;
         /* 021D5BE4 */ if (_t173) goto L_021D5BE8; else goto L_021D5C44;
   L_021D5BE8: ; // 0x21d5be8
@@ -1052,10 +1052,10 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5BF0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t174);
         /* 021D5BF4 */ _t175 = cpu->r[26] + 0x00000024u;
         /* 021D5BF4 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t175);
-        /* 021D5BF8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[29]);
+        /* 021D5BF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[29]));
         /* 021D5BFC */ _t176 = cpu->r[26] + 0x00000030u;
         /* 021D5BFC */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t176);
-        /* 021D5C00 */ _t177 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D5C00 */ _t177 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D5C00 */ _t178 = _t177 & 0x00000001u;
         /* 021D5C00 */ if (_t178) goto L_021D5C04; else goto L_021D5C44;
   L_021D5C04: ; // 0x21d5c04
@@ -1079,17 +1079,17 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5C2C */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t185);
         /* 021D5C30 */ _t186 = cpu->r[31] + 0x00000138u;
         /* 021D5C30 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t186);
-        /* 021D5C34 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[7]);
+        /* 021D5C34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[7]));
         /* 021D5C38 */ _t187 = cpu->r[1] + 0x0000007Cu;
         /* 021D5C38 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t187);
-        /* 021D5C3C */ _t188 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D5C3C */ _t188 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D5C3C */ _t189 = _t188 & 0x00000001u;
         /* 021D5C3C */ if (_t189) goto L_021D5C40; else goto L_021D5CC4;
   L_021D5C40: ; // 0x21d5c40
         /* 021D5C40 */ goto L_021D5CC0;
   L_021D5C44: ; // 0x21d5c44
-        /* 021D5C44 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[29]);
-        /* 021D5C48 */ _t190 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D5C44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[29]));
+        /* 021D5C48 */ _t190 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D5C48 */ _t191 = _t190 & 0x00000001u;
         /* 021D5C48 */ if (_t191) goto L_021D5C4C; else goto L_021D5C8C;
   L_021D5C4C: ; // 0x21d5c4c
@@ -1113,10 +1113,10 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5C74 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t198);
         /* 021D5C78 */ _t199 = cpu->r[31] + 0x00000138u;
         /* 021D5C78 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t199);
-        /* 021D5C7C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[7]);
+        /* 021D5C7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[7]));
         /* 021D5C80 */ _t200 = cpu->r[1] + 0x0000007Cu;
         /* 021D5C80 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t200);
-        /* 021D5C84 */ _t201 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D5C84 */ _t201 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D5C84 */ _t202 = _t201 & 0x00000001u;
         /* 021D5C84 */ if (_t202) goto L_021D5C88; else goto L_021D5CC4;
   L_021D5C88: ; // 0x21d5c88
@@ -1141,10 +1141,10 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5CAC */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t209);
         /* 021D5CB0 */ _t210 = cpu->r[31] + 0x00000138u;
         /* 021D5CB0 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t210);
-        /* 021D5CB4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[7]);
+        /* 021D5CB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[7]));
         /* 021D5CB8 */ _t211 = cpu->r[1] + 0x0000007Cu;
         /* 021D5CB8 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t211);
-        /* 021D5CBC */ _t212 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D5CBC */ _t212 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D5CBC */ _t213 = _t212 & 0x00000001u;
         /* 021D5CBC */ if (_t213) goto L_021D5CC0; else goto L_021D5CC4;
   L_021D5CC0: ; // 0x21d5cc0
@@ -1153,10 +1153,10 @@ void Gambit_fn_021D5750(CPUState* cpu) {
   L_021D5CC4: ; // 0x21d5cc4
         /* 021D5CC4 */ _t215 = cpu->r[11] + 0x00000004u;
         /* 021D5CC4 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t215);
-        /* 021D5CC8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[8]);
+        /* 021D5CC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[8]));
         /* 021D5CCC */ _t216 = cpu->r[31] + 0x0000013Cu;
         /* 021D5CCC */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t216);
-        /* 021D5CD0 */ _t217 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D5CD0 */ _t217 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D5CD0 */ _t218 = _t217 & 0x00000001u;
         /* 021D5CD0 */ if (_t218) goto L_021D5CD4; else goto L_021D5CD8;
   L_021D5CD4: ; // 0x21d5cd4
@@ -1165,10 +1165,10 @@ void Gambit_fn_021D5750(CPUState* cpu) {
   L_021D5CD8: ; // 0x21d5cd8
         /* 021D5CD8 */ _t220 = cpu->r[11] + 0x00000008u;
         /* 021D5CD8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t220);
-        /* 021D5CDC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[9]);
+        /* 021D5CDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[9]));
         /* 021D5CE0 */ _t221 = cpu->r[31] + 0x00000140u;
         /* 021D5CE0 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t221);
-        /* 021D5CE4 */ _t222 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D5CE4 */ _t222 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D5CE4 */ _t223 = _t222 & 0x00000001u;
         /* 021D5CE4 */ if (_t223) goto L_021D5CE8; else goto L_021D5CEC;
   L_021D5CE8: ; // 0x21d5ce8
@@ -1177,10 +1177,10 @@ void Gambit_fn_021D5750(CPUState* cpu) {
   L_021D5CEC: ; // 0x21d5cec
         /* 021D5CEC */ _t225 = cpu->r[11] + 0x00000000u;
         /* 021D5CEC */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t225);
-        /* 021D5CF0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[10]);
+        /* 021D5CF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[10]));
         /* 021D5CF4 */ _t226 = cpu->r[31] + 0x00000144u;
         /* 021D5CF4 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t226);
-        /* 021D5CF8 */ _t227 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D5CF8 */ _t227 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D5CF8 */ _t228 = _t227 & 0x00000001u;
         /* 021D5CF8 */ if (_t228) goto L_021D5CFC; else goto L_021D5D00;
   L_021D5CFC: ; // 0x21d5cfc
@@ -1189,8 +1189,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
   L_021D5D00: ; // 0x21d5d00
         /* 021D5D00 */ _t230 = cpu->r[11] + 0x00000004u;
         /* 021D5D00 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t230);
-        /* 021D5D04 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[11]);
-        /* 021D5D08 */ _t231 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D5D04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[11]));
+        /* 021D5D08 */ _t231 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D5D08 */ _t232 = _t231 & 0x00000001u;
         /* 021D5D08 */ if (_t232) goto L_021D5D0C; else goto L_021D5D10;
   L_021D5D0C: ; // 0x21d5d0c
@@ -1201,8 +1201,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5D10 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t234);
         /* 021D5D14 */ _t235 = cpu->r[31] + 0x00000148u;
         /* 021D5D14 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t235);
-        /* 021D5D18 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[12]);
-        /* 021D5D1C */ _t236 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D5D18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[12]));
+        /* 021D5D1C */ _t236 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D5D1C */ _t237 = _t236 & 0x00000001u;
         /* 021D5D1C */ if (_t237) goto L_021D5D20; else goto L_021D5D24;
   L_021D5D20: ; // 0x21d5d20
@@ -1216,16 +1216,16 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5D34 */ cpu->r[5] = cpu->r[1] + 0x0000013Cu;
         /* 021D5D38 */ cpu->r[3] = cpu->r[31];
         /* 021D5D3C */ Gambit_fn_021C2660(cpu);
-        /* 021D5D40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D5D44 */ _t239 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5D40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D5D44 */ _t239 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5D44 */ _t240 = _t239 & 0x00000001u;
         /* 021D5D44 */ if (_t240) goto L_021D5D48; else goto L_021D5DB0;
   L_021D5D48: ; // 0x21d5d48
         /* 021D5D48 */ _t241 = cpu->r[26] + 0x0000015Cu;
         /* 021D5D48 */ cpu->r[10] = rbrew_read32(cpu->mem, _t241);
         /* 021D5D4C */ cpu->r[4] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 021D5D4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 021D5D50 */ _t242 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5D4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 021D5D50 */ _t242 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5D50 */ _t243 = _t242 & 0x00000001u;
         /* 021D5D50 */ if (_t243) goto L_021D5D80; else goto L_021D5D54;
   L_021D5D54: ; // 0x21d5d54
@@ -1241,8 +1241,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5D70 */ _t246 = cpu->r[26] + 0x0000008Cu;
         /* 021D5D70 */ cpu->r[12] = rbrew_read16(cpu->mem, _t246);
         /* 021D5D74 */ cpu->r[4] = rbrew_rlwinm(cpu->r[12], 0x00000017u, 0x0000001Fu, 0x0000001Fu);
-        /* 021D5D74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 021D5D78 */ _t247 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5D74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 021D5D78 */ _t247 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5D78 */ _t248 = _t247 & 0x00000001u;
         /* 021D5D78 */ if (_t248) goto L_021D5D7C; else goto L_021D5DB0;
   L_021D5D7C: ; // 0x21d5d7c
@@ -1250,8 +1250,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5D7C */ cpu->r[10] = rbrew_read32(cpu->mem, _t249);
   L_021D5D80: ; // 0x21d5d80
         /* 021D5D80 */ cpu->r[5] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021D5D80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 021D5D84 */ _t250 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5D80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 021D5D84 */ _t250 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5D84 */ _t251 = _t250 & 0x00000001u;
         /* 021D5D84 */ if (_t251) goto L_021D5DF8; else goto L_021D5D88;
   L_021D5D88: ; // 0x21d5d88
@@ -1267,8 +1267,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5DA4 */ _t254 = cpu->r[26] + 0x000000D8u;
         /* 021D5DA4 */ cpu->r[12] = rbrew_read16(cpu->mem, _t254);
         /* 021D5DA8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[12], 0x00000017u, 0x0000001Fu, 0x0000001Fu);
-        /* 021D5DA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D5DAC */ _t255 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5DA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D5DAC */ _t255 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5DAC */ _t256 = _t255 & 0x00000001u;
         /* 021D5DAC */ if (_t256) goto L_021D5DF8; else goto L_021D5DB0;
   L_021D5DB0: ; // 0x21d5db0
@@ -1295,7 +1295,7 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5DDC */ cpu->f[27] = rbrew_read_f64(cpu->mem, _t265);
         /* 021D5DE0 */ _t266 = cpu->r[1] + 0x000001F8u;
         /* 021D5DE0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t266);
-        /* 021D5DE4 */ _t267 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D5DE4 */ _t267 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D5DE4 */ _t268 = _t267 & 0x00000001u;
         /* 021D5DE4 */ if (_t268) goto L_021D5DE8; // else: addr-0 trap, fall-through
   L_021D5DE8: ; // 0x21d5de8
@@ -1311,8 +1311,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5E00 */ cpu->r[8] = cpu->r[4] + 0x101E0000u;
         /* 021D5E04 */ _t271 = cpu->r[8] + 0xFFFF9484u;
         /* 021D5E04 */ cpu->r[0] = rbrew_read32(cpu->mem, _t271);
-        /* 021D5E08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D5E0C */ _t272 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D5E08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D5E0C */ _t272 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D5E0C */ _t273 = _t272 & 0x00000001u;
         /* 021D5E0C */ if (_t273) goto L_021D5E10; else goto L_021D6548;
   L_021D5E10: ; // 0x21d5e10
@@ -1329,8 +1329,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5E34 */ Gambit_fn_02040F70(cpu);
         /* 021D5E38 */ _t275 = cpu->r[31] + 0x00000258u;
         /* 021D5E38 */ cpu->r[11] = rbrew_read32(cpu->mem, _t275);
-        /* 021D5E3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021D5E40 */ _t276 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5E3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021D5E40 */ _t276 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5E40 */ _t277 = _t276 & 0x00000001u;
         /* 021D5E40 */ if (_t277) goto L_021D6548; else goto L_021D5E44;
   L_021D5E44: ; // 0x21d5e44
@@ -1413,8 +1413,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5EEC */ _t312 = cpu->r[12] + 0x00000000u;
         /* 021D5EEC */ cpu->r[0] = rbrew_read32(cpu->mem, _t312);
         /* 021D5EF0 */ cpu->r[6] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021D5EF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 021D5EF4 */ _t313 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5EF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 021D5EF4 */ _t313 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5EF4 */ _t314 = _t313 & 0x00000001u;
         /* 021D5EF4 */ if (_t314) goto L_021D5F7C; else goto L_021D5EF8;
   L_021D5EF8: ; // 0x21d5ef8
@@ -1464,10 +1464,10 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5F68 */ _t330 = cpu->r[12] + 0x00000000u;
         /* 021D5F68 */ cpu->r[6] = rbrew_read32(cpu->mem, _t330);
         /* 021D5F6C */ cpu->r[5] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021D5F6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021D5F6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021D5F70 */ _t331 = cpu->r[31] + 0x00000258u;
         /* 021D5F70 */ cpu->r[8] = rbrew_read32(cpu->mem, _t331);
-        /* 021D5F74 */ _t332 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5F74 */ _t332 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5F74 */ _t333 = _t332 & 0x00000001u;
         /* 021D5F74 */ if (_t333) goto L_021D601C; else goto L_021D5F78;
   L_021D5F78: ; // 0x21d5f78
@@ -1484,10 +1484,10 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D5F94 */ _t336 = cpu->r[12] + 0x00000000u;
         /* 021D5F94 */ cpu->r[6] = rbrew_read32(cpu->mem, _t336);
         /* 021D5F98 */ cpu->r[5] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021D5F98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021D5F98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021D5F9C */ _t337 = cpu->r[31] + 0x00000258u;
         /* 021D5F9C */ cpu->r[8] = rbrew_read32(cpu->mem, _t337);
-        /* 021D5FA0 */ _t338 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D5FA0 */ _t338 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D5FA0 */ _t339 = _t338 & 0x00000001u;
         /* 021D5FA0 */ if (_t339) goto L_021D601C; else goto L_021D5FA4;
   L_021D5FA4: ; // 0x21d5fa4
@@ -1532,9 +1532,9 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6008 */ _t353 = cpu->r[8] + 0x00000000u;
         /* 021D6008 */ cpu->r[11] = rbrew_read32(cpu->mem, _t353);
         /* 021D600C */ cpu->r[10] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021D600C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021D600C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021D6010 */ /* nop */
-        /* 021D6014 */ _t354 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D6014 */ _t354 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D6014 */ _t355 = _t354 & 0x00000001u;
         /* 021D6014 */ if (_t355) goto L_021D6018; else goto L_021D6044;
   L_021D6018: ; // 0x21d6018
@@ -1555,9 +1555,9 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6034 */ _t362 = cpu->r[8] + 0x00000000u;
         /* 021D6034 */ cpu->r[11] = rbrew_read32(cpu->mem, _t362);
         /* 021D6038 */ cpu->r[10] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021D6038 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021D6038 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021D603C */ /* nop */
-        /* 021D6040 */ _t363 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D6040 */ _t363 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D6040 */ _t364 = _t363 & 0x00000001u;
         /* 021D6040 */ if (_t364) goto L_021D60DC; else goto L_021D6044;
   L_021D6044: ; // 0x21d6044
@@ -1613,8 +1613,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D60CC */ _t380 = cpu->r[4] + 0x00000000u;
         /* 021D60CC */ cpu->r[11] = rbrew_read32(cpu->mem, _t380);
         /* 021D60D0 */ cpu->r[9] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021D60D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 021D60D4 */ _t381 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D60D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 021D60D4 */ _t381 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D60D4 */ _t382 = _t381 & 0x00000001u;
         /* 021D60D4 */ if (_t382) goto L_021D60D8; else goto L_021D612C;
   L_021D60D8: ; // 0x21d60d8
@@ -1650,8 +1650,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6120 */ _t393 = cpu->r[4] + 0x00000000u;
         /* 021D6120 */ cpu->r[11] = rbrew_read32(cpu->mem, _t393);
         /* 021D6124 */ cpu->r[9] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021D6124 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 021D6128 */ _t394 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D6124 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 021D6128 */ _t394 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D6128 */ _t395 = _t394 & 0x00000001u;
         /* 021D6128 */ if (_t395) goto L_021D61E0; else goto L_021D612C;
   L_021D612C: ; // 0x21d612c
@@ -1718,8 +1718,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D61C8 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t416);
         /* 021D61CC */ cpu->f[12] = fma(cpu->f[7], cpu->f[7], cpu->f[13]);
         /* 021D61D0 */ cpu->f[0] = fma(cpu->f[10], cpu->f[10], cpu->f[12]);
-        /* 021D61D4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[29]);
-        /* 021D61D8 */ _t417 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D61D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[29]));
+        /* 021D61D8 */ _t417 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D61D8 */ _t418 = _t417 & 0x00000001u;
         /* 021D61D8 */ if (_t418) goto L_021D61DC; else goto L_021D6250;
   L_021D61DC: ; // 0x21d61dc
@@ -1771,8 +1771,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D623C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t438);
         /* 021D6240 */ cpu->f[12] = fma(cpu->f[7], cpu->f[7], cpu->f[13]);
         /* 021D6244 */ cpu->f[0] = fma(cpu->f[10], cpu->f[10], cpu->f[12]);
-        /* 021D6248 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[29]);
-        /* 021D624C */ _t439 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D6248 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[29]));
+        /* 021D624C */ _t439 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D624C */ _t440 = _t439 & 0x00000001u;
         /* 021D624C */ if (_t440) goto L_021D63A4; else goto L_021D6250;
   L_021D6250: ; // 0x21d6250
@@ -1837,10 +1837,10 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D62EC */ cpu->f[0] = fabs(cpu->f[12]);
         /* 021D62F0 */ _t460 = cpu->r[4] + 0xFFFFFD60u;
         /* 021D62F0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t460);
-        /* 021D62F4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[12]);
+        /* 021D62F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[12]));
         /* 021D62F8 */ _t461 = cpu->r[1] + 0x00000038u;
         /* 021D62F8 */ rbrew_write_f32(cpu->mem, _t461, cpu->f[10]);
-        /* 021D62FC */ _t462 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D62FC */ _t462 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D62FC */ _t463 = _t462 & 0x00000001u;
         /* 021D62FC */ if (_t463) goto L_021D6484; else goto L_021D6300;
   L_021D6300: ; // 0x21d6300
@@ -1907,8 +1907,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6390 */ rbrew_write_f32(cpu->mem, _t487, cpu->f[6]);
         /* 021D6394 */ _t488 = cpu->r[31] + 0x00000160u;
         /* 021D6394 */ cpu->r[11] = rbrew_read32(cpu->mem, _t488);
-        /* 021D6398 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021D639C */ _t489 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D6398 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021D639C */ _t489 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D639C */ _t490 = _t489 & 0x00000001u;
         /* 021D639C */ if (_t490) goto L_021D63A0; else goto L_021D6F4C;
   L_021D63A0: ; // 0x21d63a0
@@ -1992,10 +1992,10 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6470 */ cpu->f[0] = fabs(cpu->f[12]);
         /* 021D6474 */ _t515 = cpu->r[4] + 0xFFFFFD60u;
         /* 021D6474 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t515);
-        /* 021D6478 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[12]);
+        /* 021D6478 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[12]));
         /* 021D647C */ _t516 = cpu->r[1] + 0x00000038u;
         /* 021D647C */ rbrew_write_f32(cpu->mem, _t516, cpu->f[10]);
-        /* 021D6480 */ _t517 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D6480 */ _t517 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D6480 */ _t518 = _t517 & 0x00000001u;
         /* 021D6480 */ if (_t518) goto L_021D6484; else goto L_021D6300;
   L_021D6484: ; // 0x21d6484
@@ -2068,8 +2068,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6520 */ rbrew_write_f32(cpu->mem, _t545, cpu->f[6]);
         /* 021D6524 */ _t546 = cpu->r[31] + 0x00000160u;
         /* 021D6524 */ cpu->r[11] = rbrew_read32(cpu->mem, _t546);
-        /* 021D6528 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021D652C */ _t547 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D6528 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021D652C */ _t547 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D652C */ _t548 = _t547 & 0x00000001u;
         /* 021D652C */ if (_t548) goto L_021D6530; else goto L_021D6F4C;
   L_021D6530: ; // 0x21d6530
@@ -2078,13 +2078,13 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6534 */ cpu->r[3] = cpu->r[31];
         /* 021D6538 */ cpu->r[4] = cpu->r[1] + 0x000000B0u;
         /* 021D653C */ Gambit_fn_021C3934(cpu);
-        /* 021D6540 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D6544 */ _t549 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D6540 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D6544 */ _t549 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D6544 */ _t550 = _t549 & 0x00000001u;
         /* 021D6544 */ if (_t550) goto L_021D6548; else goto L_021D709C;
   L_021D6548: ; // 0x21d6548
-        /* 021D6548 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021D654C */ _t551 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D6548 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021D654C */ _t551 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D654C */ _t552 = _t551 & 0x00000001u;
         /* 021D654C */ if (_t552) goto L_021D65B8; else goto L_021D6550;
   L_021D6550: ; // 0x21d6550
@@ -2129,8 +2129,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D65A4 */ rbrew_write_f32(cpu->mem, _t569, cpu->f[6]);
         /* 021D65A8 */ _t570 = cpu->r[31] + 0x00000160u;
         /* 021D65A8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t570);
-        /* 021D65AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021D65B0 */ _t571 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D65AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021D65B0 */ _t571 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D65B0 */ _t572 = _t571 & 0x00000001u;
         /* 021D65B0 */ if (_t572) goto L_021D65B4; else goto L_021D6F4C;
   L_021D65B4: ; // 0x21d65b4
@@ -2190,10 +2190,10 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6640 */ cpu->f[12] = fabs(cpu->f[10]);
         /* 021D6644 */ _t590 = cpu->r[11] + 0xFFFFFD60u;
         /* 021D6644 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t590);
-        /* 021D6648 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[13]);
+        /* 021D6648 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[13]));
         /* 021D664C */ _t591 = cpu->r[1] + 0x0000002Cu;
         /* 021D664C */ rbrew_write_f32(cpu->mem, _t591, cpu->f[8]);
-        /* 021D6650 */ _t592 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D6650 */ _t592 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D6650 */ _t593 = _t592 & 0x00000001u;
         /* 021D6650 */ if (_t593) goto L_021D6654; else goto L_021D6748;
   L_021D6654: ; // 0x21d6654
@@ -2296,11 +2296,11 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6728 */ cpu->f[10] = cpu->f[30] * cpu->f[11];
         /* 021D672C */ cpu->f[0] = -fma(cpu->f[28], cpu->f[12], -(cpu->f[10]));
         /* 021D6730 */ cpu->f[13] = -fma(cpu->f[28], cpu->f[8], -(cpu->f[10]));
-        /* 021D6734 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
+        /* 021D6734 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
         /* 021D6738 */ cpu->f[7] = -fma(cpu->f[28], cpu->f[6], -(cpu->f[10]));
         /* 021D673C */ _t637 = cpu->r[1] + 0x00000074u;
         /* 021D673C */ rbrew_write_f32(cpu->mem, _t637, cpu->f[9]);
-        /* 021D6740 */ _t638 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D6740 */ _t638 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D6740 */ _t639 = _t638 & 0x00000001u;
         /* 021D6740 */ if (_t639) goto L_021D6834; else goto L_021D6744;
   L_021D6744: ; // 0x21d6744
@@ -2403,79 +2403,79 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6818 */ cpu->f[10] = cpu->f[30] * cpu->f[11];
         /* 021D681C */ cpu->f[0] = -fma(cpu->f[28], cpu->f[12], -(cpu->f[10]));
         /* 021D6820 */ cpu->f[13] = -fma(cpu->f[28], cpu->f[8], -(cpu->f[10]));
-        /* 021D6824 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
+        /* 021D6824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
         /* 021D6828 */ cpu->f[7] = -fma(cpu->f[28], cpu->f[6], -(cpu->f[10]));
         /* 021D682C */ _t682 = cpu->r[1] + 0x00000074u;
         /* 021D682C */ rbrew_write_f32(cpu->mem, _t682, cpu->f[9]);
-        /* 021D6830 */ _t683 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D6830 */ _t683 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D6830 */ _t684 = _t683 & 0x00000001u;
         /* 021D6830 */ if (_t684) goto L_021D6834; else goto L_021D6854;
   L_021D6834: ; // 0x21d6834
-        /* 021D6834 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[13]);
-        /* 021D6838 */ _t685 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D6834 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[13]));
+        /* 021D6838 */ _t685 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D6838 */ _t686 = _t685 & 0x00000001u;
         /* 021D6838 */ if (_t686) goto L_021D683C; else goto L_021D6874;
   L_021D683C: ; // 0x21d683c
-        /* 021D683C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[7]);
-        /* 021D6840 */ _t687 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D683C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[7]));
+        /* 021D6840 */ _t687 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D6840 */ _t688 = _t687 & 0x00000001u;
         /* 021D6840 */ if (_t688) goto L_021D6844; else goto L_021D6890;
   L_021D6844: ; // 0x21d6844
-        /* 021D6844 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[29]);
+        /* 021D6844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[29]));
         /* 021D6848 */ cpu->r[0] = 0x00000000u;
-        /* 021D684C */ _t689 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D684C */ _t689 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D684C */ _t690 = _t689 & 0x00000001u;
         /* 021D684C */ if (_t690) goto L_021D6850; else goto L_021D68C4;
   L_021D6850: ; // 0x21d6850
         /* 021D6850 */ goto L_021D68A8;
   L_021D6854: ; // 0x21d6854
-        /* 021D6854 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
-        /* 021D6858 */ _t691 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D6854 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
+        /* 021D6858 */ _t691 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D6858 */ _t692 = _t691 & 0x00000001u;
         /* 021D6858 */ if (_t692) goto L_021D685C; else goto L_021D6874;
   L_021D685C: ; // 0x21d685c
-        /* 021D685C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[7]);
-        /* 021D6860 */ _t693 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D685C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[7]));
+        /* 021D6860 */ _t693 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D6860 */ _t694 = _t693 & 0x00000001u;
         /* 021D6860 */ if (_t694) goto L_021D6864; else goto L_021D6890;
   L_021D6864: ; // 0x21d6864
-        /* 021D6864 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[29]);
+        /* 021D6864 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[29]));
         /* 021D6868 */ cpu->r[0] = 0x00000001u;
-        /* 021D686C */ _t695 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D686C */ _t695 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D686C */ _t696 = _t695 & 0x00000001u;
         /* 021D686C */ if (_t696) goto L_021D6870; else goto L_021D6938;
   L_021D6870: ; // 0x21d6870
         /* 021D6870 */ goto L_021D691C;
   L_021D6874: ; // 0x21d6874
-        /* 021D6874 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[7]);
-        /* 021D6878 */ _t697 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D6874 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[7]));
+        /* 021D6878 */ _t697 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D6878 */ _t698 = _t697 & 0x00000001u;
         /* 021D6878 */ if (_t698) goto L_021D687C; else goto L_021D6890;
   L_021D687C: ; // 0x21d687c
         /* 021D687C */ cpu->r[0] = 0x00000002u;
-        /* 021D6880 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
-        /* 021D6884 */ _t699 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D6880 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
+        /* 021D6884 */ _t699 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D6884 */ _t700 = _t699 & 0x00000001u;
         /* 021D6884 */ if (_t700) goto L_021D6990; else goto L_021D6888;
   L_021D6888: ; // 0x21d6888
-        /* 021D6888 */ _t701 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D6888 */ _t701 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D6888 */ _t702 = _t701 & 0x00000001u;
         /* 021D6888 */ if (_t702) goto L_021D6A0C; else goto L_021D688C;
   L_021D688C: ; // 0x21d688c
         /* 021D688C */ goto L_021D68A0;
   L_021D6890: ; // 0x21d6890
         /* 021D6890 */ cpu->r[0] = 0x00000003u;
-        /* 021D6894 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
-        /* 021D6898 */ _t703 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D6894 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
+        /* 021D6898 */ _t703 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D6898 */ _t704 = _t703 & 0x00000001u;
         /* 021D6898 */ if (_t704) goto L_021D6990; else goto L_021D689C;
   L_021D689C: ; // 0x21d689c
-        /* 021D689C */ _t705 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D689C */ _t705 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D689C */ _t706 = _t705 & 0x00000001u;
         /* 021D689C */ if (_t706) goto L_021D6A0C; else goto L_021D68A0;
   L_021D68A0: ; // 0x21d68a0
-        /* 021D68A0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[29]);
-        /* 021D68A4 */ _t707 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D68A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[29]));
+        /* 021D68A4 */ _t707 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D68A4 */ _t708 = _t707 & 0x00000001u;
         /* 021D68A4 */ if (_t708) goto L_021D68A8; else goto L_021D68C4;
   L_021D68A8: ; // 0x21d68a8
@@ -2520,8 +2520,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6908 */ rbrew_write_f32(cpu->mem, _t721, cpu->f[12]);
         /* 021D690C */ _t722 = cpu->r[31] + 0x00000160u;
         /* 021D690C */ cpu->r[11] = rbrew_read32(cpu->mem, _t722);
-        /* 021D6910 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021D6914 */ _t723 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D6910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021D6914 */ _t723 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D6914 */ _t724 = _t723 & 0x00000001u;
         /* 021D6914 */ if (_t724) goto L_021D6918; else goto L_021D6F4C;
   L_021D6918: ; // 0x21d6918
@@ -2568,15 +2568,15 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D697C */ rbrew_write_f32(cpu->mem, _t737, cpu->f[0]);
         /* 021D6980 */ _t738 = cpu->r[31] + 0x00000160u;
         /* 021D6980 */ cpu->r[11] = rbrew_read32(cpu->mem, _t738);
-        /* 021D6984 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021D6988 */ _t739 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D6984 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021D6988 */ _t739 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D6988 */ _t740 = _t739 & 0x00000001u;
         /* 021D6988 */ if (_t740) goto L_021D698C; else goto L_021D6F4C;
   L_021D698C: ; // 0x21d698c
         /* 021D698C */ goto L_021D6A94;
   L_021D6990: ; // 0x21d6990
-        /* 021D6990 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[29]);
-        /* 021D6994 */ _t741 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D6990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[29]));
+        /* 021D6994 */ _t741 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D6994 */ _t742 = _t741 & 0x00000001u;
         /* 021D6994 */ if (_t742) goto L_021D6998; else goto L_021D69B4;
   L_021D6998: ; // 0x21d6998
@@ -2621,15 +2621,15 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D69F8 */ rbrew_write_f32(cpu->mem, _t755, cpu->f[9]);
         /* 021D69FC */ _t756 = cpu->r[31] + 0x00000160u;
         /* 021D69FC */ cpu->r[11] = rbrew_read32(cpu->mem, _t756);
-        /* 021D6A00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021D6A04 */ _t757 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D6A00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021D6A04 */ _t757 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D6A04 */ _t758 = _t757 & 0x00000001u;
         /* 021D6A04 */ if (_t758) goto L_021D6A08; else goto L_021D6F4C;
   L_021D6A08: ; // 0x21d6a08
         /* 021D6A08 */ goto L_021D6A94;
   L_021D6A0C: ; // 0x21d6a0c
-        /* 021D6A0C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[29]);
-        /* 021D6A10 */ _t759 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D6A0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[29]));
+        /* 021D6A10 */ _t759 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D6A10 */ _t760 = _t759 & 0x00000001u;
         /* 021D6A10 */ if (_t760) goto L_021D6A14; else goto L_021D6A30;
   L_021D6A14: ; // 0x21d6a14
@@ -2674,30 +2674,30 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6A74 */ rbrew_write_f32(cpu->mem, _t773, cpu->f[13]);
         /* 021D6A78 */ _t774 = cpu->r[31] + 0x00000160u;
         /* 021D6A78 */ cpu->r[11] = rbrew_read32(cpu->mem, _t774);
-        /* 021D6A7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021D6A80 */ _t775 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D6A7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021D6A80 */ _t775 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D6A80 */ _t776 = _t775 & 0x00000001u;
         /* 021D6A80 */ if (_t776) goto L_021D6A84; else goto L_021D6F4C;
   L_021D6A84: ; // 0x21d6a84
         /* 021D6A84 */ goto L_021D6A94;
   L_021D6A88: ; // 0x21d6a88
         /* 021D6A88 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 021D6A88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D6A88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D6A8C */ _t777 = cpu->r[31] + 0x00000160u;
         /* 021D6A8C */ rbrew_write32(cpu->mem, _t777, cpu->r[11]);
-        /* 021D6A90 */ _t778 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D6A90 */ _t778 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D6A90 */ _t779 = _t778 & 0x00000001u;
         /* 021D6A90 */ if (_t779) goto L_021D6A94; else goto L_021D6F4C;
   L_021D6A94: ; // 0x21d6a94
         /* 021D6A94 */ _t780 = cpu->r[31] + 0x00000198u;
         /* 021D6A94 */ cpu->r[7] = rbrew_read8(cpu->mem, _t780);
-        /* 021D6A98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021D6A9C */ _t781 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D6A98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021D6A9C */ _t781 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D6A9C */ _t782 = _t781 & 0x00000001u;
         /* 021D6A9C */ if (_t782) goto L_021D6AA0; else goto L_021D6ADC;
   L_021D6AA0: ; // 0x21d6aa0
-        /* 021D6AA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x0000005Au);
-        /* 021D6AA4 */ _t783 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D6AA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x0000005Au));
+        /* 021D6AA4 */ _t783 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D6AA4 */ _t784 = _t783 & 0x00000001u;
         /* 021D6AA4 */ if (_t784) goto L_021D6AA8; else goto L_021D6ADC;
   L_021D6AA8: ; // 0x21d6aa8
@@ -2740,8 +2740,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6AFC */ _t796 = cpu->r[9] + 0x00000000u;
         /* 021D6AFC */ cpu->r[0] = rbrew_read32(cpu->mem, _t796);
         /* 021D6B00 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021D6B00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D6B04 */ _t797 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D6B00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D6B04 */ _t797 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D6B04 */ _t798 = _t797 & 0x00000001u;
         /* 021D6B04 */ if (_t798) goto L_021D6BC4; else goto L_021D6B08;
   L_021D6B08: ; // 0x21d6b08
@@ -2818,8 +2818,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6BB4 */ _t826 = cpu->r[9] + 0x00000000u;
         /* 021D6BB4 */ cpu->r[4] = rbrew_read32(cpu->mem, _t826);
         /* 021D6BB8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021D6BB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D6BBC */ _t827 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D6BB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D6BBC */ _t827 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D6BBC */ _t828 = _t827 & 0x00000001u;
         /* 021D6BBC */ if (_t828) goto L_021D6CBC; else goto L_021D6BC0;
   L_021D6BC0: ; // 0x21d6bc0
@@ -2860,8 +2860,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6C0C */ _t843 = cpu->r[9] + 0x00000000u;
         /* 021D6C0C */ cpu->r[4] = rbrew_read32(cpu->mem, _t843);
         /* 021D6C10 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021D6C10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D6C14 */ _t844 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D6C10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D6C14 */ _t844 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D6C14 */ _t845 = _t844 & 0x00000001u;
         /* 021D6C14 */ if (_t845) goto L_021D6CBC; else goto L_021D6C18;
   L_021D6C18: ; // 0x21d6c18
@@ -2930,8 +2930,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6CAC */ _t871 = cpu->r[9] + 0x00000000u;
         /* 021D6CAC */ cpu->r[4] = rbrew_read32(cpu->mem, _t871);
         /* 021D6CB0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021D6CB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D6CB4 */ _t872 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D6CB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D6CB4 */ _t872 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D6CB4 */ _t873 = _t872 & 0x00000001u;
         /* 021D6CB4 */ if (_t873) goto L_021D6DB4; else goto L_021D6CB8;
   L_021D6CB8: ; // 0x21d6cb8
@@ -2976,8 +2976,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6D04 */ _t892 = cpu->r[9] + 0x00000000u;
         /* 021D6D04 */ cpu->r[4] = rbrew_read32(cpu->mem, _t892);
         /* 021D6D08 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021D6D08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D6D0C */ _t893 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D6D08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D6D0C */ _t893 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D6D0C */ _t894 = _t893 & 0x00000001u;
         /* 021D6D0C */ if (_t894) goto L_021D6DB4; else goto L_021D6D10;
   L_021D6D10: ; // 0x21d6d10
@@ -3046,8 +3046,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6DA4 */ _t920 = cpu->r[9] + 0x00000000u;
         /* 021D6DA4 */ cpu->r[6] = rbrew_read32(cpu->mem, _t920);
         /* 021D6DA8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021D6DA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D6DAC */ _t921 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D6DA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D6DAC */ _t921 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D6DAC */ _t922 = _t921 & 0x00000001u;
         /* 021D6DAC */ if (_t922) goto L_021D6ED8; else goto L_021D6DB0;
   L_021D6DB0: ; // 0x21d6db0
@@ -3092,8 +3092,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6DFC */ _t941 = cpu->r[9] + 0x00000000u;
         /* 021D6DFC */ cpu->r[6] = rbrew_read32(cpu->mem, _t941);
         /* 021D6E00 */ cpu->r[0] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021D6E00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D6E04 */ _t942 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D6E00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D6E04 */ _t942 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D6E04 */ _t943 = _t942 & 0x00000001u;
         /* 021D6E04 */ if (_t943) goto L_021D6ED8; else goto L_021D6E08;
   L_021D6E08: ; // 0x21d6e08
@@ -3178,12 +3178,12 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6EC0 */ Gambit_fn_021D73F8(cpu);
         /* 021D6EC4 */ _t976 = cpu->r[31] + 0x00000160u;
         /* 021D6EC4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t976);
-        /* 021D6EC8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000001u);
-        /* 021D6ECC */ _t977 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D6EC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000001u));
+        /* 021D6ECC */ _t977 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D6ECC */ _t978 = _t977 & 0x00000001u;
         /* 021D6ECC */ if (_t978) goto L_021D6F74; else goto L_021D6ED0;
   L_021D6ED0: ; // 0x21d6ed0
-        /* 021D6ED0 */ _t979 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D6ED0 */ _t979 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D6ED0 */ _t980 = _t979 & 0x00000001u;
         /* 021D6ED0 */ if (_t980) goto L_021D6F98; else goto L_021D6ED4;
   L_021D6ED4: ; // 0x21d6ed4
@@ -3245,12 +3245,12 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6F48 */ _t1006 = cpu->r[31] + 0x00000160u;
         /* 021D6F48 */ cpu->r[11] = rbrew_read32(cpu->mem, _t1006);
   L_021D6F4C: ; // 0x21d6f4c
-        /* 021D6F4C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x00000001u);
-        /* 021D6F50 */ _t1007 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D6F4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x00000001u));
+        /* 021D6F50 */ _t1007 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D6F50 */ _t1008 = _t1007 & 0x00000001u;
         /* 021D6F50 */ if (_t1008) goto L_021D6F74; else goto L_021D6F54;
   L_021D6F54: ; // 0x21d6f54
-        /* 021D6F54 */ _t1009 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D6F54 */ _t1009 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D6F54 */ _t1010 = _t1009 & 0x00000001u;
         /* 021D6F54 */ if (_t1010) goto L_021D6F98; else goto L_021D6F58;
   L_021D6F58: ; // 0x21d6f58
@@ -3259,8 +3259,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6F60 */ Gambit_fn_021C2564(cpu);
         /* 021D6F64 */ _t1011 = cpu->r[31] + 0x00000160u;
         /* 021D6F64 */ cpu->r[11] = rbrew_read32(cpu->mem, _t1011);
-        /* 021D6F68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x0000000Au);
-        /* 021D6F6C */ _t1012 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D6F68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x0000000Au));
+        /* 021D6F6C */ _t1012 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D6F6C */ _t1013 = _t1012 & 0x00000001u;
         /* 021D6F6C */ if (_t1013) goto L_021D6F70; else goto L_021D6FE0;
   L_021D6F70: ; // 0x21d6f70
@@ -3273,8 +3273,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6F84 */ Gambit_fn_021C2564(cpu);
         /* 021D6F88 */ _t1014 = cpu->r[31] + 0x00000160u;
         /* 021D6F88 */ cpu->r[11] = rbrew_read32(cpu->mem, _t1014);
-        /* 021D6F8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x0000000Au);
-        /* 021D6F90 */ _t1015 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D6F8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x0000000Au));
+        /* 021D6F90 */ _t1015 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D6F90 */ _t1016 = _t1015 & 0x00000001u;
         /* 021D6F90 */ if (_t1016) goto L_021D6F94; else goto L_021D6FE0;
   L_021D6F94: ; // 0x21d6f94
@@ -3294,8 +3294,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6FBC */ Gambit_fn_021C2564(cpu);
         /* 021D6FC0 */ _t1019 = cpu->r[31] + 0x00000160u;
         /* 021D6FC0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t1019);
-        /* 021D6FC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x0000000Au);
-        /* 021D6FC8 */ _t1020 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D6FC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x0000000Au));
+        /* 021D6FC8 */ _t1020 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D6FC8 */ _t1021 = _t1020 & 0x00000001u;
         /* 021D6FC8 */ if (_t1021) goto L_021D6FCC; else goto L_021D6FE0;
   L_021D6FCC: ; // 0x21d6fcc
@@ -3307,8 +3307,8 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D6FDC */ _t1023 = cpu->r[31] + 0x00000160u;
         /* 021D6FDC */ cpu->r[11] = rbrew_read32(cpu->mem, _t1023);
   L_021D6FE0: ; // 0x21d6fe0
-        /* 021D6FE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000078u);
-        /* 021D6FE4 */ _t1024 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D6FE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000078u));
+        /* 021D6FE4 */ _t1024 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D6FE4 */ _t1025 = _t1024 & 0x00000001u;
         /* 021D6FE4 */ if (_t1025) goto L_021D6FE8; else goto L_021D709C;
   L_021D6FE8: ; // 0x21d6fe8
@@ -3390,7 +3390,7 @@ void Gambit_fn_021D5750(CPUState* cpu) {
         /* 021D70C0 */ cpu->f[27] = rbrew_read_f64(cpu->mem, _t1045);
         /* 021D70C4 */ _t1046 = cpu->r[1] + 0x000001F8u;
         /* 021D70C4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t1046);
-        /* 021D70C8 */ _t1047 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D70C8 */ _t1047 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D70C8 */ _t1048 = _t1047 & 0x00000001u;
         /* 021D70C8 */ if (_t1048) goto L_021D70CC; // else: addr-0 trap, fall-through
   L_021D70CC: ; // 0x21d70cc
@@ -3626,10 +3626,10 @@ void Gambit_fn_021D7114(CPUState* cpu) {
         /* 021C5D38 */ _t60 = cpu->r[5] + 0xFFFFB604u;
         /* 021C5D38 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t60);
         /* 021C5D3C */ cpu->r[7] = 0x10030000u;
-        /* 021C5D40 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[29]);
+        /* 021C5D40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[29]));
         /* 021C5D44 */ _t61 = cpu->r[7] + 0xFFFFB600u;
         /* 021C5D44 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t61);
-        /* 021C5D48 */ _t62 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C5D48 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C5D48 */ _t63 = _t62 & 0x00000001u;
         /* 021C5D48 */ if (_t63) goto L_021C5D4C; else goto L_021C5D7C;
   L_021C5D4C: ; // 0x21c5d4c
@@ -3672,8 +3672,8 @@ void Gambit_fn_021D7114(CPUState* cpu) {
         /* 021C5DA8 */ cpu->f[12] = cpu->f[27] * cpu->f[27];
         /* 021C5DAC */ cpu->f[13] = fma(cpu->f[28], cpu->f[28], cpu->f[12]);
         /* 021C5DB0 */ cpu->f[6] = fma(cpu->f[26], cpu->f[26], cpu->f[13]);
-        /* 021C5DB4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[29]);
-        /* 021C5DB8 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C5DB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[29]));
+        /* 021C5DB8 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C5DB8 */ _t77 = _t76 & 0x00000001u;
         /* 021C5DB8 */ if (_t77) goto L_021C5DC4; else goto L_021C5DBC;
   L_021C5DBC: ; // 0x21c5dbc
@@ -3867,13 +3867,13 @@ void Gambit_fn_021D7114(CPUState* cpu) {
         /* 021C5F74 */ Gambit_fn_023C9CBC(cpu);
         /* 021C5F78 */ _t151 = cpu->r[28] + 0x0000001Cu;
         /* 021C5F78 */ cpu->r[0] = rbrew_read32(cpu->mem, _t151);
-        /* 021C5F7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021C5F80 */ _t152 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C5F7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021C5F80 */ _t152 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C5F80 */ _t153 = _t152 & 0x00000001u;
         /* 021C5F80 */ if (_t153) goto L_021C5F8C; else goto L_021C5F84;
   L_021C5F84: ; // 0x21c5f84
-        /* 021C5F84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021C5F88 */ _t154 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C5F84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021C5F88 */ _t154 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C5F88 */ _t155 = _t154 & 0x00000001u;
         /* 021C5F88 */ if (_t155) goto L_021C5F8C; else goto L_021C5FE8;
   L_021C5F8C: ; // 0x21c5f8c
@@ -3932,9 +3932,9 @@ void Gambit_fn_021D7114(CPUState* cpu) {
         /* 021C6014 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t172);
         /* 021C6018 */ cpu->f[12] = fma(cpu->f[7], cpu->f[7], cpu->f[10]);
         /* 021C601C */ cpu->f[8] = fma(cpu->f[6], cpu->f[6], cpu->f[12]);
-        /* 021C6020 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[29]);
+        /* 021C6020 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[29]));
         /* 021C6024 */ cpu->f[28] = cpu->f[1];
-        /* 021C6028 */ _t173 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6028 */ _t173 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C6028 */ _t174 = _t173 & 0x00000001u;
         /* 021C6028 */ if (_t174) goto L_021C602C; else goto L_021C6058;
   L_021C602C: ; // 0x21c602c
@@ -3984,7 +3984,7 @@ void Gambit_fn_021D7114(CPUState* cpu) {
         /* 021C60A4 */ cpu->r[5] = 0x10030000u;
         /* 021C60A8 */ _t187 = cpu->r[8] + 0xFFFF958Cu;
         /* 021C60A8 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t187);
-        /* 021C60AC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[27], cpu->f[29]);
+        /* 021C60AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[27], cpu->f[29]));
         /* 021C60B0 */ _t188 = cpu->r[1] + 0x000000E0u;
         /* 021C60B0 */ rbrew_write32(cpu->mem, _t188, cpu->r[12]);
         /* 021C60B4 */ /* nop */
@@ -4012,11 +4012,11 @@ void Gambit_fn_021D7114(CPUState* cpu) {
   L_021C60F8: ; // 0x21c60f8
         /* 021C60F8 */ cpu->r[3] = cpu->r[1] + 0x00000024u;
         /* 021C60FC */ Gambit_fn_02043AC4(cpu);
-        /* 021C6100 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021C6100 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021C6104 */ _t194 = cpu->r[25] + 0x00000000u;
         /* 021C6104 */ cpu->r[3] = rbrew_read32(cpu->mem, _t194);
         /* 021C6108 */ cpu->f[3] = cpu->f[31];
-        /* 021C610C */ _t195 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C610C */ _t195 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C610C */ _t196 = _t195 & 0x00000001u;
         /* 021C610C */ if (_t196) goto L_021C6150; else goto L_021C6110;
   L_021C6110: ; // 0x21c6110
@@ -4035,10 +4035,10 @@ void Gambit_fn_021D7114(CPUState* cpu) {
         /* 021C6138 */ rbrew_write32(cpu->mem, _t198, cpu->r[0]);
         /* 021C613C */ Gambit_fn_0204A4DC(cpu);
         /* 021C6140 */ cpu->r[9] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C6140 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021C6140 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021C6144 */ _t199 = cpu->r[1] + 0x00000024u;
         /* 021C6144 */ rbrew_write32(cpu->mem, _t199, cpu->r[3]);
-        /* 021C6148 */ _t200 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6148 */ _t200 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6148 */ _t201 = _t200 & 0x00000001u;
         /* 021C6148 */ if (_t201) goto L_021C64AC; else goto L_021C614C;
   L_021C614C: ; // 0x21c614c
@@ -4056,10 +4056,10 @@ void Gambit_fn_021D7114(CPUState* cpu) {
         /* 021C6170 */ cpu->r[9] = cpu->r[1] + 0x00000024u;
         /* 021C6174 */ Gambit_fn_0204A864(cpu);
         /* 021C6178 */ cpu->r[9] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C6178 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021C6178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021C617C */ _t203 = cpu->r[1] + 0x00000024u;
         /* 021C617C */ rbrew_write32(cpu->mem, _t203, cpu->r[3]);
-        /* 021C6180 */ _t204 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6180 */ _t204 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6180 */ _t205 = _t204 & 0x00000001u;
         /* 021C6180 */ if (_t205) goto L_021C64AC; else goto L_021C6184;
   L_021C6184: ; // 0x21c6184
@@ -4068,25 +4068,25 @@ void Gambit_fn_021D7114(CPUState* cpu) {
         /* 021C6188 */ _t207 = cpu->r[31] + 0x0000015Cu;
         /* 021C6188 */ cpu->r[4] = rbrew_read32(cpu->mem, _t207);
         /* 021C618C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021C618C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021C618C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021C6190 */ _t208 = cpu->r[31] + 0x00000000u;
         /* 021C6190 */ cpu->r[7] = rbrew_read32(cpu->mem, _t208);
-        /* 021C6194 */ _t209 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6194 */ _t209 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6194 */ _t210 = _t209 & 0x00000001u;
         /* 021C6194 */ if (_t210) goto L_021C6224; else goto L_021C6198;
   L_021C6198: ; // 0x21c6198
         /* 021C6198 */ cpu->r[7] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021C6198 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021C619C */ _t211 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6198 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021C619C */ _t211 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C619C */ _t212 = _t211 & 0x00000001u;
         /* 021C619C */ if (_t212) goto L_021C61D8; else goto L_021C61A0;
   L_021C61A0: ; // 0x21c61a0
         /* 021C61A0 */ cpu->r[3] = cpu->r[31] + 0x00000138u;
         /* 021C61A4 */ Gambit_fn_02C69350(cpu);
-        /* 021C61A8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[29]);
+        /* 021C61A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[29]));
         /* 021C61AC */ _t213 = cpu->r[31] + 0x00000000u;
         /* 021C61AC */ cpu->r[6] = rbrew_read32(cpu->mem, _t213);
-        /* 021C61B0 */ _t214 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C61B0 */ _t214 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C61B0 */ _t215 = _t214 & 0x00000001u;
         /* 021C61B0 */ if (_t215) goto L_021C61B4; else goto L_021C61D0;
   L_021C61B4: ; // 0x21c61b4
@@ -4129,27 +4129,27 @@ void Gambit_fn_021D7114(CPUState* cpu) {
         /* 021C620C */ _t228 = cpu->r[1] + 0x0000003Cu;
         /* 021C620C */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t228);
         /* 021C6210 */ cpu->f[10] = fma(cpu->f[7], cpu->f[8], cpu->f[0]);
-        /* 021C6214 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[29]);
+        /* 021C6214 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[29]));
         /* 021C6218 */ _t229 = cpu->r[1] + 0x00000060u;
         /* 021C6218 */ rbrew_write32(cpu->mem, _t229, cpu->r[5]);
-        /* 021C621C */ _t230 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C621C */ _t230 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C621C */ _t231 = _t230 & 0x00000001u;
         /* 021C621C */ if (_t231) goto L_021C6310; else goto L_021C6220;
   L_021C6220: ; // 0x21c6220
         /* 021C6220 */ goto L_021C62AC;
   L_021C6224: ; // 0x21c6224
         /* 021C6224 */ cpu->r[6] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C6224 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 021C6228 */ _t232 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6224 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 021C6228 */ _t232 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6228 */ _t233 = _t232 & 0x00000001u;
         /* 021C6228 */ if (_t233) goto L_021C6264; else goto L_021C622C;
   L_021C622C: ; // 0x21c622c
         /* 021C622C */ cpu->r[3] = cpu->r[31] + 0x0000012Cu;
         /* 021C6230 */ Gambit_fn_02C69350(cpu);
-        /* 021C6234 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[29]);
+        /* 021C6234 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[29]));
         /* 021C6238 */ _t234 = cpu->r[31] + 0x00000000u;
         /* 021C6238 */ cpu->r[11] = rbrew_read32(cpu->mem, _t234);
-        /* 021C623C */ _t235 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C623C */ _t235 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C623C */ _t236 = _t235 & 0x00000001u;
         /* 021C623C */ if (_t236) goto L_021C6240; else goto L_021C625C;
   L_021C6240: ; // 0x21c6240
@@ -4192,10 +4192,10 @@ void Gambit_fn_021D7114(CPUState* cpu) {
         /* 021C6298 */ _t249 = cpu->r[1] + 0x0000003Cu;
         /* 021C6298 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t249);
         /* 021C629C */ cpu->f[10] = fma(cpu->f[7], cpu->f[8], cpu->f[0]);
-        /* 021C62A0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[29]);
+        /* 021C62A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[29]));
         /* 021C62A4 */ _t250 = cpu->r[1] + 0x00000060u;
         /* 021C62A4 */ rbrew_write32(cpu->mem, _t250, cpu->r[5]);
-        /* 021C62A8 */ _t251 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C62A8 */ _t251 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C62A8 */ _t252 = _t251 & 0x00000001u;
         /* 021C62A8 */ if (_t252) goto L_021C6310; else goto L_021C62AC;
   L_021C62AC: ; // 0x21c62ac
@@ -4239,10 +4239,10 @@ void Gambit_fn_021D7114(CPUState* cpu) {
         /* 021C62FC */ _t270 = cpu->r[28] + 0x000001D4u;
         /* 021C62FC */ rbrew_write_f32(cpu->mem, _t270, cpu->f[8]);
         /* 021C6300 */ cpu->r[24] = cpu->r[24] + 0xFFFFFFFFu;
-        /* 021C6300 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 021C6300 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 021C6304 */ _t271 = cpu->r[1] + 0x00000020u;
         /* 021C6304 */ rbrew_write_f32(cpu->mem, _t271, cpu->f[9]);
-        /* 021C6308 */ _t272 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6308 */ _t272 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6308 */ _t273 = _t272 & 0x00000001u;
         /* 021C6308 */ if (_t273) goto L_021C630C; else goto L_021C60F8;
   L_021C630C: ; // 0x21c630c
@@ -4253,27 +4253,27 @@ void Gambit_fn_021D7114(CPUState* cpu) {
         /* 021C6314 */ _t275 = cpu->r[29] + 0x0000015Cu;
         /* 021C6314 */ cpu->r[6] = rbrew_read32(cpu->mem, _t275);
         /* 021C6318 */ cpu->r[5] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021C6318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021C6318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021C631C */ _t276 = cpu->r[29] + 0x00000000u;
         /* 021C631C */ cpu->r[0] = rbrew_read32(cpu->mem, _t276);
-        /* 021C6320 */ _t277 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6320 */ _t277 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6320 */ _t278 = _t277 & 0x00000001u;
         /* 021C6320 */ if (_t278) goto L_021C63C4; else goto L_021C6324;
   L_021C6324: ; // 0x21c6324
         /* 021C6324 */ cpu->r[7] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021C6324 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021C6324 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021C6328 */ cpu->r[31] = cpu->r[29] + 0x000000A8u;
         /* 021C632C */ cpu->r[30] = cpu->r[29] + 0x000000C0u;
-        /* 021C6330 */ _t279 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6330 */ _t279 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6330 */ _t280 = _t279 & 0x00000001u;
         /* 021C6330 */ if (_t280) goto L_021C636C; else goto L_021C6334;
   L_021C6334: ; // 0x21c6334
         /* 021C6334 */ cpu->r[3] = cpu->r[29] + 0x00000138u;
         /* 021C6338 */ Gambit_fn_02C69350(cpu);
-        /* 021C633C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[29]);
+        /* 021C633C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[29]));
         /* 021C6340 */ _t281 = cpu->r[29] + 0x00000000u;
         /* 021C6340 */ cpu->r[9] = rbrew_read32(cpu->mem, _t281);
-        /* 021C6344 */ _t282 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C6344 */ _t282 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C6344 */ _t283 = _t282 & 0x00000001u;
         /* 021C6344 */ if (_t283) goto L_021C6348; else goto L_021C6364;
   L_021C6348: ; // 0x21c6348
@@ -4327,19 +4327,19 @@ void Gambit_fn_021D7114(CPUState* cpu) {
         /* 021C63C0 */ goto L_021C6460;
   L_021C63C4: ; // 0x21c63c4
         /* 021C63C4 */ cpu->r[11] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021C63C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021C63C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021C63C8 */ cpu->r[31] = cpu->r[29] + 0x00000048u;
         /* 021C63CC */ cpu->r[30] = cpu->r[29] + 0x00000060u;
-        /* 021C63D0 */ _t299 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C63D0 */ _t299 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C63D0 */ _t300 = _t299 & 0x00000001u;
         /* 021C63D0 */ if (_t300) goto L_021C640C; else goto L_021C63D4;
   L_021C63D4: ; // 0x21c63d4
         /* 021C63D4 */ cpu->r[3] = cpu->r[29] + 0x0000012Cu;
         /* 021C63D8 */ Gambit_fn_02C69350(cpu);
-        /* 021C63DC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[29]);
+        /* 021C63DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[29]));
         /* 021C63E0 */ _t301 = cpu->r[29] + 0x00000000u;
         /* 021C63E0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t301);
-        /* 021C63E4 */ _t302 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C63E4 */ _t302 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C63E4 */ _t303 = _t302 & 0x00000001u;
         /* 021C63E4 */ if (_t303) goto L_021C63E8; else goto L_021C6404;
   L_021C63E8: ; // 0x21c63e8
@@ -4421,10 +4421,10 @@ void Gambit_fn_021D7114(CPUState* cpu) {
         /* 021C649C */ _t331 = cpu->r[28] + 0x000001D4u;
         /* 021C649C */ rbrew_write_f32(cpu->mem, _t331, cpu->f[8]);
         /* 021C64A0 */ cpu->r[24] = cpu->r[24] + 0xFFFFFFFFu;
-        /* 021C64A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 021C64A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 021C64A4 */ _t332 = cpu->r[1] + 0x00000020u;
         /* 021C64A4 */ rbrew_write_f32(cpu->mem, _t332, cpu->f[9]);
-        /* 021C64A8 */ _t333 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C64A8 */ _t333 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C64A8 */ _t334 = _t333 & 0x00000001u;
         /* 021C64A8 */ if (_t334) goto L_021C64AC; else goto L_021C60F8;
   L_021C64AC: ; // 0x21c64ac
@@ -4458,7 +4458,7 @@ void Gambit_fn_021D7114(CPUState* cpu) {
         /* 021C64E8 */ cpu->f[26] = rbrew_read_f64(cpu->mem, _t346);
         /* 021C64EC */ _t347 = cpu->r[1] + 0x00000158u;
         /* 021C64EC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t347);
-        /* 021C64F0 */ _t348 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C64F0 */ _t348 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C64F0 */ _t349 = _t348 & 0x00000001u;
         /* 021C64F0 */ if (_t349) goto L_021C64F4; // else: addr-0 trap, fall-through
   L_021C64F4: ; // 0x21c64f4
@@ -4491,8 +4491,8 @@ void Gambit_fn_021D7124(CPUState* cpu) {
   L_027B8224: ; // 0x27b8224
         /* 027B8224 */ _t2 = cpu->r[3] + 0x00000000u;
         /* 027B8224 */ cpu->r[3] = rbrew_read32(cpu->mem, _t2);
-        /* 027B8228 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 027B822C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 027B8228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 027B822C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 027B822C */ _t4 = _t3 & 0x00000001u;
         /* 027B822C */ if (_t4) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 027B822C */ goto L_027B8230;
@@ -4515,9 +4515,9 @@ void Gambit_fn_021D7124(CPUState* cpu) {
         /* 027DA6B4 */ _t10 = cpu->r[29] + 0x00000014u;
         /* 027DA6B4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t10);
         /* 027DA6B8 */ cpu->r[31] = cpu->r[5];
-        /* 027DA6BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 027DA6BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 027DA6C0 */ cpu->r[30] = cpu->r[4];
-        /* 027DA6C4 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 027DA6C4 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 027DA6C4 */ _t12 = _t11 & 0x00000001u;
         /* 027DA6C4 */ if (_t12) goto L_027DA6D4; else goto L_027DA6C8;
   L_027DA6C8: ; // 0x27da6c8
@@ -4527,8 +4527,8 @@ void Gambit_fn_021D7124(CPUState* cpu) {
   L_027DA6D4: ; // 0x27da6d4
         /* 027DA6D4 */ _t13 = cpu->r[29] + 0x00000018u;
         /* 027DA6D4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t13);
-        /* 027DA6D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 027DA6DC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 027DA6D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 027DA6DC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 027DA6DC */ _t15 = _t14 & 0x00000001u;
         /* 027DA6DC */ if (_t15) goto L_027DA6EC; else goto L_027DA6E0;
   L_027DA6E0: ; // 0x27da6e0
@@ -4564,8 +4564,8 @@ void Gambit_fn_021D7138(CPUState* cpu) {
   L_027B8224: ; // 0x27b8224
         /* 027B8224 */ _t2 = cpu->r[3] + 0x00000000u;
         /* 027B8224 */ cpu->r[3] = rbrew_read32(cpu->mem, _t2);
-        /* 027B8228 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 027B822C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 027B8228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 027B822C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 027B822C */ _t4 = _t3 & 0x00000001u;
         /* 027B822C */ if (_t4) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 027B822C */ goto L_027B8230;
@@ -4588,9 +4588,9 @@ void Gambit_fn_021D7138(CPUState* cpu) {
         /* 027DA6B4 */ _t10 = cpu->r[29] + 0x00000014u;
         /* 027DA6B4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t10);
         /* 027DA6B8 */ cpu->r[31] = cpu->r[5];
-        /* 027DA6BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 027DA6BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 027DA6C0 */ cpu->r[30] = cpu->r[4];
-        /* 027DA6C4 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 027DA6C4 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 027DA6C4 */ _t12 = _t11 & 0x00000001u;
         /* 027DA6C4 */ if (_t12) goto L_027DA6D4; else goto L_027DA6C8;
   L_027DA6C8: ; // 0x27da6c8
@@ -4600,8 +4600,8 @@ void Gambit_fn_021D7138(CPUState* cpu) {
   L_027DA6D4: ; // 0x27da6d4
         /* 027DA6D4 */ _t13 = cpu->r[29] + 0x00000018u;
         /* 027DA6D4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t13);
-        /* 027DA6D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 027DA6DC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 027DA6D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 027DA6DC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 027DA6DC */ _t15 = _t14 & 0x00000001u;
         /* 027DA6DC */ if (_t15) goto L_027DA6EC; else goto L_027DA6E0;
   L_027DA6E0: ; // 0x27da6e0
@@ -4640,8 +4640,8 @@ void Gambit_fn_021D715C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3;
 
   L_021D715C: ; // 0x21d715c
-        /* 021D715C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 021D7160 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D715C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 021D7160 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D7160 */ _t1 = _t0 & 0x00000001u;
         /* 021D7160 */ if (_t1) goto L_021D7170; else goto L_021D7164;
   L_021D7164: ; // 0x21d7164
@@ -4701,7 +4701,7 @@ void Gambit_fn_021D7178(CPUState* cpu) {
         /* 021BFDD8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t11);
         /* 021BFDDC */ _t12 = cpu->r[1] + 0x00000010u;
         /* 021BFDDC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t12);
-        /* 021BFDE0 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021BFDE0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021BFDE0 */ _t14 = _t13 & 0x00000001u;
         /* 021BFDE0 */ if (_t14) goto L_021BFDE4; // else: addr-0 trap, fall-through
   L_021BFDE4: ; // 0x21bfde4
@@ -4737,15 +4737,15 @@ void Gambit_fn_021D71A0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021D71A0: ; // 0x21d71a0
-        /* 021D71A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D71A4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D71A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D71A4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D71A4 */ _t1 = _t0 & 0x00000001u;
         /* 021D71A4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021D71A4 */ goto L_021D71A8;
   L_021D71A8: ; // 0x21d71a8
         /* 021D71A8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021D71A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D71AC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D71A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D71AC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D71AC */ _t3 = _t2 & 0x00000001u;
         /* 021D71AC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021D71AC */ goto L_021D71B0;
@@ -4764,8 +4764,8 @@ void Gambit_fn_021D71A0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4779,15 +4779,15 @@ void Gambit_fn_021D71A0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4824,11 +4824,11 @@ void Gambit_fn_021D71B8(CPUState* cpu) {
         /* 021D71B8 */ cpu->r[0] = cpu->lr;
         /* 021D71BC */ _t0 = cpu->r[1] + 0x00000004u;
         /* 021D71BC */ rbrew_write32(cpu->mem, _t0, cpu->r[0]);
-        /* 021D71C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021D71C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021D71C4 */ _t1 = cpu->r[1] + 0xFFFFFFF8u;
         /* 021D71C4 */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 021D71C4 */ cpu->r[1] = _t1;
-        /* 021D71C8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D71C8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D71C8 */ _t3 = _t2 & 0x00000001u;
         /* 021D71C8 */ if (_t3) goto L_021D71CC; else goto L_021D71D4;
   L_021D71CC: ; // 0x21d71cc
@@ -4850,7 +4850,7 @@ void Gambit_fn_021D71C4(CPUState* cpu) {
         /* 021D71C4 */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 021D71C4 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 021D71C4 */ cpu->r[1] = _t0;
-        /* 021D71C8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D71C8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D71C8 */ _t2 = _t1 & 0x00000001u;
         /* 021D71C8 */ if (_t2) goto L_021D71CC; else goto L_021D71D4;
   L_021D71CC: ; // 0x21d71cc
@@ -4973,8 +4973,8 @@ void Gambit_fn_021D7274(CPUState* cpu) {
         /* 021D7274 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D7274 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D7278 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021D7278 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D727C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D7278 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D727C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D727C */ _t2 = _t1 & 0x00000001u;
         /* 021D727C */ _t3 = _t2 ^ 0x00000001u;
         /* 021D727C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -4996,8 +4996,8 @@ void Gambit_fn_021D7290(CPUState* cpu) {
         /* 021D7290 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D7290 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D7294 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021D7294 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D7298 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D7294 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D7298 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D7298 */ _t2 = _t1 & 0x00000001u;
         /* 021D7298 */ _t3 = _t2 ^ 0x00000001u;
         /* 021D7298 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -5019,8 +5019,8 @@ void Gambit_fn_021D72AC(CPUState* cpu) {
         /* 021D72AC */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D72AC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D72B0 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021D72B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D72B4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D72B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D72B4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D72B4 */ _t2 = _t1 & 0x00000001u;
         /* 021D72B4 */ _t3 = _t2 ^ 0x00000001u;
         /* 021D72B4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -5063,8 +5063,8 @@ void Gambit_fn_021D72D8(CPUState* cpu) {
         /* 021D72E8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D72EC */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D72EC */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021D72F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021D72F4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D72F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021D72F4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D72F4 */ _t5 = _t4 & 0x00000001u;
         /* 021D72F4 */ if (_t5) goto L_021D72F8; else goto L_021D7314;
   L_021D72F8: ; // 0x21d72f8
@@ -5103,8 +5103,8 @@ void Gambit_fn_021D72DC(CPUState* cpu) {
         /* 021D72E8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D72EC */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D72EC */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021D72F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021D72F4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D72F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021D72F4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D72F4 */ _t5 = _t4 & 0x00000001u;
         /* 021D72F4 */ if (_t5) goto L_021D72F8; else goto L_021D7314;
   L_021D72F8: ; // 0x21d72f8
@@ -5378,21 +5378,21 @@ void Gambit_fn_021D73F8(CPUState* cpu) {
         /* 021D74BC */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t40);
         /* 021D74C0 */ cpu->f[6] = -fma(cpu->f[11], cpu->f[13], -(cpu->f[5]));
         /* 021D74C4 */ cpu->f[7] = -fma(cpu->f[11], cpu->f[0], -(cpu->f[5]));
-        /* 021D74C8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[5], cpu->f[6]);
+        /* 021D74C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[5], cpu->f[6]));
         /* 021D74CC */ cpu->f[8] = -fma(cpu->f[11], cpu->f[8], -(cpu->f[5]));
         /* 021D74D0 */ _t41 = cpu->r[1] + 0x00000028u;
         /* 021D74D0 */ rbrew_write_f32(cpu->mem, _t41, cpu->f[10]);
-        /* 021D74D4 */ _t42 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D74D4 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D74D4 */ _t43 = _t42 & 0x00000001u;
         /* 021D74D4 */ if (_t43) goto L_021D74D8; else goto L_021D7508;
   L_021D74D8: ; // 0x21d74d8
-        /* 021D74D8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[5], cpu->f[7]);
-        /* 021D74DC */ _t44 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D74D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[5], cpu->f[7]));
+        /* 021D74DC */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D74DC */ _t45 = _t44 & 0x00000001u;
         /* 021D74DC */ if (_t45) goto L_021D74E0; else goto L_021D7538;
   L_021D74E0: ; // 0x21d74e0
-        /* 021D74E0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[5], cpu->f[8]);
-        /* 021D74E4 */ _t46 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D74E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[5], cpu->f[8]));
+        /* 021D74E4 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D74E4 */ _t47 = _t46 & 0x00000001u;
         /* 021D74E4 */ if (_t47) goto L_021D74E8; else goto L_021D7564;
   L_021D74E8: ; // 0x21d74e8
@@ -5400,23 +5400,23 @@ void Gambit_fn_021D73F8(CPUState* cpu) {
         /* 021D74EC */ _t48 = cpu->r[12] + 0xFFFFFD54u;
         /* 021D74EC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t48);
         /* 021D74F0 */ cpu->r[11] = 0x10030000u;
-        /* 021D74F4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[5], cpu->f[0]);
+        /* 021D74F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[5], cpu->f[0]));
         /* 021D74F8 */ _t49 = cpu->r[11] + 0xFFFFFD5Cu;
         /* 021D74F8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t49);
         /* 021D74FC */ cpu->r[0] = 0x00000000u;
-        /* 021D7500 */ _t50 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D7500 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D7500 */ _t51 = _t50 & 0x00000001u;
         /* 021D7500 */ if (_t51) goto L_021D758C; else goto L_021D7504;
   L_021D7504: ; // 0x21d7504
         /* 021D7504 */ goto L_021D75A0;
   L_021D7508: ; // 0x21d7508
-        /* 021D7508 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[7]);
-        /* 021D750C */ _t52 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D7508 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[7]));
+        /* 021D750C */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D750C */ _t53 = _t52 & 0x00000001u;
         /* 021D750C */ if (_t53) goto L_021D7510; else goto L_021D7538;
   L_021D7510: ; // 0x21d7510
-        /* 021D7510 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[8]);
-        /* 021D7514 */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D7510 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[8]));
+        /* 021D7514 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D7514 */ _t55 = _t54 & 0x00000001u;
         /* 021D7514 */ if (_t55) goto L_021D7518; else goto L_021D7564;
   L_021D7518: ; // 0x21d7518
@@ -5424,18 +5424,18 @@ void Gambit_fn_021D73F8(CPUState* cpu) {
         /* 021D751C */ _t56 = cpu->r[12] + 0xFFFFFD54u;
         /* 021D751C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t56);
         /* 021D7520 */ cpu->r[11] = 0x10030000u;
-        /* 021D7524 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[0]);
+        /* 021D7524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[0]));
         /* 021D7528 */ _t57 = cpu->r[11] + 0xFFFFFD5Cu;
         /* 021D7528 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t57);
         /* 021D752C */ cpu->r[0] = 0x00000001u;
-        /* 021D7530 */ _t58 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D7530 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D7530 */ _t59 = _t58 & 0x00000001u;
         /* 021D7530 */ if (_t59) goto L_021D75F0; else goto L_021D7534;
   L_021D7534: ; // 0x21d7534
         /* 021D7534 */ goto L_021D7604;
   L_021D7538: ; // 0x21d7538
-        /* 021D7538 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[8]);
-        /* 021D753C */ _t60 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D7538 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[8]));
+        /* 021D753C */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D753C */ _t61 = _t60 & 0x00000001u;
         /* 021D753C */ if (_t61) goto L_021D7540; else goto L_021D7564;
   L_021D7540: ; // 0x21d7540
@@ -5444,14 +5444,14 @@ void Gambit_fn_021D73F8(CPUState* cpu) {
         /* 021D7548 */ cpu->r[11] = 0x10030000u;
         /* 021D754C */ _t62 = cpu->r[12] + 0xFFFFFD54u;
         /* 021D754C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t62);
-        /* 021D7550 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 021D7550 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 021D7554 */ _t63 = cpu->r[11] + 0xFFFFFD5Cu;
         /* 021D7554 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t63);
-        /* 021D7558 */ _t64 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D7558 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D7558 */ _t65 = _t64 & 0x00000001u;
         /* 021D7558 */ if (_t65) goto L_021D7654; else goto L_021D755C;
   L_021D755C: ; // 0x21d755c
-        /* 021D755C */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D755C */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D755C */ _t67 = _t66 & 0x00000001u;
         /* 021D755C */ if (_t67) goto L_021D76C0; else goto L_021D7560;
   L_021D7560: ; // 0x21d7560
@@ -5462,19 +5462,19 @@ void Gambit_fn_021D73F8(CPUState* cpu) {
         /* 021D756C */ cpu->r[11] = 0x10030000u;
         /* 021D7570 */ _t68 = cpu->r[12] + 0xFFFFFD54u;
         /* 021D7570 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t68);
-        /* 021D7574 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 021D7574 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 021D7578 */ _t69 = cpu->r[11] + 0xFFFFFD5Cu;
         /* 021D7578 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t69);
-        /* 021D757C */ _t70 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D757C */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D757C */ _t71 = _t70 & 0x00000001u;
         /* 021D757C */ if (_t71) goto L_021D7654; else goto L_021D7580;
   L_021D7580: ; // 0x21d7580
-        /* 021D7580 */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D7580 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D7580 */ _t73 = _t72 & 0x00000001u;
         /* 021D7580 */ if (_t73) goto L_021D76C0; else goto L_021D7584;
   L_021D7584: ; // 0x21d7584
-        /* 021D7584 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[5], cpu->f[0]);
-        /* 021D7588 */ _t74 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D7584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[5], cpu->f[0]));
+        /* 021D7588 */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D7588 */ _t75 = _t74 & 0x00000001u;
         /* 021D7588 */ if (_t75) goto L_021D758C; else goto L_021D75A0;
   L_021D758C: ; // 0x21d758c
@@ -5556,8 +5556,8 @@ void Gambit_fn_021D73F8(CPUState* cpu) {
         /* 021D764C */ cpu->r[1] = cpu->r[1] + 0x00000038u;
         /* 021D7650 */ return;
   L_021D7654: ; // 0x21d7654
-        /* 021D7654 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[0]);
-        /* 021D7658 */ _t100 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D7654 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[0]));
+        /* 021D7658 */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D7658 */ _t101 = _t100 & 0x00000001u;
         /* 021D7658 */ if (_t101) goto L_021D765C; else goto L_021D7670;
   L_021D765C: ; // 0x21d765c
@@ -5600,8 +5600,8 @@ void Gambit_fn_021D73F8(CPUState* cpu) {
         /* 021D76B8 */ cpu->r[1] = cpu->r[1] + 0x00000038u;
         /* 021D76BC */ return;
   L_021D76C0: ; // 0x21d76c0
-        /* 021D76C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
-        /* 021D76C4 */ _t114 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D76C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
+        /* 021D76C4 */ _t114 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D76C4 */ _t115 = _t114 & 0x00000001u;
         /* 021D76C4 */ if (_t115) goto L_021D76C8; else goto L_021D76DC;
   L_021D76C8: ; // 0x21d76c8
@@ -5873,14 +5873,14 @@ void Gambit_fn_021D780C(CPUState* cpu) {
         /* 021D7820 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 021D7824 */ _t4 = cpu->r[30] + 0x0000001Cu;
         /* 021D7824 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
-        /* 021D7828 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
+        /* 021D7828 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
         /* 021D782C */ cpu->r[31] = cpu->r[4];
-        /* 021D7830 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D7830 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D7830 */ _t6 = _t5 & 0x00000001u;
         /* 021D7830 */ if (_t6) goto L_021D783C; else goto L_021D7834;
   L_021D7834: ; // 0x21d7834
-        /* 021D7834 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021D7838 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D7834 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021D7838 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D7838 */ _t8 = _t7 & 0x00000001u;
         /* 021D7838 */ if (_t8) goto L_021D783C; else goto L_021D7870;
   L_021D783C: ; // 0x21d783c
@@ -5891,8 +5891,8 @@ void Gambit_fn_021D780C(CPUState* cpu) {
         /* 021D7844 */ cpu->ctr = cpu->r[0];
         /* 021D7848 */ cpu->r[3] = cpu->r[30];
         /* 021D784C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D7850 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D7854 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D7850 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D7854 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D7854 */ _t12 = _t11 & 0x00000001u;
         /* 021D7854 */ if (_t12) goto L_021D7858; else goto L_021D7870;
   L_021D7858: ; // 0x21d7858
@@ -5933,14 +5933,14 @@ void Gambit_fn_021D7810(CPUState* cpu) {
         /* 021D7820 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 021D7824 */ _t4 = cpu->r[30] + 0x0000001Cu;
         /* 021D7824 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
-        /* 021D7828 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
+        /* 021D7828 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
         /* 021D782C */ cpu->r[31] = cpu->r[4];
-        /* 021D7830 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D7830 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D7830 */ _t6 = _t5 & 0x00000001u;
         /* 021D7830 */ if (_t6) goto L_021D783C; else goto L_021D7834;
   L_021D7834: ; // 0x21d7834
-        /* 021D7834 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021D7838 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D7834 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021D7838 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D7838 */ _t8 = _t7 & 0x00000001u;
         /* 021D7838 */ if (_t8) goto L_021D783C; else goto L_021D7870;
   L_021D783C: ; // 0x21d783c
@@ -5951,8 +5951,8 @@ void Gambit_fn_021D7810(CPUState* cpu) {
         /* 021D7844 */ cpu->ctr = cpu->r[0];
         /* 021D7848 */ cpu->r[3] = cpu->r[30];
         /* 021D784C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D7850 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D7854 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D7850 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D7854 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D7854 */ _t12 = _t11 & 0x00000001u;
         /* 021D7854 */ if (_t12) goto L_021D7858; else goto L_021D7870;
   L_021D7858: ; // 0x21d7858
@@ -6029,13 +6029,13 @@ void Gambit_fn_021D78AC(CPUState* cpu) {
         /* 021D78BC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D78C0 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D78C0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021D78C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021D78C8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D78C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021D78C8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D78C8 */ _t5 = _t4 & 0x00000001u;
         /* 021D78C8 */ if (_t5) goto L_021D78D4; else goto L_021D78CC;
   L_021D78CC: ; // 0x21d78cc
-        /* 021D78CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021D78D0 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D78CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021D78D0 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D78D0 */ _t7 = _t6 & 0x00000001u;
         /* 021D78D0 */ if (_t7) goto L_021D78D4; else goto L_021D790C;
   L_021D78D4: ; // 0x21d78d4
@@ -6046,8 +6046,8 @@ void Gambit_fn_021D78AC(CPUState* cpu) {
         /* 021D78DC */ cpu->ctr = cpu->r[0];
         /* 021D78E0 */ cpu->r[3] = cpu->r[31];
         /* 021D78E4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D78E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D78EC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D78E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D78EC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D78EC */ _t11 = _t10 & 0x00000001u;
         /* 021D78EC */ if (_t11) goto L_021D78F0; else goto L_021D790C;
   L_021D78F0: ; // 0x21d78f0
@@ -6085,13 +6085,13 @@ void Gambit_fn_021D78B0(CPUState* cpu) {
         /* 021D78BC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D78C0 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D78C0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021D78C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021D78C8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D78C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021D78C8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D78C8 */ _t5 = _t4 & 0x00000001u;
         /* 021D78C8 */ if (_t5) goto L_021D78D4; else goto L_021D78CC;
   L_021D78CC: ; // 0x21d78cc
-        /* 021D78CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021D78D0 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D78CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021D78D0 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D78D0 */ _t7 = _t6 & 0x00000001u;
         /* 021D78D0 */ if (_t7) goto L_021D78D4; else goto L_021D790C;
   L_021D78D4: ; // 0x21d78d4
@@ -6102,8 +6102,8 @@ void Gambit_fn_021D78B0(CPUState* cpu) {
         /* 021D78DC */ cpu->ctr = cpu->r[0];
         /* 021D78E0 */ cpu->r[3] = cpu->r[31];
         /* 021D78E4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D78E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D78EC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D78E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D78EC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D78EC */ _t11 = _t10 & 0x00000001u;
         /* 021D78EC */ if (_t11) goto L_021D78F0; else goto L_021D790C;
   L_021D78F0: ; // 0x21d78f0
@@ -6142,10 +6142,10 @@ void Gambit_fn_021D792C(CPUState* cpu) {
         /* 021D792C */ cpu->r[10] = 0x101D0000u;
         /* 021D7930 */ _t0 = cpu->r[10] + 0xFFFFFB68u;
         /* 021D7930 */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 021D7934 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021D7934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021D7938 */ cpu->r[10] = 0x101D0000u;
         /* 021D793C */ cpu->r[10] = cpu->r[10] + 0xFFFFFBF0u;
-        /* 021D7940 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D7940 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D7940 */ _t2 = _t1 & 0x00000001u;
         /* 021D7940 */ if (_t2) goto L_021D7944; else goto L_021D795C;
   L_021D7944: ; // 0x21d7944
@@ -6158,8 +6158,8 @@ void Gambit_fn_021D792C(CPUState* cpu) {
         /* 021D7958 */ _t4 = cpu->r[10] + 0x00000000u;
         /* 021D7958 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_021D795C: ; // 0x21d795c
-        /* 021D795C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021D7960 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D795C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021D7960 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D7960 */ _t6 = _t5 & 0x00000001u;
         /* 021D7960 */ if (_t6) goto L_021D7964; else goto L_021D796C;
   L_021D7964: ; // 0x21d7964
@@ -6170,9 +6170,9 @@ void Gambit_fn_021D792C(CPUState* cpu) {
         /* 021D7970 */ _t7 = cpu->r[9] + 0xFFFFE5E4u;
         /* 021D7970 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 021D7974 */ cpu->r[11] = 0x101D0000u;
-        /* 021D7978 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021D7978 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021D797C */ cpu->r[11] = cpu->r[11] + 0xFFFFFB60u;
-        /* 021D7980 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D7980 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D7980 */ _t9 = _t8 & 0x00000001u;
         /* 021D7980 */ if (_t9) goto L_021D7984; else goto L_021D799C;
   L_021D7984: ; // 0x21d7984
@@ -6185,8 +6185,8 @@ void Gambit_fn_021D792C(CPUState* cpu) {
         /* 021D7998 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021D7998 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021D799C: ; // 0x21d799c
-        /* 021D799C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021D79A0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D799C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021D79A0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D79A0 */ _t13 = _t12 & 0x00000001u;
         /* 021D79A0 */ if (_t13) goto L_021D79A4; else goto L_021D79AC;
   L_021D79A4: ; // 0x21d79a4
@@ -6197,9 +6197,9 @@ void Gambit_fn_021D792C(CPUState* cpu) {
         /* 021D79B0 */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021D79B0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 021D79B4 */ cpu->r[9] = 0x101D0000u;
-        /* 021D79B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D79B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D79BC */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 021D79C0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D79C0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D79C0 */ _t16 = _t15 & 0x00000001u;
         /* 021D79C0 */ if (_t16) goto L_021D79C4; else goto L_021D79DC;
   L_021D79C4: ; // 0x21d79c4
@@ -6212,8 +6212,8 @@ void Gambit_fn_021D792C(CPUState* cpu) {
         /* 021D79D8 */ _t18 = cpu->r[9] + 0x00000000u;
         /* 021D79D8 */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_021D79DC: ; // 0x21d79dc
-        /* 021D79DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 021D79E0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D79DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 021D79E0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D79E0 */ _t20 = _t19 & 0x00000001u;
         /* 021D79E0 */ if (_t20) goto L_021D79E4; else goto L_021D79EC;
   L_021D79E4: ; // 0x21d79e4
@@ -6225,9 +6225,9 @@ void Gambit_fn_021D792C(CPUState* cpu) {
         /* 021D79F0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 021D79F0 */ cpu->r[9] = _t21;
         /* 021D79F4 */ cpu->r[10] = 0x101D0000u;
-        /* 021D79F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021D79F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021D79FC */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021D7A00 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D7A00 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D7A00 */ _t23 = _t22 & 0x00000001u;
         /* 021D7A00 */ if (_t23) goto L_021D7A04; else goto L_021D7A18;
   L_021D7A04: ; // 0x21d7a04
@@ -6239,8 +6239,8 @@ void Gambit_fn_021D792C(CPUState* cpu) {
         /* 021D7A14 */ _t25 = cpu->r[10] + 0x00000000u;
         /* 021D7A14 */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_021D7A18: ; // 0x21d7a18
-        /* 021D7A18 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021D7A1C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D7A18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021D7A1C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D7A1C */ _t27 = _t26 & 0x00000001u;
         /* 021D7A1C */ if (_t27) goto L_021D7A20; else goto L_021D7A28;
   L_021D7A20: ; // 0x21d7a20
@@ -6252,9 +6252,9 @@ void Gambit_fn_021D792C(CPUState* cpu) {
         /* 021D7A2C */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 021D7A2C */ cpu->r[10] = _t28;
         /* 021D7A30 */ cpu->r[11] = 0x101D0000u;
-        /* 021D7A34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021D7A34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021D7A38 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021D7A3C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D7A3C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D7A3C */ _t30 = _t29 & 0x00000001u;
         /* 021D7A3C */ if (_t30) goto L_021D7A40; else goto L_021D7A54;
   L_021D7A40: ; // 0x21d7a40
@@ -6941,18 +6941,18 @@ void Gambit_fn_021D7D3C(CPUState* cpu) {
         /* 021D7D40 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021D7D40 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021D7D44 */ cpu->r[31] = cpu->r[3];
-        /* 021D7D44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021D7D44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021D7D48 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021D7D48 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021D7D4C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D7D4C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D7D4C */ _t4 = _t3 & 0x00000001u;
         /* 021D7D4C */ if (_t4) goto L_021D7D50; else goto L_021D7D60;
   L_021D7D50: ; // 0x21d7d50
         /* 021D7D50 */ cpu->r[3] = 0x00000240u;
         /* 021D7D54 */ Gambit_fn_02801A78(cpu);
         /* 021D7D58 */ cpu->r[31] = cpu->r[3];
-        /* 021D7D58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021D7D5C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D7D58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021D7D5C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D7D5C */ _t6 = _t5 & 0x00000001u;
         /* 021D7D5C */ if (_t6) goto L_021D7D74; else goto L_021D7D60;
   L_021D7D60: ; // 0x21d7d60
@@ -6991,9 +6991,9 @@ void Gambit_fn_021D7D8C(CPUState* cpu) {
         /* 021C0870 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 021C0874 */ _t4 = cpu->r[31] + 0x00000000u;
         /* 021C0874 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
-        /* 021C0878 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
+        /* 021C0878 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
         /* 021C087C */ cpu->r[30] = cpu->r[3];
-        /* 021C0880 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0880 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C0880 */ _t6 = _t5 & 0x00000001u;
         /* 021C0880 */ if (_t6) goto L_021C0884; else goto L_021C08AC;
   L_021C0884: ; // 0x21c0884
@@ -7004,8 +7004,8 @@ void Gambit_fn_021D7D8C(CPUState* cpu) {
         /* 021C088C */ cpu->ctr = cpu->r[0];
         /* 021C0890 */ cpu->r[3] = cpu->r[30];
         /* 021C0894 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021C0898 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C089C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C0898 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C089C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C089C */ _t10 = _t9 & 0x00000001u;
         /* 021C089C */ if (_t10) goto L_021C08AC; else goto L_021C08A0;
   L_021C08A0: ; // 0x21c08a0
@@ -7177,8 +7177,8 @@ void Gambit_fn_021D7E14(CPUState* cpu) {
         /* 021D7E14 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D7E14 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D7E18 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021D7E18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D7E1C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D7E18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D7E1C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D7E1C */ _t2 = _t1 & 0x00000001u;
         /* 021D7E1C */ _t3 = _t2 ^ 0x00000001u;
         /* 021D7E1C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -7200,8 +7200,8 @@ void Gambit_fn_021D7E30(CPUState* cpu) {
         /* 021D7E30 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D7E30 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D7E34 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021D7E34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D7E38 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D7E34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D7E38 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D7E38 */ _t2 = _t1 & 0x00000001u;
         /* 021D7E38 */ _t3 = _t2 ^ 0x00000001u;
         /* 021D7E38 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -7223,8 +7223,8 @@ void Gambit_fn_021D7E4C(CPUState* cpu) {
         /* 021D7E4C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D7E4C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D7E50 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021D7E50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D7E54 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D7E50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D7E54 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D7E54 */ _t2 = _t1 & 0x00000001u;
         /* 021D7E54 */ _t3 = _t2 ^ 0x00000001u;
         /* 021D7E54 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -7267,8 +7267,8 @@ void Gambit_fn_021D7E78(CPUState* cpu) {
         /* 021D7E88 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D7E8C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D7E8C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021D7E90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021D7E94 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D7E90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021D7E94 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D7E94 */ _t5 = _t4 & 0x00000001u;
         /* 021D7E94 */ if (_t5) goto L_021D7E98; else goto L_021D7EB4;
   L_021D7E98: ; // 0x21d7e98
@@ -7307,8 +7307,8 @@ void Gambit_fn_021D7E7C(CPUState* cpu) {
         /* 021D7E88 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D7E8C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D7E8C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021D7E90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021D7E94 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D7E90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021D7E94 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D7E94 */ _t5 = _t4 & 0x00000001u;
         /* 021D7E94 */ if (_t5) goto L_021D7E98; else goto L_021D7EB4;
   L_021D7E98: ; // 0x21d7e98
@@ -7708,13 +7708,13 @@ void Gambit_fn_021D803C(CPUState* cpu) {
         /* 021D804C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D8050 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D8050 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021D8054 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021D8058 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021D8058 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8058 */ _t5 = _t4 & 0x00000001u;
         /* 021D8058 */ if (_t5) goto L_021D8064; else goto L_021D805C;
   L_021D805C: ; // 0x21d805c
-        /* 021D805C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021D8060 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D805C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021D8060 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8060 */ _t7 = _t6 & 0x00000001u;
         /* 021D8060 */ if (_t7) goto L_021D8064; else goto L_021D809C;
   L_021D8064: ; // 0x21d8064
@@ -7725,8 +7725,8 @@ void Gambit_fn_021D803C(CPUState* cpu) {
         /* 021D806C */ cpu->ctr = cpu->r[0];
         /* 021D8070 */ cpu->r[3] = cpu->r[31];
         /* 021D8074 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D8078 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D807C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8078 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D807C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D807C */ _t11 = _t10 & 0x00000001u;
         /* 021D807C */ if (_t11) goto L_021D8080; else goto L_021D809C;
   L_021D8080: ; // 0x21d8080
@@ -7764,13 +7764,13 @@ void Gambit_fn_021D8040(CPUState* cpu) {
         /* 021D804C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D8050 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D8050 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021D8054 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021D8058 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021D8058 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8058 */ _t5 = _t4 & 0x00000001u;
         /* 021D8058 */ if (_t5) goto L_021D8064; else goto L_021D805C;
   L_021D805C: ; // 0x21d805c
-        /* 021D805C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021D8060 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D805C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021D8060 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8060 */ _t7 = _t6 & 0x00000001u;
         /* 021D8060 */ if (_t7) goto L_021D8064; else goto L_021D809C;
   L_021D8064: ; // 0x21d8064
@@ -7781,8 +7781,8 @@ void Gambit_fn_021D8040(CPUState* cpu) {
         /* 021D806C */ cpu->ctr = cpu->r[0];
         /* 021D8070 */ cpu->r[3] = cpu->r[31];
         /* 021D8074 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D8078 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D807C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8078 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D807C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D807C */ _t11 = _t10 & 0x00000001u;
         /* 021D807C */ if (_t11) goto L_021D8080; else goto L_021D809C;
   L_021D8080: ; // 0x21d8080
@@ -7829,9 +7829,9 @@ void Gambit_fn_021D80C4(CPUState* cpu) {
         /* 021D80C8 */ _t0 = cpu->r[8] + 0xFFFFFBF4u;
         /* 021D80C8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 021D80CC */ cpu->r[6] = 0x101D0000u;
-        /* 021D80D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021D80D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021D80D4 */ cpu->r[6] = cpu->r[6] + 0xFFFFFBF8u;
-        /* 021D80D8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D80D8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D80D8 */ _t2 = _t1 & 0x00000001u;
         /* 021D80D8 */ if (_t2) goto L_021D80DC; else goto L_021D80F4;
   L_021D80DC: ; // 0x21d80dc
@@ -7844,8 +7844,8 @@ void Gambit_fn_021D80C4(CPUState* cpu) {
         /* 021D80F0 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 021D80F0 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_021D80F4: ; // 0x21d80f4
-        /* 021D80F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 021D80F8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D80F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 021D80F8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D80F8 */ _t6 = _t5 & 0x00000001u;
         /* 021D80F8 */ if (_t6) goto L_021D80FC; else goto L_021D8104;
   L_021D80FC: ; // 0x21d80fc
@@ -7856,9 +7856,9 @@ void Gambit_fn_021D80C4(CPUState* cpu) {
         /* 021D8108 */ _t7 = cpu->r[10] + 0xFFFFFB64u;
         /* 021D8108 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 021D810C */ cpu->r[8] = 0x101D0000u;
-        /* 021D8110 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021D8110 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021D8114 */ cpu->r[8] = cpu->r[8] + 0xFFFFFBE0u;
-        /* 021D8118 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8118 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8118 */ _t9 = _t8 & 0x00000001u;
         /* 021D8118 */ if (_t9) goto L_021D811C; else goto L_021D8134;
   L_021D811C: ; // 0x21d811c
@@ -7871,8 +7871,8 @@ void Gambit_fn_021D80C4(CPUState* cpu) {
         /* 021D8130 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 021D8130 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_021D8134: ; // 0x21d8134
-        /* 021D8134 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021D8138 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8134 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021D8138 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8138 */ _t13 = _t12 & 0x00000001u;
         /* 021D8138 */ if (_t13) goto L_021D813C; else goto L_021D8144;
   L_021D813C: ; // 0x21d813c
@@ -7883,9 +7883,9 @@ void Gambit_fn_021D80C4(CPUState* cpu) {
         /* 021D8148 */ _t14 = cpu->r[12] + 0xFFFFE5E4u;
         /* 021D8148 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 021D814C */ cpu->r[10] = 0x101D0000u;
-        /* 021D8150 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021D8150 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021D8154 */ cpu->r[10] = cpu->r[10] + 0xFFFFFB60u;
-        /* 021D8158 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8158 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8158 */ _t16 = _t15 & 0x00000001u;
         /* 021D8158 */ if (_t16) goto L_021D815C; else goto L_021D8174;
   L_021D815C: ; // 0x21d815c
@@ -7898,8 +7898,8 @@ void Gambit_fn_021D80C4(CPUState* cpu) {
         /* 021D8170 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 021D8170 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_021D8174: ; // 0x21d8174
-        /* 021D8174 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021D8178 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8174 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021D8178 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8178 */ _t20 = _t19 & 0x00000001u;
         /* 021D8178 */ if (_t20) goto L_021D817C; else goto L_021D8184;
   L_021D817C: ; // 0x21d817c
@@ -7910,9 +7910,9 @@ void Gambit_fn_021D80C4(CPUState* cpu) {
         /* 021D8188 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021D8188 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021D818C */ cpu->r[12] = 0x101D0000u;
-        /* 021D8190 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D8190 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D8194 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021D8198 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8198 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8198 */ _t23 = _t22 & 0x00000001u;
         /* 021D8198 */ if (_t23) goto L_021D819C; else goto L_021D81B4;
   L_021D819C: ; // 0x21d819c
@@ -7925,8 +7925,8 @@ void Gambit_fn_021D80C4(CPUState* cpu) {
         /* 021D81B0 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 021D81B0 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_021D81B4: ; // 0x21d81b4
-        /* 021D81B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021D81B8 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D81B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021D81B8 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D81B8 */ _t27 = _t26 & 0x00000001u;
         /* 021D81B8 */ if (_t27) goto L_021D81BC; else goto L_021D81C4;
   L_021D81BC: ; // 0x21d81bc
@@ -7938,9 +7938,9 @@ void Gambit_fn_021D80C4(CPUState* cpu) {
         /* 021D81C8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 021D81C8 */ cpu->r[10] = _t28;
         /* 021D81CC */ cpu->r[7] = 0x101D0000u;
-        /* 021D81D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D81D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D81D4 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 021D81D8 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D81D8 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D81D8 */ _t30 = _t29 & 0x00000001u;
         /* 021D81D8 */ if (_t30) goto L_021D81DC; else goto L_021D81F0;
   L_021D81DC: ; // 0x21d81dc
@@ -7952,8 +7952,8 @@ void Gambit_fn_021D80C4(CPUState* cpu) {
         /* 021D81EC */ _t32 = cpu->r[7] + 0x00000000u;
         /* 021D81EC */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_021D81F0: ; // 0x21d81f0
-        /* 021D81F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 021D81F4 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D81F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 021D81F4 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D81F4 */ _t34 = _t33 & 0x00000001u;
         /* 021D81F4 */ if (_t34) goto L_021D81F8; else goto L_021D8200;
   L_021D81F8: ; // 0x21d81f8
@@ -7965,9 +7965,9 @@ void Gambit_fn_021D80C4(CPUState* cpu) {
         /* 021D8204 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 021D8204 */ cpu->r[8] = _t35;
         /* 021D8208 */ cpu->r[6] = 0x101D0000u;
-        /* 021D820C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021D820C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021D8210 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 021D8214 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8214 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8214 */ _t37 = _t36 & 0x00000001u;
         /* 021D8214 */ if (_t37) goto L_021D8218; else goto L_021D822C;
   L_021D8218: ; // 0x21d8218
@@ -8001,18 +8001,18 @@ void Gambit_fn_021D8244(CPUState* cpu) {
         /* 021D824C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021D824C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021D8250 */ cpu->r[31] = cpu->r[3];
-        /* 021D8250 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021D8250 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021D8254 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021D8254 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021D8258 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8258 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8258 */ _t4 = _t3 & 0x00000001u;
         /* 021D8258 */ if (_t4) goto L_021D825C; else goto L_021D826C;
   L_021D825C: ; // 0x21d825c
         /* 021D825C */ cpu->r[3] = 0x00000184u;
         /* 021D8260 */ Gambit_fn_02801A78(cpu);
         /* 021D8264 */ cpu->r[31] = cpu->r[3];
-        /* 021D8264 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021D8268 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8264 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021D8268 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8268 */ _t6 = _t5 & 0x00000001u;
         /* 021D8268 */ if (_t6) goto L_021D8298; else goto L_021D826C;
   L_021D826C: ; // 0x21d826c
@@ -8024,10 +8024,10 @@ void Gambit_fn_021D8244(CPUState* cpu) {
         /* 021D8280 */ _t7 = cpu->r[31] + 0x00000174u;
         /* 021D8280 */ rbrew_write8(cpu->mem, _t7, (uint8_t)cpu->r[0]);
         /* 021D8284 */ cpu->r[11] = cpu->r[31] + 0x00000178u;
-        /* 021D8284 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D8284 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D8288 */ _t8 = cpu->r[31] + 0x00000004u;
         /* 021D8288 */ rbrew_write32(cpu->mem, _t8, cpu->r[12]);
-        /* 021D828C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D828C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D828C */ _t10 = _t9 & 0x00000001u;
         /* 021D828C */ if (_t10) goto L_021D8290; else goto L_021D8298;
   L_021D8290: ; // 0x21d8290
@@ -8055,18 +8055,18 @@ void Gambit_fn_021D8248(CPUState* cpu) {
         /* 021D824C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021D824C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021D8250 */ cpu->r[31] = cpu->r[3];
-        /* 021D8250 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021D8250 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021D8254 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021D8254 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021D8258 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8258 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8258 */ _t4 = _t3 & 0x00000001u;
         /* 021D8258 */ if (_t4) goto L_021D825C; else goto L_021D826C;
   L_021D825C: ; // 0x21d825c
         /* 021D825C */ cpu->r[3] = 0x00000184u;
         /* 021D8260 */ Gambit_fn_02801A78(cpu);
         /* 021D8264 */ cpu->r[31] = cpu->r[3];
-        /* 021D8264 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021D8268 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8264 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021D8268 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8268 */ _t6 = _t5 & 0x00000001u;
         /* 021D8268 */ if (_t6) goto L_021D8298; else goto L_021D826C;
   L_021D826C: ; // 0x21d826c
@@ -8078,10 +8078,10 @@ void Gambit_fn_021D8248(CPUState* cpu) {
         /* 021D8280 */ _t7 = cpu->r[31] + 0x00000174u;
         /* 021D8280 */ rbrew_write8(cpu->mem, _t7, (uint8_t)cpu->r[0]);
         /* 021D8284 */ cpu->r[11] = cpu->r[31] + 0x00000178u;
-        /* 021D8284 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D8284 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D8288 */ _t8 = cpu->r[31] + 0x00000004u;
         /* 021D8288 */ rbrew_write32(cpu->mem, _t8, cpu->r[12]);
-        /* 021D828C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D828C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D828C */ _t10 = _t9 & 0x00000001u;
         /* 021D828C */ if (_t10) goto L_021D8290; else goto L_021D8298;
   L_021D8290: ; // 0x21d8290
@@ -8142,8 +8142,8 @@ void Gambit_fn_021D82B0(CPUState* cpu) {
         /* 021D8304 */ cpu->ctr = cpu->r[0];
         /* 021D8308 */ cpu->r[3] = cpu->r[31];
         /* 021D830C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D8310 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D8314 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8310 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D8314 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8314 */ _t15 = _t14 & 0x00000001u;
         /* 021D8314 */ if (_t15) goto L_021D832C; else goto L_021D8318;
   L_021D8318: ; // 0x21d8318
@@ -8206,8 +8206,8 @@ void Gambit_fn_021D82B8(CPUState* cpu) {
         /* 021D8304 */ cpu->ctr = cpu->r[0];
         /* 021D8308 */ cpu->r[3] = cpu->r[31];
         /* 021D830C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D8310 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D8314 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8310 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D8314 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8314 */ _t15 = _t14 & 0x00000001u;
         /* 021D8314 */ if (_t15) goto L_021D832C; else goto L_021D8318;
   L_021D8318: ; // 0x21d8318
@@ -8288,8 +8288,8 @@ void Gambit_fn_021D8340(CPUState* cpu) {
         /* 021D83B8 */ cpu->ctr = cpu->r[0];
         /* 021D83BC */ cpu->r[3] = cpu->r[30];
         /* 021D83C0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D83C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D83C8 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D83C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D83C8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D83C8 */ _t22 = _t21 & 0x00000001u;
         /* 021D83C8 */ if (_t22) goto L_021D83E0; else goto L_021D83CC;
   L_021D83CC: ; // 0x21d83cc
@@ -8371,8 +8371,8 @@ void Gambit_fn_021D8344(CPUState* cpu) {
         /* 021D83B8 */ cpu->ctr = cpu->r[0];
         /* 021D83BC */ cpu->r[3] = cpu->r[30];
         /* 021D83C0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D83C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D83C8 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D83C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D83C8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D83C8 */ _t22 = _t21 & 0x00000001u;
         /* 021D83C8 */ if (_t22) goto L_021D83E0; else goto L_021D83CC;
   L_021D83CC: ; // 0x21d83cc
@@ -8433,8 +8433,8 @@ void Gambit_fn_021D83F8(CPUState* cpu) {
         /* 021D843C */ cpu->ctr = cpu->r[0];
         /* 021D8440 */ cpu->r[3] = cpu->r[31];
         /* 021D8444 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D8448 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D844C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8448 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D844C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D844C */ _t13 = _t12 & 0x00000001u;
         /* 021D844C */ if (_t13) goto L_021D8464; else goto L_021D8450;
   L_021D8450: ; // 0x21d8450
@@ -8492,8 +8492,8 @@ void Gambit_fn_021D83FC(CPUState* cpu) {
         /* 021D843C */ cpu->ctr = cpu->r[0];
         /* 021D8440 */ cpu->r[3] = cpu->r[31];
         /* 021D8444 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D8448 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D844C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8448 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D844C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D844C */ _t13 = _t12 & 0x00000001u;
         /* 021D844C */ if (_t13) goto L_021D8464; else goto L_021D8450;
   L_021D8450: ; // 0x21d8450
@@ -8549,8 +8549,8 @@ void Gambit_fn_021D8478(CPUState* cpu) {
         /* 021D84B8 */ cpu->ctr = cpu->r[0];
         /* 021D84BC */ cpu->r[3] = cpu->r[31];
         /* 021D84C0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D84C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D84C8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D84C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D84C8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D84C8 */ _t11 = _t10 & 0x00000001u;
         /* 021D84C8 */ if (_t11) goto L_021D84E0; else goto L_021D84CC;
   L_021D84CC: ; // 0x21d84cc
@@ -8605,8 +8605,8 @@ void Gambit_fn_021D847C(CPUState* cpu) {
         /* 021D84B8 */ cpu->ctr = cpu->r[0];
         /* 021D84BC */ cpu->r[3] = cpu->r[31];
         /* 021D84C0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D84C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D84C8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D84C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D84C8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D84C8 */ _t11 = _t10 & 0x00000001u;
         /* 021D84C8 */ if (_t11) goto L_021D84E0; else goto L_021D84CC;
   L_021D84CC: ; // 0x21d84cc
@@ -8672,8 +8672,8 @@ void Gambit_fn_021D8528(CPUState* cpu) {
         /* 021D853C */ Gambit_fn_0222EFF4(cpu);
         /* 021D8540 */ _t3 = cpu->r[31] + 0x00000174u;
         /* 021D8540 */ cpu->r[12] = rbrew_read8(cpu->mem, _t3);
-        /* 021D8544 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D8548 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8544 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D8548 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8548 */ _t5 = _t4 & 0x00000001u;
         /* 021D8548 */ if (_t5) goto L_021D8588; else goto L_021D854C;
   L_021D854C: ; // 0x21d854c
@@ -8707,13 +8707,13 @@ void Gambit_fn_021D8528(CPUState* cpu) {
   L_021D8588: ; // 0x21d8588
         /* 021D8588 */ _t18 = cpu->r[31] + 0x0000001Cu;
         /* 021D8588 */ cpu->r[0] = rbrew_read32(cpu->mem, _t18);
-        /* 021D858C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021D8590 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D858C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021D8590 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8590 */ _t20 = _t19 & 0x00000001u;
         /* 021D8590 */ if (_t20) goto L_021D859C; else goto L_021D8594;
   L_021D8594: ; // 0x21d8594
-        /* 021D8594 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021D8598 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8594 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021D8598 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8598 */ _t22 = _t21 & 0x00000001u;
         /* 021D8598 */ if (_t22) goto L_021D859C; else goto L_021D85B0;
   L_021D859C: ; // 0x21d859c
@@ -8750,8 +8750,8 @@ void Gambit_fn_021D852C(CPUState* cpu) {
         /* 021D853C */ Gambit_fn_0222EFF4(cpu);
         /* 021D8540 */ _t3 = cpu->r[31] + 0x00000174u;
         /* 021D8540 */ cpu->r[12] = rbrew_read8(cpu->mem, _t3);
-        /* 021D8544 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D8548 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8544 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D8548 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8548 */ _t5 = _t4 & 0x00000001u;
         /* 021D8548 */ if (_t5) goto L_021D8588; else goto L_021D854C;
   L_021D854C: ; // 0x21d854c
@@ -8785,13 +8785,13 @@ void Gambit_fn_021D852C(CPUState* cpu) {
   L_021D8588: ; // 0x21d8588
         /* 021D8588 */ _t18 = cpu->r[31] + 0x0000001Cu;
         /* 021D8588 */ cpu->r[0] = rbrew_read32(cpu->mem, _t18);
-        /* 021D858C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021D8590 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D858C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021D8590 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8590 */ _t20 = _t19 & 0x00000001u;
         /* 021D8590 */ if (_t20) goto L_021D859C; else goto L_021D8594;
   L_021D8594: ; // 0x21d8594
-        /* 021D8594 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021D8598 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8594 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021D8598 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8598 */ _t22 = _t21 & 0x00000001u;
         /* 021D8598 */ if (_t22) goto L_021D859C; else goto L_021D85B0;
   L_021D859C: ; // 0x21d859c
@@ -8987,8 +8987,8 @@ void Gambit_fn_021D8670(CPUState* cpu) {
         /* 021D8688 */ cpu->ctr = cpu->r[0];
         /* 021D868C */ cpu->r[31] = cpu->r[3];
         /* 021D8690 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D8694 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D8698 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8694 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D8698 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8698 */ _t6 = _t5 & 0x00000001u;
         /* 021D8698 */ if (_t6) goto L_021D86A4; else goto L_021D869C;
   L_021D869C: ; // 0x21d869c
@@ -9023,8 +9023,8 @@ void Gambit_fn_021D8674(CPUState* cpu) {
         /* 021D8688 */ cpu->ctr = cpu->r[0];
         /* 021D868C */ cpu->r[31] = cpu->r[3];
         /* 021D8690 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D8694 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D8698 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8694 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D8698 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8698 */ _t6 = _t5 & 0x00000001u;
         /* 021D8698 */ if (_t6) goto L_021D86A4; else goto L_021D869C;
   L_021D869C: ; // 0x21d869c
@@ -9060,8 +9060,8 @@ void Gambit_fn_021D86B8(CPUState* cpu) {
         /* 021D86D0 */ cpu->ctr = cpu->r[0];
         /* 021D86D4 */ cpu->r[31] = cpu->r[3];
         /* 021D86D8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D86DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D86E0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D86DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D86E0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D86E0 */ _t6 = _t5 & 0x00000001u;
         /* 021D86E0 */ if (_t6) goto L_021D86E4; else goto L_021D8730;
   L_021D86E4: ; // 0x21d86e4
@@ -9087,8 +9087,8 @@ void Gambit_fn_021D86B8(CPUState* cpu) {
         /* 021D8718 */ cpu->f[13] = fma(cpu->f[13], cpu->f[13], cpu->f[12]);
         /* 021D871C */ _t13 = cpu->r[8] + 0x00000A7Cu;
         /* 021D871C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t13);
-        /* 021D8720 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 021D8724 */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D8720 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 021D8724 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D8724 */ _t15 = _t14 & 0x00000001u;
         /* 021D8724 */ if (_t15) goto L_021D8730; else goto L_021D8728;
   L_021D8728: ; // 0x21d8728
@@ -9123,8 +9123,8 @@ void Gambit_fn_021D86BC(CPUState* cpu) {
         /* 021D86D0 */ cpu->ctr = cpu->r[0];
         /* 021D86D4 */ cpu->r[31] = cpu->r[3];
         /* 021D86D8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021D86DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D86E0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D86DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D86E0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D86E0 */ _t6 = _t5 & 0x00000001u;
         /* 021D86E0 */ if (_t6) goto L_021D86E4; else goto L_021D8730;
   L_021D86E4: ; // 0x21d86e4
@@ -9150,8 +9150,8 @@ void Gambit_fn_021D86BC(CPUState* cpu) {
         /* 021D8718 */ cpu->f[13] = fma(cpu->f[13], cpu->f[13], cpu->f[12]);
         /* 021D871C */ _t13 = cpu->r[8] + 0x00000A7Cu;
         /* 021D871C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t13);
-        /* 021D8720 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 021D8724 */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D8720 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 021D8724 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D8724 */ _t15 = _t14 & 0x00000001u;
         /* 021D8724 */ if (_t15) goto L_021D8730; else goto L_021D8728;
   L_021D8728: ; // 0x21d8728
@@ -9223,8 +9223,8 @@ void Gambit_fn_021D8764(CPUState* cpu) {
         /* 021D8764 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D8764 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D8768 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021D8768 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D876C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D876C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D876C */ _t2 = _t1 & 0x00000001u;
         /* 021D876C */ _t3 = _t2 ^ 0x00000001u;
         /* 021D876C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -9246,8 +9246,8 @@ void Gambit_fn_021D8780(CPUState* cpu) {
         /* 021D8780 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D8780 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D8784 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021D8784 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D8788 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8784 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D8788 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8788 */ _t2 = _t1 & 0x00000001u;
         /* 021D8788 */ _t3 = _t2 ^ 0x00000001u;
         /* 021D8788 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -9269,8 +9269,8 @@ void Gambit_fn_021D879C(CPUState* cpu) {
         /* 021D879C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D879C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D87A0 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021D87A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D87A4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D87A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D87A4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D87A4 */ _t2 = _t1 & 0x00000001u;
         /* 021D87A4 */ _t3 = _t2 ^ 0x00000001u;
         /* 021D87A4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -9313,8 +9313,8 @@ void Gambit_fn_021D87C8(CPUState* cpu) {
         /* 021D87D8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D87DC */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D87DC */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021D87E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021D87E4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D87E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021D87E4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D87E4 */ _t5 = _t4 & 0x00000001u;
         /* 021D87E4 */ if (_t5) goto L_021D87E8; else goto L_021D8804;
   L_021D87E8: ; // 0x21d87e8
@@ -9353,8 +9353,8 @@ void Gambit_fn_021D87CC(CPUState* cpu) {
         /* 021D87D8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D87DC */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D87DC */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021D87E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021D87E4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D87E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021D87E4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D87E4 */ _t5 = _t4 & 0x00000001u;
         /* 021D87E4 */ if (_t5) goto L_021D87E8; else goto L_021D8804;
   L_021D87E8: ; // 0x21d87e8
@@ -9815,8 +9815,8 @@ void Gambit_fn_021D89DC(CPUState* cpu) {
         /* 021D89DC */ _t0 = cpu->r[3] + 0x00000114u;
         /* 021D89DC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D89E0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 021D89E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D89E4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D89E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D89E4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D89E4 */ _t2 = _t1 & 0x00000001u;
         /* 021D89E4 */ if (_t2) goto L_021D89F4; else goto L_021D89E8;
   L_021D89E8: ; // 0x21d89e8
@@ -9845,8 +9845,8 @@ void Gambit_fn_021D8A00(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -9941,9 +9941,9 @@ void Gambit_fn_021D8A50(CPUState* cpu) {
         /* 021D8A54 */ _t0 = cpu->r[8] + 0xFFFFE618u;
         /* 021D8A54 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 021D8A58 */ cpu->r[6] = 0x101D0000u;
-        /* 021D8A5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021D8A5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021D8A60 */ cpu->r[6] = cpu->r[6] + 0xFFFFFC04u;
-        /* 021D8A64 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8A64 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8A64 */ _t2 = _t1 & 0x00000001u;
         /* 021D8A64 */ if (_t2) goto L_021D8A68; else goto L_021D8A80;
   L_021D8A68: ; // 0x21d8a68
@@ -9956,8 +9956,8 @@ void Gambit_fn_021D8A50(CPUState* cpu) {
         /* 021D8A7C */ _t4 = cpu->r[6] + 0x00000000u;
         /* 021D8A7C */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_021D8A80: ; // 0x21d8a80
-        /* 021D8A80 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 021D8A84 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8A80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 021D8A84 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8A84 */ _t6 = _t5 & 0x00000001u;
         /* 021D8A84 */ if (_t6) goto L_021D8A88; else goto L_021D8A90;
   L_021D8A88: ; // 0x21d8a88
@@ -9968,9 +9968,9 @@ void Gambit_fn_021D8A50(CPUState* cpu) {
         /* 021D8A94 */ _t7 = cpu->r[10] + 0xFFFFDA0Cu;
         /* 021D8A94 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 021D8A98 */ cpu->r[8] = 0x101D0000u;
-        /* 021D8A9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021D8A9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021D8AA0 */ cpu->r[8] = cpu->r[8] + 0xFFFFFC00u;
-        /* 021D8AA4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8AA4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8AA4 */ _t9 = _t8 & 0x00000001u;
         /* 021D8AA4 */ if (_t9) goto L_021D8AA8; else goto L_021D8AC0;
   L_021D8AA8: ; // 0x21d8aa8
@@ -9983,8 +9983,8 @@ void Gambit_fn_021D8A50(CPUState* cpu) {
         /* 021D8ABC */ _t11 = cpu->r[8] + 0x00000000u;
         /* 021D8ABC */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_021D8AC0: ; // 0x21d8ac0
-        /* 021D8AC0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021D8AC4 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8AC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021D8AC4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8AC4 */ _t13 = _t12 & 0x00000001u;
         /* 021D8AC4 */ if (_t13) goto L_021D8AC8; else goto L_021D8AD0;
   L_021D8AC8: ; // 0x21d8ac8
@@ -9995,9 +9995,9 @@ void Gambit_fn_021D8A50(CPUState* cpu) {
         /* 021D8AD4 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 021D8AD4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 021D8AD8 */ cpu->r[10] = 0x101D0000u;
-        /* 021D8ADC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021D8ADC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021D8AE0 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 021D8AE4 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8AE4 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8AE4 */ _t16 = _t15 & 0x00000001u;
         /* 021D8AE4 */ if (_t16) goto L_021D8AE8; else goto L_021D8B00;
   L_021D8AE8: ; // 0x21d8ae8
@@ -10010,8 +10010,8 @@ void Gambit_fn_021D8A50(CPUState* cpu) {
         /* 021D8AFC */ _t18 = cpu->r[10] + 0x00000000u;
         /* 021D8AFC */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_021D8B00: ; // 0x21d8b00
-        /* 021D8B00 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021D8B04 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8B00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021D8B04 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8B04 */ _t20 = _t19 & 0x00000001u;
         /* 021D8B04 */ if (_t20) goto L_021D8B08; else goto L_021D8B10;
   L_021D8B08: ; // 0x21d8b08
@@ -10022,9 +10022,9 @@ void Gambit_fn_021D8A50(CPUState* cpu) {
         /* 021D8B14 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021D8B14 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021D8B18 */ cpu->r[12] = 0x101D0000u;
-        /* 021D8B1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D8B1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D8B20 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021D8B24 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8B24 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8B24 */ _t23 = _t22 & 0x00000001u;
         /* 021D8B24 */ if (_t23) goto L_021D8B28; else goto L_021D8B40;
   L_021D8B28: ; // 0x21d8b28
@@ -10037,8 +10037,8 @@ void Gambit_fn_021D8A50(CPUState* cpu) {
         /* 021D8B3C */ _t25 = cpu->r[12] + 0x00000000u;
         /* 021D8B3C */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_021D8B40: ; // 0x21d8b40
-        /* 021D8B40 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021D8B44 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8B40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021D8B44 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8B44 */ _t27 = _t26 & 0x00000001u;
         /* 021D8B44 */ if (_t27) goto L_021D8B48; else goto L_021D8B50;
   L_021D8B48: ; // 0x21d8b48
@@ -10050,9 +10050,9 @@ void Gambit_fn_021D8A50(CPUState* cpu) {
         /* 021D8B54 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 021D8B54 */ cpu->r[10] = _t28;
         /* 021D8B58 */ cpu->r[7] = 0x101D0000u;
-        /* 021D8B5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D8B5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D8B60 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 021D8B64 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8B64 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8B64 */ _t30 = _t29 & 0x00000001u;
         /* 021D8B64 */ if (_t30) goto L_021D8B68; else goto L_021D8B7C;
   L_021D8B68: ; // 0x21d8b68
@@ -10064,8 +10064,8 @@ void Gambit_fn_021D8A50(CPUState* cpu) {
         /* 021D8B78 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 021D8B78 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_021D8B7C: ; // 0x21d8b7c
-        /* 021D8B7C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 021D8B80 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8B7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 021D8B80 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8B80 */ _t34 = _t33 & 0x00000001u;
         /* 021D8B80 */ if (_t34) goto L_021D8B84; else goto L_021D8B8C;
   L_021D8B84: ; // 0x21d8b84
@@ -10077,9 +10077,9 @@ void Gambit_fn_021D8A50(CPUState* cpu) {
         /* 021D8B90 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 021D8B90 */ cpu->r[8] = _t35;
         /* 021D8B94 */ cpu->r[6] = 0x101D0000u;
-        /* 021D8B98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021D8B98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021D8B9C */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 021D8BA0 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8BA0 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8BA0 */ _t37 = _t36 & 0x00000001u;
         /* 021D8BA0 */ if (_t37) goto L_021D8BA4; else goto L_021D8BB8;
   L_021D8BA4: ; // 0x21d8ba4
@@ -10113,18 +10113,18 @@ void Gambit_fn_021D8BD0(CPUState* cpu) {
         /* 021D8BD8 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021D8BD8 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021D8BDC */ cpu->r[31] = cpu->r[3];
-        /* 021D8BDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021D8BDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021D8BE0 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021D8BE0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021D8BE4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8BE4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8BE4 */ _t4 = _t3 & 0x00000001u;
         /* 021D8BE4 */ if (_t4) goto L_021D8BE8; else goto L_021D8BF8;
   L_021D8BE8: ; // 0x21d8be8
         /* 021D8BE8 */ cpu->r[3] = 0x00000184u;
         /* 021D8BEC */ Gambit_fn_02801A78(cpu);
         /* 021D8BF0 */ cpu->r[31] = cpu->r[3];
-        /* 021D8BF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021D8BF4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8BF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021D8BF4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8BF4 */ _t6 = _t5 & 0x00000001u;
         /* 021D8BF4 */ if (_t6) goto L_021D8C0C; else goto L_021D8BF8;
   L_021D8BF8: ; // 0x21d8bf8
@@ -10156,18 +10156,18 @@ void Gambit_fn_021D8BD4(CPUState* cpu) {
         /* 021D8BD8 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021D8BD8 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021D8BDC */ cpu->r[31] = cpu->r[3];
-        /* 021D8BDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021D8BDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021D8BE0 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021D8BE0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021D8BE4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8BE4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8BE4 */ _t4 = _t3 & 0x00000001u;
         /* 021D8BE4 */ if (_t4) goto L_021D8BE8; else goto L_021D8BF8;
   L_021D8BE8: ; // 0x21d8be8
         /* 021D8BE8 */ cpu->r[3] = 0x00000184u;
         /* 021D8BEC */ Gambit_fn_02801A78(cpu);
         /* 021D8BF0 */ cpu->r[31] = cpu->r[3];
-        /* 021D8BF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021D8BF4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8BF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021D8BF4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8BF4 */ _t6 = _t5 & 0x00000001u;
         /* 021D8BF4 */ if (_t6) goto L_021D8C0C; else goto L_021D8BF8;
   L_021D8BF8: ; // 0x21d8bf8
@@ -10206,8 +10206,8 @@ void Gambit_fn_021D8C24(CPUState* cpu) {
         /* 021D8C3C */ Gambit_fn_02019890(cpu);
         /* 021D8C40 */ _t3 = cpu->r[1] + 0x00000008u;
         /* 021D8C40 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021D8C44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 021D8C48 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8C44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 021D8C48 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8C48 */ _t5 = _t4 & 0x00000001u;
         /* 021D8C48 */ if (_t5) goto L_021D8C4C; else goto L_021D8C68;
   L_021D8C4C: ; // 0x21d8c4c
@@ -10254,8 +10254,8 @@ void Gambit_fn_021D8C28(CPUState* cpu) {
         /* 021D8C3C */ Gambit_fn_02019890(cpu);
         /* 021D8C40 */ _t3 = cpu->r[1] + 0x00000008u;
         /* 021D8C40 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021D8C44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 021D8C48 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8C44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 021D8C48 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8C48 */ _t5 = _t4 & 0x00000001u;
         /* 021D8C48 */ if (_t5) goto L_021D8C4C; else goto L_021D8C68;
   L_021D8C4C: ; // 0x21d8c4c
@@ -10398,8 +10398,8 @@ void Gambit_fn_021D8CE8(CPUState* cpu) {
         /* 021D8CE8 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D8CE8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D8CEC */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021D8CEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D8CF0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8CEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D8CF0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8CF0 */ _t2 = _t1 & 0x00000001u;
         /* 021D8CF0 */ _t3 = _t2 ^ 0x00000001u;
         /* 021D8CF0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -10421,8 +10421,8 @@ void Gambit_fn_021D8D04(CPUState* cpu) {
         /* 021D8D04 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D8D04 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D8D08 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021D8D08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D8D0C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8D08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D8D0C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8D0C */ _t2 = _t1 & 0x00000001u;
         /* 021D8D0C */ _t3 = _t2 ^ 0x00000001u;
         /* 021D8D0C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -10444,8 +10444,8 @@ void Gambit_fn_021D8D20(CPUState* cpu) {
         /* 021D8D20 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021D8D20 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D8D24 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021D8D24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D8D28 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8D24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D8D28 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8D28 */ _t2 = _t1 & 0x00000001u;
         /* 021D8D28 */ _t3 = _t2 ^ 0x00000001u;
         /* 021D8D28 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -10488,8 +10488,8 @@ void Gambit_fn_021D8D4C(CPUState* cpu) {
         /* 021D8D5C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D8D60 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D8D60 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021D8D64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021D8D68 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8D64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021D8D68 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8D68 */ _t5 = _t4 & 0x00000001u;
         /* 021D8D68 */ if (_t5) goto L_021D8D6C; else goto L_021D8D88;
   L_021D8D6C: ; // 0x21d8d6c
@@ -10528,8 +10528,8 @@ void Gambit_fn_021D8D50(CPUState* cpu) {
         /* 021D8D5C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021D8D60 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021D8D60 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021D8D64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021D8D68 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8D64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021D8D68 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8D68 */ _t5 = _t4 & 0x00000001u;
         /* 021D8D68 */ if (_t5) goto L_021D8D6C; else goto L_021D8D88;
   L_021D8D6C: ; // 0x21d8d6c
@@ -10977,8 +10977,8 @@ void Gambit_fn_021D8F50(CPUState* cpu) {
         /* 021D8F50 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 021D8F50 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021D8F54 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 021D8F54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D8F58 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8F54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D8F58 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8F58 */ _t2 = _t1 & 0x00000001u;
         /* 021D8F58 */ if (_t2) goto L_021D8F68; else goto L_021D8F5C;
   L_021D8F5C: ; // 0x21d8f5c
@@ -11007,8 +11007,8 @@ void Gambit_fn_021D8F74(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -11103,9 +11103,9 @@ void Gambit_fn_021D8FC4(CPUState* cpu) {
         /* 021D8FC8 */ _t0 = cpu->r[7] + 0xFFFFE61Cu;
         /* 021D8FC8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t0);
         /* 021D8FCC */ cpu->r[8] = 0x101D0000u;
-        /* 021D8FD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021D8FD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021D8FD4 */ cpu->r[8] = cpu->r[8] + 0xFFFFFC08u;
-        /* 021D8FD8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8FD8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8FD8 */ _t2 = _t1 & 0x00000001u;
         /* 021D8FD8 */ if (_t2) goto L_021D8FDC; else goto L_021D8FF4;
   L_021D8FDC: ; // 0x21d8fdc
@@ -11118,8 +11118,8 @@ void Gambit_fn_021D8FC4(CPUState* cpu) {
         /* 021D8FF0 */ _t4 = cpu->r[8] + 0x00000000u;
         /* 021D8FF0 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_021D8FF4: ; // 0x21d8ff4
-        /* 021D8FF4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021D8FF8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D8FF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021D8FF8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D8FF8 */ _t6 = _t5 & 0x00000001u;
         /* 021D8FF8 */ if (_t6) goto L_021D8FFC; else goto L_021D9004;
   L_021D8FFC: ; // 0x21d8ffc
@@ -11130,9 +11130,9 @@ void Gambit_fn_021D8FC4(CPUState* cpu) {
         /* 021D9008 */ _t7 = cpu->r[8] + 0xFFFFE618u;
         /* 021D9008 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 021D900C */ cpu->r[11] = 0x101D0000u;
-        /* 021D9010 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021D9010 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021D9014 */ cpu->r[11] = cpu->r[11] + 0xFFFFFC04u;
-        /* 021D9018 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9018 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9018 */ _t9 = _t8 & 0x00000001u;
         /* 021D9018 */ if (_t9) goto L_021D901C; else goto L_021D9034;
   L_021D901C: ; // 0x21d901c
@@ -11145,8 +11145,8 @@ void Gambit_fn_021D8FC4(CPUState* cpu) {
         /* 021D9030 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021D9030 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021D9034: ; // 0x21d9034
-        /* 021D9034 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021D9038 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9034 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021D9038 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9038 */ _t13 = _t12 & 0x00000001u;
         /* 021D9038 */ if (_t13) goto L_021D903C; else goto L_021D9044;
   L_021D903C: ; // 0x21d903c
@@ -11157,9 +11157,9 @@ void Gambit_fn_021D8FC4(CPUState* cpu) {
         /* 021D9048 */ _t14 = cpu->r[9] + 0xFFFFDA0Cu;
         /* 021D9048 */ cpu->r[9] = rbrew_read32(cpu->mem, _t14);
         /* 021D904C */ cpu->r[8] = 0x101D0000u;
-        /* 021D9050 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021D9050 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021D9054 */ cpu->r[8] = cpu->r[8] + 0xFFFFFC00u;
-        /* 021D9058 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9058 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9058 */ _t16 = _t15 & 0x00000001u;
         /* 021D9058 */ if (_t16) goto L_021D905C; else goto L_021D9074;
   L_021D905C: ; // 0x21d905c
@@ -11172,8 +11172,8 @@ void Gambit_fn_021D8FC4(CPUState* cpu) {
         /* 021D9070 */ _t18 = cpu->r[8] + 0x00000000u;
         /* 021D9070 */ rbrew_write32(cpu->mem, _t18, cpu->r[10]);
   L_021D9074: ; // 0x21d9074
-        /* 021D9074 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021D9078 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9074 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021D9078 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9078 */ _t20 = _t19 & 0x00000001u;
         /* 021D9078 */ if (_t20) goto L_021D907C; else goto L_021D9084;
   L_021D907C: ; // 0x21d907c
@@ -11184,9 +11184,9 @@ void Gambit_fn_021D8FC4(CPUState* cpu) {
         /* 021D9088 */ _t21 = cpu->r[11] + 0xFFFFDA00u;
         /* 021D9088 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021D908C */ cpu->r[8] = 0x101D0000u;
-        /* 021D9090 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D9090 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D9094 */ cpu->r[8] = cpu->r[8] + 0xFFFFFBFCu;
-        /* 021D9098 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9098 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9098 */ _t23 = _t22 & 0x00000001u;
         /* 021D9098 */ if (_t23) goto L_021D909C; else goto L_021D90B4;
   L_021D909C: ; // 0x21d909c
@@ -11199,8 +11199,8 @@ void Gambit_fn_021D8FC4(CPUState* cpu) {
         /* 021D90B0 */ _t25 = cpu->r[8] + 0x00000000u;
         /* 021D90B0 */ rbrew_write32(cpu->mem, _t25, cpu->r[9]);
   L_021D90B4: ; // 0x21d90b4
-        /* 021D90B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021D90B8 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D90B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021D90B8 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D90B8 */ _t27 = _t26 & 0x00000001u;
         /* 021D90B8 */ if (_t27) goto L_021D90BC; else goto L_021D90C4;
   L_021D90BC: ; // 0x21d90bc
@@ -11211,9 +11211,9 @@ void Gambit_fn_021D8FC4(CPUState* cpu) {
         /* 021D90C8 */ _t28 = cpu->r[10] + 0xFFFFD9ECu;
         /* 021D90C8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t28);
         /* 021D90CC */ cpu->r[11] = 0x101D0000u;
-        /* 021D90D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021D90D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021D90D4 */ cpu->r[11] = cpu->r[11] + 0xFFFFFB4Cu;
-        /* 021D90D8 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D90D8 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D90D8 */ _t30 = _t29 & 0x00000001u;
         /* 021D90D8 */ if (_t30) goto L_021D90DC; else goto L_021D90F4;
   L_021D90DC: ; // 0x21d90dc
@@ -11226,8 +11226,8 @@ void Gambit_fn_021D8FC4(CPUState* cpu) {
         /* 021D90F0 */ _t32 = cpu->r[11] + 0x00000000u;
         /* 021D90F0 */ rbrew_write32(cpu->mem, _t32, cpu->r[7]);
   L_021D90F4: ; // 0x21d90f4
-        /* 021D90F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021D90F8 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D90F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021D90F8 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D90F8 */ _t34 = _t33 & 0x00000001u;
         /* 021D90F8 */ if (_t34) goto L_021D90FC; else goto L_021D9104;
   L_021D90FC: ; // 0x21d90fc
@@ -11239,9 +11239,9 @@ void Gambit_fn_021D8FC4(CPUState* cpu) {
         /* 021D9108 */ cpu->r[0] = rbrew_read32(cpu->mem, _t35);
         /* 021D9108 */ cpu->r[11] = _t35;
         /* 021D910C */ cpu->r[10] = 0x101D0000u;
-        /* 021D9110 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021D9110 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021D9114 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021D9118 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9118 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9118 */ _t37 = _t36 & 0x00000001u;
         /* 021D9118 */ if (_t37) goto L_021D911C; else goto L_021D9130;
   L_021D911C: ; // 0x21d911c
@@ -11253,8 +11253,8 @@ void Gambit_fn_021D8FC4(CPUState* cpu) {
         /* 021D912C */ _t39 = cpu->r[10] + 0x00000000u;
         /* 021D912C */ rbrew_write32(cpu->mem, _t39, cpu->r[0]);
   L_021D9130: ; // 0x21d9130
-        /* 021D9130 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021D9134 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9130 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021D9134 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9134 */ _t41 = _t40 & 0x00000001u;
         /* 021D9134 */ if (_t41) goto L_021D9138; else goto L_021D9140;
   L_021D9138: ; // 0x21d9138
@@ -11266,9 +11266,9 @@ void Gambit_fn_021D8FC4(CPUState* cpu) {
         /* 021D9144 */ cpu->r[9] = rbrew_read32(cpu->mem, _t42);
         /* 021D9144 */ cpu->r[10] = _t42;
         /* 021D9148 */ cpu->r[11] = 0x101D0000u;
-        /* 021D914C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021D914C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021D9150 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021D9154 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9154 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9154 */ _t44 = _t43 & 0x00000001u;
         /* 021D9154 */ if (_t44) goto L_021D9158; else goto L_021D916C;
   L_021D9158: ; // 0x21d9158
@@ -11327,20 +11327,20 @@ void Gambit_fn_021D9194(CPUState* cpu) {
         /* 021D91A8 */ _t3 = cpu->r[1] + 0x00000018u;
         /* 021D91A8 */ rbrew_write_f32(cpu->mem, _t3, cpu->f[31]);
         /* 021D91AC */ cpu->r[31] = cpu->r[3];
-        /* 021D91AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021D91AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021D91B0 */ _t4 = cpu->r[1] + 0x00000008u;
         /* 021D91B0 */ rbrew_write32(cpu->mem, _t4, cpu->r[30]);
         /* 021D91B4 */ _t5 = cpu->r[1] + 0x00000024u;
         /* 021D91B4 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
-        /* 021D91B8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D91B8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D91B8 */ _t7 = _t6 & 0x00000001u;
         /* 021D91B8 */ if (_t7) goto L_021D91BC; else goto L_021D91CC;
   L_021D91BC: ; // 0x21d91bc
         /* 021D91BC */ cpu->r[3] = 0x00000200u;
         /* 021D91C0 */ Gambit_fn_02801A78(cpu);
         /* 021D91C4 */ cpu->r[31] = cpu->r[3];
-        /* 021D91C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021D91C8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D91C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021D91C8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D91C8 */ _t9 = _t8 & 0x00000001u;
         /* 021D91C8 */ if (_t9) goto L_021D9334; else goto L_021D91CC;
   L_021D91CC: ; // 0x21d91cc
@@ -11359,10 +11359,10 @@ void Gambit_fn_021D9194(CPUState* cpu) {
         /* 021D91F0 */ _t13 = cpu->r[31] + 0x00000128u;
         /* 021D91F0 */ rbrew_write8(cpu->mem, _t13, (uint8_t)cpu->r[30]);
         /* 021D91F4 */ cpu->r[11] = cpu->r[31] + 0x00000130u;
-        /* 021D91F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D91F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D91F8 */ _t14 = cpu->r[31] + 0x0000012Cu;
         /* 021D91F8 */ rbrew_write_f32(cpu->mem, _t14, cpu->f[0]);
-        /* 021D91FC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D91FC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D91FC */ _t16 = _t15 & 0x00000001u;
         /* 021D91FC */ if (_t16) goto L_021D9200; else goto L_021D9208;
   L_021D9200: ; // 0x21d9200
@@ -11370,8 +11370,8 @@ void Gambit_fn_021D9194(CPUState* cpu) {
         /* 021D9204 */ Gambit_fn_02801A78(cpu);
   L_021D9208: ; // 0x21d9208
         /* 021D9208 */ cpu->r[12] = cpu->r[31] + 0x0000013Cu;
-        /* 021D9208 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D920C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D920C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D920C */ _t18 = _t17 & 0x00000001u;
         /* 021D920C */ if (_t18) goto L_021D9210; else goto L_021D9218;
   L_021D9210: ; // 0x21d9210
@@ -11379,8 +11379,8 @@ void Gambit_fn_021D9194(CPUState* cpu) {
         /* 021D9214 */ Gambit_fn_02801A78(cpu);
   L_021D9218: ; // 0x21d9218
         /* 021D9218 */ cpu->r[0] = cpu->r[31] + 0x0000016Cu;
-        /* 021D9218 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D921C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9218 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D921C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D921C */ _t20 = _t19 & 0x00000001u;
         /* 021D921C */ if (_t20) goto L_021D9220; else goto L_021D9228;
   L_021D9220: ; // 0x21d9220
@@ -11388,8 +11388,8 @@ void Gambit_fn_021D9194(CPUState* cpu) {
         /* 021D9224 */ Gambit_fn_02801A78(cpu);
   L_021D9228: ; // 0x21d9228
         /* 021D9228 */ cpu->r[0] = cpu->r[31] + 0x00000178u;
-        /* 021D9228 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D922C */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D922C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D922C */ _t22 = _t21 & 0x00000001u;
         /* 021D922C */ if (_t22) goto L_021D9230; else goto L_021D9238;
   L_021D9230: ; // 0x21d9230
@@ -11397,8 +11397,8 @@ void Gambit_fn_021D9194(CPUState* cpu) {
         /* 021D9234 */ Gambit_fn_02801A78(cpu);
   L_021D9238: ; // 0x21d9238
         /* 021D9238 */ cpu->r[11] = cpu->r[31] + 0x00000184u;
-        /* 021D9238 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021D923C */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9238 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021D923C */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D923C */ _t24 = _t23 & 0x00000001u;
         /* 021D923C */ if (_t24) goto L_021D9240; else goto L_021D9248;
   L_021D9240: ; // 0x21d9240
@@ -11419,10 +11419,10 @@ void Gambit_fn_021D9194(CPUState* cpu) {
         /* 021D9260 */ _t30 = cpu->r[0] & 0xFFFFFF3Fu;
         /* 021D9260 */ cpu->r[0] = _t30 | _t29;
         /* 021D9264 */ cpu->r[11] = cpu->r[31] + 0x000001B0u;
-        /* 021D9264 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D9264 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D9268 */ _t31 = cpu->r[31] + 0x0000019Cu;
         /* 021D9268 */ rbrew_write32(cpu->mem, _t31, cpu->r[0]);
-        /* 021D926C */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D926C */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D926C */ _t33 = _t32 & 0x00000001u;
         /* 021D926C */ if (_t33) goto L_021D9270; else goto L_021D9278;
   L_021D9270: ; // 0x21d9270
@@ -11430,8 +11430,8 @@ void Gambit_fn_021D9194(CPUState* cpu) {
         /* 021D9274 */ Gambit_fn_02801A78(cpu);
   L_021D9278: ; // 0x21d9278
         /* 021D9278 */ cpu->r[12] = cpu->r[31] + 0x000001BCu;
-        /* 021D9278 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D927C */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9278 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D927C */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D927C */ _t35 = _t34 & 0x00000001u;
         /* 021D927C */ if (_t35) goto L_021D9280; else goto L_021D9288;
   L_021D9280: ; // 0x21d9280
@@ -11440,29 +11440,29 @@ void Gambit_fn_021D9194(CPUState* cpu) {
   L_021D9288: ; // 0x21d9288
         /* 021D9288 */ cpu->r[10] = 0x10030000u;
         /* 021D928C */ cpu->r[3] = cpu->r[31] + 0x000001C8u;
-        /* 021D928C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021D928C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021D9290 */ _t36 = cpu->r[10] + 0x00001484u;
         /* 021D9290 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t36);
-        /* 021D9294 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9294 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9294 */ _t38 = _t37 & 0x00000001u;
         /* 021D9294 */ if (_t38) goto L_021D9298; else goto L_021D92A8;
   L_021D9298: ; // 0x21d9298
         /* 021D9298 */ cpu->r[3] = 0x0000000Cu;
         /* 021D929C */ Gambit_fn_02801A78(cpu);
-        /* 021D92A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D92A4 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D92A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D92A4 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D92A4 */ _t40 = _t39 & 0x00000001u;
         /* 021D92A4 */ if (_t40) goto L_021D92CC; else goto L_021D92A8;
   L_021D92A8: ; // 0x21d92a8
-        /* 021D92A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D92AC */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D92A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D92AC */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D92AC */ _t42 = _t41 & 0x00000001u;
         /* 021D92AC */ if (_t42) goto L_021D92B0; else goto L_021D92C0;
   L_021D92B0: ; // 0x21d92b0
         /* 021D92B0 */ cpu->r[3] = 0x0000000Cu;
         /* 021D92B4 */ Gambit_fn_02801A78(cpu);
-        /* 021D92B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D92BC */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D92B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D92BC */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D92BC */ _t44 = _t43 & 0x00000001u;
         /* 021D92BC */ if (_t44) goto L_021D92CC; else goto L_021D92C0;
   L_021D92C0: ; // 0x21d92c0
@@ -11474,29 +11474,29 @@ void Gambit_fn_021D9194(CPUState* cpu) {
         /* 021D92C8 */ rbrew_write_f32(cpu->mem, _t47, cpu->f[31]);
   L_021D92CC: ; // 0x21d92cc
         /* 021D92CC */ cpu->r[30] = cpu->r[31] + 0x000001D4u;
-        /* 021D92CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021D92D0 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D92CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021D92D0 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D92D0 */ _t49 = _t48 & 0x00000001u;
         /* 021D92D0 */ if (_t49) goto L_021D92D4; else goto L_021D92E4;
   L_021D92D4: ; // 0x21d92d4
         /* 021D92D4 */ cpu->r[3] = 0x00000018u;
         /* 021D92D8 */ Gambit_fn_02801A78(cpu);
         /* 021D92DC */ cpu->r[30] = cpu->r[3];
-        /* 021D92DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021D92E0 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D92DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021D92E0 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D92E0 */ _t51 = _t50 & 0x00000001u;
         /* 021D92E0 */ if (_t51) goto L_021D932C; else goto L_021D92E4;
   L_021D92E4: ; // 0x21d92e4
         /* 021D92E4 */ cpu->r[3] = cpu->r[30];
-        /* 021D92E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D92E8 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D92E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D92E8 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D92E8 */ _t53 = _t52 & 0x00000001u;
         /* 021D92E8 */ if (_t53) goto L_021D92EC; else goto L_021D92FC;
   L_021D92EC: ; // 0x21d92ec
         /* 021D92EC */ cpu->r[3] = 0x0000000Cu;
         /* 021D92F0 */ Gambit_fn_02801A78(cpu);
-        /* 021D92F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D92F8 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D92F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D92F8 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D92F8 */ _t55 = _t54 & 0x00000001u;
         /* 021D92F8 */ if (_t55) goto L_021D9308; else goto L_021D92FC;
   L_021D92FC: ; // 0x21d92fc
@@ -11508,15 +11508,15 @@ void Gambit_fn_021D9194(CPUState* cpu) {
         /* 021D9304 */ rbrew_write_f32(cpu->mem, _t58, cpu->f[31]);
   L_021D9308: ; // 0x21d9308
         /* 021D9308 */ cpu->r[3] = cpu->r[30] + 0x0000000Cu;
-        /* 021D9308 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D930C */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9308 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D930C */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D930C */ _t60 = _t59 & 0x00000001u;
         /* 021D930C */ if (_t60) goto L_021D9310; else goto L_021D9320;
   L_021D9310: ; // 0x21d9310
         /* 021D9310 */ cpu->r[3] = 0x0000000Cu;
         /* 021D9314 */ Gambit_fn_02801A78(cpu);
-        /* 021D9318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D931C */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D931C */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D931C */ _t62 = _t61 & 0x00000001u;
         /* 021D931C */ if (_t62) goto L_021D932C; else goto L_021D9320;
   L_021D9320: ; // 0x21d9320
@@ -11539,7 +11539,7 @@ void Gambit_fn_021D9194(CPUState* cpu) {
         /* 021D9340 */ cpu->r[31] = rbrew_read32(cpu->mem, _t68);
         /* 021D9344 */ _t69 = cpu->r[1] + 0x00000010u;
         /* 021D9344 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t69);
-        /* 021D9348 */ _t70 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D9348 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D9348 */ _t71 = _t70 & 0x00000001u;
         /* 021D9348 */ if (_t71) goto L_021D934C; // else: addr-0 trap, fall-through
   L_021D934C: ; // 0x21d934c
@@ -11566,20 +11566,20 @@ void Gambit_fn_021D9198(CPUState* cpu) {
         /* 021D91A8 */ _t3 = cpu->r[1] + 0x00000018u;
         /* 021D91A8 */ rbrew_write_f32(cpu->mem, _t3, cpu->f[31]);
         /* 021D91AC */ cpu->r[31] = cpu->r[3];
-        /* 021D91AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021D91AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021D91B0 */ _t4 = cpu->r[1] + 0x00000008u;
         /* 021D91B0 */ rbrew_write32(cpu->mem, _t4, cpu->r[30]);
         /* 021D91B4 */ _t5 = cpu->r[1] + 0x00000024u;
         /* 021D91B4 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
-        /* 021D91B8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D91B8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D91B8 */ _t7 = _t6 & 0x00000001u;
         /* 021D91B8 */ if (_t7) goto L_021D91BC; else goto L_021D91CC;
   L_021D91BC: ; // 0x21d91bc
         /* 021D91BC */ cpu->r[3] = 0x00000200u;
         /* 021D91C0 */ Gambit_fn_02801A78(cpu);
         /* 021D91C4 */ cpu->r[31] = cpu->r[3];
-        /* 021D91C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021D91C8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D91C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021D91C8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D91C8 */ _t9 = _t8 & 0x00000001u;
         /* 021D91C8 */ if (_t9) goto L_021D9334; else goto L_021D91CC;
   L_021D91CC: ; // 0x21d91cc
@@ -11598,10 +11598,10 @@ void Gambit_fn_021D9198(CPUState* cpu) {
         /* 021D91F0 */ _t13 = cpu->r[31] + 0x00000128u;
         /* 021D91F0 */ rbrew_write8(cpu->mem, _t13, (uint8_t)cpu->r[30]);
         /* 021D91F4 */ cpu->r[11] = cpu->r[31] + 0x00000130u;
-        /* 021D91F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D91F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D91F8 */ _t14 = cpu->r[31] + 0x0000012Cu;
         /* 021D91F8 */ rbrew_write_f32(cpu->mem, _t14, cpu->f[0]);
-        /* 021D91FC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D91FC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D91FC */ _t16 = _t15 & 0x00000001u;
         /* 021D91FC */ if (_t16) goto L_021D9200; else goto L_021D9208;
   L_021D9200: ; // 0x21d9200
@@ -11609,8 +11609,8 @@ void Gambit_fn_021D9198(CPUState* cpu) {
         /* 021D9204 */ Gambit_fn_02801A78(cpu);
   L_021D9208: ; // 0x21d9208
         /* 021D9208 */ cpu->r[12] = cpu->r[31] + 0x0000013Cu;
-        /* 021D9208 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D920C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D920C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D920C */ _t18 = _t17 & 0x00000001u;
         /* 021D920C */ if (_t18) goto L_021D9210; else goto L_021D9218;
   L_021D9210: ; // 0x21d9210
@@ -11618,8 +11618,8 @@ void Gambit_fn_021D9198(CPUState* cpu) {
         /* 021D9214 */ Gambit_fn_02801A78(cpu);
   L_021D9218: ; // 0x21d9218
         /* 021D9218 */ cpu->r[0] = cpu->r[31] + 0x0000016Cu;
-        /* 021D9218 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D921C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9218 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D921C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D921C */ _t20 = _t19 & 0x00000001u;
         /* 021D921C */ if (_t20) goto L_021D9220; else goto L_021D9228;
   L_021D9220: ; // 0x21d9220
@@ -11627,8 +11627,8 @@ void Gambit_fn_021D9198(CPUState* cpu) {
         /* 021D9224 */ Gambit_fn_02801A78(cpu);
   L_021D9228: ; // 0x21d9228
         /* 021D9228 */ cpu->r[0] = cpu->r[31] + 0x00000178u;
-        /* 021D9228 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D922C */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D922C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D922C */ _t22 = _t21 & 0x00000001u;
         /* 021D922C */ if (_t22) goto L_021D9230; else goto L_021D9238;
   L_021D9230: ; // 0x21d9230
@@ -11636,8 +11636,8 @@ void Gambit_fn_021D9198(CPUState* cpu) {
         /* 021D9234 */ Gambit_fn_02801A78(cpu);
   L_021D9238: ; // 0x21d9238
         /* 021D9238 */ cpu->r[11] = cpu->r[31] + 0x00000184u;
-        /* 021D9238 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021D923C */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9238 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021D923C */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D923C */ _t24 = _t23 & 0x00000001u;
         /* 021D923C */ if (_t24) goto L_021D9240; else goto L_021D9248;
   L_021D9240: ; // 0x21d9240
@@ -11658,10 +11658,10 @@ void Gambit_fn_021D9198(CPUState* cpu) {
         /* 021D9260 */ _t30 = cpu->r[0] & 0xFFFFFF3Fu;
         /* 021D9260 */ cpu->r[0] = _t30 | _t29;
         /* 021D9264 */ cpu->r[11] = cpu->r[31] + 0x000001B0u;
-        /* 021D9264 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021D9264 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021D9268 */ _t31 = cpu->r[31] + 0x0000019Cu;
         /* 021D9268 */ rbrew_write32(cpu->mem, _t31, cpu->r[0]);
-        /* 021D926C */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D926C */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D926C */ _t33 = _t32 & 0x00000001u;
         /* 021D926C */ if (_t33) goto L_021D9270; else goto L_021D9278;
   L_021D9270: ; // 0x21d9270
@@ -11669,8 +11669,8 @@ void Gambit_fn_021D9198(CPUState* cpu) {
         /* 021D9274 */ Gambit_fn_02801A78(cpu);
   L_021D9278: ; // 0x21d9278
         /* 021D9278 */ cpu->r[12] = cpu->r[31] + 0x000001BCu;
-        /* 021D9278 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021D927C */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9278 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021D927C */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D927C */ _t35 = _t34 & 0x00000001u;
         /* 021D927C */ if (_t35) goto L_021D9280; else goto L_021D9288;
   L_021D9280: ; // 0x21d9280
@@ -11679,29 +11679,29 @@ void Gambit_fn_021D9198(CPUState* cpu) {
   L_021D9288: ; // 0x21d9288
         /* 021D9288 */ cpu->r[10] = 0x10030000u;
         /* 021D928C */ cpu->r[3] = cpu->r[31] + 0x000001C8u;
-        /* 021D928C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021D928C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021D9290 */ _t36 = cpu->r[10] + 0x00001484u;
         /* 021D9290 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t36);
-        /* 021D9294 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9294 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9294 */ _t38 = _t37 & 0x00000001u;
         /* 021D9294 */ if (_t38) goto L_021D9298; else goto L_021D92A8;
   L_021D9298: ; // 0x21d9298
         /* 021D9298 */ cpu->r[3] = 0x0000000Cu;
         /* 021D929C */ Gambit_fn_02801A78(cpu);
-        /* 021D92A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D92A4 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D92A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D92A4 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D92A4 */ _t40 = _t39 & 0x00000001u;
         /* 021D92A4 */ if (_t40) goto L_021D92CC; else goto L_021D92A8;
   L_021D92A8: ; // 0x21d92a8
-        /* 021D92A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D92AC */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D92A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D92AC */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D92AC */ _t42 = _t41 & 0x00000001u;
         /* 021D92AC */ if (_t42) goto L_021D92B0; else goto L_021D92C0;
   L_021D92B0: ; // 0x21d92b0
         /* 021D92B0 */ cpu->r[3] = 0x0000000Cu;
         /* 021D92B4 */ Gambit_fn_02801A78(cpu);
-        /* 021D92B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D92BC */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D92B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D92BC */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D92BC */ _t44 = _t43 & 0x00000001u;
         /* 021D92BC */ if (_t44) goto L_021D92CC; else goto L_021D92C0;
   L_021D92C0: ; // 0x21d92c0
@@ -11713,29 +11713,29 @@ void Gambit_fn_021D9198(CPUState* cpu) {
         /* 021D92C8 */ rbrew_write_f32(cpu->mem, _t47, cpu->f[31]);
   L_021D92CC: ; // 0x21d92cc
         /* 021D92CC */ cpu->r[30] = cpu->r[31] + 0x000001D4u;
-        /* 021D92CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021D92D0 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D92CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021D92D0 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D92D0 */ _t49 = _t48 & 0x00000001u;
         /* 021D92D0 */ if (_t49) goto L_021D92D4; else goto L_021D92E4;
   L_021D92D4: ; // 0x21d92d4
         /* 021D92D4 */ cpu->r[3] = 0x00000018u;
         /* 021D92D8 */ Gambit_fn_02801A78(cpu);
         /* 021D92DC */ cpu->r[30] = cpu->r[3];
-        /* 021D92DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021D92E0 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D92DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021D92E0 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D92E0 */ _t51 = _t50 & 0x00000001u;
         /* 021D92E0 */ if (_t51) goto L_021D932C; else goto L_021D92E4;
   L_021D92E4: ; // 0x21d92e4
         /* 021D92E4 */ cpu->r[3] = cpu->r[30];
-        /* 021D92E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D92E8 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D92E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D92E8 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D92E8 */ _t53 = _t52 & 0x00000001u;
         /* 021D92E8 */ if (_t53) goto L_021D92EC; else goto L_021D92FC;
   L_021D92EC: ; // 0x21d92ec
         /* 021D92EC */ cpu->r[3] = 0x0000000Cu;
         /* 021D92F0 */ Gambit_fn_02801A78(cpu);
-        /* 021D92F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D92F8 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D92F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D92F8 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D92F8 */ _t55 = _t54 & 0x00000001u;
         /* 021D92F8 */ if (_t55) goto L_021D9308; else goto L_021D92FC;
   L_021D92FC: ; // 0x21d92fc
@@ -11747,15 +11747,15 @@ void Gambit_fn_021D9198(CPUState* cpu) {
         /* 021D9304 */ rbrew_write_f32(cpu->mem, _t58, cpu->f[31]);
   L_021D9308: ; // 0x21d9308
         /* 021D9308 */ cpu->r[3] = cpu->r[30] + 0x0000000Cu;
-        /* 021D9308 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D930C */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9308 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D930C */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D930C */ _t60 = _t59 & 0x00000001u;
         /* 021D930C */ if (_t60) goto L_021D9310; else goto L_021D9320;
   L_021D9310: ; // 0x21d9310
         /* 021D9310 */ cpu->r[3] = 0x0000000Cu;
         /* 021D9314 */ Gambit_fn_02801A78(cpu);
-        /* 021D9318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D931C */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D931C */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D931C */ _t62 = _t61 & 0x00000001u;
         /* 021D931C */ if (_t62) goto L_021D932C; else goto L_021D9320;
   L_021D9320: ; // 0x21d9320
@@ -11778,7 +11778,7 @@ void Gambit_fn_021D9198(CPUState* cpu) {
         /* 021D9340 */ cpu->r[31] = rbrew_read32(cpu->mem, _t68);
         /* 021D9344 */ _t69 = cpu->r[1] + 0x00000010u;
         /* 021D9344 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t69);
-        /* 021D9348 */ _t70 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D9348 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D9348 */ _t71 = _t70 & 0x00000001u;
         /* 021D9348 */ if (_t71) goto L_021D934C; // else: addr-0 trap, fall-through
   L_021D934C: ; // 0x21d934c
@@ -12030,8 +12030,8 @@ void Gambit_fn_021D9364(CPUState* cpu) {
         /* 021D9574 */ cpu->r[12] = rbrew_read32(cpu->mem, _t91);
         /* 021D9578 */ _t92 = cpu->r[12] + 0x000002C4u;
         /* 021D9578 */ cpu->r[0] = rbrew_read32(cpu->mem, _t92);
-        /* 021D957C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 021D9580 */ _t93 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D957C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 021D9580 */ _t93 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D9580 */ _t94 = _t93 & 0x00000001u;
         /* 021D9580 */ if (_t94) goto L_021D9584; else goto L_021D9598;
   L_021D9584: ; // 0x21d9584
@@ -12063,7 +12063,7 @@ void Gambit_fn_021D9364(CPUState* cpu) {
         /* 021D95C8 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t100);
         /* 021D95CC */ _t101 = cpu->r[1] + 0x00000090u;
         /* 021D95CC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t101);
-        /* 021D95D0 */ _t102 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D95D0 */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D95D0 */ _t103 = _t102 & 0x00000001u;
         /* 021D95D0 */ if (_t103) goto L_021D95D4; // else: addr-0 trap, fall-through
   L_021D95D4: ; // 0x21d95d4
@@ -12256,9 +12256,9 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 02055E40 */ _t2 = cpu->r[10] + 0xFFFFA660u;
         /* 02055E40 */ cpu->r[10] = rbrew_read32(cpu->mem, _t2);
         /* 02055E44 */ cpu->r[28] = cpu->r[3];
-        /* 02055E48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02055E48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02055E4C */ cpu->r[27] = 0x00000000u;
-        /* 02055E50 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02055E50 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02055E50 */ _t4 = _t3 & 0x00000001u;
         /* 02055E50 */ if (_t4) goto L_02055E6C; else goto L_02055E54;
   L_02055E54: ; // 0x2055e54
@@ -12266,8 +12266,8 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 02055E58 */ cpu->r[25] = cpu->r[25] + 0xFFFFA0F4u;
         /* 02055E5C */ _t5 = cpu->r[25] + 0x00000054u;
         /* 02055E5C */ cpu->r[7] = rbrew_read32(cpu->mem, _t5);
-        /* 02055E60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 02055E64 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02055E60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 02055E64 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02055E64 */ _t7 = _t6 & 0x00000001u;
         /* 02055E64 */ if (_t7) goto L_02055E68; else goto L_02055FC0;
   L_02055E68: ; // 0x2055e68
@@ -12297,8 +12297,8 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 02055EBC */ Gambit_fn_02C83090(cpu);
         /* 02055EC0 */ _t9 = cpu->r[25] + 0x00000054u;
         /* 02055EC0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t9);
-        /* 02055EC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 02055EC8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02055EC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 02055EC8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02055EC8 */ _t11 = _t10 & 0x00000001u;
         /* 02055EC8 */ if (_t11) goto L_02055ECC; else goto L_02055FC0;
   L_02055ECC: ; // 0x2055ecc
@@ -12314,9 +12314,9 @@ void Gambit_fn_021D9698(CPUState* cpu) {
   L_02055EF0: ; // 0x2055ef0
         /* 02055EF0 */ _t12 = cpu->r[21] + 0xFFFFE4C0u;
         /* 02055EF0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t12);
-        /* 02055EF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02055EF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02055EF8 */ cpu->r[31] = cpu->r[30];
-        /* 02055EFC */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02055EFC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02055EFC */ _t14 = _t13 & 0x00000001u;
         /* 02055EFC */ if (_t14) goto L_02055F00; else goto L_02055F18;
   L_02055F00: ; // 0x2055f00
@@ -12330,8 +12330,8 @@ void Gambit_fn_021D9698(CPUState* cpu) {
   L_02055F18: ; // 0x2055f18
         /* 02055F18 */ _t16 = cpu->r[19] + 0xFFFFE4BCu;
         /* 02055F18 */ cpu->r[10] = rbrew_read32(cpu->mem, _t16);
-        /* 02055F1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02055F20 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02055F1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02055F20 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02055F20 */ _t18 = _t17 & 0x00000001u;
         /* 02055F20 */ if (_t18) goto L_02055F24; else goto L_02055F2C;
   L_02055F24: ; // 0x2055f24
@@ -12340,8 +12340,8 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 02055F28 */ _t20 = cpu->r[19] + 0xFFFFE4BCu;
         /* 02055F28 */ rbrew_write32(cpu->mem, _t20, cpu->r[20]);
   L_02055F2C: ; // 0x2055f2c
-        /* 02055F2C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000003u);
-        /* 02055F30 */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02055F2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000003u));
+        /* 02055F30 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02055F30 */ _t22 = _t21 & 0x00000001u;
         /* 02055F30 */ if (_t22) goto L_02055F58; else goto L_02055F34;
   L_02055F34: ; // 0x2055f34
@@ -12350,12 +12350,12 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 02055F3C */ cpu->r[5] = 0x00000000u;
         /* 02055F40 */ Gambit_fn_028A6634(cpu);
         /* 02055F44 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02055F48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000003u);
-        /* 02055F4C */ _t23 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02055F48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000003u));
+        /* 02055F4C */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02055F4C */ _t24 = _t23 & 0x00000001u;
         /* 02055F4C */ if (_t24) goto L_02055FC0; else goto L_02055F50;
   L_02055F50: ; // 0x2055f50
-        /* 02055F50 */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02055F50 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02055F50 */ _t26 = _t25 & 0x00000001u;
         /* 02055F50 */ if (_t26) goto L_02055EF0; else goto L_02055F54;
   L_02055F54: ; // 0x2055f54
@@ -12363,8 +12363,8 @@ void Gambit_fn_021D9698(CPUState* cpu) {
   L_02055F58: ; // 0x2055f58
         /* 02055F58 */ _t27 = cpu->r[18] + 0xFFFFE4B8u;
         /* 02055F58 */ cpu->r[5] = rbrew_read32(cpu->mem, _t27);
-        /* 02055F5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 02055F60 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02055F5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 02055F60 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02055F60 */ _t29 = _t28 & 0x00000001u;
         /* 02055F60 */ if (_t29) goto L_02055F64; else goto L_02055F9C;
   L_02055F64: ; // 0x2055f64
@@ -12373,8 +12373,8 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 02055F6C */ Gambit_fn_02836FFC(cpu);
         /* 02055F70 */ _t30 = cpu->r[18] + 0xFFFFE4B8u;
         /* 02055F70 */ cpu->r[0] = rbrew_read32(cpu->mem, _t30);
-        /* 02055F74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02055F78 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02055F74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02055F78 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02055F78 */ _t32 = _t31 & 0x00000001u;
         /* 02055F78 */ if (_t32) goto L_02055F7C; else goto L_02055F90;
   L_02055F7C: ; // 0x2055f7c
@@ -12397,12 +12397,12 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 02055FA8 */ cpu->r[4] = cpu->r[31];
         /* 02055FAC */ Gambit_fn_028A6634(cpu);
         /* 02055FB0 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02055FB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000003u);
-        /* 02055FB8 */ _t36 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02055FB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000003u));
+        /* 02055FB8 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02055FB8 */ _t37 = _t36 & 0x00000001u;
         /* 02055FB8 */ if (_t37) goto L_02055FC0; else goto L_02055FBC;
   L_02055FBC: ; // 0x2055fbc
-        /* 02055FBC */ _t38 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02055FBC */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02055FBC */ _t39 = _t38 & 0x00000001u;
         /* 02055FBC */ if (_t39) goto L_02055EF0; else goto L_02055FC0;
   L_02055FC0: ; // 0x2055fc0
@@ -12412,9 +12412,9 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 02055FCC */ cpu->r[12] = 0x101E0000u;
         /* 02055FD0 */ _t40 = cpu->r[12] + 0xFFFFA664u;
         /* 02055FD0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t40);
-        /* 02055FD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02055FD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02055FD8 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
-        /* 02055FDC */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02055FDC */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02055FDC */ _t42 = _t41 & 0x00000001u;
         /* 02055FDC */ if (_t42) goto L_02055FF8; else goto L_02055FE0;
   L_02055FE0: ; // 0x2055fe0
@@ -12422,8 +12422,8 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 02055FE4 */ cpu->r[25] = cpu->r[25] + 0xFFFFA16Cu;
         /* 02055FE8 */ _t43 = cpu->r[25] + 0x00000054u;
         /* 02055FE8 */ cpu->r[4] = rbrew_read32(cpu->mem, _t43);
-        /* 02055FEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 02055FF0 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02055FEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 02055FF0 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02055FF0 */ _t45 = _t44 & 0x00000001u;
         /* 02055FF0 */ if (_t45) goto L_02055FF4; else goto L_0205614C;
   L_02055FF4: ; // 0x2055ff4
@@ -12453,8 +12453,8 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 02056048 */ Gambit_fn_02C83090(cpu);
         /* 0205604C */ _t47 = cpu->r[25] + 0x00000054u;
         /* 0205604C */ cpu->r[4] = rbrew_read32(cpu->mem, _t47);
-        /* 02056050 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 02056054 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056050 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 02056054 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056054 */ _t49 = _t48 & 0x00000001u;
         /* 02056054 */ if (_t49) goto L_02056058; else goto L_0205614C;
   L_02056058: ; // 0x2056058
@@ -12470,9 +12470,9 @@ void Gambit_fn_021D9698(CPUState* cpu) {
   L_0205607C: ; // 0x205607c
         /* 0205607C */ _t50 = cpu->r[21] + 0xFFFFE4D8u;
         /* 0205607C */ cpu->r[5] = rbrew_read32(cpu->mem, _t50);
-        /* 02056080 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02056080 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02056084 */ cpu->r[31] = cpu->r[30];
-        /* 02056088 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056088 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056088 */ _t52 = _t51 & 0x00000001u;
         /* 02056088 */ if (_t52) goto L_0205608C; else goto L_020560A4;
   L_0205608C: ; // 0x205608c
@@ -12486,8 +12486,8 @@ void Gambit_fn_021D9698(CPUState* cpu) {
   L_020560A4: ; // 0x20560a4
         /* 020560A4 */ _t54 = cpu->r[19] + 0xFFFFE4D4u;
         /* 020560A4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t54);
-        /* 020560A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020560AC */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020560A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020560AC */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020560AC */ _t56 = _t55 & 0x00000001u;
         /* 020560AC */ if (_t56) goto L_020560B0; else goto L_020560B8;
   L_020560B0: ; // 0x20560b0
@@ -12496,8 +12496,8 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 020560B4 */ _t58 = cpu->r[19] + 0xFFFFE4D4u;
         /* 020560B4 */ rbrew_write32(cpu->mem, _t58, cpu->r[20]);
   L_020560B8: ; // 0x20560b8
-        /* 020560B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000003u);
-        /* 020560BC */ _t59 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020560B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000003u));
+        /* 020560BC */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020560BC */ _t60 = _t59 & 0x00000001u;
         /* 020560BC */ if (_t60) goto L_020560E4; else goto L_020560C0;
   L_020560C0: ; // 0x20560c0
@@ -12506,12 +12506,12 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 020560C8 */ cpu->r[5] = 0x00000000u;
         /* 020560CC */ Gambit_fn_028A6634(cpu);
         /* 020560D0 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020560D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000003u);
-        /* 020560D8 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020560D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000003u));
+        /* 020560D8 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020560D8 */ _t62 = _t61 & 0x00000001u;
         /* 020560D8 */ if (_t62) goto L_0205614C; else goto L_020560DC;
   L_020560DC: ; // 0x20560dc
-        /* 020560DC */ _t63 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020560DC */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020560DC */ _t64 = _t63 & 0x00000001u;
         /* 020560DC */ if (_t64) goto L_0205607C; else goto L_020560E0;
   L_020560E0: ; // 0x20560e0
@@ -12519,8 +12519,8 @@ void Gambit_fn_021D9698(CPUState* cpu) {
   L_020560E4: ; // 0x20560e4
         /* 020560E4 */ _t65 = cpu->r[18] + 0xFFFFE4D0u;
         /* 020560E4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t65);
-        /* 020560E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 020560EC */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020560E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 020560EC */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020560EC */ _t67 = _t66 & 0x00000001u;
         /* 020560EC */ if (_t67) goto L_020560F0; else goto L_02056128;
   L_020560F0: ; // 0x20560f0
@@ -12529,8 +12529,8 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 020560F8 */ Gambit_fn_02836FFC(cpu);
         /* 020560FC */ _t68 = cpu->r[18] + 0xFFFFE4D0u;
         /* 020560FC */ cpu->r[0] = rbrew_read32(cpu->mem, _t68);
-        /* 02056100 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02056104 */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056100 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02056104 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056104 */ _t70 = _t69 & 0x00000001u;
         /* 02056104 */ if (_t70) goto L_02056108; else goto L_0205611C;
   L_02056108: ; // 0x2056108
@@ -12553,12 +12553,12 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 02056134 */ cpu->r[4] = cpu->r[31];
         /* 02056138 */ Gambit_fn_028A6634(cpu);
         /* 0205613C */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02056140 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000003u);
-        /* 02056144 */ _t74 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02056140 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000003u));
+        /* 02056144 */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02056144 */ _t75 = _t74 & 0x00000001u;
         /* 02056144 */ if (_t75) goto L_0205614C; else goto L_02056148;
   L_02056148: ; // 0x2056148
-        /* 02056148 */ _t76 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02056148 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02056148 */ _t77 = _t76 & 0x00000001u;
         /* 02056148 */ if (_t77) goto L_0205607C; else goto L_0205614C;
   L_0205614C: ; // 0x205614c
@@ -12568,9 +12568,9 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 02056158 */ cpu->r[11] = 0x101E0000u;
         /* 0205615C */ _t78 = cpu->r[11] + 0xFFFFA668u;
         /* 0205615C */ cpu->r[11] = rbrew_read32(cpu->mem, _t78);
-        /* 02056160 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02056160 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02056164 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
-        /* 02056168 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056168 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056168 */ _t80 = _t79 & 0x00000001u;
         /* 02056168 */ if (_t80) goto L_0205619C; else goto L_0205616C;
   L_0205616C: ; // 0x205616c
@@ -12584,9 +12584,9 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 02056184 */ cpu->r[6] = rbrew_read32(cpu->mem, _t81);
         /* 02056184 */ cpu->r[9] = _t81;
         /* 02056188 */ cpu->r[31] = cpu->r[31] + 0xFFFFA240u;
-        /* 0205618C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 0205618C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 02056190 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
-        /* 02056194 */ _t82 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056194 */ _t82 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056194 */ _t83 = _t82 & 0x00000001u;
         /* 02056194 */ if (_t83) goto L_020562D4; else goto L_02056198;
   L_02056198: ; // 0x2056198
@@ -12628,23 +12628,23 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 020561FC */ _t93 = cpu->r[12] + 0x00000000u;
         /* 020561FC */ cpu->r[4] = rbrew_read8(cpu->mem, _t93);
         /* 02056200 */ cpu->r[30] = 0x00000000u;
-        /* 02056204 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[31]);
+        /* 02056204 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[31]));
         /* 02056208 */ cpu->r[5] = 0x00080000u;
-        /* 0205620C */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0205620C */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0205620C */ _t95 = _t94 & 0x00000001u;
         /* 0205620C */ if (_t95) goto L_02056234; else goto L_02056210;
   L_02056210: ; // 0x2056210
         /* 02056210 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02056214 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[5]);
+        /* 02056214 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[5]));
         /* 02056218 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 0205621C */ _t96 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0205621C */ _t96 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0205621C */ _t97 = _t96 & 0x00000001u;
         /* 0205621C */ if (_t97) goto L_02056230; else goto L_02056220;
   L_02056220: ; // 0x2056220
         /* 02056220 */ _t98 = cpu->r[12] + 0x00000000u;
         /* 02056220 */ cpu->r[0] = rbrew_read8(cpu->mem, _t98);
-        /* 02056224 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 02056228 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056224 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 02056228 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056228 */ _t100 = _t99 & 0x00000001u;
         /* 02056228 */ if (_t100) goto L_0205622C; else goto L_02056210;
   L_0205622C: ; // 0x205622c
@@ -12656,10 +12656,10 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 02056234 */ cpu->r[9] = rbrew_read32(cpu->mem, _t101);
         /* 02056238 */ _t102 = cpu->r[1] + 0x0000000Cu;
         /* 02056238 */ cpu->r[6] = rbrew_read32(cpu->mem, _t102);
-        /* 0205623C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[9]);
+        /* 0205623C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[9]));
         /* 02056240 */ _t103 = cpu->r[6] + 0x00000014u;
         /* 02056240 */ cpu->r[7] = rbrew_read32(cpu->mem, _t103);
-        /* 02056244 */ _t104 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02056244 */ _t104 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02056244 */ _t105 = _t104 & 0x00000001u;
         /* 02056244 */ if (_t105) goto L_0205624C; else goto L_02056248;
   L_02056248: ; // 0x2056248
@@ -12707,9 +12707,9 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 020562BC */ cpu->r[9] = _t115;
         /* 020562C0 */ cpu->r[31] = 0x101E0000u;
         /* 020562C4 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
-        /* 020562C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 020562C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 020562CC */ cpu->r[31] = cpu->r[31] + 0xFFFFA240u;
-        /* 020562D0 */ _t116 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020562D0 */ _t116 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020562D0 */ _t117 = _t116 & 0x00000001u;
         /* 020562D0 */ if (_t117) goto L_020562D4; else goto L_0205631C;
   L_020562D4: ; // 0x20562d4
@@ -12735,8 +12735,8 @@ void Gambit_fn_021D9698(CPUState* cpu) {
   L_0205631C: ; // 0x205631c
         /* 0205631C */ _t119 = cpu->r[31] + 0x00000054u;
         /* 0205631C */ cpu->r[4] = rbrew_read32(cpu->mem, _t119);
-        /* 02056320 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 02056324 */ _t120 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056320 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 02056324 */ _t120 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056324 */ _t121 = _t120 & 0x00000001u;
         /* 02056324 */ if (_t121) goto L_02056328; else goto L_0205641C;
   L_02056328: ; // 0x2056328
@@ -12752,9 +12752,9 @@ void Gambit_fn_021D9698(CPUState* cpu) {
   L_0205634C: ; // 0x205634c
         /* 0205634C */ _t122 = cpu->r[22] + 0xFFFFE4ECu;
         /* 0205634C */ cpu->r[5] = rbrew_read32(cpu->mem, _t122);
-        /* 02056350 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02056350 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02056354 */ cpu->r[30] = cpu->r[27];
-        /* 02056358 */ _t123 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056358 */ _t123 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056358 */ _t124 = _t123 & 0x00000001u;
         /* 02056358 */ if (_t124) goto L_0205635C; else goto L_02056374;
   L_0205635C: ; // 0x205635c
@@ -12768,8 +12768,8 @@ void Gambit_fn_021D9698(CPUState* cpu) {
   L_02056374: ; // 0x2056374
         /* 02056374 */ _t126 = cpu->r[20] + 0xFFFFE4E8u;
         /* 02056374 */ cpu->r[6] = rbrew_read32(cpu->mem, _t126);
-        /* 02056378 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0205637C */ _t127 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056378 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0205637C */ _t127 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0205637C */ _t128 = _t127 & 0x00000001u;
         /* 0205637C */ if (_t128) goto L_02056380; else goto L_02056388;
   L_02056380: ; // 0x2056380
@@ -12778,8 +12778,8 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 02056384 */ _t130 = cpu->r[20] + 0xFFFFE4E8u;
         /* 02056384 */ rbrew_write32(cpu->mem, _t130, cpu->r[21]);
   L_02056388: ; // 0x2056388
-        /* 02056388 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], 0x00000002u);
-        /* 0205638C */ _t131 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02056388 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], 0x00000002u));
+        /* 0205638C */ _t131 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0205638C */ _t132 = _t131 & 0x00000001u;
         /* 0205638C */ if (_t132) goto L_020563B4; else goto L_02056390;
   L_02056390: ; // 0x2056390
@@ -12788,12 +12788,12 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 02056398 */ cpu->r[5] = 0x00000000u;
         /* 0205639C */ Gambit_fn_028A6634(cpu);
         /* 020563A0 */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 020563A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000002u);
-        /* 020563A8 */ _t133 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020563A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000002u));
+        /* 020563A8 */ _t133 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020563A8 */ _t134 = _t133 & 0x00000001u;
         /* 020563A8 */ if (_t134) goto L_0205641C; else goto L_020563AC;
   L_020563AC: ; // 0x20563ac
-        /* 020563AC */ _t135 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020563AC */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020563AC */ _t136 = _t135 & 0x00000001u;
         /* 020563AC */ if (_t136) goto L_0205634C; else goto L_020563B0;
   L_020563B0: ; // 0x20563b0
@@ -12801,8 +12801,8 @@ void Gambit_fn_021D9698(CPUState* cpu) {
   L_020563B4: ; // 0x20563b4
         /* 020563B4 */ _t137 = cpu->r[19] + 0xFFFFE4E4u;
         /* 020563B4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t137);
-        /* 020563B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 020563BC */ _t138 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020563B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 020563BC */ _t138 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020563BC */ _t139 = _t138 & 0x00000001u;
         /* 020563BC */ if (_t139) goto L_020563C0; else goto L_020563F8;
   L_020563C0: ; // 0x20563c0
@@ -12811,8 +12811,8 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 020563C8 */ Gambit_fn_02836FFC(cpu);
         /* 020563CC */ _t140 = cpu->r[19] + 0xFFFFE4E4u;
         /* 020563CC */ cpu->r[8] = rbrew_read32(cpu->mem, _t140);
-        /* 020563D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 020563D4 */ _t141 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020563D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 020563D4 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020563D4 */ _t142 = _t141 & 0x00000001u;
         /* 020563D4 */ if (_t142) goto L_020563D8; else goto L_020563EC;
   L_020563D8: ; // 0x20563d8
@@ -12835,12 +12835,12 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 02056404 */ cpu->r[4] = cpu->r[30];
         /* 02056408 */ Gambit_fn_028A6634(cpu);
         /* 0205640C */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 02056410 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000002u);
-        /* 02056414 */ _t146 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02056410 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000002u));
+        /* 02056414 */ _t146 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02056414 */ _t147 = _t146 & 0x00000001u;
         /* 02056414 */ if (_t147) goto L_0205641C; else goto L_02056418;
   L_02056418: ; // 0x2056418
-        /* 02056418 */ _t148 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02056418 */ _t148 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02056418 */ _t149 = _t148 & 0x00000001u;
         /* 02056418 */ if (_t149) goto L_0205634C; else goto L_0205641C;
   L_0205641C: ; // 0x205641c
@@ -12853,9 +12853,9 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 02056430 */ cpu->r[11] = rbrew_read32(cpu->mem, _t150);
         /* 02056430 */ cpu->r[7] = _t150;
         /* 02056434 */ cpu->r[31] = cpu->r[31] + 0xFFFFA2B0u;
-        /* 02056438 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02056438 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0205643C */ cpu->r[28] = cpu->r[28] + 0x00000001u;
-        /* 02056440 */ _t151 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056440 */ _t151 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056440 */ _t152 = _t151 & 0x00000001u;
         /* 02056440 */ if (_t152) goto L_02056444; else goto L_0205648C;
   L_02056444: ; // 0x2056444
@@ -12881,8 +12881,8 @@ void Gambit_fn_021D9698(CPUState* cpu) {
   L_0205648C: ; // 0x205648c
         /* 0205648C */ _t154 = cpu->r[31] + 0x00000054u;
         /* 0205648C */ cpu->r[0] = rbrew_read32(cpu->mem, _t154);
-        /* 02056490 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02056494 */ _t155 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056490 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02056494 */ _t155 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056494 */ _t156 = _t155 & 0x00000001u;
         /* 02056494 */ if (_t156) goto L_02056498; else goto L_0205658C;
   L_02056498: ; // 0x2056498
@@ -12898,9 +12898,9 @@ void Gambit_fn_021D9698(CPUState* cpu) {
   L_020564BC: ; // 0x20564bc
         /* 020564BC */ _t157 = cpu->r[22] + 0xFFFFE504u;
         /* 020564BC */ cpu->r[0] = rbrew_read32(cpu->mem, _t157);
-        /* 020564C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020564C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020564C4 */ cpu->r[30] = cpu->r[27];
-        /* 020564C8 */ _t158 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020564C8 */ _t158 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020564C8 */ _t159 = _t158 & 0x00000001u;
         /* 020564C8 */ if (_t159) goto L_020564CC; else goto L_020564E4;
   L_020564CC: ; // 0x20564cc
@@ -12914,8 +12914,8 @@ void Gambit_fn_021D9698(CPUState* cpu) {
   L_020564E4: ; // 0x20564e4
         /* 020564E4 */ _t161 = cpu->r[20] + 0xFFFFE500u;
         /* 020564E4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t161);
-        /* 020564E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020564EC */ _t162 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020564E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020564EC */ _t162 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020564EC */ _t163 = _t162 & 0x00000001u;
         /* 020564EC */ if (_t163) goto L_020564F0; else goto L_020564F8;
   L_020564F0: ; // 0x20564f0
@@ -12924,8 +12924,8 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 020564F4 */ _t165 = cpu->r[20] + 0xFFFFE500u;
         /* 020564F4 */ rbrew_write32(cpu->mem, _t165, cpu->r[21]);
   L_020564F8: ; // 0x20564f8
-        /* 020564F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000003u);
-        /* 020564FC */ _t166 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020564F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000003u));
+        /* 020564FC */ _t166 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020564FC */ _t167 = _t166 & 0x00000001u;
         /* 020564FC */ if (_t167) goto L_02056524; else goto L_02056500;
   L_02056500: ; // 0x2056500
@@ -12934,12 +12934,12 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 02056508 */ cpu->r[5] = 0x00000000u;
         /* 0205650C */ Gambit_fn_028A6634(cpu);
         /* 02056510 */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 02056514 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000003u);
-        /* 02056518 */ _t168 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02056514 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000003u));
+        /* 02056518 */ _t168 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02056518 */ _t169 = _t168 & 0x00000001u;
         /* 02056518 */ if (_t169) goto L_0205658C; else goto L_0205651C;
   L_0205651C: ; // 0x205651c
-        /* 0205651C */ _t170 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0205651C */ _t170 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0205651C */ _t171 = _t170 & 0x00000001u;
         /* 0205651C */ if (_t171) goto L_020564BC; else goto L_02056520;
   L_02056520: ; // 0x2056520
@@ -12947,8 +12947,8 @@ void Gambit_fn_021D9698(CPUState* cpu) {
   L_02056524: ; // 0x2056524
         /* 02056524 */ _t172 = cpu->r[19] + 0xFFFFE4FCu;
         /* 02056524 */ cpu->r[0] = rbrew_read32(cpu->mem, _t172);
-        /* 02056528 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0205652C */ _t173 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056528 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0205652C */ _t173 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0205652C */ _t174 = _t173 & 0x00000001u;
         /* 0205652C */ if (_t174) goto L_02056530; else goto L_02056568;
   L_02056530: ; // 0x2056530
@@ -12957,8 +12957,8 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 02056538 */ Gambit_fn_02836FFC(cpu);
         /* 0205653C */ _t175 = cpu->r[19] + 0xFFFFE4FCu;
         /* 0205653C */ cpu->r[0] = rbrew_read32(cpu->mem, _t175);
-        /* 02056540 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02056544 */ _t176 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056540 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02056544 */ _t176 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056544 */ _t177 = _t176 & 0x00000001u;
         /* 02056544 */ if (_t177) goto L_02056548; else goto L_0205655C;
   L_02056548: ; // 0x2056548
@@ -12981,12 +12981,12 @@ void Gambit_fn_021D9698(CPUState* cpu) {
         /* 02056574 */ cpu->r[4] = cpu->r[27];
         /* 02056578 */ Gambit_fn_028A6634(cpu);
         /* 0205657C */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 02056580 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000003u);
-        /* 02056584 */ _t181 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02056580 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000003u));
+        /* 02056584 */ _t181 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02056584 */ _t182 = _t181 & 0x00000001u;
         /* 02056584 */ if (_t182) goto L_0205658C; else goto L_02056588;
   L_02056588: ; // 0x2056588
-        /* 02056588 */ _t183 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02056588 */ _t183 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02056588 */ _t184 = _t183 & 0x00000001u;
         /* 02056588 */ if (_t184) goto L_020564BC; else goto L_0205658C;
   L_0205658C: ; // 0x205658c
@@ -13056,10 +13056,10 @@ void Gambit_fn_021D96A4(CPUState* cpu) {
         /* 021D970C */ cpu->f[30] = fma(cpu->f[9], cpu->f[9], cpu->f[0]);
         /* 021D9710 */ _t13 = cpu->r[7] + 0x00001484u;
         /* 021D9710 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t13);
-        /* 021D9714 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
+        /* 021D9714 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
         /* 021D9718 */ _t14 = cpu->r[1] + 0x00000014u;
         /* 021D9718 */ rbrew_write_f32(cpu->mem, _t14, cpu->f[9]);
-        /* 021D971C */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D971C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D971C */ _t16 = _t15 & 0x00000001u;
         /* 021D971C */ if (_t16) goto L_021D9720; else goto L_021D9760;
   L_021D9720: ; // 0x21d9720
@@ -13091,7 +13091,7 @@ void Gambit_fn_021D96A4(CPUState* cpu) {
         /* 021D9768 */ Gambit_fn_02043AC4(cpu);
         /* 021D976C */ cpu->r[12] = 0x101E0000u;
         /* 021D9770 */ cpu->r[10] = 0x101C0000u;
-        /* 021D9774 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
+        /* 021D9774 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
         /* 021D9778 */ _t23 = cpu->r[12] + 0xFFFF9594u;
         /* 021D9778 */ cpu->f[2] = rbrew_read_f32(cpu->mem, _t23);
         /* 021D977C */ cpu->r[11] = 0x10030000u;
@@ -13100,7 +13100,7 @@ void Gambit_fn_021D96A4(CPUState* cpu) {
         /* 021D9784 */ cpu->r[4] = cpu->r[31];
         /* 021D9788 */ _t25 = cpu->r[11] + 0x0000147Cu;
         /* 021D9788 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t25);
-        /* 021D978C */ _t26 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D978C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D978C */ _t27 = _t26 & 0x00000001u;
         /* 021D978C */ if (_t27) goto L_021D97C0; else goto L_021D9790;
   L_021D9790: ; // 0x21d9790
@@ -13148,7 +13148,7 @@ void Gambit_fn_021D96A4(CPUState* cpu) {
         /* 021D9804 */ cpu->f[29] = rbrew_read_f64(cpu->mem, _t37);
         /* 021D9808 */ _t38 = cpu->r[1] + 0x0000002Cu;
         /* 021D9808 */ cpu->r[31] = rbrew_read32(cpu->mem, _t38);
-        /* 021D980C */ _t39 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D980C */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D980C */ _t40 = _t39 & 0x00000001u;
         /* 021D980C */ if (_t40) goto L_021D9810; // else: addr-0 trap, fall-through
   L_021D9810: ; // 0x21d9810
@@ -13524,9 +13524,9 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021D9A2C */ _t38 = cpu->r[4] + 0x000002C4u;
         /* 021D9A2C */ cpu->r[31] = rbrew_read32(cpu->mem, _t38);
         /* 021D9A30 */ cpu->r[28] = cpu->r[5];
-        /* 021D9A34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021D9A34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021D9A38 */ cpu->r[27] = 0x00000000u;
-        /* 021D9A3C */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D9A3C */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D9A3C */ _t40 = _t39 & 0x00000001u;
         /* 021D9A3C */ if (_t40) goto L_021D9A40; else goto L_021DA520;
   L_021D9A40: ; // 0x21d9a40
@@ -13537,8 +13537,8 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021D9A48 */ cpu->r[4] = cpu->r[27];
         /* 021D9A4C */ Gambit_fn_0261F744(cpu);
         /* 021D9A50 */ cpu->r[30] = cpu->r[3];
-        /* 021D9A50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021D9A54 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9A50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021D9A54 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9A54 */ _t44 = _t43 & 0x00000001u;
         /* 021D9A54 */ if (_t44) goto L_021D9A68; else goto L_021D9A58;
   L_021D9A58: ; // 0x21d9a58
@@ -13546,15 +13546,15 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021D9A58 */ cpu->r[9] = rbrew_read32(cpu->mem, _t45);
         /* 021D9A5C */ _t46 = cpu->r[28] + 0x00000000u;
         /* 021D9A5C */ cpu->r[0] = rbrew_read32(cpu->mem, _t46);
-        /* 021D9A60 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[9]);
-        /* 021D9A64 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9A60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[9]));
+        /* 021D9A64 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9A64 */ _t48 = _t47 & 0x00000001u;
         /* 021D9A64 */ if (_t48) goto L_021D9B28; else goto L_021D9A68;
   L_021D9A68: ; // 0x21d9a68
         /* 021D9A68 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 021D9A68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021D9A68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021D9A6C */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 021D9A70 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9A70 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9A70 */ _t50 = _t49 & 0x00000001u;
         /* 021D9A70 */ if (_t50) goto L_021D9A74; else goto L_021D9A40;
   L_021D9A74: ; // 0x21d9a74
@@ -13635,7 +13635,7 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021D9B0C */ _t87 = cpu->r[1] + 0x000009B0u;
         /* 021D9B0C */ cpu->f[26] = rbrew_read_f64(cpu->mem, _t87);
         /* 021D9B10 */ cpu->r[3] = 0xFFFFFFFFu;
-        /* 021D9B14 */ _t88 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021D9B14 */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021D9B14 */ _t89 = _t88 & 0x00000001u;
         /* 021D9B14 */ if (_t89) goto L_021D9B18; // else: addr-0 trap, fall-through
   L_021D9B18: ; // 0x21d9b18
@@ -13706,8 +13706,8 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021D9BC8 */ cpu->r[4] = cpu->r[24];
         /* 021D9BCC */ Gambit_fn_0261F55C(cpu);
         /* 021D9BD0 */ cpu->r[22] = cpu->r[3];
-        /* 021D9BD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 021D9BD4 */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9BD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 021D9BD4 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9BD4 */ _t109 = _t108 & 0x00000001u;
         /* 021D9BD4 */ if (_t109) goto L_021D9CE8; else goto L_021D9BD8;
   L_021D9BD8: ; // 0x21d9bd8
@@ -13715,22 +13715,22 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021D9BD8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t110);
         /* 021D9BDC */ _t111 = cpu->r[28] + 0x00000000u;
         /* 021D9BDC */ cpu->r[7] = rbrew_read32(cpu->mem, _t111);
-        /* 021D9BE0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[7]);
-        /* 021D9BE4 */ _t112 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9BE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[7]));
+        /* 021D9BE4 */ _t112 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9BE4 */ _t113 = _t112 & 0x00000001u;
         /* 021D9BE4 */ if (_t113) goto L_021D9CE8; else goto L_021D9BE8;
   L_021D9BE8: ; // 0x21d9be8
         /* 021D9BE8 */ cpu->r[3] = cpu->r[22];
         /* 021D9BEC */ Gambit_fn_025C5DA4(cpu);
-        /* 021D9BF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021D9BF4 */ _t114 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9BF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021D9BF4 */ _t114 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9BF4 */ _t115 = _t114 & 0x00000001u;
         /* 021D9BF4 */ if (_t115) goto L_021D9BF8; else goto L_021D9CE8;
   L_021D9BF8: ; // 0x21d9bf8
         /* 021D9BF8 */ _t116 = cpu->r[22] + 0x00000468u;
         /* 021D9BF8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t116);
-        /* 021D9BFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D9C00 */ _t117 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D9BFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D9C00 */ _t117 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D9C00 */ _t118 = _t117 & 0x00000001u;
         /* 021D9C00 */ if (_t118) goto L_021D9CE8; else goto L_021D9C04;
   L_021D9C04: ; // 0x21d9c04
@@ -13753,10 +13753,10 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021D9C34 */ cpu->f[7] = cpu->f[9] - cpu->f[10];
         /* 021D9C38 */ cpu->f[13] = fma(cpu->f[0], cpu->f[0], cpu->f[11]);
         /* 021D9C3C */ cpu->f[31] = fma(cpu->f[7], cpu->f[7], cpu->f[13]);
-        /* 021D9C40 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[26]);
+        /* 021D9C40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[26]));
         /* 021D9C44 */ _t123 = cpu->r[1] + 0x00000074u;
         /* 021D9C44 */ rbrew_write_f32(cpu->mem, _t123, cpu->f[7]);
-        /* 021D9C48 */ _t124 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D9C48 */ _t124 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D9C48 */ _t125 = _t124 & 0x00000001u;
         /* 021D9C48 */ if (_t125) goto L_021D9C4C; else goto L_021D9C84;
   L_021D9C4C: ; // 0x21d9c4c
@@ -13780,8 +13780,8 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021D9C80 */ _t130 = cpu->r[1] + 0x00000074u;
         /* 021D9C80 */ rbrew_write_f32(cpu->mem, _t130, cpu->f[7]);
   L_021D9C84: ; // 0x21d9c84
-        /* 021D9C84 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[25]);
-        /* 021D9C88 */ _t131 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D9C84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[25]));
+        /* 021D9C88 */ _t131 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D9C88 */ _t132 = _t131 & 0x00000001u;
         /* 021D9C88 */ if (_t132) goto L_021D9CE8; else goto L_021D9C8C;
   L_021D9C8C: ; // 0x21d9c8c
@@ -13799,8 +13799,8 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021D9CB4 */ Gambit_fn_02C69350(cpu);
         /* 021D9CB8 */ cpu->f[2] = cpu->f[20];
         /* 021D9CBC */ Gambit_fn_02C89074(cpu);
-        /* 021D9CC0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[24]);
-        /* 021D9CC4 */ _t134 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D9CC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[24]));
+        /* 021D9CC4 */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D9CC4 */ _t135 = _t134 & 0x00000001u;
         /* 021D9CC4 */ if (_t135) goto L_021D9CE8; else goto L_021D9CC8;
   L_021D9CC8: ; // 0x21d9cc8
@@ -13820,9 +13820,9 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021D9CE4 */ cpu->r[16] = cpu->r[16] + 0x00000001u;
   L_021D9CE8: ; // 0x21d9ce8
         /* 021D9CE8 */ cpu->r[25] = cpu->r[25] + 0xFFFFFFFFu;
-        /* 021D9CE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 021D9CE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 021D9CEC */ cpu->r[24] = cpu->r[24] + 0x00000001u;
-        /* 021D9CF0 */ _t142 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9CF0 */ _t142 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9CF0 */ _t143 = _t142 & 0x00000001u;
         /* 021D9CF0 */ if (_t143) goto L_021D9CF4; else goto L_021D9BC0;
   L_021D9CF4: ; // 0x21d9cf4
@@ -13834,8 +13834,8 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021D9CFC */ cpu->r[7] = rbrew_read32(cpu->mem, _t146);
         /* 021D9D00 */ _t147 = cpu->r[7] + 0x00000158u;
         /* 021D9D00 */ cpu->r[0] = rbrew_read32(cpu->mem, _t147);
-        /* 021D9D04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021D9D08 */ _t148 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9D04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021D9D08 */ _t148 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9D08 */ _t149 = _t148 & 0x00000001u;
         /* 021D9D08 */ if (_t149) goto L_021D9F48; else goto L_021D9D0C;
   L_021D9D0C: ; // 0x21d9d0c
@@ -13879,20 +13879,20 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021D9D64 */ _t164 = cpu->r[1] + 0x00000034u;
         /* 021D9D64 */ rbrew_write32(cpu->mem, _t164, cpu->r[28]);
   L_021D9D68: ; // 0x21d9d68
-        /* 021D9D68 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[31]);
-        /* 021D9D6C */ _t165 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9D68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[31]));
+        /* 021D9D6C */ _t165 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9D6C */ _t166 = _t165 & 0x00000001u;
         /* 021D9D6C */ if (_t166) goto L_021D9D84; else goto L_021D9D70;
   L_021D9D70: ; // 0x21d9d70
         /* 021D9D70 */ _t167 = cpu->r[28] + 0x0000001Cu;
         /* 021D9D70 */ cpu->r[8] = rbrew_read32(cpu->mem, _t167);
-        /* 021D9D74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000002u);
-        /* 021D9D78 */ _t168 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9D74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000002u));
+        /* 021D9D78 */ _t168 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9D78 */ _t169 = _t168 & 0x00000001u;
         /* 021D9D78 */ if (_t169) goto L_021D9D84; else goto L_021D9D7C;
   L_021D9D7C: ; // 0x21d9d7c
-        /* 021D9D7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000003u);
-        /* 021D9D80 */ _t170 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9D7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000003u));
+        /* 021D9D80 */ _t170 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9D80 */ _t171 = _t170 & 0x00000001u;
         /* 021D9D80 */ if (_t171) goto L_021D9D84; else goto L_021D9D58;
   L_021D9D84: ; // 0x21d9d84
@@ -13906,8 +13906,8 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021D9D9C */ cpu->f[23] = cpu->f[28];
         /* 021D9DA0 */ cpu->r[27] = cpu->r[12] + cpu->r[0];
   L_021D9DA4: ; // 0x21d9da4
-        /* 021D9DA4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[31]);
-        /* 021D9DA8 */ _t173 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9DA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[31]));
+        /* 021D9DA8 */ _t173 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9DA8 */ _t174 = _t173 & 0x00000001u;
         /* 021D9DA8 */ if (_t174) goto L_021D9F44; else goto L_021D9DAC;
   L_021D9DAC: ; // 0x21d9dac
@@ -13964,10 +13964,10 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021D9E34 */ cpu->f[0] = cpu->f[7] - cpu->f[9];
         /* 021D9E38 */ cpu->f[11] = fma(cpu->f[6], cpu->f[6], cpu->f[10]);
         /* 021D9E3C */ cpu->f[20] = fma(cpu->f[0], cpu->f[0], cpu->f[11]);
-        /* 021D9E40 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[20], cpu->f[16]);
+        /* 021D9E40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[20], cpu->f[16]));
         /* 021D9E44 */ _t190 = cpu->r[1] + 0x00000014u;
         /* 021D9E44 */ rbrew_write_f32(cpu->mem, _t190, cpu->f[0]);
-        /* 021D9E48 */ _t191 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D9E48 */ _t191 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D9E48 */ _t192 = _t191 & 0x00000001u;
         /* 021D9E48 */ if (_t192) goto L_021D9E4C; else goto L_021D9E94;
   L_021D9E4C: ; // 0x21d9e4c
@@ -13998,8 +13998,8 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021D9E90 */ _t200 = cpu->r[1] + 0x00000014u;
         /* 021D9E90 */ rbrew_write_f32(cpu->mem, _t200, cpu->f[0]);
   L_021D9E94: ; // 0x21d9e94
-        /* 021D9E94 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[20], cpu->f[18]);
-        /* 021D9E98 */ _t201 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D9E94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[20], cpu->f[18]));
+        /* 021D9E98 */ _t201 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D9E98 */ _t202 = _t201 & 0x00000001u;
         /* 021D9E98 */ if (_t202) goto L_021D9EFC; else goto L_021D9E9C;
   L_021D9E9C: ; // 0x21d9e9c
@@ -14017,8 +14017,8 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021D9EC4 */ Gambit_fn_02C69350(cpu);
         /* 021D9EC8 */ cpu->f[2] = cpu->f[15];
         /* 021D9ECC */ Gambit_fn_02C89074(cpu);
-        /* 021D9ED0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[17]);
-        /* 021D9ED4 */ _t204 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D9ED0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[17]));
+        /* 021D9ED4 */ _t204 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D9ED4 */ _t205 = _t204 & 0x00000001u;
         /* 021D9ED4 */ if (_t205) goto L_021D9EFC; else goto L_021D9ED8;
   L_021D9ED8: ; // 0x21d9ed8
@@ -14042,8 +14042,8 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021D9F00 */ _t212 = cpu->r[9] + 0x00000004u;
         /* 021D9F00 */ cpu->r[11] = rbrew_read32(cpu->mem, _t212);
         /* 021D9F04 */ cpu->r[28] = cpu->r[11] - cpu->r[30];
-        /* 021D9F08 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[31]);
-        /* 021D9F0C */ _t213 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9F08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[31]));
+        /* 021D9F0C */ _t213 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9F0C */ _t214 = _t213 & 0x00000001u;
         /* 021D9F0C */ if (_t214) goto L_021D9F10; else goto L_021D9F1C;
   L_021D9F10: ; // 0x21d9f10
@@ -14055,13 +14055,13 @@ void Gambit_fn_021D9940(CPUState* cpu) {
   L_021D9F1C: ; // 0x21d9f1c
         /* 021D9F1C */ _t217 = cpu->r[28] + 0x0000001Cu;
         /* 021D9F1C */ cpu->r[9] = rbrew_read32(cpu->mem, _t217);
-        /* 021D9F20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000002u);
-        /* 021D9F24 */ _t218 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9F20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000002u));
+        /* 021D9F24 */ _t218 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9F24 */ _t219 = _t218 & 0x00000001u;
         /* 021D9F24 */ if (_t219) goto L_021D9F38; else goto L_021D9F28;
   L_021D9F28: ; // 0x21d9f28
-        /* 021D9F28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000003u);
-        /* 021D9F2C */ _t220 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9F28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000003u));
+        /* 021D9F2C */ _t220 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9F2C */ _t221 = _t220 & 0x00000001u;
         /* 021D9F2C */ if (_t221) goto L_021D9F30; else goto L_021D9EFC;
   L_021D9F30: ; // 0x21d9f30
@@ -14069,10 +14069,10 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021D9F30 */ rbrew_write32(cpu->mem, _t222, cpu->r[28]);
         /* 021D9F34 */ goto L_021D9DA4;
   L_021D9F38: ; // 0x21d9f38
-        /* 021D9F38 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[31]);
+        /* 021D9F38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[31]));
         /* 021D9F3C */ _t223 = cpu->r[1] + 0x00000034u;
         /* 021D9F3C */ rbrew_write32(cpu->mem, _t223, cpu->r[28]);
-        /* 021D9F40 */ _t224 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9F40 */ _t224 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9F40 */ _t225 = _t224 & 0x00000001u;
         /* 021D9F40 */ if (_t225) goto L_021D9F44; else goto L_021D9DD4;
   L_021D9F44: ; // 0x21d9f44
@@ -14097,15 +14097,15 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021D9F78 */ cpu->r[10] = rbrew_read32(cpu->mem, _t228);
         /* 021D9F7C */ _t229 = cpu->r[10] + cpu->r[22];
         /* 021D9F7C */ cpu->r[8] = rbrew_read32(cpu->mem, _t229);
-        /* 021D9F80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021D9F84 */ _t230 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9F80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021D9F84 */ _t230 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9F84 */ _t231 = _t230 & 0x00000001u;
         /* 021D9F84 */ if (_t231) goto L_021DA174; else goto L_021D9F88;
   L_021D9F88: ; // 0x21d9f88
         /* 021D9F88 */ _t232 = cpu->r[8] + 0x00000000u;
         /* 021D9F88 */ cpu->r[18] = rbrew_read32(cpu->mem, _t232);
-        /* 021D9F8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[18], 0x00000000u);
-        /* 021D9F90 */ _t233 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021D9F8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[18], 0x00000000u));
+        /* 021D9F90 */ _t233 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021D9F90 */ _t234 = _t233 & 0x00000001u;
         /* 021D9F90 */ if (_t234) goto L_021D9F94; else goto L_021DA174;
   L_021D9F94: ; // 0x21d9f94
@@ -14127,10 +14127,10 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021D9FC4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t236);
         /* 021D9FC8 */ _t237 = cpu->r[7] + 0x00000004u;
         /* 021D9FC8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t237);
-        /* 021D9FCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021D9FCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021D9FD0 */ _t238 = cpu->r[8] + cpu->r[21];
         /* 021D9FD0 */ cpu->r[17] = rbrew_read32(cpu->mem, _t238);
-        /* 021D9FD4 */ _t239 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9FD4 */ _t239 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9FD4 */ _t240 = _t239 & 0x00000001u;
         /* 021D9FD4 */ if (_t240) goto L_021D9FD8; else goto L_021D9FE8;
   L_021D9FD8: ; // 0x21d9fd8
@@ -14141,8 +14141,8 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021D9FE4 */ _t242 = cpu->r[20] + 0x00000000u;
         /* 021D9FE4 */ rbrew_write32(cpu->mem, _t242, cpu->r[12]);
   L_021D9FE8: ; // 0x21d9fe8
-        /* 021D9FE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[17], 0x00000000u);
-        /* 021D9FEC */ _t243 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021D9FE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[17], 0x00000000u));
+        /* 021D9FEC */ _t243 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021D9FEC */ _t244 = _t243 & 0x00000001u;
         /* 021D9FEC */ if (_t244) goto L_021DA160; else goto L_021D9FF0;
   L_021D9FF0: ; // 0x21d9ff0
@@ -14154,13 +14154,13 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021D9FFC */ cpu->r[4] = cpu->r[20];
         /* 021DA000 */ cpu->r[3] = cpu->r[17];
         /* 021DA004 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021DA008 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DA00C */ _t247 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA008 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DA00C */ _t247 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA00C */ _t248 = _t247 & 0x00000001u;
         /* 021DA00C */ if (_t248) goto L_021DA160; else goto L_021DA010;
   L_021DA010: ; // 0x21da010
-        /* 021DA010 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[17], 0x00000000u);
-        /* 021DA014 */ _t249 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA010 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[17], 0x00000000u));
+        /* 021DA014 */ _t249 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA014 */ _t250 = _t249 & 0x00000001u;
         /* 021DA014 */ if (_t250) goto L_021DA160; else goto L_021DA018;
   L_021DA018: ; // 0x21da018
@@ -14171,27 +14171,27 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021DA020 */ cpu->ctr = cpu->r[4];
         /* 021DA024 */ cpu->r[3] = cpu->r[17];
         /* 021DA028 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021DA02C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DA030 */ _t253 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA02C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DA030 */ _t253 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA030 */ _t254 = _t253 & 0x00000001u;
         /* 021DA030 */ if (_t254) goto L_021DA160; else goto L_021DA034;
   L_021DA034: ; // 0x21da034
         /* 021DA034 */ _t255 = cpu->r[17] + 0x000000C8u;
         /* 021DA034 */ cpu->r[0] = rbrew_read8(cpu->mem, _t255);
-        /* 021DA038 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021DA03C */ _t256 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA038 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021DA03C */ _t256 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA03C */ _t257 = _t256 & 0x00000001u;
         /* 021DA03C */ if (_t257) goto L_021DA040; else goto L_021DA160;
   L_021DA040: ; // 0x21da040
         /* 021DA040 */ _t258 = cpu->r[17] + 0x0000001Cu;
         /* 021DA040 */ cpu->r[0] = rbrew_read32(cpu->mem, _t258);
-        /* 021DA044 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021DA048 */ _t259 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA044 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021DA048 */ _t259 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA048 */ _t260 = _t259 & 0x00000001u;
         /* 021DA048 */ if (_t260) goto L_021DA054; else goto L_021DA04C;
   L_021DA04C: ; // 0x21da04c
-        /* 021DA04C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021DA050 */ _t261 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA04C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021DA050 */ _t261 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA050 */ _t262 = _t261 & 0x00000001u;
         /* 021DA050 */ if (_t262) goto L_021DA054; else goto L_021DA160;
   L_021DA054: ; // 0x21da054
@@ -14231,10 +14231,10 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021DA0A8 */ cpu->f[10] = cpu->f[0] - cpu->f[6];
         /* 021DA0AC */ cpu->f[8] = fma(cpu->f[11], cpu->f[11], cpu->f[7]);
         /* 021DA0B0 */ cpu->f[31] = fma(cpu->f[10], cpu->f[10], cpu->f[8]);
-        /* 021DA0B4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[23]);
+        /* 021DA0B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[23]));
         /* 021DA0B8 */ _t275 = cpu->r[1] + 0x00000020u;
         /* 021DA0B8 */ rbrew_write_f32(cpu->mem, _t275, cpu->f[10]);
-        /* 021DA0BC */ _t276 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DA0BC */ _t276 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DA0BC */ _t277 = _t276 & 0x00000001u;
         /* 021DA0BC */ if (_t277) goto L_021DA0C0; else goto L_021DA0F8;
   L_021DA0C0: ; // 0x21da0c0
@@ -14258,8 +14258,8 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021DA0F4 */ _t282 = cpu->r[1] + 0x00000020u;
         /* 021DA0F4 */ rbrew_write_f32(cpu->mem, _t282, cpu->f[10]);
   L_021DA0F8: ; // 0x21da0f8
-        /* 021DA0F8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[21]);
-        /* 021DA0FC */ _t283 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DA0F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[21]));
+        /* 021DA0FC */ _t283 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DA0FC */ _t284 = _t283 & 0x00000001u;
         /* 021DA0FC */ if (_t284) goto L_021DA160; else goto L_021DA100;
   L_021DA100: ; // 0x21da100
@@ -14277,8 +14277,8 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021DA128 */ Gambit_fn_02C69350(cpu);
         /* 021DA12C */ cpu->f[2] = cpu->f[18];
         /* 021DA130 */ Gambit_fn_02C89074(cpu);
-        /* 021DA134 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[22]);
-        /* 021DA138 */ _t286 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DA134 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[22]));
+        /* 021DA138 */ _t286 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DA138 */ _t287 = _t286 & 0x00000001u;
         /* 021DA138 */ if (_t287) goto L_021DA160; else goto L_021DA13C;
   L_021DA13C: ; // 0x21da13c
@@ -14299,9 +14299,9 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021DA15C */ cpu->r[30] = cpu->r[30] + 0x00000018u;
   L_021DA160: ; // 0x21da160
         /* 021DA160 */ cpu->r[18] = cpu->r[18] + 0xFFFFFFFFu;
-        /* 021DA160 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[18], 0x00000000u);
+        /* 021DA160 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[18], 0x00000000u));
         /* 021DA164 */ cpu->r[21] = cpu->r[21] + 0x00000004u;
-        /* 021DA168 */ _t294 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA168 */ _t294 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA168 */ _t295 = _t294 & 0x00000001u;
         /* 021DA168 */ if (_t295) goto L_021DA174; else goto L_021DA16C;
   L_021DA16C: ; // 0x21da16c
@@ -14310,33 +14310,33 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021DA170 */ goto L_021D9FC0;
   L_021DA174: ; // 0x21da174
         /* 021DA174 */ cpu->r[15] = cpu->r[15] + 0xFFFFFFFFu;
-        /* 021DA174 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[15], 0x00000000u);
+        /* 021DA174 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[15], 0x00000000u));
         /* 021DA178 */ cpu->r[22] = cpu->r[22] + 0x00000004u;
-        /* 021DA17C */ _t297 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA17C */ _t297 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA17C */ _t298 = _t297 & 0x00000001u;
         /* 021DA17C */ if (_t298) goto L_021DA180; else goto L_021D9F78;
   L_021DA180: ; // 0x21da180
-        /* 021DA180 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[16], 0x00000000u);
-        /* 021DA184 */ _t299 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA180 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[16], 0x00000000u));
+        /* 021DA184 */ _t299 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA184 */ _t300 = _t299 & 0x00000001u;
         /* 021DA184 */ if (_t300) goto L_021DA520; else goto L_021DA188;
   L_021DA188: ; // 0x21da188
-        /* 021DA188 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[16], 0x00000001u);
-        /* 021DA18C */ _t301 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA188 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[16], 0x00000001u));
+        /* 021DA18C */ _t301 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA18C */ _t302 = _t301 & 0x00000001u;
         /* 021DA18C */ if (_t302) goto L_021DA190; else goto L_021DA3F8;
   L_021DA190: ; // 0x21da190
         /* 021DA190 */ _t303 = cpu->r[1] + 0x000000E0u;
         /* 021DA190 */ cpu->r[4] = rbrew_read32(cpu->mem, _t303);
-        /* 021DA194 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 021DA198 */ _t304 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DA194 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 021DA198 */ _t304 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DA198 */ _t305 = _t304 & 0x00000001u;
         /* 021DA198 */ if (_t305) goto L_021DA250; else goto L_021DA19C;
   L_021DA19C: ; // 0x21da19c
         /* 021DA19C */ cpu->r[3] = cpu->r[1] + 0x00000048u;
         /* 021DA1A0 */ Gambit_fn_021D9820(cpu);
-        /* 021DA1A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DA1A8 */ _t306 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA1A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DA1A8 */ _t306 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA1A8 */ _t307 = _t306 & 0x00000001u;
         /* 021DA1A8 */ if (_t307) goto L_021DA1AC; else goto L_021DA520;
   L_021DA1AC: ; // 0x21da1ac
@@ -14411,7 +14411,7 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021DA234 */ cpu->f[23] = rbrew_read_f64(cpu->mem, _t341);
         /* 021DA238 */ _t342 = cpu->r[1] + 0x000009B0u;
         /* 021DA238 */ cpu->f[26] = rbrew_read_f64(cpu->mem, _t342);
-        /* 021DA23C */ _t343 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DA23C */ _t343 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DA23C */ _t344 = _t343 & 0x00000001u;
         /* 021DA23C */ if (_t344) goto L_021DA240; // else: addr-0 trap, fall-through
   L_021DA240: ; // 0x21da240
@@ -14423,16 +14423,16 @@ void Gambit_fn_021D9940(CPUState* cpu) {
   L_021DA250: ; // 0x21da250
         /* 021DA250 */ _t346 = cpu->r[1] + 0x000000E4u;
         /* 021DA250 */ cpu->r[4] = rbrew_read32(cpu->mem, _t346);
-        /* 021DA254 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 021DA258 */ _t347 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA254 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 021DA258 */ _t347 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA258 */ _t348 = _t347 & 0x00000001u;
         /* 021DA258 */ if (_t348) goto L_021DA328; else goto L_021DA25C;
   L_021DA25C: ; // 0x21da25c
         /* 021DA25C */ cpu->r[3] = cpu->r[1] + 0x00000048u;
         /* 021DA260 */ cpu->r[31] = 0x00000000u;
         /* 021DA264 */ Gambit_fn_021D9870(cpu);
-        /* 021DA268 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DA26C */ _t349 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA268 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DA26C */ _t349 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA26C */ _t350 = _t349 & 0x00000001u;
         /* 021DA26C */ if (_t350) goto L_021DA270; else goto L_021DA274;
   L_021DA270: ; // 0x21da270
@@ -14516,7 +14516,7 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021DA30C */ _t388 = cpu->r[1] + 0x000009B0u;
         /* 021DA30C */ cpu->f[26] = rbrew_read_f64(cpu->mem, _t388);
         /* 021DA310 */ cpu->r[3] = 0xFFFFFFFFu;
-        /* 021DA314 */ _t389 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DA314 */ _t389 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DA314 */ _t390 = _t389 & 0x00000001u;
         /* 021DA314 */ if (_t390) goto L_021DA318; // else: addr-0 trap, fall-through
   L_021DA318: ; // 0x21da318
@@ -14531,8 +14531,8 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021DA32C */ cpu->r[3] = cpu->r[1] + 0x00000048u;
         /* 021DA330 */ cpu->r[31] = 0x00000000u;
         /* 021DA334 */ Gambit_fn_021D98E0(cpu);
-        /* 021DA338 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DA33C */ _t393 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA338 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DA33C */ _t393 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA33C */ _t394 = _t393 & 0x00000001u;
         /* 021DA33C */ if (_t394) goto L_021DA340; else goto L_021DA344;
   L_021DA340: ; // 0x21da340
@@ -14616,7 +14616,7 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021DA3DC */ _t432 = cpu->r[1] + 0x000009B0u;
         /* 021DA3DC */ cpu->f[26] = rbrew_read_f64(cpu->mem, _t432);
         /* 021DA3E0 */ cpu->r[3] = 0xFFFFFFFFu;
-        /* 021DA3E4 */ _t433 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DA3E4 */ _t433 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DA3E4 */ _t434 = _t433 & 0x00000001u;
         /* 021DA3E4 */ if (_t434) goto L_021DA3E8; // else: addr-0 trap, fall-through
   L_021DA3E8: ; // 0x21da3e8
@@ -14640,13 +14640,13 @@ void Gambit_fn_021D9940(CPUState* cpu) {
   L_021DA418: ; // 0x21da418
         /* 021DA418 */ cpu->r[27] = 0x00000000u;
         /* 021DA41C */ cpu->r[12] = cpu->r[16];
-        /* 021DA41C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021DA41C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021DA420 */ cpu->f[10] = cpu->f[29];
         /* 021DA424 */ cpu->r[31] = 0xFFFFFFFFu;
         /* 021DA428 */ cpu->r[9] = cpu->r[27];
         /* 021DA42C */ cpu->r[28] = cpu->r[27];
         /* 021DA430 */ cpu->r[26] = cpu->r[31];
-        /* 021DA434 */ _t439 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DA434 */ _t439 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DA434 */ _t440 = _t439 & 0x00000001u;
         /* 021DA434 */ if (_t440) goto L_021DA438; else goto L_021DA5D4;
   L_021DA438: ; // 0x21da438
@@ -14658,26 +14658,26 @@ void Gambit_fn_021D9940(CPUState* cpu) {
   L_021DA44C: ; // 0x21da44c
         /* 021DA44C */ _t441 = cpu->r[11] + 0x0000002Cu;
         /* 021DA44C */ cpu->r[4] = rbrew_read8(cpu->mem, _t441);
-        /* 021DA450 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 021DA450 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 021DA454 */ cpu->r[11] = cpu->r[11] + 0x00000018u;
-        /* 021DA458 */ _t442 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA458 */ _t442 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA458 */ _t443 = _t442 & 0x00000001u;
         /* 021DA458 */ if (_t443) goto L_021DA45C; else goto L_021DA494;
   L_021DA45C: ; // 0x21da45c
         /* 021DA45C */ _t444 = cpu->r[11] + 0x00000004u;
         /* 021DA45C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t444);
-        /* 021DA460 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[8]);
+        /* 021DA460 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[8]));
         /* 021DA464 */ cpu->f[12] = cpu->f[13] / cpu->f[28];
         /* 021DA468 */ cpu->f[0] = fma(cpu->f[12], cpu->f[11], cpu->f[9]);
         /* 021DA46C */ _t445 = cpu->r[11] + 0x00000000u;
         /* 021DA46C */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t445);
         /* 021DA470 */ cpu->f[12] = cpu->f[6] * cpu->f[0];
-        /* 021DA474 */ _t446 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DA474 */ _t446 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DA474 */ _t447 = _t446 & 0x00000001u;
         /* 021DA474 */ if (_t447) goto L_021DA480; else goto L_021DA478;
   L_021DA478: ; // 0x21da478
-        /* 021DA478 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[12]);
-        /* 021DA47C */ _t448 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DA478 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[12]));
+        /* 021DA47C */ _t448 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DA47C */ _t449 = _t448 & 0x00000001u;
         /* 021DA47C */ if (_t449) goto L_021DA480; else goto L_021DA494;
   L_021DA480: ; // 0x21da480
@@ -14697,52 +14697,52 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021DA498 */ _t455 = _t454 & 0x00000001u;
         /* 021DA498 */ if (_t455) goto L_021DA44C; else goto L_021DA49C;
   L_021DA49C: ; // 0x21da49c
-        /* 021DA49C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021DA4A0 */ _t456 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DA49C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021DA4A0 */ _t456 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DA4A0 */ _t457 = _t456 & 0x00000001u;
         /* 021DA4A0 */ if (_t457) goto L_021DA4B8; else goto L_021DA4A4;
   L_021DA4A4: ; // 0x21da4a4
         /* 021DA4A4 */ cpu->r[3] = cpu->r[1] + 0x00000048u;
         /* 021DA4A8 */ cpu->r[4] = cpu->r[31];
         /* 021DA4AC */ Gambit_fn_021D9820(cpu);
-        /* 021DA4B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DA4B4 */ _t458 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA4B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DA4B4 */ _t458 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA4B4 */ _t459 = _t458 & 0x00000001u;
         /* 021DA4B4 */ if (_t459) goto L_021DA4B8; else goto L_021DA4F0;
   L_021DA4B8: ; // 0x21da4b8
-        /* 021DA4B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 021DA4BC */ _t460 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA4B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 021DA4BC */ _t460 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA4BC */ _t461 = _t460 & 0x00000001u;
         /* 021DA4BC */ if (_t461) goto L_021DA4D4; else goto L_021DA4C0;
   L_021DA4C0: ; // 0x21da4c0
         /* 021DA4C0 */ cpu->r[3] = cpu->r[1] + 0x00000048u;
         /* 021DA4C4 */ cpu->r[4] = cpu->r[27];
         /* 021DA4C8 */ Gambit_fn_021D9870(cpu);
-        /* 021DA4CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DA4D0 */ _t462 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA4CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DA4D0 */ _t462 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA4D0 */ _t463 = _t462 & 0x00000001u;
         /* 021DA4D0 */ if (_t463) goto L_021DA4D4; else goto L_021DA4F0;
   L_021DA4D4: ; // 0x21da4d4
-        /* 021DA4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021DA4D8 */ _t464 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021DA4D8 */ _t464 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA4D8 */ _t465 = _t464 & 0x00000001u;
         /* 021DA4D8 */ if (_t465) goto L_021DA5D4; else goto L_021DA4DC;
   L_021DA4DC: ; // 0x21da4dc
         /* 021DA4DC */ cpu->r[3] = cpu->r[1] + 0x00000048u;
         /* 021DA4E0 */ cpu->r[4] = cpu->r[28];
         /* 021DA4E4 */ Gambit_fn_021D98E0(cpu);
-        /* 021DA4E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DA4EC */ _t466 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA4E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DA4EC */ _t466 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA4EC */ _t467 = _t466 & 0x00000001u;
         /* 021DA4EC */ if (_t467) goto L_021DA5D4; else goto L_021DA4F0;
   L_021DA4F0: ; // 0x21da4f0
         /* 021DA4F0 */ cpu->r[11] = (uint32_t)((int32_t)cpu->r[26] * (int32_t)0x00000018u);
         /* 021DA4F4 */ cpu->r[12] = cpu->r[30] + cpu->r[11];
         /* 021DA4F8 */ cpu->r[0] = cpu->r[16];
-        /* 021DA4F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021DA4F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021DA4FC */ _t468 = cpu->r[12] + 0x00000014u;
         /* 021DA4FC */ rbrew_write8(cpu->mem, _t468, (uint8_t)cpu->r[29]);
-        /* 021DA500 */ _t469 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DA500 */ _t469 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DA500 */ _t470 = _t469 & 0x00000001u;
         /* 021DA500 */ if (_t470) goto L_021DA504; else goto L_021DA520;
   L_021DA504: ; // 0x21da504
@@ -14751,8 +14751,8 @@ void Gambit_fn_021D9940(CPUState* cpu) {
   L_021DA50C: ; // 0x21da50c
         /* 021DA50C */ _t471 = cpu->r[8] + 0x00000000u;
         /* 021DA50C */ cpu->r[5] = rbrew_read8(cpu->mem, _t471);
-        /* 021DA510 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 021DA514 */ _t472 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA510 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 021DA514 */ _t472 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA514 */ _t473 = _t472 & 0x00000001u;
         /* 021DA514 */ if (_t473) goto L_021DA418; else goto L_021DA518;
   L_021DA518: ; // 0x21da518
@@ -14840,7 +14840,7 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021DA5B8 */ _t513 = cpu->r[1] + 0x000009B0u;
         /* 021DA5B8 */ cpu->f[26] = rbrew_read_f64(cpu->mem, _t513);
         /* 021DA5BC */ cpu->r[3] = 0xFFFFFFFFu;
-        /* 021DA5C0 */ _t514 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DA5C0 */ _t514 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DA5C0 */ _t515 = _t514 & 0x00000001u;
         /* 021DA5C0 */ if (_t515) goto L_021DA5C4; // else: addr-0 trap, fall-through
   L_021DA5C4: ; // 0x21da5c4
@@ -14926,7 +14926,7 @@ void Gambit_fn_021D9940(CPUState* cpu) {
         /* 021DA668 */ cpu->f[22] = rbrew_read_f64(cpu->mem, _t552);
         /* 021DA66C */ _t553 = cpu->r[1] + 0x000009A0u;
         /* 021DA66C */ cpu->f[25] = rbrew_read_f64(cpu->mem, _t553);
-        /* 021DA670 */ _t554 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DA670 */ _t554 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DA670 */ _t555 = _t554 & 0x00000001u;
         /* 021DA670 */ if (_t555) goto L_021DA674; // else: addr-0 trap, fall-through
   L_021DA674: ; // 0x21da674
@@ -14957,16 +14957,16 @@ void Gambit_fn_021DA684(CPUState* cpu) {
         /* 021DA6A0 */ cpu->r[30] = cpu->r[3];
         /* 021DA6A4 */ _t4 = cpu->r[30] + 0x00000054u;
         /* 021DA6A4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
-        /* 021DA6A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[4]);
+        /* 021DA6A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[4]));
         /* 021DA6AC */ cpu->r[31] = cpu->r[6];
-        /* 021DA6B0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA6B0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA6B0 */ _t6 = _t5 & 0x00000001u;
         /* 021DA6B0 */ if (_t6) goto L_021DA6B4; else goto L_021DA6C0;
   L_021DA6B4: ; // 0x21da6b4
         /* 021DA6B4 */ _t7 = cpu->r[30] + 0x0000019Eu;
         /* 021DA6B4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
-        /* 021DA6B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[5]);
-        /* 021DA6BC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA6B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[5]));
+        /* 021DA6BC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA6BC */ _t9 = _t8 & 0x00000001u;
         /* 021DA6BC */ if (_t9) goto L_021DA6E4; else goto L_021DA6C0;
   L_021DA6C0: ; // 0x21da6c0
@@ -14976,7 +14976,7 @@ void Gambit_fn_021DA684(CPUState* cpu) {
         /* 021DA6C8 */ _t11 = cpu->r[1] + 0x00000090u;
         /* 021DA6C8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t11);
         /* 021DA6CC */ cpu->r[3] = 0x00000000u;
-        /* 021DA6D0 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DA6D0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DA6D0 */ _t13 = _t12 & 0x00000001u;
         /* 021DA6D0 */ if (_t13) goto L_021DA6D4; // else: addr-0 trap, fall-through
   L_021DA6D4: ; // 0x21da6d4
@@ -15006,9 +15006,9 @@ void Gambit_fn_021DA684(CPUState* cpu) {
         /* 021DA710 */ cpu->r[9] = cpu->r[28] + cpu->r[11];
         /* 021DA714 */ _t21 = cpu->r[9] + 0x00000104u;
         /* 021DA714 */ cpu->r[4] = rbrew_read8(cpu->mem, _t21);
-        /* 021DA718 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 021DA718 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 021DA71C */ cpu->r[27] = cpu->r[3];
-        /* 021DA720 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA720 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA720 */ _t23 = _t22 & 0x00000001u;
         /* 021DA720 */ if (_t23) goto L_021DA850; else goto L_021DA724;
   L_021DA724: ; // 0x21da724
@@ -15019,8 +15019,8 @@ void Gambit_fn_021DA684(CPUState* cpu) {
         /* 021DA734 */ cpu->r[3] = cpu->r[28];
         /* 021DA738 */ Gambit_fn_021F000C(cpu);
         /* 021DA73C */ cpu->r[28] = cpu->r[3];
-        /* 021DA73C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021DA740 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA73C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021DA740 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA740 */ _t25 = _t24 & 0x00000001u;
         /* 021DA740 */ if (_t25) goto L_021DA850; else goto L_021DA744;
   L_021DA744: ; // 0x21da744
@@ -15081,14 +15081,14 @@ void Gambit_fn_021DA684(CPUState* cpu) {
         /* 021DA7CC */ rbrew_write_f32(cpu->mem, _t45, cpu->f[13]);
         /* 021DA7D0 */ _t46 = cpu->r[5] + 0x00000000u;
         /* 021DA7D0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t46);
-        /* 021DA7D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 021DA7D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 021DA7D8 */ _t47 = cpu->r[1] + 0x00000030u;
         /* 021DA7D8 */ rbrew_write_f32(cpu->mem, _t47, cpu->f[31]);
         /* 021DA7DC */ cpu->r[3] = cpu->r[28];
         /* 021DA7E0 */ cpu->r[7] = cpu->r[27];
         /* 021DA7E4 */ _t48 = cpu->r[1] + 0x00000064u;
         /* 021DA7E4 */ rbrew_write_f32(cpu->mem, _t48, cpu->f[13]);
-        /* 021DA7E8 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA7E8 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA7E8 */ _t50 = _t49 & 0x00000001u;
         /* 021DA7E8 */ if (_t50) goto L_021DA824; else goto L_021DA7EC;
   L_021DA7EC: ; // 0x21da7ec
@@ -15110,8 +15110,8 @@ void Gambit_fn_021DA684(CPUState* cpu) {
         /* 021DA810 */ _t57 = cpu->r[1] + 0x00000008u;
         /* 021DA810 */ rbrew_write32(cpu->mem, _t57, cpu->r[0]);
         /* 021DA814 */ Gambit_fn_021C777C(cpu);
-        /* 021DA818 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021DA81C */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA818 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021DA81C */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA81C */ _t59 = _t58 & 0x00000001u;
         /* 021DA81C */ if (_t59) goto L_021DA87C; else goto L_021DA820;
   L_021DA820: ; // 0x21da820
@@ -15136,8 +15136,8 @@ void Gambit_fn_021DA684(CPUState* cpu) {
         /* 021DA848 */ rbrew_write32(cpu->mem, _t66, cpu->r[12]);
         /* 021DA84C */ Gambit_fn_021C7BD0(cpu);
   L_021DA850: ; // 0x21da850
-        /* 021DA850 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021DA854 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA850 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021DA854 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA854 */ _t68 = _t67 & 0x00000001u;
         /* 021DA854 */ if (_t68) goto L_021DA87C; else goto L_021DA858;
   L_021DA858: ; // 0x21da858
@@ -15160,7 +15160,7 @@ void Gambit_fn_021DA684(CPUState* cpu) {
         /* 021DA88C */ _t71 = cpu->r[1] + 0x00000090u;
         /* 021DA88C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t71);
         /* 021DA890 */ cpu->r[3] = 0x00000001u;
-        /* 021DA894 */ _t72 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DA894 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DA894 */ _t73 = _t72 & 0x00000001u;
         /* 021DA894 */ if (_t73) goto L_021DA898; // else: addr-0 trap, fall-through
   L_021DA898: ; // 0x21da898
@@ -15198,13 +15198,13 @@ void Gambit_fn_021DA8A8(CPUState* cpu) {
         /* 021DA8D4 */ _t7 = cpu->r[1] + 0x00000008u;
         /* 021DA8D4 */ rbrew_write32(cpu->mem, _t7, cpu->r[0]);
         /* 021DA8D8 */ Gambit_fn_021BD3E0(cpu);
-        /* 021DA8DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DA8E0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA8DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DA8E0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA8E0 */ _t9 = _t8 & 0x00000001u;
         /* 021DA8E0 */ if (_t9) goto L_021DA924; else goto L_021DA8E4;
   L_021DA8E4: ; // 0x21da8e4
-        /* 021DA8E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021DA8E8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA8E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021DA8E8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA8E8 */ _t11 = _t10 & 0x00000001u;
         /* 021DA8E8 */ if (_t11) goto L_021DA924; else goto L_021DA8EC;
   L_021DA8EC: ; // 0x21da8ec
@@ -15212,8 +15212,8 @@ void Gambit_fn_021DA8A8(CPUState* cpu) {
         /* 021DA8EC */ cpu->r[9] = rbrew_read32(cpu->mem, _t12);
         /* 021DA8F0 */ cpu->r[10] = rbrew_rlwinm(cpu->r[9], 0x0000001Au, 0x00000000u, 0x00000005u);
         /* 021DA8F4 */ /* nop */
-        /* 021DA8F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 021DA8FC */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DA8F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 021DA8FC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DA8FC */ _t14 = _t13 & 0x00000001u;
         /* 021DA8FC */ if (_t14) goto L_021DA900; else goto L_021DA924;
   L_021DA900: ; // 0x21da900
@@ -15269,13 +15269,13 @@ void Gambit_fn_021DA8AC(CPUState* cpu) {
         /* 021DA8D4 */ _t7 = cpu->r[1] + 0x00000008u;
         /* 021DA8D4 */ rbrew_write32(cpu->mem, _t7, cpu->r[0]);
         /* 021DA8D8 */ Gambit_fn_021BD3E0(cpu);
-        /* 021DA8DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DA8E0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA8DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DA8E0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA8E0 */ _t9 = _t8 & 0x00000001u;
         /* 021DA8E0 */ if (_t9) goto L_021DA924; else goto L_021DA8E4;
   L_021DA8E4: ; // 0x21da8e4
-        /* 021DA8E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021DA8E8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DA8E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021DA8E8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DA8E8 */ _t11 = _t10 & 0x00000001u;
         /* 021DA8E8 */ if (_t11) goto L_021DA924; else goto L_021DA8EC;
   L_021DA8EC: ; // 0x21da8ec
@@ -15283,8 +15283,8 @@ void Gambit_fn_021DA8AC(CPUState* cpu) {
         /* 021DA8EC */ cpu->r[9] = rbrew_read32(cpu->mem, _t12);
         /* 021DA8F0 */ cpu->r[10] = rbrew_rlwinm(cpu->r[9], 0x0000001Au, 0x00000000u, 0x00000005u);
         /* 021DA8F4 */ /* nop */
-        /* 021DA8F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 021DA8FC */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DA8F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 021DA8FC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DA8FC */ _t14 = _t13 & 0x00000001u;
         /* 021DA8FC */ if (_t14) goto L_021DA900; else goto L_021DA924;
   L_021DA900: ; // 0x21da900
@@ -15488,9 +15488,9 @@ void Gambit_fn_021DA9DC(CPUState* cpu) {
         /* 021DAA38 */ _t12 = cpu->r[1] + 0x00000010u;
         /* 021DAA38 */ rbrew_write32(cpu->mem, _t12, cpu->r[30]);
         /* 021DAA3C */ Gambit_fn_02022278(cpu);
-        /* 021DAA40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021DAA40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021DAA44 */ cpu->r[28] = cpu->r[3];
-        /* 021DAA48 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DAA48 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DAA48 */ _t14 = _t13 & 0x00000001u;
         /* 021DAA48 */ if (_t14) goto L_021DAA4C; else goto L_021DAA68;
   L_021DAA4C: ; // 0x21daa4c
@@ -15649,9 +15649,9 @@ void Gambit_fn_021DA9E0(CPUState* cpu) {
         /* 021DAA38 */ _t12 = cpu->r[1] + 0x00000010u;
         /* 021DAA38 */ rbrew_write32(cpu->mem, _t12, cpu->r[30]);
         /* 021DAA3C */ Gambit_fn_02022278(cpu);
-        /* 021DAA40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021DAA40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021DAA44 */ cpu->r[28] = cpu->r[3];
-        /* 021DAA48 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DAA48 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DAA48 */ _t14 = _t13 & 0x00000001u;
         /* 021DAA48 */ if (_t14) goto L_021DAA4C; else goto L_021DAA68;
   L_021DAA4C: ; // 0x21daa4c
@@ -15824,11 +15824,11 @@ void Gambit_fn_021DAB7C(CPUState* cpu) {
         /* 021DABF8 */ cpu->f[7] = fma(cpu->f[0], cpu->f[0], cpu->f[8]);
         /* 021DABFC */ _t16 = cpu->r[10] + 0x00001528u;
         /* 021DABFC */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t16);
-        /* 021DAC00 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[29]);
+        /* 021DAC00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[29]));
         /* 021DAC04 */ _t17 = cpu->r[1] + 0x00000010u;
         /* 021DAC04 */ rbrew_write_f32(cpu->mem, _t17, cpu->f[0]);
         /* 021DAC08 */ cpu->r[30] = cpu->r[4];
-        /* 021DAC0C */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DAC0C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DAC0C */ _t19 = _t18 & 0x00000001u;
         /* 021DAC0C */ if (_t19) goto L_021DAC10; else goto L_021DAC40;
   L_021DAC10: ; // 0x21dac10
@@ -15852,10 +15852,10 @@ void Gambit_fn_021DAB7C(CPUState* cpu) {
         /* 021DAC40 */ cpu->r[11] = 0x10030000u;
         /* 021DAC44 */ _t24 = cpu->r[11] + 0x0000155Cu;
         /* 021DAC44 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t24);
-        /* 021DAC48 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[0]);
+        /* 021DAC48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[0]));
         /* 021DAC4C */ _t25 = cpu->r[30] + 0x00000000u;
         /* 021DAC4C */ rbrew_write_f32(cpu->mem, _t25, cpu->f[7]);
-        /* 021DAC50 */ _t26 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DAC50 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DAC50 */ _t27 = _t26 & 0x00000001u;
         /* 021DAC50 */ if (_t27) goto L_021DADC0; else goto L_021DAC54;
   L_021DAC54: ; // 0x21dac54
@@ -15886,8 +15886,8 @@ void Gambit_fn_021DAB7C(CPUState* cpu) {
         /* 021DAC88 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t38);
         /* 021DAC8C */ cpu->f[11] = fma(cpu->f[8], cpu->f[8], cpu->f[9]);
         /* 021DAC90 */ cpu->f[13] = fma(cpu->f[12], cpu->f[12], cpu->f[11]);
-        /* 021DAC94 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[29]);
-        /* 021DAC98 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DAC94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[29]));
+        /* 021DAC98 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DAC98 */ _t40 = _t39 & 0x00000001u;
         /* 021DAC98 */ if (_t40) goto L_021DAD50; else goto L_021DAC9C;
   L_021DAC9C: ; // 0x21dac9c
@@ -15909,8 +15909,8 @@ void Gambit_fn_021DAB7C(CPUState* cpu) {
         /* 021DACD4 */ cpu->r[9] = 0x10030000u;
         /* 021DACD8 */ _t42 = cpu->r[9] + 0x00001560u;
         /* 021DACD8 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t42);
-        /* 021DACDC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[12]);
-        /* 021DACE0 */ _t43 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DACDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[12]));
+        /* 021DACE0 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DACE0 */ _t44 = _t43 & 0x00000001u;
         /* 021DACE0 */ if (_t44) goto L_021DADC0; else goto L_021DACE4;
   L_021DACE4: ; // 0x21dace4
@@ -15957,7 +15957,7 @@ void Gambit_fn_021DAB7C(CPUState* cpu) {
         /* 021DAD34 */ _t65 = cpu->r[1] + 0x00000030u;
         /* 021DAD34 */ cpu->r[30] = rbrew_read32(cpu->mem, _t65);
         /* 021DAD38 */ cpu->r[3] = 0x00000001u;
-        /* 021DAD3C */ _t66 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DAD3C */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DAD3C */ _t67 = _t66 & 0x00000001u;
         /* 021DAD3C */ if (_t67) goto L_021DAD40; // else: addr-0 trap, fall-through
   L_021DAD40: ; // 0x21dad40
@@ -15999,8 +15999,8 @@ void Gambit_fn_021DAB7C(CPUState* cpu) {
         /* 021DADB0 */ cpu->r[9] = 0x10030000u;
         /* 021DADB4 */ _t74 = cpu->r[9] + 0x00001560u;
         /* 021DADB4 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t74);
-        /* 021DADB8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[12]);
-        /* 021DADBC */ _t75 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DADB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[12]));
+        /* 021DADBC */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DADBC */ _t76 = _t75 & 0x00000001u;
         /* 021DADBC */ if (_t76) goto L_021DADC0; else goto L_021DACE4;
   L_021DADC0: ; // 0x21dadc0
@@ -16021,7 +16021,7 @@ void Gambit_fn_021DAB7C(CPUState* cpu) {
         /* 021DADDC */ cpu->f[29] = rbrew_read_f64(cpu->mem, _t83);
         /* 021DADE0 */ _t84 = cpu->r[1] + 0x00000030u;
         /* 021DADE0 */ cpu->r[30] = rbrew_read32(cpu->mem, _t84);
-        /* 021DADE4 */ _t85 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DADE4 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DADE4 */ _t86 = _t85 & 0x00000001u;
         /* 021DADE4 */ if (_t86) goto L_021DADE8; // else: addr-0 trap, fall-through
   L_021DADE8: ; // 0x21dade8
@@ -16071,20 +16071,20 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DAE40 */ _t11 = cpu->r[30] + 0x00000128u;
         /* 021DAE40 */ cpu->r[9] = rbrew_read8(cpu->mem, _t11);
         /* 021DAE44 */ cpu->r[4] = rbrew_rlwinm(cpu->r[7], 0x00000001u, 0x00000010u, 0x0000001Eu);
-        /* 021DAE48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021DAE48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021DAE4C */ _t12 = cpu->r[30] + 0x0000012Au;
         /* 021DAE4C */ rbrew_write16(cpu->mem, _t12, (uint16_t)cpu->r[4]);
-        /* 021DAE50 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DAE50 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DAE50 */ _t14 = _t13 & 0x00000001u;
         /* 021DAE50 */ if (_t14) goto L_021DAE6C; else goto L_021DAE54;
   L_021DAE54: ; // 0x21dae54
         /* 021DAE54 */ cpu->r[0] = cpu->r[4] | 0x00000001u;
         /* 021DAE58 */ _t15 = cpu->r[30] + 0x00000128u;
         /* 021DAE58 */ cpu->r[4] = rbrew_read8(cpu->mem, _t15);
-        /* 021DAE5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 021DAE5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 021DAE60 */ _t16 = cpu->r[30] + 0x0000012Au;
         /* 021DAE60 */ rbrew_write16(cpu->mem, _t16, (uint16_t)cpu->r[0]);
-        /* 021DAE64 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DAE64 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DAE64 */ _t18 = _t17 & 0x00000001u;
         /* 021DAE64 */ if (_t18) goto L_021DAE80; else goto L_021DAE68;
   L_021DAE68: ; // 0x21dae68
@@ -16093,10 +16093,10 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DAE6C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x00000010u, 0x0000001Eu);
         /* 021DAE70 */ _t19 = cpu->r[30] + 0x00000128u;
         /* 021DAE70 */ cpu->r[4] = rbrew_read8(cpu->mem, _t19);
-        /* 021DAE74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 021DAE74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 021DAE78 */ _t20 = cpu->r[30] + 0x0000012Au;
         /* 021DAE78 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[0]);
-        /* 021DAE7C */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DAE7C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DAE7C */ _t22 = _t21 & 0x00000001u;
         /* 021DAE7C */ if (_t22) goto L_021DAE80; else goto L_021DAEBC;
   L_021DAE80: ; // 0x21dae80
@@ -16107,7 +16107,7 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DAE8C */ _t24 = cpu->r[6] + 0x00001540u;
         /* 021DAE8C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t24);
         /* 021DAE90 */ cpu->r[5] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Eu, 0x0000001Fu);
-        /* 021DAE90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021DAE90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021DAE94 */ _t25 = cpu->r[12] + 0x00001528u;
         /* 021DAE94 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t25);
         /* 021DAE98 */ cpu->r[4] = 0x10030000u;
@@ -16121,7 +16121,7 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DAEAC */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t28);
         /* 021DAEB0 */ _t29 = cpu->r[6] + 0x00001478u;
         /* 021DAEB0 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t29);
-        /* 021DAEB4 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DAEB4 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DAEB4 */ _t31 = _t30 & 0x00000001u;
         /* 021DAEB4 */ if (_t31) goto L_021DAFE4; else goto L_021DAEB8;
   L_021DAEB8: ; // 0x21daeb8
@@ -16142,13 +16142,13 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DAEDC */ _t36 = cpu->r[6] + 0x00001478u;
         /* 021DAEDC */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t36);
         /* 021DAEE0 */ cpu->r[5] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Eu, 0x0000001Fu);
-        /* 021DAEE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021DAEE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021DAEE4 */ _t37 = cpu->r[30] + 0x000000E4u;
         /* 021DAEE4 */ rbrew_write_f32(cpu->mem, _t37, cpu->f[13]);
         /* 021DAEE8 */ cpu->r[3] = cpu->r[30];
         /* 021DAEEC */ _t38 = cpu->r[30] + 0x00000004u;
         /* 021DAEEC */ cpu->r[5] = rbrew_read32(cpu->mem, _t38);
-        /* 021DAEF0 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DAEF0 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DAEF0 */ _t40 = _t39 & 0x00000001u;
         /* 021DAEF0 */ if (_t40) goto L_021DAFE4; else goto L_021DAEF4;
   L_021DAEF4: ; // 0x21daef4
@@ -16160,8 +16160,8 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DAF04 */ cpu->r[4] = 0x10030000u;
         /* 021DAF08 */ _t42 = cpu->r[4] + 0x00001568u;
         /* 021DAF08 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t42);
-        /* 021DAF0C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[13]);
-        /* 021DAF10 */ _t43 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DAF0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[13]));
+        /* 021DAF10 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DAF10 */ _t44 = _t43 & 0x00000001u;
         /* 021DAF10 */ if (_t44) goto L_021DAF14; else goto L_021DAF78;
   L_021DAF14: ; // 0x21daf14
@@ -16178,9 +16178,9 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DAF30 */ cpu->f[12] = cpu->f[1] - cpu->f[13];
         /* 021DAF34 */ _t48 = cpu->r[12] + 0x0000156Cu;
         /* 021DAF34 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t48);
-        /* 021DAF38 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[30]);
+        /* 021DAF38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[30]));
         /* 021DAF3C */ cpu->f[0] = fma(cpu->f[12], cpu->f[11], cpu->f[13]);
-        /* 021DAF40 */ _t49 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DAF40 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DAF40 */ _t50 = _t49 & 0x00000001u;
         /* 021DAF40 */ if (_t50) goto L_021DAF44; else goto L_021DB08C;
   L_021DAF44: ; // 0x21daf44
@@ -16202,8 +16202,8 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DAF70 */ /* nop */
         /* 021DAF74 */ goto L_021DB08C;
   L_021DAF78: ; // 0x21daf78
-        /* 021DAF78 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[13]);
-        /* 021DAF7C */ _t55 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DAF78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[13]));
+        /* 021DAF7C */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DAF7C */ _t56 = _t55 & 0x00000001u;
         /* 021DAF7C */ if (_t56) goto L_021DAF80; else goto L_021DB08C;
   L_021DAF80: ; // 0x21daf80
@@ -16220,9 +16220,9 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DAF9C */ cpu->f[12] = cpu->f[1] - cpu->f[13];
         /* 021DAFA0 */ _t60 = cpu->r[9] + 0x00001570u;
         /* 021DAFA0 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t60);
-        /* 021DAFA4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[30]);
+        /* 021DAFA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[30]));
         /* 021DAFA8 */ cpu->f[11] = fma(cpu->f[12], cpu->f[10], cpu->f[13]);
-        /* 021DAFAC */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DAFAC */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DAFAC */ _t62 = _t61 & 0x00000001u;
         /* 021DAFAC */ if (_t62) goto L_021DAFB0; else goto L_021DB08C;
   L_021DAFB0: ; // 0x21dafb0
@@ -16259,10 +16259,10 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB008 */ _t70 = cpu->r[1] + 0x0000006Cu;
         /* 021DB008 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t70);
         /* 021DB00C */ cpu->f[11] = cpu->f[13] - cpu->f[6];
-        /* 021DB010 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[30]);
+        /* 021DB010 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[30]));
         /* 021DB014 */ _t71 = cpu->r[1] + 0x00000070u;
         /* 021DB014 */ rbrew_write_f32(cpu->mem, _t71, cpu->f[11]);
-        /* 021DB018 */ _t72 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DB018 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DB018 */ _t73 = _t72 & 0x00000001u;
         /* 021DB018 */ if (_t73) goto L_021DB01C; else goto L_021DB08C;
   L_021DB01C: ; // 0x21db01c
@@ -16271,8 +16271,8 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB024 */ cpu->r[6] = 0x10030000u;
         /* 021DB028 */ _t74 = cpu->r[6] + 0x00001574u;
         /* 021DB028 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t74);
-        /* 021DB02C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[12]);
-        /* 021DB030 */ _t75 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DB02C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[12]));
+        /* 021DB030 */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DB030 */ _t76 = _t75 & 0x00000001u;
         /* 021DB030 */ if (_t76) goto L_021DB034; else goto L_021DB08C;
   L_021DB034: ; // 0x21db034
@@ -16286,10 +16286,10 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB044 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t79);
         /* 021DB048 */ cpu->f[13] = fma(cpu->f[9], cpu->f[9], cpu->f[12]);
         /* 021DB04C */ cpu->r[11] = 0x10030000u;
-        /* 021DB050 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[30]);
+        /* 021DB050 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[30]));
         /* 021DB054 */ _t80 = cpu->r[11] + 0x00001574u;
         /* 021DB054 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t80);
-        /* 021DB058 */ _t81 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DB058 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DB058 */ _t82 = _t81 & 0x00000001u;
         /* 021DB058 */ if (_t82) goto L_021DB05C; else goto L_021DB08C;
   L_021DB05C: ; // 0x21db05c
@@ -16318,10 +16318,10 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB09C */ _t88 = cpu->r[30] + 0x0000012Au;
         /* 021DB09C */ cpu->r[8] = rbrew_read16(cpu->mem, _t88);
         /* 021DB0A0 */ cpu->r[7] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021DB0A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021DB0A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021DB0A4 */ _t89 = cpu->r[30] + 0x00000004u;
         /* 021DB0A4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t89);
-        /* 021DB0A8 */ _t90 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB0A8 */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB0A8 */ _t91 = _t90 & 0x00000001u;
         /* 021DB0A8 */ if (_t91) goto L_021DB14C; else goto L_021DB0AC;
   L_021DB0AC: ; // 0x21db0ac
@@ -16381,10 +16381,10 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB134 */ Gambit_fn_0222DA90(cpu);
         /* 021DB138 */ _t111 = cpu->r[30] + 0x0000019Cu;
         /* 021DB138 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t111);
-        /* 021DB13C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021DB13C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021DB140 */ _t112 = cpu->r[30] + 0x00000030u;
         /* 021DB140 */ cpu->r[29] = rbrew_read32(cpu->mem, _t112);
-        /* 021DB144 */ _t113 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DB144 */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DB144 */ _t114 = _t113 & 0x00000001u;
         /* 021DB144 */ if (_t114) goto L_021DB1DC; else goto L_021DB148;
   L_021DB148: ; // 0x21db148
@@ -16441,24 +16441,24 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB1C8 */ Gambit_fn_0222DA90(cpu);
         /* 021DB1CC */ _t132 = cpu->r[30] + 0x0000019Cu;
         /* 021DB1CC */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t132);
-        /* 021DB1D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021DB1D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021DB1D4 */ _t133 = cpu->r[30] + 0x00000030u;
         /* 021DB1D4 */ cpu->r[29] = rbrew_read32(cpu->mem, _t133);
-        /* 021DB1D8 */ _t134 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DB1D8 */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DB1D8 */ _t135 = _t134 & 0x00000001u;
         /* 021DB1D8 */ if (_t135) goto L_021DB1DC; else goto L_021DB1F4;
   L_021DB1DC: ; // 0x21db1dc
         /* 021DB1DC */ _t136 = cpu->r[30] + 0x00000194u;
         /* 021DB1DC */ cpu->r[4] = rbrew_read32(cpu->mem, _t136);
-        /* 021DB1E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 021DB1E4 */ _t137 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB1E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 021DB1E4 */ _t137 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB1E4 */ _t138 = _t137 & 0x00000001u;
         /* 021DB1E4 */ if (_t138) goto L_021DB1E8; else goto L_021DB1F4;
   L_021DB1E8: ; // 0x21db1e8
         /* 021DB1E8 */ _t139 = cpu->r[30] + 0x00000198u;
         /* 021DB1E8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t139);
-        /* 021DB1EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 021DB1F0 */ _t140 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB1EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 021DB1F0 */ _t140 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB1F0 */ _t141 = _t140 & 0x00000001u;
         /* 021DB1F0 */ if (_t141) goto L_021DBAA8; else goto L_021DB1F4;
   L_021DB1F4: ; // 0x21db1f4
@@ -16469,8 +16469,8 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB1FC */ cpu->ctr = cpu->r[8];
         /* 021DB200 */ cpu->r[3] = cpu->r[30];
         /* 021DB204 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021DB208 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DB20C */ _t144 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DB20C */ _t144 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB20C */ _t145 = _t144 & 0x00000001u;
         /* 021DB20C */ if (_t145) goto L_021DB210; else goto L_021DBAA8;
   L_021DB210: ; // 0x21db210
@@ -16481,10 +16481,10 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB21C */ _t147 = cpu->r[30] + 0x00000004u;
         /* 021DB21C */ cpu->r[12] = rbrew_read32(cpu->mem, _t147);
         /* 021DB220 */ cpu->r[4] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021DB220 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 021DB220 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 021DB224 */ cpu->r[10] = cpu->r[31];
         /* 021DB228 */ cpu->r[8] = cpu->r[12] + 0x00000250u;
-        /* 021DB22C */ _t148 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB22C */ _t148 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB22C */ _t149 = _t148 & 0x00000001u;
         /* 021DB22C */ if (_t149) goto L_021DB234; else goto L_021DB230;
   L_021DB230: ; // 0x21db230
@@ -16534,11 +16534,11 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB2A0 */ cpu->f[13] = cpu->f[6] + cpu->f[7];
         /* 021DB2A4 */ _t164 = cpu->r[1] + 0x0000003Cu;
         /* 021DB2A4 */ rbrew_write_f32(cpu->mem, _t164, cpu->f[0]);
-        /* 021DB2A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 021DB2A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 021DB2AC */ cpu->r[28] = 0x00000000u;
         /* 021DB2B0 */ _t165 = cpu->r[1] + 0x00000038u;
         /* 021DB2B0 */ rbrew_write_f32(cpu->mem, _t165, cpu->f[13]);
-        /* 021DB2B4 */ _t166 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DB2B4 */ _t166 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DB2B4 */ _t167 = _t166 & 0x00000001u;
         /* 021DB2B4 */ if (_t167) goto L_021DB398; else goto L_021DB2B8;
   L_021DB2B8: ; // 0x21db2b8
@@ -16553,15 +16553,15 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB2CC */ cpu->r[9] = rbrew_read32(cpu->mem, _t170);
         /* 021DB2D0 */ _t171 = cpu->r[30] + 0x0000002Cu;
         /* 021DB2D0 */ cpu->r[6] = rbrew_read32(cpu->mem, _t171);
-        /* 021DB2D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[6]);
-        /* 021DB2D8 */ _t172 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB2D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[6]));
+        /* 021DB2D8 */ _t172 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB2D8 */ _t173 = _t172 & 0x00000001u;
         /* 021DB2D8 */ if (_t173) goto L_021DB398; else goto L_021DB2DC;
   L_021DB2DC: ; // 0x21db2dc
         /* 021DB2DC */ cpu->r[3] = cpu->r[27];
         /* 021DB2E0 */ Gambit_fn_025C5DA4(cpu);
-        /* 021DB2E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DB2E8 */ _t174 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB2E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DB2E8 */ _t174 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB2E8 */ _t175 = _t174 & 0x00000001u;
         /* 021DB2E8 */ if (_t175) goto L_021DB2EC; else goto L_021DB398;
   L_021DB2EC: ; // 0x21db2ec
@@ -16573,16 +16573,16 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB300 */ cpu->r[4] = cpu->r[1] + 0x0000003Cu;
         /* 021DB304 */ cpu->r[3] = cpu->r[30];
         /* 021DB308 */ Gambit_fn_021DAB7C(cpu);
-        /* 021DB30C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DB310 */ _t176 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB30C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DB310 */ _t176 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB310 */ _t177 = _t176 & 0x00000001u;
         /* 021DB310 */ if (_t177) goto L_021DB398; else goto L_021DB314;
   L_021DB314: ; // 0x21db314
         /* 021DB314 */ _t178 = cpu->r[30] + 0x00000194u;
         /* 021DB314 */ cpu->r[12] = rbrew_read32(cpu->mem, _t178);
-        /* 021DB318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021DB318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021DB31C */ cpu->r[28] = 0x00000001u;
-        /* 021DB320 */ _t179 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB320 */ _t179 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB320 */ _t180 = _t179 & 0x00000001u;
         /* 021DB320 */ if (_t180) goto L_021DB418; else goto L_021DB324;
   L_021DB324: ; // 0x21db324
@@ -16620,16 +16620,16 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB374 */ _t192 = cpu->r[1] + 0x000000DCu;
         /* 021DB374 */ rbrew_write32(cpu->mem, _t192, cpu->r[0]);
         /* 021DB378 */ Gambit_fn_021DAB7C(cpu);
-        /* 021DB37C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DB380 */ _t193 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB37C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DB380 */ _t193 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB380 */ _t194 = _t193 & 0x00000001u;
         /* 021DB380 */ if (_t194) goto L_021DB418; else goto L_021DB384;
   L_021DB384: ; // 0x21db384
         /* 021DB384 */ _t195 = cpu->r[30] + 0x00000198u;
         /* 021DB384 */ cpu->r[4] = rbrew_read32(cpu->mem, _t195);
-        /* 021DB388 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 021DB388 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 021DB38C */ cpu->r[28] = 0x00000001u;
-        /* 021DB390 */ _t196 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB390 */ _t196 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB390 */ _t197 = _t196 & 0x00000001u;
         /* 021DB390 */ if (_t197) goto L_021DB424; else goto L_021DB394;
   L_021DB394: ; // 0x21db394
@@ -16637,8 +16637,8 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
   L_021DB398: ; // 0x21db398
         /* 021DB398 */ _t198 = cpu->r[30] + 0x00000194u;
         /* 021DB398 */ cpu->r[12] = rbrew_read32(cpu->mem, _t198);
-        /* 021DB39C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021DB3A0 */ _t199 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB39C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021DB3A0 */ _t199 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB3A0 */ _t200 = _t199 & 0x00000001u;
         /* 021DB3A0 */ if (_t200) goto L_021DB3A4; else goto L_021DB324;
   L_021DB3A4: ; // 0x21db3a4
@@ -16668,8 +16668,8 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB3E0 */ _t208 = cpu->r[1] + 0x000000E8u;
         /* 021DB3E0 */ rbrew_write32(cpu->mem, _t208, cpu->r[0]);
         /* 021DB3E4 */ Gambit_fn_021DAB7C(cpu);
-        /* 021DB3E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DB3EC */ _t209 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB3E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DB3EC */ _t209 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB3EC */ _t210 = _t209 & 0x00000001u;
         /* 021DB3EC */ if (_t210) goto L_021DB424; else goto L_021DB3F0;
   L_021DB3F0: ; // 0x21db3f0
@@ -16678,14 +16678,14 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB3F4 */ cpu->r[10] = 0x101C0000u;
         /* 021DB3F8 */ _t212 = cpu->r[30] + 0x000000B4u;
         /* 021DB3F8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t212);
-        /* 021DB3FC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 021DB3FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 021DB400 */ cpu->r[5] = 0x101E0000u;
         /* 021DB404 */ _t213 = cpu->r[10] + 0x00001EF8u;
         /* 021DB404 */ cpu->r[3] = rbrew_read32(cpu->mem, _t213);
         /* 021DB408 */ cpu->r[28] = 0x00000001u;
         /* 021DB40C */ _t214 = cpu->r[5] + 0xFFFF9594u;
         /* 021DB40C */ cpu->f[3] = rbrew_read_f32(cpu->mem, _t214);
-        /* 021DB410 */ _t215 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DB410 */ _t215 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DB410 */ _t216 = _t215 & 0x00000001u;
         /* 021DB410 */ if (_t216) goto L_021DB414; else goto L_021DB44C;
   L_021DB414: ; // 0x21db414
@@ -16693,13 +16693,13 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
   L_021DB418: ; // 0x21db418
         /* 021DB418 */ _t217 = cpu->r[30] + 0x00000198u;
         /* 021DB418 */ cpu->r[4] = rbrew_read32(cpu->mem, _t217);
-        /* 021DB41C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 021DB420 */ _t218 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB41C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 021DB420 */ _t218 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB420 */ _t219 = _t218 & 0x00000001u;
         /* 021DB420 */ if (_t219) goto L_021DB424; else goto L_021DB3A8;
   L_021DB424: ; // 0x21db424
-        /* 021DB424 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021DB428 */ _t220 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB424 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021DB428 */ _t220 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB428 */ _t221 = _t220 & 0x00000001u;
         /* 021DB428 */ if (_t221) goto L_021DB4C8; else goto L_021DB42C;
   L_021DB42C: ; // 0x21db42c
@@ -16708,13 +16708,13 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB430 */ cpu->r[5] = 0x101E0000u;
         /* 021DB434 */ _t223 = cpu->r[5] + 0xFFFF9594u;
         /* 021DB434 */ cpu->f[3] = rbrew_read_f32(cpu->mem, _t223);
-        /* 021DB438 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 021DB438 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 021DB43C */ cpu->r[10] = 0x101C0000u;
         /* 021DB440 */ _t224 = cpu->r[30] + 0x000000B4u;
         /* 021DB440 */ cpu->r[9] = rbrew_read32(cpu->mem, _t224);
         /* 021DB444 */ _t225 = cpu->r[10] + 0x00001EF8u;
         /* 021DB444 */ cpu->r[3] = rbrew_read32(cpu->mem, _t225);
-        /* 021DB448 */ _t226 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DB448 */ _t226 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DB448 */ _t227 = _t226 & 0x00000001u;
         /* 021DB448 */ if (_t227) goto L_021DB48C; else goto L_021DB44C;
   L_021DB44C: ; // 0x21db44c
@@ -16733,10 +16733,10 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB474 */ cpu->r[10] = cpu->r[7];
         /* 021DB478 */ Gambit_fn_0204A4DC(cpu);
         /* 021DB47C */ cpu->r[8] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021DB47C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021DB47C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021DB480 */ _t230 = cpu->r[30] + 0x000000B0u;
         /* 021DB480 */ rbrew_write32(cpu->mem, _t230, cpu->r[3]);
-        /* 021DB484 */ _t231 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB484 */ _t231 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB484 */ _t232 = _t231 & 0x00000001u;
         /* 021DB484 */ if (_t232) goto L_021DB4C8; else goto L_021DB488;
   L_021DB488: ; // 0x21db488
@@ -16756,10 +16756,10 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB4B0 */ cpu->r[7] = 0x000001FFu;
         /* 021DB4B4 */ Gambit_fn_0204A864(cpu);
         /* 021DB4B8 */ cpu->r[8] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021DB4B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021DB4B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021DB4BC */ _t235 = cpu->r[30] + 0x000000B0u;
         /* 021DB4BC */ rbrew_write32(cpu->mem, _t235, cpu->r[3]);
-        /* 021DB4C0 */ _t236 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB4C0 */ _t236 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB4C0 */ _t237 = _t236 & 0x00000001u;
         /* 021DB4C0 */ if (_t237) goto L_021DB4C8; else goto L_021DB4C4;
   L_021DB4C4: ; // 0x21db4c4
@@ -16769,8 +16769,8 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB4CC */ cpu->r[5] = cpu->r[28] ^ 0x00000001u;
         /* 021DB4D0 */ cpu->r[3] = cpu->r[29];
         /* 021DB4D4 */ Gambit_fn_027B8224(cpu);
-        /* 021DB4D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021DB4DC */ _t238 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB4D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021DB4DC */ _t238 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB4DC */ _t239 = _t238 & 0x00000001u;
         /* 021DB4DC */ if (_t239) goto L_021DB4FC; else goto L_021DB4E0;
   L_021DB4E0: ; // 0x21db4e0
@@ -16779,8 +16779,8 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB4E4 */ cpu->r[4] = 0x0000000Au;
         /* 021DB4E8 */ cpu->r[3] = cpu->r[29];
         /* 021DB4EC */ Gambit_fn_027B8214(cpu);
-        /* 021DB4F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021DB4F4 */ _t241 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB4F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021DB4F4 */ _t241 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB4F4 */ _t242 = _t241 & 0x00000001u;
         /* 021DB4F4 */ if (_t242) goto L_021DB518; else goto L_021DB4F8;
   L_021DB4F8: ; // 0x21db4f8
@@ -16792,16 +16792,16 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB504 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t243);
         /* 021DB508 */ cpu->r[4] = 0x0000000Au;
         /* 021DB50C */ Gambit_fn_027B8214(cpu);
-        /* 021DB510 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021DB514 */ _t244 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB510 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021DB514 */ _t244 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB514 */ _t245 = _t244 & 0x00000001u;
         /* 021DB514 */ if (_t245) goto L_021DB518; else goto L_021DB6DC;
   L_021DB518: ; // 0x21db518
         /* 021DB518 */ _t246 = cpu->r[30] + 0x0000019Cu;
         /* 021DB518 */ cpu->r[0] = rbrew_read32(cpu->mem, _t246);
         /* 021DB51C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000018u, 0x00000018u);
-        /* 021DB51C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021DB520 */ _t247 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB51C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021DB520 */ _t247 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB520 */ _t248 = _t247 & 0x00000001u;
         /* 021DB520 */ if (_t248) goto L_021DBACC; else goto L_021DB524;
   L_021DB524: ; // 0x21db524
@@ -16831,11 +16831,11 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB560 */ rbrew_write_f32(cpu->mem, _t256, cpu->f[0]);
         /* 021DB564 */ _t257 = cpu->r[1] + 0x00000058u;
         /* 021DB564 */ rbrew_write_f32(cpu->mem, _t257, cpu->f[8]);
-        /* 021DB568 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[30]);
+        /* 021DB568 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[30]));
         /* 021DB56C */ _t258 = cpu->r[1] + 0x00000020u;
         /* 021DB56C */ rbrew_write_f32(cpu->mem, _t258, cpu->f[10]);
         /* 021DB570 */ cpu->r[28] = 0x00000001u;
-        /* 021DB574 */ _t259 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DB574 */ _t259 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DB574 */ _t260 = _t259 & 0x00000001u;
         /* 021DB574 */ if (_t260) goto L_021DB578; else goto L_021DB5A8;
   L_021DB578: ; // 0x21db578
@@ -16859,8 +16859,8 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB5A8 */ cpu->r[6] = 0x10030000u;
         /* 021DB5AC */ _t265 = cpu->r[6] + 0x0000155Cu;
         /* 021DB5AC */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t265);
-        /* 021DB5B0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[8]);
-        /* 021DB5B4 */ _t266 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DB5B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[8]));
+        /* 021DB5B4 */ _t266 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DB5B4 */ _t267 = _t266 & 0x00000001u;
         /* 021DB5B4 */ if (_t267) goto L_021DBACC; else goto L_021DB5B8;
   L_021DB5B8: ; // 0x21db5b8
@@ -16902,8 +16902,8 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB604 */ cpu->f[5] = rbrew_read_f32(cpu->mem, _t283);
         /* 021DB608 */ cpu->f[6] = fma(cpu->f[13], cpu->f[13], cpu->f[0]);
         /* 021DB60C */ cpu->f[0] = fma(cpu->f[5], cpu->f[5], cpu->f[6]);
-        /* 021DB610 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[30]);
-        /* 021DB614 */ _t284 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DB610 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[30]));
+        /* 021DB614 */ _t284 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DB614 */ _t285 = _t284 & 0x00000001u;
         /* 021DB614 */ if (_t285) goto L_021DB664; else goto L_021DB618;
   L_021DB618: ; // 0x21db618
@@ -16925,8 +16925,8 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB650 */ cpu->r[4] = 0x10030000u;
         /* 021DB654 */ _t287 = cpu->r[4] + 0x00001560u;
         /* 021DB654 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t287);
-        /* 021DB658 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[7]);
-        /* 021DB65C */ _t288 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DB658 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[7]));
+        /* 021DB65C */ _t288 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DB65C */ _t289 = _t288 & 0x00000001u;
         /* 021DB65C */ if (_t289) goto L_021DB660; else goto L_021DB6D4;
   L_021DB660: ; // 0x21db660
@@ -16964,21 +16964,21 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB6C4 */ cpu->r[4] = 0x10030000u;
         /* 021DB6C8 */ _t295 = cpu->r[4] + 0x00001560u;
         /* 021DB6C8 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t295);
-        /* 021DB6CC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[7]);
-        /* 021DB6D0 */ _t296 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DB6CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[7]));
+        /* 021DB6D0 */ _t296 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DB6D0 */ _t297 = _t296 & 0x00000001u;
         /* 021DB6D0 */ if (_t297) goto L_021DBACC; else goto L_021DB6D4;
   L_021DB6D4: ; // 0x21db6d4
-        /* 021DB6D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021DB6D8 */ _t298 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB6D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021DB6D8 */ _t298 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB6D8 */ _t299 = _t298 & 0x00000001u;
         /* 021DB6D8 */ if (_t299) goto L_021DBACC; else goto L_021DB6DC;
   L_021DB6DC: ; // 0x21db6dc
         /* 021DB6DC */ _t300 = cpu->r[30] + 0x0000012Au;
         /* 021DB6DC */ cpu->r[9] = rbrew_read16(cpu->mem, _t300);
         /* 021DB6E0 */ cpu->r[7] = rbrew_rlwinm(cpu->r[9], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021DB6E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021DB6E4 */ _t301 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB6E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021DB6E4 */ _t301 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB6E4 */ _t302 = _t301 & 0x00000001u;
         /* 021DB6E4 */ if (_t302) goto L_021DBA78; else goto L_021DB6E8;
   L_021DB6E8: ; // 0x21db6e8
@@ -17010,8 +17010,8 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB720 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t313);
         /* 021DB724 */ cpu->f[0] = fma(cpu->f[7], cpu->f[7], cpu->f[13]);
         /* 021DB728 */ cpu->f[28] = fma(cpu->f[9], cpu->f[9], cpu->f[0]);
-        /* 021DB72C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[30]);
-        /* 021DB730 */ _t314 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DB72C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[30]));
+        /* 021DB730 */ _t314 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DB730 */ _t315 = _t314 & 0x00000001u;
         /* 021DB730 */ if (_t315) goto L_021DB734; else goto L_021DB764;
   L_021DB734: ; // 0x21db734
@@ -17064,18 +17064,18 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB7BC */ cpu->f[12] = (double)(float)cpu->f[10];
         /* 021DB7C0 */ _t327 = cpu->r[11] + 0x00001580u;
         /* 021DB7C0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t327);
-        /* 021DB7C4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[30]);
+        /* 021DB7C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[30]));
         /* 021DB7C8 */ cpu->f[9] = cpu->f[12] / cpu->f[13];
         /* 021DB7CC */ /* nop */
-        /* 021DB7D0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[30]);
+        /* 021DB7D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[30]));
         /* 021DB7D4 */ cpu->r[29] = rbrew_rlwinm(cpu->r[5], 0x00000002u, 0x0000001Fu, 0x0000001Fu);
-        /* 021DB7D8 */ _t328 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DB7D8 */ _t328 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DB7D8 */ _t329 = _t328 & 0x00000001u;
         /* 021DB7D8 */ if (_t329) goto L_021DB7DC; else goto L_021DB7EC;
   L_021DB7DC: ; // 0x21db7dc
         /* 021DB7DC */ cpu->f[9] = cpu->f[30];
-        /* 021DB7E0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[30]);
-        /* 021DB7E4 */ _t330 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DB7E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[30]));
+        /* 021DB7E4 */ _t330 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DB7E4 */ _t331 = _t330 & 0x00000001u;
         /* 021DB7E4 */ if (_t331) goto L_021DB7E8; else goto L_021DBA78;
   L_021DB7E8: ; // 0x21db7e8
@@ -17084,8 +17084,8 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB7EC */ cpu->r[10] = 0x10030000u;
         /* 021DB7F0 */ _t332 = cpu->r[10] + 0x00001480u;
         /* 021DB7F0 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t332);
-        /* 021DB7F4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[11]);
-        /* 021DB7F8 */ _t333 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DB7F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[11]));
+        /* 021DB7F8 */ _t333 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DB7F8 */ _t334 = _t333 & 0x00000001u;
         /* 021DB7F8 */ if (_t334) goto L_021DB7FC; else goto L_021DB804;
   L_021DB7FC: ; // 0x21db7fc
@@ -17093,13 +17093,13 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB800 */ _t335 = cpu->r[9] + 0x00001480u;
         /* 021DB800 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t335);
   L_021DB804: ; // 0x21db804
-        /* 021DB804 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[30]);
-        /* 021DB808 */ _t336 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DB804 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[30]));
+        /* 021DB808 */ _t336 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DB808 */ _t337 = _t336 & 0x00000001u;
         /* 021DB808 */ if (_t337) goto L_021DB80C; else goto L_021DBA78;
   L_021DB80C: ; // 0x21db80c
-        /* 021DB80C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021DB810 */ _t338 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB80C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021DB810 */ _t338 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB810 */ _t339 = _t338 & 0x00000001u;
         /* 021DB810 */ if (_t339) goto L_021DB898; else goto L_021DB814;
   L_021DB814: ; // 0x21db814
@@ -17135,11 +17135,11 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB878 */ _t344 = cpu->r[1] + 0x0000007Cu;
         /* 021DB878 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t344);
         /* 021DB87C */ cpu->f[10] = fma(cpu->f[7], cpu->f[11], cpu->f[13]);
-        /* 021DB880 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[30]);
+        /* 021DB880 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[30]));
         /* 021DB884 */ /* nop */
         /* 021DB888 */ cpu->r[5] = rbrew_rlwinm(cpu->r[0], 0x00000002u, 0x0000001Fu, 0x0000001Fu);
-        /* 021DB88C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[5]);
-        /* 021DB890 */ _t345 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB88C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[5]));
+        /* 021DB890 */ _t345 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB890 */ _t346 = _t345 & 0x00000001u;
         /* 021DB890 */ if (_t346) goto L_021DBA14; else goto L_021DB894;
   L_021DB894: ; // 0x21db894
@@ -17177,11 +17177,11 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB8FC */ _t351 = cpu->r[1] + 0x0000007Cu;
         /* 021DB8FC */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t351);
         /* 021DB900 */ cpu->f[10] = fma(cpu->f[7], cpu->f[11], cpu->f[13]);
-        /* 021DB904 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[30]);
+        /* 021DB904 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[30]));
         /* 021DB908 */ /* nop */
         /* 021DB90C */ cpu->r[5] = rbrew_rlwinm(cpu->r[0], 0x00000002u, 0x0000001Fu, 0x0000001Fu);
-        /* 021DB910 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[5]);
-        /* 021DB914 */ _t352 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DB910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[5]));
+        /* 021DB914 */ _t352 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DB914 */ _t353 = _t352 & 0x00000001u;
         /* 021DB914 */ if (_t353) goto L_021DBA14; else goto L_021DB918;
   L_021DB918: ; // 0x21db918
@@ -17208,8 +17208,8 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB944 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t362);
         /* 021DB948 */ cpu->f[10] = cpu->f[8] * cpu->f[8];
         /* 021DB94C */ cpu->f[13] = fma(cpu->f[11], cpu->f[11], cpu->f[10]);
-        /* 021DB950 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[30]);
-        /* 021DB954 */ _t363 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DB950 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[30]));
+        /* 021DB954 */ _t363 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DB954 */ _t364 = _t363 & 0x00000001u;
         /* 021DB954 */ if (_t364) goto L_021DB97C; else goto L_021DB958;
   L_021DB958: ; // 0x21db958
@@ -17219,11 +17219,11 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB960 */ _t366 = cpu->r[1] + 0x0000000Cu;
         /* 021DB960 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t366);
         /* 021DB964 */ cpu->f[8] = fma(cpu->f[7], cpu->f[7], cpu->f[12]);
-        /* 021DB968 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[30]);
+        /* 021DB968 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[30]));
         /* 021DB96C */ cpu->f[12] = cpu->f[30] * cpu->f[13];
         /* 021DB970 */ _t367 = cpu->r[1] + 0x00000010u;
         /* 021DB970 */ rbrew_write_f32(cpu->mem, _t367, cpu->f[30]);
-        /* 021DB974 */ _t368 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DB974 */ _t368 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DB974 */ _t369 = _t368 & 0x00000001u;
         /* 021DB974 */ if (_t369) goto L_021DB978; else goto L_021DB9E0;
   L_021DB978: ; // 0x21db978
@@ -17242,11 +17242,11 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DB998 */ _t373 = cpu->r[1] + 0x0000000Cu;
         /* 021DB998 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t373);
         /* 021DB99C */ cpu->f[8] = fma(cpu->f[7], cpu->f[7], cpu->f[12]);
-        /* 021DB9A0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[30]);
+        /* 021DB9A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[30]));
         /* 021DB9A4 */ cpu->f[12] = cpu->f[0] * cpu->f[13];
         /* 021DB9A8 */ _t374 = cpu->r[1] + 0x00000010u;
         /* 021DB9A8 */ rbrew_write_f32(cpu->mem, _t374, cpu->f[30]);
-        /* 021DB9AC */ _t375 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DB9AC */ _t375 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DB9AC */ _t376 = _t375 & 0x00000001u;
         /* 021DB9AC */ if (_t376) goto L_021DB9B0; else goto L_021DB9E0;
   L_021DB9B0: ; // 0x21db9b0
@@ -17299,8 +17299,8 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DBA24 */ _t392 = cpu->r[1] + 0x00000014u;
         /* 021DBA24 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t392);
         /* 021DBA28 */ cpu->f[12] = fma(cpu->f[9], cpu->f[9], cpu->f[0]);
-        /* 021DBA2C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[30]);
-        /* 021DBA30 */ _t393 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DBA2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[30]));
+        /* 021DBA30 */ _t393 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DBA30 */ _t394 = _t393 & 0x00000001u;
         /* 021DBA30 */ if (_t394) goto L_021DBA34; else goto L_021DBA6C;
   L_021DBA34: ; // 0x21dba34
@@ -17384,7 +17384,7 @@ void Gambit_fn_021DADF8(CPUState* cpu) {
         /* 021DBAF0 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t419);
         /* 021DBAF4 */ _t420 = cpu->r[1] + 0x00000178u;
         /* 021DBAF4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t420);
-        /* 021DBAF8 */ _t421 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DBAF8 */ _t421 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DBAF8 */ _t422 = _t421 & 0x00000001u;
         /* 021DBAF8 */ if (_t422) goto L_021DBAFC; // else: addr-0 trap, fall-through
   L_021DBAFC: ; // 0x21dbafc
@@ -17455,9 +17455,9 @@ void Gambit_fn_021DBB0C(CPUState* cpu) {
         /* 021C6FAC */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t17);
         /* 021C6FAC */ cpu->r[4] = _t17;
         /* 021C6FB0 */ cpu->r[20] = 0x00000000u;
-        /* 021C6FB4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[12]);
+        /* 021C6FB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[12]));
         /* 021C6FB8 */ cpu->r[24] = cpu->r[20];
-        /* 021C6FBC */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6FBC */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6FBC */ _t19 = _t18 & 0x00000001u;
         /* 021C6FBC */ if (_t19) goto L_021C6FC0; else goto L_021C6FE0;
   L_021C6FC0: ; // 0x21c6fc0
@@ -17465,8 +17465,8 @@ void Gambit_fn_021DBB0C(CPUState* cpu) {
         /* 021C6FC0 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t20);
         /* 021C6FC4 */ _t21 = cpu->r[4] + 0x00000004u;
         /* 021C6FC4 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t21);
-        /* 021C6FC8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[7]);
-        /* 021C6FCC */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6FC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[7]));
+        /* 021C6FCC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6FCC */ _t23 = _t22 & 0x00000001u;
         /* 021C6FCC */ if (_t23) goto L_021C6FD0; else goto L_021C6FE0;
   L_021C6FD0: ; // 0x21c6fd0
@@ -17474,25 +17474,25 @@ void Gambit_fn_021DBB0C(CPUState* cpu) {
         /* 021C6FD0 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t24);
         /* 021C6FD4 */ _t25 = cpu->r[4] + 0x00000008u;
         /* 021C6FD4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t25);
-        /* 021C6FD8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[10]);
-        /* 021C6FDC */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6FD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[10]));
+        /* 021C6FDC */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6FDC */ _t27 = _t26 & 0x00000001u;
         /* 021C6FDC */ if (_t27) goto L_021C7010; else goto L_021C6FE0;
   L_021C6FE0: ; // 0x21c6fe0
         /* 021C6FE0 */ cpu->r[5] = cpu->r[22] + 0x00000044u;
         /* 021C6FE4 */ cpu->r[3] = cpu->r[1] + 0x00000080u;
         /* 021C6FE8 */ Gambit_fn_021C6DD8(cpu);
-        /* 021C6FEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C6FF0 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C6FEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C6FF0 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C6FF0 */ _t29 = _t28 & 0x00000001u;
         /* 021C6FF0 */ if (_t29) goto L_021C6FF4; else goto L_021C700C;
   L_021C6FF4: ; // 0x21c6ff4
         /* 021C6FF4 */ _t30 = cpu->r[22] + 0x00000004u;
         /* 021C6FF4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t30);
         /* 021C6FF8 */ cpu->r[18] = 0x00000000u;
-        /* 021C6FFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[18], cpu->r[0]);
+        /* 021C6FFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[18], cpu->r[0]));
         /* 021C7000 */ cpu->r[24] = 0x00000001u;
-        /* 021C7004 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C7004 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C7004 */ _t32 = _t31 & 0x00000001u;
         /* 021C7004 */ if (_t32) goto L_021C7008; else goto L_021C7318;
   L_021C7008: ; // 0x21c7008
@@ -17503,8 +17503,8 @@ void Gambit_fn_021DBB0C(CPUState* cpu) {
         /* 021C7010 */ _t33 = cpu->r[22] + 0x00000004u;
         /* 021C7010 */ cpu->r[0] = rbrew_read32(cpu->mem, _t33);
         /* 021C7014 */ cpu->r[18] = 0x00000000u;
-        /* 021C7018 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[18], cpu->r[0]);
-        /* 021C701C */ _t34 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C7018 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[18], cpu->r[0]));
+        /* 021C701C */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C701C */ _t35 = _t34 & 0x00000001u;
         /* 021C701C */ if (_t35) goto L_021C7020; else goto L_021C7318;
   L_021C7020: ; // 0x21c7020
@@ -17600,9 +17600,9 @@ void Gambit_fn_021DBB0C(CPUState* cpu) {
         /* 021C7100 */ _t68 = cpu->r[22] + 0x00000034u;
         /* 021C7100 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t68);
         /* 021C7104 */ cpu->f[27] = cpu->f[0] - cpu->f[29];
-        /* 021C7108 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[30]);
+        /* 021C7108 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[30]));
         /* 021C710C */ cpu->f[26] = fma(cpu->f[6], cpu->f[27], cpu->f[13]);
-        /* 021C7110 */ _t69 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C7110 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C7110 */ _t70 = _t69 & 0x00000001u;
         /* 021C7110 */ if (_t70) goto L_021C7114; else goto L_021C713C;
   L_021C7114: ; // 0x21c7114
@@ -17681,8 +17681,8 @@ void Gambit_fn_021DBB0C(CPUState* cpu) {
         /* 021C71E0 */ _t91 = cpu->r[1] + 0x0000006Cu;
         /* 021C71E0 */ rbrew_write32(cpu->mem, _t91, cpu->r[0]);
         /* 021C71E4 */ Gambit_fn_0204EFD8(cpu);
-        /* 021C71E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
-        /* 021C71EC */ _t92 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C71E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
+        /* 021C71EC */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C71EC */ _t93 = _t92 & 0x00000001u;
         /* 021C71EC */ if (_t93) goto L_021C7234; else goto L_021C71F0;
   L_021C71F0: ; // 0x21c71f0
@@ -17702,17 +17702,17 @@ void Gambit_fn_021DBB0C(CPUState* cpu) {
         /* 021C7218 */ /* nop */
         /* 021C721C */ cpu->f[10] = cpu->f[12] * cpu->f[10];
         /* 021C7220 */ /* nop */
-        /* 021C7224 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
+        /* 021C7224 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
         /* 021C7228 */ _t97 = cpu->r[1] + 0x00000020u;
         /* 021C7228 */ rbrew_write_f32(cpu->mem, _t97, cpu->f[10]);
-        /* 021C722C */ _t98 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C722C */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C722C */ _t99 = _t98 & 0x00000001u;
         /* 021C722C */ if (_t99) goto L_021C7294; else goto L_021C7230;
   L_021C7230: ; // 0x21c7230
         /* 021C7230 */ goto L_021C7278;
   L_021C7234: ; // 0x21c7234
-        /* 021C7234 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 021C7238 */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C7234 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 021C7238 */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C7238 */ _t101 = _t100 & 0x00000001u;
         /* 021C7238 */ if (_t101) goto L_021C7248; else goto L_021C723C;
   L_021C723C: ; // 0x21c723c
@@ -17734,10 +17734,10 @@ void Gambit_fn_021DBB0C(CPUState* cpu) {
         /* 021C7260 */ /* nop */
         /* 021C7264 */ cpu->f[10] = cpu->f[12] * cpu->f[10];
         /* 021C7268 */ /* nop */
-        /* 021C726C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
+        /* 021C726C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
         /* 021C7270 */ _t107 = cpu->r[1] + 0x00000020u;
         /* 021C7270 */ rbrew_write_f32(cpu->mem, _t107, cpu->f[10]);
-        /* 021C7274 */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C7274 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C7274 */ _t109 = _t108 & 0x00000001u;
         /* 021C7274 */ if (_t109) goto L_021C7294; else goto L_021C7278;
   L_021C7278: ; // 0x21c7278
@@ -17747,8 +17747,8 @@ void Gambit_fn_021DBB0C(CPUState* cpu) {
         /* 021C7280 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t110);
         /* 021C7284 */ /* nop */
         /* 021C7288 */ cpu->f[13] = fma(cpu->f[12], cpu->f[10], cpu->f[9]);
-        /* 021C728C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[30]);
-        /* 021C7290 */ _t111 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021C728C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[30]));
+        /* 021C7290 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021C7290 */ _t112 = _t111 & 0x00000001u;
         /* 021C7290 */ if (_t112) goto L_021C7294; else goto L_021C7308;
   L_021C7294: ; // 0x21c7294
@@ -17757,10 +17757,10 @@ void Gambit_fn_021DBB0C(CPUState* cpu) {
         /* 021C7298 */ cpu->r[11] = cpu->r[19] + cpu->r[12];
         /* 021C729C */ _t114 = cpu->r[11] + 0x00000104u;
         /* 021C729C */ cpu->r[4] = rbrew_read8(cpu->mem, _t114);
-        /* 021C72A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 021C72A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 021C72A4 */ _t115 = cpu->r[22] + 0x00000040u;
         /* 021C72A4 */ cpu->r[5] = rbrew_read8(cpu->mem, _t115);
-        /* 021C72A8 */ _t116 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C72A8 */ _t116 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C72A8 */ _t117 = _t116 & 0x00000001u;
         /* 021C72A8 */ if (_t117) goto L_021C7308; else goto L_021C72AC;
   L_021C72AC: ; // 0x21c72ac
@@ -17768,8 +17768,8 @@ void Gambit_fn_021DBB0C(CPUState* cpu) {
         /* 021C72B0 */ cpu->r[6] = cpu->r[1] + 0x00000024u;
         /* 021C72B4 */ cpu->r[3] = cpu->r[19];
         /* 021C72B8 */ Gambit_fn_021F000C(cpu);
-        /* 021C72BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021C72C0 */ _t118 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021C72BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021C72C0 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021C72C0 */ _t119 = _t118 & 0x00000001u;
         /* 021C72C0 */ if (_t119) goto L_021C7308; else goto L_021C72C4;
   L_021C72C4: ; // 0x21c72c4
@@ -17805,8 +17805,8 @@ void Gambit_fn_021DBB0C(CPUState* cpu) {
         /* 021C7308 */ _t131 = cpu->r[22] + 0x00000004u;
         /* 021C7308 */ cpu->r[10] = rbrew_read32(cpu->mem, _t131);
         /* 021C730C */ cpu->r[18] = cpu->r[18] + 0x00000001u;
-        /* 021C7310 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[18], cpu->r[10]);
-        /* 021C7314 */ _t132 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C7310 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[18], cpu->r[10]));
+        /* 021C7314 */ _t132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C7314 */ _t133 = _t132 & 0x00000001u;
         /* 021C7314 */ if (_t133) goto L_021C7054; else goto L_021C7318;
   L_021C7318: ; // 0x21c7318
@@ -17835,7 +17835,7 @@ void Gambit_fn_021DBB0C(CPUState* cpu) {
         /* 021C7344 */ cpu->f[26] = rbrew_read_f64(cpu->mem, _t144);
         /* 021C7348 */ _t145 = cpu->r[1] + 0x00000138u;
         /* 021C7348 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t145);
-        /* 021C734C */ _t146 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021C734C */ _t146 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021C734C */ _t147 = _t146 & 0x00000001u;
         /* 021C734C */ if (_t147) goto L_021C7350; // else: addr-0 trap, fall-through
   L_021C7350: ; // 0x21c7350
@@ -17887,9 +17887,9 @@ void Gambit_fn_021DBB18(CPUState* cpu) {
         /* 021DBB64 */ _t8 = cpu->r[7] + 0x00000104u;
         /* 021DBB64 */ cpu->r[4] = rbrew_read8(cpu->mem, _t8);
         /* 021DBB68 */ cpu->r[28] = cpu->r[5];
-        /* 021DBB6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 021DBB6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 021DBB70 */ cpu->r[31] = cpu->r[8];
-        /* 021DBB74 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DBB74 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DBB74 */ _t10 = _t9 & 0x00000001u;
         /* 021DBB74 */ if (_t10) goto L_021DBD0C; else goto L_021DBB78;
   L_021DBB78: ; // 0x21dbb78
@@ -17899,8 +17899,8 @@ void Gambit_fn_021DBB18(CPUState* cpu) {
         /* 021DBB84 */ cpu->r[5] = cpu->r[31];
         /* 021DBB88 */ Gambit_fn_021F000C(cpu);
         /* 021DBB8C */ cpu->r[26] = cpu->r[3];
-        /* 021DBB8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 021DBB90 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DBB8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 021DBB90 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DBB90 */ _t12 = _t11 & 0x00000001u;
         /* 021DBB90 */ if (_t12) goto L_021DBD0C; else goto L_021DBB94;
   L_021DBB94: ; // 0x21dbb94
@@ -17990,11 +17990,11 @@ void Gambit_fn_021DBB18(CPUState* cpu) {
         /* 021DBC70 */ cpu->r[8] = cpu->r[27] + 0x000001A0u;
         /* 021DBC74 */ _t41 = cpu->r[1] + 0x000000C8u;
         /* 021DBC74 */ rbrew_write_f32(cpu->mem, _t41, cpu->f[0]);
-        /* 021DBC78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021DBC78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021DBC7C */ cpu->r[5] = cpu->r[28];
         /* 021DBC80 */ _t42 = cpu->r[1] + 0x000000C0u;
         /* 021DBC80 */ rbrew_write_f32(cpu->mem, _t42, cpu->f[9]);
-        /* 021DBC84 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DBC84 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DBC84 */ _t44 = _t43 & 0x00000001u;
         /* 021DBC84 */ if (_t44) goto L_021DBCCC; else goto L_021DBC88;
   L_021DBC88: ; // 0x21dbc88
@@ -18230,7 +18230,7 @@ void Gambit_fn_021DBB18(CPUState* cpu) {
         /* 021DBEB0 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t133);
         /* 021DBEB4 */ _t134 = cpu->r[1] + 0x000000F0u;
         /* 021DBEB4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t134);
-        /* 021DBEB8 */ _t135 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DBEB8 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DBEB8 */ _t136 = _t135 & 0x00000001u;
         /* 021DBEB8 */ if (_t136) goto L_021DBEBC; // else: addr-0 trap, fall-through
   L_021DBEBC: ; // 0x21dbebc
@@ -18266,8 +18266,8 @@ void Gambit_fn_021DBECC(CPUState* cpu) {
         /* 021DBEF0 */ cpu->r[29] = cpu->r[3];
         /* 021DBEF4 */ cpu->r[30] = cpu->r[4];
         /* 021DBEF8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021DBEFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DBF00 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DBEFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DBF00 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DBF00 */ _t8 = _t7 & 0x00000001u;
         /* 021DBF00 */ if (_t8) goto L_021DBF04; else goto L_021DBFEC;
   L_021DBF04: ; // 0x21dbf04
@@ -18398,8 +18398,8 @@ void Gambit_fn_021DBED0(CPUState* cpu) {
         /* 021DBEF0 */ cpu->r[29] = cpu->r[3];
         /* 021DBEF4 */ cpu->r[30] = cpu->r[4];
         /* 021DBEF8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021DBEFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DBF00 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DBEFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DBF00 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DBF00 */ _t8 = _t7 & 0x00000001u;
         /* 021DBF00 */ if (_t8) goto L_021DBF04; else goto L_021DBFEC;
   L_021DBF04: ; // 0x21dbf04
@@ -18525,25 +18525,25 @@ void Gambit_fn_021DC008(CPUState* cpu) {
         /* 021DC020 */ _t4 = cpu->r[30] + 0x00000129u;
         /* 021DC020 */ cpu->r[0] = rbrew_read8(cpu->mem, _t4);
         /* 021DC024 */ cpu->r[31] = 0x101F0000u;
-        /* 021DC028 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021DC028 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021DC02C */ cpu->r[31] = cpu->r[31] + 0x00006350u;
-        /* 021DC030 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC030 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC030 */ _t6 = _t5 & 0x00000001u;
         /* 021DC030 */ if (_t6) goto L_021DC05C; else goto L_021DC034;
   L_021DC034: ; // 0x21dc034
         /* 021DC034 */ _t7 = cpu->r[30] + 0x00000114u;
         /* 021DC034 */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
         /* 021DC038 */ cpu->r[12] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 021DC038 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021DC03C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC038 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021DC03C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC03C */ _t9 = _t8 & 0x00000001u;
         /* 021DC03C */ if (_t9) goto L_021DC040; else goto L_021DC05C;
   L_021DC040: ; // 0x21dc040
         /* 021DC040 */ _t10 = cpu->r[30] + 0x00000128u;
         /* 021DC040 */ cpu->r[9] = rbrew_read8(cpu->mem, _t10);
-        /* 021DC044 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021DC044 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021DC048 */ cpu->r[4] = cpu->r[31];
-        /* 021DC04C */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC04C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC04C */ _t12 = _t11 & 0x00000001u;
         /* 021DC04C */ if (_t12) goto L_021DC054; else goto L_021DC050;
   L_021DC050: ; // 0x21dc050
@@ -18561,8 +18561,8 @@ void Gambit_fn_021DC008(CPUState* cpu) {
         /* 021DC070 */ Gambit_fn_0222C57C(cpu);
         /* 021DC074 */ _t14 = cpu->r[30] + 0x00000128u;
         /* 021DC074 */ cpu->r[0] = rbrew_read8(cpu->mem, _t14);
-        /* 021DC078 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021DC07C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC078 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021DC07C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC07C */ _t16 = _t15 & 0x00000001u;
         /* 021DC07C */ if (_t16) goto L_021DC080; else goto L_021DC090;
   L_021DC080: ; // 0x21dc080
@@ -18574,38 +18574,38 @@ void Gambit_fn_021DC008(CPUState* cpu) {
   L_021DC090: ; // 0x21dc090
         /* 021DC090 */ _t18 = cpu->r[30] + 0x0000001Cu;
         /* 021DC090 */ cpu->r[10] = rbrew_read32(cpu->mem, _t18);
-        /* 021DC094 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
-        /* 021DC098 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC094 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
+        /* 021DC098 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC098 */ _t20 = _t19 & 0x00000001u;
         /* 021DC098 */ if (_t20) goto L_021DC0A4; else goto L_021DC09C;
   L_021DC09C: ; // 0x21dc09c
-        /* 021DC09C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000003u);
-        /* 021DC0A0 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC09C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000003u));
+        /* 021DC0A0 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC0A0 */ _t22 = _t21 & 0x00000001u;
         /* 021DC0A0 */ if (_t22) goto L_021DC0A4; else goto L_021DC0F8;
   L_021DC0A4: ; // 0x21dc0a4
         /* 021DC0A4 */ _t23 = cpu->r[30] + 0x00000114u;
         /* 021DC0A4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t23);
         /* 021DC0A8 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 021DC0A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021DC0AC */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC0A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021DC0AC */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC0AC */ _t25 = _t24 & 0x00000001u;
         /* 021DC0AC */ if (_t25) goto L_021DC0B0; else goto L_021DC0F8;
   L_021DC0B0: ; // 0x21dc0b0
         /* 021DC0B0 */ _t26 = cpu->r[30] + 0x00000190u;
         /* 021DC0B0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t26);
         /* 021DC0B4 */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 021DC0B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x0000012Cu);
+        /* 021DC0B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x0000012Cu));
         /* 021DC0BC */ _t27 = cpu->r[30] + 0x00000190u;
         /* 021DC0BC */ rbrew_write32(cpu->mem, _t27, cpu->r[9]);
-        /* 021DC0C0 */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DC0C0 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DC0C0 */ _t29 = _t28 & 0x00000001u;
         /* 021DC0C0 */ if (_t29) goto L_021DC0F8; else goto L_021DC0C4;
   L_021DC0C4: ; // 0x21dc0c4
         /* 021DC0C4 */ _t30 = cpu->r[30] + 0x00000128u;
         /* 021DC0C4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t30);
-        /* 021DC0C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021DC0CC */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC0C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021DC0CC */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC0CC */ _t32 = _t31 & 0x00000001u;
         /* 021DC0CC */ if (_t32) goto L_021DC0D4; else goto L_021DC0D0;
   L_021DC0D0: ; // 0x21dc0d0
@@ -18633,21 +18633,21 @@ void Gambit_fn_021DC008(CPUState* cpu) {
         /* 021DC108 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021DC10C */ _t38 = cpu->r[30] + 0x0000001Cu;
         /* 021DC10C */ cpu->r[10] = rbrew_read32(cpu->mem, _t38);
-        /* 021DC110 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
-        /* 021DC114 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC110 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
+        /* 021DC114 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC114 */ _t40 = _t39 & 0x00000001u;
         /* 021DC114 */ if (_t40) goto L_021DC120; else goto L_021DC118;
   L_021DC118: ; // 0x21dc118
-        /* 021DC118 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000003u);
-        /* 021DC11C */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC118 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000003u));
+        /* 021DC11C */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC11C */ _t42 = _t41 & 0x00000001u;
         /* 021DC11C */ if (_t42) goto L_021DC120; else goto L_021DC180;
   L_021DC120: ; // 0x21dc120
         /* 021DC120 */ _t43 = cpu->r[30] + 0x00000114u;
         /* 021DC120 */ cpu->r[12] = rbrew_read32(cpu->mem, _t43);
         /* 021DC124 */ cpu->r[12] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 021DC124 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021DC128 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC124 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021DC128 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC128 */ _t45 = _t44 & 0x00000001u;
         /* 021DC128 */ if (_t45) goto L_021DC12C; else goto L_021DC180;
   L_021DC12C: ; // 0x21dc12c
@@ -18716,25 +18716,25 @@ void Gambit_fn_021DC00C(CPUState* cpu) {
         /* 021DC020 */ _t4 = cpu->r[30] + 0x00000129u;
         /* 021DC020 */ cpu->r[0] = rbrew_read8(cpu->mem, _t4);
         /* 021DC024 */ cpu->r[31] = 0x101F0000u;
-        /* 021DC028 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021DC028 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021DC02C */ cpu->r[31] = cpu->r[31] + 0x00006350u;
-        /* 021DC030 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC030 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC030 */ _t6 = _t5 & 0x00000001u;
         /* 021DC030 */ if (_t6) goto L_021DC05C; else goto L_021DC034;
   L_021DC034: ; // 0x21dc034
         /* 021DC034 */ _t7 = cpu->r[30] + 0x00000114u;
         /* 021DC034 */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
         /* 021DC038 */ cpu->r[12] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 021DC038 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021DC03C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC038 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021DC03C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC03C */ _t9 = _t8 & 0x00000001u;
         /* 021DC03C */ if (_t9) goto L_021DC040; else goto L_021DC05C;
   L_021DC040: ; // 0x21dc040
         /* 021DC040 */ _t10 = cpu->r[30] + 0x00000128u;
         /* 021DC040 */ cpu->r[9] = rbrew_read8(cpu->mem, _t10);
-        /* 021DC044 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021DC044 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021DC048 */ cpu->r[4] = cpu->r[31];
-        /* 021DC04C */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC04C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC04C */ _t12 = _t11 & 0x00000001u;
         /* 021DC04C */ if (_t12) goto L_021DC054; else goto L_021DC050;
   L_021DC050: ; // 0x21dc050
@@ -18752,8 +18752,8 @@ void Gambit_fn_021DC00C(CPUState* cpu) {
         /* 021DC070 */ Gambit_fn_0222C57C(cpu);
         /* 021DC074 */ _t14 = cpu->r[30] + 0x00000128u;
         /* 021DC074 */ cpu->r[0] = rbrew_read8(cpu->mem, _t14);
-        /* 021DC078 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021DC07C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC078 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021DC07C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC07C */ _t16 = _t15 & 0x00000001u;
         /* 021DC07C */ if (_t16) goto L_021DC080; else goto L_021DC090;
   L_021DC080: ; // 0x21dc080
@@ -18765,38 +18765,38 @@ void Gambit_fn_021DC00C(CPUState* cpu) {
   L_021DC090: ; // 0x21dc090
         /* 021DC090 */ _t18 = cpu->r[30] + 0x0000001Cu;
         /* 021DC090 */ cpu->r[10] = rbrew_read32(cpu->mem, _t18);
-        /* 021DC094 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
-        /* 021DC098 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC094 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
+        /* 021DC098 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC098 */ _t20 = _t19 & 0x00000001u;
         /* 021DC098 */ if (_t20) goto L_021DC0A4; else goto L_021DC09C;
   L_021DC09C: ; // 0x21dc09c
-        /* 021DC09C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000003u);
-        /* 021DC0A0 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC09C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000003u));
+        /* 021DC0A0 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC0A0 */ _t22 = _t21 & 0x00000001u;
         /* 021DC0A0 */ if (_t22) goto L_021DC0A4; else goto L_021DC0F8;
   L_021DC0A4: ; // 0x21dc0a4
         /* 021DC0A4 */ _t23 = cpu->r[30] + 0x00000114u;
         /* 021DC0A4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t23);
         /* 021DC0A8 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 021DC0A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021DC0AC */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC0A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021DC0AC */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC0AC */ _t25 = _t24 & 0x00000001u;
         /* 021DC0AC */ if (_t25) goto L_021DC0B0; else goto L_021DC0F8;
   L_021DC0B0: ; // 0x21dc0b0
         /* 021DC0B0 */ _t26 = cpu->r[30] + 0x00000190u;
         /* 021DC0B0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t26);
         /* 021DC0B4 */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 021DC0B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x0000012Cu);
+        /* 021DC0B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x0000012Cu));
         /* 021DC0BC */ _t27 = cpu->r[30] + 0x00000190u;
         /* 021DC0BC */ rbrew_write32(cpu->mem, _t27, cpu->r[9]);
-        /* 021DC0C0 */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DC0C0 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DC0C0 */ _t29 = _t28 & 0x00000001u;
         /* 021DC0C0 */ if (_t29) goto L_021DC0F8; else goto L_021DC0C4;
   L_021DC0C4: ; // 0x21dc0c4
         /* 021DC0C4 */ _t30 = cpu->r[30] + 0x00000128u;
         /* 021DC0C4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t30);
-        /* 021DC0C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021DC0CC */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC0C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021DC0CC */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC0CC */ _t32 = _t31 & 0x00000001u;
         /* 021DC0CC */ if (_t32) goto L_021DC0D4; else goto L_021DC0D0;
   L_021DC0D0: ; // 0x21dc0d0
@@ -18824,21 +18824,21 @@ void Gambit_fn_021DC00C(CPUState* cpu) {
         /* 021DC108 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021DC10C */ _t38 = cpu->r[30] + 0x0000001Cu;
         /* 021DC10C */ cpu->r[10] = rbrew_read32(cpu->mem, _t38);
-        /* 021DC110 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
-        /* 021DC114 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC110 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
+        /* 021DC114 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC114 */ _t40 = _t39 & 0x00000001u;
         /* 021DC114 */ if (_t40) goto L_021DC120; else goto L_021DC118;
   L_021DC118: ; // 0x21dc118
-        /* 021DC118 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000003u);
-        /* 021DC11C */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC118 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000003u));
+        /* 021DC11C */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC11C */ _t42 = _t41 & 0x00000001u;
         /* 021DC11C */ if (_t42) goto L_021DC120; else goto L_021DC180;
   L_021DC120: ; // 0x21dc120
         /* 021DC120 */ _t43 = cpu->r[30] + 0x00000114u;
         /* 021DC120 */ cpu->r[12] = rbrew_read32(cpu->mem, _t43);
         /* 021DC124 */ cpu->r[12] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 021DC124 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021DC128 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC124 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021DC128 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC128 */ _t45 = _t44 & 0x00000001u;
         /* 021DC128 */ if (_t45) goto L_021DC12C; else goto L_021DC180;
   L_021DC12C: ; // 0x21dc12c
@@ -18898,8 +18898,8 @@ void Gambit_fn_021DC1A0(CPUState* cpu) {
         /* 021DC1A0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021DC1A4 */ _t1 = cpu->r[5] + 0x00000000u;
         /* 021DC1A4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
-        /* 021DC1A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
-        /* 021DC1AC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC1A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
+        /* 021DC1AC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC1AC */ _t3 = _t2 & 0x00000001u;
         /* 021DC1AC */ if (_t3) goto L_021DC1B0; else goto L_021DC1BC;
   L_021DC1B0: ; // 0x21dc1b0
@@ -18931,10 +18931,10 @@ void Gambit_fn_021DC1C8(CPUState* cpu) {
         /* 021DC1DC */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 021DC1E0 */ cpu->r[30] = cpu->r[3];
         /* 021DC1E4 */ cpu->r[31] = cpu->r[31] + 0x00006350u;
-        /* 021DC1E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x0000000Fu);
+        /* 021DC1E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x0000000Fu));
         /* 021DC1EC */ _t3 = cpu->r[1] + 0x00000014u;
         /* 021DC1EC */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 021DC1F0 */ _t4 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DC1F0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DC1F0 */ _t5 = _t4 & 0x00000001u;
         /* 021DC1F0 */ if (_t5) goto L_021DC2AC; else goto L_021DC1F4;
   L_021DC1F4: ; // 0x21dc1f4
@@ -18946,15 +18946,15 @@ void Gambit_fn_021DC1C8(CPUState* cpu) {
   L_021DC2AC: ; // 0x21dc2ac
         /* 021DC2AC */ cpu->r[3] = cpu->r[4];
         /* 021DC2B0 */ Gambit_fn_021BCF9C(cpu);
-        /* 021DC2B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DC2B8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC2B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DC2B8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC2B8 */ _t7 = _t6 & 0x00000001u;
         /* 021DC2B8 */ if (_t7) goto L_021DC370; else goto L_021DC2BC;
   L_021DC2BC: ; // 0x21dc2bc
         /* 021DC2BC */ _t8 = cpu->r[30] + 0x00000128u;
         /* 021DC2BC */ cpu->r[8] = rbrew_read8(cpu->mem, _t8);
-        /* 021DC2C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021DC2C4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC2C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021DC2C4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC2C4 */ _t10 = _t9 & 0x00000001u;
         /* 021DC2C4 */ if (_t10) goto L_021DC2CC; else goto L_021DC2C8;
   L_021DC2C8: ; // 0x21dc2c8
@@ -19002,10 +19002,10 @@ void Gambit_fn_021DC1CC(CPUState* cpu) {
         /* 021DC1DC */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 021DC1E0 */ cpu->r[30] = cpu->r[3];
         /* 021DC1E4 */ cpu->r[31] = cpu->r[31] + 0x00006350u;
-        /* 021DC1E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x0000000Fu);
+        /* 021DC1E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x0000000Fu));
         /* 021DC1EC */ _t3 = cpu->r[1] + 0x00000014u;
         /* 021DC1EC */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 021DC1F0 */ _t4 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DC1F0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DC1F0 */ _t5 = _t4 & 0x00000001u;
         /* 021DC1F0 */ if (_t5) goto L_021DC2AC; else goto L_021DC1F4;
   L_021DC1F4: ; // 0x21dc1f4
@@ -19017,15 +19017,15 @@ void Gambit_fn_021DC1CC(CPUState* cpu) {
   L_021DC2AC: ; // 0x21dc2ac
         /* 021DC2AC */ cpu->r[3] = cpu->r[4];
         /* 021DC2B0 */ Gambit_fn_021BCF9C(cpu);
-        /* 021DC2B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DC2B8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC2B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DC2B8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC2B8 */ _t7 = _t6 & 0x00000001u;
         /* 021DC2B8 */ if (_t7) goto L_021DC370; else goto L_021DC2BC;
   L_021DC2BC: ; // 0x21dc2bc
         /* 021DC2BC */ _t8 = cpu->r[30] + 0x00000128u;
         /* 021DC2BC */ cpu->r[8] = rbrew_read8(cpu->mem, _t8);
-        /* 021DC2C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021DC2C4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC2C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021DC2C4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC2C4 */ _t10 = _t9 & 0x00000001u;
         /* 021DC2C4 */ if (_t10) goto L_021DC2CC; else goto L_021DC2C8;
   L_021DC2C8: ; // 0x21dc2c8
@@ -19126,19 +19126,19 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DC420 */ _t22 = cpu->r[9] + 0x00001480u;
         /* 021DC420 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t22);
         /* 021DC424 */ cpu->r[9] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021DC424 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021DC424 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021DC428 */ _t23 = cpu->r[7] + 0x00001484u;
         /* 021DC428 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t23);
-        /* 021DC42C */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC42C */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC42C */ _t25 = _t24 & 0x00000001u;
         /* 021DC42C */ if (_t25) goto L_021DC468; else goto L_021DC430;
   L_021DC430: ; // 0x21dc430
         /* 021DC430 */ cpu->r[3] = cpu->r[30] + 0x0000012Cu;
         /* 021DC434 */ Gambit_fn_02C69350(cpu);
-        /* 021DC438 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 021DC438 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 021DC43C */ _t26 = cpu->r[30] + 0x00000000u;
         /* 021DC43C */ cpu->r[9] = rbrew_read32(cpu->mem, _t26);
-        /* 021DC440 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DC440 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DC440 */ _t28 = _t27 & 0x00000001u;
         /* 021DC440 */ if (_t28) goto L_021DC444; else goto L_021DC460;
   L_021DC444: ; // 0x21dc444
@@ -19169,10 +19169,10 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DC47C */ _t37 = cpu->r[31] + 0x00000008u;
         /* 021DC47C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t37);
         /* 021DC480 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000019u, 0x00000019u);
-        /* 021DC480 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021DC480 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021DC484 */ _t38 = cpu->r[29] + 0x00000180u;
         /* 021DC484 */ rbrew_write_f32(cpu->mem, _t38, cpu->f[13]);
-        /* 021DC488 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC488 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC488 */ _t40 = _t39 & 0x00000001u;
         /* 021DC488 */ if (_t40) goto L_021DC4A8; else goto L_021DC48C;
   L_021DC48C: ; // 0x21dc48c
@@ -19196,13 +19196,13 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DC4AC */ cpu->r[8] = 0x10030000u;
         /* 021DC4B0 */ _t48 = cpu->r[29] + 0x00000184u;
         /* 021DC4B0 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t48);
-        /* 021DC4B4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[12]);
+        /* 021DC4B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[12]));
         /* 021DC4B8 */ _t49 = cpu->r[8] + 0x00001478u;
         /* 021DC4B8 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t49);
         /* 021DC4BC */ cpu->r[12] = 0x10030000u;
         /* 021DC4C0 */ _t50 = cpu->r[12] + 0x00001528u;
         /* 021DC4C0 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t50);
-        /* 021DC4C4 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC4C4 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC4C4 */ _t52 = _t51 & 0x00000001u;
         /* 021DC4C4 */ if (_t52) goto L_021DC4C8; else goto L_021DC4E8;
   L_021DC4C8: ; // 0x21dc4c8
@@ -19210,8 +19210,8 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DC4C8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t53);
         /* 021DC4CC */ _t54 = cpu->r[29] + 0x0000017Cu;
         /* 021DC4CC */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t54);
-        /* 021DC4D0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[8]);
-        /* 021DC4D4 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC4D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[8]));
+        /* 021DC4D4 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC4D4 */ _t56 = _t55 & 0x00000001u;
         /* 021DC4D4 */ if (_t56) goto L_021DC4D8; else goto L_021DC4E8;
   L_021DC4D8: ; // 0x21dc4d8
@@ -19219,8 +19219,8 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DC4D8 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t57);
         /* 021DC4DC */ _t58 = cpu->r[29] + 0x00000180u;
         /* 021DC4DC */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t58);
-        /* 021DC4E0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[12]);
-        /* 021DC4E4 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC4E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[12]));
+        /* 021DC4E4 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC4E4 */ _t60 = _t59 & 0x00000001u;
         /* 021DC4E4 */ if (_t60) goto L_021DCC60; else goto L_021DC4E8;
   L_021DC4E8: ; // 0x21dc4e8
@@ -19252,8 +19252,8 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DC524 */ _t71 = cpu->r[1] + 0x00000010u;
         /* 021DC524 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t71);
         /* 021DC528 */ cpu->f[12] = fma(cpu->f[9], cpu->f[9], cpu->f[8]);
-        /* 021DC52C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[30]);
-        /* 021DC530 */ _t72 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DC52C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[30]));
+        /* 021DC530 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DC530 */ _t73 = _t72 & 0x00000001u;
         /* 021DC530 */ if (_t73) goto L_021DC534; else goto L_021DC560;
   L_021DC534: ; // 0x21dc534
@@ -19286,8 +19286,8 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DC580 */ _t80 = cpu->r[1] + 0x0000001Cu;
         /* 021DC580 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t80);
         /* 021DC584 */ cpu->f[0] = fma(cpu->f[8], cpu->f[8], cpu->f[0]);
-        /* 021DC588 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[30]);
-        /* 021DC58C */ _t81 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DC588 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[30]));
+        /* 021DC58C */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DC58C */ _t82 = _t81 & 0x00000001u;
         /* 021DC58C */ if (_t82) goto L_021DC590; else goto L_021DC5C4;
   L_021DC590: ; // 0x21dc590
@@ -19397,15 +19397,15 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DC698 */ cpu->f[9] = fma(cpu->f[12], cpu->f[12], cpu->f[13]);
         /* 021DC69C */ _t119 = cpu->r[6] + 0x0000158Cu;
         /* 021DC69C */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t119);
-        /* 021DC6A0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[8]);
+        /* 021DC6A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[8]));
         /* 021DC6A4 */ _t120 = cpu->r[1] + 0x00000028u;
         /* 021DC6A4 */ rbrew_write_f32(cpu->mem, _t120, cpu->f[12]);
-        /* 021DC6A8 */ _t121 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DC6A8 */ _t121 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DC6A8 */ _t122 = _t121 & 0x00000001u;
         /* 021DC6A8 */ if (_t122) goto L_021DC918; else goto L_021DC6AC;
   L_021DC6AC: ; // 0x21dc6ac
-        /* 021DC6AC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[30]);
-        /* 021DC6B0 */ _t123 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DC6AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[30]));
+        /* 021DC6B0 */ _t123 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DC6B0 */ _t124 = _t123 & 0x00000001u;
         /* 021DC6B0 */ if (_t124) goto L_021DC6B4; else goto L_021DC6E8;
   L_021DC6B4: ; // 0x21dc6b4
@@ -19440,13 +19440,13 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DC708 */ Gambit_fn_02C692EC(cpu);
         /* 021DC70C */ cpu->r[3] = cpu->r[1] + 0x0000008Cu;
         /* 021DC710 */ Gambit_fn_02C69350(cpu);
-        /* 021DC714 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[25], cpu->f[30]);
-        /* 021DC718 */ _t131 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC714 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[25], cpu->f[30]));
+        /* 021DC718 */ _t131 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC718 */ _t132 = _t131 & 0x00000001u;
         /* 021DC718 */ if (_t132) goto L_021DC71C; else goto L_021DC760;
   L_021DC71C: ; // 0x21dc71c
-        /* 021DC71C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
-        /* 021DC720 */ _t133 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DC71C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
+        /* 021DC720 */ _t133 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DC720 */ _t134 = _t133 & 0x00000001u;
         /* 021DC720 */ if (_t134) goto L_021DC724; else goto L_021DC760;
   L_021DC724: ; // 0x21dc724
@@ -19464,25 +19464,25 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DC74C */ _t136 = cpu->r[29] + 0x00000180u;
         /* 021DC74C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t136);
         /* 021DC750 */ cpu->f[0] = fma(cpu->f[12], cpu->f[13], cpu->f[9]);
-        /* 021DC754 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[30]);
-        /* 021DC758 */ _t137 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DC754 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[30]));
+        /* 021DC758 */ _t137 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DC758 */ _t138 = _t137 & 0x00000001u;
         /* 021DC758 */ if (_t138) goto L_021DC75C; else goto L_021DC8F8;
   L_021DC75C: ; // 0x21dc75c
         /* 021DC75C */ goto L_021DC8F4;
   L_021DC760: ; // 0x21dc760
-        /* 021DC760 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[25], cpu->f[30]);
-        /* 021DC764 */ _t139 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DC760 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[25], cpu->f[30]));
+        /* 021DC764 */ _t139 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DC764 */ _t140 = _t139 & 0x00000001u;
         /* 021DC764 */ if (_t140) goto L_021DC810; else goto L_021DC768;
   L_021DC768: ; // 0x21dc768
-        /* 021DC768 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
-        /* 021DC76C */ _t141 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DC768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
+        /* 021DC76C */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DC76C */ _t142 = _t141 & 0x00000001u;
         /* 021DC76C */ if (_t142) goto L_021DC7BC; else goto L_021DC770;
   L_021DC770: ; // 0x21dc770
-        /* 021DC770 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[25], cpu->f[1]);
-        /* 021DC774 */ _t143 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DC770 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[25], cpu->f[1]));
+        /* 021DC774 */ _t143 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DC774 */ _t144 = _t143 & 0x00000001u;
         /* 021DC774 */ if (_t144) goto L_021DC798; else goto L_021DC778;
   L_021DC778: ; // 0x21dc778
@@ -19491,8 +19491,8 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DC780 */ cpu->r[0] = 0x02220000u;
         /* 021DC784 */ cpu->r[31] = cpu->r[3];
         /* 021DC788 */ cpu->r[0] = cpu->r[0] | 0x00002224u;
-        /* 021DC78C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 021DC790 */ _t145 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DC78C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 021DC790 */ _t145 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DC790 */ _t146 = _t145 & 0x00000001u;
         /* 021DC790 */ if (_t146) goto L_021DC794; else goto L_021DC8C0;
   L_021DC794: ; // 0x21dc794
@@ -19504,16 +19504,16 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DC7A4 */ cpu->r[0] = 0x02220000u;
         /* 021DC7A8 */ cpu->r[31] = cpu->r[31] + 0x40000000u;
         /* 021DC7AC */ cpu->r[0] = cpu->r[0] | 0x00002224u;
-        /* 021DC7B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 021DC7B4 */ _t147 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DC7B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 021DC7B4 */ _t147 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DC7B4 */ _t148 = _t147 & 0x00000001u;
         /* 021DC7B4 */ if (_t148) goto L_021DC7B8; else goto L_021DC8C0;
   L_021DC7B8: ; // 0x21dc7b8
         /* 021DC7B8 */ goto L_021DC8B8;
   L_021DC7BC: ; // 0x21dc7bc
         /* 021DC7BC */ cpu->f[6] = -cpu->f[1];
-        /* 021DC7C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[25], cpu->f[6]);
-        /* 021DC7C4 */ _t149 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DC7C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[25], cpu->f[6]));
+        /* 021DC7C4 */ _t149 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DC7C4 */ _t150 = _t149 & 0x00000001u;
         /* 021DC7C4 */ if (_t150) goto L_021DC7EC; else goto L_021DC7C8;
   L_021DC7C8: ; // 0x21dc7c8
@@ -19523,8 +19523,8 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DC7D4 */ cpu->r[0] = 0x02220000u;
         /* 021DC7D8 */ cpu->r[31] = (uint32_t)(-(int32_t)cpu->r[3]);
         /* 021DC7DC */ cpu->r[0] = cpu->r[0] | 0x00002224u;
-        /* 021DC7E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 021DC7E4 */ _t151 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DC7E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 021DC7E4 */ _t151 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DC7E4 */ _t152 = _t151 & 0x00000001u;
         /* 021DC7E4 */ if (_t152) goto L_021DC7E8; else goto L_021DC8C0;
   L_021DC7E8: ; // 0x21dc7e8
@@ -19536,21 +19536,21 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DC7F8 */ cpu->r[0] = 0x02220000u;
         /* 021DC7FC */ cpu->r[31] = cpu->r[3] + 0xC0000000u;
         /* 021DC800 */ cpu->r[0] = cpu->r[0] | 0x00002224u;
-        /* 021DC804 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 021DC808 */ _t153 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DC804 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 021DC808 */ _t153 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DC808 */ _t154 = _t153 & 0x00000001u;
         /* 021DC808 */ if (_t154) goto L_021DC80C; else goto L_021DC8C0;
   L_021DC80C: ; // 0x21dc80c
         /* 021DC80C */ goto L_021DC8B8;
   L_021DC810: ; // 0x21dc810
-        /* 021DC810 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
-        /* 021DC814 */ _t155 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DC810 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
+        /* 021DC814 */ _t155 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DC814 */ _t156 = _t155 & 0x00000001u;
         /* 021DC814 */ if (_t156) goto L_021DC870; else goto L_021DC818;
   L_021DC818: ; // 0x21dc818
         /* 021DC818 */ cpu->f[12] = -cpu->f[25];
-        /* 021DC81C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[1]);
-        /* 021DC820 */ _t157 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DC81C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[1]));
+        /* 021DC820 */ _t157 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DC820 */ _t158 = _t157 & 0x00000001u;
         /* 021DC820 */ if (_t158) goto L_021DC84C; else goto L_021DC824;
   L_021DC824: ; // 0x21dc824
@@ -19561,8 +19561,8 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DC834 */ cpu->r[0] = 0x02220000u;
         /* 021DC838 */ cpu->r[31] = cpu->r[31] + 0x80000000u;
         /* 021DC83C */ cpu->r[0] = cpu->r[0] | 0x00002224u;
-        /* 021DC840 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 021DC844 */ _t159 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DC840 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 021DC844 */ _t159 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DC844 */ _t160 = _t159 & 0x00000001u;
         /* 021DC844 */ if (_t160) goto L_021DC848; else goto L_021DC8C0;
   L_021DC848: ; // 0x21dc848
@@ -19574,15 +19574,15 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DC858 */ cpu->r[0] = 0x02220000u;
         /* 021DC85C */ cpu->r[31] = cpu->r[3] + 0x40000000u;
         /* 021DC860 */ cpu->r[0] = cpu->r[0] | 0x00002224u;
-        /* 021DC864 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 021DC868 */ _t161 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DC864 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 021DC868 */ _t161 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DC868 */ _t162 = _t161 & 0x00000001u;
         /* 021DC868 */ if (_t162) goto L_021DC86C; else goto L_021DC8C0;
   L_021DC86C: ; // 0x21dc86c
         /* 021DC86C */ goto L_021DC8B8;
   L_021DC870: ; // 0x21dc870
-        /* 021DC870 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[25], cpu->f[1]);
-        /* 021DC874 */ _t163 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DC870 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[25], cpu->f[1]));
+        /* 021DC874 */ _t163 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DC874 */ _t164 = _t163 & 0x00000001u;
         /* 021DC874 */ if (_t164) goto L_021DC898; else goto L_021DC878;
   L_021DC878: ; // 0x21dc878
@@ -19591,8 +19591,8 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DC880 */ cpu->r[0] = 0x02220000u;
         /* 021DC884 */ cpu->r[31] = cpu->r[3] + 0x80000000u;
         /* 021DC888 */ cpu->r[0] = cpu->r[0] | 0x00002224u;
-        /* 021DC88C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 021DC890 */ _t165 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DC88C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 021DC890 */ _t165 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DC890 */ _t166 = _t165 & 0x00000001u;
         /* 021DC890 */ if (_t166) goto L_021DC894; else goto L_021DC8C0;
   L_021DC894: ; // 0x21dc894
@@ -19604,8 +19604,8 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DC8A4 */ cpu->r[0] = 0x02220000u;
         /* 021DC8A8 */ cpu->r[31] = cpu->r[31] + 0xC0000000u;
         /* 021DC8AC */ cpu->r[0] = cpu->r[0] | 0x00002224u;
-        /* 021DC8B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 021DC8B4 */ _t167 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DC8B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 021DC8B4 */ _t167 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DC8B4 */ _t168 = _t167 & 0x00000001u;
         /* 021DC8B4 */ if (_t168) goto L_021DC8B8; else goto L_021DC8C0;
   L_021DC8B8: ; // 0x21dc8b8
@@ -19625,8 +19625,8 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DC8E4 */ _t170 = cpu->r[29] + 0x00000180u;
         /* 021DC8E4 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t170);
         /* 021DC8E8 */ cpu->f[0] = fma(cpu->f[12], cpu->f[13], cpu->f[9]);
-        /* 021DC8EC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[30]);
-        /* 021DC8F0 */ _t171 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DC8EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[30]));
+        /* 021DC8F0 */ _t171 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DC8F0 */ _t172 = _t171 & 0x00000001u;
         /* 021DC8F0 */ if (_t172) goto L_021DC8F4; else goto L_021DC8F8;
   L_021DC8F4: ; // 0x21dc8f4
@@ -19728,15 +19728,15 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DC9E8 */ cpu->f[10] = fma(cpu->f[0], cpu->f[0], cpu->f[11]);
         /* 021DC9EC */ _t205 = cpu->r[5] + 0x00001590u;
         /* 021DC9EC */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t205);
-        /* 021DC9F0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[12]);
+        /* 021DC9F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[12]));
         /* 021DC9F4 */ _t206 = cpu->r[1] + 0x00000028u;
         /* 021DC9F4 */ rbrew_write_f32(cpu->mem, _t206, cpu->f[0]);
-        /* 021DC9F8 */ _t207 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DC9F8 */ _t207 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DC9F8 */ _t208 = _t207 & 0x00000001u;
         /* 021DC9F8 */ if (_t208) goto L_021DCC60; else goto L_021DC9FC;
   L_021DC9FC: ; // 0x21dc9fc
-        /* 021DC9FC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[30]);
-        /* 021DCA00 */ _t209 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DC9FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[30]));
+        /* 021DCA00 */ _t209 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DCA00 */ _t210 = _t209 & 0x00000001u;
         /* 021DCA00 */ if (_t210) goto L_021DCA04; else goto L_021DCA30;
   L_021DCA04: ; // 0x21dca04
@@ -19768,13 +19768,13 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DCA50 */ Gambit_fn_02C692EC(cpu);
         /* 021DCA54 */ cpu->r[3] = cpu->r[1] + 0x00000098u;
         /* 021DCA58 */ Gambit_fn_02C69350(cpu);
-        /* 021DCA5C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[27], cpu->f[30]);
-        /* 021DCA60 */ _t216 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DCA5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[27], cpu->f[30]));
+        /* 021DCA60 */ _t216 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DCA60 */ _t217 = _t216 & 0x00000001u;
         /* 021DCA60 */ if (_t217) goto L_021DCA64; else goto L_021DCAA8;
   L_021DCA64: ; // 0x21dca64
-        /* 021DCA64 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
-        /* 021DCA68 */ _t218 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DCA64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
+        /* 021DCA68 */ _t218 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DCA68 */ _t219 = _t218 & 0x00000001u;
         /* 021DCA68 */ if (_t219) goto L_021DCA6C; else goto L_021DCAA8;
   L_021DCA6C: ; // 0x21dca6c
@@ -19792,25 +19792,25 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DCA94 */ _t221 = cpu->r[29] + 0x00000180u;
         /* 021DCA94 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t221);
         /* 021DCA98 */ cpu->f[7] = fma(cpu->f[0], cpu->f[6], cpu->f[12]);
-        /* 021DCA9C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[30]);
-        /* 021DCAA0 */ _t222 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DCA9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[30]));
+        /* 021DCAA0 */ _t222 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DCAA0 */ _t223 = _t222 & 0x00000001u;
         /* 021DCAA0 */ if (_t223) goto L_021DCAA4; else goto L_021DCC40;
   L_021DCAA4: ; // 0x21dcaa4
         /* 021DCAA4 */ goto L_021DCC3C;
   L_021DCAA8: ; // 0x21dcaa8
-        /* 021DCAA8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[27], cpu->f[30]);
-        /* 021DCAAC */ _t224 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DCAA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[27], cpu->f[30]));
+        /* 021DCAAC */ _t224 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DCAAC */ _t225 = _t224 & 0x00000001u;
         /* 021DCAAC */ if (_t225) goto L_021DCB58; else goto L_021DCAB0;
   L_021DCAB0: ; // 0x21dcab0
-        /* 021DCAB0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
-        /* 021DCAB4 */ _t226 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DCAB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
+        /* 021DCAB4 */ _t226 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DCAB4 */ _t227 = _t226 & 0x00000001u;
         /* 021DCAB4 */ if (_t227) goto L_021DCB04; else goto L_021DCAB8;
   L_021DCAB8: ; // 0x21dcab8
-        /* 021DCAB8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[27], cpu->f[1]);
-        /* 021DCABC */ _t228 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DCAB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[27], cpu->f[1]));
+        /* 021DCABC */ _t228 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DCABC */ _t229 = _t228 & 0x00000001u;
         /* 021DCABC */ if (_t229) goto L_021DCAE0; else goto L_021DCAC0;
   L_021DCAC0: ; // 0x21dcac0
@@ -19819,8 +19819,8 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DCAC8 */ cpu->r[12] = 0x00E40000u;
         /* 021DCACC */ cpu->r[31] = cpu->r[3];
         /* 021DCAD0 */ cpu->r[12] = cpu->r[12] + 0xFFFF8E39u;
-        /* 021DCAD4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[12]);
-        /* 021DCAD8 */ _t230 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DCAD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[12]));
+        /* 021DCAD8 */ _t230 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DCAD8 */ _t231 = _t230 & 0x00000001u;
         /* 021DCAD8 */ if (_t231) goto L_021DCADC; else goto L_021DCC08;
   L_021DCADC: ; // 0x21dcadc
@@ -19832,16 +19832,16 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DCAEC */ cpu->r[12] = 0x00E40000u;
         /* 021DCAF0 */ cpu->r[31] = cpu->r[31] + 0x40000000u;
         /* 021DCAF4 */ cpu->r[12] = cpu->r[12] + 0xFFFF8E39u;
-        /* 021DCAF8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[12]);
-        /* 021DCAFC */ _t232 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DCAF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[12]));
+        /* 021DCAFC */ _t232 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DCAFC */ _t233 = _t232 & 0x00000001u;
         /* 021DCAFC */ if (_t233) goto L_021DCB00; else goto L_021DCC08;
   L_021DCB00: ; // 0x21dcb00
         /* 021DCB00 */ goto L_021DCC00;
   L_021DCB04: ; // 0x21dcb04
         /* 021DCB04 */ cpu->f[12] = -cpu->f[1];
-        /* 021DCB08 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[27], cpu->f[12]);
-        /* 021DCB0C */ _t234 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DCB08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[27], cpu->f[12]));
+        /* 021DCB0C */ _t234 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DCB0C */ _t235 = _t234 & 0x00000001u;
         /* 021DCB0C */ if (_t235) goto L_021DCB34; else goto L_021DCB10;
   L_021DCB10: ; // 0x21dcb10
@@ -19851,8 +19851,8 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DCB1C */ cpu->r[12] = 0x00E40000u;
         /* 021DCB20 */ cpu->r[31] = (uint32_t)(-(int32_t)cpu->r[3]);
         /* 021DCB24 */ cpu->r[12] = cpu->r[12] + 0xFFFF8E39u;
-        /* 021DCB28 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[12]);
-        /* 021DCB2C */ _t236 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DCB28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[12]));
+        /* 021DCB2C */ _t236 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DCB2C */ _t237 = _t236 & 0x00000001u;
         /* 021DCB2C */ if (_t237) goto L_021DCB30; else goto L_021DCC08;
   L_021DCB30: ; // 0x21dcb30
@@ -19864,21 +19864,21 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DCB40 */ cpu->r[12] = 0x00E40000u;
         /* 021DCB44 */ cpu->r[31] = cpu->r[3] + 0xC0000000u;
         /* 021DCB48 */ cpu->r[12] = cpu->r[12] + 0xFFFF8E39u;
-        /* 021DCB4C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[12]);
-        /* 021DCB50 */ _t238 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DCB4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[12]));
+        /* 021DCB50 */ _t238 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DCB50 */ _t239 = _t238 & 0x00000001u;
         /* 021DCB50 */ if (_t239) goto L_021DCB54; else goto L_021DCC08;
   L_021DCB54: ; // 0x21dcb54
         /* 021DCB54 */ goto L_021DCC00;
   L_021DCB58: ; // 0x21dcb58
-        /* 021DCB58 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
-        /* 021DCB5C */ _t240 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DCB58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
+        /* 021DCB5C */ _t240 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DCB5C */ _t241 = _t240 & 0x00000001u;
         /* 021DCB5C */ if (_t241) goto L_021DCBB8; else goto L_021DCB60;
   L_021DCB60: ; // 0x21dcb60
         /* 021DCB60 */ cpu->f[6] = -cpu->f[27];
-        /* 021DCB64 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[1]);
-        /* 021DCB68 */ _t242 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DCB64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[1]));
+        /* 021DCB68 */ _t242 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DCB68 */ _t243 = _t242 & 0x00000001u;
         /* 021DCB68 */ if (_t243) goto L_021DCB94; else goto L_021DCB6C;
   L_021DCB6C: ; // 0x21dcb6c
@@ -19889,8 +19889,8 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DCB7C */ cpu->r[12] = 0x00E40000u;
         /* 021DCB80 */ cpu->r[31] = cpu->r[31] + 0x80000000u;
         /* 021DCB84 */ cpu->r[12] = cpu->r[12] + 0xFFFF8E39u;
-        /* 021DCB88 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[12]);
-        /* 021DCB8C */ _t244 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DCB88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[12]));
+        /* 021DCB8C */ _t244 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DCB8C */ _t245 = _t244 & 0x00000001u;
         /* 021DCB8C */ if (_t245) goto L_021DCB90; else goto L_021DCC08;
   L_021DCB90: ; // 0x21dcb90
@@ -19902,15 +19902,15 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DCBA0 */ cpu->r[12] = 0x00E40000u;
         /* 021DCBA4 */ cpu->r[31] = cpu->r[3] + 0x40000000u;
         /* 021DCBA8 */ cpu->r[12] = cpu->r[12] + 0xFFFF8E39u;
-        /* 021DCBAC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[12]);
-        /* 021DCBB0 */ _t246 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DCBAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[12]));
+        /* 021DCBB0 */ _t246 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DCBB0 */ _t247 = _t246 & 0x00000001u;
         /* 021DCBB0 */ if (_t247) goto L_021DCBB4; else goto L_021DCC08;
   L_021DCBB4: ; // 0x21dcbb4
         /* 021DCBB4 */ goto L_021DCC00;
   L_021DCBB8: ; // 0x21dcbb8
-        /* 021DCBB8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[27], cpu->f[1]);
-        /* 021DCBBC */ _t248 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DCBB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[27], cpu->f[1]));
+        /* 021DCBBC */ _t248 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DCBBC */ _t249 = _t248 & 0x00000001u;
         /* 021DCBBC */ if (_t249) goto L_021DCBE0; else goto L_021DCBC0;
   L_021DCBC0: ; // 0x21dcbc0
@@ -19919,8 +19919,8 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DCBC8 */ cpu->r[12] = 0x00E40000u;
         /* 021DCBCC */ cpu->r[31] = cpu->r[3] + 0x80000000u;
         /* 021DCBD0 */ cpu->r[12] = cpu->r[12] + 0xFFFF8E39u;
-        /* 021DCBD4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[12]);
-        /* 021DCBD8 */ _t250 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DCBD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[12]));
+        /* 021DCBD8 */ _t250 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DCBD8 */ _t251 = _t250 & 0x00000001u;
         /* 021DCBD8 */ if (_t251) goto L_021DCBDC; else goto L_021DCC08;
   L_021DCBDC: ; // 0x21dcbdc
@@ -19932,8 +19932,8 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DCBEC */ cpu->r[12] = 0x00E40000u;
         /* 021DCBF0 */ cpu->r[31] = cpu->r[31] + 0xC0000000u;
         /* 021DCBF4 */ cpu->r[12] = cpu->r[12] + 0xFFFF8E39u;
-        /* 021DCBF8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[12]);
-        /* 021DCBFC */ _t252 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DCBF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[12]));
+        /* 021DCBFC */ _t252 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DCBFC */ _t253 = _t252 & 0x00000001u;
         /* 021DCBFC */ if (_t253) goto L_021DCC00; else goto L_021DCC08;
   L_021DCC00: ; // 0x21dcc00
@@ -19953,8 +19953,8 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DCC2C */ _t255 = cpu->r[29] + 0x00000180u;
         /* 021DCC2C */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t255);
         /* 021DCC30 */ cpu->f[7] = fma(cpu->f[0], cpu->f[6], cpu->f[12]);
-        /* 021DCC34 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[30]);
-        /* 021DCC38 */ _t256 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DCC34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[30]));
+        /* 021DCC38 */ _t256 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DCC38 */ _t257 = _t256 & 0x00000001u;
         /* 021DCC38 */ if (_t257) goto L_021DCC3C; else goto L_021DCC40;
   L_021DCC3C: ; // 0x21dcc3c
@@ -19977,17 +19977,17 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DCC6C */ _t260 = cpu->r[30] + 0x0000015Cu;
         /* 021DCC6C */ cpu->r[0] = rbrew_read32(cpu->mem, _t260);
         /* 021DCC70 */ cpu->r[7] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Cu, 0x0000001Eu);
-        /* 021DCC70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021DCC70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021DCC74 */ _t261 = cpu->r[29] + 0x00000030u;
         /* 021DCC74 */ cpu->r[31] = rbrew_read32(cpu->mem, _t261);
-        /* 021DCC78 */ _t262 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DCC78 */ _t262 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DCC78 */ _t263 = _t262 & 0x00000001u;
         /* 021DCC78 */ if (_t263) goto L_021DCDD4; else goto L_021DCC7C;
   L_021DCC7C: ; // 0x21dcc7c
         /* 021DCC7C */ _t264 = cpu->r[29] + 0x00000051u;
         /* 021DCC7C */ cpu->r[9] = rbrew_read8(cpu->mem, _t264);
-        /* 021DCC80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 021DCC84 */ _t265 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DCC80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 021DCC84 */ _t265 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DCC84 */ _t266 = _t265 & 0x00000001u;
         /* 021DCC84 */ if (_t266) goto L_021DCDAC; else goto L_021DCC88;
   L_021DCC88: ; // 0x21dcc88
@@ -20016,12 +20016,12 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DCCC0 */ rbrew_write_f32(cpu->mem, _t274, cpu->f[11]);
         /* 021DCCC4 */ _t275 = cpu->r[1] + 0x00000070u;
         /* 021DCCC4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t275);
-        /* 021DCCC8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[30]);
+        /* 021DCCC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[30]));
         /* 021DCCCC */ _t276 = cpu->r[1] + 0x0000002Cu;
         /* 021DCCCC */ rbrew_write32(cpu->mem, _t276, cpu->r[7]);
         /* 021DCCD0 */ _t277 = cpu->r[1] + 0x00000034u;
         /* 021DCCD0 */ rbrew_write32(cpu->mem, _t277, cpu->r[0]);
-        /* 021DCCD4 */ _t278 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DCCD4 */ _t278 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DCCD4 */ _t279 = _t278 & 0x00000001u;
         /* 021DCCD4 */ if (_t279) goto L_021DCD00; else goto L_021DCCD8;
   L_021DCCD8: ; // 0x21dccd8
@@ -20034,9 +20034,9 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DCCE4 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t282);
         /* 021DCCE8 */ cpu->f[10] = fma(cpu->f[7], cpu->f[7], cpu->f[8]);
         /* 021DCCEC */ cpu->f[8] = fma(cpu->f[9], cpu->f[9], cpu->f[10]);
-        /* 021DCCF0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[30]);
+        /* 021DCCF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[30]));
         /* 021DCCF4 */ cpu->f[11] = cpu->f[30] * cpu->f[6];
-        /* 021DCCF8 */ _t283 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DCCF8 */ _t283 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DCCF8 */ _t284 = _t283 & 0x00000001u;
         /* 021DCCF8 */ if (_t284) goto L_021DCCFC; else goto L_021DCD6C;
   L_021DCCFC: ; // 0x21dccfc
@@ -20058,9 +20058,9 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DCD20 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t289);
         /* 021DCD24 */ cpu->f[10] = fma(cpu->f[7], cpu->f[7], cpu->f[8]);
         /* 021DCD28 */ cpu->f[8] = fma(cpu->f[9], cpu->f[9], cpu->f[10]);
-        /* 021DCD2C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[30]);
+        /* 021DCD2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[30]));
         /* 021DCD30 */ cpu->f[11] = cpu->f[11] * cpu->f[6];
-        /* 021DCD34 */ _t290 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DCD34 */ _t290 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DCD34 */ _t291 = _t290 & 0x00000001u;
         /* 021DCD34 */ if (_t291) goto L_021DCD38; else goto L_021DCD6C;
   L_021DCD38: ; // 0x21dcd38
@@ -20083,20 +20083,20 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DCD68 */ _t296 = cpu->r[1] + 0x00000034u;
         /* 021DCD68 */ rbrew_write_f32(cpu->mem, _t296, cpu->f[9]);
   L_021DCD6C: ; // 0x21dcd6c
-        /* 021DCD6C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[30]);
-        /* 021DCD70 */ _t297 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DCD6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[30]));
+        /* 021DCD70 */ _t297 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DCD70 */ _t298 = _t297 & 0x00000001u;
         /* 021DCD70 */ if (_t298) goto L_021DCD74; else goto L_021DCD88;
   L_021DCD74: ; // 0x21dcd74
         /* 021DCD74 */ _t299 = cpu->r[1] + 0x00000030u;
         /* 021DCD74 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t299);
-        /* 021DCD78 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[30]);
-        /* 021DCD7C */ _t300 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DCD78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[30]));
+        /* 021DCD7C */ _t300 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DCD7C */ _t301 = _t300 & 0x00000001u;
         /* 021DCD7C */ if (_t301) goto L_021DCD80; else goto L_021DCD88;
   L_021DCD80: ; // 0x21dcd80
-        /* 021DCD80 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[30]);
-        /* 021DCD84 */ _t302 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DCD80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[30]));
+        /* 021DCD84 */ _t302 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DCD84 */ _t303 = _t302 & 0x00000001u;
         /* 021DCD84 */ if (_t303) goto L_021DCDAC; else goto L_021DCD88;
   L_021DCD88: ; // 0x21dcd88
@@ -20120,10 +20120,10 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DCDBC */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t306);
         /* 021DCDC0 */ _t307 = cpu->r[29] + 0x000001D4u;
         /* 021DCDC0 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t307);
-        /* 021DCDC4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[6]);
+        /* 021DCDC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[6]));
         /* 021DCDC8 */ _t308 = cpu->r[29] + 0x000001D8u;
         /* 021DCDC8 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t308);
-        /* 021DCDCC */ _t309 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DCDCC */ _t309 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DCDCC */ _t310 = _t309 & 0x00000001u;
         /* 021DCDCC */ if (_t310) goto L_021DCDD0; else goto L_021DCE90;
   L_021DCDD0: ; // 0x21dcdd0
@@ -20138,8 +20138,8 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DCDEC */ _t311 = cpu->r[30] + 0x0000008Cu;
         /* 021DCDEC */ cpu->r[12] = rbrew_read16(cpu->mem, _t311);
         /* 021DCDF0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[12], 0x00000012u, 0x0000001Fu, 0x0000001Fu);
-        /* 021DCDF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021DCDF4 */ _t312 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DCDF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021DCDF4 */ _t312 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DCDF4 */ _t313 = _t312 & 0x00000001u;
         /* 021DCDF4 */ if (_t313) goto L_021DCE78; else goto L_021DCDF8;
   L_021DCDF8: ; // 0x21dcdf8
@@ -20148,8 +20148,8 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DCDFC */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t314);
         /* 021DCE00 */ _t315 = cpu->r[4] + 0xFFFF9590u;
         /* 021DCE00 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t315);
-        /* 021DCE04 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[7]);
-        /* 021DCE08 */ _t316 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DCE04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[7]));
+        /* 021DCE08 */ _t316 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DCE08 */ _t317 = _t316 & 0x00000001u;
         /* 021DCE08 */ if (_t317) goto L_021DCE78; else goto L_021DCE0C;
   L_021DCE0C: ; // 0x21dce0c
@@ -20193,7 +20193,7 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DCE5C */ _t335 = cpu->r[1] + 0x000000F8u;
         /* 021DCE5C */ cpu->r[30] = rbrew_read32(cpu->mem, _t335);
         /* 021DCE60 */ cpu->r[3] = 0x00000001u;
-        /* 021DCE64 */ _t336 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DCE64 */ _t336 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DCE64 */ _t337 = _t336 & 0x00000001u;
         /* 021DCE64 */ if (_t337) goto L_021DCE68; // else: addr-0 trap, fall-through
   L_021DCE68: ; // 0x21dce68
@@ -20207,10 +20207,10 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DCE78 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t339);
         /* 021DCE7C */ _t340 = cpu->r[29] + 0x000001D4u;
         /* 021DCE7C */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t340);
-        /* 021DCE80 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[6]);
+        /* 021DCE80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[6]));
         /* 021DCE84 */ _t341 = cpu->r[29] + 0x000001D8u;
         /* 021DCE84 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t341);
-        /* 021DCE88 */ _t342 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DCE88 */ _t342 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DCE88 */ _t343 = _t342 & 0x00000001u;
         /* 021DCE88 */ if (_t343) goto L_021DCE8C; else goto L_021DCE90;
   L_021DCE8C: ; // 0x21dce8c
@@ -20219,10 +20219,10 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
   L_021DCE90: ; // 0x21dce90
         /* 021DCE90 */ _t345 = cpu->r[30] + 0x00000070u;
         /* 021DCE90 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t345);
-        /* 021DCE94 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[7]);
+        /* 021DCE94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[7]));
         /* 021DCE98 */ _t346 = cpu->r[29] + 0x000001DCu;
         /* 021DCE98 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t346);
-        /* 021DCE9C */ _t347 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DCE9C */ _t347 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DCE9C */ _t348 = _t347 & 0x00000001u;
         /* 021DCE9C */ if (_t348) goto L_021DCEA0; else goto L_021DCEA4;
   L_021DCEA0: ; // 0x21dcea0
@@ -20231,10 +20231,10 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
   L_021DCEA4: ; // 0x21dcea4
         /* 021DCEA4 */ _t350 = cpu->r[30] + 0x00000074u;
         /* 021DCEA4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t350);
-        /* 021DCEA8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[9]);
+        /* 021DCEA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[9]));
         /* 021DCEAC */ _t351 = cpu->r[29] + 0x000001E0u;
         /* 021DCEAC */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t351);
-        /* 021DCEB0 */ _t352 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DCEB0 */ _t352 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DCEB0 */ _t353 = _t352 & 0x00000001u;
         /* 021DCEB0 */ if (_t353) goto L_021DCEB4; else goto L_021DCEB8;
   L_021DCEB4: ; // 0x21dceb4
@@ -20243,8 +20243,8 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
   L_021DCEB8: ; // 0x21dceb8
         /* 021DCEB8 */ _t355 = cpu->r[30] + 0x0000006Cu;
         /* 021DCEB8 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t355);
-        /* 021DCEBC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[11]);
-        /* 021DCEC0 */ _t356 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DCEBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[11]));
+        /* 021DCEC0 */ _t356 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DCEC0 */ _t357 = _t356 & 0x00000001u;
         /* 021DCEC0 */ if (_t357) goto L_021DCEC4; else goto L_021DCEC8;
   L_021DCEC4: ; // 0x21dcec4
@@ -20255,10 +20255,10 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DCEC8 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t359);
         /* 021DCECC */ _t360 = cpu->r[29] + 0x000001E4u;
         /* 021DCECC */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t360);
-        /* 021DCED0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[12]);
+        /* 021DCED0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[12]));
         /* 021DCED4 */ _t361 = cpu->r[29] + 0x000001E8u;
         /* 021DCED4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t361);
-        /* 021DCED8 */ _t362 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DCED8 */ _t362 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DCED8 */ _t363 = _t362 & 0x00000001u;
         /* 021DCED8 */ if (_t363) goto L_021DCEDC; else goto L_021DCEE0;
   L_021DCEDC: ; // 0x21dcedc
@@ -20267,10 +20267,10 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
   L_021DCEE0: ; // 0x21dcee0
         /* 021DCEE0 */ _t365 = cpu->r[30] + 0x00000074u;
         /* 021DCEE0 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t365);
-        /* 021DCEE4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
+        /* 021DCEE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
         /* 021DCEE8 */ _t366 = cpu->r[29] + 0x00000004u;
         /* 021DCEE8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t366);
-        /* 021DCEEC */ _t367 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DCEEC */ _t367 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DCEEC */ _t368 = _t367 & 0x00000001u;
         /* 021DCEEC */ if (_t368) goto L_021DCEF0; else goto L_021DCEF4;
   L_021DCEF0: ; // 0x21dcef0
@@ -20322,7 +20322,7 @@ void Gambit_fn_021DC38C(CPUState* cpu) {
         /* 021DCF54 */ _t388 = cpu->r[1] + 0x000000F8u;
         /* 021DCF54 */ cpu->r[30] = rbrew_read32(cpu->mem, _t388);
         /* 021DCF58 */ cpu->r[3] = 0x00000000u;
-        /* 021DCF5C */ _t389 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DCF5C */ _t389 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DCF5C */ _t390 = _t389 & 0x00000001u;
         /* 021DCF5C */ if (_t390) goto L_021DCF60; // else: addr-0 trap, fall-through
   L_021DCF60: ; // 0x21dcf60
@@ -20482,30 +20482,30 @@ void Gambit_fn_021DCFE4(CPUState* cpu) {
         /* 021DD044 */ _t15 = cpu->r[9] + 0x00001480u;
         /* 021DD044 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t15);
         /* 021DD048 */ cpu->r[0] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 021DD048 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021DD048 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021DD04C */ _t16 = cpu->r[8] + 0x00001484u;
         /* 021DD04C */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t16);
         /* 021DD050 */ cpu->r[31] = cpu->r[6];
         /* 021DD054 */ _t17 = cpu->r[29] + 0x00000000u;
         /* 021DD054 */ cpu->r[0] = rbrew_read32(cpu->mem, _t17);
-        /* 021DD058 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DD058 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DD058 */ _t19 = _t18 & 0x00000001u;
         /* 021DD058 */ if (_t19) goto L_021DD0D0; else goto L_021DD05C;
   L_021DD05C: ; // 0x21dd05c
         /* 021DD05C */ cpu->r[11] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021DD05C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021DD060 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DD05C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021DD060 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DD060 */ _t21 = _t20 & 0x00000001u;
         /* 021DD060 */ if (_t21) goto L_021DD0A0; else goto L_021DD064;
   L_021DD064: ; // 0x21dd064
         /* 021DD064 */ cpu->r[3] = cpu->r[29] + 0x0000012Cu;
         /* 021DD068 */ Gambit_fn_02C69350(cpu);
-        /* 021DD06C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[29]);
+        /* 021DD06C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[29]));
         /* 021DD070 */ _t22 = cpu->r[29] + 0x0000015Cu;
         /* 021DD070 */ cpu->r[10] = rbrew_read32(cpu->mem, _t22);
         /* 021DD074 */ _t23 = cpu->r[29] + 0x00000000u;
         /* 021DD074 */ cpu->r[0] = rbrew_read32(cpu->mem, _t23);
-        /* 021DD078 */ _t24 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DD078 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DD078 */ _t25 = _t24 & 0x00000001u;
         /* 021DD078 */ if (_t25) goto L_021DD07C; else goto L_021DD098;
   L_021DD07C: ; // 0x21dd07c
@@ -20540,30 +20540,30 @@ void Gambit_fn_021DCFE4(CPUState* cpu) {
         /* 021DD0BC */ _t36 = cpu->r[1] + 0x00000064u;
         /* 021DD0BC */ rbrew_write32(cpu->mem, _t36, cpu->r[8]);
         /* 021DD0C0 */ cpu->r[5] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021DD0C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021DD0C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021DD0C4 */ _t37 = cpu->r[1] + 0x00000060u;
         /* 021DD0C4 */ rbrew_write32(cpu->mem, _t37, cpu->r[6]);
-        /* 021DD0C8 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DD0C8 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DD0C8 */ _t39 = _t38 & 0x00000001u;
         /* 021DD0C8 */ if (_t39) goto L_021DD204; else goto L_021DD0CC;
   L_021DD0CC: ; // 0x21dd0cc
         /* 021DD0CC */ goto L_021DD14C;
   L_021DD0D0: ; // 0x21dd0d0
         /* 021DD0D0 */ cpu->r[11] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021DD0D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021DD0D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021DD0D4 */ cpu->r[28] = cpu->r[29] + 0x000000A8u;
-        /* 021DD0D8 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DD0D8 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DD0D8 */ _t41 = _t40 & 0x00000001u;
         /* 021DD0D8 */ if (_t41) goto L_021DD118; else goto L_021DD0DC;
   L_021DD0DC: ; // 0x21dd0dc
         /* 021DD0DC */ cpu->r[3] = cpu->r[29] + 0x00000138u;
         /* 021DD0E0 */ Gambit_fn_02C69350(cpu);
-        /* 021DD0E4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[29]);
+        /* 021DD0E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[29]));
         /* 021DD0E8 */ _t42 = cpu->r[29] + 0x0000015Cu;
         /* 021DD0E8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t42);
         /* 021DD0EC */ _t43 = cpu->r[29] + 0x00000000u;
         /* 021DD0EC */ cpu->r[0] = rbrew_read32(cpu->mem, _t43);
-        /* 021DD0F0 */ _t44 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DD0F0 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DD0F0 */ _t45 = _t44 & 0x00000001u;
         /* 021DD0F0 */ if (_t45) goto L_021DD0F4; else goto L_021DD110;
   L_021DD0F4: ; // 0x21dd0f4
@@ -20601,26 +20601,26 @@ void Gambit_fn_021DCFE4(CPUState* cpu) {
         /* 021DD13C */ _t57 = cpu->r[1] + 0x0000009Cu;
         /* 021DD13C */ rbrew_write32(cpu->mem, _t57, cpu->r[12]);
         /* 021DD140 */ cpu->r[5] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021DD140 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021DD140 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021DD144 */ _t58 = cpu->r[1] + 0x00000064u;
         /* 021DD144 */ rbrew_write32(cpu->mem, _t58, cpu->r[6]);
-        /* 021DD148 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DD148 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DD148 */ _t60 = _t59 & 0x00000001u;
         /* 021DD148 */ if (_t60) goto L_021DD204; else goto L_021DD14C;
   L_021DD14C: ; // 0x21dd14c
         /* 021DD14C */ cpu->r[6] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021DD14C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 021DD14C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 021DD150 */ cpu->r[28] = cpu->r[29] + 0x000000A8u;
-        /* 021DD154 */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DD154 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DD154 */ _t62 = _t61 & 0x00000001u;
         /* 021DD154 */ if (_t62) goto L_021DD190; else goto L_021DD158;
   L_021DD158: ; // 0x21dd158
         /* 021DD158 */ cpu->r[3] = cpu->r[29] + 0x00000138u;
         /* 021DD15C */ Gambit_fn_02C69350(cpu);
-        /* 021DD160 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[29]);
+        /* 021DD160 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[29]));
         /* 021DD164 */ _t63 = cpu->r[29] + 0x00000000u;
         /* 021DD164 */ cpu->r[7] = rbrew_read32(cpu->mem, _t63);
-        /* 021DD168 */ _t64 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DD168 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DD168 */ _t65 = _t64 & 0x00000001u;
         /* 021DD168 */ if (_t65) goto L_021DD16C; else goto L_021DD188;
   L_021DD16C: ; // 0x21dd16c
@@ -20678,8 +20678,8 @@ void Gambit_fn_021DCFE4(CPUState* cpu) {
         /* 021DD1F4 */ _t81 = cpu->r[1] + 0x00000074u;
         /* 021DD1F4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t81);
         /* 021DD1F8 */ cpu->f[9] = fma(cpu->f[11], cpu->f[0], cpu->f[8]);
-        /* 021DD1FC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[29]);
-        /* 021DD200 */ _t82 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DD1FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[29]));
+        /* 021DD200 */ _t82 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DD200 */ _t83 = _t82 & 0x00000001u;
         /* 021DD200 */ if (_t83) goto L_021DD470; else goto L_021DD204;
   L_021DD204: ; // 0x21dd204
@@ -20690,22 +20690,22 @@ void Gambit_fn_021DCFE4(CPUState* cpu) {
         /* 021DD20C */ cpu->ctr = cpu->r[10];
         /* 021DD210 */ cpu->r[3] = cpu->r[30];
         /* 021DD214 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021DD218 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DD21C */ _t86 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DD218 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DD21C */ _t86 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DD21C */ _t87 = _t86 & 0x00000001u;
         /* 021DD21C */ if (_t87) goto L_021DD220; else goto L_021DD470;
   L_021DD220: ; // 0x21dd220
         /* 021DD220 */ _t88 = cpu->r[29] + 0x0000015Cu;
         /* 021DD220 */ cpu->r[10] = rbrew_read32(cpu->mem, _t88);
         /* 021DD224 */ cpu->r[12] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021DD224 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021DD228 */ _t89 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DD224 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021DD228 */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DD228 */ _t90 = _t89 & 0x00000001u;
         /* 021DD228 */ if (_t90) goto L_021DD410; else goto L_021DD22C;
   L_021DD22C: ; // 0x21dd22c
         /* 021DD22C */ cpu->r[0] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 021DD22C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021DD230 */ _t91 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DD22C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021DD230 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DD230 */ _t92 = _t91 & 0x00000001u;
         /* 021DD230 */ if (_t92) goto L_021DD410; else goto L_021DD234;
   L_021DD234: ; // 0x21dd234
@@ -20725,30 +20725,30 @@ void Gambit_fn_021DCFE4(CPUState* cpu) {
         /* 021DD250 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t98);
         /* 021DD254 */ _t99 = cpu->r[29] + 0x000000C0u;
         /* 021DD254 */ cpu->r[6] = rbrew_read32(cpu->mem, _t99);
-        /* 021DD258 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[9]);
+        /* 021DD258 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[9]));
         /* 021DD25C */ _t100 = cpu->r[1] + 0x00000014u;
         /* 021DD25C */ rbrew_write32(cpu->mem, _t100, cpu->r[9]);
         /* 021DD260 */ _t101 = cpu->r[1] + 0x0000000Cu;
         /* 021DD260 */ rbrew_write32(cpu->mem, _t101, cpu->r[6]);
-        /* 021DD264 */ _t102 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DD264 */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DD264 */ _t103 = _t102 & 0x00000001u;
         /* 021DD264 */ if (_t103) goto L_021DD268; else goto L_021DD410;
   L_021DD268: ; // 0x21dd268
         /* 021DD268 */ _t104 = cpu->r[29] + 0x00000000u;
         /* 021DD268 */ cpu->r[0] = rbrew_read32(cpu->mem, _t104);
         /* 021DD26C */ cpu->r[11] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021DD26C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021DD26C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021DD270 */ cpu->r[28] = cpu->r[29] + 0x000000A8u;
-        /* 021DD274 */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DD274 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DD274 */ _t106 = _t105 & 0x00000001u;
         /* 021DD274 */ if (_t106) goto L_021DD2B0; else goto L_021DD278;
   L_021DD278: ; // 0x21dd278
         /* 021DD278 */ cpu->r[3] = cpu->r[29] + 0x00000138u;
         /* 021DD27C */ Gambit_fn_02C69350(cpu);
-        /* 021DD280 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[29]);
+        /* 021DD280 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[29]));
         /* 021DD284 */ _t107 = cpu->r[29] + 0x00000000u;
         /* 021DD284 */ cpu->r[7] = rbrew_read32(cpu->mem, _t107);
-        /* 021DD288 */ _t108 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DD288 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DD288 */ _t109 = _t108 & 0x00000001u;
         /* 021DD288 */ if (_t109) goto L_021DD28C; else goto L_021DD2A8;
   L_021DD28C: ; // 0x21dd28c
@@ -20894,10 +20894,10 @@ void Gambit_fn_021DCFE4(CPUState* cpu) {
         /* 021DD3FC */ rbrew_write32(cpu->mem, _t154, cpu->r[12]);
         /* 021DD400 */ Gambit_fn_0204A4DC(cpu);
         /* 021DD404 */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021DD404 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021DD404 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021DD408 */ _t155 = cpu->r[1] + 0x00000084u;
         /* 021DD408 */ rbrew_write32(cpu->mem, _t155, cpu->r[3]);
-        /* 021DD40C */ _t156 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DD40C */ _t156 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DD40C */ _t157 = _t156 & 0x00000001u;
         /* 021DD40C */ if (_t157) goto L_021DD470; else goto L_021DD410;
   L_021DD410: ; // 0x21dd410
@@ -20932,7 +20932,7 @@ void Gambit_fn_021DCFE4(CPUState* cpu) {
         /* 021DD454 */ _t169 = cpu->r[1] + 0x000000E8u;
         /* 021DD454 */ cpu->r[30] = rbrew_read32(cpu->mem, _t169);
         /* 021DD458 */ cpu->r[3] = 0x00000000u;
-        /* 021DD45C */ _t170 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DD45C */ _t170 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DD45C */ _t171 = _t170 & 0x00000001u;
         /* 021DD45C */ if (_t171) goto L_021DD460; // else: addr-0 trap, fall-through
   L_021DD460: ; // 0x21dd460
@@ -20967,7 +20967,7 @@ void Gambit_fn_021DCFE4(CPUState* cpu) {
         /* 021DD49C */ _t184 = cpu->r[1] + 0x000000E8u;
         /* 021DD49C */ cpu->r[30] = rbrew_read32(cpu->mem, _t184);
         /* 021DD4A0 */ cpu->r[3] = 0x00000001u;
-        /* 021DD4A4 */ _t185 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DD4A4 */ _t185 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DD4A4 */ _t186 = _t185 & 0x00000001u;
         /* 021DD4A4 */ if (_t186) goto L_021DD4A8; // else: addr-0 trap, fall-through
   L_021DD4A8: ; // 0x21dd4a8
@@ -21242,20 +21242,20 @@ void Gambit_fn_021DD5EC(CPUState* cpu) {
         /* 021DD5EC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021DD5F0 */ _t1 = cpu->r[6] + 0x00000000u;
         /* 021DD5F0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
-        /* 021DD5F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
-        /* 021DD5F8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DD5F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
+        /* 021DD5F8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DD5F8 */ _t3 = _t2 & 0x00000001u;
         /* 021DD5F8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021DD5F8 */ goto L_021DD5FC;
   L_021DD5FC: ; // 0x21dd5fc
-        /* 021DD5FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x0000000Bu);
-        /* 021DD600 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DD5FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x0000000Bu));
+        /* 021DD600 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DD600 */ _t5 = _t4 & 0x00000001u;
         /* 021DD600 */ if (_t5) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021DD600 */ goto L_021DD604;
   L_021DD604: ; // 0x21dd604
-        /* 021DD604 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x0000000Fu);
-        /* 021DD608 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DD604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x0000000Fu));
+        /* 021DD608 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DD608 */ _t7 = _t6 & 0x00000001u;
         /* 021DD608 */ if (_t7) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021DD608 */ goto L_021DD60C;
@@ -21290,9 +21290,9 @@ void Gambit_fn_021DD618(CPUState* cpu) {
         /* 021DD638 */ cpu->r[7] = rbrew_read32(cpu->mem, _t5);
         /* 021DD63C */ cpu->r[12] = 0x101F0000u;
         /* 021DD640 */ cpu->r[7] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x00000019u, 0x00000019u);
-        /* 021DD640 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021DD640 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021DD644 */ cpu->r[12] = cpu->r[12] + 0x00006350u;
-        /* 021DD648 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DD648 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DD648 */ _t7 = _t6 & 0x00000001u;
         /* 021DD648 */ if (_t7) goto L_021DD64C; else goto L_021DD650;
   L_021DD64C: ; // 0x21dd64c
@@ -21347,10 +21347,10 @@ void Gambit_fn_021DD618(CPUState* cpu) {
         /* 021DD6C4 */ _t25 = cpu->r[31] + 0x000001C4u;
         /* 021DD6C4 */ rbrew_write_f32(cpu->mem, _t25, cpu->f[13]);
         /* 021DD6C8 */ cpu->r[12] = 0x10030000u;
-        /* 021DD6CC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[31]);
+        /* 021DD6CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[31]));
         /* 021DD6D0 */ _t26 = cpu->r[12] + 0x00001528u;
         /* 021DD6D0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t26);
-        /* 021DD6D4 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DD6D4 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DD6D4 */ _t28 = _t27 & 0x00000001u;
         /* 021DD6D4 */ if (_t28) goto L_021DD6D8; else goto L_021DD70C;
   L_021DD6D8: ; // 0x21dd6d8
@@ -21460,7 +21460,7 @@ void Gambit_fn_021DD618(CPUState* cpu) {
         /* 021DD7EC */ cpu->r[31] = rbrew_read32(cpu->mem, _t61);
         /* 021DD7F0 */ _t62 = cpu->r[1] + 0x00000058u;
         /* 021DD7F0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t62);
-        /* 021DD7F4 */ _t63 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DD7F4 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DD7F4 */ _t64 = _t63 & 0x00000001u;
         /* 021DD7F4 */ if (_t64) goto L_021DD7F8; // else: addr-0 trap, fall-through
   L_021DD7F8: ; // 0x21dd7f8
@@ -21494,9 +21494,9 @@ void Gambit_fn_021DD61C(CPUState* cpu) {
         /* 021DD638 */ cpu->r[7] = rbrew_read32(cpu->mem, _t5);
         /* 021DD63C */ cpu->r[12] = 0x101F0000u;
         /* 021DD640 */ cpu->r[7] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x00000019u, 0x00000019u);
-        /* 021DD640 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021DD640 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021DD644 */ cpu->r[12] = cpu->r[12] + 0x00006350u;
-        /* 021DD648 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DD648 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DD648 */ _t7 = _t6 & 0x00000001u;
         /* 021DD648 */ if (_t7) goto L_021DD64C; else goto L_021DD650;
   L_021DD64C: ; // 0x21dd64c
@@ -21551,10 +21551,10 @@ void Gambit_fn_021DD61C(CPUState* cpu) {
         /* 021DD6C4 */ _t25 = cpu->r[31] + 0x000001C4u;
         /* 021DD6C4 */ rbrew_write_f32(cpu->mem, _t25, cpu->f[13]);
         /* 021DD6C8 */ cpu->r[12] = 0x10030000u;
-        /* 021DD6CC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[31]);
+        /* 021DD6CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[31]));
         /* 021DD6D0 */ _t26 = cpu->r[12] + 0x00001528u;
         /* 021DD6D0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t26);
-        /* 021DD6D4 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DD6D4 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DD6D4 */ _t28 = _t27 & 0x00000001u;
         /* 021DD6D4 */ if (_t28) goto L_021DD6D8; else goto L_021DD70C;
   L_021DD6D8: ; // 0x21dd6d8
@@ -21664,7 +21664,7 @@ void Gambit_fn_021DD61C(CPUState* cpu) {
         /* 021DD7EC */ cpu->r[31] = rbrew_read32(cpu->mem, _t61);
         /* 021DD7F0 */ _t62 = cpu->r[1] + 0x00000058u;
         /* 021DD7F0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t62);
-        /* 021DD7F4 */ _t63 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DD7F4 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DD7F4 */ _t64 = _t63 & 0x00000001u;
         /* 021DD7F4 */ if (_t64) goto L_021DD7F8; // else: addr-0 trap, fall-through
   L_021DD7F8: ; // 0x21dd7f8
@@ -21797,10 +21797,10 @@ void Gambit_fn_021DD850(CPUState* cpu) {
         /* 021DD8D4 */ _t16 = cpu->r[6] + 0x00001484u;
         /* 021DD8D4 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t16);
         /* 021DD8D8 */ cpu->r[12] = 0x10030000u;
-        /* 021DD8DC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[30]);
+        /* 021DD8DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[30]));
         /* 021DD8E0 */ _t17 = cpu->r[12] + 0x00001478u;
         /* 021DD8E0 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t17);
-        /* 021DD8E4 */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DD8E4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DD8E4 */ _t19 = _t18 & 0x00000001u;
         /* 021DD8E4 */ if (_t19) goto L_021DD8E8; else goto L_021DD914;
   L_021DD8E8: ; // 0x21dd8e8
@@ -21831,10 +21831,10 @@ void Gambit_fn_021DD850(CPUState* cpu) {
         /* 021DD92C */ _t26 = cpu->r[10] + 0x0000025Cu;
         /* 021DD92C */ cpu->r[0] = rbrew_read32(cpu->mem, _t26);
         /* 021DD930 */ cpu->r[11] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 021DD930 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021DD930 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021DD934 */ cpu->r[3] = cpu->r[30];
         /* 021DD938 */ cpu->ctr = cpu->r[0];
-        /* 021DD93C */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DD93C */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DD93C */ _t28 = _t27 & 0x00000001u;
         /* 021DD93C */ if (_t28) goto L_021DD96C; else goto L_021DD940;
   L_021DD940: ; // 0x21dd940
@@ -21849,8 +21849,8 @@ void Gambit_fn_021DD850(CPUState* cpu) {
         /* 021DD958 */ _t31 = cpu->r[1] + 0x0000001Cu;
         /* 021DD958 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t31);
         /* 021DD95C */ cpu->f[10] = fma(cpu->f[11], cpu->f[11], cpu->f[12]);
-        /* 021DD960 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[30]);
-        /* 021DD964 */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DD960 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[30]));
+        /* 021DD964 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DD964 */ _t33 = _t32 & 0x00000001u;
         /* 021DD964 */ if (_t33) goto L_021DD968; else goto L_021DD9FC;
   L_021DD968: ; // 0x21dd968
@@ -21863,8 +21863,8 @@ void Gambit_fn_021DD850(CPUState* cpu) {
         /* 021DD974 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t35);
         /* 021DD978 */ cpu->f[9] = cpu->f[7] * cpu->f[7];
         /* 021DD97C */ cpu->f[10] = fma(cpu->f[8], cpu->f[8], cpu->f[9]);
-        /* 021DD980 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[30]);
-        /* 021DD984 */ _t36 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DD980 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[30]));
+        /* 021DD984 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DD984 */ _t37 = _t36 & 0x00000001u;
         /* 021DD984 */ if (_t37) goto L_021DD990; else goto L_021DD988;
   L_021DD988: ; // 0x21dd988
@@ -21889,8 +21889,8 @@ void Gambit_fn_021DD850(CPUState* cpu) {
         /* 021DD9B8 */ _t42 = cpu->r[1] + 0x0000001Cu;
         /* 021DD9B8 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t42);
         /* 021DD9BC */ cpu->f[10] = fma(cpu->f[11], cpu->f[11], cpu->f[12]);
-        /* 021DD9C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[30]);
-        /* 021DD9C4 */ _t43 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DD9C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[30]));
+        /* 021DD9C4 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DD9C4 */ _t44 = _t43 & 0x00000001u;
         /* 021DD9C4 */ if (_t44) goto L_021DD9C8; else goto L_021DD9FC;
   L_021DD9C8: ; // 0x21dd9c8
@@ -21935,7 +21935,7 @@ void Gambit_fn_021DD850(CPUState* cpu) {
         /* 021DDA20 */ cpu->r[31] = rbrew_read32(cpu->mem, _t59);
         /* 021DDA24 */ _t60 = cpu->r[1] + 0x00000020u;
         /* 021DDA24 */ cpu->r[30] = rbrew_read32(cpu->mem, _t60);
-        /* 021DDA28 */ _t61 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DDA28 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DDA28 */ _t62 = _t61 & 0x00000001u;
         /* 021DDA28 */ if (_t62) goto L_021DDA2C; // else: addr-0 trap, fall-through
   L_021DDA2C: ; // 0x21dda2c
@@ -21983,9 +21983,9 @@ void Gambit_fn_021DDA3C(CPUState* cpu) {
         /* 021DDA7C */ cpu->r[0] = rbrew_read32(cpu->mem, _t10);
         /* 021DDA80 */ cpu->r[31] = cpu->r[31] + 0x00006350u;
         /* 021DDA84 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000019u, 0x00000019u);
-        /* 021DDA84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021DDA84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021DDA88 */ cpu->r[12] = cpu->r[31];
-        /* 021DDA8C */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DDA8C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DDA8C */ _t12 = _t11 & 0x00000001u;
         /* 021DDA8C */ if (_t12) goto L_021DDA90; else goto L_021DDA94;
   L_021DDA90: ; // 0x21dda90
@@ -22029,10 +22029,10 @@ void Gambit_fn_021DDA3C(CPUState* cpu) {
         /* 021DDAEC */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t25);
         /* 021DDAF0 */ cpu->f[12] = fma(cpu->f[7], cpu->f[7], cpu->f[10]);
         /* 021DDAF4 */ cpu->r[11] = 0x10030000u;
-        /* 021DDAF8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[31]);
+        /* 021DDAF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[31]));
         /* 021DDAFC */ _t26 = cpu->r[11] + 0x00001478u;
         /* 021DDAFC */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t26);
-        /* 021DDB00 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DDB00 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DDB00 */ _t28 = _t27 & 0x00000001u;
         /* 021DDB00 */ if (_t28) goto L_021DDB04; else goto L_021DDB30;
   L_021DDB04: ; // 0x21ddb04
@@ -22065,8 +22065,8 @@ void Gambit_fn_021DDA3C(CPUState* cpu) {
         /* 021DDB50 */ _t35 = cpu->r[1] + 0x00000034u;
         /* 021DDB50 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t35);
         /* 021DDB54 */ cpu->f[13] = fma(cpu->f[11], cpu->f[11], cpu->f[9]);
-        /* 021DDB58 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[31]);
-        /* 021DDB5C */ _t36 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DDB58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[31]));
+        /* 021DDB5C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DDB5C */ _t37 = _t36 & 0x00000001u;
         /* 021DDB5C */ if (_t37) goto L_021DDB60; else goto L_021DDB8C;
   L_021DDB60: ; // 0x21ddb60
@@ -22219,7 +22219,7 @@ void Gambit_fn_021DDA3C(CPUState* cpu) {
         /* 021DDCB8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t96);
         /* 021DDCBC */ _t97 = cpu->r[1] + 0x00000068u;
         /* 021DDCBC */ cpu->r[30] = rbrew_read32(cpu->mem, _t97);
-        /* 021DDCC0 */ _t98 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DDCC0 */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DDCC0 */ _t99 = _t98 & 0x00000001u;
         /* 021DDCC0 */ if (_t99) goto L_021DDCC4; // else: addr-0 trap, fall-through
   L_021DDCC4: ; // 0x21ddcc4
@@ -22243,8 +22243,8 @@ void Gambit_fn_021DDCD4(CPUState* cpu) {
   L_027B8224: ; // 0x27b8224
         /* 027B8224 */ _t1 = cpu->r[3] + 0x00000000u;
         /* 027B8224 */ cpu->r[3] = rbrew_read32(cpu->mem, _t1);
-        /* 027B8228 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 027B822C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 027B8228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 027B822C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 027B822C */ _t3 = _t2 & 0x00000001u;
         /* 027B822C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 027B822C */ goto L_027B8230;
@@ -22267,9 +22267,9 @@ void Gambit_fn_021DDCD4(CPUState* cpu) {
         /* 027DA6B4 */ _t9 = cpu->r[29] + 0x00000014u;
         /* 027DA6B4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t9);
         /* 027DA6B8 */ cpu->r[31] = cpu->r[5];
-        /* 027DA6BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 027DA6BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 027DA6C0 */ cpu->r[30] = cpu->r[4];
-        /* 027DA6C4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 027DA6C4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 027DA6C4 */ _t11 = _t10 & 0x00000001u;
         /* 027DA6C4 */ if (_t11) goto L_027DA6D4; else goto L_027DA6C8;
   L_027DA6C8: ; // 0x27da6c8
@@ -22279,8 +22279,8 @@ void Gambit_fn_021DDCD4(CPUState* cpu) {
   L_027DA6D4: ; // 0x27da6d4
         /* 027DA6D4 */ _t12 = cpu->r[29] + 0x00000018u;
         /* 027DA6D4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t12);
-        /* 027DA6D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 027DA6DC */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 027DA6D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 027DA6DC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 027DA6DC */ _t14 = _t13 & 0x00000001u;
         /* 027DA6DC */ if (_t14) goto L_027DA6EC; else goto L_027DA6E0;
   L_027DA6E0: ; // 0x27da6e0
@@ -22324,8 +22324,8 @@ void Gambit_fn_021DDCE4(CPUState* cpu) {
         /* 021DDD08 */ _t5 = cpu->r[1] + 0x00000008u;
         /* 021DDD08 */ rbrew_write32(cpu->mem, _t5, cpu->r[10]);
         /* 021DDD0C */ Gambit_fn_0222E50C(cpu);
-        /* 021DDD10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DDD14 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DDD10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DDD14 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DDD14 */ _t7 = _t6 & 0x00000001u;
         /* 021DDD14 */ if (_t7) goto L_021DDD18; else goto L_021DDD28;
   L_021DDD18: ; // 0x21ddd18
@@ -22369,8 +22369,8 @@ void Gambit_fn_021DDCE8(CPUState* cpu) {
         /* 021DDD08 */ _t5 = cpu->r[1] + 0x00000008u;
         /* 021DDD08 */ rbrew_write32(cpu->mem, _t5, cpu->r[10]);
         /* 021DDD0C */ Gambit_fn_0222E50C(cpu);
-        /* 021DDD10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DDD14 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DDD10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DDD14 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DDD14 */ _t7 = _t6 & 0x00000001u;
         /* 021DDD14 */ if (_t7) goto L_021DDD18; else goto L_021DDD28;
   L_021DDD18: ; // 0x21ddd18
@@ -22504,15 +22504,15 @@ void Gambit_fn_021DDDB0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021DDDB0: ; // 0x21dddb0
-        /* 021DDDB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DDDB4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DDDB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DDDB4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DDDB4 */ _t1 = _t0 & 0x00000001u;
         /* 021DDDB4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021DDDB4 */ goto L_021DDDB8;
   L_021DDDB8: ; // 0x21dddb8
         /* 021DDDB8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021DDDB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021DDDBC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DDDB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021DDDBC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DDDBC */ _t3 = _t2 & 0x00000001u;
         /* 021DDDBC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021DDDBC */ goto L_021DDDC0;
@@ -22531,8 +22531,8 @@ void Gambit_fn_021DDDB0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -22546,15 +22546,15 @@ void Gambit_fn_021DDDB0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -22627,8 +22627,8 @@ void Gambit_fn_021DDDE0(CPUState* cpu) {
         /* 021DDDE0 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021DDDE0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021DDDE4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021DDDE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021DDDE8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DDDE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021DDDE8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DDDE8 */ _t2 = _t1 & 0x00000001u;
         /* 021DDDE8 */ _t3 = _t2 ^ 0x00000001u;
         /* 021DDDE8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -22650,8 +22650,8 @@ void Gambit_fn_021DDDFC(CPUState* cpu) {
         /* 021DDDFC */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021DDDFC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021DDE00 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021DDE00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021DDE04 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DDE00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021DDE04 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DDE04 */ _t2 = _t1 & 0x00000001u;
         /* 021DDE04 */ _t3 = _t2 ^ 0x00000001u;
         /* 021DDE04 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -22673,8 +22673,8 @@ void Gambit_fn_021DDE18(CPUState* cpu) {
         /* 021DDE18 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021DDE18 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021DDE1C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021DDE1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021DDE20 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DDE1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021DDE20 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DDE20 */ _t2 = _t1 & 0x00000001u;
         /* 021DDE20 */ _t3 = _t2 ^ 0x00000001u;
         /* 021DDE20 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -22717,8 +22717,8 @@ void Gambit_fn_021DDE44(CPUState* cpu) {
         /* 021DDE54 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021DDE58 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021DDE58 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021DDE5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021DDE60 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DDE5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021DDE60 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DDE60 */ _t5 = _t4 & 0x00000001u;
         /* 021DDE60 */ if (_t5) goto L_021DDE64; else goto L_021DDE80;
   L_021DDE64: ; // 0x21dde64
@@ -22757,8 +22757,8 @@ void Gambit_fn_021DDE48(CPUState* cpu) {
         /* 021DDE54 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021DDE58 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021DDE58 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021DDE5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021DDE60 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DDE5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021DDE60 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DDE60 */ _t5 = _t4 & 0x00000001u;
         /* 021DDE60 */ if (_t5) goto L_021DDE64; else goto L_021DDE80;
   L_021DDE64: ; // 0x21dde64
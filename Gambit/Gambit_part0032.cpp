@@ -298,10 +298,10 @@ void Gambit_fn_021DE03C(CPUState* cpu) {
         /* 021DE03C */ cpu->r[10] = 0x101D0000u;
         /* 021DE040 */ _t0 = cpu->r[10] + 0xFFFFE5E8u;
         /* 021DE040 */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 021DE044 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021DE044 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021DE048 */ cpu->r[10] = 0x101D0000u;
         /* 021DE04C */ cpu->r[10] = cpu->r[10] + 0xFFFFFC0Cu;
-        /* 021DE050 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DE050 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DE050 */ _t2 = _t1 & 0x00000001u;
         /* 021DE050 */ if (_t2) goto L_021DE054; else goto L_021DE06C;
   L_021DE054: ; // 0x21de054
@@ -314,8 +314,8 @@ void Gambit_fn_021DE03C(CPUState* cpu) {
         /* 021DE068 */ _t4 = cpu->r[10] + 0x00000000u;
         /* 021DE068 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_021DE06C: ; // 0x21de06c
-        /* 021DE06C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021DE070 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DE06C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021DE070 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DE070 */ _t6 = _t5 & 0x00000001u;
         /* 021DE070 */ if (_t6) goto L_021DE074; else goto L_021DE07C;
   L_021DE074: ; // 0x21de074
@@ -326,9 +326,9 @@ void Gambit_fn_021DE03C(CPUState* cpu) {
         /* 021DE080 */ _t7 = cpu->r[9] + 0xFFFFDA00u;
         /* 021DE080 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 021DE084 */ cpu->r[11] = 0x101D0000u;
-        /* 021DE088 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021DE088 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021DE08C */ cpu->r[11] = cpu->r[11] + 0xFFFFFBFCu;
-        /* 021DE090 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DE090 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DE090 */ _t9 = _t8 & 0x00000001u;
         /* 021DE090 */ if (_t9) goto L_021DE094; else goto L_021DE0AC;
   L_021DE094: ; // 0x21de094
@@ -341,8 +341,8 @@ void Gambit_fn_021DE03C(CPUState* cpu) {
         /* 021DE0A8 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021DE0A8 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021DE0AC: ; // 0x21de0ac
-        /* 021DE0AC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021DE0B0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DE0AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021DE0B0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DE0B0 */ _t13 = _t12 & 0x00000001u;
         /* 021DE0B0 */ if (_t13) goto L_021DE0B4; else goto L_021DE0BC;
   L_021DE0B4: ; // 0x21de0b4
@@ -353,9 +353,9 @@ void Gambit_fn_021DE03C(CPUState* cpu) {
         /* 021DE0C0 */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021DE0C0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 021DE0C4 */ cpu->r[9] = 0x101D0000u;
-        /* 021DE0C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021DE0C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021DE0CC */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 021DE0D0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DE0D0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DE0D0 */ _t16 = _t15 & 0x00000001u;
         /* 021DE0D0 */ if (_t16) goto L_021DE0D4; else goto L_021DE0EC;
   L_021DE0D4: ; // 0x21de0d4
@@ -368,8 +368,8 @@ void Gambit_fn_021DE03C(CPUState* cpu) {
         /* 021DE0E8 */ _t18 = cpu->r[9] + 0x00000000u;
         /* 021DE0E8 */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_021DE0EC: ; // 0x21de0ec
-        /* 021DE0EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 021DE0F0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DE0EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 021DE0F0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DE0F0 */ _t20 = _t19 & 0x00000001u;
         /* 021DE0F0 */ if (_t20) goto L_021DE0F4; else goto L_021DE0FC;
   L_021DE0F4: ; // 0x21de0f4
@@ -381,9 +381,9 @@ void Gambit_fn_021DE03C(CPUState* cpu) {
         /* 021DE100 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 021DE100 */ cpu->r[9] = _t21;
         /* 021DE104 */ cpu->r[10] = 0x101D0000u;
-        /* 021DE108 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021DE108 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021DE10C */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021DE110 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DE110 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DE110 */ _t23 = _t22 & 0x00000001u;
         /* 021DE110 */ if (_t23) goto L_021DE114; else goto L_021DE128;
   L_021DE114: ; // 0x21de114
@@ -395,8 +395,8 @@ void Gambit_fn_021DE03C(CPUState* cpu) {
         /* 021DE124 */ _t25 = cpu->r[10] + 0x00000000u;
         /* 021DE124 */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_021DE128: ; // 0x21de128
-        /* 021DE128 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021DE12C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DE128 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021DE12C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DE12C */ _t27 = _t26 & 0x00000001u;
         /* 021DE12C */ if (_t27) goto L_021DE130; else goto L_021DE138;
   L_021DE130: ; // 0x21de130
@@ -408,9 +408,9 @@ void Gambit_fn_021DE03C(CPUState* cpu) {
         /* 021DE13C */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 021DE13C */ cpu->r[10] = _t28;
         /* 021DE140 */ cpu->r[11] = 0x101D0000u;
-        /* 021DE144 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021DE144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021DE148 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021DE14C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DE14C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DE14C */ _t30 = _t29 & 0x00000001u;
         /* 021DE14C */ if (_t30) goto L_021DE150; else goto L_021DE164;
   L_021DE150: ; // 0x21de150
@@ -963,14 +963,14 @@ void Gambit_fn_021DE3B8(CPUState* cpu) {
         /* 02C82F38 */ cpu->r[0] = cpu->lr;
         /* 02C82F3C */ cpu->r[8] = cpu->r[7];
         /* 02C82F40 */ cpu->r[12] = cpu->r[6];
-        /* 02C82F44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0xFFFFFFFFu);
+        /* 02C82F44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0xFFFFFFFFu));
         /* 02C82F48 */ _t0 = cpu->r[1] + 0x00000004u;
         /* 02C82F48 */ rbrew_write32(cpu->mem, _t0, cpu->r[0]);
         /* 02C82F4C */ cpu->r[6] = 0x00000000u;
         /* 02C82F50 */ _t1 = cpu->r[1] + 0xFFFFFFF0u;
         /* 02C82F50 */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 02C82F50 */ cpu->r[1] = _t1;
-        /* 02C82F54 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02C82F54 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02C82F54 */ _t3 = _t2 & 0x00000001u;
         /* 02C82F54 */ if (_t3) goto L_02C82F58; else goto L_02C82F60;
   L_02C82F58: ; // 0x2c82f58
@@ -1003,18 +1003,18 @@ void Gambit_fn_021DE3DC(CPUState* cpu) {
         /* 021DE3E4 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021DE3E4 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021DE3E8 */ cpu->r[31] = cpu->r[3];
-        /* 021DE3E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021DE3E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021DE3EC */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021DE3EC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021DE3F0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DE3F0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DE3F0 */ _t4 = _t3 & 0x00000001u;
         /* 021DE3F0 */ if (_t4) goto L_021DE3F4; else goto L_021DE404;
   L_021DE3F4: ; // 0x21de3f4
         /* 021DE3F4 */ cpu->r[3] = 0x00000204u;
         /* 021DE3F8 */ Gambit_fn_02801A78(cpu);
         /* 021DE3FC */ cpu->r[31] = cpu->r[3];
-        /* 021DE3FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021DE400 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DE3FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021DE400 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DE400 */ _t6 = _t5 & 0x00000001u;
         /* 021DE400 */ if (_t6) goto L_021DE420; else goto L_021DE404;
   L_021DE404: ; // 0x21de404
@@ -1049,18 +1049,18 @@ void Gambit_fn_021DE3E0(CPUState* cpu) {
         /* 021DE3E4 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021DE3E4 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021DE3E8 */ cpu->r[31] = cpu->r[3];
-        /* 021DE3E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021DE3E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021DE3EC */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021DE3EC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021DE3F0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DE3F0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DE3F0 */ _t4 = _t3 & 0x00000001u;
         /* 021DE3F0 */ if (_t4) goto L_021DE3F4; else goto L_021DE404;
   L_021DE3F4: ; // 0x21de3f4
         /* 021DE3F4 */ cpu->r[3] = 0x00000204u;
         /* 021DE3F8 */ Gambit_fn_02801A78(cpu);
         /* 021DE3FC */ cpu->r[31] = cpu->r[3];
-        /* 021DE3FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021DE400 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DE3FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021DE400 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DE400 */ _t6 = _t5 & 0x00000001u;
         /* 021DE400 */ if (_t6) goto L_021DE420; else goto L_021DE404;
   L_021DE404: ; // 0x21de404
@@ -2313,12 +2313,12 @@ void Gambit_fn_021DE954(CPUState* cpu) {
         /* 021DE984 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 021DE988 */ _t9 = cpu->r[10] + 0x00000008u;
         /* 021DE988 */ cpu->r[10] = rbrew_read32(cpu->mem, _t9);
-        /* 021DE98C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021DE98C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021DE990 */ cpu->r[31] = cpu->r[31] + 0x00001704u;
         /* 021DE994 */ cpu->r[30] = cpu->r[3];
         /* 021DE998 */ _t10 = cpu->r[1] + 0x00000010u;
         /* 021DE998 */ rbrew_write32(cpu->mem, _t10, cpu->r[10]);
-        /* 021DE99C */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DE99C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DE99C */ _t12 = _t11 & 0x00000001u;
         /* 021DE99C */ if (_t12) goto L_021DE9A0; else goto L_021DE9CC;
   L_021DE9A0: ; // 0x21de9a0
@@ -2352,8 +2352,8 @@ void Gambit_fn_021DE954(CPUState* cpu) {
         /* 021DE9F0 */ cpu->r[31] = _t17;
         /* 021DE9F4 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 021DE9F4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t18);
-        /* 021DE9F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 021DE9FC */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DE9F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 021DE9FC */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DE9FC */ _t20 = _t19 & 0x00000001u;
         /* 021DE9FC */ if (_t20) goto L_021DEA00; else goto L_021DEA18;
   L_021DEA00: ; // 0x21dea00
@@ -2361,7 +2361,7 @@ void Gambit_fn_021DE954(CPUState* cpu) {
         /* 021DEA04 */ cpu->r[3] = cpu->r[31];
         /* 021DEA08 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 021DEA0C */ cpu->r[4] = cpu->r[4] + 0x00001C4Cu;
-        /* 021DEA10 */ _t21 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 021DEA10 */ _t21 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 021DEA10 */ _t22 = _t21 & 0x00000001u;
         /* 021DEA10 */ if (_t22) goto L_021DEA14; // else: addr-0 trap, fall-through
   L_021DEA14: ; // 0x21dea14
@@ -2418,12 +2418,12 @@ void Gambit_fn_021DE958(CPUState* cpu) {
         /* 021DE984 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 021DE988 */ _t9 = cpu->r[10] + 0x00000008u;
         /* 021DE988 */ cpu->r[10] = rbrew_read32(cpu->mem, _t9);
-        /* 021DE98C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021DE98C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021DE990 */ cpu->r[31] = cpu->r[31] + 0x00001704u;
         /* 021DE994 */ cpu->r[30] = cpu->r[3];
         /* 021DE998 */ _t10 = cpu->r[1] + 0x00000010u;
         /* 021DE998 */ rbrew_write32(cpu->mem, _t10, cpu->r[10]);
-        /* 021DE99C */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DE99C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DE99C */ _t12 = _t11 & 0x00000001u;
         /* 021DE99C */ if (_t12) goto L_021DE9A0; else goto L_021DE9CC;
   L_021DE9A0: ; // 0x21de9a0
@@ -2457,8 +2457,8 @@ void Gambit_fn_021DE958(CPUState* cpu) {
         /* 021DE9F0 */ cpu->r[31] = _t17;
         /* 021DE9F4 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 021DE9F4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t18);
-        /* 021DE9F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 021DE9FC */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DE9F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 021DE9FC */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DE9FC */ _t20 = _t19 & 0x00000001u;
         /* 021DE9FC */ if (_t20) goto L_021DEA00; else goto L_021DEA18;
   L_021DEA00: ; // 0x21dea00
@@ -2466,7 +2466,7 @@ void Gambit_fn_021DE958(CPUState* cpu) {
         /* 021DEA04 */ cpu->r[3] = cpu->r[31];
         /* 021DEA08 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 021DEA0C */ cpu->r[4] = cpu->r[4] + 0x00001C4Cu;
-        /* 021DEA10 */ _t21 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 021DEA10 */ _t21 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 021DEA10 */ _t22 = _t21 & 0x00000001u;
         /* 021DEA10 */ if (_t22) goto L_021DEA14; // else: addr-0 trap, fall-through
   L_021DEA14: ; // 0x21dea14
@@ -2497,15 +2497,15 @@ void Gambit_fn_021DEA48(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021DEA48: ; // 0x21dea48
-        /* 021DEA48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DEA4C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEA48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DEA4C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEA4C */ _t1 = _t0 & 0x00000001u;
         /* 021DEA4C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021DEA4C */ goto L_021DEA50;
   L_021DEA50: ; // 0x21dea50
         /* 021DEA50 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021DEA50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021DEA54 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEA50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021DEA54 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEA54 */ _t3 = _t2 & 0x00000001u;
         /* 021DEA54 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021DEA54 */ goto L_021DEA58;
@@ -2524,8 +2524,8 @@ void Gambit_fn_021DEA48(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -2539,15 +2539,15 @@ void Gambit_fn_021DEA48(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -2575,15 +2575,15 @@ void Gambit_fn_021DEA5C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021DEA5C: ; // 0x21dea5c
-        /* 021DEA5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DEA60 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEA5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DEA60 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEA60 */ _t1 = _t0 & 0x00000001u;
         /* 021DEA60 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021DEA60 */ goto L_021DEA64;
   L_021DEA64: ; // 0x21dea64
         /* 021DEA64 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021DEA64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021DEA68 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEA64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021DEA68 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEA68 */ _t3 = _t2 & 0x00000001u;
         /* 021DEA68 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021DEA68 */ goto L_021DEA6C;
@@ -2602,8 +2602,8 @@ void Gambit_fn_021DEA5C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -2617,15 +2617,15 @@ void Gambit_fn_021DEA5C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -2653,15 +2653,15 @@ void Gambit_fn_021DEA70(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021DEA70: ; // 0x21dea70
-        /* 021DEA70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DEA74 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEA70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DEA74 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEA74 */ _t1 = _t0 & 0x00000001u;
         /* 021DEA74 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021DEA74 */ goto L_021DEA78;
   L_021DEA78: ; // 0x21dea78
         /* 021DEA78 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021DEA78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021DEA7C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEA78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021DEA7C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEA7C */ _t3 = _t2 & 0x00000001u;
         /* 021DEA7C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021DEA7C */ goto L_021DEA80;
@@ -2680,8 +2680,8 @@ void Gambit_fn_021DEA70(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -2695,15 +2695,15 @@ void Gambit_fn_021DEA70(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -2737,15 +2737,15 @@ void Gambit_fn_021DEA88(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021DEA88: ; // 0x21dea88
-        /* 021DEA88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DEA8C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEA88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DEA8C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEA8C */ _t1 = _t0 & 0x00000001u;
         /* 021DEA8C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021DEA8C */ goto L_021DEA90;
   L_021DEA90: ; // 0x21dea90
         /* 021DEA90 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021DEA90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021DEA94 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEA90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021DEA94 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEA94 */ _t3 = _t2 & 0x00000001u;
         /* 021DEA94 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021DEA94 */ goto L_021DEA98;
@@ -2764,8 +2764,8 @@ void Gambit_fn_021DEA88(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -2779,15 +2779,15 @@ void Gambit_fn_021DEA88(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -2843,46 +2843,46 @@ void Gambit_fn_021DEABC(CPUState* cpu) {
         /* 021DEAC8 */ _t3 = cpu->r[1] + 0x00000010u;
         /* 021DEAC8 */ rbrew_write32(cpu->mem, _t3, cpu->r[30]);
         /* 021DEACC */ cpu->r[31] = cpu->r[3];
-        /* 021DEACC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021DEACC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021DEAD0 */ _t4 = cpu->r[1] + 0x0000001Cu;
         /* 021DEAD0 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
-        /* 021DEAD4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEAD4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEAD4 */ _t6 = _t5 & 0x00000001u;
         /* 021DEAD4 */ if (_t6) goto L_021DEAD8; else goto L_021DEAE8;
   L_021DEAD8: ; // 0x21dead8
         /* 021DEAD8 */ cpu->r[3] = 0x0000002Cu;
         /* 021DEADC */ Gambit_fn_02801A78(cpu);
         /* 021DEAE0 */ cpu->r[31] = cpu->r[3];
-        /* 021DEAE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021DEAE4 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEAE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021DEAE4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEAE4 */ _t8 = _t7 & 0x00000001u;
         /* 021DEAE4 */ if (_t8) goto L_021DEB7C; else goto L_021DEAE8;
   L_021DEAE8: ; // 0x21deae8
         /* 021DEAE8 */ cpu->r[29] = cpu->r[31];
-        /* 021DEAE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021DEAEC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEAE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021DEAEC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEAEC */ _t10 = _t9 & 0x00000001u;
         /* 021DEAEC */ if (_t10) goto L_021DEAF0; else goto L_021DEB00;
   L_021DEAF0: ; // 0x21deaf0
         /* 021DEAF0 */ cpu->r[3] = 0x0000002Cu;
         /* 021DEAF4 */ Gambit_fn_02801A78(cpu);
         /* 021DEAF8 */ cpu->r[29] = cpu->r[3];
-        /* 021DEAF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021DEAFC */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEAF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021DEAFC */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEAFC */ _t12 = _t11 & 0x00000001u;
         /* 021DEAFC */ if (_t12) goto L_021DEB70; else goto L_021DEB00;
   L_021DEB00: ; // 0x21deb00
         /* 021DEB00 */ cpu->r[3] = cpu->r[29];
-        /* 021DEB00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021DEB00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021DEB04 */ cpu->r[30] = 0x10110000u;
-        /* 021DEB08 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEB08 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEB08 */ _t14 = _t13 & 0x00000001u;
         /* 021DEB08 */ if (_t14) goto L_021DEB0C; else goto L_021DEB38;
   L_021DEB0C: ; // 0x21deb0c
         /* 021DEB0C */ cpu->r[3] = 0x0000000Cu;
         /* 021DEB10 */ Gambit_fn_02801A78(cpu);
-        /* 021DEB14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DEB18 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEB14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DEB18 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEB18 */ _t16 = _t15 & 0x00000001u;
         /* 021DEB18 */ if (_t16) goto L_021DEB1C; else goto L_021DEB38;
   L_021DEB1C: ; // 0x21deb1c
@@ -2984,8 +2984,8 @@ void Gambit_fn_021DEBB4(CPUState* cpu) {
         /* 021DEBB4 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021DEBB4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021DEBB8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021DEBB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021DEBBC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEBB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021DEBBC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEBBC */ _t2 = _t1 & 0x00000001u;
         /* 021DEBBC */ _t3 = _t2 ^ 0x00000001u;
         /* 021DEBBC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -3007,8 +3007,8 @@ void Gambit_fn_021DEBD0(CPUState* cpu) {
         /* 021DEBD0 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021DEBD0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021DEBD4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021DEBD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021DEBD8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEBD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021DEBD8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEBD8 */ _t2 = _t1 & 0x00000001u;
         /* 021DEBD8 */ _t3 = _t2 ^ 0x00000001u;
         /* 021DEBD8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -3030,8 +3030,8 @@ void Gambit_fn_021DEBEC(CPUState* cpu) {
         /* 021DEBEC */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021DEBEC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021DEBF0 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021DEBF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021DEBF4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEBF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021DEBF4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEBF4 */ _t2 = _t1 & 0x00000001u;
         /* 021DEBF4 */ _t3 = _t2 ^ 0x00000001u;
         /* 021DEBF4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -3074,8 +3074,8 @@ void Gambit_fn_021DEC18(CPUState* cpu) {
         /* 021DEC28 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021DEC2C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021DEC2C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021DEC30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021DEC34 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEC30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021DEC34 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEC34 */ _t5 = _t4 & 0x00000001u;
         /* 021DEC34 */ if (_t5) goto L_021DEC38; else goto L_021DEC54;
   L_021DEC38: ; // 0x21dec38
@@ -3114,8 +3114,8 @@ void Gambit_fn_021DEC1C(CPUState* cpu) {
         /* 021DEC28 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021DEC2C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021DEC2C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021DEC30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021DEC34 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEC30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021DEC34 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEC34 */ _t5 = _t4 & 0x00000001u;
         /* 021DEC34 */ if (_t5) goto L_021DEC38; else goto L_021DEC54;
   L_021DEC38: ; // 0x21dec38
@@ -3622,9 +3622,9 @@ void Gambit_fn_021DEE68(CPUState* cpu) {
         /* 021DEE6C */ _t0 = cpu->r[8] + 0xFFFFFC10u;
         /* 021DEE6C */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 021DEE70 */ cpu->r[6] = 0x101D0000u;
-        /* 021DEE74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021DEE74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021DEE78 */ cpu->r[6] = cpu->r[6] + 0xFFFFFC14u;
-        /* 021DEE7C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEE7C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEE7C */ _t2 = _t1 & 0x00000001u;
         /* 021DEE7C */ if (_t2) goto L_021DEE80; else goto L_021DEE98;
   L_021DEE80: ; // 0x21dee80
@@ -3637,8 +3637,8 @@ void Gambit_fn_021DEE68(CPUState* cpu) {
         /* 021DEE94 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 021DEE94 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_021DEE98: ; // 0x21dee98
-        /* 021DEE98 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 021DEE9C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEE98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 021DEE9C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEE9C */ _t6 = _t5 & 0x00000001u;
         /* 021DEE9C */ if (_t6) goto L_021DEEA0; else goto L_021DEEA8;
   L_021DEEA0: ; // 0x21deea0
@@ -3649,9 +3649,9 @@ void Gambit_fn_021DEE68(CPUState* cpu) {
         /* 021DEEAC */ _t7 = cpu->r[10] + 0xFFFFE5E8u;
         /* 021DEEAC */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 021DEEB0 */ cpu->r[8] = 0x101D0000u;
-        /* 021DEEB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021DEEB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021DEEB8 */ cpu->r[8] = cpu->r[8] + 0xFFFFFC0Cu;
-        /* 021DEEBC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEEBC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEEBC */ _t9 = _t8 & 0x00000001u;
         /* 021DEEBC */ if (_t9) goto L_021DEEC0; else goto L_021DEED8;
   L_021DEEC0: ; // 0x21deec0
@@ -3664,8 +3664,8 @@ void Gambit_fn_021DEE68(CPUState* cpu) {
         /* 021DEED4 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 021DEED4 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_021DEED8: ; // 0x21deed8
-        /* 021DEED8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021DEEDC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEED8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021DEEDC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEEDC */ _t13 = _t12 & 0x00000001u;
         /* 021DEEDC */ if (_t13) goto L_021DEEE0; else goto L_021DEEE8;
   L_021DEEE0: ; // 0x21deee0
@@ -3676,9 +3676,9 @@ void Gambit_fn_021DEE68(CPUState* cpu) {
         /* 021DEEEC */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 021DEEEC */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 021DEEF0 */ cpu->r[10] = 0x101D0000u;
-        /* 021DEEF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021DEEF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021DEEF8 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 021DEEFC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEEFC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEEFC */ _t16 = _t15 & 0x00000001u;
         /* 021DEEFC */ if (_t16) goto L_021DEF00; else goto L_021DEF18;
   L_021DEF00: ; // 0x21def00
@@ -3691,8 +3691,8 @@ void Gambit_fn_021DEE68(CPUState* cpu) {
         /* 021DEF14 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 021DEF14 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_021DEF18: ; // 0x21def18
-        /* 021DEF18 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021DEF1C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEF18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021DEF1C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEF1C */ _t20 = _t19 & 0x00000001u;
         /* 021DEF1C */ if (_t20) goto L_021DEF20; else goto L_021DEF28;
   L_021DEF20: ; // 0x21def20
@@ -3703,9 +3703,9 @@ void Gambit_fn_021DEE68(CPUState* cpu) {
         /* 021DEF2C */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021DEF2C */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021DEF30 */ cpu->r[12] = 0x101D0000u;
-        /* 021DEF34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021DEF34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021DEF38 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021DEF3C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEF3C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEF3C */ _t23 = _t22 & 0x00000001u;
         /* 021DEF3C */ if (_t23) goto L_021DEF40; else goto L_021DEF58;
   L_021DEF40: ; // 0x21def40
@@ -3718,8 +3718,8 @@ void Gambit_fn_021DEE68(CPUState* cpu) {
         /* 021DEF54 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 021DEF54 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_021DEF58: ; // 0x21def58
-        /* 021DEF58 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021DEF5C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEF58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021DEF5C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEF5C */ _t27 = _t26 & 0x00000001u;
         /* 021DEF5C */ if (_t27) goto L_021DEF60; else goto L_021DEF68;
   L_021DEF60: ; // 0x21def60
@@ -3731,9 +3731,9 @@ void Gambit_fn_021DEE68(CPUState* cpu) {
         /* 021DEF6C */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 021DEF6C */ cpu->r[10] = _t28;
         /* 021DEF70 */ cpu->r[7] = 0x101D0000u;
-        /* 021DEF74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021DEF74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021DEF78 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 021DEF7C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEF7C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEF7C */ _t30 = _t29 & 0x00000001u;
         /* 021DEF7C */ if (_t30) goto L_021DEF80; else goto L_021DEF94;
   L_021DEF80: ; // 0x21def80
@@ -3745,8 +3745,8 @@ void Gambit_fn_021DEE68(CPUState* cpu) {
         /* 021DEF90 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 021DEF90 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_021DEF94: ; // 0x21def94
-        /* 021DEF94 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 021DEF98 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEF94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 021DEF98 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEF98 */ _t34 = _t33 & 0x00000001u;
         /* 021DEF98 */ if (_t34) goto L_021DEF9C; else goto L_021DEFA4;
   L_021DEF9C: ; // 0x21def9c
@@ -3758,9 +3758,9 @@ void Gambit_fn_021DEE68(CPUState* cpu) {
         /* 021DEFA8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 021DEFA8 */ cpu->r[8] = _t35;
         /* 021DEFAC */ cpu->r[6] = 0x101D0000u;
-        /* 021DEFB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021DEFB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021DEFB4 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 021DEFB8 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DEFB8 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DEFB8 */ _t37 = _t36 & 0x00000001u;
         /* 021DEFB8 */ if (_t37) goto L_021DEFBC; else goto L_021DEFD0;
   L_021DEFBC: ; // 0x21defbc
@@ -3836,18 +3836,18 @@ void Gambit_fn_021DF018(CPUState* cpu) {
         /* 021DF01C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021DF01C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021DF020 */ cpu->r[31] = cpu->r[3];
-        /* 021DF020 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021DF020 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021DF024 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021DF024 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021DF028 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF028 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF028 */ _t4 = _t3 & 0x00000001u;
         /* 021DF028 */ if (_t4) goto L_021DF02C; else goto L_021DF03C;
   L_021DF02C: ; // 0x21df02c
         /* 021DF02C */ cpu->r[3] = 0x000001B0u;
         /* 021DF030 */ Gambit_fn_02801A78(cpu);
         /* 021DF034 */ cpu->r[31] = cpu->r[3];
-        /* 021DF034 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021DF038 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF034 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021DF038 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF038 */ _t6 = _t5 & 0x00000001u;
         /* 021DF038 */ if (_t6) goto L_021DF0C4; else goto L_021DF03C;
   L_021DF03C: ; // 0x21df03c
@@ -3861,10 +3861,10 @@ void Gambit_fn_021DF018(CPUState* cpu) {
         /* 021DF054 */ _t8 = cpu->r[31] + 0x00000004u;
         /* 021DF054 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 021DF058 */ cpu->r[0] = cpu->r[31] + 0x00000130u;
-        /* 021DF058 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021DF058 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021DF05C */ _t9 = cpu->r[31] + 0x00000128u;
         /* 021DF05C */ rbrew_write8(cpu->mem, _t9, (uint8_t)cpu->r[11]);
-        /* 021DF060 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF060 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF060 */ _t11 = _t10 & 0x00000001u;
         /* 021DF060 */ if (_t11) goto L_021DF064; else goto L_021DF06C;
   L_021DF064: ; // 0x21df064
@@ -3872,8 +3872,8 @@ void Gambit_fn_021DF018(CPUState* cpu) {
         /* 021DF068 */ Gambit_fn_02801A78(cpu);
   L_021DF06C: ; // 0x21df06c
         /* 021DF06C */ cpu->r[11] = cpu->r[31] + 0x0000013Cu;
-        /* 021DF06C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021DF070 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF06C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021DF070 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF070 */ _t13 = _t12 & 0x00000001u;
         /* 021DF070 */ if (_t13) goto L_021DF074; else goto L_021DF07C;
   L_021DF074: ; // 0x21df074
@@ -3881,8 +3881,8 @@ void Gambit_fn_021DF018(CPUState* cpu) {
         /* 021DF078 */ Gambit_fn_02801A78(cpu);
   L_021DF07C: ; // 0x21df07c
         /* 021DF07C */ cpu->r[12] = cpu->r[31] + 0x00000144u;
-        /* 021DF07C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021DF080 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF07C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021DF080 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF080 */ _t15 = _t14 & 0x00000001u;
         /* 021DF080 */ if (_t15) goto L_021DF084; else goto L_021DF08C;
   L_021DF084: ; // 0x21df084
@@ -3890,8 +3890,8 @@ void Gambit_fn_021DF018(CPUState* cpu) {
         /* 021DF088 */ Gambit_fn_02801A78(cpu);
   L_021DF08C: ; // 0x21df08c
         /* 021DF08C */ cpu->r[0] = cpu->r[31] + 0x00000174u;
-        /* 021DF08C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021DF090 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF08C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021DF090 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF090 */ _t17 = _t16 & 0x00000001u;
         /* 021DF090 */ if (_t17) goto L_021DF094; else goto L_021DF09C;
   L_021DF094: ; // 0x21df094
@@ -3899,8 +3899,8 @@ void Gambit_fn_021DF018(CPUState* cpu) {
         /* 021DF098 */ Gambit_fn_02801A78(cpu);
   L_021DF09C: ; // 0x21df09c
         /* 021DF09C */ cpu->r[11] = cpu->r[31] + 0x00000180u;
-        /* 021DF09C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021DF0A0 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF09C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021DF0A0 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF0A0 */ _t19 = _t18 & 0x00000001u;
         /* 021DF0A0 */ if (_t19) goto L_021DF0A4; else goto L_021DF0AC;
   L_021DF0A4: ; // 0x21df0a4
@@ -3908,8 +3908,8 @@ void Gambit_fn_021DF018(CPUState* cpu) {
         /* 021DF0A8 */ Gambit_fn_02801A78(cpu);
   L_021DF0AC: ; // 0x21df0ac
         /* 021DF0AC */ cpu->r[12] = cpu->r[31] + 0x0000018Cu;
-        /* 021DF0AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021DF0B0 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF0AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021DF0B0 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF0B0 */ _t21 = _t20 & 0x00000001u;
         /* 021DF0B0 */ if (_t21) goto L_021DF0B4; else goto L_021DF0BC;
   L_021DF0B4: ; // 0x21df0b4
@@ -4247,9 +4247,9 @@ void Gambit_fn_021DF324(CPUState* cpu) {
         /* 020565CC */ cpu->r[7] = _t2;
         /* 020565D0 */ cpu->r[31] = 0x101E0000u;
         /* 020565D4 */ cpu->r[22] = cpu->r[3];
-        /* 020565D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020565D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020565DC */ cpu->r[31] = cpu->r[31] + 0xFFFFA328u;
-        /* 020565E0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020565E0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020565E0 */ _t4 = _t3 & 0x00000001u;
         /* 020565E0 */ if (_t4) goto L_020565E4; else goto L_0205662C;
   L_020565E4: ; // 0x20565e4
@@ -4275,8 +4275,8 @@ void Gambit_fn_021DF324(CPUState* cpu) {
   L_0205662C: ; // 0x205662c
         /* 0205662C */ _t6 = cpu->r[31] + 0x00000054u;
         /* 0205662C */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 02056630 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02056634 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056630 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02056634 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056634 */ _t8 = _t7 & 0x00000001u;
         /* 02056634 */ if (_t8) goto L_02056638; else goto L_0205672C;
   L_02056638: ; // 0x2056638
@@ -4292,9 +4292,9 @@ void Gambit_fn_021DF324(CPUState* cpu) {
   L_0205665C: ; // 0x205665c
         /* 0205665C */ _t9 = cpu->r[24] + 0xFFFFE518u;
         /* 0205665C */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 02056660 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02056660 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02056664 */ cpu->r[29] = cpu->r[30];
-        /* 02056668 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056668 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056668 */ _t11 = _t10 & 0x00000001u;
         /* 02056668 */ if (_t11) goto L_0205666C; else goto L_02056684;
   L_0205666C: ; // 0x205666c
@@ -4308,8 +4308,8 @@ void Gambit_fn_021DF324(CPUState* cpu) {
   L_02056684: ; // 0x2056684
         /* 02056684 */ _t13 = cpu->r[20] + 0xFFFFE514u;
         /* 02056684 */ cpu->r[11] = rbrew_read32(cpu->mem, _t13);
-        /* 02056688 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0205668C */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056688 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0205668C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0205668C */ _t15 = _t14 & 0x00000001u;
         /* 0205668C */ if (_t15) goto L_02056690; else goto L_02056698;
   L_02056690: ; // 0x2056690
@@ -4318,8 +4318,8 @@ void Gambit_fn_021DF324(CPUState* cpu) {
         /* 02056694 */ _t17 = cpu->r[20] + 0xFFFFE514u;
         /* 02056694 */ rbrew_write32(cpu->mem, _t17, cpu->r[21]);
   L_02056698: ; // 0x2056698
-        /* 02056698 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], 0x00000002u);
-        /* 0205669C */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02056698 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], 0x00000002u));
+        /* 0205669C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0205669C */ _t19 = _t18 & 0x00000001u;
         /* 0205669C */ if (_t19) goto L_020566C4; else goto L_020566A0;
   L_020566A0: ; // 0x20566a0
@@ -4328,12 +4328,12 @@ void Gambit_fn_021DF324(CPUState* cpu) {
         /* 020566A8 */ cpu->r[5] = 0x00000000u;
         /* 020566AC */ Gambit_fn_028A6634(cpu);
         /* 020566B0 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020566B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000002u);
-        /* 020566B8 */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020566B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000002u));
+        /* 020566B8 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020566B8 */ _t21 = _t20 & 0x00000001u;
         /* 020566B8 */ if (_t21) goto L_0205672C; else goto L_020566BC;
   L_020566BC: ; // 0x20566bc
-        /* 020566BC */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020566BC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020566BC */ _t23 = _t22 & 0x00000001u;
         /* 020566BC */ if (_t23) goto L_0205665C; else goto L_020566C0;
   L_020566C0: ; // 0x20566c0
@@ -4341,8 +4341,8 @@ void Gambit_fn_021DF324(CPUState* cpu) {
   L_020566C4: ; // 0x20566c4
         /* 020566C4 */ _t24 = cpu->r[19] + 0xFFFFE510u;
         /* 020566C4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
-        /* 020566C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020566CC */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020566C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020566CC */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020566CC */ _t26 = _t25 & 0x00000001u;
         /* 020566CC */ if (_t26) goto L_020566D0; else goto L_02056708;
   L_020566D0: ; // 0x20566d0
@@ -4351,8 +4351,8 @@ void Gambit_fn_021DF324(CPUState* cpu) {
         /* 020566D8 */ Gambit_fn_02836FFC(cpu);
         /* 020566DC */ _t27 = cpu->r[19] + 0xFFFFE510u;
         /* 020566DC */ cpu->r[0] = rbrew_read32(cpu->mem, _t27);
-        /* 020566E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020566E4 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020566E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020566E4 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020566E4 */ _t29 = _t28 & 0x00000001u;
         /* 020566E4 */ if (_t29) goto L_020566E8; else goto L_020566FC;
   L_020566E8: ; // 0x20566e8
@@ -4375,12 +4375,12 @@ void Gambit_fn_021DF324(CPUState* cpu) {
         /* 02056714 */ cpu->r[4] = cpu->r[30];
         /* 02056718 */ Gambit_fn_028A6634(cpu);
         /* 0205671C */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02056720 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000002u);
-        /* 02056724 */ _t33 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02056720 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000002u));
+        /* 02056724 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02056724 */ _t34 = _t33 & 0x00000001u;
         /* 02056724 */ if (_t34) goto L_0205672C; else goto L_02056728;
   L_02056728: ; // 0x2056728
-        /* 02056728 */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02056728 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02056728 */ _t36 = _t35 & 0x00000001u;
         /* 02056728 */ if (_t36) goto L_0205665C; else goto L_0205672C;
   L_0205672C: ; // 0x205672c
@@ -4414,15 +4414,15 @@ void Gambit_fn_021DF330(CPUState* cpu) {
         /* 021DF338 */ cpu->r[1] = _t1;
         /* 021DF33C */ _t2 = cpu->r[3] + 0x00000054u;
         /* 021DF33C */ cpu->r[0] = rbrew_read32(cpu->mem, _t2);
-        /* 021DF340 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[4]);
-        /* 021DF344 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF340 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[4]));
+        /* 021DF344 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF344 */ _t4 = _t3 & 0x00000001u;
         /* 021DF344 */ if (_t4) goto L_021DF348; else goto L_021DF354;
   L_021DF348: ; // 0x21df348
         /* 021DF348 */ _t5 = cpu->r[3] + 0x0000012Au;
         /* 021DF348 */ cpu->r[12] = rbrew_read8(cpu->mem, _t5);
-        /* 021DF34C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[5]);
-        /* 021DF350 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF34C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[5]));
+        /* 021DF350 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF350 */ _t7 = _t6 & 0x00000001u;
         /* 021DF350 */ if (_t7) goto L_021DF368; else goto L_021DF354;
   L_021DF354: ; // 0x21df354
@@ -4452,15 +4452,15 @@ void Gambit_fn_021DF338(CPUState* cpu) {
         /* 021DF338 */ cpu->r[1] = _t0;
         /* 021DF33C */ _t1 = cpu->r[3] + 0x00000054u;
         /* 021DF33C */ cpu->r[0] = rbrew_read32(cpu->mem, _t1);
-        /* 021DF340 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[4]);
-        /* 021DF344 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF340 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[4]));
+        /* 021DF344 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF344 */ _t3 = _t2 & 0x00000001u;
         /* 021DF344 */ if (_t3) goto L_021DF348; else goto L_021DF354;
   L_021DF348: ; // 0x21df348
         /* 021DF348 */ _t4 = cpu->r[3] + 0x0000012Au;
         /* 021DF348 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
-        /* 021DF34C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[5]);
-        /* 021DF350 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF34C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[5]));
+        /* 021DF350 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF350 */ _t6 = _t5 & 0x00000001u;
         /* 021DF350 */ if (_t6) goto L_021DF368; else goto L_021DF354;
   L_021DF354: ; // 0x21df354
@@ -4772,8 +4772,8 @@ void Gambit_fn_021DF4E0(CPUState* cpu) {
         /* 021DF4F0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021DF4F4 */ _t3 = cpu->r[31] + 0x00000128u;
         /* 021DF4F4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 021DF4F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021DF4FC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF4F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021DF4FC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF4FC */ _t5 = _t4 & 0x00000001u;
         /* 021DF4FC */ if (_t5) goto L_021DF500; else goto L_021DF520;
   L_021DF500: ; // 0x21df500
@@ -4784,10 +4784,10 @@ void Gambit_fn_021DF4E0(CPUState* cpu) {
         /* 021DF508 */ cpu->r[11] = rbrew_read8(cpu->mem, _t7);
         /* 021DF50C */ _t8 = cpu->r[31] + 0x000000DCu;
         /* 021DF50C */ rbrew_write_f32(cpu->mem, _t8, cpu->f[9]);
-        /* 021DF510 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021DF510 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021DF514 */ _t9 = cpu->r[31] + 0x000000E0u;
         /* 021DF514 */ rbrew_write_f32(cpu->mem, _t9, cpu->f[9]);
-        /* 021DF518 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF518 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF518 */ _t11 = _t10 & 0x00000001u;
         /* 021DF518 */ if (_t11) goto L_021DF53C; else goto L_021DF51C;
   L_021DF51C: ; // 0x21df51c
@@ -4800,20 +4800,20 @@ void Gambit_fn_021DF4E0(CPUState* cpu) {
         /* 021DF528 */ cpu->r[11] = rbrew_read8(cpu->mem, _t13);
         /* 021DF52C */ _t14 = cpu->r[31] + 0x000000DCu;
         /* 021DF52C */ rbrew_write_f32(cpu->mem, _t14, cpu->f[9]);
-        /* 021DF530 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021DF530 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021DF534 */ _t15 = cpu->r[31] + 0x000000E0u;
         /* 021DF534 */ rbrew_write_f32(cpu->mem, _t15, cpu->f[9]);
-        /* 021DF538 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF538 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF538 */ _t17 = _t16 & 0x00000001u;
         /* 021DF538 */ if (_t17) goto L_021DF53C; else goto L_021DF554;
   L_021DF53C: ; // 0x21df53c
         /* 021DF53C */ cpu->r[12] = 0x10030000u;
         /* 021DF540 */ _t18 = cpu->r[12] + 0x00002224u;
         /* 021DF540 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t18);
-        /* 021DF544 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021DF544 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021DF548 */ _t19 = cpu->r[31] + 0x000000E4u;
         /* 021DF548 */ rbrew_write_f32(cpu->mem, _t19, cpu->f[10]);
-        /* 021DF54C */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF54C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF54C */ _t21 = _t20 & 0x00000001u;
         /* 021DF54C */ if (_t21) goto L_021DF62C; else goto L_021DF550;
   L_021DF550: ; // 0x21df550
@@ -4822,10 +4822,10 @@ void Gambit_fn_021DF4E0(CPUState* cpu) {
         /* 021DF554 */ cpu->r[8] = 0x10030000u;
         /* 021DF558 */ _t22 = cpu->r[8] + 0x0000223Cu;
         /* 021DF558 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t22);
-        /* 021DF55C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021DF55C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021DF560 */ _t23 = cpu->r[31] + 0x000000E4u;
         /* 021DF560 */ rbrew_write_f32(cpu->mem, _t23, cpu->f[10]);
-        /* 021DF564 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF564 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF564 */ _t25 = _t24 & 0x00000001u;
         /* 021DF564 */ if (_t25) goto L_021DF62C; else goto L_021DF568;
   L_021DF568: ; // 0x21df568
@@ -4841,8 +4841,8 @@ void Gambit_fn_021DF4E0(CPUState* cpu) {
         /* 021DF580 */ cpu->f[7] = fma(cpu->f[13], cpu->f[13], cpu->f[0]);
         /* 021DF584 */ _t29 = cpu->r[10] + 0x00002204u;
         /* 021DF584 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t29);
-        /* 021DF588 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[0]);
-        /* 021DF58C */ _t30 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DF588 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[0]));
+        /* 021DF58C */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DF58C */ _t31 = _t30 & 0x00000001u;
         /* 021DF58C */ if (_t31) goto L_021DF590; else goto L_021DF5D0;
   L_021DF590: ; // 0x21df590
@@ -4875,8 +4875,8 @@ void Gambit_fn_021DF4E0(CPUState* cpu) {
         /* 021DF5D8 */ _t39 = cpu->r[11] + 0x00002240u;
         /* 021DF5D8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t39);
         /* 021DF5DC */ cpu->f[9] = -fma(cpu->f[12], cpu->f[13], -(cpu->f[7]));
-        /* 021DF5E0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
-        /* 021DF5E4 */ _t40 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DF5E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
+        /* 021DF5E4 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DF5E4 */ _t41 = _t40 & 0x00000001u;
         /* 021DF5E4 */ if (_t41) goto L_021DF5E8; else goto L_021DF620;
   L_021DF5E8: ; // 0x21df5e8
@@ -4941,8 +4941,8 @@ void Gambit_fn_021DF4E4(CPUState* cpu) {
         /* 021DF4F0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021DF4F4 */ _t3 = cpu->r[31] + 0x00000128u;
         /* 021DF4F4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 021DF4F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021DF4FC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF4F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021DF4FC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF4FC */ _t5 = _t4 & 0x00000001u;
         /* 021DF4FC */ if (_t5) goto L_021DF500; else goto L_021DF520;
   L_021DF500: ; // 0x21df500
@@ -4953,10 +4953,10 @@ void Gambit_fn_021DF4E4(CPUState* cpu) {
         /* 021DF508 */ cpu->r[11] = rbrew_read8(cpu->mem, _t7);
         /* 021DF50C */ _t8 = cpu->r[31] + 0x000000DCu;
         /* 021DF50C */ rbrew_write_f32(cpu->mem, _t8, cpu->f[9]);
-        /* 021DF510 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021DF510 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021DF514 */ _t9 = cpu->r[31] + 0x000000E0u;
         /* 021DF514 */ rbrew_write_f32(cpu->mem, _t9, cpu->f[9]);
-        /* 021DF518 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF518 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF518 */ _t11 = _t10 & 0x00000001u;
         /* 021DF518 */ if (_t11) goto L_021DF53C; else goto L_021DF51C;
   L_021DF51C: ; // 0x21df51c
@@ -4969,20 +4969,20 @@ void Gambit_fn_021DF4E4(CPUState* cpu) {
         /* 021DF528 */ cpu->r[11] = rbrew_read8(cpu->mem, _t13);
         /* 021DF52C */ _t14 = cpu->r[31] + 0x000000DCu;
         /* 021DF52C */ rbrew_write_f32(cpu->mem, _t14, cpu->f[9]);
-        /* 021DF530 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021DF530 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021DF534 */ _t15 = cpu->r[31] + 0x000000E0u;
         /* 021DF534 */ rbrew_write_f32(cpu->mem, _t15, cpu->f[9]);
-        /* 021DF538 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF538 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF538 */ _t17 = _t16 & 0x00000001u;
         /* 021DF538 */ if (_t17) goto L_021DF53C; else goto L_021DF554;
   L_021DF53C: ; // 0x21df53c
         /* 021DF53C */ cpu->r[12] = 0x10030000u;
         /* 021DF540 */ _t18 = cpu->r[12] + 0x00002224u;
         /* 021DF540 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t18);
-        /* 021DF544 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021DF544 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021DF548 */ _t19 = cpu->r[31] + 0x000000E4u;
         /* 021DF548 */ rbrew_write_f32(cpu->mem, _t19, cpu->f[10]);
-        /* 021DF54C */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF54C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF54C */ _t21 = _t20 & 0x00000001u;
         /* 021DF54C */ if (_t21) goto L_021DF62C; else goto L_021DF550;
   L_021DF550: ; // 0x21df550
@@ -4991,10 +4991,10 @@ void Gambit_fn_021DF4E4(CPUState* cpu) {
         /* 021DF554 */ cpu->r[8] = 0x10030000u;
         /* 021DF558 */ _t22 = cpu->r[8] + 0x0000223Cu;
         /* 021DF558 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t22);
-        /* 021DF55C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021DF55C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021DF560 */ _t23 = cpu->r[31] + 0x000000E4u;
         /* 021DF560 */ rbrew_write_f32(cpu->mem, _t23, cpu->f[10]);
-        /* 021DF564 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF564 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF564 */ _t25 = _t24 & 0x00000001u;
         /* 021DF564 */ if (_t25) goto L_021DF62C; else goto L_021DF568;
   L_021DF568: ; // 0x21df568
@@ -5010,8 +5010,8 @@ void Gambit_fn_021DF4E4(CPUState* cpu) {
         /* 021DF580 */ cpu->f[7] = fma(cpu->f[13], cpu->f[13], cpu->f[0]);
         /* 021DF584 */ _t29 = cpu->r[10] + 0x00002204u;
         /* 021DF584 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t29);
-        /* 021DF588 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[0]);
-        /* 021DF58C */ _t30 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DF588 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[0]));
+        /* 021DF58C */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DF58C */ _t31 = _t30 & 0x00000001u;
         /* 021DF58C */ if (_t31) goto L_021DF590; else goto L_021DF5D0;
   L_021DF590: ; // 0x21df590
@@ -5044,8 +5044,8 @@ void Gambit_fn_021DF4E4(CPUState* cpu) {
         /* 021DF5D8 */ _t39 = cpu->r[11] + 0x00002240u;
         /* 021DF5D8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t39);
         /* 021DF5DC */ cpu->f[9] = -fma(cpu->f[12], cpu->f[13], -(cpu->f[7]));
-        /* 021DF5E0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
-        /* 021DF5E4 */ _t40 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DF5E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
+        /* 021DF5E4 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DF5E4 */ _t41 = _t40 & 0x00000001u;
         /* 021DF5E4 */ if (_t41) goto L_021DF5E8; else goto L_021DF620;
   L_021DF5E8: ; // 0x21df5e8
@@ -5116,8 +5116,8 @@ void Gambit_fn_021DF65C(CPUState* cpu) {
         /* 021DF678 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
         /* 021DF67C */ _t6 = cpu->r[30] + 0x00000051u;
         /* 021DF67C */ cpu->r[7] = rbrew_read8(cpu->mem, _t6);
-        /* 021DF680 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021DF684 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF680 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021DF684 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF684 */ _t8 = _t7 & 0x00000001u;
         /* 021DF684 */ if (_t8) goto L_021DF998; else goto L_021DF688;
   L_021DF688: ; // 0x21df688
@@ -5135,8 +5135,8 @@ void Gambit_fn_021DF65C(CPUState* cpu) {
         /* 021DF6A0 */ cpu->r[4] = rbrew_read8(cpu->mem, _t12);
         /* 021DF6A4 */ Gambit_fn_027910F0(cpu);
         /* 021DF6A8 */ cpu->r[29] = cpu->r[3];
-        /* 021DF6A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021DF6AC */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF6A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021DF6AC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF6AC */ _t14 = _t13 & 0x00000001u;
         /* 021DF6AC */ if (_t14) goto L_021DF998; else goto L_021DF6B0;
   L_021DF6B0: ; // 0x21df6b0
@@ -5144,7 +5144,7 @@ void Gambit_fn_021DF65C(CPUState* cpu) {
         /* 021DF6B0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t15);
         /* 021DF6B4 */ _t16 = cpu->r[30] + 0x00000190u;
         /* 021DF6B4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t16);
-        /* 021DF6B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021DF6B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021DF6BC */ _t17 = cpu->r[30] + 0x00000194u;
         /* 021DF6BC */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t17);
         /* 021DF6C0 */ _t18 = cpu->r[30] + 0x0000018Cu;
@@ -5157,7 +5157,7 @@ void Gambit_fn_021DF65C(CPUState* cpu) {
         /* 021DF6D0 */ cpu->r[11] = cpu->r[11] + 0x00006350u;
         /* 021DF6D4 */ _t21 = cpu->r[1] + 0x00000030u;
         /* 021DF6D4 */ rbrew_write_f32(cpu->mem, _t21, cpu->f[10]);
-        /* 021DF6D8 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF6D8 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF6D8 */ _t23 = _t22 & 0x00000001u;
         /* 021DF6D8 */ if (_t23) goto L_021DF6E0; else goto L_021DF6DC;
   L_021DF6DC: ; // 0x21df6dc
@@ -5194,8 +5194,8 @@ void Gambit_fn_021DF65C(CPUState* cpu) {
         /* 021DF720 */ Gambit_fn_0204D380(cpu);
         /* 021DF724 */ _t36 = cpu->r[30] + 0x00000198u;
         /* 021DF724 */ cpu->r[11] = rbrew_read32(cpu->mem, _t36);
-        /* 021DF728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021DF72C */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021DF72C */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF72C */ _t38 = _t37 & 0x00000001u;
         /* 021DF72C */ if (_t38) goto L_021DF91C; else goto L_021DF730;
   L_021DF730: ; // 0x21df730
@@ -5393,9 +5393,9 @@ void Gambit_fn_021DF65C(CPUState* cpu) {
         /* 021DF918 */ _t103 = cpu->r[1] + 0x00000034u;
         /* 021DF918 */ rbrew_write_f32(cpu->mem, _t103, cpu->f[8]);
   L_021DF91C: ; // 0x21df91c
-        /* 021DF91C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021DF91C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021DF920 */ cpu->r[28] = 0x00000000u;
-        /* 021DF924 */ _t104 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF924 */ _t104 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF924 */ _t105 = _t104 & 0x00000001u;
         /* 021DF924 */ if (_t105) goto L_021DF92C; else goto L_021DF928;
   L_021DF928: ; // 0x21df928
@@ -5409,9 +5409,9 @@ void Gambit_fn_021DF65C(CPUState* cpu) {
         /* 021DF934 */ cpu->r[4] = rbrew_read32(cpu->mem, _t108);
         /* 021DF938 */ _t109 = cpu->r[12] + 0x00000078u;
         /* 021DF938 */ cpu->r[0] = rbrew_read32(cpu->mem, _t109);
-        /* 021DF93C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[0]);
+        /* 021DF93C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[0]));
         /* 021DF940 */ cpu->r[3] = 0x00000000u;
-        /* 021DF944 */ _t110 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DF944 */ _t110 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DF944 */ _t111 = _t110 & 0x00000001u;
         /* 021DF944 */ if (_t111) goto L_021DF948; else goto L_021DF954;
   L_021DF948: ; // 0x21df948
@@ -5485,8 +5485,8 @@ void Gambit_fn_021DF660(CPUState* cpu) {
         /* 021DF678 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
         /* 021DF67C */ _t6 = cpu->r[30] + 0x00000051u;
         /* 021DF67C */ cpu->r[7] = rbrew_read8(cpu->mem, _t6);
-        /* 021DF680 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021DF684 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF680 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021DF684 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF684 */ _t8 = _t7 & 0x00000001u;
         /* 021DF684 */ if (_t8) goto L_021DF998; else goto L_021DF688;
   L_021DF688: ; // 0x21df688
@@ -5504,8 +5504,8 @@ void Gambit_fn_021DF660(CPUState* cpu) {
         /* 021DF6A0 */ cpu->r[4] = rbrew_read8(cpu->mem, _t12);
         /* 021DF6A4 */ Gambit_fn_027910F0(cpu);
         /* 021DF6A8 */ cpu->r[29] = cpu->r[3];
-        /* 021DF6A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021DF6AC */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF6A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021DF6AC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF6AC */ _t14 = _t13 & 0x00000001u;
         /* 021DF6AC */ if (_t14) goto L_021DF998; else goto L_021DF6B0;
   L_021DF6B0: ; // 0x21df6b0
@@ -5513,7 +5513,7 @@ void Gambit_fn_021DF660(CPUState* cpu) {
         /* 021DF6B0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t15);
         /* 021DF6B4 */ _t16 = cpu->r[30] + 0x00000190u;
         /* 021DF6B4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t16);
-        /* 021DF6B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021DF6B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021DF6BC */ _t17 = cpu->r[30] + 0x00000194u;
         /* 021DF6BC */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t17);
         /* 021DF6C0 */ _t18 = cpu->r[30] + 0x0000018Cu;
@@ -5526,7 +5526,7 @@ void Gambit_fn_021DF660(CPUState* cpu) {
         /* 021DF6D0 */ cpu->r[11] = cpu->r[11] + 0x00006350u;
         /* 021DF6D4 */ _t21 = cpu->r[1] + 0x00000030u;
         /* 021DF6D4 */ rbrew_write_f32(cpu->mem, _t21, cpu->f[10]);
-        /* 021DF6D8 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF6D8 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF6D8 */ _t23 = _t22 & 0x00000001u;
         /* 021DF6D8 */ if (_t23) goto L_021DF6E0; else goto L_021DF6DC;
   L_021DF6DC: ; // 0x21df6dc
@@ -5563,8 +5563,8 @@ void Gambit_fn_021DF660(CPUState* cpu) {
         /* 021DF720 */ Gambit_fn_0204D380(cpu);
         /* 021DF724 */ _t36 = cpu->r[30] + 0x00000198u;
         /* 021DF724 */ cpu->r[11] = rbrew_read32(cpu->mem, _t36);
-        /* 021DF728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021DF72C */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021DF72C */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF72C */ _t38 = _t37 & 0x00000001u;
         /* 021DF72C */ if (_t38) goto L_021DF91C; else goto L_021DF730;
   L_021DF730: ; // 0x21df730
@@ -5762,9 +5762,9 @@ void Gambit_fn_021DF660(CPUState* cpu) {
         /* 021DF918 */ _t103 = cpu->r[1] + 0x00000034u;
         /* 021DF918 */ rbrew_write_f32(cpu->mem, _t103, cpu->f[8]);
   L_021DF91C: ; // 0x21df91c
-        /* 021DF91C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021DF91C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021DF920 */ cpu->r[28] = 0x00000000u;
-        /* 021DF924 */ _t104 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF924 */ _t104 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF924 */ _t105 = _t104 & 0x00000001u;
         /* 021DF924 */ if (_t105) goto L_021DF92C; else goto L_021DF928;
   L_021DF928: ; // 0x21df928
@@ -5778,9 +5778,9 @@ void Gambit_fn_021DF660(CPUState* cpu) {
         /* 021DF934 */ cpu->r[4] = rbrew_read32(cpu->mem, _t108);
         /* 021DF938 */ _t109 = cpu->r[12] + 0x00000078u;
         /* 021DF938 */ cpu->r[0] = rbrew_read32(cpu->mem, _t109);
-        /* 021DF93C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[0]);
+        /* 021DF93C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[0]));
         /* 021DF940 */ cpu->r[3] = 0x00000000u;
-        /* 021DF944 */ _t110 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DF944 */ _t110 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DF944 */ _t111 = _t110 & 0x00000001u;
         /* 021DF944 */ if (_t111) goto L_021DF948; else goto L_021DF954;
   L_021DF948: ; // 0x21df948
@@ -5855,13 +5855,13 @@ void Gambit_fn_021DF9C8(CPUState* cpu) {
         /* 021DF9E8 */ Gambit_fn_0222C57C(cpu);
         /* 021DF9EC */ _t4 = cpu->r[31] + 0x0000001Cu;
         /* 021DF9EC */ cpu->r[7] = rbrew_read32(cpu->mem, _t4);
-        /* 021DF9F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000002u);
-        /* 021DF9F4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF9F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000002u));
+        /* 021DF9F4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF9F4 */ _t6 = _t5 & 0x00000001u;
         /* 021DF9F4 */ if (_t6) goto L_021DFA00; else goto L_021DF9F8;
   L_021DF9F8: ; // 0x21df9f8
-        /* 021DF9F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000003u);
-        /* 021DF9FC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF9F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000003u));
+        /* 021DF9FC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF9FC */ _t8 = _t7 & 0x00000001u;
         /* 021DF9FC */ if (_t8) goto L_021DFA00; else goto L_021DFB14;
   L_021DFA00: ; // 0x21dfa00
@@ -5881,8 +5881,8 @@ void Gambit_fn_021DF9C8(CPUState* cpu) {
         /* 021DFA24 */ cpu->f[13] = fma(cpu->f[12], cpu->f[12], cpu->f[13]);
         /* 021DFA28 */ _t13 = cpu->r[9] + 0x00002204u;
         /* 021DFA28 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t13);
-        /* 021DFA2C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 021DFA30 */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DFA2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 021DFA30 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DFA30 */ _t15 = _t14 & 0x00000001u;
         /* 021DFA30 */ if (_t15) goto L_021DFA34; else goto L_021DFA58;
   L_021DFA34: ; // 0x21dfa34
@@ -5902,8 +5902,8 @@ void Gambit_fn_021DF9C8(CPUState* cpu) {
   L_021DFA58: ; // 0x21dfa58
         /* 021DFA58 */ _t20 = cpu->r[31] + 0x00000128u;
         /* 021DFA58 */ cpu->r[8] = rbrew_read8(cpu->mem, _t20);
-        /* 021DFA5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021DFA60 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFA5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021DFA60 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFA60 */ _t22 = _t21 & 0x00000001u;
         /* 021DFA60 */ if (_t22) goto L_021DFA6C; else goto L_021DFA64;
   L_021DFA64: ; // 0x21dfa64
@@ -5919,13 +5919,13 @@ void Gambit_fn_021DF9C8(CPUState* cpu) {
         /* 021DFA7C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021DFA80 */ _t25 = cpu->r[31] + 0x0000001Cu;
         /* 021DFA80 */ cpu->r[7] = rbrew_read32(cpu->mem, _t25);
-        /* 021DFA84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000002u);
-        /* 021DFA88 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFA84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000002u));
+        /* 021DFA88 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFA88 */ _t27 = _t26 & 0x00000001u;
         /* 021DFA88 */ if (_t27) goto L_021DFA94; else goto L_021DFA8C;
   L_021DFA8C: ; // 0x21dfa8c
-        /* 021DFA8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000003u);
-        /* 021DFA90 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFA8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000003u));
+        /* 021DFA90 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFA90 */ _t29 = _t28 & 0x00000001u;
         /* 021DFA90 */ if (_t29) goto L_021DFA94; else goto L_021DFAE8;
   L_021DFA94: ; // 0x21dfa94
@@ -5965,9 +5965,9 @@ void Gambit_fn_021DF9C8(CPUState* cpu) {
   L_021DFAE8: ; // 0x21dfae8
         /* 021DFAE8 */ _t42 = cpu->r[31] + 0x00000128u;
         /* 021DFAE8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t42);
-        /* 021DFAEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021DFAEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021DFAF0 */ cpu->r[3] = cpu->r[31];
-        /* 021DFAF4 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFAF4 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFAF4 */ _t44 = _t43 & 0x00000001u;
         /* 021DFAF4 */ if (_t44) goto L_021DFB10; else goto L_021DFAF8;
   L_021DFAF8: ; // 0x21dfaf8
@@ -6012,13 +6012,13 @@ void Gambit_fn_021DF9CC(CPUState* cpu) {
         /* 021DF9E8 */ Gambit_fn_0222C57C(cpu);
         /* 021DF9EC */ _t4 = cpu->r[31] + 0x0000001Cu;
         /* 021DF9EC */ cpu->r[7] = rbrew_read32(cpu->mem, _t4);
-        /* 021DF9F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000002u);
-        /* 021DF9F4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF9F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000002u));
+        /* 021DF9F4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF9F4 */ _t6 = _t5 & 0x00000001u;
         /* 021DF9F4 */ if (_t6) goto L_021DFA00; else goto L_021DF9F8;
   L_021DF9F8: ; // 0x21df9f8
-        /* 021DF9F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000003u);
-        /* 021DF9FC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DF9F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000003u));
+        /* 021DF9FC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DF9FC */ _t8 = _t7 & 0x00000001u;
         /* 021DF9FC */ if (_t8) goto L_021DFA00; else goto L_021DFB14;
   L_021DFA00: ; // 0x21dfa00
@@ -6038,8 +6038,8 @@ void Gambit_fn_021DF9CC(CPUState* cpu) {
         /* 021DFA24 */ cpu->f[13] = fma(cpu->f[12], cpu->f[12], cpu->f[13]);
         /* 021DFA28 */ _t13 = cpu->r[9] + 0x00002204u;
         /* 021DFA28 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t13);
-        /* 021DFA2C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 021DFA30 */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DFA2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 021DFA30 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DFA30 */ _t15 = _t14 & 0x00000001u;
         /* 021DFA30 */ if (_t15) goto L_021DFA34; else goto L_021DFA58;
   L_021DFA34: ; // 0x21dfa34
@@ -6059,8 +6059,8 @@ void Gambit_fn_021DF9CC(CPUState* cpu) {
   L_021DFA58: ; // 0x21dfa58
         /* 021DFA58 */ _t20 = cpu->r[31] + 0x00000128u;
         /* 021DFA58 */ cpu->r[8] = rbrew_read8(cpu->mem, _t20);
-        /* 021DFA5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021DFA60 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFA5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021DFA60 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFA60 */ _t22 = _t21 & 0x00000001u;
         /* 021DFA60 */ if (_t22) goto L_021DFA6C; else goto L_021DFA64;
   L_021DFA64: ; // 0x21dfa64
@@ -6076,13 +6076,13 @@ void Gambit_fn_021DF9CC(CPUState* cpu) {
         /* 021DFA7C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021DFA80 */ _t25 = cpu->r[31] + 0x0000001Cu;
         /* 021DFA80 */ cpu->r[7] = rbrew_read32(cpu->mem, _t25);
-        /* 021DFA84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000002u);
-        /* 021DFA88 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFA84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000002u));
+        /* 021DFA88 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFA88 */ _t27 = _t26 & 0x00000001u;
         /* 021DFA88 */ if (_t27) goto L_021DFA94; else goto L_021DFA8C;
   L_021DFA8C: ; // 0x21dfa8c
-        /* 021DFA8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000003u);
-        /* 021DFA90 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFA8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000003u));
+        /* 021DFA90 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFA90 */ _t29 = _t28 & 0x00000001u;
         /* 021DFA90 */ if (_t29) goto L_021DFA94; else goto L_021DFAE8;
   L_021DFA94: ; // 0x21dfa94
@@ -6122,9 +6122,9 @@ void Gambit_fn_021DF9CC(CPUState* cpu) {
   L_021DFAE8: ; // 0x21dfae8
         /* 021DFAE8 */ _t42 = cpu->r[31] + 0x00000128u;
         /* 021DFAE8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t42);
-        /* 021DFAEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021DFAEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021DFAF0 */ cpu->r[3] = cpu->r[31];
-        /* 021DFAF4 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFAF4 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFAF4 */ _t44 = _t43 & 0x00000001u;
         /* 021DFAF4 */ if (_t44) goto L_021DFB10; else goto L_021DFAF8;
   L_021DFAF8: ; // 0x21dfaf8
@@ -6162,43 +6162,43 @@ void Gambit_fn_021DFB28(CPUState* cpu) {
         /* 021DFB34 */ cpu->r[30] = cpu->r[3];
         /* 021DFB38 */ _t2 = cpu->r[1] + 0x0000000Cu;
         /* 021DFB38 */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
-        /* 021DFB3C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000009u);
+        /* 021DFB3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000009u));
         /* 021DFB40 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 021DFB40 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 021DFB44 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DFB44 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DFB44 */ _t5 = _t4 & 0x00000001u;
         /* 021DFB44 */ if (_t5) goto L_021DFB48; else goto L_021DFB60;
   L_021DFB48: ; // 0x21dfb48
-        /* 021DFB48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000001u);
-        /* 021DFB4C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFB48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000001u));
+        /* 021DFB4C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFB4C */ _t7 = _t6 & 0x00000001u;
         /* 021DFB4C */ if (_t7) goto L_021DFBE4; else goto L_021DFB50;
   L_021DFB50: ; // 0x21dfb50
-        /* 021DFB50 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000006u);
-        /* 021DFB54 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFB50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000006u));
+        /* 021DFB54 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFB54 */ _t9 = _t8 & 0x00000001u;
         /* 021DFB54 */ if (_t9) goto L_021DFBE4; else goto L_021DFB58;
   L_021DFB58: ; // 0x21dfb58
         /* 021DFB58 */ cpu->r[3] = 0x00000000u;
         /* 021DFB5C */ goto L_021DFC04;
   L_021DFB60: ; // 0x21dfb60
-        /* 021DFB60 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000009u);
-        /* 021DFB64 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFB60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000009u));
+        /* 021DFB64 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFB64 */ _t11 = _t10 & 0x00000001u;
         /* 021DFB64 */ if (_t11) goto L_021DFBE4; else goto L_021DFB68;
   L_021DFB68: ; // 0x21dfb68
-        /* 021DFB68 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x0000000Bu);
-        /* 021DFB6C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFB68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x0000000Bu));
+        /* 021DFB6C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFB6C */ _t13 = _t12 & 0x00000001u;
         /* 021DFB6C */ if (_t13) goto L_021DFB80; else goto L_021DFB70;
   L_021DFB70: ; // 0x21dfb70
-        /* 021DFB70 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x0000000Du);
-        /* 021DFB74 */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DFB70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x0000000Du));
+        /* 021DFB74 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DFB74 */ _t15 = _t14 & 0x00000001u;
         /* 021DFB74 */ if (_t15) goto L_021DFC00; else goto L_021DFB78;
   L_021DFB78: ; // 0x21dfb78
-        /* 021DFB78 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x0000000Eu);
-        /* 021DFB7C */ _t16 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DFB78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x0000000Eu));
+        /* 021DFB7C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DFB7C */ _t17 = _t16 & 0x00000001u;
         /* 021DFB7C */ if (_t17) goto L_021DFC00; else goto L_021DFB80;
   L_021DFB80: ; // 0x21dfb80
@@ -6206,8 +6206,8 @@ void Gambit_fn_021DFB28(CPUState* cpu) {
         /* 021DFB80 */ cpu->r[0] = rbrew_read32(cpu->mem, _t18);
         /* 021DFB84 */ _t19 = cpu->r[5] + 0x00000000u;
         /* 021DFB84 */ cpu->r[10] = rbrew_read32(cpu->mem, _t19);
-        /* 021DFB88 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[0]);
-        /* 021DFB8C */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFB88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[0]));
+        /* 021DFB8C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFB8C */ _t21 = _t20 & 0x00000001u;
         /* 021DFB8C */ if (_t21) goto L_021DFC00; else goto L_021DFB90;
   L_021DFB90: ; // 0x21dfb90
@@ -6276,43 +6276,43 @@ void Gambit_fn_021DFB2C(CPUState* cpu) {
         /* 021DFB34 */ cpu->r[30] = cpu->r[3];
         /* 021DFB38 */ _t2 = cpu->r[1] + 0x0000000Cu;
         /* 021DFB38 */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
-        /* 021DFB3C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000009u);
+        /* 021DFB3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000009u));
         /* 021DFB40 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 021DFB40 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 021DFB44 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DFB44 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DFB44 */ _t5 = _t4 & 0x00000001u;
         /* 021DFB44 */ if (_t5) goto L_021DFB48; else goto L_021DFB60;
   L_021DFB48: ; // 0x21dfb48
-        /* 021DFB48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000001u);
-        /* 021DFB4C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFB48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000001u));
+        /* 021DFB4C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFB4C */ _t7 = _t6 & 0x00000001u;
         /* 021DFB4C */ if (_t7) goto L_021DFBE4; else goto L_021DFB50;
   L_021DFB50: ; // 0x21dfb50
-        /* 021DFB50 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000006u);
-        /* 021DFB54 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFB50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000006u));
+        /* 021DFB54 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFB54 */ _t9 = _t8 & 0x00000001u;
         /* 021DFB54 */ if (_t9) goto L_021DFBE4; else goto L_021DFB58;
   L_021DFB58: ; // 0x21dfb58
         /* 021DFB58 */ cpu->r[3] = 0x00000000u;
         /* 021DFB5C */ goto L_021DFC04;
   L_021DFB60: ; // 0x21dfb60
-        /* 021DFB60 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000009u);
-        /* 021DFB64 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFB60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000009u));
+        /* 021DFB64 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFB64 */ _t11 = _t10 & 0x00000001u;
         /* 021DFB64 */ if (_t11) goto L_021DFBE4; else goto L_021DFB68;
   L_021DFB68: ; // 0x21dfb68
-        /* 021DFB68 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x0000000Bu);
-        /* 021DFB6C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFB68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x0000000Bu));
+        /* 021DFB6C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFB6C */ _t13 = _t12 & 0x00000001u;
         /* 021DFB6C */ if (_t13) goto L_021DFB80; else goto L_021DFB70;
   L_021DFB70: ; // 0x21dfb70
-        /* 021DFB70 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x0000000Du);
-        /* 021DFB74 */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DFB70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x0000000Du));
+        /* 021DFB74 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DFB74 */ _t15 = _t14 & 0x00000001u;
         /* 021DFB74 */ if (_t15) goto L_021DFC00; else goto L_021DFB78;
   L_021DFB78: ; // 0x21dfb78
-        /* 021DFB78 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x0000000Eu);
-        /* 021DFB7C */ _t16 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DFB78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x0000000Eu));
+        /* 021DFB7C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DFB7C */ _t17 = _t16 & 0x00000001u;
         /* 021DFB7C */ if (_t17) goto L_021DFC00; else goto L_021DFB80;
   L_021DFB80: ; // 0x21dfb80
@@ -6320,8 +6320,8 @@ void Gambit_fn_021DFB2C(CPUState* cpu) {
         /* 021DFB80 */ cpu->r[0] = rbrew_read32(cpu->mem, _t18);
         /* 021DFB84 */ _t19 = cpu->r[5] + 0x00000000u;
         /* 021DFB84 */ cpu->r[10] = rbrew_read32(cpu->mem, _t19);
-        /* 021DFB88 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[0]);
-        /* 021DFB8C */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFB88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[0]));
+        /* 021DFB8C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFB8C */ _t21 = _t20 & 0x00000001u;
         /* 021DFB8C */ if (_t21) goto L_021DFC00; else goto L_021DFB90;
   L_021DFB90: ; // 0x21dfb90
@@ -6418,8 +6418,8 @@ void Gambit_fn_021DFC1C(CPUState* cpu) {
         /* 021DFC6C */ cpu->r[28] = cpu->r[3];
         /* 021DFC70 */ cpu->r[31] = cpu->r[5];
         /* 021DFC74 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021DFC78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DFC7C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFC78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DFC7C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFC7C */ _t13 = _t12 & 0x00000001u;
         /* 021DFC7C */ if (_t13) goto L_021DFC84; else goto L_021DFC80;
   L_021DFC80: ; // 0x21dfc80
@@ -6432,13 +6432,13 @@ void Gambit_fn_021DFC1C(CPUState* cpu) {
         /* 021DFC90 */ _t15 = cpu->r[11] + 0x00001EF8u;
         /* 021DFC90 */ cpu->r[3] = rbrew_read32(cpu->mem, _t15);
         /* 021DFC94 */ cpu->r[8] = 0x101E0000u;
-        /* 021DFC98 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[0]);
+        /* 021DFC98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[0]));
         /* 021DFC9C */ _t16 = cpu->r[8] + 0xFFFF958Cu;
         /* 021DFC9C */ cpu->f[3] = rbrew_read_f32(cpu->mem, _t16);
         /* 021DFCA0 */ cpu->r[11] = cpu->r[28] + 0x000000B0u;
         /* 021DFCA4 */ cpu->r[8] = cpu->r[29] | 0x000000FFu;
         /* 021DFCA8 */ cpu->r[4] = cpu->r[30];
-        /* 021DFCAC */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DFCAC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DFCAC */ _t18 = _t17 & 0x00000001u;
         /* 021DFCAC */ if (_t18) goto L_021DFCE4; else goto L_021DFCB0;
   L_021DFCB0: ; // 0x21dfcb0
@@ -6493,7 +6493,7 @@ void Gambit_fn_021DFC1C(CPUState* cpu) {
         /* 021DFD34 */ _t32 = cpu->r[1] + 0x00000018u;
         /* 021DFD34 */ cpu->r[30] = rbrew_read32(cpu->mem, _t32);
         /* 021DFD38 */ cpu->r[3] = cpu->r[0];
-        /* 021DFD3C */ _t33 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DFD3C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DFD3C */ _t34 = _t33 & 0x00000001u;
         /* 021DFD3C */ if (_t34) goto L_021DFD40; // else: addr-0 trap, fall-through
   L_021DFD40: ; // 0x21dfd40
@@ -6544,8 +6544,8 @@ void Gambit_fn_021DFC20(CPUState* cpu) {
         /* 021DFC6C */ cpu->r[28] = cpu->r[3];
         /* 021DFC70 */ cpu->r[31] = cpu->r[5];
         /* 021DFC74 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021DFC78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021DFC7C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFC78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021DFC7C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFC7C */ _t13 = _t12 & 0x00000001u;
         /* 021DFC7C */ if (_t13) goto L_021DFC84; else goto L_021DFC80;
   L_021DFC80: ; // 0x21dfc80
@@ -6558,13 +6558,13 @@ void Gambit_fn_021DFC20(CPUState* cpu) {
         /* 021DFC90 */ _t15 = cpu->r[11] + 0x00001EF8u;
         /* 021DFC90 */ cpu->r[3] = rbrew_read32(cpu->mem, _t15);
         /* 021DFC94 */ cpu->r[8] = 0x101E0000u;
-        /* 021DFC98 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[0]);
+        /* 021DFC98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[0]));
         /* 021DFC9C */ _t16 = cpu->r[8] + 0xFFFF958Cu;
         /* 021DFC9C */ cpu->f[3] = rbrew_read_f32(cpu->mem, _t16);
         /* 021DFCA0 */ cpu->r[11] = cpu->r[28] + 0x000000B0u;
         /* 021DFCA4 */ cpu->r[8] = cpu->r[29] | 0x000000FFu;
         /* 021DFCA8 */ cpu->r[4] = cpu->r[30];
-        /* 021DFCAC */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DFCAC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DFCAC */ _t18 = _t17 & 0x00000001u;
         /* 021DFCAC */ if (_t18) goto L_021DFCE4; else goto L_021DFCB0;
   L_021DFCB0: ; // 0x21dfcb0
@@ -6619,7 +6619,7 @@ void Gambit_fn_021DFC20(CPUState* cpu) {
         /* 021DFD34 */ _t32 = cpu->r[1] + 0x00000018u;
         /* 021DFD34 */ cpu->r[30] = rbrew_read32(cpu->mem, _t32);
         /* 021DFD38 */ cpu->r[3] = cpu->r[0];
-        /* 021DFD3C */ _t33 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021DFD3C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021DFD3C */ _t34 = _t33 & 0x00000001u;
         /* 021DFD3C */ if (_t34) goto L_021DFD40; // else: addr-0 trap, fall-through
   L_021DFD40: ; // 0x21dfd40
@@ -6649,8 +6649,8 @@ void Gambit_fn_021DFD50(CPUState* cpu) {
         /* 021DFD6C */ cpu->r[6] = cpu->r[4] + 0x101E0000u;
         /* 021DFD70 */ _t3 = cpu->r[6] + 0xFFFF9484u;
         /* 021DFD70 */ cpu->r[31] = rbrew_read32(cpu->mem, _t3);
-        /* 021DFD74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021DFD78 */ _t4 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DFD74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021DFD78 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DFD78 */ _t5 = _t4 & 0x00000001u;
         /* 021DFD78 */ if (_t5) goto L_021DFD7C; else goto L_021DFED0;
   L_021DFD7C: ; // 0x21dfd7c
@@ -6663,14 +6663,14 @@ void Gambit_fn_021DFD50(CPUState* cpu) {
         /* 021DFD88 */ cpu->r[9] = rbrew_read32(cpu->mem, _t8);
         /* 021DFD8C */ _t9 = cpu->r[9] + 0x00000014u;
         /* 021DFD8C */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 021DFD90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021DFD94 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFD90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021DFD94 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFD94 */ _t11 = _t10 & 0x00000001u;
         /* 021DFD94 */ if (_t11) goto L_021DFED0; else goto L_021DFD98;
   L_021DFD98: ; // 0x21dfd98
-        /* 021DFD98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021DFD98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021DFD9C */ cpu->r[23] = 0x00000000u;
-        /* 021DFDA0 */ _t12 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DFDA0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DFDA0 */ _t13 = _t12 & 0x00000001u;
         /* 021DFDA0 */ if (_t13) goto L_021DFDA8; else goto L_021DFDA4;
   L_021DFDA4: ; // 0x21dfda4
@@ -6695,8 +6695,8 @@ void Gambit_fn_021DFD50(CPUState* cpu) {
         /* 021DFDDC */ cpu->r[8] = rbrew_read32(cpu->mem, _t15);
         /* 021DFDE0 */ _t16 = cpu->r[8] + 0x000001ACu;
         /* 021DFDE0 */ cpu->r[22] = rbrew_read32(cpu->mem, _t16);
-        /* 021DFDE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
-        /* 021DFDE8 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFDE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
+        /* 021DFDE8 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFDE8 */ _t18 = _t17 & 0x00000001u;
         /* 021DFDE8 */ if (_t18) goto L_021DFEC4; else goto L_021DFDEC;
   L_021DFDEC: ; // 0x21dfdec
@@ -6725,25 +6725,25 @@ void Gambit_fn_021DFD50(CPUState* cpu) {
         /* 021DFE20 */ cpu->r[10] = rbrew_read32(cpu->mem, _t26);
         /* 021DFE24 */ cpu->r[21] = cpu->r[10] - cpu->r[28];
   L_021DFE28: ; // 0x21dfe28
-        /* 021DFE28 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[21], cpu->r[29]);
-        /* 021DFE2C */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFE28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[21], cpu->r[29]));
+        /* 021DFE2C */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFE2C */ _t28 = _t27 & 0x00000001u;
         /* 021DFE2C */ if (_t28) goto L_021DFE44; else goto L_021DFE30;
   L_021DFE30: ; // 0x21dfe30
         /* 021DFE30 */ _t29 = cpu->r[21] + 0x0000001Cu;
         /* 021DFE30 */ cpu->r[4] = rbrew_read32(cpu->mem, _t29);
-        /* 021DFE34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000002u);
-        /* 021DFE38 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFE34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000002u));
+        /* 021DFE38 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFE38 */ _t31 = _t30 & 0x00000001u;
         /* 021DFE38 */ if (_t31) goto L_021DFE44; else goto L_021DFE3C;
   L_021DFE3C: ; // 0x21dfe3c
-        /* 021DFE3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000003u);
-        /* 021DFE40 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFE3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000003u));
+        /* 021DFE40 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFE40 */ _t33 = _t32 & 0x00000001u;
         /* 021DFE40 */ if (_t33) goto L_021DFE44; else goto L_021DFE1C;
   L_021DFE44: ; // 0x21dfe44
-        /* 021DFE44 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[21], cpu->r[29]);
-        /* 021DFE48 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFE44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[21], cpu->r[29]));
+        /* 021DFE48 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFE48 */ _t35 = _t34 & 0x00000001u;
         /* 021DFE48 */ if (_t35) goto L_021DFEC4; else goto L_021DFE4C;
   L_021DFE4C: ; // 0x21dfe4c
@@ -6759,8 +6759,8 @@ void Gambit_fn_021DFD50(CPUState* cpu) {
         /* 021DFE68 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021DFE6C */ _t38 = cpu->r[1] + 0x00000008u;
         /* 021DFE6C */ cpu->r[0] = rbrew_read32(cpu->mem, _t38);
-        /* 021DFE70 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[22], cpu->r[0]);
-        /* 021DFE74 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFE70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[22], cpu->r[0]));
+        /* 021DFE74 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFE74 */ _t40 = _t39 & 0x00000001u;
         /* 021DFE74 */ if (_t40) goto L_021DFE78; else goto L_021DFE90;
   L_021DFE78: ; // 0x21dfe78
@@ -6776,34 +6776,34 @@ void Gambit_fn_021DFD50(CPUState* cpu) {
         /* 021DFE94 */ _t42 = cpu->r[11] + 0x00000004u;
         /* 021DFE94 */ cpu->r[0] = rbrew_read32(cpu->mem, _t42);
         /* 021DFE98 */ cpu->r[21] = cpu->r[0] - cpu->r[28];
-        /* 021DFE9C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[21], cpu->r[29]);
-        /* 021DFEA0 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFE9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[21], cpu->r[29]));
+        /* 021DFEA0 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFEA0 */ _t44 = _t43 & 0x00000001u;
         /* 021DFEA0 */ if (_t44) goto L_021DFEC4; else goto L_021DFEA4;
   L_021DFEA4: ; // 0x21dfea4
         /* 021DFEA4 */ _t45 = cpu->r[21] + 0x0000001Cu;
         /* 021DFEA4 */ cpu->r[6] = rbrew_read32(cpu->mem, _t45);
-        /* 021DFEA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000002u);
-        /* 021DFEAC */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFEA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000002u));
+        /* 021DFEAC */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFEAC */ _t47 = _t46 & 0x00000001u;
         /* 021DFEAC */ if (_t47) goto L_021DFEBC; else goto L_021DFEB0;
   L_021DFEB0: ; // 0x21dfeb0
-        /* 021DFEB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000003u);
-        /* 021DFEB4 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFEB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000003u));
+        /* 021DFEB4 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFEB4 */ _t49 = _t48 & 0x00000001u;
         /* 021DFEB4 */ if (_t49) goto L_021DFEB8; else goto L_021DFE90;
   L_021DFEB8: ; // 0x21dfeb8
         /* 021DFEB8 */ goto L_021DFE44;
   L_021DFEBC: ; // 0x21dfebc
-        /* 021DFEBC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[21], cpu->r[29]);
-        /* 021DFEC0 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFEBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[21], cpu->r[29]));
+        /* 021DFEC0 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFEC0 */ _t51 = _t50 & 0x00000001u;
         /* 021DFEC0 */ if (_t51) goto L_021DFEC4; else goto L_021DFE4C;
   L_021DFEC4: ; // 0x21dfec4
         /* 021DFEC4 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 021DFEC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021DFEC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021DFEC8 */ cpu->r[23] = cpu->r[23] + 0x00000001u;
-        /* 021DFECC */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021DFECC */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021DFECC */ _t53 = _t52 & 0x00000001u;
         /* 021DFECC */ if (_t53) goto L_021DFED0; else goto L_021DFDB4;
   L_021DFED0: ; // 0x21dfed0
@@ -6943,11 +6943,11 @@ void Gambit_fn_021DFF44(CPUState* cpu) {
         /* 021DFFA8 */ cpu->f[10] = fma(cpu->f[8], cpu->f[8], cpu->f[0]);
         /* 021DFFAC */ _t15 = cpu->r[10] + 0x00002204u;
         /* 021DFFAC */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t15);
-        /* 021DFFB0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[12]);
+        /* 021DFFB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[12]));
         /* 021DFFB4 */ cpu->f[31] = cpu->f[1];
         /* 021DFFB8 */ _t16 = cpu->r[1] + 0x0000000Cu;
         /* 021DFFB8 */ rbrew_write_f32(cpu->mem, _t16, cpu->f[12]);
-        /* 021DFFBC */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DFFBC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DFFBC */ _t18 = _t17 & 0x00000001u;
         /* 021DFFBC */ if (_t18) goto L_021DFFC0; else goto L_021DFFFC;
   L_021DFFC0: ; // 0x21dffc0
@@ -7014,7 +7014,7 @@ void Gambit_fn_021DFF44(CPUState* cpu) {
         /* 021E0068 */ cpu->r[31] = rbrew_read32(cpu->mem, _t35);
         /* 021E006C */ _t36 = cpu->r[1] + 0x00000060u;
         /* 021E006C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t36);
-        /* 021E0070 */ _t37 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E0070 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E0070 */ _t38 = _t37 & 0x00000001u;
         /* 021E0070 */ if (_t38) goto L_021E0074; // else: addr-0 trap, fall-through
   L_021E0074: ; // 0x21e0074
@@ -7074,11 +7074,11 @@ void Gambit_fn_021DFF48(CPUState* cpu) {
         /* 021DFFA8 */ cpu->f[10] = fma(cpu->f[8], cpu->f[8], cpu->f[0]);
         /* 021DFFAC */ _t15 = cpu->r[10] + 0x00002204u;
         /* 021DFFAC */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t15);
-        /* 021DFFB0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[12]);
+        /* 021DFFB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[12]));
         /* 021DFFB4 */ cpu->f[31] = cpu->f[1];
         /* 021DFFB8 */ _t16 = cpu->r[1] + 0x0000000Cu;
         /* 021DFFB8 */ rbrew_write_f32(cpu->mem, _t16, cpu->f[12]);
-        /* 021DFFBC */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021DFFBC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021DFFBC */ _t18 = _t17 & 0x00000001u;
         /* 021DFFBC */ if (_t18) goto L_021DFFC0; else goto L_021DFFFC;
   L_021DFFC0: ; // 0x21dffc0
@@ -7145,7 +7145,7 @@ void Gambit_fn_021DFF48(CPUState* cpu) {
         /* 021E0068 */ cpu->r[31] = rbrew_read32(cpu->mem, _t35);
         /* 021E006C */ _t36 = cpu->r[1] + 0x00000060u;
         /* 021E006C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t36);
-        /* 021E0070 */ _t37 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E0070 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E0070 */ _t38 = _t37 & 0x00000001u;
         /* 021E0070 */ if (_t38) goto L_021E0074; // else: addr-0 trap, fall-through
   L_021E0074: ; // 0x21e0074
@@ -7189,31 +7189,31 @@ void Gambit_fn_021E0084(CPUState* cpu) {
         /* 021E00C0 */ _t8 = cpu->r[30] + 0x0000015Cu;
         /* 021E00C0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t8);
         /* 021E00C4 */ cpu->r[6] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 021E00C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 021E00C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 021E00C8 */ cpu->r[28] = 0x00000000u;
-        /* 021E00CC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E00CC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E00CC */ _t10 = _t9 & 0x00000001u;
         /* 021E00CC */ if (_t10) goto L_021E00DC; else goto L_021E00D0;
   L_021E00D0: ; // 0x21e00d0
         /* 021E00D0 */ _t11 = cpu->r[30] + 0x0000008Cu;
         /* 021E00D0 */ cpu->r[10] = rbrew_read16(cpu->mem, _t11);
         /* 021E00D4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[10], 0x00000017u, 0x0000001Fu, 0x0000001Fu);
-        /* 021E00D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E00D8 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E00D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E00D8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E00D8 */ _t13 = _t12 & 0x00000001u;
         /* 021E00D8 */ if (_t13) goto L_021E00DC; else goto L_021E00F0;
   L_021E00DC: ; // 0x21e00dc
         /* 021E00DC */ cpu->r[4] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021E00DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 021E00E0 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E00DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 021E00E0 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E00E0 */ _t15 = _t14 & 0x00000001u;
         /* 021E00E0 */ if (_t15) goto L_021E0100; else goto L_021E00E4;
   L_021E00E4: ; // 0x21e00e4
         /* 021E00E4 */ _t16 = cpu->r[30] + 0x000000D8u;
         /* 021E00E4 */ cpu->r[5] = rbrew_read16(cpu->mem, _t16);
         /* 021E00E8 */ cpu->r[6] = rbrew_rlwinm(cpu->r[5], 0x00000017u, 0x0000001Fu, 0x0000001Fu);
-        /* 021E00E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 021E00EC */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E00E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 021E00EC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E00EC */ _t18 = _t17 & 0x00000001u;
         /* 021E00EC */ if (_t18) goto L_021E0100; else goto L_021E00F0;
   L_021E00F0: ; // 0x21e00f0
@@ -7228,8 +7228,8 @@ void Gambit_fn_021E0084(CPUState* cpu) {
         /* 021E0108 */ _t20 = cpu->r[30] + 0x0000015Cu;
         /* 021E0108 */ cpu->r[11] = rbrew_read32(cpu->mem, _t20);
         /* 021E010C */ cpu->r[10] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x0000001Cu, 0x0000001Eu);
-        /* 021E010C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021E0110 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E010C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021E0110 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0110 */ _t22 = _t21 & 0x00000001u;
         /* 021E0110 */ if (_t22) goto L_021E0114; else goto L_021E011C;
   L_021E0114: ; // 0x21e0114
@@ -7244,19 +7244,19 @@ void Gambit_fn_021E0084(CPUState* cpu) {
         /* 021E012C */ _t24 = cpu->r[9] + 0x00002210u;
         /* 021E012C */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t24);
         /* 021E0130 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021E0130 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021E0130 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021E0134 */ _t25 = cpu->r[8] + 0x00002204u;
         /* 021E0134 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t25);
-        /* 021E0138 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0138 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0138 */ _t27 = _t26 & 0x00000001u;
         /* 021E0138 */ if (_t27) goto L_021E0174; else goto L_021E013C;
   L_021E013C: ; // 0x21e013c
         /* 021E013C */ cpu->r[3] = cpu->r[30] + 0x0000012Cu;
         /* 021E0140 */ Gambit_fn_02C69350(cpu);
-        /* 021E0144 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
+        /* 021E0144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
         /* 021E0148 */ _t28 = cpu->r[30] + 0x00000000u;
         /* 021E0148 */ cpu->r[0] = rbrew_read32(cpu->mem, _t28);
-        /* 021E014C */ _t29 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E014C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E014C */ _t30 = _t29 & 0x00000001u;
         /* 021E014C */ if (_t30) goto L_021E0150; else goto L_021E016C;
   L_021E0150: ; // 0x21e0150
@@ -7305,17 +7305,17 @@ void Gambit_fn_021E0084(CPUState* cpu) {
         /* 021E01B0 */ cpu->r[10] = rbrew_rlwinm(cpu->r[11], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 021E01B4 */ _t47 = cpu->r[10] + cpu->r[0];
         /* 021E01B4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t47);
-        /* 021E01B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E01BC */ _t48 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E01B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E01BC */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E01BC */ _t49 = _t48 & 0x00000001u;
         /* 021E01BC */ if (_t49) goto L_021E01C0; else goto L_021E0334;
   L_021E01C0: ; // 0x21e01c0
         /* 021E01C0 */ cpu->r[12] = 0x10030000u;
-        /* 021E01C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021E01C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021E01C8 */ cpu->r[27] = 0x00000000u;
         /* 021E01CC */ _t50 = cpu->r[12] + 0x00002264u;
         /* 021E01CC */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t50);
-        /* 021E01D0 */ _t51 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E01D0 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E01D0 */ _t52 = _t51 & 0x00000001u;
         /* 021E01D0 */ if (_t52) goto L_021E01D8; else goto L_021E01D4;
   L_021E01D4: ; // 0x21e01d4
@@ -7340,8 +7340,8 @@ void Gambit_fn_021E0084(CPUState* cpu) {
         /* 021E020C */ _t55 = cpu->r[5] + 0x00000000u;
         /* 021E020C */ cpu->r[0] = rbrew_read32(cpu->mem, _t55);
         /* 021E0210 */ cpu->r[10] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021E0210 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021E0214 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0210 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021E0214 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0214 */ _t57 = _t56 & 0x00000001u;
         /* 021E0214 */ if (_t57) goto L_021E029C; else goto L_021E0218;
   L_021E0218: ; // 0x21e0218
@@ -7387,7 +7387,7 @@ void Gambit_fn_021E0084(CPUState* cpu) {
         /* 021E0278 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t72);
         /* 021E027C */ _t73 = cpu->r[1] + 0x00000008u;
         /* 021E027C */ cpu->r[9] = rbrew_read32(cpu->mem, _t73);
-        /* 021E0280 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[30]);
+        /* 021E0280 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[30]));
         /* 021E0284 */ _t74 = cpu->r[1] + 0x00000010u;
         /* 021E0284 */ rbrew_write_f32(cpu->mem, _t74, cpu->f[11]);
         /* 021E0288 */ _t75 = cpu->r[1] + 0x00000010u;
@@ -7396,7 +7396,7 @@ void Gambit_fn_021E0084(CPUState* cpu) {
         /* 021E028C */ rbrew_write32(cpu->mem, _t76, cpu->r[9]);
         /* 021E0290 */ _t77 = cpu->r[1] + 0x00000034u;
         /* 021E0290 */ rbrew_write32(cpu->mem, _t77, cpu->r[0]);
-        /* 021E0294 */ _t78 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E0294 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E0294 */ _t79 = _t78 & 0x00000001u;
         /* 021E0294 */ if (_t79) goto L_021E0298; else goto L_021E02E0;
   L_021E0298: ; // 0x21e0298
@@ -7420,7 +7420,7 @@ void Gambit_fn_021E0084(CPUState* cpu) {
         /* 021E02B8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t87);
         /* 021E02BC */ _t88 = cpu->r[1] + 0x00000008u;
         /* 021E02BC */ cpu->r[9] = rbrew_read32(cpu->mem, _t88);
-        /* 021E02C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[30]);
+        /* 021E02C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[30]));
         /* 021E02C4 */ _t89 = cpu->r[1] + 0x00000010u;
         /* 021E02C4 */ rbrew_write_f32(cpu->mem, _t89, cpu->f[0]);
         /* 021E02C8 */ _t90 = cpu->r[1] + 0x00000010u;
@@ -7429,7 +7429,7 @@ void Gambit_fn_021E0084(CPUState* cpu) {
         /* 021E02CC */ rbrew_write32(cpu->mem, _t91, cpu->r[9]);
         /* 021E02D0 */ _t92 = cpu->r[1] + 0x00000034u;
         /* 021E02D0 */ rbrew_write32(cpu->mem, _t92, cpu->r[0]);
-        /* 021E02D4 */ _t93 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E02D4 */ _t93 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E02D4 */ _t94 = _t93 & 0x00000001u;
         /* 021E02D4 */ if (_t94) goto L_021E02D8; else goto L_021E02E0;
   L_021E02D8: ; // 0x21e02d8
@@ -7438,9 +7438,9 @@ void Gambit_fn_021E0084(CPUState* cpu) {
         /* 021E02DC */ rbrew_write32(cpu->mem, _t95, cpu->r[4]);
   L_021E02E0: ; // 0x21e02e0
         /* 021E02E0 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 021E02E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021E02E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021E02E4 */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 021E02E8 */ _t96 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E02E8 */ _t96 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E02E8 */ _t97 = _t96 & 0x00000001u;
         /* 021E02E8 */ if (_t97) goto L_021E02EC; else goto L_021E01DC;
   L_021E02EC: ; // 0x21e02ec
@@ -7449,8 +7449,8 @@ void Gambit_fn_021E0084(CPUState* cpu) {
         /* 021E02F4 */ cpu->r[27] = 0x00000000u;
         /* 021E02F8 */ Gambit_fn_021DFD50(cpu);
         /* 021E02FC */ cpu->r[31] = cpu->r[3];
-        /* 021E02FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E0300 */ _t98 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E02FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E0300 */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0300 */ _t99 = _t98 & 0x00000001u;
         /* 021E0300 */ if (_t99) goto L_021E0304; else goto L_021E0350;
   L_021E0304: ; // 0x21e0304
@@ -7476,8 +7476,8 @@ void Gambit_fn_021E0084(CPUState* cpu) {
         /* 021E0340 */ rbrew_write32(cpu->mem, _t102, cpu->r[28]);
         /* 021E0344 */ Gambit_fn_021DFD50(cpu);
         /* 021E0348 */ cpu->r[31] = cpu->r[3];
-        /* 021E0348 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E034C */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0348 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E034C */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E034C */ _t104 = _t103 & 0x00000001u;
         /* 021E034C */ if (_t104) goto L_021E0304; else goto L_021E0350;
   L_021E0350: ; // 0x21e0350
@@ -7525,8 +7525,8 @@ void Gambit_fn_021E0084(CPUState* cpu) {
         /* 021E03BC */ _t119 = cpu->r[1] + 0x00000040u;
         /* 021E03BC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t119);
         /* 021E03C0 */ cpu->f[9] = fma(cpu->f[0], cpu->f[0], cpu->f[12]);
-        /* 021E03C4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[31]);
-        /* 021E03C8 */ _t120 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E03C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[31]));
+        /* 021E03C8 */ _t120 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E03C8 */ _t121 = _t120 & 0x00000001u;
         /* 021E03C8 */ if (_t121) goto L_021E03F0; else goto L_021E03CC;
   L_021E03CC: ; // 0x21e03cc
@@ -7537,8 +7537,8 @@ void Gambit_fn_021E0084(CPUState* cpu) {
         /* 021E03DC */ _t122 = cpu->r[29] + 0x00000188u;
         /* 021E03DC */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t122);
         /* 021E03E0 */ cpu->f[8] = fma(cpu->f[0], cpu->f[10], cpu->f[8]);
-        /* 021E03E4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
-        /* 021E03E8 */ _t123 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E03E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
+        /* 021E03E8 */ _t123 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E03E8 */ _t124 = _t123 & 0x00000001u;
         /* 021E03E8 */ if (_t124) goto L_021E03EC; else goto L_021E0450;
   L_021E03EC: ; // 0x21e03ec
@@ -7568,10 +7568,10 @@ void Gambit_fn_021E0084(CPUState* cpu) {
         /* 021E0430 */ _t130 = cpu->r[29] + 0x00000188u;
         /* 021E0430 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t130);
         /* 021E0434 */ cpu->f[8] = fma(cpu->f[0], cpu->f[10], cpu->f[8]);
-        /* 021E0438 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
+        /* 021E0438 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
         /* 021E043C */ _t131 = cpu->r[1] + 0x00000040u;
         /* 021E043C */ rbrew_write_f32(cpu->mem, _t131, cpu->f[0]);
-        /* 021E0440 */ _t132 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E0440 */ _t132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E0440 */ _t133 = _t132 & 0x00000001u;
         /* 021E0440 */ if (_t133) goto L_021E0444; else goto L_021E0450;
   L_021E0444: ; // 0x21e0444
@@ -7580,20 +7580,20 @@ void Gambit_fn_021E0084(CPUState* cpu) {
         /* 021E0448 */ cpu->r[3] = 0x00000000u;
         /* 021E044C */ goto L_021E04D4;
   L_021E0450: ; // 0x21e0450
-        /* 021E0450 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[30]);
-        /* 021E0454 */ _t135 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E0450 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[30]));
+        /* 021E0454 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E0454 */ _t136 = _t135 & 0x00000001u;
         /* 021E0454 */ if (_t136) goto L_021E0458; else goto L_021E0304;
   L_021E0458: ; // 0x21e0458
         /* 021E0458 */ _t137 = cpu->r[29] + 0x0000012Bu;
         /* 021E0458 */ cpu->r[6] = rbrew_read8(cpu->mem, _t137);
-        /* 021E045C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 021E0460 */ _t138 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E045C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 021E0460 */ _t138 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0460 */ _t139 = _t138 & 0x00000001u;
         /* 021E0460 */ if (_t139) goto L_021E0464; else goto L_021E04A0;
   L_021E0464: ; // 0x21e0464
-        /* 021E0464 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E0468 */ _t140 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E0468 */ _t140 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0468 */ _t141 = _t140 & 0x00000001u;
         /* 021E0468 */ if (_t141) goto L_021E04A0; else goto L_021E046C;
   L_021E046C: ; // 0x21e046c
@@ -7614,8 +7614,8 @@ void Gambit_fn_021E0084(CPUState* cpu) {
         /* 021E0498 */ Gambit_fn_02040DBC(cpu);
         /* 021E049C */ goto L_021E04D0;
   L_021E04A0: ; // 0x21e04a0
-        /* 021E04A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 021E04A4 */ _t145 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E04A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 021E04A4 */ _t145 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E04A4 */ _t146 = _t145 & 0x00000001u;
         /* 021E04A4 */ if (_t146) goto L_021E0304; else goto L_021E04A8;
   L_021E04A8: ; // 0x21e04a8
@@ -7647,7 +7647,7 @@ void Gambit_fn_021E0084(CPUState* cpu) {
         /* 021E04E8 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t153);
         /* 021E04EC */ _t154 = cpu->r[1] + 0x00000098u;
         /* 021E04EC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t154);
-        /* 021E04F0 */ _t155 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E04F0 */ _t155 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E04F0 */ _t156 = _t155 & 0x00000001u;
         /* 021E04F0 */ if (_t156) goto L_021E04F4; // else: addr-0 trap, fall-through
   L_021E04F4: ; // 0x21e04f4
@@ -7717,30 +7717,30 @@ void Gambit_fn_021E0504(CPUState* cpu) {
         /* 021E057C */ cpu->r[7] = rbrew_read32(cpu->mem, _t18);
         /* 021E0580 */ cpu->r[30] = cpu->r[4];
         /* 021E0584 */ cpu->r[8] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 021E0584 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021E0588 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021E0588 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0588 */ _t20 = _t19 & 0x00000001u;
         /* 021E0588 */ if (_t20) goto L_021E0598; else goto L_021E058C;
   L_021E058C: ; // 0x21e058c
         /* 021E058C */ _t21 = cpu->r[28] + 0x0000008Cu;
         /* 021E058C */ cpu->r[11] = rbrew_read16(cpu->mem, _t21);
         /* 021E0590 */ cpu->r[0] = rbrew_rlwinm(cpu->r[11], 0x00000017u, 0x0000001Fu, 0x0000001Fu);
-        /* 021E0590 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E0594 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0590 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E0594 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0594 */ _t23 = _t22 & 0x00000001u;
         /* 021E0594 */ if (_t23) goto L_021E0598; else goto L_021E05AC;
   L_021E0598: ; // 0x21e0598
         /* 021E0598 */ cpu->r[0] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021E0598 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E059C */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0598 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E059C */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E059C */ _t25 = _t24 & 0x00000001u;
         /* 021E059C */ if (_t25) goto L_021E05BC; else goto L_021E05A0;
   L_021E05A0: ; // 0x21e05a0
         /* 021E05A0 */ _t26 = cpu->r[28] + 0x000000D8u;
         /* 021E05A0 */ cpu->r[8] = rbrew_read16(cpu->mem, _t26);
         /* 021E05A4 */ cpu->r[9] = rbrew_rlwinm(cpu->r[8], 0x00000017u, 0x0000001Fu, 0x0000001Fu);
-        /* 021E05A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 021E05A8 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E05A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 021E05A8 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E05A8 */ _t28 = _t27 & 0x00000001u;
         /* 021E05A8 */ if (_t28) goto L_021E05BC; else goto L_021E05AC;
   L_021E05AC: ; // 0x21e05ac
@@ -7754,19 +7754,19 @@ void Gambit_fn_021E0504(CPUState* cpu) {
         /* 021E05C0 */ cpu->r[9] = 0x10030000u;
         /* 021E05C4 */ cpu->r[31] = cpu->r[28] + 0x000000A8u;
         /* 021E05C8 */ cpu->r[11] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021E05C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021E05C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021E05CC */ _t30 = cpu->r[9] + 0x00002204u;
         /* 021E05CC */ cpu->f[27] = rbrew_read_f32(cpu->mem, _t30);
-        /* 021E05D0 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E05D0 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E05D0 */ _t32 = _t31 & 0x00000001u;
         /* 021E05D0 */ if (_t32) goto L_021E0614; else goto L_021E05D4;
   L_021E05D4: ; // 0x21e05d4
         /* 021E05D4 */ cpu->r[3] = cpu->r[28] + 0x00000138u;
         /* 021E05D8 */ Gambit_fn_02C69350(cpu);
-        /* 021E05DC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[27]);
+        /* 021E05DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[27]));
         /* 021E05E0 */ _t33 = cpu->r[28] + 0x00000000u;
         /* 021E05E0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t33);
-        /* 021E05E4 */ _t34 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E05E4 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E05E4 */ _t35 = _t34 & 0x00000001u;
         /* 021E05E4 */ if (_t35) goto L_021E05E8; else goto L_021E060C;
   L_021E05E8: ; // 0x21e05e8
@@ -7796,7 +7796,7 @@ void Gambit_fn_021E0504(CPUState* cpu) {
         /* 021E0628 */ _t41 = cpu->r[7] + 0x00002274u;
         /* 021E0628 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t41);
         /* 021E062C */ cpu->r[6] = 0x10030000u;
-        /* 021E0630 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
+        /* 021E0630 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
         /* 021E0634 */ cpu->r[12] = 0x10030000u;
         /* 021E0638 */ _t42 = cpu->r[6] + 0x0000226Cu;
         /* 021E0638 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t42);
@@ -7805,16 +7805,16 @@ void Gambit_fn_021E0504(CPUState* cpu) {
         /* 021E0644 */ /* nop */
         /* 021E0648 */ _t43 = cpu->r[12] + 0x00002270u;
         /* 021E0648 */ cpu->f[2] = rbrew_read_f32(cpu->mem, _t43);
-        /* 021E064C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 021E064C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 021E0650 */ _t44 = cpu->r[10] + 0x00002208u;
         /* 021E0650 */ cpu->f[26] = rbrew_read_f32(cpu->mem, _t44);
         /* 021E0654 */ cpu->r[28] = rbrew_rlwinm(cpu->r[0], 0x00000002u, 0x0000001Fu, 0x0000001Fu);
-        /* 021E0658 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0658 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0658 */ _t46 = _t45 & 0x00000001u;
         /* 021E0658 */ if (_t46) goto L_021E06A4; else goto L_021E065C;
   L_021E065C: ; // 0x21e065c
-        /* 021E065C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021E0660 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E065C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021E0660 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0660 */ _t48 = _t47 & 0x00000001u;
         /* 021E0660 */ if (_t48) goto L_021E0694; else goto L_021E0664;
   L_021E0664: ; // 0x21e0664
@@ -7830,8 +7830,8 @@ void Gambit_fn_021E0504(CPUState* cpu) {
         /* 021E067C */ cpu->r[4] = cpu->r[31];
         /* 021E0680 */ cpu->f[1] = cpu->f[26];
         /* 021E0684 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021E0688 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 021E068C */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0688 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 021E068C */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E068C */ _t53 = _t52 & 0x00000001u;
         /* 021E068C */ if (_t53) goto L_021E08E8; else goto L_021E0690;
   L_021E0690: ; // 0x21e0690
@@ -7852,13 +7852,13 @@ void Gambit_fn_021E0504(CPUState* cpu) {
         /* 021E06B0 */ cpu->r[3] = cpu->r[29];
         /* 021E06B4 */ cpu->r[4] = cpu->r[31];
         /* 021E06B8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021E06BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 021E06C0 */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E06BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 021E06C0 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E06C0 */ _t59 = _t58 & 0x00000001u;
         /* 021E06C0 */ if (_t59) goto L_021E08E8; else goto L_021E06C4;
   L_021E06C4: ; // 0x21e06c4
-        /* 021E06C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021E06C8 */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E06C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021E06C8 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E06C8 */ _t61 = _t60 & 0x00000001u;
         /* 021E06C8 */ if (_t61) goto L_021E08E8; else goto L_021E06CC;
   L_021E06CC: ; // 0x21e06cc
@@ -7884,10 +7884,10 @@ void Gambit_fn_021E0504(CPUState* cpu) {
         /* 021E06F4 */ cpu->f[11] = fma(cpu->f[13], cpu->f[13], cpu->f[10]);
         /* 021E06F8 */ cpu->f[28] = fma(cpu->f[25], cpu->f[25], cpu->f[11]);
         /* 021E06FC */ cpu->r[9] = 0x10030000u;
-        /* 021E0700 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[27]);
+        /* 021E0700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[27]));
         /* 021E0704 */ _t71 = cpu->r[9] + 0x00002218u;
         /* 021E0704 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t71);
-        /* 021E0708 */ _t72 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E0708 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E0708 */ _t73 = _t72 & 0x00000001u;
         /* 021E0708 */ if (_t73) goto L_021E070C; else goto L_021E0740;
   L_021E070C: ; // 0x21e070c
@@ -7918,18 +7918,18 @@ void Gambit_fn_021E0504(CPUState* cpu) {
         /* 021E0750 */ _t80 = cpu->r[31] + 0x00002284u;
         /* 021E0750 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t80);
         /* 021E0754 */ Gambit_fn_02C886F8(cpu);
-        /* 021E0758 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[24]);
+        /* 021E0758 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[24]));
         /* 021E075C */ /* nop */
         /* 021E0760 */ _t81 = cpu->r[31] + 0x00002284u;
         /* 021E0760 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t81);
         /* 021E0764 */ cpu->r[31] = rbrew_rlwinm(cpu->r[8], 0x00000001u, 0x0000001Fu, 0x0000001Fu);
         /* 021E0768 */ Gambit_fn_02C886F8(cpu);
-        /* 021E076C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[24]);
+        /* 021E076C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[24]));
         /* 021E0770 */ /* nop */
         /* 021E0774 */ cpu->r[0] = rbrew_rlwinm(cpu->r[9], 0x00000002u, 0x0000001Fu, 0x0000001Fu);
         /* 021E0778 */ cpu->r[0] = cpu->r[31] | cpu->r[0];
-        /* 021E0778 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E077C */ _t82 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0778 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E077C */ _t82 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E077C */ _t83 = _t82 & 0x00000001u;
         /* 021E077C */ if (_t83) goto L_021E08E8; else goto L_021E0780;
   L_021E0780: ; // 0x21e0780
@@ -7955,8 +7955,8 @@ void Gambit_fn_021E0504(CPUState* cpu) {
         /* 021E07B4 */ _t90 = cpu->r[1] + 0x00000028u;
         /* 021E07B4 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t90);
         /* 021E07B8 */ cpu->f[12] = fma(cpu->f[11], cpu->f[11], cpu->f[9]);
-        /* 021E07BC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[27]);
-        /* 021E07C0 */ _t91 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E07BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[27]));
+        /* 021E07C0 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E07C0 */ _t92 = _t91 & 0x00000001u;
         /* 021E07C0 */ if (_t92) goto L_021E07C4; else goto L_021E07F0;
   L_021E07C4: ; // 0x21e07c4
@@ -7976,8 +7976,8 @@ void Gambit_fn_021E0504(CPUState* cpu) {
         /* 021E07E8 */ rbrew_write_f32(cpu->mem, _t96, cpu->f[0]);
         /* 021E07EC */ /* nop */
   L_021E07F0: ; // 0x21e07f0
-        /* 021E07F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E07F4 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E07F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E07F4 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E07F4 */ _t98 = _t97 & 0x00000001u;
         /* 021E07F4 */ if (_t98) goto L_021E0850; else goto L_021E07F8;
   L_021E07F8: ; // 0x21e07f8
@@ -8008,8 +8008,8 @@ void Gambit_fn_021E0504(CPUState* cpu) {
         /* 021E083C */ _t106 = cpu->r[1] + 0x00000010u;
         /* 021E083C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t106);
         /* 021E0840 */ cpu->f[7] = fma(cpu->f[13], cpu->f[13], cpu->f[9]);
-        /* 021E0844 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[27]);
-        /* 021E0848 */ _t107 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E0844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[27]));
+        /* 021E0848 */ _t107 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E0848 */ _t108 = _t107 & 0x00000001u;
         /* 021E0848 */ if (_t108) goto L_021E084C; else goto L_021E08DC;
   L_021E084C: ; // 0x21e084c
@@ -8042,8 +8042,8 @@ void Gambit_fn_021E0504(CPUState* cpu) {
         /* 021E0894 */ _t116 = cpu->r[1] + 0x00000010u;
         /* 021E0894 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t116);
         /* 021E0898 */ cpu->f[7] = fma(cpu->f[13], cpu->f[13], cpu->f[9]);
-        /* 021E089C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[27]);
-        /* 021E08A0 */ _t117 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E089C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[27]));
+        /* 021E08A0 */ _t117 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E08A0 */ _t118 = _t117 & 0x00000001u;
         /* 021E08A0 */ if (_t118) goto L_021E08A4; else goto L_021E08DC;
   L_021E08A4: ; // 0x21e08a4
@@ -8118,7 +8118,7 @@ void Gambit_fn_021E0504(CPUState* cpu) {
         /* 021E0938 */ cpu->f[24] = rbrew_read_f64(cpu->mem, _t146);
         /* 021E093C */ _t147 = cpu->r[1] + 0x000000F0u;
         /* 021E093C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t147);
-        /* 021E0940 */ _t148 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E0940 */ _t148 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E0940 */ _t149 = _t148 & 0x00000001u;
         /* 021E0940 */ if (_t149) goto L_021E0944; // else: addr-0 trap, fall-through
   L_021E0944: ; // 0x21e0944
@@ -8334,8 +8334,8 @@ void Gambit_fn_021E09D4(CPUState* cpu) {
         /* 021E0A78 */ rbrew_write32(cpu->mem, _t28, cpu->r[12]);
         /* 021E0A7C */ _t29 = cpu->r[1] + 0x0000000Cu;
         /* 021E0A7C */ rbrew_write_f32(cpu->mem, _t29, cpu->f[31]);
-        /* 021E0A80 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[31]);
-        /* 021E0A84 */ _t30 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E0A80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[31]));
+        /* 021E0A84 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E0A84 */ _t31 = _t30 & 0x00000001u;
         /* 021E0A84 */ if (_t31) goto L_021E0A88; else goto L_021E0AC4;
   L_021E0A88: ; // 0x21e0a88
@@ -8366,8 +8366,8 @@ void Gambit_fn_021E09D4(CPUState* cpu) {
         /* 021E0ACC */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 021E0AD0 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 021E0AD4 */ Gambit_fn_021C6DD8(cpu);
-        /* 021E0AD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E0ADC */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0AD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E0ADC */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0ADC */ _t39 = _t38 & 0x00000001u;
         /* 021E0ADC */ if (_t39) goto L_021E0AE0; else goto L_021E0AF4;
   L_021E0AE0: ; // 0x21e0ae0
@@ -8423,7 +8423,7 @@ void Gambit_fn_021E09D4(CPUState* cpu) {
         /* 021E0B5C */ cpu->r[31] = rbrew_read32(cpu->mem, _t56);
         /* 021E0B60 */ _t57 = cpu->r[1] + 0x000000A8u;
         /* 021E0B60 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t57);
-        /* 021E0B64 */ _t58 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E0B64 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E0B64 */ _t59 = _t58 & 0x00000001u;
         /* 021E0B64 */ if (_t59) goto L_021E0B68; // else: addr-0 trap, fall-through
   L_021E0B68: ; // 0x21e0b68
@@ -8513,8 +8513,8 @@ void Gambit_fn_021E09D8(CPUState* cpu) {
         /* 021E0A78 */ rbrew_write32(cpu->mem, _t28, cpu->r[12]);
         /* 021E0A7C */ _t29 = cpu->r[1] + 0x0000000Cu;
         /* 021E0A7C */ rbrew_write_f32(cpu->mem, _t29, cpu->f[31]);
-        /* 021E0A80 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[31]);
-        /* 021E0A84 */ _t30 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E0A80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[31]));
+        /* 021E0A84 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E0A84 */ _t31 = _t30 & 0x00000001u;
         /* 021E0A84 */ if (_t31) goto L_021E0A88; else goto L_021E0AC4;
   L_021E0A88: ; // 0x21e0a88
@@ -8545,8 +8545,8 @@ void Gambit_fn_021E09D8(CPUState* cpu) {
         /* 021E0ACC */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 021E0AD0 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 021E0AD4 */ Gambit_fn_021C6DD8(cpu);
-        /* 021E0AD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E0ADC */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0AD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E0ADC */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0ADC */ _t39 = _t38 & 0x00000001u;
         /* 021E0ADC */ if (_t39) goto L_021E0AE0; else goto L_021E0AF4;
   L_021E0AE0: ; // 0x21e0ae0
@@ -8602,7 +8602,7 @@ void Gambit_fn_021E09D8(CPUState* cpu) {
         /* 021E0B5C */ cpu->r[31] = rbrew_read32(cpu->mem, _t56);
         /* 021E0B60 */ _t57 = cpu->r[1] + 0x000000A8u;
         /* 021E0B60 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t57);
-        /* 021E0B64 */ _t58 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E0B64 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E0B64 */ _t59 = _t58 & 0x00000001u;
         /* 021E0B64 */ if (_t59) goto L_021E0B68; // else: addr-0 trap, fall-through
   L_021E0B68: ; // 0x21e0b68
@@ -8629,7 +8629,7 @@ void Gambit_fn_021E0B78(CPUState* cpu) {
         /* 021E0B88 */ _t4 = cpu->r[4] + 0x00000000u;
         /* 021E0B88 */ rbrew_write16(cpu->mem, _t4, (uint16_t)cpu->r[0]);
         /* 021E0B8C */ cpu->r[11] = cpu->r[9] & 0x0000FEFFu;
-        /* 021E0B8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021E0B8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021E0B90 */ cpu->r[12] = 0x00000000u;
         /* 021E0B94 */ _t5 = cpu->r[4] + 0x00000002u;
         /* 021E0B94 */ rbrew_write16(cpu->mem, _t5, (uint16_t)cpu->r[11]);
@@ -8721,18 +8721,18 @@ void Gambit_fn_021E0BE8(CPUState* cpu) {
         /* 021E0C00 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
         /* 021E0C04 */ _t5 = cpu->r[30] + 0x0000002Cu;
         /* 021E0C04 */ cpu->r[10] = rbrew_read32(cpu->mem, _t5);
-        /* 021E0C08 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[10]);
-        /* 021E0C0C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0C08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[10]));
+        /* 021E0C0C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0C0C */ _t7 = _t6 & 0x00000001u;
         /* 021E0C0C */ if (_t7) goto L_021E0C58; else goto L_021E0C10;
   L_021E0C10: ; // 0x21e0c10
-        /* 021E0C10 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x0000000Bu);
-        /* 021E0C14 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0C10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x0000000Bu));
+        /* 021E0C14 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0C14 */ _t9 = _t8 & 0x00000001u;
         /* 021E0C14 */ if (_t9) goto L_021E0C20; else goto L_021E0C18;
   L_021E0C18: ; // 0x21e0c18
-        /* 021E0C18 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x0000000Du);
-        /* 021E0C1C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0C18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x0000000Du));
+        /* 021E0C1C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0C1C */ _t11 = _t10 & 0x00000001u;
         /* 021E0C1C */ if (_t11) goto L_021E0C20; else goto L_021E0C58;
   L_021E0C20: ; // 0x21e0c20
@@ -8784,18 +8784,18 @@ void Gambit_fn_021E0BEC(CPUState* cpu) {
         /* 021E0C00 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
         /* 021E0C04 */ _t5 = cpu->r[30] + 0x0000002Cu;
         /* 021E0C04 */ cpu->r[10] = rbrew_read32(cpu->mem, _t5);
-        /* 021E0C08 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[10]);
-        /* 021E0C0C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0C08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[10]));
+        /* 021E0C0C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0C0C */ _t7 = _t6 & 0x00000001u;
         /* 021E0C0C */ if (_t7) goto L_021E0C58; else goto L_021E0C10;
   L_021E0C10: ; // 0x21e0c10
-        /* 021E0C10 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x0000000Bu);
-        /* 021E0C14 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0C10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x0000000Bu));
+        /* 021E0C14 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0C14 */ _t9 = _t8 & 0x00000001u;
         /* 021E0C14 */ if (_t9) goto L_021E0C20; else goto L_021E0C18;
   L_021E0C18: ; // 0x21e0c18
-        /* 021E0C18 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x0000000Du);
-        /* 021E0C1C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0C18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x0000000Du));
+        /* 021E0C1C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0C1C */ _t11 = _t10 & 0x00000001u;
         /* 021E0C1C */ if (_t11) goto L_021E0C20; else goto L_021E0C58;
   L_021E0C20: ; // 0x21e0c20
@@ -8841,8 +8841,8 @@ void Gambit_fn_021E0C70(CPUState* cpu) {
   L_027B8224: ; // 0x27b8224
         /* 027B8224 */ _t1 = cpu->r[3] + 0x00000000u;
         /* 027B8224 */ cpu->r[3] = rbrew_read32(cpu->mem, _t1);
-        /* 027B8228 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 027B822C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 027B8228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 027B822C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 027B822C */ _t3 = _t2 & 0x00000001u;
         /* 027B822C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 027B822C */ goto L_027B8230;
@@ -8865,9 +8865,9 @@ void Gambit_fn_021E0C70(CPUState* cpu) {
         /* 027DA6B4 */ _t9 = cpu->r[29] + 0x00000014u;
         /* 027DA6B4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t9);
         /* 027DA6B8 */ cpu->r[31] = cpu->r[5];
-        /* 027DA6BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 027DA6BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 027DA6C0 */ cpu->r[30] = cpu->r[4];
-        /* 027DA6C4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 027DA6C4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 027DA6C4 */ _t11 = _t10 & 0x00000001u;
         /* 027DA6C4 */ if (_t11) goto L_027DA6D4; else goto L_027DA6C8;
   L_027DA6C8: ; // 0x27da6c8
@@ -8877,8 +8877,8 @@ void Gambit_fn_021E0C70(CPUState* cpu) {
   L_027DA6D4: ; // 0x27da6d4
         /* 027DA6D4 */ _t12 = cpu->r[29] + 0x00000018u;
         /* 027DA6D4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t12);
-        /* 027DA6D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 027DA6DC */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 027DA6D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 027DA6DC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 027DA6DC */ _t14 = _t13 & 0x00000001u;
         /* 027DA6DC */ if (_t14) goto L_027DA6EC; else goto L_027DA6E0;
   L_027DA6E0: ; // 0x27da6e0
@@ -9152,17 +9152,17 @@ void Gambit_fn_021E0C80(CPUState* cpu) {
         /* 021E0E94 */ cpu->r[10] = rbrew_read32(cpu->mem, _t100);
         /* 021E0E98 */ _t101 = cpu->r[11] + 0x0000228Cu;
         /* 021E0E98 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t101);
-        /* 021E0E9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u);
+        /* 021E0E9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u));
         /* 021E0EA0 */ _t102 = cpu->r[31] + 0x000000ACu;
         /* 021E0EA0 */ rbrew_write32(cpu->mem, _t102, cpu->r[10]);
-        /* 021E0EA4 */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0EA4 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0EA4 */ _t104 = _t103 & 0x00000001u;
         /* 021E0EA4 */ if (_t104) goto L_021E0EA8; else goto L_021E0EB8;
   L_021E0EA8: ; // 0x21e0ea8
         /* 021E0EA8 */ cpu->r[3] = 0x00000010u;
         /* 021E0EAC */ Gambit_fn_02801A78(cpu);
-        /* 021E0EB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E0EB4 */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0EB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E0EB4 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0EB4 */ _t106 = _t105 & 0x00000001u;
         /* 021E0EB4 */ if (_t106) goto L_021E0EC8; else goto L_021E0EB8;
   L_021E0EB8: ; // 0x21e0eb8
@@ -9175,16 +9175,16 @@ void Gambit_fn_021E0C80(CPUState* cpu) {
         /* 021E0EC4 */ _t110 = cpu->r[3] + 0x0000000Cu;
         /* 021E0EC4 */ rbrew_write_f32(cpu->mem, _t110, cpu->f[30]);
   L_021E0EC8: ; // 0x21e0ec8
-        /* 021E0EC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u);
+        /* 021E0EC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u));
         /* 021E0ECC */ cpu->r[3] = cpu->r[31] + 0x000000D0u;
-        /* 021E0ED0 */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0ED0 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0ED0 */ _t112 = _t111 & 0x00000001u;
         /* 021E0ED0 */ if (_t112) goto L_021E0ED4; else goto L_021E0EE4;
   L_021E0ED4: ; // 0x21e0ed4
         /* 021E0ED4 */ cpu->r[3] = 0x00000010u;
         /* 021E0ED8 */ Gambit_fn_02801A78(cpu);
-        /* 021E0EDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E0EE0 */ _t113 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0EDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E0EE0 */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0EE0 */ _t114 = _t113 & 0x00000001u;
         /* 021E0EE0 */ if (_t114) goto L_021E0EF4; else goto L_021E0EE4;
   L_021E0EE4: ; // 0x21e0ee4
@@ -9232,7 +9232,7 @@ void Gambit_fn_021E0C80(CPUState* cpu) {
         /* 021E0F38 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t133);
         /* 021E0F3C */ _t134 = cpu->r[1] + 0x00000058u;
         /* 021E0F3C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t134);
-        /* 021E0F40 */ _t135 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E0F40 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E0F40 */ _t136 = _t135 & 0x00000001u;
         /* 021E0F40 */ if (_t136) goto L_021E0F44; // else: addr-0 trap, fall-through
   L_021E0F44: ; // 0x21e0f44
@@ -9248,15 +9248,15 @@ void Gambit_fn_021E0F54(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021E0F54: ; // 0x21e0f54
-        /* 021E0F54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E0F58 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0F54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E0F58 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0F58 */ _t1 = _t0 & 0x00000001u;
         /* 021E0F58 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021E0F58 */ goto L_021E0F5C;
   L_021E0F5C: ; // 0x21e0f5c
         /* 021E0F5C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021E0F5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E0F60 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0F5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E0F60 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0F60 */ _t3 = _t2 & 0x00000001u;
         /* 021E0F60 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021E0F60 */ goto L_021E0F64;
@@ -9275,8 +9275,8 @@ void Gambit_fn_021E0F54(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -9290,15 +9290,15 @@ void Gambit_fn_021E0F54(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -9377,8 +9377,8 @@ void Gambit_fn_021E0F88(CPUState* cpu) {
         /* 021E0F88 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E0F88 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E0F8C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021E0F8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E0F90 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0F8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E0F90 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0F90 */ _t2 = _t1 & 0x00000001u;
         /* 021E0F90 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E0F90 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -9400,8 +9400,8 @@ void Gambit_fn_021E0FA4(CPUState* cpu) {
         /* 021E0FA4 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E0FA4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E0FA8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021E0FA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E0FAC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0FA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E0FAC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0FAC */ _t2 = _t1 & 0x00000001u;
         /* 021E0FAC */ _t3 = _t2 ^ 0x00000001u;
         /* 021E0FAC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -9423,8 +9423,8 @@ void Gambit_fn_021E0FC0(CPUState* cpu) {
         /* 021E0FC0 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E0FC0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E0FC4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021E0FC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E0FC8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E0FC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E0FC8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E0FC8 */ _t2 = _t1 & 0x00000001u;
         /* 021E0FC8 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E0FC8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -9467,8 +9467,8 @@ void Gambit_fn_021E0FEC(CPUState* cpu) {
         /* 021E0FFC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E1000 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021E1000 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021E1004 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021E1008 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E1004 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021E1008 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E1008 */ _t5 = _t4 & 0x00000001u;
         /* 021E1008 */ if (_t5) goto L_021E100C; else goto L_021E1028;
   L_021E100C: ; // 0x21e100c
@@ -9507,8 +9507,8 @@ void Gambit_fn_021E0FF0(CPUState* cpu) {
         /* 021E0FFC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E1000 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021E1000 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021E1004 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021E1008 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E1004 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021E1008 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E1008 */ _t5 = _t4 & 0x00000001u;
         /* 021E1008 */ if (_t5) goto L_021E100C; else goto L_021E1028;
   L_021E100C: ; // 0x21e100c
@@ -9943,8 +9943,8 @@ void Gambit_fn_021E11E8(CPUState* cpu) {
         /* 021E11E8 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 021E11E8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E11EC */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 021E11EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E11F0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E11EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E11F0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E11F0 */ _t2 = _t1 & 0x00000001u;
         /* 021E11F0 */ if (_t2) goto L_021E1200; else goto L_021E11F4;
   L_021E11F4: ; // 0x21e11f4
@@ -10002,10 +10002,10 @@ void Gambit_fn_021E1238(CPUState* cpu) {
         /* 021E1238 */ cpu->r[10] = 0x101D0000u;
         /* 021E123C */ _t0 = cpu->r[10] + 0xFFFFE5ECu;
         /* 021E123C */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 021E1240 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021E1240 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021E1244 */ cpu->r[10] = 0x101D0000u;
         /* 021E1248 */ cpu->r[10] = cpu->r[10] + 0xFFFFFC28u;
-        /* 021E124C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E124C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E124C */ _t2 = _t1 & 0x00000001u;
         /* 021E124C */ if (_t2) goto L_021E1250; else goto L_021E1268;
   L_021E1250: ; // 0x21e1250
@@ -10018,8 +10018,8 @@ void Gambit_fn_021E1238(CPUState* cpu) {
         /* 021E1264 */ _t4 = cpu->r[10] + 0x00000000u;
         /* 021E1264 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_021E1268: ; // 0x21e1268
-        /* 021E1268 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021E126C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E1268 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021E126C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E126C */ _t6 = _t5 & 0x00000001u;
         /* 021E126C */ if (_t6) goto L_021E1270; else goto L_021E1278;
   L_021E1270: ; // 0x21e1270
@@ -10030,9 +10030,9 @@ void Gambit_fn_021E1238(CPUState* cpu) {
         /* 021E127C */ _t7 = cpu->r[9] + 0xFFFFDA00u;
         /* 021E127C */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 021E1280 */ cpu->r[11] = 0x101D0000u;
-        /* 021E1284 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021E1284 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021E1288 */ cpu->r[11] = cpu->r[11] + 0xFFFFFBFCu;
-        /* 021E128C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E128C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E128C */ _t9 = _t8 & 0x00000001u;
         /* 021E128C */ if (_t9) goto L_021E1290; else goto L_021E12A8;
   L_021E1290: ; // 0x21e1290
@@ -10045,8 +10045,8 @@ void Gambit_fn_021E1238(CPUState* cpu) {
         /* 021E12A4 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021E12A4 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021E12A8: ; // 0x21e12a8
-        /* 021E12A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021E12AC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E12A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021E12AC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E12AC */ _t13 = _t12 & 0x00000001u;
         /* 021E12AC */ if (_t13) goto L_021E12B0; else goto L_021E12B8;
   L_021E12B0: ; // 0x21e12b0
@@ -10057,9 +10057,9 @@ void Gambit_fn_021E1238(CPUState* cpu) {
         /* 021E12BC */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021E12BC */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 021E12C0 */ cpu->r[9] = 0x101D0000u;
-        /* 021E12C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021E12C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021E12C8 */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 021E12CC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E12CC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E12CC */ _t16 = _t15 & 0x00000001u;
         /* 021E12CC */ if (_t16) goto L_021E12D0; else goto L_021E12E8;
   L_021E12D0: ; // 0x21e12d0
@@ -10072,8 +10072,8 @@ void Gambit_fn_021E1238(CPUState* cpu) {
         /* 021E12E4 */ _t18 = cpu->r[9] + 0x00000000u;
         /* 021E12E4 */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_021E12E8: ; // 0x21e12e8
-        /* 021E12E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 021E12EC */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E12E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 021E12EC */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E12EC */ _t20 = _t19 & 0x00000001u;
         /* 021E12EC */ if (_t20) goto L_021E12F0; else goto L_021E12F8;
   L_021E12F0: ; // 0x21e12f0
@@ -10085,9 +10085,9 @@ void Gambit_fn_021E1238(CPUState* cpu) {
         /* 021E12FC */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 021E12FC */ cpu->r[9] = _t21;
         /* 021E1300 */ cpu->r[10] = 0x101D0000u;
-        /* 021E1304 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021E1304 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021E1308 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021E130C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E130C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E130C */ _t23 = _t22 & 0x00000001u;
         /* 021E130C */ if (_t23) goto L_021E1310; else goto L_021E1324;
   L_021E1310: ; // 0x21e1310
@@ -10099,8 +10099,8 @@ void Gambit_fn_021E1238(CPUState* cpu) {
         /* 021E1320 */ _t25 = cpu->r[10] + 0x00000000u;
         /* 021E1320 */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_021E1324: ; // 0x21e1324
-        /* 021E1324 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021E1328 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E1324 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021E1328 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E1328 */ _t27 = _t26 & 0x00000001u;
         /* 021E1328 */ if (_t27) goto L_021E132C; else goto L_021E1334;
   L_021E132C: ; // 0x21e132c
@@ -10112,9 +10112,9 @@ void Gambit_fn_021E1238(CPUState* cpu) {
         /* 021E1338 */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 021E1338 */ cpu->r[10] = _t28;
         /* 021E133C */ cpu->r[11] = 0x101D0000u;
-        /* 021E1340 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021E1340 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021E1344 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021E1348 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E1348 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E1348 */ _t30 = _t29 & 0x00000001u;
         /* 021E1348 */ if (_t30) goto L_021E134C; else goto L_021E1360;
   L_021E134C: ; // 0x21e134c
@@ -10528,10 +10528,10 @@ void Gambit_fn_021E154C(CPUState* cpu) {
         /* 021E1554 */ _t1 = cpu->r[3] + 0x00000020u;
         /* 021E1554 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 021E1558 */ cpu->r[8] = cpu->r[0];
-        /* 021E155C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021E155C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021E1560 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 021E1560 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021E1564 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E1564 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E1564 */ _t4 = _t3 & 0x00000001u;
         /* 021E1564 */ if (_t4) goto L_021E1568; else goto L_021E1580;
   L_021E1568: ; // 0x21e1568
@@ -10539,8 +10539,8 @@ void Gambit_fn_021E154C(CPUState* cpu) {
         /* 021E156C */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 021E1570 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021E1570 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021E1574 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021E1578 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E1574 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021E1578 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E1578 */ _t7 = _t6 & 0x00000001u;
         /* 021E1578 */ if (_t7) goto L_021E157C; else goto L_021E158C;
   L_021E157C: ; // 0x21e157c
@@ -10548,16 +10548,16 @@ void Gambit_fn_021E154C(CPUState* cpu) {
   L_021E1580: ; // 0x21e1580
         /* 021E1580 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021E1580 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021E1584 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021E1588 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E1584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021E1588 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E1588 */ _t10 = _t9 & 0x00000001u;
         /* 021E1588 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021E1588 */ goto L_021E158C;
   L_021E158C: ; // 0x21e158c
-        /* 021E158C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 021E158C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 021E1590 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021E1590 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 021E1594 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E1594 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E1594 */ _t13 = _t12 & 0x00000001u;
         /* 021E1594 */ if (_t13) goto L_021E1598; else goto L_021E15A0;
   L_021E1598: ; // 0x21e1598
@@ -10568,11 +10568,11 @@ void Gambit_fn_021E154C(CPUState* cpu) {
         /* 021E15A0 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021E15A4 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021E15A4 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021E15A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021E15A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021E15AC */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021E15AC */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021E15B0 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 021E15B4 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E15B4 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E15B4 */ _t18 = _t17 & 0x00000001u;
         /* 021E15B4 */ if (_t18) goto L_021E15CC; else goto L_021E15B8;
   L_021E15B8: ; // 0x21e15b8
@@ -10599,10 +10599,10 @@ void Gambit_fn_021E15D4(CPUState* cpu) {
         /* 021E15DC */ _t1 = cpu->r[3] + 0x00000028u;
         /* 021E15DC */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 021E15E0 */ cpu->r[8] = cpu->r[0];
-        /* 021E15E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021E15E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021E15E8 */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 021E15E8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021E15EC */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E15EC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E15EC */ _t4 = _t3 & 0x00000001u;
         /* 021E15EC */ if (_t4) goto L_021E15F0; else goto L_021E1608;
   L_021E15F0: ; // 0x21e15f0
@@ -10610,8 +10610,8 @@ void Gambit_fn_021E15D4(CPUState* cpu) {
         /* 021E15F4 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 021E15F8 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021E15F8 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021E15FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021E1600 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E15FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021E1600 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E1600 */ _t7 = _t6 & 0x00000001u;
         /* 021E1600 */ if (_t7) goto L_021E1604; else goto L_021E1614;
   L_021E1604: ; // 0x21e1604
@@ -10619,16 +10619,16 @@ void Gambit_fn_021E15D4(CPUState* cpu) {
   L_021E1608: ; // 0x21e1608
         /* 021E1608 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021E1608 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021E160C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021E1610 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E160C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021E1610 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E1610 */ _t10 = _t9 & 0x00000001u;
         /* 021E1610 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021E1610 */ goto L_021E1614;
   L_021E1614: ; // 0x21e1614
-        /* 021E1614 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 021E1614 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 021E1618 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021E1618 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 021E161C */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E161C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E161C */ _t13 = _t12 & 0x00000001u;
         /* 021E161C */ if (_t13) goto L_021E1620; else goto L_021E1628;
   L_021E1620: ; // 0x21e1620
@@ -10639,11 +10639,11 @@ void Gambit_fn_021E15D4(CPUState* cpu) {
         /* 021E1628 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021E162C */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021E162C */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021E1630 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021E1630 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021E1634 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021E1634 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021E1638 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 021E163C */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E163C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E163C */ _t18 = _t17 & 0x00000001u;
         /* 021E163C */ if (_t18) goto L_021E1654; else goto L_021E1640;
   L_021E1640: ; // 0x21e1640
@@ -10676,18 +10676,18 @@ void Gambit_fn_021E165C(CPUState* cpu) {
         /* 021E1670 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 021E1670 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 021E1674 */ cpu->r[12] = 0x00000000u;
-        /* 021E1678 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021E1678 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021E167C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 021E167C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 021E1680 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E1680 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E1680 */ _t6 = _t5 & 0x00000001u;
         /* 021E1680 */ if (_t6) goto L_021E16A8; else goto L_021E1684;
   L_021E1684: ; // 0x21e1684
         /* 021E1684 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 021E1684 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 021E1688 */ /* nop */
-        /* 021E168C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 021E1690 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E168C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 021E1690 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E1690 */ _t9 = _t8 & 0x00000001u;
         /* 021E1690 */ if (_t9) goto L_021E1694; else goto L_021E16A8;
   L_021E1694: ; // 0x21e1694
@@ -10728,18 +10728,18 @@ void Gambit_fn_021E1660(CPUState* cpu) {
         /* 021E1670 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 021E1670 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 021E1674 */ cpu->r[12] = 0x00000000u;
-        /* 021E1678 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021E1678 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021E167C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 021E167C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 021E1680 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E1680 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E1680 */ _t6 = _t5 & 0x00000001u;
         /* 021E1680 */ if (_t6) goto L_021E16A8; else goto L_021E1684;
   L_021E1684: ; // 0x21e1684
         /* 021E1684 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 021E1684 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 021E1688 */ /* nop */
-        /* 021E168C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 021E1690 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E168C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 021E1690 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E1690 */ _t9 = _t8 & 0x00000001u;
         /* 021E1690 */ if (_t9) goto L_021E1694; else goto L_021E16A8;
   L_021E1694: ; // 0x21e1694
@@ -10775,10 +10775,10 @@ void Gambit_fn_021E16CC(CPUState* cpu) {
         /* 021E16D4 */ _t1 = cpu->r[3] + 0x00000030u;
         /* 021E16D4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 021E16D8 */ cpu->r[7] = cpu->r[0];
-        /* 021E16DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 021E16DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 021E16E0 */ _t2 = cpu->r[3] + 0x00000034u;
         /* 021E16E0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021E16E4 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E16E4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E16E4 */ _t4 = _t3 & 0x00000001u;
         /* 021E16E4 */ if (_t4) goto L_021E16E8; else goto L_021E1700;
   L_021E16E8: ; // 0x21e16e8
@@ -10786,8 +10786,8 @@ void Gambit_fn_021E16CC(CPUState* cpu) {
         /* 021E16EC */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 021E16F0 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021E16F0 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021E16F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021E16F8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E16F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021E16F8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E16F8 */ _t7 = _t6 & 0x00000001u;
         /* 021E16F8 */ if (_t7) goto L_021E16FC; else goto L_021E170C;
   L_021E16FC: ; // 0x21e16fc
@@ -10795,16 +10795,16 @@ void Gambit_fn_021E16CC(CPUState* cpu) {
   L_021E1700: ; // 0x21e1700
         /* 021E1700 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021E1700 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021E1704 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021E1708 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E1704 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021E1708 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E1708 */ _t10 = _t9 & 0x00000001u;
         /* 021E1708 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021E1708 */ goto L_021E170C;
   L_021E170C: ; // 0x21e170c
-        /* 021E170C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 021E170C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 021E1710 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021E1710 */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 021E1714 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E1714 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E1714 */ _t13 = _t12 & 0x00000001u;
         /* 021E1714 */ if (_t13) goto L_021E1718; else goto L_021E1720;
   L_021E1718: ; // 0x21e1718
@@ -10815,11 +10815,11 @@ void Gambit_fn_021E16CC(CPUState* cpu) {
         /* 021E1720 */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021E1724 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021E1724 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021E1728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021E1728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021E172C */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021E172C */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021E1730 */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 021E1734 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E1734 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E1734 */ _t18 = _t17 & 0x00000001u;
         /* 021E1734 */ if (_t18) goto L_021E174C; else goto L_021E1738;
   L_021E1738: ; // 0x21e1738
@@ -10854,9 +10854,9 @@ void Gambit_fn_021E1754(CPUState* cpu) {
         /* 021E176C */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 021E176C */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 021E1770 */ /* nop */
-        /* 021E1774 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 021E1774 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 021E1778 */ cpu->r[31] = cpu->r[4];
-        /* 021E177C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E177C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E177C */ _t6 = _t5 & 0x00000001u;
         /* 021E177C */ if (_t6) goto L_021E1780; else goto L_021E1794;
   L_021E1780: ; // 0x21e1780
@@ -10905,9 +10905,9 @@ void Gambit_fn_021E1758(CPUState* cpu) {
         /* 021E176C */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 021E176C */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 021E1770 */ /* nop */
-        /* 021E1774 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 021E1774 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 021E1778 */ cpu->r[31] = cpu->r[4];
-        /* 021E177C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E177C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E177C */ _t6 = _t5 & 0x00000001u;
         /* 021E177C */ if (_t6) goto L_021E1780; else goto L_021E1794;
   L_021E1780: ; // 0x21e1780
@@ -10949,18 +10949,18 @@ void Gambit_fn_021E17D0(CPUState* cpu) {
         /* 021E17D4 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021E17D4 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021E17D8 */ cpu->r[31] = cpu->r[3];
-        /* 021E17D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021E17D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021E17DC */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021E17DC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021E17E0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E17E0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E17E0 */ _t4 = _t3 & 0x00000001u;
         /* 021E17E0 */ if (_t4) goto L_021E17E4; else goto L_021E17F4;
   L_021E17E4: ; // 0x21e17e4
         /* 021E17E4 */ cpu->r[3] = 0x00000184u;
         /* 021E17E8 */ Gambit_fn_02801A78(cpu);
         /* 021E17EC */ cpu->r[31] = cpu->r[3];
-        /* 021E17EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E17F0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E17EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E17F0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E17F0 */ _t6 = _t5 & 0x00000001u;
         /* 021E17F0 */ if (_t6) goto L_021E1910; else goto L_021E17F4;
   L_021E17F4: ; // 0x21e17f4
@@ -11001,8 +11001,8 @@ void Gambit_fn_021E17D0(CPUState* cpu) {
         /* 021E1878 */ cpu->r[3] = cpu->r[31] + 0x00000134u;
         /* 021E187C */ Gambit_fn_023C6290(cpu);
         /* 021E1880 */ cpu->r[0] = cpu->r[31] + 0x00000144u;
-        /* 021E1880 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E1884 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E1880 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E1884 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E1884 */ _t9 = _t8 & 0x00000001u;
         /* 021E1884 */ if (_t9) goto L_021E1888; else goto L_021E1890;
   L_021E1888: ; // 0x21e1888
@@ -11010,8 +11010,8 @@ void Gambit_fn_021E17D0(CPUState* cpu) {
         /* 021E188C */ Gambit_fn_02801A78(cpu);
   L_021E1890: ; // 0x21e1890
         /* 021E1890 */ cpu->r[0] = cpu->r[31] + 0x00000174u;
-        /* 021E1890 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E1894 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E1890 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E1894 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E1894 */ _t11 = _t10 & 0x00000001u;
         /* 021E1894 */ if (_t11) goto L_021E1898; else goto L_021E18A0;
   L_021E1898: ; // 0x21e1898
@@ -11076,8 +11076,8 @@ void Gambit_fn_021E1928(CPUState* cpu) {
         /* 021E1928 */ cpu->r[12] = 0x101C0000u;
         /* 021E192C */ _t0 = cpu->r[12] + 0x000050ACu;
         /* 021E192C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 021E1930 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E1934 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E1930 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E1934 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E1934 */ _t2 = _t1 & 0x00000001u;
         /* 021E1934 */ if (_t2) goto L_021E1938; else goto L_021E1940;
   L_021E1938: ; // 0x21e1938
@@ -11105,15 +11105,15 @@ void Gambit_fn_021E19B0(CPUState* cpu) {
         /* 021E19BC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E19C0 */ Gambit_fn_021E1928(cpu);
         /* 021E19C4 */ cpu->r[31] = cpu->r[3];
-        /* 021E19C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E19C8 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E19C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E19C8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E19C8 */ _t4 = _t3 & 0x00000001u;
         /* 021E19C8 */ if (_t4) goto L_021E19E8; else goto L_021E19CC;
   L_021E19CC: ; // 0x21e19cc
         /* 021E19CC */ _t5 = cpu->r[4] + 0x00000000u;
         /* 021E19CC */ cpu->r[3] = rbrew_read32(cpu->mem, _t5);
-        /* 021E19D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E19D4 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E19D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E19D4 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E19D4 */ _t7 = _t6 & 0x00000001u;
         /* 021E19D4 */ if (_t7) goto L_021E19E8; else goto L_021E19D8;
   L_021E19D8: ; // 0x21e19d8
@@ -11149,8 +11149,8 @@ void Gambit_fn_021E1A04(CPUState* cpu) {
         /* 021E1A10 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E1A14 */ _t3 = cpu->r[31] + 0x00000000u;
         /* 021E1A14 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
-        /* 021E1A18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E1A1C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E1A18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E1A1C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E1A1C */ _t5 = _t4 & 0x00000001u;
         /* 021E1A1C */ if (_t5) goto L_021E1A3C; else goto L_021E1A20;
   L_021E1A20: ; // 0x21e1a20
@@ -11193,8 +11193,8 @@ void Gambit_fn_021E1A8C(CPUState* cpu) {
         /* 021E1AA0 */ cpu->r[29] = cpu->r[3];
         /* 021E1AA4 */ _t5 = cpu->r[29] + 0x00000000u;
         /* 021E1AA4 */ cpu->r[30] = rbrew_read32(cpu->mem, _t5);
-        /* 021E1AA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021E1AAC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E1AA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021E1AAC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E1AAC */ _t7 = _t6 & 0x00000001u;
         /* 021E1AAC */ if (_t7) goto L_021E1B18; else goto L_021E1AB0;
   L_021E1AB0: ; // 0x21e1ab0
@@ -11203,8 +11203,8 @@ void Gambit_fn_021E1A8C(CPUState* cpu) {
         /* 021E1AB8 */ Gambit_fn_02019890(cpu);
         /* 021E1ABC */ _t8 = cpu->r[1] + 0x00000008u;
         /* 021E1ABC */ cpu->r[11] = rbrew_read32(cpu->mem, _t8);
-        /* 021E1AC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000006u);
-        /* 021E1AC4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E1AC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000006u));
+        /* 021E1AC4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E1AC4 */ _t10 = _t9 & 0x00000001u;
         /* 021E1AC4 */ if (_t10) goto L_021E1AC8; else goto L_021E1AF0;
   L_021E1AC8: ; // 0x21e1ac8
@@ -11215,9 +11215,9 @@ void Gambit_fn_021E1A8C(CPUState* cpu) {
         /* 021E1AD0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
         /* 021E1AD4 */ _t13 = cpu->r[12] + 0x00000268u;
         /* 021E1AD4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t13);
-        /* 021E1AD8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000008u);
+        /* 021E1AD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000008u));
         /* 021E1ADC */ cpu->r[11] = cpu->r[12] + 0x000002B8u;
-        /* 021E1AE0 */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E1AE0 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E1AE0 */ _t15 = _t14 & 0x00000001u;
         /* 021E1AE0 */ if (_t15) goto L_021E1AE4; else goto L_021E1AEC;
   L_021E1AE4: ; // 0x21e1ae4
@@ -12682,8 +12682,8 @@ void Gambit_fn_021E20D0(CPUState* cpu) {
         /* 021E20E4 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 021E20E8 */ _t4 = cpu->r[31] + 0x00000058u;
         /* 021E20E8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t4);
-        /* 021E20EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021E20F0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E20EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021E20F0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E20F0 */ _t6 = _t5 & 0x00000001u;
         /* 021E20F0 */ if (_t6) goto L_021E20F4; else goto L_021E2170;
   L_021E20F4: ; // 0x21e20f4
@@ -12692,8 +12692,8 @@ void Gambit_fn_021E20D0(CPUState* cpu) {
         /* 021E20FC */ Gambit_fn_02019890(cpu);
         /* 021E2100 */ _t7 = cpu->r[1] + 0x00000008u;
         /* 021E2100 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
-        /* 021E2104 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000006u);
-        /* 021E2108 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2104 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000006u));
+        /* 021E2108 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2108 */ _t9 = _t8 & 0x00000001u;
         /* 021E2108 */ if (_t9) goto L_021E210C; else goto L_021E2134;
   L_021E210C: ; // 0x21e210c
@@ -12704,9 +12704,9 @@ void Gambit_fn_021E20D0(CPUState* cpu) {
         /* 021E2114 */ cpu->r[0] = rbrew_read32(cpu->mem, _t11);
         /* 021E2118 */ _t12 = cpu->r[12] + 0x00000268u;
         /* 021E2118 */ cpu->r[10] = rbrew_read32(cpu->mem, _t12);
-        /* 021E211C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000008u);
+        /* 021E211C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000008u));
         /* 021E2120 */ cpu->r[11] = cpu->r[10] + 0x000002B8u;
-        /* 021E2124 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E2124 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E2124 */ _t14 = _t13 & 0x00000001u;
         /* 021E2124 */ if (_t14) goto L_021E2128; else goto L_021E2130;
   L_021E2128: ; // 0x21e2128
@@ -12766,8 +12766,8 @@ void Gambit_fn_021E20D4(CPUState* cpu) {
         /* 021E20E4 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 021E20E8 */ _t4 = cpu->r[31] + 0x00000058u;
         /* 021E20E8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t4);
-        /* 021E20EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021E20F0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E20EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021E20F0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E20F0 */ _t6 = _t5 & 0x00000001u;
         /* 021E20F0 */ if (_t6) goto L_021E20F4; else goto L_021E2170;
   L_021E20F4: ; // 0x21e20f4
@@ -12776,8 +12776,8 @@ void Gambit_fn_021E20D4(CPUState* cpu) {
         /* 021E20FC */ Gambit_fn_02019890(cpu);
         /* 021E2100 */ _t7 = cpu->r[1] + 0x00000008u;
         /* 021E2100 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
-        /* 021E2104 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000006u);
-        /* 021E2108 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2104 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000006u));
+        /* 021E2108 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2108 */ _t9 = _t8 & 0x00000001u;
         /* 021E2108 */ if (_t9) goto L_021E210C; else goto L_021E2134;
   L_021E210C: ; // 0x21e210c
@@ -12788,9 +12788,9 @@ void Gambit_fn_021E20D4(CPUState* cpu) {
         /* 021E2114 */ cpu->r[0] = rbrew_read32(cpu->mem, _t11);
         /* 021E2118 */ _t12 = cpu->r[12] + 0x00000268u;
         /* 021E2118 */ cpu->r[10] = rbrew_read32(cpu->mem, _t12);
-        /* 021E211C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000008u);
+        /* 021E211C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000008u));
         /* 021E2120 */ cpu->r[11] = cpu->r[10] + 0x000002B8u;
-        /* 021E2124 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E2124 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E2124 */ _t14 = _t13 & 0x00000001u;
         /* 021E2124 */ if (_t14) goto L_021E2128; else goto L_021E2130;
   L_021E2128: ; // 0x21e2128
@@ -12854,21 +12854,21 @@ void Gambit_fn_021E2188(CPUState* cpu) {
         /* 021E21B0 */ Gambit_fn_02019890(cpu);
         /* 021E21B4 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 021E21B4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t2);
-        /* 021E21B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000006u);
+        /* 021E21B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000006u));
         /* 021E21BC */ cpu->r[28] = 0x101C0000u;
-        /* 021E21C0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E21C0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E21C0 */ _t4 = _t3 & 0x00000001u;
         /* 021E21C0 */ if (_t4) goto L_021E21F4; else goto L_021E21C4;
   L_021E21C4: ; // 0x21e21c4
         /* 021E21C4 */ _t5 = cpu->r[28] + 0x000050B4u;
         /* 021E21C4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t5);
-        /* 021E21C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[29]);
-        /* 021E21CC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E21C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[29]));
+        /* 021E21CC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E21CC */ _t7 = _t6 & 0x00000001u;
         /* 021E21CC */ if (_t7) goto L_021E221C; else goto L_021E21D0;
   L_021E21D0: ; // 0x21e21d0
-        /* 021E21D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021E21D4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E21D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021E21D4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E21D4 */ _t9 = _t8 & 0x00000001u;
         /* 021E21D4 */ if (_t9) goto L_021E221C; else goto L_021E21D8;
   L_021E21D8: ; // 0x21e21d8
@@ -12888,9 +12888,9 @@ void Gambit_fn_021E2188(CPUState* cpu) {
         /* 021E21FC */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
         /* 021E2200 */ _t13 = cpu->r[12] + 0x00000268u;
         /* 021E2200 */ cpu->r[10] = rbrew_read32(cpu->mem, _t13);
-        /* 021E2204 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000008u);
+        /* 021E2204 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000008u));
         /* 021E2208 */ cpu->r[11] = cpu->r[10] + 0x000002B8u;
-        /* 021E220C */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E220C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E220C */ _t15 = _t14 & 0x00000001u;
         /* 021E220C */ if (_t15) goto L_021E2210; else goto L_021E2218;
   L_021E2210: ; // 0x21e2210
@@ -12903,19 +12903,19 @@ void Gambit_fn_021E2188(CPUState* cpu) {
         /* 021E221C */ cpu->r[7] = 0x101C0000u;
         /* 021E2220 */ cpu->r[0] = rbrew_rlwinm(cpu->r[27], 0x00000002u, 0x00000000u, 0x0000001Du);
         /* 021E2224 */ cpu->r[7] = cpu->r[7] + 0x0000509Cu;
-        /* 021E2228 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x0000007Au);
+        /* 021E2228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x0000007Au));
         /* 021E222C */ cpu->r[7] = cpu->r[7] + cpu->r[0];
-        /* 021E2230 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E2230 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E2230 */ _t18 = _t17 & 0x00000001u;
         /* 021E2230 */ if (_t18) goto L_021E2234; else goto L_021E2238;
   L_021E2234: ; // 0x21e2234
         /* 021E2234 */ cpu->r[31] = 0x0000007Au;
   L_021E2238: ; // 0x21e2238
         /* 021E2238 */ cpu->r[0] = cpu->r[31];
-        /* 021E2238 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021E2238 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021E223C */ _t19 = cpu->r[7] + 0x00000000u;
         /* 021E223C */ rbrew_write32(cpu->mem, _t19, cpu->r[31]);
-        /* 021E2240 */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E2240 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E2240 */ _t21 = _t20 & 0x00000001u;
         /* 021E2240 */ if (_t21) goto L_021E2244; else goto L_021E2274;
   L_021E2244: ; // 0x21e2244
@@ -13104,9 +13104,9 @@ void Gambit_fn_021E2364(CPUState* cpu) {
         /* 021E2374 */ _t3 = cpu->r[31] + 0x00000180u;
         /* 021E2374 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 021E2378 */ cpu->r[4] = 0x10030000u;
-        /* 021E237C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021E237C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021E2380 */ cpu->r[4] = cpu->r[4] + 0x00002788u;
-        /* 021E2384 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2384 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2384 */ _t5 = _t4 & 0x00000001u;
         /* 021E2384 */ if (_t5) goto L_021E2390; else goto L_021E2388;
   L_021E2388: ; // 0x21e2388
@@ -13139,9 +13139,9 @@ void Gambit_fn_021E2364(CPUState* cpu) {
         /* 021E23EC */ Gambit_fn_02019890(cpu);
         /* 021E23F0 */ _t6 = cpu->r[1] + 0x0000000Cu;
         /* 021E23F0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t6);
-        /* 021E23F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000001u);
+        /* 021E23F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000001u));
         /* 021E23F8 */ cpu->r[5] = 0x00000028u;
-        /* 021E23FC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E23FC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E23FC */ _t8 = _t7 & 0x00000001u;
         /* 021E23FC */ if (_t8) goto L_021E2400; else goto L_021E2404;
   L_021E2400: ; // 0x21e2400
@@ -13343,9 +13343,9 @@ void Gambit_fn_021E2648(CPUState* cpu) {
         /* 021E2374 */ _t3 = cpu->r[31] + 0x00000180u;
         /* 021E2374 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 021E2378 */ cpu->r[4] = 0x10030000u;
-        /* 021E237C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021E237C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021E2380 */ cpu->r[4] = cpu->r[4] + 0x00002788u;
-        /* 021E2384 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2384 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2384 */ _t5 = _t4 & 0x00000001u;
         /* 021E2384 */ if (_t5) goto L_021E2390; else goto L_021E2388;
   L_021E2388: ; // 0x21e2388
@@ -13378,9 +13378,9 @@ void Gambit_fn_021E2648(CPUState* cpu) {
         /* 021E23EC */ Gambit_fn_02019890(cpu);
         /* 021E23F0 */ _t6 = cpu->r[1] + 0x0000000Cu;
         /* 021E23F0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t6);
-        /* 021E23F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000001u);
+        /* 021E23F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000001u));
         /* 021E23F8 */ cpu->r[5] = 0x00000028u;
-        /* 021E23FC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E23FC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E23FC */ _t8 = _t7 & 0x00000001u;
         /* 021E23FC */ if (_t8) goto L_021E2400; else goto L_021E2404;
   L_021E2400: ; // 0x21e2400
@@ -13651,8 +13651,8 @@ void Gambit_fn_021E269C(CPUState* cpu) {
         /* 021E269C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E269C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E26A0 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021E26A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E26A4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E26A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E26A4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E26A4 */ _t2 = _t1 & 0x00000001u;
         /* 021E26A4 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E26A4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -13674,8 +13674,8 @@ void Gambit_fn_021E26B8(CPUState* cpu) {
         /* 021E26B8 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E26B8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E26BC */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021E26BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E26C0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E26BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E26C0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E26C0 */ _t2 = _t1 & 0x00000001u;
         /* 021E26C0 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E26C0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -13697,8 +13697,8 @@ void Gambit_fn_021E26D4(CPUState* cpu) {
         /* 021E26D4 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E26D4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E26D8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021E26D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E26DC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E26D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E26DC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E26DC */ _t2 = _t1 & 0x00000001u;
         /* 021E26DC */ _t3 = _t2 ^ 0x00000001u;
         /* 021E26DC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -13741,8 +13741,8 @@ void Gambit_fn_021E2700(CPUState* cpu) {
         /* 021E2710 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E2714 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021E2714 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021E2718 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021E271C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2718 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021E271C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E271C */ _t5 = _t4 & 0x00000001u;
         /* 021E271C */ if (_t5) goto L_021E2720; else goto L_021E273C;
   L_021E2720: ; // 0x21e2720
@@ -13781,8 +13781,8 @@ void Gambit_fn_021E2704(CPUState* cpu) {
         /* 021E2710 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E2714 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021E2714 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021E2718 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021E271C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2718 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021E271C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E271C */ _t5 = _t4 & 0x00000001u;
         /* 021E271C */ if (_t5) goto L_021E2720; else goto L_021E273C;
   L_021E2720: ; // 0x21e2720
@@ -13924,10 +13924,10 @@ void Gambit_fn_021E27C0(CPUState* cpu) {
         /* 021E27C0 */ cpu->r[12] = 0x101D0000u;
         /* 021E27C4 */ _t0 = cpu->r[12] + 0xFFFFE1B4u;
         /* 021E27C4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 021E27C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021E27C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021E27CC */ cpu->r[12] = 0x101D0000u;
         /* 021E27D0 */ cpu->r[12] = cpu->r[12] + 0xFFFFFC34u;
-        /* 021E27D4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E27D4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E27D4 */ _t2 = _t1 & 0x00000001u;
         /* 021E27D4 */ if (_t2) goto L_021E27D8; else goto L_021E27F0;
   L_021E27D8: ; // 0x21e27d8
@@ -13940,8 +13940,8 @@ void Gambit_fn_021E27C0(CPUState* cpu) {
         /* 021E27EC */ _t4 = cpu->r[12] + 0x00000000u;
         /* 021E27EC */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_021E27F0: ; // 0x21e27f0
-        /* 021E27F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021E27F4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E27F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021E27F4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E27F4 */ _t6 = _t5 & 0x00000001u;
         /* 021E27F4 */ if (_t6) goto L_021E27F8; else goto L_021E2800;
   L_021E27F8: ; // 0x21e27f8
@@ -13953,9 +13953,9 @@ void Gambit_fn_021E27C0(CPUState* cpu) {
         /* 021E2804 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 021E2804 */ cpu->r[11] = _t7;
         /* 021E2808 */ cpu->r[10] = 0x101D0000u;
-        /* 021E280C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021E280C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021E2810 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021E2814 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2814 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2814 */ _t9 = _t8 & 0x00000001u;
         /* 021E2814 */ if (_t9) goto L_021E2818; else goto L_021E282C;
   L_021E2818: ; // 0x21e2818
@@ -13967,8 +13967,8 @@ void Gambit_fn_021E27C0(CPUState* cpu) {
         /* 021E2828 */ _t11 = cpu->r[10] + 0x00000000u;
         /* 021E2828 */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
   L_021E282C: ; // 0x21e282c
-        /* 021E282C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021E2830 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E282C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021E2830 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2830 */ _t13 = _t12 & 0x00000001u;
         /* 021E2830 */ if (_t13) goto L_021E2834; else goto L_021E283C;
   L_021E2834: ; // 0x21e2834
@@ -13980,9 +13980,9 @@ void Gambit_fn_021E27C0(CPUState* cpu) {
         /* 021E2840 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 021E2840 */ cpu->r[8] = _t14;
         /* 021E2844 */ cpu->r[11] = 0x101D0000u;
-        /* 021E2848 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021E2848 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021E284C */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021E2850 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2850 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2850 */ _t16 = _t15 & 0x00000001u;
         /* 021E2850 */ if (_t16) goto L_021E2854; else goto L_021E2868;
   L_021E2854: ; // 0x21e2854
@@ -14027,18 +14027,18 @@ void Gambit_fn_021E2890(CPUState* cpu) {
         /* 021E2894 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021E2894 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021E2898 */ cpu->r[31] = cpu->r[3];
-        /* 021E2898 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021E2898 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021E289C */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021E289C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021E28A0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E28A0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E28A0 */ _t4 = _t3 & 0x00000001u;
         /* 021E28A0 */ if (_t4) goto L_021E28A4; else goto L_021E28B4;
   L_021E28A4: ; // 0x21e28a4
         /* 021E28A4 */ cpu->r[3] = 0x00000240u;
         /* 021E28A8 */ Gambit_fn_02801A78(cpu);
         /* 021E28AC */ cpu->r[31] = cpu->r[3];
-        /* 021E28AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E28B0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E28AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E28B0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E28B0 */ _t6 = _t5 & 0x00000001u;
         /* 021E28B0 */ if (_t6) goto L_021E28C8; else goto L_021E28B4;
   L_021E28B4: ; // 0x21e28b4
@@ -14118,8 +14118,8 @@ void Gambit_fn_021E2908(CPUState* cpu) {
         /* 021E2908 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E2908 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E290C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021E290C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E2910 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E290C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E2910 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2910 */ _t2 = _t1 & 0x00000001u;
         /* 021E2910 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E2910 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -14141,8 +14141,8 @@ void Gambit_fn_021E2924(CPUState* cpu) {
         /* 021E2924 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E2924 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E2928 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021E2928 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E292C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2928 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E292C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E292C */ _t2 = _t1 & 0x00000001u;
         /* 021E292C */ _t3 = _t2 ^ 0x00000001u;
         /* 021E292C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -14164,8 +14164,8 @@ void Gambit_fn_021E2940(CPUState* cpu) {
         /* 021E2940 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E2940 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E2944 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021E2944 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E2948 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2944 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E2948 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2948 */ _t2 = _t1 & 0x00000001u;
         /* 021E2948 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E2948 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -14208,8 +14208,8 @@ void Gambit_fn_021E296C(CPUState* cpu) {
         /* 021E297C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E2980 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021E2980 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021E2984 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021E2988 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2984 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021E2988 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2988 */ _t5 = _t4 & 0x00000001u;
         /* 021E2988 */ if (_t5) goto L_021E298C; else goto L_021E29A8;
   L_021E298C: ; // 0x21e298c
@@ -14248,8 +14248,8 @@ void Gambit_fn_021E2970(CPUState* cpu) {
         /* 021E297C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E2980 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021E2980 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021E2984 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021E2988 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2984 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021E2988 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2988 */ _t5 = _t4 & 0x00000001u;
         /* 021E2988 */ if (_t5) goto L_021E298C; else goto L_021E29A8;
   L_021E298C: ; // 0x21e298c
@@ -14649,13 +14649,13 @@ void Gambit_fn_021E2B30(CPUState* cpu) {
         /* 021E2B40 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E2B44 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021E2B44 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021E2B48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021E2B4C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2B48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021E2B4C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2B4C */ _t5 = _t4 & 0x00000001u;
         /* 021E2B4C */ if (_t5) goto L_021E2B58; else goto L_021E2B50;
   L_021E2B50: ; // 0x21e2b50
-        /* 021E2B50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021E2B54 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2B50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021E2B54 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2B54 */ _t7 = _t6 & 0x00000001u;
         /* 021E2B54 */ if (_t7) goto L_021E2B58; else goto L_021E2B90;
   L_021E2B58: ; // 0x21e2b58
@@ -14666,8 +14666,8 @@ void Gambit_fn_021E2B30(CPUState* cpu) {
         /* 021E2B60 */ cpu->ctr = cpu->r[0];
         /* 021E2B64 */ cpu->r[3] = cpu->r[31];
         /* 021E2B68 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021E2B6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E2B70 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2B6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E2B70 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2B70 */ _t11 = _t10 & 0x00000001u;
         /* 021E2B70 */ if (_t11) goto L_021E2B74; else goto L_021E2B90;
   L_021E2B74: ; // 0x21e2b74
@@ -14705,13 +14705,13 @@ void Gambit_fn_021E2B34(CPUState* cpu) {
         /* 021E2B40 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E2B44 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021E2B44 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021E2B48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021E2B4C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2B48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021E2B4C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2B4C */ _t5 = _t4 & 0x00000001u;
         /* 021E2B4C */ if (_t5) goto L_021E2B58; else goto L_021E2B50;
   L_021E2B50: ; // 0x21e2b50
-        /* 021E2B50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021E2B54 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2B50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021E2B54 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2B54 */ _t7 = _t6 & 0x00000001u;
         /* 021E2B54 */ if (_t7) goto L_021E2B58; else goto L_021E2B90;
   L_021E2B58: ; // 0x21e2b58
@@ -14722,8 +14722,8 @@ void Gambit_fn_021E2B34(CPUState* cpu) {
         /* 021E2B60 */ cpu->ctr = cpu->r[0];
         /* 021E2B64 */ cpu->r[3] = cpu->r[31];
         /* 021E2B68 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021E2B6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E2B70 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2B6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E2B70 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2B70 */ _t11 = _t10 & 0x00000001u;
         /* 021E2B70 */ if (_t11) goto L_021E2B74; else goto L_021E2B90;
   L_021E2B74: ; // 0x21e2b74
@@ -14762,10 +14762,10 @@ void Gambit_fn_021E2BB0(CPUState* cpu) {
         /* 021E2BB0 */ cpu->r[10] = 0x101D0000u;
         /* 021E2BB4 */ _t0 = cpu->r[10] + 0xFFFFFC5Cu;
         /* 021E2BB4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 021E2BB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021E2BB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021E2BBC */ cpu->r[10] = 0x101D0000u;
         /* 021E2BC0 */ cpu->r[10] = cpu->r[10] + 0xFFFFFC60u;
-        /* 021E2BC4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2BC4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2BC4 */ _t2 = _t1 & 0x00000001u;
         /* 021E2BC4 */ if (_t2) goto L_021E2BC8; else goto L_021E2BE0;
   L_021E2BC8: ; // 0x21e2bc8
@@ -14778,8 +14778,8 @@ void Gambit_fn_021E2BB0(CPUState* cpu) {
         /* 021E2BDC */ _t4 = cpu->r[10] + 0x00000000u;
         /* 021E2BDC */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_021E2BE0: ; // 0x21e2be0
-        /* 021E2BE0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021E2BE4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2BE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021E2BE4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2BE4 */ _t6 = _t5 & 0x00000001u;
         /* 021E2BE4 */ if (_t6) goto L_021E2BE8; else goto L_021E2BF0;
   L_021E2BE8: ; // 0x21e2be8
@@ -14790,9 +14790,9 @@ void Gambit_fn_021E2BB0(CPUState* cpu) {
         /* 021E2BF4 */ _t7 = cpu->r[9] + 0xFFFFE5E4u;
         /* 021E2BF4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 021E2BF8 */ cpu->r[11] = 0x101D0000u;
-        /* 021E2BFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021E2BFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021E2C00 */ cpu->r[11] = cpu->r[11] + 0xFFFFFB60u;
-        /* 021E2C04 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2C04 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2C04 */ _t9 = _t8 & 0x00000001u;
         /* 021E2C04 */ if (_t9) goto L_021E2C08; else goto L_021E2C20;
   L_021E2C08: ; // 0x21e2c08
@@ -14805,8 +14805,8 @@ void Gambit_fn_021E2BB0(CPUState* cpu) {
         /* 021E2C1C */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021E2C1C */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021E2C20: ; // 0x21e2c20
-        /* 021E2C20 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021E2C24 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2C20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021E2C24 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2C24 */ _t13 = _t12 & 0x00000001u;
         /* 021E2C24 */ if (_t13) goto L_021E2C28; else goto L_021E2C30;
   L_021E2C28: ; // 0x21e2c28
@@ -14817,9 +14817,9 @@ void Gambit_fn_021E2BB0(CPUState* cpu) {
         /* 021E2C34 */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021E2C34 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 021E2C38 */ cpu->r[9] = 0x101D0000u;
-        /* 021E2C3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021E2C3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021E2C40 */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 021E2C44 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2C44 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2C44 */ _t16 = _t15 & 0x00000001u;
         /* 021E2C44 */ if (_t16) goto L_021E2C48; else goto L_021E2C60;
   L_021E2C48: ; // 0x21e2c48
@@ -14832,8 +14832,8 @@ void Gambit_fn_021E2BB0(CPUState* cpu) {
         /* 021E2C5C */ _t18 = cpu->r[9] + 0x00000000u;
         /* 021E2C5C */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_021E2C60: ; // 0x21e2c60
-        /* 021E2C60 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 021E2C64 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2C60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 021E2C64 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2C64 */ _t20 = _t19 & 0x00000001u;
         /* 021E2C64 */ if (_t20) goto L_021E2C68; else goto L_021E2C70;
   L_021E2C68: ; // 0x21e2c68
@@ -14845,9 +14845,9 @@ void Gambit_fn_021E2BB0(CPUState* cpu) {
         /* 021E2C74 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 021E2C74 */ cpu->r[9] = _t21;
         /* 021E2C78 */ cpu->r[10] = 0x101D0000u;
-        /* 021E2C7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021E2C7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021E2C80 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021E2C84 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2C84 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2C84 */ _t23 = _t22 & 0x00000001u;
         /* 021E2C84 */ if (_t23) goto L_021E2C88; else goto L_021E2C9C;
   L_021E2C88: ; // 0x21e2c88
@@ -14859,8 +14859,8 @@ void Gambit_fn_021E2BB0(CPUState* cpu) {
         /* 021E2C98 */ _t25 = cpu->r[10] + 0x00000000u;
         /* 021E2C98 */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_021E2C9C: ; // 0x21e2c9c
-        /* 021E2C9C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021E2CA0 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2C9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021E2CA0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2CA0 */ _t27 = _t26 & 0x00000001u;
         /* 021E2CA0 */ if (_t27) goto L_021E2CA4; else goto L_021E2CAC;
   L_021E2CA4: ; // 0x21e2ca4
@@ -14872,9 +14872,9 @@ void Gambit_fn_021E2BB0(CPUState* cpu) {
         /* 021E2CB0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 021E2CB0 */ cpu->r[10] = _t28;
         /* 021E2CB4 */ cpu->r[11] = 0x101D0000u;
-        /* 021E2CB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021E2CB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021E2CBC */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021E2CC0 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2CC0 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2CC0 */ _t30 = _t29 & 0x00000001u;
         /* 021E2CC0 */ if (_t30) goto L_021E2CC4; else goto L_021E2CD8;
   L_021E2CC4: ; // 0x21e2cc4
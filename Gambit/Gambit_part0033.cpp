@@ -251,18 +251,18 @@ void Gambit_fn_021E2FA0(CPUState* cpu) {
         /* 021E2FA8 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021E2FA8 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021E2FAC */ cpu->r[31] = cpu->r[3];
-        /* 021E2FAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021E2FAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021E2FB0 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021E2FB0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021E2FB4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2FB4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2FB4 */ _t4 = _t3 & 0x00000001u;
         /* 021E2FB4 */ if (_t4) goto L_021E2FB8; else goto L_021E2FC8;
   L_021E2FB8: ; // 0x21e2fb8
         /* 021E2FB8 */ cpu->r[3] = 0x0000016Cu;
         /* 021E2FBC */ Gambit_fn_02801A78(cpu);
         /* 021E2FC0 */ cpu->r[31] = cpu->r[3];
-        /* 021E2FC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E2FC4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2FC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E2FC4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2FC4 */ _t6 = _t5 & 0x00000001u;
         /* 021E2FC4 */ if (_t6) goto L_021E3010; else goto L_021E2FC8;
   L_021E2FC8: ; // 0x21e2fc8
@@ -276,10 +276,10 @@ void Gambit_fn_021E2FA0(CPUState* cpu) {
         /* 021E2FE0 */ _t8 = cpu->r[31] + 0x00000004u;
         /* 021E2FE0 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 021E2FE4 */ cpu->r[12] = cpu->r[31] + 0x0000012Cu;
-        /* 021E2FE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021E2FE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021E2FE8 */ _t9 = cpu->r[31] + 0x00000128u;
         /* 021E2FE8 */ rbrew_write_f32(cpu->mem, _t9, cpu->f[0]);
-        /* 021E2FEC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2FEC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2FEC */ _t11 = _t10 & 0x00000001u;
         /* 021E2FEC */ if (_t11) goto L_021E2FF0; else goto L_021E2FF8;
   L_021E2FF0: ; // 0x21e2ff0
@@ -287,8 +287,8 @@ void Gambit_fn_021E2FA0(CPUState* cpu) {
         /* 021E2FF4 */ Gambit_fn_02801A78(cpu);
   L_021E2FF8: ; // 0x21e2ff8
         /* 021E2FF8 */ cpu->r[0] = cpu->r[31] + 0x0000015Cu;
-        /* 021E2FF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E2FFC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2FF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E2FFC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2FFC */ _t13 = _t12 & 0x00000001u;
         /* 021E2FFC */ if (_t13) goto L_021E3000; else goto L_021E3008;
   L_021E3000: ; // 0x21e3000
@@ -320,18 +320,18 @@ void Gambit_fn_021E2FA4(CPUState* cpu) {
         /* 021E2FA8 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021E2FA8 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021E2FAC */ cpu->r[31] = cpu->r[3];
-        /* 021E2FAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021E2FAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021E2FB0 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021E2FB0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021E2FB4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2FB4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2FB4 */ _t4 = _t3 & 0x00000001u;
         /* 021E2FB4 */ if (_t4) goto L_021E2FB8; else goto L_021E2FC8;
   L_021E2FB8: ; // 0x21e2fb8
         /* 021E2FB8 */ cpu->r[3] = 0x0000016Cu;
         /* 021E2FBC */ Gambit_fn_02801A78(cpu);
         /* 021E2FC0 */ cpu->r[31] = cpu->r[3];
-        /* 021E2FC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E2FC4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2FC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E2FC4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2FC4 */ _t6 = _t5 & 0x00000001u;
         /* 021E2FC4 */ if (_t6) goto L_021E3010; else goto L_021E2FC8;
   L_021E2FC8: ; // 0x21e2fc8
@@ -345,10 +345,10 @@ void Gambit_fn_021E2FA4(CPUState* cpu) {
         /* 021E2FE0 */ _t8 = cpu->r[31] + 0x00000004u;
         /* 021E2FE0 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 021E2FE4 */ cpu->r[12] = cpu->r[31] + 0x0000012Cu;
-        /* 021E2FE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021E2FE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021E2FE8 */ _t9 = cpu->r[31] + 0x00000128u;
         /* 021E2FE8 */ rbrew_write_f32(cpu->mem, _t9, cpu->f[0]);
-        /* 021E2FEC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2FEC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2FEC */ _t11 = _t10 & 0x00000001u;
         /* 021E2FEC */ if (_t11) goto L_021E2FF0; else goto L_021E2FF8;
   L_021E2FF0: ; // 0x21e2ff0
@@ -356,8 +356,8 @@ void Gambit_fn_021E2FA4(CPUState* cpu) {
         /* 021E2FF4 */ Gambit_fn_02801A78(cpu);
   L_021E2FF8: ; // 0x21e2ff8
         /* 021E2FF8 */ cpu->r[0] = cpu->r[31] + 0x0000015Cu;
-        /* 021E2FF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E2FFC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E2FF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E2FFC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E2FFC */ _t13 = _t12 & 0x00000001u;
         /* 021E2FFC */ if (_t13) goto L_021E3000; else goto L_021E3008;
   L_021E3000: ; // 0x21e3000
@@ -552,7 +552,7 @@ void Gambit_fn_021E3028(CPUState* cpu) {
         /* 021E31BC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t62);
         /* 021E31C0 */ _t63 = cpu->r[1] + 0x00000078u;
         /* 021E31C0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t63);
-        /* 021E31C4 */ _t64 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E31C4 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E31C4 */ _t65 = _t64 & 0x00000001u;
         /* 021E31C4 */ if (_t65) goto L_021E31C8; // else: addr-0 trap, fall-through
   L_021E31C8: ; // 0x21e31c8
@@ -737,7 +737,7 @@ void Gambit_fn_021E31D8(CPUState* cpu) {
         /* 021E31BC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t62);
         /* 021E31C0 */ _t63 = cpu->r[1] + 0x00000078u;
         /* 021E31C0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t63);
-        /* 021E31C4 */ _t64 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E31C4 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E31C4 */ _t65 = _t64 & 0x00000001u;
         /* 021E31C4 */ if (_t65) goto L_021E31C8; // else: addr-0 trap, fall-through
   L_021E31C8: ; // 0x21e31c8
@@ -913,8 +913,8 @@ void Gambit_fn_021E325C(CPUState* cpu) {
         /* 021E32D0 */ cpu->f[8] = fma(cpu->f[11], cpu->f[11], cpu->f[0]);
         /* 021E32D4 */ _t17 = cpu->r[10] + 0x000031C4u;
         /* 021E32D4 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t17);
-        /* 021E32D8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[12]);
-        /* 021E32DC */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E32D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[12]));
+        /* 021E32DC */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E32DC */ _t19 = _t18 & 0x00000001u;
         /* 021E32DC */ if (_t19) goto L_021E32E0; else goto L_021E331C;
   L_021E32E0: ; // 0x21e32e0
@@ -960,8 +960,8 @@ void Gambit_fn_021E325C(CPUState* cpu) {
         /* 021E334C */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 021E3350 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 021E3354 */ Gambit_fn_021C6DD8(cpu);
-        /* 021E3358 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E335C */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3358 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E335C */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E335C */ _t32 = _t31 & 0x00000001u;
         /* 021E335C */ if (_t32) goto L_021E3360; else goto L_021E3374;
   L_021E3360: ; // 0x21e3360
@@ -1024,8 +1024,8 @@ void Gambit_fn_021E325C(CPUState* cpu) {
         /* 021E33F4 */ cpu->r[3] = cpu->r[31];
         /* 021E33F8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021E33FC */ Gambit_fn_027E3F3C(cpu);
-        /* 021E3400 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E3404 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3400 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E3404 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3404 */ _t52 = _t51 & 0x00000001u;
         /* 021E3404 */ if (_t52) goto L_021E3410; else goto L_021E3408;
   L_021E3408: ; // 0x21e3408
@@ -1034,21 +1034,21 @@ void Gambit_fn_021E325C(CPUState* cpu) {
   L_021E3410: ; // 0x21e3410
         /* 021E3410 */ _t53 = cpu->r[31] + 0x0000001Cu;
         /* 021E3410 */ cpu->r[9] = rbrew_read32(cpu->mem, _t53);
-        /* 021E3414 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000002u);
-        /* 021E3418 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3414 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000002u));
+        /* 021E3418 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3418 */ _t55 = _t54 & 0x00000001u;
         /* 021E3418 */ if (_t55) goto L_021E3424; else goto L_021E341C;
   L_021E341C: ; // 0x21e341c
-        /* 021E341C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000003u);
-        /* 021E3420 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E341C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000003u));
+        /* 021E3420 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3420 */ _t57 = _t56 & 0x00000001u;
         /* 021E3420 */ if (_t57) goto L_021E3424; else goto L_021E3470;
   L_021E3424: ; // 0x21e3424
         /* 021E3424 */ _t58 = cpu->r[31] + 0x00000114u;
         /* 021E3424 */ cpu->r[11] = rbrew_read32(cpu->mem, _t58);
         /* 021E3428 */ cpu->r[11] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 021E3428 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021E342C */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3428 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021E342C */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E342C */ _t60 = _t59 & 0x00000001u;
         /* 021E342C */ if (_t60) goto L_021E3430; else goto L_021E3470;
   L_021E3430: ; // 0x21e3430
@@ -1064,16 +1064,16 @@ void Gambit_fn_021E325C(CPUState* cpu) {
         /* 021E3444 */ cpu->ctr = cpu->r[9];
         /* 021E3448 */ cpu->r[3] = cpu->r[31];
         /* 021E344C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021E3450 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E3454 */ _t65 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E3450 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E3454 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E3454 */ _t66 = _t65 & 0x00000001u;
         /* 021E3454 */ if (_t66) goto L_021E3458; else goto L_021E3470;
   L_021E3458: ; // 0x21e3458
         /* 021E3458 */ _t67 = cpu->r[31] + 0x00000168u;
         /* 021E3458 */ cpu->r[0] = rbrew_read32(cpu->mem, _t67);
         /* 021E345C */ /* nop */
-        /* 021E3460 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], cpu->r[3]);
-        /* 021E3464 */ _t68 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E3460 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], cpu->r[3]));
+        /* 021E3464 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E3464 */ _t69 = _t68 & 0x00000001u;
         /* 021E3464 */ if (_t69) goto L_021E3470; else goto L_021E3468;
   L_021E3468: ; // 0x21e3468
@@ -1146,8 +1146,8 @@ void Gambit_fn_021E3260(CPUState* cpu) {
         /* 021E32D0 */ cpu->f[8] = fma(cpu->f[11], cpu->f[11], cpu->f[0]);
         /* 021E32D4 */ _t17 = cpu->r[10] + 0x000031C4u;
         /* 021E32D4 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t17);
-        /* 021E32D8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[12]);
-        /* 021E32DC */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E32D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[12]));
+        /* 021E32DC */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E32DC */ _t19 = _t18 & 0x00000001u;
         /* 021E32DC */ if (_t19) goto L_021E32E0; else goto L_021E331C;
   L_021E32E0: ; // 0x21e32e0
@@ -1193,8 +1193,8 @@ void Gambit_fn_021E3260(CPUState* cpu) {
         /* 021E334C */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 021E3350 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 021E3354 */ Gambit_fn_021C6DD8(cpu);
-        /* 021E3358 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E335C */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3358 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E335C */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E335C */ _t32 = _t31 & 0x00000001u;
         /* 021E335C */ if (_t32) goto L_021E3360; else goto L_021E3374;
   L_021E3360: ; // 0x21e3360
@@ -1257,8 +1257,8 @@ void Gambit_fn_021E3260(CPUState* cpu) {
         /* 021E33F4 */ cpu->r[3] = cpu->r[31];
         /* 021E33F8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021E33FC */ Gambit_fn_027E3F3C(cpu);
-        /* 021E3400 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E3404 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3400 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E3404 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3404 */ _t52 = _t51 & 0x00000001u;
         /* 021E3404 */ if (_t52) goto L_021E3410; else goto L_021E3408;
   L_021E3408: ; // 0x21e3408
@@ -1267,21 +1267,21 @@ void Gambit_fn_021E3260(CPUState* cpu) {
   L_021E3410: ; // 0x21e3410
         /* 021E3410 */ _t53 = cpu->r[31] + 0x0000001Cu;
         /* 021E3410 */ cpu->r[9] = rbrew_read32(cpu->mem, _t53);
-        /* 021E3414 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000002u);
-        /* 021E3418 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3414 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000002u));
+        /* 021E3418 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3418 */ _t55 = _t54 & 0x00000001u;
         /* 021E3418 */ if (_t55) goto L_021E3424; else goto L_021E341C;
   L_021E341C: ; // 0x21e341c
-        /* 021E341C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000003u);
-        /* 021E3420 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E341C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000003u));
+        /* 021E3420 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3420 */ _t57 = _t56 & 0x00000001u;
         /* 021E3420 */ if (_t57) goto L_021E3424; else goto L_021E3470;
   L_021E3424: ; // 0x21e3424
         /* 021E3424 */ _t58 = cpu->r[31] + 0x00000114u;
         /* 021E3424 */ cpu->r[11] = rbrew_read32(cpu->mem, _t58);
         /* 021E3428 */ cpu->r[11] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 021E3428 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021E342C */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3428 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021E342C */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E342C */ _t60 = _t59 & 0x00000001u;
         /* 021E342C */ if (_t60) goto L_021E3430; else goto L_021E3470;
   L_021E3430: ; // 0x21e3430
@@ -1297,16 +1297,16 @@ void Gambit_fn_021E3260(CPUState* cpu) {
         /* 021E3444 */ cpu->ctr = cpu->r[9];
         /* 021E3448 */ cpu->r[3] = cpu->r[31];
         /* 021E344C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021E3450 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E3454 */ _t65 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E3450 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E3454 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E3454 */ _t66 = _t65 & 0x00000001u;
         /* 021E3454 */ if (_t66) goto L_021E3458; else goto L_021E3470;
   L_021E3458: ; // 0x21e3458
         /* 021E3458 */ _t67 = cpu->r[31] + 0x00000168u;
         /* 021E3458 */ cpu->r[0] = rbrew_read32(cpu->mem, _t67);
         /* 021E345C */ /* nop */
-        /* 021E3460 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], cpu->r[3]);
-        /* 021E3464 */ _t68 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E3460 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], cpu->r[3]));
+        /* 021E3464 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E3464 */ _t69 = _t68 & 0x00000001u;
         /* 021E3464 */ if (_t69) goto L_021E3470; else goto L_021E3468;
   L_021E3468: ; // 0x21e3468
@@ -1333,15 +1333,15 @@ void Gambit_fn_021E348C(CPUState* cpu) {
         /* 021E348C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E3490 */ _t1 = cpu->r[5] + 0x00000000u;
         /* 021E3490 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
-        /* 021E3494 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
-        /* 021E3498 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3494 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
+        /* 021E3498 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3498 */ _t3 = _t2 & 0x00000001u;
         /* 021E3498 */ if (_t3) goto L_021E34C0; else goto L_021E349C;
   L_021E349C: ; // 0x21e349c
-        /* 021E349C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x0000000Au);
+        /* 021E349C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x0000000Au));
         /* 021E34A0 */ _t4 = cpu->r[3] + 0x00000004u;
         /* 021E34A0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t4);
-        /* 021E34A4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E34A4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E34A4 */ _t6 = _t5 & 0x00000001u;
         /* 021E34A4 */ if (_t6) goto L_021E34A8; else goto L_021E34B4;
   L_021E34A8: ; // 0x21e34a8
@@ -1421,7 +1421,7 @@ void Gambit_fn_021E34FC(CPUState* cpu) {
         /* 021E3508 */ _t2 = cpu->r[4] + 0x00000000u;
         /* 021E3508 */ rbrew_write16(cpu->mem, _t2, (uint16_t)cpu->r[10]);
         /* 021E350C */ cpu->r[12] = cpu->r[11] & 0x0000FEFFu;
-        /* 021E350C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021E350C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021E3510 */ cpu->r[0] = 0x00000000u;
         /* 021E3514 */ _t3 = cpu->r[4] + 0x00000002u;
         /* 021E3514 */ rbrew_write16(cpu->mem, _t3, (uint16_t)cpu->r[12]);
@@ -1449,7 +1449,7 @@ void Gambit_fn_021E3520(CPUState* cpu) {
         /* 021E3534 */ cpu->r[10] = rbrew_read32(cpu->mem, _t3);
         /* 021E3538 */ cpu->r[0] = rbrew_rlwinm(cpu->r[10], 0x0000001Eu, 0x00000000u, 0x00000001u);
         /* 021E353C */ /* nop */
-        /* 021E3540 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3540 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3540 */ _t5 = _t4 & 0x00000001u;
         /* 021E3540 */ if (_t5) goto L_021E368C; else goto L_021E3544;
   L_021E3544: ; // 0x21e3544
@@ -1492,8 +1492,8 @@ void Gambit_fn_021E3520(CPUState* cpu) {
         /* 021E359C */ cpu->f[8] = fma(cpu->f[10], cpu->f[10], cpu->f[13]);
         /* 021E35A0 */ _t20 = cpu->r[12] + 0x000031C4u;
         /* 021E35A0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t20);
-        /* 021E35A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
-        /* 021E35A8 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E35A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
+        /* 021E35A8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E35A8 */ _t22 = _t21 & 0x00000001u;
         /* 021E35A8 */ if (_t22) goto L_021E35AC; else goto L_021E35E8;
   L_021E35AC: ; // 0x21e35ac
@@ -1524,8 +1524,8 @@ void Gambit_fn_021E3520(CPUState* cpu) {
         /* 021E35F0 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 021E35F4 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 021E35F8 */ Gambit_fn_021C6DD8(cpu);
-        /* 021E35FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E3600 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E35FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E3600 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3600 */ _t30 = _t29 & 0x00000001u;
         /* 021E3600 */ if (_t30) goto L_021E3604; else goto L_021E3618;
   L_021E3604: ; // 0x21e3604
@@ -1608,7 +1608,7 @@ void Gambit_fn_021E3524(CPUState* cpu) {
         /* 021E3534 */ cpu->r[10] = rbrew_read32(cpu->mem, _t3);
         /* 021E3538 */ cpu->r[0] = rbrew_rlwinm(cpu->r[10], 0x0000001Eu, 0x00000000u, 0x00000001u);
         /* 021E353C */ /* nop */
-        /* 021E3540 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3540 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3540 */ _t5 = _t4 & 0x00000001u;
         /* 021E3540 */ if (_t5) goto L_021E368C; else goto L_021E3544;
   L_021E3544: ; // 0x21e3544
@@ -1651,8 +1651,8 @@ void Gambit_fn_021E3524(CPUState* cpu) {
         /* 021E359C */ cpu->f[8] = fma(cpu->f[10], cpu->f[10], cpu->f[13]);
         /* 021E35A0 */ _t20 = cpu->r[12] + 0x000031C4u;
         /* 021E35A0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t20);
-        /* 021E35A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
-        /* 021E35A8 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E35A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
+        /* 021E35A8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E35A8 */ _t22 = _t21 & 0x00000001u;
         /* 021E35A8 */ if (_t22) goto L_021E35AC; else goto L_021E35E8;
   L_021E35AC: ; // 0x21e35ac
@@ -1683,8 +1683,8 @@ void Gambit_fn_021E3524(CPUState* cpu) {
         /* 021E35F0 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 021E35F4 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 021E35F8 */ Gambit_fn_021C6DD8(cpu);
-        /* 021E35FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E3600 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E35FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E3600 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3600 */ _t30 = _t29 & 0x00000001u;
         /* 021E3600 */ if (_t30) goto L_021E3604; else goto L_021E3618;
   L_021E3604: ; // 0x21e3604
@@ -1803,28 +1803,28 @@ void Gambit_fn_021E36A0(CPUState* cpu) {
         /* 021E3714 */ cpu->r[3] = cpu->r[31];
         /* 021E3718 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021E371C */ cpu->r[12] = 0x10030000u;
-        /* 021E3720 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[1]);
+        /* 021E3720 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[1]));
         /* 021E3724 */ _t16 = cpu->r[12] + 0x000031C4u;
         /* 021E3724 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t16);
         /* 021E3728 */ _t17 = cpu->r[31] + 0x00000128u;
         /* 021E3728 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t17);
-        /* 021E372C */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E372C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E372C */ _t19 = _t18 & 0x00000001u;
         /* 021E372C */ if (_t19) goto L_021E3768; else goto L_021E3730;
   L_021E3730: ; // 0x21e3730
-        /* 021E3730 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[29]);
-        /* 021E3734 */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E3730 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[29]));
+        /* 021E3734 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E3734 */ _t21 = _t20 & 0x00000001u;
         /* 021E3734 */ if (_t21) goto L_021E3738; else goto L_021E3780;
   L_021E3738: ; // 0x21e3738
-        /* 021E3738 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[1]);
-        /* 021E373C */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E3738 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[1]));
+        /* 021E373C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E373C */ _t23 = _t22 & 0x00000001u;
         /* 021E373C */ if (_t23) goto L_021E3740; else goto L_021E3770;
   L_021E3740: ; // 0x21e3740
         /* 021E3740 */ cpu->f[11] = cpu->f[1] - cpu->f[29];
-        /* 021E3744 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[0]);
-        /* 021E3748 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3744 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[0]));
+        /* 021E3748 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3748 */ _t25 = _t24 & 0x00000001u;
         /* 021E3748 */ if (_t25) goto L_021E3760; else goto L_021E374C;
   L_021E374C: ; // 0x21e374c
@@ -1837,16 +1837,16 @@ void Gambit_fn_021E36A0(CPUState* cpu) {
         /* 021E3760 */ cpu->f[1] = cpu->f[30];
         /* 021E3764 */ goto L_021E37AC;
   L_021E3768: ; // 0x21e3768
-        /* 021E3768 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[1]);
-        /* 021E376C */ _t26 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E3768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[1]));
+        /* 021E376C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E376C */ _t27 = _t26 & 0x00000001u;
         /* 021E376C */ if (_t27) goto L_021E3778; else goto L_021E3770;
   L_021E3770: ; // 0x21e3770
         /* 021E3770 */ cpu->f[1] = cpu->f[31];
         /* 021E3774 */ goto L_021E37AC;
   L_021E3778: ; // 0x21e3778
-        /* 021E3778 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[29]);
-        /* 021E377C */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E3778 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[29]));
+        /* 021E377C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E377C */ _t29 = _t28 & 0x00000001u;
         /* 021E377C */ if (_t29) goto L_021E3788; else goto L_021E3780;
   L_021E3780: ; // 0x21e3780
@@ -1854,8 +1854,8 @@ void Gambit_fn_021E36A0(CPUState* cpu) {
         /* 021E3784 */ goto L_021E37AC;
   L_021E3788: ; // 0x21e3788
         /* 021E3788 */ cpu->f[13] = cpu->f[29] - cpu->f[1];
-        /* 021E378C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 021E3790 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E378C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 021E3790 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3790 */ _t31 = _t30 & 0x00000001u;
         /* 021E3790 */ if (_t31) goto L_021E37A8; else goto L_021E3794;
   L_021E3794: ; // 0x21e3794
@@ -1881,7 +1881,7 @@ void Gambit_fn_021E36A0(CPUState* cpu) {
         /* 021E37C0 */ cpu->f[29] = rbrew_read_f64(cpu->mem, _t37);
         /* 021E37C4 */ _t38 = cpu->r[1] + 0x0000000Cu;
         /* 021E37C4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t38);
-        /* 021E37C8 */ _t39 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E37C8 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E37C8 */ _t40 = _t39 & 0x00000001u;
         /* 021E37C8 */ if (_t40) goto L_021E37CC; // else: addr-0 trap, fall-through
   L_021E37CC: ; // 0x21e37cc
@@ -1954,8 +1954,8 @@ void Gambit_fn_021E3800(CPUState* cpu) {
         /* 021E3800 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E3800 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E3804 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021E3804 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E3808 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3804 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E3808 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3808 */ _t2 = _t1 & 0x00000001u;
         /* 021E3808 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E3808 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -1977,8 +1977,8 @@ void Gambit_fn_021E381C(CPUState* cpu) {
         /* 021E381C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E381C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E3820 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021E3820 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E3824 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3820 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E3824 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3824 */ _t2 = _t1 & 0x00000001u;
         /* 021E3824 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E3824 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -2000,8 +2000,8 @@ void Gambit_fn_021E3838(CPUState* cpu) {
         /* 021E3838 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E3838 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E383C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021E383C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E3840 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E383C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E3840 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3840 */ _t2 = _t1 & 0x00000001u;
         /* 021E3840 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E3840 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -2044,8 +2044,8 @@ void Gambit_fn_021E3864(CPUState* cpu) {
         /* 021E3874 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E3878 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021E3878 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021E387C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021E3880 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E387C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021E3880 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3880 */ _t5 = _t4 & 0x00000001u;
         /* 021E3880 */ if (_t5) goto L_021E3884; else goto L_021E38A0;
   L_021E3884: ; // 0x21e3884
@@ -2084,8 +2084,8 @@ void Gambit_fn_021E3868(CPUState* cpu) {
         /* 021E3874 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E3878 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021E3878 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021E387C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021E3880 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E387C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021E3880 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3880 */ _t5 = _t4 & 0x00000001u;
         /* 021E3880 */ if (_t5) goto L_021E3884; else goto L_021E38A0;
   L_021E3884: ; // 0x21e3884
@@ -2543,8 +2543,8 @@ void Gambit_fn_021E3A78(CPUState* cpu) {
         /* 021E3A78 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 021E3A78 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E3A7C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 021E3A7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E3A80 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3A7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E3A80 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3A80 */ _t2 = _t1 & 0x00000001u;
         /* 021E3A80 */ if (_t2) goto L_021E3A90; else goto L_021E3A84;
   L_021E3A84: ; // 0x21e3a84
@@ -2573,8 +2573,8 @@ void Gambit_fn_021E3A9C(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -2640,10 +2640,10 @@ void Gambit_fn_021E3ACC(CPUState* cpu) {
         /* 021E3ACC */ cpu->r[10] = 0x101D0000u;
         /* 021E3AD0 */ _t0 = cpu->r[10] + 0xFFFFE608u;
         /* 021E3AD0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 021E3AD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021E3AD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021E3AD8 */ cpu->r[10] = 0x101D0000u;
         /* 021E3ADC */ cpu->r[10] = cpu->r[10] + 0xFFFFFC64u;
-        /* 021E3AE0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3AE0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3AE0 */ _t2 = _t1 & 0x00000001u;
         /* 021E3AE0 */ if (_t2) goto L_021E3AE4; else goto L_021E3AFC;
   L_021E3AE4: ; // 0x21e3ae4
@@ -2656,8 +2656,8 @@ void Gambit_fn_021E3ACC(CPUState* cpu) {
         /* 021E3AF8 */ _t4 = cpu->r[10] + 0x00000000u;
         /* 021E3AF8 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_021E3AFC: ; // 0x21e3afc
-        /* 021E3AFC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021E3B00 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3AFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021E3B00 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3B00 */ _t6 = _t5 & 0x00000001u;
         /* 021E3B00 */ if (_t6) goto L_021E3B04; else goto L_021E3B0C;
   L_021E3B04: ; // 0x21e3b04
@@ -2668,9 +2668,9 @@ void Gambit_fn_021E3ACC(CPUState* cpu) {
         /* 021E3B10 */ _t7 = cpu->r[9] + 0xFFFFDA00u;
         /* 021E3B10 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 021E3B14 */ cpu->r[11] = 0x101D0000u;
-        /* 021E3B18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021E3B18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021E3B1C */ cpu->r[11] = cpu->r[11] + 0xFFFFFBFCu;
-        /* 021E3B20 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3B20 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3B20 */ _t9 = _t8 & 0x00000001u;
         /* 021E3B20 */ if (_t9) goto L_021E3B24; else goto L_021E3B3C;
   L_021E3B24: ; // 0x21e3b24
@@ -2683,8 +2683,8 @@ void Gambit_fn_021E3ACC(CPUState* cpu) {
         /* 021E3B38 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021E3B38 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021E3B3C: ; // 0x21e3b3c
-        /* 021E3B3C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021E3B40 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3B3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021E3B40 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3B40 */ _t13 = _t12 & 0x00000001u;
         /* 021E3B40 */ if (_t13) goto L_021E3B44; else goto L_021E3B4C;
   L_021E3B44: ; // 0x21e3b44
@@ -2695,9 +2695,9 @@ void Gambit_fn_021E3ACC(CPUState* cpu) {
         /* 021E3B50 */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021E3B50 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 021E3B54 */ cpu->r[9] = 0x101D0000u;
-        /* 021E3B58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021E3B58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021E3B5C */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 021E3B60 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3B60 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3B60 */ _t16 = _t15 & 0x00000001u;
         /* 021E3B60 */ if (_t16) goto L_021E3B64; else goto L_021E3B7C;
   L_021E3B64: ; // 0x21e3b64
@@ -2710,8 +2710,8 @@ void Gambit_fn_021E3ACC(CPUState* cpu) {
         /* 021E3B78 */ _t18 = cpu->r[9] + 0x00000000u;
         /* 021E3B78 */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_021E3B7C: ; // 0x21e3b7c
-        /* 021E3B7C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 021E3B80 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3B7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 021E3B80 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3B80 */ _t20 = _t19 & 0x00000001u;
         /* 021E3B80 */ if (_t20) goto L_021E3B84; else goto L_021E3B8C;
   L_021E3B84: ; // 0x21e3b84
@@ -2723,9 +2723,9 @@ void Gambit_fn_021E3ACC(CPUState* cpu) {
         /* 021E3B90 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 021E3B90 */ cpu->r[9] = _t21;
         /* 021E3B94 */ cpu->r[10] = 0x101D0000u;
-        /* 021E3B98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021E3B98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021E3B9C */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021E3BA0 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3BA0 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3BA0 */ _t23 = _t22 & 0x00000001u;
         /* 021E3BA0 */ if (_t23) goto L_021E3BA4; else goto L_021E3BB8;
   L_021E3BA4: ; // 0x21e3ba4
@@ -2737,8 +2737,8 @@ void Gambit_fn_021E3ACC(CPUState* cpu) {
         /* 021E3BB4 */ _t25 = cpu->r[10] + 0x00000000u;
         /* 021E3BB4 */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_021E3BB8: ; // 0x21e3bb8
-        /* 021E3BB8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021E3BBC */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3BB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021E3BBC */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3BBC */ _t27 = _t26 & 0x00000001u;
         /* 021E3BBC */ if (_t27) goto L_021E3BC0; else goto L_021E3BC8;
   L_021E3BC0: ; // 0x21e3bc0
@@ -2750,9 +2750,9 @@ void Gambit_fn_021E3ACC(CPUState* cpu) {
         /* 021E3BCC */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 021E3BCC */ cpu->r[10] = _t28;
         /* 021E3BD0 */ cpu->r[11] = 0x101D0000u;
-        /* 021E3BD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021E3BD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021E3BD8 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021E3BDC */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3BDC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3BDC */ _t30 = _t29 & 0x00000001u;
         /* 021E3BDC */ if (_t30) goto L_021E3BE0; else goto L_021E3BF4;
   L_021E3BE0: ; // 0x21e3be0
@@ -2798,8 +2798,8 @@ void Gambit_fn_021E3C1C(CPUState* cpu) {
         /* 021E3C1C */ cpu->r[1] = _t0;
         /* 021E3C20 */ _t1 = cpu->r[3] + 0x0000016Cu;
         /* 021E3C20 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t1);
-        /* 021E3C24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E3C28 */ _t2 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E3C24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E3C28 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E3C28 */ _t3 = _t2 & 0x00000001u;
         /* 021E3C28 */ if (_t3) goto L_021E3C2C; else goto L_021E3C3C;
   L_021E3C2C: ; // 0x21e3c2c
@@ -2836,8 +2836,8 @@ void Gambit_fn_021E3C64(CPUState* cpu) {
         /* 021E3C64 */ cpu->r[1] = _t0;
         /* 021E3C68 */ _t1 = cpu->r[3] + 0x0000016Cu;
         /* 021E3C68 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t1);
-        /* 021E3C6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E3C70 */ _t2 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E3C6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E3C70 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E3C70 */ _t3 = _t2 & 0x00000001u;
         /* 021E3C70 */ if (_t3) goto L_021E3C74; else goto L_021E3C84;
   L_021E3C74: ; // 0x21e3c74
@@ -2875,18 +2875,18 @@ void Gambit_fn_021E3CB0(CPUState* cpu) {
         /* 021E3CB4 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021E3CB4 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021E3CB8 */ cpu->r[31] = cpu->r[3];
-        /* 021E3CB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021E3CB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021E3CBC */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021E3CBC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021E3CC0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3CC0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3CC0 */ _t4 = _t3 & 0x00000001u;
         /* 021E3CC0 */ if (_t4) goto L_021E3CC4; else goto L_021E3CD4;
   L_021E3CC4: ; // 0x21e3cc4
         /* 021E3CC4 */ cpu->r[3] = 0x00000170u;
         /* 021E3CC8 */ Gambit_fn_02801A78(cpu);
         /* 021E3CCC */ cpu->r[31] = cpu->r[3];
-        /* 021E3CCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E3CD0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3CCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E3CD0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3CD0 */ _t6 = _t5 & 0x00000001u;
         /* 021E3CD0 */ if (_t6) goto L_021E3CE8; else goto L_021E3CD4;
   L_021E3CD4: ; // 0x21e3cd4
@@ -2915,10 +2915,10 @@ void Gambit_fn_021E3D00(CPUState* cpu) {
         /* 021E3D00 */ _t0 = cpu->r[3] + 0x0000016Cu;
         /* 021E3D00 */ cpu->r[5] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t0);
         /* 021E3D04 */ cpu->r[0] = 0xFFFFFFFFu;
-        /* 021E3D08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021E3D08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021E3D0C */ _t1 = cpu->r[3] + 0x00000030u;
         /* 021E3D0C */ cpu->r[3] = rbrew_read32(cpu->mem, _t1);
-        /* 021E3D10 */ _t2 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E3D10 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E3D10 */ _t3 = _t2 & 0x00000001u;
         /* 021E3D10 */ if (_t3) goto L_021E3D14; else goto L_021E3D18;
   L_021E3D14: ; // 0x21e3d14
@@ -2929,8 +2929,8 @@ void Gambit_fn_021E3D00(CPUState* cpu) {
   L_027B8224: ; // 0x27b8224
         /* 027B8224 */ _t4 = cpu->r[3] + 0x00000000u;
         /* 027B8224 */ cpu->r[3] = rbrew_read32(cpu->mem, _t4);
-        /* 027B8228 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 027B822C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 027B8228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 027B822C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 027B822C */ _t6 = _t5 & 0x00000001u;
         /* 027B822C */ if (_t6) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 027B822C */ goto L_027B8230;
@@ -2953,9 +2953,9 @@ void Gambit_fn_021E3D00(CPUState* cpu) {
         /* 027DA6B4 */ _t12 = cpu->r[29] + 0x00000014u;
         /* 027DA6B4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t12);
         /* 027DA6B8 */ cpu->r[31] = cpu->r[5];
-        /* 027DA6BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 027DA6BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 027DA6C0 */ cpu->r[30] = cpu->r[4];
-        /* 027DA6C4 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 027DA6C4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 027DA6C4 */ _t14 = _t13 & 0x00000001u;
         /* 027DA6C4 */ if (_t14) goto L_027DA6D4; else goto L_027DA6C8;
   L_027DA6C8: ; // 0x27da6c8
@@ -2965,8 +2965,8 @@ void Gambit_fn_021E3D00(CPUState* cpu) {
   L_027DA6D4: ; // 0x27da6d4
         /* 027DA6D4 */ _t15 = cpu->r[29] + 0x00000018u;
         /* 027DA6D4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t15);
-        /* 027DA6D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 027DA6DC */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 027DA6D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 027DA6DC */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 027DA6DC */ _t17 = _t16 & 0x00000001u;
         /* 027DA6DC */ if (_t17) goto L_027DA6EC; else goto L_027DA6E0;
   L_027DA6E0: ; // 0x27da6e0
@@ -3084,9 +3084,9 @@ void Gambit_fn_021E3DF4(CPUState* cpu) {
         /* 02056D64 */ cpu->r[7] = _t2;
         /* 02056D68 */ cpu->r[31] = 0x101E0000u;
         /* 02056D6C */ cpu->r[22] = cpu->r[3];
-        /* 02056D70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02056D70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02056D74 */ cpu->r[31] = cpu->r[31] + 0xFFFFA540u;
-        /* 02056D78 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056D78 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056D78 */ _t4 = _t3 & 0x00000001u;
         /* 02056D78 */ if (_t4) goto L_02056D7C; else goto L_02056DC4;
   L_02056D7C: ; // 0x2056d7c
@@ -3112,8 +3112,8 @@ void Gambit_fn_021E3DF4(CPUState* cpu) {
   L_02056DC4: ; // 0x2056dc4
         /* 02056DC4 */ _t6 = cpu->r[31] + 0x00000054u;
         /* 02056DC4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 02056DC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02056DCC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056DC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02056DCC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056DCC */ _t8 = _t7 & 0x00000001u;
         /* 02056DCC */ if (_t8) goto L_02056DD0; else goto L_02056EC4;
   L_02056DD0: ; // 0x2056dd0
@@ -3129,9 +3129,9 @@ void Gambit_fn_021E3DF4(CPUState* cpu) {
   L_02056DF4: ; // 0x2056df4
         /* 02056DF4 */ _t9 = cpu->r[21] + 0xFFFFE564u;
         /* 02056DF4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 02056DF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02056DF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02056DFC */ cpu->r[25] = cpu->r[30] + 0x00000001u;
-        /* 02056E00 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056E00 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056E00 */ _t11 = _t10 & 0x00000001u;
         /* 02056E00 */ if (_t11) goto L_02056E04; else goto L_02056E1C;
   L_02056E04: ; // 0x2056e04
@@ -3145,8 +3145,8 @@ void Gambit_fn_021E3DF4(CPUState* cpu) {
   L_02056E1C: ; // 0x2056e1c
         /* 02056E1C */ _t13 = cpu->r[20] + 0xFFFFE560u;
         /* 02056E1C */ cpu->r[11] = rbrew_read32(cpu->mem, _t13);
-        /* 02056E20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02056E24 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056E20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02056E24 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056E24 */ _t15 = _t14 & 0x00000001u;
         /* 02056E24 */ if (_t15) goto L_02056E28; else goto L_02056E30;
   L_02056E28: ; // 0x2056e28
@@ -3155,8 +3155,8 @@ void Gambit_fn_021E3DF4(CPUState* cpu) {
         /* 02056E2C */ _t17 = cpu->r[20] + 0xFFFFE560u;
         /* 02056E2C */ rbrew_write32(cpu->mem, _t17, cpu->r[24]);
   L_02056E30: ; // 0x2056e30
-        /* 02056E30 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], 0x00000004u);
-        /* 02056E34 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02056E30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], 0x00000004u));
+        /* 02056E34 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02056E34 */ _t19 = _t18 & 0x00000001u;
         /* 02056E34 */ if (_t19) goto L_02056E5C; else goto L_02056E38;
   L_02056E38: ; // 0x2056e38
@@ -3165,12 +3165,12 @@ void Gambit_fn_021E3DF4(CPUState* cpu) {
         /* 02056E40 */ cpu->r[5] = 0x00000000u;
         /* 02056E44 */ Gambit_fn_028A6634(cpu);
         /* 02056E48 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02056E4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000003u);
-        /* 02056E50 */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02056E4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000003u));
+        /* 02056E50 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02056E50 */ _t21 = _t20 & 0x00000001u;
         /* 02056E50 */ if (_t21) goto L_02056EC4; else goto L_02056E54;
   L_02056E54: ; // 0x2056e54
-        /* 02056E54 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02056E54 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02056E54 */ _t23 = _t22 & 0x00000001u;
         /* 02056E54 */ if (_t23) goto L_02056DF4; else goto L_02056E58;
   L_02056E58: ; // 0x2056e58
@@ -3178,8 +3178,8 @@ void Gambit_fn_021E3DF4(CPUState* cpu) {
   L_02056E5C: ; // 0x2056e5c
         /* 02056E5C */ _t24 = cpu->r[19] + 0xFFFFE55Cu;
         /* 02056E5C */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
-        /* 02056E60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02056E64 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056E60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02056E64 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056E64 */ _t26 = _t25 & 0x00000001u;
         /* 02056E64 */ if (_t26) goto L_02056E68; else goto L_02056EA0;
   L_02056E68: ; // 0x2056e68
@@ -3188,8 +3188,8 @@ void Gambit_fn_021E3DF4(CPUState* cpu) {
         /* 02056E70 */ Gambit_fn_02836FFC(cpu);
         /* 02056E74 */ _t27 = cpu->r[19] + 0xFFFFE55Cu;
         /* 02056E74 */ cpu->r[0] = rbrew_read32(cpu->mem, _t27);
-        /* 02056E78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02056E7C */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056E78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02056E7C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056E7C */ _t29 = _t28 & 0x00000001u;
         /* 02056E7C */ if (_t29) goto L_02056E80; else goto L_02056E94;
   L_02056E80: ; // 0x2056e80
@@ -3212,12 +3212,12 @@ void Gambit_fn_021E3DF4(CPUState* cpu) {
         /* 02056EAC */ cpu->r[4] = cpu->r[30];
         /* 02056EB0 */ Gambit_fn_028A6634(cpu);
         /* 02056EB4 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02056EB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000003u);
-        /* 02056EBC */ _t33 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02056EB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000003u));
+        /* 02056EBC */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02056EBC */ _t34 = _t33 & 0x00000001u;
         /* 02056EBC */ if (_t34) goto L_02056EC4; else goto L_02056EC0;
   L_02056EC0: ; // 0x2056ec0
-        /* 02056EC0 */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02056EC0 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02056EC0 */ _t36 = _t35 & 0x00000001u;
         /* 02056EC0 */ if (_t36) goto L_02056DF4; else goto L_02056EC4;
   L_02056EC4: ; // 0x2056ec4
@@ -3330,8 +3330,8 @@ void Gambit_fn_021E3E60(CPUState* cpu) {
         /* 021E3E60 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E3E60 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E3E64 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021E3E64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E3E68 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3E64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E3E68 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3E68 */ _t2 = _t1 & 0x00000001u;
         /* 021E3E68 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E3E68 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -3353,8 +3353,8 @@ void Gambit_fn_021E3E7C(CPUState* cpu) {
         /* 021E3E7C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E3E7C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E3E80 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021E3E80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E3E84 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3E80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E3E84 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3E84 */ _t2 = _t1 & 0x00000001u;
         /* 021E3E84 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E3E84 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -3376,8 +3376,8 @@ void Gambit_fn_021E3E98(CPUState* cpu) {
         /* 021E3E98 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E3E98 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E3E9C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021E3E9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E3EA0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3E9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E3EA0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3EA0 */ _t2 = _t1 & 0x00000001u;
         /* 021E3EA0 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E3EA0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -3420,8 +3420,8 @@ void Gambit_fn_021E3EC4(CPUState* cpu) {
         /* 021E3ED4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E3ED8 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021E3ED8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021E3EDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021E3EE0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3EDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021E3EE0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3EE0 */ _t5 = _t4 & 0x00000001u;
         /* 021E3EE0 */ if (_t5) goto L_021E3EE4; else goto L_021E3F00;
   L_021E3EE4: ; // 0x21e3ee4
@@ -3460,8 +3460,8 @@ void Gambit_fn_021E3EC8(CPUState* cpu) {
         /* 021E3ED4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E3ED8 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021E3ED8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021E3EDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021E3EE0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E3EDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021E3EE0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E3EE0 */ _t5 = _t4 & 0x00000001u;
         /* 021E3EE0 */ if (_t5) goto L_021E3EE4; else goto L_021E3F00;
   L_021E3EE4: ; // 0x21e3ee4
@@ -3919,8 +3919,8 @@ void Gambit_fn_021E40D8(CPUState* cpu) {
         /* 021E40D8 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 021E40D8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E40DC */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 021E40DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E40E0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E40DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E40E0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E40E0 */ _t2 = _t1 & 0x00000001u;
         /* 021E40E0 */ if (_t2) goto L_021E40F0; else goto L_021E40E4;
   L_021E40E4: ; // 0x21e40e4
@@ -3949,8 +3949,8 @@ void Gambit_fn_021E40FC(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -4144,9 +4144,9 @@ void Gambit_fn_021E41B8(CPUState* cpu) {
         /* 021E41BC */ _t0 = cpu->r[8] + 0xFFFFE60Cu;
         /* 021E41BC */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 021E41C0 */ cpu->r[6] = 0x101D0000u;
-        /* 021E41C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021E41C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021E41C8 */ cpu->r[6] = cpu->r[6] + 0xFFFFFC68u;
-        /* 021E41CC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E41CC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E41CC */ _t2 = _t1 & 0x00000001u;
         /* 021E41CC */ if (_t2) goto L_021E41D0; else goto L_021E41E8;
   L_021E41D0: ; // 0x21e41d0
@@ -4159,8 +4159,8 @@ void Gambit_fn_021E41B8(CPUState* cpu) {
         /* 021E41E4 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 021E41E4 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_021E41E8: ; // 0x21e41e8
-        /* 021E41E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 021E41EC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E41E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 021E41EC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E41EC */ _t6 = _t5 & 0x00000001u;
         /* 021E41EC */ if (_t6) goto L_021E41F0; else goto L_021E41F8;
   L_021E41F0: ; // 0x21e41f0
@@ -4171,9 +4171,9 @@ void Gambit_fn_021E41B8(CPUState* cpu) {
         /* 021E41FC */ _t7 = cpu->r[10] + 0xFFFFE608u;
         /* 021E41FC */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 021E4200 */ cpu->r[8] = 0x101D0000u;
-        /* 021E4204 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021E4204 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021E4208 */ cpu->r[8] = cpu->r[8] + 0xFFFFFC64u;
-        /* 021E420C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E420C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E420C */ _t9 = _t8 & 0x00000001u;
         /* 021E420C */ if (_t9) goto L_021E4210; else goto L_021E4228;
   L_021E4210: ; // 0x21e4210
@@ -4186,8 +4186,8 @@ void Gambit_fn_021E41B8(CPUState* cpu) {
         /* 021E4224 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 021E4224 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_021E4228: ; // 0x21e4228
-        /* 021E4228 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021E422C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021E422C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E422C */ _t13 = _t12 & 0x00000001u;
         /* 021E422C */ if (_t13) goto L_021E4230; else goto L_021E4238;
   L_021E4230: ; // 0x21e4230
@@ -4198,9 +4198,9 @@ void Gambit_fn_021E41B8(CPUState* cpu) {
         /* 021E423C */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 021E423C */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 021E4240 */ cpu->r[10] = 0x101D0000u;
-        /* 021E4244 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021E4244 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021E4248 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 021E424C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E424C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E424C */ _t16 = _t15 & 0x00000001u;
         /* 021E424C */ if (_t16) goto L_021E4250; else goto L_021E4268;
   L_021E4250: ; // 0x21e4250
@@ -4213,8 +4213,8 @@ void Gambit_fn_021E41B8(CPUState* cpu) {
         /* 021E4264 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 021E4264 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_021E4268: ; // 0x21e4268
-        /* 021E4268 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021E426C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4268 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021E426C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E426C */ _t20 = _t19 & 0x00000001u;
         /* 021E426C */ if (_t20) goto L_021E4270; else goto L_021E4278;
   L_021E4270: ; // 0x21e4270
@@ -4225,9 +4225,9 @@ void Gambit_fn_021E41B8(CPUState* cpu) {
         /* 021E427C */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021E427C */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021E4280 */ cpu->r[12] = 0x101D0000u;
-        /* 021E4284 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021E4284 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021E4288 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021E428C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E428C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E428C */ _t23 = _t22 & 0x00000001u;
         /* 021E428C */ if (_t23) goto L_021E4290; else goto L_021E42A8;
   L_021E4290: ; // 0x21e4290
@@ -4240,8 +4240,8 @@ void Gambit_fn_021E41B8(CPUState* cpu) {
         /* 021E42A4 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 021E42A4 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_021E42A8: ; // 0x21e42a8
-        /* 021E42A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021E42AC */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E42A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021E42AC */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E42AC */ _t27 = _t26 & 0x00000001u;
         /* 021E42AC */ if (_t27) goto L_021E42B0; else goto L_021E42B8;
   L_021E42B0: ; // 0x21e42b0
@@ -4253,9 +4253,9 @@ void Gambit_fn_021E41B8(CPUState* cpu) {
         /* 021E42BC */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 021E42BC */ cpu->r[10] = _t28;
         /* 021E42C0 */ cpu->r[7] = 0x101D0000u;
-        /* 021E42C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021E42C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021E42C8 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 021E42CC */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E42CC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E42CC */ _t30 = _t29 & 0x00000001u;
         /* 021E42CC */ if (_t30) goto L_021E42D0; else goto L_021E42E4;
   L_021E42D0: ; // 0x21e42d0
@@ -4267,8 +4267,8 @@ void Gambit_fn_021E41B8(CPUState* cpu) {
         /* 021E42E0 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 021E42E0 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_021E42E4: ; // 0x21e42e4
-        /* 021E42E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 021E42E8 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E42E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 021E42E8 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E42E8 */ _t34 = _t33 & 0x00000001u;
         /* 021E42E8 */ if (_t34) goto L_021E42EC; else goto L_021E42F4;
   L_021E42EC: ; // 0x21e42ec
@@ -4280,9 +4280,9 @@ void Gambit_fn_021E41B8(CPUState* cpu) {
         /* 021E42F8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 021E42F8 */ cpu->r[8] = _t35;
         /* 021E42FC */ cpu->r[6] = 0x101D0000u;
-        /* 021E4300 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021E4300 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021E4304 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 021E4308 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4308 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4308 */ _t37 = _t36 & 0x00000001u;
         /* 021E4308 */ if (_t37) goto L_021E430C; else goto L_021E4320;
   L_021E430C: ; // 0x21e430c
@@ -4315,18 +4315,18 @@ void Gambit_fn_021E433C(CPUState* cpu) {
         /* 021E4340 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021E4340 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021E4344 */ cpu->r[31] = cpu->r[3];
-        /* 021E4344 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021E4344 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021E4348 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021E4348 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021E434C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E434C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E434C */ _t4 = _t3 & 0x00000001u;
         /* 021E434C */ if (_t4) goto L_021E4350; else goto L_021E4360;
   L_021E4350: ; // 0x21e4350
         /* 021E4350 */ cpu->r[3] = 0x0000016Cu;
         /* 021E4354 */ Gambit_fn_02801A78(cpu);
         /* 021E4358 */ cpu->r[31] = cpu->r[3];
-        /* 021E4358 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E435C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4358 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E435C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E435C */ _t6 = _t5 & 0x00000001u;
         /* 021E435C */ if (_t6) goto L_021E4374; else goto L_021E4360;
   L_021E4360: ; // 0x21e4360
@@ -4439,8 +4439,8 @@ void Gambit_fn_021E43EC(CPUState* cpu) {
         /* 021E43EC */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E43EC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E43F0 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021E43F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E43F4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E43F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E43F4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E43F4 */ _t2 = _t1 & 0x00000001u;
         /* 021E43F4 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E43F4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -4462,8 +4462,8 @@ void Gambit_fn_021E4408(CPUState* cpu) {
         /* 021E4408 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E4408 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E440C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021E440C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E4410 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E440C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E4410 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4410 */ _t2 = _t1 & 0x00000001u;
         /* 021E4410 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E4410 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -4485,8 +4485,8 @@ void Gambit_fn_021E4424(CPUState* cpu) {
         /* 021E4424 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E4424 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E4428 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021E4428 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E442C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4428 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E442C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E442C */ _t2 = _t1 & 0x00000001u;
         /* 021E442C */ _t3 = _t2 ^ 0x00000001u;
         /* 021E442C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -4529,8 +4529,8 @@ void Gambit_fn_021E4450(CPUState* cpu) {
         /* 021E4460 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E4464 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021E4464 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021E4468 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021E446C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4468 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021E446C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E446C */ _t5 = _t4 & 0x00000001u;
         /* 021E446C */ if (_t5) goto L_021E4470; else goto L_021E448C;
   L_021E4470: ; // 0x21e4470
@@ -4569,8 +4569,8 @@ void Gambit_fn_021E4454(CPUState* cpu) {
         /* 021E4460 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E4464 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021E4464 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021E4468 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021E446C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4468 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021E446C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E446C */ _t5 = _t4 & 0x00000001u;
         /* 021E446C */ if (_t5) goto L_021E4470; else goto L_021E448C;
   L_021E4470: ; // 0x21e4470
@@ -5028,8 +5028,8 @@ void Gambit_fn_021E4664(CPUState* cpu) {
         /* 021E4664 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 021E4664 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E4668 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 021E4668 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E466C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4668 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E466C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E466C */ _t2 = _t1 & 0x00000001u;
         /* 021E466C */ if (_t2) goto L_021E467C; else goto L_021E4670;
   L_021E4670: ; // 0x21e4670
@@ -5058,8 +5058,8 @@ void Gambit_fn_021E4688(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -5275,9 +5275,9 @@ void Gambit_fn_021E475C(CPUState* cpu) {
         /* 021E4760 */ _t0 = cpu->r[8] + 0xFFFFFC6Cu;
         /* 021E4760 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 021E4764 */ cpu->r[6] = 0x101D0000u;
-        /* 021E4768 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021E4768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021E476C */ cpu->r[6] = cpu->r[6] + 0xFFFFFC70u;
-        /* 021E4770 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4770 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4770 */ _t2 = _t1 & 0x00000001u;
         /* 021E4770 */ if (_t2) goto L_021E4774; else goto L_021E478C;
   L_021E4774: ; // 0x21e4774
@@ -5290,8 +5290,8 @@ void Gambit_fn_021E475C(CPUState* cpu) {
         /* 021E4788 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 021E4788 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_021E478C: ; // 0x21e478c
-        /* 021E478C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 021E4790 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E478C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 021E4790 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4790 */ _t6 = _t5 & 0x00000001u;
         /* 021E4790 */ if (_t6) goto L_021E4794; else goto L_021E479C;
   L_021E4794: ; // 0x21e4794
@@ -5302,9 +5302,9 @@ void Gambit_fn_021E475C(CPUState* cpu) {
         /* 021E47A0 */ _t7 = cpu->r[10] + 0xFFFFE608u;
         /* 021E47A0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 021E47A4 */ cpu->r[8] = 0x101D0000u;
-        /* 021E47A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021E47A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021E47AC */ cpu->r[8] = cpu->r[8] + 0xFFFFFC64u;
-        /* 021E47B0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E47B0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E47B0 */ _t9 = _t8 & 0x00000001u;
         /* 021E47B0 */ if (_t9) goto L_021E47B4; else goto L_021E47CC;
   L_021E47B4: ; // 0x21e47b4
@@ -5317,8 +5317,8 @@ void Gambit_fn_021E475C(CPUState* cpu) {
         /* 021E47C8 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 021E47C8 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_021E47CC: ; // 0x21e47cc
-        /* 021E47CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021E47D0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E47CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021E47D0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E47D0 */ _t13 = _t12 & 0x00000001u;
         /* 021E47D0 */ if (_t13) goto L_021E47D4; else goto L_021E47DC;
   L_021E47D4: ; // 0x21e47d4
@@ -5329,9 +5329,9 @@ void Gambit_fn_021E475C(CPUState* cpu) {
         /* 021E47E0 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 021E47E0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 021E47E4 */ cpu->r[10] = 0x101D0000u;
-        /* 021E47E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021E47E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021E47EC */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 021E47F0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E47F0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E47F0 */ _t16 = _t15 & 0x00000001u;
         /* 021E47F0 */ if (_t16) goto L_021E47F4; else goto L_021E480C;
   L_021E47F4: ; // 0x21e47f4
@@ -5344,8 +5344,8 @@ void Gambit_fn_021E475C(CPUState* cpu) {
         /* 021E4808 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 021E4808 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_021E480C: ; // 0x21e480c
-        /* 021E480C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021E4810 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E480C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021E4810 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4810 */ _t20 = _t19 & 0x00000001u;
         /* 021E4810 */ if (_t20) goto L_021E4814; else goto L_021E481C;
   L_021E4814: ; // 0x21e4814
@@ -5356,9 +5356,9 @@ void Gambit_fn_021E475C(CPUState* cpu) {
         /* 021E4820 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021E4820 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021E4824 */ cpu->r[12] = 0x101D0000u;
-        /* 021E4828 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021E4828 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021E482C */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021E4830 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4830 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4830 */ _t23 = _t22 & 0x00000001u;
         /* 021E4830 */ if (_t23) goto L_021E4834; else goto L_021E484C;
   L_021E4834: ; // 0x21e4834
@@ -5371,8 +5371,8 @@ void Gambit_fn_021E475C(CPUState* cpu) {
         /* 021E4848 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 021E4848 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_021E484C: ; // 0x21e484c
-        /* 021E484C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021E4850 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E484C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021E4850 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4850 */ _t27 = _t26 & 0x00000001u;
         /* 021E4850 */ if (_t27) goto L_021E4854; else goto L_021E485C;
   L_021E4854: ; // 0x21e4854
@@ -5384,9 +5384,9 @@ void Gambit_fn_021E475C(CPUState* cpu) {
         /* 021E4860 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 021E4860 */ cpu->r[10] = _t28;
         /* 021E4864 */ cpu->r[7] = 0x101D0000u;
-        /* 021E4868 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021E4868 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021E486C */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 021E4870 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4870 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4870 */ _t30 = _t29 & 0x00000001u;
         /* 021E4870 */ if (_t30) goto L_021E4874; else goto L_021E4888;
   L_021E4874: ; // 0x21e4874
@@ -5398,8 +5398,8 @@ void Gambit_fn_021E475C(CPUState* cpu) {
         /* 021E4884 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 021E4884 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_021E4888: ; // 0x21e4888
-        /* 021E4888 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 021E488C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4888 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 021E488C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E488C */ _t34 = _t33 & 0x00000001u;
         /* 021E488C */ if (_t34) goto L_021E4890; else goto L_021E4898;
   L_021E4890: ; // 0x21e4890
@@ -5411,9 +5411,9 @@ void Gambit_fn_021E475C(CPUState* cpu) {
         /* 021E489C */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 021E489C */ cpu->r[8] = _t35;
         /* 021E48A0 */ cpu->r[6] = 0x101D0000u;
-        /* 021E48A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021E48A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021E48A8 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 021E48AC */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E48AC */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E48AC */ _t37 = _t36 & 0x00000001u;
         /* 021E48AC */ if (_t37) goto L_021E48B0; else goto L_021E48C4;
   L_021E48B0: ; // 0x21e48b0
@@ -5446,18 +5446,18 @@ void Gambit_fn_021E48E0(CPUState* cpu) {
         /* 021E48E4 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021E48E4 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021E48E8 */ cpu->r[31] = cpu->r[3];
-        /* 021E48E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021E48E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021E48EC */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021E48EC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021E48F0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E48F0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E48F0 */ _t4 = _t3 & 0x00000001u;
         /* 021E48F0 */ if (_t4) goto L_021E48F4; else goto L_021E4904;
   L_021E48F4: ; // 0x21e48f4
         /* 021E48F4 */ cpu->r[3] = 0x0000016Cu;
         /* 021E48F8 */ Gambit_fn_02801A78(cpu);
         /* 021E48FC */ cpu->r[31] = cpu->r[3];
-        /* 021E48FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E4900 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E48FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E4900 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4900 */ _t6 = _t5 & 0x00000001u;
         /* 021E4900 */ if (_t6) goto L_021E4918; else goto L_021E4904;
   L_021E4904: ; // 0x21e4904
@@ -5570,8 +5570,8 @@ void Gambit_fn_021E4990(CPUState* cpu) {
         /* 021E4990 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E4990 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E4994 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021E4994 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E4998 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4994 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E4998 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4998 */ _t2 = _t1 & 0x00000001u;
         /* 021E4998 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E4998 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -5593,8 +5593,8 @@ void Gambit_fn_021E49AC(CPUState* cpu) {
         /* 021E49AC */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E49AC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E49B0 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021E49B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E49B4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E49B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E49B4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E49B4 */ _t2 = _t1 & 0x00000001u;
         /* 021E49B4 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E49B4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -5616,8 +5616,8 @@ void Gambit_fn_021E49C8(CPUState* cpu) {
         /* 021E49C8 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E49C8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E49CC */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021E49CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E49D0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E49CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E49D0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E49D0 */ _t2 = _t1 & 0x00000001u;
         /* 021E49D0 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E49D0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -5660,8 +5660,8 @@ void Gambit_fn_021E49F4(CPUState* cpu) {
         /* 021E4A04 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E4A08 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021E4A08 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021E4A0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021E4A10 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4A0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021E4A10 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4A10 */ _t5 = _t4 & 0x00000001u;
         /* 021E4A10 */ if (_t5) goto L_021E4A14; else goto L_021E4A30;
   L_021E4A14: ; // 0x21e4a14
@@ -5700,8 +5700,8 @@ void Gambit_fn_021E49F8(CPUState* cpu) {
         /* 021E4A04 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E4A08 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021E4A08 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021E4A0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021E4A10 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4A0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021E4A10 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4A10 */ _t5 = _t4 & 0x00000001u;
         /* 021E4A10 */ if (_t5) goto L_021E4A14; else goto L_021E4A30;
   L_021E4A14: ; // 0x21e4a14
@@ -6159,8 +6159,8 @@ void Gambit_fn_021E4C08(CPUState* cpu) {
         /* 021E4C08 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 021E4C08 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E4C0C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 021E4C0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E4C10 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4C0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E4C10 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4C10 */ _t2 = _t1 & 0x00000001u;
         /* 021E4C10 */ if (_t2) goto L_021E4C20; else goto L_021E4C14;
   L_021E4C14: ; // 0x21e4c14
@@ -6189,8 +6189,8 @@ void Gambit_fn_021E4C2C(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -6406,9 +6406,9 @@ void Gambit_fn_021E4D00(CPUState* cpu) {
         /* 021E4D04 */ _t0 = cpu->r[8] + 0xFFFFFC74u;
         /* 021E4D04 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 021E4D08 */ cpu->r[6] = 0x101D0000u;
-        /* 021E4D0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021E4D0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021E4D10 */ cpu->r[6] = cpu->r[6] + 0xFFFFFC78u;
-        /* 021E4D14 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4D14 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4D14 */ _t2 = _t1 & 0x00000001u;
         /* 021E4D14 */ if (_t2) goto L_021E4D18; else goto L_021E4D30;
   L_021E4D18: ; // 0x21e4d18
@@ -6421,8 +6421,8 @@ void Gambit_fn_021E4D00(CPUState* cpu) {
         /* 021E4D2C */ _t4 = cpu->r[6] + 0x00000000u;
         /* 021E4D2C */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_021E4D30: ; // 0x21e4d30
-        /* 021E4D30 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 021E4D34 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4D30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 021E4D34 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4D34 */ _t6 = _t5 & 0x00000001u;
         /* 021E4D34 */ if (_t6) goto L_021E4D38; else goto L_021E4D40;
   L_021E4D38: ; // 0x21e4d38
@@ -6433,9 +6433,9 @@ void Gambit_fn_021E4D00(CPUState* cpu) {
         /* 021E4D44 */ _t7 = cpu->r[10] + 0xFFFFE608u;
         /* 021E4D44 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 021E4D48 */ cpu->r[8] = 0x101D0000u;
-        /* 021E4D4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021E4D4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021E4D50 */ cpu->r[8] = cpu->r[8] + 0xFFFFFC64u;
-        /* 021E4D54 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4D54 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4D54 */ _t9 = _t8 & 0x00000001u;
         /* 021E4D54 */ if (_t9) goto L_021E4D58; else goto L_021E4D70;
   L_021E4D58: ; // 0x21e4d58
@@ -6448,8 +6448,8 @@ void Gambit_fn_021E4D00(CPUState* cpu) {
         /* 021E4D6C */ _t11 = cpu->r[8] + 0x00000000u;
         /* 021E4D6C */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_021E4D70: ; // 0x21e4d70
-        /* 021E4D70 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021E4D74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4D70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021E4D74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4D74 */ _t13 = _t12 & 0x00000001u;
         /* 021E4D74 */ if (_t13) goto L_021E4D78; else goto L_021E4D80;
   L_021E4D78: ; // 0x21e4d78
@@ -6460,9 +6460,9 @@ void Gambit_fn_021E4D00(CPUState* cpu) {
         /* 021E4D84 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 021E4D84 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 021E4D88 */ cpu->r[10] = 0x101D0000u;
-        /* 021E4D8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021E4D8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021E4D90 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 021E4D94 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4D94 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4D94 */ _t16 = _t15 & 0x00000001u;
         /* 021E4D94 */ if (_t16) goto L_021E4D98; else goto L_021E4DB0;
   L_021E4D98: ; // 0x21e4d98
@@ -6475,8 +6475,8 @@ void Gambit_fn_021E4D00(CPUState* cpu) {
         /* 021E4DAC */ _t18 = cpu->r[10] + 0x00000000u;
         /* 021E4DAC */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_021E4DB0: ; // 0x21e4db0
-        /* 021E4DB0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021E4DB4 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4DB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021E4DB4 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4DB4 */ _t20 = _t19 & 0x00000001u;
         /* 021E4DB4 */ if (_t20) goto L_021E4DB8; else goto L_021E4DC0;
   L_021E4DB8: ; // 0x21e4db8
@@ -6487,9 +6487,9 @@ void Gambit_fn_021E4D00(CPUState* cpu) {
         /* 021E4DC4 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021E4DC4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021E4DC8 */ cpu->r[12] = 0x101D0000u;
-        /* 021E4DCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021E4DCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021E4DD0 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021E4DD4 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4DD4 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4DD4 */ _t23 = _t22 & 0x00000001u;
         /* 021E4DD4 */ if (_t23) goto L_021E4DD8; else goto L_021E4DF0;
   L_021E4DD8: ; // 0x21e4dd8
@@ -6502,8 +6502,8 @@ void Gambit_fn_021E4D00(CPUState* cpu) {
         /* 021E4DEC */ _t25 = cpu->r[12] + 0x00000000u;
         /* 021E4DEC */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_021E4DF0: ; // 0x21e4df0
-        /* 021E4DF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021E4DF4 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4DF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021E4DF4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4DF4 */ _t27 = _t26 & 0x00000001u;
         /* 021E4DF4 */ if (_t27) goto L_021E4DF8; else goto L_021E4E00;
   L_021E4DF8: ; // 0x21e4df8
@@ -6515,9 +6515,9 @@ void Gambit_fn_021E4D00(CPUState* cpu) {
         /* 021E4E04 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 021E4E04 */ cpu->r[10] = _t28;
         /* 021E4E08 */ cpu->r[7] = 0x101D0000u;
-        /* 021E4E0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021E4E0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021E4E10 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 021E4E14 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4E14 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4E14 */ _t30 = _t29 & 0x00000001u;
         /* 021E4E14 */ if (_t30) goto L_021E4E18; else goto L_021E4E2C;
   L_021E4E18: ; // 0x21e4e18
@@ -6529,8 +6529,8 @@ void Gambit_fn_021E4D00(CPUState* cpu) {
         /* 021E4E28 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 021E4E28 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_021E4E2C: ; // 0x21e4e2c
-        /* 021E4E2C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 021E4E30 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4E2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 021E4E30 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4E30 */ _t34 = _t33 & 0x00000001u;
         /* 021E4E30 */ if (_t34) goto L_021E4E34; else goto L_021E4E3C;
   L_021E4E34: ; // 0x21e4e34
@@ -6542,9 +6542,9 @@ void Gambit_fn_021E4D00(CPUState* cpu) {
         /* 021E4E40 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 021E4E40 */ cpu->r[8] = _t35;
         /* 021E4E44 */ cpu->r[6] = 0x101D0000u;
-        /* 021E4E48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021E4E48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021E4E4C */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 021E4E50 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4E50 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4E50 */ _t37 = _t36 & 0x00000001u;
         /* 021E4E50 */ if (_t37) goto L_021E4E54; else goto L_021E4E68;
   L_021E4E54: ; // 0x21e4e54
@@ -6577,18 +6577,18 @@ void Gambit_fn_021E4E84(CPUState* cpu) {
         /* 021E4E88 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021E4E88 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021E4E8C */ cpu->r[31] = cpu->r[3];
-        /* 021E4E8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021E4E8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021E4E90 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021E4E90 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021E4E94 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4E94 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4E94 */ _t4 = _t3 & 0x00000001u;
         /* 021E4E94 */ if (_t4) goto L_021E4E98; else goto L_021E4EA8;
   L_021E4E98: ; // 0x21e4e98
         /* 021E4E98 */ cpu->r[3] = 0x0000016Cu;
         /* 021E4E9C */ Gambit_fn_02801A78(cpu);
         /* 021E4EA0 */ cpu->r[31] = cpu->r[3];
-        /* 021E4EA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E4EA4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4EA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E4EA4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4EA4 */ _t6 = _t5 & 0x00000001u;
         /* 021E4EA4 */ if (_t6) goto L_021E4EBC; else goto L_021E4EA8;
   L_021E4EA8: ; // 0x21e4ea8
@@ -6701,8 +6701,8 @@ void Gambit_fn_021E4F34(CPUState* cpu) {
         /* 021E4F34 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E4F34 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E4F38 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021E4F38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E4F3C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4F38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E4F3C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4F3C */ _t2 = _t1 & 0x00000001u;
         /* 021E4F3C */ _t3 = _t2 ^ 0x00000001u;
         /* 021E4F3C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -6724,8 +6724,8 @@ void Gambit_fn_021E4F50(CPUState* cpu) {
         /* 021E4F50 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E4F50 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E4F54 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021E4F54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E4F58 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4F54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E4F58 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4F58 */ _t2 = _t1 & 0x00000001u;
         /* 021E4F58 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E4F58 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -6747,8 +6747,8 @@ void Gambit_fn_021E4F6C(CPUState* cpu) {
         /* 021E4F6C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E4F6C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E4F70 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021E4F70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E4F74 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4F70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E4F74 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4F74 */ _t2 = _t1 & 0x00000001u;
         /* 021E4F74 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E4F74 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -6791,8 +6791,8 @@ void Gambit_fn_021E4F98(CPUState* cpu) {
         /* 021E4FA8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E4FAC */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021E4FAC */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021E4FB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021E4FB4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4FB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021E4FB4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4FB4 */ _t5 = _t4 & 0x00000001u;
         /* 021E4FB4 */ if (_t5) goto L_021E4FB8; else goto L_021E4FD4;
   L_021E4FB8: ; // 0x21e4fb8
@@ -6831,8 +6831,8 @@ void Gambit_fn_021E4F9C(CPUState* cpu) {
         /* 021E4FA8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E4FAC */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021E4FAC */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021E4FB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021E4FB4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E4FB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021E4FB4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E4FB4 */ _t5 = _t4 & 0x00000001u;
         /* 021E4FB4 */ if (_t5) goto L_021E4FB8; else goto L_021E4FD4;
   L_021E4FB8: ; // 0x21e4fb8
@@ -7290,8 +7290,8 @@ void Gambit_fn_021E51AC(CPUState* cpu) {
         /* 021E51AC */ _t0 = cpu->r[3] + 0x00000114u;
         /* 021E51AC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E51B0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 021E51B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E51B4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E51B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E51B4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E51B4 */ _t2 = _t1 & 0x00000001u;
         /* 021E51B4 */ if (_t2) goto L_021E51C4; else goto L_021E51B8;
   L_021E51B8: ; // 0x21e51b8
@@ -7320,8 +7320,8 @@ void Gambit_fn_021E51D0(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -7537,9 +7537,9 @@ void Gambit_fn_021E52A4(CPUState* cpu) {
         /* 021E52A8 */ _t0 = cpu->r[8] + 0xFFFFFC7Cu;
         /* 021E52A8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 021E52AC */ cpu->r[6] = 0x101D0000u;
-        /* 021E52B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021E52B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021E52B4 */ cpu->r[6] = cpu->r[6] + 0xFFFFFC80u;
-        /* 021E52B8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E52B8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E52B8 */ _t2 = _t1 & 0x00000001u;
         /* 021E52B8 */ if (_t2) goto L_021E52BC; else goto L_021E52D4;
   L_021E52BC: ; // 0x21e52bc
@@ -7552,8 +7552,8 @@ void Gambit_fn_021E52A4(CPUState* cpu) {
         /* 021E52D0 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 021E52D0 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_021E52D4: ; // 0x21e52d4
-        /* 021E52D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 021E52D8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E52D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 021E52D8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E52D8 */ _t6 = _t5 & 0x00000001u;
         /* 021E52D8 */ if (_t6) goto L_021E52DC; else goto L_021E52E4;
   L_021E52DC: ; // 0x21e52dc
@@ -7564,9 +7564,9 @@ void Gambit_fn_021E52A4(CPUState* cpu) {
         /* 021E52E8 */ _t7 = cpu->r[10] + 0xFFFFE608u;
         /* 021E52E8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 021E52EC */ cpu->r[8] = 0x101D0000u;
-        /* 021E52F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021E52F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021E52F4 */ cpu->r[8] = cpu->r[8] + 0xFFFFFC64u;
-        /* 021E52F8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E52F8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E52F8 */ _t9 = _t8 & 0x00000001u;
         /* 021E52F8 */ if (_t9) goto L_021E52FC; else goto L_021E5314;
   L_021E52FC: ; // 0x21e52fc
@@ -7579,8 +7579,8 @@ void Gambit_fn_021E52A4(CPUState* cpu) {
         /* 021E5310 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 021E5310 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_021E5314: ; // 0x21e5314
-        /* 021E5314 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021E5318 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E5314 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021E5318 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E5318 */ _t13 = _t12 & 0x00000001u;
         /* 021E5318 */ if (_t13) goto L_021E531C; else goto L_021E5324;
   L_021E531C: ; // 0x21e531c
@@ -7591,9 +7591,9 @@ void Gambit_fn_021E52A4(CPUState* cpu) {
         /* 021E5328 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 021E5328 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 021E532C */ cpu->r[10] = 0x101D0000u;
-        /* 021E5330 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021E5330 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021E5334 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 021E5338 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E5338 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E5338 */ _t16 = _t15 & 0x00000001u;
         /* 021E5338 */ if (_t16) goto L_021E533C; else goto L_021E5354;
   L_021E533C: ; // 0x21e533c
@@ -7606,8 +7606,8 @@ void Gambit_fn_021E52A4(CPUState* cpu) {
         /* 021E5350 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 021E5350 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_021E5354: ; // 0x21e5354
-        /* 021E5354 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021E5358 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E5354 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021E5358 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E5358 */ _t20 = _t19 & 0x00000001u;
         /* 021E5358 */ if (_t20) goto L_021E535C; else goto L_021E5364;
   L_021E535C: ; // 0x21e535c
@@ -7618,9 +7618,9 @@ void Gambit_fn_021E52A4(CPUState* cpu) {
         /* 021E5368 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021E5368 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021E536C */ cpu->r[12] = 0x101D0000u;
-        /* 021E5370 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021E5370 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021E5374 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021E5378 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E5378 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E5378 */ _t23 = _t22 & 0x00000001u;
         /* 021E5378 */ if (_t23) goto L_021E537C; else goto L_021E5394;
   L_021E537C: ; // 0x21e537c
@@ -7633,8 +7633,8 @@ void Gambit_fn_021E52A4(CPUState* cpu) {
         /* 021E5390 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 021E5390 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_021E5394: ; // 0x21e5394
-        /* 021E5394 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021E5398 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E5394 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021E5398 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E5398 */ _t27 = _t26 & 0x00000001u;
         /* 021E5398 */ if (_t27) goto L_021E539C; else goto L_021E53A4;
   L_021E539C: ; // 0x21e539c
@@ -7646,9 +7646,9 @@ void Gambit_fn_021E52A4(CPUState* cpu) {
         /* 021E53A8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 021E53A8 */ cpu->r[10] = _t28;
         /* 021E53AC */ cpu->r[7] = 0x101D0000u;
-        /* 021E53B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021E53B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021E53B4 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 021E53B8 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E53B8 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E53B8 */ _t30 = _t29 & 0x00000001u;
         /* 021E53B8 */ if (_t30) goto L_021E53BC; else goto L_021E53D0;
   L_021E53BC: ; // 0x21e53bc
@@ -7660,8 +7660,8 @@ void Gambit_fn_021E52A4(CPUState* cpu) {
         /* 021E53CC */ _t32 = cpu->r[7] + 0x00000000u;
         /* 021E53CC */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_021E53D0: ; // 0x21e53d0
-        /* 021E53D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 021E53D4 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E53D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 021E53D4 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E53D4 */ _t34 = _t33 & 0x00000001u;
         /* 021E53D4 */ if (_t34) goto L_021E53D8; else goto L_021E53E0;
   L_021E53D8: ; // 0x21e53d8
@@ -7673,9 +7673,9 @@ void Gambit_fn_021E52A4(CPUState* cpu) {
         /* 021E53E4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 021E53E4 */ cpu->r[8] = _t35;
         /* 021E53E8 */ cpu->r[6] = 0x101D0000u;
-        /* 021E53EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021E53EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021E53F0 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 021E53F4 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E53F4 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E53F4 */ _t37 = _t36 & 0x00000001u;
         /* 021E53F4 */ if (_t37) goto L_021E53F8; else goto L_021E540C;
   L_021E53F8: ; // 0x21e53f8
@@ -7708,18 +7708,18 @@ void Gambit_fn_021E5428(CPUState* cpu) {
         /* 021E542C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021E542C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021E5430 */ cpu->r[31] = cpu->r[3];
-        /* 021E5430 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021E5430 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021E5434 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021E5434 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021E5438 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E5438 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E5438 */ _t4 = _t3 & 0x00000001u;
         /* 021E5438 */ if (_t4) goto L_021E543C; else goto L_021E544C;
   L_021E543C: ; // 0x21e543c
         /* 021E543C */ cpu->r[3] = 0x0000016Cu;
         /* 021E5440 */ Gambit_fn_02801A78(cpu);
         /* 021E5444 */ cpu->r[31] = cpu->r[3];
-        /* 021E5444 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E5448 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E5444 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E5448 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E5448 */ _t6 = _t5 & 0x00000001u;
         /* 021E5448 */ if (_t6) goto L_021E5460; else goto L_021E544C;
   L_021E544C: ; // 0x21e544c
@@ -7832,8 +7832,8 @@ void Gambit_fn_021E54D8(CPUState* cpu) {
         /* 021E54D8 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E54D8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E54DC */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021E54DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E54E0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E54DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E54E0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E54E0 */ _t2 = _t1 & 0x00000001u;
         /* 021E54E0 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E54E0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -7855,8 +7855,8 @@ void Gambit_fn_021E54F4(CPUState* cpu) {
         /* 021E54F4 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E54F4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E54F8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021E54F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E54FC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E54F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E54FC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E54FC */ _t2 = _t1 & 0x00000001u;
         /* 021E54FC */ _t3 = _t2 ^ 0x00000001u;
         /* 021E54FC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -7878,8 +7878,8 @@ void Gambit_fn_021E5510(CPUState* cpu) {
         /* 021E5510 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E5510 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E5514 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021E5514 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E5518 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E5514 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E5518 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E5518 */ _t2 = _t1 & 0x00000001u;
         /* 021E5518 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E5518 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -7922,8 +7922,8 @@ void Gambit_fn_021E553C(CPUState* cpu) {
         /* 021E554C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E5550 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021E5550 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021E5554 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021E5558 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E5554 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021E5558 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E5558 */ _t5 = _t4 & 0x00000001u;
         /* 021E5558 */ if (_t5) goto L_021E555C; else goto L_021E5578;
   L_021E555C: ; // 0x21e555c
@@ -7962,8 +7962,8 @@ void Gambit_fn_021E5540(CPUState* cpu) {
         /* 021E554C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E5550 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021E5550 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021E5554 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021E5558 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E5554 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021E5558 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E5558 */ _t5 = _t4 & 0x00000001u;
         /* 021E5558 */ if (_t5) goto L_021E555C; else goto L_021E5578;
   L_021E555C: ; // 0x21e555c
@@ -375,8 +375,8 @@ void Gambit_fn_021E5750(CPUState* cpu) {
         /* 021E5750 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 021E5750 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E5754 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 021E5754 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E5758 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E5754 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E5758 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E5758 */ _t2 = _t1 & 0x00000001u;
         /* 021E5758 */ if (_t2) goto L_021E5768; else goto L_021E575C;
   L_021E575C: ; // 0x21e575c
@@ -405,8 +405,8 @@ void Gambit_fn_021E5774(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -622,9 +622,9 @@ void Gambit_fn_021E5848(CPUState* cpu) {
         /* 021E584C */ _t0 = cpu->r[8] + 0xFFFFFC84u;
         /* 021E584C */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 021E5850 */ cpu->r[6] = 0x101D0000u;
-        /* 021E5854 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021E5854 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021E5858 */ cpu->r[6] = cpu->r[6] + 0xFFFFFC88u;
-        /* 021E585C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E585C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E585C */ _t2 = _t1 & 0x00000001u;
         /* 021E585C */ if (_t2) goto L_021E5860; else goto L_021E5878;
   L_021E5860: ; // 0x21e5860
@@ -637,8 +637,8 @@ void Gambit_fn_021E5848(CPUState* cpu) {
         /* 021E5874 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 021E5874 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_021E5878: ; // 0x21e5878
-        /* 021E5878 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 021E587C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E5878 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 021E587C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E587C */ _t6 = _t5 & 0x00000001u;
         /* 021E587C */ if (_t6) goto L_021E5880; else goto L_021E5888;
   L_021E5880: ; // 0x21e5880
@@ -649,9 +649,9 @@ void Gambit_fn_021E5848(CPUState* cpu) {
         /* 021E588C */ _t7 = cpu->r[10] + 0xFFFFE608u;
         /* 021E588C */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 021E5890 */ cpu->r[8] = 0x101D0000u;
-        /* 021E5894 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021E5894 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021E5898 */ cpu->r[8] = cpu->r[8] + 0xFFFFFC64u;
-        /* 021E589C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E589C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E589C */ _t9 = _t8 & 0x00000001u;
         /* 021E589C */ if (_t9) goto L_021E58A0; else goto L_021E58B8;
   L_021E58A0: ; // 0x21e58a0
@@ -664,8 +664,8 @@ void Gambit_fn_021E5848(CPUState* cpu) {
         /* 021E58B4 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 021E58B4 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_021E58B8: ; // 0x21e58b8
-        /* 021E58B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021E58BC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E58B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021E58BC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E58BC */ _t13 = _t12 & 0x00000001u;
         /* 021E58BC */ if (_t13) goto L_021E58C0; else goto L_021E58C8;
   L_021E58C0: ; // 0x21e58c0
@@ -676,9 +676,9 @@ void Gambit_fn_021E5848(CPUState* cpu) {
         /* 021E58CC */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 021E58CC */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 021E58D0 */ cpu->r[10] = 0x101D0000u;
-        /* 021E58D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021E58D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021E58D8 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 021E58DC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E58DC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E58DC */ _t16 = _t15 & 0x00000001u;
         /* 021E58DC */ if (_t16) goto L_021E58E0; else goto L_021E58F8;
   L_021E58E0: ; // 0x21e58e0
@@ -691,8 +691,8 @@ void Gambit_fn_021E5848(CPUState* cpu) {
         /* 021E58F4 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 021E58F4 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_021E58F8: ; // 0x21e58f8
-        /* 021E58F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021E58FC */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E58F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021E58FC */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E58FC */ _t20 = _t19 & 0x00000001u;
         /* 021E58FC */ if (_t20) goto L_021E5900; else goto L_021E5908;
   L_021E5900: ; // 0x21e5900
@@ -703,9 +703,9 @@ void Gambit_fn_021E5848(CPUState* cpu) {
         /* 021E590C */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021E590C */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021E5910 */ cpu->r[12] = 0x101D0000u;
-        /* 021E5914 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021E5914 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021E5918 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021E591C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E591C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E591C */ _t23 = _t22 & 0x00000001u;
         /* 021E591C */ if (_t23) goto L_021E5920; else goto L_021E5938;
   L_021E5920: ; // 0x21e5920
@@ -718,8 +718,8 @@ void Gambit_fn_021E5848(CPUState* cpu) {
         /* 021E5934 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 021E5934 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_021E5938: ; // 0x21e5938
-        /* 021E5938 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021E593C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E5938 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021E593C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E593C */ _t27 = _t26 & 0x00000001u;
         /* 021E593C */ if (_t27) goto L_021E5940; else goto L_021E5948;
   L_021E5940: ; // 0x21e5940
@@ -731,9 +731,9 @@ void Gambit_fn_021E5848(CPUState* cpu) {
         /* 021E594C */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 021E594C */ cpu->r[10] = _t28;
         /* 021E5950 */ cpu->r[7] = 0x101D0000u;
-        /* 021E5954 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021E5954 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021E5958 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 021E595C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E595C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E595C */ _t30 = _t29 & 0x00000001u;
         /* 021E595C */ if (_t30) goto L_021E5960; else goto L_021E5974;
   L_021E5960: ; // 0x21e5960
@@ -745,8 +745,8 @@ void Gambit_fn_021E5848(CPUState* cpu) {
         /* 021E5970 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 021E5970 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_021E5974: ; // 0x21e5974
-        /* 021E5974 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 021E5978 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E5974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 021E5978 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E5978 */ _t34 = _t33 & 0x00000001u;
         /* 021E5978 */ if (_t34) goto L_021E597C; else goto L_021E5984;
   L_021E597C: ; // 0x21e597c
@@ -758,9 +758,9 @@ void Gambit_fn_021E5848(CPUState* cpu) {
         /* 021E5988 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 021E5988 */ cpu->r[8] = _t35;
         /* 021E598C */ cpu->r[6] = 0x101D0000u;
-        /* 021E5990 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021E5990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021E5994 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 021E5998 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E5998 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E5998 */ _t37 = _t36 & 0x00000001u;
         /* 021E5998 */ if (_t37) goto L_021E599C; else goto L_021E59B0;
   L_021E599C: ; // 0x21e599c
@@ -793,18 +793,18 @@ void Gambit_fn_021E59CC(CPUState* cpu) {
         /* 021E59D0 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021E59D0 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021E59D4 */ cpu->r[31] = cpu->r[3];
-        /* 021E59D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021E59D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021E59D8 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021E59D8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021E59DC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E59DC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E59DC */ _t4 = _t3 & 0x00000001u;
         /* 021E59DC */ if (_t4) goto L_021E59E0; else goto L_021E59F0;
   L_021E59E0: ; // 0x21e59e0
         /* 021E59E0 */ cpu->r[3] = 0x0000017Cu;
         /* 021E59E4 */ Gambit_fn_02801A78(cpu);
         /* 021E59E8 */ cpu->r[31] = cpu->r[3];
-        /* 021E59E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E59EC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E59E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E59EC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E59EC */ _t6 = _t5 & 0x00000001u;
         /* 021E59EC */ if (_t6) goto L_021E5A48; else goto L_021E59F0;
   L_021E59F0: ; // 0x21e59f0
@@ -813,10 +813,10 @@ void Gambit_fn_021E59CC(CPUState* cpu) {
         /* 021E59F8 */ cpu->r[0] = 0x10030000u;
         /* 021E59FC */ cpu->r[0] = cpu->r[0] + 0x000053BCu;
         /* 021E5A00 */ cpu->r[12] = cpu->r[31] + 0x00000128u;
-        /* 021E5A00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021E5A00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021E5A04 */ _t7 = cpu->r[31] + 0x00000004u;
         /* 021E5A04 */ rbrew_write32(cpu->mem, _t7, cpu->r[0]);
-        /* 021E5A08 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E5A08 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E5A08 */ _t9 = _t8 & 0x00000001u;
         /* 021E5A08 */ if (_t9) goto L_021E5A0C; else goto L_021E5A14;
   L_021E5A0C: ; // 0x21e5a0c
@@ -824,8 +824,8 @@ void Gambit_fn_021E59CC(CPUState* cpu) {
         /* 021E5A10 */ Gambit_fn_02801A78(cpu);
   L_021E5A14: ; // 0x21e5a14
         /* 021E5A14 */ cpu->r[0] = cpu->r[31] + 0x00000158u;
-        /* 021E5A14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E5A18 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E5A14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E5A18 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E5A18 */ _t11 = _t10 & 0x00000001u;
         /* 021E5A18 */ if (_t11) goto L_021E5A1C; else goto L_021E5A24;
   L_021E5A1C: ; // 0x21e5a1c
@@ -867,8 +867,8 @@ void Gambit_fn_021E5A60(CPUState* cpu) {
         /* 021E5A60 */ cpu->r[12] = 0x10030000u;
         /* 021E5A64 */ _t0 = cpu->r[12] + 0x00005328u;
         /* 021E5A64 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t0);
-        /* 021E5A68 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[13]);
-        /* 021E5A6C */ _t1 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E5A68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[13]));
+        /* 021E5A6C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E5A6C */ _t2 = _t1 & 0x00000001u;
         /* 021E5A6C */ if (_t2) goto L_021E5A78; else goto L_021E5A70;
   L_021E5A70: ; // 0x21e5a70
@@ -878,8 +878,8 @@ void Gambit_fn_021E5A60(CPUState* cpu) {
         /* 021E5A78 */ cpu->r[12] = 0x10030000u;
         /* 021E5A7C */ _t3 = cpu->r[12] + 0x00005334u;
         /* 021E5A7C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t3);
-        /* 021E5A80 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[10]);
-        /* 021E5A84 */ _t4 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E5A80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[10]));
+        /* 021E5A84 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E5A84 */ _t5 = _t4 & 0x00000001u;
         /* 021E5A84 */ if (_t5) goto L_021E5A94; else goto L_021E5A88;
   L_021E5A88: ; // 0x21e5a88
@@ -1146,18 +1146,18 @@ void Gambit_fn_021E5B88(CPUState* cpu) {
         /* 021E5C08 */ cpu->r[0] = rbrew_read32(cpu->mem, _t16);
         /* 021E5C0C */ _t17 = cpu->r[1] + 0x0000003Cu;
         /* 021E5C0C */ rbrew_write8(cpu->mem, _t17, (uint8_t)cpu->r[25]);
-        /* 021E5C10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000007u);
+        /* 021E5C10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000007u));
         /* 021E5C14 */ _t18 = cpu->r[1] + 0x00000038u;
         /* 021E5C14 */ rbrew_write32(cpu->mem, _t18, cpu->r[0]);
-        /* 021E5C18 */ _t19 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E5C18 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E5C18 */ _t20 = _t19 & 0x00000001u;
         /* 021E5C18 */ if (_t20) goto L_021E5C1C; else goto L_021E5C24;
   L_021E5C1C: ; // 0x21e5c1c
         /* 021E5C1C */ cpu->r[31] = 0x00000007u;
         /* 021E5C20 */ goto L_021E5C30;
   L_021E5C24: ; // 0x21e5c24
-        /* 021E5C24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000064u);
-        /* 021E5C28 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E5C24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000064u));
+        /* 021E5C28 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E5C28 */ _t22 = _t21 & 0x00000001u;
         /* 021E5C28 */ if (_t22) goto L_021E5C2C; else goto L_021E5C30;
   L_021E5C2C: ; // 0x21e5c2c
@@ -1304,7 +1304,7 @@ void Gambit_fn_021E5B88(CPUState* cpu) {
         /* 021E5D80 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t75);
         /* 021E5D84 */ _t76 = cpu->r[1] + 0x00000088u;
         /* 021E5D84 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t76);
-        /* 021E5D88 */ _t77 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E5D88 */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E5D88 */ _t78 = _t77 & 0x00000001u;
         /* 021E5D88 */ if (_t78) goto L_021E5D8C; // else: addr-0 trap, fall-through
   L_021E5D8C: ; // 0x21e5d8c
@@ -1361,18 +1361,18 @@ void Gambit_fn_021E5DC4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11;
 
   L_021E5DC4: ; // 0x21e5dc4
-        /* 021E5DC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000064u);
+        /* 021E5DC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000064u));
         /* 021E5DC8 */ cpu->r[0] = 0x00000064u;
         /* 021E5DCC */ _t0 = cpu->r[1] + 0xFFFFFFE8u;
         /* 021E5DCC */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 021E5DCC */ cpu->r[1] = _t0;
-        /* 021E5DD0 */ _t1 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E5DD0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E5DD0 */ _t2 = _t1 & 0x00000001u;
         /* 021E5DD0 */ if (_t2) goto L_021E5DE4; else goto L_021E5DD4;
   L_021E5DD4: ; // 0x21e5dd4
-        /* 021E5DD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000007u);
+        /* 021E5DD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000007u));
         /* 021E5DD8 */ cpu->r[0] = cpu->r[3];
-        /* 021E5DDC */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E5DDC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E5DDC */ _t4 = _t3 & 0x00000001u;
         /* 021E5DDC */ if (_t4) goto L_021E5DE0; else goto L_021E5DE4;
   L_021E5DE0: ; // 0x21e5de0
@@ -1414,13 +1414,13 @@ void Gambit_fn_021E5DCC(CPUState* cpu) {
         /* 021E5DCC */ _t0 = cpu->r[1] + 0xFFFFFFE8u;
         /* 021E5DCC */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 021E5DCC */ cpu->r[1] = _t0;
-        /* 021E5DD0 */ _t1 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E5DD0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E5DD0 */ _t2 = _t1 & 0x00000001u;
         /* 021E5DD0 */ if (_t2) goto L_021E5DE4; else goto L_021E5DD4;
   L_021E5DD4: ; // 0x21e5dd4
-        /* 021E5DD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000007u);
+        /* 021E5DD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000007u));
         /* 021E5DD8 */ cpu->r[0] = cpu->r[3];
-        /* 021E5DDC */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E5DDC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E5DDC */ _t4 = _t3 & 0x00000001u;
         /* 021E5DDC */ if (_t4) goto L_021E5DE0; else goto L_021E5DE4;
   L_021E5DE0: ; // 0x21e5de0
@@ -1474,9 +1474,9 @@ void Gambit_fn_021E5E30(CPUState* cpu) {
         /* 02055B2C */ cpu->r[11] = _t2;
         /* 02055B30 */ cpu->r[30] = 0x101E0000u;
         /* 02055B34 */ cpu->r[27] = cpu->r[3];
-        /* 02055B38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02055B38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02055B3C */ cpu->r[30] = cpu->r[30] + 0xFFFFA020u;
-        /* 02055B40 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02055B40 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02055B40 */ _t4 = _t3 & 0x00000001u;
         /* 02055B40 */ if (_t4) goto L_02055B58; else goto L_02055B44;
   L_02055B44: ; // 0x2055b44
@@ -1519,23 +1519,23 @@ void Gambit_fn_021E5E30(CPUState* cpu) {
         /* 02055BAC */ _t14 = cpu->r[7] + 0x00000000u;
         /* 02055BAC */ cpu->r[8] = rbrew_read8(cpu->mem, _t14);
         /* 02055BB0 */ cpu->r[0] = 0x00080000u;
-        /* 02055BB4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[31]);
+        /* 02055BB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[31]));
         /* 02055BB8 */ cpu->r[29] = 0x00000000u;
-        /* 02055BBC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02055BBC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02055BBC */ _t16 = _t15 & 0x00000001u;
         /* 02055BBC */ if (_t16) goto L_02055BE4; else goto L_02055BC0;
   L_02055BC0: ; // 0x2055bc0
         /* 02055BC0 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 02055BC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[0]);
+        /* 02055BC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[0]));
         /* 02055BC8 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02055BCC */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02055BCC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02055BCC */ _t18 = _t17 & 0x00000001u;
         /* 02055BCC */ if (_t18) goto L_02055BE0; else goto L_02055BD0;
   L_02055BD0: ; // 0x2055bd0
         /* 02055BD0 */ _t19 = cpu->r[7] + 0x00000000u;
         /* 02055BD0 */ cpu->r[9] = rbrew_read8(cpu->mem, _t19);
-        /* 02055BD4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[31]);
-        /* 02055BD8 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02055BD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[31]));
+        /* 02055BD8 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02055BD8 */ _t21 = _t20 & 0x00000001u;
         /* 02055BD8 */ if (_t21) goto L_02055BDC; else goto L_02055BC0;
   L_02055BDC: ; // 0x2055bdc
@@ -1545,8 +1545,8 @@ void Gambit_fn_021E5E30(CPUState* cpu) {
   L_02055BE4: ; // 0x2055be4
         /* 02055BE4 */ _t22 = cpu->r[30] + 0x00000008u;
         /* 02055BE4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t22);
-        /* 02055BE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[9]);
-        /* 02055BEC */ _t23 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02055BE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[9]));
+        /* 02055BEC */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02055BEC */ _t24 = _t23 & 0x00000001u;
         /* 02055BEC */ if (_t24) goto L_02055BF4; else goto L_02055BF0;
   L_02055BF0: ; // 0x2055bf0
@@ -1632,9 +1632,9 @@ void Gambit_fn_021E5E40(CPUState* cpu) {
         /* 021E5E54 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 021E5E58 */ _t4 = cpu->r[3] + 0x00000168u;
         /* 021E5E58 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t4);
-        /* 021E5E5C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
+        /* 021E5E5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
         /* 021E5E60 */ cpu->r[31] = cpu->r[3];
-        /* 021E5E64 */ _t5 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E5E64 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E5E64 */ _t6 = _t5 & 0x00000001u;
         /* 021E5E64 */ if (_t6) goto L_021E5E68; else goto L_021E5EF0;
   L_021E5E68: ; // 0x21e5e68
@@ -1729,9 +1729,9 @@ void Gambit_fn_021E5E44(CPUState* cpu) {
         /* 021E5E54 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 021E5E58 */ _t4 = cpu->r[3] + 0x00000168u;
         /* 021E5E58 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t4);
-        /* 021E5E5C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
+        /* 021E5E5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
         /* 021E5E60 */ cpu->r[31] = cpu->r[3];
-        /* 021E5E64 */ _t5 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E5E64 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E5E64 */ _t6 = _t5 & 0x00000001u;
         /* 021E5E64 */ if (_t6) goto L_021E5E68; else goto L_021E5EF0;
   L_021E5E68: ; // 0x21e5e68
@@ -1826,9 +1826,9 @@ void Gambit_fn_021E5F10(CPUState* cpu) {
         /* 021E5F24 */ cpu->r[12] = 0x10030000u;
         /* 021E5F28 */ _t3 = cpu->r[12] + 0x00005358u;
         /* 021E5F28 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t3);
-        /* 021E5F2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 021E5F2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 021E5F30 */ cpu->f[12] = fma(cpu->f[13], cpu->f[1], cpu->f[13]);
-        /* 021E5F34 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E5F34 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E5F34 */ _t5 = _t4 & 0x00000001u;
         /* 021E5F34 */ if (_t5) goto L_021E5F48; else goto L_021E5F38;
   L_021E5F38: ; // 0x21e5f38
@@ -1864,9 +1864,9 @@ void Gambit_fn_021E5F18(CPUState* cpu) {
         /* 021E5F24 */ cpu->r[12] = 0x10030000u;
         /* 021E5F28 */ _t2 = cpu->r[12] + 0x00005358u;
         /* 021E5F28 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t2);
-        /* 021E5F2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 021E5F2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 021E5F30 */ cpu->f[12] = fma(cpu->f[13], cpu->f[1], cpu->f[13]);
-        /* 021E5F34 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E5F34 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E5F34 */ _t4 = _t3 & 0x00000001u;
         /* 021E5F34 */ if (_t4) goto L_021E5F48; else goto L_021E5F38;
   L_021E5F38: ; // 0x21e5f38
@@ -2026,24 +2026,24 @@ void Gambit_fn_021E5F98(CPUState* cpu) {
         /* 021E6070 */ _t26 = cpu->r[7] + 0x0000531Cu;
         /* 021E6070 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t26);
         /* 021E6074 */ cpu->f[12] = cpu->f[11] - cpu->f[13];
-        /* 021E6078 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[29]);
+        /* 021E6078 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[29]));
         /* 021E607C */ cpu->f[27] = (double)(float)cpu->f[12];
-        /* 021E6080 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E6080 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E6080 */ _t28 = _t27 & 0x00000001u;
         /* 021E6080 */ if (_t28) goto L_021E616C; else goto L_021E6084;
   L_021E6084: ; // 0x21e6084
-        /* 021E6084 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[27], cpu->f[28]);
-        /* 021E6088 */ _t29 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E6084 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[27], cpu->f[28]));
+        /* 021E6088 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E6088 */ _t30 = _t29 & 0x00000001u;
         /* 021E6088 */ if (_t30) goto L_021E608C; else goto L_021E623C;
   L_021E608C: ; // 0x21e608c
-        /* 021E608C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[27], cpu->f[29]);
-        /* 021E6090 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E608C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[27], cpu->f[29]));
+        /* 021E6090 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E6090 */ _t32 = _t31 & 0x00000001u;
         /* 021E6090 */ if (_t32) goto L_021E6094; else goto L_021E6174;
   L_021E6094: ; // 0x21e6094
-        /* 021E6094 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[28]);
-        /* 021E6098 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E6094 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[28]));
+        /* 021E6098 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E6098 */ _t34 = _t33 & 0x00000001u;
         /* 021E6098 */ if (_t34) goto L_021E60AC; else goto L_021E609C;
   L_021E609C: ; // 0x21e609c
@@ -2118,16 +2118,16 @@ void Gambit_fn_021E5F98(CPUState* cpu) {
         /* 021E6150 */ cpu->f[10] = rbrew_read_f64(cpu->mem, _t56);
         /* 021E6154 */ cpu->f[31] = (double)(float)cpu->f[0];
         /* 021E6158 */ cpu->f[8] = cpu->f[7] - cpu->f[10];
-        /* 021E615C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[31]);
+        /* 021E615C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[31]));
         /* 021E6160 */ cpu->f[30] = (double)(float)cpu->f[8];
-        /* 021E6164 */ _t57 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E6164 */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E6164 */ _t58 = _t57 & 0x00000001u;
         /* 021E6164 */ if (_t58) goto L_021E6458; else goto L_021E6168;
   L_021E6168: ; // 0x21e6168
         /* 021E6168 */ goto L_021E63E0;
   L_021E616C: ; // 0x21e616c
-        /* 021E616C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[27], cpu->f[29]);
-        /* 021E6170 */ _t59 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E616C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[27], cpu->f[29]));
+        /* 021E6170 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E6170 */ _t60 = _t59 & 0x00000001u;
         /* 021E6170 */ if (_t60) goto L_021E6234; else goto L_021E6174;
   L_021E6174: ; // 0x21e6174
@@ -2197,16 +2197,16 @@ void Gambit_fn_021E5F98(CPUState* cpu) {
         /* 021E6218 */ cpu->f[10] = rbrew_read_f64(cpu->mem, _t82);
         /* 021E621C */ cpu->f[31] = (double)(float)cpu->f[0];
         /* 021E6220 */ cpu->f[8] = cpu->f[7] - cpu->f[10];
-        /* 021E6224 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[31]);
+        /* 021E6224 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[31]));
         /* 021E6228 */ cpu->f[30] = (double)(float)cpu->f[8];
-        /* 021E622C */ _t83 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E622C */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E622C */ _t84 = _t83 & 0x00000001u;
         /* 021E622C */ if (_t84) goto L_021E6458; else goto L_021E6230;
   L_021E6230: ; // 0x21e6230
         /* 021E6230 */ goto L_021E63E0;
   L_021E6234: ; // 0x21e6234
-        /* 021E6234 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[27], cpu->f[28]);
-        /* 021E6238 */ _t85 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E6234 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[27], cpu->f[28]));
+        /* 021E6238 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E6238 */ _t86 = _t85 & 0x00000001u;
         /* 021E6238 */ if (_t86) goto L_021E62FC; else goto L_021E623C;
   L_021E623C: ; // 0x21e623c
@@ -2276,17 +2276,17 @@ void Gambit_fn_021E5F98(CPUState* cpu) {
         /* 021E62E0 */ cpu->f[10] = rbrew_read_f64(cpu->mem, _t108);
         /* 021E62E4 */ cpu->f[31] = (double)(float)cpu->f[0];
         /* 021E62E8 */ cpu->f[8] = cpu->f[7] - cpu->f[10];
-        /* 021E62EC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[31]);
+        /* 021E62EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[31]));
         /* 021E62F0 */ cpu->f[30] = (double)(float)cpu->f[8];
-        /* 021E62F4 */ _t109 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E62F4 */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E62F4 */ _t110 = _t109 & 0x00000001u;
         /* 021E62F4 */ if (_t110) goto L_021E6458; else goto L_021E62F8;
   L_021E62F8: ; // 0x21e62f8
         /* 021E62F8 */ goto L_021E63E0;
   L_021E62FC: ; // 0x21e62fc
         /* 021E62FC */ cpu->f[13] = -cpu->f[29];
-        /* 021E6300 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[28]);
-        /* 021E6304 */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E6300 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[28]));
+        /* 021E6304 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E6304 */ _t112 = _t111 & 0x00000001u;
         /* 021E6304 */ if (_t112) goto L_021E6308; else goto L_021E6310;
   L_021E6308: ; // 0x21e6308
@@ -2365,24 +2365,24 @@ void Gambit_fn_021E5F98(CPUState* cpu) {
         /* 021E63C8 */ cpu->f[10] = rbrew_read_f64(cpu->mem, _t134);
         /* 021E63CC */ cpu->f[31] = (double)(float)cpu->f[0];
         /* 021E63D0 */ cpu->f[8] = cpu->f[7] - cpu->f[10];
-        /* 021E63D4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[31]);
+        /* 021E63D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[31]));
         /* 021E63D8 */ cpu->f[30] = (double)(float)cpu->f[8];
-        /* 021E63DC */ _t135 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E63DC */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E63DC */ _t136 = _t135 & 0x00000001u;
         /* 021E63DC */ if (_t136) goto L_021E6458; else goto L_021E63E0;
   L_021E63E0: ; // 0x21e63e0
-        /* 021E63E0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[28]);
-        /* 021E63E4 */ _t137 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E63E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[28]));
+        /* 021E63E4 */ _t137 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E63E4 */ _t138 = _t137 & 0x00000001u;
         /* 021E63E4 */ if (_t138) goto L_021E63E8; else goto L_021E64B8;
   L_021E63E8: ; // 0x21e63e8
-        /* 021E63E8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
-        /* 021E63EC */ _t139 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E63E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
+        /* 021E63EC */ _t139 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E63EC */ _t140 = _t139 & 0x00000001u;
         /* 021E63EC */ if (_t140) goto L_021E63F0; else goto L_021E6460;
   L_021E63F0: ; // 0x21e63f0
-        /* 021E63F0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[28]);
-        /* 021E63F4 */ _t141 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E63F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[28]));
+        /* 021E63F4 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E63F4 */ _t142 = _t141 & 0x00000001u;
         /* 021E63F4 */ if (_t142) goto L_021E6408; else goto L_021E63F8;
   L_021E63F8: ; // 0x21e63f8
@@ -2416,16 +2416,16 @@ void Gambit_fn_021E5F98(CPUState* cpu) {
         /* 021E6440 */ cpu->r[6] = cpu->r[26] + cpu->r[12];
         /* 021E6444 */ _t151 = cpu->r[6] + 0x00000104u;
         /* 021E6444 */ cpu->r[4] = rbrew_read8(cpu->mem, _t151);
-        /* 021E6448 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 021E6448 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 021E644C */ cpu->r[6] = cpu->r[3];
-        /* 021E6450 */ _t152 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E6450 */ _t152 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E6450 */ _t153 = _t152 & 0x00000001u;
         /* 021E6450 */ if (_t153) goto L_021E66A8; else goto L_021E6454;
   L_021E6454: ; // 0x21e6454
         /* 021E6454 */ goto L_021E6574;
   L_021E6458: ; // 0x21e6458
-        /* 021E6458 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
-        /* 021E645C */ _t154 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E6458 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
+        /* 021E645C */ _t154 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E645C */ _t155 = _t154 & 0x00000001u;
         /* 021E645C */ if (_t155) goto L_021E64B0; else goto L_021E6460;
   L_021E6460: ; // 0x21e6460
@@ -2454,16 +2454,16 @@ void Gambit_fn_021E5F98(CPUState* cpu) {
         /* 021E6498 */ cpu->r[6] = cpu->r[26] + cpu->r[12];
         /* 021E649C */ _t164 = cpu->r[6] + 0x00000104u;
         /* 021E649C */ cpu->r[4] = rbrew_read8(cpu->mem, _t164);
-        /* 021E64A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 021E64A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 021E64A4 */ cpu->r[6] = cpu->r[3];
-        /* 021E64A8 */ _t165 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E64A8 */ _t165 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E64A8 */ _t166 = _t165 & 0x00000001u;
         /* 021E64A8 */ if (_t166) goto L_021E66A8; else goto L_021E64AC;
   L_021E64AC: ; // 0x21e64ac
         /* 021E64AC */ goto L_021E6574;
   L_021E64B0: ; // 0x21e64b0
-        /* 021E64B0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[28]);
-        /* 021E64B4 */ _t167 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E64B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[28]));
+        /* 021E64B4 */ _t167 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E64B4 */ _t168 = _t167 & 0x00000001u;
         /* 021E64B4 */ if (_t168) goto L_021E6508; else goto L_021E64B8;
   L_021E64B8: ; // 0x21e64b8
@@ -2492,17 +2492,17 @@ void Gambit_fn_021E5F98(CPUState* cpu) {
         /* 021E64F0 */ cpu->r[6] = cpu->r[26] + cpu->r[12];
         /* 021E64F4 */ _t177 = cpu->r[6] + 0x00000104u;
         /* 021E64F4 */ cpu->r[4] = rbrew_read8(cpu->mem, _t177);
-        /* 021E64F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 021E64F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 021E64FC */ cpu->r[6] = cpu->r[3];
-        /* 021E6500 */ _t178 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E6500 */ _t178 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E6500 */ _t179 = _t178 & 0x00000001u;
         /* 021E6500 */ if (_t179) goto L_021E66A8; else goto L_021E6504;
   L_021E6504: ; // 0x21e6504
         /* 021E6504 */ goto L_021E6574;
   L_021E6508: ; // 0x21e6508
         /* 021E6508 */ cpu->f[10] = -cpu->f[31];
-        /* 021E650C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[28]);
-        /* 021E6510 */ _t180 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E650C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[28]));
+        /* 021E6510 */ _t180 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E6510 */ _t181 = _t180 & 0x00000001u;
         /* 021E6510 */ if (_t181) goto L_021E6528; else goto L_021E6514;
   L_021E6514: ; // 0x21e6514
@@ -2537,9 +2537,9 @@ void Gambit_fn_021E5F98(CPUState* cpu) {
         /* 021E6560 */ cpu->r[6] = cpu->r[26] + cpu->r[12];
         /* 021E6564 */ _t190 = cpu->r[6] + 0x00000104u;
         /* 021E6564 */ cpu->r[4] = rbrew_read8(cpu->mem, _t190);
-        /* 021E6568 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 021E6568 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 021E656C */ cpu->r[6] = cpu->r[3];
-        /* 021E6570 */ _t191 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E6570 */ _t191 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E6570 */ _t192 = _t191 & 0x00000001u;
         /* 021E6570 */ if (_t192) goto L_021E66A8; else goto L_021E6574;
   L_021E6574: ; // 0x21e6574
@@ -2548,23 +2548,23 @@ void Gambit_fn_021E5F98(CPUState* cpu) {
         /* 021E657C */ cpu->r[3] = cpu->r[26];
         /* 021E6580 */ Gambit_fn_021F000C(cpu);
         /* 021E6584 */ cpu->r[27] = cpu->r[3];
-        /* 021E6584 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 021E6588 */ _t193 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E6584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 021E6588 */ _t193 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E6588 */ _t194 = _t193 & 0x00000001u;
         /* 021E6588 */ if (_t194) goto L_021E66A8; else goto L_021E658C;
   L_021E658C: ; // 0x21e658c
-        /* 021E658C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E6590 */ _t195 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E658C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E6590 */ _t195 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E6590 */ _t196 = _t195 & 0x00000001u;
         /* 021E6590 */ if (_t196) goto L_021E65AC; else goto L_021E6594;
   L_021E6594: ; // 0x21e6594
         /* 021E6594 */ _t197 = cpu->r[28] + 0x00000168u;
         /* 021E6594 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t197);
         /* 021E6598 */ cpu->r[10] = 0x10030000u;
-        /* 021E659C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[28]);
+        /* 021E659C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[28]));
         /* 021E65A0 */ _t198 = cpu->r[10] + 0x00005374u;
         /* 021E65A0 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t198);
-        /* 021E65A4 */ _t199 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E65A4 */ _t199 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E65A4 */ _t200 = _t199 & 0x00000001u;
         /* 021E65A4 */ if (_t200) goto L_021E65A8; else goto L_021E65F0;
   L_021E65A8: ; // 0x21e65a8
@@ -2583,15 +2583,15 @@ void Gambit_fn_021E5F98(CPUState* cpu) {
         /* 021E65CC */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021E65D0 */ _t203 = cpu->r[28] + 0x00000168u;
         /* 021E65D0 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t203);
-        /* 021E65D4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[28]);
+        /* 021E65D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[28]));
         /* 021E65D8 */ cpu->f[1] = cpu->f[31] * cpu->f[1];
-        /* 021E65DC */ _t204 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E65DC */ _t204 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E65DC */ _t205 = _t204 & 0x00000001u;
         /* 021E65DC */ if (_t205) goto L_021E65E0; else goto L_021E65F0;
   L_021E65E0: ; // 0x21e65e0
-        /* 021E65E0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[28]);
+        /* 021E65E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[28]));
         /* 021E65E4 */ cpu->r[0] = 0x00000000u;
-        /* 021E65E8 */ _t206 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E65E8 */ _t206 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E65E8 */ _t207 = _t206 & 0x00000001u;
         /* 021E65E8 */ if (_t207) goto L_021E65EC; else goto L_021E66A8;
   L_021E65EC: ; // 0x21e65ec
@@ -2600,8 +2600,8 @@ void Gambit_fn_021E5F98(CPUState* cpu) {
         /* 021E65F0 */ cpu->r[7] = 0x10030000u;
         /* 021E65F4 */ _t208 = cpu->r[7] + 0x00005378u;
         /* 021E65F4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t208);
-        /* 021E65F8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
-        /* 021E65FC */ _t209 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E65F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
+        /* 021E65FC */ _t209 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E65FC */ _t210 = _t209 & 0x00000001u;
         /* 021E65FC */ if (_t210) goto L_021E6600; else goto L_021E6614;
   L_021E6600: ; // 0x21e6600
@@ -2620,8 +2620,8 @@ void Gambit_fn_021E5F98(CPUState* cpu) {
         /* 021E6624 */ cpu->r[10] = rbrew_read32(cpu->mem, _t212);
         /* 021E6628 */ cpu->r[0] = cpu->r[10] + 0x80000000u;
   L_021E662C: ; // 0x21e662c
-        /* 021E662C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[28]);
-        /* 021E6630 */ _t213 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E662C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[28]));
+        /* 021E6630 */ _t213 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E6630 */ _t214 = _t213 & 0x00000001u;
         /* 021E6630 */ if (_t214) goto L_021E6634; else goto L_021E66A8;
   L_021E6634: ; // 0x21e6634
@@ -2636,13 +2636,13 @@ void Gambit_fn_021E5F98(CPUState* cpu) {
         /* 021E6648 */ cpu->r[4] = 0x00000000u;
         /* 021E664C */ _t218 = cpu->r[28] + 0x00000054u;
         /* 021E664C */ cpu->r[5] = rbrew_read32(cpu->mem, _t218);
-        /* 021E6650 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021E6650 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021E6654 */ _t219 = cpu->r[28] + 0x0000016Cu;
         /* 021E6654 */ cpu->f[2] = rbrew_read_f32(cpu->mem, _t219);
         /* 021E6658 */ cpu->r[7] = cpu->r[29];
         /* 021E665C */ _t220 = cpu->r[1] + 0x00000008u;
         /* 021E665C */ rbrew_write32(cpu->mem, _t220, cpu->r[30]);
-        /* 021E6660 */ _t221 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E6660 */ _t221 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E6660 */ _t222 = _t221 & 0x00000001u;
         /* 021E6660 */ if (_t222) goto L_021E6688; else goto L_021E6664;
   L_021E6664: ; // 0x21e6664
@@ -2699,7 +2699,7 @@ void Gambit_fn_021E5F98(CPUState* cpu) {
         /* 021E66D8 */ cpu->f[27] = rbrew_read_f64(cpu->mem, _t241);
         /* 021E66DC */ _t242 = cpu->r[1] + 0x00000090u;
         /* 021E66DC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t242);
-        /* 021E66E0 */ _t243 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E66E0 */ _t243 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E66E0 */ _t244 = _t243 & 0x00000001u;
         /* 021E66E0 */ if (_t244) goto L_021E66E4; // else: addr-0 trap, fall-through
   L_021E66E4: ; // 0x21e66e4
@@ -2756,7 +2756,7 @@ void Gambit_fn_021E66F4(CPUState* cpu) {
         /* 021E6758 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t11);
         /* 021E675C */ _t12 = cpu->r[1] + 0x00000010u;
         /* 021E675C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t12);
-        /* 021E6760 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E6760 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E6760 */ _t14 = _t13 & 0x00000001u;
         /* 021E6760 */ if (_t14) goto L_021E6764; // else: addr-0 trap, fall-through
   L_021E6764: ; // 0x21e6764
@@ -2812,7 +2812,7 @@ void Gambit_fn_021E66F8(CPUState* cpu) {
         /* 021E6758 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t11);
         /* 021E675C */ _t12 = cpu->r[1] + 0x00000010u;
         /* 021E675C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t12);
-        /* 021E6760 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E6760 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E6760 */ _t14 = _t13 & 0x00000001u;
         /* 021E6760 */ if (_t14) goto L_021E6764; // else: addr-0 trap, fall-through
   L_021E6764: ; // 0x21e6764
@@ -2990,8 +2990,8 @@ void Gambit_fn_021E67C0(CPUState* cpu) {
         /* 021E68AC */ cpu->f[11] = fma(cpu->f[9], cpu->f[10], cpu->f[7]);
         /* 021E68B0 */ _t31 = cpu->r[4] + 0x0000531Cu;
         /* 021E68B0 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t31);
-        /* 021E68B4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[30]);
-        /* 021E68B8 */ _t32 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E68B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[30]));
+        /* 021E68B8 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E68B8 */ _t33 = _t32 & 0x00000001u;
         /* 021E68B8 */ if (_t33) goto L_021E6CEC; else goto L_021E68BC;
   L_021E68BC: ; // 0x21e68bc
@@ -3030,10 +3030,10 @@ void Gambit_fn_021E67C0(CPUState* cpu) {
         /* 021E690C */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t45);
         /* 021E6910 */ cpu->f[6] = fma(cpu->f[10], cpu->f[10], cpu->f[12]);
         /* 021E6914 */ cpu->r[9] = 0x10030000u;
-        /* 021E6918 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[30]);
+        /* 021E6918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[30]));
         /* 021E691C */ _t46 = cpu->r[9] + 0x00005320u;
         /* 021E691C */ cpu->f[27] = rbrew_read_f32(cpu->mem, _t46);
-        /* 021E6920 */ _t47 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E6920 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E6920 */ _t48 = _t47 & 0x00000001u;
         /* 021E6920 */ if (_t48) goto L_021E6924; else goto L_021E6950;
   L_021E6924: ; // 0x21e6924
@@ -3086,8 +3086,8 @@ void Gambit_fn_021E67C0(CPUState* cpu) {
         /* 021E69A0 */ _t63 = cpu->r[1] + 0x00000058u;
         /* 021E69A0 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t63);
         /* 021E69A4 */ cpu->f[13] = fma(cpu->f[8], cpu->f[8], cpu->f[0]);
-        /* 021E69A8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[30]);
-        /* 021E69AC */ _t64 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E69A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[30]));
+        /* 021E69AC */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E69AC */ _t65 = _t64 & 0x00000001u;
         /* 021E69AC */ if (_t65) goto L_021E69B0; else goto L_021E69DC;
   L_021E69B0: ; // 0x21e69b0
@@ -3165,8 +3165,8 @@ void Gambit_fn_021E67C0(CPUState* cpu) {
         /* 021E6A6C */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t88);
         /* 021E6A70 */ /* nop */
         /* 021E6A74 */ cpu->f[13] = fma(cpu->f[8], cpu->f[9], cpu->f[6]);
-        /* 021E6A78 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[30]);
-        /* 021E6A7C */ _t89 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E6A78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[30]));
+        /* 021E6A7C */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E6A7C */ _t90 = _t89 & 0x00000001u;
         /* 021E6A7C */ if (_t90) goto L_021E6CEC; else goto L_021E6A80;
   L_021E6A80: ; // 0x21e6a80
@@ -3193,9 +3193,9 @@ void Gambit_fn_021E67C0(CPUState* cpu) {
         /* 021E6AB8 */ cpu->f[8] = cpu->f[0] * cpu->f[29];
         /* 021E6ABC */ _t97 = cpu->r[12] + 0x00000274u;
         /* 021E6ABC */ cpu->r[27] = rbrew_read32(cpu->mem, _t97);
-        /* 021E6AC0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[26]);
+        /* 021E6AC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[26]));
         /* 021E6AC4 */ cpu->r[29] = 0x00000000u;
-        /* 021E6AC8 */ _t98 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E6AC8 */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E6AC8 */ _t99 = _t98 & 0x00000001u;
         /* 021E6AC8 */ if (_t99) goto L_021E6CEC; else goto L_021E6ACC;
   L_021E6ACC: ; // 0x21e6acc
@@ -3278,8 +3278,8 @@ void Gambit_fn_021E67C0(CPUState* cpu) {
         /* 021E6B98 */ cpu->f[13] = cpu->f[11] - cpu->f[12];
         /* 021E6B9C */ cpu->f[7] = cpu->f[0] * cpu->f[0];
         /* 021E6BA0 */ cpu->f[12] = fma(cpu->f[13], cpu->f[13], cpu->f[7]);
-        /* 021E6BA4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[30]);
-        /* 021E6BA8 */ _t124 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E6BA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[30]));
+        /* 021E6BA8 */ _t124 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E6BA8 */ _t125 = _t124 & 0x00000001u;
         /* 021E6BA8 */ if (_t125) goto L_021E6BCC; else goto L_021E6BAC;
   L_021E6BAC: ; // 0x21e6bac
@@ -3289,10 +3289,10 @@ void Gambit_fn_021E67C0(CPUState* cpu) {
         /* 021E6BB4 */ _t127 = cpu->r[7] + 0x00000104u;
         /* 021E6BB4 */ cpu->r[4] = rbrew_read8(cpu->mem, _t127);
         /* 021E6BB8 */ cpu->f[22] = cpu->f[30] * cpu->f[12];
-        /* 021E6BBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 021E6BBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 021E6BC0 */ _t128 = cpu->r[30] + 0x00000051u;
         /* 021E6BC0 */ cpu->r[5] = rbrew_read8(cpu->mem, _t128);
-        /* 021E6BC4 */ _t129 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E6BC4 */ _t129 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E6BC4 */ _t130 = _t129 & 0x00000001u;
         /* 021E6BC4 */ if (_t130) goto L_021E6CAC; else goto L_021E6BC8;
   L_021E6BC8: ; // 0x21e6bc8
@@ -3311,10 +3311,10 @@ void Gambit_fn_021E67C0(CPUState* cpu) {
         /* 021E6BE8 */ _t134 = cpu->r[7] + 0x00000104u;
         /* 021E6BE8 */ cpu->r[4] = rbrew_read8(cpu->mem, _t134);
         /* 021E6BEC */ cpu->f[22] = cpu->f[23] * cpu->f[12];
-        /* 021E6BF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 021E6BF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 021E6BF4 */ _t135 = cpu->r[30] + 0x00000051u;
         /* 021E6BF4 */ cpu->r[5] = rbrew_read8(cpu->mem, _t135);
-        /* 021E6BF8 */ _t136 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E6BF8 */ _t136 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E6BF8 */ _t137 = _t136 & 0x00000001u;
         /* 021E6BF8 */ if (_t137) goto L_021E6CAC; else goto L_021E6BFC;
   L_021E6BFC: ; // 0x21e6bfc
@@ -3323,8 +3323,8 @@ void Gambit_fn_021E67C0(CPUState* cpu) {
         /* 021E6C04 */ cpu->r[3] = cpu->r[27];
         /* 021E6C08 */ Gambit_fn_021F000C(cpu);
         /* 021E6C0C */ cpu->r[31] = cpu->r[3];
-        /* 021E6C0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E6C10 */ _t138 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E6C0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E6C10 */ _t138 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E6C10 */ _t139 = _t138 & 0x00000001u;
         /* 021E6C10 */ if (_t139) goto L_021E6CAC; else goto L_021E6C14;
   L_021E6C14: ; // 0x21e6c14
@@ -3334,10 +3334,10 @@ void Gambit_fn_021E67C0(CPUState* cpu) {
         /* 021E6C18 */ cpu->r[10] = rbrew_read8(cpu->mem, _t141);
         /* 021E6C1C */ _t142 = cpu->r[8] + 0x000003DCu;
         /* 021E6C1C */ cpu->r[12] = rbrew_read32(cpu->mem, _t142);
-        /* 021E6C20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021E6C20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021E6C24 */ cpu->r[3] = cpu->r[30];
         /* 021E6C28 */ cpu->ctr = cpu->r[12];
-        /* 021E6C2C */ _t143 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E6C2C */ _t143 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E6C2C */ _t144 = _t143 & 0x00000001u;
         /* 021E6C2C */ if (_t144) goto L_021E6C78; else goto L_021E6C30;
   L_021E6C30: ; // 0x21e6c30
@@ -3359,9 +3359,9 @@ void Gambit_fn_021E67C0(CPUState* cpu) {
         /* 021E6C5C */ rbrew_write32(cpu->mem, _t148, cpu->r[0]);
         /* 021E6C60 */ Gambit_fn_0220397C(cpu);
         /* 021E6C64 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 021E6C68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000008u);
+        /* 021E6C68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000008u));
         /* 021E6C6C */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 021E6C70 */ _t149 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E6C70 */ _t149 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E6C70 */ _t150 = _t149 & 0x00000001u;
         /* 021E6C70 */ if (_t150) goto L_021E6C74; else goto L_021E6CEC;
   L_021E6C74: ; // 0x21e6c74
@@ -3386,9 +3386,9 @@ void Gambit_fn_021E67C0(CPUState* cpu) {
         /* 021E6CA8 */ Gambit_fn_022039AC(cpu);
   L_021E6CAC: ; // 0x21e6cac
         /* 021E6CAC */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 021E6CB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000008u);
+        /* 021E6CB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000008u));
         /* 021E6CB4 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 021E6CB8 */ _t155 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E6CB8 */ _t155 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E6CB8 */ _t156 = _t155 & 0x00000001u;
         /* 021E6CB8 */ if (_t156) goto L_021E6CBC; else goto L_021E6CEC;
   L_021E6CBC: ; // 0x21e6cbc
@@ -3406,8 +3406,8 @@ void Gambit_fn_021E67C0(CPUState* cpu) {
         /* 021E6CD8 */ cpu->f[8] = cpu->f[7] - cpu->f[10];
         /* 021E6CDC */ cpu->f[7] = (double)(float)cpu->f[8];
         /* 021E6CE0 */ cpu->f[6] = cpu->f[7] * cpu->f[29];
-        /* 021E6CE4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[26]);
-        /* 021E6CE8 */ _t161 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E6CE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[26]));
+        /* 021E6CE8 */ _t161 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E6CE8 */ _t162 = _t161 & 0x00000001u;
         /* 021E6CE8 */ if (_t162) goto L_021E6CEC; else goto L_021E6B0C;
   L_021E6CEC: ; // 0x21e6cec
@@ -3452,7 +3452,7 @@ void Gambit_fn_021E67C0(CPUState* cpu) {
         /* 021E6D38 */ cpu->f[22] = rbrew_read_f64(cpu->mem, _t181);
         /* 021E6D3C */ _t182 = cpu->r[1] + 0x00000160u;
         /* 021E6D3C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t182);
-        /* 021E6D40 */ _t183 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E6D40 */ _t183 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E6D40 */ _t184 = _t183 & 0x00000001u;
         /* 021E6D40 */ if (_t184) goto L_021E6D44; // else: addr-0 trap, fall-through
   L_021E6D44: ; // 0x21e6d44
@@ -3543,8 +3543,8 @@ void Gambit_fn_021E6D54(CPUState* cpu) {
         /* 021E6E00 */ cpu->f[0] = fma(cpu->f[10], cpu->f[10], cpu->f[9]);
         /* 021E6E04 */ _t27 = cpu->r[7] + 0x0000531Cu;
         /* 021E6E04 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t27);
-        /* 021E6E08 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[31]);
-        /* 021E6E0C */ _t28 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E6E08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[31]));
+        /* 021E6E0C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E6E0C */ _t29 = _t28 & 0x00000001u;
         /* 021E6E0C */ if (_t29) goto L_021E6E10; else goto L_021E6E4C;
   L_021E6E10: ; // 0x21e6e10
@@ -3620,7 +3620,7 @@ void Gambit_fn_021E6D54(CPUState* cpu) {
         /* 021E6ED4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t48);
         /* 021E6ED8 */ _t49 = cpu->r[1] + 0x00000020u;
         /* 021E6ED8 */ cpu->f[8] = rbrew_read_f64(cpu->mem, _t49);
-        /* 021E6EDC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[31]);
+        /* 021E6EDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[31]));
         /* 021E6EE0 */ cpu->ctr = cpu->r[0];
         /* 021E6EE4 */ cpu->f[9] = cpu->f[8] - cpu->f[11];
         /* 021E6EE8 */ /* nop */
@@ -3638,7 +3638,7 @@ void Gambit_fn_021E6D54(CPUState* cpu) {
         /* 021E6F14 */ cpu->f[0] = cpu->f[28] - cpu->f[30];
         /* 021E6F18 */ cpu->f[8] = cpu->f[7] / cpu->f[28];
         /* 021E6F1C */ cpu->r[10] = cpu->r[1] + 0x00000020u;
-        /* 021E6F20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021E6F20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021E6F24 */ cpu->f[10] = (uint32_t)(int32_t)cpu->f[8];
         /* 021E6F28 */ _t51 = cpu->r[31] + 0x00000170u;
         /* 021E6F28 */ rbrew_write_f32(cpu->mem, _t51, cpu->f[7]);
@@ -3646,7 +3646,7 @@ void Gambit_fn_021E6D54(CPUState* cpu) {
         /* 021E6F30 */ /* nop */
         /* 021E6F34 */ _t52 = cpu->r[1] + 0x00000020u;
         /* 021E6F34 */ cpu->r[30] = rbrew_read32(cpu->mem, _t52);
-        /* 021E6F38 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E6F38 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E6F38 */ _t54 = _t53 & 0x00000001u;
         /* 021E6F38 */ if (_t54) goto L_021E6F50; else goto L_021E6F3C;
   L_021E6F3C: ; // 0x21e6f3c
@@ -3657,8 +3657,8 @@ void Gambit_fn_021E6D54(CPUState* cpu) {
         /* 021E6F4C */ Gambit_fn_021E5F98(cpu);
   L_021E6F50: ; // 0x21e6f50
         /* 021E6F50 */ cpu->r[30] = cpu->r[30] - cpu->r[29];
-        /* 021E6F50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021E6F54 */ _t55 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E6F50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021E6F54 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E6F54 */ _t56 = _t55 & 0x00000001u;
         /* 021E6F54 */ if (_t56) goto L_021E6F58; else goto L_021E6FC4;
   L_021E6F58: ; // 0x21e6f58
@@ -3694,9 +3694,9 @@ void Gambit_fn_021E6D54(CPUState* cpu) {
         /* 021E6FB0 */ /* nop */
         /* 021E6FB4 */ Gambit_fn_021E5F98(cpu);
         /* 021E6FB8 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 021E6FB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021E6FB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021E6FBC */ cpu->f[30] = cpu->f[30] + cpu->f[29];
-        /* 021E6FC0 */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E6FC0 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E6FC0 */ _t64 = _t63 & 0x00000001u;
         /* 021E6FC0 */ if (_t64) goto L_021E6FC4; else goto L_021E6F5C;
   L_021E6FC4: ; // 0x21e6fc4
@@ -3716,8 +3716,8 @@ void Gambit_fn_021E6D54(CPUState* cpu) {
         /* 021E6FE8 */ cpu->r[5] = cpu->r[1] + 0x00000014u;
         /* 021E6FEC */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 021E6FF0 */ Gambit_fn_021C6DD8(cpu);
-        /* 021E6FF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E6FF8 */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E6FF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E6FF8 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E6FF8 */ _t70 = _t69 & 0x00000001u;
         /* 021E6FF8 */ if (_t70) goto L_021E6FFC; else goto L_021E7010;
   L_021E6FFC: ; // 0x21e6ffc
@@ -3763,14 +3763,14 @@ void Gambit_fn_021E6D54(CPUState* cpu) {
         /* 021E7068 */ rbrew_write32(cpu->mem, _t81, cpu->r[10]);
         /* 021E706C */ _t82 = cpu->r[1] + 0x00000054u;
         /* 021E706C */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t82);
-        /* 021E7070 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
+        /* 021E7070 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
         /* 021E7074 */ _t83 = cpu->r[31] + 0x0000015Cu;
         /* 021E7074 */ rbrew_write_f32(cpu->mem, _t83, cpu->f[13]);
         /* 021E7078 */ _t84 = cpu->r[31] + 0x00000158u;
         /* 021E7078 */ rbrew_write_f32(cpu->mem, _t84, cpu->f[12]);
         /* 021E707C */ _t85 = cpu->r[31] + 0x00000160u;
         /* 021E707C */ rbrew_write_f32(cpu->mem, _t85, cpu->f[7]);
-        /* 021E7080 */ _t86 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E7080 */ _t86 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E7080 */ _t87 = _t86 & 0x00000001u;
         /* 021E7080 */ if (_t87) goto L_021E70A4; else goto L_021E7084;
   L_021E7084: ; // 0x21e7084
@@ -3807,7 +3807,7 @@ void Gambit_fn_021E6D54(CPUState* cpu) {
         /* 021E70D0 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t97);
         /* 021E70D4 */ _t98 = cpu->r[1] + 0x000000C0u;
         /* 021E70D4 */ cpu->r[30] = rbrew_read32(cpu->mem, _t98);
-        /* 021E70D8 */ _t99 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E70D8 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E70D8 */ _t100 = _t99 & 0x00000001u;
         /* 021E70D8 */ if (_t100) goto L_021E70DC; // else: addr-0 trap, fall-through
   L_021E70DC: ; // 0x21e70dc
@@ -3875,8 +3875,8 @@ void Gambit_fn_021E7108(CPUState* cpu) {
         /* 021E7120 */ cpu->r[11] = rbrew_read32(cpu->mem, _t4);
         /* 021E7124 */ _t5 = cpu->r[3] + 0x0000002Cu;
         /* 021E7124 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
-        /* 021E7128 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[0]);
-        /* 021E712C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7128 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[0]));
+        /* 021E712C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E712C */ _t7 = _t6 & 0x00000001u;
         /* 021E712C */ if (_t7) goto L_021E7130; else goto L_021E7154;
   L_021E7130: ; // 0x21e7130
@@ -3887,7 +3887,7 @@ void Gambit_fn_021E7108(CPUState* cpu) {
         /* 021E7138 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t9);
         /* 021E713C */ _t10 = cpu->r[1] + 0x00000008u;
         /* 021E713C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t10);
-        /* 021E7140 */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E7140 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E7140 */ _t12 = _t11 & 0x00000001u;
         /* 021E7140 */ if (_t12) goto L_021E7144; // else: addr-0 trap, fall-through
   L_021E7144: ; // 0x21e7144
@@ -3909,8 +3909,8 @@ void Gambit_fn_021E7108(CPUState* cpu) {
         /* 021E716C */ cpu->r[3] = cpu->r[4];
         /* 021E7170 */ cpu->f[31] = fma(cpu->f[0], cpu->f[1], cpu->f[13]);
         /* 021E7174 */ Gambit_fn_021BCFBC(cpu);
-        /* 021E7178 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E717C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E717C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E717C */ _t18 = _t17 & 0x00000001u;
         /* 021E717C */ if (_t18) goto L_021E7184; else goto L_021E7180;
   L_021E7180: ; // 0x21e7180
@@ -3921,7 +3921,7 @@ void Gambit_fn_021E7108(CPUState* cpu) {
         /* 021E7188 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t19);
         /* 021E718C */ _t20 = cpu->r[1] + 0x00000008u;
         /* 021E718C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t20);
-        /* 021E7190 */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E7190 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E7190 */ _t22 = _t21 & 0x00000001u;
         /* 021E7190 */ if (_t22) goto L_021E7194; // else: addr-0 trap, fall-through
   L_021E7194: ; // 0x21e7194
@@ -3951,8 +3951,8 @@ void Gambit_fn_021E710C(CPUState* cpu) {
         /* 021E7120 */ cpu->r[11] = rbrew_read32(cpu->mem, _t4);
         /* 021E7124 */ _t5 = cpu->r[3] + 0x0000002Cu;
         /* 021E7124 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
-        /* 021E7128 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[0]);
-        /* 021E712C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7128 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[0]));
+        /* 021E712C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E712C */ _t7 = _t6 & 0x00000001u;
         /* 021E712C */ if (_t7) goto L_021E7130; else goto L_021E7154;
   L_021E7130: ; // 0x21e7130
@@ -3963,7 +3963,7 @@ void Gambit_fn_021E710C(CPUState* cpu) {
         /* 021E7138 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t9);
         /* 021E713C */ _t10 = cpu->r[1] + 0x00000008u;
         /* 021E713C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t10);
-        /* 021E7140 */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E7140 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E7140 */ _t12 = _t11 & 0x00000001u;
         /* 021E7140 */ if (_t12) goto L_021E7144; // else: addr-0 trap, fall-through
   L_021E7144: ; // 0x21e7144
@@ -3985,8 +3985,8 @@ void Gambit_fn_021E710C(CPUState* cpu) {
         /* 021E716C */ cpu->r[3] = cpu->r[4];
         /* 021E7170 */ cpu->f[31] = fma(cpu->f[0], cpu->f[1], cpu->f[13]);
         /* 021E7174 */ Gambit_fn_021BCFBC(cpu);
-        /* 021E7178 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E717C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E717C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E717C */ _t18 = _t17 & 0x00000001u;
         /* 021E717C */ if (_t18) goto L_021E7184; else goto L_021E7180;
   L_021E7180: ; // 0x21e7180
@@ -3997,7 +3997,7 @@ void Gambit_fn_021E710C(CPUState* cpu) {
         /* 021E7188 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t19);
         /* 021E718C */ _t20 = cpu->r[1] + 0x00000008u;
         /* 021E718C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t20);
-        /* 021E7190 */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E7190 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E7190 */ _t22 = _t21 & 0x00000001u;
         /* 021E7190 */ if (_t22) goto L_021E7194; // else: addr-0 trap, fall-through
   L_021E7194: ; // 0x21e7194
@@ -4073,16 +4073,16 @@ void Gambit_fn_021E71D4(CPUState* cpu) {
         /* 021E71EC */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
         /* 021E71F0 */ cpu->r[28] = cpu->r[4];
         /* 021E71F4 */ cpu->r[10] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x0000001Cu, 0x0000001Eu);
-        /* 021E71F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021E71F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021E71F8 */ cpu->r[30] = 0x00000000u;
-        /* 021E71FC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E71FC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E71FC */ _t4 = _t3 & 0x00000001u;
         /* 021E71FC */ if (_t4) goto L_021E727C; else goto L_021E7200;
   L_021E7200: ; // 0x21e7200
         /* 021E7200 */ _t5 = cpu->r[29] + 0x00000051u;
         /* 021E7200 */ cpu->r[12] = rbrew_read8(cpu->mem, _t5);
-        /* 021E7204 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E7208 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7204 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E7208 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7208 */ _t7 = _t6 & 0x00000001u;
         /* 021E7208 */ if (_t7) goto L_021E7300; else goto L_021E720C;
   L_021E720C: ; // 0x21e720c
@@ -4122,9 +4122,9 @@ void Gambit_fn_021E71D4(CPUState* cpu) {
         /* 021E7264 */ cpu->r[0] = rbrew_read32(cpu->mem, _t18);
         /* 021E7268 */ cpu->r[31] = cpu->r[6] + 0x00000258u;
         /* 021E726C */ cpu->r[8] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021E726C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021E726C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021E7270 */ cpu->r[26] = cpu->r[27] + 0x00000048u;
-        /* 021E7274 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7274 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7274 */ _t20 = _t19 & 0x00000001u;
         /* 021E7274 */ if (_t20) goto L_021E7360; else goto L_021E7278;
   L_021E7278: ; // 0x21e7278
@@ -4139,10 +4139,10 @@ void Gambit_fn_021E71D4(CPUState* cpu) {
         /* 021E7290 */ _t22 = cpu->r[8] + 0xFFFF9484u;
         /* 021E7290 */ cpu->r[26] = rbrew_read32(cpu->mem, _t22);
         /* 021E7294 */ cpu->r[31] = 0x00000000u;
-        /* 021E7298 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021E7298 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021E729C */ _t23 = cpu->r[1] + 0x0000000Cu;
         /* 021E729C */ rbrew_write32(cpu->mem, _t23, cpu->r[31]);
-        /* 021E72A0 */ _t24 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E72A0 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E72A0 */ _t25 = _t24 & 0x00000001u;
         /* 021E72A0 */ if (_t25) goto L_021E72A4; else goto L_021E7300;
   L_021E72A4: ; // 0x21e72a4
@@ -4157,8 +4157,8 @@ void Gambit_fn_021E71D4(CPUState* cpu) {
         /* 021E72C4 */ Gambit_fn_02040F70(cpu);
         /* 021E72C8 */ _t26 = cpu->r[1] + 0x00000008u;
         /* 021E72C8 */ cpu->r[10] = rbrew_read8(cpu->mem, _t26);
-        /* 021E72CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x000000FEu);
-        /* 021E72D0 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E72CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x000000FEu));
+        /* 021E72D0 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E72D0 */ _t28 = _t27 & 0x00000001u;
         /* 021E72D0 */ if (_t28) goto L_021E72F4; else goto L_021E72D4;
   L_021E72D4: ; // 0x21e72d4
@@ -4168,19 +4168,19 @@ void Gambit_fn_021E71D4(CPUState* cpu) {
         /* 021E72D8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t30);
         /* 021E72DC */ cpu->r[26] = cpu->r[27] + 0x00000048u;
         /* 021E72E0 */ cpu->r[8] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021E72E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021E72E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021E72E4 */ cpu->r[30] = 0x00000001u;
         /* 021E72E8 */ cpu->r[31] = cpu->r[6] + 0x00000258u;
-        /* 021E72EC */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E72EC */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E72EC */ _t32 = _t31 & 0x00000001u;
         /* 021E72EC */ if (_t32) goto L_021E7360; else goto L_021E72F0;
   L_021E72F0: ; // 0x21e72f0
         /* 021E72F0 */ goto L_021E7318;
   L_021E72F4: ; // 0x21e72f4
         /* 021E72F4 */ cpu->r[26] = cpu->r[26] + 0xFFFFFFFFu;
-        /* 021E72F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021E72F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021E72F8 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 021E72FC */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E72FC */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E72FC */ _t34 = _t33 & 0x00000001u;
         /* 021E72FC */ if (_t34) goto L_021E7300; else goto L_021E72A4;
   L_021E7300: ; // 0x21e7300
@@ -4190,9 +4190,9 @@ void Gambit_fn_021E71D4(CPUState* cpu) {
         /* 021E7304 */ cpu->r[0] = rbrew_read32(cpu->mem, _t36);
         /* 021E7308 */ cpu->r[31] = cpu->r[6] + 0x00000258u;
         /* 021E730C */ cpu->r[8] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021E730C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021E730C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021E7310 */ cpu->r[26] = cpu->r[27] + 0x00000048u;
-        /* 021E7314 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7314 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7314 */ _t38 = _t37 & 0x00000001u;
         /* 021E7314 */ if (_t38) goto L_021E7360; else goto L_021E7318;
   L_021E7318: ; // 0x21e7318
@@ -4201,10 +4201,10 @@ void Gambit_fn_021E71D4(CPUState* cpu) {
         /* 021E7320 */ cpu->r[8] = 0x10030000u;
         /* 021E7324 */ _t39 = cpu->r[8] + 0x0000531Cu;
         /* 021E7324 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t39);
-        /* 021E7328 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[13]);
+        /* 021E7328 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[13]));
         /* 021E732C */ _t40 = cpu->r[27] + 0x00000000u;
         /* 021E732C */ cpu->r[7] = rbrew_read32(cpu->mem, _t40);
-        /* 021E7330 */ _t41 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E7330 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E7330 */ _t42 = _t41 & 0x00000001u;
         /* 021E7330 */ if (_t42) goto L_021E7334; else goto L_021E7358;
   L_021E7334: ; // 0x21e7334
@@ -4327,7 +4327,7 @@ void Gambit_fn_021E73F8(CPUState* cpu) {
         /* 021E7404 */ _t1 = cpu->r[4] + 0x00000000u;
         /* 021E7404 */ rbrew_write16(cpu->mem, _t1, (uint16_t)cpu->r[11]);
         /* 021E7408 */ cpu->r[12] = cpu->r[0] & 0x0000FEFFu;
-        /* 021E7408 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021E7408 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021E740C */ _t2 = cpu->r[4] + 0x00000002u;
         /* 021E740C */ rbrew_write16(cpu->mem, _t2, (uint16_t)cpu->r[12]);
         /* 021E7410 */ _t3 = cpu->r[4] + 0x00000003u;
@@ -4369,9 +4369,9 @@ void Gambit_fn_021E7418(CPUState* cpu) {
         /* 021E745C */ cpu->r[10] = cpu->r[28] + cpu->r[11];
         /* 021E7460 */ _t8 = cpu->r[10] + 0x00000104u;
         /* 021E7460 */ cpu->r[4] = rbrew_read8(cpu->mem, _t8);
-        /* 021E7464 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 021E7464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 021E7468 */ cpu->r[7] = cpu->r[3];
-        /* 021E746C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E746C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E746C */ _t10 = _t9 & 0x00000001u;
         /* 021E746C */ if (_t10) goto L_021E74E8; else goto L_021E7470;
   L_021E7470: ; // 0x21e7470
@@ -4380,8 +4380,8 @@ void Gambit_fn_021E7418(CPUState* cpu) {
         /* 021E7478 */ cpu->r[3] = cpu->r[28];
         /* 021E747C */ Gambit_fn_021F000C(cpu);
         /* 021E7480 */ cpu->r[28] = cpu->r[3];
-        /* 021E7480 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021E7484 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7480 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021E7484 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7484 */ _t12 = _t11 & 0x00000001u;
         /* 021E7484 */ if (_t12) goto L_021E74E8; else goto L_021E7488;
   L_021E7488: ; // 0x21e7488
@@ -4445,8 +4445,8 @@ void Gambit_fn_021E74FC(CPUState* cpu) {
         /* 021E750C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E7510 */ _t3 = cpu->r[31] + 0x00000176u;
         /* 021E7510 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 021E7514 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E7518 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7514 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E7518 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7518 */ _t5 = _t4 & 0x00000001u;
         /* 021E7518 */ if (_t5) goto L_021E7658; else goto L_021E751C;
   L_021E751C: ; // 0x21e751c
@@ -4489,8 +4489,8 @@ void Gambit_fn_021E74FC(CPUState* cpu) {
         /* 021E7574 */ cpu->f[8] = fma(cpu->f[11], cpu->f[11], cpu->f[0]);
         /* 021E7578 */ _t20 = cpu->r[11] + 0x0000531Cu;
         /* 021E7578 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t20);
-        /* 021E757C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[13]);
-        /* 021E7580 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E757C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[13]));
+        /* 021E7580 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E7580 */ _t22 = _t21 & 0x00000001u;
         /* 021E7580 */ if (_t22) goto L_021E7584; else goto L_021E75C0;
   L_021E7584: ; // 0x21e7584
@@ -4521,8 +4521,8 @@ void Gambit_fn_021E74FC(CPUState* cpu) {
         /* 021E75C8 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 021E75CC */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 021E75D0 */ Gambit_fn_021C6DD8(cpu);
-        /* 021E75D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E75D8 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E75D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E75D8 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E75D8 */ _t30 = _t29 & 0x00000001u;
         /* 021E75D8 */ if (_t30) goto L_021E75DC; else goto L_021E75F0;
   L_021E75DC: ; // 0x21e75dc
@@ -4598,8 +4598,8 @@ void Gambit_fn_021E7500(CPUState* cpu) {
         /* 021E750C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E7510 */ _t3 = cpu->r[31] + 0x00000176u;
         /* 021E7510 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 021E7514 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E7518 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7514 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E7518 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7518 */ _t5 = _t4 & 0x00000001u;
         /* 021E7518 */ if (_t5) goto L_021E7658; else goto L_021E751C;
   L_021E751C: ; // 0x21e751c
@@ -4642,8 +4642,8 @@ void Gambit_fn_021E7500(CPUState* cpu) {
         /* 021E7574 */ cpu->f[8] = fma(cpu->f[11], cpu->f[11], cpu->f[0]);
         /* 021E7578 */ _t20 = cpu->r[11] + 0x0000531Cu;
         /* 021E7578 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t20);
-        /* 021E757C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[13]);
-        /* 021E7580 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E757C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[13]));
+        /* 021E7580 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E7580 */ _t22 = _t21 & 0x00000001u;
         /* 021E7580 */ if (_t22) goto L_021E7584; else goto L_021E75C0;
   L_021E7584: ; // 0x21e7584
@@ -4674,8 +4674,8 @@ void Gambit_fn_021E7500(CPUState* cpu) {
         /* 021E75C8 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 021E75CC */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 021E75D0 */ Gambit_fn_021C6DD8(cpu);
-        /* 021E75D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E75D8 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E75D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E75D8 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E75D8 */ _t30 = _t29 & 0x00000001u;
         /* 021E75D8 */ if (_t30) goto L_021E75DC; else goto L_021E75F0;
   L_021E75DC: ; // 0x21e75dc
@@ -4813,8 +4813,8 @@ void Gambit_fn_021E76B4(CPUState* cpu) {
         /* 021E76B4 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E76B4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E76B8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021E76B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E76BC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E76B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E76BC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E76BC */ _t2 = _t1 & 0x00000001u;
         /* 021E76BC */ _t3 = _t2 ^ 0x00000001u;
         /* 021E76BC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -4836,8 +4836,8 @@ void Gambit_fn_021E76D0(CPUState* cpu) {
         /* 021E76D0 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E76D0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E76D4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021E76D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E76D8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E76D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E76D8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E76D8 */ _t2 = _t1 & 0x00000001u;
         /* 021E76D8 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E76D8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -4859,8 +4859,8 @@ void Gambit_fn_021E76EC(CPUState* cpu) {
         /* 021E76EC */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E76EC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E76F0 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021E76F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E76F4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E76F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E76F4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E76F4 */ _t2 = _t1 & 0x00000001u;
         /* 021E76F4 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E76F4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -4903,8 +4903,8 @@ void Gambit_fn_021E7718(CPUState* cpu) {
         /* 021E7728 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E772C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021E772C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021E7730 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021E7734 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7730 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021E7734 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7734 */ _t5 = _t4 & 0x00000001u;
         /* 021E7734 */ if (_t5) goto L_021E7738; else goto L_021E7754;
   L_021E7738: ; // 0x21e7738
@@ -4943,8 +4943,8 @@ void Gambit_fn_021E771C(CPUState* cpu) {
         /* 021E7728 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E772C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021E772C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021E7730 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021E7734 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7730 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021E7734 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7734 */ _t5 = _t4 & 0x00000001u;
         /* 021E7734 */ if (_t5) goto L_021E7738; else goto L_021E7754;
   L_021E7738: ; // 0x21e7738
@@ -5348,8 +5348,8 @@ void Gambit_fn_021E78F0(CPUState* cpu) {
         /* 021E78F0 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 021E78F0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E78F4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 021E78F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E78F8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E78F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E78F8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E78F8 */ _t2 = _t1 & 0x00000001u;
         /* 021E78F8 */ if (_t2) goto L_021E7908; else goto L_021E78FC;
   L_021E78FC: ; // 0x21e78fc
@@ -5378,8 +5378,8 @@ void Gambit_fn_021E7914(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -5573,10 +5573,10 @@ void Gambit_fn_021E79D0(CPUState* cpu) {
         /* 021E79D0 */ cpu->r[10] = 0x101D0000u;
         /* 021E79D4 */ _t0 = cpu->r[10] + 0xFFFFFC90u;
         /* 021E79D4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 021E79D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021E79D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021E79DC */ cpu->r[10] = 0x101D0000u;
         /* 021E79E0 */ cpu->r[10] = cpu->r[10] + 0xFFFFFC8Cu;
-        /* 021E79E4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E79E4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E79E4 */ _t2 = _t1 & 0x00000001u;
         /* 021E79E4 */ if (_t2) goto L_021E79E8; else goto L_021E7A00;
   L_021E79E8: ; // 0x21e79e8
@@ -5589,8 +5589,8 @@ void Gambit_fn_021E79D0(CPUState* cpu) {
         /* 021E79FC */ _t4 = cpu->r[10] + 0x00000000u;
         /* 021E79FC */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_021E7A00: ; // 0x21e7a00
-        /* 021E7A00 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021E7A04 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7A00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021E7A04 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7A04 */ _t6 = _t5 & 0x00000001u;
         /* 021E7A04 */ if (_t6) goto L_021E7A08; else goto L_021E7A10;
   L_021E7A08: ; // 0x21e7a08
@@ -5601,9 +5601,9 @@ void Gambit_fn_021E79D0(CPUState* cpu) {
         /* 021E7A14 */ _t7 = cpu->r[9] + 0xFFFFDA00u;
         /* 021E7A14 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 021E7A18 */ cpu->r[11] = 0x101D0000u;
-        /* 021E7A1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021E7A1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021E7A20 */ cpu->r[11] = cpu->r[11] + 0xFFFFFBFCu;
-        /* 021E7A24 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7A24 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7A24 */ _t9 = _t8 & 0x00000001u;
         /* 021E7A24 */ if (_t9) goto L_021E7A28; else goto L_021E7A40;
   L_021E7A28: ; // 0x21e7a28
@@ -5616,8 +5616,8 @@ void Gambit_fn_021E79D0(CPUState* cpu) {
         /* 021E7A3C */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021E7A3C */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021E7A40: ; // 0x21e7a40
-        /* 021E7A40 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021E7A44 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7A40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021E7A44 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7A44 */ _t13 = _t12 & 0x00000001u;
         /* 021E7A44 */ if (_t13) goto L_021E7A48; else goto L_021E7A50;
   L_021E7A48: ; // 0x21e7a48
@@ -5628,9 +5628,9 @@ void Gambit_fn_021E79D0(CPUState* cpu) {
         /* 021E7A54 */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021E7A54 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 021E7A58 */ cpu->r[9] = 0x101D0000u;
-        /* 021E7A5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021E7A5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021E7A60 */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 021E7A64 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7A64 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7A64 */ _t16 = _t15 & 0x00000001u;
         /* 021E7A64 */ if (_t16) goto L_021E7A68; else goto L_021E7A80;
   L_021E7A68: ; // 0x21e7a68
@@ -5643,8 +5643,8 @@ void Gambit_fn_021E79D0(CPUState* cpu) {
         /* 021E7A7C */ _t18 = cpu->r[9] + 0x00000000u;
         /* 021E7A7C */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_021E7A80: ; // 0x21e7a80
-        /* 021E7A80 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 021E7A84 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7A80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 021E7A84 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7A84 */ _t20 = _t19 & 0x00000001u;
         /* 021E7A84 */ if (_t20) goto L_021E7A88; else goto L_021E7A90;
   L_021E7A88: ; // 0x21e7a88
@@ -5656,9 +5656,9 @@ void Gambit_fn_021E79D0(CPUState* cpu) {
         /* 021E7A94 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 021E7A94 */ cpu->r[9] = _t21;
         /* 021E7A98 */ cpu->r[10] = 0x101D0000u;
-        /* 021E7A9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021E7A9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021E7AA0 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021E7AA4 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7AA4 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7AA4 */ _t23 = _t22 & 0x00000001u;
         /* 021E7AA4 */ if (_t23) goto L_021E7AA8; else goto L_021E7ABC;
   L_021E7AA8: ; // 0x21e7aa8
@@ -5670,8 +5670,8 @@ void Gambit_fn_021E79D0(CPUState* cpu) {
         /* 021E7AB8 */ _t25 = cpu->r[10] + 0x00000000u;
         /* 021E7AB8 */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_021E7ABC: ; // 0x21e7abc
-        /* 021E7ABC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021E7AC0 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7ABC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021E7AC0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7AC0 */ _t27 = _t26 & 0x00000001u;
         /* 021E7AC0 */ if (_t27) goto L_021E7AC4; else goto L_021E7ACC;
   L_021E7AC4: ; // 0x21e7ac4
@@ -5683,9 +5683,9 @@ void Gambit_fn_021E79D0(CPUState* cpu) {
         /* 021E7AD0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 021E7AD0 */ cpu->r[10] = _t28;
         /* 021E7AD4 */ cpu->r[11] = 0x101D0000u;
-        /* 021E7AD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021E7AD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021E7ADC */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021E7AE0 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7AE0 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7AE0 */ _t30 = _t29 & 0x00000001u;
         /* 021E7AE0 */ if (_t30) goto L_021E7AE4; else goto L_021E7AF8;
   L_021E7AE4: ; // 0x21e7ae4
@@ -5787,18 +5787,18 @@ void Gambit_fn_021E7B58(CPUState* cpu) {
         /* 021E7B6C */ _t2 = cpu->r[1] + 0x00000058u;
         /* 021E7B6C */ rbrew_write_f32(cpu->mem, _t2, cpu->f[31]);
         /* 021E7B70 */ cpu->r[31] = cpu->r[3];
-        /* 021E7B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021E7B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021E7B74 */ _t3 = cpu->r[1] + 0x00000064u;
         /* 021E7B74 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 021E7B78 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7B78 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7B78 */ _t5 = _t4 & 0x00000001u;
         /* 021E7B78 */ if (_t5) goto L_021E7B7C; else goto L_021E7B8C;
   L_021E7B7C: ; // 0x21e7b7c
         /* 021E7B7C */ cpu->r[3] = 0x00000288u;
         /* 021E7B80 */ Gambit_fn_02801A78(cpu);
         /* 021E7B84 */ cpu->r[31] = cpu->r[3];
-        /* 021E7B84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E7B88 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7B84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E7B88 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7B88 */ _t7 = _t6 & 0x00000001u;
         /* 021E7B88 */ if (_t7) goto L_021E7FE0; else goto L_021E7B8C;
   L_021E7B8C: ; // 0x21e7b8c
@@ -5806,20 +5806,20 @@ void Gambit_fn_021E7B58(CPUState* cpu) {
         /* 021E7B90 */ Gambit_fn_02228894(cpu);
         /* 021E7B94 */ cpu->r[11] = 0x10030000u;
         /* 021E7B98 */ cpu->r[30] = cpu->r[31] + 0x00000128u;
-        /* 021E7B98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021E7B98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021E7B9C */ cpu->r[11] = cpu->r[11] + 0x00005A30u;
         /* 021E7BA0 */ cpu->r[28] = 0x00000000u;
         /* 021E7BA4 */ _t8 = cpu->r[31] + 0x00000004u;
         /* 021E7BA4 */ rbrew_write32(cpu->mem, _t8, cpu->r[11]);
-        /* 021E7BA8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7BA8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7BA8 */ _t10 = _t9 & 0x00000001u;
         /* 021E7BA8 */ if (_t10) goto L_021E7BAC; else goto L_021E7BBC;
   L_021E7BAC: ; // 0x21e7bac
         /* 021E7BAC */ cpu->r[3] = 0x00000038u;
         /* 021E7BB0 */ Gambit_fn_02801A78(cpu);
         /* 021E7BB4 */ cpu->r[30] = cpu->r[3];
-        /* 021E7BB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021E7BB8 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7BB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021E7BB8 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7BB8 */ _t12 = _t11 & 0x00000001u;
         /* 021E7BB8 */ if (_t12) goto L_021E7BEC; else goto L_021E7BBC;
   L_021E7BBC: ; // 0x21e7bbc
@@ -5848,10 +5848,10 @@ void Gambit_fn_021E7B58(CPUState* cpu) {
         /* 021E7BF0 */ _t21 = cpu->r[10] + 0x00005890u;
         /* 021E7BF0 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t21);
         /* 021E7BF4 */ cpu->r[0] = cpu->r[31] + 0x00000164u;
-        /* 021E7BF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021E7BF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021E7BF8 */ _t22 = cpu->r[31] + 0x00000160u;
         /* 021E7BF8 */ rbrew_write_f32(cpu->mem, _t22, cpu->f[31]);
-        /* 021E7BFC */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7BFC */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7BFC */ _t24 = _t23 & 0x00000001u;
         /* 021E7BFC */ if (_t24) goto L_021E7C00; else goto L_021E7C08;
   L_021E7C00: ; // 0x21e7c00
@@ -5859,8 +5859,8 @@ void Gambit_fn_021E7B58(CPUState* cpu) {
         /* 021E7C04 */ Gambit_fn_02801A78(cpu);
   L_021E7C08: ; // 0x21e7c08
         /* 021E7C08 */ cpu->r[5] = cpu->r[31] + 0x00000194u;
-        /* 021E7C08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 021E7C0C */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7C08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 021E7C0C */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7C0C */ _t26 = _t25 & 0x00000001u;
         /* 021E7C0C */ if (_t26) goto L_021E7C10; else goto L_021E7C18;
   L_021E7C10: ; // 0x21e7c10
@@ -5868,29 +5868,29 @@ void Gambit_fn_021E7B58(CPUState* cpu) {
         /* 021E7C14 */ Gambit_fn_02801A78(cpu);
   L_021E7C18: ; // 0x21e7c18
         /* 021E7C18 */ cpu->r[30] = cpu->r[31] + 0x000001A0u;
-        /* 021E7C18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021E7C1C */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7C18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021E7C1C */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7C1C */ _t28 = _t27 & 0x00000001u;
         /* 021E7C1C */ if (_t28) goto L_021E7C20; else goto L_021E7C30;
   L_021E7C20: ; // 0x21e7c20
         /* 021E7C20 */ cpu->r[3] = 0x000000D0u;
         /* 021E7C24 */ Gambit_fn_02801A78(cpu);
         /* 021E7C28 */ cpu->r[30] = cpu->r[3];
-        /* 021E7C28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021E7C2C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7C28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021E7C2C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7C2C */ _t30 = _t29 & 0x00000001u;
         /* 021E7C2C */ if (_t30) goto L_021E7C74; else goto L_021E7C30;
   L_021E7C30: ; // 0x21e7c30
         /* 021E7C30 */ cpu->r[3] = cpu->r[30];
-        /* 021E7C30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E7C34 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7C30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E7C34 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7C34 */ _t32 = _t31 & 0x00000001u;
         /* 021E7C34 */ if (_t32) goto L_021E7C38; else goto L_021E7C48;
   L_021E7C38: ; // 0x21e7c38
         /* 021E7C38 */ cpu->r[3] = 0x00000010u;
         /* 021E7C3C */ Gambit_fn_02801A78(cpu);
-        /* 021E7C40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E7C44 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7C40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E7C44 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7C44 */ _t34 = _t33 & 0x00000001u;
         /* 021E7C44 */ if (_t34) goto L_021E7C58; else goto L_021E7C48;
   L_021E7C48: ; // 0x21e7c48
@@ -5904,8 +5904,8 @@ void Gambit_fn_021E7B58(CPUState* cpu) {
         /* 021E7C54 */ rbrew_write32(cpu->mem, _t38, cpu->r[28]);
   L_021E7C58: ; // 0x21e7c58
         /* 021E7C58 */ cpu->r[0] = cpu->r[30] + 0x00000010u;
-        /* 021E7C58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E7C5C */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7C58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E7C5C */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7C5C */ _t40 = _t39 & 0x00000001u;
         /* 021E7C5C */ if (_t40) goto L_021E7C74; else goto L_021E7C60;
   L_021E7C60: ; // 0x21e7c60
@@ -5925,10 +5925,10 @@ void Gambit_fn_021E7B58(CPUState* cpu) {
         /* 021E7C7C */ _t46 = cpu->r[31] + 0x00000274u;
         /* 021E7C7C */ rbrew_write16(cpu->mem, _t46, (uint16_t)cpu->r[28]);
         /* 021E7C80 */ cpu->r[0] = cpu->r[31] + 0x00000278u;
-        /* 021E7C80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021E7C80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021E7C84 */ _t47 = cpu->r[31] + 0x00000276u;
         /* 021E7C84 */ rbrew_write8(cpu->mem, _t47, (uint8_t)cpu->r[7]);
-        /* 021E7C88 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7C88 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7C88 */ _t49 = _t48 & 0x00000001u;
         /* 021E7C88 */ if (_t49) goto L_021E7C8C; else goto L_021E7C94;
   L_021E7C8C: ; // 0x21e7c8c
@@ -5936,15 +5936,15 @@ void Gambit_fn_021E7B58(CPUState* cpu) {
         /* 021E7C90 */ Gambit_fn_02801A78(cpu);
   L_021E7C94: ; // 0x21e7c94
         /* 021E7C94 */ cpu->r[3] = cpu->r[31] + 0x00000284u;
-        /* 021E7C94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E7C98 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7C94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E7C98 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7C98 */ _t51 = _t50 & 0x00000001u;
         /* 021E7C98 */ if (_t51) goto L_021E7C9C; else goto L_021E7CAC;
   L_021E7C9C: ; // 0x21e7c9c
         /* 021E7C9C */ cpu->r[3] = 0x00000004u;
         /* 021E7CA0 */ Gambit_fn_02801A78(cpu);
-        /* 021E7CA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E7CA8 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7CA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E7CA8 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7CA8 */ _t53 = _t52 & 0x00000001u;
         /* 021E7CA8 */ if (_t53) goto L_021E7CB0; else goto L_021E7CAC;
   L_021E7CAC: ; // 0x21e7cac
@@ -5984,23 +5984,23 @@ void Gambit_fn_021E7B58(CPUState* cpu) {
         /* 021E7D0C */ _t62 = cpu->r[12] + 0x00000000u;
         /* 021E7D0C */ cpu->r[10] = rbrew_read8(cpu->mem, _t62);
         /* 021E7D10 */ cpu->r[7] = 0x00080000u;
-        /* 021E7D14 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[30]);
+        /* 021E7D14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[30]));
         /* 021E7D18 */ cpu->r[29] = 0x00000000u;
-        /* 021E7D1C */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7D1C */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7D1C */ _t64 = _t63 & 0x00000001u;
         /* 021E7D1C */ if (_t64) goto L_021E7D44; else goto L_021E7D20;
   L_021E7D20: ; // 0x21e7d20
         /* 021E7D20 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 021E7D24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[7]);
+        /* 021E7D24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[7]));
         /* 021E7D28 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 021E7D2C */ _t65 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E7D2C */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E7D2C */ _t66 = _t65 & 0x00000001u;
         /* 021E7D2C */ if (_t66) goto L_021E7D40; else goto L_021E7D30;
   L_021E7D30: ; // 0x21e7d30
         /* 021E7D30 */ _t67 = cpu->r[12] + 0x00000000u;
         /* 021E7D30 */ cpu->r[11] = rbrew_read8(cpu->mem, _t67);
-        /* 021E7D34 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[30]);
-        /* 021E7D38 */ _t68 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7D34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[30]));
+        /* 021E7D38 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7D38 */ _t69 = _t68 & 0x00000001u;
         /* 021E7D38 */ if (_t69) goto L_021E7D3C; else goto L_021E7D20;
   L_021E7D3C: ; // 0x21e7d3c
@@ -6010,8 +6010,8 @@ void Gambit_fn_021E7B58(CPUState* cpu) {
   L_021E7D44: ; // 0x21e7d44
         /* 021E7D44 */ _t70 = cpu->r[24] + 0x00000008u;
         /* 021E7D44 */ cpu->r[11] = rbrew_read32(cpu->mem, _t70);
-        /* 021E7D48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[11]);
-        /* 021E7D4C */ _t71 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E7D48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[11]));
+        /* 021E7D4C */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E7D4C */ _t72 = _t71 & 0x00000001u;
         /* 021E7D4C */ if (_t72) goto L_021E7D54; else goto L_021E7D50;
   L_021E7D50: ; // 0x21e7d50
@@ -6072,10 +6072,10 @@ void Gambit_fn_021E7B58(CPUState* cpu) {
         /* 021E7DE4 */ rbrew_write32(cpu->mem, _t88, cpu->r[0]);
         /* 021E7DE8 */ _t89 = cpu->r[31] + 0x0000013Cu;
         /* 021E7DE8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t89);
-        /* 021E7DEC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x00000001u);
+        /* 021E7DEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x00000001u));
         /* 021E7DF0 */ _t90 = cpu->r[31] + 0x00000140u;
         /* 021E7DF0 */ cpu->r[27] = rbrew_read32(cpu->mem, _t90);
-        /* 021E7DF4 */ _t91 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E7DF4 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E7DF4 */ _t92 = _t91 & 0x00000001u;
         /* 021E7DF4 */ if (_t92) goto L_021E7DF8; else goto L_021E7DFC;
   L_021E7DF8: ; // 0x21e7df8
@@ -6091,23 +6091,23 @@ void Gambit_fn_021E7B58(CPUState* cpu) {
         /* 021E7E10 */ _t95 = cpu->r[8] + 0x00000000u;
         /* 021E7E10 */ cpu->r[6] = rbrew_read8(cpu->mem, _t95);
         /* 021E7E14 */ cpu->r[9] = 0x00080000u;
-        /* 021E7E18 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[30]);
+        /* 021E7E18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[30]));
         /* 021E7E1C */ cpu->r[29] = 0x00000000u;
-        /* 021E7E20 */ _t96 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7E20 */ _t96 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7E20 */ _t97 = _t96 & 0x00000001u;
         /* 021E7E20 */ if (_t97) goto L_021E7E48; else goto L_021E7E24;
   L_021E7E24: ; // 0x21e7e24
         /* 021E7E24 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 021E7E28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[9]);
+        /* 021E7E28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[9]));
         /* 021E7E2C */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 021E7E30 */ _t98 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E7E30 */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E7E30 */ _t99 = _t98 & 0x00000001u;
         /* 021E7E30 */ if (_t99) goto L_021E7E44; else goto L_021E7E34;
   L_021E7E34: ; // 0x21e7e34
         /* 021E7E34 */ _t100 = cpu->r[8] + 0x00000000u;
         /* 021E7E34 */ cpu->r[7] = rbrew_read8(cpu->mem, _t100);
-        /* 021E7E38 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[30]);
-        /* 021E7E3C */ _t101 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7E38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[30]));
+        /* 021E7E3C */ _t101 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7E3C */ _t102 = _t101 & 0x00000001u;
         /* 021E7E3C */ if (_t102) goto L_021E7E40; else goto L_021E7E24;
   L_021E7E40: ; // 0x21e7e40
@@ -6117,8 +6117,8 @@ void Gambit_fn_021E7B58(CPUState* cpu) {
   L_021E7E48: ; // 0x21e7e48
         /* 021E7E48 */ _t103 = cpu->r[27] + 0x00000008u;
         /* 021E7E48 */ cpu->r[6] = rbrew_read32(cpu->mem, _t103);
-        /* 021E7E4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[6]);
-        /* 021E7E50 */ _t104 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E7E4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[6]));
+        /* 021E7E50 */ _t104 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E7E50 */ _t105 = _t104 & 0x00000001u;
         /* 021E7E50 */ if (_t105) goto L_021E7E58; else goto L_021E7E54;
   L_021E7E54: ; // 0x21e7e54
@@ -6179,10 +6179,10 @@ void Gambit_fn_021E7B58(CPUState* cpu) {
         /* 021E7EE8 */ rbrew_write32(cpu->mem, _t121, cpu->r[0]);
         /* 021E7EEC */ _t122 = cpu->r[31] + 0x0000013Cu;
         /* 021E7EEC */ cpu->r[0] = rbrew_read32(cpu->mem, _t122);
-        /* 021E7EF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000002u);
+        /* 021E7EF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000002u));
         /* 021E7EF4 */ _t123 = cpu->r[31] + 0x00000140u;
         /* 021E7EF4 */ cpu->r[29] = rbrew_read32(cpu->mem, _t123);
-        /* 021E7EF8 */ _t124 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E7EF8 */ _t124 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E7EF8 */ _t125 = _t124 & 0x00000001u;
         /* 021E7EF8 */ if (_t125) goto L_021E7EFC; else goto L_021E7F00;
   L_021E7EFC: ; // 0x21e7efc
@@ -6198,23 +6198,23 @@ void Gambit_fn_021E7B58(CPUState* cpu) {
         /* 021E7F14 */ _t128 = cpu->r[9] + 0x00000000u;
         /* 021E7F14 */ cpu->r[10] = rbrew_read8(cpu->mem, _t128);
         /* 021E7F18 */ cpu->r[27] = 0x00000000u;
-        /* 021E7F1C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[30]);
+        /* 021E7F1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[30]));
         /* 021E7F20 */ cpu->r[11] = 0x00080000u;
-        /* 021E7F24 */ _t129 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7F24 */ _t129 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7F24 */ _t130 = _t129 & 0x00000001u;
         /* 021E7F24 */ if (_t130) goto L_021E7F4C; else goto L_021E7F28;
   L_021E7F28: ; // 0x21e7f28
         /* 021E7F28 */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 021E7F2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[11]);
+        /* 021E7F2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[11]));
         /* 021E7F30 */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 021E7F34 */ _t131 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E7F34 */ _t131 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E7F34 */ _t132 = _t131 & 0x00000001u;
         /* 021E7F34 */ if (_t132) goto L_021E7F48; else goto L_021E7F38;
   L_021E7F38: ; // 0x21e7f38
         /* 021E7F38 */ _t133 = cpu->r[9] + 0x00000000u;
         /* 021E7F38 */ cpu->r[0] = rbrew_read8(cpu->mem, _t133);
-        /* 021E7F3C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
-        /* 021E7F40 */ _t134 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E7F3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
+        /* 021E7F40 */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E7F40 */ _t135 = _t134 & 0x00000001u;
         /* 021E7F40 */ if (_t135) goto L_021E7F44; else goto L_021E7F28;
   L_021E7F44: ; // 0x21e7f44
@@ -6226,10 +6226,10 @@ void Gambit_fn_021E7B58(CPUState* cpu) {
         /* 021E7F4C */ cpu->r[8] = rbrew_read32(cpu->mem, _t136);
         /* 021E7F50 */ _t137 = cpu->r[1] + 0x00000010u;
         /* 021E7F50 */ cpu->r[5] = rbrew_read32(cpu->mem, _t137);
-        /* 021E7F54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[8]);
+        /* 021E7F54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[8]));
         /* 021E7F58 */ _t138 = cpu->r[5] + 0x00000014u;
         /* 021E7F58 */ cpu->r[0] = rbrew_read32(cpu->mem, _t138);
-        /* 021E7F5C */ _t139 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E7F5C */ _t139 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E7F5C */ _t140 = _t139 & 0x00000001u;
         /* 021E7F5C */ if (_t140) goto L_021E7F64; else goto L_021E7F60;
   L_021E7F60: ; // 0x21e7f60
@@ -6285,7 +6285,7 @@ void Gambit_fn_021E7B58(CPUState* cpu) {
         /* 021E7FE8 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t153);
         /* 021E7FEC */ _t154 = cpu->r[1] + 0x00000050u;
         /* 021E7FEC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t154);
-        /* 021E7FF0 */ _t155 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E7FF0 */ _t155 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E7FF0 */ _t156 = _t155 & 0x00000001u;
         /* 021E7FF0 */ if (_t156) goto L_021E7FF4; // else: addr-0 trap, fall-through
   L_021E7FF4: ; // 0x21e7ff4
@@ -6478,7 +6478,7 @@ void Gambit_fn_021E8004(CPUState* cpu) {
         /* 021E81B4 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t63);
         /* 021E81B8 */ _t64 = cpu->r[1] + 0x000000A0u;
         /* 021E81B8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t64);
-        /* 021E81BC */ _t65 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E81BC */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E81BC */ _t66 = _t65 & 0x00000001u;
         /* 021E81BC */ if (_t66) goto L_021E81C0; // else: addr-0 trap, fall-through
   L_021E81C0: ; // 0x21e81c0
@@ -6671,7 +6671,7 @@ void Gambit_fn_021E81D0(CPUState* cpu) {
         /* 021E81B4 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t63);
         /* 021E81B8 */ _t64 = cpu->r[1] + 0x000000A0u;
         /* 021E81B8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t64);
-        /* 021E81BC */ _t65 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E81BC */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E81BC */ _t66 = _t65 & 0x00000001u;
         /* 021E81BC */ if (_t66) goto L_021E81C0; // else: addr-0 trap, fall-through
   L_021E81C0: ; // 0x21e81c0
@@ -6869,7 +6869,7 @@ void Gambit_fn_021E8284(CPUState* cpu) {
         /* 021E82C0 */ cpu->r[4] = 0x101D0000u;
         /* 021E82C4 */ _t9 = cpu->r[1] + 0x00000008u;
         /* 021E82C4 */ rbrew_write32(cpu->mem, _t9, cpu->r[9]);
-        /* 021E82C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021E82C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021E82CC */ _t10 = cpu->r[1] + 0x00000010u;
         /* 021E82CC */ rbrew_write32(cpu->mem, _t10, cpu->r[11]);
         /* 021E82D0 */ cpu->r[4] = cpu->r[4] + 0xFFFFFCA8u;
@@ -6880,7 +6880,7 @@ void Gambit_fn_021E8284(CPUState* cpu) {
         /* 021E82DC */ cpu->r[30] = cpu->r[5];
         /* 021E82E0 */ _t13 = cpu->r[1] + 0x0000000Cu;
         /* 021E82E0 */ rbrew_write32(cpu->mem, _t13, cpu->r[0]);
-        /* 021E82E4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E82E4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E82E4 */ _t15 = _t14 & 0x00000001u;
         /* 021E82E4 */ if (_t15) goto L_021E82E8; else goto L_021E82FC;
   L_021E82E8: ; // 0x21e82e8
@@ -6892,8 +6892,8 @@ void Gambit_fn_021E8284(CPUState* cpu) {
         /* 021E82F8 */ _t17 = cpu->r[4] + 0x00000000u;
         /* 021E82F8 */ rbrew_write32(cpu->mem, _t17, cpu->r[6]);
   L_021E82FC: ; // 0x21e82fc
-        /* 021E82FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E8300 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E82FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E8300 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E8300 */ _t19 = _t18 & 0x00000001u;
         /* 021E8300 */ if (_t19) goto L_021E8320; else goto L_021E8304;
   L_021E8304: ; // 0x21e8304
@@ -6904,23 +6904,23 @@ void Gambit_fn_021E8284(CPUState* cpu) {
         /* 021E830C */ cpu->ctr = cpu->r[10];
         /* 021E8310 */ cpu->r[3] = cpu->r[31];
         /* 021E8314 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021E8318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E831C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E8318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E831C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E831C */ _t23 = _t22 & 0x00000001u;
         /* 021E831C */ if (_t23) goto L_021E8320; else goto L_021E8334;
   L_021E8320: ; // 0x21e8320
         /* 021E8320 */ _t24 = cpu->r[28] + 0x000001ACu;
         /* 021E8320 */ cpu->r[8] = rbrew_read32(cpu->mem, _t24);
-        /* 021E8324 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021E8324 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021E8328 */ cpu->r[31] = 0x00000000u;
-        /* 021E832C */ _t25 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E832C */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E832C */ _t26 = _t25 & 0x00000001u;
         /* 021E832C */ if (_t26) goto L_021E8354; else goto L_021E8330;
   L_021E8330: ; // 0x21e8330
         /* 021E8330 */ goto L_021E839C;
   L_021E8334: ; // 0x21e8334
-        /* 021E8334 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E8338 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E8334 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E8338 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E8338 */ _t28 = _t27 & 0x00000001u;
         /* 021E8338 */ if (_t28) goto L_021E8348; else goto L_021E833C;
   L_021E833C: ; // 0x21e833c
@@ -6930,8 +6930,8 @@ void Gambit_fn_021E8284(CPUState* cpu) {
   L_021E8348: ; // 0x21e8348
         /* 021E8348 */ _t29 = cpu->r[28] + 0x000001ACu;
         /* 021E8348 */ cpu->r[8] = rbrew_read32(cpu->mem, _t29);
-        /* 021E834C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021E8350 */ _t30 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E834C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021E8350 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E8350 */ _t31 = _t30 & 0x00000001u;
         /* 021E8350 */ if (_t31) goto L_021E8354; else goto L_021E839C;
   L_021E8354: ; // 0x21e8354
@@ -6939,10 +6939,10 @@ void Gambit_fn_021E8284(CPUState* cpu) {
         /* 021E8354 */ cpu->r[8] = rbrew_read32(cpu->mem, _t32);
         /* 021E8358 */ _t33 = cpu->r[28] + 0x000001A4u;
         /* 021E8358 */ cpu->r[0] = rbrew_read32(cpu->mem, _t33);
-        /* 021E835C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], cpu->r[0]);
+        /* 021E835C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], cpu->r[0]));
         /* 021E8360 */ _t34 = cpu->r[28] + 0x000001A0u;
         /* 021E8360 */ cpu->r[11] = rbrew_read32(cpu->mem, _t34);
-        /* 021E8364 */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E8364 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E8364 */ _t36 = _t35 & 0x00000001u;
         /* 021E8364 */ if (_t36) goto L_021E836C; else goto L_021E8368;
   L_021E8368: ; // 0x21e8368
@@ -6964,8 +6964,8 @@ void Gambit_fn_021E8284(CPUState* cpu) {
         /* 021E8388 */ rbrew_write32(cpu->mem, _t42, cpu->r[7]);
         /* 021E838C */ _t43 = cpu->r[28] + 0x000001ACu;
         /* 021E838C */ cpu->r[8] = rbrew_read32(cpu->mem, _t43);
-        /* 021E8390 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000008u);
-        /* 021E8394 */ _t44 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E8390 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000008u));
+        /* 021E8394 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E8394 */ _t45 = _t44 & 0x00000001u;
         /* 021E8394 */ if (_t45) goto L_021E8398; else goto L_021E842C;
   L_021E8398: ; // 0x21e8398
@@ -6987,13 +6987,13 @@ void Gambit_fn_021E8284(CPUState* cpu) {
         /* 021E83B4 */ rbrew_write32(cpu->mem, _t52, cpu->r[7]);
         /* 021E83B8 */ _t53 = cpu->r[28] + 0x000001ACu;
         /* 021E83B8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t53);
-        /* 021E83BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000008u);
-        /* 021E83C0 */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E83BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000008u));
+        /* 021E83C0 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E83C0 */ _t55 = _t54 & 0x00000001u;
         /* 021E83C0 */ if (_t55) goto L_021E83C4; else goto L_021E842C;
   L_021E83C4: ; // 0x21e83c4
-        /* 021E83C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000008u);
-        /* 021E83C8 */ _t56 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E83C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000008u));
+        /* 021E83C8 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E83C8 */ _t57 = _t56 & 0x00000001u;
         /* 021E83C8 */ if (_t57) goto L_021E83CC; else goto L_021E840C;
   L_021E83CC: ; // 0x21e83cc
@@ -7002,10 +7002,10 @@ void Gambit_fn_021E8284(CPUState* cpu) {
         /* 021E83D0 */ _t59 = cpu->r[28] + 0x000001A4u;
         /* 021E83D0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t59);
         /* 021E83D4 */ cpu->r[6] = cpu->r[8] + 0x00000008u;
-        /* 021E83D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], cpu->r[0]);
+        /* 021E83D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], cpu->r[0]));
         /* 021E83DC */ _t60 = cpu->r[28] + 0x000001A0u;
         /* 021E83DC */ cpu->r[10] = rbrew_read32(cpu->mem, _t60);
-        /* 021E83E0 */ _t61 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E83E0 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E83E0 */ _t62 = _t61 & 0x00000001u;
         /* 021E83E0 */ if (_t62) goto L_021E83E8; else goto L_021E83E4;
   L_021E83E4: ; // 0x21e83e4
@@ -7042,8 +7042,8 @@ void Gambit_fn_021E8284(CPUState* cpu) {
         /* 021E8424 */ rbrew_write32(cpu->mem, _t74, cpu->r[0]);
         /* 021E8428 */ goto L_021E84B8;
   L_021E842C: ; // 0x21e842c
-        /* 021E842C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E8430 */ _t75 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E842C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E8430 */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E8430 */ _t76 = _t75 & 0x00000001u;
         /* 021E8430 */ if (_t76) goto L_021E8450; else goto L_021E8434;
   L_021E8434: ; // 0x21e8434
@@ -7061,8 +7061,8 @@ void Gambit_fn_021E8284(CPUState* cpu) {
         /* 021E8448 */ rbrew_write32(cpu->mem, _t82, cpu->r[0]);
         /* 021E844C */ goto L_021E84B8;
   L_021E8450: ; // 0x21e8450
-        /* 021E8450 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021E8454 */ _t83 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E8450 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021E8454 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E8454 */ _t84 = _t83 & 0x00000001u;
         /* 021E8454 */ if (_t84) goto L_021E8458; else goto L_021E849C;
   L_021E8458: ; // 0x21e8458
@@ -7072,10 +7072,10 @@ void Gambit_fn_021E8284(CPUState* cpu) {
         /* 021E8460 */ _t86 = cpu->r[28] + 0x000001A4u;
         /* 021E8460 */ cpu->r[0] = rbrew_read32(cpu->mem, _t86);
         /* 021E8464 */ cpu->r[7] = cpu->r[11] + 0xFFFFFFFFu;
-        /* 021E8468 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], cpu->r[0]);
+        /* 021E8468 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], cpu->r[0]));
         /* 021E846C */ _t87 = cpu->r[28] + 0x000001A0u;
         /* 021E846C */ cpu->r[6] = rbrew_read32(cpu->mem, _t87);
-        /* 021E8470 */ _t88 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E8470 */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E8470 */ _t89 = _t88 & 0x00000001u;
         /* 021E8470 */ if (_t89) goto L_021E8478; else goto L_021E8474;
   L_021E8474: ; // 0x21e8474
@@ -7160,7 +7160,7 @@ void Gambit_fn_021E8288(CPUState* cpu) {
         /* 021E82C0 */ cpu->r[4] = 0x101D0000u;
         /* 021E82C4 */ _t9 = cpu->r[1] + 0x00000008u;
         /* 021E82C4 */ rbrew_write32(cpu->mem, _t9, cpu->r[9]);
-        /* 021E82C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021E82C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021E82CC */ _t10 = cpu->r[1] + 0x00000010u;
         /* 021E82CC */ rbrew_write32(cpu->mem, _t10, cpu->r[11]);
         /* 021E82D0 */ cpu->r[4] = cpu->r[4] + 0xFFFFFCA8u;
@@ -7171,7 +7171,7 @@ void Gambit_fn_021E8288(CPUState* cpu) {
         /* 021E82DC */ cpu->r[30] = cpu->r[5];
         /* 021E82E0 */ _t13 = cpu->r[1] + 0x0000000Cu;
         /* 021E82E0 */ rbrew_write32(cpu->mem, _t13, cpu->r[0]);
-        /* 021E82E4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E82E4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E82E4 */ _t15 = _t14 & 0x00000001u;
         /* 021E82E4 */ if (_t15) goto L_021E82E8; else goto L_021E82FC;
   L_021E82E8: ; // 0x21e82e8
@@ -7183,8 +7183,8 @@ void Gambit_fn_021E8288(CPUState* cpu) {
         /* 021E82F8 */ _t17 = cpu->r[4] + 0x00000000u;
         /* 021E82F8 */ rbrew_write32(cpu->mem, _t17, cpu->r[6]);
   L_021E82FC: ; // 0x21e82fc
-        /* 021E82FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E8300 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E82FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E8300 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E8300 */ _t19 = _t18 & 0x00000001u;
         /* 021E8300 */ if (_t19) goto L_021E8320; else goto L_021E8304;
   L_021E8304: ; // 0x21e8304
@@ -7195,23 +7195,23 @@ void Gambit_fn_021E8288(CPUState* cpu) {
         /* 021E830C */ cpu->ctr = cpu->r[10];
         /* 021E8310 */ cpu->r[3] = cpu->r[31];
         /* 021E8314 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021E8318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E831C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E8318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E831C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E831C */ _t23 = _t22 & 0x00000001u;
         /* 021E831C */ if (_t23) goto L_021E8320; else goto L_021E8334;
   L_021E8320: ; // 0x21e8320
         /* 021E8320 */ _t24 = cpu->r[28] + 0x000001ACu;
         /* 021E8320 */ cpu->r[8] = rbrew_read32(cpu->mem, _t24);
-        /* 021E8324 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021E8324 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021E8328 */ cpu->r[31] = 0x00000000u;
-        /* 021E832C */ _t25 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E832C */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E832C */ _t26 = _t25 & 0x00000001u;
         /* 021E832C */ if (_t26) goto L_021E8354; else goto L_021E8330;
   L_021E8330: ; // 0x21e8330
         /* 021E8330 */ goto L_021E839C;
   L_021E8334: ; // 0x21e8334
-        /* 021E8334 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E8338 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E8334 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E8338 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E8338 */ _t28 = _t27 & 0x00000001u;
         /* 021E8338 */ if (_t28) goto L_021E8348; else goto L_021E833C;
   L_021E833C: ; // 0x21e833c
@@ -7221,8 +7221,8 @@ void Gambit_fn_021E8288(CPUState* cpu) {
   L_021E8348: ; // 0x21e8348
         /* 021E8348 */ _t29 = cpu->r[28] + 0x000001ACu;
         /* 021E8348 */ cpu->r[8] = rbrew_read32(cpu->mem, _t29);
-        /* 021E834C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021E8350 */ _t30 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E834C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021E8350 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E8350 */ _t31 = _t30 & 0x00000001u;
         /* 021E8350 */ if (_t31) goto L_021E8354; else goto L_021E839C;
   L_021E8354: ; // 0x21e8354
@@ -7230,10 +7230,10 @@ void Gambit_fn_021E8288(CPUState* cpu) {
         /* 021E8354 */ cpu->r[8] = rbrew_read32(cpu->mem, _t32);
         /* 021E8358 */ _t33 = cpu->r[28] + 0x000001A4u;
         /* 021E8358 */ cpu->r[0] = rbrew_read32(cpu->mem, _t33);
-        /* 021E835C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], cpu->r[0]);
+        /* 021E835C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], cpu->r[0]));
         /* 021E8360 */ _t34 = cpu->r[28] + 0x000001A0u;
         /* 021E8360 */ cpu->r[11] = rbrew_read32(cpu->mem, _t34);
-        /* 021E8364 */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E8364 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E8364 */ _t36 = _t35 & 0x00000001u;
         /* 021E8364 */ if (_t36) goto L_021E836C; else goto L_021E8368;
   L_021E8368: ; // 0x21e8368
@@ -7255,8 +7255,8 @@ void Gambit_fn_021E8288(CPUState* cpu) {
         /* 021E8388 */ rbrew_write32(cpu->mem, _t42, cpu->r[7]);
         /* 021E838C */ _t43 = cpu->r[28] + 0x000001ACu;
         /* 021E838C */ cpu->r[8] = rbrew_read32(cpu->mem, _t43);
-        /* 021E8390 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000008u);
-        /* 021E8394 */ _t44 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E8390 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000008u));
+        /* 021E8394 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E8394 */ _t45 = _t44 & 0x00000001u;
         /* 021E8394 */ if (_t45) goto L_021E8398; else goto L_021E842C;
   L_021E8398: ; // 0x21e8398
@@ -7278,13 +7278,13 @@ void Gambit_fn_021E8288(CPUState* cpu) {
         /* 021E83B4 */ rbrew_write32(cpu->mem, _t52, cpu->r[7]);
         /* 021E83B8 */ _t53 = cpu->r[28] + 0x000001ACu;
         /* 021E83B8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t53);
-        /* 021E83BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000008u);
-        /* 021E83C0 */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E83BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000008u));
+        /* 021E83C0 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E83C0 */ _t55 = _t54 & 0x00000001u;
         /* 021E83C0 */ if (_t55) goto L_021E83C4; else goto L_021E842C;
   L_021E83C4: ; // 0x21e83c4
-        /* 021E83C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000008u);
-        /* 021E83C8 */ _t56 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E83C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000008u));
+        /* 021E83C8 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E83C8 */ _t57 = _t56 & 0x00000001u;
         /* 021E83C8 */ if (_t57) goto L_021E83CC; else goto L_021E840C;
   L_021E83CC: ; // 0x21e83cc
@@ -7293,10 +7293,10 @@ void Gambit_fn_021E8288(CPUState* cpu) {
         /* 021E83D0 */ _t59 = cpu->r[28] + 0x000001A4u;
         /* 021E83D0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t59);
         /* 021E83D4 */ cpu->r[6] = cpu->r[8] + 0x00000008u;
-        /* 021E83D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], cpu->r[0]);
+        /* 021E83D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], cpu->r[0]));
         /* 021E83DC */ _t60 = cpu->r[28] + 0x000001A0u;
         /* 021E83DC */ cpu->r[10] = rbrew_read32(cpu->mem, _t60);
-        /* 021E83E0 */ _t61 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E83E0 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E83E0 */ _t62 = _t61 & 0x00000001u;
         /* 021E83E0 */ if (_t62) goto L_021E83E8; else goto L_021E83E4;
   L_021E83E4: ; // 0x21e83e4
@@ -7333,8 +7333,8 @@ void Gambit_fn_021E8288(CPUState* cpu) {
         /* 021E8424 */ rbrew_write32(cpu->mem, _t74, cpu->r[0]);
         /* 021E8428 */ goto L_021E84B8;
   L_021E842C: ; // 0x21e842c
-        /* 021E842C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E8430 */ _t75 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E842C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E8430 */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E8430 */ _t76 = _t75 & 0x00000001u;
         /* 021E8430 */ if (_t76) goto L_021E8450; else goto L_021E8434;
   L_021E8434: ; // 0x21e8434
@@ -7352,8 +7352,8 @@ void Gambit_fn_021E8288(CPUState* cpu) {
         /* 021E8448 */ rbrew_write32(cpu->mem, _t82, cpu->r[0]);
         /* 021E844C */ goto L_021E84B8;
   L_021E8450: ; // 0x21e8450
-        /* 021E8450 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021E8454 */ _t83 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E8450 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021E8454 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E8454 */ _t84 = _t83 & 0x00000001u;
         /* 021E8454 */ if (_t84) goto L_021E8458; else goto L_021E849C;
   L_021E8458: ; // 0x21e8458
@@ -7363,10 +7363,10 @@ void Gambit_fn_021E8288(CPUState* cpu) {
         /* 021E8460 */ _t86 = cpu->r[28] + 0x000001A4u;
         /* 021E8460 */ cpu->r[0] = rbrew_read32(cpu->mem, _t86);
         /* 021E8464 */ cpu->r[7] = cpu->r[11] + 0xFFFFFFFFu;
-        /* 021E8468 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], cpu->r[0]);
+        /* 021E8468 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], cpu->r[0]));
         /* 021E846C */ _t87 = cpu->r[28] + 0x000001A0u;
         /* 021E846C */ cpu->r[6] = rbrew_read32(cpu->mem, _t87);
-        /* 021E8470 */ _t88 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E8470 */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E8470 */ _t89 = _t88 & 0x00000001u;
         /* 021E8470 */ if (_t89) goto L_021E8478; else goto L_021E8474;
   L_021E8474: ; // 0x21e8474
@@ -7474,8 +7474,8 @@ void Gambit_fn_021E84D8(CPUState* cpu) {
         /* 021E854C */ cpu->f[8] = fma(cpu->f[0], cpu->f[0], cpu->f[10]);
         /* 021E8550 */ _t17 = cpu->r[12] + 0x00005890u;
         /* 021E8550 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t17);
-        /* 021E8554 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
-        /* 021E8558 */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E8554 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
+        /* 021E8558 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E8558 */ _t19 = _t18 & 0x00000001u;
         /* 021E8558 */ if (_t19) goto L_021E855C; else goto L_021E8598;
   L_021E855C: ; // 0x21e855c
@@ -7507,8 +7507,8 @@ void Gambit_fn_021E84D8(CPUState* cpu) {
         /* 021E85A0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t26);
         /* 021E85A4 */ _t27 = cpu->r[31] + 0x000001A4u;
         /* 021E85A4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t27);
-        /* 021E85A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], cpu->r[11]);
-        /* 021E85AC */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E85A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], cpu->r[11]));
+        /* 021E85AC */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E85AC */ _t29 = _t28 & 0x00000001u;
         /* 021E85AC */ if (_t29) goto L_021E85B0; else goto L_021E864C;
   L_021E85B0: ; // 0x21e85b0
@@ -7517,10 +7517,10 @@ void Gambit_fn_021E84D8(CPUState* cpu) {
         /* 021E85B4 */ _t31 = cpu->r[31] + 0x000001ACu;
         /* 021E85B4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t31);
         /* 021E85B8 */ cpu->r[8] = cpu->r[8] + 0xFFFFFFFFu;
-        /* 021E85B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021E85B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021E85BC */ _t32 = cpu->r[31] + 0x000001A8u;
         /* 021E85BC */ rbrew_write32(cpu->mem, _t32, cpu->r[8]);
-        /* 021E85C0 */ _t33 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E85C0 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E85C0 */ _t34 = _t33 & 0x00000001u;
         /* 021E85C0 */ if (_t34) goto L_021E85C4; else goto L_021E85D0;
   L_021E85C4: ; // 0x21e85c4
@@ -7537,12 +7537,12 @@ void Gambit_fn_021E84D8(CPUState* cpu) {
         /* 021E85D8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t38);
         /* 021E85DC */ _t39 = cpu->r[31] + 0x000001ACu;
         /* 021E85DC */ rbrew_write32(cpu->mem, _t39, cpu->r[10]);
-        /* 021E85E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[11]);
+        /* 021E85E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[11]));
         /* 021E85E4 */ _t40 = cpu->r[31] + 0x000001A0u;
         /* 021E85E4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t40);
         /* 021E85E8 */ _t41 = cpu->r[31] + 0x000000FCu;
         /* 021E85E8 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t41);
-        /* 021E85EC */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E85EC */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E85EC */ _t43 = _t42 & 0x00000001u;
         /* 021E85EC */ if (_t43) goto L_021E85F4; else goto L_021E85F0;
   L_021E85F0: ; // 0x21e85f0
@@ -7576,25 +7576,25 @@ void Gambit_fn_021E84D8(CPUState* cpu) {
         /* 021E8634 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 021E8638 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 021E863C */ Gambit_fn_021C6DD8(cpu);
-        /* 021E8640 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E8644 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E8640 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E8644 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E8644 */ _t54 = _t53 & 0x00000001u;
         /* 021E8644 */ if (_t54) goto L_021E8700; else goto L_021E8648;
   L_021E8648: ; // 0x21e8648
         /* 021E8648 */ goto L_021E8714;
   L_021E864C: ; // 0x21e864c
-        /* 021E864C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021E8650 */ _t55 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E864C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021E8650 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E8650 */ _t56 = _t55 & 0x00000001u;
         /* 021E8650 */ if (_t56) goto L_021E8654; else goto L_021E86C8;
   L_021E8654: ; // 0x21e8654
         /* 021E8654 */ _t57 = cpu->r[31] + 0x000001A4u;
         /* 021E8654 */ cpu->r[11] = rbrew_read32(cpu->mem, _t57);
         /* 021E8658 */ cpu->r[10] = cpu->r[10] + 0xFFFFFFFFu;
-        /* 021E865C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], cpu->r[11]);
+        /* 021E865C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], cpu->r[11]));
         /* 021E8660 */ _t58 = cpu->r[31] + 0x000001ACu;
         /* 021E8660 */ rbrew_write32(cpu->mem, _t58, cpu->r[10]);
-        /* 021E8664 */ _t59 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E8664 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E8664 */ _t60 = _t59 & 0x00000001u;
         /* 021E8664 */ if (_t60) goto L_021E8668; else goto L_021E86C8;
   L_021E8668: ; // 0x21e8668
@@ -7603,10 +7603,10 @@ void Gambit_fn_021E84D8(CPUState* cpu) {
         /* 021E866C */ _t62 = cpu->r[31] + 0x000001ACu;
         /* 021E866C */ cpu->r[10] = rbrew_read32(cpu->mem, _t62);
         /* 021E8670 */ cpu->r[8] = cpu->r[8] + 0xFFFFFFFFu;
-        /* 021E8670 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021E8670 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021E8674 */ _t63 = cpu->r[31] + 0x000001A8u;
         /* 021E8674 */ rbrew_write32(cpu->mem, _t63, cpu->r[8]);
-        /* 021E8678 */ _t64 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E8678 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E8678 */ _t65 = _t64 & 0x00000001u;
         /* 021E8678 */ if (_t65) goto L_021E867C; else goto L_021E8688;
   L_021E867C: ; // 0x21e867c
@@ -7621,10 +7621,10 @@ void Gambit_fn_021E84D8(CPUState* cpu) {
         /* 021E868C */ cpu->r[10] = cpu->r[10] + 0x00000001u;
         /* 021E8690 */ _t69 = cpu->r[31] + 0x000001A8u;
         /* 021E8690 */ cpu->r[12] = rbrew_read32(cpu->mem, _t69);
-        /* 021E8694 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[11]);
+        /* 021E8694 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[11]));
         /* 021E8698 */ _t70 = cpu->r[31] + 0x000001ACu;
         /* 021E8698 */ rbrew_write32(cpu->mem, _t70, cpu->r[10]);
-        /* 021E869C */ _t71 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E869C */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E869C */ _t72 = _t71 & 0x00000001u;
         /* 021E869C */ if (_t72) goto L_021E86A4; else goto L_021E86A0;
   L_021E86A0: ; // 0x21e86a0
@@ -7663,8 +7663,8 @@ void Gambit_fn_021E84D8(CPUState* cpu) {
         /* 021E86EC */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 021E86F0 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 021E86F4 */ Gambit_fn_021C6DD8(cpu);
-        /* 021E86F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E86FC */ _t84 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E86F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E86FC */ _t84 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E86FC */ _t85 = _t84 & 0x00000001u;
         /* 021E86FC */ if (_t85) goto L_021E8700; else goto L_021E8714;
   L_021E8700: ; // 0x21e8700
@@ -7779,8 +7779,8 @@ void Gambit_fn_021E84DC(CPUState* cpu) {
         /* 021E854C */ cpu->f[8] = fma(cpu->f[0], cpu->f[0], cpu->f[10]);
         /* 021E8550 */ _t17 = cpu->r[12] + 0x00005890u;
         /* 021E8550 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t17);
-        /* 021E8554 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
-        /* 021E8558 */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E8554 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
+        /* 021E8558 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E8558 */ _t19 = _t18 & 0x00000001u;
         /* 021E8558 */ if (_t19) goto L_021E855C; else goto L_021E8598;
   L_021E855C: ; // 0x21e855c
@@ -7812,8 +7812,8 @@ void Gambit_fn_021E84DC(CPUState* cpu) {
         /* 021E85A0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t26);
         /* 021E85A4 */ _t27 = cpu->r[31] + 0x000001A4u;
         /* 021E85A4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t27);
-        /* 021E85A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], cpu->r[11]);
-        /* 021E85AC */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E85A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], cpu->r[11]));
+        /* 021E85AC */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E85AC */ _t29 = _t28 & 0x00000001u;
         /* 021E85AC */ if (_t29) goto L_021E85B0; else goto L_021E864C;
   L_021E85B0: ; // 0x21e85b0
@@ -7822,10 +7822,10 @@ void Gambit_fn_021E84DC(CPUState* cpu) {
         /* 021E85B4 */ _t31 = cpu->r[31] + 0x000001ACu;
         /* 021E85B4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t31);
         /* 021E85B8 */ cpu->r[8] = cpu->r[8] + 0xFFFFFFFFu;
-        /* 021E85B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021E85B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021E85BC */ _t32 = cpu->r[31] + 0x000001A8u;
         /* 021E85BC */ rbrew_write32(cpu->mem, _t32, cpu->r[8]);
-        /* 021E85C0 */ _t33 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E85C0 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E85C0 */ _t34 = _t33 & 0x00000001u;
         /* 021E85C0 */ if (_t34) goto L_021E85C4; else goto L_021E85D0;
   L_021E85C4: ; // 0x21e85c4
@@ -7842,12 +7842,12 @@ void Gambit_fn_021E84DC(CPUState* cpu) {
         /* 021E85D8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t38);
         /* 021E85DC */ _t39 = cpu->r[31] + 0x000001ACu;
         /* 021E85DC */ rbrew_write32(cpu->mem, _t39, cpu->r[10]);
-        /* 021E85E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[11]);
+        /* 021E85E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[11]));
         /* 021E85E4 */ _t40 = cpu->r[31] + 0x000001A0u;
         /* 021E85E4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t40);
         /* 021E85E8 */ _t41 = cpu->r[31] + 0x000000FCu;
         /* 021E85E8 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t41);
-        /* 021E85EC */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E85EC */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E85EC */ _t43 = _t42 & 0x00000001u;
         /* 021E85EC */ if (_t43) goto L_021E85F4; else goto L_021E85F0;
   L_021E85F0: ; // 0x21e85f0
@@ -7881,25 +7881,25 @@ void Gambit_fn_021E84DC(CPUState* cpu) {
         /* 021E8634 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 021E8638 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 021E863C */ Gambit_fn_021C6DD8(cpu);
-        /* 021E8640 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E8644 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E8640 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E8644 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E8644 */ _t54 = _t53 & 0x00000001u;
         /* 021E8644 */ if (_t54) goto L_021E8700; else goto L_021E8648;
   L_021E8648: ; // 0x21e8648
         /* 021E8648 */ goto L_021E8714;
   L_021E864C: ; // 0x21e864c
-        /* 021E864C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021E8650 */ _t55 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E864C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021E8650 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E8650 */ _t56 = _t55 & 0x00000001u;
         /* 021E8650 */ if (_t56) goto L_021E8654; else goto L_021E86C8;
   L_021E8654: ; // 0x21e8654
         /* 021E8654 */ _t57 = cpu->r[31] + 0x000001A4u;
         /* 021E8654 */ cpu->r[11] = rbrew_read32(cpu->mem, _t57);
         /* 021E8658 */ cpu->r[10] = cpu->r[10] + 0xFFFFFFFFu;
-        /* 021E865C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], cpu->r[11]);
+        /* 021E865C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], cpu->r[11]));
         /* 021E8660 */ _t58 = cpu->r[31] + 0x000001ACu;
         /* 021E8660 */ rbrew_write32(cpu->mem, _t58, cpu->r[10]);
-        /* 021E8664 */ _t59 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E8664 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E8664 */ _t60 = _t59 & 0x00000001u;
         /* 021E8664 */ if (_t60) goto L_021E8668; else goto L_021E86C8;
   L_021E8668: ; // 0x21e8668
@@ -7908,10 +7908,10 @@ void Gambit_fn_021E84DC(CPUState* cpu) {
         /* 021E866C */ _t62 = cpu->r[31] + 0x000001ACu;
         /* 021E866C */ cpu->r[10] = rbrew_read32(cpu->mem, _t62);
         /* 021E8670 */ cpu->r[8] = cpu->r[8] + 0xFFFFFFFFu;
-        /* 021E8670 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021E8670 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021E8674 */ _t63 = cpu->r[31] + 0x000001A8u;
         /* 021E8674 */ rbrew_write32(cpu->mem, _t63, cpu->r[8]);
-        /* 021E8678 */ _t64 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E8678 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E8678 */ _t65 = _t64 & 0x00000001u;
         /* 021E8678 */ if (_t65) goto L_021E867C; else goto L_021E8688;
   L_021E867C: ; // 0x21e867c
@@ -7926,10 +7926,10 @@ void Gambit_fn_021E84DC(CPUState* cpu) {
         /* 021E868C */ cpu->r[10] = cpu->r[10] + 0x00000001u;
         /* 021E8690 */ _t69 = cpu->r[31] + 0x000001A8u;
         /* 021E8690 */ cpu->r[12] = rbrew_read32(cpu->mem, _t69);
-        /* 021E8694 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[11]);
+        /* 021E8694 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[11]));
         /* 021E8698 */ _t70 = cpu->r[31] + 0x000001ACu;
         /* 021E8698 */ rbrew_write32(cpu->mem, _t70, cpu->r[10]);
-        /* 021E869C */ _t71 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E869C */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E869C */ _t72 = _t71 & 0x00000001u;
         /* 021E869C */ if (_t72) goto L_021E86A4; else goto L_021E86A0;
   L_021E86A0: ; // 0x21e86a0
@@ -7968,8 +7968,8 @@ void Gambit_fn_021E84DC(CPUState* cpu) {
         /* 021E86EC */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 021E86F0 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 021E86F4 */ Gambit_fn_021C6DD8(cpu);
-        /* 021E86F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E86FC */ _t84 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E86F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E86FC */ _t84 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E86FC */ _t85 = _t84 & 0x00000001u;
         /* 021E86FC */ if (_t85) goto L_021E8700; else goto L_021E8714;
   L_021E8700: ; // 0x21e8700
@@ -8078,8 +8078,8 @@ void Gambit_fn_021E8790(CPUState* cpu) {
         /* 021E87F0 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t14);
         /* 021E87F4 */ _t15 = cpu->r[30] + 0x000001ACu;
         /* 021E87F4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t15);
-        /* 021E87F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021E87FC */ _t16 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E87F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021E87FC */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E87FC */ _t17 = _t16 & 0x00000001u;
         /* 021E87FC */ if (_t17) goto L_021E8878; else goto L_021E8800;
   L_021E8800: ; // 0x21e8800
@@ -8127,7 +8127,7 @@ void Gambit_fn_021E8790(CPUState* cpu) {
         /* 021E885C */ cpu->r[31] = rbrew_read32(cpu->mem, _t35);
         /* 021E8860 */ _t36 = cpu->r[1] + 0x000000D0u;
         /* 021E8860 */ cpu->r[30] = rbrew_read32(cpu->mem, _t36);
-        /* 021E8864 */ _t37 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E8864 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E8864 */ _t38 = _t37 & 0x00000001u;
         /* 021E8864 */ if (_t38) goto L_021E8868; // else: addr-0 trap, fall-through
   L_021E8868: ; // 0x21e8868
@@ -8160,10 +8160,10 @@ void Gambit_fn_021E8790(CPUState* cpu) {
         /* 021E88B4 */ rbrew_write_f32(cpu->mem, _t44, cpu->f[10]);
         /* 021E88B8 */ cpu->f[0] = fma(cpu->f[10], cpu->f[10], cpu->f[9]);
         /* 021E88BC */ cpu->r[7] = 0x10030000u;
-        /* 021E88C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[29]);
+        /* 021E88C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[29]));
         /* 021E88C4 */ _t45 = cpu->r[7] + 0x00005988u;
         /* 021E88C4 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t45);
-        /* 021E88C8 */ _t46 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E88C8 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E88C8 */ _t47 = _t46 & 0x00000001u;
         /* 021E88C8 */ if (_t47) goto L_021E88CC; else goto L_021E8904;
   L_021E88CC: ; // 0x21e88cc
@@ -8214,10 +8214,10 @@ void Gambit_fn_021E8790(CPUState* cpu) {
         /* 021E8944 */ _t61 = cpu->r[6] + 0x000059C0u;
         /* 021E8944 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t61);
         /* 021E8948 */ cpu->r[11] = 0x10030000u;
-        /* 021E894C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[28]);
+        /* 021E894C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[28]));
         /* 021E8950 */ _t62 = cpu->r[11] + 0x00005980u;
         /* 021E8950 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t62);
-        /* 021E8954 */ _t63 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E8954 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E8954 */ _t64 = _t63 & 0x00000001u;
         /* 021E8954 */ if (_t64) goto L_021E8958; else goto L_021E898C;
   L_021E8958: ; // 0x21e8958
@@ -8231,19 +8231,19 @@ void Gambit_fn_021E8790(CPUState* cpu) {
         /* 021E896C */ _t67 = cpu->r[1] + 0x00000014u;
         /* 021E896C */ rbrew_write_f32(cpu->mem, _t67, cpu->f[10]);
         /* 021E8970 */ cpu->f[12] = fma(cpu->f[10], cpu->f[10], cpu->f[0]);
-        /* 021E8974 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[29]);
+        /* 021E8974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[29]));
         /* 021E8978 */ _t68 = cpu->r[1] + 0x00000018u;
         /* 021E8978 */ rbrew_write_f32(cpu->mem, _t68, cpu->f[11]);
         /* 021E897C */ cpu->f[27] = cpu->f[1];
-        /* 021E8980 */ _t69 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E8980 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E8980 */ _t70 = _t69 & 0x00000001u;
         /* 021E8980 */ if (_t70) goto L_021E89C0; else goto L_021E8984;
   L_021E8984: ; // 0x21e8984
         /* 021E8984 */ cpu->f[1] = cpu->f[29];
         /* 021E8988 */ goto L_021E8A1C;
   L_021E898C: ; // 0x21e898c
-        /* 021E898C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
-        /* 021E8990 */ _t71 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E898C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
+        /* 021E8990 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E8990 */ _t72 = _t71 & 0x00000001u;
         /* 021E8990 */ if (_t72) goto L_021E8994; else goto L_021E8998;
   L_021E8994: ; // 0x21e8994
@@ -8258,11 +8258,11 @@ void Gambit_fn_021E8790(CPUState* cpu) {
         /* 021E89A8 */ _t75 = cpu->r[1] + 0x00000014u;
         /* 021E89A8 */ rbrew_write_f32(cpu->mem, _t75, cpu->f[10]);
         /* 021E89AC */ cpu->f[12] = fma(cpu->f[10], cpu->f[10], cpu->f[0]);
-        /* 021E89B0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[29]);
+        /* 021E89B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[29]));
         /* 021E89B4 */ _t76 = cpu->r[1] + 0x00000018u;
         /* 021E89B4 */ rbrew_write_f32(cpu->mem, _t76, cpu->f[11]);
         /* 021E89B8 */ cpu->f[27] = cpu->f[1];
-        /* 021E89BC */ _t77 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E89BC */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E89BC */ _t78 = _t77 & 0x00000001u;
         /* 021E89BC */ if (_t78) goto L_021E89C0; else goto L_021E8984;
   L_021E89C0: ; // 0x21e89c0
@@ -8278,17 +8278,17 @@ void Gambit_fn_021E8790(CPUState* cpu) {
         /* 021E89D8 */ cpu->f[13] = cpu->f[7] * cpu->f[8];
         /* 021E89DC */ cpu->f[12] = cpu->f[12] * cpu->f[13];
         /* 021E89E0 */ /* nop */
-        /* 021E89E4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[29]);
+        /* 021E89E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[29]));
         /* 021E89E8 */ /* nop */
         /* 021E89EC */ /* nop */
-        /* 021E89F0 */ _t82 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E89F0 */ _t82 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E89F0 */ _t83 = _t82 & 0x00000001u;
         /* 021E89F0 */ if (_t83) goto L_021E89F4; else goto L_021E8984;
   L_021E89F4: ; // 0x21e89f4
         /* 021E89F4 */ _t84 = cpu->r[1] + 0x00000014u;
         /* 021E89F4 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t84);
-        /* 021E89F8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[28]);
-        /* 021E89FC */ _t85 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E89F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[28]));
+        /* 021E89FC */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E89FC */ _t86 = _t85 & 0x00000001u;
         /* 021E89FC */ if (_t86) goto L_021E8A00; else goto L_021E8A0C;
   L_021E8A00: ; // 0x21e8a00
@@ -8296,8 +8296,8 @@ void Gambit_fn_021E8790(CPUState* cpu) {
         /* 021E8A04 */ Gambit_fn_02C892F8(cpu);
         /* 021E8A08 */ goto L_021E8A1C;
   L_021E8A0C: ; // 0x21e8a0c
-        /* 021E8A0C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
-        /* 021E8A10 */ _t87 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E8A0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
+        /* 021E8A10 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E8A10 */ _t88 = _t87 & 0x00000001u;
         /* 021E8A10 */ if (_t88) goto L_021E8A14; else goto L_021E8A18;
   L_021E8A14: ; // 0x21e8a14
@@ -8493,7 +8493,7 @@ void Gambit_fn_021E8790(CPUState* cpu) {
         /* 021E8BFC */ cpu->f[27] = rbrew_read_f64(cpu->mem, _t152);
         /* 021E8C00 */ _t153 = cpu->r[1] + 0x00000118u;
         /* 021E8C00 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t153);
-        /* 021E8C04 */ _t154 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E8C04 */ _t154 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E8C04 */ _t155 = _t154 & 0x00000001u;
         /* 021E8C04 */ if (_t155) goto L_021E8C08; // else: addr-0 trap, fall-through
   L_021E8C08: ; // 0x21e8c08
@@ -8513,8 +8513,8 @@ void Gambit_fn_021E8C18(CPUState* cpu) {
         /* 021E8C18 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E8C1C */ _t1 = cpu->r[5] + 0x00000000u;
         /* 021E8C1C */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
-        /* 021E8C20 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
-        /* 021E8C24 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E8C20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
+        /* 021E8C24 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E8C24 */ _t3 = _t2 & 0x00000001u;
         /* 021E8C24 */ if (_t3) goto L_021E8C28; else goto L_021E8C34;
   L_021E8C28: ; // 0x21e8c28
@@ -8585,20 +8585,20 @@ void Gambit_fn_021E8C70(CPUState* cpu) {
         /* 021E8C70 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 021E8C74 */ _t1 = cpu->r[3] + 0x000001A4u;
         /* 021E8C74 */ cpu->r[0] = rbrew_read32(cpu->mem, _t1);
-        /* 021E8C78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[0]);
-        /* 021E8C7C */ _t2 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E8C78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[0]));
+        /* 021E8C7C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E8C7C */ _t3 = _t2 & 0x00000001u;
         /* 021E8C7C */ if (_t3) goto L_021E8C80; else goto L_021E8CE0;
   L_021E8C80: ; // 0x21e8c80
         /* 021E8C80 */ _t4 = cpu->r[3] + 0x000001A8u;
         /* 021E8C80 */ cpu->r[10] = rbrew_read32(cpu->mem, _t4);
         /* 021E8C84 */ cpu->r[10] = cpu->r[10] + 0xFFFFFFFFu;
-        /* 021E8C84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021E8C84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021E8C88 */ _t5 = cpu->r[3] + 0x000001A8u;
         /* 021E8C88 */ rbrew_write32(cpu->mem, _t5, cpu->r[10]);
         /* 021E8C8C */ _t6 = cpu->r[3] + 0x000001ACu;
         /* 021E8C8C */ cpu->r[10] = rbrew_read32(cpu->mem, _t6);
-        /* 021E8C90 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E8C90 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E8C90 */ _t8 = _t7 & 0x00000001u;
         /* 021E8C90 */ if (_t8) goto L_021E8C94; else goto L_021E8CA0;
   L_021E8C94: ; // 0x21e8c94
@@ -8613,10 +8613,10 @@ void Gambit_fn_021E8C70(CPUState* cpu) {
         /* 021E8CA4 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
         /* 021E8CA8 */ _t12 = cpu->r[3] + 0x000001A8u;
         /* 021E8CA8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t12);
-        /* 021E8CAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[0]);
+        /* 021E8CAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[0]));
         /* 021E8CB0 */ _t13 = cpu->r[3] + 0x000001ACu;
         /* 021E8CB0 */ rbrew_write32(cpu->mem, _t13, cpu->r[10]);
-        /* 021E8CB4 */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E8CB4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E8CB4 */ _t15 = _t14 & 0x00000001u;
         /* 021E8CB4 */ if (_t15) goto L_021E8CBC; else goto L_021E8CB8;
   L_021E8CB8: ; // 0x21e8cb8
@@ -8640,8 +8640,8 @@ void Gambit_fn_021E8C70(CPUState* cpu) {
         /* 021E8CD8 */ rbrew_write_f32(cpu->mem, _t22, cpu->f[0]);
         /* 021E8CDC */ return;
   L_021E8CE0: ; // 0x21e8ce0
-        /* 021E8CE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E8CE4 */ _t23 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E8CE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E8CE4 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E8CE4 */ _t24 = _t23 & 0x00000001u;
         /* 021E8CE4 */ _t25 = _t24 ^ 0x00000001u;
         /* 021E8CE4 */ if (_t25) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -8652,8 +8652,8 @@ void Gambit_fn_021E8C70(CPUState* cpu) {
         /* 021E8CEC */ cpu->r[12] = cpu->r[12] + 0xFFFFFFFFu;
         /* 021E8CF0 */ _t27 = cpu->r[3] + 0x000001ACu;
         /* 021E8CF0 */ rbrew_write32(cpu->mem, _t27, cpu->r[12]);
-        /* 021E8CF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[0]);
-        /* 021E8CF8 */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E8CF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[0]));
+        /* 021E8CF8 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E8CF8 */ _t29 = _t28 & 0x00000001u;
         /* 021E8CF8 */ _t30 = _t29 ^ 0x00000001u;
         /* 021E8CF8 */ if (_t30) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -8664,10 +8664,10 @@ void Gambit_fn_021E8C70(CPUState* cpu) {
         /* 021E8D00 */ _t32 = cpu->r[3] + 0x000001ACu;
         /* 021E8D00 */ cpu->r[11] = rbrew_read32(cpu->mem, _t32);
         /* 021E8D04 */ cpu->r[10] = cpu->r[10] + 0xFFFFFFFFu;
-        /* 021E8D04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021E8D04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021E8D08 */ _t33 = cpu->r[3] + 0x000001A8u;
         /* 021E8D08 */ rbrew_write32(cpu->mem, _t33, cpu->r[10]);
-        /* 021E8D0C */ _t34 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E8D0C */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E8D0C */ _t35 = _t34 & 0x00000001u;
         /* 021E8D0C */ if (_t35) goto L_021E8D10; else goto L_021E8D1C;
   L_021E8D10: ; // 0x21e8d10
@@ -8684,12 +8684,12 @@ void Gambit_fn_021E8C70(CPUState* cpu) {
         /* 021E8D24 */ cpu->r[0] = rbrew_read32(cpu->mem, _t39);
         /* 021E8D28 */ _t40 = cpu->r[3] + 0x000001ACu;
         /* 021E8D28 */ rbrew_write32(cpu->mem, _t40, cpu->r[11]);
-        /* 021E8D2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], cpu->r[0]);
+        /* 021E8D2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], cpu->r[0]));
         /* 021E8D30 */ _t41 = cpu->r[3] + 0x000000FCu;
         /* 021E8D30 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t41);
         /* 021E8D34 */ _t42 = cpu->r[3] + 0x000001A0u;
         /* 021E8D34 */ cpu->r[11] = rbrew_read32(cpu->mem, _t42);
-        /* 021E8D38 */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E8D38 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E8D38 */ _t44 = _t43 & 0x00000001u;
         /* 021E8D38 */ if (_t44) goto L_021E8D40; else goto L_021E8D3C;
   L_021E8D3C: ; // 0x21e8d3c
@@ -8723,7 +8723,7 @@ void Gambit_fn_021E8D5C(CPUState* cpu) {
         /* 021E8D68 */ _t2 = cpu->r[4] + 0x00000000u;
         /* 021E8D68 */ rbrew_write16(cpu->mem, _t2, (uint16_t)cpu->r[10]);
         /* 021E8D6C */ cpu->r[12] = cpu->r[11] & 0x0000FEFFu;
-        /* 021E8D6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021E8D6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021E8D70 */ cpu->r[0] = 0x00000000u;
         /* 021E8D74 */ _t3 = cpu->r[4] + 0x00000002u;
         /* 021E8D74 */ rbrew_write16(cpu->mem, _t3, (uint16_t)cpu->r[12]);
@@ -8749,8 +8749,8 @@ void Gambit_fn_021E8D80(CPUState* cpu) {
         /* 021E8D90 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E8D94 */ _t3 = cpu->r[31] + 0x00000276u;
         /* 021E8D94 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 021E8D98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E8D9C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E8D98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E8D9C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E8D9C */ _t5 = _t4 & 0x00000001u;
         /* 021E8D9C */ if (_t5) goto L_021E8EDC; else goto L_021E8DA0;
   L_021E8DA0: ; // 0x21e8da0
@@ -8793,8 +8793,8 @@ void Gambit_fn_021E8D80(CPUState* cpu) {
         /* 021E8DF8 */ cpu->f[12] = fma(cpu->f[13], cpu->f[13], cpu->f[11]);
         /* 021E8DFC */ _t20 = cpu->r[11] + 0x00005890u;
         /* 021E8DFC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t20);
-        /* 021E8E00 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[0]);
-        /* 021E8E04 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E8E00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[0]));
+        /* 021E8E04 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E8E04 */ _t22 = _t21 & 0x00000001u;
         /* 021E8E04 */ if (_t22) goto L_021E8E08; else goto L_021E8E44;
   L_021E8E08: ; // 0x21e8e08
@@ -8825,8 +8825,8 @@ void Gambit_fn_021E8D80(CPUState* cpu) {
         /* 021E8E4C */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 021E8E50 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 021E8E54 */ Gambit_fn_021C6DD8(cpu);
-        /* 021E8E58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E8E5C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E8E58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E8E5C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E8E5C */ _t30 = _t29 & 0x00000001u;
         /* 021E8E5C */ if (_t30) goto L_021E8E60; else goto L_021E8E74;
   L_021E8E60: ; // 0x21e8e60
@@ -8903,8 +8903,8 @@ void Gambit_fn_021E8D84(CPUState* cpu) {
         /* 021E8D90 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E8D94 */ _t3 = cpu->r[31] + 0x00000276u;
         /* 021E8D94 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 021E8D98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E8D9C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E8D98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E8D9C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E8D9C */ _t5 = _t4 & 0x00000001u;
         /* 021E8D9C */ if (_t5) goto L_021E8EDC; else goto L_021E8DA0;
   L_021E8DA0: ; // 0x21e8da0
@@ -8947,8 +8947,8 @@ void Gambit_fn_021E8D84(CPUState* cpu) {
         /* 021E8DF8 */ cpu->f[12] = fma(cpu->f[13], cpu->f[13], cpu->f[11]);
         /* 021E8DFC */ _t20 = cpu->r[11] + 0x00005890u;
         /* 021E8DFC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t20);
-        /* 021E8E00 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[0]);
-        /* 021E8E04 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E8E00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[0]));
+        /* 021E8E04 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E8E04 */ _t22 = _t21 & 0x00000001u;
         /* 021E8E04 */ if (_t22) goto L_021E8E08; else goto L_021E8E44;
   L_021E8E08: ; // 0x21e8e08
@@ -8979,8 +8979,8 @@ void Gambit_fn_021E8D84(CPUState* cpu) {
         /* 021E8E4C */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 021E8E50 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 021E8E54 */ Gambit_fn_021C6DD8(cpu);
-        /* 021E8E58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E8E5C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E8E58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E8E5C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E8E5C */ _t30 = _t29 & 0x00000001u;
         /* 021E8E5C */ if (_t30) goto L_021E8E60; else goto L_021E8E74;
   L_021E8E60: ; // 0x21e8e60
@@ -9051,18 +9051,18 @@ void Gambit_fn_021E8EF0(CPUState* cpu) {
         /* 021E8EF4 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t0);
         /* 021E8EF8 */ _t1 = cpu->r[12] + 0x000059D8u;
         /* 021E8EF8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t1);
-        /* 021E8EFC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[13]);
+        /* 021E8EFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[13]));
         /* 021E8F00 */ _t2 = cpu->r[3] + 0x000000E8u;
         /* 021E8F00 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t2);
-        /* 021E8F04 */ _t3 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E8F04 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E8F04 */ _t4 = _t3 & 0x00000001u;
         /* 021E8F04 */ if (_t4) goto L_021E8F08; else goto L_021E8F38;
   L_021E8F08: ; // 0x21e8f08
         /* 021E8F08 */ cpu->r[12] = 0x10030000u;
         /* 021E8F0C */ _t5 = cpu->r[12] + 0x000059DCu;
         /* 021E8F0C */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t5);
-        /* 021E8F10 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[12]);
-        /* 021E8F14 */ _t6 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E8F10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[12]));
+        /* 021E8F14 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E8F14 */ _t7 = _t6 & 0x00000001u;
         /* 021E8F14 */ _t8 = _t7 ^ 0x00000001u;
         /* 021E8F14 */ if (_t8) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -9114,24 +9114,24 @@ void Gambit_fn_021E8F94(CPUState* cpu) {
         /* 021E8FC8 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t8);
         /* 021E8FCC */ _t9 = cpu->r[3] + 0x00000000u;
         /* 021E8FCC */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t9);
-        /* 021E8FD0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[8]);
+        /* 021E8FD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[8]));
         /* 021E8FD4 */ cpu->f[4] = fma(cpu->f[12], cpu->f[12], cpu->f[0]);
-        /* 021E8FD8 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E8FD8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E8FD8 */ _t11 = _t10 & 0x00000001u;
         /* 021E8FD8 */ if (_t11) goto L_021E8FDC; else goto L_021E92A4;
   L_021E8FDC: ; // 0x21e8fdc
         /* 021E8FDC */ cpu->r[10] = 0x10030000u;
         /* 021E8FE0 */ _t12 = cpu->r[10] + 0x000059F0u;
         /* 021E8FE0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t12);
-        /* 021E8FE4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[4], cpu->f[13]);
-        /* 021E8FE8 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E8FE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[4], cpu->f[13]));
+        /* 021E8FE8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E8FE8 */ _t14 = _t13 & 0x00000001u;
         /* 021E8FE8 */ if (_t14) goto L_021E8FF8; else goto L_021E8FEC;
   L_021E8FEC: ; // 0x21e8fec
         /* 021E8FEC */ _t15 = cpu->r[30] + 0x00000130u;
         /* 021E8FEC */ cpu->r[9] = rbrew_read32(cpu->mem, _t15);
-        /* 021E8FF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000004u);
-        /* 021E8FF4 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E8FF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000004u));
+        /* 021E8FF4 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E8FF4 */ _t17 = _t16 & 0x00000001u;
         /* 021E8FF4 */ if (_t17) goto L_021E92A4; else goto L_021E8FF8;
   L_021E8FF8: ; // 0x21e8ff8
@@ -9139,21 +9139,21 @@ void Gambit_fn_021E8F94(CPUState* cpu) {
         /* 021E8FF8 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t18);
         /* 021E8FFC */ cpu->r[9] = 0x10030000u;
         /* 021E9000 */ cpu->r[8] = 0x10030000u;
-        /* 021E9004 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[8]);
+        /* 021E9004 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[8]));
         /* 021E9008 */ _t19 = cpu->r[9] + 0x00005890u;
         /* 021E9008 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t19);
         /* 021E900C */ _t20 = cpu->r[8] + 0x00005980u;
         /* 021E900C */ cpu->f[5] = rbrew_read_f32(cpu->mem, _t20);
         /* 021E9010 */ cpu->f[6] = cpu->f[12];
-        /* 021E9014 */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E9014 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E9014 */ _t22 = _t21 & 0x00000001u;
         /* 021E9014 */ if (_t22) goto L_021E9030; else goto L_021E9018;
   L_021E9018: ; // 0x21e9018
         /* 021E9018 */ cpu->f[10] = cpu->f[8] - cpu->f[9];
         /* 021E901C */ cpu->f[7] = cpu->f[11] - cpu->f[9];
         /* 021E9020 */ cpu->f[6] = cpu->f[10] / cpu->f[7];
-        /* 021E9024 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[5]);
-        /* 021E9028 */ _t23 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E9024 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[5]));
+        /* 021E9028 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E9028 */ _t24 = _t23 & 0x00000001u;
         /* 021E9028 */ if (_t24) goto L_021E902C; else goto L_021E9030;
   L_021E902C: ; // 0x21e902c
@@ -9165,8 +9165,8 @@ void Gambit_fn_021E8F94(CPUState* cpu) {
         /* 021E9034 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t26);
         /* 021E9038 */ cpu->f[11] = cpu->f[10] * cpu->f[10];
         /* 021E903C */ cpu->f[11] = fma(cpu->f[13], cpu->f[13], cpu->f[11]);
-        /* 021E9040 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[12]);
-        /* 021E9044 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E9040 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[12]));
+        /* 021E9044 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E9044 */ _t28 = _t27 & 0x00000001u;
         /* 021E9044 */ if (_t28) goto L_021E9064; else goto L_021E9048;
   L_021E9048: ; // 0x21e9048
@@ -9174,9 +9174,9 @@ void Gambit_fn_021E8F94(CPUState* cpu) {
         /* 021E904C */ cpu->f[3] = cpu->f[12] * cpu->f[11];
         /* 021E9050 */ _t29 = cpu->r[10] + 0x000059F4u;
         /* 021E9050 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t29);
-        /* 021E9054 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[3], cpu->f[9]);
+        /* 021E9054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[3], cpu->f[9]));
         /* 021E9058 */ cpu->f[9] = cpu->f[12];
-        /* 021E905C */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E905C */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E905C */ _t31 = _t30 & 0x00000001u;
         /* 021E905C */ if (_t31) goto L_021E9110; else goto L_021E9060;
   L_021E9060: ; // 0x21e9060
@@ -9199,21 +9199,21 @@ void Gambit_fn_021E8F94(CPUState* cpu) {
         /* 021E908C */ cpu->f[3] = cpu->f[0] * cpu->f[11];
         /* 021E9090 */ _t36 = cpu->r[10] + 0x000059F4u;
         /* 021E9090 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t36);
-        /* 021E9094 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[3], cpu->f[9]);
+        /* 021E9094 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[3], cpu->f[9]));
         /* 021E9098 */ cpu->f[9] = cpu->f[12];
-        /* 021E909C */ _t37 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E909C */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E909C */ _t38 = _t37 & 0x00000001u;
         /* 021E909C */ if (_t38) goto L_021E9110; else goto L_021E90A0;
   L_021E90A0: ; // 0x21e90a0
-        /* 021E90A0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[4], cpu->f[12]);
-        /* 021E90A4 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E90A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[4], cpu->f[12]));
+        /* 021E90A4 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E90A4 */ _t40 = _t39 & 0x00000001u;
         /* 021E90A4 */ if (_t40) goto L_021E90BC; else goto L_021E90A8;
   L_021E90A8: ; // 0x21e90a8
         /* 021E90A8 */ cpu->f[8] = -fma(cpu->f[3], cpu->f[3], -(cpu->f[4]));
-        /* 021E90AC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[12]);
+        /* 021E90AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[12]));
         /* 021E90B0 */ cpu->f[11] = cpu->f[12] * cpu->f[4];
-        /* 021E90B4 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E90B4 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E90B4 */ _t42 = _t41 & 0x00000001u;
         /* 021E90B4 */ if (_t42) goto L_021E9110; else goto L_021E90B8;
   L_021E90B8: ; // 0x21e90b8
@@ -9233,9 +9233,9 @@ void Gambit_fn_021E8F94(CPUState* cpu) {
         /* 021E90D8 */ cpu->f[8] = -fma(cpu->f[8], cpu->f[4], -(cpu->f[13]));
         /* 021E90DC */ cpu->f[10] = cpu->f[8] * cpu->f[7];
         /* 021E90E0 */ cpu->f[8] = -fma(cpu->f[3], cpu->f[3], -(cpu->f[4]));
-        /* 021E90E4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[12]);
+        /* 021E90E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[12]));
         /* 021E90E8 */ cpu->f[11] = cpu->f[10] * cpu->f[4];
-        /* 021E90EC */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E90EC */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E90EC */ _t48 = _t47 & 0x00000001u;
         /* 021E90EC */ if (_t48) goto L_021E9110; else goto L_021E90F0;
   L_021E90F0: ; // 0x21e90f0
@@ -9245,8 +9245,8 @@ void Gambit_fn_021E8F94(CPUState* cpu) {
         /* 021E90F8 */ cpu->f[13] = cpu->f[11] - cpu->f[3];
         /* 021E90FC */ cpu->f[11] = cpu->f[0] - cpu->f[3];
         /* 021E9100 */ cpu->f[9] = cpu->f[11] / cpu->f[13];
-        /* 021E9104 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[5]);
-        /* 021E9108 */ _t50 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E9104 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[5]));
+        /* 021E9108 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E9108 */ _t51 = _t50 & 0x00000001u;
         /* 021E9108 */ if (_t51) goto L_021E910C; else goto L_021E9110;
   L_021E910C: ; // 0x21e910c
@@ -9255,10 +9255,10 @@ void Gambit_fn_021E8F94(CPUState* cpu) {
         /* 021E9110 */ _t52 = cpu->r[30] + 0x00000130u;
         /* 021E9110 */ cpu->r[8] = rbrew_read32(cpu->mem, _t52);
         /* 021E9114 */ cpu->r[10] = cpu->r[8] + 0xFFFFFFFFu;
-        /* 021E9118 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000004u);
+        /* 021E9118 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000004u));
         /* 021E911C */ _t53 = cpu->r[30] + 0x00000278u;
         /* 021E911C */ cpu->f[3] = rbrew_read_f32(cpu->mem, _t53);
-        /* 021E9120 */ _t54 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E9120 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E9120 */ _t55 = _t54 & 0x00000001u;
         /* 021E9120 */ if (_t55) goto L_021E9124; else goto L_021E9128;
   L_021E9124: ; // 0x21e9124
@@ -9529,9 +9529,9 @@ void Gambit_fn_021E9344(CPUState* cpu) {
         /* 02031BE4 */ _t4 = cpu->r[4] + 0x00000000u;
         /* 02031BE4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t4);
         /* 02031BE8 */ cpu->r[31] = cpu->r[4];
-        /* 02031BEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02031BEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02031BF0 */ cpu->r[30] = cpu->r[3];
-        /* 02031BF4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02031BF4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02031BF4 */ _t6 = _t5 & 0x00000001u;
         /* 02031BF4 */ if (_t6) goto L_02031C58; else goto L_02031BF8;
   L_02031BF8: ; // 0x2031bf8
@@ -9539,8 +9539,8 @@ void Gambit_fn_021E9344(CPUState* cpu) {
         /* 02031BF8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
         /* 02031BFC */ _t8 = cpu->r[3] + 0x0000011Cu;
         /* 02031BFC */ cpu->r[11] = rbrew_read8(cpu->mem, _t8);
-        /* 02031C00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02031C04 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02031C00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02031C04 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02031C04 */ _t10 = _t9 & 0x00000001u;
         /* 02031C04 */ if (_t10) goto L_02031C58; else goto L_02031C08;
   L_02031C08: ; // 0x2031c08
@@ -9595,15 +9595,15 @@ void Gambit_fn_021E9354(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021E9354: ; // 0x21e9354
-        /* 021E9354 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E9358 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9354 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E9358 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9358 */ _t1 = _t0 & 0x00000001u;
         /* 021E9358 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021E9358 */ goto L_021E935C;
   L_021E935C: ; // 0x21e935c
         /* 021E935C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021E935C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E9360 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E935C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E9360 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9360 */ _t3 = _t2 & 0x00000001u;
         /* 021E9360 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021E9360 */ goto L_021E9364;
@@ -9622,8 +9622,8 @@ void Gambit_fn_021E9354(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -9637,15 +9637,15 @@ void Gambit_fn_021E9354(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -9679,15 +9679,15 @@ void Gambit_fn_021E936C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021E936C: ; // 0x21e936c
-        /* 021E936C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E9370 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E936C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E9370 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9370 */ _t1 = _t0 & 0x00000001u;
         /* 021E9370 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021E9370 */ goto L_021E9374;
   L_021E9374: ; // 0x21e9374
         /* 021E9374 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021E9374 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E9378 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9374 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E9378 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9378 */ _t3 = _t2 & 0x00000001u;
         /* 021E9378 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021E9378 */ goto L_021E937C;
@@ -9706,8 +9706,8 @@ void Gambit_fn_021E936C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -9721,15 +9721,15 @@ void Gambit_fn_021E936C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -9775,15 +9775,15 @@ void Gambit_fn_021E939C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021E939C: ; // 0x21e939c
-        /* 021E939C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E93A0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E939C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E93A0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E93A0 */ _t1 = _t0 & 0x00000001u;
         /* 021E93A0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021E93A0 */ goto L_021E93A4;
   L_021E93A4: ; // 0x21e93a4
         /* 021E93A4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021E93A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E93A8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E93A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E93A8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E93A8 */ _t3 = _t2 & 0x00000001u;
         /* 021E93A8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021E93A8 */ goto L_021E93AC;
@@ -9802,8 +9802,8 @@ void Gambit_fn_021E939C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -9817,15 +9817,15 @@ void Gambit_fn_021E939C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -9853,15 +9853,15 @@ void Gambit_fn_021E93B0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021E93B0: ; // 0x21e93b0
-        /* 021E93B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E93B4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E93B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E93B4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E93B4 */ _t1 = _t0 & 0x00000001u;
         /* 021E93B4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021E93B4 */ goto L_021E93B8;
   L_021E93B8: ; // 0x21e93b8
         /* 021E93B8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021E93B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E93BC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E93B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E93BC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E93BC */ _t3 = _t2 & 0x00000001u;
         /* 021E93BC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021E93BC */ goto L_021E93C0;
@@ -9880,8 +9880,8 @@ void Gambit_fn_021E93B0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -9895,15 +9895,15 @@ void Gambit_fn_021E93B0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -9982,8 +9982,8 @@ void Gambit_fn_021E93E4(CPUState* cpu) {
         /* 021E93E4 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E93E4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E93E8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021E93E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E93EC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E93E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E93EC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E93EC */ _t2 = _t1 & 0x00000001u;
         /* 021E93EC */ _t3 = _t2 ^ 0x00000001u;
         /* 021E93EC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -10005,8 +10005,8 @@ void Gambit_fn_021E9400(CPUState* cpu) {
         /* 021E9400 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E9400 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E9404 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021E9404 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E9408 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9404 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E9408 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9408 */ _t2 = _t1 & 0x00000001u;
         /* 021E9408 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E9408 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -10028,8 +10028,8 @@ void Gambit_fn_021E941C(CPUState* cpu) {
         /* 021E941C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021E941C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E9420 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021E9420 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021E9424 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9420 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021E9424 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9424 */ _t2 = _t1 & 0x00000001u;
         /* 021E9424 */ _t3 = _t2 ^ 0x00000001u;
         /* 021E9424 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -10072,8 +10072,8 @@ void Gambit_fn_021E9448(CPUState* cpu) {
         /* 021E9458 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E945C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021E945C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021E9460 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021E9464 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9460 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021E9464 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9464 */ _t5 = _t4 & 0x00000001u;
         /* 021E9464 */ if (_t5) goto L_021E9468; else goto L_021E9484;
   L_021E9468: ; // 0x21e9468
@@ -10112,8 +10112,8 @@ void Gambit_fn_021E944C(CPUState* cpu) {
         /* 021E9458 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021E945C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021E945C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021E9460 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021E9464 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9460 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021E9464 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9464 */ _t5 = _t4 & 0x00000001u;
         /* 021E9464 */ if (_t5) goto L_021E9468; else goto L_021E9484;
   L_021E9468: ; // 0x21e9468
@@ -10548,8 +10548,8 @@ void Gambit_fn_021E9648(CPUState* cpu) {
         /* 021E9648 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 021E9648 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021E964C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 021E964C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021E9650 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E964C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021E9650 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9650 */ _t2 = _t1 & 0x00000001u;
         /* 021E9650 */ if (_t2) goto L_021E9660; else goto L_021E9654;
   L_021E9654: ; // 0x21e9654
@@ -10578,8 +10578,8 @@ void Gambit_fn_021E966C(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -10645,10 +10645,10 @@ void Gambit_fn_021E969C(CPUState* cpu) {
         /* 021E969C */ cpu->r[10] = 0x101D0000u;
         /* 021E96A0 */ _t0 = cpu->r[10] + 0xFFFFFC38u;
         /* 021E96A0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 021E96A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021E96A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021E96A8 */ cpu->r[10] = 0x101D0000u;
         /* 021E96AC */ cpu->r[10] = cpu->r[10] + 0xFFFFFCA4u;
-        /* 021E96B0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E96B0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E96B0 */ _t2 = _t1 & 0x00000001u;
         /* 021E96B0 */ if (_t2) goto L_021E96B4; else goto L_021E96CC;
   L_021E96B4: ; // 0x21e96b4
@@ -10661,8 +10661,8 @@ void Gambit_fn_021E969C(CPUState* cpu) {
         /* 021E96C8 */ _t4 = cpu->r[10] + 0x00000000u;
         /* 021E96C8 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_021E96CC: ; // 0x21e96cc
-        /* 021E96CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021E96D0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E96CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021E96D0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E96D0 */ _t6 = _t5 & 0x00000001u;
         /* 021E96D0 */ if (_t6) goto L_021E96D4; else goto L_021E96DC;
   L_021E96D4: ; // 0x21e96d4
@@ -10673,9 +10673,9 @@ void Gambit_fn_021E969C(CPUState* cpu) {
         /* 021E96E0 */ _t7 = cpu->r[9] + 0xFFFFDA00u;
         /* 021E96E0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 021E96E4 */ cpu->r[11] = 0x101D0000u;
-        /* 021E96E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021E96E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021E96EC */ cpu->r[11] = cpu->r[11] + 0xFFFFFBFCu;
-        /* 021E96F0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E96F0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E96F0 */ _t9 = _t8 & 0x00000001u;
         /* 021E96F0 */ if (_t9) goto L_021E96F4; else goto L_021E970C;
   L_021E96F4: ; // 0x21e96f4
@@ -10688,8 +10688,8 @@ void Gambit_fn_021E969C(CPUState* cpu) {
         /* 021E9708 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021E9708 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021E970C: ; // 0x21e970c
-        /* 021E970C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021E9710 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E970C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021E9710 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9710 */ _t13 = _t12 & 0x00000001u;
         /* 021E9710 */ if (_t13) goto L_021E9714; else goto L_021E971C;
   L_021E9714: ; // 0x21e9714
@@ -10700,9 +10700,9 @@ void Gambit_fn_021E969C(CPUState* cpu) {
         /* 021E9720 */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021E9720 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 021E9724 */ cpu->r[9] = 0x101D0000u;
-        /* 021E9728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021E9728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021E972C */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 021E9730 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9730 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9730 */ _t16 = _t15 & 0x00000001u;
         /* 021E9730 */ if (_t16) goto L_021E9734; else goto L_021E974C;
   L_021E9734: ; // 0x21e9734
@@ -10715,8 +10715,8 @@ void Gambit_fn_021E969C(CPUState* cpu) {
         /* 021E9748 */ _t18 = cpu->r[9] + 0x00000000u;
         /* 021E9748 */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_021E974C: ; // 0x21e974c
-        /* 021E974C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 021E9750 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E974C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 021E9750 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9750 */ _t20 = _t19 & 0x00000001u;
         /* 021E9750 */ if (_t20) goto L_021E9754; else goto L_021E975C;
   L_021E9754: ; // 0x21e9754
@@ -10728,9 +10728,9 @@ void Gambit_fn_021E969C(CPUState* cpu) {
         /* 021E9760 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 021E9760 */ cpu->r[9] = _t21;
         /* 021E9764 */ cpu->r[10] = 0x101D0000u;
-        /* 021E9768 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021E9768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021E976C */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021E9770 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9770 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9770 */ _t23 = _t22 & 0x00000001u;
         /* 021E9770 */ if (_t23) goto L_021E9774; else goto L_021E9788;
   L_021E9774: ; // 0x21e9774
@@ -10742,8 +10742,8 @@ void Gambit_fn_021E969C(CPUState* cpu) {
         /* 021E9784 */ _t25 = cpu->r[10] + 0x00000000u;
         /* 021E9784 */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_021E9788: ; // 0x21e9788
-        /* 021E9788 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021E978C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9788 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021E978C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E978C */ _t27 = _t26 & 0x00000001u;
         /* 021E978C */ if (_t27) goto L_021E9790; else goto L_021E9798;
   L_021E9790: ; // 0x21e9790
@@ -10755,9 +10755,9 @@ void Gambit_fn_021E969C(CPUState* cpu) {
         /* 021E979C */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 021E979C */ cpu->r[10] = _t28;
         /* 021E97A0 */ cpu->r[11] = 0x101D0000u;
-        /* 021E97A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021E97A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021E97A8 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021E97AC */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E97AC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E97AC */ _t30 = _t29 & 0x00000001u;
         /* 021E97AC */ if (_t30) goto L_021E97B0; else goto L_021E97C4;
   L_021E97B0: ; // 0x21e97b0
@@ -10997,7 +10997,7 @@ void Gambit_fn_021E983C(CPUState* cpu) {
         /* 021E9970 */ cpu->f[27] = rbrew_read_f64(cpu->mem, _t43);
         /* 021E9974 */ _t44 = cpu->r[1] + 0x00000008u;
         /* 021E9974 */ cpu->r[30] = rbrew_read32(cpu->mem, _t44);
-        /* 021E9978 */ _t45 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E9978 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E9978 */ _t46 = _t45 & 0x00000001u;
         /* 021E9978 */ if (_t46) goto L_021E997C; // else: addr-0 trap, fall-through
   L_021E997C: ; // 0x21e997c
@@ -11028,10 +11028,10 @@ void Gambit_fn_021E998C(CPUState* cpu) {
         /* 021E99AC */ cpu->r[31] = 0x101D0000u;
         /* 021E99B0 */ _t3 = cpu->r[28] + 0x0000001Cu;
         /* 021E99B0 */ rbrew_write32(cpu->mem, _t3, cpu->r[4]);
-        /* 021E99B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 021E99B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 021E99B8 */ _t4 = cpu->r[28] + 0x0000000Fu;
         /* 021E99B8 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[27]);
-        /* 021E99BC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E99BC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E99BC */ _t6 = _t5 & 0x00000001u;
         /* 021E99BC */ if (_t6) goto L_021E9A00; else goto L_021E99C0;
   L_021E99C0: ; // 0x21e99c0
@@ -11046,16 +11046,16 @@ void Gambit_fn_021E998C(CPUState* cpu) {
         /* 021E99D4 */ cpu->r[5] = 0x00000004u;
         /* 021E99D8 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 021E99DC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021E99E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 021E99E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 021E99E4 */ cpu->r[0] = cpu->r[27];
-        /* 021E99E8 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E99E8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E99E8 */ _t11 = _t10 & 0x00000001u;
         /* 021E99E8 */ if (_t11) goto L_021E99F0; else goto L_021E99EC;
   L_021E99EC: ; // 0x21e99ec
         /* 021E99EC */ cpu->r[0] = 0x00000001u;
   L_021E99F0: ; // 0x21e99f0
-        /* 021E99F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E99F4 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E99F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E99F4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E99F4 */ _t13 = _t12 & 0x00000001u;
         /* 021E99F4 */ if (_t13) goto L_021E9A00; else goto L_021E99F8;
   L_021E99F8: ; // 0x21e99f8
@@ -11067,9 +11067,9 @@ void Gambit_fn_021E998C(CPUState* cpu) {
         /* 021E9A00 */ _t16 = cpu->r[28] + 0x00000020u;
         /* 021E9A00 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 021E9A04 */ cpu->r[0] = 0x00000000u;
-        /* 021E9A08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021E9A08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021E9A0C */ cpu->r[12] = cpu->r[0];
-        /* 021E9A10 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E9A10 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E9A10 */ _t18 = _t17 & 0x00000001u;
         /* 021E9A10 */ if (_t18) goto L_021E9A14; else goto L_021E9A38;
   L_021E9A14: ; // 0x21e9a14
@@ -11094,8 +11094,8 @@ void Gambit_fn_021E998C(CPUState* cpu) {
   L_021E9A38: ; // 0x21e9a38
         /* 021E9A38 */ _t26 = cpu->r[28] + 0x0000000Fu;
         /* 021E9A38 */ cpu->r[27] = rbrew_read8(cpu->mem, _t26);
-        /* 021E9A3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 021E9A40 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9A3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 021E9A40 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9A40 */ _t28 = _t27 & 0x00000001u;
         /* 021E9A40 */ if (_t28) goto L_021E9A84; else goto L_021E9A44;
   L_021E9A44: ; // 0x21e9a44
@@ -11110,16 +11110,16 @@ void Gambit_fn_021E998C(CPUState* cpu) {
         /* 021E9A58 */ cpu->r[5] = 0x00000004u;
         /* 021E9A5C */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 021E9A60 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021E9A64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 021E9A64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 021E9A68 */ cpu->r[11] = cpu->r[27];
-        /* 021E9A6C */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E9A6C */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E9A6C */ _t33 = _t32 & 0x00000001u;
         /* 021E9A6C */ if (_t33) goto L_021E9A74; else goto L_021E9A70;
   L_021E9A70: ; // 0x21e9a70
         /* 021E9A70 */ cpu->r[11] = 0x00000001u;
   L_021E9A74: ; // 0x21e9a74
-        /* 021E9A74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E9A78 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9A74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E9A78 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9A78 */ _t35 = _t34 & 0x00000001u;
         /* 021E9A78 */ if (_t35) goto L_021E9A84; else goto L_021E9A7C;
   L_021E9A7C: ; // 0x21e9a7c
@@ -11131,9 +11131,9 @@ void Gambit_fn_021E998C(CPUState* cpu) {
         /* 021E9A84 */ _t38 = cpu->r[28] + 0x00000028u;
         /* 021E9A84 */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 021E9A88 */ cpu->r[0] = 0x00000000u;
-        /* 021E9A8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 021E9A8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 021E9A90 */ cpu->r[12] = cpu->r[0];
-        /* 021E9A94 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E9A94 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E9A94 */ _t40 = _t39 & 0x00000001u;
         /* 021E9A94 */ if (_t40) goto L_021E9A98; else goto L_021E9ABC;
   L_021E9A98: ; // 0x21e9a98
@@ -11158,8 +11158,8 @@ void Gambit_fn_021E998C(CPUState* cpu) {
   L_021E9ABC: ; // 0x21e9abc
         /* 021E9ABC */ _t48 = cpu->r[28] + 0x0000000Fu;
         /* 021E9ABC */ cpu->r[27] = rbrew_read8(cpu->mem, _t48);
-        /* 021E9AC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 021E9AC4 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9AC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 021E9AC4 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9AC4 */ _t50 = _t49 & 0x00000001u;
         /* 021E9AC4 */ if (_t50) goto L_021E9B08; else goto L_021E9AC8;
   L_021E9AC8: ; // 0x21e9ac8
@@ -11174,16 +11174,16 @@ void Gambit_fn_021E998C(CPUState* cpu) {
         /* 021E9ADC */ cpu->r[5] = 0x00000004u;
         /* 021E9AE0 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 021E9AE4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021E9AE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 021E9AE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 021E9AEC */ cpu->r[10] = cpu->r[27];
-        /* 021E9AF0 */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E9AF0 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E9AF0 */ _t55 = _t54 & 0x00000001u;
         /* 021E9AF0 */ if (_t55) goto L_021E9AF8; else goto L_021E9AF4;
   L_021E9AF4: ; // 0x21e9af4
         /* 021E9AF4 */ cpu->r[10] = 0x00000001u;
   L_021E9AF8: ; // 0x21e9af8
-        /* 021E9AF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021E9AFC */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9AF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021E9AFC */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9AFC */ _t57 = _t56 & 0x00000001u;
         /* 021E9AFC */ if (_t57) goto L_021E9B08; else goto L_021E9B00;
   L_021E9B00: ; // 0x21e9b00
@@ -11195,9 +11195,9 @@ void Gambit_fn_021E998C(CPUState* cpu) {
         /* 021E9B08 */ _t60 = cpu->r[28] + 0x00000030u;
         /* 021E9B08 */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
         /* 021E9B0C */ cpu->r[0] = 0x00000000u;
-        /* 021E9B10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021E9B10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021E9B14 */ cpu->r[5] = cpu->r[0];
-        /* 021E9B18 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E9B18 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E9B18 */ _t62 = _t61 & 0x00000001u;
         /* 021E9B18 */ if (_t62) goto L_021E9B1C; else goto L_021E9B40;
   L_021E9B1C: ; // 0x21e9b1c
@@ -11222,8 +11222,8 @@ void Gambit_fn_021E998C(CPUState* cpu) {
   L_021E9B40: ; // 0x21e9b40
         /* 021E9B40 */ _t70 = cpu->r[30] + 0x00000000u;
         /* 021E9B40 */ cpu->r[25] = rbrew_read8(cpu->mem, _t70);
-        /* 021E9B44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 021E9B48 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9B44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 021E9B48 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9B48 */ _t72 = _t71 & 0x00000001u;
         /* 021E9B48 */ if (_t72) goto L_021E9C24; else goto L_021E9B4C;
   L_021E9B4C: ; // 0x21e9b4c
@@ -11239,10 +11239,10 @@ void Gambit_fn_021E998C(CPUState* cpu) {
         /* 021E9B64 */ cpu->r[4] = (uint32_t)((int32_t)cpu->r[25] * (int32_t)0x00000024u);
         /* 021E9B68 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021E9B6C */ cpu->r[24] = cpu->r[3];
-        /* 021E9B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 021E9B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 021E9B74 */ cpu->r[30] = cpu->r[25];
         /* 021E9B78 */ cpu->r[7] = 0x00000000u;
-        /* 021E9B7C */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021E9B7C */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021E9B7C */ _t77 = _t76 & 0x00000001u;
         /* 021E9B7C */ if (_t77) goto L_021E9B84; else goto L_021E9B80;
   L_021E9B80: ; // 0x21e9b80
@@ -11255,36 +11255,36 @@ void Gambit_fn_021E998C(CPUState* cpu) {
         /* 021E9B90 */ cpu->r[23] = 0x00000018u;
   L_021E9B94: ; // 0x21e9b94
         /* 021E9B94 */ cpu->r[27] = cpu->r[24] + cpu->r[22];
-        /* 021E9B94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 021E9B98 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9B94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 021E9B98 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9B98 */ _t80 = _t79 & 0x00000001u;
         /* 021E9B98 */ if (_t80) goto L_021E9C08; else goto L_021E9B9C;
   L_021E9B9C: ; // 0x21e9b9c
         /* 021E9B9C */ cpu->r[26] = cpu->r[27];
-        /* 021E9B9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 021E9BA0 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9B9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 021E9BA0 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9BA0 */ _t82 = _t81 & 0x00000001u;
         /* 021E9BA0 */ if (_t82) goto L_021E9BA4; else goto L_021E9BB4;
   L_021E9BA4: ; // 0x21e9ba4
         /* 021E9BA4 */ cpu->r[3] = 0x00000024u;
         /* 021E9BA8 */ Gambit_fn_02801A78(cpu);
         /* 021E9BAC */ cpu->r[26] = cpu->r[3];
-        /* 021E9BAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 021E9BB0 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9BAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 021E9BB0 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9BB0 */ _t84 = _t83 & 0x00000001u;
         /* 021E9BB0 */ if (_t84) goto L_021E9BFC; else goto L_021E9BB4;
   L_021E9BB4: ; // 0x21e9bb4
         /* 021E9BB4 */ cpu->r[11] = cpu->r[26];
-        /* 021E9BB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021E9BB8 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9BB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021E9BB8 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9BB8 */ _t86 = _t85 & 0x00000001u;
         /* 021E9BB8 */ if (_t86) goto L_021E9BBC; else goto L_021E9BCC;
   L_021E9BBC: ; // 0x21e9bbc
         /* 021E9BBC */ cpu->r[3] = 0x0000000Cu;
         /* 021E9BC0 */ Gambit_fn_02801A78(cpu);
         /* 021E9BC4 */ cpu->r[11] = cpu->r[3];
-        /* 021E9BC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021E9BC8 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9BC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021E9BC8 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9BC8 */ _t88 = _t87 & 0x00000001u;
         /* 021E9BC8 */ if (_t88) goto L_021E9BE8; else goto L_021E9BCC;
   L_021E9BCC: ; // 0x21e9bcc
@@ -11315,14 +11315,14 @@ void Gambit_fn_021E998C(CPUState* cpu) {
         /* 021E9C04 */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
   L_021E9C08: ; // 0x21e9c08
         /* 021E9C08 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 021E9C08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021E9C08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021E9C0C */ cpu->r[22] = cpu->r[22] + 0x00000024u;
-        /* 021E9C10 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9C10 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9C10 */ _t98 = _t97 & 0x00000001u;
         /* 021E9C10 */ if (_t98) goto L_021E9C14; else goto L_021E9B94;
   L_021E9C14: ; // 0x21e9c14
-        /* 021E9C14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 021E9C18 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9C14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 021E9C18 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9C18 */ _t100 = _t99 & 0x00000001u;
         /* 021E9C18 */ if (_t100) goto L_021E9C24; else goto L_021E9C1C;
   L_021E9C1C: ; // 0x21e9c1c
@@ -11352,10 +11352,10 @@ void Gambit_fn_021E9C3C(CPUState* cpu) {
         /* 021E9C40 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 021E9C44 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 021E9C44 */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 021E9C48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[12]);
+        /* 021E9C48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[12]));
         /* 021E9C4C */ _t3 = cpu->r[4] + 0x00000000u;
         /* 021E9C4C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021E9C50 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E9C50 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E9C50 */ _t5 = _t4 & 0x00000001u;
         /* 021E9C50 */ if (_t5) goto L_021E9C54; else goto L_021E9C5C;
   L_021E9C54: ; // 0x21e9c54
@@ -11372,10 +11372,10 @@ void Gambit_fn_021E9C3C(CPUState* cpu) {
         /* 021E9C68 */ cpu->r[9] = rbrew_read8(cpu->mem, _t9);
         /* 021E9C6C */ _t10 = cpu->r[3] + 0x00000028u;
         /* 021E9C6C */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 021E9C70 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
+        /* 021E9C70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
         /* 021E9C74 */ _t11 = cpu->r[3] + 0x0000002Cu;
         /* 021E9C74 */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
-        /* 021E9C78 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E9C78 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E9C78 */ _t13 = _t12 & 0x00000001u;
         /* 021E9C78 */ if (_t13) goto L_021E9C7C; else goto L_021E9C84;
   L_021E9C7C: ; // 0x21e9c7c
@@ -11396,10 +11396,10 @@ void Gambit_fn_021E9C3C(CPUState* cpu) {
         /* 021E9C98 */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
         /* 021E9C9C */ _t20 = cpu->r[3] + 0x00000034u;
         /* 021E9C9C */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 021E9CA0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
+        /* 021E9CA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
         /* 021E9CA4 */ _t21 = cpu->r[6] + 0x00000000u;
         /* 021E9CA4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
-        /* 021E9CA8 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E9CA8 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E9CA8 */ _t23 = _t22 & 0x00000001u;
         /* 021E9CA8 */ if (_t23) goto L_021E9CAC; else goto L_021E9CB4;
   L_021E9CAC: ; // 0x21e9cac
@@ -11426,10 +11426,10 @@ void Gambit_fn_021E9CC4(CPUState* cpu) {
         /* 021E9CCC */ _t1 = cpu->r[3] + 0x00000020u;
         /* 021E9CCC */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 021E9CD0 */ cpu->r[8] = cpu->r[0];
-        /* 021E9CD4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021E9CD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021E9CD8 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 021E9CD8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021E9CDC */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E9CDC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E9CDC */ _t4 = _t3 & 0x00000001u;
         /* 021E9CDC */ if (_t4) goto L_021E9CE0; else goto L_021E9CF8;
   L_021E9CE0: ; // 0x21e9ce0
@@ -11437,8 +11437,8 @@ void Gambit_fn_021E9CC4(CPUState* cpu) {
         /* 021E9CE4 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 021E9CE8 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021E9CE8 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021E9CEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021E9CF0 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9CEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021E9CF0 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9CF0 */ _t7 = _t6 & 0x00000001u;
         /* 021E9CF0 */ if (_t7) goto L_021E9CF4; else goto L_021E9D04;
   L_021E9CF4: ; // 0x21e9cf4
@@ -11446,16 +11446,16 @@ void Gambit_fn_021E9CC4(CPUState* cpu) {
   L_021E9CF8: ; // 0x21e9cf8
         /* 021E9CF8 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021E9CF8 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021E9CFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021E9D00 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9CFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021E9D00 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9D00 */ _t10 = _t9 & 0x00000001u;
         /* 021E9D00 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021E9D00 */ goto L_021E9D04;
   L_021E9D04: ; // 0x21e9d04
-        /* 021E9D04 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 021E9D04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 021E9D08 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021E9D08 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 021E9D0C */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E9D0C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E9D0C */ _t13 = _t12 & 0x00000001u;
         /* 021E9D0C */ if (_t13) goto L_021E9D10; else goto L_021E9D18;
   L_021E9D10: ; // 0x21e9d10
@@ -11466,11 +11466,11 @@ void Gambit_fn_021E9CC4(CPUState* cpu) {
         /* 021E9D18 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021E9D1C */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021E9D1C */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021E9D20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021E9D20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021E9D24 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021E9D24 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021E9D28 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 021E9D2C */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E9D2C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E9D2C */ _t18 = _t17 & 0x00000001u;
         /* 021E9D2C */ if (_t18) goto L_021E9D44; else goto L_021E9D30;
   L_021E9D30: ; // 0x21e9d30
@@ -11497,10 +11497,10 @@ void Gambit_fn_021E9D4C(CPUState* cpu) {
         /* 021E9D54 */ _t1 = cpu->r[3] + 0x00000028u;
         /* 021E9D54 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 021E9D58 */ cpu->r[8] = cpu->r[0];
-        /* 021E9D5C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021E9D5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021E9D60 */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 021E9D60 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021E9D64 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E9D64 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E9D64 */ _t4 = _t3 & 0x00000001u;
         /* 021E9D64 */ if (_t4) goto L_021E9D68; else goto L_021E9D80;
   L_021E9D68: ; // 0x21e9d68
@@ -11508,8 +11508,8 @@ void Gambit_fn_021E9D4C(CPUState* cpu) {
         /* 021E9D6C */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 021E9D70 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021E9D70 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021E9D74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021E9D78 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9D74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021E9D78 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9D78 */ _t7 = _t6 & 0x00000001u;
         /* 021E9D78 */ if (_t7) goto L_021E9D7C; else goto L_021E9D8C;
   L_021E9D7C: ; // 0x21e9d7c
@@ -11517,16 +11517,16 @@ void Gambit_fn_021E9D4C(CPUState* cpu) {
   L_021E9D80: ; // 0x21e9d80
         /* 021E9D80 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021E9D80 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021E9D84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021E9D88 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9D84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021E9D88 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9D88 */ _t10 = _t9 & 0x00000001u;
         /* 021E9D88 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021E9D88 */ goto L_021E9D8C;
   L_021E9D8C: ; // 0x21e9d8c
-        /* 021E9D8C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 021E9D8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 021E9D90 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021E9D90 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 021E9D94 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E9D94 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E9D94 */ _t13 = _t12 & 0x00000001u;
         /* 021E9D94 */ if (_t13) goto L_021E9D98; else goto L_021E9DA0;
   L_021E9D98: ; // 0x21e9d98
@@ -11537,11 +11537,11 @@ void Gambit_fn_021E9D4C(CPUState* cpu) {
         /* 021E9DA0 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021E9DA4 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021E9DA4 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021E9DA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021E9DA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021E9DAC */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021E9DAC */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021E9DB0 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 021E9DB4 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E9DB4 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E9DB4 */ _t18 = _t17 & 0x00000001u;
         /* 021E9DB4 */ if (_t18) goto L_021E9DCC; else goto L_021E9DB8;
   L_021E9DB8: ; // 0x21e9db8
@@ -11574,18 +11574,18 @@ void Gambit_fn_021E9DD4(CPUState* cpu) {
         /* 021E9DE8 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 021E9DE8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 021E9DEC */ cpu->r[12] = 0x00000000u;
-        /* 021E9DF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021E9DF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021E9DF4 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 021E9DF4 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 021E9DF8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9DF8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9DF8 */ _t6 = _t5 & 0x00000001u;
         /* 021E9DF8 */ if (_t6) goto L_021E9E20; else goto L_021E9DFC;
   L_021E9DFC: ; // 0x21e9dfc
         /* 021E9DFC */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 021E9DFC */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 021E9E00 */ /* nop */
-        /* 021E9E04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 021E9E08 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9E04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 021E9E08 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9E08 */ _t9 = _t8 & 0x00000001u;
         /* 021E9E08 */ if (_t9) goto L_021E9E0C; else goto L_021E9E20;
   L_021E9E0C: ; // 0x21e9e0c
@@ -11626,18 +11626,18 @@ void Gambit_fn_021E9DD8(CPUState* cpu) {
         /* 021E9DE8 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 021E9DE8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 021E9DEC */ cpu->r[12] = 0x00000000u;
-        /* 021E9DF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021E9DF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021E9DF4 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 021E9DF4 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 021E9DF8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9DF8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9DF8 */ _t6 = _t5 & 0x00000001u;
         /* 021E9DF8 */ if (_t6) goto L_021E9E20; else goto L_021E9DFC;
   L_021E9DFC: ; // 0x21e9dfc
         /* 021E9DFC */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 021E9DFC */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 021E9E00 */ /* nop */
-        /* 021E9E04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 021E9E08 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9E04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 021E9E08 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9E08 */ _t9 = _t8 & 0x00000001u;
         /* 021E9E08 */ if (_t9) goto L_021E9E0C; else goto L_021E9E20;
   L_021E9E0C: ; // 0x21e9e0c
@@ -11673,10 +11673,10 @@ void Gambit_fn_021E9E44(CPUState* cpu) {
         /* 021E9E4C */ _t1 = cpu->r[3] + 0x00000030u;
         /* 021E9E4C */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 021E9E50 */ cpu->r[7] = cpu->r[0];
-        /* 021E9E54 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 021E9E54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 021E9E58 */ _t2 = cpu->r[3] + 0x00000034u;
         /* 021E9E58 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021E9E5C */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E9E5C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E9E5C */ _t4 = _t3 & 0x00000001u;
         /* 021E9E5C */ if (_t4) goto L_021E9E60; else goto L_021E9E78;
   L_021E9E60: ; // 0x21e9e60
@@ -11684,8 +11684,8 @@ void Gambit_fn_021E9E44(CPUState* cpu) {
         /* 021E9E64 */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 021E9E68 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021E9E68 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021E9E6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021E9E70 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9E6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021E9E70 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9E70 */ _t7 = _t6 & 0x00000001u;
         /* 021E9E70 */ if (_t7) goto L_021E9E74; else goto L_021E9E84;
   L_021E9E74: ; // 0x21e9e74
@@ -11693,16 +11693,16 @@ void Gambit_fn_021E9E44(CPUState* cpu) {
   L_021E9E78: ; // 0x21e9e78
         /* 021E9E78 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021E9E78 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021E9E7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021E9E80 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9E7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021E9E80 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9E80 */ _t10 = _t9 & 0x00000001u;
         /* 021E9E80 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021E9E80 */ goto L_021E9E84;
   L_021E9E84: ; // 0x21e9e84
-        /* 021E9E84 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 021E9E84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 021E9E88 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021E9E88 */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 021E9E8C */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E9E8C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E9E8C */ _t13 = _t12 & 0x00000001u;
         /* 021E9E8C */ if (_t13) goto L_021E9E90; else goto L_021E9E98;
   L_021E9E90: ; // 0x21e9e90
@@ -11713,11 +11713,11 @@ void Gambit_fn_021E9E44(CPUState* cpu) {
         /* 021E9E98 */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021E9E9C */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021E9E9C */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021E9EA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021E9EA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021E9EA4 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021E9EA4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021E9EA8 */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 021E9EAC */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021E9EAC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021E9EAC */ _t18 = _t17 & 0x00000001u;
         /* 021E9EAC */ if (_t18) goto L_021E9EC4; else goto L_021E9EB0;
   L_021E9EB0: ; // 0x21e9eb0
@@ -11752,9 +11752,9 @@ void Gambit_fn_021E9ECC(CPUState* cpu) {
         /* 021E9EE4 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 021E9EE4 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 021E9EE8 */ /* nop */
-        /* 021E9EEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 021E9EEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 021E9EF0 */ cpu->r[31] = cpu->r[4];
-        /* 021E9EF4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9EF4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9EF4 */ _t6 = _t5 & 0x00000001u;
         /* 021E9EF4 */ if (_t6) goto L_021E9EF8; else goto L_021E9F0C;
   L_021E9EF8: ; // 0x21e9ef8
@@ -11803,9 +11803,9 @@ void Gambit_fn_021E9ED0(CPUState* cpu) {
         /* 021E9EE4 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 021E9EE4 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 021E9EE8 */ /* nop */
-        /* 021E9EEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 021E9EEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 021E9EF0 */ cpu->r[31] = cpu->r[4];
-        /* 021E9EF4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9EF4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9EF4 */ _t6 = _t5 & 0x00000001u;
         /* 021E9EF4 */ if (_t6) goto L_021E9EF8; else goto L_021E9F0C;
   L_021E9EF8: ; // 0x21e9ef8
@@ -11847,18 +11847,18 @@ void Gambit_fn_021E9F48(CPUState* cpu) {
         /* 021E9F4C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021E9F4C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021E9F50 */ cpu->r[31] = cpu->r[3];
-        /* 021E9F50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021E9F50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021E9F54 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021E9F54 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021E9F58 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9F58 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9F58 */ _t4 = _t3 & 0x00000001u;
         /* 021E9F58 */ if (_t4) goto L_021E9F5C; else goto L_021E9F6C;
   L_021E9F5C: ; // 0x21e9f5c
         /* 021E9F5C */ cpu->r[3] = 0x00000174u;
         /* 021E9F60 */ Gambit_fn_02801A78(cpu);
         /* 021E9F64 */ cpu->r[31] = cpu->r[3];
-        /* 021E9F64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021E9F68 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021E9F64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021E9F68 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021E9F68 */ _t6 = _t5 & 0x00000001u;
         /* 021E9F68 */ if (_t6) goto L_021E9F80; else goto L_021E9F6C;
   L_021E9F6C: ; // 0x21e9f6c
@@ -12015,19 +12015,19 @@ void Gambit_fn_021E9FF4(CPUState* cpu) {
         /* 0222AE5C */ cpu->r[7] = 0x10050000u;
         /* 0222AE60 */ _t16 = cpu->r[6] + 0x00000098u;
         /* 0222AE60 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t16);
-        /* 0222AE64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0222AE64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0222AE68 */ _t17 = cpu->r[7] + 0x0000009Cu;
         /* 0222AE68 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t17);
         /* 0222AE6C */ _t18 = cpu->r[3] + 0x000000FCu;
         /* 0222AE6C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t18);
-        /* 0222AE70 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222AE70 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222AE70 */ _t20 = _t19 & 0x00000001u;
         /* 0222AE70 */ if (_t20) goto L_0222AE74; else goto L_0222B040;
   L_0222AE74: ; // 0x222ae74
         /* 0222AE74 */ cpu->r[11] = cpu->r[12] + 0x00000218u;
         /* 0222AE78 */ cpu->r[0] = cpu->r[1] + 0x00000074u;
-        /* 0222AE7C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[0]);
-        /* 0222AE80 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222AE7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[0]));
+        /* 0222AE80 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222AE80 */ _t22 = _t21 & 0x00000001u;
         /* 0222AE80 */ if (_t22) goto L_0222AEB8; else goto L_0222AE84;
   L_0222AE84: ; // 0x222ae84
@@ -12083,16 +12083,16 @@ void Gambit_fn_021E9FF4(CPUState* cpu) {
         /* 0222AF08 */ /* nop */
         /* 0222AF0C */ /* nop */
         /* 0222AF10 */ /* nop */
-        /* 0222AF14 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[7]);
+        /* 0222AF14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[7]));
         /* 0222AF18 */ /* nop */
         /* 0222AF1C */ /* nop */
-        /* 0222AF20 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222AF20 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222AF20 */ _t35 = _t34 & 0x00000001u;
         /* 0222AF20 */ if (_t35) goto L_0222AF24; else goto L_0222AF30;
   L_0222AF24: ; // 0x222af24
         /* 0222AF24 */ /* nop */
-        /* 0222AF28 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[5], cpu->f[7]);
-        /* 0222AF2C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222AF28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[5], cpu->f[7]));
+        /* 0222AF2C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222AF2C */ _t37 = _t36 & 0x00000001u;
         /* 0222AF2C */ if (_t37) goto L_0222AFA8; else goto L_0222AF30;
   L_0222AF30: ; // 0x222af30
@@ -12198,8 +12198,8 @@ void Gambit_fn_021E9FF4(CPUState* cpu) {
         /* 0222B044 */ cpu->r[8] = rbrew_read32(cpu->mem, _t65);
         /* 0222B048 */ _t66 = cpu->r[8] + 0x00000753u;
         /* 0222B048 */ cpu->r[0] = rbrew_read8(cpu->mem, _t66);
-        /* 0222B04C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 0222B050 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222B04C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 0222B050 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222B050 */ _t68 = _t67 & 0x00000001u;
         /* 0222B050 */ if (_t68) goto L_0222B054; else goto L_0222B24C;
   L_0222B054: ; // 0x222b054
@@ -12277,19 +12277,19 @@ void Gambit_fn_021E9FF4(CPUState* cpu) {
         /* 0222B108 */ /* nop */
         /* 0222B10C */ /* nop */
         /* 0222B110 */ /* nop */
-        /* 0222B114 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[4], cpu->f[7]);
+        /* 0222B114 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[4], cpu->f[7]));
         /* 0222B118 */ /* nop */
         /* 0222B11C */ /* nop */
         /* 0222B120 */ /* nop */
         /* 0222B124 */ /* nop */
         /* 0222B128 */ /* nop */
-        /* 0222B12C */ _t95 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222B12C */ _t95 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222B12C */ _t96 = _t95 & 0x00000001u;
         /* 0222B12C */ if (_t96) goto L_0222B130; else goto L_0222B13C;
   L_0222B130: ; // 0x222b130
         /* 0222B130 */ /* nop */
-        /* 0222B134 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[7]);
-        /* 0222B138 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222B134 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[7]));
+        /* 0222B138 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222B138 */ _t98 = _t97 & 0x00000001u;
         /* 0222B138 */ if (_t98) goto L_0222B1B8; else goto L_0222B13C;
   L_0222B13C: ; // 0x222b13c
@@ -12465,19 +12465,19 @@ void Gambit_fn_021E9FF4(CPUState* cpu) {
         /* 0222B304 */ /* nop */
         /* 0222B308 */ /* nop */
         /* 0222B30C */ /* nop */
-        /* 0222B310 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[7]);
+        /* 0222B310 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[7]));
         /* 0222B314 */ /* nop */
         /* 0222B318 */ /* nop */
         /* 0222B31C */ /* nop */
         /* 0222B320 */ /* nop */
         /* 0222B324 */ /* nop */
-        /* 0222B328 */ _t152 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222B328 */ _t152 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222B328 */ _t153 = _t152 & 0x00000001u;
         /* 0222B328 */ if (_t153) goto L_0222B32C; else goto L_0222B338;
   L_0222B32C: ; // 0x222b32c
         /* 0222B32C */ /* nop */
-        /* 0222B330 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[5], cpu->f[7]);
-        /* 0222B334 */ _t154 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222B330 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[5], cpu->f[7]));
+        /* 0222B334 */ _t154 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222B334 */ _t155 = _t154 & 0x00000001u;
         /* 0222B334 */ if (_t155) goto L_0222B3B4; else goto L_0222B338;
   L_0222B338: ; // 0x222b338
@@ -12596,7 +12596,7 @@ void Gambit_fn_021E9FF4(CPUState* cpu) {
         /* 0222B464 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t190);
         /* 0222B468 */ _t191 = cpu->r[1] + 0x000000A8u;
         /* 0222B468 */ cpu->f[27] = rbrew_read_f64(cpu->mem, _t191);
-        /* 0222B46C */ _t192 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222B46C */ _t192 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222B46C */ _t193 = _t192 & 0x00000001u;
         /* 0222B46C */ if (_t193) goto L_0222B470; // else: addr-0 trap, fall-through
   L_0222B470: ; // 0x222b470
@@ -12660,8 +12660,8 @@ void Gambit_fn_021EA018(CPUState* cpu) {
         /* 021EA018 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021EA018 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021EA01C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021EA01C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021EA020 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA01C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021EA020 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA020 */ _t2 = _t1 & 0x00000001u;
         /* 021EA020 */ _t3 = _t2 ^ 0x00000001u;
         /* 021EA020 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -12683,8 +12683,8 @@ void Gambit_fn_021EA034(CPUState* cpu) {
         /* 021EA034 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021EA034 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021EA038 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021EA038 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021EA03C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA038 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021EA03C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA03C */ _t2 = _t1 & 0x00000001u;
         /* 021EA03C */ _t3 = _t2 ^ 0x00000001u;
         /* 021EA03C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -12706,8 +12706,8 @@ void Gambit_fn_021EA050(CPUState* cpu) {
         /* 021EA050 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021EA050 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021EA054 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021EA054 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021EA058 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021EA058 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA058 */ _t2 = _t1 & 0x00000001u;
         /* 021EA058 */ _t3 = _t2 ^ 0x00000001u;
         /* 021EA058 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -12750,8 +12750,8 @@ void Gambit_fn_021EA07C(CPUState* cpu) {
         /* 021EA08C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021EA090 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021EA090 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021EA094 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021EA098 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA094 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021EA098 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA098 */ _t5 = _t4 & 0x00000001u;
         /* 021EA098 */ if (_t5) goto L_021EA09C; else goto L_021EA0B8;
   L_021EA09C: ; // 0x21ea09c
@@ -12790,8 +12790,8 @@ void Gambit_fn_021EA080(CPUState* cpu) {
         /* 021EA08C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021EA090 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021EA090 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021EA094 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021EA098 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA094 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021EA098 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA098 */ _t5 = _t4 & 0x00000001u;
         /* 021EA098 */ if (_t5) goto L_021EA09C; else goto L_021EA0B8;
   L_021EA09C: ; // 0x21ea09c
@@ -13252,8 +13252,8 @@ void Gambit_fn_021EA290(CPUState* cpu) {
         /* 021EA290 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 021EA290 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021EA294 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 021EA294 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021EA298 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA294 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021EA298 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA298 */ _t2 = _t1 & 0x00000001u;
         /* 021EA298 */ if (_t2) goto L_021EA2A8; else goto L_021EA29C;
   L_021EA29C: ; // 0x21ea29c
@@ -13282,8 +13282,8 @@ void Gambit_fn_021EA2B4(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -13378,9 +13378,9 @@ void Gambit_fn_021EA304(CPUState* cpu) {
         /* 021EA308 */ _t0 = cpu->r[8] + 0xFFFFFCB4u;
         /* 021EA308 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 021EA30C */ cpu->r[6] = 0x101D0000u;
-        /* 021EA310 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021EA310 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021EA314 */ cpu->r[6] = cpu->r[6] + 0xFFFFFCB8u;
-        /* 021EA318 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA318 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA318 */ _t2 = _t1 & 0x00000001u;
         /* 021EA318 */ if (_t2) goto L_021EA31C; else goto L_021EA334;
   L_021EA31C: ; // 0x21ea31c
@@ -13393,8 +13393,8 @@ void Gambit_fn_021EA304(CPUState* cpu) {
         /* 021EA330 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 021EA330 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_021EA334: ; // 0x21ea334
-        /* 021EA334 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 021EA338 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA334 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 021EA338 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA338 */ _t6 = _t5 & 0x00000001u;
         /* 021EA338 */ if (_t6) goto L_021EA33C; else goto L_021EA344;
   L_021EA33C: ; // 0x21ea33c
@@ -13405,9 +13405,9 @@ void Gambit_fn_021EA304(CPUState* cpu) {
         /* 021EA348 */ _t7 = cpu->r[10] + 0xFFFFDA0Cu;
         /* 021EA348 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 021EA34C */ cpu->r[8] = 0x101D0000u;
-        /* 021EA350 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021EA350 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021EA354 */ cpu->r[8] = cpu->r[8] + 0xFFFFFC00u;
-        /* 021EA358 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA358 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA358 */ _t9 = _t8 & 0x00000001u;
         /* 021EA358 */ if (_t9) goto L_021EA35C; else goto L_021EA374;
   L_021EA35C: ; // 0x21ea35c
@@ -13420,8 +13420,8 @@ void Gambit_fn_021EA304(CPUState* cpu) {
         /* 021EA370 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 021EA370 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_021EA374: ; // 0x21ea374
-        /* 021EA374 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021EA378 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA374 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021EA378 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA378 */ _t13 = _t12 & 0x00000001u;
         /* 021EA378 */ if (_t13) goto L_021EA37C; else goto L_021EA384;
   L_021EA37C: ; // 0x21ea37c
@@ -13432,9 +13432,9 @@ void Gambit_fn_021EA304(CPUState* cpu) {
         /* 021EA388 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 021EA388 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 021EA38C */ cpu->r[10] = 0x101D0000u;
-        /* 021EA390 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021EA390 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021EA394 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 021EA398 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA398 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA398 */ _t16 = _t15 & 0x00000001u;
         /* 021EA398 */ if (_t16) goto L_021EA39C; else goto L_021EA3B4;
   L_021EA39C: ; // 0x21ea39c
@@ -13447,8 +13447,8 @@ void Gambit_fn_021EA304(CPUState* cpu) {
         /* 021EA3B0 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 021EA3B0 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_021EA3B4: ; // 0x21ea3b4
-        /* 021EA3B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021EA3B8 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA3B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021EA3B8 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA3B8 */ _t20 = _t19 & 0x00000001u;
         /* 021EA3B8 */ if (_t20) goto L_021EA3BC; else goto L_021EA3C4;
   L_021EA3BC: ; // 0x21ea3bc
@@ -13459,9 +13459,9 @@ void Gambit_fn_021EA304(CPUState* cpu) {
         /* 021EA3C8 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021EA3C8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021EA3CC */ cpu->r[12] = 0x101D0000u;
-        /* 021EA3D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021EA3D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021EA3D4 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021EA3D8 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA3D8 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA3D8 */ _t23 = _t22 & 0x00000001u;
         /* 021EA3D8 */ if (_t23) goto L_021EA3DC; else goto L_021EA3F4;
   L_021EA3DC: ; // 0x21ea3dc
@@ -13474,8 +13474,8 @@ void Gambit_fn_021EA304(CPUState* cpu) {
         /* 021EA3F0 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 021EA3F0 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_021EA3F4: ; // 0x21ea3f4
-        /* 021EA3F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021EA3F8 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA3F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021EA3F8 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA3F8 */ _t27 = _t26 & 0x00000001u;
         /* 021EA3F8 */ if (_t27) goto L_021EA3FC; else goto L_021EA404;
   L_021EA3FC: ; // 0x21ea3fc
@@ -13487,9 +13487,9 @@ void Gambit_fn_021EA304(CPUState* cpu) {
         /* 021EA408 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 021EA408 */ cpu->r[10] = _t28;
         /* 021EA40C */ cpu->r[7] = 0x101D0000u;
-        /* 021EA410 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021EA410 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021EA414 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 021EA418 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA418 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA418 */ _t30 = _t29 & 0x00000001u;
         /* 021EA418 */ if (_t30) goto L_021EA41C; else goto L_021EA430;
   L_021EA41C: ; // 0x21ea41c
@@ -13501,8 +13501,8 @@ void Gambit_fn_021EA304(CPUState* cpu) {
         /* 021EA42C */ _t32 = cpu->r[7] + 0x00000000u;
         /* 021EA42C */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_021EA430: ; // 0x21ea430
-        /* 021EA430 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 021EA434 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA430 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 021EA434 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA434 */ _t34 = _t33 & 0x00000001u;
         /* 021EA434 */ if (_t34) goto L_021EA438; else goto L_021EA440;
   L_021EA438: ; // 0x21ea438
@@ -13514,9 +13514,9 @@ void Gambit_fn_021EA304(CPUState* cpu) {
         /* 021EA444 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 021EA444 */ cpu->r[8] = _t35;
         /* 021EA448 */ cpu->r[6] = 0x101D0000u;
-        /* 021EA44C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021EA44C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021EA450 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 021EA454 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA454 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA454 */ _t37 = _t36 & 0x00000001u;
         /* 021EA454 */ if (_t37) goto L_021EA458; else goto L_021EA46C;
   L_021EA458: ; // 0x21ea458
@@ -13561,18 +13561,18 @@ void Gambit_fn_021EA490(CPUState* cpu) {
         /* 021EA494 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021EA494 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021EA498 */ cpu->r[31] = cpu->r[3];
-        /* 021EA498 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021EA498 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021EA49C */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021EA49C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021EA4A0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA4A0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA4A0 */ _t4 = _t3 & 0x00000001u;
         /* 021EA4A0 */ if (_t4) goto L_021EA4A4; else goto L_021EA4B4;
   L_021EA4A4: ; // 0x21ea4a4
         /* 021EA4A4 */ cpu->r[3] = 0x00000144u;
         /* 021EA4A8 */ Gambit_fn_02801A78(cpu);
         /* 021EA4AC */ cpu->r[31] = cpu->r[3];
-        /* 021EA4AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021EA4B0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA4AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021EA4B0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA4B0 */ _t6 = _t5 & 0x00000001u;
         /* 021EA4B0 */ if (_t6) goto L_021EA4C8; else goto L_021EA4B4;
   L_021EA4B4: ; // 0x21ea4b4
@@ -13615,8 +13615,8 @@ void Gambit_fn_021EA4E4(CPUState* cpu) {
         /* 021BEFB0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021BEFB4 */ _t3 = cpu->r[31] + 0x00000050u;
         /* 021BEFB4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 021BEFB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 021BEFBC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BEFB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 021BEFBC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BEFBC */ _t5 = _t4 & 0x00000001u;
         /* 021BEFBC */ if (_t5) goto L_021BEFC0; else goto L_021BEFD4;
   L_021BEFC0: ; // 0x21befc0
@@ -13708,8 +13708,8 @@ void Gambit_fn_021EA51C(CPUState* cpu) {
         /* 021EA51C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021EA51C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021EA520 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021EA520 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021EA524 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA520 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021EA524 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA524 */ _t2 = _t1 & 0x00000001u;
         /* 021EA524 */ _t3 = _t2 ^ 0x00000001u;
         /* 021EA524 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -13731,8 +13731,8 @@ void Gambit_fn_021EA538(CPUState* cpu) {
         /* 021EA538 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021EA538 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021EA53C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021EA53C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021EA540 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA53C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021EA540 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA540 */ _t2 = _t1 & 0x00000001u;
         /* 021EA540 */ _t3 = _t2 ^ 0x00000001u;
         /* 021EA540 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -13754,8 +13754,8 @@ void Gambit_fn_021EA554(CPUState* cpu) {
         /* 021EA554 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021EA554 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021EA558 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021EA558 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021EA55C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA558 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021EA55C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA55C */ _t2 = _t1 & 0x00000001u;
         /* 021EA55C */ _t3 = _t2 ^ 0x00000001u;
         /* 021EA55C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -13798,8 +13798,8 @@ void Gambit_fn_021EA580(CPUState* cpu) {
         /* 021EA590 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021EA594 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021EA594 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021EA598 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021EA59C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA598 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021EA59C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA59C */ _t5 = _t4 & 0x00000001u;
         /* 021EA59C */ if (_t5) goto L_021EA5A0; else goto L_021EA5BC;
   L_021EA5A0: ; // 0x21ea5a0
@@ -13838,8 +13838,8 @@ void Gambit_fn_021EA584(CPUState* cpu) {
         /* 021EA590 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021EA594 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021EA594 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021EA598 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021EA59C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA598 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021EA59C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA59C */ _t5 = _t4 & 0x00000001u;
         /* 021EA59C */ if (_t5) goto L_021EA5A0; else goto L_021EA5BC;
   L_021EA5A0: ; // 0x21ea5a0
@@ -14173,18 +14173,18 @@ void Gambit_fn_021EA704(CPUState* cpu) {
         /* 021EA98C */ _t3 = cpu->r[31] + 0x00000010u;
         /* 021EA98C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 021EA990 */ cpu->r[12] = 0x00000000u;
-        /* 021EA994 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021EA994 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021EA998 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 021EA998 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 021EA99C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA99C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA99C */ _t6 = _t5 & 0x00000001u;
         /* 021EA99C */ if (_t6) goto L_021EA9C4; else goto L_021EA9A0;
   L_021EA9A0: ; // 0x21ea9a0
         /* 021EA9A0 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 021EA9A0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 021EA9A4 */ /* nop */
-        /* 021EA9A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 021EA9AC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA9A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 021EA9AC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA9AC */ _t9 = _t8 & 0x00000001u;
         /* 021EA9AC */ if (_t9) goto L_021EA9B0; else goto L_021EA9C4;
   L_021EA9B0: ; // 0x21ea9b0
@@ -14341,10 +14341,10 @@ void Gambit_fn_021EA794(CPUState* cpu) {
         /* 021EA794 */ cpu->r[10] = 0x101D0000u;
         /* 021EA798 */ _t0 = cpu->r[10] + 0xFFFFFCC4u;
         /* 021EA798 */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 021EA79C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021EA79C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021EA7A0 */ cpu->r[10] = 0x101D0000u;
         /* 021EA7A4 */ cpu->r[10] = cpu->r[10] + 0xFFFFFCC8u;
-        /* 021EA7A8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA7A8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA7A8 */ _t2 = _t1 & 0x00000001u;
         /* 021EA7A8 */ if (_t2) goto L_021EA7AC; else goto L_021EA7C4;
   L_021EA7AC: ; // 0x21ea7ac
@@ -14357,8 +14357,8 @@ void Gambit_fn_021EA794(CPUState* cpu) {
         /* 021EA7C0 */ _t4 = cpu->r[10] + 0x00000000u;
         /* 021EA7C0 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_021EA7C4: ; // 0x21ea7c4
-        /* 021EA7C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021EA7C8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA7C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021EA7C8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA7C8 */ _t6 = _t5 & 0x00000001u;
         /* 021EA7C8 */ if (_t6) goto L_021EA7CC; else goto L_021EA7D4;
   L_021EA7CC: ; // 0x21ea7cc
@@ -14369,9 +14369,9 @@ void Gambit_fn_021EA794(CPUState* cpu) {
         /* 021EA7D8 */ _t7 = cpu->r[9] + 0xFFFFFCBCu;
         /* 021EA7D8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 021EA7DC */ cpu->r[11] = 0x101D0000u;
-        /* 021EA7E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021EA7E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021EA7E4 */ cpu->r[11] = cpu->r[11] + 0xFFFFFCC0u;
-        /* 021EA7E8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA7E8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA7E8 */ _t9 = _t8 & 0x00000001u;
         /* 021EA7E8 */ if (_t9) goto L_021EA7EC; else goto L_021EA804;
   L_021EA7EC: ; // 0x21ea7ec
@@ -14384,8 +14384,8 @@ void Gambit_fn_021EA794(CPUState* cpu) {
         /* 021EA800 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021EA800 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021EA804: ; // 0x21ea804
-        /* 021EA804 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021EA808 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA804 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021EA808 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA808 */ _t13 = _t12 & 0x00000001u;
         /* 021EA808 */ if (_t13) goto L_021EA80C; else goto L_021EA814;
   L_021EA80C: ; // 0x21ea80c
@@ -14396,9 +14396,9 @@ void Gambit_fn_021EA794(CPUState* cpu) {
         /* 021EA818 */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021EA818 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 021EA81C */ cpu->r[9] = 0x101D0000u;
-        /* 021EA820 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021EA820 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021EA824 */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 021EA828 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA828 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA828 */ _t16 = _t15 & 0x00000001u;
         /* 021EA828 */ if (_t16) goto L_021EA82C; else goto L_021EA844;
   L_021EA82C: ; // 0x21ea82c
@@ -14411,8 +14411,8 @@ void Gambit_fn_021EA794(CPUState* cpu) {
         /* 021EA840 */ _t18 = cpu->r[9] + 0x00000000u;
         /* 021EA840 */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_021EA844: ; // 0x21ea844
-        /* 021EA844 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 021EA848 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 021EA848 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA848 */ _t20 = _t19 & 0x00000001u;
         /* 021EA848 */ if (_t20) goto L_021EA84C; else goto L_021EA854;
   L_021EA84C: ; // 0x21ea84c
@@ -14424,9 +14424,9 @@ void Gambit_fn_021EA794(CPUState* cpu) {
         /* 021EA858 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 021EA858 */ cpu->r[9] = _t21;
         /* 021EA85C */ cpu->r[10] = 0x101D0000u;
-        /* 021EA860 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021EA860 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021EA864 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021EA868 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA868 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA868 */ _t23 = _t22 & 0x00000001u;
         /* 021EA868 */ if (_t23) goto L_021EA86C; else goto L_021EA880;
   L_021EA86C: ; // 0x21ea86c
@@ -14438,8 +14438,8 @@ void Gambit_fn_021EA794(CPUState* cpu) {
         /* 021EA87C */ _t25 = cpu->r[10] + 0x00000000u;
         /* 021EA87C */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_021EA880: ; // 0x21ea880
-        /* 021EA880 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021EA884 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA880 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021EA884 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA884 */ _t27 = _t26 & 0x00000001u;
         /* 021EA884 */ if (_t27) goto L_021EA888; else goto L_021EA890;
   L_021EA888: ; // 0x21ea888
@@ -14451,9 +14451,9 @@ void Gambit_fn_021EA794(CPUState* cpu) {
         /* 021EA894 */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 021EA894 */ cpu->r[10] = _t28;
         /* 021EA898 */ cpu->r[11] = 0x101D0000u;
-        /* 021EA89C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021EA89C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021EA8A0 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021EA8A4 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA8A4 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA8A4 */ _t30 = _t29 & 0x00000001u;
         /* 021EA8A4 */ if (_t30) goto L_021EA8A8; else goto L_021EA8BC;
   L_021EA8A8: ; // 0x21ea8a8
@@ -14511,10 +14511,10 @@ void Gambit_fn_021EA8F0(CPUState* cpu) {
         /* 021EA8F8 */ _t1 = cpu->r[3] + 0x00000028u;
         /* 021EA8F8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 021EA8FC */ cpu->r[8] = cpu->r[0];
-        /* 021EA900 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021EA900 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021EA904 */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 021EA904 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021EA908 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EA908 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EA908 */ _t4 = _t3 & 0x00000001u;
         /* 021EA908 */ if (_t4) goto L_021EA90C; else goto L_021EA924;
   L_021EA90C: ; // 0x21ea90c
@@ -14522,8 +14522,8 @@ void Gambit_fn_021EA8F0(CPUState* cpu) {
         /* 021EA910 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 021EA914 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021EA914 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021EA918 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021EA91C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021EA91C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA91C */ _t7 = _t6 & 0x00000001u;
         /* 021EA91C */ if (_t7) goto L_021EA920; else goto L_021EA930;
   L_021EA920: ; // 0x21ea920
@@ -14531,16 +14531,16 @@ void Gambit_fn_021EA8F0(CPUState* cpu) {
   L_021EA924: ; // 0x21ea924
         /* 021EA924 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021EA924 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021EA928 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021EA92C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA928 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021EA92C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA92C */ _t10 = _t9 & 0x00000001u;
         /* 021EA92C */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021EA92C */ goto L_021EA930;
   L_021EA930: ; // 0x21ea930
-        /* 021EA930 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 021EA930 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 021EA934 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021EA934 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 021EA938 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EA938 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EA938 */ _t13 = _t12 & 0x00000001u;
         /* 021EA938 */ if (_t13) goto L_021EA93C; else goto L_021EA944;
   L_021EA93C: ; // 0x21ea93c
@@ -14551,11 +14551,11 @@ void Gambit_fn_021EA8F0(CPUState* cpu) {
         /* 021EA944 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021EA948 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021EA948 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021EA94C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021EA94C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021EA950 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021EA950 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021EA954 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 021EA958 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EA958 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EA958 */ _t18 = _t17 & 0x00000001u;
         /* 021EA958 */ if (_t18) goto L_021EA970; else goto L_021EA95C;
   L_021EA95C: ; // 0x21ea95c
@@ -14588,18 +14588,18 @@ void Gambit_fn_021EA978(CPUState* cpu) {
         /* 021EA98C */ _t3 = cpu->r[31] + 0x00000010u;
         /* 021EA98C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 021EA990 */ cpu->r[12] = 0x00000000u;
-        /* 021EA994 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021EA994 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021EA998 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 021EA998 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 021EA99C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA99C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA99C */ _t6 = _t5 & 0x00000001u;
         /* 021EA99C */ if (_t6) goto L_021EA9C4; else goto L_021EA9A0;
   L_021EA9A0: ; // 0x21ea9a0
         /* 021EA9A0 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 021EA9A0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 021EA9A4 */ /* nop */
-        /* 021EA9A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 021EA9AC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA9A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 021EA9AC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA9AC */ _t9 = _t8 & 0x00000001u;
         /* 021EA9AC */ if (_t9) goto L_021EA9B0; else goto L_021EA9C4;
   L_021EA9B0: ; // 0x21ea9b0
@@ -14640,18 +14640,18 @@ void Gambit_fn_021EA97C(CPUState* cpu) {
         /* 021EA98C */ _t3 = cpu->r[31] + 0x00000010u;
         /* 021EA98C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 021EA990 */ cpu->r[12] = 0x00000000u;
-        /* 021EA994 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021EA994 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021EA998 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 021EA998 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 021EA99C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA99C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA99C */ _t6 = _t5 & 0x00000001u;
         /* 021EA99C */ if (_t6) goto L_021EA9C4; else goto L_021EA9A0;
   L_021EA9A0: ; // 0x21ea9a0
         /* 021EA9A0 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 021EA9A0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 021EA9A4 */ /* nop */
-        /* 021EA9A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 021EA9AC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA9A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 021EA9AC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA9AC */ _t9 = _t8 & 0x00000001u;
         /* 021EA9AC */ if (_t9) goto L_021EA9B0; else goto L_021EA9C4;
   L_021EA9B0: ; // 0x21ea9b0
@@ -14687,10 +14687,10 @@ void Gambit_fn_021EA9E8(CPUState* cpu) {
         /* 021EA9F0 */ _t1 = cpu->r[3] + 0x00000020u;
         /* 021EA9F0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 021EA9F4 */ cpu->r[8] = cpu->r[0];
-        /* 021EA9F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021EA9F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021EA9FC */ _t2 = cpu->r[3] + 0x00000024u;
         /* 021EA9FC */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021EAA00 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EAA00 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EAA00 */ _t4 = _t3 & 0x00000001u;
         /* 021EAA00 */ if (_t4) goto L_021EAA04; else goto L_021EAA1C;
   L_021EAA04: ; // 0x21eaa04
@@ -14698,8 +14698,8 @@ void Gambit_fn_021EA9E8(CPUState* cpu) {
         /* 021EAA08 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 021EAA0C */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021EAA0C */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021EAA10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021EAA14 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EAA10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021EAA14 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EAA14 */ _t7 = _t6 & 0x00000001u;
         /* 021EAA14 */ if (_t7) goto L_021EAA18; else goto L_021EAA28;
   L_021EAA18: ; // 0x21eaa18
@@ -14707,16 +14707,16 @@ void Gambit_fn_021EA9E8(CPUState* cpu) {
   L_021EAA1C: ; // 0x21eaa1c
         /* 021EAA1C */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021EAA1C */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021EAA20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021EAA24 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EAA20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021EAA24 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EAA24 */ _t10 = _t9 & 0x00000001u;
         /* 021EAA24 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021EAA24 */ goto L_021EAA28;
   L_021EAA28: ; // 0x21eaa28
-        /* 021EAA28 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 021EAA28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 021EAA2C */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021EAA2C */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 021EAA30 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EAA30 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EAA30 */ _t13 = _t12 & 0x00000001u;
         /* 021EAA30 */ if (_t13) goto L_021EAA34; else goto L_021EAA3C;
   L_021EAA34: ; // 0x21eaa34
@@ -14727,11 +14727,11 @@ void Gambit_fn_021EA9E8(CPUState* cpu) {
         /* 021EAA3C */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021EAA40 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021EAA40 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021EAA44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021EAA44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021EAA48 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021EAA48 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021EAA4C */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 021EAA50 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EAA50 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EAA50 */ _t18 = _t17 & 0x00000001u;
         /* 021EAA50 */ if (_t18) goto L_021EAA68; else goto L_021EAA54;
   L_021EAA54: ; // 0x21eaa54
@@ -14758,10 +14758,10 @@ void Gambit_fn_021EAA70(CPUState* cpu) {
         /* 021EAA78 */ _t1 = cpu->r[3] + 0x00000030u;
         /* 021EAA78 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 021EAA7C */ cpu->r[7] = cpu->r[0];
-        /* 021EAA80 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 021EAA80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 021EAA84 */ _t2 = cpu->r[3] + 0x00000034u;
         /* 021EAA84 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021EAA88 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EAA88 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EAA88 */ _t4 = _t3 & 0x00000001u;
         /* 021EAA88 */ if (_t4) goto L_021EAA8C; else goto L_021EAAA4;
   L_021EAA8C: ; // 0x21eaa8c
@@ -14769,8 +14769,8 @@ void Gambit_fn_021EAA70(CPUState* cpu) {
         /* 021EAA90 */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 021EAA94 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021EAA94 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021EAA98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021EAA9C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EAA98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021EAA9C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EAA9C */ _t7 = _t6 & 0x00000001u;
         /* 021EAA9C */ if (_t7) goto L_021EAAA0; else goto L_021EAAB0;
   L_021EAAA0: ; // 0x21eaaa0
@@ -14778,16 +14778,16 @@ void Gambit_fn_021EAA70(CPUState* cpu) {
   L_021EAAA4: ; // 0x21eaaa4
         /* 021EAAA4 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021EAAA4 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021EAAA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021EAAAC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EAAA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021EAAAC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EAAAC */ _t10 = _t9 & 0x00000001u;
         /* 021EAAAC */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021EAAAC */ goto L_021EAAB0;
   L_021EAAB0: ; // 0x21eaab0
-        /* 021EAAB0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 021EAAB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 021EAAB4 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021EAAB4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 021EAAB8 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EAAB8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EAAB8 */ _t13 = _t12 & 0x00000001u;
         /* 021EAAB8 */ if (_t13) goto L_021EAABC; else goto L_021EAAC4;
   L_021EAABC: ; // 0x21eaabc
@@ -14798,11 +14798,11 @@ void Gambit_fn_021EAA70(CPUState* cpu) {
         /* 021EAAC4 */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021EAAC8 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021EAAC8 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021EAACC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021EAACC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021EAAD0 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021EAAD0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021EAAD4 */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 021EAAD8 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EAAD8 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EAAD8 */ _t18 = _t17 & 0x00000001u;
         /* 021EAAD8 */ if (_t18) goto L_021EAAF0; else goto L_021EAADC;
   L_021EAADC: ; // 0x21eaadc
@@ -14837,9 +14837,9 @@ void Gambit_fn_021EAAF8(CPUState* cpu) {
         /* 021EAB10 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 021EAB10 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 021EAB14 */ /* nop */
-        /* 021EAB18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 021EAB18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 021EAB1C */ cpu->r[31] = cpu->r[4];
-        /* 021EAB20 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EAB20 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EAB20 */ _t6 = _t5 & 0x00000001u;
         /* 021EAB20 */ if (_t6) goto L_021EAB24; else goto L_021EAB38;
   L_021EAB24: ; // 0x21eab24
@@ -14888,9 +14888,9 @@ void Gambit_fn_021EAAFC(CPUState* cpu) {
         /* 021EAB10 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 021EAB10 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 021EAB14 */ /* nop */
-        /* 021EAB18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 021EAB18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 021EAB1C */ cpu->r[31] = cpu->r[4];
-        /* 021EAB20 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EAB20 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EAB20 */ _t6 = _t5 & 0x00000001u;
         /* 021EAB20 */ if (_t6) goto L_021EAB24; else goto L_021EAB38;
   L_021EAB24: ; // 0x21eab24
@@ -14934,18 +14934,18 @@ void Gambit_fn_021EAB74(CPUState* cpu) {
         /* 021EAB7C */ _t2 = cpu->r[1] + 0x00000008u;
         /* 021EAB7C */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 021EAB80 */ cpu->r[31] = cpu->r[3];
-        /* 021EAB80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021EAB80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021EAB84 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 021EAB84 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 021EAB88 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EAB88 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EAB88 */ _t5 = _t4 & 0x00000001u;
         /* 021EAB88 */ if (_t5) goto L_021EAB8C; else goto L_021EAB9C;
   L_021EAB8C: ; // 0x21eab8c
         /* 021EAB8C */ cpu->r[3] = 0x000000F8u;
         /* 021EAB90 */ Gambit_fn_02801A78(cpu);
         /* 021EAB94 */ cpu->r[31] = cpu->r[3];
-        /* 021EAB94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021EAB98 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EAB94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021EAB98 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EAB98 */ _t7 = _t6 & 0x00000001u;
         /* 021EAB98 */ if (_t7) goto L_021EAC08; else goto L_021EAB9C;
   L_021EAB9C: ; // 0x21eab9c
@@ -14954,10 +14954,10 @@ void Gambit_fn_021EAB74(CPUState* cpu) {
         /* 021EABA4 */ cpu->r[12] = 0x10030000u;
         /* 021EABA8 */ cpu->r[12] = cpu->r[12] + 0x00006870u;
         /* 021EABAC */ cpu->r[0] = cpu->r[31] + 0x00000084u;
-        /* 021EABAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021EABAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021EABB0 */ _t8 = cpu->r[31] + 0x00000004u;
         /* 021EABB0 */ rbrew_write32(cpu->mem, _t8, cpu->r[12]);
-        /* 021EABB4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EABB4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EABB4 */ _t10 = _t9 & 0x00000001u;
         /* 021EABB4 */ if (_t10) goto L_021EABB8; else goto L_021EABC0;
   L_021EABB8: ; // 0x21eabb8
@@ -14965,8 +14965,8 @@ void Gambit_fn_021EAB74(CPUState* cpu) {
         /* 021EABBC */ Gambit_fn_02801A78(cpu);
   L_021EABC0: ; // 0x21eabc0
         /* 021EABC0 */ cpu->r[10] = cpu->r[31] + 0x00000090u;
-        /* 021EABC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021EABC4 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EABC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021EABC4 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EABC4 */ _t12 = _t11 & 0x00000001u;
         /* 021EABC4 */ if (_t12) goto L_021EABC8; else goto L_021EABD0;
   L_021EABC8: ; // 0x21eabc8
@@ -14975,10 +14975,10 @@ void Gambit_fn_021EAB74(CPUState* cpu) {
   L_021EABD0: ; // 0x21eabd0
         /* 021EABD0 */ cpu->r[30] = 0x00000000u;
         /* 021EABD4 */ cpu->r[11] = cpu->r[31] + 0x000000A0u;
-        /* 021EABD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021EABD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021EABD8 */ _t13 = cpu->r[31] + 0x0000009Cu;
         /* 021EABD8 */ rbrew_write32(cpu->mem, _t13, cpu->r[30]);
-        /* 021EABDC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EABDC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EABDC */ _t15 = _t14 & 0x00000001u;
         /* 021EABDC */ if (_t15) goto L_021EABE0; else goto L_021EABE8;
   L_021EABE0: ; // 0x21eabe0
@@ -14986,8 +14986,8 @@ void Gambit_fn_021EAB74(CPUState* cpu) {
         /* 021EABE4 */ Gambit_fn_02801A78(cpu);
   L_021EABE8: ; // 0x21eabe8
         /* 021EABE8 */ cpu->r[12] = cpu->r[31] + 0x000000D0u;
-        /* 021EABE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021EABEC */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EABE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021EABEC */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EABEC */ _t17 = _t16 & 0x00000001u;
         /* 021EABEC */ if (_t17) goto L_021EABF0; else goto L_021EABF8;
   L_021EABF0: ; // 0x21eabf0
@@ -15116,10 +15116,10 @@ void Gambit_fn_021EAC24(CPUState* cpu) {
         /* 021EAD04 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t35);
         /* 021EAD08 */ _t36 = cpu->r[27] + 0x000000DDu;
         /* 021EAD08 */ rbrew_write8(cpu->mem, _t36, (uint8_t)cpu->r[25]);
-        /* 021EAD0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 021EAD0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 021EAD10 */ _t37 = cpu->r[27] + 0x000000D8u;
         /* 021EAD10 */ rbrew_write_f32(cpu->mem, _t37, cpu->f[0]);
-        /* 021EAD14 */ _t38 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EAD14 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EAD14 */ _t39 = _t38 & 0x00000001u;
         /* 021EAD14 */ if (_t39) goto L_021EAD18; else goto L_021EAD2C;
   L_021EAD18: ; // 0x21ead18
@@ -15807,9 +15807,9 @@ void Gambit_fn_021EAFC8(CPUState* cpu) {
         /* 02056F04 */ cpu->r[7] = _t2;
         /* 02056F08 */ cpu->r[31] = 0x101E0000u;
         /* 02056F0C */ cpu->r[22] = cpu->r[3];
-        /* 02056F10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02056F10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02056F14 */ cpu->r[31] = cpu->r[31] + 0xFFFFA5C0u;
-        /* 02056F18 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056F18 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056F18 */ _t4 = _t3 & 0x00000001u;
         /* 02056F18 */ if (_t4) goto L_02056F1C; else goto L_02056F64;
   L_02056F1C: ; // 0x2056f1c
@@ -15835,8 +15835,8 @@ void Gambit_fn_021EAFC8(CPUState* cpu) {
   L_02056F64: ; // 0x2056f64
         /* 02056F64 */ _t6 = cpu->r[31] + 0x00000054u;
         /* 02056F64 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 02056F68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02056F6C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056F68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02056F6C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056F6C */ _t8 = _t7 & 0x00000001u;
         /* 02056F6C */ if (_t8) goto L_02056F70; else goto L_02057064;
   L_02056F70: ; // 0x2056f70
@@ -15852,9 +15852,9 @@ void Gambit_fn_021EAFC8(CPUState* cpu) {
   L_02056F94: ; // 0x2056f94
         /* 02056F94 */ _t9 = cpu->r[24] + 0xFFFFE580u;
         /* 02056F94 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 02056F98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02056F98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02056F9C */ cpu->r[29] = cpu->r[30];
-        /* 02056FA0 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056FA0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056FA0 */ _t11 = _t10 & 0x00000001u;
         /* 02056FA0 */ if (_t11) goto L_02056FA4; else goto L_02056FBC;
   L_02056FA4: ; // 0x2056fa4
@@ -15868,8 +15868,8 @@ void Gambit_fn_021EAFC8(CPUState* cpu) {
   L_02056FBC: ; // 0x2056fbc
         /* 02056FBC */ _t13 = cpu->r[20] + 0xFFFFE57Cu;
         /* 02056FBC */ cpu->r[11] = rbrew_read32(cpu->mem, _t13);
-        /* 02056FC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02056FC4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056FC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02056FC4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056FC4 */ _t15 = _t14 & 0x00000001u;
         /* 02056FC4 */ if (_t15) goto L_02056FC8; else goto L_02056FD0;
   L_02056FC8: ; // 0x2056fc8
@@ -15878,8 +15878,8 @@ void Gambit_fn_021EAFC8(CPUState* cpu) {
         /* 02056FCC */ _t17 = cpu->r[20] + 0xFFFFE57Cu;
         /* 02056FCC */ rbrew_write32(cpu->mem, _t17, cpu->r[21]);
   L_02056FD0: ; // 0x2056fd0
-        /* 02056FD0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], 0x00000004u);
-        /* 02056FD4 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02056FD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], 0x00000004u));
+        /* 02056FD4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02056FD4 */ _t19 = _t18 & 0x00000001u;
         /* 02056FD4 */ if (_t19) goto L_02056FFC; else goto L_02056FD8;
   L_02056FD8: ; // 0x2056fd8
@@ -15888,12 +15888,12 @@ void Gambit_fn_021EAFC8(CPUState* cpu) {
         /* 02056FE0 */ cpu->r[5] = 0x00000000u;
         /* 02056FE4 */ Gambit_fn_028A6634(cpu);
         /* 02056FE8 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02056FEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000004u);
-        /* 02056FF0 */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02056FEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000004u));
+        /* 02056FF0 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02056FF0 */ _t21 = _t20 & 0x00000001u;
         /* 02056FF0 */ if (_t21) goto L_02057064; else goto L_02056FF4;
   L_02056FF4: ; // 0x2056ff4
-        /* 02056FF4 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02056FF4 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02056FF4 */ _t23 = _t22 & 0x00000001u;
         /* 02056FF4 */ if (_t23) goto L_02056F94; else goto L_02056FF8;
   L_02056FF8: ; // 0x2056ff8
@@ -15901,8 +15901,8 @@ void Gambit_fn_021EAFC8(CPUState* cpu) {
   L_02056FFC: ; // 0x2056ffc
         /* 02056FFC */ _t24 = cpu->r[19] + 0xFFFFE578u;
         /* 02056FFC */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
-        /* 02057000 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02057004 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02057000 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02057004 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02057004 */ _t26 = _t25 & 0x00000001u;
         /* 02057004 */ if (_t26) goto L_02057008; else goto L_02057040;
   L_02057008: ; // 0x2057008
@@ -15911,8 +15911,8 @@ void Gambit_fn_021EAFC8(CPUState* cpu) {
         /* 02057010 */ Gambit_fn_02836FFC(cpu);
         /* 02057014 */ _t27 = cpu->r[19] + 0xFFFFE578u;
         /* 02057014 */ cpu->r[0] = rbrew_read32(cpu->mem, _t27);
-        /* 02057018 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0205701C */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02057018 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0205701C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0205701C */ _t29 = _t28 & 0x00000001u;
         /* 0205701C */ if (_t29) goto L_02057020; else goto L_02057034;
   L_02057020: ; // 0x2057020
@@ -15935,12 +15935,12 @@ void Gambit_fn_021EAFC8(CPUState* cpu) {
         /* 0205704C */ cpu->r[4] = cpu->r[30];
         /* 02057050 */ Gambit_fn_028A6634(cpu);
         /* 02057054 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02057058 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000004u);
-        /* 0205705C */ _t33 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02057058 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000004u));
+        /* 0205705C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0205705C */ _t34 = _t33 & 0x00000001u;
         /* 0205705C */ if (_t34) goto L_02057064; else goto L_02057060;
   L_02057060: ; // 0x2057060
-        /* 02057060 */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02057060 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02057060 */ _t36 = _t35 & 0x00000001u;
         /* 02057060 */ if (_t36) goto L_02056F94; else goto L_02057064;
   L_02057064: ; // 0x2057064
@@ -16021,14 +16021,14 @@ void Gambit_fn_021EAFD8(CPUState* cpu) {
         /* 021EB040 */ _t18 = cpu->r[30] + 0x00000094u;
         /* 021EB040 */ cpu->r[0] = rbrew_read32(cpu->mem, _t18);
         /* 021EB044 */ cpu->f[29] = cpu->f[3];
-        /* 021EB048 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[0]);
+        /* 021EB048 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[0]));
         /* 021EB04C */ _t19 = cpu->r[1] + 0x00000010u;
         /* 021EB04C */ rbrew_write32(cpu->mem, _t19, cpu->r[0]);
         /* 021EB050 */ cpu->f[30] = cpu->f[1];
         /* 021EB054 */ _t20 = cpu->r[1] + 0x00000010u;
         /* 021EB054 */ rbrew_write_f32(cpu->mem, _t20, cpu->f[0]);
         /* 021EB058 */ cpu->f[31] = cpu->f[2];
-        /* 021EB05C */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EB05C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EB05C */ _t22 = _t21 & 0x00000001u;
         /* 021EB05C */ if (_t22) goto L_021EB060; else goto L_021EB09C;
   L_021EB060: ; // 0x21eb060
@@ -16104,9 +16104,9 @@ void Gambit_fn_021EAFD8(CPUState* cpu) {
         /* 021EB138 */ cpu->r[11] = cpu->r[31] + cpu->r[11];
         /* 021EB13C */ _t37 = cpu->r[11] + 0x00000104u;
         /* 021EB13C */ cpu->r[4] = rbrew_read8(cpu->mem, _t37);
-        /* 021EB140 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 021EB140 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 021EB144 */ cpu->r[6] = cpu->r[3];
-        /* 021EB148 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB148 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB148 */ _t39 = _t38 & 0x00000001u;
         /* 021EB148 */ if (_t39) goto L_021EB22C; else goto L_021EB14C;
   L_021EB14C: ; // 0x21eb14c
@@ -16115,8 +16115,8 @@ void Gambit_fn_021EAFD8(CPUState* cpu) {
         /* 021EB154 */ cpu->r[3] = cpu->r[31];
         /* 021EB158 */ Gambit_fn_021F000C(cpu);
         /* 021EB15C */ cpu->r[31] = cpu->r[3];
-        /* 021EB15C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021EB160 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB15C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021EB160 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB160 */ _t41 = _t40 & 0x00000001u;
         /* 021EB160 */ if (_t41) goto L_021EB22C; else goto L_021EB164;
   L_021EB164: ; // 0x21eb164
@@ -16125,9 +16125,9 @@ void Gambit_fn_021EAFD8(CPUState* cpu) {
         /* 021EB168 */ _t43 = cpu->r[9] + 0x00000254u;
         /* 021EB168 */ cpu->r[0] = rbrew_read32(cpu->mem, _t43);
         /* 021EB16C */ cpu->r[3] = cpu->r[30];
-        /* 021EB170 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 021EB170 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 021EB174 */ cpu->ctr = cpu->r[0];
-        /* 021EB178 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB178 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB178 */ _t45 = _t44 & 0x00000001u;
         /* 021EB178 */ if (_t45) goto L_021EB1F0; else goto L_021EB17C;
   L_021EB17C: ; // 0x21eb17c
@@ -16170,7 +16170,7 @@ void Gambit_fn_021EAFD8(CPUState* cpu) {
         /* 021EB1D4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t59);
         /* 021EB1D8 */ _t60 = cpu->r[1] + 0x00000088u;
         /* 021EB1D8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t60);
-        /* 021EB1DC */ _t61 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EB1DC */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EB1DC */ _t62 = _t61 & 0x00000001u;
         /* 021EB1DC */ if (_t62) goto L_021EB1E0; // else: addr-0 trap, fall-through
   L_021EB1E0: ; // 0x21eb1e0
@@ -16220,7 +16220,7 @@ void Gambit_fn_021EAFD8(CPUState* cpu) {
         /* 021EB248 */ cpu->r[31] = rbrew_read32(cpu->mem, _t77);
         /* 021EB24C */ _t78 = cpu->r[1] + 0x00000088u;
         /* 021EB24C */ cpu->r[30] = rbrew_read32(cpu->mem, _t78);
-        /* 021EB250 */ _t79 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EB250 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EB250 */ _t80 = _t79 & 0x00000001u;
         /* 021EB250 */ if (_t80) goto L_021EB254; // else: addr-0 trap, fall-through
   L_021EB254: ; // 0x21eb254
@@ -16285,14 +16285,14 @@ void Gambit_fn_021EB264(CPUState* cpu) {
         /* 021EB040 */ _t18 = cpu->r[30] + 0x00000094u;
         /* 021EB040 */ cpu->r[0] = rbrew_read32(cpu->mem, _t18);
         /* 021EB044 */ cpu->f[29] = cpu->f[3];
-        /* 021EB048 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[0]);
+        /* 021EB048 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[0]));
         /* 021EB04C */ _t19 = cpu->r[1] + 0x00000010u;
         /* 021EB04C */ rbrew_write32(cpu->mem, _t19, cpu->r[0]);
         /* 021EB050 */ cpu->f[30] = cpu->f[1];
         /* 021EB054 */ _t20 = cpu->r[1] + 0x00000010u;
         /* 021EB054 */ rbrew_write_f32(cpu->mem, _t20, cpu->f[0]);
         /* 021EB058 */ cpu->f[31] = cpu->f[2];
-        /* 021EB05C */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EB05C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EB05C */ _t22 = _t21 & 0x00000001u;
         /* 021EB05C */ if (_t22) goto L_021EB060; else goto L_021EB09C;
   L_021EB060: ; // 0x21eb060
@@ -16368,9 +16368,9 @@ void Gambit_fn_021EB264(CPUState* cpu) {
         /* 021EB138 */ cpu->r[11] = cpu->r[31] + cpu->r[11];
         /* 021EB13C */ _t37 = cpu->r[11] + 0x00000104u;
         /* 021EB13C */ cpu->r[4] = rbrew_read8(cpu->mem, _t37);
-        /* 021EB140 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 021EB140 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 021EB144 */ cpu->r[6] = cpu->r[3];
-        /* 021EB148 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB148 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB148 */ _t39 = _t38 & 0x00000001u;
         /* 021EB148 */ if (_t39) goto L_021EB22C; else goto L_021EB14C;
   L_021EB14C: ; // 0x21eb14c
@@ -16379,8 +16379,8 @@ void Gambit_fn_021EB264(CPUState* cpu) {
         /* 021EB154 */ cpu->r[3] = cpu->r[31];
         /* 021EB158 */ Gambit_fn_021F000C(cpu);
         /* 021EB15C */ cpu->r[31] = cpu->r[3];
-        /* 021EB15C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021EB160 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB15C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021EB160 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB160 */ _t41 = _t40 & 0x00000001u;
         /* 021EB160 */ if (_t41) goto L_021EB22C; else goto L_021EB164;
   L_021EB164: ; // 0x21eb164
@@ -16389,9 +16389,9 @@ void Gambit_fn_021EB264(CPUState* cpu) {
         /* 021EB168 */ _t43 = cpu->r[9] + 0x00000254u;
         /* 021EB168 */ cpu->r[0] = rbrew_read32(cpu->mem, _t43);
         /* 021EB16C */ cpu->r[3] = cpu->r[30];
-        /* 021EB170 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 021EB170 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 021EB174 */ cpu->ctr = cpu->r[0];
-        /* 021EB178 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB178 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB178 */ _t45 = _t44 & 0x00000001u;
         /* 021EB178 */ if (_t45) goto L_021EB1F0; else goto L_021EB17C;
   L_021EB17C: ; // 0x21eb17c
@@ -16434,7 +16434,7 @@ void Gambit_fn_021EB264(CPUState* cpu) {
         /* 021EB1D4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t59);
         /* 021EB1D8 */ _t60 = cpu->r[1] + 0x00000088u;
         /* 021EB1D8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t60);
-        /* 021EB1DC */ _t61 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EB1DC */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EB1DC */ _t62 = _t61 & 0x00000001u;
         /* 021EB1DC */ if (_t62) goto L_021EB1E0; // else: addr-0 trap, fall-through
   L_021EB1E0: ; // 0x21eb1e0
@@ -16484,7 +16484,7 @@ void Gambit_fn_021EB264(CPUState* cpu) {
         /* 021EB248 */ cpu->r[31] = rbrew_read32(cpu->mem, _t77);
         /* 021EB24C */ _t78 = cpu->r[1] + 0x00000088u;
         /* 021EB24C */ cpu->r[30] = rbrew_read32(cpu->mem, _t78);
-        /* 021EB250 */ _t79 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EB250 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EB250 */ _t80 = _t79 & 0x00000001u;
         /* 021EB250 */ if (_t80) goto L_021EB254; // else: addr-0 trap, fall-through
   L_021EB254: ; // 0x21eb254
@@ -16553,14 +16553,14 @@ void Gambit_fn_021EB26C(CPUState* cpu) {
         /* 021EB040 */ _t18 = cpu->r[30] + 0x00000094u;
         /* 021EB040 */ cpu->r[0] = rbrew_read32(cpu->mem, _t18);
         /* 021EB044 */ cpu->f[29] = cpu->f[3];
-        /* 021EB048 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[0]);
+        /* 021EB048 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[0]));
         /* 021EB04C */ _t19 = cpu->r[1] + 0x00000010u;
         /* 021EB04C */ rbrew_write32(cpu->mem, _t19, cpu->r[0]);
         /* 021EB050 */ cpu->f[30] = cpu->f[1];
         /* 021EB054 */ _t20 = cpu->r[1] + 0x00000010u;
         /* 021EB054 */ rbrew_write_f32(cpu->mem, _t20, cpu->f[0]);
         /* 021EB058 */ cpu->f[31] = cpu->f[2];
-        /* 021EB05C */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EB05C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EB05C */ _t22 = _t21 & 0x00000001u;
         /* 021EB05C */ if (_t22) goto L_021EB060; else goto L_021EB09C;
   L_021EB060: ; // 0x21eb060
@@ -16636,9 +16636,9 @@ void Gambit_fn_021EB26C(CPUState* cpu) {
         /* 021EB138 */ cpu->r[11] = cpu->r[31] + cpu->r[11];
         /* 021EB13C */ _t37 = cpu->r[11] + 0x00000104u;
         /* 021EB13C */ cpu->r[4] = rbrew_read8(cpu->mem, _t37);
-        /* 021EB140 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 021EB140 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 021EB144 */ cpu->r[6] = cpu->r[3];
-        /* 021EB148 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB148 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB148 */ _t39 = _t38 & 0x00000001u;
         /* 021EB148 */ if (_t39) goto L_021EB22C; else goto L_021EB14C;
   L_021EB14C: ; // 0x21eb14c
@@ -16647,8 +16647,8 @@ void Gambit_fn_021EB26C(CPUState* cpu) {
         /* 021EB154 */ cpu->r[3] = cpu->r[31];
         /* 021EB158 */ Gambit_fn_021F000C(cpu);
         /* 021EB15C */ cpu->r[31] = cpu->r[3];
-        /* 021EB15C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021EB160 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB15C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021EB160 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB160 */ _t41 = _t40 & 0x00000001u;
         /* 021EB160 */ if (_t41) goto L_021EB22C; else goto L_021EB164;
   L_021EB164: ; // 0x21eb164
@@ -16657,9 +16657,9 @@ void Gambit_fn_021EB26C(CPUState* cpu) {
         /* 021EB168 */ _t43 = cpu->r[9] + 0x00000254u;
         /* 021EB168 */ cpu->r[0] = rbrew_read32(cpu->mem, _t43);
         /* 021EB16C */ cpu->r[3] = cpu->r[30];
-        /* 021EB170 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 021EB170 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 021EB174 */ cpu->ctr = cpu->r[0];
-        /* 021EB178 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB178 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB178 */ _t45 = _t44 & 0x00000001u;
         /* 021EB178 */ if (_t45) goto L_021EB1F0; else goto L_021EB17C;
   L_021EB17C: ; // 0x21eb17c
@@ -16702,7 +16702,7 @@ void Gambit_fn_021EB26C(CPUState* cpu) {
         /* 021EB1D4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t59);
         /* 021EB1D8 */ _t60 = cpu->r[1] + 0x00000088u;
         /* 021EB1D8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t60);
-        /* 021EB1DC */ _t61 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EB1DC */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EB1DC */ _t62 = _t61 & 0x00000001u;
         /* 021EB1DC */ if (_t62) goto L_021EB1E0; // else: addr-0 trap, fall-through
   L_021EB1E0: ; // 0x21eb1e0
@@ -16752,7 +16752,7 @@ void Gambit_fn_021EB26C(CPUState* cpu) {
         /* 021EB248 */ cpu->r[31] = rbrew_read32(cpu->mem, _t77);
         /* 021EB24C */ _t78 = cpu->r[1] + 0x00000088u;
         /* 021EB24C */ cpu->r[30] = rbrew_read32(cpu->mem, _t78);
-        /* 021EB250 */ _t79 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EB250 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EB250 */ _t80 = _t79 & 0x00000001u;
         /* 021EB250 */ if (_t80) goto L_021EB254; // else: addr-0 trap, fall-through
   L_021EB254: ; // 0x21eb254
@@ -16808,11 +16808,11 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB2C8 */ _t11 = cpu->r[31] + 0x00006000u;
         /* 021EB2C8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
         /* 021EB2C8 */ cpu->r[31] = _t11;
-        /* 021EB2CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 021EB2CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 021EB2D0 */ cpu->r[27] = cpu->r[26];
         /* 021EB2D4 */ _t12 = cpu->r[7] + 0x0000027Cu;
         /* 021EB2D4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t12);
-        /* 021EB2D8 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB2D8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB2D8 */ _t14 = _t13 & 0x00000001u;
         /* 021EB2D8 */ if (_t14) goto L_021EB314; else goto L_021EB2DC;
   L_021EB2DC: ; // 0x21eb2dc
@@ -16831,10 +16831,10 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB2FC */ cpu->r[26] = cpu->r[3];
         /* 021EB300 */ _t19 = cpu->r[5] + 0x00006798u;
         /* 021EB300 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t19);
-        /* 021EB304 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 021EB304 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 021EB308 */ _t20 = cpu->r[29] + 0x00000051u;
         /* 021EB308 */ cpu->r[31] = rbrew_read8(cpu->mem, _t20);
-        /* 021EB30C */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB30C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB30C */ _t22 = _t21 & 0x00000001u;
         /* 021EB30C */ if (_t22) goto L_021EB594; else goto L_021EB310;
   L_021EB310: ; // 0x21eb310
@@ -16857,10 +16857,10 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB338 */ cpu->r[27] = cpu->r[3];
         /* 021EB33C */ _t28 = cpu->r[5] + 0x00006798u;
         /* 021EB33C */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t28);
-        /* 021EB340 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 021EB340 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 021EB344 */ _t29 = cpu->r[29] + 0x00000051u;
         /* 021EB344 */ cpu->r[31] = rbrew_read8(cpu->mem, _t29);
-        /* 021EB348 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB348 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB348 */ _t31 = _t30 & 0x00000001u;
         /* 021EB348 */ if (_t31) goto L_021EB594; else goto L_021EB34C;
   L_021EB34C: ; // 0x21eb34c
@@ -16871,26 +16871,26 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB35C */ cpu->r[3] = cpu->r[25];
         /* 021EB360 */ Gambit_fn_021F000C(cpu);
         /* 021EB364 */ cpu->r[30] = cpu->r[3];
-        /* 021EB364 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021EB368 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB364 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021EB368 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB368 */ _t33 = _t32 & 0x00000001u;
         /* 021EB368 */ if (_t33) goto L_021EB594; else goto L_021EB36C;
   L_021EB36C: ; // 0x21eb36c
         /* 021EB36C */ cpu->r[3] = cpu->r[1] + 0x000000B4u;
         /* 021EB370 */ Gambit_fn_021C7360(cpu);
-        /* 021EB374 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021EB374 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021EB378 */ _t34 = cpu->r[1] + 0x000000B4u;
         /* 021EB378 */ rbrew_write_f32(cpu->mem, _t34, cpu->f[30]);
-        /* 021EB37C */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB37C */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB37C */ _t36 = _t35 & 0x00000001u;
         /* 021EB37C */ if (_t36) goto L_021EB394; else goto L_021EB380;
   L_021EB380: ; // 0x21eb380
         /* 021EB380 */ _t37 = cpu->r[26] + 0x00000268u;
         /* 021EB380 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t37);
-        /* 021EB384 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021EB384 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021EB388 */ _t38 = cpu->r[1] + 0x000000B8u;
         /* 021EB388 */ rbrew_write_f32(cpu->mem, _t38, cpu->f[0]);
-        /* 021EB38C */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB38C */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB38C */ _t40 = _t39 & 0x00000001u;
         /* 021EB38C */ if (_t40) goto L_021EB3B8; else goto L_021EB390;
   L_021EB390: ; // 0x21eb390
@@ -16898,19 +16898,19 @@ void Gambit_fn_021EB274(CPUState* cpu) {
   L_021EB394: ; // 0x21eb394
         /* 021EB394 */ _t41 = cpu->r[27] + 0x00001768u;
         /* 021EB394 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t41);
-        /* 021EB398 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021EB398 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021EB39C */ _t42 = cpu->r[1] + 0x000000B8u;
         /* 021EB39C */ rbrew_write_f32(cpu->mem, _t42, cpu->f[0]);
-        /* 021EB3A0 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB3A0 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB3A0 */ _t44 = _t43 & 0x00000001u;
         /* 021EB3A0 */ if (_t44) goto L_021EB3B8; else goto L_021EB3A4;
   L_021EB3A4: ; // 0x21eb3a4
         /* 021EB3A4 */ _t45 = cpu->r[26] + 0x00000328u;
         /* 021EB3A4 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t45);
-        /* 021EB3A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021EB3A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021EB3AC */ _t46 = cpu->r[1] + 0x000000BCu;
         /* 021EB3AC */ rbrew_write_f32(cpu->mem, _t46, cpu->f[11]);
-        /* 021EB3B0 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB3B0 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB3B0 */ _t48 = _t47 & 0x00000001u;
         /* 021EB3B0 */ if (_t48) goto L_021EB3DC; else goto L_021EB3B4;
   L_021EB3B4: ; // 0x21eb3b4
@@ -16918,19 +16918,19 @@ void Gambit_fn_021EB274(CPUState* cpu) {
   L_021EB3B8: ; // 0x21eb3b8
         /* 021EB3B8 */ _t49 = cpu->r[27] + 0x00001828u;
         /* 021EB3B8 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t49);
-        /* 021EB3BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021EB3BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021EB3C0 */ _t50 = cpu->r[1] + 0x000000BCu;
         /* 021EB3C0 */ rbrew_write_f32(cpu->mem, _t50, cpu->f[11]);
-        /* 021EB3C4 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB3C4 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB3C4 */ _t52 = _t51 & 0x00000001u;
         /* 021EB3C4 */ if (_t52) goto L_021EB3DC; else goto L_021EB3C8;
   L_021EB3C8: ; // 0x21eb3c8
         /* 021EB3C8 */ _t53 = cpu->r[26] + 0x000003E8u;
         /* 021EB3C8 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t53);
-        /* 021EB3CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021EB3CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021EB3D0 */ _t54 = cpu->r[1] + 0x000000C0u;
         /* 021EB3D0 */ rbrew_write_f32(cpu->mem, _t54, cpu->f[10]);
-        /* 021EB3D4 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB3D4 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB3D4 */ _t56 = _t55 & 0x00000001u;
         /* 021EB3D4 */ if (_t56) goto L_021EB400; else goto L_021EB3D8;
   L_021EB3D8: ; // 0x21eb3d8
@@ -16938,19 +16938,19 @@ void Gambit_fn_021EB274(CPUState* cpu) {
   L_021EB3DC: ; // 0x21eb3dc
         /* 021EB3DC */ _t57 = cpu->r[27] + 0x000018E8u;
         /* 021EB3DC */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t57);
-        /* 021EB3E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021EB3E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021EB3E4 */ _t58 = cpu->r[1] + 0x000000C0u;
         /* 021EB3E4 */ rbrew_write_f32(cpu->mem, _t58, cpu->f[10]);
-        /* 021EB3E8 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB3E8 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB3E8 */ _t60 = _t59 & 0x00000001u;
         /* 021EB3E8 */ if (_t60) goto L_021EB400; else goto L_021EB3EC;
   L_021EB3EC: ; // 0x21eb3ec
         /* 021EB3EC */ _t61 = cpu->r[26] + 0x00000208u;
         /* 021EB3EC */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t61);
-        /* 021EB3F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021EB3F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021EB3F4 */ _t62 = cpu->r[1] + 0x000000C4u;
         /* 021EB3F4 */ rbrew_write_f32(cpu->mem, _t62, cpu->f[8]);
-        /* 021EB3F8 */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB3F8 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB3F8 */ _t64 = _t63 & 0x00000001u;
         /* 021EB3F8 */ if (_t64) goto L_021EB424; else goto L_021EB3FC;
   L_021EB3FC: ; // 0x21eb3fc
@@ -16958,19 +16958,19 @@ void Gambit_fn_021EB274(CPUState* cpu) {
   L_021EB400: ; // 0x21eb400
         /* 021EB400 */ _t65 = cpu->r[27] + 0x00001708u;
         /* 021EB400 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t65);
-        /* 021EB404 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021EB404 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021EB408 */ _t66 = cpu->r[1] + 0x000000C4u;
         /* 021EB408 */ rbrew_write_f32(cpu->mem, _t66, cpu->f[8]);
-        /* 021EB40C */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB40C */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB40C */ _t68 = _t67 & 0x00000001u;
         /* 021EB40C */ if (_t68) goto L_021EB424; else goto L_021EB410;
   L_021EB410: ; // 0x21eb410
         /* 021EB410 */ _t69 = cpu->r[26] + 0x000002C8u;
         /* 021EB410 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t69);
-        /* 021EB414 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021EB414 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021EB418 */ _t70 = cpu->r[1] + 0x000000C8u;
         /* 021EB418 */ rbrew_write_f32(cpu->mem, _t70, cpu->f[6]);
-        /* 021EB41C */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB41C */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB41C */ _t72 = _t71 & 0x00000001u;
         /* 021EB41C */ if (_t72) goto L_021EB460; else goto L_021EB420;
   L_021EB420: ; // 0x21eb420
@@ -16978,10 +16978,10 @@ void Gambit_fn_021EB274(CPUState* cpu) {
   L_021EB424: ; // 0x21eb424
         /* 021EB424 */ _t73 = cpu->r[27] + 0x000017C8u;
         /* 021EB424 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t73);
-        /* 021EB428 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021EB428 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021EB42C */ _t74 = cpu->r[1] + 0x000000C8u;
         /* 021EB42C */ rbrew_write_f32(cpu->mem, _t74, cpu->f[6]);
-        /* 021EB430 */ _t75 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB430 */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB430 */ _t76 = _t75 & 0x00000001u;
         /* 021EB430 */ if (_t76) goto L_021EB460; else goto L_021EB434;
   L_021EB434: ; // 0x21eb434
@@ -16997,10 +16997,10 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB448 */ rbrew_write_f32(cpu->mem, _t80, cpu->f[13]);
         /* 021EB44C */ _t81 = cpu->r[1] + 0x000000CCu;
         /* 021EB44C */ rbrew_write_f32(cpu->mem, _t81, cpu->f[9]);
-        /* 021EB450 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021EB450 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021EB454 */ _t82 = cpu->r[1] + 0x000000E0u;
         /* 021EB454 */ rbrew_write_f32(cpu->mem, _t82, cpu->f[12]);
-        /* 021EB458 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB458 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB458 */ _t84 = _t83 & 0x00000001u;
         /* 021EB458 */ if (_t84) goto L_021EB4A8; else goto L_021EB45C;
   L_021EB45C: ; // 0x21eb45c
@@ -17018,10 +17018,10 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB474 */ rbrew_write_f32(cpu->mem, _t88, cpu->f[13]);
         /* 021EB478 */ _t89 = cpu->r[1] + 0x000000CCu;
         /* 021EB478 */ rbrew_write_f32(cpu->mem, _t89, cpu->f[9]);
-        /* 021EB47C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021EB47C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021EB480 */ _t90 = cpu->r[1] + 0x000000E0u;
         /* 021EB480 */ rbrew_write_f32(cpu->mem, _t90, cpu->f[12]);
-        /* 021EB484 */ _t91 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB484 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB484 */ _t92 = _t91 & 0x00000001u;
         /* 021EB484 */ if (_t92) goto L_021EB4A8; else goto L_021EB488;
   L_021EB488: ; // 0x21eb488
@@ -17032,10 +17032,10 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB490 */ rbrew_write_f32(cpu->mem, _t94, cpu->f[30]);
         /* 021EB494 */ _t95 = cpu->r[1] + 0x00000111u;
         /* 021EB494 */ rbrew_write8(cpu->mem, _t95, (uint8_t)cpu->r[0]);
-        /* 021EB498 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021EB498 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021EB49C */ _t96 = cpu->r[1] + 0x000000F4u;
         /* 021EB49C */ rbrew_write_f32(cpu->mem, _t96, cpu->f[7]);
-        /* 021EB4A0 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB4A0 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB4A0 */ _t98 = _t97 & 0x00000001u;
         /* 021EB4A0 */ if (_t98) goto L_021EB510; else goto L_021EB4A4;
   L_021EB4A4: ; // 0x21eb4a4
@@ -17048,18 +17048,18 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB4B0 */ rbrew_write_f32(cpu->mem, _t100, cpu->f[30]);
         /* 021EB4B4 */ _t101 = cpu->r[1] + 0x00000111u;
         /* 021EB4B4 */ rbrew_write8(cpu->mem, _t101, (uint8_t)cpu->r[0]);
-        /* 021EB4B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021EB4B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021EB4BC */ _t102 = cpu->r[1] + 0x000000F4u;
         /* 021EB4BC */ rbrew_write_f32(cpu->mem, _t102, cpu->f[7]);
-        /* 021EB4C0 */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB4C0 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB4C0 */ _t104 = _t103 & 0x00000001u;
         /* 021EB4C0 */ if (_t104) goto L_021EB510; else goto L_021EB4C4;
   L_021EB4C4: ; // 0x21eb4c4
         /* 021EB4C4 */ _t105 = cpu->r[29] + 0x000000DCu;
         /* 021EB4C4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t105);
         /* 021EB4C8 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000000u, 0x00000002u);
-        /* 021EB4C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021EB4CC */ _t106 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB4C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021EB4CC */ _t106 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB4CC */ _t107 = _t106 & 0x00000001u;
         /* 021EB4CC */ if (_t107) goto L_021EB510; else goto L_021EB4D0;
   L_021EB4D0: ; // 0x21eb4d0
@@ -17091,10 +17091,10 @@ void Gambit_fn_021EB274(CPUState* cpu) {
   L_021EB510: ; // 0x21eb510
         /* 021EB510 */ cpu->r[3] = cpu->r[30];
         /* 021EB514 */ cpu->r[7] = cpu->r[29] + 0x00000084u;
-        /* 021EB518 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021EB518 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021EB51C */ cpu->r[4] = 0x00000000u;
         /* 021EB520 */ cpu->r[12] = cpu->r[29] + 0x000000E0u;
-        /* 021EB524 */ _t117 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB524 */ _t117 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB524 */ _t118 = _t117 & 0x00000001u;
         /* 021EB524 */ if (_t118) goto L_021EB560; else goto L_021EB528;
   L_021EB528: ; // 0x21eb528
@@ -17179,21 +17179,21 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB5E0 */ cpu->r[11] = 0x10030000u;
         /* 021EB5E4 */ _t149 = cpu->r[1] + 0x00000034u;
         /* 021EB5E4 */ rbrew_write_f32(cpu->mem, _t149, cpu->f[13]);
-        /* 021EB5E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021EB5E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021EB5EC */ _t150 = cpu->r[11] + 0x0000681Cu;
         /* 021EB5EC */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t150);
         /* 021EB5F0 */ _t151 = cpu->r[1] + 0x00000018u;
         /* 021EB5F0 */ rbrew_write_f32(cpu->mem, _t151, cpu->f[7]);
         /* 021EB5F4 */ _t152 = cpu->r[1] + 0x00000030u;
         /* 021EB5F4 */ rbrew_write_f32(cpu->mem, _t152, cpu->f[11]);
-        /* 021EB5F8 */ _t153 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB5F8 */ _t153 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB5F8 */ _t154 = _t153 & 0x00000001u;
         /* 021EB5F8 */ if (_t154) goto L_021EB60C; else goto L_021EB5FC;
   L_021EB5FC: ; // 0x21eb5fc
         /* 021EB5FC */ _t155 = cpu->r[26] + 0x000005C8u;
         /* 021EB5FC */ cpu->r[0] = rbrew_read8(cpu->mem, _t155);
-        /* 021EB600 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021EB604 */ _t156 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB600 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021EB604 */ _t156 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB604 */ _t157 = _t156 & 0x00000001u;
         /* 021EB604 */ if (_t157) goto L_021EB60C; else goto L_021EB608;
   L_021EB608: ; // 0x21eb608
@@ -17215,9 +17215,9 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB634 */ cpu->r[9] = cpu->r[31];
         /* 021EB638 */ cpu->r[8] = cpu->r[1] + 0x00000024u;
   L_021EB63C: ; // 0x21eb63c
-        /* 021EB63C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021EB63C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021EB640 */ cpu->r[0] = 0x00000001u;
-        /* 021EB644 */ _t161 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EB644 */ _t161 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EB644 */ _t162 = _t161 & 0x00000001u;
         /* 021EB644 */ if (_t162) goto L_021EB648; else goto L_021EB664;
   L_021EB648: ; // 0x21eb648
@@ -17229,8 +17229,8 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB654 */ _t164 = cpu->r[12] + 0x00000004u;
         /* 021EB654 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t164);
         /* 021EB654 */ cpu->r[12] = _t164;
-        /* 021EB658 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[13]);
-        /* 021EB65C */ _t165 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB658 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[13]));
+        /* 021EB65C */ _t165 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB65C */ _t166 = _t165 & 0x00000001u;
         /* 021EB65C */ if (_t166) goto L_021EB784; else goto L_021EB660;
   L_021EB660: ; // 0x21eb660
@@ -17253,47 +17253,47 @@ void Gambit_fn_021EB274(CPUState* cpu) {
   L_021EB68C: ; // 0x21eb68c
         /* 021EB68C */ _t170 = cpu->r[8] + 0x00000000u;
         /* 021EB68C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t170);
-        /* 021EB690 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[4]);
-        /* 021EB694 */ _t171 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB690 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[4]));
+        /* 021EB694 */ _t171 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB694 */ _t172 = _t171 & 0x00000001u;
         /* 021EB694 */ if (_t172) goto L_021EB698; else goto L_021EB6A0;
   L_021EB698: ; // 0x21eb698
-        /* 021EB698 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021EB69C */ _t173 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EB698 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021EB69C */ _t173 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EB69C */ _t174 = _t173 & 0x00000001u;
         /* 021EB69C */ if (_t174) goto L_021EB6C0; else goto L_021EB6A0;
   L_021EB6A0: ; // 0x21eb6a0
-        /* 021EB6A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021EB6A4 */ _t175 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB6A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021EB6A4 */ _t175 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB6A4 */ _t176 = _t175 & 0x00000001u;
         /* 021EB6A4 */ if (_t176) goto L_021EB6D8; else goto L_021EB6A8;
   L_021EB6A8: ; // 0x21eb6a8
         /* 021EB6A8 */ _t177 = cpu->r[8] + 0x00000000u;
         /* 021EB6A8 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t177);
-        /* 021EB6AC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[2]);
-        /* 021EB6B0 */ _t178 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB6AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[2]));
+        /* 021EB6B0 */ _t178 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB6B0 */ _t179 = _t178 & 0x00000001u;
         /* 021EB6B0 */ if (_t179) goto L_021EB6B4; else goto L_021EB6D8;
   L_021EB6B4: ; // 0x21eb6b4
         /* 021EB6B4 */ _t180 = cpu->r[12] + 0x00000000u;
         /* 021EB6B4 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t180);
-        /* 021EB6B8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[5]);
-        /* 021EB6BC */ _t181 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB6B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[5]));
+        /* 021EB6BC */ _t181 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB6BC */ _t182 = _t181 & 0x00000001u;
         /* 021EB6BC */ if (_t182) goto L_021EB6C0; else goto L_021EB6D8;
   L_021EB6C0: ; // 0x21eb6c0
         /* 021EB6C0 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
         /* 021EB6C4 */ cpu->r[0] = 0x00000000u;
-        /* 021EB6C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000004u);
+        /* 021EB6C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000004u));
         /* 021EB6CC */ cpu->r[12] = cpu->r[12] + 0x00000004u;
-        /* 021EB6D0 */ _t183 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EB6D0 */ _t183 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EB6D0 */ _t184 = _t183 & 0x00000001u;
         /* 021EB6D0 */ if (_t184) goto L_021EB68C; else goto L_021EB6D4;
   L_021EB6D4: ; // 0x21eb6d4
         /* 021EB6D4 */ goto L_021EB784;
   L_021EB6D8: ; // 0x21eb6d8
-        /* 021EB6D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021EB6DC */ _t185 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EB6D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021EB6DC */ _t185 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EB6DC */ _t186 = _t185 & 0x00000001u;
         /* 021EB6DC */ if (_t186) goto L_021EB6E0; else goto L_021EB6FC;
   L_021EB6E0: ; // 0x21eb6e0
@@ -17305,8 +17305,8 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB6EC */ _t188 = cpu->r[6] + 0x00000004u;
         /* 021EB6EC */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t188);
         /* 021EB6EC */ cpu->r[6] = _t188;
-        /* 021EB6F0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[11]);
-        /* 021EB6F4 */ _t189 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB6F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[11]));
+        /* 021EB6F4 */ _t189 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB6F4 */ _t190 = _t189 & 0x00000001u;
         /* 021EB6F4 */ if (_t190) goto L_021EB6C0; else goto L_021EB6F8;
   L_021EB6F8: ; // 0x21eb6f8
@@ -17316,8 +17316,8 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB6F8 */ _t193 = _t192 & 0x00000001u;
         /* 021EB6F8 */ if (_t193) goto L_021EB6EC; else goto L_021EB6FC;
   L_021EB6FC: ; // 0x21eb6fc
-        /* 021EB6FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021EB700 */ _t194 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB6FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021EB700 */ _t194 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB700 */ _t195 = _t194 & 0x00000001u;
         /* 021EB700 */ if (_t195) goto L_021EB774; else goto L_021EB704;
   L_021EB704: ; // 0x21eb704
@@ -17328,22 +17328,22 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB710 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
         /* 021EB714 */ _t197 = cpu->r[6] + 0x00000008u;
         /* 021EB714 */ rbrew_write8(cpu->mem, _t197, (uint8_t)cpu->r[10]);
-        /* 021EB718 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021EB718 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021EB71C */ _t198 = cpu->r[6] + 0x00000004u;
         /* 021EB71C */ rbrew_write32(cpu->mem, _t198, cpu->r[9]);
         /* 021EB720 */ _t199 = cpu->r[8] + 0x00000000u;
         /* 021EB720 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t199);
-        /* 021EB724 */ _t200 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB724 */ _t200 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB724 */ _t201 = _t200 & 0x00000001u;
         /* 021EB724 */ if (_t201) goto L_021EB750; else goto L_021EB728;
   L_021EB728: ; // 0x21eb728
-        /* 021EB728 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[2]);
-        /* 021EB72C */ _t202 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[2]));
+        /* 021EB72C */ _t202 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB72C */ _t203 = _t202 & 0x00000001u;
         /* 021EB72C */ if (_t203) goto L_021EB774; else goto L_021EB730;
   L_021EB730: ; // 0x21eb730
-        /* 021EB730 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[3]);
-        /* 021EB734 */ _t204 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB730 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[3]));
+        /* 021EB734 */ _t204 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB734 */ _t205 = _t204 & 0x00000001u;
         /* 021EB734 */ if (_t205) goto L_021EB774; else goto L_021EB738;
   L_021EB738: ; // 0x21eb738
@@ -17358,13 +17358,13 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB748 */ rbrew_write32(cpu->mem, _t208, cpu->r[9]);
         /* 021EB74C */ goto L_021EB774;
   L_021EB750: ; // 0x21eb750
-        /* 021EB750 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[2]);
-        /* 021EB754 */ _t209 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB750 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[2]));
+        /* 021EB754 */ _t209 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB754 */ _t210 = _t209 & 0x00000001u;
         /* 021EB754 */ if (_t210) goto L_021EB774; else goto L_021EB758;
   L_021EB758: ; // 0x21eb758
-        /* 021EB758 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[3]);
-        /* 021EB75C */ _t211 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB758 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[3]));
+        /* 021EB75C */ _t211 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB75C */ _t212 = _t211 & 0x00000001u;
         /* 021EB75C */ if (_t212) goto L_021EB774; else goto L_021EB760;
   L_021EB760: ; // 0x21eb760
@@ -17379,24 +17379,24 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB770 */ rbrew_write8(cpu->mem, _t215, (uint8_t)cpu->r[11]);
   L_021EB774: ; // 0x21eb774
         /* 021EB774 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 021EB778 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000004u);
+        /* 021EB778 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000004u));
         /* 021EB77C */ cpu->r[12] = cpu->r[12] + 0x00000004u;
-        /* 021EB780 */ _t216 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EB780 */ _t216 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EB780 */ _t217 = _t216 & 0x00000001u;
         /* 021EB780 */ if (_t217) goto L_021EB68C; else goto L_021EB784;
   L_021EB784: ; // 0x21eb784
         /* 021EB784 */ cpu->r[3] = cpu->r[3] + 0xFFFFFFFFu;
-        /* 021EB784 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021EB784 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021EB788 */ cpu->r[9] = cpu->r[9] + 0x00000001u;
         /* 021EB78C */ cpu->r[8] = cpu->r[8] + 0x00000004u;
-        /* 021EB790 */ _t218 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB790 */ _t218 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB790 */ _t219 = _t218 & 0x00000001u;
         /* 021EB790 */ if (_t219) goto L_021EB794; else goto L_021EB63C;
   L_021EB794: ; // 0x21eb794
         /* 021EB794 */ _t220 = cpu->r[29] + 0x00000051u;
         /* 021EB794 */ cpu->r[0] = rbrew_read8(cpu->mem, _t220);
-        /* 021EB798 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021EB79C */ _t221 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB798 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021EB79C */ _t221 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB79C */ _t222 = _t221 & 0x00000001u;
         /* 021EB79C */ if (_t222) goto L_021EB828; else goto L_021EB7A0;
   L_021EB7A0: ; // 0x21eb7a0
@@ -17405,9 +17405,9 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB7A4 */ cpu->r[3] = cpu->r[1] + 0x00000118u;
         /* 021EB7A8 */ Gambit_fn_028300A4(cpu);
         /* 021EB7AC */ cpu->r[20] = cpu->r[31];
-        /* 021EB7AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
+        /* 021EB7AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
         /* 021EB7B0 */ cpu->r[23] = 0x00000000u;
-        /* 021EB7B4 */ _t224 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EB7B4 */ _t224 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EB7B4 */ _t225 = _t224 & 0x00000001u;
         /* 021EB7B4 */ if (_t225) goto L_021EB7B8; else goto L_021EB828;
   L_021EB7B8: ; // 0x21eb7b8
@@ -17417,8 +17417,8 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB7C0 */ cpu->r[3] = cpu->r[1] + 0x00000118u;
         /* 021EB7C4 */ Gambit_fn_02830138(cpu);
         /* 021EB7C8 */ /* nop */
-        /* 021EB7CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], cpu->r[4]);
-        /* 021EB7D0 */ _t226 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB7CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], cpu->r[4]));
+        /* 021EB7D0 */ _t226 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB7D0 */ _t227 = _t226 & 0x00000001u;
         /* 021EB7D0 */ if (_t227) goto L_021EB818; else goto L_021EB7D4;
   L_021EB7D4: ; // 0x21eb7d4
@@ -17456,10 +17456,10 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB814 */ rbrew_write32(cpu->mem, _t242, cpu->r[11]);
   L_021EB818: ; // 0x21eb818
         /* 021EB818 */ cpu->r[20] = cpu->r[20] + 0xFFFFFFFFu;
-        /* 021EB818 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
+        /* 021EB818 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
         /* 021EB81C */ cpu->r[23] = cpu->r[23] + 0x00000001u;
         /* 021EB820 */ cpu->r[21] = cpu->r[21] + 0x0000000Cu;
-        /* 021EB824 */ _t243 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB824 */ _t243 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB824 */ _t244 = _t243 & 0x00000001u;
         /* 021EB824 */ if (_t244) goto L_021EB828; else goto L_021EB7C0;
   L_021EB828: ; // 0x21eb828
@@ -17467,15 +17467,15 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB82C */ cpu->r[12] = 0x10030000u;
         /* 021EB830 */ _t245 = cpu->r[4] + 0x00006794u;
         /* 021EB830 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t245);
-        /* 021EB834 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021EB834 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021EB838 */ _t246 = cpu->r[12] + 0x00006834u;
         /* 021EB838 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t246);
-        /* 021EB83C */ _t247 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB83C */ _t247 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB83C */ _t248 = _t247 & 0x00000001u;
         /* 021EB83C */ if (_t248) goto L_021EB8CC; else goto L_021EB840;
   L_021EB840: ; // 0x21eb840
-        /* 021EB840 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021EB844 */ _t249 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EB840 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021EB844 */ _t249 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EB844 */ _t250 = _t249 & 0x00000001u;
         /* 021EB844 */ if (_t250) goto L_021EB848; else goto L_021EB94C;
   L_021EB848: ; // 0x21eb848
@@ -17488,11 +17488,11 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB858 */ cpu->r[0] = rbrew_read8(cpu->mem, _t251);
         /* 021EB85C */ _t252 = cpu->r[21] + 0x00000010u;
         /* 021EB85C */ cpu->r[4] = rbrew_read32(cpu->mem, _t252);
-        /* 021EB860 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021EB860 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021EB864 */ _t253 = cpu->r[21] + 0x0000000Cu;
         /* 021EB864 */ cpu->r[0] = rbrew_read32(cpu->mem, _t253);
         /* 021EB864 */ cpu->r[21] = _t253;
-        /* 021EB868 */ _t254 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB868 */ _t254 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB868 */ _t255 = _t254 & 0x00000001u;
         /* 021EB868 */ if (_t255) goto L_021EB898; else goto L_021EB86C;
   L_021EB86C: ; // 0x21eb86c
@@ -17507,8 +17507,8 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB884 */ cpu->r[4] = cpu->r[26];
         /* 021EB888 */ Gambit_fn_021EB264(cpu);
         /* 021EB88C */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 021EB88C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021EB890 */ _t258 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB88C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021EB890 */ _t258 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB890 */ _t259 = _t258 & 0x00000001u;
         /* 021EB890 */ if (_t259) goto L_021EB894; else goto L_021EB858;
   L_021EB894: ; // 0x21eb894
@@ -17525,20 +17525,20 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB8B0 */ cpu->r[4] = cpu->r[26];
         /* 021EB8B4 */ Gambit_fn_021EB264(cpu);
         /* 021EB8B8 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 021EB8B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021EB8BC */ _t262 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB8B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021EB8BC */ _t262 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB8BC */ _t263 = _t262 & 0x00000001u;
         /* 021EB8BC */ if (_t263) goto L_021EB8C0; else goto L_021EB858;
   L_021EB8C0: ; // 0x21eb8c0
-        /* 021EB8C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021EB8C4 */ _t264 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB8C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021EB8C4 */ _t264 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB8C4 */ _t265 = _t264 & 0x00000001u;
         /* 021EB8C4 */ if (_t265) goto L_021EBAAC; else goto L_021EB8C8;
   L_021EB8C8: ; // 0x21eb8c8
         /* 021EB8C8 */ goto L_021EB954;
   L_021EB8CC: ; // 0x21eb8cc
-        /* 021EB8CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021EB8D0 */ _t266 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EB8CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021EB8D0 */ _t266 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EB8D0 */ _t267 = _t266 & 0x00000001u;
         /* 021EB8D0 */ if (_t267) goto L_021EB8D4; else goto L_021EB94C;
   L_021EB8D4: ; // 0x21eb8d4
@@ -17551,11 +17551,11 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB8E4 */ cpu->r[9] = rbrew_read8(cpu->mem, _t268);
         /* 021EB8E8 */ _t269 = cpu->r[21] + 0x00000010u;
         /* 021EB8E8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t269);
-        /* 021EB8EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021EB8EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021EB8F0 */ _t270 = cpu->r[21] + 0x0000000Cu;
         /* 021EB8F0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t270);
         /* 021EB8F0 */ cpu->r[21] = _t270;
-        /* 021EB8F4 */ _t271 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB8F4 */ _t271 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB8F4 */ _t272 = _t271 & 0x00000001u;
         /* 021EB8F4 */ if (_t272) goto L_021EB924; else goto L_021EB8F8;
   L_021EB8F8: ; // 0x21eb8f8
@@ -17570,8 +17570,8 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB910 */ cpu->r[4] = cpu->r[27];
         /* 021EB914 */ Gambit_fn_021EB26C(cpu);
         /* 021EB918 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 021EB918 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021EB91C */ _t275 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021EB91C */ _t275 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB91C */ _t276 = _t275 & 0x00000001u;
         /* 021EB91C */ if (_t276) goto L_021EB920; else goto L_021EB8E4;
   L_021EB920: ; // 0x21eb920
@@ -17588,13 +17588,13 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB93C */ cpu->r[4] = cpu->r[27];
         /* 021EB940 */ Gambit_fn_021EB26C(cpu);
         /* 021EB944 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 021EB944 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021EB948 */ _t279 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB944 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021EB948 */ _t279 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB948 */ _t280 = _t279 & 0x00000001u;
         /* 021EB948 */ if (_t280) goto L_021EB94C; else goto L_021EB8E4;
   L_021EB94C: ; // 0x21eb94c
-        /* 021EB94C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021EB950 */ _t281 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB94C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021EB950 */ _t281 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB950 */ _t282 = _t281 & 0x00000001u;
         /* 021EB950 */ if (_t282) goto L_021EBAAC; else goto L_021EB954;
   L_021EB954: ; // 0x21eb954
@@ -17611,10 +17611,10 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB968 */ rbrew_write_f32(cpu->mem, _t287, cpu->f[30]);
         /* 021EB96C */ _t288 = cpu->r[24] + cpu->r[11];
         /* 021EB96C */ cpu->r[4] = rbrew_read8(cpu->mem, _t288);
-        /* 021EB970 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 021EB970 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 021EB974 */ _t289 = cpu->r[29] + 0x00000051u;
         /* 021EB974 */ cpu->r[5] = rbrew_read8(cpu->mem, _t289);
-        /* 021EB978 */ _t290 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB978 */ _t290 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB978 */ _t291 = _t290 & 0x00000001u;
         /* 021EB978 */ if (_t291) goto L_021EBAAC; else goto L_021EB97C;
   L_021EB97C: ; // 0x21eb97c
@@ -17622,8 +17622,8 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EB980 */ cpu->r[6] = cpu->r[29] + 0x00000084u;
         /* 021EB984 */ cpu->r[3] = cpu->r[25];
         /* 021EB988 */ Gambit_fn_021F000C(cpu);
-        /* 021EB98C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021EB990 */ _t292 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EB98C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021EB990 */ _t292 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EB990 */ _t293 = _t292 & 0x00000001u;
         /* 021EB990 */ if (_t293) goto L_021EBAAC; else goto L_021EB994;
   L_021EB994: ; // 0x21eb994
@@ -17680,13 +17680,13 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EBA08 */ _t315 = cpu->r[26] + 0x00000680u;
         /* 021EBA08 */ cpu->f[2] = rbrew_read_f32(cpu->mem, _t315);
         /* 021EBA0C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000000u, 0x00000002u);
-        /* 021EBA0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021EBA0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021EBA10 */ _t316 = cpu->r[29] + 0x00000054u;
         /* 021EBA10 */ cpu->r[5] = rbrew_read32(cpu->mem, _t316);
         /* 021EBA14 */ cpu->r[4] = cpu->r[4] + 0x00000480u;
         /* 021EBA18 */ _t317 = cpu->r[26] + 0x000006E0u;
         /* 021EBA18 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t317);
-        /* 021EBA1C */ _t318 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBA1C */ _t318 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBA1C */ _t319 = _t318 & 0x00000001u;
         /* 021EBA1C */ if (_t319) goto L_021EBA68; else goto L_021EBA20;
   L_021EBA20: ; // 0x21eba20
@@ -17748,22 +17748,22 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EBAAC */ _t338 = cpu->r[29] + 0x000000DCu;
         /* 021EBAAC */ cpu->r[0] = rbrew_read32(cpu->mem, _t338);
         /* 021EBAB0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000000u, 0x00000002u);
-        /* 021EBAB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021EBAB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021EBAB4 */ cpu->f[28] = cpu->f[30];
-        /* 021EBAB8 */ _t339 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBAB8 */ _t339 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBAB8 */ _t340 = _t339 & 0x00000001u;
         /* 021EBAB8 */ if (_t340) goto L_021EBABC; else goto L_021EBE20;
   L_021EBABC: ; // 0x21ebabc
-        /* 021EBABC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021EBABC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021EBAC0 */ cpu->f[0] = cpu->f[29];
-        /* 021EBAC4 */ _t341 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBAC4 */ _t341 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBAC4 */ _t342 = _t341 & 0x00000001u;
         /* 021EBAC4 */ if (_t342) goto L_021EBAD8; else goto L_021EBAC8;
   L_021EBAC8: ; // 0x21ebac8
         /* 021EBAC8 */ _t343 = cpu->r[26] + 0x00000208u;
         /* 021EBAC8 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t343);
-        /* 021EBACC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[29]);
-        /* 021EBAD0 */ _t344 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EBACC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[29]));
+        /* 021EBAD0 */ _t344 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EBAD0 */ _t345 = _t344 & 0x00000001u;
         /* 021EBAD0 */ if (_t345) goto L_021EBAD4; else goto L_021EBAEC;
   L_021EBAD4: ; // 0x21ebad4
@@ -17771,8 +17771,8 @@ void Gambit_fn_021EB274(CPUState* cpu) {
   L_021EBAD8: ; // 0x21ebad8
         /* 021EBAD8 */ _t346 = cpu->r[27] + 0x00001708u;
         /* 021EBAD8 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t346);
-        /* 021EBADC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[29]);
-        /* 021EBAE0 */ _t347 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EBADC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[29]));
+        /* 021EBAE0 */ _t347 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EBAE0 */ _t348 = _t347 & 0x00000001u;
         /* 021EBAE0 */ if (_t348) goto L_021EBAE4; else goto L_021EBAEC;
   L_021EBAE4: ; // 0x21ebae4
@@ -17780,15 +17780,15 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EBAE8 */ _t349 = cpu->r[10] + 0x0000678Cu;
         /* 021EBAE8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t349);
   L_021EBAEC: ; // 0x21ebaec
-        /* 021EBAEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 021EBAF0 */ _t350 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBAEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 021EBAF0 */ _t350 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBAF0 */ _t351 = _t350 & 0x00000001u;
         /* 021EBAF0 */ if (_t351) goto L_021EBB04; else goto L_021EBAF4;
   L_021EBAF4: ; // 0x21ebaf4
         /* 021EBAF4 */ _t352 = cpu->r[26] + 0x00000208u;
         /* 021EBAF4 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t352);
-        /* 021EBAF8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
-        /* 021EBAFC */ _t353 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBAF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
+        /* 021EBAFC */ _t353 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBAFC */ _t354 = _t353 & 0x00000001u;
         /* 021EBAFC */ if (_t354) goto L_021EBB00; else goto L_021EBB70;
   L_021EBB00: ; // 0x21ebb00
@@ -17796,13 +17796,13 @@ void Gambit_fn_021EB274(CPUState* cpu) {
   L_021EBB04: ; // 0x21ebb04
         /* 021EBB04 */ _t355 = cpu->r[27] + 0x00001708u;
         /* 021EBB04 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t355);
-        /* 021EBB08 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
-        /* 021EBB0C */ _t356 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBB08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
+        /* 021EBB0C */ _t356 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBB0C */ _t357 = _t356 & 0x00000001u;
         /* 021EBB0C */ if (_t357) goto L_021EBB10; else goto L_021EBB70;
   L_021EBB10: ; // 0x21ebb10
-        /* 021EBB10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 021EBB14 */ _t358 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBB10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 021EBB14 */ _t358 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBB14 */ _t359 = _t358 & 0x00000001u;
         /* 021EBB14 */ if (_t359) goto L_021EBB44; else goto L_021EBB18;
   L_021EBB18: ; // 0x21ebb18
@@ -17819,9 +17819,9 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EBB30 */ _t364 = cpu->r[29] + 0x000000DCu;
         /* 021EBB30 */ cpu->r[10] = rbrew_read32(cpu->mem, _t364);
         /* 021EBB34 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000002u, 0x00000002u);
-        /* 021EBB34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021EBB34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021EBB38 */ cpu->r[5] = 0x00000000u;
-        /* 021EBB3C */ _t365 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBB3C */ _t365 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBB3C */ _t366 = _t365 & 0x00000001u;
         /* 021EBB3C */ if (_t366) goto L_021EBE58; else goto L_021EBB40;
   L_021EBB40: ; // 0x21ebb40
@@ -17840,23 +17840,23 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EBB5C */ _t371 = cpu->r[29] + 0x000000DCu;
         /* 021EBB5C */ cpu->r[10] = rbrew_read32(cpu->mem, _t371);
         /* 021EBB60 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000002u, 0x00000002u);
-        /* 021EBB60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021EBB60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021EBB64 */ cpu->r[5] = 0x00000000u;
-        /* 021EBB68 */ _t372 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBB68 */ _t372 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBB68 */ _t373 = _t372 & 0x00000001u;
         /* 021EBB68 */ if (_t373) goto L_021EBE58; else goto L_021EBB6C;
   L_021EBB6C: ; // 0x21ebb6c
         /* 021EBB6C */ goto L_021EBE44;
   L_021EBB70: ; // 0x21ebb70
-        /* 021EBB70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 021EBB74 */ _t374 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBB70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 021EBB74 */ _t374 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBB74 */ _t375 = _t374 & 0x00000001u;
         /* 021EBB74 */ if (_t375) goto L_021EBB88; else goto L_021EBB78;
   L_021EBB78: ; // 0x21ebb78
         /* 021EBB78 */ _t376 = cpu->r[26] + 0x000002C8u;
         /* 021EBB78 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t376);
-        /* 021EBB7C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
-        /* 021EBB80 */ _t377 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBB7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
+        /* 021EBB80 */ _t377 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBB80 */ _t378 = _t377 & 0x00000001u;
         /* 021EBB80 */ if (_t378) goto L_021EBB84; else goto L_021EBBF4;
   L_021EBB84: ; // 0x21ebb84
@@ -17864,13 +17864,13 @@ void Gambit_fn_021EB274(CPUState* cpu) {
   L_021EBB88: ; // 0x21ebb88
         /* 021EBB88 */ _t379 = cpu->r[27] + 0x000017C8u;
         /* 021EBB88 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t379);
-        /* 021EBB8C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
-        /* 021EBB90 */ _t380 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBB8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
+        /* 021EBB90 */ _t380 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBB90 */ _t381 = _t380 & 0x00000001u;
         /* 021EBB90 */ if (_t381) goto L_021EBB94; else goto L_021EBBF4;
   L_021EBB94: ; // 0x21ebb94
-        /* 021EBB94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 021EBB98 */ _t382 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBB94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 021EBB98 */ _t382 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBB98 */ _t383 = _t382 & 0x00000001u;
         /* 021EBB98 */ if (_t383) goto L_021EBBC8; else goto L_021EBB9C;
   L_021EBB9C: ; // 0x21ebb9c
@@ -17887,9 +17887,9 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EBBB4 */ _t388 = cpu->r[29] + 0x000000DCu;
         /* 021EBBB4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t388);
         /* 021EBBB8 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000002u, 0x00000002u);
-        /* 021EBBB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021EBBB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021EBBBC */ cpu->r[5] = 0x00000000u;
-        /* 021EBBC0 */ _t389 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBBC0 */ _t389 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBBC0 */ _t390 = _t389 & 0x00000001u;
         /* 021EBBC0 */ if (_t390) goto L_021EBE58; else goto L_021EBBC4;
   L_021EBBC4: ; // 0x21ebbc4
@@ -17908,23 +17908,23 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EBBE0 */ _t395 = cpu->r[29] + 0x000000DCu;
         /* 021EBBE0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t395);
         /* 021EBBE4 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000002u, 0x00000002u);
-        /* 021EBBE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021EBBE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021EBBE8 */ cpu->r[5] = 0x00000000u;
-        /* 021EBBEC */ _t396 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBBEC */ _t396 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBBEC */ _t397 = _t396 & 0x00000001u;
         /* 021EBBEC */ if (_t397) goto L_021EBE58; else goto L_021EBBF0;
   L_021EBBF0: ; // 0x21ebbf0
         /* 021EBBF0 */ goto L_021EBE44;
   L_021EBBF4: ; // 0x21ebbf4
-        /* 021EBBF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 021EBBF8 */ _t398 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBBF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 021EBBF8 */ _t398 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBBF8 */ _t399 = _t398 & 0x00000001u;
         /* 021EBBF8 */ if (_t399) goto L_021EBC0C; else goto L_021EBBFC;
   L_021EBBFC: ; // 0x21ebbfc
         /* 021EBBFC */ _t400 = cpu->r[26] + 0x00000388u;
         /* 021EBBFC */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t400);
-        /* 021EBC00 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
-        /* 021EBC04 */ _t401 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EBC00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
+        /* 021EBC04 */ _t401 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EBC04 */ _t402 = _t401 & 0x00000001u;
         /* 021EBC04 */ if (_t402) goto L_021EBC78; else goto L_021EBC08;
   L_021EBC08: ; // 0x21ebc08
@@ -17932,13 +17932,13 @@ void Gambit_fn_021EB274(CPUState* cpu) {
   L_021EBC0C: ; // 0x21ebc0c
         /* 021EBC0C */ _t403 = cpu->r[27] + 0x00001888u;
         /* 021EBC0C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t403);
-        /* 021EBC10 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
-        /* 021EBC14 */ _t404 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EBC10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
+        /* 021EBC14 */ _t404 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EBC14 */ _t405 = _t404 & 0x00000001u;
         /* 021EBC14 */ if (_t405) goto L_021EBC78; else goto L_021EBC18;
   L_021EBC18: ; // 0x21ebc18
-        /* 021EBC18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 021EBC1C */ _t406 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBC18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 021EBC1C */ _t406 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBC1C */ _t407 = _t406 & 0x00000001u;
         /* 021EBC1C */ if (_t407) goto L_021EBC4C; else goto L_021EBC20;
   L_021EBC20: ; // 0x21ebc20
@@ -17955,9 +17955,9 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EBC38 */ _t412 = cpu->r[29] + 0x000000DCu;
         /* 021EBC38 */ cpu->r[10] = rbrew_read32(cpu->mem, _t412);
         /* 021EBC3C */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000002u, 0x00000002u);
-        /* 021EBC3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021EBC3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021EBC40 */ cpu->r[5] = 0x00000000u;
-        /* 021EBC44 */ _t413 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBC44 */ _t413 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBC44 */ _t414 = _t413 & 0x00000001u;
         /* 021EBC44 */ if (_t414) goto L_021EBE58; else goto L_021EBC48;
   L_021EBC48: ; // 0x21ebc48
@@ -17976,23 +17976,23 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EBC64 */ _t419 = cpu->r[29] + 0x000000DCu;
         /* 021EBC64 */ cpu->r[10] = rbrew_read32(cpu->mem, _t419);
         /* 021EBC68 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000002u, 0x00000002u);
-        /* 021EBC68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021EBC68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021EBC6C */ cpu->r[5] = 0x00000000u;
-        /* 021EBC70 */ _t420 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBC70 */ _t420 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBC70 */ _t421 = _t420 & 0x00000001u;
         /* 021EBC70 */ if (_t421) goto L_021EBE58; else goto L_021EBC74;
   L_021EBC74: ; // 0x21ebc74
         /* 021EBC74 */ goto L_021EBE44;
   L_021EBC78: ; // 0x21ebc78
-        /* 021EBC78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 021EBC7C */ _t422 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBC78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 021EBC7C */ _t422 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBC7C */ _t423 = _t422 & 0x00000001u;
         /* 021EBC7C */ if (_t423) goto L_021EBC90; else goto L_021EBC80;
   L_021EBC80: ; // 0x21ebc80
         /* 021EBC80 */ _t424 = cpu->r[26] + 0x000002C8u;
         /* 021EBC80 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t424);
-        /* 021EBC84 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[0]);
-        /* 021EBC88 */ _t425 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EBC84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[0]));
+        /* 021EBC88 */ _t425 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EBC88 */ _t426 = _t425 & 0x00000001u;
         /* 021EBC88 */ if (_t426) goto L_021EBC8C; else goto L_021EBD60;
   L_021EBC8C: ; // 0x21ebc8c
@@ -18000,13 +18000,13 @@ void Gambit_fn_021EB274(CPUState* cpu) {
   L_021EBC90: ; // 0x21ebc90
         /* 021EBC90 */ _t427 = cpu->r[27] + 0x000017C8u;
         /* 021EBC90 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t427);
-        /* 021EBC94 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[0]);
-        /* 021EBC98 */ _t428 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EBC94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[0]));
+        /* 021EBC98 */ _t428 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EBC98 */ _t429 = _t428 & 0x00000001u;
         /* 021EBC98 */ if (_t429) goto L_021EBC9C; else goto L_021EBD60;
   L_021EBC9C: ; // 0x21ebc9c
-        /* 021EBC9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 021EBCA0 */ _t430 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBC9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 021EBCA0 */ _t430 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBCA0 */ _t431 = _t430 & 0x00000001u;
         /* 021EBCA0 */ if (_t431) goto L_021EBCBC; else goto L_021EBCA4;
   L_021EBCA4: ; // 0x21ebca4
@@ -18015,8 +18015,8 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EBCA8 */ _t433 = cpu->r[26] + 0x000002C8u;
         /* 021EBCA8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t433);
         /* 021EBCAC */ cpu->f[11] = cpu->f[13] - cpu->f[11];
-        /* 021EBCB0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[30]);
-        /* 021EBCB4 */ _t434 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EBCB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[30]));
+        /* 021EBCB4 */ _t434 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EBCB4 */ _t435 = _t434 & 0x00000001u;
         /* 021EBCB4 */ if (_t435) goto L_021EBCB8; else goto L_021EBE20;
   L_021EBCB8: ; // 0x21ebcb8
@@ -18027,13 +18027,13 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EBCC0 */ _t437 = cpu->r[27] + 0x000017C8u;
         /* 021EBCC0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t437);
         /* 021EBCC4 */ cpu->f[11] = cpu->f[13] - cpu->f[11];
-        /* 021EBCC8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[30]);
-        /* 021EBCCC */ _t438 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EBCC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[30]));
+        /* 021EBCCC */ _t438 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EBCCC */ _t439 = _t438 & 0x00000001u;
         /* 021EBCCC */ if (_t439) goto L_021EBCD0; else goto L_021EBE20;
   L_021EBCD0: ; // 0x21ebcd0
-        /* 021EBCD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 021EBCD4 */ _t440 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBCD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 021EBCD4 */ _t440 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBCD4 */ _t441 = _t440 & 0x00000001u;
         /* 021EBCD4 */ if (_t441) goto L_021EBD1C; else goto L_021EBCD8;
   L_021EBCD8: ; // 0x21ebcd8
@@ -18058,9 +18058,9 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EBD08 */ _t448 = cpu->r[29] + 0x000000DCu;
         /* 021EBD08 */ cpu->r[10] = rbrew_read32(cpu->mem, _t448);
         /* 021EBD0C */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000002u, 0x00000002u);
-        /* 021EBD0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021EBD0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021EBD10 */ cpu->r[5] = 0x00000000u;
-        /* 021EBD14 */ _t449 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBD14 */ _t449 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBD14 */ _t450 = _t449 & 0x00000001u;
         /* 021EBD14 */ if (_t450) goto L_021EBE58; else goto L_021EBD18;
   L_021EBD18: ; // 0x21ebd18
@@ -18087,23 +18087,23 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EBD4C */ _t457 = cpu->r[29] + 0x000000DCu;
         /* 021EBD4C */ cpu->r[10] = rbrew_read32(cpu->mem, _t457);
         /* 021EBD50 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000002u, 0x00000002u);
-        /* 021EBD50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021EBD50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021EBD54 */ cpu->r[5] = 0x00000000u;
-        /* 021EBD58 */ _t458 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBD58 */ _t458 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBD58 */ _t459 = _t458 & 0x00000001u;
         /* 021EBD58 */ if (_t459) goto L_021EBE58; else goto L_021EBD5C;
   L_021EBD5C: ; // 0x21ebd5c
         /* 021EBD5C */ goto L_021EBE44;
   L_021EBD60: ; // 0x21ebd60
-        /* 021EBD60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 021EBD64 */ _t460 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBD60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 021EBD64 */ _t460 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBD64 */ _t461 = _t460 & 0x00000001u;
         /* 021EBD64 */ if (_t461) goto L_021EBD78; else goto L_021EBD68;
   L_021EBD68: ; // 0x21ebd68
         /* 021EBD68 */ _t462 = cpu->r[26] + 0x00000208u;
         /* 021EBD68 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t462);
-        /* 021EBD6C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
-        /* 021EBD70 */ _t463 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EBD6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
+        /* 021EBD70 */ _t463 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EBD70 */ _t464 = _t463 & 0x00000001u;
         /* 021EBD70 */ if (_t464) goto L_021EBD74; else goto L_021EBE20;
   L_021EBD74: ; // 0x21ebd74
@@ -18111,13 +18111,13 @@ void Gambit_fn_021EB274(CPUState* cpu) {
   L_021EBD78: ; // 0x21ebd78
         /* 021EBD78 */ _t465 = cpu->r[27] + 0x00001708u;
         /* 021EBD78 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t465);
-        /* 021EBD7C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
-        /* 021EBD80 */ _t466 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EBD7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
+        /* 021EBD80 */ _t466 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EBD80 */ _t467 = _t466 & 0x00000001u;
         /* 021EBD80 */ if (_t467) goto L_021EBD84; else goto L_021EBE20;
   L_021EBD84: ; // 0x21ebd84
-        /* 021EBD84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 021EBD88 */ _t468 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBD84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 021EBD88 */ _t468 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBD88 */ _t469 = _t468 & 0x00000001u;
         /* 021EBD88 */ if (_t469) goto L_021EBDA4; else goto L_021EBD8C;
   L_021EBD8C: ; // 0x21ebd8c
@@ -18126,8 +18126,8 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EBD90 */ _t471 = cpu->r[26] + 0x00000208u;
         /* 021EBD90 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t471);
         /* 021EBD94 */ cpu->f[12] = cpu->f[12] - cpu->f[13];
-        /* 021EBD98 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[30]);
-        /* 021EBD9C */ _t472 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EBD98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[30]));
+        /* 021EBD9C */ _t472 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EBD9C */ _t473 = _t472 & 0x00000001u;
         /* 021EBD9C */ if (_t473) goto L_021EBDA0; else goto L_021EBE20;
   L_021EBDA0: ; // 0x21ebda0
@@ -18138,13 +18138,13 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EBDA8 */ _t475 = cpu->r[27] + 0x00001708u;
         /* 021EBDA8 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t475);
         /* 021EBDAC */ cpu->f[12] = cpu->f[12] - cpu->f[13];
-        /* 021EBDB0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[30]);
-        /* 021EBDB4 */ _t476 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EBDB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[30]));
+        /* 021EBDB4 */ _t476 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EBDB4 */ _t477 = _t476 & 0x00000001u;
         /* 021EBDB4 */ if (_t477) goto L_021EBDB8; else goto L_021EBE20;
   L_021EBDB8: ; // 0x21ebdb8
-        /* 021EBDB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 021EBDBC */ _t478 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBDB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 021EBDBC */ _t478 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBDBC */ _t479 = _t478 & 0x00000001u;
         /* 021EBDBC */ if (_t479) goto L_021EBE04; else goto L_021EBDC0;
   L_021EBDC0: ; // 0x21ebdc0
@@ -18169,9 +18169,9 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EBDF0 */ _t486 = cpu->r[29] + 0x000000DCu;
         /* 021EBDF0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t486);
         /* 021EBDF4 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000002u, 0x00000002u);
-        /* 021EBDF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021EBDF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021EBDF8 */ cpu->r[5] = 0x00000000u;
-        /* 021EBDFC */ _t487 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBDFC */ _t487 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBDFC */ _t488 = _t487 & 0x00000001u;
         /* 021EBDFC */ if (_t488) goto L_021EBE58; else goto L_021EBE00;
   L_021EBE00: ; // 0x21ebe00
@@ -18199,9 +18199,9 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EBE34 */ _t495 = cpu->r[29] + 0x000000DCu;
         /* 021EBE34 */ cpu->r[10] = rbrew_read32(cpu->mem, _t495);
         /* 021EBE38 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000002u, 0x00000002u);
-        /* 021EBE38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021EBE38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021EBE3C */ cpu->r[5] = 0x00000000u;
-        /* 021EBE40 */ _t496 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBE40 */ _t496 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBE40 */ _t497 = _t496 & 0x00000001u;
         /* 021EBE40 */ if (_t497) goto L_021EBE58; else goto L_021EBE44;
   L_021EBE44: ; // 0x21ebe44
@@ -18217,8 +18217,8 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EBE58 */ _t501 = cpu->r[29] + 0x000000DCu;
         /* 021EBE58 */ cpu->r[11] = rbrew_read32(cpu->mem, _t501);
         /* 021EBE5C */ cpu->r[11] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000001u, 0x00000001u);
-        /* 021EBE5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021EBE60 */ _t502 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBE5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021EBE60 */ _t502 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBE60 */ _t503 = _t502 & 0x00000001u;
         /* 021EBE60 */ if (_t503) goto L_021EBE78; else goto L_021EBE64;
   L_021EBE64: ; // 0x21ebe64
@@ -18234,8 +18234,8 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EBE78 */ _t507 = cpu->r[29] + 0x000000DCu;
         /* 021EBE78 */ cpu->r[12] = rbrew_read32(cpu->mem, _t507);
         /* 021EBE7C */ cpu->r[12] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000000u, 0x00000000u);
-        /* 021EBE7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021EBE80 */ _t508 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBE7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021EBE80 */ _t508 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBE80 */ _t509 = _t508 & 0x00000001u;
         /* 021EBE80 */ if (_t509) goto L_021EBE94; else goto L_021EBE84;
   L_021EBE84: ; // 0x21ebe84
@@ -18261,18 +18261,18 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EBEB0 */ cpu->ctr = cpu->r[6];
         /* 021EBEB4 */ cpu->r[4] = cpu->r[30] + 0x00006844u;
         /* 021EBEB8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021EBEBC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[30]);
+        /* 021EBEBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[30]));
         /* 021EBEC0 */ cpu->r[31] = 0x10030000u;
         /* 021EBEC4 */ cpu->r[12] = 0x10030000u;
         /* 021EBEC8 */ cpu->r[31] = cpu->r[31] + 0x000067ECu;
         /* 021EBECC */ _t517 = cpu->r[12] + 0x00006840u;
         /* 021EBECC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t517);
-        /* 021EBED0 */ _t518 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EBED0 */ _t518 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EBED0 */ _t519 = _t518 & 0x00000001u;
         /* 021EBED0 */ if (_t519) goto L_021EBEE0; else goto L_021EBED4;
   L_021EBED4: ; // 0x21ebed4
-        /* 021EBED4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 021EBED8 */ _t520 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBED4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 021EBED8 */ _t520 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBED8 */ _t521 = _t520 & 0x00000001u;
         /* 021EBED8 */ if (_t521) goto L_021EBFA4; else goto L_021EBEDC;
   L_021EBEDC: ; // 0x21ebedc
@@ -18323,8 +18323,8 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EBF48 */ Gambit_fn_027B72F0(cpu);
         /* 021EBF4C */ _t538 = cpu->r[1] + 0x0000009Cu;
         /* 021EBF4C */ cpu->r[30] = rbrew_read32(cpu->mem, _t538);
-        /* 021EBF50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021EBF54 */ _t539 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBF50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021EBF54 */ _t539 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBF54 */ _t540 = _t539 & 0x00000001u;
         /* 021EBF54 */ if (_t540) goto L_021EBF8C; else goto L_021EBF58;
   L_021EBF58: ; // 0x21ebf58
@@ -18332,8 +18332,8 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EBF58 */ cpu->r[12] = rbrew_read32(cpu->mem, _t541);
         /* 021EBF5C */ _t542 = cpu->r[1] + 0x000000A0u;
         /* 021EBF5C */ cpu->r[0] = rbrew_read32(cpu->mem, _t542);
-        /* 021EBF60 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
-        /* 021EBF64 */ _t543 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBF60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
+        /* 021EBF64 */ _t543 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBF64 */ _t544 = _t543 & 0x00000001u;
         /* 021EBF64 */ if (_t544) goto L_021EBF68; else goto L_021EBF8C;
   L_021EBF68: ; // 0x21ebf68
@@ -18352,32 +18352,32 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EBF88 */ _t549 = cpu->r[30] + 0x00000078u;
         /* 021EBF88 */ rbrew_write_f32(cpu->mem, _t549, cpu->f[29]);
   L_021EBF8C: ; // 0x21ebf8c
-        /* 021EBF8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 021EBF90 */ _t550 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBF8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 021EBF90 */ _t550 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBF90 */ _t551 = _t550 & 0x00000001u;
         /* 021EBF90 */ if (_t551) goto L_021EBFA4; else goto L_021EBF94;
   L_021EBF94: ; // 0x21ebf94
-        /* 021EBF94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021EBF94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021EBF98 */ _t552 = cpu->r[26] + 0x000003E8u;
         /* 021EBF98 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t552);
-        /* 021EBF9C */ _t553 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBF9C */ _t553 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBF9C */ _t554 = _t553 & 0x00000001u;
         /* 021EBF9C */ if (_t554) goto L_021EBFC4; else goto L_021EBFA0;
   L_021EBFA0: ; // 0x21ebfa0
         /* 021EBFA0 */ goto L_021EBFB0;
   L_021EBFA4: ; // 0x21ebfa4
-        /* 021EBFA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021EBFA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021EBFA8 */ _t555 = cpu->r[27] + 0x000018E8u;
         /* 021EBFA8 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t555);
-        /* 021EBFAC */ _t556 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBFAC */ _t556 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBFAC */ _t557 = _t556 & 0x00000001u;
         /* 021EBFAC */ if (_t557) goto L_021EBFC4; else goto L_021EBFB0;
   L_021EBFB0: ; // 0x21ebfb0
         /* 021EBFB0 */ _t558 = cpu->r[29] + 0x000000DCu;
         /* 021EBFB0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t558);
         /* 021EBFB4 */ cpu->r[8] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x00000000u, 0x00000002u);
-        /* 021EBFB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021EBFB8 */ _t559 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EBFB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021EBFB8 */ _t559 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EBFB8 */ _t560 = _t559 & 0x00000001u;
         /* 021EBFB8 */ if (_t560) goto L_021EBFC4; else goto L_021EBFBC;
   L_021EBFBC: ; // 0x21ebfbc
@@ -18431,8 +18431,8 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EC030 */ Gambit_fn_027B72F0(cpu);
         /* 021EC034 */ _t578 = cpu->r[1] + 0x00000084u;
         /* 021EC034 */ cpu->r[31] = rbrew_read32(cpu->mem, _t578);
-        /* 021EC038 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021EC03C */ _t579 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC038 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021EC03C */ _t579 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC03C */ _t580 = _t579 & 0x00000001u;
         /* 021EC03C */ if (_t580) goto L_021EC074; else goto L_021EC040;
   L_021EC040: ; // 0x21ec040
@@ -18440,8 +18440,8 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EC040 */ cpu->r[4] = rbrew_read32(cpu->mem, _t581);
         /* 021EC044 */ _t582 = cpu->r[1] + 0x00000088u;
         /* 021EC044 */ cpu->r[5] = rbrew_read32(cpu->mem, _t582);
-        /* 021EC048 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[5]);
-        /* 021EC04C */ _t583 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC048 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[5]));
+        /* 021EC04C */ _t583 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC04C */ _t584 = _t583 & 0x00000001u;
         /* 021EC04C */ if (_t584) goto L_021EC050; else goto L_021EC074;
   L_021EC050: ; // 0x21ec050
@@ -18481,7 +18481,7 @@ void Gambit_fn_021EB274(CPUState* cpu) {
         /* 021EC0A0 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t596);
         /* 021EC0A4 */ _t597 = cpu->r[1] + 0x000003F0u;
         /* 021EC0A4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t597);
-        /* 021EC0A8 */ _t598 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EC0A8 */ _t598 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EC0A8 */ _t599 = _t598 & 0x00000001u;
         /* 021EC0A8 */ if (_t599) goto L_021EC0AC; // else: addr-0 trap, fall-through
   L_021EC0AC: ; // 0x21ec0ac
@@ -18778,20 +18778,20 @@ void Gambit_fn_021EC100(CPUState* cpu) {
         /* 021EC2F8 */ cpu->r[10] = 0x10030000u;
         /* 021EC2FC */ _t97 = cpu->r[31] + 0x000000B0u;
         /* 021EC2FC */ rbrew_write32(cpu->mem, _t97, cpu->r[30]);
-        /* 021EC300 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u);
+        /* 021EC300 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u));
         /* 021EC304 */ _t98 = cpu->r[10] + 0x00006864u;
         /* 021EC304 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t98);
         /* 021EC308 */ cpu->r[3] = cpu->r[31] + 0x000000C0u;
         /* 021EC30C */ _t99 = cpu->r[31] + 0x000000ACu;
         /* 021EC30C */ rbrew_write32(cpu->mem, _t99, cpu->r[12]);
-        /* 021EC310 */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC310 */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC310 */ _t101 = _t100 & 0x00000001u;
         /* 021EC310 */ if (_t101) goto L_021EC314; else goto L_021EC324;
   L_021EC314: ; // 0x21ec314
         /* 021EC314 */ cpu->r[3] = 0x00000010u;
         /* 021EC318 */ Gambit_fn_02801A78(cpu);
-        /* 021EC31C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021EC320 */ _t102 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC31C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021EC320 */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC320 */ _t103 = _t102 & 0x00000001u;
         /* 021EC320 */ if (_t103) goto L_021EC33C; else goto L_021EC324;
   L_021EC324: ; // 0x21ec324
@@ -18807,16 +18807,16 @@ void Gambit_fn_021EC100(CPUState* cpu) {
         /* 021EC338 */ _t108 = cpu->r[3] + 0x0000000Cu;
         /* 021EC338 */ rbrew_write_f32(cpu->mem, _t108, cpu->f[0]);
   L_021EC33C: ; // 0x21ec33c
-        /* 021EC33C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u);
+        /* 021EC33C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u));
         /* 021EC340 */ cpu->r[3] = cpu->r[31] + 0x000000D0u;
-        /* 021EC344 */ _t109 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC344 */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC344 */ _t110 = _t109 & 0x00000001u;
         /* 021EC344 */ if (_t110) goto L_021EC348; else goto L_021EC358;
   L_021EC348: ; // 0x21ec348
         /* 021EC348 */ cpu->r[3] = 0x00000010u;
         /* 021EC34C */ Gambit_fn_02801A78(cpu);
-        /* 021EC350 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021EC354 */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC350 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021EC354 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC354 */ _t112 = _t111 & 0x00000001u;
         /* 021EC354 */ if (_t112) goto L_021EC370; else goto L_021EC358;
   L_021EC358: ; // 0x21ec358
@@ -18882,7 +18882,7 @@ void Gambit_fn_021EC100(CPUState* cpu) {
         /* 021EC3D8 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t137);
         /* 021EC3DC */ _t138 = cpu->r[1] + 0x00000040u;
         /* 021EC3DC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t138);
-        /* 021EC3E0 */ _t139 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EC3E0 */ _t139 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EC3E0 */ _t140 = _t139 & 0x00000001u;
         /* 021EC3E0 */ if (_t140) goto L_021EC3E4; // else: addr-0 trap, fall-through
   L_021EC3E4: ; // 0x21ec3e4
@@ -18949,8 +18949,8 @@ void Gambit_fn_021EC414(CPUState* cpu) {
         /* 021EC414 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021EC414 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021EC418 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021EC418 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021EC41C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021EC41C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC41C */ _t2 = _t1 & 0x00000001u;
         /* 021EC41C */ _t3 = _t2 ^ 0x00000001u;
         /* 021EC41C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -18972,8 +18972,8 @@ void Gambit_fn_021EC430(CPUState* cpu) {
         /* 021EC430 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021EC430 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021EC434 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021EC434 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021EC438 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC434 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021EC438 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC438 */ _t2 = _t1 & 0x00000001u;
         /* 021EC438 */ _t3 = _t2 ^ 0x00000001u;
         /* 021EC438 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -18995,8 +18995,8 @@ void Gambit_fn_021EC44C(CPUState* cpu) {
         /* 021EC44C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021EC44C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021EC450 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021EC450 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021EC454 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC450 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021EC454 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC454 */ _t2 = _t1 & 0x00000001u;
         /* 021EC454 */ _t3 = _t2 ^ 0x00000001u;
         /* 021EC454 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -19039,8 +19039,8 @@ void Gambit_fn_021EC478(CPUState* cpu) {
         /* 021EC488 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021EC48C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021EC48C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021EC490 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021EC494 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC490 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021EC494 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC494 */ _t5 = _t4 & 0x00000001u;
         /* 021EC494 */ if (_t5) goto L_021EC498; else goto L_021EC4B4;
   L_021EC498: ; // 0x21ec498
@@ -19079,8 +19079,8 @@ void Gambit_fn_021EC47C(CPUState* cpu) {
         /* 021EC488 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021EC48C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021EC48C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021EC490 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021EC494 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC490 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021EC494 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC494 */ _t5 = _t4 & 0x00000001u;
         /* 021EC494 */ if (_t5) goto L_021EC498; else goto L_021EC4B4;
   L_021EC498: ; // 0x21ec498
@@ -261,9 +261,9 @@ void Gambit_fn_021EC5D4(CPUState* cpu) {
         /* 021EC5D8 */ _t0 = cpu->r[9] + 0xFFFFE628u;
         /* 021EC5D8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t0);
         /* 021EC5DC */ cpu->r[11] = 0x101D0000u;
-        /* 021EC5E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021EC5E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021EC5E4 */ cpu->r[11] = cpu->r[11] + 0xFFFFFCCCu;
-        /* 021EC5E8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC5E8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC5E8 */ _t2 = _t1 & 0x00000001u;
         /* 021EC5E8 */ if (_t2) goto L_021EC5EC; else goto L_021EC604;
   L_021EC5EC: ; // 0x21ec5ec
@@ -276,8 +276,8 @@ void Gambit_fn_021EC5D4(CPUState* cpu) {
         /* 021EC600 */ _t4 = cpu->r[11] + 0x00000000u;
         /* 021EC600 */ rbrew_write32(cpu->mem, _t4, cpu->r[9]);
   L_021EC604: ; // 0x21ec604
-        /* 021EC604 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021EC608 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021EC608 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC608 */ _t6 = _t5 & 0x00000001u;
         /* 021EC608 */ if (_t6) goto L_021EC60C; else goto L_021EC614;
   L_021EC60C: ; // 0x21ec60c
@@ -287,10 +287,10 @@ void Gambit_fn_021EC5D4(CPUState* cpu) {
         /* 021EC614 */ cpu->r[12] = 0x101D0000u;
         /* 021EC618 */ _t7 = cpu->r[12] + 0xFFFFD9ECu;
         /* 021EC618 */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 021EC61C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021EC61C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021EC620 */ cpu->r[12] = 0x101D0000u;
         /* 021EC624 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021EC628 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC628 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC628 */ _t9 = _t8 & 0x00000001u;
         /* 021EC628 */ if (_t9) goto L_021EC62C; else goto L_021EC644;
   L_021EC62C: ; // 0x21ec62c
@@ -303,8 +303,8 @@ void Gambit_fn_021EC5D4(CPUState* cpu) {
         /* 021EC640 */ _t11 = cpu->r[12] + 0x00000000u;
         /* 021EC640 */ rbrew_write32(cpu->mem, _t11, cpu->r[11]);
   L_021EC644: ; // 0x21ec644
-        /* 021EC644 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021EC648 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC644 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021EC648 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC648 */ _t13 = _t12 & 0x00000001u;
         /* 021EC648 */ if (_t13) goto L_021EC64C; else goto L_021EC654;
   L_021EC64C: ; // 0x21ec64c
@@ -316,9 +316,9 @@ void Gambit_fn_021EC5D4(CPUState* cpu) {
         /* 021EC658 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 021EC658 */ cpu->r[10] = _t14;
         /* 021EC65C */ cpu->r[11] = 0x101D0000u;
-        /* 021EC660 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021EC660 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021EC664 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4ECu;
-        /* 021EC668 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC668 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC668 */ _t16 = _t15 & 0x00000001u;
         /* 021EC668 */ if (_t16) goto L_021EC66C; else goto L_021EC680;
   L_021EC66C: ; // 0x21ec66c
@@ -330,8 +330,8 @@ void Gambit_fn_021EC5D4(CPUState* cpu) {
         /* 021EC67C */ _t18 = cpu->r[11] + 0x00000000u;
         /* 021EC67C */ rbrew_write32(cpu->mem, _t18, cpu->r[9]);
   L_021EC680: ; // 0x21ec680
-        /* 021EC680 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021EC684 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC680 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021EC684 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC684 */ _t20 = _t19 & 0x00000001u;
         /* 021EC684 */ if (_t20) goto L_021EC688; else goto L_021EC690;
   L_021EC688: ; // 0x21ec688
@@ -343,9 +343,9 @@ void Gambit_fn_021EC5D4(CPUState* cpu) {
         /* 021EC694 */ cpu->r[10] = rbrew_read32(cpu->mem, _t21);
         /* 021EC694 */ cpu->r[9] = _t21;
         /* 021EC698 */ cpu->r[12] = 0x101D0000u;
-        /* 021EC69C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021EC69C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021EC6A0 */ cpu->r[12] = cpu->r[12] + 0xFFFFD4E4u;
-        /* 021EC6A4 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC6A4 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC6A4 */ _t23 = _t22 & 0x00000001u;
         /* 021EC6A4 */ if (_t23) goto L_021EC6A8; else goto L_021EC6BC;
   L_021EC6A8: ; // 0x21ec6a8
@@ -443,15 +443,15 @@ void Gambit_fn_021EC738(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021EC738: ; // 0x21ec738
-        /* 021EC738 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021EC73C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC738 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021EC73C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC73C */ _t1 = _t0 & 0x00000001u;
         /* 021EC73C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021EC73C */ goto L_021EC740;
   L_021EC740: ; // 0x21ec740
         /* 021EC740 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021EC740 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021EC744 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC740 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021EC744 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC744 */ _t3 = _t2 & 0x00000001u;
         /* 021EC744 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021EC744 */ goto L_021EC748;
@@ -470,8 +470,8 @@ void Gambit_fn_021EC738(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -485,15 +485,15 @@ void Gambit_fn_021EC738(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -521,15 +521,15 @@ void Gambit_fn_021EC74C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021EC74C: ; // 0x21ec74c
-        /* 021EC74C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021EC750 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC74C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021EC750 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC750 */ _t1 = _t0 & 0x00000001u;
         /* 021EC750 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021EC750 */ goto L_021EC754;
   L_021EC754: ; // 0x21ec754
         /* 021EC754 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021EC754 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021EC758 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC754 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021EC758 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC758 */ _t3 = _t2 & 0x00000001u;
         /* 021EC758 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021EC758 */ goto L_021EC75C;
@@ -548,8 +548,8 @@ void Gambit_fn_021EC74C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -563,15 +563,15 @@ void Gambit_fn_021EC74C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -605,18 +605,18 @@ void Gambit_fn_021EC764(CPUState* cpu) {
         /* 021EC768 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021EC768 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021EC76C */ cpu->r[31] = cpu->r[3];
-        /* 021EC76C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021EC76C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021EC770 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021EC770 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021EC774 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC774 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC774 */ _t4 = _t3 & 0x00000001u;
         /* 021EC774 */ if (_t4) goto L_021EC778; else goto L_021EC788;
   L_021EC778: ; // 0x21ec778
         /* 021EC778 */ cpu->r[3] = 0x00000174u;
         /* 021EC77C */ Gambit_fn_02801A78(cpu);
         /* 021EC780 */ cpu->r[31] = cpu->r[3];
-        /* 021EC780 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021EC784 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC780 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021EC784 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC784 */ _t6 = _t5 & 0x00000001u;
         /* 021EC784 */ if (_t6) goto L_021EC79C; else goto L_021EC788;
   L_021EC788: ; // 0x21ec788
@@ -642,8 +642,8 @@ void Gambit_fn_021EC7B4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3;
 
   L_021EC7B4: ; // 0x21ec7b4
-        /* 021EC7B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 021EC7B8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC7B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 021EC7B8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC7B8 */ _t1 = _t0 & 0x00000001u;
         /* 021EC7B8 */ if (_t1) goto L_021EC7BC; else goto L_021EC7C8;
   L_021EC7BC: ; // 0x21ec7bc
@@ -1073,8 +1073,8 @@ void Gambit_fn_021EC970(CPUState* cpu) {
         /* 021EC970 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021EC970 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021EC974 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021EC974 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021EC978 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021EC978 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC978 */ _t2 = _t1 & 0x00000001u;
         /* 021EC978 */ _t3 = _t2 ^ 0x00000001u;
         /* 021EC978 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -1096,8 +1096,8 @@ void Gambit_fn_021EC98C(CPUState* cpu) {
         /* 021EC98C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021EC98C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021EC990 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021EC990 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021EC994 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021EC994 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC994 */ _t2 = _t1 & 0x00000001u;
         /* 021EC994 */ _t3 = _t2 ^ 0x00000001u;
         /* 021EC994 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -1119,8 +1119,8 @@ void Gambit_fn_021EC9A8(CPUState* cpu) {
         /* 021EC9A8 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021EC9A8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021EC9AC */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021EC9AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021EC9B0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC9AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021EC9B0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC9B0 */ _t2 = _t1 & 0x00000001u;
         /* 021EC9B0 */ _t3 = _t2 ^ 0x00000001u;
         /* 021EC9B0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -1163,8 +1163,8 @@ void Gambit_fn_021EC9D4(CPUState* cpu) {
         /* 021EC9E4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021EC9E8 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021EC9E8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021EC9EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021EC9F0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC9EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021EC9F0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC9F0 */ _t5 = _t4 & 0x00000001u;
         /* 021EC9F0 */ if (_t5) goto L_021EC9F4; else goto L_021ECA10;
   L_021EC9F4: ; // 0x21ec9f4
@@ -1203,8 +1203,8 @@ void Gambit_fn_021EC9D8(CPUState* cpu) {
         /* 021EC9E4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021EC9E8 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021EC9E8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021EC9EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021EC9F0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EC9EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021EC9F0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EC9F0 */ _t5 = _t4 & 0x00000001u;
         /* 021EC9F0 */ if (_t5) goto L_021EC9F4; else goto L_021ECA10;
   L_021EC9F4: ; // 0x21ec9f4
@@ -1665,8 +1665,8 @@ void Gambit_fn_021ECBE8(CPUState* cpu) {
         /* 021ECBE8 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 021ECBE8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021ECBEC */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 021ECBEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021ECBF0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ECBEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021ECBF0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ECBF0 */ _t2 = _t1 & 0x00000001u;
         /* 021ECBF0 */ if (_t2) goto L_021ECC00; else goto L_021ECBF4;
   L_021ECBF4: ; // 0x21ecbf4
@@ -1695,8 +1695,8 @@ void Gambit_fn_021ECC0C(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -1784,9 +1784,9 @@ void Gambit_fn_021ECC54(CPUState* cpu) {
         /* 021ECC58 */ _t0 = cpu->r[8] + 0xFFFFFCD0u;
         /* 021ECC58 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 021ECC5C */ cpu->r[6] = 0x101D0000u;
-        /* 021ECC60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021ECC60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021ECC64 */ cpu->r[6] = cpu->r[6] + 0xFFFFFCDCu;
-        /* 021ECC68 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ECC68 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ECC68 */ _t2 = _t1 & 0x00000001u;
         /* 021ECC68 */ if (_t2) goto L_021ECC6C; else goto L_021ECC84;
   L_021ECC6C: ; // 0x21ecc6c
@@ -1799,8 +1799,8 @@ void Gambit_fn_021ECC54(CPUState* cpu) {
         /* 021ECC80 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 021ECC80 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_021ECC84: ; // 0x21ecc84
-        /* 021ECC84 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 021ECC88 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ECC84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 021ECC88 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ECC88 */ _t6 = _t5 & 0x00000001u;
         /* 021ECC88 */ if (_t6) goto L_021ECC8C; else goto L_021ECC94;
   L_021ECC8C: ; // 0x21ecc8c
@@ -1811,9 +1811,9 @@ void Gambit_fn_021ECC54(CPUState* cpu) {
         /* 021ECC98 */ _t7 = cpu->r[10] + 0xFFFFDA0Cu;
         /* 021ECC98 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 021ECC9C */ cpu->r[8] = 0x101D0000u;
-        /* 021ECCA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021ECCA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021ECCA4 */ cpu->r[8] = cpu->r[8] + 0xFFFFFC00u;
-        /* 021ECCA8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ECCA8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ECCA8 */ _t9 = _t8 & 0x00000001u;
         /* 021ECCA8 */ if (_t9) goto L_021ECCAC; else goto L_021ECCC4;
   L_021ECCAC: ; // 0x21eccac
@@ -1826,8 +1826,8 @@ void Gambit_fn_021ECC54(CPUState* cpu) {
         /* 021ECCC0 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 021ECCC0 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_021ECCC4: ; // 0x21eccc4
-        /* 021ECCC4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021ECCC8 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ECCC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021ECCC8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ECCC8 */ _t13 = _t12 & 0x00000001u;
         /* 021ECCC8 */ if (_t13) goto L_021ECCCC; else goto L_021ECCD4;
   L_021ECCCC: ; // 0x21ecccc
@@ -1838,9 +1838,9 @@ void Gambit_fn_021ECC54(CPUState* cpu) {
         /* 021ECCD8 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 021ECCD8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 021ECCDC */ cpu->r[10] = 0x101D0000u;
-        /* 021ECCE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021ECCE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021ECCE4 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 021ECCE8 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ECCE8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ECCE8 */ _t16 = _t15 & 0x00000001u;
         /* 021ECCE8 */ if (_t16) goto L_021ECCEC; else goto L_021ECD04;
   L_021ECCEC: ; // 0x21eccec
@@ -1853,8 +1853,8 @@ void Gambit_fn_021ECC54(CPUState* cpu) {
         /* 021ECD00 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 021ECD00 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_021ECD04: ; // 0x21ecd04
-        /* 021ECD04 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021ECD08 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ECD04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021ECD08 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ECD08 */ _t20 = _t19 & 0x00000001u;
         /* 021ECD08 */ if (_t20) goto L_021ECD0C; else goto L_021ECD14;
   L_021ECD0C: ; // 0x21ecd0c
@@ -1865,9 +1865,9 @@ void Gambit_fn_021ECC54(CPUState* cpu) {
         /* 021ECD18 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021ECD18 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021ECD1C */ cpu->r[12] = 0x101D0000u;
-        /* 021ECD20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021ECD20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021ECD24 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021ECD28 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ECD28 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ECD28 */ _t23 = _t22 & 0x00000001u;
         /* 021ECD28 */ if (_t23) goto L_021ECD2C; else goto L_021ECD44;
   L_021ECD2C: ; // 0x21ecd2c
@@ -1880,8 +1880,8 @@ void Gambit_fn_021ECC54(CPUState* cpu) {
         /* 021ECD40 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 021ECD40 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_021ECD44: ; // 0x21ecd44
-        /* 021ECD44 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021ECD48 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ECD44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021ECD48 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ECD48 */ _t27 = _t26 & 0x00000001u;
         /* 021ECD48 */ if (_t27) goto L_021ECD4C; else goto L_021ECD54;
   L_021ECD4C: ; // 0x21ecd4c
@@ -1893,9 +1893,9 @@ void Gambit_fn_021ECC54(CPUState* cpu) {
         /* 021ECD58 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 021ECD58 */ cpu->r[10] = _t28;
         /* 021ECD5C */ cpu->r[7] = 0x101D0000u;
-        /* 021ECD60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021ECD60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021ECD64 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 021ECD68 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ECD68 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ECD68 */ _t30 = _t29 & 0x00000001u;
         /* 021ECD68 */ if (_t30) goto L_021ECD6C; else goto L_021ECD80;
   L_021ECD6C: ; // 0x21ecd6c
@@ -1907,8 +1907,8 @@ void Gambit_fn_021ECC54(CPUState* cpu) {
         /* 021ECD7C */ _t32 = cpu->r[7] + 0x00000000u;
         /* 021ECD7C */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_021ECD80: ; // 0x21ecd80
-        /* 021ECD80 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 021ECD84 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ECD80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 021ECD84 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ECD84 */ _t34 = _t33 & 0x00000001u;
         /* 021ECD84 */ if (_t34) goto L_021ECD88; else goto L_021ECD90;
   L_021ECD88: ; // 0x21ecd88
@@ -1920,9 +1920,9 @@ void Gambit_fn_021ECC54(CPUState* cpu) {
         /* 021ECD94 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 021ECD94 */ cpu->r[8] = _t35;
         /* 021ECD98 */ cpu->r[6] = 0x101D0000u;
-        /* 021ECD9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021ECD9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021ECDA0 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 021ECDA4 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ECDA4 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ECDA4 */ _t37 = _t36 & 0x00000001u;
         /* 021ECDA4 */ if (_t37) goto L_021ECDA8; else goto L_021ECDBC;
   L_021ECDA8: ; // 0x21ecda8
@@ -1979,18 +1979,18 @@ void Gambit_fn_021ECDE8(CPUState* cpu) {
         /* 021ECDF8 */ _t3 = cpu->r[1] + 0x00000028u;
         /* 021ECDF8 */ rbrew_write_f32(cpu->mem, _t3, cpu->f[31]);
         /* 021ECDFC */ cpu->r[31] = cpu->r[3];
-        /* 021ECDFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021ECDFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021ECE00 */ _t4 = cpu->r[1] + 0x00000034u;
         /* 021ECE00 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
-        /* 021ECE04 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ECE04 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ECE04 */ _t6 = _t5 & 0x00000001u;
         /* 021ECE04 */ if (_t6) goto L_021ECE08; else goto L_021ECE18;
   L_021ECE08: ; // 0x21ece08
         /* 021ECE08 */ cpu->r[3] = 0x0000007Cu;
         /* 021ECE0C */ Gambit_fn_02801A78(cpu);
         /* 021ECE10 */ cpu->r[31] = cpu->r[3];
-        /* 021ECE10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021ECE14 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ECE10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021ECE14 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ECE14 */ _t8 = _t7 & 0x00000001u;
         /* 021ECE14 */ if (_t8) goto L_021ECEC8; else goto L_021ECE18;
   L_021ECE18: ; // 0x21ece18
@@ -2026,17 +2026,17 @@ void Gambit_fn_021ECDE8(CPUState* cpu) {
         /* 021ECE60 */ _t19 = cpu->r[1] + 0x00000010u;
         /* 021ECE60 */ rbrew_write32(cpu->mem, _t19, cpu->r[9]);
         /* 021ECE64 */ cpu->r[3] = cpu->r[31] + 0x00000050u;
-        /* 021ECE64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021ECE64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021ECE68 */ _t20 = cpu->r[7] + 0x000070F8u;
         /* 021ECE68 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t20);
-        /* 021ECE6C */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ECE6C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ECE6C */ _t22 = _t21 & 0x00000001u;
         /* 021ECE6C */ if (_t22) goto L_021ECE70; else goto L_021ECE80;
   L_021ECE70: ; // 0x21ece70
         /* 021ECE70 */ cpu->r[3] = 0x00000028u;
         /* 021ECE74 */ Gambit_fn_02801A78(cpu);
-        /* 021ECE78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021ECE7C */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ECE78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021ECE7C */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ECE7C */ _t24 = _t23 & 0x00000001u;
         /* 021ECE7C */ if (_t24) goto L_021ECEC4; else goto L_021ECE80;
   L_021ECE80: ; // 0x21ece80
@@ -2083,7 +2083,7 @@ void Gambit_fn_021ECDE8(CPUState* cpu) {
         /* 021ECED0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t42);
         /* 021ECED4 */ _t43 = cpu->r[1] + 0x00000020u;
         /* 021ECED4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t43);
-        /* 021ECED8 */ _t44 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021ECED8 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021ECED8 */ _t45 = _t44 & 0x00000001u;
         /* 021ECED8 */ if (_t45) goto L_021ECEDC; // else: addr-0 trap, fall-through
   L_021ECEDC: ; // 0x21ecedc
@@ -2228,8 +2228,8 @@ void Gambit_fn_021ECEEC(CPUState* cpu) {
         /* 021ED00C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t52);
         /* 021ED010 */ _t53 = cpu->r[31] + 0x00000074u;
         /* 021ED010 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t53);
-        /* 021ED014 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[0]);
-        /* 021ED018 */ _t54 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021ED014 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[0]));
+        /* 021ED018 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021ED018 */ _t55 = _t54 & 0x00000001u;
         /* 021ED018 */ if (_t55) goto L_021ED024; else goto L_021ED01C;
   L_021ED01C: ; // 0x21ed01c
@@ -2241,7 +2241,7 @@ void Gambit_fn_021ECEEC(CPUState* cpu) {
         /* 021ED028 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t56);
         /* 021ED02C */ _t57 = cpu->r[1] + 0x00000090u;
         /* 021ED02C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t57);
-        /* 021ED030 */ _t58 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021ED030 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021ED030 */ _t59 = _t58 & 0x00000001u;
         /* 021ED030 */ if (_t59) goto L_021ED034; // else: addr-0 trap, fall-through
   L_021ED034: ; // 0x21ed034
@@ -2378,8 +2378,8 @@ void Gambit_fn_021ED0D0(CPUState* cpu) {
   L_021ED0D0: ; // 0x21ed0d0
         /* 021ED0D0 */ _t0 = cpu->r[3] + 0x00000008u;
         /* 021ED0D0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 021ED0D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021ED0D8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED0D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021ED0D8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED0D8 */ _t2 = _t1 & 0x00000001u;
         /* 021ED0D8 */ if (_t2) goto L_021ED0E4; else goto L_021ED0DC;
   L_021ED0DC: ; // 0x21ed0dc
@@ -2397,8 +2397,8 @@ void Gambit_fn_021ED0EC(CPUState* cpu) {
   L_021ED0EC: ; // 0x21ed0ec
         /* 021ED0EC */ _t0 = cpu->r[3] + 0x00000008u;
         /* 021ED0EC */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 021ED0F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021ED0F4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED0F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021ED0F4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED0F4 */ _t2 = _t1 & 0x00000001u;
         /* 021ED0F4 */ if (_t2) goto L_021ED100; else goto L_021ED0F8;
   L_021ED0F8: ; // 0x21ed0f8
@@ -2417,8 +2417,8 @@ void Gambit_fn_021ED108(CPUState* cpu) {
         /* 021ED108 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021ED108 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021ED10C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021ED10C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021ED110 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED10C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021ED110 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED110 */ _t2 = _t1 & 0x00000001u;
         /* 021ED110 */ _t3 = _t2 ^ 0x00000001u;
         /* 021ED110 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -2440,8 +2440,8 @@ void Gambit_fn_021ED124(CPUState* cpu) {
         /* 021ED124 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021ED124 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021ED128 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021ED128 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021ED12C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED128 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021ED12C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED12C */ _t2 = _t1 & 0x00000001u;
         /* 021ED12C */ _t3 = _t2 ^ 0x00000001u;
         /* 021ED12C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -2463,8 +2463,8 @@ void Gambit_fn_021ED140(CPUState* cpu) {
         /* 021ED140 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021ED140 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021ED144 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021ED144 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021ED148 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021ED148 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED148 */ _t2 = _t1 & 0x00000001u;
         /* 021ED148 */ _t3 = _t2 ^ 0x00000001u;
         /* 021ED148 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -2507,8 +2507,8 @@ void Gambit_fn_021ED16C(CPUState* cpu) {
         /* 021ED17C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021ED180 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021ED180 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021ED184 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021ED188 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED184 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021ED188 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED188 */ _t5 = _t4 & 0x00000001u;
         /* 021ED188 */ if (_t5) goto L_021ED18C; else goto L_021ED1A8;
   L_021ED18C: ; // 0x21ed18c
@@ -2547,8 +2547,8 @@ void Gambit_fn_021ED170(CPUState* cpu) {
         /* 021ED17C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021ED180 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021ED180 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021ED184 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021ED188 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED184 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021ED188 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED188 */ _t5 = _t4 & 0x00000001u;
         /* 021ED188 */ if (_t5) goto L_021ED18C; else goto L_021ED1A8;
   L_021ED18C: ; // 0x21ed18c
@@ -2690,10 +2690,10 @@ void Gambit_fn_021ED22C(CPUState* cpu) {
         /* 021ED22C */ cpu->r[12] = 0x101D0000u;
         /* 021ED230 */ _t0 = cpu->r[12] + 0xFFFFFCE0u;
         /* 021ED230 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 021ED234 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021ED234 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021ED238 */ cpu->r[12] = 0x101D0000u;
         /* 021ED23C */ cpu->r[12] = cpu->r[12] + 0xFFFFFCE4u;
-        /* 021ED240 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED240 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED240 */ _t2 = _t1 & 0x00000001u;
         /* 021ED240 */ if (_t2) goto L_021ED244; else goto L_021ED25C;
   L_021ED244: ; // 0x21ed244
@@ -2706,8 +2706,8 @@ void Gambit_fn_021ED22C(CPUState* cpu) {
         /* 021ED258 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 021ED258 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_021ED25C: ; // 0x21ed25c
-        /* 021ED25C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021ED260 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED25C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021ED260 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED260 */ _t6 = _t5 & 0x00000001u;
         /* 021ED260 */ if (_t6) goto L_021ED264; else goto L_021ED26C;
   L_021ED264: ; // 0x21ed264
@@ -2719,9 +2719,9 @@ void Gambit_fn_021ED22C(CPUState* cpu) {
         /* 021ED270 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 021ED270 */ cpu->r[11] = _t7;
         /* 021ED274 */ cpu->r[10] = 0x101D0000u;
-        /* 021ED278 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021ED278 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021ED27C */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021ED280 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED280 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED280 */ _t9 = _t8 & 0x00000001u;
         /* 021ED280 */ if (_t9) goto L_021ED284; else goto L_021ED298;
   L_021ED284: ; // 0x21ed284
@@ -2733,8 +2733,8 @@ void Gambit_fn_021ED22C(CPUState* cpu) {
         /* 021ED294 */ _t11 = cpu->r[10] + 0x00000000u;
         /* 021ED294 */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
   L_021ED298: ; // 0x21ed298
-        /* 021ED298 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021ED29C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED298 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021ED29C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED29C */ _t13 = _t12 & 0x00000001u;
         /* 021ED29C */ if (_t13) goto L_021ED2A0; else goto L_021ED2A8;
   L_021ED2A0: ; // 0x21ed2a0
@@ -2746,9 +2746,9 @@ void Gambit_fn_021ED22C(CPUState* cpu) {
         /* 021ED2AC */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 021ED2AC */ cpu->r[8] = _t14;
         /* 021ED2B0 */ cpu->r[11] = 0x101D0000u;
-        /* 021ED2B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021ED2B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021ED2B8 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021ED2BC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED2BC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED2BC */ _t16 = _t15 & 0x00000001u;
         /* 021ED2BC */ if (_t16) goto L_021ED2C0; else goto L_021ED2D4;
   L_021ED2C0: ; // 0x21ed2c0
@@ -2788,7 +2788,7 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021ED2F4 */ rbrew_write_f64(cpu->mem, _t2, cpu->f[30]);
         /* 021ED2F8 */ /* nop */
         /* 021ED2FC */ cpu->r[17] = cpu->r[3];
-        /* 021ED2FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[17], 0x00000000u);
+        /* 021ED2FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[17], 0x00000000u));
         /* 021ED300 */ /* nop */
         /* 021ED304 */ cpu->r[0] = cpu->lr;
         /* 021ED308 */ /* nop */
@@ -2798,15 +2798,15 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021ED310 */ rbrew_write_f32(cpu->mem, _t4, cpu->f[30]);
         /* 021ED314 */ _t5 = cpu->r[1] + 0x0000029Cu;
         /* 021ED314 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
-        /* 021ED318 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED318 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED318 */ _t7 = _t6 & 0x00000001u;
         /* 021ED318 */ if (_t7) goto L_021ED31C; else goto L_021ED32C;
   L_021ED31C: ; // 0x21ed31c
         /* 021ED31C */ cpu->r[3] = 0x0000026Cu;
         /* 021ED320 */ Gambit_fn_02801A78(cpu);
         /* 021ED324 */ cpu->r[17] = cpu->r[3];
-        /* 021ED324 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[17], 0x00000000u);
-        /* 021ED328 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED324 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[17], 0x00000000u));
+        /* 021ED328 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED328 */ _t9 = _t8 & 0x00000001u;
         /* 021ED328 */ if (_t9) goto L_021EF420; else goto L_021ED32C;
   L_021ED32C: ; // 0x21ed32c
@@ -2818,17 +2818,17 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021ED340 */ cpu->r[0] = 0x10040000u;
         /* 021ED344 */ cpu->r[0] = cpu->r[0] + 0xFFFFC760u;
         /* 021ED348 */ cpu->r[3] = cpu->r[17] + 0x00000248u;
-        /* 021ED348 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021ED348 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021ED34C */ _t10 = cpu->r[17] + 0x00000004u;
         /* 021ED34C */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
-        /* 021ED350 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED350 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED350 */ _t12 = _t11 & 0x00000001u;
         /* 021ED350 */ if (_t12) goto L_021ED354; else goto L_021ED364;
   L_021ED354: ; // 0x21ed354
         /* 021ED354 */ cpu->r[3] = 0x00000008u;
         /* 021ED358 */ Gambit_fn_02801A78(cpu);
-        /* 021ED35C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021ED360 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED35C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021ED360 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED360 */ _t14 = _t13 & 0x00000001u;
         /* 021ED360 */ if (_t14) goto L_021ED36C; else goto L_021ED364;
   L_021ED364: ; // 0x21ed364
@@ -2866,10 +2866,10 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021ED3B4 */ rbrew_write32(cpu->mem, _t24, cpu->r[8]);
         /* 021ED3B8 */ Gambit_fn_02824838(cpu);
         /* 021ED3BC */ cpu->r[15] = cpu->r[3];
-        /* 021ED3BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[15], 0x00000000u);
+        /* 021ED3BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[15], 0x00000000u));
         /* 021ED3C0 */ cpu->r[8] = 0x00000001u;
         /* 021ED3C4 */ cpu->r[31] = 0x101D0000u;
-        /* 021ED3C8 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED3C8 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED3C8 */ _t26 = _t25 & 0x00000001u;
         /* 021ED3C8 */ if (_t26) goto L_021ED3DC; else goto L_021ED3CC;
   L_021ED3CC: ; // 0x21ed3cc
@@ -2892,8 +2892,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021ED3F8 */ Gambit_fn_02019890(cpu);
         /* 021ED3FC */ _t30 = cpu->r[1] + 0x00000204u;
         /* 021ED3FC */ cpu->r[12] = rbrew_read32(cpu->mem, _t30);
-        /* 021ED400 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000002u);
-        /* 021ED404 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED400 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000002u));
+        /* 021ED404 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED404 */ _t32 = _t31 & 0x00000001u;
         /* 021ED404 */ if (_t32) goto L_021ED408; else goto L_021ED454;
   L_021ED408: ; // 0x21ed408
@@ -2916,8 +2916,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021ED428 */ if (_t36) goto L_021ED424; else goto L_021ED42C;
   L_021ED42C: ; // 0x21ed42c
         /* 021ED42C */ cpu->r[9] = cpu->r[9] + 0xFFFFFFFFu;
-        /* 021ED42C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 021ED430 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED42C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 021ED430 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED430 */ _t38 = _t37 & 0x00000001u;
         /* 021ED430 */ if (_t38) goto L_021ED434; else goto L_021ED410;
   L_021ED434: ; // 0x21ed434
@@ -2928,8 +2928,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021ED43C */ cpu->ctr = cpu->r[0];
         /* 021ED440 */ cpu->r[3] = cpu->r[15];
         /* 021ED444 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021ED448 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[14], 0x00000001u);
-        /* 021ED44C */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED448 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[14], 0x00000001u));
+        /* 021ED44C */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED44C */ _t42 = _t41 & 0x00000001u;
         /* 021ED44C */ if (_t42) goto L_021ED450; else goto L_021EF414;
   L_021ED450: ; // 0x21ed450
@@ -2939,8 +2939,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021ED458 */ Gambit_fn_02019890(cpu);
         /* 021ED45C */ _t43 = cpu->r[1] + 0x00000208u;
         /* 021ED45C */ cpu->r[0] = rbrew_read32(cpu->mem, _t43);
-        /* 021ED460 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 021ED464 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED460 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 021ED464 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED464 */ _t45 = _t44 & 0x00000001u;
         /* 021ED464 */ if (_t45) goto L_021ED47C; else goto L_021ED468;
   L_021ED468: ; // 0x21ed468
@@ -2948,8 +2948,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021ED46C */ Gambit_fn_02019890(cpu);
         /* 021ED470 */ _t46 = cpu->r[1] + 0x0000020Cu;
         /* 021ED470 */ cpu->r[4] = rbrew_read32(cpu->mem, _t46);
-        /* 021ED474 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000003u);
-        /* 021ED478 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED474 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000003u));
+        /* 021ED478 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED478 */ _t48 = _t47 & 0x00000001u;
         /* 021ED478 */ if (_t48) goto L_021ED47C; else goto L_021ED908;
   L_021ED47C: ; // 0x21ed47c
@@ -2964,9 +2964,9 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021ED490 */ Gambit_fn_02019890(cpu);
         /* 021ED494 */ _t52 = cpu->r[1] + 0x00000214u;
         /* 021ED494 */ cpu->r[6] = rbrew_read32(cpu->mem, _t52);
-        /* 021ED498 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000003u);
+        /* 021ED498 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000003u));
         /* 021ED49C */ cpu->r[30] = 0x00000018u;
-        /* 021ED4A0 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED4A0 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED4A0 */ _t54 = _t53 & 0x00000001u;
         /* 021ED4A0 */ if (_t54) goto L_021ED4A4; else goto L_021ED4A8;
   L_021ED4A4: ; // 0x21ed4a4
@@ -2988,8 +2988,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021ED4DC */ cpu->r[5] = cpu->r[30];
         /* 021ED4E0 */ cpu->r[3] = cpu->r[17];
         /* 021ED4E4 */ Gambit_fn_021F9044(cpu);
-        /* 021ED4E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021ED4EC */ _t55 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021ED4E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021ED4EC */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021ED4EC */ _t56 = _t55 & 0x00000001u;
         /* 021ED4EC */ if (_t56) goto L_021ED4F0; else goto L_021ED534;
   L_021ED4F0: ; // 0x21ed4f0
@@ -3019,8 +3019,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021ED548 */ Gambit_fn_02019890(cpu);
         /* 021ED54C */ _t57 = cpu->r[1] + 0x00000210u;
         /* 021ED54C */ cpu->r[7] = rbrew_read32(cpu->mem, _t57);
-        /* 021ED550 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000001u);
-        /* 021ED554 */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED550 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000001u));
+        /* 021ED554 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED554 */ _t59 = _t58 & 0x00000001u;
         /* 021ED554 */ if (_t59) goto L_021ED56C; else goto L_021ED558;
   L_021ED558: ; // 0x21ed558
@@ -3028,8 +3028,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021ED55C */ Gambit_fn_02019890(cpu);
         /* 021ED560 */ _t60 = cpu->r[1] + 0x00000200u;
         /* 021ED560 */ cpu->r[8] = rbrew_read32(cpu->mem, _t60);
-        /* 021ED564 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000003u);
-        /* 021ED568 */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED564 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000003u));
+        /* 021ED568 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED568 */ _t62 = _t61 & 0x00000001u;
         /* 021ED568 */ if (_t62) goto L_021ED56C; else goto L_021ED618;
   L_021ED56C: ; // 0x21ed56c
@@ -3073,8 +3073,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021ED600 */ cpu->r[4] = 0x00000061u;
         /* 021ED604 */ cpu->r[3] = cpu->r[17];
         /* 021ED608 */ Gambit_fn_021F961C(cpu);
-        /* 021ED60C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021ED610 */ _t63 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021ED60C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021ED610 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021ED610 */ _t64 = _t63 & 0x00000001u;
         /* 021ED610 */ if (_t64) goto L_021ED614; else goto L_021ED6D0;
   L_021ED614: ; // 0x21ed614
@@ -3120,8 +3120,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021ED6AC */ cpu->r[4] = 0x00000061u;
         /* 021ED6B0 */ cpu->r[3] = cpu->r[17];
         /* 021ED6B4 */ Gambit_fn_021F961C(cpu);
-        /* 021ED6B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021ED6BC */ _t65 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021ED6B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021ED6BC */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021ED6BC */ _t66 = _t65 & 0x00000001u;
         /* 021ED6BC */ if (_t66) goto L_021ED6C0; else goto L_021ED6D0;
   L_021ED6C0: ; // 0x21ed6c0
@@ -3146,8 +3146,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021ED704 */ Gambit_fn_02019890(cpu);
         /* 021ED708 */ _t67 = cpu->r[1] + 0x00000200u;
         /* 021ED708 */ cpu->r[9] = rbrew_read32(cpu->mem, _t67);
-        /* 021ED70C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000001u);
-        /* 021ED710 */ _t68 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED70C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000001u));
+        /* 021ED710 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED710 */ _t69 = _t68 & 0x00000001u;
         /* 021ED710 */ if (_t69) goto L_021ED714; else goto L_021ED824;
   L_021ED714: ; // 0x21ed714
@@ -3253,8 +3253,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021ED89C */ cpu->r[5] = 0x0000000Au;
         /* 021ED8A0 */ Gambit_fn_021FA014(cpu);
         /* 021ED8A4 */ Gambit_fn_027E3F5C(cpu);
-        /* 021ED8A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021ED8AC */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED8A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021ED8AC */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED8AC */ _t71 = _t70 & 0x00000001u;
         /* 021ED8AC */ if (_t71) goto L_021EF114; else goto L_021ED8B0;
   L_021ED8B0: ; // 0x21ed8b0
@@ -3285,8 +3285,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021ED90C */ Gambit_fn_02019890(cpu);
         /* 021ED910 */ _t72 = cpu->r[1] + 0x00000218u;
         /* 021ED910 */ cpu->r[10] = rbrew_read32(cpu->mem, _t72);
-        /* 021ED914 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000008u);
-        /* 021ED918 */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021ED914 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000008u));
+        /* 021ED918 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021ED918 */ _t74 = _t73 & 0x00000001u;
         /* 021ED918 */ if (_t74) goto L_021ED91C; else goto L_021EDDD8;
   L_021ED91C: ; // 0x21ed91c
@@ -3601,8 +3601,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EDDDC */ Gambit_fn_02019890(cpu);
         /* 021EDDE0 */ _t78 = cpu->r[1] + 0x0000021Cu;
         /* 021EDDE0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t78);
-        /* 021EDDE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x0000000Au);
-        /* 021EDDE8 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EDDE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x0000000Au));
+        /* 021EDDE8 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EDDE8 */ _t80 = _t79 & 0x00000001u;
         /* 021EDDE8 */ if (_t80) goto L_021EDDEC; else goto L_021EDE94;
   L_021EDDEC: ; // 0x21eddec
@@ -3674,14 +3674,14 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EDED8 */ cpu->r[3] = cpu->r[24];
         /* 021EDEDC */ cpu->r[4] = cpu->r[23];
         /* 021EDEE0 */ Gambit_fn_0261F55C(cpu);
-        /* 021EDEE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021EDEE8 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EDEE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021EDEE8 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EDEE8 */ _t86 = _t85 & 0x00000001u;
         /* 021EDEE8 */ if (_t86) goto L_021EE604; else goto L_021EDEEC;
   L_021EDEEC: ; // 0x21edeec
-        /* 021EDEEC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], 0x00000008u);
+        /* 021EDEEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], 0x00000008u));
         /* 021EDEF0 */ cpu->r[20] = 0x00000000u;
-        /* 021EDEF4 */ _t87 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EDEF4 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EDEF4 */ _t88 = _t87 & 0x00000001u;
         /* 021EDEF4 */ if (_t88) goto L_021EDEF8; else goto L_021EDF34;
   L_021EDEF8: ; // 0x21edef8
@@ -3701,8 +3701,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EDF20 */ cpu->r[7] = cpu->r[3];
         /* 021EDF24 */ _t92 = cpu->r[7] + 0x000000F4u;
         /* 021EDF24 */ cpu->r[4] = rbrew_read32(cpu->mem, _t92);
-        /* 021EDF28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 021EDF2C */ _t93 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EDF28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 021EDF2C */ _t93 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EDF2C */ _t94 = _t93 & 0x00000001u;
         /* 021EDF2C */ if (_t94) goto L_021EDF30; else goto L_021EE1F8;
   L_021EDF30: ; // 0x21edf30
@@ -3724,15 +3724,15 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EDF5C */ cpu->r[7] = cpu->r[3];
         /* 021EDF60 */ _t98 = cpu->r[7] + 0x000000F4u;
         /* 021EDF60 */ cpu->r[4] = rbrew_read32(cpu->mem, _t98);
-        /* 021EDF64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 021EDF68 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EDF64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 021EDF68 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EDF68 */ _t100 = _t99 & 0x00000001u;
         /* 021EDF68 */ if (_t100) goto L_021EDF6C; else goto L_021EE1F8;
   L_021EDF6C: ; // 0x21edf6c
         /* 021EDF6C */ _t101 = cpu->r[7] + 0x000000F8u;
         /* 021EDF6C */ cpu->r[6] = rbrew_read32(cpu->mem, _t101);
-        /* 021EDF70 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], 0x00000024u);
-        /* 021EDF74 */ _t102 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EDF70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], 0x00000024u));
+        /* 021EDF74 */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EDF74 */ _t103 = _t102 & 0x00000001u;
         /* 021EDF74 */ if (_t103) goto L_021EE1B4; else goto L_021EDF78;
   L_021EDF78: ; // 0x21edf78
@@ -3761,15 +3761,15 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EE1E4 */ cpu->r[9] = cpu->r[3];
         /* 021EE1E8 */ _t108 = cpu->r[9] + 0x000000F4u;
         /* 021EE1E8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t108);
-        /* 021EE1EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000007u);
-        /* 021EE1F0 */ _t109 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EE1EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000007u));
+        /* 021EE1F0 */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EE1F0 */ _t110 = _t109 & 0x00000001u;
         /* 021EE1F0 */ if (_t110) goto L_021EE1F4; else goto L_021EE3E8;
   L_021EE1F4: ; // 0x21ee1f4
         /* 021EE1F4 */ goto L_021EE358;
   L_021EE1F8: ; // 0x21ee1f8
-        /* 021EE1F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000001u);
-        /* 021EE1FC */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EE1F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000001u));
+        /* 021EE1FC */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EE1FC */ _t112 = _t111 & 0x00000001u;
         /* 021EE1FC */ if (_t112) goto L_021EE200; else goto L_021EE26C;
   L_021EE200: ; // 0x21ee200
@@ -3808,22 +3808,22 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EE258 */ cpu->r[9] = cpu->r[3];
         /* 021EE25C */ _t123 = cpu->r[9] + 0x000000F4u;
         /* 021EE25C */ cpu->r[0] = rbrew_read32(cpu->mem, _t123);
-        /* 021EE260 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000007u);
-        /* 021EE264 */ _t124 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EE260 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000007u));
+        /* 021EE264 */ _t124 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EE264 */ _t125 = _t124 & 0x00000001u;
         /* 021EE264 */ if (_t125) goto L_021EE268; else goto L_021EE3E8;
   L_021EE268: ; // 0x21ee268
         /* 021EE268 */ goto L_021EE358;
   L_021EE26C: ; // 0x21ee26c
-        /* 021EE26C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000002u);
-        /* 021EE270 */ _t126 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EE26C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000002u));
+        /* 021EE270 */ _t126 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EE270 */ _t127 = _t126 & 0x00000001u;
         /* 021EE270 */ if (_t127) goto L_021EE274; else goto L_021EE2E4;
   L_021EE274: ; // 0x21ee274
         /* 021EE274 */ _t128 = cpu->r[7] + 0x000000F8u;
         /* 021EE274 */ cpu->r[5] = rbrew_read32(cpu->mem, _t128);
-        /* 021EE278 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x0000000Cu);
-        /* 021EE27C */ _t129 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EE278 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x0000000Cu));
+        /* 021EE27C */ _t129 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EE27C */ _t130 = _t129 & 0x00000001u;
         /* 021EE27C */ if (_t130) goto L_021EE294; else goto L_021EE280;
   L_021EE280: ; // 0x21ee280
@@ -3860,22 +3860,22 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EE2D0 */ cpu->r[9] = cpu->r[3];
         /* 021EE2D4 */ _t140 = cpu->r[9] + 0x000000F4u;
         /* 021EE2D4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t140);
-        /* 021EE2D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000007u);
-        /* 021EE2DC */ _t141 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EE2D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000007u));
+        /* 021EE2DC */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EE2DC */ _t142 = _t141 & 0x00000001u;
         /* 021EE2DC */ if (_t142) goto L_021EE2E0; else goto L_021EE3E8;
   L_021EE2E0: ; // 0x21ee2e0
         /* 021EE2E0 */ goto L_021EE358;
   L_021EE2E4: ; // 0x21ee2e4
-        /* 021EE2E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000003u);
-        /* 021EE2E8 */ _t143 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EE2E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000003u));
+        /* 021EE2E8 */ _t143 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EE2E8 */ _t144 = _t143 & 0x00000001u;
         /* 021EE2E8 */ if (_t144) goto L_021EE2EC; else goto L_021EE324;
   L_021EE2EC: ; // 0x21ee2ec
         /* 021EE2EC */ _t145 = cpu->r[7] + 0x000000F8u;
         /* 021EE2EC */ cpu->r[6] = rbrew_read32(cpu->mem, _t145);
-        /* 021EE2F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], 0x00000005u);
-        /* 021EE2F4 */ _t146 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EE2F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], 0x00000005u));
+        /* 021EE2F4 */ _t146 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EE2F4 */ _t147 = _t146 & 0x00000001u;
         /* 021EE2F4 */ if (_t147) goto L_021EE30C; else goto L_021EE2F8;
   L_021EE2F8: ; // 0x21ee2f8
@@ -3913,18 +3913,18 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EE348 */ cpu->r[9] = cpu->r[3];
         /* 021EE34C */ _t157 = cpu->r[9] + 0x000000F4u;
         /* 021EE34C */ cpu->r[0] = rbrew_read32(cpu->mem, _t157);
-        /* 021EE350 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000007u);
-        /* 021EE354 */ _t158 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EE350 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000007u));
+        /* 021EE354 */ _t158 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EE354 */ _t159 = _t158 & 0x00000001u;
         /* 021EE354 */ if (_t159) goto L_021EE358; else goto L_021EE3E8;
   L_021EE358: ; // 0x21ee358
-        /* 021EE358 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000004u);
-        /* 021EE35C */ _t160 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EE358 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000004u));
+        /* 021EE35C */ _t160 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EE35C */ _t161 = _t160 & 0x00000001u;
         /* 021EE35C */ if (_t161) goto L_021EE438; else goto L_021EE360;
   L_021EE360: ; // 0x21ee360
-        /* 021EE360 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
-        /* 021EE364 */ _t162 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EE360 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
+        /* 021EE364 */ _t162 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EE364 */ _t163 = _t162 & 0x00000001u;
         /* 021EE364 */ if (_t163) goto L_021EE464; else goto L_021EE368;
   L_021EE368: ; // 0x21ee368
@@ -3941,12 +3941,12 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EE388 */ Gambit_fn_02022118(cpu);
         /* 021EE38C */ _t166 = cpu->r[3] + 0x000000F4u;
         /* 021EE38C */ cpu->r[0] = rbrew_read32(cpu->mem, _t166);
-        /* 021EE390 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000000Bu);
-        /* 021EE394 */ _t167 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EE390 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000000Bu));
+        /* 021EE394 */ _t167 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EE394 */ _t168 = _t167 & 0x00000001u;
         /* 021EE394 */ if (_t168) goto L_021EE5D4; else goto L_021EE398;
   L_021EE398: ; // 0x21ee398
-        /* 021EE398 */ _t169 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EE398 */ _t169 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EE398 */ _t170 = _t169 & 0x00000001u;
         /* 021EE398 */ if (_t170) goto L_021EE39C; else goto L_021EE4F8;
   L_021EE39C: ; // 0x21ee39c
@@ -3982,18 +3982,18 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EE3E0 */ rbrew_write32(cpu->mem, _t182, cpu->r[10]);
         /* 021EE3E4 */ goto L_021EE604;
   L_021EE3E8: ; // 0x21ee3e8
-        /* 021EE3E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000007u);
-        /* 021EE3EC */ _t183 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EE3E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000007u));
+        /* 021EE3EC */ _t183 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EE3EC */ _t184 = _t183 & 0x00000001u;
         /* 021EE3EC */ if (_t184) goto L_021EE49C; else goto L_021EE3F0;
   L_021EE3F0: ; // 0x21ee3f0
-        /* 021EE3F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000009u);
-        /* 021EE3F4 */ _t185 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EE3F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000009u));
+        /* 021EE3F4 */ _t185 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EE3F4 */ _t186 = _t185 & 0x00000001u;
         /* 021EE3F4 */ if (_t186) goto L_021EE4B8; else goto L_021EE3F8;
   L_021EE3F8: ; // 0x21ee3f8
-        /* 021EE3F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000000Au);
-        /* 021EE3FC */ _t187 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EE3F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000000Au));
+        /* 021EE3FC */ _t187 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EE3FC */ _t188 = _t187 & 0x00000001u;
         /* 021EE3FC */ if (_t188) goto L_021EE480; else goto L_021EE400;
   L_021EE400: ; // 0x21ee400
@@ -4010,12 +4010,12 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EE420 */ Gambit_fn_02022118(cpu);
         /* 021EE424 */ _t191 = cpu->r[3] + 0x000000F4u;
         /* 021EE424 */ cpu->r[0] = rbrew_read32(cpu->mem, _t191);
-        /* 021EE428 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000000Bu);
-        /* 021EE42C */ _t192 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EE428 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000000Bu));
+        /* 021EE42C */ _t192 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EE42C */ _t193 = _t192 & 0x00000001u;
         /* 021EE42C */ if (_t193) goto L_021EE5D4; else goto L_021EE430;
   L_021EE430: ; // 0x21ee430
-        /* 021EE430 */ _t194 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EE430 */ _t194 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EE430 */ _t195 = _t194 & 0x00000001u;
         /* 021EE430 */ if (_t195) goto L_021EE39C; else goto L_021EE434;
   L_021EE434: ; // 0x21ee434
@@ -4023,8 +4023,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
   L_021EE438: ; // 0x21ee438
         /* 021EE438 */ _t196 = cpu->r[9] + 0x000000F8u;
         /* 021EE438 */ cpu->r[7] = rbrew_read32(cpu->mem, _t196);
-        /* 021EE43C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x00000003u);
-        /* 021EE440 */ _t197 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EE43C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x00000003u));
+        /* 021EE440 */ _t197 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EE440 */ _t198 = _t197 & 0x00000001u;
         /* 021EE440 */ if (_t198) goto L_021EE4C4; else goto L_021EE444;
   L_021EE444: ; // 0x21ee444
@@ -4095,26 +4095,26 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EE4E4 */ Gambit_fn_02022118(cpu);
         /* 021EE4E8 */ _t218 = cpu->r[3] + 0x000000F4u;
         /* 021EE4E8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t218);
-        /* 021EE4EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000000Bu);
-        /* 021EE4F0 */ _t219 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EE4EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000000Bu));
+        /* 021EE4F0 */ _t219 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EE4F0 */ _t220 = _t219 & 0x00000001u;
         /* 021EE4F0 */ if (_t220) goto L_021EE5D4; else goto L_021EE4F4;
   L_021EE4F4: ; // 0x21ee4f4
-        /* 021EE4F4 */ _t221 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EE4F4 */ _t221 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EE4F4 */ _t222 = _t221 & 0x00000001u;
         /* 021EE4F4 */ if (_t222) goto L_021EE39C; else goto L_021EE4F8;
   L_021EE4F8: ; // 0x21ee4f8
-        /* 021EE4F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000000Du);
-        /* 021EE4FC */ _t223 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EE4F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000000Du));
+        /* 021EE4FC */ _t223 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EE4FC */ _t224 = _t223 & 0x00000001u;
         /* 021EE4FC */ if (_t224) goto L_021EE540; else goto L_021EE500;
   L_021EE500: ; // 0x21ee500
-        /* 021EE500 */ _t225 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EE500 */ _t225 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EE500 */ _t226 = _t225 & 0x00000001u;
         /* 021EE500 */ if (_t226) goto L_021EE580; else goto L_021EE504;
   L_021EE504: ; // 0x21ee504
-        /* 021EE504 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000010u);
-        /* 021EE508 */ _t227 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EE504 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000010u));
+        /* 021EE508 */ _t227 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EE508 */ _t228 = _t227 & 0x00000001u;
         /* 021EE508 */ if (_t228) goto L_021EE5C0; else goto L_021EE50C;
   L_021EE50C: ; // 0x21ee50c
@@ -4194,8 +4194,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EE5B8 */ rbrew_write32(cpu->mem, _t256, cpu->r[8]);
         /* 021EE5BC */ goto L_021EE604;
   L_021EE5C0: ; // 0x21ee5c0
-        /* 021EE5C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
-        /* 021EE5C4 */ _t257 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EE5C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
+        /* 021EE5C4 */ _t257 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EE5C4 */ _t258 = _t257 & 0x00000001u;
         /* 021EE5C4 */ if (_t258) goto L_021EE5C8; else goto L_021EE5D4;
   L_021EE5C8: ; // 0x21ee5c8
@@ -4227,19 +4227,19 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EE600 */ rbrew_write32(cpu->mem, _t268, cpu->r[12]);
   L_021EE604: ; // 0x21ee604
         /* 021EE604 */ cpu->r[25] = cpu->r[25] + 0xFFFFFFFFu;
-        /* 021EE604 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 021EE604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 021EE608 */ cpu->r[23] = cpu->r[23] + 0x00000001u;
         /* 021EE60C */ cpu->r[27] = cpu->r[27] + 0x00000004u;
-        /* 021EE610 */ _t269 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EE610 */ _t269 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EE610 */ _t270 = _t269 & 0x00000001u;
         /* 021EE610 */ if (_t270) goto L_021EE614; else goto L_021EDED8;
   L_021EE614: ; // 0x21ee614
         /* 021EE614 */ _t271 = cpu->r[1] + 0x00000134u;
         /* 021EE614 */ cpu->r[5] = rbrew_read32(cpu->mem, _t271);
-        /* 021EE618 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000008u);
+        /* 021EE618 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000008u));
         /* 021EE61C */ _t272 = cpu->r[1] + 0x00000138u;
         /* 021EE61C */ cpu->r[7] = rbrew_read32(cpu->mem, _t272);
-        /* 021EE620 */ _t273 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EE620 */ _t273 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EE620 */ _t274 = _t273 & 0x00000001u;
         /* 021EE620 */ if (_t274) goto L_021EE624; else goto L_021EE62C;
   L_021EE624: ; // 0x21ee624
@@ -4247,8 +4247,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EE628 */ _t275 = cpu->r[1] + 0x00000134u;
         /* 021EE628 */ rbrew_write32(cpu->mem, _t275, cpu->r[0]);
   L_021EE62C: ; // 0x21ee62c
-        /* 021EE62C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000008u);
-        /* 021EE630 */ _t276 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EE62C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000008u));
+        /* 021EE630 */ _t276 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EE630 */ _t277 = _t276 & 0x00000001u;
         /* 021EE630 */ if (_t277) goto L_021EE634; else goto L_021EE63C;
   L_021EE634: ; // 0x21ee634
@@ -4260,18 +4260,18 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EE640 */ Gambit_fn_02019890(cpu);
         /* 021EE644 */ _t279 = cpu->r[1] + 0x00000220u;
         /* 021EE644 */ cpu->r[7] = rbrew_read32(cpu->mem, _t279);
-        /* 021EE648 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000006u);
-        /* 021EE64C */ _t280 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EE648 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000006u));
+        /* 021EE64C */ _t280 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EE64C */ _t281 = _t280 & 0x00000001u;
         /* 021EE64C */ if (_t281) goto L_021EE650; else goto L_021EE6E0;
   L_021EE650: ; // 0x21ee650
         /* 021EE650 */ _t282 = cpu->r[1] + 0x00000134u;
         /* 021EE650 */ cpu->r[5] = rbrew_read32(cpu->mem, _t282);
         /* 021EE654 */ cpu->r[12] = 0x00000002u;
-        /* 021EE658 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000002u);
+        /* 021EE658 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000002u));
         /* 021EE65C */ _t283 = cpu->r[1] + 0x00000138u;
         /* 021EE65C */ cpu->r[7] = rbrew_read32(cpu->mem, _t283);
-        /* 021EE660 */ _t284 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EE660 */ _t284 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EE660 */ _t285 = _t284 & 0x00000001u;
         /* 021EE660 */ if (_t285) goto L_021EE664; else goto L_021EE668;
   L_021EE664: ; // 0x21ee664
@@ -4279,11 +4279,11 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
   L_021EE668: ; // 0x21ee668
         /* 021EE668 */ _t286 = cpu->r[1] + 0x00000134u;
         /* 021EE668 */ rbrew_write32(cpu->mem, _t286, cpu->r[12]);
-        /* 021EE66C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000002u);
+        /* 021EE66C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000002u));
         /* 021EE670 */ cpu->r[4] = 0x00000002u;
         /* 021EE674 */ _t287 = cpu->r[1] + 0x000001DCu;
         /* 021EE674 */ cpu->r[8] = rbrew_read32(cpu->mem, _t287);
-        /* 021EE678 */ _t288 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EE678 */ _t288 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EE678 */ _t289 = _t288 & 0x00000001u;
         /* 021EE678 */ if (_t289) goto L_021EE67C; else goto L_021EE680;
   L_021EE67C: ; // 0x21ee67c
@@ -4291,11 +4291,11 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
   L_021EE680: ; // 0x21ee680
         /* 021EE680 */ _t290 = cpu->r[1] + 0x00000138u;
         /* 021EE680 */ rbrew_write32(cpu->mem, _t290, cpu->r[4]);
-        /* 021EE684 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000002u);
+        /* 021EE684 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000002u));
         /* 021EE688 */ cpu->r[5] = 0x00000002u;
         /* 021EE68C */ _t291 = cpu->r[1] + 0x0000014Cu;
         /* 021EE68C */ cpu->r[12] = rbrew_read32(cpu->mem, _t291);
-        /* 021EE690 */ _t292 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EE690 */ _t292 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EE690 */ _t293 = _t292 & 0x00000001u;
         /* 021EE690 */ if (_t293) goto L_021EE694; else goto L_021EE698;
   L_021EE694: ; // 0x21ee694
@@ -4303,11 +4303,11 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
   L_021EE698: ; // 0x21ee698
         /* 021EE698 */ _t294 = cpu->r[1] + 0x000001DCu;
         /* 021EE698 */ rbrew_write32(cpu->mem, _t294, cpu->r[5]);
-        /* 021EE69C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000002u);
+        /* 021EE69C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000002u));
         /* 021EE6A0 */ cpu->r[6] = 0x00000002u;
         /* 021EE6A4 */ _t295 = cpu->r[1] + 0x0000013Cu;
         /* 021EE6A4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t295);
-        /* 021EE6A8 */ _t296 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EE6A8 */ _t296 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EE6A8 */ _t297 = _t296 & 0x00000001u;
         /* 021EE6A8 */ if (_t297) goto L_021EE6AC; else goto L_021EE6B0;
   L_021EE6AC: ; // 0x21ee6ac
@@ -4316,20 +4316,20 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EE6B0 */ _t298 = cpu->r[1] + 0x0000014Cu;
         /* 021EE6B0 */ rbrew_write32(cpu->mem, _t298, cpu->r[6]);
         /* 021EE6B4 */ cpu->r[7] = 0x00000002u;
-        /* 021EE6B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
+        /* 021EE6B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
         /* 021EE6BC */ _t299 = cpu->r[1] + 0x000000D4u;
         /* 021EE6BC */ cpu->r[6] = rbrew_read32(cpu->mem, _t299);
-        /* 021EE6C0 */ _t300 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EE6C0 */ _t300 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EE6C0 */ _t301 = _t300 & 0x00000001u;
         /* 021EE6C0 */ if (_t301) goto L_021EE6C4; else goto L_021EE6C8;
   L_021EE6C4: ; // 0x21ee6c4
         /* 021EE6C4 */ cpu->r[7] = cpu->r[0];
   L_021EE6C8: ; // 0x21ee6c8
-        /* 021EE6C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000002u);
+        /* 021EE6C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000002u));
         /* 021EE6CC */ cpu->r[0] = 0x00000002u;
         /* 021EE6D0 */ _t302 = cpu->r[1] + 0x0000013Cu;
         /* 021EE6D0 */ rbrew_write32(cpu->mem, _t302, cpu->r[7]);
-        /* 021EE6D4 */ _t303 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EE6D4 */ _t303 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EE6D4 */ _t304 = _t303 & 0x00000001u;
         /* 021EE6D4 */ if (_t304) goto L_021EE6D8; else goto L_021EE6DC;
   L_021EE6D8: ; // 0x21ee6d8
@@ -4346,14 +4346,14 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EE6F0 */ _t306 = cpu->r[29] + 0x00000004u;
         /* 021EE6F0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t306);
         /* 021EE6F0 */ cpu->r[29] = _t306;
-        /* 021EE6F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021EE6F8 */ _t307 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EE6F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021EE6F8 */ _t307 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EE6F8 */ _t308 = _t307 & 0x00000001u;
         /* 021EE6F8 */ if (_t308) goto L_021EE6FC; else goto L_021EF0C8;
   L_021EE6FC: ; // 0x21ee6fc
         /* 021EE6FC */ cpu->r[9] = cpu->r[27];
-        /* 021EE700 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000074u);
-        /* 021EE704 */ _t309 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EE700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000074u));
+        /* 021EE704 */ _t309 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EE704 */ _t310 = _t309 & 0x00000001u;
         /* 021EE704 */ if (_t310) goto L_021EF0C8; else goto L_021EE708;
   L_021EE708: ; // 0x21ee708
@@ -4364,9 +4364,9 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EE718 */ rbrew_dispatch(cpu, cpu->ctr); return;
   L_021EF0C8: ; // 0x21ef0c8
         /* 021EF0C8 */ cpu->r[28] = cpu->r[28] + 0xFFFFFFFFu;
-        /* 021EF0C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 021EF0C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 021EF0CC */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 021EF0D0 */ _t311 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF0D0 */ _t311 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF0D0 */ _t312 = _t311 & 0x00000001u;
         /* 021EF0D0 */ if (_t312) goto L_021EF0D4; else goto L_021EE6F0;
   L_021EF0D4: ; // 0x21ef0d4
@@ -4426,10 +4426,10 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EF184 */ _t319 = cpu->r[7] + 0x00000004u;
         /* 021EF184 */ rbrew_write32(cpu->mem, _t319, cpu->r[9]);
         /* 021EF184 */ cpu->r[7] = _t319;
-        /* 021EF188 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021EF188 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021EF18C */ _t320 = cpu->r[9] + 0x0000002Cu;
         /* 021EF18C */ rbrew_write32(cpu->mem, _t320, cpu->r[30]);
-        /* 021EF190 */ _t321 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF190 */ _t321 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF190 */ _t322 = _t321 & 0x00000001u;
         /* 021EF190 */ if (_t322) goto L_021EF194; else goto L_021EF19C;
   L_021EF194: ; // 0x21ef194
@@ -4448,10 +4448,10 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
   L_021EF1A8: ; // 0x21ef1a8
         /* 021EF1A8 */ cpu->r[12] = cpu->r[12] + 0x00000008u;
         /* 021EF1AC */ cpu->r[6] = cpu->r[6] + 0xFFFFFFFFu;
-        /* 021EF1AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 021EF1AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 021EF1B0 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
         /* 021EF1B4 */ cpu->r[5] = cpu->r[5] + 0x00000002u;
-        /* 021EF1B8 */ _t328 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF1B8 */ _t328 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF1B8 */ _t329 = _t328 & 0x00000001u;
         /* 021EF1B8 */ if (_t329) goto L_021EF1BC; else goto L_021EF148;
   L_021EF1BC: ; // 0x21ef1bc
@@ -4472,8 +4472,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EF1E8 */ cpu->r[5] = cpu->r[12];
   L_021EF1EC: ; // 0x21ef1ec
         /* 021EF1EC */ cpu->r[10] = cpu->r[3] + cpu->r[12];
-        /* 021EF1EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021EF1F0 */ _t333 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF1EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021EF1F0 */ _t333 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF1F0 */ _t334 = _t333 & 0x00000001u;
         /* 021EF1F0 */ if (_t334) goto L_021EF1FC; else goto L_021EF1F4;
   L_021EF1F4: ; // 0x21ef1f4
@@ -4489,8 +4489,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EF200 */ _t339 = _t338 & 0x00000001u;
         /* 021EF200 */ if (_t339) goto L_021EF1EC; else goto L_021EF204;
   L_021EF204: ; // 0x21ef204
-        /* 021EF204 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021EF208 */ _t340 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF204 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021EF208 */ _t340 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF208 */ _t341 = _t340 & 0x00000001u;
         /* 021EF208 */ if (_t341) goto L_021EF20C; else goto L_021EF228;
   L_021EF20C: ; // 0x21ef20c
@@ -4500,8 +4500,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EF210 */ cpu->r[3] = rbrew_read32(cpu->mem, _t343);
         /* 021EF214 */ cpu->r[0] = rbrew_rlwinm(cpu->r[11], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 021EF218 */ cpu->r[7] = cpu->r[3] + cpu->r[0];
-        /* 021EF21C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], cpu->r[7]);
-        /* 021EF220 */ _t344 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF21C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], cpu->r[7]));
+        /* 021EF220 */ _t344 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF220 */ _t345 = _t344 & 0x00000001u;
         /* 021EF220 */ if (_t345) goto L_021EF3D8; else goto L_021EF224;
   L_021EF224: ; // 0x21ef224
@@ -4511,10 +4511,10 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EF22C */ cpu->r[7] = cpu->r[3] + 0x00000040u;
         /* 021EF230 */ _t346 = cpu->r[17] + 0x00000248u;
         /* 021EF230 */ rbrew_write32(cpu->mem, _t346, cpu->r[0]);
-        /* 021EF234 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], cpu->r[7]);
+        /* 021EF234 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], cpu->r[7]));
         /* 021EF238 */ _t347 = cpu->r[17] + 0x0000024Cu;
         /* 021EF238 */ rbrew_write32(cpu->mem, _t347, cpu->r[3]);
-        /* 021EF23C */ _t348 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF23C */ _t348 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF23C */ _t349 = _t348 & 0x00000001u;
         /* 021EF23C */ if (_t349) goto L_021EF3D8; else goto L_021EF240;
   L_021EF240: ; // 0x21ef240
@@ -4538,8 +4538,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EF274 */ cpu->r[6] = cpu->r[4];
   L_021EF278: ; // 0x21ef278
         /* 021EF278 */ cpu->r[12] = cpu->r[3] + cpu->r[4];
-        /* 021EF278 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021EF27C */ _t353 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF278 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021EF27C */ _t353 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF27C */ _t354 = _t353 & 0x00000001u;
         /* 021EF27C */ if (_t354) goto L_021EF288; else goto L_021EF280;
   L_021EF280: ; // 0x21ef280
@@ -4555,8 +4555,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EF28C */ _t359 = _t358 & 0x00000001u;
         /* 021EF28C */ if (_t359) goto L_021EF278; else goto L_021EF290;
   L_021EF290: ; // 0x21ef290
-        /* 021EF290 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021EF294 */ _t360 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF290 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021EF294 */ _t360 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF294 */ _t361 = _t360 & 0x00000001u;
         /* 021EF294 */ if (_t361) goto L_021EF2A4; else goto L_021EF298;
   L_021EF298: ; // 0x21ef298
@@ -4572,8 +4572,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EF2A8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t365);
         /* 021EF2AC */ cpu->r[9] = (uint32_t)((int32_t)cpu->r[9] * (int32_t)0x0000000Cu);
         /* 021EF2B0 */ cpu->r[0] = cpu->r[10] + cpu->r[9];
-        /* 021EF2B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[0]);
-        /* 021EF2B8 */ _t366 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF2B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[0]));
+        /* 021EF2B8 */ _t366 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF2B8 */ _t367 = _t366 & 0x00000001u;
         /* 021EF2B8 */ if (_t367) goto L_021EF3CC; else goto L_021EF2BC;
   L_021EF2BC: ; // 0x21ef2bc
@@ -4592,15 +4592,15 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EF2E8 */ cpu->r[5] = rbrew_rlwinm(cpu->r[0], 0x0000001Eu, 0x00000002u, 0x0000001Eu);
         /* 021EF2EC */ _t368 = cpu->r[5] + cpu->r[16];
         /* 021EF2EC */ cpu->r[12] = rbrew_read16(cpu->mem, _t368);
-        /* 021EF2F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021EF2F4 */ _t369 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF2F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021EF2F4 */ _t369 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF2F4 */ _t370 = _t369 & 0x00000001u;
         /* 021EF2F4 */ if (_t370) goto L_021EF3BC; else goto L_021EF2F8;
   L_021EF2F8: ; // 0x21ef2f8
         /* 021EF2F8 */ cpu->r[19] = cpu->r[12];
-        /* 021EF2F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[19], 0x00000000u);
+        /* 021EF2F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[19], 0x00000000u));
         /* 021EF2FC */ cpu->r[18] = cpu->r[25] + 0x00000004u;
-        /* 021EF300 */ _t371 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EF300 */ _t371 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EF300 */ _t372 = _t371 & 0x00000001u;
         /* 021EF300 */ if (_t372) goto L_021EF304; else goto L_021EF380;
   L_021EF304: ; // 0x21ef304
@@ -4616,10 +4616,10 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EF31C */ cpu->r[4] = rbrew_rlwinm(cpu->r[19], 0x00000004u, 0x00000000u, 0x0000001Bu);
         /* 021EF320 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021EF324 */ cpu->r[20] = cpu->r[3];
-        /* 021EF328 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[19], 0x00000000u);
+        /* 021EF328 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[19], 0x00000000u));
         /* 021EF32C */ cpu->r[11] = cpu->r[19];
         /* 021EF330 */ cpu->r[12] = 0x00000000u;
-        /* 021EF334 */ _t376 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EF334 */ _t376 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EF334 */ _t377 = _t376 & 0x00000001u;
         /* 021EF334 */ if (_t377) goto L_021EF33C; else goto L_021EF338;
   L_021EF338: ; // 0x21ef338
@@ -4630,14 +4630,14 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EF344 */ cpu->r[22] = cpu->r[11];
   L_021EF348: ; // 0x21ef348
         /* 021EF348 */ cpu->r[0] = cpu->r[20] + cpu->r[23];
-        /* 021EF348 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021EF34C */ _t378 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF348 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021EF34C */ _t378 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF34C */ _t379 = _t378 & 0x00000001u;
         /* 021EF34C */ if (_t379) goto L_021EF364; else goto L_021EF350;
   L_021EF350: ; // 0x21ef350
         /* 021EF350 */ cpu->r[21] = cpu->r[0];
-        /* 021EF350 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 021EF354 */ _t380 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF350 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 021EF354 */ _t380 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF354 */ _t381 = _t380 & 0x00000001u;
         /* 021EF354 */ if (_t381) goto L_021EF358; else goto L_021EF360;
   L_021EF358: ; // 0x21ef358
@@ -4648,14 +4648,14 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EF360 */ rbrew_write32(cpu->mem, _t382, cpu->r[24]);
   L_021EF364: ; // 0x21ef364
         /* 021EF364 */ cpu->r[22] = cpu->r[22] + 0xFFFFFFFFu;
-        /* 021EF364 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
+        /* 021EF364 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
         /* 021EF368 */ cpu->r[23] = cpu->r[23] + 0x00000010u;
-        /* 021EF36C */ _t383 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF36C */ _t383 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF36C */ _t384 = _t383 & 0x00000001u;
         /* 021EF36C */ if (_t384) goto L_021EF370; else goto L_021EF348;
   L_021EF370: ; // 0x21ef370
-        /* 021EF370 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
-        /* 021EF374 */ _t385 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF370 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
+        /* 021EF374 */ _t385 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF374 */ _t386 = _t385 & 0x00000001u;
         /* 021EF374 */ if (_t386) goto L_021EF380; else goto L_021EF378;
   L_021EF378: ; // 0x21ef378
@@ -4670,8 +4670,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EF384 */ cpu->r[11] = rbrew_read32(cpu->mem, _t390);
         /* 021EF388 */ cpu->r[10] = rbrew_rlwinm(cpu->r[0], 0x00000004u, 0x00000000u, 0x0000001Bu);
         /* 021EF38C */ cpu->r[0] = cpu->r[11] + cpu->r[10];
-        /* 021EF390 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[0]);
-        /* 021EF394 */ _t391 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF390 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[0]));
+        /* 021EF394 */ _t391 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF394 */ _t392 = _t391 & 0x00000001u;
         /* 021EF394 */ if (_t392) goto L_021EF3BC; else goto L_021EF398;
   L_021EF398: ; // 0x21ef398
@@ -4688,22 +4688,22 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EF3AC */ _t397 = cpu->r[11] + 0x00000004u;
         /* 021EF3AC */ rbrew_write_f32(cpu->mem, _t397, cpu->f[0]);
         /* 021EF3B0 */ cpu->r[11] = cpu->r[11] + 0x00000010u;
-        /* 021EF3B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[0]);
-        /* 021EF3B8 */ _t398 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF3B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[0]));
+        /* 021EF3B8 */ _t398 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF3B8 */ _t399 = _t398 & 0x00000001u;
         /* 021EF3B8 */ if (_t399) goto L_021EF3BC; else goto L_021EF39C;
   L_021EF3BC: ; // 0x21ef3bc
         /* 021EF3BC */ _t400 = cpu->r[25] + 0x00000000u;
         /* 021EF3BC */ rbrew_write32(cpu->mem, _t400, cpu->r[28]);
         /* 021EF3C0 */ cpu->r[25] = cpu->r[25] + 0x0000000Cu;
-        /* 021EF3C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], cpu->r[27]);
-        /* 021EF3C8 */ _t401 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF3C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], cpu->r[27]));
+        /* 021EF3C8 */ _t401 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF3C8 */ _t402 = _t401 & 0x00000001u;
         /* 021EF3C8 */ if (_t402) goto L_021EF3CC; else goto L_021EF2D8;
   L_021EF3CC: ; // 0x21ef3cc
         /* 021EF3CC */ cpu->r[29] = cpu->r[29] + 0x00000008u;
-        /* 021EF3D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[30]);
-        /* 021EF3D4 */ _t403 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF3D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[30]));
+        /* 021EF3D4 */ _t403 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF3D4 */ _t404 = _t403 & 0x00000001u;
         /* 021EF3D4 */ if (_t404) goto L_021EF3D8; else goto L_021EF248;
   L_021EF3D8: ; // 0x21ef3d8
@@ -4723,8 +4723,8 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EF400 */ cpu->ctr = cpu->r[0];
         /* 021EF404 */ cpu->r[3] = cpu->r[15];
         /* 021EF408 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021EF40C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[14], 0x00000001u);
-        /* 021EF410 */ _t408 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF40C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[14], 0x00000001u));
+        /* 021EF410 */ _t408 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF410 */ _t409 = _t408 & 0x00000001u;
         /* 021EF410 */ if (_t409) goto L_021EF420; else goto L_021EF414;
   L_021EF414: ; // 0x21ef414
@@ -4743,7 +4743,7 @@ void Gambit_fn_021ED2EC(CPUState* cpu) {
         /* 021EF430 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t413);
         /* 021EF434 */ _t414 = cpu->r[1] + 0x00000288u;
         /* 021EF434 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t414);
-        /* 021EF438 */ _t415 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EF438 */ _t415 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EF438 */ _t416 = _t415 & 0x00000001u;
         /* 021EF438 */ if (_t416) goto L_021EF43C; // else: addr-0 trap, fall-through
   L_021EF43C: ; // 0x21ef43c
@@ -4789,10 +4789,10 @@ void Gambit_fn_021EF44C(CPUState* cpu) {
         /* 021EF494 */ rbrew_write32(cpu->mem, _t7, cpu->r[0]);
         /* 021EF498 */ Gambit_fn_02822458(cpu);
         /* 021EF49C */ cpu->r[28] = cpu->r[3];
-        /* 021EF49C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 021EF49C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 021EF4A0 */ cpu->r[31] = 0x00000001u;
         /* 021EF4A4 */ cpu->r[29] = 0x101D0000u;
-        /* 021EF4A8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF4A8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF4A8 */ _t9 = _t8 & 0x00000001u;
         /* 021EF4A8 */ if (_t9) goto L_021EF4BC; else goto L_021EF4AC;
   L_021EF4AC: ; // 0x21ef4ac
@@ -4829,8 +4829,8 @@ void Gambit_fn_021EF44C(CPUState* cpu) {
         /* 021EF4FC */ cpu->ctr = cpu->r[0];
         /* 021EF500 */ cpu->r[3] = cpu->r[28];
         /* 021EF504 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021EF508 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000001u);
-        /* 021EF50C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF508 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000001u));
+        /* 021EF50C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF50C */ _t20 = _t19 & 0x00000001u;
         /* 021EF50C */ if (_t20) goto L_021EF51C; else goto L_021EF510;
   L_021EF510: ; // 0x21ef510
@@ -4888,10 +4888,10 @@ void Gambit_fn_021EF450(CPUState* cpu) {
         /* 021EF494 */ rbrew_write32(cpu->mem, _t7, cpu->r[0]);
         /* 021EF498 */ Gambit_fn_02822458(cpu);
         /* 021EF49C */ cpu->r[28] = cpu->r[3];
-        /* 021EF49C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 021EF49C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 021EF4A0 */ cpu->r[31] = 0x00000001u;
         /* 021EF4A4 */ cpu->r[29] = 0x101D0000u;
-        /* 021EF4A8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF4A8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF4A8 */ _t9 = _t8 & 0x00000001u;
         /* 021EF4A8 */ if (_t9) goto L_021EF4BC; else goto L_021EF4AC;
   L_021EF4AC: ; // 0x21ef4ac
@@ -4928,8 +4928,8 @@ void Gambit_fn_021EF450(CPUState* cpu) {
         /* 021EF4FC */ cpu->ctr = cpu->r[0];
         /* 021EF500 */ cpu->r[3] = cpu->r[28];
         /* 021EF504 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021EF508 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000001u);
-        /* 021EF50C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF508 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000001u));
+        /* 021EF50C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF50C */ _t20 = _t19 & 0x00000001u;
         /* 021EF50C */ if (_t20) goto L_021EF51C; else goto L_021EF510;
   L_021EF510: ; // 0x21ef510
@@ -4970,8 +4970,8 @@ void Gambit_fn_021EF53C(CPUState* cpu) {
         /* 021EF550 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021EF554 */ _t3 = cpu->r[3] + 0x000054F4u;
         /* 021EF554 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
-        /* 021EF558 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021EF55C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF558 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021EF55C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF55C */ _t5 = _t4 & 0x00000001u;
         /* 021EF55C */ if (_t5) goto L_021EF564; else goto L_021EF560;
   L_021EF560: ; // 0x21ef560
@@ -5022,8 +5022,8 @@ void Gambit_fn_021EF540(CPUState* cpu) {
         /* 021EF550 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021EF554 */ _t3 = cpu->r[3] + 0x000054F4u;
         /* 021EF554 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
-        /* 021EF558 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021EF55C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF558 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021EF55C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF55C */ _t5 = _t4 & 0x00000001u;
         /* 021EF55C */ if (_t5) goto L_021EF564; else goto L_021EF560;
   L_021EF560: ; // 0x21ef560
@@ -5100,8 +5100,8 @@ void Gambit_fn_021EF5B0(CPUState* cpu) {
         /* 021EF608 */ _t11 = cpu->r[31] + 0x00005130u;
         /* 021EF608 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t11);
         /* 021EF608 */ cpu->r[31] = _t11;
-        /* 021EF60C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
-        /* 021EF610 */ _t12 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EF60C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
+        /* 021EF610 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EF610 */ _t13 = _t12 & 0x00000001u;
         /* 021EF610 */ if (_t13) goto L_021EF614; else goto L_021EF634;
   L_021EF614: ; // 0x21ef614
@@ -5169,8 +5169,8 @@ void Gambit_fn_021EF5B4(CPUState* cpu) {
         /* 021EF608 */ _t11 = cpu->r[31] + 0x00005130u;
         /* 021EF608 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t11);
         /* 021EF608 */ cpu->r[31] = _t11;
-        /* 021EF60C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
-        /* 021EF610 */ _t12 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EF60C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
+        /* 021EF610 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EF610 */ _t13 = _t12 & 0x00000001u;
         /* 021EF610 */ if (_t13) goto L_021EF614; else goto L_021EF634;
   L_021EF614: ; // 0x21ef614
@@ -5237,24 +5237,24 @@ void Gambit_fn_021EF64C(CPUState* cpu) {
   L_021EF6A4: ; // 0x21ef6a4
         /* 021EF6A4 */ _t8 = cpu->r[28] + cpu->r[29];
         /* 021EF6A4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t8);
-        /* 021EF6A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021EF6AC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF6A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021EF6AC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF6AC */ _t10 = _t9 & 0x00000001u;
         /* 021EF6AC */ if (_t10) goto L_021EF6B4; else goto L_021EF6B0;
   L_021EF6B0: ; // 0x21ef6b0
         /* 021EF6B0 */ Gambit_fn_02790488(cpu);
   L_021EF6B4: ; // 0x21ef6b4
         /* 021EF6B4 */ cpu->r[26] = cpu->r[26] + 0xFFFFFFFFu;
-        /* 021EF6B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021EF6B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021EF6B8 */ cpu->r[29] = cpu->r[29] + 0x00000004u;
-        /* 021EF6BC */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF6BC */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF6BC */ _t12 = _t11 & 0x00000001u;
         /* 021EF6BC */ if (_t12) goto L_021EF6C0; else goto L_021EF6A4;
   L_021EF6C0: ; // 0x21ef6c0
         /* 021EF6C0 */ cpu->r[27] = cpu->r[27] + 0xFFFFFFFFu;
-        /* 021EF6C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 021EF6C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 021EF6C4 */ cpu->r[30] = cpu->r[30] + 0x00000008u;
-        /* 021EF6C8 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF6C8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF6C8 */ _t14 = _t13 & 0x00000001u;
         /* 021EF6C8 */ if (_t14) goto L_021EF6CC; else goto L_021EF69C;
   L_021EF6CC: ; // 0x21ef6cc
@@ -5264,10 +5264,10 @@ void Gambit_fn_021EF64C(CPUState* cpu) {
         /* 021EF6D4 */ cpu->r[5] = 0x10040000u;
         /* 021EF6D8 */ _t16 = cpu->r[31] + 0x00000250u;
         /* 021EF6D8 */ rbrew_write32(cpu->mem, _t16, cpu->r[3]);
-        /* 021EF6DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021EF6DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021EF6E0 */ _t17 = cpu->r[5] + 0xFFFFC5B4u;
         /* 021EF6E0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t17);
-        /* 021EF6E4 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF6E4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF6E4 */ _t19 = _t18 & 0x00000001u;
         /* 021EF6E4 */ if (_t19) goto L_021EF780; else goto L_021EF6E8;
   L_021EF6E8: ; // 0x21ef6e8
@@ -5275,8 +5275,8 @@ void Gambit_fn_021EF64C(CPUState* cpu) {
         /* 021EF6E8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t20);
         /* 021EF6EC */ cpu->r[4] = rbrew_rlwinm(cpu->r[11], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 021EF6F0 */ cpu->r[0] = cpu->r[12] + cpu->r[4];
-        /* 021EF6F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
-        /* 021EF6F8 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF6F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
+        /* 021EF6F8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF6F8 */ _t22 = _t21 & 0x00000001u;
         /* 021EF6F8 */ if (_t22) goto L_021EF780; else goto L_021EF6FC;
   L_021EF6FC: ; // 0x21ef6fc
@@ -5288,8 +5288,8 @@ void Gambit_fn_021EF64C(CPUState* cpu) {
         /* 021EF704 */ cpu->r[10] = rbrew_read32(cpu->mem, _t24);
         /* 021EF708 */ cpu->r[5] = (uint32_t)((int32_t)cpu->r[11] * (int32_t)0x0000000Cu);
         /* 021EF70C */ cpu->r[9] = cpu->r[10] + cpu->r[5];
-        /* 021EF710 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[9]);
-        /* 021EF714 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[9]));
+        /* 021EF714 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF714 */ _t26 = _t25 & 0x00000001u;
         /* 021EF714 */ if (_t26) goto L_021EF774; else goto L_021EF718;
   L_021EF718: ; // 0x21ef718
@@ -5297,9 +5297,9 @@ void Gambit_fn_021EF64C(CPUState* cpu) {
   L_021EF71C: ; // 0x21ef71c
         /* 021EF71C */ _t27 = cpu->r[10] + 0x00000008u;
         /* 021EF71C */ cpu->r[6] = rbrew_read32(cpu->mem, _t27);
-        /* 021EF720 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 021EF720 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 021EF724 */ cpu->r[8] = cpu->r[10] + 0x00000004u;
-        /* 021EF728 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF728 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF728 */ _t29 = _t28 & 0x00000001u;
         /* 021EF728 */ if (_t29) goto L_021EF768; else goto L_021EF72C;
   L_021EF72C: ; // 0x21ef72c
@@ -5309,8 +5309,8 @@ void Gambit_fn_021EF64C(CPUState* cpu) {
         /* 021EF730 */ cpu->r[8] = rbrew_read32(cpu->mem, _t31);
         /* 021EF734 */ cpu->r[6] = rbrew_rlwinm(cpu->r[5], 0x00000004u, 0x00000000u, 0x0000001Bu);
         /* 021EF738 */ cpu->r[7] = cpu->r[8] + cpu->r[6];
-        /* 021EF73C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
-        /* 021EF740 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF73C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
+        /* 021EF740 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF740 */ _t33 = _t32 & 0x00000001u;
         /* 021EF740 */ if (_t33) goto L_021EF768; else goto L_021EF744;
   L_021EF744: ; // 0x21ef744
@@ -5327,20 +5327,20 @@ void Gambit_fn_021EF64C(CPUState* cpu) {
         /* 021EF758 */ _t38 = cpu->r[8] + 0x00000004u;
         /* 021EF758 */ rbrew_write_f32(cpu->mem, _t38, cpu->f[12]);
         /* 021EF75C */ cpu->r[8] = cpu->r[8] + 0x00000010u;
-        /* 021EF760 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
-        /* 021EF764 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF760 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
+        /* 021EF764 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF764 */ _t40 = _t39 & 0x00000001u;
         /* 021EF764 */ if (_t40) goto L_021EF768; else goto L_021EF748;
   L_021EF768: ; // 0x21ef768
         /* 021EF768 */ cpu->r[10] = cpu->r[10] + 0x0000000Cu;
-        /* 021EF76C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[9]);
-        /* 021EF770 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF76C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[9]));
+        /* 021EF770 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF770 */ _t42 = _t41 & 0x00000001u;
         /* 021EF770 */ if (_t42) goto L_021EF774; else goto L_021EF71C;
   L_021EF774: ; // 0x21ef774
         /* 021EF774 */ cpu->r[12] = cpu->r[12] + 0x00000008u;
-        /* 021EF778 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
-        /* 021EF77C */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF778 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
+        /* 021EF77C */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF77C */ _t44 = _t43 & 0x00000001u;
         /* 021EF77C */ if (_t44) goto L_021EF780; else goto L_021EF700;
   L_021EF780: ; // 0x21ef780
@@ -5396,8 +5396,8 @@ void Gambit_fn_021EF7C0(CPUState* cpu) {
         /* 021EF7E0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t3);
         /* 021EF7E4 */ _t4 = cpu->r[7] + 0x0000002Cu;
         /* 021EF7E4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t4);
-        /* 021EF7E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], cpu->r[11]);
-        /* 021EF7EC */ _t5 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EF7E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], cpu->r[11]));
+        /* 021EF7EC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EF7EC */ _t6 = _t5 & 0x00000001u;
         /* 021EF7EC */ if (_t6) goto L_021EF7F0; else goto L_021EF8D4;
   L_021EF7F0: ; // 0x21ef7f0
@@ -5410,39 +5410,39 @@ void Gambit_fn_021EF7C0(CPUState* cpu) {
         /* 021EF800 */ cpu->r[31] = rbrew_read32(cpu->mem, _t7);
         /* 021EF804 */ _t8 = cpu->r[31] + 0x0000001Cu;
         /* 021EF804 */ cpu->r[8] = rbrew_read32(cpu->mem, _t8);
-        /* 021EF808 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000002u);
-        /* 021EF80C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF808 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000002u));
+        /* 021EF80C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF80C */ _t10 = _t9 & 0x00000001u;
         /* 021EF80C */ if (_t10) goto L_021EF818; else goto L_021EF810;
   L_021EF810: ; // 0x21ef810
-        /* 021EF810 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000003u);
-        /* 021EF814 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF810 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000003u));
+        /* 021EF814 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF814 */ _t12 = _t11 & 0x00000001u;
         /* 021EF814 */ if (_t12) goto L_021EF818; else goto L_021EF8B8;
   L_021EF818: ; // 0x21ef818
         /* 021EF818 */ _t13 = cpu->r[31] + 0x00000020u;
         /* 021EF818 */ cpu->r[9] = rbrew_read32(cpu->mem, _t13);
-        /* 021EF81C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x0000007Au);
-        /* 021EF820 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF81C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x0000007Au));
+        /* 021EF820 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF820 */ _t15 = _t14 & 0x00000001u;
         /* 021EF820 */ if (_t15) goto L_021EF8B8; else goto L_021EF824;
   L_021EF824: ; // 0x21ef824
-        /* 021EF824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000056u);
-        /* 021EF828 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000056u));
+        /* 021EF828 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF828 */ _t17 = _t16 & 0x00000001u;
         /* 021EF828 */ if (_t17) goto L_021EF8B8; else goto L_021EF82C;
   L_021EF82C: ; // 0x21ef82c
         /* 021EF82C */ _t18 = cpu->r[31] + 0x00000020u;
         /* 021EF82C */ cpu->r[12] = rbrew_read32(cpu->mem, _t18);
-        /* 021EF830 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000057u);
-        /* 021EF834 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF830 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000057u));
+        /* 021EF834 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF834 */ _t20 = _t19 & 0x00000001u;
         /* 021EF834 */ if (_t20) goto L_021EF8B8; else goto L_021EF838;
   L_021EF838: ; // 0x21ef838
         /* 021EF838 */ _t21 = cpu->r[27] + 0xFFFFD9ECu;
         /* 021EF838 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
-        /* 021EF83C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021EF840 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF83C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021EF840 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF840 */ _t23 = _t22 & 0x00000001u;
         /* 021EF840 */ if (_t23) goto L_021EF844; else goto L_021EF854;
   L_021EF844: ; // 0x21ef844
@@ -5453,8 +5453,8 @@ void Gambit_fn_021EF7C0(CPUState* cpu) {
         /* 021EF850 */ _t25 = cpu->r[30] + 0xFFFFFB4Cu;
         /* 021EF850 */ rbrew_write32(cpu->mem, _t25, cpu->r[7]);
   L_021EF854: ; // 0x21ef854
-        /* 021EF854 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021EF858 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF854 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021EF858 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF858 */ _t27 = _t26 & 0x00000001u;
         /* 021EF858 */ if (_t27) goto L_021EF8A0; else goto L_021EF85C;
   L_021EF85C: ; // 0x21ef85c
@@ -5466,13 +5466,13 @@ void Gambit_fn_021EF7C0(CPUState* cpu) {
         /* 021EF868 */ cpu->r[3] = cpu->r[31];
         /* 021EF86C */ cpu->r[4] = cpu->r[30] + 0xFFFFFB4Cu;
         /* 021EF870 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021EF874 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021EF878 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF874 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021EF878 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF878 */ _t31 = _t30 & 0x00000001u;
         /* 021EF878 */ if (_t31) goto L_021EF8A0; else goto L_021EF87C;
   L_021EF87C: ; // 0x21ef87c
-        /* 021EF87C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021EF880 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF87C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021EF880 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF880 */ _t33 = _t32 & 0x00000001u;
         /* 021EF880 */ if (_t33) goto L_021EF8A0; else goto L_021EF884;
   L_021EF884: ; // 0x21ef884
@@ -5485,8 +5485,8 @@ void Gambit_fn_021EF7C0(CPUState* cpu) {
         /* 021EF890 */ Gambit_fn_0261F55C(cpu);
         /* 021EF894 */ _t37 = cpu->r[3] + 0x00000489u;
         /* 021EF894 */ cpu->r[11] = rbrew_read8(cpu->mem, _t37);
-        /* 021EF898 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021EF89C */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF898 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021EF89C */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF89C */ _t39 = _t38 & 0x00000001u;
         /* 021EF89C */ if (_t39) goto L_021EF8A0; else goto L_021EF8B8;
   L_021EF8A0: ; // 0x21ef8a0
@@ -5506,8 +5506,8 @@ void Gambit_fn_021EF7C0(CPUState* cpu) {
         /* 021EF8C4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t42);
         /* 021EF8C8 */ _t43 = cpu->r[7] + 0x0000002Cu;
         /* 021EF8C8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t43);
-        /* 021EF8CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[0]);
-        /* 021EF8D0 */ _t44 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EF8CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[0]));
+        /* 021EF8D0 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EF8D0 */ _t45 = _t44 & 0x00000001u;
         /* 021EF8D0 */ if (_t45) goto L_021EF800; else goto L_021EF8D4;
   L_021EF8D4: ; // 0x21ef8d4
@@ -5546,8 +5546,8 @@ void Gambit_fn_021EF8EC(CPUState* cpu) {
         /* 021EF914 */ cpu->r[9] = rbrew_read32(cpu->mem, _t6);
         /* 021EF918 */ _t7 = cpu->r[11] + 0x0000002Cu;
         /* 021EF918 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
-        /* 021EF91C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], cpu->r[10]);
-        /* 021EF920 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EF91C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], cpu->r[10]));
+        /* 021EF920 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EF920 */ _t9 = _t8 & 0x00000001u;
         /* 021EF920 */ if (_t9) goto L_021EF924; else goto L_021EF9E0;
   L_021EF924: ; // 0x21ef924
@@ -5559,32 +5559,32 @@ void Gambit_fn_021EF8EC(CPUState* cpu) {
         /* 021EF930 */ cpu->r[3] = rbrew_read32(cpu->mem, _t10);
         /* 021EF934 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021EF934 */ cpu->r[0] = rbrew_read32(cpu->mem, _t11);
-        /* 021EF938 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021EF93C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF938 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021EF93C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF93C */ _t13 = _t12 & 0x00000001u;
         /* 021EF93C */ if (_t13) goto L_021EF948; else goto L_021EF940;
   L_021EF940: ; // 0x21ef940
-        /* 021EF940 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021EF944 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021EF944 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF944 */ _t15 = _t14 & 0x00000001u;
         /* 021EF944 */ if (_t15) goto L_021EF948; else goto L_021EF9C4;
   L_021EF948: ; // 0x21ef948
         /* 021EF948 */ _t16 = cpu->r[3] + 0x00000020u;
         /* 021EF948 */ cpu->r[8] = rbrew_read32(cpu->mem, _t16);
-        /* 021EF94C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x0000007Au);
-        /* 021EF950 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF94C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x0000007Au));
+        /* 021EF950 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF950 */ _t18 = _t17 & 0x00000001u;
         /* 021EF950 */ if (_t18) goto L_021EF9C4; else goto L_021EF954;
   L_021EF954: ; // 0x21ef954
-        /* 021EF954 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000056u);
-        /* 021EF958 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF954 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000056u));
+        /* 021EF958 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF958 */ _t20 = _t19 & 0x00000001u;
         /* 021EF958 */ if (_t20) goto L_021EF9C4; else goto L_021EF95C;
   L_021EF95C: ; // 0x21ef95c
         /* 021EF95C */ _t21 = cpu->r[3] + 0x00000020u;
         /* 021EF95C */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
-        /* 021EF960 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000057u);
-        /* 021EF964 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF960 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000057u));
+        /* 021EF964 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF964 */ _t23 = _t22 & 0x00000001u;
         /* 021EF964 */ if (_t23) goto L_021EF9C4; else goto L_021EF968;
   L_021EF968: ; // 0x21ef968
@@ -5595,8 +5595,8 @@ void Gambit_fn_021EF8EC(CPUState* cpu) {
         /* 021EF970 */ cpu->ctr = cpu->r[0];
         /* 021EF974 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021EF978 */ cpu->r[4] = cpu->r[3];
-        /* 021EF978 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 021EF97C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF978 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 021EF97C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF97C */ _t27 = _t26 & 0x00000001u;
         /* 021EF97C */ if (_t27) goto L_021EF9C4; else goto L_021EF980;
   L_021EF980: ; // 0x21ef980
@@ -5604,10 +5604,10 @@ void Gambit_fn_021EF8EC(CPUState* cpu) {
         /* 021EF984 */ Gambit_fn_0200D450(cpu);
         /* 021EF988 */ _t28 = cpu->r[30] + 0xFFFFFD8Cu;
         /* 021EF988 */ cpu->r[8] = rbrew_read32(cpu->mem, _t28);
-        /* 021EF98C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021EF98C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021EF990 */ _t29 = cpu->r[1] + 0x00000014u;
         /* 021EF990 */ cpu->r[3] = rbrew_read32(cpu->mem, _t29);
-        /* 021EF994 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF994 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF994 */ _t31 = _t30 & 0x00000001u;
         /* 021EF994 */ if (_t31) goto L_021EF998; else goto L_021EF9A8;
   L_021EF998: ; // 0x21ef998
@@ -5618,8 +5618,8 @@ void Gambit_fn_021EF8EC(CPUState* cpu) {
         /* 021EF9A4 */ _t33 = cpu->r[29] + 0xFFFFFD88u;
         /* 021EF9A4 */ rbrew_write32(cpu->mem, _t33, cpu->r[9]);
   L_021EF9A8: ; // 0x21ef9a8
-        /* 021EF9A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021EF9AC */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF9A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021EF9AC */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF9AC */ _t35 = _t34 & 0x00000001u;
         /* 021EF9AC */ if (_t35) goto L_021EF9C4; else goto L_021EF9B0;
   L_021EF9B0: ; // 0x21ef9b0
@@ -5639,8 +5639,8 @@ void Gambit_fn_021EF8EC(CPUState* cpu) {
         /* 021EF9D0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t39);
         /* 021EF9D4 */ _t40 = cpu->r[11] + 0x0000002Cu;
         /* 021EF9D4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t40);
-        /* 021EF9D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[0]);
-        /* 021EF9DC */ _t41 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EF9D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[0]));
+        /* 021EF9DC */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EF9DC */ _t42 = _t41 & 0x00000001u;
         /* 021EF9DC */ if (_t42) goto L_021EF930; else goto L_021EF9E0;
   L_021EF9E0: ; // 0x21ef9e0
@@ -5682,8 +5682,8 @@ void Gambit_fn_021EF8F0(CPUState* cpu) {
         /* 021EF914 */ cpu->r[9] = rbrew_read32(cpu->mem, _t6);
         /* 021EF918 */ _t7 = cpu->r[11] + 0x0000002Cu;
         /* 021EF918 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
-        /* 021EF91C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], cpu->r[10]);
-        /* 021EF920 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EF91C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], cpu->r[10]));
+        /* 021EF920 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EF920 */ _t9 = _t8 & 0x00000001u;
         /* 021EF920 */ if (_t9) goto L_021EF924; else goto L_021EF9E0;
   L_021EF924: ; // 0x21ef924
@@ -5695,32 +5695,32 @@ void Gambit_fn_021EF8F0(CPUState* cpu) {
         /* 021EF930 */ cpu->r[3] = rbrew_read32(cpu->mem, _t10);
         /* 021EF934 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021EF934 */ cpu->r[0] = rbrew_read32(cpu->mem, _t11);
-        /* 021EF938 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021EF93C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF938 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021EF93C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF93C */ _t13 = _t12 & 0x00000001u;
         /* 021EF93C */ if (_t13) goto L_021EF948; else goto L_021EF940;
   L_021EF940: ; // 0x21ef940
-        /* 021EF940 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021EF944 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021EF944 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF944 */ _t15 = _t14 & 0x00000001u;
         /* 021EF944 */ if (_t15) goto L_021EF948; else goto L_021EF9C4;
   L_021EF948: ; // 0x21ef948
         /* 021EF948 */ _t16 = cpu->r[3] + 0x00000020u;
         /* 021EF948 */ cpu->r[8] = rbrew_read32(cpu->mem, _t16);
-        /* 021EF94C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x0000007Au);
-        /* 021EF950 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF94C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x0000007Au));
+        /* 021EF950 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF950 */ _t18 = _t17 & 0x00000001u;
         /* 021EF950 */ if (_t18) goto L_021EF9C4; else goto L_021EF954;
   L_021EF954: ; // 0x21ef954
-        /* 021EF954 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000056u);
-        /* 021EF958 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF954 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000056u));
+        /* 021EF958 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF958 */ _t20 = _t19 & 0x00000001u;
         /* 021EF958 */ if (_t20) goto L_021EF9C4; else goto L_021EF95C;
   L_021EF95C: ; // 0x21ef95c
         /* 021EF95C */ _t21 = cpu->r[3] + 0x00000020u;
         /* 021EF95C */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
-        /* 021EF960 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000057u);
-        /* 021EF964 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF960 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000057u));
+        /* 021EF964 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF964 */ _t23 = _t22 & 0x00000001u;
         /* 021EF964 */ if (_t23) goto L_021EF9C4; else goto L_021EF968;
   L_021EF968: ; // 0x21ef968
@@ -5731,8 +5731,8 @@ void Gambit_fn_021EF8F0(CPUState* cpu) {
         /* 021EF970 */ cpu->ctr = cpu->r[0];
         /* 021EF974 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021EF978 */ cpu->r[4] = cpu->r[3];
-        /* 021EF978 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 021EF97C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF978 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 021EF97C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF97C */ _t27 = _t26 & 0x00000001u;
         /* 021EF97C */ if (_t27) goto L_021EF9C4; else goto L_021EF980;
   L_021EF980: ; // 0x21ef980
@@ -5740,10 +5740,10 @@ void Gambit_fn_021EF8F0(CPUState* cpu) {
         /* 021EF984 */ Gambit_fn_0200D450(cpu);
         /* 021EF988 */ _t28 = cpu->r[30] + 0xFFFFFD8Cu;
         /* 021EF988 */ cpu->r[8] = rbrew_read32(cpu->mem, _t28);
-        /* 021EF98C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021EF98C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021EF990 */ _t29 = cpu->r[1] + 0x00000014u;
         /* 021EF990 */ cpu->r[3] = rbrew_read32(cpu->mem, _t29);
-        /* 021EF994 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF994 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF994 */ _t31 = _t30 & 0x00000001u;
         /* 021EF994 */ if (_t31) goto L_021EF998; else goto L_021EF9A8;
   L_021EF998: ; // 0x21ef998
@@ -5754,8 +5754,8 @@ void Gambit_fn_021EF8F0(CPUState* cpu) {
         /* 021EF9A4 */ _t33 = cpu->r[29] + 0xFFFFFD88u;
         /* 021EF9A4 */ rbrew_write32(cpu->mem, _t33, cpu->r[9]);
   L_021EF9A8: ; // 0x21ef9a8
-        /* 021EF9A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021EF9AC */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EF9A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021EF9AC */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EF9AC */ _t35 = _t34 & 0x00000001u;
         /* 021EF9AC */ if (_t35) goto L_021EF9C4; else goto L_021EF9B0;
   L_021EF9B0: ; // 0x21ef9b0
@@ -5775,8 +5775,8 @@ void Gambit_fn_021EF8F0(CPUState* cpu) {
         /* 021EF9D0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t39);
         /* 021EF9D4 */ _t40 = cpu->r[11] + 0x0000002Cu;
         /* 021EF9D4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t40);
-        /* 021EF9D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[0]);
-        /* 021EF9DC */ _t41 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EF9D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[0]));
+        /* 021EF9DC */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EF9DC */ _t42 = _t41 & 0x00000001u;
         /* 021EF9DC */ if (_t42) goto L_021EF930; else goto L_021EF9E0;
   L_021EF9E0: ; // 0x21ef9e0
@@ -6488,15 +6488,15 @@ void Gambit_fn_021EFCC0(CPUState* cpu) {
         /* 021EFCE0 */ cpu->r[30] = cpu->r[3];
         /* 021EFCE4 */ _t4 = cpu->r[30] + 0x0000024Cu;
         /* 021EFCE4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t4);
-        /* 021EFCE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021EFCEC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EFCE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021EFCEC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EFCEC */ _t6 = _t5 & 0x00000001u;
         /* 021EFCEC */ if (_t6) goto L_021EFDB4; else goto L_021EFCF0;
   L_021EFCF0: ; // 0x21efcf0
         /* 021EFCF0 */ _t7 = cpu->r[30] + 0x00000248u;
         /* 021EFCF0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
-        /* 021EFCF4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021EFCF8 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EFCF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021EFCF8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EFCF8 */ _t9 = _t8 & 0x00000001u;
         /* 021EFCF8 */ if (_t9) goto L_021EFCFC; else goto L_021EFD04;
   L_021EFCFC: ; // 0x21efcfc
@@ -6505,10 +6505,10 @@ void Gambit_fn_021EFCC0(CPUState* cpu) {
   L_021EFD04: ; // 0x21efd04
         /* 021EFD04 */ _t10 = cpu->r[12] + 0x00000000u;
         /* 021EFD04 */ cpu->r[11] = rbrew_read32(cpu->mem, _t10);
-        /* 021EFD08 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[11]);
+        /* 021EFD08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[11]));
         /* 021EFD0C */ _t11 = cpu->r[12] + 0x00000004u;
         /* 021EFD0C */ cpu->r[31] = rbrew_read32(cpu->mem, _t11);
-        /* 021EFD10 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EFD10 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EFD10 */ _t13 = _t12 & 0x00000001u;
         /* 021EFD10 */ if (_t13) goto L_021EFD14; else goto L_021EFD1C;
   L_021EFD14: ; // 0x21efd14
@@ -6517,8 +6517,8 @@ void Gambit_fn_021EFCC0(CPUState* cpu) {
   L_021EFD1C: ; // 0x21efd1c
         /* 021EFD1C */ _t14 = cpu->r[31] + 0x00000008u;
         /* 021EFD1C */ cpu->r[9] = rbrew_read32(cpu->mem, _t14);
-        /* 021EFD20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 021EFD24 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EFD20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 021EFD24 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EFD24 */ _t16 = _t15 & 0x00000001u;
         /* 021EFD24 */ if (_t16) goto L_021EFDB4; else goto L_021EFD28;
   L_021EFD28: ; // 0x21efd28
@@ -6533,8 +6533,8 @@ void Gambit_fn_021EFCC0(CPUState* cpu) {
         /* 021EFD40 */ cpu->r[27] = cpu->r[28];
   L_021EFD44: ; // 0x21efd44
         /* 021EFD44 */ cpu->r[28] = cpu->r[28] + 0xFFFFFFF0u;
-        /* 021EFD48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[26]);
-        /* 021EFD4C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EFD48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[26]));
+        /* 021EFD4C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EFD4C */ _t20 = _t19 & 0x00000001u;
         /* 021EFD4C */ if (_t20) goto L_021EFD50; else goto L_021EFD64;
   L_021EFD50: ; // 0x21efd50
@@ -6550,16 +6550,16 @@ void Gambit_fn_021EFCC0(CPUState* cpu) {
         /* 021EFD64 */ cpu->r[10] = rbrew_read32(cpu->mem, _t23);
         /* 021EFD68 */ _t24 = cpu->r[28] + 0x0000000Cu;
         /* 021EFD68 */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
-        /* 021EFD6C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[0]);
-        /* 021EFD70 */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EFD6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[0]));
+        /* 021EFD70 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EFD70 */ _t26 = _t25 & 0x00000001u;
         /* 021EFD70 */ if (_t26) goto L_021EFD74; else goto L_021EFDB4;
   L_021EFD74: ; // 0x21efd74
         /* 021EFD74 */ cpu->r[3] = cpu->r[28];
         /* 021EFD78 */ cpu->r[4] = cpu->r[29];
         /* 021EFD7C */ Gambit_fn_02C69328(cpu);
-        /* 021EFD80 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
-        /* 021EFD84 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EFD80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
+        /* 021EFD84 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EFD84 */ _t28 = _t27 & 0x00000001u;
         /* 021EFD84 */ if (_t28) goto L_021EFDAC; else goto L_021EFD88;
   L_021EFD88: ; // 0x21efd88
@@ -6569,7 +6569,7 @@ void Gambit_fn_021EFCC0(CPUState* cpu) {
         /* 021EFD90 */ _t30 = cpu->r[1] + 0x00000020u;
         /* 021EFD90 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t30);
         /* 021EFD94 */ cpu->r[3] = 0x00000000u;
-        /* 021EFD98 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EFD98 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EFD98 */ _t32 = _t31 & 0x00000001u;
         /* 021EFD98 */ if (_t32) goto L_021EFD9C; // else: addr-0 trap, fall-through
   L_021EFD9C: ; // 0x21efd9c
@@ -6579,8 +6579,8 @@ void Gambit_fn_021EFCC0(CPUState* cpu) {
         /* 021EFDA4 */ cpu->r[1] = cpu->r[1] + 0x00000030u;
         /* 021EFDA8 */ return;
   L_021EFDAC: ; // 0x21efdac
-        /* 021EFDAC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[27]);
-        /* 021EFDB0 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EFDAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[27]));
+        /* 021EFDB0 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EFDB0 */ _t35 = _t34 & 0x00000001u;
         /* 021EFDB0 */ if (_t35) goto L_021EFDB4; else goto L_021EFD44;
   L_021EFDB4: ; // 0x21efdb4
@@ -6590,7 +6590,7 @@ void Gambit_fn_021EFCC0(CPUState* cpu) {
         /* 021EFDBC */ _t37 = cpu->r[1] + 0x00000020u;
         /* 021EFDBC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t37);
         /* 021EFDC0 */ cpu->r[3] = 0x00000001u;
-        /* 021EFDC4 */ _t38 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EFDC4 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EFDC4 */ _t39 = _t38 & 0x00000001u;
         /* 021EFDC4 */ if (_t39) goto L_021EFDC8; // else: addr-0 trap, fall-through
   L_021EFDC8: ; // 0x21efdc8
@@ -6627,8 +6627,8 @@ void Gambit_fn_021EFDD8(CPUState* cpu) {
         /* 021EFE0C */ Gambit_fn_02019890(cpu);
         /* 021EFE10 */ _t4 = cpu->r[1] + 0x00000008u;
         /* 021EFE10 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
-        /* 021EFE14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 021EFE18 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EFE14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 021EFE18 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EFE18 */ _t6 = _t5 & 0x00000001u;
         /* 021EFE18 */ if (_t6) goto L_021EFF50; else goto L_021EFE1C;
   L_021EFE1C: ; // 0x21efe1c
@@ -6646,8 +6646,8 @@ void Gambit_fn_021EFDD8(CPUState* cpu) {
         /* 021EFE34 */ cpu->r[7] = rbrew_read32(cpu->mem, _t10);
         /* 021EFE38 */ _t11 = cpu->r[7] + 0x00000000u;
         /* 021EFE38 */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 021EFE3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x0000000Au);
-        /* 021EFE40 */ _t12 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EFE3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x0000000Au));
+        /* 021EFE40 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EFE40 */ _t13 = _t12 & 0x00000001u;
         /* 021EFE40 */ if (_t13) goto L_021EFE44; else goto L_021EFF50;
   L_021EFE44: ; // 0x21efe44
@@ -6688,32 +6688,32 @@ void Gambit_fn_021EFDD8(CPUState* cpu) {
         /* 021EFE9C */ cpu->r[10] = rbrew_read32(cpu->mem, _t24);
         /* 021EFEA0 */ cpu->r[29] = cpu->r[10] - cpu->r[30];
   L_021EFEA4: ; // 0x21efea4
-        /* 021EFEA4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[31]);
-        /* 021EFEA8 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EFEA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[31]));
+        /* 021EFEA8 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EFEA8 */ _t26 = _t25 & 0x00000001u;
         /* 021EFEA8 */ if (_t26) goto L_021EFEC0; else goto L_021EFEAC;
   L_021EFEAC: ; // 0x21efeac
         /* 021EFEAC */ _t27 = cpu->r[29] + 0x0000001Cu;
         /* 021EFEAC */ cpu->r[11] = rbrew_read32(cpu->mem, _t27);
-        /* 021EFEB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000002u);
-        /* 021EFEB4 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EFEB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000002u));
+        /* 021EFEB4 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EFEB4 */ _t29 = _t28 & 0x00000001u;
         /* 021EFEB4 */ if (_t29) goto L_021EFEC0; else goto L_021EFEB8;
   L_021EFEB8: ; // 0x21efeb8
-        /* 021EFEB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021EFEBC */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EFEB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021EFEBC */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EFEBC */ _t31 = _t30 & 0x00000001u;
         /* 021EFEBC */ if (_t31) goto L_021EFEC0; else goto L_021EFE98;
   L_021EFEC0: ; // 0x21efec0
-        /* 021EFEC0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[31]);
-        /* 021EFEC4 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EFEC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[31]));
+        /* 021EFEC4 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EFEC4 */ _t33 = _t32 & 0x00000001u;
         /* 021EFEC4 */ if (_t33) goto L_021EFF38; else goto L_021EFEC8;
   L_021EFEC8: ; // 0x21efec8
         /* 021EFEC8 */ _t34 = cpu->r[29] + 0x00000054u;
         /* 021EFEC8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t34);
-        /* 021EFECC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[25]);
-        /* 021EFED0 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EFECC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[25]));
+        /* 021EFED0 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EFED0 */ _t36 = _t35 & 0x00000001u;
         /* 021EFED0 */ if (_t36) goto L_021EFED4; else goto L_021EFF04;
   L_021EFED4: ; // 0x21efed4
@@ -6727,8 +6727,8 @@ void Gambit_fn_021EFDD8(CPUState* cpu) {
         /* 021EFEE8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021EFEEC */ cpu->r[4] = cpu->r[22];
         /* 021EFEF0 */ Gambit_fn_02C69328(cpu);
-        /* 021EFEF4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[1]);
-        /* 021EFEF8 */ _t39 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EFEF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[1]));
+        /* 021EFEF8 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EFEF8 */ _t40 = _t39 & 0x00000001u;
         /* 021EFEF8 */ if (_t40) goto L_021EFEFC; else goto L_021EFF04;
   L_021EFEFC: ; // 0x21efefc
@@ -6739,37 +6739,37 @@ void Gambit_fn_021EFDD8(CPUState* cpu) {
         /* 021EFF08 */ _t41 = cpu->r[9] + 0x00000004u;
         /* 021EFF08 */ cpu->r[0] = rbrew_read32(cpu->mem, _t41);
         /* 021EFF0C */ cpu->r[29] = cpu->r[0] - cpu->r[30];
-        /* 021EFF10 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[31]);
-        /* 021EFF14 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EFF10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[31]));
+        /* 021EFF14 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EFF14 */ _t43 = _t42 & 0x00000001u;
         /* 021EFF14 */ if (_t43) goto L_021EFF38; else goto L_021EFF18;
   L_021EFF18: ; // 0x21eff18
         /* 021EFF18 */ _t44 = cpu->r[29] + 0x0000001Cu;
         /* 021EFF18 */ cpu->r[0] = rbrew_read32(cpu->mem, _t44);
-        /* 021EFF1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021EFF20 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EFF1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021EFF20 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EFF20 */ _t46 = _t45 & 0x00000001u;
         /* 021EFF20 */ if (_t46) goto L_021EFF30; else goto L_021EFF24;
   L_021EFF24: ; // 0x21eff24
-        /* 021EFF24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021EFF28 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EFF24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021EFF28 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EFF28 */ _t48 = _t47 & 0x00000001u;
         /* 021EFF28 */ if (_t48) goto L_021EFF2C; else goto L_021EFF04;
   L_021EFF2C: ; // 0x21eff2c
         /* 021EFF2C */ goto L_021EFEC0;
   L_021EFF30: ; // 0x21eff30
-        /* 021EFF30 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[31]);
-        /* 021EFF34 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EFF30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[31]));
+        /* 021EFF34 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EFF34 */ _t50 = _t49 & 0x00000001u;
         /* 021EFF34 */ if (_t50) goto L_021EFF38; else goto L_021EFEC8;
   L_021EFF38: ; // 0x21eff38
-        /* 021EFF38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x0000000Au);
-        /* 021EFF3C */ _t51 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021EFF38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x0000000Au));
+        /* 021EFF3C */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021EFF3C */ _t52 = _t51 & 0x00000001u;
         /* 021EFF3C */ if (_t52) goto L_021EFF40; else goto L_021EFF50;
   L_021EFF40: ; // 0x21eff40
-        /* 021EFF40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
-        /* 021EFF44 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EFF40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
+        /* 021EFF44 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EFF44 */ _t54 = _t53 & 0x00000001u;
         /* 021EFF44 */ if (_t54) goto L_021EFF50; else goto L_021EFF48;
   L_021EFF48: ; // 0x21eff48
@@ -6778,15 +6778,15 @@ void Gambit_fn_021EFDD8(CPUState* cpu) {
   L_021EFF50: ; // 0x21eff50
         /* 021EFF50 */ _t55 = cpu->r[27] + 0x0000024Cu;
         /* 021EFF50 */ cpu->r[10] = rbrew_read32(cpu->mem, _t55);
-        /* 021EFF54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021EFF58 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EFF54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021EFF58 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EFF58 */ _t57 = _t56 & 0x00000001u;
         /* 021EFF58 */ if (_t57) goto L_021EFFEC; else goto L_021EFF5C;
   L_021EFF5C: ; // 0x21eff5c
         /* 021EFF5C */ _t58 = cpu->r[27] + 0x00000248u;
         /* 021EFF5C */ cpu->r[6] = rbrew_read32(cpu->mem, _t58);
-        /* 021EFF60 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], cpu->r[6]);
-        /* 021EFF64 */ _t59 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EFF60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], cpu->r[6]));
+        /* 021EFF64 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EFF64 */ _t60 = _t59 & 0x00000001u;
         /* 021EFF64 */ if (_t60) goto L_021EFF68; else goto L_021EFF70;
   L_021EFF68: ; // 0x21eff68
@@ -6795,10 +6795,10 @@ void Gambit_fn_021EFDD8(CPUState* cpu) {
   L_021EFF70: ; // 0x21eff70
         /* 021EFF70 */ _t61 = cpu->r[10] + 0x00000000u;
         /* 021EFF70 */ cpu->r[8] = rbrew_read32(cpu->mem, _t61);
-        /* 021EFF74 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], cpu->r[8]);
+        /* 021EFF74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], cpu->r[8]));
         /* 021EFF78 */ _t62 = cpu->r[10] + 0x00000004u;
         /* 021EFF78 */ cpu->r[12] = rbrew_read32(cpu->mem, _t62);
-        /* 021EFF7C */ _t63 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EFF7C */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EFF7C */ _t64 = _t63 & 0x00000001u;
         /* 021EFF7C */ if (_t64) goto L_021EFF80; else goto L_021EFF88;
   L_021EFF80: ; // 0x21eff80
@@ -6807,8 +6807,8 @@ void Gambit_fn_021EFDD8(CPUState* cpu) {
   L_021EFF88: ; // 0x21eff88
         /* 021EFF88 */ _t65 = cpu->r[12] + 0x00000008u;
         /* 021EFF88 */ cpu->r[11] = rbrew_read32(cpu->mem, _t65);
-        /* 021EFF8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021EFF90 */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EFF8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021EFF90 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EFF90 */ _t67 = _t66 & 0x00000001u;
         /* 021EFF90 */ if (_t67) goto L_021EFFEC; else goto L_021EFF94;
   L_021EFF94: ; // 0x21eff94
@@ -6816,10 +6816,10 @@ void Gambit_fn_021EFDD8(CPUState* cpu) {
         /* 021EFF94 */ cpu->r[4] = rbrew_read32(cpu->mem, _t68);
         /* 021EFF98 */ _t69 = cpu->r[12] + 0x00000004u;
         /* 021EFF98 */ cpu->r[10] = rbrew_read32(cpu->mem, _t69);
-        /* 021EFF9C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
+        /* 021EFF9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
         /* 021EFFA0 */ _t70 = cpu->r[28] + 0x00000000u;
         /* 021EFFA0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t70);
-        /* 021EFFA4 */ _t71 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EFFA4 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EFFA4 */ _t72 = _t71 & 0x00000001u;
         /* 021EFFA4 */ if (_t72) goto L_021EFFA8; else goto L_021EFFB0;
   L_021EFFA8: ; // 0x21effa8
@@ -6857,7 +6857,7 @@ void Gambit_fn_021EFDD8(CPUState* cpu) {
         /* 021EFFF0 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t83);
         /* 021EFFF4 */ _t84 = cpu->r[1] + 0x00000038u;
         /* 021EFFF4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t84);
-        /* 021EFFF8 */ _t85 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021EFFF8 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021EFFF8 */ _t86 = _t85 & 0x00000001u;
         /* 021EFFF8 */ if (_t86) goto L_021EFFFC; // else: addr-0 trap, fall-through
   L_021EFFFC: ; // 0x21efffc
@@ -6914,18 +6914,18 @@ void Gambit_fn_021F000C(CPUState* cpu) {
         /* 021F0060 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t14);
         /* 021F0064 */ cpu->r[31] = cpu->r[6];
         /* 021F0068 */ cpu->r[30] = cpu->r[4];
-        /* 021F006C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021F006C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021F0070 */ cpu->f[30] = cpu->f[31];
-        /* 021F0074 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0074 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0074 */ _t16 = _t15 & 0x00000001u;
         /* 021F0074 */ if (_t16) goto L_021F0078; else goto L_021F09A4;
   L_021F0078: ; // 0x21f0078
         /* 021F0078 */ cpu->r[10] = cpu->r[30];
         /* 021F007C */ cpu->r[11] = 0x10040000u;
-        /* 021F0080 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x0000005Du);
+        /* 021F0080 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x0000005Du));
         /* 021F0084 */ _t17 = cpu->r[11] + 0xFFFFC604u;
         /* 021F0084 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t17);
-        /* 021F0088 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F0088 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F0088 */ _t19 = _t18 & 0x00000001u;
         /* 021F0088 */ if (_t19) goto L_021F008C; else goto L_021F0218;
   L_021F008C: ; // 0x21f008c
@@ -6936,33 +6936,33 @@ void Gambit_fn_021F000C(CPUState* cpu) {
         /* 021F009C */ cpu->ctr = cpu->r[0];
         /* 021F00A0 */ rbrew_dispatch(cpu, cpu->ctr); return;
   L_021F0218: ; // 0x21f0218
-        /* 021F0218 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x0000006Eu);
-        /* 021F021C */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F0218 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x0000006Eu));
+        /* 021F021C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F021C */ _t21 = _t20 & 0x00000001u;
         /* 021F021C */ if (_t21) goto L_021F0220; else goto L_021F09A4;
   L_021F0220: ; // 0x21f0220
-        /* 021F0220 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000070u);
-        /* 021F0224 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F0220 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000070u));
+        /* 021F0224 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F0224 */ _t23 = _t22 & 0x00000001u;
         /* 021F0224 */ if (_t23) goto L_021F0720; else goto L_021F0228;
   L_021F0228: ; // 0x21f0228
-        /* 021F0228 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000071u);
-        /* 021F022C */ _t24 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F0228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000071u));
+        /* 021F022C */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F022C */ _t25 = _t24 & 0x00000001u;
         /* 021F022C */ if (_t25) goto L_021F0230; else goto L_021F0654;
   L_021F0230: ; // 0x21f0230
-        /* 021F0230 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000074u);
-        /* 021F0234 */ _t26 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F0230 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000074u));
+        /* 021F0234 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F0234 */ _t27 = _t26 & 0x00000001u;
         /* 021F0234 */ if (_t27) goto L_021F0238; else goto L_021F09A4;
   L_021F0238: ; // 0x21f0238
-        /* 021F0238 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000076u);
-        /* 021F023C */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F0238 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000076u));
+        /* 021F023C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F023C */ _t29 = _t28 & 0x00000001u;
         /* 021F023C */ if (_t29) goto L_021F0720; else goto L_021F0240;
   L_021F0240: ; // 0x21f0240
-        /* 021F0240 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000078u);
-        /* 021F0244 */ _t30 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F0240 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000078u));
+        /* 021F0244 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F0244 */ _t31 = _t30 & 0x00000001u;
         /* 021F0244 */ if (_t31) goto L_021F0248; else goto L_021F09A4;
   L_021F0248: ; // 0x21f0248
@@ -6989,10 +6989,10 @@ void Gambit_fn_021F000C(CPUState* cpu) {
         /* 021F0280 */ _t38 = cpu->r[12] + 0xFFFFC5B4u;
         /* 021F0280 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t38);
         /* 021F0284 */ cpu->r[11] = 0x10040000u;
-        /* 021F0288 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[28]);
+        /* 021F0288 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[28]));
         /* 021F028C */ _t39 = cpu->r[11] + 0xFFFFC654u;
         /* 021F028C */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t39);
-        /* 021F0290 */ _t40 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F0290 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F0290 */ _t41 = _t40 & 0x00000001u;
         /* 021F0290 */ if (_t41) goto L_021F076C; else goto L_021F0294;
   L_021F0294: ; // 0x21f0294
@@ -7027,10 +7027,10 @@ void Gambit_fn_021F000C(CPUState* cpu) {
         /* 021F069C */ cpu->r[11] = 0x10040000u;
         /* 021F06A0 */ _t50 = cpu->r[12] + 0xFFFFC5B4u;
         /* 021F06A0 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t50);
-        /* 021F06A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[28]);
+        /* 021F06A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[28]));
         /* 021F06A8 */ _t51 = cpu->r[11] + 0xFFFFC654u;
         /* 021F06A8 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t51);
-        /* 021F06AC */ _t52 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F06AC */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F06AC */ _t53 = _t52 & 0x00000001u;
         /* 021F06AC */ if (_t53) goto L_021F076C; else goto L_021F06B0;
   L_021F06B0: ; // 0x21f06b0
@@ -7059,32 +7059,32 @@ void Gambit_fn_021F000C(CPUState* cpu) {
         /* 021F0758 */ _t60 = cpu->r[12] + 0xFFFFC5B4u;
         /* 021F0758 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t60);
         /* 021F075C */ cpu->r[11] = 0x10040000u;
-        /* 021F0760 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[28]);
+        /* 021F0760 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[28]));
         /* 021F0764 */ _t61 = cpu->r[11] + 0xFFFFC654u;
         /* 021F0764 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t61);
-        /* 021F0768 */ _t62 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F0768 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F0768 */ _t63 = _t62 & 0x00000001u;
         /* 021F0768 */ if (_t63) goto L_021F076C; else goto L_021F0780;
   L_021F076C: ; // 0x21f076c
-        /* 021F076C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[9]);
+        /* 021F076C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[9]));
         /* 021F0770 */ cpu->f[12] = cpu->f[28];
         /* 021F0774 */ cpu->f[8] = cpu->f[31];
-        /* 021F0778 */ _t64 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F0778 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F0778 */ _t65 = _t64 & 0x00000001u;
         /* 021F0778 */ if (_t65) goto L_021F0798; else goto L_021F077C;
   L_021F077C: ; // 0x21f077c
         /* 021F077C */ goto L_021F079C;
   L_021F0780: ; // 0x21f0780
-        /* 021F0780 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[29]);
-        /* 021F0784 */ _t66 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F0780 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[29]));
+        /* 021F0784 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F0784 */ _t67 = _t66 & 0x00000001u;
         /* 021F0784 */ if (_t67) goto L_021F0788; else goto L_021F078C;
   L_021F0788: ; // 0x21f0788
         /* 021F0788 */ cpu->f[12] = cpu->f[29];
   L_021F078C: ; // 0x21f078c
-        /* 021F078C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[9]);
+        /* 021F078C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[9]));
         /* 021F0790 */ cpu->f[8] = cpu->f[31];
-        /* 021F0794 */ _t68 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F0794 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F0794 */ _t69 = _t68 & 0x00000001u;
         /* 021F0794 */ if (_t69) goto L_021F0798; else goto L_021F079C;
   L_021F0798: ; // 0x21f0798
@@ -7116,8 +7116,8 @@ void Gambit_fn_021F000C(CPUState* cpu) {
         /* 021F07E0 */ cpu->f[11] = cpu->f[10] - cpu->f[11];
         /* 021F07E4 */ cpu->f[13] = cpu->f[12] * cpu->f[12];
         /* 021F07E8 */ cpu->f[0] = fma(cpu->f[11], cpu->f[11], cpu->f[13]);
-        /* 021F07EC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[7]);
-        /* 021F07F0 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F07EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[7]));
+        /* 021F07F0 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F07F0 */ _t77 = _t76 & 0x00000001u;
         /* 021F07F0 */ if (_t77) goto L_021F07F4; else goto L_021F09A4;
   L_021F07F4: ; // 0x21f07f4
@@ -7139,21 +7139,21 @@ void Gambit_fn_021F000C(CPUState* cpu) {
         /* 021F0820 */ _t82 = cpu->r[1] + 0x00000008u;
         /* 021F0820 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t82);
         /* 021F0824 */ cpu->f[9] = fma(cpu->f[7], cpu->f[7], cpu->f[9]);
-        /* 021F0828 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[10]);
+        /* 021F0828 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[10]));
         /* 021F082C */ _t83 = cpu->r[1] + 0x00000010u;
         /* 021F082C */ rbrew_write_f32(cpu->mem, _t83, cpu->f[8]);
         /* 021F0830 */ cpu->r[12] = cpu->r[9] + 0x000001B8u;
-        /* 021F0834 */ _t84 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F0834 */ _t84 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F0834 */ _t85 = _t84 & 0x00000001u;
         /* 021F0834 */ if (_t85) goto L_021F095C; else goto L_021F0838;
   L_021F0838: ; // 0x21f0838
         /* 021F0838 */ cpu->r[9] = 0x10040000u;
-        /* 021F083C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[28]);
+        /* 021F083C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[28]));
         /* 021F0840 */ _t86 = cpu->r[9] + 0xFFFFC658u;
         /* 021F0840 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t86);
         /* 021F0844 */ _t87 = cpu->r[1] + 0x0000000Cu;
         /* 021F0844 */ rbrew_write_f32(cpu->mem, _t87, cpu->f[28]);
-        /* 021F0848 */ _t88 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F0848 */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F0848 */ _t89 = _t88 & 0x00000001u;
         /* 021F0848 */ if (_t89) goto L_021F0874; else goto L_021F084C;
   L_021F084C: ; // 0x21f084c
@@ -7165,8 +7165,8 @@ void Gambit_fn_021F000C(CPUState* cpu) {
         /* 021F0860 */ _t90 = cpu->r[12] + 0x00000008u;
         /* 021F0860 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t90);
         /* 021F0864 */ cpu->f[30] = fma(cpu->f[8], cpu->f[0], cpu->f[7]);
-        /* 021F0868 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[28]);
-        /* 021F086C */ _t91 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F0868 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[28]));
+        /* 021F086C */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F086C */ _t92 = _t91 & 0x00000001u;
         /* 021F086C */ if (_t92) goto L_021F0870; else goto L_021F08C8;
   L_021F0870: ; // 0x21f0870
@@ -7197,8 +7197,8 @@ void Gambit_fn_021F000C(CPUState* cpu) {
         /* 021F08B8 */ _t98 = cpu->r[12] + 0x00000008u;
         /* 021F08B8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t98);
         /* 021F08BC */ cpu->f[30] = fma(cpu->f[8], cpu->f[0], cpu->f[7]);
-        /* 021F08C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[28]);
-        /* 021F08C4 */ _t99 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F08C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[28]));
+        /* 021F08C4 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F08C4 */ _t100 = _t99 & 0x00000001u;
         /* 021F08C4 */ if (_t100) goto L_021F095C; else goto L_021F08C8;
   L_021F08C8: ; // 0x21f08c8
@@ -7210,8 +7210,8 @@ void Gambit_fn_021F000C(CPUState* cpu) {
         /* 021F08D8 */ cpu->f[11] = cpu->f[7] * cpu->f[31];
         /* 021F08DC */ _t102 = cpu->r[12] + 0xFFFFC664u;
         /* 021F08DC */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t102);
-        /* 021F08E0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[11]);
-        /* 021F08E4 */ _t103 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F08E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[11]));
+        /* 021F08E4 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F08E4 */ _t104 = _t103 & 0x00000001u;
         /* 021F08E4 */ if (_t104) goto L_021F08E8; else goto L_021F08F0;
   L_021F08E8: ; // 0x21f08e8
@@ -7237,10 +7237,10 @@ void Gambit_fn_021F000C(CPUState* cpu) {
         /* 021F091C */ rbrew_write_f32(cpu->mem, _t109, cpu->f[0]);
         /* 021F0920 */ _t110 = cpu->r[1] + 0x00000018u;
         /* 021F0920 */ rbrew_write_f32(cpu->mem, _t110, cpu->f[28]);
-        /* 021F0924 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[28]);
+        /* 021F0924 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[28]));
         /* 021F0928 */ _t111 = cpu->r[1] + 0x0000001Cu;
         /* 021F0928 */ rbrew_write_f32(cpu->mem, _t111, cpu->f[29]);
-        /* 021F092C */ _t112 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F092C */ _t112 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F092C */ _t113 = _t112 & 0x00000001u;
         /* 021F092C */ if (_t113) goto L_021F0930; else goto L_021F0954;
   L_021F0930: ; // 0x21f0930
@@ -7258,8 +7258,8 @@ void Gambit_fn_021F000C(CPUState* cpu) {
         /* 021F094C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t117);
         /* 021F0950 */ cpu->f[29] = cpu->f[10] * cpu->f[12];
   L_021F0954: ; // 0x21f0954
-        /* 021F0954 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[29]);
-        /* 021F0958 */ _t118 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F0954 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[29]));
+        /* 021F0958 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F0958 */ _t119 = _t118 & 0x00000001u;
         /* 021F0958 */ if (_t119) goto L_021F095C; else goto L_021F09A4;
   L_021F095C: ; // 0x21f095c
@@ -7288,7 +7288,7 @@ void Gambit_fn_021F000C(CPUState* cpu) {
         /* 021F0988 */ _t131 = cpu->r[1] + 0x00000030u;
         /* 021F0988 */ cpu->r[30] = rbrew_read32(cpu->mem, _t131);
         /* 021F098C */ cpu->r[3] = 0x00000000u;
-        /* 021F0990 */ _t132 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F0990 */ _t132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F0990 */ _t133 = _t132 & 0x00000001u;
         /* 021F0990 */ if (_t133) goto L_021F0994; // else: addr-0 trap, fall-through
   L_021F0994: ; // 0x21f0994
@@ -7298,17 +7298,17 @@ void Gambit_fn_021F000C(CPUState* cpu) {
         /* 021F099C */ cpu->r[1] = cpu->r[1] + 0x00000078u;
         /* 021F09A0 */ return;
   L_021F09A4: ; // 0x21f09a4
-        /* 021F09A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000056u);
+        /* 021F09A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000056u));
         /* 021F09A8 */ cpu->r[3] = cpu->r[29];
-        /* 021F09AC */ _t135 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F09AC */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F09AC */ _t136 = _t135 & 0x00000001u;
         /* 021F09AC */ if (_t136) goto L_021F09B0; else goto L_021F0A8C;
   L_021F09B0: ; // 0x21f09b0
         /* 021F09B0 */ cpu->r[4] = 0x00000056u;
         /* 021F09B4 */ Gambit_fn_027910F0(cpu);
         /* 021F09B8 */ cpu->r[31] = cpu->r[3];
-        /* 021F09B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F09BC */ _t137 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F09B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F09BC */ _t137 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F09BC */ _t138 = _t137 & 0x00000001u;
         /* 021F09BC */ if (_t138) goto L_021F09C0; else goto L_021F0A44;
   L_021F09C0: ; // 0x21f09c0
@@ -7320,8 +7320,8 @@ void Gambit_fn_021F000C(CPUState* cpu) {
         /* 021F09C8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t141);
         /* 021F09CC */ cpu->r[3] = cpu->r[30];
         /* 021F09D0 */ Gambit_fn_0280223C(cpu);
-        /* 021F09D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F09D8 */ _t142 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F09D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F09D8 */ _t142 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F09D8 */ _t143 = _t142 & 0x00000001u;
         /* 021F09D8 */ if (_t143) goto L_021F09DC; else goto L_021F0A24;
   L_021F09DC: ; // 0x21f09dc
@@ -7350,7 +7350,7 @@ void Gambit_fn_021F000C(CPUState* cpu) {
         /* 021F0A08 */ _t155 = cpu->r[1] + 0x00000030u;
         /* 021F0A08 */ cpu->r[30] = rbrew_read32(cpu->mem, _t155);
         /* 021F0A0C */ cpu->r[3] = 0x00000000u;
-        /* 021F0A10 */ _t156 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F0A10 */ _t156 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F0A10 */ _t157 = _t156 & 0x00000001u;
         /* 021F0A10 */ if (_t157) goto L_021F0A14; // else: addr-0 trap, fall-through
   L_021F0A14: ; // 0x21f0a14
@@ -7363,8 +7363,8 @@ void Gambit_fn_021F000C(CPUState* cpu) {
         /* 021F0A24 */ _t159 = cpu->r[30] + 0x0000000Cu;
         /* 021F0A24 */ cpu->r[0] = rbrew_read32(cpu->mem, _t159);
         /* 021F0A28 */ cpu->r[31] = cpu->r[3] - cpu->r[0];
-        /* 021F0A28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F0A2C */ _t160 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0A28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F0A2C */ _t160 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0A2C */ _t161 = _t160 & 0x00000001u;
         /* 021F0A2C */ if (_t161) goto L_021F0A44; else goto L_021F0A30;
   L_021F0A30: ; // 0x21f0a30
@@ -7399,7 +7399,7 @@ void Gambit_fn_021F000C(CPUState* cpu) {
         /* 021F0A70 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t172);
         /* 021F0A74 */ _t173 = cpu->r[1] + 0x00000030u;
         /* 021F0A74 */ cpu->r[30] = rbrew_read32(cpu->mem, _t173);
-        /* 021F0A78 */ _t174 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F0A78 */ _t174 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F0A78 */ _t175 = _t174 & 0x00000001u;
         /* 021F0A78 */ if (_t175) goto L_021F0A7C; // else: addr-0 trap, fall-through
   L_021F0A7C: ; // 0x21f0a7c
@@ -7435,7 +7435,7 @@ void Gambit_fn_021F000C(CPUState* cpu) {
         /* 021F0ABC */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t187);
         /* 021F0AC0 */ _t188 = cpu->r[1] + 0x00000030u;
         /* 021F0AC0 */ cpu->r[30] = rbrew_read32(cpu->mem, _t188);
-        /* 021F0AC4 */ _t189 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F0AC4 */ _t189 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F0AC4 */ _t190 = _t189 & 0x00000001u;
         /* 021F0AC4 */ if (_t190) goto L_021F0AC8; // else: addr-0 trap, fall-through
   L_021F0AC8: ; // 0x21f0ac8
@@ -7614,37 +7614,37 @@ void Gambit_fn_021F0B58(CPUState* cpu) {
         /* 021F0BA8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t12);
         /* 021F0BAC */ cpu->r[29] = cpu->r[9] - cpu->r[30];
   L_021F0BB0: ; // 0x21f0bb0
-        /* 021F0BB0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[31]);
-        /* 021F0BB4 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0BB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[31]));
+        /* 021F0BB4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0BB4 */ _t14 = _t13 & 0x00000001u;
         /* 021F0BB4 */ if (_t14) goto L_021F0BCC; else goto L_021F0BB8;
   L_021F0BB8: ; // 0x21f0bb8
         /* 021F0BB8 */ _t15 = cpu->r[29] + 0x0000001Cu;
         /* 021F0BB8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t15);
-        /* 021F0BBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
-        /* 021F0BC0 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0BBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
+        /* 021F0BC0 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0BC0 */ _t17 = _t16 & 0x00000001u;
         /* 021F0BC0 */ if (_t17) goto L_021F0BCC; else goto L_021F0BC4;
   L_021F0BC4: ; // 0x21f0bc4
-        /* 021F0BC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000003u);
-        /* 021F0BC8 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0BC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000003u));
+        /* 021F0BC8 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0BC8 */ _t19 = _t18 & 0x00000001u;
         /* 021F0BC8 */ if (_t19) goto L_021F0BCC; else goto L_021F0BA4;
   L_021F0BCC: ; // 0x21f0bcc
-        /* 021F0BCC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[31]);
-        /* 021F0BD0 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0BCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[31]));
+        /* 021F0BD0 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0BD0 */ _t21 = _t20 & 0x00000001u;
         /* 021F0BD0 */ if (_t21) goto L_021F0C24; else goto L_021F0BD4;
   L_021F0BD4: ; // 0x21f0bd4
         /* 021F0BD4 */ _t22 = cpu->r[29] + 0x0000001Cu;
         /* 021F0BD4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t22);
-        /* 021F0BD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000002u);
-        /* 021F0BDC */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0BD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000002u));
+        /* 021F0BDC */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0BDC */ _t24 = _t23 & 0x00000001u;
         /* 021F0BDC */ if (_t24) goto L_021F0BE8; else goto L_021F0BE0;
   L_021F0BE0: ; // 0x21f0be0
-        /* 021F0BE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021F0BE4 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0BE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021F0BE4 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0BE4 */ _t26 = _t25 & 0x00000001u;
         /* 021F0BE4 */ if (_t26) goto L_021F0BE8; else goto L_021F0BF0;
   L_021F0BE8: ; // 0x21f0be8
@@ -7655,27 +7655,27 @@ void Gambit_fn_021F0B58(CPUState* cpu) {
         /* 021F0BF4 */ _t27 = cpu->r[4] + 0x00000004u;
         /* 021F0BF4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t27);
         /* 021F0BF8 */ cpu->r[29] = cpu->r[12] - cpu->r[30];
-        /* 021F0BFC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[31]);
-        /* 021F0C00 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0BFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[31]));
+        /* 021F0C00 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0C00 */ _t29 = _t28 & 0x00000001u;
         /* 021F0C00 */ if (_t29) goto L_021F0C24; else goto L_021F0C04;
   L_021F0C04: ; // 0x21f0c04
         /* 021F0C04 */ _t30 = cpu->r[29] + 0x0000001Cu;
         /* 021F0C04 */ cpu->r[0] = rbrew_read32(cpu->mem, _t30);
-        /* 021F0C08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021F0C0C */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0C08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021F0C0C */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0C0C */ _t32 = _t31 & 0x00000001u;
         /* 021F0C0C */ if (_t32) goto L_021F0C1C; else goto L_021F0C10;
   L_021F0C10: ; // 0x21f0c10
-        /* 021F0C10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021F0C14 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0C10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021F0C14 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0C14 */ _t34 = _t33 & 0x00000001u;
         /* 021F0C14 */ if (_t34) goto L_021F0C18; else goto L_021F0BF0;
   L_021F0C18: ; // 0x21f0c18
         /* 021F0C18 */ goto L_021F0BCC;
   L_021F0C1C: ; // 0x21f0c1c
-        /* 021F0C1C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[31]);
-        /* 021F0C20 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0C1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[31]));
+        /* 021F0C20 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0C20 */ _t36 = _t35 & 0x00000001u;
         /* 021F0C20 */ if (_t36) goto L_021F0C24; else goto L_021F0BD4;
   L_021F0C24: ; // 0x21f0c24
@@ -7734,37 +7734,37 @@ void Gambit_fn_021F0B5C(CPUState* cpu) {
         /* 021F0BA8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t12);
         /* 021F0BAC */ cpu->r[29] = cpu->r[9] - cpu->r[30];
   L_021F0BB0: ; // 0x21f0bb0
-        /* 021F0BB0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[31]);
-        /* 021F0BB4 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0BB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[31]));
+        /* 021F0BB4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0BB4 */ _t14 = _t13 & 0x00000001u;
         /* 021F0BB4 */ if (_t14) goto L_021F0BCC; else goto L_021F0BB8;
   L_021F0BB8: ; // 0x21f0bb8
         /* 021F0BB8 */ _t15 = cpu->r[29] + 0x0000001Cu;
         /* 021F0BB8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t15);
-        /* 021F0BBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
-        /* 021F0BC0 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0BBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
+        /* 021F0BC0 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0BC0 */ _t17 = _t16 & 0x00000001u;
         /* 021F0BC0 */ if (_t17) goto L_021F0BCC; else goto L_021F0BC4;
   L_021F0BC4: ; // 0x21f0bc4
-        /* 021F0BC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000003u);
-        /* 021F0BC8 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0BC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000003u));
+        /* 021F0BC8 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0BC8 */ _t19 = _t18 & 0x00000001u;
         /* 021F0BC8 */ if (_t19) goto L_021F0BCC; else goto L_021F0BA4;
   L_021F0BCC: ; // 0x21f0bcc
-        /* 021F0BCC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[31]);
-        /* 021F0BD0 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0BCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[31]));
+        /* 021F0BD0 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0BD0 */ _t21 = _t20 & 0x00000001u;
         /* 021F0BD0 */ if (_t21) goto L_021F0C24; else goto L_021F0BD4;
   L_021F0BD4: ; // 0x21f0bd4
         /* 021F0BD4 */ _t22 = cpu->r[29] + 0x0000001Cu;
         /* 021F0BD4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t22);
-        /* 021F0BD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000002u);
-        /* 021F0BDC */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0BD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000002u));
+        /* 021F0BDC */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0BDC */ _t24 = _t23 & 0x00000001u;
         /* 021F0BDC */ if (_t24) goto L_021F0BE8; else goto L_021F0BE0;
   L_021F0BE0: ; // 0x21f0be0
-        /* 021F0BE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021F0BE4 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0BE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021F0BE4 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0BE4 */ _t26 = _t25 & 0x00000001u;
         /* 021F0BE4 */ if (_t26) goto L_021F0BE8; else goto L_021F0BF0;
   L_021F0BE8: ; // 0x21f0be8
@@ -7775,27 +7775,27 @@ void Gambit_fn_021F0B5C(CPUState* cpu) {
         /* 021F0BF4 */ _t27 = cpu->r[4] + 0x00000004u;
         /* 021F0BF4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t27);
         /* 021F0BF8 */ cpu->r[29] = cpu->r[12] - cpu->r[30];
-        /* 021F0BFC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[31]);
-        /* 021F0C00 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0BFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[31]));
+        /* 021F0C00 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0C00 */ _t29 = _t28 & 0x00000001u;
         /* 021F0C00 */ if (_t29) goto L_021F0C24; else goto L_021F0C04;
   L_021F0C04: ; // 0x21f0c04
         /* 021F0C04 */ _t30 = cpu->r[29] + 0x0000001Cu;
         /* 021F0C04 */ cpu->r[0] = rbrew_read32(cpu->mem, _t30);
-        /* 021F0C08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021F0C0C */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0C08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021F0C0C */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0C0C */ _t32 = _t31 & 0x00000001u;
         /* 021F0C0C */ if (_t32) goto L_021F0C1C; else goto L_021F0C10;
   L_021F0C10: ; // 0x21f0c10
-        /* 021F0C10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021F0C14 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0C10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021F0C14 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0C14 */ _t34 = _t33 & 0x00000001u;
         /* 021F0C14 */ if (_t34) goto L_021F0C18; else goto L_021F0BF0;
   L_021F0C18: ; // 0x21f0c18
         /* 021F0C18 */ goto L_021F0BCC;
   L_021F0C1C: ; // 0x21f0c1c
-        /* 021F0C1C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[31]);
-        /* 021F0C20 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0C1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[31]));
+        /* 021F0C20 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0C20 */ _t36 = _t35 & 0x00000001u;
         /* 021F0C20 */ if (_t36) goto L_021F0C24; else goto L_021F0BD4;
   L_021F0C24: ; // 0x21f0c24
@@ -7833,8 +7833,8 @@ void Gambit_fn_021F0C40(CPUState* cpu) {
         /* 021F0C60 */ cpu->r[10] = rbrew_read32(cpu->mem, _t3);
         /* 021F0C64 */ _t4 = cpu->r[8] + 0x0000002Cu;
         /* 021F0C64 */ cpu->r[12] = rbrew_read32(cpu->mem, _t4);
-        /* 021F0C68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], cpu->r[12]);
-        /* 021F0C6C */ _t5 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F0C68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], cpu->r[12]));
+        /* 021F0C6C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F0C6C */ _t6 = _t5 & 0x00000001u;
         /* 021F0C6C */ if (_t6) goto L_021F0C70; else goto L_021F0D58;
   L_021F0C70: ; // 0x21f0c70
@@ -7849,21 +7849,21 @@ void Gambit_fn_021F0C40(CPUState* cpu) {
         /* 021F0C88 */ cpu->r[31] = rbrew_read32(cpu->mem, _t7);
         /* 021F0C8C */ _t8 = cpu->r[31] + 0x0000001Cu;
         /* 021F0C8C */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
-        /* 021F0C90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021F0C94 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0C90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021F0C94 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0C94 */ _t10 = _t9 & 0x00000001u;
         /* 021F0C94 */ if (_t10) goto L_021F0CA0; else goto L_021F0C98;
   L_021F0C98: ; // 0x21f0c98
-        /* 021F0C98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021F0C9C */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0C98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021F0C9C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0C9C */ _t12 = _t11 & 0x00000001u;
         /* 021F0C9C */ if (_t12) goto L_021F0CA0; else goto L_021F0D3C;
   L_021F0CA0: ; // 0x21f0ca0
         /* 021F0CA0 */ _t13 = cpu->r[27] + 0xFFFFE1B4u;
         /* 021F0CA0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t13);
-        /* 021F0CA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021F0CA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021F0CA8 */ cpu->r[3] = cpu->r[31];
-        /* 021F0CAC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0CAC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0CAC */ _t15 = _t14 & 0x00000001u;
         /* 021F0CAC */ if (_t15) goto L_021F0CB0; else goto L_021F0CC0;
   L_021F0CB0: ; // 0x21f0cb0
@@ -7874,8 +7874,8 @@ void Gambit_fn_021F0C40(CPUState* cpu) {
         /* 021F0CBC */ _t17 = cpu->r[26] + 0xFFFFFC34u;
         /* 021F0CBC */ rbrew_write32(cpu->mem, _t17, cpu->r[6]);
   L_021F0CC0: ; // 0x21f0cc0
-        /* 021F0CC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F0CC4 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0CC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F0CC4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0CC4 */ _t19 = _t18 & 0x00000001u;
         /* 021F0CC4 */ if (_t19) goto L_021F0CE8; else goto L_021F0CC8;
   L_021F0CC8: ; // 0x21f0cc8
@@ -7886,8 +7886,8 @@ void Gambit_fn_021F0C40(CPUState* cpu) {
         /* 021F0CD0 */ cpu->ctr = cpu->r[10];
         /* 021F0CD4 */ cpu->r[4] = cpu->r[26] + 0xFFFFFC34u;
         /* 021F0CD8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021F0CDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F0CE0 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0CDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F0CE0 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0CE0 */ _t23 = _t22 & 0x00000001u;
         /* 021F0CE0 */ if (_t23) goto L_021F0CE4; else goto L_021F0D3C;
   L_021F0CE4: ; // 0x21f0ce4
@@ -7896,8 +7896,8 @@ void Gambit_fn_021F0C40(CPUState* cpu) {
   L_021F0CE8: ; // 0x21f0ce8
         /* 021F0CE8 */ _t25 = cpu->r[29] + 0xFFFFD4E8u;
         /* 021F0CE8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t25);
-        /* 021F0CEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021F0CF0 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0CEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021F0CF0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0CF0 */ _t27 = _t26 & 0x00000001u;
         /* 021F0CF0 */ if (_t27) goto L_021F0CF4; else goto L_021F0D04;
   L_021F0CF4: ; // 0x21f0cf4
@@ -7908,8 +7908,8 @@ void Gambit_fn_021F0C40(CPUState* cpu) {
         /* 021F0D00 */ _t29 = cpu->r[25] + 0xFFFFD4ECu;
         /* 021F0D00 */ rbrew_write32(cpu->mem, _t29, cpu->r[5]);
   L_021F0D04: ; // 0x21f0d04
-        /* 021F0D04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F0D08 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0D04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F0D08 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0D08 */ _t31 = _t30 & 0x00000001u;
         /* 021F0D08 */ if (_t31) goto L_021F0D3C; else goto L_021F0D0C;
   L_021F0D0C: ; // 0x21f0d0c
@@ -7921,14 +7921,14 @@ void Gambit_fn_021F0C40(CPUState* cpu) {
         /* 021F0D18 */ cpu->r[3] = cpu->r[31];
         /* 021F0D1C */ cpu->r[4] = cpu->r[25] + 0xFFFFD4ECu;
         /* 021F0D20 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021F0D24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F0D28 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0D24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F0D28 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0D28 */ _t35 = _t34 & 0x00000001u;
         /* 021F0D28 */ if (_t35) goto L_021F0D3C; else goto L_021F0D2C;
   L_021F0D2C: ; // 0x21f0d2c
         /* 021F0D2C */ cpu->r[3] = cpu->r[31];
-        /* 021F0D2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F0D30 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F0D2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F0D30 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F0D30 */ _t37 = _t36 & 0x00000001u;
         /* 021F0D30 */ if (_t37) goto L_021F0D3C; else goto L_021F0D34;
   L_021F0D34: ; // 0x21f0d34
@@ -7944,8 +7944,8 @@ void Gambit_fn_021F0C40(CPUState* cpu) {
         /* 021F0D48 */ cpu->r[9] = rbrew_read32(cpu->mem, _t40);
         /* 021F0D4C */ _t41 = cpu->r[8] + 0x0000002Cu;
         /* 021F0D4C */ cpu->r[11] = rbrew_read32(cpu->mem, _t41);
-        /* 021F0D50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], cpu->r[11]);
-        /* 021F0D54 */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F0D50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], cpu->r[11]));
+        /* 021F0D54 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F0D54 */ _t43 = _t42 & 0x00000001u;
         /* 021F0D54 */ if (_t43) goto L_021F0C88; else goto L_021F0D58;
   L_021F0D58: ; // 0x21f0d58
@@ -8049,10 +8049,10 @@ void Gambit_fn_021F0D6C(CPUState* cpu) {
         /* 021F0E3C */ cpu->f[8] = fma(cpu->f[10], cpu->f[10], cpu->f[9]);
         /* 021F0E40 */ _t30 = cpu->r[12] + 0xFFFFC5B4u;
         /* 021F0E40 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t30);
-        /* 021F0E44 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[13]);
+        /* 021F0E44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[13]));
         /* 021F0E48 */ _t31 = cpu->r[1] + 0x0000001Cu;
         /* 021F0E48 */ rbrew_write_f32(cpu->mem, _t31, cpu->f[0]);
-        /* 021F0E4C */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F0E4C */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F0E4C */ _t33 = _t32 & 0x00000001u;
         /* 021F0E4C */ if (_t33) goto L_021F0E50; else goto L_021F0E8C;
   L_021F0E50: ; // 0x21f0e50
@@ -8194,10 +8194,10 @@ void Gambit_fn_021F0D70(CPUState* cpu) {
         /* 021F0E3C */ cpu->f[8] = fma(cpu->f[10], cpu->f[10], cpu->f[9]);
         /* 021F0E40 */ _t30 = cpu->r[12] + 0xFFFFC5B4u;
         /* 021F0E40 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t30);
-        /* 021F0E44 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[13]);
+        /* 021F0E44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[13]));
         /* 021F0E48 */ _t31 = cpu->r[1] + 0x0000001Cu;
         /* 021F0E48 */ rbrew_write_f32(cpu->mem, _t31, cpu->f[0]);
-        /* 021F0E4C */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F0E4C */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F0E4C */ _t33 = _t32 & 0x00000001u;
         /* 021F0E4C */ if (_t33) goto L_021F0E50; else goto L_021F0E8C;
   L_021F0E50: ; // 0x21f0e50
@@ -8297,11 +8297,11 @@ void Gambit_fn_021F0EC0(CPUState* cpu) {
         /* 021F0F2C */ _t12 = cpu->r[3] + 0x0000001Cu;
         /* 021F0F2C */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t12);
         /* 021F0F30 */ cpu->r[28] = cpu->r[4];
-        /* 021F0F34 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[13]);
+        /* 021F0F34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[13]));
         /* 021F0F38 */ _t13 = cpu->r[11] + 0xFFFFC658u;
         /* 021F0F38 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t13);
         /* 021F0F3C */ cpu->r[30] = cpu->r[6];
-        /* 021F0F40 */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F0F40 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F0F40 */ _t15 = _t14 & 0x00000001u;
         /* 021F0F40 */ if (_t15) goto L_021F0F44; else goto L_021F0F80;
   L_021F0F44: ; // 0x21f0f44
@@ -8526,10 +8526,10 @@ void Gambit_fn_021F0EC0(CPUState* cpu) {
         /* 021F1134 */ _t107 = cpu->r[1] + 0x00000038u;
         /* 021F1134 */ rbrew_write_f32(cpu->mem, _t107, cpu->f[12]);
         /* 021F1138 */ Gambit_fn_028198B8(cpu);
-        /* 021F113C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021F113C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021F1140 */ _t108 = cpu->r[1] + 0x00000008u;
         /* 021F1140 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t108);
-        /* 021F1144 */ _t109 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1144 */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1144 */ _t110 = _t109 & 0x00000001u;
         /* 021F1144 */ if (_t110) goto L_021F1178; else goto L_021F1148;
   L_021F1148: ; // 0x21f1148
@@ -8547,8 +8547,8 @@ void Gambit_fn_021F0EC0(CPUState* cpu) {
         /* 021F1164 */ _t115 = cpu->r[1] + 0x00000024u;
         /* 021F1164 */ rbrew_write_f32(cpu->mem, _t115, cpu->f[8]);
         /* 021F1168 */ Gambit_fn_02C69328(cpu);
-        /* 021F116C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
-        /* 021F1170 */ _t116 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F116C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
+        /* 021F1170 */ _t116 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F1170 */ _t117 = _t116 & 0x00000001u;
         /* 021F1170 */ if (_t117) goto L_021F1084; else goto L_021F1174;
   L_021F1174: ; // 0x21f1174
@@ -8567,13 +8567,13 @@ void Gambit_fn_021F0EC0(CPUState* cpu) {
         /* 021F1190 */ _t122 = cpu->r[1] + 0x0000001Cu;
         /* 021F1190 */ rbrew_write_f32(cpu->mem, _t122, cpu->f[11]);
         /* 021F1194 */ Gambit_fn_02C69328(cpu);
-        /* 021F1198 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
-        /* 021F119C */ _t123 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F1198 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
+        /* 021F119C */ _t123 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F119C */ _t124 = _t123 & 0x00000001u;
         /* 021F119C */ if (_t124) goto L_021F1084; else goto L_021F11A0;
   L_021F11A0: ; // 0x21f11a0
-        /* 021F11A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F11A4 */ _t125 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F11A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F11A4 */ _t125 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F11A4 */ _t126 = _t125 & 0x00000001u;
         /* 021F11A4 */ if (_t126) goto L_021F11A8; else goto L_021F11EC;
   L_021F11A8: ; // 0x21f11a8
@@ -8604,8 +8604,8 @@ void Gambit_fn_021F0EC0(CPUState* cpu) {
         /* 021F11DC */ _t138 = cpu->r[1] + 0x0000003Cu;
         /* 021F11DC */ rbrew_write_f32(cpu->mem, _t138, cpu->f[13]);
         /* 021F11E0 */ Gambit_fn_028198B8(cpu);
-        /* 021F11E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F11E8 */ _t139 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F11E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F11E8 */ _t139 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F11E8 */ _t140 = _t139 & 0x00000001u;
         /* 021F11E8 */ if (_t140) goto L_021F1234; else goto L_021F11EC;
   L_021F11EC: ; // 0x21f11ec
@@ -8619,10 +8619,10 @@ void Gambit_fn_021F0EC0(CPUState* cpu) {
         /* 021F11F8 */ rbrew_write32(cpu->mem, _t144, cpu->r[12]);
         /* 021F11FC */ _t145 = cpu->r[29] + 0x00000008u;
         /* 021F11FC */ rbrew_write32(cpu->mem, _t145, cpu->r[0]);
-        /* 021F1200 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021F1200 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021F1204 */ _t146 = cpu->r[29] + 0x00000004u;
         /* 021F1204 */ rbrew_write32(cpu->mem, _t146, cpu->r[4]);
-        /* 021F1208 */ _t147 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1208 */ _t147 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1208 */ _t148 = _t147 & 0x00000001u;
         /* 021F1208 */ if (_t148) goto L_021F1234; else goto L_021F120C;
   L_021F120C: ; // 0x21f120c
@@ -8652,7 +8652,7 @@ void Gambit_fn_021F0EC0(CPUState* cpu) {
         /* 021F1240 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t157);
         /* 021F1244 */ _t158 = cpu->r[1] + 0x00000110u;
         /* 021F1244 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t158);
-        /* 021F1248 */ _t159 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F1248 */ _t159 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F1248 */ _t160 = _t159 & 0x00000001u;
         /* 021F1248 */ if (_t160) goto L_021F124C; // else: addr-0 trap, fall-through
   L_021F124C: ; // 0x21f124c
@@ -8905,10 +8905,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1418 */ _t55 = cpu->r[10] + 0xFFFFC5B4u;
         /* 021F1418 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t55);
         /* 021F141C */ cpu->r[12] = cpu->r[12] + 0x0000512Cu;
-        /* 021F1420 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000001u);
+        /* 021F1420 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000001u));
         /* 021F1424 */ _t56 = cpu->r[1] + 0x00000024u;
         /* 021F1424 */ rbrew_write32(cpu->mem, _t56, cpu->r[12]);
-        /* 021F1428 */ _t57 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1428 */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1428 */ _t58 = _t57 & 0x00000001u;
         /* 021F1428 */ if (_t58) goto L_021F142C; else goto L_021F1440;
   L_021F142C: ; // 0x21f142c
@@ -8918,8 +8918,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1434 */ _t60 = cpu->r[24] + 0x00005130u;
         /* 021F1434 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t60);
         /* 021F1434 */ cpu->r[24] = _t60;
-        /* 021F1438 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[7]);
-        /* 021F143C */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1438 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[7]));
+        /* 021F143C */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F143C */ _t62 = _t61 & 0x00000001u;
         /* 021F143C */ if (_t62) goto L_021F1440; else goto L_021F1500;
   L_021F1440: ; // 0x21f1440
@@ -8997,21 +8997,21 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F14E8 */ cpu->r[6] = cpu->r[15];
         /* 021F14EC */ _t92 = cpu->r[1] + 0x00000470u;
         /* 021F14EC */ rbrew_write32(cpu->mem, _t92, cpu->r[0]);
-        /* 021F14F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021F14F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021F14F4 */ _t93 = cpu->r[1] + 0x0000065Cu;
         /* 021F14F4 */ rbrew_write32(cpu->mem, _t93, cpu->r[9]);
-        /* 021F14F8 */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F14F8 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F14F8 */ _t95 = _t94 & 0x00000001u;
         /* 021F14F8 */ if (_t95) goto L_021F162C; else goto L_021F14FC;
   L_021F14FC: ; // 0x21f14fc
         /* 021F14FC */ goto L_021F1628;
   L_021F1500: ; // 0x21f1500
-        /* 021F1500 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
+        /* 021F1500 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
         /* 021F1504 */ cpu->r[25] = 0x101C0000u;
         /* 021F1508 */ cpu->r[25] = cpu->r[25] + 0x00001D14u;
         /* 021F150C */ _t96 = cpu->r[1] + 0x00000024u;
         /* 021F150C */ cpu->r[27] = rbrew_read32(cpu->mem, _t96);
-        /* 021F1510 */ _t97 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F1510 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F1510 */ _t98 = _t97 & 0x00000001u;
         /* 021F1510 */ if (_t98) goto L_021F1514; else goto L_021F1520;
   L_021F1514: ; // 0x21f1514
@@ -9120,13 +9120,13 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F160C */ cpu->r[16] = 0x00000000u;
         /* 021F1610 */ _t138 = cpu->r[1] + 0x00000082u;
         /* 021F1610 */ rbrew_write16(cpu->mem, _t138, (uint16_t)cpu->r[12]);
-        /* 021F1614 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021F1614 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021F1618 */ _t139 = cpu->r[1] + 0x0000007Cu;
         /* 021F1618 */ rbrew_write_f32(cpu->mem, _t139, cpu->f[31]);
         /* 021F161C */ cpu->r[6] = cpu->r[15];
         /* 021F1620 */ _t140 = cpu->r[1] + 0x0000065Cu;
         /* 021F1620 */ rbrew_write32(cpu->mem, _t140, cpu->r[9]);
-        /* 021F1624 */ _t141 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1624 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1624 */ _t142 = _t141 & 0x00000001u;
         /* 021F1624 */ if (_t142) goto L_021F162C; else goto L_021F1628;
   L_021F1628: ; // 0x21f1628
@@ -9134,10 +9134,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
   L_021F162C: ; // 0x21f162c
         /* 021F162C */ cpu->r[12] = cpu->r[6] | 0x00000008u;
         /* 021F1630 */ cpu->r[0] = 0x00000000u;
-        /* 021F1634 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 021F1634 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 021F1638 */ _t143 = cpu->r[1] + 0x00000078u;
         /* 021F1638 */ rbrew_write32(cpu->mem, _t143, cpu->r[12]);
-        /* 021F163C */ _t144 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F163C */ _t144 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F163C */ _t145 = _t144 & 0x00000001u;
         /* 021F163C */ if (_t145) goto L_021F1644; else goto L_021F1640;
   L_021F1640: ; // 0x21f1640
@@ -9198,22 +9198,22 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F16C8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t163);
         /* 021F16CC */ _t164 = cpu->r[1] + 0x0000004Fu;
         /* 021F16CC */ rbrew_write8(cpu->mem, _t164, (uint8_t)cpu->r[12]);
-        /* 021F16D0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
+        /* 021F16D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
         /* 021F16D4 */ _t165 = cpu->r[1] + 0x0000004Cu;
         /* 021F16D4 */ rbrew_write8(cpu->mem, _t165, (uint8_t)cpu->r[12]);
         /* 021F16D8 */ _t166 = cpu->r[1] + 0x0000004Eu;
         /* 021F16D8 */ rbrew_write8(cpu->mem, _t166, (uint8_t)cpu->r[12]);
         /* 021F16DC */ _t167 = cpu->r[1] + 0x0000004Du;
         /* 021F16DC */ rbrew_write8(cpu->mem, _t167, (uint8_t)cpu->r[12]);
-        /* 021F16E0 */ _t168 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F16E0 */ _t168 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F16E0 */ _t169 = _t168 & 0x00000001u;
         /* 021F16E0 */ if (_t169) goto L_021F16E4; else goto L_021F1BC4;
   L_021F16E4: ; // 0x21f16e4
         /* 021F16E4 */ _t170 = cpu->r[1] + 0x00000081u;
         /* 021F16E4 */ cpu->r[12] = rbrew_read8(cpu->mem, _t170);
         /* 021F16E8 */ cpu->r[10] = cpu->r[12] | cpu->r[15];
-        /* 021F16E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021F16EC */ _t171 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F16E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021F16EC */ _t171 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F16EC */ _t172 = _t171 & 0x00000001u;
         /* 021F16EC */ if (_t172) goto L_021F1BC4; else goto L_021F16F0;
   L_021F16F0: ; // 0x21f16f0
@@ -9221,8 +9221,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F16F4 */ Gambit_fn_02043AC4(cpu);
         /* 021F16F8 */ _t173 = cpu->r[1] + 0x00000081u;
         /* 021F16F8 */ cpu->r[12] = rbrew_read8(cpu->mem, _t173);
-        /* 021F16FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021F1700 */ _t174 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F16FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021F1700 */ _t174 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1700 */ _t175 = _t174 & 0x00000001u;
         /* 021F1700 */ if (_t175) goto L_021F179C; else goto L_021F1704;
   L_021F1704: ; // 0x21f1704
@@ -9232,12 +9232,12 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1708 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t177);
         /* 021F170C */ _t178 = cpu->r[1] + 0x0000001Cu;
         /* 021F170C */ cpu->r[12] = rbrew_read32(cpu->mem, _t178);
-        /* 021F1710 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[12]);
+        /* 021F1710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[12]));
         /* 021F1714 */ _t179 = cpu->r[1] + 0x00000038u;
         /* 021F1714 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t179);
         /* 021F1718 */ _t180 = cpu->r[12] + 0x00000000u;
         /* 021F1718 */ cpu->r[3] = rbrew_read32(cpu->mem, _t180);
-        /* 021F171C */ _t181 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F171C */ _t181 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F171C */ _t182 = _t181 & 0x00000001u;
         /* 021F171C */ if (_t182) goto L_021F1760; else goto L_021F1720;
   L_021F1720: ; // 0x21f1720
@@ -9259,10 +9259,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1748 */ rbrew_write32(cpu->mem, _t187, cpu->r[0]);
         /* 021F174C */ Gambit_fn_0204A4DC(cpu);
         /* 021F1750 */ cpu->r[9] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021F1750 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F1750 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F1754 */ _t188 = cpu->r[1] + 0x00000564u;
         /* 021F1754 */ rbrew_write32(cpu->mem, _t188, cpu->r[3]);
-        /* 021F1758 */ _t189 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1758 */ _t189 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1758 */ _t190 = _t189 & 0x00000001u;
         /* 021F1758 */ if (_t190) goto L_021F1BC4; else goto L_021F175C;
   L_021F175C: ; // 0x21f175c
@@ -9287,10 +9287,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1784 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t197);
         /* 021F1788 */ Gambit_fn_0204A864(cpu);
         /* 021F178C */ cpu->r[9] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021F178C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F178C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F1790 */ _t198 = cpu->r[1] + 0x00000564u;
         /* 021F1790 */ rbrew_write32(cpu->mem, _t198, cpu->r[3]);
-        /* 021F1794 */ _t199 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1794 */ _t199 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1794 */ _t200 = _t199 & 0x00000001u;
         /* 021F1794 */ if (_t200) goto L_021F1BC4; else goto L_021F1798;
   L_021F1798: ; // 0x21f1798
@@ -9366,10 +9366,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F183C */ rbrew_write32(cpu->mem, _t227, cpu->r[12]);
         /* 021F1840 */ Gambit_fn_0204A4DC(cpu);
         /* 021F1844 */ cpu->r[9] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021F1844 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F1844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F1848 */ _t228 = cpu->r[1] + 0x00000564u;
         /* 021F1848 */ rbrew_write32(cpu->mem, _t228, cpu->r[3]);
-        /* 021F184C */ _t229 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F184C */ _t229 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F184C */ _t230 = _t229 & 0x00000001u;
         /* 021F184C */ if (_t230) goto L_021F1BC4; else goto L_021F1850;
   L_021F1850: ; // 0x21f1850
@@ -9379,10 +9379,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F185C */ Gambit_fn_02043B24(cpu);
         /* 021F1860 */ _t231 = cpu->r[1] + 0x00000018u;
         /* 021F1860 */ cpu->r[12] = rbrew_read8(cpu->mem, _t231);
-        /* 021F1864 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021F1864 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021F1868 */ _t232 = cpu->r[1] + 0x00000568u;
         /* 021F1868 */ cpu->r[6] = rbrew_read32(cpu->mem, _t232);
-        /* 021F186C */ _t233 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F186C */ _t233 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F186C */ _t234 = _t233 & 0x00000001u;
         /* 021F186C */ if (_t234) goto L_021F1870; else goto L_021F1884;
   L_021F1870: ; // 0x21f1870
@@ -9390,8 +9390,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1874 */ _t235 = cpu->r[25] + 0x0000015Cu;
         /* 021F1874 */ cpu->r[0] = rbrew_read32(cpu->mem, _t235);
         /* 021F1878 */ cpu->r[9] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 021F1878 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 021F187C */ _t236 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1878 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 021F187C */ _t236 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F187C */ _t237 = _t236 & 0x00000001u;
         /* 021F187C */ if (_t237) goto L_021F1A48; else goto L_021F1880;
   L_021F1880: ; // 0x21f1880
@@ -9401,16 +9401,16 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1888 */ _t238 = cpu->r[25] + 0x0000015Cu;
         /* 021F1888 */ cpu->r[8] = rbrew_read32(cpu->mem, _t238);
         /* 021F188C */ cpu->r[7] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021F188C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021F188C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021F1890 */ _t239 = cpu->r[25] + 0x00000000u;
         /* 021F1890 */ cpu->r[8] = rbrew_read32(cpu->mem, _t239);
-        /* 021F1894 */ _t240 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1894 */ _t240 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1894 */ _t241 = _t240 & 0x00000001u;
         /* 021F1894 */ if (_t241) goto L_021F1910; else goto L_021F1898;
   L_021F1898: ; // 0x21f1898
         /* 021F1898 */ cpu->r[0] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021F1898 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021F189C */ _t242 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1898 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021F189C */ _t242 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F189C */ _t243 = _t242 & 0x00000001u;
         /* 021F189C */ if (_t243) goto L_021F18E8; else goto L_021F18A0;
   L_021F18A0: ; // 0x21f18a0
@@ -9419,10 +9419,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F18A8 */ cpu->f[0] = cpu->f[1];
         /* 021F18AC */ _t244 = cpu->r[1] + 0x00000048u;
         /* 021F18AC */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t244);
-        /* 021F18B0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[8]);
+        /* 021F18B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[8]));
         /* 021F18B4 */ _t245 = cpu->r[25] + 0x00000000u;
         /* 021F18B4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t245);
-        /* 021F18B8 */ _t246 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F18B8 */ _t246 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F18B8 */ _t247 = _t246 & 0x00000001u;
         /* 021F18B8 */ if (_t247) goto L_021F18BC; else goto L_021F18DC;
   L_021F18BC: ; // 0x21f18bc
@@ -9465,8 +9465,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F190C */ goto L_021F1984;
   L_021F1910: ; // 0x21f1910
         /* 021F1910 */ cpu->r[0] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021F1910 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021F1914 */ _t262 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021F1914 */ _t262 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1914 */ _t263 = _t262 & 0x00000001u;
         /* 021F1914 */ if (_t263) goto L_021F1960; else goto L_021F1918;
   L_021F1918: ; // 0x21f1918
@@ -9475,10 +9475,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1920 */ cpu->f[11] = cpu->f[1];
         /* 021F1924 */ _t264 = cpu->r[1] + 0x00000048u;
         /* 021F1924 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t264);
-        /* 021F1928 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[0]);
+        /* 021F1928 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[0]));
         /* 021F192C */ _t265 = cpu->r[25] + 0x00000000u;
         /* 021F192C */ cpu->r[6] = rbrew_read32(cpu->mem, _t265);
-        /* 021F1930 */ _t266 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F1930 */ _t266 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F1930 */ _t267 = _t266 & 0x00000001u;
         /* 021F1930 */ if (_t267) goto L_021F1934; else goto L_021F1954;
   L_021F1934: ; // 0x21f1934
@@ -9523,8 +9523,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1988 */ _t282 = cpu->r[25] + 0x0000015Cu;
         /* 021F1988 */ cpu->r[0] = rbrew_read32(cpu->mem, _t282);
         /* 021F198C */ cpu->r[9] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 021F198C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 021F1990 */ _t283 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F198C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 021F1990 */ _t283 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1990 */ _t284 = _t283 & 0x00000001u;
         /* 021F1990 */ if (_t284) goto L_021F1A48; else goto L_021F1994;
   L_021F1994: ; // 0x21f1994
@@ -9539,19 +9539,19 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F19A4 */ _t289 = cpu->r[25] + 0x00000068u;
         /* 021F19A4 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t289);
         /* 021F19A8 */ cpu->r[26] = 0x00000001u;
-        /* 021F19AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021F19AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021F19B0 */ _t290 = cpu->r[1] + 0x000000D8u;
         /* 021F19B0 */ rbrew_write_f32(cpu->mem, _t290, cpu->f[11]);
-        /* 021F19B4 */ _t291 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F19B4 */ _t291 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F19B4 */ _t292 = _t291 & 0x00000001u;
         /* 021F19B4 */ if (_t292) goto L_021F1A24; else goto L_021F19B8;
   L_021F19B8: ; // 0x21f19b8
         /* 021F19B8 */ _t293 = cpu->r[25] + 0x00000000u;
         /* 021F19B8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t293);
         /* 021F19BC */ cpu->r[0] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021F19BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021F19BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021F19C0 */ cpu->r[24] = cpu->r[25] + 0x00000048u;
-        /* 021F19C4 */ _t294 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F19C4 */ _t294 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F19C4 */ _t295 = _t294 & 0x00000001u;
         /* 021F19C4 */ if (_t295) goto L_021F1A0C; else goto L_021F19C8;
   L_021F19C8: ; // 0x21f19c8
@@ -9560,10 +9560,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F19D0 */ cpu->f[12] = cpu->f[1];
         /* 021F19D4 */ _t296 = cpu->r[1] + 0x00000048u;
         /* 021F19D4 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t296);
-        /* 021F19D8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[11]);
+        /* 021F19D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[11]));
         /* 021F19DC */ _t297 = cpu->r[25] + 0x00000000u;
         /* 021F19DC */ cpu->r[8] = rbrew_read32(cpu->mem, _t297);
-        /* 021F19E0 */ _t298 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F19E0 */ _t298 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F19E0 */ _t299 = _t298 & 0x00000001u;
         /* 021F19E0 */ if (_t299) goto L_021F19E4; else goto L_021F1A04;
   L_021F19E4: ; // 0x21f19e4
@@ -9596,8 +9596,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1A20 */ _t309 = cpu->r[31] + 0x00000008u;
         /* 021F1A20 */ rbrew_write_f32(cpu->mem, _t309, cpu->f[13]);
   L_021F1A24: ; // 0x21f1a24
-        /* 021F1A24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021F1A28 */ _t310 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1A24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021F1A28 */ _t310 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1A28 */ _t311 = _t310 & 0x00000001u;
         /* 021F1A28 */ if (_t311) goto L_021F1A44; else goto L_021F1A2C;
   L_021F1A2C: ; // 0x21f1a2c
@@ -9618,8 +9618,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1A44 */ cpu->r[0] = rbrew_read32(cpu->mem, _t318);
   L_021F1A48: ; // 0x21f1a48
         /* 021F1A48 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 021F1A48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021F1A4C */ _t319 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1A48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021F1A4C */ _t319 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1A4C */ _t320 = _t319 & 0x00000001u;
         /* 021F1A4C */ if (_t320) goto L_021F1B00; else goto L_021F1A50;
   L_021F1A50: ; // 0x21f1a50
@@ -9634,19 +9634,19 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1A60 */ _t325 = cpu->r[25] + 0x000000C8u;
         /* 021F1A60 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t325);
         /* 021F1A64 */ cpu->r[27] = 0x00000001u;
-        /* 021F1A68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021F1A68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021F1A6C */ _t326 = cpu->r[1] + 0x000000E4u;
         /* 021F1A6C */ rbrew_write_f32(cpu->mem, _t326, cpu->f[12]);
-        /* 021F1A70 */ _t327 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1A70 */ _t327 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1A70 */ _t328 = _t327 & 0x00000001u;
         /* 021F1A70 */ if (_t328) goto L_021F1AE0; else goto L_021F1A74;
   L_021F1A74: ; // 0x21f1a74
         /* 021F1A74 */ _t329 = cpu->r[25] + 0x00000000u;
         /* 021F1A74 */ cpu->r[5] = rbrew_read32(cpu->mem, _t329);
         /* 021F1A78 */ cpu->r[10] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021F1A78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021F1A78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021F1A7C */ cpu->r[24] = cpu->r[25] + 0x000000A8u;
-        /* 021F1A80 */ _t330 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1A80 */ _t330 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1A80 */ _t331 = _t330 & 0x00000001u;
         /* 021F1A80 */ if (_t331) goto L_021F1AC8; else goto L_021F1A84;
   L_021F1A84: ; // 0x21f1a84
@@ -9655,10 +9655,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1A8C */ cpu->f[10] = cpu->f[1];
         /* 021F1A90 */ _t332 = cpu->r[1] + 0x00000048u;
         /* 021F1A90 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t332);
-        /* 021F1A94 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[8]);
+        /* 021F1A94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[8]));
         /* 021F1A98 */ _t333 = cpu->r[25] + 0x00000000u;
         /* 021F1A98 */ cpu->r[8] = rbrew_read32(cpu->mem, _t333);
-        /* 021F1A9C */ _t334 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F1A9C */ _t334 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F1A9C */ _t335 = _t334 & 0x00000001u;
         /* 021F1A9C */ if (_t335) goto L_021F1AA0; else goto L_021F1AC0;
   L_021F1AA0: ; // 0x21f1aa0
@@ -9691,8 +9691,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1ADC */ _t345 = cpu->r[31] + 0x00000008u;
         /* 021F1ADC */ rbrew_write_f32(cpu->mem, _t345, cpu->f[11]);
   L_021F1AE0: ; // 0x21f1ae0
-        /* 021F1AE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021F1AE4 */ _t346 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1AE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021F1AE4 */ _t346 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1AE4 */ _t347 = _t346 & 0x00000001u;
         /* 021F1AE4 */ if (_t347) goto L_021F1B00; else goto L_021F1AE8;
   L_021F1AE8: ; // 0x21f1ae8
@@ -9709,13 +9709,13 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1AFC */ _t353 = cpu->r[29] + 0x00000008u;
         /* 021F1AFC */ rbrew_write_f32(cpu->mem, _t353, cpu->f[9]);
   L_021F1B00: ; // 0x21f1b00
-        /* 021F1B00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 021F1B04 */ _t354 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1B00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 021F1B04 */ _t354 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1B04 */ _t355 = _t354 & 0x00000001u;
         /* 021F1B04 */ if (_t355) goto L_021F1B54; else goto L_021F1B08;
   L_021F1B08: ; // 0x21f1b08
-        /* 021F1B08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 021F1B0C */ _t356 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1B08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 021F1B0C */ _t356 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1B0C */ _t357 = _t356 & 0x00000001u;
         /* 021F1B0C */ if (_t357) goto L_021F1B38; else goto L_021F1B10;
   L_021F1B10: ; // 0x21f1b10
@@ -9729,8 +9729,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1B28 */ Gambit_fn_02C69328(cpu);
         /* 021F1B2C */ _t359 = cpu->r[1] + 0x0000000Cu;
         /* 021F1B2C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t359);
-        /* 021F1B30 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[1]);
-        /* 021F1B34 */ _t360 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F1B30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[1]));
+        /* 021F1B34 */ _t360 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F1B34 */ _t361 = _t360 & 0x00000001u;
         /* 021F1B34 */ if (_t361) goto L_021F1B38; else goto L_021F1B5C;
   L_021F1B38: ; // 0x21f1b38
@@ -9748,8 +9748,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1B4C */ rbrew_write_f32(cpu->mem, _t367, cpu->f[10]);
         /* 021F1B50 */ goto L_021F1B74;
   L_021F1B54: ; // 0x21f1b54
-        /* 021F1B54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 021F1B58 */ _t368 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1B54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 021F1B58 */ _t368 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1B58 */ _t369 = _t368 & 0x00000001u;
         /* 021F1B58 */ if (_t369) goto L_021F1B74; else goto L_021F1B5C;
   L_021F1B5C: ; // 0x21f1b5c
@@ -9768,8 +9768,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
   L_021F1B74: ; // 0x21f1b74
         /* 021F1B74 */ _t376 = cpu->r[1] + 0x00000018u;
         /* 021F1B74 */ cpu->r[12] = rbrew_read8(cpu->mem, _t376);
-        /* 021F1B78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021F1B7C */ _t377 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1B78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021F1B7C */ _t377 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1B7C */ _t378 = _t377 & 0x00000001u;
         /* 021F1B7C */ if (_t378) goto L_021F1B80; else goto L_021F1BC4;
   L_021F1B80: ; // 0x21f1b80
@@ -9777,19 +9777,19 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1B80 */ cpu->r[6] = rbrew_read32(cpu->mem, _t379);
         /* 021F1B84 */ cpu->r[15] = 0x00000001u;
         /* 021F1B88 */ cpu->r[5] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x00000004u, 0x00000004u);
-        /* 021F1B88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021F1B88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021F1B8C */ _t380 = cpu->r[1] + 0x0000004Fu;
         /* 021F1B8C */ rbrew_write8(cpu->mem, _t380, (uint8_t)cpu->r[15]);
-        /* 021F1B90 */ _t381 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1B90 */ _t381 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1B90 */ _t382 = _t381 & 0x00000001u;
         /* 021F1B90 */ if (_t382) goto L_021F1BA8; else goto L_021F1B94;
   L_021F1B94: ; // 0x21f1b94
         /* 021F1B94 */ _t383 = cpu->r[25] + 0x00000044u;
         /* 021F1B94 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t383);
-        /* 021F1B98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021F1B98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021F1B9C */ _t384 = cpu->r[1] + 0x0000007Cu;
         /* 021F1B9C */ rbrew_write_f32(cpu->mem, _t384, cpu->f[11]);
-        /* 021F1BA0 */ _t385 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1BA0 */ _t385 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1BA0 */ _t386 = _t385 & 0x00000001u;
         /* 021F1BA0 */ if (_t386) goto L_021F1BC4; else goto L_021F1BA4;
   L_021F1BA4: ; // 0x21f1ba4
@@ -9797,10 +9797,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
   L_021F1BA8: ; // 0x21f1ba8
         /* 021F1BA8 */ _t387 = cpu->r[1] + 0x00000048u;
         /* 021F1BA8 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t387);
-        /* 021F1BAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021F1BAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021F1BB0 */ _t388 = cpu->r[1] + 0x0000007Cu;
         /* 021F1BB0 */ rbrew_write_f32(cpu->mem, _t388, cpu->f[11]);
-        /* 021F1BB4 */ _t389 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1BB4 */ _t389 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1BB4 */ _t390 = _t389 & 0x00000001u;
         /* 021F1BB4 */ if (_t390) goto L_021F1BC4; else goto L_021F1BB8;
   L_021F1BB8: ; // 0x21f1bb8
@@ -9812,16 +9812,16 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
   L_021F1BC4: ; // 0x21f1bc4
         /* 021F1BC4 */ _t393 = cpu->r[1] + 0x0000001Au;
         /* 021F1BC4 */ cpu->r[12] = rbrew_read8(cpu->mem, _t393);
-        /* 021F1BC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021F1BCC */ _t394 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1BC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021F1BCC */ _t394 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1BCC */ _t395 = _t394 & 0x00000001u;
         /* 021F1BCC */ if (_t395) goto L_021F1D38; else goto L_021F1BD0;
   L_021F1BD0: ; // 0x21f1bd0
         /* 021F1BD0 */ _t396 = cpu->r[1] + 0x00000081u;
         /* 021F1BD0 */ cpu->r[12] = rbrew_read8(cpu->mem, _t396);
         /* 021F1BD4 */ cpu->r[10] = cpu->r[12] | cpu->r[22];
-        /* 021F1BD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021F1BD8 */ _t397 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1BD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021F1BD8 */ _t397 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1BD8 */ _t398 = _t397 & 0x00000001u;
         /* 021F1BD8 */ if (_t398) goto L_021F1D38; else goto L_021F1BDC;
   L_021F1BDC: ; // 0x21f1bdc
@@ -9871,13 +9871,13 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1C3C */ cpu->r[4] = cpu->r[24];
         /* 021F1C40 */ Gambit_fn_0261F55C(cpu);
         /* 021F1C44 */ cpu->r[23] = cpu->r[3];
-        /* 021F1C48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], cpu->r[20]);
-        /* 021F1C4C */ _t417 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1C48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], cpu->r[20]));
+        /* 021F1C4C */ _t417 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1C4C */ _t418 = _t417 & 0x00000001u;
         /* 021F1C4C */ if (_t418) goto L_021F1D2C; else goto L_021F1C50;
   L_021F1C50: ; // 0x21f1c50
-        /* 021F1C50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
-        /* 021F1C54 */ _t419 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1C50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
+        /* 021F1C54 */ _t419 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1C54 */ _t420 = _t419 & 0x00000001u;
         /* 021F1C54 */ if (_t420) goto L_021F1D2C; else goto L_021F1C58;
   L_021F1C58: ; // 0x21f1c58
@@ -9888,8 +9888,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1C64 */ _t422 = cpu->r[1] + 0x00000344u;
         /* 021F1C64 */ rbrew_write32(cpu->mem, _t422, cpu->r[5]);
         /* 021F1C68 */ Gambit_fn_025C5E74(cpu);
-        /* 021F1C6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F1C70 */ _t423 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1C6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F1C70 */ _t423 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1C70 */ _t424 = _t423 & 0x00000001u;
         /* 021F1C70 */ if (_t424) goto L_021F1C74; else goto L_021F1D2C;
   L_021F1C74: ; // 0x21f1c74
@@ -9897,8 +9897,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1C78 */ cpu->r[4] = cpu->r[1] + 0x000002B4u;
         /* 021F1C7C */ cpu->r[3] = cpu->r[23];
         /* 021F1C80 */ Gambit_fn_025C89B0(cpu);
-        /* 021F1C84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F1C88 */ _t425 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1C84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F1C88 */ _t425 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1C88 */ _t426 = _t425 & 0x00000001u;
         /* 021F1C88 */ if (_t426) goto L_021F1D2C; else goto L_021F1C8C;
   L_021F1C8C: ; // 0x21f1c8c
@@ -9917,7 +9917,7 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1CA4 */ rbrew_write_f32(cpu->mem, _t432, cpu->f[8]);
         /* 021F1CA8 */ _t433 = cpu->r[1] + 0x000000A0u;
         /* 021F1CA8 */ rbrew_write_f32(cpu->mem, _t433, cpu->f[10]);
-        /* 021F1CAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021F1CAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021F1CB0 */ _t434 = cpu->r[1] + 0x000000A4u;
         /* 021F1CB0 */ rbrew_write_f32(cpu->mem, _t434, cpu->f[8]);
         /* 021F1CB4 */ cpu->r[15] = 0x00000000u;
@@ -9926,7 +9926,7 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1CBC */ cpu->r[16] = cpu->r[15];
         /* 021F1CC0 */ _t436 = cpu->r[1] + 0x000000A8u;
         /* 021F1CC0 */ rbrew_write_f32(cpu->mem, _t436, cpu->f[0]);
-        /* 021F1CC4 */ _t437 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1CC4 */ _t437 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1CC4 */ _t438 = _t437 & 0x00000001u;
         /* 021F1CC4 */ if (_t438) goto L_021F1CE0; else goto L_021F1CC8;
   L_021F1CC8: ; // 0x21f1cc8
@@ -9943,8 +9943,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1CDC */ _t444 = cpu->r[31] + 0x00000008u;
         /* 021F1CDC */ rbrew_write_f32(cpu->mem, _t444, cpu->f[13]);
   L_021F1CE0: ; // 0x21f1ce0
-        /* 021F1CE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021F1CE4 */ _t445 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1CE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021F1CE4 */ _t445 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1CE4 */ _t446 = _t445 & 0x00000001u;
         /* 021F1CE4 */ if (_t446) goto L_021F1D00; else goto L_021F1CE8;
   L_021F1CE8: ; // 0x21f1ce8
@@ -9961,8 +9961,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1CFC */ _t452 = cpu->r[29] + 0x00000008u;
         /* 021F1CFC */ rbrew_write_f32(cpu->mem, _t452, cpu->f[9]);
   L_021F1D00: ; // 0x21f1d00
-        /* 021F1D00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021F1D04 */ _t453 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1D00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021F1D04 */ _t453 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1D04 */ _t454 = _t453 & 0x00000001u;
         /* 021F1D04 */ if (_t454) goto L_021F1D2C; else goto L_021F1D08;
   L_021F1D08: ; // 0x21f1d08
@@ -9983,9 +9983,9 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1D28 */ rbrew_write32(cpu->mem, _t460, cpu->r[8]);
   L_021F1D2C: ; // 0x21f1d2c
         /* 021F1D2C */ cpu->r[25] = cpu->r[25] + 0xFFFFFFFFu;
-        /* 021F1D2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 021F1D2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 021F1D30 */ cpu->r[24] = cpu->r[24] + 0x00000001u;
-        /* 021F1D34 */ _t461 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1D34 */ _t461 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1D34 */ _t462 = _t461 & 0x00000001u;
         /* 021F1D34 */ if (_t462) goto L_021F1D38; else goto L_021F1C34;
   L_021F1D38: ; // 0x21f1d38
@@ -9994,20 +9994,20 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1D3C */ cpu->r[7] = rbrew_read32(cpu->mem, _t463);
         /* 021F1D40 */ _t464 = cpu->r[1] + 0x0000001Au;
         /* 021F1D40 */ cpu->r[12] = rbrew_read8(cpu->mem, _t464);
-        /* 021F1D44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021F1D44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021F1D48 */ _t465 = cpu->r[7] + 0x00000264u;
         /* 021F1D48 */ cpu->r[12] = rbrew_read32(cpu->mem, _t465);
         /* 021F1D4C */ _t466 = cpu->r[1] + 0x00000044u;
         /* 021F1D4C */ rbrew_write32(cpu->mem, _t466, cpu->r[12]);
-        /* 021F1D50 */ _t467 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1D50 */ _t467 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1D50 */ _t468 = _t467 & 0x00000001u;
         /* 021F1D50 */ if (_t468) goto L_021F1F48; else goto L_021F1D54;
   L_021F1D54: ; // 0x21f1d54
         /* 021F1D54 */ _t469 = cpu->r[1] + 0x00000081u;
         /* 021F1D54 */ cpu->r[12] = rbrew_read8(cpu->mem, _t469);
         /* 021F1D58 */ cpu->r[9] = cpu->r[12] | cpu->r[22];
-        /* 021F1D58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 021F1D5C */ _t470 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1D58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 021F1D5C */ _t470 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1D5C */ _t471 = _t470 & 0x00000001u;
         /* 021F1D5C */ if (_t471) goto L_021F1F48; else goto L_021F1D60;
   L_021F1D60: ; // 0x21f1d60
@@ -10017,8 +10017,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1D64 */ cpu->r[5] = rbrew_read32(cpu->mem, _t473);
         /* 021F1D68 */ _t474 = cpu->r[5] + 0x00000158u;
         /* 021F1D68 */ cpu->r[6] = rbrew_read32(cpu->mem, _t474);
-        /* 021F1D6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 021F1D70 */ _t475 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1D6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 021F1D70 */ _t475 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1D70 */ _t476 = _t475 & 0x00000001u;
         /* 021F1D70 */ if (_t476) goto L_021F1F48; else goto L_021F1D74;
   L_021F1D74: ; // 0x21f1d74
@@ -10112,28 +10112,28 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1E34 */ _t515 = cpu->r[1] + 0x000003A0u;
         /* 021F1E34 */ rbrew_write32(cpu->mem, _t515, cpu->r[23]);
   L_021F1E38: ; // 0x21f1e38
-        /* 021F1E38 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], cpu->r[10]);
-        /* 021F1E3C */ _t516 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1E38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], cpu->r[10]));
+        /* 021F1E3C */ _t516 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1E3C */ _t517 = _t516 & 0x00000001u;
         /* 021F1E3C */ if (_t517) goto L_021F1E54; else goto L_021F1E40;
   L_021F1E40: ; // 0x21f1e40
         /* 021F1E40 */ _t518 = cpu->r[23] + 0x0000001Cu;
         /* 021F1E40 */ cpu->r[8] = rbrew_read32(cpu->mem, _t518);
-        /* 021F1E44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000002u);
-        /* 021F1E48 */ _t519 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1E44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000002u));
+        /* 021F1E48 */ _t519 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1E48 */ _t520 = _t519 & 0x00000001u;
         /* 021F1E48 */ if (_t520) goto L_021F1E54; else goto L_021F1E4C;
   L_021F1E4C: ; // 0x21f1e4c
-        /* 021F1E4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000003u);
-        /* 021F1E50 */ _t521 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1E4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000003u));
+        /* 021F1E50 */ _t521 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1E50 */ _t522 = _t521 & 0x00000001u;
         /* 021F1E50 */ if (_t522) goto L_021F1E54; else goto L_021F1E28;
   L_021F1E54: ; // 0x21f1e54
         /* 021F1E54 */ cpu->r[27] = 0x101F0000u;
         /* 021F1E58 */ cpu->r[27] = cpu->r[27] + 0x00006350u;
   L_021F1E5C: ; // 0x21f1e5c
-        /* 021F1E5C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], cpu->r[26]);
-        /* 021F1E60 */ _t523 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1E5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], cpu->r[26]));
+        /* 021F1E60 */ _t523 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1E60 */ _t524 = _t523 & 0x00000001u;
         /* 021F1E60 */ if (_t524) goto L_021F1F48; else goto L_021F1E64;
   L_021F1E64: ; // 0x21f1e64
@@ -10143,8 +10143,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1E6C */ cpu->r[4] = cpu->r[1] + 0x00000128u;
         /* 021F1E70 */ cpu->r[3] = cpu->r[23];
         /* 021F1E74 */ Gambit_fn_0254427C(cpu);
-        /* 021F1E78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F1E7C */ _t525 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1E78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F1E7C */ _t525 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1E7C */ _t526 = _t525 & 0x00000001u;
         /* 021F1E7C */ if (_t526) goto L_021F1F04; else goto L_021F1E80;
   L_021F1E80: ; // 0x21f1e80
@@ -10163,7 +10163,7 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1E98 */ rbrew_write_f32(cpu->mem, _t532, cpu->f[8]);
         /* 021F1E9C */ _t533 = cpu->r[1] + 0x000000A0u;
         /* 021F1E9C */ rbrew_write_f32(cpu->mem, _t533, cpu->f[10]);
-        /* 021F1EA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021F1EA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021F1EA4 */ _t534 = cpu->r[1] + 0x000000A4u;
         /* 021F1EA4 */ rbrew_write_f32(cpu->mem, _t534, cpu->f[8]);
         /* 021F1EA8 */ cpu->r[15] = 0x00000000u;
@@ -10172,7 +10172,7 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1EB0 */ cpu->r[16] = cpu->r[15];
         /* 021F1EB4 */ _t536 = cpu->r[1] + 0x000000A8u;
         /* 021F1EB4 */ rbrew_write_f32(cpu->mem, _t536, cpu->f[0]);
-        /* 021F1EB8 */ _t537 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1EB8 */ _t537 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1EB8 */ _t538 = _t537 & 0x00000001u;
         /* 021F1EB8 */ if (_t538) goto L_021F1ED4; else goto L_021F1EBC;
   L_021F1EBC: ; // 0x21f1ebc
@@ -10189,8 +10189,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1ED0 */ _t544 = cpu->r[31] + 0x00000008u;
         /* 021F1ED0 */ rbrew_write_f32(cpu->mem, _t544, cpu->f[12]);
   L_021F1ED4: ; // 0x21f1ed4
-        /* 021F1ED4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021F1ED8 */ _t545 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1ED4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021F1ED8 */ _t545 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1ED8 */ _t546 = _t545 & 0x00000001u;
         /* 021F1ED8 */ if (_t546) goto L_021F1EF4; else goto L_021F1EDC;
   L_021F1EDC: ; // 0x21f1edc
@@ -10207,8 +10207,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1EF0 */ _t552 = cpu->r[29] + 0x00000008u;
         /* 021F1EF0 */ rbrew_write_f32(cpu->mem, _t552, cpu->f[7]);
   L_021F1EF4: ; // 0x21f1ef4
-        /* 021F1EF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021F1EF8 */ _t553 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1EF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021F1EF8 */ _t553 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1EF8 */ _t554 = _t553 & 0x00000001u;
         /* 021F1EF8 */ if (_t554) goto L_021F1F04; else goto L_021F1EFC;
   L_021F1EFC: ; // 0x21f1efc
@@ -10223,21 +10223,21 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1F0C */ _t557 = cpu->r[6] + 0x00000004u;
         /* 021F1F0C */ cpu->r[0] = rbrew_read32(cpu->mem, _t557);
         /* 021F1F10 */ cpu->r[23] = cpu->r[0] - cpu->r[7];
-        /* 021F1F14 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], cpu->r[26]);
+        /* 021F1F14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], cpu->r[26]));
         /* 021F1F18 */ cpu->r[0] = cpu->r[23];
-        /* 021F1F1C */ _t558 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1F1C */ _t558 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1F1C */ _t559 = _t558 & 0x00000001u;
         /* 021F1F1C */ if (_t559) goto L_021F1F44; else goto L_021F1F20;
   L_021F1F20: ; // 0x21f1f20
         /* 021F1F20 */ _t560 = cpu->r[23] + 0x0000001Cu;
         /* 021F1F20 */ cpu->r[9] = rbrew_read32(cpu->mem, _t560);
-        /* 021F1F24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000002u);
-        /* 021F1F28 */ _t561 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1F24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000002u));
+        /* 021F1F28 */ _t561 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1F28 */ _t562 = _t561 & 0x00000001u;
         /* 021F1F28 */ if (_t562) goto L_021F1F3C; else goto L_021F1F2C;
   L_021F1F2C: ; // 0x21f1f2c
-        /* 021F1F2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000003u);
-        /* 021F1F30 */ _t563 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1F2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000003u));
+        /* 021F1F30 */ _t563 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1F30 */ _t564 = _t563 & 0x00000001u;
         /* 021F1F30 */ if (_t564) goto L_021F1F34; else goto L_021F1F08;
   L_021F1F34: ; // 0x21f1f34
@@ -10245,8 +10245,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1F34 */ rbrew_write32(cpu->mem, _t565, cpu->r[0]);
         /* 021F1F38 */ goto L_021F1E5C;
   L_021F1F3C: ; // 0x21f1f3c
-        /* 021F1F3C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], cpu->r[26]);
-        /* 021F1F40 */ _t566 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1F3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], cpu->r[26]));
+        /* 021F1F40 */ _t566 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1F40 */ _t567 = _t566 & 0x00000001u;
         /* 021F1F40 */ if (_t567) goto L_021F1F44; else goto L_021F1E68;
   L_021F1F44: ; // 0x21f1f44
@@ -10257,8 +10257,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1F4C */ Gambit_fn_02019890(cpu);
         /* 021F1F50 */ _t569 = cpu->r[1] + 0x00000594u;
         /* 021F1F50 */ cpu->r[0] = rbrew_read32(cpu->mem, _t569);
-        /* 021F1F54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 021F1F58 */ _t570 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1F54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 021F1F58 */ _t570 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1F58 */ _t571 = _t570 & 0x00000001u;
         /* 021F1F58 */ if (_t571) goto L_021F1F5C; else goto L_021F224C;
   L_021F1F5C: ; // 0x21f1f5c
@@ -10267,8 +10267,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1F60 */ _t573 = cpu->r[1] + 0x00000080u;
         /* 021F1F60 */ cpu->r[11] = rbrew_read8(cpu->mem, _t573);
         /* 021F1F64 */ cpu->r[9] = cpu->r[12] | cpu->r[11];
-        /* 021F1F64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 021F1F68 */ _t574 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1F64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 021F1F68 */ _t574 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1F68 */ _t575 = _t574 & 0x00000001u;
         /* 021F1F68 */ if (_t575) goto L_021F2258; else goto L_021F1F6C;
   L_021F1F6C: ; // 0x21f1f6c
@@ -10322,8 +10322,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F1FE4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t592);
         /* 021F1FE8 */ /* nop */
         /* 021F1FEC */ cpu->r[10] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021F1FEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021F1FF0 */ _t593 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F1FEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021F1FF0 */ _t593 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F1FF0 */ _t594 = _t593 & 0x00000001u;
         /* 021F1FF0 */ if (_t594) goto L_021F224C; else goto L_021F1FF4;
   L_021F1FF4: ; // 0x21f1ff4
@@ -10374,15 +10374,15 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F204C */ cpu->r[3] = rbrew_read32(cpu->mem, _t615);
         /* 021F2050 */ Gambit_fn_02031DAC(cpu);
         /* 021F2054 */ cpu->r[19] = cpu->r[3];
-        /* 021F2054 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[19], 0x00000000u);
-        /* 021F2058 */ _t616 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[19], 0x00000000u));
+        /* 021F2058 */ _t616 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2058 */ _t617 = _t616 & 0x00000001u;
         /* 021F2058 */ if (_t617) goto L_021F224C; else goto L_021F205C;
   L_021F205C: ; // 0x21f205c
         /* 021F205C */ _t618 = cpu->r[19] + 0x00000070u;
         /* 021F205C */ cpu->r[8] = rbrew_read32(cpu->mem, _t618);
-        /* 021F2060 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021F2064 */ _t619 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2060 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021F2064 */ _t619 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2064 */ _t620 = _t619 & 0x00000001u;
         /* 021F2064 */ if (_t620) goto L_021F2248; else goto L_021F2068;
   L_021F2068: ; // 0x21f2068
@@ -10400,9 +10400,9 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F208C */ cpu->r[3] = cpu->r[19];
         /* 021F2090 */ cpu->r[4] = cpu->r[1] + 0x000006A0u;
         /* 021F2094 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021F2098 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021F2098 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021F209C */ cpu->r[18] = cpu->r[3];
-        /* 021F20A0 */ _t623 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F20A0 */ _t623 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F20A0 */ _t624 = _t623 & 0x00000001u;
         /* 021F20A0 */ if (_t624) goto L_021F2248; else goto L_021F20A4;
   L_021F20A4: ; // 0x21f20a4
@@ -10414,8 +10414,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F20B4 */ cpu->r[3] = cpu->r[1] + 0x000001ECu;
         /* 021F20B8 */ cpu->r[5] = cpu->r[1] + 0x0000024Cu;
         /* 021F20BC */ Gambit_fn_027DF038(cpu);
-        /* 021F20C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F20C4 */ _t625 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F20C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F20C4 */ _t625 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F20C4 */ _t626 = _t625 & 0x00000001u;
         /* 021F20C4 */ if (_t626) goto L_021F223C; else goto L_021F20C8;
   L_021F20C8: ; // 0x21f20c8
@@ -10462,10 +10462,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2128 */ cpu->r[6] = rbrew_read32(cpu->mem, _t642);
         /* 021F212C */ _t643 = cpu->r[1] + 0x000000F0u;
         /* 021F212C */ rbrew_write32(cpu->mem, _t643, cpu->r[9]);
-        /* 021F2130 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021F2130 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021F2134 */ _t644 = cpu->r[1] + 0x000000F4u;
         /* 021F2134 */ rbrew_write32(cpu->mem, _t644, cpu->r[6]);
-        /* 021F2138 */ _t645 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2138 */ _t645 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2138 */ _t646 = _t645 & 0x00000001u;
         /* 021F2138 */ if (_t646) goto L_021F2154; else goto L_021F213C;
   L_021F213C: ; // 0x21f213c
@@ -10482,8 +10482,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2150 */ _t652 = cpu->r[31] + 0x00000008u;
         /* 021F2150 */ rbrew_write32(cpu->mem, _t652, cpu->r[10]);
   L_021F2154: ; // 0x21f2154
-        /* 021F2154 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021F2158 */ _t653 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2154 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021F2158 */ _t653 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2158 */ _t654 = _t653 & 0x00000001u;
         /* 021F2158 */ if (_t654) goto L_021F2174; else goto L_021F215C;
   L_021F215C: ; // 0x21f215c
@@ -10530,20 +10530,20 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F21B4 */ cpu->ctr = cpu->r[7];
         /* 021F21B8 */ cpu->r[3] = cpu->r[19];
         /* 021F21BC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021F21C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F21C4 */ _t672 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F21C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F21C4 */ _t672 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F21C4 */ _t673 = _t672 & 0x00000001u;
         /* 021F21C4 */ if (_t673) goto L_021F21F4; else goto L_021F21C8;
   L_021F21C8: ; // 0x21f21c8
         /* 021F21C8 */ cpu->r[12] = 0x00000001u;
         /* 021F21CC */ cpu->r[15] = 0x00000000u;
-        /* 021F21D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021F21D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021F21D4 */ _t674 = cpu->r[1] + 0x00000080u;
         /* 021F21D4 */ rbrew_write8(cpu->mem, _t674, (uint8_t)cpu->r[12]);
         /* 021F21D8 */ cpu->r[16] = cpu->r[15];
         /* 021F21DC */ _t675 = cpu->r[1] + 0x0000004Du;
         /* 021F21DC */ rbrew_write8(cpu->mem, _t675, (uint8_t)cpu->r[12]);
-        /* 021F21E0 */ _t676 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F21E0 */ _t676 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F21E0 */ _t677 = _t676 & 0x00000001u;
         /* 021F21E0 */ if (_t677) goto L_021F221C; else goto L_021F21E4;
   L_021F21E4: ; // 0x21f21e4
@@ -10556,14 +10556,14 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F21F0 */ goto L_021F221C;
   L_021F21F4: ; // 0x21f21f4
         /* 021F21F4 */ cpu->r[12] = 0x00000000u;
-        /* 021F21F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021F21F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021F21FC */ cpu->r[15] = 0x00000001u;
         /* 021F2200 */ _t681 = cpu->r[1] + 0x00000080u;
         /* 021F2200 */ rbrew_write8(cpu->mem, _t681, (uint8_t)cpu->r[12]);
         /* 021F2204 */ cpu->r[16] = 0x00000000u;
         /* 021F2208 */ _t682 = cpu->r[1] + 0x0000004Fu;
         /* 021F2208 */ rbrew_write8(cpu->mem, _t682, (uint8_t)cpu->r[15]);
-        /* 021F220C */ _t683 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F220C */ _t683 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F220C */ _t684 = _t683 & 0x00000001u;
         /* 021F220C */ if (_t684) goto L_021F221C; else goto L_021F2210;
   L_021F2210: ; // 0x21f2210
@@ -10574,8 +10574,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2218 */ _t687 = cpu->r[1] + 0x00000278u;
         /* 021F2218 */ rbrew_write32(cpu->mem, _t687, cpu->r[0]);
   L_021F221C: ; // 0x21f221c
-        /* 021F221C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021F2220 */ _t688 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F221C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021F2220 */ _t688 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2220 */ _t689 = _t688 & 0x00000001u;
         /* 021F2220 */ if (_t689) goto L_021F223C; else goto L_021F2224;
   L_021F2224: ; // 0x21f2224
@@ -10593,9 +10593,9 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2238 */ rbrew_write32(cpu->mem, _t695, cpu->r[6]);
   L_021F223C: ; // 0x21f223c
         /* 021F223C */ cpu->r[18] = cpu->r[18] + 0xFFFFFFFFu;
-        /* 021F223C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[18], 0x00000000u);
+        /* 021F223C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[18], 0x00000000u));
         /* 021F2240 */ cpu->r[21] = cpu->r[21] + 0x00000020u;
-        /* 021F2244 */ _t696 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2244 */ _t696 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2244 */ _t697 = _t696 & 0x00000001u;
         /* 021F2244 */ if (_t697) goto L_021F2248; else goto L_021F20B0;
   L_021F2248: ; // 0x21f2248
@@ -10603,13 +10603,13 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
   L_021F224C: ; // 0x21f224c
         /* 021F224C */ _t698 = cpu->r[1] + 0x00000081u;
         /* 021F224C */ cpu->r[12] = rbrew_read8(cpu->mem, _t698);
-        /* 021F2250 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021F2254 */ _t699 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2250 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021F2254 */ _t699 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2254 */ _t700 = _t699 & 0x00000001u;
         /* 021F2254 */ if (_t700) goto L_021F2258; else goto L_021F2260;
   L_021F2258: ; // 0x21f2258
-        /* 021F2258 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[15], 0x00000000u);
-        /* 021F225C */ _t701 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2258 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[15], 0x00000000u));
+        /* 021F225C */ _t701 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F225C */ _t702 = _t701 & 0x00000001u;
         /* 021F225C */ if (_t702) goto L_021F2520; else goto L_021F2260;
   L_021F2260: ; // 0x21f2260
@@ -10619,8 +10619,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2264 */ cpu->r[8] = rbrew_read32(cpu->mem, _t704);
         /* 021F2268 */ _t705 = cpu->r[8] + 0x0000004Cu;
         /* 021F2268 */ cpu->r[0] = rbrew_read32(cpu->mem, _t705);
-        /* 021F226C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021F2270 */ _t706 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F226C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021F2270 */ _t706 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2270 */ _t707 = _t706 & 0x00000001u;
         /* 021F2270 */ if (_t707) goto L_021F2514; else goto L_021F2274;
   L_021F2274: ; // 0x21f2274
@@ -10642,10 +10642,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F22A0 */ cpu->f[10] = fma(cpu->f[13], cpu->f[13], cpu->f[0]);
         /* 021F22A4 */ _t712 = cpu->r[1] + 0x00000048u;
         /* 021F22A4 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t712);
-        /* 021F22A8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[12]);
+        /* 021F22A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[12]));
         /* 021F22AC */ _t713 = cpu->r[1] + 0x000000B4u;
         /* 021F22AC */ rbrew_write_f32(cpu->mem, _t713, cpu->f[13]);
-        /* 021F22B0 */ _t714 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F22B0 */ _t714 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F22B0 */ _t715 = _t714 & 0x00000001u;
         /* 021F22B0 */ if (_t715) goto L_021F22B4; else goto L_021F2300;
   L_021F22B4: ; // 0x21f22b4
@@ -10738,20 +10738,20 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F237C */ _t750 = cpu->r[1] + 0x00000120u;
         /* 021F237C */ rbrew_write32(cpu->mem, _t750, cpu->r[25]);
   L_021F2380: ; // 0x21f2380
-        /* 021F2380 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], cpu->r[26]);
-        /* 021F2384 */ _t751 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2380 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], cpu->r[26]));
+        /* 021F2384 */ _t751 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2384 */ _t752 = _t751 & 0x00000001u;
         /* 021F2384 */ if (_t752) goto L_021F239C; else goto L_021F2388;
   L_021F2388: ; // 0x21f2388
         /* 021F2388 */ _t753 = cpu->r[25] + 0x0000001Cu;
         /* 021F2388 */ cpu->r[10] = rbrew_read32(cpu->mem, _t753);
-        /* 021F238C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
-        /* 021F2390 */ _t754 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F238C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
+        /* 021F2390 */ _t754 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2390 */ _t755 = _t754 & 0x00000001u;
         /* 021F2390 */ if (_t755) goto L_021F239C; else goto L_021F2394;
   L_021F2394: ; // 0x21f2394
-        /* 021F2394 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000003u);
-        /* 021F2398 */ _t756 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2394 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000003u));
+        /* 021F2398 */ _t756 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2398 */ _t757 = _t756 & 0x00000001u;
         /* 021F2398 */ if (_t757) goto L_021F239C; else goto L_021F2370;
   L_021F239C: ; // 0x21f239c
@@ -10760,8 +10760,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F23A0 */ _t759 = cpu->r[1] + 0x00000010u;
         /* 021F23A0 */ rbrew_write_f32(cpu->mem, _t759, cpu->f[10]);
   L_021F23A4: ; // 0x21f23a4
-        /* 021F23A4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], cpu->r[26]);
-        /* 021F23A8 */ _t760 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F23A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], cpu->r[26]));
+        /* 021F23A8 */ _t760 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F23A8 */ _t761 = _t760 & 0x00000001u;
         /* 021F23A8 */ if (_t761) goto L_021F2514; else goto L_021F23AC;
   L_021F23AC: ; // 0x21f23ac
@@ -10775,8 +10775,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F23B8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t764);
         /* 021F23BC */ _t765 = cpu->r[20] + 0x0000002Cu;
         /* 021F23BC */ cpu->r[9] = rbrew_read32(cpu->mem, _t765);
-        /* 021F23C0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[9]);
-        /* 021F23C4 */ _t766 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F23C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[9]));
+        /* 021F23C4 */ _t766 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F23C4 */ _t767 = _t766 & 0x00000001u;
         /* 021F23C4 */ if (_t767) goto L_021F24C4; else goto L_021F23C8;
   L_021F23C8: ; // 0x21f23c8
@@ -10790,8 +10790,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F23DC */ cpu->r[5] = cpu->r[1] + 0x000000ACu;
         /* 021F23E0 */ cpu->r[6] = cpu->r[1] + 0x000001C0u;
         /* 021F23E4 */ Gambit_fn_0253B68C(cpu);
-        /* 021F23E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F23EC */ _t770 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F23E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F23EC */ _t770 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F23EC */ _t771 = _t770 & 0x00000001u;
         /* 021F23EC */ if (_t771) goto L_021F24C4; else goto L_021F23F0;
   L_021F23F0: ; // 0x21f23f0
@@ -10803,7 +10803,7 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F23F8 */ rbrew_write_f32(cpu->mem, _t774, cpu->f[10]);
         /* 021F23FC */ _t775 = cpu->r[1] + 0x000001C8u;
         /* 021F23FC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t775);
-        /* 021F2400 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021F2400 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021F2404 */ _t776 = cpu->r[1] + 0x000000A4u;
         /* 021F2404 */ rbrew_write_f32(cpu->mem, _t776, cpu->f[12]);
         /* 021F2408 */ cpu->r[15] = 0x00000001u;
@@ -10812,7 +10812,7 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2410 */ cpu->r[16] = 0x00000000u;
         /* 021F2414 */ _t778 = cpu->r[1] + 0x0000004Fu;
         /* 021F2414 */ rbrew_write8(cpu->mem, _t778, (uint8_t)cpu->r[15]);
-        /* 021F2418 */ _t779 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2418 */ _t779 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2418 */ _t780 = _t779 & 0x00000001u;
         /* 021F2418 */ if (_t780) goto L_021F2424; else goto L_021F241C;
   L_021F241C: ; // 0x21f241c
@@ -10821,8 +10821,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2420 */ _t782 = cpu->r[30] + 0x00000000u;
         /* 021F2420 */ cpu->r[10] = rbrew_read32(cpu->mem, _t782);
   L_021F2424: ; // 0x21f2424
-        /* 021F2424 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021F2428 */ _t783 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2424 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021F2428 */ _t783 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2428 */ _t784 = _t783 & 0x00000001u;
         /* 021F2428 */ if (_t784) goto L_021F2448; else goto L_021F242C;
   L_021F242C: ; // 0x21f242c
@@ -10857,10 +10857,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2470 */ cpu->f[10] = fma(cpu->f[13], cpu->f[13], cpu->f[10]);
         /* 021F2474 */ _t795 = cpu->r[1] + 0x00000070u;
         /* 021F2474 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t795);
-        /* 021F2478 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
+        /* 021F2478 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
         /* 021F247C */ _t796 = cpu->r[1] + 0x000000B4u;
         /* 021F247C */ rbrew_write_f32(cpu->mem, _t796, cpu->f[13]);
-        /* 021F2480 */ _t797 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F2480 */ _t797 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F2480 */ _t798 = _t797 & 0x00000001u;
         /* 021F2480 */ if (_t798) goto L_021F2484; else goto L_021F24C0;
   L_021F2484: ; // 0x21f2484
@@ -10894,17 +10894,17 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F24C8 */ _t807 = cpu->r[7] + 0x00000004u;
         /* 021F24C8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t807);
         /* 021F24CC */ cpu->r[25] = cpu->r[0] - cpu->r[27];
-        /* 021F24D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], cpu->r[26]);
-        /* 021F24D4 */ _t808 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F24D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], cpu->r[26]));
+        /* 021F24D4 */ _t808 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F24D4 */ _t809 = _t808 & 0x00000001u;
         /* 021F24D4 */ if (_t809) goto L_021F24D8; else goto L_021F24EC;
   L_021F24D8: ; // 0x21f24d8
         /* 021F24D8 */ _t810 = cpu->r[1] + 0x00000081u;
         /* 021F24D8 */ cpu->r[12] = rbrew_read8(cpu->mem, _t810);
-        /* 021F24DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021F24DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021F24E0 */ _t811 = cpu->r[1] + 0x00000120u;
         /* 021F24E0 */ rbrew_write32(cpu->mem, _t811, cpu->r[25]);
-        /* 021F24E4 */ _t812 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F24E4 */ _t812 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F24E4 */ _t813 = _t812 & 0x00000001u;
         /* 021F24E4 */ if (_t813) goto L_021F2520; else goto L_021F24E8;
   L_021F24E8: ; // 0x21f24e8
@@ -10912,13 +10912,13 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
   L_021F24EC: ; // 0x21f24ec
         /* 021F24EC */ _t814 = cpu->r[25] + 0x0000001Cu;
         /* 021F24EC */ cpu->r[6] = rbrew_read32(cpu->mem, _t814);
-        /* 021F24F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000002u);
-        /* 021F24F4 */ _t815 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F24F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000002u));
+        /* 021F24F4 */ _t815 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F24F4 */ _t816 = _t815 & 0x00000001u;
         /* 021F24F4 */ if (_t816) goto L_021F2508; else goto L_021F24F8;
   L_021F24F8: ; // 0x21f24f8
-        /* 021F24F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000003u);
-        /* 021F24FC */ _t817 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F24F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000003u));
+        /* 021F24FC */ _t817 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F24FC */ _t818 = _t817 & 0x00000001u;
         /* 021F24FC */ if (_t818) goto L_021F2500; else goto L_021F24C4;
   L_021F2500: ; // 0x21f2500
@@ -10926,22 +10926,22 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2500 */ rbrew_write32(cpu->mem, _t819, cpu->r[25]);
         /* 021F2504 */ goto L_021F23A4;
   L_021F2508: ; // 0x21f2508
-        /* 021F2508 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], cpu->r[26]);
+        /* 021F2508 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], cpu->r[26]));
         /* 021F250C */ _t820 = cpu->r[1] + 0x00000120u;
         /* 021F250C */ rbrew_write32(cpu->mem, _t820, cpu->r[25]);
-        /* 021F2510 */ _t821 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2510 */ _t821 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2510 */ _t822 = _t821 & 0x00000001u;
         /* 021F2510 */ if (_t822) goto L_021F2514; else goto L_021F23B8;
   L_021F2514: ; // 0x21f2514
         /* 021F2514 */ _t823 = cpu->r[1] + 0x00000081u;
         /* 021F2514 */ cpu->r[12] = rbrew_read8(cpu->mem, _t823);
-        /* 021F2518 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021F251C */ _t824 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2518 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021F251C */ _t824 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F251C */ _t825 = _t824 & 0x00000001u;
         /* 021F251C */ if (_t825) goto L_021F2520; else goto L_021F2528;
   L_021F2520: ; // 0x21f2520
-        /* 021F2520 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[16], 0x00000000u);
-        /* 021F2524 */ _t826 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2520 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[16], 0x00000000u));
+        /* 021F2524 */ _t826 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2524 */ _t827 = _t826 & 0x00000001u;
         /* 021F2524 */ if (_t827) goto L_021F2F9C; else goto L_021F2528;
   L_021F2528: ; // 0x21f2528
@@ -10951,8 +10951,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F252C */ cpu->r[7] = rbrew_read32(cpu->mem, _t829);
         /* 021F2530 */ _t830 = cpu->r[7] + 0x00000048u;
         /* 021F2530 */ cpu->r[8] = rbrew_read32(cpu->mem, _t830);
-        /* 021F2534 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021F2538 */ _t831 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2534 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021F2538 */ _t831 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2538 */ _t832 = _t831 & 0x00000001u;
         /* 021F2538 */ if (_t832) goto L_021F2824; else goto L_021F253C;
   L_021F253C: ; // 0x21f253c
@@ -11046,20 +11046,20 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F25FC */ _t871 = cpu->r[1] + 0x00000150u;
         /* 021F25FC */ rbrew_write32(cpu->mem, _t871, cpu->r[25]);
   L_021F2600: ; // 0x21f2600
-        /* 021F2600 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], cpu->r[0]);
-        /* 021F2604 */ _t872 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2600 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], cpu->r[0]));
+        /* 021F2604 */ _t872 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2604 */ _t873 = _t872 & 0x00000001u;
         /* 021F2604 */ if (_t873) goto L_021F261C; else goto L_021F2608;
   L_021F2608: ; // 0x21f2608
         /* 021F2608 */ _t874 = cpu->r[25] + 0x0000001Cu;
         /* 021F2608 */ cpu->r[7] = rbrew_read32(cpu->mem, _t874);
-        /* 021F260C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000002u);
-        /* 021F2610 */ _t875 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F260C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000002u));
+        /* 021F2610 */ _t875 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2610 */ _t876 = _t875 & 0x00000001u;
         /* 021F2610 */ if (_t876) goto L_021F261C; else goto L_021F2614;
   L_021F2614: ; // 0x21f2614
-        /* 021F2614 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000003u);
-        /* 021F2618 */ _t877 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2614 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000003u));
+        /* 021F2618 */ _t877 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2618 */ _t878 = _t877 & 0x00000001u;
         /* 021F2618 */ if (_t878) goto L_021F261C; else goto L_021F25F0;
   L_021F261C: ; // 0x21f261c
@@ -11071,8 +11071,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2628 */ _t881 = cpu->r[1] + 0x0000000Cu;
         /* 021F2628 */ rbrew_write_f32(cpu->mem, _t881, cpu->f[7]);
   L_021F262C: ; // 0x21f262c
-        /* 021F262C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], cpu->r[26]);
-        /* 021F2630 */ _t882 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F262C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], cpu->r[26]));
+        /* 021F2630 */ _t882 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2630 */ _t883 = _t882 & 0x00000001u;
         /* 021F2630 */ if (_t883) goto L_021F2824; else goto L_021F2634;
   L_021F2634: ; // 0x21f2634
@@ -11086,8 +11086,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2640 */ cpu->r[8] = rbrew_read32(cpu->mem, _t886);
         /* 021F2644 */ _t887 = cpu->r[20] + 0x0000002Cu;
         /* 021F2644 */ cpu->r[6] = rbrew_read32(cpu->mem, _t887);
-        /* 021F2648 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[6]);
-        /* 021F264C */ _t888 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2648 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[6]));
+        /* 021F264C */ _t888 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F264C */ _t889 = _t888 & 0x00000001u;
         /* 021F264C */ if (_t889) goto L_021F27C8; else goto L_021F2650;
   L_021F2650: ; // 0x21f2650
@@ -11123,8 +11123,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2690 */ cpu->r[4] = cpu->r[1] + 0x000001CCu;
         /* 021F2694 */ cpu->r[5] = cpu->r[1] + 0x000000D0u;
         /* 021F2698 */ Gambit_fn_027DF038(cpu);
-        /* 021F269C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F26A0 */ _t903 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F269C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F26A0 */ _t903 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F26A0 */ _t904 = _t903 & 0x00000001u;
         /* 021F26A0 */ if (_t904) goto L_021F27C8; else goto L_021F26A4;
   L_021F26A4: ; // 0x21f26a4
@@ -11171,10 +11171,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2704 */ cpu->r[10] = rbrew_read32(cpu->mem, _t920);
         /* 021F2708 */ _t921 = cpu->r[1] + 0x000000FCu;
         /* 021F2708 */ rbrew_write32(cpu->mem, _t921, cpu->r[9]);
-        /* 021F270C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021F270C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021F2710 */ _t922 = cpu->r[1] + 0x00000100u;
         /* 021F2710 */ rbrew_write32(cpu->mem, _t922, cpu->r[10]);
-        /* 021F2714 */ _t923 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2714 */ _t923 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2714 */ _t924 = _t923 & 0x00000001u;
         /* 021F2714 */ if (_t924) goto L_021F2730; else goto L_021F2718;
   L_021F2718: ; // 0x21f2718
@@ -11191,8 +11191,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F272C */ _t930 = cpu->r[31] + 0x00000008u;
         /* 021F272C */ rbrew_write32(cpu->mem, _t930, cpu->r[0]);
   L_021F2730: ; // 0x21f2730
-        /* 021F2730 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021F2734 */ _t931 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2730 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021F2734 */ _t931 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2734 */ _t932 = _t931 & 0x00000001u;
         /* 021F2734 */ if (_t932) goto L_021F2750; else goto L_021F2738;
   L_021F2738: ; // 0x21f2738
@@ -11229,7 +11229,7 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F277C */ rbrew_write_f32(cpu->mem, _t944, cpu->f[8]);
         /* 021F2780 */ _t945 = cpu->r[1] + 0x000000A0u;
         /* 021F2780 */ rbrew_write_f32(cpu->mem, _t945, cpu->f[10]);
-        /* 021F2784 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021F2784 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021F2788 */ _t946 = cpu->r[1] + 0x000000A4u;
         /* 021F2788 */ rbrew_write_f32(cpu->mem, _t946, cpu->f[8]);
         /* 021F278C */ cpu->r[22] = 0x00000000u;
@@ -11238,7 +11238,7 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2794 */ cpu->r[15] = cpu->r[22];
         /* 021F2798 */ _t948 = cpu->r[1] + 0x000000A8u;
         /* 021F2798 */ rbrew_write_f32(cpu->mem, _t948, cpu->f[0]);
-        /* 021F279C */ _t949 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F279C */ _t949 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F279C */ _t950 = _t949 & 0x00000001u;
         /* 021F279C */ if (_t950) goto L_021F27A8; else goto L_021F27A0;
   L_021F27A0: ; // 0x21f27a0
@@ -11247,8 +11247,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F27A4 */ _t952 = cpu->r[30] + 0x00000000u;
         /* 021F27A4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t952);
   L_021F27A8: ; // 0x21f27a8
-        /* 021F27A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021F27AC */ _t953 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F27A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021F27AC */ _t953 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F27AC */ _t954 = _t953 & 0x00000001u;
         /* 021F27AC */ if (_t954) goto L_021F27C8; else goto L_021F27B0;
   L_021F27B0: ; // 0x21f27b0
@@ -11272,19 +11272,19 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F27D4 */ _t961 = cpu->r[10] + 0x00000004u;
         /* 021F27D4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t961);
         /* 021F27D8 */ cpu->r[25] = cpu->r[10] - cpu->r[5];
-        /* 021F27DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], cpu->r[6]);
+        /* 021F27DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], cpu->r[6]));
         /* 021F27E0 */ cpu->r[0] = cpu->r[25];
-        /* 021F27E4 */ _t962 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F27E4 */ _t962 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F27E4 */ _t963 = _t962 & 0x00000001u;
         /* 021F27E4 */ if (_t963) goto L_021F27E8; else goto L_021F27FC;
   L_021F27E8: ; // 0x21f27e8
         /* 021F27E8 */ _t964 = cpu->r[1] + 0x00000081u;
         /* 021F27E8 */ cpu->r[12] = rbrew_read8(cpu->mem, _t964);
         /* 021F27EC */ cpu->r[8] = cpu->r[12] | cpu->r[16];
-        /* 021F27EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021F27EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021F27F0 */ _t965 = cpu->r[1] + 0x00000150u;
         /* 021F27F0 */ rbrew_write32(cpu->mem, _t965, cpu->r[0]);
-        /* 021F27F4 */ _t966 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F27F4 */ _t966 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F27F4 */ _t967 = _t966 & 0x00000001u;
         /* 021F27F4 */ if (_t967) goto L_021F2F9C; else goto L_021F27F8;
   L_021F27F8: ; // 0x21f27f8
@@ -11292,13 +11292,13 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
   L_021F27FC: ; // 0x21f27fc
         /* 021F27FC */ _t968 = cpu->r[25] + 0x0000001Cu;
         /* 021F27FC */ cpu->r[10] = rbrew_read32(cpu->mem, _t968);
-        /* 021F2800 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
-        /* 021F2804 */ _t969 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2800 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
+        /* 021F2804 */ _t969 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2804 */ _t970 = _t969 & 0x00000001u;
         /* 021F2804 */ if (_t970) goto L_021F2818; else goto L_021F2808;
   L_021F2808: ; // 0x21f2808
-        /* 021F2808 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000003u);
-        /* 021F280C */ _t971 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2808 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000003u));
+        /* 021F280C */ _t971 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F280C */ _t972 = _t971 & 0x00000001u;
         /* 021F280C */ if (_t972) goto L_021F2810; else goto L_021F27D0;
   L_021F2810: ; // 0x21f2810
@@ -11306,18 +11306,18 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2810 */ rbrew_write32(cpu->mem, _t973, cpu->r[0]);
         /* 021F2814 */ goto L_021F262C;
   L_021F2818: ; // 0x21f2818
-        /* 021F2818 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], cpu->r[26]);
+        /* 021F2818 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], cpu->r[26]));
         /* 021F281C */ _t974 = cpu->r[1] + 0x00000150u;
         /* 021F281C */ rbrew_write32(cpu->mem, _t974, cpu->r[0]);
-        /* 021F2820 */ _t975 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2820 */ _t975 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2820 */ _t976 = _t975 & 0x00000001u;
         /* 021F2820 */ if (_t976) goto L_021F2824; else goto L_021F2640;
   L_021F2824: ; // 0x21f2824
         /* 021F2824 */ _t977 = cpu->r[1] + 0x00000081u;
         /* 021F2824 */ cpu->r[12] = rbrew_read8(cpu->mem, _t977);
         /* 021F2828 */ cpu->r[8] = cpu->r[12] | cpu->r[16];
-        /* 021F2828 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021F282C */ _t978 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2828 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021F282C */ _t978 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F282C */ _t979 = _t978 & 0x00000001u;
         /* 021F282C */ if (_t979) goto L_021F2F9C; else goto L_021F2830;
   L_021F2830: ; // 0x21f2830
@@ -11327,8 +11327,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2834 */ cpu->r[5] = rbrew_read32(cpu->mem, _t981);
         /* 021F2838 */ _t982 = cpu->r[5] + 0x00000054u;
         /* 021F2838 */ cpu->r[6] = rbrew_read32(cpu->mem, _t982);
-        /* 021F283C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 021F2840 */ _t983 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F283C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 021F2840 */ _t983 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2840 */ _t984 = _t983 & 0x00000001u;
         /* 021F2840 */ if (_t984) goto L_021F2C40; else goto L_021F2844;
   L_021F2844: ; // 0x21f2844
@@ -11422,20 +11422,20 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2904 */ _t1023 = cpu->r[1] + 0x000000C8u;
         /* 021F2904 */ rbrew_write32(cpu->mem, _t1023, cpu->r[25]);
   L_021F2908: ; // 0x21f2908
-        /* 021F2908 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], cpu->r[7]);
-        /* 021F290C */ _t1024 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2908 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], cpu->r[7]));
+        /* 021F290C */ _t1024 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F290C */ _t1025 = _t1024 & 0x00000001u;
         /* 021F290C */ if (_t1025) goto L_021F2924; else goto L_021F2910;
   L_021F2910: ; // 0x21f2910
         /* 021F2910 */ _t1026 = cpu->r[25] + 0x0000001Cu;
         /* 021F2910 */ cpu->r[6] = rbrew_read32(cpu->mem, _t1026);
-        /* 021F2914 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000002u);
-        /* 021F2918 */ _t1027 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2914 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000002u));
+        /* 021F2918 */ _t1027 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2918 */ _t1028 = _t1027 & 0x00000001u;
         /* 021F2918 */ if (_t1028) goto L_021F2924; else goto L_021F291C;
   L_021F291C: ; // 0x21f291c
-        /* 021F291C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000003u);
-        /* 021F2920 */ _t1029 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F291C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000003u));
+        /* 021F2920 */ _t1029 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2920 */ _t1030 = _t1029 & 0x00000001u;
         /* 021F2920 */ if (_t1030) goto L_021F2924; else goto L_021F28F8;
   L_021F2924: ; // 0x21f2924
@@ -11447,8 +11447,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2930 */ _t1033 = cpu->r[1] + 0x0000000Cu;
         /* 021F2930 */ rbrew_write_f32(cpu->mem, _t1033, cpu->f[8]);
   L_021F2934: ; // 0x21f2934
-        /* 021F2934 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], cpu->r[26]);
-        /* 021F2938 */ _t1034 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], cpu->r[26]));
+        /* 021F2938 */ _t1034 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2938 */ _t1035 = _t1034 & 0x00000001u;
         /* 021F2938 */ if (_t1035) goto L_021F2C34; else goto L_021F293C;
   L_021F293C: ; // 0x21f293c
@@ -11462,8 +11462,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2948 */ cpu->r[5] = rbrew_read32(cpu->mem, _t1038);
         /* 021F294C */ _t1039 = cpu->r[20] + 0x0000002Cu;
         /* 021F294C */ cpu->r[10] = rbrew_read32(cpu->mem, _t1039);
-        /* 021F2950 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[10]);
-        /* 021F2954 */ _t1040 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2950 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[10]));
+        /* 021F2954 */ _t1040 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2954 */ _t1041 = _t1040 & 0x00000001u;
         /* 021F2954 */ if (_t1041) goto L_021F2BD8; else goto L_021F2958;
   L_021F2958: ; // 0x21f2958
@@ -11493,8 +11493,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F298C */ cpu->r[4] = cpu->r[1] + 0x0000022Cu;
         /* 021F2990 */ cpu->r[3] = cpu->r[1] + 0x00000158u;
         /* 021F2994 */ Gambit_fn_027DE3CC(cpu);
-        /* 021F2998 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F299C */ _t1052 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2998 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F299C */ _t1052 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F299C */ _t1053 = _t1052 & 0x00000001u;
         /* 021F299C */ if (_t1053) goto L_021F2BD8; else goto L_021F29A0;
   L_021F29A0: ; // 0x21f29a0
@@ -11604,10 +11604,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2A94 */ rbrew_write32(cpu->mem, _t1095, cpu->r[7]);
         /* 021F2A98 */ _t1096 = cpu->r[1] + 0x000000D8u;
         /* 021F2A98 */ rbrew_write_f32(cpu->mem, _t1096, cpu->f[13]);
-        /* 021F2A9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021F2A9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021F2AA0 */ _t1097 = cpu->r[1] + 0x0000010Cu;
         /* 021F2AA0 */ rbrew_write32(cpu->mem, _t1097, cpu->r[8]);
-        /* 021F2AA4 */ _t1098 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2AA4 */ _t1098 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2AA4 */ _t1099 = _t1098 & 0x00000001u;
         /* 021F2AA4 */ if (_t1099) goto L_021F2AC0; else goto L_021F2AA8;
   L_021F2AA8: ; // 0x21f2aa8
@@ -11624,8 +11624,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2ABC */ _t1105 = cpu->r[31] + 0x00000008u;
         /* 021F2ABC */ rbrew_write32(cpu->mem, _t1105, cpu->r[0]);
   L_021F2AC0: ; // 0x21f2ac0
-        /* 021F2AC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021F2AC4 */ _t1106 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2AC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021F2AC4 */ _t1106 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2AC4 */ _t1107 = _t1106 & 0x00000001u;
         /* 021F2AC4 */ if (_t1107) goto L_021F2AE0; else goto L_021F2AC8;
   L_021F2AC8: ; // 0x21f2ac8
@@ -11662,7 +11662,7 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2B0C */ rbrew_write_f32(cpu->mem, _t1119, cpu->f[8]);
         /* 021F2B10 */ _t1120 = cpu->r[1] + 0x000000A0u;
         /* 021F2B10 */ rbrew_write_f32(cpu->mem, _t1120, cpu->f[10]);
-        /* 021F2B14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021F2B14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021F2B18 */ _t1121 = cpu->r[1] + 0x000000A4u;
         /* 021F2B18 */ rbrew_write_f32(cpu->mem, _t1121, cpu->f[8]);
         /* 021F2B1C */ cpu->r[22] = 0x00000000u;
@@ -11671,7 +11671,7 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2B24 */ cpu->r[15] = cpu->r[22];
         /* 021F2B28 */ _t1123 = cpu->r[1] + 0x000000A8u;
         /* 021F2B28 */ rbrew_write_f32(cpu->mem, _t1123, cpu->f[0]);
-        /* 021F2B2C */ _t1124 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2B2C */ _t1124 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2B2C */ _t1125 = _t1124 & 0x00000001u;
         /* 021F2B2C */ if (_t1125) goto L_021F2BA8; else goto L_021F2B30;
   L_021F2B30: ; // 0x21f2b30
@@ -11693,10 +11693,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2B5C */ cpu->f[8] = fma(cpu->f[9], cpu->f[9], cpu->f[8]);
         /* 021F2B60 */ _t1130 = cpu->r[1] + 0x00000010u;
         /* 021F2B60 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t1130);
-        /* 021F2B64 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[12]);
+        /* 021F2B64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[12]));
         /* 021F2B68 */ _t1131 = cpu->r[31] + 0x00000008u;
         /* 021F2B68 */ rbrew_write_f32(cpu->mem, _t1131, cpu->f[9]);
-        /* 021F2B6C */ _t1132 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F2B6C */ _t1132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F2B6C */ _t1133 = _t1132 & 0x00000001u;
         /* 021F2B6C */ if (_t1133) goto L_021F2B70; else goto L_021F2BA8;
   L_021F2B70: ; // 0x21f2b70
@@ -11722,8 +11722,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2BA0 */ cpu->r[27] = rbrew_read32(cpu->mem, _t1140);
         /* 021F2BA4 */ /* nop */
   L_021F2BA8: ; // 0x21f2ba8
-        /* 021F2BA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021F2BAC */ _t1141 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2BA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021F2BAC */ _t1141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2BAC */ _t1142 = _t1141 & 0x00000001u;
         /* 021F2BAC */ if (_t1142) goto L_021F2BB8; else goto L_021F2BB0;
   L_021F2BB0: ; // 0x21f2bb0
@@ -11732,8 +11732,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2BB4 */ _t1144 = cpu->r[30] + 0x00000000u;
         /* 021F2BB4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1144);
   L_021F2BB8: ; // 0x21f2bb8
-        /* 021F2BB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021F2BBC */ _t1145 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2BB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021F2BBC */ _t1145 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2BBC */ _t1146 = _t1145 & 0x00000001u;
         /* 021F2BBC */ if (_t1146) goto L_021F2BD8; else goto L_021F2BC0;
   L_021F2BC0: ; // 0x21f2bc0
@@ -11757,19 +11757,19 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2BE4 */ _t1153 = cpu->r[6] + 0x00000004u;
         /* 021F2BE4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t1153);
         /* 021F2BE8 */ cpu->r[25] = cpu->r[0] - cpu->r[8];
-        /* 021F2BEC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], cpu->r[9]);
+        /* 021F2BEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], cpu->r[9]));
         /* 021F2BF0 */ cpu->r[10] = cpu->r[25];
-        /* 021F2BF4 */ _t1154 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2BF4 */ _t1154 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2BF4 */ _t1155 = _t1154 & 0x00000001u;
         /* 021F2BF4 */ if (_t1155) goto L_021F2BF8; else goto L_021F2C0C;
   L_021F2BF8: ; // 0x21f2bf8
         /* 021F2BF8 */ _t1156 = cpu->r[1] + 0x00000081u;
         /* 021F2BF8 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1156);
         /* 021F2BFC */ cpu->r[8] = cpu->r[12] | cpu->r[16];
-        /* 021F2BFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021F2BFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021F2C00 */ _t1157 = cpu->r[1] + 0x000000C8u;
         /* 021F2C00 */ rbrew_write32(cpu->mem, _t1157, cpu->r[10]);
-        /* 021F2C04 */ _t1158 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2C04 */ _t1158 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2C04 */ _t1159 = _t1158 & 0x00000001u;
         /* 021F2C04 */ if (_t1159) goto L_021F2F9C; else goto L_021F2C08;
   L_021F2C08: ; // 0x21f2c08
@@ -11777,13 +11777,13 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
   L_021F2C0C: ; // 0x21f2c0c
         /* 021F2C0C */ _t1160 = cpu->r[25] + 0x0000001Cu;
         /* 021F2C0C */ cpu->r[7] = rbrew_read32(cpu->mem, _t1160);
-        /* 021F2C10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000002u);
-        /* 021F2C14 */ _t1161 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2C10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000002u));
+        /* 021F2C14 */ _t1161 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2C14 */ _t1162 = _t1161 & 0x00000001u;
         /* 021F2C14 */ if (_t1162) goto L_021F2C28; else goto L_021F2C18;
   L_021F2C18: ; // 0x21f2c18
-        /* 021F2C18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000003u);
-        /* 021F2C1C */ _t1163 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2C18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000003u));
+        /* 021F2C1C */ _t1163 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2C1C */ _t1164 = _t1163 & 0x00000001u;
         /* 021F2C1C */ if (_t1164) goto L_021F2C20; else goto L_021F2BE0;
   L_021F2C20: ; // 0x21f2c20
@@ -11791,18 +11791,18 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2C20 */ rbrew_write32(cpu->mem, _t1165, cpu->r[10]);
         /* 021F2C24 */ goto L_021F2934;
   L_021F2C28: ; // 0x21f2c28
-        /* 021F2C28 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], cpu->r[26]);
+        /* 021F2C28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], cpu->r[26]));
         /* 021F2C2C */ _t1166 = cpu->r[1] + 0x000000C8u;
         /* 021F2C2C */ rbrew_write32(cpu->mem, _t1166, cpu->r[10]);
-        /* 021F2C30 */ _t1167 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2C30 */ _t1167 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2C30 */ _t1168 = _t1167 & 0x00000001u;
         /* 021F2C30 */ if (_t1168) goto L_021F2C34; else goto L_021F2948;
   L_021F2C34: ; // 0x21f2c34
         /* 021F2C34 */ _t1169 = cpu->r[1] + 0x00000081u;
         /* 021F2C34 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1169);
         /* 021F2C38 */ cpu->r[8] = cpu->r[12] | cpu->r[16];
-        /* 021F2C38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021F2C3C */ _t1170 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2C38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021F2C3C */ _t1170 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2C3C */ _t1171 = _t1170 & 0x00000001u;
         /* 021F2C3C */ if (_t1171) goto L_021F2F9C; else goto L_021F2C40;
   L_021F2C40: ; // 0x21f2c40
@@ -11812,8 +11812,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2C44 */ cpu->r[6] = rbrew_read32(cpu->mem, _t1173);
         /* 021F2C48 */ _t1174 = cpu->r[6] + 0x000000B8u;
         /* 021F2C48 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1174);
-        /* 021F2C4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021F2C50 */ _t1175 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2C4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021F2C50 */ _t1175 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2C50 */ _t1176 = _t1175 & 0x00000001u;
         /* 021F2C50 */ if (_t1176) goto L_021F2F90; else goto L_021F2C54;
   L_021F2C54: ; // 0x21f2c54
@@ -11857,8 +11857,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2CA0 */ cpu->r[6] = rbrew_read32(cpu->mem, _t1194);
         /* 021F2CA4 */ _t1195 = cpu->r[1] + 0x00000304u;
         /* 021F2CA4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t1195);
-        /* 021F2CA8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[0]);
-        /* 021F2CAC */ _t1196 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2CA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[0]));
+        /* 021F2CAC */ _t1196 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2CAC */ _t1197 = _t1196 & 0x00000001u;
         /* 021F2CAC */ if (_t1197) goto L_021F2F90; else goto L_021F2CB0;
   L_021F2CB0: ; // 0x21f2cb0
@@ -11875,8 +11875,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2CC4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1201);
         /* 021F2CC8 */ _t1202 = cpu->r[20] + 0x0000002Cu;
         /* 021F2CC8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t1202);
-        /* 021F2CCC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[6]);
-        /* 021F2CD0 */ _t1203 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2CCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[6]));
+        /* 021F2CD0 */ _t1203 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2CD0 */ _t1204 = _t1203 & 0x00000001u;
         /* 021F2CD0 */ if (_t1204) goto L_021F2F50; else goto L_021F2CD4;
   L_021F2CD4: ; // 0x21f2cd4
@@ -11902,8 +11902,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2CFC */ _t1214 = cpu->r[1] + 0x00000164u;
         /* 021F2CFC */ rbrew_write32(cpu->mem, _t1214, cpu->r[6]);
         /* 021F2D00 */ Gambit_fn_024A36AC(cpu);
-        /* 021F2D04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F2D08 */ _t1215 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2D04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F2D08 */ _t1215 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2D08 */ _t1216 = _t1215 & 0x00000001u;
         /* 021F2D08 */ if (_t1216) goto L_021F2F50; else goto L_021F2D0C;
   L_021F2D0C: ; // 0x21f2d0c
@@ -11911,8 +11911,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2D10 */ cpu->r[4] = cpu->r[1] + 0x00000474u;
         /* 021F2D14 */ cpu->r[3] = cpu->r[1] + 0x00000158u;
         /* 021F2D18 */ Gambit_fn_027DE3CC(cpu);
-        /* 021F2D1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F2D20 */ _t1217 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2D1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F2D20 */ _t1217 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2D20 */ _t1218 = _t1217 & 0x00000001u;
         /* 021F2D20 */ if (_t1218) goto L_021F2F50; else goto L_021F2D24;
   L_021F2D24: ; // 0x21f2d24
@@ -12022,10 +12022,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2E18 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1260);
         /* 021F2E1C */ _t1261 = cpu->r[1] + 0x00000108u;
         /* 021F2E1C */ rbrew_write32(cpu->mem, _t1261, cpu->r[6]);
-        /* 021F2E20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021F2E20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021F2E24 */ _t1262 = cpu->r[1] + 0x0000010Cu;
         /* 021F2E24 */ rbrew_write32(cpu->mem, _t1262, cpu->r[7]);
-        /* 021F2E28 */ _t1263 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2E28 */ _t1263 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2E28 */ _t1264 = _t1263 & 0x00000001u;
         /* 021F2E28 */ if (_t1264) goto L_021F2E44; else goto L_021F2E2C;
   L_021F2E2C: ; // 0x21f2e2c
@@ -12042,8 +12042,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2E40 */ _t1270 = cpu->r[31] + 0x00000008u;
         /* 021F2E40 */ rbrew_write32(cpu->mem, _t1270, cpu->r[5]);
   L_021F2E44: ; // 0x21f2e44
-        /* 021F2E44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021F2E48 */ _t1271 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2E44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021F2E48 */ _t1271 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2E48 */ _t1272 = _t1271 & 0x00000001u;
         /* 021F2E48 */ if (_t1272) goto L_021F2E64; else goto L_021F2E4C;
   L_021F2E4C: ; // 0x21f2e4c
@@ -12080,7 +12080,7 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2E90 */ rbrew_write_f32(cpu->mem, _t1284, cpu->f[8]);
         /* 021F2E94 */ _t1285 = cpu->r[1] + 0x000000A0u;
         /* 021F2E94 */ rbrew_write_f32(cpu->mem, _t1285, cpu->f[10]);
-        /* 021F2E98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021F2E98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021F2E9C */ _t1286 = cpu->r[1] + 0x000000A4u;
         /* 021F2E9C */ rbrew_write_f32(cpu->mem, _t1286, cpu->f[8]);
         /* 021F2EA0 */ cpu->r[22] = 0x00000000u;
@@ -12089,7 +12089,7 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2EA8 */ cpu->r[15] = cpu->r[22];
         /* 021F2EAC */ _t1288 = cpu->r[1] + 0x000000A8u;
         /* 021F2EAC */ rbrew_write_f32(cpu->mem, _t1288, cpu->f[0]);
-        /* 021F2EB0 */ _t1289 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2EB0 */ _t1289 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2EB0 */ _t1290 = _t1289 & 0x00000001u;
         /* 021F2EB0 */ if (_t1290) goto L_021F2F20; else goto L_021F2EB4;
   L_021F2EB4: ; // 0x21f2eb4
@@ -12111,10 +12111,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2EE0 */ cpu->f[0] = fma(cpu->f[9], cpu->f[9], cpu->f[12]);
         /* 021F2EE4 */ _t1295 = cpu->r[1] + 0x0000000Cu;
         /* 021F2EE4 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t1295);
-        /* 021F2EE8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[8]);
+        /* 021F2EE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[8]));
         /* 021F2EEC */ _t1296 = cpu->r[31] + 0x00000008u;
         /* 021F2EEC */ rbrew_write_f32(cpu->mem, _t1296, cpu->f[9]);
-        /* 021F2EF0 */ _t1297 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F2EF0 */ _t1297 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F2EF0 */ _t1298 = _t1297 & 0x00000001u;
         /* 021F2EF0 */ if (_t1298) goto L_021F2EF4; else goto L_021F2F20;
   L_021F2EF4: ; // 0x21f2ef4
@@ -12134,8 +12134,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2F18 */ rbrew_write_f32(cpu->mem, _t1302, cpu->f[7]);
         /* 021F2F1C */ /* nop */
   L_021F2F20: ; // 0x21f2f20
-        /* 021F2F20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021F2F24 */ _t1303 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2F20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021F2F24 */ _t1303 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2F24 */ _t1304 = _t1303 & 0x00000001u;
         /* 021F2F24 */ if (_t1304) goto L_021F2F30; else goto L_021F2F28;
   L_021F2F28: ; // 0x21f2f28
@@ -12144,8 +12144,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2F2C */ _t1306 = cpu->r[30] + 0x00000000u;
         /* 021F2F2C */ cpu->r[8] = rbrew_read32(cpu->mem, _t1306);
   L_021F2F30: ; // 0x21f2f30
-        /* 021F2F30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021F2F34 */ _t1307 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2F30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021F2F34 */ _t1307 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2F34 */ _t1308 = _t1307 & 0x00000001u;
         /* 021F2F34 */ if (_t1308) goto L_021F2F50; else goto L_021F2F38;
   L_021F2F38: ; // 0x21f2f38
@@ -12173,39 +12173,39 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2F60 */ _t1318 = cpu->r[9] + 0x00000004u;
         /* 021F2F60 */ cpu->r[0] = rbrew_read32(cpu->mem, _t1318);
         /* 021F2F64 */ cpu->r[6] = cpu->r[0] - cpu->r[10];
-        /* 021F2F68 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[5]);
+        /* 021F2F68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[5]));
         /* 021F2F6C */ _t1319 = cpu->r[1] + 0x0000030Cu;
         /* 021F2F6C */ rbrew_write32(cpu->mem, _t1319, cpu->r[6]);
-        /* 021F2F70 */ _t1320 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2F70 */ _t1320 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2F70 */ _t1321 = _t1320 & 0x00000001u;
         /* 021F2F70 */ if (_t1321) goto L_021F2F90; else goto L_021F2F74;
   L_021F2F74: ; // 0x21f2f74
         /* 021F2F74 */ _t1322 = cpu->r[6] + 0x0000001Cu;
         /* 021F2F74 */ cpu->r[9] = rbrew_read32(cpu->mem, _t1322);
-        /* 021F2F78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000002u);
-        /* 021F2F7C */ _t1323 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2F78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000002u));
+        /* 021F2F7C */ _t1323 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2F7C */ _t1324 = _t1323 & 0x00000001u;
         /* 021F2F7C */ if (_t1324) goto L_021F2F88; else goto L_021F2F80;
   L_021F2F80: ; // 0x21f2f80
-        /* 021F2F80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000003u);
-        /* 021F2F84 */ _t1325 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2F80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000003u));
+        /* 021F2F84 */ _t1325 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2F84 */ _t1326 = _t1325 & 0x00000001u;
         /* 021F2F84 */ if (_t1326) goto L_021F2F88; else goto L_021F2F5C;
   L_021F2F88: ; // 0x21f2f88
-        /* 021F2F88 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[5]);
-        /* 021F2F8C */ _t1327 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2F88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[5]));
+        /* 021F2F8C */ _t1327 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2F8C */ _t1328 = _t1327 & 0x00000001u;
         /* 021F2F8C */ if (_t1328) goto L_021F2F90; else goto L_021F2CC4;
   L_021F2F90: ; // 0x21f2f90
         /* 021F2F90 */ _t1329 = cpu->r[1] + 0x00000081u;
         /* 021F2F90 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1329);
-        /* 021F2F94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021F2F98 */ _t1330 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2F94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021F2F98 */ _t1330 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2F98 */ _t1331 = _t1330 & 0x00000001u;
         /* 021F2F98 */ if (_t1331) goto L_021F2F9C; else goto L_021F2FA4;
   L_021F2F9C: ; // 0x21f2f9c
-        /* 021F2F9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[15], 0x00000000u);
-        /* 021F2FA0 */ _t1332 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2F9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[15], 0x00000000u));
+        /* 021F2FA0 */ _t1332 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2FA0 */ _t1333 = _t1332 & 0x00000001u;
         /* 021F2FA0 */ if (_t1333) goto L_021F32EC; else goto L_021F2FA4;
   L_021F2FA4: ; // 0x21f2fa4
@@ -12215,8 +12215,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F2FA8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t1335);
         /* 021F2FAC */ _t1336 = cpu->r[6] + 0x00000058u;
         /* 021F2FAC */ cpu->r[7] = rbrew_read32(cpu->mem, _t1336);
-        /* 021F2FB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021F2FB4 */ _t1337 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F2FB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021F2FB4 */ _t1337 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F2FB4 */ _t1338 = _t1337 & 0x00000001u;
         /* 021F2FB4 */ if (_t1338) goto L_021F32E0; else goto L_021F2FB8;
   L_021F2FB8: ; // 0x21f2fb8
@@ -12260,8 +12260,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3004 */ cpu->r[3] = rbrew_read32(cpu->mem, _t1356);
         /* 021F3008 */ _t1357 = cpu->r[1] + 0x00000350u;
         /* 021F3008 */ cpu->r[9] = rbrew_read32(cpu->mem, _t1357);
-        /* 021F300C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], cpu->r[9]);
-        /* 021F3010 */ _t1358 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F300C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], cpu->r[9]));
+        /* 021F3010 */ _t1358 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3010 */ _t1359 = _t1358 & 0x00000001u;
         /* 021F3010 */ if (_t1359) goto L_021F32E0; else goto L_021F3014;
   L_021F3014: ; // 0x21f3014
@@ -12278,8 +12278,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3028 */ cpu->r[0] = rbrew_read32(cpu->mem, _t1363);
         /* 021F302C */ _t1364 = cpu->r[20] + 0x0000002Cu;
         /* 021F302C */ cpu->r[8] = rbrew_read32(cpu->mem, _t1364);
-        /* 021F3030 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
-        /* 021F3034 */ _t1365 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3030 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
+        /* 021F3034 */ _t1365 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3034 */ _t1366 = _t1365 & 0x00000001u;
         /* 021F3034 */ if (_t1366) goto L_021F32A0; else goto L_021F3038;
   L_021F3038: ; // 0x21f3038
@@ -12307,8 +12307,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3068 */ cpu->r[4] = cpu->r[1] + 0x00000494u;
         /* 021F306C */ cpu->r[3] = cpu->r[1] + 0x00000158u;
         /* 021F3070 */ Gambit_fn_027DE3CC(cpu);
-        /* 021F3074 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F3078 */ _t1376 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3074 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F3078 */ _t1376 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3078 */ _t1377 = _t1376 & 0x00000001u;
         /* 021F3078 */ if (_t1377) goto L_021F32A0; else goto L_021F307C;
   L_021F307C: ; // 0x21f307c
@@ -12418,10 +12418,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3170 */ rbrew_write32(cpu->mem, _t1419, cpu->r[5]);
         /* 021F3174 */ _t1420 = cpu->r[1] + 0x000000D8u;
         /* 021F3174 */ rbrew_write_f32(cpu->mem, _t1420, cpu->f[9]);
-        /* 021F3178 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021F3178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021F317C */ _t1421 = cpu->r[1] + 0x0000010Cu;
         /* 021F317C */ rbrew_write32(cpu->mem, _t1421, cpu->r[0]);
-        /* 021F3180 */ _t1422 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3180 */ _t1422 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3180 */ _t1423 = _t1422 & 0x00000001u;
         /* 021F3180 */ if (_t1423) goto L_021F319C; else goto L_021F3184;
   L_021F3184: ; // 0x21f3184
@@ -12438,8 +12438,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3198 */ _t1429 = cpu->r[31] + 0x00000008u;
         /* 021F3198 */ rbrew_write32(cpu->mem, _t1429, cpu->r[0]);
   L_021F319C: ; // 0x21f319c
-        /* 021F319C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021F31A0 */ _t1430 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F319C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021F31A0 */ _t1430 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F31A0 */ _t1431 = _t1430 & 0x00000001u;
         /* 021F31A0 */ if (_t1431) goto L_021F31BC; else goto L_021F31A4;
   L_021F31A4: ; // 0x21f31a4
@@ -12480,10 +12480,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F31F0 */ rbrew_write8(cpu->mem, _t1445, (uint8_t)cpu->r[15]);
         /* 021F31F4 */ _t1446 = cpu->r[1] + 0x000000A8u;
         /* 021F31F4 */ rbrew_write_f32(cpu->mem, _t1446, cpu->f[0]);
-        /* 021F31F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021F31F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021F31FC */ _t1447 = cpu->r[1] + 0x000000A4u;
         /* 021F31FC */ rbrew_write_f32(cpu->mem, _t1447, cpu->f[8]);
-        /* 021F3200 */ _t1448 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3200 */ _t1448 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3200 */ _t1449 = _t1448 & 0x00000001u;
         /* 021F3200 */ if (_t1449) goto L_021F3270; else goto L_021F3204;
   L_021F3204: ; // 0x21f3204
@@ -12505,10 +12505,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3230 */ cpu->f[11] = fma(cpu->f[9], cpu->f[9], cpu->f[11]);
         /* 021F3234 */ _t1454 = cpu->r[1] + 0x0000000Cu;
         /* 021F3234 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t1454);
-        /* 021F3238 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[13]);
+        /* 021F3238 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[13]));
         /* 021F323C */ _t1455 = cpu->r[31] + 0x00000008u;
         /* 021F323C */ rbrew_write_f32(cpu->mem, _t1455, cpu->f[9]);
-        /* 021F3240 */ _t1456 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F3240 */ _t1456 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F3240 */ _t1457 = _t1456 & 0x00000001u;
         /* 021F3240 */ if (_t1457) goto L_021F3244; else goto L_021F3270;
   L_021F3244: ; // 0x21f3244
@@ -12528,8 +12528,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3268 */ rbrew_write_f32(cpu->mem, _t1461, cpu->f[0]);
         /* 021F326C */ /* nop */
   L_021F3270: ; // 0x21f3270
-        /* 021F3270 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021F3274 */ _t1462 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3270 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021F3274 */ _t1462 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3274 */ _t1463 = _t1462 & 0x00000001u;
         /* 021F3274 */ if (_t1463) goto L_021F3280; else goto L_021F3278;
   L_021F3278: ; // 0x21f3278
@@ -12538,8 +12538,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F327C */ _t1465 = cpu->r[30] + 0x00000000u;
         /* 021F327C */ cpu->r[7] = rbrew_read32(cpu->mem, _t1465);
   L_021F3280: ; // 0x21f3280
-        /* 021F3280 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021F3284 */ _t1466 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3280 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021F3284 */ _t1466 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3284 */ _t1467 = _t1466 & 0x00000001u;
         /* 021F3284 */ if (_t1467) goto L_021F32A0; else goto L_021F3288;
   L_021F3288: ; // 0x21f3288
@@ -12567,39 +12567,39 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F32B0 */ _t1477 = cpu->r[9] + 0x00000004u;
         /* 021F32B0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t1477);
         /* 021F32B4 */ cpu->r[3] = cpu->r[5] - cpu->r[0];
-        /* 021F32B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], cpu->r[10]);
+        /* 021F32B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], cpu->r[10]));
         /* 021F32BC */ _t1478 = cpu->r[1] + 0x00000358u;
         /* 021F32BC */ rbrew_write32(cpu->mem, _t1478, cpu->r[3]);
-        /* 021F32C0 */ _t1479 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F32C0 */ _t1479 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F32C0 */ _t1480 = _t1479 & 0x00000001u;
         /* 021F32C0 */ if (_t1480) goto L_021F32E0; else goto L_021F32C4;
   L_021F32C4: ; // 0x21f32c4
         /* 021F32C4 */ _t1481 = cpu->r[3] + 0x0000001Cu;
         /* 021F32C4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1481);
-        /* 021F32C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000002u);
-        /* 021F32CC */ _t1482 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F32C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000002u));
+        /* 021F32CC */ _t1482 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F32CC */ _t1483 = _t1482 & 0x00000001u;
         /* 021F32CC */ if (_t1483) goto L_021F32D8; else goto L_021F32D0;
   L_021F32D0: ; // 0x21f32d0
-        /* 021F32D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000003u);
-        /* 021F32D4 */ _t1484 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F32D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000003u));
+        /* 021F32D4 */ _t1484 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F32D4 */ _t1485 = _t1484 & 0x00000001u;
         /* 021F32D4 */ if (_t1485) goto L_021F32D8; else goto L_021F32AC;
   L_021F32D8: ; // 0x21f32d8
-        /* 021F32D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], cpu->r[10]);
-        /* 021F32DC */ _t1486 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F32D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], cpu->r[10]));
+        /* 021F32DC */ _t1486 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F32DC */ _t1487 = _t1486 & 0x00000001u;
         /* 021F32DC */ if (_t1487) goto L_021F32E0; else goto L_021F3028;
   L_021F32E0: ; // 0x21f32e0
         /* 021F32E0 */ _t1488 = cpu->r[1] + 0x00000081u;
         /* 021F32E0 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1488);
-        /* 021F32E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021F32E8 */ _t1489 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F32E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021F32E8 */ _t1489 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F32E8 */ _t1490 = _t1489 & 0x00000001u;
         /* 021F32E8 */ if (_t1490) goto L_021F32EC; else goto L_021F32F4;
   L_021F32EC: ; // 0x21f32ec
-        /* 021F32EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[16], 0x00000000u);
-        /* 021F32F0 */ _t1491 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F32EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[16], 0x00000000u));
+        /* 021F32F0 */ _t1491 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F32F0 */ _t1492 = _t1491 & 0x00000001u;
         /* 021F32F0 */ if (_t1492) goto L_021F3984; else goto L_021F32F4;
   L_021F32F4: ; // 0x21f32f4
@@ -12609,8 +12609,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F32F8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1494);
         /* 021F32FC */ _t1495 = cpu->r[7] + 0x000000E0u;
         /* 021F32FC */ cpu->r[0] = rbrew_read32(cpu->mem, _t1495);
-        /* 021F3300 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021F3304 */ _t1496 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3300 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021F3304 */ _t1496 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3304 */ _t1497 = _t1496 & 0x00000001u;
         /* 021F3304 */ if (_t1497) goto L_021F3620; else goto L_021F3308;
   L_021F3308: ; // 0x21f3308
@@ -12654,8 +12654,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3354 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1515);
         /* 021F3358 */ _t1516 = cpu->r[1] + 0x0000031Cu;
         /* 021F3358 */ cpu->r[0] = rbrew_read32(cpu->mem, _t1516);
-        /* 021F335C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[0]);
-        /* 021F3360 */ _t1517 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F335C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[0]));
+        /* 021F3360 */ _t1517 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3360 */ _t1518 = _t1517 & 0x00000001u;
         /* 021F3360 */ if (_t1518) goto L_021F3620; else goto L_021F3364;
   L_021F3364: ; // 0x21f3364
@@ -12672,8 +12672,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3378 */ cpu->r[6] = rbrew_read32(cpu->mem, _t1522);
         /* 021F337C */ _t1523 = cpu->r[20] + 0x0000002Cu;
         /* 021F337C */ cpu->r[5] = rbrew_read32(cpu->mem, _t1523);
-        /* 021F3380 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[5]);
-        /* 021F3384 */ _t1524 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3380 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[5]));
+        /* 021F3384 */ _t1524 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3384 */ _t1525 = _t1524 & 0x00000001u;
         /* 021F3384 */ if (_t1525) goto L_021F35E0; else goto L_021F3388;
   L_021F3388: ; // 0x21f3388
@@ -12703,8 +12703,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F33BC */ cpu->r[4] = cpu->r[1] + 0x000004B4u;
         /* 021F33C0 */ cpu->r[3] = cpu->r[1] + 0x00000158u;
         /* 021F33C4 */ Gambit_fn_027DE3CC(cpu);
-        /* 021F33C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F33CC */ _t1536 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F33C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F33CC */ _t1536 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F33CC */ _t1537 = _t1536 & 0x00000001u;
         /* 021F33CC */ if (_t1537) goto L_021F35E0; else goto L_021F33D0;
   L_021F33D0: ; // 0x21f33d0
@@ -12796,8 +12796,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F349C */ _t1572 = cpu->r[1] + 0x00000290u;
         /* 021F349C */ rbrew_write32(cpu->mem, _t1572, cpu->r[0]);
         /* 021F34A0 */ Gambit_fn_021F5324(cpu);
-        /* 021F34A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F34A8 */ _t1573 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F34A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F34A8 */ _t1573 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F34A8 */ _t1574 = _t1573 & 0x00000001u;
         /* 021F34A8 */ if (_t1574) goto L_021F34C4; else goto L_021F34AC;
   L_021F34AC: ; // 0x21f34ac
@@ -12814,8 +12814,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F34C0 */ _t1580 = cpu->r[31] + 0x00000008u;
         /* 021F34C0 */ rbrew_write32(cpu->mem, _t1580, cpu->r[9]);
   L_021F34C4: ; // 0x21f34c4
-        /* 021F34C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021F34C8 */ _t1581 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F34C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021F34C8 */ _t1581 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F34C8 */ _t1582 = _t1581 & 0x00000001u;
         /* 021F34C8 */ if (_t1582) goto L_021F34E4; else goto L_021F34CC;
   L_021F34CC: ; // 0x21f34cc
@@ -12852,7 +12852,7 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3510 */ rbrew_write_f32(cpu->mem, _t1594, cpu->f[8]);
         /* 021F3514 */ _t1595 = cpu->r[1] + 0x000000A0u;
         /* 021F3514 */ rbrew_write_f32(cpu->mem, _t1595, cpu->f[10]);
-        /* 021F3518 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021F3518 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021F351C */ _t1596 = cpu->r[1] + 0x000000A4u;
         /* 021F351C */ rbrew_write_f32(cpu->mem, _t1596, cpu->f[8]);
         /* 021F3520 */ cpu->r[22] = 0x00000000u;
@@ -12861,7 +12861,7 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3528 */ cpu->r[15] = cpu->r[22];
         /* 021F352C */ _t1598 = cpu->r[1] + 0x000000A8u;
         /* 021F352C */ rbrew_write_f32(cpu->mem, _t1598, cpu->f[0]);
-        /* 021F3530 */ _t1599 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3530 */ _t1599 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3530 */ _t1600 = _t1599 & 0x00000001u;
         /* 021F3530 */ if (_t1600) goto L_021F35B0; else goto L_021F3534;
   L_021F3534: ; // 0x21f3534
@@ -12883,10 +12883,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3560 */ cpu->f[7] = fma(cpu->f[9], cpu->f[9], cpu->f[13]);
         /* 021F3564 */ _t1605 = cpu->r[1] + 0x0000000Cu;
         /* 021F3564 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t1605);
-        /* 021F3568 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[13]);
+        /* 021F3568 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[13]));
         /* 021F356C */ _t1606 = cpu->r[31] + 0x00000008u;
         /* 021F356C */ rbrew_write_f32(cpu->mem, _t1606, cpu->f[9]);
-        /* 021F3570 */ _t1607 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F3570 */ _t1607 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F3570 */ _t1608 = _t1607 & 0x00000001u;
         /* 021F3570 */ if (_t1608) goto L_021F3574; else goto L_021F35B0;
   L_021F3574: ; // 0x21f3574
@@ -12914,8 +12914,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F35A8 */ rbrew_write_f32(cpu->mem, _t1616, cpu->f[8]);
         /* 021F35AC */ /* nop */
   L_021F35B0: ; // 0x21f35b0
-        /* 021F35B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021F35B4 */ _t1617 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F35B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021F35B4 */ _t1617 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F35B4 */ _t1618 = _t1617 & 0x00000001u;
         /* 021F35B4 */ if (_t1618) goto L_021F35C0; else goto L_021F35B8;
   L_021F35B8: ; // 0x21f35b8
@@ -12924,8 +12924,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F35BC */ _t1620 = cpu->r[30] + 0x00000000u;
         /* 021F35BC */ cpu->r[8] = rbrew_read32(cpu->mem, _t1620);
   L_021F35C0: ; // 0x21f35c0
-        /* 021F35C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021F35C4 */ _t1621 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F35C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021F35C4 */ _t1621 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F35C4 */ _t1622 = _t1621 & 0x00000001u;
         /* 021F35C4 */ if (_t1622) goto L_021F35E0; else goto L_021F35C8;
   L_021F35C8: ; // 0x21f35c8
@@ -12953,35 +12953,35 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F35F0 */ _t1632 = cpu->r[6] + 0x00000004u;
         /* 021F35F0 */ cpu->r[6] = rbrew_read32(cpu->mem, _t1632);
         /* 021F35F4 */ cpu->r[7] = cpu->r[6] - cpu->r[0];
-        /* 021F35F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[9]);
+        /* 021F35F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[9]));
         /* 021F35FC */ _t1633 = cpu->r[1] + 0x00000324u;
         /* 021F35FC */ rbrew_write32(cpu->mem, _t1633, cpu->r[7]);
-        /* 021F3600 */ _t1634 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3600 */ _t1634 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3600 */ _t1635 = _t1634 & 0x00000001u;
         /* 021F3600 */ if (_t1635) goto L_021F3620; else goto L_021F3604;
   L_021F3604: ; // 0x21f3604
         /* 021F3604 */ _t1636 = cpu->r[7] + 0x0000001Cu;
         /* 021F3604 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1636);
-        /* 021F3608 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000002u);
-        /* 021F360C */ _t1637 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3608 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000002u));
+        /* 021F360C */ _t1637 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F360C */ _t1638 = _t1637 & 0x00000001u;
         /* 021F360C */ if (_t1638) goto L_021F3618; else goto L_021F3610;
   L_021F3610: ; // 0x21f3610
-        /* 021F3610 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000003u);
-        /* 021F3614 */ _t1639 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3610 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000003u));
+        /* 021F3614 */ _t1639 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3614 */ _t1640 = _t1639 & 0x00000001u;
         /* 021F3614 */ if (_t1640) goto L_021F3618; else goto L_021F35EC;
   L_021F3618: ; // 0x21f3618
-        /* 021F3618 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[9]);
-        /* 021F361C */ _t1641 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3618 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[9]));
+        /* 021F361C */ _t1641 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F361C */ _t1642 = _t1641 & 0x00000001u;
         /* 021F361C */ if (_t1642) goto L_021F3620; else goto L_021F3378;
   L_021F3620: ; // 0x21f3620
         /* 021F3620 */ _t1643 = cpu->r[1] + 0x00000081u;
         /* 021F3620 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1643);
         /* 021F3624 */ cpu->r[7] = cpu->r[12] | cpu->r[16];
-        /* 021F3624 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 021F3628 */ _t1644 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3624 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 021F3628 */ _t1644 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3628 */ _t1645 = _t1644 & 0x00000001u;
         /* 021F3628 */ if (_t1645) goto L_021F3984; else goto L_021F362C;
   L_021F362C: ; // 0x21f362c
@@ -12991,8 +12991,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3630 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1647);
         /* 021F3634 */ _t1648 = cpu->r[8] + 0x0000002Cu;
         /* 021F3634 */ cpu->r[9] = rbrew_read32(cpu->mem, _t1648);
-        /* 021F3638 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 021F363C */ _t1649 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3638 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 021F363C */ _t1649 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F363C */ _t1650 = _t1649 & 0x00000001u;
         /* 021F363C */ if (_t1650) goto L_021F3978; else goto L_021F3640;
   L_021F3640: ; // 0x21f3640
@@ -13036,8 +13036,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F368C */ cpu->r[3] = rbrew_read32(cpu->mem, _t1668);
         /* 021F3690 */ _t1669 = cpu->r[1] + 0x00000368u;
         /* 021F3690 */ cpu->r[5] = rbrew_read32(cpu->mem, _t1669);
-        /* 021F3694 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], cpu->r[5]);
-        /* 021F3698 */ _t1670 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3694 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], cpu->r[5]));
+        /* 021F3698 */ _t1670 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3698 */ _t1671 = _t1670 & 0x00000001u;
         /* 021F3698 */ if (_t1671) goto L_021F3978; else goto L_021F369C;
   L_021F369C: ; // 0x21f369c
@@ -13070,8 +13070,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F36D4 */ _t1683 = cpu->r[1] + 0x00000164u;
         /* 021F36D4 */ rbrew_write32(cpu->mem, _t1683, cpu->r[5]);
         /* 021F36D8 */ Gambit_fn_024BE34C(cpu);
-        /* 021F36DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F36E0 */ _t1684 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F36DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F36E0 */ _t1684 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F36E0 */ _t1685 = _t1684 & 0x00000001u;
         /* 021F36E0 */ if (_t1685) goto L_021F3938; else goto L_021F36E4;
   L_021F36E4: ; // 0x21f36e4
@@ -13079,8 +13079,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F36E8 */ cpu->r[4] = cpu->r[1] + 0x000004D4u;
         /* 021F36EC */ cpu->r[3] = cpu->r[1] + 0x00000158u;
         /* 021F36F0 */ Gambit_fn_027DE3CC(cpu);
-        /* 021F36F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F36F8 */ _t1686 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F36F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F36F8 */ _t1686 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F36F8 */ _t1687 = _t1686 & 0x00000001u;
         /* 021F36F8 */ if (_t1687) goto L_021F3938; else goto L_021F36FC;
   L_021F36FC: ; // 0x21f36fc
@@ -13190,10 +13190,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F37F0 */ rbrew_write32(cpu->mem, _t1729, cpu->r[9]);
         /* 021F37F4 */ _t1730 = cpu->r[1] + 0x000000D8u;
         /* 021F37F4 */ rbrew_write_f32(cpu->mem, _t1730, cpu->f[8]);
-        /* 021F37F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021F37F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021F37FC */ _t1731 = cpu->r[1] + 0x0000010Cu;
         /* 021F37FC */ rbrew_write32(cpu->mem, _t1731, cpu->r[10]);
-        /* 021F3800 */ _t1732 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3800 */ _t1732 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3800 */ _t1733 = _t1732 & 0x00000001u;
         /* 021F3800 */ if (_t1733) goto L_021F381C; else goto L_021F3804;
   L_021F3804: ; // 0x21f3804
@@ -13210,8 +13210,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3818 */ _t1739 = cpu->r[31] + 0x00000008u;
         /* 021F3818 */ rbrew_write32(cpu->mem, _t1739, cpu->r[5]);
   L_021F381C: ; // 0x21f381c
-        /* 021F381C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021F3820 */ _t1740 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F381C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021F3820 */ _t1740 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3820 */ _t1741 = _t1740 & 0x00000001u;
         /* 021F3820 */ if (_t1741) goto L_021F383C; else goto L_021F3824;
   L_021F3824: ; // 0x21f3824
@@ -13248,7 +13248,7 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3868 */ rbrew_write_f32(cpu->mem, _t1753, cpu->f[8]);
         /* 021F386C */ _t1754 = cpu->r[1] + 0x000000A0u;
         /* 021F386C */ rbrew_write_f32(cpu->mem, _t1754, cpu->f[10]);
-        /* 021F3870 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021F3870 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021F3874 */ _t1755 = cpu->r[1] + 0x000000A4u;
         /* 021F3874 */ rbrew_write_f32(cpu->mem, _t1755, cpu->f[8]);
         /* 021F3878 */ cpu->r[22] = 0x00000000u;
@@ -13257,7 +13257,7 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3880 */ cpu->r[15] = cpu->r[22];
         /* 021F3884 */ _t1757 = cpu->r[1] + 0x000000A8u;
         /* 021F3884 */ rbrew_write_f32(cpu->mem, _t1757, cpu->f[0]);
-        /* 021F3888 */ _t1758 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3888 */ _t1758 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3888 */ _t1759 = _t1758 & 0x00000001u;
         /* 021F3888 */ if (_t1759) goto L_021F3908; else goto L_021F388C;
   L_021F388C: ; // 0x21f388c
@@ -13279,10 +13279,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F38B8 */ cpu->f[12] = fma(cpu->f[9], cpu->f[9], cpu->f[8]);
         /* 021F38BC */ _t1764 = cpu->r[1] + 0x0000000Cu;
         /* 021F38BC */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t1764);
-        /* 021F38C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[7]);
+        /* 021F38C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[7]));
         /* 021F38C4 */ _t1765 = cpu->r[31] + 0x00000008u;
         /* 021F38C4 */ rbrew_write_f32(cpu->mem, _t1765, cpu->f[9]);
-        /* 021F38C8 */ _t1766 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F38C8 */ _t1766 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F38C8 */ _t1767 = _t1766 & 0x00000001u;
         /* 021F38C8 */ if (_t1767) goto L_021F38CC; else goto L_021F3908;
   L_021F38CC: ; // 0x21f38cc
@@ -13310,8 +13310,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3900 */ rbrew_write_f32(cpu->mem, _t1775, cpu->f[0]);
         /* 021F3904 */ /* nop */
   L_021F3908: ; // 0x21f3908
-        /* 021F3908 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021F390C */ _t1776 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3908 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021F390C */ _t1776 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F390C */ _t1777 = _t1776 & 0x00000001u;
         /* 021F390C */ if (_t1777) goto L_021F3918; else goto L_021F3910;
   L_021F3910: ; // 0x21f3910
@@ -13320,8 +13320,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3914 */ _t1779 = cpu->r[30] + 0x00000000u;
         /* 021F3914 */ cpu->r[5] = rbrew_read32(cpu->mem, _t1779);
   L_021F3918: ; // 0x21f3918
-        /* 021F3918 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021F391C */ _t1780 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021F391C */ _t1780 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F391C */ _t1781 = _t1780 & 0x00000001u;
         /* 021F391C */ if (_t1781) goto L_021F3938; else goto L_021F3920;
   L_021F3920: ; // 0x21f3920
@@ -13349,39 +13349,39 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3948 */ _t1791 = cpu->r[5] + 0x00000004u;
         /* 021F3948 */ cpu->r[10] = rbrew_read32(cpu->mem, _t1791);
         /* 021F394C */ cpu->r[3] = cpu->r[10] - cpu->r[7];
-        /* 021F3950 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], cpu->r[8]);
+        /* 021F3950 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], cpu->r[8]));
         /* 021F3954 */ _t1792 = cpu->r[1] + 0x00000370u;
         /* 021F3954 */ rbrew_write32(cpu->mem, _t1792, cpu->r[3]);
-        /* 021F3958 */ _t1793 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3958 */ _t1793 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3958 */ _t1794 = _t1793 & 0x00000001u;
         /* 021F3958 */ if (_t1794) goto L_021F3978; else goto L_021F395C;
   L_021F395C: ; // 0x21f395c
         /* 021F395C */ _t1795 = cpu->r[3] + 0x0000001Cu;
         /* 021F395C */ cpu->r[0] = rbrew_read32(cpu->mem, _t1795);
-        /* 021F3960 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021F3964 */ _t1796 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3960 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021F3964 */ _t1796 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3964 */ _t1797 = _t1796 & 0x00000001u;
         /* 021F3964 */ if (_t1797) goto L_021F3970; else goto L_021F3968;
   L_021F3968: ; // 0x21f3968
-        /* 021F3968 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021F396C */ _t1798 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3968 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021F396C */ _t1798 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F396C */ _t1799 = _t1798 & 0x00000001u;
         /* 021F396C */ if (_t1799) goto L_021F3970; else goto L_021F3944;
   L_021F3970: ; // 0x21f3970
-        /* 021F3970 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], cpu->r[8]);
-        /* 021F3974 */ _t1800 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3970 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], cpu->r[8]));
+        /* 021F3974 */ _t1800 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3974 */ _t1801 = _t1800 & 0x00000001u;
         /* 021F3974 */ if (_t1801) goto L_021F3978; else goto L_021F36B0;
   L_021F3978: ; // 0x21f3978
         /* 021F3978 */ _t1802 = cpu->r[1] + 0x00000081u;
         /* 021F3978 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1802);
-        /* 021F397C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021F3980 */ _t1803 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F397C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021F3980 */ _t1803 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3980 */ _t1804 = _t1803 & 0x00000001u;
         /* 021F3980 */ if (_t1804) goto L_021F3984; else goto L_021F398C;
   L_021F3984: ; // 0x21f3984
-        /* 021F3984 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[15], 0x00000000u);
-        /* 021F3988 */ _t1805 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3984 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[15], 0x00000000u));
+        /* 021F3988 */ _t1805 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3988 */ _t1806 = _t1805 & 0x00000001u;
         /* 021F3988 */ if (_t1806) goto L_021F3CD0; else goto L_021F398C;
   L_021F398C: ; // 0x21f398c
@@ -13391,8 +13391,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3990 */ cpu->r[5] = rbrew_read32(cpu->mem, _t1808);
         /* 021F3994 */ _t1809 = cpu->r[5] + 0x000000DCu;
         /* 021F3994 */ cpu->r[6] = rbrew_read32(cpu->mem, _t1809);
-        /* 021F3998 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 021F399C */ _t1810 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3998 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 021F399C */ _t1810 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F399C */ _t1811 = _t1810 & 0x00000001u;
         /* 021F399C */ if (_t1811) goto L_021F3CC4; else goto L_021F39A0;
   L_021F39A0: ; // 0x21f39a0
@@ -13436,8 +13436,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F39EC */ cpu->r[8] = rbrew_read32(cpu->mem, _t1829);
         /* 021F39F0 */ _t1830 = cpu->r[1] + 0x00000334u;
         /* 021F39F0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t1830);
-        /* 021F39F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[0]);
-        /* 021F39F8 */ _t1831 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F39F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[0]));
+        /* 021F39F8 */ _t1831 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F39F8 */ _t1832 = _t1831 & 0x00000001u;
         /* 021F39F8 */ if (_t1832) goto L_021F3CC4; else goto L_021F39FC;
   L_021F39FC: ; // 0x21f39fc
@@ -13454,8 +13454,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3A10 */ cpu->r[9] = rbrew_read32(cpu->mem, _t1836);
         /* 021F3A14 */ _t1837 = cpu->r[20] + 0x0000002Cu;
         /* 021F3A14 */ cpu->r[0] = rbrew_read32(cpu->mem, _t1837);
-        /* 021F3A18 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[0]);
-        /* 021F3A1C */ _t1838 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3A18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[0]));
+        /* 021F3A1C */ _t1838 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3A1C */ _t1839 = _t1838 & 0x00000001u;
         /* 021F3A1C */ if (_t1839) goto L_021F3C84; else goto L_021F3A20;
   L_021F3A20: ; // 0x21f3a20
@@ -13485,8 +13485,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3A54 */ cpu->r[4] = cpu->r[1] + 0x000004F4u;
         /* 021F3A58 */ cpu->r[3] = cpu->r[1] + 0x00000158u;
         /* 021F3A5C */ Gambit_fn_027DE3CC(cpu);
-        /* 021F3A60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F3A64 */ _t1850 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3A60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F3A64 */ _t1850 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3A64 */ _t1851 = _t1850 & 0x00000001u;
         /* 021F3A64 */ if (_t1851) goto L_021F3C84; else goto L_021F3A68;
   L_021F3A68: ; // 0x21f3a68
@@ -13577,10 +13577,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3B3C */ rbrew_write32(cpu->mem, _t1882, cpu->r[0]);
         /* 021F3B40 */ _t1883 = cpu->r[1] + 0x000000D4u;
         /* 021F3B40 */ rbrew_write32(cpu->mem, _t1883, cpu->r[6]);
-        /* 021F3B44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021F3B44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021F3B48 */ _t1884 = cpu->r[1] + 0x000000D8u;
         /* 021F3B48 */ rbrew_write32(cpu->mem, _t1884, cpu->r[8]);
-        /* 021F3B4C */ _t1885 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3B4C */ _t1885 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3B4C */ _t1886 = _t1885 & 0x00000001u;
         /* 021F3B4C */ if (_t1886) goto L_021F3B68; else goto L_021F3B50;
   L_021F3B50: ; // 0x21f3b50
@@ -13597,8 +13597,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3B64 */ _t1892 = cpu->r[31] + 0x00000008u;
         /* 021F3B64 */ rbrew_write32(cpu->mem, _t1892, cpu->r[6]);
   L_021F3B68: ; // 0x21f3b68
-        /* 021F3B68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021F3B6C */ _t1893 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3B68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021F3B6C */ _t1893 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3B6C */ _t1894 = _t1893 & 0x00000001u;
         /* 021F3B6C */ if (_t1894) goto L_021F3B88; else goto L_021F3B70;
   L_021F3B70: ; // 0x21f3b70
@@ -13635,7 +13635,7 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3BB4 */ rbrew_write_f32(cpu->mem, _t1906, cpu->f[8]);
         /* 021F3BB8 */ _t1907 = cpu->r[1] + 0x000000A0u;
         /* 021F3BB8 */ rbrew_write_f32(cpu->mem, _t1907, cpu->f[10]);
-        /* 021F3BBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021F3BBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021F3BC0 */ _t1908 = cpu->r[1] + 0x000000A4u;
         /* 021F3BC0 */ rbrew_write_f32(cpu->mem, _t1908, cpu->f[8]);
         /* 021F3BC4 */ cpu->r[22] = 0x00000000u;
@@ -13644,7 +13644,7 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3BCC */ cpu->r[16] = cpu->r[22];
         /* 021F3BD0 */ _t1910 = cpu->r[1] + 0x000000A8u;
         /* 021F3BD0 */ rbrew_write_f32(cpu->mem, _t1910, cpu->f[0]);
-        /* 021F3BD4 */ _t1911 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3BD4 */ _t1911 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3BD4 */ _t1912 = _t1911 & 0x00000001u;
         /* 021F3BD4 */ if (_t1912) goto L_021F3C54; else goto L_021F3BD8;
   L_021F3BD8: ; // 0x21f3bd8
@@ -13666,10 +13666,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3C04 */ cpu->f[13] = fma(cpu->f[9], cpu->f[9], cpu->f[13]);
         /* 021F3C08 */ _t1917 = cpu->r[1] + 0x0000000Cu;
         /* 021F3C08 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t1917);
-        /* 021F3C0C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[8]);
+        /* 021F3C0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[8]));
         /* 021F3C10 */ _t1918 = cpu->r[31] + 0x00000008u;
         /* 021F3C10 */ rbrew_write_f32(cpu->mem, _t1918, cpu->f[9]);
-        /* 021F3C14 */ _t1919 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F3C14 */ _t1919 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F3C14 */ _t1920 = _t1919 & 0x00000001u;
         /* 021F3C14 */ if (_t1920) goto L_021F3C18; else goto L_021F3C54;
   L_021F3C18: ; // 0x21f3c18
@@ -13697,8 +13697,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3C4C */ rbrew_write_f32(cpu->mem, _t1928, cpu->f[11]);
         /* 021F3C50 */ /* nop */
   L_021F3C54: ; // 0x21f3c54
-        /* 021F3C54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021F3C58 */ _t1929 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3C54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021F3C58 */ _t1929 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3C58 */ _t1930 = _t1929 & 0x00000001u;
         /* 021F3C58 */ if (_t1930) goto L_021F3C64; else goto L_021F3C5C;
   L_021F3C5C: ; // 0x21f3c5c
@@ -13707,8 +13707,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3C60 */ _t1932 = cpu->r[30] + 0x00000000u;
         /* 021F3C60 */ cpu->r[6] = rbrew_read32(cpu->mem, _t1932);
   L_021F3C64: ; // 0x21f3c64
-        /* 021F3C64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021F3C68 */ _t1933 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3C64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021F3C68 */ _t1933 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3C68 */ _t1934 = _t1933 & 0x00000001u;
         /* 021F3C68 */ if (_t1934) goto L_021F3C84; else goto L_021F3C6C;
   L_021F3C6C: ; // 0x21f3c6c
@@ -13736,39 +13736,39 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3C94 */ _t1944 = cpu->r[6] + 0x00000004u;
         /* 021F3C94 */ cpu->r[5] = rbrew_read32(cpu->mem, _t1944);
         /* 021F3C98 */ cpu->r[8] = cpu->r[5] - cpu->r[0];
-        /* 021F3C9C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021F3C9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021F3CA0 */ _t1945 = cpu->r[1] + 0x0000033Cu;
         /* 021F3CA0 */ rbrew_write32(cpu->mem, _t1945, cpu->r[8]);
-        /* 021F3CA4 */ _t1946 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3CA4 */ _t1946 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3CA4 */ _t1947 = _t1946 & 0x00000001u;
         /* 021F3CA4 */ if (_t1947) goto L_021F3CC4; else goto L_021F3CA8;
   L_021F3CA8: ; // 0x21f3ca8
         /* 021F3CA8 */ _t1948 = cpu->r[8] + 0x0000001Cu;
         /* 021F3CA8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t1948);
-        /* 021F3CAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000002u);
-        /* 021F3CB0 */ _t1949 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3CAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000002u));
+        /* 021F3CB0 */ _t1949 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3CB0 */ _t1950 = _t1949 & 0x00000001u;
         /* 021F3CB0 */ if (_t1950) goto L_021F3CBC; else goto L_021F3CB4;
   L_021F3CB4: ; // 0x21f3cb4
-        /* 021F3CB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000003u);
-        /* 021F3CB8 */ _t1951 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3CB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000003u));
+        /* 021F3CB8 */ _t1951 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3CB8 */ _t1952 = _t1951 & 0x00000001u;
         /* 021F3CB8 */ if (_t1952) goto L_021F3CBC; else goto L_021F3C90;
   L_021F3CBC: ; // 0x21f3cbc
-        /* 021F3CBC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
-        /* 021F3CC0 */ _t1953 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3CBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
+        /* 021F3CC0 */ _t1953 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3CC0 */ _t1954 = _t1953 & 0x00000001u;
         /* 021F3CC0 */ if (_t1954) goto L_021F3CC4; else goto L_021F3A10;
   L_021F3CC4: ; // 0x21f3cc4
         /* 021F3CC4 */ _t1955 = cpu->r[1] + 0x00000081u;
         /* 021F3CC4 */ cpu->r[12] = rbrew_read8(cpu->mem, _t1955);
-        /* 021F3CC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021F3CCC */ _t1956 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3CC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021F3CCC */ _t1956 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3CCC */ _t1957 = _t1956 & 0x00000001u;
         /* 021F3CCC */ if (_t1957) goto L_021F3CD0; else goto L_021F3CD8;
   L_021F3CD0: ; // 0x21f3cd0
-        /* 021F3CD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[16], 0x00000000u);
-        /* 021F3CD4 */ _t1958 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3CD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[16], 0x00000000u));
+        /* 021F3CD4 */ _t1958 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3CD4 */ _t1959 = _t1958 & 0x00000001u;
         /* 021F3CD4 */ if (_t1959) goto L_021F4014; else goto L_021F3CD8;
   L_021F3CD8: ; // 0x21f3cd8
@@ -13778,8 +13778,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3CDC */ cpu->r[7] = rbrew_read32(cpu->mem, _t1961);
         /* 021F3CE0 */ _t1962 = cpu->r[7] + 0x0000006Cu;
         /* 021F3CE0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1962);
-        /* 021F3CE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021F3CE8 */ _t1963 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3CE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021F3CE8 */ _t1963 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3CE8 */ _t1964 = _t1963 & 0x00000001u;
         /* 021F3CE8 */ if (_t1964) goto L_021F4014; else goto L_021F3CEC;
   L_021F3CEC: ; // 0x21f3cec
@@ -13823,8 +13823,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3D38 */ cpu->r[3] = rbrew_read32(cpu->mem, _t1982);
         /* 021F3D3C */ _t1983 = cpu->r[1] + 0x00000380u;
         /* 021F3D3C */ cpu->r[10] = rbrew_read32(cpu->mem, _t1983);
-        /* 021F3D40 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], cpu->r[10]);
-        /* 021F3D44 */ _t1984 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3D40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], cpu->r[10]));
+        /* 021F3D44 */ _t1984 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3D44 */ _t1985 = _t1984 & 0x00000001u;
         /* 021F3D44 */ if (_t1985) goto L_021F4014; else goto L_021F3D48;
   L_021F3D48: ; // 0x21f3d48
@@ -13841,8 +13841,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3D5C */ cpu->r[5] = rbrew_read32(cpu->mem, _t1989);
         /* 021F3D60 */ _t1990 = cpu->r[20] + 0x0000002Cu;
         /* 021F3D60 */ cpu->r[10] = rbrew_read32(cpu->mem, _t1990);
-        /* 021F3D64 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[10]);
-        /* 021F3D68 */ _t1991 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3D64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[10]));
+        /* 021F3D68 */ _t1991 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3D68 */ _t1992 = _t1991 & 0x00000001u;
         /* 021F3D68 */ if (_t1992) goto L_021F3FD4; else goto L_021F3D6C;
   L_021F3D6C: ; // 0x21f3d6c
@@ -13866,8 +13866,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3D90 */ _t2001 = cpu->r[1] + 0x00000164u;
         /* 021F3D90 */ rbrew_write32(cpu->mem, _t2001, cpu->r[0]);
         /* 021F3D94 */ Gambit_fn_024D2F88(cpu);
-        /* 021F3D98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F3D9C */ _t2002 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3D98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F3D9C */ _t2002 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3D9C */ _t2003 = _t2002 & 0x00000001u;
         /* 021F3D9C */ if (_t2003) goto L_021F3FD4; else goto L_021F3DA0;
   L_021F3DA0: ; // 0x21f3da0
@@ -13875,8 +13875,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3DA4 */ cpu->r[4] = cpu->r[1] + 0x00000514u;
         /* 021F3DA8 */ cpu->r[3] = cpu->r[1] + 0x00000158u;
         /* 021F3DAC */ Gambit_fn_027DE3CC(cpu);
-        /* 021F3DB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F3DB4 */ _t2004 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3DB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F3DB4 */ _t2004 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3DB4 */ _t2005 = _t2004 & 0x00000001u;
         /* 021F3DB4 */ if (_t2005) goto L_021F3FD4; else goto L_021F3DB8;
   L_021F3DB8: ; // 0x21f3db8
@@ -13969,10 +13969,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3E8C */ rbrew_write32(cpu->mem, _t2038, cpu->r[10]);
         /* 021F3E90 */ _t2039 = cpu->r[1] + 0x00000108u;
         /* 021F3E90 */ rbrew_write32(cpu->mem, _t2039, cpu->r[0]);
-        /* 021F3E94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021F3E94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021F3E98 */ _t2040 = cpu->r[1] + 0x0000010Cu;
         /* 021F3E98 */ rbrew_write32(cpu->mem, _t2040, cpu->r[6]);
-        /* 021F3E9C */ _t2041 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3E9C */ _t2041 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3E9C */ _t2042 = _t2041 & 0x00000001u;
         /* 021F3E9C */ if (_t2042) goto L_021F3EB8; else goto L_021F3EA0;
   L_021F3EA0: ; // 0x21f3ea0
@@ -13989,8 +13989,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3EB4 */ _t2048 = cpu->r[31] + 0x00000008u;
         /* 021F3EB4 */ rbrew_write32(cpu->mem, _t2048, cpu->r[9]);
   L_021F3EB8: ; // 0x21f3eb8
-        /* 021F3EB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 021F3EBC */ _t2049 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3EB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 021F3EBC */ _t2049 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3EBC */ _t2050 = _t2049 & 0x00000001u;
         /* 021F3EBC */ if (_t2050) goto L_021F3ED8; else goto L_021F3EC0;
   L_021F3EC0: ; // 0x21f3ec0
@@ -14027,7 +14027,7 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3F04 */ rbrew_write_f32(cpu->mem, _t2062, cpu->f[8]);
         /* 021F3F08 */ _t2063 = cpu->r[1] + 0x000000A0u;
         /* 021F3F08 */ rbrew_write_f32(cpu->mem, _t2063, cpu->f[10]);
-        /* 021F3F0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021F3F0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021F3F10 */ _t2064 = cpu->r[1] + 0x000000A4u;
         /* 021F3F10 */ rbrew_write_f32(cpu->mem, _t2064, cpu->f[8]);
         /* 021F3F14 */ cpu->r[22] = 0x00000000u;
@@ -14036,7 +14036,7 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3F1C */ cpu->r[15] = cpu->r[22];
         /* 021F3F20 */ _t2066 = cpu->r[1] + 0x000000A8u;
         /* 021F3F20 */ rbrew_write_f32(cpu->mem, _t2066, cpu->f[0]);
-        /* 021F3F24 */ _t2067 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3F24 */ _t2067 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3F24 */ _t2068 = _t2067 & 0x00000001u;
         /* 021F3F24 */ if (_t2068) goto L_021F3FA4; else goto L_021F3F28;
   L_021F3F28: ; // 0x21f3f28
@@ -14058,10 +14058,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3F54 */ cpu->f[8] = fma(cpu->f[9], cpu->f[9], cpu->f[10]);
         /* 021F3F58 */ _t2073 = cpu->r[1] + 0x0000000Cu;
         /* 021F3F58 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t2073);
-        /* 021F3F5C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[10]);
+        /* 021F3F5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[10]));
         /* 021F3F60 */ _t2074 = cpu->r[31] + 0x00000008u;
         /* 021F3F60 */ rbrew_write_f32(cpu->mem, _t2074, cpu->f[9]);
-        /* 021F3F64 */ _t2075 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F3F64 */ _t2075 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F3F64 */ _t2076 = _t2075 & 0x00000001u;
         /* 021F3F64 */ if (_t2076) goto L_021F3F68; else goto L_021F3FA4;
   L_021F3F68: ; // 0x21f3f68
@@ -14089,8 +14089,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3F9C */ rbrew_write_f32(cpu->mem, _t2084, cpu->f[0]);
         /* 021F3FA0 */ /* nop */
   L_021F3FA4: ; // 0x21f3fa4
-        /* 021F3FA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021F3FA8 */ _t2085 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3FA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021F3FA8 */ _t2085 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3FA8 */ _t2086 = _t2085 & 0x00000001u;
         /* 021F3FA8 */ if (_t2086) goto L_021F3FB4; else goto L_021F3FAC;
   L_021F3FAC: ; // 0x21f3fac
@@ -14099,8 +14099,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3FB0 */ _t2088 = cpu->r[30] + 0x00000000u;
         /* 021F3FB0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t2088);
   L_021F3FB4: ; // 0x21f3fb4
-        /* 021F3FB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021F3FB8 */ _t2089 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3FB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021F3FB8 */ _t2089 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3FB8 */ _t2090 = _t2089 & 0x00000001u;
         /* 021F3FB8 */ if (_t2090) goto L_021F3FD4; else goto L_021F3FBC;
   L_021F3FBC: ; // 0x21f3fbc
@@ -14128,27 +14128,27 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F3FE4 */ _t2100 = cpu->r[5] + 0x00000004u;
         /* 021F3FE4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t2100);
         /* 021F3FE8 */ cpu->r[3] = cpu->r[9] - cpu->r[0];
-        /* 021F3FEC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], cpu->r[6]);
+        /* 021F3FEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], cpu->r[6]));
         /* 021F3FF0 */ _t2101 = cpu->r[1] + 0x00000388u;
         /* 021F3FF0 */ rbrew_write32(cpu->mem, _t2101, cpu->r[3]);
-        /* 021F3FF4 */ _t2102 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3FF4 */ _t2102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F3FF4 */ _t2103 = _t2102 & 0x00000001u;
         /* 021F3FF4 */ if (_t2103) goto L_021F4014; else goto L_021F3FF8;
   L_021F3FF8: ; // 0x21f3ff8
         /* 021F3FF8 */ _t2104 = cpu->r[3] + 0x0000001Cu;
         /* 021F3FF8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t2104);
-        /* 021F3FFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000002u);
-        /* 021F4000 */ _t2105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F3FFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000002u));
+        /* 021F4000 */ _t2105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4000 */ _t2106 = _t2105 & 0x00000001u;
         /* 021F4000 */ if (_t2106) goto L_021F400C; else goto L_021F4004;
   L_021F4004: ; // 0x21f4004
-        /* 021F4004 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000003u);
-        /* 021F4008 */ _t2107 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4004 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000003u));
+        /* 021F4008 */ _t2107 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4008 */ _t2108 = _t2107 & 0x00000001u;
         /* 021F4008 */ if (_t2108) goto L_021F400C; else goto L_021F3FE0;
   L_021F400C: ; // 0x21f400c
-        /* 021F400C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], cpu->r[6]);
-        /* 021F4010 */ _t2109 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F400C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], cpu->r[6]));
+        /* 021F4010 */ _t2109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4010 */ _t2110 = _t2109 & 0x00000001u;
         /* 021F4010 */ if (_t2110) goto L_021F4014; else goto L_021F3D5C;
   L_021F4014: ; // 0x21f4014
@@ -14165,17 +14165,17 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F4028 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t2115);
         /* 021F402C */ cpu->r[0] = cpu->r[12] | cpu->r[11];
         /* 021F4030 */ cpu->r[6] = cpu->r[0] | cpu->r[5];
-        /* 021F4030 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 021F4030 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 021F4034 */ _t2116 = cpu->r[1] + 0x0000000Cu;
         /* 021F4034 */ rbrew_write_f32(cpu->mem, _t2116, cpu->f[10]);
-        /* 021F4038 */ _t2117 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4038 */ _t2117 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4038 */ _t2118 = _t2117 & 0x00000001u;
         /* 021F4038 */ if (_t2118) goto L_021F403C; else goto L_021F40B0;
   L_021F403C: ; // 0x21f403c
         /* 021F403C */ _t2119 = cpu->r[1] + 0x00000081u;
         /* 021F403C */ cpu->r[12] = rbrew_read8(cpu->mem, _t2119);
-        /* 021F4040 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021F4044 */ _t2120 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4040 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021F4044 */ _t2120 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4044 */ _t2121 = _t2120 & 0x00000001u;
         /* 021F4044 */ if (_t2121) goto L_021F4048; else goto L_021F42B0;
   L_021F4048: ; // 0x21f4048
@@ -14216,7 +14216,7 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F40A0 */ rbrew_write8(cpu->mem, _t2133, (uint8_t)cpu->r[12]);
         /* 021F40A4 */ _t2134 = cpu->r[1] + 0x0000008Cu;
         /* 021F40A4 */ rbrew_write_f32(cpu->mem, _t2134, cpu->f[8]);
-        /* 021F40A8 */ _t2135 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F40A8 */ _t2135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F40A8 */ _t2136 = _t2135 & 0x00000001u;
         /* 021F40A8 */ if (_t2136) goto L_021F40AC; else goto L_021F16C0;
   L_021F40AC: ; // 0x21f40ac
@@ -14226,20 +14226,20 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F40B0 */ cpu->r[12] = rbrew_read8(cpu->mem, _t2137);
         /* 021F40B4 */ cpu->r[7] = cpu->r[22] | cpu->r[12];
         /* 021F40B8 */ cpu->r[9] = cpu->r[7] | cpu->r[16];
-        /* 021F40B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 021F40BC */ _t2138 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F40B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 021F40BC */ _t2138 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F40BC */ _t2139 = _t2138 & 0x00000001u;
         /* 021F40BC */ if (_t2139) goto L_021F40C0; else goto L_021F42B0;
   L_021F40C0: ; // 0x21f40c0
         /* 021F40C0 */ _t2140 = cpu->r[1] + 0x00000081u;
         /* 021F40C0 */ cpu->r[12] = rbrew_read8(cpu->mem, _t2140);
-        /* 021F40C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021F40C8 */ _t2141 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F40C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021F40C8 */ _t2141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F40C8 */ _t2142 = _t2141 & 0x00000001u;
         /* 021F40C8 */ if (_t2142) goto L_021F41EC; else goto L_021F40CC;
   L_021F40CC: ; // 0x21f40cc
-        /* 021F40CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021F40D0 */ _t2143 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F40CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021F40D0 */ _t2143 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F40D0 */ _t2144 = _t2143 & 0x00000001u;
         /* 021F40D0 */ if (_t2144) goto L_021F412C; else goto L_021F40D4;
   L_021F40D4: ; // 0x21f40d4
@@ -14286,10 +14286,10 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F4134 */ cpu->f[8] = cpu->f[0] - cpu->f[7];
         /* 021F4138 */ _t2160 = cpu->r[1] + 0x00000048u;
         /* 021F4138 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t2160);
-        /* 021F413C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[13]);
+        /* 021F413C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[13]));
         /* 021F4140 */ _t2161 = cpu->r[1] + 0x0000008Cu;
         /* 021F4140 */ rbrew_write_f32(cpu->mem, _t2161, cpu->f[7]);
-        /* 021F4144 */ _t2162 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F4144 */ _t2162 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F4144 */ _t2163 = _t2162 & 0x00000001u;
         /* 021F4144 */ if (_t2163) goto L_021F4148; else goto L_021F4294;
   L_021F4148: ; // 0x21f4148
@@ -14359,14 +14359,14 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F41DC */ rbrew_write8(cpu->mem, _t2189, (uint8_t)cpu->r[12]);
         /* 021F41E0 */ _t2190 = cpu->r[1] + 0x00000470u;
         /* 021F41E0 */ rbrew_write_f32(cpu->mem, _t2190, cpu->f[0]);
-        /* 021F41E4 */ _t2191 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F41E4 */ _t2191 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F41E4 */ _t2192 = _t2191 & 0x00000001u;
         /* 021F41E4 */ if (_t2192) goto L_021F41E8; else goto L_021F16C0;
   L_021F41E8: ; // 0x21f41e8
         /* 021F41E8 */ goto L_021F42B0;
   L_021F41EC: ; // 0x21f41ec
-        /* 021F41EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021F41F0 */ _t2193 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F41EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021F41F0 */ _t2193 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F41F0 */ _t2194 = _t2193 & 0x00000001u;
         /* 021F41F0 */ if (_t2194) goto L_021F424C; else goto L_021F41F4;
   L_021F41F4: ; // 0x21f41f4
@@ -14444,7 +14444,7 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F42A4 */ cpu->r[12] = 0x00000000u;
         /* 021F42A8 */ _t2220 = cpu->r[1] + 0x00000081u;
         /* 021F42A8 */ rbrew_write8(cpu->mem, _t2220, (uint8_t)cpu->r[12]);
-        /* 021F42AC */ _t2221 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F42AC */ _t2221 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F42AC */ _t2222 = _t2221 & 0x00000001u;
         /* 021F42AC */ if (_t2222) goto L_021F42B0; else goto L_021F16C0;
   L_021F42B0: ; // 0x21f42b0
@@ -14452,8 +14452,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F42B0 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t2223);
         /* 021F42B4 */ _t2224 = cpu->r[1] + 0x00000654u;
         /* 021F42B4 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t2224);
-        /* 021F42B8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[10]);
-        /* 021F42BC */ _t2225 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F42B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[10]));
+        /* 021F42BC */ _t2225 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F42BC */ _t2226 = _t2225 & 0x00000001u;
         /* 021F42BC */ if (_t2226) goto L_021F42C0; else goto L_021F42E0;
   L_021F42C0: ; // 0x21f42c0
@@ -14461,8 +14461,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F42C0 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t2227);
         /* 021F42C4 */ _t2228 = cpu->r[1] + 0x00000658u;
         /* 021F42C4 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t2228);
-        /* 021F42C8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[8]);
-        /* 021F42CC */ _t2229 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F42C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[8]));
+        /* 021F42CC */ _t2229 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F42CC */ _t2230 = _t2229 & 0x00000001u;
         /* 021F42CC */ if (_t2230) goto L_021F42D0; else goto L_021F42E0;
   L_021F42D0: ; // 0x21f42d0
@@ -14470,15 +14470,15 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F42D0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t2231);
         /* 021F42D4 */ _t2232 = cpu->r[1] + 0x0000065Cu;
         /* 021F42D4 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t2232);
-        /* 021F42D8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[0]);
-        /* 021F42DC */ _t2233 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F42D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[0]));
+        /* 021F42DC */ _t2233 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F42DC */ _t2234 = _t2233 & 0x00000001u;
         /* 021F42DC */ if (_t2234) goto L_021F437C; else goto L_021F42E0;
   L_021F42E0: ; // 0x21f42e0
         /* 021F42E0 */ _t2235 = cpu->r[1] + 0x0000001Bu;
         /* 021F42E0 */ cpu->r[12] = rbrew_read8(cpu->mem, _t2235);
-        /* 021F42E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021F42E8 */ _t2236 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F42E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021F42E8 */ _t2236 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F42E8 */ _t2237 = _t2236 & 0x00000001u;
         /* 021F42E8 */ if (_t2237) goto L_021F42EC; else goto L_021F4314;
   L_021F42EC: ; // 0x21f42ec
@@ -14492,12 +14492,12 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F42F8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t2241);
         /* 021F42FC */ _t2242 = cpu->r[11] + 0x00000004u;
         /* 021F42FC */ rbrew_write_f32(cpu->mem, _t2242, cpu->f[8]);
-        /* 021F4300 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021F4300 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021F4304 */ _t2243 = cpu->r[11] + 0x00000008u;
         /* 021F4304 */ rbrew_write_f32(cpu->mem, _t2243, cpu->f[0]);
         /* 021F4308 */ _t2244 = cpu->r[11] + 0x00000000u;
         /* 021F4308 */ rbrew_write_f32(cpu->mem, _t2244, cpu->f[10]);
-        /* 021F430C */ _t2245 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F430C */ _t2245 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F430C */ _t2246 = _t2245 & 0x00000001u;
         /* 021F430C */ if (_t2246) goto L_021F43B4; else goto L_021F4310;
   L_021F4310: ; // 0x21f4310
@@ -14550,12 +14550,12 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F4380 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2262);
         /* 021F4384 */ _t2263 = cpu->r[11] + 0x00000004u;
         /* 021F4384 */ rbrew_write_f32(cpu->mem, _t2263, cpu->f[8]);
-        /* 021F4388 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021F4388 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021F438C */ _t2264 = cpu->r[11] + 0x00000000u;
         /* 021F438C */ rbrew_write_f32(cpu->mem, _t2264, cpu->f[10]);
         /* 021F4390 */ _t2265 = cpu->r[11] + 0x00000008u;
         /* 021F4390 */ rbrew_write_f32(cpu->mem, _t2265, cpu->f[0]);
-        /* 021F4394 */ _t2266 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4394 */ _t2266 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4394 */ _t2267 = _t2266 & 0x00000001u;
         /* 021F4394 */ if (_t2267) goto L_021F43B4; else goto L_021F4398;
   L_021F4398: ; // 0x21f4398
@@ -14574,9 +14574,9 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F43B4 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t2271);
         /* 021F43B8 */ _t2272 = cpu->r[1] + 0x000000A0u;
         /* 021F43B8 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t2272);
-        /* 021F43BC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[10]);
+        /* 021F43BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[10]));
         /* 021F43C0 */ cpu->r[0] = 0x00000000u;
-        /* 021F43C4 */ _t2273 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F43C4 */ _t2273 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F43C4 */ _t2274 = _t2273 & 0x00000001u;
         /* 021F43C4 */ if (_t2274) goto L_021F43C8; else goto L_021F43EC;
   L_021F43C8: ; // 0x21f43c8
@@ -14584,8 +14584,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F43C8 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t2275);
         /* 021F43CC */ _t2276 = cpu->r[1] + 0x000000A4u;
         /* 021F43CC */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t2276);
-        /* 021F43D0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[12]);
-        /* 021F43D4 */ _t2277 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F43D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[12]));
+        /* 021F43D4 */ _t2277 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F43D4 */ _t2278 = _t2277 & 0x00000001u;
         /* 021F43D4 */ if (_t2278) goto L_021F43D8; else goto L_021F43EC;
   L_021F43D8: ; // 0x21f43d8
@@ -14593,8 +14593,8 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F43D8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t2279);
         /* 021F43DC */ _t2280 = cpu->r[1] + 0x000000A8u;
         /* 021F43DC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t2280);
-        /* 021F43E0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 021F43E4 */ _t2281 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F43E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 021F43E4 */ _t2281 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F43E4 */ _t2282 = _t2281 & 0x00000001u;
         /* 021F43E4 */ if (_t2282) goto L_021F43E8; else goto L_021F43EC;
   L_021F43E8: ; // 0x21f43e8
@@ -14676,7 +14676,7 @@ void Gambit_fn_021F12B8(CPUState* cpu) {
         /* 021F4484 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t2317);
         /* 021F4488 */ _t2318 = cpu->r[1] + 0x00000938u;
         /* 021F4488 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t2318);
-        /* 021F448C */ _t2319 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F448C */ _t2319 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F448C */ _t2320 = _t2319 & 0x00000001u;
         /* 021F448C */ if (_t2320) goto L_021F4490; // else: addr-0 trap, fall-through
   L_021F4490: ; // 0x21f4490
@@ -14946,9 +14946,9 @@ void Gambit_fn_021F45E0(CPUState* cpu) {
         /* 021F45F8 */ _t3 = cpu->r[9] + 0x00000164u;
         /* 021F45F8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 021F45FC */ cpu->r[27] = cpu->r[4];
-        /* 021F4600 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021F4600 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021F4604 */ cpu->r[28] = cpu->r[5];
-        /* 021F4608 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4608 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4608 */ _t5 = _t4 & 0x00000001u;
         /* 021F4608 */ if (_t5) goto L_021F46BC; else goto L_021F460C;
   L_021F460C: ; // 0x21f460c
@@ -14976,25 +14976,25 @@ void Gambit_fn_021F45E0(CPUState* cpu) {
         /* 021F4640 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
         /* 021F4644 */ cpu->r[26] = cpu->r[0] - cpu->r[30];
   L_021F4648: ; // 0x21f4648
-        /* 021F4648 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], cpu->r[31]);
-        /* 021F464C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4648 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], cpu->r[31]));
+        /* 021F464C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F464C */ _t14 = _t13 & 0x00000001u;
         /* 021F464C */ if (_t14) goto L_021F4664; else goto L_021F4650;
   L_021F4650: ; // 0x21f4650
         /* 021F4650 */ _t15 = cpu->r[26] + 0x0000001Cu;
         /* 021F4650 */ cpu->r[11] = rbrew_read32(cpu->mem, _t15);
-        /* 021F4654 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000002u);
-        /* 021F4658 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4654 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000002u));
+        /* 021F4658 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4658 */ _t17 = _t16 & 0x00000001u;
         /* 021F4658 */ if (_t17) goto L_021F4664; else goto L_021F465C;
   L_021F465C: ; // 0x21f465c
-        /* 021F465C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021F4660 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F465C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021F4660 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4660 */ _t19 = _t18 & 0x00000001u;
         /* 021F4660 */ if (_t19) goto L_021F4664; else goto L_021F463C;
   L_021F4664: ; // 0x21f4664
-        /* 021F4664 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], cpu->r[31]);
-        /* 021F4668 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4664 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], cpu->r[31]));
+        /* 021F4668 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4668 */ _t21 = _t20 & 0x00000001u;
         /* 021F4668 */ if (_t21) goto L_021F46BC; else goto L_021F466C;
   L_021F466C: ; // 0x21f466c
@@ -15003,8 +15003,8 @@ void Gambit_fn_021F45E0(CPUState* cpu) {
         /* 021F4674 */ cpu->r[4] = cpu->r[27];
         /* 021F4678 */ cpu->r[3] = cpu->r[26];
         /* 021F467C */ Gambit_fn_021DA684(cpu);
-        /* 021F4680 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F4684 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4680 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F4684 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4684 */ _t23 = _t22 & 0x00000001u;
         /* 021F4684 */ if (_t23) goto L_021F4688; else goto L_021F46BC;
   L_021F4688: ; // 0x21f4688
@@ -15012,27 +15012,27 @@ void Gambit_fn_021F45E0(CPUState* cpu) {
         /* 021F468C */ _t24 = cpu->r[6] + 0x00000004u;
         /* 021F468C */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
         /* 021F4690 */ cpu->r[26] = cpu->r[0] - cpu->r[30];
-        /* 021F4694 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], cpu->r[31]);
-        /* 021F4698 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4694 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], cpu->r[31]));
+        /* 021F4698 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4698 */ _t26 = _t25 & 0x00000001u;
         /* 021F4698 */ if (_t26) goto L_021F46BC; else goto L_021F469C;
   L_021F469C: ; // 0x21f469c
         /* 021F469C */ _t27 = cpu->r[26] + 0x0000001Cu;
         /* 021F469C */ cpu->r[0] = rbrew_read32(cpu->mem, _t27);
-        /* 021F46A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021F46A4 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F46A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021F46A4 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F46A4 */ _t29 = _t28 & 0x00000001u;
         /* 021F46A4 */ if (_t29) goto L_021F46B4; else goto L_021F46A8;
   L_021F46A8: ; // 0x21f46a8
-        /* 021F46A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021F46AC */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F46A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021F46AC */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F46AC */ _t31 = _t30 & 0x00000001u;
         /* 021F46AC */ if (_t31) goto L_021F46B0; else goto L_021F4688;
   L_021F46B0: ; // 0x21f46b0
         /* 021F46B0 */ goto L_021F4664;
   L_021F46B4: ; // 0x21f46b4
-        /* 021F46B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], cpu->r[31]);
-        /* 021F46B8 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F46B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], cpu->r[31]));
+        /* 021F46B8 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F46B8 */ _t33 = _t32 & 0x00000001u;
         /* 021F46B8 */ if (_t33) goto L_021F46BC; else goto L_021F466C;
   L_021F46BC: ; // 0x21f46bc
@@ -15061,9 +15061,9 @@ void Gambit_fn_021F46D0(CPUState* cpu) {
         /* 021F46E4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t2);
         /* 021F46E8 */ _t3 = cpu->r[7] + 0x0000016Cu;
         /* 021F46E8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t3);
-        /* 021F46EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021F46EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021F46F0 */ cpu->r[28] = cpu->r[4];
-        /* 021F46F4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F46F4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F46F4 */ _t5 = _t4 & 0x00000001u;
         /* 021F46F4 */ if (_t5) goto L_021F47A4; else goto L_021F46F8;
   L_021F46F8: ; // 0x21f46f8
@@ -15091,25 +15091,25 @@ void Gambit_fn_021F46D0(CPUState* cpu) {
         /* 021F472C */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
         /* 021F4730 */ cpu->r[27] = cpu->r[0] - cpu->r[30];
   L_021F4734: ; // 0x21f4734
-        /* 021F4734 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], cpu->r[31]);
-        /* 021F4738 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4734 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], cpu->r[31]));
+        /* 021F4738 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4738 */ _t14 = _t13 & 0x00000001u;
         /* 021F4738 */ if (_t14) goto L_021F4750; else goto L_021F473C;
   L_021F473C: ; // 0x21f473c
         /* 021F473C */ _t15 = cpu->r[27] + 0x0000001Cu;
         /* 021F473C */ cpu->r[11] = rbrew_read32(cpu->mem, _t15);
-        /* 021F4740 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000002u);
-        /* 021F4744 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4740 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000002u));
+        /* 021F4744 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4744 */ _t17 = _t16 & 0x00000001u;
         /* 021F4744 */ if (_t17) goto L_021F4750; else goto L_021F4748;
   L_021F4748: ; // 0x21f4748
-        /* 021F4748 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021F474C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4748 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021F474C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F474C */ _t19 = _t18 & 0x00000001u;
         /* 021F474C */ if (_t19) goto L_021F4750; else goto L_021F4728;
   L_021F4750: ; // 0x21f4750
-        /* 021F4750 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], cpu->r[31]);
-        /* 021F4754 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4750 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], cpu->r[31]));
+        /* 021F4754 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4754 */ _t21 = _t20 & 0x00000001u;
         /* 021F4754 */ if (_t21) goto L_021F47A4; else goto L_021F4758;
   L_021F4758: ; // 0x21f4758
@@ -15117,8 +15117,8 @@ void Gambit_fn_021F46D0(CPUState* cpu) {
         /* 021F475C */ cpu->r[4] = cpu->r[28];
         /* 021F4760 */ cpu->r[3] = cpu->r[27];
         /* 021F4764 */ Gambit_fn_021DF330(cpu);
-        /* 021F4768 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F476C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F476C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F476C */ _t23 = _t22 & 0x00000001u;
         /* 021F476C */ if (_t23) goto L_021F4770; else goto L_021F47A4;
   L_021F4770: ; // 0x21f4770
@@ -15126,27 +15126,27 @@ void Gambit_fn_021F46D0(CPUState* cpu) {
         /* 021F4774 */ _t24 = cpu->r[5] + 0x00000004u;
         /* 021F4774 */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
         /* 021F4778 */ cpu->r[27] = cpu->r[0] - cpu->r[30];
-        /* 021F477C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], cpu->r[31]);
-        /* 021F4780 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F477C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], cpu->r[31]));
+        /* 021F4780 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4780 */ _t26 = _t25 & 0x00000001u;
         /* 021F4780 */ if (_t26) goto L_021F47A4; else goto L_021F4784;
   L_021F4784: ; // 0x21f4784
         /* 021F4784 */ _t27 = cpu->r[27] + 0x0000001Cu;
         /* 021F4784 */ cpu->r[0] = rbrew_read32(cpu->mem, _t27);
-        /* 021F4788 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021F478C */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4788 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021F478C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F478C */ _t29 = _t28 & 0x00000001u;
         /* 021F478C */ if (_t29) goto L_021F479C; else goto L_021F4790;
   L_021F4790: ; // 0x21f4790
-        /* 021F4790 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021F4794 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4790 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021F4794 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4794 */ _t31 = _t30 & 0x00000001u;
         /* 021F4794 */ if (_t31) goto L_021F4798; else goto L_021F4770;
   L_021F4798: ; // 0x21f4798
         /* 021F4798 */ goto L_021F4750;
   L_021F479C: ; // 0x21f479c
-        /* 021F479C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], cpu->r[31]);
-        /* 021F47A0 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F479C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], cpu->r[31]));
+        /* 021F47A0 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F47A0 */ _t33 = _t32 & 0x00000001u;
         /* 021F47A0 */ if (_t33) goto L_021F47A4; else goto L_021F4758;
   L_021F47A4: ; // 0x21f47a4
@@ -15175,9 +15175,9 @@ void Gambit_fn_021F47B8(CPUState* cpu) {
         /* 021F47CC */ cpu->r[7] = rbrew_read32(cpu->mem, _t2);
         /* 021F47D0 */ _t3 = cpu->r[7] + 0x000001C8u;
         /* 021F47D0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t3);
-        /* 021F47D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021F47D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021F47D8 */ cpu->r[28] = cpu->r[4];
-        /* 021F47DC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F47DC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F47DC */ _t5 = _t4 & 0x00000001u;
         /* 021F47DC */ if (_t5) goto L_021F488C; else goto L_021F47E0;
   L_021F47E0: ; // 0x21f47e0
@@ -15205,25 +15205,25 @@ void Gambit_fn_021F47B8(CPUState* cpu) {
         /* 021F4814 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
         /* 021F4818 */ cpu->r[27] = cpu->r[0] - cpu->r[30];
   L_021F481C: ; // 0x21f481c
-        /* 021F481C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], cpu->r[31]);
-        /* 021F4820 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F481C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], cpu->r[31]));
+        /* 021F4820 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4820 */ _t14 = _t13 & 0x00000001u;
         /* 021F4820 */ if (_t14) goto L_021F4838; else goto L_021F4824;
   L_021F4824: ; // 0x21f4824
         /* 021F4824 */ _t15 = cpu->r[27] + 0x0000001Cu;
         /* 021F4824 */ cpu->r[11] = rbrew_read32(cpu->mem, _t15);
-        /* 021F4828 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000002u);
-        /* 021F482C */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4828 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000002u));
+        /* 021F482C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F482C */ _t17 = _t16 & 0x00000001u;
         /* 021F482C */ if (_t17) goto L_021F4838; else goto L_021F4830;
   L_021F4830: ; // 0x21f4830
-        /* 021F4830 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021F4834 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4830 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021F4834 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4834 */ _t19 = _t18 & 0x00000001u;
         /* 021F4834 */ if (_t19) goto L_021F4838; else goto L_021F4810;
   L_021F4838: ; // 0x21f4838
-        /* 021F4838 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], cpu->r[31]);
-        /* 021F483C */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4838 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], cpu->r[31]));
+        /* 021F483C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F483C */ _t21 = _t20 & 0x00000001u;
         /* 021F483C */ if (_t21) goto L_021F488C; else goto L_021F4840;
   L_021F4840: ; // 0x21f4840
@@ -15231,8 +15231,8 @@ void Gambit_fn_021F47B8(CPUState* cpu) {
         /* 021F4844 */ cpu->r[4] = cpu->r[28];
         /* 021F4848 */ cpu->r[3] = cpu->r[27];
         /* 021F484C */ Gambit_fn_021D3ED8(cpu);
-        /* 021F4850 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F4854 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4850 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F4854 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4854 */ _t23 = _t22 & 0x00000001u;
         /* 021F4854 */ if (_t23) goto L_021F4858; else goto L_021F488C;
   L_021F4858: ; // 0x21f4858
@@ -15240,27 +15240,27 @@ void Gambit_fn_021F47B8(CPUState* cpu) {
         /* 021F485C */ _t24 = cpu->r[5] + 0x00000004u;
         /* 021F485C */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
         /* 021F4860 */ cpu->r[27] = cpu->r[0] - cpu->r[30];
-        /* 021F4864 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], cpu->r[31]);
-        /* 021F4868 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4864 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], cpu->r[31]));
+        /* 021F4868 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4868 */ _t26 = _t25 & 0x00000001u;
         /* 021F4868 */ if (_t26) goto L_021F488C; else goto L_021F486C;
   L_021F486C: ; // 0x21f486c
         /* 021F486C */ _t27 = cpu->r[27] + 0x0000001Cu;
         /* 021F486C */ cpu->r[0] = rbrew_read32(cpu->mem, _t27);
-        /* 021F4870 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021F4874 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4870 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021F4874 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4874 */ _t29 = _t28 & 0x00000001u;
         /* 021F4874 */ if (_t29) goto L_021F4884; else goto L_021F4878;
   L_021F4878: ; // 0x21f4878
-        /* 021F4878 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021F487C */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4878 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021F487C */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F487C */ _t31 = _t30 & 0x00000001u;
         /* 021F487C */ if (_t31) goto L_021F4880; else goto L_021F4858;
   L_021F4880: ; // 0x21f4880
         /* 021F4880 */ goto L_021F4838;
   L_021F4884: ; // 0x21f4884
-        /* 021F4884 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], cpu->r[31]);
-        /* 021F4888 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4884 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], cpu->r[31]));
+        /* 021F4888 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4888 */ _t33 = _t32 & 0x00000001u;
         /* 021F4888 */ if (_t33) goto L_021F488C; else goto L_021F4840;
   L_021F488C: ; // 0x21f488c
@@ -15290,9 +15290,9 @@ void Gambit_fn_021F48A0(CPUState* cpu) {
         /* 021F48B8 */ _t3 = cpu->r[10] + 0x000001C8u;
         /* 021F48B8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t3);
         /* 021F48BC */ cpu->r[27] = cpu->r[4];
-        /* 021F48C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021F48C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021F48C4 */ cpu->r[28] = cpu->r[5];
-        /* 021F48C8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F48C8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F48C8 */ _t5 = _t4 & 0x00000001u;
         /* 021F48C8 */ if (_t5) goto L_021F4974; else goto L_021F48CC;
   L_021F48CC: ; // 0x21f48cc
@@ -15320,25 +15320,25 @@ void Gambit_fn_021F48A0(CPUState* cpu) {
         /* 021F4900 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
         /* 021F4904 */ cpu->r[26] = cpu->r[0] - cpu->r[30];
   L_021F4908: ; // 0x21f4908
-        /* 021F4908 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], cpu->r[31]);
-        /* 021F490C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4908 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], cpu->r[31]));
+        /* 021F490C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F490C */ _t14 = _t13 & 0x00000001u;
         /* 021F490C */ if (_t14) goto L_021F4924; else goto L_021F4910;
   L_021F4910: ; // 0x21f4910
         /* 021F4910 */ _t15 = cpu->r[26] + 0x0000001Cu;
         /* 021F4910 */ cpu->r[9] = rbrew_read32(cpu->mem, _t15);
-        /* 021F4914 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000002u);
-        /* 021F4918 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4914 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000002u));
+        /* 021F4918 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4918 */ _t17 = _t16 & 0x00000001u;
         /* 021F4918 */ if (_t17) goto L_021F4924; else goto L_021F491C;
   L_021F491C: ; // 0x21f491c
-        /* 021F491C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000003u);
-        /* 021F4920 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F491C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000003u));
+        /* 021F4920 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4920 */ _t19 = _t18 & 0x00000001u;
         /* 021F4920 */ if (_t19) goto L_021F4924; else goto L_021F48FC;
   L_021F4924: ; // 0x21f4924
-        /* 021F4924 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], cpu->r[31]);
-        /* 021F4928 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4924 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], cpu->r[31]));
+        /* 021F4928 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4928 */ _t21 = _t20 & 0x00000001u;
         /* 021F4928 */ if (_t21) goto L_021F4974; else goto L_021F492C;
   L_021F492C: ; // 0x21f492c
@@ -15352,27 +15352,27 @@ void Gambit_fn_021F48A0(CPUState* cpu) {
         /* 021F4944 */ _t22 = cpu->r[4] + 0x00000004u;
         /* 021F4944 */ cpu->r[0] = rbrew_read32(cpu->mem, _t22);
         /* 021F4948 */ cpu->r[26] = cpu->r[0] - cpu->r[30];
-        /* 021F494C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], cpu->r[31]);
-        /* 021F4950 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F494C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], cpu->r[31]));
+        /* 021F4950 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4950 */ _t24 = _t23 & 0x00000001u;
         /* 021F4950 */ if (_t24) goto L_021F4974; else goto L_021F4954;
   L_021F4954: ; // 0x21f4954
         /* 021F4954 */ _t25 = cpu->r[26] + 0x0000001Cu;
         /* 021F4954 */ cpu->r[11] = rbrew_read32(cpu->mem, _t25);
-        /* 021F4958 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000002u);
-        /* 021F495C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4958 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000002u));
+        /* 021F495C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F495C */ _t27 = _t26 & 0x00000001u;
         /* 021F495C */ if (_t27) goto L_021F496C; else goto L_021F4960;
   L_021F4960: ; // 0x21f4960
-        /* 021F4960 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021F4964 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4960 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021F4964 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4964 */ _t29 = _t28 & 0x00000001u;
         /* 021F4964 */ if (_t29) goto L_021F4968; else goto L_021F4940;
   L_021F4968: ; // 0x21f4968
         /* 021F4968 */ goto L_021F4924;
   L_021F496C: ; // 0x21f496c
-        /* 021F496C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], cpu->r[31]);
-        /* 021F4970 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F496C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], cpu->r[31]));
+        /* 021F4970 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4970 */ _t31 = _t30 & 0x00000001u;
         /* 021F4970 */ if (_t31) goto L_021F4974; else goto L_021F492C;
   L_021F4974: ; // 0x21f4974
@@ -15408,8 +15408,8 @@ void Gambit_fn_021F4988(CPUState* cpu) {
         /* 021F49A8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t6);
         /* 021F49AC */ _t7 = cpu->r[10] + 0x000001C8u;
         /* 021F49AC */ cpu->r[5] = rbrew_read32(cpu->mem, _t7);
-        /* 021F49B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 021F49B4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F49B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 021F49B4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F49B4 */ _t9 = _t8 & 0x00000001u;
         /* 021F49B4 */ if (_t9) goto L_021F4A58; else goto L_021F49B8;
   L_021F49B8: ; // 0x21f49b8
@@ -15437,25 +15437,25 @@ void Gambit_fn_021F4988(CPUState* cpu) {
         /* 021F49EC */ cpu->r[9] = rbrew_read32(cpu->mem, _t16);
         /* 021F49F0 */ cpu->r[28] = cpu->r[9] - cpu->r[30];
   L_021F49F4: ; // 0x21f49f4
-        /* 021F49F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[31]);
-        /* 021F49F8 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F49F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[31]));
+        /* 021F49F8 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F49F8 */ _t18 = _t17 & 0x00000001u;
         /* 021F49F8 */ if (_t18) goto L_021F4A10; else goto L_021F49FC;
   L_021F49FC: ; // 0x21f49fc
         /* 021F49FC */ _t19 = cpu->r[28] + 0x0000001Cu;
         /* 021F49FC */ cpu->r[8] = rbrew_read32(cpu->mem, _t19);
-        /* 021F4A00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000002u);
-        /* 021F4A04 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4A00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000002u));
+        /* 021F4A04 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4A04 */ _t21 = _t20 & 0x00000001u;
         /* 021F4A04 */ if (_t21) goto L_021F4A10; else goto L_021F4A08;
   L_021F4A08: ; // 0x21f4a08
-        /* 021F4A08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000003u);
-        /* 021F4A0C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4A08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000003u));
+        /* 021F4A0C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4A0C */ _t23 = _t22 & 0x00000001u;
         /* 021F4A0C */ if (_t23) goto L_021F4A10; else goto L_021F49E8;
   L_021F4A10: ; // 0x21f4a10
-        /* 021F4A10 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[31]);
-        /* 021F4A14 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4A10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[31]));
+        /* 021F4A14 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4A14 */ _t25 = _t24 & 0x00000001u;
         /* 021F4A14 */ if (_t25) goto L_021F4A58; else goto L_021F4A18;
   L_021F4A18: ; // 0x21f4a18
@@ -15467,27 +15467,27 @@ void Gambit_fn_021F4988(CPUState* cpu) {
         /* 021F4A28 */ _t26 = cpu->r[12] + 0x00000004u;
         /* 021F4A28 */ cpu->r[0] = rbrew_read32(cpu->mem, _t26);
         /* 021F4A2C */ cpu->r[28] = cpu->r[0] - cpu->r[30];
-        /* 021F4A30 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[31]);
-        /* 021F4A34 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4A30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[31]));
+        /* 021F4A34 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4A34 */ _t28 = _t27 & 0x00000001u;
         /* 021F4A34 */ if (_t28) goto L_021F4A58; else goto L_021F4A38;
   L_021F4A38: ; // 0x21f4a38
         /* 021F4A38 */ _t29 = cpu->r[28] + 0x0000001Cu;
         /* 021F4A38 */ cpu->r[10] = rbrew_read32(cpu->mem, _t29);
-        /* 021F4A3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
-        /* 021F4A40 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4A3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
+        /* 021F4A40 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4A40 */ _t31 = _t30 & 0x00000001u;
         /* 021F4A40 */ if (_t31) goto L_021F4A50; else goto L_021F4A44;
   L_021F4A44: ; // 0x21f4a44
-        /* 021F4A44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000003u);
-        /* 021F4A48 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4A44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000003u));
+        /* 021F4A48 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4A48 */ _t33 = _t32 & 0x00000001u;
         /* 021F4A48 */ if (_t33) goto L_021F4A4C; else goto L_021F4A24;
   L_021F4A4C: ; // 0x21f4a4c
         /* 021F4A4C */ goto L_021F4A10;
   L_021F4A50: ; // 0x21f4a50
-        /* 021F4A50 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[31]);
-        /* 021F4A54 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4A50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[31]));
+        /* 021F4A54 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4A54 */ _t35 = _t34 & 0x00000001u;
         /* 021F4A54 */ if (_t35) goto L_021F4A58; else goto L_021F4A18;
   L_021F4A58: ; // 0x21f4a58
@@ -15529,8 +15529,8 @@ void Gambit_fn_021F498C(CPUState* cpu) {
         /* 021F49A8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t6);
         /* 021F49AC */ _t7 = cpu->r[10] + 0x000001C8u;
         /* 021F49AC */ cpu->r[5] = rbrew_read32(cpu->mem, _t7);
-        /* 021F49B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 021F49B4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F49B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 021F49B4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F49B4 */ _t9 = _t8 & 0x00000001u;
         /* 021F49B4 */ if (_t9) goto L_021F4A58; else goto L_021F49B8;
   L_021F49B8: ; // 0x21f49b8
@@ -15558,25 +15558,25 @@ void Gambit_fn_021F498C(CPUState* cpu) {
         /* 021F49EC */ cpu->r[9] = rbrew_read32(cpu->mem, _t16);
         /* 021F49F0 */ cpu->r[28] = cpu->r[9] - cpu->r[30];
   L_021F49F4: ; // 0x21f49f4
-        /* 021F49F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[31]);
-        /* 021F49F8 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F49F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[31]));
+        /* 021F49F8 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F49F8 */ _t18 = _t17 & 0x00000001u;
         /* 021F49F8 */ if (_t18) goto L_021F4A10; else goto L_021F49FC;
   L_021F49FC: ; // 0x21f49fc
         /* 021F49FC */ _t19 = cpu->r[28] + 0x0000001Cu;
         /* 021F49FC */ cpu->r[8] = rbrew_read32(cpu->mem, _t19);
-        /* 021F4A00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000002u);
-        /* 021F4A04 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4A00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000002u));
+        /* 021F4A04 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4A04 */ _t21 = _t20 & 0x00000001u;
         /* 021F4A04 */ if (_t21) goto L_021F4A10; else goto L_021F4A08;
   L_021F4A08: ; // 0x21f4a08
-        /* 021F4A08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000003u);
-        /* 021F4A0C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4A08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000003u));
+        /* 021F4A0C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4A0C */ _t23 = _t22 & 0x00000001u;
         /* 021F4A0C */ if (_t23) goto L_021F4A10; else goto L_021F49E8;
   L_021F4A10: ; // 0x21f4a10
-        /* 021F4A10 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[31]);
-        /* 021F4A14 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4A10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[31]));
+        /* 021F4A14 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4A14 */ _t25 = _t24 & 0x00000001u;
         /* 021F4A14 */ if (_t25) goto L_021F4A58; else goto L_021F4A18;
   L_021F4A18: ; // 0x21f4a18
@@ -15588,27 +15588,27 @@ void Gambit_fn_021F498C(CPUState* cpu) {
         /* 021F4A28 */ _t26 = cpu->r[12] + 0x00000004u;
         /* 021F4A28 */ cpu->r[0] = rbrew_read32(cpu->mem, _t26);
         /* 021F4A2C */ cpu->r[28] = cpu->r[0] - cpu->r[30];
-        /* 021F4A30 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[31]);
-        /* 021F4A34 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4A30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[31]));
+        /* 021F4A34 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4A34 */ _t28 = _t27 & 0x00000001u;
         /* 021F4A34 */ if (_t28) goto L_021F4A58; else goto L_021F4A38;
   L_021F4A38: ; // 0x21f4a38
         /* 021F4A38 */ _t29 = cpu->r[28] + 0x0000001Cu;
         /* 021F4A38 */ cpu->r[10] = rbrew_read32(cpu->mem, _t29);
-        /* 021F4A3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
-        /* 021F4A40 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4A3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
+        /* 021F4A40 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4A40 */ _t31 = _t30 & 0x00000001u;
         /* 021F4A40 */ if (_t31) goto L_021F4A50; else goto L_021F4A44;
   L_021F4A44: ; // 0x21f4a44
-        /* 021F4A44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000003u);
-        /* 021F4A48 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4A44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000003u));
+        /* 021F4A48 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4A48 */ _t33 = _t32 & 0x00000001u;
         /* 021F4A48 */ if (_t33) goto L_021F4A4C; else goto L_021F4A24;
   L_021F4A4C: ; // 0x21f4a4c
         /* 021F4A4C */ goto L_021F4A10;
   L_021F4A50: ; // 0x21f4a50
-        /* 021F4A50 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[31]);
-        /* 021F4A54 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4A50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[31]));
+        /* 021F4A54 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4A54 */ _t35 = _t34 & 0x00000001u;
         /* 021F4A54 */ if (_t35) goto L_021F4A58; else goto L_021F4A18;
   L_021F4A58: ; // 0x21f4a58
@@ -15651,8 +15651,8 @@ void Gambit_fn_021F4A78(CPUState* cpu) {
         /* 021F4A98 */ cpu->r[7] = rbrew_read32(cpu->mem, _t6);
         /* 021F4A9C */ _t7 = cpu->r[7] + 0x00000128u;
         /* 021F4A9C */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
-        /* 021F4AA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021F4AA4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4AA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021F4AA4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4AA4 */ _t9 = _t8 & 0x00000001u;
         /* 021F4AA4 */ if (_t9) goto L_021F4B50; else goto L_021F4AA8;
   L_021F4AA8: ; // 0x21f4aa8
@@ -15680,32 +15680,32 @@ void Gambit_fn_021F4A78(CPUState* cpu) {
         /* 021F4ADC */ cpu->r[12] = rbrew_read32(cpu->mem, _t16);
         /* 021F4AE0 */ cpu->r[28] = cpu->r[12] - cpu->r[30];
   L_021F4AE4: ; // 0x21f4ae4
-        /* 021F4AE4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[31]);
-        /* 021F4AE8 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4AE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[31]));
+        /* 021F4AE8 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4AE8 */ _t18 = _t17 & 0x00000001u;
         /* 021F4AE8 */ if (_t18) goto L_021F4B00; else goto L_021F4AEC;
   L_021F4AEC: ; // 0x21f4aec
         /* 021F4AEC */ _t19 = cpu->r[28] + 0x0000001Cu;
         /* 021F4AEC */ cpu->r[11] = rbrew_read32(cpu->mem, _t19);
-        /* 021F4AF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000002u);
-        /* 021F4AF4 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4AF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000002u));
+        /* 021F4AF4 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4AF4 */ _t21 = _t20 & 0x00000001u;
         /* 021F4AF4 */ if (_t21) goto L_021F4B00; else goto L_021F4AF8;
   L_021F4AF8: ; // 0x21f4af8
-        /* 021F4AF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021F4AFC */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4AF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021F4AFC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4AFC */ _t23 = _t22 & 0x00000001u;
         /* 021F4AFC */ if (_t23) goto L_021F4B00; else goto L_021F4AD8;
   L_021F4B00: ; // 0x21f4b00
-        /* 021F4B00 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[31]);
-        /* 021F4B04 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4B00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[31]));
+        /* 021F4B04 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4B04 */ _t25 = _t24 & 0x00000001u;
         /* 021F4B04 */ if (_t25) goto L_021F4B50; else goto L_021F4B08;
   L_021F4B08: ; // 0x21f4b08
         /* 021F4B08 */ _t26 = cpu->r[28] + 0x00000054u;
         /* 021F4B08 */ cpu->r[4] = rbrew_read32(cpu->mem, _t26);
-        /* 021F4B0C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[29]);
-        /* 021F4B10 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4B0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[29]));
+        /* 021F4B10 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4B10 */ _t28 = _t27 & 0x00000001u;
         /* 021F4B10 */ if (_t28) goto L_021F4B14; else goto L_021F4B1C;
   L_021F4B14: ; // 0x21f4b14
@@ -15716,27 +15716,27 @@ void Gambit_fn_021F4A78(CPUState* cpu) {
         /* 021F4B20 */ _t29 = cpu->r[6] + 0x00000004u;
         /* 021F4B20 */ cpu->r[0] = rbrew_read32(cpu->mem, _t29);
         /* 021F4B24 */ cpu->r[28] = cpu->r[0] - cpu->r[30];
-        /* 021F4B28 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[31]);
-        /* 021F4B2C */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4B28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[31]));
+        /* 021F4B2C */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4B2C */ _t31 = _t30 & 0x00000001u;
         /* 021F4B2C */ if (_t31) goto L_021F4B50; else goto L_021F4B30;
   L_021F4B30: ; // 0x21f4b30
         /* 021F4B30 */ _t32 = cpu->r[28] + 0x0000001Cu;
         /* 021F4B30 */ cpu->r[0] = rbrew_read32(cpu->mem, _t32);
-        /* 021F4B34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021F4B38 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4B34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021F4B38 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4B38 */ _t34 = _t33 & 0x00000001u;
         /* 021F4B38 */ if (_t34) goto L_021F4B48; else goto L_021F4B3C;
   L_021F4B3C: ; // 0x21f4b3c
-        /* 021F4B3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021F4B40 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4B3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021F4B40 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4B40 */ _t36 = _t35 & 0x00000001u;
         /* 021F4B40 */ if (_t36) goto L_021F4B44; else goto L_021F4B1C;
   L_021F4B44: ; // 0x21f4b44
         /* 021F4B44 */ goto L_021F4B00;
   L_021F4B48: ; // 0x21f4b48
-        /* 021F4B48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[31]);
-        /* 021F4B4C */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4B48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[31]));
+        /* 021F4B4C */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4B4C */ _t38 = _t37 & 0x00000001u;
         /* 021F4B4C */ if (_t38) goto L_021F4B50; else goto L_021F4B08;
   L_021F4B50: ; // 0x21f4b50
@@ -15778,8 +15778,8 @@ void Gambit_fn_021F4A7C(CPUState* cpu) {
         /* 021F4A98 */ cpu->r[7] = rbrew_read32(cpu->mem, _t6);
         /* 021F4A9C */ _t7 = cpu->r[7] + 0x00000128u;
         /* 021F4A9C */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
-        /* 021F4AA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 021F4AA4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4AA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 021F4AA4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4AA4 */ _t9 = _t8 & 0x00000001u;
         /* 021F4AA4 */ if (_t9) goto L_021F4B50; else goto L_021F4AA8;
   L_021F4AA8: ; // 0x21f4aa8
@@ -15807,32 +15807,32 @@ void Gambit_fn_021F4A7C(CPUState* cpu) {
         /* 021F4ADC */ cpu->r[12] = rbrew_read32(cpu->mem, _t16);
         /* 021F4AE0 */ cpu->r[28] = cpu->r[12] - cpu->r[30];
   L_021F4AE4: ; // 0x21f4ae4
-        /* 021F4AE4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[31]);
-        /* 021F4AE8 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4AE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[31]));
+        /* 021F4AE8 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4AE8 */ _t18 = _t17 & 0x00000001u;
         /* 021F4AE8 */ if (_t18) goto L_021F4B00; else goto L_021F4AEC;
   L_021F4AEC: ; // 0x21f4aec
         /* 021F4AEC */ _t19 = cpu->r[28] + 0x0000001Cu;
         /* 021F4AEC */ cpu->r[11] = rbrew_read32(cpu->mem, _t19);
-        /* 021F4AF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000002u);
-        /* 021F4AF4 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4AF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000002u));
+        /* 021F4AF4 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4AF4 */ _t21 = _t20 & 0x00000001u;
         /* 021F4AF4 */ if (_t21) goto L_021F4B00; else goto L_021F4AF8;
   L_021F4AF8: ; // 0x21f4af8
-        /* 021F4AF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021F4AFC */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4AF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021F4AFC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4AFC */ _t23 = _t22 & 0x00000001u;
         /* 021F4AFC */ if (_t23) goto L_021F4B00; else goto L_021F4AD8;
   L_021F4B00: ; // 0x21f4b00
-        /* 021F4B00 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[31]);
-        /* 021F4B04 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4B00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[31]));
+        /* 021F4B04 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4B04 */ _t25 = _t24 & 0x00000001u;
         /* 021F4B04 */ if (_t25) goto L_021F4B50; else goto L_021F4B08;
   L_021F4B08: ; // 0x21f4b08
         /* 021F4B08 */ _t26 = cpu->r[28] + 0x00000054u;
         /* 021F4B08 */ cpu->r[4] = rbrew_read32(cpu->mem, _t26);
-        /* 021F4B0C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[29]);
-        /* 021F4B10 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4B0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[29]));
+        /* 021F4B10 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4B10 */ _t28 = _t27 & 0x00000001u;
         /* 021F4B10 */ if (_t28) goto L_021F4B14; else goto L_021F4B1C;
   L_021F4B14: ; // 0x21f4b14
@@ -15843,27 +15843,27 @@ void Gambit_fn_021F4A7C(CPUState* cpu) {
         /* 021F4B20 */ _t29 = cpu->r[6] + 0x00000004u;
         /* 021F4B20 */ cpu->r[0] = rbrew_read32(cpu->mem, _t29);
         /* 021F4B24 */ cpu->r[28] = cpu->r[0] - cpu->r[30];
-        /* 021F4B28 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[31]);
-        /* 021F4B2C */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4B28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[31]));
+        /* 021F4B2C */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4B2C */ _t31 = _t30 & 0x00000001u;
         /* 021F4B2C */ if (_t31) goto L_021F4B50; else goto L_021F4B30;
   L_021F4B30: ; // 0x21f4b30
         /* 021F4B30 */ _t32 = cpu->r[28] + 0x0000001Cu;
         /* 021F4B30 */ cpu->r[0] = rbrew_read32(cpu->mem, _t32);
-        /* 021F4B34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021F4B38 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4B34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021F4B38 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4B38 */ _t34 = _t33 & 0x00000001u;
         /* 021F4B38 */ if (_t34) goto L_021F4B48; else goto L_021F4B3C;
   L_021F4B3C: ; // 0x21f4b3c
-        /* 021F4B3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021F4B40 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4B3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021F4B40 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4B40 */ _t36 = _t35 & 0x00000001u;
         /* 021F4B40 */ if (_t36) goto L_021F4B44; else goto L_021F4B1C;
   L_021F4B44: ; // 0x21f4b44
         /* 021F4B44 */ goto L_021F4B00;
   L_021F4B48: ; // 0x21f4b48
-        /* 021F4B48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[31]);
-        /* 021F4B4C */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4B48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[31]));
+        /* 021F4B4C */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4B4C */ _t38 = _t37 & 0x00000001u;
         /* 021F4B4C */ if (_t38) goto L_021F4B50; else goto L_021F4B08;
   L_021F4B50: ; // 0x21f4b50
@@ -15889,21 +15889,21 @@ void Gambit_fn_021F4B70(CPUState* cpu) {
   L_021F4B70: ; // 0x21f4b70
         /* 021F4B70 */ _t0 = cpu->r[4] + 0x00000000u;
         /* 021F4B70 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
-        /* 021F4B74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021F4B78 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4B74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021F4B78 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4B78 */ _t2 = _t1 & 0x00000001u;
         /* 021F4B78 */ if (_t2) goto L_021F4B84; else goto L_021F4B7C;
   L_021F4B7C: ; // 0x21f4b7c
-        /* 021F4B7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 021F4B80 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4B7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 021F4B80 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4B80 */ _t4 = _t3 & 0x00000001u;
         /* 021F4B80 */ _t5 = _t4 ^ 0x00000001u;
         /* 021F4B80 */ if (_t5) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021F4B80 */ goto L_021F4B84;
   L_021F4B84: ; // 0x21f4b84
-        /* 021F4B84 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000002u);
+        /* 021F4B84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000002u));
         /* 021F4B88 */ cpu->r[12] = cpu->r[3] + 0x00000258u;
-        /* 021F4B8C */ _t6 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F4B8C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F4B8C */ _t7 = _t6 & 0x00000001u;
         /* 021F4B8C */ if (_t7) goto L_021F4B90; else goto L_021F4B98;
   L_021F4B90: ; // 0x21f4b90
@@ -15933,35 +15933,35 @@ void Gambit_fn_021F4BA8(CPUState* cpu) {
         /* 021F4BB4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t2);
         /* 021F4BB8 */ _t3 = cpu->r[4] + 0x00000000u;
         /* 021F4BB8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t3);
-        /* 021F4BBC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
-        /* 021F4BC0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4BBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
+        /* 021F4BC0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4BC0 */ _t5 = _t4 & 0x00000001u;
         /* 021F4BC0 */ if (_t5) goto L_021F4BC4; else goto L_021F4C9C;
   L_021F4BC4: ; // 0x21f4bc4
-        /* 021F4BC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021F4BC8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4BC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021F4BC8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4BC8 */ _t7 = _t6 & 0x00000001u;
         /* 021F4BC8 */ if (_t7) goto L_021F4BD4; else goto L_021F4BCC;
   L_021F4BCC: ; // 0x21f4bcc
-        /* 021F4BCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000001u);
-        /* 021F4BD0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4BCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000001u));
+        /* 021F4BD0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4BD0 */ _t9 = _t8 & 0x00000001u;
         /* 021F4BD0 */ if (_t9) goto L_021F4BD4; else goto L_021F4C9C;
   L_021F4BD4: ; // 0x21f4bd4
         /* 021F4BD4 */ cpu->r[0] = 0x00000001u - cpu->r[12];
-        /* 021F4BD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021F4BDC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4BD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021F4BDC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4BDC */ _t11 = _t10 & 0x00000001u;
         /* 021F4BDC */ if (_t11) goto L_021F4BE8; else goto L_021F4BE0;
   L_021F4BE0: ; // 0x21f4be0
-        /* 021F4BE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 021F4BE4 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4BE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 021F4BE4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4BE4 */ _t13 = _t12 & 0x00000001u;
         /* 021F4BE4 */ if (_t13) goto L_021F4BE8; else goto L_021F4C3C;
   L_021F4BE8: ; // 0x21f4be8
-        /* 021F4BE8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000002u);
+        /* 021F4BE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000002u));
         /* 021F4BEC */ cpu->r[8] = cpu->r[3] + 0x00000258u;
-        /* 021F4BF0 */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F4BF0 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F4BF0 */ _t15 = _t14 & 0x00000001u;
         /* 021F4BF0 */ if (_t15) goto L_021F4BF4; else goto L_021F4BFC;
   L_021F4BF4: ; // 0x21f4bf4
@@ -15987,8 +15987,8 @@ void Gambit_fn_021F4BA8(CPUState* cpu) {
         /* 021F4C28 */ _t21 = cpu->r[12] + 0xFFFFC67Cu;
         /* 021F4C28 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t21);
         /* 021F4C2C */ cpu->f[1] = cpu->f[13] / cpu->f[12];
-        /* 021F4C30 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
-        /* 021F4C34 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F4C30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
+        /* 021F4C34 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F4C34 */ _t23 = _t22 & 0x00000001u;
         /* 021F4C34 */ if (_t23) goto L_021F4C74; else goto L_021F4C38;
   L_021F4C38: ; // 0x21f4c38
@@ -16011,8 +16011,8 @@ void Gambit_fn_021F4BA8(CPUState* cpu) {
         /* 021F4C64 */ _t28 = cpu->r[12] + 0xFFFFC67Cu;
         /* 021F4C64 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t28);
         /* 021F4C68 */ cpu->f[1] = cpu->f[13] / cpu->f[12];
-        /* 021F4C6C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
-        /* 021F4C70 */ _t29 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F4C6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
+        /* 021F4C70 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F4C70 */ _t30 = _t29 & 0x00000001u;
         /* 021F4C70 */ if (_t30) goto L_021F4C74; else goto L_021F4C80;
   L_021F4C74: ; // 0x21f4c74
@@ -16023,8 +16023,8 @@ void Gambit_fn_021F4BA8(CPUState* cpu) {
         /* 021F4C80 */ cpu->r[11] = 0x10040000u;
         /* 021F4C84 */ _t31 = cpu->r[11] + 0xFFFFC654u;
         /* 021F4C84 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t31);
-        /* 021F4C88 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
-        /* 021F4C8C */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F4C88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
+        /* 021F4C8C */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F4C8C */ _t33 = _t32 & 0x00000001u;
         /* 021F4C8C */ if (_t33) goto L_021F4C90; else goto L_021F4C94;
   L_021F4C90: ; // 0x21f4c90
@@ -16053,8 +16053,8 @@ void Gambit_fn_021F4CA8(CPUState* cpu) {
         /* 021F4CB4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t2);
         /* 021F4CB8 */ _t3 = cpu->r[4] + 0x00000054u;
         /* 021F4CB8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
-        /* 021F4CBC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
-        /* 021F4CC0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4CBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
+        /* 021F4CC0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4CC0 */ _t5 = _t4 & 0x00000001u;
         /* 021F4CC0 */ if (_t5) goto L_021F4CE4; else goto L_021F4CC4;
   L_021F4CC4: ; // 0x21f4cc4
@@ -16092,8 +16092,8 @@ void Gambit_fn_021F4CB0(CPUState* cpu) {
         /* 021F4CB4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t1);
         /* 021F4CB8 */ _t2 = cpu->r[4] + 0x00000054u;
         /* 021F4CB8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021F4CBC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
-        /* 021F4CC0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4CBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
+        /* 021F4CC0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4CC0 */ _t4 = _t3 & 0x00000001u;
         /* 021F4CC0 */ if (_t4) goto L_021F4CE4; else goto L_021F4CC4;
   L_021F4CC4: ; // 0x21f4cc4
@@ -16141,36 +16141,36 @@ void Gambit_fn_021F4CFC(CPUState* cpu) {
   L_021F4D24: ; // 0x21f4d24
         /* 021F4D24 */ _t2 = cpu->r[26] + cpu->r[30];
         /* 021F4D24 */ cpu->r[3] = rbrew_read32(cpu->mem, _t2);
-        /* 021F4D28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F4D2C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4D28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F4D2C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4D2C */ _t4 = _t3 & 0x00000001u;
         /* 021F4D2C */ if (_t4) goto L_021F4D48; else goto L_021F4D30;
   L_021F4D30: ; // 0x21f4d30
         /* 021F4D30 */ _t5 = cpu->r[3] + 0x0000001Cu;
         /* 021F4D30 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
-        /* 021F4D34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021F4D38 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4D34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021F4D38 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4D38 */ _t7 = _t6 & 0x00000001u;
         /* 021F4D38 */ if (_t7) goto L_021F4D48; else goto L_021F4D3C;
   L_021F4D3C: ; // 0x21f4d3c
-        /* 021F4D3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021F4D40 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4D3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021F4D40 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4D40 */ _t9 = _t8 & 0x00000001u;
         /* 021F4D40 */ if (_t9) goto L_021F4D48; else goto L_021F4D44;
   L_021F4D44: ; // 0x21f4d44
         /* 021F4D44 */ Gambit_fn_02790458(cpu);
   L_021F4D48: ; // 0x21f4d48
         /* 021F4D48 */ cpu->r[28] = cpu->r[28] + 0xFFFFFFFFu;
-        /* 021F4D48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 021F4D48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 021F4D4C */ cpu->r[30] = cpu->r[30] + 0x00000004u;
-        /* 021F4D50 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4D50 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4D50 */ _t11 = _t10 & 0x00000001u;
         /* 021F4D50 */ if (_t11) goto L_021F4D54; else goto L_021F4D24;
   L_021F4D54: ; // 0x21f4d54
         /* 021F4D54 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 021F4D54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 021F4D54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 021F4D58 */ cpu->r[31] = cpu->r[31] + 0x00000008u;
-        /* 021F4D5C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4D5C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4D5C */ _t13 = _t12 & 0x00000001u;
         /* 021F4D5C */ if (_t13) goto L_021F4D60; else goto L_021F4D1C;
   L_021F4D60: ; // 0x21f4d60
@@ -16182,8 +16182,8 @@ void Gambit_fn_021F4CFC(CPUState* cpu) {
         /* 021F4D6C */ rbrew_write32(cpu->mem, _t15, cpu->r[6]);
         /* 021F4D70 */ _t16 = cpu->r[3] + 0x000054F4u;
         /* 021F4D70 */ cpu->r[3] = rbrew_read32(cpu->mem, _t16);
-        /* 021F4D74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F4D78 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4D74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F4D78 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4D78 */ _t18 = _t17 & 0x00000001u;
         /* 021F4D78 */ if (_t18) goto L_021F4D80; else goto L_021F4D7C;
   L_021F4D7C: ; // 0x21f4d7c
@@ -16196,10 +16196,10 @@ void Gambit_fn_021F4CFC(CPUState* cpu) {
         /* 021F4D88 */ cpu->r[7] = rbrew_rlwinm(cpu->r[0], 0x00000002u, 0x00000000u, 0x0000001Du);
         /* 021F4D8C */ cpu->r[0] = cpu->r[12] + cpu->r[7];
         /* 021F4D90 */ cpu->r[5] = 0x00000000u;
-        /* 021F4D94 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
+        /* 021F4D94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
         /* 021F4D98 */ _t21 = cpu->r[27] + 0x00000254u;
         /* 021F4D98 */ rbrew_write32(cpu->mem, _t21, cpu->r[5]);
-        /* 021F4D9C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4D9C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4D9C */ _t23 = _t22 & 0x00000001u;
         /* 021F4D9C */ if (_t23) goto L_021F4DB8; else goto L_021F4DA0;
   L_021F4DA0: ; // 0x21f4da0
@@ -16207,10 +16207,10 @@ void Gambit_fn_021F4CFC(CPUState* cpu) {
         /* 021F4DA0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t24);
         /* 021F4DA4 */ cpu->r[12] = cpu->r[12] + 0x00000004u;
         /* 021F4DA8 */ cpu->r[5] = cpu->r[5] + cpu->r[8];
-        /* 021F4DAC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
+        /* 021F4DAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
         /* 021F4DB0 */ _t25 = cpu->r[27] + 0x00000254u;
         /* 021F4DB0 */ rbrew_write32(cpu->mem, _t25, cpu->r[5]);
-        /* 021F4DB4 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4DB4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4DB4 */ _t27 = _t26 & 0x00000001u;
         /* 021F4DB4 */ if (_t27) goto L_021F4DB8; else goto L_021F4DA0;
   L_021F4DB8: ; // 0x21f4db8
@@ -16233,8 +16233,8 @@ void Gambit_fn_021F4CFC(CPUState* cpu) {
         /* 021F4DD4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t32);
         /* 021F4DD8 */ _t33 = cpu->r[11] + 0x000002C8u;
         /* 021F4DD8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t33);
-        /* 021F4DDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000001u);
-        /* 021F4DE0 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F4DDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000001u));
+        /* 021F4DE0 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F4DE0 */ _t35 = _t34 & 0x00000001u;
         /* 021F4DE0 */ if (_t35) goto L_021F4DE4; else goto L_021F4E0C;
   L_021F4DE4: ; // 0x21f4de4
@@ -16276,8 +16276,8 @@ void Gambit_fn_021F4CFC(CPUState* cpu) {
         /* 021F4E40 */ cpu->f[0] = cpu->f[8] / cpu->f[9];
         /* 021F4E44 */ _t47 = cpu->r[12] + 0xFFFFC5B4u;
         /* 021F4E44 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t47);
-        /* 021F4E48 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
-        /* 021F4E4C */ _t48 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F4E48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
+        /* 021F4E4C */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F4E4C */ _t49 = _t48 & 0x00000001u;
         /* 021F4E4C */ if (_t49) goto L_021F4E50; else goto L_021F4EA4;
   L_021F4E50: ; // 0x21f4e50
@@ -16315,8 +16315,8 @@ void Gambit_fn_021F4CFC(CPUState* cpu) {
         /* 021F4EA4 */ cpu->r[10] = 0x10040000u;
         /* 021F4EA8 */ _t59 = cpu->r[10] + 0xFFFFC654u;
         /* 021F4EA8 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t59);
-        /* 021F4EAC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[12]);
-        /* 021F4EB0 */ _t60 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021F4EAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[12]));
+        /* 021F4EB0 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021F4EB0 */ _t61 = _t60 & 0x00000001u;
         /* 021F4EB0 */ if (_t61) goto L_021F4EB4; else goto L_021F4EB8;
   L_021F4EB4: ; // 0x21f4eb4
@@ -16676,20 +16676,20 @@ void Gambit_fn_021F4F78(CPUState* cpu) {
         /* 021F515C */ cpu->r[8] = 0x10040000u;
         /* 021F5160 */ _t94 = cpu->r[6] + 0x00000008u;
         /* 021F5160 */ cpu->r[0] = rbrew_read32(cpu->mem, _t94);
-        /* 021F5164 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u);
+        /* 021F5164 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u));
         /* 021F5168 */ _t95 = cpu->r[8] + 0xFFFFC684u;
         /* 021F5168 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t95);
         /* 021F516C */ cpu->r[3] = cpu->r[31] + 0x000000C0u;
         /* 021F5170 */ _t96 = cpu->r[31] + 0x00000068u;
         /* 021F5170 */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
-        /* 021F5174 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5174 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5174 */ _t98 = _t97 & 0x00000001u;
         /* 021F5174 */ if (_t98) goto L_021F5178; else goto L_021F5188;
   L_021F5178: ; // 0x21f5178
         /* 021F5178 */ cpu->r[3] = 0x00000010u;
         /* 021F517C */ Gambit_fn_02801A78(cpu);
-        /* 021F5180 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F5184 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5180 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F5184 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5184 */ _t100 = _t99 & 0x00000001u;
         /* 021F5184 */ if (_t100) goto L_021F51A8; else goto L_021F5188;
   L_021F5188: ; // 0x21f5188
@@ -16708,16 +16708,16 @@ void Gambit_fn_021F4F78(CPUState* cpu) {
         /* 021F51A4 */ _t106 = cpu->r[3] + 0x00000008u;
         /* 021F51A4 */ rbrew_write_f32(cpu->mem, _t106, cpu->f[0]);
   L_021F51A8: ; // 0x21f51a8
-        /* 021F51A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u);
+        /* 021F51A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u));
         /* 021F51AC */ cpu->r[3] = cpu->r[31] + 0x000000D0u;
-        /* 021F51B0 */ _t107 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F51B0 */ _t107 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F51B0 */ _t108 = _t107 & 0x00000001u;
         /* 021F51B0 */ if (_t108) goto L_021F51B4; else goto L_021F51C4;
   L_021F51B4: ; // 0x21f51b4
         /* 021F51B4 */ cpu->r[3] = 0x00000010u;
         /* 021F51B8 */ Gambit_fn_02801A78(cpu);
-        /* 021F51BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F51C0 */ _t109 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F51BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F51C0 */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F51C0 */ _t110 = _t109 & 0x00000001u;
         /* 021F51C0 */ if (_t110) goto L_021F51E4; else goto L_021F51C4;
   L_021F51C4: ; // 0x21f51c4
@@ -16812,7 +16812,7 @@ void Gambit_fn_021F4F78(CPUState* cpu) {
         /* 021F528C */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t144);
         /* 021F5290 */ _t145 = cpu->r[1] + 0x00000030u;
         /* 021F5290 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t145);
-        /* 021F5294 */ _t146 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021F5294 */ _t146 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021F5294 */ _t147 = _t146 & 0x00000001u;
         /* 021F5294 */ if (_t147) goto L_021F5298; // else: addr-0 trap, fall-through
   L_021F5298: ; // 0x21f5298
@@ -16828,15 +16828,15 @@ void Gambit_fn_021F52A8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021F52A8: ; // 0x21f52a8
-        /* 021F52A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F52AC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F52A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F52AC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F52AC */ _t1 = _t0 & 0x00000001u;
         /* 021F52AC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021F52AC */ goto L_021F52B0;
   L_021F52B0: ; // 0x21f52b0
         /* 021F52B0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021F52B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021F52B4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F52B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021F52B4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F52B4 */ _t3 = _t2 & 0x00000001u;
         /* 021F52B4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021F52B4 */ goto L_021F52B8;
@@ -16855,8 +16855,8 @@ void Gambit_fn_021F52A8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -16870,15 +16870,15 @@ void Gambit_fn_021F52A8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -17119,8 +17119,8 @@ void Gambit_fn_021F53F0(CPUState* cpu) {
   L_021F53F0: ; // 0x21f53f0
         /* 021F53F0 */ _t0 = cpu->r[3] + 0x00000008u;
         /* 021F53F0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 021F53F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021F53F8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F53F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021F53F8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F53F8 */ _t2 = _t1 & 0x00000001u;
         /* 021F53F8 */ if (_t2) goto L_021F5404; else goto L_021F53FC;
   L_021F53FC: ; // 0x21f53fc
@@ -17138,8 +17138,8 @@ void Gambit_fn_021F540C(CPUState* cpu) {
   L_021F540C: ; // 0x21f540c
         /* 021F540C */ _t0 = cpu->r[3] + 0x00000008u;
         /* 021F540C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 021F5410 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021F5414 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5410 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021F5414 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5414 */ _t2 = _t1 & 0x00000001u;
         /* 021F5414 */ if (_t2) goto L_021F5420; else goto L_021F5418;
   L_021F5418: ; // 0x21f5418
@@ -17171,8 +17171,8 @@ void Gambit_fn_021F5438(CPUState* cpu) {
         /* 021F5438 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021F5438 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021F543C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021F543C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021F5440 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F543C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021F5440 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5440 */ _t2 = _t1 & 0x00000001u;
         /* 021F5440 */ _t3 = _t2 ^ 0x00000001u;
         /* 021F5440 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -17194,8 +17194,8 @@ void Gambit_fn_021F5454(CPUState* cpu) {
         /* 021F5454 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021F5454 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021F5458 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021F5458 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021F545C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5458 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021F545C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F545C */ _t2 = _t1 & 0x00000001u;
         /* 021F545C */ _t3 = _t2 ^ 0x00000001u;
         /* 021F545C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -17217,8 +17217,8 @@ void Gambit_fn_021F5470(CPUState* cpu) {
         /* 021F5470 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021F5470 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021F5474 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Eu, 0x0000001Fu, 0x0000001Fu);
-        /* 021F5474 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021F5478 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5474 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021F5478 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5478 */ _t2 = _t1 & 0x00000001u;
         /* 021F5478 */ _t3 = _t2 ^ 0x00000001u;
         /* 021F5478 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -17240,8 +17240,8 @@ void Gambit_fn_021F548C(CPUState* cpu) {
         /* 021F548C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021F548C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021F5490 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021F5490 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021F5494 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5490 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021F5494 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5494 */ _t2 = _t1 & 0x00000001u;
         /* 021F5494 */ _t3 = _t2 ^ 0x00000001u;
         /* 021F5494 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -17263,8 +17263,8 @@ void Gambit_fn_021F54A8(CPUState* cpu) {
         /* 021F54A8 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021F54A8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021F54AC */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Cu, 0x0000001Fu, 0x0000001Fu);
-        /* 021F54AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021F54B0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F54AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021F54B0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F54B0 */ _t2 = _t1 & 0x00000001u;
         /* 021F54B0 */ _t3 = _t2 ^ 0x00000001u;
         /* 021F54B0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -17286,8 +17286,8 @@ void Gambit_fn_021F54C4(CPUState* cpu) {
         /* 021F54C4 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021F54C4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021F54C8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Bu, 0x0000001Fu, 0x0000001Fu);
-        /* 021F54C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021F54CC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F54C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021F54CC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F54CC */ _t2 = _t1 & 0x00000001u;
         /* 021F54CC */ _t3 = _t2 ^ 0x00000001u;
         /* 021F54CC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -17309,8 +17309,8 @@ void Gambit_fn_021F54E0(CPUState* cpu) {
         /* 021F54E0 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021F54E0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021F54E4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021F54E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021F54E8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F54E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021F54E8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F54E8 */ _t2 = _t1 & 0x00000001u;
         /* 021F54E8 */ _t3 = _t2 ^ 0x00000001u;
         /* 021F54E8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -17424,8 +17424,8 @@ void Gambit_fn_021F5560(CPUState* cpu) {
         /* 021F5570 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F5574 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021F5574 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021F5578 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021F557C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5578 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021F557C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F557C */ _t5 = _t4 & 0x00000001u;
         /* 021F557C */ if (_t5) goto L_021F5580; else goto L_021F559C;
   L_021F5580: ; // 0x21f5580
@@ -17464,8 +17464,8 @@ void Gambit_fn_021F5564(CPUState* cpu) {
         /* 021F5570 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F5574 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021F5574 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021F5578 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021F557C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5578 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021F557C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F557C */ _t5 = _t4 & 0x00000001u;
         /* 021F557C */ if (_t5) goto L_021F5580; else goto L_021F559C;
   L_021F5580: ; // 0x21f5580
@@ -17499,9 +17499,9 @@ void Gambit_fn_021F55B0(CPUState* cpu) {
         /* 021F55B4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 021F55B4 */ cpu->r[9] = _t0;
         /* 021F55B8 */ cpu->r[12] = 0x101D0000u;
-        /* 021F55BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021F55BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021F55C0 */ cpu->r[12] = cpu->r[12] + 0xFFFFDB18u;
-        /* 021F55C4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F55C4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F55C4 */ _t2 = _t1 & 0x00000001u;
         /* 021F55C4 */ if (_t2) goto L_021F55C8; else goto L_021F55DC;
   L_021F55C8: ; // 0x21f55c8
@@ -17513,8 +17513,8 @@ void Gambit_fn_021F55B0(CPUState* cpu) {
         /* 021F55D8 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 021F55D8 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_021F55DC: ; // 0x21f55dc
-        /* 021F55DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021F55E0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F55DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021F55E0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F55E0 */ _t6 = _t5 & 0x00000001u;
         /* 021F55E0 */ if (_t6) goto L_021F55E4; else goto L_021F55EC;
   L_021F55E4: ; // 0x21f55e4
@@ -17526,9 +17526,9 @@ void Gambit_fn_021F55B0(CPUState* cpu) {
         /* 021F55F0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 021F55F0 */ cpu->r[7] = _t7;
         /* 021F55F4 */ cpu->r[11] = 0x101D0000u;
-        /* 021F55F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021F55F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021F55FC */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021F5600 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5600 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5600 */ _t9 = _t8 & 0x00000001u;
         /* 021F5600 */ if (_t9) goto L_021F5604; else goto L_021F5618;
   L_021F5604: ; // 0x21f5604
@@ -17975,8 +17975,8 @@ void Gambit_fn_021F57FC(CPUState* cpu) {
         /* 021F580C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F5810 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021F5810 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021F5814 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021F5818 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5814 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021F5818 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5818 */ _t5 = _t4 & 0x00000001u;
         /* 021F5818 */ if (_t5) goto L_021F581C; else goto L_021F5838;
   L_021F581C: ; // 0x21f581c
@@ -18032,8 +18032,8 @@ void Gambit_fn_021F5800(CPUState* cpu) {
         /* 021F580C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F5810 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021F5810 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021F5814 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021F5818 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5814 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021F5818 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5818 */ _t5 = _t4 & 0x00000001u;
         /* 021F5818 */ if (_t5) goto L_021F581C; else goto L_021F5838;
   L_021F581C: ; // 0x21f581c
@@ -18089,8 +18089,8 @@ void Gambit_fn_021F587C(CPUState* cpu) {
         /* 021F5888 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F588C */ Gambit_fn_02801A78(cpu);
         /* 021F5890 */ cpu->r[31] = cpu->r[3];
-        /* 021F5890 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F5894 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5890 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F5894 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5894 */ _t4 = _t3 & 0x00000001u;
         /* 021F5894 */ if (_t4) goto L_021F58AC; else goto L_021F5898;
   L_021F5898: ; // 0x21f5898
@@ -18126,8 +18126,8 @@ void Gambit_fn_021F58C8(CPUState* cpu) {
         /* 021F58D4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F58D8 */ Gambit_fn_02801A78(cpu);
         /* 021F58DC */ cpu->r[31] = cpu->r[3];
-        /* 021F58DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F58E0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F58DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F58E0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F58E0 */ _t4 = _t3 & 0x00000001u;
         /* 021F58E0 */ if (_t4) goto L_021F58F8; else goto L_021F58E4;
   L_021F58E4: ; // 0x21f58e4
@@ -18163,8 +18163,8 @@ void Gambit_fn_021F5914(CPUState* cpu) {
         /* 021F5920 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F5924 */ Gambit_fn_02801A78(cpu);
         /* 021F5928 */ cpu->r[31] = cpu->r[3];
-        /* 021F5928 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F592C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5928 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F592C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F592C */ _t4 = _t3 & 0x00000001u;
         /* 021F592C */ if (_t4) goto L_021F5944; else goto L_021F5930;
   L_021F5930: ; // 0x21f5930
@@ -18200,8 +18200,8 @@ void Gambit_fn_021F5960(CPUState* cpu) {
         /* 021F596C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F5970 */ Gambit_fn_02801A78(cpu);
         /* 021F5974 */ cpu->r[31] = cpu->r[3];
-        /* 021F5974 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F5978 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F5978 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5978 */ _t4 = _t3 & 0x00000001u;
         /* 021F5978 */ if (_t4) goto L_021F5990; else goto L_021F597C;
   L_021F597C: ; // 0x21f597c
@@ -18237,8 +18237,8 @@ void Gambit_fn_021F59AC(CPUState* cpu) {
         /* 021F59B8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F59BC */ Gambit_fn_02801A78(cpu);
         /* 021F59C0 */ cpu->r[31] = cpu->r[3];
-        /* 021F59C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F59C4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F59C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F59C4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F59C4 */ _t4 = _t3 & 0x00000001u;
         /* 021F59C4 */ if (_t4) goto L_021F59DC; else goto L_021F59C8;
   L_021F59C8: ; // 0x21f59c8
@@ -18274,8 +18274,8 @@ void Gambit_fn_021F59F8(CPUState* cpu) {
         /* 021F5A04 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F5A08 */ Gambit_fn_02801A78(cpu);
         /* 021F5A0C */ cpu->r[31] = cpu->r[3];
-        /* 021F5A0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F5A10 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5A0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F5A10 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5A10 */ _t4 = _t3 & 0x00000001u;
         /* 021F5A10 */ if (_t4) goto L_021F5A28; else goto L_021F5A14;
   L_021F5A14: ; // 0x21f5a14
@@ -18311,8 +18311,8 @@ void Gambit_fn_021F5A44(CPUState* cpu) {
         /* 021F5A50 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F5A54 */ Gambit_fn_02801A78(cpu);
         /* 021F5A58 */ cpu->r[31] = cpu->r[3];
-        /* 021F5A58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F5A5C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5A58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F5A5C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5A5C */ _t4 = _t3 & 0x00000001u;
         /* 021F5A5C */ if (_t4) goto L_021F5A74; else goto L_021F5A60;
   L_021F5A60: ; // 0x21f5a60
@@ -18348,8 +18348,8 @@ void Gambit_fn_021F5A90(CPUState* cpu) {
         /* 021F5A9C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F5AA0 */ Gambit_fn_02801A78(cpu);
         /* 021F5AA4 */ cpu->r[31] = cpu->r[3];
-        /* 021F5AA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F5AA8 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5AA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F5AA8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5AA8 */ _t4 = _t3 & 0x00000001u;
         /* 021F5AA8 */ if (_t4) goto L_021F5AC0; else goto L_021F5AAC;
   L_021F5AAC: ; // 0x21f5aac
@@ -18385,8 +18385,8 @@ void Gambit_fn_021F5ADC(CPUState* cpu) {
         /* 021F5AE8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F5AEC */ Gambit_fn_02801A78(cpu);
         /* 021F5AF0 */ cpu->r[31] = cpu->r[3];
-        /* 021F5AF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F5AF4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5AF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F5AF4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5AF4 */ _t4 = _t3 & 0x00000001u;
         /* 021F5AF4 */ if (_t4) goto L_021F5B0C; else goto L_021F5AF8;
   L_021F5AF8: ; // 0x21f5af8
@@ -18422,8 +18422,8 @@ void Gambit_fn_021F5B28(CPUState* cpu) {
         /* 021F5B34 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F5B38 */ Gambit_fn_02801A78(cpu);
         /* 021F5B3C */ cpu->r[31] = cpu->r[3];
-        /* 021F5B3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F5B40 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5B3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F5B40 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5B40 */ _t4 = _t3 & 0x00000001u;
         /* 021F5B40 */ if (_t4) goto L_021F5B58; else goto L_021F5B44;
   L_021F5B44: ; // 0x21f5b44
@@ -18459,8 +18459,8 @@ void Gambit_fn_021F5B74(CPUState* cpu) {
         /* 021F5B80 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F5B84 */ Gambit_fn_02801A78(cpu);
         /* 021F5B88 */ cpu->r[31] = cpu->r[3];
-        /* 021F5B88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F5B8C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5B88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F5B8C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5B8C */ _t4 = _t3 & 0x00000001u;
         /* 021F5B8C */ if (_t4) goto L_021F5BA4; else goto L_021F5B90;
   L_021F5B90: ; // 0x21f5b90
@@ -18496,8 +18496,8 @@ void Gambit_fn_021F5BD0(CPUState* cpu) {
         /* 021F5BDC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F5BE0 */ Gambit_fn_02801A78(cpu);
         /* 021F5BE4 */ cpu->r[31] = cpu->r[3];
-        /* 021F5BE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F5BE8 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5BE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F5BE8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5BE8 */ _t4 = _t3 & 0x00000001u;
         /* 021F5BE8 */ if (_t4) goto L_021F5C00; else goto L_021F5BEC;
   L_021F5BEC: ; // 0x21f5bec
@@ -18533,8 +18533,8 @@ void Gambit_fn_021F5C34(CPUState* cpu) {
         /* 021F5C40 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F5C44 */ Gambit_fn_02801A78(cpu);
         /* 021F5C48 */ cpu->r[31] = cpu->r[3];
-        /* 021F5C48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F5C4C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5C48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F5C4C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5C4C */ _t4 = _t3 & 0x00000001u;
         /* 021F5C4C */ if (_t4) goto L_021F5C64; else goto L_021F5C50;
   L_021F5C50: ; // 0x21f5c50
@@ -18570,8 +18570,8 @@ void Gambit_fn_021F5C80(CPUState* cpu) {
         /* 021F5C8C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F5C90 */ Gambit_fn_02801A78(cpu);
         /* 021F5C94 */ cpu->r[31] = cpu->r[3];
-        /* 021F5C94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F5C98 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5C94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F5C98 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5C98 */ _t4 = _t3 & 0x00000001u;
         /* 021F5C98 */ if (_t4) goto L_021F5CB0; else goto L_021F5C9C;
   L_021F5C9C: ; // 0x21f5c9c
@@ -18607,8 +18607,8 @@ void Gambit_fn_021F5CCC(CPUState* cpu) {
         /* 021F5CD8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F5CDC */ Gambit_fn_02801A78(cpu);
         /* 021F5CE0 */ cpu->r[31] = cpu->r[3];
-        /* 021F5CE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F5CE4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5CE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F5CE4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5CE4 */ _t4 = _t3 & 0x00000001u;
         /* 021F5CE4 */ if (_t4) goto L_021F5CFC; else goto L_021F5CE8;
   L_021F5CE8: ; // 0x21f5ce8
@@ -18644,8 +18644,8 @@ void Gambit_fn_021F5D18(CPUState* cpu) {
         /* 021F5D24 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F5D28 */ Gambit_fn_02801A78(cpu);
         /* 021F5D2C */ cpu->r[31] = cpu->r[3];
-        /* 021F5D2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F5D30 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5D2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F5D30 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5D30 */ _t4 = _t3 & 0x00000001u;
         /* 021F5D30 */ if (_t4) goto L_021F5D48; else goto L_021F5D34;
   L_021F5D34: ; // 0x21f5d34
@@ -18681,8 +18681,8 @@ void Gambit_fn_021F5E0C(CPUState* cpu) {
         /* 021F5E18 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F5E1C */ Gambit_fn_02801A78(cpu);
         /* 021F5E20 */ cpu->r[31] = cpu->r[3];
-        /* 021F5E20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F5E24 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5E20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F5E24 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5E24 */ _t4 = _t3 & 0x00000001u;
         /* 021F5E24 */ if (_t4) goto L_021F5E3C; else goto L_021F5E28;
   L_021F5E28: ; // 0x21f5e28
@@ -18718,8 +18718,8 @@ void Gambit_fn_021F5E58(CPUState* cpu) {
         /* 021F5E64 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F5E68 */ Gambit_fn_02801A78(cpu);
         /* 021F5E6C */ cpu->r[31] = cpu->r[3];
-        /* 021F5E6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F5E70 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5E6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F5E70 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5E70 */ _t4 = _t3 & 0x00000001u;
         /* 021F5E70 */ if (_t4) goto L_021F5E88; else goto L_021F5E74;
   L_021F5E74: ; // 0x21f5e74
@@ -18755,8 +18755,8 @@ void Gambit_fn_021F5EA4(CPUState* cpu) {
         /* 021F5EB0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F5EB4 */ Gambit_fn_02801A78(cpu);
         /* 021F5EB8 */ cpu->r[31] = cpu->r[3];
-        /* 021F5EB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F5EBC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5EB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F5EBC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5EBC */ _t4 = _t3 & 0x00000001u;
         /* 021F5EBC */ if (_t4) goto L_021F5ED4; else goto L_021F5EC0;
   L_021F5EC0: ; // 0x21f5ec0
@@ -18792,8 +18792,8 @@ void Gambit_fn_021F5EF0(CPUState* cpu) {
         /* 021F5EFC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F5F00 */ Gambit_fn_02801A78(cpu);
         /* 021F5F04 */ cpu->r[31] = cpu->r[3];
-        /* 021F5F04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F5F08 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5F04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F5F08 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5F08 */ _t4 = _t3 & 0x00000001u;
         /* 021F5F08 */ if (_t4) goto L_021F5F20; else goto L_021F5F0C;
   L_021F5F0C: ; // 0x21f5f0c
@@ -18829,8 +18829,8 @@ void Gambit_fn_021F5F3C(CPUState* cpu) {
         /* 021F5F48 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F5F4C */ Gambit_fn_02801A78(cpu);
         /* 021F5F50 */ cpu->r[31] = cpu->r[3];
-        /* 021F5F50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F5F54 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5F50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F5F54 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5F54 */ _t4 = _t3 & 0x00000001u;
         /* 021F5F54 */ if (_t4) goto L_021F5F6C; else goto L_021F5F58;
   L_021F5F58: ; // 0x21f5f58
@@ -18866,8 +18866,8 @@ void Gambit_fn_021F5F88(CPUState* cpu) {
         /* 021F5F94 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F5F98 */ Gambit_fn_02801A78(cpu);
         /* 021F5F9C */ cpu->r[31] = cpu->r[3];
-        /* 021F5F9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F5FA0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5F9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F5FA0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5FA0 */ _t4 = _t3 & 0x00000001u;
         /* 021F5FA0 */ if (_t4) goto L_021F5FB8; else goto L_021F5FA4;
   L_021F5FA4: ; // 0x21f5fa4
@@ -18903,8 +18903,8 @@ void Gambit_fn_021F5FD4(CPUState* cpu) {
         /* 021F5FE0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F5FE4 */ Gambit_fn_02801A78(cpu);
         /* 021F5FE8 */ cpu->r[31] = cpu->r[3];
-        /* 021F5FE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F5FEC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F5FE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F5FEC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F5FEC */ _t4 = _t3 & 0x00000001u;
         /* 021F5FEC */ if (_t4) goto L_021F6004; else goto L_021F5FF0;
   L_021F5FF0: ; // 0x21f5ff0
@@ -18940,8 +18940,8 @@ void Gambit_fn_021F6020(CPUState* cpu) {
         /* 021F602C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F6030 */ Gambit_fn_02801A78(cpu);
         /* 021F6034 */ cpu->r[31] = cpu->r[3];
-        /* 021F6034 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F6038 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6034 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F6038 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6038 */ _t4 = _t3 & 0x00000001u;
         /* 021F6038 */ if (_t4) goto L_021F6050; else goto L_021F603C;
   L_021F603C: ; // 0x21f603c
@@ -18977,8 +18977,8 @@ void Gambit_fn_021F6074(CPUState* cpu) {
         /* 021F6080 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F6084 */ Gambit_fn_02801A78(cpu);
         /* 021F6088 */ cpu->r[31] = cpu->r[3];
-        /* 021F6088 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F608C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6088 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F608C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F608C */ _t4 = _t3 & 0x00000001u;
         /* 021F608C */ if (_t4) goto L_021F60A4; else goto L_021F6090;
   L_021F6090: ; // 0x21f6090
@@ -19014,8 +19014,8 @@ void Gambit_fn_021F60C0(CPUState* cpu) {
         /* 021F60CC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F60D0 */ Gambit_fn_02801A78(cpu);
         /* 021F60D4 */ cpu->r[31] = cpu->r[3];
-        /* 021F60D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F60D8 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F60D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F60D8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F60D8 */ _t4 = _t3 & 0x00000001u;
         /* 021F60D8 */ if (_t4) goto L_021F60F0; else goto L_021F60DC;
   L_021F60DC: ; // 0x21f60dc
@@ -19051,8 +19051,8 @@ void Gambit_fn_021F610C(CPUState* cpu) {
         /* 021F6118 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F611C */ Gambit_fn_02801A78(cpu);
         /* 021F6120 */ cpu->r[31] = cpu->r[3];
-        /* 021F6120 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F6124 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6120 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F6124 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6124 */ _t4 = _t3 & 0x00000001u;
         /* 021F6124 */ if (_t4) goto L_021F613C; else goto L_021F6128;
   L_021F6128: ; // 0x21f6128
@@ -19088,8 +19088,8 @@ void Gambit_fn_021F6158(CPUState* cpu) {
         /* 021F6164 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F6168 */ Gambit_fn_02801A78(cpu);
         /* 021F616C */ cpu->r[31] = cpu->r[3];
-        /* 021F616C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F6170 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F616C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F6170 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6170 */ _t4 = _t3 & 0x00000001u;
         /* 021F6170 */ if (_t4) goto L_021F6188; else goto L_021F6174;
   L_021F6174: ; // 0x21f6174
@@ -19125,8 +19125,8 @@ void Gambit_fn_021F61A4(CPUState* cpu) {
         /* 021F61B0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F61B4 */ Gambit_fn_02801A78(cpu);
         /* 021F61B8 */ cpu->r[31] = cpu->r[3];
-        /* 021F61B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F61BC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F61B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F61BC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F61BC */ _t4 = _t3 & 0x00000001u;
         /* 021F61BC */ if (_t4) goto L_021F61D4; else goto L_021F61C0;
   L_021F61C0: ; // 0x21f61c0
@@ -19162,8 +19162,8 @@ void Gambit_fn_021F61F0(CPUState* cpu) {
         /* 021F61FC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F6200 */ Gambit_fn_02801A78(cpu);
         /* 021F6204 */ cpu->r[31] = cpu->r[3];
-        /* 021F6204 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F6208 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6204 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F6208 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6208 */ _t4 = _t3 & 0x00000001u;
         /* 021F6208 */ if (_t4) goto L_021F6220; else goto L_021F620C;
   L_021F620C: ; // 0x21f620c
@@ -19199,8 +19199,8 @@ void Gambit_fn_021F623C(CPUState* cpu) {
         /* 021F6248 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F624C */ Gambit_fn_02801A78(cpu);
         /* 021F6250 */ cpu->r[31] = cpu->r[3];
-        /* 021F6250 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F6254 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6250 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F6254 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6254 */ _t4 = _t3 & 0x00000001u;
         /* 021F6254 */ if (_t4) goto L_021F626C; else goto L_021F6258;
   L_021F6258: ; // 0x21f6258
@@ -19236,8 +19236,8 @@ void Gambit_fn_021F6288(CPUState* cpu) {
         /* 021F6294 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F6298 */ Gambit_fn_02801A78(cpu);
         /* 021F629C */ cpu->r[31] = cpu->r[3];
-        /* 021F629C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F62A0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F629C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F62A0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F62A0 */ _t4 = _t3 & 0x00000001u;
         /* 021F62A0 */ if (_t4) goto L_021F62B8; else goto L_021F62A4;
   L_021F62A4: ; // 0x21f62a4
@@ -19273,8 +19273,8 @@ void Gambit_fn_021F62D4(CPUState* cpu) {
         /* 021F62E0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F62E4 */ Gambit_fn_02801A78(cpu);
         /* 021F62E8 */ cpu->r[31] = cpu->r[3];
-        /* 021F62E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F62EC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F62E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F62EC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F62EC */ _t4 = _t3 & 0x00000001u;
         /* 021F62EC */ if (_t4) goto L_021F6304; else goto L_021F62F0;
   L_021F62F0: ; // 0x21f62f0
@@ -19310,8 +19310,8 @@ void Gambit_fn_021F6320(CPUState* cpu) {
         /* 021F632C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F6330 */ Gambit_fn_02801A78(cpu);
         /* 021F6334 */ cpu->r[31] = cpu->r[3];
-        /* 021F6334 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F6338 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6334 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F6338 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6338 */ _t4 = _t3 & 0x00000001u;
         /* 021F6338 */ if (_t4) goto L_021F6350; else goto L_021F633C;
   L_021F633C: ; // 0x21f633c
@@ -19347,8 +19347,8 @@ void Gambit_fn_021F636C(CPUState* cpu) {
         /* 021F6378 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F637C */ Gambit_fn_02801A78(cpu);
         /* 021F6380 */ cpu->r[31] = cpu->r[3];
-        /* 021F6380 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F6384 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6380 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F6384 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6384 */ _t4 = _t3 & 0x00000001u;
         /* 021F6384 */ if (_t4) goto L_021F639C; else goto L_021F6388;
   L_021F6388: ; // 0x21f6388
@@ -19384,8 +19384,8 @@ void Gambit_fn_021F63B8(CPUState* cpu) {
         /* 021F63C4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F63C8 */ Gambit_fn_02801A78(cpu);
         /* 021F63CC */ cpu->r[31] = cpu->r[3];
-        /* 021F63CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F63D0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F63CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F63D0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F63D0 */ _t4 = _t3 & 0x00000001u;
         /* 021F63D0 */ if (_t4) goto L_021F63E8; else goto L_021F63D4;
   L_021F63D4: ; // 0x21f63d4
@@ -19421,8 +19421,8 @@ void Gambit_fn_021F6404(CPUState* cpu) {
         /* 021F6410 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F6414 */ Gambit_fn_02801A78(cpu);
         /* 021F6418 */ cpu->r[31] = cpu->r[3];
-        /* 021F6418 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F641C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F641C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F641C */ _t4 = _t3 & 0x00000001u;
         /* 021F641C */ if (_t4) goto L_021F6434; else goto L_021F6420;
   L_021F6420: ; // 0x21f6420
@@ -19458,8 +19458,8 @@ void Gambit_fn_021F6450(CPUState* cpu) {
         /* 021F645C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F6460 */ Gambit_fn_02801A78(cpu);
         /* 021F6464 */ cpu->r[31] = cpu->r[3];
-        /* 021F6464 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F6468 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F6468 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6468 */ _t4 = _t3 & 0x00000001u;
         /* 021F6468 */ if (_t4) goto L_021F6480; else goto L_021F646C;
   L_021F646C: ; // 0x21f646c
@@ -19495,8 +19495,8 @@ void Gambit_fn_021F649C(CPUState* cpu) {
         /* 021F64A8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F64AC */ Gambit_fn_02801A78(cpu);
         /* 021F64B0 */ cpu->r[31] = cpu->r[3];
-        /* 021F64B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F64B4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F64B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F64B4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F64B4 */ _t4 = _t3 & 0x00000001u;
         /* 021F64B4 */ if (_t4) goto L_021F64CC; else goto L_021F64B8;
   L_021F64B8: ; // 0x21f64b8
@@ -19532,8 +19532,8 @@ void Gambit_fn_021F64E8(CPUState* cpu) {
         /* 021F64F4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F64F8 */ Gambit_fn_02801A78(cpu);
         /* 021F64FC */ cpu->r[31] = cpu->r[3];
-        /* 021F64FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F6500 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F64FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F6500 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6500 */ _t4 = _t3 & 0x00000001u;
         /* 021F6500 */ if (_t4) goto L_021F6518; else goto L_021F6504;
   L_021F6504: ; // 0x21f6504
@@ -19569,8 +19569,8 @@ void Gambit_fn_021F6534(CPUState* cpu) {
         /* 021F6540 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F6544 */ Gambit_fn_02801A78(cpu);
         /* 021F6548 */ cpu->r[31] = cpu->r[3];
-        /* 021F6548 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F654C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6548 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F654C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F654C */ _t4 = _t3 & 0x00000001u;
         /* 021F654C */ if (_t4) goto L_021F6564; else goto L_021F6550;
   L_021F6550: ; // 0x21f6550
@@ -19606,8 +19606,8 @@ void Gambit_fn_021F6580(CPUState* cpu) {
         /* 021F658C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F6590 */ Gambit_fn_02801A78(cpu);
         /* 021F6594 */ cpu->r[31] = cpu->r[3];
-        /* 021F6594 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F6598 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6594 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F6598 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6598 */ _t4 = _t3 & 0x00000001u;
         /* 021F6598 */ if (_t4) goto L_021F65B0; else goto L_021F659C;
   L_021F659C: ; // 0x21f659c
@@ -19643,8 +19643,8 @@ void Gambit_fn_021F65CC(CPUState* cpu) {
         /* 021F65D8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F65DC */ Gambit_fn_02801A78(cpu);
         /* 021F65E0 */ cpu->r[31] = cpu->r[3];
-        /* 021F65E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F65E4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F65E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F65E4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F65E4 */ _t4 = _t3 & 0x00000001u;
         /* 021F65E4 */ if (_t4) goto L_021F65FC; else goto L_021F65E8;
   L_021F65E8: ; // 0x21f65e8
@@ -19680,8 +19680,8 @@ void Gambit_fn_021F6618(CPUState* cpu) {
         /* 021F6624 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F6628 */ Gambit_fn_02801A78(cpu);
         /* 021F662C */ cpu->r[31] = cpu->r[3];
-        /* 021F662C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F6630 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F662C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F6630 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6630 */ _t4 = _t3 & 0x00000001u;
         /* 021F6630 */ if (_t4) goto L_021F6648; else goto L_021F6634;
   L_021F6634: ; // 0x21f6634
@@ -19717,8 +19717,8 @@ void Gambit_fn_021F6664(CPUState* cpu) {
         /* 021F6670 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F6674 */ Gambit_fn_02801A78(cpu);
         /* 021F6678 */ cpu->r[31] = cpu->r[3];
-        /* 021F6678 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F667C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6678 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F667C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F667C */ _t4 = _t3 & 0x00000001u;
         /* 021F667C */ if (_t4) goto L_021F6694; else goto L_021F6680;
   L_021F6680: ; // 0x21f6680
@@ -19754,8 +19754,8 @@ void Gambit_fn_021F66B0(CPUState* cpu) {
         /* 021F66BC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F66C0 */ Gambit_fn_02801A78(cpu);
         /* 021F66C4 */ cpu->r[31] = cpu->r[3];
-        /* 021F66C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F66C8 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F66C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F66C8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F66C8 */ _t4 = _t3 & 0x00000001u;
         /* 021F66C8 */ if (_t4) goto L_021F66E0; else goto L_021F66CC;
   L_021F66CC: ; // 0x21f66cc
@@ -19791,8 +19791,8 @@ void Gambit_fn_021F66FC(CPUState* cpu) {
         /* 021F6708 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F670C */ Gambit_fn_02801A78(cpu);
         /* 021F6710 */ cpu->r[31] = cpu->r[3];
-        /* 021F6710 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F6714 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F6714 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6714 */ _t4 = _t3 & 0x00000001u;
         /* 021F6714 */ if (_t4) goto L_021F672C; else goto L_021F6718;
   L_021F6718: ; // 0x21f6718
@@ -19828,8 +19828,8 @@ void Gambit_fn_021F6748(CPUState* cpu) {
         /* 021F6754 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F6758 */ Gambit_fn_02801A78(cpu);
         /* 021F675C */ cpu->r[31] = cpu->r[3];
-        /* 021F675C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F6760 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F675C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F6760 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6760 */ _t4 = _t3 & 0x00000001u;
         /* 021F6760 */ if (_t4) goto L_021F6778; else goto L_021F6764;
   L_021F6764: ; // 0x21f6764
@@ -19865,8 +19865,8 @@ void Gambit_fn_021F6794(CPUState* cpu) {
         /* 021F67A0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F67A4 */ Gambit_fn_02801A78(cpu);
         /* 021F67A8 */ cpu->r[31] = cpu->r[3];
-        /* 021F67A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F67AC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F67A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F67AC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F67AC */ _t4 = _t3 & 0x00000001u;
         /* 021F67AC */ if (_t4) goto L_021F67C4; else goto L_021F67B0;
   L_021F67B0: ; // 0x21f67b0
@@ -19902,8 +19902,8 @@ void Gambit_fn_021F67F0(CPUState* cpu) {
         /* 021F67FC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F6800 */ Gambit_fn_02801A78(cpu);
         /* 021F6804 */ cpu->r[31] = cpu->r[3];
-        /* 021F6804 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F6808 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6804 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F6808 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6808 */ _t4 = _t3 & 0x00000001u;
         /* 021F6808 */ if (_t4) goto L_021F6820; else goto L_021F680C;
   L_021F680C: ; // 0x21f680c
@@ -19939,8 +19939,8 @@ void Gambit_fn_021F683C(CPUState* cpu) {
         /* 021F6848 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F684C */ Gambit_fn_02801A78(cpu);
         /* 021F6850 */ cpu->r[31] = cpu->r[3];
-        /* 021F6850 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F6854 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6850 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F6854 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6854 */ _t4 = _t3 & 0x00000001u;
         /* 021F6854 */ if (_t4) goto L_021F686C; else goto L_021F6858;
   L_021F6858: ; // 0x21f6858
@@ -19976,8 +19976,8 @@ void Gambit_fn_021F6888(CPUState* cpu) {
         /* 021F6894 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F6898 */ Gambit_fn_02801A78(cpu);
         /* 021F689C */ cpu->r[31] = cpu->r[3];
-        /* 021F689C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F68A0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F689C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F68A0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F68A0 */ _t4 = _t3 & 0x00000001u;
         /* 021F68A0 */ if (_t4) goto L_021F68B8; else goto L_021F68A4;
   L_021F68A4: ; // 0x21f68a4
@@ -20013,8 +20013,8 @@ void Gambit_fn_021F68D4(CPUState* cpu) {
         /* 021F68E0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F68E4 */ Gambit_fn_02801A78(cpu);
         /* 021F68E8 */ cpu->r[31] = cpu->r[3];
-        /* 021F68E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F68EC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F68E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F68EC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F68EC */ _t4 = _t3 & 0x00000001u;
         /* 021F68EC */ if (_t4) goto L_021F6904; else goto L_021F68F0;
   L_021F68F0: ; // 0x21f68f0
@@ -20050,8 +20050,8 @@ void Gambit_fn_021F6920(CPUState* cpu) {
         /* 021F692C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F6930 */ Gambit_fn_02801A78(cpu);
         /* 021F6934 */ cpu->r[31] = cpu->r[3];
-        /* 021F6934 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021F6938 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021F6938 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6938 */ _t4 = _t3 & 0x00000001u;
         /* 021F6938 */ if (_t4) goto L_021F6950; else goto L_021F693C;
   L_021F693C: ; // 0x21f693c
@@ -20084,17 +20084,17 @@ void Gambit_fn_021F6A00(CPUState* cpu) {
         /* 021F6A08 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021F6A08 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021F6A0C */ cpu->r[31] = cpu->r[4];
-        /* 021F6A10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021F6A10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021F6A14 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021F6A14 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021F6A18 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6A18 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6A18 */ _t4 = _t3 & 0x00000001u;
         /* 021F6A18 */ if (_t4) goto L_021F6A1C; else goto L_021F6A2C;
   L_021F6A1C: ; // 0x21f6a1c
         /* 021F6A1C */ cpu->r[3] = 0x00000018u;
         /* 021F6A20 */ Gambit_fn_02801A78(cpu);
-        /* 021F6A24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F6A28 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6A24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F6A28 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6A28 */ _t6 = _t5 & 0x00000001u;
         /* 021F6A28 */ if (_t6) goto L_021F6AC0; else goto L_021F6A2C;
   L_021F6A2C: ; // 0x21f6a2c
@@ -20149,22 +20149,22 @@ void Gambit_fn_021F6A00(CPUState* cpu) {
         /* 021F6A98 */ cpu->r[10] = rbrew_read32(cpu->mem, _t26);
         /* 021F6A9C */ cpu->r[8] = cpu->r[10] - cpu->r[0];
   L_021F6AA0: ; // 0x21f6aa0
-        /* 021F6AA0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021F6AA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021F6AA4 */ _t27 = cpu->r[3] + 0x00000010u;
         /* 021F6AA4 */ rbrew_write32(cpu->mem, _t27, cpu->r[8]);
-        /* 021F6AA8 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6AA8 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6AA8 */ _t29 = _t28 & 0x00000001u;
         /* 021F6AA8 */ if (_t29) goto L_021F6AC0; else goto L_021F6AAC;
   L_021F6AAC: ; // 0x21f6aac
         /* 021F6AAC */ _t30 = cpu->r[8] + 0x0000001Cu;
         /* 021F6AAC */ cpu->r[12] = rbrew_read32(cpu->mem, _t30);
-        /* 021F6AB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000002u);
-        /* 021F6AB4 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6AB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000002u));
+        /* 021F6AB4 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6AB4 */ _t32 = _t31 & 0x00000001u;
         /* 021F6AB4 */ if (_t32) goto L_021F6AC0; else goto L_021F6AB8;
   L_021F6AB8: ; // 0x21f6ab8
-        /* 021F6AB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000003u);
-        /* 021F6ABC */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6AB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000003u));
+        /* 021F6ABC */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6ABC */ _t34 = _t33 & 0x00000001u;
         /* 021F6ABC */ if (_t34) goto L_021F6AC0; else goto L_021F6A90;
   L_021F6AC0: ; // 0x21f6ac0
@@ -20188,17 +20188,17 @@ void Gambit_fn_021F6A04(CPUState* cpu) {
         /* 021F6A08 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021F6A08 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021F6A0C */ cpu->r[31] = cpu->r[4];
-        /* 021F6A10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021F6A10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021F6A14 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021F6A14 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021F6A18 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6A18 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6A18 */ _t4 = _t3 & 0x00000001u;
         /* 021F6A18 */ if (_t4) goto L_021F6A1C; else goto L_021F6A2C;
   L_021F6A1C: ; // 0x21f6a1c
         /* 021F6A1C */ cpu->r[3] = 0x00000018u;
         /* 021F6A20 */ Gambit_fn_02801A78(cpu);
-        /* 021F6A24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F6A28 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6A24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F6A28 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6A28 */ _t6 = _t5 & 0x00000001u;
         /* 021F6A28 */ if (_t6) goto L_021F6AC0; else goto L_021F6A2C;
   L_021F6A2C: ; // 0x21f6a2c
@@ -20253,22 +20253,22 @@ void Gambit_fn_021F6A04(CPUState* cpu) {
         /* 021F6A98 */ cpu->r[10] = rbrew_read32(cpu->mem, _t26);
         /* 021F6A9C */ cpu->r[8] = cpu->r[10] - cpu->r[0];
   L_021F6AA0: ; // 0x21f6aa0
-        /* 021F6AA0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021F6AA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021F6AA4 */ _t27 = cpu->r[3] + 0x00000010u;
         /* 021F6AA4 */ rbrew_write32(cpu->mem, _t27, cpu->r[8]);
-        /* 021F6AA8 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6AA8 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6AA8 */ _t29 = _t28 & 0x00000001u;
         /* 021F6AA8 */ if (_t29) goto L_021F6AC0; else goto L_021F6AAC;
   L_021F6AAC: ; // 0x21f6aac
         /* 021F6AAC */ _t30 = cpu->r[8] + 0x0000001Cu;
         /* 021F6AAC */ cpu->r[12] = rbrew_read32(cpu->mem, _t30);
-        /* 021F6AB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000002u);
-        /* 021F6AB4 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6AB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000002u));
+        /* 021F6AB4 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6AB4 */ _t32 = _t31 & 0x00000001u;
         /* 021F6AB4 */ if (_t32) goto L_021F6AC0; else goto L_021F6AB8;
   L_021F6AB8: ; // 0x21f6ab8
-        /* 021F6AB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000003u);
-        /* 021F6ABC */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6AB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000003u));
+        /* 021F6ABC */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6ABC */ _t34 = _t33 & 0x00000001u;
         /* 021F6ABC */ if (_t34) goto L_021F6AC0; else goto L_021F6A90;
   L_021F6AC0: ; // 0x21f6ac0
@@ -20293,17 +20293,17 @@ void Gambit_fn_021F6AD4(CPUState* cpu) {
         /* 021F6ADC */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021F6ADC */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021F6AE0 */ cpu->r[31] = cpu->r[4];
-        /* 021F6AE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021F6AE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021F6AE8 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021F6AE8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021F6AEC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6AEC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6AEC */ _t4 = _t3 & 0x00000001u;
         /* 021F6AEC */ if (_t4) goto L_021F6AF0; else goto L_021F6B00;
   L_021F6AF0: ; // 0x21f6af0
         /* 021F6AF0 */ cpu->r[3] = 0x00000018u;
         /* 021F6AF4 */ Gambit_fn_02801A78(cpu);
-        /* 021F6AF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F6AFC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6AF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F6AFC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6AFC */ _t6 = _t5 & 0x00000001u;
         /* 021F6AFC */ if (_t6) goto L_021F6B94; else goto L_021F6B00;
   L_021F6B00: ; // 0x21f6b00
@@ -20358,22 +20358,22 @@ void Gambit_fn_021F6AD4(CPUState* cpu) {
         /* 021F6B6C */ cpu->r[10] = rbrew_read32(cpu->mem, _t26);
         /* 021F6B70 */ cpu->r[8] = cpu->r[10] - cpu->r[0];
   L_021F6B74: ; // 0x21f6b74
-        /* 021F6B74 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021F6B74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021F6B78 */ _t27 = cpu->r[3] + 0x00000010u;
         /* 021F6B78 */ rbrew_write32(cpu->mem, _t27, cpu->r[8]);
-        /* 021F6B7C */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6B7C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6B7C */ _t29 = _t28 & 0x00000001u;
         /* 021F6B7C */ if (_t29) goto L_021F6B94; else goto L_021F6B80;
   L_021F6B80: ; // 0x21f6b80
         /* 021F6B80 */ _t30 = cpu->r[8] + 0x0000001Cu;
         /* 021F6B80 */ cpu->r[12] = rbrew_read32(cpu->mem, _t30);
-        /* 021F6B84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000002u);
-        /* 021F6B88 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6B84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000002u));
+        /* 021F6B88 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6B88 */ _t32 = _t31 & 0x00000001u;
         /* 021F6B88 */ if (_t32) goto L_021F6B94; else goto L_021F6B8C;
   L_021F6B8C: ; // 0x21f6b8c
-        /* 021F6B8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000003u);
-        /* 021F6B90 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6B8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000003u));
+        /* 021F6B90 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6B90 */ _t34 = _t33 & 0x00000001u;
         /* 021F6B90 */ if (_t34) goto L_021F6B94; else goto L_021F6B64;
   L_021F6B94: ; // 0x21f6b94
@@ -20397,17 +20397,17 @@ void Gambit_fn_021F6AD8(CPUState* cpu) {
         /* 021F6ADC */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021F6ADC */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021F6AE0 */ cpu->r[31] = cpu->r[4];
-        /* 021F6AE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021F6AE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021F6AE8 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021F6AE8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021F6AEC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6AEC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6AEC */ _t4 = _t3 & 0x00000001u;
         /* 021F6AEC */ if (_t4) goto L_021F6AF0; else goto L_021F6B00;
   L_021F6AF0: ; // 0x21f6af0
         /* 021F6AF0 */ cpu->r[3] = 0x00000018u;
         /* 021F6AF4 */ Gambit_fn_02801A78(cpu);
-        /* 021F6AF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F6AFC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6AF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F6AFC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6AFC */ _t6 = _t5 & 0x00000001u;
         /* 021F6AFC */ if (_t6) goto L_021F6B94; else goto L_021F6B00;
   L_021F6B00: ; // 0x21f6b00
@@ -20462,22 +20462,22 @@ void Gambit_fn_021F6AD8(CPUState* cpu) {
         /* 021F6B6C */ cpu->r[10] = rbrew_read32(cpu->mem, _t26);
         /* 021F6B70 */ cpu->r[8] = cpu->r[10] - cpu->r[0];
   L_021F6B74: ; // 0x21f6b74
-        /* 021F6B74 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021F6B74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021F6B78 */ _t27 = cpu->r[3] + 0x00000010u;
         /* 021F6B78 */ rbrew_write32(cpu->mem, _t27, cpu->r[8]);
-        /* 021F6B7C */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6B7C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6B7C */ _t29 = _t28 & 0x00000001u;
         /* 021F6B7C */ if (_t29) goto L_021F6B94; else goto L_021F6B80;
   L_021F6B80: ; // 0x21f6b80
         /* 021F6B80 */ _t30 = cpu->r[8] + 0x0000001Cu;
         /* 021F6B80 */ cpu->r[12] = rbrew_read32(cpu->mem, _t30);
-        /* 021F6B84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000002u);
-        /* 021F6B88 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6B84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000002u));
+        /* 021F6B88 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6B88 */ _t32 = _t31 & 0x00000001u;
         /* 021F6B88 */ if (_t32) goto L_021F6B94; else goto L_021F6B8C;
   L_021F6B8C: ; // 0x21f6b8c
-        /* 021F6B8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000003u);
-        /* 021F6B90 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6B8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000003u));
+        /* 021F6B90 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6B90 */ _t34 = _t33 & 0x00000001u;
         /* 021F6B90 */ if (_t34) goto L_021F6B94; else goto L_021F6B64;
   L_021F6B94: ; // 0x21f6b94
@@ -20502,17 +20502,17 @@ void Gambit_fn_021F6BA8(CPUState* cpu) {
         /* 021F6BB0 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021F6BB0 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021F6BB4 */ cpu->r[31] = cpu->r[4];
-        /* 021F6BB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021F6BB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021F6BBC */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021F6BBC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021F6BC0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6BC0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6BC0 */ _t4 = _t3 & 0x00000001u;
         /* 021F6BC0 */ if (_t4) goto L_021F6BC4; else goto L_021F6BD4;
   L_021F6BC4: ; // 0x21f6bc4
         /* 021F6BC4 */ cpu->r[3] = 0x00000018u;
         /* 021F6BC8 */ Gambit_fn_02801A78(cpu);
-        /* 021F6BCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F6BD0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6BCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F6BD0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6BD0 */ _t6 = _t5 & 0x00000001u;
         /* 021F6BD0 */ if (_t6) goto L_021F6C68; else goto L_021F6BD4;
   L_021F6BD4: ; // 0x21f6bd4
@@ -20567,22 +20567,22 @@ void Gambit_fn_021F6BA8(CPUState* cpu) {
         /* 021F6C40 */ cpu->r[10] = rbrew_read32(cpu->mem, _t26);
         /* 021F6C44 */ cpu->r[8] = cpu->r[10] - cpu->r[0];
   L_021F6C48: ; // 0x21f6c48
-        /* 021F6C48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021F6C48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021F6C4C */ _t27 = cpu->r[3] + 0x00000010u;
         /* 021F6C4C */ rbrew_write32(cpu->mem, _t27, cpu->r[8]);
-        /* 021F6C50 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6C50 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6C50 */ _t29 = _t28 & 0x00000001u;
         /* 021F6C50 */ if (_t29) goto L_021F6C68; else goto L_021F6C54;
   L_021F6C54: ; // 0x21f6c54
         /* 021F6C54 */ _t30 = cpu->r[8] + 0x0000001Cu;
         /* 021F6C54 */ cpu->r[12] = rbrew_read32(cpu->mem, _t30);
-        /* 021F6C58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000002u);
-        /* 021F6C5C */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6C58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000002u));
+        /* 021F6C5C */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6C5C */ _t32 = _t31 & 0x00000001u;
         /* 021F6C5C */ if (_t32) goto L_021F6C68; else goto L_021F6C60;
   L_021F6C60: ; // 0x21f6c60
-        /* 021F6C60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000003u);
-        /* 021F6C64 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6C60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000003u));
+        /* 021F6C64 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6C64 */ _t34 = _t33 & 0x00000001u;
         /* 021F6C64 */ if (_t34) goto L_021F6C68; else goto L_021F6C38;
   L_021F6C68: ; // 0x21f6c68
@@ -20606,17 +20606,17 @@ void Gambit_fn_021F6BAC(CPUState* cpu) {
         /* 021F6BB0 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021F6BB0 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021F6BB4 */ cpu->r[31] = cpu->r[4];
-        /* 021F6BB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021F6BB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021F6BBC */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021F6BBC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021F6BC0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6BC0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6BC0 */ _t4 = _t3 & 0x00000001u;
         /* 021F6BC0 */ if (_t4) goto L_021F6BC4; else goto L_021F6BD4;
   L_021F6BC4: ; // 0x21f6bc4
         /* 021F6BC4 */ cpu->r[3] = 0x00000018u;
         /* 021F6BC8 */ Gambit_fn_02801A78(cpu);
-        /* 021F6BCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F6BD0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6BCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F6BD0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6BD0 */ _t6 = _t5 & 0x00000001u;
         /* 021F6BD0 */ if (_t6) goto L_021F6C68; else goto L_021F6BD4;
   L_021F6BD4: ; // 0x21f6bd4
@@ -20671,22 +20671,22 @@ void Gambit_fn_021F6BAC(CPUState* cpu) {
         /* 021F6C40 */ cpu->r[10] = rbrew_read32(cpu->mem, _t26);
         /* 021F6C44 */ cpu->r[8] = cpu->r[10] - cpu->r[0];
   L_021F6C48: ; // 0x21f6c48
-        /* 021F6C48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021F6C48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021F6C4C */ _t27 = cpu->r[3] + 0x00000010u;
         /* 021F6C4C */ rbrew_write32(cpu->mem, _t27, cpu->r[8]);
-        /* 021F6C50 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6C50 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6C50 */ _t29 = _t28 & 0x00000001u;
         /* 021F6C50 */ if (_t29) goto L_021F6C68; else goto L_021F6C54;
   L_021F6C54: ; // 0x21f6c54
         /* 021F6C54 */ _t30 = cpu->r[8] + 0x0000001Cu;
         /* 021F6C54 */ cpu->r[12] = rbrew_read32(cpu->mem, _t30);
-        /* 021F6C58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000002u);
-        /* 021F6C5C */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6C58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000002u));
+        /* 021F6C5C */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6C5C */ _t32 = _t31 & 0x00000001u;
         /* 021F6C5C */ if (_t32) goto L_021F6C68; else goto L_021F6C60;
   L_021F6C60: ; // 0x21f6c60
-        /* 021F6C60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000003u);
-        /* 021F6C64 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6C60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000003u));
+        /* 021F6C64 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6C64 */ _t34 = _t33 & 0x00000001u;
         /* 021F6C64 */ if (_t34) goto L_021F6C68; else goto L_021F6C38;
   L_021F6C68: ; // 0x21f6c68
@@ -20711,17 +20711,17 @@ void Gambit_fn_021F6C7C(CPUState* cpu) {
         /* 021F6C84 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021F6C84 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021F6C88 */ cpu->r[31] = cpu->r[4];
-        /* 021F6C8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021F6C8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021F6C90 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021F6C90 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021F6C94 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6C94 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6C94 */ _t4 = _t3 & 0x00000001u;
         /* 021F6C94 */ if (_t4) goto L_021F6C98; else goto L_021F6CA8;
   L_021F6C98: ; // 0x21f6c98
         /* 021F6C98 */ cpu->r[3] = 0x00000018u;
         /* 021F6C9C */ Gambit_fn_02801A78(cpu);
-        /* 021F6CA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F6CA4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6CA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F6CA4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6CA4 */ _t6 = _t5 & 0x00000001u;
         /* 021F6CA4 */ if (_t6) goto L_021F6D3C; else goto L_021F6CA8;
   L_021F6CA8: ; // 0x21f6ca8
@@ -20776,22 +20776,22 @@ void Gambit_fn_021F6C7C(CPUState* cpu) {
         /* 021F6D14 */ cpu->r[10] = rbrew_read32(cpu->mem, _t26);
         /* 021F6D18 */ cpu->r[8] = cpu->r[10] - cpu->r[0];
   L_021F6D1C: ; // 0x21f6d1c
-        /* 021F6D1C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021F6D1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021F6D20 */ _t27 = cpu->r[3] + 0x00000010u;
         /* 021F6D20 */ rbrew_write32(cpu->mem, _t27, cpu->r[8]);
-        /* 021F6D24 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6D24 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6D24 */ _t29 = _t28 & 0x00000001u;
         /* 021F6D24 */ if (_t29) goto L_021F6D3C; else goto L_021F6D28;
   L_021F6D28: ; // 0x21f6d28
         /* 021F6D28 */ _t30 = cpu->r[8] + 0x0000001Cu;
         /* 021F6D28 */ cpu->r[12] = rbrew_read32(cpu->mem, _t30);
-        /* 021F6D2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000002u);
-        /* 021F6D30 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6D2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000002u));
+        /* 021F6D30 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6D30 */ _t32 = _t31 & 0x00000001u;
         /* 021F6D30 */ if (_t32) goto L_021F6D3C; else goto L_021F6D34;
   L_021F6D34: ; // 0x21f6d34
-        /* 021F6D34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000003u);
-        /* 021F6D38 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6D34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000003u));
+        /* 021F6D38 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6D38 */ _t34 = _t33 & 0x00000001u;
         /* 021F6D38 */ if (_t34) goto L_021F6D3C; else goto L_021F6D0C;
   L_021F6D3C: ; // 0x21f6d3c
@@ -20815,17 +20815,17 @@ void Gambit_fn_021F6C80(CPUState* cpu) {
         /* 021F6C84 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021F6C84 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021F6C88 */ cpu->r[31] = cpu->r[4];
-        /* 021F6C8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021F6C8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021F6C90 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021F6C90 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021F6C94 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6C94 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6C94 */ _t4 = _t3 & 0x00000001u;
         /* 021F6C94 */ if (_t4) goto L_021F6C98; else goto L_021F6CA8;
   L_021F6C98: ; // 0x21f6c98
         /* 021F6C98 */ cpu->r[3] = 0x00000018u;
         /* 021F6C9C */ Gambit_fn_02801A78(cpu);
-        /* 021F6CA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F6CA4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6CA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F6CA4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6CA4 */ _t6 = _t5 & 0x00000001u;
         /* 021F6CA4 */ if (_t6) goto L_021F6D3C; else goto L_021F6CA8;
   L_021F6CA8: ; // 0x21f6ca8
@@ -20880,22 +20880,22 @@ void Gambit_fn_021F6C80(CPUState* cpu) {
         /* 021F6D14 */ cpu->r[10] = rbrew_read32(cpu->mem, _t26);
         /* 021F6D18 */ cpu->r[8] = cpu->r[10] - cpu->r[0];
   L_021F6D1C: ; // 0x21f6d1c
-        /* 021F6D1C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021F6D1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021F6D20 */ _t27 = cpu->r[3] + 0x00000010u;
         /* 021F6D20 */ rbrew_write32(cpu->mem, _t27, cpu->r[8]);
-        /* 021F6D24 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6D24 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6D24 */ _t29 = _t28 & 0x00000001u;
         /* 021F6D24 */ if (_t29) goto L_021F6D3C; else goto L_021F6D28;
   L_021F6D28: ; // 0x21f6d28
         /* 021F6D28 */ _t30 = cpu->r[8] + 0x0000001Cu;
         /* 021F6D28 */ cpu->r[12] = rbrew_read32(cpu->mem, _t30);
-        /* 021F6D2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000002u);
-        /* 021F6D30 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6D2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000002u));
+        /* 021F6D30 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6D30 */ _t32 = _t31 & 0x00000001u;
         /* 021F6D30 */ if (_t32) goto L_021F6D3C; else goto L_021F6D34;
   L_021F6D34: ; // 0x21f6d34
-        /* 021F6D34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000003u);
-        /* 021F6D38 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6D34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000003u));
+        /* 021F6D38 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6D38 */ _t34 = _t33 & 0x00000001u;
         /* 021F6D38 */ if (_t34) goto L_021F6D3C; else goto L_021F6D0C;
   L_021F6D3C: ; // 0x21f6d3c
@@ -20920,17 +20920,17 @@ void Gambit_fn_021F6D50(CPUState* cpu) {
         /* 021F6D58 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021F6D58 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021F6D5C */ cpu->r[31] = cpu->r[4];
-        /* 021F6D60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021F6D60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021F6D64 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021F6D64 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021F6D68 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6D68 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6D68 */ _t4 = _t3 & 0x00000001u;
         /* 021F6D68 */ if (_t4) goto L_021F6D6C; else goto L_021F6D7C;
   L_021F6D6C: ; // 0x21f6d6c
         /* 021F6D6C */ cpu->r[3] = 0x00000018u;
         /* 021F6D70 */ Gambit_fn_02801A78(cpu);
-        /* 021F6D74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F6D78 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6D74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F6D78 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6D78 */ _t6 = _t5 & 0x00000001u;
         /* 021F6D78 */ if (_t6) goto L_021F6E10; else goto L_021F6D7C;
   L_021F6D7C: ; // 0x21f6d7c
@@ -20985,22 +20985,22 @@ void Gambit_fn_021F6D50(CPUState* cpu) {
         /* 021F6DE8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t26);
         /* 021F6DEC */ cpu->r[8] = cpu->r[10] - cpu->r[0];
   L_021F6DF0: ; // 0x21f6df0
-        /* 021F6DF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021F6DF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021F6DF4 */ _t27 = cpu->r[3] + 0x00000010u;
         /* 021F6DF4 */ rbrew_write32(cpu->mem, _t27, cpu->r[8]);
-        /* 021F6DF8 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6DF8 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6DF8 */ _t29 = _t28 & 0x00000001u;
         /* 021F6DF8 */ if (_t29) goto L_021F6E10; else goto L_021F6DFC;
   L_021F6DFC: ; // 0x21f6dfc
         /* 021F6DFC */ _t30 = cpu->r[8] + 0x0000001Cu;
         /* 021F6DFC */ cpu->r[12] = rbrew_read32(cpu->mem, _t30);
-        /* 021F6E00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000002u);
-        /* 021F6E04 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6E00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000002u));
+        /* 021F6E04 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6E04 */ _t32 = _t31 & 0x00000001u;
         /* 021F6E04 */ if (_t32) goto L_021F6E10; else goto L_021F6E08;
   L_021F6E08: ; // 0x21f6e08
-        /* 021F6E08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000003u);
-        /* 021F6E0C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6E08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000003u));
+        /* 021F6E0C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6E0C */ _t34 = _t33 & 0x00000001u;
         /* 021F6E0C */ if (_t34) goto L_021F6E10; else goto L_021F6DE0;
   L_021F6E10: ; // 0x21f6e10
@@ -21024,17 +21024,17 @@ void Gambit_fn_021F6D54(CPUState* cpu) {
         /* 021F6D58 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021F6D58 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021F6D5C */ cpu->r[31] = cpu->r[4];
-        /* 021F6D60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021F6D60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021F6D64 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021F6D64 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021F6D68 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6D68 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6D68 */ _t4 = _t3 & 0x00000001u;
         /* 021F6D68 */ if (_t4) goto L_021F6D6C; else goto L_021F6D7C;
   L_021F6D6C: ; // 0x21f6d6c
         /* 021F6D6C */ cpu->r[3] = 0x00000018u;
         /* 021F6D70 */ Gambit_fn_02801A78(cpu);
-        /* 021F6D74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F6D78 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6D74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F6D78 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6D78 */ _t6 = _t5 & 0x00000001u;
         /* 021F6D78 */ if (_t6) goto L_021F6E10; else goto L_021F6D7C;
   L_021F6D7C: ; // 0x21f6d7c
@@ -21089,22 +21089,22 @@ void Gambit_fn_021F6D54(CPUState* cpu) {
         /* 021F6DE8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t26);
         /* 021F6DEC */ cpu->r[8] = cpu->r[10] - cpu->r[0];
   L_021F6DF0: ; // 0x21f6df0
-        /* 021F6DF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021F6DF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021F6DF4 */ _t27 = cpu->r[3] + 0x00000010u;
         /* 021F6DF4 */ rbrew_write32(cpu->mem, _t27, cpu->r[8]);
-        /* 021F6DF8 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6DF8 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6DF8 */ _t29 = _t28 & 0x00000001u;
         /* 021F6DF8 */ if (_t29) goto L_021F6E10; else goto L_021F6DFC;
   L_021F6DFC: ; // 0x21f6dfc
         /* 021F6DFC */ _t30 = cpu->r[8] + 0x0000001Cu;
         /* 021F6DFC */ cpu->r[12] = rbrew_read32(cpu->mem, _t30);
-        /* 021F6E00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000002u);
-        /* 021F6E04 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6E00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000002u));
+        /* 021F6E04 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6E04 */ _t32 = _t31 & 0x00000001u;
         /* 021F6E04 */ if (_t32) goto L_021F6E10; else goto L_021F6E08;
   L_021F6E08: ; // 0x21f6e08
-        /* 021F6E08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000003u);
-        /* 021F6E0C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6E08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000003u));
+        /* 021F6E0C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6E0C */ _t34 = _t33 & 0x00000001u;
         /* 021F6E0C */ if (_t34) goto L_021F6E10; else goto L_021F6DE0;
   L_021F6E10: ; // 0x21f6e10
@@ -21129,17 +21129,17 @@ void Gambit_fn_021F6E24(CPUState* cpu) {
         /* 021F6E2C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021F6E2C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021F6E30 */ cpu->r[31] = cpu->r[4];
-        /* 021F6E34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021F6E34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021F6E38 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021F6E38 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021F6E3C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6E3C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6E3C */ _t4 = _t3 & 0x00000001u;
         /* 021F6E3C */ if (_t4) goto L_021F6E40; else goto L_021F6E50;
   L_021F6E40: ; // 0x21f6e40
         /* 021F6E40 */ cpu->r[3] = 0x00000018u;
         /* 021F6E44 */ Gambit_fn_02801A78(cpu);
-        /* 021F6E48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F6E4C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6E48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F6E4C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6E4C */ _t6 = _t5 & 0x00000001u;
         /* 021F6E4C */ if (_t6) goto L_021F6EE4; else goto L_021F6E50;
   L_021F6E50: ; // 0x21f6e50
@@ -21194,22 +21194,22 @@ void Gambit_fn_021F6E24(CPUState* cpu) {
         /* 021F6EBC */ cpu->r[10] = rbrew_read32(cpu->mem, _t26);
         /* 021F6EC0 */ cpu->r[8] = cpu->r[10] - cpu->r[0];
   L_021F6EC4: ; // 0x21f6ec4
-        /* 021F6EC4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021F6EC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021F6EC8 */ _t27 = cpu->r[3] + 0x00000010u;
         /* 021F6EC8 */ rbrew_write32(cpu->mem, _t27, cpu->r[8]);
-        /* 021F6ECC */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6ECC */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6ECC */ _t29 = _t28 & 0x00000001u;
         /* 021F6ECC */ if (_t29) goto L_021F6EE4; else goto L_021F6ED0;
   L_021F6ED0: ; // 0x21f6ed0
         /* 021F6ED0 */ _t30 = cpu->r[8] + 0x0000001Cu;
         /* 021F6ED0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t30);
-        /* 021F6ED4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000002u);
-        /* 021F6ED8 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6ED4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000002u));
+        /* 021F6ED8 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6ED8 */ _t32 = _t31 & 0x00000001u;
         /* 021F6ED8 */ if (_t32) goto L_021F6EE4; else goto L_021F6EDC;
   L_021F6EDC: ; // 0x21f6edc
-        /* 021F6EDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000003u);
-        /* 021F6EE0 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6EDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000003u));
+        /* 021F6EE0 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6EE0 */ _t34 = _t33 & 0x00000001u;
         /* 021F6EE0 */ if (_t34) goto L_021F6EE4; else goto L_021F6EB4;
   L_021F6EE4: ; // 0x21f6ee4
@@ -21233,17 +21233,17 @@ void Gambit_fn_021F6E28(CPUState* cpu) {
         /* 021F6E2C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021F6E2C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021F6E30 */ cpu->r[31] = cpu->r[4];
-        /* 021F6E34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021F6E34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021F6E38 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021F6E38 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021F6E3C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6E3C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6E3C */ _t4 = _t3 & 0x00000001u;
         /* 021F6E3C */ if (_t4) goto L_021F6E40; else goto L_021F6E50;
   L_021F6E40: ; // 0x21f6e40
         /* 021F6E40 */ cpu->r[3] = 0x00000018u;
         /* 021F6E44 */ Gambit_fn_02801A78(cpu);
-        /* 021F6E48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F6E4C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6E48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F6E4C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6E4C */ _t6 = _t5 & 0x00000001u;
         /* 021F6E4C */ if (_t6) goto L_021F6EE4; else goto L_021F6E50;
   L_021F6E50: ; // 0x21f6e50
@@ -21298,22 +21298,22 @@ void Gambit_fn_021F6E28(CPUState* cpu) {
         /* 021F6EBC */ cpu->r[10] = rbrew_read32(cpu->mem, _t26);
         /* 021F6EC0 */ cpu->r[8] = cpu->r[10] - cpu->r[0];
   L_021F6EC4: ; // 0x21f6ec4
-        /* 021F6EC4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021F6EC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021F6EC8 */ _t27 = cpu->r[3] + 0x00000010u;
         /* 021F6EC8 */ rbrew_write32(cpu->mem, _t27, cpu->r[8]);
-        /* 021F6ECC */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6ECC */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6ECC */ _t29 = _t28 & 0x00000001u;
         /* 021F6ECC */ if (_t29) goto L_021F6EE4; else goto L_021F6ED0;
   L_021F6ED0: ; // 0x21f6ed0
         /* 021F6ED0 */ _t30 = cpu->r[8] + 0x0000001Cu;
         /* 021F6ED0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t30);
-        /* 021F6ED4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000002u);
-        /* 021F6ED8 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6ED4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000002u));
+        /* 021F6ED8 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6ED8 */ _t32 = _t31 & 0x00000001u;
         /* 021F6ED8 */ if (_t32) goto L_021F6EE4; else goto L_021F6EDC;
   L_021F6EDC: ; // 0x21f6edc
-        /* 021F6EDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000003u);
-        /* 021F6EE0 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6EDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000003u));
+        /* 021F6EE0 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6EE0 */ _t34 = _t33 & 0x00000001u;
         /* 021F6EE0 */ if (_t34) goto L_021F6EE4; else goto L_021F6EB4;
   L_021F6EE4: ; // 0x21f6ee4
@@ -21334,14 +21334,14 @@ void Gambit_fn_021F6F04(CPUState* cpu) {
         /* 021F6F04 */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 021F6F04 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 021F6F04 */ cpu->r[1] = _t0;
-        /* 021F6F08 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6F08 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6F08 */ _t2 = _t1 & 0x00000001u;
         /* 021F6F08 */ if (_t2) goto L_021F6F0C; else goto L_021F6F1C;
   L_021F6F0C: ; // 0x21f6f0c
         /* 021F6F0C */ cpu->r[3] = 0x00000020u;
         /* 021F6F10 */ Gambit_fn_02801A78(cpu);
-        /* 021F6F14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F6F18 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F6F14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F6F18 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F6F18 */ _t4 = _t3 & 0x00000001u;
         /* 021F6F18 */ if (_t4) goto L_021F6F68; else goto L_021F6F1C;
   L_021F6F1C: ; // 0x21f6f1c
@@ -21927,8 +21927,8 @@ void Gambit_fn_021F71A4(CPUState* cpu) {
         /* 021F71A4 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 021F71A4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021F71A8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 021F71A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021F71AC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F71A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021F71AC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F71AC */ _t2 = _t1 & 0x00000001u;
         /* 021F71AC */ if (_t2) goto L_021F71BC; else goto L_021F71B0;
   L_021F71B0: ; // 0x21f71b0
@@ -21957,8 +21957,8 @@ void Gambit_fn_021F71C8(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -22072,9 +22072,9 @@ void Gambit_fn_021F7228(CPUState* cpu) {
         /* 021F722C */ _t0 = cpu->r[7] + 0xFFFFFD5Cu;
         /* 021F722C */ cpu->r[7] = rbrew_read32(cpu->mem, _t0);
         /* 021F7230 */ cpu->r[8] = 0x101D0000u;
-        /* 021F7234 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021F7234 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021F7238 */ cpu->r[8] = cpu->r[8] + 0xFFFFFD58u;
-        /* 021F723C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F723C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F723C */ _t2 = _t1 & 0x00000001u;
         /* 021F723C */ if (_t2) goto L_021F7240; else goto L_021F7258;
   L_021F7240: ; // 0x21f7240
@@ -22087,8 +22087,8 @@ void Gambit_fn_021F7228(CPUState* cpu) {
         /* 021F7254 */ _t4 = cpu->r[8] + 0x00000000u;
         /* 021F7254 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_021F7258: ; // 0x21f7258
-        /* 021F7258 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F725C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7258 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F725C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F725C */ _t6 = _t5 & 0x00000001u;
         /* 021F725C */ if (_t6) goto L_021F7260; else goto L_021F7268;
   L_021F7260: ; // 0x21f7260
@@ -22099,9 +22099,9 @@ void Gambit_fn_021F7228(CPUState* cpu) {
         /* 021F726C */ _t7 = cpu->r[8] + 0xFFFFFD54u;
         /* 021F726C */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 021F7270 */ cpu->r[11] = 0x101D0000u;
-        /* 021F7274 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021F7274 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021F7278 */ cpu->r[11] = cpu->r[11] + 0xFFFFFD50u;
-        /* 021F727C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F727C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F727C */ _t9 = _t8 & 0x00000001u;
         /* 021F727C */ if (_t9) goto L_021F7280; else goto L_021F7298;
   L_021F7280: ; // 0x21f7280
@@ -22114,8 +22114,8 @@ void Gambit_fn_021F7228(CPUState* cpu) {
         /* 021F7294 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021F7294 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021F7298: ; // 0x21f7298
-        /* 021F7298 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021F729C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7298 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021F729C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F729C */ _t13 = _t12 & 0x00000001u;
         /* 021F729C */ if (_t13) goto L_021F72A0; else goto L_021F72A8;
   L_021F72A0: ; // 0x21f72a0
@@ -22126,9 +22126,9 @@ void Gambit_fn_021F7228(CPUState* cpu) {
         /* 021F72AC */ _t14 = cpu->r[9] + 0xFFFFDA0Cu;
         /* 021F72AC */ cpu->r[9] = rbrew_read32(cpu->mem, _t14);
         /* 021F72B0 */ cpu->r[8] = 0x101D0000u;
-        /* 021F72B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F72B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F72B8 */ cpu->r[8] = cpu->r[8] + 0xFFFFFC00u;
-        /* 021F72BC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F72BC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F72BC */ _t16 = _t15 & 0x00000001u;
         /* 021F72BC */ if (_t16) goto L_021F72C0; else goto L_021F72D8;
   L_021F72C0: ; // 0x21f72c0
@@ -22141,8 +22141,8 @@ void Gambit_fn_021F7228(CPUState* cpu) {
         /* 021F72D4 */ _t18 = cpu->r[8] + 0x00000000u;
         /* 021F72D4 */ rbrew_write32(cpu->mem, _t18, cpu->r[10]);
   L_021F72D8: ; // 0x21f72d8
-        /* 021F72D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F72DC */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F72D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F72DC */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F72DC */ _t20 = _t19 & 0x00000001u;
         /* 021F72DC */ if (_t20) goto L_021F72E0; else goto L_021F72E8;
   L_021F72E0: ; // 0x21f72e0
@@ -22153,9 +22153,9 @@ void Gambit_fn_021F7228(CPUState* cpu) {
         /* 021F72EC */ _t21 = cpu->r[11] + 0xFFFFDA00u;
         /* 021F72EC */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021F72F0 */ cpu->r[8] = 0x101D0000u;
-        /* 021F72F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021F72F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021F72F8 */ cpu->r[8] = cpu->r[8] + 0xFFFFFBFCu;
-        /* 021F72FC */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F72FC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F72FC */ _t23 = _t22 & 0x00000001u;
         /* 021F72FC */ if (_t23) goto L_021F7300; else goto L_021F7318;
   L_021F7300: ; // 0x21f7300
@@ -22168,8 +22168,8 @@ void Gambit_fn_021F7228(CPUState* cpu) {
         /* 021F7314 */ _t25 = cpu->r[8] + 0x00000000u;
         /* 021F7314 */ rbrew_write32(cpu->mem, _t25, cpu->r[9]);
   L_021F7318: ; // 0x21f7318
-        /* 021F7318 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F731C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F731C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F731C */ _t27 = _t26 & 0x00000001u;
         /* 021F731C */ if (_t27) goto L_021F7320; else goto L_021F7328;
   L_021F7320: ; // 0x21f7320
@@ -22180,9 +22180,9 @@ void Gambit_fn_021F7228(CPUState* cpu) {
         /* 021F732C */ _t28 = cpu->r[10] + 0xFFFFD9ECu;
         /* 021F732C */ cpu->r[10] = rbrew_read32(cpu->mem, _t28);
         /* 021F7330 */ cpu->r[11] = 0x101D0000u;
-        /* 021F7334 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021F7334 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021F7338 */ cpu->r[11] = cpu->r[11] + 0xFFFFFB4Cu;
-        /* 021F733C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F733C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F733C */ _t30 = _t29 & 0x00000001u;
         /* 021F733C */ if (_t30) goto L_021F7340; else goto L_021F7358;
   L_021F7340: ; // 0x21f7340
@@ -22195,8 +22195,8 @@ void Gambit_fn_021F7228(CPUState* cpu) {
         /* 021F7354 */ _t32 = cpu->r[11] + 0x00000000u;
         /* 021F7354 */ rbrew_write32(cpu->mem, _t32, cpu->r[7]);
   L_021F7358: ; // 0x21f7358
-        /* 021F7358 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021F735C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7358 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021F735C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F735C */ _t34 = _t33 & 0x00000001u;
         /* 021F735C */ if (_t34) goto L_021F7360; else goto L_021F7368;
   L_021F7360: ; // 0x21f7360
@@ -22208,9 +22208,9 @@ void Gambit_fn_021F7228(CPUState* cpu) {
         /* 021F736C */ cpu->r[0] = rbrew_read32(cpu->mem, _t35);
         /* 021F736C */ cpu->r[11] = _t35;
         /* 021F7370 */ cpu->r[10] = 0x101D0000u;
-        /* 021F7374 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021F7374 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021F7378 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021F737C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F737C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F737C */ _t37 = _t36 & 0x00000001u;
         /* 021F737C */ if (_t37) goto L_021F7380; else goto L_021F7394;
   L_021F7380: ; // 0x21f7380
@@ -22222,8 +22222,8 @@ void Gambit_fn_021F7228(CPUState* cpu) {
         /* 021F7390 */ _t39 = cpu->r[10] + 0x00000000u;
         /* 021F7390 */ rbrew_write32(cpu->mem, _t39, cpu->r[0]);
   L_021F7394: ; // 0x21f7394
-        /* 021F7394 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021F7398 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7394 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021F7398 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7398 */ _t41 = _t40 & 0x00000001u;
         /* 021F7398 */ if (_t41) goto L_021F739C; else goto L_021F73A4;
   L_021F739C: ; // 0x21f739c
@@ -22235,9 +22235,9 @@ void Gambit_fn_021F7228(CPUState* cpu) {
         /* 021F73A8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t42);
         /* 021F73A8 */ cpu->r[10] = _t42;
         /* 021F73AC */ cpu->r[11] = 0x101D0000u;
-        /* 021F73B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F73B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F73B4 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021F73B8 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F73B8 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F73B8 */ _t44 = _t43 & 0x00000001u;
         /* 021F73B8 */ if (_t44) goto L_021F73BC; else goto L_021F73D0;
   L_021F73BC: ; // 0x21f73bc
@@ -22290,9 +22290,9 @@ void Gambit_fn_021F7400(CPUState* cpu) {
         /* 021F7404 */ _t0 = cpu->r[7] + 0xFFFFFC44u;
         /* 021F7404 */ cpu->r[7] = rbrew_read32(cpu->mem, _t0);
         /* 021F7408 */ cpu->r[8] = 0x101D0000u;
-        /* 021F740C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021F740C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021F7410 */ cpu->r[8] = cpu->r[8] + 0xFFFFFD80u;
-        /* 021F7414 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7414 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7414 */ _t2 = _t1 & 0x00000001u;
         /* 021F7414 */ if (_t2) goto L_021F7418; else goto L_021F7430;
   L_021F7418: ; // 0x21f7418
@@ -22305,8 +22305,8 @@ void Gambit_fn_021F7400(CPUState* cpu) {
         /* 021F742C */ _t4 = cpu->r[8] + 0x00000000u;
         /* 021F742C */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_021F7430: ; // 0x21f7430
-        /* 021F7430 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F7434 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7430 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F7434 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7434 */ _t6 = _t5 & 0x00000001u;
         /* 021F7434 */ if (_t6) goto L_021F7438; else goto L_021F7440;
   L_021F7438: ; // 0x21f7438
@@ -22317,9 +22317,9 @@ void Gambit_fn_021F7400(CPUState* cpu) {
         /* 021F7444 */ _t7 = cpu->r[8] + 0xFFFFFC40u;
         /* 021F7444 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 021F7448 */ cpu->r[11] = 0x101D0000u;
-        /* 021F744C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021F744C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021F7450 */ cpu->r[11] = cpu->r[11] + 0xFFFFFD7Cu;
-        /* 021F7454 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7454 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7454 */ _t9 = _t8 & 0x00000001u;
         /* 021F7454 */ if (_t9) goto L_021F7458; else goto L_021F7470;
   L_021F7458: ; // 0x21f7458
@@ -22332,8 +22332,8 @@ void Gambit_fn_021F7400(CPUState* cpu) {
         /* 021F746C */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021F746C */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021F7470: ; // 0x21f7470
-        /* 021F7470 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021F7474 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7470 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021F7474 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7474 */ _t13 = _t12 & 0x00000001u;
         /* 021F7474 */ if (_t13) goto L_021F7478; else goto L_021F7480;
   L_021F7478: ; // 0x21f7478
@@ -22344,9 +22344,9 @@ void Gambit_fn_021F7400(CPUState* cpu) {
         /* 021F7484 */ _t14 = cpu->r[9] + 0xFFFFDA0Cu;
         /* 021F7484 */ cpu->r[9] = rbrew_read32(cpu->mem, _t14);
         /* 021F7488 */ cpu->r[8] = 0x101D0000u;
-        /* 021F748C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F748C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F7490 */ cpu->r[8] = cpu->r[8] + 0xFFFFFC00u;
-        /* 021F7494 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7494 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7494 */ _t16 = _t15 & 0x00000001u;
         /* 021F7494 */ if (_t16) goto L_021F7498; else goto L_021F74B0;
   L_021F7498: ; // 0x21f7498
@@ -22359,8 +22359,8 @@ void Gambit_fn_021F7400(CPUState* cpu) {
         /* 021F74AC */ _t18 = cpu->r[8] + 0x00000000u;
         /* 021F74AC */ rbrew_write32(cpu->mem, _t18, cpu->r[10]);
   L_021F74B0: ; // 0x21f74b0
-        /* 021F74B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F74B4 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F74B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F74B4 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F74B4 */ _t20 = _t19 & 0x00000001u;
         /* 021F74B4 */ if (_t20) goto L_021F74B8; else goto L_021F74C0;
   L_021F74B8: ; // 0x21f74b8
@@ -22371,9 +22371,9 @@ void Gambit_fn_021F7400(CPUState* cpu) {
         /* 021F74C4 */ _t21 = cpu->r[11] + 0xFFFFDA00u;
         /* 021F74C4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021F74C8 */ cpu->r[8] = 0x101D0000u;
-        /* 021F74CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021F74CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021F74D0 */ cpu->r[8] = cpu->r[8] + 0xFFFFFBFCu;
-        /* 021F74D4 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F74D4 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F74D4 */ _t23 = _t22 & 0x00000001u;
         /* 021F74D4 */ if (_t23) goto L_021F74D8; else goto L_021F74F0;
   L_021F74D8: ; // 0x21f74d8
@@ -22386,8 +22386,8 @@ void Gambit_fn_021F7400(CPUState* cpu) {
         /* 021F74EC */ _t25 = cpu->r[8] + 0x00000000u;
         /* 021F74EC */ rbrew_write32(cpu->mem, _t25, cpu->r[9]);
   L_021F74F0: ; // 0x21f74f0
-        /* 021F74F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F74F4 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F74F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F74F4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F74F4 */ _t27 = _t26 & 0x00000001u;
         /* 021F74F4 */ if (_t27) goto L_021F74F8; else goto L_021F7500;
   L_021F74F8: ; // 0x21f74f8
@@ -22398,9 +22398,9 @@ void Gambit_fn_021F7400(CPUState* cpu) {
         /* 021F7504 */ _t28 = cpu->r[10] + 0xFFFFD9ECu;
         /* 021F7504 */ cpu->r[10] = rbrew_read32(cpu->mem, _t28);
         /* 021F7508 */ cpu->r[11] = 0x101D0000u;
-        /* 021F750C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021F750C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021F7510 */ cpu->r[11] = cpu->r[11] + 0xFFFFFB4Cu;
-        /* 021F7514 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7514 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7514 */ _t30 = _t29 & 0x00000001u;
         /* 021F7514 */ if (_t30) goto L_021F7518; else goto L_021F7530;
   L_021F7518: ; // 0x21f7518
@@ -22413,8 +22413,8 @@ void Gambit_fn_021F7400(CPUState* cpu) {
         /* 021F752C */ _t32 = cpu->r[11] + 0x00000000u;
         /* 021F752C */ rbrew_write32(cpu->mem, _t32, cpu->r[7]);
   L_021F7530: ; // 0x21f7530
-        /* 021F7530 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021F7534 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7530 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021F7534 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7534 */ _t34 = _t33 & 0x00000001u;
         /* 021F7534 */ if (_t34) goto L_021F7538; else goto L_021F7540;
   L_021F7538: ; // 0x21f7538
@@ -22426,9 +22426,9 @@ void Gambit_fn_021F7400(CPUState* cpu) {
         /* 021F7544 */ cpu->r[0] = rbrew_read32(cpu->mem, _t35);
         /* 021F7544 */ cpu->r[11] = _t35;
         /* 021F7548 */ cpu->r[10] = 0x101D0000u;
-        /* 021F754C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021F754C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021F7550 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021F7554 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7554 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7554 */ _t37 = _t36 & 0x00000001u;
         /* 021F7554 */ if (_t37) goto L_021F7558; else goto L_021F756C;
   L_021F7558: ; // 0x21f7558
@@ -22440,8 +22440,8 @@ void Gambit_fn_021F7400(CPUState* cpu) {
         /* 021F7568 */ _t39 = cpu->r[10] + 0x00000000u;
         /* 021F7568 */ rbrew_write32(cpu->mem, _t39, cpu->r[0]);
   L_021F756C: ; // 0x21f756c
-        /* 021F756C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021F7570 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F756C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021F7570 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7570 */ _t41 = _t40 & 0x00000001u;
         /* 021F7570 */ if (_t41) goto L_021F7574; else goto L_021F757C;
   L_021F7574: ; // 0x21f7574
@@ -22453,9 +22453,9 @@ void Gambit_fn_021F7400(CPUState* cpu) {
         /* 021F7580 */ cpu->r[9] = rbrew_read32(cpu->mem, _t42);
         /* 021F7580 */ cpu->r[10] = _t42;
         /* 021F7584 */ cpu->r[11] = 0x101D0000u;
-        /* 021F7588 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F7588 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F758C */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021F7590 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7590 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7590 */ _t44 = _t43 & 0x00000001u;
         /* 021F7590 */ if (_t44) goto L_021F7594; else goto L_021F75A8;
   L_021F7594: ; // 0x21f7594
@@ -22516,9 +22516,9 @@ void Gambit_fn_021F75EC(CPUState* cpu) {
         /* 021F75F0 */ _t0 = cpu->r[7] + 0xFFFFFC50u;
         /* 021F75F0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t0);
         /* 021F75F4 */ cpu->r[8] = 0x101D0000u;
-        /* 021F75F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021F75F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021F75FC */ cpu->r[8] = cpu->r[8] + 0xFFFFFD94u;
-        /* 021F7600 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7600 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7600 */ _t2 = _t1 & 0x00000001u;
         /* 021F7600 */ if (_t2) goto L_021F7604; else goto L_021F761C;
   L_021F7604: ; // 0x21f7604
@@ -22531,8 +22531,8 @@ void Gambit_fn_021F75EC(CPUState* cpu) {
         /* 021F7618 */ _t4 = cpu->r[8] + 0x00000000u;
         /* 021F7618 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_021F761C: ; // 0x21f761c
-        /* 021F761C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F7620 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F761C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F7620 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7620 */ _t6 = _t5 & 0x00000001u;
         /* 021F7620 */ if (_t6) goto L_021F7624; else goto L_021F762C;
   L_021F7624: ; // 0x21f7624
@@ -22543,9 +22543,9 @@ void Gambit_fn_021F75EC(CPUState* cpu) {
         /* 021F7630 */ _t7 = cpu->r[8] + 0xFFFFFC4Cu;
         /* 021F7630 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 021F7634 */ cpu->r[11] = 0x101D0000u;
-        /* 021F7638 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021F7638 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021F763C */ cpu->r[11] = cpu->r[11] + 0xFFFFFD90u;
-        /* 021F7640 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7640 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7640 */ _t9 = _t8 & 0x00000001u;
         /* 021F7640 */ if (_t9) goto L_021F7644; else goto L_021F765C;
   L_021F7644: ; // 0x21f7644
@@ -22558,8 +22558,8 @@ void Gambit_fn_021F75EC(CPUState* cpu) {
         /* 021F7658 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021F7658 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021F765C: ; // 0x21f765c
-        /* 021F765C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021F7660 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F765C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021F7660 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7660 */ _t13 = _t12 & 0x00000001u;
         /* 021F7660 */ if (_t13) goto L_021F7664; else goto L_021F766C;
   L_021F7664: ; // 0x21f7664
@@ -22570,9 +22570,9 @@ void Gambit_fn_021F75EC(CPUState* cpu) {
         /* 021F7670 */ _t14 = cpu->r[9] + 0xFFFFDA0Cu;
         /* 021F7670 */ cpu->r[9] = rbrew_read32(cpu->mem, _t14);
         /* 021F7674 */ cpu->r[8] = 0x101D0000u;
-        /* 021F7678 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F7678 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F767C */ cpu->r[8] = cpu->r[8] + 0xFFFFFC00u;
-        /* 021F7680 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7680 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7680 */ _t16 = _t15 & 0x00000001u;
         /* 021F7680 */ if (_t16) goto L_021F7684; else goto L_021F769C;
   L_021F7684: ; // 0x21f7684
@@ -22585,8 +22585,8 @@ void Gambit_fn_021F75EC(CPUState* cpu) {
         /* 021F7698 */ _t18 = cpu->r[8] + 0x00000000u;
         /* 021F7698 */ rbrew_write32(cpu->mem, _t18, cpu->r[10]);
   L_021F769C: ; // 0x21f769c
-        /* 021F769C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F76A0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F769C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F76A0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F76A0 */ _t20 = _t19 & 0x00000001u;
         /* 021F76A0 */ if (_t20) goto L_021F76A4; else goto L_021F76AC;
   L_021F76A4: ; // 0x21f76a4
@@ -22597,9 +22597,9 @@ void Gambit_fn_021F75EC(CPUState* cpu) {
         /* 021F76B0 */ _t21 = cpu->r[11] + 0xFFFFDA00u;
         /* 021F76B0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021F76B4 */ cpu->r[8] = 0x101D0000u;
-        /* 021F76B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021F76B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021F76BC */ cpu->r[8] = cpu->r[8] + 0xFFFFFBFCu;
-        /* 021F76C0 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F76C0 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F76C0 */ _t23 = _t22 & 0x00000001u;
         /* 021F76C0 */ if (_t23) goto L_021F76C4; else goto L_021F76DC;
   L_021F76C4: ; // 0x21f76c4
@@ -22612,8 +22612,8 @@ void Gambit_fn_021F75EC(CPUState* cpu) {
         /* 021F76D8 */ _t25 = cpu->r[8] + 0x00000000u;
         /* 021F76D8 */ rbrew_write32(cpu->mem, _t25, cpu->r[9]);
   L_021F76DC: ; // 0x21f76dc
-        /* 021F76DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F76E0 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F76DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F76E0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F76E0 */ _t27 = _t26 & 0x00000001u;
         /* 021F76E0 */ if (_t27) goto L_021F76E4; else goto L_021F76EC;
   L_021F76E4: ; // 0x21f76e4
@@ -22624,9 +22624,9 @@ void Gambit_fn_021F75EC(CPUState* cpu) {
         /* 021F76F0 */ _t28 = cpu->r[10] + 0xFFFFD9ECu;
         /* 021F76F0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t28);
         /* 021F76F4 */ cpu->r[11] = 0x101D0000u;
-        /* 021F76F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021F76F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021F76FC */ cpu->r[11] = cpu->r[11] + 0xFFFFFB4Cu;
-        /* 021F7700 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7700 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7700 */ _t30 = _t29 & 0x00000001u;
         /* 021F7700 */ if (_t30) goto L_021F7704; else goto L_021F771C;
   L_021F7704: ; // 0x21f7704
@@ -22639,8 +22639,8 @@ void Gambit_fn_021F75EC(CPUState* cpu) {
         /* 021F7718 */ _t32 = cpu->r[11] + 0x00000000u;
         /* 021F7718 */ rbrew_write32(cpu->mem, _t32, cpu->r[7]);
   L_021F771C: ; // 0x21f771c
-        /* 021F771C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021F7720 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F771C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021F7720 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7720 */ _t34 = _t33 & 0x00000001u;
         /* 021F7720 */ if (_t34) goto L_021F7724; else goto L_021F772C;
   L_021F7724: ; // 0x21f7724
@@ -22652,9 +22652,9 @@ void Gambit_fn_021F75EC(CPUState* cpu) {
         /* 021F7730 */ cpu->r[0] = rbrew_read32(cpu->mem, _t35);
         /* 021F7730 */ cpu->r[11] = _t35;
         /* 021F7734 */ cpu->r[10] = 0x101D0000u;
-        /* 021F7738 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021F7738 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021F773C */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021F7740 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7740 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7740 */ _t37 = _t36 & 0x00000001u;
         /* 021F7740 */ if (_t37) goto L_021F7744; else goto L_021F7758;
   L_021F7744: ; // 0x21f7744
@@ -22666,8 +22666,8 @@ void Gambit_fn_021F75EC(CPUState* cpu) {
         /* 021F7754 */ _t39 = cpu->r[10] + 0x00000000u;
         /* 021F7754 */ rbrew_write32(cpu->mem, _t39, cpu->r[0]);
   L_021F7758: ; // 0x21f7758
-        /* 021F7758 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021F775C */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7758 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021F775C */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F775C */ _t41 = _t40 & 0x00000001u;
         /* 021F775C */ if (_t41) goto L_021F7760; else goto L_021F7768;
   L_021F7760: ; // 0x21f7760
@@ -22679,9 +22679,9 @@ void Gambit_fn_021F75EC(CPUState* cpu) {
         /* 021F776C */ cpu->r[9] = rbrew_read32(cpu->mem, _t42);
         /* 021F776C */ cpu->r[10] = _t42;
         /* 021F7770 */ cpu->r[11] = 0x101D0000u;
-        /* 021F7774 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F7774 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F7778 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021F777C */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F777C */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F777C */ _t44 = _t43 & 0x00000001u;
         /* 021F777C */ if (_t44) goto L_021F7780; else goto L_021F7794;
   L_021F7780: ; // 0x21f7780
@@ -22816,13 +22816,13 @@ void Gambit_fn_021F7818(CPUState* cpu) {
         /* 021F7828 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F782C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021F782C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021F7830 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021F7834 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7830 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021F7834 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7834 */ _t5 = _t4 & 0x00000001u;
         /* 021F7834 */ if (_t5) goto L_021F7840; else goto L_021F7838;
   L_021F7838: ; // 0x21f7838
-        /* 021F7838 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021F783C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7838 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021F783C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F783C */ _t7 = _t6 & 0x00000001u;
         /* 021F783C */ if (_t7) goto L_021F7840; else goto L_021F7878;
   L_021F7840: ; // 0x21f7840
@@ -22833,8 +22833,8 @@ void Gambit_fn_021F7818(CPUState* cpu) {
         /* 021F7848 */ cpu->ctr = cpu->r[0];
         /* 021F784C */ cpu->r[3] = cpu->r[31];
         /* 021F7850 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021F7854 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F7858 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7854 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F7858 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7858 */ _t11 = _t10 & 0x00000001u;
         /* 021F7858 */ if (_t11) goto L_021F785C; else goto L_021F7878;
   L_021F785C: ; // 0x21f785c
@@ -22872,13 +22872,13 @@ void Gambit_fn_021F781C(CPUState* cpu) {
         /* 021F7828 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021F782C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021F782C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 021F7830 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021F7834 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7830 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021F7834 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7834 */ _t5 = _t4 & 0x00000001u;
         /* 021F7834 */ if (_t5) goto L_021F7840; else goto L_021F7838;
   L_021F7838: ; // 0x21f7838
-        /* 021F7838 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021F783C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7838 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021F783C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F783C */ _t7 = _t6 & 0x00000001u;
         /* 021F783C */ if (_t7) goto L_021F7840; else goto L_021F7878;
   L_021F7840: ; // 0x21f7840
@@ -22889,8 +22889,8 @@ void Gambit_fn_021F781C(CPUState* cpu) {
         /* 021F7848 */ cpu->ctr = cpu->r[0];
         /* 021F784C */ cpu->r[3] = cpu->r[31];
         /* 021F7850 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021F7854 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021F7858 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7854 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021F7858 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7858 */ _t11 = _t10 & 0x00000001u;
         /* 021F7858 */ if (_t11) goto L_021F785C; else goto L_021F7878;
   L_021F785C: ; // 0x21f785c
@@ -22979,9 +22979,9 @@ void Gambit_fn_021F78CC(CPUState* cpu) {
         /* 021F78D0 */ _t0 = cpu->r[8] + 0xFFFFFB74u;
         /* 021F78D0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 021F78D4 */ cpu->r[6] = 0x101D0000u;
-        /* 021F78D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021F78D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021F78DC */ cpu->r[6] = cpu->r[6] + 0xFFFFFDC0u;
-        /* 021F78E0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F78E0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F78E0 */ _t2 = _t1 & 0x00000001u;
         /* 021F78E0 */ if (_t2) goto L_021F78E4; else goto L_021F78FC;
   L_021F78E4: ; // 0x21f78e4
@@ -22994,8 +22994,8 @@ void Gambit_fn_021F78CC(CPUState* cpu) {
         /* 021F78F8 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 021F78F8 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_021F78FC: ; // 0x21f78fc
-        /* 021F78FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 021F7900 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F78FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 021F7900 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7900 */ _t6 = _t5 & 0x00000001u;
         /* 021F7900 */ if (_t6) goto L_021F7904; else goto L_021F790C;
   L_021F7904: ; // 0x21f7904
@@ -23006,9 +23006,9 @@ void Gambit_fn_021F78CC(CPUState* cpu) {
         /* 021F7910 */ _t7 = cpu->r[10] + 0xFFFFFB70u;
         /* 021F7910 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 021F7914 */ cpu->r[8] = 0x101D0000u;
-        /* 021F7918 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021F7918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021F791C */ cpu->r[8] = cpu->r[8] + 0xFFFFFBDCu;
-        /* 021F7920 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7920 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7920 */ _t9 = _t8 & 0x00000001u;
         /* 021F7920 */ if (_t9) goto L_021F7924; else goto L_021F793C;
   L_021F7924: ; // 0x21f7924
@@ -23021,8 +23021,8 @@ void Gambit_fn_021F78CC(CPUState* cpu) {
         /* 021F7938 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 021F7938 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_021F793C: ; // 0x21f793c
-        /* 021F793C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F7940 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F793C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F7940 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7940 */ _t13 = _t12 & 0x00000001u;
         /* 021F7940 */ if (_t13) goto L_021F7944; else goto L_021F794C;
   L_021F7944: ; // 0x21f7944
@@ -23033,9 +23033,9 @@ void Gambit_fn_021F78CC(CPUState* cpu) {
         /* 021F7950 */ _t14 = cpu->r[12] + 0xFFFFE5E4u;
         /* 021F7950 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 021F7954 */ cpu->r[10] = 0x101D0000u;
-        /* 021F7958 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021F7958 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021F795C */ cpu->r[10] = cpu->r[10] + 0xFFFFFB60u;
-        /* 021F7960 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7960 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7960 */ _t16 = _t15 & 0x00000001u;
         /* 021F7960 */ if (_t16) goto L_021F7964; else goto L_021F797C;
   L_021F7964: ; // 0x21f7964
@@ -23048,8 +23048,8 @@ void Gambit_fn_021F78CC(CPUState* cpu) {
         /* 021F7978 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 021F7978 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_021F797C: ; // 0x21f797c
-        /* 021F797C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021F7980 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F797C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021F7980 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7980 */ _t20 = _t19 & 0x00000001u;
         /* 021F7980 */ if (_t20) goto L_021F7984; else goto L_021F798C;
   L_021F7984: ; // 0x21f7984
@@ -23060,9 +23060,9 @@ void Gambit_fn_021F78CC(CPUState* cpu) {
         /* 021F7990 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021F7990 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021F7994 */ cpu->r[12] = 0x101D0000u;
-        /* 021F7998 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021F7998 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021F799C */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021F79A0 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F79A0 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F79A0 */ _t23 = _t22 & 0x00000001u;
         /* 021F79A0 */ if (_t23) goto L_021F79A4; else goto L_021F79BC;
   L_021F79A4: ; // 0x21f79a4
@@ -23075,8 +23075,8 @@ void Gambit_fn_021F78CC(CPUState* cpu) {
         /* 021F79B8 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 021F79B8 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_021F79BC: ; // 0x21f79bc
-        /* 021F79BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021F79C0 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F79BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021F79C0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F79C0 */ _t27 = _t26 & 0x00000001u;
         /* 021F79C0 */ if (_t27) goto L_021F79C4; else goto L_021F79CC;
   L_021F79C4: ; // 0x21f79c4
@@ -23088,9 +23088,9 @@ void Gambit_fn_021F78CC(CPUState* cpu) {
         /* 021F79D0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 021F79D0 */ cpu->r[10] = _t28;
         /* 021F79D4 */ cpu->r[7] = 0x101D0000u;
-        /* 021F79D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021F79D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021F79DC */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 021F79E0 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F79E0 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F79E0 */ _t30 = _t29 & 0x00000001u;
         /* 021F79E0 */ if (_t30) goto L_021F79E4; else goto L_021F79F8;
   L_021F79E4: ; // 0x21f79e4
@@ -23102,8 +23102,8 @@ void Gambit_fn_021F78CC(CPUState* cpu) {
         /* 021F79F4 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 021F79F4 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_021F79F8: ; // 0x21f79f8
-        /* 021F79F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 021F79FC */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F79F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 021F79FC */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F79FC */ _t34 = _t33 & 0x00000001u;
         /* 021F79FC */ if (_t34) goto L_021F7A00; else goto L_021F7A08;
   L_021F7A00: ; // 0x21f7a00
@@ -23115,9 +23115,9 @@ void Gambit_fn_021F78CC(CPUState* cpu) {
         /* 021F7A0C */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 021F7A0C */ cpu->r[8] = _t35;
         /* 021F7A10 */ cpu->r[6] = 0x101D0000u;
-        /* 021F7A14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021F7A14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021F7A18 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 021F7A1C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7A1C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7A1C */ _t37 = _t36 & 0x00000001u;
         /* 021F7A1C */ if (_t37) goto L_021F7A20; else goto L_021F7A34;
   L_021F7A20: ; // 0x21f7a20
@@ -23163,9 +23163,9 @@ void Gambit_fn_021F7A60(CPUState* cpu) {
         /* 021F7A64 */ _t0 = cpu->r[8] + 0xFFFFFB78u;
         /* 021F7A64 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 021F7A68 */ cpu->r[6] = 0x101D0000u;
-        /* 021F7A6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021F7A6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021F7A70 */ cpu->r[6] = cpu->r[6] + 0xFFFFFDC4u;
-        /* 021F7A74 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7A74 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7A74 */ _t2 = _t1 & 0x00000001u;
         /* 021F7A74 */ if (_t2) goto L_021F7A78; else goto L_021F7A90;
   L_021F7A78: ; // 0x21f7a78
@@ -23178,8 +23178,8 @@ void Gambit_fn_021F7A60(CPUState* cpu) {
         /* 021F7A8C */ _t4 = cpu->r[6] + 0x00000000u;
         /* 021F7A8C */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_021F7A90: ; // 0x21f7a90
-        /* 021F7A90 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 021F7A94 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7A90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 021F7A94 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7A94 */ _t6 = _t5 & 0x00000001u;
         /* 021F7A94 */ if (_t6) goto L_021F7A98; else goto L_021F7AA0;
   L_021F7A98: ; // 0x21f7a98
@@ -23190,9 +23190,9 @@ void Gambit_fn_021F7A60(CPUState* cpu) {
         /* 021F7AA4 */ _t7 = cpu->r[10] + 0xFFFFFB70u;
         /* 021F7AA4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 021F7AA8 */ cpu->r[8] = 0x101D0000u;
-        /* 021F7AAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021F7AAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021F7AB0 */ cpu->r[8] = cpu->r[8] + 0xFFFFFBDCu;
-        /* 021F7AB4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7AB4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7AB4 */ _t9 = _t8 & 0x00000001u;
         /* 021F7AB4 */ if (_t9) goto L_021F7AB8; else goto L_021F7AD0;
   L_021F7AB8: ; // 0x21f7ab8
@@ -23205,8 +23205,8 @@ void Gambit_fn_021F7A60(CPUState* cpu) {
         /* 021F7ACC */ _t11 = cpu->r[8] + 0x00000000u;
         /* 021F7ACC */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_021F7AD0: ; // 0x21f7ad0
-        /* 021F7AD0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F7AD4 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7AD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F7AD4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7AD4 */ _t13 = _t12 & 0x00000001u;
         /* 021F7AD4 */ if (_t13) goto L_021F7AD8; else goto L_021F7AE0;
   L_021F7AD8: ; // 0x21f7ad8
@@ -23217,9 +23217,9 @@ void Gambit_fn_021F7A60(CPUState* cpu) {
         /* 021F7AE4 */ _t14 = cpu->r[12] + 0xFFFFE5E4u;
         /* 021F7AE4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 021F7AE8 */ cpu->r[10] = 0x101D0000u;
-        /* 021F7AEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021F7AEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021F7AF0 */ cpu->r[10] = cpu->r[10] + 0xFFFFFB60u;
-        /* 021F7AF4 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7AF4 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7AF4 */ _t16 = _t15 & 0x00000001u;
         /* 021F7AF4 */ if (_t16) goto L_021F7AF8; else goto L_021F7B10;
   L_021F7AF8: ; // 0x21f7af8
@@ -23232,8 +23232,8 @@ void Gambit_fn_021F7A60(CPUState* cpu) {
         /* 021F7B0C */ _t18 = cpu->r[10] + 0x00000000u;
         /* 021F7B0C */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_021F7B10: ; // 0x21f7b10
-        /* 021F7B10 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021F7B14 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7B10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021F7B14 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7B14 */ _t20 = _t19 & 0x00000001u;
         /* 021F7B14 */ if (_t20) goto L_021F7B18; else goto L_021F7B20;
   L_021F7B18: ; // 0x21f7b18
@@ -23244,9 +23244,9 @@ void Gambit_fn_021F7A60(CPUState* cpu) {
         /* 021F7B24 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021F7B24 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021F7B28 */ cpu->r[12] = 0x101D0000u;
-        /* 021F7B2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021F7B2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021F7B30 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021F7B34 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7B34 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7B34 */ _t23 = _t22 & 0x00000001u;
         /* 021F7B34 */ if (_t23) goto L_021F7B38; else goto L_021F7B50;
   L_021F7B38: ; // 0x21f7b38
@@ -23259,8 +23259,8 @@ void Gambit_fn_021F7A60(CPUState* cpu) {
         /* 021F7B4C */ _t25 = cpu->r[12] + 0x00000000u;
         /* 021F7B4C */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_021F7B50: ; // 0x21f7b50
-        /* 021F7B50 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021F7B54 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7B50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021F7B54 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7B54 */ _t27 = _t26 & 0x00000001u;
         /* 021F7B54 */ if (_t27) goto L_021F7B58; else goto L_021F7B60;
   L_021F7B58: ; // 0x21f7b58
@@ -23272,9 +23272,9 @@ void Gambit_fn_021F7A60(CPUState* cpu) {
         /* 021F7B64 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 021F7B64 */ cpu->r[10] = _t28;
         /* 021F7B68 */ cpu->r[7] = 0x101D0000u;
-        /* 021F7B6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021F7B6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021F7B70 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 021F7B74 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7B74 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7B74 */ _t30 = _t29 & 0x00000001u;
         /* 021F7B74 */ if (_t30) goto L_021F7B78; else goto L_021F7B8C;
   L_021F7B78: ; // 0x21f7b78
@@ -23286,8 +23286,8 @@ void Gambit_fn_021F7A60(CPUState* cpu) {
         /* 021F7B88 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 021F7B88 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_021F7B8C: ; // 0x21f7b8c
-        /* 021F7B8C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 021F7B90 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7B8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 021F7B90 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7B90 */ _t34 = _t33 & 0x00000001u;
         /* 021F7B90 */ if (_t34) goto L_021F7B94; else goto L_021F7B9C;
   L_021F7B94: ; // 0x21f7b94
@@ -23299,9 +23299,9 @@ void Gambit_fn_021F7A60(CPUState* cpu) {
         /* 021F7BA0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 021F7BA0 */ cpu->r[8] = _t35;
         /* 021F7BA4 */ cpu->r[6] = 0x101D0000u;
-        /* 021F7BA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021F7BA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021F7BAC */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 021F7BB0 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7BB0 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7BB0 */ _t37 = _t36 & 0x00000001u;
         /* 021F7BB0 */ if (_t37) goto L_021F7BB4; else goto L_021F7BC8;
   L_021F7BB4: ; // 0x21f7bb4
@@ -23347,9 +23347,9 @@ void Gambit_fn_021F7BF4(CPUState* cpu) {
         /* 021F7BF8 */ _t0 = cpu->r[8] + 0xFFFFFB7Cu;
         /* 021F7BF8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 021F7BFC */ cpu->r[6] = 0x101D0000u;
-        /* 021F7C00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021F7C00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021F7C04 */ cpu->r[6] = cpu->r[6] + 0xFFFFFDC8u;
-        /* 021F7C08 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7C08 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7C08 */ _t2 = _t1 & 0x00000001u;
         /* 021F7C08 */ if (_t2) goto L_021F7C0C; else goto L_021F7C24;
   L_021F7C0C: ; // 0x21f7c0c
@@ -23362,8 +23362,8 @@ void Gambit_fn_021F7BF4(CPUState* cpu) {
         /* 021F7C20 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 021F7C20 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_021F7C24: ; // 0x21f7c24
-        /* 021F7C24 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 021F7C28 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7C24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 021F7C28 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7C28 */ _t6 = _t5 & 0x00000001u;
         /* 021F7C28 */ if (_t6) goto L_021F7C2C; else goto L_021F7C34;
   L_021F7C2C: ; // 0x21f7c2c
@@ -23374,9 +23374,9 @@ void Gambit_fn_021F7BF4(CPUState* cpu) {
         /* 021F7C38 */ _t7 = cpu->r[10] + 0xFFFFFB70u;
         /* 021F7C38 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 021F7C3C */ cpu->r[8] = 0x101D0000u;
-        /* 021F7C40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021F7C40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021F7C44 */ cpu->r[8] = cpu->r[8] + 0xFFFFFBDCu;
-        /* 021F7C48 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7C48 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7C48 */ _t9 = _t8 & 0x00000001u;
         /* 021F7C48 */ if (_t9) goto L_021F7C4C; else goto L_021F7C64;
   L_021F7C4C: ; // 0x21f7c4c
@@ -23389,8 +23389,8 @@ void Gambit_fn_021F7BF4(CPUState* cpu) {
         /* 021F7C60 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 021F7C60 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_021F7C64: ; // 0x21f7c64
-        /* 021F7C64 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F7C68 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7C64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F7C68 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7C68 */ _t13 = _t12 & 0x00000001u;
         /* 021F7C68 */ if (_t13) goto L_021F7C6C; else goto L_021F7C74;
   L_021F7C6C: ; // 0x21f7c6c
@@ -23401,9 +23401,9 @@ void Gambit_fn_021F7BF4(CPUState* cpu) {
         /* 021F7C78 */ _t14 = cpu->r[12] + 0xFFFFE5E4u;
         /* 021F7C78 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 021F7C7C */ cpu->r[10] = 0x101D0000u;
-        /* 021F7C80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021F7C80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021F7C84 */ cpu->r[10] = cpu->r[10] + 0xFFFFFB60u;
-        /* 021F7C88 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7C88 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7C88 */ _t16 = _t15 & 0x00000001u;
         /* 021F7C88 */ if (_t16) goto L_021F7C8C; else goto L_021F7CA4;
   L_021F7C8C: ; // 0x21f7c8c
@@ -23416,8 +23416,8 @@ void Gambit_fn_021F7BF4(CPUState* cpu) {
         /* 021F7CA0 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 021F7CA0 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_021F7CA4: ; // 0x21f7ca4
-        /* 021F7CA4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021F7CA8 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7CA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021F7CA8 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7CA8 */ _t20 = _t19 & 0x00000001u;
         /* 021F7CA8 */ if (_t20) goto L_021F7CAC; else goto L_021F7CB4;
   L_021F7CAC: ; // 0x21f7cac
@@ -23428,9 +23428,9 @@ void Gambit_fn_021F7BF4(CPUState* cpu) {
         /* 021F7CB8 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021F7CB8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021F7CBC */ cpu->r[12] = 0x101D0000u;
-        /* 021F7CC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021F7CC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021F7CC4 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021F7CC8 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7CC8 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7CC8 */ _t23 = _t22 & 0x00000001u;
         /* 021F7CC8 */ if (_t23) goto L_021F7CCC; else goto L_021F7CE4;
   L_021F7CCC: ; // 0x21f7ccc
@@ -23443,8 +23443,8 @@ void Gambit_fn_021F7BF4(CPUState* cpu) {
         /* 021F7CE0 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 021F7CE0 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_021F7CE4: ; // 0x21f7ce4
-        /* 021F7CE4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021F7CE8 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7CE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021F7CE8 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7CE8 */ _t27 = _t26 & 0x00000001u;
         /* 021F7CE8 */ if (_t27) goto L_021F7CEC; else goto L_021F7CF4;
   L_021F7CEC: ; // 0x21f7cec
@@ -23456,9 +23456,9 @@ void Gambit_fn_021F7BF4(CPUState* cpu) {
         /* 021F7CF8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 021F7CF8 */ cpu->r[10] = _t28;
         /* 021F7CFC */ cpu->r[7] = 0x101D0000u;
-        /* 021F7D00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021F7D00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021F7D04 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 021F7D08 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7D08 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7D08 */ _t30 = _t29 & 0x00000001u;
         /* 021F7D08 */ if (_t30) goto L_021F7D0C; else goto L_021F7D20;
   L_021F7D0C: ; // 0x21f7d0c
@@ -23470,8 +23470,8 @@ void Gambit_fn_021F7BF4(CPUState* cpu) {
         /* 021F7D1C */ _t32 = cpu->r[7] + 0x00000000u;
         /* 021F7D1C */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_021F7D20: ; // 0x21f7d20
-        /* 021F7D20 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 021F7D24 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7D20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 021F7D24 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7D24 */ _t34 = _t33 & 0x00000001u;
         /* 021F7D24 */ if (_t34) goto L_021F7D28; else goto L_021F7D30;
   L_021F7D28: ; // 0x21f7d28
@@ -23483,9 +23483,9 @@ void Gambit_fn_021F7BF4(CPUState* cpu) {
         /* 021F7D34 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 021F7D34 */ cpu->r[8] = _t35;
         /* 021F7D38 */ cpu->r[6] = 0x101D0000u;
-        /* 021F7D3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021F7D3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021F7D40 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 021F7D44 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7D44 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7D44 */ _t37 = _t36 & 0x00000001u;
         /* 021F7D44 */ if (_t37) goto L_021F7D48; else goto L_021F7D5C;
   L_021F7D48: ; // 0x21f7d48
@@ -23531,9 +23531,9 @@ void Gambit_fn_021F7D88(CPUState* cpu) {
         /* 021F7D8C */ _t0 = cpu->r[8] + 0xFFFFFB80u;
         /* 021F7D8C */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 021F7D90 */ cpu->r[6] = 0x101D0000u;
-        /* 021F7D94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021F7D94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021F7D98 */ cpu->r[6] = cpu->r[6] + 0xFFFFFDCCu;
-        /* 021F7D9C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7D9C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7D9C */ _t2 = _t1 & 0x00000001u;
         /* 021F7D9C */ if (_t2) goto L_021F7DA0; else goto L_021F7DB8;
   L_021F7DA0: ; // 0x21f7da0
@@ -23546,8 +23546,8 @@ void Gambit_fn_021F7D88(CPUState* cpu) {
         /* 021F7DB4 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 021F7DB4 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_021F7DB8: ; // 0x21f7db8
-        /* 021F7DB8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 021F7DBC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7DB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 021F7DBC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7DBC */ _t6 = _t5 & 0x00000001u;
         /* 021F7DBC */ if (_t6) goto L_021F7DC0; else goto L_021F7DC8;
   L_021F7DC0: ; // 0x21f7dc0
@@ -23558,9 +23558,9 @@ void Gambit_fn_021F7D88(CPUState* cpu) {
         /* 021F7DCC */ _t7 = cpu->r[10] + 0xFFFFFB70u;
         /* 021F7DCC */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 021F7DD0 */ cpu->r[8] = 0x101D0000u;
-        /* 021F7DD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021F7DD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021F7DD8 */ cpu->r[8] = cpu->r[8] + 0xFFFFFBDCu;
-        /* 021F7DDC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7DDC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7DDC */ _t9 = _t8 & 0x00000001u;
         /* 021F7DDC */ if (_t9) goto L_021F7DE0; else goto L_021F7DF8;
   L_021F7DE0: ; // 0x21f7de0
@@ -23573,8 +23573,8 @@ void Gambit_fn_021F7D88(CPUState* cpu) {
         /* 021F7DF4 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 021F7DF4 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_021F7DF8: ; // 0x21f7df8
-        /* 021F7DF8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F7DFC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7DF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F7DFC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7DFC */ _t13 = _t12 & 0x00000001u;
         /* 021F7DFC */ if (_t13) goto L_021F7E00; else goto L_021F7E08;
   L_021F7E00: ; // 0x21f7e00
@@ -23585,9 +23585,9 @@ void Gambit_fn_021F7D88(CPUState* cpu) {
         /* 021F7E0C */ _t14 = cpu->r[12] + 0xFFFFE5E4u;
         /* 021F7E0C */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 021F7E10 */ cpu->r[10] = 0x101D0000u;
-        /* 021F7E14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021F7E14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021F7E18 */ cpu->r[10] = cpu->r[10] + 0xFFFFFB60u;
-        /* 021F7E1C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7E1C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7E1C */ _t16 = _t15 & 0x00000001u;
         /* 021F7E1C */ if (_t16) goto L_021F7E20; else goto L_021F7E38;
   L_021F7E20: ; // 0x21f7e20
@@ -23600,8 +23600,8 @@ void Gambit_fn_021F7D88(CPUState* cpu) {
         /* 021F7E34 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 021F7E34 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_021F7E38: ; // 0x21f7e38
-        /* 021F7E38 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021F7E3C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7E38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021F7E3C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7E3C */ _t20 = _t19 & 0x00000001u;
         /* 021F7E3C */ if (_t20) goto L_021F7E40; else goto L_021F7E48;
   L_021F7E40: ; // 0x21f7e40
@@ -23612,9 +23612,9 @@ void Gambit_fn_021F7D88(CPUState* cpu) {
         /* 021F7E4C */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021F7E4C */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021F7E50 */ cpu->r[12] = 0x101D0000u;
-        /* 021F7E54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021F7E54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021F7E58 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021F7E5C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7E5C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7E5C */ _t23 = _t22 & 0x00000001u;
         /* 021F7E5C */ if (_t23) goto L_021F7E60; else goto L_021F7E78;
   L_021F7E60: ; // 0x21f7e60
@@ -23627,8 +23627,8 @@ void Gambit_fn_021F7D88(CPUState* cpu) {
         /* 021F7E74 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 021F7E74 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_021F7E78: ; // 0x21f7e78
-        /* 021F7E78 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021F7E7C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7E78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021F7E7C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7E7C */ _t27 = _t26 & 0x00000001u;
         /* 021F7E7C */ if (_t27) goto L_021F7E80; else goto L_021F7E88;
   L_021F7E80: ; // 0x21f7e80
@@ -23640,9 +23640,9 @@ void Gambit_fn_021F7D88(CPUState* cpu) {
         /* 021F7E8C */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 021F7E8C */ cpu->r[10] = _t28;
         /* 021F7E90 */ cpu->r[7] = 0x101D0000u;
-        /* 021F7E94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021F7E94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021F7E98 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 021F7E9C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7E9C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7E9C */ _t30 = _t29 & 0x00000001u;
         /* 021F7E9C */ if (_t30) goto L_021F7EA0; else goto L_021F7EB4;
   L_021F7EA0: ; // 0x21f7ea0
@@ -23654,8 +23654,8 @@ void Gambit_fn_021F7D88(CPUState* cpu) {
         /* 021F7EB0 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 021F7EB0 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_021F7EB4: ; // 0x21f7eb4
-        /* 021F7EB4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 021F7EB8 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7EB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 021F7EB8 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7EB8 */ _t34 = _t33 & 0x00000001u;
         /* 021F7EB8 */ if (_t34) goto L_021F7EBC; else goto L_021F7EC4;
   L_021F7EBC: ; // 0x21f7ebc
@@ -23667,9 +23667,9 @@ void Gambit_fn_021F7D88(CPUState* cpu) {
         /* 021F7EC8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 021F7EC8 */ cpu->r[8] = _t35;
         /* 021F7ECC */ cpu->r[6] = 0x101D0000u;
-        /* 021F7ED0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021F7ED0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021F7ED4 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 021F7ED8 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7ED8 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7ED8 */ _t37 = _t36 & 0x00000001u;
         /* 021F7ED8 */ if (_t37) goto L_021F7EDC; else goto L_021F7EF0;
   L_021F7EDC: ; // 0x21f7edc
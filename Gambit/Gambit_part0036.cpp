@@ -22,9 +22,9 @@ void Gambit_fn_021F7F38(CPUState* cpu) {
         /* 021F7F3C */ _t0 = cpu->r[7] + 0xFFFFFBA0u;
         /* 021F7F3C */ cpu->r[7] = rbrew_read32(cpu->mem, _t0);
         /* 021F7F40 */ cpu->r[8] = 0x101D0000u;
-        /* 021F7F44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021F7F44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021F7F48 */ cpu->r[8] = cpu->r[8] + 0xFFFFFDD0u;
-        /* 021F7F4C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7F4C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7F4C */ _t2 = _t1 & 0x00000001u;
         /* 021F7F4C */ if (_t2) goto L_021F7F50; else goto L_021F7F68;
   L_021F7F50: ; // 0x21f7f50
@@ -37,8 +37,8 @@ void Gambit_fn_021F7F38(CPUState* cpu) {
         /* 021F7F64 */ _t4 = cpu->r[8] + 0x00000000u;
         /* 021F7F64 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_021F7F68: ; // 0x21f7f68
-        /* 021F7F68 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F7F6C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7F68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F7F6C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7F6C */ _t6 = _t5 & 0x00000001u;
         /* 021F7F6C */ if (_t6) goto L_021F7F70; else goto L_021F7F78;
   L_021F7F70: ; // 0x21f7f70
@@ -49,9 +49,9 @@ void Gambit_fn_021F7F38(CPUState* cpu) {
         /* 021F7F7C */ _t7 = cpu->r[8] + 0xFFFFFB9Cu;
         /* 021F7F7C */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 021F7F80 */ cpu->r[11] = 0x101D0000u;
-        /* 021F7F84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021F7F84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021F7F88 */ cpu->r[11] = cpu->r[11] + 0xFFFFFBCCu;
-        /* 021F7F8C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7F8C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7F8C */ _t9 = _t8 & 0x00000001u;
         /* 021F7F8C */ if (_t9) goto L_021F7F90; else goto L_021F7FA8;
   L_021F7F90: ; // 0x21f7f90
@@ -64,8 +64,8 @@ void Gambit_fn_021F7F38(CPUState* cpu) {
         /* 021F7FA4 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021F7FA4 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021F7FA8: ; // 0x21f7fa8
-        /* 021F7FA8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021F7FAC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7FA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021F7FAC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7FAC */ _t13 = _t12 & 0x00000001u;
         /* 021F7FAC */ if (_t13) goto L_021F7FB0; else goto L_021F7FB8;
   L_021F7FB0: ; // 0x21f7fb0
@@ -76,9 +76,9 @@ void Gambit_fn_021F7F38(CPUState* cpu) {
         /* 021F7FBC */ _t14 = cpu->r[9] + 0xFFFFFB6Cu;
         /* 021F7FBC */ cpu->r[9] = rbrew_read32(cpu->mem, _t14);
         /* 021F7FC0 */ cpu->r[8] = 0x101D0000u;
-        /* 021F7FC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F7FC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F7FC8 */ cpu->r[8] = cpu->r[8] + 0xFFFFFBC8u;
-        /* 021F7FCC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7FCC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7FCC */ _t16 = _t15 & 0x00000001u;
         /* 021F7FCC */ if (_t16) goto L_021F7FD0; else goto L_021F7FE8;
   L_021F7FD0: ; // 0x21f7fd0
@@ -91,8 +91,8 @@ void Gambit_fn_021F7F38(CPUState* cpu) {
         /* 021F7FE4 */ _t18 = cpu->r[8] + 0x00000000u;
         /* 021F7FE4 */ rbrew_write32(cpu->mem, _t18, cpu->r[10]);
   L_021F7FE8: ; // 0x21f7fe8
-        /* 021F7FE8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F7FEC */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F7FE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F7FEC */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F7FEC */ _t20 = _t19 & 0x00000001u;
         /* 021F7FEC */ if (_t20) goto L_021F7FF0; else goto L_021F7FF8;
   L_021F7FF0: ; // 0x21f7ff0
@@ -103,9 +103,9 @@ void Gambit_fn_021F7F38(CPUState* cpu) {
         /* 021F7FFC */ _t21 = cpu->r[11] + 0xFFFFE5E4u;
         /* 021F7FFC */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021F8000 */ cpu->r[8] = 0x101D0000u;
-        /* 021F8004 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021F8004 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021F8008 */ cpu->r[8] = cpu->r[8] + 0xFFFFFB60u;
-        /* 021F800C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F800C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F800C */ _t23 = _t22 & 0x00000001u;
         /* 021F800C */ if (_t23) goto L_021F8010; else goto L_021F8028;
   L_021F8010: ; // 0x21f8010
@@ -118,8 +118,8 @@ void Gambit_fn_021F7F38(CPUState* cpu) {
         /* 021F8024 */ _t25 = cpu->r[8] + 0x00000000u;
         /* 021F8024 */ rbrew_write32(cpu->mem, _t25, cpu->r[9]);
   L_021F8028: ; // 0x21f8028
-        /* 021F8028 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F802C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8028 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F802C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F802C */ _t27 = _t26 & 0x00000001u;
         /* 021F802C */ if (_t27) goto L_021F8030; else goto L_021F8038;
   L_021F8030: ; // 0x21f8030
@@ -130,9 +130,9 @@ void Gambit_fn_021F7F38(CPUState* cpu) {
         /* 021F803C */ _t28 = cpu->r[10] + 0xFFFFD9ECu;
         /* 021F803C */ cpu->r[10] = rbrew_read32(cpu->mem, _t28);
         /* 021F8040 */ cpu->r[11] = 0x101D0000u;
-        /* 021F8044 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021F8044 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021F8048 */ cpu->r[11] = cpu->r[11] + 0xFFFFFB4Cu;
-        /* 021F804C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F804C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F804C */ _t30 = _t29 & 0x00000001u;
         /* 021F804C */ if (_t30) goto L_021F8050; else goto L_021F8068;
   L_021F8050: ; // 0x21f8050
@@ -145,8 +145,8 @@ void Gambit_fn_021F7F38(CPUState* cpu) {
         /* 021F8064 */ _t32 = cpu->r[11] + 0x00000000u;
         /* 021F8064 */ rbrew_write32(cpu->mem, _t32, cpu->r[7]);
   L_021F8068: ; // 0x21f8068
-        /* 021F8068 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021F806C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8068 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021F806C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F806C */ _t34 = _t33 & 0x00000001u;
         /* 021F806C */ if (_t34) goto L_021F8070; else goto L_021F8078;
   L_021F8070: ; // 0x21f8070
@@ -158,9 +158,9 @@ void Gambit_fn_021F7F38(CPUState* cpu) {
         /* 021F807C */ cpu->r[0] = rbrew_read32(cpu->mem, _t35);
         /* 021F807C */ cpu->r[11] = _t35;
         /* 021F8080 */ cpu->r[10] = 0x101D0000u;
-        /* 021F8084 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021F8084 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021F8088 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021F808C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F808C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F808C */ _t37 = _t36 & 0x00000001u;
         /* 021F808C */ if (_t37) goto L_021F8090; else goto L_021F80A4;
   L_021F8090: ; // 0x21f8090
@@ -172,8 +172,8 @@ void Gambit_fn_021F7F38(CPUState* cpu) {
         /* 021F80A0 */ _t39 = cpu->r[10] + 0x00000000u;
         /* 021F80A0 */ rbrew_write32(cpu->mem, _t39, cpu->r[0]);
   L_021F80A4: ; // 0x21f80a4
-        /* 021F80A4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021F80A8 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F80A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021F80A8 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F80A8 */ _t41 = _t40 & 0x00000001u;
         /* 021F80A8 */ if (_t41) goto L_021F80AC; else goto L_021F80B4;
   L_021F80AC: ; // 0x21f80ac
@@ -185,9 +185,9 @@ void Gambit_fn_021F7F38(CPUState* cpu) {
         /* 021F80B8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t42);
         /* 021F80B8 */ cpu->r[10] = _t42;
         /* 021F80BC */ cpu->r[11] = 0x101D0000u;
-        /* 021F80C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F80C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F80C4 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021F80C8 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F80C8 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F80C8 */ _t44 = _t43 & 0x00000001u;
         /* 021F80C8 */ if (_t44) goto L_021F80CC; else goto L_021F80E0;
   L_021F80CC: ; // 0x21f80cc
@@ -235,9 +235,9 @@ void Gambit_fn_021F8110(CPUState* cpu) {
         /* 021F8114 */ _t0 = cpu->r[7] + 0xFFFFFBA4u;
         /* 021F8114 */ cpu->r[7] = rbrew_read32(cpu->mem, _t0);
         /* 021F8118 */ cpu->r[8] = 0x101D0000u;
-        /* 021F811C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021F811C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021F8120 */ cpu->r[8] = cpu->r[8] + 0xFFFFFDD4u;
-        /* 021F8124 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8124 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8124 */ _t2 = _t1 & 0x00000001u;
         /* 021F8124 */ if (_t2) goto L_021F8128; else goto L_021F8140;
   L_021F8128: ; // 0x21f8128
@@ -250,8 +250,8 @@ void Gambit_fn_021F8110(CPUState* cpu) {
         /* 021F813C */ _t4 = cpu->r[8] + 0x00000000u;
         /* 021F813C */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_021F8140: ; // 0x21f8140
-        /* 021F8140 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F8144 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8140 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F8144 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8144 */ _t6 = _t5 & 0x00000001u;
         /* 021F8144 */ if (_t6) goto L_021F8148; else goto L_021F8150;
   L_021F8148: ; // 0x21f8148
@@ -262,9 +262,9 @@ void Gambit_fn_021F8110(CPUState* cpu) {
         /* 021F8154 */ _t7 = cpu->r[8] + 0xFFFFFB9Cu;
         /* 021F8154 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 021F8158 */ cpu->r[11] = 0x101D0000u;
-        /* 021F815C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021F815C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021F8160 */ cpu->r[11] = cpu->r[11] + 0xFFFFFBCCu;
-        /* 021F8164 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8164 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8164 */ _t9 = _t8 & 0x00000001u;
         /* 021F8164 */ if (_t9) goto L_021F8168; else goto L_021F8180;
   L_021F8168: ; // 0x21f8168
@@ -277,8 +277,8 @@ void Gambit_fn_021F8110(CPUState* cpu) {
         /* 021F817C */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021F817C */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021F8180: ; // 0x21f8180
-        /* 021F8180 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021F8184 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8180 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021F8184 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8184 */ _t13 = _t12 & 0x00000001u;
         /* 021F8184 */ if (_t13) goto L_021F8188; else goto L_021F8190;
   L_021F8188: ; // 0x21f8188
@@ -289,9 +289,9 @@ void Gambit_fn_021F8110(CPUState* cpu) {
         /* 021F8194 */ _t14 = cpu->r[9] + 0xFFFFFB6Cu;
         /* 021F8194 */ cpu->r[9] = rbrew_read32(cpu->mem, _t14);
         /* 021F8198 */ cpu->r[8] = 0x101D0000u;
-        /* 021F819C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F819C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F81A0 */ cpu->r[8] = cpu->r[8] + 0xFFFFFBC8u;
-        /* 021F81A4 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F81A4 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F81A4 */ _t16 = _t15 & 0x00000001u;
         /* 021F81A4 */ if (_t16) goto L_021F81A8; else goto L_021F81C0;
   L_021F81A8: ; // 0x21f81a8
@@ -304,8 +304,8 @@ void Gambit_fn_021F8110(CPUState* cpu) {
         /* 021F81BC */ _t18 = cpu->r[8] + 0x00000000u;
         /* 021F81BC */ rbrew_write32(cpu->mem, _t18, cpu->r[10]);
   L_021F81C0: ; // 0x21f81c0
-        /* 021F81C0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F81C4 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F81C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F81C4 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F81C4 */ _t20 = _t19 & 0x00000001u;
         /* 021F81C4 */ if (_t20) goto L_021F81C8; else goto L_021F81D0;
   L_021F81C8: ; // 0x21f81c8
@@ -316,9 +316,9 @@ void Gambit_fn_021F8110(CPUState* cpu) {
         /* 021F81D4 */ _t21 = cpu->r[11] + 0xFFFFE5E4u;
         /* 021F81D4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021F81D8 */ cpu->r[8] = 0x101D0000u;
-        /* 021F81DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021F81DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021F81E0 */ cpu->r[8] = cpu->r[8] + 0xFFFFFB60u;
-        /* 021F81E4 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F81E4 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F81E4 */ _t23 = _t22 & 0x00000001u;
         /* 021F81E4 */ if (_t23) goto L_021F81E8; else goto L_021F8200;
   L_021F81E8: ; // 0x21f81e8
@@ -331,8 +331,8 @@ void Gambit_fn_021F8110(CPUState* cpu) {
         /* 021F81FC */ _t25 = cpu->r[8] + 0x00000000u;
         /* 021F81FC */ rbrew_write32(cpu->mem, _t25, cpu->r[9]);
   L_021F8200: ; // 0x21f8200
-        /* 021F8200 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F8204 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8200 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F8204 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8204 */ _t27 = _t26 & 0x00000001u;
         /* 021F8204 */ if (_t27) goto L_021F8208; else goto L_021F8210;
   L_021F8208: ; // 0x21f8208
@@ -343,9 +343,9 @@ void Gambit_fn_021F8110(CPUState* cpu) {
         /* 021F8214 */ _t28 = cpu->r[10] + 0xFFFFD9ECu;
         /* 021F8214 */ cpu->r[10] = rbrew_read32(cpu->mem, _t28);
         /* 021F8218 */ cpu->r[11] = 0x101D0000u;
-        /* 021F821C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021F821C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021F8220 */ cpu->r[11] = cpu->r[11] + 0xFFFFFB4Cu;
-        /* 021F8224 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8224 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8224 */ _t30 = _t29 & 0x00000001u;
         /* 021F8224 */ if (_t30) goto L_021F8228; else goto L_021F8240;
   L_021F8228: ; // 0x21f8228
@@ -358,8 +358,8 @@ void Gambit_fn_021F8110(CPUState* cpu) {
         /* 021F823C */ _t32 = cpu->r[11] + 0x00000000u;
         /* 021F823C */ rbrew_write32(cpu->mem, _t32, cpu->r[7]);
   L_021F8240: ; // 0x21f8240
-        /* 021F8240 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021F8244 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8240 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021F8244 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8244 */ _t34 = _t33 & 0x00000001u;
         /* 021F8244 */ if (_t34) goto L_021F8248; else goto L_021F8250;
   L_021F8248: ; // 0x21f8248
@@ -371,9 +371,9 @@ void Gambit_fn_021F8110(CPUState* cpu) {
         /* 021F8254 */ cpu->r[0] = rbrew_read32(cpu->mem, _t35);
         /* 021F8254 */ cpu->r[11] = _t35;
         /* 021F8258 */ cpu->r[10] = 0x101D0000u;
-        /* 021F825C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021F825C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021F8260 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021F8264 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8264 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8264 */ _t37 = _t36 & 0x00000001u;
         /* 021F8264 */ if (_t37) goto L_021F8268; else goto L_021F827C;
   L_021F8268: ; // 0x21f8268
@@ -385,8 +385,8 @@ void Gambit_fn_021F8110(CPUState* cpu) {
         /* 021F8278 */ _t39 = cpu->r[10] + 0x00000000u;
         /* 021F8278 */ rbrew_write32(cpu->mem, _t39, cpu->r[0]);
   L_021F827C: ; // 0x21f827c
-        /* 021F827C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021F8280 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F827C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021F8280 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8280 */ _t41 = _t40 & 0x00000001u;
         /* 021F8280 */ if (_t41) goto L_021F8284; else goto L_021F828C;
   L_021F8284: ; // 0x21f8284
@@ -398,9 +398,9 @@ void Gambit_fn_021F8110(CPUState* cpu) {
         /* 021F8290 */ cpu->r[9] = rbrew_read32(cpu->mem, _t42);
         /* 021F8290 */ cpu->r[10] = _t42;
         /* 021F8294 */ cpu->r[11] = 0x101D0000u;
-        /* 021F8298 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F8298 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F829C */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021F82A0 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F82A0 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F82A0 */ _t44 = _t43 & 0x00000001u;
         /* 021F82A0 */ if (_t44) goto L_021F82A4; else goto L_021F82B8;
   L_021F82A4: ; // 0x21f82a4
@@ -448,9 +448,9 @@ void Gambit_fn_021F82E8(CPUState* cpu) {
         /* 021F82EC */ _t0 = cpu->r[7] + 0xFFFFFBA8u;
         /* 021F82EC */ cpu->r[7] = rbrew_read32(cpu->mem, _t0);
         /* 021F82F0 */ cpu->r[8] = 0x101D0000u;
-        /* 021F82F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021F82F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021F82F8 */ cpu->r[8] = cpu->r[8] + 0xFFFFFDD8u;
-        /* 021F82FC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F82FC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F82FC */ _t2 = _t1 & 0x00000001u;
         /* 021F82FC */ if (_t2) goto L_021F8300; else goto L_021F8318;
   L_021F8300: ; // 0x21f8300
@@ -463,8 +463,8 @@ void Gambit_fn_021F82E8(CPUState* cpu) {
         /* 021F8314 */ _t4 = cpu->r[8] + 0x00000000u;
         /* 021F8314 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_021F8318: ; // 0x21f8318
-        /* 021F8318 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F831C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F831C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F831C */ _t6 = _t5 & 0x00000001u;
         /* 021F831C */ if (_t6) goto L_021F8320; else goto L_021F8328;
   L_021F8320: ; // 0x21f8320
@@ -475,9 +475,9 @@ void Gambit_fn_021F82E8(CPUState* cpu) {
         /* 021F832C */ _t7 = cpu->r[8] + 0xFFFFFB9Cu;
         /* 021F832C */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 021F8330 */ cpu->r[11] = 0x101D0000u;
-        /* 021F8334 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021F8334 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021F8338 */ cpu->r[11] = cpu->r[11] + 0xFFFFFBCCu;
-        /* 021F833C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F833C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F833C */ _t9 = _t8 & 0x00000001u;
         /* 021F833C */ if (_t9) goto L_021F8340; else goto L_021F8358;
   L_021F8340: ; // 0x21f8340
@@ -490,8 +490,8 @@ void Gambit_fn_021F82E8(CPUState* cpu) {
         /* 021F8354 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021F8354 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021F8358: ; // 0x21f8358
-        /* 021F8358 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021F835C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8358 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021F835C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F835C */ _t13 = _t12 & 0x00000001u;
         /* 021F835C */ if (_t13) goto L_021F8360; else goto L_021F8368;
   L_021F8360: ; // 0x21f8360
@@ -502,9 +502,9 @@ void Gambit_fn_021F82E8(CPUState* cpu) {
         /* 021F836C */ _t14 = cpu->r[9] + 0xFFFFFB6Cu;
         /* 021F836C */ cpu->r[9] = rbrew_read32(cpu->mem, _t14);
         /* 021F8370 */ cpu->r[8] = 0x101D0000u;
-        /* 021F8374 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F8374 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F8378 */ cpu->r[8] = cpu->r[8] + 0xFFFFFBC8u;
-        /* 021F837C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F837C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F837C */ _t16 = _t15 & 0x00000001u;
         /* 021F837C */ if (_t16) goto L_021F8380; else goto L_021F8398;
   L_021F8380: ; // 0x21f8380
@@ -517,8 +517,8 @@ void Gambit_fn_021F82E8(CPUState* cpu) {
         /* 021F8394 */ _t18 = cpu->r[8] + 0x00000000u;
         /* 021F8394 */ rbrew_write32(cpu->mem, _t18, cpu->r[10]);
   L_021F8398: ; // 0x21f8398
-        /* 021F8398 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F839C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8398 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F839C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F839C */ _t20 = _t19 & 0x00000001u;
         /* 021F839C */ if (_t20) goto L_021F83A0; else goto L_021F83A8;
   L_021F83A0: ; // 0x21f83a0
@@ -529,9 +529,9 @@ void Gambit_fn_021F82E8(CPUState* cpu) {
         /* 021F83AC */ _t21 = cpu->r[11] + 0xFFFFE5E4u;
         /* 021F83AC */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021F83B0 */ cpu->r[8] = 0x101D0000u;
-        /* 021F83B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021F83B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021F83B8 */ cpu->r[8] = cpu->r[8] + 0xFFFFFB60u;
-        /* 021F83BC */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F83BC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F83BC */ _t23 = _t22 & 0x00000001u;
         /* 021F83BC */ if (_t23) goto L_021F83C0; else goto L_021F83D8;
   L_021F83C0: ; // 0x21f83c0
@@ -544,8 +544,8 @@ void Gambit_fn_021F82E8(CPUState* cpu) {
         /* 021F83D4 */ _t25 = cpu->r[8] + 0x00000000u;
         /* 021F83D4 */ rbrew_write32(cpu->mem, _t25, cpu->r[9]);
   L_021F83D8: ; // 0x21f83d8
-        /* 021F83D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F83DC */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F83D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F83DC */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F83DC */ _t27 = _t26 & 0x00000001u;
         /* 021F83DC */ if (_t27) goto L_021F83E0; else goto L_021F83E8;
   L_021F83E0: ; // 0x21f83e0
@@ -556,9 +556,9 @@ void Gambit_fn_021F82E8(CPUState* cpu) {
         /* 021F83EC */ _t28 = cpu->r[10] + 0xFFFFD9ECu;
         /* 021F83EC */ cpu->r[10] = rbrew_read32(cpu->mem, _t28);
         /* 021F83F0 */ cpu->r[11] = 0x101D0000u;
-        /* 021F83F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021F83F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021F83F8 */ cpu->r[11] = cpu->r[11] + 0xFFFFFB4Cu;
-        /* 021F83FC */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F83FC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F83FC */ _t30 = _t29 & 0x00000001u;
         /* 021F83FC */ if (_t30) goto L_021F8400; else goto L_021F8418;
   L_021F8400: ; // 0x21f8400
@@ -571,8 +571,8 @@ void Gambit_fn_021F82E8(CPUState* cpu) {
         /* 021F8414 */ _t32 = cpu->r[11] + 0x00000000u;
         /* 021F8414 */ rbrew_write32(cpu->mem, _t32, cpu->r[7]);
   L_021F8418: ; // 0x21f8418
-        /* 021F8418 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021F841C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021F841C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F841C */ _t34 = _t33 & 0x00000001u;
         /* 021F841C */ if (_t34) goto L_021F8420; else goto L_021F8428;
   L_021F8420: ; // 0x21f8420
@@ -584,9 +584,9 @@ void Gambit_fn_021F82E8(CPUState* cpu) {
         /* 021F842C */ cpu->r[0] = rbrew_read32(cpu->mem, _t35);
         /* 021F842C */ cpu->r[11] = _t35;
         /* 021F8430 */ cpu->r[10] = 0x101D0000u;
-        /* 021F8434 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021F8434 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021F8438 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021F843C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F843C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F843C */ _t37 = _t36 & 0x00000001u;
         /* 021F843C */ if (_t37) goto L_021F8440; else goto L_021F8454;
   L_021F8440: ; // 0x21f8440
@@ -598,8 +598,8 @@ void Gambit_fn_021F82E8(CPUState* cpu) {
         /* 021F8450 */ _t39 = cpu->r[10] + 0x00000000u;
         /* 021F8450 */ rbrew_write32(cpu->mem, _t39, cpu->r[0]);
   L_021F8454: ; // 0x21f8454
-        /* 021F8454 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021F8458 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8454 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021F8458 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8458 */ _t41 = _t40 & 0x00000001u;
         /* 021F8458 */ if (_t41) goto L_021F845C; else goto L_021F8464;
   L_021F845C: ; // 0x21f845c
@@ -611,9 +611,9 @@ void Gambit_fn_021F82E8(CPUState* cpu) {
         /* 021F8468 */ cpu->r[9] = rbrew_read32(cpu->mem, _t42);
         /* 021F8468 */ cpu->r[10] = _t42;
         /* 021F846C */ cpu->r[11] = 0x101D0000u;
-        /* 021F8470 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F8470 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F8474 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021F8478 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8478 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8478 */ _t44 = _t43 & 0x00000001u;
         /* 021F8478 */ if (_t44) goto L_021F847C; else goto L_021F8490;
   L_021F847C: ; // 0x21f847c
@@ -661,9 +661,9 @@ void Gambit_fn_021F84C0(CPUState* cpu) {
         /* 021F84C4 */ _t0 = cpu->r[7] + 0xFFFFFBACu;
         /* 021F84C4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t0);
         /* 021F84C8 */ cpu->r[8] = 0x101D0000u;
-        /* 021F84CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021F84CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021F84D0 */ cpu->r[8] = cpu->r[8] + 0xFFFFFDDCu;
-        /* 021F84D4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F84D4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F84D4 */ _t2 = _t1 & 0x00000001u;
         /* 021F84D4 */ if (_t2) goto L_021F84D8; else goto L_021F84F0;
   L_021F84D8: ; // 0x21f84d8
@@ -676,8 +676,8 @@ void Gambit_fn_021F84C0(CPUState* cpu) {
         /* 021F84EC */ _t4 = cpu->r[8] + 0x00000000u;
         /* 021F84EC */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_021F84F0: ; // 0x21f84f0
-        /* 021F84F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F84F4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F84F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F84F4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F84F4 */ _t6 = _t5 & 0x00000001u;
         /* 021F84F4 */ if (_t6) goto L_021F84F8; else goto L_021F8500;
   L_021F84F8: ; // 0x21f84f8
@@ -688,9 +688,9 @@ void Gambit_fn_021F84C0(CPUState* cpu) {
         /* 021F8504 */ _t7 = cpu->r[8] + 0xFFFFFB9Cu;
         /* 021F8504 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 021F8508 */ cpu->r[11] = 0x101D0000u;
-        /* 021F850C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021F850C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021F8510 */ cpu->r[11] = cpu->r[11] + 0xFFFFFBCCu;
-        /* 021F8514 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8514 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8514 */ _t9 = _t8 & 0x00000001u;
         /* 021F8514 */ if (_t9) goto L_021F8518; else goto L_021F8530;
   L_021F8518: ; // 0x21f8518
@@ -703,8 +703,8 @@ void Gambit_fn_021F84C0(CPUState* cpu) {
         /* 021F852C */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021F852C */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021F8530: ; // 0x21f8530
-        /* 021F8530 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021F8534 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8530 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021F8534 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8534 */ _t13 = _t12 & 0x00000001u;
         /* 021F8534 */ if (_t13) goto L_021F8538; else goto L_021F8540;
   L_021F8538: ; // 0x21f8538
@@ -715,9 +715,9 @@ void Gambit_fn_021F84C0(CPUState* cpu) {
         /* 021F8544 */ _t14 = cpu->r[9] + 0xFFFFFB6Cu;
         /* 021F8544 */ cpu->r[9] = rbrew_read32(cpu->mem, _t14);
         /* 021F8548 */ cpu->r[8] = 0x101D0000u;
-        /* 021F854C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F854C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F8550 */ cpu->r[8] = cpu->r[8] + 0xFFFFFBC8u;
-        /* 021F8554 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8554 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8554 */ _t16 = _t15 & 0x00000001u;
         /* 021F8554 */ if (_t16) goto L_021F8558; else goto L_021F8570;
   L_021F8558: ; // 0x21f8558
@@ -730,8 +730,8 @@ void Gambit_fn_021F84C0(CPUState* cpu) {
         /* 021F856C */ _t18 = cpu->r[8] + 0x00000000u;
         /* 021F856C */ rbrew_write32(cpu->mem, _t18, cpu->r[10]);
   L_021F8570: ; // 0x21f8570
-        /* 021F8570 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F8574 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8570 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F8574 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8574 */ _t20 = _t19 & 0x00000001u;
         /* 021F8574 */ if (_t20) goto L_021F8578; else goto L_021F8580;
   L_021F8578: ; // 0x21f8578
@@ -742,9 +742,9 @@ void Gambit_fn_021F84C0(CPUState* cpu) {
         /* 021F8584 */ _t21 = cpu->r[11] + 0xFFFFE5E4u;
         /* 021F8584 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021F8588 */ cpu->r[8] = 0x101D0000u;
-        /* 021F858C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021F858C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021F8590 */ cpu->r[8] = cpu->r[8] + 0xFFFFFB60u;
-        /* 021F8594 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8594 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8594 */ _t23 = _t22 & 0x00000001u;
         /* 021F8594 */ if (_t23) goto L_021F8598; else goto L_021F85B0;
   L_021F8598: ; // 0x21f8598
@@ -757,8 +757,8 @@ void Gambit_fn_021F84C0(CPUState* cpu) {
         /* 021F85AC */ _t25 = cpu->r[8] + 0x00000000u;
         /* 021F85AC */ rbrew_write32(cpu->mem, _t25, cpu->r[9]);
   L_021F85B0: ; // 0x21f85b0
-        /* 021F85B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F85B4 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F85B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F85B4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F85B4 */ _t27 = _t26 & 0x00000001u;
         /* 021F85B4 */ if (_t27) goto L_021F85B8; else goto L_021F85C0;
   L_021F85B8: ; // 0x21f85b8
@@ -769,9 +769,9 @@ void Gambit_fn_021F84C0(CPUState* cpu) {
         /* 021F85C4 */ _t28 = cpu->r[10] + 0xFFFFD9ECu;
         /* 021F85C4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t28);
         /* 021F85C8 */ cpu->r[11] = 0x101D0000u;
-        /* 021F85CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021F85CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021F85D0 */ cpu->r[11] = cpu->r[11] + 0xFFFFFB4Cu;
-        /* 021F85D4 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F85D4 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F85D4 */ _t30 = _t29 & 0x00000001u;
         /* 021F85D4 */ if (_t30) goto L_021F85D8; else goto L_021F85F0;
   L_021F85D8: ; // 0x21f85d8
@@ -784,8 +784,8 @@ void Gambit_fn_021F84C0(CPUState* cpu) {
         /* 021F85EC */ _t32 = cpu->r[11] + 0x00000000u;
         /* 021F85EC */ rbrew_write32(cpu->mem, _t32, cpu->r[7]);
   L_021F85F0: ; // 0x21f85f0
-        /* 021F85F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021F85F4 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F85F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021F85F4 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F85F4 */ _t34 = _t33 & 0x00000001u;
         /* 021F85F4 */ if (_t34) goto L_021F85F8; else goto L_021F8600;
   L_021F85F8: ; // 0x21f85f8
@@ -797,9 +797,9 @@ void Gambit_fn_021F84C0(CPUState* cpu) {
         /* 021F8604 */ cpu->r[0] = rbrew_read32(cpu->mem, _t35);
         /* 021F8604 */ cpu->r[11] = _t35;
         /* 021F8608 */ cpu->r[10] = 0x101D0000u;
-        /* 021F860C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021F860C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021F8610 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021F8614 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8614 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8614 */ _t37 = _t36 & 0x00000001u;
         /* 021F8614 */ if (_t37) goto L_021F8618; else goto L_021F862C;
   L_021F8618: ; // 0x21f8618
@@ -811,8 +811,8 @@ void Gambit_fn_021F84C0(CPUState* cpu) {
         /* 021F8628 */ _t39 = cpu->r[10] + 0x00000000u;
         /* 021F8628 */ rbrew_write32(cpu->mem, _t39, cpu->r[0]);
   L_021F862C: ; // 0x21f862c
-        /* 021F862C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021F8630 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F862C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021F8630 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8630 */ _t41 = _t40 & 0x00000001u;
         /* 021F8630 */ if (_t41) goto L_021F8634; else goto L_021F863C;
   L_021F8634: ; // 0x21f8634
@@ -824,9 +824,9 @@ void Gambit_fn_021F84C0(CPUState* cpu) {
         /* 021F8640 */ cpu->r[9] = rbrew_read32(cpu->mem, _t42);
         /* 021F8640 */ cpu->r[10] = _t42;
         /* 021F8644 */ cpu->r[11] = 0x101D0000u;
-        /* 021F8648 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F8648 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F864C */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021F8650 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8650 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8650 */ _t44 = _t43 & 0x00000001u;
         /* 021F8650 */ if (_t44) goto L_021F8654; else goto L_021F8668;
   L_021F8654: ; // 0x21f8654
@@ -964,9 +964,9 @@ void Gambit_fn_021F86F8(CPUState* cpu) {
         /* 021F86FC */ _t0 = cpu->r[7] + 0xFFFFFC18u;
         /* 021F86FC */ cpu->r[7] = rbrew_read32(cpu->mem, _t0);
         /* 021F8700 */ cpu->r[8] = 0x101D0000u;
-        /* 021F8704 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021F8704 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021F8708 */ cpu->r[8] = cpu->r[8] + 0xFFFFFDE0u;
-        /* 021F870C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F870C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F870C */ _t2 = _t1 & 0x00000001u;
         /* 021F870C */ if (_t2) goto L_021F8710; else goto L_021F8728;
   L_021F8710: ; // 0x21f8710
@@ -979,8 +979,8 @@ void Gambit_fn_021F86F8(CPUState* cpu) {
         /* 021F8724 */ _t4 = cpu->r[8] + 0x00000000u;
         /* 021F8724 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_021F8728: ; // 0x21f8728
-        /* 021F8728 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F872C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F872C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F872C */ _t6 = _t5 & 0x00000001u;
         /* 021F872C */ if (_t6) goto L_021F8730; else goto L_021F8738;
   L_021F8730: ; // 0x21f8730
@@ -991,9 +991,9 @@ void Gambit_fn_021F86F8(CPUState* cpu) {
         /* 021F873C */ _t7 = cpu->r[8] + 0xFFFFFC10u;
         /* 021F873C */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 021F8740 */ cpu->r[11] = 0x101D0000u;
-        /* 021F8744 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021F8744 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021F8748 */ cpu->r[11] = cpu->r[11] + 0xFFFFFC14u;
-        /* 021F874C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F874C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F874C */ _t9 = _t8 & 0x00000001u;
         /* 021F874C */ if (_t9) goto L_021F8750; else goto L_021F8768;
   L_021F8750: ; // 0x21f8750
@@ -1006,8 +1006,8 @@ void Gambit_fn_021F86F8(CPUState* cpu) {
         /* 021F8764 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021F8764 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021F8768: ; // 0x21f8768
-        /* 021F8768 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021F876C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021F876C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F876C */ _t13 = _t12 & 0x00000001u;
         /* 021F876C */ if (_t13) goto L_021F8770; else goto L_021F8778;
   L_021F8770: ; // 0x21f8770
@@ -1018,9 +1018,9 @@ void Gambit_fn_021F86F8(CPUState* cpu) {
         /* 021F877C */ _t14 = cpu->r[9] + 0xFFFFE5E8u;
         /* 021F877C */ cpu->r[9] = rbrew_read32(cpu->mem, _t14);
         /* 021F8780 */ cpu->r[8] = 0x101D0000u;
-        /* 021F8784 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F8784 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F8788 */ cpu->r[8] = cpu->r[8] + 0xFFFFFC0Cu;
-        /* 021F878C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F878C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F878C */ _t16 = _t15 & 0x00000001u;
         /* 021F878C */ if (_t16) goto L_021F8790; else goto L_021F87A8;
   L_021F8790: ; // 0x21f8790
@@ -1033,8 +1033,8 @@ void Gambit_fn_021F86F8(CPUState* cpu) {
         /* 021F87A4 */ _t18 = cpu->r[8] + 0x00000000u;
         /* 021F87A4 */ rbrew_write32(cpu->mem, _t18, cpu->r[10]);
   L_021F87A8: ; // 0x21f87a8
-        /* 021F87A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F87AC */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F87A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F87AC */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F87AC */ _t20 = _t19 & 0x00000001u;
         /* 021F87AC */ if (_t20) goto L_021F87B0; else goto L_021F87B8;
   L_021F87B0: ; // 0x21f87b0
@@ -1045,9 +1045,9 @@ void Gambit_fn_021F86F8(CPUState* cpu) {
         /* 021F87BC */ _t21 = cpu->r[11] + 0xFFFFDA00u;
         /* 021F87BC */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021F87C0 */ cpu->r[8] = 0x101D0000u;
-        /* 021F87C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021F87C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021F87C8 */ cpu->r[8] = cpu->r[8] + 0xFFFFFBFCu;
-        /* 021F87CC */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F87CC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F87CC */ _t23 = _t22 & 0x00000001u;
         /* 021F87CC */ if (_t23) goto L_021F87D0; else goto L_021F87E8;
   L_021F87D0: ; // 0x21f87d0
@@ -1060,8 +1060,8 @@ void Gambit_fn_021F86F8(CPUState* cpu) {
         /* 021F87E4 */ _t25 = cpu->r[8] + 0x00000000u;
         /* 021F87E4 */ rbrew_write32(cpu->mem, _t25, cpu->r[9]);
   L_021F87E8: ; // 0x21f87e8
-        /* 021F87E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F87EC */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F87E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F87EC */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F87EC */ _t27 = _t26 & 0x00000001u;
         /* 021F87EC */ if (_t27) goto L_021F87F0; else goto L_021F87F8;
   L_021F87F0: ; // 0x21f87f0
@@ -1072,9 +1072,9 @@ void Gambit_fn_021F86F8(CPUState* cpu) {
         /* 021F87FC */ _t28 = cpu->r[10] + 0xFFFFD9ECu;
         /* 021F87FC */ cpu->r[10] = rbrew_read32(cpu->mem, _t28);
         /* 021F8800 */ cpu->r[11] = 0x101D0000u;
-        /* 021F8804 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021F8804 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021F8808 */ cpu->r[11] = cpu->r[11] + 0xFFFFFB4Cu;
-        /* 021F880C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F880C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F880C */ _t30 = _t29 & 0x00000001u;
         /* 021F880C */ if (_t30) goto L_021F8810; else goto L_021F8828;
   L_021F8810: ; // 0x21f8810
@@ -1087,8 +1087,8 @@ void Gambit_fn_021F86F8(CPUState* cpu) {
         /* 021F8824 */ _t32 = cpu->r[11] + 0x00000000u;
         /* 021F8824 */ rbrew_write32(cpu->mem, _t32, cpu->r[7]);
   L_021F8828: ; // 0x21f8828
-        /* 021F8828 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021F882C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8828 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021F882C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F882C */ _t34 = _t33 & 0x00000001u;
         /* 021F882C */ if (_t34) goto L_021F8830; else goto L_021F8838;
   L_021F8830: ; // 0x21f8830
@@ -1100,9 +1100,9 @@ void Gambit_fn_021F86F8(CPUState* cpu) {
         /* 021F883C */ cpu->r[0] = rbrew_read32(cpu->mem, _t35);
         /* 021F883C */ cpu->r[11] = _t35;
         /* 021F8840 */ cpu->r[10] = 0x101D0000u;
-        /* 021F8844 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021F8844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021F8848 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021F884C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F884C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F884C */ _t37 = _t36 & 0x00000001u;
         /* 021F884C */ if (_t37) goto L_021F8850; else goto L_021F8864;
   L_021F8850: ; // 0x21f8850
@@ -1114,8 +1114,8 @@ void Gambit_fn_021F86F8(CPUState* cpu) {
         /* 021F8860 */ _t39 = cpu->r[10] + 0x00000000u;
         /* 021F8860 */ rbrew_write32(cpu->mem, _t39, cpu->r[0]);
   L_021F8864: ; // 0x21f8864
-        /* 021F8864 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021F8868 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8864 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021F8868 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8868 */ _t41 = _t40 & 0x00000001u;
         /* 021F8868 */ if (_t41) goto L_021F886C; else goto L_021F8874;
   L_021F886C: ; // 0x21f886c
@@ -1127,9 +1127,9 @@ void Gambit_fn_021F86F8(CPUState* cpu) {
         /* 021F8878 */ cpu->r[9] = rbrew_read32(cpu->mem, _t42);
         /* 021F8878 */ cpu->r[10] = _t42;
         /* 021F887C */ cpu->r[11] = 0x101D0000u;
-        /* 021F8880 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F8880 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F8884 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021F8888 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8888 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8888 */ _t44 = _t43 & 0x00000001u;
         /* 021F8888 */ if (_t44) goto L_021F888C; else goto L_021F88A0;
   L_021F888C: ; // 0x21f888c
@@ -1177,9 +1177,9 @@ void Gambit_fn_021F88D0(CPUState* cpu) {
         /* 021F88D4 */ _t0 = cpu->r[7] + 0xFFFFFC1Cu;
         /* 021F88D4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t0);
         /* 021F88D8 */ cpu->r[8] = 0x101D0000u;
-        /* 021F88DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021F88DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021F88E0 */ cpu->r[8] = cpu->r[8] + 0xFFFFFDE4u;
-        /* 021F88E4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F88E4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F88E4 */ _t2 = _t1 & 0x00000001u;
         /* 021F88E4 */ if (_t2) goto L_021F88E8; else goto L_021F8900;
   L_021F88E8: ; // 0x21f88e8
@@ -1192,8 +1192,8 @@ void Gambit_fn_021F88D0(CPUState* cpu) {
         /* 021F88FC */ _t4 = cpu->r[8] + 0x00000000u;
         /* 021F88FC */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_021F8900: ; // 0x21f8900
-        /* 021F8900 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F8904 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8900 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F8904 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8904 */ _t6 = _t5 & 0x00000001u;
         /* 021F8904 */ if (_t6) goto L_021F8908; else goto L_021F8910;
   L_021F8908: ; // 0x21f8908
@@ -1204,9 +1204,9 @@ void Gambit_fn_021F88D0(CPUState* cpu) {
         /* 021F8914 */ _t7 = cpu->r[8] + 0xFFFFFC10u;
         /* 021F8914 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 021F8918 */ cpu->r[11] = 0x101D0000u;
-        /* 021F891C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021F891C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021F8920 */ cpu->r[11] = cpu->r[11] + 0xFFFFFC14u;
-        /* 021F8924 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8924 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8924 */ _t9 = _t8 & 0x00000001u;
         /* 021F8924 */ if (_t9) goto L_021F8928; else goto L_021F8940;
   L_021F8928: ; // 0x21f8928
@@ -1219,8 +1219,8 @@ void Gambit_fn_021F88D0(CPUState* cpu) {
         /* 021F893C */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021F893C */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021F8940: ; // 0x21f8940
-        /* 021F8940 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021F8944 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021F8944 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8944 */ _t13 = _t12 & 0x00000001u;
         /* 021F8944 */ if (_t13) goto L_021F8948; else goto L_021F8950;
   L_021F8948: ; // 0x21f8948
@@ -1231,9 +1231,9 @@ void Gambit_fn_021F88D0(CPUState* cpu) {
         /* 021F8954 */ _t14 = cpu->r[9] + 0xFFFFE5E8u;
         /* 021F8954 */ cpu->r[9] = rbrew_read32(cpu->mem, _t14);
         /* 021F8958 */ cpu->r[8] = 0x101D0000u;
-        /* 021F895C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F895C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F8960 */ cpu->r[8] = cpu->r[8] + 0xFFFFFC0Cu;
-        /* 021F8964 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8964 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8964 */ _t16 = _t15 & 0x00000001u;
         /* 021F8964 */ if (_t16) goto L_021F8968; else goto L_021F8980;
   L_021F8968: ; // 0x21f8968
@@ -1246,8 +1246,8 @@ void Gambit_fn_021F88D0(CPUState* cpu) {
         /* 021F897C */ _t18 = cpu->r[8] + 0x00000000u;
         /* 021F897C */ rbrew_write32(cpu->mem, _t18, cpu->r[10]);
   L_021F8980: ; // 0x21f8980
-        /* 021F8980 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F8984 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8980 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F8984 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8984 */ _t20 = _t19 & 0x00000001u;
         /* 021F8984 */ if (_t20) goto L_021F8988; else goto L_021F8990;
   L_021F8988: ; // 0x21f8988
@@ -1258,9 +1258,9 @@ void Gambit_fn_021F88D0(CPUState* cpu) {
         /* 021F8994 */ _t21 = cpu->r[11] + 0xFFFFDA00u;
         /* 021F8994 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021F8998 */ cpu->r[8] = 0x101D0000u;
-        /* 021F899C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021F899C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021F89A0 */ cpu->r[8] = cpu->r[8] + 0xFFFFFBFCu;
-        /* 021F89A4 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F89A4 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F89A4 */ _t23 = _t22 & 0x00000001u;
         /* 021F89A4 */ if (_t23) goto L_021F89A8; else goto L_021F89C0;
   L_021F89A8: ; // 0x21f89a8
@@ -1273,8 +1273,8 @@ void Gambit_fn_021F88D0(CPUState* cpu) {
         /* 021F89BC */ _t25 = cpu->r[8] + 0x00000000u;
         /* 021F89BC */ rbrew_write32(cpu->mem, _t25, cpu->r[9]);
   L_021F89C0: ; // 0x21f89c0
-        /* 021F89C0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F89C4 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F89C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F89C4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F89C4 */ _t27 = _t26 & 0x00000001u;
         /* 021F89C4 */ if (_t27) goto L_021F89C8; else goto L_021F89D0;
   L_021F89C8: ; // 0x21f89c8
@@ -1285,9 +1285,9 @@ void Gambit_fn_021F88D0(CPUState* cpu) {
         /* 021F89D4 */ _t28 = cpu->r[10] + 0xFFFFD9ECu;
         /* 021F89D4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t28);
         /* 021F89D8 */ cpu->r[11] = 0x101D0000u;
-        /* 021F89DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021F89DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021F89E0 */ cpu->r[11] = cpu->r[11] + 0xFFFFFB4Cu;
-        /* 021F89E4 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F89E4 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F89E4 */ _t30 = _t29 & 0x00000001u;
         /* 021F89E4 */ if (_t30) goto L_021F89E8; else goto L_021F8A00;
   L_021F89E8: ; // 0x21f89e8
@@ -1300,8 +1300,8 @@ void Gambit_fn_021F88D0(CPUState* cpu) {
         /* 021F89FC */ _t32 = cpu->r[11] + 0x00000000u;
         /* 021F89FC */ rbrew_write32(cpu->mem, _t32, cpu->r[7]);
   L_021F8A00: ; // 0x21f8a00
-        /* 021F8A00 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021F8A04 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8A00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021F8A04 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8A04 */ _t34 = _t33 & 0x00000001u;
         /* 021F8A04 */ if (_t34) goto L_021F8A08; else goto L_021F8A10;
   L_021F8A08: ; // 0x21f8a08
@@ -1313,9 +1313,9 @@ void Gambit_fn_021F88D0(CPUState* cpu) {
         /* 021F8A14 */ cpu->r[0] = rbrew_read32(cpu->mem, _t35);
         /* 021F8A14 */ cpu->r[11] = _t35;
         /* 021F8A18 */ cpu->r[10] = 0x101D0000u;
-        /* 021F8A1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021F8A1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021F8A20 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021F8A24 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8A24 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8A24 */ _t37 = _t36 & 0x00000001u;
         /* 021F8A24 */ if (_t37) goto L_021F8A28; else goto L_021F8A3C;
   L_021F8A28: ; // 0x21f8a28
@@ -1327,8 +1327,8 @@ void Gambit_fn_021F88D0(CPUState* cpu) {
         /* 021F8A38 */ _t39 = cpu->r[10] + 0x00000000u;
         /* 021F8A38 */ rbrew_write32(cpu->mem, _t39, cpu->r[0]);
   L_021F8A3C: ; // 0x21f8a3c
-        /* 021F8A3C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021F8A40 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8A3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021F8A40 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8A40 */ _t41 = _t40 & 0x00000001u;
         /* 021F8A40 */ if (_t41) goto L_021F8A44; else goto L_021F8A4C;
   L_021F8A44: ; // 0x21f8a44
@@ -1340,9 +1340,9 @@ void Gambit_fn_021F88D0(CPUState* cpu) {
         /* 021F8A50 */ cpu->r[9] = rbrew_read32(cpu->mem, _t42);
         /* 021F8A50 */ cpu->r[10] = _t42;
         /* 021F8A54 */ cpu->r[11] = 0x101D0000u;
-        /* 021F8A58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F8A58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F8A5C */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021F8A60 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8A60 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8A60 */ _t44 = _t43 & 0x00000001u;
         /* 021F8A60 */ if (_t44) goto L_021F8A64; else goto L_021F8A78;
   L_021F8A64: ; // 0x21f8a64
@@ -1390,9 +1390,9 @@ void Gambit_fn_021F8AA8(CPUState* cpu) {
         /* 021F8AAC */ _t0 = cpu->r[7] + 0xFFFFFC20u;
         /* 021F8AAC */ cpu->r[7] = rbrew_read32(cpu->mem, _t0);
         /* 021F8AB0 */ cpu->r[8] = 0x101D0000u;
-        /* 021F8AB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021F8AB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021F8AB8 */ cpu->r[8] = cpu->r[8] + 0xFFFFFDE8u;
-        /* 021F8ABC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8ABC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8ABC */ _t2 = _t1 & 0x00000001u;
         /* 021F8ABC */ if (_t2) goto L_021F8AC0; else goto L_021F8AD8;
   L_021F8AC0: ; // 0x21f8ac0
@@ -1405,8 +1405,8 @@ void Gambit_fn_021F8AA8(CPUState* cpu) {
         /* 021F8AD4 */ _t4 = cpu->r[8] + 0x00000000u;
         /* 021F8AD4 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_021F8AD8: ; // 0x21f8ad8
-        /* 021F8AD8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F8ADC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8AD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F8ADC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8ADC */ _t6 = _t5 & 0x00000001u;
         /* 021F8ADC */ if (_t6) goto L_021F8AE0; else goto L_021F8AE8;
   L_021F8AE0: ; // 0x21f8ae0
@@ -1417,9 +1417,9 @@ void Gambit_fn_021F8AA8(CPUState* cpu) {
         /* 021F8AEC */ _t7 = cpu->r[8] + 0xFFFFFC10u;
         /* 021F8AEC */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 021F8AF0 */ cpu->r[11] = 0x101D0000u;
-        /* 021F8AF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021F8AF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021F8AF8 */ cpu->r[11] = cpu->r[11] + 0xFFFFFC14u;
-        /* 021F8AFC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8AFC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8AFC */ _t9 = _t8 & 0x00000001u;
         /* 021F8AFC */ if (_t9) goto L_021F8B00; else goto L_021F8B18;
   L_021F8B00: ; // 0x21f8b00
@@ -1432,8 +1432,8 @@ void Gambit_fn_021F8AA8(CPUState* cpu) {
         /* 021F8B14 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021F8B14 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021F8B18: ; // 0x21f8b18
-        /* 021F8B18 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021F8B1C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8B18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021F8B1C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8B1C */ _t13 = _t12 & 0x00000001u;
         /* 021F8B1C */ if (_t13) goto L_021F8B20; else goto L_021F8B28;
   L_021F8B20: ; // 0x21f8b20
@@ -1444,9 +1444,9 @@ void Gambit_fn_021F8AA8(CPUState* cpu) {
         /* 021F8B2C */ _t14 = cpu->r[9] + 0xFFFFE5E8u;
         /* 021F8B2C */ cpu->r[9] = rbrew_read32(cpu->mem, _t14);
         /* 021F8B30 */ cpu->r[8] = 0x101D0000u;
-        /* 021F8B34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F8B34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F8B38 */ cpu->r[8] = cpu->r[8] + 0xFFFFFC0Cu;
-        /* 021F8B3C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8B3C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8B3C */ _t16 = _t15 & 0x00000001u;
         /* 021F8B3C */ if (_t16) goto L_021F8B40; else goto L_021F8B58;
   L_021F8B40: ; // 0x21f8b40
@@ -1459,8 +1459,8 @@ void Gambit_fn_021F8AA8(CPUState* cpu) {
         /* 021F8B54 */ _t18 = cpu->r[8] + 0x00000000u;
         /* 021F8B54 */ rbrew_write32(cpu->mem, _t18, cpu->r[10]);
   L_021F8B58: ; // 0x21f8b58
-        /* 021F8B58 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F8B5C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8B58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F8B5C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8B5C */ _t20 = _t19 & 0x00000001u;
         /* 021F8B5C */ if (_t20) goto L_021F8B60; else goto L_021F8B68;
   L_021F8B60: ; // 0x21f8b60
@@ -1471,9 +1471,9 @@ void Gambit_fn_021F8AA8(CPUState* cpu) {
         /* 021F8B6C */ _t21 = cpu->r[11] + 0xFFFFDA00u;
         /* 021F8B6C */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021F8B70 */ cpu->r[8] = 0x101D0000u;
-        /* 021F8B74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021F8B74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021F8B78 */ cpu->r[8] = cpu->r[8] + 0xFFFFFBFCu;
-        /* 021F8B7C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8B7C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8B7C */ _t23 = _t22 & 0x00000001u;
         /* 021F8B7C */ if (_t23) goto L_021F8B80; else goto L_021F8B98;
   L_021F8B80: ; // 0x21f8b80
@@ -1486,8 +1486,8 @@ void Gambit_fn_021F8AA8(CPUState* cpu) {
         /* 021F8B94 */ _t25 = cpu->r[8] + 0x00000000u;
         /* 021F8B94 */ rbrew_write32(cpu->mem, _t25, cpu->r[9]);
   L_021F8B98: ; // 0x21f8b98
-        /* 021F8B98 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F8B9C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8B98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F8B9C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8B9C */ _t27 = _t26 & 0x00000001u;
         /* 021F8B9C */ if (_t27) goto L_021F8BA0; else goto L_021F8BA8;
   L_021F8BA0: ; // 0x21f8ba0
@@ -1498,9 +1498,9 @@ void Gambit_fn_021F8AA8(CPUState* cpu) {
         /* 021F8BAC */ _t28 = cpu->r[10] + 0xFFFFD9ECu;
         /* 021F8BAC */ cpu->r[10] = rbrew_read32(cpu->mem, _t28);
         /* 021F8BB0 */ cpu->r[11] = 0x101D0000u;
-        /* 021F8BB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021F8BB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021F8BB8 */ cpu->r[11] = cpu->r[11] + 0xFFFFFB4Cu;
-        /* 021F8BBC */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8BBC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8BBC */ _t30 = _t29 & 0x00000001u;
         /* 021F8BBC */ if (_t30) goto L_021F8BC0; else goto L_021F8BD8;
   L_021F8BC0: ; // 0x21f8bc0
@@ -1513,8 +1513,8 @@ void Gambit_fn_021F8AA8(CPUState* cpu) {
         /* 021F8BD4 */ _t32 = cpu->r[11] + 0x00000000u;
         /* 021F8BD4 */ rbrew_write32(cpu->mem, _t32, cpu->r[7]);
   L_021F8BD8: ; // 0x21f8bd8
-        /* 021F8BD8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021F8BDC */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8BD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021F8BDC */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8BDC */ _t34 = _t33 & 0x00000001u;
         /* 021F8BDC */ if (_t34) goto L_021F8BE0; else goto L_021F8BE8;
   L_021F8BE0: ; // 0x21f8be0
@@ -1526,9 +1526,9 @@ void Gambit_fn_021F8AA8(CPUState* cpu) {
         /* 021F8BEC */ cpu->r[0] = rbrew_read32(cpu->mem, _t35);
         /* 021F8BEC */ cpu->r[11] = _t35;
         /* 021F8BF0 */ cpu->r[10] = 0x101D0000u;
-        /* 021F8BF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021F8BF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021F8BF8 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021F8BFC */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8BFC */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8BFC */ _t37 = _t36 & 0x00000001u;
         /* 021F8BFC */ if (_t37) goto L_021F8C00; else goto L_021F8C14;
   L_021F8C00: ; // 0x21f8c00
@@ -1540,8 +1540,8 @@ void Gambit_fn_021F8AA8(CPUState* cpu) {
         /* 021F8C10 */ _t39 = cpu->r[10] + 0x00000000u;
         /* 021F8C10 */ rbrew_write32(cpu->mem, _t39, cpu->r[0]);
   L_021F8C14: ; // 0x21f8c14
-        /* 021F8C14 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021F8C18 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8C14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021F8C18 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8C18 */ _t41 = _t40 & 0x00000001u;
         /* 021F8C18 */ if (_t41) goto L_021F8C1C; else goto L_021F8C24;
   L_021F8C1C: ; // 0x21f8c1c
@@ -1553,9 +1553,9 @@ void Gambit_fn_021F8AA8(CPUState* cpu) {
         /* 021F8C28 */ cpu->r[9] = rbrew_read32(cpu->mem, _t42);
         /* 021F8C28 */ cpu->r[10] = _t42;
         /* 021F8C2C */ cpu->r[11] = 0x101D0000u;
-        /* 021F8C30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F8C30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F8C34 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021F8C38 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8C38 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8C38 */ _t44 = _t43 & 0x00000001u;
         /* 021F8C38 */ if (_t44) goto L_021F8C3C; else goto L_021F8C50;
   L_021F8C3C: ; // 0x21f8c3c
@@ -1603,9 +1603,9 @@ void Gambit_fn_021F8C80(CPUState* cpu) {
         /* 021F8C84 */ _t0 = cpu->r[7] + 0xFFFFFC24u;
         /* 021F8C84 */ cpu->r[7] = rbrew_read32(cpu->mem, _t0);
         /* 021F8C88 */ cpu->r[8] = 0x101D0000u;
-        /* 021F8C8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021F8C8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021F8C90 */ cpu->r[8] = cpu->r[8] + 0xFFFFFDECu;
-        /* 021F8C94 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8C94 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8C94 */ _t2 = _t1 & 0x00000001u;
         /* 021F8C94 */ if (_t2) goto L_021F8C98; else goto L_021F8CB0;
   L_021F8C98: ; // 0x21f8c98
@@ -1618,8 +1618,8 @@ void Gambit_fn_021F8C80(CPUState* cpu) {
         /* 021F8CAC */ _t4 = cpu->r[8] + 0x00000000u;
         /* 021F8CAC */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_021F8CB0: ; // 0x21f8cb0
-        /* 021F8CB0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F8CB4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8CB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F8CB4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8CB4 */ _t6 = _t5 & 0x00000001u;
         /* 021F8CB4 */ if (_t6) goto L_021F8CB8; else goto L_021F8CC0;
   L_021F8CB8: ; // 0x21f8cb8
@@ -1630,9 +1630,9 @@ void Gambit_fn_021F8C80(CPUState* cpu) {
         /* 021F8CC4 */ _t7 = cpu->r[8] + 0xFFFFFC10u;
         /* 021F8CC4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 021F8CC8 */ cpu->r[11] = 0x101D0000u;
-        /* 021F8CCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021F8CCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021F8CD0 */ cpu->r[11] = cpu->r[11] + 0xFFFFFC14u;
-        /* 021F8CD4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8CD4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8CD4 */ _t9 = _t8 & 0x00000001u;
         /* 021F8CD4 */ if (_t9) goto L_021F8CD8; else goto L_021F8CF0;
   L_021F8CD8: ; // 0x21f8cd8
@@ -1645,8 +1645,8 @@ void Gambit_fn_021F8C80(CPUState* cpu) {
         /* 021F8CEC */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021F8CEC */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021F8CF0: ; // 0x21f8cf0
-        /* 021F8CF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021F8CF4 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8CF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021F8CF4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8CF4 */ _t13 = _t12 & 0x00000001u;
         /* 021F8CF4 */ if (_t13) goto L_021F8CF8; else goto L_021F8D00;
   L_021F8CF8: ; // 0x21f8cf8
@@ -1657,9 +1657,9 @@ void Gambit_fn_021F8C80(CPUState* cpu) {
         /* 021F8D04 */ _t14 = cpu->r[9] + 0xFFFFE5E8u;
         /* 021F8D04 */ cpu->r[9] = rbrew_read32(cpu->mem, _t14);
         /* 021F8D08 */ cpu->r[8] = 0x101D0000u;
-        /* 021F8D0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F8D0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F8D10 */ cpu->r[8] = cpu->r[8] + 0xFFFFFC0Cu;
-        /* 021F8D14 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8D14 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8D14 */ _t16 = _t15 & 0x00000001u;
         /* 021F8D14 */ if (_t16) goto L_021F8D18; else goto L_021F8D30;
   L_021F8D18: ; // 0x21f8d18
@@ -1672,8 +1672,8 @@ void Gambit_fn_021F8C80(CPUState* cpu) {
         /* 021F8D2C */ _t18 = cpu->r[8] + 0x00000000u;
         /* 021F8D2C */ rbrew_write32(cpu->mem, _t18, cpu->r[10]);
   L_021F8D30: ; // 0x21f8d30
-        /* 021F8D30 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F8D34 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8D30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F8D34 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8D34 */ _t20 = _t19 & 0x00000001u;
         /* 021F8D34 */ if (_t20) goto L_021F8D38; else goto L_021F8D40;
   L_021F8D38: ; // 0x21f8d38
@@ -1684,9 +1684,9 @@ void Gambit_fn_021F8C80(CPUState* cpu) {
         /* 021F8D44 */ _t21 = cpu->r[11] + 0xFFFFDA00u;
         /* 021F8D44 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021F8D48 */ cpu->r[8] = 0x101D0000u;
-        /* 021F8D4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021F8D4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021F8D50 */ cpu->r[8] = cpu->r[8] + 0xFFFFFBFCu;
-        /* 021F8D54 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8D54 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8D54 */ _t23 = _t22 & 0x00000001u;
         /* 021F8D54 */ if (_t23) goto L_021F8D58; else goto L_021F8D70;
   L_021F8D58: ; // 0x21f8d58
@@ -1699,8 +1699,8 @@ void Gambit_fn_021F8C80(CPUState* cpu) {
         /* 021F8D6C */ _t25 = cpu->r[8] + 0x00000000u;
         /* 021F8D6C */ rbrew_write32(cpu->mem, _t25, cpu->r[9]);
   L_021F8D70: ; // 0x21f8d70
-        /* 021F8D70 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021F8D74 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8D70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021F8D74 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8D74 */ _t27 = _t26 & 0x00000001u;
         /* 021F8D74 */ if (_t27) goto L_021F8D78; else goto L_021F8D80;
   L_021F8D78: ; // 0x21f8d78
@@ -1711,9 +1711,9 @@ void Gambit_fn_021F8C80(CPUState* cpu) {
         /* 021F8D84 */ _t28 = cpu->r[10] + 0xFFFFD9ECu;
         /* 021F8D84 */ cpu->r[10] = rbrew_read32(cpu->mem, _t28);
         /* 021F8D88 */ cpu->r[11] = 0x101D0000u;
-        /* 021F8D8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021F8D8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021F8D90 */ cpu->r[11] = cpu->r[11] + 0xFFFFFB4Cu;
-        /* 021F8D94 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8D94 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8D94 */ _t30 = _t29 & 0x00000001u;
         /* 021F8D94 */ if (_t30) goto L_021F8D98; else goto L_021F8DB0;
   L_021F8D98: ; // 0x21f8d98
@@ -1726,8 +1726,8 @@ void Gambit_fn_021F8C80(CPUState* cpu) {
         /* 021F8DAC */ _t32 = cpu->r[11] + 0x00000000u;
         /* 021F8DAC */ rbrew_write32(cpu->mem, _t32, cpu->r[7]);
   L_021F8DB0: ; // 0x21f8db0
-        /* 021F8DB0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021F8DB4 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8DB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021F8DB4 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8DB4 */ _t34 = _t33 & 0x00000001u;
         /* 021F8DB4 */ if (_t34) goto L_021F8DB8; else goto L_021F8DC0;
   L_021F8DB8: ; // 0x21f8db8
@@ -1739,9 +1739,9 @@ void Gambit_fn_021F8C80(CPUState* cpu) {
         /* 021F8DC4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t35);
         /* 021F8DC4 */ cpu->r[11] = _t35;
         /* 021F8DC8 */ cpu->r[10] = 0x101D0000u;
-        /* 021F8DCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021F8DCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021F8DD0 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021F8DD4 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8DD4 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8DD4 */ _t37 = _t36 & 0x00000001u;
         /* 021F8DD4 */ if (_t37) goto L_021F8DD8; else goto L_021F8DEC;
   L_021F8DD8: ; // 0x21f8dd8
@@ -1753,8 +1753,8 @@ void Gambit_fn_021F8C80(CPUState* cpu) {
         /* 021F8DE8 */ _t39 = cpu->r[10] + 0x00000000u;
         /* 021F8DE8 */ rbrew_write32(cpu->mem, _t39, cpu->r[0]);
   L_021F8DEC: ; // 0x21f8dec
-        /* 021F8DEC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021F8DF0 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8DEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021F8DF0 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8DF0 */ _t41 = _t40 & 0x00000001u;
         /* 021F8DF0 */ if (_t41) goto L_021F8DF4; else goto L_021F8DFC;
   L_021F8DF4: ; // 0x21f8df4
@@ -1766,9 +1766,9 @@ void Gambit_fn_021F8C80(CPUState* cpu) {
         /* 021F8E00 */ cpu->r[9] = rbrew_read32(cpu->mem, _t42);
         /* 021F8E00 */ cpu->r[10] = _t42;
         /* 021F8E04 */ cpu->r[11] = 0x101D0000u;
-        /* 021F8E08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021F8E08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021F8E0C */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021F8E10 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021F8E10 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021F8E10 */ _t44 = _t43 & 0x00000001u;
         /* 021F8E10 */ if (_t44) goto L_021F8E14; else goto L_021F8E28;
   L_021F8E14: ; // 0x21f8e14
@@ -8260,10 +8260,10 @@ void Gambit_fn_021FB24C(CPUState* cpu) {
         /* 021FB254 */ _t1 = cpu->r[3] + 0x00000020u;
         /* 021FB254 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 021FB258 */ cpu->r[8] = cpu->r[0];
-        /* 021FB25C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021FB25C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021FB260 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 021FB260 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021FB264 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB264 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB264 */ _t4 = _t3 & 0x00000001u;
         /* 021FB264 */ if (_t4) goto L_021FB268; else goto L_021FB280;
   L_021FB268: ; // 0x21fb268
@@ -8271,8 +8271,8 @@ void Gambit_fn_021FB24C(CPUState* cpu) {
         /* 021FB26C */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 021FB270 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021FB270 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021FB274 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FB278 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB274 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FB278 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB278 */ _t7 = _t6 & 0x00000001u;
         /* 021FB278 */ if (_t7) goto L_021FB27C; else goto L_021FB28C;
   L_021FB27C: ; // 0x21fb27c
@@ -8280,16 +8280,16 @@ void Gambit_fn_021FB24C(CPUState* cpu) {
   L_021FB280: ; // 0x21fb280
         /* 021FB280 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021FB280 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021FB284 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FB288 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB284 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FB288 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB288 */ _t10 = _t9 & 0x00000001u;
         /* 021FB288 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021FB288 */ goto L_021FB28C;
   L_021FB28C: ; // 0x21fb28c
-        /* 021FB28C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 021FB28C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 021FB290 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021FB290 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 021FB294 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB294 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB294 */ _t13 = _t12 & 0x00000001u;
         /* 021FB294 */ if (_t13) goto L_021FB298; else goto L_021FB2A0;
   L_021FB298: ; // 0x21fb298
@@ -8300,11 +8300,11 @@ void Gambit_fn_021FB24C(CPUState* cpu) {
         /* 021FB2A0 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021FB2A4 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021FB2A4 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021FB2A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FB2A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FB2AC */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021FB2AC */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021FB2B0 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 021FB2B4 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB2B4 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB2B4 */ _t18 = _t17 & 0x00000001u;
         /* 021FB2B4 */ if (_t18) goto L_021FB2CC; else goto L_021FB2B8;
   L_021FB2B8: ; // 0x21fb2b8
@@ -8331,10 +8331,10 @@ void Gambit_fn_021FB2D4(CPUState* cpu) {
         /* 021FB2DC */ _t1 = cpu->r[3] + 0x00000028u;
         /* 021FB2DC */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 021FB2E0 */ cpu->r[8] = cpu->r[0];
-        /* 021FB2E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021FB2E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021FB2E8 */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 021FB2E8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021FB2EC */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB2EC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB2EC */ _t4 = _t3 & 0x00000001u;
         /* 021FB2EC */ if (_t4) goto L_021FB2F0; else goto L_021FB308;
   L_021FB2F0: ; // 0x21fb2f0
@@ -8342,8 +8342,8 @@ void Gambit_fn_021FB2D4(CPUState* cpu) {
         /* 021FB2F4 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 021FB2F8 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021FB2F8 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021FB2FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FB300 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB2FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FB300 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB300 */ _t7 = _t6 & 0x00000001u;
         /* 021FB300 */ if (_t7) goto L_021FB304; else goto L_021FB314;
   L_021FB304: ; // 0x21fb304
@@ -8351,16 +8351,16 @@ void Gambit_fn_021FB2D4(CPUState* cpu) {
   L_021FB308: ; // 0x21fb308
         /* 021FB308 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021FB308 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021FB30C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FB310 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB30C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FB310 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB310 */ _t10 = _t9 & 0x00000001u;
         /* 021FB310 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021FB310 */ goto L_021FB314;
   L_021FB314: ; // 0x21fb314
-        /* 021FB314 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 021FB314 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 021FB318 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021FB318 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 021FB31C */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB31C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB31C */ _t13 = _t12 & 0x00000001u;
         /* 021FB31C */ if (_t13) goto L_021FB320; else goto L_021FB328;
   L_021FB320: ; // 0x21fb320
@@ -8371,11 +8371,11 @@ void Gambit_fn_021FB2D4(CPUState* cpu) {
         /* 021FB328 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021FB32C */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021FB32C */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021FB330 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FB330 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FB334 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021FB334 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021FB338 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 021FB33C */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB33C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB33C */ _t18 = _t17 & 0x00000001u;
         /* 021FB33C */ if (_t18) goto L_021FB354; else goto L_021FB340;
   L_021FB340: ; // 0x21fb340
@@ -8408,18 +8408,18 @@ void Gambit_fn_021FB35C(CPUState* cpu) {
         /* 021FB370 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 021FB370 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 021FB374 */ cpu->r[12] = 0x00000000u;
-        /* 021FB378 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FB378 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FB37C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 021FB37C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 021FB380 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB380 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB380 */ _t6 = _t5 & 0x00000001u;
         /* 021FB380 */ if (_t6) goto L_021FB3A8; else goto L_021FB384;
   L_021FB384: ; // 0x21fb384
         /* 021FB384 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 021FB384 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 021FB388 */ /* nop */
-        /* 021FB38C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 021FB390 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB38C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 021FB390 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB390 */ _t9 = _t8 & 0x00000001u;
         /* 021FB390 */ if (_t9) goto L_021FB394; else goto L_021FB3A8;
   L_021FB394: ; // 0x21fb394
@@ -8460,18 +8460,18 @@ void Gambit_fn_021FB360(CPUState* cpu) {
         /* 021FB370 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 021FB370 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 021FB374 */ cpu->r[12] = 0x00000000u;
-        /* 021FB378 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FB378 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FB37C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 021FB37C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 021FB380 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB380 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB380 */ _t6 = _t5 & 0x00000001u;
         /* 021FB380 */ if (_t6) goto L_021FB3A8; else goto L_021FB384;
   L_021FB384: ; // 0x21fb384
         /* 021FB384 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 021FB384 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 021FB388 */ /* nop */
-        /* 021FB38C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 021FB390 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB38C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 021FB390 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB390 */ _t9 = _t8 & 0x00000001u;
         /* 021FB390 */ if (_t9) goto L_021FB394; else goto L_021FB3A8;
   L_021FB394: ; // 0x21fb394
@@ -8507,10 +8507,10 @@ void Gambit_fn_021FB3CC(CPUState* cpu) {
         /* 021FB3D4 */ _t1 = cpu->r[3] + 0x00000030u;
         /* 021FB3D4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 021FB3D8 */ cpu->r[7] = cpu->r[0];
-        /* 021FB3DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 021FB3DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 021FB3E0 */ _t2 = cpu->r[3] + 0x00000034u;
         /* 021FB3E0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021FB3E4 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB3E4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB3E4 */ _t4 = _t3 & 0x00000001u;
         /* 021FB3E4 */ if (_t4) goto L_021FB3E8; else goto L_021FB400;
   L_021FB3E8: ; // 0x21fb3e8
@@ -8518,8 +8518,8 @@ void Gambit_fn_021FB3CC(CPUState* cpu) {
         /* 021FB3EC */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 021FB3F0 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021FB3F0 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021FB3F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021FB3F8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB3F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021FB3F8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB3F8 */ _t7 = _t6 & 0x00000001u;
         /* 021FB3F8 */ if (_t7) goto L_021FB3FC; else goto L_021FB40C;
   L_021FB3FC: ; // 0x21fb3fc
@@ -8527,16 +8527,16 @@ void Gambit_fn_021FB3CC(CPUState* cpu) {
   L_021FB400: ; // 0x21fb400
         /* 021FB400 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021FB400 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021FB404 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021FB408 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB404 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021FB408 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB408 */ _t10 = _t9 & 0x00000001u;
         /* 021FB408 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021FB408 */ goto L_021FB40C;
   L_021FB40C: ; // 0x21fb40c
-        /* 021FB40C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 021FB40C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 021FB410 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021FB410 */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 021FB414 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB414 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB414 */ _t13 = _t12 & 0x00000001u;
         /* 021FB414 */ if (_t13) goto L_021FB418; else goto L_021FB420;
   L_021FB418: ; // 0x21fb418
@@ -8547,11 +8547,11 @@ void Gambit_fn_021FB3CC(CPUState* cpu) {
         /* 021FB420 */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021FB424 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021FB424 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021FB428 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021FB428 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021FB42C */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021FB42C */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021FB430 */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 021FB434 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB434 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB434 */ _t18 = _t17 & 0x00000001u;
         /* 021FB434 */ if (_t18) goto L_021FB44C; else goto L_021FB438;
   L_021FB438: ; // 0x21fb438
@@ -8586,9 +8586,9 @@ void Gambit_fn_021FB454(CPUState* cpu) {
         /* 021FB46C */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 021FB46C */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 021FB470 */ /* nop */
-        /* 021FB474 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 021FB474 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 021FB478 */ cpu->r[31] = cpu->r[4];
-        /* 021FB47C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB47C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB47C */ _t6 = _t5 & 0x00000001u;
         /* 021FB47C */ if (_t6) goto L_021FB480; else goto L_021FB494;
   L_021FB480: ; // 0x21fb480
@@ -8637,9 +8637,9 @@ void Gambit_fn_021FB458(CPUState* cpu) {
         /* 021FB46C */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 021FB46C */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 021FB470 */ /* nop */
-        /* 021FB474 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 021FB474 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 021FB478 */ cpu->r[31] = cpu->r[4];
-        /* 021FB47C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB47C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB47C */ _t6 = _t5 & 0x00000001u;
         /* 021FB47C */ if (_t6) goto L_021FB480; else goto L_021FB494;
   L_021FB480: ; // 0x21fb480
@@ -8681,10 +8681,10 @@ void Gambit_fn_021FB4CC(CPUState* cpu) {
         /* 021FB4D4 */ _t1 = cpu->r[3] + 0x00000020u;
         /* 021FB4D4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 021FB4D8 */ cpu->r[8] = cpu->r[0];
-        /* 021FB4DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021FB4DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021FB4E0 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 021FB4E0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021FB4E4 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB4E4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB4E4 */ _t4 = _t3 & 0x00000001u;
         /* 021FB4E4 */ if (_t4) goto L_021FB4E8; else goto L_021FB500;
   L_021FB4E8: ; // 0x21fb4e8
@@ -8692,8 +8692,8 @@ void Gambit_fn_021FB4CC(CPUState* cpu) {
         /* 021FB4EC */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 021FB4F0 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021FB4F0 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021FB4F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FB4F8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB4F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FB4F8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB4F8 */ _t7 = _t6 & 0x00000001u;
         /* 021FB4F8 */ if (_t7) goto L_021FB4FC; else goto L_021FB50C;
   L_021FB4FC: ; // 0x21fb4fc
@@ -8701,16 +8701,16 @@ void Gambit_fn_021FB4CC(CPUState* cpu) {
   L_021FB500: ; // 0x21fb500
         /* 021FB500 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021FB500 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021FB504 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FB508 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB504 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FB508 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB508 */ _t10 = _t9 & 0x00000001u;
         /* 021FB508 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021FB508 */ goto L_021FB50C;
   L_021FB50C: ; // 0x21fb50c
-        /* 021FB50C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 021FB50C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 021FB510 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021FB510 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 021FB514 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB514 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB514 */ _t13 = _t12 & 0x00000001u;
         /* 021FB514 */ if (_t13) goto L_021FB518; else goto L_021FB520;
   L_021FB518: ; // 0x21fb518
@@ -8721,11 +8721,11 @@ void Gambit_fn_021FB4CC(CPUState* cpu) {
         /* 021FB520 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021FB524 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021FB524 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021FB528 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FB528 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FB52C */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021FB52C */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021FB530 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 021FB534 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB534 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB534 */ _t18 = _t17 & 0x00000001u;
         /* 021FB534 */ if (_t18) goto L_021FB54C; else goto L_021FB538;
   L_021FB538: ; // 0x21fb538
@@ -8752,10 +8752,10 @@ void Gambit_fn_021FB554(CPUState* cpu) {
         /* 021FB55C */ _t1 = cpu->r[3] + 0x00000028u;
         /* 021FB55C */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 021FB560 */ cpu->r[8] = cpu->r[0];
-        /* 021FB564 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021FB564 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021FB568 */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 021FB568 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021FB56C */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB56C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB56C */ _t4 = _t3 & 0x00000001u;
         /* 021FB56C */ if (_t4) goto L_021FB570; else goto L_021FB588;
   L_021FB570: ; // 0x21fb570
@@ -8763,8 +8763,8 @@ void Gambit_fn_021FB554(CPUState* cpu) {
         /* 021FB574 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 021FB578 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021FB578 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021FB57C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FB580 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB57C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FB580 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB580 */ _t7 = _t6 & 0x00000001u;
         /* 021FB580 */ if (_t7) goto L_021FB584; else goto L_021FB594;
   L_021FB584: ; // 0x21fb584
@@ -8772,16 +8772,16 @@ void Gambit_fn_021FB554(CPUState* cpu) {
   L_021FB588: ; // 0x21fb588
         /* 021FB588 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021FB588 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021FB58C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FB590 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB58C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FB590 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB590 */ _t10 = _t9 & 0x00000001u;
         /* 021FB590 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021FB590 */ goto L_021FB594;
   L_021FB594: ; // 0x21fb594
-        /* 021FB594 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 021FB594 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 021FB598 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021FB598 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 021FB59C */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB59C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB59C */ _t13 = _t12 & 0x00000001u;
         /* 021FB59C */ if (_t13) goto L_021FB5A0; else goto L_021FB5A8;
   L_021FB5A0: ; // 0x21fb5a0
@@ -8792,11 +8792,11 @@ void Gambit_fn_021FB554(CPUState* cpu) {
         /* 021FB5A8 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021FB5AC */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021FB5AC */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021FB5B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FB5B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FB5B4 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021FB5B4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021FB5B8 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 021FB5BC */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB5BC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB5BC */ _t18 = _t17 & 0x00000001u;
         /* 021FB5BC */ if (_t18) goto L_021FB5D4; else goto L_021FB5C0;
   L_021FB5C0: ; // 0x21fb5c0
@@ -8829,18 +8829,18 @@ void Gambit_fn_021FB5DC(CPUState* cpu) {
         /* 021FB5F0 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 021FB5F0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 021FB5F4 */ cpu->r[12] = 0x00000000u;
-        /* 021FB5F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FB5F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FB5FC */ _t4 = cpu->r[31] + 0x00000011u;
         /* 021FB5FC */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 021FB600 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB600 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB600 */ _t6 = _t5 & 0x00000001u;
         /* 021FB600 */ if (_t6) goto L_021FB628; else goto L_021FB604;
   L_021FB604: ; // 0x21fb604
         /* 021FB604 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 021FB604 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 021FB608 */ /* nop */
-        /* 021FB60C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 021FB610 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB60C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 021FB610 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB610 */ _t9 = _t8 & 0x00000001u;
         /* 021FB610 */ if (_t9) goto L_021FB614; else goto L_021FB628;
   L_021FB614: ; // 0x21fb614
@@ -8881,18 +8881,18 @@ void Gambit_fn_021FB5E0(CPUState* cpu) {
         /* 021FB5F0 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 021FB5F0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 021FB5F4 */ cpu->r[12] = 0x00000000u;
-        /* 021FB5F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FB5F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FB5FC */ _t4 = cpu->r[31] + 0x00000011u;
         /* 021FB5FC */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 021FB600 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB600 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB600 */ _t6 = _t5 & 0x00000001u;
         /* 021FB600 */ if (_t6) goto L_021FB628; else goto L_021FB604;
   L_021FB604: ; // 0x21fb604
         /* 021FB604 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 021FB604 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 021FB608 */ /* nop */
-        /* 021FB60C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 021FB610 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB60C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 021FB610 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB610 */ _t9 = _t8 & 0x00000001u;
         /* 021FB610 */ if (_t9) goto L_021FB614; else goto L_021FB628;
   L_021FB614: ; // 0x21fb614
@@ -8928,10 +8928,10 @@ void Gambit_fn_021FB64C(CPUState* cpu) {
         /* 021FB654 */ _t1 = cpu->r[3] + 0x00000030u;
         /* 021FB654 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 021FB658 */ cpu->r[7] = cpu->r[0];
-        /* 021FB65C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 021FB65C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 021FB660 */ _t2 = cpu->r[3] + 0x00000034u;
         /* 021FB660 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021FB664 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB664 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB664 */ _t4 = _t3 & 0x00000001u;
         /* 021FB664 */ if (_t4) goto L_021FB668; else goto L_021FB680;
   L_021FB668: ; // 0x21fb668
@@ -8939,8 +8939,8 @@ void Gambit_fn_021FB64C(CPUState* cpu) {
         /* 021FB66C */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 021FB670 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021FB670 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021FB674 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021FB678 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB674 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021FB678 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB678 */ _t7 = _t6 & 0x00000001u;
         /* 021FB678 */ if (_t7) goto L_021FB67C; else goto L_021FB68C;
   L_021FB67C: ; // 0x21fb67c
@@ -8948,16 +8948,16 @@ void Gambit_fn_021FB64C(CPUState* cpu) {
   L_021FB680: ; // 0x21fb680
         /* 021FB680 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021FB680 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021FB684 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021FB688 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB684 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021FB688 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB688 */ _t10 = _t9 & 0x00000001u;
         /* 021FB688 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021FB688 */ goto L_021FB68C;
   L_021FB68C: ; // 0x21fb68c
-        /* 021FB68C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 021FB68C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 021FB690 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021FB690 */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 021FB694 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB694 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB694 */ _t13 = _t12 & 0x00000001u;
         /* 021FB694 */ if (_t13) goto L_021FB698; else goto L_021FB6A0;
   L_021FB698: ; // 0x21fb698
@@ -8968,11 +8968,11 @@ void Gambit_fn_021FB64C(CPUState* cpu) {
         /* 021FB6A0 */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021FB6A4 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021FB6A4 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021FB6A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021FB6A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021FB6AC */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021FB6AC */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021FB6B0 */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 021FB6B4 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB6B4 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB6B4 */ _t18 = _t17 & 0x00000001u;
         /* 021FB6B4 */ if (_t18) goto L_021FB6CC; else goto L_021FB6B8;
   L_021FB6B8: ; // 0x21fb6b8
@@ -9007,9 +9007,9 @@ void Gambit_fn_021FB6D4(CPUState* cpu) {
         /* 021FB6EC */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 021FB6EC */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 021FB6F0 */ /* nop */
-        /* 021FB6F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 021FB6F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 021FB6F8 */ cpu->r[31] = cpu->r[4];
-        /* 021FB6FC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB6FC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB6FC */ _t6 = _t5 & 0x00000001u;
         /* 021FB6FC */ if (_t6) goto L_021FB700; else goto L_021FB714;
   L_021FB700: ; // 0x21fb700
@@ -9058,9 +9058,9 @@ void Gambit_fn_021FB6D8(CPUState* cpu) {
         /* 021FB6EC */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 021FB6EC */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 021FB6F0 */ /* nop */
-        /* 021FB6F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 021FB6F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 021FB6F8 */ cpu->r[31] = cpu->r[4];
-        /* 021FB6FC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB6FC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB6FC */ _t6 = _t5 & 0x00000001u;
         /* 021FB6FC */ if (_t6) goto L_021FB700; else goto L_021FB714;
   L_021FB700: ; // 0x21fb700
@@ -9102,10 +9102,10 @@ void Gambit_fn_021FB74C(CPUState* cpu) {
         /* 021FB754 */ _t1 = cpu->r[3] + 0x00000020u;
         /* 021FB754 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 021FB758 */ cpu->r[8] = cpu->r[0];
-        /* 021FB75C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021FB75C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021FB760 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 021FB760 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021FB764 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB764 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB764 */ _t4 = _t3 & 0x00000001u;
         /* 021FB764 */ if (_t4) goto L_021FB768; else goto L_021FB780;
   L_021FB768: ; // 0x21fb768
@@ -9113,8 +9113,8 @@ void Gambit_fn_021FB74C(CPUState* cpu) {
         /* 021FB76C */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 021FB770 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021FB770 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021FB774 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FB778 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB774 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FB778 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB778 */ _t7 = _t6 & 0x00000001u;
         /* 021FB778 */ if (_t7) goto L_021FB77C; else goto L_021FB78C;
   L_021FB77C: ; // 0x21fb77c
@@ -9122,16 +9122,16 @@ void Gambit_fn_021FB74C(CPUState* cpu) {
   L_021FB780: ; // 0x21fb780
         /* 021FB780 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021FB780 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021FB784 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FB788 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB784 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FB788 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB788 */ _t10 = _t9 & 0x00000001u;
         /* 021FB788 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021FB788 */ goto L_021FB78C;
   L_021FB78C: ; // 0x21fb78c
-        /* 021FB78C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 021FB78C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 021FB790 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021FB790 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 021FB794 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB794 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB794 */ _t13 = _t12 & 0x00000001u;
         /* 021FB794 */ if (_t13) goto L_021FB798; else goto L_021FB7A0;
   L_021FB798: ; // 0x21fb798
@@ -9142,11 +9142,11 @@ void Gambit_fn_021FB74C(CPUState* cpu) {
         /* 021FB7A0 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021FB7A4 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021FB7A4 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021FB7A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FB7A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FB7AC */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021FB7AC */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021FB7B0 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 021FB7B4 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB7B4 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB7B4 */ _t18 = _t17 & 0x00000001u;
         /* 021FB7B4 */ if (_t18) goto L_021FB7CC; else goto L_021FB7B8;
   L_021FB7B8: ; // 0x21fb7b8
@@ -9173,10 +9173,10 @@ void Gambit_fn_021FB7D4(CPUState* cpu) {
         /* 021FB7DC */ _t1 = cpu->r[3] + 0x00000028u;
         /* 021FB7DC */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 021FB7E0 */ cpu->r[8] = cpu->r[0];
-        /* 021FB7E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021FB7E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021FB7E8 */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 021FB7E8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021FB7EC */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB7EC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB7EC */ _t4 = _t3 & 0x00000001u;
         /* 021FB7EC */ if (_t4) goto L_021FB7F0; else goto L_021FB808;
   L_021FB7F0: ; // 0x21fb7f0
@@ -9184,8 +9184,8 @@ void Gambit_fn_021FB7D4(CPUState* cpu) {
         /* 021FB7F4 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 021FB7F8 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021FB7F8 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021FB7FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FB800 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB7FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FB800 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB800 */ _t7 = _t6 & 0x00000001u;
         /* 021FB800 */ if (_t7) goto L_021FB804; else goto L_021FB814;
   L_021FB804: ; // 0x21fb804
@@ -9193,16 +9193,16 @@ void Gambit_fn_021FB7D4(CPUState* cpu) {
   L_021FB808: ; // 0x21fb808
         /* 021FB808 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021FB808 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021FB80C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FB810 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB80C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FB810 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB810 */ _t10 = _t9 & 0x00000001u;
         /* 021FB810 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021FB810 */ goto L_021FB814;
   L_021FB814: ; // 0x21fb814
-        /* 021FB814 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 021FB814 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 021FB818 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021FB818 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 021FB81C */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB81C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB81C */ _t13 = _t12 & 0x00000001u;
         /* 021FB81C */ if (_t13) goto L_021FB820; else goto L_021FB828;
   L_021FB820: ; // 0x21fb820
@@ -9213,11 +9213,11 @@ void Gambit_fn_021FB7D4(CPUState* cpu) {
         /* 021FB828 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021FB82C */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021FB82C */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021FB830 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FB830 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FB834 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021FB834 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021FB838 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 021FB83C */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB83C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB83C */ _t18 = _t17 & 0x00000001u;
         /* 021FB83C */ if (_t18) goto L_021FB854; else goto L_021FB840;
   L_021FB840: ; // 0x21fb840
@@ -9250,18 +9250,18 @@ void Gambit_fn_021FB85C(CPUState* cpu) {
         /* 021FB870 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 021FB870 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 021FB874 */ cpu->r[12] = 0x00000000u;
-        /* 021FB878 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FB878 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FB87C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 021FB87C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 021FB880 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB880 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB880 */ _t6 = _t5 & 0x00000001u;
         /* 021FB880 */ if (_t6) goto L_021FB8A8; else goto L_021FB884;
   L_021FB884: ; // 0x21fb884
         /* 021FB884 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 021FB884 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 021FB888 */ /* nop */
-        /* 021FB88C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 021FB890 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB88C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 021FB890 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB890 */ _t9 = _t8 & 0x00000001u;
         /* 021FB890 */ if (_t9) goto L_021FB894; else goto L_021FB8A8;
   L_021FB894: ; // 0x21fb894
@@ -9302,18 +9302,18 @@ void Gambit_fn_021FB860(CPUState* cpu) {
         /* 021FB870 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 021FB870 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 021FB874 */ cpu->r[12] = 0x00000000u;
-        /* 021FB878 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FB878 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FB87C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 021FB87C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 021FB880 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB880 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB880 */ _t6 = _t5 & 0x00000001u;
         /* 021FB880 */ if (_t6) goto L_021FB8A8; else goto L_021FB884;
   L_021FB884: ; // 0x21fb884
         /* 021FB884 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 021FB884 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 021FB888 */ /* nop */
-        /* 021FB88C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 021FB890 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB88C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 021FB890 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB890 */ _t9 = _t8 & 0x00000001u;
         /* 021FB890 */ if (_t9) goto L_021FB894; else goto L_021FB8A8;
   L_021FB894: ; // 0x21fb894
@@ -9349,10 +9349,10 @@ void Gambit_fn_021FB8CC(CPUState* cpu) {
         /* 021FB8D4 */ _t1 = cpu->r[3] + 0x00000030u;
         /* 021FB8D4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 021FB8D8 */ cpu->r[7] = cpu->r[0];
-        /* 021FB8DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 021FB8DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 021FB8E0 */ _t2 = cpu->r[3] + 0x00000034u;
         /* 021FB8E0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021FB8E4 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB8E4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB8E4 */ _t4 = _t3 & 0x00000001u;
         /* 021FB8E4 */ if (_t4) goto L_021FB8E8; else goto L_021FB900;
   L_021FB8E8: ; // 0x21fb8e8
@@ -9360,8 +9360,8 @@ void Gambit_fn_021FB8CC(CPUState* cpu) {
         /* 021FB8EC */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 021FB8F0 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021FB8F0 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021FB8F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021FB8F8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB8F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021FB8F8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB8F8 */ _t7 = _t6 & 0x00000001u;
         /* 021FB8F8 */ if (_t7) goto L_021FB8FC; else goto L_021FB90C;
   L_021FB8FC: ; // 0x21fb8fc
@@ -9369,16 +9369,16 @@ void Gambit_fn_021FB8CC(CPUState* cpu) {
   L_021FB900: ; // 0x21fb900
         /* 021FB900 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021FB900 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021FB904 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021FB908 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB904 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021FB908 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB908 */ _t10 = _t9 & 0x00000001u;
         /* 021FB908 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021FB908 */ goto L_021FB90C;
   L_021FB90C: ; // 0x21fb90c
-        /* 021FB90C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 021FB90C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 021FB910 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021FB910 */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 021FB914 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB914 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB914 */ _t13 = _t12 & 0x00000001u;
         /* 021FB914 */ if (_t13) goto L_021FB918; else goto L_021FB920;
   L_021FB918: ; // 0x21fb918
@@ -9389,11 +9389,11 @@ void Gambit_fn_021FB8CC(CPUState* cpu) {
         /* 021FB920 */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021FB924 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021FB924 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021FB928 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021FB928 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021FB92C */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021FB92C */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021FB930 */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 021FB934 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB934 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB934 */ _t18 = _t17 & 0x00000001u;
         /* 021FB934 */ if (_t18) goto L_021FB94C; else goto L_021FB938;
   L_021FB938: ; // 0x21fb938
@@ -9428,9 +9428,9 @@ void Gambit_fn_021FB954(CPUState* cpu) {
         /* 021FB96C */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 021FB96C */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 021FB970 */ /* nop */
-        /* 021FB974 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 021FB974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 021FB978 */ cpu->r[31] = cpu->r[4];
-        /* 021FB97C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB97C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB97C */ _t6 = _t5 & 0x00000001u;
         /* 021FB97C */ if (_t6) goto L_021FB980; else goto L_021FB994;
   L_021FB980: ; // 0x21fb980
@@ -9479,9 +9479,9 @@ void Gambit_fn_021FB958(CPUState* cpu) {
         /* 021FB96C */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 021FB96C */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 021FB970 */ /* nop */
-        /* 021FB974 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 021FB974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 021FB978 */ cpu->r[31] = cpu->r[4];
-        /* 021FB97C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB97C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB97C */ _t6 = _t5 & 0x00000001u;
         /* 021FB97C */ if (_t6) goto L_021FB980; else goto L_021FB994;
   L_021FB980: ; // 0x21fb980
@@ -9523,10 +9523,10 @@ void Gambit_fn_021FB9CC(CPUState* cpu) {
         /* 021FB9D4 */ _t1 = cpu->r[3] + 0x00000020u;
         /* 021FB9D4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 021FB9D8 */ cpu->r[8] = cpu->r[0];
-        /* 021FB9DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021FB9DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021FB9E0 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 021FB9E0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021FB9E4 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FB9E4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FB9E4 */ _t4 = _t3 & 0x00000001u;
         /* 021FB9E4 */ if (_t4) goto L_021FB9E8; else goto L_021FBA00;
   L_021FB9E8: ; // 0x21fb9e8
@@ -9534,8 +9534,8 @@ void Gambit_fn_021FB9CC(CPUState* cpu) {
         /* 021FB9EC */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 021FB9F0 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021FB9F0 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021FB9F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FB9F8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FB9F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FB9F8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FB9F8 */ _t7 = _t6 & 0x00000001u;
         /* 021FB9F8 */ if (_t7) goto L_021FB9FC; else goto L_021FBA0C;
   L_021FB9FC: ; // 0x21fb9fc
@@ -9543,16 +9543,16 @@ void Gambit_fn_021FB9CC(CPUState* cpu) {
   L_021FBA00: ; // 0x21fba00
         /* 021FBA00 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021FBA00 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021FBA04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FBA08 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FBA04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FBA08 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FBA08 */ _t10 = _t9 & 0x00000001u;
         /* 021FBA08 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021FBA08 */ goto L_021FBA0C;
   L_021FBA0C: ; // 0x21fba0c
-        /* 021FBA0C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 021FBA0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 021FBA10 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021FBA10 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 021FBA14 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FBA14 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FBA14 */ _t13 = _t12 & 0x00000001u;
         /* 021FBA14 */ if (_t13) goto L_021FBA18; else goto L_021FBA20;
   L_021FBA18: ; // 0x21fba18
@@ -9563,11 +9563,11 @@ void Gambit_fn_021FB9CC(CPUState* cpu) {
         /* 021FBA20 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021FBA24 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021FBA24 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021FBA28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FBA28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FBA2C */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021FBA2C */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021FBA30 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 021FBA34 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FBA34 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FBA34 */ _t18 = _t17 & 0x00000001u;
         /* 021FBA34 */ if (_t18) goto L_021FBA4C; else goto L_021FBA38;
   L_021FBA38: ; // 0x21fba38
@@ -9594,10 +9594,10 @@ void Gambit_fn_021FBA54(CPUState* cpu) {
         /* 021FBA5C */ _t1 = cpu->r[3] + 0x00000028u;
         /* 021FBA5C */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 021FBA60 */ cpu->r[8] = cpu->r[0];
-        /* 021FBA64 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021FBA64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021FBA68 */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 021FBA68 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021FBA6C */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FBA6C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FBA6C */ _t4 = _t3 & 0x00000001u;
         /* 021FBA6C */ if (_t4) goto L_021FBA70; else goto L_021FBA88;
   L_021FBA70: ; // 0x21fba70
@@ -9605,8 +9605,8 @@ void Gambit_fn_021FBA54(CPUState* cpu) {
         /* 021FBA74 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 021FBA78 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021FBA78 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021FBA7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FBA80 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FBA7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FBA80 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FBA80 */ _t7 = _t6 & 0x00000001u;
         /* 021FBA80 */ if (_t7) goto L_021FBA84; else goto L_021FBA94;
   L_021FBA84: ; // 0x21fba84
@@ -9614,16 +9614,16 @@ void Gambit_fn_021FBA54(CPUState* cpu) {
   L_021FBA88: ; // 0x21fba88
         /* 021FBA88 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021FBA88 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021FBA8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FBA90 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FBA8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FBA90 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FBA90 */ _t10 = _t9 & 0x00000001u;
         /* 021FBA90 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021FBA90 */ goto L_021FBA94;
   L_021FBA94: ; // 0x21fba94
-        /* 021FBA94 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 021FBA94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 021FBA98 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021FBA98 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 021FBA9C */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FBA9C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FBA9C */ _t13 = _t12 & 0x00000001u;
         /* 021FBA9C */ if (_t13) goto L_021FBAA0; else goto L_021FBAA8;
   L_021FBAA0: ; // 0x21fbaa0
@@ -9634,11 +9634,11 @@ void Gambit_fn_021FBA54(CPUState* cpu) {
         /* 021FBAA8 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021FBAAC */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021FBAAC */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021FBAB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FBAB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FBAB4 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021FBAB4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021FBAB8 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 021FBABC */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FBABC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FBABC */ _t18 = _t17 & 0x00000001u;
         /* 021FBABC */ if (_t18) goto L_021FBAD4; else goto L_021FBAC0;
   L_021FBAC0: ; // 0x21fbac0
@@ -9671,18 +9671,18 @@ void Gambit_fn_021FBADC(CPUState* cpu) {
         /* 021FBAF0 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 021FBAF0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 021FBAF4 */ cpu->r[12] = 0x00000000u;
-        /* 021FBAF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FBAF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FBAFC */ _t4 = cpu->r[31] + 0x00000011u;
         /* 021FBAFC */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 021FBB00 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FBB00 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FBB00 */ _t6 = _t5 & 0x00000001u;
         /* 021FBB00 */ if (_t6) goto L_021FBB28; else goto L_021FBB04;
   L_021FBB04: ; // 0x21fbb04
         /* 021FBB04 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 021FBB04 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 021FBB08 */ /* nop */
-        /* 021FBB0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 021FBB10 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FBB0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 021FBB10 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FBB10 */ _t9 = _t8 & 0x00000001u;
         /* 021FBB10 */ if (_t9) goto L_021FBB14; else goto L_021FBB28;
   L_021FBB14: ; // 0x21fbb14
@@ -9723,18 +9723,18 @@ void Gambit_fn_021FBAE0(CPUState* cpu) {
         /* 021FBAF0 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 021FBAF0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 021FBAF4 */ cpu->r[12] = 0x00000000u;
-        /* 021FBAF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FBAF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FBAFC */ _t4 = cpu->r[31] + 0x00000011u;
         /* 021FBAFC */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 021FBB00 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FBB00 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FBB00 */ _t6 = _t5 & 0x00000001u;
         /* 021FBB00 */ if (_t6) goto L_021FBB28; else goto L_021FBB04;
   L_021FBB04: ; // 0x21fbb04
         /* 021FBB04 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 021FBB04 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 021FBB08 */ /* nop */
-        /* 021FBB0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 021FBB10 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FBB0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 021FBB10 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FBB10 */ _t9 = _t8 & 0x00000001u;
         /* 021FBB10 */ if (_t9) goto L_021FBB14; else goto L_021FBB28;
   L_021FBB14: ; // 0x21fbb14
@@ -9770,10 +9770,10 @@ void Gambit_fn_021FBB4C(CPUState* cpu) {
         /* 021FBB54 */ _t1 = cpu->r[3] + 0x00000030u;
         /* 021FBB54 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 021FBB58 */ cpu->r[7] = cpu->r[0];
-        /* 021FBB5C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 021FBB5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 021FBB60 */ _t2 = cpu->r[3] + 0x00000034u;
         /* 021FBB60 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021FBB64 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FBB64 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FBB64 */ _t4 = _t3 & 0x00000001u;
         /* 021FBB64 */ if (_t4) goto L_021FBB68; else goto L_021FBB80;
   L_021FBB68: ; // 0x21fbb68
@@ -9781,8 +9781,8 @@ void Gambit_fn_021FBB4C(CPUState* cpu) {
         /* 021FBB6C */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 021FBB70 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021FBB70 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021FBB74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021FBB78 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FBB74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021FBB78 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FBB78 */ _t7 = _t6 & 0x00000001u;
         /* 021FBB78 */ if (_t7) goto L_021FBB7C; else goto L_021FBB8C;
   L_021FBB7C: ; // 0x21fbb7c
@@ -9790,16 +9790,16 @@ void Gambit_fn_021FBB4C(CPUState* cpu) {
   L_021FBB80: ; // 0x21fbb80
         /* 021FBB80 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021FBB80 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021FBB84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021FBB88 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FBB84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021FBB88 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FBB88 */ _t10 = _t9 & 0x00000001u;
         /* 021FBB88 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021FBB88 */ goto L_021FBB8C;
   L_021FBB8C: ; // 0x21fbb8c
-        /* 021FBB8C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 021FBB8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 021FBB90 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021FBB90 */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 021FBB94 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FBB94 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FBB94 */ _t13 = _t12 & 0x00000001u;
         /* 021FBB94 */ if (_t13) goto L_021FBB98; else goto L_021FBBA0;
   L_021FBB98: ; // 0x21fbb98
@@ -9810,11 +9810,11 @@ void Gambit_fn_021FBB4C(CPUState* cpu) {
         /* 021FBBA0 */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021FBBA4 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021FBBA4 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021FBBA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021FBBA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021FBBAC */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021FBBAC */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021FBBB0 */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 021FBBB4 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FBBB4 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FBBB4 */ _t18 = _t17 & 0x00000001u;
         /* 021FBBB4 */ if (_t18) goto L_021FBBCC; else goto L_021FBBB8;
   L_021FBBB8: ; // 0x21fbbb8
@@ -9849,9 +9849,9 @@ void Gambit_fn_021FBBD4(CPUState* cpu) {
         /* 021FBBEC */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 021FBBEC */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 021FBBF0 */ /* nop */
-        /* 021FBBF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 021FBBF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 021FBBF8 */ cpu->r[31] = cpu->r[4];
-        /* 021FBBFC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FBBFC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FBBFC */ _t6 = _t5 & 0x00000001u;
         /* 021FBBFC */ if (_t6) goto L_021FBC00; else goto L_021FBC14;
   L_021FBC00: ; // 0x21fbc00
@@ -9900,9 +9900,9 @@ void Gambit_fn_021FBBD8(CPUState* cpu) {
         /* 021FBBEC */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 021FBBEC */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 021FBBF0 */ /* nop */
-        /* 021FBBF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 021FBBF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 021FBBF8 */ cpu->r[31] = cpu->r[4];
-        /* 021FBBFC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FBBFC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FBBFC */ _t6 = _t5 & 0x00000001u;
         /* 021FBBFC */ if (_t6) goto L_021FBC00; else goto L_021FBC14;
   L_021FBC00: ; // 0x21fbc00
@@ -9944,18 +9944,18 @@ void Gambit_fn_021FBC50(CPUState* cpu) {
         /* 021FBC54 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021FBC54 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021FBC58 */ cpu->r[31] = cpu->r[3];
-        /* 021FBC58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021FBC58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021FBC5C */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021FBC5C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021FBC60 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FBC60 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FBC60 */ _t4 = _t3 & 0x00000001u;
         /* 021FBC60 */ if (_t4) goto L_021FBC64; else goto L_021FBC74;
   L_021FBC64: ; // 0x21fbc64
         /* 021FBC64 */ cpu->r[3] = 0x00000194u;
         /* 021FBC68 */ Gambit_fn_02801A78(cpu);
         /* 021FBC6C */ cpu->r[31] = cpu->r[3];
-        /* 021FBC6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021FBC70 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FBC6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021FBC70 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FBC70 */ _t6 = _t5 & 0x00000001u;
         /* 021FBC70 */ if (_t6) goto L_021FBC88; else goto L_021FBC74;
   L_021FBC74: ; // 0x21fbc74
@@ -10051,10 +10051,10 @@ void Gambit_fn_021FBCA4(CPUState* cpu) {
         /* 021FD73C */ cpu->r[0] = 0x00000000u;
         /* 021FD740 */ _t16 = cpu->r[1] + 0x00000050u;
         /* 021FD740 */ rbrew_write32(cpu->mem, _t16, cpu->r[6]);
-        /* 021FD744 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021FD744 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021FD748 */ _t17 = cpu->r[29] + 0x00000190u;
         /* 021FD748 */ rbrew_write32(cpu->mem, _t17, cpu->r[0]);
-        /* 021FD74C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD74C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD74C */ _t19 = _t18 & 0x00000001u;
         /* 021FD74C */ if (_t19) goto L_021FD750; else goto L_021FD794;
   L_021FD750: ; // 0x21fd750
@@ -10179,13 +10179,13 @@ void Gambit_fn_021FBCB8(CPUState* cpu) {
         /* 021FBD08 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021FBD0C */ _t11 = cpu->r[29] + 0x00000052u;
         /* 021FBD0C */ cpu->r[12] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t11);
-        /* 021FBD10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[3]);
-        /* 021FBD14 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FBD10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[3]));
+        /* 021FBD14 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FBD14 */ _t13 = _t12 & 0x00000001u;
         /* 021FBD14 */ if (_t13) goto L_021FBD20; else goto L_021FBD18;
   L_021FBD18: ; // 0x21fbd18
-        /* 021FBD18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FBD1C */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FBD18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FBD1C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FBD1C */ _t15 = _t14 & 0x00000001u;
         /* 021FBD1C */ if (_t15) goto L_021FBD20; else goto L_021FBE10;
   L_021FBD20: ; // 0x21fbd20
@@ -10197,11 +10197,11 @@ void Gambit_fn_021FBCB8(CPUState* cpu) {
         /* 021FBD30 */ cpu->f[3] = cpu->f[1];
         /* 021FBD34 */ _t17 = cpu->r[11] + 0x00001EF8u;
         /* 021FBD34 */ cpu->r[3] = rbrew_read32(cpu->mem, _t17);
-        /* 021FBD38 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[0]);
+        /* 021FBD38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[0]));
         /* 021FBD3C */ _t18 = cpu->r[29] + 0x000000B4u;
         /* 021FBD3C */ cpu->r[9] = rbrew_read32(cpu->mem, _t18);
         /* 021FBD40 */ cpu->r[4] = cpu->r[30];
-        /* 021FBD44 */ _t19 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FBD44 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FBD44 */ _t20 = _t19 & 0x00000001u;
         /* 021FBD44 */ if (_t20) goto L_021FBDAC; else goto L_021FBD48;
   L_021FBD48: ; // 0x21fbd48
@@ -10234,7 +10234,7 @@ void Gambit_fn_021FBCB8(CPUState* cpu) {
         /* 021FBD90 */ _t29 = cpu->r[1] + 0x00000014u;
         /* 021FBD90 */ cpu->r[31] = rbrew_read32(cpu->mem, _t29);
         /* 021FBD94 */ cpu->r[3] = 0x00000001u;
-        /* 021FBD98 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FBD98 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FBD98 */ _t31 = _t30 & 0x00000001u;
         /* 021FBD98 */ if (_t31) goto L_021FBD9C; // else: addr-0 trap, fall-through
   L_021FBD9C: ; // 0x21fbd9c
@@ -10273,7 +10273,7 @@ void Gambit_fn_021FBCB8(CPUState* cpu) {
         /* 021FBDF4 */ _t41 = cpu->r[1] + 0x00000014u;
         /* 021FBDF4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t41);
         /* 021FBDF8 */ cpu->r[3] = 0x00000001u;
-        /* 021FBDFC */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FBDFC */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FBDFC */ _t43 = _t42 & 0x00000001u;
         /* 021FBDFC */ if (_t43) goto L_021FBE00; // else: addr-0 trap, fall-through
   L_021FBE00: ; // 0x21fbe00
@@ -10303,7 +10303,7 @@ void Gambit_fn_021FBCB8(CPUState* cpu) {
         /* 021FBE3C */ cpu->r[31] = rbrew_read32(cpu->mem, _t50);
         /* 021FBE40 */ _t51 = cpu->r[1] + 0x00000010u;
         /* 021FBE40 */ cpu->r[30] = rbrew_read32(cpu->mem, _t51);
-        /* 021FBE44 */ _t52 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FBE44 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FBE44 */ _t53 = _t52 & 0x00000001u;
         /* 021FBE44 */ if (_t53) goto L_021FBE48; // else: addr-0 trap, fall-through
   L_021FBE48: ; // 0x21fbe48
@@ -10353,13 +10353,13 @@ void Gambit_fn_021FBCBC(CPUState* cpu) {
         /* 021FBD08 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021FBD0C */ _t11 = cpu->r[29] + 0x00000052u;
         /* 021FBD0C */ cpu->r[12] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t11);
-        /* 021FBD10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[3]);
-        /* 021FBD14 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FBD10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[3]));
+        /* 021FBD14 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FBD14 */ _t13 = _t12 & 0x00000001u;
         /* 021FBD14 */ if (_t13) goto L_021FBD20; else goto L_021FBD18;
   L_021FBD18: ; // 0x21fbd18
-        /* 021FBD18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FBD1C */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FBD18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FBD1C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FBD1C */ _t15 = _t14 & 0x00000001u;
         /* 021FBD1C */ if (_t15) goto L_021FBD20; else goto L_021FBE10;
   L_021FBD20: ; // 0x21fbd20
@@ -10371,11 +10371,11 @@ void Gambit_fn_021FBCBC(CPUState* cpu) {
         /* 021FBD30 */ cpu->f[3] = cpu->f[1];
         /* 021FBD34 */ _t17 = cpu->r[11] + 0x00001EF8u;
         /* 021FBD34 */ cpu->r[3] = rbrew_read32(cpu->mem, _t17);
-        /* 021FBD38 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[0]);
+        /* 021FBD38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[0]));
         /* 021FBD3C */ _t18 = cpu->r[29] + 0x000000B4u;
         /* 021FBD3C */ cpu->r[9] = rbrew_read32(cpu->mem, _t18);
         /* 021FBD40 */ cpu->r[4] = cpu->r[30];
-        /* 021FBD44 */ _t19 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FBD44 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FBD44 */ _t20 = _t19 & 0x00000001u;
         /* 021FBD44 */ if (_t20) goto L_021FBDAC; else goto L_021FBD48;
   L_021FBD48: ; // 0x21fbd48
@@ -10408,7 +10408,7 @@ void Gambit_fn_021FBCBC(CPUState* cpu) {
         /* 021FBD90 */ _t29 = cpu->r[1] + 0x00000014u;
         /* 021FBD90 */ cpu->r[31] = rbrew_read32(cpu->mem, _t29);
         /* 021FBD94 */ cpu->r[3] = 0x00000001u;
-        /* 021FBD98 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FBD98 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FBD98 */ _t31 = _t30 & 0x00000001u;
         /* 021FBD98 */ if (_t31) goto L_021FBD9C; // else: addr-0 trap, fall-through
   L_021FBD9C: ; // 0x21fbd9c
@@ -10447,7 +10447,7 @@ void Gambit_fn_021FBCBC(CPUState* cpu) {
         /* 021FBDF4 */ _t41 = cpu->r[1] + 0x00000014u;
         /* 021FBDF4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t41);
         /* 021FBDF8 */ cpu->r[3] = 0x00000001u;
-        /* 021FBDFC */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FBDFC */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FBDFC */ _t43 = _t42 & 0x00000001u;
         /* 021FBDFC */ if (_t43) goto L_021FBE00; // else: addr-0 trap, fall-through
   L_021FBE00: ; // 0x21fbe00
@@ -10477,7 +10477,7 @@ void Gambit_fn_021FBCBC(CPUState* cpu) {
         /* 021FBE3C */ cpu->r[31] = rbrew_read32(cpu->mem, _t50);
         /* 021FBE40 */ _t51 = cpu->r[1] + 0x00000010u;
         /* 021FBE40 */ cpu->r[30] = rbrew_read32(cpu->mem, _t51);
-        /* 021FBE44 */ _t52 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FBE44 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FBE44 */ _t53 = _t52 & 0x00000001u;
         /* 021FBE44 */ if (_t53) goto L_021FBE48; // else: addr-0 trap, fall-through
   L_021FBE48: ; // 0x21fbe48
@@ -10530,8 +10530,8 @@ void Gambit_fn_021FBE84(CPUState* cpu) {
         /* 021FBE8C */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 021FBE8C */ cpu->r[1] = _t1;
         /* 021FBE90 */ Gambit_fn_021FBE58(cpu);
-        /* 021FBE94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FBE98 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FBE94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FBE98 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FBE98 */ _t3 = _t2 & 0x00000001u;
         /* 021FBE98 */ if (_t3) goto L_021FBEB4; else goto L_021FBE9C;
   L_021FBE9C: ; // 0x21fbe9c
@@ -10563,8 +10563,8 @@ void Gambit_fn_021FBE8C(CPUState* cpu) {
         /* 021FBE8C */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 021FBE8C */ cpu->r[1] = _t0;
         /* 021FBE90 */ Gambit_fn_021FBE58(cpu);
-        /* 021FBE94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FBE98 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FBE94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FBE98 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FBE98 */ _t2 = _t1 & 0x00000001u;
         /* 021FBE98 */ if (_t2) goto L_021FBEB4; else goto L_021FBE9C;
   L_021FBE9C: ; // 0x21fbe9c
@@ -10599,8 +10599,8 @@ void Gambit_fn_021FBECC(CPUState* cpu) {
         /* 021FBED4 */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 021FBED4 */ cpu->r[1] = _t1;
         /* 021FBED8 */ Gambit_fn_021FBE58(cpu);
-        /* 021FBEDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FBEE0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FBEDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FBEE0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FBEE0 */ _t3 = _t2 & 0x00000001u;
         /* 021FBEE0 */ if (_t3) goto L_021FBEFC; else goto L_021FBEE4;
   L_021FBEE4: ; // 0x21fbee4
@@ -10632,8 +10632,8 @@ void Gambit_fn_021FBED4(CPUState* cpu) {
         /* 021FBED4 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 021FBED4 */ cpu->r[1] = _t0;
         /* 021FBED8 */ Gambit_fn_021FBE58(cpu);
-        /* 021FBEDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FBEE0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FBEDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FBEE0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FBEE0 */ _t2 = _t1 & 0x00000001u;
         /* 021FBEE0 */ if (_t2) goto L_021FBEFC; else goto L_021FBEE4;
   L_021FBEE4: ; // 0x21fbee4
@@ -10668,8 +10668,8 @@ void Gambit_fn_021FBF14(CPUState* cpu) {
         /* 021FBF1C */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 021FBF1C */ cpu->r[1] = _t1;
         /* 021FBF20 */ Gambit_fn_021FBE58(cpu);
-        /* 021FBF24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FBF28 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FBF24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FBF28 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FBF28 */ _t3 = _t2 & 0x00000001u;
         /* 021FBF28 */ if (_t3) goto L_021FBF44; else goto L_021FBF2C;
   L_021FBF2C: ; // 0x21fbf2c
@@ -10701,8 +10701,8 @@ void Gambit_fn_021FBF1C(CPUState* cpu) {
         /* 021FBF1C */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 021FBF1C */ cpu->r[1] = _t0;
         /* 021FBF20 */ Gambit_fn_021FBE58(cpu);
-        /* 021FBF24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FBF28 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FBF24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FBF28 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FBF28 */ _t2 = _t1 & 0x00000001u;
         /* 021FBF28 */ if (_t2) goto L_021FBF44; else goto L_021FBF2C;
   L_021FBF2C: ; // 0x21fbf2c
@@ -10775,8 +10775,8 @@ void Gambit_fn_021FBF78(CPUState* cpu) {
         /* 021FBF78 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021FBF78 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021FBF7C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021FBF7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021FBF80 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FBF7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021FBF80 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FBF80 */ _t2 = _t1 & 0x00000001u;
         /* 021FBF80 */ _t3 = _t2 ^ 0x00000001u;
         /* 021FBF80 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -10798,8 +10798,8 @@ void Gambit_fn_021FBF94(CPUState* cpu) {
         /* 021FBF94 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021FBF94 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021FBF98 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021FBF98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021FBF9C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FBF98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021FBF9C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FBF9C */ _t2 = _t1 & 0x00000001u;
         /* 021FBF9C */ _t3 = _t2 ^ 0x00000001u;
         /* 021FBF9C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -10821,8 +10821,8 @@ void Gambit_fn_021FBFB0(CPUState* cpu) {
         /* 021FBFB0 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021FBFB0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021FBFB4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021FBFB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021FBFB8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FBFB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021FBFB8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FBFB8 */ _t2 = _t1 & 0x00000001u;
         /* 021FBFB8 */ _t3 = _t2 ^ 0x00000001u;
         /* 021FBFB8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -10865,8 +10865,8 @@ void Gambit_fn_021FBFDC(CPUState* cpu) {
         /* 021FBFEC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021FBFF0 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021FBFF0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021FBFF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021FBFF8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FBFF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021FBFF8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FBFF8 */ _t5 = _t4 & 0x00000001u;
         /* 021FBFF8 */ if (_t5) goto L_021FBFFC; else goto L_021FC018;
   L_021FBFFC: ; // 0x21fbffc
@@ -10905,8 +10905,8 @@ void Gambit_fn_021FBFE0(CPUState* cpu) {
         /* 021FBFEC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021FBFF0 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021FBFF0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021FBFF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021FBFF8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FBFF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021FBFF8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FBFF8 */ _t5 = _t4 & 0x00000001u;
         /* 021FBFF8 */ if (_t5) goto L_021FBFFC; else goto L_021FC018;
   L_021FBFFC: ; // 0x21fbffc
@@ -11363,8 +11363,8 @@ void Gambit_fn_021FC1EC(CPUState* cpu) {
         /* 021FC1EC */ _t0 = cpu->r[3] + 0x00000114u;
         /* 021FC1EC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021FC1F0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 021FC1F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FC1F4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC1F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FC1F4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC1F4 */ _t2 = _t1 & 0x00000001u;
         /* 021FC1F4 */ if (_t2) goto L_021FC204; else goto L_021FC1F8;
   L_021FC1F8: ; // 0x21fc1f8
@@ -11393,8 +11393,8 @@ void Gambit_fn_021FC210(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -11482,9 +11482,9 @@ void Gambit_fn_021FC258(CPUState* cpu) {
         /* 021FC25C */ _t0 = cpu->r[8] + 0xFFFFFDB0u;
         /* 021FC25C */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 021FC260 */ cpu->r[6] = 0x101D0000u;
-        /* 021FC264 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021FC264 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021FC268 */ cpu->r[6] = cpu->r[6] + 0xFFFFFE64u;
-        /* 021FC26C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC26C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC26C */ _t2 = _t1 & 0x00000001u;
         /* 021FC26C */ if (_t2) goto L_021FC270; else goto L_021FC288;
   L_021FC270: ; // 0x21fc270
@@ -11497,8 +11497,8 @@ void Gambit_fn_021FC258(CPUState* cpu) {
         /* 021FC284 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 021FC284 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_021FC288: ; // 0x21fc288
-        /* 021FC288 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 021FC28C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC288 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 021FC28C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC28C */ _t6 = _t5 & 0x00000001u;
         /* 021FC28C */ if (_t6) goto L_021FC290; else goto L_021FC298;
   L_021FC290: ; // 0x21fc290
@@ -11509,9 +11509,9 @@ void Gambit_fn_021FC258(CPUState* cpu) {
         /* 021FC29C */ _t7 = cpu->r[10] + 0xFFFFFDACu;
         /* 021FC29C */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 021FC2A0 */ cpu->r[8] = 0x101D0000u;
-        /* 021FC2A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021FC2A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021FC2A8 */ cpu->r[8] = cpu->r[8] + 0xFFFFFE60u;
-        /* 021FC2AC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC2AC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC2AC */ _t9 = _t8 & 0x00000001u;
         /* 021FC2AC */ if (_t9) goto L_021FC2B0; else goto L_021FC2C8;
   L_021FC2B0: ; // 0x21fc2b0
@@ -11524,8 +11524,8 @@ void Gambit_fn_021FC258(CPUState* cpu) {
         /* 021FC2C4 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 021FC2C4 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_021FC2C8: ; // 0x21fc2c8
-        /* 021FC2C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021FC2CC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC2C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021FC2CC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC2CC */ _t13 = _t12 & 0x00000001u;
         /* 021FC2CC */ if (_t13) goto L_021FC2D0; else goto L_021FC2D8;
   L_021FC2D0: ; // 0x21fc2d0
@@ -11536,9 +11536,9 @@ void Gambit_fn_021FC258(CPUState* cpu) {
         /* 021FC2DC */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 021FC2DC */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 021FC2E0 */ cpu->r[10] = 0x101D0000u;
-        /* 021FC2E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021FC2E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021FC2E8 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 021FC2EC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC2EC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC2EC */ _t16 = _t15 & 0x00000001u;
         /* 021FC2EC */ if (_t16) goto L_021FC2F0; else goto L_021FC308;
   L_021FC2F0: ; // 0x21fc2f0
@@ -11551,8 +11551,8 @@ void Gambit_fn_021FC258(CPUState* cpu) {
         /* 021FC304 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 021FC304 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_021FC308: ; // 0x21fc308
-        /* 021FC308 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021FC30C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC308 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021FC30C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC30C */ _t20 = _t19 & 0x00000001u;
         /* 021FC30C */ if (_t20) goto L_021FC310; else goto L_021FC318;
   L_021FC310: ; // 0x21fc310
@@ -11563,9 +11563,9 @@ void Gambit_fn_021FC258(CPUState* cpu) {
         /* 021FC31C */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021FC31C */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021FC320 */ cpu->r[12] = 0x101D0000u;
-        /* 021FC324 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021FC324 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021FC328 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021FC32C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC32C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC32C */ _t23 = _t22 & 0x00000001u;
         /* 021FC32C */ if (_t23) goto L_021FC330; else goto L_021FC348;
   L_021FC330: ; // 0x21fc330
@@ -11578,8 +11578,8 @@ void Gambit_fn_021FC258(CPUState* cpu) {
         /* 021FC344 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 021FC344 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_021FC348: ; // 0x21fc348
-        /* 021FC348 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021FC34C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC348 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021FC34C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC34C */ _t27 = _t26 & 0x00000001u;
         /* 021FC34C */ if (_t27) goto L_021FC350; else goto L_021FC358;
   L_021FC350: ; // 0x21fc350
@@ -11591,9 +11591,9 @@ void Gambit_fn_021FC258(CPUState* cpu) {
         /* 021FC35C */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 021FC35C */ cpu->r[10] = _t28;
         /* 021FC360 */ cpu->r[7] = 0x101D0000u;
-        /* 021FC364 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021FC364 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021FC368 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 021FC36C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC36C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC36C */ _t30 = _t29 & 0x00000001u;
         /* 021FC36C */ if (_t30) goto L_021FC370; else goto L_021FC384;
   L_021FC370: ; // 0x21fc370
@@ -11605,8 +11605,8 @@ void Gambit_fn_021FC258(CPUState* cpu) {
         /* 021FC380 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 021FC380 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_021FC384: ; // 0x21fc384
-        /* 021FC384 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 021FC388 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC384 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 021FC388 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC388 */ _t34 = _t33 & 0x00000001u;
         /* 021FC388 */ if (_t34) goto L_021FC38C; else goto L_021FC394;
   L_021FC38C: ; // 0x21fc38c
@@ -11618,9 +11618,9 @@ void Gambit_fn_021FC258(CPUState* cpu) {
         /* 021FC398 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 021FC398 */ cpu->r[8] = _t35;
         /* 021FC39C */ cpu->r[6] = 0x101D0000u;
-        /* 021FC3A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021FC3A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021FC3A4 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 021FC3A8 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC3A8 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC3A8 */ _t37 = _t36 & 0x00000001u;
         /* 021FC3A8 */ if (_t37) goto L_021FC3AC; else goto L_021FC3C0;
   L_021FC3AC: ; // 0x21fc3ac
@@ -12022,10 +12022,10 @@ void Gambit_fn_021FC568(CPUState* cpu) {
         /* 021FC570 */ _t1 = cpu->r[3] + 0x00000020u;
         /* 021FC570 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 021FC574 */ cpu->r[8] = cpu->r[0];
-        /* 021FC578 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021FC578 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021FC57C */ _t2 = cpu->r[3] + 0x00000024u;
         /* 021FC57C */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021FC580 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FC580 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FC580 */ _t4 = _t3 & 0x00000001u;
         /* 021FC580 */ if (_t4) goto L_021FC584; else goto L_021FC59C;
   L_021FC584: ; // 0x21fc584
@@ -12033,8 +12033,8 @@ void Gambit_fn_021FC568(CPUState* cpu) {
         /* 021FC588 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 021FC58C */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021FC58C */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021FC590 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FC594 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC590 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FC594 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC594 */ _t7 = _t6 & 0x00000001u;
         /* 021FC594 */ if (_t7) goto L_021FC598; else goto L_021FC5A8;
   L_021FC598: ; // 0x21fc598
@@ -12042,16 +12042,16 @@ void Gambit_fn_021FC568(CPUState* cpu) {
   L_021FC59C: ; // 0x21fc59c
         /* 021FC59C */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021FC59C */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021FC5A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FC5A4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC5A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FC5A4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC5A4 */ _t10 = _t9 & 0x00000001u;
         /* 021FC5A4 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021FC5A4 */ goto L_021FC5A8;
   L_021FC5A8: ; // 0x21fc5a8
-        /* 021FC5A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 021FC5A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 021FC5AC */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021FC5AC */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 021FC5B0 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FC5B0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FC5B0 */ _t13 = _t12 & 0x00000001u;
         /* 021FC5B0 */ if (_t13) goto L_021FC5B4; else goto L_021FC5BC;
   L_021FC5B4: ; // 0x21fc5b4
@@ -12062,11 +12062,11 @@ void Gambit_fn_021FC568(CPUState* cpu) {
         /* 021FC5BC */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021FC5C0 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021FC5C0 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021FC5C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FC5C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FC5C8 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021FC5C8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021FC5CC */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 021FC5D0 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FC5D0 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FC5D0 */ _t18 = _t17 & 0x00000001u;
         /* 021FC5D0 */ if (_t18) goto L_021FC5E8; else goto L_021FC5D4;
   L_021FC5D4: ; // 0x21fc5d4
@@ -12093,10 +12093,10 @@ void Gambit_fn_021FC5F0(CPUState* cpu) {
         /* 021FC5F8 */ _t1 = cpu->r[3] + 0x00000028u;
         /* 021FC5F8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 021FC5FC */ cpu->r[8] = cpu->r[0];
-        /* 021FC600 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021FC600 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021FC604 */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 021FC604 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021FC608 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FC608 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FC608 */ _t4 = _t3 & 0x00000001u;
         /* 021FC608 */ if (_t4) goto L_021FC60C; else goto L_021FC624;
   L_021FC60C: ; // 0x21fc60c
@@ -12104,8 +12104,8 @@ void Gambit_fn_021FC5F0(CPUState* cpu) {
         /* 021FC610 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 021FC614 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021FC614 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021FC618 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FC61C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC618 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FC61C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC61C */ _t7 = _t6 & 0x00000001u;
         /* 021FC61C */ if (_t7) goto L_021FC620; else goto L_021FC630;
   L_021FC620: ; // 0x21fc620
@@ -12113,16 +12113,16 @@ void Gambit_fn_021FC5F0(CPUState* cpu) {
   L_021FC624: ; // 0x21fc624
         /* 021FC624 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021FC624 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021FC628 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FC62C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC628 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FC62C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC62C */ _t10 = _t9 & 0x00000001u;
         /* 021FC62C */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021FC62C */ goto L_021FC630;
   L_021FC630: ; // 0x21fc630
-        /* 021FC630 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 021FC630 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 021FC634 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021FC634 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 021FC638 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FC638 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FC638 */ _t13 = _t12 & 0x00000001u;
         /* 021FC638 */ if (_t13) goto L_021FC63C; else goto L_021FC644;
   L_021FC63C: ; // 0x21fc63c
@@ -12133,11 +12133,11 @@ void Gambit_fn_021FC5F0(CPUState* cpu) {
         /* 021FC644 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021FC648 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021FC648 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021FC64C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FC64C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FC650 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021FC650 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021FC654 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 021FC658 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FC658 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FC658 */ _t18 = _t17 & 0x00000001u;
         /* 021FC658 */ if (_t18) goto L_021FC670; else goto L_021FC65C;
   L_021FC65C: ; // 0x21fc65c
@@ -12170,18 +12170,18 @@ void Gambit_fn_021FC678(CPUState* cpu) {
         /* 021FC68C */ _t3 = cpu->r[31] + 0x00000010u;
         /* 021FC68C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 021FC690 */ cpu->r[12] = 0x00000000u;
-        /* 021FC694 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FC694 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FC698 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 021FC698 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 021FC69C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC69C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC69C */ _t6 = _t5 & 0x00000001u;
         /* 021FC69C */ if (_t6) goto L_021FC6C4; else goto L_021FC6A0;
   L_021FC6A0: ; // 0x21fc6a0
         /* 021FC6A0 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 021FC6A0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 021FC6A4 */ /* nop */
-        /* 021FC6A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 021FC6AC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC6A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 021FC6AC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC6AC */ _t9 = _t8 & 0x00000001u;
         /* 021FC6AC */ if (_t9) goto L_021FC6B0; else goto L_021FC6C4;
   L_021FC6B0: ; // 0x21fc6b0
@@ -12222,18 +12222,18 @@ void Gambit_fn_021FC67C(CPUState* cpu) {
         /* 021FC68C */ _t3 = cpu->r[31] + 0x00000010u;
         /* 021FC68C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 021FC690 */ cpu->r[12] = 0x00000000u;
-        /* 021FC694 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FC694 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FC698 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 021FC698 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 021FC69C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC69C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC69C */ _t6 = _t5 & 0x00000001u;
         /* 021FC69C */ if (_t6) goto L_021FC6C4; else goto L_021FC6A0;
   L_021FC6A0: ; // 0x21fc6a0
         /* 021FC6A0 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 021FC6A0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 021FC6A4 */ /* nop */
-        /* 021FC6A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 021FC6AC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC6A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 021FC6AC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC6AC */ _t9 = _t8 & 0x00000001u;
         /* 021FC6AC */ if (_t9) goto L_021FC6B0; else goto L_021FC6C4;
   L_021FC6B0: ; // 0x21fc6b0
@@ -12269,10 +12269,10 @@ void Gambit_fn_021FC6E8(CPUState* cpu) {
         /* 021FC6F0 */ _t1 = cpu->r[3] + 0x00000030u;
         /* 021FC6F0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 021FC6F4 */ cpu->r[7] = cpu->r[0];
-        /* 021FC6F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 021FC6F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 021FC6FC */ _t2 = cpu->r[3] + 0x00000034u;
         /* 021FC6FC */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021FC700 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FC700 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FC700 */ _t4 = _t3 & 0x00000001u;
         /* 021FC700 */ if (_t4) goto L_021FC704; else goto L_021FC71C;
   L_021FC704: ; // 0x21fc704
@@ -12280,8 +12280,8 @@ void Gambit_fn_021FC6E8(CPUState* cpu) {
         /* 021FC708 */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 021FC70C */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021FC70C */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021FC710 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021FC714 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021FC714 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC714 */ _t7 = _t6 & 0x00000001u;
         /* 021FC714 */ if (_t7) goto L_021FC718; else goto L_021FC728;
   L_021FC718: ; // 0x21fc718
@@ -12289,16 +12289,16 @@ void Gambit_fn_021FC6E8(CPUState* cpu) {
   L_021FC71C: ; // 0x21fc71c
         /* 021FC71C */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021FC71C */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021FC720 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021FC724 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC720 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021FC724 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC724 */ _t10 = _t9 & 0x00000001u;
         /* 021FC724 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021FC724 */ goto L_021FC728;
   L_021FC728: ; // 0x21fc728
-        /* 021FC728 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 021FC728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 021FC72C */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021FC72C */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 021FC730 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FC730 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FC730 */ _t13 = _t12 & 0x00000001u;
         /* 021FC730 */ if (_t13) goto L_021FC734; else goto L_021FC73C;
   L_021FC734: ; // 0x21fc734
@@ -12309,11 +12309,11 @@ void Gambit_fn_021FC6E8(CPUState* cpu) {
         /* 021FC73C */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021FC740 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021FC740 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021FC744 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021FC744 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021FC748 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021FC748 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021FC74C */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 021FC750 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FC750 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FC750 */ _t18 = _t17 & 0x00000001u;
         /* 021FC750 */ if (_t18) goto L_021FC768; else goto L_021FC754;
   L_021FC754: ; // 0x21fc754
@@ -12348,9 +12348,9 @@ void Gambit_fn_021FC770(CPUState* cpu) {
         /* 021FC788 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 021FC788 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 021FC78C */ /* nop */
-        /* 021FC790 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 021FC790 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 021FC794 */ cpu->r[31] = cpu->r[4];
-        /* 021FC798 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC798 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC798 */ _t6 = _t5 & 0x00000001u;
         /* 021FC798 */ if (_t6) goto L_021FC79C; else goto L_021FC7B0;
   L_021FC79C: ; // 0x21fc79c
@@ -12399,9 +12399,9 @@ void Gambit_fn_021FC774(CPUState* cpu) {
         /* 021FC788 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 021FC788 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 021FC78C */ /* nop */
-        /* 021FC790 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 021FC790 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 021FC794 */ cpu->r[31] = cpu->r[4];
-        /* 021FC798 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC798 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC798 */ _t6 = _t5 & 0x00000001u;
         /* 021FC798 */ if (_t6) goto L_021FC79C; else goto L_021FC7B0;
   L_021FC79C: ; // 0x21fc79c
@@ -12443,10 +12443,10 @@ void Gambit_fn_021FC7E8(CPUState* cpu) {
         /* 021FC7F0 */ _t1 = cpu->r[3] + 0x00000020u;
         /* 021FC7F0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 021FC7F4 */ cpu->r[8] = cpu->r[0];
-        /* 021FC7F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021FC7F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021FC7FC */ _t2 = cpu->r[3] + 0x00000024u;
         /* 021FC7FC */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021FC800 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FC800 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FC800 */ _t4 = _t3 & 0x00000001u;
         /* 021FC800 */ if (_t4) goto L_021FC804; else goto L_021FC81C;
   L_021FC804: ; // 0x21fc804
@@ -12454,8 +12454,8 @@ void Gambit_fn_021FC7E8(CPUState* cpu) {
         /* 021FC808 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 021FC80C */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021FC80C */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021FC810 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FC814 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC810 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FC814 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC814 */ _t7 = _t6 & 0x00000001u;
         /* 021FC814 */ if (_t7) goto L_021FC818; else goto L_021FC828;
   L_021FC818: ; // 0x21fc818
@@ -12463,16 +12463,16 @@ void Gambit_fn_021FC7E8(CPUState* cpu) {
   L_021FC81C: ; // 0x21fc81c
         /* 021FC81C */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021FC81C */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021FC820 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FC824 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC820 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FC824 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC824 */ _t10 = _t9 & 0x00000001u;
         /* 021FC824 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021FC824 */ goto L_021FC828;
   L_021FC828: ; // 0x21fc828
-        /* 021FC828 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 021FC828 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 021FC82C */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021FC82C */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 021FC830 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FC830 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FC830 */ _t13 = _t12 & 0x00000001u;
         /* 021FC830 */ if (_t13) goto L_021FC834; else goto L_021FC83C;
   L_021FC834: ; // 0x21fc834
@@ -12483,11 +12483,11 @@ void Gambit_fn_021FC7E8(CPUState* cpu) {
         /* 021FC83C */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021FC840 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021FC840 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021FC844 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FC844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FC848 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021FC848 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021FC84C */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 021FC850 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FC850 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FC850 */ _t18 = _t17 & 0x00000001u;
         /* 021FC850 */ if (_t18) goto L_021FC868; else goto L_021FC854;
   L_021FC854: ; // 0x21fc854
@@ -12514,10 +12514,10 @@ void Gambit_fn_021FC870(CPUState* cpu) {
         /* 021FC878 */ _t1 = cpu->r[3] + 0x00000028u;
         /* 021FC878 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 021FC87C */ cpu->r[8] = cpu->r[0];
-        /* 021FC880 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 021FC880 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 021FC884 */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 021FC884 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021FC888 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FC888 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FC888 */ _t4 = _t3 & 0x00000001u;
         /* 021FC888 */ if (_t4) goto L_021FC88C; else goto L_021FC8A4;
   L_021FC88C: ; // 0x21fc88c
@@ -12525,8 +12525,8 @@ void Gambit_fn_021FC870(CPUState* cpu) {
         /* 021FC890 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 021FC894 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021FC894 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021FC898 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FC89C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC898 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FC89C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC89C */ _t7 = _t6 & 0x00000001u;
         /* 021FC89C */ if (_t7) goto L_021FC8A0; else goto L_021FC8B0;
   L_021FC8A0: ; // 0x21fc8a0
@@ -12534,16 +12534,16 @@ void Gambit_fn_021FC870(CPUState* cpu) {
   L_021FC8A4: ; // 0x21fc8a4
         /* 021FC8A4 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021FC8A4 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021FC8A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FC8AC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC8A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FC8AC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC8AC */ _t10 = _t9 & 0x00000001u;
         /* 021FC8AC */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021FC8AC */ goto L_021FC8B0;
   L_021FC8B0: ; // 0x21fc8b0
-        /* 021FC8B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 021FC8B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 021FC8B4 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021FC8B4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 021FC8B8 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FC8B8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FC8B8 */ _t13 = _t12 & 0x00000001u;
         /* 021FC8B8 */ if (_t13) goto L_021FC8BC; else goto L_021FC8C4;
   L_021FC8BC: ; // 0x21fc8bc
@@ -12554,11 +12554,11 @@ void Gambit_fn_021FC870(CPUState* cpu) {
         /* 021FC8C4 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021FC8C8 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021FC8C8 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021FC8CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FC8CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FC8D0 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021FC8D0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021FC8D4 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 021FC8D8 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FC8D8 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FC8D8 */ _t18 = _t17 & 0x00000001u;
         /* 021FC8D8 */ if (_t18) goto L_021FC8F0; else goto L_021FC8DC;
   L_021FC8DC: ; // 0x21fc8dc
@@ -12591,18 +12591,18 @@ void Gambit_fn_021FC8F8(CPUState* cpu) {
         /* 021FC90C */ _t3 = cpu->r[31] + 0x00000010u;
         /* 021FC90C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 021FC910 */ cpu->r[12] = 0x00000000u;
-        /* 021FC914 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FC914 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FC918 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 021FC918 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 021FC91C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC91C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC91C */ _t6 = _t5 & 0x00000001u;
         /* 021FC91C */ if (_t6) goto L_021FC944; else goto L_021FC920;
   L_021FC920: ; // 0x21fc920
         /* 021FC920 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 021FC920 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 021FC924 */ /* nop */
-        /* 021FC928 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 021FC92C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC928 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 021FC92C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC92C */ _t9 = _t8 & 0x00000001u;
         /* 021FC92C */ if (_t9) goto L_021FC930; else goto L_021FC944;
   L_021FC930: ; // 0x21fc930
@@ -12643,18 +12643,18 @@ void Gambit_fn_021FC8FC(CPUState* cpu) {
         /* 021FC90C */ _t3 = cpu->r[31] + 0x00000010u;
         /* 021FC90C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 021FC910 */ cpu->r[12] = 0x00000000u;
-        /* 021FC914 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FC914 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FC918 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 021FC918 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 021FC91C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC91C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC91C */ _t6 = _t5 & 0x00000001u;
         /* 021FC91C */ if (_t6) goto L_021FC944; else goto L_021FC920;
   L_021FC920: ; // 0x21fc920
         /* 021FC920 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 021FC920 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 021FC924 */ /* nop */
-        /* 021FC928 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 021FC92C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC928 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 021FC92C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC92C */ _t9 = _t8 & 0x00000001u;
         /* 021FC92C */ if (_t9) goto L_021FC930; else goto L_021FC944;
   L_021FC930: ; // 0x21fc930
@@ -12690,10 +12690,10 @@ void Gambit_fn_021FC968(CPUState* cpu) {
         /* 021FC970 */ _t1 = cpu->r[3] + 0x00000030u;
         /* 021FC970 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 021FC974 */ cpu->r[7] = cpu->r[0];
-        /* 021FC978 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 021FC978 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 021FC97C */ _t2 = cpu->r[3] + 0x00000034u;
         /* 021FC97C */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 021FC980 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FC980 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FC980 */ _t4 = _t3 & 0x00000001u;
         /* 021FC980 */ if (_t4) goto L_021FC984; else goto L_021FC99C;
   L_021FC984: ; // 0x21fc984
@@ -12701,8 +12701,8 @@ void Gambit_fn_021FC968(CPUState* cpu) {
         /* 021FC988 */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 021FC98C */ _t5 = cpu->r[9] + 0x00000002u;
         /* 021FC98C */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 021FC990 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021FC994 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021FC994 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC994 */ _t7 = _t6 & 0x00000001u;
         /* 021FC994 */ if (_t7) goto L_021FC998; else goto L_021FC9A8;
   L_021FC998: ; // 0x21fc998
@@ -12710,16 +12710,16 @@ void Gambit_fn_021FC968(CPUState* cpu) {
   L_021FC99C: ; // 0x21fc99c
         /* 021FC99C */ _t8 = cpu->r[12] + 0x00000002u;
         /* 021FC99C */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 021FC9A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 021FC9A4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FC9A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 021FC9A4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FC9A4 */ _t10 = _t9 & 0x00000001u;
         /* 021FC9A4 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021FC9A4 */ goto L_021FC9A8;
   L_021FC9A8: ; // 0x21fc9a8
-        /* 021FC9A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 021FC9A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 021FC9AC */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 021FC9AC */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 021FC9B0 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FC9B0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FC9B0 */ _t13 = _t12 & 0x00000001u;
         /* 021FC9B0 */ if (_t13) goto L_021FC9B4; else goto L_021FC9BC;
   L_021FC9B4: ; // 0x21fc9b4
@@ -12730,11 +12730,11 @@ void Gambit_fn_021FC968(CPUState* cpu) {
         /* 021FC9BC */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 021FC9C0 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 021FC9C0 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 021FC9C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021FC9C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021FC9C8 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 021FC9C8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 021FC9CC */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 021FC9D0 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FC9D0 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FC9D0 */ _t18 = _t17 & 0x00000001u;
         /* 021FC9D0 */ if (_t18) goto L_021FC9E8; else goto L_021FC9D4;
   L_021FC9D4: ; // 0x21fc9d4
@@ -12769,9 +12769,9 @@ void Gambit_fn_021FC9F0(CPUState* cpu) {
         /* 021FCA08 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 021FCA08 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 021FCA0C */ /* nop */
-        /* 021FCA10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 021FCA10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 021FCA14 */ cpu->r[31] = cpu->r[4];
-        /* 021FCA18 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCA18 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCA18 */ _t6 = _t5 & 0x00000001u;
         /* 021FCA18 */ if (_t6) goto L_021FCA1C; else goto L_021FCA30;
   L_021FCA1C: ; // 0x21fca1c
@@ -12820,9 +12820,9 @@ void Gambit_fn_021FC9F4(CPUState* cpu) {
         /* 021FCA08 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 021FCA08 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 021FCA0C */ /* nop */
-        /* 021FCA10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 021FCA10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 021FCA14 */ cpu->r[31] = cpu->r[4];
-        /* 021FCA18 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCA18 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCA18 */ _t6 = _t5 & 0x00000001u;
         /* 021FCA18 */ if (_t6) goto L_021FCA1C; else goto L_021FCA30;
   L_021FCA1C: ; // 0x21fca1c
@@ -12865,18 +12865,18 @@ void Gambit_fn_021FCA68(CPUState* cpu) {
         /* 021FCA70 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021FCA70 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021FCA74 */ cpu->r[31] = cpu->r[3];
-        /* 021FCA74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021FCA74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021FCA78 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021FCA78 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021FCA7C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCA7C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCA7C */ _t4 = _t3 & 0x00000001u;
         /* 021FCA7C */ if (_t4) goto L_021FCA80; else goto L_021FCA90;
   L_021FCA80: ; // 0x21fca80
         /* 021FCA80 */ cpu->r[3] = 0x00000194u;
         /* 021FCA84 */ Gambit_fn_02801A78(cpu);
         /* 021FCA88 */ cpu->r[31] = cpu->r[3];
-        /* 021FCA88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021FCA8C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCA88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021FCA8C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCA8C */ _t6 = _t5 & 0x00000001u;
         /* 021FCA8C */ if (_t6) goto L_021FCB0C; else goto L_021FCA90;
   L_021FCA90: ; // 0x21fca90
@@ -12890,10 +12890,10 @@ void Gambit_fn_021FCA68(CPUState* cpu) {
         /* 021FCAA8 */ _t8 = cpu->r[31] + 0x00000004u;
         /* 021FCAA8 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 021FCAAC */ cpu->r[12] = cpu->r[31] + 0x0000012Cu;
-        /* 021FCAAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021FCAAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021FCAB0 */ _t9 = cpu->r[31] + 0x00000128u;
         /* 021FCAB0 */ rbrew_write_f32(cpu->mem, _t9, cpu->f[0]);
-        /* 021FCAB4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCAB4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCAB4 */ _t11 = _t10 & 0x00000001u;
         /* 021FCAB4 */ if (_t11) goto L_021FCAB8; else goto L_021FCAC0;
   L_021FCAB8: ; // 0x21fcab8
@@ -12901,8 +12901,8 @@ void Gambit_fn_021FCA68(CPUState* cpu) {
         /* 021FCABC */ Gambit_fn_02801A78(cpu);
   L_021FCAC0: ; // 0x21fcac0
         /* 021FCAC0 */ cpu->r[0] = cpu->r[31] + 0x0000015Cu;
-        /* 021FCAC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FCAC4 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCAC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FCAC4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCAC4 */ _t13 = _t12 & 0x00000001u;
         /* 021FCAC4 */ if (_t13) goto L_021FCAC8; else goto L_021FCAD0;
   L_021FCAC8: ; // 0x21fcac8
@@ -12910,8 +12910,8 @@ void Gambit_fn_021FCA68(CPUState* cpu) {
         /* 021FCACC */ Gambit_fn_02801A78(cpu);
   L_021FCAD0: ; // 0x21fcad0
         /* 021FCAD0 */ cpu->r[12] = cpu->r[31] + 0x00000168u;
-        /* 021FCAD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021FCAD4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCAD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021FCAD4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCAD4 */ _t15 = _t14 & 0x00000001u;
         /* 021FCAD4 */ if (_t15) goto L_021FCAD8; else goto L_021FCAE0;
   L_021FCAD8: ; // 0x21fcad8
@@ -12919,8 +12919,8 @@ void Gambit_fn_021FCA68(CPUState* cpu) {
         /* 021FCADC */ Gambit_fn_02801A78(cpu);
   L_021FCAE0: ; // 0x21fcae0
         /* 021FCAE0 */ cpu->r[0] = cpu->r[31] + 0x00000174u;
-        /* 021FCAE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FCAE4 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCAE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FCAE4 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCAE4 */ _t17 = _t16 & 0x00000001u;
         /* 021FCAE4 */ if (_t17) goto L_021FCAE8; else goto L_021FCAF0;
   L_021FCAE8: ; // 0x21fcae8
@@ -12928,8 +12928,8 @@ void Gambit_fn_021FCA68(CPUState* cpu) {
         /* 021FCAEC */ Gambit_fn_02801A78(cpu);
   L_021FCAF0: ; // 0x21fcaf0
         /* 021FCAF0 */ cpu->r[0] = cpu->r[31] + 0x00000180u;
-        /* 021FCAF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FCAF4 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCAF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FCAF4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCAF4 */ _t19 = _t18 & 0x00000001u;
         /* 021FCAF4 */ if (_t19) goto L_021FCAF8; else goto L_021FCB00;
   L_021FCAF8: ; // 0x21fcaf8
@@ -12963,18 +12963,18 @@ void Gambit_fn_021FCA6C(CPUState* cpu) {
         /* 021FCA70 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 021FCA70 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 021FCA74 */ cpu->r[31] = cpu->r[3];
-        /* 021FCA74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021FCA74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021FCA78 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 021FCA78 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 021FCA7C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCA7C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCA7C */ _t4 = _t3 & 0x00000001u;
         /* 021FCA7C */ if (_t4) goto L_021FCA80; else goto L_021FCA90;
   L_021FCA80: ; // 0x21fca80
         /* 021FCA80 */ cpu->r[3] = 0x00000194u;
         /* 021FCA84 */ Gambit_fn_02801A78(cpu);
         /* 021FCA88 */ cpu->r[31] = cpu->r[3];
-        /* 021FCA88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021FCA8C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCA88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021FCA8C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCA8C */ _t6 = _t5 & 0x00000001u;
         /* 021FCA8C */ if (_t6) goto L_021FCB0C; else goto L_021FCA90;
   L_021FCA90: ; // 0x21fca90
@@ -12988,10 +12988,10 @@ void Gambit_fn_021FCA6C(CPUState* cpu) {
         /* 021FCAA8 */ _t8 = cpu->r[31] + 0x00000004u;
         /* 021FCAA8 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
         /* 021FCAAC */ cpu->r[12] = cpu->r[31] + 0x0000012Cu;
-        /* 021FCAAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021FCAAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021FCAB0 */ _t9 = cpu->r[31] + 0x00000128u;
         /* 021FCAB0 */ rbrew_write_f32(cpu->mem, _t9, cpu->f[0]);
-        /* 021FCAB4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCAB4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCAB4 */ _t11 = _t10 & 0x00000001u;
         /* 021FCAB4 */ if (_t11) goto L_021FCAB8; else goto L_021FCAC0;
   L_021FCAB8: ; // 0x21fcab8
@@ -12999,8 +12999,8 @@ void Gambit_fn_021FCA6C(CPUState* cpu) {
         /* 021FCABC */ Gambit_fn_02801A78(cpu);
   L_021FCAC0: ; // 0x21fcac0
         /* 021FCAC0 */ cpu->r[0] = cpu->r[31] + 0x0000015Cu;
-        /* 021FCAC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FCAC4 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCAC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FCAC4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCAC4 */ _t13 = _t12 & 0x00000001u;
         /* 021FCAC4 */ if (_t13) goto L_021FCAC8; else goto L_021FCAD0;
   L_021FCAC8: ; // 0x21fcac8
@@ -13008,8 +13008,8 @@ void Gambit_fn_021FCA6C(CPUState* cpu) {
         /* 021FCACC */ Gambit_fn_02801A78(cpu);
   L_021FCAD0: ; // 0x21fcad0
         /* 021FCAD0 */ cpu->r[12] = cpu->r[31] + 0x00000168u;
-        /* 021FCAD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021FCAD4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCAD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021FCAD4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCAD4 */ _t15 = _t14 & 0x00000001u;
         /* 021FCAD4 */ if (_t15) goto L_021FCAD8; else goto L_021FCAE0;
   L_021FCAD8: ; // 0x21fcad8
@@ -13017,8 +13017,8 @@ void Gambit_fn_021FCA6C(CPUState* cpu) {
         /* 021FCADC */ Gambit_fn_02801A78(cpu);
   L_021FCAE0: ; // 0x21fcae0
         /* 021FCAE0 */ cpu->r[0] = cpu->r[31] + 0x00000174u;
-        /* 021FCAE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FCAE4 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCAE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FCAE4 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCAE4 */ _t17 = _t16 & 0x00000001u;
         /* 021FCAE4 */ if (_t17) goto L_021FCAE8; else goto L_021FCAF0;
   L_021FCAE8: ; // 0x21fcae8
@@ -13026,8 +13026,8 @@ void Gambit_fn_021FCA6C(CPUState* cpu) {
         /* 021FCAEC */ Gambit_fn_02801A78(cpu);
   L_021FCAF0: ; // 0x21fcaf0
         /* 021FCAF0 */ cpu->r[0] = cpu->r[31] + 0x00000180u;
-        /* 021FCAF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FCAF4 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCAF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FCAF4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCAF4 */ _t19 = _t18 & 0x00000001u;
         /* 021FCAF4 */ if (_t19) goto L_021FCAF8; else goto L_021FCB00;
   L_021FCAF8: ; // 0x21fcaf8
@@ -13258,7 +13258,7 @@ void Gambit_fn_021FCB24(CPUState* cpu) {
         /* 021FCD08 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t76);
         /* 021FCD0C */ _t77 = cpu->r[1] + 0x00000078u;
         /* 021FCD0C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t77);
-        /* 021FCD10 */ _t78 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FCD10 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FCD10 */ _t79 = _t78 & 0x00000001u;
         /* 021FCD10 */ if (_t79) goto L_021FCD14; // else: addr-0 trap, fall-through
   L_021FCD14: ; // 0x21fcd14
@@ -13477,7 +13477,7 @@ void Gambit_fn_021FCD24(CPUState* cpu) {
         /* 021FCD08 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t76);
         /* 021FCD0C */ _t77 = cpu->r[1] + 0x00000078u;
         /* 021FCD0C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t77);
-        /* 021FCD10 */ _t78 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FCD10 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FCD10 */ _t79 = _t78 & 0x00000001u;
         /* 021FCD10 */ if (_t79) goto L_021FCD14; // else: addr-0 trap, fall-through
   L_021FCD14: ; // 0x21fcd14
@@ -13700,7 +13700,7 @@ void Gambit_fn_021FCD30(CPUState* cpu) {
         /* 021FCD08 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t76);
         /* 021FCD0C */ _t77 = cpu->r[1] + 0x00000078u;
         /* 021FCD0C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t77);
-        /* 021FCD10 */ _t78 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FCD10 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FCD10 */ _t79 = _t78 & 0x00000001u;
         /* 021FCD10 */ if (_t79) goto L_021FCD14; // else: addr-0 trap, fall-through
   L_021FCD14: ; // 0x21fcd14
@@ -13732,30 +13732,30 @@ void Gambit_fn_021FCD3C(CPUState* cpu) {
         /* 021FCD50 */ cpu->r[30] = cpu->r[5];
         /* 021FCD54 */ _t3 = cpu->r[1] + 0x0000002Cu;
         /* 021FCD54 */ rbrew_write32(cpu->mem, _t3, cpu->r[29]);
-        /* 021FCD58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 021FCD58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 021FCD5C */ _t4 = cpu->r[1] + 0x0000003Cu;
         /* 021FCD5C */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 021FCD60 */ cpu->r[29] = cpu->r[3];
-        /* 021FCD64 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCD64 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCD64 */ _t6 = _t5 & 0x00000001u;
         /* 021FCD64 */ if (_t6) goto L_021FCD7C; else goto L_021FCD68;
   L_021FCD68: ; // 0x21fcd68
         /* 021FCD68 */ _t7 = cpu->r[29] + 0x00000060u;
         /* 021FCD68 */ cpu->r[0] = rbrew_read32(cpu->mem, _t7);
-        /* 021FCD6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FCD70 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCD6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FCD70 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCD70 */ _t9 = _t8 & 0x00000001u;
         /* 021FCD70 */ if (_t9) goto L_021FCD7C; else goto L_021FCD74;
   L_021FCD74: ; // 0x21fcd74
-        /* 021FCD74 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[0]);
-        /* 021FCD78 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCD74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[0]));
+        /* 021FCD78 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCD78 */ _t11 = _t10 & 0x00000001u;
         /* 021FCD78 */ if (_t11) goto L_021FCE60; else goto L_021FCD7C;
   L_021FCD7C: ; // 0x21fcd7c
         /* 021FCD7C */ cpu->r[3] = cpu->r[29];
         /* 021FCD80 */ Gambit_fn_021BC86C(cpu);
-        /* 021FCD84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000001u);
-        /* 021FCD88 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCD84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000001u));
+        /* 021FCD88 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCD88 */ _t13 = _t12 & 0x00000001u;
         /* 021FCD88 */ if (_t13) goto L_021FCD8C; else goto L_021FCE60;
   L_021FCD8C: ; // 0x21fcd8c
@@ -13796,8 +13796,8 @@ void Gambit_fn_021FCD3C(CPUState* cpu) {
         /* 021FCDE4 */ cpu->r[5] = cpu->r[31];
         /* 021FCDE8 */ cpu->r[4] = cpu->r[1] + 0x00000008u;
         /* 021FCDEC */ Gambit_fn_027DE3CC(cpu);
-        /* 021FCDF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FCDF4 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCDF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FCDF4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCDF4 */ _t27 = _t26 & 0x00000001u;
         /* 021FCDF4 */ if (_t27) goto L_021FCDF8; else goto L_021FCE40;
   L_021FCDF8: ; // 0x21fcdf8
@@ -13829,8 +13829,8 @@ void Gambit_fn_021FCD3C(CPUState* cpu) {
         /* 021FCE30 */ _t39 = cpu->r[1] + 0x00000020u;
         /* 021FCE30 */ rbrew_write_f32(cpu->mem, _t39, cpu->f[12]);
         /* 021FCE34 */ Gambit_fn_027DE3CC(cpu);
-        /* 021FCE38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FCE3C */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCE38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FCE3C */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCE3C */ _t41 = _t40 & 0x00000001u;
         /* 021FCE3C */ if (_t41) goto L_021FCE60; else goto L_021FCE40;
   L_021FCE40: ; // 0x21fce40
@@ -13877,30 +13877,30 @@ void Gambit_fn_021FCD40(CPUState* cpu) {
         /* 021FCD50 */ cpu->r[30] = cpu->r[5];
         /* 021FCD54 */ _t3 = cpu->r[1] + 0x0000002Cu;
         /* 021FCD54 */ rbrew_write32(cpu->mem, _t3, cpu->r[29]);
-        /* 021FCD58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 021FCD58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 021FCD5C */ _t4 = cpu->r[1] + 0x0000003Cu;
         /* 021FCD5C */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 021FCD60 */ cpu->r[29] = cpu->r[3];
-        /* 021FCD64 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCD64 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCD64 */ _t6 = _t5 & 0x00000001u;
         /* 021FCD64 */ if (_t6) goto L_021FCD7C; else goto L_021FCD68;
   L_021FCD68: ; // 0x21fcd68
         /* 021FCD68 */ _t7 = cpu->r[29] + 0x00000060u;
         /* 021FCD68 */ cpu->r[0] = rbrew_read32(cpu->mem, _t7);
-        /* 021FCD6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FCD70 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCD6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FCD70 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCD70 */ _t9 = _t8 & 0x00000001u;
         /* 021FCD70 */ if (_t9) goto L_021FCD7C; else goto L_021FCD74;
   L_021FCD74: ; // 0x21fcd74
-        /* 021FCD74 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[0]);
-        /* 021FCD78 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCD74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[0]));
+        /* 021FCD78 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCD78 */ _t11 = _t10 & 0x00000001u;
         /* 021FCD78 */ if (_t11) goto L_021FCE60; else goto L_021FCD7C;
   L_021FCD7C: ; // 0x21fcd7c
         /* 021FCD7C */ cpu->r[3] = cpu->r[29];
         /* 021FCD80 */ Gambit_fn_021BC86C(cpu);
-        /* 021FCD84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000001u);
-        /* 021FCD88 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCD84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000001u));
+        /* 021FCD88 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCD88 */ _t13 = _t12 & 0x00000001u;
         /* 021FCD88 */ if (_t13) goto L_021FCD8C; else goto L_021FCE60;
   L_021FCD8C: ; // 0x21fcd8c
@@ -13941,8 +13941,8 @@ void Gambit_fn_021FCD40(CPUState* cpu) {
         /* 021FCDE4 */ cpu->r[5] = cpu->r[31];
         /* 021FCDE8 */ cpu->r[4] = cpu->r[1] + 0x00000008u;
         /* 021FCDEC */ Gambit_fn_027DE3CC(cpu);
-        /* 021FCDF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FCDF4 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCDF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FCDF4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCDF4 */ _t27 = _t26 & 0x00000001u;
         /* 021FCDF4 */ if (_t27) goto L_021FCDF8; else goto L_021FCE40;
   L_021FCDF8: ; // 0x21fcdf8
@@ -13974,8 +13974,8 @@ void Gambit_fn_021FCD40(CPUState* cpu) {
         /* 021FCE30 */ _t39 = cpu->r[1] + 0x00000020u;
         /* 021FCE30 */ rbrew_write_f32(cpu->mem, _t39, cpu->f[12]);
         /* 021FCE34 */ Gambit_fn_027DE3CC(cpu);
-        /* 021FCE38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FCE3C */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCE38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FCE3C */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCE3C */ _t41 = _t40 & 0x00000001u;
         /* 021FCE3C */ if (_t41) goto L_021FCE60; else goto L_021FCE40;
   L_021FCE40: ; // 0x21fce40
@@ -14023,23 +14023,23 @@ void Gambit_fn_021FCE80(CPUState* cpu) {
         /* 021FCE94 */ cpu->r[30] = cpu->r[5];
         /* 021FCE98 */ _t3 = cpu->r[1] + 0x00000034u;
         /* 021FCE98 */ rbrew_write32(cpu->mem, _t3, cpu->r[29]);
-        /* 021FCE9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 021FCE9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 021FCEA0 */ _t4 = cpu->r[1] + 0x00000044u;
         /* 021FCEA0 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 021FCEA4 */ cpu->r[29] = cpu->r[3];
-        /* 021FCEA8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCEA8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCEA8 */ _t6 = _t5 & 0x00000001u;
         /* 021FCEA8 */ if (_t6) goto L_021FCEC0; else goto L_021FCEAC;
   L_021FCEAC: ; // 0x21fceac
         /* 021FCEAC */ _t7 = cpu->r[29] + 0x00000060u;
         /* 021FCEAC */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
-        /* 021FCEB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FCEB4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCEB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FCEB4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCEB4 */ _t9 = _t8 & 0x00000001u;
         /* 021FCEB4 */ if (_t9) goto L_021FCEC0; else goto L_021FCEB8;
   L_021FCEB8: ; // 0x21fceb8
-        /* 021FCEB8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021FCEBC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCEB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021FCEBC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCEBC */ _t11 = _t10 & 0x00000001u;
         /* 021FCEBC */ if (_t11) goto L_021FCFEC; else goto L_021FCEC0;
   L_021FCEC0: ; // 0x21fcec0
@@ -14073,8 +14073,8 @@ void Gambit_fn_021FCE80(CPUState* cpu) {
         /* 021FCF08 */ _t21 = cpu->r[1] + 0x00000010u;
         /* 021FCF08 */ rbrew_write_f32(cpu->mem, _t21, cpu->f[12]);
         /* 021FCF0C */ Gambit_fn_021BC86C(cpu);
-        /* 021FCF10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000001u);
-        /* 021FCF14 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCF10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000001u));
+        /* 021FCF14 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCF14 */ _t23 = _t22 & 0x00000001u;
         /* 021FCF14 */ if (_t23) goto L_021FCF18; else goto L_021FCFEC;
   L_021FCF18: ; // 0x21fcf18
@@ -14115,8 +14115,8 @@ void Gambit_fn_021FCE80(CPUState* cpu) {
         /* 021FCF70 */ cpu->r[5] = cpu->r[31];
         /* 021FCF74 */ cpu->r[4] = cpu->r[1] + 0x00000014u;
         /* 021FCF78 */ Gambit_fn_027DF038(cpu);
-        /* 021FCF7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FCF80 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCF7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FCF80 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCF80 */ _t37 = _t36 & 0x00000001u;
         /* 021FCF80 */ if (_t37) goto L_021FCF84; else goto L_021FCFCC;
   L_021FCF84: ; // 0x21fcf84
@@ -14148,8 +14148,8 @@ void Gambit_fn_021FCE80(CPUState* cpu) {
         /* 021FCFBC */ _t49 = cpu->r[1] + 0x00000018u;
         /* 021FCFBC */ rbrew_write_f32(cpu->mem, _t49, cpu->f[10]);
         /* 021FCFC0 */ Gambit_fn_027DF038(cpu);
-        /* 021FCFC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FCFC8 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCFC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FCFC8 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCFC8 */ _t51 = _t50 & 0x00000001u;
         /* 021FCFC8 */ if (_t51) goto L_021FCFEC; else goto L_021FCFCC;
   L_021FCFCC: ; // 0x21fcfcc
@@ -14196,23 +14196,23 @@ void Gambit_fn_021FCE84(CPUState* cpu) {
         /* 021FCE94 */ cpu->r[30] = cpu->r[5];
         /* 021FCE98 */ _t3 = cpu->r[1] + 0x00000034u;
         /* 021FCE98 */ rbrew_write32(cpu->mem, _t3, cpu->r[29]);
-        /* 021FCE9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 021FCE9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 021FCEA0 */ _t4 = cpu->r[1] + 0x00000044u;
         /* 021FCEA0 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 021FCEA4 */ cpu->r[29] = cpu->r[3];
-        /* 021FCEA8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCEA8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCEA8 */ _t6 = _t5 & 0x00000001u;
         /* 021FCEA8 */ if (_t6) goto L_021FCEC0; else goto L_021FCEAC;
   L_021FCEAC: ; // 0x21fceac
         /* 021FCEAC */ _t7 = cpu->r[29] + 0x00000060u;
         /* 021FCEAC */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
-        /* 021FCEB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 021FCEB4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCEB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 021FCEB4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCEB4 */ _t9 = _t8 & 0x00000001u;
         /* 021FCEB4 */ if (_t9) goto L_021FCEC0; else goto L_021FCEB8;
   L_021FCEB8: ; // 0x21fceb8
-        /* 021FCEB8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021FCEBC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCEB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021FCEBC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCEBC */ _t11 = _t10 & 0x00000001u;
         /* 021FCEBC */ if (_t11) goto L_021FCFEC; else goto L_021FCEC0;
   L_021FCEC0: ; // 0x21fcec0
@@ -14246,8 +14246,8 @@ void Gambit_fn_021FCE84(CPUState* cpu) {
         /* 021FCF08 */ _t21 = cpu->r[1] + 0x00000010u;
         /* 021FCF08 */ rbrew_write_f32(cpu->mem, _t21, cpu->f[12]);
         /* 021FCF0C */ Gambit_fn_021BC86C(cpu);
-        /* 021FCF10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000001u);
-        /* 021FCF14 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCF10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000001u));
+        /* 021FCF14 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCF14 */ _t23 = _t22 & 0x00000001u;
         /* 021FCF14 */ if (_t23) goto L_021FCF18; else goto L_021FCFEC;
   L_021FCF18: ; // 0x21fcf18
@@ -14288,8 +14288,8 @@ void Gambit_fn_021FCE84(CPUState* cpu) {
         /* 021FCF70 */ cpu->r[5] = cpu->r[31];
         /* 021FCF74 */ cpu->r[4] = cpu->r[1] + 0x00000014u;
         /* 021FCF78 */ Gambit_fn_027DF038(cpu);
-        /* 021FCF7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FCF80 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCF7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FCF80 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCF80 */ _t37 = _t36 & 0x00000001u;
         /* 021FCF80 */ if (_t37) goto L_021FCF84; else goto L_021FCFCC;
   L_021FCF84: ; // 0x21fcf84
@@ -14321,8 +14321,8 @@ void Gambit_fn_021FCE84(CPUState* cpu) {
         /* 021FCFBC */ _t49 = cpu->r[1] + 0x00000018u;
         /* 021FCFBC */ rbrew_write_f32(cpu->mem, _t49, cpu->f[10]);
         /* 021FCFC0 */ Gambit_fn_027DF038(cpu);
-        /* 021FCFC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FCFC8 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FCFC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FCFC8 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FCFC8 */ _t51 = _t50 & 0x00000001u;
         /* 021FCFC8 */ if (_t51) goto L_021FCFEC; else goto L_021FCFCC;
   L_021FCFCC: ; // 0x21fcfcc
@@ -14418,10 +14418,10 @@ void Gambit_fn_021FD00C(CPUState* cpu) {
         /* 021FD090 */ _t22 = cpu->r[9] + 0xFFFFCF84u;
         /* 021FD090 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t22);
         /* 021FD094 */ cpu->r[9] = 0x10040000u;
-        /* 021FD098 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 021FD098 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 021FD09C */ _t23 = cpu->r[9] + 0xFFFFCF98u;
         /* 021FD09C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t23);
-        /* 021FD0A0 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD0A0 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD0A0 */ _t25 = _t24 & 0x00000001u;
         /* 021FD0A0 */ if (_t25) goto L_021FD0A4; else goto L_021FD0C8;
   L_021FD0A4: ; // 0x21fd0a4
@@ -14433,8 +14433,8 @@ void Gambit_fn_021FD00C(CPUState* cpu) {
         /* 021FD0B0 */ cpu->r[3] = cpu->r[31];
         /* 021FD0B4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021FD0B8 */ cpu->f[28] = cpu->f[1];
-        /* 021FD0BC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[30]);
-        /* 021FD0C0 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD0BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[30]));
+        /* 021FD0C0 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD0C0 */ _t29 = _t28 & 0x00000001u;
         /* 021FD0C0 */ if (_t29) goto L_021FD198; else goto L_021FD0C4;
   L_021FD0C4: ; // 0x21fd0c4
@@ -14442,8 +14442,8 @@ void Gambit_fn_021FD00C(CPUState* cpu) {
   L_021FD0C8: ; // 0x21fd0c8
         /* 021FD0C8 */ _t30 = cpu->r[31] + 0x0000018Cu;
         /* 021FD0C8 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t30);
-        /* 021FD0CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[3]);
-        /* 021FD0D0 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FD0CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[3]));
+        /* 021FD0D0 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FD0D0 */ _t32 = _t31 & 0x00000001u;
         /* 021FD0D0 */ if (_t32) goto L_021FD0D4; else goto L_021FD198;
   L_021FD0D4: ; // 0x21fd0d4
@@ -14477,15 +14477,15 @@ void Gambit_fn_021FD00C(CPUState* cpu) {
         /* 021FD120 */ cpu->f[28] = cpu->f[12] / cpu->f[13];
         /* 021FD124 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021FD128 */ cpu->f[28] = cpu->f[28] * cpu->f[1];
-        /* 021FD12C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[30]);
-        /* 021FD130 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD12C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[30]));
+        /* 021FD130 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD130 */ _t42 = _t41 & 0x00000001u;
         /* 021FD130 */ if (_t42) goto L_021FD198; else goto L_021FD134;
   L_021FD134: ; // 0x21fd134
         /* 021FD134 */ cpu->r[3] = cpu->r[31] + 0x000000C4u;
         /* 021FD138 */ Gambit_fn_02C69350(cpu);
-        /* 021FD13C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
-        /* 021FD140 */ _t43 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FD13C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
+        /* 021FD140 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FD140 */ _t44 = _t43 & 0x00000001u;
         /* 021FD140 */ if (_t44) goto L_021FD144; else goto L_021FD198;
   L_021FD144: ; // 0x21fd144
@@ -14498,9 +14498,9 @@ void Gambit_fn_021FD00C(CPUState* cpu) {
         /* 021FD154 */ _t47 = cpu->r[31] + 0x000000CCu;
         /* 021FD154 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t47);
         /* 021FD158 */ cpu->f[0] = fma(cpu->f[9], cpu->f[9], cpu->f[0]);
-        /* 021FD15C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[30]);
+        /* 021FD15C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[30]));
         /* 021FD160 */ cpu->f[1] = cpu->f[1] + cpu->f[28];
-        /* 021FD164 */ _t48 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FD164 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FD164 */ _t49 = _t48 & 0x00000001u;
         /* 021FD164 */ if (_t49) goto L_021FD168; else goto L_021FD198;
   L_021FD168: ; // 0x21fd168
@@ -14601,9 +14601,9 @@ void Gambit_fn_021FD00C(CPUState* cpu) {
         /* 021FD264 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t79);
         /* 021FD268 */ cpu->f[7] = fma(cpu->f[28], cpu->f[28], cpu->f[10]);
         /* 021FD26C */ cpu->f[11] = cpu->f[27] - cpu->f[1];
-        /* 021FD270 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[30]);
+        /* 021FD270 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[30]));
         /* 021FD274 */ /* nop */
-        /* 021FD278 */ _t80 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FD278 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FD278 */ _t81 = _t80 & 0x00000001u;
         /* 021FD278 */ if (_t81) goto L_021FD2B8; else goto L_021FD27C;
   L_021FD27C: ; // 0x21fd27c
@@ -14682,7 +14682,7 @@ void Gambit_fn_021FD00C(CPUState* cpu) {
         /* 021FD33C */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t103);
         /* 021FD340 */ _t104 = cpu->r[1] + 0x00000040u;
         /* 021FD340 */ cpu->f[27] = rbrew_read_f64(cpu->mem, _t104);
-        /* 021FD344 */ _t105 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FD344 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FD344 */ _t106 = _t105 & 0x00000001u;
         /* 021FD344 */ if (_t106) goto L_021FD348; // else: addr-0 trap, fall-through
   L_021FD348: ; // 0x21fd348
@@ -14712,8 +14712,8 @@ void Gambit_fn_021FD358(CPUState* cpu) {
         /* 021FD36C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 021FD370 */ _t4 = cpu->r[31] + 0x00000190u;
         /* 021FD370 */ cpu->r[3] = rbrew_read32(cpu->mem, _t4);
-        /* 021FD374 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FD378 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD374 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FD378 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD378 */ _t6 = _t5 & 0x00000001u;
         /* 021FD378 */ if (_t6) goto L_021FD380; else goto L_021FD37C;
   L_021FD37C: ; // 0x21fd37c
@@ -14761,8 +14761,8 @@ void Gambit_fn_021FD358(CPUState* cpu) {
         /* 021FD3E4 */ cpu->f[10] = fma(cpu->f[10], cpu->f[10], cpu->f[0]);
         /* 021FD3E8 */ _t21 = cpu->r[6] + 0xFFFFCF84u;
         /* 021FD3E8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t21);
-        /* 021FD3EC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
-        /* 021FD3F0 */ _t22 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FD3EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
+        /* 021FD3F0 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FD3F0 */ _t23 = _t22 & 0x00000001u;
         /* 021FD3F0 */ if (_t23) goto L_021FD3F4; else goto L_021FD430;
   L_021FD3F4: ; // 0x21fd3f4
@@ -14806,7 +14806,7 @@ void Gambit_fn_021FD358(CPUState* cpu) {
         /* 021FD458 */ cpu->r[12] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t34);
         /* 021FD45C */ _t35 = cpu->r[31] + 0x00000004u;
         /* 021FD45C */ cpu->r[7] = rbrew_read32(cpu->mem, _t35);
-        /* 021FD460 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[3]);
+        /* 021FD460 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[3]));
         /* 021FD464 */ _t36 = cpu->r[7] + 0x000004ACu;
         /* 021FD464 */ cpu->r[8] = rbrew_read32(cpu->mem, _t36);
         /* 021FD468 */ /* nop */
@@ -14857,8 +14857,8 @@ void Gambit_fn_021FD358(CPUState* cpu) {
         /* 021FD4E8 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 021FD4EC */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 021FD4F0 */ Gambit_fn_021C6DD8(cpu);
-        /* 021FD4F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FD4F8 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD4F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FD4F8 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD4F8 */ _t51 = _t50 & 0x00000001u;
         /* 021FD4F8 */ if (_t51) goto L_021FD4FC; else goto L_021FD510;
   L_021FD4FC: ; // 0x21fd4fc
@@ -14884,17 +14884,17 @@ void Gambit_fn_021FD358(CPUState* cpu) {
         /* 021FD530 */ rbrew_write_f32(cpu->mem, _t55, cpu->f[13]);
         /* 021FD534 */ _t56 = cpu->r[6] + 0x00000008u;
         /* 021FD534 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t56);
-        /* 021FD538 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021FD538 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021FD53C */ _t57 = cpu->r[31] + 0x00000164u;
         /* 021FD53C */ rbrew_write_f32(cpu->mem, _t57, cpu->f[8]);
-        /* 021FD540 */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD540 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD540 */ _t59 = _t58 & 0x00000001u;
         /* 021FD540 */ if (_t59) goto L_021FD544; else goto L_021FD5B0;
   L_021FD544: ; // 0x21fd544
         /* 021FD544 */ _t60 = cpu->r[31] + 0x0000001Cu;
         /* 021FD544 */ cpu->r[0] = rbrew_read32(cpu->mem, _t60);
-        /* 021FD548 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021FD54C */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD548 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021FD54C */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD54C */ _t62 = _t61 & 0x00000001u;
         /* 021FD54C */ if (_t62) goto L_021FD550; else goto L_021FD5A4;
   L_021FD550: ; // 0x21fd550
@@ -14923,15 +14923,15 @@ void Gambit_fn_021FD358(CPUState* cpu) {
         /* 021FD58C */ cpu->r[3] = cpu->r[31];
         /* 021FD590 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021FD594 */ Gambit_fn_027E3F3C(cpu);
-        /* 021FD598 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FD59C */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD598 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FD59C */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD59C */ _t71 = _t70 & 0x00000001u;
         /* 021FD59C */ if (_t71) goto L_021FD5E0; else goto L_021FD5A0;
   L_021FD5A0: ; // 0x21fd5a0
         /* 021FD5A0 */ goto L_021FD5D8;
   L_021FD5A4: ; // 0x21fd5a4
-        /* 021FD5A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021FD5A8 */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD5A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021FD5A8 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD5A8 */ _t73 = _t72 & 0x00000001u;
         /* 021FD5A8 */ if (_t73) goto L_021FD550; else goto L_021FD5AC;
   L_021FD5AC: ; // 0x21fd5ac
@@ -14948,8 +14948,8 @@ void Gambit_fn_021FD358(CPUState* cpu) {
         /* 021FD5C4 */ cpu->r[3] = cpu->r[31];
         /* 021FD5C8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021FD5CC */ Gambit_fn_027E3F3C(cpu);
-        /* 021FD5D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FD5D4 */ _t76 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD5D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FD5D4 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD5D4 */ _t77 = _t76 & 0x00000001u;
         /* 021FD5D4 */ if (_t77) goto L_021FD5E0; else goto L_021FD5D8;
   L_021FD5D8: ; // 0x21fd5d8
@@ -14987,8 +14987,8 @@ void Gambit_fn_021FD35C(CPUState* cpu) {
         /* 021FD36C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 021FD370 */ _t4 = cpu->r[31] + 0x00000190u;
         /* 021FD370 */ cpu->r[3] = rbrew_read32(cpu->mem, _t4);
-        /* 021FD374 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FD378 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD374 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FD378 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD378 */ _t6 = _t5 & 0x00000001u;
         /* 021FD378 */ if (_t6) goto L_021FD380; else goto L_021FD37C;
   L_021FD37C: ; // 0x21fd37c
@@ -15036,8 +15036,8 @@ void Gambit_fn_021FD35C(CPUState* cpu) {
         /* 021FD3E4 */ cpu->f[10] = fma(cpu->f[10], cpu->f[10], cpu->f[0]);
         /* 021FD3E8 */ _t21 = cpu->r[6] + 0xFFFFCF84u;
         /* 021FD3E8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t21);
-        /* 021FD3EC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
-        /* 021FD3F0 */ _t22 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FD3EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
+        /* 021FD3F0 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FD3F0 */ _t23 = _t22 & 0x00000001u;
         /* 021FD3F0 */ if (_t23) goto L_021FD3F4; else goto L_021FD430;
   L_021FD3F4: ; // 0x21fd3f4
@@ -15081,7 +15081,7 @@ void Gambit_fn_021FD35C(CPUState* cpu) {
         /* 021FD458 */ cpu->r[12] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t34);
         /* 021FD45C */ _t35 = cpu->r[31] + 0x00000004u;
         /* 021FD45C */ cpu->r[7] = rbrew_read32(cpu->mem, _t35);
-        /* 021FD460 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[3]);
+        /* 021FD460 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[3]));
         /* 021FD464 */ _t36 = cpu->r[7] + 0x000004ACu;
         /* 021FD464 */ cpu->r[8] = rbrew_read32(cpu->mem, _t36);
         /* 021FD468 */ /* nop */
@@ -15132,8 +15132,8 @@ void Gambit_fn_021FD35C(CPUState* cpu) {
         /* 021FD4E8 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 021FD4EC */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 021FD4F0 */ Gambit_fn_021C6DD8(cpu);
-        /* 021FD4F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FD4F8 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD4F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FD4F8 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD4F8 */ _t51 = _t50 & 0x00000001u;
         /* 021FD4F8 */ if (_t51) goto L_021FD4FC; else goto L_021FD510;
   L_021FD4FC: ; // 0x21fd4fc
@@ -15159,17 +15159,17 @@ void Gambit_fn_021FD35C(CPUState* cpu) {
         /* 021FD530 */ rbrew_write_f32(cpu->mem, _t55, cpu->f[13]);
         /* 021FD534 */ _t56 = cpu->r[6] + 0x00000008u;
         /* 021FD534 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t56);
-        /* 021FD538 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021FD538 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021FD53C */ _t57 = cpu->r[31] + 0x00000164u;
         /* 021FD53C */ rbrew_write_f32(cpu->mem, _t57, cpu->f[8]);
-        /* 021FD540 */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD540 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD540 */ _t59 = _t58 & 0x00000001u;
         /* 021FD540 */ if (_t59) goto L_021FD544; else goto L_021FD5B0;
   L_021FD544: ; // 0x21fd544
         /* 021FD544 */ _t60 = cpu->r[31] + 0x0000001Cu;
         /* 021FD544 */ cpu->r[0] = rbrew_read32(cpu->mem, _t60);
-        /* 021FD548 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 021FD54C */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD548 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 021FD54C */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD54C */ _t62 = _t61 & 0x00000001u;
         /* 021FD54C */ if (_t62) goto L_021FD550; else goto L_021FD5A4;
   L_021FD550: ; // 0x21fd550
@@ -15198,15 +15198,15 @@ void Gambit_fn_021FD35C(CPUState* cpu) {
         /* 021FD58C */ cpu->r[3] = cpu->r[31];
         /* 021FD590 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021FD594 */ Gambit_fn_027E3F3C(cpu);
-        /* 021FD598 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FD59C */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD598 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FD59C */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD59C */ _t71 = _t70 & 0x00000001u;
         /* 021FD59C */ if (_t71) goto L_021FD5E0; else goto L_021FD5A0;
   L_021FD5A0: ; // 0x21fd5a0
         /* 021FD5A0 */ goto L_021FD5D8;
   L_021FD5A4: ; // 0x21fd5a4
-        /* 021FD5A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 021FD5A8 */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD5A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 021FD5A8 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD5A8 */ _t73 = _t72 & 0x00000001u;
         /* 021FD5A8 */ if (_t73) goto L_021FD550; else goto L_021FD5AC;
   L_021FD5AC: ; // 0x21fd5ac
@@ -15223,8 +15223,8 @@ void Gambit_fn_021FD35C(CPUState* cpu) {
         /* 021FD5C4 */ cpu->r[3] = cpu->r[31];
         /* 021FD5C8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 021FD5CC */ Gambit_fn_027E3F3C(cpu);
-        /* 021FD5D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FD5D4 */ _t76 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD5D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FD5D4 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD5D4 */ _t77 = _t76 & 0x00000001u;
         /* 021FD5D4 */ if (_t77) goto L_021FD5E0; else goto L_021FD5D8;
   L_021FD5D8: ; // 0x21fd5d8
@@ -15277,8 +15277,8 @@ void Gambit_fn_021FD600(CPUState* cpu) {
         /* 021FD640 */ cpu->r[10] = 0x10040000u;
         /* 021FD644 */ _t8 = cpu->r[10] + 0xFFFFCFA8u;
         /* 021FD644 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t8);
-        /* 021FD648 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
-        /* 021FD64C */ _t9 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FD648 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
+        /* 021FD64C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FD64C */ _t10 = _t9 & 0x00000001u;
         /* 021FD64C */ if (_t10) goto L_021FD650; else goto L_021FD654;
   L_021FD650: ; // 0x21fd650
@@ -15330,8 +15330,8 @@ void Gambit_fn_021FD604(CPUState* cpu) {
         /* 021FD640 */ cpu->r[10] = 0x10040000u;
         /* 021FD644 */ _t8 = cpu->r[10] + 0xFFFFCFA8u;
         /* 021FD644 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t8);
-        /* 021FD648 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
-        /* 021FD64C */ _t9 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FD648 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
+        /* 021FD64C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FD64C */ _t10 = _t9 & 0x00000001u;
         /* 021FD64C */ if (_t10) goto L_021FD650; else goto L_021FD654;
   L_021FD650: ; // 0x21fd650
@@ -15462,10 +15462,10 @@ void Gambit_fn_021FD6B0(CPUState* cpu) {
         /* 021FD73C */ cpu->r[0] = 0x00000000u;
         /* 021FD740 */ _t16 = cpu->r[1] + 0x00000050u;
         /* 021FD740 */ rbrew_write32(cpu->mem, _t16, cpu->r[6]);
-        /* 021FD744 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021FD744 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021FD748 */ _t17 = cpu->r[29] + 0x00000190u;
         /* 021FD748 */ rbrew_write32(cpu->mem, _t17, cpu->r[0]);
-        /* 021FD74C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD74C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD74C */ _t19 = _t18 & 0x00000001u;
         /* 021FD74C */ if (_t19) goto L_021FD750; else goto L_021FD794;
   L_021FD750: ; // 0x21fd750
@@ -15559,8 +15559,8 @@ void Gambit_fn_021FD824(CPUState* cpu) {
         /* 021FD824 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 021FD828 */ _t1 = cpu->r[5] + 0x00000000u;
         /* 021FD828 */ cpu->r[0] = rbrew_read32(cpu->mem, _t1);
-        /* 021FD82C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[11]);
-        /* 021FD830 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD82C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[11]));
+        /* 021FD830 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD830 */ _t3 = _t2 & 0x00000001u;
         /* 021FD830 */ if (_t3) goto L_021FD834; else goto L_021FD840;
   L_021FD834: ; // 0x21fd834
@@ -15618,10 +15618,10 @@ void Gambit_fn_021FD850(CPUState* cpu) {
         /* 021FD8A0 */ _t12 = cpu->r[9] + 0xFFFFCF8Cu;
         /* 021FD8A0 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t12);
         /* 021FD8A4 */ cpu->r[31] = cpu->r[5];
-        /* 021FD8A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 021FD8A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 021FD8AC */ _t13 = cpu->r[30] + 0x00000051u;
         /* 021FD8AC */ cpu->r[5] = rbrew_read8(cpu->mem, _t13);
-        /* 021FD8B0 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD8B0 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD8B0 */ _t15 = _t14 & 0x00000001u;
         /* 021FD8B0 */ if (_t15) goto L_021FDA14; else goto L_021FD8B4;
   L_021FD8B4: ; // 0x21fd8b4
@@ -15630,8 +15630,8 @@ void Gambit_fn_021FD850(CPUState* cpu) {
         /* 021FD8BC */ cpu->r[7] = cpu->r[7] + 0x00006338u;
         /* 021FD8C0 */ Gambit_fn_021F000C(cpu);
         /* 021FD8C4 */ cpu->r[28] = cpu->r[3];
-        /* 021FD8C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021FD8C8 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD8C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021FD8C8 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD8C8 */ _t17 = _t16 & 0x00000001u;
         /* 021FD8C8 */ if (_t17) goto L_021FDA14; else goto L_021FD8CC;
   L_021FD8CC: ; // 0x21fd8cc
@@ -15719,7 +15719,7 @@ void Gambit_fn_021FD850(CPUState* cpu) {
         /* 021FD9A0 */ cpu->r[11] = rbrew_read8(cpu->mem, _t45);
         /* 021FD9A4 */ _t46 = cpu->r[31] + 0x00000004u;
         /* 021FD9A4 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t46);
-        /* 021FD9A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021FD9A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021FD9AC */ _t47 = cpu->r[1] + 0x000000BCu;
         /* 021FD9AC */ rbrew_write_f32(cpu->mem, _t47, cpu->f[8]);
         /* 021FD9B0 */ cpu->r[7] = cpu->r[29];
@@ -15729,7 +15729,7 @@ void Gambit_fn_021FD850(CPUState* cpu) {
         /* 021FD9BC */ cpu->r[3] = cpu->r[28];
         /* 021FD9C0 */ _t49 = cpu->r[1] + 0x00000094u;
         /* 021FD9C0 */ rbrew_write_f32(cpu->mem, _t49, cpu->f[1]);
-        /* 021FD9C4 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD9C4 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD9C4 */ _t51 = _t50 & 0x00000001u;
         /* 021FD9C4 */ if (_t51) goto L_021FD9F0; else goto L_021FD9C8;
   L_021FD9C8: ; // 0x21fd9c8
@@ -15960,7 +15960,7 @@ void Gambit_fn_021FD850(CPUState* cpu) {
         /* 021FDBDC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t139);
         /* 021FDBE0 */ _t140 = cpu->r[1] + 0x000000D4u;
         /* 021FDBE0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t140);
-        /* 021FDBE4 */ _t141 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FDBE4 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FDBE4 */ _t142 = _t141 & 0x00000001u;
         /* 021FDBE4 */ if (_t142) goto L_021FDBE8; // else: addr-0 trap, fall-through
   L_021FDBE8: ; // 0x21fdbe8
@@ -16011,10 +16011,10 @@ void Gambit_fn_021FD854(CPUState* cpu) {
         /* 021FD8A0 */ _t12 = cpu->r[9] + 0xFFFFCF8Cu;
         /* 021FD8A0 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t12);
         /* 021FD8A4 */ cpu->r[31] = cpu->r[5];
-        /* 021FD8A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 021FD8A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 021FD8AC */ _t13 = cpu->r[30] + 0x00000051u;
         /* 021FD8AC */ cpu->r[5] = rbrew_read8(cpu->mem, _t13);
-        /* 021FD8B0 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD8B0 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD8B0 */ _t15 = _t14 & 0x00000001u;
         /* 021FD8B0 */ if (_t15) goto L_021FDA14; else goto L_021FD8B4;
   L_021FD8B4: ; // 0x21fd8b4
@@ -16023,8 +16023,8 @@ void Gambit_fn_021FD854(CPUState* cpu) {
         /* 021FD8BC */ cpu->r[7] = cpu->r[7] + 0x00006338u;
         /* 021FD8C0 */ Gambit_fn_021F000C(cpu);
         /* 021FD8C4 */ cpu->r[28] = cpu->r[3];
-        /* 021FD8C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 021FD8C8 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD8C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 021FD8C8 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD8C8 */ _t17 = _t16 & 0x00000001u;
         /* 021FD8C8 */ if (_t17) goto L_021FDA14; else goto L_021FD8CC;
   L_021FD8CC: ; // 0x21fd8cc
@@ -16112,7 +16112,7 @@ void Gambit_fn_021FD854(CPUState* cpu) {
         /* 021FD9A0 */ cpu->r[11] = rbrew_read8(cpu->mem, _t45);
         /* 021FD9A4 */ _t46 = cpu->r[31] + 0x00000004u;
         /* 021FD9A4 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t46);
-        /* 021FD9A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021FD9A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021FD9AC */ _t47 = cpu->r[1] + 0x000000BCu;
         /* 021FD9AC */ rbrew_write_f32(cpu->mem, _t47, cpu->f[8]);
         /* 021FD9B0 */ cpu->r[7] = cpu->r[29];
@@ -16122,7 +16122,7 @@ void Gambit_fn_021FD854(CPUState* cpu) {
         /* 021FD9BC */ cpu->r[3] = cpu->r[28];
         /* 021FD9C0 */ _t49 = cpu->r[1] + 0x00000094u;
         /* 021FD9C0 */ rbrew_write_f32(cpu->mem, _t49, cpu->f[1]);
-        /* 021FD9C4 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FD9C4 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FD9C4 */ _t51 = _t50 & 0x00000001u;
         /* 021FD9C4 */ if (_t51) goto L_021FD9F0; else goto L_021FD9C8;
   L_021FD9C8: ; // 0x21fd9c8
@@ -16353,7 +16353,7 @@ void Gambit_fn_021FD854(CPUState* cpu) {
         /* 021FDBDC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t139);
         /* 021FDBE0 */ _t140 = cpu->r[1] + 0x000000D4u;
         /* 021FDBE0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t140);
-        /* 021FDBE4 */ _t141 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FDBE4 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FDBE4 */ _t142 = _t141 & 0x00000001u;
         /* 021FDBE4 */ if (_t142) goto L_021FDBE8; // else: addr-0 trap, fall-through
   L_021FDBE8: ; // 0x21fdbe8
@@ -16384,8 +16384,8 @@ void Gambit_fn_021FDBF8(CPUState* cpu) {
         /* 021FDC10 */ cpu->ctr = cpu->r[0];
         /* 021FDC14 */ cpu->r[31] = cpu->r[3];
         /* 021FDC18 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021FDC1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FDC20 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FDC1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FDC20 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FDC20 */ _t6 = _t5 & 0x00000001u;
         /* 021FDC20 */ if (_t6) goto L_021FDC4C; else goto L_021FDC24;
   L_021FDC24: ; // 0x21fdc24
@@ -16438,8 +16438,8 @@ void Gambit_fn_021FDBFC(CPUState* cpu) {
         /* 021FDC10 */ cpu->ctr = cpu->r[0];
         /* 021FDC14 */ cpu->r[31] = cpu->r[3];
         /* 021FDC18 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021FDC1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FDC20 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FDC1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FDC20 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FDC20 */ _t6 = _t5 & 0x00000001u;
         /* 021FDC20 */ if (_t6) goto L_021FDC4C; else goto L_021FDC24;
   L_021FDC24: ; // 0x21fdc24
@@ -16505,10 +16505,10 @@ void Gambit_fn_021FDC78(CPUState* cpu) {
         /* 021FDCB0 */ cpu->r[28] = cpu->r[31] + 0x00000048u;
         /* 021FDCB4 */ cpu->r[9] = 0x10040000u;
         /* 021FDCB8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021FDCB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021FDCB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021FDCBC */ _t9 = cpu->r[9] + 0xFFFFCF8Cu;
         /* 021FDCBC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t9);
-        /* 021FDCC0 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FDCC0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FDCC0 */ _t11 = _t10 & 0x00000001u;
         /* 021FDCC0 */ if (_t11) goto L_021FDD04; else goto L_021FDCC4;
   L_021FDCC4: ; // 0x21fdcc4
@@ -16517,10 +16517,10 @@ void Gambit_fn_021FDC78(CPUState* cpu) {
         /* 021FDCCC */ cpu->r[12] = 0x10040000u;
         /* 021FDCD0 */ _t12 = cpu->r[12] + 0xFFFFCF84u;
         /* 021FDCD0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t12);
-        /* 021FDCD4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
+        /* 021FDCD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
         /* 021FDCD8 */ _t13 = cpu->r[31] + 0x00000000u;
         /* 021FDCD8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t13);
-        /* 021FDCDC */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FDCDC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FDCDC */ _t15 = _t14 & 0x00000001u;
         /* 021FDCDC */ if (_t15) goto L_021FDCE0; else goto L_021FDCFC;
   L_021FDCE0: ; // 0x21fdce0
@@ -16597,7 +16597,7 @@ void Gambit_fn_021FDC78(CPUState* cpu) {
         /* 021FDD8C */ _t41 = cpu->r[1] + 0x00000044u;
         /* 021FDD8C */ cpu->r[31] = rbrew_read32(cpu->mem, _t41);
         /* 021FDD90 */ cpu->r[3] = 0x00000001u;
-        /* 021FDD94 */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FDD94 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FDD94 */ _t43 = _t42 & 0x00000001u;
         /* 021FDD94 */ if (_t43) goto L_021FDD98; // else: addr-0 trap, fall-through
   L_021FDD98: ; // 0x21fdd98
@@ -16640,10 +16640,10 @@ void Gambit_fn_021FDDA8(CPUState* cpu) {
         /* 021FDDE0 */ cpu->r[28] = cpu->r[31] + 0x000000A8u;
         /* 021FDDE4 */ cpu->r[9] = 0x10040000u;
         /* 021FDDE8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 021FDDE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021FDDE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021FDDEC */ _t9 = cpu->r[9] + 0xFFFFCF8Cu;
         /* 021FDDEC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t9);
-        /* 021FDDF0 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FDDF0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FDDF0 */ _t11 = _t10 & 0x00000001u;
         /* 021FDDF0 */ if (_t11) goto L_021FDE34; else goto L_021FDDF4;
   L_021FDDF4: ; // 0x21fddf4
@@ -16652,10 +16652,10 @@ void Gambit_fn_021FDDA8(CPUState* cpu) {
         /* 021FDDFC */ cpu->r[12] = 0x10040000u;
         /* 021FDE00 */ _t12 = cpu->r[12] + 0xFFFFCF84u;
         /* 021FDE00 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t12);
-        /* 021FDE04 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
+        /* 021FDE04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
         /* 021FDE08 */ _t13 = cpu->r[31] + 0x00000000u;
         /* 021FDE08 */ cpu->r[8] = rbrew_read32(cpu->mem, _t13);
-        /* 021FDE0C */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FDE0C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FDE0C */ _t15 = _t14 & 0x00000001u;
         /* 021FDE0C */ if (_t15) goto L_021FDE10; else goto L_021FDE2C;
   L_021FDE10: ; // 0x21fde10
@@ -16732,7 +16732,7 @@ void Gambit_fn_021FDDA8(CPUState* cpu) {
         /* 021FDEBC */ _t41 = cpu->r[1] + 0x00000044u;
         /* 021FDEBC */ cpu->r[31] = rbrew_read32(cpu->mem, _t41);
         /* 021FDEC0 */ cpu->r[3] = 0x00000001u;
-        /* 021FDEC4 */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FDEC4 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FDEC4 */ _t43 = _t42 & 0x00000001u;
         /* 021FDEC4 */ if (_t43) goto L_021FDEC8; // else: addr-0 trap, fall-through
   L_021FDEC8: ; // 0x21fdec8
@@ -16783,11 +16783,11 @@ void Gambit_fn_021FDED8(CPUState* cpu) {
         /* 021FDF2C */ cpu->f[3] = cpu->f[1];
         /* 021FDF30 */ _t10 = cpu->r[11] + 0x00001EF8u;
         /* 021FDF30 */ cpu->r[3] = rbrew_read32(cpu->mem, _t10);
-        /* 021FDF34 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[0]);
+        /* 021FDF34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[0]));
         /* 021FDF38 */ _t11 = cpu->r[29] + 0x000000B4u;
         /* 021FDF38 */ cpu->r[9] = rbrew_read32(cpu->mem, _t11);
         /* 021FDF3C */ cpu->r[4] = cpu->r[30];
-        /* 021FDF40 */ _t12 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FDF40 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FDF40 */ _t13 = _t12 & 0x00000001u;
         /* 021FDF40 */ if (_t13) goto L_021FDF78; else goto L_021FDF44;
   L_021FDF44: ; // 0x21fdf44
@@ -16836,7 +16836,7 @@ void Gambit_fn_021FDED8(CPUState* cpu) {
         /* 021FDFBC */ cpu->r[31] = rbrew_read32(cpu->mem, _t23);
         /* 021FDFC0 */ _t24 = cpu->r[1] + 0x00000010u;
         /* 021FDFC0 */ cpu->r[30] = rbrew_read32(cpu->mem, _t24);
-        /* 021FDFC4 */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FDFC4 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FDFC4 */ _t26 = _t25 & 0x00000001u;
         /* 021FDFC4 */ if (_t26) goto L_021FDFC8; // else: addr-0 trap, fall-through
   L_021FDFC8: ; // 0x21fdfc8
@@ -16886,11 +16886,11 @@ void Gambit_fn_021FDEDC(CPUState* cpu) {
         /* 021FDF2C */ cpu->f[3] = cpu->f[1];
         /* 021FDF30 */ _t10 = cpu->r[11] + 0x00001EF8u;
         /* 021FDF30 */ cpu->r[3] = rbrew_read32(cpu->mem, _t10);
-        /* 021FDF34 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[0]);
+        /* 021FDF34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[0]));
         /* 021FDF38 */ _t11 = cpu->r[29] + 0x000000B4u;
         /* 021FDF38 */ cpu->r[9] = rbrew_read32(cpu->mem, _t11);
         /* 021FDF3C */ cpu->r[4] = cpu->r[30];
-        /* 021FDF40 */ _t12 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FDF40 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FDF40 */ _t13 = _t12 & 0x00000001u;
         /* 021FDF40 */ if (_t13) goto L_021FDF78; else goto L_021FDF44;
   L_021FDF44: ; // 0x21fdf44
@@ -16939,7 +16939,7 @@ void Gambit_fn_021FDEDC(CPUState* cpu) {
         /* 021FDFBC */ cpu->r[31] = rbrew_read32(cpu->mem, _t23);
         /* 021FDFC0 */ _t24 = cpu->r[1] + 0x00000010u;
         /* 021FDFC0 */ cpu->r[30] = rbrew_read32(cpu->mem, _t24);
-        /* 021FDFC4 */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FDFC4 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FDFC4 */ _t26 = _t25 & 0x00000001u;
         /* 021FDFC4 */ if (_t26) goto L_021FDFC8; // else: addr-0 trap, fall-through
   L_021FDFC8: ; // 0x21fdfc8
@@ -16975,8 +16975,8 @@ void Gambit_fn_021FDFD8(CPUState* cpu) {
         /* 021FE000 */ _t5 = cpu->r[31] + 0x000000B0u;
         /* 021FE000 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 021FE004 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021FE004 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FE008 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE004 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FE008 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE008 */ _t7 = _t6 & 0x00000001u;
         /* 021FE008 */ if (_t7) goto L_021FE00C; else goto L_021FE0A4;
   L_021FE00C: ; // 0x21fe00c
@@ -16999,10 +16999,10 @@ void Gambit_fn_021FDFD8(CPUState* cpu) {
         /* 021FE03C */ cpu->f[1] = fma(cpu->f[10], cpu->f[10], cpu->f[9]);
         /* 021FE040 */ _t12 = cpu->r[12] + 0xFFFFCF84u;
         /* 021FE040 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t12);
-        /* 021FE044 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
+        /* 021FE044 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
         /* 021FE048 */ _t13 = cpu->r[1] + 0x00000010u;
         /* 021FE048 */ rbrew_write_f32(cpu->mem, _t13, cpu->f[10]);
-        /* 021FE04C */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FE04C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FE04C */ _t15 = _t14 & 0x00000001u;
         /* 021FE04C */ if (_t15) goto L_021FE050; else goto L_021FE090;
   L_021FE050: ; // 0x21fe050
@@ -17042,7 +17042,7 @@ void Gambit_fn_021FDFD8(CPUState* cpu) {
         /* 021FE0AC */ _t24 = cpu->r[1] + 0x00000018u;
         /* 021FE0AC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t24);
         /* 021FE0B0 */ cpu->r[3] = 0x00000001u;
-        /* 021FE0B4 */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FE0B4 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FE0B4 */ _t26 = _t25 & 0x00000001u;
         /* 021FE0B4 */ if (_t26) goto L_021FE0B8; // else: addr-0 trap, fall-through
   L_021FE0B8: ; // 0x21fe0b8
@@ -17077,8 +17077,8 @@ void Gambit_fn_021FDFDC(CPUState* cpu) {
         /* 021FE000 */ _t5 = cpu->r[31] + 0x000000B0u;
         /* 021FE000 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 021FE004 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021FE004 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FE008 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE004 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FE008 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE008 */ _t7 = _t6 & 0x00000001u;
         /* 021FE008 */ if (_t7) goto L_021FE00C; else goto L_021FE0A4;
   L_021FE00C: ; // 0x21fe00c
@@ -17101,10 +17101,10 @@ void Gambit_fn_021FDFDC(CPUState* cpu) {
         /* 021FE03C */ cpu->f[1] = fma(cpu->f[10], cpu->f[10], cpu->f[9]);
         /* 021FE040 */ _t12 = cpu->r[12] + 0xFFFFCF84u;
         /* 021FE040 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t12);
-        /* 021FE044 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
+        /* 021FE044 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
         /* 021FE048 */ _t13 = cpu->r[1] + 0x00000010u;
         /* 021FE048 */ rbrew_write_f32(cpu->mem, _t13, cpu->f[10]);
-        /* 021FE04C */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FE04C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FE04C */ _t15 = _t14 & 0x00000001u;
         /* 021FE04C */ if (_t15) goto L_021FE050; else goto L_021FE090;
   L_021FE050: ; // 0x21fe050
@@ -17144,7 +17144,7 @@ void Gambit_fn_021FDFDC(CPUState* cpu) {
         /* 021FE0AC */ _t24 = cpu->r[1] + 0x00000018u;
         /* 021FE0AC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t24);
         /* 021FE0B0 */ cpu->r[3] = 0x00000001u;
-        /* 021FE0B4 */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FE0B4 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FE0B4 */ _t26 = _t25 & 0x00000001u;
         /* 021FE0B4 */ if (_t26) goto L_021FE0B8; // else: addr-0 trap, fall-through
   L_021FE0B8: ; // 0x21fe0b8
@@ -17168,7 +17168,7 @@ void Gambit_fn_021FE0C8(CPUState* cpu) {
         /* 021FE0D4 */ _t2 = cpu->r[4] + 0x00000000u;
         /* 021FE0D4 */ rbrew_write16(cpu->mem, _t2, (uint16_t)cpu->r[10]);
         /* 021FE0D8 */ cpu->r[12] = cpu->r[11] & 0x0000FEFFu;
-        /* 021FE0D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021FE0D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021FE0DC */ cpu->r[0] = 0x00000000u;
         /* 021FE0E0 */ _t3 = cpu->r[4] + 0x00000002u;
         /* 021FE0E0 */ rbrew_write16(cpu->mem, _t3, (uint16_t)cpu->r[12]);
@@ -17209,15 +17209,15 @@ void Gambit_fn_021FE11C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_021FE11C: ; // 0x21fe11c
-        /* 021FE11C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FE120 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE11C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FE120 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE120 */ _t1 = _t0 & 0x00000001u;
         /* 021FE120 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021FE120 */ goto L_021FE124;
   L_021FE124: ; // 0x21fe124
         /* 021FE124 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 021FE124 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FE128 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE124 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FE128 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE128 */ _t3 = _t2 & 0x00000001u;
         /* 021FE128 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 021FE128 */ goto L_021FE12C;
@@ -17236,8 +17236,8 @@ void Gambit_fn_021FE11C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -17251,15 +17251,15 @@ void Gambit_fn_021FE11C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -17344,8 +17344,8 @@ void Gambit_fn_021FE154(CPUState* cpu) {
         /* 021FE154 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021FE154 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021FE158 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021FE158 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021FE15C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021FE15C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE15C */ _t2 = _t1 & 0x00000001u;
         /* 021FE15C */ _t3 = _t2 ^ 0x00000001u;
         /* 021FE15C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -17367,8 +17367,8 @@ void Gambit_fn_021FE170(CPUState* cpu) {
         /* 021FE170 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021FE170 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021FE174 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021FE174 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021FE178 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE174 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021FE178 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE178 */ _t2 = _t1 & 0x00000001u;
         /* 021FE178 */ _t3 = _t2 ^ 0x00000001u;
         /* 021FE178 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -17390,8 +17390,8 @@ void Gambit_fn_021FE18C(CPUState* cpu) {
         /* 021FE18C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021FE18C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021FE190 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021FE190 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021FE194 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE190 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021FE194 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE194 */ _t2 = _t1 & 0x00000001u;
         /* 021FE194 */ _t3 = _t2 ^ 0x00000001u;
         /* 021FE194 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -17434,8 +17434,8 @@ void Gambit_fn_021FE1B8(CPUState* cpu) {
         /* 021FE1C8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021FE1CC */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021FE1CC */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021FE1D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021FE1D4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE1D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021FE1D4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE1D4 */ _t5 = _t4 & 0x00000001u;
         /* 021FE1D4 */ if (_t5) goto L_021FE1D8; else goto L_021FE1F4;
   L_021FE1D8: ; // 0x21fe1d8
@@ -17474,8 +17474,8 @@ void Gambit_fn_021FE1BC(CPUState* cpu) {
         /* 021FE1C8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021FE1CC */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021FE1CC */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021FE1D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021FE1D4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE1D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021FE1D4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE1D4 */ _t5 = _t4 & 0x00000001u;
         /* 021FE1D4 */ if (_t5) goto L_021FE1D8; else goto L_021FE1F4;
   L_021FE1D8: ; // 0x21fe1d8
@@ -37,8 +37,8 @@ void Gambit_fn_021FE3C8(CPUState* cpu) {
         /* 021FE3C8 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 021FE3C8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021FE3CC */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 021FE3CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FE3D0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE3CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FE3D0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE3D0 */ _t2 = _t1 & 0x00000001u;
         /* 021FE3D0 */ if (_t2) goto L_021FE3E0; else goto L_021FE3D4;
   L_021FE3D4: ; // 0x21fe3d4
@@ -67,8 +67,8 @@ void Gambit_fn_021FE3EC(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -134,10 +134,10 @@ void Gambit_fn_021FE41C(CPUState* cpu) {
         /* 021FE41C */ cpu->r[10] = 0x101D0000u;
         /* 021FE420 */ _t0 = cpu->r[10] + 0xFFFFFDACu;
         /* 021FE420 */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 021FE424 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021FE424 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021FE428 */ cpu->r[10] = 0x101D0000u;
         /* 021FE42C */ cpu->r[10] = cpu->r[10] + 0xFFFFFE60u;
-        /* 021FE430 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE430 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE430 */ _t2 = _t1 & 0x00000001u;
         /* 021FE430 */ if (_t2) goto L_021FE434; else goto L_021FE44C;
   L_021FE434: ; // 0x21fe434
@@ -150,8 +150,8 @@ void Gambit_fn_021FE41C(CPUState* cpu) {
         /* 021FE448 */ _t4 = cpu->r[10] + 0x00000000u;
         /* 021FE448 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_021FE44C: ; // 0x21fe44c
-        /* 021FE44C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021FE450 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE44C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021FE450 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE450 */ _t6 = _t5 & 0x00000001u;
         /* 021FE450 */ if (_t6) goto L_021FE454; else goto L_021FE45C;
   L_021FE454: ; // 0x21fe454
@@ -162,9 +162,9 @@ void Gambit_fn_021FE41C(CPUState* cpu) {
         /* 021FE460 */ _t7 = cpu->r[9] + 0xFFFFDA00u;
         /* 021FE460 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 021FE464 */ cpu->r[11] = 0x101D0000u;
-        /* 021FE468 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021FE468 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021FE46C */ cpu->r[11] = cpu->r[11] + 0xFFFFFBFCu;
-        /* 021FE470 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE470 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE470 */ _t9 = _t8 & 0x00000001u;
         /* 021FE470 */ if (_t9) goto L_021FE474; else goto L_021FE48C;
   L_021FE474: ; // 0x21fe474
@@ -177,8 +177,8 @@ void Gambit_fn_021FE41C(CPUState* cpu) {
         /* 021FE488 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 021FE488 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_021FE48C: ; // 0x21fe48c
-        /* 021FE48C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 021FE490 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE48C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 021FE490 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE490 */ _t13 = _t12 & 0x00000001u;
         /* 021FE490 */ if (_t13) goto L_021FE494; else goto L_021FE49C;
   L_021FE494: ; // 0x21fe494
@@ -189,9 +189,9 @@ void Gambit_fn_021FE41C(CPUState* cpu) {
         /* 021FE4A0 */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021FE4A0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 021FE4A4 */ cpu->r[9] = 0x101D0000u;
-        /* 021FE4A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021FE4A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021FE4AC */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 021FE4B0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE4B0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE4B0 */ _t16 = _t15 & 0x00000001u;
         /* 021FE4B0 */ if (_t16) goto L_021FE4B4; else goto L_021FE4CC;
   L_021FE4B4: ; // 0x21fe4b4
@@ -204,8 +204,8 @@ void Gambit_fn_021FE41C(CPUState* cpu) {
         /* 021FE4C8 */ _t18 = cpu->r[9] + 0x00000000u;
         /* 021FE4C8 */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_021FE4CC: ; // 0x21fe4cc
-        /* 021FE4CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 021FE4D0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE4CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 021FE4D0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE4D0 */ _t20 = _t19 & 0x00000001u;
         /* 021FE4D0 */ if (_t20) goto L_021FE4D4; else goto L_021FE4DC;
   L_021FE4D4: ; // 0x21fe4d4
@@ -217,9 +217,9 @@ void Gambit_fn_021FE41C(CPUState* cpu) {
         /* 021FE4E0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 021FE4E0 */ cpu->r[9] = _t21;
         /* 021FE4E4 */ cpu->r[10] = 0x101D0000u;
-        /* 021FE4E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FE4E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FE4EC */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 021FE4F0 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE4F0 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE4F0 */ _t23 = _t22 & 0x00000001u;
         /* 021FE4F0 */ if (_t23) goto L_021FE4F4; else goto L_021FE508;
   L_021FE4F4: ; // 0x21fe4f4
@@ -231,8 +231,8 @@ void Gambit_fn_021FE41C(CPUState* cpu) {
         /* 021FE504 */ _t25 = cpu->r[10] + 0x00000000u;
         /* 021FE504 */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_021FE508: ; // 0x21fe508
-        /* 021FE508 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021FE50C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE508 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021FE50C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE50C */ _t27 = _t26 & 0x00000001u;
         /* 021FE50C */ if (_t27) goto L_021FE510; else goto L_021FE518;
   L_021FE510: ; // 0x21fe510
@@ -244,9 +244,9 @@ void Gambit_fn_021FE41C(CPUState* cpu) {
         /* 021FE51C */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 021FE51C */ cpu->r[10] = _t28;
         /* 021FE520 */ cpu->r[11] = 0x101D0000u;
-        /* 021FE524 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 021FE524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 021FE528 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 021FE52C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE52C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE52C */ _t30 = _t29 & 0x00000001u;
         /* 021FE52C */ if (_t30) goto L_021FE530; else goto L_021FE544;
   L_021FE530: ; // 0x21fe530
@@ -406,8 +406,8 @@ void Gambit_fn_021FE5F4(CPUState* cpu) {
         /* 021FE5F4 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021FE5F4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021FE5F8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 021FE5F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021FE5FC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE5F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021FE5FC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE5FC */ _t2 = _t1 & 0x00000001u;
         /* 021FE5FC */ _t3 = _t2 ^ 0x00000001u;
         /* 021FE5FC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -429,8 +429,8 @@ void Gambit_fn_021FE610(CPUState* cpu) {
         /* 021FE610 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021FE610 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021FE614 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 021FE614 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021FE618 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE614 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021FE618 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE618 */ _t2 = _t1 & 0x00000001u;
         /* 021FE618 */ _t3 = _t2 ^ 0x00000001u;
         /* 021FE618 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -452,8 +452,8 @@ void Gambit_fn_021FE62C(CPUState* cpu) {
         /* 021FE62C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 021FE62C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021FE630 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 021FE630 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021FE634 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE630 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021FE634 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE634 */ _t2 = _t1 & 0x00000001u;
         /* 021FE634 */ _t3 = _t2 ^ 0x00000001u;
         /* 021FE634 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -496,8 +496,8 @@ void Gambit_fn_021FE658(CPUState* cpu) {
         /* 021FE668 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021FE66C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021FE66C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021FE670 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021FE674 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE670 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021FE674 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE674 */ _t5 = _t4 & 0x00000001u;
         /* 021FE674 */ if (_t5) goto L_021FE678; else goto L_021FE694;
   L_021FE678: ; // 0x21fe678
@@ -536,8 +536,8 @@ void Gambit_fn_021FE65C(CPUState* cpu) {
         /* 021FE668 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021FE66C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 021FE66C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 021FE670 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 021FE674 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE670 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 021FE674 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE674 */ _t5 = _t4 & 0x00000001u;
         /* 021FE674 */ if (_t5) goto L_021FE678; else goto L_021FE694;
   L_021FE678: ; // 0x21fe678
@@ -951,8 +951,8 @@ void Gambit_fn_021FE83C(CPUState* cpu) {
         /* 021FE83C */ _t0 = cpu->r[3] + 0x00000114u;
         /* 021FE83C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 021FE840 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 021FE840 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FE844 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE840 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FE844 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE844 */ _t2 = _t1 & 0x00000001u;
         /* 021FE844 */ if (_t2) goto L_021FE854; else goto L_021FE848;
   L_021FE848: ; // 0x21fe848
@@ -981,8 +981,8 @@ void Gambit_fn_021FE860(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -1070,9 +1070,9 @@ void Gambit_fn_021FE8A8(CPUState* cpu) {
         /* 021FE8AC */ _t0 = cpu->r[8] + 0xFFFFFD9Cu;
         /* 021FE8AC */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 021FE8B0 */ cpu->r[6] = 0x101D0000u;
-        /* 021FE8B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021FE8B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021FE8B8 */ cpu->r[6] = cpu->r[6] + 0xFFFFFE8Cu;
-        /* 021FE8BC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE8BC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE8BC */ _t2 = _t1 & 0x00000001u;
         /* 021FE8BC */ if (_t2) goto L_021FE8C0; else goto L_021FE8D8;
   L_021FE8C0: ; // 0x21fe8c0
@@ -1085,8 +1085,8 @@ void Gambit_fn_021FE8A8(CPUState* cpu) {
         /* 021FE8D4 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 021FE8D4 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_021FE8D8: ; // 0x21fe8d8
-        /* 021FE8D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 021FE8DC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE8D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 021FE8DC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE8DC */ _t6 = _t5 & 0x00000001u;
         /* 021FE8DC */ if (_t6) goto L_021FE8E0; else goto L_021FE8E8;
   L_021FE8E0: ; // 0x21fe8e0
@@ -1097,9 +1097,9 @@ void Gambit_fn_021FE8A8(CPUState* cpu) {
         /* 021FE8EC */ _t7 = cpu->r[10] + 0xFFFFE620u;
         /* 021FE8EC */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 021FE8F0 */ cpu->r[8] = 0x101D0000u;
-        /* 021FE8F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021FE8F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021FE8F8 */ cpu->r[8] = cpu->r[8] + 0xFFFFFE88u;
-        /* 021FE8FC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE8FC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE8FC */ _t9 = _t8 & 0x00000001u;
         /* 021FE8FC */ if (_t9) goto L_021FE900; else goto L_021FE918;
   L_021FE900: ; // 0x21fe900
@@ -1112,8 +1112,8 @@ void Gambit_fn_021FE8A8(CPUState* cpu) {
         /* 021FE914 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 021FE914 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_021FE918: ; // 0x21fe918
-        /* 021FE918 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021FE91C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021FE91C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE91C */ _t13 = _t12 & 0x00000001u;
         /* 021FE91C */ if (_t13) goto L_021FE920; else goto L_021FE928;
   L_021FE920: ; // 0x21fe920
@@ -1124,9 +1124,9 @@ void Gambit_fn_021FE8A8(CPUState* cpu) {
         /* 021FE92C */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 021FE92C */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 021FE930 */ cpu->r[10] = 0x101D0000u;
-        /* 021FE934 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021FE934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021FE938 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 021FE93C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE93C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE93C */ _t16 = _t15 & 0x00000001u;
         /* 021FE93C */ if (_t16) goto L_021FE940; else goto L_021FE958;
   L_021FE940: ; // 0x21fe940
@@ -1139,8 +1139,8 @@ void Gambit_fn_021FE8A8(CPUState* cpu) {
         /* 021FE954 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 021FE954 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_021FE958: ; // 0x21fe958
-        /* 021FE958 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021FE95C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE958 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021FE95C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE95C */ _t20 = _t19 & 0x00000001u;
         /* 021FE95C */ if (_t20) goto L_021FE960; else goto L_021FE968;
   L_021FE960: ; // 0x21fe960
@@ -1151,9 +1151,9 @@ void Gambit_fn_021FE8A8(CPUState* cpu) {
         /* 021FE96C */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021FE96C */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021FE970 */ cpu->r[12] = 0x101D0000u;
-        /* 021FE974 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021FE974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021FE978 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021FE97C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE97C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE97C */ _t23 = _t22 & 0x00000001u;
         /* 021FE97C */ if (_t23) goto L_021FE980; else goto L_021FE998;
   L_021FE980: ; // 0x21fe980
@@ -1166,8 +1166,8 @@ void Gambit_fn_021FE8A8(CPUState* cpu) {
         /* 021FE994 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 021FE994 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_021FE998: ; // 0x21fe998
-        /* 021FE998 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021FE99C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE998 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021FE99C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE99C */ _t27 = _t26 & 0x00000001u;
         /* 021FE99C */ if (_t27) goto L_021FE9A0; else goto L_021FE9A8;
   L_021FE9A0: ; // 0x21fe9a0
@@ -1179,9 +1179,9 @@ void Gambit_fn_021FE8A8(CPUState* cpu) {
         /* 021FE9AC */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 021FE9AC */ cpu->r[10] = _t28;
         /* 021FE9B0 */ cpu->r[7] = 0x101D0000u;
-        /* 021FE9B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021FE9B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021FE9B8 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 021FE9BC */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE9BC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE9BC */ _t30 = _t29 & 0x00000001u;
         /* 021FE9BC */ if (_t30) goto L_021FE9C0; else goto L_021FE9D4;
   L_021FE9C0: ; // 0x21fe9c0
@@ -1193,8 +1193,8 @@ void Gambit_fn_021FE8A8(CPUState* cpu) {
         /* 021FE9D0 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 021FE9D0 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_021FE9D4: ; // 0x21fe9d4
-        /* 021FE9D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 021FE9D8 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE9D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 021FE9D8 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE9D8 */ _t34 = _t33 & 0x00000001u;
         /* 021FE9D8 */ if (_t34) goto L_021FE9DC; else goto L_021FE9E4;
   L_021FE9DC: ; // 0x21fe9dc
@@ -1206,9 +1206,9 @@ void Gambit_fn_021FE8A8(CPUState* cpu) {
         /* 021FE9E8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 021FE9E8 */ cpu->r[8] = _t35;
         /* 021FE9EC */ cpu->r[6] = 0x101D0000u;
-        /* 021FE9F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021FE9F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021FE9F4 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 021FE9F8 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FE9F8 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FE9F8 */ _t37 = _t36 & 0x00000001u;
         /* 021FE9F8 */ if (_t37) goto L_021FE9FC; else goto L_021FEA10;
   L_021FE9FC: ; // 0x21fe9fc
@@ -1247,9 +1247,9 @@ void Gambit_fn_021FEA34(CPUState* cpu) {
         /* 021FEA38 */ _t0 = cpu->r[8] + 0xFFFFFDA0u;
         /* 021FEA38 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 021FEA3C */ cpu->r[6] = 0x101D0000u;
-        /* 021FEA40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021FEA40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021FEA44 */ cpu->r[6] = cpu->r[6] + 0xFFFFFE90u;
-        /* 021FEA48 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEA48 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEA48 */ _t2 = _t1 & 0x00000001u;
         /* 021FEA48 */ if (_t2) goto L_021FEA4C; else goto L_021FEA64;
   L_021FEA4C: ; // 0x21fea4c
@@ -1262,8 +1262,8 @@ void Gambit_fn_021FEA34(CPUState* cpu) {
         /* 021FEA60 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 021FEA60 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_021FEA64: ; // 0x21fea64
-        /* 021FEA64 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 021FEA68 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEA64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 021FEA68 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEA68 */ _t6 = _t5 & 0x00000001u;
         /* 021FEA68 */ if (_t6) goto L_021FEA6C; else goto L_021FEA74;
   L_021FEA6C: ; // 0x21fea6c
@@ -1274,9 +1274,9 @@ void Gambit_fn_021FEA34(CPUState* cpu) {
         /* 021FEA78 */ _t7 = cpu->r[10] + 0xFFFFE620u;
         /* 021FEA78 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 021FEA7C */ cpu->r[8] = 0x101D0000u;
-        /* 021FEA80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021FEA80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021FEA84 */ cpu->r[8] = cpu->r[8] + 0xFFFFFE88u;
-        /* 021FEA88 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEA88 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEA88 */ _t9 = _t8 & 0x00000001u;
         /* 021FEA88 */ if (_t9) goto L_021FEA8C; else goto L_021FEAA4;
   L_021FEA8C: ; // 0x21fea8c
@@ -1289,8 +1289,8 @@ void Gambit_fn_021FEA34(CPUState* cpu) {
         /* 021FEAA0 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 021FEAA0 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_021FEAA4: ; // 0x21feaa4
-        /* 021FEAA4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021FEAA8 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEAA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021FEAA8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEAA8 */ _t13 = _t12 & 0x00000001u;
         /* 021FEAA8 */ if (_t13) goto L_021FEAAC; else goto L_021FEAB4;
   L_021FEAAC: ; // 0x21feaac
@@ -1301,9 +1301,9 @@ void Gambit_fn_021FEA34(CPUState* cpu) {
         /* 021FEAB8 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 021FEAB8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 021FEABC */ cpu->r[10] = 0x101D0000u;
-        /* 021FEAC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021FEAC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021FEAC4 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 021FEAC8 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEAC8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEAC8 */ _t16 = _t15 & 0x00000001u;
         /* 021FEAC8 */ if (_t16) goto L_021FEACC; else goto L_021FEAE4;
   L_021FEACC: ; // 0x21feacc
@@ -1316,8 +1316,8 @@ void Gambit_fn_021FEA34(CPUState* cpu) {
         /* 021FEAE0 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 021FEAE0 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_021FEAE4: ; // 0x21feae4
-        /* 021FEAE4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021FEAE8 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEAE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021FEAE8 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEAE8 */ _t20 = _t19 & 0x00000001u;
         /* 021FEAE8 */ if (_t20) goto L_021FEAEC; else goto L_021FEAF4;
   L_021FEAEC: ; // 0x21feaec
@@ -1328,9 +1328,9 @@ void Gambit_fn_021FEA34(CPUState* cpu) {
         /* 021FEAF8 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021FEAF8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021FEAFC */ cpu->r[12] = 0x101D0000u;
-        /* 021FEB00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021FEB00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021FEB04 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021FEB08 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEB08 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEB08 */ _t23 = _t22 & 0x00000001u;
         /* 021FEB08 */ if (_t23) goto L_021FEB0C; else goto L_021FEB24;
   L_021FEB0C: ; // 0x21feb0c
@@ -1343,8 +1343,8 @@ void Gambit_fn_021FEA34(CPUState* cpu) {
         /* 021FEB20 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 021FEB20 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_021FEB24: ; // 0x21feb24
-        /* 021FEB24 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021FEB28 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEB24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021FEB28 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEB28 */ _t27 = _t26 & 0x00000001u;
         /* 021FEB28 */ if (_t27) goto L_021FEB2C; else goto L_021FEB34;
   L_021FEB2C: ; // 0x21feb2c
@@ -1356,9 +1356,9 @@ void Gambit_fn_021FEA34(CPUState* cpu) {
         /* 021FEB38 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 021FEB38 */ cpu->r[10] = _t28;
         /* 021FEB3C */ cpu->r[7] = 0x101D0000u;
-        /* 021FEB40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021FEB40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021FEB44 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 021FEB48 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEB48 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEB48 */ _t30 = _t29 & 0x00000001u;
         /* 021FEB48 */ if (_t30) goto L_021FEB4C; else goto L_021FEB60;
   L_021FEB4C: ; // 0x21feb4c
@@ -1370,8 +1370,8 @@ void Gambit_fn_021FEA34(CPUState* cpu) {
         /* 021FEB5C */ _t32 = cpu->r[7] + 0x00000000u;
         /* 021FEB5C */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_021FEB60: ; // 0x21feb60
-        /* 021FEB60 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 021FEB64 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEB60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 021FEB64 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEB64 */ _t34 = _t33 & 0x00000001u;
         /* 021FEB64 */ if (_t34) goto L_021FEB68; else goto L_021FEB70;
   L_021FEB68: ; // 0x21feb68
@@ -1383,9 +1383,9 @@ void Gambit_fn_021FEA34(CPUState* cpu) {
         /* 021FEB74 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 021FEB74 */ cpu->r[8] = _t35;
         /* 021FEB78 */ cpu->r[6] = 0x101D0000u;
-        /* 021FEB7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021FEB7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021FEB80 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 021FEB84 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEB84 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEB84 */ _t37 = _t36 & 0x00000001u;
         /* 021FEB84 */ if (_t37) goto L_021FEB88; else goto L_021FEB9C;
   L_021FEB88: ; // 0x21feb88
@@ -1424,9 +1424,9 @@ void Gambit_fn_021FEBC0(CPUState* cpu) {
         /* 021FEBC4 */ _t0 = cpu->r[8] + 0xFFFFFDA4u;
         /* 021FEBC4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 021FEBC8 */ cpu->r[6] = 0x101D0000u;
-        /* 021FEBCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021FEBCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021FEBD0 */ cpu->r[6] = cpu->r[6] + 0xFFFFFE94u;
-        /* 021FEBD4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEBD4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEBD4 */ _t2 = _t1 & 0x00000001u;
         /* 021FEBD4 */ if (_t2) goto L_021FEBD8; else goto L_021FEBF0;
   L_021FEBD8: ; // 0x21febd8
@@ -1439,8 +1439,8 @@ void Gambit_fn_021FEBC0(CPUState* cpu) {
         /* 021FEBEC */ _t4 = cpu->r[6] + 0x00000000u;
         /* 021FEBEC */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_021FEBF0: ; // 0x21febf0
-        /* 021FEBF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 021FEBF4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEBF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 021FEBF4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEBF4 */ _t6 = _t5 & 0x00000001u;
         /* 021FEBF4 */ if (_t6) goto L_021FEBF8; else goto L_021FEC00;
   L_021FEBF8: ; // 0x21febf8
@@ -1451,9 +1451,9 @@ void Gambit_fn_021FEBC0(CPUState* cpu) {
         /* 021FEC04 */ _t7 = cpu->r[10] + 0xFFFFE620u;
         /* 021FEC04 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 021FEC08 */ cpu->r[8] = 0x101D0000u;
-        /* 021FEC0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021FEC0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021FEC10 */ cpu->r[8] = cpu->r[8] + 0xFFFFFE88u;
-        /* 021FEC14 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEC14 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEC14 */ _t9 = _t8 & 0x00000001u;
         /* 021FEC14 */ if (_t9) goto L_021FEC18; else goto L_021FEC30;
   L_021FEC18: ; // 0x21fec18
@@ -1466,8 +1466,8 @@ void Gambit_fn_021FEBC0(CPUState* cpu) {
         /* 021FEC2C */ _t11 = cpu->r[8] + 0x00000000u;
         /* 021FEC2C */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_021FEC30: ; // 0x21fec30
-        /* 021FEC30 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 021FEC34 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEC30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 021FEC34 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEC34 */ _t13 = _t12 & 0x00000001u;
         /* 021FEC34 */ if (_t13) goto L_021FEC38; else goto L_021FEC40;
   L_021FEC38: ; // 0x21fec38
@@ -1478,9 +1478,9 @@ void Gambit_fn_021FEBC0(CPUState* cpu) {
         /* 021FEC44 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 021FEC44 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 021FEC48 */ cpu->r[10] = 0x101D0000u;
-        /* 021FEC4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021FEC4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021FEC50 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 021FEC54 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEC54 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEC54 */ _t16 = _t15 & 0x00000001u;
         /* 021FEC54 */ if (_t16) goto L_021FEC58; else goto L_021FEC70;
   L_021FEC58: ; // 0x21fec58
@@ -1493,8 +1493,8 @@ void Gambit_fn_021FEBC0(CPUState* cpu) {
         /* 021FEC6C */ _t18 = cpu->r[10] + 0x00000000u;
         /* 021FEC6C */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_021FEC70: ; // 0x21fec70
-        /* 021FEC70 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 021FEC74 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEC70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 021FEC74 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEC74 */ _t20 = _t19 & 0x00000001u;
         /* 021FEC74 */ if (_t20) goto L_021FEC78; else goto L_021FEC80;
   L_021FEC78: ; // 0x21fec78
@@ -1505,9 +1505,9 @@ void Gambit_fn_021FEBC0(CPUState* cpu) {
         /* 021FEC84 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 021FEC84 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 021FEC88 */ cpu->r[12] = 0x101D0000u;
-        /* 021FEC8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021FEC8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021FEC90 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 021FEC94 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEC94 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEC94 */ _t23 = _t22 & 0x00000001u;
         /* 021FEC94 */ if (_t23) goto L_021FEC98; else goto L_021FECB0;
   L_021FEC98: ; // 0x21fec98
@@ -1520,8 +1520,8 @@ void Gambit_fn_021FEBC0(CPUState* cpu) {
         /* 021FECAC */ _t25 = cpu->r[12] + 0x00000000u;
         /* 021FECAC */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_021FECB0: ; // 0x21fecb0
-        /* 021FECB0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 021FECB4 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FECB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 021FECB4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FECB4 */ _t27 = _t26 & 0x00000001u;
         /* 021FECB4 */ if (_t27) goto L_021FECB8; else goto L_021FECC0;
   L_021FECB8: ; // 0x21fecb8
@@ -1533,9 +1533,9 @@ void Gambit_fn_021FEBC0(CPUState* cpu) {
         /* 021FECC4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 021FECC4 */ cpu->r[10] = _t28;
         /* 021FECC8 */ cpu->r[7] = 0x101D0000u;
-        /* 021FECCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021FECCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021FECD0 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 021FECD4 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FECD4 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FECD4 */ _t30 = _t29 & 0x00000001u;
         /* 021FECD4 */ if (_t30) goto L_021FECD8; else goto L_021FECEC;
   L_021FECD8: ; // 0x21fecd8
@@ -1547,8 +1547,8 @@ void Gambit_fn_021FEBC0(CPUState* cpu) {
         /* 021FECE8 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 021FECE8 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_021FECEC: ; // 0x21fecec
-        /* 021FECEC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 021FECF0 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FECEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 021FECF0 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FECF0 */ _t34 = _t33 & 0x00000001u;
         /* 021FECF0 */ if (_t34) goto L_021FECF4; else goto L_021FECFC;
   L_021FECF4: ; // 0x21fecf4
@@ -1560,9 +1560,9 @@ void Gambit_fn_021FEBC0(CPUState* cpu) {
         /* 021FED00 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 021FED00 */ cpu->r[8] = _t35;
         /* 021FED04 */ cpu->r[6] = 0x101D0000u;
-        /* 021FED08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 021FED08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 021FED0C */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 021FED10 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FED10 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FED10 */ _t37 = _t36 & 0x00000001u;
         /* 021FED10 */ if (_t37) goto L_021FED14; else goto L_021FED28;
   L_021FED14: ; // 0x21fed14
@@ -1600,18 +1600,18 @@ void Gambit_fn_021FED40(CPUState* cpu) {
         /* 021FED54 */ _t2 = cpu->r[1] + 0x00000058u;
         /* 021FED54 */ rbrew_write_f32(cpu->mem, _t2, cpu->f[31]);
         /* 021FED58 */ cpu->r[31] = cpu->r[3];
-        /* 021FED58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 021FED58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 021FED5C */ _t3 = cpu->r[1] + 0x00000064u;
         /* 021FED5C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 021FED60 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FED60 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FED60 */ _t5 = _t4 & 0x00000001u;
         /* 021FED60 */ if (_t5) goto L_021FED64; else goto L_021FED74;
   L_021FED64: ; // 0x21fed64
         /* 021FED64 */ cpu->r[3] = 0x000001E8u;
         /* 021FED68 */ Gambit_fn_02801A78(cpu);
         /* 021FED6C */ cpu->r[31] = cpu->r[3];
-        /* 021FED6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 021FED70 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FED6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 021FED70 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FED70 */ _t7 = _t6 & 0x00000001u;
         /* 021FED70 */ if (_t7) goto L_021FF18C; else goto L_021FED74;
   L_021FED74: ; // 0x21fed74
@@ -1627,21 +1627,21 @@ void Gambit_fn_021FED40(CPUState* cpu) {
         /* 021FED90 */ _t10 = cpu->r[31] + 0x0000012Cu;
         /* 021FED90 */ rbrew_write_f32(cpu->mem, _t10, cpu->f[31]);
         /* 021FED94 */ cpu->r[30] = cpu->r[31] + 0x00000134u;
-        /* 021FED94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 021FED94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 021FED98 */ _t11 = cpu->r[31] + 0x00000128u;
         /* 021FED98 */ rbrew_write_f32(cpu->mem, _t11, cpu->f[31]);
         /* 021FED9C */ cpu->r[27] = 0x00000000u;
         /* 021FEDA0 */ _t12 = cpu->r[31] + 0x00000130u;
         /* 021FEDA0 */ rbrew_write_f32(cpu->mem, _t12, cpu->f[31]);
-        /* 021FEDA4 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEDA4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEDA4 */ _t14 = _t13 & 0x00000001u;
         /* 021FEDA4 */ if (_t14) goto L_021FEDA8; else goto L_021FEDB8;
   L_021FEDA8: ; // 0x21feda8
         /* 021FEDA8 */ cpu->r[3] = 0x00000038u;
         /* 021FEDAC */ Gambit_fn_02801A78(cpu);
         /* 021FEDB0 */ cpu->r[30] = cpu->r[3];
-        /* 021FEDB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 021FEDB4 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEDB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 021FEDB4 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEDB4 */ _t16 = _t15 & 0x00000001u;
         /* 021FEDB4 */ if (_t16) goto L_021FEDE8; else goto L_021FEDB8;
   L_021FEDB8: ; // 0x21fedb8
@@ -1667,10 +1667,10 @@ void Gambit_fn_021FED40(CPUState* cpu) {
         /* 021FEDE4 */ rbrew_write32(cpu->mem, _t24, cpu->r[27]);
   L_021FEDE8: ; // 0x21fede8
         /* 021FEDE8 */ cpu->r[11] = cpu->r[31] + 0x00000170u;
-        /* 021FEDE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 021FEDE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 021FEDEC */ _t25 = cpu->r[31] + 0x0000016Cu;
         /* 021FEDEC */ rbrew_write_f32(cpu->mem, _t25, cpu->f[31]);
-        /* 021FEDF0 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEDF0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEDF0 */ _t27 = _t26 & 0x00000001u;
         /* 021FEDF0 */ if (_t27) goto L_021FEDF4; else goto L_021FEDFC;
   L_021FEDF4: ; // 0x21fedf4
@@ -1678,8 +1678,8 @@ void Gambit_fn_021FED40(CPUState* cpu) {
         /* 021FEDF8 */ Gambit_fn_02801A78(cpu);
   L_021FEDFC: ; // 0x21fedfc
         /* 021FEDFC */ cpu->r[12] = cpu->r[31] + 0x0000017Cu;
-        /* 021FEDFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021FEE00 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEDFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021FEE00 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEE00 */ _t29 = _t28 & 0x00000001u;
         /* 021FEE00 */ if (_t29) goto L_021FEE04; else goto L_021FEE0C;
   L_021FEE04: ; // 0x21fee04
@@ -1687,8 +1687,8 @@ void Gambit_fn_021FED40(CPUState* cpu) {
         /* 021FEE08 */ Gambit_fn_02801A78(cpu);
   L_021FEE0C: ; // 0x21fee0c
         /* 021FEE0C */ cpu->r[0] = cpu->r[31] + 0x00000188u;
-        /* 021FEE0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FEE10 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEE0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FEE10 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEE10 */ _t31 = _t30 & 0x00000001u;
         /* 021FEE10 */ if (_t31) goto L_021FEE14; else goto L_021FEE1C;
   L_021FEE14: ; // 0x21fee14
@@ -1709,10 +1709,10 @@ void Gambit_fn_021FED40(CPUState* cpu) {
         /* 021FEE34 */ _t37 = cpu->r[31] + 0x00000198u;
         /* 021FEE34 */ rbrew_write32(cpu->mem, _t37, cpu->r[5]);
         /* 021FEE38 */ cpu->r[7] = cpu->r[31] + 0x000001ACu;
-        /* 021FEE38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 021FEE38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 021FEE3C */ _t38 = cpu->r[31] + 0x00000194u;
         /* 021FEE3C */ rbrew_write_f32(cpu->mem, _t38, cpu->f[0]);
-        /* 021FEE40 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEE40 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEE40 */ _t40 = _t39 & 0x00000001u;
         /* 021FEE40 */ if (_t40) goto L_021FEE44; else goto L_021FEE4C;
   L_021FEE44: ; // 0x21fee44
@@ -1720,8 +1720,8 @@ void Gambit_fn_021FED40(CPUState* cpu) {
         /* 021FEE48 */ Gambit_fn_02801A78(cpu);
   L_021FEE4C: ; // 0x21fee4c
         /* 021FEE4C */ cpu->r[0] = cpu->r[31] + 0x000001DCu;
-        /* 021FEE4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FEE50 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEE4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FEE50 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEE50 */ _t42 = _t41 & 0x00000001u;
         /* 021FEE50 */ if (_t42) goto L_021FEE54; else goto L_021FEE5C;
   L_021FEE54: ; // 0x21fee54
@@ -1761,23 +1761,23 @@ void Gambit_fn_021FED40(CPUState* cpu) {
         /* 021FEEB8 */ _t50 = cpu->r[9] + 0x00000000u;
         /* 021FEEB8 */ cpu->r[10] = rbrew_read8(cpu->mem, _t50);
         /* 021FEEBC */ cpu->r[30] = 0x00000000u;
-        /* 021FEEC0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[29]);
+        /* 021FEEC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[29]));
         /* 021FEEC4 */ cpu->r[12] = 0x00080000u;
-        /* 021FEEC8 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEEC8 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEEC8 */ _t52 = _t51 & 0x00000001u;
         /* 021FEEC8 */ if (_t52) goto L_021FEEF0; else goto L_021FEECC;
   L_021FEECC: ; // 0x21feecc
         /* 021FEECC */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 021FEED0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[12]);
+        /* 021FEED0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[12]));
         /* 021FEED4 */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 021FEED8 */ _t53 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FEED8 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FEED8 */ _t54 = _t53 & 0x00000001u;
         /* 021FEED8 */ if (_t54) goto L_021FEEEC; else goto L_021FEEDC;
   L_021FEEDC: ; // 0x21feedc
         /* 021FEEDC */ _t55 = cpu->r[9] + 0x00000000u;
         /* 021FEEDC */ cpu->r[11] = rbrew_read8(cpu->mem, _t55);
-        /* 021FEEE0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[29]);
-        /* 021FEEE4 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEEE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[29]));
+        /* 021FEEE4 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEEE4 */ _t57 = _t56 & 0x00000001u;
         /* 021FEEE4 */ if (_t57) goto L_021FEEE8; else goto L_021FEECC;
   L_021FEEE8: ; // 0x21feee8
@@ -1789,10 +1789,10 @@ void Gambit_fn_021FED40(CPUState* cpu) {
         /* 021FEEF0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t58);
         /* 021FEEF4 */ _t59 = cpu->r[1] + 0x00000010u;
         /* 021FEEF4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t59);
-        /* 021FEEF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[8]);
+        /* 021FEEF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[8]));
         /* 021FEEFC */ _t60 = cpu->r[12] + 0x00000014u;
         /* 021FEEFC */ cpu->r[0] = rbrew_read32(cpu->mem, _t60);
-        /* 021FEF00 */ _t61 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FEF00 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FEF00 */ _t62 = _t61 & 0x00000001u;
         /* 021FEF00 */ if (_t62) goto L_021FEF08; else goto L_021FEF04;
   L_021FEF04: ; // 0x21fef04
@@ -1849,10 +1849,10 @@ void Gambit_fn_021FED40(CPUState* cpu) {
         /* 021FEF90 */ rbrew_write32(cpu->mem, _t76, cpu->r[6]);
         /* 021FEF94 */ _t77 = cpu->r[31] + 0x00000148u;
         /* 021FEF94 */ cpu->r[7] = rbrew_read32(cpu->mem, _t77);
-        /* 021FEF98 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x00000001u);
+        /* 021FEF98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x00000001u));
         /* 021FEF9C */ _t78 = cpu->r[31] + 0x0000014Cu;
         /* 021FEF9C */ cpu->r[28] = rbrew_read32(cpu->mem, _t78);
-        /* 021FEFA0 */ _t79 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FEFA0 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FEFA0 */ _t80 = _t79 & 0x00000001u;
         /* 021FEFA0 */ if (_t80) goto L_021FEFA4; else goto L_021FEFA8;
   L_021FEFA4: ; // 0x21fefa4
@@ -1868,23 +1868,23 @@ void Gambit_fn_021FED40(CPUState* cpu) {
         /* 021FEFBC */ _t83 = cpu->r[12] + 0x00000000u;
         /* 021FEFBC */ cpu->r[8] = rbrew_read8(cpu->mem, _t83);
         /* 021FEFC0 */ cpu->r[30] = 0x00000000u;
-        /* 021FEFC4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[29]);
+        /* 021FEFC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[29]));
         /* 021FEFC8 */ cpu->r[6] = 0x00080000u;
-        /* 021FEFCC */ _t84 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEFCC */ _t84 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEFCC */ _t85 = _t84 & 0x00000001u;
         /* 021FEFCC */ if (_t85) goto L_021FEFF4; else goto L_021FEFD0;
   L_021FEFD0: ; // 0x21fefd0
         /* 021FEFD0 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 021FEFD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[6]);
+        /* 021FEFD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[6]));
         /* 021FEFD8 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 021FEFDC */ _t86 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FEFDC */ _t86 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FEFDC */ _t87 = _t86 & 0x00000001u;
         /* 021FEFDC */ if (_t87) goto L_021FEFF0; else goto L_021FEFE0;
   L_021FEFE0: ; // 0x21fefe0
         /* 021FEFE0 */ _t88 = cpu->r[12] + 0x00000000u;
         /* 021FEFE0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t88);
-        /* 021FEFE4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[29]);
-        /* 021FEFE8 */ _t89 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FEFE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[29]));
+        /* 021FEFE8 */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FEFE8 */ _t90 = _t89 & 0x00000001u;
         /* 021FEFE8 */ if (_t90) goto L_021FEFEC; else goto L_021FEFD0;
   L_021FEFEC: ; // 0x21fefec
@@ -1896,10 +1896,10 @@ void Gambit_fn_021FED40(CPUState* cpu) {
         /* 021FEFF4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t91);
         /* 021FEFF8 */ _t92 = cpu->r[1] + 0x00000010u;
         /* 021FEFF8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t92);
-        /* 021FEFFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[9]);
+        /* 021FEFFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[9]));
         /* 021FF000 */ _t93 = cpu->r[10] + 0x00000014u;
         /* 021FF000 */ cpu->r[0] = rbrew_read32(cpu->mem, _t93);
-        /* 021FF004 */ _t94 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FF004 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FF004 */ _t95 = _t94 & 0x00000001u;
         /* 021FF004 */ if (_t95) goto L_021FF00C; else goto L_021FF008;
   L_021FF008: ; // 0x21ff008
@@ -1956,10 +1956,10 @@ void Gambit_fn_021FED40(CPUState* cpu) {
         /* 021FF094 */ rbrew_write32(cpu->mem, _t109, cpu->r[5]);
         /* 021FF098 */ _t110 = cpu->r[31] + 0x00000148u;
         /* 021FF098 */ cpu->r[7] = rbrew_read32(cpu->mem, _t110);
-        /* 021FF09C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x00000002u);
+        /* 021FF09C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x00000002u));
         /* 021FF0A0 */ _t111 = cpu->r[31] + 0x0000014Cu;
         /* 021FF0A0 */ cpu->r[28] = rbrew_read32(cpu->mem, _t111);
-        /* 021FF0A4 */ _t112 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FF0A4 */ _t112 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FF0A4 */ _t113 = _t112 & 0x00000001u;
         /* 021FF0A4 */ if (_t113) goto L_021FF0A8; else goto L_021FF0AC;
   L_021FF0A8: ; // 0x21ff0a8
@@ -1975,23 +1975,23 @@ void Gambit_fn_021FED40(CPUState* cpu) {
         /* 021FF0C0 */ _t116 = cpu->r[8] + 0x00000000u;
         /* 021FF0C0 */ cpu->r[11] = rbrew_read8(cpu->mem, _t116);
         /* 021FF0C4 */ cpu->r[30] = 0x00000000u;
-        /* 021FF0C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[29]);
+        /* 021FF0C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[29]));
         /* 021FF0CC */ cpu->r[10] = 0x00080000u;
-        /* 021FF0D0 */ _t117 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF0D0 */ _t117 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF0D0 */ _t118 = _t117 & 0x00000001u;
         /* 021FF0D0 */ if (_t118) goto L_021FF0F8; else goto L_021FF0D4;
   L_021FF0D4: ; // 0x21ff0d4
         /* 021FF0D4 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 021FF0D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[10]);
+        /* 021FF0D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[10]));
         /* 021FF0DC */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 021FF0E0 */ _t119 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FF0E0 */ _t119 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FF0E0 */ _t120 = _t119 & 0x00000001u;
         /* 021FF0E0 */ if (_t120) goto L_021FF0F4; else goto L_021FF0E4;
   L_021FF0E4: ; // 0x21ff0e4
         /* 021FF0E4 */ _t121 = cpu->r[8] + 0x00000000u;
         /* 021FF0E4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t121);
-        /* 021FF0E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[29]);
-        /* 021FF0EC */ _t122 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF0E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[29]));
+        /* 021FF0EC */ _t122 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF0EC */ _t123 = _t122 & 0x00000001u;
         /* 021FF0EC */ if (_t123) goto L_021FF0F0; else goto L_021FF0D4;
   L_021FF0F0: ; // 0x21ff0f0
@@ -2001,8 +2001,8 @@ void Gambit_fn_021FED40(CPUState* cpu) {
   L_021FF0F8: ; // 0x21ff0f8
         /* 021FF0F8 */ _t124 = cpu->r[28] + 0x00000008u;
         /* 021FF0F8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t124);
-        /* 021FF0FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[5]);
-        /* 021FF100 */ _t125 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FF0FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[5]));
+        /* 021FF100 */ _t125 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FF100 */ _t126 = _t125 & 0x00000001u;
         /* 021FF100 */ if (_t126) goto L_021FF108; else goto L_021FF104;
   L_021FF104: ; // 0x21ff104
@@ -2062,7 +2062,7 @@ void Gambit_fn_021FED40(CPUState* cpu) {
         /* 021FF194 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t141);
         /* 021FF198 */ _t142 = cpu->r[1] + 0x00000050u;
         /* 021FF198 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t142);
-        /* 021FF19C */ _t143 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FF19C */ _t143 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FF19C */ _t144 = _t143 & 0x00000001u;
         /* 021FF19C */ if (_t144) goto L_021FF1A0; // else: addr-0 trap, fall-through
   L_021FF1A0: ; // 0x21ff1a0
@@ -2096,8 +2096,8 @@ void Gambit_fn_021FF1B0(CPUState* cpu) {
         /* 021FF1D4 */ _t5 = cpu->r[31] + 0x00000198u;
         /* 021FF1D4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 021FF1D8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 021FF1D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FF1DC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF1D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FF1DC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF1DC */ _t7 = _t6 & 0x00000001u;
         /* 021FF1DC */ if (_t7) goto L_021FF1E8; else goto L_021FF1E0;
   L_021FF1E0: ; // 0x21ff1e0
@@ -2139,8 +2139,8 @@ void Gambit_fn_021FF1B4(CPUState* cpu) {
         /* 021FF1D4 */ _t5 = cpu->r[31] + 0x00000198u;
         /* 021FF1D4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 021FF1D8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 021FF1D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FF1DC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF1D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FF1DC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF1DC */ _t7 = _t6 & 0x00000001u;
         /* 021FF1DC */ if (_t7) goto L_021FF1E8; else goto L_021FF1E0;
   L_021FF1E0: ; // 0x21ff1e0
@@ -2183,8 +2183,8 @@ void Gambit_fn_021FF200(CPUState* cpu) {
         /* 021FF224 */ _t5 = cpu->r[31] + 0x00000198u;
         /* 021FF224 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 021FF228 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 021FF228 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FF22C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FF22C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF22C */ _t7 = _t6 & 0x00000001u;
         /* 021FF22C */ if (_t7) goto L_021FF238; else goto L_021FF230;
   L_021FF230: ; // 0x21ff230
@@ -2226,8 +2226,8 @@ void Gambit_fn_021FF204(CPUState* cpu) {
         /* 021FF224 */ _t5 = cpu->r[31] + 0x00000198u;
         /* 021FF224 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 021FF228 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 021FF228 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FF22C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FF22C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF22C */ _t7 = _t6 & 0x00000001u;
         /* 021FF22C */ if (_t7) goto L_021FF238; else goto L_021FF230;
   L_021FF230: ; // 0x21ff230
@@ -2270,8 +2270,8 @@ void Gambit_fn_021FF250(CPUState* cpu) {
         /* 021FF274 */ _t5 = cpu->r[31] + 0x00000198u;
         /* 021FF274 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 021FF278 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 021FF278 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FF27C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF278 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FF27C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF27C */ _t7 = _t6 & 0x00000001u;
         /* 021FF27C */ if (_t7) goto L_021FF288; else goto L_021FF280;
   L_021FF280: ; // 0x21ff280
@@ -2313,8 +2313,8 @@ void Gambit_fn_021FF254(CPUState* cpu) {
         /* 021FF274 */ _t5 = cpu->r[31] + 0x00000198u;
         /* 021FF274 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 021FF278 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 021FF278 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FF27C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF278 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FF27C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF27C */ _t7 = _t6 & 0x00000001u;
         /* 021FF27C */ if (_t7) goto L_021FF288; else goto L_021FF280;
   L_021FF280: ; // 0x21ff280
@@ -2357,8 +2357,8 @@ void Gambit_fn_021FF2A0(CPUState* cpu) {
         /* 021FF2C4 */ _t5 = cpu->r[31] + 0x00000198u;
         /* 021FF2C4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 021FF2C8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 021FF2C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FF2CC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF2C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FF2CC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF2CC */ _t7 = _t6 & 0x00000001u;
         /* 021FF2CC */ if (_t7) goto L_021FF2D8; else goto L_021FF2D0;
   L_021FF2D0: ; // 0x21ff2d0
@@ -2400,8 +2400,8 @@ void Gambit_fn_021FF2A4(CPUState* cpu) {
         /* 021FF2C4 */ _t5 = cpu->r[31] + 0x00000198u;
         /* 021FF2C4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 021FF2C8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 021FF2C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FF2CC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF2C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FF2CC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF2CC */ _t7 = _t6 & 0x00000001u;
         /* 021FF2CC */ if (_t7) goto L_021FF2D8; else goto L_021FF2D0;
   L_021FF2D0: ; // 0x21ff2d0
@@ -2465,9 +2465,9 @@ void Gambit_fn_021FF2F0(CPUState* cpu) {
         /* 021FF354 */ _t10 = cpu->r[24] + 0x00000198u;
         /* 021FF354 */ cpu->r[10] = rbrew_read32(cpu->mem, _t10);
         /* 021FF358 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 021FF358 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021FF358 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021FF35C */ cpu->r[23] = cpu->r[3];
-        /* 021FF360 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF360 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF360 */ _t12 = _t11 & 0x00000001u;
         /* 021FF360 */ if (_t12) goto L_021FF388; else goto L_021FF364;
   L_021FF364: ; // 0x21ff364
@@ -2481,8 +2481,8 @@ void Gambit_fn_021FF2F0(CPUState* cpu) {
         /* 021FF378 */ _t15 = cpu->r[24] + 0x00000198u;
         /* 021FF378 */ cpu->r[9] = rbrew_read32(cpu->mem, _t15);
         /* 021FF37C */ cpu->r[0] = rbrew_rlwinm(cpu->r[9], 0x00000017u, 0x0000001Fu, 0x0000001Fu);
-        /* 021FF37C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FF380 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF37C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FF380 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF380 */ _t17 = _t16 & 0x00000001u;
         /* 021FF380 */ if (_t17) goto L_021FF3B8; else goto L_021FF384;
   L_021FF384: ; // 0x21ff384
@@ -2498,24 +2498,24 @@ void Gambit_fn_021FF2F0(CPUState* cpu) {
         /* 021FF39C */ _t20 = cpu->r[24] + 0x00000198u;
         /* 021FF39C */ cpu->r[9] = rbrew_read32(cpu->mem, _t20);
         /* 021FF3A0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[9], 0x00000017u, 0x0000001Fu, 0x0000001Fu);
-        /* 021FF3A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FF3A4 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF3A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FF3A4 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF3A4 */ _t22 = _t21 & 0x00000001u;
         /* 021FF3A4 */ if (_t22) goto L_021FF3B8; else goto L_021FF3A8;
   L_021FF3A8: ; // 0x21ff3a8
-        /* 021FF3A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FF3A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FF3AC */ _t23 = cpu->r[23] + 0x00001350u;
         /* 021FF3AC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t23);
-        /* 021FF3B0 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF3B0 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF3B0 */ _t25 = _t24 & 0x00000001u;
         /* 021FF3B0 */ if (_t25) goto L_021FF490; else goto L_021FF3B4;
   L_021FF3B4: ; // 0x21ff3b4
         /* 021FF3B4 */ goto L_021FF3C4;
   L_021FF3B8: ; // 0x21ff3b8
-        /* 021FF3B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FF3B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FF3BC */ _t26 = cpu->r[23] + 0x00001650u;
         /* 021FF3BC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t26);
-        /* 021FF3C0 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF3C0 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF3C0 */ _t28 = _t27 & 0x00000001u;
         /* 021FF3C0 */ if (_t28) goto L_021FF490; else goto L_021FF3C4;
   L_021FF3C4: ; // 0x21ff3c4
@@ -2539,9 +2539,9 @@ void Gambit_fn_021FF2F0(CPUState* cpu) {
         /* 021FF3F4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t33);
         /* 021FF3F8 */ cpu->f[13] = cpu->f[0] - cpu->f[31];
         /* 021FF3FC */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 021FF3FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FF3FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FF400 */ cpu->f[11] = fma(cpu->f[13], cpu->f[30], cpu->f[29]);
-        /* 021FF404 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF404 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF404 */ _t35 = _t34 & 0x00000001u;
         /* 021FF404 */ if (_t35) goto L_021FF408; else goto L_021FF4D4;
   L_021FF408: ; // 0x21ff408
@@ -2605,9 +2605,9 @@ void Gambit_fn_021FF2F0(CPUState* cpu) {
         /* 021FF4C0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t45);
         /* 021FF4C4 */ cpu->f[13] = cpu->f[0] - cpu->f[31];
         /* 021FF4C8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 021FF4C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FF4C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FF4CC */ cpu->f[11] = fma(cpu->f[13], cpu->f[30], cpu->f[29]);
-        /* 021FF4D0 */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF4D0 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF4D0 */ _t47 = _t46 & 0x00000001u;
         /* 021FF4D0 */ if (_t47) goto L_021FF408; else goto L_021FF4D4;
   L_021FF4D4: ; // 0x21ff4d4
@@ -2663,7 +2663,7 @@ void Gambit_fn_021FF2F0(CPUState* cpu) {
         /* 021FF56C */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t57);
         /* 021FF570 */ _t58 = cpu->r[1] + 0x00000060u;
         /* 021FF570 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t58);
-        /* 021FF574 */ _t59 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FF574 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FF574 */ _t60 = _t59 & 0x00000001u;
         /* 021FF574 */ if (_t60) goto L_021FF578; // else: addr-0 trap, fall-through
   L_021FF578: ; // 0x21ff578
@@ -2718,9 +2718,9 @@ void Gambit_fn_021FF588(CPUState* cpu) {
         /* 021FF354 */ _t10 = cpu->r[24] + 0x00000198u;
         /* 021FF354 */ cpu->r[10] = rbrew_read32(cpu->mem, _t10);
         /* 021FF358 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 021FF358 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021FF358 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021FF35C */ cpu->r[23] = cpu->r[3];
-        /* 021FF360 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF360 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF360 */ _t12 = _t11 & 0x00000001u;
         /* 021FF360 */ if (_t12) goto L_021FF388; else goto L_021FF364;
   L_021FF364: ; // 0x21ff364
@@ -2734,8 +2734,8 @@ void Gambit_fn_021FF588(CPUState* cpu) {
         /* 021FF378 */ _t15 = cpu->r[24] + 0x00000198u;
         /* 021FF378 */ cpu->r[9] = rbrew_read32(cpu->mem, _t15);
         /* 021FF37C */ cpu->r[0] = rbrew_rlwinm(cpu->r[9], 0x00000017u, 0x0000001Fu, 0x0000001Fu);
-        /* 021FF37C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FF380 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF37C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FF380 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF380 */ _t17 = _t16 & 0x00000001u;
         /* 021FF380 */ if (_t17) goto L_021FF3B8; else goto L_021FF384;
   L_021FF384: ; // 0x21ff384
@@ -2751,24 +2751,24 @@ void Gambit_fn_021FF588(CPUState* cpu) {
         /* 021FF39C */ _t20 = cpu->r[24] + 0x00000198u;
         /* 021FF39C */ cpu->r[9] = rbrew_read32(cpu->mem, _t20);
         /* 021FF3A0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[9], 0x00000017u, 0x0000001Fu, 0x0000001Fu);
-        /* 021FF3A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FF3A4 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF3A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FF3A4 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF3A4 */ _t22 = _t21 & 0x00000001u;
         /* 021FF3A4 */ if (_t22) goto L_021FF3B8; else goto L_021FF3A8;
   L_021FF3A8: ; // 0x21ff3a8
-        /* 021FF3A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FF3A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FF3AC */ _t23 = cpu->r[23] + 0x00001350u;
         /* 021FF3AC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t23);
-        /* 021FF3B0 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF3B0 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF3B0 */ _t25 = _t24 & 0x00000001u;
         /* 021FF3B0 */ if (_t25) goto L_021FF490; else goto L_021FF3B4;
   L_021FF3B4: ; // 0x21ff3b4
         /* 021FF3B4 */ goto L_021FF3C4;
   L_021FF3B8: ; // 0x21ff3b8
-        /* 021FF3B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FF3B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FF3BC */ _t26 = cpu->r[23] + 0x00001650u;
         /* 021FF3BC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t26);
-        /* 021FF3C0 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF3C0 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF3C0 */ _t28 = _t27 & 0x00000001u;
         /* 021FF3C0 */ if (_t28) goto L_021FF490; else goto L_021FF3C4;
   L_021FF3C4: ; // 0x21ff3c4
@@ -2792,9 +2792,9 @@ void Gambit_fn_021FF588(CPUState* cpu) {
         /* 021FF3F4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t33);
         /* 021FF3F8 */ cpu->f[13] = cpu->f[0] - cpu->f[31];
         /* 021FF3FC */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 021FF3FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FF3FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FF400 */ cpu->f[11] = fma(cpu->f[13], cpu->f[30], cpu->f[29]);
-        /* 021FF404 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF404 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF404 */ _t35 = _t34 & 0x00000001u;
         /* 021FF404 */ if (_t35) goto L_021FF408; else goto L_021FF4D4;
   L_021FF408: ; // 0x21ff408
@@ -2858,9 +2858,9 @@ void Gambit_fn_021FF588(CPUState* cpu) {
         /* 021FF4C0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t45);
         /* 021FF4C4 */ cpu->f[13] = cpu->f[0] - cpu->f[31];
         /* 021FF4C8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 021FF4C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FF4C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FF4CC */ cpu->f[11] = fma(cpu->f[13], cpu->f[30], cpu->f[29]);
-        /* 021FF4D0 */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF4D0 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF4D0 */ _t47 = _t46 & 0x00000001u;
         /* 021FF4D0 */ if (_t47) goto L_021FF408; else goto L_021FF4D4;
   L_021FF4D4: ; // 0x21ff4d4
@@ -2916,7 +2916,7 @@ void Gambit_fn_021FF588(CPUState* cpu) {
         /* 021FF56C */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t57);
         /* 021FF570 */ _t58 = cpu->r[1] + 0x00000060u;
         /* 021FF570 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t58);
-        /* 021FF574 */ _t59 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FF574 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FF574 */ _t60 = _t59 & 0x00000001u;
         /* 021FF574 */ if (_t60) goto L_021FF578; // else: addr-0 trap, fall-through
   L_021FF578: ; // 0x21ff578
@@ -2987,9 +2987,9 @@ void Gambit_fn_021FF5A8(CPUState* cpu) {
         /* 021FF354 */ _t10 = cpu->r[24] + 0x00000198u;
         /* 021FF354 */ cpu->r[10] = rbrew_read32(cpu->mem, _t10);
         /* 021FF358 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 021FF358 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 021FF358 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 021FF35C */ cpu->r[23] = cpu->r[3];
-        /* 021FF360 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF360 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF360 */ _t12 = _t11 & 0x00000001u;
         /* 021FF360 */ if (_t12) goto L_021FF388; else goto L_021FF364;
   L_021FF364: ; // 0x21ff364
@@ -3003,8 +3003,8 @@ void Gambit_fn_021FF5A8(CPUState* cpu) {
         /* 021FF378 */ _t15 = cpu->r[24] + 0x00000198u;
         /* 021FF378 */ cpu->r[9] = rbrew_read32(cpu->mem, _t15);
         /* 021FF37C */ cpu->r[0] = rbrew_rlwinm(cpu->r[9], 0x00000017u, 0x0000001Fu, 0x0000001Fu);
-        /* 021FF37C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FF380 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF37C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FF380 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF380 */ _t17 = _t16 & 0x00000001u;
         /* 021FF380 */ if (_t17) goto L_021FF3B8; else goto L_021FF384;
   L_021FF384: ; // 0x21ff384
@@ -3020,24 +3020,24 @@ void Gambit_fn_021FF5A8(CPUState* cpu) {
         /* 021FF39C */ _t20 = cpu->r[24] + 0x00000198u;
         /* 021FF39C */ cpu->r[9] = rbrew_read32(cpu->mem, _t20);
         /* 021FF3A0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[9], 0x00000017u, 0x0000001Fu, 0x0000001Fu);
-        /* 021FF3A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FF3A4 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF3A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FF3A4 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF3A4 */ _t22 = _t21 & 0x00000001u;
         /* 021FF3A4 */ if (_t22) goto L_021FF3B8; else goto L_021FF3A8;
   L_021FF3A8: ; // 0x21ff3a8
-        /* 021FF3A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FF3A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FF3AC */ _t23 = cpu->r[23] + 0x00001350u;
         /* 021FF3AC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t23);
-        /* 021FF3B0 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF3B0 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF3B0 */ _t25 = _t24 & 0x00000001u;
         /* 021FF3B0 */ if (_t25) goto L_021FF490; else goto L_021FF3B4;
   L_021FF3B4: ; // 0x21ff3b4
         /* 021FF3B4 */ goto L_021FF3C4;
   L_021FF3B8: ; // 0x21ff3b8
-        /* 021FF3B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FF3B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FF3BC */ _t26 = cpu->r[23] + 0x00001650u;
         /* 021FF3BC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t26);
-        /* 021FF3C0 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF3C0 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF3C0 */ _t28 = _t27 & 0x00000001u;
         /* 021FF3C0 */ if (_t28) goto L_021FF490; else goto L_021FF3C4;
   L_021FF3C4: ; // 0x21ff3c4
@@ -3061,9 +3061,9 @@ void Gambit_fn_021FF5A8(CPUState* cpu) {
         /* 021FF3F4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t33);
         /* 021FF3F8 */ cpu->f[13] = cpu->f[0] - cpu->f[31];
         /* 021FF3FC */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 021FF3FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FF3FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FF400 */ cpu->f[11] = fma(cpu->f[13], cpu->f[30], cpu->f[29]);
-        /* 021FF404 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF404 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF404 */ _t35 = _t34 & 0x00000001u;
         /* 021FF404 */ if (_t35) goto L_021FF408; else goto L_021FF4D4;
   L_021FF408: ; // 0x21ff408
@@ -3127,9 +3127,9 @@ void Gambit_fn_021FF5A8(CPUState* cpu) {
         /* 021FF4C0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t45);
         /* 021FF4C4 */ cpu->f[13] = cpu->f[0] - cpu->f[31];
         /* 021FF4C8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 021FF4C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FF4C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FF4CC */ cpu->f[11] = fma(cpu->f[13], cpu->f[30], cpu->f[29]);
-        /* 021FF4D0 */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF4D0 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF4D0 */ _t47 = _t46 & 0x00000001u;
         /* 021FF4D0 */ if (_t47) goto L_021FF408; else goto L_021FF4D4;
   L_021FF4D4: ; // 0x21ff4d4
@@ -3185,7 +3185,7 @@ void Gambit_fn_021FF5A8(CPUState* cpu) {
         /* 021FF56C */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t57);
         /* 021FF570 */ _t58 = cpu->r[1] + 0x00000060u;
         /* 021FF570 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t58);
-        /* 021FF574 */ _t59 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FF574 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FF574 */ _t60 = _t59 & 0x00000001u;
         /* 021FF574 */ if (_t60) goto L_021FF578; // else: addr-0 trap, fall-through
   L_021FF578: ; // 0x21ff578
@@ -3459,10 +3459,10 @@ void Gambit_fn_021FF640(CPUState* cpu) {
         /* 021FF774 */ cpu->f[7] = cpu->f[10] - cpu->f[12];
         /* 021FF778 */ _t45 = cpu->r[31] + 0x00000194u;
         /* 021FF778 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t45);
-        /* 021FF77C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[28]);
+        /* 021FF77C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[28]));
         /* 021FF780 */ _t46 = cpu->r[1] + 0x0000003Cu;
         /* 021FF780 */ rbrew_write_f32(cpu->mem, _t46, cpu->f[7]);
-        /* 021FF784 */ _t47 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FF784 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FF784 */ _t48 = _t47 & 0x00000001u;
         /* 021FF784 */ if (_t48) goto L_021FF87C; else goto L_021FF788;
   L_021FF788: ; // 0x21ff788
@@ -3480,8 +3480,8 @@ void Gambit_fn_021FF640(CPUState* cpu) {
         /* 021FF7A4 */ cpu->ctr = cpu->r[7];
         /* 021FF7A8 */ cpu->r[3] = cpu->r[31];
         /* 021FF7AC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 021FF7B0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[1]);
-        /* 021FF7B4 */ _t53 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FF7B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[1]));
+        /* 021FF7B4 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FF7B4 */ _t54 = _t53 & 0x00000001u;
         /* 021FF7B4 */ if (_t54) goto L_021FF7E4; else goto L_021FF7B8;
   L_021FF7B8: ; // 0x21ff7b8
@@ -3495,10 +3495,10 @@ void Gambit_fn_021FF640(CPUState* cpu) {
         /* 021FF7C8 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t57);
         /* 021FF7CC */ cpu->f[13] = fma(cpu->f[8], cpu->f[8], cpu->f[7]);
         /* 021FF7D0 */ cpu->r[7] = 0x10040000u;
-        /* 021FF7D4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[28]);
+        /* 021FF7D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[28]));
         /* 021FF7D8 */ _t58 = cpu->r[7] + 0xFFFFE524u;
         /* 021FF7D8 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t58);
-        /* 021FF7DC */ _t59 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FF7DC */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FF7DC */ _t60 = _t59 & 0x00000001u;
         /* 021FF7DC */ if (_t60) goto L_021FF7E0; else goto L_021FF8A0;
   L_021FF7E0: ; // 0x21ff7e0
@@ -3567,7 +3567,7 @@ void Gambit_fn_021FF640(CPUState* cpu) {
         /* 021FF860 */ cpu->f[25] = rbrew_read_f64(cpu->mem, _t89);
         /* 021FF864 */ _t90 = cpu->r[1] + 0x00000110u;
         /* 021FF864 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t90);
-        /* 021FF868 */ _t91 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FF868 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FF868 */ _t92 = _t91 & 0x00000001u;
         /* 021FF868 */ if (_t92) goto L_021FF86C; // else: addr-0 trap, fall-through
   L_021FF86C: ; // 0x21ff86c
@@ -3585,10 +3585,10 @@ void Gambit_fn_021FF640(CPUState* cpu) {
         /* 021FF88C */ _t95 = cpu->r[5] + 0xFFFFE514u;
         /* 021FF88C */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t95);
         /* 021FF890 */ cpu->r[7] = 0x10040000u;
-        /* 021FF894 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[28]);
+        /* 021FF894 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[28]));
         /* 021FF898 */ _t96 = cpu->r[7] + 0xFFFFE524u;
         /* 021FF898 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t96);
-        /* 021FF89C */ _t97 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FF89C */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FF89C */ _t98 = _t97 & 0x00000001u;
         /* 021FF89C */ if (_t98) goto L_021FF8D8; else goto L_021FF8A0;
   L_021FF8A0: ; // 0x21ff8a0
@@ -3608,9 +3608,9 @@ void Gambit_fn_021FF640(CPUState* cpu) {
         /* 021FF8C4 */ _t103 = cpu->r[31] + 0x00000198u;
         /* 021FF8C4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t103);
         /* 021FF8C8 */ cpu->r[8] = rbrew_rlwinm(cpu->r[0], 0x00000017u, 0x0000001Fu, 0x0000001Fu);
-        /* 021FF8C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021FF8C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021FF8CC */ cpu->r[24] = cpu->r[3];
-        /* 021FF8D0 */ _t104 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF8D0 */ _t104 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF8D0 */ _t105 = _t104 & 0x00000001u;
         /* 021FF8D0 */ if (_t105) goto L_021FF930; else goto L_021FF8D4;
   L_021FF8D4: ; // 0x21ff8d4
@@ -3639,64 +3639,64 @@ void Gambit_fn_021FF640(CPUState* cpu) {
         /* 021FF910 */ _t112 = cpu->r[31] + 0x00000198u;
         /* 021FF910 */ cpu->r[0] = rbrew_read32(cpu->mem, _t112);
         /* 021FF914 */ cpu->r[8] = rbrew_rlwinm(cpu->r[0], 0x00000017u, 0x0000001Fu, 0x0000001Fu);
-        /* 021FF914 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021FF914 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021FF918 */ cpu->r[24] = cpu->r[3];
-        /* 021FF91C */ _t113 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF91C */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF91C */ _t114 = _t113 & 0x00000001u;
         /* 021FF91C */ if (_t114) goto L_021FF930; else goto L_021FF920;
   L_021FF920: ; // 0x21ff920
-        /* 021FF920 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021FF920 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021FF924 */ _t115 = cpu->r[24] + 0x00001170u;
         /* 021FF924 */ cpu->f[22] = rbrew_read_f32(cpu->mem, _t115);
-        /* 021FF928 */ _t116 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF928 */ _t116 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF928 */ _t117 = _t116 & 0x00000001u;
         /* 021FF928 */ if (_t117) goto L_021FF94C; else goto L_021FF92C;
   L_021FF92C: ; // 0x21ff92c
         /* 021FF92C */ goto L_021FF93C;
   L_021FF930: ; // 0x21ff930
-        /* 021FF930 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021FF930 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021FF934 */ _t118 = cpu->r[24] + 0x00001470u;
         /* 021FF934 */ cpu->f[22] = rbrew_read_f32(cpu->mem, _t118);
-        /* 021FF938 */ _t119 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF938 */ _t119 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF938 */ _t120 = _t119 & 0x00000001u;
         /* 021FF938 */ if (_t120) goto L_021FF94C; else goto L_021FF93C;
   L_021FF93C: ; // 0x21ff93c
-        /* 021FF93C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021FF93C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021FF940 */ _t121 = cpu->r[24] + 0x000010B0u;
         /* 021FF940 */ cpu->f[23] = rbrew_read_f32(cpu->mem, _t121);
-        /* 021FF944 */ _t122 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF944 */ _t122 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF944 */ _t123 = _t122 & 0x00000001u;
         /* 021FF944 */ if (_t123) goto L_021FF968; else goto L_021FF948;
   L_021FF948: ; // 0x21ff948
         /* 021FF948 */ goto L_021FF958;
   L_021FF94C: ; // 0x21ff94c
-        /* 021FF94C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021FF94C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021FF950 */ _t124 = cpu->r[24] + 0x000013B0u;
         /* 021FF950 */ cpu->f[23] = rbrew_read_f32(cpu->mem, _t124);
-        /* 021FF954 */ _t125 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF954 */ _t125 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF954 */ _t126 = _t125 & 0x00000001u;
         /* 021FF954 */ if (_t126) goto L_021FF968; else goto L_021FF958;
   L_021FF958: ; // 0x21ff958
-        /* 021FF958 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[22], cpu->f[28]);
+        /* 021FF958 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[22], cpu->f[28]));
         /* 021FF95C */ _t127 = cpu->r[24] + 0x00001110u;
         /* 021FF95C */ cpu->f[24] = rbrew_read_f32(cpu->mem, _t127);
-        /* 021FF960 */ _t128 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FF960 */ _t128 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FF960 */ _t129 = _t128 & 0x00000001u;
         /* 021FF960 */ if (_t129) goto L_021FF964; else goto L_021FFBCC;
   L_021FF964: ; // 0x21ff964
         /* 021FF964 */ goto L_021FF974;
   L_021FF968: ; // 0x21ff968
-        /* 021FF968 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[22], cpu->f[28]);
+        /* 021FF968 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[22], cpu->f[28]));
         /* 021FF96C */ _t130 = cpu->r[24] + 0x00001410u;
         /* 021FF96C */ cpu->f[24] = rbrew_read_f32(cpu->mem, _t130);
-        /* 021FF970 */ _t131 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FF970 */ _t131 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FF970 */ _t132 = _t131 & 0x00000001u;
         /* 021FF970 */ if (_t132) goto L_021FF974; else goto L_021FFBCC;
   L_021FF974: ; // 0x21ff974
-        /* 021FF974 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 021FF974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 021FF978 */ _t133 = cpu->r[31] + 0x0000016Cu;
         /* 021FF978 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t133);
-        /* 021FF97C */ _t134 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FF97C */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FF97C */ _t135 = _t134 & 0x00000001u;
         /* 021FF97C */ if (_t135) goto L_021FF9D4; else goto L_021FF980;
   L_021FF980: ; // 0x21ff980
@@ -3807,19 +3807,19 @@ void Gambit_fn_021FF640(CPUState* cpu) {
         /* 021FFAB0 */ _t162 = cpu->r[1] + 0x00000018u;
         /* 021FFAB0 */ rbrew_write_f32(cpu->mem, _t162, cpu->f[10]);
         /* 021FFAB4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 021FFAB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021FFAB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021FFAB8 */ _t163 = cpu->r[1] + 0x00000024u;
         /* 021FFAB8 */ rbrew_write_f32(cpu->mem, _t163, cpu->f[0]);
-        /* 021FFABC */ _t164 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FFABC */ _t164 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FFABC */ _t165 = _t164 & 0x00000001u;
         /* 021FFABC */ if (_t165) goto L_021FFAD8; else goto L_021FFAC0;
   L_021FFAC0: ; // 0x21ffac0
         /* 021FFAC0 */ cpu->f[9] = cpu->f[10] * cpu->f[10];
         /* 021FFAC4 */ cpu->f[9] = fma(cpu->f[12], cpu->f[12], cpu->f[9]);
-        /* 021FFAC8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[28]);
+        /* 021FFAC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[28]));
         /* 021FFACC */ _t166 = cpu->r[24] + 0x000011D0u;
         /* 021FFACC */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t166);
-        /* 021FFAD0 */ _t167 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FFAD0 */ _t167 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FFAD0 */ _t168 = _t167 & 0x00000001u;
         /* 021FFAD0 */ if (_t168) goto L_021FFAD4; else goto L_021FFB10;
   L_021FFAD4: ; // 0x21ffad4
@@ -3827,10 +3827,10 @@ void Gambit_fn_021FF640(CPUState* cpu) {
   L_021FFAD8: ; // 0x21ffad8
         /* 021FFAD8 */ cpu->f[9] = cpu->f[10] * cpu->f[10];
         /* 021FFADC */ cpu->f[9] = fma(cpu->f[12], cpu->f[12], cpu->f[9]);
-        /* 021FFAE0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[28]);
+        /* 021FFAE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[28]));
         /* 021FFAE4 */ _t169 = cpu->r[24] + 0x000014D0u;
         /* 021FFAE4 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t169);
-        /* 021FFAE8 */ _t170 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FFAE8 */ _t170 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FFAE8 */ _t171 = _t170 & 0x00000001u;
         /* 021FFAE8 */ if (_t171) goto L_021FFAEC; else goto L_021FFB10;
   L_021FFAEC: ; // 0x21ffaec
@@ -3855,18 +3855,18 @@ void Gambit_fn_021FF640(CPUState* cpu) {
         /* 021FFB1C */ cpu->r[5] = cpu->r[3] + cpu->r[6];
         /* 021FFB20 */ _t177 = cpu->r[5] + 0x00000104u;
         /* 021FFB20 */ cpu->r[4] = rbrew_read8(cpu->mem, _t177);
-        /* 021FFB24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 021FFB24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 021FFB28 */ _t178 = cpu->r[31] + 0x00000051u;
         /* 021FFB28 */ cpu->r[5] = rbrew_read8(cpu->mem, _t178);
-        /* 021FFB2C */ _t179 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FFB2C */ _t179 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FFB2C */ _t180 = _t179 & 0x00000001u;
         /* 021FFB2C */ if (_t180) goto L_021FFB9C; else goto L_021FFB30;
   L_021FFB30: ; // 0x21ffb30
         /* 021FFB30 */ cpu->r[6] = cpu->r[1] + 0x0000001Cu;
         /* 021FFB34 */ cpu->r[7] = cpu->r[25];
         /* 021FFB38 */ Gambit_fn_021F000C(cpu);
-        /* 021FFB3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FFB40 */ _t181 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FFB3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FFB40 */ _t181 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FFB40 */ _t182 = _t181 & 0x00000001u;
         /* 021FFB40 */ if (_t182) goto L_021FFB9C; else goto L_021FFB44;
   L_021FFB44: ; // 0x21ffb44
@@ -3914,15 +3914,15 @@ void Gambit_fn_021FF640(CPUState* cpu) {
         /* 021FFBB4 */ _t195 = cpu->r[31] + 0x0000016Cu;
         /* 021FFBB4 */ rbrew_write_f32(cpu->mem, _t195, cpu->f[10]);
   L_021FFBB8: ; // 0x21ffbb8
-        /* 021FFBB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[29]);
-        /* 021FFBBC */ _t196 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FFBB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[29]));
+        /* 021FFBBC */ _t196 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FFBBC */ _t197 = _t196 & 0x00000001u;
         /* 021FFBBC */ if (_t197) goto L_021FFBC0; else goto L_021FFBCC;
   L_021FFBC0: ; // 0x21ffbc0
         /* 021FFBC0 */ _t198 = cpu->r[31] + 0x00000198u;
         /* 021FFBC0 */ cpu->r[12] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t198);
-        /* 021FFBC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 021FFBC8 */ _t199 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FFBC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 021FFBC8 */ _t199 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FFBC8 */ _t200 = _t199 & 0x00000001u;
         /* 021FFBC8 */ if (_t200) goto L_021FFA28; else goto L_021FFBCC;
   L_021FFBCC: ; // 0x21ffbcc
@@ -3987,7 +3987,7 @@ void Gambit_fn_021FF640(CPUState* cpu) {
         /* 021FFC40 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t229);
         /* 021FFC44 */ _t230 = cpu->r[1] + 0x000000E0u;
         /* 021FFC44 */ cpu->f[25] = rbrew_read_f64(cpu->mem, _t230);
-        /* 021FFC48 */ _t231 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 021FFC48 */ _t231 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 021FFC48 */ _t232 = _t231 & 0x00000001u;
         /* 021FFC48 */ if (_t232) goto L_021FFC4C; // else: addr-0 trap, fall-through
   L_021FFC4C: ; // 0x21ffc4c
@@ -4037,9 +4037,9 @@ void Gambit_fn_021FFC5C(CPUState* cpu) {
         /* 021FFCB0 */ _t9 = cpu->r[10] + 0x00000104u;
         /* 021FFCB0 */ cpu->r[4] = rbrew_read8(cpu->mem, _t9);
         /* 021FFCB4 */ cpu->r[7] = cpu->r[3];
-        /* 021FFCB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 021FFCB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 021FFCBC */ cpu->r[27] = 0x00000000u;
-        /* 021FFCC0 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FFCC0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FFCC0 */ _t11 = _t10 & 0x00000001u;
         /* 021FFCC0 */ if (_t11) goto L_021FFCD8; else goto L_021FFCC4;
   L_021FFCC4: ; // 0x21ffcc4
@@ -4052,8 +4052,8 @@ void Gambit_fn_021FFC5C(CPUState* cpu) {
         /* 021FFCD8 */ _t12 = cpu->r[29] + 0x00000198u;
         /* 021FFCD8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
         /* 021FFCDC */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 021FFCDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 021FFCE0 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FFCDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 021FFCE0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FFCE0 */ _t14 = _t13 & 0x00000001u;
         /* 021FFCE0 */ if (_t14) goto L_021FFCE4; else goto L_021FFCF8;
   L_021FFCE4: ; // 0x21ffce4
@@ -4065,8 +4065,8 @@ void Gambit_fn_021FFC5C(CPUState* cpu) {
         /* 021FFCF0 */ cpu->r[3] = cpu->r[29];
         /* 021FFCF4 */ rbrew_call_indirect(cpu, cpu->ctr);
   L_021FFCF8: ; // 0x21ffcf8
-        /* 021FFCF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 021FFCFC */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FFCF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 021FFCFC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FFCFC */ _t18 = _t17 & 0x00000001u;
         /* 021FFCFC */ if (_t18) goto L_021FFD64; else goto L_021FFD00;
   L_021FFD00: ; // 0x21ffd00
@@ -4083,7 +4083,7 @@ void Gambit_fn_021FFC5C(CPUState* cpu) {
         /* 021FFD14 */ cpu->r[0] = rbrew_read32(cpu->mem, _t23);
         /* 021FFD18 */ cpu->r[3] = cpu->r[27];
         /* 021FFD1C */ cpu->r[11] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x00000000u, 0x00000005u);
-        /* 021FFD20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 021FFD20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 021FFD24 */ /* nop */
         /* 021FFD28 */ cpu->r[4] = 0x00000000u;
         /* 021FFD2C */ _t24 = cpu->r[1] + 0x0000000Cu;
@@ -4095,7 +4095,7 @@ void Gambit_fn_021FFC5C(CPUState* cpu) {
         /* 021FFD3C */ cpu->r[7] = cpu->r[29] + 0x00000188u;
         /* 021FFD40 */ _t26 = cpu->r[1] + 0x00000010u;
         /* 021FFD40 */ rbrew_write32(cpu->mem, _t26, cpu->r[0]);
-        /* 021FFD44 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FFD44 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FFD44 */ _t28 = _t27 & 0x00000001u;
         /* 021FFD44 */ if (_t28) goto L_021FFD60; else goto L_021FFD48;
   L_021FFD48: ; // 0x21ffd48
@@ -4173,8 +4173,8 @@ void Gambit_fn_021FFD78(CPUState* cpu) {
         /* 021FFDEC */ cpu->f[10] = fma(cpu->f[12], cpu->f[12], cpu->f[11]);
         /* 021FFDF0 */ _t17 = cpu->r[9] + 0xFFFFE510u;
         /* 021FFDF0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t17);
-        /* 021FFDF4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[13]);
-        /* 021FFDF8 */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FFDF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[13]));
+        /* 021FFDF8 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FFDF8 */ _t19 = _t18 & 0x00000001u;
         /* 021FFDF8 */ if (_t19) goto L_021FFDFC; else goto L_021FFE38;
   L_021FFDFC: ; // 0x21ffdfc
@@ -4225,8 +4225,8 @@ void Gambit_fn_021FFD78(CPUState* cpu) {
         /* 021FFE78 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 021FFE7C */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 021FFE80 */ Gambit_fn_021C6DD8(cpu);
-        /* 021FFE84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FFE88 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FFE84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FFE88 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FFE88 */ _t33 = _t32 & 0x00000001u;
         /* 021FFE88 */ if (_t33) goto L_021FFE8C; else goto L_021FFEA0;
   L_021FFE8C: ; // 0x21ffe8c
@@ -4277,10 +4277,10 @@ void Gambit_fn_021FFD78(CPUState* cpu) {
         /* 021FFF04 */ _t47 = cpu->r[31] + 0x000001E0u;
         /* 021FFF04 */ rbrew_write_f32(cpu->mem, _t47, cpu->f[9]);
         /* 021FFF08 */ cpu->r[12] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 021FFF08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021FFF08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021FFF0C */ _t48 = cpu->r[31] + 0x000001E4u;
         /* 021FFF0C */ rbrew_write_f32(cpu->mem, _t48, cpu->f[0]);
-        /* 021FFF10 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FFF10 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FFF10 */ _t50 = _t49 & 0x00000001u;
         /* 021FFF10 */ if (_t50) goto L_021FFF1C; else goto L_021FFF14;
   L_021FFF14: ; // 0x21fff14
@@ -4351,8 +4351,8 @@ void Gambit_fn_021FFD7C(CPUState* cpu) {
         /* 021FFDEC */ cpu->f[10] = fma(cpu->f[12], cpu->f[12], cpu->f[11]);
         /* 021FFDF0 */ _t17 = cpu->r[9] + 0xFFFFE510u;
         /* 021FFDF0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t17);
-        /* 021FFDF4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[13]);
-        /* 021FFDF8 */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 021FFDF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[13]));
+        /* 021FFDF8 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 021FFDF8 */ _t19 = _t18 & 0x00000001u;
         /* 021FFDF8 */ if (_t19) goto L_021FFDFC; else goto L_021FFE38;
   L_021FFDFC: ; // 0x21ffdfc
@@ -4403,8 +4403,8 @@ void Gambit_fn_021FFD7C(CPUState* cpu) {
         /* 021FFE78 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 021FFE7C */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 021FFE80 */ Gambit_fn_021C6DD8(cpu);
-        /* 021FFE84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 021FFE88 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FFE84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 021FFE88 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FFE88 */ _t33 = _t32 & 0x00000001u;
         /* 021FFE88 */ if (_t33) goto L_021FFE8C; else goto L_021FFEA0;
   L_021FFE8C: ; // 0x21ffe8c
@@ -4455,10 +4455,10 @@ void Gambit_fn_021FFD7C(CPUState* cpu) {
         /* 021FFF04 */ _t47 = cpu->r[31] + 0x000001E0u;
         /* 021FFF04 */ rbrew_write_f32(cpu->mem, _t47, cpu->f[9]);
         /* 021FFF08 */ cpu->r[12] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 021FFF08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 021FFF08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 021FFF0C */ _t48 = cpu->r[31] + 0x000001E4u;
         /* 021FFF0C */ rbrew_write_f32(cpu->mem, _t48, cpu->f[0]);
-        /* 021FFF10 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021FFF10 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021FFF10 */ _t50 = _t49 & 0x00000001u;
         /* 021FFF10 */ if (_t50) goto L_021FFF1C; else goto L_021FFF14;
   L_021FFF14: ; // 0x21fff14
@@ -4645,8 +4645,8 @@ void Gambit_fn_021FFF30(CPUState* cpu) {
         /* 022000C8 */ _t59 = cpu->r[28] + 0x00000198u;
         /* 022000C8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t59);
         /* 022000CC */ cpu->r[9] = rbrew_rlwinm(cpu->r[9], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 022000CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 022000D0 */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022000CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 022000D0 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022000D0 */ _t61 = _t60 & 0x00000001u;
         /* 022000D0 */ if (_t61) goto L_02200100; else goto L_022000D4;
   L_022000D4: ; // 0x22000d4
@@ -4694,7 +4694,7 @@ void Gambit_fn_021FFF30(CPUState* cpu) {
         /* 02200134 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t76);
         /* 02200138 */ _t77 = cpu->r[1] + 0x00000090u;
         /* 02200138 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t77);
-        /* 0220013C */ _t78 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220013C */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220013C */ _t79 = _t78 & 0x00000001u;
         /* 0220013C */ if (_t79) goto L_02200140; // else: addr-0 trap, fall-through
   L_02200140: ; // 0x2200140
@@ -4827,8 +4827,8 @@ void Gambit_fn_02200150(CPUState* cpu) {
   L_02200298: ; // 0x2200298
         /* 02200298 */ /* nop */
         /* 0220029C */ cpu->r[0] = cpu->r[18] & cpu->r[8];
-        /* 0220029C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022002A0 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220029C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022002A0 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022002A0 */ _t31 = _t30 & 0x00000001u;
         /* 022002A0 */ if (_t31) goto L_02200354; else goto L_022002A4;
   L_022002A4: ; // 0x22002a4
@@ -4878,9 +4878,9 @@ void Gambit_fn_02200150(CPUState* cpu) {
         /* 02200310 */ cpu->r[12] = rbrew_read32(cpu->mem, _t47);
         /* 02200314 */ _t48 = cpu->r[12] + 0x00000078u;
         /* 02200314 */ cpu->r[0] = rbrew_read32(cpu->mem, _t48);
-        /* 02200318 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
+        /* 02200318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
         /* 0220031C */ cpu->r[3] = 0x00000000u;
-        /* 02200320 */ _t49 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02200320 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02200320 */ _t50 = _t49 & 0x00000001u;
         /* 02200320 */ if (_t50) goto L_02200324; else goto L_0220032C;
   L_02200324: ; // 0x2200324
@@ -4896,8 +4896,8 @@ void Gambit_fn_02200150(CPUState* cpu) {
         /* 02200338 */ cpu->r[6] = rbrew_read32(cpu->mem, _t53);
         /* 0220033C */ _t54 = cpu->r[6] + 0x00000044u;
         /* 0220033C */ cpu->r[7] = rbrew_read8(cpu->mem, _t54);
-        /* 02200340 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 02200344 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02200340 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 02200344 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02200344 */ _t56 = _t55 & 0x00000001u;
         /* 02200344 */ if (_t56) goto L_02200354; else goto L_02200348;
   L_02200348: ; // 0x2200348
@@ -4907,9 +4907,9 @@ void Gambit_fn_02200150(CPUState* cpu) {
         /* 02200350 */ Gambit_fn_023EEED0(cpu);
   L_02200354: ; // 0x2200354
         /* 02200354 */ cpu->r[20] = cpu->r[20] + 0xFFFFFFFFu;
-        /* 02200354 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
+        /* 02200354 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
         /* 02200358 */ cpu->r[17] = cpu->r[17] + 0x00000001u;
-        /* 0220035C */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220035C */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220035C */ _t59 = _t58 & 0x00000001u;
         /* 0220035C */ if (_t59) goto L_02200360; else goto L_02200298;
   L_02200360: ; // 0x2200360
@@ -4918,7 +4918,7 @@ void Gambit_fn_02200150(CPUState* cpu) {
         /* 02200364 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t60);
         /* 02200368 */ _t61 = cpu->r[1] + 0x000000D8u;
         /* 02200368 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t61);
-        /* 0220036C */ _t62 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220036C */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220036C */ _t63 = _t62 & 0x00000001u;
         /* 0220036C */ if (_t63) goto L_02200370; // else: addr-0 trap, fall-through
   L_02200370: ; // 0x2200370
@@ -4960,16 +4960,16 @@ void Gambit_fn_02200380(CPUState* cpu) {
         /* 022003B8 */ _t8 = cpu->r[26] + 0x00000198u;
         /* 022003B8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
         /* 022003BC */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 022003BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 022003BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 022003C0 */ cpu->r[27] = cpu->r[5];
-        /* 022003C4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022003C4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022003C4 */ _t10 = _t9 & 0x00000001u;
         /* 022003C4 */ if (_t10) goto L_02200738; else goto L_022003C8;
   L_022003C8: ; // 0x22003c8
         /* 022003C8 */ _t11 = cpu->r[26] + 0x00000051u;
         /* 022003C8 */ cpu->r[10] = rbrew_read8(cpu->mem, _t11);
-        /* 022003CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 022003D0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022003CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 022003D0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022003D0 */ _t13 = _t12 & 0x00000001u;
         /* 022003D0 */ if (_t13) goto L_02200738; else goto L_022003D4;
   L_022003D4: ; // 0x22003d4
@@ -4985,8 +4985,8 @@ void Gambit_fn_02200380(CPUState* cpu) {
         /* 022003EC */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t16);
         /* 022003F0 */ _t17 = cpu->r[7] + 0xFFFFE510u;
         /* 022003F0 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t17);
-        /* 022003F4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[30]);
-        /* 022003F8 */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022003F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[30]));
+        /* 022003F8 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022003F8 */ _t19 = _t18 & 0x00000001u;
         /* 022003F8 */ if (_t19) goto L_022003FC; else goto L_02200738;
   L_022003FC: ; // 0x22003fc
@@ -5003,28 +5003,28 @@ void Gambit_fn_02200380(CPUState* cpu) {
         /* 02200414 */ rbrew_write32(cpu->mem, _t23, cpu->r[25]);
         /* 02200418 */ cpu->r[5] = 0x10040000u;
         /* 0220041C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 0220041C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0220041C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02200420 */ _t24 = cpu->r[12] + 0xFFFF9484u;
         /* 02200420 */ cpu->r[24] = rbrew_read32(cpu->mem, _t24);
         /* 02200424 */ _t25 = cpu->r[5] + 0xFFFFE51Cu;
         /* 02200424 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t25);
-        /* 02200428 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02200428 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02200428 */ _t27 = _t26 & 0x00000001u;
         /* 02200428 */ if (_t27) goto L_02200480; else goto L_0220042C;
   L_0220042C: ; // 0x220042c
         /* 0220042C */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0220042C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0220042C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02200430 */ cpu->r[31] = cpu->r[27] + 0x000000A8u;
-        /* 02200434 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02200434 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02200434 */ _t29 = _t28 & 0x00000001u;
         /* 02200434 */ if (_t29) goto L_02200470; else goto L_02200438;
   L_02200438: ; // 0x2200438
         /* 02200438 */ cpu->r[3] = cpu->r[27] + 0x00000138u;
         /* 0220043C */ Gambit_fn_02C69350(cpu);
-        /* 02200440 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 02200440 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 02200444 */ _t30 = cpu->r[27] + 0x00000000u;
         /* 02200444 */ cpu->r[8] = rbrew_read32(cpu->mem, _t30);
-        /* 02200448 */ _t31 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02200448 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02200448 */ _t32 = _t31 & 0x00000001u;
         /* 02200448 */ if (_t32) goto L_0220044C; else goto L_02200468;
   L_0220044C: ; // 0x220044c
@@ -5043,27 +5043,27 @@ void Gambit_fn_02200380(CPUState* cpu) {
         /* 0220046C */ rbrew_write32(cpu->mem, _t35, cpu->r[8]);
   L_02200470: ; // 0x2200470
         /* 02200470 */ cpu->r[28] = cpu->r[24];
-        /* 02200470 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 02200470 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 02200474 */ cpu->r[22] = 0x00000000u;
-        /* 02200478 */ _t36 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02200478 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02200478 */ _t37 = _t36 & 0x00000001u;
         /* 02200478 */ if (_t37) goto L_0220047C; else goto L_022006F4;
   L_0220047C: ; // 0x220047c
         /* 0220047C */ goto L_022004D0;
   L_02200480: ; // 0x2200480
         /* 02200480 */ cpu->r[0] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02200480 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02200480 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02200484 */ cpu->r[31] = cpu->r[27] + 0x00000048u;
-        /* 02200488 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02200488 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02200488 */ _t39 = _t38 & 0x00000001u;
         /* 02200488 */ if (_t39) goto L_022004C4; else goto L_0220048C;
   L_0220048C: ; // 0x220048c
         /* 0220048C */ cpu->r[3] = cpu->r[27] + 0x0000012Cu;
         /* 02200490 */ Gambit_fn_02C69350(cpu);
-        /* 02200494 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 02200494 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 02200498 */ _t40 = cpu->r[27] + 0x00000000u;
         /* 02200498 */ cpu->r[4] = rbrew_read32(cpu->mem, _t40);
-        /* 0220049C */ _t41 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220049C */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220049C */ _t42 = _t41 & 0x00000001u;
         /* 0220049C */ if (_t42) goto L_022004A0; else goto L_022004BC;
   L_022004A0: ; // 0x22004a0
@@ -5082,9 +5082,9 @@ void Gambit_fn_02200380(CPUState* cpu) {
         /* 022004C0 */ rbrew_write32(cpu->mem, _t45, cpu->r[4]);
   L_022004C4: ; // 0x22004c4
         /* 022004C4 */ cpu->r[28] = cpu->r[24];
-        /* 022004C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 022004C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 022004C8 */ cpu->r[22] = 0x00000000u;
-        /* 022004CC */ _t46 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022004CC */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022004CC */ _t47 = _t46 & 0x00000001u;
         /* 022004CC */ if (_t47) goto L_022004D0; else goto L_022006F4;
   L_022004D0: ; // 0x22004d0
@@ -5102,10 +5102,10 @@ void Gambit_fn_02200380(CPUState* cpu) {
         /* 022004F8 */ Gambit_fn_02040F70(cpu);
         /* 022004FC */ _t48 = cpu->r[1] + 0x00000024u;
         /* 022004FC */ cpu->r[0] = rbrew_read32(cpu->mem, _t48);
-        /* 02200500 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02200500 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02200504 */ _t49 = cpu->r[1] + 0x00000070u;
         /* 02200504 */ cpu->r[12] = rbrew_read32(cpu->mem, _t49);
-        /* 02200508 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02200508 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02200508 */ _t51 = _t50 & 0x00000001u;
         /* 02200508 */ if (_t51) goto L_0220050C; else goto L_02200518;
   L_0220050C: ; // 0x220050c
@@ -5119,8 +5119,8 @@ void Gambit_fn_02200380(CPUState* cpu) {
         /* 0220051C */ _t54 = cpu->r[11] + 0x00000000u;
         /* 0220051C */ cpu->r[9] = rbrew_read32(cpu->mem, _t54);
         /* 02200520 */ cpu->r[7] = rbrew_rlwinm(cpu->r[9], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 02200520 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 02200524 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02200520 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 02200524 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02200524 */ _t56 = _t55 & 0x00000001u;
         /* 02200524 */ if (_t56) goto L_022005B0; else goto L_02200528;
   L_02200528: ; // 0x2200528
@@ -5173,8 +5173,8 @@ void Gambit_fn_02200380(CPUState* cpu) {
         /* 022005A0 */ _t73 = cpu->r[12] + 0x00000000u;
         /* 022005A0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t73);
         /* 022005A4 */ cpu->r[8] = rbrew_rlwinm(cpu->r[9], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 022005A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 022005A8 */ _t74 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022005A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 022005A8 */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022005A8 */ _t75 = _t74 & 0x00000001u;
         /* 022005A8 */ if (_t75) goto L_022005AC; else goto L_022005F0;
   L_022005AC: ; // 0x22005ac
@@ -5205,8 +5205,8 @@ void Gambit_fn_02200380(CPUState* cpu) {
         /* 022005E4 */ _t85 = cpu->r[12] + 0x00000000u;
         /* 022005E4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t85);
         /* 022005E8 */ cpu->r[8] = rbrew_rlwinm(cpu->r[9], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 022005E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 022005EC */ _t86 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022005E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 022005EC */ _t86 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022005EC */ _t87 = _t86 & 0x00000001u;
         /* 022005EC */ if (_t87) goto L_02200648; else goto L_022005F0;
   L_022005F0: ; // 0x22005f0
@@ -5242,10 +5242,10 @@ void Gambit_fn_02200380(CPUState* cpu) {
         /* 02200630 */ _t101 = cpu->r[12] + 0x00000030u;
         /* 02200630 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t101);
         /* 02200634 */ cpu->f[6] = cpu->f[12] + cpu->f[7];
-        /* 02200638 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
+        /* 02200638 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
         /* 0220063C */ _t102 = cpu->r[1] + 0x00000020u;
         /* 0220063C */ rbrew_write_f32(cpu->mem, _t102, cpu->f[6]);
-        /* 02200640 */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02200640 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02200640 */ _t104 = _t103 & 0x00000001u;
         /* 02200640 */ if (_t104) goto L_02200644; else goto L_0220065C;
   L_02200644: ; // 0x2200644
@@ -5254,10 +5254,10 @@ void Gambit_fn_02200380(CPUState* cpu) {
         /* 02200648 */ _t105 = cpu->r[12] + 0x00000030u;
         /* 02200648 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t105);
         /* 0220064C */ cpu->f[8] = cpu->f[7] + cpu->f[9];
-        /* 02200650 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
+        /* 02200650 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
         /* 02200654 */ _t106 = cpu->r[1] + 0x00000020u;
         /* 02200654 */ rbrew_write_f32(cpu->mem, _t106, cpu->f[8]);
-        /* 02200658 */ _t107 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02200658 */ _t107 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02200658 */ _t108 = _t107 & 0x00000001u;
         /* 02200658 */ if (_t108) goto L_02200698; else goto L_0220065C;
   L_0220065C: ; // 0x220065c
@@ -5277,8 +5277,8 @@ void Gambit_fn_02200380(CPUState* cpu) {
         /* 02200684 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t111);
         /* 02200688 */ cpu->f[0] = fma(cpu->f[10], cpu->f[9], cpu->f[12]);
         /* 0220068C */ cpu->f[8] = fma(cpu->f[10], cpu->f[7], cpu->f[6]);
-        /* 02200690 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[8]);
-        /* 02200694 */ _t112 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02200690 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[8]));
+        /* 02200694 */ _t112 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02200694 */ _t113 = _t112 & 0x00000001u;
         /* 02200694 */ if (_t113) goto L_02200698; else goto L_022006E8;
   L_02200698: ; // 0x2200698
@@ -5323,16 +5323,16 @@ void Gambit_fn_02200380(CPUState* cpu) {
         /* 022006E4 */ rbrew_write_f32(cpu->mem, _t132, cpu->f[12]);
   L_022006E8: ; // 0x22006e8
         /* 022006E8 */ cpu->r[28] = cpu->r[28] + 0xFFFFFFFFu;
-        /* 022006E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 022006E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 022006EC */ cpu->r[22] = cpu->r[22] + 0x00000001u;
-        /* 022006F0 */ _t133 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022006F0 */ _t133 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022006F0 */ _t134 = _t133 & 0x00000001u;
         /* 022006F0 */ if (_t134) goto L_022006F4; else goto L_022004D8;
   L_022006F4: ; // 0x22006f4
-        /* 022006F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 022006F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 022006F8 */ _t135 = cpu->r[1] + 0x00000074u;
         /* 022006F8 */ rbrew_write32(cpu->mem, _t135, cpu->r[25]);
-        /* 022006FC */ _t136 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022006FC */ _t136 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022006FC */ _t137 = _t136 & 0x00000001u;
         /* 022006FC */ if (_t137) goto L_02200700; else goto L_02200738;
   L_02200700: ; // 0x2200700
@@ -5370,7 +5370,7 @@ void Gambit_fn_02200380(CPUState* cpu) {
         /* 0220074C */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t148);
         /* 02200750 */ _t149 = cpu->r[1] + 0x000000C8u;
         /* 02200750 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t149);
-        /* 02200754 */ _t150 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02200754 */ _t150 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02200754 */ _t151 = _t150 & 0x00000001u;
         /* 02200754 */ if (_t151) goto L_02200758; // else: addr-0 trap, fall-through
   L_02200758: ; // 0x2200758
@@ -5481,8 +5481,8 @@ void Gambit_fn_02200768(CPUState* cpu) {
         /* 02200854 */ cpu->f[10] = fma(cpu->f[8], cpu->f[9], cpu->f[6]);
         /* 02200858 */ _t31 = cpu->r[12] + 0xFFFFE510u;
         /* 02200858 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t31);
-        /* 0220085C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[29]);
-        /* 02200860 */ _t32 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220085C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[29]));
+        /* 02200860 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02200860 */ _t33 = _t32 & 0x00000001u;
         /* 02200860 */ if (_t33) goto L_02200C74; else goto L_02200864;
   L_02200864: ; // 0x2200864
@@ -5521,10 +5521,10 @@ void Gambit_fn_02200768(CPUState* cpu) {
         /* 022008B4 */ cpu->f[27] = rbrew_read_f32(cpu->mem, _t45);
         /* 022008B8 */ cpu->f[6] = fma(cpu->f[11], cpu->f[11], cpu->f[10]);
         /* 022008BC */ cpu->r[8] = 0x10040000u;
-        /* 022008C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[29]);
+        /* 022008C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[29]));
         /* 022008C4 */ _t46 = cpu->r[8] + 0xFFFFE514u;
         /* 022008C4 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t46);
-        /* 022008C8 */ _t47 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022008C8 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022008C8 */ _t48 = _t47 & 0x00000001u;
         /* 022008C8 */ if (_t48) goto L_022008CC; else goto L_022008F8;
   L_022008CC: ; // 0x22008cc
@@ -5577,8 +5577,8 @@ void Gambit_fn_02200768(CPUState* cpu) {
         /* 02200948 */ _t63 = cpu->r[1] + 0x00000058u;
         /* 02200948 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t63);
         /* 0220094C */ cpu->f[7] = fma(cpu->f[7], cpu->f[7], cpu->f[10]);
-        /* 02200950 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[29]);
-        /* 02200954 */ _t64 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02200950 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[29]));
+        /* 02200954 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02200954 */ _t65 = _t64 & 0x00000001u;
         /* 02200954 */ if (_t65) goto L_02200958; else goto L_02200984;
   L_02200958: ; // 0x2200958
@@ -5656,8 +5656,8 @@ void Gambit_fn_02200768(CPUState* cpu) {
         /* 02200A14 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t88);
         /* 02200A18 */ /* nop */
         /* 02200A1C */ cpu->f[9] = fma(cpu->f[7], cpu->f[8], cpu->f[0]);
-        /* 02200A20 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[29]);
-        /* 02200A24 */ _t89 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02200A20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[29]));
+        /* 02200A24 */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02200A24 */ _t90 = _t89 & 0x00000001u;
         /* 02200A24 */ if (_t90) goto L_02200C74; else goto L_02200A28;
   L_02200A28: ; // 0x2200a28
@@ -5699,8 +5699,8 @@ void Gambit_fn_02200768(CPUState* cpu) {
         /* 02200A8C */ cpu->r[24] = rbrew_read32(cpu->mem, _t100);
         /* 02200A90 */ goto L_02200C3C;
   L_02200A94: ; // 0x2200a94
-        /* 02200A94 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[26]);
-        /* 02200A98 */ _t101 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02200A94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[26]));
+        /* 02200A98 */ _t101 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02200A98 */ _t102 = _t101 & 0x00000001u;
         /* 02200A98 */ if (_t102) goto L_02200C74; else goto L_02200A9C;
   L_02200A9C: ; // 0x2200a9c
@@ -5761,8 +5761,8 @@ void Gambit_fn_02200768(CPUState* cpu) {
         /* 02200B28 */ cpu->f[13] = cpu->f[6] - cpu->f[9];
         /* 02200B2C */ cpu->f[0] = cpu->f[0] * cpu->f[0];
         /* 02200B30 */ cpu->f[12] = fma(cpu->f[13], cpu->f[13], cpu->f[0]);
-        /* 02200B34 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[29]);
-        /* 02200B38 */ _t122 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02200B34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[29]));
+        /* 02200B38 */ _t122 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02200B38 */ _t123 = _t122 & 0x00000001u;
         /* 02200B38 */ if (_t123) goto L_02200B5C; else goto L_02200B3C;
   L_02200B3C: ; // 0x2200b3c
@@ -5772,10 +5772,10 @@ void Gambit_fn_02200768(CPUState* cpu) {
         /* 02200B44 */ _t125 = cpu->r[12] + 0x00000104u;
         /* 02200B44 */ cpu->r[4] = rbrew_read8(cpu->mem, _t125);
         /* 02200B48 */ cpu->f[22] = cpu->f[29] * cpu->f[12];
-        /* 02200B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 02200B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 02200B50 */ _t126 = cpu->r[30] + 0x00000051u;
         /* 02200B50 */ cpu->r[5] = rbrew_read8(cpu->mem, _t126);
-        /* 02200B54 */ _t127 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02200B54 */ _t127 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02200B54 */ _t128 = _t127 & 0x00000001u;
         /* 02200B54 */ if (_t128) goto L_02200C34; else goto L_02200B58;
   L_02200B58: ; // 0x2200b58
@@ -5794,10 +5794,10 @@ void Gambit_fn_02200768(CPUState* cpu) {
         /* 02200B78 */ _t132 = cpu->r[12] + 0x00000104u;
         /* 02200B78 */ cpu->r[4] = rbrew_read8(cpu->mem, _t132);
         /* 02200B7C */ cpu->f[22] = cpu->f[23] * cpu->f[12];
-        /* 02200B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 02200B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 02200B84 */ _t133 = cpu->r[30] + 0x00000051u;
         /* 02200B84 */ cpu->r[5] = rbrew_read8(cpu->mem, _t133);
-        /* 02200B88 */ _t134 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02200B88 */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02200B88 */ _t135 = _t134 & 0x00000001u;
         /* 02200B88 */ if (_t135) goto L_02200C34; else goto L_02200B8C;
   L_02200B8C: ; // 0x2200b8c
@@ -5806,8 +5806,8 @@ void Gambit_fn_02200768(CPUState* cpu) {
         /* 02200B94 */ cpu->r[3] = cpu->r[24];
         /* 02200B98 */ Gambit_fn_021F000C(cpu);
         /* 02200B9C */ cpu->r[31] = cpu->r[3];
-        /* 02200B9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02200BA0 */ _t136 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02200B9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02200BA0 */ _t136 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02200BA0 */ _t137 = _t136 & 0x00000001u;
         /* 02200BA0 */ if (_t137) goto L_02200C34; else goto L_02200BA4;
   L_02200BA4: ; // 0x2200ba4
@@ -5817,10 +5817,10 @@ void Gambit_fn_02200768(CPUState* cpu) {
         /* 02200BA8 */ cpu->r[5] = rbrew_read8(cpu->mem, _t139);
         /* 02200BAC */ _t140 = cpu->r[4] + 0x000003DCu;
         /* 02200BAC */ cpu->r[0] = rbrew_read32(cpu->mem, _t140);
-        /* 02200BB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02200BB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02200BB4 */ cpu->r[3] = cpu->r[30];
         /* 02200BB8 */ cpu->ctr = cpu->r[0];
-        /* 02200BBC */ _t141 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02200BBC */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02200BBC */ _t142 = _t141 & 0x00000001u;
         /* 02200BBC */ if (_t142) goto L_02200C00; else goto L_02200BC0;
   L_02200BC0: ; // 0x2200bc0
@@ -5866,8 +5866,8 @@ void Gambit_fn_02200768(CPUState* cpu) {
         /* 02200C34 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
         /* 02200C38 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
   L_02200C3C: ; // 0x2200c3c
-        /* 02200C3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[27]);
-        /* 02200C40 */ _t151 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02200C3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[27]));
+        /* 02200C40 */ _t151 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02200C40 */ _t152 = _t151 & 0x00000001u;
         /* 02200C40 */ if (_t152) goto L_02200C44; else goto L_02200C74;
   L_02200C44: ; // 0x2200c44
@@ -5885,8 +5885,8 @@ void Gambit_fn_02200768(CPUState* cpu) {
         /* 02200C60 */ cpu->f[8] = cpu->f[6] - cpu->f[11];
         /* 02200C64 */ cpu->f[11] = (double)(float)cpu->f[8];
         /* 02200C68 */ cpu->f[12] = cpu->f[11] * cpu->f[31];
-        /* 02200C6C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[26]);
-        /* 02200C70 */ _t157 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02200C6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[26]));
+        /* 02200C70 */ _t157 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02200C70 */ _t158 = _t157 & 0x00000001u;
         /* 02200C70 */ if (_t158) goto L_02200C74; else goto L_02200A94;
   L_02200C74: ; // 0x2200c74
@@ -5931,7 +5931,7 @@ void Gambit_fn_02200768(CPUState* cpu) {
         /* 02200CC0 */ cpu->f[22] = rbrew_read_f64(cpu->mem, _t177);
         /* 02200CC4 */ _t178 = cpu->r[1] + 0x00000170u;
         /* 02200CC4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t178);
-        /* 02200CC8 */ _t179 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02200CC8 */ _t179 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02200CC8 */ _t180 = _t179 & 0x00000001u;
         /* 02200CC8 */ if (_t180) goto L_02200CCC; // else: addr-0 trap, fall-through
   L_02200CCC: ; // 0x2200ccc
@@ -5971,10 +5971,10 @@ void Gambit_fn_02200CDC(CPUState* cpu) {
         /* 02200D10 */ _t7 = cpu->r[8] & 0xFFFFCFFFu;
         /* 02200D10 */ cpu->r[8] = _t7 | _t6;
         /* 02200D14 */ cpu->r[0] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 02200D14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02200D14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02200D18 */ _t8 = cpu->r[28] + 0x00000198u;
         /* 02200D18 */ rbrew_write32(cpu->mem, _t8, cpu->r[8]);
-        /* 02200D1C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02200D1C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02200D1C */ _t10 = _t9 & 0x00000001u;
         /* 02200D1C */ if (_t10) goto L_02200D4C; else goto L_02200D20;
   L_02200D20: ; // 0x2200d20
@@ -6005,18 +6005,18 @@ void Gambit_fn_02200CDC(CPUState* cpu) {
         /* 02200D5C */ _t19 = cpu->r[28] + 0x00000198u;
         /* 02200D5C */ cpu->r[7] = rbrew_read32(cpu->mem, _t19);
         /* 02200D60 */ cpu->r[7] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 02200D60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02200D60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02200D64 */ cpu->r[31] = cpu->r[3];
-        /* 02200D68 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02200D68 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02200D68 */ _t21 = _t20 & 0x00000001u;
         /* 02200D68 */ if (_t21) goto L_02200E70; else goto L_02200D6C;
   L_02200D6C: ; // 0x2200d6c
         /* 02200D6C */ _t22 = cpu->r[30] + 0x00000000u;
         /* 02200D6C */ cpu->r[12] = rbrew_read32(cpu->mem, _t22);
         /* 02200D70 */ cpu->r[9] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 02200D70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02200D70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02200D74 */ cpu->r[27] = cpu->r[30] + 0x000000A8u;
-        /* 02200D78 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02200D78 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02200D78 */ _t24 = _t23 & 0x00000001u;
         /* 02200D78 */ if (_t24) goto L_02200DC4; else goto L_02200D7C;
   L_02200D7C: ; // 0x2200d7c
@@ -6025,10 +6025,10 @@ void Gambit_fn_02200CDC(CPUState* cpu) {
         /* 02200D84 */ cpu->r[11] = 0x10040000u;
         /* 02200D88 */ _t25 = cpu->r[11] + 0xFFFFE510u;
         /* 02200D88 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t25);
-        /* 02200D8C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[12]);
+        /* 02200D8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[12]));
         /* 02200D90 */ _t26 = cpu->r[30] + 0x00000000u;
         /* 02200D90 */ cpu->r[11] = rbrew_read32(cpu->mem, _t26);
-        /* 02200D94 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02200D94 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02200D94 */ _t28 = _t27 & 0x00000001u;
         /* 02200D94 */ if (_t28) goto L_02200D98; else goto L_02200DBC;
   L_02200D98: ; // 0x2200d98
@@ -6155,10 +6155,10 @@ void Gambit_fn_02200E90(CPUState* cpu) {
         /* 02200EC4 */ _t7 = cpu->r[8] & 0xFFFFCFFFu;
         /* 02200EC4 */ cpu->r[8] = _t7 | _t6;
         /* 02200EC8 */ cpu->r[9] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 02200EC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02200EC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02200ECC */ _t8 = cpu->r[28] + 0x00000198u;
         /* 02200ECC */ rbrew_write32(cpu->mem, _t8, cpu->r[8]);
-        /* 02200ED0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02200ED0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02200ED0 */ _t10 = _t9 & 0x00000001u;
         /* 02200ED0 */ if (_t10) goto L_02200F00; else goto L_02200ED4;
   L_02200ED4: ; // 0x2200ed4
@@ -6199,19 +6199,19 @@ void Gambit_fn_02200E90(CPUState* cpu) {
         /* 02200F24 */ cpu->r[6] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x0000001Au, 0x00000017u);
         /* 02200F28 */ cpu->r[31] = cpu->r[3];
         /* 02200F2C */ cpu->r[8] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 02200F2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02200F2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02200F30 */ _t24 = cpu->r[28] + 0x00000198u;
         /* 02200F30 */ rbrew_write32(cpu->mem, _t24, cpu->r[6]);
-        /* 02200F34 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02200F34 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02200F34 */ _t26 = _t25 & 0x00000001u;
         /* 02200F34 */ if (_t26) goto L_0220103C; else goto L_02200F38;
   L_02200F38: ; // 0x2200f38
         /* 02200F38 */ _t27 = cpu->r[30] + 0x00000000u;
         /* 02200F38 */ cpu->r[0] = rbrew_read32(cpu->mem, _t27);
         /* 02200F3C */ cpu->r[10] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02200F3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02200F3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02200F40 */ cpu->r[27] = cpu->r[30] + 0x00000048u;
-        /* 02200F44 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02200F44 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02200F44 */ _t29 = _t28 & 0x00000001u;
         /* 02200F44 */ if (_t29) goto L_02200F90; else goto L_02200F48;
   L_02200F48: ; // 0x2200f48
@@ -6220,10 +6220,10 @@ void Gambit_fn_02200E90(CPUState* cpu) {
         /* 02200F50 */ cpu->r[12] = 0x10040000u;
         /* 02200F54 */ _t30 = cpu->r[12] + 0xFFFFE510u;
         /* 02200F54 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t30);
-        /* 02200F58 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[13]);
+        /* 02200F58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[13]));
         /* 02200F5C */ _t31 = cpu->r[30] + 0x00000000u;
         /* 02200F5C */ cpu->r[12] = rbrew_read32(cpu->mem, _t31);
-        /* 02200F60 */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02200F60 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02200F60 */ _t33 = _t32 & 0x00000001u;
         /* 02200F60 */ if (_t33) goto L_02200F64; else goto L_02200F88;
   L_02200F64: ; // 0x2200f64
@@ -6346,13 +6346,13 @@ void Gambit_fn_02201054(CPUState* cpu) {
         /* 02201080 */ _t7 = cpu->r[1] + 0x00000008u;
         /* 02201080 */ rbrew_write32(cpu->mem, _t7, cpu->r[0]);
         /* 02201084 */ Gambit_fn_021BD3E0(cpu);
-        /* 02201088 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220108C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201088 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220108C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220108C */ _t9 = _t8 & 0x00000001u;
         /* 0220108C */ if (_t9) goto L_022010D0; else goto L_02201090;
   L_02201090: ; // 0x2201090
-        /* 02201090 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02201094 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201090 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02201094 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02201094 */ _t11 = _t10 & 0x00000001u;
         /* 02201094 */ if (_t11) goto L_022010D0; else goto L_02201098;
   L_02201098: ; // 0x2201098
@@ -6360,8 +6360,8 @@ void Gambit_fn_02201054(CPUState* cpu) {
         /* 02201098 */ cpu->r[9] = rbrew_read32(cpu->mem, _t12);
         /* 0220109C */ cpu->r[10] = rbrew_rlwinm(cpu->r[9], 0x0000001Au, 0x00000000u, 0x00000005u);
         /* 022010A0 */ /* nop */
-        /* 022010A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 022010A8 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022010A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 022010A8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022010A8 */ _t14 = _t13 & 0x00000001u;
         /* 022010A8 */ if (_t14) goto L_022010AC; else goto L_022010D0;
   L_022010AC: ; // 0x22010ac
@@ -6417,13 +6417,13 @@ void Gambit_fn_02201058(CPUState* cpu) {
         /* 02201080 */ _t7 = cpu->r[1] + 0x00000008u;
         /* 02201080 */ rbrew_write32(cpu->mem, _t7, cpu->r[0]);
         /* 02201084 */ Gambit_fn_021BD3E0(cpu);
-        /* 02201088 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220108C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201088 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220108C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220108C */ _t9 = _t8 & 0x00000001u;
         /* 0220108C */ if (_t9) goto L_022010D0; else goto L_02201090;
   L_02201090: ; // 0x2201090
-        /* 02201090 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02201094 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201090 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02201094 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02201094 */ _t11 = _t10 & 0x00000001u;
         /* 02201094 */ if (_t11) goto L_022010D0; else goto L_02201098;
   L_02201098: ; // 0x2201098
@@ -6431,8 +6431,8 @@ void Gambit_fn_02201058(CPUState* cpu) {
         /* 02201098 */ cpu->r[9] = rbrew_read32(cpu->mem, _t12);
         /* 0220109C */ cpu->r[10] = rbrew_rlwinm(cpu->r[9], 0x0000001Au, 0x00000000u, 0x00000005u);
         /* 022010A0 */ /* nop */
-        /* 022010A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 022010A8 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022010A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 022010A8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022010A8 */ _t14 = _t13 & 0x00000001u;
         /* 022010A8 */ if (_t14) goto L_022010AC; else goto L_022010D0;
   L_022010AC: ; // 0x22010ac
@@ -6485,8 +6485,8 @@ void Gambit_fn_022010E8(CPUState* cpu) {
         /* 0220110C */ _t5 = cpu->r[31] + 0x00000198u;
         /* 0220110C */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 02201110 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 02201110 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02201114 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201110 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02201114 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02201114 */ _t7 = _t6 & 0x00000001u;
         /* 02201114 */ if (_t7) goto L_02201120; else goto L_02201118;
   L_02201118: ; // 0x2201118
@@ -6528,8 +6528,8 @@ void Gambit_fn_022010EC(CPUState* cpu) {
         /* 0220110C */ _t5 = cpu->r[31] + 0x00000198u;
         /* 0220110C */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 02201110 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 02201110 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02201114 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201110 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02201114 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02201114 */ _t7 = _t6 & 0x00000001u;
         /* 02201114 */ if (_t7) goto L_02201120; else goto L_02201118;
   L_02201118: ; // 0x2201118
@@ -6572,8 +6572,8 @@ void Gambit_fn_02201138(CPUState* cpu) {
         /* 0220115C */ _t5 = cpu->r[31] + 0x00000198u;
         /* 0220115C */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 02201160 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 02201160 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02201164 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201160 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02201164 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02201164 */ _t7 = _t6 & 0x00000001u;
         /* 02201164 */ if (_t7) goto L_02201170; else goto L_02201168;
   L_02201168: ; // 0x2201168
@@ -6615,8 +6615,8 @@ void Gambit_fn_0220113C(CPUState* cpu) {
         /* 0220115C */ _t5 = cpu->r[31] + 0x00000198u;
         /* 0220115C */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 02201160 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 02201160 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02201164 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201160 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02201164 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02201164 */ _t7 = _t6 & 0x00000001u;
         /* 02201164 */ if (_t7) goto L_02201170; else goto L_02201168;
   L_02201168: ; // 0x2201168
@@ -6659,8 +6659,8 @@ void Gambit_fn_02201188(CPUState* cpu) {
         /* 022011AC */ _t5 = cpu->r[31] + 0x00000198u;
         /* 022011AC */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 022011B0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 022011B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022011B4 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022011B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022011B4 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022011B4 */ _t7 = _t6 & 0x00000001u;
         /* 022011B4 */ if (_t7) goto L_022011C0; else goto L_022011B8;
   L_022011B8: ; // 0x22011b8
@@ -6702,8 +6702,8 @@ void Gambit_fn_0220118C(CPUState* cpu) {
         /* 022011AC */ _t5 = cpu->r[31] + 0x00000198u;
         /* 022011AC */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 022011B0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 022011B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022011B4 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022011B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022011B4 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022011B4 */ _t7 = _t6 & 0x00000001u;
         /* 022011B4 */ if (_t7) goto L_022011C0; else goto L_022011B8;
   L_022011B8: ; // 0x22011b8
@@ -6746,8 +6746,8 @@ void Gambit_fn_022011D8(CPUState* cpu) {
         /* 022011FC */ _t5 = cpu->r[31] + 0x00000198u;
         /* 022011FC */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 02201200 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 02201200 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02201204 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201200 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02201204 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02201204 */ _t7 = _t6 & 0x00000001u;
         /* 02201204 */ if (_t7) goto L_02201210; else goto L_02201208;
   L_02201208: ; // 0x2201208
@@ -6789,8 +6789,8 @@ void Gambit_fn_022011DC(CPUState* cpu) {
         /* 022011FC */ _t5 = cpu->r[31] + 0x00000198u;
         /* 022011FC */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 02201200 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 02201200 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02201204 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201200 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02201204 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02201204 */ _t7 = _t6 & 0x00000001u;
         /* 02201204 */ if (_t7) goto L_02201210; else goto L_02201208;
   L_02201208: ; // 0x2201208
@@ -6847,10 +6847,10 @@ void Gambit_fn_02201228(CPUState* cpu) {
         /* 02201268 */ cpu->r[9] = rbrew_read32(cpu->mem, _t11);
         /* 0220126C */ cpu->r[31] = cpu->r[4];
         /* 02201270 */ cpu->r[11] = 0x10040000u;
-        /* 02201274 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[9]);
+        /* 02201274 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[9]));
         /* 02201278 */ _t12 = cpu->r[11] + 0xFFFFE510u;
         /* 02201278 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t12);
-        /* 0220127C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220127C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220127C */ _t14 = _t13 & 0x00000001u;
         /* 0220127C */ if (_t14) goto L_02201360; else goto L_02201280;
   L_02201280: ; // 0x2201280
@@ -6862,8 +6862,8 @@ void Gambit_fn_02201228(CPUState* cpu) {
         /* 02201290 */ cpu->r[3] = cpu->r[30];
         /* 02201294 */ Gambit_fn_02201138(cpu);
         /* 02201298 */ cpu->f[12] = cpu->f[29] - cpu->f[1];
-        /* 0220129C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[31]);
-        /* 022012A0 */ _t16 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220129C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[31]));
+        /* 022012A0 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022012A0 */ _t17 = _t16 & 0x00000001u;
         /* 022012A0 */ if (_t17) goto L_022012A4; else goto L_022012F0;
   L_022012A4: ; // 0x22012a4
@@ -6872,8 +6872,8 @@ void Gambit_fn_02201228(CPUState* cpu) {
         /* 022012AC */ Gambit_fn_02201138(cpu);
         /* 022012B0 */ cpu->f[13] = cpu->f[29] - cpu->f[1];
         /* 022012B4 */ cpu->f[30] = cpu->f[30] / cpu->f[13];
-        /* 022012B8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
-        /* 022012BC */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022012B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
+        /* 022012BC */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022012BC */ _t19 = _t18 & 0x00000001u;
         /* 022012BC */ if (_t19) goto L_022012E0; else goto L_022012C0;
   L_022012C0: ; // 0x22012c0
@@ -6882,8 +6882,8 @@ void Gambit_fn_02201228(CPUState* cpu) {
         /* 022012C8 */ cpu->r[3] = cpu->r[31];
         /* 022012CC */ cpu->f[31] = cpu->f[1];
         /* 022012D0 */ Gambit_fn_021BCFBC(cpu);
-        /* 022012D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022012D8 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022012D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022012D8 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022012D8 */ _t21 = _t20 & 0x00000001u;
         /* 022012D8 */ if (_t21) goto L_02201360; else goto L_022012DC;
   L_022012DC: ; // 0x22012dc
@@ -6892,8 +6892,8 @@ void Gambit_fn_02201228(CPUState* cpu) {
         /* 022012E0 */ cpu->r[10] = 0x10040000u;
         /* 022012E4 */ _t22 = cpu->r[10] + 0xFFFFE51Cu;
         /* 022012E4 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t22);
-        /* 022012E8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[13]);
-        /* 022012EC */ _t23 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022012E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[13]));
+        /* 022012EC */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022012EC */ _t24 = _t23 & 0x00000001u;
         /* 022012EC */ if (_t24) goto L_02201310; else goto L_022012F0;
   L_022012F0: ; // 0x22012f0
@@ -6902,8 +6902,8 @@ void Gambit_fn_02201228(CPUState* cpu) {
         /* 022012F8 */ cpu->r[3] = cpu->r[31];
         /* 022012FC */ cpu->f[31] = cpu->f[1];
         /* 02201300 */ Gambit_fn_021BCFBC(cpu);
-        /* 02201304 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02201308 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201304 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02201308 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02201308 */ _t26 = _t25 & 0x00000001u;
         /* 02201308 */ if (_t26) goto L_02201360; else goto L_0220130C;
   L_0220130C: ; // 0x220130c
@@ -6924,8 +6924,8 @@ void Gambit_fn_02201228(CPUState* cpu) {
         /* 02201340 */ cpu->r[3] = cpu->r[31];
         /* 02201344 */ cpu->f[31] = fma(cpu->f[0], cpu->f[30], cpu->f[31]);
         /* 02201348 */ Gambit_fn_021BCFBC(cpu);
-        /* 0220134C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02201350 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220134C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02201350 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02201350 */ _t28 = _t27 & 0x00000001u;
         /* 02201350 */ if (_t28) goto L_02201360; else goto L_02201354;
   L_02201354: ; // 0x2201354
@@ -6951,7 +6951,7 @@ void Gambit_fn_02201228(CPUState* cpu) {
         /* 0220137C */ cpu->f[29] = rbrew_read_f64(cpu->mem, _t36);
         /* 02201380 */ _t37 = cpu->r[1] + 0x0000000Cu;
         /* 02201380 */ cpu->r[31] = rbrew_read32(cpu->mem, _t37);
-        /* 02201384 */ _t38 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02201384 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02201384 */ _t39 = _t38 & 0x00000001u;
         /* 02201384 */ if (_t39) goto L_02201388; // else: addr-0 trap, fall-through
   L_02201388: ; // 0x2201388
@@ -7006,10 +7006,10 @@ void Gambit_fn_02201398(CPUState* cpu) {
         /* 022013F4 */ _t11 = cpu->r[10] + 0xFFFFE510u;
         /* 022013F4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t11);
         /* 022013F8 */ cpu->r[12] = 0x10040000u;
-        /* 022013FC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
+        /* 022013FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
         /* 02201400 */ _t12 = cpu->r[12] + 0xFFFFE514u;
         /* 02201400 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t12);
-        /* 02201404 */ _t13 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02201404 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02201404 */ _t14 = _t13 & 0x00000001u;
         /* 02201404 */ if (_t14) goto L_02201408; else goto L_02201424;
   L_02201408: ; // 0x2201408
@@ -7080,10 +7080,10 @@ void Gambit_fn_0220139C(CPUState* cpu) {
         /* 022013F4 */ _t11 = cpu->r[10] + 0xFFFFE510u;
         /* 022013F4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t11);
         /* 022013F8 */ cpu->r[12] = 0x10040000u;
-        /* 022013FC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
+        /* 022013FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
         /* 02201400 */ _t12 = cpu->r[12] + 0xFFFFE514u;
         /* 02201400 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t12);
-        /* 02201404 */ _t13 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02201404 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02201404 */ _t14 = _t13 & 0x00000001u;
         /* 02201404 */ if (_t14) goto L_02201408; else goto L_02201424;
   L_02201408: ; // 0x2201408
@@ -7167,17 +7167,17 @@ void Gambit_fn_02201444(CPUState* cpu) {
         /* 022014B4 */ _t18 = cpu->r[1] + 0x00000008u;
         /* 022014B4 */ rbrew_write_f32(cpu->mem, _t18, cpu->f[12]);
         /* 022014B8 */ cpu->r[12] = 0x10040000u;
-        /* 022014BC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[28]);
+        /* 022014BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[28]));
         /* 022014C0 */ _t19 = cpu->r[12] + 0xFFFFE524u;
         /* 022014C0 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t19);
         /* 022014C4 */ cpu->r[31] = cpu->r[4];
-        /* 022014C8 */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022014C8 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022014C8 */ _t21 = _t20 & 0x00000001u;
         /* 022014C8 */ if (_t21) goto L_022014DC; else goto L_022014CC;
   L_022014CC: ; // 0x22014cc
         /* 022014CC */ cpu->f[10] = cpu->f[28] * cpu->f[13];
-        /* 022014D0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[28]);
-        /* 022014D4 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022014D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[28]));
+        /* 022014D4 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022014D4 */ _t23 = _t22 & 0x00000001u;
         /* 022014D4 */ if (_t23) goto L_022014D8; else goto L_022014FC;
   L_022014D8: ; // 0x22014d8
@@ -7191,8 +7191,8 @@ void Gambit_fn_02201444(CPUState* cpu) {
         /* 022014E8 */ cpu->f[10] = -fma(cpu->f[10], cpu->f[13], -(cpu->f[29]));
         /* 022014EC */ cpu->f[0] = cpu->f[10] * cpu->f[12];
         /* 022014F0 */ cpu->f[10] = cpu->f[0] * cpu->f[13];
-        /* 022014F4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[28]);
-        /* 022014F8 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022014F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[28]));
+        /* 022014F8 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022014F8 */ _t27 = _t26 & 0x00000001u;
         /* 022014F8 */ if (_t27) goto L_02201684; else goto L_022014FC;
   L_022014FC: ; // 0x22014fc
@@ -7205,10 +7205,10 @@ void Gambit_fn_02201444(CPUState* cpu) {
         /* 0220150C */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t29);
         /* 02201510 */ cpu->f[8] = cpu->f[12] / cpu->f[9];
         /* 02201514 */ cpu->r[12] = 0x10040000u;
-        /* 02201518 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[28]);
+        /* 02201518 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[28]));
         /* 0220151C */ _t30 = cpu->r[12] + 0xFFFFE51Cu;
         /* 0220151C */ cpu->f[27] = rbrew_read_f32(cpu->mem, _t30);
-        /* 02201520 */ _t31 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02201520 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02201520 */ _t32 = _t31 & 0x00000001u;
         /* 02201520 */ if (_t32) goto L_02201564; else goto L_02201524;
   L_02201524: ; // 0x2201524
@@ -7229,15 +7229,15 @@ void Gambit_fn_02201444(CPUState* cpu) {
         /* 02201550 */ _t36 = cpu->r[12] + 0xFFFFE59Cu;
         /* 02201550 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t36);
         /* 02201554 */ cpu->f[9] = cpu->f[9] / cpu->f[10];
-        /* 02201558 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[28]);
-        /* 0220155C */ _t37 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02201558 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[28]));
+        /* 0220155C */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220155C */ _t38 = _t37 & 0x00000001u;
         /* 0220155C */ if (_t38) goto L_02201560; else goto L_022015F4;
   L_02201560: ; // 0x2201560
         /* 02201560 */ goto L_0220160C;
   L_02201564: ; // 0x2201564
-        /* 02201564 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[27]);
-        /* 02201568 */ _t39 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02201564 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[27]));
+        /* 02201568 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02201568 */ _t40 = _t39 & 0x00000001u;
         /* 02201568 */ if (_t40) goto L_022015B0; else goto L_0220156C;
   L_0220156C: ; // 0x220156c
@@ -7260,8 +7260,8 @@ void Gambit_fn_02201444(CPUState* cpu) {
         /* 0220159C */ _t45 = cpu->r[12] + 0xFFFFE59Cu;
         /* 0220159C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t45);
         /* 022015A0 */ cpu->f[9] = cpu->f[9] / cpu->f[10];
-        /* 022015A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[28]);
-        /* 022015A8 */ _t46 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022015A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[28]));
+        /* 022015A8 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022015A8 */ _t47 = _t46 & 0x00000001u;
         /* 022015A8 */ if (_t47) goto L_022015AC; else goto L_022015F4;
   L_022015AC: ; // 0x22015ac
@@ -7287,25 +7287,25 @@ void Gambit_fn_02201444(CPUState* cpu) {
         /* 022015E4 */ _t52 = cpu->r[12] + 0xFFFFE59Cu;
         /* 022015E4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t52);
         /* 022015E8 */ cpu->f[9] = cpu->f[9] / cpu->f[10];
-        /* 022015EC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[28]);
-        /* 022015F0 */ _t53 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022015EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[28]));
+        /* 022015F0 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022015F0 */ _t54 = _t53 & 0x00000001u;
         /* 022015F0 */ if (_t54) goto L_0220160C; else goto L_022015F4;
   L_022015F4: ; // 0x22015f4
         /* 022015F4 */ cpu->f[0] = cpu->f[29];
         /* 022015F8 */ _t55 = cpu->r[1] + 0x00000008u;
         /* 022015F8 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t55);
-        /* 022015FC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[0]);
+        /* 022015FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[0]));
         /* 02201600 */ _t56 = cpu->r[1] + 0x0000000Cu;
         /* 02201600 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t56);
-        /* 02201604 */ _t57 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02201604 */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02201604 */ _t58 = _t57 & 0x00000001u;
         /* 02201604 */ if (_t58) goto L_0220164C; else goto L_02201608;
   L_02201608: ; // 0x2201608
         /* 02201608 */ goto L_02201650;
   L_0220160C: ; // 0x220160c
-        /* 0220160C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[27]);
-        /* 02201610 */ _t59 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220160C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[27]));
+        /* 02201610 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02201610 */ _t60 = _t59 & 0x00000001u;
         /* 02201610 */ if (_t60) goto L_02201630; else goto L_02201614;
   L_02201614: ; // 0x2201614
@@ -7314,10 +7314,10 @@ void Gambit_fn_02201444(CPUState* cpu) {
         /* 02201618 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t61);
         /* 0220161C */ _t62 = cpu->r[1] + 0x00000008u;
         /* 0220161C */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t62);
-        /* 02201620 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[0]);
+        /* 02201620 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[0]));
         /* 02201624 */ _t63 = cpu->r[1] + 0x0000000Cu;
         /* 02201624 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t63);
-        /* 02201628 */ _t64 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02201628 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02201628 */ _t65 = _t64 & 0x00000001u;
         /* 02201628 */ if (_t65) goto L_0220164C; else goto L_0220162C;
   L_0220162C: ; // 0x220162c
@@ -7329,10 +7329,10 @@ void Gambit_fn_02201444(CPUState* cpu) {
         /* 02201638 */ cpu->f[0] = fma(cpu->f[8], cpu->f[9], cpu->f[29]);
         /* 0220163C */ _t67 = cpu->r[1] + 0x00000008u;
         /* 0220163C */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t67);
-        /* 02201640 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[0]);
+        /* 02201640 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[0]));
         /* 02201644 */ _t68 = cpu->r[1] + 0x0000000Cu;
         /* 02201644 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t68);
-        /* 02201648 */ _t69 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02201648 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02201648 */ _t70 = _t69 & 0x00000001u;
         /* 02201648 */ if (_t70) goto L_0220164C; else goto L_02201650;
   L_0220164C: ; // 0x220164c
@@ -7340,8 +7340,8 @@ void Gambit_fn_02201444(CPUState* cpu) {
   L_02201650: ; // 0x2201650
         /* 02201650 */ cpu->f[10] = cpu->f[8] * cpu->f[8];
         /* 02201654 */ cpu->f[8] = fma(cpu->f[9], cpu->f[9], cpu->f[10]);
-        /* 02201658 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[28]);
-        /* 0220165C */ _t71 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02201658 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[28]));
+        /* 0220165C */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220165C */ _t72 = _t71 & 0x00000001u;
         /* 0220165C */ if (_t72) goto L_02201660; else goto L_02201684;
   L_02201660: ; // 0x2201660
@@ -7387,7 +7387,7 @@ void Gambit_fn_02201444(CPUState* cpu) {
         /* 022016B8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t88);
         /* 022016BC */ _t89 = cpu->r[1] + 0x00000058u;
         /* 022016BC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t89);
-        /* 022016C0 */ _t90 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022016C0 */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022016C0 */ _t91 = _t90 & 0x00000001u;
         /* 022016C0 */ if (_t91) goto L_022016C4; // else: addr-0 trap, fall-through
   L_022016C4: ; // 0x22016c4
@@ -7433,10 +7433,10 @@ void Gambit_fn_022016D4(CPUState* cpu) {
         /* 02201714 */ _t10 = cpu->r[12] & 0xFFFFCFFFu;
         /* 02201714 */ cpu->r[12] = _t10 | _t9;
         /* 02201718 */ cpu->r[0] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 02201718 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02201718 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0220171C */ _t11 = cpu->r[31] + 0x00000198u;
         /* 0220171C */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
-        /* 02201720 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201720 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02201720 */ _t13 = _t12 & 0x00000001u;
         /* 02201720 */ if (_t13) goto L_0220177C; else goto L_02201724;
   L_02201724: ; // 0x2201724
@@ -7523,10 +7523,10 @@ void Gambit_fn_022016D8(CPUState* cpu) {
         /* 02201714 */ _t10 = cpu->r[12] & 0xFFFFCFFFu;
         /* 02201714 */ cpu->r[12] = _t10 | _t9;
         /* 02201718 */ cpu->r[0] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 02201718 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02201718 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0220171C */ _t11 = cpu->r[31] + 0x00000198u;
         /* 0220171C */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
-        /* 02201720 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201720 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02201720 */ _t13 = _t12 & 0x00000001u;
         /* 02201720 */ if (_t13) goto L_0220177C; else goto L_02201724;
   L_02201724: ; // 0x2201724
@@ -7689,8 +7689,8 @@ void Gambit_fn_022017F0(CPUState* cpu) {
         /* 02201814 */ _t5 = cpu->r[31] + 0x00000198u;
         /* 02201814 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 02201818 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 02201818 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0220181C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201818 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0220181C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220181C */ _t7 = _t6 & 0x00000001u;
         /* 0220181C */ if (_t7) goto L_02201828; else goto L_02201820;
   L_02201820: ; // 0x2201820
@@ -7732,8 +7732,8 @@ void Gambit_fn_022017F4(CPUState* cpu) {
         /* 02201814 */ _t5 = cpu->r[31] + 0x00000198u;
         /* 02201814 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 02201818 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 02201818 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0220181C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201818 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0220181C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220181C */ _t7 = _t6 & 0x00000001u;
         /* 0220181C */ if (_t7) goto L_02201828; else goto L_02201820;
   L_02201820: ; // 0x2201820
@@ -7776,8 +7776,8 @@ void Gambit_fn_02201840(CPUState* cpu) {
         /* 02201864 */ _t5 = cpu->r[31] + 0x00000198u;
         /* 02201864 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 02201868 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 02201868 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0220186C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201868 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0220186C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220186C */ _t7 = _t6 & 0x00000001u;
         /* 0220186C */ if (_t7) goto L_02201878; else goto L_02201870;
   L_02201870: ; // 0x2201870
@@ -7819,8 +7819,8 @@ void Gambit_fn_02201844(CPUState* cpu) {
         /* 02201864 */ _t5 = cpu->r[31] + 0x00000198u;
         /* 02201864 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 02201868 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 02201868 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0220186C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201868 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0220186C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220186C */ _t7 = _t6 & 0x00000001u;
         /* 0220186C */ if (_t7) goto L_02201878; else goto L_02201870;
   L_02201870: ; // 0x2201870
@@ -7863,8 +7863,8 @@ void Gambit_fn_02201890(CPUState* cpu) {
         /* 022018B4 */ _t5 = cpu->r[31] + 0x00000198u;
         /* 022018B4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 022018B8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 022018B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022018BC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022018B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022018BC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022018BC */ _t7 = _t6 & 0x00000001u;
         /* 022018BC */ if (_t7) goto L_022018C8; else goto L_022018C0;
   L_022018C0: ; // 0x22018c0
@@ -7906,8 +7906,8 @@ void Gambit_fn_02201894(CPUState* cpu) {
         /* 022018B4 */ _t5 = cpu->r[31] + 0x00000198u;
         /* 022018B4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 022018B8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 022018B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022018BC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022018B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022018BC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022018BC */ _t7 = _t6 & 0x00000001u;
         /* 022018BC */ if (_t7) goto L_022018C8; else goto L_022018C0;
   L_022018C0: ; // 0x22018c0
@@ -7955,8 +7955,8 @@ void Gambit_fn_022018E8(CPUState* cpu) {
         /* 022018FC */ _t3 = cpu->r[31] + 0x00000198u;
         /* 022018FC */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 02201900 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000017u, 0x00000017u);
-        /* 02201900 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02201904 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201900 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02201904 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02201904 */ _t5 = _t4 & 0x00000001u;
         /* 02201904 */ if (_t5) goto L_02201A44; else goto L_02201908;
   L_02201908: ; // 0x2201908
@@ -7999,8 +7999,8 @@ void Gambit_fn_022018E8(CPUState* cpu) {
         /* 02201960 */ cpu->f[8] = fma(cpu->f[11], cpu->f[11], cpu->f[0]);
         /* 02201964 */ _t20 = cpu->r[11] + 0xFFFFE510u;
         /* 02201964 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t20);
-        /* 02201968 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[13]);
-        /* 0220196C */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02201968 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[13]));
+        /* 0220196C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220196C */ _t22 = _t21 & 0x00000001u;
         /* 0220196C */ if (_t22) goto L_02201970; else goto L_022019AC;
   L_02201970: ; // 0x2201970
@@ -8031,8 +8031,8 @@ void Gambit_fn_022018E8(CPUState* cpu) {
         /* 022019B4 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 022019B8 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 022019BC */ Gambit_fn_021C6DD8(cpu);
-        /* 022019C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022019C4 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022019C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022019C4 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022019C4 */ _t30 = _t29 & 0x00000001u;
         /* 022019C4 */ if (_t30) goto L_022019C8; else goto L_022019DC;
   L_022019C8: ; // 0x22019c8
@@ -8109,8 +8109,8 @@ void Gambit_fn_022018EC(CPUState* cpu) {
         /* 022018FC */ _t3 = cpu->r[31] + 0x00000198u;
         /* 022018FC */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 02201900 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000017u, 0x00000017u);
-        /* 02201900 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02201904 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201900 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02201904 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02201904 */ _t5 = _t4 & 0x00000001u;
         /* 02201904 */ if (_t5) goto L_02201A44; else goto L_02201908;
   L_02201908: ; // 0x2201908
@@ -8153,8 +8153,8 @@ void Gambit_fn_022018EC(CPUState* cpu) {
         /* 02201960 */ cpu->f[8] = fma(cpu->f[11], cpu->f[11], cpu->f[0]);
         /* 02201964 */ _t20 = cpu->r[11] + 0xFFFFE510u;
         /* 02201964 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t20);
-        /* 02201968 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[13]);
-        /* 0220196C */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02201968 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[13]));
+        /* 0220196C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220196C */ _t22 = _t21 & 0x00000001u;
         /* 0220196C */ if (_t22) goto L_02201970; else goto L_022019AC;
   L_02201970: ; // 0x2201970
@@ -8185,8 +8185,8 @@ void Gambit_fn_022018EC(CPUState* cpu) {
         /* 022019B4 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 022019B8 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 022019BC */ Gambit_fn_021C6DD8(cpu);
-        /* 022019C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022019C4 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022019C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022019C4 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022019C4 */ _t30 = _t29 & 0x00000001u;
         /* 022019C4 */ if (_t30) goto L_022019C8; else goto L_022019DC;
   L_022019C8: ; // 0x22019c8
@@ -8287,26 +8287,26 @@ void Gambit_fn_02201A58(CPUState* cpu) {
         /* 02201AB0 */ cpu->r[12] = 0x10040000u;
         /* 02201AB4 */ _t10 = cpu->r[12] + 0xFFFFE510u;
         /* 02201AB4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t10);
-        /* 02201AB8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[1]);
+        /* 02201AB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[1]));
         /* 02201ABC */ _t11 = cpu->r[31] + 0x00000128u;
         /* 02201ABC */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t11);
-        /* 02201AC0 */ _t12 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02201AC0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02201AC0 */ _t13 = _t12 & 0x00000001u;
         /* 02201AC0 */ if (_t13) goto L_02201AF8; else goto L_02201AC4;
   L_02201AC4: ; // 0x2201ac4
-        /* 02201AC4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[29]);
-        /* 02201AC8 */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02201AC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[29]));
+        /* 02201AC8 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02201AC8 */ _t15 = _t14 & 0x00000001u;
         /* 02201AC8 */ if (_t15) goto L_02201ACC; else goto L_02201B34;
   L_02201ACC: ; // 0x2201acc
-        /* 02201ACC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[1]);
-        /* 02201AD0 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02201ACC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[1]));
+        /* 02201AD0 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02201AD0 */ _t17 = _t16 & 0x00000001u;
         /* 02201AD0 */ if (_t17) goto L_02201AD4; else goto L_02201B00;
   L_02201AD4: ; // 0x2201ad4
         /* 02201AD4 */ cpu->f[13] = cpu->f[1] - cpu->f[29];
-        /* 02201AD8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 02201ADC */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201AD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 02201ADC */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02201ADC */ _t19 = _t18 & 0x00000001u;
         /* 02201ADC */ if (_t19) goto L_02201B34; else goto L_02201AE0;
   L_02201AE0: ; // 0x2201ae0
@@ -8317,22 +8317,22 @@ void Gambit_fn_02201A58(CPUState* cpu) {
         /* 02201AF0 */ cpu->f[31] = cpu->f[12] + cpu->f[31];
         /* 02201AF4 */ goto L_02201B34;
   L_02201AF8: ; // 0x2201af8
-        /* 02201AF8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[1]);
-        /* 02201AFC */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02201AF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[1]));
+        /* 02201AFC */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02201AFC */ _t21 = _t20 & 0x00000001u;
         /* 02201AFC */ if (_t21) goto L_02201B08; else goto L_02201B00;
   L_02201B00: ; // 0x2201b00
         /* 02201B00 */ cpu->f[31] = cpu->f[30];
         /* 02201B04 */ goto L_02201B34;
   L_02201B08: ; // 0x2201b08
-        /* 02201B08 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[29]);
-        /* 02201B0C */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02201B08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[29]));
+        /* 02201B0C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02201B0C */ _t23 = _t22 & 0x00000001u;
         /* 02201B0C */ if (_t23) goto L_02201B10; else goto L_02201B34;
   L_02201B10: ; // 0x2201b10
         /* 02201B10 */ cpu->f[8] = cpu->f[29] - cpu->f[1];
-        /* 02201B14 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
-        /* 02201B18 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201B14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
+        /* 02201B18 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02201B18 */ _t25 = _t24 & 0x00000001u;
         /* 02201B18 */ if (_t25) goto L_02201B30; else goto L_02201B1C;
   L_02201B1C: ; // 0x2201b1c
@@ -8359,7 +8359,7 @@ void Gambit_fn_02201A58(CPUState* cpu) {
         /* 02201B4C */ cpu->r[31] = rbrew_read32(cpu->mem, _t31);
         /* 02201B50 */ _t32 = cpu->r[1] + 0x00000010u;
         /* 02201B50 */ cpu->f[29] = rbrew_read_f64(cpu->mem, _t32);
-        /* 02201B54 */ _t33 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02201B54 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02201B54 */ _t34 = _t33 & 0x00000001u;
         /* 02201B54 */ if (_t34) goto L_02201B58; // else: addr-0 trap, fall-through
   L_02201B58: ; // 0x2201b58
@@ -8393,8 +8393,8 @@ void Gambit_fn_02201B68(CPUState* cpu) {
         /* 02201B8C */ _t5 = cpu->r[31] + 0x00000198u;
         /* 02201B8C */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 02201B90 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 02201B90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02201B94 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201B90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02201B94 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02201B94 */ _t7 = _t6 & 0x00000001u;
         /* 02201B94 */ if (_t7) goto L_02201BA0; else goto L_02201B98;
   L_02201B98: ; // 0x2201b98
@@ -8436,8 +8436,8 @@ void Gambit_fn_02201B6C(CPUState* cpu) {
         /* 02201B8C */ _t5 = cpu->r[31] + 0x00000198u;
         /* 02201B8C */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 02201B90 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000016u, 0x00000016u);
-        /* 02201B90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02201B94 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201B90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02201B94 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02201B94 */ _t7 = _t6 & 0x00000001u;
         /* 02201B94 */ if (_t7) goto L_02201BA0; else goto L_02201B98;
   L_02201B98: ; // 0x2201b98
@@ -8465,8 +8465,8 @@ void Gambit_fn_02201BB8(CPUState* cpu) {
         /* 02201BB8 */ _t0 = cpu->r[3] + 0x00000198u;
         /* 02201BB8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02201BBC */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000018u, 0x00000019u);
-        /* 02201BBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02201BC0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201BBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02201BC0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02201BC0 */ _t2 = _t1 & 0x00000001u;
         /* 02201BC0 */ if (_t2) goto L_02201BC4; else goto L_02201BD4;
   L_02201BC4: ; // 0x2201bc4
@@ -8484,8 +8484,8 @@ void Gambit_fn_02201BB8(CPUState* cpu) {
         /* 02201BD8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t7);
         /* 02201BDC */ _t8 = cpu->r[12] + 0xFFFFE510u;
         /* 02201BDC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t8);
-        /* 02201BE0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 02201BE4 */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02201BE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 02201BE4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02201BE4 */ _t10 = _t9 & 0x00000001u;
         /* 02201BE4 */ _t11 = _t10 ^ 0x00000001u;
         /* 02201BE4 */ if (_t11) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -8530,9 +8530,9 @@ void Gambit_fn_02201BF0(CPUState* cpu) {
         /* 026C0700 */ cpu->r[29] = 0xFFFFFFFFu;
         /* 026C0704 */ cpu->r[28] = 0x100F0000u;
         /* 026C0708 */ cpu->r[30] = cpu->r[3];
-        /* 026C070C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 026C070C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 026C0710 */ cpu->r[28] = cpu->r[28] + 0xFFFF8958u;
-        /* 026C0714 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C0714 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C0714 */ _t10 = _t9 & 0x00000001u;
         /* 026C0714 */ if (_t10) goto L_026C0718; else goto L_026C072C;
   L_026C0718: ; // 0x26c0718
@@ -8544,8 +8544,8 @@ void Gambit_fn_02201BF0(CPUState* cpu) {
         /* 026C0728 */ _t12 = cpu->r[12] + 0xFFFFFE8Cu;
         /* 026C0728 */ rbrew_write32(cpu->mem, _t12, cpu->r[28]);
   L_026C072C: ; // 0x26c072c
-        /* 026C072C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026C0730 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C072C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026C0730 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C0730 */ _t14 = _t13 & 0x00000001u;
         /* 026C0730 */ if (_t14) goto L_026C076C; else goto L_026C0734;
   L_026C0734: ; // 0x26c0734
@@ -8558,8 +8558,8 @@ void Gambit_fn_02201BF0(CPUState* cpu) {
         /* 026C0744 */ cpu->r[4] = cpu->r[4] + 0xFFFFFE8Cu;
         /* 026C0748 */ cpu->r[3] = cpu->r[31];
         /* 026C074C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026C0750 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026C0754 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C0750 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026C0754 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C0754 */ _t18 = _t17 & 0x00000001u;
         /* 026C0754 */ if (_t18) goto L_026C076C; else goto L_026C0758;
   L_026C0758: ; // 0x26c0758
@@ -8576,9 +8576,9 @@ void Gambit_fn_02201BF0(CPUState* cpu) {
         /* 026C0770 */ _t22 = cpu->r[12] + 0xFFFFFDA0u;
         /* 026C0770 */ cpu->r[12] = rbrew_read32(cpu->mem, _t22);
         /* 026C0774 */ cpu->r[4] = 0x101D0000u;
-        /* 026C0778 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 026C0778 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 026C077C */ cpu->r[4] = cpu->r[4] + 0xFFFFFE90u;
-        /* 026C0780 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C0780 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C0780 */ _t24 = _t23 & 0x00000001u;
         /* 026C0780 */ if (_t24) goto L_026C0784; else goto L_026C0794;
   L_026C0784: ; // 0x26c0784
@@ -8589,8 +8589,8 @@ void Gambit_fn_02201BF0(CPUState* cpu) {
         /* 026C0790 */ _t26 = cpu->r[12] + 0xFFFFFDA0u;
         /* 026C0790 */ rbrew_write32(cpu->mem, _t26, cpu->r[0]);
   L_026C0794: ; // 0x26c0794
-        /* 026C0794 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026C0798 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C0794 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026C0798 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C0798 */ _t28 = _t27 & 0x00000001u;
         /* 026C0798 */ if (_t28) goto L_026C07CC; else goto L_026C079C;
   L_026C079C: ; // 0x26c079c
@@ -8601,8 +8601,8 @@ void Gambit_fn_02201BF0(CPUState* cpu) {
         /* 026C07A4 */ cpu->ctr = cpu->r[0];
         /* 026C07A8 */ cpu->r[3] = cpu->r[31];
         /* 026C07AC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026C07B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026C07B4 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C07B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026C07B4 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C07B4 */ _t32 = _t31 & 0x00000001u;
         /* 026C07B4 */ if (_t32) goto L_026C07CC; else goto L_026C07B8;
   L_026C07B8: ; // 0x26c07b8
@@ -8620,9 +8620,9 @@ void Gambit_fn_02201BF0(CPUState* cpu) {
         /* 026C07D0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t36);
         /* 026C07D0 */ cpu->r[8] = _t36;
         /* 026C07D4 */ cpu->r[4] = 0x101D0000u;
-        /* 026C07D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 026C07D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 026C07DC */ cpu->r[4] = cpu->r[4] + 0xFFFFFE94u;
-        /* 026C07E0 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C07E0 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C07E0 */ _t38 = _t37 & 0x00000001u;
         /* 026C07E0 */ if (_t38) goto L_026C07E4; else goto L_026C07F0;
   L_026C07E4: ; // 0x26c07e4
@@ -8632,8 +8632,8 @@ void Gambit_fn_02201BF0(CPUState* cpu) {
         /* 026C07EC */ _t40 = cpu->r[8] + 0x00000000u;
         /* 026C07EC */ rbrew_write32(cpu->mem, _t40, cpu->r[0]);
   L_026C07F0: ; // 0x26c07f0
-        /* 026C07F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026C07F4 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C07F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026C07F4 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C07F4 */ _t42 = _t41 & 0x00000001u;
         /* 026C07F4 */ if (_t42) goto L_026C0824; else goto L_026C07F8;
   L_026C07F8: ; // 0x26c07f8
@@ -8644,8 +8644,8 @@ void Gambit_fn_02201BF0(CPUState* cpu) {
         /* 026C0800 */ cpu->ctr = cpu->r[7];
         /* 026C0804 */ cpu->r[3] = cpu->r[31];
         /* 026C0808 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026C080C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026C0810 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C080C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026C0810 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C0810 */ _t46 = _t45 & 0x00000001u;
         /* 026C0810 */ if (_t46) goto L_026C0824; else goto L_026C0814;
   L_026C0814: ; // 0x26c0814
@@ -8691,8 +8691,8 @@ void Gambit_fn_02201C20(CPUState* cpu) {
         /* 02201C30 */ Gambit_fn_02201B68(cpu);
         /* 02201C34 */ _t3 = cpu->r[31] + 0x0000013Cu;
         /* 02201C34 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 02201C38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[3]);
-        /* 02201C3C */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02201C38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[3]));
+        /* 02201C3C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02201C3C */ _t5 = _t4 & 0x00000001u;
         /* 02201C3C */ if (_t5) goto L_02201C4C; else goto L_02201C40;
   L_02201C40: ; // 0x2201c40
@@ -8741,24 +8741,24 @@ void Gambit_fn_02201C84(CPUState* cpu) {
         /* 02201CB8 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t8);
         /* 02201CBC */ _t9 = cpu->r[3] + 0x00000000u;
         /* 02201CBC */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t9);
-        /* 02201CC0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[8]);
+        /* 02201CC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[8]));
         /* 02201CC4 */ cpu->f[4] = fma(cpu->f[12], cpu->f[12], cpu->f[0]);
-        /* 02201CC8 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02201CC8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02201CC8 */ _t11 = _t10 & 0x00000001u;
         /* 02201CC8 */ if (_t11) goto L_02201CCC; else goto L_02201F90;
   L_02201CCC: ; // 0x2201ccc
         /* 02201CCC */ cpu->r[10] = 0x10040000u;
         /* 02201CD0 */ _t12 = cpu->r[10] + 0xFFFFE5ACu;
         /* 02201CD0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t12);
-        /* 02201CD4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[4], cpu->f[13]);
-        /* 02201CD8 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02201CD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[4], cpu->f[13]));
+        /* 02201CD8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02201CD8 */ _t14 = _t13 & 0x00000001u;
         /* 02201CD8 */ if (_t14) goto L_02201CE8; else goto L_02201CDC;
   L_02201CDC: ; // 0x2201cdc
         /* 02201CDC */ _t15 = cpu->r[30] + 0x0000013Cu;
         /* 02201CDC */ cpu->r[9] = rbrew_read32(cpu->mem, _t15);
-        /* 02201CE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02201CE4 */ _t16 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02201CE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02201CE4 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02201CE4 */ _t17 = _t16 & 0x00000001u;
         /* 02201CE4 */ if (_t17) goto L_02201CE8; else goto L_02201F90;
   L_02201CE8: ; // 0x2201ce8
@@ -8766,21 +8766,21 @@ void Gambit_fn_02201C84(CPUState* cpu) {
         /* 02201CE8 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t18);
         /* 02201CEC */ cpu->r[9] = 0x10040000u;
         /* 02201CF0 */ cpu->r[8] = 0x10040000u;
-        /* 02201CF4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[8]);
+        /* 02201CF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[8]));
         /* 02201CF8 */ _t19 = cpu->r[9] + 0xFFFFE510u;
         /* 02201CF8 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t19);
         /* 02201CFC */ _t20 = cpu->r[8] + 0xFFFFE51Cu;
         /* 02201CFC */ cpu->f[5] = rbrew_read_f32(cpu->mem, _t20);
         /* 02201D00 */ cpu->f[6] = cpu->f[12];
-        /* 02201D04 */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02201D04 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02201D04 */ _t22 = _t21 & 0x00000001u;
         /* 02201D04 */ if (_t22) goto L_02201D20; else goto L_02201D08;
   L_02201D08: ; // 0x2201d08
         /* 02201D08 */ cpu->f[10] = cpu->f[8] - cpu->f[9];
         /* 02201D0C */ cpu->f[7] = cpu->f[11] - cpu->f[9];
         /* 02201D10 */ cpu->f[6] = cpu->f[10] / cpu->f[7];
-        /* 02201D14 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[5]);
-        /* 02201D18 */ _t23 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02201D14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[5]));
+        /* 02201D18 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02201D18 */ _t24 = _t23 & 0x00000001u;
         /* 02201D18 */ if (_t24) goto L_02201D1C; else goto L_02201D20;
   L_02201D1C: ; // 0x2201d1c
@@ -8792,8 +8792,8 @@ void Gambit_fn_02201C84(CPUState* cpu) {
         /* 02201D24 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t26);
         /* 02201D28 */ cpu->f[11] = cpu->f[10] * cpu->f[10];
         /* 02201D2C */ cpu->f[11] = fma(cpu->f[13], cpu->f[13], cpu->f[11]);
-        /* 02201D30 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[12]);
-        /* 02201D34 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02201D30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[12]));
+        /* 02201D34 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02201D34 */ _t28 = _t27 & 0x00000001u;
         /* 02201D34 */ if (_t28) goto L_02201D54; else goto L_02201D38;
   L_02201D38: ; // 0x2201d38
@@ -8801,9 +8801,9 @@ void Gambit_fn_02201C84(CPUState* cpu) {
         /* 02201D3C */ cpu->f[3] = cpu->f[12] * cpu->f[11];
         /* 02201D40 */ _t29 = cpu->r[10] + 0xFFFFE5B0u;
         /* 02201D40 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t29);
-        /* 02201D44 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[3], cpu->f[9]);
+        /* 02201D44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[3], cpu->f[9]));
         /* 02201D48 */ cpu->f[9] = cpu->f[12];
-        /* 02201D4C */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02201D4C */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02201D4C */ _t31 = _t30 & 0x00000001u;
         /* 02201D4C */ if (_t31) goto L_02201E00; else goto L_02201D50;
   L_02201D50: ; // 0x2201d50
@@ -8826,21 +8826,21 @@ void Gambit_fn_02201C84(CPUState* cpu) {
         /* 02201D7C */ cpu->f[3] = cpu->f[0] * cpu->f[11];
         /* 02201D80 */ _t36 = cpu->r[10] + 0xFFFFE5B0u;
         /* 02201D80 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t36);
-        /* 02201D84 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[3], cpu->f[9]);
+        /* 02201D84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[3], cpu->f[9]));
         /* 02201D88 */ cpu->f[9] = cpu->f[12];
-        /* 02201D8C */ _t37 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02201D8C */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02201D8C */ _t38 = _t37 & 0x00000001u;
         /* 02201D8C */ if (_t38) goto L_02201E00; else goto L_02201D90;
   L_02201D90: ; // 0x2201d90
-        /* 02201D90 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[4], cpu->f[12]);
-        /* 02201D94 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02201D90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[4], cpu->f[12]));
+        /* 02201D94 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02201D94 */ _t40 = _t39 & 0x00000001u;
         /* 02201D94 */ if (_t40) goto L_02201DAC; else goto L_02201D98;
   L_02201D98: ; // 0x2201d98
         /* 02201D98 */ cpu->f[8] = -fma(cpu->f[3], cpu->f[3], -(cpu->f[4]));
-        /* 02201D9C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[12]);
+        /* 02201D9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[12]));
         /* 02201DA0 */ cpu->f[11] = cpu->f[12] * cpu->f[4];
-        /* 02201DA4 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201DA4 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02201DA4 */ _t42 = _t41 & 0x00000001u;
         /* 02201DA4 */ if (_t42) goto L_02201E00; else goto L_02201DA8;
   L_02201DA8: ; // 0x2201da8
@@ -8860,9 +8860,9 @@ void Gambit_fn_02201C84(CPUState* cpu) {
         /* 02201DC8 */ cpu->f[8] = -fma(cpu->f[8], cpu->f[4], -(cpu->f[13]));
         /* 02201DCC */ cpu->f[10] = cpu->f[8] * cpu->f[7];
         /* 02201DD0 */ cpu->f[8] = -fma(cpu->f[3], cpu->f[3], -(cpu->f[4]));
-        /* 02201DD4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[12]);
+        /* 02201DD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[12]));
         /* 02201DD8 */ cpu->f[11] = cpu->f[10] * cpu->f[4];
-        /* 02201DDC */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02201DDC */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02201DDC */ _t48 = _t47 & 0x00000001u;
         /* 02201DDC */ if (_t48) goto L_02201E00; else goto L_02201DE0;
   L_02201DE0: ; // 0x2201de0
@@ -8872,8 +8872,8 @@ void Gambit_fn_02201C84(CPUState* cpu) {
         /* 02201DE8 */ cpu->f[13] = cpu->f[11] - cpu->f[3];
         /* 02201DEC */ cpu->f[11] = cpu->f[0] - cpu->f[3];
         /* 02201DF0 */ cpu->f[9] = cpu->f[11] / cpu->f[13];
-        /* 02201DF4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[5]);
-        /* 02201DF8 */ _t50 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02201DF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[5]));
+        /* 02201DF8 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02201DF8 */ _t51 = _t50 & 0x00000001u;
         /* 02201DF8 */ if (_t51) goto L_02201DFC; else goto L_02201E00;
   L_02201DFC: ; // 0x2201dfc
@@ -8882,10 +8882,10 @@ void Gambit_fn_02201C84(CPUState* cpu) {
         /* 02201E00 */ _t52 = cpu->r[30] + 0x0000013Cu;
         /* 02201E00 */ cpu->r[8] = rbrew_read32(cpu->mem, _t52);
         /* 02201E04 */ cpu->r[10] = cpu->r[8] + 0xFFFFFFFFu;
-        /* 02201E04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02201E04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02201E08 */ _t53 = cpu->r[30] + 0x00000170u;
         /* 02201E08 */ cpu->f[3] = rbrew_read_f32(cpu->mem, _t53);
-        /* 02201E0C */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02201E0C */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02201E0C */ _t55 = _t54 & 0x00000001u;
         /* 02201E0C */ if (_t55) goto L_02201E14; else goto L_02201E10;
   L_02201E10: ; // 0x2201e10
@@ -9170,7 +9170,7 @@ void Gambit_fn_02201FFC(CPUState* cpu) {
         /* 02202098 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t23);
         /* 0220209C */ _t24 = cpu->r[1] + 0x00000008u;
         /* 0220209C */ cpu->r[30] = rbrew_read32(cpu->mem, _t24);
-        /* 022020A0 */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022020A0 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022020A0 */ _t26 = _t25 & 0x00000001u;
         /* 022020A0 */ if (_t26) goto L_022020A4; // else: addr-0 trap, fall-through
   L_022020A4: ; // 0x22020a4
@@ -9252,7 +9252,7 @@ void Gambit_fn_02202000(CPUState* cpu) {
         /* 02202098 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t23);
         /* 0220209C */ _t24 = cpu->r[1] + 0x00000008u;
         /* 0220209C */ cpu->r[30] = rbrew_read32(cpu->mem, _t24);
-        /* 022020A0 */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022020A0 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022020A0 */ _t26 = _t25 & 0x00000001u;
         /* 022020A0 */ if (_t26) goto L_022020A4; // else: addr-0 trap, fall-through
   L_022020A4: ; // 0x22020a4
@@ -9524,17 +9524,17 @@ void Gambit_fn_022020C8(CPUState* cpu) {
         /* 022022C8 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t97);
         /* 022022CC */ _t98 = cpu->r[12] + 0xFFFFE55Cu;
         /* 022022CC */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t98);
-        /* 022022D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u);
+        /* 022022D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u));
         /* 022022D4 */ _t99 = cpu->r[31] + 0x00000068u;
         /* 022022D4 */ rbrew_write32(cpu->mem, _t99, cpu->r[0]);
-        /* 022022D8 */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022022D8 */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022022D8 */ _t101 = _t100 & 0x00000001u;
         /* 022022D8 */ if (_t101) goto L_022022DC; else goto L_022022EC;
   L_022022DC: ; // 0x22022dc
         /* 022022DC */ cpu->r[3] = 0x00000010u;
         /* 022022E0 */ Gambit_fn_02801A78(cpu);
-        /* 022022E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022022E8 */ _t102 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022022E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022022E8 */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022022E8 */ _t103 = _t102 & 0x00000001u;
         /* 022022E8 */ if (_t103) goto L_02202304; else goto L_022022EC;
   L_022022EC: ; // 0x22022ec
@@ -9550,16 +9550,16 @@ void Gambit_fn_022020C8(CPUState* cpu) {
         /* 02202300 */ _t108 = cpu->r[3] + 0x0000000Cu;
         /* 02202300 */ rbrew_write_f32(cpu->mem, _t108, cpu->f[12]);
   L_02202304: ; // 0x2202304
-        /* 02202304 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u);
+        /* 02202304 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u));
         /* 02202308 */ cpu->r[3] = cpu->r[31] + 0x000000D0u;
-        /* 0220230C */ _t109 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220230C */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220230C */ _t110 = _t109 & 0x00000001u;
         /* 0220230C */ if (_t110) goto L_02202310; else goto L_02202320;
   L_02202310: ; // 0x2202310
         /* 02202310 */ cpu->r[3] = 0x00000010u;
         /* 02202314 */ Gambit_fn_02801A78(cpu);
-        /* 02202318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220231C */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220231C */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220231C */ _t112 = _t111 & 0x00000001u;
         /* 0220231C */ if (_t112) goto L_02202338; else goto L_02202320;
   L_02202320: ; // 0x2202320
@@ -9620,7 +9620,7 @@ void Gambit_fn_022020C8(CPUState* cpu) {
         /* 02202398 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t135);
         /* 0220239C */ _t136 = cpu->r[1] + 0x00000040u;
         /* 0220239C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t136);
-        /* 022023A0 */ _t137 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022023A0 */ _t137 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022023A0 */ _t138 = _t137 & 0x00000001u;
         /* 022023A0 */ if (_t138) goto L_022023A4; // else: addr-0 trap, fall-through
   L_022023A4: ; // 0x22023a4
@@ -9636,15 +9636,15 @@ void Gambit_fn_022023B4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_022023B4: ; // 0x22023b4
-        /* 022023B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022023B8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022023B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022023B8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022023B8 */ _t1 = _t0 & 0x00000001u;
         /* 022023B8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022023B8 */ goto L_022023BC;
   L_022023BC: ; // 0x22023bc
         /* 022023BC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022023BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022023C0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022023BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022023C0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022023C0 */ _t3 = _t2 & 0x00000001u;
         /* 022023C0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022023C0 */ goto L_022023C4;
@@ -9663,8 +9663,8 @@ void Gambit_fn_022023B4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -9678,15 +9678,15 @@ void Gambit_fn_022023B4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -9720,15 +9720,15 @@ void Gambit_fn_022023CC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_022023CC: ; // 0x22023cc
-        /* 022023CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022023D0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022023CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022023D0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022023D0 */ _t1 = _t0 & 0x00000001u;
         /* 022023D0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022023D0 */ goto L_022023D4;
   L_022023D4: ; // 0x22023d4
         /* 022023D4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022023D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022023D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022023D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022023D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022023D8 */ _t3 = _t2 & 0x00000001u;
         /* 022023D8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022023D8 */ goto L_022023DC;
@@ -9747,8 +9747,8 @@ void Gambit_fn_022023CC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -9762,15 +9762,15 @@ void Gambit_fn_022023CC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -9816,15 +9816,15 @@ void Gambit_fn_022023FC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_022023FC: ; // 0x22023fc
-        /* 022023FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02202400 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022023FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02202400 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202400 */ _t1 = _t0 & 0x00000001u;
         /* 02202400 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02202400 */ goto L_02202404;
   L_02202404: ; // 0x2202404
         /* 02202404 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02202404 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02202408 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202404 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02202408 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202408 */ _t3 = _t2 & 0x00000001u;
         /* 02202408 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02202408 */ goto L_0220240C;
@@ -9843,8 +9843,8 @@ void Gambit_fn_022023FC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -9858,15 +9858,15 @@ void Gambit_fn_022023FC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -9894,15 +9894,15 @@ void Gambit_fn_02202410(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02202410: ; // 0x2202410
-        /* 02202410 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02202414 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202410 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02202414 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202414 */ _t1 = _t0 & 0x00000001u;
         /* 02202414 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02202414 */ goto L_02202418;
   L_02202418: ; // 0x2202418
         /* 02202418 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02202418 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0220241C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0220241C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220241C */ _t3 = _t2 & 0x00000001u;
         /* 0220241C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0220241C */ goto L_02202420;
@@ -9921,8 +9921,8 @@ void Gambit_fn_02202410(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -9936,15 +9936,15 @@ void Gambit_fn_02202410(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -10023,8 +10023,8 @@ void Gambit_fn_02202444(CPUState* cpu) {
         /* 02202444 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02202444 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02202448 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 02202448 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0220244C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202448 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0220244C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220244C */ _t2 = _t1 & 0x00000001u;
         /* 0220244C */ _t3 = _t2 ^ 0x00000001u;
         /* 0220244C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -10046,8 +10046,8 @@ void Gambit_fn_02202460(CPUState* cpu) {
         /* 02202460 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02202460 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02202464 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 02202464 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02202468 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02202468 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202468 */ _t2 = _t1 & 0x00000001u;
         /* 02202468 */ _t3 = _t2 ^ 0x00000001u;
         /* 02202468 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -10069,8 +10069,8 @@ void Gambit_fn_0220247C(CPUState* cpu) {
         /* 0220247C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0220247C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02202480 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 02202480 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02202484 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202480 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02202484 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202484 */ _t2 = _t1 & 0x00000001u;
         /* 02202484 */ _t3 = _t2 ^ 0x00000001u;
         /* 02202484 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -10113,8 +10113,8 @@ void Gambit_fn_022024A8(CPUState* cpu) {
         /* 022024B8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 022024BC */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 022024BC */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 022024C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 022024C4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022024C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 022024C4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022024C4 */ _t5 = _t4 & 0x00000001u;
         /* 022024C4 */ if (_t5) goto L_022024C8; else goto L_022024E4;
   L_022024C8: ; // 0x22024c8
@@ -10153,8 +10153,8 @@ void Gambit_fn_022024AC(CPUState* cpu) {
         /* 022024B8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 022024BC */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 022024BC */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 022024C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 022024C4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022024C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 022024C4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022024C4 */ _t5 = _t4 & 0x00000001u;
         /* 022024C4 */ if (_t5) goto L_022024C8; else goto L_022024E4;
   L_022024C8: ; // 0x22024c8
@@ -10615,8 +10615,8 @@ void Gambit_fn_022026BC(CPUState* cpu) {
         /* 022026BC */ _t0 = cpu->r[3] + 0x00000114u;
         /* 022026BC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 022026C0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 022026C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022026C4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022026C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022026C4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022026C4 */ _t2 = _t1 & 0x00000001u;
         /* 022026C4 */ if (_t2) goto L_022026D4; else goto L_022026C8;
   L_022026C8: ; // 0x22026c8
@@ -10645,8 +10645,8 @@ void Gambit_fn_022026E0(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -10765,10 +10765,10 @@ void Gambit_fn_02202744(CPUState* cpu) {
         /* 02202744 */ cpu->r[10] = 0x101D0000u;
         /* 02202748 */ _t0 = cpu->r[10] + 0xFFFFE620u;
         /* 02202748 */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 0220274C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0220274C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02202750 */ cpu->r[10] = 0x101D0000u;
         /* 02202754 */ cpu->r[10] = cpu->r[10] + 0xFFFFFE88u;
-        /* 02202758 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202758 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202758 */ _t2 = _t1 & 0x00000001u;
         /* 02202758 */ if (_t2) goto L_0220275C; else goto L_02202774;
   L_0220275C: ; // 0x220275c
@@ -10781,8 +10781,8 @@ void Gambit_fn_02202744(CPUState* cpu) {
         /* 02202770 */ _t4 = cpu->r[10] + 0x00000000u;
         /* 02202770 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_02202774: ; // 0x2202774
-        /* 02202774 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02202778 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202774 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02202778 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202778 */ _t6 = _t5 & 0x00000001u;
         /* 02202778 */ if (_t6) goto L_0220277C; else goto L_02202784;
   L_0220277C: ; // 0x220277c
@@ -10793,9 +10793,9 @@ void Gambit_fn_02202744(CPUState* cpu) {
         /* 02202788 */ _t7 = cpu->r[9] + 0xFFFFDA00u;
         /* 02202788 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 0220278C */ cpu->r[11] = 0x101D0000u;
-        /* 02202790 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02202790 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02202794 */ cpu->r[11] = cpu->r[11] + 0xFFFFFBFCu;
-        /* 02202798 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202798 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202798 */ _t9 = _t8 & 0x00000001u;
         /* 02202798 */ if (_t9) goto L_0220279C; else goto L_022027B4;
   L_0220279C: ; // 0x220279c
@@ -10808,8 +10808,8 @@ void Gambit_fn_02202744(CPUState* cpu) {
         /* 022027B0 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 022027B0 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_022027B4: ; // 0x22027b4
-        /* 022027B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 022027B8 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022027B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 022027B8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022027B8 */ _t13 = _t12 & 0x00000001u;
         /* 022027B8 */ if (_t13) goto L_022027BC; else goto L_022027C4;
   L_022027BC: ; // 0x22027bc
@@ -10820,9 +10820,9 @@ void Gambit_fn_02202744(CPUState* cpu) {
         /* 022027C8 */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 022027C8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 022027CC */ cpu->r[9] = 0x101D0000u;
-        /* 022027D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 022027D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 022027D4 */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 022027D8 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022027D8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022027D8 */ _t16 = _t15 & 0x00000001u;
         /* 022027D8 */ if (_t16) goto L_022027DC; else goto L_022027F4;
   L_022027DC: ; // 0x22027dc
@@ -10835,8 +10835,8 @@ void Gambit_fn_02202744(CPUState* cpu) {
         /* 022027F0 */ _t18 = cpu->r[9] + 0x00000000u;
         /* 022027F0 */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_022027F4: ; // 0x22027f4
-        /* 022027F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 022027F8 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022027F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 022027F8 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022027F8 */ _t20 = _t19 & 0x00000001u;
         /* 022027F8 */ if (_t20) goto L_022027FC; else goto L_02202804;
   L_022027FC: ; // 0x22027fc
@@ -10848,9 +10848,9 @@ void Gambit_fn_02202744(CPUState* cpu) {
         /* 02202808 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 02202808 */ cpu->r[9] = _t21;
         /* 0220280C */ cpu->r[10] = 0x101D0000u;
-        /* 02202810 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02202810 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02202814 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 02202818 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202818 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202818 */ _t23 = _t22 & 0x00000001u;
         /* 02202818 */ if (_t23) goto L_0220281C; else goto L_02202830;
   L_0220281C: ; // 0x220281c
@@ -10862,8 +10862,8 @@ void Gambit_fn_02202744(CPUState* cpu) {
         /* 0220282C */ _t25 = cpu->r[10] + 0x00000000u;
         /* 0220282C */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_02202830: ; // 0x2202830
-        /* 02202830 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02202834 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202830 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02202834 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202834 */ _t27 = _t26 & 0x00000001u;
         /* 02202834 */ if (_t27) goto L_02202838; else goto L_02202840;
   L_02202838: ; // 0x2202838
@@ -10875,9 +10875,9 @@ void Gambit_fn_02202744(CPUState* cpu) {
         /* 02202844 */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 02202844 */ cpu->r[10] = _t28;
         /* 02202848 */ cpu->r[11] = 0x101D0000u;
-        /* 0220284C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0220284C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02202850 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 02202854 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202854 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202854 */ _t30 = _t29 & 0x00000001u;
         /* 02202854 */ if (_t30) goto L_02202858; else goto L_0220286C;
   L_02202858: ; // 0x2202858
@@ -10994,9 +10994,9 @@ void Gambit_fn_022028E8(CPUState* cpu) {
         /* 022028EC */ _t0 = cpu->r[9] + 0xFFFFE624u;
         /* 022028EC */ cpu->r[9] = rbrew_read32(cpu->mem, _t0);
         /* 022028F0 */ cpu->r[10] = 0x101D0000u;
-        /* 022028F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 022028F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 022028F8 */ cpu->r[10] = cpu->r[10] + 0xFFFFFE98u;
-        /* 022028FC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022028FC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022028FC */ _t2 = _t1 & 0x00000001u;
         /* 022028FC */ if (_t2) goto L_02202900; else goto L_02202918;
   L_02202900: ; // 0x2202900
@@ -11009,8 +11009,8 @@ void Gambit_fn_022028E8(CPUState* cpu) {
         /* 02202914 */ _t4 = cpu->r[10] + 0x00000000u;
         /* 02202914 */ rbrew_write32(cpu->mem, _t4, cpu->r[12]);
   L_02202918: ; // 0x2202918
-        /* 02202918 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0220291C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0220291C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220291C */ _t6 = _t5 & 0x00000001u;
         /* 0220291C */ if (_t6) goto L_02202920; else goto L_02202928;
   L_02202920: ; // 0x2202920
@@ -11021,9 +11021,9 @@ void Gambit_fn_022028E8(CPUState* cpu) {
         /* 0220292C */ _t7 = cpu->r[11] + 0xFFFFE61Cu;
         /* 0220292C */ cpu->r[11] = rbrew_read32(cpu->mem, _t7);
         /* 02202930 */ cpu->r[12] = 0x101D0000u;
-        /* 02202934 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02202934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02202938 */ cpu->r[12] = cpu->r[12] + 0xFFFFFC08u;
-        /* 0220293C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220293C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220293C */ _t9 = _t8 & 0x00000001u;
         /* 0220293C */ if (_t9) goto L_02202940; else goto L_02202958;
   L_02202940: ; // 0x2202940
@@ -11036,8 +11036,8 @@ void Gambit_fn_022028E8(CPUState* cpu) {
         /* 02202954 */ _t11 = cpu->r[12] + 0x00000000u;
         /* 02202954 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_02202958: ; // 0x2202958
-        /* 02202958 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0220295C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202958 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0220295C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220295C */ _t13 = _t12 & 0x00000001u;
         /* 0220295C */ if (_t13) goto L_02202960; else goto L_02202968;
   L_02202960: ; // 0x2202960
@@ -11048,9 +11048,9 @@ void Gambit_fn_022028E8(CPUState* cpu) {
         /* 0220296C */ _t14 = cpu->r[10] + 0xFFFFE618u;
         /* 0220296C */ cpu->r[10] = rbrew_read32(cpu->mem, _t14);
         /* 02202970 */ cpu->r[9] = 0x101D0000u;
-        /* 02202974 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02202974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02202978 */ cpu->r[9] = cpu->r[9] + 0xFFFFFC04u;
-        /* 0220297C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220297C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220297C */ _t16 = _t15 & 0x00000001u;
         /* 0220297C */ if (_t16) goto L_02202980; else goto L_02202998;
   L_02202980: ; // 0x2202980
@@ -11063,8 +11063,8 @@ void Gambit_fn_022028E8(CPUState* cpu) {
         /* 02202994 */ _t18 = cpu->r[9] + 0x00000000u;
         /* 02202994 */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_02202998: ; // 0x2202998
-        /* 02202998 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 0220299C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202998 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 0220299C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220299C */ _t20 = _t19 & 0x00000001u;
         /* 0220299C */ if (_t20) goto L_022029A0; else goto L_022029A8;
   L_022029A0: ; // 0x22029a0
@@ -11075,9 +11075,9 @@ void Gambit_fn_022028E8(CPUState* cpu) {
         /* 022029AC */ _t21 = cpu->r[9] + 0xFFFFDA0Cu;
         /* 022029AC */ cpu->r[9] = rbrew_read32(cpu->mem, _t21);
         /* 022029B0 */ cpu->r[12] = 0x101D0000u;
-        /* 022029B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 022029B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 022029B8 */ cpu->r[12] = cpu->r[12] + 0xFFFFFC00u;
-        /* 022029BC */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022029BC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022029BC */ _t23 = _t22 & 0x00000001u;
         /* 022029BC */ if (_t23) goto L_022029C0; else goto L_022029D8;
   L_022029C0: ; // 0x22029c0
@@ -11090,8 +11090,8 @@ void Gambit_fn_022028E8(CPUState* cpu) {
         /* 022029D4 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 022029D4 */ rbrew_write32(cpu->mem, _t25, cpu->r[9]);
   L_022029D8: ; // 0x22029d8
-        /* 022029D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 022029DC */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022029D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 022029DC */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022029DC */ _t27 = _t26 & 0x00000001u;
         /* 022029DC */ if (_t27) goto L_022029E0; else goto L_022029E8;
   L_022029E0: ; // 0x22029e0
@@ -11102,9 +11102,9 @@ void Gambit_fn_022028E8(CPUState* cpu) {
         /* 022029EC */ _t28 = cpu->r[12] + 0xFFFFDA00u;
         /* 022029EC */ cpu->r[12] = rbrew_read32(cpu->mem, _t28);
         /* 022029F0 */ cpu->r[9] = 0x101D0000u;
-        /* 022029F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 022029F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 022029F8 */ cpu->r[9] = cpu->r[9] + 0xFFFFFBFCu;
-        /* 022029FC */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022029FC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022029FC */ _t30 = _t29 & 0x00000001u;
         /* 022029FC */ if (_t30) goto L_02202A00; else goto L_02202A18;
   L_02202A00: ; // 0x2202a00
@@ -11117,8 +11117,8 @@ void Gambit_fn_022028E8(CPUState* cpu) {
         /* 02202A14 */ _t32 = cpu->r[9] + 0x00000000u;
         /* 02202A14 */ rbrew_write32(cpu->mem, _t32, cpu->r[12]);
   L_02202A18: ; // 0x2202a18
-        /* 02202A18 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 02202A1C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202A18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 02202A1C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202A1C */ _t34 = _t33 & 0x00000001u;
         /* 02202A1C */ if (_t34) goto L_02202A20; else goto L_02202A28;
   L_02202A20: ; // 0x2202a20
@@ -11129,9 +11129,9 @@ void Gambit_fn_022028E8(CPUState* cpu) {
         /* 02202A2C */ _t35 = cpu->r[12] + 0xFFFFD9ECu;
         /* 02202A2C */ cpu->r[12] = rbrew_read32(cpu->mem, _t35);
         /* 02202A30 */ cpu->r[11] = 0x101D0000u;
-        /* 02202A34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02202A34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02202A38 */ cpu->r[11] = cpu->r[11] + 0xFFFFFB4Cu;
-        /* 02202A3C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202A3C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202A3C */ _t37 = _t36 & 0x00000001u;
         /* 02202A3C */ if (_t37) goto L_02202A40; else goto L_02202A58;
   L_02202A40: ; // 0x2202a40
@@ -11144,8 +11144,8 @@ void Gambit_fn_022028E8(CPUState* cpu) {
         /* 02202A54 */ _t39 = cpu->r[11] + 0x00000000u;
         /* 02202A54 */ rbrew_write32(cpu->mem, _t39, cpu->r[0]);
   L_02202A58: ; // 0x2202a58
-        /* 02202A58 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 02202A5C */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202A58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 02202A5C */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202A5C */ _t41 = _t40 & 0x00000001u;
         /* 02202A5C */ if (_t41) goto L_02202A60; else goto L_02202A68;
   L_02202A60: ; // 0x2202a60
@@ -11157,9 +11157,9 @@ void Gambit_fn_022028E8(CPUState* cpu) {
         /* 02202A6C */ cpu->r[9] = rbrew_read32(cpu->mem, _t42);
         /* 02202A6C */ cpu->r[10] = _t42;
         /* 02202A70 */ cpu->r[12] = 0x101D0000u;
-        /* 02202A74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02202A74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02202A78 */ cpu->r[12] = cpu->r[12] + 0xFFFFD4ECu;
-        /* 02202A7C */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202A7C */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202A7C */ _t44 = _t43 & 0x00000001u;
         /* 02202A7C */ if (_t44) goto L_02202A80; else goto L_02202A94;
   L_02202A80: ; // 0x2202a80
@@ -11171,8 +11171,8 @@ void Gambit_fn_022028E8(CPUState* cpu) {
         /* 02202A90 */ _t46 = cpu->r[12] + 0x00000000u;
         /* 02202A90 */ rbrew_write32(cpu->mem, _t46, cpu->r[0]);
   L_02202A94: ; // 0x2202a94
-        /* 02202A94 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02202A98 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202A94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02202A98 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202A98 */ _t48 = _t47 & 0x00000001u;
         /* 02202A98 */ if (_t48) goto L_02202A9C; else goto L_02202AA4;
   L_02202A9C: ; // 0x2202a9c
@@ -11184,9 +11184,9 @@ void Gambit_fn_022028E8(CPUState* cpu) {
         /* 02202AA8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t49);
         /* 02202AA8 */ cpu->r[9] = _t49;
         /* 02202AAC */ cpu->r[10] = 0x101D0000u;
-        /* 02202AB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02202AB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02202AB4 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4E4u;
-        /* 02202AB8 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202AB8 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202AB8 */ _t51 = _t50 & 0x00000001u;
         /* 02202AB8 */ if (_t51) goto L_02202ABC; else goto L_02202AD0;
   L_02202ABC: ; // 0x2202abc
@@ -11237,10 +11237,10 @@ void Gambit_fn_02202AF4(CPUState* cpu) {
         /* 02202B14 */ cpu->r[31] = 0x101D0000u;
         /* 02202B18 */ _t3 = cpu->r[28] + 0x0000001Cu;
         /* 02202B18 */ rbrew_write32(cpu->mem, _t3, cpu->r[4]);
-        /* 02202B1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02202B1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02202B20 */ _t4 = cpu->r[28] + 0x0000000Fu;
         /* 02202B20 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[27]);
-        /* 02202B24 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202B24 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202B24 */ _t6 = _t5 & 0x00000001u;
         /* 02202B24 */ if (_t6) goto L_02202B68; else goto L_02202B28;
   L_02202B28: ; // 0x2202b28
@@ -11255,16 +11255,16 @@ void Gambit_fn_02202AF4(CPUState* cpu) {
         /* 02202B3C */ cpu->r[5] = 0x00000004u;
         /* 02202B40 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 02202B44 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02202B48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02202B48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02202B4C */ cpu->r[0] = cpu->r[27];
-        /* 02202B50 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02202B50 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02202B50 */ _t11 = _t10 & 0x00000001u;
         /* 02202B50 */ if (_t11) goto L_02202B58; else goto L_02202B54;
   L_02202B54: ; // 0x2202b54
         /* 02202B54 */ cpu->r[0] = 0x00000001u;
   L_02202B58: ; // 0x2202b58
-        /* 02202B58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02202B5C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202B58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02202B5C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202B5C */ _t13 = _t12 & 0x00000001u;
         /* 02202B5C */ if (_t13) goto L_02202B68; else goto L_02202B60;
   L_02202B60: ; // 0x2202b60
@@ -11276,9 +11276,9 @@ void Gambit_fn_02202AF4(CPUState* cpu) {
         /* 02202B68 */ _t16 = cpu->r[28] + 0x00000020u;
         /* 02202B68 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 02202B6C */ cpu->r[0] = 0x00000000u;
-        /* 02202B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02202B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02202B74 */ cpu->r[12] = cpu->r[0];
-        /* 02202B78 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02202B78 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02202B78 */ _t18 = _t17 & 0x00000001u;
         /* 02202B78 */ if (_t18) goto L_02202B7C; else goto L_02202BA0;
   L_02202B7C: ; // 0x2202b7c
@@ -11303,8 +11303,8 @@ void Gambit_fn_02202AF4(CPUState* cpu) {
   L_02202BA0: ; // 0x2202ba0
         /* 02202BA0 */ _t26 = cpu->r[28] + 0x0000000Fu;
         /* 02202BA0 */ cpu->r[27] = rbrew_read8(cpu->mem, _t26);
-        /* 02202BA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 02202BA8 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202BA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 02202BA8 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202BA8 */ _t28 = _t27 & 0x00000001u;
         /* 02202BA8 */ if (_t28) goto L_02202BEC; else goto L_02202BAC;
   L_02202BAC: ; // 0x2202bac
@@ -11319,16 +11319,16 @@ void Gambit_fn_02202AF4(CPUState* cpu) {
         /* 02202BC0 */ cpu->r[5] = 0x00000004u;
         /* 02202BC4 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 02202BC8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02202BCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02202BCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02202BD0 */ cpu->r[11] = cpu->r[27];
-        /* 02202BD4 */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02202BD4 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02202BD4 */ _t33 = _t32 & 0x00000001u;
         /* 02202BD4 */ if (_t33) goto L_02202BDC; else goto L_02202BD8;
   L_02202BD8: ; // 0x2202bd8
         /* 02202BD8 */ cpu->r[11] = 0x00000001u;
   L_02202BDC: ; // 0x2202bdc
-        /* 02202BDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02202BE0 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202BDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02202BE0 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202BE0 */ _t35 = _t34 & 0x00000001u;
         /* 02202BE0 */ if (_t35) goto L_02202BEC; else goto L_02202BE4;
   L_02202BE4: ; // 0x2202be4
@@ -11340,9 +11340,9 @@ void Gambit_fn_02202AF4(CPUState* cpu) {
         /* 02202BEC */ _t38 = cpu->r[28] + 0x00000028u;
         /* 02202BEC */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 02202BF0 */ cpu->r[0] = 0x00000000u;
-        /* 02202BF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02202BF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 02202BF8 */ cpu->r[12] = cpu->r[0];
-        /* 02202BFC */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02202BFC */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02202BFC */ _t40 = _t39 & 0x00000001u;
         /* 02202BFC */ if (_t40) goto L_02202C00; else goto L_02202C24;
   L_02202C00: ; // 0x2202c00
@@ -11367,8 +11367,8 @@ void Gambit_fn_02202AF4(CPUState* cpu) {
   L_02202C24: ; // 0x2202c24
         /* 02202C24 */ _t48 = cpu->r[28] + 0x0000000Fu;
         /* 02202C24 */ cpu->r[27] = rbrew_read8(cpu->mem, _t48);
-        /* 02202C28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 02202C2C */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202C28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 02202C2C */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202C2C */ _t50 = _t49 & 0x00000001u;
         /* 02202C2C */ if (_t50) goto L_02202C70; else goto L_02202C30;
   L_02202C30: ; // 0x2202c30
@@ -11383,16 +11383,16 @@ void Gambit_fn_02202AF4(CPUState* cpu) {
         /* 02202C44 */ cpu->r[5] = 0x00000004u;
         /* 02202C48 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 02202C4C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02202C50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02202C50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02202C54 */ cpu->r[10] = cpu->r[27];
-        /* 02202C58 */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02202C58 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02202C58 */ _t55 = _t54 & 0x00000001u;
         /* 02202C58 */ if (_t55) goto L_02202C60; else goto L_02202C5C;
   L_02202C5C: ; // 0x2202c5c
         /* 02202C5C */ cpu->r[10] = 0x00000001u;
   L_02202C60: ; // 0x2202c60
-        /* 02202C60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02202C64 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202C60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02202C64 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202C64 */ _t57 = _t56 & 0x00000001u;
         /* 02202C64 */ if (_t57) goto L_02202C70; else goto L_02202C68;
   L_02202C68: ; // 0x2202c68
@@ -11404,9 +11404,9 @@ void Gambit_fn_02202AF4(CPUState* cpu) {
         /* 02202C70 */ _t60 = cpu->r[28] + 0x00000030u;
         /* 02202C70 */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
         /* 02202C74 */ cpu->r[0] = 0x00000000u;
-        /* 02202C78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02202C78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02202C7C */ cpu->r[5] = cpu->r[0];
-        /* 02202C80 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02202C80 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02202C80 */ _t62 = _t61 & 0x00000001u;
         /* 02202C80 */ if (_t62) goto L_02202C84; else goto L_02202CA8;
   L_02202C84: ; // 0x2202c84
@@ -11431,8 +11431,8 @@ void Gambit_fn_02202AF4(CPUState* cpu) {
   L_02202CA8: ; // 0x2202ca8
         /* 02202CA8 */ _t70 = cpu->r[30] + 0x00000000u;
         /* 02202CA8 */ cpu->r[25] = rbrew_read8(cpu->mem, _t70);
-        /* 02202CAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 02202CB0 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202CAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 02202CB0 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202CB0 */ _t72 = _t71 & 0x00000001u;
         /* 02202CB0 */ if (_t72) goto L_02202D8C; else goto L_02202CB4;
   L_02202CB4: ; // 0x2202cb4
@@ -11448,10 +11448,10 @@ void Gambit_fn_02202AF4(CPUState* cpu) {
         /* 02202CCC */ cpu->r[4] = (uint32_t)((int32_t)cpu->r[25] * (int32_t)0x00000024u);
         /* 02202CD0 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02202CD4 */ cpu->r[24] = cpu->r[3];
-        /* 02202CD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 02202CD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 02202CDC */ cpu->r[30] = cpu->r[25];
         /* 02202CE0 */ cpu->r[7] = 0x00000000u;
-        /* 02202CE4 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02202CE4 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02202CE4 */ _t77 = _t76 & 0x00000001u;
         /* 02202CE4 */ if (_t77) goto L_02202CEC; else goto L_02202CE8;
   L_02202CE8: ; // 0x2202ce8
@@ -11464,36 +11464,36 @@ void Gambit_fn_02202AF4(CPUState* cpu) {
         /* 02202CF8 */ cpu->r[23] = 0x00000018u;
   L_02202CFC: ; // 0x2202cfc
         /* 02202CFC */ cpu->r[27] = cpu->r[24] + cpu->r[22];
-        /* 02202CFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 02202D00 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202CFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 02202D00 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202D00 */ _t80 = _t79 & 0x00000001u;
         /* 02202D00 */ if (_t80) goto L_02202D70; else goto L_02202D04;
   L_02202D04: ; // 0x2202d04
         /* 02202D04 */ cpu->r[26] = cpu->r[27];
-        /* 02202D04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 02202D08 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202D04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 02202D08 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202D08 */ _t82 = _t81 & 0x00000001u;
         /* 02202D08 */ if (_t82) goto L_02202D0C; else goto L_02202D1C;
   L_02202D0C: ; // 0x2202d0c
         /* 02202D0C */ cpu->r[3] = 0x00000024u;
         /* 02202D10 */ Gambit_fn_02801A78(cpu);
         /* 02202D14 */ cpu->r[26] = cpu->r[3];
-        /* 02202D14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 02202D18 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202D14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 02202D18 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202D18 */ _t84 = _t83 & 0x00000001u;
         /* 02202D18 */ if (_t84) goto L_02202D64; else goto L_02202D1C;
   L_02202D1C: ; // 0x2202d1c
         /* 02202D1C */ cpu->r[11] = cpu->r[26];
-        /* 02202D1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02202D20 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202D1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02202D20 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202D20 */ _t86 = _t85 & 0x00000001u;
         /* 02202D20 */ if (_t86) goto L_02202D24; else goto L_02202D34;
   L_02202D24: ; // 0x2202d24
         /* 02202D24 */ cpu->r[3] = 0x0000000Cu;
         /* 02202D28 */ Gambit_fn_02801A78(cpu);
         /* 02202D2C */ cpu->r[11] = cpu->r[3];
-        /* 02202D2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02202D30 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202D2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02202D30 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202D30 */ _t88 = _t87 & 0x00000001u;
         /* 02202D30 */ if (_t88) goto L_02202D50; else goto L_02202D34;
   L_02202D34: ; // 0x2202d34
@@ -11524,14 +11524,14 @@ void Gambit_fn_02202AF4(CPUState* cpu) {
         /* 02202D6C */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
   L_02202D70: ; // 0x2202d70
         /* 02202D70 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 02202D70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02202D70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02202D74 */ cpu->r[22] = cpu->r[22] + 0x00000024u;
-        /* 02202D78 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202D78 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202D78 */ _t98 = _t97 & 0x00000001u;
         /* 02202D78 */ if (_t98) goto L_02202D7C; else goto L_02202CFC;
   L_02202D7C: ; // 0x2202d7c
-        /* 02202D7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 02202D80 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202D7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 02202D80 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202D80 */ _t100 = _t99 & 0x00000001u;
         /* 02202D80 */ if (_t100) goto L_02202D8C; else goto L_02202D84;
   L_02202D84: ; // 0x2202d84
@@ -11561,10 +11561,10 @@ void Gambit_fn_02202DA4(CPUState* cpu) {
         /* 02202DA8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 02202DAC */ _t2 = cpu->r[3] + 0x00000024u;
         /* 02202DAC */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 02202DB0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[12]);
+        /* 02202DB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[12]));
         /* 02202DB4 */ _t3 = cpu->r[4] + 0x00000000u;
         /* 02202DB4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 02202DB8 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02202DB8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02202DB8 */ _t5 = _t4 & 0x00000001u;
         /* 02202DB8 */ if (_t5) goto L_02202DBC; else goto L_02202DC4;
   L_02202DBC: ; // 0x2202dbc
@@ -11581,10 +11581,10 @@ void Gambit_fn_02202DA4(CPUState* cpu) {
         /* 02202DD0 */ cpu->r[9] = rbrew_read8(cpu->mem, _t9);
         /* 02202DD4 */ _t10 = cpu->r[3] + 0x00000028u;
         /* 02202DD4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 02202DD8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
+        /* 02202DD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
         /* 02202DDC */ _t11 = cpu->r[3] + 0x0000002Cu;
         /* 02202DDC */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
-        /* 02202DE0 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02202DE0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02202DE0 */ _t13 = _t12 & 0x00000001u;
         /* 02202DE0 */ if (_t13) goto L_02202DE4; else goto L_02202DEC;
   L_02202DE4: ; // 0x2202de4
@@ -11605,10 +11605,10 @@ void Gambit_fn_02202DA4(CPUState* cpu) {
         /* 02202E00 */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
         /* 02202E04 */ _t20 = cpu->r[3] + 0x00000034u;
         /* 02202E04 */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 02202E08 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
+        /* 02202E08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
         /* 02202E0C */ _t21 = cpu->r[6] + 0x00000000u;
         /* 02202E0C */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
-        /* 02202E10 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02202E10 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02202E10 */ _t23 = _t22 & 0x00000001u;
         /* 02202E10 */ if (_t23) goto L_02202E14; else goto L_02202E1C;
   L_02202E14: ; // 0x2202e14
@@ -11635,10 +11635,10 @@ void Gambit_fn_02202E2C(CPUState* cpu) {
         /* 02202E34 */ _t1 = cpu->r[3] + 0x00000028u;
         /* 02202E34 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 02202E38 */ cpu->r[8] = cpu->r[0];
-        /* 02202E3C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 02202E3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 02202E40 */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 02202E40 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 02202E44 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02202E44 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02202E44 */ _t4 = _t3 & 0x00000001u;
         /* 02202E44 */ if (_t4) goto L_02202E48; else goto L_02202E60;
   L_02202E48: ; // 0x2202e48
@@ -11646,8 +11646,8 @@ void Gambit_fn_02202E2C(CPUState* cpu) {
         /* 02202E4C */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 02202E50 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 02202E50 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 02202E54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02202E58 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202E54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02202E58 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202E58 */ _t7 = _t6 & 0x00000001u;
         /* 02202E58 */ if (_t7) goto L_02202E5C; else goto L_02202E6C;
   L_02202E5C: ; // 0x2202e5c
@@ -11655,16 +11655,16 @@ void Gambit_fn_02202E2C(CPUState* cpu) {
   L_02202E60: ; // 0x2202e60
         /* 02202E60 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 02202E60 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 02202E64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02202E68 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202E64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02202E68 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202E68 */ _t10 = _t9 & 0x00000001u;
         /* 02202E68 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02202E68 */ goto L_02202E6C;
   L_02202E6C: ; // 0x2202e6c
-        /* 02202E6C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 02202E6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 02202E70 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 02202E70 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 02202E74 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02202E74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02202E74 */ _t13 = _t12 & 0x00000001u;
         /* 02202E74 */ if (_t13) goto L_02202E78; else goto L_02202E80;
   L_02202E78: ; // 0x2202e78
@@ -11675,11 +11675,11 @@ void Gambit_fn_02202E2C(CPUState* cpu) {
         /* 02202E80 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 02202E84 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 02202E84 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 02202E88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02202E88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02202E8C */ _t16 = cpu->r[12] + 0x00000004u;
         /* 02202E8C */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 02202E90 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 02202E94 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02202E94 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02202E94 */ _t18 = _t17 & 0x00000001u;
         /* 02202E94 */ if (_t18) goto L_02202EAC; else goto L_02202E98;
   L_02202E98: ; // 0x2202e98
@@ -11712,18 +11712,18 @@ void Gambit_fn_02202EB4(CPUState* cpu) {
         /* 02202EC8 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02202EC8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02202ECC */ cpu->r[12] = 0x00000000u;
-        /* 02202ED0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02202ED0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02202ED4 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 02202ED4 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02202ED8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202ED8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202ED8 */ _t6 = _t5 & 0x00000001u;
         /* 02202ED8 */ if (_t6) goto L_02202F00; else goto L_02202EDC;
   L_02202EDC: ; // 0x2202edc
         /* 02202EDC */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02202EDC */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02202EE0 */ /* nop */
-        /* 02202EE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 02202EE8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202EE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 02202EE8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202EE8 */ _t9 = _t8 & 0x00000001u;
         /* 02202EE8 */ if (_t9) goto L_02202EEC; else goto L_02202F00;
   L_02202EEC: ; // 0x2202eec
@@ -11764,18 +11764,18 @@ void Gambit_fn_02202EB8(CPUState* cpu) {
         /* 02202EC8 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02202EC8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02202ECC */ cpu->r[12] = 0x00000000u;
-        /* 02202ED0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02202ED0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02202ED4 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 02202ED4 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02202ED8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202ED8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202ED8 */ _t6 = _t5 & 0x00000001u;
         /* 02202ED8 */ if (_t6) goto L_02202F00; else goto L_02202EDC;
   L_02202EDC: ; // 0x2202edc
         /* 02202EDC */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02202EDC */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02202EE0 */ /* nop */
-        /* 02202EE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 02202EE8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202EE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 02202EE8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202EE8 */ _t9 = _t8 & 0x00000001u;
         /* 02202EE8 */ if (_t9) goto L_02202EEC; else goto L_02202F00;
   L_02202EEC: ; // 0x2202eec
@@ -11811,10 +11811,10 @@ void Gambit_fn_02202F24(CPUState* cpu) {
         /* 02202F2C */ _t1 = cpu->r[3] + 0x00000020u;
         /* 02202F2C */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 02202F30 */ cpu->r[8] = cpu->r[0];
-        /* 02202F34 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 02202F34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 02202F38 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 02202F38 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 02202F3C */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02202F3C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02202F3C */ _t4 = _t3 & 0x00000001u;
         /* 02202F3C */ if (_t4) goto L_02202F40; else goto L_02202F58;
   L_02202F40: ; // 0x2202f40
@@ -11822,8 +11822,8 @@ void Gambit_fn_02202F24(CPUState* cpu) {
         /* 02202F44 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 02202F48 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 02202F48 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 02202F4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02202F50 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202F4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02202F50 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202F50 */ _t7 = _t6 & 0x00000001u;
         /* 02202F50 */ if (_t7) goto L_02202F54; else goto L_02202F64;
   L_02202F54: ; // 0x2202f54
@@ -11831,16 +11831,16 @@ void Gambit_fn_02202F24(CPUState* cpu) {
   L_02202F58: ; // 0x2202f58
         /* 02202F58 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 02202F58 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 02202F5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02202F60 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202F5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02202F60 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202F60 */ _t10 = _t9 & 0x00000001u;
         /* 02202F60 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02202F60 */ goto L_02202F64;
   L_02202F64: ; // 0x2202f64
-        /* 02202F64 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 02202F64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 02202F68 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 02202F68 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 02202F6C */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02202F6C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02202F6C */ _t13 = _t12 & 0x00000001u;
         /* 02202F6C */ if (_t13) goto L_02202F70; else goto L_02202F78;
   L_02202F70: ; // 0x2202f70
@@ -11851,11 +11851,11 @@ void Gambit_fn_02202F24(CPUState* cpu) {
         /* 02202F78 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 02202F7C */ _t15 = cpu->r[12] + 0x00000000u;
         /* 02202F7C */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 02202F80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02202F80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02202F84 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 02202F84 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 02202F88 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 02202F8C */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02202F8C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02202F8C */ _t18 = _t17 & 0x00000001u;
         /* 02202F8C */ if (_t18) goto L_02202FA4; else goto L_02202F90;
   L_02202F90: ; // 0x2202f90
@@ -11882,10 +11882,10 @@ void Gambit_fn_02202FAC(CPUState* cpu) {
         /* 02202FB4 */ _t1 = cpu->r[3] + 0x00000030u;
         /* 02202FB4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 02202FB8 */ cpu->r[7] = cpu->r[0];
-        /* 02202FBC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 02202FBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 02202FC0 */ _t2 = cpu->r[3] + 0x00000034u;
         /* 02202FC0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 02202FC4 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02202FC4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02202FC4 */ _t4 = _t3 & 0x00000001u;
         /* 02202FC4 */ if (_t4) goto L_02202FC8; else goto L_02202FE0;
   L_02202FC8: ; // 0x2202fc8
@@ -11893,8 +11893,8 @@ void Gambit_fn_02202FAC(CPUState* cpu) {
         /* 02202FCC */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 02202FD0 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 02202FD0 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 02202FD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02202FD8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202FD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02202FD8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202FD8 */ _t7 = _t6 & 0x00000001u;
         /* 02202FD8 */ if (_t7) goto L_02202FDC; else goto L_02202FEC;
   L_02202FDC: ; // 0x2202fdc
@@ -11902,16 +11902,16 @@ void Gambit_fn_02202FAC(CPUState* cpu) {
   L_02202FE0: ; // 0x2202fe0
         /* 02202FE0 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 02202FE0 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 02202FE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02202FE8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02202FE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02202FE8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02202FE8 */ _t10 = _t9 & 0x00000001u;
         /* 02202FE8 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02202FE8 */ goto L_02202FEC;
   L_02202FEC: ; // 0x2202fec
-        /* 02202FEC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 02202FEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 02202FF0 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 02202FF0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 02202FF4 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02202FF4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02202FF4 */ _t13 = _t12 & 0x00000001u;
         /* 02202FF4 */ if (_t13) goto L_02202FF8; else goto L_02203000;
   L_02202FF8: ; // 0x2202ff8
@@ -11922,11 +11922,11 @@ void Gambit_fn_02202FAC(CPUState* cpu) {
         /* 02203000 */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 02203004 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 02203004 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 02203008 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02203008 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0220300C */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0220300C */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 02203010 */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 02203014 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02203014 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02203014 */ _t18 = _t17 & 0x00000001u;
         /* 02203014 */ if (_t18) goto L_0220302C; else goto L_02203018;
   L_02203018: ; // 0x2203018
@@ -11961,9 +11961,9 @@ void Gambit_fn_02203034(CPUState* cpu) {
         /* 0220304C */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 0220304C */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 02203050 */ /* nop */
-        /* 02203054 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 02203054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 02203058 */ cpu->r[31] = cpu->r[4];
-        /* 0220305C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220305C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220305C */ _t6 = _t5 & 0x00000001u;
         /* 0220305C */ if (_t6) goto L_02203060; else goto L_02203074;
   L_02203060: ; // 0x2203060
@@ -12012,9 +12012,9 @@ void Gambit_fn_02203038(CPUState* cpu) {
         /* 0220304C */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 0220304C */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 02203050 */ /* nop */
-        /* 02203054 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 02203054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 02203058 */ cpu->r[31] = cpu->r[4];
-        /* 0220305C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220305C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220305C */ _t6 = _t5 & 0x00000001u;
         /* 0220305C */ if (_t6) goto L_02203060; else goto L_02203074;
   L_02203060: ; // 0x2203060
@@ -12056,18 +12056,18 @@ void Gambit_fn_022030B0(CPUState* cpu) {
         /* 022030B4 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 022030B4 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 022030B8 */ cpu->r[31] = cpu->r[3];
-        /* 022030B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 022030B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 022030BC */ _t2 = cpu->r[1] + 0x00000014u;
         /* 022030BC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 022030C0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022030C0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022030C0 */ _t4 = _t3 & 0x00000001u;
         /* 022030C0 */ if (_t4) goto L_022030C4; else goto L_022030D4;
   L_022030C4: ; // 0x22030c4
         /* 022030C4 */ cpu->r[3] = 0x00000180u;
         /* 022030C8 */ Gambit_fn_02801A78(cpu);
         /* 022030CC */ cpu->r[31] = cpu->r[3];
-        /* 022030CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022030D0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022030CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022030D0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022030D0 */ _t6 = _t5 & 0x00000001u;
         /* 022030D0 */ if (_t6) goto L_02203100; else goto L_022030D4;
   L_022030D4: ; // 0x22030d4
@@ -12436,8 +12436,8 @@ void Gambit_fn_02203248(CPUState* cpu) {
         /* 022032A0 */ _t14 = cpu->r[31] + 0x00000174u;
         /* 022032A0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t14);
         /* 022032A4 */ cpu->f[13] = cpu->f[0] + cpu->f[1];
-        /* 022032A8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[12]);
-        /* 022032AC */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022032A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[12]));
+        /* 022032AC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022032AC */ _t16 = _t15 & 0x00000001u;
         /* 022032AC */ if (_t16) goto L_022032B0; else goto L_022032D0;
   L_022032B0: ; // 0x22032b0
@@ -12519,8 +12519,8 @@ void Gambit_fn_0220324C(CPUState* cpu) {
         /* 022032A0 */ _t14 = cpu->r[31] + 0x00000174u;
         /* 022032A0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t14);
         /* 022032A4 */ cpu->f[13] = cpu->f[0] + cpu->f[1];
-        /* 022032A8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[12]);
-        /* 022032AC */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022032A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[12]));
+        /* 022032AC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022032AC */ _t16 = _t15 & 0x00000001u;
         /* 022032AC */ if (_t16) goto L_022032B0; else goto L_022032D0;
   L_022032B0: ; // 0x22032b0
@@ -12576,21 +12576,21 @@ void Gambit_fn_02203304(CPUState* cpu) {
         /* 02203318 */ Gambit_fn_0222F028(cpu);
         /* 0220331C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0220331C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 02203320 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02203324 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203320 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02203324 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203324 */ _t5 = _t4 & 0x00000001u;
         /* 02203324 */ if (_t5) goto L_02203330; else goto L_02203328;
   L_02203328: ; // 0x2203328
-        /* 02203328 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 0220332C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203328 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 0220332C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220332C */ _t7 = _t6 & 0x00000001u;
         /* 0220332C */ if (_t7) goto L_02203330; else goto L_022033E0;
   L_02203330: ; // 0x2203330
         /* 02203330 */ _t8 = cpu->r[31] + 0x00000114u;
         /* 02203330 */ cpu->r[11] = rbrew_read32(cpu->mem, _t8);
         /* 02203334 */ cpu->r[11] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 02203334 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02203338 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203334 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02203338 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203338 */ _t10 = _t9 & 0x00000001u;
         /* 02203338 */ if (_t10) goto L_0220333C; else goto L_022033D8;
   L_0220333C: ; // 0x220333c
@@ -12610,8 +12610,8 @@ void Gambit_fn_02203304(CPUState* cpu) {
         /* 02203360 */ cpu->f[8] = fma(cpu->f[11], cpu->f[11], cpu->f[0]);
         /* 02203364 */ _t15 = cpu->r[7] + 0xFFFFEF84u;
         /* 02203364 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t15);
-        /* 02203368 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
-        /* 0220336C */ _t16 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02203368 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
+        /* 0220336C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220336C */ _t17 = _t16 & 0x00000001u;
         /* 0220336C */ if (_t17) goto L_02203370; else goto L_02203394;
   L_02203370: ; // 0x2203370
@@ -12638,10 +12638,10 @@ void Gambit_fn_02203304(CPUState* cpu) {
         /* 022033A0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t24);
         /* 022033A4 */ cpu->f[10] = cpu->f[12] * cpu->f[11];
         /* 022033A8 */ cpu->f[13] = fma(cpu->f[0], cpu->f[8], cpu->f[13]);
-        /* 022033AC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[10]);
+        /* 022033AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[10]));
         /* 022033B0 */ _t25 = cpu->r[31] + 0x00000178u;
         /* 022033B0 */ rbrew_write_f32(cpu->mem, _t25, cpu->f[13]);
-        /* 022033B4 */ _t26 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022033B4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022033B4 */ _t27 = _t26 & 0x00000001u;
         /* 022033B4 */ if (_t27) goto L_022033CC; else goto L_022033B8;
   L_022033B8: ; // 0x22033b8
@@ -12656,8 +12656,8 @@ void Gambit_fn_02203304(CPUState* cpu) {
         /* 022033CC */ _t30 = cpu->r[31] + 0x00000114u;
         /* 022033CC */ cpu->r[10] = rbrew_read32(cpu->mem, _t30);
         /* 022033D0 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 022033D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 022033D4 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022033D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 022033D4 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022033D4 */ _t32 = _t31 & 0x00000001u;
         /* 022033D4 */ if (_t32) goto L_022033E0; else goto L_022033D8;
   L_022033D8: ; // 0x22033d8
@@ -12690,21 +12690,21 @@ void Gambit_fn_02203308(CPUState* cpu) {
         /* 02203318 */ Gambit_fn_0222F028(cpu);
         /* 0220331C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0220331C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 02203320 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02203324 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203320 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02203324 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203324 */ _t5 = _t4 & 0x00000001u;
         /* 02203324 */ if (_t5) goto L_02203330; else goto L_02203328;
   L_02203328: ; // 0x2203328
-        /* 02203328 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 0220332C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203328 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 0220332C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220332C */ _t7 = _t6 & 0x00000001u;
         /* 0220332C */ if (_t7) goto L_02203330; else goto L_022033E0;
   L_02203330: ; // 0x2203330
         /* 02203330 */ _t8 = cpu->r[31] + 0x00000114u;
         /* 02203330 */ cpu->r[11] = rbrew_read32(cpu->mem, _t8);
         /* 02203334 */ cpu->r[11] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 02203334 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02203338 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203334 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02203338 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203338 */ _t10 = _t9 & 0x00000001u;
         /* 02203338 */ if (_t10) goto L_0220333C; else goto L_022033D8;
   L_0220333C: ; // 0x220333c
@@ -12724,8 +12724,8 @@ void Gambit_fn_02203308(CPUState* cpu) {
         /* 02203360 */ cpu->f[8] = fma(cpu->f[11], cpu->f[11], cpu->f[0]);
         /* 02203364 */ _t15 = cpu->r[7] + 0xFFFFEF84u;
         /* 02203364 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t15);
-        /* 02203368 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
-        /* 0220336C */ _t16 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02203368 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
+        /* 0220336C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220336C */ _t17 = _t16 & 0x00000001u;
         /* 0220336C */ if (_t17) goto L_02203370; else goto L_02203394;
   L_02203370: ; // 0x2203370
@@ -12752,10 +12752,10 @@ void Gambit_fn_02203308(CPUState* cpu) {
         /* 022033A0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t24);
         /* 022033A4 */ cpu->f[10] = cpu->f[12] * cpu->f[11];
         /* 022033A8 */ cpu->f[13] = fma(cpu->f[0], cpu->f[8], cpu->f[13]);
-        /* 022033AC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[10]);
+        /* 022033AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[10]));
         /* 022033B0 */ _t25 = cpu->r[31] + 0x00000178u;
         /* 022033B0 */ rbrew_write_f32(cpu->mem, _t25, cpu->f[13]);
-        /* 022033B4 */ _t26 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022033B4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022033B4 */ _t27 = _t26 & 0x00000001u;
         /* 022033B4 */ if (_t27) goto L_022033CC; else goto L_022033B8;
   L_022033B8: ; // 0x22033b8
@@ -12770,8 +12770,8 @@ void Gambit_fn_02203308(CPUState* cpu) {
         /* 022033CC */ _t30 = cpu->r[31] + 0x00000114u;
         /* 022033CC */ cpu->r[10] = rbrew_read32(cpu->mem, _t30);
         /* 022033D0 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 022033D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 022033D4 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022033D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 022033D4 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022033D4 */ _t32 = _t31 & 0x00000001u;
         /* 022033D4 */ if (_t32) goto L_022033E0; else goto L_022033D8;
   L_022033D8: ; // 0x22033d8
@@ -12854,8 +12854,8 @@ void Gambit_fn_02203420(CPUState* cpu) {
         /* 02203420 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02203420 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02203424 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 02203424 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02203428 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203424 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02203428 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203428 */ _t2 = _t1 & 0x00000001u;
         /* 02203428 */ _t3 = _t2 ^ 0x00000001u;
         /* 02203428 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -12877,8 +12877,8 @@ void Gambit_fn_0220343C(CPUState* cpu) {
         /* 0220343C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0220343C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02203440 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 02203440 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02203444 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203440 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02203444 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203444 */ _t2 = _t1 & 0x00000001u;
         /* 02203444 */ _t3 = _t2 ^ 0x00000001u;
         /* 02203444 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -12900,8 +12900,8 @@ void Gambit_fn_02203458(CPUState* cpu) {
         /* 02203458 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02203458 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0220345C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 0220345C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02203460 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220345C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02203460 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203460 */ _t2 = _t1 & 0x00000001u;
         /* 02203460 */ _t3 = _t2 ^ 0x00000001u;
         /* 02203460 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -12944,8 +12944,8 @@ void Gambit_fn_02203484(CPUState* cpu) {
         /* 02203494 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02203498 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02203498 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0220349C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 022034A0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220349C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 022034A0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022034A0 */ _t5 = _t4 & 0x00000001u;
         /* 022034A0 */ if (_t5) goto L_022034A4; else goto L_022034C0;
   L_022034A4: ; // 0x22034a4
@@ -12984,8 +12984,8 @@ void Gambit_fn_02203488(CPUState* cpu) {
         /* 02203494 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02203498 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02203498 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0220349C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 022034A0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220349C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 022034A0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022034A0 */ _t5 = _t4 & 0x00000001u;
         /* 022034A0 */ if (_t5) goto L_022034A4; else goto L_022034C0;
   L_022034A4: ; // 0x22034a4
@@ -13436,8 +13436,8 @@ void Gambit_fn_02203690(CPUState* cpu) {
         /* 02203690 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 02203690 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02203694 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 02203694 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02203698 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203694 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02203698 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203698 */ _t2 = _t1 & 0x00000001u;
         /* 02203698 */ if (_t2) goto L_022036A8; else goto L_0220369C;
   L_0220369C: ; // 0x220369c
@@ -13466,8 +13466,8 @@ void Gambit_fn_022036B4(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -13562,9 +13562,9 @@ void Gambit_fn_02203704(CPUState* cpu) {
         /* 02203708 */ _t0 = cpu->r[8] + 0xFFFFFDA8u;
         /* 02203708 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 0220370C */ cpu->r[6] = 0x101D0000u;
-        /* 02203710 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02203710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02203714 */ cpu->r[6] = cpu->r[6] + 0xFFFFFE9Cu;
-        /* 02203718 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203718 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203718 */ _t2 = _t1 & 0x00000001u;
         /* 02203718 */ if (_t2) goto L_0220371C; else goto L_02203734;
   L_0220371C: ; // 0x220371c
@@ -13577,8 +13577,8 @@ void Gambit_fn_02203704(CPUState* cpu) {
         /* 02203730 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 02203730 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_02203734: ; // 0x2203734
-        /* 02203734 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 02203738 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203734 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 02203738 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203738 */ _t6 = _t5 & 0x00000001u;
         /* 02203738 */ if (_t6) goto L_0220373C; else goto L_02203744;
   L_0220373C: ; // 0x220373c
@@ -13589,9 +13589,9 @@ void Gambit_fn_02203704(CPUState* cpu) {
         /* 02203748 */ _t7 = cpu->r[10] + 0xFFFFDA0Cu;
         /* 02203748 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 0220374C */ cpu->r[8] = 0x101D0000u;
-        /* 02203750 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02203750 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02203754 */ cpu->r[8] = cpu->r[8] + 0xFFFFFC00u;
-        /* 02203758 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203758 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203758 */ _t9 = _t8 & 0x00000001u;
         /* 02203758 */ if (_t9) goto L_0220375C; else goto L_02203774;
   L_0220375C: ; // 0x220375c
@@ -13604,8 +13604,8 @@ void Gambit_fn_02203704(CPUState* cpu) {
         /* 02203770 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 02203770 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_02203774: ; // 0x2203774
-        /* 02203774 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02203778 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203774 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02203778 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203778 */ _t13 = _t12 & 0x00000001u;
         /* 02203778 */ if (_t13) goto L_0220377C; else goto L_02203784;
   L_0220377C: ; // 0x220377c
@@ -13616,9 +13616,9 @@ void Gambit_fn_02203704(CPUState* cpu) {
         /* 02203788 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 02203788 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 0220378C */ cpu->r[10] = 0x101D0000u;
-        /* 02203790 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02203790 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02203794 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 02203798 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203798 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203798 */ _t16 = _t15 & 0x00000001u;
         /* 02203798 */ if (_t16) goto L_0220379C; else goto L_022037B4;
   L_0220379C: ; // 0x220379c
@@ -13631,8 +13631,8 @@ void Gambit_fn_02203704(CPUState* cpu) {
         /* 022037B0 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 022037B0 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_022037B4: ; // 0x22037b4
-        /* 022037B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 022037B8 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022037B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 022037B8 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022037B8 */ _t20 = _t19 & 0x00000001u;
         /* 022037B8 */ if (_t20) goto L_022037BC; else goto L_022037C4;
   L_022037BC: ; // 0x22037bc
@@ -13643,9 +13643,9 @@ void Gambit_fn_02203704(CPUState* cpu) {
         /* 022037C8 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 022037C8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 022037CC */ cpu->r[12] = 0x101D0000u;
-        /* 022037D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 022037D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 022037D4 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 022037D8 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022037D8 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022037D8 */ _t23 = _t22 & 0x00000001u;
         /* 022037D8 */ if (_t23) goto L_022037DC; else goto L_022037F4;
   L_022037DC: ; // 0x22037dc
@@ -13658,8 +13658,8 @@ void Gambit_fn_02203704(CPUState* cpu) {
         /* 022037F0 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 022037F0 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_022037F4: ; // 0x22037f4
-        /* 022037F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 022037F8 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022037F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 022037F8 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022037F8 */ _t27 = _t26 & 0x00000001u;
         /* 022037F8 */ if (_t27) goto L_022037FC; else goto L_02203804;
   L_022037FC: ; // 0x22037fc
@@ -13671,9 +13671,9 @@ void Gambit_fn_02203704(CPUState* cpu) {
         /* 02203808 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 02203808 */ cpu->r[10] = _t28;
         /* 0220380C */ cpu->r[7] = 0x101D0000u;
-        /* 02203810 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02203810 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02203814 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 02203818 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203818 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203818 */ _t30 = _t29 & 0x00000001u;
         /* 02203818 */ if (_t30) goto L_0220381C; else goto L_02203830;
   L_0220381C: ; // 0x220381c
@@ -13685,8 +13685,8 @@ void Gambit_fn_02203704(CPUState* cpu) {
         /* 0220382C */ _t32 = cpu->r[7] + 0x00000000u;
         /* 0220382C */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_02203830: ; // 0x2203830
-        /* 02203830 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 02203834 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203830 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 02203834 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203834 */ _t34 = _t33 & 0x00000001u;
         /* 02203834 */ if (_t34) goto L_02203838; else goto L_02203840;
   L_02203838: ; // 0x2203838
@@ -13698,9 +13698,9 @@ void Gambit_fn_02203704(CPUState* cpu) {
         /* 02203844 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 02203844 */ cpu->r[8] = _t35;
         /* 02203848 */ cpu->r[6] = 0x101D0000u;
-        /* 0220384C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0220384C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02203850 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 02203854 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203854 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203854 */ _t37 = _t36 & 0x00000001u;
         /* 02203854 */ if (_t37) goto L_02203858; else goto L_0220386C;
   L_02203858: ; // 0x2203858
@@ -13752,18 +13752,18 @@ void Gambit_fn_02203898(CPUState* cpu) {
         /* 0220389C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0220389C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 022038A0 */ cpu->r[31] = cpu->r[3];
-        /* 022038A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 022038A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 022038A4 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 022038A4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 022038A8 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022038A8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022038A8 */ _t4 = _t3 & 0x00000001u;
         /* 022038A8 */ if (_t4) goto L_022038AC; else goto L_022038BC;
   L_022038AC: ; // 0x22038ac
         /* 022038AC */ cpu->r[3] = 0x00000180u;
         /* 022038B0 */ Gambit_fn_02801A78(cpu);
         /* 022038B4 */ cpu->r[31] = cpu->r[3];
-        /* 022038B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022038B8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022038B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022038B8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022038B8 */ _t6 = _t5 & 0x00000001u;
         /* 022038B8 */ if (_t6) goto L_022038E8; else goto L_022038BC;
   L_022038BC: ; // 0x22038bc
@@ -14132,8 +14132,8 @@ void Gambit_fn_02203A30(CPUState* cpu) {
         /* 02203A88 */ _t14 = cpu->r[31] + 0x00000174u;
         /* 02203A88 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t14);
         /* 02203A8C */ cpu->f[13] = cpu->f[0] + cpu->f[1];
-        /* 02203A90 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[12]);
-        /* 02203A94 */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02203A90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[12]));
+        /* 02203A94 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02203A94 */ _t16 = _t15 & 0x00000001u;
         /* 02203A94 */ if (_t16) goto L_02203A98; else goto L_02203AB8;
   L_02203A98: ; // 0x2203a98
@@ -14215,8 +14215,8 @@ void Gambit_fn_02203A34(CPUState* cpu) {
         /* 02203A88 */ _t14 = cpu->r[31] + 0x00000174u;
         /* 02203A88 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t14);
         /* 02203A8C */ cpu->f[13] = cpu->f[0] + cpu->f[1];
-        /* 02203A90 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[12]);
-        /* 02203A94 */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02203A90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[12]));
+        /* 02203A94 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02203A94 */ _t16 = _t15 & 0x00000001u;
         /* 02203A94 */ if (_t16) goto L_02203A98; else goto L_02203AB8;
   L_02203A98: ; // 0x2203a98
@@ -14272,21 +14272,21 @@ void Gambit_fn_02203AEC(CPUState* cpu) {
         /* 02203B00 */ Gambit_fn_0222F028(cpu);
         /* 02203B04 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02203B04 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 02203B08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02203B0C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203B08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02203B0C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203B0C */ _t5 = _t4 & 0x00000001u;
         /* 02203B0C */ if (_t5) goto L_02203B18; else goto L_02203B10;
   L_02203B10: ; // 0x2203b10
-        /* 02203B10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 02203B14 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203B10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 02203B14 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203B14 */ _t7 = _t6 & 0x00000001u;
         /* 02203B14 */ if (_t7) goto L_02203B18; else goto L_02203BC8;
   L_02203B18: ; // 0x2203b18
         /* 02203B18 */ _t8 = cpu->r[31] + 0x00000114u;
         /* 02203B18 */ cpu->r[11] = rbrew_read32(cpu->mem, _t8);
         /* 02203B1C */ cpu->r[11] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 02203B1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02203B20 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203B1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02203B20 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203B20 */ _t10 = _t9 & 0x00000001u;
         /* 02203B20 */ if (_t10) goto L_02203B24; else goto L_02203BC0;
   L_02203B24: ; // 0x2203b24
@@ -14306,8 +14306,8 @@ void Gambit_fn_02203AEC(CPUState* cpu) {
         /* 02203B48 */ cpu->f[8] = fma(cpu->f[11], cpu->f[11], cpu->f[0]);
         /* 02203B4C */ _t15 = cpu->r[7] + 0xFFFFF49Cu;
         /* 02203B4C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t15);
-        /* 02203B50 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
-        /* 02203B54 */ _t16 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02203B50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
+        /* 02203B54 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02203B54 */ _t17 = _t16 & 0x00000001u;
         /* 02203B54 */ if (_t17) goto L_02203B58; else goto L_02203B7C;
   L_02203B58: ; // 0x2203b58
@@ -14334,10 +14334,10 @@ void Gambit_fn_02203AEC(CPUState* cpu) {
         /* 02203B88 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t24);
         /* 02203B8C */ cpu->f[10] = cpu->f[12] * cpu->f[11];
         /* 02203B90 */ cpu->f[13] = fma(cpu->f[0], cpu->f[8], cpu->f[13]);
-        /* 02203B94 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[10]);
+        /* 02203B94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[10]));
         /* 02203B98 */ _t25 = cpu->r[31] + 0x00000178u;
         /* 02203B98 */ rbrew_write_f32(cpu->mem, _t25, cpu->f[13]);
-        /* 02203B9C */ _t26 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02203B9C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02203B9C */ _t27 = _t26 & 0x00000001u;
         /* 02203B9C */ if (_t27) goto L_02203BB4; else goto L_02203BA0;
   L_02203BA0: ; // 0x2203ba0
@@ -14352,8 +14352,8 @@ void Gambit_fn_02203AEC(CPUState* cpu) {
         /* 02203BB4 */ _t30 = cpu->r[31] + 0x00000114u;
         /* 02203BB4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t30);
         /* 02203BB8 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 02203BB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02203BBC */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203BB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02203BBC */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203BBC */ _t32 = _t31 & 0x00000001u;
         /* 02203BBC */ if (_t32) goto L_02203BC8; else goto L_02203BC0;
   L_02203BC0: ; // 0x2203bc0
@@ -14386,21 +14386,21 @@ void Gambit_fn_02203AF0(CPUState* cpu) {
         /* 02203B00 */ Gambit_fn_0222F028(cpu);
         /* 02203B04 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02203B04 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 02203B08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02203B0C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203B08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02203B0C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203B0C */ _t5 = _t4 & 0x00000001u;
         /* 02203B0C */ if (_t5) goto L_02203B18; else goto L_02203B10;
   L_02203B10: ; // 0x2203b10
-        /* 02203B10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 02203B14 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203B10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 02203B14 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203B14 */ _t7 = _t6 & 0x00000001u;
         /* 02203B14 */ if (_t7) goto L_02203B18; else goto L_02203BC8;
   L_02203B18: ; // 0x2203b18
         /* 02203B18 */ _t8 = cpu->r[31] + 0x00000114u;
         /* 02203B18 */ cpu->r[11] = rbrew_read32(cpu->mem, _t8);
         /* 02203B1C */ cpu->r[11] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 02203B1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02203B20 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203B1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02203B20 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203B20 */ _t10 = _t9 & 0x00000001u;
         /* 02203B20 */ if (_t10) goto L_02203B24; else goto L_02203BC0;
   L_02203B24: ; // 0x2203b24
@@ -14420,8 +14420,8 @@ void Gambit_fn_02203AF0(CPUState* cpu) {
         /* 02203B48 */ cpu->f[8] = fma(cpu->f[11], cpu->f[11], cpu->f[0]);
         /* 02203B4C */ _t15 = cpu->r[7] + 0xFFFFF49Cu;
         /* 02203B4C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t15);
-        /* 02203B50 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
-        /* 02203B54 */ _t16 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02203B50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
+        /* 02203B54 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02203B54 */ _t17 = _t16 & 0x00000001u;
         /* 02203B54 */ if (_t17) goto L_02203B58; else goto L_02203B7C;
   L_02203B58: ; // 0x2203b58
@@ -14448,10 +14448,10 @@ void Gambit_fn_02203AF0(CPUState* cpu) {
         /* 02203B88 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t24);
         /* 02203B8C */ cpu->f[10] = cpu->f[12] * cpu->f[11];
         /* 02203B90 */ cpu->f[13] = fma(cpu->f[0], cpu->f[8], cpu->f[13]);
-        /* 02203B94 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[10]);
+        /* 02203B94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[10]));
         /* 02203B98 */ _t25 = cpu->r[31] + 0x00000178u;
         /* 02203B98 */ rbrew_write_f32(cpu->mem, _t25, cpu->f[13]);
-        /* 02203B9C */ _t26 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02203B9C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02203B9C */ _t27 = _t26 & 0x00000001u;
         /* 02203B9C */ if (_t27) goto L_02203BB4; else goto L_02203BA0;
   L_02203BA0: ; // 0x2203ba0
@@ -14466,8 +14466,8 @@ void Gambit_fn_02203AF0(CPUState* cpu) {
         /* 02203BB4 */ _t30 = cpu->r[31] + 0x00000114u;
         /* 02203BB4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t30);
         /* 02203BB8 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 02203BB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02203BBC */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203BB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02203BBC */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203BBC */ _t32 = _t31 & 0x00000001u;
         /* 02203BBC */ if (_t32) goto L_02203BC8; else goto L_02203BC0;
   L_02203BC0: ; // 0x2203bc0
@@ -14490,18 +14490,18 @@ void Gambit_fn_02203BDC(CPUState* cpu) {
   L_02203BDC: ; // 0x2203bdc
         /* 02203BDC */ _t0 = cpu->r[3] + 0x0000017Cu;
         /* 02203BDC */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 02203BE0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], 0x0000001Eu);
-        /* 02203BE4 */ _t1 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02203BE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], 0x0000001Eu));
+        /* 02203BE4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02203BE4 */ _t2 = _t1 & 0x00000001u;
         /* 02203BE4 */ if (_t2) goto L_02203C10; else goto L_02203BE8;
   L_02203BE8: ; // 0x2203be8
-        /* 02203BE8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], 0x00000024u);
-        /* 02203BEC */ _t3 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02203BE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], 0x00000024u));
+        /* 02203BEC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02203BEC */ _t4 = _t3 & 0x00000001u;
         /* 02203BEC */ if (_t4) goto L_02203BF0; else goto L_02203C00;
   L_02203BF0: ; // 0x2203bf0
-        /* 02203BF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], 0x0000003Du);
-        /* 02203BF4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203BF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], 0x0000003Du));
+        /* 02203BF4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203BF4 */ _t6 = _t5 & 0x00000001u;
         /* 02203BF4 */ if (_t6) goto L_02203C08; else goto L_02203BF8;
   L_02203BF8: ; // 0x2203bf8
@@ -14574,8 +14574,8 @@ void Gambit_fn_02203C38(CPUState* cpu) {
         /* 02203C38 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02203C38 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02203C3C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 02203C3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02203C40 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203C3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02203C40 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203C40 */ _t2 = _t1 & 0x00000001u;
         /* 02203C40 */ _t3 = _t2 ^ 0x00000001u;
         /* 02203C40 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -14597,8 +14597,8 @@ void Gambit_fn_02203C54(CPUState* cpu) {
         /* 02203C54 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02203C54 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02203C58 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 02203C58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02203C5C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203C58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02203C5C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203C5C */ _t2 = _t1 & 0x00000001u;
         /* 02203C5C */ _t3 = _t2 ^ 0x00000001u;
         /* 02203C5C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -14620,8 +14620,8 @@ void Gambit_fn_02203C70(CPUState* cpu) {
         /* 02203C70 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02203C70 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02203C74 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 02203C74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02203C78 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203C74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02203C78 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203C78 */ _t2 = _t1 & 0x00000001u;
         /* 02203C78 */ _t3 = _t2 ^ 0x00000001u;
         /* 02203C78 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -14664,8 +14664,8 @@ void Gambit_fn_02203C9C(CPUState* cpu) {
         /* 02203CAC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02203CB0 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02203CB0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02203CB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02203CB8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203CB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02203CB8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203CB8 */ _t5 = _t4 & 0x00000001u;
         /* 02203CB8 */ if (_t5) goto L_02203CBC; else goto L_02203CD8;
   L_02203CBC: ; // 0x2203cbc
@@ -14704,8 +14704,8 @@ void Gambit_fn_02203CA0(CPUState* cpu) {
         /* 02203CAC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02203CB0 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02203CB0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02203CB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02203CB8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203CB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02203CB8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203CB8 */ _t5 = _t4 & 0x00000001u;
         /* 02203CB8 */ if (_t5) goto L_02203CBC; else goto L_02203CD8;
   L_02203CBC: ; // 0x2203cbc
@@ -15156,8 +15156,8 @@ void Gambit_fn_02203EA8(CPUState* cpu) {
         /* 02203EA8 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 02203EA8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02203EAC */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 02203EAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02203EB0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203EAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02203EB0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203EB0 */ _t2 = _t1 & 0x00000001u;
         /* 02203EB0 */ if (_t2) goto L_02203EC0; else goto L_02203EB4;
   L_02203EB4: ; // 0x2203eb4
@@ -15186,8 +15186,8 @@ void Gambit_fn_02203ECC(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -15282,9 +15282,9 @@ void Gambit_fn_02203F1C(CPUState* cpu) {
         /* 02203F20 */ _t0 = cpu->r[8] + 0xFFFFFC94u;
         /* 02203F20 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 02203F24 */ cpu->r[6] = 0x101D0000u;
-        /* 02203F28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02203F28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02203F2C */ cpu->r[6] = cpu->r[6] + 0xFFFFFEA0u;
-        /* 02203F30 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203F30 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203F30 */ _t2 = _t1 & 0x00000001u;
         /* 02203F30 */ if (_t2) goto L_02203F34; else goto L_02203F4C;
   L_02203F34: ; // 0x2203f34
@@ -15297,8 +15297,8 @@ void Gambit_fn_02203F1C(CPUState* cpu) {
         /* 02203F48 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 02203F48 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_02203F4C: ; // 0x2203f4c
-        /* 02203F4C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 02203F50 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203F4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 02203F50 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203F50 */ _t6 = _t5 & 0x00000001u;
         /* 02203F50 */ if (_t6) goto L_02203F54; else goto L_02203F5C;
   L_02203F54: ; // 0x2203f54
@@ -15309,9 +15309,9 @@ void Gambit_fn_02203F1C(CPUState* cpu) {
         /* 02203F60 */ _t7 = cpu->r[10] + 0xFFFFDA0Cu;
         /* 02203F60 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 02203F64 */ cpu->r[8] = 0x101D0000u;
-        /* 02203F68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02203F68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02203F6C */ cpu->r[8] = cpu->r[8] + 0xFFFFFC00u;
-        /* 02203F70 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203F70 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203F70 */ _t9 = _t8 & 0x00000001u;
         /* 02203F70 */ if (_t9) goto L_02203F74; else goto L_02203F8C;
   L_02203F74: ; // 0x2203f74
@@ -15324,8 +15324,8 @@ void Gambit_fn_02203F1C(CPUState* cpu) {
         /* 02203F88 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 02203F88 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_02203F8C: ; // 0x2203f8c
-        /* 02203F8C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02203F90 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203F8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02203F90 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203F90 */ _t13 = _t12 & 0x00000001u;
         /* 02203F90 */ if (_t13) goto L_02203F94; else goto L_02203F9C;
   L_02203F94: ; // 0x2203f94
@@ -15336,9 +15336,9 @@ void Gambit_fn_02203F1C(CPUState* cpu) {
         /* 02203FA0 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 02203FA0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 02203FA4 */ cpu->r[10] = 0x101D0000u;
-        /* 02203FA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02203FA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02203FAC */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 02203FB0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203FB0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203FB0 */ _t16 = _t15 & 0x00000001u;
         /* 02203FB0 */ if (_t16) goto L_02203FB4; else goto L_02203FCC;
   L_02203FB4: ; // 0x2203fb4
@@ -15351,8 +15351,8 @@ void Gambit_fn_02203F1C(CPUState* cpu) {
         /* 02203FC8 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 02203FC8 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_02203FCC: ; // 0x2203fcc
-        /* 02203FCC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02203FD0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203FCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02203FD0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203FD0 */ _t20 = _t19 & 0x00000001u;
         /* 02203FD0 */ if (_t20) goto L_02203FD4; else goto L_02203FDC;
   L_02203FD4: ; // 0x2203fd4
@@ -15363,9 +15363,9 @@ void Gambit_fn_02203F1C(CPUState* cpu) {
         /* 02203FE0 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 02203FE0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 02203FE4 */ cpu->r[12] = 0x101D0000u;
-        /* 02203FE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02203FE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02203FEC */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 02203FF0 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02203FF0 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02203FF0 */ _t23 = _t22 & 0x00000001u;
         /* 02203FF0 */ if (_t23) goto L_02203FF4; else goto L_0220400C;
   L_02203FF4: ; // 0x2203ff4
@@ -15378,8 +15378,8 @@ void Gambit_fn_02203F1C(CPUState* cpu) {
         /* 02204008 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 02204008 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_0220400C: ; // 0x220400c
-        /* 0220400C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02204010 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220400C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02204010 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02204010 */ _t27 = _t26 & 0x00000001u;
         /* 02204010 */ if (_t27) goto L_02204014; else goto L_0220401C;
   L_02204014: ; // 0x2204014
@@ -15391,9 +15391,9 @@ void Gambit_fn_02203F1C(CPUState* cpu) {
         /* 02204020 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 02204020 */ cpu->r[10] = _t28;
         /* 02204024 */ cpu->r[7] = 0x101D0000u;
-        /* 02204028 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02204028 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220402C */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 02204030 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02204030 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02204030 */ _t30 = _t29 & 0x00000001u;
         /* 02204030 */ if (_t30) goto L_02204034; else goto L_02204048;
   L_02204034: ; // 0x2204034
@@ -15405,8 +15405,8 @@ void Gambit_fn_02203F1C(CPUState* cpu) {
         /* 02204044 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 02204044 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_02204048: ; // 0x2204048
-        /* 02204048 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 0220404C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02204048 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 0220404C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220404C */ _t34 = _t33 & 0x00000001u;
         /* 0220404C */ if (_t34) goto L_02204050; else goto L_02204058;
   L_02204050: ; // 0x2204050
@@ -15418,9 +15418,9 @@ void Gambit_fn_02203F1C(CPUState* cpu) {
         /* 0220405C */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 0220405C */ cpu->r[8] = _t35;
         /* 02204060 */ cpu->r[6] = 0x101D0000u;
-        /* 02204064 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02204064 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02204068 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 0220406C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220406C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220406C */ _t37 = _t36 & 0x00000001u;
         /* 0220406C */ if (_t37) goto L_02204070; else goto L_02204084;
   L_02204070: ; // 0x2204070
@@ -15495,7 +15495,7 @@ void Gambit_fn_022040AC(CPUState* cpu) {
         /* 022040EC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t8);
         /* 022040F0 */ _t9 = cpu->r[1] + 0x00000008u;
         /* 022040F0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t9);
-        /* 022040F4 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022040F4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022040F4 */ _t11 = _t10 & 0x00000001u;
         /* 022040F4 */ if (_t11) goto L_022040F8; // else: addr-0 trap, fall-through
   L_022040F8: ; // 0x22040f8
@@ -15539,7 +15539,7 @@ void Gambit_fn_022040B0(CPUState* cpu) {
         /* 022040EC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t8);
         /* 022040F0 */ _t9 = cpu->r[1] + 0x00000008u;
         /* 022040F0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t9);
-        /* 022040F4 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022040F4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022040F4 */ _t11 = _t10 & 0x00000001u;
         /* 022040F4 */ if (_t11) goto L_022040F8; // else: addr-0 trap, fall-through
   L_022040F8: ; // 0x22040f8
@@ -15601,12 +15601,12 @@ void Gambit_fn_02204108(CPUState* cpu) {
         /* 02204164 */ cpu->f[6] = fma(cpu->f[11], cpu->f[11], cpu->f[7]);
         /* 02204168 */ _t18 = cpu->r[3] + 0x00000008u;
         /* 02204168 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t18);
-        /* 0220416C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 0220416C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 02204170 */ _t19 = cpu->r[1] + 0x00000008u;
         /* 02204170 */ rbrew_write_f32(cpu->mem, _t19, cpu->f[13]);
         /* 02204174 */ _t20 = cpu->r[1] + 0x0000000Cu;
         /* 02204174 */ rbrew_write_f32(cpu->mem, _t20, cpu->f[0]);
-        /* 02204178 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02204178 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02204178 */ _t22 = _t21 & 0x00000001u;
         /* 02204178 */ if (_t22) goto L_022041A4; else goto L_0220417C;
   L_0220417C: ; // 0x220417c
@@ -15654,7 +15654,7 @@ void Gambit_fn_02204108(CPUState* cpu) {
         /* 022041FC */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t29);
         /* 02204200 */ _t30 = cpu->r[1] + 0x00000030u;
         /* 02204200 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t30);
-        /* 02204204 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204204 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204204 */ _t32 = _t31 & 0x00000001u;
         /* 02204204 */ if (_t32) goto L_02204208; // else: addr-0 trap, fall-through
   L_02204208: ; // 0x2204208
@@ -15715,12 +15715,12 @@ void Gambit_fn_0220410C(CPUState* cpu) {
         /* 02204164 */ cpu->f[6] = fma(cpu->f[11], cpu->f[11], cpu->f[7]);
         /* 02204168 */ _t18 = cpu->r[3] + 0x00000008u;
         /* 02204168 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t18);
-        /* 0220416C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 0220416C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 02204170 */ _t19 = cpu->r[1] + 0x00000008u;
         /* 02204170 */ rbrew_write_f32(cpu->mem, _t19, cpu->f[13]);
         /* 02204174 */ _t20 = cpu->r[1] + 0x0000000Cu;
         /* 02204174 */ rbrew_write_f32(cpu->mem, _t20, cpu->f[0]);
-        /* 02204178 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02204178 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02204178 */ _t22 = _t21 & 0x00000001u;
         /* 02204178 */ if (_t22) goto L_022041A4; else goto L_0220417C;
   L_0220417C: ; // 0x220417c
@@ -15768,7 +15768,7 @@ void Gambit_fn_0220410C(CPUState* cpu) {
         /* 022041FC */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t29);
         /* 02204200 */ _t30 = cpu->r[1] + 0x00000030u;
         /* 02204200 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t30);
-        /* 02204204 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204204 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204204 */ _t32 = _t31 & 0x00000001u;
         /* 02204204 */ if (_t32) goto L_02204208; // else: addr-0 trap, fall-through
   L_02204208: ; // 0x2204208
@@ -15785,9 +15785,9 @@ void Gambit_fn_02204218(CPUState* cpu) {
 
   L_02204218: ; // 0x2204218
         /* 02204218 */ cpu->r[12] = 0x101E0000u;
-        /* 0220421C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 0220421C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 02204220 */ cpu->r[12] = cpu->r[12] + 0x00002858u;
-        /* 02204224 */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204224 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204224 */ _t1 = _t0 & 0x00000001u;
         /* 02204224 */ if (_t1) goto L_02204228; else goto L_02204230;
   L_02204228: ; // 0x2204228
@@ -15828,8 +15828,8 @@ void Gambit_fn_0220424C(CPUState* cpu) {
         /* 02204260 */ Gambit_fn_022061BC(cpu);
         /* 02204264 */ _t2 = cpu->r[31] + 0x00000024u;
         /* 02204264 */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 02204268 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220426C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02204268 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220426C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220426C */ _t4 = _t3 & 0x00000001u;
         /* 0220426C */ if (_t4) goto L_02204270; else goto L_0220431C;
   L_02204270: ; // 0x2204270
@@ -15860,16 +15860,16 @@ void Gambit_fn_0220424C(CPUState* cpu) {
         /* 022042BC */ _t9 = cpu->r[1] + 0x00000010u;
         /* 022042BC */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 022042C0 */ Gambit_fn_02022278(cpu);
-        /* 022042C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022042C8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022042C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022042C8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022042C8 */ _t11 = _t10 & 0x00000001u;
         /* 022042C8 */ if (_t11) goto L_022042F8; else goto L_022042CC;
   L_022042CC: ; // 0x22042cc
-        /* 022042CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 022042CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 022042D0 */ cpu->r[12] = cpu->r[31];
         /* 022042D4 */ _t12 = cpu->r[3] + 0x00000000u;
         /* 022042D4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 022042D8 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022042D8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022042D8 */ _t14 = _t13 & 0x00000001u;
         /* 022042D8 */ if (_t14) goto L_022042DC; else goto L_022042E0;
   L_022042DC: ; // 0x22042dc
@@ -15878,18 +15878,18 @@ void Gambit_fn_0220424C(CPUState* cpu) {
         /* 022042E0 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 022042E0 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 022042E4 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 022042E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 022042E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 022042E8 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 022042EC */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 022042F0 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022042F0 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022042F0 */ _t17 = _t16 & 0x00000001u;
         /* 022042F0 */ if (_t17) goto L_022042F4; else goto L_02204298;
   L_022042F4: ; // 0x22042f4
         /* 022042F4 */ goto L_0220431C;
   L_022042F8: ; // 0x22042f8
-        /* 022042F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 022042F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 022042FC */ cpu->r[6] = cpu->r[31];
-        /* 02204300 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204300 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204300 */ _t19 = _t18 & 0x00000001u;
         /* 02204300 */ if (_t19) goto L_02204304; else goto L_02204308;
   L_02204304: ; // 0x2204304
@@ -15898,10 +15898,10 @@ void Gambit_fn_0220424C(CPUState* cpu) {
         /* 02204308 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 02204308 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 0220430C */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220430C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220430C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 02204310 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 02204314 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 02204318 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02204318 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02204318 */ _t22 = _t21 & 0x00000001u;
         /* 02204318 */ if (_t22) goto L_0220431C; else goto L_02204298;
   L_0220431C: ; // 0x220431c
@@ -15947,7 +15947,7 @@ void Gambit_fn_02204330(CPUState* cpu) {
         /* 02204370 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t8);
         /* 02204374 */ _t9 = cpu->r[1] + 0x00000008u;
         /* 02204374 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t9);
-        /* 02204378 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204378 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204378 */ _t11 = _t10 & 0x00000001u;
         /* 02204378 */ if (_t11) goto L_0220437C; // else: addr-0 trap, fall-through
   L_0220437C: ; // 0x220437c
@@ -15991,7 +15991,7 @@ void Gambit_fn_02204334(CPUState* cpu) {
         /* 02204370 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t8);
         /* 02204374 */ _t9 = cpu->r[1] + 0x00000008u;
         /* 02204374 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t9);
-        /* 02204378 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204378 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204378 */ _t11 = _t10 & 0x00000001u;
         /* 02204378 */ if (_t11) goto L_0220437C; // else: addr-0 trap, fall-through
   L_0220437C: ; // 0x220437c
@@ -16053,12 +16053,12 @@ void Gambit_fn_0220438C(CPUState* cpu) {
         /* 022043E8 */ cpu->f[6] = fma(cpu->f[11], cpu->f[11], cpu->f[7]);
         /* 022043EC */ _t18 = cpu->r[3] + 0x00000008u;
         /* 022043EC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t18);
-        /* 022043F0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 022043F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 022043F4 */ _t19 = cpu->r[1] + 0x00000008u;
         /* 022043F4 */ rbrew_write_f32(cpu->mem, _t19, cpu->f[13]);
         /* 022043F8 */ _t20 = cpu->r[1] + 0x0000000Cu;
         /* 022043F8 */ rbrew_write_f32(cpu->mem, _t20, cpu->f[0]);
-        /* 022043FC */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022043FC */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022043FC */ _t22 = _t21 & 0x00000001u;
         /* 022043FC */ if (_t22) goto L_02204428; else goto L_02204400;
   L_02204400: ; // 0x2204400
@@ -16106,7 +16106,7 @@ void Gambit_fn_0220438C(CPUState* cpu) {
         /* 02204480 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t29);
         /* 02204484 */ _t30 = cpu->r[1] + 0x00000030u;
         /* 02204484 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t30);
-        /* 02204488 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204488 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204488 */ _t32 = _t31 & 0x00000001u;
         /* 02204488 */ if (_t32) goto L_0220448C; // else: addr-0 trap, fall-through
   L_0220448C: ; // 0x220448c
@@ -16167,12 +16167,12 @@ void Gambit_fn_02204390(CPUState* cpu) {
         /* 022043E8 */ cpu->f[6] = fma(cpu->f[11], cpu->f[11], cpu->f[7]);
         /* 022043EC */ _t18 = cpu->r[3] + 0x00000008u;
         /* 022043EC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t18);
-        /* 022043F0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 022043F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 022043F4 */ _t19 = cpu->r[1] + 0x00000008u;
         /* 022043F4 */ rbrew_write_f32(cpu->mem, _t19, cpu->f[13]);
         /* 022043F8 */ _t20 = cpu->r[1] + 0x0000000Cu;
         /* 022043F8 */ rbrew_write_f32(cpu->mem, _t20, cpu->f[0]);
-        /* 022043FC */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022043FC */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022043FC */ _t22 = _t21 & 0x00000001u;
         /* 022043FC */ if (_t22) goto L_02204428; else goto L_02204400;
   L_02204400: ; // 0x2204400
@@ -16220,7 +16220,7 @@ void Gambit_fn_02204390(CPUState* cpu) {
         /* 02204480 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t29);
         /* 02204484 */ _t30 = cpu->r[1] + 0x00000030u;
         /* 02204484 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t30);
-        /* 02204488 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204488 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204488 */ _t32 = _t31 & 0x00000001u;
         /* 02204488 */ if (_t32) goto L_0220448C; // else: addr-0 trap, fall-through
   L_0220448C: ; // 0x220448c
@@ -16237,9 +16237,9 @@ void Gambit_fn_0220449C(CPUState* cpu) {
 
   L_0220449C: ; // 0x220449c
         /* 0220449C */ cpu->r[12] = 0x101E0000u;
-        /* 022044A0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 022044A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 022044A4 */ cpu->r[12] = cpu->r[12] + 0x00002860u;
-        /* 022044A8 */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022044A8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022044A8 */ _t1 = _t0 & 0x00000001u;
         /* 022044A8 */ if (_t1) goto L_022044AC; else goto L_022044B4;
   L_022044AC: ; // 0x22044ac
@@ -16280,8 +16280,8 @@ void Gambit_fn_022044D0(CPUState* cpu) {
         /* 022044E4 */ Gambit_fn_022061BC(cpu);
         /* 022044E8 */ _t2 = cpu->r[31] + 0x00000024u;
         /* 022044E8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 022044EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 022044F0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022044EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 022044F0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022044F0 */ _t4 = _t3 & 0x00000001u;
         /* 022044F0 */ if (_t4) goto L_022044F4; else goto L_022045A0;
   L_022044F4: ; // 0x22044f4
@@ -16312,16 +16312,16 @@ void Gambit_fn_022044D0(CPUState* cpu) {
         /* 02204540 */ _t9 = cpu->r[1] + 0x00000010u;
         /* 02204540 */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 02204544 */ Gambit_fn_02022278(cpu);
-        /* 02204548 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220454C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02204548 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220454C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220454C */ _t11 = _t10 & 0x00000001u;
         /* 0220454C */ if (_t11) goto L_0220457C; else goto L_02204550;
   L_02204550: ; // 0x2204550
-        /* 02204550 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 02204550 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 02204554 */ cpu->r[12] = cpu->r[31];
         /* 02204558 */ _t12 = cpu->r[3] + 0x00000000u;
         /* 02204558 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0220455C */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220455C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220455C */ _t14 = _t13 & 0x00000001u;
         /* 0220455C */ if (_t14) goto L_02204560; else goto L_02204564;
   L_02204560: ; // 0x2204560
@@ -16330,18 +16330,18 @@ void Gambit_fn_022044D0(CPUState* cpu) {
         /* 02204564 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 02204564 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 02204568 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 02204568 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 02204568 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220456C */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 02204570 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 02204574 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02204574 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02204574 */ _t17 = _t16 & 0x00000001u;
         /* 02204574 */ if (_t17) goto L_02204578; else goto L_0220451C;
   L_02204578: ; // 0x2204578
         /* 02204578 */ goto L_022045A0;
   L_0220457C: ; // 0x220457c
-        /* 0220457C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220457C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 02204580 */ cpu->r[6] = cpu->r[31];
-        /* 02204584 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204584 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204584 */ _t19 = _t18 & 0x00000001u;
         /* 02204584 */ if (_t19) goto L_02204588; else goto L_0220458C;
   L_02204588: ; // 0x2204588
@@ -16350,10 +16350,10 @@ void Gambit_fn_022044D0(CPUState* cpu) {
         /* 0220458C */ _t20 = cpu->r[6] + 0x00000000u;
         /* 0220458C */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 02204590 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 02204590 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 02204590 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 02204594 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 02204598 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220459C */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220459C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220459C */ _t22 = _t21 & 0x00000001u;
         /* 0220459C */ if (_t22) goto L_022045A0; else goto L_0220451C;
   L_022045A0: ; // 0x22045a0
@@ -16399,7 +16399,7 @@ void Gambit_fn_022045B4(CPUState* cpu) {
         /* 022045F4 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t8);
         /* 022045F8 */ _t9 = cpu->r[1] + 0x00000008u;
         /* 022045F8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t9);
-        /* 022045FC */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022045FC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022045FC */ _t11 = _t10 & 0x00000001u;
         /* 022045FC */ if (_t11) goto L_02204600; // else: addr-0 trap, fall-through
   L_02204600: ; // 0x2204600
@@ -16443,7 +16443,7 @@ void Gambit_fn_022045B8(CPUState* cpu) {
         /* 022045F4 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t8);
         /* 022045F8 */ _t9 = cpu->r[1] + 0x00000008u;
         /* 022045F8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t9);
-        /* 022045FC */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022045FC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022045FC */ _t11 = _t10 & 0x00000001u;
         /* 022045FC */ if (_t11) goto L_02204600; // else: addr-0 trap, fall-through
   L_02204600: ; // 0x2204600
@@ -16505,12 +16505,12 @@ void Gambit_fn_02204610(CPUState* cpu) {
         /* 0220466C */ cpu->f[6] = fma(cpu->f[11], cpu->f[11], cpu->f[7]);
         /* 02204670 */ _t18 = cpu->r[3] + 0x00000008u;
         /* 02204670 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t18);
-        /* 02204674 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 02204674 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 02204678 */ _t19 = cpu->r[1] + 0x00000008u;
         /* 02204678 */ rbrew_write_f32(cpu->mem, _t19, cpu->f[13]);
         /* 0220467C */ _t20 = cpu->r[1] + 0x0000000Cu;
         /* 0220467C */ rbrew_write_f32(cpu->mem, _t20, cpu->f[0]);
-        /* 02204680 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02204680 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02204680 */ _t22 = _t21 & 0x00000001u;
         /* 02204680 */ if (_t22) goto L_022046AC; else goto L_02204684;
   L_02204684: ; // 0x2204684
@@ -16558,7 +16558,7 @@ void Gambit_fn_02204610(CPUState* cpu) {
         /* 02204704 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t29);
         /* 02204708 */ _t30 = cpu->r[1] + 0x00000030u;
         /* 02204708 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t30);
-        /* 0220470C */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220470C */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220470C */ _t32 = _t31 & 0x00000001u;
         /* 0220470C */ if (_t32) goto L_02204710; // else: addr-0 trap, fall-through
   L_02204710: ; // 0x2204710
@@ -16619,12 +16619,12 @@ void Gambit_fn_02204614(CPUState* cpu) {
         /* 0220466C */ cpu->f[6] = fma(cpu->f[11], cpu->f[11], cpu->f[7]);
         /* 02204670 */ _t18 = cpu->r[3] + 0x00000008u;
         /* 02204670 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t18);
-        /* 02204674 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 02204674 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 02204678 */ _t19 = cpu->r[1] + 0x00000008u;
         /* 02204678 */ rbrew_write_f32(cpu->mem, _t19, cpu->f[13]);
         /* 0220467C */ _t20 = cpu->r[1] + 0x0000000Cu;
         /* 0220467C */ rbrew_write_f32(cpu->mem, _t20, cpu->f[0]);
-        /* 02204680 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02204680 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02204680 */ _t22 = _t21 & 0x00000001u;
         /* 02204680 */ if (_t22) goto L_022046AC; else goto L_02204684;
   L_02204684: ; // 0x2204684
@@ -16672,7 +16672,7 @@ void Gambit_fn_02204614(CPUState* cpu) {
         /* 02204704 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t29);
         /* 02204708 */ _t30 = cpu->r[1] + 0x00000030u;
         /* 02204708 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t30);
-        /* 0220470C */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220470C */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220470C */ _t32 = _t31 & 0x00000001u;
         /* 0220470C */ if (_t32) goto L_02204710; // else: addr-0 trap, fall-through
   L_02204710: ; // 0x2204710
@@ -16689,9 +16689,9 @@ void Gambit_fn_02204720(CPUState* cpu) {
 
   L_02204720: ; // 0x2204720
         /* 02204720 */ cpu->r[12] = 0x101E0000u;
-        /* 02204724 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 02204724 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 02204728 */ cpu->r[12] = cpu->r[12] + 0x00002868u;
-        /* 0220472C */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220472C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220472C */ _t1 = _t0 & 0x00000001u;
         /* 0220472C */ if (_t1) goto L_02204730; else goto L_02204738;
   L_02204730: ; // 0x2204730
@@ -16732,8 +16732,8 @@ void Gambit_fn_02204754(CPUState* cpu) {
         /* 02204768 */ Gambit_fn_022061BC(cpu);
         /* 0220476C */ _t2 = cpu->r[31] + 0x00000024u;
         /* 0220476C */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 02204770 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02204774 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02204770 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02204774 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02204774 */ _t4 = _t3 & 0x00000001u;
         /* 02204774 */ if (_t4) goto L_02204778; else goto L_02204824;
   L_02204778: ; // 0x2204778
@@ -16764,16 +16764,16 @@ void Gambit_fn_02204754(CPUState* cpu) {
         /* 022047C4 */ _t9 = cpu->r[1] + 0x00000010u;
         /* 022047C4 */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 022047C8 */ Gambit_fn_02022278(cpu);
-        /* 022047CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022047D0 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022047CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022047D0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022047D0 */ _t11 = _t10 & 0x00000001u;
         /* 022047D0 */ if (_t11) goto L_02204800; else goto L_022047D4;
   L_022047D4: ; // 0x22047d4
-        /* 022047D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 022047D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 022047D8 */ cpu->r[12] = cpu->r[31];
         /* 022047DC */ _t12 = cpu->r[3] + 0x00000000u;
         /* 022047DC */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 022047E0 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022047E0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022047E0 */ _t14 = _t13 & 0x00000001u;
         /* 022047E0 */ if (_t14) goto L_022047E4; else goto L_022047E8;
   L_022047E4: ; // 0x22047e4
@@ -16782,18 +16782,18 @@ void Gambit_fn_02204754(CPUState* cpu) {
         /* 022047E8 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 022047E8 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 022047EC */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 022047EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 022047EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 022047F0 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 022047F4 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 022047F8 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022047F8 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022047F8 */ _t17 = _t16 & 0x00000001u;
         /* 022047F8 */ if (_t17) goto L_022047FC; else goto L_022047A0;
   L_022047FC: ; // 0x22047fc
         /* 022047FC */ goto L_02204824;
   L_02204800: ; // 0x2204800
-        /* 02204800 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 02204800 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 02204804 */ cpu->r[6] = cpu->r[31];
-        /* 02204808 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204808 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204808 */ _t19 = _t18 & 0x00000001u;
         /* 02204808 */ if (_t19) goto L_0220480C; else goto L_02204810;
   L_0220480C: ; // 0x220480c
@@ -16802,10 +16802,10 @@ void Gambit_fn_02204754(CPUState* cpu) {
         /* 02204810 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 02204810 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 02204814 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 02204814 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 02204814 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 02204818 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220481C */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 02204820 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02204820 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02204820 */ _t22 = _t21 & 0x00000001u;
         /* 02204820 */ if (_t22) goto L_02204824; else goto L_022047A0;
   L_02204824: ; // 0x2204824
@@ -16851,7 +16851,7 @@ void Gambit_fn_02204838(CPUState* cpu) {
         /* 02204878 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t8);
         /* 0220487C */ _t9 = cpu->r[1] + 0x00000008u;
         /* 0220487C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t9);
-        /* 02204880 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204880 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204880 */ _t11 = _t10 & 0x00000001u;
         /* 02204880 */ if (_t11) goto L_02204884; // else: addr-0 trap, fall-through
   L_02204884: ; // 0x2204884
@@ -16895,7 +16895,7 @@ void Gambit_fn_0220483C(CPUState* cpu) {
         /* 02204878 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t8);
         /* 0220487C */ _t9 = cpu->r[1] + 0x00000008u;
         /* 0220487C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t9);
-        /* 02204880 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204880 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204880 */ _t11 = _t10 & 0x00000001u;
         /* 02204880 */ if (_t11) goto L_02204884; // else: addr-0 trap, fall-through
   L_02204884: ; // 0x2204884
@@ -16957,12 +16957,12 @@ void Gambit_fn_02204894(CPUState* cpu) {
         /* 022048F0 */ cpu->f[6] = fma(cpu->f[11], cpu->f[11], cpu->f[7]);
         /* 022048F4 */ _t18 = cpu->r[3] + 0x00000008u;
         /* 022048F4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t18);
-        /* 022048F8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 022048F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 022048FC */ _t19 = cpu->r[1] + 0x00000008u;
         /* 022048FC */ rbrew_write_f32(cpu->mem, _t19, cpu->f[13]);
         /* 02204900 */ _t20 = cpu->r[1] + 0x0000000Cu;
         /* 02204900 */ rbrew_write_f32(cpu->mem, _t20, cpu->f[0]);
-        /* 02204904 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02204904 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02204904 */ _t22 = _t21 & 0x00000001u;
         /* 02204904 */ if (_t22) goto L_02204930; else goto L_02204908;
   L_02204908: ; // 0x2204908
@@ -17010,7 +17010,7 @@ void Gambit_fn_02204894(CPUState* cpu) {
         /* 02204988 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t29);
         /* 0220498C */ _t30 = cpu->r[1] + 0x00000030u;
         /* 0220498C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t30);
-        /* 02204990 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204990 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204990 */ _t32 = _t31 & 0x00000001u;
         /* 02204990 */ if (_t32) goto L_02204994; // else: addr-0 trap, fall-through
   L_02204994: ; // 0x2204994
@@ -17071,12 +17071,12 @@ void Gambit_fn_02204898(CPUState* cpu) {
         /* 022048F0 */ cpu->f[6] = fma(cpu->f[11], cpu->f[11], cpu->f[7]);
         /* 022048F4 */ _t18 = cpu->r[3] + 0x00000008u;
         /* 022048F4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t18);
-        /* 022048F8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 022048F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 022048FC */ _t19 = cpu->r[1] + 0x00000008u;
         /* 022048FC */ rbrew_write_f32(cpu->mem, _t19, cpu->f[13]);
         /* 02204900 */ _t20 = cpu->r[1] + 0x0000000Cu;
         /* 02204900 */ rbrew_write_f32(cpu->mem, _t20, cpu->f[0]);
-        /* 02204904 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02204904 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02204904 */ _t22 = _t21 & 0x00000001u;
         /* 02204904 */ if (_t22) goto L_02204930; else goto L_02204908;
   L_02204908: ; // 0x2204908
@@ -17124,7 +17124,7 @@ void Gambit_fn_02204898(CPUState* cpu) {
         /* 02204988 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t29);
         /* 0220498C */ _t30 = cpu->r[1] + 0x00000030u;
         /* 0220498C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t30);
-        /* 02204990 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204990 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204990 */ _t32 = _t31 & 0x00000001u;
         /* 02204990 */ if (_t32) goto L_02204994; // else: addr-0 trap, fall-through
   L_02204994: ; // 0x2204994
@@ -17141,9 +17141,9 @@ void Gambit_fn_022049A4(CPUState* cpu) {
 
   L_022049A4: ; // 0x22049a4
         /* 022049A4 */ cpu->r[12] = 0x101E0000u;
-        /* 022049A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 022049A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 022049AC */ cpu->r[12] = cpu->r[12] + 0x00002870u;
-        /* 022049B0 */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022049B0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022049B0 */ _t1 = _t0 & 0x00000001u;
         /* 022049B0 */ if (_t1) goto L_022049B4; else goto L_022049BC;
   L_022049B4: ; // 0x22049b4
@@ -17184,8 +17184,8 @@ void Gambit_fn_022049D8(CPUState* cpu) {
         /* 022049EC */ Gambit_fn_022061BC(cpu);
         /* 022049F0 */ _t2 = cpu->r[31] + 0x00000024u;
         /* 022049F0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 022049F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 022049F8 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022049F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 022049F8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022049F8 */ _t4 = _t3 & 0x00000001u;
         /* 022049F8 */ if (_t4) goto L_022049FC; else goto L_02204AA8;
   L_022049FC: ; // 0x22049fc
@@ -17216,16 +17216,16 @@ void Gambit_fn_022049D8(CPUState* cpu) {
         /* 02204A48 */ _t9 = cpu->r[1] + 0x00000010u;
         /* 02204A48 */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 02204A4C */ Gambit_fn_02022278(cpu);
-        /* 02204A50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02204A54 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02204A50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02204A54 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02204A54 */ _t11 = _t10 & 0x00000001u;
         /* 02204A54 */ if (_t11) goto L_02204A84; else goto L_02204A58;
   L_02204A58: ; // 0x2204a58
-        /* 02204A58 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 02204A58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 02204A5C */ cpu->r[12] = cpu->r[31];
         /* 02204A60 */ _t12 = cpu->r[3] + 0x00000000u;
         /* 02204A60 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 02204A64 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204A64 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204A64 */ _t14 = _t13 & 0x00000001u;
         /* 02204A64 */ if (_t14) goto L_02204A68; else goto L_02204A6C;
   L_02204A68: ; // 0x2204a68
@@ -17234,18 +17234,18 @@ void Gambit_fn_022049D8(CPUState* cpu) {
         /* 02204A6C */ _t15 = cpu->r[12] + 0x00000000u;
         /* 02204A6C */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 02204A70 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 02204A70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 02204A70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 02204A74 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 02204A78 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 02204A7C */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02204A7C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02204A7C */ _t17 = _t16 & 0x00000001u;
         /* 02204A7C */ if (_t17) goto L_02204A80; else goto L_02204A24;
   L_02204A80: ; // 0x2204a80
         /* 02204A80 */ goto L_02204AA8;
   L_02204A84: ; // 0x2204a84
-        /* 02204A84 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 02204A84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 02204A88 */ cpu->r[6] = cpu->r[31];
-        /* 02204A8C */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204A8C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204A8C */ _t19 = _t18 & 0x00000001u;
         /* 02204A8C */ if (_t19) goto L_02204A90; else goto L_02204A94;
   L_02204A90: ; // 0x2204a90
@@ -17254,10 +17254,10 @@ void Gambit_fn_022049D8(CPUState* cpu) {
         /* 02204A94 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 02204A94 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 02204A98 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 02204A98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 02204A98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 02204A9C */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 02204AA0 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 02204AA4 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02204AA4 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02204AA4 */ _t22 = _t21 & 0x00000001u;
         /* 02204AA4 */ if (_t22) goto L_02204AA8; else goto L_02204A24;
   L_02204AA8: ; // 0x2204aa8
@@ -17303,7 +17303,7 @@ void Gambit_fn_02204ABC(CPUState* cpu) {
         /* 02204AFC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t8);
         /* 02204B00 */ _t9 = cpu->r[1] + 0x00000008u;
         /* 02204B00 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t9);
-        /* 02204B04 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204B04 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204B04 */ _t11 = _t10 & 0x00000001u;
         /* 02204B04 */ if (_t11) goto L_02204B08; // else: addr-0 trap, fall-through
   L_02204B08: ; // 0x2204b08
@@ -17347,7 +17347,7 @@ void Gambit_fn_02204AC0(CPUState* cpu) {
         /* 02204AFC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t8);
         /* 02204B00 */ _t9 = cpu->r[1] + 0x00000008u;
         /* 02204B00 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t9);
-        /* 02204B04 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204B04 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204B04 */ _t11 = _t10 & 0x00000001u;
         /* 02204B04 */ if (_t11) goto L_02204B08; // else: addr-0 trap, fall-through
   L_02204B08: ; // 0x2204b08
@@ -17409,12 +17409,12 @@ void Gambit_fn_02204B18(CPUState* cpu) {
         /* 02204B74 */ cpu->f[6] = fma(cpu->f[11], cpu->f[11], cpu->f[7]);
         /* 02204B78 */ _t18 = cpu->r[3] + 0x00000008u;
         /* 02204B78 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t18);
-        /* 02204B7C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 02204B7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 02204B80 */ _t19 = cpu->r[1] + 0x00000008u;
         /* 02204B80 */ rbrew_write_f32(cpu->mem, _t19, cpu->f[13]);
         /* 02204B84 */ _t20 = cpu->r[1] + 0x0000000Cu;
         /* 02204B84 */ rbrew_write_f32(cpu->mem, _t20, cpu->f[0]);
-        /* 02204B88 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02204B88 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02204B88 */ _t22 = _t21 & 0x00000001u;
         /* 02204B88 */ if (_t22) goto L_02204BB4; else goto L_02204B8C;
   L_02204B8C: ; // 0x2204b8c
@@ -17462,7 +17462,7 @@ void Gambit_fn_02204B18(CPUState* cpu) {
         /* 02204C0C */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t29);
         /* 02204C10 */ _t30 = cpu->r[1] + 0x00000030u;
         /* 02204C10 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t30);
-        /* 02204C14 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204C14 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204C14 */ _t32 = _t31 & 0x00000001u;
         /* 02204C14 */ if (_t32) goto L_02204C18; // else: addr-0 trap, fall-through
   L_02204C18: ; // 0x2204c18
@@ -17523,12 +17523,12 @@ void Gambit_fn_02204B1C(CPUState* cpu) {
         /* 02204B74 */ cpu->f[6] = fma(cpu->f[11], cpu->f[11], cpu->f[7]);
         /* 02204B78 */ _t18 = cpu->r[3] + 0x00000008u;
         /* 02204B78 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t18);
-        /* 02204B7C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 02204B7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 02204B80 */ _t19 = cpu->r[1] + 0x00000008u;
         /* 02204B80 */ rbrew_write_f32(cpu->mem, _t19, cpu->f[13]);
         /* 02204B84 */ _t20 = cpu->r[1] + 0x0000000Cu;
         /* 02204B84 */ rbrew_write_f32(cpu->mem, _t20, cpu->f[0]);
-        /* 02204B88 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02204B88 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02204B88 */ _t22 = _t21 & 0x00000001u;
         /* 02204B88 */ if (_t22) goto L_02204BB4; else goto L_02204B8C;
   L_02204B8C: ; // 0x2204b8c
@@ -17576,7 +17576,7 @@ void Gambit_fn_02204B1C(CPUState* cpu) {
         /* 02204C0C */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t29);
         /* 02204C10 */ _t30 = cpu->r[1] + 0x00000030u;
         /* 02204C10 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t30);
-        /* 02204C14 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204C14 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204C14 */ _t32 = _t31 & 0x00000001u;
         /* 02204C14 */ if (_t32) goto L_02204C18; // else: addr-0 trap, fall-through
   L_02204C18: ; // 0x2204c18
@@ -17593,9 +17593,9 @@ void Gambit_fn_02204C28(CPUState* cpu) {
 
   L_02204C28: ; // 0x2204c28
         /* 02204C28 */ cpu->r[12] = 0x101E0000u;
-        /* 02204C2C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 02204C2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 02204C30 */ cpu->r[12] = cpu->r[12] + 0x00002878u;
-        /* 02204C34 */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204C34 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204C34 */ _t1 = _t0 & 0x00000001u;
         /* 02204C34 */ if (_t1) goto L_02204C38; else goto L_02204C40;
   L_02204C38: ; // 0x2204c38
@@ -17636,8 +17636,8 @@ void Gambit_fn_02204C5C(CPUState* cpu) {
         /* 02204C70 */ Gambit_fn_022061BC(cpu);
         /* 02204C74 */ _t2 = cpu->r[31] + 0x00000024u;
         /* 02204C74 */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 02204C78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02204C7C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02204C78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02204C7C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02204C7C */ _t4 = _t3 & 0x00000001u;
         /* 02204C7C */ if (_t4) goto L_02204C80; else goto L_02204D2C;
   L_02204C80: ; // 0x2204c80
@@ -17668,16 +17668,16 @@ void Gambit_fn_02204C5C(CPUState* cpu) {
         /* 02204CCC */ _t9 = cpu->r[1] + 0x00000010u;
         /* 02204CCC */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 02204CD0 */ Gambit_fn_02022278(cpu);
-        /* 02204CD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02204CD8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02204CD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02204CD8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02204CD8 */ _t11 = _t10 & 0x00000001u;
         /* 02204CD8 */ if (_t11) goto L_02204D08; else goto L_02204CDC;
   L_02204CDC: ; // 0x2204cdc
-        /* 02204CDC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 02204CDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 02204CE0 */ cpu->r[12] = cpu->r[31];
         /* 02204CE4 */ _t12 = cpu->r[3] + 0x00000000u;
         /* 02204CE4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 02204CE8 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204CE8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204CE8 */ _t14 = _t13 & 0x00000001u;
         /* 02204CE8 */ if (_t14) goto L_02204CEC; else goto L_02204CF0;
   L_02204CEC: ; // 0x2204cec
@@ -17686,18 +17686,18 @@ void Gambit_fn_02204C5C(CPUState* cpu) {
         /* 02204CF0 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 02204CF0 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 02204CF4 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 02204CF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 02204CF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 02204CF8 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 02204CFC */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 02204D00 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02204D00 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02204D00 */ _t17 = _t16 & 0x00000001u;
         /* 02204D00 */ if (_t17) goto L_02204D04; else goto L_02204CA8;
   L_02204D04: ; // 0x2204d04
         /* 02204D04 */ goto L_02204D2C;
   L_02204D08: ; // 0x2204d08
-        /* 02204D08 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 02204D08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 02204D0C */ cpu->r[6] = cpu->r[31];
-        /* 02204D10 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204D10 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204D10 */ _t19 = _t18 & 0x00000001u;
         /* 02204D10 */ if (_t19) goto L_02204D14; else goto L_02204D18;
   L_02204D14: ; // 0x2204d14
@@ -17706,10 +17706,10 @@ void Gambit_fn_02204C5C(CPUState* cpu) {
         /* 02204D18 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 02204D18 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 02204D1C */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 02204D1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 02204D1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 02204D20 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 02204D24 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 02204D28 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02204D28 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02204D28 */ _t22 = _t21 & 0x00000001u;
         /* 02204D28 */ if (_t22) goto L_02204D2C; else goto L_02204CA8;
   L_02204D2C: ; // 0x2204d2c
@@ -17755,7 +17755,7 @@ void Gambit_fn_02204D40(CPUState* cpu) {
         /* 02204D80 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t8);
         /* 02204D84 */ _t9 = cpu->r[1] + 0x00000008u;
         /* 02204D84 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t9);
-        /* 02204D88 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204D88 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204D88 */ _t11 = _t10 & 0x00000001u;
         /* 02204D88 */ if (_t11) goto L_02204D8C; // else: addr-0 trap, fall-through
   L_02204D8C: ; // 0x2204d8c
@@ -17799,7 +17799,7 @@ void Gambit_fn_02204D44(CPUState* cpu) {
         /* 02204D80 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t8);
         /* 02204D84 */ _t9 = cpu->r[1] + 0x00000008u;
         /* 02204D84 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t9);
-        /* 02204D88 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204D88 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204D88 */ _t11 = _t10 & 0x00000001u;
         /* 02204D88 */ if (_t11) goto L_02204D8C; // else: addr-0 trap, fall-through
   L_02204D8C: ; // 0x2204d8c
@@ -17861,12 +17861,12 @@ void Gambit_fn_02204D9C(CPUState* cpu) {
         /* 02204DF8 */ cpu->f[6] = fma(cpu->f[11], cpu->f[11], cpu->f[7]);
         /* 02204DFC */ _t18 = cpu->r[3] + 0x00000008u;
         /* 02204DFC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t18);
-        /* 02204E00 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 02204E00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 02204E04 */ _t19 = cpu->r[1] + 0x00000008u;
         /* 02204E04 */ rbrew_write_f32(cpu->mem, _t19, cpu->f[13]);
         /* 02204E08 */ _t20 = cpu->r[1] + 0x0000000Cu;
         /* 02204E08 */ rbrew_write_f32(cpu->mem, _t20, cpu->f[0]);
-        /* 02204E0C */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02204E0C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02204E0C */ _t22 = _t21 & 0x00000001u;
         /* 02204E0C */ if (_t22) goto L_02204E38; else goto L_02204E10;
   L_02204E10: ; // 0x2204e10
@@ -17914,7 +17914,7 @@ void Gambit_fn_02204D9C(CPUState* cpu) {
         /* 02204E90 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t29);
         /* 02204E94 */ _t30 = cpu->r[1] + 0x00000030u;
         /* 02204E94 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t30);
-        /* 02204E98 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204E98 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204E98 */ _t32 = _t31 & 0x00000001u;
         /* 02204E98 */ if (_t32) goto L_02204E9C; // else: addr-0 trap, fall-through
   L_02204E9C: ; // 0x2204e9c
@@ -17975,12 +17975,12 @@ void Gambit_fn_02204DA0(CPUState* cpu) {
         /* 02204DF8 */ cpu->f[6] = fma(cpu->f[11], cpu->f[11], cpu->f[7]);
         /* 02204DFC */ _t18 = cpu->r[3] + 0x00000008u;
         /* 02204DFC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t18);
-        /* 02204E00 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 02204E00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 02204E04 */ _t19 = cpu->r[1] + 0x00000008u;
         /* 02204E04 */ rbrew_write_f32(cpu->mem, _t19, cpu->f[13]);
         /* 02204E08 */ _t20 = cpu->r[1] + 0x0000000Cu;
         /* 02204E08 */ rbrew_write_f32(cpu->mem, _t20, cpu->f[0]);
-        /* 02204E0C */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02204E0C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02204E0C */ _t22 = _t21 & 0x00000001u;
         /* 02204E0C */ if (_t22) goto L_02204E38; else goto L_02204E10;
   L_02204E10: ; // 0x2204e10
@@ -18028,7 +18028,7 @@ void Gambit_fn_02204DA0(CPUState* cpu) {
         /* 02204E90 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t29);
         /* 02204E94 */ _t30 = cpu->r[1] + 0x00000030u;
         /* 02204E94 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t30);
-        /* 02204E98 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204E98 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204E98 */ _t32 = _t31 & 0x00000001u;
         /* 02204E98 */ if (_t32) goto L_02204E9C; // else: addr-0 trap, fall-through
   L_02204E9C: ; // 0x2204e9c
@@ -18045,9 +18045,9 @@ void Gambit_fn_02204EAC(CPUState* cpu) {
 
   L_02204EAC: ; // 0x2204eac
         /* 02204EAC */ cpu->r[12] = 0x101E0000u;
-        /* 02204EB0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 02204EB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 02204EB4 */ cpu->r[12] = cpu->r[12] + 0x00002880u;
-        /* 02204EB8 */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204EB8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204EB8 */ _t1 = _t0 & 0x00000001u;
         /* 02204EB8 */ if (_t1) goto L_02204EBC; else goto L_02204EC4;
   L_02204EBC: ; // 0x2204ebc
@@ -18088,8 +18088,8 @@ void Gambit_fn_02204EE0(CPUState* cpu) {
         /* 02204EF4 */ Gambit_fn_022061BC(cpu);
         /* 02204EF8 */ _t2 = cpu->r[31] + 0x00000024u;
         /* 02204EF8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 02204EFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02204F00 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02204EFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02204F00 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02204F00 */ _t4 = _t3 & 0x00000001u;
         /* 02204F00 */ if (_t4) goto L_02204F04; else goto L_02204FB0;
   L_02204F04: ; // 0x2204f04
@@ -18120,16 +18120,16 @@ void Gambit_fn_02204EE0(CPUState* cpu) {
         /* 02204F50 */ _t9 = cpu->r[1] + 0x00000010u;
         /* 02204F50 */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 02204F54 */ Gambit_fn_02022278(cpu);
-        /* 02204F58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02204F5C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02204F58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02204F5C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02204F5C */ _t11 = _t10 & 0x00000001u;
         /* 02204F5C */ if (_t11) goto L_02204F8C; else goto L_02204F60;
   L_02204F60: ; // 0x2204f60
-        /* 02204F60 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 02204F60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 02204F64 */ cpu->r[12] = cpu->r[31];
         /* 02204F68 */ _t12 = cpu->r[3] + 0x00000000u;
         /* 02204F68 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 02204F6C */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204F6C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204F6C */ _t14 = _t13 & 0x00000001u;
         /* 02204F6C */ if (_t14) goto L_02204F70; else goto L_02204F74;
   L_02204F70: ; // 0x2204f70
@@ -18138,18 +18138,18 @@ void Gambit_fn_02204EE0(CPUState* cpu) {
         /* 02204F74 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 02204F74 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 02204F78 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 02204F78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 02204F78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 02204F7C */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 02204F80 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 02204F84 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02204F84 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02204F84 */ _t17 = _t16 & 0x00000001u;
         /* 02204F84 */ if (_t17) goto L_02204F88; else goto L_02204F2C;
   L_02204F88: ; // 0x2204f88
         /* 02204F88 */ goto L_02204FB0;
   L_02204F8C: ; // 0x2204f8c
-        /* 02204F8C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 02204F8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 02204F90 */ cpu->r[6] = cpu->r[31];
-        /* 02204F94 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02204F94 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02204F94 */ _t19 = _t18 & 0x00000001u;
         /* 02204F94 */ if (_t19) goto L_02204F98; else goto L_02204F9C;
   L_02204F98: ; // 0x2204f98
@@ -18158,10 +18158,10 @@ void Gambit_fn_02204EE0(CPUState* cpu) {
         /* 02204F9C */ _t20 = cpu->r[6] + 0x00000000u;
         /* 02204F9C */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 02204FA0 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 02204FA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 02204FA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 02204FA4 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 02204FA8 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 02204FAC */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02204FAC */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02204FAC */ _t22 = _t21 & 0x00000001u;
         /* 02204FAC */ if (_t22) goto L_02204FB0; else goto L_02204F2C;
   L_02204FB0: ; // 0x2204fb0
@@ -18178,15 +18178,15 @@ void Gambit_fn_02204FC4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02204FC4: ; // 0x2204fc4
-        /* 02204FC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02204FC8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02204FC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02204FC8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02204FC8 */ _t1 = _t0 & 0x00000001u;
         /* 02204FC8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02204FC8 */ goto L_02204FCC;
   L_02204FCC: ; // 0x2204fcc
         /* 02204FCC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02204FCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02204FD0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02204FCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02204FD0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02204FD0 */ _t3 = _t2 & 0x00000001u;
         /* 02204FD0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02204FD0 */ goto L_02204FD4;
@@ -18205,8 +18205,8 @@ void Gambit_fn_02204FC4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -18220,15 +18220,15 @@ void Gambit_fn_02204FC4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -18313,8 +18313,8 @@ void Gambit_fn_02204FFC(CPUState* cpu) {
         /* 02204FFC */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02204FFC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02205000 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 02205000 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02205004 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205000 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02205004 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205004 */ _t2 = _t1 & 0x00000001u;
         /* 02205004 */ _t3 = _t2 ^ 0x00000001u;
         /* 02205004 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
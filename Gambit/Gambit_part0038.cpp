@@ -13,8 +13,8 @@ void Gambit_fn_02205018(CPUState* cpu) {
         /* 02205018 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02205018 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0220501C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 0220501C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02205020 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220501C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02205020 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205020 */ _t2 = _t1 & 0x00000001u;
         /* 02205020 */ _t3 = _t2 ^ 0x00000001u;
         /* 02205020 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -36,8 +36,8 @@ void Gambit_fn_02205034(CPUState* cpu) {
         /* 02205034 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02205034 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02205038 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 02205038 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0220503C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205038 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0220503C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220503C */ _t2 = _t1 & 0x00000001u;
         /* 0220503C */ _t3 = _t2 ^ 0x00000001u;
         /* 0220503C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -80,8 +80,8 @@ void Gambit_fn_02205060(CPUState* cpu) {
         /* 02205070 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02205074 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02205074 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02205078 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0220507C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205078 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0220507C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220507C */ _t5 = _t4 & 0x00000001u;
         /* 0220507C */ if (_t5) goto L_02205080; else goto L_0220509C;
   L_02205080: ; // 0x2205080
@@ -120,8 +120,8 @@ void Gambit_fn_02205064(CPUState* cpu) {
         /* 02205070 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02205074 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02205074 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02205078 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0220507C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205078 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0220507C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220507C */ _t5 = _t4 & 0x00000001u;
         /* 0220507C */ if (_t5) goto L_02205080; else goto L_0220509C;
   L_02205080: ; // 0x2205080
@@ -514,8 +514,8 @@ void Gambit_fn_0220522C(CPUState* cpu) {
         /* 0220522C */ _t0 = cpu->r[3] + 0x00000114u;
         /* 0220522C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02205230 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 02205230 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02205234 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205230 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02205234 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205234 */ _t2 = _t1 & 0x00000001u;
         /* 02205234 */ if (_t2) goto L_02205244; else goto L_02205238;
   L_02205238: ; // 0x2205238
@@ -544,8 +544,8 @@ void Gambit_fn_02205250(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -647,9 +647,9 @@ void Gambit_fn_022052A8(CPUState* cpu) {
         /* 022052AC */ _t0 = cpu->r[8] + 0xFFFFFD64u;
         /* 022052AC */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 022052B0 */ cpu->r[6] = 0x101D0000u;
-        /* 022052B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 022052B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 022052B8 */ cpu->r[6] = cpu->r[6] + 0xFFFFFEA8u;
-        /* 022052BC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022052BC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022052BC */ _t2 = _t1 & 0x00000001u;
         /* 022052BC */ if (_t2) goto L_022052C0; else goto L_022052D8;
   L_022052C0: ; // 0x22052c0
@@ -662,8 +662,8 @@ void Gambit_fn_022052A8(CPUState* cpu) {
         /* 022052D4 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 022052D4 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_022052D8: ; // 0x22052d8
-        /* 022052D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 022052DC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022052D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 022052DC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022052DC */ _t6 = _t5 & 0x00000001u;
         /* 022052DC */ if (_t6) goto L_022052E0; else goto L_022052E8;
   L_022052E0: ; // 0x22052e0
@@ -674,9 +674,9 @@ void Gambit_fn_022052A8(CPUState* cpu) {
         /* 022052EC */ _t7 = cpu->r[10] + 0xFFFFFD60u;
         /* 022052EC */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 022052F0 */ cpu->r[8] = 0x101D0000u;
-        /* 022052F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 022052F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 022052F8 */ cpu->r[8] = cpu->r[8] + 0xFFFFFEA4u;
-        /* 022052FC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022052FC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022052FC */ _t9 = _t8 & 0x00000001u;
         /* 022052FC */ if (_t9) goto L_02205300; else goto L_02205318;
   L_02205300: ; // 0x2205300
@@ -689,8 +689,8 @@ void Gambit_fn_022052A8(CPUState* cpu) {
         /* 02205314 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 02205314 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_02205318: ; // 0x2205318
-        /* 02205318 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 0220531C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 0220531C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220531C */ _t13 = _t12 & 0x00000001u;
         /* 0220531C */ if (_t13) goto L_02205320; else goto L_02205328;
   L_02205320: ; // 0x2205320
@@ -701,9 +701,9 @@ void Gambit_fn_022052A8(CPUState* cpu) {
         /* 0220532C */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 0220532C */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 02205330 */ cpu->r[10] = 0x101D0000u;
-        /* 02205334 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02205334 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02205338 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 0220533C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220533C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220533C */ _t16 = _t15 & 0x00000001u;
         /* 0220533C */ if (_t16) goto L_02205340; else goto L_02205358;
   L_02205340: ; // 0x2205340
@@ -716,8 +716,8 @@ void Gambit_fn_022052A8(CPUState* cpu) {
         /* 02205354 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 02205354 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_02205358: ; // 0x2205358
-        /* 02205358 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0220535C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205358 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0220535C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220535C */ _t20 = _t19 & 0x00000001u;
         /* 0220535C */ if (_t20) goto L_02205360; else goto L_02205368;
   L_02205360: ; // 0x2205360
@@ -728,9 +728,9 @@ void Gambit_fn_022052A8(CPUState* cpu) {
         /* 0220536C */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 0220536C */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 02205370 */ cpu->r[12] = 0x101D0000u;
-        /* 02205374 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02205374 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02205378 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 0220537C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220537C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220537C */ _t23 = _t22 & 0x00000001u;
         /* 0220537C */ if (_t23) goto L_02205380; else goto L_02205398;
   L_02205380: ; // 0x2205380
@@ -743,8 +743,8 @@ void Gambit_fn_022052A8(CPUState* cpu) {
         /* 02205394 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 02205394 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_02205398: ; // 0x2205398
-        /* 02205398 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0220539C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205398 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0220539C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220539C */ _t27 = _t26 & 0x00000001u;
         /* 0220539C */ if (_t27) goto L_022053A0; else goto L_022053A8;
   L_022053A0: ; // 0x22053a0
@@ -756,9 +756,9 @@ void Gambit_fn_022052A8(CPUState* cpu) {
         /* 022053AC */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 022053AC */ cpu->r[10] = _t28;
         /* 022053B0 */ cpu->r[7] = 0x101D0000u;
-        /* 022053B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 022053B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 022053B8 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 022053BC */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022053BC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022053BC */ _t30 = _t29 & 0x00000001u;
         /* 022053BC */ if (_t30) goto L_022053C0; else goto L_022053D4;
   L_022053C0: ; // 0x22053c0
@@ -770,8 +770,8 @@ void Gambit_fn_022052A8(CPUState* cpu) {
         /* 022053D0 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 022053D0 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_022053D4: ; // 0x22053d4
-        /* 022053D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 022053D8 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022053D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 022053D8 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022053D8 */ _t34 = _t33 & 0x00000001u;
         /* 022053D8 */ if (_t34) goto L_022053DC; else goto L_022053E4;
   L_022053DC: ; // 0x22053dc
@@ -783,9 +783,9 @@ void Gambit_fn_022052A8(CPUState* cpu) {
         /* 022053E8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 022053E8 */ cpu->r[8] = _t35;
         /* 022053EC */ cpu->r[6] = 0x101D0000u;
-        /* 022053F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 022053F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 022053F4 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 022053F8 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022053F8 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022053F8 */ _t37 = _t36 & 0x00000001u;
         /* 022053F8 */ if (_t37) goto L_022053FC; else goto L_02205410;
   L_022053FC: ; // 0x22053fc
@@ -824,9 +824,9 @@ void Gambit_fn_02205434(CPUState* cpu) {
         /* 02205438 */ _t0 = cpu->r[8] + 0xFFFFFD68u;
         /* 02205438 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 0220543C */ cpu->r[6] = 0x101D0000u;
-        /* 02205440 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02205440 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02205444 */ cpu->r[6] = cpu->r[6] + 0xFFFFFEACu;
-        /* 02205448 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205448 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205448 */ _t2 = _t1 & 0x00000001u;
         /* 02205448 */ if (_t2) goto L_0220544C; else goto L_02205464;
   L_0220544C: ; // 0x220544c
@@ -839,8 +839,8 @@ void Gambit_fn_02205434(CPUState* cpu) {
         /* 02205460 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 02205460 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_02205464: ; // 0x2205464
-        /* 02205464 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 02205468 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 02205468 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205468 */ _t6 = _t5 & 0x00000001u;
         /* 02205468 */ if (_t6) goto L_0220546C; else goto L_02205474;
   L_0220546C: ; // 0x220546c
@@ -851,9 +851,9 @@ void Gambit_fn_02205434(CPUState* cpu) {
         /* 02205478 */ _t7 = cpu->r[10] + 0xFFFFFD60u;
         /* 02205478 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 0220547C */ cpu->r[8] = 0x101D0000u;
-        /* 02205480 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02205480 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02205484 */ cpu->r[8] = cpu->r[8] + 0xFFFFFEA4u;
-        /* 02205488 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205488 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205488 */ _t9 = _t8 & 0x00000001u;
         /* 02205488 */ if (_t9) goto L_0220548C; else goto L_022054A4;
   L_0220548C: ; // 0x220548c
@@ -866,8 +866,8 @@ void Gambit_fn_02205434(CPUState* cpu) {
         /* 022054A0 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 022054A0 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_022054A4: ; // 0x22054a4
-        /* 022054A4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 022054A8 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022054A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 022054A8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022054A8 */ _t13 = _t12 & 0x00000001u;
         /* 022054A8 */ if (_t13) goto L_022054AC; else goto L_022054B4;
   L_022054AC: ; // 0x22054ac
@@ -878,9 +878,9 @@ void Gambit_fn_02205434(CPUState* cpu) {
         /* 022054B8 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 022054B8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 022054BC */ cpu->r[10] = 0x101D0000u;
-        /* 022054C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 022054C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 022054C4 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 022054C8 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022054C8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022054C8 */ _t16 = _t15 & 0x00000001u;
         /* 022054C8 */ if (_t16) goto L_022054CC; else goto L_022054E4;
   L_022054CC: ; // 0x22054cc
@@ -893,8 +893,8 @@ void Gambit_fn_02205434(CPUState* cpu) {
         /* 022054E0 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 022054E0 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_022054E4: ; // 0x22054e4
-        /* 022054E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 022054E8 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022054E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 022054E8 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022054E8 */ _t20 = _t19 & 0x00000001u;
         /* 022054E8 */ if (_t20) goto L_022054EC; else goto L_022054F4;
   L_022054EC: ; // 0x22054ec
@@ -905,9 +905,9 @@ void Gambit_fn_02205434(CPUState* cpu) {
         /* 022054F8 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 022054F8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 022054FC */ cpu->r[12] = 0x101D0000u;
-        /* 02205500 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02205500 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02205504 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 02205508 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205508 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205508 */ _t23 = _t22 & 0x00000001u;
         /* 02205508 */ if (_t23) goto L_0220550C; else goto L_02205524;
   L_0220550C: ; // 0x220550c
@@ -920,8 +920,8 @@ void Gambit_fn_02205434(CPUState* cpu) {
         /* 02205520 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 02205520 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_02205524: ; // 0x2205524
-        /* 02205524 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02205528 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02205528 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205528 */ _t27 = _t26 & 0x00000001u;
         /* 02205528 */ if (_t27) goto L_0220552C; else goto L_02205534;
   L_0220552C: ; // 0x220552c
@@ -933,9 +933,9 @@ void Gambit_fn_02205434(CPUState* cpu) {
         /* 02205538 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 02205538 */ cpu->r[10] = _t28;
         /* 0220553C */ cpu->r[7] = 0x101D0000u;
-        /* 02205540 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02205540 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02205544 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 02205548 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205548 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205548 */ _t30 = _t29 & 0x00000001u;
         /* 02205548 */ if (_t30) goto L_0220554C; else goto L_02205560;
   L_0220554C: ; // 0x220554c
@@ -947,8 +947,8 @@ void Gambit_fn_02205434(CPUState* cpu) {
         /* 0220555C */ _t32 = cpu->r[7] + 0x00000000u;
         /* 0220555C */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_02205560: ; // 0x2205560
-        /* 02205560 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 02205564 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205560 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 02205564 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205564 */ _t34 = _t33 & 0x00000001u;
         /* 02205564 */ if (_t34) goto L_02205568; else goto L_02205570;
   L_02205568: ; // 0x2205568
@@ -960,9 +960,9 @@ void Gambit_fn_02205434(CPUState* cpu) {
         /* 02205574 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 02205574 */ cpu->r[8] = _t35;
         /* 02205578 */ cpu->r[6] = 0x101D0000u;
-        /* 0220557C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0220557C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02205580 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 02205584 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205584 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205584 */ _t37 = _t36 & 0x00000001u;
         /* 02205584 */ if (_t37) goto L_02205588; else goto L_0220559C;
   L_02205588: ; // 0x2205588
@@ -1001,9 +1001,9 @@ void Gambit_fn_022055C0(CPUState* cpu) {
         /* 022055C4 */ _t0 = cpu->r[8] + 0xFFFFFD6Cu;
         /* 022055C4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 022055C8 */ cpu->r[6] = 0x101D0000u;
-        /* 022055CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 022055CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 022055D0 */ cpu->r[6] = cpu->r[6] + 0xFFFFFEB0u;
-        /* 022055D4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022055D4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022055D4 */ _t2 = _t1 & 0x00000001u;
         /* 022055D4 */ if (_t2) goto L_022055D8; else goto L_022055F0;
   L_022055D8: ; // 0x22055d8
@@ -1016,8 +1016,8 @@ void Gambit_fn_022055C0(CPUState* cpu) {
         /* 022055EC */ _t4 = cpu->r[6] + 0x00000000u;
         /* 022055EC */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_022055F0: ; // 0x22055f0
-        /* 022055F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 022055F4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022055F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 022055F4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022055F4 */ _t6 = _t5 & 0x00000001u;
         /* 022055F4 */ if (_t6) goto L_022055F8; else goto L_02205600;
   L_022055F8: ; // 0x22055f8
@@ -1028,9 +1028,9 @@ void Gambit_fn_022055C0(CPUState* cpu) {
         /* 02205604 */ _t7 = cpu->r[10] + 0xFFFFFD60u;
         /* 02205604 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 02205608 */ cpu->r[8] = 0x101D0000u;
-        /* 0220560C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0220560C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02205610 */ cpu->r[8] = cpu->r[8] + 0xFFFFFEA4u;
-        /* 02205614 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205614 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205614 */ _t9 = _t8 & 0x00000001u;
         /* 02205614 */ if (_t9) goto L_02205618; else goto L_02205630;
   L_02205618: ; // 0x2205618
@@ -1043,8 +1043,8 @@ void Gambit_fn_022055C0(CPUState* cpu) {
         /* 0220562C */ _t11 = cpu->r[8] + 0x00000000u;
         /* 0220562C */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_02205630: ; // 0x2205630
-        /* 02205630 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02205634 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205630 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02205634 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205634 */ _t13 = _t12 & 0x00000001u;
         /* 02205634 */ if (_t13) goto L_02205638; else goto L_02205640;
   L_02205638: ; // 0x2205638
@@ -1055,9 +1055,9 @@ void Gambit_fn_022055C0(CPUState* cpu) {
         /* 02205644 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 02205644 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 02205648 */ cpu->r[10] = 0x101D0000u;
-        /* 0220564C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0220564C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02205650 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 02205654 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205654 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205654 */ _t16 = _t15 & 0x00000001u;
         /* 02205654 */ if (_t16) goto L_02205658; else goto L_02205670;
   L_02205658: ; // 0x2205658
@@ -1070,8 +1070,8 @@ void Gambit_fn_022055C0(CPUState* cpu) {
         /* 0220566C */ _t18 = cpu->r[10] + 0x00000000u;
         /* 0220566C */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_02205670: ; // 0x2205670
-        /* 02205670 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02205674 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205670 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02205674 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205674 */ _t20 = _t19 & 0x00000001u;
         /* 02205674 */ if (_t20) goto L_02205678; else goto L_02205680;
   L_02205678: ; // 0x2205678
@@ -1082,9 +1082,9 @@ void Gambit_fn_022055C0(CPUState* cpu) {
         /* 02205684 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 02205684 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 02205688 */ cpu->r[12] = 0x101D0000u;
-        /* 0220568C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220568C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02205690 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 02205694 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205694 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205694 */ _t23 = _t22 & 0x00000001u;
         /* 02205694 */ if (_t23) goto L_02205698; else goto L_022056B0;
   L_02205698: ; // 0x2205698
@@ -1097,8 +1097,8 @@ void Gambit_fn_022055C0(CPUState* cpu) {
         /* 022056AC */ _t25 = cpu->r[12] + 0x00000000u;
         /* 022056AC */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_022056B0: ; // 0x22056b0
-        /* 022056B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 022056B4 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022056B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 022056B4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022056B4 */ _t27 = _t26 & 0x00000001u;
         /* 022056B4 */ if (_t27) goto L_022056B8; else goto L_022056C0;
   L_022056B8: ; // 0x22056b8
@@ -1110,9 +1110,9 @@ void Gambit_fn_022055C0(CPUState* cpu) {
         /* 022056C4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 022056C4 */ cpu->r[10] = _t28;
         /* 022056C8 */ cpu->r[7] = 0x101D0000u;
-        /* 022056CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 022056CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 022056D0 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 022056D4 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022056D4 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022056D4 */ _t30 = _t29 & 0x00000001u;
         /* 022056D4 */ if (_t30) goto L_022056D8; else goto L_022056EC;
   L_022056D8: ; // 0x22056d8
@@ -1124,8 +1124,8 @@ void Gambit_fn_022055C0(CPUState* cpu) {
         /* 022056E8 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 022056E8 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_022056EC: ; // 0x22056ec
-        /* 022056EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 022056F0 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022056EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 022056F0 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022056F0 */ _t34 = _t33 & 0x00000001u;
         /* 022056F0 */ if (_t34) goto L_022056F4; else goto L_022056FC;
   L_022056F4: ; // 0x22056f4
@@ -1137,9 +1137,9 @@ void Gambit_fn_022055C0(CPUState* cpu) {
         /* 02205700 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 02205700 */ cpu->r[8] = _t35;
         /* 02205704 */ cpu->r[6] = 0x101D0000u;
-        /* 02205708 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02205708 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0220570C */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 02205710 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205710 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205710 */ _t37 = _t36 & 0x00000001u;
         /* 02205710 */ if (_t37) goto L_02205714; else goto L_02205728;
   L_02205714: ; // 0x2205714
@@ -1178,9 +1178,9 @@ void Gambit_fn_0220574C(CPUState* cpu) {
         /* 02205750 */ _t0 = cpu->r[8] + 0xFFFFFD70u;
         /* 02205750 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 02205754 */ cpu->r[6] = 0x101D0000u;
-        /* 02205758 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02205758 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0220575C */ cpu->r[6] = cpu->r[6] + 0xFFFFFEB4u;
-        /* 02205760 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205760 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205760 */ _t2 = _t1 & 0x00000001u;
         /* 02205760 */ if (_t2) goto L_02205764; else goto L_0220577C;
   L_02205764: ; // 0x2205764
@@ -1193,8 +1193,8 @@ void Gambit_fn_0220574C(CPUState* cpu) {
         /* 02205778 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 02205778 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_0220577C: ; // 0x220577c
-        /* 0220577C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 02205780 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220577C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 02205780 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205780 */ _t6 = _t5 & 0x00000001u;
         /* 02205780 */ if (_t6) goto L_02205784; else goto L_0220578C;
   L_02205784: ; // 0x2205784
@@ -1205,9 +1205,9 @@ void Gambit_fn_0220574C(CPUState* cpu) {
         /* 02205790 */ _t7 = cpu->r[10] + 0xFFFFFD60u;
         /* 02205790 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 02205794 */ cpu->r[8] = 0x101D0000u;
-        /* 02205798 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02205798 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0220579C */ cpu->r[8] = cpu->r[8] + 0xFFFFFEA4u;
-        /* 022057A0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022057A0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022057A0 */ _t9 = _t8 & 0x00000001u;
         /* 022057A0 */ if (_t9) goto L_022057A4; else goto L_022057BC;
   L_022057A4: ; // 0x22057a4
@@ -1220,8 +1220,8 @@ void Gambit_fn_0220574C(CPUState* cpu) {
         /* 022057B8 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 022057B8 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_022057BC: ; // 0x22057bc
-        /* 022057BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 022057C0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022057BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 022057C0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022057C0 */ _t13 = _t12 & 0x00000001u;
         /* 022057C0 */ if (_t13) goto L_022057C4; else goto L_022057CC;
   L_022057C4: ; // 0x22057c4
@@ -1232,9 +1232,9 @@ void Gambit_fn_0220574C(CPUState* cpu) {
         /* 022057D0 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 022057D0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 022057D4 */ cpu->r[10] = 0x101D0000u;
-        /* 022057D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 022057D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 022057DC */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 022057E0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022057E0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022057E0 */ _t16 = _t15 & 0x00000001u;
         /* 022057E0 */ if (_t16) goto L_022057E4; else goto L_022057FC;
   L_022057E4: ; // 0x22057e4
@@ -1247,8 +1247,8 @@ void Gambit_fn_0220574C(CPUState* cpu) {
         /* 022057F8 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 022057F8 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_022057FC: ; // 0x22057fc
-        /* 022057FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02205800 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022057FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02205800 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205800 */ _t20 = _t19 & 0x00000001u;
         /* 02205800 */ if (_t20) goto L_02205804; else goto L_0220580C;
   L_02205804: ; // 0x2205804
@@ -1259,9 +1259,9 @@ void Gambit_fn_0220574C(CPUState* cpu) {
         /* 02205810 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 02205810 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 02205814 */ cpu->r[12] = 0x101D0000u;
-        /* 02205818 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02205818 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220581C */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 02205820 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205820 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205820 */ _t23 = _t22 & 0x00000001u;
         /* 02205820 */ if (_t23) goto L_02205824; else goto L_0220583C;
   L_02205824: ; // 0x2205824
@@ -1274,8 +1274,8 @@ void Gambit_fn_0220574C(CPUState* cpu) {
         /* 02205838 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 02205838 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_0220583C: ; // 0x220583c
-        /* 0220583C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02205840 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220583C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02205840 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205840 */ _t27 = _t26 & 0x00000001u;
         /* 02205840 */ if (_t27) goto L_02205844; else goto L_0220584C;
   L_02205844: ; // 0x2205844
@@ -1287,9 +1287,9 @@ void Gambit_fn_0220574C(CPUState* cpu) {
         /* 02205850 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 02205850 */ cpu->r[10] = _t28;
         /* 02205854 */ cpu->r[7] = 0x101D0000u;
-        /* 02205858 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02205858 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220585C */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 02205860 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205860 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205860 */ _t30 = _t29 & 0x00000001u;
         /* 02205860 */ if (_t30) goto L_02205864; else goto L_02205878;
   L_02205864: ; // 0x2205864
@@ -1301,8 +1301,8 @@ void Gambit_fn_0220574C(CPUState* cpu) {
         /* 02205874 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 02205874 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_02205878: ; // 0x2205878
-        /* 02205878 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 0220587C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205878 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 0220587C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220587C */ _t34 = _t33 & 0x00000001u;
         /* 0220587C */ if (_t34) goto L_02205880; else goto L_02205888;
   L_02205880: ; // 0x2205880
@@ -1314,9 +1314,9 @@ void Gambit_fn_0220574C(CPUState* cpu) {
         /* 0220588C */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 0220588C */ cpu->r[8] = _t35;
         /* 02205890 */ cpu->r[6] = 0x101D0000u;
-        /* 02205894 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02205894 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02205898 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 0220589C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220589C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220589C */ _t37 = _t36 & 0x00000001u;
         /* 0220589C */ if (_t37) goto L_022058A0; else goto L_022058B4;
   L_022058A0: ; // 0x22058a0
@@ -1355,9 +1355,9 @@ void Gambit_fn_022058D8(CPUState* cpu) {
         /* 022058DC */ _t0 = cpu->r[8] + 0xFFFFFD74u;
         /* 022058DC */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 022058E0 */ cpu->r[6] = 0x101D0000u;
-        /* 022058E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 022058E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 022058E8 */ cpu->r[6] = cpu->r[6] + 0xFFFFFEB8u;
-        /* 022058EC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022058EC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022058EC */ _t2 = _t1 & 0x00000001u;
         /* 022058EC */ if (_t2) goto L_022058F0; else goto L_02205908;
   L_022058F0: ; // 0x22058f0
@@ -1370,8 +1370,8 @@ void Gambit_fn_022058D8(CPUState* cpu) {
         /* 02205904 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 02205904 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_02205908: ; // 0x2205908
-        /* 02205908 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 0220590C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205908 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 0220590C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220590C */ _t6 = _t5 & 0x00000001u;
         /* 0220590C */ if (_t6) goto L_02205910; else goto L_02205918;
   L_02205910: ; // 0x2205910
@@ -1382,9 +1382,9 @@ void Gambit_fn_022058D8(CPUState* cpu) {
         /* 0220591C */ _t7 = cpu->r[10] + 0xFFFFFD60u;
         /* 0220591C */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 02205920 */ cpu->r[8] = 0x101D0000u;
-        /* 02205924 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02205924 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02205928 */ cpu->r[8] = cpu->r[8] + 0xFFFFFEA4u;
-        /* 0220592C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220592C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220592C */ _t9 = _t8 & 0x00000001u;
         /* 0220592C */ if (_t9) goto L_02205930; else goto L_02205948;
   L_02205930: ; // 0x2205930
@@ -1397,8 +1397,8 @@ void Gambit_fn_022058D8(CPUState* cpu) {
         /* 02205944 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 02205944 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_02205948: ; // 0x2205948
-        /* 02205948 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 0220594C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205948 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 0220594C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220594C */ _t13 = _t12 & 0x00000001u;
         /* 0220594C */ if (_t13) goto L_02205950; else goto L_02205958;
   L_02205950: ; // 0x2205950
@@ -1409,9 +1409,9 @@ void Gambit_fn_022058D8(CPUState* cpu) {
         /* 0220595C */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 0220595C */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 02205960 */ cpu->r[10] = 0x101D0000u;
-        /* 02205964 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02205964 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02205968 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 0220596C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220596C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220596C */ _t16 = _t15 & 0x00000001u;
         /* 0220596C */ if (_t16) goto L_02205970; else goto L_02205988;
   L_02205970: ; // 0x2205970
@@ -1424,8 +1424,8 @@ void Gambit_fn_022058D8(CPUState* cpu) {
         /* 02205984 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 02205984 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_02205988: ; // 0x2205988
-        /* 02205988 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0220598C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0220598C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220598C */ _t20 = _t19 & 0x00000001u;
         /* 0220598C */ if (_t20) goto L_02205990; else goto L_02205998;
   L_02205990: ; // 0x2205990
@@ -1436,9 +1436,9 @@ void Gambit_fn_022058D8(CPUState* cpu) {
         /* 0220599C */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 0220599C */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 022059A0 */ cpu->r[12] = 0x101D0000u;
-        /* 022059A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 022059A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 022059A8 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 022059AC */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022059AC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022059AC */ _t23 = _t22 & 0x00000001u;
         /* 022059AC */ if (_t23) goto L_022059B0; else goto L_022059C8;
   L_022059B0: ; // 0x22059b0
@@ -1451,8 +1451,8 @@ void Gambit_fn_022058D8(CPUState* cpu) {
         /* 022059C4 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 022059C4 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_022059C8: ; // 0x22059c8
-        /* 022059C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 022059CC */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022059C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 022059CC */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022059CC */ _t27 = _t26 & 0x00000001u;
         /* 022059CC */ if (_t27) goto L_022059D0; else goto L_022059D8;
   L_022059D0: ; // 0x22059d0
@@ -1464,9 +1464,9 @@ void Gambit_fn_022058D8(CPUState* cpu) {
         /* 022059DC */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 022059DC */ cpu->r[10] = _t28;
         /* 022059E0 */ cpu->r[7] = 0x101D0000u;
-        /* 022059E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 022059E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 022059E8 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 022059EC */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022059EC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022059EC */ _t30 = _t29 & 0x00000001u;
         /* 022059EC */ if (_t30) goto L_022059F0; else goto L_02205A04;
   L_022059F0: ; // 0x22059f0
@@ -1478,8 +1478,8 @@ void Gambit_fn_022058D8(CPUState* cpu) {
         /* 02205A00 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 02205A00 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_02205A04: ; // 0x2205a04
-        /* 02205A04 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 02205A08 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205A04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 02205A08 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205A08 */ _t34 = _t33 & 0x00000001u;
         /* 02205A08 */ if (_t34) goto L_02205A0C; else goto L_02205A14;
   L_02205A0C: ; // 0x2205a0c
@@ -1491,9 +1491,9 @@ void Gambit_fn_022058D8(CPUState* cpu) {
         /* 02205A18 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 02205A18 */ cpu->r[8] = _t35;
         /* 02205A1C */ cpu->r[6] = 0x101D0000u;
-        /* 02205A20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02205A20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02205A24 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 02205A28 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205A28 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205A28 */ _t37 = _t36 & 0x00000001u;
         /* 02205A28 */ if (_t37) goto L_02205A2C; else goto L_02205A40;
   L_02205A2C: ; // 0x2205a2c
@@ -1532,9 +1532,9 @@ void Gambit_fn_02205A64(CPUState* cpu) {
         /* 02205A68 */ _t0 = cpu->r[8] + 0xFFFFFD78u;
         /* 02205A68 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 02205A6C */ cpu->r[6] = 0x101D0000u;
-        /* 02205A70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02205A70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02205A74 */ cpu->r[6] = cpu->r[6] + 0xFFFFFEBCu;
-        /* 02205A78 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205A78 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205A78 */ _t2 = _t1 & 0x00000001u;
         /* 02205A78 */ if (_t2) goto L_02205A7C; else goto L_02205A94;
   L_02205A7C: ; // 0x2205a7c
@@ -1547,8 +1547,8 @@ void Gambit_fn_02205A64(CPUState* cpu) {
         /* 02205A90 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 02205A90 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_02205A94: ; // 0x2205a94
-        /* 02205A94 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 02205A98 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205A94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 02205A98 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205A98 */ _t6 = _t5 & 0x00000001u;
         /* 02205A98 */ if (_t6) goto L_02205A9C; else goto L_02205AA4;
   L_02205A9C: ; // 0x2205a9c
@@ -1559,9 +1559,9 @@ void Gambit_fn_02205A64(CPUState* cpu) {
         /* 02205AA8 */ _t7 = cpu->r[10] + 0xFFFFFD60u;
         /* 02205AA8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 02205AAC */ cpu->r[8] = 0x101D0000u;
-        /* 02205AB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02205AB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02205AB4 */ cpu->r[8] = cpu->r[8] + 0xFFFFFEA4u;
-        /* 02205AB8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205AB8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205AB8 */ _t9 = _t8 & 0x00000001u;
         /* 02205AB8 */ if (_t9) goto L_02205ABC; else goto L_02205AD4;
   L_02205ABC: ; // 0x2205abc
@@ -1574,8 +1574,8 @@ void Gambit_fn_02205A64(CPUState* cpu) {
         /* 02205AD0 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 02205AD0 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_02205AD4: ; // 0x2205ad4
-        /* 02205AD4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02205AD8 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205AD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02205AD8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205AD8 */ _t13 = _t12 & 0x00000001u;
         /* 02205AD8 */ if (_t13) goto L_02205ADC; else goto L_02205AE4;
   L_02205ADC: ; // 0x2205adc
@@ -1586,9 +1586,9 @@ void Gambit_fn_02205A64(CPUState* cpu) {
         /* 02205AE8 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 02205AE8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 02205AEC */ cpu->r[10] = 0x101D0000u;
-        /* 02205AF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02205AF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02205AF4 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 02205AF8 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205AF8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205AF8 */ _t16 = _t15 & 0x00000001u;
         /* 02205AF8 */ if (_t16) goto L_02205AFC; else goto L_02205B14;
   L_02205AFC: ; // 0x2205afc
@@ -1601,8 +1601,8 @@ void Gambit_fn_02205A64(CPUState* cpu) {
         /* 02205B10 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 02205B10 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_02205B14: ; // 0x2205b14
-        /* 02205B14 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02205B18 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205B14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02205B18 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205B18 */ _t20 = _t19 & 0x00000001u;
         /* 02205B18 */ if (_t20) goto L_02205B1C; else goto L_02205B24;
   L_02205B1C: ; // 0x2205b1c
@@ -1613,9 +1613,9 @@ void Gambit_fn_02205A64(CPUState* cpu) {
         /* 02205B28 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 02205B28 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 02205B2C */ cpu->r[12] = 0x101D0000u;
-        /* 02205B30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02205B30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02205B34 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 02205B38 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205B38 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205B38 */ _t23 = _t22 & 0x00000001u;
         /* 02205B38 */ if (_t23) goto L_02205B3C; else goto L_02205B54;
   L_02205B3C: ; // 0x2205b3c
@@ -1628,8 +1628,8 @@ void Gambit_fn_02205A64(CPUState* cpu) {
         /* 02205B50 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 02205B50 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_02205B54: ; // 0x2205b54
-        /* 02205B54 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02205B58 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205B54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02205B58 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205B58 */ _t27 = _t26 & 0x00000001u;
         /* 02205B58 */ if (_t27) goto L_02205B5C; else goto L_02205B64;
   L_02205B5C: ; // 0x2205b5c
@@ -1641,9 +1641,9 @@ void Gambit_fn_02205A64(CPUState* cpu) {
         /* 02205B68 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 02205B68 */ cpu->r[10] = _t28;
         /* 02205B6C */ cpu->r[7] = 0x101D0000u;
-        /* 02205B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02205B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02205B74 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 02205B78 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205B78 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205B78 */ _t30 = _t29 & 0x00000001u;
         /* 02205B78 */ if (_t30) goto L_02205B7C; else goto L_02205B90;
   L_02205B7C: ; // 0x2205b7c
@@ -1655,8 +1655,8 @@ void Gambit_fn_02205A64(CPUState* cpu) {
         /* 02205B8C */ _t32 = cpu->r[7] + 0x00000000u;
         /* 02205B8C */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_02205B90: ; // 0x2205b90
-        /* 02205B90 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 02205B94 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205B90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 02205B94 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205B94 */ _t34 = _t33 & 0x00000001u;
         /* 02205B94 */ if (_t34) goto L_02205B98; else goto L_02205BA0;
   L_02205B98: ; // 0x2205b98
@@ -1668,9 +1668,9 @@ void Gambit_fn_02205A64(CPUState* cpu) {
         /* 02205BA4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 02205BA4 */ cpu->r[8] = _t35;
         /* 02205BA8 */ cpu->r[6] = 0x101D0000u;
-        /* 02205BAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02205BAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02205BB0 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 02205BB4 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205BB4 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205BB4 */ _t37 = _t36 & 0x00000001u;
         /* 02205BB4 */ if (_t37) goto L_02205BB8; else goto L_02205BCC;
   L_02205BB8: ; // 0x2205bb8
@@ -1709,18 +1709,18 @@ void Gambit_fn_02205BE4(CPUState* cpu) {
         /* 02205BF8 */ _t3 = cpu->r[1] + 0x00000018u;
         /* 02205BF8 */ rbrew_write_f32(cpu->mem, _t3, cpu->f[31]);
         /* 02205BFC */ cpu->r[31] = cpu->r[3];
-        /* 02205BFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02205BFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02205C00 */ _t4 = cpu->r[1] + 0x00000024u;
         /* 02205C00 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
-        /* 02205C04 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205C04 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205C04 */ _t6 = _t5 & 0x00000001u;
         /* 02205C04 */ if (_t6) goto L_02205C08; else goto L_02205C18;
   L_02205C08: ; // 0x2205c08
         /* 02205C08 */ cpu->r[3] = 0x00000180u;
         /* 02205C0C */ Gambit_fn_02801A78(cpu);
         /* 02205C10 */ cpu->r[31] = cpu->r[3];
-        /* 02205C10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02205C14 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205C10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02205C14 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205C14 */ _t8 = _t7 & 0x00000001u;
         /* 02205C14 */ if (_t8) goto L_02205C7C; else goto L_02205C18;
   L_02205C18: ; // 0x2205c18
@@ -1736,10 +1736,10 @@ void Gambit_fn_02205BE4(CPUState* cpu) {
         /* 02205C34 */ _t11 = cpu->r[31] + 0x0000012Cu;
         /* 02205C34 */ rbrew_write_f32(cpu->mem, _t11, cpu->f[31]);
         /* 02205C38 */ cpu->r[12] = cpu->r[31] + 0x00000130u;
-        /* 02205C38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02205C38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02205C3C */ _t12 = cpu->r[31] + 0x00000004u;
         /* 02205C3C */ rbrew_write32(cpu->mem, _t12, cpu->r[11]);
-        /* 02205C40 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205C40 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205C40 */ _t14 = _t13 & 0x00000001u;
         /* 02205C40 */ if (_t14) goto L_02205C44; else goto L_02205C4C;
   L_02205C44: ; // 0x2205c44
@@ -1747,8 +1747,8 @@ void Gambit_fn_02205BE4(CPUState* cpu) {
         /* 02205C48 */ Gambit_fn_02801A78(cpu);
   L_02205C4C: ; // 0x2205c4c
         /* 02205C4C */ cpu->r[0] = cpu->r[31] + 0x00000160u;
-        /* 02205C4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02205C50 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205C4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02205C50 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205C50 */ _t16 = _t15 & 0x00000001u;
         /* 02205C50 */ if (_t16) goto L_02205C54; else goto L_02205C5C;
   L_02205C54: ; // 0x2205c54
@@ -1778,7 +1778,7 @@ void Gambit_fn_02205BE4(CPUState* cpu) {
         /* 02205C84 */ cpu->r[31] = rbrew_read32(cpu->mem, _t25);
         /* 02205C88 */ _t26 = cpu->r[1] + 0x00000010u;
         /* 02205C88 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t26);
-        /* 02205C8C */ _t27 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02205C8C */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02205C8C */ _t28 = _t27 & 0x00000001u;
         /* 02205C8C */ if (_t28) goto L_02205C90; // else: addr-0 trap, fall-through
   L_02205C90: ; // 0x2205c90
@@ -1805,18 +1805,18 @@ void Gambit_fn_02205BE8(CPUState* cpu) {
         /* 02205BF8 */ _t3 = cpu->r[1] + 0x00000018u;
         /* 02205BF8 */ rbrew_write_f32(cpu->mem, _t3, cpu->f[31]);
         /* 02205BFC */ cpu->r[31] = cpu->r[3];
-        /* 02205BFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02205BFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02205C00 */ _t4 = cpu->r[1] + 0x00000024u;
         /* 02205C00 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
-        /* 02205C04 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205C04 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205C04 */ _t6 = _t5 & 0x00000001u;
         /* 02205C04 */ if (_t6) goto L_02205C08; else goto L_02205C18;
   L_02205C08: ; // 0x2205c08
         /* 02205C08 */ cpu->r[3] = 0x00000180u;
         /* 02205C0C */ Gambit_fn_02801A78(cpu);
         /* 02205C10 */ cpu->r[31] = cpu->r[3];
-        /* 02205C10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02205C14 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205C10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02205C14 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205C14 */ _t8 = _t7 & 0x00000001u;
         /* 02205C14 */ if (_t8) goto L_02205C7C; else goto L_02205C18;
   L_02205C18: ; // 0x2205c18
@@ -1832,10 +1832,10 @@ void Gambit_fn_02205BE8(CPUState* cpu) {
         /* 02205C34 */ _t11 = cpu->r[31] + 0x0000012Cu;
         /* 02205C34 */ rbrew_write_f32(cpu->mem, _t11, cpu->f[31]);
         /* 02205C38 */ cpu->r[12] = cpu->r[31] + 0x00000130u;
-        /* 02205C38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02205C38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02205C3C */ _t12 = cpu->r[31] + 0x00000004u;
         /* 02205C3C */ rbrew_write32(cpu->mem, _t12, cpu->r[11]);
-        /* 02205C40 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205C40 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205C40 */ _t14 = _t13 & 0x00000001u;
         /* 02205C40 */ if (_t14) goto L_02205C44; else goto L_02205C4C;
   L_02205C44: ; // 0x2205c44
@@ -1843,8 +1843,8 @@ void Gambit_fn_02205BE8(CPUState* cpu) {
         /* 02205C48 */ Gambit_fn_02801A78(cpu);
   L_02205C4C: ; // 0x2205c4c
         /* 02205C4C */ cpu->r[0] = cpu->r[31] + 0x00000160u;
-        /* 02205C4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02205C50 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205C4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02205C50 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205C50 */ _t16 = _t15 & 0x00000001u;
         /* 02205C50 */ if (_t16) goto L_02205C54; else goto L_02205C5C;
   L_02205C54: ; // 0x2205c54
@@ -1874,7 +1874,7 @@ void Gambit_fn_02205BE8(CPUState* cpu) {
         /* 02205C84 */ cpu->r[31] = rbrew_read32(cpu->mem, _t25);
         /* 02205C88 */ _t26 = cpu->r[1] + 0x00000010u;
         /* 02205C88 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t26);
-        /* 02205C8C */ _t27 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02205C8C */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02205C8C */ _t28 = _t27 & 0x00000001u;
         /* 02205C8C */ if (_t28) goto L_02205C90; // else: addr-0 trap, fall-through
   L_02205C90: ; // 0x2205c90
@@ -2126,12 +2126,12 @@ void Gambit_fn_02205D60(CPUState* cpu) {
         /* 02205DCC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t17);
         /* 02205DD0 */ cpu->f[30] = fma(cpu->f[9], cpu->f[9], cpu->f[8]);
         /* 02205DD4 */ cpu->f[29] = cpu->f[1];
-        /* 02205DD8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[0]);
+        /* 02205DD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[0]));
         /* 02205DDC */ cpu->r[30] = cpu->r[4];
         /* 02205DE0 */ cpu->f[1] = cpu->f[2];
         /* 02205DE4 */ cpu->r[27] = cpu->r[6];
         /* 02205DE8 */ cpu->r[31] = cpu->r[5];
-        /* 02205DEC */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02205DEC */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02205DEC */ _t19 = _t18 & 0x00000001u;
         /* 02205DEC */ if (_t19) goto L_02205DF0; else goto L_02205E30;
   L_02205DF0: ; // 0x2205df0
@@ -2173,20 +2173,20 @@ void Gambit_fn_02205D60(CPUState* cpu) {
         /* 02205E50 */ cpu->r[7] = rbrew_read32(cpu->mem, _t29);
         /* 02205E54 */ /* nop */
         /* 02205E58 */ /* nop */
-        /* 02205E5C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x00000007u);
+        /* 02205E5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x00000007u));
         /* 02205E60 */ _t30 = cpu->r[1] + 0x00000024u;
         /* 02205E60 */ rbrew_write_f32(cpu->mem, _t30, cpu->f[7]);
-        /* 02205E64 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02205E64 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02205E64 */ _t32 = _t31 & 0x00000001u;
         /* 02205E64 */ if (_t32) goto L_02205E68; else goto L_02205E98;
   L_02205E68: ; // 0x2205e68
-        /* 02205E68 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x00000001u);
-        /* 02205E6C */ _t33 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02205E68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x00000001u));
+        /* 02205E6C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02205E6C */ _t34 = _t33 & 0x00000001u;
         /* 02205E6C */ if (_t34) goto L_02205E70; else goto L_02205F98;
   L_02205E70: ; // 0x2205e70
-        /* 02205E70 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x00000004u);
-        /* 02205E74 */ _t35 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02205E70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x00000004u));
+        /* 02205E74 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02205E74 */ _t36 = _t35 & 0x00000001u;
         /* 02205E74 */ if (_t36) goto L_02205E78; else goto L_02205F58;
   L_02205E78: ; // 0x2205e78
@@ -2199,22 +2199,22 @@ void Gambit_fn_02205D60(CPUState* cpu) {
         /* 02205E90 */ cpu->f[11] = cpu->f[1];
         /* 02205E94 */ goto L_02206014;
   L_02205E98: ; // 0x2205e98
-        /* 02205E98 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x00000008u);
-        /* 02205E9C */ _t37 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02205E98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x00000008u));
+        /* 02205E9C */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02205E9C */ _t38 = _t37 & 0x00000001u;
         /* 02205E9C */ if (_t38) goto L_02205EA0; else goto L_02205F78;
   L_02205EA0: ; // 0x2205ea0
-        /* 02205EA0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x0000000Au);
-        /* 02205EA4 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02205EA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x0000000Au));
+        /* 02205EA4 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02205EA4 */ _t40 = _t39 & 0x00000001u;
         /* 02205EA4 */ if (_t40) goto L_02205EA8; else goto L_02205FB8;
   L_02205EA8: ; // 0x2205ea8
-        /* 02205EA8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x0000000Du);
-        /* 02205EAC */ _t41 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02205EA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x0000000Du));
+        /* 02205EAC */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02205EAC */ _t42 = _t41 & 0x00000001u;
         /* 02205EAC */ if (_t42) goto L_02205FD8; else goto L_02205EB0;
   L_02205EB0: ; // 0x2205eb0
-        /* 02205EB0 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02205EB0 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02205EB0 */ _t44 = _t43 & 0x00000001u;
         /* 02205EB0 */ if (_t44) goto L_02205FF8; else goto L_02205EB4;
   L_02205EB4: ; // 0x2205eb4
@@ -2407,7 +2407,7 @@ void Gambit_fn_02205D60(CPUState* cpu) {
         /* 022060C8 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t89);
         /* 022060CC */ _t90 = cpu->r[1] + 0x00000090u;
         /* 022060CC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t90);
-        /* 022060D0 */ _t91 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022060D0 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022060D0 */ _t92 = _t91 & 0x00000001u;
         /* 022060D0 */ if (_t92) goto L_022060D4; // else: addr-0 trap, fall-through
   L_022060D4: ; // 0x22060d4
@@ -2438,9 +2438,9 @@ void Gambit_fn_022060E4(CPUState* cpu) {
         /* 020559B8 */ cpu->r[11] = _t2;
         /* 020559BC */ cpu->r[30] = 0x101E0000u;
         /* 020559C0 */ cpu->r[27] = cpu->r[3];
-        /* 020559C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020559C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020559C8 */ cpu->r[30] = cpu->r[30] + 0xFFFF9FC4u;
-        /* 020559CC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020559CC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020559CC */ _t4 = _t3 & 0x00000001u;
         /* 020559CC */ if (_t4) goto L_020559E4; else goto L_020559D0;
   L_020559D0: ; // 0x20559d0
@@ -2483,23 +2483,23 @@ void Gambit_fn_022060E4(CPUState* cpu) {
         /* 02055A38 */ _t14 = cpu->r[7] + 0x00000000u;
         /* 02055A38 */ cpu->r[8] = rbrew_read8(cpu->mem, _t14);
         /* 02055A3C */ cpu->r[0] = 0x00080000u;
-        /* 02055A40 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[31]);
+        /* 02055A40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[31]));
         /* 02055A44 */ cpu->r[29] = 0x00000000u;
-        /* 02055A48 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02055A48 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02055A48 */ _t16 = _t15 & 0x00000001u;
         /* 02055A48 */ if (_t16) goto L_02055A70; else goto L_02055A4C;
   L_02055A4C: ; // 0x2055a4c
         /* 02055A4C */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 02055A50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[0]);
+        /* 02055A50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[0]));
         /* 02055A54 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02055A58 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02055A58 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02055A58 */ _t18 = _t17 & 0x00000001u;
         /* 02055A58 */ if (_t18) goto L_02055A6C; else goto L_02055A5C;
   L_02055A5C: ; // 0x2055a5c
         /* 02055A5C */ _t19 = cpu->r[7] + 0x00000000u;
         /* 02055A5C */ cpu->r[9] = rbrew_read8(cpu->mem, _t19);
-        /* 02055A60 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[31]);
-        /* 02055A64 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02055A60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[31]));
+        /* 02055A64 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02055A64 */ _t21 = _t20 & 0x00000001u;
         /* 02055A64 */ if (_t21) goto L_02055A68; else goto L_02055A4C;
   L_02055A68: ; // 0x2055a68
@@ -2509,8 +2509,8 @@ void Gambit_fn_022060E4(CPUState* cpu) {
   L_02055A70: ; // 0x2055a70
         /* 02055A70 */ _t22 = cpu->r[30] + 0x00000008u;
         /* 02055A70 */ cpu->r[9] = rbrew_read32(cpu->mem, _t22);
-        /* 02055A74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[9]);
-        /* 02055A78 */ _t23 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02055A74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[9]));
+        /* 02055A78 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02055A78 */ _t24 = _t23 & 0x00000001u;
         /* 02055A78 */ if (_t24) goto L_02055A80; else goto L_02055A7C;
   L_02055A7C: ; // 0x2055a7c
@@ -2642,16 +2642,16 @@ void Gambit_fn_02206120(CPUState* cpu) {
         /* 0220613C */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 02206140 */ cpu->r[29] = cpu->r[5];
         /* 02206144 */ Gambit_fn_022060F0(cpu);
-        /* 02206148 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000001u);
+        /* 02206148 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000001u));
         /* 0220614C */ cpu->r[12] = 0x00000000u;
         /* 02206150 */ _t5 = cpu->r[31] + 0x00000000u;
         /* 02206150 */ rbrew_write16(cpu->mem, _t5, (uint16_t)cpu->r[30]);
-        /* 02206154 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02206154 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02206154 */ _t7 = _t6 & 0x00000001u;
         /* 02206154 */ if (_t7) goto L_0220616C; else goto L_02206158;
   L_02206158: ; // 0x2206158
-        /* 02206158 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000002u);
-        /* 0220615C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02206158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000002u));
+        /* 0220615C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220615C */ _t9 = _t8 & 0x00000001u;
         /* 0220615C */ if (_t9) goto L_0220618C; else goto L_02206160;
   L_02206160: ; // 0x2206160
@@ -2714,16 +2714,16 @@ void Gambit_fn_02206124(CPUState* cpu) {
         /* 0220613C */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 02206140 */ cpu->r[29] = cpu->r[5];
         /* 02206144 */ Gambit_fn_022060F0(cpu);
-        /* 02206148 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000001u);
+        /* 02206148 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000001u));
         /* 0220614C */ cpu->r[12] = 0x00000000u;
         /* 02206150 */ _t5 = cpu->r[31] + 0x00000000u;
         /* 02206150 */ rbrew_write16(cpu->mem, _t5, (uint16_t)cpu->r[30]);
-        /* 02206154 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02206154 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02206154 */ _t7 = _t6 & 0x00000001u;
         /* 02206154 */ if (_t7) goto L_0220616C; else goto L_02206158;
   L_02206158: ; // 0x2206158
-        /* 02206158 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000002u);
-        /* 0220615C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02206158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000002u));
+        /* 0220615C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220615C */ _t9 = _t8 & 0x00000001u;
         /* 0220615C */ if (_t9) goto L_0220618C; else goto L_02206160;
   L_02206160: ; // 0x2206160
@@ -2797,7 +2797,7 @@ void Gambit_fn_022061C0(CPUState* cpu) {
         /* 022061E0 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 022061E4 */ _t7 = cpu->r[3] + 0x000000C8u;
         /* 022061E4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 022061E8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
+        /* 022061E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
         /* 022061EC */ _t8 = cpu->r[3] + 0x000000CCu;
         /* 022061EC */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
         /* 022061F0 */ _t9 = cpu->r[1] + 0x0000000Cu;
@@ -2805,7 +2805,7 @@ void Gambit_fn_022061C0(CPUState* cpu) {
         /* 022061F4 */ cpu->r[31] = cpu->r[3];
         /* 022061F8 */ _t10 = cpu->r[1] + 0x00000010u;
         /* 022061F8 */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
-        /* 022061FC */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022061FC */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022061FC */ _t12 = _t11 & 0x00000001u;
         /* 022061FC */ if (_t12) goto L_02206200; else goto L_02206274;
   L_02206200: ; // 0x2206200
@@ -2855,10 +2855,10 @@ void Gambit_fn_022061C0(CPUState* cpu) {
         /* 02206260 */ _t32 = cpu->r[31] + 0x000000CCu;
         /* 02206260 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
         /* 02206264 */ cpu->r[8] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x00000010u, 0x00000010u);
-        /* 02206264 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02206264 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02206268 */ _t33 = cpu->r[31] + 0x000000C8u;
         /* 02206268 */ rbrew_write32(cpu->mem, _t33, cpu->r[12]);
-        /* 0220626C */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220626C */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220626C */ _t35 = _t34 & 0x00000001u;
         /* 0220626C */ if (_t35) goto L_0220634C; else goto L_02206270;
   L_02206270: ; // 0x2206270
@@ -2868,8 +2868,8 @@ void Gambit_fn_022061C0(CPUState* cpu) {
         /* 02206278 */ _t36 = cpu->r[31] + 0x00000170u;
         /* 02206278 */ cpu->r[8] = rbrew_read32(cpu->mem, _t36);
         /* 0220627C */ cpu->r[8] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x00000010u, 0x00000010u);
-        /* 0220627C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02206280 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220627C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02206280 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02206280 */ _t38 = _t37 & 0x00000001u;
         /* 02206280 */ if (_t38) goto L_0220634C; else goto L_02206284;
   L_02206284: ; // 0x2206284
@@ -2885,8 +2885,8 @@ void Gambit_fn_022061C0(CPUState* cpu) {
         /* 0220629C */ cpu->f[7] = fma(cpu->f[8], cpu->f[8], cpu->f[9]);
         /* 022062A0 */ _t42 = cpu->r[10] + 0x00001988u;
         /* 022062A0 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t42);
-        /* 022062A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[11]);
-        /* 022062A8 */ _t43 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022062A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[11]));
+        /* 022062A8 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022062A8 */ _t44 = _t43 & 0x00000001u;
         /* 022062A8 */ if (_t44) goto L_022062E4; else goto L_022062AC;
   L_022062AC: ; // 0x22062ac
@@ -2989,7 +2989,7 @@ void Gambit_fn_022061C4(CPUState* cpu) {
         /* 022061E0 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 022061E4 */ _t7 = cpu->r[3] + 0x000000C8u;
         /* 022061E4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 022061E8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
+        /* 022061E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
         /* 022061EC */ _t8 = cpu->r[3] + 0x000000CCu;
         /* 022061EC */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
         /* 022061F0 */ _t9 = cpu->r[1] + 0x0000000Cu;
@@ -2997,7 +2997,7 @@ void Gambit_fn_022061C4(CPUState* cpu) {
         /* 022061F4 */ cpu->r[31] = cpu->r[3];
         /* 022061F8 */ _t10 = cpu->r[1] + 0x00000010u;
         /* 022061F8 */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
-        /* 022061FC */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022061FC */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022061FC */ _t12 = _t11 & 0x00000001u;
         /* 022061FC */ if (_t12) goto L_02206200; else goto L_02206274;
   L_02206200: ; // 0x2206200
@@ -3047,10 +3047,10 @@ void Gambit_fn_022061C4(CPUState* cpu) {
         /* 02206260 */ _t32 = cpu->r[31] + 0x000000CCu;
         /* 02206260 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
         /* 02206264 */ cpu->r[8] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x00000010u, 0x00000010u);
-        /* 02206264 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02206264 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02206268 */ _t33 = cpu->r[31] + 0x000000C8u;
         /* 02206268 */ rbrew_write32(cpu->mem, _t33, cpu->r[12]);
-        /* 0220626C */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220626C */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220626C */ _t35 = _t34 & 0x00000001u;
         /* 0220626C */ if (_t35) goto L_0220634C; else goto L_02206270;
   L_02206270: ; // 0x2206270
@@ -3060,8 +3060,8 @@ void Gambit_fn_022061C4(CPUState* cpu) {
         /* 02206278 */ _t36 = cpu->r[31] + 0x00000170u;
         /* 02206278 */ cpu->r[8] = rbrew_read32(cpu->mem, _t36);
         /* 0220627C */ cpu->r[8] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x00000010u, 0x00000010u);
-        /* 0220627C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02206280 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220627C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02206280 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02206280 */ _t38 = _t37 & 0x00000001u;
         /* 02206280 */ if (_t38) goto L_0220634C; else goto L_02206284;
   L_02206284: ; // 0x2206284
@@ -3077,8 +3077,8 @@ void Gambit_fn_022061C4(CPUState* cpu) {
         /* 0220629C */ cpu->f[7] = fma(cpu->f[8], cpu->f[8], cpu->f[9]);
         /* 022062A0 */ _t42 = cpu->r[10] + 0x00001988u;
         /* 022062A0 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t42);
-        /* 022062A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[11]);
-        /* 022062A8 */ _t43 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022062A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[11]));
+        /* 022062A8 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022062A8 */ _t44 = _t43 & 0x00000001u;
         /* 022062A8 */ if (_t44) goto L_022062E4; else goto L_022062AC;
   L_022062AC: ; // 0x22062ac
@@ -3275,13 +3275,13 @@ void Gambit_fn_022063C8(CPUState* cpu) {
         /* 022063E4 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t3);
         /* 022063E8 */ _t4 = cpu->r[1] + 0x0000002Cu;
         /* 022063E8 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
-        /* 022063EC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[1]);
+        /* 022063EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[1]));
         /* 022063F0 */ _t5 = cpu->r[1] + 0x00000010u;
         /* 022063F0 */ rbrew_write32(cpu->mem, _t5, cpu->r[30]);
         /* 022063F4 */ _t6 = cpu->r[1] + 0x00000014u;
         /* 022063F4 */ rbrew_write32(cpu->mem, _t6, cpu->r[31]);
         /* 022063F8 */ cpu->r[31] = cpu->r[3];
-        /* 022063FC */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022063FC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022063FC */ _t8 = _t7 & 0x00000001u;
         /* 022063FC */ if (_t8) goto L_02206400; else goto L_022064B4;
   L_02206400: ; // 0x2206400
@@ -3311,8 +3311,8 @@ void Gambit_fn_022063C8(CPUState* cpu) {
         /* 02206444 */ cpu->f[12] = (double)(float)cpu->f[11];
         /* 02206448 */ cpu->f[0] = (double)(float)cpu->f[10];
         /* 0220644C */ cpu->f[11] = cpu->f[12] / cpu->f[0];
-        /* 02206450 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[11]);
-        /* 02206454 */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02206450 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[11]));
+        /* 02206454 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02206454 */ _t16 = _t15 & 0x00000001u;
         /* 02206454 */ if (_t16) goto L_02206484; else goto L_02206458;
   L_02206458: ; // 0x2206458
@@ -3327,7 +3327,7 @@ void Gambit_fn_022063C8(CPUState* cpu) {
         /* 02206468 */ cpu->r[30] = rbrew_read32(cpu->mem, _t20);
         /* 0220646C */ _t21 = cpu->r[12] + 0x00001988u;
         /* 0220646C */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t21);
-        /* 02206470 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02206470 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02206470 */ _t23 = _t22 & 0x00000001u;
         /* 02206470 */ if (_t23) goto L_02206474; // else: addr-0 trap, fall-through
   L_02206474: ; // 0x2206474
@@ -3362,7 +3362,7 @@ void Gambit_fn_022063C8(CPUState* cpu) {
         /* 022064BC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t31);
         /* 022064C0 */ _t32 = cpu->r[1] + 0x00000010u;
         /* 022064C0 */ cpu->r[30] = rbrew_read32(cpu->mem, _t32);
-        /* 022064C4 */ _t33 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022064C4 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022064C4 */ _t34 = _t33 & 0x00000001u;
         /* 022064C4 */ if (_t34) goto L_022064C8; // else: addr-0 trap, fall-through
   L_022064C8: ; // 0x22064c8
@@ -3392,13 +3392,13 @@ void Gambit_fn_022063CC(CPUState* cpu) {
         /* 022063E4 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t3);
         /* 022063E8 */ _t4 = cpu->r[1] + 0x0000002Cu;
         /* 022063E8 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
-        /* 022063EC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[1]);
+        /* 022063EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[1]));
         /* 022063F0 */ _t5 = cpu->r[1] + 0x00000010u;
         /* 022063F0 */ rbrew_write32(cpu->mem, _t5, cpu->r[30]);
         /* 022063F4 */ _t6 = cpu->r[1] + 0x00000014u;
         /* 022063F4 */ rbrew_write32(cpu->mem, _t6, cpu->r[31]);
         /* 022063F8 */ cpu->r[31] = cpu->r[3];
-        /* 022063FC */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022063FC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022063FC */ _t8 = _t7 & 0x00000001u;
         /* 022063FC */ if (_t8) goto L_02206400; else goto L_022064B4;
   L_02206400: ; // 0x2206400
@@ -3428,8 +3428,8 @@ void Gambit_fn_022063CC(CPUState* cpu) {
         /* 02206444 */ cpu->f[12] = (double)(float)cpu->f[11];
         /* 02206448 */ cpu->f[0] = (double)(float)cpu->f[10];
         /* 0220644C */ cpu->f[11] = cpu->f[12] / cpu->f[0];
-        /* 02206450 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[11]);
-        /* 02206454 */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02206450 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[11]));
+        /* 02206454 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02206454 */ _t16 = _t15 & 0x00000001u;
         /* 02206454 */ if (_t16) goto L_02206484; else goto L_02206458;
   L_02206458: ; // 0x2206458
@@ -3444,7 +3444,7 @@ void Gambit_fn_022063CC(CPUState* cpu) {
         /* 02206468 */ cpu->r[30] = rbrew_read32(cpu->mem, _t20);
         /* 0220646C */ _t21 = cpu->r[12] + 0x00001988u;
         /* 0220646C */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t21);
-        /* 02206470 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02206470 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02206470 */ _t23 = _t22 & 0x00000001u;
         /* 02206470 */ if (_t23) goto L_02206474; // else: addr-0 trap, fall-through
   L_02206474: ; // 0x2206474
@@ -3479,7 +3479,7 @@ void Gambit_fn_022063CC(CPUState* cpu) {
         /* 022064BC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t31);
         /* 022064C0 */ _t32 = cpu->r[1] + 0x00000010u;
         /* 022064C0 */ cpu->r[30] = rbrew_read32(cpu->mem, _t32);
-        /* 022064C4 */ _t33 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022064C4 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022064C4 */ _t34 = _t33 & 0x00000001u;
         /* 022064C4 */ if (_t34) goto L_022064C8; // else: addr-0 trap, fall-through
   L_022064C8: ; // 0x22064c8
@@ -3536,9 +3536,9 @@ void Gambit_fn_022064D8(CPUState* cpu) {
         /* 02206534 */ cpu->r[3] = cpu->r[30];
         /* 02206538 */ Gambit_fn_022063C8(cpu);
         /* 0220653C */ cpu->f[13] = cpu->f[31] - cpu->f[30];
-        /* 02206540 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02206540 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02206544 */ cpu->f[13] = fma(cpu->f[13], cpu->f[1], cpu->f[30]);
-        /* 02206548 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02206548 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02206548 */ _t15 = _t14 & 0x00000001u;
         /* 02206548 */ if (_t15) goto L_02206558; else goto L_0220654C;
   L_0220654C: ; // 0x220654c
@@ -3566,7 +3566,7 @@ void Gambit_fn_022064D8(CPUState* cpu) {
         /* 02206578 */ cpu->r[31] = rbrew_read32(cpu->mem, _t23);
         /* 0220657C */ _t24 = cpu->r[1] + 0x00000010u;
         /* 0220657C */ cpu->r[30] = rbrew_read32(cpu->mem, _t24);
-        /* 02206580 */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02206580 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02206580 */ _t26 = _t25 & 0x00000001u;
         /* 02206580 */ if (_t26) goto L_02206584; // else: addr-0 trap, fall-through
   L_02206584: ; // 0x2206584
@@ -3622,9 +3622,9 @@ void Gambit_fn_022064DC(CPUState* cpu) {
         /* 02206534 */ cpu->r[3] = cpu->r[30];
         /* 02206538 */ Gambit_fn_022063C8(cpu);
         /* 0220653C */ cpu->f[13] = cpu->f[31] - cpu->f[30];
-        /* 02206540 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02206540 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02206544 */ cpu->f[13] = fma(cpu->f[13], cpu->f[1], cpu->f[30]);
-        /* 02206548 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02206548 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02206548 */ _t15 = _t14 & 0x00000001u;
         /* 02206548 */ if (_t15) goto L_02206558; else goto L_0220654C;
   L_0220654C: ; // 0x220654c
@@ -3652,7 +3652,7 @@ void Gambit_fn_022064DC(CPUState* cpu) {
         /* 02206578 */ cpu->r[31] = rbrew_read32(cpu->mem, _t23);
         /* 0220657C */ _t24 = cpu->r[1] + 0x00000010u;
         /* 0220657C */ cpu->r[30] = rbrew_read32(cpu->mem, _t24);
-        /* 02206580 */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02206580 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02206580 */ _t26 = _t25 & 0x00000001u;
         /* 02206580 */ if (_t26) goto L_02206584; // else: addr-0 trap, fall-through
   L_02206584: ; // 0x2206584
@@ -3913,7 +3913,7 @@ void Gambit_fn_02206654(CPUState* cpu) {
         /* 022066CC */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t14);
         /* 022066D0 */ _t15 = cpu->r[1] + 0x00000010u;
         /* 022066D0 */ cpu->f[29] = rbrew_read_f64(cpu->mem, _t15);
-        /* 022066D4 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022066D4 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022066D4 */ _t17 = _t16 & 0x00000001u;
         /* 022066D4 */ if (_t17) goto L_022066D8; // else: addr-0 trap, fall-through
   L_022066D8: ; // 0x22066d8
@@ -3977,7 +3977,7 @@ void Gambit_fn_02206658(CPUState* cpu) {
         /* 022066CC */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t14);
         /* 022066D0 */ _t15 = cpu->r[1] + 0x00000010u;
         /* 022066D0 */ cpu->f[29] = rbrew_read_f64(cpu->mem, _t15);
-        /* 022066D4 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022066D4 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022066D4 */ _t17 = _t16 & 0x00000001u;
         /* 022066D4 */ if (_t17) goto L_022066D8; // else: addr-0 trap, fall-through
   L_022066D8: ; // 0x22066d8
@@ -4045,7 +4045,7 @@ void Gambit_fn_022066E8(CPUState* cpu) {
         /* 0220676C */ cpu->r[31] = rbrew_read32(cpu->mem, _t14);
         /* 02206770 */ _t15 = cpu->r[1] + 0x00000010u;
         /* 02206770 */ cpu->f[29] = rbrew_read_f64(cpu->mem, _t15);
-        /* 02206774 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02206774 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02206774 */ _t17 = _t16 & 0x00000001u;
         /* 02206774 */ if (_t17) goto L_02206778; // else: addr-0 trap, fall-through
   L_02206778: ; // 0x2206778
@@ -4112,7 +4112,7 @@ void Gambit_fn_022066EC(CPUState* cpu) {
         /* 0220676C */ cpu->r[31] = rbrew_read32(cpu->mem, _t14);
         /* 02206770 */ _t15 = cpu->r[1] + 0x00000010u;
         /* 02206770 */ cpu->f[29] = rbrew_read_f64(cpu->mem, _t15);
-        /* 02206774 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02206774 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02206774 */ _t17 = _t16 & 0x00000001u;
         /* 02206774 */ if (_t17) goto L_02206778; // else: addr-0 trap, fall-through
   L_02206778: ; // 0x2206778
@@ -4262,24 +4262,24 @@ void Gambit_fn_022067B8(CPUState* cpu) {
         /* 02206890 */ _t26 = cpu->r[12] + 0x00001988u;
         /* 02206890 */ cpu->f[27] = rbrew_read_f32(cpu->mem, _t26);
         /* 02206894 */ cpu->f[12] = cpu->f[11] - cpu->f[8];
-        /* 02206898 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[27], cpu->f[29]);
+        /* 02206898 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[27], cpu->f[29]));
         /* 0220689C */ cpu->f[28] = (double)(float)cpu->f[12];
-        /* 022068A0 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022068A0 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022068A0 */ _t28 = _t27 & 0x00000001u;
         /* 022068A0 */ if (_t28) goto L_0220698C; else goto L_022068A4;
   L_022068A4: ; // 0x22068a4
-        /* 022068A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[27]);
-        /* 022068A8 */ _t29 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022068A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[27]));
+        /* 022068A8 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022068A8 */ _t30 = _t29 & 0x00000001u;
         /* 022068A8 */ if (_t30) goto L_022068AC; else goto L_02206A5C;
   L_022068AC: ; // 0x22068ac
-        /* 022068AC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[29]);
-        /* 022068B0 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022068AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[29]));
+        /* 022068B0 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022068B0 */ _t32 = _t31 & 0x00000001u;
         /* 022068B0 */ if (_t32) goto L_022068B4; else goto L_02206994;
   L_022068B4: ; // 0x22068b4
-        /* 022068B4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[27]);
-        /* 022068B8 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022068B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[27]));
+        /* 022068B8 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022068B8 */ _t34 = _t33 & 0x00000001u;
         /* 022068B8 */ if (_t34) goto L_022068CC; else goto L_022068BC;
   L_022068BC: ; // 0x22068bc
@@ -4354,16 +4354,16 @@ void Gambit_fn_022067B8(CPUState* cpu) {
         /* 02206970 */ cpu->f[11] = rbrew_read_f64(cpu->mem, _t56);
         /* 02206974 */ cpu->f[31] = (double)(float)cpu->f[0];
         /* 02206978 */ cpu->f[11] = cpu->f[10] - cpu->f[11];
-        /* 0220697C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[27], cpu->f[31]);
+        /* 0220697C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[27], cpu->f[31]));
         /* 02206980 */ cpu->f[30] = (double)(float)cpu->f[11];
-        /* 02206984 */ _t57 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02206984 */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02206984 */ _t58 = _t57 & 0x00000001u;
         /* 02206984 */ if (_t58) goto L_02206C70; else goto L_02206988;
   L_02206988: ; // 0x2206988
         /* 02206988 */ goto L_02206C00;
   L_0220698C: ; // 0x220698c
-        /* 0220698C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[29]);
-        /* 02206990 */ _t59 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220698C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[29]));
+        /* 02206990 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02206990 */ _t60 = _t59 & 0x00000001u;
         /* 02206990 */ if (_t60) goto L_02206A54; else goto L_02206994;
   L_02206994: ; // 0x2206994
@@ -4433,16 +4433,16 @@ void Gambit_fn_022067B8(CPUState* cpu) {
         /* 02206A38 */ cpu->f[11] = rbrew_read_f64(cpu->mem, _t82);
         /* 02206A3C */ cpu->f[31] = (double)(float)cpu->f[0];
         /* 02206A40 */ cpu->f[11] = cpu->f[10] - cpu->f[11];
-        /* 02206A44 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[27], cpu->f[31]);
+        /* 02206A44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[27], cpu->f[31]));
         /* 02206A48 */ cpu->f[30] = (double)(float)cpu->f[11];
-        /* 02206A4C */ _t83 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02206A4C */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02206A4C */ _t84 = _t83 & 0x00000001u;
         /* 02206A4C */ if (_t84) goto L_02206C70; else goto L_02206A50;
   L_02206A50: ; // 0x2206a50
         /* 02206A50 */ goto L_02206C00;
   L_02206A54: ; // 0x2206a54
-        /* 02206A54 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[27]);
-        /* 02206A58 */ _t85 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02206A54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[27]));
+        /* 02206A58 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02206A58 */ _t86 = _t85 & 0x00000001u;
         /* 02206A58 */ if (_t86) goto L_02206B1C; else goto L_02206A5C;
   L_02206A5C: ; // 0x2206a5c
@@ -4512,17 +4512,17 @@ void Gambit_fn_022067B8(CPUState* cpu) {
         /* 02206B00 */ cpu->f[11] = rbrew_read_f64(cpu->mem, _t108);
         /* 02206B04 */ cpu->f[31] = (double)(float)cpu->f[0];
         /* 02206B08 */ cpu->f[11] = cpu->f[10] - cpu->f[11];
-        /* 02206B0C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[27], cpu->f[31]);
+        /* 02206B0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[27], cpu->f[31]));
         /* 02206B10 */ cpu->f[30] = (double)(float)cpu->f[11];
-        /* 02206B14 */ _t109 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02206B14 */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02206B14 */ _t110 = _t109 & 0x00000001u;
         /* 02206B14 */ if (_t110) goto L_02206C70; else goto L_02206B18;
   L_02206B18: ; // 0x2206b18
         /* 02206B18 */ goto L_02206C00;
   L_02206B1C: ; // 0x2206b1c
         /* 02206B1C */ cpu->f[13] = -cpu->f[29];
-        /* 02206B20 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[27]);
-        /* 02206B24 */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02206B20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[27]));
+        /* 02206B24 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02206B24 */ _t112 = _t111 & 0x00000001u;
         /* 02206B24 */ if (_t112) goto L_02206B28; else goto L_02206B30;
   L_02206B28: ; // 0x2206b28
@@ -4601,24 +4601,24 @@ void Gambit_fn_022067B8(CPUState* cpu) {
         /* 02206BE8 */ cpu->f[11] = rbrew_read_f64(cpu->mem, _t134);
         /* 02206BEC */ cpu->f[31] = (double)(float)cpu->f[0];
         /* 02206BF0 */ cpu->f[11] = cpu->f[10] - cpu->f[11];
-        /* 02206BF4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[27], cpu->f[31]);
+        /* 02206BF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[27], cpu->f[31]));
         /* 02206BF8 */ cpu->f[30] = (double)(float)cpu->f[11];
-        /* 02206BFC */ _t135 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02206BFC */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02206BFC */ _t136 = _t135 & 0x00000001u;
         /* 02206BFC */ if (_t136) goto L_02206C70; else goto L_02206C00;
   L_02206C00: ; // 0x2206c00
-        /* 02206C00 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[27]);
-        /* 02206C04 */ _t137 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02206C00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[27]));
+        /* 02206C04 */ _t137 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02206C04 */ _t138 = _t137 & 0x00000001u;
         /* 02206C04 */ if (_t138) goto L_02206C08; else goto L_02206CC8;
   L_02206C08: ; // 0x2206c08
-        /* 02206C08 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
-        /* 02206C0C */ _t139 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02206C08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
+        /* 02206C0C */ _t139 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02206C0C */ _t140 = _t139 & 0x00000001u;
         /* 02206C0C */ if (_t140) goto L_02206C10; else goto L_02206C78;
   L_02206C10: ; // 0x2206c10
-        /* 02206C10 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[27]);
-        /* 02206C14 */ _t141 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02206C10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[27]));
+        /* 02206C14 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02206C14 */ _t142 = _t141 & 0x00000001u;
         /* 02206C14 */ if (_t142) goto L_02206C28; else goto L_02206C18;
   L_02206C18: ; // 0x2206c18
@@ -4649,15 +4649,15 @@ void Gambit_fn_022067B8(CPUState* cpu) {
         /* 02206C5C */ cpu->r[6] = cpu->r[1] + 0x00000028u;
         /* 02206C60 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02206C64 */ cpu->r[26] = cpu->r[3];
-        /* 02206C64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 02206C68 */ _t149 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02206C64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 02206C68 */ _t149 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02206C68 */ _t150 = _t149 & 0x00000001u;
         /* 02206C68 */ if (_t150) goto L_02206F9C; else goto L_02206C6C;
   L_02206C6C: ; // 0x2206c6c
         /* 02206C6C */ goto L_02206D74;
   L_02206C70: ; // 0x2206c70
-        /* 02206C70 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
-        /* 02206C74 */ _t151 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02206C70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
+        /* 02206C74 */ _t151 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02206C74 */ _t152 = _t151 & 0x00000001u;
         /* 02206C74 */ if (_t152) goto L_02206CC0; else goto L_02206C78;
   L_02206C78: ; // 0x2206c78
@@ -4683,15 +4683,15 @@ void Gambit_fn_022067B8(CPUState* cpu) {
         /* 02206CAC */ cpu->r[6] = cpu->r[1] + 0x00000028u;
         /* 02206CB0 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02206CB4 */ cpu->r[26] = cpu->r[3];
-        /* 02206CB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 02206CB8 */ _t159 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02206CB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 02206CB8 */ _t159 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02206CB8 */ _t160 = _t159 & 0x00000001u;
         /* 02206CB8 */ if (_t160) goto L_02206F9C; else goto L_02206CBC;
   L_02206CBC: ; // 0x2206cbc
         /* 02206CBC */ goto L_02206D74;
   L_02206CC0: ; // 0x2206cc0
-        /* 02206CC0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[27]);
-        /* 02206CC4 */ _t161 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02206CC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[27]));
+        /* 02206CC4 */ _t161 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02206CC4 */ _t162 = _t161 & 0x00000001u;
         /* 02206CC4 */ if (_t162) goto L_02206D10; else goto L_02206CC8;
   L_02206CC8: ; // 0x2206cc8
@@ -4717,16 +4717,16 @@ void Gambit_fn_022067B8(CPUState* cpu) {
         /* 02206CFC */ cpu->r[6] = cpu->r[1] + 0x00000028u;
         /* 02206D00 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02206D04 */ cpu->r[26] = cpu->r[3];
-        /* 02206D04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 02206D08 */ _t169 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02206D04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 02206D08 */ _t169 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02206D08 */ _t170 = _t169 & 0x00000001u;
         /* 02206D08 */ if (_t170) goto L_02206F9C; else goto L_02206D0C;
   L_02206D0C: ; // 0x2206d0c
         /* 02206D0C */ goto L_02206D74;
   L_02206D10: ; // 0x2206d10
         /* 02206D10 */ cpu->f[10] = -cpu->f[31];
-        /* 02206D14 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[27]);
-        /* 02206D18 */ _t171 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02206D14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[27]));
+        /* 02206D18 */ _t171 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02206D18 */ _t172 = _t171 & 0x00000001u;
         /* 02206D18 */ if (_t172) goto L_02206D30; else goto L_02206D1C;
   L_02206D1C: ; // 0x2206d1c
@@ -4758,23 +4758,23 @@ void Gambit_fn_022067B8(CPUState* cpu) {
         /* 02206D64 */ cpu->r[6] = cpu->r[1] + 0x00000028u;
         /* 02206D68 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02206D6C */ cpu->r[26] = cpu->r[3];
-        /* 02206D6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 02206D70 */ _t179 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02206D6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 02206D70 */ _t179 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02206D70 */ _t180 = _t179 & 0x00000001u;
         /* 02206D70 */ if (_t180) goto L_02206F9C; else goto L_02206D74;
   L_02206D74: ; // 0x2206d74
-        /* 02206D74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02206D78 */ _t181 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02206D74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02206D78 */ _t181 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02206D78 */ _t182 = _t181 & 0x00000001u;
         /* 02206D78 */ if (_t182) goto L_02206D94; else goto L_02206D7C;
   L_02206D7C: ; // 0x2206d7c
         /* 02206D7C */ _t183 = cpu->r[30] + 0x0000016Cu;
         /* 02206D7C */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t183);
         /* 02206D80 */ cpu->r[11] = 0x10040000u;
-        /* 02206D84 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[27]);
+        /* 02206D84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[27]));
         /* 02206D88 */ _t184 = cpu->r[11] + 0x000019B0u;
         /* 02206D88 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t184);
-        /* 02206D8C */ _t185 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02206D8C */ _t185 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02206D8C */ _t186 = _t185 & 0x00000001u;
         /* 02206D8C */ if (_t186) goto L_02206D90; else goto L_02206DF0;
   L_02206D90: ; // 0x2206d90
@@ -4792,15 +4792,15 @@ void Gambit_fn_022067B8(CPUState* cpu) {
         /* 02206DB0 */ cpu->f[31] = cpu->f[1];
         /* 02206DB4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02206DB8 */ cpu->f[31] = cpu->f[31] * cpu->f[1];
-        /* 02206DBC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[27]);
-        /* 02206DC0 */ _t189 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02206DBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[27]));
+        /* 02206DC0 */ _t189 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02206DC0 */ _t190 = _t189 & 0x00000001u;
         /* 02206DC0 */ if (_t190) goto L_02206DC4; else goto L_02206FA4;
   L_02206DC4: ; // 0x2206dc4
         /* 02206DC4 */ _t191 = cpu->r[30] + 0x0000016Cu;
         /* 02206DC4 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t191);
-        /* 02206DC8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[27]);
-        /* 02206DCC */ _t192 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02206DC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[27]));
+        /* 02206DCC */ _t192 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02206DCC */ _t193 = _t192 & 0x00000001u;
         /* 02206DCC */ if (_t193) goto L_02206DD0; else goto L_02206DF0;
   L_02206DD0: ; // 0x2206dd0
@@ -4811,10 +4811,10 @@ void Gambit_fn_022067B8(CPUState* cpu) {
         /* 02206DD8 */ cpu->r[31] = 0x00000000u;
         /* 02206DDC */ _t196 = cpu->r[1] + 0x00000020u;
         /* 02206DDC */ rbrew_write_f32(cpu->mem, _t196, cpu->f[13]);
-        /* 02206DE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 02206DE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 02206DE4 */ _t197 = cpu->r[1] + 0x00000024u;
         /* 02206DE4 */ rbrew_write_f32(cpu->mem, _t197, cpu->f[11]);
-        /* 02206DE8 */ _t198 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02206DE8 */ _t198 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02206DE8 */ _t199 = _t198 & 0x00000001u;
         /* 02206DE8 */ if (_t199) goto L_02206E60; else goto L_02206DEC;
   L_02206DEC: ; // 0x2206dec
@@ -4823,8 +4823,8 @@ void Gambit_fn_022067B8(CPUState* cpu) {
         /* 02206DF0 */ cpu->r[11] = 0x10040000u;
         /* 02206DF4 */ _t200 = cpu->r[11] + 0x000019B4u;
         /* 02206DF4 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t200);
-        /* 02206DF8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[9]);
-        /* 02206DFC */ _t201 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02206DF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[9]));
+        /* 02206DFC */ _t201 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02206DFC */ _t202 = _t201 & 0x00000001u;
         /* 02206DFC */ if (_t202) goto L_02206E00; else goto L_02206E14;
   L_02206E00: ; // 0x2206e00
@@ -4849,20 +4849,20 @@ void Gambit_fn_022067B8(CPUState* cpu) {
         /* 02206E30 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t206);
         /* 02206E34 */ _t207 = cpu->r[1] + 0x00000020u;
         /* 02206E34 */ rbrew_write_f32(cpu->mem, _t207, cpu->f[13]);
-        /* 02206E38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 02206E38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 02206E3C */ _t208 = cpu->r[1] + 0x00000024u;
         /* 02206E3C */ rbrew_write_f32(cpu->mem, _t208, cpu->f[11]);
-        /* 02206E40 */ _t209 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02206E40 */ _t209 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02206E40 */ _t210 = _t209 & 0x00000001u;
         /* 02206E40 */ if (_t210) goto L_02206E60; else goto L_02206E44;
   L_02206E44: ; // 0x2206e44
         /* 02206E44 */ cpu->f[12] = cpu->f[11] * cpu->f[11];
         /* 02206E48 */ cpu->f[11] = fma(cpu->f[13], cpu->f[13], cpu->f[12]);
         /* 02206E4C */ cpu->r[10] = 0x10040000u;
-        /* 02206E50 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[27]);
+        /* 02206E50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[27]));
         /* 02206E54 */ _t211 = cpu->r[10] + 0x00001994u;
         /* 02206E54 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t211);
-        /* 02206E58 */ _t212 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02206E58 */ _t212 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02206E58 */ _t213 = _t212 & 0x00000001u;
         /* 02206E58 */ if (_t213) goto L_02206E5C; else goto L_02206EB8;
   L_02206E5C: ; // 0x2206e5c
@@ -4878,8 +4878,8 @@ void Gambit_fn_022067B8(CPUState* cpu) {
         /* 02206E70 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t216);
         /* 02206E74 */ cpu->f[12] = cpu->f[11] * cpu->f[11];
         /* 02206E78 */ cpu->f[11] = fma(cpu->f[13], cpu->f[13], cpu->f[12]);
-        /* 02206E7C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[27]);
-        /* 02206E80 */ _t217 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02206E7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[27]));
+        /* 02206E80 */ _t217 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02206E80 */ _t218 = _t217 & 0x00000001u;
         /* 02206E80 */ if (_t218) goto L_02206E84; else goto L_02206EB8;
   L_02206E84: ; // 0x2206e84
@@ -4903,8 +4903,8 @@ void Gambit_fn_022067B8(CPUState* cpu) {
   L_02206EB8: ; // 0x2206eb8
         /* 02206EB8 */ _t223 = cpu->r[30] + 0x00000051u;
         /* 02206EB8 */ cpu->r[8] = rbrew_read8(cpu->mem, _t223);
-        /* 02206EBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02206EC0 */ _t224 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02206EBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02206EC0 */ _t224 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02206EC0 */ _t225 = _t224 & 0x00000001u;
         /* 02206EC0 */ if (_t225) goto L_02206F28; else goto L_02206EC4;
   L_02206EC4: ; // 0x2206ec4
@@ -4913,12 +4913,12 @@ void Gambit_fn_022067B8(CPUState* cpu) {
         /* 02206EC8 */ cpu->r[9] = 0x00000000u;
         /* 02206ECC */ _t227 = cpu->r[30] + 0x00000058u;
         /* 02206ECC */ cpu->r[6] = rbrew_read32(cpu->mem, _t227);
-        /* 02206ED0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 02206ED0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 02206ED4 */ _t228 = cpu->r[30] + 0x0000012Cu;
         /* 02206ED4 */ cpu->f[2] = rbrew_read_f32(cpu->mem, _t228);
         /* 02206ED8 */ _t229 = cpu->r[30] + 0x0000017Cu;
         /* 02206ED8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t229);
-        /* 02206EDC */ _t230 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02206EDC */ _t230 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02206EDC */ _t231 = _t230 & 0x00000001u;
         /* 02206EDC */ if (_t231) goto L_02206EE0; else goto L_02206EE4;
   L_02206EE0: ; // 0x2206ee0
@@ -4944,8 +4944,8 @@ void Gambit_fn_022067B8(CPUState* cpu) {
         /* 02206F14 */ _t237 = cpu->r[1] + 0x00000014u;
         /* 02206F14 */ rbrew_write32(cpu->mem, _t237, cpu->r[0]);
         /* 02206F18 */ Gambit_fn_0220A220(cpu);
-        /* 02206F1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02206F20 */ _t238 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02206F1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02206F20 */ _t238 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02206F20 */ _t239 = _t238 & 0x00000001u;
         /* 02206F20 */ if (_t239) goto L_02206F88; else goto L_02206F24;
   L_02206F24: ; // 0x2206f24
@@ -4956,12 +4956,12 @@ void Gambit_fn_022067B8(CPUState* cpu) {
         /* 02206F2C */ cpu->r[9] = 0x00000000u;
         /* 02206F30 */ _t241 = cpu->r[30] + 0x00000058u;
         /* 02206F30 */ cpu->r[6] = rbrew_read32(cpu->mem, _t241);
-        /* 02206F34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 02206F34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 02206F38 */ _t242 = cpu->r[30] + 0x0000012Cu;
         /* 02206F38 */ cpu->f[2] = rbrew_read_f32(cpu->mem, _t242);
         /* 02206F3C */ _t243 = cpu->r[30] + 0x0000017Cu;
         /* 02206F3C */ cpu->r[10] = rbrew_read32(cpu->mem, _t243);
-        /* 02206F40 */ _t244 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02206F40 */ _t244 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02206F40 */ _t245 = _t244 & 0x00000001u;
         /* 02206F40 */ if (_t245) goto L_02206F44; else goto L_02206F48;
   L_02206F44: ; // 0x2206f44
@@ -4987,8 +4987,8 @@ void Gambit_fn_022067B8(CPUState* cpu) {
         /* 02206F78 */ _t251 = cpu->r[1] + 0x00000014u;
         /* 02206F78 */ rbrew_write32(cpu->mem, _t251, cpu->r[0]);
         /* 02206F7C */ Gambit_fn_0220A5E4(cpu);
-        /* 02206F80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02206F84 */ _t252 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02206F80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02206F84 */ _t252 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02206F84 */ _t253 = _t252 & 0x00000001u;
         /* 02206F84 */ if (_t253) goto L_02206F88; else goto L_02206FB0;
   L_02206F88: ; // 0x2206f88
@@ -5001,8 +5001,8 @@ void Gambit_fn_022067B8(CPUState* cpu) {
         /* 02206F94 */ rbrew_write16(cpu->mem, _t256, (uint16_t)cpu->r[12]);
         /* 02206F98 */ goto L_02206FB0;
   L_02206F9C: ; // 0x2206f9c
-        /* 02206F9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02206FA0 */ _t257 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02206F9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02206FA0 */ _t257 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02206FA0 */ _t258 = _t257 & 0x00000001u;
         /* 02206FA0 */ if (_t258) goto L_02206FA4; else goto L_02206FB0;
   L_02206FA4: ; // 0x2206fa4
@@ -5033,7 +5033,7 @@ void Gambit_fn_022067B8(CPUState* cpu) {
         /* 02206FD4 */ cpu->f[27] = rbrew_read_f64(cpu->mem, _t269);
         /* 02206FD8 */ _t270 = cpu->r[1] + 0x00000098u;
         /* 02206FD8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t270);
-        /* 02206FDC */ _t271 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02206FDC */ _t271 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02206FDC */ _t272 = _t271 & 0x00000001u;
         /* 02206FDC */ if (_t272) goto L_02206FE0; // else: addr-0 trap, fall-through
   L_02206FE0: ; // 0x2206fe0
@@ -5099,7 +5099,7 @@ void Gambit_fn_02206FF0(CPUState* cpu) {
         /* 02207068 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t15);
         /* 0220706C */ _t16 = cpu->r[1] + 0x00000010u;
         /* 0220706C */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t16);
-        /* 02207070 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02207070 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02207070 */ _t18 = _t17 & 0x00000001u;
         /* 02207070 */ if (_t18) goto L_02207074; // else: addr-0 trap, fall-through
   L_02207074: ; // 0x2207074
@@ -5164,7 +5164,7 @@ void Gambit_fn_02206FF4(CPUState* cpu) {
         /* 02207068 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t15);
         /* 0220706C */ _t16 = cpu->r[1] + 0x00000010u;
         /* 0220706C */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t16);
-        /* 02207070 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02207070 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02207070 */ _t18 = _t17 & 0x00000001u;
         /* 02207070 */ if (_t18) goto L_02207074; // else: addr-0 trap, fall-through
   L_02207074: ; // 0x2207074
@@ -5456,8 +5456,8 @@ void Gambit_fn_02207160(CPUState* cpu) {
         /* 022071EC */ _t22 = cpu->r[31] + 0x00000170u;
         /* 022071EC */ cpu->r[10] = rbrew_read32(cpu->mem, _t22);
         /* 022071F0 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000011u, 0x00000011u);
-        /* 022071F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 022071F4 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022071F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 022071F4 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022071F4 */ _t24 = _t23 & 0x00000001u;
         /* 022071F4 */ if (_t24) goto L_022071F8; else goto L_02207758;
   L_022071F8: ; // 0x22071f8
@@ -5503,8 +5503,8 @@ void Gambit_fn_02207160(CPUState* cpu) {
         /* 02207268 */ cpu->f[13] = fma(cpu->f[9], cpu->f[10], cpu->f[13]);
         /* 0220726C */ _t36 = cpu->r[8] + 0x00001988u;
         /* 0220726C */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t36);
-        /* 02207270 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[29]);
-        /* 02207274 */ _t37 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02207270 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[29]));
+        /* 02207274 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02207274 */ _t38 = _t37 & 0x00000001u;
         /* 02207274 */ if (_t38) goto L_02207758; else goto L_02207278;
   L_02207278: ; // 0x2207278
@@ -5543,10 +5543,10 @@ void Gambit_fn_02207160(CPUState* cpu) {
         /* 022072C8 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t50);
         /* 022072CC */ cpu->f[10] = fma(cpu->f[13], cpu->f[13], cpu->f[0]);
         /* 022072D0 */ cpu->r[7] = 0x10040000u;
-        /* 022072D4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[29]);
+        /* 022072D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[29]));
         /* 022072D8 */ _t51 = cpu->r[7] + 0x0000198Cu;
         /* 022072D8 */ cpu->f[27] = rbrew_read_f32(cpu->mem, _t51);
-        /* 022072DC */ _t52 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022072DC */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022072DC */ _t53 = _t52 & 0x00000001u;
         /* 022072DC */ if (_t53) goto L_022072E0; else goto L_0220730C;
   L_022072E0: ; // 0x22072e0
@@ -5599,8 +5599,8 @@ void Gambit_fn_02207160(CPUState* cpu) {
         /* 0220735C */ _t68 = cpu->r[1] + 0x0000005Cu;
         /* 0220735C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t68);
         /* 02207360 */ cpu->f[8] = fma(cpu->f[11], cpu->f[11], cpu->f[12]);
-        /* 02207364 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[29]);
-        /* 02207368 */ _t69 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02207364 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[29]));
+        /* 02207368 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02207368 */ _t70 = _t69 & 0x00000001u;
         /* 02207368 */ if (_t70) goto L_0220736C; else goto L_02207398;
   L_0220736C: ; // 0x220736c
@@ -5678,8 +5678,8 @@ void Gambit_fn_02207160(CPUState* cpu) {
         /* 02207428 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t93);
         /* 0220742C */ /* nop */
         /* 02207430 */ cpu->f[6] = fma(cpu->f[13], cpu->f[0], cpu->f[11]);
-        /* 02207434 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[29]);
-        /* 02207438 */ _t94 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02207434 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[29]));
+        /* 02207438 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02207438 */ _t95 = _t94 & 0x00000001u;
         /* 02207438 */ if (_t95) goto L_02207758; else goto L_0220743C;
   L_0220743C: ; // 0x220743c
@@ -5698,8 +5698,8 @@ void Gambit_fn_02207160(CPUState* cpu) {
         /* 02207460 */ cpu->f[30] = cpu->f[1];
         /* 02207464 */ _t99 = cpu->r[31] + 0x0000012Cu;
         /* 02207464 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t99);
-        /* 02207468 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[30]);
-        /* 0220746C */ _t100 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02207468 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[30]));
+        /* 0220746C */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220746C */ _t101 = _t100 & 0x00000001u;
         /* 0220746C */ if (_t101) goto L_02207470; else goto L_02207554;
   L_02207470: ; // 0x2207470
@@ -5709,10 +5709,10 @@ void Gambit_fn_02207160(CPUState* cpu) {
         /* 0220747C */ cpu->r[3] = cpu->r[31];
         /* 02207480 */ Gambit_fn_02206398(cpu);
         /* 02207484 */ cpu->r[12] = 0x10040000u;
-        /* 02207488 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], cpu->r[30]);
+        /* 02207488 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], cpu->r[30]));
         /* 0220748C */ _t102 = cpu->r[12] + 0x00001994u;
         /* 0220748C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t102);
-        /* 02207490 */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02207490 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02207490 */ _t104 = _t103 & 0x00000001u;
         /* 02207490 */ if (_t104) goto L_022074DC; else goto L_02207494;
   L_02207494: ; // 0x2207494
@@ -5771,16 +5771,16 @@ void Gambit_fn_02207160(CPUState* cpu) {
         /* 0220752C */ /* nop */
         /* 02207530 */ _t118 = cpu->r[1] + 0x00000010u;
         /* 02207530 */ cpu->r[0] = rbrew_read32(cpu->mem, _t118);
-        /* 02207534 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[3]);
-        /* 02207538 */ _t119 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02207534 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[3]));
+        /* 02207538 */ _t119 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02207538 */ _t120 = _t119 & 0x00000001u;
         /* 02207538 */ if (_t120) goto L_0220753C; else goto L_02207544;
   L_0220753C: ; // 0x220753c
         /* 0220753C */ cpu->r[28] = cpu->r[3];
         /* 02207540 */ goto L_02207554;
   L_02207544: ; // 0x2207544
-        /* 02207544 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[28]);
-        /* 02207548 */ _t121 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02207544 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[28]));
+        /* 02207548 */ _t121 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02207548 */ _t122 = _t121 & 0x00000001u;
         /* 02207548 */ if (_t122) goto L_0220754C; else goto L_02207550;
   L_0220754C: ; // 0x220754c
@@ -5800,8 +5800,8 @@ void Gambit_fn_02207160(CPUState* cpu) {
         /* 02207570 */ cpu->r[29] = 0x00000001u;
         /* 02207574 */ goto L_02207720;
   L_02207578: ; // 0x2207578
-        /* 02207578 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[26]);
-        /* 0220757C */ _t125 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02207578 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[26]));
+        /* 0220757C */ _t125 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220757C */ _t126 = _t125 & 0x00000001u;
         /* 0220757C */ if (_t126) goto L_02207758; else goto L_02207580;
   L_02207580: ; // 0x2207580
@@ -5862,8 +5862,8 @@ void Gambit_fn_02207160(CPUState* cpu) {
         /* 0220760C */ cpu->f[0] = cpu->f[11] - cpu->f[6];
         /* 02207610 */ cpu->f[11] = cpu->f[7] * cpu->f[7];
         /* 02207614 */ cpu->f[12] = fma(cpu->f[0], cpu->f[0], cpu->f[11]);
-        /* 02207618 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[29]);
-        /* 0220761C */ _t146 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02207618 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[29]));
+        /* 0220761C */ _t146 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220761C */ _t147 = _t146 & 0x00000001u;
         /* 0220761C */ if (_t147) goto L_02207640; else goto L_02207620;
   L_02207620: ; // 0x2207620
@@ -5873,10 +5873,10 @@ void Gambit_fn_02207160(CPUState* cpu) {
         /* 02207628 */ _t149 = cpu->r[4] + 0x00000104u;
         /* 02207628 */ cpu->r[4] = rbrew_read8(cpu->mem, _t149);
         /* 0220762C */ cpu->f[22] = cpu->f[29] * cpu->f[12];
-        /* 02207630 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 02207630 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 02207634 */ _t150 = cpu->r[31] + 0x00000051u;
         /* 02207634 */ cpu->r[5] = rbrew_read8(cpu->mem, _t150);
-        /* 02207638 */ _t151 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02207638 */ _t151 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02207638 */ _t152 = _t151 & 0x00000001u;
         /* 02207638 */ if (_t152) goto L_02207718; else goto L_0220763C;
   L_0220763C: ; // 0x220763c
@@ -5895,10 +5895,10 @@ void Gambit_fn_02207160(CPUState* cpu) {
         /* 0220765C */ _t156 = cpu->r[4] + 0x00000104u;
         /* 0220765C */ cpu->r[4] = rbrew_read8(cpu->mem, _t156);
         /* 02207660 */ cpu->f[22] = cpu->f[23] * cpu->f[12];
-        /* 02207664 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 02207664 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 02207668 */ _t157 = cpu->r[31] + 0x00000051u;
         /* 02207668 */ cpu->r[5] = rbrew_read8(cpu->mem, _t157);
-        /* 0220766C */ _t158 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220766C */ _t158 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220766C */ _t159 = _t158 & 0x00000001u;
         /* 0220766C */ if (_t159) goto L_02207718; else goto L_02207670;
   L_02207670: ; // 0x2207670
@@ -5907,8 +5907,8 @@ void Gambit_fn_02207160(CPUState* cpu) {
         /* 02207678 */ cpu->r[3] = cpu->r[26];
         /* 0220767C */ Gambit_fn_021F000C(cpu);
         /* 02207680 */ cpu->r[24] = cpu->r[3];
-        /* 02207680 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 02207684 */ _t160 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02207680 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 02207684 */ _t160 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02207684 */ _t161 = _t160 & 0x00000001u;
         /* 02207684 */ if (_t161) goto L_02207718; else goto L_02207688;
   L_02207688: ; // 0x2207688
@@ -5918,10 +5918,10 @@ void Gambit_fn_02207160(CPUState* cpu) {
         /* 0220768C */ cpu->r[11] = rbrew_read8(cpu->mem, _t163);
         /* 02207690 */ _t164 = cpu->r[10] + 0x000003DCu;
         /* 02207690 */ cpu->r[0] = rbrew_read32(cpu->mem, _t164);
-        /* 02207694 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02207694 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02207698 */ cpu->r[3] = cpu->r[31];
         /* 0220769C */ cpu->ctr = cpu->r[0];
-        /* 022076A0 */ _t165 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022076A0 */ _t165 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022076A0 */ _t166 = _t165 & 0x00000001u;
         /* 022076A0 */ if (_t166) goto L_022076E4; else goto L_022076A4;
   L_022076A4: ; // 0x22076a4
@@ -5967,8 +5967,8 @@ void Gambit_fn_02207160(CPUState* cpu) {
         /* 02207718 */ cpu->r[25] = cpu->r[25] + 0x00000001u;
         /* 0220771C */ cpu->r[29] = cpu->r[29] + 0x00000001u;
   L_02207720: ; // 0x2207720
-        /* 02207720 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], cpu->r[28]);
-        /* 02207724 */ _t175 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02207720 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], cpu->r[28]));
+        /* 02207724 */ _t175 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02207724 */ _t176 = _t175 & 0x00000001u;
         /* 02207724 */ if (_t176) goto L_02207728; else goto L_02207758;
   L_02207728: ; // 0x2207728
@@ -5986,8 +5986,8 @@ void Gambit_fn_02207160(CPUState* cpu) {
         /* 02207744 */ cpu->f[8] = cpu->f[7] - cpu->f[9];
         /* 02207748 */ cpu->f[10] = (double)(float)cpu->f[8];
         /* 0220774C */ cpu->f[10] = cpu->f[10] * cpu->f[31];
-        /* 02207750 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[26]);
-        /* 02207754 */ _t181 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02207750 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[26]));
+        /* 02207754 */ _t181 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02207754 */ _t182 = _t181 & 0x00000001u;
         /* 02207754 */ if (_t182) goto L_02207758; else goto L_02207578;
   L_02207758: ; // 0x2207758
@@ -6032,7 +6032,7 @@ void Gambit_fn_02207160(CPUState* cpu) {
         /* 022077A4 */ cpu->f[22] = rbrew_read_f64(cpu->mem, _t201);
         /* 022077A8 */ _t202 = cpu->r[1] + 0x00000168u;
         /* 022077A8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t202);
-        /* 022077AC */ _t203 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022077AC */ _t203 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022077AC */ _t204 = _t203 & 0x00000001u;
         /* 022077AC */ if (_t204) goto L_022077B0; // else: addr-0 trap, fall-through
   L_022077B0: ; // 0x22077b0
@@ -6149,10 +6149,10 @@ void Gambit_fn_022077C0(CPUState* cpu) {
         /* 022078AC */ _t37 = cpu->r[12] + 0x0000198Cu;
         /* 022078AC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t37);
         /* 022078B0 */ cpu->r[11] = 0x10040000u;
-        /* 022078B4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[29]);
+        /* 022078B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[29]));
         /* 022078B8 */ _t38 = cpu->r[11] + 0x0000199Cu;
         /* 022078B8 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t38);
-        /* 022078BC */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022078BC */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022078BC */ _t40 = _t39 & 0x00000001u;
         /* 022078BC */ if (_t40) goto L_022078C0; else goto L_022078EC;
   L_022078C0: ; // 0x22078c0
@@ -6199,8 +6199,8 @@ void Gambit_fn_022077C0(CPUState* cpu) {
         /* 02207934 */ cpu->r[3] = cpu->r[29];
         /* 02207938 */ Gambit_fn_022066E8(cpu);
         /* 0220793C */ cpu->f[27] = cpu->f[30] * cpu->f[1];
-        /* 02207940 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[27], cpu->f[29]);
-        /* 02207944 */ _t51 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02207940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[27], cpu->f[29]));
+        /* 02207944 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02207944 */ _t52 = _t51 & 0x00000001u;
         /* 02207944 */ if (_t52) goto L_02207948; else goto L_02207C10;
   L_02207948: ; // 0x2207948
@@ -6209,36 +6209,36 @@ void Gambit_fn_022077C0(CPUState* cpu) {
         /* 0220794C */ cpu->f[10] = cpu->f[6] / cpu->f[27];
         /* 02207950 */ cpu->f[11] = (uint32_t)(int32_t)cpu->f[10];
         /* 02207954 */ cpu->r[5] = cpu->r[1] + 0x00000030u;
-        /* 02207958 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[29]);
+        /* 02207958 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[29]));
         /* 0220795C */ /* nop */
         /* 02207960 */ _t54 = cpu->r[29] + 0x00000170u;
         /* 02207960 */ cpu->r[6] = rbrew_read32(cpu->mem, _t54);
         /* 02207964 */ _t55 = cpu->r[1] + 0x00000030u;
         /* 02207964 */ cpu->r[28] = rbrew_read32(cpu->mem, _t55);
-        /* 02207968 */ _t56 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02207968 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02207968 */ _t57 = _t56 & 0x00000001u;
         /* 02207968 */ if (_t57) goto L_0220796C; else goto L_02207970;
   L_0220796C: ; // 0x220796c
         /* 0220796C */ cpu->r[28] = 0xFFFFFFFFu;
   L_02207970: ; // 0x2207970
         /* 02207970 */ cpu->r[6] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x00000010u, 0x00000010u);
-        /* 02207970 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02207970 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 02207974 */ cpu->r[30] = 0x00000000u;
-        /* 02207978 */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02207978 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02207978 */ _t59 = _t58 & 0x00000001u;
         /* 02207978 */ if (_t59) goto L_02207988; else goto L_0220797C;
   L_0220797C: ; // 0x220797c
-        /* 0220797C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[29]);
-        /* 02207980 */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220797C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[29]));
+        /* 02207980 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02207980 */ _t61 = _t60 & 0x00000001u;
         /* 02207980 */ if (_t61) goto L_02207984; else goto L_02207988;
   L_02207984: ; // 0x2207984
         /* 02207984 */ cpu->r[30] = 0x00000001u;
   L_02207988: ; // 0x2207988
-        /* 02207988 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[29]);
+        /* 02207988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[29]));
         /* 0220798C */ cpu->r[30] = rbrew_rlwinm(cpu->r[30], 0x00000000u, 0x00000018u, 0x0000001Fu);
         /* 02207990 */ cpu->r[31] = 0x00000000u;
-        /* 02207994 */ _t62 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02207994 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02207994 */ _t63 = _t62 & 0x00000001u;
         /* 02207994 */ if (_t63) goto L_022079B4; else goto L_02207998;
   L_02207998: ; // 0x2207998
@@ -6246,10 +6246,10 @@ void Gambit_fn_022077C0(CPUState* cpu) {
         /* 0220799C */ Gambit_fn_02206788(cpu);
         /* 022079A0 */ _t64 = cpu->r[29] + 0x0000012Cu;
         /* 022079A0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t64);
-        /* 022079A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[1]);
+        /* 022079A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[1]));
         /* 022079A8 */ _t65 = cpu->r[29] + 0x00000128u;
         /* 022079A8 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t65);
-        /* 022079AC */ _t66 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022079AC */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022079AC */ _t67 = _t66 & 0x00000001u;
         /* 022079AC */ if (_t67) goto L_022079B4; else goto L_022079B0;
   L_022079B0: ; // 0x22079b0
@@ -6286,7 +6286,7 @@ void Gambit_fn_022077C0(CPUState* cpu) {
         /* 02207A08 */ cpu->f[10] = cpu->f[27] - cpu->f[30];
         /* 02207A0C */ cpu->f[7] = cpu->f[6] / cpu->f[27];
         /* 02207A10 */ cpu->r[0] = cpu->r[1] + 0x00000030u;
-        /* 02207A14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02207A14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02207A18 */ cpu->f[8] = (uint32_t)(int32_t)cpu->f[7];
         /* 02207A1C */ _t75 = cpu->r[29] + 0x00000128u;
         /* 02207A1C */ rbrew_write_f32(cpu->mem, _t75, cpu->f[6]);
@@ -6294,7 +6294,7 @@ void Gambit_fn_022077C0(CPUState* cpu) {
         /* 02207A24 */ /* nop */
         /* 02207A28 */ _t76 = cpu->r[1] + 0x00000030u;
         /* 02207A28 */ cpu->r[31] = rbrew_read32(cpu->mem, _t76);
-        /* 02207A2C */ _t77 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02207A2C */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02207A2C */ _t78 = _t77 & 0x00000001u;
         /* 02207A2C */ if (_t78) goto L_02207B28; else goto L_02207A30;
   L_02207A30: ; // 0x2207a30
@@ -6323,10 +6323,10 @@ void Gambit_fn_022077C0(CPUState* cpu) {
         /* 02207A70 */ _t85 = cpu->r[1] + 0x0000001Cu;
         /* 02207A70 */ rbrew_write_f32(cpu->mem, _t85, cpu->f[24]);
         /* 02207A74 */ cpu->f[13] = fma(cpu->f[24], cpu->f[24], cpu->f[8]);
-        /* 02207A78 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[29]);
+        /* 02207A78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[29]));
         /* 02207A7C */ _t86 = cpu->r[29] + 0x00000128u;
         /* 02207A7C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t86);
-        /* 02207A80 */ _t87 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02207A80 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02207A80 */ _t88 = _t87 & 0x00000001u;
         /* 02207A80 */ if (_t88) goto L_02207A84; else goto L_02207AB0;
   L_02207A84: ; // 0x2207a84
@@ -6390,21 +6390,21 @@ void Gambit_fn_022077C0(CPUState* cpu) {
         /* 02207B28 */ _t103 = cpu->r[29] + 0x00000114u;
         /* 02207B28 */ cpu->r[10] = rbrew_read32(cpu->mem, _t103);
         /* 02207B2C */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000011u, 0x00000011u);
-        /* 02207B2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02207B30 */ _t104 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02207B2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02207B30 */ _t104 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02207B30 */ _t105 = _t104 & 0x00000001u;
         /* 02207B30 */ if (_t105) goto L_02207B34; else goto L_02207C10;
   L_02207B34: ; // 0x2207b34
-        /* 02207B34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02207B38 */ _t106 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02207B34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02207B38 */ _t106 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02207B38 */ _t107 = _t106 & 0x00000001u;
         /* 02207B38 */ if (_t107) goto L_02207B74; else goto L_02207B3C;
   L_02207B3C: ; // 0x2207b3c
         /* 02207B3C */ _t108 = cpu->r[29] + 0x00000170u;
         /* 02207B3C */ cpu->r[0] = rbrew_read32(cpu->mem, _t108);
         /* 02207B40 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000012u);
-        /* 02207B40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02207B44 */ _t109 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02207B40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02207B44 */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02207B44 */ _t110 = _t109 & 0x00000001u;
         /* 02207B44 */ if (_t110) goto L_02207B60; else goto L_02207B48;
   L_02207B48: ; // 0x2207b48
@@ -6413,8 +6413,8 @@ void Gambit_fn_022077C0(CPUState* cpu) {
         /* 02207B50 */ Gambit_fn_02C693A4(cpu);
         /* 02207B54 */ _t111 = cpu->r[29] + 0x00000174u;
         /* 02207B54 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t111);
-        /* 02207B58 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[8]);
-        /* 02207B5C */ _t112 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02207B58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[8]));
+        /* 02207B5C */ _t112 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02207B5C */ _t113 = _t112 & 0x00000001u;
         /* 02207B5C */ if (_t113) goto L_02207B60; else goto L_02207B74;
   L_02207B60: ; // 0x2207b60
@@ -6425,8 +6425,8 @@ void Gambit_fn_022077C0(CPUState* cpu) {
         /* 02207B70 */ Gambit_fn_022067B8(cpu);
   L_02207B74: ; // 0x2207b74
         /* 02207B74 */ cpu->r[30] = cpu->r[31] - cpu->r[28];
-        /* 02207B74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02207B78 */ _t114 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02207B74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02207B78 */ _t114 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02207B78 */ _t115 = _t114 & 0x00000001u;
         /* 02207B78 */ if (_t115) goto L_02207B7C; else goto L_02207C10;
   L_02207B7C: ; // 0x2207b7c
@@ -6458,10 +6458,10 @@ void Gambit_fn_022077C0(CPUState* cpu) {
         /* 02207BC4 */ cpu->f[7] = cpu->f[13] + cpu->f[10];
         /* 02207BC8 */ /* nop */
         /* 02207BCC */ cpu->r[5] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x00000012u, 0x00000012u);
-        /* 02207BCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02207BCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02207BD0 */ _t122 = cpu->r[1] + 0x00000010u;
         /* 02207BD0 */ rbrew_write_f32(cpu->mem, _t122, cpu->f[7]);
-        /* 02207BD4 */ _t123 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02207BD4 */ _t123 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02207BD4 */ _t124 = _t123 & 0x00000001u;
         /* 02207BD4 */ if (_t124) goto L_02207BF0; else goto L_02207BD8;
   L_02207BD8: ; // 0x2207bd8
@@ -6470,8 +6470,8 @@ void Gambit_fn_022077C0(CPUState* cpu) {
         /* 02207BE0 */ Gambit_fn_02C693A4(cpu);
         /* 02207BE4 */ _t125 = cpu->r[29] + 0x00000174u;
         /* 02207BE4 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t125);
-        /* 02207BE8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[8]);
-        /* 02207BEC */ _t126 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02207BE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[8]));
+        /* 02207BEC */ _t126 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02207BEC */ _t127 = _t126 & 0x00000001u;
         /* 02207BEC */ if (_t127) goto L_02207BF0; else goto L_02207C04;
   L_02207BF0: ; // 0x2207bf0
@@ -6482,9 +6482,9 @@ void Gambit_fn_022077C0(CPUState* cpu) {
         /* 02207C00 */ Gambit_fn_022067B8(cpu);
   L_02207C04: ; // 0x2207c04
         /* 02207C04 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 02207C04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02207C04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02207C08 */ cpu->f[26] = cpu->f[26] + cpu->f[31];
-        /* 02207C0C */ _t128 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02207C0C */ _t128 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02207C0C */ _t129 = _t128 & 0x00000001u;
         /* 02207C0C */ if (_t129) goto L_02207C10; else goto L_02207B84;
   L_02207C10: ; // 0x2207c10
@@ -6506,8 +6506,8 @@ void Gambit_fn_022077C0(CPUState* cpu) {
         /* 02207C38 */ cpu->r[5] = cpu->r[1] + 0x00000020u;
         /* 02207C3C */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 02207C40 */ Gambit_fn_021C6DD8(cpu);
-        /* 02207C44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02207C48 */ _t135 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02207C44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02207C48 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02207C48 */ _t136 = _t135 & 0x00000001u;
         /* 02207C48 */ if (_t136) goto L_02207C4C; else goto L_02207C60;
   L_02207C4C: ; // 0x2207c4c
@@ -6553,14 +6553,14 @@ void Gambit_fn_022077C0(CPUState* cpu) {
         /* 02207CB8 */ rbrew_write32(cpu->mem, _t147, cpu->r[7]);
         /* 02207CBC */ _t148 = cpu->r[1] + 0x00000070u;
         /* 02207CBC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t148);
-        /* 02207CC0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[29]);
+        /* 02207CC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[29]));
         /* 02207CC4 */ _t149 = cpu->r[29] + 0x00000164u;
         /* 02207CC4 */ rbrew_write_f32(cpu->mem, _t149, cpu->f[13]);
         /* 02207CC8 */ _t150 = cpu->r[29] + 0x00000160u;
         /* 02207CC8 */ rbrew_write_f32(cpu->mem, _t150, cpu->f[12]);
         /* 02207CCC */ _t151 = cpu->r[29] + 0x00000168u;
         /* 02207CCC */ rbrew_write_f32(cpu->mem, _t151, cpu->f[0]);
-        /* 02207CD0 */ _t152 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02207CD0 */ _t152 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02207CD0 */ _t153 = _t152 & 0x00000001u;
         /* 02207CD0 */ if (_t153) goto L_02207CF4; else goto L_02207CD4;
   L_02207CD4: ; // 0x2207cd4
@@ -6615,7 +6615,7 @@ void Gambit_fn_022077C0(CPUState* cpu) {
         /* 02207D44 */ cpu->f[24] = rbrew_read_f64(cpu->mem, _t172);
         /* 02207D48 */ _t173 = cpu->r[1] + 0x000000E8u;
         /* 02207D48 */ cpu->r[30] = rbrew_read32(cpu->mem, _t173);
-        /* 02207D4C */ _t174 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02207D4C */ _t174 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02207D4C */ _t175 = _t174 & 0x00000001u;
         /* 02207D4C */ if (_t175) goto L_02207D50; // else: addr-0 trap, fall-through
   L_02207D50: ; // 0x2207d50
@@ -6681,8 +6681,8 @@ void Gambit_fn_02207D7C(CPUState* cpu) {
         /* 02207D90 */ _t3 = cpu->r[31] + 0x00000170u;
         /* 02207D90 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 02207D94 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000010u, 0x00000010u);
-        /* 02207D94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02207D98 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02207D94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02207D98 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02207D98 */ _t5 = _t4 & 0x00000001u;
         /* 02207D98 */ if (_t5) goto L_02207ED8; else goto L_02207D9C;
   L_02207D9C: ; // 0x2207d9c
@@ -6725,8 +6725,8 @@ void Gambit_fn_02207D7C(CPUState* cpu) {
         /* 02207DF4 */ cpu->f[8] = fma(cpu->f[11], cpu->f[11], cpu->f[0]);
         /* 02207DF8 */ _t20 = cpu->r[11] + 0x00001988u;
         /* 02207DF8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t20);
-        /* 02207DFC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[13]);
-        /* 02207E00 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02207DFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[13]));
+        /* 02207E00 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02207E00 */ _t22 = _t21 & 0x00000001u;
         /* 02207E00 */ if (_t22) goto L_02207E04; else goto L_02207E40;
   L_02207E04: ; // 0x2207e04
@@ -6757,8 +6757,8 @@ void Gambit_fn_02207D7C(CPUState* cpu) {
         /* 02207E48 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 02207E4C */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 02207E50 */ Gambit_fn_021C6DD8(cpu);
-        /* 02207E54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02207E58 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02207E54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02207E58 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02207E58 */ _t30 = _t29 & 0x00000001u;
         /* 02207E58 */ if (_t30) goto L_02207E5C; else goto L_02207E70;
   L_02207E5C: ; // 0x2207e5c
@@ -6835,8 +6835,8 @@ void Gambit_fn_02207D80(CPUState* cpu) {
         /* 02207D90 */ _t3 = cpu->r[31] + 0x00000170u;
         /* 02207D90 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 02207D94 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000010u, 0x00000010u);
-        /* 02207D94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02207D98 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02207D94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02207D98 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02207D98 */ _t5 = _t4 & 0x00000001u;
         /* 02207D98 */ if (_t5) goto L_02207ED8; else goto L_02207D9C;
   L_02207D9C: ; // 0x2207d9c
@@ -6879,8 +6879,8 @@ void Gambit_fn_02207D80(CPUState* cpu) {
         /* 02207DF4 */ cpu->f[8] = fma(cpu->f[11], cpu->f[11], cpu->f[0]);
         /* 02207DF8 */ _t20 = cpu->r[11] + 0x00001988u;
         /* 02207DF8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t20);
-        /* 02207DFC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[13]);
-        /* 02207E00 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02207DFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[13]));
+        /* 02207E00 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02207E00 */ _t22 = _t21 & 0x00000001u;
         /* 02207E00 */ if (_t22) goto L_02207E04; else goto L_02207E40;
   L_02207E04: ; // 0x2207e04
@@ -6911,8 +6911,8 @@ void Gambit_fn_02207D80(CPUState* cpu) {
         /* 02207E48 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 02207E4C */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 02207E50 */ Gambit_fn_021C6DD8(cpu);
-        /* 02207E54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02207E58 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02207E54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02207E58 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02207E58 */ _t30 = _t29 & 0x00000001u;
         /* 02207E58 */ if (_t30) goto L_02207E5C; else goto L_02207E70;
   L_02207E5C: ; // 0x2207e5c
@@ -7149,9 +7149,9 @@ void Gambit_fn_02207F7C(CPUState* cpu) {
         /* 02207FAC */ cpu->r[12] = rbrew_read32(cpu->mem, _t8);
         /* 02207FB0 */ _t9 = cpu->r[30] + 0x0000002Cu;
         /* 02207FB0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 02207FB4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
+        /* 02207FB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
         /* 02207FB8 */ cpu->r[31] = cpu->r[4];
-        /* 02207FBC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02207FBC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02207FBC */ _t11 = _t10 & 0x00000001u;
         /* 02207FBC */ if (_t11) goto L_02207FC0; else goto L_02207FF4;
   L_02207FC0: ; // 0x2207fc0
@@ -7170,7 +7170,7 @@ void Gambit_fn_02207F7C(CPUState* cpu) {
         /* 02207FD8 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t17);
         /* 02207FDC */ _t18 = cpu->r[1] + 0x00000008u;
         /* 02207FDC */ cpu->r[30] = rbrew_read32(cpu->mem, _t18);
-        /* 02207FE0 */ _t19 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02207FE0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02207FE0 */ _t20 = _t19 & 0x00000001u;
         /* 02207FE0 */ if (_t20) goto L_02207FE4; // else: addr-0 trap, fall-through
   L_02207FE4: ; // 0x2207fe4
@@ -7188,9 +7188,9 @@ void Gambit_fn_02207F7C(CPUState* cpu) {
         /* 02208004 */ cpu->f[30] = cpu->f[1];
         /* 02208008 */ _t23 = cpu->r[12] + 0x00001994u;
         /* 02208008 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t23);
-        /* 0220800C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[0]);
+        /* 0220800C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[0]));
         /* 02208010 */ cpu->r[3] = cpu->r[30];
-        /* 02208014 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02208014 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02208014 */ _t25 = _t24 & 0x00000001u;
         /* 02208014 */ if (_t25) goto L_02208034; else goto L_02208018;
   L_02208018: ; // 0x2208018
@@ -7198,8 +7198,8 @@ void Gambit_fn_02207F7C(CPUState* cpu) {
         /* 0220801C */ cpu->r[3] = cpu->r[31];
         /* 02208020 */ cpu->f[31] = cpu->f[1];
         /* 02208024 */ Gambit_fn_021BCFBC(cpu);
-        /* 02208028 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220802C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02208028 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220802C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220802C */ _t27 = _t26 & 0x00000001u;
         /* 0220802C */ if (_t27) goto L_02208080; else goto L_02208030;
   L_02208030: ; // 0x2208030
@@ -7213,13 +7213,13 @@ void Gambit_fn_02207F7C(CPUState* cpu) {
         /* 02208048 */ cpu->r[3] = cpu->r[31];
         /* 0220804C */ cpu->f[31] = fma(cpu->f[12], cpu->f[30], cpu->f[31]);
         /* 02208050 */ Gambit_fn_021BCFBC(cpu);
-        /* 02208054 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02208058 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02208054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02208058 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02208058 */ _t29 = _t28 & 0x00000001u;
         /* 02208058 */ if (_t29) goto L_02208080; else goto L_0220805C;
   L_0220805C: ; // 0x220805c
-        /* 0220805C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x0000000Cu);
-        /* 02208060 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220805C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x0000000Cu));
+        /* 02208060 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02208060 */ _t31 = _t30 & 0x00000001u;
         /* 02208060 */ if (_t31) goto L_02208064; else goto L_02208074;
   L_02208064: ; // 0x2208064
@@ -7247,7 +7247,7 @@ void Gambit_fn_02207F7C(CPUState* cpu) {
         /* 02208094 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t38);
         /* 02208098 */ _t39 = cpu->r[1] + 0x00000020u;
         /* 02208098 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t39);
-        /* 0220809C */ _t40 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220809C */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220809C */ _t41 = _t40 & 0x00000001u;
         /* 0220809C */ if (_t41) goto L_022080A0; // else: addr-0 trap, fall-through
   L_022080A0: ; // 0x22080a0
@@ -7287,9 +7287,9 @@ void Gambit_fn_02207F80(CPUState* cpu) {
         /* 02207FAC */ cpu->r[12] = rbrew_read32(cpu->mem, _t8);
         /* 02207FB0 */ _t9 = cpu->r[30] + 0x0000002Cu;
         /* 02207FB0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 02207FB4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
+        /* 02207FB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
         /* 02207FB8 */ cpu->r[31] = cpu->r[4];
-        /* 02207FBC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02207FBC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02207FBC */ _t11 = _t10 & 0x00000001u;
         /* 02207FBC */ if (_t11) goto L_02207FC0; else goto L_02207FF4;
   L_02207FC0: ; // 0x2207fc0
@@ -7308,7 +7308,7 @@ void Gambit_fn_02207F80(CPUState* cpu) {
         /* 02207FD8 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t17);
         /* 02207FDC */ _t18 = cpu->r[1] + 0x00000008u;
         /* 02207FDC */ cpu->r[30] = rbrew_read32(cpu->mem, _t18);
-        /* 02207FE0 */ _t19 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02207FE0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02207FE0 */ _t20 = _t19 & 0x00000001u;
         /* 02207FE0 */ if (_t20) goto L_02207FE4; // else: addr-0 trap, fall-through
   L_02207FE4: ; // 0x2207fe4
@@ -7326,9 +7326,9 @@ void Gambit_fn_02207F80(CPUState* cpu) {
         /* 02208004 */ cpu->f[30] = cpu->f[1];
         /* 02208008 */ _t23 = cpu->r[12] + 0x00001994u;
         /* 02208008 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t23);
-        /* 0220800C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[0]);
+        /* 0220800C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[0]));
         /* 02208010 */ cpu->r[3] = cpu->r[30];
-        /* 02208014 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02208014 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02208014 */ _t25 = _t24 & 0x00000001u;
         /* 02208014 */ if (_t25) goto L_02208034; else goto L_02208018;
   L_02208018: ; // 0x2208018
@@ -7336,8 +7336,8 @@ void Gambit_fn_02207F80(CPUState* cpu) {
         /* 0220801C */ cpu->r[3] = cpu->r[31];
         /* 02208020 */ cpu->f[31] = cpu->f[1];
         /* 02208024 */ Gambit_fn_021BCFBC(cpu);
-        /* 02208028 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220802C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02208028 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220802C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220802C */ _t27 = _t26 & 0x00000001u;
         /* 0220802C */ if (_t27) goto L_02208080; else goto L_02208030;
   L_02208030: ; // 0x2208030
@@ -7351,13 +7351,13 @@ void Gambit_fn_02207F80(CPUState* cpu) {
         /* 02208048 */ cpu->r[3] = cpu->r[31];
         /* 0220804C */ cpu->f[31] = fma(cpu->f[12], cpu->f[30], cpu->f[31]);
         /* 02208050 */ Gambit_fn_021BCFBC(cpu);
-        /* 02208054 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02208058 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02208054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02208058 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02208058 */ _t29 = _t28 & 0x00000001u;
         /* 02208058 */ if (_t29) goto L_02208080; else goto L_0220805C;
   L_0220805C: ; // 0x220805c
-        /* 0220805C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x0000000Cu);
-        /* 02208060 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220805C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x0000000Cu));
+        /* 02208060 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02208060 */ _t31 = _t30 & 0x00000001u;
         /* 02208060 */ if (_t31) goto L_02208064; else goto L_02208074;
   L_02208064: ; // 0x2208064
@@ -7385,7 +7385,7 @@ void Gambit_fn_02207F80(CPUState* cpu) {
         /* 02208094 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t38);
         /* 02208098 */ _t39 = cpu->r[1] + 0x00000020u;
         /* 02208098 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t39);
-        /* 0220809C */ _t40 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220809C */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220809C */ _t41 = _t40 & 0x00000001u;
         /* 0220809C */ if (_t41) goto L_022080A0; // else: addr-0 trap, fall-through
   L_022080A0: ; // 0x22080a0
@@ -7461,16 +7461,16 @@ void Gambit_fn_022080E0(CPUState* cpu) {
         /* 022080F8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t2);
         /* 022080FC */ cpu->r[28] = cpu->r[4];
         /* 02208100 */ cpu->r[0] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x0000001Cu, 0x0000001Eu);
-        /* 02208100 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02208100 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02208104 */ cpu->r[27] = 0x00000000u;
-        /* 02208108 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02208108 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02208108 */ _t4 = _t3 & 0x00000001u;
         /* 02208108 */ if (_t4) goto L_02208188; else goto L_0220810C;
   L_0220810C: ; // 0x220810c
         /* 0220810C */ _t5 = cpu->r[29] + 0x00000051u;
         /* 0220810C */ cpu->r[7] = rbrew_read8(cpu->mem, _t5);
-        /* 02208110 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 02208114 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02208110 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 02208114 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02208114 */ _t7 = _t6 & 0x00000001u;
         /* 02208114 */ if (_t7) goto L_02208210; else goto L_02208118;
   L_02208118: ; // 0x2208118
@@ -7510,9 +7510,9 @@ void Gambit_fn_022080E0(CPUState* cpu) {
         /* 02208170 */ cpu->r[0] = rbrew_read32(cpu->mem, _t18);
         /* 02208174 */ cpu->r[26] = cpu->r[9] + 0x00000258u;
         /* 02208178 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02208178 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02208178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0220817C */ cpu->r[31] = cpu->r[30] + 0x00000048u;
-        /* 02208180 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02208180 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02208180 */ _t20 = _t19 & 0x00000001u;
         /* 02208180 */ if (_t20) goto L_02208270; else goto L_02208184;
   L_02208184: ; // 0x2208184
@@ -7528,10 +7528,10 @@ void Gambit_fn_022080E0(CPUState* cpu) {
         /* 022081A0 */ _t22 = cpu->r[9] + cpu->r[0];
         /* 022081A0 */ cpu->r[26] = rbrew_read32(cpu->mem, _t22);
         /* 022081A4 */ cpu->r[31] = 0x00000000u;
-        /* 022081A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 022081A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 022081AC */ _t23 = cpu->r[1] + 0x0000000Cu;
         /* 022081AC */ rbrew_write32(cpu->mem, _t23, cpu->r[31]);
-        /* 022081B0 */ _t24 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022081B0 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022081B0 */ _t25 = _t24 & 0x00000001u;
         /* 022081B0 */ if (_t25) goto L_022081B4; else goto L_02208210;
   L_022081B4: ; // 0x22081b4
@@ -7546,8 +7546,8 @@ void Gambit_fn_022080E0(CPUState* cpu) {
         /* 022081D4 */ Gambit_fn_02040F70(cpu);
         /* 022081D8 */ _t26 = cpu->r[1] + 0x00000008u;
         /* 022081D8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t26);
-        /* 022081DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x000000FEu);
-        /* 022081E0 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022081DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x000000FEu));
+        /* 022081E0 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022081E0 */ _t28 = _t27 & 0x00000001u;
         /* 022081E0 */ if (_t28) goto L_02208204; else goto L_022081E4;
   L_022081E4: ; // 0x22081e4
@@ -7557,19 +7557,19 @@ void Gambit_fn_022080E0(CPUState* cpu) {
         /* 022081E8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t30);
         /* 022081EC */ cpu->r[31] = cpu->r[30] + 0x00000048u;
         /* 022081F0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022081F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 022081F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 022081F4 */ cpu->r[27] = 0x00000001u;
         /* 022081F8 */ cpu->r[26] = cpu->r[9] + 0x00000258u;
-        /* 022081FC */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022081FC */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022081FC */ _t32 = _t31 & 0x00000001u;
         /* 022081FC */ if (_t32) goto L_02208270; else goto L_02208200;
   L_02208200: ; // 0x2208200
         /* 02208200 */ goto L_02208228;
   L_02208204: ; // 0x2208204
         /* 02208204 */ cpu->r[26] = cpu->r[26] + 0xFFFFFFFFu;
-        /* 02208204 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 02208204 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 02208208 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0220820C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220820C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220820C */ _t34 = _t33 & 0x00000001u;
         /* 0220820C */ if (_t34) goto L_02208210; else goto L_022081B4;
   L_02208210: ; // 0x2208210
@@ -7579,9 +7579,9 @@ void Gambit_fn_022080E0(CPUState* cpu) {
         /* 02208214 */ cpu->r[0] = rbrew_read32(cpu->mem, _t36);
         /* 02208218 */ cpu->r[26] = cpu->r[9] + 0x00000258u;
         /* 0220821C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0220821C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0220821C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02208220 */ cpu->r[31] = cpu->r[30] + 0x00000048u;
-        /* 02208224 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02208224 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02208224 */ _t38 = _t37 & 0x00000001u;
         /* 02208224 */ if (_t38) goto L_02208270; else goto L_02208228;
   L_02208228: ; // 0x2208228
@@ -7590,10 +7590,10 @@ void Gambit_fn_022080E0(CPUState* cpu) {
         /* 02208230 */ cpu->r[10] = 0x10040000u;
         /* 02208234 */ _t39 = cpu->r[10] + 0x00001988u;
         /* 02208234 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t39);
-        /* 02208238 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[13]);
+        /* 02208238 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[13]));
         /* 0220823C */ _t40 = cpu->r[30] + 0x00000000u;
         /* 0220823C */ cpu->r[10] = rbrew_read32(cpu->mem, _t40);
-        /* 02208240 */ _t41 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02208240 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02208240 */ _t42 = _t41 & 0x00000001u;
         /* 02208240 */ if (_t42) goto L_02208244; else goto L_02208268;
   L_02208244: ; // 0x2208244
@@ -7640,8 +7640,8 @@ void Gambit_fn_022080E0(CPUState* cpu) {
         /* 022082B8 */ _t52 = cpu->r[30] + 0x0000015Cu;
         /* 022082B8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t52);
         /* 022082BC */ cpu->r[11] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 022082BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 022082C0 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022082BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 022082C0 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022082C0 */ _t54 = _t53 & 0x00000001u;
         /* 022082C0 */ if (_t54) goto L_022082DC; else goto L_022082C4;
   L_022082C4: ; // 0x22082c4
@@ -7699,8 +7699,8 @@ void Gambit_fn_02208304(CPUState* cpu) {
         /* 02208340 */ _t7 = cpu->r[29] + 0x0000015Cu;
         /* 02208340 */ cpu->r[0] = rbrew_read32(cpu->mem, _t7);
         /* 02208344 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 02208344 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02208348 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02208344 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02208348 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02208348 */ _t9 = _t8 & 0x00000001u;
         /* 02208348 */ if (_t9) goto L_02208364; else goto L_0220834C;
   L_0220834C: ; // 0x220834c
@@ -7762,8 +7762,8 @@ void Gambit_fn_02208308(CPUState* cpu) {
         /* 02208340 */ _t7 = cpu->r[29] + 0x0000015Cu;
         /* 02208340 */ cpu->r[0] = rbrew_read32(cpu->mem, _t7);
         /* 02208344 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 02208344 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02208348 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02208344 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02208348 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02208348 */ _t9 = _t8 & 0x00000001u;
         /* 02208348 */ if (_t9) goto L_02208364; else goto L_0220834C;
   L_0220834C: ; // 0x220834c
@@ -7820,16 +7820,16 @@ void Gambit_fn_02208394(CPUState* cpu) {
         /* 022083BC */ cpu->r[8] = 0x10040000u;
         /* 022083C0 */ _t6 = cpu->r[8] + 0x000019CCu;
         /* 022083C0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t6);
-        /* 022083C4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[1]);
-        /* 022083C8 */ _t7 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022083C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[1]));
+        /* 022083C8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022083C8 */ _t8 = _t7 & 0x00000001u;
         /* 022083C8 */ if (_t8) goto L_02208404; else goto L_022083CC;
   L_022083CC: ; // 0x22083cc
         /* 022083CC */ cpu->r[12] = 0x10040000u;
         /* 022083D0 */ _t9 = cpu->r[12] + 0x00001998u;
         /* 022083D0 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t9);
-        /* 022083D4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[11]);
-        /* 022083D8 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022083D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[11]));
+        /* 022083D8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022083D8 */ _t11 = _t10 & 0x00000001u;
         /* 022083D8 */ if (_t11) goto L_02208404; else goto L_022083DC;
   L_022083DC: ; // 0x22083dc
@@ -7844,7 +7844,7 @@ void Gambit_fn_02208394(CPUState* cpu) {
         /* 022083EC */ _t16 = cpu->r[30] + 0x00000000u;
         /* 022083EC */ rbrew_write16(cpu->mem, _t16, (uint16_t)cpu->r[31]);
         /* 022083F0 */ cpu->r[0] = cpu->r[9] & 0x0000FEFFu;
-        /* 022083F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 022083F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 022083F4 */ cpu->r[8] = 0x00000000u;
         /* 022083F8 */ _t17 = cpu->r[30] + 0x00000002u;
         /* 022083F8 */ rbrew_write16(cpu->mem, _t17, (uint16_t)cpu->r[0]);
@@ -7874,16 +7874,16 @@ void Gambit_fn_02208394(CPUState* cpu) {
         /* 02208438 */ cpu->f[7] = rbrew_read_f64(cpu->mem, _t24);
         /* 0220843C */ cpu->f[8] = cpu->f[7] - cpu->f[13];
         /* 02208440 */ cpu->f[0] = (double)(float)cpu->f[8];
-        /* 02208444 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[12]);
-        /* 02208448 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02208444 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[12]));
+        /* 02208448 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02208448 */ _t26 = _t25 & 0x00000001u;
         /* 02208448 */ if (_t26) goto L_02208460; else goto L_0220844C;
   L_0220844C: ; // 0x220844c
         /* 0220844C */ cpu->r[11] = 0x10040000u;
         /* 02208450 */ _t27 = cpu->r[11] + 0x00001988u;
         /* 02208450 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t27);
-        /* 02208454 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[0]);
-        /* 02208458 */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02208454 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[0]));
+        /* 02208458 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02208458 */ _t29 = _t28 & 0x00000001u;
         /* 02208458 */ if (_t29) goto L_02208460; else goto L_0220845C;
   L_0220845C: ; // 0x220845c
@@ -7900,7 +7900,7 @@ void Gambit_fn_02208394(CPUState* cpu) {
         /* 02208470 */ _t34 = cpu->r[30] + 0x00000000u;
         /* 02208470 */ rbrew_write16(cpu->mem, _t34, (uint16_t)cpu->r[31]);
         /* 02208474 */ cpu->r[0] = cpu->r[9] & 0x0000FEFFu;
-        /* 02208474 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02208474 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02208478 */ cpu->r[8] = cpu->r[12] + 0xFFFFFFFFu;
         /* 0220847C */ _t35 = cpu->r[30] + 0x00000002u;
         /* 0220847C */ rbrew_write16(cpu->mem, _t35, (uint16_t)cpu->r[0]);
@@ -7942,16 +7942,16 @@ void Gambit_fn_02208398(CPUState* cpu) {
         /* 022083BC */ cpu->r[8] = 0x10040000u;
         /* 022083C0 */ _t6 = cpu->r[8] + 0x000019CCu;
         /* 022083C0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t6);
-        /* 022083C4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[1]);
-        /* 022083C8 */ _t7 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022083C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[1]));
+        /* 022083C8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022083C8 */ _t8 = _t7 & 0x00000001u;
         /* 022083C8 */ if (_t8) goto L_02208404; else goto L_022083CC;
   L_022083CC: ; // 0x22083cc
         /* 022083CC */ cpu->r[12] = 0x10040000u;
         /* 022083D0 */ _t9 = cpu->r[12] + 0x00001998u;
         /* 022083D0 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t9);
-        /* 022083D4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[11]);
-        /* 022083D8 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022083D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[11]));
+        /* 022083D8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022083D8 */ _t11 = _t10 & 0x00000001u;
         /* 022083D8 */ if (_t11) goto L_02208404; else goto L_022083DC;
   L_022083DC: ; // 0x22083dc
@@ -7966,7 +7966,7 @@ void Gambit_fn_02208398(CPUState* cpu) {
         /* 022083EC */ _t16 = cpu->r[30] + 0x00000000u;
         /* 022083EC */ rbrew_write16(cpu->mem, _t16, (uint16_t)cpu->r[31]);
         /* 022083F0 */ cpu->r[0] = cpu->r[9] & 0x0000FEFFu;
-        /* 022083F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 022083F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 022083F4 */ cpu->r[8] = 0x00000000u;
         /* 022083F8 */ _t17 = cpu->r[30] + 0x00000002u;
         /* 022083F8 */ rbrew_write16(cpu->mem, _t17, (uint16_t)cpu->r[0]);
@@ -7996,16 +7996,16 @@ void Gambit_fn_02208398(CPUState* cpu) {
         /* 02208438 */ cpu->f[7] = rbrew_read_f64(cpu->mem, _t24);
         /* 0220843C */ cpu->f[8] = cpu->f[7] - cpu->f[13];
         /* 02208440 */ cpu->f[0] = (double)(float)cpu->f[8];
-        /* 02208444 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[12]);
-        /* 02208448 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02208444 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[12]));
+        /* 02208448 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02208448 */ _t26 = _t25 & 0x00000001u;
         /* 02208448 */ if (_t26) goto L_02208460; else goto L_0220844C;
   L_0220844C: ; // 0x220844c
         /* 0220844C */ cpu->r[11] = 0x10040000u;
         /* 02208450 */ _t27 = cpu->r[11] + 0x00001988u;
         /* 02208450 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t27);
-        /* 02208454 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[0]);
-        /* 02208458 */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02208454 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[0]));
+        /* 02208458 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02208458 */ _t29 = _t28 & 0x00000001u;
         /* 02208458 */ if (_t29) goto L_02208460; else goto L_0220845C;
   L_0220845C: ; // 0x220845c
@@ -8022,7 +8022,7 @@ void Gambit_fn_02208398(CPUState* cpu) {
         /* 02208470 */ _t34 = cpu->r[30] + 0x00000000u;
         /* 02208470 */ rbrew_write16(cpu->mem, _t34, (uint16_t)cpu->r[31]);
         /* 02208474 */ cpu->r[0] = cpu->r[9] & 0x0000FEFFu;
-        /* 02208474 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02208474 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02208478 */ cpu->r[8] = cpu->r[12] + 0xFFFFFFFFu;
         /* 0220847C */ _t35 = cpu->r[30] + 0x00000002u;
         /* 0220847C */ rbrew_write16(cpu->mem, _t35, (uint16_t)cpu->r[0]);
@@ -8192,7 +8192,7 @@ void Gambit_fn_022084FC(CPUState* cpu) {
         /* 02208574 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t14);
         /* 02208578 */ _t15 = cpu->r[1] + 0x0000000Cu;
         /* 02208578 */ cpu->r[31] = rbrew_read32(cpu->mem, _t15);
-        /* 0220857C */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220857C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220857C */ _t17 = _t16 & 0x00000001u;
         /* 0220857C */ if (_t17) goto L_02208580; // else: addr-0 trap, fall-through
   L_02208580: ; // 0x2208580
@@ -8256,7 +8256,7 @@ void Gambit_fn_02208500(CPUState* cpu) {
         /* 02208574 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t14);
         /* 02208578 */ _t15 = cpu->r[1] + 0x0000000Cu;
         /* 02208578 */ cpu->r[31] = rbrew_read32(cpu->mem, _t15);
-        /* 0220857C */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220857C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220857C */ _t17 = _t16 & 0x00000001u;
         /* 0220857C */ if (_t17) goto L_02208580; // else: addr-0 trap, fall-through
   L_02208580: ; // 0x2208580
@@ -8301,9 +8301,9 @@ void Gambit_fn_02208590(CPUState* cpu) {
         /* 022085D4 */ cpu->r[10] = cpu->r[28] + cpu->r[11];
         /* 022085D8 */ _t8 = cpu->r[10] + 0x00000104u;
         /* 022085D8 */ cpu->r[4] = rbrew_read8(cpu->mem, _t8);
-        /* 022085DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 022085DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 022085E0 */ cpu->r[7] = cpu->r[3];
-        /* 022085E4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022085E4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022085E4 */ _t10 = _t9 & 0x00000001u;
         /* 022085E4 */ if (_t10) goto L_02208660; else goto L_022085E8;
   L_022085E8: ; // 0x22085e8
@@ -8312,8 +8312,8 @@ void Gambit_fn_02208590(CPUState* cpu) {
         /* 022085F0 */ cpu->r[3] = cpu->r[28];
         /* 022085F4 */ Gambit_fn_021F000C(cpu);
         /* 022085F8 */ cpu->r[28] = cpu->r[3];
-        /* 022085F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 022085FC */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022085F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 022085FC */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022085FC */ _t12 = _t11 & 0x00000001u;
         /* 022085FC */ if (_t12) goto L_02208660; else goto L_02208600;
   L_02208600: ; // 0x2208600
@@ -8382,10 +8382,10 @@ void Gambit_fn_02208674(CPUState* cpu) {
         /* 02208690 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t4);
         /* 02208694 */ cpu->f[7] = fma(cpu->f[8], cpu->f[8], cpu->f[0]);
         /* 02208698 */ cpu->r[11] = 0x10040000u;
-        /* 0220869C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[11]);
+        /* 0220869C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[11]));
         /* 022086A0 */ _t5 = cpu->r[11] + 0x0000198Cu;
         /* 022086A0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t5);
-        /* 022086A4 */ _t6 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022086A4 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022086A4 */ _t7 = _t6 & 0x00000001u;
         /* 022086A4 */ if (_t7) goto L_022086A8; else goto L_022086C4;
   L_022086A8: ; // 0x22086a8
@@ -8408,10 +8408,10 @@ void Gambit_fn_02208674(CPUState* cpu) {
         /* 022086D0 */ _t13 = cpu->r[12] + 0x00001994u;
         /* 022086D0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t13);
         /* 022086D4 */ cpu->f[7] = fma(cpu->f[8], cpu->f[8], cpu->f[7]);
-        /* 022086D8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[11]);
+        /* 022086D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[11]));
         /* 022086DC */ _t14 = cpu->r[1] + 0x00000008u;
         /* 022086DC */ rbrew_write_f32(cpu->mem, _t14, cpu->f[8]);
-        /* 022086E0 */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022086E0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022086E0 */ _t16 = _t15 & 0x00000001u;
         /* 022086E0 */ if (_t16) goto L_022086E4; else goto L_02208708;
   L_022086E4: ; // 0x22086e4
@@ -8593,13 +8593,13 @@ void Gambit_fn_02208720(CPUState* cpu) {
         /* 02208890 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t51);
         /* 02208894 */ _t52 = cpu->r[26] + 0x00000178u;
         /* 02208894 */ rbrew_write_f32(cpu->mem, _t52, cpu->f[1]);
-        /* 02208898 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
+        /* 02208898 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
         /* 0220889C */ _t53 = cpu->r[7] + 0x0000198Cu;
         /* 0220889C */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t53);
         /* 022088A0 */ cpu->r[6] = 0x10040000u;
         /* 022088A4 */ _t54 = cpu->r[6] + 0x0000199Cu;
         /* 022088A4 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t54);
-        /* 022088A8 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022088A8 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022088A8 */ _t56 = _t55 & 0x00000001u;
         /* 022088A8 */ if (_t56) goto L_02208A34; else goto L_022088AC;
   L_022088AC: ; // 0x22088ac
@@ -8624,8 +8624,8 @@ void Gambit_fn_02208720(CPUState* cpu) {
         /* 022088D0 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t65);
         /* 022088D4 */ cpu->f[13] = fma(cpu->f[11], cpu->f[11], cpu->f[12]);
         /* 022088D8 */ cpu->f[10] = fma(cpu->f[9], cpu->f[9], cpu->f[13]);
-        /* 022088DC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
-        /* 022088E0 */ _t66 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022088DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
+        /* 022088E0 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022088E0 */ _t67 = _t66 & 0x00000001u;
         /* 022088E0 */ if (_t67) goto L_0220897C; else goto L_022088E4;
   L_022088E4: ; // 0x22088e4
@@ -8838,8 +8838,8 @@ void Gambit_fn_02208720(CPUState* cpu) {
         /* 02208AE4 */ _t144 = cpu->r[26] + 0x00000114u;
         /* 02208AE4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t144);
         /* 02208AE8 */ cpu->r[11] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 02208AE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02208AEC */ _t145 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02208AE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02208AEC */ _t145 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02208AEC */ _t146 = _t145 & 0x00000001u;
         /* 02208AEC */ if (_t146) goto L_02208CEC; else goto L_02208AF0;
   L_02208AF0: ; // 0x2208af0
@@ -8848,8 +8848,8 @@ void Gambit_fn_02208720(CPUState* cpu) {
         /* 02208AF4 */ _t148 = cpu->r[12] + 0x0000015Cu;
         /* 02208AF4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t148);
         /* 02208AF8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 02208AF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02208AFC */ _t149 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02208AF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02208AFC */ _t149 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02208AFC */ _t150 = _t149 & 0x00000001u;
         /* 02208AFC */ if (_t150) goto L_02208CEC; else goto L_02208B00;
   L_02208B00: ; // 0x2208b00
@@ -8870,8 +8870,8 @@ void Gambit_fn_02208720(CPUState* cpu) {
         /* 02208B2C */ cpu->r[3] = cpu->r[26];
         /* 02208B30 */ Gambit_fn_022066E8(cpu);
         /* 02208B34 */ cpu->f[26] = cpu->f[27] * cpu->f[1];
-        /* 02208B38 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[26], cpu->f[31]);
-        /* 02208B3C */ _t154 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02208B38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[26], cpu->f[31]));
+        /* 02208B3C */ _t154 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02208B3C */ _t155 = _t154 & 0x00000001u;
         /* 02208B3C */ if (_t155) goto L_02208B40; else goto L_02208CEC;
   L_02208B40: ; // 0x2208b40
@@ -8896,10 +8896,10 @@ void Gambit_fn_02208720(CPUState* cpu) {
         /* 02208B6C */ cpu->f[10] = fma(cpu->f[7], cpu->f[7], cpu->f[8]);
         /* 02208B70 */ cpu->f[7] = cpu->f[27] * cpu->f[27];
         /* 02208B74 */ cpu->f[0] = cpu->f[10] + cpu->f[7];
-        /* 02208B78 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[31]);
+        /* 02208B78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[31]));
         /* 02208B7C */ _t163 = cpu->r[1] + 0x00000010u;
         /* 02208B7C */ rbrew_write_f32(cpu->mem, _t163, cpu->f[27]);
-        /* 02208B80 */ _t164 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02208B80 */ _t164 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02208B80 */ _t165 = _t164 & 0x00000001u;
         /* 02208B80 */ if (_t165) goto L_02208B84; else goto L_02208BC0;
   L_02208B84: ; // 0x2208b84
@@ -8928,11 +8928,11 @@ void Gambit_fn_02208720(CPUState* cpu) {
         /* 02208BC4 */ cpu->r[7] = 0x10040000u;
         /* 02208BC8 */ _t171 = cpu->r[7] + 0x000019D0u;
         /* 02208BC8 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t171);
-        /* 02208BCC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[31]);
+        /* 02208BCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[31]));
         /* 02208BD0 */ cpu->r[8] = 0x10040000u;
         /* 02208BD4 */ _t172 = cpu->r[8] + 0x000019D4u;
         /* 02208BD4 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t172);
-        /* 02208BD8 */ _t173 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02208BD8 */ _t173 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02208BD8 */ _t174 = _t173 & 0x00000001u;
         /* 02208BD8 */ if (_t174) goto L_02208BDC; else goto L_02208BF4;
   L_02208BDC: ; // 0x2208bdc
@@ -8947,8 +8947,8 @@ void Gambit_fn_02208720(CPUState* cpu) {
         /* 02208BF0 */ cpu->f[27] = rbrew_read_f32(cpu->mem, _t177);
   L_02208BF4: ; // 0x2208bf4
         /* 02208BF4 */ cpu->f[11] = cpu->f[31] * cpu->f[7];
-        /* 02208BF8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[12]);
-        /* 02208BFC */ _t178 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02208BF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[12]));
+        /* 02208BFC */ _t178 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02208BFC */ _t179 = _t178 & 0x00000001u;
         /* 02208BFC */ if (_t179) goto L_02208C00; else goto L_02208C18;
   L_02208C00: ; // 0x2208c00
@@ -8960,8 +8960,8 @@ void Gambit_fn_02208720(CPUState* cpu) {
         /* 02208C10 */ rbrew_write_f32(cpu->mem, _t180, cpu->f[27]);
         /* 02208C14 */ goto L_02208C94;
   L_02208C18: ; // 0x2208c18
-        /* 02208C18 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[9]);
-        /* 02208C1C */ _t181 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02208C18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[9]));
+        /* 02208C1C */ _t181 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02208C1C */ _t182 = _t181 & 0x00000001u;
         /* 02208C1C */ if (_t182) goto L_02208C80; else goto L_02208C20;
   L_02208C20: ; // 0x2208c20
@@ -9049,10 +9049,10 @@ void Gambit_fn_02208720(CPUState* cpu) {
         /* 02208CFC */ _t206 = cpu->r[26] + 0x0000016Cu;
         /* 02208CFC */ rbrew_write_f32(cpu->mem, _t206, cpu->f[1]);
         /* 02208D00 */ cpu->f[13] = -cpu->f[0];
-        /* 02208D04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 02208D04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 02208D08 */ _t207 = cpu->r[26] + 0x00000128u;
         /* 02208D08 */ rbrew_write_f32(cpu->mem, _t207, cpu->f[13]);
-        /* 02208D0C */ _t208 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02208D0C */ _t208 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02208D0C */ _t209 = _t208 & 0x00000001u;
         /* 02208D0C */ if (_t209) goto L_02208DA0; else goto L_02208D10;
   L_02208D10: ; // 0x2208d10
@@ -9119,9 +9119,9 @@ void Gambit_fn_02208720(CPUState* cpu) {
         /* 02208DB8 */ rbrew_write32(cpu->mem, _t226, cpu->r[24]);
         /* 02208DBC */ Gambit_fn_022063C8(cpu);
         /* 02208DC0 */ cpu->f[30] = cpu->f[1];
-        /* 02208DC4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[28]);
+        /* 02208DC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[28]));
         /* 02208DC8 */ cpu->r[3] = cpu->r[26];
-        /* 02208DCC */ _t227 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02208DCC */ _t227 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02208DCC */ _t228 = _t227 & 0x00000001u;
         /* 02208DCC */ if (_t228) goto L_02208DF4; else goto L_02208DD0;
   L_02208DD0: ; // 0x2208dd0
@@ -9180,7 +9180,7 @@ void Gambit_fn_02208720(CPUState* cpu) {
         /* 02208E54 */ cpu->f[26] = rbrew_read_f64(cpu->mem, _t245);
         /* 02208E58 */ _t246 = cpu->r[1] + 0x00000150u;
         /* 02208E58 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t246);
-        /* 02208E5C */ _t247 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02208E5C */ _t247 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02208E5C */ _t248 = _t247 & 0x00000001u;
         /* 02208E5C */ if (_t248) goto L_02208E60; // else: addr-0 trap, fall-through
   L_02208E60: ; // 0x2208e60
@@ -9216,9 +9216,9 @@ void Gambit_fn_02208E70(CPUState* cpu) {
         /* 02208E98 */ cpu->r[4] = rbrew_read8(cpu->mem, _t5);
         /* 02208E9C */ cpu->r[8] = cpu->r[5];
         /* 02208EA0 */ cpu->r[7] = cpu->r[6];
-        /* 02208EA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 02208EA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 02208EA8 */ cpu->r[3] = 0x00000000u;
-        /* 02208EAC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02208EAC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02208EAC */ _t7 = _t6 & 0x00000001u;
         /* 02208EAC */ if (_t7) goto L_02208EC0; else goto L_02208EB0;
   L_02208EB0: ; // 0x2208eb0
@@ -9254,9 +9254,9 @@ void Gambit_fn_02208E80(CPUState* cpu) {
         /* 02208E98 */ cpu->r[4] = rbrew_read8(cpu->mem, _t4);
         /* 02208E9C */ cpu->r[8] = cpu->r[5];
         /* 02208EA0 */ cpu->r[7] = cpu->r[6];
-        /* 02208EA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 02208EA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 02208EA8 */ cpu->r[3] = 0x00000000u;
-        /* 02208EAC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02208EAC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02208EAC */ _t6 = _t5 & 0x00000001u;
         /* 02208EAC */ if (_t6) goto L_02208EC0; else goto L_02208EB0;
   L_02208EB0: ; // 0x2208eb0
@@ -9306,9 +9306,9 @@ void Gambit_fn_02208ED0(CPUState* cpu) {
         /* 026C03B0 */ cpu->r[29] = 0xFFFFFFFFu;
         /* 026C03B4 */ cpu->r[28] = 0x100F0000u;
         /* 026C03B8 */ cpu->r[30] = cpu->r[3];
-        /* 026C03BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 026C03BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 026C03C0 */ cpu->r[28] = cpu->r[28] + 0xFFFF8948u;
-        /* 026C03C4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C03C4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C03C4 */ _t10 = _t9 & 0x00000001u;
         /* 026C03C4 */ if (_t10) goto L_026C03C8; else goto L_026C03DC;
   L_026C03C8: ; // 0x26c03c8
@@ -9320,8 +9320,8 @@ void Gambit_fn_02208ED0(CPUState* cpu) {
         /* 026C03D8 */ _t12 = cpu->r[7] + 0xFFFFFEACu;
         /* 026C03D8 */ rbrew_write32(cpu->mem, _t12, cpu->r[28]);
   L_026C03DC: ; // 0x26c03dc
-        /* 026C03DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026C03E0 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C03DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026C03E0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C03E0 */ _t14 = _t13 & 0x00000001u;
         /* 026C03E0 */ if (_t14) goto L_026C041C; else goto L_026C03E4;
   L_026C03E4: ; // 0x26c03e4
@@ -9334,8 +9334,8 @@ void Gambit_fn_02208ED0(CPUState* cpu) {
         /* 026C03F4 */ cpu->r[4] = cpu->r[4] + 0xFFFFFEACu;
         /* 026C03F8 */ cpu->r[3] = cpu->r[31];
         /* 026C03FC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026C0400 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026C0404 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C0400 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026C0404 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C0404 */ _t18 = _t17 & 0x00000001u;
         /* 026C0404 */ if (_t18) goto L_026C041C; else goto L_026C0408;
   L_026C0408: ; // 0x26c0408
@@ -9351,8 +9351,8 @@ void Gambit_fn_02208ED0(CPUState* cpu) {
         /* 026C041C */ cpu->r[12] = 0x101D0000u;
         /* 026C0420 */ _t22 = cpu->r[12] + 0xFFFFFD6Cu;
         /* 026C0420 */ cpu->r[12] = rbrew_read32(cpu->mem, _t22);
-        /* 026C0424 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 026C0428 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C0424 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 026C0428 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C0428 */ _t24 = _t23 & 0x00000001u;
         /* 026C0428 */ if (_t24) goto L_026C042C; else goto L_026C0440;
   L_026C042C: ; // 0x26c042c
@@ -9364,8 +9364,8 @@ void Gambit_fn_02208ED0(CPUState* cpu) {
         /* 026C043C */ _t26 = cpu->r[8] + 0xFFFFFEB0u;
         /* 026C043C */ rbrew_write32(cpu->mem, _t26, cpu->r[28]);
   L_026C0440: ; // 0x26c0440
-        /* 026C0440 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026C0444 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C0440 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026C0444 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C0444 */ _t28 = _t27 & 0x00000001u;
         /* 026C0444 */ if (_t28) goto L_026C0480; else goto L_026C0448;
   L_026C0448: ; // 0x26c0448
@@ -9378,8 +9378,8 @@ void Gambit_fn_02208ED0(CPUState* cpu) {
         /* 026C0458 */ cpu->r[4] = cpu->r[4] + 0xFFFFFEB0u;
         /* 026C045C */ cpu->r[3] = cpu->r[31];
         /* 026C0460 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026C0464 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026C0468 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C0464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026C0468 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C0468 */ _t32 = _t31 & 0x00000001u;
         /* 026C0468 */ if (_t32) goto L_026C0480; else goto L_026C046C;
   L_026C046C: ; // 0x26c046c
@@ -9395,8 +9395,8 @@ void Gambit_fn_02208ED0(CPUState* cpu) {
         /* 026C0480 */ cpu->r[7] = 0x101D0000u;
         /* 026C0484 */ _t36 = cpu->r[7] + 0xFFFFFD64u;
         /* 026C0484 */ cpu->r[7] = rbrew_read32(cpu->mem, _t36);
-        /* 026C0488 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 026C048C */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C0488 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 026C048C */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C048C */ _t38 = _t37 & 0x00000001u;
         /* 026C048C */ if (_t38) goto L_026C0490; else goto L_026C04A4;
   L_026C0490: ; // 0x26c0490
@@ -9408,8 +9408,8 @@ void Gambit_fn_02208ED0(CPUState* cpu) {
         /* 026C04A0 */ _t40 = cpu->r[9] + 0xFFFFFEA8u;
         /* 026C04A0 */ rbrew_write32(cpu->mem, _t40, cpu->r[28]);
   L_026C04A4: ; // 0x26c04a4
-        /* 026C04A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026C04A8 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C04A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026C04A8 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C04A8 */ _t42 = _t41 & 0x00000001u;
         /* 026C04A8 */ if (_t42) goto L_026C04E4; else goto L_026C04AC;
   L_026C04AC: ; // 0x26c04ac
@@ -9422,8 +9422,8 @@ void Gambit_fn_02208ED0(CPUState* cpu) {
         /* 026C04BC */ cpu->r[4] = cpu->r[4] + 0xFFFFFEA8u;
         /* 026C04C0 */ cpu->r[3] = cpu->r[31];
         /* 026C04C4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026C04C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026C04CC */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C04C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026C04CC */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C04CC */ _t46 = _t45 & 0x00000001u;
         /* 026C04CC */ if (_t46) goto L_026C04E4; else goto L_026C04D0;
   L_026C04D0: ; // 0x26c04d0
@@ -9439,8 +9439,8 @@ void Gambit_fn_02208ED0(CPUState* cpu) {
         /* 026C04E4 */ cpu->r[8] = 0x101D0000u;
         /* 026C04E8 */ _t50 = cpu->r[8] + 0xFFFFFD70u;
         /* 026C04E8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t50);
-        /* 026C04EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 026C04F0 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C04EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 026C04F0 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C04F0 */ _t52 = _t51 & 0x00000001u;
         /* 026C04F0 */ if (_t52) goto L_026C04F4; else goto L_026C0508;
   L_026C04F4: ; // 0x26c04f4
@@ -9452,8 +9452,8 @@ void Gambit_fn_02208ED0(CPUState* cpu) {
         /* 026C0504 */ _t54 = cpu->r[10] + 0xFFFFFEB4u;
         /* 026C0504 */ rbrew_write32(cpu->mem, _t54, cpu->r[28]);
   L_026C0508: ; // 0x26c0508
-        /* 026C0508 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026C050C */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C0508 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026C050C */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C050C */ _t56 = _t55 & 0x00000001u;
         /* 026C050C */ if (_t56) goto L_026C0548; else goto L_026C0510;
   L_026C0510: ; // 0x26c0510
@@ -9466,8 +9466,8 @@ void Gambit_fn_02208ED0(CPUState* cpu) {
         /* 026C0520 */ cpu->r[4] = cpu->r[4] + 0xFFFFFEB4u;
         /* 026C0524 */ cpu->r[3] = cpu->r[31];
         /* 026C0528 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026C052C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026C0530 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C052C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026C0530 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C0530 */ _t60 = _t59 & 0x00000001u;
         /* 026C0530 */ if (_t60) goto L_026C0548; else goto L_026C0534;
   L_026C0534: ; // 0x26c0534
@@ -9483,8 +9483,8 @@ void Gambit_fn_02208ED0(CPUState* cpu) {
         /* 026C0548 */ cpu->r[9] = 0x101D0000u;
         /* 026C054C */ _t64 = cpu->r[9] + 0xFFFFFD74u;
         /* 026C054C */ cpu->r[9] = rbrew_read32(cpu->mem, _t64);
-        /* 026C0550 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 026C0554 */ _t65 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C0550 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 026C0554 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C0554 */ _t66 = _t65 & 0x00000001u;
         /* 026C0554 */ if (_t66) goto L_026C0558; else goto L_026C056C;
   L_026C0558: ; // 0x26c0558
@@ -9496,8 +9496,8 @@ void Gambit_fn_02208ED0(CPUState* cpu) {
         /* 026C0568 */ _t68 = cpu->r[11] + 0xFFFFFEB8u;
         /* 026C0568 */ rbrew_write32(cpu->mem, _t68, cpu->r[28]);
   L_026C056C: ; // 0x26c056c
-        /* 026C056C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026C0570 */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C056C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026C0570 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C0570 */ _t70 = _t69 & 0x00000001u;
         /* 026C0570 */ if (_t70) goto L_026C05AC; else goto L_026C0574;
   L_026C0574: ; // 0x26c0574
@@ -9510,8 +9510,8 @@ void Gambit_fn_02208ED0(CPUState* cpu) {
         /* 026C0584 */ cpu->r[4] = cpu->r[4] + 0xFFFFFEB8u;
         /* 026C0588 */ cpu->r[3] = cpu->r[31];
         /* 026C058C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026C0590 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026C0594 */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C0590 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026C0594 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C0594 */ _t74 = _t73 & 0x00000001u;
         /* 026C0594 */ if (_t74) goto L_026C05AC; else goto L_026C0598;
   L_026C0598: ; // 0x26c0598
@@ -9528,9 +9528,9 @@ void Gambit_fn_02208ED0(CPUState* cpu) {
         /* 026C05B0 */ _t78 = cpu->r[10] + 0xFFFFFD78u;
         /* 026C05B0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t78);
         /* 026C05B4 */ cpu->r[4] = 0x101D0000u;
-        /* 026C05B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 026C05B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 026C05BC */ cpu->r[4] = cpu->r[4] + 0xFFFFFEBCu;
-        /* 026C05C0 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C05C0 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C05C0 */ _t80 = _t79 & 0x00000001u;
         /* 026C05C0 */ if (_t80) goto L_026C05C4; else goto L_026C05D4;
   L_026C05C4: ; // 0x26c05c4
@@ -9541,8 +9541,8 @@ void Gambit_fn_02208ED0(CPUState* cpu) {
         /* 026C05D0 */ _t82 = cpu->r[10] + 0xFFFFFD78u;
         /* 026C05D0 */ rbrew_write32(cpu->mem, _t82, cpu->r[7]);
   L_026C05D4: ; // 0x26c05d4
-        /* 026C05D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026C05D8 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C05D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026C05D8 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C05D8 */ _t84 = _t83 & 0x00000001u;
         /* 026C05D8 */ if (_t84) goto L_026C060C; else goto L_026C05DC;
   L_026C05DC: ; // 0x26c05dc
@@ -9553,8 +9553,8 @@ void Gambit_fn_02208ED0(CPUState* cpu) {
         /* 026C05E4 */ cpu->ctr = cpu->r[9];
         /* 026C05E8 */ cpu->r[3] = cpu->r[31];
         /* 026C05EC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026C05F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026C05F4 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C05F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026C05F4 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C05F4 */ _t88 = _t87 & 0x00000001u;
         /* 026C05F4 */ if (_t88) goto L_026C060C; else goto L_026C05F8;
   L_026C05F8: ; // 0x26c05f8
@@ -9572,9 +9572,9 @@ void Gambit_fn_02208ED0(CPUState* cpu) {
         /* 026C0610 */ cpu->r[0] = rbrew_read32(cpu->mem, _t92);
         /* 026C0610 */ cpu->r[12] = _t92;
         /* 026C0614 */ cpu->r[4] = 0x101D0000u;
-        /* 026C0618 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 026C0618 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 026C061C */ cpu->r[4] = cpu->r[4] + 0xFFFFFEC0u;
-        /* 026C0620 */ _t93 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C0620 */ _t93 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C0620 */ _t94 = _t93 & 0x00000001u;
         /* 026C0620 */ if (_t94) goto L_026C0624; else goto L_026C0630;
   L_026C0624: ; // 0x26c0624
@@ -9584,8 +9584,8 @@ void Gambit_fn_02208ED0(CPUState* cpu) {
         /* 026C062C */ _t96 = cpu->r[12] + 0x00000000u;
         /* 026C062C */ rbrew_write32(cpu->mem, _t96, cpu->r[6]);
   L_026C0630: ; // 0x26c0630
-        /* 026C0630 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026C0634 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C0630 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026C0634 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C0634 */ _t98 = _t97 & 0x00000001u;
         /* 026C0634 */ if (_t98) goto L_026C0664; else goto L_026C0638;
   L_026C0638: ; // 0x26c0638
@@ -9596,8 +9596,8 @@ void Gambit_fn_02208ED0(CPUState* cpu) {
         /* 026C0640 */ cpu->ctr = cpu->r[9];
         /* 026C0644 */ cpu->r[3] = cpu->r[31];
         /* 026C0648 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026C064C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026C0650 */ _t101 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026C064C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026C0650 */ _t101 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026C0650 */ _t102 = _t101 & 0x00000001u;
         /* 026C0650 */ if (_t102) goto L_026C0664; else goto L_026C0654;
   L_026C0654: ; // 0x26c0654
@@ -9678,12 +9678,12 @@ void Gambit_fn_02208EE4(CPUState* cpu) {
         /* 02208F40 */ cpu->f[6] = fma(cpu->f[11], cpu->f[11], cpu->f[8]);
         /* 02208F44 */ _t18 = cpu->r[4] + 0x00000008u;
         /* 02208F44 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t18);
-        /* 02208F48 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 02208F48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 02208F4C */ _t19 = cpu->r[1] + 0x00000008u;
         /* 02208F4C */ rbrew_write_f32(cpu->mem, _t19, cpu->f[13]);
         /* 02208F50 */ _t20 = cpu->r[1] + 0x0000000Cu;
         /* 02208F50 */ rbrew_write_f32(cpu->mem, _t20, cpu->f[0]);
-        /* 02208F54 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02208F54 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02208F54 */ _t22 = _t21 & 0x00000001u;
         /* 02208F54 */ if (_t22) goto L_02208F80; else goto L_02208F58;
   L_02208F58: ; // 0x2208f58
@@ -9731,7 +9731,7 @@ void Gambit_fn_02208EE4(CPUState* cpu) {
         /* 02208FD8 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t29);
         /* 02208FDC */ _t30 = cpu->r[1] + 0x00000030u;
         /* 02208FDC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t30);
-        /* 02208FE0 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02208FE0 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02208FE0 */ _t32 = _t31 & 0x00000001u;
         /* 02208FE0 */ if (_t32) goto L_02208FE4; // else: addr-0 trap, fall-through
   L_02208FE4: ; // 0x2208fe4
@@ -9792,12 +9792,12 @@ void Gambit_fn_02208EE8(CPUState* cpu) {
         /* 02208F40 */ cpu->f[6] = fma(cpu->f[11], cpu->f[11], cpu->f[8]);
         /* 02208F44 */ _t18 = cpu->r[4] + 0x00000008u;
         /* 02208F44 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t18);
-        /* 02208F48 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 02208F48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 02208F4C */ _t19 = cpu->r[1] + 0x00000008u;
         /* 02208F4C */ rbrew_write_f32(cpu->mem, _t19, cpu->f[13]);
         /* 02208F50 */ _t20 = cpu->r[1] + 0x0000000Cu;
         /* 02208F50 */ rbrew_write_f32(cpu->mem, _t20, cpu->f[0]);
-        /* 02208F54 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02208F54 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02208F54 */ _t22 = _t21 & 0x00000001u;
         /* 02208F54 */ if (_t22) goto L_02208F80; else goto L_02208F58;
   L_02208F58: ; // 0x2208f58
@@ -9845,7 +9845,7 @@ void Gambit_fn_02208EE8(CPUState* cpu) {
         /* 02208FD8 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t29);
         /* 02208FDC */ _t30 = cpu->r[1] + 0x00000030u;
         /* 02208FDC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t30);
-        /* 02208FE0 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02208FE0 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02208FE0 */ _t32 = _t31 & 0x00000001u;
         /* 02208FE0 */ if (_t32) goto L_02208FE4; // else: addr-0 trap, fall-through
   L_02208FE4: ; // 0x2208fe4
@@ -9912,8 +9912,8 @@ void Gambit_fn_02209014(CPUState* cpu) {
         /* 02209014 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02209014 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02209018 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 02209018 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0220901C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209018 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0220901C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220901C */ _t2 = _t1 & 0x00000001u;
         /* 0220901C */ _t3 = _t2 ^ 0x00000001u;
         /* 0220901C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -9935,8 +9935,8 @@ void Gambit_fn_02209030(CPUState* cpu) {
         /* 02209030 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02209030 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02209034 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 02209034 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02209038 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209034 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02209038 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209038 */ _t2 = _t1 & 0x00000001u;
         /* 02209038 */ _t3 = _t2 ^ 0x00000001u;
         /* 02209038 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -9958,8 +9958,8 @@ void Gambit_fn_0220904C(CPUState* cpu) {
         /* 0220904C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0220904C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02209050 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 02209050 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02209054 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209050 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02209054 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209054 */ _t2 = _t1 & 0x00000001u;
         /* 02209054 */ _t3 = _t2 ^ 0x00000001u;
         /* 02209054 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -10002,8 +10002,8 @@ void Gambit_fn_02209078(CPUState* cpu) {
         /* 02209088 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0220908C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0220908C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02209090 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02209094 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209090 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02209094 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209094 */ _t5 = _t4 & 0x00000001u;
         /* 02209094 */ if (_t5) goto L_02209098; else goto L_022090B4;
   L_02209098: ; // 0x2209098
@@ -10042,8 +10042,8 @@ void Gambit_fn_0220907C(CPUState* cpu) {
         /* 02209088 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0220908C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0220908C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02209090 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02209094 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209090 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02209094 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209094 */ _t5 = _t4 & 0x00000001u;
         /* 02209094 */ if (_t5) goto L_02209098; else goto L_022090B4;
   L_02209098: ; // 0x2209098
@@ -10436,8 +10436,8 @@ void Gambit_fn_02209244(CPUState* cpu) {
         /* 02209244 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 02209244 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02209248 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 02209248 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0220924C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209248 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0220924C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220924C */ _t2 = _t1 & 0x00000001u;
         /* 0220924C */ if (_t2) goto L_0220925C; else goto L_02209250;
   L_02209250: ; // 0x2209250
@@ -10466,8 +10466,8 @@ void Gambit_fn_02209268(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -10654,10 +10654,10 @@ void Gambit_fn_0220931C(CPUState* cpu) {
         /* 0220931C */ cpu->r[10] = 0x101D0000u;
         /* 02209320 */ _t0 = cpu->r[10] + 0xFFFFFD60u;
         /* 02209320 */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 02209324 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02209324 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02209328 */ cpu->r[10] = 0x101D0000u;
         /* 0220932C */ cpu->r[10] = cpu->r[10] + 0xFFFFFEA4u;
-        /* 02209330 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209330 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209330 */ _t2 = _t1 & 0x00000001u;
         /* 02209330 */ if (_t2) goto L_02209334; else goto L_0220934C;
   L_02209334: ; // 0x2209334
@@ -10670,8 +10670,8 @@ void Gambit_fn_0220931C(CPUState* cpu) {
         /* 02209348 */ _t4 = cpu->r[10] + 0x00000000u;
         /* 02209348 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_0220934C: ; // 0x220934c
-        /* 0220934C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02209350 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220934C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02209350 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209350 */ _t6 = _t5 & 0x00000001u;
         /* 02209350 */ if (_t6) goto L_02209354; else goto L_0220935C;
   L_02209354: ; // 0x2209354
@@ -10682,9 +10682,9 @@ void Gambit_fn_0220931C(CPUState* cpu) {
         /* 02209360 */ _t7 = cpu->r[9] + 0xFFFFDA00u;
         /* 02209360 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 02209364 */ cpu->r[11] = 0x101D0000u;
-        /* 02209368 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02209368 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0220936C */ cpu->r[11] = cpu->r[11] + 0xFFFFFBFCu;
-        /* 02209370 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209370 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209370 */ _t9 = _t8 & 0x00000001u;
         /* 02209370 */ if (_t9) goto L_02209374; else goto L_0220938C;
   L_02209374: ; // 0x2209374
@@ -10697,8 +10697,8 @@ void Gambit_fn_0220931C(CPUState* cpu) {
         /* 02209388 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 02209388 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_0220938C: ; // 0x220938c
-        /* 0220938C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 02209390 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220938C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 02209390 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209390 */ _t13 = _t12 & 0x00000001u;
         /* 02209390 */ if (_t13) goto L_02209394; else goto L_0220939C;
   L_02209394: ; // 0x2209394
@@ -10709,9 +10709,9 @@ void Gambit_fn_0220931C(CPUState* cpu) {
         /* 022093A0 */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 022093A0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 022093A4 */ cpu->r[9] = 0x101D0000u;
-        /* 022093A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 022093A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 022093AC */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 022093B0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022093B0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022093B0 */ _t16 = _t15 & 0x00000001u;
         /* 022093B0 */ if (_t16) goto L_022093B4; else goto L_022093CC;
   L_022093B4: ; // 0x22093b4
@@ -10724,8 +10724,8 @@ void Gambit_fn_0220931C(CPUState* cpu) {
         /* 022093C8 */ _t18 = cpu->r[9] + 0x00000000u;
         /* 022093C8 */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_022093CC: ; // 0x22093cc
-        /* 022093CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 022093D0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022093CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 022093D0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022093D0 */ _t20 = _t19 & 0x00000001u;
         /* 022093D0 */ if (_t20) goto L_022093D4; else goto L_022093DC;
   L_022093D4: ; // 0x22093d4
@@ -10737,9 +10737,9 @@ void Gambit_fn_0220931C(CPUState* cpu) {
         /* 022093E0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 022093E0 */ cpu->r[9] = _t21;
         /* 022093E4 */ cpu->r[10] = 0x101D0000u;
-        /* 022093E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 022093E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 022093EC */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 022093F0 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022093F0 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022093F0 */ _t23 = _t22 & 0x00000001u;
         /* 022093F0 */ if (_t23) goto L_022093F4; else goto L_02209408;
   L_022093F4: ; // 0x22093f4
@@ -10751,8 +10751,8 @@ void Gambit_fn_0220931C(CPUState* cpu) {
         /* 02209404 */ _t25 = cpu->r[10] + 0x00000000u;
         /* 02209404 */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_02209408: ; // 0x2209408
-        /* 02209408 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0220940C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209408 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0220940C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220940C */ _t27 = _t26 & 0x00000001u;
         /* 0220940C */ if (_t27) goto L_02209410; else goto L_02209418;
   L_02209410: ; // 0x2209410
@@ -10764,9 +10764,9 @@ void Gambit_fn_0220931C(CPUState* cpu) {
         /* 0220941C */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 0220941C */ cpu->r[10] = _t28;
         /* 02209420 */ cpu->r[11] = 0x101D0000u;
-        /* 02209424 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02209424 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02209428 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 0220942C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220942C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220942C */ _t30 = _t29 & 0x00000001u;
         /* 0220942C */ if (_t30) goto L_02209430; else goto L_02209444;
   L_02209430: ; // 0x2209430
@@ -10864,7 +10864,7 @@ void Gambit_fn_0220948C(CPUState* cpu) {
         /* 022094CC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t8);
         /* 022094D0 */ _t9 = cpu->r[1] + 0x00000008u;
         /* 022094D0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t9);
-        /* 022094D4 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022094D4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022094D4 */ _t11 = _t10 & 0x00000001u;
         /* 022094D4 */ if (_t11) goto L_022094D8; // else: addr-0 trap, fall-through
   L_022094D8: ; // 0x22094d8
@@ -10908,7 +10908,7 @@ void Gambit_fn_02209490(CPUState* cpu) {
         /* 022094CC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t8);
         /* 022094D0 */ _t9 = cpu->r[1] + 0x00000008u;
         /* 022094D0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t9);
-        /* 022094D4 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022094D4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022094D4 */ _t11 = _t10 & 0x00000001u;
         /* 022094D4 */ if (_t11) goto L_022094D8; // else: addr-0 trap, fall-through
   L_022094D8: ; // 0x22094d8
@@ -10970,12 +10970,12 @@ void Gambit_fn_022094E8(CPUState* cpu) {
         /* 02209544 */ cpu->f[6] = fma(cpu->f[11], cpu->f[11], cpu->f[7]);
         /* 02209548 */ _t18 = cpu->r[3] + 0x00000008u;
         /* 02209548 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t18);
-        /* 0220954C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 0220954C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 02209550 */ _t19 = cpu->r[1] + 0x00000008u;
         /* 02209550 */ rbrew_write_f32(cpu->mem, _t19, cpu->f[13]);
         /* 02209554 */ _t20 = cpu->r[1] + 0x0000000Cu;
         /* 02209554 */ rbrew_write_f32(cpu->mem, _t20, cpu->f[0]);
-        /* 02209558 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02209558 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02209558 */ _t22 = _t21 & 0x00000001u;
         /* 02209558 */ if (_t22) goto L_02209584; else goto L_0220955C;
   L_0220955C: ; // 0x220955c
@@ -11023,7 +11023,7 @@ void Gambit_fn_022094E8(CPUState* cpu) {
         /* 022095DC */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t29);
         /* 022095E0 */ _t30 = cpu->r[1] + 0x00000030u;
         /* 022095E0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t30);
-        /* 022095E4 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022095E4 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022095E4 */ _t32 = _t31 & 0x00000001u;
         /* 022095E4 */ if (_t32) goto L_022095E8; // else: addr-0 trap, fall-through
   L_022095E8: ; // 0x22095e8
@@ -11084,12 +11084,12 @@ void Gambit_fn_022094EC(CPUState* cpu) {
         /* 02209544 */ cpu->f[6] = fma(cpu->f[11], cpu->f[11], cpu->f[7]);
         /* 02209548 */ _t18 = cpu->r[3] + 0x00000008u;
         /* 02209548 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t18);
-        /* 0220954C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 0220954C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 02209550 */ _t19 = cpu->r[1] + 0x00000008u;
         /* 02209550 */ rbrew_write_f32(cpu->mem, _t19, cpu->f[13]);
         /* 02209554 */ _t20 = cpu->r[1] + 0x0000000Cu;
         /* 02209554 */ rbrew_write_f32(cpu->mem, _t20, cpu->f[0]);
-        /* 02209558 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02209558 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02209558 */ _t22 = _t21 & 0x00000001u;
         /* 02209558 */ if (_t22) goto L_02209584; else goto L_0220955C;
   L_0220955C: ; // 0x220955c
@@ -11137,7 +11137,7 @@ void Gambit_fn_022094EC(CPUState* cpu) {
         /* 022095DC */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t29);
         /* 022095E0 */ _t30 = cpu->r[1] + 0x00000030u;
         /* 022095E0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t30);
-        /* 022095E4 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022095E4 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022095E4 */ _t32 = _t31 & 0x00000001u;
         /* 022095E4 */ if (_t32) goto L_022095E8; // else: addr-0 trap, fall-through
   L_022095E8: ; // 0x22095e8
@@ -11228,9 +11228,9 @@ void Gambit_fn_022095F8(CPUState* cpu) {
         /* 022096A8 */ cpu->r[12] = cpu->r[28] + cpu->r[11];
         /* 022096AC */ _t26 = cpu->r[12] + 0x00000104u;
         /* 022096AC */ cpu->r[4] = rbrew_read8(cpu->mem, _t26);
-        /* 022096B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 022096B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 022096B4 */ cpu->r[6] = cpu->r[3];
-        /* 022096B8 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022096B8 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022096B8 */ _t28 = _t27 & 0x00000001u;
         /* 022096B8 */ if (_t28) goto L_022097D8; else goto L_022096BC;
   L_022096BC: ; // 0x22096bc
@@ -11239,8 +11239,8 @@ void Gambit_fn_022095F8(CPUState* cpu) {
         /* 022096C4 */ cpu->r[3] = cpu->r[28];
         /* 022096C8 */ Gambit_fn_021F000C(cpu);
         /* 022096CC */ cpu->r[29] = cpu->r[3];
-        /* 022096CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 022096D0 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022096CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 022096D0 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022096D0 */ _t30 = _t29 & 0x00000001u;
         /* 022096D0 */ if (_t30) goto L_022097D8; else goto L_022096D4;
   L_022096D4: ; // 0x22096d4
@@ -11265,8 +11265,8 @@ void Gambit_fn_022095F8(CPUState* cpu) {
         /* 02209700 */ cpu->f[10] = fma(cpu->f[9], cpu->f[9], cpu->f[10]);
         /* 02209704 */ _t38 = cpu->r[12] + 0x00001F54u;
         /* 02209704 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t38);
-        /* 02209708 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[13]);
-        /* 0220970C */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02209708 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[13]));
+        /* 0220970C */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220970C */ _t40 = _t39 & 0x00000001u;
         /* 0220970C */ if (_t40) goto L_02209710; else goto L_02209744;
   L_02209710: ; // 0x2209710
@@ -11302,11 +11302,11 @@ void Gambit_fn_022095F8(CPUState* cpu) {
         /* 02209760 */ cpu->r[7] = cpu->r[30];
         /* 02209764 */ _t49 = cpu->r[31] + 0x0000012Cu;
         /* 02209764 */ cpu->f[2] = rbrew_read_f32(cpu->mem, _t49);
-        /* 02209768 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02209768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0220976C */ cpu->r[9] = cpu->r[31];
         /* 02209770 */ _t50 = cpu->r[1] + 0x00000008u;
         /* 02209770 */ rbrew_write32(cpu->mem, _t50, cpu->r[10]);
-        /* 02209774 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209774 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209774 */ _t52 = _t51 & 0x00000001u;
         /* 02209774 */ if (_t52) goto L_022097B8; else goto L_02209778;
   L_02209778: ; // 0x2209778
@@ -11445,9 +11445,9 @@ void Gambit_fn_022095FC(CPUState* cpu) {
         /* 022096A8 */ cpu->r[12] = cpu->r[28] + cpu->r[11];
         /* 022096AC */ _t26 = cpu->r[12] + 0x00000104u;
         /* 022096AC */ cpu->r[4] = rbrew_read8(cpu->mem, _t26);
-        /* 022096B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 022096B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 022096B4 */ cpu->r[6] = cpu->r[3];
-        /* 022096B8 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022096B8 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022096B8 */ _t28 = _t27 & 0x00000001u;
         /* 022096B8 */ if (_t28) goto L_022097D8; else goto L_022096BC;
   L_022096BC: ; // 0x22096bc
@@ -11456,8 +11456,8 @@ void Gambit_fn_022095FC(CPUState* cpu) {
         /* 022096C4 */ cpu->r[3] = cpu->r[28];
         /* 022096C8 */ Gambit_fn_021F000C(cpu);
         /* 022096CC */ cpu->r[29] = cpu->r[3];
-        /* 022096CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 022096D0 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022096CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 022096D0 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022096D0 */ _t30 = _t29 & 0x00000001u;
         /* 022096D0 */ if (_t30) goto L_022097D8; else goto L_022096D4;
   L_022096D4: ; // 0x22096d4
@@ -11482,8 +11482,8 @@ void Gambit_fn_022095FC(CPUState* cpu) {
         /* 02209700 */ cpu->f[10] = fma(cpu->f[9], cpu->f[9], cpu->f[10]);
         /* 02209704 */ _t38 = cpu->r[12] + 0x00001F54u;
         /* 02209704 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t38);
-        /* 02209708 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[13]);
-        /* 0220970C */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02209708 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[13]));
+        /* 0220970C */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220970C */ _t40 = _t39 & 0x00000001u;
         /* 0220970C */ if (_t40) goto L_02209710; else goto L_02209744;
   L_02209710: ; // 0x2209710
@@ -11519,11 +11519,11 @@ void Gambit_fn_022095FC(CPUState* cpu) {
         /* 02209760 */ cpu->r[7] = cpu->r[30];
         /* 02209764 */ _t49 = cpu->r[31] + 0x0000012Cu;
         /* 02209764 */ cpu->f[2] = rbrew_read_f32(cpu->mem, _t49);
-        /* 02209768 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02209768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0220976C */ cpu->r[9] = cpu->r[31];
         /* 02209770 */ _t50 = cpu->r[1] + 0x00000008u;
         /* 02209770 */ rbrew_write32(cpu->mem, _t50, cpu->r[10]);
-        /* 02209774 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209774 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209774 */ _t52 = _t51 & 0x00000001u;
         /* 02209774 */ if (_t52) goto L_022097B8; else goto L_02209778;
   L_02209778: ; // 0x2209778
@@ -11614,7 +11614,7 @@ void Gambit_fn_022097FC(CPUState* cpu) {
         /* 022061E0 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 022061E4 */ _t7 = cpu->r[3] + 0x000000C8u;
         /* 022061E4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 022061E8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
+        /* 022061E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
         /* 022061EC */ _t8 = cpu->r[3] + 0x000000CCu;
         /* 022061EC */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
         /* 022061F0 */ _t9 = cpu->r[1] + 0x0000000Cu;
@@ -11622,7 +11622,7 @@ void Gambit_fn_022097FC(CPUState* cpu) {
         /* 022061F4 */ cpu->r[31] = cpu->r[3];
         /* 022061F8 */ _t10 = cpu->r[1] + 0x00000010u;
         /* 022061F8 */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
-        /* 022061FC */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022061FC */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022061FC */ _t12 = _t11 & 0x00000001u;
         /* 022061FC */ if (_t12) goto L_02206200; else goto L_02206274;
   L_02206200: ; // 0x2206200
@@ -11672,10 +11672,10 @@ void Gambit_fn_022097FC(CPUState* cpu) {
         /* 02206260 */ _t32 = cpu->r[31] + 0x000000CCu;
         /* 02206260 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
         /* 02206264 */ cpu->r[8] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x00000010u, 0x00000010u);
-        /* 02206264 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02206264 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02206268 */ _t33 = cpu->r[31] + 0x000000C8u;
         /* 02206268 */ rbrew_write32(cpu->mem, _t33, cpu->r[12]);
-        /* 0220626C */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220626C */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220626C */ _t35 = _t34 & 0x00000001u;
         /* 0220626C */ if (_t35) goto L_0220634C; else goto L_02206270;
   L_02206270: ; // 0x2206270
@@ -11685,8 +11685,8 @@ void Gambit_fn_022097FC(CPUState* cpu) {
         /* 02206278 */ _t36 = cpu->r[31] + 0x00000170u;
         /* 02206278 */ cpu->r[8] = rbrew_read32(cpu->mem, _t36);
         /* 0220627C */ cpu->r[8] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x00000010u, 0x00000010u);
-        /* 0220627C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02206280 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220627C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02206280 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02206280 */ _t38 = _t37 & 0x00000001u;
         /* 02206280 */ if (_t38) goto L_0220634C; else goto L_02206284;
   L_02206284: ; // 0x2206284
@@ -11702,8 +11702,8 @@ void Gambit_fn_022097FC(CPUState* cpu) {
         /* 0220629C */ cpu->f[7] = fma(cpu->f[8], cpu->f[8], cpu->f[9]);
         /* 022062A0 */ _t42 = cpu->r[10] + 0x00001988u;
         /* 022062A0 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t42);
-        /* 022062A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[11]);
-        /* 022062A8 */ _t43 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022062A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[11]));
+        /* 022062A8 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022062A8 */ _t44 = _t43 & 0x00000001u;
         /* 022062A8 */ if (_t44) goto L_022062E4; else goto L_022062AC;
   L_022062AC: ; // 0x22062ac
@@ -11834,26 +11834,26 @@ void Gambit_fn_02209800(CPUState* cpu) {
         /* 02209864 */ cpu->f[10] = cpu->f[30] / cpu->f[31];
         /* 02209868 */ cpu->f[0] = (uint32_t)(int32_t)cpu->f[10];
         /* 0220986C */ cpu->r[0] = cpu->r[1] + 0x00000018u;
-        /* 02209870 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[13]);
+        /* 02209870 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[13]));
         /* 02209874 */ /* nop */
         /* 02209878 */ _t16 = cpu->r[1] + 0x00000018u;
         /* 02209878 */ cpu->r[28] = rbrew_read32(cpu->mem, _t16);
-        /* 0220987C */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220987C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220987C */ _t18 = _t17 & 0x00000001u;
         /* 0220987C */ if (_t18) goto L_02209880; else goto L_02209884;
   L_02209880: ; // 0x2209880
         /* 02209880 */ cpu->r[28] = 0xFFFFFFFFu;
   L_02209884: ; // 0x2209884
-        /* 02209884 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02209884 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02209888 */ cpu->r[31] = 0x00000000u;
         /* 0220988C */ _t19 = cpu->r[30] + 0x00000128u;
         /* 0220988C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t19);
-        /* 02209890 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209890 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209890 */ _t21 = _t20 & 0x00000001u;
         /* 02209890 */ if (_t21) goto L_022098A0; else goto L_02209894;
   L_02209894: ; // 0x2209894
-        /* 02209894 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[13]);
-        /* 02209898 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209894 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[13]));
+        /* 02209898 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209898 */ _t23 = _t22 & 0x00000001u;
         /* 02209898 */ if (_t23) goto L_0220989C; else goto L_022098A0;
   L_0220989C: ; // 0x220989c
@@ -11891,9 +11891,9 @@ void Gambit_fn_02209800(CPUState* cpu) {
         /* 022098F8 */ Gambit_fn_02C693A4(cpu);
         /* 022098FC */ cpu->f[29] = cpu->f[1];
         /* 02209900 */ cpu->f[13] = cpu->f[31] - cpu->f[30];
-        /* 02209904 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02209904 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02209908 */ cpu->f[30] = cpu->f[13] / cpu->f[29];
-        /* 0220990C */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220990C */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220990C */ _t32 = _t31 & 0x00000001u;
         /* 0220990C */ if (_t32) goto L_0220991C; else goto L_02209910;
   L_02209910: ; // 0x2209910
@@ -11902,8 +11902,8 @@ void Gambit_fn_02209800(CPUState* cpu) {
         /* 02209918 */ Gambit_fn_022095F8(cpu);
   L_0220991C: ; // 0x220991c
         /* 0220991C */ cpu->r[29] = cpu->r[29] - cpu->r[28];
-        /* 0220991C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02209920 */ _t33 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220991C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02209920 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02209920 */ _t34 = _t33 & 0x00000001u;
         /* 02209920 */ if (_t34) goto L_02209924; else goto L_022099B0;
   L_02209924: ; // 0x2209924
@@ -11935,10 +11935,10 @@ void Gambit_fn_02209800(CPUState* cpu) {
         /* 0220996C */ /* nop */
         /* 02209970 */ /* nop */
         /* 02209974 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000012u);
-        /* 02209974 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02209974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02209978 */ _t41 = cpu->r[1] + 0x00000010u;
         /* 02209978 */ rbrew_write_f32(cpu->mem, _t41, cpu->f[11]);
-        /* 0220997C */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220997C */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220997C */ _t43 = _t42 & 0x00000001u;
         /* 0220997C */ if (_t43) goto L_02209998; else goto L_02209980;
   L_02209980: ; // 0x2209980
@@ -11947,8 +11947,8 @@ void Gambit_fn_02209800(CPUState* cpu) {
         /* 02209988 */ Gambit_fn_02C693A4(cpu);
         /* 0220998C */ _t44 = cpu->r[30] + 0x00000174u;
         /* 0220998C */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t44);
-        /* 02209990 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[12]);
-        /* 02209994 */ _t45 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02209990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[12]));
+        /* 02209994 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02209994 */ _t46 = _t45 & 0x00000001u;
         /* 02209994 */ if (_t46) goto L_02209998; else goto L_022099A4;
   L_02209998: ; // 0x2209998
@@ -11957,9 +11957,9 @@ void Gambit_fn_02209800(CPUState* cpu) {
         /* 022099A0 */ Gambit_fn_022095F8(cpu);
   L_022099A4: ; // 0x22099a4
         /* 022099A4 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 022099A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 022099A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 022099A8 */ cpu->f[30] = cpu->f[30] + cpu->f[31];
-        /* 022099AC */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022099AC */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022099AC */ _t48 = _t47 & 0x00000001u;
         /* 022099AC */ if (_t48) goto L_022099B0; else goto L_0220992C;
   L_022099B0: ; // 0x22099b0
@@ -11983,7 +11983,7 @@ void Gambit_fn_02209800(CPUState* cpu) {
         /* 022099D0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t57);
         /* 022099D4 */ _t58 = cpu->r[1] + 0x00000038u;
         /* 022099D4 */ cpu->r[30] = rbrew_read32(cpu->mem, _t58);
-        /* 022099D8 */ _t59 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022099D8 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022099D8 */ _t60 = _t59 & 0x00000001u;
         /* 022099D8 */ if (_t60) goto L_022099DC; // else: addr-0 trap, fall-through
   L_022099DC: ; // 0x22099dc
@@ -12019,9 +12019,9 @@ void Gambit_fn_022099EC(CPUState* cpu) {
         /* 02209A14 */ cpu->r[4] = rbrew_read8(cpu->mem, _t5);
         /* 02209A18 */ cpu->r[9] = cpu->r[5];
         /* 02209A1C */ cpu->r[7] = cpu->r[6];
-        /* 02209A20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 02209A20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 02209A24 */ cpu->r[0] = 0x00000000u;
-        /* 02209A28 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209A28 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209A28 */ _t7 = _t6 & 0x00000001u;
         /* 02209A28 */ if (_t7) goto L_02209A3C; else goto L_02209A2C;
   L_02209A2C: ; // 0x2209a2c
@@ -12058,9 +12058,9 @@ void Gambit_fn_022099FC(CPUState* cpu) {
         /* 02209A14 */ cpu->r[4] = rbrew_read8(cpu->mem, _t4);
         /* 02209A18 */ cpu->r[9] = cpu->r[5];
         /* 02209A1C */ cpu->r[7] = cpu->r[6];
-        /* 02209A20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 02209A20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 02209A24 */ cpu->r[0] = 0x00000000u;
-        /* 02209A28 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209A28 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209A28 */ _t6 = _t5 & 0x00000001u;
         /* 02209A28 */ if (_t6) goto L_02209A3C; else goto L_02209A2C;
   L_02209A2C: ; // 0x2209a2c
@@ -12184,8 +12184,8 @@ void Gambit_fn_02209AA0(CPUState* cpu) {
         /* 02209AA0 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02209AA0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02209AA4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 02209AA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02209AA8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209AA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02209AA8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209AA8 */ _t2 = _t1 & 0x00000001u;
         /* 02209AA8 */ _t3 = _t2 ^ 0x00000001u;
         /* 02209AA8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -12207,8 +12207,8 @@ void Gambit_fn_02209ABC(CPUState* cpu) {
         /* 02209ABC */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02209ABC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02209AC0 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 02209AC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02209AC4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209AC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02209AC4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209AC4 */ _t2 = _t1 & 0x00000001u;
         /* 02209AC4 */ _t3 = _t2 ^ 0x00000001u;
         /* 02209AC4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -12230,8 +12230,8 @@ void Gambit_fn_02209AD8(CPUState* cpu) {
         /* 02209AD8 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02209AD8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02209ADC */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 02209ADC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02209AE0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209ADC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02209AE0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209AE0 */ _t2 = _t1 & 0x00000001u;
         /* 02209AE0 */ _t3 = _t2 ^ 0x00000001u;
         /* 02209AE0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -12274,8 +12274,8 @@ void Gambit_fn_02209B04(CPUState* cpu) {
         /* 02209B14 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02209B18 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02209B18 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02209B1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02209B20 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209B1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02209B20 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209B20 */ _t5 = _t4 & 0x00000001u;
         /* 02209B20 */ if (_t5) goto L_02209B24; else goto L_02209B40;
   L_02209B24: ; // 0x2209b24
@@ -12314,8 +12314,8 @@ void Gambit_fn_02209B08(CPUState* cpu) {
         /* 02209B14 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02209B18 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02209B18 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02209B1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02209B20 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209B1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02209B20 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209B20 */ _t5 = _t4 & 0x00000001u;
         /* 02209B20 */ if (_t5) goto L_02209B24; else goto L_02209B40;
   L_02209B24: ; // 0x2209b24
@@ -12708,8 +12708,8 @@ void Gambit_fn_02209CD0(CPUState* cpu) {
         /* 02209CD0 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 02209CD0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02209CD4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 02209CD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02209CD8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209CD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02209CD8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209CD8 */ _t2 = _t1 & 0x00000001u;
         /* 02209CD8 */ if (_t2) goto L_02209CE8; else goto L_02209CDC;
   L_02209CDC: ; // 0x2209cdc
@@ -12738,8 +12738,8 @@ void Gambit_fn_02209CF4(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -12841,9 +12841,9 @@ void Gambit_fn_02209D4C(CPUState* cpu) {
         /* 02209D50 */ _t0 = cpu->r[8] + 0xFFFFFD84u;
         /* 02209D50 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 02209D54 */ cpu->r[6] = 0x101D0000u;
-        /* 02209D58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02209D58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02209D5C */ cpu->r[6] = cpu->r[6] + 0xFFFFFEC0u;
-        /* 02209D60 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209D60 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209D60 */ _t2 = _t1 & 0x00000001u;
         /* 02209D60 */ if (_t2) goto L_02209D64; else goto L_02209D7C;
   L_02209D64: ; // 0x2209d64
@@ -12856,8 +12856,8 @@ void Gambit_fn_02209D4C(CPUState* cpu) {
         /* 02209D78 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 02209D78 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_02209D7C: ; // 0x2209d7c
-        /* 02209D7C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 02209D80 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209D7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 02209D80 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209D80 */ _t6 = _t5 & 0x00000001u;
         /* 02209D80 */ if (_t6) goto L_02209D84; else goto L_02209D8C;
   L_02209D84: ; // 0x2209d84
@@ -12868,9 +12868,9 @@ void Gambit_fn_02209D4C(CPUState* cpu) {
         /* 02209D90 */ _t7 = cpu->r[10] + 0xFFFFFD60u;
         /* 02209D90 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 02209D94 */ cpu->r[8] = 0x101D0000u;
-        /* 02209D98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02209D98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02209D9C */ cpu->r[8] = cpu->r[8] + 0xFFFFFEA4u;
-        /* 02209DA0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209DA0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209DA0 */ _t9 = _t8 & 0x00000001u;
         /* 02209DA0 */ if (_t9) goto L_02209DA4; else goto L_02209DBC;
   L_02209DA4: ; // 0x2209da4
@@ -12883,8 +12883,8 @@ void Gambit_fn_02209D4C(CPUState* cpu) {
         /* 02209DB8 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 02209DB8 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_02209DBC: ; // 0x2209dbc
-        /* 02209DBC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02209DC0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209DBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02209DC0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209DC0 */ _t13 = _t12 & 0x00000001u;
         /* 02209DC0 */ if (_t13) goto L_02209DC4; else goto L_02209DCC;
   L_02209DC4: ; // 0x2209dc4
@@ -12895,9 +12895,9 @@ void Gambit_fn_02209D4C(CPUState* cpu) {
         /* 02209DD0 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 02209DD0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 02209DD4 */ cpu->r[10] = 0x101D0000u;
-        /* 02209DD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02209DD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02209DDC */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 02209DE0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209DE0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209DE0 */ _t16 = _t15 & 0x00000001u;
         /* 02209DE0 */ if (_t16) goto L_02209DE4; else goto L_02209DFC;
   L_02209DE4: ; // 0x2209de4
@@ -12910,8 +12910,8 @@ void Gambit_fn_02209D4C(CPUState* cpu) {
         /* 02209DF8 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 02209DF8 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_02209DFC: ; // 0x2209dfc
-        /* 02209DFC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02209E00 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209DFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02209E00 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209E00 */ _t20 = _t19 & 0x00000001u;
         /* 02209E00 */ if (_t20) goto L_02209E04; else goto L_02209E0C;
   L_02209E04: ; // 0x2209e04
@@ -12922,9 +12922,9 @@ void Gambit_fn_02209D4C(CPUState* cpu) {
         /* 02209E10 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 02209E10 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 02209E14 */ cpu->r[12] = 0x101D0000u;
-        /* 02209E18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02209E18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02209E1C */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 02209E20 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209E20 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209E20 */ _t23 = _t22 & 0x00000001u;
         /* 02209E20 */ if (_t23) goto L_02209E24; else goto L_02209E3C;
   L_02209E24: ; // 0x2209e24
@@ -12937,8 +12937,8 @@ void Gambit_fn_02209D4C(CPUState* cpu) {
         /* 02209E38 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 02209E38 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_02209E3C: ; // 0x2209e3c
-        /* 02209E3C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02209E40 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209E3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02209E40 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209E40 */ _t27 = _t26 & 0x00000001u;
         /* 02209E40 */ if (_t27) goto L_02209E44; else goto L_02209E4C;
   L_02209E44: ; // 0x2209e44
@@ -12950,9 +12950,9 @@ void Gambit_fn_02209D4C(CPUState* cpu) {
         /* 02209E50 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 02209E50 */ cpu->r[10] = _t28;
         /* 02209E54 */ cpu->r[7] = 0x101D0000u;
-        /* 02209E58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02209E58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02209E5C */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 02209E60 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209E60 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209E60 */ _t30 = _t29 & 0x00000001u;
         /* 02209E60 */ if (_t30) goto L_02209E64; else goto L_02209E78;
   L_02209E64: ; // 0x2209e64
@@ -12964,8 +12964,8 @@ void Gambit_fn_02209D4C(CPUState* cpu) {
         /* 02209E74 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 02209E74 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_02209E78: ; // 0x2209e78
-        /* 02209E78 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 02209E7C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209E78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 02209E7C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209E7C */ _t34 = _t33 & 0x00000001u;
         /* 02209E7C */ if (_t34) goto L_02209E80; else goto L_02209E88;
   L_02209E80: ; // 0x2209e80
@@ -12977,9 +12977,9 @@ void Gambit_fn_02209D4C(CPUState* cpu) {
         /* 02209E8C */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 02209E8C */ cpu->r[8] = _t35;
         /* 02209E90 */ cpu->r[6] = 0x101D0000u;
-        /* 02209E94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02209E94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02209E98 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 02209E9C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209E9C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209E9C */ _t37 = _t36 & 0x00000001u;
         /* 02209E9C */ if (_t37) goto L_02209EA0; else goto L_02209EB4;
   L_02209EA0: ; // 0x2209ea0
@@ -13022,18 +13022,18 @@ void Gambit_fn_02209ED4(CPUState* cpu) {
         /* 02209EE0 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02209EE0 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02209EE4 */ cpu->r[31] = cpu->r[3];
-        /* 02209EE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02209EE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02209EE8 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02209EE8 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02209EEC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209EEC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209EEC */ _t5 = _t4 & 0x00000001u;
         /* 02209EEC */ if (_t5) goto L_02209EF0; else goto L_02209F00;
   L_02209EF0: ; // 0x2209ef0
         /* 02209EF0 */ cpu->r[3] = 0x000001A4u;
         /* 02209EF4 */ Gambit_fn_02801A78(cpu);
         /* 02209EF8 */ cpu->r[31] = cpu->r[3];
-        /* 02209EF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02209EFC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209EF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02209EFC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209EFC */ _t7 = _t6 & 0x00000001u;
         /* 02209EFC */ if (_t7) goto L_02209F70; else goto L_02209F00;
   L_02209F00: ; // 0x2209f00
@@ -13051,10 +13051,10 @@ void Gambit_fn_02209ED4(CPUState* cpu) {
         /* 02209F20 */ _t11 = cpu->r[31] + 0x00000174u;
         /* 02209F20 */ rbrew_write32(cpu->mem, _t11, cpu->r[30]);
         /* 02209F24 */ cpu->r[0] = cpu->r[31] + 0x00000184u;
-        /* 02209F24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02209F24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02209F28 */ _t12 = cpu->r[31] + 0x00000178u;
         /* 02209F28 */ rbrew_write32(cpu->mem, _t12, cpu->r[30]);
-        /* 02209F2C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209F2C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209F2C */ _t14 = _t13 & 0x00000001u;
         /* 02209F2C */ if (_t14) goto L_02209F30; else goto L_02209F38;
   L_02209F30: ; // 0x2209f30
@@ -13070,10 +13070,10 @@ void Gambit_fn_02209ED4(CPUState* cpu) {
         /* 02209F48 */ _t17 = cpu->r[31] + 0x00000190u;
         /* 02209F48 */ rbrew_write_f32(cpu->mem, _t17, cpu->f[0]);
         /* 02209F4C */ cpu->r[0] = cpu->r[31] + 0x00000198u;
-        /* 02209F4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02209F4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02209F50 */ _t18 = cpu->r[31] + 0x00000194u;
         /* 02209F50 */ rbrew_write_f32(cpu->mem, _t18, cpu->f[13]);
-        /* 02209F54 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209F54 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209F54 */ _t20 = _t19 & 0x00000001u;
         /* 02209F54 */ if (_t20) goto L_02209F58; else goto L_02209F60;
   L_02209F58: ; // 0x2209f58
@@ -13113,18 +13113,18 @@ void Gambit_fn_02209ED8(CPUState* cpu) {
         /* 02209EE0 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02209EE0 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02209EE4 */ cpu->r[31] = cpu->r[3];
-        /* 02209EE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02209EE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02209EE8 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02209EE8 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02209EEC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209EEC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209EEC */ _t5 = _t4 & 0x00000001u;
         /* 02209EEC */ if (_t5) goto L_02209EF0; else goto L_02209F00;
   L_02209EF0: ; // 0x2209ef0
         /* 02209EF0 */ cpu->r[3] = 0x000001A4u;
         /* 02209EF4 */ Gambit_fn_02801A78(cpu);
         /* 02209EF8 */ cpu->r[31] = cpu->r[3];
-        /* 02209EF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02209EFC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209EF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02209EFC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209EFC */ _t7 = _t6 & 0x00000001u;
         /* 02209EFC */ if (_t7) goto L_02209F70; else goto L_02209F00;
   L_02209F00: ; // 0x2209f00
@@ -13142,10 +13142,10 @@ void Gambit_fn_02209ED8(CPUState* cpu) {
         /* 02209F20 */ _t11 = cpu->r[31] + 0x00000174u;
         /* 02209F20 */ rbrew_write32(cpu->mem, _t11, cpu->r[30]);
         /* 02209F24 */ cpu->r[0] = cpu->r[31] + 0x00000184u;
-        /* 02209F24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02209F24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02209F28 */ _t12 = cpu->r[31] + 0x00000178u;
         /* 02209F28 */ rbrew_write32(cpu->mem, _t12, cpu->r[30]);
-        /* 02209F2C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209F2C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209F2C */ _t14 = _t13 & 0x00000001u;
         /* 02209F2C */ if (_t14) goto L_02209F30; else goto L_02209F38;
   L_02209F30: ; // 0x2209f30
@@ -13161,10 +13161,10 @@ void Gambit_fn_02209ED8(CPUState* cpu) {
         /* 02209F48 */ _t17 = cpu->r[31] + 0x00000190u;
         /* 02209F48 */ rbrew_write_f32(cpu->mem, _t17, cpu->f[0]);
         /* 02209F4C */ cpu->r[0] = cpu->r[31] + 0x00000198u;
-        /* 02209F4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02209F4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02209F50 */ _t18 = cpu->r[31] + 0x00000194u;
         /* 02209F50 */ rbrew_write_f32(cpu->mem, _t18, cpu->f[13]);
-        /* 02209F54 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02209F54 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02209F54 */ _t20 = _t19 & 0x00000001u;
         /* 02209F54 */ if (_t20) goto L_02209F58; else goto L_02209F60;
   L_02209F58: ; // 0x2209f58
@@ -13317,22 +13317,22 @@ void Gambit_fn_02209FE8(CPUState* cpu) {
         /* 0220A054 */ _t13 = cpu->r[1] + 0x00000086u;
         /* 0220A054 */ cpu->r[20] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t13);
         /* 0220A058 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x0000000Fu);
-        /* 0220A05C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0220A05C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0220A060 */ _t14 = cpu->r[25] + 0x000001A0u;
         /* 0220A060 */ rbrew_write32(cpu->mem, _t14, cpu->r[0]);
-        /* 0220A064 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220A064 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220A064 */ _t16 = _t15 & 0x00000001u;
         /* 0220A064 */ if (_t16) goto L_0220A154; else goto L_0220A068;
   L_0220A068: ; // 0x220a068
         /* 0220A068 */ _t17 = cpu->r[3] + 0x0000001Cu;
         /* 0220A068 */ cpu->r[0] = rbrew_read32(cpu->mem, _t17);
-        /* 0220A06C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 0220A070 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220A06C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 0220A070 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220A070 */ _t19 = _t18 & 0x00000001u;
         /* 0220A070 */ if (_t19) goto L_0220A07C; else goto L_0220A074;
   L_0220A074: ; // 0x220a074
-        /* 0220A074 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 0220A078 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220A074 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 0220A078 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220A078 */ _t21 = _t20 & 0x00000001u;
         /* 0220A078 */ if (_t21) goto L_0220A07C; else goto L_0220A154;
   L_0220A07C: ; // 0x220a07c
@@ -13355,14 +13355,14 @@ void Gambit_fn_02209FE8(CPUState* cpu) {
         /* 0220A0A0 */ cpu->r[11] = _t28 | _t27;
         /* 0220A0A4 */ _t29 = cpu->r[25] + 0x000001A0u;
         /* 0220A0A4 */ rbrew_write32(cpu->mem, _t29, cpu->r[11]);
-        /* 0220A0A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
+        /* 0220A0A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
         /* 0220A0AC */ _t30 = cpu->r[25] + 0x00000178u;
         /* 0220A0AC */ rbrew_write32(cpu->mem, _t30, cpu->r[24]);
         /* 0220A0B0 */ cpu->r[22] = cpu->r[23] + 0x00000460u;
         /* 0220A0B4 */ cpu->r[3] = cpu->r[25];
         /* 0220A0B8 */ _t31 = cpu->r[25] + 0x000001A0u;
         /* 0220A0B8 */ rbrew_write16(cpu->mem, _t31, (uint16_t)cpu->r[24]);
-        /* 0220A0BC */ _t32 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220A0BC */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220A0BC */ _t33 = _t32 & 0x00000001u;
         /* 0220A0BC */ if (_t33) goto L_0220A0C0; else goto L_0220A190;
   L_0220A0C0: ; // 0x220a0c0
@@ -13409,7 +13409,7 @@ void Gambit_fn_02209FE8(CPUState* cpu) {
         /* 0220A138 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t43);
         /* 0220A13C */ _t44 = cpu->r[1] + 0x00000068u;
         /* 0220A13C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t44);
-        /* 0220A140 */ _t45 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220A140 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220A140 */ _t46 = _t45 & 0x00000001u;
         /* 0220A140 */ if (_t46) goto L_0220A144; // else: addr-0 trap, fall-through
   L_0220A144: ; // 0x220a144
@@ -13434,7 +13434,7 @@ void Gambit_fn_02209FE8(CPUState* cpu) {
         /* 0220A16C */ cpu->r[11] = _t53 | _t52;
         /* 0220A170 */ _t54 = cpu->r[25] + 0x00000004u;
         /* 0220A170 */ cpu->r[23] = rbrew_read32(cpu->mem, _t54);
-        /* 0220A174 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
+        /* 0220A174 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
         /* 0220A178 */ _t55 = cpu->r[25] + 0x000001A0u;
         /* 0220A178 */ rbrew_write32(cpu->mem, _t55, cpu->r[11]);
         /* 0220A17C */ cpu->r[22] = cpu->r[23] + 0x00000460u;
@@ -13443,7 +13443,7 @@ void Gambit_fn_02209FE8(CPUState* cpu) {
         /* 0220A184 */ cpu->r[3] = cpu->r[25];
         /* 0220A188 */ _t57 = cpu->r[25] + 0x00000178u;
         /* 0220A188 */ rbrew_write32(cpu->mem, _t57, cpu->r[24]);
-        /* 0220A18C */ _t58 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220A18C */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220A18C */ _t59 = _t58 & 0x00000001u;
         /* 0220A18C */ if (_t59) goto L_0220A0C0; else goto L_0220A190;
   L_0220A190: ; // 0x220a190
@@ -13489,7 +13489,7 @@ void Gambit_fn_02209FE8(CPUState* cpu) {
         /* 0220A204 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t69);
         /* 0220A208 */ _t70 = cpu->r[1] + 0x00000068u;
         /* 0220A208 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t70);
-        /* 0220A20C */ _t71 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220A20C */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220A20C */ _t72 = _t71 & 0x00000001u;
         /* 0220A20C */ if (_t72) goto L_0220A210; // else: addr-0 trap, fall-through
   L_0220A210: ; // 0x220a210
@@ -13607,7 +13607,7 @@ void Gambit_fn_0220A220(CPUState* cpu) {
         /* 0220A31C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t34);
         /* 0220A320 */ _t35 = cpu->r[1] + 0x00000060u;
         /* 0220A320 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t35);
-        /* 0220A324 */ _t36 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220A324 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220A324 */ _t37 = _t36 & 0x00000001u;
         /* 0220A324 */ if (_t37) goto L_0220A328; // else: addr-0 trap, fall-through
   L_0220A328: ; // 0x220a328
@@ -13660,22 +13660,22 @@ void Gambit_fn_0220A338(CPUState* cpu) {
         /* 0220A394 */ _t10 = rbrew_rlwinm(cpu->r[0], 0x0000000Eu, 0x00000010u, 0x00000011u);
         /* 0220A394 */ _t11 = cpu->r[12] & 0xFFFF3FFFu;
         /* 0220A394 */ cpu->r[12] = _t11 | _t10;
-        /* 0220A398 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0220A398 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0220A39C */ _t12 = cpu->r[23] + 0x000001A0u;
         /* 0220A39C */ rbrew_write32(cpu->mem, _t12, cpu->r[12]);
-        /* 0220A3A0 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220A3A0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220A3A0 */ _t14 = _t13 & 0x00000001u;
         /* 0220A3A0 */ if (_t14) goto L_0220A438; else goto L_0220A3A4;
   L_0220A3A4: ; // 0x220a3a4
         /* 0220A3A4 */ _t15 = cpu->r[3] + 0x0000001Cu;
         /* 0220A3A4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t15);
-        /* 0220A3A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 0220A3AC */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220A3A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 0220A3AC */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220A3AC */ _t17 = _t16 & 0x00000001u;
         /* 0220A3AC */ if (_t17) goto L_0220A3B8; else goto L_0220A3B0;
   L_0220A3B0: ; // 0x220a3b0
-        /* 0220A3B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 0220A3B4 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220A3B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 0220A3B4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220A3B4 */ _t19 = _t18 & 0x00000001u;
         /* 0220A3B4 */ if (_t19) goto L_0220A3B8; else goto L_0220A438;
   L_0220A3B8: ; // 0x220a3b8
@@ -13771,7 +13771,7 @@ void Gambit_fn_0220A338(CPUState* cpu) {
         /* 0220A4B0 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t44);
         /* 0220A4B4 */ _t45 = cpu->r[1] + 0x00000040u;
         /* 0220A4B4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t45);
-        /* 0220A4B8 */ _t46 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220A4B8 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220A4B8 */ _t47 = _t46 & 0x00000001u;
         /* 0220A4B8 */ if (_t47) goto L_0220A4BC; // else: addr-0 trap, fall-through
   L_0220A4BC: ; // 0x220a4bc
@@ -13889,7 +13889,7 @@ void Gambit_fn_0220A4CC(CPUState* cpu) {
         /* 0220A5C8 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t33);
         /* 0220A5CC */ _t34 = cpu->r[1] + 0x00000058u;
         /* 0220A5CC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t34);
-        /* 0220A5D0 */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220A5D0 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220A5D0 */ _t36 = _t35 & 0x00000001u;
         /* 0220A5D0 */ if (_t36) goto L_0220A5D4; // else: addr-0 trap, fall-through
   L_0220A5D4: ; // 0x220a5d4
@@ -14007,7 +14007,7 @@ void Gambit_fn_0220A5E4(CPUState* cpu) {
         /* 0220A6E0 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t34);
         /* 0220A6E4 */ _t35 = cpu->r[1] + 0x00000060u;
         /* 0220A6E4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t35);
-        /* 0220A6E8 */ _t36 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220A6E8 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220A6E8 */ _t37 = _t36 & 0x00000001u;
         /* 0220A6E8 */ if (_t37) goto L_0220A6EC; // else: addr-0 trap, fall-through
   L_0220A6EC: ; // 0x220a6ec
@@ -14125,7 +14125,7 @@ void Gambit_fn_0220A6FC(CPUState* cpu) {
         /* 0220A7F8 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t33);
         /* 0220A7FC */ _t34 = cpu->r[1] + 0x00000058u;
         /* 0220A7FC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t34);
-        /* 0220A800 */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220A800 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220A800 */ _t36 = _t35 & 0x00000001u;
         /* 0220A800 */ if (_t36) goto L_0220A804; // else: addr-0 trap, fall-through
   L_0220A804: ; // 0x220a804
@@ -14184,33 +14184,33 @@ void Gambit_fn_0220A818(CPUState* cpu) {
         /* 0220A86C */ _t11 = cpu->r[12] + 0x0000252Cu;
         /* 0220A86C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t11);
         /* 0220A870 */ cpu->r[12] = 0x10040000u;
-        /* 0220A874 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0220A874 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0220A878 */ _t12 = cpu->r[10] + 0x00002528u;
         /* 0220A878 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t12);
         /* 0220A87C */ cpu->r[30] = 0x00000000u;
         /* 0220A880 */ _t13 = cpu->r[12] + 0x00002458u;
         /* 0220A880 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t13);
-        /* 0220A884 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220A884 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220A884 */ _t15 = _t14 & 0x00000001u;
         /* 0220A884 */ if (_t15) goto L_0220AA24; else goto L_0220A888;
   L_0220A888: ; // 0x220a888
         /* 0220A888 */ _t16 = cpu->r[3] + 0x0000001Cu;
         /* 0220A888 */ cpu->r[8] = rbrew_read32(cpu->mem, _t16);
-        /* 0220A88C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000002u);
-        /* 0220A890 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220A88C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000002u));
+        /* 0220A890 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220A890 */ _t18 = _t17 & 0x00000001u;
         /* 0220A890 */ if (_t18) goto L_0220AA24; else goto L_0220A894;
   L_0220A894: ; // 0x220a894
-        /* 0220A894 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000003u);
-        /* 0220A898 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220A894 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000003u));
+        /* 0220A898 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220A898 */ _t20 = _t19 & 0x00000001u;
         /* 0220A898 */ if (_t20) goto L_0220AA24; else goto L_0220A89C;
   L_0220A89C: ; // 0x220a89c
         /* 0220A89C */ _t21 = cpu->r[31] + 0x000001A0u;
         /* 0220A89C */ cpu->r[9] = rbrew_read32(cpu->mem, _t21);
         /* 0220A8A0 */ cpu->r[9] = rbrew_rlwinm(cpu->r[9], 0x00000000u, 0x00000014u, 0x00000015u);
-        /* 0220A8A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220A8A4 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220A8A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220A8A4 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220A8A4 */ _t23 = _t22 & 0x00000001u;
         /* 0220A8A4 */ if (_t23) goto L_0220A8A8; else goto L_0220A93C;
   L_0220A8A8: ; // 0x220a8a8
@@ -14266,8 +14266,8 @@ void Gambit_fn_0220A818(CPUState* cpu) {
         /* 0220A924 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t41);
         /* 0220A928 */ cpu->f[7] = fma(cpu->f[0], cpu->f[0], cpu->f[12]);
         /* 0220A92C */ cpu->f[9] = fma(cpu->f[13], cpu->f[13], cpu->f[7]);
-        /* 0220A930 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[29]);
-        /* 0220A934 */ _t42 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220A930 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[29]));
+        /* 0220A934 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220A934 */ _t43 = _t42 & 0x00000001u;
         /* 0220A934 */ if (_t43) goto L_0220A938; else goto L_0220ABB4;
   L_0220A938: ; // 0x220a938
@@ -14295,10 +14295,10 @@ void Gambit_fn_0220A818(CPUState* cpu) {
         /* 0220A96C */ _t51 = cpu->r[31] + 0x0000018Cu;
         /* 0220A96C */ rbrew_write_f32(cpu->mem, _t51, cpu->f[9]);
         /* 0220A970 */ cpu->r[11] = 0x10040000u;
-        /* 0220A974 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[29]);
+        /* 0220A974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[29]));
         /* 0220A978 */ _t52 = cpu->r[11] + 0x00002538u;
         /* 0220A978 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t52);
-        /* 0220A97C */ _t53 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220A97C */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220A97C */ _t54 = _t53 & 0x00000001u;
         /* 0220A97C */ if (_t54) goto L_0220A980; else goto L_0220A9B0;
   L_0220A980: ; // 0x220a980
@@ -14360,8 +14360,8 @@ void Gambit_fn_0220A818(CPUState* cpu) {
         /* 0220AA0C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t73);
         /* 0220AA10 */ cpu->f[7] = fma(cpu->f[0], cpu->f[0], cpu->f[12]);
         /* 0220AA14 */ cpu->f[9] = fma(cpu->f[13], cpu->f[13], cpu->f[7]);
-        /* 0220AA18 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[29]);
-        /* 0220AA1C */ _t74 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220AA18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[29]));
+        /* 0220AA1C */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220AA1C */ _t75 = _t74 & 0x00000001u;
         /* 0220AA1C */ if (_t75) goto L_0220AA20; else goto L_0220ABB4;
   L_0220AA20: ; // 0x220aa20
@@ -14369,20 +14369,20 @@ void Gambit_fn_0220A818(CPUState* cpu) {
   L_0220AA24: ; // 0x220aa24
         /* 0220AA24 */ _t76 = cpu->r[31] + 0x00000180u;
         /* 0220AA24 */ cpu->r[11] = rbrew_read32(cpu->mem, _t76);
-        /* 0220AA28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0220AA2C */ _t77 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220AA28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0220AA2C */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220AA2C */ _t78 = _t77 & 0x00000001u;
         /* 0220AA2C */ if (_t78) goto L_0220AAD8; else goto L_0220AA30;
   L_0220AA30: ; // 0x220aa30
         /* 0220AA30 */ _t79 = cpu->r[11] + 0x0000001Cu;
         /* 0220AA30 */ cpu->r[10] = rbrew_read32(cpu->mem, _t79);
-        /* 0220AA34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000002u);
-        /* 0220AA38 */ _t80 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220AA34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000002u));
+        /* 0220AA38 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220AA38 */ _t81 = _t80 & 0x00000001u;
         /* 0220AA38 */ if (_t81) goto L_0220AAD8; else goto L_0220AA3C;
   L_0220AA3C: ; // 0x220aa3c
-        /* 0220AA3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000003u);
-        /* 0220AA40 */ _t82 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220AA3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000003u));
+        /* 0220AA40 */ _t82 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220AA40 */ _t83 = _t82 & 0x00000001u;
         /* 0220AA40 */ if (_t83) goto L_0220AAD8; else goto L_0220AA44;
   L_0220AA44: ; // 0x220aa44
@@ -14438,8 +14438,8 @@ void Gambit_fn_0220A818(CPUState* cpu) {
         /* 0220AAC0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t101);
         /* 0220AAC4 */ cpu->f[7] = fma(cpu->f[0], cpu->f[0], cpu->f[12]);
         /* 0220AAC8 */ cpu->f[9] = fma(cpu->f[13], cpu->f[13], cpu->f[7]);
-        /* 0220AACC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[29]);
-        /* 0220AAD0 */ _t102 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220AACC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[29]));
+        /* 0220AAD0 */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220AAD0 */ _t103 = _t102 & 0x00000001u;
         /* 0220AAD0 */ if (_t103) goto L_0220AAD4; else goto L_0220ABB4;
   L_0220AAD4: ; // 0x220aad4
@@ -14447,20 +14447,20 @@ void Gambit_fn_0220A818(CPUState* cpu) {
   L_0220AAD8: ; // 0x220aad8
         /* 0220AAD8 */ _t104 = cpu->r[31] + 0x00000178u;
         /* 0220AAD8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t104);
-        /* 0220AADC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0220AAE0 */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220AADC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0220AAE0 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220AAE0 */ _t106 = _t105 & 0x00000001u;
         /* 0220AAE0 */ if (_t106) goto L_0220AB1C; else goto L_0220AAE4;
   L_0220AAE4: ; // 0x220aae4
         /* 0220AAE4 */ _t107 = cpu->r[7] + 0x0000001Cu;
         /* 0220AAE4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t107);
-        /* 0220AAE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000002u);
-        /* 0220AAEC */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220AAE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000002u));
+        /* 0220AAEC */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220AAEC */ _t109 = _t108 & 0x00000001u;
         /* 0220AAEC */ if (_t109) goto L_0220AB1C; else goto L_0220AAF0;
   L_0220AAF0: ; // 0x220aaf0
-        /* 0220AAF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000003u);
-        /* 0220AAF4 */ _t110 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220AAF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000003u));
+        /* 0220AAF4 */ _t110 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220AAF4 */ _t111 = _t110 & 0x00000001u;
         /* 0220AAF4 */ if (_t111) goto L_0220AB1C; else goto L_0220AAF8;
   L_0220AAF8: ; // 0x220aaf8
@@ -14517,8 +14517,8 @@ void Gambit_fn_0220A818(CPUState* cpu) {
         /* 0220AB74 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t129);
         /* 0220AB78 */ cpu->f[7] = fma(cpu->f[0], cpu->f[0], cpu->f[12]);
         /* 0220AB7C */ cpu->f[9] = fma(cpu->f[13], cpu->f[13], cpu->f[7]);
-        /* 0220AB80 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[29]);
-        /* 0220AB84 */ _t130 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220AB80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[29]));
+        /* 0220AB84 */ _t130 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220AB84 */ _t131 = _t130 & 0x00000001u;
         /* 0220AB84 */ if (_t131) goto L_0220AB88; else goto L_0220ABB4;
   L_0220AB88: ; // 0x220ab88
@@ -14551,8 +14551,8 @@ void Gambit_fn_0220A818(CPUState* cpu) {
         /* 0220ABD0 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 0220ABD4 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 0220ABD8 */ Gambit_fn_021C6DD8(cpu);
-        /* 0220ABDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220ABE0 */ _t139 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220ABDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220ABE0 */ _t139 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220ABE0 */ _t140 = _t139 & 0x00000001u;
         /* 0220ABE0 */ if (_t140) goto L_0220ABE4; else goto L_0220ABF8;
   L_0220ABE4: ; // 0x220abe4
@@ -14618,7 +14618,7 @@ void Gambit_fn_0220A818(CPUState* cpu) {
         /* 0220AC78 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t161);
         /* 0220AC7C */ _t162 = cpu->r[1] + 0x00000098u;
         /* 0220AC7C */ cpu->r[30] = rbrew_read32(cpu->mem, _t162);
-        /* 0220AC80 */ _t163 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220AC80 */ _t163 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220AC80 */ _t164 = _t163 & 0x00000001u;
         /* 0220AC80 */ if (_t164) goto L_0220AC84; // else: addr-0 trap, fall-through
   L_0220AC84: ; // 0x220ac84
@@ -14789,10 +14789,10 @@ void Gambit_fn_0220AD10(CPUState* cpu) {
         /* 0220AD6C */ _t14 = cpu->r[30] + 0x0000017Cu;
         /* 0220AD6C */ cpu->r[10] = rbrew_read32(cpu->mem, _t14);
         /* 0220AD70 */ cpu->r[12] = 0x10040000u;
-        /* 0220AD74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0220AD74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0220AD78 */ _t15 = cpu->r[12] + 0x00002540u;
         /* 0220AD78 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t15);
-        /* 0220AD7C */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220AD7C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220AD7C */ _t17 = _t16 & 0x00000001u;
         /* 0220AD7C */ if (_t17) goto L_0220ADE4; else goto L_0220AD80;
   L_0220AD80: ; // 0x220ad80
@@ -14828,10 +14828,10 @@ void Gambit_fn_0220AD10(CPUState* cpu) {
         /* 0220ADCC */ cpu->f[8] = fma(cpu->f[10], cpu->f[10], cpu->f[0]);
         /* 0220ADD0 */ _t28 = cpu->r[10] + 0x00002528u;
         /* 0220ADD0 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t28);
-        /* 0220ADD4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[30]);
+        /* 0220ADD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[30]));
         /* 0220ADD8 */ _t29 = cpu->r[1] + 0x00000010u;
         /* 0220ADD8 */ rbrew_write_f32(cpu->mem, _t29, cpu->f[9]);
-        /* 0220ADDC */ _t30 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220ADDC */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220ADDC */ _t31 = _t30 & 0x00000001u;
         /* 0220ADDC */ if (_t31) goto L_0220ADE0; else goto L_0220AFBC;
   L_0220ADE0: ; // 0x220ade0
@@ -14839,8 +14839,8 @@ void Gambit_fn_0220AD10(CPUState* cpu) {
   L_0220ADE4: ; // 0x220ade4
         /* 0220ADE4 */ _t32 = cpu->r[30] + 0x00000180u;
         /* 0220ADE4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t32);
-        /* 0220ADE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 0220ADEC */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220ADE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 0220ADEC */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220ADEC */ _t34 = _t33 & 0x00000001u;
         /* 0220ADEC */ if (_t34) goto L_0220AE54; else goto L_0220ADF0;
   L_0220ADF0: ; // 0x220adf0
@@ -14876,10 +14876,10 @@ void Gambit_fn_0220AD10(CPUState* cpu) {
         /* 0220AE3C */ cpu->r[10] = 0x10040000u;
         /* 0220AE40 */ _t45 = cpu->r[10] + 0x00002528u;
         /* 0220AE40 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t45);
-        /* 0220AE44 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[30]);
+        /* 0220AE44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[30]));
         /* 0220AE48 */ _t46 = cpu->r[1] + 0x00000010u;
         /* 0220AE48 */ rbrew_write_f32(cpu->mem, _t46, cpu->f[9]);
-        /* 0220AE4C */ _t47 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220AE4C */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220AE4C */ _t48 = _t47 & 0x00000001u;
         /* 0220AE4C */ if (_t48) goto L_0220AE50; else goto L_0220AFBC;
   L_0220AE50: ; // 0x220ae50
@@ -14887,8 +14887,8 @@ void Gambit_fn_0220AD10(CPUState* cpu) {
   L_0220AE54: ; // 0x220ae54
         /* 0220AE54 */ _t49 = cpu->r[30] + 0x00000178u;
         /* 0220AE54 */ cpu->r[11] = rbrew_read32(cpu->mem, _t49);
-        /* 0220AE58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0220AE5C */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220AE58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0220AE5C */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220AE5C */ _t51 = _t50 & 0x00000001u;
         /* 0220AE5C */ if (_t51) goto L_0220AEC4; else goto L_0220AE60;
   L_0220AE60: ; // 0x220ae60
@@ -14924,10 +14924,10 @@ void Gambit_fn_0220AD10(CPUState* cpu) {
         /* 0220AEAC */ cpu->f[8] = fma(cpu->f[10], cpu->f[10], cpu->f[0]);
         /* 0220AEB0 */ _t62 = cpu->r[10] + 0x00002528u;
         /* 0220AEB0 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t62);
-        /* 0220AEB4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[30]);
+        /* 0220AEB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[30]));
         /* 0220AEB8 */ _t63 = cpu->r[1] + 0x00000010u;
         /* 0220AEB8 */ rbrew_write_f32(cpu->mem, _t63, cpu->f[9]);
-        /* 0220AEBC */ _t64 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220AEBC */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220AEBC */ _t65 = _t64 & 0x00000001u;
         /* 0220AEBC */ if (_t65) goto L_0220AEC0; else goto L_0220AFBC;
   L_0220AEC0: ; // 0x220aec0
@@ -14936,8 +14936,8 @@ void Gambit_fn_0220AD10(CPUState* cpu) {
         /* 0220AEC4 */ _t66 = cpu->r[30] + 0x000001A0u;
         /* 0220AEC4 */ cpu->r[6] = rbrew_read32(cpu->mem, _t66);
         /* 0220AEC8 */ cpu->r[6] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0220AEC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0220AECC */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220AEC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0220AECC */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220AECC */ _t68 = _t67 & 0x00000001u;
         /* 0220AECC */ if (_t68) goto L_0220AED0; else goto L_0220B2AC;
   L_0220AED0: ; // 0x220aed0
@@ -15010,12 +15010,12 @@ void Gambit_fn_0220AD10(CPUState* cpu) {
         /* 0220AF6C */ _t96 = cpu->r[1] + 0x00000074u;
         /* 0220AF6C */ rbrew_write32(cpu->mem, _t96, cpu->r[12]);
         /* 0220AF70 */ cpu->r[10] = 0x10040000u;
-        /* 0220AF74 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[30]);
+        /* 0220AF74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[30]));
         /* 0220AF78 */ _t97 = cpu->r[10] + 0x00002528u;
         /* 0220AF78 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t97);
         /* 0220AF7C */ _t98 = cpu->r[1] + 0x00000078u;
         /* 0220AF7C */ rbrew_write32(cpu->mem, _t98, cpu->r[0]);
-        /* 0220AF80 */ _t99 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220AF80 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220AF80 */ _t100 = _t99 & 0x00000001u;
         /* 0220AF80 */ if (_t100) goto L_0220AF84; else goto L_0220AFBC;
   L_0220AF84: ; // 0x220af84
@@ -15063,10 +15063,10 @@ void Gambit_fn_0220AD10(CPUState* cpu) {
         /* 0220AFF0 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t113);
         /* 0220AFF4 */ cpu->f[1] = -cpu->f[11];
         /* 0220AFF8 */ cpu->r[6] = 0x10040000u;
-        /* 0220AFFC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
+        /* 0220AFFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
         /* 0220B000 */ _t114 = cpu->r[6] + 0x00002520u;
         /* 0220B000 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t114);
-        /* 0220B004 */ _t115 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220B004 */ _t115 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220B004 */ _t116 = _t115 & 0x00000001u;
         /* 0220B004 */ if (_t116) goto L_0220B008; else goto L_0220B03C;
   L_0220B008: ; // 0x220b008
@@ -15080,19 +15080,19 @@ void Gambit_fn_0220AD10(CPUState* cpu) {
         /* 0220B01C */ _t119 = cpu->r[1] + 0x00000020u;
         /* 0220B01C */ rbrew_write_f32(cpu->mem, _t119, cpu->f[13]);
         /* 0220B020 */ cpu->f[10] = fma(cpu->f[13], cpu->f[13], cpu->f[12]);
-        /* 0220B024 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[30]);
+        /* 0220B024 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[30]));
         /* 0220B028 */ _t120 = cpu->r[1] + 0x00000024u;
         /* 0220B028 */ rbrew_write_f32(cpu->mem, _t120, cpu->f[7]);
         /* 0220B02C */ cpu->f[27] = cpu->f[1];
-        /* 0220B030 */ _t121 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220B030 */ _t121 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220B030 */ _t122 = _t121 & 0x00000001u;
         /* 0220B030 */ if (_t122) goto L_0220B070; else goto L_0220B034;
   L_0220B034: ; // 0x220b034
         /* 0220B034 */ cpu->f[1] = cpu->f[30];
         /* 0220B038 */ goto L_0220B0CC;
   L_0220B03C: ; // 0x220b03c
-        /* 0220B03C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[28]);
-        /* 0220B040 */ _t123 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220B03C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[28]));
+        /* 0220B040 */ _t123 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220B040 */ _t124 = _t123 & 0x00000001u;
         /* 0220B040 */ if (_t124) goto L_0220B044; else goto L_0220B048;
   L_0220B044: ; // 0x220b044
@@ -15107,11 +15107,11 @@ void Gambit_fn_0220AD10(CPUState* cpu) {
         /* 0220B058 */ _t127 = cpu->r[1] + 0x00000020u;
         /* 0220B058 */ rbrew_write_f32(cpu->mem, _t127, cpu->f[13]);
         /* 0220B05C */ cpu->f[10] = fma(cpu->f[13], cpu->f[13], cpu->f[12]);
-        /* 0220B060 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[30]);
+        /* 0220B060 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[30]));
         /* 0220B064 */ _t128 = cpu->r[1] + 0x00000024u;
         /* 0220B064 */ rbrew_write_f32(cpu->mem, _t128, cpu->f[7]);
         /* 0220B068 */ cpu->f[27] = cpu->f[1];
-        /* 0220B06C */ _t129 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220B06C */ _t129 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220B06C */ _t130 = _t129 & 0x00000001u;
         /* 0220B06C */ if (_t130) goto L_0220B070; else goto L_0220B034;
   L_0220B070: ; // 0x220b070
@@ -15127,17 +15127,17 @@ void Gambit_fn_0220AD10(CPUState* cpu) {
         /* 0220B088 */ cpu->f[12] = cpu->f[0] * cpu->f[7];
         /* 0220B08C */ cpu->f[10] = cpu->f[10] * cpu->f[12];
         /* 0220B090 */ /* nop */
-        /* 0220B094 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[30]);
+        /* 0220B094 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[30]));
         /* 0220B098 */ /* nop */
         /* 0220B09C */ /* nop */
-        /* 0220B0A0 */ _t134 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220B0A0 */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220B0A0 */ _t135 = _t134 & 0x00000001u;
         /* 0220B0A0 */ if (_t135) goto L_0220B0A4; else goto L_0220B034;
   L_0220B0A4: ; // 0x220b0a4
         /* 0220B0A4 */ _t136 = cpu->r[1] + 0x00000020u;
         /* 0220B0A4 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t136);
-        /* 0220B0A8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
-        /* 0220B0AC */ _t137 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220B0A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
+        /* 0220B0AC */ _t137 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220B0AC */ _t138 = _t137 & 0x00000001u;
         /* 0220B0AC */ if (_t138) goto L_0220B0B0; else goto L_0220B0BC;
   L_0220B0B0: ; // 0x220b0b0
@@ -15145,8 +15145,8 @@ void Gambit_fn_0220AD10(CPUState* cpu) {
         /* 0220B0B4 */ Gambit_fn_02C892F8(cpu);
         /* 0220B0B8 */ goto L_0220B0CC;
   L_0220B0BC: ; // 0x220b0bc
-        /* 0220B0BC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[28]);
-        /* 0220B0C0 */ _t139 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220B0BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[28]));
+        /* 0220B0C0 */ _t139 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220B0C0 */ _t140 = _t139 & 0x00000001u;
         /* 0220B0C0 */ if (_t140) goto L_0220B0C4; else goto L_0220B0C8;
   L_0220B0C4: ; // 0x220b0c4
@@ -15358,7 +15358,7 @@ void Gambit_fn_0220AD10(CPUState* cpu) {
         /* 0220B2D4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t209);
         /* 0220B2D8 */ _t210 = cpu->r[1] + 0x00000118u;
         /* 0220B2D8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t210);
-        /* 0220B2DC */ _t211 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220B2DC */ _t211 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220B2DC */ _t212 = _t211 & 0x00000001u;
         /* 0220B2DC */ if (_t212) goto L_0220B2E0; // else: addr-0 trap, fall-through
   L_0220B2E0: ; // 0x220b2e0
@@ -15378,8 +15378,8 @@ void Gambit_fn_0220B2F0(CPUState* cpu) {
         /* 0220B2F0 */ _t0 = cpu->r[3] + 0x000001A0u;
         /* 0220B2F0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0220B2F4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000010u, 0x00000011u);
-        /* 0220B2F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0220B2F8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B2F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0220B2F8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B2F8 */ _t2 = _t1 & 0x00000001u;
         /* 0220B2F8 */ if (_t2) goto L_0220B300; else goto L_0220B2FC;
   L_0220B2FC: ; // 0x220b2fc
@@ -15411,10 +15411,10 @@ void Gambit_fn_0220B2F0(CPUState* cpu) {
         /* 0222E364 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t11);
         /* 0222E368 */ cpu->f[7] = fma(cpu->f[9], cpu->f[9], cpu->f[0]);
         /* 0222E36C */ cpu->r[10] = 0x10050000u;
-        /* 0222E370 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[12]);
+        /* 0222E370 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[12]));
         /* 0222E374 */ _t12 = cpu->r[10] + 0x000000A4u;
         /* 0222E374 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t12);
-        /* 0222E378 */ _t13 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222E378 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222E378 */ _t14 = _t13 & 0x00000001u;
         /* 0222E378 */ if (_t14) goto L_0222E3A0; else goto L_0222E37C;
   L_0222E37C: ; // 0x222e37c
@@ -15425,10 +15425,10 @@ void Gambit_fn_0220B2F0(CPUState* cpu) {
         /* 0222E388 */ _t16 = cpu->r[1] + 0x0000000Cu;
         /* 0222E388 */ rbrew_write_f32(cpu->mem, _t16, cpu->f[8]);
         /* 0222E38C */ cpu->f[7] = cpu->f[7] / cpu->f[0];
-        /* 0222E390 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[10]);
+        /* 0222E390 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[10]));
         /* 0222E394 */ _t17 = cpu->r[1] + 0x00000008u;
         /* 0222E394 */ rbrew_write_f32(cpu->mem, _t17, cpu->f[9]);
-        /* 0222E398 */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222E398 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222E398 */ _t19 = _t18 & 0x00000001u;
         /* 0222E398 */ if (_t19) goto L_0222E3DC; else goto L_0222E39C;
   L_0222E39C: ; // 0x222e39c
@@ -15452,10 +15452,10 @@ void Gambit_fn_0220B2F0(CPUState* cpu) {
         /* 0222E3C8 */ rbrew_write_f32(cpu->mem, _t24, cpu->f[8]);
         /* 0222E3CC */ _t25 = cpu->r[5] + 0x00000000u;
         /* 0222E3CC */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t25);
-        /* 0222E3D0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[10]);
+        /* 0222E3D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[10]));
         /* 0222E3D4 */ _t26 = cpu->r[1] + 0x00000008u;
         /* 0222E3D4 */ rbrew_write_f32(cpu->mem, _t26, cpu->f[9]);
-        /* 0222E3D8 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222E3D8 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222E3D8 */ _t28 = _t27 & 0x00000001u;
         /* 0222E3D8 */ if (_t28) goto L_0222E3DC; else goto L_0222E3E0;
   L_0222E3DC: ; // 0x222e3dc
@@ -15463,8 +15463,8 @@ void Gambit_fn_0220B2F0(CPUState* cpu) {
   L_0222E3E0: ; // 0x222e3e0
         /* 0222E3E0 */ cpu->f[11] = cpu->f[8] * cpu->f[8];
         /* 0222E3E4 */ cpu->f[9] = fma(cpu->f[9], cpu->f[9], cpu->f[11]);
-        /* 0222E3E8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[12]);
-        /* 0222E3EC */ _t29 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222E3E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[12]));
+        /* 0222E3EC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222E3EC */ _t30 = _t29 & 0x00000001u;
         /* 0222E3EC */ if (_t30) goto L_0222E3F0; else goto L_0222E414;
   L_0222E3F0: ; // 0x222e3f0
@@ -15528,8 +15528,8 @@ void Gambit_fn_0220B328(CPUState* cpu) {
         /* 0220B32C */ _t3 = cpu->r[4] + 0x000001A0u;
         /* 0220B32C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 0220B330 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0220B330 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0220B334 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B330 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0220B334 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B334 */ _t5 = _t4 & 0x00000001u;
         /* 0220B334 */ _t6 = _t5 ^ 0x00000001u;
         /* 0220B334 */ if (_t6) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -15626,10 +15626,10 @@ void Gambit_fn_0220B384(CPUState* cpu) {
         /* 0220B3B0 */ _t7 = cpu->r[28] + 0x0000002Cu;
         /* 0220B3B0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t7);
         /* 0220B3B4 */ cpu->r[31] = cpu->r[6];
-        /* 0220B3B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[0]);
+        /* 0220B3B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[0]));
         /* 0220B3BC */ _t8 = cpu->r[1] + 0x00000008u;
         /* 0220B3BC */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
-        /* 0220B3C0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B3C0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B3C0 */ _t10 = _t9 & 0x00000001u;
         /* 0220B3C0 */ if (_t10) goto L_0220B3C4; else goto L_0220B3EC;
   L_0220B3C4: ; // 0x220b3c4
@@ -15653,15 +15653,15 @@ void Gambit_fn_0220B384(CPUState* cpu) {
         /* 0220B3EC */ _t17 = cpu->r[28] + 0x000001A0u;
         /* 0220B3EC */ cpu->r[9] = rbrew_read32(cpu->mem, _t17);
         /* 0220B3F0 */ cpu->r[9] = rbrew_rlwinm(cpu->r[9], 0x00000000u, 0x00000010u, 0x00000011u);
-        /* 0220B3F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220B3F4 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B3F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220B3F4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B3F4 */ _t19 = _t18 & 0x00000001u;
         /* 0220B3F4 */ if (_t19) goto L_0220B430; else goto L_0220B3F8;
   L_0220B3F8: ; // 0x220b3f8
         /* 0220B3F8 */ cpu->r[3] = cpu->r[29];
         /* 0220B3FC */ Gambit_fn_021BCFBC(cpu);
-        /* 0220B400 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220B404 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B400 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220B404 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B404 */ _t21 = _t20 & 0x00000001u;
         /* 0220B404 */ if (_t21) goto L_0220B430; else goto L_0220B408;
   L_0220B408: ; // 0x220b408
@@ -15732,10 +15732,10 @@ void Gambit_fn_0220B388(CPUState* cpu) {
         /* 0220B3B0 */ _t7 = cpu->r[28] + 0x0000002Cu;
         /* 0220B3B0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t7);
         /* 0220B3B4 */ cpu->r[31] = cpu->r[6];
-        /* 0220B3B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[0]);
+        /* 0220B3B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[0]));
         /* 0220B3BC */ _t8 = cpu->r[1] + 0x00000008u;
         /* 0220B3BC */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
-        /* 0220B3C0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B3C0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B3C0 */ _t10 = _t9 & 0x00000001u;
         /* 0220B3C0 */ if (_t10) goto L_0220B3C4; else goto L_0220B3EC;
   L_0220B3C4: ; // 0x220b3c4
@@ -15759,15 +15759,15 @@ void Gambit_fn_0220B388(CPUState* cpu) {
         /* 0220B3EC */ _t17 = cpu->r[28] + 0x000001A0u;
         /* 0220B3EC */ cpu->r[9] = rbrew_read32(cpu->mem, _t17);
         /* 0220B3F0 */ cpu->r[9] = rbrew_rlwinm(cpu->r[9], 0x00000000u, 0x00000010u, 0x00000011u);
-        /* 0220B3F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220B3F4 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B3F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220B3F4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B3F4 */ _t19 = _t18 & 0x00000001u;
         /* 0220B3F4 */ if (_t19) goto L_0220B430; else goto L_0220B3F8;
   L_0220B3F8: ; // 0x220b3f8
         /* 0220B3F8 */ cpu->r[3] = cpu->r[29];
         /* 0220B3FC */ Gambit_fn_021BCFBC(cpu);
-        /* 0220B400 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220B404 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B400 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220B404 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B404 */ _t21 = _t20 & 0x00000001u;
         /* 0220B404 */ if (_t21) goto L_0220B430; else goto L_0220B408;
   L_0220B408: ; // 0x220b408
@@ -15821,18 +15821,18 @@ void Gambit_fn_0220B46C(CPUState* cpu) {
         /* 0220B46C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0220B470 */ _t1 = cpu->r[5] + 0x00000000u;
         /* 0220B470 */ cpu->r[10] = rbrew_read32(cpu->mem, _t1);
-        /* 0220B474 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[0]);
-        /* 0220B478 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B474 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[0]));
+        /* 0220B478 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B478 */ _t3 = _t2 & 0x00000001u;
         /* 0220B478 */ if (_t3) goto L_0220B498; else goto L_0220B47C;
   L_0220B47C: ; // 0x220b47c
-        /* 0220B47C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000005u);
-        /* 0220B480 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B47C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000005u));
+        /* 0220B480 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B480 */ _t5 = _t4 & 0x00000001u;
         /* 0220B480 */ if (_t5) goto L_0220B48C; else goto L_0220B484;
   L_0220B484: ; // 0x220b484
-        /* 0220B484 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000008u);
-        /* 0220B488 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B484 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000008u));
+        /* 0220B488 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B488 */ _t7 = _t6 & 0x00000001u;
         /* 0220B488 */ if (_t7) goto L_0220B48C; else goto L_0220B498;
   L_0220B48C: ; // 0x220b48c
@@ -15903,8 +15903,8 @@ void Gambit_fn_0220B4C4(CPUState* cpu) {
         /* 0220B4C4 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0220B4C4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0220B4C8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 0220B4C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0220B4CC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B4C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0220B4CC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B4CC */ _t2 = _t1 & 0x00000001u;
         /* 0220B4CC */ _t3 = _t2 ^ 0x00000001u;
         /* 0220B4CC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -15926,8 +15926,8 @@ void Gambit_fn_0220B4E0(CPUState* cpu) {
         /* 0220B4E0 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0220B4E0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0220B4E4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 0220B4E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0220B4E8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B4E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0220B4E8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B4E8 */ _t2 = _t1 & 0x00000001u;
         /* 0220B4E8 */ _t3 = _t2 ^ 0x00000001u;
         /* 0220B4E8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -15949,8 +15949,8 @@ void Gambit_fn_0220B4FC(CPUState* cpu) {
         /* 0220B4FC */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0220B4FC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0220B500 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 0220B500 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0220B504 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B500 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0220B504 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B504 */ _t2 = _t1 & 0x00000001u;
         /* 0220B504 */ _t3 = _t2 ^ 0x00000001u;
         /* 0220B504 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -15993,8 +15993,8 @@ void Gambit_fn_0220B528(CPUState* cpu) {
         /* 0220B538 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0220B53C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0220B53C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0220B540 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0220B544 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B540 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0220B544 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B544 */ _t5 = _t4 & 0x00000001u;
         /* 0220B544 */ if (_t5) goto L_0220B548; else goto L_0220B564;
   L_0220B548: ; // 0x220b548
@@ -16033,8 +16033,8 @@ void Gambit_fn_0220B52C(CPUState* cpu) {
         /* 0220B538 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0220B53C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0220B53C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0220B540 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0220B544 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B540 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0220B544 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B544 */ _t5 = _t4 & 0x00000001u;
         /* 0220B544 */ if (_t5) goto L_0220B548; else goto L_0220B564;
   L_0220B548: ; // 0x220b548
@@ -16478,8 +16478,8 @@ void Gambit_fn_0220B72C(CPUState* cpu) {
         /* 0220B72C */ _t0 = cpu->r[3] + 0x00000114u;
         /* 0220B72C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0220B730 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0220B730 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0220B734 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B730 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0220B734 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B734 */ _t2 = _t1 & 0x00000001u;
         /* 0220B734 */ if (_t2) goto L_0220B744; else goto L_0220B738;
   L_0220B738: ; // 0x220b738
@@ -16508,8 +16508,8 @@ void Gambit_fn_0220B750(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -16604,9 +16604,9 @@ void Gambit_fn_0220B7A0(CPUState* cpu) {
         /* 0220B7A4 */ _t0 = cpu->r[8] + 0xFFFFFC40u;
         /* 0220B7A4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 0220B7A8 */ cpu->r[6] = 0x101D0000u;
-        /* 0220B7AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0220B7AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0220B7B0 */ cpu->r[6] = cpu->r[6] + 0xFFFFFD7Cu;
-        /* 0220B7B4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B7B4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B7B4 */ _t2 = _t1 & 0x00000001u;
         /* 0220B7B4 */ if (_t2) goto L_0220B7B8; else goto L_0220B7D0;
   L_0220B7B8: ; // 0x220b7b8
@@ -16619,8 +16619,8 @@ void Gambit_fn_0220B7A0(CPUState* cpu) {
         /* 0220B7CC */ _t4 = cpu->r[6] + 0x00000000u;
         /* 0220B7CC */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_0220B7D0: ; // 0x220b7d0
-        /* 0220B7D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 0220B7D4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B7D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 0220B7D4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B7D4 */ _t6 = _t5 & 0x00000001u;
         /* 0220B7D4 */ if (_t6) goto L_0220B7D8; else goto L_0220B7E0;
   L_0220B7D8: ; // 0x220b7d8
@@ -16631,9 +16631,9 @@ void Gambit_fn_0220B7A0(CPUState* cpu) {
         /* 0220B7E4 */ _t7 = cpu->r[10] + 0xFFFFDA0Cu;
         /* 0220B7E4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 0220B7E8 */ cpu->r[8] = 0x101D0000u;
-        /* 0220B7EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0220B7EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0220B7F0 */ cpu->r[8] = cpu->r[8] + 0xFFFFFC00u;
-        /* 0220B7F4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B7F4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B7F4 */ _t9 = _t8 & 0x00000001u;
         /* 0220B7F4 */ if (_t9) goto L_0220B7F8; else goto L_0220B810;
   L_0220B7F8: ; // 0x220b7f8
@@ -16646,8 +16646,8 @@ void Gambit_fn_0220B7A0(CPUState* cpu) {
         /* 0220B80C */ _t11 = cpu->r[8] + 0x00000000u;
         /* 0220B80C */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_0220B810: ; // 0x220b810
-        /* 0220B810 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 0220B814 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B810 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 0220B814 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B814 */ _t13 = _t12 & 0x00000001u;
         /* 0220B814 */ if (_t13) goto L_0220B818; else goto L_0220B820;
   L_0220B818: ; // 0x220b818
@@ -16658,9 +16658,9 @@ void Gambit_fn_0220B7A0(CPUState* cpu) {
         /* 0220B824 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 0220B824 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 0220B828 */ cpu->r[10] = 0x101D0000u;
-        /* 0220B82C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0220B82C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0220B830 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 0220B834 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B834 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B834 */ _t16 = _t15 & 0x00000001u;
         /* 0220B834 */ if (_t16) goto L_0220B838; else goto L_0220B850;
   L_0220B838: ; // 0x220b838
@@ -16673,8 +16673,8 @@ void Gambit_fn_0220B7A0(CPUState* cpu) {
         /* 0220B84C */ _t18 = cpu->r[10] + 0x00000000u;
         /* 0220B84C */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_0220B850: ; // 0x220b850
-        /* 0220B850 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0220B854 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B850 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0220B854 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B854 */ _t20 = _t19 & 0x00000001u;
         /* 0220B854 */ if (_t20) goto L_0220B858; else goto L_0220B860;
   L_0220B858: ; // 0x220b858
@@ -16685,9 +16685,9 @@ void Gambit_fn_0220B7A0(CPUState* cpu) {
         /* 0220B864 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 0220B864 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 0220B868 */ cpu->r[12] = 0x101D0000u;
-        /* 0220B86C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220B86C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220B870 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 0220B874 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B874 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B874 */ _t23 = _t22 & 0x00000001u;
         /* 0220B874 */ if (_t23) goto L_0220B878; else goto L_0220B890;
   L_0220B878: ; // 0x220b878
@@ -16700,8 +16700,8 @@ void Gambit_fn_0220B7A0(CPUState* cpu) {
         /* 0220B88C */ _t25 = cpu->r[12] + 0x00000000u;
         /* 0220B88C */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_0220B890: ; // 0x220b890
-        /* 0220B890 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0220B894 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B890 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0220B894 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B894 */ _t27 = _t26 & 0x00000001u;
         /* 0220B894 */ if (_t27) goto L_0220B898; else goto L_0220B8A0;
   L_0220B898: ; // 0x220b898
@@ -16713,9 +16713,9 @@ void Gambit_fn_0220B7A0(CPUState* cpu) {
         /* 0220B8A4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 0220B8A4 */ cpu->r[10] = _t28;
         /* 0220B8A8 */ cpu->r[7] = 0x101D0000u;
-        /* 0220B8AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220B8AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220B8B0 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 0220B8B4 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B8B4 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B8B4 */ _t30 = _t29 & 0x00000001u;
         /* 0220B8B4 */ if (_t30) goto L_0220B8B8; else goto L_0220B8CC;
   L_0220B8B8: ; // 0x220b8b8
@@ -16727,8 +16727,8 @@ void Gambit_fn_0220B7A0(CPUState* cpu) {
         /* 0220B8C8 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 0220B8C8 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_0220B8CC: ; // 0x220b8cc
-        /* 0220B8CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 0220B8D0 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B8CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 0220B8D0 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B8D0 */ _t34 = _t33 & 0x00000001u;
         /* 0220B8D0 */ if (_t34) goto L_0220B8D4; else goto L_0220B8DC;
   L_0220B8D4: ; // 0x220b8d4
@@ -16740,9 +16740,9 @@ void Gambit_fn_0220B7A0(CPUState* cpu) {
         /* 0220B8E0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 0220B8E0 */ cpu->r[8] = _t35;
         /* 0220B8E4 */ cpu->r[6] = 0x101D0000u;
-        /* 0220B8E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0220B8E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0220B8EC */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 0220B8F0 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B8F0 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B8F0 */ _t37 = _t36 & 0x00000001u;
         /* 0220B8F0 */ if (_t37) goto L_0220B8F4; else goto L_0220B908;
   L_0220B8F4: ; // 0x220b8f4
@@ -16793,9 +16793,9 @@ void Gambit_fn_0220B934(CPUState* cpu) {
         /* 0220B938 */ _t0 = cpu->r[7] + 0xFFFFFC48u;
         /* 0220B938 */ cpu->r[7] = rbrew_read32(cpu->mem, _t0);
         /* 0220B93C */ cpu->r[8] = 0x101D0000u;
-        /* 0220B940 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0220B940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0220B944 */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC4u;
-        /* 0220B948 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B948 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B948 */ _t2 = _t1 & 0x00000001u;
         /* 0220B948 */ if (_t2) goto L_0220B94C; else goto L_0220B964;
   L_0220B94C: ; // 0x220b94c
@@ -16808,8 +16808,8 @@ void Gambit_fn_0220B934(CPUState* cpu) {
         /* 0220B960 */ _t4 = cpu->r[8] + 0x00000000u;
         /* 0220B960 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_0220B964: ; // 0x220b964
-        /* 0220B964 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 0220B968 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B964 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 0220B968 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B968 */ _t6 = _t5 & 0x00000001u;
         /* 0220B968 */ if (_t6) goto L_0220B96C; else goto L_0220B974;
   L_0220B96C: ; // 0x220b96c
@@ -16820,9 +16820,9 @@ void Gambit_fn_0220B934(CPUState* cpu) {
         /* 0220B978 */ _t7 = cpu->r[8] + 0xFFFFFC40u;
         /* 0220B978 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 0220B97C */ cpu->r[11] = 0x101D0000u;
-        /* 0220B980 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0220B980 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0220B984 */ cpu->r[11] = cpu->r[11] + 0xFFFFFD7Cu;
-        /* 0220B988 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B988 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B988 */ _t9 = _t8 & 0x00000001u;
         /* 0220B988 */ if (_t9) goto L_0220B98C; else goto L_0220B9A4;
   L_0220B98C: ; // 0x220b98c
@@ -16835,8 +16835,8 @@ void Gambit_fn_0220B934(CPUState* cpu) {
         /* 0220B9A0 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 0220B9A0 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_0220B9A4: ; // 0x220b9a4
-        /* 0220B9A4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 0220B9A8 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B9A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 0220B9A8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B9A8 */ _t13 = _t12 & 0x00000001u;
         /* 0220B9A8 */ if (_t13) goto L_0220B9AC; else goto L_0220B9B4;
   L_0220B9AC: ; // 0x220b9ac
@@ -16847,9 +16847,9 @@ void Gambit_fn_0220B934(CPUState* cpu) {
         /* 0220B9B8 */ _t14 = cpu->r[9] + 0xFFFFDA0Cu;
         /* 0220B9B8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t14);
         /* 0220B9BC */ cpu->r[8] = 0x101D0000u;
-        /* 0220B9C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0220B9C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0220B9C4 */ cpu->r[8] = cpu->r[8] + 0xFFFFFC00u;
-        /* 0220B9C8 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B9C8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B9C8 */ _t16 = _t15 & 0x00000001u;
         /* 0220B9C8 */ if (_t16) goto L_0220B9CC; else goto L_0220B9E4;
   L_0220B9CC: ; // 0x220b9cc
@@ -16862,8 +16862,8 @@ void Gambit_fn_0220B934(CPUState* cpu) {
         /* 0220B9E0 */ _t18 = cpu->r[8] + 0x00000000u;
         /* 0220B9E0 */ rbrew_write32(cpu->mem, _t18, cpu->r[10]);
   L_0220B9E4: ; // 0x220b9e4
-        /* 0220B9E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 0220B9E8 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220B9E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 0220B9E8 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220B9E8 */ _t20 = _t19 & 0x00000001u;
         /* 0220B9E8 */ if (_t20) goto L_0220B9EC; else goto L_0220B9F4;
   L_0220B9EC: ; // 0x220b9ec
@@ -16874,9 +16874,9 @@ void Gambit_fn_0220B934(CPUState* cpu) {
         /* 0220B9F8 */ _t21 = cpu->r[11] + 0xFFFFDA00u;
         /* 0220B9F8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 0220B9FC */ cpu->r[8] = 0x101D0000u;
-        /* 0220BA00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220BA00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220BA04 */ cpu->r[8] = cpu->r[8] + 0xFFFFFBFCu;
-        /* 0220BA08 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BA08 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BA08 */ _t23 = _t22 & 0x00000001u;
         /* 0220BA08 */ if (_t23) goto L_0220BA0C; else goto L_0220BA24;
   L_0220BA0C: ; // 0x220ba0c
@@ -16889,8 +16889,8 @@ void Gambit_fn_0220B934(CPUState* cpu) {
         /* 0220BA20 */ _t25 = cpu->r[8] + 0x00000000u;
         /* 0220BA20 */ rbrew_write32(cpu->mem, _t25, cpu->r[9]);
   L_0220BA24: ; // 0x220ba24
-        /* 0220BA24 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 0220BA28 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BA24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 0220BA28 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BA28 */ _t27 = _t26 & 0x00000001u;
         /* 0220BA28 */ if (_t27) goto L_0220BA2C; else goto L_0220BA34;
   L_0220BA2C: ; // 0x220ba2c
@@ -16901,9 +16901,9 @@ void Gambit_fn_0220B934(CPUState* cpu) {
         /* 0220BA38 */ _t28 = cpu->r[10] + 0xFFFFD9ECu;
         /* 0220BA38 */ cpu->r[10] = rbrew_read32(cpu->mem, _t28);
         /* 0220BA3C */ cpu->r[11] = 0x101D0000u;
-        /* 0220BA40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0220BA40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0220BA44 */ cpu->r[11] = cpu->r[11] + 0xFFFFFB4Cu;
-        /* 0220BA48 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BA48 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BA48 */ _t30 = _t29 & 0x00000001u;
         /* 0220BA48 */ if (_t30) goto L_0220BA4C; else goto L_0220BA64;
   L_0220BA4C: ; // 0x220ba4c
@@ -16916,8 +16916,8 @@ void Gambit_fn_0220B934(CPUState* cpu) {
         /* 0220BA60 */ _t32 = cpu->r[11] + 0x00000000u;
         /* 0220BA60 */ rbrew_write32(cpu->mem, _t32, cpu->r[7]);
   L_0220BA64: ; // 0x220ba64
-        /* 0220BA64 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 0220BA68 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BA64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 0220BA68 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BA68 */ _t34 = _t33 & 0x00000001u;
         /* 0220BA68 */ if (_t34) goto L_0220BA6C; else goto L_0220BA74;
   L_0220BA6C: ; // 0x220ba6c
@@ -16929,9 +16929,9 @@ void Gambit_fn_0220B934(CPUState* cpu) {
         /* 0220BA78 */ cpu->r[0] = rbrew_read32(cpu->mem, _t35);
         /* 0220BA78 */ cpu->r[11] = _t35;
         /* 0220BA7C */ cpu->r[10] = 0x101D0000u;
-        /* 0220BA80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0220BA80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0220BA84 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 0220BA88 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BA88 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BA88 */ _t37 = _t36 & 0x00000001u;
         /* 0220BA88 */ if (_t37) goto L_0220BA8C; else goto L_0220BAA0;
   L_0220BA8C: ; // 0x220ba8c
@@ -16943,8 +16943,8 @@ void Gambit_fn_0220B934(CPUState* cpu) {
         /* 0220BA9C */ _t39 = cpu->r[10] + 0x00000000u;
         /* 0220BA9C */ rbrew_write32(cpu->mem, _t39, cpu->r[0]);
   L_0220BAA0: ; // 0x220baa0
-        /* 0220BAA0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0220BAA4 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BAA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0220BAA4 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BAA4 */ _t41 = _t40 & 0x00000001u;
         /* 0220BAA4 */ if (_t41) goto L_0220BAA8; else goto L_0220BAB0;
   L_0220BAA8: ; // 0x220baa8
@@ -16956,9 +16956,9 @@ void Gambit_fn_0220B934(CPUState* cpu) {
         /* 0220BAB4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t42);
         /* 0220BAB4 */ cpu->r[10] = _t42;
         /* 0220BAB8 */ cpu->r[11] = 0x101D0000u;
-        /* 0220BABC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0220BABC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0220BAC0 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 0220BAC4 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BAC4 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BAC4 */ _t44 = _t43 & 0x00000001u;
         /* 0220BAC4 */ if (_t44) goto L_0220BAC8; else goto L_0220BADC;
   L_0220BAC8: ; // 0x220bac8
@@ -17048,9 +17048,9 @@ void Gambit_fn_0220BAFC(CPUState* cpu) {
         /* 02031BE4 */ _t4 = cpu->r[4] + 0x00000000u;
         /* 02031BE4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t4);
         /* 02031BE8 */ cpu->r[31] = cpu->r[4];
-        /* 02031BEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02031BEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02031BF0 */ cpu->r[30] = cpu->r[3];
-        /* 02031BF4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02031BF4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02031BF4 */ _t6 = _t5 & 0x00000001u;
         /* 02031BF4 */ if (_t6) goto L_02031C58; else goto L_02031BF8;
   L_02031BF8: ; // 0x2031bf8
@@ -17058,8 +17058,8 @@ void Gambit_fn_0220BAFC(CPUState* cpu) {
         /* 02031BF8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
         /* 02031BFC */ _t8 = cpu->r[3] + 0x0000011Cu;
         /* 02031BFC */ cpu->r[11] = rbrew_read8(cpu->mem, _t8);
-        /* 02031C00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02031C04 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02031C00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02031C04 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02031C04 */ _t10 = _t9 & 0x00000001u;
         /* 02031C04 */ if (_t10) goto L_02031C58; else goto L_02031C08;
   L_02031C08: ; // 0x2031c08
@@ -17107,8 +17107,8 @@ void Gambit_fn_0220BAFC(CPUState* cpu) {
         /* 0222D9F0 */ cpu->r[12] = cpu->r[3];
         /* 0222D9F4 */ _t22 = cpu->r[12] + 0x00000080u;
         /* 0222D9F4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t22);
-        /* 0222D9F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222D9FC */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D9F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222D9FC */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D9FC */ _t24 = _t23 & 0x00000001u;
         /* 0222D9FC */ if (_t24) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0222D9FC */ goto L_0222DA00;
@@ -17161,18 +17161,18 @@ void Gambit_fn_0220BB18(CPUState* cpu) {
         /* 0220BB2C */ _t3 = cpu->r[1] + 0x00000018u;
         /* 0220BB2C */ rbrew_write_f32(cpu->mem, _t3, cpu->f[31]);
         /* 0220BB30 */ cpu->r[31] = cpu->r[3];
-        /* 0220BB30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0220BB30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0220BB34 */ _t4 = cpu->r[1] + 0x00000024u;
         /* 0220BB34 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
-        /* 0220BB38 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BB38 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BB38 */ _t6 = _t5 & 0x00000001u;
         /* 0220BB38 */ if (_t6) goto L_0220BB3C; else goto L_0220BB4C;
   L_0220BB3C: ; // 0x220bb3c
         /* 0220BB3C */ cpu->r[3] = 0x00000264u;
         /* 0220BB40 */ Gambit_fn_02801A78(cpu);
         /* 0220BB44 */ cpu->r[31] = cpu->r[3];
-        /* 0220BB44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0220BB48 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BB44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0220BB48 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BB48 */ _t8 = _t7 & 0x00000001u;
         /* 0220BB48 */ if (_t8) goto L_0220BBEC; else goto L_0220BB4C;
   L_0220BB4C: ; // 0x220bb4c
@@ -17187,10 +17187,10 @@ void Gambit_fn_0220BB18(CPUState* cpu) {
         /* 0220BB64 */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
         /* 0220BB68 */ cpu->r[0] = 0x00000000u;
         /* 0220BB6C */ cpu->r[11] = cpu->r[31] + 0x00000238u;
-        /* 0220BB6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220BB6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220BB70 */ _t11 = cpu->r[31] + 0x00000224u;
         /* 0220BB70 */ rbrew_write16(cpu->mem, _t11, (uint16_t)cpu->r[0]);
-        /* 0220BB74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BB74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BB74 */ _t13 = _t12 & 0x00000001u;
         /* 0220BB74 */ if (_t13) goto L_0220BB78; else goto L_0220BB80;
   L_0220BB78: ; // 0x220bb78
@@ -17199,29 +17199,29 @@ void Gambit_fn_0220BB18(CPUState* cpu) {
   L_0220BB80: ; // 0x220bb80
         /* 0220BB80 */ cpu->r[12] = 0x10040000u;
         /* 0220BB84 */ cpu->r[3] = cpu->r[31] + 0x00000244u;
-        /* 0220BB84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0220BB84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0220BB88 */ _t14 = cpu->r[12] + 0x00002E7Cu;
         /* 0220BB88 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t14);
-        /* 0220BB8C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BB8C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BB8C */ _t16 = _t15 & 0x00000001u;
         /* 0220BB8C */ if (_t16) goto L_0220BB90; else goto L_0220BBA0;
   L_0220BB90: ; // 0x220bb90
         /* 0220BB90 */ cpu->r[3] = 0x00000010u;
         /* 0220BB94 */ Gambit_fn_02801A78(cpu);
-        /* 0220BB98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220BB9C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BB98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220BB9C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BB9C */ _t18 = _t17 & 0x00000001u;
         /* 0220BB9C */ if (_t18) goto L_0220BBD8; else goto L_0220BBA0;
   L_0220BBA0: ; // 0x220bba0
-        /* 0220BBA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220BBA4 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BBA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220BBA4 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BBA4 */ _t20 = _t19 & 0x00000001u;
         /* 0220BBA4 */ if (_t20) goto L_0220BBA8; else goto L_0220BBB8;
   L_0220BBA8: ; // 0x220bba8
         /* 0220BBA8 */ cpu->r[3] = 0x00000010u;
         /* 0220BBAC */ Gambit_fn_02801A78(cpu);
-        /* 0220BBB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220BBB4 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BBB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220BBB4 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BBB4 */ _t22 = _t21 & 0x00000001u;
         /* 0220BBB4 */ if (_t22) goto L_0220BBD8; else goto L_0220BBB8;
   L_0220BBB8: ; // 0x220bbb8
@@ -17243,10 +17243,10 @@ void Gambit_fn_0220BB18(CPUState* cpu) {
         /* 0220BBD4 */ rbrew_write32(cpu->mem, _t29, cpu->r[11]);
   L_0220BBD8: ; // 0x220bbd8
         /* 0220BBD8 */ cpu->r[12] = cpu->r[31] + 0x00000258u;
-        /* 0220BBD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0220BBD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0220BBDC */ _t30 = cpu->r[31] + 0x00000254u;
         /* 0220BBDC */ rbrew_write_f32(cpu->mem, _t30, cpu->f[31]);
-        /* 0220BBE0 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BBE0 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BBE0 */ _t32 = _t31 & 0x00000001u;
         /* 0220BBE0 */ if (_t32) goto L_0220BBE4; else goto L_0220BBEC;
   L_0220BBE4: ; // 0x220bbe4
@@ -17260,7 +17260,7 @@ void Gambit_fn_0220BB18(CPUState* cpu) {
         /* 0220BBF4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t34);
         /* 0220BBF8 */ _t35 = cpu->r[1] + 0x00000010u;
         /* 0220BBF8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t35);
-        /* 0220BBFC */ _t36 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220BBFC */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220BBFC */ _t37 = _t36 & 0x00000001u;
         /* 0220BBFC */ if (_t37) goto L_0220BC00; // else: addr-0 trap, fall-through
   L_0220BC00: ; // 0x220bc00
@@ -17287,18 +17287,18 @@ void Gambit_fn_0220BB1C(CPUState* cpu) {
         /* 0220BB2C */ _t3 = cpu->r[1] + 0x00000018u;
         /* 0220BB2C */ rbrew_write_f32(cpu->mem, _t3, cpu->f[31]);
         /* 0220BB30 */ cpu->r[31] = cpu->r[3];
-        /* 0220BB30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0220BB30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0220BB34 */ _t4 = cpu->r[1] + 0x00000024u;
         /* 0220BB34 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
-        /* 0220BB38 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BB38 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BB38 */ _t6 = _t5 & 0x00000001u;
         /* 0220BB38 */ if (_t6) goto L_0220BB3C; else goto L_0220BB4C;
   L_0220BB3C: ; // 0x220bb3c
         /* 0220BB3C */ cpu->r[3] = 0x00000264u;
         /* 0220BB40 */ Gambit_fn_02801A78(cpu);
         /* 0220BB44 */ cpu->r[31] = cpu->r[3];
-        /* 0220BB44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0220BB48 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BB44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0220BB48 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BB48 */ _t8 = _t7 & 0x00000001u;
         /* 0220BB48 */ if (_t8) goto L_0220BBEC; else goto L_0220BB4C;
   L_0220BB4C: ; // 0x220bb4c
@@ -17313,10 +17313,10 @@ void Gambit_fn_0220BB1C(CPUState* cpu) {
         /* 0220BB64 */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
         /* 0220BB68 */ cpu->r[0] = 0x00000000u;
         /* 0220BB6C */ cpu->r[11] = cpu->r[31] + 0x00000238u;
-        /* 0220BB6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220BB6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220BB70 */ _t11 = cpu->r[31] + 0x00000224u;
         /* 0220BB70 */ rbrew_write16(cpu->mem, _t11, (uint16_t)cpu->r[0]);
-        /* 0220BB74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BB74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BB74 */ _t13 = _t12 & 0x00000001u;
         /* 0220BB74 */ if (_t13) goto L_0220BB78; else goto L_0220BB80;
   L_0220BB78: ; // 0x220bb78
@@ -17325,29 +17325,29 @@ void Gambit_fn_0220BB1C(CPUState* cpu) {
   L_0220BB80: ; // 0x220bb80
         /* 0220BB80 */ cpu->r[12] = 0x10040000u;
         /* 0220BB84 */ cpu->r[3] = cpu->r[31] + 0x00000244u;
-        /* 0220BB84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0220BB84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0220BB88 */ _t14 = cpu->r[12] + 0x00002E7Cu;
         /* 0220BB88 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t14);
-        /* 0220BB8C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BB8C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BB8C */ _t16 = _t15 & 0x00000001u;
         /* 0220BB8C */ if (_t16) goto L_0220BB90; else goto L_0220BBA0;
   L_0220BB90: ; // 0x220bb90
         /* 0220BB90 */ cpu->r[3] = 0x00000010u;
         /* 0220BB94 */ Gambit_fn_02801A78(cpu);
-        /* 0220BB98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220BB9C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BB98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220BB9C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BB9C */ _t18 = _t17 & 0x00000001u;
         /* 0220BB9C */ if (_t18) goto L_0220BBD8; else goto L_0220BBA0;
   L_0220BBA0: ; // 0x220bba0
-        /* 0220BBA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220BBA4 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BBA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220BBA4 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BBA4 */ _t20 = _t19 & 0x00000001u;
         /* 0220BBA4 */ if (_t20) goto L_0220BBA8; else goto L_0220BBB8;
   L_0220BBA8: ; // 0x220bba8
         /* 0220BBA8 */ cpu->r[3] = 0x00000010u;
         /* 0220BBAC */ Gambit_fn_02801A78(cpu);
-        /* 0220BBB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220BBB4 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BBB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220BBB4 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BBB4 */ _t22 = _t21 & 0x00000001u;
         /* 0220BBB4 */ if (_t22) goto L_0220BBD8; else goto L_0220BBB8;
   L_0220BBB8: ; // 0x220bbb8
@@ -17369,10 +17369,10 @@ void Gambit_fn_0220BB1C(CPUState* cpu) {
         /* 0220BBD4 */ rbrew_write32(cpu->mem, _t29, cpu->r[11]);
   L_0220BBD8: ; // 0x220bbd8
         /* 0220BBD8 */ cpu->r[12] = cpu->r[31] + 0x00000258u;
-        /* 0220BBD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0220BBD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0220BBDC */ _t30 = cpu->r[31] + 0x00000254u;
         /* 0220BBDC */ rbrew_write_f32(cpu->mem, _t30, cpu->f[31]);
-        /* 0220BBE0 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BBE0 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BBE0 */ _t32 = _t31 & 0x00000001u;
         /* 0220BBE0 */ if (_t32) goto L_0220BBE4; else goto L_0220BBEC;
   L_0220BBE4: ; // 0x220bbe4
@@ -17386,7 +17386,7 @@ void Gambit_fn_0220BB1C(CPUState* cpu) {
         /* 0220BBF4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t34);
         /* 0220BBF8 */ _t35 = cpu->r[1] + 0x00000010u;
         /* 0220BBF8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t35);
-        /* 0220BBFC */ _t36 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220BBFC */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220BBFC */ _t37 = _t36 & 0x00000001u;
         /* 0220BBFC */ if (_t37) goto L_0220BC00; // else: addr-0 trap, fall-through
   L_0220BC00: ; // 0x220bc00
@@ -17417,9 +17417,9 @@ void Gambit_fn_0220BC10(CPUState* cpu) {
         /* 02056A50 */ cpu->r[11] = _t2;
         /* 02056A54 */ cpu->r[30] = 0x101E0000u;
         /* 02056A58 */ cpu->r[27] = cpu->r[3];
-        /* 02056A5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02056A5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02056A60 */ cpu->r[30] = cpu->r[30] + 0xFFFFA474u;
-        /* 02056A64 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056A64 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056A64 */ _t4 = _t3 & 0x00000001u;
         /* 02056A64 */ if (_t4) goto L_02056A7C; else goto L_02056A68;
   L_02056A68: ; // 0x2056a68
@@ -17462,23 +17462,23 @@ void Gambit_fn_0220BC10(CPUState* cpu) {
         /* 02056AD0 */ _t14 = cpu->r[7] + 0x00000000u;
         /* 02056AD0 */ cpu->r[8] = rbrew_read8(cpu->mem, _t14);
         /* 02056AD4 */ cpu->r[0] = 0x00080000u;
-        /* 02056AD8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[31]);
+        /* 02056AD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[31]));
         /* 02056ADC */ cpu->r[29] = 0x00000000u;
-        /* 02056AE0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056AE0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056AE0 */ _t16 = _t15 & 0x00000001u;
         /* 02056AE0 */ if (_t16) goto L_02056B08; else goto L_02056AE4;
   L_02056AE4: ; // 0x2056ae4
         /* 02056AE4 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 02056AE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[0]);
+        /* 02056AE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[0]));
         /* 02056AEC */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02056AF0 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02056AF0 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02056AF0 */ _t18 = _t17 & 0x00000001u;
         /* 02056AF0 */ if (_t18) goto L_02056B04; else goto L_02056AF4;
   L_02056AF4: ; // 0x2056af4
         /* 02056AF4 */ _t19 = cpu->r[7] + 0x00000000u;
         /* 02056AF4 */ cpu->r[9] = rbrew_read8(cpu->mem, _t19);
-        /* 02056AF8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[31]);
-        /* 02056AFC */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056AF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[31]));
+        /* 02056AFC */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056AFC */ _t21 = _t20 & 0x00000001u;
         /* 02056AFC */ if (_t21) goto L_02056B00; else goto L_02056AE4;
   L_02056B00: ; // 0x2056b00
@@ -17488,8 +17488,8 @@ void Gambit_fn_0220BC10(CPUState* cpu) {
   L_02056B08: ; // 0x2056b08
         /* 02056B08 */ _t22 = cpu->r[30] + 0x00000008u;
         /* 02056B08 */ cpu->r[9] = rbrew_read32(cpu->mem, _t22);
-        /* 02056B0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[9]);
-        /* 02056B10 */ _t23 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02056B0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[9]));
+        /* 02056B10 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02056B10 */ _t24 = _t23 & 0x00000001u;
         /* 02056B10 */ if (_t24) goto L_02056B18; else goto L_02056B14;
   L_02056B14: ; // 0x2056b14
@@ -17669,12 +17669,12 @@ void Gambit_fn_0220BC7C(CPUState* cpu) {
         /* 0220BCA8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
         /* 0220BCAC */ _t7 = cpu->r[31] + 0x00000000u;
         /* 0220BCAC */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 0220BCB0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
+        /* 0220BCB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
         /* 0220BCB4 */ _t8 = cpu->r[30] + 0x00000224u;
         /* 0220BCB4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
         /* 0220BCB8 */ _t9 = cpu->r[30] + 0x00000004u;
         /* 0220BCB8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t9);
-        /* 0220BCBC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BCBC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BCBC */ _t11 = _t10 & 0x00000001u;
         /* 0220BCBC */ if (_t11) goto L_0220BCC0; else goto L_0220BD24;
   L_0220BCC0: ; // 0x220bcc0
@@ -17798,12 +17798,12 @@ void Gambit_fn_0220BC80(CPUState* cpu) {
         /* 0220BCA8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
         /* 0220BCAC */ _t7 = cpu->r[31] + 0x00000000u;
         /* 0220BCAC */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 0220BCB0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
+        /* 0220BCB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
         /* 0220BCB4 */ _t8 = cpu->r[30] + 0x00000224u;
         /* 0220BCB4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
         /* 0220BCB8 */ _t9 = cpu->r[30] + 0x00000004u;
         /* 0220BCB8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t9);
-        /* 0220BCBC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BCBC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BCBC */ _t11 = _t10 & 0x00000001u;
         /* 0220BCBC */ if (_t11) goto L_0220BCC0; else goto L_0220BD24;
   L_0220BCC0: ; // 0x220bcc0
@@ -17954,9 +17954,9 @@ void Gambit_fn_0220BD9C(CPUState* cpu) {
         /* 0220BE08 */ cpu->r[12] = rbrew_read32(cpu->mem, _t16);
         /* 0220BE0C */ cpu->r[31] = cpu->r[3];
         /* 0220BE10 */ cpu->r[11] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0220BE10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220BE10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220BE14 */ cpu->r[28] = cpu->r[29] + 0x00000048u;
-        /* 0220BE18 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BE18 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BE18 */ _t18 = _t17 & 0x00000001u;
         /* 0220BE18 */ if (_t18) goto L_0220BE64; else goto L_0220BE1C;
   L_0220BE1C: ; // 0x220be1c
@@ -17965,10 +17965,10 @@ void Gambit_fn_0220BD9C(CPUState* cpu) {
         /* 0220BE24 */ cpu->r[12] = 0x10040000u;
         /* 0220BE28 */ _t19 = cpu->r[12] + 0x00002E7Cu;
         /* 0220BE28 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t19);
-        /* 0220BE2C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
+        /* 0220BE2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
         /* 0220BE30 */ _t20 = cpu->r[29] + 0x00000000u;
         /* 0220BE30 */ cpu->r[0] = rbrew_read32(cpu->mem, _t20);
-        /* 0220BE34 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220BE34 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220BE34 */ _t22 = _t21 & 0x00000001u;
         /* 0220BE34 */ if (_t22) goto L_0220BE38; else goto L_0220BE5C;
   L_0220BE38: ; // 0x220be38
@@ -18113,9 +18113,9 @@ void Gambit_fn_0220BDA0(CPUState* cpu) {
         /* 0220BE08 */ cpu->r[12] = rbrew_read32(cpu->mem, _t16);
         /* 0220BE0C */ cpu->r[31] = cpu->r[3];
         /* 0220BE10 */ cpu->r[11] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0220BE10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220BE10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220BE14 */ cpu->r[28] = cpu->r[29] + 0x00000048u;
-        /* 0220BE18 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220BE18 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220BE18 */ _t18 = _t17 & 0x00000001u;
         /* 0220BE18 */ if (_t18) goto L_0220BE64; else goto L_0220BE1C;
   L_0220BE1C: ; // 0x220be1c
@@ -18124,10 +18124,10 @@ void Gambit_fn_0220BDA0(CPUState* cpu) {
         /* 0220BE24 */ cpu->r[12] = 0x10040000u;
         /* 0220BE28 */ _t19 = cpu->r[12] + 0x00002E7Cu;
         /* 0220BE28 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t19);
-        /* 0220BE2C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
+        /* 0220BE2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
         /* 0220BE30 */ _t20 = cpu->r[29] + 0x00000000u;
         /* 0220BE30 */ cpu->r[0] = rbrew_read32(cpu->mem, _t20);
-        /* 0220BE34 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220BE34 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220BE34 */ _t22 = _t21 & 0x00000001u;
         /* 0220BE34 */ if (_t22) goto L_0220BE38; else goto L_0220BE5C;
   L_0220BE38: ; // 0x220be38
@@ -18342,8 +18342,8 @@ void Gambit_fn_0220BF18(CPUState* cpu) {
   L_0220C060: ; // 0x220c060
         /* 0220C060 */ /* nop */
         /* 0220C064 */ cpu->r[0] = cpu->r[18] & cpu->r[8];
-        /* 0220C064 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0220C068 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C064 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0220C068 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C068 */ _t31 = _t30 & 0x00000001u;
         /* 0220C068 */ if (_t31) goto L_0220C11C; else goto L_0220C06C;
   L_0220C06C: ; // 0x220c06c
@@ -18393,9 +18393,9 @@ void Gambit_fn_0220BF18(CPUState* cpu) {
         /* 0220C0D8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t47);
         /* 0220C0DC */ _t48 = cpu->r[12] + 0x00000078u;
         /* 0220C0DC */ cpu->r[0] = rbrew_read32(cpu->mem, _t48);
-        /* 0220C0E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
+        /* 0220C0E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
         /* 0220C0E4 */ cpu->r[3] = 0x00000000u;
-        /* 0220C0E8 */ _t49 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220C0E8 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220C0E8 */ _t50 = _t49 & 0x00000001u;
         /* 0220C0E8 */ if (_t50) goto L_0220C0EC; else goto L_0220C0F4;
   L_0220C0EC: ; // 0x220c0ec
@@ -18411,8 +18411,8 @@ void Gambit_fn_0220BF18(CPUState* cpu) {
         /* 0220C100 */ cpu->r[6] = rbrew_read32(cpu->mem, _t53);
         /* 0220C104 */ _t54 = cpu->r[6] + 0x00000044u;
         /* 0220C104 */ cpu->r[7] = rbrew_read8(cpu->mem, _t54);
-        /* 0220C108 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0220C10C */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C108 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0220C10C */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C10C */ _t56 = _t55 & 0x00000001u;
         /* 0220C10C */ if (_t56) goto L_0220C11C; else goto L_0220C110;
   L_0220C110: ; // 0x220c110
@@ -18422,9 +18422,9 @@ void Gambit_fn_0220BF18(CPUState* cpu) {
         /* 0220C118 */ Gambit_fn_023EEED0(cpu);
   L_0220C11C: ; // 0x220c11c
         /* 0220C11C */ cpu->r[20] = cpu->r[20] + 0xFFFFFFFFu;
-        /* 0220C11C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
+        /* 0220C11C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
         /* 0220C120 */ cpu->r[17] = cpu->r[17] + 0x00000001u;
-        /* 0220C124 */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C124 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C124 */ _t59 = _t58 & 0x00000001u;
         /* 0220C124 */ if (_t59) goto L_0220C128; else goto L_0220C060;
   L_0220C128: ; // 0x220c128
@@ -18433,7 +18433,7 @@ void Gambit_fn_0220BF18(CPUState* cpu) {
         /* 0220C12C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t60);
         /* 0220C130 */ _t61 = cpu->r[1] + 0x000000D8u;
         /* 0220C130 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t61);
-        /* 0220C134 */ _t62 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220C134 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220C134 */ _t63 = _t62 & 0x00000001u;
         /* 0220C134 */ if (_t63) goto L_0220C138; // else: addr-0 trap, fall-through
   L_0220C138: ; // 0x220c138
@@ -18533,29 +18533,29 @@ void Gambit_fn_0220C148(CPUState* cpu) {
         /* 0220C218 */ _t28 = cpu->r[10] + 0x00002E7Cu;
         /* 0220C218 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t28);
         /* 0220C21C */ cpu->r[10] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 0220C21C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0220C21C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0220C220 */ cpu->f[29] = cpu->f[1] * cpu->f[0];
         /* 0220C224 */ _t29 = cpu->r[8] + 0x00002E78u;
         /* 0220C224 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t29);
-        /* 0220C228 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C228 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C228 */ _t31 = _t30 & 0x00000001u;
         /* 0220C228 */ if (_t31) goto L_0220C2C8; else goto L_0220C22C;
   L_0220C22C: ; // 0x220c22c
         /* 0220C22C */ _t32 = cpu->r[29] + 0x00000000u;
         /* 0220C22C */ cpu->r[4] = rbrew_read32(cpu->mem, _t32);
         /* 0220C230 */ cpu->r[12] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0220C230 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0220C230 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0220C234 */ cpu->r[31] = cpu->r[29] + 0x000000A8u;
-        /* 0220C238 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C238 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C238 */ _t34 = _t33 & 0x00000001u;
         /* 0220C238 */ if (_t34) goto L_0220C274; else goto L_0220C23C;
   L_0220C23C: ; // 0x220c23c
         /* 0220C23C */ cpu->r[3] = cpu->r[29] + 0x00000138u;
         /* 0220C240 */ Gambit_fn_02C69350(cpu);
-        /* 0220C244 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 0220C244 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 0220C248 */ _t35 = cpu->r[29] + 0x00000000u;
         /* 0220C248 */ cpu->r[7] = rbrew_read32(cpu->mem, _t35);
-        /* 0220C24C */ _t36 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220C24C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220C24C */ _t37 = _t36 & 0x00000001u;
         /* 0220C24C */ if (_t37) goto L_0220C250; else goto L_0220C26C;
   L_0220C250: ; // 0x220c250
@@ -18607,26 +18607,26 @@ void Gambit_fn_0220C148(CPUState* cpu) {
         /* 0220C2C4 */ goto L_0220C368;
   L_0220C2C8: ; // 0x220c2c8
         /* 0220C2C8 */ cpu->r[5] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 0220C2C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 0220C2CC */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C2C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 0220C2CC */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C2CC */ _t53 = _t52 & 0x00000001u;
         /* 0220C2CC */ if (_t53) goto L_0220C368; else goto L_0220C2D0;
   L_0220C2D0: ; // 0x220c2d0
         /* 0220C2D0 */ _t54 = cpu->r[29] + 0x00000000u;
         /* 0220C2D0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t54);
         /* 0220C2D4 */ cpu->r[6] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0220C2D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 0220C2D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 0220C2D8 */ cpu->r[31] = cpu->r[29] + 0x00000048u;
-        /* 0220C2DC */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C2DC */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C2DC */ _t56 = _t55 & 0x00000001u;
         /* 0220C2DC */ if (_t56) goto L_0220C318; else goto L_0220C2E0;
   L_0220C2E0: ; // 0x220c2e0
         /* 0220C2E0 */ cpu->r[3] = cpu->r[29] + 0x0000012Cu;
         /* 0220C2E4 */ Gambit_fn_02C69350(cpu);
-        /* 0220C2E8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 0220C2E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 0220C2EC */ _t57 = cpu->r[29] + 0x00000000u;
         /* 0220C2EC */ cpu->r[0] = rbrew_read32(cpu->mem, _t57);
-        /* 0220C2F0 */ _t58 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220C2F0 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220C2F0 */ _t59 = _t58 & 0x00000001u;
         /* 0220C2F0 */ if (_t59) goto L_0220C2F4; else goto L_0220C310;
   L_0220C2F4: ; // 0x220c2f4
@@ -18678,8 +18678,8 @@ void Gambit_fn_0220C148(CPUState* cpu) {
   L_0220C368: ; // 0x220c368
         /* 0220C368 */ _t74 = cpu->r[28] + 0x00000051u;
         /* 0220C368 */ cpu->r[0] = rbrew_read8(cpu->mem, _t74);
-        /* 0220C36C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0220C370 */ _t75 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C36C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0220C370 */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C370 */ _t76 = _t75 & 0x00000001u;
         /* 0220C370 */ if (_t76) goto L_0220C6C4; else goto L_0220C374;
   L_0220C374: ; // 0x220c374
@@ -18692,8 +18692,8 @@ void Gambit_fn_0220C148(CPUState* cpu) {
         /* 0220C384 */ Gambit_fn_026BF910(cpu);
         /* 0220C388 */ _t79 = cpu->r[3] + 0x00000920u;
         /* 0220C388 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t79);
-        /* 0220C38C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[30]);
-        /* 0220C390 */ _t80 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220C38C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[30]));
+        /* 0220C390 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220C390 */ _t81 = _t80 & 0x00000001u;
         /* 0220C390 */ if (_t81) goto L_0220C394; else goto L_0220C6C4;
   L_0220C394: ; // 0x220c394
@@ -18707,28 +18707,28 @@ void Gambit_fn_0220C148(CPUState* cpu) {
         /* 0220C3A4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t84);
         /* 0220C3A8 */ cpu->r[4] = cpu->r[12] + 0x101E0000u;
         /* 0220C3AC */ cpu->r[8] = rbrew_rlwinm(cpu->r[9], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 0220C3AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0220C3AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0220C3B0 */ _t85 = cpu->r[1] + 0x00000024u;
         /* 0220C3B0 */ rbrew_write32(cpu->mem, _t85, cpu->r[26]);
         /* 0220C3B4 */ _t86 = cpu->r[4] + 0xFFFF9484u;
         /* 0220C3B4 */ cpu->r[24] = rbrew_read32(cpu->mem, _t86);
-        /* 0220C3B8 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C3B8 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C3B8 */ _t88 = _t87 & 0x00000001u;
         /* 0220C3B8 */ if (_t88) goto L_0220C410; else goto L_0220C3BC;
   L_0220C3BC: ; // 0x220c3bc
         /* 0220C3BC */ cpu->r[0] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0220C3BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0220C3BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0220C3C0 */ cpu->r[31] = cpu->r[29] + 0x000000A8u;
-        /* 0220C3C4 */ _t89 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C3C4 */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C3C4 */ _t90 = _t89 & 0x00000001u;
         /* 0220C3C4 */ if (_t90) goto L_0220C400; else goto L_0220C3C8;
   L_0220C3C8: ; // 0x220c3c8
         /* 0220C3C8 */ cpu->r[3] = cpu->r[29] + 0x00000138u;
         /* 0220C3CC */ Gambit_fn_02C69350(cpu);
-        /* 0220C3D0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 0220C3D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 0220C3D4 */ _t91 = cpu->r[29] + 0x00000000u;
         /* 0220C3D4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t91);
-        /* 0220C3D8 */ _t92 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220C3D8 */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220C3D8 */ _t93 = _t92 & 0x00000001u;
         /* 0220C3D8 */ if (_t93) goto L_0220C3DC; else goto L_0220C3F8;
   L_0220C3DC: ; // 0x220c3dc
@@ -18747,27 +18747,27 @@ void Gambit_fn_0220C148(CPUState* cpu) {
         /* 0220C3FC */ rbrew_write32(cpu->mem, _t96, cpu->r[11]);
   L_0220C400: ; // 0x220c400
         /* 0220C400 */ cpu->r[22] = cpu->r[24];
-        /* 0220C400 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
+        /* 0220C400 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
         /* 0220C404 */ cpu->r[27] = 0x00000000u;
-        /* 0220C408 */ _t97 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220C408 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220C408 */ _t98 = _t97 & 0x00000001u;
         /* 0220C408 */ if (_t98) goto L_0220C40C; else goto L_0220C680;
   L_0220C40C: ; // 0x220c40c
         /* 0220C40C */ goto L_0220C460;
   L_0220C410: ; // 0x220c410
         /* 0220C410 */ cpu->r[0] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0220C410 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0220C410 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0220C414 */ cpu->r[31] = cpu->r[29] + 0x00000048u;
-        /* 0220C418 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C418 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C418 */ _t100 = _t99 & 0x00000001u;
         /* 0220C418 */ if (_t100) goto L_0220C454; else goto L_0220C41C;
   L_0220C41C: ; // 0x220c41c
         /* 0220C41C */ cpu->r[3] = cpu->r[29] + 0x0000012Cu;
         /* 0220C420 */ Gambit_fn_02C69350(cpu);
-        /* 0220C424 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 0220C424 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 0220C428 */ _t101 = cpu->r[29] + 0x00000000u;
         /* 0220C428 */ cpu->r[6] = rbrew_read32(cpu->mem, _t101);
-        /* 0220C42C */ _t102 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220C42C */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220C42C */ _t103 = _t102 & 0x00000001u;
         /* 0220C42C */ if (_t103) goto L_0220C430; else goto L_0220C44C;
   L_0220C430: ; // 0x220c430
@@ -18786,9 +18786,9 @@ void Gambit_fn_0220C148(CPUState* cpu) {
         /* 0220C450 */ rbrew_write32(cpu->mem, _t106, cpu->r[6]);
   L_0220C454: ; // 0x220c454
         /* 0220C454 */ cpu->r[22] = cpu->r[24];
-        /* 0220C454 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
+        /* 0220C454 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
         /* 0220C458 */ cpu->r[27] = 0x00000000u;
-        /* 0220C45C */ _t107 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220C45C */ _t107 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220C45C */ _t108 = _t107 & 0x00000001u;
         /* 0220C45C */ if (_t108) goto L_0220C460; else goto L_0220C680;
   L_0220C460: ; // 0x220c460
@@ -18806,10 +18806,10 @@ void Gambit_fn_0220C148(CPUState* cpu) {
         /* 0220C488 */ Gambit_fn_02040F70(cpu);
         /* 0220C48C */ _t109 = cpu->r[1] + 0x00000024u;
         /* 0220C48C */ cpu->r[10] = rbrew_read32(cpu->mem, _t109);
-        /* 0220C490 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0220C490 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0220C494 */ _t110 = cpu->r[1] + 0x00000070u;
         /* 0220C494 */ cpu->r[11] = rbrew_read32(cpu->mem, _t110);
-        /* 0220C498 */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C498 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C498 */ _t112 = _t111 & 0x00000001u;
         /* 0220C498 */ if (_t112) goto L_0220C49C; else goto L_0220C4A8;
   L_0220C49C: ; // 0x220c49c
@@ -18823,8 +18823,8 @@ void Gambit_fn_0220C148(CPUState* cpu) {
         /* 0220C4AC */ _t115 = cpu->r[9] + 0x00000000u;
         /* 0220C4AC */ cpu->r[4] = rbrew_read32(cpu->mem, _t115);
         /* 0220C4B0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0220C4B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0220C4B4 */ _t116 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C4B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0220C4B4 */ _t116 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C4B4 */ _t117 = _t116 & 0x00000001u;
         /* 0220C4B4 */ if (_t117) goto L_0220C540; else goto L_0220C4B8;
   L_0220C4B8: ; // 0x220c4b8
@@ -18877,8 +18877,8 @@ void Gambit_fn_0220C148(CPUState* cpu) {
         /* 0220C530 */ _t134 = cpu->r[11] + 0x00000000u;
         /* 0220C530 */ cpu->r[9] = rbrew_read32(cpu->mem, _t134);
         /* 0220C534 */ cpu->r[8] = rbrew_rlwinm(cpu->r[9], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0220C534 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 0220C538 */ _t135 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C534 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 0220C538 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C538 */ _t136 = _t135 & 0x00000001u;
         /* 0220C538 */ if (_t136) goto L_0220C53C; else goto L_0220C580;
   L_0220C53C: ; // 0x220c53c
@@ -18909,8 +18909,8 @@ void Gambit_fn_0220C148(CPUState* cpu) {
         /* 0220C574 */ _t146 = cpu->r[11] + 0x00000000u;
         /* 0220C574 */ cpu->r[9] = rbrew_read32(cpu->mem, _t146);
         /* 0220C578 */ cpu->r[8] = rbrew_rlwinm(cpu->r[9], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0220C578 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 0220C57C */ _t147 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C578 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 0220C57C */ _t147 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C57C */ _t148 = _t147 & 0x00000001u;
         /* 0220C57C */ if (_t148) goto L_0220C5D8; else goto L_0220C580;
   L_0220C580: ; // 0x220c580
@@ -18946,10 +18946,10 @@ void Gambit_fn_0220C148(CPUState* cpu) {
         /* 0220C5C0 */ _t162 = cpu->r[11] + 0x00000030u;
         /* 0220C5C0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t162);
         /* 0220C5C4 */ cpu->f[11] = cpu->f[6] + cpu->f[12];
-        /* 0220C5C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0220C5C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0220C5CC */ _t163 = cpu->r[1] + 0x00000020u;
         /* 0220C5CC */ rbrew_write_f32(cpu->mem, _t163, cpu->f[11]);
-        /* 0220C5D0 */ _t164 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C5D0 */ _t164 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C5D0 */ _t165 = _t164 & 0x00000001u;
         /* 0220C5D0 */ if (_t165) goto L_0220C5D4; else goto L_0220C5EC;
   L_0220C5D4: ; // 0x220c5d4
@@ -18958,10 +18958,10 @@ void Gambit_fn_0220C148(CPUState* cpu) {
         /* 0220C5D8 */ _t166 = cpu->r[11] + 0x00000030u;
         /* 0220C5D8 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t166);
         /* 0220C5DC */ cpu->f[13] = cpu->f[13] + cpu->f[6];
-        /* 0220C5E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0220C5E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0220C5E4 */ _t167 = cpu->r[1] + 0x00000020u;
         /* 0220C5E4 */ rbrew_write_f32(cpu->mem, _t167, cpu->f[13]);
-        /* 0220C5E8 */ _t168 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C5E8 */ _t168 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C5E8 */ _t169 = _t168 & 0x00000001u;
         /* 0220C5E8 */ if (_t169) goto L_0220C624; else goto L_0220C5EC;
   L_0220C5EC: ; // 0x220c5ec
@@ -18980,8 +18980,8 @@ void Gambit_fn_0220C148(CPUState* cpu) {
         /* 0220C610 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t172);
         /* 0220C614 */ /* nop */
         /* 0220C618 */ cpu->f[9] = fma(cpu->f[8], cpu->f[7], cpu->f[9]);
-        /* 0220C61C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[9]);
-        /* 0220C620 */ _t173 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220C61C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[9]));
+        /* 0220C620 */ _t173 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220C620 */ _t174 = _t173 & 0x00000001u;
         /* 0220C620 */ if (_t174) goto L_0220C624; else goto L_0220C674;
   L_0220C624: ; // 0x220c624
@@ -19026,16 +19026,16 @@ void Gambit_fn_0220C148(CPUState* cpu) {
         /* 0220C670 */ rbrew_write_f32(cpu->mem, _t193, cpu->f[10]);
   L_0220C674: ; // 0x220c674
         /* 0220C674 */ cpu->r[22] = cpu->r[22] + 0xFFFFFFFFu;
-        /* 0220C674 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
+        /* 0220C674 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
         /* 0220C678 */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 0220C67C */ _t194 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C67C */ _t194 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C67C */ _t195 = _t194 & 0x00000001u;
         /* 0220C67C */ if (_t195) goto L_0220C680; else goto L_0220C468;
   L_0220C680: ; // 0x220c680
-        /* 0220C680 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 0220C680 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 0220C684 */ _t196 = cpu->r[1] + 0x00000074u;
         /* 0220C684 */ rbrew_write32(cpu->mem, _t196, cpu->r[26]);
-        /* 0220C688 */ _t197 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220C688 */ _t197 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220C688 */ _t198 = _t197 & 0x00000001u;
         /* 0220C688 */ if (_t198) goto L_0220C68C; else goto L_0220C6C4;
   L_0220C68C: ; // 0x220c68c
@@ -19074,7 +19074,7 @@ void Gambit_fn_0220C148(CPUState* cpu) {
         /* 0220C6DC */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t209);
         /* 0220C6E0 */ _t210 = cpu->r[1] + 0x00000100u;
         /* 0220C6E0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t210);
-        /* 0220C6E4 */ _t211 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220C6E4 */ _t211 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220C6E4 */ _t212 = _t211 & 0x00000001u;
         /* 0220C6E4 */ if (_t212) goto L_0220C6E8; // else: addr-0 trap, fall-through
   L_0220C6E8: ; // 0x220c6e8
@@ -19112,13 +19112,13 @@ void Gambit_fn_0220C6F8(CPUState* cpu) {
         /* 0220C724 */ _t7 = cpu->r[1] + 0x00000008u;
         /* 0220C724 */ rbrew_write32(cpu->mem, _t7, cpu->r[0]);
         /* 0220C728 */ Gambit_fn_02214A50(cpu);
-        /* 0220C72C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220C730 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C72C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220C730 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C730 */ _t9 = _t8 & 0x00000001u;
         /* 0220C730 */ if (_t9) goto L_0220C774; else goto L_0220C734;
   L_0220C734: ; // 0x220c734
-        /* 0220C734 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0220C738 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C734 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0220C738 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C738 */ _t11 = _t10 & 0x00000001u;
         /* 0220C738 */ if (_t11) goto L_0220C774; else goto L_0220C73C;
   L_0220C73C: ; // 0x220c73c
@@ -19126,8 +19126,8 @@ void Gambit_fn_0220C6F8(CPUState* cpu) {
         /* 0220C73C */ cpu->r[9] = rbrew_read32(cpu->mem, _t12);
         /* 0220C740 */ cpu->r[10] = rbrew_rlwinm(cpu->r[9], 0x0000001Au, 0x00000000u, 0x00000005u);
         /* 0220C744 */ /* nop */
-        /* 0220C748 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 0220C74C */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220C748 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 0220C74C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220C74C */ _t14 = _t13 & 0x00000001u;
         /* 0220C74C */ if (_t14) goto L_0220C750; else goto L_0220C774;
   L_0220C750: ; // 0x220c750
@@ -19183,13 +19183,13 @@ void Gambit_fn_0220C6FC(CPUState* cpu) {
         /* 0220C724 */ _t7 = cpu->r[1] + 0x00000008u;
         /* 0220C724 */ rbrew_write32(cpu->mem, _t7, cpu->r[0]);
         /* 0220C728 */ Gambit_fn_02214A50(cpu);
-        /* 0220C72C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220C730 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C72C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220C730 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C730 */ _t9 = _t8 & 0x00000001u;
         /* 0220C730 */ if (_t9) goto L_0220C774; else goto L_0220C734;
   L_0220C734: ; // 0x220c734
-        /* 0220C734 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0220C738 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C734 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0220C738 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C738 */ _t11 = _t10 & 0x00000001u;
         /* 0220C738 */ if (_t11) goto L_0220C774; else goto L_0220C73C;
   L_0220C73C: ; // 0x220c73c
@@ -19197,8 +19197,8 @@ void Gambit_fn_0220C6FC(CPUState* cpu) {
         /* 0220C73C */ cpu->r[9] = rbrew_read32(cpu->mem, _t12);
         /* 0220C740 */ cpu->r[10] = rbrew_rlwinm(cpu->r[9], 0x0000001Au, 0x00000000u, 0x00000005u);
         /* 0220C744 */ /* nop */
-        /* 0220C748 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 0220C74C */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220C748 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 0220C74C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220C74C */ _t14 = _t13 & 0x00000001u;
         /* 0220C74C */ if (_t14) goto L_0220C750; else goto L_0220C774;
   L_0220C750: ; // 0x220c750
@@ -19268,9 +19268,9 @@ void Gambit_fn_0220C78C(CPUState* cpu) {
         /* 0220C7E4 */ _t9 = cpu->r[8] + 0x00000104u;
         /* 0220C7E4 */ cpu->r[4] = rbrew_read8(cpu->mem, _t9);
         /* 0220C7E8 */ cpu->r[7] = cpu->r[3];
-        /* 0220C7EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 0220C7EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 0220C7F0 */ cpu->r[28] = 0x00000000u;
-        /* 0220C7F4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C7F4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C7F4 */ _t11 = _t10 & 0x00000001u;
         /* 0220C7F4 */ if (_t11) goto L_0220C80C; else goto L_0220C7F8;
   L_0220C7F8: ; // 0x220c7f8
@@ -19283,8 +19283,8 @@ void Gambit_fn_0220C78C(CPUState* cpu) {
         /* 0220C80C */ _t12 = cpu->r[30] + 0x00000224u;
         /* 0220C80C */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
         /* 0220C810 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000014u);
-        /* 0220C810 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0220C814 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C810 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0220C814 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C814 */ _t14 = _t13 & 0x00000001u;
         /* 0220C814 */ if (_t14) goto L_0220C848; else goto L_0220C818;
   L_0220C818: ; // 0x220c818
@@ -19304,10 +19304,10 @@ void Gambit_fn_0220C78C(CPUState* cpu) {
         /* 0220C830 */ rbrew_write32(cpu->mem, _t21, cpu->r[7]);
         /* 0220C834 */ _t22 = cpu->r[1] + 0x00000030u;
         /* 0220C834 */ rbrew_write32(cpu->mem, _t22, cpu->r[9]);
-        /* 0220C838 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 0220C838 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 0220C83C */ _t23 = cpu->r[1] + 0x0000002Cu;
         /* 0220C83C */ rbrew_write32(cpu->mem, _t23, cpu->r[12]);
-        /* 0220C840 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C840 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C840 */ _t25 = _t24 & 0x00000001u;
         /* 0220C840 */ if (_t25) goto L_0220C934; else goto L_0220C844;
   L_0220C844: ; // 0x220c844
@@ -19336,10 +19336,10 @@ void Gambit_fn_0220C78C(CPUState* cpu) {
         /* 0220C874 */ rbrew_write32(cpu->mem, _t34, cpu->r[7]);
         /* 0220C878 */ _t35 = cpu->r[1] + 0x00000024u;
         /* 0220C878 */ rbrew_write32(cpu->mem, _t35, cpu->r[9]);
-        /* 0220C87C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 0220C87C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 0220C880 */ _t36 = cpu->r[1] + 0x00000028u;
         /* 0220C880 */ rbrew_write32(cpu->mem, _t36, cpu->r[7]);
-        /* 0220C884 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C884 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C884 */ _t38 = _t37 & 0x00000001u;
         /* 0220C884 */ if (_t38) goto L_0220C934; else goto L_0220C888;
   L_0220C888: ; // 0x220c888
@@ -19367,7 +19367,7 @@ void Gambit_fn_0220C78C(CPUState* cpu) {
         /* 0220C8B8 */ _t48 = cpu->r[30] + 0x00000224u;
         /* 0220C8B8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t48);
         /* 0220C8BC */ cpu->r[0] = rbrew_rlwinm(cpu->r[12], 0x0000001Au, 0x00000000u, 0x00000005u);
-        /* 0220C8C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220C8C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220C8C4 */ /* nop */
         /* 0220C8C8 */ cpu->r[3] = cpu->r[28];
         /* 0220C8CC */ _t49 = cpu->r[1] + 0x00000018u;
@@ -19379,7 +19379,7 @@ void Gambit_fn_0220C78C(CPUState* cpu) {
         /* 0220C8DC */ cpu->r[4] = 0x00000000u;
         /* 0220C8E0 */ _t51 = cpu->r[1] + 0x0000001Cu;
         /* 0220C8E0 */ rbrew_write32(cpu->mem, _t51, cpu->r[7]);
-        /* 0220C8E4 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C8E4 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C8E4 */ _t53 = _t52 & 0x00000001u;
         /* 0220C8E4 */ if (_t53) goto L_0220C900; else goto L_0220C8E8;
   L_0220C8E8: ; // 0x220c8e8
@@ -19388,8 +19388,8 @@ void Gambit_fn_0220C78C(CPUState* cpu) {
         /* 0220C8F0 */ _t54 = cpu->r[30] + 0x00000224u;
         /* 0220C8F0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t54);
         /* 0220C8F4 */ cpu->r[9] = rbrew_rlwinm(cpu->r[9], 0x00000000u, 0x00000010u, 0x00000011u);
-        /* 0220C8F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220C8F8 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C8F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220C8F8 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C8F8 */ _t56 = _t55 & 0x00000001u;
         /* 0220C8F8 */ if (_t56) goto L_0220C934; else goto L_0220C8FC;
   L_0220C8FC: ; // 0x220c8fc
@@ -19400,16 +19400,16 @@ void Gambit_fn_0220C78C(CPUState* cpu) {
         /* 0220C908 */ _t57 = cpu->r[30] + 0x00000224u;
         /* 0220C908 */ cpu->r[9] = rbrew_read32(cpu->mem, _t57);
         /* 0220C90C */ cpu->r[9] = rbrew_rlwinm(cpu->r[9], 0x00000000u, 0x00000010u, 0x00000011u);
-        /* 0220C90C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220C910 */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C90C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220C910 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C910 */ _t59 = _t58 & 0x00000001u;
         /* 0220C910 */ if (_t59) goto L_0220C934; else goto L_0220C914;
   L_0220C914: ; // 0x220c914
         /* 0220C914 */ _t60 = cpu->r[30] + 0x00000224u;
         /* 0220C914 */ cpu->r[10] = rbrew_read32(cpu->mem, _t60);
         /* 0220C918 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000015u, 0x00000015u);
-        /* 0220C918 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0220C91C */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0220C91C */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C91C */ _t62 = _t61 & 0x00000001u;
         /* 0220C91C */ if (_t62) goto L_0220C920; else goto L_0220C934;
   L_0220C920: ; // 0x220c920
@@ -19439,8 +19439,8 @@ void Gambit_fn_0220C950(CPUState* cpu) {
   L_0220C950: ; // 0x220c950
         /* 0220C950 */ _t0 = cpu->r[3] + 0x00000224u;
         /* 0220C950 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t0);
-        /* 0220C954 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0220C958 */ _t1 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220C954 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0220C958 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220C958 */ _t2 = _t1 & 0x00000001u;
         /* 0220C958 */ _t3 = _t2 ^ 0x00000001u;
         /* 0220C958 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -19449,8 +19449,8 @@ void Gambit_fn_0220C950(CPUState* cpu) {
         /* 0220C95C */ _t4 = cpu->r[3] + 0x00000224u;
         /* 0220C95C */ cpu->r[12] = rbrew_read32(cpu->mem, _t4);
         /* 0220C960 */ cpu->r[12] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000012u, 0x00000014u);
-        /* 0220C960 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0220C964 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C960 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0220C964 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C964 */ _t6 = _t5 & 0x00000001u;
         /* 0220C964 */ if (_t6) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0220C964 */ goto L_0220C968;
@@ -19482,8 +19482,8 @@ void Gambit_fn_0220C97C(CPUState* cpu) {
         /* 0220C990 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 0220C994 */ _t4 = cpu->r[30] + 0x00000224u;
         /* 0220C994 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t4);
-        /* 0220C998 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0220C99C */ _t5 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220C998 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0220C99C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220C99C */ _t6 = _t5 & 0x00000001u;
         /* 0220C99C */ if (_t6) goto L_0220C9A0; else goto L_0220CA18;
   L_0220C9A0: ; // 0x220c9a0
@@ -19494,8 +19494,8 @@ void Gambit_fn_0220C97C(CPUState* cpu) {
         /* 0220C9AC */ _t8 = cpu->r[30] + 0x00000224u;
         /* 0220C9AC */ cpu->r[7] = rbrew_read32(cpu->mem, _t8);
         /* 0220C9B0 */ cpu->r[7] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x00000012u, 0x00000014u);
-        /* 0220C9B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0220C9B4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C9B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0220C9B4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C9B4 */ _t10 = _t9 & 0x00000001u;
         /* 0220C9B4 */ if (_t10) goto L_0220C9E8; else goto L_0220C9B8;
   L_0220C9B8: ; // 0x220c9b8
@@ -19517,8 +19517,8 @@ void Gambit_fn_0220C97C(CPUState* cpu) {
         /* 0220C9E0 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 0220C9E4 */ return;
   L_0220C9E8: ; // 0x220c9e8
-        /* 0220C9E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0220C9EC */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C9E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0220C9EC */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C9EC */ _t17 = _t16 & 0x00000001u;
         /* 0220C9EC */ if (_t17) goto L_0220C9F0; else goto L_0220CA18;
   L_0220C9F0: ; // 0x220c9f0
@@ -19564,8 +19564,8 @@ void Gambit_fn_0220C980(CPUState* cpu) {
         /* 0220C990 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 0220C994 */ _t4 = cpu->r[30] + 0x00000224u;
         /* 0220C994 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t4);
-        /* 0220C998 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0220C99C */ _t5 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220C998 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0220C99C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220C99C */ _t6 = _t5 & 0x00000001u;
         /* 0220C99C */ if (_t6) goto L_0220C9A0; else goto L_0220CA18;
   L_0220C9A0: ; // 0x220c9a0
@@ -19576,8 +19576,8 @@ void Gambit_fn_0220C980(CPUState* cpu) {
         /* 0220C9AC */ _t8 = cpu->r[30] + 0x00000224u;
         /* 0220C9AC */ cpu->r[7] = rbrew_read32(cpu->mem, _t8);
         /* 0220C9B0 */ cpu->r[7] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x00000012u, 0x00000014u);
-        /* 0220C9B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0220C9B4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C9B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0220C9B4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C9B4 */ _t10 = _t9 & 0x00000001u;
         /* 0220C9B4 */ if (_t10) goto L_0220C9E8; else goto L_0220C9B8;
   L_0220C9B8: ; // 0x220c9b8
@@ -19599,8 +19599,8 @@ void Gambit_fn_0220C980(CPUState* cpu) {
         /* 0220C9E0 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 0220C9E4 */ return;
   L_0220C9E8: ; // 0x220c9e8
-        /* 0220C9E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0220C9EC */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220C9E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0220C9EC */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220C9EC */ _t17 = _t16 & 0x00000001u;
         /* 0220C9EC */ if (_t17) goto L_0220C9F0; else goto L_0220CA18;
   L_0220C9F0: ; // 0x220c9f0
@@ -19688,9 +19688,9 @@ void Gambit_fn_0220CA30(CPUState* cpu) {
         /* 0220CAA4 */ _t20 = cpu->r[31] + 0x00000224u;
         /* 0220CAA4 */ cpu->r[6] = rbrew_read32(cpu->mem, _t20);
         /* 0220CAA8 */ cpu->r[6] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x00000016u, 0x00000017u);
-        /* 0220CAA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 0220CAA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 0220CAAC */ cpu->r[30] = cpu->r[4];
-        /* 0220CAB0 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220CAB0 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220CAB0 */ _t22 = _t21 & 0x00000001u;
         /* 0220CAB0 */ if (_t22) goto L_0220CE84; else goto L_0220CAB4;
   L_0220CAB4: ; // 0x220cab4
@@ -19709,9 +19709,9 @@ void Gambit_fn_0220CA30(CPUState* cpu) {
         /* 0220CAD8 */ cpu->f[7] = cpu->f[12] - cpu->f[13];
         /* 0220CADC */ _t26 = cpu->r[12] + 0x00002E7Cu;
         /* 0220CADC */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t26);
-        /* 0220CAE0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[30]);
+        /* 0220CAE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[30]));
         /* 0220CAE4 */ cpu->r[28] = cpu->r[31] + 0x00000244u;
-        /* 0220CAE8 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220CAE8 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220CAE8 */ _t28 = _t27 & 0x00000001u;
         /* 0220CAE8 */ if (_t28) goto L_0220CE84; else goto L_0220CAEC;
   L_0220CAEC: ; // 0x220caec
@@ -19719,11 +19719,11 @@ void Gambit_fn_0220CA30(CPUState* cpu) {
         /* 0220CAF0 */ cpu->r[10] = 0x10040000u;
         /* 0220CAF4 */ _t29 = cpu->r[11] + 0x00002E70u;
         /* 0220CAF4 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t29);
-        /* 0220CAF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0220CAF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0220CAFC */ _t30 = cpu->r[10] + 0x00002F28u;
         /* 0220CAFC */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t30);
         /* 0220CB00 */ cpu->r[29] = cpu->r[28];
-        /* 0220CB04 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220CB04 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220CB04 */ _t32 = _t31 & 0x00000001u;
         /* 0220CB04 */ if (_t32) goto L_0220CCF8; else goto L_0220CB08;
   L_0220CB08: ; // 0x220cb08
@@ -19740,10 +19740,10 @@ void Gambit_fn_0220CA30(CPUState* cpu) {
         /* 0220CB24 */ cpu->f[27] = cpu->f[8] - cpu->f[9];
         /* 0220CB28 */ cpu->f[11] = fma(cpu->f[0], cpu->f[0], cpu->f[10]);
         /* 0220CB2C */ cpu->f[25] = fma(cpu->f[27], cpu->f[27], cpu->f[11]);
-        /* 0220CB30 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[25], cpu->f[30]);
+        /* 0220CB30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[25], cpu->f[30]));
         /* 0220CB34 */ _t36 = cpu->r[1] + 0x0000001Cu;
         /* 0220CB34 */ rbrew_write_f32(cpu->mem, _t36, cpu->f[27]);
-        /* 0220CB38 */ _t37 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220CB38 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220CB38 */ _t38 = _t37 & 0x00000001u;
         /* 0220CB38 */ if (_t38) goto L_0220CB3C; else goto L_0220CB70;
   L_0220CB3C: ; // 0x220cb3c
@@ -19881,8 +19881,8 @@ void Gambit_fn_0220CA30(CPUState* cpu) {
         /* 0220CC80 */ _t88 = cpu->r[1] + 0x000000E8u;
         /* 0220CC80 */ rbrew_write32(cpu->mem, _t88, cpu->r[0]);
         /* 0220CC84 */ Gambit_fn_027DDF94(cpu);
-        /* 0220CC88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220CC8C */ _t89 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220CC88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220CC8C */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220CC8C */ _t90 = _t89 & 0x00000001u;
         /* 0220CC8C */ if (_t90) goto L_0220CCF8; else goto L_0220CC90;
   L_0220CC90: ; // 0x220cc90
@@ -19941,9 +19941,9 @@ void Gambit_fn_0220CA30(CPUState* cpu) {
         /* 0220CD10 */ _t110 = cpu->r[31] + 0x0000013Cu;
         /* 0220CD10 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t110);
         /* 0220CD14 */ cpu->f[11] = fma(cpu->f[7], cpu->f[7], cpu->f[0]);
-        /* 0220CD18 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[30]);
+        /* 0220CD18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[30]));
         /* 0220CD1C */ cpu->f[31] = cpu->f[1];
-        /* 0220CD20 */ _t111 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220CD20 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220CD20 */ _t112 = _t111 & 0x00000001u;
         /* 0220CD20 */ if (_t112) goto L_0220CD24; else goto L_0220CD50;
   L_0220CD24: ; // 0x220cd24
@@ -19992,10 +19992,10 @@ void Gambit_fn_0220CA30(CPUState* cpu) {
         /* 0220CD90 */ cpu->f[0] = fma(cpu->f[9], cpu->f[9], cpu->f[7]);
         /* 0220CD94 */ _t127 = cpu->r[1] + 0x00000008u;
         /* 0220CD94 */ rbrew_write_f32(cpu->mem, _t127, cpu->f[10]);
-        /* 0220CD98 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[30]);
+        /* 0220CD98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[30]));
         /* 0220CD9C */ _t128 = cpu->r[1] + 0x00000010u;
         /* 0220CD9C */ rbrew_write_f32(cpu->mem, _t128, cpu->f[9]);
-        /* 0220CDA0 */ _t129 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220CDA0 */ _t129 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220CDA0 */ _t130 = _t129 & 0x00000001u;
         /* 0220CDA0 */ if (_t130) goto L_0220CDA4; else goto L_0220CDD0;
   L_0220CDA4: ; // 0x220cda4
@@ -20044,10 +20044,10 @@ void Gambit_fn_0220CA30(CPUState* cpu) {
         /* 0220CE10 */ rbrew_write_f32(cpu->mem, _t144, cpu->f[7]);
         /* 0220CE14 */ _t145 = cpu->r[31] + 0x00000138u;
         /* 0220CE14 */ rbrew_write_f32(cpu->mem, _t145, cpu->f[9]);
-        /* 0220CE18 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[30]);
+        /* 0220CE18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[30]));
         /* 0220CE1C */ _t146 = cpu->r[31] + 0x00000134u;
         /* 0220CE1C */ rbrew_write_f32(cpu->mem, _t146, cpu->f[0]);
-        /* 0220CE20 */ _t147 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220CE20 */ _t147 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220CE20 */ _t148 = _t147 & 0x00000001u;
         /* 0220CE20 */ if (_t148) goto L_0220CE24; else goto L_0220CE54;
   L_0220CE24: ; // 0x220ce24
@@ -20120,7 +20120,7 @@ void Gambit_fn_0220CA30(CPUState* cpu) {
         /* 0220CEC4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t172);
         /* 0220CEC8 */ _t173 = cpu->r[1] + 0x00000140u;
         /* 0220CEC8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t173);
-        /* 0220CECC */ _t174 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220CECC */ _t174 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220CECC */ _t175 = _t174 & 0x00000001u;
         /* 0220CECC */ if (_t175) goto L_0220CED0; // else: addr-0 trap, fall-through
   L_0220CED0: ; // 0x220ced0
@@ -20152,13 +20152,13 @@ void Gambit_fn_0220CEE0(CPUState* cpu) {
         /* 0220CF00 */ _t4 = cpu->r[12] + 0x0000027Cu;
         /* 0220CF00 */ cpu->r[3] = rbrew_read32(cpu->mem, _t4);
         /* 0220CF04 */ Gambit_fn_026BF910(cpu);
-        /* 0220CF08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220CF0C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220CF08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220CF0C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220CF0C */ _t6 = _t5 & 0x00000001u;
         /* 0220CF0C */ if (_t6) goto L_0220CF38; else goto L_0220CF10;
   L_0220CF10: ; // 0x220cf10
-        /* 0220CF10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0220CF14 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220CF10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0220CF14 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220CF14 */ _t8 = _t7 & 0x00000001u;
         /* 0220CF14 */ if (_t8) goto L_0220CF20; else goto L_0220CF18;
   L_0220CF18: ; // 0x220cf18
@@ -20207,13 +20207,13 @@ void Gambit_fn_0220CEE4(CPUState* cpu) {
         /* 0220CF00 */ _t4 = cpu->r[12] + 0x0000027Cu;
         /* 0220CF00 */ cpu->r[3] = rbrew_read32(cpu->mem, _t4);
         /* 0220CF04 */ Gambit_fn_026BF910(cpu);
-        /* 0220CF08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220CF0C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220CF08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220CF0C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220CF0C */ _t6 = _t5 & 0x00000001u;
         /* 0220CF0C */ if (_t6) goto L_0220CF38; else goto L_0220CF10;
   L_0220CF10: ; // 0x220cf10
-        /* 0220CF10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0220CF14 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220CF10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0220CF14 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220CF14 */ _t8 = _t7 & 0x00000001u;
         /* 0220CF14 */ if (_t8) goto L_0220CF20; else goto L_0220CF18;
   L_0220CF18: ; // 0x220cf18
@@ -20264,20 +20264,20 @@ void Gambit_fn_0220CF50(CPUState* cpu) {
         /* 0220CF6C */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t4);
         /* 0220CF70 */ cpu->f[13] = fma(cpu->f[8], cpu->f[8], cpu->f[12]);
         /* 0220CF74 */ cpu->r[11] = 0x10040000u;
-        /* 0220CF78 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[9]);
+        /* 0220CF78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[9]));
         /* 0220CF7C */ _t5 = cpu->r[11] + 0x00002E70u;
         /* 0220CF7C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t5);
-        /* 0220CF80 */ _t6 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220CF80 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220CF80 */ _t7 = _t6 & 0x00000001u;
         /* 0220CF80 */ if (_t7) goto L_0220CF9C; else goto L_0220CF84;
   L_0220CF84: ; // 0x220cf84
         /* 0220CF84 */ cpu->f[7] = cpu->f[9] * cpu->f[13];
         /* 0220CF88 */ _t8 = cpu->r[1] + 0x0000000Cu;
         /* 0220CF88 */ rbrew_write_f32(cpu->mem, _t8, cpu->f[0]);
-        /* 0220CF8C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[9]);
+        /* 0220CF8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[9]));
         /* 0220CF90 */ _t9 = cpu->r[1] + 0x00000008u;
         /* 0220CF90 */ rbrew_write_f32(cpu->mem, _t9, cpu->f[8]);
-        /* 0220CF94 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220CF94 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220CF94 */ _t11 = _t10 & 0x00000001u;
         /* 0220CF94 */ if (_t11) goto L_0220CF98; else goto L_0220D008;
   L_0220CF98: ; // 0x220cf98
@@ -20295,22 +20295,22 @@ void Gambit_fn_0220CF50(CPUState* cpu) {
         /* 0220CFB4 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t14);
         /* 0220CFB8 */ _t15 = cpu->r[5] + 0x00000008u;
         /* 0220CFB8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t15);
-        /* 0220CFBC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[9]);
+        /* 0220CFBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[9]));
         /* 0220CFC0 */ _t16 = cpu->r[1] + 0x00000008u;
         /* 0220CFC0 */ rbrew_write_f32(cpu->mem, _t16, cpu->f[8]);
         /* 0220CFC4 */ _t17 = cpu->r[1] + 0x0000000Cu;
         /* 0220CFC4 */ rbrew_write_f32(cpu->mem, _t17, cpu->f[0]);
-        /* 0220CFC8 */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220CFC8 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220CFC8 */ _t19 = _t18 & 0x00000001u;
         /* 0220CFC8 */ if (_t19) goto L_0220CFCC; else goto L_0220D008;
   L_0220CFCC: ; // 0x220cfcc
         /* 0220CFCC */ cpu->f[13] = cpu->f[0] * cpu->f[0];
         /* 0220CFD0 */ cpu->f[8] = fma(cpu->f[8], cpu->f[8], cpu->f[13]);
         /* 0220CFD4 */ cpu->r[12] = 0x10040000u;
-        /* 0220CFD8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[9]);
+        /* 0220CFD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[9]));
         /* 0220CFDC */ _t20 = cpu->r[12] + 0x00002E78u;
         /* 0220CFDC */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t20);
-        /* 0220CFE0 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0220CFE0 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0220CFE0 */ _t22 = _t21 & 0x00000001u;
         /* 0220CFE0 */ if (_t22) goto L_0220CFE4; else goto L_0220D008;
   L_0220CFE4: ; // 0x220cfe4
@@ -20617,17 +20617,17 @@ void Gambit_fn_0220D028(CPUState* cpu) {
         /* 0220D23C */ cpu->r[10] = rbrew_read32(cpu->mem, _t100);
         /* 0220D240 */ _t101 = cpu->r[11] + 0x00002F50u;
         /* 0220D240 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t101);
-        /* 0220D244 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u);
+        /* 0220D244 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u));
         /* 0220D248 */ _t102 = cpu->r[31] + 0x000000ACu;
         /* 0220D248 */ rbrew_write32(cpu->mem, _t102, cpu->r[10]);
-        /* 0220D24C */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D24C */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D24C */ _t104 = _t103 & 0x00000001u;
         /* 0220D24C */ if (_t104) goto L_0220D250; else goto L_0220D260;
   L_0220D250: ; // 0x220d250
         /* 0220D250 */ cpu->r[3] = 0x00000010u;
         /* 0220D254 */ Gambit_fn_02801A78(cpu);
-        /* 0220D258 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220D25C */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D258 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220D25C */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D25C */ _t106 = _t105 & 0x00000001u;
         /* 0220D25C */ if (_t106) goto L_0220D270; else goto L_0220D260;
   L_0220D260: ; // 0x220d260
@@ -20640,16 +20640,16 @@ void Gambit_fn_0220D028(CPUState* cpu) {
         /* 0220D26C */ _t110 = cpu->r[3] + 0x0000000Cu;
         /* 0220D26C */ rbrew_write_f32(cpu->mem, _t110, cpu->f[30]);
   L_0220D270: ; // 0x220d270
-        /* 0220D270 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u);
+        /* 0220D270 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u));
         /* 0220D274 */ cpu->r[3] = cpu->r[31] + 0x000000D0u;
-        /* 0220D278 */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D278 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D278 */ _t112 = _t111 & 0x00000001u;
         /* 0220D278 */ if (_t112) goto L_0220D27C; else goto L_0220D28C;
   L_0220D27C: ; // 0x220d27c
         /* 0220D27C */ cpu->r[3] = 0x00000010u;
         /* 0220D280 */ Gambit_fn_02801A78(cpu);
-        /* 0220D284 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220D288 */ _t113 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D284 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220D288 */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D288 */ _t114 = _t113 & 0x00000001u;
         /* 0220D288 */ if (_t114) goto L_0220D29C; else goto L_0220D28C;
   L_0220D28C: ; // 0x220d28c
@@ -20697,7 +20697,7 @@ void Gambit_fn_0220D028(CPUState* cpu) {
         /* 0220D2E0 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t133);
         /* 0220D2E4 */ _t134 = cpu->r[1] + 0x00000058u;
         /* 0220D2E4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t134);
-        /* 0220D2E8 */ _t135 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220D2E8 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220D2E8 */ _t136 = _t135 & 0x00000001u;
         /* 0220D2E8 */ if (_t136) goto L_0220D2EC; // else: addr-0 trap, fall-through
   L_0220D2EC: ; // 0x220d2ec
@@ -20764,8 +20764,8 @@ void Gambit_fn_0220D31C(CPUState* cpu) {
         /* 0220D31C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0220D31C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0220D320 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 0220D320 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0220D324 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D320 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0220D324 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D324 */ _t2 = _t1 & 0x00000001u;
         /* 0220D324 */ _t3 = _t2 ^ 0x00000001u;
         /* 0220D324 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -20787,8 +20787,8 @@ void Gambit_fn_0220D338(CPUState* cpu) {
         /* 0220D338 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0220D338 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0220D33C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 0220D33C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0220D340 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D33C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0220D340 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D340 */ _t2 = _t1 & 0x00000001u;
         /* 0220D340 */ _t3 = _t2 ^ 0x00000001u;
         /* 0220D340 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -20810,8 +20810,8 @@ void Gambit_fn_0220D354(CPUState* cpu) {
         /* 0220D354 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0220D354 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0220D358 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 0220D358 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0220D35C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D358 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0220D35C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D35C */ _t2 = _t1 & 0x00000001u;
         /* 0220D35C */ _t3 = _t2 ^ 0x00000001u;
         /* 0220D35C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -20854,8 +20854,8 @@ void Gambit_fn_0220D380(CPUState* cpu) {
         /* 0220D390 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0220D394 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0220D394 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0220D398 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0220D39C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D398 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0220D39C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D39C */ _t5 = _t4 & 0x00000001u;
         /* 0220D39C */ if (_t5) goto L_0220D3A0; else goto L_0220D3BC;
   L_0220D3A0: ; // 0x220d3a0
@@ -20894,8 +20894,8 @@ void Gambit_fn_0220D384(CPUState* cpu) {
         /* 0220D390 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0220D394 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0220D394 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0220D398 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0220D39C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D398 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0220D39C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D39C */ _t5 = _t4 & 0x00000001u;
         /* 0220D39C */ if (_t5) goto L_0220D3A0; else goto L_0220D3BC;
   L_0220D3A0: ; // 0x220d3a0
@@ -101,8 +101,8 @@ void Gambit_fn_0220D544(CPUState* cpu) {
         /* 0220D544 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 0220D544 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0220D548 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0220D548 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0220D54C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D548 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0220D54C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D54C */ _t2 = _t1 & 0x00000001u;
         /* 0220D54C */ if (_t2) goto L_0220D55C; else goto L_0220D550;
   L_0220D550: ; // 0x220d550
@@ -131,8 +131,8 @@ void Gambit_fn_0220D568(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -234,9 +234,9 @@ void Gambit_fn_0220D5C0(CPUState* cpu) {
         /* 0220D5C4 */ _t0 = cpu->r[8] + 0xFFFFE614u;
         /* 0220D5C4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 0220D5C8 */ cpu->r[6] = 0x101D0000u;
-        /* 0220D5CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0220D5CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0220D5D0 */ cpu->r[6] = cpu->r[6] + 0xFFFFFECCu;
-        /* 0220D5D4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D5D4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D5D4 */ _t2 = _t1 & 0x00000001u;
         /* 0220D5D4 */ if (_t2) goto L_0220D5D8; else goto L_0220D5F0;
   L_0220D5D8: ; // 0x220d5d8
@@ -249,8 +249,8 @@ void Gambit_fn_0220D5C0(CPUState* cpu) {
         /* 0220D5EC */ _t4 = cpu->r[6] + 0x00000000u;
         /* 0220D5EC */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_0220D5F0: ; // 0x220d5f0
-        /* 0220D5F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 0220D5F4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D5F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 0220D5F4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D5F4 */ _t6 = _t5 & 0x00000001u;
         /* 0220D5F4 */ if (_t6) goto L_0220D5F8; else goto L_0220D600;
   L_0220D5F8: ; // 0x220d5f8
@@ -261,9 +261,9 @@ void Gambit_fn_0220D5C0(CPUState* cpu) {
         /* 0220D604 */ _t7 = cpu->r[10] + 0xFFFFE610u;
         /* 0220D604 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 0220D608 */ cpu->r[8] = 0x101D0000u;
-        /* 0220D60C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0220D60C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0220D610 */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 0220D614 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D614 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D614 */ _t9 = _t8 & 0x00000001u;
         /* 0220D614 */ if (_t9) goto L_0220D618; else goto L_0220D630;
   L_0220D618: ; // 0x220d618
@@ -276,8 +276,8 @@ void Gambit_fn_0220D5C0(CPUState* cpu) {
         /* 0220D62C */ _t11 = cpu->r[8] + 0x00000000u;
         /* 0220D62C */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_0220D630: ; // 0x220d630
-        /* 0220D630 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 0220D634 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D630 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 0220D634 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D634 */ _t13 = _t12 & 0x00000001u;
         /* 0220D634 */ if (_t13) goto L_0220D638; else goto L_0220D640;
   L_0220D638: ; // 0x220d638
@@ -288,9 +288,9 @@ void Gambit_fn_0220D5C0(CPUState* cpu) {
         /* 0220D644 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 0220D644 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 0220D648 */ cpu->r[10] = 0x101D0000u;
-        /* 0220D64C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0220D64C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0220D650 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 0220D654 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D654 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D654 */ _t16 = _t15 & 0x00000001u;
         /* 0220D654 */ if (_t16) goto L_0220D658; else goto L_0220D670;
   L_0220D658: ; // 0x220d658
@@ -303,8 +303,8 @@ void Gambit_fn_0220D5C0(CPUState* cpu) {
         /* 0220D66C */ _t18 = cpu->r[10] + 0x00000000u;
         /* 0220D66C */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_0220D670: ; // 0x220d670
-        /* 0220D670 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0220D674 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D670 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0220D674 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D674 */ _t20 = _t19 & 0x00000001u;
         /* 0220D674 */ if (_t20) goto L_0220D678; else goto L_0220D680;
   L_0220D678: ; // 0x220d678
@@ -315,9 +315,9 @@ void Gambit_fn_0220D5C0(CPUState* cpu) {
         /* 0220D684 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 0220D684 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 0220D688 */ cpu->r[12] = 0x101D0000u;
-        /* 0220D68C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220D68C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220D690 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 0220D694 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D694 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D694 */ _t23 = _t22 & 0x00000001u;
         /* 0220D694 */ if (_t23) goto L_0220D698; else goto L_0220D6B0;
   L_0220D698: ; // 0x220d698
@@ -330,8 +330,8 @@ void Gambit_fn_0220D5C0(CPUState* cpu) {
         /* 0220D6AC */ _t25 = cpu->r[12] + 0x00000000u;
         /* 0220D6AC */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_0220D6B0: ; // 0x220d6b0
-        /* 0220D6B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0220D6B4 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D6B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0220D6B4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D6B4 */ _t27 = _t26 & 0x00000001u;
         /* 0220D6B4 */ if (_t27) goto L_0220D6B8; else goto L_0220D6C0;
   L_0220D6B8: ; // 0x220d6b8
@@ -343,9 +343,9 @@ void Gambit_fn_0220D5C0(CPUState* cpu) {
         /* 0220D6C4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 0220D6C4 */ cpu->r[10] = _t28;
         /* 0220D6C8 */ cpu->r[7] = 0x101D0000u;
-        /* 0220D6CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220D6CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220D6D0 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 0220D6D4 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D6D4 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D6D4 */ _t30 = _t29 & 0x00000001u;
         /* 0220D6D4 */ if (_t30) goto L_0220D6D8; else goto L_0220D6EC;
   L_0220D6D8: ; // 0x220d6d8
@@ -357,8 +357,8 @@ void Gambit_fn_0220D5C0(CPUState* cpu) {
         /* 0220D6E8 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 0220D6E8 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_0220D6EC: ; // 0x220d6ec
-        /* 0220D6EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 0220D6F0 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D6EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 0220D6F0 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D6F0 */ _t34 = _t33 & 0x00000001u;
         /* 0220D6F0 */ if (_t34) goto L_0220D6F4; else goto L_0220D6FC;
   L_0220D6F4: ; // 0x220d6f4
@@ -370,9 +370,9 @@ void Gambit_fn_0220D5C0(CPUState* cpu) {
         /* 0220D700 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 0220D700 */ cpu->r[8] = _t35;
         /* 0220D704 */ cpu->r[6] = 0x101D0000u;
-        /* 0220D708 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0220D708 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0220D70C */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 0220D710 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D710 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D710 */ _t37 = _t36 & 0x00000001u;
         /* 0220D710 */ if (_t37) goto L_0220D714; else goto L_0220D728;
   L_0220D714: ; // 0x220d714
@@ -399,15 +399,15 @@ void Gambit_fn_0220D740(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0220D740: ; // 0x220d740
-        /* 0220D740 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220D744 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D740 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220D744 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D744 */ _t1 = _t0 & 0x00000001u;
         /* 0220D744 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0220D744 */ goto L_0220D748;
   L_0220D748: ; // 0x220d748
         /* 0220D748 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0220D748 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0220D74C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D748 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0220D74C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D74C */ _t3 = _t2 & 0x00000001u;
         /* 0220D74C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0220D74C */ goto L_0220D750;
@@ -426,8 +426,8 @@ void Gambit_fn_0220D740(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -441,15 +441,15 @@ void Gambit_fn_0220D740(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -477,15 +477,15 @@ void Gambit_fn_0220D754(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0220D754: ; // 0x220d754
-        /* 0220D754 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220D758 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D754 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220D758 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D758 */ _t1 = _t0 & 0x00000001u;
         /* 0220D758 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0220D758 */ goto L_0220D75C;
   L_0220D75C: ; // 0x220d75c
         /* 0220D75C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0220D75C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0220D760 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D75C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0220D760 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D760 */ _t3 = _t2 & 0x00000001u;
         /* 0220D760 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0220D760 */ goto L_0220D764;
@@ -504,8 +504,8 @@ void Gambit_fn_0220D754(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -519,15 +519,15 @@ void Gambit_fn_0220D754(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -556,9 +556,9 @@ void Gambit_fn_0220D768(CPUState* cpu) {
 
   L_0220D768: ; // 0x220d768
         /* 0220D768 */ cpu->r[12] = 0x101E0000u;
-        /* 0220D76C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 0220D76C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 0220D770 */ cpu->r[12] = cpu->r[12] + 0x000029A4u;
-        /* 0220D774 */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220D774 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220D774 */ _t1 = _t0 & 0x00000001u;
         /* 0220D774 */ if (_t1) goto L_0220D778; else goto L_0220D780;
   L_0220D778: ; // 0x220d778
@@ -599,8 +599,8 @@ void Gambit_fn_0220D79C(CPUState* cpu) {
         /* 0220D7B0 */ Gambit_fn_02213074(cpu);
         /* 0220D7B4 */ _t2 = cpu->r[31] + 0x00000024u;
         /* 0220D7B4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 0220D7B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220D7BC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D7B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220D7BC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D7BC */ _t4 = _t3 & 0x00000001u;
         /* 0220D7BC */ if (_t4) goto L_0220D7C0; else goto L_0220D86C;
   L_0220D7C0: ; // 0x220d7c0
@@ -631,16 +631,16 @@ void Gambit_fn_0220D79C(CPUState* cpu) {
         /* 0220D80C */ _t9 = cpu->r[1] + 0x00000010u;
         /* 0220D80C */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 0220D810 */ Gambit_fn_02022278(cpu);
-        /* 0220D814 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220D818 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D814 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220D818 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D818 */ _t11 = _t10 & 0x00000001u;
         /* 0220D818 */ if (_t11) goto L_0220D848; else goto L_0220D81C;
   L_0220D81C: ; // 0x220d81c
-        /* 0220D81C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220D81C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220D820 */ cpu->r[12] = cpu->r[31];
         /* 0220D824 */ _t12 = cpu->r[3] + 0x00000000u;
         /* 0220D824 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0220D828 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220D828 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220D828 */ _t14 = _t13 & 0x00000001u;
         /* 0220D828 */ if (_t14) goto L_0220D82C; else goto L_0220D830;
   L_0220D82C: ; // 0x220d82c
@@ -649,18 +649,18 @@ void Gambit_fn_0220D79C(CPUState* cpu) {
         /* 0220D830 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0220D830 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 0220D834 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220D834 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220D834 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220D838 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220D83C */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220D840 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D840 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D840 */ _t17 = _t16 & 0x00000001u;
         /* 0220D840 */ if (_t17) goto L_0220D844; else goto L_0220D7E8;
   L_0220D844: ; // 0x220d844
         /* 0220D844 */ goto L_0220D86C;
   L_0220D848: ; // 0x220d848
-        /* 0220D848 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220D848 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220D84C */ cpu->r[6] = cpu->r[31];
-        /* 0220D850 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220D850 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220D850 */ _t19 = _t18 & 0x00000001u;
         /* 0220D850 */ if (_t19) goto L_0220D854; else goto L_0220D858;
   L_0220D854: ; // 0x220d854
@@ -669,10 +669,10 @@ void Gambit_fn_0220D79C(CPUState* cpu) {
         /* 0220D858 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 0220D858 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 0220D85C */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220D85C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220D85C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220D860 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220D864 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220D868 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D868 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D868 */ _t22 = _t21 & 0x00000001u;
         /* 0220D868 */ if (_t22) goto L_0220D86C; else goto L_0220D7E8;
   L_0220D86C: ; // 0x220d86c
@@ -690,9 +690,9 @@ void Gambit_fn_0220D880(CPUState* cpu) {
 
   L_0220D880: ; // 0x220d880
         /* 0220D880 */ cpu->r[12] = 0x101E0000u;
-        /* 0220D884 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 0220D884 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 0220D888 */ cpu->r[12] = cpu->r[12] + 0x000029ACu;
-        /* 0220D88C */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220D88C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220D88C */ _t1 = _t0 & 0x00000001u;
         /* 0220D88C */ if (_t1) goto L_0220D890; else goto L_0220D898;
   L_0220D890: ; // 0x220d890
@@ -733,8 +733,8 @@ void Gambit_fn_0220D8B4(CPUState* cpu) {
         /* 0220D8C8 */ Gambit_fn_02213074(cpu);
         /* 0220D8CC */ _t2 = cpu->r[31] + 0x00000024u;
         /* 0220D8CC */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 0220D8D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220D8D4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D8D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220D8D4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D8D4 */ _t4 = _t3 & 0x00000001u;
         /* 0220D8D4 */ if (_t4) goto L_0220D8D8; else goto L_0220D984;
   L_0220D8D8: ; // 0x220d8d8
@@ -765,16 +765,16 @@ void Gambit_fn_0220D8B4(CPUState* cpu) {
         /* 0220D924 */ _t9 = cpu->r[1] + 0x00000010u;
         /* 0220D924 */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 0220D928 */ Gambit_fn_02022278(cpu);
-        /* 0220D92C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220D930 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D92C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220D930 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D930 */ _t11 = _t10 & 0x00000001u;
         /* 0220D930 */ if (_t11) goto L_0220D960; else goto L_0220D934;
   L_0220D934: ; // 0x220d934
-        /* 0220D934 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220D934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220D938 */ cpu->r[12] = cpu->r[31];
         /* 0220D93C */ _t12 = cpu->r[3] + 0x00000000u;
         /* 0220D93C */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0220D940 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220D940 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220D940 */ _t14 = _t13 & 0x00000001u;
         /* 0220D940 */ if (_t14) goto L_0220D944; else goto L_0220D948;
   L_0220D944: ; // 0x220d944
@@ -783,18 +783,18 @@ void Gambit_fn_0220D8B4(CPUState* cpu) {
         /* 0220D948 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0220D948 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 0220D94C */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220D94C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220D94C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220D950 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220D954 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220D958 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D958 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D958 */ _t17 = _t16 & 0x00000001u;
         /* 0220D958 */ if (_t17) goto L_0220D95C; else goto L_0220D900;
   L_0220D95C: ; // 0x220d95c
         /* 0220D95C */ goto L_0220D984;
   L_0220D960: ; // 0x220d960
-        /* 0220D960 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220D960 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220D964 */ cpu->r[6] = cpu->r[31];
-        /* 0220D968 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220D968 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220D968 */ _t19 = _t18 & 0x00000001u;
         /* 0220D968 */ if (_t19) goto L_0220D96C; else goto L_0220D970;
   L_0220D96C: ; // 0x220d96c
@@ -803,10 +803,10 @@ void Gambit_fn_0220D8B4(CPUState* cpu) {
         /* 0220D970 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 0220D970 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 0220D974 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220D974 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220D974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220D978 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220D97C */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220D980 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D980 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D980 */ _t22 = _t21 & 0x00000001u;
         /* 0220D980 */ if (_t22) goto L_0220D984; else goto L_0220D900;
   L_0220D984: ; // 0x220d984
@@ -824,9 +824,9 @@ void Gambit_fn_0220D998(CPUState* cpu) {
 
   L_0220D998: ; // 0x220d998
         /* 0220D998 */ cpu->r[12] = 0x101E0000u;
-        /* 0220D99C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 0220D99C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 0220D9A0 */ cpu->r[12] = cpu->r[12] + 0x000029B4u;
-        /* 0220D9A4 */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220D9A4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220D9A4 */ _t1 = _t0 & 0x00000001u;
         /* 0220D9A4 */ if (_t1) goto L_0220D9A8; else goto L_0220D9B0;
   L_0220D9A8: ; // 0x220d9a8
@@ -867,8 +867,8 @@ void Gambit_fn_0220D9CC(CPUState* cpu) {
         /* 0220D9E0 */ Gambit_fn_02213074(cpu);
         /* 0220D9E4 */ _t2 = cpu->r[31] + 0x00000024u;
         /* 0220D9E4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 0220D9E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220D9EC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220D9E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220D9EC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220D9EC */ _t4 = _t3 & 0x00000001u;
         /* 0220D9EC */ if (_t4) goto L_0220D9F0; else goto L_0220DA9C;
   L_0220D9F0: ; // 0x220d9f0
@@ -899,16 +899,16 @@ void Gambit_fn_0220D9CC(CPUState* cpu) {
         /* 0220DA3C */ _t9 = cpu->r[1] + 0x00000010u;
         /* 0220DA3C */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 0220DA40 */ Gambit_fn_02022278(cpu);
-        /* 0220DA44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220DA48 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220DA44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220DA48 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220DA48 */ _t11 = _t10 & 0x00000001u;
         /* 0220DA48 */ if (_t11) goto L_0220DA78; else goto L_0220DA4C;
   L_0220DA4C: ; // 0x220da4c
-        /* 0220DA4C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220DA4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220DA50 */ cpu->r[12] = cpu->r[31];
         /* 0220DA54 */ _t12 = cpu->r[3] + 0x00000000u;
         /* 0220DA54 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0220DA58 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220DA58 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220DA58 */ _t14 = _t13 & 0x00000001u;
         /* 0220DA58 */ if (_t14) goto L_0220DA5C; else goto L_0220DA60;
   L_0220DA5C: ; // 0x220da5c
@@ -917,18 +917,18 @@ void Gambit_fn_0220D9CC(CPUState* cpu) {
         /* 0220DA60 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0220DA60 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 0220DA64 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220DA64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220DA64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220DA68 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220DA6C */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220DA70 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220DA70 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220DA70 */ _t17 = _t16 & 0x00000001u;
         /* 0220DA70 */ if (_t17) goto L_0220DA74; else goto L_0220DA18;
   L_0220DA74: ; // 0x220da74
         /* 0220DA74 */ goto L_0220DA9C;
   L_0220DA78: ; // 0x220da78
-        /* 0220DA78 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220DA78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220DA7C */ cpu->r[6] = cpu->r[31];
-        /* 0220DA80 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220DA80 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220DA80 */ _t19 = _t18 & 0x00000001u;
         /* 0220DA80 */ if (_t19) goto L_0220DA84; else goto L_0220DA88;
   L_0220DA84: ; // 0x220da84
@@ -937,10 +937,10 @@ void Gambit_fn_0220D9CC(CPUState* cpu) {
         /* 0220DA88 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 0220DA88 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 0220DA8C */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220DA8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220DA8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220DA90 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220DA94 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220DA98 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220DA98 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220DA98 */ _t22 = _t21 & 0x00000001u;
         /* 0220DA98 */ if (_t22) goto L_0220DA9C; else goto L_0220DA18;
   L_0220DA9C: ; // 0x220da9c
@@ -958,9 +958,9 @@ void Gambit_fn_0220DAB0(CPUState* cpu) {
 
   L_0220DAB0: ; // 0x220dab0
         /* 0220DAB0 */ cpu->r[12] = 0x101E0000u;
-        /* 0220DAB4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 0220DAB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 0220DAB8 */ cpu->r[12] = cpu->r[12] + 0x000029BCu;
-        /* 0220DABC */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220DABC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220DABC */ _t1 = _t0 & 0x00000001u;
         /* 0220DABC */ if (_t1) goto L_0220DAC0; else goto L_0220DAC8;
   L_0220DAC0: ; // 0x220dac0
@@ -1001,8 +1001,8 @@ void Gambit_fn_0220DAE4(CPUState* cpu) {
         /* 0220DAF8 */ Gambit_fn_02213074(cpu);
         /* 0220DAFC */ _t2 = cpu->r[31] + 0x00000024u;
         /* 0220DAFC */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 0220DB00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220DB04 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220DB00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220DB04 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220DB04 */ _t4 = _t3 & 0x00000001u;
         /* 0220DB04 */ if (_t4) goto L_0220DB08; else goto L_0220DBB4;
   L_0220DB08: ; // 0x220db08
@@ -1033,16 +1033,16 @@ void Gambit_fn_0220DAE4(CPUState* cpu) {
         /* 0220DB54 */ _t9 = cpu->r[1] + 0x00000010u;
         /* 0220DB54 */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 0220DB58 */ Gambit_fn_02022278(cpu);
-        /* 0220DB5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220DB60 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220DB5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220DB60 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220DB60 */ _t11 = _t10 & 0x00000001u;
         /* 0220DB60 */ if (_t11) goto L_0220DB90; else goto L_0220DB64;
   L_0220DB64: ; // 0x220db64
-        /* 0220DB64 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220DB64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220DB68 */ cpu->r[12] = cpu->r[31];
         /* 0220DB6C */ _t12 = cpu->r[3] + 0x00000000u;
         /* 0220DB6C */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0220DB70 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220DB70 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220DB70 */ _t14 = _t13 & 0x00000001u;
         /* 0220DB70 */ if (_t14) goto L_0220DB74; else goto L_0220DB78;
   L_0220DB74: ; // 0x220db74
@@ -1051,18 +1051,18 @@ void Gambit_fn_0220DAE4(CPUState* cpu) {
         /* 0220DB78 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0220DB78 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 0220DB7C */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220DB7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220DB7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220DB80 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220DB84 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220DB88 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220DB88 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220DB88 */ _t17 = _t16 & 0x00000001u;
         /* 0220DB88 */ if (_t17) goto L_0220DB8C; else goto L_0220DB30;
   L_0220DB8C: ; // 0x220db8c
         /* 0220DB8C */ goto L_0220DBB4;
   L_0220DB90: ; // 0x220db90
-        /* 0220DB90 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220DB90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220DB94 */ cpu->r[6] = cpu->r[31];
-        /* 0220DB98 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220DB98 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220DB98 */ _t19 = _t18 & 0x00000001u;
         /* 0220DB98 */ if (_t19) goto L_0220DB9C; else goto L_0220DBA0;
   L_0220DB9C: ; // 0x220db9c
@@ -1071,10 +1071,10 @@ void Gambit_fn_0220DAE4(CPUState* cpu) {
         /* 0220DBA0 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 0220DBA0 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 0220DBA4 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220DBA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220DBA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220DBA8 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220DBAC */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220DBB0 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220DBB0 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220DBB0 */ _t22 = _t21 & 0x00000001u;
         /* 0220DBB0 */ if (_t22) goto L_0220DBB4; else goto L_0220DB30;
   L_0220DBB4: ; // 0x220dbb4
@@ -1092,9 +1092,9 @@ void Gambit_fn_0220DBC8(CPUState* cpu) {
 
   L_0220DBC8: ; // 0x220dbc8
         /* 0220DBC8 */ cpu->r[12] = 0x101E0000u;
-        /* 0220DBCC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 0220DBCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 0220DBD0 */ cpu->r[12] = cpu->r[12] + 0x000029C4u;
-        /* 0220DBD4 */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220DBD4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220DBD4 */ _t1 = _t0 & 0x00000001u;
         /* 0220DBD4 */ if (_t1) goto L_0220DBD8; else goto L_0220DBE0;
   L_0220DBD8: ; // 0x220dbd8
@@ -1135,8 +1135,8 @@ void Gambit_fn_0220DBFC(CPUState* cpu) {
         /* 0220DC10 */ Gambit_fn_02213074(cpu);
         /* 0220DC14 */ _t2 = cpu->r[31] + 0x00000024u;
         /* 0220DC14 */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 0220DC18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220DC1C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220DC18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220DC1C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220DC1C */ _t4 = _t3 & 0x00000001u;
         /* 0220DC1C */ if (_t4) goto L_0220DC20; else goto L_0220DCCC;
   L_0220DC20: ; // 0x220dc20
@@ -1167,16 +1167,16 @@ void Gambit_fn_0220DBFC(CPUState* cpu) {
         /* 0220DC6C */ _t9 = cpu->r[1] + 0x00000010u;
         /* 0220DC6C */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 0220DC70 */ Gambit_fn_02022278(cpu);
-        /* 0220DC74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220DC78 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220DC74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220DC78 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220DC78 */ _t11 = _t10 & 0x00000001u;
         /* 0220DC78 */ if (_t11) goto L_0220DCA8; else goto L_0220DC7C;
   L_0220DC7C: ; // 0x220dc7c
-        /* 0220DC7C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220DC7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220DC80 */ cpu->r[12] = cpu->r[31];
         /* 0220DC84 */ _t12 = cpu->r[3] + 0x00000000u;
         /* 0220DC84 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0220DC88 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220DC88 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220DC88 */ _t14 = _t13 & 0x00000001u;
         /* 0220DC88 */ if (_t14) goto L_0220DC8C; else goto L_0220DC90;
   L_0220DC8C: ; // 0x220dc8c
@@ -1185,18 +1185,18 @@ void Gambit_fn_0220DBFC(CPUState* cpu) {
         /* 0220DC90 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0220DC90 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 0220DC94 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220DC94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220DC94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220DC98 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220DC9C */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220DCA0 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220DCA0 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220DCA0 */ _t17 = _t16 & 0x00000001u;
         /* 0220DCA0 */ if (_t17) goto L_0220DCA4; else goto L_0220DC48;
   L_0220DCA4: ; // 0x220dca4
         /* 0220DCA4 */ goto L_0220DCCC;
   L_0220DCA8: ; // 0x220dca8
-        /* 0220DCA8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220DCA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220DCAC */ cpu->r[6] = cpu->r[31];
-        /* 0220DCB0 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220DCB0 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220DCB0 */ _t19 = _t18 & 0x00000001u;
         /* 0220DCB0 */ if (_t19) goto L_0220DCB4; else goto L_0220DCB8;
   L_0220DCB4: ; // 0x220dcb4
@@ -1205,10 +1205,10 @@ void Gambit_fn_0220DBFC(CPUState* cpu) {
         /* 0220DCB8 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 0220DCB8 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 0220DCBC */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220DCBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220DCBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220DCC0 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220DCC4 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220DCC8 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220DCC8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220DCC8 */ _t22 = _t21 & 0x00000001u;
         /* 0220DCC8 */ if (_t22) goto L_0220DCCC; else goto L_0220DC48;
   L_0220DCCC: ; // 0x220dccc
@@ -1226,9 +1226,9 @@ void Gambit_fn_0220DCE0(CPUState* cpu) {
 
   L_0220DCE0: ; // 0x220dce0
         /* 0220DCE0 */ cpu->r[12] = 0x101E0000u;
-        /* 0220DCE4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 0220DCE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 0220DCE8 */ cpu->r[12] = cpu->r[12] + 0x000029CCu;
-        /* 0220DCEC */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220DCEC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220DCEC */ _t1 = _t0 & 0x00000001u;
         /* 0220DCEC */ if (_t1) goto L_0220DCF0; else goto L_0220DCF8;
   L_0220DCF0: ; // 0x220dcf0
@@ -1269,8 +1269,8 @@ void Gambit_fn_0220DD14(CPUState* cpu) {
         /* 0220DD28 */ Gambit_fn_02213074(cpu);
         /* 0220DD2C */ _t2 = cpu->r[31] + 0x00000024u;
         /* 0220DD2C */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 0220DD30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220DD34 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220DD30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220DD34 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220DD34 */ _t4 = _t3 & 0x00000001u;
         /* 0220DD34 */ if (_t4) goto L_0220DD38; else goto L_0220DDE4;
   L_0220DD38: ; // 0x220dd38
@@ -1301,16 +1301,16 @@ void Gambit_fn_0220DD14(CPUState* cpu) {
         /* 0220DD84 */ _t9 = cpu->r[1] + 0x00000010u;
         /* 0220DD84 */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 0220DD88 */ Gambit_fn_02022278(cpu);
-        /* 0220DD8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220DD90 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220DD8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220DD90 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220DD90 */ _t11 = _t10 & 0x00000001u;
         /* 0220DD90 */ if (_t11) goto L_0220DDC0; else goto L_0220DD94;
   L_0220DD94: ; // 0x220dd94
-        /* 0220DD94 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220DD94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220DD98 */ cpu->r[12] = cpu->r[31];
         /* 0220DD9C */ _t12 = cpu->r[3] + 0x00000000u;
         /* 0220DD9C */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0220DDA0 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220DDA0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220DDA0 */ _t14 = _t13 & 0x00000001u;
         /* 0220DDA0 */ if (_t14) goto L_0220DDA4; else goto L_0220DDA8;
   L_0220DDA4: ; // 0x220dda4
@@ -1319,18 +1319,18 @@ void Gambit_fn_0220DD14(CPUState* cpu) {
         /* 0220DDA8 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0220DDA8 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 0220DDAC */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220DDAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220DDAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220DDB0 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220DDB4 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220DDB8 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220DDB8 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220DDB8 */ _t17 = _t16 & 0x00000001u;
         /* 0220DDB8 */ if (_t17) goto L_0220DDBC; else goto L_0220DD60;
   L_0220DDBC: ; // 0x220ddbc
         /* 0220DDBC */ goto L_0220DDE4;
   L_0220DDC0: ; // 0x220ddc0
-        /* 0220DDC0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220DDC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220DDC4 */ cpu->r[6] = cpu->r[31];
-        /* 0220DDC8 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220DDC8 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220DDC8 */ _t19 = _t18 & 0x00000001u;
         /* 0220DDC8 */ if (_t19) goto L_0220DDCC; else goto L_0220DDD0;
   L_0220DDCC: ; // 0x220ddcc
@@ -1339,10 +1339,10 @@ void Gambit_fn_0220DD14(CPUState* cpu) {
         /* 0220DDD0 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 0220DDD0 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 0220DDD4 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220DDD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220DDD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220DDD8 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220DDDC */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220DDE0 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220DDE0 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220DDE0 */ _t22 = _t21 & 0x00000001u;
         /* 0220DDE0 */ if (_t22) goto L_0220DDE4; else goto L_0220DD60;
   L_0220DDE4: ; // 0x220dde4
@@ -1360,9 +1360,9 @@ void Gambit_fn_0220DDF8(CPUState* cpu) {
 
   L_0220DDF8: ; // 0x220ddf8
         /* 0220DDF8 */ cpu->r[12] = 0x101E0000u;
-        /* 0220DDFC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 0220DDFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 0220DE00 */ cpu->r[12] = cpu->r[12] + 0x000029D4u;
-        /* 0220DE04 */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220DE04 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220DE04 */ _t1 = _t0 & 0x00000001u;
         /* 0220DE04 */ if (_t1) goto L_0220DE08; else goto L_0220DE10;
   L_0220DE08: ; // 0x220de08
@@ -1403,8 +1403,8 @@ void Gambit_fn_0220DE2C(CPUState* cpu) {
         /* 0220DE40 */ Gambit_fn_02213074(cpu);
         /* 0220DE44 */ _t2 = cpu->r[31] + 0x00000024u;
         /* 0220DE44 */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 0220DE48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220DE4C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220DE48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220DE4C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220DE4C */ _t4 = _t3 & 0x00000001u;
         /* 0220DE4C */ if (_t4) goto L_0220DE50; else goto L_0220DEFC;
   L_0220DE50: ; // 0x220de50
@@ -1435,16 +1435,16 @@ void Gambit_fn_0220DE2C(CPUState* cpu) {
         /* 0220DE9C */ _t9 = cpu->r[1] + 0x00000010u;
         /* 0220DE9C */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 0220DEA0 */ Gambit_fn_02022278(cpu);
-        /* 0220DEA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220DEA8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220DEA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220DEA8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220DEA8 */ _t11 = _t10 & 0x00000001u;
         /* 0220DEA8 */ if (_t11) goto L_0220DED8; else goto L_0220DEAC;
   L_0220DEAC: ; // 0x220deac
-        /* 0220DEAC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220DEAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220DEB0 */ cpu->r[12] = cpu->r[31];
         /* 0220DEB4 */ _t12 = cpu->r[3] + 0x00000000u;
         /* 0220DEB4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0220DEB8 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220DEB8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220DEB8 */ _t14 = _t13 & 0x00000001u;
         /* 0220DEB8 */ if (_t14) goto L_0220DEBC; else goto L_0220DEC0;
   L_0220DEBC: ; // 0x220debc
@@ -1453,18 +1453,18 @@ void Gambit_fn_0220DE2C(CPUState* cpu) {
         /* 0220DEC0 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0220DEC0 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 0220DEC4 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220DEC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220DEC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220DEC8 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220DECC */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220DED0 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220DED0 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220DED0 */ _t17 = _t16 & 0x00000001u;
         /* 0220DED0 */ if (_t17) goto L_0220DED4; else goto L_0220DE78;
   L_0220DED4: ; // 0x220ded4
         /* 0220DED4 */ goto L_0220DEFC;
   L_0220DED8: ; // 0x220ded8
-        /* 0220DED8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220DED8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220DEDC */ cpu->r[6] = cpu->r[31];
-        /* 0220DEE0 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220DEE0 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220DEE0 */ _t19 = _t18 & 0x00000001u;
         /* 0220DEE0 */ if (_t19) goto L_0220DEE4; else goto L_0220DEE8;
   L_0220DEE4: ; // 0x220dee4
@@ -1473,10 +1473,10 @@ void Gambit_fn_0220DE2C(CPUState* cpu) {
         /* 0220DEE8 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 0220DEE8 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 0220DEEC */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220DEEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220DEEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220DEF0 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220DEF4 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220DEF8 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220DEF8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220DEF8 */ _t22 = _t21 & 0x00000001u;
         /* 0220DEF8 */ if (_t22) goto L_0220DEFC; else goto L_0220DE78;
   L_0220DEFC: ; // 0x220defc
@@ -1494,9 +1494,9 @@ void Gambit_fn_0220DF10(CPUState* cpu) {
 
   L_0220DF10: ; // 0x220df10
         /* 0220DF10 */ cpu->r[12] = 0x101E0000u;
-        /* 0220DF14 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 0220DF14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 0220DF18 */ cpu->r[12] = cpu->r[12] + 0x000029DCu;
-        /* 0220DF1C */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220DF1C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220DF1C */ _t1 = _t0 & 0x00000001u;
         /* 0220DF1C */ if (_t1) goto L_0220DF20; else goto L_0220DF28;
   L_0220DF20: ; // 0x220df20
@@ -1537,8 +1537,8 @@ void Gambit_fn_0220DF44(CPUState* cpu) {
         /* 0220DF58 */ Gambit_fn_02213074(cpu);
         /* 0220DF5C */ _t2 = cpu->r[31] + 0x00000024u;
         /* 0220DF5C */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 0220DF60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220DF64 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220DF60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220DF64 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220DF64 */ _t4 = _t3 & 0x00000001u;
         /* 0220DF64 */ if (_t4) goto L_0220DF68; else goto L_0220E014;
   L_0220DF68: ; // 0x220df68
@@ -1569,16 +1569,16 @@ void Gambit_fn_0220DF44(CPUState* cpu) {
         /* 0220DFB4 */ _t9 = cpu->r[1] + 0x00000010u;
         /* 0220DFB4 */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 0220DFB8 */ Gambit_fn_02022278(cpu);
-        /* 0220DFBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220DFC0 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220DFBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220DFC0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220DFC0 */ _t11 = _t10 & 0x00000001u;
         /* 0220DFC0 */ if (_t11) goto L_0220DFF0; else goto L_0220DFC4;
   L_0220DFC4: ; // 0x220dfc4
-        /* 0220DFC4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220DFC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220DFC8 */ cpu->r[12] = cpu->r[31];
         /* 0220DFCC */ _t12 = cpu->r[3] + 0x00000000u;
         /* 0220DFCC */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0220DFD0 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220DFD0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220DFD0 */ _t14 = _t13 & 0x00000001u;
         /* 0220DFD0 */ if (_t14) goto L_0220DFD4; else goto L_0220DFD8;
   L_0220DFD4: ; // 0x220dfd4
@@ -1587,18 +1587,18 @@ void Gambit_fn_0220DF44(CPUState* cpu) {
         /* 0220DFD8 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0220DFD8 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 0220DFDC */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220DFDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220DFDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220DFE0 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220DFE4 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220DFE8 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220DFE8 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220DFE8 */ _t17 = _t16 & 0x00000001u;
         /* 0220DFE8 */ if (_t17) goto L_0220DFEC; else goto L_0220DF90;
   L_0220DFEC: ; // 0x220dfec
         /* 0220DFEC */ goto L_0220E014;
   L_0220DFF0: ; // 0x220dff0
-        /* 0220DFF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220DFF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220DFF4 */ cpu->r[6] = cpu->r[31];
-        /* 0220DFF8 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220DFF8 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220DFF8 */ _t19 = _t18 & 0x00000001u;
         /* 0220DFF8 */ if (_t19) goto L_0220DFFC; else goto L_0220E000;
   L_0220DFFC: ; // 0x220dffc
@@ -1607,10 +1607,10 @@ void Gambit_fn_0220DF44(CPUState* cpu) {
         /* 0220E000 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 0220E000 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 0220E004 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220E004 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220E004 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220E008 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220E00C */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220E010 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E010 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E010 */ _t22 = _t21 & 0x00000001u;
         /* 0220E010 */ if (_t22) goto L_0220E014; else goto L_0220DF90;
   L_0220E014: ; // 0x220e014
@@ -1628,9 +1628,9 @@ void Gambit_fn_0220E028(CPUState* cpu) {
 
   L_0220E028: ; // 0x220e028
         /* 0220E028 */ cpu->r[12] = 0x101E0000u;
-        /* 0220E02C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 0220E02C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 0220E030 */ cpu->r[12] = cpu->r[12] + 0x000029E4u;
-        /* 0220E034 */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E034 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E034 */ _t1 = _t0 & 0x00000001u;
         /* 0220E034 */ if (_t1) goto L_0220E038; else goto L_0220E040;
   L_0220E038: ; // 0x220e038
@@ -1671,8 +1671,8 @@ void Gambit_fn_0220E05C(CPUState* cpu) {
         /* 0220E070 */ Gambit_fn_02213074(cpu);
         /* 0220E074 */ _t2 = cpu->r[31] + 0x00000024u;
         /* 0220E074 */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 0220E078 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220E07C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E078 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220E07C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E07C */ _t4 = _t3 & 0x00000001u;
         /* 0220E07C */ if (_t4) goto L_0220E080; else goto L_0220E12C;
   L_0220E080: ; // 0x220e080
@@ -1703,16 +1703,16 @@ void Gambit_fn_0220E05C(CPUState* cpu) {
         /* 0220E0CC */ _t9 = cpu->r[1] + 0x00000010u;
         /* 0220E0CC */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 0220E0D0 */ Gambit_fn_02022278(cpu);
-        /* 0220E0D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220E0D8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E0D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220E0D8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E0D8 */ _t11 = _t10 & 0x00000001u;
         /* 0220E0D8 */ if (_t11) goto L_0220E108; else goto L_0220E0DC;
   L_0220E0DC: ; // 0x220e0dc
-        /* 0220E0DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220E0DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220E0E0 */ cpu->r[12] = cpu->r[31];
         /* 0220E0E4 */ _t12 = cpu->r[3] + 0x00000000u;
         /* 0220E0E4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0220E0E8 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E0E8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E0E8 */ _t14 = _t13 & 0x00000001u;
         /* 0220E0E8 */ if (_t14) goto L_0220E0EC; else goto L_0220E0F0;
   L_0220E0EC: ; // 0x220e0ec
@@ -1721,18 +1721,18 @@ void Gambit_fn_0220E05C(CPUState* cpu) {
         /* 0220E0F0 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0220E0F0 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 0220E0F4 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220E0F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220E0F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220E0F8 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220E0FC */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220E100 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E100 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E100 */ _t17 = _t16 & 0x00000001u;
         /* 0220E100 */ if (_t17) goto L_0220E104; else goto L_0220E0A8;
   L_0220E104: ; // 0x220e104
         /* 0220E104 */ goto L_0220E12C;
   L_0220E108: ; // 0x220e108
-        /* 0220E108 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220E108 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220E10C */ cpu->r[6] = cpu->r[31];
-        /* 0220E110 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E110 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E110 */ _t19 = _t18 & 0x00000001u;
         /* 0220E110 */ if (_t19) goto L_0220E114; else goto L_0220E118;
   L_0220E114: ; // 0x220e114
@@ -1741,10 +1741,10 @@ void Gambit_fn_0220E05C(CPUState* cpu) {
         /* 0220E118 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 0220E118 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 0220E11C */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220E11C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220E11C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220E120 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220E124 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220E128 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E128 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E128 */ _t22 = _t21 & 0x00000001u;
         /* 0220E128 */ if (_t22) goto L_0220E12C; else goto L_0220E0A8;
   L_0220E12C: ; // 0x220e12c
@@ -1762,9 +1762,9 @@ void Gambit_fn_0220E140(CPUState* cpu) {
 
   L_0220E140: ; // 0x220e140
         /* 0220E140 */ cpu->r[12] = 0x101E0000u;
-        /* 0220E144 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 0220E144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 0220E148 */ cpu->r[12] = cpu->r[12] + 0x000029ECu;
-        /* 0220E14C */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E14C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E14C */ _t1 = _t0 & 0x00000001u;
         /* 0220E14C */ if (_t1) goto L_0220E150; else goto L_0220E158;
   L_0220E150: ; // 0x220e150
@@ -1805,8 +1805,8 @@ void Gambit_fn_0220E174(CPUState* cpu) {
         /* 0220E188 */ Gambit_fn_02213074(cpu);
         /* 0220E18C */ _t2 = cpu->r[31] + 0x00000024u;
         /* 0220E18C */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 0220E190 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220E194 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E190 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220E194 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E194 */ _t4 = _t3 & 0x00000001u;
         /* 0220E194 */ if (_t4) goto L_0220E198; else goto L_0220E244;
   L_0220E198: ; // 0x220e198
@@ -1837,16 +1837,16 @@ void Gambit_fn_0220E174(CPUState* cpu) {
         /* 0220E1E4 */ _t9 = cpu->r[1] + 0x00000010u;
         /* 0220E1E4 */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 0220E1E8 */ Gambit_fn_02022278(cpu);
-        /* 0220E1EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220E1F0 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E1EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220E1F0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E1F0 */ _t11 = _t10 & 0x00000001u;
         /* 0220E1F0 */ if (_t11) goto L_0220E220; else goto L_0220E1F4;
   L_0220E1F4: ; // 0x220e1f4
-        /* 0220E1F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220E1F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220E1F8 */ cpu->r[12] = cpu->r[31];
         /* 0220E1FC */ _t12 = cpu->r[3] + 0x00000000u;
         /* 0220E1FC */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0220E200 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E200 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E200 */ _t14 = _t13 & 0x00000001u;
         /* 0220E200 */ if (_t14) goto L_0220E204; else goto L_0220E208;
   L_0220E204: ; // 0x220e204
@@ -1855,18 +1855,18 @@ void Gambit_fn_0220E174(CPUState* cpu) {
         /* 0220E208 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0220E208 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 0220E20C */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220E20C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220E20C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220E210 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220E214 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220E218 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E218 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E218 */ _t17 = _t16 & 0x00000001u;
         /* 0220E218 */ if (_t17) goto L_0220E21C; else goto L_0220E1C0;
   L_0220E21C: ; // 0x220e21c
         /* 0220E21C */ goto L_0220E244;
   L_0220E220: ; // 0x220e220
-        /* 0220E220 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220E220 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220E224 */ cpu->r[6] = cpu->r[31];
-        /* 0220E228 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E228 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E228 */ _t19 = _t18 & 0x00000001u;
         /* 0220E228 */ if (_t19) goto L_0220E22C; else goto L_0220E230;
   L_0220E22C: ; // 0x220e22c
@@ -1875,10 +1875,10 @@ void Gambit_fn_0220E174(CPUState* cpu) {
         /* 0220E230 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 0220E230 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 0220E234 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220E234 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220E234 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220E238 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220E23C */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220E240 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E240 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E240 */ _t22 = _t21 & 0x00000001u;
         /* 0220E240 */ if (_t22) goto L_0220E244; else goto L_0220E1C0;
   L_0220E244: ; // 0x220e244
@@ -1896,9 +1896,9 @@ void Gambit_fn_0220E258(CPUState* cpu) {
 
   L_0220E258: ; // 0x220e258
         /* 0220E258 */ cpu->r[12] = 0x101E0000u;
-        /* 0220E25C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 0220E25C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 0220E260 */ cpu->r[12] = cpu->r[12] + 0x000029F4u;
-        /* 0220E264 */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E264 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E264 */ _t1 = _t0 & 0x00000001u;
         /* 0220E264 */ if (_t1) goto L_0220E268; else goto L_0220E270;
   L_0220E268: ; // 0x220e268
@@ -1939,8 +1939,8 @@ void Gambit_fn_0220E28C(CPUState* cpu) {
         /* 0220E2A0 */ Gambit_fn_02213074(cpu);
         /* 0220E2A4 */ _t2 = cpu->r[31] + 0x00000024u;
         /* 0220E2A4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 0220E2A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220E2AC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E2A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220E2AC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E2AC */ _t4 = _t3 & 0x00000001u;
         /* 0220E2AC */ if (_t4) goto L_0220E2B0; else goto L_0220E35C;
   L_0220E2B0: ; // 0x220e2b0
@@ -1971,16 +1971,16 @@ void Gambit_fn_0220E28C(CPUState* cpu) {
         /* 0220E2FC */ _t9 = cpu->r[1] + 0x00000010u;
         /* 0220E2FC */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 0220E300 */ Gambit_fn_02022278(cpu);
-        /* 0220E304 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220E308 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E304 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220E308 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E308 */ _t11 = _t10 & 0x00000001u;
         /* 0220E308 */ if (_t11) goto L_0220E338; else goto L_0220E30C;
   L_0220E30C: ; // 0x220e30c
-        /* 0220E30C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220E30C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220E310 */ cpu->r[12] = cpu->r[31];
         /* 0220E314 */ _t12 = cpu->r[3] + 0x00000000u;
         /* 0220E314 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0220E318 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E318 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E318 */ _t14 = _t13 & 0x00000001u;
         /* 0220E318 */ if (_t14) goto L_0220E31C; else goto L_0220E320;
   L_0220E31C: ; // 0x220e31c
@@ -1989,18 +1989,18 @@ void Gambit_fn_0220E28C(CPUState* cpu) {
         /* 0220E320 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0220E320 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 0220E324 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220E324 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220E324 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220E328 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220E32C */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220E330 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E330 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E330 */ _t17 = _t16 & 0x00000001u;
         /* 0220E330 */ if (_t17) goto L_0220E334; else goto L_0220E2D8;
   L_0220E334: ; // 0x220e334
         /* 0220E334 */ goto L_0220E35C;
   L_0220E338: ; // 0x220e338
-        /* 0220E338 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220E338 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220E33C */ cpu->r[6] = cpu->r[31];
-        /* 0220E340 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E340 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E340 */ _t19 = _t18 & 0x00000001u;
         /* 0220E340 */ if (_t19) goto L_0220E344; else goto L_0220E348;
   L_0220E344: ; // 0x220e344
@@ -2009,10 +2009,10 @@ void Gambit_fn_0220E28C(CPUState* cpu) {
         /* 0220E348 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 0220E348 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 0220E34C */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220E34C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220E34C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220E350 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220E354 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220E358 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E358 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E358 */ _t22 = _t21 & 0x00000001u;
         /* 0220E358 */ if (_t22) goto L_0220E35C; else goto L_0220E2D8;
   L_0220E35C: ; // 0x220e35c
@@ -2030,9 +2030,9 @@ void Gambit_fn_0220E370(CPUState* cpu) {
 
   L_0220E370: ; // 0x220e370
         /* 0220E370 */ cpu->r[12] = 0x101E0000u;
-        /* 0220E374 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 0220E374 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 0220E378 */ cpu->r[12] = cpu->r[12] + 0x000029FCu;
-        /* 0220E37C */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E37C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E37C */ _t1 = _t0 & 0x00000001u;
         /* 0220E37C */ if (_t1) goto L_0220E380; else goto L_0220E388;
   L_0220E380: ; // 0x220e380
@@ -2073,8 +2073,8 @@ void Gambit_fn_0220E3A4(CPUState* cpu) {
         /* 0220E3B8 */ Gambit_fn_02213074(cpu);
         /* 0220E3BC */ _t2 = cpu->r[31] + 0x00000024u;
         /* 0220E3BC */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 0220E3C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220E3C4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E3C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220E3C4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E3C4 */ _t4 = _t3 & 0x00000001u;
         /* 0220E3C4 */ if (_t4) goto L_0220E3C8; else goto L_0220E474;
   L_0220E3C8: ; // 0x220e3c8
@@ -2105,16 +2105,16 @@ void Gambit_fn_0220E3A4(CPUState* cpu) {
         /* 0220E414 */ _t9 = cpu->r[1] + 0x00000010u;
         /* 0220E414 */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 0220E418 */ Gambit_fn_02022278(cpu);
-        /* 0220E41C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220E420 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E41C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220E420 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E420 */ _t11 = _t10 & 0x00000001u;
         /* 0220E420 */ if (_t11) goto L_0220E450; else goto L_0220E424;
   L_0220E424: ; // 0x220e424
-        /* 0220E424 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220E424 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220E428 */ cpu->r[12] = cpu->r[31];
         /* 0220E42C */ _t12 = cpu->r[3] + 0x00000000u;
         /* 0220E42C */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0220E430 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E430 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E430 */ _t14 = _t13 & 0x00000001u;
         /* 0220E430 */ if (_t14) goto L_0220E434; else goto L_0220E438;
   L_0220E434: ; // 0x220e434
@@ -2123,18 +2123,18 @@ void Gambit_fn_0220E3A4(CPUState* cpu) {
         /* 0220E438 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0220E438 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 0220E43C */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220E43C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220E43C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220E440 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220E444 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220E448 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E448 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E448 */ _t17 = _t16 & 0x00000001u;
         /* 0220E448 */ if (_t17) goto L_0220E44C; else goto L_0220E3F0;
   L_0220E44C: ; // 0x220e44c
         /* 0220E44C */ goto L_0220E474;
   L_0220E450: ; // 0x220e450
-        /* 0220E450 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220E450 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220E454 */ cpu->r[6] = cpu->r[31];
-        /* 0220E458 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E458 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E458 */ _t19 = _t18 & 0x00000001u;
         /* 0220E458 */ if (_t19) goto L_0220E45C; else goto L_0220E460;
   L_0220E45C: ; // 0x220e45c
@@ -2143,10 +2143,10 @@ void Gambit_fn_0220E3A4(CPUState* cpu) {
         /* 0220E460 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 0220E460 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 0220E464 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220E464 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220E464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220E468 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220E46C */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220E470 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E470 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E470 */ _t22 = _t21 & 0x00000001u;
         /* 0220E470 */ if (_t22) goto L_0220E474; else goto L_0220E3F0;
   L_0220E474: ; // 0x220e474
@@ -2181,9 +2181,9 @@ void Gambit_fn_0220E488(CPUState* cpu) {
         /* 0220E4AC */ Gambit_fn_02019890(cpu);
         /* 0220E4B0 */ _t5 = cpu->r[1] + 0x00000008u;
         /* 0220E4B0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t5);
-        /* 0220E4B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
+        /* 0220E4B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
         /* 0220E4B8 */ cpu->r[3] = cpu->r[31];
-        /* 0220E4BC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E4BC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E4BC */ _t7 = _t6 & 0x00000001u;
         /* 0220E4BC */ if (_t7) goto L_0220E4C0; else goto L_0220E510;
   L_0220E4C0: ; // 0x220e4c0
@@ -2209,7 +2209,7 @@ void Gambit_fn_0220E488(CPUState* cpu) {
         /* 0220E4F4 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t13);
         /* 0220E4F8 */ _t14 = cpu->r[1] + 0x00000010u;
         /* 0220E4F8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t14);
-        /* 0220E4FC */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E4FC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E4FC */ _t16 = _t15 & 0x00000001u;
         /* 0220E4FC */ if (_t16) goto L_0220E500; // else: addr-0 trap, fall-through
   L_0220E500: ; // 0x220e500
@@ -2226,7 +2226,7 @@ void Gambit_fn_0220E488(CPUState* cpu) {
         /* 0220E518 */ cpu->r[31] = rbrew_read32(cpu->mem, _t19);
         /* 0220E51C */ _t20 = cpu->r[1] + 0x00000010u;
         /* 0220E51C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t20);
-        /* 0220E520 */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E520 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E520 */ _t22 = _t21 & 0x00000001u;
         /* 0220E520 */ if (_t22) goto L_0220E524; // else: addr-0 trap, fall-through
   L_0220E524: ; // 0x220e524
@@ -2259,9 +2259,9 @@ void Gambit_fn_0220E48C(CPUState* cpu) {
         /* 0220E4AC */ Gambit_fn_02019890(cpu);
         /* 0220E4B0 */ _t5 = cpu->r[1] + 0x00000008u;
         /* 0220E4B0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t5);
-        /* 0220E4B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
+        /* 0220E4B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
         /* 0220E4B8 */ cpu->r[3] = cpu->r[31];
-        /* 0220E4BC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E4BC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E4BC */ _t7 = _t6 & 0x00000001u;
         /* 0220E4BC */ if (_t7) goto L_0220E4C0; else goto L_0220E510;
   L_0220E4C0: ; // 0x220e4c0
@@ -2287,7 +2287,7 @@ void Gambit_fn_0220E48C(CPUState* cpu) {
         /* 0220E4F4 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t13);
         /* 0220E4F8 */ _t14 = cpu->r[1] + 0x00000010u;
         /* 0220E4F8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t14);
-        /* 0220E4FC */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E4FC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E4FC */ _t16 = _t15 & 0x00000001u;
         /* 0220E4FC */ if (_t16) goto L_0220E500; // else: addr-0 trap, fall-through
   L_0220E500: ; // 0x220e500
@@ -2304,7 +2304,7 @@ void Gambit_fn_0220E48C(CPUState* cpu) {
         /* 0220E518 */ cpu->r[31] = rbrew_read32(cpu->mem, _t19);
         /* 0220E51C */ _t20 = cpu->r[1] + 0x00000010u;
         /* 0220E51C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t20);
-        /* 0220E520 */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E520 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E520 */ _t22 = _t21 & 0x00000001u;
         /* 0220E520 */ if (_t22) goto L_0220E524; // else: addr-0 trap, fall-through
   L_0220E524: ; // 0x220e524
@@ -2321,9 +2321,9 @@ void Gambit_fn_0220E534(CPUState* cpu) {
 
   L_0220E534: ; // 0x220e534
         /* 0220E534 */ cpu->r[12] = 0x101E0000u;
-        /* 0220E538 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 0220E538 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 0220E53C */ cpu->r[12] = cpu->r[12] + 0x00002A04u;
-        /* 0220E540 */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E540 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E540 */ _t1 = _t0 & 0x00000001u;
         /* 0220E540 */ if (_t1) goto L_0220E544; else goto L_0220E54C;
   L_0220E544: ; // 0x220e544
@@ -2364,8 +2364,8 @@ void Gambit_fn_0220E568(CPUState* cpu) {
         /* 0220E57C */ Gambit_fn_02213074(cpu);
         /* 0220E580 */ _t2 = cpu->r[31] + 0x00000024u;
         /* 0220E580 */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 0220E584 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220E588 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220E588 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E588 */ _t4 = _t3 & 0x00000001u;
         /* 0220E588 */ if (_t4) goto L_0220E58C; else goto L_0220E638;
   L_0220E58C: ; // 0x220e58c
@@ -2396,16 +2396,16 @@ void Gambit_fn_0220E568(CPUState* cpu) {
         /* 0220E5D8 */ _t9 = cpu->r[1] + 0x00000010u;
         /* 0220E5D8 */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 0220E5DC */ Gambit_fn_02022278(cpu);
-        /* 0220E5E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220E5E4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E5E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220E5E4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E5E4 */ _t11 = _t10 & 0x00000001u;
         /* 0220E5E4 */ if (_t11) goto L_0220E614; else goto L_0220E5E8;
   L_0220E5E8: ; // 0x220e5e8
-        /* 0220E5E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220E5E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220E5EC */ cpu->r[12] = cpu->r[31];
         /* 0220E5F0 */ _t12 = cpu->r[3] + 0x00000000u;
         /* 0220E5F0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0220E5F4 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E5F4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E5F4 */ _t14 = _t13 & 0x00000001u;
         /* 0220E5F4 */ if (_t14) goto L_0220E5F8; else goto L_0220E5FC;
   L_0220E5F8: ; // 0x220e5f8
@@ -2414,18 +2414,18 @@ void Gambit_fn_0220E568(CPUState* cpu) {
         /* 0220E5FC */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0220E5FC */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 0220E600 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220E600 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220E600 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220E604 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220E608 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220E60C */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E60C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E60C */ _t17 = _t16 & 0x00000001u;
         /* 0220E60C */ if (_t17) goto L_0220E610; else goto L_0220E5B4;
   L_0220E610: ; // 0x220e610
         /* 0220E610 */ goto L_0220E638;
   L_0220E614: ; // 0x220e614
-        /* 0220E614 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220E614 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220E618 */ cpu->r[6] = cpu->r[31];
-        /* 0220E61C */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E61C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E61C */ _t19 = _t18 & 0x00000001u;
         /* 0220E61C */ if (_t19) goto L_0220E620; else goto L_0220E624;
   L_0220E620: ; // 0x220e620
@@ -2434,10 +2434,10 @@ void Gambit_fn_0220E568(CPUState* cpu) {
         /* 0220E624 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 0220E624 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 0220E628 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220E628 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220E628 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220E62C */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220E630 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220E634 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E634 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E634 */ _t22 = _t21 & 0x00000001u;
         /* 0220E634 */ if (_t22) goto L_0220E638; else goto L_0220E5B4;
   L_0220E638: ; // 0x220e638
@@ -2472,9 +2472,9 @@ void Gambit_fn_0220E64C(CPUState* cpu) {
         /* 0220E670 */ Gambit_fn_02019890(cpu);
         /* 0220E674 */ _t5 = cpu->r[1] + 0x00000008u;
         /* 0220E674 */ cpu->r[11] = rbrew_read32(cpu->mem, _t5);
-        /* 0220E678 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
+        /* 0220E678 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
         /* 0220E67C */ cpu->r[3] = cpu->r[31];
-        /* 0220E680 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E680 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E680 */ _t7 = _t6 & 0x00000001u;
         /* 0220E680 */ if (_t7) goto L_0220E684; else goto L_0220E6D4;
   L_0220E684: ; // 0x220e684
@@ -2500,7 +2500,7 @@ void Gambit_fn_0220E64C(CPUState* cpu) {
         /* 0220E6B8 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t13);
         /* 0220E6BC */ _t14 = cpu->r[1] + 0x00000010u;
         /* 0220E6BC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t14);
-        /* 0220E6C0 */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E6C0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E6C0 */ _t16 = _t15 & 0x00000001u;
         /* 0220E6C0 */ if (_t16) goto L_0220E6C4; // else: addr-0 trap, fall-through
   L_0220E6C4: ; // 0x220e6c4
@@ -2517,7 +2517,7 @@ void Gambit_fn_0220E64C(CPUState* cpu) {
         /* 0220E6DC */ cpu->r[31] = rbrew_read32(cpu->mem, _t19);
         /* 0220E6E0 */ _t20 = cpu->r[1] + 0x00000010u;
         /* 0220E6E0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t20);
-        /* 0220E6E4 */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E6E4 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E6E4 */ _t22 = _t21 & 0x00000001u;
         /* 0220E6E4 */ if (_t22) goto L_0220E6E8; // else: addr-0 trap, fall-through
   L_0220E6E8: ; // 0x220e6e8
@@ -2550,9 +2550,9 @@ void Gambit_fn_0220E650(CPUState* cpu) {
         /* 0220E670 */ Gambit_fn_02019890(cpu);
         /* 0220E674 */ _t5 = cpu->r[1] + 0x00000008u;
         /* 0220E674 */ cpu->r[11] = rbrew_read32(cpu->mem, _t5);
-        /* 0220E678 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
+        /* 0220E678 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
         /* 0220E67C */ cpu->r[3] = cpu->r[31];
-        /* 0220E680 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E680 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E680 */ _t7 = _t6 & 0x00000001u;
         /* 0220E680 */ if (_t7) goto L_0220E684; else goto L_0220E6D4;
   L_0220E684: ; // 0x220e684
@@ -2578,7 +2578,7 @@ void Gambit_fn_0220E650(CPUState* cpu) {
         /* 0220E6B8 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t13);
         /* 0220E6BC */ _t14 = cpu->r[1] + 0x00000010u;
         /* 0220E6BC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t14);
-        /* 0220E6C0 */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E6C0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E6C0 */ _t16 = _t15 & 0x00000001u;
         /* 0220E6C0 */ if (_t16) goto L_0220E6C4; // else: addr-0 trap, fall-through
   L_0220E6C4: ; // 0x220e6c4
@@ -2595,7 +2595,7 @@ void Gambit_fn_0220E650(CPUState* cpu) {
         /* 0220E6DC */ cpu->r[31] = rbrew_read32(cpu->mem, _t19);
         /* 0220E6E0 */ _t20 = cpu->r[1] + 0x00000010u;
         /* 0220E6E0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t20);
-        /* 0220E6E4 */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E6E4 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E6E4 */ _t22 = _t21 & 0x00000001u;
         /* 0220E6E4 */ if (_t22) goto L_0220E6E8; // else: addr-0 trap, fall-through
   L_0220E6E8: ; // 0x220e6e8
@@ -2612,9 +2612,9 @@ void Gambit_fn_0220E6F8(CPUState* cpu) {
 
   L_0220E6F8: ; // 0x220e6f8
         /* 0220E6F8 */ cpu->r[12] = 0x101E0000u;
-        /* 0220E6FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 0220E6FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 0220E700 */ cpu->r[12] = cpu->r[12] + 0x00002A0Cu;
-        /* 0220E704 */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E704 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E704 */ _t1 = _t0 & 0x00000001u;
         /* 0220E704 */ if (_t1) goto L_0220E708; else goto L_0220E710;
   L_0220E708: ; // 0x220e708
@@ -2655,8 +2655,8 @@ void Gambit_fn_0220E72C(CPUState* cpu) {
         /* 0220E740 */ Gambit_fn_02213074(cpu);
         /* 0220E744 */ _t2 = cpu->r[31] + 0x00000024u;
         /* 0220E744 */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 0220E748 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220E74C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E748 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220E74C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E74C */ _t4 = _t3 & 0x00000001u;
         /* 0220E74C */ if (_t4) goto L_0220E750; else goto L_0220E7FC;
   L_0220E750: ; // 0x220e750
@@ -2687,16 +2687,16 @@ void Gambit_fn_0220E72C(CPUState* cpu) {
         /* 0220E79C */ _t9 = cpu->r[1] + 0x00000010u;
         /* 0220E79C */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 0220E7A0 */ Gambit_fn_02022278(cpu);
-        /* 0220E7A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220E7A8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E7A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220E7A8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E7A8 */ _t11 = _t10 & 0x00000001u;
         /* 0220E7A8 */ if (_t11) goto L_0220E7D8; else goto L_0220E7AC;
   L_0220E7AC: ; // 0x220e7ac
-        /* 0220E7AC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220E7AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220E7B0 */ cpu->r[12] = cpu->r[31];
         /* 0220E7B4 */ _t12 = cpu->r[3] + 0x00000000u;
         /* 0220E7B4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0220E7B8 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E7B8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E7B8 */ _t14 = _t13 & 0x00000001u;
         /* 0220E7B8 */ if (_t14) goto L_0220E7BC; else goto L_0220E7C0;
   L_0220E7BC: ; // 0x220e7bc
@@ -2705,18 +2705,18 @@ void Gambit_fn_0220E72C(CPUState* cpu) {
         /* 0220E7C0 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0220E7C0 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 0220E7C4 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220E7C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220E7C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220E7C8 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220E7CC */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220E7D0 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E7D0 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E7D0 */ _t17 = _t16 & 0x00000001u;
         /* 0220E7D0 */ if (_t17) goto L_0220E7D4; else goto L_0220E778;
   L_0220E7D4: ; // 0x220e7d4
         /* 0220E7D4 */ goto L_0220E7FC;
   L_0220E7D8: ; // 0x220e7d8
-        /* 0220E7D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220E7D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220E7DC */ cpu->r[6] = cpu->r[31];
-        /* 0220E7E0 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E7E0 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E7E0 */ _t19 = _t18 & 0x00000001u;
         /* 0220E7E0 */ if (_t19) goto L_0220E7E4; else goto L_0220E7E8;
   L_0220E7E4: ; // 0x220e7e4
@@ -2725,10 +2725,10 @@ void Gambit_fn_0220E72C(CPUState* cpu) {
         /* 0220E7E8 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 0220E7E8 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 0220E7EC */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220E7EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220E7EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220E7F0 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220E7F4 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220E7F8 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E7F8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E7F8 */ _t22 = _t21 & 0x00000001u;
         /* 0220E7F8 */ if (_t22) goto L_0220E7FC; else goto L_0220E778;
   L_0220E7FC: ; // 0x220e7fc
@@ -2763,9 +2763,9 @@ void Gambit_fn_0220E810(CPUState* cpu) {
         /* 0220E834 */ Gambit_fn_02019890(cpu);
         /* 0220E838 */ _t5 = cpu->r[1] + 0x00000008u;
         /* 0220E838 */ cpu->r[11] = rbrew_read32(cpu->mem, _t5);
-        /* 0220E83C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
+        /* 0220E83C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
         /* 0220E840 */ cpu->r[3] = cpu->r[31];
-        /* 0220E844 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E844 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E844 */ _t7 = _t6 & 0x00000001u;
         /* 0220E844 */ if (_t7) goto L_0220E848; else goto L_0220E898;
   L_0220E848: ; // 0x220e848
@@ -2791,7 +2791,7 @@ void Gambit_fn_0220E810(CPUState* cpu) {
         /* 0220E87C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t13);
         /* 0220E880 */ _t14 = cpu->r[1] + 0x00000010u;
         /* 0220E880 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t14);
-        /* 0220E884 */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E884 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E884 */ _t16 = _t15 & 0x00000001u;
         /* 0220E884 */ if (_t16) goto L_0220E888; // else: addr-0 trap, fall-through
   L_0220E888: ; // 0x220e888
@@ -2808,7 +2808,7 @@ void Gambit_fn_0220E810(CPUState* cpu) {
         /* 0220E8A0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t19);
         /* 0220E8A4 */ _t20 = cpu->r[1] + 0x00000010u;
         /* 0220E8A4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t20);
-        /* 0220E8A8 */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E8A8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E8A8 */ _t22 = _t21 & 0x00000001u;
         /* 0220E8A8 */ if (_t22) goto L_0220E8AC; // else: addr-0 trap, fall-through
   L_0220E8AC: ; // 0x220e8ac
@@ -2841,9 +2841,9 @@ void Gambit_fn_0220E814(CPUState* cpu) {
         /* 0220E834 */ Gambit_fn_02019890(cpu);
         /* 0220E838 */ _t5 = cpu->r[1] + 0x00000008u;
         /* 0220E838 */ cpu->r[11] = rbrew_read32(cpu->mem, _t5);
-        /* 0220E83C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
+        /* 0220E83C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
         /* 0220E840 */ cpu->r[3] = cpu->r[31];
-        /* 0220E844 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E844 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E844 */ _t7 = _t6 & 0x00000001u;
         /* 0220E844 */ if (_t7) goto L_0220E848; else goto L_0220E898;
   L_0220E848: ; // 0x220e848
@@ -2869,7 +2869,7 @@ void Gambit_fn_0220E814(CPUState* cpu) {
         /* 0220E87C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t13);
         /* 0220E880 */ _t14 = cpu->r[1] + 0x00000010u;
         /* 0220E880 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t14);
-        /* 0220E884 */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E884 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E884 */ _t16 = _t15 & 0x00000001u;
         /* 0220E884 */ if (_t16) goto L_0220E888; // else: addr-0 trap, fall-through
   L_0220E888: ; // 0x220e888
@@ -2886,7 +2886,7 @@ void Gambit_fn_0220E814(CPUState* cpu) {
         /* 0220E8A0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t19);
         /* 0220E8A4 */ _t20 = cpu->r[1] + 0x00000010u;
         /* 0220E8A4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t20);
-        /* 0220E8A8 */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E8A8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E8A8 */ _t22 = _t21 & 0x00000001u;
         /* 0220E8A8 */ if (_t22) goto L_0220E8AC; // else: addr-0 trap, fall-through
   L_0220E8AC: ; // 0x220e8ac
@@ -2903,9 +2903,9 @@ void Gambit_fn_0220E8BC(CPUState* cpu) {
 
   L_0220E8BC: ; // 0x220e8bc
         /* 0220E8BC */ cpu->r[12] = 0x101E0000u;
-        /* 0220E8C0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 0220E8C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 0220E8C4 */ cpu->r[12] = cpu->r[12] + 0x00002A14u;
-        /* 0220E8C8 */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E8C8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E8C8 */ _t1 = _t0 & 0x00000001u;
         /* 0220E8C8 */ if (_t1) goto L_0220E8CC; else goto L_0220E8D4;
   L_0220E8CC: ; // 0x220e8cc
@@ -2946,8 +2946,8 @@ void Gambit_fn_0220E8F0(CPUState* cpu) {
         /* 0220E904 */ Gambit_fn_02213074(cpu);
         /* 0220E908 */ _t2 = cpu->r[31] + 0x00000024u;
         /* 0220E908 */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 0220E90C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220E910 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E90C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220E910 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E910 */ _t4 = _t3 & 0x00000001u;
         /* 0220E910 */ if (_t4) goto L_0220E914; else goto L_0220E9C0;
   L_0220E914: ; // 0x220e914
@@ -2978,16 +2978,16 @@ void Gambit_fn_0220E8F0(CPUState* cpu) {
         /* 0220E960 */ _t9 = cpu->r[1] + 0x00000010u;
         /* 0220E960 */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 0220E964 */ Gambit_fn_02022278(cpu);
-        /* 0220E968 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220E96C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E968 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220E96C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E96C */ _t11 = _t10 & 0x00000001u;
         /* 0220E96C */ if (_t11) goto L_0220E99C; else goto L_0220E970;
   L_0220E970: ; // 0x220e970
-        /* 0220E970 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220E970 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220E974 */ cpu->r[12] = cpu->r[31];
         /* 0220E978 */ _t12 = cpu->r[3] + 0x00000000u;
         /* 0220E978 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0220E97C */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E97C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E97C */ _t14 = _t13 & 0x00000001u;
         /* 0220E97C */ if (_t14) goto L_0220E980; else goto L_0220E984;
   L_0220E980: ; // 0x220e980
@@ -2996,18 +2996,18 @@ void Gambit_fn_0220E8F0(CPUState* cpu) {
         /* 0220E984 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0220E984 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 0220E988 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220E988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220E988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220E98C */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220E990 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220E994 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E994 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E994 */ _t17 = _t16 & 0x00000001u;
         /* 0220E994 */ if (_t17) goto L_0220E998; else goto L_0220E93C;
   L_0220E998: ; // 0x220e998
         /* 0220E998 */ goto L_0220E9C0;
   L_0220E99C: ; // 0x220e99c
-        /* 0220E99C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220E99C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220E9A0 */ cpu->r[6] = cpu->r[31];
-        /* 0220E9A4 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220E9A4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220E9A4 */ _t19 = _t18 & 0x00000001u;
         /* 0220E9A4 */ if (_t19) goto L_0220E9A8; else goto L_0220E9AC;
   L_0220E9A8: ; // 0x220e9a8
@@ -3016,10 +3016,10 @@ void Gambit_fn_0220E8F0(CPUState* cpu) {
         /* 0220E9AC */ _t20 = cpu->r[6] + 0x00000000u;
         /* 0220E9AC */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 0220E9B0 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220E9B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220E9B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220E9B4 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220E9B8 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220E9BC */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220E9BC */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220E9BC */ _t22 = _t21 & 0x00000001u;
         /* 0220E9BC */ if (_t22) goto L_0220E9C0; else goto L_0220E93C;
   L_0220E9C0: ; // 0x220e9c0
@@ -3054,9 +3054,9 @@ void Gambit_fn_0220E9D4(CPUState* cpu) {
         /* 0220E9F8 */ Gambit_fn_02019890(cpu);
         /* 0220E9FC */ _t5 = cpu->r[1] + 0x00000008u;
         /* 0220E9FC */ cpu->r[11] = rbrew_read32(cpu->mem, _t5);
-        /* 0220EA00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
+        /* 0220EA00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
         /* 0220EA04 */ cpu->r[3] = cpu->r[31];
-        /* 0220EA08 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220EA08 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220EA08 */ _t7 = _t6 & 0x00000001u;
         /* 0220EA08 */ if (_t7) goto L_0220EA0C; else goto L_0220EA5C;
   L_0220EA0C: ; // 0x220ea0c
@@ -3082,7 +3082,7 @@ void Gambit_fn_0220E9D4(CPUState* cpu) {
         /* 0220EA40 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t13);
         /* 0220EA44 */ _t14 = cpu->r[1] + 0x00000010u;
         /* 0220EA44 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t14);
-        /* 0220EA48 */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220EA48 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220EA48 */ _t16 = _t15 & 0x00000001u;
         /* 0220EA48 */ if (_t16) goto L_0220EA4C; // else: addr-0 trap, fall-through
   L_0220EA4C: ; // 0x220ea4c
@@ -3099,7 +3099,7 @@ void Gambit_fn_0220E9D4(CPUState* cpu) {
         /* 0220EA64 */ cpu->r[31] = rbrew_read32(cpu->mem, _t19);
         /* 0220EA68 */ _t20 = cpu->r[1] + 0x00000010u;
         /* 0220EA68 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t20);
-        /* 0220EA6C */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220EA6C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220EA6C */ _t22 = _t21 & 0x00000001u;
         /* 0220EA6C */ if (_t22) goto L_0220EA70; // else: addr-0 trap, fall-through
   L_0220EA70: ; // 0x220ea70
@@ -3132,9 +3132,9 @@ void Gambit_fn_0220E9D8(CPUState* cpu) {
         /* 0220E9F8 */ Gambit_fn_02019890(cpu);
         /* 0220E9FC */ _t5 = cpu->r[1] + 0x00000008u;
         /* 0220E9FC */ cpu->r[11] = rbrew_read32(cpu->mem, _t5);
-        /* 0220EA00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
+        /* 0220EA00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
         /* 0220EA04 */ cpu->r[3] = cpu->r[31];
-        /* 0220EA08 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220EA08 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220EA08 */ _t7 = _t6 & 0x00000001u;
         /* 0220EA08 */ if (_t7) goto L_0220EA0C; else goto L_0220EA5C;
   L_0220EA0C: ; // 0x220ea0c
@@ -3160,7 +3160,7 @@ void Gambit_fn_0220E9D8(CPUState* cpu) {
         /* 0220EA40 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t13);
         /* 0220EA44 */ _t14 = cpu->r[1] + 0x00000010u;
         /* 0220EA44 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t14);
-        /* 0220EA48 */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220EA48 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220EA48 */ _t16 = _t15 & 0x00000001u;
         /* 0220EA48 */ if (_t16) goto L_0220EA4C; // else: addr-0 trap, fall-through
   L_0220EA4C: ; // 0x220ea4c
@@ -3177,7 +3177,7 @@ void Gambit_fn_0220E9D8(CPUState* cpu) {
         /* 0220EA64 */ cpu->r[31] = rbrew_read32(cpu->mem, _t19);
         /* 0220EA68 */ _t20 = cpu->r[1] + 0x00000010u;
         /* 0220EA68 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t20);
-        /* 0220EA6C */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220EA6C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220EA6C */ _t22 = _t21 & 0x00000001u;
         /* 0220EA6C */ if (_t22) goto L_0220EA70; // else: addr-0 trap, fall-through
   L_0220EA70: ; // 0x220ea70
@@ -3194,9 +3194,9 @@ void Gambit_fn_0220EA80(CPUState* cpu) {
 
   L_0220EA80: ; // 0x220ea80
         /* 0220EA80 */ cpu->r[12] = 0x101E0000u;
-        /* 0220EA84 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 0220EA84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 0220EA88 */ cpu->r[12] = cpu->r[12] + 0x00002A1Cu;
-        /* 0220EA8C */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220EA8C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220EA8C */ _t1 = _t0 & 0x00000001u;
         /* 0220EA8C */ if (_t1) goto L_0220EA90; else goto L_0220EA98;
   L_0220EA90: ; // 0x220ea90
@@ -3237,8 +3237,8 @@ void Gambit_fn_0220EAB4(CPUState* cpu) {
         /* 0220EAC8 */ Gambit_fn_02213074(cpu);
         /* 0220EACC */ _t2 = cpu->r[31] + 0x00000024u;
         /* 0220EACC */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 0220EAD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220EAD4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220EAD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220EAD4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220EAD4 */ _t4 = _t3 & 0x00000001u;
         /* 0220EAD4 */ if (_t4) goto L_0220EAD8; else goto L_0220EB84;
   L_0220EAD8: ; // 0x220ead8
@@ -3269,16 +3269,16 @@ void Gambit_fn_0220EAB4(CPUState* cpu) {
         /* 0220EB24 */ _t9 = cpu->r[1] + 0x00000010u;
         /* 0220EB24 */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 0220EB28 */ Gambit_fn_02022278(cpu);
-        /* 0220EB2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220EB30 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220EB2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220EB30 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220EB30 */ _t11 = _t10 & 0x00000001u;
         /* 0220EB30 */ if (_t11) goto L_0220EB60; else goto L_0220EB34;
   L_0220EB34: ; // 0x220eb34
-        /* 0220EB34 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220EB34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220EB38 */ cpu->r[12] = cpu->r[31];
         /* 0220EB3C */ _t12 = cpu->r[3] + 0x00000000u;
         /* 0220EB3C */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0220EB40 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220EB40 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220EB40 */ _t14 = _t13 & 0x00000001u;
         /* 0220EB40 */ if (_t14) goto L_0220EB44; else goto L_0220EB48;
   L_0220EB44: ; // 0x220eb44
@@ -3287,18 +3287,18 @@ void Gambit_fn_0220EAB4(CPUState* cpu) {
         /* 0220EB48 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0220EB48 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 0220EB4C */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220EB4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220EB4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220EB50 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220EB54 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220EB58 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220EB58 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220EB58 */ _t17 = _t16 & 0x00000001u;
         /* 0220EB58 */ if (_t17) goto L_0220EB5C; else goto L_0220EB00;
   L_0220EB5C: ; // 0x220eb5c
         /* 0220EB5C */ goto L_0220EB84;
   L_0220EB60: ; // 0x220eb60
-        /* 0220EB60 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220EB60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220EB64 */ cpu->r[6] = cpu->r[31];
-        /* 0220EB68 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220EB68 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220EB68 */ _t19 = _t18 & 0x00000001u;
         /* 0220EB68 */ if (_t19) goto L_0220EB6C; else goto L_0220EB70;
   L_0220EB6C: ; // 0x220eb6c
@@ -3307,10 +3307,10 @@ void Gambit_fn_0220EAB4(CPUState* cpu) {
         /* 0220EB70 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 0220EB70 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 0220EB74 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220EB74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220EB74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220EB78 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220EB7C */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220EB80 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220EB80 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220EB80 */ _t22 = _t21 & 0x00000001u;
         /* 0220EB80 */ if (_t22) goto L_0220EB84; else goto L_0220EB00;
   L_0220EB84: ; // 0x220eb84
@@ -3328,9 +3328,9 @@ void Gambit_fn_0220EB98(CPUState* cpu) {
 
   L_0220EB98: ; // 0x220eb98
         /* 0220EB98 */ cpu->r[12] = 0x101E0000u;
-        /* 0220EB9C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 0220EB9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 0220EBA0 */ cpu->r[12] = cpu->r[12] + 0x00002A24u;
-        /* 0220EBA4 */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220EBA4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220EBA4 */ _t1 = _t0 & 0x00000001u;
         /* 0220EBA4 */ if (_t1) goto L_0220EBA8; else goto L_0220EBB0;
   L_0220EBA8: ; // 0x220eba8
@@ -3371,8 +3371,8 @@ void Gambit_fn_0220EBCC(CPUState* cpu) {
         /* 0220EBE0 */ Gambit_fn_02213074(cpu);
         /* 0220EBE4 */ _t2 = cpu->r[31] + 0x00000024u;
         /* 0220EBE4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 0220EBE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220EBEC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220EBE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220EBEC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220EBEC */ _t4 = _t3 & 0x00000001u;
         /* 0220EBEC */ if (_t4) goto L_0220EBF0; else goto L_0220EC9C;
   L_0220EBF0: ; // 0x220ebf0
@@ -3403,16 +3403,16 @@ void Gambit_fn_0220EBCC(CPUState* cpu) {
         /* 0220EC3C */ _t9 = cpu->r[1] + 0x00000010u;
         /* 0220EC3C */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 0220EC40 */ Gambit_fn_02022278(cpu);
-        /* 0220EC44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220EC48 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220EC44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220EC48 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220EC48 */ _t11 = _t10 & 0x00000001u;
         /* 0220EC48 */ if (_t11) goto L_0220EC78; else goto L_0220EC4C;
   L_0220EC4C: ; // 0x220ec4c
-        /* 0220EC4C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220EC4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220EC50 */ cpu->r[12] = cpu->r[31];
         /* 0220EC54 */ _t12 = cpu->r[3] + 0x00000000u;
         /* 0220EC54 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0220EC58 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220EC58 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220EC58 */ _t14 = _t13 & 0x00000001u;
         /* 0220EC58 */ if (_t14) goto L_0220EC5C; else goto L_0220EC60;
   L_0220EC5C: ; // 0x220ec5c
@@ -3421,18 +3421,18 @@ void Gambit_fn_0220EBCC(CPUState* cpu) {
         /* 0220EC60 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0220EC60 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 0220EC64 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220EC64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220EC64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220EC68 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220EC6C */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220EC70 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220EC70 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220EC70 */ _t17 = _t16 & 0x00000001u;
         /* 0220EC70 */ if (_t17) goto L_0220EC74; else goto L_0220EC18;
   L_0220EC74: ; // 0x220ec74
         /* 0220EC74 */ goto L_0220EC9C;
   L_0220EC78: ; // 0x220ec78
-        /* 0220EC78 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220EC78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220EC7C */ cpu->r[6] = cpu->r[31];
-        /* 0220EC80 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220EC80 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220EC80 */ _t19 = _t18 & 0x00000001u;
         /* 0220EC80 */ if (_t19) goto L_0220EC84; else goto L_0220EC88;
   L_0220EC84: ; // 0x220ec84
@@ -3441,10 +3441,10 @@ void Gambit_fn_0220EBCC(CPUState* cpu) {
         /* 0220EC88 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 0220EC88 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 0220EC8C */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220EC8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220EC8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220EC90 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220EC94 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220EC98 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220EC98 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220EC98 */ _t22 = _t21 & 0x00000001u;
         /* 0220EC98 */ if (_t22) goto L_0220EC9C; else goto L_0220EC18;
   L_0220EC9C: ; // 0x220ec9c
@@ -3462,9 +3462,9 @@ void Gambit_fn_0220ECB0(CPUState* cpu) {
 
   L_0220ECB0: ; // 0x220ecb0
         /* 0220ECB0 */ cpu->r[12] = 0x101E0000u;
-        /* 0220ECB4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 0220ECB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 0220ECB8 */ cpu->r[12] = cpu->r[12] + 0x00002A2Cu;
-        /* 0220ECBC */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220ECBC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220ECBC */ _t1 = _t0 & 0x00000001u;
         /* 0220ECBC */ if (_t1) goto L_0220ECC0; else goto L_0220ECC8;
   L_0220ECC0: ; // 0x220ecc0
@@ -3505,8 +3505,8 @@ void Gambit_fn_0220ECE4(CPUState* cpu) {
         /* 0220ECF8 */ Gambit_fn_0220BC1C(cpu);
         /* 0220ECFC */ _t2 = cpu->r[31] + 0x00000024u;
         /* 0220ECFC */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 0220ED00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220ED04 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220ED00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220ED04 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220ED04 */ _t4 = _t3 & 0x00000001u;
         /* 0220ED04 */ if (_t4) goto L_0220ED08; else goto L_0220EDB4;
   L_0220ED08: ; // 0x220ed08
@@ -3537,16 +3537,16 @@ void Gambit_fn_0220ECE4(CPUState* cpu) {
         /* 0220ED54 */ _t9 = cpu->r[1] + 0x00000010u;
         /* 0220ED54 */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 0220ED58 */ Gambit_fn_02022278(cpu);
-        /* 0220ED5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220ED60 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220ED5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220ED60 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220ED60 */ _t11 = _t10 & 0x00000001u;
         /* 0220ED60 */ if (_t11) goto L_0220ED90; else goto L_0220ED64;
   L_0220ED64: ; // 0x220ed64
-        /* 0220ED64 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220ED64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220ED68 */ cpu->r[12] = cpu->r[31];
         /* 0220ED6C */ _t12 = cpu->r[3] + 0x00000000u;
         /* 0220ED6C */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0220ED70 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220ED70 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220ED70 */ _t14 = _t13 & 0x00000001u;
         /* 0220ED70 */ if (_t14) goto L_0220ED74; else goto L_0220ED78;
   L_0220ED74: ; // 0x220ed74
@@ -3555,18 +3555,18 @@ void Gambit_fn_0220ECE4(CPUState* cpu) {
         /* 0220ED78 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0220ED78 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 0220ED7C */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220ED7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220ED7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220ED80 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220ED84 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220ED88 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220ED88 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220ED88 */ _t17 = _t16 & 0x00000001u;
         /* 0220ED88 */ if (_t17) goto L_0220ED8C; else goto L_0220ED30;
   L_0220ED8C: ; // 0x220ed8c
         /* 0220ED8C */ goto L_0220EDB4;
   L_0220ED90: ; // 0x220ed90
-        /* 0220ED90 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220ED90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220ED94 */ cpu->r[6] = cpu->r[31];
-        /* 0220ED98 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220ED98 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220ED98 */ _t19 = _t18 & 0x00000001u;
         /* 0220ED98 */ if (_t19) goto L_0220ED9C; else goto L_0220EDA0;
   L_0220ED9C: ; // 0x220ed9c
@@ -3575,10 +3575,10 @@ void Gambit_fn_0220ECE4(CPUState* cpu) {
         /* 0220EDA0 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 0220EDA0 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 0220EDA4 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220EDA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220EDA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220EDA8 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220EDAC */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220EDB0 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220EDB0 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220EDB0 */ _t22 = _t21 & 0x00000001u;
         /* 0220EDB0 */ if (_t22) goto L_0220EDB4; else goto L_0220ED30;
   L_0220EDB4: ; // 0x220edb4
@@ -3596,9 +3596,9 @@ void Gambit_fn_0220EDC8(CPUState* cpu) {
 
   L_0220EDC8: ; // 0x220edc8
         /* 0220EDC8 */ cpu->r[12] = 0x101E0000u;
-        /* 0220EDCC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 0220EDCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 0220EDD0 */ cpu->r[12] = cpu->r[12] + 0x00002A34u;
-        /* 0220EDD4 */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220EDD4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220EDD4 */ _t1 = _t0 & 0x00000001u;
         /* 0220EDD4 */ if (_t1) goto L_0220EDD8; else goto L_0220EDE0;
   L_0220EDD8: ; // 0x220edd8
@@ -3639,8 +3639,8 @@ void Gambit_fn_0220EDFC(CPUState* cpu) {
         /* 0220EE10 */ Gambit_fn_0220BC1C(cpu);
         /* 0220EE14 */ _t2 = cpu->r[31] + 0x00000024u;
         /* 0220EE14 */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 0220EE18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220EE1C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220EE18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220EE1C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220EE1C */ _t4 = _t3 & 0x00000001u;
         /* 0220EE1C */ if (_t4) goto L_0220EE20; else goto L_0220EECC;
   L_0220EE20: ; // 0x220ee20
@@ -3671,16 +3671,16 @@ void Gambit_fn_0220EDFC(CPUState* cpu) {
         /* 0220EE6C */ _t9 = cpu->r[1] + 0x00000010u;
         /* 0220EE6C */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 0220EE70 */ Gambit_fn_02022278(cpu);
-        /* 0220EE74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220EE78 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220EE74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220EE78 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220EE78 */ _t11 = _t10 & 0x00000001u;
         /* 0220EE78 */ if (_t11) goto L_0220EEA8; else goto L_0220EE7C;
   L_0220EE7C: ; // 0x220ee7c
-        /* 0220EE7C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220EE7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220EE80 */ cpu->r[12] = cpu->r[31];
         /* 0220EE84 */ _t12 = cpu->r[3] + 0x00000000u;
         /* 0220EE84 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0220EE88 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220EE88 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220EE88 */ _t14 = _t13 & 0x00000001u;
         /* 0220EE88 */ if (_t14) goto L_0220EE8C; else goto L_0220EE90;
   L_0220EE8C: ; // 0x220ee8c
@@ -3689,18 +3689,18 @@ void Gambit_fn_0220EDFC(CPUState* cpu) {
         /* 0220EE90 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0220EE90 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 0220EE94 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220EE94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220EE94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220EE98 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220EE9C */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220EEA0 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220EEA0 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220EEA0 */ _t17 = _t16 & 0x00000001u;
         /* 0220EEA0 */ if (_t17) goto L_0220EEA4; else goto L_0220EE48;
   L_0220EEA4: ; // 0x220eea4
         /* 0220EEA4 */ goto L_0220EECC;
   L_0220EEA8: ; // 0x220eea8
-        /* 0220EEA8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220EEA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220EEAC */ cpu->r[6] = cpu->r[31];
-        /* 0220EEB0 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220EEB0 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220EEB0 */ _t19 = _t18 & 0x00000001u;
         /* 0220EEB0 */ if (_t19) goto L_0220EEB4; else goto L_0220EEB8;
   L_0220EEB4: ; // 0x220eeb4
@@ -3709,10 +3709,10 @@ void Gambit_fn_0220EDFC(CPUState* cpu) {
         /* 0220EEB8 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 0220EEB8 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 0220EEBC */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220EEBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220EEBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220EEC0 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220EEC4 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220EEC8 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220EEC8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220EEC8 */ _t22 = _t21 & 0x00000001u;
         /* 0220EEC8 */ if (_t22) goto L_0220EECC; else goto L_0220EE48;
   L_0220EECC: ; // 0x220eecc
@@ -3730,9 +3730,9 @@ void Gambit_fn_0220EEE0(CPUState* cpu) {
 
   L_0220EEE0: ; // 0x220eee0
         /* 0220EEE0 */ cpu->r[12] = 0x101E0000u;
-        /* 0220EEE4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 0220EEE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 0220EEE8 */ cpu->r[12] = cpu->r[12] + 0x00002A3Cu;
-        /* 0220EEEC */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220EEEC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220EEEC */ _t1 = _t0 & 0x00000001u;
         /* 0220EEEC */ if (_t1) goto L_0220EEF0; else goto L_0220EEF8;
   L_0220EEF0: ; // 0x220eef0
@@ -3773,8 +3773,8 @@ void Gambit_fn_0220EF14(CPUState* cpu) {
         /* 0220EF28 */ Gambit_fn_0220BC1C(cpu);
         /* 0220EF2C */ _t2 = cpu->r[31] + 0x00000024u;
         /* 0220EF2C */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 0220EF30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220EF34 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220EF30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220EF34 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220EF34 */ _t4 = _t3 & 0x00000001u;
         /* 0220EF34 */ if (_t4) goto L_0220EF38; else goto L_0220EFE4;
   L_0220EF38: ; // 0x220ef38
@@ -3805,16 +3805,16 @@ void Gambit_fn_0220EF14(CPUState* cpu) {
         /* 0220EF84 */ _t9 = cpu->r[1] + 0x00000010u;
         /* 0220EF84 */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 0220EF88 */ Gambit_fn_02022278(cpu);
-        /* 0220EF8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220EF90 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220EF8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220EF90 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220EF90 */ _t11 = _t10 & 0x00000001u;
         /* 0220EF90 */ if (_t11) goto L_0220EFC0; else goto L_0220EF94;
   L_0220EF94: ; // 0x220ef94
-        /* 0220EF94 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220EF94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220EF98 */ cpu->r[12] = cpu->r[31];
         /* 0220EF9C */ _t12 = cpu->r[3] + 0x00000000u;
         /* 0220EF9C */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0220EFA0 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220EFA0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220EFA0 */ _t14 = _t13 & 0x00000001u;
         /* 0220EFA0 */ if (_t14) goto L_0220EFA4; else goto L_0220EFA8;
   L_0220EFA4: ; // 0x220efa4
@@ -3823,18 +3823,18 @@ void Gambit_fn_0220EF14(CPUState* cpu) {
         /* 0220EFA8 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0220EFA8 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 0220EFAC */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220EFAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220EFAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220EFB0 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220EFB4 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220EFB8 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220EFB8 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220EFB8 */ _t17 = _t16 & 0x00000001u;
         /* 0220EFB8 */ if (_t17) goto L_0220EFBC; else goto L_0220EF60;
   L_0220EFBC: ; // 0x220efbc
         /* 0220EFBC */ goto L_0220EFE4;
   L_0220EFC0: ; // 0x220efc0
-        /* 0220EFC0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220EFC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220EFC4 */ cpu->r[6] = cpu->r[31];
-        /* 0220EFC8 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220EFC8 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220EFC8 */ _t19 = _t18 & 0x00000001u;
         /* 0220EFC8 */ if (_t19) goto L_0220EFCC; else goto L_0220EFD0;
   L_0220EFCC: ; // 0x220efcc
@@ -3843,10 +3843,10 @@ void Gambit_fn_0220EF14(CPUState* cpu) {
         /* 0220EFD0 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 0220EFD0 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 0220EFD4 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220EFD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220EFD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220EFD8 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220EFDC */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220EFE0 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220EFE0 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220EFE0 */ _t22 = _t21 & 0x00000001u;
         /* 0220EFE0 */ if (_t22) goto L_0220EFE4; else goto L_0220EF60;
   L_0220EFE4: ; // 0x220efe4
@@ -3864,9 +3864,9 @@ void Gambit_fn_0220EFF8(CPUState* cpu) {
 
   L_0220EFF8: ; // 0x220eff8
         /* 0220EFF8 */ cpu->r[12] = 0x101E0000u;
-        /* 0220EFFC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 0220EFFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 0220F000 */ cpu->r[12] = cpu->r[12] + 0x00002A44u;
-        /* 0220F004 */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220F004 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220F004 */ _t1 = _t0 & 0x00000001u;
         /* 0220F004 */ if (_t1) goto L_0220F008; else goto L_0220F010;
   L_0220F008: ; // 0x220f008
@@ -3907,8 +3907,8 @@ void Gambit_fn_0220F02C(CPUState* cpu) {
         /* 0220F040 */ Gambit_fn_0220BC1C(cpu);
         /* 0220F044 */ _t2 = cpu->r[31] + 0x00000024u;
         /* 0220F044 */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 0220F048 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220F04C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F048 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220F04C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F04C */ _t4 = _t3 & 0x00000001u;
         /* 0220F04C */ if (_t4) goto L_0220F050; else goto L_0220F0FC;
   L_0220F050: ; // 0x220f050
@@ -3939,16 +3939,16 @@ void Gambit_fn_0220F02C(CPUState* cpu) {
         /* 0220F09C */ _t9 = cpu->r[1] + 0x00000010u;
         /* 0220F09C */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 0220F0A0 */ Gambit_fn_02022278(cpu);
-        /* 0220F0A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220F0A8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F0A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220F0A8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F0A8 */ _t11 = _t10 & 0x00000001u;
         /* 0220F0A8 */ if (_t11) goto L_0220F0D8; else goto L_0220F0AC;
   L_0220F0AC: ; // 0x220f0ac
-        /* 0220F0AC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220F0AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220F0B0 */ cpu->r[12] = cpu->r[31];
         /* 0220F0B4 */ _t12 = cpu->r[3] + 0x00000000u;
         /* 0220F0B4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0220F0B8 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220F0B8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220F0B8 */ _t14 = _t13 & 0x00000001u;
         /* 0220F0B8 */ if (_t14) goto L_0220F0BC; else goto L_0220F0C0;
   L_0220F0BC: ; // 0x220f0bc
@@ -3957,18 +3957,18 @@ void Gambit_fn_0220F02C(CPUState* cpu) {
         /* 0220F0C0 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0220F0C0 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 0220F0C4 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220F0C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220F0C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220F0C8 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220F0CC */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220F0D0 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F0D0 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F0D0 */ _t17 = _t16 & 0x00000001u;
         /* 0220F0D0 */ if (_t17) goto L_0220F0D4; else goto L_0220F078;
   L_0220F0D4: ; // 0x220f0d4
         /* 0220F0D4 */ goto L_0220F0FC;
   L_0220F0D8: ; // 0x220f0d8
-        /* 0220F0D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220F0D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220F0DC */ cpu->r[6] = cpu->r[31];
-        /* 0220F0E0 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220F0E0 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220F0E0 */ _t19 = _t18 & 0x00000001u;
         /* 0220F0E0 */ if (_t19) goto L_0220F0E4; else goto L_0220F0E8;
   L_0220F0E4: ; // 0x220f0e4
@@ -3977,10 +3977,10 @@ void Gambit_fn_0220F02C(CPUState* cpu) {
         /* 0220F0E8 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 0220F0E8 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 0220F0EC */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220F0EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220F0EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220F0F0 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220F0F4 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220F0F8 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F0F8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F0F8 */ _t22 = _t21 & 0x00000001u;
         /* 0220F0F8 */ if (_t22) goto L_0220F0FC; else goto L_0220F078;
   L_0220F0FC: ; // 0x220f0fc
@@ -3998,9 +3998,9 @@ void Gambit_fn_0220F110(CPUState* cpu) {
 
   L_0220F110: ; // 0x220f110
         /* 0220F110 */ cpu->r[12] = 0x101E0000u;
-        /* 0220F114 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x00000004u);
+        /* 0220F114 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x00000004u));
         /* 0220F118 */ cpu->r[12] = cpu->r[12] + 0x00002A4Cu;
-        /* 0220F11C */ _t0 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220F11C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220F11C */ _t1 = _t0 & 0x00000001u;
         /* 0220F11C */ if (_t1) goto L_0220F120; else goto L_0220F128;
   L_0220F120: ; // 0x220f120
@@ -4041,8 +4041,8 @@ void Gambit_fn_0220F144(CPUState* cpu) {
         /* 0220F158 */ Gambit_fn_0220BC1C(cpu);
         /* 0220F15C */ _t2 = cpu->r[31] + 0x00000024u;
         /* 0220F15C */ cpu->r[9] = rbrew_read32(cpu->mem, _t2);
-        /* 0220F160 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0220F164 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F160 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0220F164 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F164 */ _t4 = _t3 & 0x00000001u;
         /* 0220F164 */ if (_t4) goto L_0220F168; else goto L_0220F214;
   L_0220F168: ; // 0x220f168
@@ -4073,16 +4073,16 @@ void Gambit_fn_0220F144(CPUState* cpu) {
         /* 0220F1B4 */ _t9 = cpu->r[1] + 0x00000010u;
         /* 0220F1B4 */ rbrew_write32(cpu->mem, _t9, cpu->r[27]);
         /* 0220F1B8 */ Gambit_fn_02022278(cpu);
-        /* 0220F1BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220F1C0 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F1BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220F1C0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F1C0 */ _t11 = _t10 & 0x00000001u;
         /* 0220F1C0 */ if (_t11) goto L_0220F1F0; else goto L_0220F1C4;
   L_0220F1C4: ; // 0x220f1c4
-        /* 0220F1C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220F1C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220F1C8 */ cpu->r[12] = cpu->r[31];
         /* 0220F1CC */ _t12 = cpu->r[3] + 0x00000000u;
         /* 0220F1CC */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 0220F1D0 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220F1D0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220F1D0 */ _t14 = _t13 & 0x00000001u;
         /* 0220F1D0 */ if (_t14) goto L_0220F1D4; else goto L_0220F1D8;
   L_0220F1D4: ; // 0x220f1d4
@@ -4091,18 +4091,18 @@ void Gambit_fn_0220F144(CPUState* cpu) {
         /* 0220F1D8 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0220F1D8 */ rbrew_write16(cpu->mem, _t15, (uint16_t)cpu->r[0]);
         /* 0220F1DC */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220F1DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220F1DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220F1E0 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220F1E4 */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220F1E8 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F1E8 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F1E8 */ _t17 = _t16 & 0x00000001u;
         /* 0220F1E8 */ if (_t17) goto L_0220F1EC; else goto L_0220F190;
   L_0220F1EC: ; // 0x220f1ec
         /* 0220F1EC */ goto L_0220F214;
   L_0220F1F0: ; // 0x220f1f0
-        /* 0220F1F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000004u);
+        /* 0220F1F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000004u));
         /* 0220F1F4 */ cpu->r[6] = cpu->r[31];
-        /* 0220F1F8 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0220F1F8 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0220F1F8 */ _t19 = _t18 & 0x00000001u;
         /* 0220F1F8 */ if (_t19) goto L_0220F1FC; else goto L_0220F200;
   L_0220F1FC: ; // 0x220f1fc
@@ -4111,10 +4111,10 @@ void Gambit_fn_0220F144(CPUState* cpu) {
         /* 0220F200 */ _t20 = cpu->r[6] + 0x00000000u;
         /* 0220F200 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[25]);
         /* 0220F204 */ cpu->r[29] = cpu->r[29] + 0xFFFFFFFFu;
-        /* 0220F204 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0220F204 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0220F208 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
         /* 0220F20C */ cpu->r[30] = cpu->r[30] + 0x00000002u;
-        /* 0220F210 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F210 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F210 */ _t22 = _t21 & 0x00000001u;
         /* 0220F210 */ if (_t22) goto L_0220F214; else goto L_0220F190;
   L_0220F214: ; // 0x220f214
@@ -4131,15 +4131,15 @@ void Gambit_fn_0220F228(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0220F228: ; // 0x220f228
-        /* 0220F228 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0220F22C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0220F22C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F22C */ _t1 = _t0 & 0x00000001u;
         /* 0220F22C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0220F22C */ goto L_0220F230;
   L_0220F230: ; // 0x220f230
         /* 0220F230 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0220F230 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0220F234 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F230 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0220F234 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F234 */ _t3 = _t2 & 0x00000001u;
         /* 0220F234 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0220F234 */ goto L_0220F238;
@@ -4158,8 +4158,8 @@ void Gambit_fn_0220F228(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4173,15 +4173,15 @@ void Gambit_fn_0220F228(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4266,8 +4266,8 @@ void Gambit_fn_0220F260(CPUState* cpu) {
         /* 0220F260 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0220F260 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0220F264 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 0220F264 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0220F268 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F264 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0220F268 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F268 */ _t2 = _t1 & 0x00000001u;
         /* 0220F268 */ _t3 = _t2 ^ 0x00000001u;
         /* 0220F268 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -4289,8 +4289,8 @@ void Gambit_fn_0220F27C(CPUState* cpu) {
         /* 0220F27C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0220F27C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0220F280 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 0220F280 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0220F284 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F280 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0220F284 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F284 */ _t2 = _t1 & 0x00000001u;
         /* 0220F284 */ _t3 = _t2 ^ 0x00000001u;
         /* 0220F284 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -4312,8 +4312,8 @@ void Gambit_fn_0220F298(CPUState* cpu) {
         /* 0220F298 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0220F298 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0220F29C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 0220F29C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0220F2A0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F29C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0220F2A0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F2A0 */ _t2 = _t1 & 0x00000001u;
         /* 0220F2A0 */ _t3 = _t2 ^ 0x00000001u;
         /* 0220F2A0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -4356,8 +4356,8 @@ void Gambit_fn_0220F2C4(CPUState* cpu) {
         /* 0220F2D4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0220F2D8 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0220F2D8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0220F2DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0220F2E0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F2DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0220F2E0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F2E0 */ _t5 = _t4 & 0x00000001u;
         /* 0220F2E0 */ if (_t5) goto L_0220F2E4; else goto L_0220F300;
   L_0220F2E4: ; // 0x220f2e4
@@ -4396,8 +4396,8 @@ void Gambit_fn_0220F2C8(CPUState* cpu) {
         /* 0220F2D4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0220F2D8 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0220F2D8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0220F2DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0220F2E0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F2DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0220F2E0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F2E0 */ _t5 = _t4 & 0x00000001u;
         /* 0220F2E0 */ if (_t5) goto L_0220F2E4; else goto L_0220F300;
   L_0220F2E4: ; // 0x220f2e4
@@ -4782,8 +4782,8 @@ void Gambit_fn_0220F488(CPUState* cpu) {
         /* 0220F488 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 0220F488 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0220F48C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0220F48C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0220F490 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F48C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0220F490 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F490 */ _t2 = _t1 & 0x00000001u;
         /* 0220F490 */ if (_t2) goto L_0220F4A0; else goto L_0220F494;
   L_0220F494: ; // 0x220f494
@@ -4812,8 +4812,8 @@ void Gambit_fn_0220F4AC(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -4946,9 +4946,9 @@ void Gambit_fn_0220F520(CPUState* cpu) {
         /* 0220F524 */ _t0 = cpu->r[8] + 0xFFFFFCE8u;
         /* 0220F524 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 0220F528 */ cpu->r[6] = 0x101D0000u;
-        /* 0220F52C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0220F52C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0220F530 */ cpu->r[6] = cpu->r[6] + 0xFFFFFED4u;
-        /* 0220F534 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F534 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F534 */ _t2 = _t1 & 0x00000001u;
         /* 0220F534 */ if (_t2) goto L_0220F538; else goto L_0220F550;
   L_0220F538: ; // 0x220f538
@@ -4961,8 +4961,8 @@ void Gambit_fn_0220F520(CPUState* cpu) {
         /* 0220F54C */ _t4 = cpu->r[6] + 0x00000000u;
         /* 0220F54C */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_0220F550: ; // 0x220f550
-        /* 0220F550 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 0220F554 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F550 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 0220F554 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F554 */ _t6 = _t5 & 0x00000001u;
         /* 0220F554 */ if (_t6) goto L_0220F558; else goto L_0220F560;
   L_0220F558: ; // 0x220f558
@@ -4973,9 +4973,9 @@ void Gambit_fn_0220F520(CPUState* cpu) {
         /* 0220F564 */ _t7 = cpu->r[10] + 0xFFFFE610u;
         /* 0220F564 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 0220F568 */ cpu->r[8] = 0x101D0000u;
-        /* 0220F56C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0220F56C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0220F570 */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 0220F574 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F574 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F574 */ _t9 = _t8 & 0x00000001u;
         /* 0220F574 */ if (_t9) goto L_0220F578; else goto L_0220F590;
   L_0220F578: ; // 0x220f578
@@ -4988,8 +4988,8 @@ void Gambit_fn_0220F520(CPUState* cpu) {
         /* 0220F58C */ _t11 = cpu->r[8] + 0x00000000u;
         /* 0220F58C */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_0220F590: ; // 0x220f590
-        /* 0220F590 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 0220F594 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F590 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 0220F594 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F594 */ _t13 = _t12 & 0x00000001u;
         /* 0220F594 */ if (_t13) goto L_0220F598; else goto L_0220F5A0;
   L_0220F598: ; // 0x220f598
@@ -5000,9 +5000,9 @@ void Gambit_fn_0220F520(CPUState* cpu) {
         /* 0220F5A4 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 0220F5A4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 0220F5A8 */ cpu->r[10] = 0x101D0000u;
-        /* 0220F5AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0220F5AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0220F5B0 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 0220F5B4 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F5B4 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F5B4 */ _t16 = _t15 & 0x00000001u;
         /* 0220F5B4 */ if (_t16) goto L_0220F5B8; else goto L_0220F5D0;
   L_0220F5B8: ; // 0x220f5b8
@@ -5015,8 +5015,8 @@ void Gambit_fn_0220F520(CPUState* cpu) {
         /* 0220F5CC */ _t18 = cpu->r[10] + 0x00000000u;
         /* 0220F5CC */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_0220F5D0: ; // 0x220f5d0
-        /* 0220F5D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0220F5D4 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F5D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0220F5D4 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F5D4 */ _t20 = _t19 & 0x00000001u;
         /* 0220F5D4 */ if (_t20) goto L_0220F5D8; else goto L_0220F5E0;
   L_0220F5D8: ; // 0x220f5d8
@@ -5027,9 +5027,9 @@ void Gambit_fn_0220F520(CPUState* cpu) {
         /* 0220F5E4 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 0220F5E4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 0220F5E8 */ cpu->r[12] = 0x101D0000u;
-        /* 0220F5EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220F5EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220F5F0 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 0220F5F4 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F5F4 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F5F4 */ _t23 = _t22 & 0x00000001u;
         /* 0220F5F4 */ if (_t23) goto L_0220F5F8; else goto L_0220F610;
   L_0220F5F8: ; // 0x220f5f8
@@ -5042,8 +5042,8 @@ void Gambit_fn_0220F520(CPUState* cpu) {
         /* 0220F60C */ _t25 = cpu->r[12] + 0x00000000u;
         /* 0220F60C */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_0220F610: ; // 0x220f610
-        /* 0220F610 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0220F614 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F610 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0220F614 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F614 */ _t27 = _t26 & 0x00000001u;
         /* 0220F614 */ if (_t27) goto L_0220F618; else goto L_0220F620;
   L_0220F618: ; // 0x220f618
@@ -5055,9 +5055,9 @@ void Gambit_fn_0220F520(CPUState* cpu) {
         /* 0220F624 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 0220F624 */ cpu->r[10] = _t28;
         /* 0220F628 */ cpu->r[7] = 0x101D0000u;
-        /* 0220F62C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220F62C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220F630 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 0220F634 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F634 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F634 */ _t30 = _t29 & 0x00000001u;
         /* 0220F634 */ if (_t30) goto L_0220F638; else goto L_0220F64C;
   L_0220F638: ; // 0x220f638
@@ -5069,8 +5069,8 @@ void Gambit_fn_0220F520(CPUState* cpu) {
         /* 0220F648 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 0220F648 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_0220F64C: ; // 0x220f64c
-        /* 0220F64C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 0220F650 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F64C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 0220F650 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F650 */ _t34 = _t33 & 0x00000001u;
         /* 0220F650 */ if (_t34) goto L_0220F654; else goto L_0220F65C;
   L_0220F654: ; // 0x220f654
@@ -5082,9 +5082,9 @@ void Gambit_fn_0220F520(CPUState* cpu) {
         /* 0220F660 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 0220F660 */ cpu->r[8] = _t35;
         /* 0220F664 */ cpu->r[6] = 0x101D0000u;
-        /* 0220F668 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0220F668 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0220F66C */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 0220F670 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F670 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F670 */ _t37 = _t36 & 0x00000001u;
         /* 0220F670 */ if (_t37) goto L_0220F674; else goto L_0220F688;
   L_0220F674: ; // 0x220f674
@@ -5123,9 +5123,9 @@ void Gambit_fn_0220F6AC(CPUState* cpu) {
         /* 0220F6B0 */ _t0 = cpu->r[8] + 0xFFFFFCECu;
         /* 0220F6B0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 0220F6B4 */ cpu->r[6] = 0x101D0000u;
-        /* 0220F6B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0220F6B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0220F6BC */ cpu->r[6] = cpu->r[6] + 0xFFFFFED8u;
-        /* 0220F6C0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F6C0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F6C0 */ _t2 = _t1 & 0x00000001u;
         /* 0220F6C0 */ if (_t2) goto L_0220F6C4; else goto L_0220F6DC;
   L_0220F6C4: ; // 0x220f6c4
@@ -5138,8 +5138,8 @@ void Gambit_fn_0220F6AC(CPUState* cpu) {
         /* 0220F6D8 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 0220F6D8 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_0220F6DC: ; // 0x220f6dc
-        /* 0220F6DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 0220F6E0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F6DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 0220F6E0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F6E0 */ _t6 = _t5 & 0x00000001u;
         /* 0220F6E0 */ if (_t6) goto L_0220F6E4; else goto L_0220F6EC;
   L_0220F6E4: ; // 0x220f6e4
@@ -5150,9 +5150,9 @@ void Gambit_fn_0220F6AC(CPUState* cpu) {
         /* 0220F6F0 */ _t7 = cpu->r[10] + 0xFFFFE610u;
         /* 0220F6F0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 0220F6F4 */ cpu->r[8] = 0x101D0000u;
-        /* 0220F6F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0220F6F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0220F6FC */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 0220F700 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F700 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F700 */ _t9 = _t8 & 0x00000001u;
         /* 0220F700 */ if (_t9) goto L_0220F704; else goto L_0220F71C;
   L_0220F704: ; // 0x220f704
@@ -5165,8 +5165,8 @@ void Gambit_fn_0220F6AC(CPUState* cpu) {
         /* 0220F718 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 0220F718 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_0220F71C: ; // 0x220f71c
-        /* 0220F71C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 0220F720 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F71C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 0220F720 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F720 */ _t13 = _t12 & 0x00000001u;
         /* 0220F720 */ if (_t13) goto L_0220F724; else goto L_0220F72C;
   L_0220F724: ; // 0x220f724
@@ -5177,9 +5177,9 @@ void Gambit_fn_0220F6AC(CPUState* cpu) {
         /* 0220F730 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 0220F730 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 0220F734 */ cpu->r[10] = 0x101D0000u;
-        /* 0220F738 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0220F738 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0220F73C */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 0220F740 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F740 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F740 */ _t16 = _t15 & 0x00000001u;
         /* 0220F740 */ if (_t16) goto L_0220F744; else goto L_0220F75C;
   L_0220F744: ; // 0x220f744
@@ -5192,8 +5192,8 @@ void Gambit_fn_0220F6AC(CPUState* cpu) {
         /* 0220F758 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 0220F758 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_0220F75C: ; // 0x220f75c
-        /* 0220F75C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0220F760 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F75C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0220F760 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F760 */ _t20 = _t19 & 0x00000001u;
         /* 0220F760 */ if (_t20) goto L_0220F764; else goto L_0220F76C;
   L_0220F764: ; // 0x220f764
@@ -5204,9 +5204,9 @@ void Gambit_fn_0220F6AC(CPUState* cpu) {
         /* 0220F770 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 0220F770 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 0220F774 */ cpu->r[12] = 0x101D0000u;
-        /* 0220F778 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220F778 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220F77C */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 0220F780 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F780 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F780 */ _t23 = _t22 & 0x00000001u;
         /* 0220F780 */ if (_t23) goto L_0220F784; else goto L_0220F79C;
   L_0220F784: ; // 0x220f784
@@ -5219,8 +5219,8 @@ void Gambit_fn_0220F6AC(CPUState* cpu) {
         /* 0220F798 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 0220F798 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_0220F79C: ; // 0x220f79c
-        /* 0220F79C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0220F7A0 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F79C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0220F7A0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F7A0 */ _t27 = _t26 & 0x00000001u;
         /* 0220F7A0 */ if (_t27) goto L_0220F7A4; else goto L_0220F7AC;
   L_0220F7A4: ; // 0x220f7a4
@@ -5232,9 +5232,9 @@ void Gambit_fn_0220F6AC(CPUState* cpu) {
         /* 0220F7B0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 0220F7B0 */ cpu->r[10] = _t28;
         /* 0220F7B4 */ cpu->r[7] = 0x101D0000u;
-        /* 0220F7B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220F7B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220F7BC */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 0220F7C0 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F7C0 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F7C0 */ _t30 = _t29 & 0x00000001u;
         /* 0220F7C0 */ if (_t30) goto L_0220F7C4; else goto L_0220F7D8;
   L_0220F7C4: ; // 0x220f7c4
@@ -5246,8 +5246,8 @@ void Gambit_fn_0220F6AC(CPUState* cpu) {
         /* 0220F7D4 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 0220F7D4 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_0220F7D8: ; // 0x220f7d8
-        /* 0220F7D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 0220F7DC */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F7D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 0220F7DC */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F7DC */ _t34 = _t33 & 0x00000001u;
         /* 0220F7DC */ if (_t34) goto L_0220F7E0; else goto L_0220F7E8;
   L_0220F7E0: ; // 0x220f7e0
@@ -5259,9 +5259,9 @@ void Gambit_fn_0220F6AC(CPUState* cpu) {
         /* 0220F7EC */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 0220F7EC */ cpu->r[8] = _t35;
         /* 0220F7F0 */ cpu->r[6] = 0x101D0000u;
-        /* 0220F7F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0220F7F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0220F7F8 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 0220F7FC */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F7FC */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F7FC */ _t37 = _t36 & 0x00000001u;
         /* 0220F7FC */ if (_t37) goto L_0220F800; else goto L_0220F814;
   L_0220F800: ; // 0x220f800
@@ -5300,9 +5300,9 @@ void Gambit_fn_0220F838(CPUState* cpu) {
         /* 0220F83C */ _t0 = cpu->r[8] + 0xFFFFFCF0u;
         /* 0220F83C */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 0220F840 */ cpu->r[6] = 0x101D0000u;
-        /* 0220F844 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0220F844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0220F848 */ cpu->r[6] = cpu->r[6] + 0xFFFFFEDCu;
-        /* 0220F84C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F84C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F84C */ _t2 = _t1 & 0x00000001u;
         /* 0220F84C */ if (_t2) goto L_0220F850; else goto L_0220F868;
   L_0220F850: ; // 0x220f850
@@ -5315,8 +5315,8 @@ void Gambit_fn_0220F838(CPUState* cpu) {
         /* 0220F864 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 0220F864 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_0220F868: ; // 0x220f868
-        /* 0220F868 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 0220F86C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F868 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 0220F86C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F86C */ _t6 = _t5 & 0x00000001u;
         /* 0220F86C */ if (_t6) goto L_0220F870; else goto L_0220F878;
   L_0220F870: ; // 0x220f870
@@ -5327,9 +5327,9 @@ void Gambit_fn_0220F838(CPUState* cpu) {
         /* 0220F87C */ _t7 = cpu->r[10] + 0xFFFFE610u;
         /* 0220F87C */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 0220F880 */ cpu->r[8] = 0x101D0000u;
-        /* 0220F884 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0220F884 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0220F888 */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 0220F88C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F88C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F88C */ _t9 = _t8 & 0x00000001u;
         /* 0220F88C */ if (_t9) goto L_0220F890; else goto L_0220F8A8;
   L_0220F890: ; // 0x220f890
@@ -5342,8 +5342,8 @@ void Gambit_fn_0220F838(CPUState* cpu) {
         /* 0220F8A4 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 0220F8A4 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_0220F8A8: ; // 0x220f8a8
-        /* 0220F8A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 0220F8AC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F8A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 0220F8AC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F8AC */ _t13 = _t12 & 0x00000001u;
         /* 0220F8AC */ if (_t13) goto L_0220F8B0; else goto L_0220F8B8;
   L_0220F8B0: ; // 0x220f8b0
@@ -5354,9 +5354,9 @@ void Gambit_fn_0220F838(CPUState* cpu) {
         /* 0220F8BC */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 0220F8BC */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 0220F8C0 */ cpu->r[10] = 0x101D0000u;
-        /* 0220F8C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0220F8C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0220F8C8 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 0220F8CC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F8CC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F8CC */ _t16 = _t15 & 0x00000001u;
         /* 0220F8CC */ if (_t16) goto L_0220F8D0; else goto L_0220F8E8;
   L_0220F8D0: ; // 0x220f8d0
@@ -5369,8 +5369,8 @@ void Gambit_fn_0220F838(CPUState* cpu) {
         /* 0220F8E4 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 0220F8E4 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_0220F8E8: ; // 0x220f8e8
-        /* 0220F8E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0220F8EC */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F8E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0220F8EC */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F8EC */ _t20 = _t19 & 0x00000001u;
         /* 0220F8EC */ if (_t20) goto L_0220F8F0; else goto L_0220F8F8;
   L_0220F8F0: ; // 0x220f8f0
@@ -5381,9 +5381,9 @@ void Gambit_fn_0220F838(CPUState* cpu) {
         /* 0220F8FC */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 0220F8FC */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 0220F900 */ cpu->r[12] = 0x101D0000u;
-        /* 0220F904 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220F904 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220F908 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 0220F90C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F90C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F90C */ _t23 = _t22 & 0x00000001u;
         /* 0220F90C */ if (_t23) goto L_0220F910; else goto L_0220F928;
   L_0220F910: ; // 0x220f910
@@ -5396,8 +5396,8 @@ void Gambit_fn_0220F838(CPUState* cpu) {
         /* 0220F924 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 0220F924 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_0220F928: ; // 0x220f928
-        /* 0220F928 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0220F92C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F928 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0220F92C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F92C */ _t27 = _t26 & 0x00000001u;
         /* 0220F92C */ if (_t27) goto L_0220F930; else goto L_0220F938;
   L_0220F930: ; // 0x220f930
@@ -5409,9 +5409,9 @@ void Gambit_fn_0220F838(CPUState* cpu) {
         /* 0220F93C */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 0220F93C */ cpu->r[10] = _t28;
         /* 0220F940 */ cpu->r[7] = 0x101D0000u;
-        /* 0220F944 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220F944 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220F948 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 0220F94C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F94C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F94C */ _t30 = _t29 & 0x00000001u;
         /* 0220F94C */ if (_t30) goto L_0220F950; else goto L_0220F964;
   L_0220F950: ; // 0x220f950
@@ -5423,8 +5423,8 @@ void Gambit_fn_0220F838(CPUState* cpu) {
         /* 0220F960 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 0220F960 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_0220F964: ; // 0x220f964
-        /* 0220F964 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 0220F968 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F964 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 0220F968 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F968 */ _t34 = _t33 & 0x00000001u;
         /* 0220F968 */ if (_t34) goto L_0220F96C; else goto L_0220F974;
   L_0220F96C: ; // 0x220f96c
@@ -5436,9 +5436,9 @@ void Gambit_fn_0220F838(CPUState* cpu) {
         /* 0220F978 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 0220F978 */ cpu->r[8] = _t35;
         /* 0220F97C */ cpu->r[6] = 0x101D0000u;
-        /* 0220F980 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0220F980 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0220F984 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 0220F988 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F988 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F988 */ _t37 = _t36 & 0x00000001u;
         /* 0220F988 */ if (_t37) goto L_0220F98C; else goto L_0220F9A0;
   L_0220F98C: ; // 0x220f98c
@@ -5477,9 +5477,9 @@ void Gambit_fn_0220F9C4(CPUState* cpu) {
         /* 0220F9C8 */ _t0 = cpu->r[8] + 0xFFFFFCF4u;
         /* 0220F9C8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 0220F9CC */ cpu->r[6] = 0x101D0000u;
-        /* 0220F9D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0220F9D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0220F9D4 */ cpu->r[6] = cpu->r[6] + 0xFFFFFEE0u;
-        /* 0220F9D8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F9D8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F9D8 */ _t2 = _t1 & 0x00000001u;
         /* 0220F9D8 */ if (_t2) goto L_0220F9DC; else goto L_0220F9F4;
   L_0220F9DC: ; // 0x220f9dc
@@ -5492,8 +5492,8 @@ void Gambit_fn_0220F9C4(CPUState* cpu) {
         /* 0220F9F0 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 0220F9F0 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_0220F9F4: ; // 0x220f9f4
-        /* 0220F9F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 0220F9F8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220F9F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 0220F9F8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220F9F8 */ _t6 = _t5 & 0x00000001u;
         /* 0220F9F8 */ if (_t6) goto L_0220F9FC; else goto L_0220FA04;
   L_0220F9FC: ; // 0x220f9fc
@@ -5504,9 +5504,9 @@ void Gambit_fn_0220F9C4(CPUState* cpu) {
         /* 0220FA08 */ _t7 = cpu->r[10] + 0xFFFFE610u;
         /* 0220FA08 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 0220FA0C */ cpu->r[8] = 0x101D0000u;
-        /* 0220FA10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0220FA10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0220FA14 */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 0220FA18 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FA18 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FA18 */ _t9 = _t8 & 0x00000001u;
         /* 0220FA18 */ if (_t9) goto L_0220FA1C; else goto L_0220FA34;
   L_0220FA1C: ; // 0x220fa1c
@@ -5519,8 +5519,8 @@ void Gambit_fn_0220F9C4(CPUState* cpu) {
         /* 0220FA30 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 0220FA30 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_0220FA34: ; // 0x220fa34
-        /* 0220FA34 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 0220FA38 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FA34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 0220FA38 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FA38 */ _t13 = _t12 & 0x00000001u;
         /* 0220FA38 */ if (_t13) goto L_0220FA3C; else goto L_0220FA44;
   L_0220FA3C: ; // 0x220fa3c
@@ -5531,9 +5531,9 @@ void Gambit_fn_0220F9C4(CPUState* cpu) {
         /* 0220FA48 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 0220FA48 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 0220FA4C */ cpu->r[10] = 0x101D0000u;
-        /* 0220FA50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0220FA50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0220FA54 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 0220FA58 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FA58 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FA58 */ _t16 = _t15 & 0x00000001u;
         /* 0220FA58 */ if (_t16) goto L_0220FA5C; else goto L_0220FA74;
   L_0220FA5C: ; // 0x220fa5c
@@ -5546,8 +5546,8 @@ void Gambit_fn_0220F9C4(CPUState* cpu) {
         /* 0220FA70 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 0220FA70 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_0220FA74: ; // 0x220fa74
-        /* 0220FA74 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0220FA78 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FA74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0220FA78 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FA78 */ _t20 = _t19 & 0x00000001u;
         /* 0220FA78 */ if (_t20) goto L_0220FA7C; else goto L_0220FA84;
   L_0220FA7C: ; // 0x220fa7c
@@ -5558,9 +5558,9 @@ void Gambit_fn_0220F9C4(CPUState* cpu) {
         /* 0220FA88 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 0220FA88 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 0220FA8C */ cpu->r[12] = 0x101D0000u;
-        /* 0220FA90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220FA90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220FA94 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 0220FA98 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FA98 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FA98 */ _t23 = _t22 & 0x00000001u;
         /* 0220FA98 */ if (_t23) goto L_0220FA9C; else goto L_0220FAB4;
   L_0220FA9C: ; // 0x220fa9c
@@ -5573,8 +5573,8 @@ void Gambit_fn_0220F9C4(CPUState* cpu) {
         /* 0220FAB0 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 0220FAB0 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_0220FAB4: ; // 0x220fab4
-        /* 0220FAB4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0220FAB8 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FAB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0220FAB8 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FAB8 */ _t27 = _t26 & 0x00000001u;
         /* 0220FAB8 */ if (_t27) goto L_0220FABC; else goto L_0220FAC4;
   L_0220FABC: ; // 0x220fabc
@@ -5586,9 +5586,9 @@ void Gambit_fn_0220F9C4(CPUState* cpu) {
         /* 0220FAC8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 0220FAC8 */ cpu->r[10] = _t28;
         /* 0220FACC */ cpu->r[7] = 0x101D0000u;
-        /* 0220FAD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220FAD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220FAD4 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 0220FAD8 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FAD8 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FAD8 */ _t30 = _t29 & 0x00000001u;
         /* 0220FAD8 */ if (_t30) goto L_0220FADC; else goto L_0220FAF0;
   L_0220FADC: ; // 0x220fadc
@@ -5600,8 +5600,8 @@ void Gambit_fn_0220F9C4(CPUState* cpu) {
         /* 0220FAEC */ _t32 = cpu->r[7] + 0x00000000u;
         /* 0220FAEC */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_0220FAF0: ; // 0x220faf0
-        /* 0220FAF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 0220FAF4 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FAF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 0220FAF4 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FAF4 */ _t34 = _t33 & 0x00000001u;
         /* 0220FAF4 */ if (_t34) goto L_0220FAF8; else goto L_0220FB00;
   L_0220FAF8: ; // 0x220faf8
@@ -5613,9 +5613,9 @@ void Gambit_fn_0220F9C4(CPUState* cpu) {
         /* 0220FB04 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 0220FB04 */ cpu->r[8] = _t35;
         /* 0220FB08 */ cpu->r[6] = 0x101D0000u;
-        /* 0220FB0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0220FB0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0220FB10 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 0220FB14 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FB14 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FB14 */ _t37 = _t36 & 0x00000001u;
         /* 0220FB14 */ if (_t37) goto L_0220FB18; else goto L_0220FB2C;
   L_0220FB18: ; // 0x220fb18
@@ -5643,7 +5643,7 @@ void Gambit_fn_0220FA14(CPUState* cpu) {
 
   L_0220FA14: ; // 0x220fa14
         /* 0220FA14 */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 0220FA18 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FA18 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FA18 */ _t1 = _t0 & 0x00000001u;
         /* 0220FA18 */ if (_t1) goto L_0220FA1C; else goto L_0220FA34;
   L_0220FA1C: ; // 0x220fa1c
@@ -5656,8 +5656,8 @@ void Gambit_fn_0220FA14(CPUState* cpu) {
         /* 0220FA30 */ _t3 = cpu->r[8] + 0x00000000u;
         /* 0220FA30 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
   L_0220FA34: ; // 0x220fa34
-        /* 0220FA34 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 0220FA38 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FA34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 0220FA38 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FA38 */ _t5 = _t4 & 0x00000001u;
         /* 0220FA38 */ if (_t5) goto L_0220FA3C; else goto L_0220FA44;
   L_0220FA3C: ; // 0x220fa3c
@@ -5668,9 +5668,9 @@ void Gambit_fn_0220FA14(CPUState* cpu) {
         /* 0220FA48 */ _t6 = cpu->r[12] + 0xFFFFDA00u;
         /* 0220FA48 */ cpu->r[12] = rbrew_read32(cpu->mem, _t6);
         /* 0220FA4C */ cpu->r[10] = 0x101D0000u;
-        /* 0220FA50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0220FA50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0220FA54 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 0220FA58 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FA58 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FA58 */ _t8 = _t7 & 0x00000001u;
         /* 0220FA58 */ if (_t8) goto L_0220FA5C; else goto L_0220FA74;
   L_0220FA5C: ; // 0x220fa5c
@@ -5683,8 +5683,8 @@ void Gambit_fn_0220FA14(CPUState* cpu) {
         /* 0220FA70 */ _t10 = cpu->r[10] + 0x00000000u;
         /* 0220FA70 */ rbrew_write32(cpu->mem, _t10, cpu->r[7]);
   L_0220FA74: ; // 0x220fa74
-        /* 0220FA74 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0220FA78 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FA74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0220FA78 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FA78 */ _t12 = _t11 & 0x00000001u;
         /* 0220FA78 */ if (_t12) goto L_0220FA7C; else goto L_0220FA84;
   L_0220FA7C: ; // 0x220fa7c
@@ -5695,9 +5695,9 @@ void Gambit_fn_0220FA14(CPUState* cpu) {
         /* 0220FA88 */ _t13 = cpu->r[11] + 0xFFFFD9ECu;
         /* 0220FA88 */ cpu->r[11] = rbrew_read32(cpu->mem, _t13);
         /* 0220FA8C */ cpu->r[12] = 0x101D0000u;
-        /* 0220FA90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220FA90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220FA94 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 0220FA98 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FA98 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FA98 */ _t15 = _t14 & 0x00000001u;
         /* 0220FA98 */ if (_t15) goto L_0220FA9C; else goto L_0220FAB4;
   L_0220FA9C: ; // 0x220fa9c
@@ -5710,8 +5710,8 @@ void Gambit_fn_0220FA14(CPUState* cpu) {
         /* 0220FAB0 */ _t17 = cpu->r[12] + 0x00000000u;
         /* 0220FAB0 */ rbrew_write32(cpu->mem, _t17, cpu->r[10]);
   L_0220FAB4: ; // 0x220fab4
-        /* 0220FAB4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0220FAB8 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FAB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0220FAB8 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FAB8 */ _t19 = _t18 & 0x00000001u;
         /* 0220FAB8 */ if (_t19) goto L_0220FABC; else goto L_0220FAC4;
   L_0220FABC: ; // 0x220fabc
@@ -5723,9 +5723,9 @@ void Gambit_fn_0220FA14(CPUState* cpu) {
         /* 0220FAC8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t20);
         /* 0220FAC8 */ cpu->r[10] = _t20;
         /* 0220FACC */ cpu->r[7] = 0x101D0000u;
-        /* 0220FAD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220FAD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220FAD4 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 0220FAD8 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FAD8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FAD8 */ _t22 = _t21 & 0x00000001u;
         /* 0220FAD8 */ if (_t22) goto L_0220FADC; else goto L_0220FAF0;
   L_0220FADC: ; // 0x220fadc
@@ -5737,8 +5737,8 @@ void Gambit_fn_0220FA14(CPUState* cpu) {
         /* 0220FAEC */ _t24 = cpu->r[7] + 0x00000000u;
         /* 0220FAEC */ rbrew_write32(cpu->mem, _t24, cpu->r[0]);
   L_0220FAF0: ; // 0x220faf0
-        /* 0220FAF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 0220FAF4 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FAF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 0220FAF4 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FAF4 */ _t26 = _t25 & 0x00000001u;
         /* 0220FAF4 */ if (_t26) goto L_0220FAF8; else goto L_0220FB00;
   L_0220FAF8: ; // 0x220faf8
@@ -5750,9 +5750,9 @@ void Gambit_fn_0220FA14(CPUState* cpu) {
         /* 0220FB04 */ cpu->r[5] = rbrew_read32(cpu->mem, _t27);
         /* 0220FB04 */ cpu->r[8] = _t27;
         /* 0220FB08 */ cpu->r[6] = 0x101D0000u;
-        /* 0220FB0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0220FB0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0220FB10 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 0220FB14 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FB14 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FB14 */ _t29 = _t28 & 0x00000001u;
         /* 0220FB14 */ if (_t29) goto L_0220FB18; else goto L_0220FB2C;
   L_0220FB18: ; // 0x220fb18
@@ -5791,9 +5791,9 @@ void Gambit_fn_0220FB50(CPUState* cpu) {
         /* 0220FB54 */ _t0 = cpu->r[8] + 0xFFFFFCF8u;
         /* 0220FB54 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 0220FB58 */ cpu->r[6] = 0x101D0000u;
-        /* 0220FB5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0220FB5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0220FB60 */ cpu->r[6] = cpu->r[6] + 0xFFFFFEE4u;
-        /* 0220FB64 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FB64 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FB64 */ _t2 = _t1 & 0x00000001u;
         /* 0220FB64 */ if (_t2) goto L_0220FB68; else goto L_0220FB80;
   L_0220FB68: ; // 0x220fb68
@@ -5806,8 +5806,8 @@ void Gambit_fn_0220FB50(CPUState* cpu) {
         /* 0220FB7C */ _t4 = cpu->r[6] + 0x00000000u;
         /* 0220FB7C */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_0220FB80: ; // 0x220fb80
-        /* 0220FB80 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 0220FB84 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FB80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 0220FB84 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FB84 */ _t6 = _t5 & 0x00000001u;
         /* 0220FB84 */ if (_t6) goto L_0220FB88; else goto L_0220FB90;
   L_0220FB88: ; // 0x220fb88
@@ -5818,9 +5818,9 @@ void Gambit_fn_0220FB50(CPUState* cpu) {
         /* 0220FB94 */ _t7 = cpu->r[10] + 0xFFFFE610u;
         /* 0220FB94 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 0220FB98 */ cpu->r[8] = 0x101D0000u;
-        /* 0220FB9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0220FB9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0220FBA0 */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 0220FBA4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FBA4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FBA4 */ _t9 = _t8 & 0x00000001u;
         /* 0220FBA4 */ if (_t9) goto L_0220FBA8; else goto L_0220FBC0;
   L_0220FBA8: ; // 0x220fba8
@@ -5833,8 +5833,8 @@ void Gambit_fn_0220FB50(CPUState* cpu) {
         /* 0220FBBC */ _t11 = cpu->r[8] + 0x00000000u;
         /* 0220FBBC */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_0220FBC0: ; // 0x220fbc0
-        /* 0220FBC0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 0220FBC4 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FBC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 0220FBC4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FBC4 */ _t13 = _t12 & 0x00000001u;
         /* 0220FBC4 */ if (_t13) goto L_0220FBC8; else goto L_0220FBD0;
   L_0220FBC8: ; // 0x220fbc8
@@ -5845,9 +5845,9 @@ void Gambit_fn_0220FB50(CPUState* cpu) {
         /* 0220FBD4 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 0220FBD4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 0220FBD8 */ cpu->r[10] = 0x101D0000u;
-        /* 0220FBDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0220FBDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0220FBE0 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 0220FBE4 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FBE4 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FBE4 */ _t16 = _t15 & 0x00000001u;
         /* 0220FBE4 */ if (_t16) goto L_0220FBE8; else goto L_0220FC00;
   L_0220FBE8: ; // 0x220fbe8
@@ -5860,8 +5860,8 @@ void Gambit_fn_0220FB50(CPUState* cpu) {
         /* 0220FBFC */ _t18 = cpu->r[10] + 0x00000000u;
         /* 0220FBFC */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_0220FC00: ; // 0x220fc00
-        /* 0220FC00 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0220FC04 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FC00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0220FC04 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FC04 */ _t20 = _t19 & 0x00000001u;
         /* 0220FC04 */ if (_t20) goto L_0220FC08; else goto L_0220FC10;
   L_0220FC08: ; // 0x220fc08
@@ -5872,9 +5872,9 @@ void Gambit_fn_0220FB50(CPUState* cpu) {
         /* 0220FC14 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 0220FC14 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 0220FC18 */ cpu->r[12] = 0x101D0000u;
-        /* 0220FC1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220FC1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220FC20 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 0220FC24 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FC24 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FC24 */ _t23 = _t22 & 0x00000001u;
         /* 0220FC24 */ if (_t23) goto L_0220FC28; else goto L_0220FC40;
   L_0220FC28: ; // 0x220fc28
@@ -5887,8 +5887,8 @@ void Gambit_fn_0220FB50(CPUState* cpu) {
         /* 0220FC3C */ _t25 = cpu->r[12] + 0x00000000u;
         /* 0220FC3C */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_0220FC40: ; // 0x220fc40
-        /* 0220FC40 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0220FC44 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FC40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0220FC44 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FC44 */ _t27 = _t26 & 0x00000001u;
         /* 0220FC44 */ if (_t27) goto L_0220FC48; else goto L_0220FC50;
   L_0220FC48: ; // 0x220fc48
@@ -5900,9 +5900,9 @@ void Gambit_fn_0220FB50(CPUState* cpu) {
         /* 0220FC54 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 0220FC54 */ cpu->r[10] = _t28;
         /* 0220FC58 */ cpu->r[7] = 0x101D0000u;
-        /* 0220FC5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220FC5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220FC60 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 0220FC64 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FC64 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FC64 */ _t30 = _t29 & 0x00000001u;
         /* 0220FC64 */ if (_t30) goto L_0220FC68; else goto L_0220FC7C;
   L_0220FC68: ; // 0x220fc68
@@ -5914,8 +5914,8 @@ void Gambit_fn_0220FB50(CPUState* cpu) {
         /* 0220FC78 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 0220FC78 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_0220FC7C: ; // 0x220fc7c
-        /* 0220FC7C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 0220FC80 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FC7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 0220FC80 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FC80 */ _t34 = _t33 & 0x00000001u;
         /* 0220FC80 */ if (_t34) goto L_0220FC84; else goto L_0220FC8C;
   L_0220FC84: ; // 0x220fc84
@@ -5927,9 +5927,9 @@ void Gambit_fn_0220FB50(CPUState* cpu) {
         /* 0220FC90 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 0220FC90 */ cpu->r[8] = _t35;
         /* 0220FC94 */ cpu->r[6] = 0x101D0000u;
-        /* 0220FC98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0220FC98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0220FC9C */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 0220FCA0 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FCA0 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FCA0 */ _t37 = _t36 & 0x00000001u;
         /* 0220FCA0 */ if (_t37) goto L_0220FCA4; else goto L_0220FCB8;
   L_0220FCA4: ; // 0x220fca4
@@ -5968,9 +5968,9 @@ void Gambit_fn_0220FCDC(CPUState* cpu) {
         /* 0220FCE0 */ _t0 = cpu->r[8] + 0xFFFFFCFCu;
         /* 0220FCE0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 0220FCE4 */ cpu->r[6] = 0x101D0000u;
-        /* 0220FCE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0220FCE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0220FCEC */ cpu->r[6] = cpu->r[6] + 0xFFFFFEE8u;
-        /* 0220FCF0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FCF0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FCF0 */ _t2 = _t1 & 0x00000001u;
         /* 0220FCF0 */ if (_t2) goto L_0220FCF4; else goto L_0220FD0C;
   L_0220FCF4: ; // 0x220fcf4
@@ -5983,8 +5983,8 @@ void Gambit_fn_0220FCDC(CPUState* cpu) {
         /* 0220FD08 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 0220FD08 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_0220FD0C: ; // 0x220fd0c
-        /* 0220FD0C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 0220FD10 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FD0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 0220FD10 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FD10 */ _t6 = _t5 & 0x00000001u;
         /* 0220FD10 */ if (_t6) goto L_0220FD14; else goto L_0220FD1C;
   L_0220FD14: ; // 0x220fd14
@@ -5995,9 +5995,9 @@ void Gambit_fn_0220FCDC(CPUState* cpu) {
         /* 0220FD20 */ _t7 = cpu->r[10] + 0xFFFFE610u;
         /* 0220FD20 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 0220FD24 */ cpu->r[8] = 0x101D0000u;
-        /* 0220FD28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0220FD28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0220FD2C */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 0220FD30 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FD30 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FD30 */ _t9 = _t8 & 0x00000001u;
         /* 0220FD30 */ if (_t9) goto L_0220FD34; else goto L_0220FD4C;
   L_0220FD34: ; // 0x220fd34
@@ -6010,8 +6010,8 @@ void Gambit_fn_0220FCDC(CPUState* cpu) {
         /* 0220FD48 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 0220FD48 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_0220FD4C: ; // 0x220fd4c
-        /* 0220FD4C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 0220FD50 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FD4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 0220FD50 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FD50 */ _t13 = _t12 & 0x00000001u;
         /* 0220FD50 */ if (_t13) goto L_0220FD54; else goto L_0220FD5C;
   L_0220FD54: ; // 0x220fd54
@@ -6022,9 +6022,9 @@ void Gambit_fn_0220FCDC(CPUState* cpu) {
         /* 0220FD60 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 0220FD60 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 0220FD64 */ cpu->r[10] = 0x101D0000u;
-        /* 0220FD68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0220FD68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0220FD6C */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 0220FD70 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FD70 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FD70 */ _t16 = _t15 & 0x00000001u;
         /* 0220FD70 */ if (_t16) goto L_0220FD74; else goto L_0220FD8C;
   L_0220FD74: ; // 0x220fd74
@@ -6037,8 +6037,8 @@ void Gambit_fn_0220FCDC(CPUState* cpu) {
         /* 0220FD88 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 0220FD88 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_0220FD8C: ; // 0x220fd8c
-        /* 0220FD8C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0220FD90 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FD8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0220FD90 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FD90 */ _t20 = _t19 & 0x00000001u;
         /* 0220FD90 */ if (_t20) goto L_0220FD94; else goto L_0220FD9C;
   L_0220FD94: ; // 0x220fd94
@@ -6049,9 +6049,9 @@ void Gambit_fn_0220FCDC(CPUState* cpu) {
         /* 0220FDA0 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 0220FDA0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 0220FDA4 */ cpu->r[12] = 0x101D0000u;
-        /* 0220FDA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220FDA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220FDAC */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 0220FDB0 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FDB0 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FDB0 */ _t23 = _t22 & 0x00000001u;
         /* 0220FDB0 */ if (_t23) goto L_0220FDB4; else goto L_0220FDCC;
   L_0220FDB4: ; // 0x220fdb4
@@ -6064,8 +6064,8 @@ void Gambit_fn_0220FCDC(CPUState* cpu) {
         /* 0220FDC8 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 0220FDC8 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_0220FDCC: ; // 0x220fdcc
-        /* 0220FDCC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0220FDD0 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FDCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0220FDD0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FDD0 */ _t27 = _t26 & 0x00000001u;
         /* 0220FDD0 */ if (_t27) goto L_0220FDD4; else goto L_0220FDDC;
   L_0220FDD4: ; // 0x220fdd4
@@ -6077,9 +6077,9 @@ void Gambit_fn_0220FCDC(CPUState* cpu) {
         /* 0220FDE0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 0220FDE0 */ cpu->r[10] = _t28;
         /* 0220FDE4 */ cpu->r[7] = 0x101D0000u;
-        /* 0220FDE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220FDE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220FDEC */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 0220FDF0 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FDF0 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FDF0 */ _t30 = _t29 & 0x00000001u;
         /* 0220FDF0 */ if (_t30) goto L_0220FDF4; else goto L_0220FE08;
   L_0220FDF4: ; // 0x220fdf4
@@ -6091,8 +6091,8 @@ void Gambit_fn_0220FCDC(CPUState* cpu) {
         /* 0220FE04 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 0220FE04 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_0220FE08: ; // 0x220fe08
-        /* 0220FE08 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 0220FE0C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FE08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 0220FE0C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FE0C */ _t34 = _t33 & 0x00000001u;
         /* 0220FE0C */ if (_t34) goto L_0220FE10; else goto L_0220FE18;
   L_0220FE10: ; // 0x220fe10
@@ -6104,9 +6104,9 @@ void Gambit_fn_0220FCDC(CPUState* cpu) {
         /* 0220FE1C */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 0220FE1C */ cpu->r[8] = _t35;
         /* 0220FE20 */ cpu->r[6] = 0x101D0000u;
-        /* 0220FE24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0220FE24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0220FE28 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 0220FE2C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FE2C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FE2C */ _t37 = _t36 & 0x00000001u;
         /* 0220FE2C */ if (_t37) goto L_0220FE30; else goto L_0220FE44;
   L_0220FE30: ; // 0x220fe30
@@ -6145,9 +6145,9 @@ void Gambit_fn_0220FE68(CPUState* cpu) {
         /* 0220FE6C */ _t0 = cpu->r[8] + 0xFFFFFD00u;
         /* 0220FE6C */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 0220FE70 */ cpu->r[6] = 0x101D0000u;
-        /* 0220FE74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0220FE74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0220FE78 */ cpu->r[6] = cpu->r[6] + 0xFFFFFEECu;
-        /* 0220FE7C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FE7C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FE7C */ _t2 = _t1 & 0x00000001u;
         /* 0220FE7C */ if (_t2) goto L_0220FE80; else goto L_0220FE98;
   L_0220FE80: ; // 0x220fe80
@@ -6160,8 +6160,8 @@ void Gambit_fn_0220FE68(CPUState* cpu) {
         /* 0220FE94 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 0220FE94 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_0220FE98: ; // 0x220fe98
-        /* 0220FE98 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 0220FE9C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FE98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 0220FE9C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FE9C */ _t6 = _t5 & 0x00000001u;
         /* 0220FE9C */ if (_t6) goto L_0220FEA0; else goto L_0220FEA8;
   L_0220FEA0: ; // 0x220fea0
@@ -6172,9 +6172,9 @@ void Gambit_fn_0220FE68(CPUState* cpu) {
         /* 0220FEAC */ _t7 = cpu->r[10] + 0xFFFFE610u;
         /* 0220FEAC */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 0220FEB0 */ cpu->r[8] = 0x101D0000u;
-        /* 0220FEB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0220FEB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0220FEB8 */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 0220FEBC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FEBC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FEBC */ _t9 = _t8 & 0x00000001u;
         /* 0220FEBC */ if (_t9) goto L_0220FEC0; else goto L_0220FED8;
   L_0220FEC0: ; // 0x220fec0
@@ -6187,8 +6187,8 @@ void Gambit_fn_0220FE68(CPUState* cpu) {
         /* 0220FED4 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 0220FED4 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_0220FED8: ; // 0x220fed8
-        /* 0220FED8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 0220FEDC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FED8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 0220FEDC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FEDC */ _t13 = _t12 & 0x00000001u;
         /* 0220FEDC */ if (_t13) goto L_0220FEE0; else goto L_0220FEE8;
   L_0220FEE0: ; // 0x220fee0
@@ -6199,9 +6199,9 @@ void Gambit_fn_0220FE68(CPUState* cpu) {
         /* 0220FEEC */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 0220FEEC */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 0220FEF0 */ cpu->r[10] = 0x101D0000u;
-        /* 0220FEF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0220FEF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0220FEF8 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 0220FEFC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FEFC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FEFC */ _t16 = _t15 & 0x00000001u;
         /* 0220FEFC */ if (_t16) goto L_0220FF00; else goto L_0220FF18;
   L_0220FF00: ; // 0x220ff00
@@ -6214,8 +6214,8 @@ void Gambit_fn_0220FE68(CPUState* cpu) {
         /* 0220FF14 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 0220FF14 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_0220FF18: ; // 0x220ff18
-        /* 0220FF18 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0220FF1C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FF18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0220FF1C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FF1C */ _t20 = _t19 & 0x00000001u;
         /* 0220FF1C */ if (_t20) goto L_0220FF20; else goto L_0220FF28;
   L_0220FF20: ; // 0x220ff20
@@ -6226,9 +6226,9 @@ void Gambit_fn_0220FE68(CPUState* cpu) {
         /* 0220FF2C */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 0220FF2C */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 0220FF30 */ cpu->r[12] = 0x101D0000u;
-        /* 0220FF34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220FF34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220FF38 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 0220FF3C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FF3C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FF3C */ _t23 = _t22 & 0x00000001u;
         /* 0220FF3C */ if (_t23) goto L_0220FF40; else goto L_0220FF58;
   L_0220FF40: ; // 0x220ff40
@@ -6241,8 +6241,8 @@ void Gambit_fn_0220FE68(CPUState* cpu) {
         /* 0220FF54 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 0220FF54 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_0220FF58: ; // 0x220ff58
-        /* 0220FF58 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0220FF5C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FF58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0220FF5C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FF5C */ _t27 = _t26 & 0x00000001u;
         /* 0220FF5C */ if (_t27) goto L_0220FF60; else goto L_0220FF68;
   L_0220FF60: ; // 0x220ff60
@@ -6254,9 +6254,9 @@ void Gambit_fn_0220FE68(CPUState* cpu) {
         /* 0220FF6C */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 0220FF6C */ cpu->r[10] = _t28;
         /* 0220FF70 */ cpu->r[7] = 0x101D0000u;
-        /* 0220FF74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0220FF74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0220FF78 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 0220FF7C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FF7C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FF7C */ _t30 = _t29 & 0x00000001u;
         /* 0220FF7C */ if (_t30) goto L_0220FF80; else goto L_0220FF94;
   L_0220FF80: ; // 0x220ff80
@@ -6268,8 +6268,8 @@ void Gambit_fn_0220FE68(CPUState* cpu) {
         /* 0220FF90 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 0220FF90 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_0220FF94: ; // 0x220ff94
-        /* 0220FF94 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 0220FF98 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FF94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 0220FF98 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FF98 */ _t34 = _t33 & 0x00000001u;
         /* 0220FF98 */ if (_t34) goto L_0220FF9C; else goto L_0220FFA4;
   L_0220FF9C: ; // 0x220ff9c
@@ -6281,9 +6281,9 @@ void Gambit_fn_0220FE68(CPUState* cpu) {
         /* 0220FFA8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 0220FFA8 */ cpu->r[8] = _t35;
         /* 0220FFAC */ cpu->r[6] = 0x101D0000u;
-        /* 0220FFB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0220FFB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0220FFB4 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 0220FFB8 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0220FFB8 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0220FFB8 */ _t37 = _t36 & 0x00000001u;
         /* 0220FFB8 */ if (_t37) goto L_0220FFBC; else goto L_0220FFD0;
   L_0220FFBC: ; // 0x220ffbc
@@ -6322,9 +6322,9 @@ void Gambit_fn_0220FFF4(CPUState* cpu) {
         /* 0220FFF8 */ _t0 = cpu->r[8] + 0xFFFFFD04u;
         /* 0220FFF8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 0220FFFC */ cpu->r[6] = 0x101D0000u;
-        /* 02210000 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02210000 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02210004 */ cpu->r[6] = cpu->r[6] + 0xFFFFFEF0u;
-        /* 02210008 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210008 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210008 */ _t2 = _t1 & 0x00000001u;
         /* 02210008 */ if (_t2) goto L_0221000C; else goto L_02210024;
   L_0221000C: ; // 0x221000c
@@ -6337,8 +6337,8 @@ void Gambit_fn_0220FFF4(CPUState* cpu) {
         /* 02210020 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 02210020 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_02210024: ; // 0x2210024
-        /* 02210024 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 02210028 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210024 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 02210028 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210028 */ _t6 = _t5 & 0x00000001u;
         /* 02210028 */ if (_t6) goto L_0221002C; else goto L_02210034;
   L_0221002C: ; // 0x221002c
@@ -6349,9 +6349,9 @@ void Gambit_fn_0220FFF4(CPUState* cpu) {
         /* 02210038 */ _t7 = cpu->r[10] + 0xFFFFE610u;
         /* 02210038 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 0221003C */ cpu->r[8] = 0x101D0000u;
-        /* 02210040 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02210040 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02210044 */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 02210048 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210048 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210048 */ _t9 = _t8 & 0x00000001u;
         /* 02210048 */ if (_t9) goto L_0221004C; else goto L_02210064;
   L_0221004C: ; // 0x221004c
@@ -6364,8 +6364,8 @@ void Gambit_fn_0220FFF4(CPUState* cpu) {
         /* 02210060 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 02210060 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_02210064: ; // 0x2210064
-        /* 02210064 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02210068 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210064 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02210068 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210068 */ _t13 = _t12 & 0x00000001u;
         /* 02210068 */ if (_t13) goto L_0221006C; else goto L_02210074;
   L_0221006C: ; // 0x221006c
@@ -6376,9 +6376,9 @@ void Gambit_fn_0220FFF4(CPUState* cpu) {
         /* 02210078 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 02210078 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 0221007C */ cpu->r[10] = 0x101D0000u;
-        /* 02210080 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02210080 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02210084 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 02210088 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210088 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210088 */ _t16 = _t15 & 0x00000001u;
         /* 02210088 */ if (_t16) goto L_0221008C; else goto L_022100A4;
   L_0221008C: ; // 0x221008c
@@ -6391,8 +6391,8 @@ void Gambit_fn_0220FFF4(CPUState* cpu) {
         /* 022100A0 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 022100A0 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_022100A4: ; // 0x22100a4
-        /* 022100A4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 022100A8 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022100A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 022100A8 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022100A8 */ _t20 = _t19 & 0x00000001u;
         /* 022100A8 */ if (_t20) goto L_022100AC; else goto L_022100B4;
   L_022100AC: ; // 0x22100ac
@@ -6403,9 +6403,9 @@ void Gambit_fn_0220FFF4(CPUState* cpu) {
         /* 022100B8 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 022100B8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 022100BC */ cpu->r[12] = 0x101D0000u;
-        /* 022100C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 022100C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 022100C4 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 022100C8 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022100C8 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022100C8 */ _t23 = _t22 & 0x00000001u;
         /* 022100C8 */ if (_t23) goto L_022100CC; else goto L_022100E4;
   L_022100CC: ; // 0x22100cc
@@ -6418,8 +6418,8 @@ void Gambit_fn_0220FFF4(CPUState* cpu) {
         /* 022100E0 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 022100E0 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_022100E4: ; // 0x22100e4
-        /* 022100E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 022100E8 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022100E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 022100E8 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022100E8 */ _t27 = _t26 & 0x00000001u;
         /* 022100E8 */ if (_t27) goto L_022100EC; else goto L_022100F4;
   L_022100EC: ; // 0x22100ec
@@ -6431,9 +6431,9 @@ void Gambit_fn_0220FFF4(CPUState* cpu) {
         /* 022100F8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 022100F8 */ cpu->r[10] = _t28;
         /* 022100FC */ cpu->r[7] = 0x101D0000u;
-        /* 02210100 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02210100 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02210104 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 02210108 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210108 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210108 */ _t30 = _t29 & 0x00000001u;
         /* 02210108 */ if (_t30) goto L_0221010C; else goto L_02210120;
   L_0221010C: ; // 0x221010c
@@ -6445,8 +6445,8 @@ void Gambit_fn_0220FFF4(CPUState* cpu) {
         /* 0221011C */ _t32 = cpu->r[7] + 0x00000000u;
         /* 0221011C */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_02210120: ; // 0x2210120
-        /* 02210120 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 02210124 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210120 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 02210124 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210124 */ _t34 = _t33 & 0x00000001u;
         /* 02210124 */ if (_t34) goto L_02210128; else goto L_02210130;
   L_02210128: ; // 0x2210128
@@ -6458,9 +6458,9 @@ void Gambit_fn_0220FFF4(CPUState* cpu) {
         /* 02210134 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 02210134 */ cpu->r[8] = _t35;
         /* 02210138 */ cpu->r[6] = 0x101D0000u;
-        /* 0221013C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0221013C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02210140 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 02210144 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210144 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210144 */ _t37 = _t36 & 0x00000001u;
         /* 02210144 */ if (_t37) goto L_02210148; else goto L_0221015C;
   L_02210148: ; // 0x2210148
@@ -6499,9 +6499,9 @@ void Gambit_fn_02210180(CPUState* cpu) {
         /* 02210184 */ _t0 = cpu->r[8] + 0xFFFFFD08u;
         /* 02210184 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 02210188 */ cpu->r[6] = 0x101D0000u;
-        /* 0221018C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0221018C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02210190 */ cpu->r[6] = cpu->r[6] + 0xFFFFFEF4u;
-        /* 02210194 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210194 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210194 */ _t2 = _t1 & 0x00000001u;
         /* 02210194 */ if (_t2) goto L_02210198; else goto L_022101B0;
   L_02210198: ; // 0x2210198
@@ -6514,8 +6514,8 @@ void Gambit_fn_02210180(CPUState* cpu) {
         /* 022101AC */ _t4 = cpu->r[6] + 0x00000000u;
         /* 022101AC */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_022101B0: ; // 0x22101b0
-        /* 022101B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 022101B4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022101B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 022101B4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022101B4 */ _t6 = _t5 & 0x00000001u;
         /* 022101B4 */ if (_t6) goto L_022101B8; else goto L_022101C0;
   L_022101B8: ; // 0x22101b8
@@ -6526,9 +6526,9 @@ void Gambit_fn_02210180(CPUState* cpu) {
         /* 022101C4 */ _t7 = cpu->r[10] + 0xFFFFE610u;
         /* 022101C4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 022101C8 */ cpu->r[8] = 0x101D0000u;
-        /* 022101CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 022101CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 022101D0 */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 022101D4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022101D4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022101D4 */ _t9 = _t8 & 0x00000001u;
         /* 022101D4 */ if (_t9) goto L_022101D8; else goto L_022101F0;
   L_022101D8: ; // 0x22101d8
@@ -6541,8 +6541,8 @@ void Gambit_fn_02210180(CPUState* cpu) {
         /* 022101EC */ _t11 = cpu->r[8] + 0x00000000u;
         /* 022101EC */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_022101F0: ; // 0x22101f0
-        /* 022101F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 022101F4 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022101F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 022101F4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022101F4 */ _t13 = _t12 & 0x00000001u;
         /* 022101F4 */ if (_t13) goto L_022101F8; else goto L_02210200;
   L_022101F8: ; // 0x22101f8
@@ -6553,9 +6553,9 @@ void Gambit_fn_02210180(CPUState* cpu) {
         /* 02210204 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 02210204 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 02210208 */ cpu->r[10] = 0x101D0000u;
-        /* 0221020C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0221020C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02210210 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 02210214 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210214 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210214 */ _t16 = _t15 & 0x00000001u;
         /* 02210214 */ if (_t16) goto L_02210218; else goto L_02210230;
   L_02210218: ; // 0x2210218
@@ -6568,8 +6568,8 @@ void Gambit_fn_02210180(CPUState* cpu) {
         /* 0221022C */ _t18 = cpu->r[10] + 0x00000000u;
         /* 0221022C */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_02210230: ; // 0x2210230
-        /* 02210230 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02210234 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210230 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02210234 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210234 */ _t20 = _t19 & 0x00000001u;
         /* 02210234 */ if (_t20) goto L_02210238; else goto L_02210240;
   L_02210238: ; // 0x2210238
@@ -6580,9 +6580,9 @@ void Gambit_fn_02210180(CPUState* cpu) {
         /* 02210244 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 02210244 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 02210248 */ cpu->r[12] = 0x101D0000u;
-        /* 0221024C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0221024C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02210250 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 02210254 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210254 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210254 */ _t23 = _t22 & 0x00000001u;
         /* 02210254 */ if (_t23) goto L_02210258; else goto L_02210270;
   L_02210258: ; // 0x2210258
@@ -6595,8 +6595,8 @@ void Gambit_fn_02210180(CPUState* cpu) {
         /* 0221026C */ _t25 = cpu->r[12] + 0x00000000u;
         /* 0221026C */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_02210270: ; // 0x2210270
-        /* 02210270 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02210274 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210270 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02210274 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210274 */ _t27 = _t26 & 0x00000001u;
         /* 02210274 */ if (_t27) goto L_02210278; else goto L_02210280;
   L_02210278: ; // 0x2210278
@@ -6608,9 +6608,9 @@ void Gambit_fn_02210180(CPUState* cpu) {
         /* 02210284 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 02210284 */ cpu->r[10] = _t28;
         /* 02210288 */ cpu->r[7] = 0x101D0000u;
-        /* 0221028C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0221028C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02210290 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 02210294 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210294 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210294 */ _t30 = _t29 & 0x00000001u;
         /* 02210294 */ if (_t30) goto L_02210298; else goto L_022102AC;
   L_02210298: ; // 0x2210298
@@ -6622,8 +6622,8 @@ void Gambit_fn_02210180(CPUState* cpu) {
         /* 022102A8 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 022102A8 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_022102AC: ; // 0x22102ac
-        /* 022102AC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 022102B0 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022102AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 022102B0 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022102B0 */ _t34 = _t33 & 0x00000001u;
         /* 022102B0 */ if (_t34) goto L_022102B4; else goto L_022102BC;
   L_022102B4: ; // 0x22102b4
@@ -6635,9 +6635,9 @@ void Gambit_fn_02210180(CPUState* cpu) {
         /* 022102C0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 022102C0 */ cpu->r[8] = _t35;
         /* 022102C4 */ cpu->r[6] = 0x101D0000u;
-        /* 022102C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 022102C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 022102CC */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 022102D0 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022102D0 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022102D0 */ _t37 = _t36 & 0x00000001u;
         /* 022102D0 */ if (_t37) goto L_022102D4; else goto L_022102E8;
   L_022102D4: ; // 0x22102d4
@@ -6676,9 +6676,9 @@ void Gambit_fn_0221030C(CPUState* cpu) {
         /* 02210310 */ _t0 = cpu->r[8] + 0xFFFFFD0Cu;
         /* 02210310 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 02210314 */ cpu->r[6] = 0x101D0000u;
-        /* 02210318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02210318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0221031C */ cpu->r[6] = cpu->r[6] + 0xFFFFFEF8u;
-        /* 02210320 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210320 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210320 */ _t2 = _t1 & 0x00000001u;
         /* 02210320 */ if (_t2) goto L_02210324; else goto L_0221033C;
   L_02210324: ; // 0x2210324
@@ -6691,8 +6691,8 @@ void Gambit_fn_0221030C(CPUState* cpu) {
         /* 02210338 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 02210338 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_0221033C: ; // 0x221033c
-        /* 0221033C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 02210340 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221033C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 02210340 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210340 */ _t6 = _t5 & 0x00000001u;
         /* 02210340 */ if (_t6) goto L_02210344; else goto L_0221034C;
   L_02210344: ; // 0x2210344
@@ -6703,9 +6703,9 @@ void Gambit_fn_0221030C(CPUState* cpu) {
         /* 02210350 */ _t7 = cpu->r[10] + 0xFFFFE610u;
         /* 02210350 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 02210354 */ cpu->r[8] = 0x101D0000u;
-        /* 02210358 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02210358 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0221035C */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 02210360 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210360 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210360 */ _t9 = _t8 & 0x00000001u;
         /* 02210360 */ if (_t9) goto L_02210364; else goto L_0221037C;
   L_02210364: ; // 0x2210364
@@ -6718,8 +6718,8 @@ void Gambit_fn_0221030C(CPUState* cpu) {
         /* 02210378 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 02210378 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_0221037C: ; // 0x221037c
-        /* 0221037C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02210380 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221037C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02210380 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210380 */ _t13 = _t12 & 0x00000001u;
         /* 02210380 */ if (_t13) goto L_02210384; else goto L_0221038C;
   L_02210384: ; // 0x2210384
@@ -6730,9 +6730,9 @@ void Gambit_fn_0221030C(CPUState* cpu) {
         /* 02210390 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 02210390 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 02210394 */ cpu->r[10] = 0x101D0000u;
-        /* 02210398 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02210398 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0221039C */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 022103A0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022103A0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022103A0 */ _t16 = _t15 & 0x00000001u;
         /* 022103A0 */ if (_t16) goto L_022103A4; else goto L_022103BC;
   L_022103A4: ; // 0x22103a4
@@ -6745,8 +6745,8 @@ void Gambit_fn_0221030C(CPUState* cpu) {
         /* 022103B8 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 022103B8 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_022103BC: ; // 0x22103bc
-        /* 022103BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 022103C0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022103BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 022103C0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022103C0 */ _t20 = _t19 & 0x00000001u;
         /* 022103C0 */ if (_t20) goto L_022103C4; else goto L_022103CC;
   L_022103C4: ; // 0x22103c4
@@ -6757,9 +6757,9 @@ void Gambit_fn_0221030C(CPUState* cpu) {
         /* 022103D0 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 022103D0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 022103D4 */ cpu->r[12] = 0x101D0000u;
-        /* 022103D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 022103D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 022103DC */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 022103E0 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022103E0 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022103E0 */ _t23 = _t22 & 0x00000001u;
         /* 022103E0 */ if (_t23) goto L_022103E4; else goto L_022103FC;
   L_022103E4: ; // 0x22103e4
@@ -6772,8 +6772,8 @@ void Gambit_fn_0221030C(CPUState* cpu) {
         /* 022103F8 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 022103F8 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_022103FC: ; // 0x22103fc
-        /* 022103FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02210400 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022103FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02210400 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210400 */ _t27 = _t26 & 0x00000001u;
         /* 02210400 */ if (_t27) goto L_02210404; else goto L_0221040C;
   L_02210404: ; // 0x2210404
@@ -6785,9 +6785,9 @@ void Gambit_fn_0221030C(CPUState* cpu) {
         /* 02210410 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 02210410 */ cpu->r[10] = _t28;
         /* 02210414 */ cpu->r[7] = 0x101D0000u;
-        /* 02210418 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02210418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0221041C */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 02210420 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210420 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210420 */ _t30 = _t29 & 0x00000001u;
         /* 02210420 */ if (_t30) goto L_02210424; else goto L_02210438;
   L_02210424: ; // 0x2210424
@@ -6799,8 +6799,8 @@ void Gambit_fn_0221030C(CPUState* cpu) {
         /* 02210434 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 02210434 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_02210438: ; // 0x2210438
-        /* 02210438 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 0221043C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210438 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 0221043C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221043C */ _t34 = _t33 & 0x00000001u;
         /* 0221043C */ if (_t34) goto L_02210440; else goto L_02210448;
   L_02210440: ; // 0x2210440
@@ -6812,9 +6812,9 @@ void Gambit_fn_0221030C(CPUState* cpu) {
         /* 0221044C */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 0221044C */ cpu->r[8] = _t35;
         /* 02210450 */ cpu->r[6] = 0x101D0000u;
-        /* 02210454 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02210454 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02210458 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 0221045C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221045C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221045C */ _t37 = _t36 & 0x00000001u;
         /* 0221045C */ if (_t37) goto L_02210460; else goto L_02210474;
   L_02210460: ; // 0x2210460
@@ -6853,9 +6853,9 @@ void Gambit_fn_02210498(CPUState* cpu) {
         /* 0221049C */ _t0 = cpu->r[8] + 0xFFFFFD10u;
         /* 0221049C */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 022104A0 */ cpu->r[6] = 0x101D0000u;
-        /* 022104A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 022104A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 022104A8 */ cpu->r[6] = cpu->r[6] + 0xFFFFFEFCu;
-        /* 022104AC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022104AC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022104AC */ _t2 = _t1 & 0x00000001u;
         /* 022104AC */ if (_t2) goto L_022104B0; else goto L_022104C8;
   L_022104B0: ; // 0x22104b0
@@ -6868,8 +6868,8 @@ void Gambit_fn_02210498(CPUState* cpu) {
         /* 022104C4 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 022104C4 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_022104C8: ; // 0x22104c8
-        /* 022104C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 022104CC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022104C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 022104CC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022104CC */ _t6 = _t5 & 0x00000001u;
         /* 022104CC */ if (_t6) goto L_022104D0; else goto L_022104D8;
   L_022104D0: ; // 0x22104d0
@@ -6880,9 +6880,9 @@ void Gambit_fn_02210498(CPUState* cpu) {
         /* 022104DC */ _t7 = cpu->r[10] + 0xFFFFE610u;
         /* 022104DC */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 022104E0 */ cpu->r[8] = 0x101D0000u;
-        /* 022104E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 022104E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 022104E8 */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 022104EC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022104EC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022104EC */ _t9 = _t8 & 0x00000001u;
         /* 022104EC */ if (_t9) goto L_022104F0; else goto L_02210508;
   L_022104F0: ; // 0x22104f0
@@ -6895,8 +6895,8 @@ void Gambit_fn_02210498(CPUState* cpu) {
         /* 02210504 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 02210504 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_02210508: ; // 0x2210508
-        /* 02210508 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 0221050C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210508 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 0221050C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221050C */ _t13 = _t12 & 0x00000001u;
         /* 0221050C */ if (_t13) goto L_02210510; else goto L_02210518;
   L_02210510: ; // 0x2210510
@@ -6907,9 +6907,9 @@ void Gambit_fn_02210498(CPUState* cpu) {
         /* 0221051C */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 0221051C */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 02210520 */ cpu->r[10] = 0x101D0000u;
-        /* 02210524 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02210524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02210528 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 0221052C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221052C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221052C */ _t16 = _t15 & 0x00000001u;
         /* 0221052C */ if (_t16) goto L_02210530; else goto L_02210548;
   L_02210530: ; // 0x2210530
@@ -6922,8 +6922,8 @@ void Gambit_fn_02210498(CPUState* cpu) {
         /* 02210544 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 02210544 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_02210548: ; // 0x2210548
-        /* 02210548 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0221054C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210548 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0221054C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221054C */ _t20 = _t19 & 0x00000001u;
         /* 0221054C */ if (_t20) goto L_02210550; else goto L_02210558;
   L_02210550: ; // 0x2210550
@@ -6934,9 +6934,9 @@ void Gambit_fn_02210498(CPUState* cpu) {
         /* 0221055C */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 0221055C */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 02210560 */ cpu->r[12] = 0x101D0000u;
-        /* 02210564 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02210564 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02210568 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 0221056C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221056C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221056C */ _t23 = _t22 & 0x00000001u;
         /* 0221056C */ if (_t23) goto L_02210570; else goto L_02210588;
   L_02210570: ; // 0x2210570
@@ -6949,8 +6949,8 @@ void Gambit_fn_02210498(CPUState* cpu) {
         /* 02210584 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 02210584 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_02210588: ; // 0x2210588
-        /* 02210588 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0221058C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210588 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0221058C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221058C */ _t27 = _t26 & 0x00000001u;
         /* 0221058C */ if (_t27) goto L_02210590; else goto L_02210598;
   L_02210590: ; // 0x2210590
@@ -6962,9 +6962,9 @@ void Gambit_fn_02210498(CPUState* cpu) {
         /* 0221059C */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 0221059C */ cpu->r[10] = _t28;
         /* 022105A0 */ cpu->r[7] = 0x101D0000u;
-        /* 022105A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 022105A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 022105A8 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 022105AC */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022105AC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022105AC */ _t30 = _t29 & 0x00000001u;
         /* 022105AC */ if (_t30) goto L_022105B0; else goto L_022105C4;
   L_022105B0: ; // 0x22105b0
@@ -6976,8 +6976,8 @@ void Gambit_fn_02210498(CPUState* cpu) {
         /* 022105C0 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 022105C0 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_022105C4: ; // 0x22105c4
-        /* 022105C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 022105C8 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022105C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 022105C8 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022105C8 */ _t34 = _t33 & 0x00000001u;
         /* 022105C8 */ if (_t34) goto L_022105CC; else goto L_022105D4;
   L_022105CC: ; // 0x22105cc
@@ -6989,9 +6989,9 @@ void Gambit_fn_02210498(CPUState* cpu) {
         /* 022105D8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 022105D8 */ cpu->r[8] = _t35;
         /* 022105DC */ cpu->r[6] = 0x101D0000u;
-        /* 022105E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 022105E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 022105E4 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 022105E8 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022105E8 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022105E8 */ _t37 = _t36 & 0x00000001u;
         /* 022105E8 */ if (_t37) goto L_022105EC; else goto L_02210600;
   L_022105EC: ; // 0x22105ec
@@ -7030,9 +7030,9 @@ void Gambit_fn_02210624(CPUState* cpu) {
         /* 02210628 */ _t0 = cpu->r[8] + 0xFFFFFD14u;
         /* 02210628 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 0221062C */ cpu->r[6] = 0x101D0000u;
-        /* 02210630 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02210630 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02210634 */ cpu->r[6] = cpu->r[6] + 0xFFFFFF00u;
-        /* 02210638 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210638 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210638 */ _t2 = _t1 & 0x00000001u;
         /* 02210638 */ if (_t2) goto L_0221063C; else goto L_02210654;
   L_0221063C: ; // 0x221063c
@@ -7045,8 +7045,8 @@ void Gambit_fn_02210624(CPUState* cpu) {
         /* 02210650 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 02210650 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_02210654: ; // 0x2210654
-        /* 02210654 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 02210658 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210654 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 02210658 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210658 */ _t6 = _t5 & 0x00000001u;
         /* 02210658 */ if (_t6) goto L_0221065C; else goto L_02210664;
   L_0221065C: ; // 0x221065c
@@ -7057,9 +7057,9 @@ void Gambit_fn_02210624(CPUState* cpu) {
         /* 02210668 */ _t7 = cpu->r[10] + 0xFFFFE610u;
         /* 02210668 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 0221066C */ cpu->r[8] = 0x101D0000u;
-        /* 02210670 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02210670 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02210674 */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 02210678 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210678 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210678 */ _t9 = _t8 & 0x00000001u;
         /* 02210678 */ if (_t9) goto L_0221067C; else goto L_02210694;
   L_0221067C: ; // 0x221067c
@@ -7072,8 +7072,8 @@ void Gambit_fn_02210624(CPUState* cpu) {
         /* 02210690 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 02210690 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_02210694: ; // 0x2210694
-        /* 02210694 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02210698 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210694 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02210698 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210698 */ _t13 = _t12 & 0x00000001u;
         /* 02210698 */ if (_t13) goto L_0221069C; else goto L_022106A4;
   L_0221069C: ; // 0x221069c
@@ -7084,9 +7084,9 @@ void Gambit_fn_02210624(CPUState* cpu) {
         /* 022106A8 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 022106A8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 022106AC */ cpu->r[10] = 0x101D0000u;
-        /* 022106B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 022106B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 022106B4 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 022106B8 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022106B8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022106B8 */ _t16 = _t15 & 0x00000001u;
         /* 022106B8 */ if (_t16) goto L_022106BC; else goto L_022106D4;
   L_022106BC: ; // 0x22106bc
@@ -7099,8 +7099,8 @@ void Gambit_fn_02210624(CPUState* cpu) {
         /* 022106D0 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 022106D0 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_022106D4: ; // 0x22106d4
-        /* 022106D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 022106D8 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022106D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 022106D8 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022106D8 */ _t20 = _t19 & 0x00000001u;
         /* 022106D8 */ if (_t20) goto L_022106DC; else goto L_022106E4;
   L_022106DC: ; // 0x22106dc
@@ -7111,9 +7111,9 @@ void Gambit_fn_02210624(CPUState* cpu) {
         /* 022106E8 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 022106E8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 022106EC */ cpu->r[12] = 0x101D0000u;
-        /* 022106F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 022106F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 022106F4 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 022106F8 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022106F8 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022106F8 */ _t23 = _t22 & 0x00000001u;
         /* 022106F8 */ if (_t23) goto L_022106FC; else goto L_02210714;
   L_022106FC: ; // 0x22106fc
@@ -7126,8 +7126,8 @@ void Gambit_fn_02210624(CPUState* cpu) {
         /* 02210710 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 02210710 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_02210714: ; // 0x2210714
-        /* 02210714 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02210718 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210714 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02210718 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210718 */ _t27 = _t26 & 0x00000001u;
         /* 02210718 */ if (_t27) goto L_0221071C; else goto L_02210724;
   L_0221071C: ; // 0x221071c
@@ -7139,9 +7139,9 @@ void Gambit_fn_02210624(CPUState* cpu) {
         /* 02210728 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 02210728 */ cpu->r[10] = _t28;
         /* 0221072C */ cpu->r[7] = 0x101D0000u;
-        /* 02210730 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02210730 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02210734 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 02210738 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210738 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210738 */ _t30 = _t29 & 0x00000001u;
         /* 02210738 */ if (_t30) goto L_0221073C; else goto L_02210750;
   L_0221073C: ; // 0x221073c
@@ -7153,8 +7153,8 @@ void Gambit_fn_02210624(CPUState* cpu) {
         /* 0221074C */ _t32 = cpu->r[7] + 0x00000000u;
         /* 0221074C */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_02210750: ; // 0x2210750
-        /* 02210750 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 02210754 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210750 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 02210754 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210754 */ _t34 = _t33 & 0x00000001u;
         /* 02210754 */ if (_t34) goto L_02210758; else goto L_02210760;
   L_02210758: ; // 0x2210758
@@ -7166,9 +7166,9 @@ void Gambit_fn_02210624(CPUState* cpu) {
         /* 02210764 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 02210764 */ cpu->r[8] = _t35;
         /* 02210768 */ cpu->r[6] = 0x101D0000u;
-        /* 0221076C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0221076C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02210770 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 02210774 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210774 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210774 */ _t37 = _t36 & 0x00000001u;
         /* 02210774 */ if (_t37) goto L_02210778; else goto L_0221078C;
   L_02210778: ; // 0x2210778
@@ -7207,9 +7207,9 @@ void Gambit_fn_022107B0(CPUState* cpu) {
         /* 022107B4 */ _t0 = cpu->r[8] + 0xFFFFFD18u;
         /* 022107B4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 022107B8 */ cpu->r[6] = 0x101D0000u;
-        /* 022107BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 022107BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 022107C0 */ cpu->r[6] = cpu->r[6] + 0xFFFFFF04u;
-        /* 022107C4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022107C4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022107C4 */ _t2 = _t1 & 0x00000001u;
         /* 022107C4 */ if (_t2) goto L_022107C8; else goto L_022107E0;
   L_022107C8: ; // 0x22107c8
@@ -7222,8 +7222,8 @@ void Gambit_fn_022107B0(CPUState* cpu) {
         /* 022107DC */ _t4 = cpu->r[6] + 0x00000000u;
         /* 022107DC */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_022107E0: ; // 0x22107e0
-        /* 022107E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 022107E4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022107E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 022107E4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022107E4 */ _t6 = _t5 & 0x00000001u;
         /* 022107E4 */ if (_t6) goto L_022107E8; else goto L_022107F0;
   L_022107E8: ; // 0x22107e8
@@ -7234,9 +7234,9 @@ void Gambit_fn_022107B0(CPUState* cpu) {
         /* 022107F4 */ _t7 = cpu->r[10] + 0xFFFFE610u;
         /* 022107F4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 022107F8 */ cpu->r[8] = 0x101D0000u;
-        /* 022107FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 022107FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02210800 */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 02210804 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210804 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210804 */ _t9 = _t8 & 0x00000001u;
         /* 02210804 */ if (_t9) goto L_02210808; else goto L_02210820;
   L_02210808: ; // 0x2210808
@@ -7249,8 +7249,8 @@ void Gambit_fn_022107B0(CPUState* cpu) {
         /* 0221081C */ _t11 = cpu->r[8] + 0x00000000u;
         /* 0221081C */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_02210820: ; // 0x2210820
-        /* 02210820 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02210824 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210820 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02210824 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210824 */ _t13 = _t12 & 0x00000001u;
         /* 02210824 */ if (_t13) goto L_02210828; else goto L_02210830;
   L_02210828: ; // 0x2210828
@@ -7261,9 +7261,9 @@ void Gambit_fn_022107B0(CPUState* cpu) {
         /* 02210834 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 02210834 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 02210838 */ cpu->r[10] = 0x101D0000u;
-        /* 0221083C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0221083C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02210840 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 02210844 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210844 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210844 */ _t16 = _t15 & 0x00000001u;
         /* 02210844 */ if (_t16) goto L_02210848; else goto L_02210860;
   L_02210848: ; // 0x2210848
@@ -7276,8 +7276,8 @@ void Gambit_fn_022107B0(CPUState* cpu) {
         /* 0221085C */ _t18 = cpu->r[10] + 0x00000000u;
         /* 0221085C */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_02210860: ; // 0x2210860
-        /* 02210860 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02210864 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210860 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02210864 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210864 */ _t20 = _t19 & 0x00000001u;
         /* 02210864 */ if (_t20) goto L_02210868; else goto L_02210870;
   L_02210868: ; // 0x2210868
@@ -7288,9 +7288,9 @@ void Gambit_fn_022107B0(CPUState* cpu) {
         /* 02210874 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 02210874 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 02210878 */ cpu->r[12] = 0x101D0000u;
-        /* 0221087C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0221087C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02210880 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 02210884 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210884 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210884 */ _t23 = _t22 & 0x00000001u;
         /* 02210884 */ if (_t23) goto L_02210888; else goto L_022108A0;
   L_02210888: ; // 0x2210888
@@ -7303,8 +7303,8 @@ void Gambit_fn_022107B0(CPUState* cpu) {
         /* 0221089C */ _t25 = cpu->r[12] + 0x00000000u;
         /* 0221089C */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_022108A0: ; // 0x22108a0
-        /* 022108A0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 022108A4 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022108A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 022108A4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022108A4 */ _t27 = _t26 & 0x00000001u;
         /* 022108A4 */ if (_t27) goto L_022108A8; else goto L_022108B0;
   L_022108A8: ; // 0x22108a8
@@ -7316,9 +7316,9 @@ void Gambit_fn_022107B0(CPUState* cpu) {
         /* 022108B4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 022108B4 */ cpu->r[10] = _t28;
         /* 022108B8 */ cpu->r[7] = 0x101D0000u;
-        /* 022108BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 022108BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 022108C0 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 022108C4 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022108C4 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022108C4 */ _t30 = _t29 & 0x00000001u;
         /* 022108C4 */ if (_t30) goto L_022108C8; else goto L_022108DC;
   L_022108C8: ; // 0x22108c8
@@ -7330,8 +7330,8 @@ void Gambit_fn_022107B0(CPUState* cpu) {
         /* 022108D8 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 022108D8 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_022108DC: ; // 0x22108dc
-        /* 022108DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 022108E0 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022108DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 022108E0 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022108E0 */ _t34 = _t33 & 0x00000001u;
         /* 022108E0 */ if (_t34) goto L_022108E4; else goto L_022108EC;
   L_022108E4: ; // 0x22108e4
@@ -7343,9 +7343,9 @@ void Gambit_fn_022107B0(CPUState* cpu) {
         /* 022108F0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 022108F0 */ cpu->r[8] = _t35;
         /* 022108F4 */ cpu->r[6] = 0x101D0000u;
-        /* 022108F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 022108F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 022108FC */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 02210900 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210900 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210900 */ _t37 = _t36 & 0x00000001u;
         /* 02210900 */ if (_t37) goto L_02210904; else goto L_02210918;
   L_02210904: ; // 0x2210904
@@ -7384,9 +7384,9 @@ void Gambit_fn_0221093C(CPUState* cpu) {
         /* 02210940 */ _t0 = cpu->r[8] + 0xFFFFFD1Cu;
         /* 02210940 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 02210944 */ cpu->r[6] = 0x101D0000u;
-        /* 02210948 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02210948 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0221094C */ cpu->r[6] = cpu->r[6] + 0xFFFFFF08u;
-        /* 02210950 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210950 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210950 */ _t2 = _t1 & 0x00000001u;
         /* 02210950 */ if (_t2) goto L_02210954; else goto L_0221096C;
   L_02210954: ; // 0x2210954
@@ -7399,8 +7399,8 @@ void Gambit_fn_0221093C(CPUState* cpu) {
         /* 02210968 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 02210968 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_0221096C: ; // 0x221096c
-        /* 0221096C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 02210970 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221096C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 02210970 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210970 */ _t6 = _t5 & 0x00000001u;
         /* 02210970 */ if (_t6) goto L_02210974; else goto L_0221097C;
   L_02210974: ; // 0x2210974
@@ -7411,9 +7411,9 @@ void Gambit_fn_0221093C(CPUState* cpu) {
         /* 02210980 */ _t7 = cpu->r[10] + 0xFFFFE610u;
         /* 02210980 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 02210984 */ cpu->r[8] = 0x101D0000u;
-        /* 02210988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02210988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0221098C */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 02210990 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210990 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210990 */ _t9 = _t8 & 0x00000001u;
         /* 02210990 */ if (_t9) goto L_02210994; else goto L_022109AC;
   L_02210994: ; // 0x2210994
@@ -7426,8 +7426,8 @@ void Gambit_fn_0221093C(CPUState* cpu) {
         /* 022109A8 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 022109A8 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_022109AC: ; // 0x22109ac
-        /* 022109AC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 022109B0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022109AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 022109B0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022109B0 */ _t13 = _t12 & 0x00000001u;
         /* 022109B0 */ if (_t13) goto L_022109B4; else goto L_022109BC;
   L_022109B4: ; // 0x22109b4
@@ -7438,9 +7438,9 @@ void Gambit_fn_0221093C(CPUState* cpu) {
         /* 022109C0 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 022109C0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 022109C4 */ cpu->r[10] = 0x101D0000u;
-        /* 022109C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 022109C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 022109CC */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 022109D0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022109D0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022109D0 */ _t16 = _t15 & 0x00000001u;
         /* 022109D0 */ if (_t16) goto L_022109D4; else goto L_022109EC;
   L_022109D4: ; // 0x22109d4
@@ -7453,8 +7453,8 @@ void Gambit_fn_0221093C(CPUState* cpu) {
         /* 022109E8 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 022109E8 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_022109EC: ; // 0x22109ec
-        /* 022109EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 022109F0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022109EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 022109F0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022109F0 */ _t20 = _t19 & 0x00000001u;
         /* 022109F0 */ if (_t20) goto L_022109F4; else goto L_022109FC;
   L_022109F4: ; // 0x22109f4
@@ -7465,9 +7465,9 @@ void Gambit_fn_0221093C(CPUState* cpu) {
         /* 02210A00 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 02210A00 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 02210A04 */ cpu->r[12] = 0x101D0000u;
-        /* 02210A08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02210A08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02210A0C */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 02210A10 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210A10 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210A10 */ _t23 = _t22 & 0x00000001u;
         /* 02210A10 */ if (_t23) goto L_02210A14; else goto L_02210A2C;
   L_02210A14: ; // 0x2210a14
@@ -7480,8 +7480,8 @@ void Gambit_fn_0221093C(CPUState* cpu) {
         /* 02210A28 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 02210A28 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_02210A2C: ; // 0x2210a2c
-        /* 02210A2C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02210A30 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210A2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02210A30 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210A30 */ _t27 = _t26 & 0x00000001u;
         /* 02210A30 */ if (_t27) goto L_02210A34; else goto L_02210A3C;
   L_02210A34: ; // 0x2210a34
@@ -7493,9 +7493,9 @@ void Gambit_fn_0221093C(CPUState* cpu) {
         /* 02210A40 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 02210A40 */ cpu->r[10] = _t28;
         /* 02210A44 */ cpu->r[7] = 0x101D0000u;
-        /* 02210A48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02210A48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02210A4C */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 02210A50 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210A50 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210A50 */ _t30 = _t29 & 0x00000001u;
         /* 02210A50 */ if (_t30) goto L_02210A54; else goto L_02210A68;
   L_02210A54: ; // 0x2210a54
@@ -7507,8 +7507,8 @@ void Gambit_fn_0221093C(CPUState* cpu) {
         /* 02210A64 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 02210A64 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_02210A68: ; // 0x2210a68
-        /* 02210A68 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 02210A6C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210A68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 02210A6C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210A6C */ _t34 = _t33 & 0x00000001u;
         /* 02210A6C */ if (_t34) goto L_02210A70; else goto L_02210A78;
   L_02210A70: ; // 0x2210a70
@@ -7520,9 +7520,9 @@ void Gambit_fn_0221093C(CPUState* cpu) {
         /* 02210A7C */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 02210A7C */ cpu->r[8] = _t35;
         /* 02210A80 */ cpu->r[6] = 0x101D0000u;
-        /* 02210A84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02210A84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02210A88 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 02210A8C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210A8C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210A8C */ _t37 = _t36 & 0x00000001u;
         /* 02210A8C */ if (_t37) goto L_02210A90; else goto L_02210AA4;
   L_02210A90: ; // 0x2210a90
@@ -7561,9 +7561,9 @@ void Gambit_fn_02210AC8(CPUState* cpu) {
         /* 02210ACC */ _t0 = cpu->r[8] + 0xFFFFFD20u;
         /* 02210ACC */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 02210AD0 */ cpu->r[6] = 0x101D0000u;
-        /* 02210AD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02210AD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02210AD8 */ cpu->r[6] = cpu->r[6] + 0xFFFFFF0Cu;
-        /* 02210ADC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210ADC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210ADC */ _t2 = _t1 & 0x00000001u;
         /* 02210ADC */ if (_t2) goto L_02210AE0; else goto L_02210AF8;
   L_02210AE0: ; // 0x2210ae0
@@ -7576,8 +7576,8 @@ void Gambit_fn_02210AC8(CPUState* cpu) {
         /* 02210AF4 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 02210AF4 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_02210AF8: ; // 0x2210af8
-        /* 02210AF8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 02210AFC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210AF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 02210AFC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210AFC */ _t6 = _t5 & 0x00000001u;
         /* 02210AFC */ if (_t6) goto L_02210B00; else goto L_02210B08;
   L_02210B00: ; // 0x2210b00
@@ -7588,9 +7588,9 @@ void Gambit_fn_02210AC8(CPUState* cpu) {
         /* 02210B0C */ _t7 = cpu->r[10] + 0xFFFFE610u;
         /* 02210B0C */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 02210B10 */ cpu->r[8] = 0x101D0000u;
-        /* 02210B14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02210B14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02210B18 */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 02210B1C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210B1C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210B1C */ _t9 = _t8 & 0x00000001u;
         /* 02210B1C */ if (_t9) goto L_02210B20; else goto L_02210B38;
   L_02210B20: ; // 0x2210b20
@@ -7603,8 +7603,8 @@ void Gambit_fn_02210AC8(CPUState* cpu) {
         /* 02210B34 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 02210B34 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_02210B38: ; // 0x2210b38
-        /* 02210B38 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02210B3C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210B38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02210B3C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210B3C */ _t13 = _t12 & 0x00000001u;
         /* 02210B3C */ if (_t13) goto L_02210B40; else goto L_02210B48;
   L_02210B40: ; // 0x2210b40
@@ -7615,9 +7615,9 @@ void Gambit_fn_02210AC8(CPUState* cpu) {
         /* 02210B4C */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 02210B4C */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 02210B50 */ cpu->r[10] = 0x101D0000u;
-        /* 02210B54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02210B54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02210B58 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 02210B5C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210B5C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210B5C */ _t16 = _t15 & 0x00000001u;
         /* 02210B5C */ if (_t16) goto L_02210B60; else goto L_02210B78;
   L_02210B60: ; // 0x2210b60
@@ -7630,8 +7630,8 @@ void Gambit_fn_02210AC8(CPUState* cpu) {
         /* 02210B74 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 02210B74 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_02210B78: ; // 0x2210b78
-        /* 02210B78 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02210B7C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210B78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02210B7C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210B7C */ _t20 = _t19 & 0x00000001u;
         /* 02210B7C */ if (_t20) goto L_02210B80; else goto L_02210B88;
   L_02210B80: ; // 0x2210b80
@@ -7642,9 +7642,9 @@ void Gambit_fn_02210AC8(CPUState* cpu) {
         /* 02210B8C */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 02210B8C */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 02210B90 */ cpu->r[12] = 0x101D0000u;
-        /* 02210B94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02210B94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02210B98 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 02210B9C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210B9C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210B9C */ _t23 = _t22 & 0x00000001u;
         /* 02210B9C */ if (_t23) goto L_02210BA0; else goto L_02210BB8;
   L_02210BA0: ; // 0x2210ba0
@@ -7657,8 +7657,8 @@ void Gambit_fn_02210AC8(CPUState* cpu) {
         /* 02210BB4 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 02210BB4 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_02210BB8: ; // 0x2210bb8
-        /* 02210BB8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02210BBC */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210BB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02210BBC */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210BBC */ _t27 = _t26 & 0x00000001u;
         /* 02210BBC */ if (_t27) goto L_02210BC0; else goto L_02210BC8;
   L_02210BC0: ; // 0x2210bc0
@@ -7670,9 +7670,9 @@ void Gambit_fn_02210AC8(CPUState* cpu) {
         /* 02210BCC */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 02210BCC */ cpu->r[10] = _t28;
         /* 02210BD0 */ cpu->r[7] = 0x101D0000u;
-        /* 02210BD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02210BD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02210BD8 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 02210BDC */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210BDC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210BDC */ _t30 = _t29 & 0x00000001u;
         /* 02210BDC */ if (_t30) goto L_02210BE0; else goto L_02210BF4;
   L_02210BE0: ; // 0x2210be0
@@ -7684,8 +7684,8 @@ void Gambit_fn_02210AC8(CPUState* cpu) {
         /* 02210BF0 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 02210BF0 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_02210BF4: ; // 0x2210bf4
-        /* 02210BF4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 02210BF8 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210BF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 02210BF8 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210BF8 */ _t34 = _t33 & 0x00000001u;
         /* 02210BF8 */ if (_t34) goto L_02210BFC; else goto L_02210C04;
   L_02210BFC: ; // 0x2210bfc
@@ -7697,9 +7697,9 @@ void Gambit_fn_02210AC8(CPUState* cpu) {
         /* 02210C08 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 02210C08 */ cpu->r[8] = _t35;
         /* 02210C0C */ cpu->r[6] = 0x101D0000u;
-        /* 02210C10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02210C10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02210C14 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 02210C18 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210C18 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210C18 */ _t37 = _t36 & 0x00000001u;
         /* 02210C18 */ if (_t37) goto L_02210C1C; else goto L_02210C30;
   L_02210C1C: ; // 0x2210c1c
@@ -7738,9 +7738,9 @@ void Gambit_fn_02210C54(CPUState* cpu) {
         /* 02210C58 */ _t0 = cpu->r[8] + 0xFFFFFD24u;
         /* 02210C58 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 02210C5C */ cpu->r[6] = 0x101D0000u;
-        /* 02210C60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02210C60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02210C64 */ cpu->r[6] = cpu->r[6] + 0xFFFFFF10u;
-        /* 02210C68 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210C68 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210C68 */ _t2 = _t1 & 0x00000001u;
         /* 02210C68 */ if (_t2) goto L_02210C6C; else goto L_02210C84;
   L_02210C6C: ; // 0x2210c6c
@@ -7753,8 +7753,8 @@ void Gambit_fn_02210C54(CPUState* cpu) {
         /* 02210C80 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 02210C80 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_02210C84: ; // 0x2210c84
-        /* 02210C84 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 02210C88 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210C84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 02210C88 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210C88 */ _t6 = _t5 & 0x00000001u;
         /* 02210C88 */ if (_t6) goto L_02210C8C; else goto L_02210C94;
   L_02210C8C: ; // 0x2210c8c
@@ -7765,9 +7765,9 @@ void Gambit_fn_02210C54(CPUState* cpu) {
         /* 02210C98 */ _t7 = cpu->r[10] + 0xFFFFE610u;
         /* 02210C98 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 02210C9C */ cpu->r[8] = 0x101D0000u;
-        /* 02210CA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02210CA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02210CA4 */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 02210CA8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210CA8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210CA8 */ _t9 = _t8 & 0x00000001u;
         /* 02210CA8 */ if (_t9) goto L_02210CAC; else goto L_02210CC4;
   L_02210CAC: ; // 0x2210cac
@@ -7780,8 +7780,8 @@ void Gambit_fn_02210C54(CPUState* cpu) {
         /* 02210CC0 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 02210CC0 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_02210CC4: ; // 0x2210cc4
-        /* 02210CC4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02210CC8 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210CC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02210CC8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210CC8 */ _t13 = _t12 & 0x00000001u;
         /* 02210CC8 */ if (_t13) goto L_02210CCC; else goto L_02210CD4;
   L_02210CCC: ; // 0x2210ccc
@@ -7792,9 +7792,9 @@ void Gambit_fn_02210C54(CPUState* cpu) {
         /* 02210CD8 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 02210CD8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 02210CDC */ cpu->r[10] = 0x101D0000u;
-        /* 02210CE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02210CE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02210CE4 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 02210CE8 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210CE8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210CE8 */ _t16 = _t15 & 0x00000001u;
         /* 02210CE8 */ if (_t16) goto L_02210CEC; else goto L_02210D04;
   L_02210CEC: ; // 0x2210cec
@@ -7807,8 +7807,8 @@ void Gambit_fn_02210C54(CPUState* cpu) {
         /* 02210D00 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 02210D00 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_02210D04: ; // 0x2210d04
-        /* 02210D04 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02210D08 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210D04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02210D08 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210D08 */ _t20 = _t19 & 0x00000001u;
         /* 02210D08 */ if (_t20) goto L_02210D0C; else goto L_02210D14;
   L_02210D0C: ; // 0x2210d0c
@@ -7819,9 +7819,9 @@ void Gambit_fn_02210C54(CPUState* cpu) {
         /* 02210D18 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 02210D18 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 02210D1C */ cpu->r[12] = 0x101D0000u;
-        /* 02210D20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02210D20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02210D24 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 02210D28 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210D28 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210D28 */ _t23 = _t22 & 0x00000001u;
         /* 02210D28 */ if (_t23) goto L_02210D2C; else goto L_02210D44;
   L_02210D2C: ; // 0x2210d2c
@@ -7834,8 +7834,8 @@ void Gambit_fn_02210C54(CPUState* cpu) {
         /* 02210D40 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 02210D40 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_02210D44: ; // 0x2210d44
-        /* 02210D44 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02210D48 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210D44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02210D48 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210D48 */ _t27 = _t26 & 0x00000001u;
         /* 02210D48 */ if (_t27) goto L_02210D4C; else goto L_02210D54;
   L_02210D4C: ; // 0x2210d4c
@@ -7847,9 +7847,9 @@ void Gambit_fn_02210C54(CPUState* cpu) {
         /* 02210D58 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 02210D58 */ cpu->r[10] = _t28;
         /* 02210D5C */ cpu->r[7] = 0x101D0000u;
-        /* 02210D60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02210D60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02210D64 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 02210D68 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210D68 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210D68 */ _t30 = _t29 & 0x00000001u;
         /* 02210D68 */ if (_t30) goto L_02210D6C; else goto L_02210D80;
   L_02210D6C: ; // 0x2210d6c
@@ -7861,8 +7861,8 @@ void Gambit_fn_02210C54(CPUState* cpu) {
         /* 02210D7C */ _t32 = cpu->r[7] + 0x00000000u;
         /* 02210D7C */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_02210D80: ; // 0x2210d80
-        /* 02210D80 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 02210D84 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210D80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 02210D84 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210D84 */ _t34 = _t33 & 0x00000001u;
         /* 02210D84 */ if (_t34) goto L_02210D88; else goto L_02210D90;
   L_02210D88: ; // 0x2210d88
@@ -7874,9 +7874,9 @@ void Gambit_fn_02210C54(CPUState* cpu) {
         /* 02210D94 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 02210D94 */ cpu->r[8] = _t35;
         /* 02210D98 */ cpu->r[6] = 0x101D0000u;
-        /* 02210D9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02210D9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02210DA0 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 02210DA4 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210DA4 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210DA4 */ _t37 = _t36 & 0x00000001u;
         /* 02210DA4 */ if (_t37) goto L_02210DA8; else goto L_02210DBC;
   L_02210DA8: ; // 0x2210da8
@@ -7915,9 +7915,9 @@ void Gambit_fn_02210DE0(CPUState* cpu) {
         /* 02210DE4 */ _t0 = cpu->r[8] + 0xFFFFFD28u;
         /* 02210DE4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 02210DE8 */ cpu->r[6] = 0x101D0000u;
-        /* 02210DEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02210DEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02210DF0 */ cpu->r[6] = cpu->r[6] + 0xFFFFFF14u;
-        /* 02210DF4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210DF4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210DF4 */ _t2 = _t1 & 0x00000001u;
         /* 02210DF4 */ if (_t2) goto L_02210DF8; else goto L_02210E10;
   L_02210DF8: ; // 0x2210df8
@@ -7930,8 +7930,8 @@ void Gambit_fn_02210DE0(CPUState* cpu) {
         /* 02210E0C */ _t4 = cpu->r[6] + 0x00000000u;
         /* 02210E0C */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_02210E10: ; // 0x2210e10
-        /* 02210E10 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 02210E14 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210E10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 02210E14 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210E14 */ _t6 = _t5 & 0x00000001u;
         /* 02210E14 */ if (_t6) goto L_02210E18; else goto L_02210E20;
   L_02210E18: ; // 0x2210e18
@@ -7942,9 +7942,9 @@ void Gambit_fn_02210DE0(CPUState* cpu) {
         /* 02210E24 */ _t7 = cpu->r[10] + 0xFFFFE610u;
         /* 02210E24 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 02210E28 */ cpu->r[8] = 0x101D0000u;
-        /* 02210E2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02210E2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02210E30 */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 02210E34 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210E34 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210E34 */ _t9 = _t8 & 0x00000001u;
         /* 02210E34 */ if (_t9) goto L_02210E38; else goto L_02210E50;
   L_02210E38: ; // 0x2210e38
@@ -7957,8 +7957,8 @@ void Gambit_fn_02210DE0(CPUState* cpu) {
         /* 02210E4C */ _t11 = cpu->r[8] + 0x00000000u;
         /* 02210E4C */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_02210E50: ; // 0x2210e50
-        /* 02210E50 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02210E54 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210E50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02210E54 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210E54 */ _t13 = _t12 & 0x00000001u;
         /* 02210E54 */ if (_t13) goto L_02210E58; else goto L_02210E60;
   L_02210E58: ; // 0x2210e58
@@ -7969,9 +7969,9 @@ void Gambit_fn_02210DE0(CPUState* cpu) {
         /* 02210E64 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 02210E64 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 02210E68 */ cpu->r[10] = 0x101D0000u;
-        /* 02210E6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02210E6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02210E70 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 02210E74 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210E74 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210E74 */ _t16 = _t15 & 0x00000001u;
         /* 02210E74 */ if (_t16) goto L_02210E78; else goto L_02210E90;
   L_02210E78: ; // 0x2210e78
@@ -7984,8 +7984,8 @@ void Gambit_fn_02210DE0(CPUState* cpu) {
         /* 02210E8C */ _t18 = cpu->r[10] + 0x00000000u;
         /* 02210E8C */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_02210E90: ; // 0x2210e90
-        /* 02210E90 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02210E94 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210E90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02210E94 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210E94 */ _t20 = _t19 & 0x00000001u;
         /* 02210E94 */ if (_t20) goto L_02210E98; else goto L_02210EA0;
   L_02210E98: ; // 0x2210e98
@@ -7996,9 +7996,9 @@ void Gambit_fn_02210DE0(CPUState* cpu) {
         /* 02210EA4 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 02210EA4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 02210EA8 */ cpu->r[12] = 0x101D0000u;
-        /* 02210EAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02210EAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02210EB0 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 02210EB4 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210EB4 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210EB4 */ _t23 = _t22 & 0x00000001u;
         /* 02210EB4 */ if (_t23) goto L_02210EB8; else goto L_02210ED0;
   L_02210EB8: ; // 0x2210eb8
@@ -8011,8 +8011,8 @@ void Gambit_fn_02210DE0(CPUState* cpu) {
         /* 02210ECC */ _t25 = cpu->r[12] + 0x00000000u;
         /* 02210ECC */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_02210ED0: ; // 0x2210ed0
-        /* 02210ED0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02210ED4 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210ED0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02210ED4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210ED4 */ _t27 = _t26 & 0x00000001u;
         /* 02210ED4 */ if (_t27) goto L_02210ED8; else goto L_02210EE0;
   L_02210ED8: ; // 0x2210ed8
@@ -8024,9 +8024,9 @@ void Gambit_fn_02210DE0(CPUState* cpu) {
         /* 02210EE4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 02210EE4 */ cpu->r[10] = _t28;
         /* 02210EE8 */ cpu->r[7] = 0x101D0000u;
-        /* 02210EEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02210EEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02210EF0 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 02210EF4 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210EF4 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210EF4 */ _t30 = _t29 & 0x00000001u;
         /* 02210EF4 */ if (_t30) goto L_02210EF8; else goto L_02210F0C;
   L_02210EF8: ; // 0x2210ef8
@@ -8038,8 +8038,8 @@ void Gambit_fn_02210DE0(CPUState* cpu) {
         /* 02210F08 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 02210F08 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_02210F0C: ; // 0x2210f0c
-        /* 02210F0C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 02210F10 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210F0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 02210F10 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210F10 */ _t34 = _t33 & 0x00000001u;
         /* 02210F10 */ if (_t34) goto L_02210F14; else goto L_02210F1C;
   L_02210F14: ; // 0x2210f14
@@ -8051,9 +8051,9 @@ void Gambit_fn_02210DE0(CPUState* cpu) {
         /* 02210F20 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 02210F20 */ cpu->r[8] = _t35;
         /* 02210F24 */ cpu->r[6] = 0x101D0000u;
-        /* 02210F28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02210F28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02210F2C */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 02210F30 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210F30 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210F30 */ _t37 = _t36 & 0x00000001u;
         /* 02210F30 */ if (_t37) goto L_02210F34; else goto L_02210F48;
   L_02210F34: ; // 0x2210f34
@@ -8092,9 +8092,9 @@ void Gambit_fn_02210F6C(CPUState* cpu) {
         /* 02210F70 */ _t0 = cpu->r[7] + 0xFFFFFD2Cu;
         /* 02210F70 */ cpu->r[7] = rbrew_read32(cpu->mem, _t0);
         /* 02210F74 */ cpu->r[8] = 0x101D0000u;
-        /* 02210F78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02210F78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02210F7C */ cpu->r[8] = cpu->r[8] + 0xFFFFFF18u;
-        /* 02210F80 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210F80 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210F80 */ _t2 = _t1 & 0x00000001u;
         /* 02210F80 */ if (_t2) goto L_02210F84; else goto L_02210F9C;
   L_02210F84: ; // 0x2210f84
@@ -8107,8 +8107,8 @@ void Gambit_fn_02210F6C(CPUState* cpu) {
         /* 02210F98 */ _t4 = cpu->r[8] + 0x00000000u;
         /* 02210F98 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_02210F9C: ; // 0x2210f9c
-        /* 02210F9C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02210FA0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210F9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02210FA0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210FA0 */ _t6 = _t5 & 0x00000001u;
         /* 02210FA0 */ if (_t6) goto L_02210FA4; else goto L_02210FAC;
   L_02210FA4: ; // 0x2210fa4
@@ -8119,9 +8119,9 @@ void Gambit_fn_02210F6C(CPUState* cpu) {
         /* 02210FB0 */ _t7 = cpu->r[8] + 0xFFFFE614u;
         /* 02210FB0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 02210FB4 */ cpu->r[11] = 0x101D0000u;
-        /* 02210FB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02210FB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02210FBC */ cpu->r[11] = cpu->r[11] + 0xFFFFFECCu;
-        /* 02210FC0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210FC0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210FC0 */ _t9 = _t8 & 0x00000001u;
         /* 02210FC0 */ if (_t9) goto L_02210FC4; else goto L_02210FDC;
   L_02210FC4: ; // 0x2210fc4
@@ -8134,8 +8134,8 @@ void Gambit_fn_02210F6C(CPUState* cpu) {
         /* 02210FD8 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 02210FD8 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_02210FDC: ; // 0x2210fdc
-        /* 02210FDC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 02210FE0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02210FDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 02210FE0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02210FE0 */ _t13 = _t12 & 0x00000001u;
         /* 02210FE0 */ if (_t13) goto L_02210FE4; else goto L_02210FEC;
   L_02210FE4: ; // 0x2210fe4
@@ -8146,9 +8146,9 @@ void Gambit_fn_02210F6C(CPUState* cpu) {
         /* 02210FF0 */ _t14 = cpu->r[9] + 0xFFFFE610u;
         /* 02210FF0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t14);
         /* 02210FF4 */ cpu->r[8] = 0x101D0000u;
-        /* 02210FF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02210FF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02210FFC */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 02211000 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211000 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211000 */ _t16 = _t15 & 0x00000001u;
         /* 02211000 */ if (_t16) goto L_02211004; else goto L_0221101C;
   L_02211004: ; // 0x2211004
@@ -8161,8 +8161,8 @@ void Gambit_fn_02210F6C(CPUState* cpu) {
         /* 02211018 */ _t18 = cpu->r[8] + 0x00000000u;
         /* 02211018 */ rbrew_write32(cpu->mem, _t18, cpu->r[10]);
   L_0221101C: ; // 0x221101c
-        /* 0221101C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02211020 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221101C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02211020 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211020 */ _t20 = _t19 & 0x00000001u;
         /* 02211020 */ if (_t20) goto L_02211024; else goto L_0221102C;
   L_02211024: ; // 0x2211024
@@ -8173,9 +8173,9 @@ void Gambit_fn_02210F6C(CPUState* cpu) {
         /* 02211030 */ _t21 = cpu->r[11] + 0xFFFFDA00u;
         /* 02211030 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 02211034 */ cpu->r[8] = 0x101D0000u;
-        /* 02211038 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02211038 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0221103C */ cpu->r[8] = cpu->r[8] + 0xFFFFFBFCu;
-        /* 02211040 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211040 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211040 */ _t23 = _t22 & 0x00000001u;
         /* 02211040 */ if (_t23) goto L_02211044; else goto L_0221105C;
   L_02211044: ; // 0x2211044
@@ -8188,8 +8188,8 @@ void Gambit_fn_02210F6C(CPUState* cpu) {
         /* 02211058 */ _t25 = cpu->r[8] + 0x00000000u;
         /* 02211058 */ rbrew_write32(cpu->mem, _t25, cpu->r[9]);
   L_0221105C: ; // 0x221105c
-        /* 0221105C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02211060 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221105C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02211060 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211060 */ _t27 = _t26 & 0x00000001u;
         /* 02211060 */ if (_t27) goto L_02211064; else goto L_0221106C;
   L_02211064: ; // 0x2211064
@@ -8200,9 +8200,9 @@ void Gambit_fn_02210F6C(CPUState* cpu) {
         /* 02211070 */ _t28 = cpu->r[10] + 0xFFFFD9ECu;
         /* 02211070 */ cpu->r[10] = rbrew_read32(cpu->mem, _t28);
         /* 02211074 */ cpu->r[11] = 0x101D0000u;
-        /* 02211078 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02211078 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0221107C */ cpu->r[11] = cpu->r[11] + 0xFFFFFB4Cu;
-        /* 02211080 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211080 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211080 */ _t30 = _t29 & 0x00000001u;
         /* 02211080 */ if (_t30) goto L_02211084; else goto L_0221109C;
   L_02211084: ; // 0x2211084
@@ -8215,8 +8215,8 @@ void Gambit_fn_02210F6C(CPUState* cpu) {
         /* 02211098 */ _t32 = cpu->r[11] + 0x00000000u;
         /* 02211098 */ rbrew_write32(cpu->mem, _t32, cpu->r[7]);
   L_0221109C: ; // 0x221109c
-        /* 0221109C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 022110A0 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221109C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 022110A0 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022110A0 */ _t34 = _t33 & 0x00000001u;
         /* 022110A0 */ if (_t34) goto L_022110A4; else goto L_022110AC;
   L_022110A4: ; // 0x22110a4
@@ -8228,9 +8228,9 @@ void Gambit_fn_02210F6C(CPUState* cpu) {
         /* 022110B0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t35);
         /* 022110B0 */ cpu->r[11] = _t35;
         /* 022110B4 */ cpu->r[10] = 0x101D0000u;
-        /* 022110B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 022110B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 022110BC */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 022110C0 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022110C0 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022110C0 */ _t37 = _t36 & 0x00000001u;
         /* 022110C0 */ if (_t37) goto L_022110C4; else goto L_022110D8;
   L_022110C4: ; // 0x22110c4
@@ -8242,8 +8242,8 @@ void Gambit_fn_02210F6C(CPUState* cpu) {
         /* 022110D4 */ _t39 = cpu->r[10] + 0x00000000u;
         /* 022110D4 */ rbrew_write32(cpu->mem, _t39, cpu->r[0]);
   L_022110D8: ; // 0x22110d8
-        /* 022110D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 022110DC */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022110D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 022110DC */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022110DC */ _t41 = _t40 & 0x00000001u;
         /* 022110DC */ if (_t41) goto L_022110E0; else goto L_022110E8;
   L_022110E0: ; // 0x22110e0
@@ -8255,9 +8255,9 @@ void Gambit_fn_02210F6C(CPUState* cpu) {
         /* 022110EC */ cpu->r[9] = rbrew_read32(cpu->mem, _t42);
         /* 022110EC */ cpu->r[10] = _t42;
         /* 022110F0 */ cpu->r[11] = 0x101D0000u;
-        /* 022110F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 022110F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 022110F8 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 022110FC */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022110FC */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022110FC */ _t44 = _t43 & 0x00000001u;
         /* 022110FC */ if (_t44) goto L_02211100; else goto L_02211114;
   L_02211100: ; // 0x2211100
@@ -8298,9 +8298,9 @@ void Gambit_fn_0221113C(CPUState* cpu) {
         /* 02211140 */ _t0 = cpu->r[7] + 0xFFFFFD30u;
         /* 02211140 */ cpu->r[7] = rbrew_read32(cpu->mem, _t0);
         /* 02211144 */ cpu->r[8] = 0x101D0000u;
-        /* 02211148 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02211148 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0221114C */ cpu->r[8] = cpu->r[8] + 0xFFFFFF1Cu;
-        /* 02211150 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211150 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211150 */ _t2 = _t1 & 0x00000001u;
         /* 02211150 */ if (_t2) goto L_02211154; else goto L_0221116C;
   L_02211154: ; // 0x2211154
@@ -8313,8 +8313,8 @@ void Gambit_fn_0221113C(CPUState* cpu) {
         /* 02211168 */ _t4 = cpu->r[8] + 0x00000000u;
         /* 02211168 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_0221116C: ; // 0x221116c
-        /* 0221116C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02211170 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221116C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02211170 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211170 */ _t6 = _t5 & 0x00000001u;
         /* 02211170 */ if (_t6) goto L_02211174; else goto L_0221117C;
   L_02211174: ; // 0x2211174
@@ -8325,9 +8325,9 @@ void Gambit_fn_0221113C(CPUState* cpu) {
         /* 02211180 */ _t7 = cpu->r[8] + 0xFFFFE614u;
         /* 02211180 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 02211184 */ cpu->r[11] = 0x101D0000u;
-        /* 02211188 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02211188 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0221118C */ cpu->r[11] = cpu->r[11] + 0xFFFFFECCu;
-        /* 02211190 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211190 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211190 */ _t9 = _t8 & 0x00000001u;
         /* 02211190 */ if (_t9) goto L_02211194; else goto L_022111AC;
   L_02211194: ; // 0x2211194
@@ -8340,8 +8340,8 @@ void Gambit_fn_0221113C(CPUState* cpu) {
         /* 022111A8 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 022111A8 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_022111AC: ; // 0x22111ac
-        /* 022111AC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 022111B0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022111AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 022111B0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022111B0 */ _t13 = _t12 & 0x00000001u;
         /* 022111B0 */ if (_t13) goto L_022111B4; else goto L_022111BC;
   L_022111B4: ; // 0x22111b4
@@ -8352,9 +8352,9 @@ void Gambit_fn_0221113C(CPUState* cpu) {
         /* 022111C0 */ _t14 = cpu->r[9] + 0xFFFFE610u;
         /* 022111C0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t14);
         /* 022111C4 */ cpu->r[8] = 0x101D0000u;
-        /* 022111C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 022111C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 022111CC */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 022111D0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022111D0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022111D0 */ _t16 = _t15 & 0x00000001u;
         /* 022111D0 */ if (_t16) goto L_022111D4; else goto L_022111EC;
   L_022111D4: ; // 0x22111d4
@@ -8367,8 +8367,8 @@ void Gambit_fn_0221113C(CPUState* cpu) {
         /* 022111E8 */ _t18 = cpu->r[8] + 0x00000000u;
         /* 022111E8 */ rbrew_write32(cpu->mem, _t18, cpu->r[10]);
   L_022111EC: ; // 0x22111ec
-        /* 022111EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 022111F0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022111EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 022111F0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022111F0 */ _t20 = _t19 & 0x00000001u;
         /* 022111F0 */ if (_t20) goto L_022111F4; else goto L_022111FC;
   L_022111F4: ; // 0x22111f4
@@ -8379,9 +8379,9 @@ void Gambit_fn_0221113C(CPUState* cpu) {
         /* 02211200 */ _t21 = cpu->r[11] + 0xFFFFDA00u;
         /* 02211200 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 02211204 */ cpu->r[8] = 0x101D0000u;
-        /* 02211208 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02211208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0221120C */ cpu->r[8] = cpu->r[8] + 0xFFFFFBFCu;
-        /* 02211210 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211210 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211210 */ _t23 = _t22 & 0x00000001u;
         /* 02211210 */ if (_t23) goto L_02211214; else goto L_0221122C;
   L_02211214: ; // 0x2211214
@@ -8394,8 +8394,8 @@ void Gambit_fn_0221113C(CPUState* cpu) {
         /* 02211228 */ _t25 = cpu->r[8] + 0x00000000u;
         /* 02211228 */ rbrew_write32(cpu->mem, _t25, cpu->r[9]);
   L_0221122C: ; // 0x221122c
-        /* 0221122C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02211230 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221122C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02211230 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211230 */ _t27 = _t26 & 0x00000001u;
         /* 02211230 */ if (_t27) goto L_02211234; else goto L_0221123C;
   L_02211234: ; // 0x2211234
@@ -8406,9 +8406,9 @@ void Gambit_fn_0221113C(CPUState* cpu) {
         /* 02211240 */ _t28 = cpu->r[10] + 0xFFFFD9ECu;
         /* 02211240 */ cpu->r[10] = rbrew_read32(cpu->mem, _t28);
         /* 02211244 */ cpu->r[11] = 0x101D0000u;
-        /* 02211248 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02211248 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0221124C */ cpu->r[11] = cpu->r[11] + 0xFFFFFB4Cu;
-        /* 02211250 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211250 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211250 */ _t30 = _t29 & 0x00000001u;
         /* 02211250 */ if (_t30) goto L_02211254; else goto L_0221126C;
   L_02211254: ; // 0x2211254
@@ -8421,8 +8421,8 @@ void Gambit_fn_0221113C(CPUState* cpu) {
         /* 02211268 */ _t32 = cpu->r[11] + 0x00000000u;
         /* 02211268 */ rbrew_write32(cpu->mem, _t32, cpu->r[7]);
   L_0221126C: ; // 0x221126c
-        /* 0221126C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 02211270 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221126C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 02211270 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211270 */ _t34 = _t33 & 0x00000001u;
         /* 02211270 */ if (_t34) goto L_02211274; else goto L_0221127C;
   L_02211274: ; // 0x2211274
@@ -8434,9 +8434,9 @@ void Gambit_fn_0221113C(CPUState* cpu) {
         /* 02211280 */ cpu->r[0] = rbrew_read32(cpu->mem, _t35);
         /* 02211280 */ cpu->r[11] = _t35;
         /* 02211284 */ cpu->r[10] = 0x101D0000u;
-        /* 02211288 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02211288 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221128C */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 02211290 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211290 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211290 */ _t37 = _t36 & 0x00000001u;
         /* 02211290 */ if (_t37) goto L_02211294; else goto L_022112A8;
   L_02211294: ; // 0x2211294
@@ -8448,8 +8448,8 @@ void Gambit_fn_0221113C(CPUState* cpu) {
         /* 022112A4 */ _t39 = cpu->r[10] + 0x00000000u;
         /* 022112A4 */ rbrew_write32(cpu->mem, _t39, cpu->r[0]);
   L_022112A8: ; // 0x22112a8
-        /* 022112A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 022112AC */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022112A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 022112AC */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022112AC */ _t41 = _t40 & 0x00000001u;
         /* 022112AC */ if (_t41) goto L_022112B0; else goto L_022112B8;
   L_022112B0: ; // 0x22112b0
@@ -8461,9 +8461,9 @@ void Gambit_fn_0221113C(CPUState* cpu) {
         /* 022112BC */ cpu->r[9] = rbrew_read32(cpu->mem, _t42);
         /* 022112BC */ cpu->r[10] = _t42;
         /* 022112C0 */ cpu->r[11] = 0x101D0000u;
-        /* 022112C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 022112C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 022112C8 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 022112CC */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022112CC */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022112CC */ _t44 = _t43 & 0x00000001u;
         /* 022112CC */ if (_t44) goto L_022112D0; else goto L_022112E4;
   L_022112D0: ; // 0x22112d0
@@ -8504,9 +8504,9 @@ void Gambit_fn_0221130C(CPUState* cpu) {
         /* 02211310 */ _t0 = cpu->r[7] + 0xFFFFFD34u;
         /* 02211310 */ cpu->r[7] = rbrew_read32(cpu->mem, _t0);
         /* 02211314 */ cpu->r[8] = 0x101D0000u;
-        /* 02211318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02211318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0221131C */ cpu->r[8] = cpu->r[8] + 0xFFFFFF20u;
-        /* 02211320 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211320 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211320 */ _t2 = _t1 & 0x00000001u;
         /* 02211320 */ if (_t2) goto L_02211324; else goto L_0221133C;
   L_02211324: ; // 0x2211324
@@ -8519,8 +8519,8 @@ void Gambit_fn_0221130C(CPUState* cpu) {
         /* 02211338 */ _t4 = cpu->r[8] + 0x00000000u;
         /* 02211338 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_0221133C: ; // 0x221133c
-        /* 0221133C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02211340 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221133C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02211340 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211340 */ _t6 = _t5 & 0x00000001u;
         /* 02211340 */ if (_t6) goto L_02211344; else goto L_0221134C;
   L_02211344: ; // 0x2211344
@@ -8531,9 +8531,9 @@ void Gambit_fn_0221130C(CPUState* cpu) {
         /* 02211350 */ _t7 = cpu->r[8] + 0xFFFFE614u;
         /* 02211350 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 02211354 */ cpu->r[11] = 0x101D0000u;
-        /* 02211358 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02211358 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0221135C */ cpu->r[11] = cpu->r[11] + 0xFFFFFECCu;
-        /* 02211360 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211360 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211360 */ _t9 = _t8 & 0x00000001u;
         /* 02211360 */ if (_t9) goto L_02211364; else goto L_0221137C;
   L_02211364: ; // 0x2211364
@@ -8546,8 +8546,8 @@ void Gambit_fn_0221130C(CPUState* cpu) {
         /* 02211378 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 02211378 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_0221137C: ; // 0x221137c
-        /* 0221137C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 02211380 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221137C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 02211380 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211380 */ _t13 = _t12 & 0x00000001u;
         /* 02211380 */ if (_t13) goto L_02211384; else goto L_0221138C;
   L_02211384: ; // 0x2211384
@@ -8558,9 +8558,9 @@ void Gambit_fn_0221130C(CPUState* cpu) {
         /* 02211390 */ _t14 = cpu->r[9] + 0xFFFFE610u;
         /* 02211390 */ cpu->r[9] = rbrew_read32(cpu->mem, _t14);
         /* 02211394 */ cpu->r[8] = 0x101D0000u;
-        /* 02211398 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02211398 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0221139C */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 022113A0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022113A0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022113A0 */ _t16 = _t15 & 0x00000001u;
         /* 022113A0 */ if (_t16) goto L_022113A4; else goto L_022113BC;
   L_022113A4: ; // 0x22113a4
@@ -8573,8 +8573,8 @@ void Gambit_fn_0221130C(CPUState* cpu) {
         /* 022113B8 */ _t18 = cpu->r[8] + 0x00000000u;
         /* 022113B8 */ rbrew_write32(cpu->mem, _t18, cpu->r[10]);
   L_022113BC: ; // 0x22113bc
-        /* 022113BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 022113C0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022113BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 022113C0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022113C0 */ _t20 = _t19 & 0x00000001u;
         /* 022113C0 */ if (_t20) goto L_022113C4; else goto L_022113CC;
   L_022113C4: ; // 0x22113c4
@@ -8585,9 +8585,9 @@ void Gambit_fn_0221130C(CPUState* cpu) {
         /* 022113D0 */ _t21 = cpu->r[11] + 0xFFFFDA00u;
         /* 022113D0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 022113D4 */ cpu->r[8] = 0x101D0000u;
-        /* 022113D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 022113D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 022113DC */ cpu->r[8] = cpu->r[8] + 0xFFFFFBFCu;
-        /* 022113E0 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022113E0 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022113E0 */ _t23 = _t22 & 0x00000001u;
         /* 022113E0 */ if (_t23) goto L_022113E4; else goto L_022113FC;
   L_022113E4: ; // 0x22113e4
@@ -8600,8 +8600,8 @@ void Gambit_fn_0221130C(CPUState* cpu) {
         /* 022113F8 */ _t25 = cpu->r[8] + 0x00000000u;
         /* 022113F8 */ rbrew_write32(cpu->mem, _t25, cpu->r[9]);
   L_022113FC: ; // 0x22113fc
-        /* 022113FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02211400 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022113FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02211400 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211400 */ _t27 = _t26 & 0x00000001u;
         /* 02211400 */ if (_t27) goto L_02211404; else goto L_0221140C;
   L_02211404: ; // 0x2211404
@@ -8612,9 +8612,9 @@ void Gambit_fn_0221130C(CPUState* cpu) {
         /* 02211410 */ _t28 = cpu->r[10] + 0xFFFFD9ECu;
         /* 02211410 */ cpu->r[10] = rbrew_read32(cpu->mem, _t28);
         /* 02211414 */ cpu->r[11] = 0x101D0000u;
-        /* 02211418 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02211418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0221141C */ cpu->r[11] = cpu->r[11] + 0xFFFFFB4Cu;
-        /* 02211420 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211420 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211420 */ _t30 = _t29 & 0x00000001u;
         /* 02211420 */ if (_t30) goto L_02211424; else goto L_0221143C;
   L_02211424: ; // 0x2211424
@@ -8627,8 +8627,8 @@ void Gambit_fn_0221130C(CPUState* cpu) {
         /* 02211438 */ _t32 = cpu->r[11] + 0x00000000u;
         /* 02211438 */ rbrew_write32(cpu->mem, _t32, cpu->r[7]);
   L_0221143C: ; // 0x221143c
-        /* 0221143C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 02211440 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221143C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 02211440 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211440 */ _t34 = _t33 & 0x00000001u;
         /* 02211440 */ if (_t34) goto L_02211444; else goto L_0221144C;
   L_02211444: ; // 0x2211444
@@ -8640,9 +8640,9 @@ void Gambit_fn_0221130C(CPUState* cpu) {
         /* 02211450 */ cpu->r[0] = rbrew_read32(cpu->mem, _t35);
         /* 02211450 */ cpu->r[11] = _t35;
         /* 02211454 */ cpu->r[10] = 0x101D0000u;
-        /* 02211458 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02211458 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221145C */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 02211460 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211460 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211460 */ _t37 = _t36 & 0x00000001u;
         /* 02211460 */ if (_t37) goto L_02211464; else goto L_02211478;
   L_02211464: ; // 0x2211464
@@ -8654,8 +8654,8 @@ void Gambit_fn_0221130C(CPUState* cpu) {
         /* 02211474 */ _t39 = cpu->r[10] + 0x00000000u;
         /* 02211474 */ rbrew_write32(cpu->mem, _t39, cpu->r[0]);
   L_02211478: ; // 0x2211478
-        /* 02211478 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0221147C */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211478 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0221147C */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221147C */ _t41 = _t40 & 0x00000001u;
         /* 0221147C */ if (_t41) goto L_02211480; else goto L_02211488;
   L_02211480: ; // 0x2211480
@@ -8667,9 +8667,9 @@ void Gambit_fn_0221130C(CPUState* cpu) {
         /* 0221148C */ cpu->r[9] = rbrew_read32(cpu->mem, _t42);
         /* 0221148C */ cpu->r[10] = _t42;
         /* 02211490 */ cpu->r[11] = 0x101D0000u;
-        /* 02211494 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02211494 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02211498 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 0221149C */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221149C */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221149C */ _t44 = _t43 & 0x00000001u;
         /* 0221149C */ if (_t44) goto L_022114A0; else goto L_022114B4;
   L_022114A0: ; // 0x22114a0
@@ -8710,9 +8710,9 @@ void Gambit_fn_022114DC(CPUState* cpu) {
         /* 022114E0 */ _t0 = cpu->r[7] + 0xFFFFFD38u;
         /* 022114E0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t0);
         /* 022114E4 */ cpu->r[8] = 0x101D0000u;
-        /* 022114E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 022114E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 022114EC */ cpu->r[8] = cpu->r[8] + 0xFFFFFF24u;
-        /* 022114F0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022114F0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022114F0 */ _t2 = _t1 & 0x00000001u;
         /* 022114F0 */ if (_t2) goto L_022114F4; else goto L_0221150C;
   L_022114F4: ; // 0x22114f4
@@ -8725,8 +8725,8 @@ void Gambit_fn_022114DC(CPUState* cpu) {
         /* 02211508 */ _t4 = cpu->r[8] + 0x00000000u;
         /* 02211508 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_0221150C: ; // 0x221150c
-        /* 0221150C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02211510 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221150C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02211510 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211510 */ _t6 = _t5 & 0x00000001u;
         /* 02211510 */ if (_t6) goto L_02211514; else goto L_0221151C;
   L_02211514: ; // 0x2211514
@@ -8737,9 +8737,9 @@ void Gambit_fn_022114DC(CPUState* cpu) {
         /* 02211520 */ _t7 = cpu->r[8] + 0xFFFFE614u;
         /* 02211520 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 02211524 */ cpu->r[11] = 0x101D0000u;
-        /* 02211528 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02211528 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0221152C */ cpu->r[11] = cpu->r[11] + 0xFFFFFECCu;
-        /* 02211530 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211530 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211530 */ _t9 = _t8 & 0x00000001u;
         /* 02211530 */ if (_t9) goto L_02211534; else goto L_0221154C;
   L_02211534: ; // 0x2211534
@@ -8752,8 +8752,8 @@ void Gambit_fn_022114DC(CPUState* cpu) {
         /* 02211548 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 02211548 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_0221154C: ; // 0x221154c
-        /* 0221154C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 02211550 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221154C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 02211550 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211550 */ _t13 = _t12 & 0x00000001u;
         /* 02211550 */ if (_t13) goto L_02211554; else goto L_0221155C;
   L_02211554: ; // 0x2211554
@@ -8764,9 +8764,9 @@ void Gambit_fn_022114DC(CPUState* cpu) {
         /* 02211560 */ _t14 = cpu->r[9] + 0xFFFFE610u;
         /* 02211560 */ cpu->r[9] = rbrew_read32(cpu->mem, _t14);
         /* 02211564 */ cpu->r[8] = 0x101D0000u;
-        /* 02211568 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02211568 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0221156C */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 02211570 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211570 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211570 */ _t16 = _t15 & 0x00000001u;
         /* 02211570 */ if (_t16) goto L_02211574; else goto L_0221158C;
   L_02211574: ; // 0x2211574
@@ -8779,8 +8779,8 @@ void Gambit_fn_022114DC(CPUState* cpu) {
         /* 02211588 */ _t18 = cpu->r[8] + 0x00000000u;
         /* 02211588 */ rbrew_write32(cpu->mem, _t18, cpu->r[10]);
   L_0221158C: ; // 0x221158c
-        /* 0221158C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02211590 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221158C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02211590 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211590 */ _t20 = _t19 & 0x00000001u;
         /* 02211590 */ if (_t20) goto L_02211594; else goto L_0221159C;
   L_02211594: ; // 0x2211594
@@ -8791,9 +8791,9 @@ void Gambit_fn_022114DC(CPUState* cpu) {
         /* 022115A0 */ _t21 = cpu->r[11] + 0xFFFFDA00u;
         /* 022115A0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 022115A4 */ cpu->r[8] = 0x101D0000u;
-        /* 022115A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 022115A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 022115AC */ cpu->r[8] = cpu->r[8] + 0xFFFFFBFCu;
-        /* 022115B0 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022115B0 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022115B0 */ _t23 = _t22 & 0x00000001u;
         /* 022115B0 */ if (_t23) goto L_022115B4; else goto L_022115CC;
   L_022115B4: ; // 0x22115b4
@@ -8806,8 +8806,8 @@ void Gambit_fn_022114DC(CPUState* cpu) {
         /* 022115C8 */ _t25 = cpu->r[8] + 0x00000000u;
         /* 022115C8 */ rbrew_write32(cpu->mem, _t25, cpu->r[9]);
   L_022115CC: ; // 0x22115cc
-        /* 022115CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 022115D0 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022115CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 022115D0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022115D0 */ _t27 = _t26 & 0x00000001u;
         /* 022115D0 */ if (_t27) goto L_022115D4; else goto L_022115DC;
   L_022115D4: ; // 0x22115d4
@@ -8818,9 +8818,9 @@ void Gambit_fn_022114DC(CPUState* cpu) {
         /* 022115E0 */ _t28 = cpu->r[10] + 0xFFFFD9ECu;
         /* 022115E0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t28);
         /* 022115E4 */ cpu->r[11] = 0x101D0000u;
-        /* 022115E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 022115E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 022115EC */ cpu->r[11] = cpu->r[11] + 0xFFFFFB4Cu;
-        /* 022115F0 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022115F0 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022115F0 */ _t30 = _t29 & 0x00000001u;
         /* 022115F0 */ if (_t30) goto L_022115F4; else goto L_0221160C;
   L_022115F4: ; // 0x22115f4
@@ -8833,8 +8833,8 @@ void Gambit_fn_022114DC(CPUState* cpu) {
         /* 02211608 */ _t32 = cpu->r[11] + 0x00000000u;
         /* 02211608 */ rbrew_write32(cpu->mem, _t32, cpu->r[7]);
   L_0221160C: ; // 0x221160c
-        /* 0221160C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 02211610 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221160C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 02211610 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211610 */ _t34 = _t33 & 0x00000001u;
         /* 02211610 */ if (_t34) goto L_02211614; else goto L_0221161C;
   L_02211614: ; // 0x2211614
@@ -8846,9 +8846,9 @@ void Gambit_fn_022114DC(CPUState* cpu) {
         /* 02211620 */ cpu->r[0] = rbrew_read32(cpu->mem, _t35);
         /* 02211620 */ cpu->r[11] = _t35;
         /* 02211624 */ cpu->r[10] = 0x101D0000u;
-        /* 02211628 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02211628 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221162C */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 02211630 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211630 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211630 */ _t37 = _t36 & 0x00000001u;
         /* 02211630 */ if (_t37) goto L_02211634; else goto L_02211648;
   L_02211634: ; // 0x2211634
@@ -8860,8 +8860,8 @@ void Gambit_fn_022114DC(CPUState* cpu) {
         /* 02211644 */ _t39 = cpu->r[10] + 0x00000000u;
         /* 02211644 */ rbrew_write32(cpu->mem, _t39, cpu->r[0]);
   L_02211648: ; // 0x2211648
-        /* 02211648 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0221164C */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211648 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0221164C */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221164C */ _t41 = _t40 & 0x00000001u;
         /* 0221164C */ if (_t41) goto L_02211650; else goto L_02211658;
   L_02211650: ; // 0x2211650
@@ -8873,9 +8873,9 @@ void Gambit_fn_022114DC(CPUState* cpu) {
         /* 0221165C */ cpu->r[9] = rbrew_read32(cpu->mem, _t42);
         /* 0221165C */ cpu->r[10] = _t42;
         /* 02211660 */ cpu->r[11] = 0x101D0000u;
-        /* 02211664 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02211664 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02211668 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 0221166C */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221166C */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221166C */ _t44 = _t43 & 0x00000001u;
         /* 0221166C */ if (_t44) goto L_02211670; else goto L_02211684;
   L_02211670: ; // 0x2211670
@@ -8916,9 +8916,9 @@ void Gambit_fn_022116AC(CPUState* cpu) {
         /* 022116B0 */ _t0 = cpu->r[7] + 0xFFFFFD3Cu;
         /* 022116B0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t0);
         /* 022116B4 */ cpu->r[8] = 0x101D0000u;
-        /* 022116B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 022116B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 022116BC */ cpu->r[8] = cpu->r[8] + 0xFFFFFF28u;
-        /* 022116C0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022116C0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022116C0 */ _t2 = _t1 & 0x00000001u;
         /* 022116C0 */ if (_t2) goto L_022116C4; else goto L_022116DC;
   L_022116C4: ; // 0x22116c4
@@ -8931,8 +8931,8 @@ void Gambit_fn_022116AC(CPUState* cpu) {
         /* 022116D8 */ _t4 = cpu->r[8] + 0x00000000u;
         /* 022116D8 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_022116DC: ; // 0x22116dc
-        /* 022116DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 022116E0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022116DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 022116E0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022116E0 */ _t6 = _t5 & 0x00000001u;
         /* 022116E0 */ if (_t6) goto L_022116E4; else goto L_022116EC;
   L_022116E4: ; // 0x22116e4
@@ -8943,9 +8943,9 @@ void Gambit_fn_022116AC(CPUState* cpu) {
         /* 022116F0 */ _t7 = cpu->r[8] + 0xFFFFE614u;
         /* 022116F0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 022116F4 */ cpu->r[11] = 0x101D0000u;
-        /* 022116F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 022116F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 022116FC */ cpu->r[11] = cpu->r[11] + 0xFFFFFECCu;
-        /* 02211700 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211700 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211700 */ _t9 = _t8 & 0x00000001u;
         /* 02211700 */ if (_t9) goto L_02211704; else goto L_0221171C;
   L_02211704: ; // 0x2211704
@@ -8958,8 +8958,8 @@ void Gambit_fn_022116AC(CPUState* cpu) {
         /* 02211718 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 02211718 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_0221171C: ; // 0x221171c
-        /* 0221171C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 02211720 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221171C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 02211720 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211720 */ _t13 = _t12 & 0x00000001u;
         /* 02211720 */ if (_t13) goto L_02211724; else goto L_0221172C;
   L_02211724: ; // 0x2211724
@@ -8970,9 +8970,9 @@ void Gambit_fn_022116AC(CPUState* cpu) {
         /* 02211730 */ _t14 = cpu->r[9] + 0xFFFFE610u;
         /* 02211730 */ cpu->r[9] = rbrew_read32(cpu->mem, _t14);
         /* 02211734 */ cpu->r[8] = 0x101D0000u;
-        /* 02211738 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02211738 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0221173C */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 02211740 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211740 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211740 */ _t16 = _t15 & 0x00000001u;
         /* 02211740 */ if (_t16) goto L_02211744; else goto L_0221175C;
   L_02211744: ; // 0x2211744
@@ -8985,8 +8985,8 @@ void Gambit_fn_022116AC(CPUState* cpu) {
         /* 02211758 */ _t18 = cpu->r[8] + 0x00000000u;
         /* 02211758 */ rbrew_write32(cpu->mem, _t18, cpu->r[10]);
   L_0221175C: ; // 0x221175c
-        /* 0221175C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02211760 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221175C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02211760 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211760 */ _t20 = _t19 & 0x00000001u;
         /* 02211760 */ if (_t20) goto L_02211764; else goto L_0221176C;
   L_02211764: ; // 0x2211764
@@ -8997,9 +8997,9 @@ void Gambit_fn_022116AC(CPUState* cpu) {
         /* 02211770 */ _t21 = cpu->r[11] + 0xFFFFDA00u;
         /* 02211770 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 02211774 */ cpu->r[8] = 0x101D0000u;
-        /* 02211778 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02211778 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0221177C */ cpu->r[8] = cpu->r[8] + 0xFFFFFBFCu;
-        /* 02211780 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211780 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211780 */ _t23 = _t22 & 0x00000001u;
         /* 02211780 */ if (_t23) goto L_02211784; else goto L_0221179C;
   L_02211784: ; // 0x2211784
@@ -9012,8 +9012,8 @@ void Gambit_fn_022116AC(CPUState* cpu) {
         /* 02211798 */ _t25 = cpu->r[8] + 0x00000000u;
         /* 02211798 */ rbrew_write32(cpu->mem, _t25, cpu->r[9]);
   L_0221179C: ; // 0x221179c
-        /* 0221179C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 022117A0 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221179C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 022117A0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022117A0 */ _t27 = _t26 & 0x00000001u;
         /* 022117A0 */ if (_t27) goto L_022117A4; else goto L_022117AC;
   L_022117A4: ; // 0x22117a4
@@ -9024,9 +9024,9 @@ void Gambit_fn_022116AC(CPUState* cpu) {
         /* 022117B0 */ _t28 = cpu->r[10] + 0xFFFFD9ECu;
         /* 022117B0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t28);
         /* 022117B4 */ cpu->r[11] = 0x101D0000u;
-        /* 022117B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 022117B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 022117BC */ cpu->r[11] = cpu->r[11] + 0xFFFFFB4Cu;
-        /* 022117C0 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022117C0 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022117C0 */ _t30 = _t29 & 0x00000001u;
         /* 022117C0 */ if (_t30) goto L_022117C4; else goto L_022117DC;
   L_022117C4: ; // 0x22117c4
@@ -9039,8 +9039,8 @@ void Gambit_fn_022116AC(CPUState* cpu) {
         /* 022117D8 */ _t32 = cpu->r[11] + 0x00000000u;
         /* 022117D8 */ rbrew_write32(cpu->mem, _t32, cpu->r[7]);
   L_022117DC: ; // 0x22117dc
-        /* 022117DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 022117E0 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022117DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 022117E0 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022117E0 */ _t34 = _t33 & 0x00000001u;
         /* 022117E0 */ if (_t34) goto L_022117E4; else goto L_022117EC;
   L_022117E4: ; // 0x22117e4
@@ -9052,9 +9052,9 @@ void Gambit_fn_022116AC(CPUState* cpu) {
         /* 022117F0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t35);
         /* 022117F0 */ cpu->r[11] = _t35;
         /* 022117F4 */ cpu->r[10] = 0x101D0000u;
-        /* 022117F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 022117F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 022117FC */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 02211800 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211800 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211800 */ _t37 = _t36 & 0x00000001u;
         /* 02211800 */ if (_t37) goto L_02211804; else goto L_02211818;
   L_02211804: ; // 0x2211804
@@ -9066,8 +9066,8 @@ void Gambit_fn_022116AC(CPUState* cpu) {
         /* 02211814 */ _t39 = cpu->r[10] + 0x00000000u;
         /* 02211814 */ rbrew_write32(cpu->mem, _t39, cpu->r[0]);
   L_02211818: ; // 0x2211818
-        /* 02211818 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0221181C */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211818 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0221181C */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221181C */ _t41 = _t40 & 0x00000001u;
         /* 0221181C */ if (_t41) goto L_02211820; else goto L_02211828;
   L_02211820: ; // 0x2211820
@@ -9079,9 +9079,9 @@ void Gambit_fn_022116AC(CPUState* cpu) {
         /* 0221182C */ cpu->r[9] = rbrew_read32(cpu->mem, _t42);
         /* 0221182C */ cpu->r[10] = _t42;
         /* 02211830 */ cpu->r[11] = 0x101D0000u;
-        /* 02211834 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02211834 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02211838 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 0221183C */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221183C */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221183C */ _t44 = _t43 & 0x00000001u;
         /* 0221183C */ if (_t44) goto L_02211840; else goto L_02211854;
   L_02211840: ; // 0x2211840
@@ -9298,18 +9298,18 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 02211944 */ _t2 = cpu->r[1] + 0x00000058u;
         /* 02211944 */ rbrew_write_f32(cpu->mem, _t2, cpu->f[31]);
         /* 02211948 */ cpu->r[30] = cpu->r[3];
-        /* 02211948 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02211948 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0221194C */ _t3 = cpu->r[1] + 0x00000064u;
         /* 0221194C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02211950 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211950 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211950 */ _t5 = _t4 & 0x00000001u;
         /* 02211950 */ if (_t5) goto L_02211954; else goto L_02211964;
   L_02211954: ; // 0x2211954
         /* 02211954 */ cpu->r[3] = 0x00000224u;
         /* 02211958 */ Gambit_fn_02801A78(cpu);
         /* 0221195C */ cpu->r[30] = cpu->r[3];
-        /* 0221195C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02211960 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221195C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02211960 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211960 */ _t7 = _t6 & 0x00000001u;
         /* 02211960 */ if (_t7) goto L_022121F4; else goto L_02211964;
   L_02211964: ; // 0x2211964
@@ -9318,10 +9318,10 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 0221196C */ cpu->r[9] = 0x10050000u;
         /* 02211970 */ cpu->r[9] = cpu->r[9] + 0xFFFFB3C0u;
         /* 02211974 */ cpu->r[10] = cpu->r[30] + 0x00000128u;
-        /* 02211974 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02211974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02211978 */ _t8 = cpu->r[30] + 0x00000004u;
         /* 02211978 */ rbrew_write32(cpu->mem, _t8, cpu->r[9]);
-        /* 0221197C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221197C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221197C */ _t10 = _t9 & 0x00000001u;
         /* 0221197C */ if (_t10) goto L_02211980; else goto L_02211988;
   L_02211980: ; // 0x2211980
@@ -9329,8 +9329,8 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 02211984 */ Gambit_fn_02801A78(cpu);
   L_02211988: ; // 0x2211988
         /* 02211988 */ cpu->r[11] = cpu->r[30] + 0x00000134u;
-        /* 02211988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0221198C */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0221198C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221198C */ _t12 = _t11 & 0x00000001u;
         /* 0221198C */ if (_t12) goto L_02211990; else goto L_02211998;
   L_02211990: ; // 0x2211990
@@ -9341,10 +9341,10 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 0221199C */ _t13 = cpu->r[11] + 0xFFFFB140u;
         /* 0221199C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t13);
         /* 022119A0 */ cpu->r[12] = cpu->r[30] + 0x00000144u;
-        /* 022119A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 022119A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 022119A4 */ _t14 = cpu->r[30] + 0x00000140u;
         /* 022119A4 */ rbrew_write_f32(cpu->mem, _t14, cpu->f[31]);
-        /* 022119A8 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022119A8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022119A8 */ _t16 = _t15 & 0x00000001u;
         /* 022119A8 */ if (_t16) goto L_022119AC; else goto L_022119B4;
   L_022119AC: ; // 0x22119ac
@@ -9352,8 +9352,8 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 022119B0 */ Gambit_fn_02801A78(cpu);
   L_022119B4: ; // 0x22119b4
         /* 022119B4 */ cpu->r[0] = cpu->r[30] + 0x00000174u;
-        /* 022119B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022119B8 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022119B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022119B8 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022119B8 */ _t18 = _t17 & 0x00000001u;
         /* 022119B8 */ if (_t18) goto L_022119BC; else goto L_022119C4;
   L_022119BC: ; // 0x22119bc
@@ -9364,7 +9364,7 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 022119C8 */ _t19 = cpu->r[30] + 0x00000184u;
         /* 022119C8 */ rbrew_write16(cpu->mem, _t19, (uint16_t)cpu->r[28]);
         /* 022119CC */ cpu->r[29] = cpu->r[30] + 0x00000188u;
-        /* 022119CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 022119CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 022119D0 */ _t20 = cpu->r[30] + 0x00000186u;
         /* 022119D0 */ rbrew_write8(cpu->mem, _t20, (uint8_t)cpu->r[28]);
         /* 022119D4 */ _t21 = cpu->r[30] + 0x00000184u;
@@ -9379,15 +9379,15 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 022119E8 */ cpu->r[31] = cpu->r[31] + 0xFFFFB390u;
         /* 022119EC */ _t25 = cpu->r[30] + 0x00000184u;
         /* 022119EC */ rbrew_write32(cpu->mem, _t25, cpu->r[4]);
-        /* 022119F0 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022119F0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022119F0 */ _t27 = _t26 & 0x00000001u;
         /* 022119F0 */ if (_t27) goto L_022119F4; else goto L_02211A04;
   L_022119F4: ; // 0x22119f4
         /* 022119F4 */ cpu->r[3] = 0x00000038u;
         /* 022119F8 */ Gambit_fn_02801A78(cpu);
         /* 022119FC */ cpu->r[29] = cpu->r[3];
-        /* 022119FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02211A00 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022119FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02211A00 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211A00 */ _t29 = _t28 & 0x00000001u;
         /* 02211A00 */ if (_t29) goto L_02211A2C; else goto L_02211A04;
   L_02211A04: ; // 0x2211a04
@@ -9411,16 +9411,16 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 02211A28 */ rbrew_write32(cpu->mem, _t37, cpu->r[28]);
   L_02211A2C: ; // 0x2211a2c
         /* 02211A2C */ cpu->r[29] = cpu->r[30] + 0x000001C0u;
-        /* 02211A2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02211A30 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211A2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02211A30 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211A30 */ _t39 = _t38 & 0x00000001u;
         /* 02211A30 */ if (_t39) goto L_02211A34; else goto L_02211A44;
   L_02211A34: ; // 0x2211a34
         /* 02211A34 */ cpu->r[3] = 0x00000038u;
         /* 02211A38 */ Gambit_fn_02801A78(cpu);
         /* 02211A3C */ cpu->r[29] = cpu->r[3];
-        /* 02211A3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02211A40 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211A3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02211A40 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211A40 */ _t41 = _t40 & 0x00000001u;
         /* 02211A40 */ if (_t41) goto L_02211A6C; else goto L_02211A44;
   L_02211A44: ; // 0x2211a44
@@ -9444,8 +9444,8 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 02211A68 */ rbrew_write32(cpu->mem, _t49, cpu->r[28]);
   L_02211A6C: ; // 0x2211a6c
         /* 02211A6C */ cpu->r[6] = cpu->r[30] + 0x000001F8u;
-        /* 02211A6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 02211A70 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211A6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 02211A70 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211A70 */ _t51 = _t50 & 0x00000001u;
         /* 02211A70 */ if (_t51) goto L_02211A74; else goto L_02211A7C;
   L_02211A74: ; // 0x2211a74
@@ -9456,10 +9456,10 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 02211A7C */ rbrew_write_f32(cpu->mem, _t52, cpu->f[31]);
         /* 02211A80 */ cpu->r[7] = 0x00000100u;
         /* 02211A84 */ cpu->r[8] = cpu->r[30] + 0x0000020Cu;
-        /* 02211A84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02211A84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02211A88 */ _t53 = cpu->r[30] + 0x00000204u;
         /* 02211A88 */ rbrew_write32(cpu->mem, _t53, cpu->r[7]);
-        /* 02211A8C */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211A8C */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211A8C */ _t55 = _t54 & 0x00000001u;
         /* 02211A8C */ if (_t55) goto L_02211A90; else goto L_02211A98;
   L_02211A90: ; // 0x2211a90
@@ -9467,8 +9467,8 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 02211A94 */ Gambit_fn_02801A78(cpu);
   L_02211A98: ; // 0x2211a98
         /* 02211A98 */ cpu->r[0] = cpu->r[30] + 0x00000218u;
-        /* 02211A98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02211A9C */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211A98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02211A9C */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211A9C */ _t57 = _t56 & 0x00000001u;
         /* 02211A9C */ if (_t57) goto L_02211AA0; else goto L_02211AA8;
   L_02211AA0: ; // 0x2211aa0
@@ -9516,23 +9516,23 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 02211B20 */ _t66 = cpu->r[8] + 0x00000000u;
         /* 02211B20 */ cpu->r[9] = rbrew_read8(cpu->mem, _t66);
         /* 02211B24 */ cpu->r[31] = 0x00000000u;
-        /* 02211B28 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[29]);
+        /* 02211B28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[29]));
         /* 02211B2C */ cpu->r[11] = 0x00080000u;
-        /* 02211B30 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211B30 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211B30 */ _t68 = _t67 & 0x00000001u;
         /* 02211B30 */ if (_t68) goto L_02211B58; else goto L_02211B34;
   L_02211B34: ; // 0x2211b34
         /* 02211B34 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02211B38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[11]);
+        /* 02211B38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[11]));
         /* 02211B3C */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 02211B40 */ _t69 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02211B40 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02211B40 */ _t70 = _t69 & 0x00000001u;
         /* 02211B40 */ if (_t70) goto L_02211B54; else goto L_02211B44;
   L_02211B44: ; // 0x2211b44
         /* 02211B44 */ _t71 = cpu->r[8] + 0x00000000u;
         /* 02211B44 */ cpu->r[10] = rbrew_read8(cpu->mem, _t71);
-        /* 02211B48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[29]);
-        /* 02211B4C */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211B48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[29]));
+        /* 02211B4C */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211B4C */ _t73 = _t72 & 0x00000001u;
         /* 02211B4C */ if (_t73) goto L_02211B50; else goto L_02211B34;
   L_02211B50: ; // 0x2211b50
@@ -9544,10 +9544,10 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 02211B58 */ cpu->r[7] = rbrew_read32(cpu->mem, _t74);
         /* 02211B5C */ _t75 = cpu->r[1] + 0x00000010u;
         /* 02211B5C */ cpu->r[12] = rbrew_read32(cpu->mem, _t75);
-        /* 02211B60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 02211B60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 02211B64 */ _t76 = cpu->r[12] + 0x00000014u;
         /* 02211B64 */ cpu->r[0] = rbrew_read32(cpu->mem, _t76);
-        /* 02211B68 */ _t77 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02211B68 */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02211B68 */ _t78 = _t77 & 0x00000001u;
         /* 02211B68 */ if (_t78) goto L_02211B70; else goto L_02211B6C;
   L_02211B6C: ; // 0x2211b6c
@@ -9604,10 +9604,10 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 02211BF8 */ rbrew_write32(cpu->mem, _t92, cpu->r[9]);
         /* 02211BFC */ _t93 = cpu->r[30] + 0x0000019Cu;
         /* 02211BFC */ cpu->r[0] = rbrew_read32(cpu->mem, _t93);
-        /* 02211C00 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 02211C00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 02211C04 */ _t94 = cpu->r[30] + 0x000001A0u;
         /* 02211C04 */ cpu->r[25] = rbrew_read32(cpu->mem, _t94);
-        /* 02211C08 */ _t95 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02211C08 */ _t95 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02211C08 */ _t96 = _t95 & 0x00000001u;
         /* 02211C08 */ if (_t96) goto L_02211C0C; else goto L_02211C10;
   L_02211C0C: ; // 0x2211c0c
@@ -9623,23 +9623,23 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 02211C24 */ _t99 = cpu->r[9] + 0x00000000u;
         /* 02211C24 */ cpu->r[6] = rbrew_read8(cpu->mem, _t99);
         /* 02211C28 */ cpu->r[31] = 0x00000000u;
-        /* 02211C2C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[29]);
+        /* 02211C2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[29]));
         /* 02211C30 */ cpu->r[12] = 0x00080000u;
-        /* 02211C34 */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211C34 */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211C34 */ _t101 = _t100 & 0x00000001u;
         /* 02211C34 */ if (_t101) goto L_02211C5C; else goto L_02211C38;
   L_02211C38: ; // 0x2211c38
         /* 02211C38 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02211C3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 02211C3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 02211C40 */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 02211C44 */ _t102 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02211C44 */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02211C44 */ _t103 = _t102 & 0x00000001u;
         /* 02211C44 */ if (_t103) goto L_02211C58; else goto L_02211C48;
   L_02211C48: ; // 0x2211c48
         /* 02211C48 */ _t104 = cpu->r[9] + 0x00000000u;
         /* 02211C48 */ cpu->r[0] = rbrew_read8(cpu->mem, _t104);
-        /* 02211C4C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[29]);
-        /* 02211C50 */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211C4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[29]));
+        /* 02211C50 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211C50 */ _t106 = _t105 & 0x00000001u;
         /* 02211C50 */ if (_t106) goto L_02211C54; else goto L_02211C38;
   L_02211C54: ; // 0x2211c54
@@ -9651,10 +9651,10 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 02211C5C */ cpu->r[10] = rbrew_read32(cpu->mem, _t107);
         /* 02211C60 */ _t108 = cpu->r[1] + 0x00000010u;
         /* 02211C60 */ cpu->r[11] = rbrew_read32(cpu->mem, _t108);
-        /* 02211C64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 02211C64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 02211C68 */ _t109 = cpu->r[11] + 0x00000014u;
         /* 02211C68 */ cpu->r[0] = rbrew_read32(cpu->mem, _t109);
-        /* 02211C6C */ _t110 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02211C6C */ _t110 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02211C6C */ _t111 = _t110 & 0x00000001u;
         /* 02211C6C */ if (_t111) goto L_02211C74; else goto L_02211C70;
   L_02211C70: ; // 0x2211c70
@@ -9711,10 +9711,10 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 02211CFC */ rbrew_write32(cpu->mem, _t125, cpu->r[6]);
         /* 02211D00 */ _t126 = cpu->r[30] + 0x0000019Cu;
         /* 02211D00 */ cpu->r[0] = rbrew_read32(cpu->mem, _t126);
-        /* 02211D04 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000002u);
+        /* 02211D04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000002u));
         /* 02211D08 */ _t127 = cpu->r[30] + 0x000001A0u;
         /* 02211D08 */ cpu->r[31] = rbrew_read32(cpu->mem, _t127);
-        /* 02211D0C */ _t128 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02211D0C */ _t128 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02211D0C */ _t129 = _t128 & 0x00000001u;
         /* 02211D0C */ if (_t129) goto L_02211D10; else goto L_02211D14;
   L_02211D10: ; // 0x2211d10
@@ -9730,23 +9730,23 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 02211D28 */ _t132 = cpu->r[12] + 0x00000000u;
         /* 02211D28 */ cpu->r[0] = rbrew_read8(cpu->mem, _t132);
         /* 02211D2C */ cpu->r[25] = 0x00000000u;
-        /* 02211D30 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[29]);
+        /* 02211D30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[29]));
         /* 02211D34 */ cpu->r[4] = 0x00080000u;
-        /* 02211D38 */ _t133 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211D38 */ _t133 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211D38 */ _t134 = _t133 & 0x00000001u;
         /* 02211D38 */ if (_t134) goto L_02211D60; else goto L_02211D3C;
   L_02211D3C: ; // 0x2211d3c
         /* 02211D3C */ cpu->r[25] = cpu->r[25] + 0x00000001u;
-        /* 02211D40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], cpu->r[4]);
+        /* 02211D40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], cpu->r[4]));
         /* 02211D44 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 02211D48 */ _t135 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02211D48 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02211D48 */ _t136 = _t135 & 0x00000001u;
         /* 02211D48 */ if (_t136) goto L_02211D5C; else goto L_02211D4C;
   L_02211D4C: ; // 0x2211d4c
         /* 02211D4C */ _t137 = cpu->r[12] + 0x00000000u;
         /* 02211D4C */ cpu->r[5] = rbrew_read8(cpu->mem, _t137);
-        /* 02211D50 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[29]);
-        /* 02211D54 */ _t138 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211D50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[29]));
+        /* 02211D54 */ _t138 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211D54 */ _t139 = _t138 & 0x00000001u;
         /* 02211D54 */ if (_t139) goto L_02211D58; else goto L_02211D3C;
   L_02211D58: ; // 0x2211d58
@@ -9758,10 +9758,10 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 02211D60 */ cpu->r[12] = rbrew_read32(cpu->mem, _t140);
         /* 02211D64 */ _t141 = cpu->r[1] + 0x00000010u;
         /* 02211D64 */ cpu->r[7] = rbrew_read32(cpu->mem, _t141);
-        /* 02211D68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], cpu->r[12]);
+        /* 02211D68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], cpu->r[12]));
         /* 02211D6C */ _t142 = cpu->r[7] + 0x00000014u;
         /* 02211D6C */ cpu->r[0] = rbrew_read32(cpu->mem, _t142);
-        /* 02211D70 */ _t143 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02211D70 */ _t143 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02211D70 */ _t144 = _t143 & 0x00000001u;
         /* 02211D70 */ if (_t144) goto L_02211D78; else goto L_02211D74;
   L_02211D74: ; // 0x2211d74
@@ -9828,23 +9828,23 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 02211E1C */ _t162 = cpu->r[7] + 0x00000000u;
         /* 02211E1C */ cpu->r[8] = rbrew_read8(cpu->mem, _t162);
         /* 02211E20 */ cpu->r[31] = 0x00000000u;
-        /* 02211E24 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[29]);
+        /* 02211E24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[29]));
         /* 02211E28 */ cpu->r[8] = 0x00080000u;
-        /* 02211E2C */ _t163 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211E2C */ _t163 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211E2C */ _t164 = _t163 & 0x00000001u;
         /* 02211E2C */ if (_t164) goto L_02211E54; else goto L_02211E30;
   L_02211E30: ; // 0x2211e30
         /* 02211E30 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02211E34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[8]);
+        /* 02211E34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[8]));
         /* 02211E38 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 02211E3C */ _t165 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02211E3C */ _t165 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02211E3C */ _t166 = _t165 & 0x00000001u;
         /* 02211E3C */ if (_t166) goto L_02211E50; else goto L_02211E40;
   L_02211E40: ; // 0x2211e40
         /* 02211E40 */ _t167 = cpu->r[7] + 0x00000000u;
         /* 02211E40 */ cpu->r[9] = rbrew_read8(cpu->mem, _t167);
-        /* 02211E44 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[29]);
-        /* 02211E48 */ _t168 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211E44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[29]));
+        /* 02211E48 */ _t168 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211E48 */ _t169 = _t168 & 0x00000001u;
         /* 02211E48 */ if (_t169) goto L_02211E4C; else goto L_02211E30;
   L_02211E4C: ; // 0x2211e4c
@@ -9856,10 +9856,10 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 02211E54 */ cpu->r[4] = rbrew_read32(cpu->mem, _t170);
         /* 02211E58 */ _t171 = cpu->r[1] + 0x00000010u;
         /* 02211E58 */ cpu->r[10] = rbrew_read32(cpu->mem, _t171);
-        /* 02211E5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[4]);
+        /* 02211E5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[4]));
         /* 02211E60 */ _t172 = cpu->r[10] + 0x00000014u;
         /* 02211E60 */ cpu->r[0] = rbrew_read32(cpu->mem, _t172);
-        /* 02211E64 */ _t173 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02211E64 */ _t173 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02211E64 */ _t174 = _t173 & 0x00000001u;
         /* 02211E64 */ if (_t174) goto L_02211E6C; else goto L_02211E68;
   L_02211E68: ; // 0x2211e68
@@ -9916,10 +9916,10 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 02211EF4 */ rbrew_write32(cpu->mem, _t188, cpu->r[6]);
         /* 02211EF8 */ _t189 = cpu->r[30] + 0x000001D4u;
         /* 02211EF8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t189);
-        /* 02211EFC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x00000001u);
+        /* 02211EFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x00000001u));
         /* 02211F00 */ _t190 = cpu->r[30] + 0x000001D8u;
         /* 02211F00 */ cpu->r[25] = rbrew_read32(cpu->mem, _t190);
-        /* 02211F04 */ _t191 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02211F04 */ _t191 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02211F04 */ _t192 = _t191 & 0x00000001u;
         /* 02211F04 */ if (_t192) goto L_02211F08; else goto L_02211F0C;
   L_02211F08: ; // 0x2211f08
@@ -9935,23 +9935,23 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 02211F20 */ _t195 = cpu->r[12] + 0x00000000u;
         /* 02211F20 */ cpu->r[8] = rbrew_read8(cpu->mem, _t195);
         /* 02211F24 */ cpu->r[31] = 0x00000000u;
-        /* 02211F28 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[29]);
+        /* 02211F28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[29]));
         /* 02211F2C */ cpu->r[0] = 0x00080000u;
-        /* 02211F30 */ _t196 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211F30 */ _t196 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211F30 */ _t197 = _t196 & 0x00000001u;
         /* 02211F30 */ if (_t197) goto L_02211F58; else goto L_02211F34;
   L_02211F34: ; // 0x2211f34
         /* 02211F34 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02211F38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 02211F38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 02211F3C */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 02211F40 */ _t198 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02211F40 */ _t198 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02211F40 */ _t199 = _t198 & 0x00000001u;
         /* 02211F40 */ if (_t199) goto L_02211F54; else goto L_02211F44;
   L_02211F44: ; // 0x2211f44
         /* 02211F44 */ _t200 = cpu->r[12] + 0x00000000u;
         /* 02211F44 */ cpu->r[9] = rbrew_read8(cpu->mem, _t200);
-        /* 02211F48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[29]);
-        /* 02211F4C */ _t201 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02211F48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[29]));
+        /* 02211F4C */ _t201 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02211F4C */ _t202 = _t201 & 0x00000001u;
         /* 02211F4C */ if (_t202) goto L_02211F50; else goto L_02211F34;
   L_02211F50: ; // 0x2211f50
@@ -9963,10 +9963,10 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 02211F58 */ cpu->r[6] = rbrew_read32(cpu->mem, _t203);
         /* 02211F5C */ _t204 = cpu->r[1] + 0x00000010u;
         /* 02211F5C */ cpu->r[10] = rbrew_read32(cpu->mem, _t204);
-        /* 02211F60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[6]);
+        /* 02211F60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[6]));
         /* 02211F64 */ _t205 = cpu->r[10] + 0x00000014u;
         /* 02211F64 */ cpu->r[0] = rbrew_read32(cpu->mem, _t205);
-        /* 02211F68 */ _t206 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02211F68 */ _t206 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02211F68 */ _t207 = _t206 & 0x00000001u;
         /* 02211F68 */ if (_t207) goto L_02211F70; else goto L_02211F6C;
   L_02211F6C: ; // 0x2211f6c
@@ -10023,10 +10023,10 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 02211FF8 */ rbrew_write32(cpu->mem, _t221, cpu->r[7]);
         /* 02211FFC */ _t222 = cpu->r[30] + 0x000001D4u;
         /* 02211FFC */ cpu->r[8] = rbrew_read32(cpu->mem, _t222);
-        /* 02212000 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000002u);
+        /* 02212000 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000002u));
         /* 02212004 */ _t223 = cpu->r[30] + 0x000001D8u;
         /* 02212004 */ cpu->r[25] = rbrew_read32(cpu->mem, _t223);
-        /* 02212008 */ _t224 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02212008 */ _t224 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02212008 */ _t225 = _t224 & 0x00000001u;
         /* 02212008 */ if (_t225) goto L_0221200C; else goto L_02212010;
   L_0221200C: ; // 0x221200c
@@ -10042,23 +10042,23 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 02212024 */ _t228 = cpu->r[8] + 0x00000000u;
         /* 02212024 */ cpu->r[9] = rbrew_read8(cpu->mem, _t228);
         /* 02212028 */ cpu->r[31] = 0x00000000u;
-        /* 0221202C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[29]);
+        /* 0221202C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[29]));
         /* 02212030 */ cpu->r[10] = 0x00080000u;
-        /* 02212034 */ _t229 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212034 */ _t229 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212034 */ _t230 = _t229 & 0x00000001u;
         /* 02212034 */ if (_t230) goto L_0221205C; else goto L_02212038;
   L_02212038: ; // 0x2212038
         /* 02212038 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0221203C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 0221203C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 02212040 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
-        /* 02212044 */ _t231 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02212044 */ _t231 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02212044 */ _t232 = _t231 & 0x00000001u;
         /* 02212044 */ if (_t232) goto L_02212058; else goto L_02212048;
   L_02212048: ; // 0x2212048
         /* 02212048 */ _t233 = cpu->r[8] + 0x00000000u;
         /* 02212048 */ cpu->r[0] = rbrew_read8(cpu->mem, _t233);
-        /* 0221204C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[29]);
-        /* 02212050 */ _t234 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221204C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[29]));
+        /* 02212050 */ _t234 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212050 */ _t235 = _t234 & 0x00000001u;
         /* 02212050 */ if (_t235) goto L_02212054; else goto L_02212038;
   L_02212054: ; // 0x2212054
@@ -10070,10 +10070,10 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 0221205C */ cpu->r[8] = rbrew_read32(cpu->mem, _t236);
         /* 02212060 */ _t237 = cpu->r[1] + 0x00000010u;
         /* 02212060 */ cpu->r[11] = rbrew_read32(cpu->mem, _t237);
-        /* 02212064 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[8]);
+        /* 02212064 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[8]));
         /* 02212068 */ _t238 = cpu->r[11] + 0x00000014u;
         /* 02212068 */ cpu->r[12] = rbrew_read32(cpu->mem, _t238);
-        /* 0221206C */ _t239 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221206C */ _t239 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221206C */ _t240 = _t239 & 0x00000001u;
         /* 0221206C */ if (_t240) goto L_02212074; else goto L_02212070;
   L_02212070: ; // 0x2212070
@@ -10130,10 +10130,10 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 022120FC */ rbrew_write32(cpu->mem, _t254, cpu->r[8]);
         /* 02212100 */ _t255 = cpu->r[30] + 0x000001D4u;
         /* 02212100 */ cpu->r[0] = rbrew_read32(cpu->mem, _t255);
-        /* 02212104 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
+        /* 02212104 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
         /* 02212108 */ _t256 = cpu->r[30] + 0x000001D8u;
         /* 02212108 */ cpu->r[31] = rbrew_read32(cpu->mem, _t256);
-        /* 0221210C */ _t257 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221210C */ _t257 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221210C */ _t258 = _t257 & 0x00000001u;
         /* 0221210C */ if (_t258) goto L_02212110; else goto L_02212114;
   L_02212110: ; // 0x2212110
@@ -10149,23 +10149,23 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 02212128 */ _t261 = cpu->r[4] + 0x00000000u;
         /* 02212128 */ cpu->r[10] = rbrew_read8(cpu->mem, _t261);
         /* 0221212C */ cpu->r[27] = 0x00000000u;
-        /* 02212130 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[29]);
+        /* 02212130 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[29]));
         /* 02212134 */ cpu->r[5] = 0x00080000u;
-        /* 02212138 */ _t262 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212138 */ _t262 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212138 */ _t263 = _t262 & 0x00000001u;
         /* 02212138 */ if (_t263) goto L_02212160; else goto L_0221213C;
   L_0221213C: ; // 0x221213c
         /* 0221213C */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 02212140 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[5]);
+        /* 02212140 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[5]));
         /* 02212144 */ cpu->r[4] = cpu->r[4] + 0x00000001u;
-        /* 02212148 */ _t264 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02212148 */ _t264 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02212148 */ _t265 = _t264 & 0x00000001u;
         /* 02212148 */ if (_t265) goto L_0221215C; else goto L_0221214C;
   L_0221214C: ; // 0x221214c
         /* 0221214C */ _t266 = cpu->r[4] + 0x00000000u;
         /* 0221214C */ cpu->r[11] = rbrew_read8(cpu->mem, _t266);
-        /* 02212150 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[29]);
-        /* 02212154 */ _t267 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212150 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[29]));
+        /* 02212154 */ _t267 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212154 */ _t268 = _t267 & 0x00000001u;
         /* 02212154 */ if (_t268) goto L_02212158; else goto L_0221213C;
   L_02212158: ; // 0x2212158
@@ -10177,10 +10177,10 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 02212160 */ cpu->r[10] = rbrew_read32(cpu->mem, _t269);
         /* 02212164 */ _t270 = cpu->r[1] + 0x00000010u;
         /* 02212164 */ cpu->r[12] = rbrew_read32(cpu->mem, _t270);
-        /* 02212168 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[10]);
+        /* 02212168 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[10]));
         /* 0221216C */ _t271 = cpu->r[12] + 0x00000014u;
         /* 0221216C */ cpu->r[0] = rbrew_read32(cpu->mem, _t271);
-        /* 02212170 */ _t272 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02212170 */ _t272 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02212170 */ _t273 = _t272 & 0x00000001u;
         /* 02212170 */ if (_t273) goto L_02212178; else goto L_02212174;
   L_02212174: ; // 0x2212174
@@ -10236,7 +10236,7 @@ void Gambit_fn_02211930(CPUState* cpu) {
         /* 022121FC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t286);
         /* 02212200 */ _t287 = cpu->r[1] + 0x00000050u;
         /* 02212200 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t287);
-        /* 02212204 */ _t288 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02212204 */ _t288 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02212204 */ _t289 = _t288 & 0x00000001u;
         /* 02212204 */ if (_t289) goto L_02212208; // else: addr-0 trap, fall-through
   L_02212208: ; // 0x2212208
@@ -10569,10 +10569,10 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212458 */ _t60 = cpu->r[1] + 0x0000011Cu;
         /* 02212458 */ rbrew_write_f32(cpu->mem, _t60, cpu->f[13]);
         /* 0221245C */ cpu->r[0] = rbrew_rlwinm(cpu->r[29], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0221245C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221245C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02212460 */ _t61 = cpu->r[1] + 0x00000124u;
         /* 02212460 */ rbrew_write_f32(cpu->mem, _t61, cpu->f[7]);
-        /* 02212464 */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212464 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212464 */ _t63 = _t62 & 0x00000001u;
         /* 02212464 */ if (_t63) goto L_0221252C; else goto L_02212468;
   L_02212468: ; // 0x2212468
@@ -10590,8 +10590,8 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212484 */ cpu->r[24] = 0x00000002u;
         /* 02212488 */ _t68 = cpu->r[5] + 0xFFFFB2E0u;
         /* 02212488 */ cpu->f[11] = rbrew_read_f64(cpu->mem, _t68);
-        /* 0221248C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[31]);
-        /* 02212490 */ _t69 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221248C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[31]));
+        /* 02212490 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02212490 */ _t70 = _t69 & 0x00000001u;
         /* 02212490 */ if (_t70) goto L_02212494; else goto L_02212498;
   L_02212494: ; // 0x2212494
@@ -10646,10 +10646,10 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212510 */ cpu->f[1] = fma(cpu->f[10], cpu->f[10], cpu->f[6]);
         /* 02212514 */ _t87 = cpu->r[10] + 0xFFFFB240u;
         /* 02212514 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t87);
-        /* 02212518 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[28]);
+        /* 02212518 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[28]));
         /* 0221251C */ cpu->r[29] = rbrew_rlwinm(cpu->r[29], 0x00000000u, 0x00000018u, 0x0000001Fu);
         /* 02212520 */ cpu->r[20] = 0x00000001u;
-        /* 02212524 */ _t88 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02212524 */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02212524 */ _t89 = _t88 & 0x00000001u;
         /* 02212524 */ if (_t89) goto L_02212528; else goto L_02212620;
   L_02212528: ; // 0x2212528
@@ -10669,8 +10669,8 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212548 */ cpu->r[24] = cpu->r[22];
         /* 0221254C */ _t94 = cpu->r[5] + 0xFFFFB2E0u;
         /* 0221254C */ cpu->f[11] = rbrew_read_f64(cpu->mem, _t94);
-        /* 02212550 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[31]);
-        /* 02212554 */ _t95 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02212550 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[31]));
+        /* 02212554 */ _t95 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02212554 */ _t96 = _t95 & 0x00000001u;
         /* 02212554 */ if (_t96) goto L_02212558; else goto L_0221255C;
   L_02212558: ; // 0x2212558
@@ -10726,10 +10726,10 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 022125D8 */ cpu->f[1] = fma(cpu->f[10], cpu->f[10], cpu->f[6]);
         /* 022125DC */ _t113 = cpu->r[10] + 0xFFFFB240u;
         /* 022125DC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t113);
-        /* 022125E0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[28]);
+        /* 022125E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[28]));
         /* 022125E4 */ cpu->r[29] = rbrew_rlwinm(cpu->r[29], 0x00000000u, 0x00000018u, 0x0000001Fu);
         /* 022125E8 */ cpu->r[20] = 0x00000001u;
-        /* 022125EC */ _t114 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022125EC */ _t114 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022125EC */ _t115 = _t114 & 0x00000001u;
         /* 022125EC */ if (_t115) goto L_022125F0; else goto L_02212620;
   L_022125F0: ; // 0x22125f0
@@ -10750,8 +10750,8 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 0221261C */ _t119 = cpu->r[1] + 0x000000ACu;
         /* 0221261C */ rbrew_write_f32(cpu->mem, _t119, cpu->f[11]);
   L_02212620: ; // 0x2212620
-        /* 02212620 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02212624 */ _t120 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212620 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02212624 */ _t120 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212624 */ _t121 = _t120 & 0x00000001u;
         /* 02212624 */ if (_t121) goto L_02212628; else goto L_02212678;
   L_02212628: ; // 0x2212628
@@ -10774,14 +10774,14 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 0221265C */ _t125 = cpu->r[1] + 0x00000010u;
         /* 0221265C */ rbrew_write32(cpu->mem, _t125, cpu->r[0]);
         /* 02212660 */ Gambit_fn_021F4508(cpu);
-        /* 02212664 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02212668 */ _t126 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212664 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02212668 */ _t126 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212668 */ _t127 = _t126 & 0x00000001u;
         /* 02212668 */ if (_t127) goto L_022127D0; else goto L_0221266C;
   L_0221266C: ; // 0x221266c
-        /* 0221266C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], 0x00000000u);
+        /* 0221266C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], 0x00000000u));
         /* 02212670 */ cpu->r[29] = 0x00000001u;
-        /* 02212674 */ _t128 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02212674 */ _t128 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02212674 */ _t129 = _t128 & 0x00000001u;
         /* 02212674 */ if (_t129) goto L_022126E0; else goto L_02212678;
   L_02212678: ; // 0x2212678
@@ -10801,7 +10801,7 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212690 */ rbrew_write32(cpu->mem, _t136, cpu->r[7]);
         /* 02212694 */ _t137 = cpu->r[1] + 0x00000024u;
         /* 02212694 */ rbrew_write32(cpu->mem, _t137, cpu->r[12]);
-        /* 02212698 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], cpu->r[0]);
+        /* 02212698 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], cpu->r[0]));
         /* 0221269C */ _t138 = cpu->r[27] + 0x00000000u;
         /* 0221269C */ cpu->r[21] = rbrew_read32(cpu->mem, _t138);
         /* 022126A0 */ _t139 = cpu->r[1] + 0x00000028u;
@@ -10816,7 +10816,7 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 022126B0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t143);
         /* 022126B4 */ _t144 = cpu->r[1] + 0x00000018u;
         /* 022126B4 */ rbrew_write32(cpu->mem, _t144, cpu->r[11]);
-        /* 022126B8 */ _t145 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022126B8 */ _t145 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022126B8 */ _t146 = _t145 & 0x00000001u;
         /* 022126B8 */ if (_t146) goto L_022126BC; else goto L_022126C0;
   L_022126BC: ; // 0x22126bc
@@ -10824,14 +10824,14 @@ void Gambit_fn_022122B0(CPUState* cpu) {
   L_022126C0: ; // 0x22126c0
         /* 022126C0 */ _t147 = cpu->r[1] + 0x00000054u;
         /* 022126C0 */ rbrew_write32(cpu->mem, _t147, cpu->r[12]);
-        /* 022126C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 022126C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 022126C8 */ _t148 = cpu->r[1] + 0x00000058u;
         /* 022126C8 */ rbrew_write32(cpu->mem, _t148, cpu->r[9]);
         /* 022126CC */ cpu->r[16] = cpu->r[0] - cpu->r[31];
         /* 022126D0 */ cpu->r[27] = 0x00000001u;
         /* 022126D4 */ _t149 = cpu->r[1] + 0x0000001Cu;
         /* 022126D4 */ rbrew_write32(cpu->mem, _t149, cpu->r[3]);
-        /* 022126D8 */ _t150 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022126D8 */ _t150 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022126D8 */ _t151 = _t150 & 0x00000001u;
         /* 022126D8 */ if (_t151) goto L_02212920; else goto L_022126DC;
   L_022126DC: ; // 0x22126dc
@@ -10839,8 +10839,8 @@ void Gambit_fn_022122B0(CPUState* cpu) {
   L_022126E0: ; // 0x22126e0
         /* 022126E0 */ _t152 = cpu->r[28] + 0x00000000u;
         /* 022126E0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t152);
-        /* 022126E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], cpu->r[31]);
-        /* 022126E8 */ _t153 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022126E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], cpu->r[31]));
+        /* 022126E8 */ _t153 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022126E8 */ _t154 = _t153 & 0x00000001u;
         /* 022126E8 */ if (_t154) goto L_022126EC; else goto L_02212750;
   L_022126EC: ; // 0x22126ec
@@ -10866,14 +10866,14 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212710 */ cpu->r[0] = rbrew_read32(cpu->mem, _t164);
         /* 02212714 */ _t165 = cpu->r[1] + 0x00000014u;
         /* 02212714 */ rbrew_write32(cpu->mem, _t165, cpu->r[21]);
-        /* 02212718 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], cpu->r[0]);
+        /* 02212718 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], cpu->r[0]));
         /* 0221271C */ _t166 = cpu->r[27] + 0x00000004u;
         /* 0221271C */ cpu->r[11] = rbrew_read32(cpu->mem, _t166);
         /* 02212720 */ _t167 = cpu->r[28] + 0x00000024u;
         /* 02212720 */ cpu->r[5] = rbrew_read32(cpu->mem, _t167);
         /* 02212724 */ _t168 = cpu->r[1] + 0x00000018u;
         /* 02212724 */ rbrew_write32(cpu->mem, _t168, cpu->r[11]);
-        /* 02212728 */ _t169 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02212728 */ _t169 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02212728 */ _t170 = _t169 & 0x00000001u;
         /* 02212728 */ if (_t170) goto L_0221272C; else goto L_02212730;
   L_0221272C: ; // 0x221272c
@@ -10881,14 +10881,14 @@ void Gambit_fn_022122B0(CPUState* cpu) {
   L_02212730: ; // 0x2212730
         /* 02212730 */ _t171 = cpu->r[1] + 0x00000054u;
         /* 02212730 */ rbrew_write32(cpu->mem, _t171, cpu->r[12]);
-        /* 02212734 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 02212734 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 02212738 */ _t172 = cpu->r[1] + 0x00000058u;
         /* 02212738 */ rbrew_write32(cpu->mem, _t172, cpu->r[9]);
         /* 0221273C */ cpu->r[16] = cpu->r[0] - cpu->r[31];
         /* 02212740 */ cpu->r[27] = 0x00000001u;
         /* 02212744 */ _t173 = cpu->r[1] + 0x0000001Cu;
         /* 02212744 */ rbrew_write32(cpu->mem, _t173, cpu->r[3]);
-        /* 02212748 */ _t174 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02212748 */ _t174 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02212748 */ _t175 = _t174 & 0x00000001u;
         /* 02212748 */ if (_t175) goto L_02212920; else goto L_0221274C;
   L_0221274C: ; // 0x221274c
@@ -10936,10 +10936,10 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 022127B4 */ cpu->f[10] = cpu->f[11] + cpu->f[12];
         /* 022127B8 */ /* nop */
         /* 022127BC */ /* nop */
-        /* 022127C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 022127C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 022127C4 */ _t190 = cpu->r[1] + 0x00000124u;
         /* 022127C4 */ rbrew_write_f32(cpu->mem, _t190, cpu->f[10]);
-        /* 022127C8 */ _t191 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022127C8 */ _t191 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022127C8 */ _t192 = _t191 & 0x00000001u;
         /* 022127C8 */ if (_t192) goto L_022127CC; else goto L_02212EF4;
   L_022127CC: ; // 0x22127cc
@@ -10947,8 +10947,8 @@ void Gambit_fn_022122B0(CPUState* cpu) {
   L_022127D0: ; // 0x22127d0
         /* 022127D0 */ _t193 = cpu->r[28] + 0x00000028u;
         /* 022127D0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t193);
-        /* 022127D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
-        /* 022127D8 */ _t194 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022127D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
+        /* 022127D8 */ _t194 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022127D8 */ _t195 = _t194 & 0x00000001u;
         /* 022127D8 */ if (_t195) goto L_022127DC; else goto L_02212840;
   L_022127DC: ; // 0x22127dc
@@ -10978,10 +10978,10 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212808 */ cpu->r[11] = rbrew_read32(cpu->mem, _t207);
         /* 0221280C */ _t208 = cpu->r[27] + 0x00000008u;
         /* 0221280C */ cpu->r[3] = rbrew_read32(cpu->mem, _t208);
-        /* 02212810 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], cpu->r[0]);
+        /* 02212810 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], cpu->r[0]));
         /* 02212814 */ _t209 = cpu->r[1] + 0x00000018u;
         /* 02212814 */ rbrew_write32(cpu->mem, _t209, cpu->r[11]);
-        /* 02212818 */ _t210 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02212818 */ _t210 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02212818 */ _t211 = _t210 & 0x00000001u;
         /* 02212818 */ if (_t211) goto L_0221281C; else goto L_02212820;
   L_0221281C: ; // 0x221281c
@@ -10989,14 +10989,14 @@ void Gambit_fn_022122B0(CPUState* cpu) {
   L_02212820: ; // 0x2212820
         /* 02212820 */ _t212 = cpu->r[1] + 0x00000054u;
         /* 02212820 */ rbrew_write32(cpu->mem, _t212, cpu->r[12]);
-        /* 02212824 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 02212824 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 02212828 */ _t213 = cpu->r[1] + 0x00000058u;
         /* 02212828 */ rbrew_write32(cpu->mem, _t213, cpu->r[9]);
         /* 0221282C */ cpu->r[16] = cpu->r[0] - cpu->r[31];
         /* 02212830 */ cpu->r[27] = 0x00000001u;
         /* 02212834 */ _t214 = cpu->r[1] + 0x0000001Cu;
         /* 02212834 */ rbrew_write32(cpu->mem, _t214, cpu->r[3]);
-        /* 02212838 */ _t215 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02212838 */ _t215 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02212838 */ _t216 = _t215 & 0x00000001u;
         /* 02212838 */ if (_t216) goto L_02212920; else goto L_0221283C;
   L_0221283C: ; // 0x221283c
@@ -11069,7 +11069,7 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 022128DC */ rbrew_write32(cpu->mem, _t241, cpu->r[9]);
         /* 022128E0 */ _t242 = cpu->r[1] + 0x00000014u;
         /* 022128E0 */ rbrew_write32(cpu->mem, _t242, cpu->r[21]);
-        /* 022128E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], cpu->r[0]);
+        /* 022128E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], cpu->r[0]));
         /* 022128E8 */ _t243 = cpu->r[27] + 0x00000008u;
         /* 022128E8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t243);
         /* 022128EC */ _t244 = cpu->r[27] + 0x00000004u;
@@ -11079,7 +11079,7 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 022128F4 */ cpu->r[20] = 0x00000000u;
         /* 022128F8 */ _t246 = cpu->r[1] + 0x00000018u;
         /* 022128F8 */ rbrew_write32(cpu->mem, _t246, cpu->r[11]);
-        /* 022128FC */ _t247 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022128FC */ _t247 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022128FC */ _t248 = _t247 & 0x00000001u;
         /* 022128FC */ if (_t248) goto L_02212900; else goto L_02212904;
   L_02212900: ; // 0x2212900
@@ -11087,14 +11087,14 @@ void Gambit_fn_022122B0(CPUState* cpu) {
   L_02212904: ; // 0x2212904
         /* 02212904 */ _t249 = cpu->r[1] + 0x00000054u;
         /* 02212904 */ rbrew_write32(cpu->mem, _t249, cpu->r[12]);
-        /* 02212908 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
+        /* 02212908 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
         /* 0221290C */ _t250 = cpu->r[1] + 0x00000058u;
         /* 0221290C */ rbrew_write32(cpu->mem, _t250, cpu->r[9]);
         /* 02212910 */ cpu->r[16] = cpu->r[0] - cpu->r[31];
         /* 02212914 */ cpu->r[27] = cpu->r[29];
         /* 02212918 */ _t251 = cpu->r[1] + 0x0000001Cu;
         /* 02212918 */ rbrew_write32(cpu->mem, _t251, cpu->r[3]);
-        /* 0221291C */ _t252 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221291C */ _t252 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221291C */ _t253 = _t252 & 0x00000001u;
         /* 0221291C */ if (_t253) goto L_02212920; else goto L_02212D88;
   L_02212920: ; // 0x2212920
@@ -11107,8 +11107,8 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212934 */ cpu->r[21] = cpu->r[12] + cpu->r[10];
         /* 02212938 */ goto L_02212944;
   L_0221293C: ; // 0x221293c
-        /* 0221293C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 02212940 */ _t255 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221293C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 02212940 */ _t255 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212940 */ _t256 = _t255 & 0x00000001u;
         /* 02212940 */ if (_t256) goto L_02212964; else goto L_02212944;
   L_02212944: ; // 0x2212944
@@ -11188,11 +11188,11 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 022129F8 */ _t283 = cpu->r[1] + 0x00000028u;
         /* 022129F8 */ rbrew_write_f32(cpu->mem, _t283, cpu->f[5]);
         /* 022129FC */ /* nop */
-        /* 02212A00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02212A00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02212A04 */ /* nop */
         /* 02212A08 */ cpu->r[5] = cpu->r[5] + 0xFFFFFFFFu;
         /* 02212A0C */ /* nop */
-        /* 02212A10 */ _t284 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212A10 */ _t284 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212A10 */ _t285 = _t284 & 0x00000001u;
         /* 02212A10 */ if (_t285) goto L_02212C5C; else goto L_02212A14;
   L_02212A14: ; // 0x2212a14
@@ -11205,17 +11205,17 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212A20 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t288);
         /* 02212A24 */ _t289 = cpu->r[1] + 0x00000014u;
         /* 02212A24 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t289);
-        /* 02212A28 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[11]);
+        /* 02212A28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[11]));
         /* 02212A2C */ cpu->f[4] = fma(cpu->f[13], cpu->f[13], cpu->f[8]);
-        /* 02212A30 */ _t290 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02212A30 */ _t290 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02212A30 */ _t291 = _t290 & 0x00000001u;
         /* 02212A30 */ if (_t291) goto L_02212A34; else goto L_02212C5C;
   L_02212A34: ; // 0x2212a34
         /* 02212A34 */ _t292 = cpu->r[28] + 0x00000010u;
         /* 02212A34 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t292);
         /* 02212A38 */ cpu->f[10] = cpu->f[0] * cpu->f[0];
-        /* 02212A3C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[4], cpu->f[10]);
-        /* 02212A40 */ _t293 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02212A3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[4], cpu->f[10]));
+        /* 02212A40 */ _t293 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02212A40 */ _t294 = _t293 & 0x00000001u;
         /* 02212A40 */ if (_t294) goto L_02212A58; else goto L_02212A44;
   L_02212A44: ; // 0x2212a44
@@ -11224,25 +11224,25 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212A48 */ _t296 = cpu->r[28] + 0x00000014u;
         /* 02212A48 */ cpu->r[8] = rbrew_read32(cpu->mem, _t296);
         /* 02212A4C */ cpu->r[6] = cpu->r[31] - cpu->r[7];
-        /* 02212A50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], cpu->r[8]);
-        /* 02212A54 */ _t297 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02212A50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], cpu->r[8]));
+        /* 02212A54 */ _t297 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02212A54 */ _t298 = _t297 & 0x00000001u;
         /* 02212A54 */ if (_t298) goto L_02212C5C; else goto L_02212A58;
   L_02212A58: ; // 0x2212a58
         /* 02212A58 */ _t299 = cpu->r[1] + 0x0000006Cu;
         /* 02212A58 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t299);
         /* 02212A5C */ cpu->r[27] = 0x00000000u;
-        /* 02212A60 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[11]);
+        /* 02212A60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[11]));
         /* 02212A64 */ cpu->f[8] = cpu->f[25];
-        /* 02212A68 */ _t300 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02212A68 */ _t300 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02212A68 */ _t301 = _t300 & 0x00000001u;
         /* 02212A68 */ if (_t301) goto L_02212A84; else goto L_02212A6C;
   L_02212A6C: ; // 0x2212a6c
         /* 02212A6C */ cpu->f[11] = cpu->f[11] - cpu->f[10];
         /* 02212A70 */ cpu->f[12] = cpu->f[7] - cpu->f[10];
         /* 02212A74 */ cpu->f[8] = cpu->f[11] / cpu->f[12];
-        /* 02212A78 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[26]);
-        /* 02212A7C */ _t302 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02212A78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[26]));
+        /* 02212A7C */ _t302 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02212A7C */ _t303 = _t302 & 0x00000001u;
         /* 02212A7C */ if (_t303) goto L_02212A80; else goto L_02212A84;
   L_02212A80: ; // 0x2212a80
@@ -11254,15 +11254,15 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212A88 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t305);
         /* 02212A8C */ cpu->f[13] = cpu->f[6] * cpu->f[6];
         /* 02212A90 */ cpu->f[12] = fma(cpu->f[10], cpu->f[10], cpu->f[13]);
-        /* 02212A94 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[25]);
-        /* 02212A98 */ _t306 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02212A94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[25]));
+        /* 02212A98 */ _t306 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02212A98 */ _t307 = _t306 & 0x00000001u;
         /* 02212A98 */ if (_t307) goto L_02212AB0; else goto L_02212A9C;
   L_02212A9C: ; // 0x2212a9c
         /* 02212A9C */ cpu->f[13] = cpu->f[25] * cpu->f[12];
-        /* 02212AA0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
+        /* 02212AA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
         /* 02212AA4 */ cpu->f[10] = cpu->f[25];
-        /* 02212AA8 */ _t308 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02212AA8 */ _t308 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02212AA8 */ _t309 = _t308 & 0x00000001u;
         /* 02212AA8 */ if (_t309) goto L_02212B34; else goto L_02212AAC;
   L_02212AAC: ; // 0x2212aac
@@ -11278,21 +11278,21 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212AC4 */ cpu->f[13] = cpu->f[16] * cpu->f[12];
         /* 02212AC8 */ _t312 = cpu->r[28] + 0x00000010u;
         /* 02212AC8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t312);
-        /* 02212ACC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
+        /* 02212ACC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
         /* 02212AD0 */ cpu->f[10] = cpu->f[25];
-        /* 02212AD4 */ _t313 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02212AD4 */ _t313 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02212AD4 */ _t314 = _t313 & 0x00000001u;
         /* 02212AD4 */ if (_t314) goto L_02212B34; else goto L_02212AD8;
   L_02212AD8: ; // 0x2212ad8
-        /* 02212AD8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[4], cpu->f[25]);
-        /* 02212ADC */ _t315 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02212AD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[4], cpu->f[25]));
+        /* 02212ADC */ _t315 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02212ADC */ _t316 = _t315 & 0x00000001u;
         /* 02212ADC */ if (_t316) goto L_02212AF4; else goto L_02212AE0;
   L_02212AE0: ; // 0x2212ae0
         /* 02212AE0 */ cpu->f[0] = -fma(cpu->f[13], cpu->f[13], -(cpu->f[4]));
-        /* 02212AE4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[25]);
+        /* 02212AE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[25]));
         /* 02212AE8 */ cpu->f[6] = cpu->f[25] * cpu->f[4];
-        /* 02212AEC */ _t317 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212AEC */ _t317 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212AEC */ _t318 = _t317 & 0x00000001u;
         /* 02212AEC */ if (_t318) goto L_02212B34; else goto L_02212AF0;
   L_02212AF0: ; // 0x2212af0
@@ -11306,9 +11306,9 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212B00 */ cpu->f[20] = -fma(cpu->f[20], cpu->f[4], -(cpu->f[31]));
         /* 02212B04 */ cpu->f[19] = cpu->f[20] * cpu->f[21];
         /* 02212B08 */ cpu->f[0] = -fma(cpu->f[13], cpu->f[13], -(cpu->f[4]));
-        /* 02212B0C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[25]);
+        /* 02212B0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[25]));
         /* 02212B10 */ cpu->f[6] = cpu->f[19] * cpu->f[4];
-        /* 02212B14 */ _t321 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212B14 */ _t321 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212B14 */ _t322 = _t321 & 0x00000001u;
         /* 02212B14 */ if (_t322) goto L_02212B34; else goto L_02212B18;
   L_02212B18: ; // 0x2212b18
@@ -11317,8 +11317,8 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212B1C */ cpu->f[10] = cpu->f[6] - cpu->f[13];
         /* 02212B20 */ cpu->f[6] = cpu->f[7] - cpu->f[13];
         /* 02212B24 */ cpu->f[10] = cpu->f[6] / cpu->f[10];
-        /* 02212B28 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[26]);
-        /* 02212B2C */ _t324 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02212B28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[26]));
+        /* 02212B2C */ _t324 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02212B2C */ _t325 = _t324 & 0x00000001u;
         /* 02212B2C */ if (_t325) goto L_02212B30; else goto L_02212B34;
   L_02212B30: ; // 0x2212b30
@@ -11332,10 +11332,10 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212B40 */ cpu->r[6] = cpu->r[12] + 0xFFFFFFFFu;
         /* 02212B44 */ _t328 = cpu->r[1] + 0x00000018u;
         /* 02212B44 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t328);
-        /* 02212B48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], cpu->r[7]);
+        /* 02212B48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], cpu->r[7]));
         /* 02212B4C */ _t329 = cpu->r[1] + 0x00000014u;
         /* 02212B4C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t329);
-        /* 02212B50 */ _t330 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02212B50 */ _t330 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02212B50 */ _t331 = _t330 & 0x00000001u;
         /* 02212B50 */ if (_t331) goto L_02212B5C; else goto L_02212B54;
   L_02212B54: ; // 0x2212b54
@@ -11437,8 +11437,8 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212C54 */ /* nop */
         /* 02212C58 */ /* nop */
   L_02212C5C: ; // 0x2212c5c
-        /* 02212C5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[22]);
-        /* 02212C60 */ _t361 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02212C5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[22]));
+        /* 02212C60 */ _t361 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02212C60 */ _t362 = _t361 & 0x00000001u;
         /* 02212C60 */ if (_t362) goto L_02212C64; else goto L_02212C84;
   L_02212C64: ; // 0x2212c64
@@ -11456,8 +11456,8 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212C7C */ rbrew_write_f32(cpu->mem, _t367, cpu->f[5]);
         /* 02212C80 */ cpu->r[17] = cpu->r[17] + 0x0000000Cu;
   L_02212C84: ; // 0x2212c84
-        /* 02212C84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 02212C88 */ _t368 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212C84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 02212C88 */ _t368 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212C88 */ _t369 = _t368 & 0x00000001u;
         /* 02212C88 */ if (_t369) goto L_02212C8C; else goto L_02212D60;
   L_02212C8C: ; // 0x2212c8c
@@ -11474,10 +11474,10 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212CA8 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t372);
         /* 02212CAC */ cpu->f[8] = fma(cpu->f[6], cpu->f[6], cpu->f[13]);
         /* 02212CB0 */ cpu->f[1] = fma(cpu->f[0], cpu->f[0], cpu->f[8]);
-        /* 02212CB4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[25]);
+        /* 02212CB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[25]));
         /* 02212CB8 */ _t373 = cpu->r[1] + 0x00000034u;
         /* 02212CB8 */ rbrew_write_f32(cpu->mem, _t373, cpu->f[0]);
-        /* 02212CBC */ _t374 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02212CBC */ _t374 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02212CBC */ _t375 = _t374 & 0x00000001u;
         /* 02212CBC */ if (_t375) goto L_02212CC0; else goto L_02212CF0;
   L_02212CC0: ; // 0x2212cc0
@@ -11498,8 +11498,8 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212CEC */ _t379 = cpu->r[1] + 0x00000034u;
         /* 02212CEC */ rbrew_write_f32(cpu->mem, _t379, cpu->f[11]);
   L_02212CF0: ; // 0x2212cf0
-        /* 02212CF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02212CF4 */ _t380 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212CF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02212CF4 */ _t380 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212CF4 */ _t381 = _t380 & 0x00000001u;
         /* 02212CF4 */ if (_t381) goto L_02212CF8; else goto L_02212D44;
   L_02212CF8: ; // 0x2212cf8
@@ -11521,14 +11521,14 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212D28 */ _t385 = cpu->r[1] + 0x00000010u;
         /* 02212D28 */ rbrew_write32(cpu->mem, _t385, cpu->r[19]);
         /* 02212D2C */ Gambit_fn_021F4508(cpu);
-        /* 02212D30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02212D34 */ _t386 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212D30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02212D34 */ _t386 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212D34 */ _t387 = _t386 & 0x00000001u;
         /* 02212D34 */ if (_t387) goto L_02212D44; else goto L_02212D38;
   L_02212D38: ; // 0x2212d38
-        /* 02212D38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[22]);
+        /* 02212D38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[22]));
         /* 02212D3C */ cpu->r[29] = 0x00000001u;
-        /* 02212D40 */ _t388 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02212D40 */ _t388 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02212D40 */ _t389 = _t388 & 0x00000001u;
         /* 02212D40 */ if (_t389) goto L_02212D44; else goto L_02212EAC;
   L_02212D44: ; // 0x2212d44
@@ -11547,15 +11547,15 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212D5C */ _t396 = cpu->r[1] + 0x00000058u;
         /* 02212D5C */ rbrew_write_f32(cpu->mem, _t396, cpu->f[0]);
   L_02212D60: ; // 0x2212d60
-        /* 02212D60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02212D64 */ _t397 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212D60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02212D64 */ _t397 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212D64 */ _t398 = _t397 & 0x00000001u;
         /* 02212D64 */ if (_t398) goto L_02212D68; else goto L_02212D7C;
   L_02212D68: ; // 0x2212d68
         /* 02212D68 */ _t399 = cpu->r[28] + 0x00000028u;
         /* 02212D68 */ cpu->r[0] = rbrew_read32(cpu->mem, _t399);
-        /* 02212D6C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 02212D70 */ _t400 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212D6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 02212D70 */ _t400 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212D70 */ _t401 = _t400 & 0x00000001u;
         /* 02212D70 */ if (_t401) goto L_02212D74; else goto L_02212D7C;
   L_02212D74: ; // 0x2212d74
@@ -11563,14 +11563,14 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212D78 */ cpu->r[20] = 0x00000000u;
   L_02212D7C: ; // 0x2212d7c
         /* 02212D7C */ cpu->r[16] = cpu->r[16] + 0xFFFFFFFFu;
-        /* 02212D7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[16], 0x00000000u);
+        /* 02212D7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[16], 0x00000000u));
         /* 02212D80 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02212D84 */ _t402 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212D84 */ _t402 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212D84 */ _t403 = _t402 & 0x00000001u;
         /* 02212D84 */ if (_t403) goto L_02212D88; else goto L_0221293C;
   L_02212D88: ; // 0x2212d88
-        /* 02212D88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02212D8C */ _t404 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212D88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02212D8C */ _t404 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212D8C */ _t405 = _t404 & 0x00000001u;
         /* 02212D8C */ if (_t405) goto L_02212D90; else goto L_02212EAC;
   L_02212D90: ; // 0x2212d90
@@ -11578,8 +11578,8 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212D90 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t406);
         /* 02212D94 */ _t407 = cpu->r[1] + 0x00000020u;
         /* 02212D94 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t407);
-        /* 02212D98 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[7]);
-        /* 02212D9C */ _t408 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212D98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[7]));
+        /* 02212D9C */ _t408 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212D9C */ _t409 = _t408 & 0x00000001u;
         /* 02212D9C */ if (_t409) goto L_02212DA0; else goto L_02212DB0;
   L_02212DA0: ; // 0x2212da0
@@ -11587,8 +11587,8 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212DA0 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t410);
         /* 02212DA4 */ _t411 = cpu->r[1] + 0x00000024u;
         /* 02212DA4 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t411);
-        /* 02212DA8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[9]);
-        /* 02212DAC */ _t412 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212DA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[9]));
+        /* 02212DAC */ _t412 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212DAC */ _t413 = _t412 & 0x00000001u;
         /* 02212DAC */ if (_t413) goto L_02212DF0; else goto L_02212DB0;
   L_02212DB0: ; // 0x2212db0
@@ -11608,10 +11608,10 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212DD4 */ cpu->f[7] = cpu->f[5] - cpu->f[0];
         /* 02212DD8 */ cpu->f[9] = fma(cpu->f[8], cpu->f[8], cpu->f[6]);
         /* 02212DDC */ cpu->f[1] = fma(cpu->f[7], cpu->f[7], cpu->f[9]);
-        /* 02212DE0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[28]);
+        /* 02212DE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[28]));
         /* 02212DE4 */ _t418 = cpu->r[1] + 0x000000A0u;
         /* 02212DE4 */ rbrew_write_f32(cpu->mem, _t418, cpu->f[7]);
-        /* 02212DE8 */ _t419 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02212DE8 */ _t419 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02212DE8 */ _t420 = _t419 & 0x00000001u;
         /* 02212DE8 */ if (_t420) goto L_02212DEC; else goto L_02212E64;
   L_02212DEC: ; // 0x2212dec
@@ -11621,8 +11621,8 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212DF0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t421);
         /* 02212DF4 */ _t422 = cpu->r[1] + 0x00000028u;
         /* 02212DF4 */ cpu->f[5] = rbrew_read_f32(cpu->mem, _t422);
-        /* 02212DF8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[5]);
-        /* 02212DFC */ _t423 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212DF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[5]));
+        /* 02212DFC */ _t423 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212DFC */ _t424 = _t423 & 0x00000001u;
         /* 02212DFC */ if (_t424) goto L_02212EA8; else goto L_02212E00;
   L_02212E00: ; // 0x2212e00
@@ -11638,10 +11638,10 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212E1C */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t426);
         /* 02212E20 */ cpu->f[9] = fma(cpu->f[8], cpu->f[8], cpu->f[6]);
         /* 02212E24 */ cpu->f[1] = fma(cpu->f[7], cpu->f[7], cpu->f[9]);
-        /* 02212E28 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[28]);
+        /* 02212E28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[28]));
         /* 02212E2C */ _t427 = cpu->r[1] + 0x000000A0u;
         /* 02212E2C */ rbrew_write_f32(cpu->mem, _t427, cpu->f[7]);
-        /* 02212E30 */ _t428 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02212E30 */ _t428 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02212E30 */ _t429 = _t428 & 0x00000001u;
         /* 02212E30 */ if (_t429) goto L_02212E34; else goto L_02212E64;
   L_02212E34: ; // 0x2212e34
@@ -11681,15 +11681,15 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212E98 */ _t437 = cpu->r[1] + 0x00000010u;
         /* 02212E98 */ rbrew_write32(cpu->mem, _t437, cpu->r[0]);
         /* 02212E9C */ Gambit_fn_021F4508(cpu);
-        /* 02212EA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02212EA4 */ _t438 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212EA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02212EA4 */ _t438 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212EA4 */ _t439 = _t438 & 0x00000001u;
         /* 02212EA4 */ if (_t439) goto L_02212EA8; else goto L_02212EAC;
   L_02212EA8: ; // 0x2212ea8
         /* 02212EA8 */ cpu->r[20] = 0x00000000u;
   L_02212EAC: ; // 0x2212eac
-        /* 02212EAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 02212EB0 */ _t440 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02212EAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 02212EB0 */ _t440 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02212EB0 */ _t441 = _t440 & 0x00000001u;
         /* 02212EB0 */ if (_t441) goto L_02212EB4; else goto L_02212EF4;
   L_02212EB4: ; // 0x2212eb4
@@ -11714,21 +11714,21 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212EEC */ cpu->r[5] = cpu->r[1] + 0x00000110u;
         /* 02212EF0 */ Gambit_fn_021F0B10(cpu);
   L_02212EF4: ; // 0x2212ef4
-        /* 02212EF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
-        /* 02212EF8 */ _t446 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212EF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
+        /* 02212EF8 */ _t446 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212EF8 */ _t447 = _t446 & 0x00000001u;
         /* 02212EF8 */ if (_t447) goto L_02212EFC; else goto L_02212FB8;
   L_02212EFC: ; // 0x2212efc
-        /* 02212EFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02212EFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02212F00 */ cpu->r[3] = cpu->r[30];
-        /* 02212F04 */ _t448 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212F04 */ _t448 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212F04 */ _t449 = _t448 & 0x00000001u;
         /* 02212F04 */ if (_t449) goto L_02212F08; else goto L_02212F18;
   L_02212F08: ; // 0x2212f08
         /* 02212F08 */ cpu->r[3] = 0x00000004u;
         /* 02212F0C */ Gambit_fn_02801A78(cpu);
-        /* 02212F10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02212F14 */ _t450 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212F10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02212F14 */ _t450 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212F14 */ _t451 = _t450 & 0x00000001u;
         /* 02212F14 */ if (_t451) goto L_02212FDC; else goto L_02212F18;
   L_02212F18: ; // 0x2212f18
@@ -11800,7 +11800,7 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212F9C */ cpu->f[24] = rbrew_read_f64(cpu->mem, _t483);
         /* 02212FA0 */ _t484 = cpu->r[1] + 0x000007B8u;
         /* 02212FA0 */ cpu->f[27] = rbrew_read_f64(cpu->mem, _t484);
-        /* 02212FA4 */ _t485 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02212FA4 */ _t485 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02212FA4 */ _t486 = _t485 & 0x00000001u;
         /* 02212FA4 */ if (_t486) goto L_02212FA8; // else: addr-0 trap, fall-through
   L_02212FA8: ; // 0x2212fa8
@@ -11810,16 +11810,16 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02212FB0 */ cpu->r[1] = cpu->r[1] + 0x00000808u;
         /* 02212FB4 */ return;
   L_02212FB8: ; // 0x2212fb8
-        /* 02212FB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02212FB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02212FBC */ cpu->r[3] = cpu->r[30];
-        /* 02212FC0 */ _t488 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212FC0 */ _t488 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212FC0 */ _t489 = _t488 & 0x00000001u;
         /* 02212FC0 */ if (_t489) goto L_02212FC4; else goto L_02212FD4;
   L_02212FC4: ; // 0x2212fc4
         /* 02212FC4 */ cpu->r[3] = 0x00000004u;
         /* 02212FC8 */ Gambit_fn_02801A78(cpu);
-        /* 02212FCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02212FD0 */ _t490 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02212FCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02212FD0 */ _t490 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02212FD0 */ _t491 = _t490 & 0x00000001u;
         /* 02212FD0 */ if (_t491) goto L_02212FDC; else goto L_02212FD4;
   L_02212FD4: ; // 0x2212fd4
@@ -11893,7 +11893,7 @@ void Gambit_fn_022122B0(CPUState* cpu) {
         /* 02213058 */ cpu->f[25] = rbrew_read_f64(cpu->mem, _t524);
         /* 0221305C */ _t525 = cpu->r[1] + 0x000007C8u;
         /* 0221305C */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t525);
-        /* 02213060 */ _t526 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02213060 */ _t526 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02213060 */ _t527 = _t526 & 0x00000001u;
         /* 02213060 */ if (_t527) goto L_02213064; // else: addr-0 trap, fall-through
   L_02213064: ; // 0x2213064
@@ -12030,7 +12030,7 @@ void Gambit_fn_02213078(CPUState* cpu) {
         /* 0221319C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t37);
         /* 022131A0 */ _t38 = cpu->r[1] + 0x00000034u;
         /* 022131A0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t38);
-        /* 022131A4 */ _t39 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022131A4 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022131A4 */ _t40 = _t39 & 0x00000001u;
         /* 022131A4 */ if (_t40) goto L_022131A8; // else: addr-0 trap, fall-through
   L_022131A8: ; // 0x22131a8
@@ -12160,7 +12160,7 @@ void Gambit_fn_0221307C(CPUState* cpu) {
         /* 0221319C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t37);
         /* 022131A0 */ _t38 = cpu->r[1] + 0x00000034u;
         /* 022131A0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t38);
-        /* 022131A4 */ _t39 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022131A4 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022131A4 */ _t40 = _t39 & 0x00000001u;
         /* 022131A4 */ if (_t40) goto L_022131A8; // else: addr-0 trap, fall-through
   L_022131A8: ; // 0x22131a8
@@ -12194,9 +12194,9 @@ void Gambit_fn_022131B8(CPUState* cpu) {
         /* 022131D8 */ _t6 = cpu->r[3] + 0x00000184u;
         /* 022131D8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
         /* 022131DC */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Au, 0x0000001Cu);
-        /* 022131DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 022131DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 022131E0 */ cpu->r[30] = cpu->r[3];
-        /* 022131E4 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022131E4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022131E4 */ _t8 = _t7 & 0x00000001u;
         /* 022131E4 */ if (_t8) goto L_02213210; else goto L_022131E8;
   L_022131E8: ; // 0x22131e8
@@ -12209,7 +12209,7 @@ void Gambit_fn_022131B8(CPUState* cpu) {
         /* 022131F4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t11);
         /* 022131F8 */ _t12 = cpu->r[1] + 0x00000020u;
         /* 022131F8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t12);
-        /* 022131FC */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022131FC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022131FC */ _t14 = _t13 & 0x00000001u;
         /* 022131FC */ if (_t14) goto L_02213200; // else: addr-0 trap, fall-through
   L_02213200: ; // 0x2213200
@@ -12240,8 +12240,8 @@ void Gambit_fn_022131B8(CPUState* cpu) {
         /* 02213234 */ cpu->ctr = cpu->r[9];
         /* 02213238 */ /* nop */
         /* 0221323C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02213240 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[3]);
-        /* 02213244 */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02213240 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[3]));
+        /* 02213244 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02213244 */ _t26 = _t25 & 0x00000001u;
         /* 02213244 */ if (_t26) goto L_02213248; else goto L_022132D4;
   L_02213248: ; // 0x2213248
@@ -12286,8 +12286,8 @@ void Gambit_fn_022131B8(CPUState* cpu) {
         /* 022132B4 */ cpu->r[3] = cpu->r[30];
         /* 022132B8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 022132BC */ cpu->r[0] = cpu->r[3] + 0xFFFFFFFFu;
-        /* 022132C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
-        /* 022132C4 */ _t38 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022132C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
+        /* 022132C4 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022132C4 */ _t39 = _t38 & 0x00000001u;
         /* 022132C4 */ if (_t39) goto L_022132C8; else goto L_022132D4;
   L_022132C8: ; // 0x22132c8
@@ -12372,7 +12372,7 @@ void Gambit_fn_022131B8(CPUState* cpu) {
         /* 0221338C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t67);
         /* 02213390 */ _t68 = cpu->r[1] + 0x00000020u;
         /* 02213390 */ cpu->r[30] = rbrew_read32(cpu->mem, _t68);
-        /* 02213394 */ _t69 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02213394 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02213394 */ _t70 = _t69 & 0x00000001u;
         /* 02213394 */ if (_t70) goto L_02213398; // else: addr-0 trap, fall-through
   L_02213398: ; // 0x2213398
@@ -12405,9 +12405,9 @@ void Gambit_fn_022131BC(CPUState* cpu) {
         /* 022131D8 */ _t6 = cpu->r[3] + 0x00000184u;
         /* 022131D8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
         /* 022131DC */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Au, 0x0000001Cu);
-        /* 022131DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 022131DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 022131E0 */ cpu->r[30] = cpu->r[3];
-        /* 022131E4 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022131E4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022131E4 */ _t8 = _t7 & 0x00000001u;
         /* 022131E4 */ if (_t8) goto L_02213210; else goto L_022131E8;
   L_022131E8: ; // 0x22131e8
@@ -12420,7 +12420,7 @@ void Gambit_fn_022131BC(CPUState* cpu) {
         /* 022131F4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t11);
         /* 022131F8 */ _t12 = cpu->r[1] + 0x00000020u;
         /* 022131F8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t12);
-        /* 022131FC */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022131FC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022131FC */ _t14 = _t13 & 0x00000001u;
         /* 022131FC */ if (_t14) goto L_02213200; // else: addr-0 trap, fall-through
   L_02213200: ; // 0x2213200
@@ -12451,8 +12451,8 @@ void Gambit_fn_022131BC(CPUState* cpu) {
         /* 02213234 */ cpu->ctr = cpu->r[9];
         /* 02213238 */ /* nop */
         /* 0221323C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02213240 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[3]);
-        /* 02213244 */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02213240 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[3]));
+        /* 02213244 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02213244 */ _t26 = _t25 & 0x00000001u;
         /* 02213244 */ if (_t26) goto L_02213248; else goto L_022132D4;
   L_02213248: ; // 0x2213248
@@ -12497,8 +12497,8 @@ void Gambit_fn_022131BC(CPUState* cpu) {
         /* 022132B4 */ cpu->r[3] = cpu->r[30];
         /* 022132B8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 022132BC */ cpu->r[0] = cpu->r[3] + 0xFFFFFFFFu;
-        /* 022132C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[0]);
-        /* 022132C4 */ _t38 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022132C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[0]));
+        /* 022132C4 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022132C4 */ _t39 = _t38 & 0x00000001u;
         /* 022132C4 */ if (_t39) goto L_022132C8; else goto L_022132D4;
   L_022132C8: ; // 0x22132c8
@@ -12583,7 +12583,7 @@ void Gambit_fn_022131BC(CPUState* cpu) {
         /* 0221338C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t67);
         /* 02213390 */ _t68 = cpu->r[1] + 0x00000020u;
         /* 02213390 */ cpu->r[30] = rbrew_read32(cpu->mem, _t68);
-        /* 02213394 */ _t69 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02213394 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02213394 */ _t70 = _t69 & 0x00000001u;
         /* 02213394 */ if (_t70) goto L_02213398; // else: addr-0 trap, fall-through
   L_02213398: ; // 0x2213398
@@ -12948,15 +12948,15 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213588 */ /* nop */
         /* 0221358C */ _t39 = cpu->r[1] + 0x00000010u;
         /* 0221358C */ rbrew_write_f32(cpu->mem, _t39, cpu->f[1]);
-        /* 02213590 */ _t40 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02213590 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02213590 */ _t41 = _t40 & 0x00000001u;
         /* 02213590 */ if (_t41) goto L_02213594; else goto L_02213DE8;
   L_02213594: ; // 0x2213594
         /* 02213594 */ _t42 = cpu->r[31] + 0x00000184u;
         /* 02213594 */ cpu->r[0] = rbrew_read32(cpu->mem, _t42);
         /* 02213598 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Au, 0x0000001Cu);
-        /* 02213598 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0221359C */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213598 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0221359C */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221359C */ _t44 = _t43 & 0x00000001u;
         /* 0221359C */ if (_t44) goto L_022135A0; else goto L_02213DE8;
   L_022135A0: ; // 0x22135a0
@@ -12972,8 +12972,8 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 022135B8 */ cpu->f[24] = cpu->f[1];
         /* 022135BC */ _t48 = cpu->r[31] + 0x00000208u;
         /* 022135BC */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t48);
-        /* 022135C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[24]);
-        /* 022135C4 */ _t49 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022135C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[24]));
+        /* 022135C4 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022135C4 */ _t50 = _t49 & 0x00000001u;
         /* 022135C4 */ if (_t50) goto L_02213DE8; else goto L_022135C8;
   L_022135C8: ; // 0x22135c8
@@ -13198,9 +13198,9 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213820 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t117);
         /* 02213824 */ cpu->f[9] = fma(cpu->f[13], cpu->f[13], cpu->f[8]);
         /* 02213828 */ cpu->f[13] = cpu->f[0] - cpu->f[28];
-        /* 0221382C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[29]);
+        /* 0221382C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[29]));
         /* 02213830 */ cpu->f[0] = fma(cpu->f[13], cpu->f[15], cpu->f[14]);
-        /* 02213834 */ _t118 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02213834 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02213834 */ _t119 = _t118 & 0x00000001u;
         /* 02213834 */ if (_t119) goto L_02213838; else goto L_02213868;
   L_02213838: ; // 0x2213838
@@ -13241,9 +13241,9 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213898 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t128);
         /* 0221389C */ cpu->f[11] = fma(cpu->f[17], cpu->f[17], cpu->f[7]);
         /* 022138A0 */ cpu->f[13] = cpu->f[0] - cpu->f[28];
-        /* 022138A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[29]);
+        /* 022138A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[29]));
         /* 022138A8 */ cpu->f[10] = fma(cpu->f[13], cpu->f[15], cpu->f[14]);
-        /* 022138AC */ _t129 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022138AC */ _t129 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022138AC */ _t130 = _t129 & 0x00000001u;
         /* 022138AC */ if (_t130) goto L_022138B0; else goto L_022138E0;
   L_022138B0: ; // 0x22138b0
@@ -13284,9 +13284,9 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213910 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t139);
         /* 02213914 */ cpu->f[9] = fma(cpu->f[11], cpu->f[11], cpu->f[7]);
         /* 02213918 */ cpu->f[12] = cpu->f[0] - cpu->f[28];
-        /* 0221391C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[29]);
+        /* 0221391C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[29]));
         /* 02213920 */ cpu->f[6] = fma(cpu->f[12], cpu->f[16], cpu->f[15]);
-        /* 02213924 */ _t140 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02213924 */ _t140 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02213924 */ _t141 = _t140 & 0x00000001u;
         /* 02213924 */ if (_t141) goto L_02213930; else goto L_02213928;
   L_02213928: ; // 0x2213928
@@ -13395,9 +13395,9 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213A2C */ /* nop */
         /* 02213A30 */ _t177 = cpu->r[1] + 0x00000054u;
         /* 02213A30 */ rbrew_write_f32(cpu->mem, _t177, cpu->f[9]);
-        /* 02213A34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02213A34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02213A38 */ /* nop */
-        /* 02213A3C */ _t178 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213A3C */ _t178 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213A3C */ _t179 = _t178 & 0x00000001u;
         /* 02213A3C */ if (_t179) goto L_02213A40; else goto L_02213A74;
   L_02213A40: ; // 0x2213a40
@@ -13418,15 +13418,15 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213A64 */ cpu->f[12] = cpu->f[6] - cpu->f[28];
         /* 02213A68 */ _t185 = cpu->r[9] + 0x00000268u;
         /* 02213A68 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t185);
-        /* 02213A6C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[7]);
-        /* 02213A70 */ _t186 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02213A6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[7]));
+        /* 02213A70 */ _t186 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02213A70 */ _t187 = _t186 & 0x00000001u;
         /* 02213A70 */ if (_t187) goto L_02213A74; else goto L_02213DB0;
   L_02213A74: ; // 0x2213a74
         /* 02213A74 */ _t188 = cpu->r[16] + 0x00000000u;
         /* 02213A74 */ cpu->r[9] = rbrew_read32(cpu->mem, _t188);
-        /* 02213A78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02213A7C */ _t189 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213A78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02213A7C */ _t189 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213A7C */ _t190 = _t189 & 0x00000001u;
         /* 02213A7C */ if (_t190) goto L_02213A80; else goto L_02213A88;
   L_02213A80: ; // 0x2213a80
@@ -13443,16 +13443,16 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213A94 */ cpu->r[3] = cpu->r[31];
         /* 02213A98 */ cpu->r[4] = cpu->r[20];
         /* 02213A9C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02213AA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02213AA4 */ _t195 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213AA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02213AA4 */ _t195 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213AA4 */ _t196 = _t195 & 0x00000001u;
         /* 02213AA4 */ if (_t196) goto L_02213AA8; else goto L_02213C38;
   L_02213AA8: ; // 0x2213aa8
         /* 02213AA8 */ cpu->r[12] = 0x101D0000u;
         /* 02213AAC */ _t197 = cpu->r[12] + 0xFFFFFD18u;
         /* 02213AAC */ cpu->r[12] = rbrew_read32(cpu->mem, _t197);
-        /* 02213AB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02213AB4 */ _t198 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213AB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02213AB4 */ _t198 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213AB4 */ _t199 = _t198 & 0x00000001u;
         /* 02213AB4 */ if (_t199) goto L_02213AB8; else goto L_02213AC4;
   L_02213AB8: ; // 0x2213ab8
@@ -13470,16 +13470,16 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213AD0 */ cpu->r[4] = cpu->r[22];
         /* 02213AD4 */ cpu->r[3] = cpu->r[31];
         /* 02213AD8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02213ADC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02213AE0 */ _t204 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213ADC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02213AE0 */ _t204 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213AE0 */ _t205 = _t204 & 0x00000001u;
         /* 02213AE0 */ if (_t205) goto L_02213AE4; else goto L_02213C38;
   L_02213AE4: ; // 0x2213ae4
         /* 02213AE4 */ cpu->r[11] = 0x101D0000u;
         /* 02213AE8 */ _t206 = cpu->r[11] + 0xFFFFFD1Cu;
         /* 02213AE8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t206);
-        /* 02213AEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02213AF0 */ _t207 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213AEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02213AF0 */ _t207 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213AF0 */ _t208 = _t207 & 0x00000001u;
         /* 02213AF0 */ if (_t208) goto L_02213AF4; else goto L_02213B00;
   L_02213AF4: ; // 0x2213af4
@@ -13497,16 +13497,16 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213B0C */ cpu->r[3] = cpu->r[31];
         /* 02213B10 */ cpu->r[4] = cpu->r[23];
         /* 02213B14 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02213B18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02213B1C */ _t213 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213B18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02213B1C */ _t213 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213B1C */ _t214 = _t213 & 0x00000001u;
         /* 02213B1C */ if (_t214) goto L_02213B20; else goto L_02213C38;
   L_02213B20: ; // 0x2213b20
         /* 02213B20 */ cpu->r[7] = 0x101D0000u;
         /* 02213B24 */ _t215 = cpu->r[7] + 0xFFFFFD20u;
         /* 02213B24 */ cpu->r[7] = rbrew_read32(cpu->mem, _t215);
-        /* 02213B28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 02213B2C */ _t216 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213B28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 02213B2C */ _t216 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213B2C */ _t217 = _t216 & 0x00000001u;
         /* 02213B2C */ if (_t217) goto L_02213B30; else goto L_02213B3C;
   L_02213B30: ; // 0x2213b30
@@ -13524,16 +13524,16 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213B48 */ cpu->r[3] = cpu->r[31];
         /* 02213B4C */ cpu->r[4] = cpu->r[24];
         /* 02213B50 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02213B54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02213B58 */ _t222 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213B54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02213B58 */ _t222 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213B58 */ _t223 = _t222 & 0x00000001u;
         /* 02213B58 */ if (_t223) goto L_02213B5C; else goto L_02213C38;
   L_02213B5C: ; // 0x2213b5c
         /* 02213B5C */ cpu->r[9] = 0x101D0000u;
         /* 02213B60 */ _t224 = cpu->r[9] + 0xFFFFFD40u;
         /* 02213B60 */ cpu->r[9] = rbrew_read32(cpu->mem, _t224);
-        /* 02213B64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02213B68 */ _t225 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213B64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02213B68 */ _t225 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213B68 */ _t226 = _t225 & 0x00000001u;
         /* 02213B68 */ if (_t226) goto L_02213B6C; else goto L_02213B78;
   L_02213B6C: ; // 0x2213b6c
@@ -13551,15 +13551,15 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213B84 */ cpu->r[3] = cpu->r[31];
         /* 02213B88 */ cpu->r[4] = cpu->r[25];
         /* 02213B8C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02213B90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02213B94 */ _t231 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213B90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02213B94 */ _t231 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213B94 */ _t232 = _t231 & 0x00000001u;
         /* 02213B94 */ if (_t232) goto L_02213B98; else goto L_02213C38;
   L_02213B98: ; // 0x2213b98
         /* 02213B98 */ _t233 = cpu->r[19] + 0x00000000u;
         /* 02213B98 */ cpu->r[5] = rbrew_read32(cpu->mem, _t233);
-        /* 02213B9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 02213BA0 */ _t234 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213B9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 02213BA0 */ _t234 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213BA0 */ _t235 = _t234 & 0x00000001u;
         /* 02213BA0 */ if (_t235) goto L_02213BA4; else goto L_02213BAC;
   L_02213BA4: ; // 0x2213ba4
@@ -13576,15 +13576,15 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213BB8 */ cpu->r[3] = cpu->r[31];
         /* 02213BBC */ cpu->r[4] = cpu->r[26];
         /* 02213BC0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02213BC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02213BC8 */ _t240 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213BC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02213BC8 */ _t240 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213BC8 */ _t241 = _t240 & 0x00000001u;
         /* 02213BC8 */ if (_t241) goto L_02213BCC; else goto L_02213C38;
   L_02213BCC: ; // 0x2213bcc
         /* 02213BCC */ _t242 = cpu->r[18] + 0x00000000u;
         /* 02213BCC */ cpu->r[7] = rbrew_read32(cpu->mem, _t242);
-        /* 02213BD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 02213BD4 */ _t243 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213BD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 02213BD4 */ _t243 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213BD4 */ _t244 = _t243 & 0x00000001u;
         /* 02213BD4 */ if (_t244) goto L_02213BD8; else goto L_02213BE4;
   L_02213BD8: ; // 0x2213bd8
@@ -13604,15 +13604,15 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213BF0 */ cpu->ctr = cpu->r[9];
         /* 02213BF4 */ cpu->r[3] = cpu->r[31];
         /* 02213BF8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02213BFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02213C00 */ _t251 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213BFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02213C00 */ _t251 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213C00 */ _t252 = _t251 & 0x00000001u;
         /* 02213C00 */ if (_t252) goto L_02213C04; else goto L_02213C38;
   L_02213C04: ; // 0x2213c04
         /* 02213C04 */ _t253 = cpu->r[17] + 0x00000000u;
         /* 02213C04 */ cpu->r[0] = rbrew_read32(cpu->mem, _t253);
-        /* 02213C08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02213C0C */ _t254 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213C08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02213C0C */ _t254 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213C0C */ _t255 = _t254 & 0x00000001u;
         /* 02213C0C */ if (_t255) goto L_02213C10; else goto L_02213C18;
   L_02213C10: ; // 0x2213c10
@@ -13629,8 +13629,8 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213C24 */ cpu->r[3] = cpu->r[31];
         /* 02213C28 */ cpu->r[4] = cpu->r[15];
         /* 02213C2C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02213C30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02213C34 */ _t260 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213C30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02213C34 */ _t260 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213C34 */ _t261 = _t260 & 0x00000001u;
         /* 02213C34 */ if (_t261) goto L_02213C7C; else goto L_02213C38;
   L_02213C38: ; // 0x2213c38
@@ -13645,10 +13645,10 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213C4C */ _t265 = cpu->r[4] + 0x00000104u;
         /* 02213C4C */ cpu->r[4] = rbrew_read8(cpu->mem, _t265);
         /* 02213C50 */ cpu->r[14] = 0x00000000u;
-        /* 02213C54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 02213C54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 02213C58 */ _t266 = cpu->r[31] + 0x00000051u;
         /* 02213C58 */ cpu->r[5] = rbrew_read8(cpu->mem, _t266);
-        /* 02213C5C */ _t267 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213C5C */ _t267 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213C5C */ _t268 = _t267 & 0x00000001u;
         /* 02213C5C */ if (_t268) goto L_02213C70; else goto L_02213C60;
   L_02213C60: ; // 0x2213c60
@@ -13657,8 +13657,8 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213C68 */ Gambit_fn_021F000C(cpu);
         /* 02213C6C */ cpu->r[14] = cpu->r[3];
   L_02213C70: ; // 0x2213c70
-        /* 02213C70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[14], 0x00000000u);
-        /* 02213C74 */ _t269 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213C70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[14], 0x00000000u));
+        /* 02213C74 */ _t269 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213C74 */ _t270 = _t269 & 0x00000001u;
         /* 02213C74 */ if (_t270) goto L_02213DB0; else goto L_02213C78;
   L_02213C78: ; // 0x2213c78
@@ -13674,10 +13674,10 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213C8C */ cpu->r[4] = cpu->r[3] + cpu->r[8];
         /* 02213C90 */ _t274 = cpu->r[4] + 0x00000104u;
         /* 02213C90 */ cpu->r[4] = rbrew_read8(cpu->mem, _t274);
-        /* 02213C94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 02213C94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 02213C98 */ _t275 = cpu->r[31] + 0x00000051u;
         /* 02213C98 */ cpu->r[5] = rbrew_read8(cpu->mem, _t275);
-        /* 02213C9C */ _t276 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213C9C */ _t276 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213C9C */ _t277 = _t276 & 0x00000001u;
         /* 02213C9C */ if (_t277) goto L_02213DB0; else goto L_02213CA0;
   L_02213CA0: ; // 0x2213ca0
@@ -13685,8 +13685,8 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213CA4 */ cpu->r[7] = cpu->r[1] + 0x0000004Cu;
         /* 02213CA8 */ Gambit_fn_021F000C(cpu);
         /* 02213CAC */ cpu->r[14] = cpu->r[3];
-        /* 02213CAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[14], 0x00000000u);
-        /* 02213CB0 */ _t278 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213CAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[14], 0x00000000u));
+        /* 02213CB0 */ _t278 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213CB0 */ _t279 = _t278 & 0x00000001u;
         /* 02213CB0 */ if (_t279) goto L_02213DB0; else goto L_02213CB4;
   L_02213CB4: ; // 0x2213cb4
@@ -13699,10 +13699,10 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213CC8 */ _t281 = cpu->r[31] + 0x00000184u;
         /* 02213CC8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t281);
         /* 02213CCC */ cpu->r[6] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x0000001Du, 0x0000001Du);
-        /* 02213CCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02213CCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 02213CD0 */ _t282 = cpu->r[1] + 0x00000008u;
         /* 02213CD0 */ rbrew_write_f32(cpu->mem, _t282, cpu->f[1]);
-        /* 02213CD4 */ _t283 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213CD4 */ _t283 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213CD4 */ _t284 = _t283 & 0x00000001u;
         /* 02213CD4 */ if (_t284) goto L_02213D18; else goto L_02213CD8;
   L_02213CD8: ; // 0x2213cd8
@@ -13714,7 +13714,7 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213CE4 */ cpu->r[7] = rbrew_read8(cpu->mem, _t286);
         /* 02213CE8 */ _t287 = cpu->r[31] + 0x0000005Cu;
         /* 02213CE8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t287);
-        /* 02213CEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02213CEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02213CF0 */ _t288 = cpu->r[31] + 0x00000058u;
         /* 02213CF0 */ cpu->r[6] = rbrew_read32(cpu->mem, _t288);
         /* 02213CF4 */ cpu->r[4] = 0x00000000u;
@@ -13728,7 +13728,7 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213D08 */ cpu->r[3] = cpu->r[14];
         /* 02213D0C */ _t292 = cpu->r[1] + 0x0000000Cu;
         /* 02213D0C */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t292);
-        /* 02213D10 */ _t293 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213D10 */ _t293 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213D10 */ _t294 = _t293 & 0x00000001u;
         /* 02213D10 */ if (_t294) goto L_02213D98; else goto L_02213D14;
   L_02213D14: ; // 0x2213d14
@@ -13741,7 +13741,7 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213D24 */ cpu->r[4] = 0x00000000u;
         /* 02213D28 */ _t296 = cpu->r[31] + 0x00000064u;
         /* 02213D28 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t296);
-        /* 02213D2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02213D2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02213D30 */ _t297 = cpu->r[31] + 0x00000054u;
         /* 02213D30 */ cpu->r[5] = rbrew_read32(cpu->mem, _t297);
         /* 02213D34 */ cpu->r[3] = cpu->r[14];
@@ -13754,7 +13754,7 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213D44 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t300);
         /* 02213D48 */ _t301 = cpu->r[31] + 0x00000058u;
         /* 02213D48 */ cpu->r[6] = rbrew_read32(cpu->mem, _t301);
-        /* 02213D4C */ _t302 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213D4C */ _t302 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213D4C */ _t303 = _t302 & 0x00000001u;
         /* 02213D4C */ if (_t303) goto L_02213D98; else goto L_02213D50;
   L_02213D50: ; // 0x2213d50
@@ -13781,7 +13781,7 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213D88 */ /* nop */
         /* 02213D8C */ _t310 = cpu->r[31] + 0x00000207u;
         /* 02213D8C */ rbrew_write8(cpu->mem, _t310, (uint8_t)cpu->r[12]);
-        /* 02213D90 */ _t311 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02213D90 */ _t311 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02213D90 */ _t312 = _t311 & 0x00000001u;
         /* 02213D90 */ if (_t312) goto L_02213DDC; else goto L_02213D94;
   L_02213D94: ; // 0x2213d94
@@ -13811,14 +13811,14 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213DD0 */ /* nop */
         /* 02213DD4 */ _t319 = cpu->r[31] + 0x00000207u;
         /* 02213DD4 */ rbrew_write8(cpu->mem, _t319, (uint8_t)cpu->r[12]);
-        /* 02213DD8 */ _t320 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02213DD8 */ _t320 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02213DD8 */ _t321 = _t320 & 0x00000001u;
         /* 02213DD8 */ if (_t321) goto L_02213DDC; else goto L_02213DE8;
   L_02213DDC: ; // 0x2213ddc
         /* 02213DDC */ _t322 = cpu->r[31] + 0x00000208u;
         /* 02213DDC */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t322);
-        /* 02213DE0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[24]);
-        /* 02213DE4 */ _t323 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02213DE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[24]));
+        /* 02213DE4 */ _t323 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02213DE4 */ _t324 = _t323 & 0x00000001u;
         /* 02213DE4 */ if (_t324) goto L_02213DE8; else goto L_02213688;
   L_02213DE8: ; // 0x2213de8
@@ -13895,7 +13895,7 @@ void Gambit_fn_02213498(CPUState* cpu) {
         /* 02213E74 */ cpu->f[23] = rbrew_read_f64(cpu->mem, _t359);
         /* 02213E78 */ _t360 = cpu->r[1] + 0x000001C8u;
         /* 02213E78 */ cpu->f[26] = rbrew_read_f64(cpu->mem, _t360);
-        /* 02213E7C */ _t361 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02213E7C */ _t361 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02213E7C */ _t362 = _t361 & 0x00000001u;
         /* 02213E7C */ if (_t362) goto L_02213E80; // else: addr-0 trap, fall-through
   L_02213E80: ; // 0x2213e80
@@ -13978,13 +13978,13 @@ void Gambit_fn_02213E90(CPUState* cpu) {
         /* 02213F28 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t23);
         /* 02213F2C */ cpu->r[10] = 0x10050000u;
         /* 02213F30 */ cpu->f[10] = fma(cpu->f[10], cpu->f[10], cpu->f[7]);
-        /* 02213F34 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[29]);
+        /* 02213F34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[29]));
         /* 02213F38 */ _t24 = cpu->r[10] + 0xFFFFB240u;
         /* 02213F38 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t24);
         /* 02213F3C */ cpu->r[12] = 0x10050000u;
         /* 02213F40 */ _t25 = cpu->r[12] + 0xFFFFB23Cu;
         /* 02213F40 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t25);
-        /* 02213F44 */ _t26 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02213F44 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02213F44 */ _t27 = _t26 & 0x00000001u;
         /* 02213F44 */ if (_t27) goto L_02213F48; else goto L_02213F74;
   L_02213F48: ; // 0x2213f48
@@ -14007,8 +14007,8 @@ void Gambit_fn_02213E90(CPUState* cpu) {
         /* 02213F74 */ _t32 = cpu->r[31] + 0x00000184u;
         /* 02213F74 */ cpu->r[8] = rbrew_read32(cpu->mem, _t32);
         /* 02213F78 */ cpu->r[8] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x0000001Au, 0x0000001Cu);
-        /* 02213F78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02213F7C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02213F78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02213F7C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02213F7C */ _t34 = _t33 & 0x00000001u;
         /* 02213F7C */ if (_t34) goto L_02213F80; else goto L_02213FE4;
   L_02213F80: ; // 0x2213f80
@@ -14033,8 +14033,8 @@ void Gambit_fn_02213E90(CPUState* cpu) {
         /* 02213FB0 */ cpu->f[9] = cpu->f[8] - cpu->f[9];
         /* 02213FB4 */ cpu->f[12] = cpu->f[11] * cpu->f[11];
         /* 02213FB8 */ cpu->f[8] = fma(cpu->f[9], cpu->f[9], cpu->f[12]);
-        /* 02213FBC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[29]);
-        /* 02213FC0 */ _t41 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02213FBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[29]));
+        /* 02213FC0 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02213FC0 */ _t42 = _t41 & 0x00000001u;
         /* 02213FC0 */ if (_t42) goto L_02213FC4; else goto L_02213FD8;
   L_02213FC4: ; // 0x2213fc4
@@ -14071,8 +14071,8 @@ void Gambit_fn_02213E90(CPUState* cpu) {
         /* 02214018 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 0221401C */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 02214020 */ Gambit_fn_021C6DD8(cpu);
-        /* 02214024 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02214028 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02214024 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02214028 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02214028 */ _t51 = _t50 & 0x00000001u;
         /* 02214028 */ if (_t51) goto L_0221402C; else goto L_02214040;
   L_0221402C: ; // 0x221402c
@@ -14135,13 +14135,13 @@ void Gambit_fn_02213E90(CPUState* cpu) {
         /* 022140C4 */ _t69 = cpu->r[31] + 0x00000184u;
         /* 022140C4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t69);
         /* 022140C8 */ cpu->r[6] = rbrew_rlwinm(cpu->r[8], 0x0000001Du, 0x0000001Du, 0x0000001Fu);
-        /* 022140CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000001u);
-        /* 022140D0 */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022140CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000001u));
+        /* 022140D0 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022140D0 */ _t71 = _t70 & 0x00000001u;
         /* 022140D0 */ if (_t71) goto L_022140DC; else goto L_022140D4;
   L_022140D4: ; // 0x22140d4
-        /* 022140D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000002u);
-        /* 022140D8 */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022140D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000002u));
+        /* 022140D8 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022140D8 */ _t73 = _t72 & 0x00000001u;
         /* 022140D8 */ if (_t73) goto L_022140DC; else goto L_02214110;
   L_022140DC: ; // 0x22140dc
@@ -14167,8 +14167,8 @@ void Gambit_fn_02213E90(CPUState* cpu) {
         /* 02214108 */ rbrew_write32(cpu->mem, _t81, cpu->r[8]);
         /* 0221410C */ goto L_0221414C;
   L_02214110: ; // 0x2214110
-        /* 02214110 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000003u);
-        /* 02214114 */ _t82 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02214110 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000003u));
+        /* 02214114 */ _t82 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02214114 */ _t83 = _t82 & 0x00000001u;
         /* 02214114 */ if (_t83) goto L_02214118; else goto L_0221412C;
   L_02214118: ; // 0x2214118
@@ -14207,7 +14207,7 @@ void Gambit_fn_02213E90(CPUState* cpu) {
         /* 02214160 */ cpu->f[29] = rbrew_read_f64(cpu->mem, _t95);
         /* 02214164 */ _t96 = cpu->r[1] + 0x0000009Cu;
         /* 02214164 */ cpu->r[31] = rbrew_read32(cpu->mem, _t96);
-        /* 02214168 */ _t97 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02214168 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02214168 */ _t98 = _t97 & 0x00000001u;
         /* 02214168 */ if (_t98) goto L_0221416C; // else: addr-0 trap, fall-through
   L_0221416C: ; // 0x221416c
@@ -14284,9 +14284,9 @@ void Gambit_fn_0221417C(CPUState* cpu) {
         /* 02214208 */ cpu->f[8] = fma(cpu->f[11], cpu->f[11], cpu->f[7]);
         /* 0221420C */ _t21 = cpu->r[12] + 0xFFFFB140u;
         /* 0221420C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t21);
-        /* 02214210 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
+        /* 02214210 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
         /* 02214214 */ cpu->f[30] = cpu->f[1];
-        /* 02214218 */ _t22 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02214218 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02214218 */ _t23 = _t22 & 0x00000001u;
         /* 02214218 */ if (_t23) goto L_0221421C; else goto L_02214250;
   L_0221421C: ; // 0x221421c
@@ -14313,8 +14313,8 @@ void Gambit_fn_0221417C(CPUState* cpu) {
         /* 02214254 */ cpu->f[1] = -cpu->f[10];
         /* 02214258 */ _t29 = cpu->r[6] + 0xFFFFB348u;
         /* 02214258 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t29);
-        /* 0221425C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[10]);
-        /* 02214260 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221425C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[10]));
+        /* 02214260 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02214260 */ _t31 = _t30 & 0x00000001u;
         /* 02214260 */ if (_t31) goto L_02214264; else goto L_02214294;
   L_02214264: ; // 0x2214264
@@ -14328,10 +14328,10 @@ void Gambit_fn_0221417C(CPUState* cpu) {
         /* 0221427C */ _t33 = cpu->r[12] + 0xFFFFB350u;
         /* 0221427C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t33);
         /* 02214280 */ cpu->f[13] = cpu->f[9] * cpu->f[11];
-        /* 02214284 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[31]);
+        /* 02214284 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[31]));
         /* 02214288 */ _t34 = cpu->r[30] + 0x00000004u;
         /* 02214288 */ cpu->r[31] = rbrew_read32(cpu->mem, _t34);
-        /* 0221428C */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221428C */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221428C */ _t36 = _t35 & 0x00000001u;
         /* 0221428C */ if (_t36) goto L_022142D0; else goto L_02214290;
   L_02214290: ; // 0x2214290
@@ -14340,8 +14340,8 @@ void Gambit_fn_0221417C(CPUState* cpu) {
         /* 02214294 */ cpu->r[12] = 0x10050000u;
         /* 02214298 */ _t37 = cpu->r[12] + 0xFFFFB234u;
         /* 02214298 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t37);
-        /* 0221429C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[9]);
-        /* 022142A0 */ _t38 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221429C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[9]));
+        /* 022142A0 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022142A0 */ _t39 = _t38 & 0x00000001u;
         /* 022142A0 */ if (_t39) goto L_022142A4; else goto L_022142A8;
   L_022142A4: ; // 0x22142a4
@@ -14356,10 +14356,10 @@ void Gambit_fn_0221417C(CPUState* cpu) {
         /* 022142BC */ _t41 = cpu->r[12] + 0xFFFFB350u;
         /* 022142BC */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t41);
         /* 022142C0 */ cpu->f[13] = cpu->f[9] * cpu->f[11];
-        /* 022142C4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[31]);
+        /* 022142C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[31]));
         /* 022142C8 */ _t42 = cpu->r[30] + 0x00000004u;
         /* 022142C8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t42);
-        /* 022142CC */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022142CC */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022142CC */ _t44 = _t43 & 0x00000001u;
         /* 022142CC */ if (_t44) goto L_022142D0; else goto L_0221430C;
   L_022142D0: ; // 0x22142d0
@@ -14381,8 +14381,8 @@ void Gambit_fn_0221417C(CPUState* cpu) {
         /* 02214304 */ cpu->f[1] = fma(cpu->f[7], cpu->f[30], cpu->f[31]);
         /* 02214308 */ goto L_02214350;
   L_0221430C: ; // 0x221430c
-        /* 0221430C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[30]);
-        /* 02214310 */ _t47 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221430C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[30]));
+        /* 02214310 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02214310 */ _t48 = _t47 & 0x00000001u;
         /* 02214310 */ if (_t48) goto L_02214314; else goto L_02214318;
   L_02214314: ; // 0x2214314
@@ -14417,7 +14417,7 @@ void Gambit_fn_0221417C(CPUState* cpu) {
         /* 02214360 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t55);
         /* 02214364 */ _t56 = cpu->r[1] + 0x00000018u;
         /* 02214364 */ cpu->r[30] = rbrew_read32(cpu->mem, _t56);
-        /* 02214368 */ _t57 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02214368 */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02214368 */ _t58 = _t57 & 0x00000001u;
         /* 02214368 */ if (_t58) goto L_0221436C; // else: addr-0 trap, fall-through
   L_0221436C: ; // 0x221436c
@@ -14493,9 +14493,9 @@ void Gambit_fn_02214180(CPUState* cpu) {
         /* 02214208 */ cpu->f[8] = fma(cpu->f[11], cpu->f[11], cpu->f[7]);
         /* 0221420C */ _t21 = cpu->r[12] + 0xFFFFB140u;
         /* 0221420C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t21);
-        /* 02214210 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
+        /* 02214210 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
         /* 02214214 */ cpu->f[30] = cpu->f[1];
-        /* 02214218 */ _t22 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02214218 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02214218 */ _t23 = _t22 & 0x00000001u;
         /* 02214218 */ if (_t23) goto L_0221421C; else goto L_02214250;
   L_0221421C: ; // 0x221421c
@@ -14522,8 +14522,8 @@ void Gambit_fn_02214180(CPUState* cpu) {
         /* 02214254 */ cpu->f[1] = -cpu->f[10];
         /* 02214258 */ _t29 = cpu->r[6] + 0xFFFFB348u;
         /* 02214258 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t29);
-        /* 0221425C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[10]);
-        /* 02214260 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221425C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[10]));
+        /* 02214260 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02214260 */ _t31 = _t30 & 0x00000001u;
         /* 02214260 */ if (_t31) goto L_02214264; else goto L_02214294;
   L_02214264: ; // 0x2214264
@@ -14537,10 +14537,10 @@ void Gambit_fn_02214180(CPUState* cpu) {
         /* 0221427C */ _t33 = cpu->r[12] + 0xFFFFB350u;
         /* 0221427C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t33);
         /* 02214280 */ cpu->f[13] = cpu->f[9] * cpu->f[11];
-        /* 02214284 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[31]);
+        /* 02214284 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[31]));
         /* 02214288 */ _t34 = cpu->r[30] + 0x00000004u;
         /* 02214288 */ cpu->r[31] = rbrew_read32(cpu->mem, _t34);
-        /* 0221428C */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221428C */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221428C */ _t36 = _t35 & 0x00000001u;
         /* 0221428C */ if (_t36) goto L_022142D0; else goto L_02214290;
   L_02214290: ; // 0x2214290
@@ -14549,8 +14549,8 @@ void Gambit_fn_02214180(CPUState* cpu) {
         /* 02214294 */ cpu->r[12] = 0x10050000u;
         /* 02214298 */ _t37 = cpu->r[12] + 0xFFFFB234u;
         /* 02214298 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t37);
-        /* 0221429C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[9]);
-        /* 022142A0 */ _t38 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221429C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[9]));
+        /* 022142A0 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022142A0 */ _t39 = _t38 & 0x00000001u;
         /* 022142A0 */ if (_t39) goto L_022142A4; else goto L_022142A8;
   L_022142A4: ; // 0x22142a4
@@ -14565,10 +14565,10 @@ void Gambit_fn_02214180(CPUState* cpu) {
         /* 022142BC */ _t41 = cpu->r[12] + 0xFFFFB350u;
         /* 022142BC */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t41);
         /* 022142C0 */ cpu->f[13] = cpu->f[9] * cpu->f[11];
-        /* 022142C4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[31]);
+        /* 022142C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[31]));
         /* 022142C8 */ _t42 = cpu->r[30] + 0x00000004u;
         /* 022142C8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t42);
-        /* 022142CC */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022142CC */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022142CC */ _t44 = _t43 & 0x00000001u;
         /* 022142CC */ if (_t44) goto L_022142D0; else goto L_0221430C;
   L_022142D0: ; // 0x22142d0
@@ -14590,8 +14590,8 @@ void Gambit_fn_02214180(CPUState* cpu) {
         /* 02214304 */ cpu->f[1] = fma(cpu->f[7], cpu->f[30], cpu->f[31]);
         /* 02214308 */ goto L_02214350;
   L_0221430C: ; // 0x221430c
-        /* 0221430C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[30]);
-        /* 02214310 */ _t47 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221430C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[30]));
+        /* 02214310 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02214310 */ _t48 = _t47 & 0x00000001u;
         /* 02214310 */ if (_t48) goto L_02214314; else goto L_02214318;
   L_02214314: ; // 0x2214314
@@ -14626,7 +14626,7 @@ void Gambit_fn_02214180(CPUState* cpu) {
         /* 02214360 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t55);
         /* 02214364 */ _t56 = cpu->r[1] + 0x00000018u;
         /* 02214364 */ cpu->r[30] = rbrew_read32(cpu->mem, _t56);
-        /* 02214368 */ _t57 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02214368 */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02214368 */ _t58 = _t57 & 0x00000001u;
         /* 02214368 */ if (_t58) goto L_0221436C; // else: addr-0 trap, fall-through
   L_0221436C: ; // 0x221436c
@@ -14958,8 +14958,8 @@ void Gambit_fn_0221440C(CPUState* cpu) {
         /* 0221459C */ cpu->r[4] = cpu->r[27];
         /* 022145A0 */ cpu->r[3] = cpu->r[29];
         /* 022145A4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 022145A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022145AC */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022145A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022145AC */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022145AC */ _t65 = _t64 & 0x00000001u;
         /* 022145AC */ if (_t65) goto L_022145B0; else goto L_022145C4;
   L_022145B0: ; // 0x22145b0
@@ -15076,13 +15076,13 @@ void Gambit_fn_0221440C(CPUState* cpu) {
         /* 022146D0 */ cpu->f[10] = rbrew_read_f64(cpu->mem, _t102);
         /* 022146D4 */ cpu->f[11] = cpu->f[10] - cpu->f[11];
         /* 022146D8 */ cpu->f[8] = (double)(float)cpu->f[11];
-        /* 022146DC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[1]);
-        /* 022146E0 */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022146DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[1]));
+        /* 022146E0 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022146E0 */ _t104 = _t103 & 0x00000001u;
         /* 022146E0 */ if (_t104) goto L_022146F0; else goto L_022146E4;
   L_022146E4: ; // 0x22146e4
-        /* 022146E4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
-        /* 022146E8 */ _t105 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022146E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
+        /* 022146E8 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022146E8 */ _t106 = _t105 & 0x00000001u;
         /* 022146E8 */ if (_t106) goto L_022146EC; else goto L_022146F0;
   L_022146EC: ; // 0x22146ec
@@ -15111,7 +15111,7 @@ void Gambit_fn_0221440C(CPUState* cpu) {
         /* 02214728 */ cpu->f[13] = (double)(float)cpu->f[8];
         /* 0221472C */ cpu->f[9] = fma(cpu->f[9], cpu->f[29], -(cpu->f[31]));
         /* 02214730 */ cpu->f[10] = cpu->f[13] - cpu->f[9];
-        /* 02214734 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[28]);
+        /* 02214734 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[28]));
         /* 02214738 */ /* nop */
         /* 0221473C */ cpu->r[6] = rbrew_rlwinm(cpu->r[9], 0x00000002u, 0x0000001Fu, 0x0000001Fu);
         /* 02214740 */ _t113 = cpu->r[29] + 0x00000184u;
@@ -15172,8 +15172,8 @@ void Gambit_fn_0221440C(CPUState* cpu) {
         /* 022147D4 */ Gambit_fn_027E3E40(cpu);
         /* 022147D8 */ _t131 = cpu->r[3] + 0x00000058u;
         /* 022147D8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t131);
-        /* 022147DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 022147E0 */ _t132 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022147DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 022147E0 */ _t132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022147E0 */ _t133 = _t132 & 0x00000001u;
         /* 022147E0 */ if (_t133) goto L_022147EC; else goto L_022147E4;
   L_022147E4: ; // 0x22147e4
@@ -15201,7 +15201,7 @@ void Gambit_fn_0221440C(CPUState* cpu) {
         /* 02214810 */ cpu->f[27] = rbrew_read_f64(cpu->mem, _t142);
         /* 02214814 */ _t143 = cpu->r[1] + 0x000000D8u;
         /* 02214814 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t143);
-        /* 02214818 */ _t144 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02214818 */ _t144 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02214818 */ _t145 = _t144 & 0x00000001u;
         /* 02214818 */ if (_t145) goto L_0221481C; // else: addr-0 trap, fall-through
   L_0221481C: ; // 0x221481c
@@ -15267,10 +15267,10 @@ void Gambit_fn_0221482C(CPUState* cpu) {
         /* 022148A8 */ cpu->f[12] = cpu->f[0] / cpu->f[9];
         /* 022148AC */ _t15 = cpu->r[10] + 0xFFFFB140u;
         /* 022148AC */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t15);
-        /* 022148B0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[11]);
+        /* 022148B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[11]));
         /* 022148B4 */ _t16 = cpu->r[3] + 0x00000510u;
         /* 022148B4 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t16);
-        /* 022148B8 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022148B8 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022148B8 */ _t18 = _t17 & 0x00000001u;
         /* 022148B8 */ if (_t18) goto L_022148C4; else goto L_022148BC;
   L_022148BC: ; // 0x22148bc
@@ -15280,8 +15280,8 @@ void Gambit_fn_0221482C(CPUState* cpu) {
         /* 022148C4 */ cpu->r[12] = 0x10050000u;
         /* 022148C8 */ _t19 = cpu->r[12] + 0xFFFFB234u;
         /* 022148C8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t19);
-        /* 022148CC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[0]);
-        /* 022148D0 */ _t20 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022148CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[0]));
+        /* 022148D0 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022148D0 */ _t21 = _t20 & 0x00000001u;
         /* 022148D0 */ if (_t21) goto L_022148D4; else goto L_022148DC;
   L_022148D4: ; // 0x22148d4
@@ -15351,10 +15351,10 @@ void Gambit_fn_02214830(CPUState* cpu) {
         /* 022148A8 */ cpu->f[12] = cpu->f[0] / cpu->f[9];
         /* 022148AC */ _t15 = cpu->r[10] + 0xFFFFB140u;
         /* 022148AC */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t15);
-        /* 022148B0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[11]);
+        /* 022148B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[11]));
         /* 022148B4 */ _t16 = cpu->r[3] + 0x00000510u;
         /* 022148B4 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t16);
-        /* 022148B8 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022148B8 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022148B8 */ _t18 = _t17 & 0x00000001u;
         /* 022148B8 */ if (_t18) goto L_022148C4; else goto L_022148BC;
   L_022148BC: ; // 0x22148bc
@@ -15364,8 +15364,8 @@ void Gambit_fn_02214830(CPUState* cpu) {
         /* 022148C4 */ cpu->r[12] = 0x10050000u;
         /* 022148C8 */ _t19 = cpu->r[12] + 0xFFFFB234u;
         /* 022148C8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t19);
-        /* 022148CC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[0]);
-        /* 022148D0 */ _t20 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022148CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[0]));
+        /* 022148D0 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022148D0 */ _t21 = _t20 & 0x00000001u;
         /* 022148D0 */ if (_t21) goto L_022148D4; else goto L_022148DC;
   L_022148D4: ; // 0x22148d4
@@ -15405,9 +15405,9 @@ void Gambit_fn_022148F0(CPUState* cpu) {
         /* 02214914 */ _t6 = cpu->r[30] + 0x00000184u;
         /* 02214914 */ cpu->r[9] = rbrew_read32(cpu->mem, _t6);
         /* 02214918 */ cpu->r[9] = rbrew_rlwinm(cpu->r[9], 0x00000000u, 0x0000001Au, 0x0000001Cu);
-        /* 02214918 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02214918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0221491C */ cpu->r[31] = cpu->r[4];
-        /* 02214920 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02214920 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02214920 */ _t8 = _t7 & 0x00000001u;
         /* 02214920 */ if (_t8) goto L_02214924; else goto L_02214974;
   L_02214924: ; // 0x2214924
@@ -15415,13 +15415,13 @@ void Gambit_fn_022148F0(CPUState* cpu) {
         /* 02214924 */ cpu->r[10] = rbrew_read32(cpu->mem, _t9);
         /* 02214928 */ _t10 = cpu->r[5] + 0x00000000u;
         /* 02214928 */ cpu->r[0] = rbrew_read32(cpu->mem, _t10);
-        /* 0221492C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[10]);
-        /* 02214930 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221492C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[10]));
+        /* 02214930 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02214930 */ _t12 = _t11 & 0x00000001u;
         /* 02214930 */ if (_t12) goto L_02214934; else goto L_022149A0;
   L_02214934: ; // 0x2214934
-        /* 02214934 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x0000000Au);
-        /* 02214938 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02214934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x0000000Au));
+        /* 02214938 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02214938 */ _t14 = _t13 & 0x00000001u;
         /* 02214938 */ if (_t14) goto L_0221493C; else goto L_02214974;
   L_0221493C: ; // 0x221493c
@@ -15439,7 +15439,7 @@ void Gambit_fn_022148F0(CPUState* cpu) {
         /* 02214958 */ _t19 = cpu->r[1] + 0x00000010u;
         /* 02214958 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t19);
         /* 0221495C */ cpu->f[1] = cpu->f[1] * cpu->f[0];
-        /* 02214960 */ _t20 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02214960 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02214960 */ _t21 = _t20 & 0x00000001u;
         /* 02214960 */ if (_t21) goto L_02214964; // else: addr-0 trap, fall-through
   L_02214964: ; // 0x2214964
@@ -15460,7 +15460,7 @@ void Gambit_fn_022148F0(CPUState* cpu) {
         /* 02214984 */ cpu->r[30] = rbrew_read32(cpu->mem, _t26);
         /* 02214988 */ _t27 = cpu->r[11] + 0xFFFFB140u;
         /* 02214988 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t27);
-        /* 0221498C */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221498C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221498C */ _t29 = _t28 & 0x00000001u;
         /* 0221498C */ if (_t29) goto L_02214990; // else: addr-0 trap, fall-through
   L_02214990: ; // 0x2214990
@@ -15475,16 +15475,16 @@ void Gambit_fn_022148F0(CPUState* cpu) {
         /* 022149A8 */ cpu->r[3] = cpu->r[31];
         /* 022149AC */ cpu->f[31] = cpu->f[1];
         /* 022149B0 */ Gambit_fn_021BCFBC(cpu);
-        /* 022149B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022149B8 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022149B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022149B8 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022149B8 */ _t32 = _t31 & 0x00000001u;
         /* 022149B8 */ if (_t32) goto L_022149F0; else goto L_022149BC;
   L_022149BC: ; // 0x22149bc
-        /* 022149BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x0000000Cu);
+        /* 022149BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x0000000Cu));
         /* 022149C0 */ cpu->r[3] = cpu->r[30];
         /* 022149C4 */ _t33 = cpu->r[30] + 0x00000004u;
         /* 022149C4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t33);
-        /* 022149C8 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022149C8 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022149C8 */ _t35 = _t34 & 0x00000001u;
         /* 022149C8 */ if (_t35) goto L_022149CC; else goto L_022149E0;
   L_022149CC: ; // 0x22149cc
@@ -15510,7 +15510,7 @@ void Gambit_fn_022148F0(CPUState* cpu) {
         /* 022149FC */ cpu->r[31] = rbrew_read32(cpu->mem, _t40);
         /* 02214A00 */ _t41 = cpu->r[1] + 0x00000010u;
         /* 02214A00 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t41);
-        /* 02214A04 */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02214A04 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02214A04 */ _t43 = _t42 & 0x00000001u;
         /* 02214A04 */ if (_t43) goto L_02214A08; // else: addr-0 trap, fall-through
   L_02214A08: ; // 0x2214a08
@@ -15544,9 +15544,9 @@ void Gambit_fn_022148F4(CPUState* cpu) {
         /* 02214914 */ _t6 = cpu->r[30] + 0x00000184u;
         /* 02214914 */ cpu->r[9] = rbrew_read32(cpu->mem, _t6);
         /* 02214918 */ cpu->r[9] = rbrew_rlwinm(cpu->r[9], 0x00000000u, 0x0000001Au, 0x0000001Cu);
-        /* 02214918 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02214918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0221491C */ cpu->r[31] = cpu->r[4];
-        /* 02214920 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02214920 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02214920 */ _t8 = _t7 & 0x00000001u;
         /* 02214920 */ if (_t8) goto L_02214924; else goto L_02214974;
   L_02214924: ; // 0x2214924
@@ -15554,13 +15554,13 @@ void Gambit_fn_022148F4(CPUState* cpu) {
         /* 02214924 */ cpu->r[10] = rbrew_read32(cpu->mem, _t9);
         /* 02214928 */ _t10 = cpu->r[5] + 0x00000000u;
         /* 02214928 */ cpu->r[0] = rbrew_read32(cpu->mem, _t10);
-        /* 0221492C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[10]);
-        /* 02214930 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221492C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[10]));
+        /* 02214930 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02214930 */ _t12 = _t11 & 0x00000001u;
         /* 02214930 */ if (_t12) goto L_02214934; else goto L_022149A0;
   L_02214934: ; // 0x2214934
-        /* 02214934 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x0000000Au);
-        /* 02214938 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02214934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x0000000Au));
+        /* 02214938 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02214938 */ _t14 = _t13 & 0x00000001u;
         /* 02214938 */ if (_t14) goto L_0221493C; else goto L_02214974;
   L_0221493C: ; // 0x221493c
@@ -15578,7 +15578,7 @@ void Gambit_fn_022148F4(CPUState* cpu) {
         /* 02214958 */ _t19 = cpu->r[1] + 0x00000010u;
         /* 02214958 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t19);
         /* 0221495C */ cpu->f[1] = cpu->f[1] * cpu->f[0];
-        /* 02214960 */ _t20 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02214960 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02214960 */ _t21 = _t20 & 0x00000001u;
         /* 02214960 */ if (_t21) goto L_02214964; // else: addr-0 trap, fall-through
   L_02214964: ; // 0x2214964
@@ -15599,7 +15599,7 @@ void Gambit_fn_022148F4(CPUState* cpu) {
         /* 02214984 */ cpu->r[30] = rbrew_read32(cpu->mem, _t26);
         /* 02214988 */ _t27 = cpu->r[11] + 0xFFFFB140u;
         /* 02214988 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t27);
-        /* 0221498C */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221498C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221498C */ _t29 = _t28 & 0x00000001u;
         /* 0221498C */ if (_t29) goto L_02214990; // else: addr-0 trap, fall-through
   L_02214990: ; // 0x2214990
@@ -15614,16 +15614,16 @@ void Gambit_fn_022148F4(CPUState* cpu) {
         /* 022149A8 */ cpu->r[3] = cpu->r[31];
         /* 022149AC */ cpu->f[31] = cpu->f[1];
         /* 022149B0 */ Gambit_fn_021BCFBC(cpu);
-        /* 022149B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022149B8 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022149B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022149B8 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022149B8 */ _t32 = _t31 & 0x00000001u;
         /* 022149B8 */ if (_t32) goto L_022149F0; else goto L_022149BC;
   L_022149BC: ; // 0x22149bc
-        /* 022149BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x0000000Cu);
+        /* 022149BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x0000000Cu));
         /* 022149C0 */ cpu->r[3] = cpu->r[30];
         /* 022149C4 */ _t33 = cpu->r[30] + 0x00000004u;
         /* 022149C4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t33);
-        /* 022149C8 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022149C8 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022149C8 */ _t35 = _t34 & 0x00000001u;
         /* 022149C8 */ if (_t35) goto L_022149CC; else goto L_022149E0;
   L_022149CC: ; // 0x22149cc
@@ -15649,7 +15649,7 @@ void Gambit_fn_022148F4(CPUState* cpu) {
         /* 022149FC */ cpu->r[31] = rbrew_read32(cpu->mem, _t40);
         /* 02214A00 */ _t41 = cpu->r[1] + 0x00000010u;
         /* 02214A00 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t41);
-        /* 02214A04 */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02214A04 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02214A04 */ _t43 = _t42 & 0x00000001u;
         /* 02214A04 */ if (_t43) goto L_02214A08; // else: addr-0 trap, fall-through
   L_02214A08: ; // 0x2214a08
@@ -15743,16 +15743,16 @@ void Gambit_fn_02214A48(CPUState* cpu) {
         /* 0222CA64 */ cpu->r[25] = cpu->r[26];
         /* 0222CA68 */ cpu->r[8] = 0x10050000u;
         /* 0222CA6C */ cpu->r[5] = cpu->r[0] & 0x00000044u;
-        /* 0222CA6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0222CA6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0222CA70 */ _t8 = cpu->r[8] + 0x0000009Cu;
         /* 0222CA70 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t8);
-        /* 0222CA74 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CA74 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CA74 */ _t10 = _t9 & 0x00000001u;
         /* 0222CA74 */ if (_t10) goto L_0222CB3C; else goto L_0222CA78;
   L_0222CA78: ; // 0x222ca78
         /* 0222CA78 */ cpu->r[9] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 0222CA78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0222CA7C */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CA78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0222CA7C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CA7C */ _t12 = _t11 & 0x00000001u;
         /* 0222CA7C */ if (_t12) goto L_0222CA80; else goto L_0222CB3C;
   L_0222CA80: ; // 0x222ca80
@@ -15769,18 +15769,18 @@ void Gambit_fn_02214A48(CPUState* cpu) {
         /* 0222CA9C */ cpu->r[5] = rbrew_read32(cpu->mem, _t15);
         /* 0222CAA0 */ cpu->r[31] = cpu->r[3];
         /* 0222CAA4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0222CAA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0222CAA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0222CAA8 */ cpu->r[27] = cpu->r[30] + 0x00000048u;
-        /* 0222CAAC */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CAAC */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CAAC */ _t17 = _t16 & 0x00000001u;
         /* 0222CAAC */ if (_t17) goto L_0222CAE8; else goto L_0222CAB0;
   L_0222CAB0: ; // 0x222cab0
         /* 0222CAB0 */ cpu->r[3] = cpu->r[30] + 0x0000012Cu;
         /* 0222CAB4 */ Gambit_fn_02C69350(cpu);
-        /* 0222CAB8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 0222CAB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 0222CABC */ _t18 = cpu->r[30] + 0x00000000u;
         /* 0222CABC */ cpu->r[7] = rbrew_read32(cpu->mem, _t18);
-        /* 0222CAC0 */ _t19 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222CAC0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222CAC0 */ _t20 = _t19 & 0x00000001u;
         /* 0222CAC0 */ if (_t20) goto L_0222CAC4; else goto L_0222CAE0;
   L_0222CAC4: ; // 0x222cac4
@@ -15803,8 +15803,8 @@ void Gambit_fn_02214A48(CPUState* cpu) {
         /* 0222CAEC */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t24);
         /* 0222CAF0 */ _t25 = cpu->r[12] + 0x00000114u;
         /* 0222CAF0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t25);
-        /* 0222CAF4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 0222CAF8 */ _t26 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222CAF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 0222CAF8 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222CAF8 */ _t27 = _t26 & 0x00000001u;
         /* 0222CAF8 */ if (_t27) goto L_0222CAFC; else goto L_0222CB10;
   L_0222CAFC: ; // 0x222cafc
@@ -15826,7 +15826,7 @@ void Gambit_fn_02214A48(CPUState* cpu) {
         /* 0222CB20 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t32);
         /* 0222CB24 */ _t33 = cpu->r[1] + 0x00000070u;
         /* 0222CB24 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t33);
-        /* 0222CB28 */ _t34 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222CB28 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222CB28 */ _t35 = _t34 & 0x00000001u;
         /* 0222CB28 */ if (_t35) goto L_0222CB2C; // else: addr-0 trap, fall-through
   L_0222CB2C: ; // 0x222cb2c
@@ -15837,15 +15837,15 @@ void Gambit_fn_02214A48(CPUState* cpu) {
         /* 0222CB38 */ return;
   L_0222CB3C: ; // 0x222cb3c
         /* 0222CB3C */ cpu->r[10] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Cu, 0x0000001Eu);
-        /* 0222CB3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0222CB40 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CB3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0222CB40 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CB40 */ _t38 = _t37 & 0x00000001u;
         /* 0222CB40 */ if (_t38) goto L_0222CBB4; else goto L_0222CB44;
   L_0222CB44: ; // 0x222cb44
         /* 0222CB44 */ _t39 = cpu->r[28] + 0x00000051u;
         /* 0222CB44 */ cpu->r[0] = rbrew_read8(cpu->mem, _t39);
-        /* 0222CB48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222CB4C */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CB48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222CB4C */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CB4C */ _t41 = _t40 & 0x00000001u;
         /* 0222CB4C */ if (_t41) goto L_0222CBB4; else goto L_0222CB50;
   L_0222CB50: ; // 0x222cb50
@@ -15879,8 +15879,8 @@ void Gambit_fn_02214A48(CPUState* cpu) {
         /* 0222CB90 */ cpu->ctr = cpu->r[0];
         /* 0222CB94 */ cpu->r[3] = cpu->r[28];
         /* 0222CB98 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222CB9C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
-        /* 0222CBA0 */ _t53 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222CB9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
+        /* 0222CBA0 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222CBA0 */ _t54 = _t53 & 0x00000001u;
         /* 0222CBA0 */ if (_t54) goto L_0222CBA4; else goto L_0222CBB4;
   L_0222CBA4: ; // 0x222cba4
@@ -15896,8 +15896,8 @@ void Gambit_fn_02214A48(CPUState* cpu) {
         /* 0222CBC0 */ cpu->r[11] = rbrew_rlwinm(cpu->r[12], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 0222CBC4 */ _t56 = cpu->r[11] + cpu->r[0];
         /* 0222CBC4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t56);
-        /* 0222CBC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0222CBCC */ _t57 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CBC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0222CBCC */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CBCC */ _t58 = _t57 & 0x00000001u;
         /* 0222CBCC */ if (_t58) goto L_0222CBD0; else goto L_0222CBE0;
   L_0222CBD0: ; // 0x222cbd0
@@ -15907,10 +15907,10 @@ void Gambit_fn_02214A48(CPUState* cpu) {
         /* 0222CBDC */ goto L_0222CC5C;
   L_0222CBE0: ; // 0x222cbe0
         /* 0222CBE0 */ cpu->r[27] = 0x00000000u;
-        /* 0222CBE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0222CBE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0222CBE8 */ _t59 = cpu->r[1] + 0x0000000Cu;
         /* 0222CBE8 */ rbrew_write32(cpu->mem, _t59, cpu->r[27]);
-        /* 0222CBEC */ _t60 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222CBEC */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222CBEC */ _t61 = _t60 & 0x00000001u;
         /* 0222CBEC */ if (_t61) goto L_0222CBF0; else goto L_0222CC5C;
   L_0222CBF0: ; // 0x222cbf0
@@ -15927,37 +15927,37 @@ void Gambit_fn_02214A48(CPUState* cpu) {
         /* 0222CC14 */ cpu->r[9] = rbrew_read32(cpu->mem, _t62);
         /* 0222CC18 */ _t63 = cpu->r[9] + 0x000001ACu;
         /* 0222CC18 */ cpu->r[7] = rbrew_read32(cpu->mem, _t63);
-        /* 0222CC1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0222CC1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0222CC20 */ _t64 = cpu->r[1] + 0x0000000Cu;
         /* 0222CC20 */ cpu->r[0] = rbrew_read32(cpu->mem, _t64);
-        /* 0222CC24 */ _t65 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CC24 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CC24 */ _t66 = _t65 & 0x00000001u;
         /* 0222CC24 */ if (_t66) goto L_0222CC2C; else goto L_0222CC28;
   L_0222CC28: ; // 0x222cc28
         /* 0222CC28 */ cpu->r[26] = 0x00000001u;
   L_0222CC2C: ; // 0x222cc2c
-        /* 0222CC2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222CC30 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CC2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222CC30 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CC30 */ _t68 = _t67 & 0x00000001u;
         /* 0222CC30 */ if (_t68) goto L_0222CC34; else goto L_0222CC40;
   L_0222CC34: ; // 0x222cc34
-        /* 0222CC34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0222CC38 */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CC34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0222CC38 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CC38 */ _t70 = _t69 & 0x00000001u;
         /* 0222CC38 */ if (_t70) goto L_0222CC3C; else goto L_0222CC40;
   L_0222CC3C: ; // 0x222cc3c
         /* 0222CC3C */ cpu->r[25] = 0x00000001u;
   L_0222CC40: ; // 0x222cc40
         /* 0222CC40 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 0222CC40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0222CC40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0222CC44 */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 0222CC48 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CC48 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CC48 */ _t72 = _t71 & 0x00000001u;
         /* 0222CC48 */ if (_t72) goto L_0222CC4C; else goto L_0222CBF0;
   L_0222CC4C: ; // 0x222cc4c
         /* 0222CC4C */ cpu->r[0] = cpu->r[26] | cpu->r[25];
-        /* 0222CC4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222CC50 */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CC4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222CC50 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CC50 */ _t74 = _t73 & 0x00000001u;
         /* 0222CC50 */ if (_t74) goto L_0222CC5C; else goto L_0222CC54;
   L_0222CC54: ; // 0x222cc54
@@ -15967,18 +15967,18 @@ void Gambit_fn_02214A48(CPUState* cpu) {
         /* 0222CC5C */ _t75 = cpu->r[30] + 0x00000000u;
         /* 0222CC5C */ cpu->r[6] = rbrew_read32(cpu->mem, _t75);
         /* 0222CC60 */ cpu->r[0] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0222CC60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0222CC60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0222CC64 */ cpu->r[27] = cpu->r[30] + 0x00000048u;
-        /* 0222CC68 */ _t76 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CC68 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CC68 */ _t77 = _t76 & 0x00000001u;
         /* 0222CC68 */ if (_t77) goto L_0222CCA4; else goto L_0222CC6C;
   L_0222CC6C: ; // 0x222cc6c
         /* 0222CC6C */ cpu->r[3] = cpu->r[30] + 0x0000012Cu;
         /* 0222CC70 */ Gambit_fn_02C69350(cpu);
-        /* 0222CC74 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 0222CC74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 0222CC78 */ _t78 = cpu->r[30] + 0x00000000u;
         /* 0222CC78 */ cpu->r[11] = rbrew_read32(cpu->mem, _t78);
-        /* 0222CC7C */ _t79 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222CC7C */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222CC7C */ _t80 = _t79 & 0x00000001u;
         /* 0222CC7C */ if (_t80) goto L_0222CC80; else goto L_0222CC9C;
   L_0222CC80: ; // 0x222cc80
@@ -16019,7 +16019,7 @@ void Gambit_fn_02214A48(CPUState* cpu) {
         /* 0222CCE0 */ _t89 = cpu->r[1] + 0x00000070u;
         /* 0222CCE0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t89);
         /* 0222CCE4 */ cpu->r[3] = 0x00000001u;
-        /* 0222CCE8 */ _t90 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222CCE8 */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222CCE8 */ _t91 = _t90 & 0x00000001u;
         /* 0222CCE8 */ if (_t91) goto L_0222CCEC; // else: addr-0 trap, fall-through
   L_0222CCEC: ; // 0x222ccec
@@ -16063,8 +16063,8 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222CD34 */ cpu->r[30] = cpu->r[5];
         /* 0222CD38 */ cpu->r[28] = cpu->r[4];
         /* 0222CD3C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222CD40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222CD44 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CD40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222CD44 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CD44 */ _t9 = _t8 & 0x00000001u;
         /* 0222CD44 */ if (_t9) goto L_0222CD48; else goto L_0222CD74;
   L_0222CD48: ; // 0x222cd48
@@ -16078,7 +16078,7 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222CD58 */ _t13 = cpu->r[1] + 0x000000A0u;
         /* 0222CD58 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t13);
         /* 0222CD5C */ cpu->r[3] = 0x00000000u;
-        /* 0222CD60 */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222CD60 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222CD60 */ _t15 = _t14 & 0x00000001u;
         /* 0222CD60 */ if (_t15) goto L_0222CD64; // else: addr-0 trap, fall-through
   L_0222CD64: ; // 0x222cd64
@@ -16095,8 +16095,8 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222CD7C */ cpu->ctr = cpu->r[0];
         /* 0222CD80 */ cpu->r[3] = cpu->r[29];
         /* 0222CD84 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222CD88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222CD8C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CD88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222CD8C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CD8C */ _t20 = _t19 & 0x00000001u;
         /* 0222CD8C */ if (_t20) goto L_0222CE04; else goto L_0222CD90;
   L_0222CD90: ; // 0x222cd90
@@ -16107,9 +16107,9 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222CD98 */ cpu->r[7] = rbrew_read32(cpu->mem, _t22);
         /* 0222CD9C */ _t23 = cpu->r[9] + 0x00000078u;
         /* 0222CD9C */ cpu->r[4] = rbrew_read32(cpu->mem, _t23);
-        /* 0222CDA0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[4]);
+        /* 0222CDA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[4]));
         /* 0222CDA4 */ cpu->r[3] = 0x00000000u;
-        /* 0222CDA8 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222CDA8 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222CDA8 */ _t25 = _t24 & 0x00000001u;
         /* 0222CDA8 */ if (_t25) goto L_0222CDAC; else goto L_0222CDB8;
   L_0222CDAC: ; // 0x222cdac
@@ -16120,8 +16120,8 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222CDB4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t27);
   L_0222CDB8: ; // 0x222cdb8
         /* 0222CDB8 */ Gambit_fn_025E068C(cpu);
-        /* 0222CDBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222CDC0 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CDBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222CDC0 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CDC0 */ _t29 = _t28 & 0x00000001u;
         /* 0222CDC0 */ if (_t29) goto L_0222CDC4; else goto L_0222CE04;
   L_0222CDC4: ; // 0x222cdc4
@@ -16142,7 +16142,7 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222CDE8 */ _t35 = cpu->r[1] + 0x000000A0u;
         /* 0222CDE8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t35);
         /* 0222CDEC */ cpu->r[3] = 0x00000001u;
-        /* 0222CDF0 */ _t36 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222CDF0 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222CDF0 */ _t37 = _t36 & 0x00000001u;
         /* 0222CDF0 */ if (_t37) goto L_0222CDF4; // else: addr-0 trap, fall-through
   L_0222CDF4: ; // 0x222cdf4
@@ -16160,18 +16160,18 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222CE10 */ cpu->r[31] = rbrew_read32(cpu->mem, _t40);
         /* 0222CE14 */ cpu->r[26] = 0x00000000u;
         /* 0222CE18 */ cpu->r[7] = 0x10050000u;
-        /* 0222CE1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0222CE1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0222CE20 */ _t41 = cpu->r[7] + 0x0000009Cu;
         /* 0222CE20 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t41);
-        /* 0222CE24 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CE24 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CE24 */ _t43 = _t42 & 0x00000001u;
         /* 0222CE24 */ if (_t43) goto L_0222CE28; else goto L_0222CE34;
   L_0222CE28: ; // 0x222ce28
         /* 0222CE28 */ _t44 = cpu->r[30] + 0x0000015Cu;
         /* 0222CE28 */ cpu->r[11] = rbrew_read32(cpu->mem, _t44);
         /* 0222CE2C */ cpu->r[5] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000018u, 0x0000001Au);
-        /* 0222CE2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 0222CE30 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CE2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 0222CE30 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CE30 */ _t46 = _t45 & 0x00000001u;
         /* 0222CE30 */ if (_t46) goto L_0222CF50; else goto L_0222CE34;
   L_0222CE34: ; // 0x222ce34
@@ -16186,14 +16186,14 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222CE48 */ cpu->r[3] = cpu->r[29];
         /* 0222CE4C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0222CE50 */ cpu->f[30] = cpu->f[1];
-        /* 0222CE54 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
-        /* 0222CE58 */ _t50 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222CE54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
+        /* 0222CE58 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222CE58 */ _t51 = _t50 & 0x00000001u;
         /* 0222CE58 */ if (_t51) goto L_0222CE5C; else goto L_0222CF4C;
   L_0222CE5C: ; // 0x222ce5c
-        /* 0222CE5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0222CE5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0222CE60 */ cpu->r[24] = 0x00000000u;
-        /* 0222CE64 */ _t52 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222CE64 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222CE64 */ _t53 = _t52 & 0x00000001u;
         /* 0222CE64 */ if (_t53) goto L_0222CE68; else goto L_0222CF4C;
   L_0222CE68: ; // 0x222ce68
@@ -16211,8 +16211,8 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222CE90 */ Gambit_fn_02040F70(cpu);
         /* 0222CE94 */ _t54 = cpu->r[1] + 0x00000018u;
         /* 0222CE94 */ cpu->r[0] = rbrew_read32(cpu->mem, _t54);
-        /* 0222CE98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222CE9C */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CE98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222CE9C */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CE9C */ _t56 = _t55 & 0x00000001u;
         /* 0222CE9C */ if (_t56) goto L_0222CF40; else goto L_0222CEA0;
   L_0222CEA0: ; // 0x222cea0
@@ -16220,15 +16220,15 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222CEA0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t57);
         /* 0222CEA4 */ _t58 = cpu->r[9] + 0x000001ACu;
         /* 0222CEA4 */ cpu->r[4] = rbrew_read32(cpu->mem, _t58);
-        /* 0222CEA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0222CEAC */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CEA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0222CEAC */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CEAC */ _t60 = _t59 & 0x00000001u;
         /* 0222CEAC */ if (_t60) goto L_0222CF40; else goto L_0222CEB0;
   L_0222CEB0: ; // 0x222ceb0
         /* 0222CEB0 */ _t61 = cpu->r[29] + 0x00000051u;
         /* 0222CEB0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t61);
-        /* 0222CEB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222CEB8 */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CEB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222CEB8 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CEB8 */ _t63 = _t62 & 0x00000001u;
         /* 0222CEB8 */ if (_t63) goto L_0222CF3C; else goto L_0222CEBC;
   L_0222CEBC: ; // 0x222cebc
@@ -16287,9 +16287,9 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222CF3C */ cpu->r[26] = 0x00000001u;
   L_0222CF40: ; // 0x222cf40
         /* 0222CF40 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 0222CF40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0222CF40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0222CF44 */ cpu->r[24] = cpu->r[24] + 0x00000001u;
-        /* 0222CF48 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CF48 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CF48 */ _t84 = _t83 & 0x00000001u;
         /* 0222CF48 */ if (_t84) goto L_0222CF4C; else goto L_0222CE70;
   L_0222CF4C: ; // 0x222cf4c
@@ -16300,26 +16300,26 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222CF54 */ _t86 = cpu->r[30] + 0x00000000u;
         /* 0222CF54 */ cpu->r[5] = rbrew_read32(cpu->mem, _t86);
         /* 0222CF58 */ cpu->r[12] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 0222CF58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0222CF58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0222CF5C */ _t87 = cpu->r[6] + 0x00000098u;
         /* 0222CF5C */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t87);
-        /* 0222CF60 */ _t88 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CF60 */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CF60 */ _t89 = _t88 & 0x00000001u;
         /* 0222CF60 */ if (_t89) goto L_0222CFB4; else goto L_0222CF64;
   L_0222CF64: ; // 0x222cf64
         /* 0222CF64 */ cpu->r[4] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0222CF64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 0222CF64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 0222CF68 */ cpu->r[31] = cpu->r[30] + 0x000000A8u;
-        /* 0222CF6C */ _t90 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CF6C */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CF6C */ _t91 = _t90 & 0x00000001u;
         /* 0222CF6C */ if (_t91) goto L_0222CFA8; else goto L_0222CF70;
   L_0222CF70: ; // 0x222cf70
         /* 0222CF70 */ cpu->r[3] = cpu->r[30] + 0x00000138u;
         /* 0222CF74 */ Gambit_fn_02C69350(cpu);
-        /* 0222CF78 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
+        /* 0222CF78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
         /* 0222CF7C */ _t92 = cpu->r[30] + 0x00000000u;
         /* 0222CF7C */ cpu->r[12] = rbrew_read32(cpu->mem, _t92);
-        /* 0222CF80 */ _t93 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222CF80 */ _t93 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222CF80 */ _t94 = _t93 & 0x00000001u;
         /* 0222CF80 */ if (_t94) goto L_0222CF84; else goto L_0222CFA0;
   L_0222CF84: ; // 0x222cf84
@@ -16337,26 +16337,26 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222CFA4 */ _t97 = cpu->r[30] + 0x00000000u;
         /* 0222CFA4 */ rbrew_write32(cpu->mem, _t97, cpu->r[12]);
   L_0222CFA8: ; // 0x222cfa8
-        /* 0222CFA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0222CFAC */ _t98 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CFA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0222CFAC */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CFAC */ _t99 = _t98 & 0x00000001u;
         /* 0222CFAC */ if (_t99) goto L_0222D018; else goto L_0222CFB0;
   L_0222CFB0: ; // 0x222cfb0
         /* 0222CFB0 */ goto L_0222D000;
   L_0222CFB4: ; // 0x222cfb4
         /* 0222CFB4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0222CFB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0222CFB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0222CFB8 */ cpu->r[31] = cpu->r[30] + 0x00000048u;
-        /* 0222CFBC */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CFBC */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CFBC */ _t101 = _t100 & 0x00000001u;
         /* 0222CFBC */ if (_t101) goto L_0222CFF8; else goto L_0222CFC0;
   L_0222CFC0: ; // 0x222cfc0
         /* 0222CFC0 */ cpu->r[3] = cpu->r[30] + 0x0000012Cu;
         /* 0222CFC4 */ Gambit_fn_02C69350(cpu);
-        /* 0222CFC8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
+        /* 0222CFC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
         /* 0222CFCC */ _t102 = cpu->r[30] + 0x00000000u;
         /* 0222CFCC */ cpu->r[0] = rbrew_read32(cpu->mem, _t102);
-        /* 0222CFD0 */ _t103 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222CFD0 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222CFD0 */ _t104 = _t103 & 0x00000001u;
         /* 0222CFD0 */ if (_t104) goto L_0222CFD4; else goto L_0222CFF0;
   L_0222CFD4: ; // 0x222cfd4
@@ -16374,8 +16374,8 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222CFF4 */ _t107 = cpu->r[30] + 0x00000000u;
         /* 0222CFF4 */ rbrew_write32(cpu->mem, _t107, cpu->r[0]);
   L_0222CFF8: ; // 0x222cff8
-        /* 0222CFF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0222CFFC */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CFF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0222CFFC */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CFFC */ _t109 = _t108 & 0x00000001u;
         /* 0222CFFC */ if (_t109) goto L_0222D018; else goto L_0222D000;
   L_0222D000: ; // 0x222d000
@@ -16400,8 +16400,8 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D02C */ rbrew_write_f32(cpu->mem, _t115, cpu->f[7]);
         /* 0222D030 */ _t116 = cpu->r[30] + 0x00000040u;
         /* 0222D030 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t116);
-        /* 0222D034 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[10]);
-        /* 0222D038 */ _t117 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D034 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[10]));
+        /* 0222D038 */ _t117 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D038 */ _t118 = _t117 & 0x00000001u;
         /* 0222D038 */ if (_t118) goto L_0222D060; else goto L_0222D03C;
   L_0222D03C: ; // 0x222d03c
@@ -16410,7 +16410,7 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D040 */ _t120 = cpu->r[30] + 0x00000034u;
         /* 0222D040 */ rbrew_write_f32(cpu->mem, _t120, cpu->f[31]);
         /* 0222D044 */ cpu->r[11] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 0222D044 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0222D044 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0222D048 */ _t121 = cpu->r[30] + 0x0000003Cu;
         /* 0222D048 */ rbrew_write_f32(cpu->mem, _t121, cpu->f[31]);
         /* 0222D04C */ _t122 = cpu->r[30] + 0x00000040u;
@@ -16418,7 +16418,7 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D050 */ cpu->r[12] = cpu->r[30] + 0x00000034u;
         /* 0222D054 */ _t123 = cpu->r[30] + 0x00000038u;
         /* 0222D054 */ rbrew_write_f32(cpu->mem, _t123, cpu->f[31]);
-        /* 0222D058 */ _t124 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D058 */ _t124 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D058 */ _t125 = _t124 & 0x00000001u;
         /* 0222D058 */ if (_t125) goto L_0222D05C; else goto L_0222D0BC;
   L_0222D05C: ; // 0x222d05c
@@ -16427,8 +16427,8 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D060 */ _t126 = cpu->r[30] + 0x00000000u;
         /* 0222D060 */ cpu->r[10] = rbrew_read32(cpu->mem, _t126);
         /* 0222D064 */ cpu->r[6] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Bu, 0x0000001Cu);
-        /* 0222D064 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0222D068 */ _t127 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D064 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0222D068 */ _t127 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D068 */ _t128 = _t127 & 0x00000001u;
         /* 0222D068 */ if (_t128) goto L_0222D06C; else goto L_0222D0A0;
   L_0222D06C: ; // 0x222d06c
@@ -16445,9 +16445,9 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D088 */ rbrew_write_f32(cpu->mem, _t131, cpu->f[10]);
         /* 0222D08C */ _t132 = cpu->r[30] + 0x00000040u;
         /* 0222D08C */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t132);
-        /* 0222D090 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[12]);
+        /* 0222D090 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[12]));
         /* 0222D094 */ cpu->r[12] = cpu->r[30] + 0x00000034u;
-        /* 0222D098 */ _t133 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D098 */ _t133 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D098 */ _t134 = _t133 & 0x00000001u;
         /* 0222D098 */ if (_t134) goto L_0222D280; else goto L_0222D09C;
   L_0222D09C: ; // 0x222d09c
@@ -16458,13 +16458,13 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D0A4 */ _t136 = cpu->r[30] + 0x00000038u;
         /* 0222D0A4 */ rbrew_write_f32(cpu->mem, _t136, cpu->f[31]);
         /* 0222D0A8 */ cpu->r[11] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 0222D0A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0222D0A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0222D0AC */ _t137 = cpu->r[30] + 0x00000034u;
         /* 0222D0AC */ rbrew_write_f32(cpu->mem, _t137, cpu->f[31]);
         /* 0222D0B0 */ cpu->r[12] = cpu->r[30] + 0x00000034u;
         /* 0222D0B4 */ _t138 = cpu->r[30] + 0x0000003Cu;
         /* 0222D0B4 */ rbrew_write_f32(cpu->mem, _t138, cpu->f[31]);
-        /* 0222D0B8 */ _t139 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D0B8 */ _t139 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D0B8 */ _t140 = _t139 & 0x00000001u;
         /* 0222D0B8 */ if (_t140) goto L_0222D0E0; else goto L_0222D0BC;
   L_0222D0BC: ; // 0x222d0bc
@@ -16483,8 +16483,8 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D0DC */ cpu->r[10] = rbrew_read32(cpu->mem, _t144);
   L_0222D0E0: ; // 0x222d0e0
         /* 0222D0E0 */ cpu->r[4] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Bu, 0x0000001Bu);
-        /* 0222D0E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0222D0E4 */ _t145 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D0E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0222D0E4 */ _t145 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D0E4 */ _t146 = _t145 & 0x00000001u;
         /* 0222D0E4 */ if (_t146) goto L_0222D22C; else goto L_0222D0E8;
   L_0222D0E8: ; // 0x222d0e8
@@ -16492,12 +16492,12 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D0E8 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t147);
         /* 0222D0EC */ _t148 = cpu->r[30] + 0x00000040u;
         /* 0222D0EC */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t148);
-        /* 0222D0F0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
+        /* 0222D0F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
         /* 0222D0F4 */ _t149 = cpu->r[30] + 0x0000001Cu;
         /* 0222D0F4 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t149);
         /* 0222D0F8 */ _t150 = cpu->r[30] + 0x00000028u;
         /* 0222D0F8 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t150);
-        /* 0222D0FC */ _t151 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D0FC */ _t151 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D0FC */ _t152 = _t151 & 0x00000001u;
         /* 0222D0FC */ if (_t152) goto L_0222D100; else goto L_0222D124;
   L_0222D100: ; // 0x222d100
@@ -16508,17 +16508,17 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D10C */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t153);
         /* 0222D110 */ _t154 = cpu->r[30] + 0x0000002Cu;
         /* 0222D110 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t154);
-        /* 0222D114 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 0222D114 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 0222D118 */ _t155 = cpu->r[30] + 0x00000020u;
         /* 0222D118 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t155);
-        /* 0222D11C */ _t156 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D11C */ _t156 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D11C */ _t157 = _t156 & 0x00000001u;
         /* 0222D11C */ if (_t157) goto L_0222D120; else goto L_0222D18C;
   L_0222D120: ; // 0x222d120
         /* 0222D120 */ goto L_0222D168;
   L_0222D124: ; // 0x222d124
-        /* 0222D124 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
-        /* 0222D128 */ _t158 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222D124 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
+        /* 0222D128 */ _t158 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222D128 */ _t159 = _t158 & 0x00000001u;
         /* 0222D128 */ if (_t159) goto L_0222D12C; else goto L_0222D150;
   L_0222D12C: ; // 0x222d12c
@@ -16526,13 +16526,13 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D130 */ /* nop */
         /* 0222D134 */ _t160 = cpu->r[12] + 0x00000004u;
         /* 0222D134 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t160);
-        /* 0222D138 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 0222D138 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 0222D13C */ _t161 = cpu->r[30] + 0x00000020u;
         /* 0222D13C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t161);
         /* 0222D140 */ cpu->f[0] = fma(cpu->f[7], cpu->f[12], cpu->f[0]);
         /* 0222D144 */ _t162 = cpu->r[30] + 0x0000002Cu;
         /* 0222D144 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t162);
-        /* 0222D148 */ _t163 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D148 */ _t163 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D148 */ _t164 = _t163 & 0x00000001u;
         /* 0222D148 */ if (_t164) goto L_0222D14C; else goto L_0222D18C;
   L_0222D14C: ; // 0x222d14c
@@ -16543,10 +16543,10 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D154 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t165);
         /* 0222D158 */ _t166 = cpu->r[30] + 0x00000020u;
         /* 0222D158 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t166);
-        /* 0222D15C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 0222D15C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 0222D160 */ _t167 = cpu->r[30] + 0x0000002Cu;
         /* 0222D160 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t167);
-        /* 0222D164 */ _t168 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D164 */ _t168 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D164 */ _t169 = _t168 & 0x00000001u;
         /* 0222D164 */ if (_t169) goto L_0222D168; else goto L_0222D18C;
   L_0222D168: ; // 0x222d168
@@ -16554,20 +16554,20 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D16C */ /* nop */
         /* 0222D170 */ _t170 = cpu->r[12] + 0x00000008u;
         /* 0222D170 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t170);
-        /* 0222D174 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
+        /* 0222D174 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
         /* 0222D178 */ _t171 = cpu->r[30] + 0x00000030u;
         /* 0222D178 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t171);
         /* 0222D17C */ cpu->f[7] = fma(cpu->f[13], cpu->f[12], cpu->f[9]);
         /* 0222D180 */ _t172 = cpu->r[30] + 0x00000024u;
         /* 0222D180 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t172);
-        /* 0222D184 */ _t173 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D184 */ _t173 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D184 */ _t174 = _t173 & 0x00000001u;
         /* 0222D184 */ if (_t174) goto L_0222D188; else goto L_0222D1F0;
   L_0222D188: ; // 0x222d188
         /* 0222D188 */ goto L_0222D1D0;
   L_0222D18C: ; // 0x222d18c
-        /* 0222D18C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
-        /* 0222D190 */ _t175 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222D18C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
+        /* 0222D190 */ _t175 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222D190 */ _t176 = _t175 & 0x00000001u;
         /* 0222D190 */ if (_t176) goto L_0222D194; else goto L_0222D1B8;
   L_0222D194: ; // 0x222d194
@@ -16575,13 +16575,13 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D198 */ _t177 = cpu->r[12] + 0x00000008u;
         /* 0222D198 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t177);
         /* 0222D19C */ /* nop */
-        /* 0222D1A0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
+        /* 0222D1A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
         /* 0222D1A4 */ _t178 = cpu->r[30] + 0x00000024u;
         /* 0222D1A4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t178);
         /* 0222D1A8 */ cpu->f[7] = fma(cpu->f[7], cpu->f[12], cpu->f[11]);
         /* 0222D1AC */ _t179 = cpu->r[30] + 0x00000030u;
         /* 0222D1AC */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t179);
-        /* 0222D1B0 */ _t180 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D1B0 */ _t180 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D1B0 */ _t181 = _t180 & 0x00000001u;
         /* 0222D1B0 */ if (_t181) goto L_0222D1B4; else goto L_0222D1F0;
   L_0222D1B4: ; // 0x222d1b4
@@ -16591,11 +16591,11 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D1B8 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t182);
         /* 0222D1BC */ _t183 = cpu->r[30] + 0x00000024u;
         /* 0222D1BC */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t183);
-        /* 0222D1C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
+        /* 0222D1C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
         /* 0222D1C4 */ _t184 = cpu->r[30] + 0x00000030u;
         /* 0222D1C4 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t184);
         /* 0222D1C8 */ cpu->f[7] = cpu->f[13] + cpu->f[7];
-        /* 0222D1CC */ _t185 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D1CC */ _t185 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D1CC */ _t186 = _t185 & 0x00000001u;
         /* 0222D1CC */ if (_t186) goto L_0222D1D0; else goto L_0222D1F0;
   L_0222D1D0: ; // 0x222d1d0
@@ -16612,8 +16612,8 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D1E8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t190);
         /* 0222D1EC */ goto L_0222D22C;
   L_0222D1F0: ; // 0x222d1f0
-        /* 0222D1F0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
-        /* 0222D1F4 */ _t191 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222D1F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
+        /* 0222D1F4 */ _t191 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222D1F4 */ _t192 = _t191 & 0x00000001u;
         /* 0222D1F4 */ if (_t192) goto L_0222D1F8; else goto L_0222D218;
   L_0222D1F8: ; // 0x222d1f8
@@ -16656,8 +16656,8 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D250 */ rbrew_write_f32(cpu->mem, _t204, cpu->f[10]);
         /* 0222D254 */ _t205 = cpu->r[30] + 0x00000040u;
         /* 0222D254 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t205);
-        /* 0222D258 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[12]);
-        /* 0222D25C */ _t206 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D258 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[12]));
+        /* 0222D25C */ _t206 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D25C */ _t207 = _t206 & 0x00000001u;
         /* 0222D25C */ if (_t207) goto L_0222D280; else goto L_0222D260;
   L_0222D260: ; // 0x222d260
@@ -16672,8 +16672,8 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D270 */ _t212 = cpu->r[30] + 0x00000000u;
         /* 0222D270 */ cpu->r[10] = rbrew_read32(cpu->mem, _t212);
         /* 0222D274 */ cpu->r[9] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 0222D274 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0222D278 */ _t213 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D274 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0222D278 */ _t213 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D278 */ _t214 = _t213 & 0x00000001u;
         /* 0222D278 */ if (_t214) goto L_0222D27C; else goto L_0222D2A4;
   L_0222D27C: ; // 0x222d27c
@@ -16682,8 +16682,8 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D280 */ _t215 = cpu->r[30] + 0x00000000u;
         /* 0222D280 */ cpu->r[7] = rbrew_read32(cpu->mem, _t215);
         /* 0222D284 */ cpu->r[5] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Bu, 0x0000001Cu);
-        /* 0222D284 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 0222D288 */ _t216 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D284 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 0222D288 */ _t216 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D288 */ _t217 = _t216 & 0x00000001u;
         /* 0222D288 */ if (_t217) goto L_0222D41C; else goto L_0222D28C;
   L_0222D28C: ; // 0x222d28c
@@ -16696,8 +16696,8 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D298 */ _t221 = cpu->r[30] + 0x00000000u;
         /* 0222D298 */ cpu->r[10] = rbrew_read32(cpu->mem, _t221);
         /* 0222D29C */ cpu->r[9] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 0222D29C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0222D2A0 */ _t222 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D29C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0222D2A0 */ _t222 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D2A0 */ _t223 = _t222 & 0x00000001u;
         /* 0222D2A0 */ if (_t223) goto L_0222D2C8; else goto L_0222D2A4;
   L_0222D2A4: ; // 0x222d2a4
@@ -16716,8 +16716,8 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D2C4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t227);
   L_0222D2C8: ; // 0x222d2c8
         /* 0222D2C8 */ cpu->r[7] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Bu, 0x0000001Bu);
-        /* 0222D2C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0222D2CC */ _t228 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D2C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0222D2CC */ _t228 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D2CC */ _t229 = _t228 & 0x00000001u;
         /* 0222D2CC */ if (_t229) goto L_0222D414; else goto L_0222D2D0;
   L_0222D2D0: ; // 0x222d2d0
@@ -16725,12 +16725,12 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D2D0 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t230);
         /* 0222D2D4 */ _t231 = cpu->r[30] + 0x00000040u;
         /* 0222D2D4 */ cpu->f[4] = rbrew_read_f32(cpu->mem, _t231);
-        /* 0222D2D8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
+        /* 0222D2D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
         /* 0222D2DC */ _t232 = cpu->r[30] + 0x0000001Cu;
         /* 0222D2DC */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t232);
         /* 0222D2E0 */ _t233 = cpu->r[30] + 0x00000028u;
         /* 0222D2E0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t233);
-        /* 0222D2E4 */ _t234 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D2E4 */ _t234 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D2E4 */ _t235 = _t234 & 0x00000001u;
         /* 0222D2E4 */ if (_t235) goto L_0222D2E8; else goto L_0222D30C;
   L_0222D2E8: ; // 0x222d2e8
@@ -16738,20 +16738,20 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D2EC */ _t236 = cpu->r[12] + 0x00000004u;
         /* 0222D2EC */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t236);
         /* 0222D2F0 */ /* nop */
-        /* 0222D2F4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 0222D2F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 0222D2F8 */ _t237 = cpu->r[30] + 0x0000002Cu;
         /* 0222D2F8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t237);
         /* 0222D2FC */ cpu->f[5] = fma(cpu->f[11], cpu->f[4], cpu->f[8]);
         /* 0222D300 */ _t238 = cpu->r[30] + 0x00000020u;
         /* 0222D300 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t238);
-        /* 0222D304 */ _t239 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D304 */ _t239 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D304 */ _t240 = _t239 & 0x00000001u;
         /* 0222D304 */ if (_t240) goto L_0222D308; else goto L_0222D374;
   L_0222D308: ; // 0x222d308
         /* 0222D308 */ goto L_0222D350;
   L_0222D30C: ; // 0x222d30c
-        /* 0222D30C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
-        /* 0222D310 */ _t241 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222D30C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
+        /* 0222D310 */ _t241 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222D310 */ _t242 = _t241 & 0x00000001u;
         /* 0222D310 */ if (_t242) goto L_0222D314; else goto L_0222D338;
   L_0222D314: ; // 0x222d314
@@ -16759,13 +16759,13 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D318 */ _t243 = cpu->r[12] + 0x00000004u;
         /* 0222D318 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t243);
         /* 0222D31C */ /* nop */
-        /* 0222D320 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 0222D320 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 0222D324 */ _t244 = cpu->r[30] + 0x0000002Cu;
         /* 0222D324 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t244);
         /* 0222D328 */ cpu->f[5] = fma(cpu->f[12], cpu->f[4], cpu->f[10]);
         /* 0222D32C */ _t245 = cpu->r[30] + 0x00000020u;
         /* 0222D32C */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t245);
-        /* 0222D330 */ _t246 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D330 */ _t246 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D330 */ _t247 = _t246 & 0x00000001u;
         /* 0222D330 */ if (_t247) goto L_0222D334; else goto L_0222D374;
   L_0222D334: ; // 0x222d334
@@ -16776,10 +16776,10 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D33C */ cpu->f[5] = cpu->f[11] + cpu->f[12];
         /* 0222D340 */ _t249 = cpu->r[30] + 0x0000002Cu;
         /* 0222D340 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t249);
-        /* 0222D344 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 0222D344 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 0222D348 */ _t250 = cpu->r[30] + 0x00000020u;
         /* 0222D348 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t250);
-        /* 0222D34C */ _t251 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D34C */ _t251 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D34C */ _t252 = _t251 & 0x00000001u;
         /* 0222D34C */ if (_t252) goto L_0222D350; else goto L_0222D374;
   L_0222D350: ; // 0x222d350
@@ -16787,20 +16787,20 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D354 */ _t253 = cpu->r[12] + 0x00000008u;
         /* 0222D354 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t253);
         /* 0222D358 */ /* nop */
-        /* 0222D35C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
+        /* 0222D35C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
         /* 0222D360 */ _t254 = cpu->r[30] + 0x00000030u;
         /* 0222D360 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t254);
         /* 0222D364 */ cpu->f[7] = fma(cpu->f[12], cpu->f[4], cpu->f[6]);
         /* 0222D368 */ _t255 = cpu->r[30] + 0x00000024u;
         /* 0222D368 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t255);
-        /* 0222D36C */ _t256 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D36C */ _t256 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D36C */ _t257 = _t256 & 0x00000001u;
         /* 0222D36C */ if (_t257) goto L_0222D370; else goto L_0222D3D8;
   L_0222D370: ; // 0x222d370
         /* 0222D370 */ goto L_0222D3B8;
   L_0222D374: ; // 0x222d374
-        /* 0222D374 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
-        /* 0222D378 */ _t258 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222D374 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
+        /* 0222D378 */ _t258 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222D378 */ _t259 = _t258 & 0x00000001u;
         /* 0222D378 */ if (_t259) goto L_0222D37C; else goto L_0222D3A0;
   L_0222D37C: ; // 0x222d37c
@@ -16811,10 +16811,10 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D388 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t260);
         /* 0222D38C */ _t261 = cpu->r[30] + 0x00000030u;
         /* 0222D38C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t261);
-        /* 0222D390 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
+        /* 0222D390 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
         /* 0222D394 */ _t262 = cpu->r[30] + 0x00000024u;
         /* 0222D394 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t262);
-        /* 0222D398 */ _t263 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D398 */ _t263 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D398 */ _t264 = _t263 & 0x00000001u;
         /* 0222D398 */ if (_t264) goto L_0222D39C; else goto L_0222D3D8;
   L_0222D39C: ; // 0x222d39c
@@ -16825,10 +16825,10 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D3A4 */ cpu->f[7] = cpu->f[12] + cpu->f[0];
         /* 0222D3A8 */ _t266 = cpu->r[30] + 0x00000024u;
         /* 0222D3A8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t266);
-        /* 0222D3AC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
+        /* 0222D3AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
         /* 0222D3B0 */ _t267 = cpu->r[30] + 0x00000030u;
         /* 0222D3B0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t267);
-        /* 0222D3B4 */ _t268 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D3B4 */ _t268 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D3B4 */ _t269 = _t268 & 0x00000001u;
         /* 0222D3B4 */ if (_t269) goto L_0222D3B8; else goto L_0222D3D8;
   L_0222D3B8: ; // 0x222d3b8
@@ -16845,8 +16845,8 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D3D0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t273);
         /* 0222D3D4 */ goto L_0222D414;
   L_0222D3D8: ; // 0x222d3d8
-        /* 0222D3D8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
-        /* 0222D3DC */ _t274 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222D3D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
+        /* 0222D3DC */ _t274 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222D3DC */ _t275 = _t274 & 0x00000001u;
         /* 0222D3DC */ if (_t275) goto L_0222D3E0; else goto L_0222D400;
   L_0222D3E0: ; // 0x222d3e0
@@ -16891,8 +16891,8 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D43C */ _t288 = cpu->r[30] + 0x0000015Cu;
         /* 0222D43C */ cpu->r[0] = rbrew_read32(cpu->mem, _t288);
         /* 0222D440 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 0222D440 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222D444 */ _t289 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D440 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222D444 */ _t289 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D444 */ _t290 = _t289 & 0x00000001u;
         /* 0222D444 */ if (_t290) goto L_0222D498; else goto L_0222D448;
   L_0222D448: ; // 0x222d448
@@ -16922,8 +16922,8 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D480 */ cpu->r[3] = cpu->r[29];
         /* 0222D484 */ cpu->r[5] = cpu->r[31];
         /* 0222D488 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222D48C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222D490 */ _t300 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D48C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222D490 */ _t300 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D490 */ _t301 = _t300 & 0x00000001u;
         /* 0222D490 */ if (_t301) goto L_0222D4E4; else goto L_0222D494;
   L_0222D494: ; // 0x222d494
@@ -16955,15 +16955,15 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D4D0 */ cpu->r[3] = cpu->r[29];
         /* 0222D4D4 */ cpu->r[5] = cpu->r[31];
         /* 0222D4D8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222D4DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222D4E0 */ _t311 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D4DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222D4E0 */ _t311 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D4E0 */ _t312 = _t311 & 0x00000001u;
         /* 0222D4E0 */ if (_t312) goto L_0222D4E4; else goto L_0222D5A4;
   L_0222D4E4: ; // 0x222d4e4
         /* 0222D4E4 */ _t313 = cpu->r[29] + 0x00000051u;
         /* 0222D4E4 */ cpu->r[7] = rbrew_read8(cpu->mem, _t313);
-        /* 0222D4E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0222D4EC */ _t314 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D4E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0222D4EC */ _t314 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D4EC */ _t315 = _t314 & 0x00000001u;
         /* 0222D4EC */ if (_t315) goto L_0222D4F0; else goto L_0222D588;
   L_0222D4F0: ; // 0x222d4f0
@@ -16985,8 +16985,8 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D518 */ cpu->f[6] = cpu->f[8] - cpu->f[30];
         /* 0222D51C */ _t321 = cpu->r[3] + 0x00000268u;
         /* 0222D51C */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t321);
-        /* 0222D520 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[9]);
-        /* 0222D524 */ _t322 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222D520 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[9]));
+        /* 0222D524 */ _t322 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222D524 */ _t323 = _t322 & 0x00000001u;
         /* 0222D524 */ if (_t323) goto L_0222D528; else goto L_0222D5A4;
   L_0222D528: ; // 0x222d528
@@ -17003,13 +17003,13 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D548 */ Gambit_fn_02019890(cpu);
         /* 0222D54C */ _t326 = cpu->r[1] + 0x0000005Cu;
         /* 0222D54C */ cpu->r[12] = rbrew_read32(cpu->mem, _t326);
-        /* 0222D550 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], 0x00000000u);
-        /* 0222D554 */ _t327 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D550 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], 0x00000000u));
+        /* 0222D554 */ _t327 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D554 */ _t328 = _t327 & 0x00000001u;
         /* 0222D554 */ if (_t328) goto L_0222D560; else goto L_0222D558;
   L_0222D558: ; // 0x222d558
-        /* 0222D558 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], 0x0000000Eu);
-        /* 0222D55C */ _t329 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D558 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], 0x0000000Eu));
+        /* 0222D55C */ _t329 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D55C */ _t330 = _t329 & 0x00000001u;
         /* 0222D55C */ if (_t330) goto L_0222D560; else goto L_0222D588;
   L_0222D560: ; // 0x222d560
@@ -17020,11 +17020,11 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D56C */ cpu->r[3] = cpu->r[11] + 0x00000008u;
         /* 0222D570 */ Gambit_fn_02C69328(cpu);
         /* 0222D574 */ cpu->f[8] = cpu->f[31] * cpu->f[31];
-        /* 0222D578 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[8]);
+        /* 0222D578 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[8]));
         /* 0222D57C */ /* nop */
         /* 0222D580 */ cpu->r[0] = rbrew_rlwinm(cpu->r[5], 0x00000002u, 0x0000001Fu, 0x0000001Fu);
-        /* 0222D580 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222D584 */ _t332 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D580 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222D584 */ _t332 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D584 */ _t333 = _t332 & 0x00000001u;
         /* 0222D584 */ if (_t333) goto L_0222D588; else goto L_0222D5A4;
   L_0222D588: ; // 0x222d588
@@ -17062,7 +17062,7 @@ void Gambit_fn_02214A4C(CPUState* cpu) {
         /* 0222D5DC */ _t343 = cpu->r[1] + 0x000000A0u;
         /* 0222D5DC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t343);
         /* 0222D5E0 */ cpu->r[3] = 0x00000001u;
-        /* 0222D5E4 */ _t344 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222D5E4 */ _t344 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222D5E4 */ _t345 = _t344 & 0x00000001u;
         /* 0222D5E4 */ if (_t345) goto L_0222D5E8; // else: addr-0 trap, fall-through
   L_0222D5E8: ; // 0x222d5e8
@@ -17185,8 +17185,8 @@ void Gambit_fn_02214A84(CPUState* cpu) {
         /* 02214B00 */ _t18 = cpu->r[30] + 0x00000184u;
         /* 02214B00 */ cpu->r[5] = rbrew_read32(cpu->mem, _t18);
         /* 02214B04 */ cpu->r[5] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x00000018u, 0x00000018u);
-        /* 02214B04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 02214B08 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02214B04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 02214B08 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02214B08 */ _t20 = _t19 & 0x00000001u;
         /* 02214B08 */ if (_t20) goto L_02214B0C; else goto L_02214B60;
   L_02214B0C: ; // 0x2214b0c
@@ -17212,11 +17212,11 @@ void Gambit_fn_02214A84(CPUState* cpu) {
         /* 02214B44 */ _t26 = cpu->r[11] + 0xFFFFB140u;
         /* 02214B44 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t26);
         /* 02214B48 */ cpu->r[10] = 0x10050000u;
-        /* 02214B4C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[30]);
+        /* 02214B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[30]));
         /* 02214B50 */ _t27 = cpu->r[10] + 0xFFFFB23Cu;
         /* 02214B50 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t27);
         /* 02214B54 */ cpu->r[27] = cpu->r[30] + 0x000000FCu;
-        /* 02214B58 */ _t28 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02214B58 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02214B58 */ _t29 = _t28 & 0x00000001u;
         /* 02214B58 */ if (_t29) goto L_02214B5C; else goto L_02214C58;
   L_02214B5C: ; // 0x2214b5c
@@ -17232,9 +17232,9 @@ void Gambit_fn_02214A84(CPUState* cpu) {
         /* 02214B74 */ _t32 = cpu->r[30] + 0x00000184u;
         /* 02214B74 */ cpu->r[0] = rbrew_read32(cpu->mem, _t32);
         /* 02214B78 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000018u, 0x00000018u);
-        /* 02214B78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02214B78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02214B7C */ cpu->r[27] = cpu->r[3];
-        /* 02214B80 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02214B80 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02214B80 */ _t34 = _t33 & 0x00000001u;
         /* 02214B80 */ if (_t34) goto L_02214B84; else goto L_02214BD4;
   L_02214B84: ; // 0x2214b84
@@ -17260,10 +17260,10 @@ void Gambit_fn_02214A84(CPUState* cpu) {
         /* 02214BBC */ _t40 = cpu->r[11] + 0xFFFFB140u;
         /* 02214BBC */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t40);
         /* 02214BC0 */ cpu->r[10] = 0x10050000u;
-        /* 02214BC4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[30]);
+        /* 02214BC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[30]));
         /* 02214BC8 */ _t41 = cpu->r[10] + 0xFFFFB23Cu;
         /* 02214BC8 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t41);
-        /* 02214BCC */ _t42 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02214BCC */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02214BCC */ _t43 = _t42 & 0x00000001u;
         /* 02214BCC */ if (_t43) goto L_02214BD0; else goto L_02214C58;
   L_02214BD0: ; // 0x2214bd0
@@ -17291,10 +17291,10 @@ void Gambit_fn_02214A84(CPUState* cpu) {
         /* 02214C0C */ _t49 = cpu->r[11] + 0xFFFFB140u;
         /* 02214C0C */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t49);
         /* 02214C10 */ cpu->r[10] = 0x10050000u;
-        /* 02214C14 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[30]);
+        /* 02214C14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[30]));
         /* 02214C18 */ _t50 = cpu->r[10] + 0xFFFFB23Cu;
         /* 02214C18 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t50);
-        /* 02214C1C */ _t51 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02214C1C */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02214C1C */ _t52 = _t51 & 0x00000001u;
         /* 02214C1C */ if (_t52) goto L_02214C20; else goto L_02214C58;
   L_02214C20: ; // 0x2214c20
@@ -17363,11 +17363,11 @@ void Gambit_fn_02214A84(CPUState* cpu) {
         /* 02214CCC */ cpu->r[12] = 0x10050000u;
         /* 02214CD0 */ cpu->f[11] = (double)(float)cpu->f[6];
         /* 02214CD4 */ cpu->r[6] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x00000018u, 0x00000018u);
-        /* 02214CD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02214CD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 02214CD8 */ _t71 = cpu->r[12] + 0xFFFFB234u;
         /* 02214CD8 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t71);
         /* 02214CDC */ cpu->f[26] = cpu->f[27] / cpu->f[11];
-        /* 02214CE0 */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02214CE0 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02214CE0 */ _t73 = _t72 & 0x00000001u;
         /* 02214CE0 */ if (_t73) goto L_02214CE4; else goto L_02214DE4;
   L_02214CE4: ; // 0x2214ce4
@@ -17378,9 +17378,9 @@ void Gambit_fn_02214A84(CPUState* cpu) {
         /* 02214CEC */ cpu->ctr = cpu->r[9];
         /* 02214CF0 */ cpu->r[3] = cpu->r[30];
         /* 02214CF4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02214CF8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[26], cpu->f[31]);
+        /* 02214CF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[26], cpu->f[31]));
         /* 02214CFC */ cpu->f[27] = cpu->f[1];
-        /* 02214D00 */ _t76 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02214D00 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02214D00 */ _t77 = _t76 & 0x00000001u;
         /* 02214D00 */ if (_t77) goto L_02214D34; else goto L_02214D04;
   L_02214D04: ; // 0x2214d04
@@ -17396,18 +17396,18 @@ void Gambit_fn_02214A84(CPUState* cpu) {
         /* 02214D1C */ _t81 = cpu->r[30] + 0x00000004u;
         /* 02214D1C */ cpu->r[9] = rbrew_read32(cpu->mem, _t81);
         /* 02214D20 */ cpu->r[8] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x0000001Au, 0x0000001Cu);
-        /* 02214D20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02214D20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02214D24 */ cpu->f[27] = cpu->f[1];
         /* 02214D28 */ _t82 = cpu->r[9] + 0x000004BCu;
         /* 02214D28 */ cpu->r[10] = rbrew_read32(cpu->mem, _t82);
-        /* 02214D2C */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02214D2C */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02214D2C */ _t84 = _t83 & 0x00000001u;
         /* 02214D2C */ if (_t84) goto L_02214D70; else goto L_02214D30;
   L_02214D30: ; // 0x2214d30
         /* 02214D30 */ goto L_02214D6C;
   L_02214D34: ; // 0x2214d34
-        /* 02214D34 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[26], cpu->f[30]);
-        /* 02214D38 */ _t85 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02214D34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[26], cpu->f[30]));
+        /* 02214D38 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02214D38 */ _t86 = _t85 & 0x00000001u;
         /* 02214D38 */ if (_t86) goto L_02214D3C; else goto L_02214D58;
   L_02214D3C: ; // 0x2214d3c
@@ -17426,10 +17426,10 @@ void Gambit_fn_02214A84(CPUState* cpu) {
         /* 02214D5C */ _t90 = cpu->r[30] + 0x00000004u;
         /* 02214D5C */ cpu->r[9] = rbrew_read32(cpu->mem, _t90);
         /* 02214D60 */ cpu->r[8] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x0000001Au, 0x0000001Cu);
-        /* 02214D60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02214D60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02214D64 */ _t91 = cpu->r[9] + 0x000004BCu;
         /* 02214D64 */ cpu->r[10] = rbrew_read32(cpu->mem, _t91);
-        /* 02214D68 */ _t92 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02214D68 */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02214D68 */ _t93 = _t92 & 0x00000001u;
         /* 02214D68 */ if (_t93) goto L_02214D70; else goto L_02214D6C;
   L_02214D6C: ; // 0x2214d6c
@@ -17438,15 +17438,15 @@ void Gambit_fn_02214A84(CPUState* cpu) {
         /* 02214D70 */ cpu->ctr = cpu->r[10];
         /* 02214D74 */ cpu->r[3] = cpu->r[30];
         /* 02214D78 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02214D7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02214D80 */ _t94 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02214D7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02214D80 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02214D80 */ _t95 = _t94 & 0x00000001u;
         /* 02214D80 */ if (_t95) goto L_02214D88; else goto L_02214D84;
   L_02214D84: ; // 0x2214d84
         /* 02214D84 */ cpu->f[28] = cpu->f[31];
   L_02214D88: ; // 0x2214d88
-        /* 02214D88 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[27]);
-        /* 02214D8C */ _t96 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02214D88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[27]));
+        /* 02214D8C */ _t96 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02214D8C */ _t97 = _t96 & 0x00000001u;
         /* 02214D8C */ if (_t97) goto L_02214D90; else goto L_02214D94;
   L_02214D90: ; // 0x2214d90
@@ -17478,8 +17478,8 @@ void Gambit_fn_02214A84(CPUState* cpu) {
         /* 02214DD0 */ cpu->f[1] = -cpu->f[8];
         /* 02214DD4 */ _t106 = cpu->r[11] + 0xFFFFB348u;
         /* 02214DD4 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t106);
-        /* 02214DD8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[28]);
-        /* 02214DDC */ _t107 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02214DD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[28]));
+        /* 02214DDC */ _t107 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02214DDC */ _t108 = _t107 & 0x00000001u;
         /* 02214DDC */ if (_t108) goto L_022153CC; else goto L_02214DE0;
   L_02214DE0: ; // 0x2214de0
@@ -17495,17 +17495,17 @@ void Gambit_fn_02214A84(CPUState* cpu) {
         /* 02214DF0 */ cpu->r[12] = rbrew_read8(cpu->mem, _t112);
         /* 02214DF4 */ _t113 = cpu->r[27] + 0x00000004u;
         /* 02214DF4 */ cpu->f[3] = rbrew_read_f32(cpu->mem, _t113);
-        /* 02214DF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02214DF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02214DFC */ _t114 = cpu->r[27] + 0x00000008u;
         /* 02214DFC */ cpu->f[2] = rbrew_read_f32(cpu->mem, _t114);
-        /* 02214E00 */ _t115 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02214E00 */ _t115 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02214E00 */ _t116 = _t115 & 0x00000001u;
         /* 02214E00 */ if (_t116) goto L_02214E04; else goto L_02214FA4;
   L_02214E04: ; // 0x2214e04
         /* 02214E04 */ cpu->r[12] = cpu->r[6] + 0x00000218u;
         /* 02214E08 */ cpu->r[0] = cpu->r[1] + 0x000000A8u;
-        /* 02214E0C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
-        /* 02214E10 */ _t117 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02214E0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
+        /* 02214E10 */ _t117 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02214E10 */ _t118 = _t117 & 0x00000001u;
         /* 02214E10 */ if (_t118) goto L_02214E48; else goto L_02214E14;
   L_02214E14: ; // 0x2214e14
@@ -17559,18 +17559,18 @@ void Gambit_fn_02214A84(CPUState* cpu) {
         /* 02214E90 */ /* nop */
         /* 02214E94 */ /* nop */
         /* 02214E98 */ /* nop */
-        /* 02214E9C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[30]);
+        /* 02214E9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[30]));
         /* 02214EA0 */ /* nop */
         /* 02214EA4 */ /* nop */
         /* 02214EA8 */ /* nop */
         /* 02214EAC */ /* nop */
-        /* 02214EB0 */ _t130 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02214EB0 */ _t130 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02214EB0 */ _t131 = _t130 & 0x00000001u;
         /* 02214EB0 */ if (_t131) goto L_02214EB4; else goto L_02214EC0;
   L_02214EB4: ; // 0x2214eb4
         /* 02214EB4 */ /* nop */
-        /* 02214EB8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[30]);
-        /* 02214EBC */ _t132 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02214EB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[30]));
+        /* 02214EBC */ _t132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02214EBC */ _t133 = _t132 & 0x00000001u;
         /* 02214EBC */ if (_t133) goto L_02214F34; else goto L_02214EC0;
   L_02214EC0: ; // 0x2214ec0
@@ -17657,8 +17657,8 @@ void Gambit_fn_02214A84(CPUState* cpu) {
         /* 02214FA8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t153);
         /* 02214FAC */ _t154 = cpu->r[11] + 0x00000753u;
         /* 02214FAC */ cpu->r[0] = rbrew_read8(cpu->mem, _t154);
-        /* 02214FB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02214FB4 */ _t155 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02214FB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02214FB4 */ _t155 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02214FB4 */ _t156 = _t155 & 0x00000001u;
         /* 02214FB4 */ if (_t156) goto L_02214FB8; else goto L_02215184;
   L_02214FB8: ; // 0x2214fb8
@@ -17736,19 +17736,19 @@ void Gambit_fn_02214A84(CPUState* cpu) {
         /* 0221506C */ /* nop */
         /* 02215070 */ /* nop */
         /* 02215074 */ /* nop */
-        /* 02215078 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[30]);
+        /* 02215078 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[30]));
         /* 0221507C */ /* nop */
         /* 02215080 */ /* nop */
         /* 02215084 */ /* nop */
         /* 02215088 */ /* nop */
         /* 0221508C */ /* nop */
-        /* 02215090 */ _t183 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02215090 */ _t183 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02215090 */ _t184 = _t183 & 0x00000001u;
         /* 02215090 */ if (_t184) goto L_02215094; else goto L_022150A0;
   L_02215094: ; // 0x2215094
         /* 02215094 */ /* nop */
-        /* 02215098 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[30]);
-        /* 0221509C */ _t185 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02215098 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[30]));
+        /* 0221509C */ _t185 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221509C */ _t186 = _t185 & 0x00000001u;
         /* 0221509C */ if (_t186) goto L_02215114; else goto L_022150A0;
   L_022150A0: ; // 0x22150a0
@@ -17908,16 +17908,16 @@ void Gambit_fn_02214A84(CPUState* cpu) {
         /* 02215248 */ /* nop */
         /* 0221524C */ /* nop */
         /* 02215250 */ /* nop */
-        /* 02215254 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[30]);
+        /* 02215254 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[30]));
         /* 02215258 */ /* nop */
         /* 0221525C */ /* nop */
-        /* 02215260 */ _t232 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02215260 */ _t232 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02215260 */ _t233 = _t232 & 0x00000001u;
         /* 02215260 */ if (_t233) goto L_02215264; else goto L_02215270;
   L_02215264: ; // 0x2215264
         /* 02215264 */ /* nop */
-        /* 02215268 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[30]);
-        /* 0221526C */ _t234 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02215268 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[30]));
+        /* 0221526C */ _t234 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221526C */ _t235 = _t234 & 0x00000001u;
         /* 0221526C */ if (_t235) goto L_022152E4; else goto L_02215270;
   L_02215270: ; // 0x2215270
@@ -18044,8 +18044,8 @@ void Gambit_fn_02214A84(CPUState* cpu) {
         /* 022153BC */ cpu->f[1] = -cpu->f[8];
         /* 022153C0 */ _t271 = cpu->r[11] + 0xFFFFB348u;
         /* 022153C0 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t271);
-        /* 022153C4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[28]);
-        /* 022153C8 */ _t272 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022153C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[28]));
+        /* 022153C8 */ _t272 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022153C8 */ _t273 = _t272 & 0x00000001u;
         /* 022153C8 */ if (_t273) goto L_022153CC; else goto L_02215400;
   L_022153CC: ; // 0x22153cc
@@ -18059,19 +18059,19 @@ void Gambit_fn_02214A84(CPUState* cpu) {
         /* 022153E0 */ _t276 = cpu->r[1] + 0x00000028u;
         /* 022153E0 */ rbrew_write_f32(cpu->mem, _t276, cpu->f[0]);
         /* 022153E4 */ cpu->f[6] = fma(cpu->f[0], cpu->f[0], cpu->f[9]);
-        /* 022153E8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[30]);
+        /* 022153E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[30]));
         /* 022153EC */ _t277 = cpu->r[1] + 0x0000002Cu;
         /* 022153EC */ rbrew_write_f32(cpu->mem, _t277, cpu->f[10]);
         /* 022153F0 */ cpu->f[27] = cpu->f[1];
-        /* 022153F4 */ _t278 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022153F4 */ _t278 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022153F4 */ _t279 = _t278 & 0x00000001u;
         /* 022153F4 */ if (_t279) goto L_02215434; else goto L_022153F8;
   L_022153F8: ; // 0x22153f8
         /* 022153F8 */ cpu->f[1] = cpu->f[30];
         /* 022153FC */ goto L_02215490;
   L_02215400: ; // 0x2215400
-        /* 02215400 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
-        /* 02215404 */ _t280 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02215400 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
+        /* 02215404 */ _t280 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02215404 */ _t281 = _t280 & 0x00000001u;
         /* 02215404 */ if (_t281) goto L_02215408; else goto L_0221540C;
   L_02215408: ; // 0x2215408
@@ -18086,11 +18086,11 @@ void Gambit_fn_02214A84(CPUState* cpu) {
         /* 0221541C */ _t284 = cpu->r[1] + 0x00000028u;
         /* 0221541C */ rbrew_write_f32(cpu->mem, _t284, cpu->f[0]);
         /* 02215420 */ cpu->f[6] = fma(cpu->f[0], cpu->f[0], cpu->f[9]);
-        /* 02215424 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[30]);
+        /* 02215424 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[30]));
         /* 02215428 */ _t285 = cpu->r[1] + 0x0000002Cu;
         /* 02215428 */ rbrew_write_f32(cpu->mem, _t285, cpu->f[10]);
         /* 0221542C */ cpu->f[27] = cpu->f[1];
-        /* 02215430 */ _t286 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02215430 */ _t286 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02215430 */ _t287 = _t286 & 0x00000001u;
         /* 02215430 */ if (_t287) goto L_02215434; else goto L_022153F8;
   L_02215434: ; // 0x2215434
@@ -18106,17 +18106,17 @@ void Gambit_fn_02214A84(CPUState* cpu) {
         /* 0221544C */ cpu->f[7] = cpu->f[12] * cpu->f[8];
         /* 02215450 */ cpu->f[6] = cpu->f[6] * cpu->f[7];
         /* 02215454 */ /* nop */
-        /* 02215458 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[30]);
+        /* 02215458 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[30]));
         /* 0221545C */ /* nop */
         /* 02215460 */ /* nop */
-        /* 02215464 */ _t291 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02215464 */ _t291 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02215464 */ _t292 = _t291 & 0x00000001u;
         /* 02215464 */ if (_t292) goto L_02215468; else goto L_022153F8;
   L_02215468: ; // 0x2215468
         /* 02215468 */ _t293 = cpu->r[1] + 0x00000028u;
         /* 02215468 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t293);
-        /* 0221546C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[28]);
-        /* 02215470 */ _t294 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221546C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[28]));
+        /* 02215470 */ _t294 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02215470 */ _t295 = _t294 & 0x00000001u;
         /* 02215470 */ if (_t295) goto L_02215474; else goto L_02215480;
   L_02215474: ; // 0x2215474
@@ -18124,8 +18124,8 @@ void Gambit_fn_02214A84(CPUState* cpu) {
         /* 02215478 */ Gambit_fn_02C892F8(cpu);
         /* 0221547C */ goto L_02215490;
   L_02215480: ; // 0x2215480
-        /* 02215480 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
-        /* 02215484 */ _t296 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02215480 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
+        /* 02215484 */ _t296 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02215484 */ _t297 = _t296 & 0x00000001u;
         /* 02215484 */ if (_t297) goto L_02215488; else goto L_0221548C;
   L_02215488: ; // 0x2215488
@@ -18331,7 +18331,7 @@ void Gambit_fn_02214A84(CPUState* cpu) {
         /* 02215688 */ cpu->f[26] = rbrew_read_f64(cpu->mem, _t365);
         /* 0221568C */ _t366 = cpu->r[1] + 0x00000150u;
         /* 0221568C */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t366);
-        /* 02215690 */ _t367 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02215690 */ _t367 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02215690 */ _t368 = _t367 & 0x00000001u;
         /* 02215690 */ if (_t368) goto L_02215694; // else: addr-0 trap, fall-through
   L_02215694: ; // 0x2215694
@@ -18379,18 +18379,18 @@ void Gambit_fn_022156A8(CPUState* cpu) {
         /* 022156E0 */ rbrew_write32(cpu->mem, _t7, cpu->r[8]);
         /* 022156E4 */ _t8 = cpu->r[3] + 0x00000510u;
         /* 022156E4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t8);
-        /* 022156E8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[10]);
+        /* 022156E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[10]));
         /* 022156EC */ _t9 = cpu->r[30] + 0x00000064u;
         /* 022156EC */ cpu->r[5] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t9);
-        /* 022156F0 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022156F0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022156F0 */ _t11 = _t10 & 0x00000001u;
         /* 022156F0 */ if (_t11) goto L_0221572C; else goto L_022156F4;
   L_022156F4: ; // 0x22156f4
         /* 022156F4 */ cpu->r[6] = 0x10050000u;
         /* 022156F8 */ _t12 = cpu->r[6] + 0xFFFFB238u;
         /* 022156F8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t12);
-        /* 022156FC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[13]);
-        /* 02215700 */ _t13 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022156FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[13]));
+        /* 02215700 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02215700 */ _t14 = _t13 & 0x00000001u;
         /* 02215700 */ if (_t14) goto L_0221572C; else goto L_02215704;
   L_02215704: ; // 0x2215704
@@ -18405,7 +18405,7 @@ void Gambit_fn_022156A8(CPUState* cpu) {
         /* 02215714 */ _t19 = cpu->r[31] + 0x00000000u;
         /* 02215714 */ rbrew_write16(cpu->mem, _t19, (uint16_t)cpu->r[5]);
         /* 02215718 */ cpu->r[6] = cpu->r[10] & 0x0000FEFFu;
-        /* 02215718 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02215718 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 0221571C */ cpu->r[11] = 0x00000000u;
         /* 02215720 */ _t20 = cpu->r[31] + 0x00000002u;
         /* 02215720 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[6]);
@@ -18435,16 +18435,16 @@ void Gambit_fn_022156A8(CPUState* cpu) {
         /* 02215760 */ cpu->f[11] = rbrew_read_f64(cpu->mem, _t27);
         /* 02215764 */ cpu->f[12] = cpu->f[11] - cpu->f[12];
         /* 02215768 */ cpu->f[9] = (double)(float)cpu->f[12];
-        /* 0221576C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[13]);
-        /* 02215770 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221576C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[13]));
+        /* 02215770 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02215770 */ _t29 = _t28 & 0x00000001u;
         /* 02215770 */ if (_t29) goto L_02215788; else goto L_02215774;
   L_02215774: ; // 0x2215774
         /* 02215774 */ cpu->r[7] = 0x10050000u;
         /* 02215778 */ _t30 = cpu->r[7] + 0xFFFFB140u;
         /* 02215778 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t30);
-        /* 0221577C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[10]);
-        /* 02215780 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221577C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[10]));
+        /* 02215780 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02215780 */ _t32 = _t31 & 0x00000001u;
         /* 02215780 */ if (_t32) goto L_02215788; else goto L_02215784;
   L_02215784: ; // 0x2215784
@@ -18461,7 +18461,7 @@ void Gambit_fn_022156A8(CPUState* cpu) {
         /* 02215798 */ _t37 = cpu->r[31] + 0x00000000u;
         /* 02215798 */ rbrew_write16(cpu->mem, _t37, (uint16_t)cpu->r[5]);
         /* 0221579C */ cpu->r[6] = cpu->r[10] & 0x0000FEFFu;
-        /* 0221579C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 0221579C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 022157A0 */ cpu->r[11] = cpu->r[11] + 0xFFFFFFFFu;
         /* 022157A4 */ _t38 = cpu->r[31] + 0x00000002u;
         /* 022157A4 */ rbrew_write16(cpu->mem, _t38, (uint16_t)cpu->r[6]);
@@ -18509,18 +18509,18 @@ void Gambit_fn_022156AC(CPUState* cpu) {
         /* 022156E0 */ rbrew_write32(cpu->mem, _t7, cpu->r[8]);
         /* 022156E4 */ _t8 = cpu->r[3] + 0x00000510u;
         /* 022156E4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t8);
-        /* 022156E8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[10]);
+        /* 022156E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[10]));
         /* 022156EC */ _t9 = cpu->r[30] + 0x00000064u;
         /* 022156EC */ cpu->r[5] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t9);
-        /* 022156F0 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022156F0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022156F0 */ _t11 = _t10 & 0x00000001u;
         /* 022156F0 */ if (_t11) goto L_0221572C; else goto L_022156F4;
   L_022156F4: ; // 0x22156f4
         /* 022156F4 */ cpu->r[6] = 0x10050000u;
         /* 022156F8 */ _t12 = cpu->r[6] + 0xFFFFB238u;
         /* 022156F8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t12);
-        /* 022156FC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[13]);
-        /* 02215700 */ _t13 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022156FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[13]));
+        /* 02215700 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02215700 */ _t14 = _t13 & 0x00000001u;
         /* 02215700 */ if (_t14) goto L_0221572C; else goto L_02215704;
   L_02215704: ; // 0x2215704
@@ -18535,7 +18535,7 @@ void Gambit_fn_022156AC(CPUState* cpu) {
         /* 02215714 */ _t19 = cpu->r[31] + 0x00000000u;
         /* 02215714 */ rbrew_write16(cpu->mem, _t19, (uint16_t)cpu->r[5]);
         /* 02215718 */ cpu->r[6] = cpu->r[10] & 0x0000FEFFu;
-        /* 02215718 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02215718 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 0221571C */ cpu->r[11] = 0x00000000u;
         /* 02215720 */ _t20 = cpu->r[31] + 0x00000002u;
         /* 02215720 */ rbrew_write16(cpu->mem, _t20, (uint16_t)cpu->r[6]);
@@ -18565,16 +18565,16 @@ void Gambit_fn_022156AC(CPUState* cpu) {
         /* 02215760 */ cpu->f[11] = rbrew_read_f64(cpu->mem, _t27);
         /* 02215764 */ cpu->f[12] = cpu->f[11] - cpu->f[12];
         /* 02215768 */ cpu->f[9] = (double)(float)cpu->f[12];
-        /* 0221576C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[13]);
-        /* 02215770 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221576C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[13]));
+        /* 02215770 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02215770 */ _t29 = _t28 & 0x00000001u;
         /* 02215770 */ if (_t29) goto L_02215788; else goto L_02215774;
   L_02215774: ; // 0x2215774
         /* 02215774 */ cpu->r[7] = 0x10050000u;
         /* 02215778 */ _t30 = cpu->r[7] + 0xFFFFB140u;
         /* 02215778 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t30);
-        /* 0221577C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[10]);
-        /* 02215780 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221577C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[10]));
+        /* 02215780 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02215780 */ _t32 = _t31 & 0x00000001u;
         /* 02215780 */ if (_t32) goto L_02215788; else goto L_02215784;
   L_02215784: ; // 0x2215784
@@ -18591,7 +18591,7 @@ void Gambit_fn_022156AC(CPUState* cpu) {
         /* 02215798 */ _t37 = cpu->r[31] + 0x00000000u;
         /* 02215798 */ rbrew_write16(cpu->mem, _t37, (uint16_t)cpu->r[5]);
         /* 0221579C */ cpu->r[6] = cpu->r[10] & 0x0000FEFFu;
-        /* 0221579C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 0221579C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 022157A0 */ cpu->r[11] = cpu->r[11] + 0xFFFFFFFFu;
         /* 022157A4 */ _t38 = cpu->r[31] + 0x00000002u;
         /* 022157A4 */ rbrew_write16(cpu->mem, _t38, (uint16_t)cpu->r[6]);
@@ -18636,9 +18636,9 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BEEB4 */ cpu->r[30] = cpu->r[3];
         /* 026BEEB8 */ cpu->r[28] = cpu->r[28] + 0xFFFF8928u;
         /* 026BEEBC */ cpu->r[31] = cpu->r[4];
-        /* 026BEEC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 026BEEC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 026BEEC4 */ cpu->r[29] = 0x00000008u;
-        /* 026BEEC8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BEEC8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BEEC8 */ _t6 = _t5 & 0x00000001u;
         /* 026BEEC8 */ if (_t6) goto L_026BEECC; else goto L_026BEEE0;
   L_026BEECC: ; // 0x26beecc
@@ -18650,8 +18650,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BEEDC */ _t8 = cpu->r[8] + 0xFFFFFED4u;
         /* 026BEEDC */ rbrew_write32(cpu->mem, _t8, cpu->r[28]);
   L_026BEEE0: ; // 0x26beee0
-        /* 026BEEE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BEEE4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BEEE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BEEE4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BEEE4 */ _t10 = _t9 & 0x00000001u;
         /* 026BEEE4 */ if (_t10) goto L_026BEF0C; else goto L_026BEEE8;
   L_026BEEE8: ; // 0x26beee8
@@ -18664,16 +18664,16 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BEEF8 */ cpu->r[4] = cpu->r[4] + 0xFFFFFED4u;
         /* 026BEEFC */ cpu->r[3] = cpu->r[31];
         /* 026BEF00 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BEF04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BEF08 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BEF04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BEF08 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BEF08 */ _t14 = _t13 & 0x00000001u;
         /* 026BEF08 */ if (_t14) goto L_026BEF0C; else goto L_026BF8CC;
   L_026BEF0C: ; // 0x26bef0c
         /* 026BEF0C */ cpu->r[9] = 0x101D0000u;
         /* 026BEF10 */ _t15 = cpu->r[9] + 0xFFFFFCECu;
         /* 026BEF10 */ cpu->r[9] = rbrew_read32(cpu->mem, _t15);
-        /* 026BEF14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 026BEF18 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BEF14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 026BEF18 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BEF18 */ _t17 = _t16 & 0x00000001u;
         /* 026BEF18 */ if (_t17) goto L_026BEF1C; else goto L_026BEF30;
   L_026BEF1C: ; // 0x26bef1c
@@ -18685,8 +18685,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BEF2C */ _t19 = cpu->r[9] + 0xFFFFFED8u;
         /* 026BEF2C */ rbrew_write32(cpu->mem, _t19, cpu->r[28]);
   L_026BEF30: ; // 0x26bef30
-        /* 026BEF30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BEF34 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BEF30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BEF34 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BEF34 */ _t21 = _t20 & 0x00000001u;
         /* 026BEF34 */ if (_t21) goto L_026BEF70; else goto L_026BEF38;
   L_026BEF38: ; // 0x26bef38
@@ -18699,8 +18699,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BEF48 */ cpu->r[4] = cpu->r[4] + 0xFFFFFED8u;
         /* 026BEF4C */ cpu->r[3] = cpu->r[31];
         /* 026BEF50 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BEF54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BEF58 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BEF54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BEF58 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BEF58 */ _t25 = _t24 & 0x00000001u;
         /* 026BEF58 */ if (_t25) goto L_026BEF70; else goto L_026BEF5C;
   L_026BEF5C: ; // 0x26bef5c
@@ -18716,8 +18716,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BEF70 */ cpu->r[8] = 0x101D0000u;
         /* 026BEF74 */ _t29 = cpu->r[8] + 0xFFFFFCF0u;
         /* 026BEF74 */ cpu->r[8] = rbrew_read32(cpu->mem, _t29);
-        /* 026BEF78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 026BEF7C */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BEF78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 026BEF7C */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BEF7C */ _t31 = _t30 & 0x00000001u;
         /* 026BEF7C */ if (_t31) goto L_026BEF80; else goto L_026BEF94;
   L_026BEF80: ; // 0x26bef80
@@ -18729,8 +18729,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BEF90 */ _t33 = cpu->r[10] + 0xFFFFFEDCu;
         /* 026BEF90 */ rbrew_write32(cpu->mem, _t33, cpu->r[28]);
   L_026BEF94: ; // 0x26bef94
-        /* 026BEF94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BEF98 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BEF94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BEF98 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BEF98 */ _t35 = _t34 & 0x00000001u;
         /* 026BEF98 */ if (_t35) goto L_026BEFD4; else goto L_026BEF9C;
   L_026BEF9C: ; // 0x26bef9c
@@ -18743,8 +18743,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BEFAC */ cpu->r[4] = cpu->r[4] + 0xFFFFFEDCu;
         /* 026BEFB0 */ cpu->r[3] = cpu->r[31];
         /* 026BEFB4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BEFB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BEFBC */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BEFB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BEFBC */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BEFBC */ _t39 = _t38 & 0x00000001u;
         /* 026BEFBC */ if (_t39) goto L_026BEFD4; else goto L_026BEFC0;
   L_026BEFC0: ; // 0x26befc0
@@ -18760,8 +18760,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BEFD4 */ cpu->r[7] = 0x101D0000u;
         /* 026BEFD8 */ _t43 = cpu->r[7] + 0xFFFFFCF4u;
         /* 026BEFD8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t43);
-        /* 026BEFDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 026BEFE0 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BEFDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 026BEFE0 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BEFE0 */ _t45 = _t44 & 0x00000001u;
         /* 026BEFE0 */ if (_t45) goto L_026BEFE4; else goto L_026BEFF8;
   L_026BEFE4: ; // 0x26befe4
@@ -18773,8 +18773,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BEFF4 */ _t47 = cpu->r[11] + 0xFFFFFEE0u;
         /* 026BEFF4 */ rbrew_write32(cpu->mem, _t47, cpu->r[28]);
   L_026BEFF8: ; // 0x26beff8
-        /* 026BEFF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BEFFC */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BEFF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BEFFC */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BEFFC */ _t49 = _t48 & 0x00000001u;
         /* 026BEFFC */ if (_t49) goto L_026BF038; else goto L_026BF000;
   L_026BF000: ; // 0x26bf000
@@ -18787,8 +18787,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF010 */ cpu->r[4] = cpu->r[4] + 0xFFFFFEE0u;
         /* 026BF014 */ cpu->r[3] = cpu->r[31];
         /* 026BF018 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BF01C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BF020 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF01C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BF020 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF020 */ _t53 = _t52 & 0x00000001u;
         /* 026BF020 */ if (_t53) goto L_026BF038; else goto L_026BF024;
   L_026BF024: ; // 0x26bf024
@@ -18804,8 +18804,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF038 */ cpu->r[6] = 0x101D0000u;
         /* 026BF03C */ _t57 = cpu->r[6] + 0xFFFFFCF8u;
         /* 026BF03C */ cpu->r[6] = rbrew_read32(cpu->mem, _t57);
-        /* 026BF040 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 026BF044 */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF040 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 026BF044 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF044 */ _t59 = _t58 & 0x00000001u;
         /* 026BF044 */ if (_t59) goto L_026BF048; else goto L_026BF05C;
   L_026BF048: ; // 0x26bf048
@@ -18817,8 +18817,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF058 */ _t61 = cpu->r[12] + 0xFFFFFEE4u;
         /* 026BF058 */ rbrew_write32(cpu->mem, _t61, cpu->r[28]);
   L_026BF05C: ; // 0x26bf05c
-        /* 026BF05C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BF060 */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF05C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BF060 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF060 */ _t63 = _t62 & 0x00000001u;
         /* 026BF060 */ if (_t63) goto L_026BF09C; else goto L_026BF064;
   L_026BF064: ; // 0x26bf064
@@ -18831,8 +18831,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF074 */ cpu->r[4] = cpu->r[4] + 0xFFFFFEE4u;
         /* 026BF078 */ cpu->r[3] = cpu->r[31];
         /* 026BF07C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BF080 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BF084 */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF080 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BF084 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF084 */ _t67 = _t66 & 0x00000001u;
         /* 026BF084 */ if (_t67) goto L_026BF09C; else goto L_026BF088;
   L_026BF088: ; // 0x26bf088
@@ -18848,8 +18848,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF09C */ cpu->r[12] = 0x101D0000u;
         /* 026BF0A0 */ _t71 = cpu->r[12] + 0xFFFFFCFCu;
         /* 026BF0A0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t71);
-        /* 026BF0A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 026BF0A8 */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF0A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 026BF0A8 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF0A8 */ _t73 = _t72 & 0x00000001u;
         /* 026BF0A8 */ if (_t73) goto L_026BF0AC; else goto L_026BF0C0;
   L_026BF0AC: ; // 0x26bf0ac
@@ -18861,8 +18861,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF0BC */ _t75 = cpu->r[6] + 0xFFFFFEE8u;
         /* 026BF0BC */ rbrew_write32(cpu->mem, _t75, cpu->r[28]);
   L_026BF0C0: ; // 0x26bf0c0
-        /* 026BF0C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BF0C4 */ _t76 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF0C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BF0C4 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF0C4 */ _t77 = _t76 & 0x00000001u;
         /* 026BF0C4 */ if (_t77) goto L_026BF100; else goto L_026BF0C8;
   L_026BF0C8: ; // 0x26bf0c8
@@ -18875,8 +18875,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF0D8 */ cpu->r[4] = cpu->r[4] + 0xFFFFFEE8u;
         /* 026BF0DC */ cpu->r[3] = cpu->r[31];
         /* 026BF0E0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BF0E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BF0E8 */ _t80 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF0E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BF0E8 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF0E8 */ _t81 = _t80 & 0x00000001u;
         /* 026BF0E8 */ if (_t81) goto L_026BF100; else goto L_026BF0EC;
   L_026BF0EC: ; // 0x26bf0ec
@@ -18892,8 +18892,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF100 */ cpu->r[11] = 0x101D0000u;
         /* 026BF104 */ _t85 = cpu->r[11] + 0xFFFFFD00u;
         /* 026BF104 */ cpu->r[11] = rbrew_read32(cpu->mem, _t85);
-        /* 026BF108 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 026BF10C */ _t86 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF108 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 026BF10C */ _t86 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF10C */ _t87 = _t86 & 0x00000001u;
         /* 026BF10C */ if (_t87) goto L_026BF110; else goto L_026BF124;
   L_026BF110: ; // 0x26bf110
@@ -18905,8 +18905,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF120 */ _t89 = cpu->r[7] + 0xFFFFFEECu;
         /* 026BF120 */ rbrew_write32(cpu->mem, _t89, cpu->r[28]);
   L_026BF124: ; // 0x26bf124
-        /* 026BF124 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BF128 */ _t90 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF124 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BF128 */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF128 */ _t91 = _t90 & 0x00000001u;
         /* 026BF128 */ if (_t91) goto L_026BF164; else goto L_026BF12C;
   L_026BF12C: ; // 0x26bf12c
@@ -18919,8 +18919,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF13C */ cpu->r[4] = cpu->r[4] + 0xFFFFFEECu;
         /* 026BF140 */ cpu->r[3] = cpu->r[31];
         /* 026BF144 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BF148 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BF14C */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF148 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BF14C */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF14C */ _t95 = _t94 & 0x00000001u;
         /* 026BF14C */ if (_t95) goto L_026BF164; else goto L_026BF150;
   L_026BF150: ; // 0x26bf150
@@ -18936,8 +18936,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF164 */ cpu->r[10] = 0x101D0000u;
         /* 026BF168 */ _t99 = cpu->r[10] + 0xFFFFFD04u;
         /* 026BF168 */ cpu->r[10] = rbrew_read32(cpu->mem, _t99);
-        /* 026BF16C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 026BF170 */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF16C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 026BF170 */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF170 */ _t101 = _t100 & 0x00000001u;
         /* 026BF170 */ if (_t101) goto L_026BF174; else goto L_026BF188;
   L_026BF174: ; // 0x26bf174
@@ -18949,8 +18949,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF184 */ _t103 = cpu->r[8] + 0xFFFFFEF0u;
         /* 026BF184 */ rbrew_write32(cpu->mem, _t103, cpu->r[28]);
   L_026BF188: ; // 0x26bf188
-        /* 026BF188 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BF18C */ _t104 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF188 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BF18C */ _t104 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF18C */ _t105 = _t104 & 0x00000001u;
         /* 026BF18C */ if (_t105) goto L_026BF1C8; else goto L_026BF190;
   L_026BF190: ; // 0x26bf190
@@ -18963,8 +18963,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF1A0 */ cpu->r[4] = cpu->r[4] + 0xFFFFFEF0u;
         /* 026BF1A4 */ cpu->r[3] = cpu->r[31];
         /* 026BF1A8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BF1AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BF1B0 */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF1AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BF1B0 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF1B0 */ _t109 = _t108 & 0x00000001u;
         /* 026BF1B0 */ if (_t109) goto L_026BF1C8; else goto L_026BF1B4;
   L_026BF1B4: ; // 0x26bf1b4
@@ -18980,8 +18980,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF1C8 */ cpu->r[9] = 0x101D0000u;
         /* 026BF1CC */ _t113 = cpu->r[9] + 0xFFFFFD08u;
         /* 026BF1CC */ cpu->r[9] = rbrew_read32(cpu->mem, _t113);
-        /* 026BF1D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 026BF1D4 */ _t114 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF1D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 026BF1D4 */ _t114 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF1D4 */ _t115 = _t114 & 0x00000001u;
         /* 026BF1D4 */ if (_t115) goto L_026BF1D8; else goto L_026BF1EC;
   L_026BF1D8: ; // 0x26bf1d8
@@ -18993,8 +18993,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF1E8 */ _t117 = cpu->r[9] + 0xFFFFFEF4u;
         /* 026BF1E8 */ rbrew_write32(cpu->mem, _t117, cpu->r[28]);
   L_026BF1EC: ; // 0x26bf1ec
-        /* 026BF1EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BF1F0 */ _t118 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF1EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BF1F0 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF1F0 */ _t119 = _t118 & 0x00000001u;
         /* 026BF1F0 */ if (_t119) goto L_026BF22C; else goto L_026BF1F4;
   L_026BF1F4: ; // 0x26bf1f4
@@ -19007,8 +19007,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF204 */ cpu->r[4] = cpu->r[4] + 0xFFFFFEF4u;
         /* 026BF208 */ cpu->r[3] = cpu->r[31];
         /* 026BF20C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BF210 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BF214 */ _t122 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF210 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BF214 */ _t122 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF214 */ _t123 = _t122 & 0x00000001u;
         /* 026BF214 */ if (_t123) goto L_026BF22C; else goto L_026BF218;
   L_026BF218: ; // 0x26bf218
@@ -19024,8 +19024,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF22C */ cpu->r[8] = 0x101D0000u;
         /* 026BF230 */ _t127 = cpu->r[8] + 0xFFFFFD0Cu;
         /* 026BF230 */ cpu->r[8] = rbrew_read32(cpu->mem, _t127);
-        /* 026BF234 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 026BF238 */ _t128 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF234 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 026BF238 */ _t128 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF238 */ _t129 = _t128 & 0x00000001u;
         /* 026BF238 */ if (_t129) goto L_026BF23C; else goto L_026BF250;
   L_026BF23C: ; // 0x26bf23c
@@ -19037,8 +19037,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF24C */ _t131 = cpu->r[10] + 0xFFFFFEF8u;
         /* 026BF24C */ rbrew_write32(cpu->mem, _t131, cpu->r[28]);
   L_026BF250: ; // 0x26bf250
-        /* 026BF250 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BF254 */ _t132 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF250 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BF254 */ _t132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF254 */ _t133 = _t132 & 0x00000001u;
         /* 026BF254 */ if (_t133) goto L_026BF290; else goto L_026BF258;
   L_026BF258: ; // 0x26bf258
@@ -19051,8 +19051,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF268 */ cpu->r[4] = cpu->r[4] + 0xFFFFFEF8u;
         /* 026BF26C */ cpu->r[3] = cpu->r[31];
         /* 026BF270 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BF274 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BF278 */ _t136 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF274 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BF278 */ _t136 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF278 */ _t137 = _t136 & 0x00000001u;
         /* 026BF278 */ if (_t137) goto L_026BF290; else goto L_026BF27C;
   L_026BF27C: ; // 0x26bf27c
@@ -19068,8 +19068,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF290 */ cpu->r[7] = 0x101D0000u;
         /* 026BF294 */ _t141 = cpu->r[7] + 0xFFFFFD10u;
         /* 026BF294 */ cpu->r[7] = rbrew_read32(cpu->mem, _t141);
-        /* 026BF298 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 026BF29C */ _t142 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF298 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 026BF29C */ _t142 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF29C */ _t143 = _t142 & 0x00000001u;
         /* 026BF29C */ if (_t143) goto L_026BF2A0; else goto L_026BF2B4;
   L_026BF2A0: ; // 0x26bf2a0
@@ -19081,8 +19081,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF2B0 */ _t145 = cpu->r[11] + 0xFFFFFEFCu;
         /* 026BF2B0 */ rbrew_write32(cpu->mem, _t145, cpu->r[28]);
   L_026BF2B4: ; // 0x26bf2b4
-        /* 026BF2B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BF2B8 */ _t146 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF2B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BF2B8 */ _t146 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF2B8 */ _t147 = _t146 & 0x00000001u;
         /* 026BF2B8 */ if (_t147) goto L_026BF2F4; else goto L_026BF2BC;
   L_026BF2BC: ; // 0x26bf2bc
@@ -19095,8 +19095,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF2CC */ cpu->r[4] = cpu->r[4] + 0xFFFFFEFCu;
         /* 026BF2D0 */ cpu->r[3] = cpu->r[31];
         /* 026BF2D4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BF2D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BF2DC */ _t150 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF2D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BF2DC */ _t150 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF2DC */ _t151 = _t150 & 0x00000001u;
         /* 026BF2DC */ if (_t151) goto L_026BF2F4; else goto L_026BF2E0;
   L_026BF2E0: ; // 0x26bf2e0
@@ -19112,8 +19112,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF2F4 */ cpu->r[6] = 0x101D0000u;
         /* 026BF2F8 */ _t155 = cpu->r[6] + 0xFFFFFD24u;
         /* 026BF2F8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t155);
-        /* 026BF2FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 026BF300 */ _t156 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF2FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 026BF300 */ _t156 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF300 */ _t157 = _t156 & 0x00000001u;
         /* 026BF300 */ if (_t157) goto L_026BF304; else goto L_026BF318;
   L_026BF304: ; // 0x26bf304
@@ -19125,8 +19125,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF314 */ _t159 = cpu->r[12] + 0xFFFFFF10u;
         /* 026BF314 */ rbrew_write32(cpu->mem, _t159, cpu->r[28]);
   L_026BF318: ; // 0x26bf318
-        /* 026BF318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BF31C */ _t160 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BF31C */ _t160 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF31C */ _t161 = _t160 & 0x00000001u;
         /* 026BF31C */ if (_t161) goto L_026BF358; else goto L_026BF320;
   L_026BF320: ; // 0x26bf320
@@ -19139,8 +19139,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF330 */ cpu->r[4] = cpu->r[4] + 0xFFFFFF10u;
         /* 026BF334 */ cpu->r[3] = cpu->r[31];
         /* 026BF338 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BF33C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BF340 */ _t164 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF33C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BF340 */ _t164 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF340 */ _t165 = _t164 & 0x00000001u;
         /* 026BF340 */ if (_t165) goto L_026BF358; else goto L_026BF344;
   L_026BF344: ; // 0x26bf344
@@ -19156,8 +19156,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF358 */ cpu->r[12] = 0x101D0000u;
         /* 026BF35C */ _t169 = cpu->r[12] + 0xFFFFFD28u;
         /* 026BF35C */ cpu->r[12] = rbrew_read32(cpu->mem, _t169);
-        /* 026BF360 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 026BF364 */ _t170 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF360 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 026BF364 */ _t170 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF364 */ _t171 = _t170 & 0x00000001u;
         /* 026BF364 */ if (_t171) goto L_026BF368; else goto L_026BF37C;
   L_026BF368: ; // 0x26bf368
@@ -19169,8 +19169,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF378 */ _t173 = cpu->r[6] + 0xFFFFFF14u;
         /* 026BF378 */ rbrew_write32(cpu->mem, _t173, cpu->r[28]);
   L_026BF37C: ; // 0x26bf37c
-        /* 026BF37C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BF380 */ _t174 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF37C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BF380 */ _t174 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF380 */ _t175 = _t174 & 0x00000001u;
         /* 026BF380 */ if (_t175) goto L_026BF3BC; else goto L_026BF384;
   L_026BF384: ; // 0x26bf384
@@ -19183,8 +19183,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF394 */ cpu->r[4] = cpu->r[4] + 0xFFFFFF14u;
         /* 026BF398 */ cpu->r[3] = cpu->r[31];
         /* 026BF39C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BF3A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BF3A4 */ _t178 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF3A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BF3A4 */ _t178 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF3A4 */ _t179 = _t178 & 0x00000001u;
         /* 026BF3A4 */ if (_t179) goto L_026BF3BC; else goto L_026BF3A8;
   L_026BF3A8: ; // 0x26bf3a8
@@ -19201,9 +19201,9 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF3C0 */ _t183 = cpu->r[10] + 0xFFFFFD2Cu;
         /* 026BF3C0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t183);
         /* 026BF3C4 */ cpu->r[27] = 0x100F0000u;
-        /* 026BF3C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 026BF3C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 026BF3CC */ cpu->r[27] = cpu->r[27] + 0xFFFF8938u;
-        /* 026BF3D0 */ _t184 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF3D0 */ _t184 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF3D0 */ _t185 = _t184 & 0x00000001u;
         /* 026BF3D0 */ if (_t185) goto L_026BF3D4; else goto L_026BF3E8;
   L_026BF3D4: ; // 0x26bf3d4
@@ -19215,8 +19215,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF3E4 */ _t187 = cpu->r[7] + 0xFFFFFF18u;
         /* 026BF3E4 */ rbrew_write32(cpu->mem, _t187, cpu->r[27]);
   L_026BF3E8: ; // 0x26bf3e8
-        /* 026BF3E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BF3EC */ _t188 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF3E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BF3EC */ _t188 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF3EC */ _t189 = _t188 & 0x00000001u;
         /* 026BF3EC */ if (_t189) goto L_026BF428; else goto L_026BF3F0;
   L_026BF3F0: ; // 0x26bf3f0
@@ -19229,8 +19229,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF400 */ cpu->r[4] = cpu->r[4] + 0xFFFFFF18u;
         /* 026BF404 */ cpu->r[3] = cpu->r[31];
         /* 026BF408 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BF40C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BF410 */ _t192 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF40C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BF410 */ _t192 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF410 */ _t193 = _t192 & 0x00000001u;
         /* 026BF410 */ if (_t193) goto L_026BF428; else goto L_026BF414;
   L_026BF414: ; // 0x26bf414
@@ -19246,8 +19246,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF428 */ cpu->r[7] = 0x101D0000u;
         /* 026BF42C */ _t197 = cpu->r[7] + 0xFFFFFD30u;
         /* 026BF42C */ cpu->r[7] = rbrew_read32(cpu->mem, _t197);
-        /* 026BF430 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 026BF434 */ _t198 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF430 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 026BF434 */ _t198 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF434 */ _t199 = _t198 & 0x00000001u;
         /* 026BF434 */ if (_t199) goto L_026BF438; else goto L_026BF44C;
   L_026BF438: ; // 0x26bf438
@@ -19259,8 +19259,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF448 */ _t201 = cpu->r[8] + 0xFFFFFF1Cu;
         /* 026BF448 */ rbrew_write32(cpu->mem, _t201, cpu->r[27]);
   L_026BF44C: ; // 0x26bf44c
-        /* 026BF44C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BF450 */ _t202 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF44C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BF450 */ _t202 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF450 */ _t203 = _t202 & 0x00000001u;
         /* 026BF450 */ if (_t203) goto L_026BF48C; else goto L_026BF454;
   L_026BF454: ; // 0x26bf454
@@ -19273,8 +19273,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF464 */ cpu->r[4] = cpu->r[4] + 0xFFFFFF1Cu;
         /* 026BF468 */ cpu->r[3] = cpu->r[31];
         /* 026BF46C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BF470 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BF474 */ _t206 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF470 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BF474 */ _t206 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF474 */ _t207 = _t206 & 0x00000001u;
         /* 026BF474 */ if (_t207) goto L_026BF48C; else goto L_026BF478;
   L_026BF478: ; // 0x26bf478
@@ -19290,8 +19290,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF48C */ cpu->r[10] = 0x101D0000u;
         /* 026BF490 */ _t211 = cpu->r[10] + 0xFFFFFD34u;
         /* 026BF490 */ cpu->r[10] = rbrew_read32(cpu->mem, _t211);
-        /* 026BF494 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 026BF498 */ _t212 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF494 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 026BF498 */ _t212 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF498 */ _t213 = _t212 & 0x00000001u;
         /* 026BF498 */ if (_t213) goto L_026BF49C; else goto L_026BF4B0;
   L_026BF49C: ; // 0x26bf49c
@@ -19303,8 +19303,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF4AC */ _t215 = cpu->r[9] + 0xFFFFFF20u;
         /* 026BF4AC */ rbrew_write32(cpu->mem, _t215, cpu->r[27]);
   L_026BF4B0: ; // 0x26bf4b0
-        /* 026BF4B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BF4B4 */ _t216 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF4B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BF4B4 */ _t216 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF4B4 */ _t217 = _t216 & 0x00000001u;
         /* 026BF4B4 */ if (_t217) goto L_026BF4F0; else goto L_026BF4B8;
   L_026BF4B8: ; // 0x26bf4b8
@@ -19317,8 +19317,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF4C8 */ cpu->r[4] = cpu->r[4] + 0xFFFFFF20u;
         /* 026BF4CC */ cpu->r[3] = cpu->r[31];
         /* 026BF4D0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BF4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BF4D8 */ _t220 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BF4D8 */ _t220 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF4D8 */ _t221 = _t220 & 0x00000001u;
         /* 026BF4D8 */ if (_t221) goto L_026BF4F0; else goto L_026BF4DC;
   L_026BF4DC: ; // 0x26bf4dc
@@ -19334,8 +19334,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF4F0 */ cpu->r[11] = 0x101D0000u;
         /* 026BF4F4 */ _t225 = cpu->r[11] + 0xFFFFFD38u;
         /* 026BF4F4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t225);
-        /* 026BF4F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 026BF4FC */ _t226 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF4F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 026BF4FC */ _t226 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF4FC */ _t227 = _t226 & 0x00000001u;
         /* 026BF4FC */ if (_t227) goto L_026BF500; else goto L_026BF514;
   L_026BF500: ; // 0x26bf500
@@ -19347,8 +19347,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF510 */ _t229 = cpu->r[10] + 0xFFFFFF24u;
         /* 026BF510 */ rbrew_write32(cpu->mem, _t229, cpu->r[27]);
   L_026BF514: ; // 0x26bf514
-        /* 026BF514 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BF518 */ _t230 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF514 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BF518 */ _t230 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF518 */ _t231 = _t230 & 0x00000001u;
         /* 026BF518 */ if (_t231) goto L_026BF554; else goto L_026BF51C;
   L_026BF51C: ; // 0x26bf51c
@@ -19361,8 +19361,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF52C */ cpu->r[4] = cpu->r[4] + 0xFFFFFF24u;
         /* 026BF530 */ cpu->r[3] = cpu->r[31];
         /* 026BF534 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BF538 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BF53C */ _t234 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF538 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BF53C */ _t234 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF53C */ _t235 = _t234 & 0x00000001u;
         /* 026BF53C */ if (_t235) goto L_026BF554; else goto L_026BF540;
   L_026BF540: ; // 0x26bf540
@@ -19378,8 +19378,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF554 */ cpu->r[9] = 0x101D0000u;
         /* 026BF558 */ _t239 = cpu->r[9] + 0xFFFFFD3Cu;
         /* 026BF558 */ cpu->r[9] = rbrew_read32(cpu->mem, _t239);
-        /* 026BF55C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 026BF560 */ _t240 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF55C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 026BF560 */ _t240 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF560 */ _t241 = _t240 & 0x00000001u;
         /* 026BF560 */ if (_t241) goto L_026BF564; else goto L_026BF578;
   L_026BF564: ; // 0x26bf564
@@ -19391,8 +19391,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF574 */ _t243 = cpu->r[11] + 0xFFFFFF28u;
         /* 026BF574 */ rbrew_write32(cpu->mem, _t243, cpu->r[27]);
   L_026BF578: ; // 0x26bf578
-        /* 026BF578 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BF57C */ _t244 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF578 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BF57C */ _t244 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF57C */ _t245 = _t244 & 0x00000001u;
         /* 026BF57C */ if (_t245) goto L_026BF5B8; else goto L_026BF580;
   L_026BF580: ; // 0x26bf580
@@ -19405,8 +19405,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF590 */ cpu->r[4] = cpu->r[4] + 0xFFFFFF28u;
         /* 026BF594 */ cpu->r[3] = cpu->r[31];
         /* 026BF598 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BF59C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BF5A0 */ _t248 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF59C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BF5A0 */ _t248 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF5A0 */ _t249 = _t248 & 0x00000001u;
         /* 026BF5A0 */ if (_t249) goto L_026BF5B8; else goto L_026BF5A4;
   L_026BF5A4: ; // 0x26bf5a4
@@ -19422,8 +19422,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF5B8 */ cpu->r[8] = 0x101D0000u;
         /* 026BF5BC */ _t253 = cpu->r[8] + 0xFFFFFD14u;
         /* 026BF5BC */ cpu->r[8] = rbrew_read32(cpu->mem, _t253);
-        /* 026BF5C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 026BF5C4 */ _t254 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF5C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 026BF5C4 */ _t254 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF5C4 */ _t255 = _t254 & 0x00000001u;
         /* 026BF5C4 */ if (_t255) goto L_026BF5C8; else goto L_026BF5DC;
   L_026BF5C8: ; // 0x26bf5c8
@@ -19435,8 +19435,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF5D8 */ _t257 = cpu->r[12] + 0xFFFFFF00u;
         /* 026BF5D8 */ rbrew_write32(cpu->mem, _t257, cpu->r[28]);
   L_026BF5DC: ; // 0x26bf5dc
-        /* 026BF5DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BF5E0 */ _t258 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF5DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BF5E0 */ _t258 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF5E0 */ _t259 = _t258 & 0x00000001u;
         /* 026BF5E0 */ if (_t259) goto L_026BF61C; else goto L_026BF5E4;
   L_026BF5E4: ; // 0x26bf5e4
@@ -19449,8 +19449,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF5F4 */ cpu->r[4] = cpu->r[4] + 0xFFFFFF00u;
         /* 026BF5F8 */ cpu->r[3] = cpu->r[31];
         /* 026BF5FC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BF600 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BF604 */ _t262 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF600 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BF604 */ _t262 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF604 */ _t263 = _t262 & 0x00000001u;
         /* 026BF604 */ if (_t263) goto L_026BF61C; else goto L_026BF608;
   L_026BF608: ; // 0x26bf608
@@ -19466,8 +19466,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF61C */ cpu->r[6] = 0x101D0000u;
         /* 026BF620 */ _t267 = cpu->r[6] + 0xFFFFFD18u;
         /* 026BF620 */ cpu->r[6] = rbrew_read32(cpu->mem, _t267);
-        /* 026BF624 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 026BF628 */ _t268 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF624 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 026BF628 */ _t268 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF628 */ _t269 = _t268 & 0x00000001u;
         /* 026BF628 */ if (_t269) goto L_026BF62C; else goto L_026BF640;
   L_026BF62C: ; // 0x26bf62c
@@ -19479,8 +19479,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF63C */ _t271 = cpu->r[6] + 0xFFFFFF04u;
         /* 026BF63C */ rbrew_write32(cpu->mem, _t271, cpu->r[28]);
   L_026BF640: ; // 0x26bf640
-        /* 026BF640 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BF644 */ _t272 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF640 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BF644 */ _t272 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF644 */ _t273 = _t272 & 0x00000001u;
         /* 026BF644 */ if (_t273) goto L_026BF680; else goto L_026BF648;
   L_026BF648: ; // 0x26bf648
@@ -19493,8 +19493,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF658 */ cpu->r[4] = cpu->r[4] + 0xFFFFFF04u;
         /* 026BF65C */ cpu->r[3] = cpu->r[31];
         /* 026BF660 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BF664 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BF668 */ _t276 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF664 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BF668 */ _t276 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF668 */ _t277 = _t276 & 0x00000001u;
         /* 026BF668 */ if (_t277) goto L_026BF680; else goto L_026BF66C;
   L_026BF66C: ; // 0x26bf66c
@@ -19510,8 +19510,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF680 */ cpu->r[12] = 0x101D0000u;
         /* 026BF684 */ _t281 = cpu->r[12] + 0xFFFFFD1Cu;
         /* 026BF684 */ cpu->r[12] = rbrew_read32(cpu->mem, _t281);
-        /* 026BF688 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 026BF68C */ _t282 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF688 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 026BF68C */ _t282 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF68C */ _t283 = _t282 & 0x00000001u;
         /* 026BF68C */ if (_t283) goto L_026BF690; else goto L_026BF6A4;
   L_026BF690: ; // 0x26bf690
@@ -19523,8 +19523,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF6A0 */ _t285 = cpu->r[7] + 0xFFFFFF08u;
         /* 026BF6A0 */ rbrew_write32(cpu->mem, _t285, cpu->r[28]);
   L_026BF6A4: ; // 0x26bf6a4
-        /* 026BF6A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BF6A8 */ _t286 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF6A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BF6A8 */ _t286 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF6A8 */ _t287 = _t286 & 0x00000001u;
         /* 026BF6A8 */ if (_t287) goto L_026BF6E4; else goto L_026BF6AC;
   L_026BF6AC: ; // 0x26bf6ac
@@ -19537,8 +19537,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF6BC */ cpu->r[4] = cpu->r[4] + 0xFFFFFF08u;
         /* 026BF6C0 */ cpu->r[3] = cpu->r[31];
         /* 026BF6C4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BF6C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BF6CC */ _t290 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF6C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BF6CC */ _t290 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF6CC */ _t291 = _t290 & 0x00000001u;
         /* 026BF6CC */ if (_t291) goto L_026BF6E4; else goto L_026BF6D0;
   L_026BF6D0: ; // 0x26bf6d0
@@ -19554,8 +19554,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF6E4 */ cpu->r[11] = 0x101D0000u;
         /* 026BF6E8 */ _t295 = cpu->r[11] + 0xFFFFFD20u;
         /* 026BF6E8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t295);
-        /* 026BF6EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 026BF6F0 */ _t296 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF6EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 026BF6F0 */ _t296 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF6F0 */ _t297 = _t296 & 0x00000001u;
         /* 026BF6F0 */ if (_t297) goto L_026BF6F4; else goto L_026BF708;
   L_026BF6F4: ; // 0x26bf6f4
@@ -19567,8 +19567,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF704 */ _t299 = cpu->r[8] + 0xFFFFFF0Cu;
         /* 026BF704 */ rbrew_write32(cpu->mem, _t299, cpu->r[28]);
   L_026BF708: ; // 0x26bf708
-        /* 026BF708 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BF70C */ _t300 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF708 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BF70C */ _t300 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF70C */ _t301 = _t300 & 0x00000001u;
         /* 026BF70C */ if (_t301) goto L_026BF748; else goto L_026BF710;
   L_026BF710: ; // 0x26bf710
@@ -19581,8 +19581,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF720 */ cpu->r[4] = cpu->r[4] + 0xFFFFFF0Cu;
         /* 026BF724 */ cpu->r[3] = cpu->r[31];
         /* 026BF728 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BF72C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BF730 */ _t304 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF72C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BF730 */ _t304 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF730 */ _t305 = _t304 & 0x00000001u;
         /* 026BF730 */ if (_t305) goto L_026BF748; else goto L_026BF734;
   L_026BF734: ; // 0x26bf734
@@ -19598,8 +19598,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF748 */ cpu->r[9] = 0x101D0000u;
         /* 026BF74C */ _t309 = cpu->r[9] + 0xFFFFFD40u;
         /* 026BF74C */ cpu->r[9] = rbrew_read32(cpu->mem, _t309);
-        /* 026BF750 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 026BF754 */ _t310 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF750 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 026BF754 */ _t310 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF754 */ _t311 = _t310 & 0x00000001u;
         /* 026BF754 */ if (_t311) goto L_026BF758; else goto L_026BF76C;
   L_026BF758: ; // 0x26bf758
@@ -19611,8 +19611,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF768 */ _t313 = cpu->r[9] + 0xFFFFFF2Cu;
         /* 026BF768 */ rbrew_write32(cpu->mem, _t313, cpu->r[28]);
   L_026BF76C: ; // 0x26bf76c
-        /* 026BF76C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BF770 */ _t314 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF76C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BF770 */ _t314 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF770 */ _t315 = _t314 & 0x00000001u;
         /* 026BF770 */ if (_t315) goto L_026BF7AC; else goto L_026BF774;
   L_026BF774: ; // 0x26bf774
@@ -19625,8 +19625,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF784 */ cpu->r[4] = cpu->r[4] + 0xFFFFFF2Cu;
         /* 026BF788 */ cpu->r[3] = cpu->r[31];
         /* 026BF78C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BF790 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BF794 */ _t318 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF790 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BF794 */ _t318 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF794 */ _t319 = _t318 & 0x00000001u;
         /* 026BF794 */ if (_t319) goto L_026BF7AC; else goto L_026BF798;
   L_026BF798: ; // 0x26bf798
@@ -19642,8 +19642,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF7AC */ cpu->r[11] = 0x101D0000u;
         /* 026BF7B0 */ _t323 = cpu->r[11] + 0xFFFFFD44u;
         /* 026BF7B0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t323);
-        /* 026BF7B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 026BF7B8 */ _t324 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF7B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 026BF7B8 */ _t324 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF7B8 */ _t325 = _t324 & 0x00000001u;
         /* 026BF7B8 */ if (_t325) goto L_026BF7BC; else goto L_026BF7D0;
   L_026BF7BC: ; // 0x26bf7bc
@@ -19655,8 +19655,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF7CC */ _t327 = cpu->r[10] + 0xFFFFFF30u;
         /* 026BF7CC */ rbrew_write32(cpu->mem, _t327, cpu->r[28]);
   L_026BF7D0: ; // 0x26bf7d0
-        /* 026BF7D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BF7D4 */ _t328 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF7D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BF7D4 */ _t328 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF7D4 */ _t329 = _t328 & 0x00000001u;
         /* 026BF7D4 */ if (_t329) goto L_026BF810; else goto L_026BF7D8;
   L_026BF7D8: ; // 0x26bf7d8
@@ -19669,8 +19669,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF7E8 */ cpu->r[4] = cpu->r[4] + 0xFFFFFF30u;
         /* 026BF7EC */ cpu->r[3] = cpu->r[31];
         /* 026BF7F0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BF7F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BF7F8 */ _t332 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF7F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BF7F8 */ _t332 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF7F8 */ _t333 = _t332 & 0x00000001u;
         /* 026BF7F8 */ if (_t333) goto L_026BF810; else goto L_026BF7FC;
   L_026BF7FC: ; // 0x26bf7fc
@@ -19686,8 +19686,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF810 */ cpu->r[12] = 0x101D0000u;
         /* 026BF814 */ _t337 = cpu->r[12] + 0xFFFFFD48u;
         /* 026BF814 */ cpu->r[12] = rbrew_read32(cpu->mem, _t337);
-        /* 026BF818 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 026BF81C */ _t338 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF818 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 026BF81C */ _t338 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF81C */ _t339 = _t338 & 0x00000001u;
         /* 026BF81C */ if (_t339) goto L_026BF820; else goto L_026BF834;
   L_026BF820: ; // 0x26bf820
@@ -19699,8 +19699,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF830 */ _t341 = cpu->r[11] + 0xFFFFFF34u;
         /* 026BF830 */ rbrew_write32(cpu->mem, _t341, cpu->r[28]);
   L_026BF834: ; // 0x26bf834
-        /* 026BF834 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BF838 */ _t342 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF834 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BF838 */ _t342 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF838 */ _t343 = _t342 & 0x00000001u;
         /* 026BF838 */ if (_t343) goto L_026BF874; else goto L_026BF83C;
   L_026BF83C: ; // 0x26bf83c
@@ -19713,8 +19713,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF84C */ cpu->r[4] = cpu->r[4] + 0xFFFFFF34u;
         /* 026BF850 */ cpu->r[3] = cpu->r[31];
         /* 026BF854 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BF858 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BF85C */ _t346 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF858 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BF85C */ _t346 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF85C */ _t347 = _t346 & 0x00000001u;
         /* 026BF85C */ if (_t347) goto L_026BF874; else goto L_026BF860;
   L_026BF860: ; // 0x26bf860
@@ -19732,9 +19732,9 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF878 */ cpu->r[10] = rbrew_read32(cpu->mem, _t351);
         /* 026BF878 */ cpu->r[12] = _t351;
         /* 026BF87C */ cpu->r[4] = 0x101D0000u;
-        /* 026BF880 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 026BF880 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 026BF884 */ cpu->r[4] = cpu->r[4] + 0xFFFFFF38u;
-        /* 026BF888 */ _t352 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF888 */ _t352 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF888 */ _t353 = _t352 & 0x00000001u;
         /* 026BF888 */ if (_t353) goto L_026BF88C; else goto L_026BF898;
   L_026BF88C: ; // 0x26bf88c
@@ -19744,8 +19744,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF894 */ _t355 = cpu->r[12] + 0x00000000u;
         /* 026BF894 */ rbrew_write32(cpu->mem, _t355, cpu->r[11]);
   L_026BF898: ; // 0x26bf898
-        /* 026BF898 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 026BF89C */ _t356 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF898 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 026BF89C */ _t356 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF89C */ _t357 = _t356 & 0x00000001u;
         /* 026BF89C */ if (_t357) goto L_026BF8CC; else goto L_026BF8A0;
   L_026BF8A0: ; // 0x26bf8a0
@@ -19756,8 +19756,8 @@ void Gambit_fn_022157C4(CPUState* cpu) {
         /* 026BF8A8 */ cpu->ctr = cpu->r[0];
         /* 026BF8AC */ cpu->r[3] = cpu->r[31];
         /* 026BF8B0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 026BF8B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 026BF8B8 */ _t360 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 026BF8B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 026BF8B8 */ _t360 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 026BF8B8 */ _t361 = _t360 & 0x00000001u;
         /* 026BF8B8 */ if (_t361) goto L_026BF8CC; else goto L_026BF8BC;
   L_026BF8BC: ; // 0x26bf8bc
@@ -19837,21 +19837,21 @@ void Gambit_fn_022157D8(CPUState* cpu) {
         /* 0221584C */ _t18 = cpu->r[7] + 0xFFFFB140u;
         /* 0221584C */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t18);
         /* 02215850 */ cpu->r[6] = 0x10050000u;
-        /* 02215854 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[29]);
+        /* 02215854 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[29]));
         /* 02215858 */ _t19 = cpu->r[6] + 0xFFFFB240u;
         /* 02215858 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t19);
         /* 0221585C */ cpu->r[31] = cpu->r[4];
-        /* 02215860 */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02215860 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02215860 */ _t21 = _t20 & 0x00000001u;
         /* 02215860 */ if (_t21) goto L_0221587C; else goto L_02215864;
   L_02215864: ; // 0x2215864
         /* 02215864 */ cpu->f[26] = cpu->f[29] * cpu->f[11];
         /* 02215868 */ _t22 = cpu->r[1] + 0x0000000Cu;
         /* 02215868 */ rbrew_write_f32(cpu->mem, _t22, cpu->f[27]);
-        /* 0221586C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[26], cpu->f[29]);
+        /* 0221586C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[26], cpu->f[29]));
         /* 02215870 */ _t23 = cpu->r[1] + 0x00000008u;
         /* 02215870 */ rbrew_write_f32(cpu->mem, _t23, cpu->f[28]);
-        /* 02215874 */ _t24 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02215874 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02215874 */ _t25 = _t24 & 0x00000001u;
         /* 02215874 */ if (_t25) goto L_02215878; else goto L_02215988;
   L_02215878: ; // 0x2215878
@@ -19869,12 +19869,12 @@ void Gambit_fn_022157D8(CPUState* cpu) {
         /* 02215894 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t28);
         /* 02215898 */ _t29 = cpu->r[5] + 0x00000008u;
         /* 02215898 */ cpu->f[27] = rbrew_read_f32(cpu->mem, _t29);
-        /* 0221589C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[26], cpu->f[29]);
+        /* 0221589C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[26], cpu->f[29]));
         /* 022158A0 */ _t30 = cpu->r[1] + 0x00000008u;
         /* 022158A0 */ rbrew_write_f32(cpu->mem, _t30, cpu->f[28]);
         /* 022158A4 */ _t31 = cpu->r[1] + 0x0000000Cu;
         /* 022158A4 */ rbrew_write_f32(cpu->mem, _t31, cpu->f[27]);
-        /* 022158A8 */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022158A8 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022158A8 */ _t33 = _t32 & 0x00000001u;
         /* 022158A8 */ if (_t33) goto L_022158AC; else goto L_02215988;
   L_022158AC: ; // 0x22158ac
@@ -19894,8 +19894,8 @@ void Gambit_fn_022157D8(CPUState* cpu) {
         /* 022158D4 */ _t37 = cpu->r[12] + 0xFFFFB360u;
         /* 022158D4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t37);
         /* 022158D8 */ cpu->f[0] = cpu->f[9] / cpu->f[10];
-        /* 022158DC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[29]);
-        /* 022158E0 */ _t38 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022158DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[29]));
+        /* 022158E0 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022158E0 */ _t39 = _t38 & 0x00000001u;
         /* 022158E0 */ if (_t39) goto L_02215900; else goto L_022158E4;
   L_022158E4: ; // 0x22158e4
@@ -19904,8 +19904,8 @@ void Gambit_fn_022157D8(CPUState* cpu) {
         /* 022158E8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t40);
         /* 022158EC */ cpu->f[0] = cpu->f[30];
         /* 022158F0 */ cpu->f[13] = cpu->f[26] / cpu->f[13];
-        /* 022158F4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 022158F8 */ _t41 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022158F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 022158F8 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022158F8 */ _t42 = _t41 & 0x00000001u;
         /* 022158F8 */ if (_t42) goto L_02215950; else goto L_022158FC;
   L_022158FC: ; // 0x22158fc
@@ -19914,8 +19914,8 @@ void Gambit_fn_022157D8(CPUState* cpu) {
         /* 02215900 */ cpu->r[10] = 0x10050000u;
         /* 02215904 */ _t43 = cpu->r[10] + 0xFFFFB234u;
         /* 02215904 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t43);
-        /* 02215908 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[11]);
-        /* 0221590C */ _t44 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02215908 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[11]));
+        /* 0221590C */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221590C */ _t45 = _t44 & 0x00000001u;
         /* 0221590C */ if (_t45) goto L_02215930; else goto L_02215910;
   L_02215910: ; // 0x2215910
@@ -19926,8 +19926,8 @@ void Gambit_fn_022157D8(CPUState* cpu) {
         /* 0221591C */ cpu->f[13] = cpu->f[26] / cpu->f[13];
         /* 02215920 */ _t47 = cpu->r[12] + 0xFFFFB364u;
         /* 02215920 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t47);
-        /* 02215924 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 02215928 */ _t48 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02215924 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 02215928 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02215928 */ _t49 = _t48 & 0x00000001u;
         /* 02215928 */ if (_t49) goto L_02215950; else goto L_0221592C;
   L_0221592C: ; // 0x221592c
@@ -19941,8 +19941,8 @@ void Gambit_fn_022157D8(CPUState* cpu) {
         /* 0221593C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t51);
         /* 02215940 */ cpu->f[0] = fma(cpu->f[12], cpu->f[0], cpu->f[30]);
         /* 02215944 */ cpu->f[13] = cpu->f[26] / cpu->f[13];
-        /* 02215948 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 0221594C */ _t52 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02215948 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 0221594C */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221594C */ _t53 = _t52 & 0x00000001u;
         /* 0221594C */ if (_t53) goto L_02215950; else goto L_02215954;
   L_02215950: ; // 0x2215950
@@ -19950,8 +19950,8 @@ void Gambit_fn_022157D8(CPUState* cpu) {
   L_02215954: ; // 0x2215954
         /* 02215954 */ cpu->f[10] = cpu->f[27] * cpu->f[27];
         /* 02215958 */ cpu->f[8] = fma(cpu->f[28], cpu->f[28], cpu->f[10]);
-        /* 0221595C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[29]);
-        /* 02215960 */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221595C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[29]));
+        /* 02215960 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02215960 */ _t55 = _t54 & 0x00000001u;
         /* 02215960 */ if (_t55) goto L_02215964; else goto L_02215988;
   L_02215964: ; // 0x2215964
@@ -20001,7 +20001,7 @@ void Gambit_fn_022157D8(CPUState* cpu) {
         /* 022159C4 */ cpu->f[26] = rbrew_read_f64(cpu->mem, _t73);
         /* 022159C8 */ _t74 = cpu->r[1] + 0x00000068u;
         /* 022159C8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t74);
-        /* 022159CC */ _t75 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022159CC */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022159CC */ _t76 = _t75 & 0x00000001u;
         /* 022159CC */ if (_t76) goto L_022159D0; // else: addr-0 trap, fall-through
   L_022159D0: ; // 0x22159d0
@@ -20030,8 +20030,8 @@ void Gambit_fn_022159E0(CPUState* cpu) {
         /* 022159F4 */ _t3 = cpu->r[31] + 0x00000184u;
         /* 022159F4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 022159F8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000019u, 0x00000019u);
-        /* 022159F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022159FC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022159F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022159FC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022159FC */ _t5 = _t4 & 0x00000001u;
         /* 022159FC */ if (_t5) goto L_02215B3C; else goto L_02215A00;
   L_02215A00: ; // 0x2215a00
@@ -20074,8 +20074,8 @@ void Gambit_fn_022159E0(CPUState* cpu) {
         /* 02215A58 */ cpu->f[8] = fma(cpu->f[11], cpu->f[11], cpu->f[0]);
         /* 02215A5C */ _t20 = cpu->r[11] + 0xFFFFB140u;
         /* 02215A5C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t20);
-        /* 02215A60 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[13]);
-        /* 02215A64 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02215A60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[13]));
+        /* 02215A64 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02215A64 */ _t22 = _t21 & 0x00000001u;
         /* 02215A64 */ if (_t22) goto L_02215A68; else goto L_02215AA4;
   L_02215A68: ; // 0x2215a68
@@ -20106,8 +20106,8 @@ void Gambit_fn_022159E0(CPUState* cpu) {
         /* 02215AAC */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 02215AB0 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 02215AB4 */ Gambit_fn_021C6DD8(cpu);
-        /* 02215AB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02215ABC */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02215AB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02215ABC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02215ABC */ _t30 = _t29 & 0x00000001u;
         /* 02215ABC */ if (_t30) goto L_02215AC0; else goto L_02215AD4;
   L_02215AC0: ; // 0x2215ac0
@@ -20184,8 +20184,8 @@ void Gambit_fn_022159E4(CPUState* cpu) {
         /* 022159F4 */ _t3 = cpu->r[31] + 0x00000184u;
         /* 022159F4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 022159F8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000019u, 0x00000019u);
-        /* 022159F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022159FC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022159F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022159FC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022159FC */ _t5 = _t4 & 0x00000001u;
         /* 022159FC */ if (_t5) goto L_02215B3C; else goto L_02215A00;
   L_02215A00: ; // 0x2215a00
@@ -20228,8 +20228,8 @@ void Gambit_fn_022159E4(CPUState* cpu) {
         /* 02215A58 */ cpu->f[8] = fma(cpu->f[11], cpu->f[11], cpu->f[0]);
         /* 02215A5C */ _t20 = cpu->r[11] + 0xFFFFB140u;
         /* 02215A5C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t20);
-        /* 02215A60 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[13]);
-        /* 02215A64 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02215A60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[13]));
+        /* 02215A64 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02215A64 */ _t22 = _t21 & 0x00000001u;
         /* 02215A64 */ if (_t22) goto L_02215A68; else goto L_02215AA4;
   L_02215A68: ; // 0x2215a68
@@ -20260,8 +20260,8 @@ void Gambit_fn_022159E4(CPUState* cpu) {
         /* 02215AAC */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 02215AB0 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 02215AB4 */ Gambit_fn_021C6DD8(cpu);
-        /* 02215AB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02215ABC */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02215AB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02215ABC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02215ABC */ _t30 = _t29 & 0x00000001u;
         /* 02215ABC */ if (_t30) goto L_02215AC0; else goto L_02215AD4;
   L_02215AC0: ; // 0x2215ac0
@@ -20338,8 +20338,8 @@ void Gambit_fn_02215B50(CPUState* cpu) {
         /* 02215B64 */ _t3 = cpu->r[31] + 0x00000184u;
         /* 02215B64 */ cpu->r[10] = rbrew_read32(cpu->mem, _t3);
         /* 02215B68 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Au, 0x0000001Cu);
-        /* 02215B68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02215B6C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02215B68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02215B6C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02215B6C */ _t5 = _t4 & 0x00000001u;
         /* 02215B6C */ if (_t5) goto L_02215B70; else goto L_02215C74;
   L_02215B70: ; // 0x2215b70
@@ -20481,8 +20481,8 @@ void Gambit_fn_02215B54(CPUState* cpu) {
         /* 02215B64 */ _t3 = cpu->r[31] + 0x00000184u;
         /* 02215B64 */ cpu->r[10] = rbrew_read32(cpu->mem, _t3);
         /* 02215B68 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Au, 0x0000001Cu);
-        /* 02215B68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02215B6C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02215B68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02215B6C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02215B6C */ _t5 = _t4 & 0x00000001u;
         /* 02215B6C */ if (_t5) goto L_02215B70; else goto L_02215C74;
   L_02215B70: ; // 0x2215b70
@@ -20796,26 +20796,26 @@ void Gambit_fn_02215D18(CPUState* cpu) {
         /* 02215D70 */ cpu->r[12] = 0x10050000u;
         /* 02215D74 */ _t10 = cpu->r[12] + 0xFFFFB140u;
         /* 02215D74 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t10);
-        /* 02215D78 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[1]);
+        /* 02215D78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[1]));
         /* 02215D7C */ _t11 = cpu->r[31] + 0x00000140u;
         /* 02215D7C */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t11);
-        /* 02215D80 */ _t12 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02215D80 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02215D80 */ _t13 = _t12 & 0x00000001u;
         /* 02215D80 */ if (_t13) goto L_02215DB8; else goto L_02215D84;
   L_02215D84: ; // 0x2215d84
-        /* 02215D84 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[29]);
-        /* 02215D88 */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02215D84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[29]));
+        /* 02215D88 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02215D88 */ _t15 = _t14 & 0x00000001u;
         /* 02215D88 */ if (_t15) goto L_02215D8C; else goto L_02215DF4;
   L_02215D8C: ; // 0x2215d8c
-        /* 02215D8C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[1]);
-        /* 02215D90 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02215D8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[1]));
+        /* 02215D90 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02215D90 */ _t17 = _t16 & 0x00000001u;
         /* 02215D90 */ if (_t17) goto L_02215D94; else goto L_02215DC0;
   L_02215D94: ; // 0x2215d94
         /* 02215D94 */ cpu->f[13] = cpu->f[1] - cpu->f[29];
-        /* 02215D98 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 02215D9C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02215D98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 02215D9C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02215D9C */ _t19 = _t18 & 0x00000001u;
         /* 02215D9C */ if (_t19) goto L_02215DF4; else goto L_02215DA0;
   L_02215DA0: ; // 0x2215da0
@@ -20826,22 +20826,22 @@ void Gambit_fn_02215D18(CPUState* cpu) {
         /* 02215DB0 */ cpu->f[31] = cpu->f[12] + cpu->f[31];
         /* 02215DB4 */ goto L_02215DF4;
   L_02215DB8: ; // 0x2215db8
-        /* 02215DB8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[1]);
-        /* 02215DBC */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02215DB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[1]));
+        /* 02215DBC */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02215DBC */ _t21 = _t20 & 0x00000001u;
         /* 02215DBC */ if (_t21) goto L_02215DC8; else goto L_02215DC0;
   L_02215DC0: ; // 0x2215dc0
         /* 02215DC0 */ cpu->f[31] = cpu->f[30];
         /* 02215DC4 */ goto L_02215DF4;
   L_02215DC8: ; // 0x2215dc8
-        /* 02215DC8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[29]);
-        /* 02215DCC */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02215DC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[29]));
+        /* 02215DCC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02215DCC */ _t23 = _t22 & 0x00000001u;
         /* 02215DCC */ if (_t23) goto L_02215DD0; else goto L_02215DF4;
   L_02215DD0: ; // 0x2215dd0
         /* 02215DD0 */ cpu->f[8] = cpu->f[29] - cpu->f[1];
-        /* 02215DD4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
-        /* 02215DD8 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02215DD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
+        /* 02215DD8 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02215DD8 */ _t25 = _t24 & 0x00000001u;
         /* 02215DD8 */ if (_t25) goto L_02215DF0; else goto L_02215DDC;
   L_02215DDC: ; // 0x2215ddc
@@ -20868,7 +20868,7 @@ void Gambit_fn_02215D18(CPUState* cpu) {
         /* 02215E0C */ cpu->r[31] = rbrew_read32(cpu->mem, _t31);
         /* 02215E10 */ _t32 = cpu->r[1] + 0x00000010u;
         /* 02215E10 */ cpu->f[29] = rbrew_read_f64(cpu->mem, _t32);
-        /* 02215E14 */ _t33 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02215E14 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02215E14 */ _t34 = _t33 & 0x00000001u;
         /* 02215E14 */ if (_t34) goto L_02215E18; // else: addr-0 trap, fall-through
   L_02215E18: ; // 0x2215e18
@@ -20945,8 +20945,8 @@ void Gambit_fn_02215E74(CPUState* cpu) {
         /* 02215E88 */ _t3 = cpu->r[31] + 0x00000190u;
         /* 02215E88 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 02215E8C */ cpu->r[12] = cpu->r[3] + 0xFFFFFFFFu;
-        /* 02215E90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[12]);
-        /* 02215E94 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02215E90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[12]));
+        /* 02215E94 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02215E94 */ _t5 = _t4 & 0x00000001u;
         /* 02215E94 */ if (_t5) goto L_02215EA4; else goto L_02215E98;
   L_02215E98: ; // 0x2215e98
@@ -21079,21 +21079,21 @@ void Gambit_fn_02215F10(CPUState* cpu) {
         /* 02215FBC */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02215FC0 */ _t22 = cpu->r[31] + 0x00000004u;
         /* 02215FC0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t22);
-        /* 02215FC4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[28]);
-        /* 02215FC8 */ _t23 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02215FC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[28]));
+        /* 02215FC8 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02215FC8 */ _t24 = _t23 & 0x00000001u;
         /* 02215FC8 */ if (_t24) goto L_02215FCC; else goto L_0221629C;
   L_02215FCC: ; // 0x2215fcc
         /* 02215FCC */ cpu->f[12] = cpu->f[30] * cpu->f[30];
-        /* 02215FD0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[12]);
-        /* 02215FD4 */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02215FD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[12]));
+        /* 02215FD4 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02215FD4 */ _t26 = _t25 & 0x00000001u;
         /* 02215FD4 */ if (_t26) goto L_02215FE4; else goto L_02215FD8;
   L_02215FD8: ; // 0x2215fd8
         /* 02215FD8 */ _t27 = cpu->r[30] + 0x00000190u;
         /* 02215FD8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t27);
-        /* 02215FDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[3]);
-        /* 02215FE0 */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02215FDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[3]));
+        /* 02215FE0 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02215FE0 */ _t29 = _t28 & 0x00000001u;
         /* 02215FE0 */ if (_t29) goto L_0221629C; else goto L_02215FE4;
   L_02215FE4: ; // 0x2215fe4
@@ -21101,21 +21101,21 @@ void Gambit_fn_02215F10(CPUState* cpu) {
         /* 02215FE4 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t30);
         /* 02215FE8 */ cpu->r[10] = 0x10050000u;
         /* 02215FEC */ cpu->r[9] = 0x10050000u;
-        /* 02215FF0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[28]);
+        /* 02215FF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[28]));
         /* 02215FF4 */ _t31 = cpu->r[10] + 0xFFFFB140u;
         /* 02215FF4 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t31);
         /* 02215FF8 */ _t32 = cpu->r[9] + 0xFFFFB234u;
         /* 02215FF8 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t32);
         /* 02215FFC */ cpu->f[11] = cpu->f[12];
-        /* 02216000 */ _t33 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02216000 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02216000 */ _t34 = _t33 & 0x00000001u;
         /* 02216000 */ if (_t34) goto L_0221601C; else goto L_02216004;
   L_02216004: ; // 0x2216004
         /* 02216004 */ cpu->f[0] = cpu->f[28] - cpu->f[9];
         /* 02216008 */ cpu->f[7] = cpu->f[13] - cpu->f[9];
         /* 0221600C */ cpu->f[11] = cpu->f[0] / cpu->f[7];
-        /* 02216010 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
-        /* 02216014 */ _t35 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02216010 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
+        /* 02216014 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02216014 */ _t36 = _t35 & 0x00000001u;
         /* 02216014 */ if (_t36) goto L_02216018; else goto L_0221601C;
   L_02216018: ; // 0x2216018
@@ -21131,17 +21131,17 @@ void Gambit_fn_02215F10(CPUState* cpu) {
         /* 02216030 */ _t39 = cpu->r[9] + 0xFFFFB23Cu;
         /* 02216030 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t39);
         /* 02216034 */ cpu->r[12] = 0x10050000u;
-        /* 02216038 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[12]);
+        /* 02216038 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[12]));
         /* 0221603C */ _t40 = cpu->r[12] + 0xFFFFB240u;
         /* 0221603C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t40);
-        /* 02216040 */ _t41 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02216040 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02216040 */ _t42 = _t41 & 0x00000001u;
         /* 02216040 */ if (_t42) goto L_02216058; else goto L_02216044;
   L_02216044: ; // 0x2216044
         /* 02216044 */ cpu->f[6] = cpu->f[12] * cpu->f[0];
-        /* 02216048 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[30]);
+        /* 02216048 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[30]));
         /* 0221604C */ cpu->f[8] = cpu->f[12];
-        /* 02216050 */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02216050 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02216050 */ _t44 = _t43 & 0x00000001u;
         /* 02216050 */ if (_t44) goto L_022160D4; else goto L_02216054;
   L_02216054: ; // 0x2216054
@@ -21155,21 +21155,21 @@ void Gambit_fn_02215F10(CPUState* cpu) {
         /* 02216064 */ cpu->f[7] = -fma(cpu->f[7], cpu->f[0], -(cpu->f[10]));
         /* 02216068 */ cpu->f[13] = cpu->f[7] * cpu->f[8];
         /* 0221606C */ cpu->f[6] = cpu->f[13] * cpu->f[0];
-        /* 02216070 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[30]);
+        /* 02216070 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[30]));
         /* 02216074 */ cpu->f[8] = cpu->f[12];
-        /* 02216078 */ _t47 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02216078 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02216078 */ _t48 = _t47 & 0x00000001u;
         /* 02216078 */ if (_t48) goto L_022160D4; else goto L_0221607C;
   L_0221607C: ; // 0x221607c
-        /* 0221607C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[12]);
-        /* 02216080 */ _t49 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221607C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[12]));
+        /* 02216080 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02216080 */ _t50 = _t49 & 0x00000001u;
         /* 02216080 */ if (_t50) goto L_02216098; else goto L_02216084;
   L_02216084: ; // 0x2216084
         /* 02216084 */ cpu->f[7] = -fma(cpu->f[6], cpu->f[6], -(cpu->f[29]));
-        /* 02216088 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[12]);
+        /* 02216088 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[12]));
         /* 0221608C */ cpu->f[0] = cpu->f[12] * cpu->f[29];
-        /* 02216090 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02216090 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02216090 */ _t52 = _t51 & 0x00000001u;
         /* 02216090 */ if (_t52) goto L_022160D4; else goto L_02216094;
   L_02216094: ; // 0x2216094
@@ -21183,17 +21183,17 @@ void Gambit_fn_02215F10(CPUState* cpu) {
         /* 022160A4 */ cpu->f[7] = -fma(cpu->f[7], cpu->f[29], -(cpu->f[10]));
         /* 022160A8 */ cpu->f[0] = cpu->f[7] * cpu->f[13];
         /* 022160AC */ cpu->f[7] = -fma(cpu->f[6], cpu->f[6], -(cpu->f[29]));
-        /* 022160B0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[12]);
+        /* 022160B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[12]));
         /* 022160B4 */ cpu->f[0] = cpu->f[0] * cpu->f[29];
-        /* 022160B8 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022160B8 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022160B8 */ _t56 = _t55 & 0x00000001u;
         /* 022160B8 */ if (_t56) goto L_022160D4; else goto L_022160BC;
   L_022160BC: ; // 0x22160bc
         /* 022160BC */ cpu->f[9] = cpu->f[30] - cpu->f[6];
         /* 022160C0 */ cpu->f[10] = cpu->f[0] - cpu->f[6];
         /* 022160C4 */ cpu->f[8] = cpu->f[9] / cpu->f[10];
-        /* 022160C8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
-        /* 022160CC */ _t57 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022160C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
+        /* 022160CC */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022160CC */ _t58 = _t57 & 0x00000001u;
         /* 022160CC */ if (_t58) goto L_022160D0; else goto L_022160D4;
   L_022160D0: ; // 0x22160d0
@@ -21202,10 +21202,10 @@ void Gambit_fn_02215F10(CPUState* cpu) {
         /* 022160D4 */ _t59 = cpu->r[30] + 0x00000190u;
         /* 022160D4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t59);
         /* 022160D8 */ cpu->r[0] = cpu->r[11] + 0xFFFFFFFFu;
-        /* 022160DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[3]);
+        /* 022160DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[3]));
         /* 022160E0 */ _t60 = cpu->r[31] + 0x00000000u;
         /* 022160E0 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t60);
-        /* 022160E4 */ _t61 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022160E4 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022160E4 */ _t62 = _t61 & 0x00000001u;
         /* 022160E4 */ if (_t62) goto L_022160E8; else goto L_022160EC;
   L_022160E8: ; // 0x22160e8
@@ -21394,7 +21394,7 @@ void Gambit_fn_02215F10(CPUState* cpu) {
         /* 022162BC */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t125);
         /* 022162C0 */ _t126 = cpu->r[1] + 0x00000050u;
         /* 022162C0 */ cpu->r[30] = rbrew_read32(cpu->mem, _t126);
-        /* 022162C4 */ _t127 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022162C4 */ _t127 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022162C4 */ _t128 = _t127 & 0x00000001u;
         /* 022162C4 */ if (_t128) goto L_022162C8; // else: addr-0 trap, fall-through
   L_022162C8: ; // 0x22162c8
@@ -21470,8 +21470,8 @@ void Gambit_fn_02216334(CPUState* cpu) {
         /* 02216354 */ /* nop */
         /* 02216358 */ cpu->r[30] = cpu->r[3];
         /* 0221635C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02216360 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[3]);
-        /* 02216364 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02216360 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[3]));
+        /* 02216364 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02216364 */ _t8 = _t7 & 0x00000001u;
         /* 02216364 */ if (_t8) goto L_02216374; else goto L_02216368;
   L_02216368: ; // 0x2216368
@@ -21509,8 +21509,8 @@ void Gambit_fn_02216390(CPUState* cpu) {
         /* 022163AC */ _t3 = cpu->r[31] + 0x000001C8u;
         /* 022163AC */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 022163B0 */ cpu->r[12] = cpu->r[3] + 0xFFFFFFFFu;
-        /* 022163B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[12]);
-        /* 022163B8 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022163B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[12]));
+        /* 022163B8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022163B8 */ _t5 = _t4 & 0x00000001u;
         /* 022163B8 */ if (_t5) goto L_022163C8; else goto L_022163BC;
   L_022163BC: ; // 0x22163bc
@@ -21566,9 +21566,9 @@ void Gambit_fn_022163DC(CPUState* cpu) {
         /* 02216420 */ _t12 = cpu->r[3] + 0x00000184u;
         /* 02216420 */ cpu->r[9] = rbrew_read32(cpu->mem, _t12);
         /* 02216424 */ cpu->r[9] = rbrew_rlwinm(cpu->r[9], 0x00000000u, 0x0000001Au, 0x0000001Cu);
-        /* 02216424 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02216424 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02216428 */ cpu->r[31] = cpu->r[3];
-        /* 0221642C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221642C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221642C */ _t14 = _t13 & 0x00000001u;
         /* 0221642C */ if (_t14) goto L_02216470; else goto L_02216430;
   L_02216430: ; // 0x2216430
@@ -21593,7 +21593,7 @@ void Gambit_fn_022163DC(CPUState* cpu) {
         /* 02216454 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t23);
         /* 02216458 */ _t24 = cpu->r[1] + 0x00000060u;
         /* 02216458 */ cpu->r[30] = rbrew_read32(cpu->mem, _t24);
-        /* 0221645C */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221645C */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221645C */ _t26 = _t25 & 0x00000001u;
         /* 0221645C */ if (_t26) goto L_02216460; // else: addr-0 trap, fall-through
   L_02216460: ; // 0x2216460
@@ -21699,14 +21699,14 @@ void Gambit_fn_022163DC(CPUState* cpu) {
         /* 02216570 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02216574 */ _t57 = cpu->r[31] + 0x00000138u;
         /* 02216574 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t57);
-        /* 02216578 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[1]);
-        /* 0221657C */ _t58 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02216578 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[1]));
+        /* 0221657C */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221657C */ _t59 = _t58 & 0x00000001u;
         /* 0221657C */ if (_t59) goto L_02216580; else goto L_02216838;
   L_02216580: ; // 0x2216580
         /* 02216580 */ cpu->f[13] = cpu->f[30] * cpu->f[30];
-        /* 02216584 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[13]);
-        /* 02216588 */ _t60 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02216584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[13]));
+        /* 02216588 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02216588 */ _t61 = _t60 & 0x00000001u;
         /* 02216588 */ if (_t61) goto L_022165AC; else goto L_0221658C;
   L_0221658C: ; // 0x221658c
@@ -21719,8 +21719,8 @@ void Gambit_fn_022163DC(CPUState* cpu) {
         /* 0221659C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 022165A0 */ _t64 = cpu->r[31] + 0x000001C8u;
         /* 022165A0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t64);
-        /* 022165A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[3]);
-        /* 022165A8 */ _t65 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022165A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[3]));
+        /* 022165A8 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022165A8 */ _t66 = _t65 & 0x00000001u;
         /* 022165A8 */ if (_t66) goto L_02216838; else goto L_022165AC;
   L_022165AC: ; // 0x22165ac
@@ -21728,13 +21728,13 @@ void Gambit_fn_022163DC(CPUState* cpu) {
         /* 022165AC */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t67);
         /* 022165B0 */ cpu->r[8] = 0x10050000u;
         /* 022165B4 */ cpu->r[12] = 0x10050000u;
-        /* 022165B8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[28]);
+        /* 022165B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[28]));
         /* 022165BC */ _t68 = cpu->r[8] + 0xFFFFB140u;
         /* 022165BC */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t68);
         /* 022165C0 */ _t69 = cpu->r[12] + 0xFFFFB234u;
         /* 022165C0 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t69);
         /* 022165C4 */ cpu->f[13] = cpu->f[12];
-        /* 022165C8 */ _t70 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022165C8 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022165C8 */ _t71 = _t70 & 0x00000001u;
         /* 022165C8 */ if (_t71) goto L_022165E8; else goto L_022165CC;
   L_022165CC: ; // 0x22165cc
@@ -21743,8 +21743,8 @@ void Gambit_fn_022163DC(CPUState* cpu) {
         /* 022165D0 */ cpu->f[0] = cpu->f[28] - cpu->f[8];
         /* 022165D4 */ cpu->f[7] = cpu->f[9] - cpu->f[8];
         /* 022165D8 */ cpu->f[13] = cpu->f[0] / cpu->f[7];
-        /* 022165DC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[31]);
-        /* 022165E0 */ _t73 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022165DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[31]));
+        /* 022165E0 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022165E0 */ _t74 = _t73 & 0x00000001u;
         /* 022165E0 */ if (_t74) goto L_022165E4; else goto L_022165E8;
   L_022165E4: ; // 0x22165e4
@@ -21760,17 +21760,17 @@ void Gambit_fn_022163DC(CPUState* cpu) {
         /* 022165FC */ _t77 = cpu->r[8] + 0xFFFFB23Cu;
         /* 022165FC */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t77);
         /* 02216600 */ cpu->r[9] = 0x10050000u;
-        /* 02216604 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[12]);
+        /* 02216604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[12]));
         /* 02216608 */ _t78 = cpu->r[9] + 0xFFFFB240u;
         /* 02216608 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t78);
-        /* 0221660C */ _t79 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221660C */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221660C */ _t80 = _t79 & 0x00000001u;
         /* 0221660C */ if (_t80) goto L_02216624; else goto L_02216610;
   L_02216610: ; // 0x2216610
         /* 02216610 */ cpu->f[6] = cpu->f[12] * cpu->f[8];
-        /* 02216614 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[30]);
+        /* 02216614 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[30]));
         /* 02216618 */ cpu->f[9] = cpu->f[12];
-        /* 0221661C */ _t81 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221661C */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221661C */ _t82 = _t81 & 0x00000001u;
         /* 0221661C */ if (_t82) goto L_022166A0; else goto L_02216620;
   L_02216620: ; // 0x2216620
@@ -21784,21 +21784,21 @@ void Gambit_fn_022163DC(CPUState* cpu) {
         /* 02216630 */ cpu->f[9] = -fma(cpu->f[9], cpu->f[8], -(cpu->f[11]));
         /* 02216634 */ cpu->f[0] = cpu->f[9] * cpu->f[7];
         /* 02216638 */ cpu->f[6] = cpu->f[0] * cpu->f[8];
-        /* 0221663C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[30]);
+        /* 0221663C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[30]));
         /* 02216640 */ cpu->f[9] = cpu->f[12];
-        /* 02216644 */ _t85 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02216644 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02216644 */ _t86 = _t85 & 0x00000001u;
         /* 02216644 */ if (_t86) goto L_022166A0; else goto L_02216648;
   L_02216648: ; // 0x2216648
-        /* 02216648 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[12]);
-        /* 0221664C */ _t87 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02216648 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[12]));
+        /* 0221664C */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221664C */ _t88 = _t87 & 0x00000001u;
         /* 0221664C */ if (_t88) goto L_02216664; else goto L_02216650;
   L_02216650: ; // 0x2216650
         /* 02216650 */ cpu->f[7] = -fma(cpu->f[6], cpu->f[6], -(cpu->f[29]));
-        /* 02216654 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[12]);
+        /* 02216654 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[12]));
         /* 02216658 */ cpu->f[8] = cpu->f[12] * cpu->f[29];
-        /* 0221665C */ _t89 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221665C */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221665C */ _t90 = _t89 & 0x00000001u;
         /* 0221665C */ if (_t90) goto L_022166A0; else goto L_02216660;
   L_02216660: ; // 0x2216660
@@ -21812,17 +21812,17 @@ void Gambit_fn_022163DC(CPUState* cpu) {
         /* 02216670 */ cpu->f[0] = -fma(cpu->f[0], cpu->f[29], -(cpu->f[11]));
         /* 02216674 */ cpu->f[8] = cpu->f[0] * cpu->f[7];
         /* 02216678 */ cpu->f[7] = -fma(cpu->f[6], cpu->f[6], -(cpu->f[29]));
-        /* 0221667C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[12]);
+        /* 0221667C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[12]));
         /* 02216680 */ cpu->f[8] = cpu->f[8] * cpu->f[29];
-        /* 02216684 */ _t93 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02216684 */ _t93 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02216684 */ _t94 = _t93 & 0x00000001u;
         /* 02216684 */ if (_t94) goto L_022166A0; else goto L_02216688;
   L_02216688: ; // 0x2216688
         /* 02216688 */ cpu->f[9] = cpu->f[30] - cpu->f[6];
         /* 0221668C */ cpu->f[11] = cpu->f[8] - cpu->f[6];
         /* 02216690 */ cpu->f[9] = cpu->f[9] / cpu->f[11];
-        /* 02216694 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[31]);
-        /* 02216698 */ _t95 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02216694 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[31]));
+        /* 02216698 */ _t95 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02216698 */ _t96 = _t95 & 0x00000001u;
         /* 02216698 */ if (_t96) goto L_0221669C; else goto L_022166A0;
   L_0221669C: ; // 0x221669c
@@ -21833,10 +21833,10 @@ void Gambit_fn_022163DC(CPUState* cpu) {
         /* 022166A4 */ cpu->r[0] = cpu->r[11] + 0xFFFFFFFFu;
         /* 022166A8 */ _t98 = cpu->r[31] + 0x00000138u;
         /* 022166A8 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t98);
-        /* 022166AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[30]);
+        /* 022166AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[30]));
         /* 022166B0 */ _t99 = cpu->r[31] + 0x00000218u;
         /* 022166B0 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t99);
-        /* 022166B4 */ _t100 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022166B4 */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022166B4 */ _t101 = _t100 & 0x00000001u;
         /* 022166B4 */ if (_t101) goto L_022166B8; else goto L_022166BC;
   L_022166B8: ; // 0x22166b8
@@ -22003,7 +22003,7 @@ void Gambit_fn_022163DC(CPUState* cpu) {
         /* 02216858 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t155);
         /* 0221685C */ _t156 = cpu->r[1] + 0x00000060u;
         /* 0221685C */ cpu->r[30] = rbrew_read32(cpu->mem, _t156);
-        /* 02216860 */ _t157 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02216860 */ _t157 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02216860 */ _t158 = _t157 & 0x00000001u;
         /* 02216860 */ if (_t158) goto L_02216864; // else: addr-0 trap, fall-through
   L_02216864: ; // 0x2216864
@@ -22040,8 +22040,8 @@ void Gambit_fn_02216878(CPUState* cpu) {
         /* 022168A0 */ _t7 = cpu->r[31] + 0x00000184u;
         /* 022168A0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 022168A4 */ cpu->r[9] = rbrew_rlwinm(cpu->r[9], 0x00000000u, 0x0000001Au, 0x0000001Cu);
-        /* 022168A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 022168A8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022168A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 022168A8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022168A8 */ _t9 = _t8 & 0x00000001u;
         /* 022168A8 */ if (_t9) goto L_022168AC; else goto L_02216940;
   L_022168AC: ; // 0x22168ac
@@ -22114,7 +22114,7 @@ void Gambit_fn_02216878(CPUState* cpu) {
         /* 02216954 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t32);
         /* 02216958 */ _t33 = cpu->r[1] + 0x00000018u;
         /* 02216958 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t33);
-        /* 0221695C */ _t34 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221695C */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221695C */ _t35 = _t34 & 0x00000001u;
         /* 0221695C */ if (_t35) goto L_02216960; // else: addr-0 trap, fall-through
   L_02216960: ; // 0x2216960
@@ -22130,15 +22130,15 @@ void Gambit_fn_02216970(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02216970: ; // 0x2216970
-        /* 02216970 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02216974 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02216970 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02216974 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02216974 */ _t1 = _t0 & 0x00000001u;
         /* 02216974 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02216974 */ goto L_02216978;
   L_02216978: ; // 0x2216978
         /* 02216978 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02216978 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0221697C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02216978 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0221697C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221697C */ _t3 = _t2 & 0x00000001u;
         /* 0221697C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0221697C */ goto L_02216980;
@@ -22157,8 +22157,8 @@ void Gambit_fn_02216970(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -22172,15 +22172,15 @@ void Gambit_fn_02216970(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -22214,15 +22214,15 @@ void Gambit_fn_02216988(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02216988: ; // 0x2216988
-        /* 02216988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221698C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02216988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221698C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221698C */ _t1 = _t0 & 0x00000001u;
         /* 0221698C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0221698C */ goto L_02216990;
   L_02216990: ; // 0x2216990
         /* 02216990 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02216990 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02216994 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02216990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02216994 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02216994 */ _t3 = _t2 & 0x00000001u;
         /* 02216994 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02216994 */ goto L_02216998;
@@ -22241,8 +22241,8 @@ void Gambit_fn_02216988(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -22256,15 +22256,15 @@ void Gambit_fn_02216988(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -22313,7 +22313,7 @@ void Gambit_fn_022169C4(CPUState* cpu) {
         /* 022169C4 */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 022169C4 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 022169C4 */ cpu->r[1] = _t0;
-        /* 022169C8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022169C8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022169C8 */ _t2 = _t1 & 0x00000001u;
         /* 022169C8 */ if (_t2) goto L_022169CC; else goto L_022169D4;
   L_022169CC: ; // 0x22169cc
@@ -22332,15 +22332,15 @@ void Gambit_fn_022169E4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_022169E4: ; // 0x22169e4
-        /* 022169E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022169E8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022169E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022169E8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022169E8 */ _t1 = _t0 & 0x00000001u;
         /* 022169E8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022169E8 */ goto L_022169EC;
   L_022169EC: ; // 0x22169ec
         /* 022169EC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022169EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022169F0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022169EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022169F0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022169F0 */ _t3 = _t2 & 0x00000001u;
         /* 022169F0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022169F0 */ goto L_022169F4;
@@ -22359,8 +22359,8 @@ void Gambit_fn_022169E4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -22374,15 +22374,15 @@ void Gambit_fn_022169E4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -22410,15 +22410,15 @@ void Gambit_fn_022169F8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_022169F8: ; // 0x22169f8
-        /* 022169F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022169FC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022169F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022169FC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022169FC */ _t1 = _t0 & 0x00000001u;
         /* 022169FC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022169FC */ goto L_02216A00;
   L_02216A00: ; // 0x2216a00
         /* 02216A00 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02216A00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02216A04 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02216A00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02216A04 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02216A04 */ _t3 = _t2 & 0x00000001u;
         /* 02216A04 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02216A04 */ goto L_02216A08;
@@ -22437,8 +22437,8 @@ void Gambit_fn_022169F8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -22452,15 +22452,15 @@ void Gambit_fn_022169F8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -22539,8 +22539,8 @@ void Gambit_fn_02216A2C(CPUState* cpu) {
         /* 02216A2C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02216A2C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02216A30 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 02216A30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02216A34 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02216A30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02216A34 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02216A34 */ _t2 = _t1 & 0x00000001u;
         /* 02216A34 */ _t3 = _t2 ^ 0x00000001u;
         /* 02216A34 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -22562,8 +22562,8 @@ void Gambit_fn_02216A48(CPUState* cpu) {
         /* 02216A48 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02216A48 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02216A4C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 02216A4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02216A50 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02216A4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02216A50 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02216A50 */ _t2 = _t1 & 0x00000001u;
         /* 02216A50 */ _t3 = _t2 ^ 0x00000001u;
         /* 02216A50 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -22585,8 +22585,8 @@ void Gambit_fn_02216A64(CPUState* cpu) {
         /* 02216A64 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02216A64 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02216A68 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 02216A68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02216A6C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02216A68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02216A6C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02216A6C */ _t2 = _t1 & 0x00000001u;
         /* 02216A6C */ _t3 = _t2 ^ 0x00000001u;
         /* 02216A6C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -22629,8 +22629,8 @@ void Gambit_fn_02216A90(CPUState* cpu) {
         /* 02216AA0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02216AA4 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02216AA4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02216AA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02216AAC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02216AA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02216AAC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02216AAC */ _t5 = _t4 & 0x00000001u;
         /* 02216AAC */ if (_t5) goto L_02216AB0; else goto L_02216ACC;
   L_02216AB0: ; // 0x2216ab0
@@ -22669,8 +22669,8 @@ void Gambit_fn_02216A94(CPUState* cpu) {
         /* 02216AA0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02216AA4 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02216AA4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02216AA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02216AAC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02216AA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02216AAC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02216AAC */ _t5 = _t4 & 0x00000001u;
         /* 02216AAC */ if (_t5) goto L_02216AB0; else goto L_02216ACC;
   L_02216AB0: ; // 0x2216ab0
@@ -23055,8 +23055,8 @@ void Gambit_fn_02216C54(CPUState* cpu) {
         /* 02216C54 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 02216C54 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02216C58 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 02216C58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02216C5C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02216C58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02216C5C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02216C5C */ _t2 = _t1 & 0x00000001u;
         /* 02216C5C */ if (_t2) goto L_02216C6C; else goto L_02216C60;
   L_02216C60: ; // 0x2216c60
@@ -23085,8 +23085,8 @@ void Gambit_fn_02216C78(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -23371,10 +23371,10 @@ void Gambit_fn_02216D98(CPUState* cpu) {
         /* 02216D98 */ cpu->r[10] = 0x101D0000u;
         /* 02216D9C */ _t0 = cpu->r[10] + 0xFFFFE610u;
         /* 02216D9C */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 02216DA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02216DA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02216DA4 */ cpu->r[10] = 0x101D0000u;
         /* 02216DA8 */ cpu->r[10] = cpu->r[10] + 0xFFFFFEC8u;
-        /* 02216DAC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02216DAC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02216DAC */ _t2 = _t1 & 0x00000001u;
         /* 02216DAC */ if (_t2) goto L_02216DB0; else goto L_02216DC8;
   L_02216DB0: ; // 0x2216db0
@@ -23387,8 +23387,8 @@ void Gambit_fn_02216D98(CPUState* cpu) {
         /* 02216DC4 */ _t4 = cpu->r[10] + 0x00000000u;
         /* 02216DC4 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_02216DC8: ; // 0x2216dc8
-        /* 02216DC8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02216DCC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02216DC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02216DCC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02216DCC */ _t6 = _t5 & 0x00000001u;
         /* 02216DCC */ if (_t6) goto L_02216DD0; else goto L_02216DD8;
   L_02216DD0: ; // 0x2216dd0
@@ -23399,9 +23399,9 @@ void Gambit_fn_02216D98(CPUState* cpu) {
         /* 02216DDC */ _t7 = cpu->r[9] + 0xFFFFDA00u;
         /* 02216DDC */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 02216DE0 */ cpu->r[11] = 0x101D0000u;
-        /* 02216DE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02216DE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02216DE8 */ cpu->r[11] = cpu->r[11] + 0xFFFFFBFCu;
-        /* 02216DEC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02216DEC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02216DEC */ _t9 = _t8 & 0x00000001u;
         /* 02216DEC */ if (_t9) goto L_02216DF0; else goto L_02216E08;
   L_02216DF0: ; // 0x2216df0
@@ -23414,8 +23414,8 @@ void Gambit_fn_02216D98(CPUState* cpu) {
         /* 02216E04 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 02216E04 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_02216E08: ; // 0x2216e08
-        /* 02216E08 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 02216E0C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02216E08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 02216E0C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02216E0C */ _t13 = _t12 & 0x00000001u;
         /* 02216E0C */ if (_t13) goto L_02216E10; else goto L_02216E18;
   L_02216E10: ; // 0x2216e10
@@ -23426,9 +23426,9 @@ void Gambit_fn_02216D98(CPUState* cpu) {
         /* 02216E1C */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 02216E1C */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 02216E20 */ cpu->r[9] = 0x101D0000u;
-        /* 02216E24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02216E24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02216E28 */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 02216E2C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02216E2C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02216E2C */ _t16 = _t15 & 0x00000001u;
         /* 02216E2C */ if (_t16) goto L_02216E30; else goto L_02216E48;
   L_02216E30: ; // 0x2216e30
@@ -23441,8 +23441,8 @@ void Gambit_fn_02216D98(CPUState* cpu) {
         /* 02216E44 */ _t18 = cpu->r[9] + 0x00000000u;
         /* 02216E44 */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_02216E48: ; // 0x2216e48
-        /* 02216E48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 02216E4C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02216E48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 02216E4C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02216E4C */ _t20 = _t19 & 0x00000001u;
         /* 02216E4C */ if (_t20) goto L_02216E50; else goto L_02216E58;
   L_02216E50: ; // 0x2216e50
@@ -23454,9 +23454,9 @@ void Gambit_fn_02216D98(CPUState* cpu) {
         /* 02216E5C */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 02216E5C */ cpu->r[9] = _t21;
         /* 02216E60 */ cpu->r[10] = 0x101D0000u;
-        /* 02216E64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02216E64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02216E68 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 02216E6C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02216E6C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02216E6C */ _t23 = _t22 & 0x00000001u;
         /* 02216E6C */ if (_t23) goto L_02216E70; else goto L_02216E84;
   L_02216E70: ; // 0x2216e70
@@ -23468,8 +23468,8 @@ void Gambit_fn_02216D98(CPUState* cpu) {
         /* 02216E80 */ _t25 = cpu->r[10] + 0x00000000u;
         /* 02216E80 */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_02216E84: ; // 0x2216e84
-        /* 02216E84 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02216E88 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02216E84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02216E88 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02216E88 */ _t27 = _t26 & 0x00000001u;
         /* 02216E88 */ if (_t27) goto L_02216E8C; else goto L_02216E94;
   L_02216E8C: ; // 0x2216e8c
@@ -23481,9 +23481,9 @@ void Gambit_fn_02216D98(CPUState* cpu) {
         /* 02216E98 */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 02216E98 */ cpu->r[10] = _t28;
         /* 02216E9C */ cpu->r[11] = 0x101D0000u;
-        /* 02216EA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02216EA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02216EA4 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 02216EA8 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02216EA8 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02216EA8 */ _t30 = _t29 & 0x00000001u;
         /* 02216EA8 */ if (_t30) goto L_02216EAC; else goto L_02216EC0;
   L_02216EAC: ; // 0x2216eac
@@ -23666,10 +23666,10 @@ void Gambit_fn_02216F80(CPUState* cpu) {
         /* 02216FA0 */ cpu->r[31] = 0x101D0000u;
         /* 02216FA4 */ _t3 = cpu->r[28] + 0x0000001Cu;
         /* 02216FA4 */ rbrew_write32(cpu->mem, _t3, cpu->r[4]);
-        /* 02216FA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02216FA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02216FAC */ _t4 = cpu->r[28] + 0x0000000Fu;
         /* 02216FAC */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[27]);
-        /* 02216FB0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02216FB0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02216FB0 */ _t6 = _t5 & 0x00000001u;
         /* 02216FB0 */ if (_t6) goto L_02216FF4; else goto L_02216FB4;
   L_02216FB4: ; // 0x2216fb4
@@ -23684,16 +23684,16 @@ void Gambit_fn_02216F80(CPUState* cpu) {
         /* 02216FC8 */ cpu->r[5] = 0x00000004u;
         /* 02216FCC */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 02216FD0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02216FD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02216FD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02216FD8 */ cpu->r[0] = cpu->r[27];
-        /* 02216FDC */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02216FDC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02216FDC */ _t11 = _t10 & 0x00000001u;
         /* 02216FDC */ if (_t11) goto L_02216FE4; else goto L_02216FE0;
   L_02216FE0: ; // 0x2216fe0
         /* 02216FE0 */ cpu->r[0] = 0x00000001u;
   L_02216FE4: ; // 0x2216fe4
-        /* 02216FE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02216FE8 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02216FE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02216FE8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02216FE8 */ _t13 = _t12 & 0x00000001u;
         /* 02216FE8 */ if (_t13) goto L_02216FF4; else goto L_02216FEC;
   L_02216FEC: ; // 0x2216fec
@@ -23705,9 +23705,9 @@ void Gambit_fn_02216F80(CPUState* cpu) {
         /* 02216FF4 */ _t16 = cpu->r[28] + 0x00000020u;
         /* 02216FF4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 02216FF8 */ cpu->r[0] = 0x00000000u;
-        /* 02216FFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02216FFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02217000 */ cpu->r[12] = cpu->r[0];
-        /* 02217004 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02217004 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02217004 */ _t18 = _t17 & 0x00000001u;
         /* 02217004 */ if (_t18) goto L_02217008; else goto L_0221702C;
   L_02217008: ; // 0x2217008
@@ -23732,8 +23732,8 @@ void Gambit_fn_02216F80(CPUState* cpu) {
   L_0221702C: ; // 0x221702c
         /* 0221702C */ _t26 = cpu->r[28] + 0x0000000Fu;
         /* 0221702C */ cpu->r[27] = rbrew_read8(cpu->mem, _t26);
-        /* 02217030 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 02217034 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217030 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 02217034 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217034 */ _t28 = _t27 & 0x00000001u;
         /* 02217034 */ if (_t28) goto L_02217078; else goto L_02217038;
   L_02217038: ; // 0x2217038
@@ -23748,16 +23748,16 @@ void Gambit_fn_02216F80(CPUState* cpu) {
         /* 0221704C */ cpu->r[5] = 0x00000004u;
         /* 02217050 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 02217054 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02217058 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02217058 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0221705C */ cpu->r[11] = cpu->r[27];
-        /* 02217060 */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02217060 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02217060 */ _t33 = _t32 & 0x00000001u;
         /* 02217060 */ if (_t33) goto L_02217068; else goto L_02217064;
   L_02217064: ; // 0x2217064
         /* 02217064 */ cpu->r[11] = 0x00000001u;
   L_02217068: ; // 0x2217068
-        /* 02217068 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221706C */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217068 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221706C */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221706C */ _t35 = _t34 & 0x00000001u;
         /* 0221706C */ if (_t35) goto L_02217078; else goto L_02217070;
   L_02217070: ; // 0x2217070
@@ -23769,9 +23769,9 @@ void Gambit_fn_02216F80(CPUState* cpu) {
         /* 02217078 */ _t38 = cpu->r[28] + 0x00000028u;
         /* 02217078 */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 0221707C */ cpu->r[0] = 0x00000000u;
-        /* 02217080 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02217080 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 02217084 */ cpu->r[12] = cpu->r[0];
-        /* 02217088 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02217088 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02217088 */ _t40 = _t39 & 0x00000001u;
         /* 02217088 */ if (_t40) goto L_0221708C; else goto L_022170B0;
   L_0221708C: ; // 0x221708c
@@ -23796,8 +23796,8 @@ void Gambit_fn_02216F80(CPUState* cpu) {
   L_022170B0: ; // 0x22170b0
         /* 022170B0 */ _t48 = cpu->r[28] + 0x0000000Fu;
         /* 022170B0 */ cpu->r[27] = rbrew_read8(cpu->mem, _t48);
-        /* 022170B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 022170B8 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022170B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 022170B8 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022170B8 */ _t50 = _t49 & 0x00000001u;
         /* 022170B8 */ if (_t50) goto L_022170FC; else goto L_022170BC;
   L_022170BC: ; // 0x22170bc
@@ -23812,16 +23812,16 @@ void Gambit_fn_02216F80(CPUState* cpu) {
         /* 022170D0 */ cpu->r[5] = 0x00000004u;
         /* 022170D4 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 022170D8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 022170DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 022170DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 022170E0 */ cpu->r[10] = cpu->r[27];
-        /* 022170E4 */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022170E4 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022170E4 */ _t55 = _t54 & 0x00000001u;
         /* 022170E4 */ if (_t55) goto L_022170EC; else goto L_022170E8;
   L_022170E8: ; // 0x22170e8
         /* 022170E8 */ cpu->r[10] = 0x00000001u;
   L_022170EC: ; // 0x22170ec
-        /* 022170EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022170F0 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022170EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022170F0 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022170F0 */ _t57 = _t56 & 0x00000001u;
         /* 022170F0 */ if (_t57) goto L_022170FC; else goto L_022170F4;
   L_022170F4: ; // 0x22170f4
@@ -23833,9 +23833,9 @@ void Gambit_fn_02216F80(CPUState* cpu) {
         /* 022170FC */ _t60 = cpu->r[28] + 0x00000030u;
         /* 022170FC */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
         /* 02217100 */ cpu->r[0] = 0x00000000u;
-        /* 02217104 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02217104 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02217108 */ cpu->r[5] = cpu->r[0];
-        /* 0221710C */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221710C */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221710C */ _t62 = _t61 & 0x00000001u;
         /* 0221710C */ if (_t62) goto L_02217110; else goto L_02217134;
   L_02217110: ; // 0x2217110
@@ -23860,8 +23860,8 @@ void Gambit_fn_02216F80(CPUState* cpu) {
   L_02217134: ; // 0x2217134
         /* 02217134 */ _t70 = cpu->r[30] + 0x00000000u;
         /* 02217134 */ cpu->r[25] = rbrew_read8(cpu->mem, _t70);
-        /* 02217138 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 0221713C */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217138 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 0221713C */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221713C */ _t72 = _t71 & 0x00000001u;
         /* 0221713C */ if (_t72) goto L_02217218; else goto L_02217140;
   L_02217140: ; // 0x2217140
@@ -23877,10 +23877,10 @@ void Gambit_fn_02216F80(CPUState* cpu) {
         /* 02217158 */ cpu->r[4] = (uint32_t)((int32_t)cpu->r[25] * (int32_t)0x00000024u);
         /* 0221715C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02217160 */ cpu->r[24] = cpu->r[3];
-        /* 02217164 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 02217164 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 02217168 */ cpu->r[30] = cpu->r[25];
         /* 0221716C */ cpu->r[7] = 0x00000000u;
-        /* 02217170 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02217170 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02217170 */ _t77 = _t76 & 0x00000001u;
         /* 02217170 */ if (_t77) goto L_02217178; else goto L_02217174;
   L_02217174: ; // 0x2217174
@@ -23893,36 +23893,36 @@ void Gambit_fn_02216F80(CPUState* cpu) {
         /* 02217184 */ cpu->r[23] = 0x00000018u;
   L_02217188: ; // 0x2217188
         /* 02217188 */ cpu->r[27] = cpu->r[24] + cpu->r[22];
-        /* 02217188 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0221718C */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217188 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0221718C */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221718C */ _t80 = _t79 & 0x00000001u;
         /* 0221718C */ if (_t80) goto L_022171FC; else goto L_02217190;
   L_02217190: ; // 0x2217190
         /* 02217190 */ cpu->r[26] = cpu->r[27];
-        /* 02217190 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 02217194 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217190 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 02217194 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217194 */ _t82 = _t81 & 0x00000001u;
         /* 02217194 */ if (_t82) goto L_02217198; else goto L_022171A8;
   L_02217198: ; // 0x2217198
         /* 02217198 */ cpu->r[3] = 0x00000024u;
         /* 0221719C */ Gambit_fn_02801A78(cpu);
         /* 022171A0 */ cpu->r[26] = cpu->r[3];
-        /* 022171A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 022171A4 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022171A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 022171A4 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022171A4 */ _t84 = _t83 & 0x00000001u;
         /* 022171A4 */ if (_t84) goto L_022171F0; else goto L_022171A8;
   L_022171A8: ; // 0x22171a8
         /* 022171A8 */ cpu->r[11] = cpu->r[26];
-        /* 022171A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 022171AC */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022171A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 022171AC */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022171AC */ _t86 = _t85 & 0x00000001u;
         /* 022171AC */ if (_t86) goto L_022171B0; else goto L_022171C0;
   L_022171B0: ; // 0x22171b0
         /* 022171B0 */ cpu->r[3] = 0x0000000Cu;
         /* 022171B4 */ Gambit_fn_02801A78(cpu);
         /* 022171B8 */ cpu->r[11] = cpu->r[3];
-        /* 022171B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 022171BC */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022171B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 022171BC */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022171BC */ _t88 = _t87 & 0x00000001u;
         /* 022171BC */ if (_t88) goto L_022171DC; else goto L_022171C0;
   L_022171C0: ; // 0x22171c0
@@ -23953,14 +23953,14 @@ void Gambit_fn_02216F80(CPUState* cpu) {
         /* 022171F8 */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
   L_022171FC: ; // 0x22171fc
         /* 022171FC */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 022171FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 022171FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02217200 */ cpu->r[22] = cpu->r[22] + 0x00000024u;
-        /* 02217204 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217204 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217204 */ _t98 = _t97 & 0x00000001u;
         /* 02217204 */ if (_t98) goto L_02217208; else goto L_02217188;
   L_02217208: ; // 0x2217208
-        /* 02217208 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 0221720C */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 0221720C */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221720C */ _t100 = _t99 & 0x00000001u;
         /* 0221720C */ if (_t100) goto L_02217218; else goto L_02217210;
   L_02217210: ; // 0x2217210
@@ -23990,10 +23990,10 @@ void Gambit_fn_02217230(CPUState* cpu) {
         /* 02217234 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 02217238 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 02217238 */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 0221723C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[12]);
+        /* 0221723C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[12]));
         /* 02217240 */ _t3 = cpu->r[4] + 0x00000000u;
         /* 02217240 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 02217244 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02217244 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02217244 */ _t5 = _t4 & 0x00000001u;
         /* 02217244 */ if (_t5) goto L_02217248; else goto L_02217250;
   L_02217248: ; // 0x2217248
@@ -24010,10 +24010,10 @@ void Gambit_fn_02217230(CPUState* cpu) {
         /* 0221725C */ cpu->r[9] = rbrew_read8(cpu->mem, _t9);
         /* 02217260 */ _t10 = cpu->r[3] + 0x00000028u;
         /* 02217260 */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 02217264 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
+        /* 02217264 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
         /* 02217268 */ _t11 = cpu->r[3] + 0x0000002Cu;
         /* 02217268 */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
-        /* 0221726C */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221726C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221726C */ _t13 = _t12 & 0x00000001u;
         /* 0221726C */ if (_t13) goto L_02217270; else goto L_02217278;
   L_02217270: ; // 0x2217270
@@ -24034,10 +24034,10 @@ void Gambit_fn_02217230(CPUState* cpu) {
         /* 0221728C */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
         /* 02217290 */ _t20 = cpu->r[3] + 0x00000034u;
         /* 02217290 */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 02217294 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
+        /* 02217294 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
         /* 02217298 */ _t21 = cpu->r[6] + 0x00000000u;
         /* 02217298 */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
-        /* 0221729C */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221729C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221729C */ _t23 = _t22 & 0x00000001u;
         /* 0221729C */ if (_t23) goto L_022172A0; else goto L_022172A8;
   L_022172A0: ; // 0x22172a0
@@ -24064,10 +24064,10 @@ void Gambit_fn_022172B8(CPUState* cpu) {
         /* 022172C0 */ _t1 = cpu->r[3] + 0x00000028u;
         /* 022172C0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 022172C4 */ cpu->r[8] = cpu->r[0];
-        /* 022172C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 022172C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 022172CC */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 022172CC */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 022172D0 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022172D0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022172D0 */ _t4 = _t3 & 0x00000001u;
         /* 022172D0 */ if (_t4) goto L_022172D4; else goto L_022172EC;
   L_022172D4: ; // 0x22172d4
@@ -24075,8 +24075,8 @@ void Gambit_fn_022172B8(CPUState* cpu) {
         /* 022172D8 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 022172DC */ _t5 = cpu->r[9] + 0x00000002u;
         /* 022172DC */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 022172E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 022172E4 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022172E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 022172E4 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022172E4 */ _t7 = _t6 & 0x00000001u;
         /* 022172E4 */ if (_t7) goto L_022172E8; else goto L_022172F8;
   L_022172E8: ; // 0x22172e8
@@ -24084,16 +24084,16 @@ void Gambit_fn_022172B8(CPUState* cpu) {
   L_022172EC: ; // 0x22172ec
         /* 022172EC */ _t8 = cpu->r[12] + 0x00000002u;
         /* 022172EC */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 022172F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 022172F4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022172F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 022172F4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022172F4 */ _t10 = _t9 & 0x00000001u;
         /* 022172F4 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022172F4 */ goto L_022172F8;
   L_022172F8: ; // 0x22172f8
-        /* 022172F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 022172F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 022172FC */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 022172FC */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 02217300 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02217300 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02217300 */ _t13 = _t12 & 0x00000001u;
         /* 02217300 */ if (_t13) goto L_02217304; else goto L_0221730C;
   L_02217304: ; // 0x2217304
@@ -24104,11 +24104,11 @@ void Gambit_fn_022172B8(CPUState* cpu) {
         /* 0221730C */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 02217310 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 02217310 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 02217314 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02217314 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02217318 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 02217318 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0221731C */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 02217320 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02217320 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02217320 */ _t18 = _t17 & 0x00000001u;
         /* 02217320 */ if (_t18) goto L_02217338; else goto L_02217324;
   L_02217324: ; // 0x2217324
@@ -24141,18 +24141,18 @@ void Gambit_fn_02217340(CPUState* cpu) {
         /* 02217354 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02217354 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02217358 */ cpu->r[12] = 0x00000000u;
-        /* 0221735C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221735C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02217360 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 02217360 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02217364 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217364 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217364 */ _t6 = _t5 & 0x00000001u;
         /* 02217364 */ if (_t6) goto L_0221738C; else goto L_02217368;
   L_02217368: ; // 0x2217368
         /* 02217368 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02217368 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0221736C */ /* nop */
-        /* 02217370 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 02217374 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217370 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 02217374 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217374 */ _t9 = _t8 & 0x00000001u;
         /* 02217374 */ if (_t9) goto L_02217378; else goto L_0221738C;
   L_02217378: ; // 0x2217378
@@ -24193,18 +24193,18 @@ void Gambit_fn_02217344(CPUState* cpu) {
         /* 02217354 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02217354 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02217358 */ cpu->r[12] = 0x00000000u;
-        /* 0221735C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221735C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02217360 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 02217360 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02217364 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217364 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217364 */ _t6 = _t5 & 0x00000001u;
         /* 02217364 */ if (_t6) goto L_0221738C; else goto L_02217368;
   L_02217368: ; // 0x2217368
         /* 02217368 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02217368 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0221736C */ /* nop */
-        /* 02217370 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 02217374 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217370 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 02217374 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217374 */ _t9 = _t8 & 0x00000001u;
         /* 02217374 */ if (_t9) goto L_02217378; else goto L_0221738C;
   L_02217378: ; // 0x2217378
@@ -24240,10 +24240,10 @@ void Gambit_fn_022173B0(CPUState* cpu) {
         /* 022173B8 */ _t1 = cpu->r[3] + 0x00000020u;
         /* 022173B8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 022173BC */ cpu->r[8] = cpu->r[0];
-        /* 022173C0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 022173C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 022173C4 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 022173C4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 022173C8 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022173C8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022173C8 */ _t4 = _t3 & 0x00000001u;
         /* 022173C8 */ if (_t4) goto L_022173CC; else goto L_022173E4;
   L_022173CC: ; // 0x22173cc
@@ -24251,8 +24251,8 @@ void Gambit_fn_022173B0(CPUState* cpu) {
         /* 022173D0 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 022173D4 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 022173D4 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 022173D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 022173DC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022173D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 022173DC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022173DC */ _t7 = _t6 & 0x00000001u;
         /* 022173DC */ if (_t7) goto L_022173E0; else goto L_022173F0;
   L_022173E0: ; // 0x22173e0
@@ -24260,16 +24260,16 @@ void Gambit_fn_022173B0(CPUState* cpu) {
   L_022173E4: ; // 0x22173e4
         /* 022173E4 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 022173E4 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 022173E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 022173EC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022173E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 022173EC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022173EC */ _t10 = _t9 & 0x00000001u;
         /* 022173EC */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022173EC */ goto L_022173F0;
   L_022173F0: ; // 0x22173f0
-        /* 022173F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 022173F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 022173F4 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 022173F4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 022173F8 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022173F8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022173F8 */ _t13 = _t12 & 0x00000001u;
         /* 022173F8 */ if (_t13) goto L_022173FC; else goto L_02217404;
   L_022173FC: ; // 0x22173fc
@@ -24280,11 +24280,11 @@ void Gambit_fn_022173B0(CPUState* cpu) {
         /* 02217404 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 02217408 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 02217408 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0221740C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221740C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02217410 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 02217410 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 02217414 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 02217418 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02217418 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02217418 */ _t18 = _t17 & 0x00000001u;
         /* 02217418 */ if (_t18) goto L_02217430; else goto L_0221741C;
   L_0221741C: ; // 0x221741c
@@ -24311,10 +24311,10 @@ void Gambit_fn_02217438(CPUState* cpu) {
         /* 02217440 */ _t1 = cpu->r[3] + 0x00000030u;
         /* 02217440 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 02217444 */ cpu->r[7] = cpu->r[0];
-        /* 02217448 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 02217448 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 0221744C */ _t2 = cpu->r[3] + 0x00000034u;
         /* 0221744C */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 02217450 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02217450 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02217450 */ _t4 = _t3 & 0x00000001u;
         /* 02217450 */ if (_t4) goto L_02217454; else goto L_0221746C;
   L_02217454: ; // 0x2217454
@@ -24322,8 +24322,8 @@ void Gambit_fn_02217438(CPUState* cpu) {
         /* 02217458 */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 0221745C */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0221745C */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 02217460 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02217464 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217460 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02217464 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217464 */ _t7 = _t6 & 0x00000001u;
         /* 02217464 */ if (_t7) goto L_02217468; else goto L_02217478;
   L_02217468: ; // 0x2217468
@@ -24331,16 +24331,16 @@ void Gambit_fn_02217438(CPUState* cpu) {
   L_0221746C: ; // 0x221746c
         /* 0221746C */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0221746C */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 02217470 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02217474 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217470 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02217474 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217474 */ _t10 = _t9 & 0x00000001u;
         /* 02217474 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02217474 */ goto L_02217478;
   L_02217478: ; // 0x2217478
-        /* 02217478 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 02217478 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 0221747C */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0221747C */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 02217480 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02217480 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02217480 */ _t13 = _t12 & 0x00000001u;
         /* 02217480 */ if (_t13) goto L_02217484; else goto L_0221748C;
   L_02217484: ; // 0x2217484
@@ -24351,11 +24351,11 @@ void Gambit_fn_02217438(CPUState* cpu) {
         /* 0221748C */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 02217490 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 02217490 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 02217494 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02217494 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02217498 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 02217498 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0221749C */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 022174A0 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022174A0 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022174A0 */ _t18 = _t17 & 0x00000001u;
         /* 022174A0 */ if (_t18) goto L_022174B8; else goto L_022174A4;
   L_022174A4: ; // 0x22174a4
@@ -24390,9 +24390,9 @@ void Gambit_fn_022174C0(CPUState* cpu) {
         /* 022174D8 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 022174D8 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 022174DC */ /* nop */
-        /* 022174E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 022174E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 022174E4 */ cpu->r[31] = cpu->r[4];
-        /* 022174E8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022174E8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022174E8 */ _t6 = _t5 & 0x00000001u;
         /* 022174E8 */ if (_t6) goto L_022174EC; else goto L_02217500;
   L_022174EC: ; // 0x22174ec
@@ -24441,9 +24441,9 @@ void Gambit_fn_022174C4(CPUState* cpu) {
         /* 022174D8 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 022174D8 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 022174DC */ /* nop */
-        /* 022174E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 022174E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 022174E4 */ cpu->r[31] = cpu->r[4];
-        /* 022174E8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022174E8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022174E8 */ _t6 = _t5 & 0x00000001u;
         /* 022174E8 */ if (_t6) goto L_022174EC; else goto L_02217500;
   L_022174EC: ; // 0x22174ec
@@ -24486,18 +24486,18 @@ void Gambit_fn_02217538(CPUState* cpu) {
         /* 02217540 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 02217540 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02217544 */ cpu->r[31] = cpu->r[3];
-        /* 02217544 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02217544 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02217548 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02217548 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0221754C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221754C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221754C */ _t4 = _t3 & 0x00000001u;
         /* 0221754C */ if (_t4) goto L_02217550; else goto L_02217560;
   L_02217550: ; // 0x2217550
         /* 02217550 */ cpu->r[3] = 0x00000174u;
         /* 02217554 */ Gambit_fn_02801A78(cpu);
         /* 02217558 */ cpu->r[31] = cpu->r[3];
-        /* 02217558 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0221755C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217558 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0221755C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221755C */ _t6 = _t5 & 0x00000001u;
         /* 0221755C */ if (_t6) goto L_02217574; else goto L_02217560;
   L_02217560: ; // 0x2217560
@@ -24529,18 +24529,18 @@ void Gambit_fn_0221753C(CPUState* cpu) {
         /* 02217540 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 02217540 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02217544 */ cpu->r[31] = cpu->r[3];
-        /* 02217544 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02217544 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02217548 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02217548 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0221754C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221754C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221754C */ _t4 = _t3 & 0x00000001u;
         /* 0221754C */ if (_t4) goto L_02217550; else goto L_02217560;
   L_02217550: ; // 0x2217550
         /* 02217550 */ cpu->r[3] = 0x00000174u;
         /* 02217554 */ Gambit_fn_02801A78(cpu);
         /* 02217558 */ cpu->r[31] = cpu->r[3];
-        /* 02217558 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0221755C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217558 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0221755C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221755C */ _t6 = _t5 & 0x00000001u;
         /* 0221755C */ if (_t6) goto L_02217574; else goto L_02217560;
   L_02217560: ; // 0x2217560
@@ -24912,7 +24912,7 @@ void Gambit_fn_022176E4(CPUState* cpu) {
         /* 02217788 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t22);
         /* 0221778C */ _t23 = cpu->r[1] + 0x00000008u;
         /* 0221778C */ cpu->r[30] = rbrew_read32(cpu->mem, _t23);
-        /* 02217790 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02217790 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02217790 */ _t25 = _t24 & 0x00000001u;
         /* 02217790 */ if (_t25) goto L_02217794; // else: addr-0 trap, fall-through
   L_02217794: ; // 0x2217794
@@ -24995,7 +24995,7 @@ void Gambit_fn_022176E8(CPUState* cpu) {
         /* 02217788 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t22);
         /* 0221778C */ _t23 = cpu->r[1] + 0x00000008u;
         /* 0221778C */ cpu->r[30] = rbrew_read32(cpu->mem, _t23);
-        /* 02217790 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02217790 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02217790 */ _t25 = _t24 & 0x00000001u;
         /* 02217790 */ if (_t25) goto L_02217794; // else: addr-0 trap, fall-through
   L_02217794: ; // 0x2217794
@@ -25062,8 +25062,8 @@ void Gambit_fn_022177C4(CPUState* cpu) {
         /* 022177C4 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 022177C4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 022177C8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 022177C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022177CC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022177C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022177CC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022177CC */ _t2 = _t1 & 0x00000001u;
         /* 022177CC */ _t3 = _t2 ^ 0x00000001u;
         /* 022177CC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -25085,8 +25085,8 @@ void Gambit_fn_022177E0(CPUState* cpu) {
         /* 022177E0 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 022177E0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 022177E4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 022177E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022177E8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022177E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022177E8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022177E8 */ _t2 = _t1 & 0x00000001u;
         /* 022177E8 */ _t3 = _t2 ^ 0x00000001u;
         /* 022177E8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -25108,8 +25108,8 @@ void Gambit_fn_022177FC(CPUState* cpu) {
         /* 022177FC */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 022177FC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02217800 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 02217800 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02217804 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217800 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02217804 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217804 */ _t2 = _t1 & 0x00000001u;
         /* 02217804 */ _t3 = _t2 ^ 0x00000001u;
         /* 02217804 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -25152,8 +25152,8 @@ void Gambit_fn_02217828(CPUState* cpu) {
         /* 02217838 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0221783C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0221783C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02217840 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02217844 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217840 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02217844 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217844 */ _t5 = _t4 & 0x00000001u;
         /* 02217844 */ if (_t5) goto L_02217848; else goto L_02217864;
   L_02217848: ; // 0x2217848
@@ -25192,8 +25192,8 @@ void Gambit_fn_0221782C(CPUState* cpu) {
         /* 02217838 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0221783C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0221783C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02217840 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02217844 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217840 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02217844 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217844 */ _t5 = _t4 & 0x00000001u;
         /* 02217844 */ if (_t5) goto L_02217848; else goto L_02217864;
   L_02217848: ; // 0x2217848
@@ -25654,8 +25654,8 @@ void Gambit_fn_02217A3C(CPUState* cpu) {
         /* 02217A3C */ _t0 = cpu->r[3] + 0x00000114u;
         /* 02217A3C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02217A40 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 02217A40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02217A44 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217A40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02217A44 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217A44 */ _t2 = _t1 & 0x00000001u;
         /* 02217A44 */ if (_t2) goto L_02217A54; else goto L_02217A48;
   L_02217A48: ; // 0x2217a48
@@ -25684,8 +25684,8 @@ void Gambit_fn_02217A60(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -25780,9 +25780,9 @@ void Gambit_fn_02217AB0(CPUState* cpu) {
         /* 02217AB4 */ _t0 = cpu->r[8] + 0xFFFFFD54u;
         /* 02217AB4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 02217AB8 */ cpu->r[6] = 0x101D0000u;
-        /* 02217ABC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02217ABC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02217AC0 */ cpu->r[6] = cpu->r[6] + 0xFFFFFD50u;
-        /* 02217AC4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217AC4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217AC4 */ _t2 = _t1 & 0x00000001u;
         /* 02217AC4 */ if (_t2) goto L_02217AC8; else goto L_02217AE0;
   L_02217AC8: ; // 0x2217ac8
@@ -25795,8 +25795,8 @@ void Gambit_fn_02217AB0(CPUState* cpu) {
         /* 02217ADC */ _t4 = cpu->r[6] + 0x00000000u;
         /* 02217ADC */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_02217AE0: ; // 0x2217ae0
-        /* 02217AE0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 02217AE4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217AE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 02217AE4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217AE4 */ _t6 = _t5 & 0x00000001u;
         /* 02217AE4 */ if (_t6) goto L_02217AE8; else goto L_02217AF0;
   L_02217AE8: ; // 0x2217ae8
@@ -25807,9 +25807,9 @@ void Gambit_fn_02217AB0(CPUState* cpu) {
         /* 02217AF4 */ _t7 = cpu->r[10] + 0xFFFFDA0Cu;
         /* 02217AF4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 02217AF8 */ cpu->r[8] = 0x101D0000u;
-        /* 02217AFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02217AFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02217B00 */ cpu->r[8] = cpu->r[8] + 0xFFFFFC00u;
-        /* 02217B04 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217B04 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217B04 */ _t9 = _t8 & 0x00000001u;
         /* 02217B04 */ if (_t9) goto L_02217B08; else goto L_02217B20;
   L_02217B08: ; // 0x2217b08
@@ -25822,8 +25822,8 @@ void Gambit_fn_02217AB0(CPUState* cpu) {
         /* 02217B1C */ _t11 = cpu->r[8] + 0x00000000u;
         /* 02217B1C */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_02217B20: ; // 0x2217b20
-        /* 02217B20 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02217B24 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217B20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02217B24 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217B24 */ _t13 = _t12 & 0x00000001u;
         /* 02217B24 */ if (_t13) goto L_02217B28; else goto L_02217B30;
   L_02217B28: ; // 0x2217b28
@@ -25834,9 +25834,9 @@ void Gambit_fn_02217AB0(CPUState* cpu) {
         /* 02217B34 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 02217B34 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 02217B38 */ cpu->r[10] = 0x101D0000u;
-        /* 02217B3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02217B3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02217B40 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 02217B44 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217B44 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217B44 */ _t16 = _t15 & 0x00000001u;
         /* 02217B44 */ if (_t16) goto L_02217B48; else goto L_02217B60;
   L_02217B48: ; // 0x2217b48
@@ -25849,8 +25849,8 @@ void Gambit_fn_02217AB0(CPUState* cpu) {
         /* 02217B5C */ _t18 = cpu->r[10] + 0x00000000u;
         /* 02217B5C */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_02217B60: ; // 0x2217b60
-        /* 02217B60 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02217B64 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217B60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02217B64 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217B64 */ _t20 = _t19 & 0x00000001u;
         /* 02217B64 */ if (_t20) goto L_02217B68; else goto L_02217B70;
   L_02217B68: ; // 0x2217b68
@@ -25861,9 +25861,9 @@ void Gambit_fn_02217AB0(CPUState* cpu) {
         /* 02217B74 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 02217B74 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 02217B78 */ cpu->r[12] = 0x101D0000u;
-        /* 02217B7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02217B7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02217B80 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 02217B84 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217B84 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217B84 */ _t23 = _t22 & 0x00000001u;
         /* 02217B84 */ if (_t23) goto L_02217B88; else goto L_02217BA0;
   L_02217B88: ; // 0x2217b88
@@ -25876,8 +25876,8 @@ void Gambit_fn_02217AB0(CPUState* cpu) {
         /* 02217B9C */ _t25 = cpu->r[12] + 0x00000000u;
         /* 02217B9C */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_02217BA0: ; // 0x2217ba0
-        /* 02217BA0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02217BA4 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217BA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02217BA4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217BA4 */ _t27 = _t26 & 0x00000001u;
         /* 02217BA4 */ if (_t27) goto L_02217BA8; else goto L_02217BB0;
   L_02217BA8: ; // 0x2217ba8
@@ -25889,9 +25889,9 @@ void Gambit_fn_02217AB0(CPUState* cpu) {
         /* 02217BB4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 02217BB4 */ cpu->r[10] = _t28;
         /* 02217BB8 */ cpu->r[7] = 0x101D0000u;
-        /* 02217BBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02217BBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02217BC0 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 02217BC4 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217BC4 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217BC4 */ _t30 = _t29 & 0x00000001u;
         /* 02217BC4 */ if (_t30) goto L_02217BC8; else goto L_02217BDC;
   L_02217BC8: ; // 0x2217bc8
@@ -25903,8 +25903,8 @@ void Gambit_fn_02217AB0(CPUState* cpu) {
         /* 02217BD8 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 02217BD8 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_02217BDC: ; // 0x2217bdc
-        /* 02217BDC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 02217BE0 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217BDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 02217BE0 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217BE0 */ _t34 = _t33 & 0x00000001u;
         /* 02217BE0 */ if (_t34) goto L_02217BE4; else goto L_02217BEC;
   L_02217BE4: ; // 0x2217be4
@@ -25916,9 +25916,9 @@ void Gambit_fn_02217AB0(CPUState* cpu) {
         /* 02217BF0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 02217BF0 */ cpu->r[8] = _t35;
         /* 02217BF4 */ cpu->r[6] = 0x101D0000u;
-        /* 02217BF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02217BF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02217BFC */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 02217C00 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217C00 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217C00 */ _t37 = _t36 & 0x00000001u;
         /* 02217C00 */ if (_t37) goto L_02217C04; else goto L_02217C18;
   L_02217C04: ; // 0x2217c04
@@ -25991,18 +25991,18 @@ void Gambit_fn_02217C5C(CPUState* cpu) {
         /* 02217C6C */ _t4 = cpu->r[1] + 0x00000010u;
         /* 02217C6C */ rbrew_write32(cpu->mem, _t4, cpu->r[30]);
         /* 02217C70 */ cpu->r[31] = cpu->r[3];
-        /* 02217C70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02217C70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02217C74 */ _t5 = cpu->r[1] + 0x0000001Cu;
         /* 02217C74 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
-        /* 02217C78 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217C78 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217C78 */ _t7 = _t6 & 0x00000001u;
         /* 02217C78 */ if (_t7) goto L_02217C7C; else goto L_02217C8C;
   L_02217C7C: ; // 0x2217c7c
         /* 02217C7C */ cpu->r[3] = 0x00000214u;
         /* 02217C80 */ Gambit_fn_02801A78(cpu);
         /* 02217C84 */ cpu->r[31] = cpu->r[3];
-        /* 02217C84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02217C88 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217C84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02217C88 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217C88 */ _t9 = _t8 & 0x00000001u;
         /* 02217C88 */ if (_t9) goto L_02217EE0; else goto L_02217C8C;
   L_02217C8C: ; // 0x2217c8c
@@ -26171,8 +26171,8 @@ void Gambit_fn_02217C5C(CPUState* cpu) {
         /* 02217DEC */ cpu->r[5] = 0x0000000Cu;
         /* 02217DF0 */ Gambit_fn_02C82E00(cpu);
         /* 02217DF4 */ cpu->r[8] = cpu->r[31] + 0x000001A4u;
-        /* 02217DF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02217DF8 */ _t76 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217DF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02217DF8 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217DF8 */ _t77 = _t76 & 0x00000001u;
         /* 02217DF8 */ if (_t77) goto L_02217DFC; else goto L_02217E04;
   L_02217DFC: ; // 0x2217dfc
@@ -26188,8 +26188,8 @@ void Gambit_fn_02217C5C(CPUState* cpu) {
         /* 02217E1C */ cpu->r[3] = cpu->r[31] + 0x000001F0u;
         /* 02217E20 */ Gambit_fn_02043B8C(cpu);
         /* 02217E24 */ cpu->r[0] = cpu->r[31] + 0x00000200u;
-        /* 02217E24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02217E28 */ _t78 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02217E24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02217E28 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02217E28 */ _t79 = _t78 & 0x00000001u;
         /* 02217E28 */ if (_t79) goto L_02217E2C; else goto L_02217E34;
   L_02217E2C: ; // 0x2217e2c
@@ -26478,7 +26478,7 @@ void Gambit_fn_02217F04(CPUState* cpu) {
         /* 02218090 */ cpu->r[11] = cpu->r[28] - cpu->r[10];
         /* 02218094 */ _t66 = cpu->r[30] + 0x000000E4u;
         /* 02218094 */ rbrew_write_f32(cpu->mem, _t66, cpu->f[7]);
-        /* 02218098 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000002u);
+        /* 02218098 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000002u));
         /* 0221809C */ _t67 = cpu->r[30] + 0x0000020Cu;
         /* 0221809C */ rbrew_write32(cpu->mem, _t67, cpu->r[4]);
         /* 022180A0 */ cpu->r[6] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000000Cu, 0x00000003u);
@@ -26488,17 +26488,17 @@ void Gambit_fn_02217F04(CPUState* cpu) {
         /* 022180A8 */ rbrew_write32(cpu->mem, _t69, cpu->r[6]);
         /* 022180AC */ _t70 = cpu->r[30] + 0x0000020Du;
         /* 022180AC */ rbrew_write8(cpu->mem, _t70, (uint8_t)cpu->r[26]);
-        /* 022180B0 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022180B0 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022180B0 */ _t72 = _t71 & 0x00000001u;
         /* 022180B0 */ if (_t72) goto L_022180BC; else goto L_022180B4;
   L_022180B4: ; // 0x22180b4
-        /* 022180B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000003u);
-        /* 022180B8 */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022180B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000003u));
+        /* 022180B8 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022180B8 */ _t74 = _t73 & 0x00000001u;
         /* 022180B8 */ if (_t74) goto L_022180BC; else goto L_02218300;
   L_022180BC: ; // 0x22180bc
-        /* 022180BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000001u);
-        /* 022180C0 */ _t75 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022180BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000001u));
+        /* 022180C0 */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022180C0 */ _t76 = _t75 & 0x00000001u;
         /* 022180C0 */ if (_t76) goto L_022180C4; else goto L_02218110;
   L_022180C4: ; // 0x22180c4
@@ -26637,10 +26637,10 @@ void Gambit_fn_02217F04(CPUState* cpu) {
         /* 02218208 */ /* nop */
         /* 0221820C */ cpu->r[7] = 0x00000000u;
         /* 02218210 */ cpu->r[4] = cpu->r[31];
-        /* 02218210 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 02218210 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 02218214 */ _t127 = cpu->r[1] + 0x00000010u;
         /* 02218214 */ rbrew_write_f32(cpu->mem, _t127, cpu->f[10]);
-        /* 02218218 */ _t128 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218218 */ _t128 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218218 */ _t129 = _t128 & 0x00000001u;
         /* 02218218 */ if (_t129) goto L_0221821C; else goto L_022182E8;
   L_0221821C: ; // 0x221821c
@@ -26660,12 +26660,12 @@ void Gambit_fn_02217F04(CPUState* cpu) {
         /* 0221823C */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t132);
         /* 02218240 */ _t133 = cpu->r[5] + 0x00000004u;
         /* 02218240 */ rbrew_write_f32(cpu->mem, _t133, cpu->f[12]);
-        /* 02218244 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x00000005u);
+        /* 02218244 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x00000005u));
         /* 02218248 */ _t134 = cpu->r[5] + 0x00000008u;
         /* 02218248 */ rbrew_write_f32(cpu->mem, _t134, cpu->f[10]);
         /* 0221824C */ _t135 = cpu->r[1] + 0x00000008u;
         /* 0221824C */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t135);
-        /* 02218250 */ _t136 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02218250 */ _t136 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02218250 */ _t137 = _t136 & 0x00000001u;
         /* 02218250 */ if (_t137) goto L_02218254; else goto L_022182A8;
   L_02218254: ; // 0x2218254
@@ -26690,16 +26690,16 @@ void Gambit_fn_02217F04(CPUState* cpu) {
         /* 02218280 */ /* nop */
         /* 02218284 */ cpu->r[10] = cpu->r[10] + 0x0000000Cu;
         /* 02218288 */ cpu->r[4] = cpu->r[4] + 0xFFFFFFFFu;
-        /* 02218288 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 02218288 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 0221828C */ cpu->r[7] = cpu->r[7] + 0x00000001u;
         /* 02218290 */ _t145 = cpu->r[1] + 0x00000010u;
         /* 02218290 */ rbrew_write_f32(cpu->mem, _t145, cpu->f[10]);
-        /* 02218294 */ _t146 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02218294 */ _t146 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02218294 */ _t147 = _t146 & 0x00000001u;
         /* 02218294 */ if (_t147) goto L_022182E8; else goto L_02218298;
   L_02218298: ; // 0x2218298
-        /* 02218298 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x00000005u);
-        /* 0221829C */ _t148 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02218298 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x00000005u));
+        /* 0221829C */ _t148 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221829C */ _t149 = _t148 & 0x00000001u;
         /* 0221829C */ if (_t149) goto L_0221822C; else goto L_022182A0;
   L_022182A0: ; // 0x22182a0
@@ -26726,11 +26726,11 @@ void Gambit_fn_02217F04(CPUState* cpu) {
         /* 022182D0 */ /* nop */
         /* 022182D4 */ cpu->r[10] = cpu->r[10] + 0x0000000Cu;
         /* 022182D8 */ cpu->r[4] = cpu->r[4] + 0xFFFFFFFFu;
-        /* 022182D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 022182D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 022182DC */ cpu->r[7] = cpu->r[7] + 0x00000001u;
         /* 022182E0 */ _t157 = cpu->r[1] + 0x00000010u;
         /* 022182E0 */ rbrew_write_f32(cpu->mem, _t157, cpu->f[10]);
-        /* 022182E4 */ _t158 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022182E4 */ _t158 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022182E4 */ _t159 = _t158 & 0x00000001u;
         /* 022182E4 */ if (_t159) goto L_022182E8; else goto L_02218298;
   L_022182E8: ; // 0x22182e8
@@ -382,9 +382,9 @@ void Gambit_fn_022184F4(CPUState* cpu) {
         /* 02218504 */ cpu->r[4] = cpu->r[11] + 0x00000118u;
         /* 02218508 */ goto L_026C06AC;
   L_026C0690: ; // 0x26c0690
-        /* 026C0690 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x0000000Eu);
+        /* 026C0690 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x0000000Eu));
         /* 026C0694 */ cpu->r[12] = cpu->r[3] + 0x000003E4u;
-        /* 026C0698 */ _t2 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 026C0698 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 026C0698 */ _t3 = _t2 & 0x00000001u;
         /* 026C0698 */ if (_t3) goto L_026C069C; else goto L_026C06A4;
   L_026C069C: ; // 0x26c069c
@@ -548,9 +548,9 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02218624 */ _t38 = cpu->r[31] + 0x00000120u;
         /* 02218624 */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 02218628 */ cpu->r[6] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x00000000u, 0x00000000u);
-        /* 02218628 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02218628 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 0221862C */ cpu->r[28] = cpu->r[4];
-        /* 02218630 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02218630 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02218630 */ _t40 = _t39 & 0x00000001u;
         /* 02218630 */ if (_t40) goto L_02218688; else goto L_02218634;
   L_02218634: ; // 0x2218634
@@ -674,10 +674,10 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02218720 */ cpu->r[15] = 0x00000000u;
         /* 02218724 */ _t97 = cpu->r[1] + 0x0000014Cu;
         /* 02218724 */ rbrew_write32(cpu->mem, _t97, cpu->r[6]);
-        /* 02218728 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000001u);
+        /* 02218728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000001u));
         /* 0221872C */ _t98 = cpu->r[1] + 0x00000150u;
         /* 0221872C */ rbrew_write32(cpu->mem, _t98, cpu->r[7]);
-        /* 02218730 */ _t99 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218730 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218730 */ _t100 = _t99 & 0x00000001u;
         /* 02218730 */ if (_t100) goto L_02218734; else goto L_022188C4;
   L_02218734: ; // 0x2218734
@@ -837,10 +837,10 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 022188AC */ rbrew_write_f32(cpu->mem, _t159, cpu->f[6]);
         /* 022188B0 */ _t160 = cpu->r[31] + 0x000000DCu;
         /* 022188B0 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t160);
-        /* 022188B4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[13]);
+        /* 022188B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[13]));
         /* 022188B8 */ _t161 = cpu->r[1] + 0x00000098u;
         /* 022188B8 */ rbrew_write_f32(cpu->mem, _t161, cpu->f[8]);
-        /* 022188BC */ _t162 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022188BC */ _t162 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022188BC */ _t163 = _t162 & 0x00000001u;
         /* 022188BC */ if (_t163) goto L_022188C0; else goto L_02218914;
   L_022188C0: ; // 0x22188c0
@@ -864,7 +864,7 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 022188E0 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t171);
         /* 022188E4 */ _t172 = cpu->r[1] + 0x0000009Cu;
         /* 022188E4 */ rbrew_write_f32(cpu->mem, _t172, cpu->f[12]);
-        /* 022188E8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[13]);
+        /* 022188E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[13]));
         /* 022188EC */ _t173 = cpu->r[1] + 0x000000A4u;
         /* 022188EC */ rbrew_write_f32(cpu->mem, _t173, cpu->f[0]);
         /* 022188F0 */ _t174 = cpu->r[29] + 0x00000000u;
@@ -875,7 +875,7 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 022188F8 */ rbrew_write_f32(cpu->mem, _t176, cpu->f[8]);
         /* 022188FC */ _t177 = cpu->r[1] + 0x00000098u;
         /* 022188FC */ rbrew_write_f32(cpu->mem, _t177, cpu->f[11]);
-        /* 02218900 */ _t178 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02218900 */ _t178 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02218900 */ _t179 = _t178 & 0x00000001u;
         /* 02218900 */ if (_t179) goto L_02218904; else goto L_02218914;
   L_02218904: ; // 0x2218904
@@ -883,8 +883,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02218904 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t180);
         /* 02218908 */ _t181 = cpu->r[31] + 0x000000E0u;
         /* 02218908 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t181);
-        /* 0221890C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[12]);
-        /* 02218910 */ _t182 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221890C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[12]));
+        /* 02218910 */ _t182 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02218910 */ _t183 = _t182 & 0x00000001u;
         /* 02218910 */ if (_t183) goto L_0221893C; else goto L_02218914;
   L_02218914: ; // 0x2218914
@@ -907,8 +907,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 0221893C */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t188);
         /* 02218940 */ _t189 = cpu->r[31] + 0x000000F0u;
         /* 02218940 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t189);
-        /* 02218944 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[11]);
-        /* 02218948 */ _t190 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02218944 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[11]));
+        /* 02218948 */ _t190 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02218948 */ _t191 = _t190 & 0x00000001u;
         /* 02218948 */ if (_t191) goto L_0221894C; else goto L_02218968;
   L_0221894C: ; // 0x221894c
@@ -916,12 +916,12 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 0221894C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t192);
         /* 02218950 */ _t193 = cpu->r[1] + 0x00000084u;
         /* 02218950 */ rbrew_write_f32(cpu->mem, _t193, cpu->f[13]);
-        /* 02218954 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
+        /* 02218954 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
         /* 02218958 */ _t194 = cpu->r[1] + 0x0000008Cu;
         /* 02218958 */ rbrew_write_f32(cpu->mem, _t194, cpu->f[11]);
         /* 0221895C */ _t195 = cpu->r[1] + 0x00000088u;
         /* 0221895C */ rbrew_write_f32(cpu->mem, _t195, cpu->f[12]);
-        /* 02218960 */ _t196 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02218960 */ _t196 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02218960 */ _t197 = _t196 & 0x00000001u;
         /* 02218960 */ if (_t197) goto L_02218964; else goto L_022189C4;
   L_02218964: ; // 0x2218964
@@ -939,24 +939,24 @@ void Gambit_fn_02218530(CPUState* cpu) {
   L_02218984: ; // 0x2218984
         /* 02218984 */ _t200 = cpu->r[30] + 0x00000000u;
         /* 02218984 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t200);
-        /* 02218988 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
+        /* 02218988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
         /* 0221898C */ _t201 = cpu->r[1] + 0x0000008Cu;
         /* 0221898C */ rbrew_write_f32(cpu->mem, _t201, cpu->f[11]);
-        /* 02218990 */ _t202 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02218990 */ _t202 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02218990 */ _t203 = _t202 & 0x00000001u;
         /* 02218990 */ if (_t203) goto L_02218994; else goto L_022189C4;
   L_02218994: ; // 0x2218994
         /* 02218994 */ _t204 = cpu->r[30] + 0x00000004u;
         /* 02218994 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t204);
-        /* 02218998 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[6]);
-        /* 0221899C */ _t205 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02218998 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[6]));
+        /* 0221899C */ _t205 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221899C */ _t206 = _t205 & 0x00000001u;
         /* 0221899C */ if (_t206) goto L_022189A0; else goto L_022189C4;
   L_022189A0: ; // 0x22189a0
         /* 022189A0 */ _t207 = cpu->r[30] + 0x00000008u;
         /* 022189A0 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t207);
-        /* 022189A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[7]);
-        /* 022189A8 */ _t208 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022189A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[7]));
+        /* 022189A8 */ _t208 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022189A8 */ _t209 = _t208 & 0x00000001u;
         /* 022189A8 */ if (_t209) goto L_022189AC; else goto L_022189C4;
   L_022189AC: ; // 0x22189ac
@@ -979,8 +979,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 022189D0 */ cpu->f[9] = fma(cpu->f[11], cpu->f[11], cpu->f[9]);
         /* 022189D4 */ _t216 = cpu->r[12] + 0xFFFFBE2Cu;
         /* 022189D4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t216);
-        /* 022189D8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[10]);
-        /* 022189DC */ _t217 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022189D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[10]));
+        /* 022189DC */ _t217 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022189DC */ _t218 = _t217 & 0x00000001u;
         /* 022189DC */ if (_t218) goto L_022189E0; else goto L_02218A1C;
   L_022189E0: ; // 0x22189e0
@@ -1060,11 +1060,11 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02218AA0 */ cpu->r[30] = 0x00000000u;
         /* 02218AA4 */ _t243 = cpu->r[1] + 0x00000008u;
         /* 02218AA4 */ rbrew_write_f32(cpu->mem, _t243, cpu->f[7]);
-        /* 02218AA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[5]);
+        /* 02218AA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[5]));
         /* 02218AAC */ cpu->r[20] = cpu->r[31] + 0x00000124u;
         /* 02218AB0 */ _t244 = cpu->r[1] + 0x0000000Cu;
         /* 02218AB0 */ rbrew_write_f32(cpu->mem, _t244, cpu->f[6]);
-        /* 02218AB4 */ _t245 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02218AB4 */ _t245 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02218AB4 */ _t246 = _t245 & 0x00000001u;
         /* 02218AB4 */ if (_t246) goto L_02218AF4; else goto L_02218AB8;
   L_02218AB8: ; // 0x2218ab8
@@ -1089,8 +1089,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02218AE0 */ rbrew_write_f32(cpu->mem, _t254, cpu->f[13]);
         /* 02218AE4 */ _t255 = cpu->r[12] + 0x00000000u;
         /* 02218AE4 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t255);
-        /* 02218AE8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[12]);
-        /* 02218AEC */ _t256 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218AE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[12]));
+        /* 02218AEC */ _t256 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218AEC */ _t257 = _t256 & 0x00000001u;
         /* 02218AEC */ if (_t257) goto L_022195B4; else goto L_02218AF0;
   L_02218AF0: ; // 0x2218af0
@@ -1175,7 +1175,7 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02218BB8 */ rbrew_write_f32(cpu->mem, _t283, cpu->f[21]);
         /* 02218BBC */ _t284 = cpu->r[1] + 0x0000003Cu;
         /* 02218BBC */ rbrew_write_f32(cpu->mem, _t284, cpu->f[21]);
-        /* 02218BC0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000005u);
+        /* 02218BC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000005u));
         /* 02218BC4 */ _t285 = cpu->r[1] + 0x0000004Cu;
         /* 02218BC4 */ rbrew_write_f32(cpu->mem, _t285, cpu->f[22]);
         /* 02218BC8 */ _t286 = cpu->r[1] + 0x00000058u;
@@ -1187,17 +1187,17 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02218BD4 */ rbrew_write_f32(cpu->mem, _t288, cpu->f[21]);
         /* 02218BD8 */ _t289 = cpu->r[1] + 0x00000064u;
         /* 02218BD8 */ rbrew_write_f32(cpu->mem, _t289, cpu->f[22]);
-        /* 02218BDC */ _t290 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02218BDC */ _t290 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02218BDC */ _t291 = _t290 & 0x00000001u;
         /* 02218BDC */ if (_t291) goto L_02218BE0; else goto L_02218BF8;
   L_02218BE0: ; // 0x2218be0
         /* 02218BE0 */ _t292 = cpu->r[20] + cpu->r[24];
         /* 02218BE0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t292);
-        /* 02218BE4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
+        /* 02218BE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
         /* 02218BE8 */ _t293 = cpu->r[1] + 0x00000040u;
         /* 02218BE8 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t293);
         /* 02218BEC */ cpu->r[4] = cpu->r[20] + cpu->r[24];
-        /* 02218BF0 */ _t294 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218BF0 */ _t294 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218BF0 */ _t295 = _t294 & 0x00000001u;
         /* 02218BF0 */ if (_t295) goto L_02218C0C; else goto L_02218BF4;
   L_02218BF4: ; // 0x2218bf4
@@ -1206,10 +1206,10 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02218BF8 */ cpu->r[4] = cpu->r[20];
         /* 02218BFC */ _t296 = cpu->r[4] + 0x00000000u;
         /* 02218BFC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t296);
-        /* 02218C00 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
+        /* 02218C00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
         /* 02218C04 */ _t297 = cpu->r[1] + 0x00000040u;
         /* 02218C04 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t297);
-        /* 02218C08 */ _t298 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218C08 */ _t298 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218C08 */ _t299 = _t298 & 0x00000001u;
         /* 02218C08 */ if (_t299) goto L_02218C0C; else goto L_02218C14;
   L_02218C0C: ; // 0x2218c0c
@@ -1220,10 +1220,10 @@ void Gambit_fn_02218530(CPUState* cpu) {
   L_02218C14: ; // 0x2218c14
         /* 02218C14 */ _t302 = cpu->r[4] + 0x00000004u;
         /* 02218C14 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t302);
-        /* 02218C18 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[13]);
+        /* 02218C18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[13]));
         /* 02218C1C */ _t303 = cpu->r[1] + 0x00000044u;
         /* 02218C1C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t303);
-        /* 02218C20 */ _t304 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218C20 */ _t304 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218C20 */ _t305 = _t304 & 0x00000001u;
         /* 02218C20 */ if (_t305) goto L_02218C24; else goto L_02218C2C;
   L_02218C24: ; // 0x2218c24
@@ -1234,8 +1234,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
   L_02218C2C: ; // 0x2218c2c
         /* 02218C2C */ _t308 = cpu->r[4] + 0x00000008u;
         /* 02218C2C */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t308);
-        /* 02218C30 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[6]);
-        /* 02218C34 */ _t309 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218C30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[6]));
+        /* 02218C34 */ _t309 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218C34 */ _t310 = _t309 & 0x00000001u;
         /* 02218C34 */ if (_t310) goto L_02218C38; else goto L_02218C40;
   L_02218C38: ; // 0x2218c38
@@ -1246,48 +1246,48 @@ void Gambit_fn_02218530(CPUState* cpu) {
   L_02218C40: ; // 0x2218c40
         /* 02218C40 */ _t313 = cpu->r[1] + 0x00000048u;
         /* 02218C40 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t313);
-        /* 02218C44 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[0]);
+        /* 02218C44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[0]));
         /* 02218C48 */ _t314 = cpu->r[1] + 0x0000004Cu;
         /* 02218C48 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t314);
-        /* 02218C4C */ _t315 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02218C4C */ _t315 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02218C4C */ _t316 = _t315 & 0x00000001u;
         /* 02218C4C */ if (_t316) goto L_02218C50; else goto L_02218C54;
   L_02218C50: ; // 0x2218c50
         /* 02218C50 */ _t317 = cpu->r[1] + 0x00000048u;
         /* 02218C50 */ rbrew_write_f32(cpu->mem, _t317, cpu->f[0]);
   L_02218C54: ; // 0x2218c54
-        /* 02218C54 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[13]);
+        /* 02218C54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[13]));
         /* 02218C58 */ _t318 = cpu->r[1] + 0x00000050u;
         /* 02218C58 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t318);
-        /* 02218C5C */ _t319 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02218C5C */ _t319 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02218C5C */ _t320 = _t319 & 0x00000001u;
         /* 02218C5C */ if (_t320) goto L_02218C60; else goto L_02218C64;
   L_02218C60: ; // 0x2218c60
         /* 02218C60 */ _t321 = cpu->r[1] + 0x0000004Cu;
         /* 02218C60 */ rbrew_write_f32(cpu->mem, _t321, cpu->f[13]);
   L_02218C64: ; // 0x2218c64
-        /* 02218C64 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[6]);
-        /* 02218C68 */ _t322 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02218C64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[6]));
+        /* 02218C68 */ _t322 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02218C68 */ _t323 = _t322 & 0x00000001u;
         /* 02218C68 */ if (_t323) goto L_02218C6C; else goto L_02218C70;
   L_02218C6C: ; // 0x2218c6c
         /* 02218C6C */ _t324 = cpu->r[1] + 0x00000050u;
         /* 02218C6C */ rbrew_write_f32(cpu->mem, _t324, cpu->f[6]);
   L_02218C70: ; // 0x2218c70
-        /* 02218C70 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000005u);
+        /* 02218C70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000005u));
         /* 02218C74 */ _t325 = cpu->r[1] + 0x00000054u;
         /* 02218C74 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t325);
-        /* 02218C78 */ _t326 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02218C78 */ _t326 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02218C78 */ _t327 = _t326 & 0x00000001u;
         /* 02218C78 */ if (_t327) goto L_02218C7C; else goto L_02218C94;
   L_02218C7C: ; // 0x2218c7c
         /* 02218C7C */ _t328 = cpu->r[19] + cpu->r[24];
         /* 02218C7C */ cpu->r[10] = rbrew_read32(cpu->mem, _t328);
-        /* 02218C80 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[10]);
+        /* 02218C80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[10]));
         /* 02218C84 */ _t329 = cpu->r[1] + 0x00000058u;
         /* 02218C84 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t329);
         /* 02218C88 */ cpu->r[5] = cpu->r[19] + cpu->r[24];
-        /* 02218C8C */ _t330 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218C8C */ _t330 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218C8C */ _t331 = _t330 & 0x00000001u;
         /* 02218C8C */ if (_t331) goto L_02218CA8; else goto L_02218C90;
   L_02218C90: ; // 0x2218c90
@@ -1296,10 +1296,10 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02218C94 */ cpu->r[5] = cpu->r[19];
         /* 02218C98 */ _t332 = cpu->r[5] + 0x00000000u;
         /* 02218C98 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t332);
-        /* 02218C9C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[10]);
+        /* 02218C9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[10]));
         /* 02218CA0 */ _t333 = cpu->r[1] + 0x00000058u;
         /* 02218CA0 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t333);
-        /* 02218CA4 */ _t334 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218CA4 */ _t334 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218CA4 */ _t335 = _t334 & 0x00000001u;
         /* 02218CA4 */ if (_t335) goto L_02218CA8; else goto L_02218CB0;
   L_02218CA8: ; // 0x2218ca8
@@ -1310,10 +1310,10 @@ void Gambit_fn_02218530(CPUState* cpu) {
   L_02218CB0: ; // 0x2218cb0
         /* 02218CB0 */ _t338 = cpu->r[5] + 0x00000004u;
         /* 02218CB0 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t338);
-        /* 02218CB4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[7]);
+        /* 02218CB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[7]));
         /* 02218CB8 */ _t339 = cpu->r[1] + 0x0000005Cu;
         /* 02218CB8 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t339);
-        /* 02218CBC */ _t340 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218CBC */ _t340 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218CBC */ _t341 = _t340 & 0x00000001u;
         /* 02218CBC */ if (_t341) goto L_02218CC0; else goto L_02218CC8;
   L_02218CC0: ; // 0x2218cc0
@@ -1324,8 +1324,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
   L_02218CC8: ; // 0x2218cc8
         /* 02218CC8 */ _t344 = cpu->r[5] + 0x00000008u;
         /* 02218CC8 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t344);
-        /* 02218CCC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[8]);
-        /* 02218CD0 */ _t345 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218CCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[8]));
+        /* 02218CD0 */ _t345 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218CD0 */ _t346 = _t345 & 0x00000001u;
         /* 02218CD0 */ if (_t346) goto L_02218CD4; else goto L_02218CDC;
   L_02218CD4: ; // 0x2218cd4
@@ -1336,32 +1336,32 @@ void Gambit_fn_02218530(CPUState* cpu) {
   L_02218CDC: ; // 0x2218cdc
         /* 02218CDC */ _t349 = cpu->r[1] + 0x00000060u;
         /* 02218CDC */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t349);
-        /* 02218CE0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[10]);
+        /* 02218CE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[10]));
         /* 02218CE4 */ _t350 = cpu->r[1] + 0x00000064u;
         /* 02218CE4 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t350);
-        /* 02218CE8 */ _t351 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02218CE8 */ _t351 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02218CE8 */ _t352 = _t351 & 0x00000001u;
         /* 02218CE8 */ if (_t352) goto L_02218CEC; else goto L_02218CF0;
   L_02218CEC: ; // 0x2218cec
         /* 02218CEC */ _t353 = cpu->r[1] + 0x00000060u;
         /* 02218CEC */ rbrew_write_f32(cpu->mem, _t353, cpu->f[10]);
   L_02218CF0: ; // 0x2218cf0
-        /* 02218CF0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[7]);
+        /* 02218CF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[7]));
         /* 02218CF4 */ _t354 = cpu->r[1] + 0x00000068u;
         /* 02218CF4 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t354);
-        /* 02218CF8 */ _t355 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02218CF8 */ _t355 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02218CF8 */ _t356 = _t355 & 0x00000001u;
         /* 02218CF8 */ if (_t356) goto L_02218CFC; else goto L_02218D00;
   L_02218CFC: ; // 0x2218cfc
         /* 02218CFC */ _t357 = cpu->r[1] + 0x00000064u;
         /* 02218CFC */ rbrew_write_f32(cpu->mem, _t357, cpu->f[7]);
   L_02218D00: ; // 0x2218d00
-        /* 02218D00 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[8]);
+        /* 02218D00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[8]));
         /* 02218D04 */ _t358 = cpu->r[1] + 0x00000084u;
         /* 02218D04 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t358);
         /* 02218D08 */ _t359 = cpu->r[25] + 0x00000000u;
         /* 02218D08 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t359);
-        /* 02218D0C */ _t360 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02218D0C */ _t360 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02218D0C */ _t361 = _t360 & 0x00000001u;
         /* 02218D0C */ if (_t361) goto L_02218D10; else goto L_02218D14;
   L_02218D10: ; // 0x2218d10
@@ -1386,14 +1386,14 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02218D30 */ rbrew_write32(cpu->mem, _t370, cpu->r[6]);
         /* 02218D34 */ _t371 = cpu->r[1] + 0x000000A4u;
         /* 02218D34 */ cpu->r[12] = rbrew_read32(cpu->mem, _t371);
-        /* 02218D38 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[6]);
+        /* 02218D38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[6]));
         /* 02218D3C */ _t372 = cpu->r[1] + 0x00000070u;
         /* 02218D3C */ rbrew_write32(cpu->mem, _t372, cpu->r[11]);
         /* 02218D40 */ _t373 = cpu->r[1] + 0x00000074u;
         /* 02218D40 */ rbrew_write32(cpu->mem, _t373, cpu->r[12]);
         /* 02218D44 */ _t374 = cpu->r[1] + 0x00000080u;
         /* 02218D44 */ rbrew_write32(cpu->mem, _t374, cpu->r[8]);
-        /* 02218D48 */ _t375 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02218D48 */ _t375 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02218D48 */ _t376 = _t375 & 0x00000001u;
         /* 02218D48 */ if (_t376) goto L_02218D4C; else goto L_02218D6C;
   L_02218D4C: ; // 0x2218d4c
@@ -1401,8 +1401,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02218D4C */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t377);
         /* 02218D50 */ _t378 = cpu->r[25] + 0x00000004u;
         /* 02218D50 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t378);
-        /* 02218D54 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[8]);
-        /* 02218D58 */ _t379 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02218D54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[8]));
+        /* 02218D58 */ _t379 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02218D58 */ _t380 = _t379 & 0x00000001u;
         /* 02218D58 */ if (_t380) goto L_02218D5C; else goto L_02218D6C;
   L_02218D5C: ; // 0x2218d5c
@@ -1410,8 +1410,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02218D5C */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t381);
         /* 02218D60 */ _t382 = cpu->r[25] + 0x00000008u;
         /* 02218D60 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t382);
-        /* 02218D64 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[10]);
-        /* 02218D68 */ _t383 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02218D64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[10]));
+        /* 02218D68 */ _t383 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02218D68 */ _t384 = _t383 & 0x00000001u;
         /* 02218D68 */ if (_t384) goto L_022190D4; else goto L_02218D6C;
   L_02218D6C: ; // 0x2218d6c
@@ -1551,14 +1551,14 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02218EB8 */ cpu->f[14] = fma(cpu->f[28], cpu->f[28], cpu->f[9]);
         /* 02218EBC */ /* nop */
         /* 02218EC0 */ Gambit_fn_02C693A4(cpu);
-        /* 02218EC4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[14], cpu->f[26]);
+        /* 02218EC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[14], cpu->f[26]));
         /* 02218EC8 */ cpu->f[0] = cpu->f[1];
-        /* 02218ECC */ _t435 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218ECC */ _t435 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218ECC */ _t436 = _t435 & 0x00000001u;
         /* 02218ECC */ if (_t436) goto L_02218ED0; else goto L_02218FE0;
   L_02218ED0: ; // 0x2218ed0
-        /* 02218ED0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[14], cpu->f[27]);
-        /* 02218ED4 */ _t437 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218ED0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[14], cpu->f[27]));
+        /* 02218ED4 */ _t437 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218ED4 */ _t438 = _t437 & 0x00000001u;
         /* 02218ED4 */ if (_t438) goto L_02218ED8; else goto L_02218F20;
   L_02218ED8: ; // 0x2218ed8
@@ -1616,8 +1616,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02218F74 */ _t450 = cpu->r[1] + 0x000000C0u;
         /* 02218F74 */ rbrew_write_f32(cpu->mem, _t450, cpu->f[29]);
         /* 02218F78 */ Gambit_fn_02C693A4(cpu);
-        /* 02218F7C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[26]);
-        /* 02218F80 */ _t451 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218F7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[26]));
+        /* 02218F80 */ _t451 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218F80 */ _t452 = _t451 & 0x00000001u;
         /* 02218F80 */ if (_t452) goto L_02219074; else goto L_02218F84;
   L_02218F84: ; // 0x2218f84
@@ -1707,13 +1707,13 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02219064 */ _t479 = cpu->r[1] + 0x000000C0u;
         /* 02219064 */ rbrew_write_f32(cpu->mem, _t479, cpu->f[29]);
         /* 02219068 */ Gambit_fn_02C693A4(cpu);
-        /* 0221906C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[26]);
-        /* 02219070 */ _t480 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221906C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[26]));
+        /* 02219070 */ _t480 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02219070 */ _t481 = _t480 & 0x00000001u;
         /* 02219070 */ if (_t481) goto L_02219074; else goto L_02218F84;
   L_02219074: ; // 0x2219074
-        /* 02219074 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[27]);
-        /* 02219078 */ _t482 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02219074 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[27]));
+        /* 02219078 */ _t482 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02219078 */ _t483 = _t482 & 0x00000001u;
         /* 02219078 */ if (_t483) goto L_0221907C; else goto L_022190B4;
   L_0221907C: ; // 0x221907c
@@ -1754,10 +1754,10 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 022190D8 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t492);
         /* 022190DC */ _t493 = cpu->r[1] + 0x0000007Cu;
         /* 022190DC */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t493);
-        /* 022190E0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[13]);
+        /* 022190E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[13]));
         /* 022190E4 */ _t494 = cpu->r[1] + 0x00000040u;
         /* 022190E4 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t494);
-        /* 022190E8 */ _t495 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022190E8 */ _t495 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022190E8 */ _t496 = _t495 & 0x00000001u;
         /* 022190E8 */ if (_t496) goto L_022190EC; else goto L_022190F4;
   L_022190EC: ; // 0x22190ec
@@ -1766,12 +1766,12 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 022190F0 */ _t498 = cpu->r[1] + 0x00000078u;
         /* 022190F0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t498);
   L_022190F4: ; // 0x22190f4
-        /* 022190F4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[9]);
+        /* 022190F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[9]));
         /* 022190F8 */ _t499 = cpu->r[1] + 0x00000044u;
         /* 022190F8 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t499);
         /* 022190FC */ _t500 = cpu->r[1] + 0x00000080u;
         /* 022190FC */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t500);
-        /* 02219100 */ _t501 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02219100 */ _t501 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02219100 */ _t502 = _t501 & 0x00000001u;
         /* 02219100 */ if (_t502) goto L_02219104; else goto L_0221910C;
   L_02219104: ; // 0x2219104
@@ -1780,8 +1780,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02219108 */ _t504 = cpu->r[1] + 0x0000007Cu;
         /* 02219108 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t504);
   L_0221910C: ; // 0x221910c
-        /* 0221910C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[7]);
-        /* 02219110 */ _t505 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221910C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[7]));
+        /* 02219110 */ _t505 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02219110 */ _t506 = _t505 & 0x00000001u;
         /* 02219110 */ if (_t506) goto L_02219114; else goto L_0221911C;
   L_02219114: ; // 0x2219114
@@ -1792,44 +1792,44 @@ void Gambit_fn_02218530(CPUState* cpu) {
   L_0221911C: ; // 0x221911c
         /* 0221911C */ _t509 = cpu->r[1] + 0x00000048u;
         /* 0221911C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t509);
-        /* 02219120 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[13]);
+        /* 02219120 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[13]));
         /* 02219124 */ _t510 = cpu->r[1] + 0x0000004Cu;
         /* 02219124 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t510);
-        /* 02219128 */ _t511 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219128 */ _t511 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219128 */ _t512 = _t511 & 0x00000001u;
         /* 02219128 */ if (_t512) goto L_0221912C; else goto L_02219130;
   L_0221912C: ; // 0x221912c
         /* 0221912C */ _t513 = cpu->r[1] + 0x00000048u;
         /* 0221912C */ rbrew_write_f32(cpu->mem, _t513, cpu->f[13]);
   L_02219130: ; // 0x2219130
-        /* 02219130 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[9]);
+        /* 02219130 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[9]));
         /* 02219134 */ _t514 = cpu->r[1] + 0x00000050u;
         /* 02219134 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t514);
-        /* 02219138 */ _t515 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219138 */ _t515 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219138 */ _t516 = _t515 & 0x00000001u;
         /* 02219138 */ if (_t516) goto L_0221913C; else goto L_02219140;
   L_0221913C: ; // 0x221913c
         /* 0221913C */ _t517 = cpu->r[1] + 0x0000004Cu;
         /* 0221913C */ rbrew_write_f32(cpu->mem, _t517, cpu->f[9]);
   L_02219140: ; // 0x2219140
-        /* 02219140 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[7]);
+        /* 02219140 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[7]));
         /* 02219144 */ _t518 = cpu->r[1] + 0x0000006Cu;
         /* 02219144 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t518);
         /* 02219148 */ _t519 = cpu->r[1] + 0x00000054u;
         /* 02219148 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t519);
-        /* 0221914C */ _t520 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221914C */ _t520 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221914C */ _t521 = _t520 & 0x00000001u;
         /* 0221914C */ if (_t521) goto L_02219150; else goto L_02219154;
   L_02219150: ; // 0x2219150
         /* 02219150 */ _t522 = cpu->r[1] + 0x00000050u;
         /* 02219150 */ rbrew_write_f32(cpu->mem, _t522, cpu->f[7]);
   L_02219154: ; // 0x2219154
-        /* 02219154 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[6]);
+        /* 02219154 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[6]));
         /* 02219158 */ _t523 = cpu->r[1] + 0x00000070u;
         /* 02219158 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t523);
         /* 0221915C */ _t524 = cpu->r[1] + 0x00000058u;
         /* 0221915C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t524);
-        /* 02219160 */ _t525 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02219160 */ _t525 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02219160 */ _t526 = _t525 & 0x00000001u;
         /* 02219160 */ if (_t526) goto L_02219164; else goto L_0221916C;
   L_02219164: ; // 0x2219164
@@ -1838,12 +1838,12 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02219168 */ _t528 = cpu->r[1] + 0x0000006Cu;
         /* 02219168 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t528);
   L_0221916C: ; // 0x221916c
-        /* 0221916C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[12]);
+        /* 0221916C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[12]));
         /* 02219170 */ _t529 = cpu->r[1] + 0x00000074u;
         /* 02219170 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t529);
         /* 02219174 */ _t530 = cpu->r[1] + 0x0000005Cu;
         /* 02219174 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t530);
-        /* 02219178 */ _t531 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02219178 */ _t531 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02219178 */ _t532 = _t531 & 0x00000001u;
         /* 02219178 */ if (_t532) goto L_0221917C; else goto L_02219184;
   L_0221917C: ; // 0x221917c
@@ -1852,8 +1852,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02219180 */ _t534 = cpu->r[1] + 0x00000070u;
         /* 02219180 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t534);
   L_02219184: ; // 0x2219184
-        /* 02219184 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[11]);
-        /* 02219188 */ _t535 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02219184 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[11]));
+        /* 02219188 */ _t535 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02219188 */ _t536 = _t535 & 0x00000001u;
         /* 02219188 */ if (_t536) goto L_0221918C; else goto L_02219194;
   L_0221918C: ; // 0x221918c
@@ -1864,38 +1864,38 @@ void Gambit_fn_02218530(CPUState* cpu) {
   L_02219194: ; // 0x2219194
         /* 02219194 */ _t539 = cpu->r[1] + 0x00000060u;
         /* 02219194 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t539);
-        /* 02219198 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[6]);
+        /* 02219198 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[6]));
         /* 0221919C */ _t540 = cpu->r[1] + 0x00000064u;
         /* 0221919C */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t540);
-        /* 022191A0 */ _t541 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022191A0 */ _t541 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022191A0 */ _t542 = _t541 & 0x00000001u;
         /* 022191A0 */ if (_t542) goto L_022191A4; else goto L_022191A8;
   L_022191A4: ; // 0x22191a4
         /* 022191A4 */ _t543 = cpu->r[1] + 0x00000060u;
         /* 022191A4 */ rbrew_write_f32(cpu->mem, _t543, cpu->f[6]);
   L_022191A8: ; // 0x22191a8
-        /* 022191A8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[12]);
+        /* 022191A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[12]));
         /* 022191AC */ _t544 = cpu->r[1] + 0x00000068u;
         /* 022191AC */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t544);
-        /* 022191B0 */ _t545 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022191B0 */ _t545 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022191B0 */ _t546 = _t545 & 0x00000001u;
         /* 022191B0 */ if (_t546) goto L_022191B4; else goto L_022191B8;
   L_022191B4: ; // 0x22191b4
         /* 022191B4 */ _t547 = cpu->r[1] + 0x00000064u;
         /* 022191B4 */ rbrew_write_f32(cpu->mem, _t547, cpu->f[12]);
   L_022191B8: ; // 0x22191b8
-        /* 022191B8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[11]);
-        /* 022191BC */ _t548 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022191B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[11]));
+        /* 022191BC */ _t548 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022191BC */ _t549 = _t548 & 0x00000001u;
         /* 022191BC */ if (_t549) goto L_022191C0; else goto L_022191C4;
   L_022191C0: ; // 0x22191c0
         /* 022191C0 */ _t550 = cpu->r[1] + 0x00000068u;
         /* 022191C0 */ rbrew_write_f32(cpu->mem, _t550, cpu->f[11]);
   L_022191C4: ; // 0x22191c4
-        /* 022191C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000005u);
+        /* 022191C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000005u));
         /* 022191C8 */ _t551 = cpu->r[1] + 0x00000078u;
         /* 022191C8 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t551);
-        /* 022191CC */ _t552 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022191CC */ _t552 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022191CC */ _t553 = _t552 & 0x00000001u;
         /* 022191CC */ if (_t553) goto L_022191D0; else goto L_022191F8;
   L_022191D0: ; // 0x22191d0
@@ -1908,12 +1908,12 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 022191DC */ rbrew_write_f32(cpu->mem, _t556, cpu->f[12]);
         /* 022191E0 */ _t557 = cpu->r[1] + 0x00000080u;
         /* 022191E0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t557);
-        /* 022191E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000005u);
+        /* 022191E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000005u));
         /* 022191E8 */ _t558 = cpu->r[10] + 0x00000008u;
         /* 022191E8 */ rbrew_write_f32(cpu->mem, _t558, cpu->f[13]);
         /* 022191EC */ _t559 = cpu->r[1] + 0x0000006Cu;
         /* 022191EC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t559);
-        /* 022191F0 */ _t560 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022191F0 */ _t560 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022191F0 */ _t561 = _t560 & 0x00000001u;
         /* 022191F0 */ if (_t561) goto L_02219218; else goto L_022191F4;
   L_022191F4: ; // 0x22191f4
@@ -1927,12 +1927,12 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02219200 */ rbrew_write_f32(cpu->mem, _t564, cpu->f[12]);
         /* 02219204 */ _t565 = cpu->r[1] + 0x00000080u;
         /* 02219204 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t565);
-        /* 02219208 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000005u);
+        /* 02219208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000005u));
         /* 0221920C */ _t566 = cpu->r[20] + 0x00000008u;
         /* 0221920C */ rbrew_write_f32(cpu->mem, _t566, cpu->f[13]);
         /* 02219210 */ _t567 = cpu->r[1] + 0x0000006Cu;
         /* 02219210 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t567);
-        /* 02219214 */ _t568 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219214 */ _t568 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219214 */ _t569 = _t568 & 0x00000001u;
         /* 02219214 */ if (_t569) goto L_02219218; else goto L_02219240;
   L_02219218: ; // 0x2219218
@@ -1950,8 +1950,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02219230 */ _t575 = cpu->r[31] + 0x00000120u;
         /* 02219230 */ cpu->r[4] = rbrew_read32(cpu->mem, _t575);
         /* 02219234 */ cpu->r[4] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 02219234 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 02219238 */ _t576 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219234 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 02219238 */ _t576 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219238 */ _t577 = _t576 & 0x00000001u;
         /* 02219238 */ if (_t577) goto L_02219260; else goto L_0221923C;
   L_0221923C: ; // 0x221923c
@@ -1970,13 +1970,13 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02219254 */ _t583 = cpu->r[31] + 0x00000120u;
         /* 02219254 */ cpu->r[4] = rbrew_read32(cpu->mem, _t583);
         /* 02219258 */ cpu->r[4] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 02219258 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0221925C */ _t584 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219258 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0221925C */ _t584 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221925C */ _t585 = _t584 & 0x00000001u;
         /* 0221925C */ if (_t585) goto L_02219260; else goto L_022193AC;
   L_02219260: ; // 0x2219260
-        /* 02219260 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000005u);
-        /* 02219264 */ _t586 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219260 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000005u));
+        /* 02219264 */ _t586 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219264 */ _t587 = _t586 & 0x00000001u;
         /* 02219264 */ if (_t587) goto L_02219268; else goto L_0221930C;
   L_02219268: ; // 0x2219268
@@ -2038,11 +2038,11 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 022192F0 */ _t609 = cpu->r[1] + 0x00000104u;
         /* 022192F0 */ rbrew_write_f32(cpu->mem, _t609, cpu->f[8]);
         /* 022192F4 */ Gambit_fn_0204A864(cpu);
-        /* 022192F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000005u);
+        /* 022192F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000005u));
         /* 022192FC */ cpu->r[10] = cpu->r[31] + 0x0000019Cu;
         /* 02219300 */ _t610 = cpu->r[31] + 0x000001F0u;
         /* 02219300 */ rbrew_write32(cpu->mem, _t610, cpu->r[3]);
-        /* 02219304 */ _t611 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219304 */ _t611 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219304 */ _t612 = _t611 & 0x00000001u;
         /* 02219304 */ if (_t612) goto L_022194E8; else goto L_02219308;
   L_02219308: ; // 0x2219308
@@ -2105,11 +2105,11 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02219390 */ _t634 = cpu->r[1] + 0x000001ACu;
         /* 02219390 */ rbrew_write32(cpu->mem, _t634, cpu->r[0]);
         /* 02219394 */ Gambit_fn_0204A864(cpu);
-        /* 02219398 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000005u);
+        /* 02219398 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000005u));
         /* 0221939C */ cpu->r[10] = cpu->r[31] + 0x0000019Cu;
         /* 022193A0 */ _t635 = cpu->r[31] + 0x000001F0u;
         /* 022193A0 */ rbrew_write32(cpu->mem, _t635, cpu->r[3]);
-        /* 022193A4 */ _t636 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022193A4 */ _t636 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022193A4 */ _t637 = _t636 & 0x00000001u;
         /* 022193A4 */ if (_t637) goto L_022194E8; else goto L_022193A8;
   L_022193A8: ; // 0x22193a8
@@ -2125,10 +2125,10 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 022193C4 */ cpu->r[5] = cpu->r[18];
         /* 022193C8 */ Gambit_fn_02C69468(cpu);
         /* 022193CC */ /* nop */
-        /* 022193D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000005u);
+        /* 022193D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000005u));
         /* 022193D4 */ _t639 = cpu->r[1] + 0x000000C0u;
         /* 022193D4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t639);
-        /* 022193D8 */ _t640 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022193D8 */ _t640 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022193D8 */ _t641 = _t640 & 0x00000001u;
         /* 022193D8 */ if (_t641) goto L_022193DC; else goto L_02219460;
   L_022193DC: ; // 0x22193dc
@@ -2228,9 +2228,9 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 022194D8 */ _t671 = cpu->r[31] + 0x000001F0u;
         /* 022194D8 */ rbrew_write32(cpu->mem, _t671, cpu->r[3]);
   L_022194DC: ; // 0x22194dc
-        /* 022194DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000005u);
+        /* 022194DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000005u));
         /* 022194E0 */ cpu->r[10] = cpu->r[31] + 0x0000019Cu;
-        /* 022194E4 */ _t672 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022194E4 */ _t672 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022194E4 */ _t673 = _t672 & 0x00000001u;
         /* 022194E4 */ if (_t673) goto L_022194E8; else goto L_022194FC;
   L_022194E8: ; // 0x22194e8
@@ -2239,8 +2239,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 022194EC */ _t675 = cpu->r[31] + 0x000001F0u;
         /* 022194EC */ cpu->r[12] = rbrew_read32(cpu->mem, _t675);
         /* 022194F0 */ cpu->r[11] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022194F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 022194F4 */ _t676 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022194F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 022194F4 */ _t676 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022194F4 */ _t677 = _t676 & 0x00000001u;
         /* 022194F4 */ if (_t677) goto L_02219530; else goto L_022194F8;
   L_022194F8: ; // 0x22194f8
@@ -2251,8 +2251,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02219500 */ _t679 = cpu->r[31] + 0x000001F0u;
         /* 02219500 */ cpu->r[12] = rbrew_read32(cpu->mem, _t679);
         /* 02219504 */ cpu->r[11] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02219504 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02219508 */ _t680 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219504 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02219508 */ _t680 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219508 */ _t681 = _t680 & 0x00000001u;
         /* 02219508 */ if (_t681) goto L_02219530; else goto L_0221950C;
   L_0221950C: ; // 0x221950c
@@ -2261,13 +2261,13 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02219510 */ _t683 = cpu->r[12] + 0x0000015Cu;
         /* 02219510 */ cpu->r[0] = rbrew_read32(cpu->mem, _t683);
         /* 02219514 */ cpu->r[4] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Cu, 0x0000001Eu);
-        /* 02219514 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 02219518 */ _t684 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219514 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 02219518 */ _t684 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219518 */ _t685 = _t684 & 0x00000001u;
         /* 02219518 */ if (_t685) goto L_02219530; else goto L_0221951C;
   L_0221951C: ; // 0x221951c
-        /* 0221951C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000005u);
-        /* 02219520 */ _t686 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221951C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000005u));
+        /* 02219520 */ _t686 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219520 */ _t687 = _t686 & 0x00000001u;
         /* 02219520 */ if (_t687) goto L_02219524; else goto L_02219528;
   L_02219524: ; // 0x2219524
@@ -2299,9 +2299,9 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02219568 */ _t694 = cpu->r[31] + 0x00000122u;
         /* 02219568 */ cpu->r[5] = rbrew_read8(cpu->mem, _t694);
         /* 0221956C */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02219570 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[5]);
+        /* 02219570 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[5]));
         /* 02219574 */ cpu->r[24] = cpu->r[24] + 0x0000000Cu;
-        /* 02219578 */ _t695 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219578 */ _t695 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219578 */ _t696 = _t695 & 0x00000001u;
         /* 02219578 */ if (_t696) goto L_02218BA4; else goto L_0221957C;
   L_0221957C: ; // 0x221957c
@@ -2326,8 +2326,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 022195A4 */ rbrew_write_f32(cpu->mem, _t704, cpu->f[13]);
         /* 022195A8 */ _t705 = cpu->r[12] + 0x00000000u;
         /* 022195A8 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t705);
-        /* 022195AC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[12]);
-        /* 022195B0 */ _t706 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022195AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[12]));
+        /* 022195B0 */ _t706 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022195B0 */ _t707 = _t706 & 0x00000001u;
         /* 022195B0 */ if (_t707) goto L_022195B4; else goto L_022195C4;
   L_022195B4: ; // 0x22195b4
@@ -2343,8 +2343,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 022195C4 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t711);
         /* 022195C8 */ _t712 = cpu->r[12] + 0x00000004u;
         /* 022195C8 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t712);
-        /* 022195CC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[8]);
-        /* 022195D0 */ _t713 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022195CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[8]));
+        /* 022195D0 */ _t713 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022195D0 */ _t714 = _t713 & 0x00000001u;
         /* 022195D0 */ if (_t714) goto L_022195D4; else goto L_022195E4;
   L_022195D4: ; // 0x22195d4
@@ -2360,8 +2360,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 022195E4 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t718);
         /* 022195E8 */ _t719 = cpu->r[12] + 0x00000008u;
         /* 022195E8 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t719);
-        /* 022195EC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[10]);
-        /* 022195F0 */ _t720 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022195EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[10]));
+        /* 022195F0 */ _t720 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022195F0 */ _t721 = _t720 & 0x00000001u;
         /* 022195F0 */ if (_t721) goto L_022195F4; else goto L_02219604;
   L_022195F4: ; // 0x22195f4
@@ -2373,8 +2373,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02219600 */ _t724 = cpu->r[12] + 0x00000008u;
         /* 02219600 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t724);
   L_02219604: ; // 0x2219604
-        /* 02219604 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[12]);
-        /* 02219608 */ _t725 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[12]));
+        /* 02219608 */ _t725 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219608 */ _t726 = _t725 & 0x00000001u;
         /* 02219608 */ if (_t726) goto L_0221960C; else goto L_02219618;
   L_0221960C: ; // 0x221960c
@@ -2384,8 +2384,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02219614 */ _t728 = cpu->r[1] + 0x00000130u;
         /* 02219614 */ rbrew_write_f32(cpu->mem, _t728, cpu->f[0]);
   L_02219618: ; // 0x2219618
-        /* 02219618 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[8]);
-        /* 0221961C */ _t729 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219618 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[8]));
+        /* 0221961C */ _t729 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221961C */ _t730 = _t729 & 0x00000001u;
         /* 0221961C */ if (_t730) goto L_02219620; else goto L_0221962C;
   L_02219620: ; // 0x2219620
@@ -2395,8 +2395,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02219628 */ _t732 = cpu->r[1] + 0x00000134u;
         /* 02219628 */ rbrew_write_f32(cpu->mem, _t732, cpu->f[11]);
   L_0221962C: ; // 0x221962c
-        /* 0221962C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[10]);
-        /* 02219630 */ _t733 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221962C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[10]));
+        /* 02219630 */ _t733 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219630 */ _t734 = _t733 & 0x00000001u;
         /* 02219630 */ if (_t734) goto L_02219634; else goto L_02219640;
   L_02219634: ; // 0x2219634
@@ -2407,8 +2407,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 0221963C */ rbrew_write_f32(cpu->mem, _t736, cpu->f[13]);
   L_02219640: ; // 0x2219640
         /* 02219640 */ cpu->r[0] = cpu->r[5] + 0xFFFFFFFFu;
-        /* 02219644 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
-        /* 02219648 */ _t737 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219644 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
+        /* 02219648 */ _t737 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219648 */ _t738 = _t737 & 0x00000001u;
         /* 02219648 */ if (_t738) goto L_0221964C; else goto L_02219660;
   L_0221964C: ; // 0x221964c
@@ -2416,8 +2416,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02219650 */ _t739 = cpu->r[11] + cpu->r[20];
         /* 02219650 */ cpu->r[8] = rbrew_read32(cpu->mem, _t739);
         /* 02219650 */ cpu->r[11] = _t739;
-        /* 02219654 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[8]);
-        /* 02219658 */ _t740 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02219654 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[8]));
+        /* 02219658 */ _t740 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02219658 */ _t741 = _t740 & 0x00000001u;
         /* 02219658 */ if (_t741) goto L_02219670; else goto L_0221965C;
   L_0221965C: ; // 0x221965c
@@ -2426,8 +2426,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02219660 */ cpu->r[11] = cpu->r[20];
         /* 02219664 */ _t742 = cpu->r[11] + 0x00000000u;
         /* 02219664 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t742);
-        /* 02219668 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[8]);
-        /* 0221966C */ _t743 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02219668 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[8]));
+        /* 0221966C */ _t743 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221966C */ _t744 = _t743 & 0x00000001u;
         /* 0221966C */ if (_t744) goto L_02219670; else goto L_0221967C;
   L_02219670: ; // 0x2219670
@@ -2440,8 +2440,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
   L_0221967C: ; // 0x221967c
         /* 0221967C */ _t748 = cpu->r[11] + 0x00000004u;
         /* 0221967C */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t748);
-        /* 02219680 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[9]);
-        /* 02219684 */ _t749 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02219680 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[9]));
+        /* 02219684 */ _t749 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02219684 */ _t750 = _t749 & 0x00000001u;
         /* 02219684 */ if (_t750) goto L_02219688; else goto L_02219694;
   L_02219688: ; // 0x2219688
@@ -2454,8 +2454,8 @@ void Gambit_fn_02218530(CPUState* cpu) {
   L_02219694: ; // 0x2219694
         /* 02219694 */ _t754 = cpu->r[11] + 0x00000008u;
         /* 02219694 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t754);
-        /* 02219698 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[10]);
-        /* 0221969C */ _t755 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02219698 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[10]));
+        /* 0221969C */ _t755 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221969C */ _t756 = _t755 & 0x00000001u;
         /* 0221969C */ if (_t756) goto L_022196A0; else goto L_022196AC;
   L_022196A0: ; // 0x22196a0
@@ -2466,24 +2466,24 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 022196A8 */ _t759 = cpu->r[1] + 0x00000138u;
         /* 022196A8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t759);
   L_022196AC: ; // 0x22196ac
-        /* 022196AC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[8]);
-        /* 022196B0 */ _t760 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022196AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[8]));
+        /* 022196B0 */ _t760 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022196B0 */ _t761 = _t760 & 0x00000001u;
         /* 022196B0 */ if (_t761) goto L_022196B4; else goto L_022196B8;
   L_022196B4: ; // 0x22196b4
         /* 022196B4 */ _t762 = cpu->r[1] + 0x00000130u;
         /* 022196B4 */ rbrew_write_f32(cpu->mem, _t762, cpu->f[8]);
   L_022196B8: ; // 0x22196b8
-        /* 022196B8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[9]);
-        /* 022196BC */ _t763 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022196B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[9]));
+        /* 022196BC */ _t763 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022196BC */ _t764 = _t763 & 0x00000001u;
         /* 022196BC */ if (_t764) goto L_022196C0; else goto L_022196C4;
   L_022196C0: ; // 0x22196c0
         /* 022196C0 */ _t765 = cpu->r[1] + 0x00000134u;
         /* 022196C0 */ rbrew_write_f32(cpu->mem, _t765, cpu->f[9]);
   L_022196C4: ; // 0x22196c4
-        /* 022196C4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[10]);
-        /* 022196C8 */ _t766 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022196C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[10]));
+        /* 022196C8 */ _t766 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022196C8 */ _t767 = _t766 & 0x00000001u;
         /* 022196C8 */ if (_t767) goto L_022196CC; else goto L_022196D0;
   L_022196CC: ; // 0x22196cc
@@ -2542,18 +2542,18 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 0221973C */ _t791 = cpu->r[1] + 0x00000180u;
         /* 0221973C */ rbrew_write_f32(cpu->mem, _t791, cpu->f[4]);
         /* 02219740 */ cpu->r[5] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 02219740 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02219740 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02219744 */ _t792 = cpu->r[1] + 0x0000013Cu;
         /* 02219744 */ rbrew_write_f32(cpu->mem, _t792, cpu->f[10]);
-        /* 02219748 */ _t793 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219748 */ _t793 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219748 */ _t794 = _t793 & 0x00000001u;
         /* 02219748 */ if (_t794) goto L_022197B8; else goto L_0221974C;
   L_0221974C: ; // 0x221974c
         /* 0221974C */ _t795 = cpu->r[31] + 0x0000020Cu;
         /* 0221974C */ cpu->r[7] = rbrew_read32(cpu->mem, _t795);
         /* 02219750 */ cpu->r[7] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x00000014u, 0x00000015u);
-        /* 02219750 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 02219754 */ _t796 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219750 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 02219754 */ _t796 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219754 */ _t797 = _t796 & 0x00000001u;
         /* 02219754 */ if (_t797) goto L_02219758; else goto L_022197B8;
   L_02219758: ; // 0x2219758
@@ -2677,7 +2677,7 @@ void Gambit_fn_02218530(CPUState* cpu) {
         /* 02219860 */ cpu->f[18] = rbrew_read_f64(cpu->mem, _t847);
         /* 02219864 */ _t848 = cpu->r[1] + 0x000002C0u;
         /* 02219864 */ cpu->f[19] = rbrew_read_f64(cpu->mem, _t848);
-        /* 02219868 */ _t849 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219868 */ _t849 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219868 */ _t850 = _t849 & 0x00000001u;
         /* 02219868 */ if (_t850) goto L_0221986C; // else: addr-0 trap, fall-through
   L_0221986C: ; // 0x221986c
@@ -2797,9 +2797,9 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02218624 */ _t38 = cpu->r[31] + 0x00000120u;
         /* 02218624 */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 02218628 */ cpu->r[6] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x00000000u, 0x00000000u);
-        /* 02218628 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02218628 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 0221862C */ cpu->r[28] = cpu->r[4];
-        /* 02218630 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02218630 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02218630 */ _t40 = _t39 & 0x00000001u;
         /* 02218630 */ if (_t40) goto L_02218688; else goto L_02218634;
   L_02218634: ; // 0x2218634
@@ -2923,10 +2923,10 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02218720 */ cpu->r[15] = 0x00000000u;
         /* 02218724 */ _t97 = cpu->r[1] + 0x0000014Cu;
         /* 02218724 */ rbrew_write32(cpu->mem, _t97, cpu->r[6]);
-        /* 02218728 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000001u);
+        /* 02218728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000001u));
         /* 0221872C */ _t98 = cpu->r[1] + 0x00000150u;
         /* 0221872C */ rbrew_write32(cpu->mem, _t98, cpu->r[7]);
-        /* 02218730 */ _t99 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218730 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218730 */ _t100 = _t99 & 0x00000001u;
         /* 02218730 */ if (_t100) goto L_02218734; else goto L_022188C4;
   L_02218734: ; // 0x2218734
@@ -3086,10 +3086,10 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 022188AC */ rbrew_write_f32(cpu->mem, _t159, cpu->f[6]);
         /* 022188B0 */ _t160 = cpu->r[31] + 0x000000DCu;
         /* 022188B0 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t160);
-        /* 022188B4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[13]);
+        /* 022188B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[13]));
         /* 022188B8 */ _t161 = cpu->r[1] + 0x00000098u;
         /* 022188B8 */ rbrew_write_f32(cpu->mem, _t161, cpu->f[8]);
-        /* 022188BC */ _t162 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022188BC */ _t162 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022188BC */ _t163 = _t162 & 0x00000001u;
         /* 022188BC */ if (_t163) goto L_022188C0; else goto L_02218914;
   L_022188C0: ; // 0x22188c0
@@ -3113,7 +3113,7 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 022188E0 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t171);
         /* 022188E4 */ _t172 = cpu->r[1] + 0x0000009Cu;
         /* 022188E4 */ rbrew_write_f32(cpu->mem, _t172, cpu->f[12]);
-        /* 022188E8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[13]);
+        /* 022188E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[13]));
         /* 022188EC */ _t173 = cpu->r[1] + 0x000000A4u;
         /* 022188EC */ rbrew_write_f32(cpu->mem, _t173, cpu->f[0]);
         /* 022188F0 */ _t174 = cpu->r[29] + 0x00000000u;
@@ -3124,7 +3124,7 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 022188F8 */ rbrew_write_f32(cpu->mem, _t176, cpu->f[8]);
         /* 022188FC */ _t177 = cpu->r[1] + 0x00000098u;
         /* 022188FC */ rbrew_write_f32(cpu->mem, _t177, cpu->f[11]);
-        /* 02218900 */ _t178 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02218900 */ _t178 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02218900 */ _t179 = _t178 & 0x00000001u;
         /* 02218900 */ if (_t179) goto L_02218904; else goto L_02218914;
   L_02218904: ; // 0x2218904
@@ -3132,8 +3132,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02218904 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t180);
         /* 02218908 */ _t181 = cpu->r[31] + 0x000000E0u;
         /* 02218908 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t181);
-        /* 0221890C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[12]);
-        /* 02218910 */ _t182 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221890C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[12]));
+        /* 02218910 */ _t182 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02218910 */ _t183 = _t182 & 0x00000001u;
         /* 02218910 */ if (_t183) goto L_0221893C; else goto L_02218914;
   L_02218914: ; // 0x2218914
@@ -3156,8 +3156,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 0221893C */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t188);
         /* 02218940 */ _t189 = cpu->r[31] + 0x000000F0u;
         /* 02218940 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t189);
-        /* 02218944 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[11]);
-        /* 02218948 */ _t190 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02218944 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[11]));
+        /* 02218948 */ _t190 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02218948 */ _t191 = _t190 & 0x00000001u;
         /* 02218948 */ if (_t191) goto L_0221894C; else goto L_02218968;
   L_0221894C: ; // 0x221894c
@@ -3165,12 +3165,12 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 0221894C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t192);
         /* 02218950 */ _t193 = cpu->r[1] + 0x00000084u;
         /* 02218950 */ rbrew_write_f32(cpu->mem, _t193, cpu->f[13]);
-        /* 02218954 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
+        /* 02218954 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
         /* 02218958 */ _t194 = cpu->r[1] + 0x0000008Cu;
         /* 02218958 */ rbrew_write_f32(cpu->mem, _t194, cpu->f[11]);
         /* 0221895C */ _t195 = cpu->r[1] + 0x00000088u;
         /* 0221895C */ rbrew_write_f32(cpu->mem, _t195, cpu->f[12]);
-        /* 02218960 */ _t196 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02218960 */ _t196 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02218960 */ _t197 = _t196 & 0x00000001u;
         /* 02218960 */ if (_t197) goto L_02218964; else goto L_022189C4;
   L_02218964: ; // 0x2218964
@@ -3188,24 +3188,24 @@ void Gambit_fn_0221987C(CPUState* cpu) {
   L_02218984: ; // 0x2218984
         /* 02218984 */ _t200 = cpu->r[30] + 0x00000000u;
         /* 02218984 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t200);
-        /* 02218988 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
+        /* 02218988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
         /* 0221898C */ _t201 = cpu->r[1] + 0x0000008Cu;
         /* 0221898C */ rbrew_write_f32(cpu->mem, _t201, cpu->f[11]);
-        /* 02218990 */ _t202 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02218990 */ _t202 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02218990 */ _t203 = _t202 & 0x00000001u;
         /* 02218990 */ if (_t203) goto L_02218994; else goto L_022189C4;
   L_02218994: ; // 0x2218994
         /* 02218994 */ _t204 = cpu->r[30] + 0x00000004u;
         /* 02218994 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t204);
-        /* 02218998 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[6]);
-        /* 0221899C */ _t205 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02218998 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[6]));
+        /* 0221899C */ _t205 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221899C */ _t206 = _t205 & 0x00000001u;
         /* 0221899C */ if (_t206) goto L_022189A0; else goto L_022189C4;
   L_022189A0: ; // 0x22189a0
         /* 022189A0 */ _t207 = cpu->r[30] + 0x00000008u;
         /* 022189A0 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t207);
-        /* 022189A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[7]);
-        /* 022189A8 */ _t208 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022189A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[7]));
+        /* 022189A8 */ _t208 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022189A8 */ _t209 = _t208 & 0x00000001u;
         /* 022189A8 */ if (_t209) goto L_022189AC; else goto L_022189C4;
   L_022189AC: ; // 0x22189ac
@@ -3228,8 +3228,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 022189D0 */ cpu->f[9] = fma(cpu->f[11], cpu->f[11], cpu->f[9]);
         /* 022189D4 */ _t216 = cpu->r[12] + 0xFFFFBE2Cu;
         /* 022189D4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t216);
-        /* 022189D8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[10]);
-        /* 022189DC */ _t217 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022189D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[10]));
+        /* 022189DC */ _t217 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022189DC */ _t218 = _t217 & 0x00000001u;
         /* 022189DC */ if (_t218) goto L_022189E0; else goto L_02218A1C;
   L_022189E0: ; // 0x22189e0
@@ -3309,11 +3309,11 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02218AA0 */ cpu->r[30] = 0x00000000u;
         /* 02218AA4 */ _t243 = cpu->r[1] + 0x00000008u;
         /* 02218AA4 */ rbrew_write_f32(cpu->mem, _t243, cpu->f[7]);
-        /* 02218AA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[5]);
+        /* 02218AA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[5]));
         /* 02218AAC */ cpu->r[20] = cpu->r[31] + 0x00000124u;
         /* 02218AB0 */ _t244 = cpu->r[1] + 0x0000000Cu;
         /* 02218AB0 */ rbrew_write_f32(cpu->mem, _t244, cpu->f[6]);
-        /* 02218AB4 */ _t245 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02218AB4 */ _t245 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02218AB4 */ _t246 = _t245 & 0x00000001u;
         /* 02218AB4 */ if (_t246) goto L_02218AF4; else goto L_02218AB8;
   L_02218AB8: ; // 0x2218ab8
@@ -3338,8 +3338,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02218AE0 */ rbrew_write_f32(cpu->mem, _t254, cpu->f[13]);
         /* 02218AE4 */ _t255 = cpu->r[12] + 0x00000000u;
         /* 02218AE4 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t255);
-        /* 02218AE8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[12]);
-        /* 02218AEC */ _t256 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218AE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[12]));
+        /* 02218AEC */ _t256 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218AEC */ _t257 = _t256 & 0x00000001u;
         /* 02218AEC */ if (_t257) goto L_022195B4; else goto L_02218AF0;
   L_02218AF0: ; // 0x2218af0
@@ -3424,7 +3424,7 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02218BB8 */ rbrew_write_f32(cpu->mem, _t283, cpu->f[21]);
         /* 02218BBC */ _t284 = cpu->r[1] + 0x0000003Cu;
         /* 02218BBC */ rbrew_write_f32(cpu->mem, _t284, cpu->f[21]);
-        /* 02218BC0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000005u);
+        /* 02218BC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000005u));
         /* 02218BC4 */ _t285 = cpu->r[1] + 0x0000004Cu;
         /* 02218BC4 */ rbrew_write_f32(cpu->mem, _t285, cpu->f[22]);
         /* 02218BC8 */ _t286 = cpu->r[1] + 0x00000058u;
@@ -3436,17 +3436,17 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02218BD4 */ rbrew_write_f32(cpu->mem, _t288, cpu->f[21]);
         /* 02218BD8 */ _t289 = cpu->r[1] + 0x00000064u;
         /* 02218BD8 */ rbrew_write_f32(cpu->mem, _t289, cpu->f[22]);
-        /* 02218BDC */ _t290 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02218BDC */ _t290 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02218BDC */ _t291 = _t290 & 0x00000001u;
         /* 02218BDC */ if (_t291) goto L_02218BE0; else goto L_02218BF8;
   L_02218BE0: ; // 0x2218be0
         /* 02218BE0 */ _t292 = cpu->r[20] + cpu->r[24];
         /* 02218BE0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t292);
-        /* 02218BE4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
+        /* 02218BE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
         /* 02218BE8 */ _t293 = cpu->r[1] + 0x00000040u;
         /* 02218BE8 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t293);
         /* 02218BEC */ cpu->r[4] = cpu->r[20] + cpu->r[24];
-        /* 02218BF0 */ _t294 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218BF0 */ _t294 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218BF0 */ _t295 = _t294 & 0x00000001u;
         /* 02218BF0 */ if (_t295) goto L_02218C0C; else goto L_02218BF4;
   L_02218BF4: ; // 0x2218bf4
@@ -3455,10 +3455,10 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02218BF8 */ cpu->r[4] = cpu->r[20];
         /* 02218BFC */ _t296 = cpu->r[4] + 0x00000000u;
         /* 02218BFC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t296);
-        /* 02218C00 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
+        /* 02218C00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
         /* 02218C04 */ _t297 = cpu->r[1] + 0x00000040u;
         /* 02218C04 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t297);
-        /* 02218C08 */ _t298 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218C08 */ _t298 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218C08 */ _t299 = _t298 & 0x00000001u;
         /* 02218C08 */ if (_t299) goto L_02218C0C; else goto L_02218C14;
   L_02218C0C: ; // 0x2218c0c
@@ -3469,10 +3469,10 @@ void Gambit_fn_0221987C(CPUState* cpu) {
   L_02218C14: ; // 0x2218c14
         /* 02218C14 */ _t302 = cpu->r[4] + 0x00000004u;
         /* 02218C14 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t302);
-        /* 02218C18 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[13]);
+        /* 02218C18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[13]));
         /* 02218C1C */ _t303 = cpu->r[1] + 0x00000044u;
         /* 02218C1C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t303);
-        /* 02218C20 */ _t304 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218C20 */ _t304 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218C20 */ _t305 = _t304 & 0x00000001u;
         /* 02218C20 */ if (_t305) goto L_02218C24; else goto L_02218C2C;
   L_02218C24: ; // 0x2218c24
@@ -3483,8 +3483,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
   L_02218C2C: ; // 0x2218c2c
         /* 02218C2C */ _t308 = cpu->r[4] + 0x00000008u;
         /* 02218C2C */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t308);
-        /* 02218C30 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[6]);
-        /* 02218C34 */ _t309 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218C30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[6]));
+        /* 02218C34 */ _t309 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218C34 */ _t310 = _t309 & 0x00000001u;
         /* 02218C34 */ if (_t310) goto L_02218C38; else goto L_02218C40;
   L_02218C38: ; // 0x2218c38
@@ -3495,48 +3495,48 @@ void Gambit_fn_0221987C(CPUState* cpu) {
   L_02218C40: ; // 0x2218c40
         /* 02218C40 */ _t313 = cpu->r[1] + 0x00000048u;
         /* 02218C40 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t313);
-        /* 02218C44 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[0]);
+        /* 02218C44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[0]));
         /* 02218C48 */ _t314 = cpu->r[1] + 0x0000004Cu;
         /* 02218C48 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t314);
-        /* 02218C4C */ _t315 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02218C4C */ _t315 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02218C4C */ _t316 = _t315 & 0x00000001u;
         /* 02218C4C */ if (_t316) goto L_02218C50; else goto L_02218C54;
   L_02218C50: ; // 0x2218c50
         /* 02218C50 */ _t317 = cpu->r[1] + 0x00000048u;
         /* 02218C50 */ rbrew_write_f32(cpu->mem, _t317, cpu->f[0]);
   L_02218C54: ; // 0x2218c54
-        /* 02218C54 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[13]);
+        /* 02218C54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[13]));
         /* 02218C58 */ _t318 = cpu->r[1] + 0x00000050u;
         /* 02218C58 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t318);
-        /* 02218C5C */ _t319 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02218C5C */ _t319 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02218C5C */ _t320 = _t319 & 0x00000001u;
         /* 02218C5C */ if (_t320) goto L_02218C60; else goto L_02218C64;
   L_02218C60: ; // 0x2218c60
         /* 02218C60 */ _t321 = cpu->r[1] + 0x0000004Cu;
         /* 02218C60 */ rbrew_write_f32(cpu->mem, _t321, cpu->f[13]);
   L_02218C64: ; // 0x2218c64
-        /* 02218C64 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[6]);
-        /* 02218C68 */ _t322 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02218C64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[6]));
+        /* 02218C68 */ _t322 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02218C68 */ _t323 = _t322 & 0x00000001u;
         /* 02218C68 */ if (_t323) goto L_02218C6C; else goto L_02218C70;
   L_02218C6C: ; // 0x2218c6c
         /* 02218C6C */ _t324 = cpu->r[1] + 0x00000050u;
         /* 02218C6C */ rbrew_write_f32(cpu->mem, _t324, cpu->f[6]);
   L_02218C70: ; // 0x2218c70
-        /* 02218C70 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000005u);
+        /* 02218C70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000005u));
         /* 02218C74 */ _t325 = cpu->r[1] + 0x00000054u;
         /* 02218C74 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t325);
-        /* 02218C78 */ _t326 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02218C78 */ _t326 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02218C78 */ _t327 = _t326 & 0x00000001u;
         /* 02218C78 */ if (_t327) goto L_02218C7C; else goto L_02218C94;
   L_02218C7C: ; // 0x2218c7c
         /* 02218C7C */ _t328 = cpu->r[19] + cpu->r[24];
         /* 02218C7C */ cpu->r[10] = rbrew_read32(cpu->mem, _t328);
-        /* 02218C80 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[10]);
+        /* 02218C80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[10]));
         /* 02218C84 */ _t329 = cpu->r[1] + 0x00000058u;
         /* 02218C84 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t329);
         /* 02218C88 */ cpu->r[5] = cpu->r[19] + cpu->r[24];
-        /* 02218C8C */ _t330 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218C8C */ _t330 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218C8C */ _t331 = _t330 & 0x00000001u;
         /* 02218C8C */ if (_t331) goto L_02218CA8; else goto L_02218C90;
   L_02218C90: ; // 0x2218c90
@@ -3545,10 +3545,10 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02218C94 */ cpu->r[5] = cpu->r[19];
         /* 02218C98 */ _t332 = cpu->r[5] + 0x00000000u;
         /* 02218C98 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t332);
-        /* 02218C9C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[10]);
+        /* 02218C9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[10]));
         /* 02218CA0 */ _t333 = cpu->r[1] + 0x00000058u;
         /* 02218CA0 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t333);
-        /* 02218CA4 */ _t334 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218CA4 */ _t334 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218CA4 */ _t335 = _t334 & 0x00000001u;
         /* 02218CA4 */ if (_t335) goto L_02218CA8; else goto L_02218CB0;
   L_02218CA8: ; // 0x2218ca8
@@ -3559,10 +3559,10 @@ void Gambit_fn_0221987C(CPUState* cpu) {
   L_02218CB0: ; // 0x2218cb0
         /* 02218CB0 */ _t338 = cpu->r[5] + 0x00000004u;
         /* 02218CB0 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t338);
-        /* 02218CB4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[7]);
+        /* 02218CB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[7]));
         /* 02218CB8 */ _t339 = cpu->r[1] + 0x0000005Cu;
         /* 02218CB8 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t339);
-        /* 02218CBC */ _t340 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218CBC */ _t340 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218CBC */ _t341 = _t340 & 0x00000001u;
         /* 02218CBC */ if (_t341) goto L_02218CC0; else goto L_02218CC8;
   L_02218CC0: ; // 0x2218cc0
@@ -3573,8 +3573,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
   L_02218CC8: ; // 0x2218cc8
         /* 02218CC8 */ _t344 = cpu->r[5] + 0x00000008u;
         /* 02218CC8 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t344);
-        /* 02218CCC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[8]);
-        /* 02218CD0 */ _t345 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218CCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[8]));
+        /* 02218CD0 */ _t345 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218CD0 */ _t346 = _t345 & 0x00000001u;
         /* 02218CD0 */ if (_t346) goto L_02218CD4; else goto L_02218CDC;
   L_02218CD4: ; // 0x2218cd4
@@ -3585,32 +3585,32 @@ void Gambit_fn_0221987C(CPUState* cpu) {
   L_02218CDC: ; // 0x2218cdc
         /* 02218CDC */ _t349 = cpu->r[1] + 0x00000060u;
         /* 02218CDC */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t349);
-        /* 02218CE0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[10]);
+        /* 02218CE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[10]));
         /* 02218CE4 */ _t350 = cpu->r[1] + 0x00000064u;
         /* 02218CE4 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t350);
-        /* 02218CE8 */ _t351 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02218CE8 */ _t351 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02218CE8 */ _t352 = _t351 & 0x00000001u;
         /* 02218CE8 */ if (_t352) goto L_02218CEC; else goto L_02218CF0;
   L_02218CEC: ; // 0x2218cec
         /* 02218CEC */ _t353 = cpu->r[1] + 0x00000060u;
         /* 02218CEC */ rbrew_write_f32(cpu->mem, _t353, cpu->f[10]);
   L_02218CF0: ; // 0x2218cf0
-        /* 02218CF0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[7]);
+        /* 02218CF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[7]));
         /* 02218CF4 */ _t354 = cpu->r[1] + 0x00000068u;
         /* 02218CF4 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t354);
-        /* 02218CF8 */ _t355 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02218CF8 */ _t355 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02218CF8 */ _t356 = _t355 & 0x00000001u;
         /* 02218CF8 */ if (_t356) goto L_02218CFC; else goto L_02218D00;
   L_02218CFC: ; // 0x2218cfc
         /* 02218CFC */ _t357 = cpu->r[1] + 0x00000064u;
         /* 02218CFC */ rbrew_write_f32(cpu->mem, _t357, cpu->f[7]);
   L_02218D00: ; // 0x2218d00
-        /* 02218D00 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[8]);
+        /* 02218D00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[8]));
         /* 02218D04 */ _t358 = cpu->r[1] + 0x00000084u;
         /* 02218D04 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t358);
         /* 02218D08 */ _t359 = cpu->r[25] + 0x00000000u;
         /* 02218D08 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t359);
-        /* 02218D0C */ _t360 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02218D0C */ _t360 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02218D0C */ _t361 = _t360 & 0x00000001u;
         /* 02218D0C */ if (_t361) goto L_02218D10; else goto L_02218D14;
   L_02218D10: ; // 0x2218d10
@@ -3635,14 +3635,14 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02218D30 */ rbrew_write32(cpu->mem, _t370, cpu->r[6]);
         /* 02218D34 */ _t371 = cpu->r[1] + 0x000000A4u;
         /* 02218D34 */ cpu->r[12] = rbrew_read32(cpu->mem, _t371);
-        /* 02218D38 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[6]);
+        /* 02218D38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[6]));
         /* 02218D3C */ _t372 = cpu->r[1] + 0x00000070u;
         /* 02218D3C */ rbrew_write32(cpu->mem, _t372, cpu->r[11]);
         /* 02218D40 */ _t373 = cpu->r[1] + 0x00000074u;
         /* 02218D40 */ rbrew_write32(cpu->mem, _t373, cpu->r[12]);
         /* 02218D44 */ _t374 = cpu->r[1] + 0x00000080u;
         /* 02218D44 */ rbrew_write32(cpu->mem, _t374, cpu->r[8]);
-        /* 02218D48 */ _t375 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02218D48 */ _t375 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02218D48 */ _t376 = _t375 & 0x00000001u;
         /* 02218D48 */ if (_t376) goto L_02218D4C; else goto L_02218D6C;
   L_02218D4C: ; // 0x2218d4c
@@ -3650,8 +3650,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02218D4C */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t377);
         /* 02218D50 */ _t378 = cpu->r[25] + 0x00000004u;
         /* 02218D50 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t378);
-        /* 02218D54 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[8]);
-        /* 02218D58 */ _t379 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02218D54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[8]));
+        /* 02218D58 */ _t379 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02218D58 */ _t380 = _t379 & 0x00000001u;
         /* 02218D58 */ if (_t380) goto L_02218D5C; else goto L_02218D6C;
   L_02218D5C: ; // 0x2218d5c
@@ -3659,8 +3659,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02218D5C */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t381);
         /* 02218D60 */ _t382 = cpu->r[25] + 0x00000008u;
         /* 02218D60 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t382);
-        /* 02218D64 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[10]);
-        /* 02218D68 */ _t383 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02218D64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[10]));
+        /* 02218D68 */ _t383 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02218D68 */ _t384 = _t383 & 0x00000001u;
         /* 02218D68 */ if (_t384) goto L_022190D4; else goto L_02218D6C;
   L_02218D6C: ; // 0x2218d6c
@@ -3800,14 +3800,14 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02218EB8 */ cpu->f[14] = fma(cpu->f[28], cpu->f[28], cpu->f[9]);
         /* 02218EBC */ /* nop */
         /* 02218EC0 */ Gambit_fn_02C693A4(cpu);
-        /* 02218EC4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[14], cpu->f[26]);
+        /* 02218EC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[14], cpu->f[26]));
         /* 02218EC8 */ cpu->f[0] = cpu->f[1];
-        /* 02218ECC */ _t435 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218ECC */ _t435 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218ECC */ _t436 = _t435 & 0x00000001u;
         /* 02218ECC */ if (_t436) goto L_02218ED0; else goto L_02218FE0;
   L_02218ED0: ; // 0x2218ed0
-        /* 02218ED0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[14], cpu->f[27]);
-        /* 02218ED4 */ _t437 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218ED0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[14], cpu->f[27]));
+        /* 02218ED4 */ _t437 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218ED4 */ _t438 = _t437 & 0x00000001u;
         /* 02218ED4 */ if (_t438) goto L_02218ED8; else goto L_02218F20;
   L_02218ED8: ; // 0x2218ed8
@@ -3865,8 +3865,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02218F74 */ _t450 = cpu->r[1] + 0x000000C0u;
         /* 02218F74 */ rbrew_write_f32(cpu->mem, _t450, cpu->f[29]);
         /* 02218F78 */ Gambit_fn_02C693A4(cpu);
-        /* 02218F7C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[26]);
-        /* 02218F80 */ _t451 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02218F7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[26]));
+        /* 02218F80 */ _t451 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02218F80 */ _t452 = _t451 & 0x00000001u;
         /* 02218F80 */ if (_t452) goto L_02219074; else goto L_02218F84;
   L_02218F84: ; // 0x2218f84
@@ -3956,13 +3956,13 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02219064 */ _t479 = cpu->r[1] + 0x000000C0u;
         /* 02219064 */ rbrew_write_f32(cpu->mem, _t479, cpu->f[29]);
         /* 02219068 */ Gambit_fn_02C693A4(cpu);
-        /* 0221906C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[26]);
-        /* 02219070 */ _t480 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221906C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[26]));
+        /* 02219070 */ _t480 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02219070 */ _t481 = _t480 & 0x00000001u;
         /* 02219070 */ if (_t481) goto L_02219074; else goto L_02218F84;
   L_02219074: ; // 0x2219074
-        /* 02219074 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[27]);
-        /* 02219078 */ _t482 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02219074 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[27]));
+        /* 02219078 */ _t482 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02219078 */ _t483 = _t482 & 0x00000001u;
         /* 02219078 */ if (_t483) goto L_0221907C; else goto L_022190B4;
   L_0221907C: ; // 0x221907c
@@ -4003,10 +4003,10 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 022190D8 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t492);
         /* 022190DC */ _t493 = cpu->r[1] + 0x0000007Cu;
         /* 022190DC */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t493);
-        /* 022190E0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[13]);
+        /* 022190E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[13]));
         /* 022190E4 */ _t494 = cpu->r[1] + 0x00000040u;
         /* 022190E4 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t494);
-        /* 022190E8 */ _t495 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022190E8 */ _t495 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022190E8 */ _t496 = _t495 & 0x00000001u;
         /* 022190E8 */ if (_t496) goto L_022190EC; else goto L_022190F4;
   L_022190EC: ; // 0x22190ec
@@ -4015,12 +4015,12 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 022190F0 */ _t498 = cpu->r[1] + 0x00000078u;
         /* 022190F0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t498);
   L_022190F4: ; // 0x22190f4
-        /* 022190F4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[9]);
+        /* 022190F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[9]));
         /* 022190F8 */ _t499 = cpu->r[1] + 0x00000044u;
         /* 022190F8 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t499);
         /* 022190FC */ _t500 = cpu->r[1] + 0x00000080u;
         /* 022190FC */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t500);
-        /* 02219100 */ _t501 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02219100 */ _t501 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02219100 */ _t502 = _t501 & 0x00000001u;
         /* 02219100 */ if (_t502) goto L_02219104; else goto L_0221910C;
   L_02219104: ; // 0x2219104
@@ -4029,8 +4029,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02219108 */ _t504 = cpu->r[1] + 0x0000007Cu;
         /* 02219108 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t504);
   L_0221910C: ; // 0x221910c
-        /* 0221910C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[7]);
-        /* 02219110 */ _t505 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221910C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[7]));
+        /* 02219110 */ _t505 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02219110 */ _t506 = _t505 & 0x00000001u;
         /* 02219110 */ if (_t506) goto L_02219114; else goto L_0221911C;
   L_02219114: ; // 0x2219114
@@ -4041,44 +4041,44 @@ void Gambit_fn_0221987C(CPUState* cpu) {
   L_0221911C: ; // 0x221911c
         /* 0221911C */ _t509 = cpu->r[1] + 0x00000048u;
         /* 0221911C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t509);
-        /* 02219120 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[13]);
+        /* 02219120 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[13]));
         /* 02219124 */ _t510 = cpu->r[1] + 0x0000004Cu;
         /* 02219124 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t510);
-        /* 02219128 */ _t511 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219128 */ _t511 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219128 */ _t512 = _t511 & 0x00000001u;
         /* 02219128 */ if (_t512) goto L_0221912C; else goto L_02219130;
   L_0221912C: ; // 0x221912c
         /* 0221912C */ _t513 = cpu->r[1] + 0x00000048u;
         /* 0221912C */ rbrew_write_f32(cpu->mem, _t513, cpu->f[13]);
   L_02219130: ; // 0x2219130
-        /* 02219130 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[9]);
+        /* 02219130 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[9]));
         /* 02219134 */ _t514 = cpu->r[1] + 0x00000050u;
         /* 02219134 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t514);
-        /* 02219138 */ _t515 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219138 */ _t515 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219138 */ _t516 = _t515 & 0x00000001u;
         /* 02219138 */ if (_t516) goto L_0221913C; else goto L_02219140;
   L_0221913C: ; // 0x221913c
         /* 0221913C */ _t517 = cpu->r[1] + 0x0000004Cu;
         /* 0221913C */ rbrew_write_f32(cpu->mem, _t517, cpu->f[9]);
   L_02219140: ; // 0x2219140
-        /* 02219140 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[7]);
+        /* 02219140 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[7]));
         /* 02219144 */ _t518 = cpu->r[1] + 0x0000006Cu;
         /* 02219144 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t518);
         /* 02219148 */ _t519 = cpu->r[1] + 0x00000054u;
         /* 02219148 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t519);
-        /* 0221914C */ _t520 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221914C */ _t520 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221914C */ _t521 = _t520 & 0x00000001u;
         /* 0221914C */ if (_t521) goto L_02219150; else goto L_02219154;
   L_02219150: ; // 0x2219150
         /* 02219150 */ _t522 = cpu->r[1] + 0x00000050u;
         /* 02219150 */ rbrew_write_f32(cpu->mem, _t522, cpu->f[7]);
   L_02219154: ; // 0x2219154
-        /* 02219154 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[6]);
+        /* 02219154 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[6]));
         /* 02219158 */ _t523 = cpu->r[1] + 0x00000070u;
         /* 02219158 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t523);
         /* 0221915C */ _t524 = cpu->r[1] + 0x00000058u;
         /* 0221915C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t524);
-        /* 02219160 */ _t525 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02219160 */ _t525 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02219160 */ _t526 = _t525 & 0x00000001u;
         /* 02219160 */ if (_t526) goto L_02219164; else goto L_0221916C;
   L_02219164: ; // 0x2219164
@@ -4087,12 +4087,12 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02219168 */ _t528 = cpu->r[1] + 0x0000006Cu;
         /* 02219168 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t528);
   L_0221916C: ; // 0x221916c
-        /* 0221916C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[12]);
+        /* 0221916C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[12]));
         /* 02219170 */ _t529 = cpu->r[1] + 0x00000074u;
         /* 02219170 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t529);
         /* 02219174 */ _t530 = cpu->r[1] + 0x0000005Cu;
         /* 02219174 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t530);
-        /* 02219178 */ _t531 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02219178 */ _t531 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02219178 */ _t532 = _t531 & 0x00000001u;
         /* 02219178 */ if (_t532) goto L_0221917C; else goto L_02219184;
   L_0221917C: ; // 0x221917c
@@ -4101,8 +4101,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02219180 */ _t534 = cpu->r[1] + 0x00000070u;
         /* 02219180 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t534);
   L_02219184: ; // 0x2219184
-        /* 02219184 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[11]);
-        /* 02219188 */ _t535 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02219184 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[11]));
+        /* 02219188 */ _t535 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02219188 */ _t536 = _t535 & 0x00000001u;
         /* 02219188 */ if (_t536) goto L_0221918C; else goto L_02219194;
   L_0221918C: ; // 0x221918c
@@ -4113,38 +4113,38 @@ void Gambit_fn_0221987C(CPUState* cpu) {
   L_02219194: ; // 0x2219194
         /* 02219194 */ _t539 = cpu->r[1] + 0x00000060u;
         /* 02219194 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t539);
-        /* 02219198 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[6]);
+        /* 02219198 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[6]));
         /* 0221919C */ _t540 = cpu->r[1] + 0x00000064u;
         /* 0221919C */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t540);
-        /* 022191A0 */ _t541 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022191A0 */ _t541 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022191A0 */ _t542 = _t541 & 0x00000001u;
         /* 022191A0 */ if (_t542) goto L_022191A4; else goto L_022191A8;
   L_022191A4: ; // 0x22191a4
         /* 022191A4 */ _t543 = cpu->r[1] + 0x00000060u;
         /* 022191A4 */ rbrew_write_f32(cpu->mem, _t543, cpu->f[6]);
   L_022191A8: ; // 0x22191a8
-        /* 022191A8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[12]);
+        /* 022191A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[12]));
         /* 022191AC */ _t544 = cpu->r[1] + 0x00000068u;
         /* 022191AC */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t544);
-        /* 022191B0 */ _t545 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022191B0 */ _t545 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022191B0 */ _t546 = _t545 & 0x00000001u;
         /* 022191B0 */ if (_t546) goto L_022191B4; else goto L_022191B8;
   L_022191B4: ; // 0x22191b4
         /* 022191B4 */ _t547 = cpu->r[1] + 0x00000064u;
         /* 022191B4 */ rbrew_write_f32(cpu->mem, _t547, cpu->f[12]);
   L_022191B8: ; // 0x22191b8
-        /* 022191B8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[11]);
-        /* 022191BC */ _t548 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022191B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[11]));
+        /* 022191BC */ _t548 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022191BC */ _t549 = _t548 & 0x00000001u;
         /* 022191BC */ if (_t549) goto L_022191C0; else goto L_022191C4;
   L_022191C0: ; // 0x22191c0
         /* 022191C0 */ _t550 = cpu->r[1] + 0x00000068u;
         /* 022191C0 */ rbrew_write_f32(cpu->mem, _t550, cpu->f[11]);
   L_022191C4: ; // 0x22191c4
-        /* 022191C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000005u);
+        /* 022191C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000005u));
         /* 022191C8 */ _t551 = cpu->r[1] + 0x00000078u;
         /* 022191C8 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t551);
-        /* 022191CC */ _t552 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022191CC */ _t552 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022191CC */ _t553 = _t552 & 0x00000001u;
         /* 022191CC */ if (_t553) goto L_022191D0; else goto L_022191F8;
   L_022191D0: ; // 0x22191d0
@@ -4157,12 +4157,12 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 022191DC */ rbrew_write_f32(cpu->mem, _t556, cpu->f[12]);
         /* 022191E0 */ _t557 = cpu->r[1] + 0x00000080u;
         /* 022191E0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t557);
-        /* 022191E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000005u);
+        /* 022191E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000005u));
         /* 022191E8 */ _t558 = cpu->r[10] + 0x00000008u;
         /* 022191E8 */ rbrew_write_f32(cpu->mem, _t558, cpu->f[13]);
         /* 022191EC */ _t559 = cpu->r[1] + 0x0000006Cu;
         /* 022191EC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t559);
-        /* 022191F0 */ _t560 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022191F0 */ _t560 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022191F0 */ _t561 = _t560 & 0x00000001u;
         /* 022191F0 */ if (_t561) goto L_02219218; else goto L_022191F4;
   L_022191F4: ; // 0x22191f4
@@ -4176,12 +4176,12 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02219200 */ rbrew_write_f32(cpu->mem, _t564, cpu->f[12]);
         /* 02219204 */ _t565 = cpu->r[1] + 0x00000080u;
         /* 02219204 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t565);
-        /* 02219208 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000005u);
+        /* 02219208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000005u));
         /* 0221920C */ _t566 = cpu->r[20] + 0x00000008u;
         /* 0221920C */ rbrew_write_f32(cpu->mem, _t566, cpu->f[13]);
         /* 02219210 */ _t567 = cpu->r[1] + 0x0000006Cu;
         /* 02219210 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t567);
-        /* 02219214 */ _t568 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219214 */ _t568 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219214 */ _t569 = _t568 & 0x00000001u;
         /* 02219214 */ if (_t569) goto L_02219218; else goto L_02219240;
   L_02219218: ; // 0x2219218
@@ -4199,8 +4199,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02219230 */ _t575 = cpu->r[31] + 0x00000120u;
         /* 02219230 */ cpu->r[4] = rbrew_read32(cpu->mem, _t575);
         /* 02219234 */ cpu->r[4] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 02219234 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 02219238 */ _t576 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219234 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 02219238 */ _t576 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219238 */ _t577 = _t576 & 0x00000001u;
         /* 02219238 */ if (_t577) goto L_02219260; else goto L_0221923C;
   L_0221923C: ; // 0x221923c
@@ -4219,13 +4219,13 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02219254 */ _t583 = cpu->r[31] + 0x00000120u;
         /* 02219254 */ cpu->r[4] = rbrew_read32(cpu->mem, _t583);
         /* 02219258 */ cpu->r[4] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 02219258 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0221925C */ _t584 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219258 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0221925C */ _t584 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221925C */ _t585 = _t584 & 0x00000001u;
         /* 0221925C */ if (_t585) goto L_02219260; else goto L_022193AC;
   L_02219260: ; // 0x2219260
-        /* 02219260 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000005u);
-        /* 02219264 */ _t586 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219260 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000005u));
+        /* 02219264 */ _t586 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219264 */ _t587 = _t586 & 0x00000001u;
         /* 02219264 */ if (_t587) goto L_02219268; else goto L_0221930C;
   L_02219268: ; // 0x2219268
@@ -4287,11 +4287,11 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 022192F0 */ _t609 = cpu->r[1] + 0x00000104u;
         /* 022192F0 */ rbrew_write_f32(cpu->mem, _t609, cpu->f[8]);
         /* 022192F4 */ Gambit_fn_0204A864(cpu);
-        /* 022192F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000005u);
+        /* 022192F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000005u));
         /* 022192FC */ cpu->r[10] = cpu->r[31] + 0x0000019Cu;
         /* 02219300 */ _t610 = cpu->r[31] + 0x000001F0u;
         /* 02219300 */ rbrew_write32(cpu->mem, _t610, cpu->r[3]);
-        /* 02219304 */ _t611 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219304 */ _t611 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219304 */ _t612 = _t611 & 0x00000001u;
         /* 02219304 */ if (_t612) goto L_022194E8; else goto L_02219308;
   L_02219308: ; // 0x2219308
@@ -4354,11 +4354,11 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02219390 */ _t634 = cpu->r[1] + 0x000001ACu;
         /* 02219390 */ rbrew_write32(cpu->mem, _t634, cpu->r[0]);
         /* 02219394 */ Gambit_fn_0204A864(cpu);
-        /* 02219398 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000005u);
+        /* 02219398 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000005u));
         /* 0221939C */ cpu->r[10] = cpu->r[31] + 0x0000019Cu;
         /* 022193A0 */ _t635 = cpu->r[31] + 0x000001F0u;
         /* 022193A0 */ rbrew_write32(cpu->mem, _t635, cpu->r[3]);
-        /* 022193A4 */ _t636 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022193A4 */ _t636 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022193A4 */ _t637 = _t636 & 0x00000001u;
         /* 022193A4 */ if (_t637) goto L_022194E8; else goto L_022193A8;
   L_022193A8: ; // 0x22193a8
@@ -4374,10 +4374,10 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 022193C4 */ cpu->r[5] = cpu->r[18];
         /* 022193C8 */ Gambit_fn_02C69468(cpu);
         /* 022193CC */ /* nop */
-        /* 022193D0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000005u);
+        /* 022193D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000005u));
         /* 022193D4 */ _t639 = cpu->r[1] + 0x000000C0u;
         /* 022193D4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t639);
-        /* 022193D8 */ _t640 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022193D8 */ _t640 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022193D8 */ _t641 = _t640 & 0x00000001u;
         /* 022193D8 */ if (_t641) goto L_022193DC; else goto L_02219460;
   L_022193DC: ; // 0x22193dc
@@ -4477,9 +4477,9 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 022194D8 */ _t671 = cpu->r[31] + 0x000001F0u;
         /* 022194D8 */ rbrew_write32(cpu->mem, _t671, cpu->r[3]);
   L_022194DC: ; // 0x22194dc
-        /* 022194DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000005u);
+        /* 022194DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000005u));
         /* 022194E0 */ cpu->r[10] = cpu->r[31] + 0x0000019Cu;
-        /* 022194E4 */ _t672 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022194E4 */ _t672 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022194E4 */ _t673 = _t672 & 0x00000001u;
         /* 022194E4 */ if (_t673) goto L_022194E8; else goto L_022194FC;
   L_022194E8: ; // 0x22194e8
@@ -4488,8 +4488,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 022194EC */ _t675 = cpu->r[31] + 0x000001F0u;
         /* 022194EC */ cpu->r[12] = rbrew_read32(cpu->mem, _t675);
         /* 022194F0 */ cpu->r[11] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022194F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 022194F4 */ _t676 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022194F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 022194F4 */ _t676 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022194F4 */ _t677 = _t676 & 0x00000001u;
         /* 022194F4 */ if (_t677) goto L_02219530; else goto L_022194F8;
   L_022194F8: ; // 0x22194f8
@@ -4500,8 +4500,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02219500 */ _t679 = cpu->r[31] + 0x000001F0u;
         /* 02219500 */ cpu->r[12] = rbrew_read32(cpu->mem, _t679);
         /* 02219504 */ cpu->r[11] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02219504 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02219508 */ _t680 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219504 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02219508 */ _t680 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219508 */ _t681 = _t680 & 0x00000001u;
         /* 02219508 */ if (_t681) goto L_02219530; else goto L_0221950C;
   L_0221950C: ; // 0x221950c
@@ -4510,13 +4510,13 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02219510 */ _t683 = cpu->r[12] + 0x0000015Cu;
         /* 02219510 */ cpu->r[0] = rbrew_read32(cpu->mem, _t683);
         /* 02219514 */ cpu->r[4] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Cu, 0x0000001Eu);
-        /* 02219514 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 02219518 */ _t684 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219514 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 02219518 */ _t684 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219518 */ _t685 = _t684 & 0x00000001u;
         /* 02219518 */ if (_t685) goto L_02219530; else goto L_0221951C;
   L_0221951C: ; // 0x221951c
-        /* 0221951C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000005u);
-        /* 02219520 */ _t686 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221951C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000005u));
+        /* 02219520 */ _t686 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219520 */ _t687 = _t686 & 0x00000001u;
         /* 02219520 */ if (_t687) goto L_02219524; else goto L_02219528;
   L_02219524: ; // 0x2219524
@@ -4548,9 +4548,9 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02219568 */ _t694 = cpu->r[31] + 0x00000122u;
         /* 02219568 */ cpu->r[5] = rbrew_read8(cpu->mem, _t694);
         /* 0221956C */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02219570 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[5]);
+        /* 02219570 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[5]));
         /* 02219574 */ cpu->r[24] = cpu->r[24] + 0x0000000Cu;
-        /* 02219578 */ _t695 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219578 */ _t695 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219578 */ _t696 = _t695 & 0x00000001u;
         /* 02219578 */ if (_t696) goto L_02218BA4; else goto L_0221957C;
   L_0221957C: ; // 0x221957c
@@ -4575,8 +4575,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 022195A4 */ rbrew_write_f32(cpu->mem, _t704, cpu->f[13]);
         /* 022195A8 */ _t705 = cpu->r[12] + 0x00000000u;
         /* 022195A8 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t705);
-        /* 022195AC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[12]);
-        /* 022195B0 */ _t706 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022195AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[12]));
+        /* 022195B0 */ _t706 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022195B0 */ _t707 = _t706 & 0x00000001u;
         /* 022195B0 */ if (_t707) goto L_022195B4; else goto L_022195C4;
   L_022195B4: ; // 0x22195b4
@@ -4592,8 +4592,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 022195C4 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t711);
         /* 022195C8 */ _t712 = cpu->r[12] + 0x00000004u;
         /* 022195C8 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t712);
-        /* 022195CC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[8]);
-        /* 022195D0 */ _t713 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022195CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[8]));
+        /* 022195D0 */ _t713 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022195D0 */ _t714 = _t713 & 0x00000001u;
         /* 022195D0 */ if (_t714) goto L_022195D4; else goto L_022195E4;
   L_022195D4: ; // 0x22195d4
@@ -4609,8 +4609,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 022195E4 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t718);
         /* 022195E8 */ _t719 = cpu->r[12] + 0x00000008u;
         /* 022195E8 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t719);
-        /* 022195EC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[10]);
-        /* 022195F0 */ _t720 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022195EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[10]));
+        /* 022195F0 */ _t720 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022195F0 */ _t721 = _t720 & 0x00000001u;
         /* 022195F0 */ if (_t721) goto L_022195F4; else goto L_02219604;
   L_022195F4: ; // 0x22195f4
@@ -4622,8 +4622,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02219600 */ _t724 = cpu->r[12] + 0x00000008u;
         /* 02219600 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t724);
   L_02219604: ; // 0x2219604
-        /* 02219604 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[12]);
-        /* 02219608 */ _t725 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[12]));
+        /* 02219608 */ _t725 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219608 */ _t726 = _t725 & 0x00000001u;
         /* 02219608 */ if (_t726) goto L_0221960C; else goto L_02219618;
   L_0221960C: ; // 0x221960c
@@ -4633,8 +4633,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02219614 */ _t728 = cpu->r[1] + 0x00000130u;
         /* 02219614 */ rbrew_write_f32(cpu->mem, _t728, cpu->f[0]);
   L_02219618: ; // 0x2219618
-        /* 02219618 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[8]);
-        /* 0221961C */ _t729 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219618 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[8]));
+        /* 0221961C */ _t729 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221961C */ _t730 = _t729 & 0x00000001u;
         /* 0221961C */ if (_t730) goto L_02219620; else goto L_0221962C;
   L_02219620: ; // 0x2219620
@@ -4644,8 +4644,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02219628 */ _t732 = cpu->r[1] + 0x00000134u;
         /* 02219628 */ rbrew_write_f32(cpu->mem, _t732, cpu->f[11]);
   L_0221962C: ; // 0x221962c
-        /* 0221962C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[10]);
-        /* 02219630 */ _t733 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221962C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[10]));
+        /* 02219630 */ _t733 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219630 */ _t734 = _t733 & 0x00000001u;
         /* 02219630 */ if (_t734) goto L_02219634; else goto L_02219640;
   L_02219634: ; // 0x2219634
@@ -4656,8 +4656,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 0221963C */ rbrew_write_f32(cpu->mem, _t736, cpu->f[13]);
   L_02219640: ; // 0x2219640
         /* 02219640 */ cpu->r[0] = cpu->r[5] + 0xFFFFFFFFu;
-        /* 02219644 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
-        /* 02219648 */ _t737 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219644 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
+        /* 02219648 */ _t737 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219648 */ _t738 = _t737 & 0x00000001u;
         /* 02219648 */ if (_t738) goto L_0221964C; else goto L_02219660;
   L_0221964C: ; // 0x221964c
@@ -4665,8 +4665,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02219650 */ _t739 = cpu->r[11] + cpu->r[20];
         /* 02219650 */ cpu->r[8] = rbrew_read32(cpu->mem, _t739);
         /* 02219650 */ cpu->r[11] = _t739;
-        /* 02219654 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[8]);
-        /* 02219658 */ _t740 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02219654 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[8]));
+        /* 02219658 */ _t740 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02219658 */ _t741 = _t740 & 0x00000001u;
         /* 02219658 */ if (_t741) goto L_02219670; else goto L_0221965C;
   L_0221965C: ; // 0x221965c
@@ -4675,8 +4675,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02219660 */ cpu->r[11] = cpu->r[20];
         /* 02219664 */ _t742 = cpu->r[11] + 0x00000000u;
         /* 02219664 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t742);
-        /* 02219668 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[8]);
-        /* 0221966C */ _t743 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02219668 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[8]));
+        /* 0221966C */ _t743 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221966C */ _t744 = _t743 & 0x00000001u;
         /* 0221966C */ if (_t744) goto L_02219670; else goto L_0221967C;
   L_02219670: ; // 0x2219670
@@ -4689,8 +4689,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
   L_0221967C: ; // 0x221967c
         /* 0221967C */ _t748 = cpu->r[11] + 0x00000004u;
         /* 0221967C */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t748);
-        /* 02219680 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[9]);
-        /* 02219684 */ _t749 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02219680 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[9]));
+        /* 02219684 */ _t749 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02219684 */ _t750 = _t749 & 0x00000001u;
         /* 02219684 */ if (_t750) goto L_02219688; else goto L_02219694;
   L_02219688: ; // 0x2219688
@@ -4703,8 +4703,8 @@ void Gambit_fn_0221987C(CPUState* cpu) {
   L_02219694: ; // 0x2219694
         /* 02219694 */ _t754 = cpu->r[11] + 0x00000008u;
         /* 02219694 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t754);
-        /* 02219698 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[10]);
-        /* 0221969C */ _t755 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02219698 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[10]));
+        /* 0221969C */ _t755 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221969C */ _t756 = _t755 & 0x00000001u;
         /* 0221969C */ if (_t756) goto L_022196A0; else goto L_022196AC;
   L_022196A0: ; // 0x22196a0
@@ -4715,24 +4715,24 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 022196A8 */ _t759 = cpu->r[1] + 0x00000138u;
         /* 022196A8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t759);
   L_022196AC: ; // 0x22196ac
-        /* 022196AC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[8]);
-        /* 022196B0 */ _t760 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022196AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[8]));
+        /* 022196B0 */ _t760 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022196B0 */ _t761 = _t760 & 0x00000001u;
         /* 022196B0 */ if (_t761) goto L_022196B4; else goto L_022196B8;
   L_022196B4: ; // 0x22196b4
         /* 022196B4 */ _t762 = cpu->r[1] + 0x00000130u;
         /* 022196B4 */ rbrew_write_f32(cpu->mem, _t762, cpu->f[8]);
   L_022196B8: ; // 0x22196b8
-        /* 022196B8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[9]);
-        /* 022196BC */ _t763 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022196B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[9]));
+        /* 022196BC */ _t763 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022196BC */ _t764 = _t763 & 0x00000001u;
         /* 022196BC */ if (_t764) goto L_022196C0; else goto L_022196C4;
   L_022196C0: ; // 0x22196c0
         /* 022196C0 */ _t765 = cpu->r[1] + 0x00000134u;
         /* 022196C0 */ rbrew_write_f32(cpu->mem, _t765, cpu->f[9]);
   L_022196C4: ; // 0x22196c4
-        /* 022196C4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[10]);
-        /* 022196C8 */ _t766 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022196C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[10]));
+        /* 022196C8 */ _t766 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022196C8 */ _t767 = _t766 & 0x00000001u;
         /* 022196C8 */ if (_t767) goto L_022196CC; else goto L_022196D0;
   L_022196CC: ; // 0x22196cc
@@ -4791,18 +4791,18 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 0221973C */ _t791 = cpu->r[1] + 0x00000180u;
         /* 0221973C */ rbrew_write_f32(cpu->mem, _t791, cpu->f[4]);
         /* 02219740 */ cpu->r[5] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 02219740 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02219740 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02219744 */ _t792 = cpu->r[1] + 0x0000013Cu;
         /* 02219744 */ rbrew_write_f32(cpu->mem, _t792, cpu->f[10]);
-        /* 02219748 */ _t793 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219748 */ _t793 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219748 */ _t794 = _t793 & 0x00000001u;
         /* 02219748 */ if (_t794) goto L_022197B8; else goto L_0221974C;
   L_0221974C: ; // 0x221974c
         /* 0221974C */ _t795 = cpu->r[31] + 0x0000020Cu;
         /* 0221974C */ cpu->r[7] = rbrew_read32(cpu->mem, _t795);
         /* 02219750 */ cpu->r[7] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x00000014u, 0x00000015u);
-        /* 02219750 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 02219754 */ _t796 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219750 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 02219754 */ _t796 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219754 */ _t797 = _t796 & 0x00000001u;
         /* 02219754 */ if (_t797) goto L_02219758; else goto L_022197B8;
   L_02219758: ; // 0x2219758
@@ -4926,7 +4926,7 @@ void Gambit_fn_0221987C(CPUState* cpu) {
         /* 02219860 */ cpu->f[18] = rbrew_read_f64(cpu->mem, _t847);
         /* 02219864 */ _t848 = cpu->r[1] + 0x000002C0u;
         /* 02219864 */ cpu->f[19] = rbrew_read_f64(cpu->mem, _t848);
-        /* 02219868 */ _t849 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219868 */ _t849 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219868 */ _t850 = _t849 & 0x00000001u;
         /* 02219868 */ if (_t850) goto L_0221986C; // else: addr-0 trap, fall-through
   L_0221986C: ; // 0x221986c
@@ -4964,26 +4964,26 @@ void Gambit_fn_0221988C(CPUState* cpu) {
         /* 022198AC */ cpu->r[12] = rbrew_read32(cpu->mem, _t4);
         /* 022198B0 */ cpu->r[30] = cpu->r[5];
         /* 022198B4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000014u, 0x00000015u);
-        /* 022198B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 022198B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 022198B8 */ cpu->r[31] = cpu->r[6];
-        /* 022198BC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022198BC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022198BC */ _t6 = _t5 & 0x00000001u;
         /* 022198BC */ if (_t6) goto L_022198C0; else goto L_02219A38;
   L_022198C0: ; // 0x22198c0
-        /* 022198C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 022198C4 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022198C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 022198C4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022198C4 */ _t8 = _t7 & 0x00000001u;
         /* 022198C4 */ if (_t8) goto L_022198DC; else goto L_022198C8;
   L_022198C8: ; // 0x22198c8
         /* 022198C8 */ _t9 = cpu->r[29] + 0x00000060u;
         /* 022198C8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t9);
-        /* 022198CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 022198D0 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022198CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 022198D0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022198D0 */ _t11 = _t10 & 0x00000001u;
         /* 022198D0 */ if (_t11) goto L_022198DC; else goto L_022198D4;
   L_022198D4: ; // 0x22198d4
-        /* 022198D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 022198D8 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022198D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 022198D8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022198D8 */ _t13 = _t12 & 0x00000001u;
         /* 022198D8 */ if (_t13) goto L_02219A38; else goto L_022198DC;
   L_022198DC: ; // 0x22198dc
@@ -5015,17 +5015,17 @@ void Gambit_fn_0221988C(CPUState* cpu) {
         /* 02219918 */ _t23 = cpu->r[29] + 0x00000122u;
         /* 02219918 */ cpu->r[0] = rbrew_read8(cpu->mem, _t23);
         /* 0221991C */ cpu->r[26] = 0x00000000u;
-        /* 02219920 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[0]);
+        /* 02219920 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[0]));
         /* 02219924 */ cpu->f[31] = cpu->f[1];
-        /* 02219928 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219928 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219928 */ _t25 = _t24 & 0x00000001u;
         /* 02219928 */ if (_t25) goto L_0221992C; else goto L_022199C0;
   L_0221992C: ; // 0x221992c
         /* 0221992C */ cpu->r[28] = cpu->r[29] + 0x00000124u;
         /* 02219930 */ cpu->r[27] = 0x00000000u;
   L_02219934: ; // 0x2219934
-        /* 02219934 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000005u);
-        /* 02219938 */ _t26 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000005u));
+        /* 02219938 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219938 */ _t27 = _t26 & 0x00000001u;
         /* 02219938 */ if (_t27) goto L_0221993C; else goto L_02219978;
   L_0221993C: ; // 0x221993c
@@ -5048,8 +5048,8 @@ void Gambit_fn_0221988C(CPUState* cpu) {
         /* 02219964 */ _t34 = cpu->r[1] + 0x00000014u;
         /* 02219964 */ rbrew_write_f32(cpu->mem, _t34, cpu->f[0]);
         /* 02219968 */ Gambit_fn_027DE170(cpu);
-        /* 0221996C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02219970 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221996C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02219970 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219970 */ _t36 = _t35 & 0x00000001u;
         /* 02219970 */ if (_t36) goto L_022199AC; else goto L_02219974;
   L_02219974: ; // 0x2219974
@@ -5073,33 +5073,33 @@ void Gambit_fn_0221988C(CPUState* cpu) {
         /* 0221999C */ _t43 = cpu->r[1] + 0x00000014u;
         /* 0221999C */ rbrew_write_f32(cpu->mem, _t43, cpu->f[0]);
         /* 022199A0 */ Gambit_fn_027DE170(cpu);
-        /* 022199A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022199A8 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022199A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022199A8 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022199A8 */ _t45 = _t44 & 0x00000001u;
         /* 022199A8 */ if (_t45) goto L_022199AC; else goto L_02219A14;
   L_022199AC: ; // 0x22199ac
         /* 022199AC */ _t46 = cpu->r[29] + 0x00000122u;
         /* 022199AC */ cpu->r[0] = rbrew_read8(cpu->mem, _t46);
         /* 022199B0 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 022199B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[0]);
+        /* 022199B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[0]));
         /* 022199B8 */ cpu->r[27] = cpu->r[27] + 0x0000000Cu;
-        /* 022199BC */ _t47 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022199BC */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022199BC */ _t48 = _t47 & 0x00000001u;
         /* 022199BC */ if (_t48) goto L_02219934; else goto L_022199C0;
   L_022199C0: ; // 0x22199c0
         /* 022199C0 */ _t49 = cpu->r[29] + 0x00000120u;
         /* 022199C0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t49);
         /* 022199C4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 022199C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022199C8 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022199C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022199C8 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022199C8 */ _t51 = _t50 & 0x00000001u;
         /* 022199C8 */ if (_t51) goto L_02219A38; else goto L_022199CC;
   L_022199CC: ; // 0x22199cc
         /* 022199CC */ _t52 = cpu->r[29] + 0x0000020Cu;
         /* 022199CC */ cpu->r[0] = rbrew_read32(cpu->mem, _t52);
         /* 022199D0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000014u, 0x00000015u);
-        /* 022199D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022199D4 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022199D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022199D4 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022199D4 */ _t54 = _t53 & 0x00000001u;
         /* 022199D4 */ if (_t54) goto L_022199D8; else goto L_02219A38;
   L_022199D8: ; // 0x22199d8
@@ -5124,8 +5124,8 @@ void Gambit_fn_0221988C(CPUState* cpu) {
         /* 02219A04 */ _t62 = cpu->r[1] + 0x00000018u;
         /* 02219A04 */ rbrew_write_f32(cpu->mem, _t62, cpu->f[13]);
         /* 02219A08 */ Gambit_fn_027DE170(cpu);
-        /* 02219A0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02219A10 */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219A0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02219A10 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219A10 */ _t64 = _t63 & 0x00000001u;
         /* 02219A10 */ if (_t64) goto L_02219A38; else goto L_02219A14;
   L_02219A14: ; // 0x2219a14
@@ -5135,7 +5135,7 @@ void Gambit_fn_0221988C(CPUState* cpu) {
         /* 02219A1C */ _t66 = cpu->r[1] + 0x00000038u;
         /* 02219A1C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t66);
         /* 02219A20 */ cpu->r[3] = 0x00000001u;
-        /* 02219A24 */ _t67 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219A24 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219A24 */ _t68 = _t67 & 0x00000001u;
         /* 02219A24 */ if (_t68) goto L_02219A28; // else: addr-0 trap, fall-through
   L_02219A28: ; // 0x2219a28
@@ -5151,7 +5151,7 @@ void Gambit_fn_0221988C(CPUState* cpu) {
         /* 02219A40 */ _t71 = cpu->r[1] + 0x00000038u;
         /* 02219A40 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t71);
         /* 02219A44 */ cpu->r[3] = 0x00000000u;
-        /* 02219A48 */ _t72 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219A48 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219A48 */ _t73 = _t72 & 0x00000001u;
         /* 02219A48 */ if (_t73) goto L_02219A4C; // else: addr-0 trap, fall-through
   L_02219A4C: ; // 0x2219a4c
@@ -5187,33 +5187,33 @@ void Gambit_fn_02219A5C(CPUState* cpu) {
         /* 02219A8C */ Gambit_fn_02019890(cpu);
         /* 02219A90 */ _t4 = cpu->r[1] + 0x0000001Cu;
         /* 02219A90 */ cpu->r[12] = rbrew_read32(cpu->mem, _t4);
-        /* 02219A94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000001u);
-        /* 02219A98 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219A94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000001u));
+        /* 02219A98 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219A98 */ _t6 = _t5 & 0x00000001u;
         /* 02219A98 */ if (_t6) goto L_02219AA8; else goto L_02219A9C;
   L_02219A9C: ; // 0x2219a9c
         /* 02219A9C */ _t7 = cpu->r[28] + 0x0000020Cu;
         /* 02219A9C */ cpu->r[0] = rbrew_read32(cpu->mem, _t7);
         /* 02219AA0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000014u, 0x00000015u);
-        /* 02219AA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02219AA4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219AA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02219AA4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219AA4 */ _t9 = _t8 & 0x00000001u;
         /* 02219AA4 */ if (_t9) goto L_02219AA8; else goto L_02219C20;
   L_02219AA8: ; // 0x2219aa8
-        /* 02219AA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02219AAC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219AA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02219AAC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219AAC */ _t11 = _t10 & 0x00000001u;
         /* 02219AAC */ if (_t11) goto L_02219AC4; else goto L_02219AB0;
   L_02219AB0: ; // 0x2219ab0
         /* 02219AB0 */ _t12 = cpu->r[28] + 0x00000060u;
         /* 02219AB0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 02219AB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02219AB8 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219AB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02219AB8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219AB8 */ _t14 = _t13 & 0x00000001u;
         /* 02219AB8 */ if (_t14) goto L_02219AC4; else goto L_02219ABC;
   L_02219ABC: ; // 0x2219abc
-        /* 02219ABC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[0]);
-        /* 02219AC0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219ABC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[0]));
+        /* 02219AC0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219AC0 */ _t16 = _t15 & 0x00000001u;
         /* 02219AC0 */ if (_t16) goto L_02219C20; else goto L_02219AC4;
   L_02219AC4: ; // 0x2219ac4
@@ -5245,17 +5245,17 @@ void Gambit_fn_02219A5C(CPUState* cpu) {
         /* 02219B00 */ _t26 = cpu->r[28] + 0x00000122u;
         /* 02219B00 */ cpu->r[0] = rbrew_read8(cpu->mem, _t26);
         /* 02219B04 */ cpu->r[26] = 0x00000000u;
-        /* 02219B08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[0]);
+        /* 02219B08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[0]));
         /* 02219B0C */ cpu->f[31] = cpu->f[1];
-        /* 02219B10 */ _t27 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219B10 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219B10 */ _t28 = _t27 & 0x00000001u;
         /* 02219B10 */ if (_t28) goto L_02219B14; else goto L_02219BA8;
   L_02219B14: ; // 0x2219b14
         /* 02219B14 */ cpu->r[29] = cpu->r[28] + 0x00000124u;
         /* 02219B18 */ cpu->r[27] = 0x00000000u;
   L_02219B1C: ; // 0x2219b1c
-        /* 02219B1C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000005u);
-        /* 02219B20 */ _t29 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219B1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000005u));
+        /* 02219B20 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219B20 */ _t30 = _t29 & 0x00000001u;
         /* 02219B20 */ if (_t30) goto L_02219B24; else goto L_02219B60;
   L_02219B24: ; // 0x2219b24
@@ -5278,8 +5278,8 @@ void Gambit_fn_02219A5C(CPUState* cpu) {
         /* 02219B4C */ _t37 = cpu->r[1] + 0x00000014u;
         /* 02219B4C */ rbrew_write_f32(cpu->mem, _t37, cpu->f[0]);
         /* 02219B50 */ Gambit_fn_027DE3CC(cpu);
-        /* 02219B54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02219B58 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219B54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02219B58 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219B58 */ _t39 = _t38 & 0x00000001u;
         /* 02219B58 */ if (_t39) goto L_02219B94; else goto L_02219B5C;
   L_02219B5C: ; // 0x2219b5c
@@ -5303,33 +5303,33 @@ void Gambit_fn_02219A5C(CPUState* cpu) {
         /* 02219B84 */ _t46 = cpu->r[1] + 0x00000014u;
         /* 02219B84 */ rbrew_write_f32(cpu->mem, _t46, cpu->f[0]);
         /* 02219B88 */ Gambit_fn_027DE3CC(cpu);
-        /* 02219B8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02219B90 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219B8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02219B90 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219B90 */ _t48 = _t47 & 0x00000001u;
         /* 02219B90 */ if (_t48) goto L_02219B94; else goto L_02219BFC;
   L_02219B94: ; // 0x2219b94
         /* 02219B94 */ _t49 = cpu->r[28] + 0x00000122u;
         /* 02219B94 */ cpu->r[0] = rbrew_read8(cpu->mem, _t49);
         /* 02219B98 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 02219B9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[0]);
+        /* 02219B9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[0]));
         /* 02219BA0 */ cpu->r[27] = cpu->r[27] + 0x0000000Cu;
-        /* 02219BA4 */ _t50 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219BA4 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219BA4 */ _t51 = _t50 & 0x00000001u;
         /* 02219BA4 */ if (_t51) goto L_02219B1C; else goto L_02219BA8;
   L_02219BA8: ; // 0x2219ba8
         /* 02219BA8 */ _t52 = cpu->r[28] + 0x00000120u;
         /* 02219BA8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t52);
         /* 02219BAC */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 02219BAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02219BB0 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219BAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02219BB0 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219BB0 */ _t54 = _t53 & 0x00000001u;
         /* 02219BB0 */ if (_t54) goto L_02219C20; else goto L_02219BB4;
   L_02219BB4: ; // 0x2219bb4
         /* 02219BB4 */ _t55 = cpu->r[28] + 0x0000020Cu;
         /* 02219BB4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t55);
         /* 02219BB8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000014u, 0x00000015u);
-        /* 02219BB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02219BBC */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219BB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02219BBC */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219BBC */ _t57 = _t56 & 0x00000001u;
         /* 02219BBC */ if (_t57) goto L_02219BC0; else goto L_02219C20;
   L_02219BC0: ; // 0x2219bc0
@@ -5354,8 +5354,8 @@ void Gambit_fn_02219A5C(CPUState* cpu) {
         /* 02219BEC */ _t65 = cpu->r[1] + 0x00000018u;
         /* 02219BEC */ rbrew_write_f32(cpu->mem, _t65, cpu->f[13]);
         /* 02219BF0 */ Gambit_fn_027DE3CC(cpu);
-        /* 02219BF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02219BF8 */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219BF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02219BF8 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219BF8 */ _t67 = _t66 & 0x00000001u;
         /* 02219BF8 */ if (_t67) goto L_02219C20; else goto L_02219BFC;
   L_02219BFC: ; // 0x2219bfc
@@ -5365,7 +5365,7 @@ void Gambit_fn_02219A5C(CPUState* cpu) {
         /* 02219C04 */ _t69 = cpu->r[1] + 0x00000038u;
         /* 02219C04 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t69);
         /* 02219C08 */ cpu->r[3] = 0x00000001u;
-        /* 02219C0C */ _t70 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219C0C */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219C0C */ _t71 = _t70 & 0x00000001u;
         /* 02219C0C */ if (_t71) goto L_02219C10; // else: addr-0 trap, fall-through
   L_02219C10: ; // 0x2219c10
@@ -5381,7 +5381,7 @@ void Gambit_fn_02219A5C(CPUState* cpu) {
         /* 02219C28 */ _t74 = cpu->r[1] + 0x00000038u;
         /* 02219C28 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t74);
         /* 02219C2C */ cpu->r[3] = 0x00000000u;
-        /* 02219C30 */ _t75 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219C30 */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219C30 */ _t76 = _t75 & 0x00000001u;
         /* 02219C30 */ if (_t76) goto L_02219C34; // else: addr-0 trap, fall-through
   L_02219C34: ; // 0x2219c34
@@ -5418,10 +5418,10 @@ void Gambit_fn_02219C44(CPUState* cpu) {
         /* 02219C78 */ _t4 = rbrew_rlwinm(cpu->r[10], 0x0000000Au, 0x00000014u, 0x00000015u);
         /* 02219C78 */ _t5 = cpu->r[12] & 0xFFFFF3FFu;
         /* 02219C78 */ cpu->r[12] = _t5 | _t4;
-        /* 02219C7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02219C7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02219C80 */ _t6 = cpu->r[24] + 0x0000020Cu;
         /* 02219C80 */ rbrew_write32(cpu->mem, _t6, cpu->r[12]);
-        /* 02219C84 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219C84 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219C84 */ _t8 = _t7 & 0x00000001u;
         /* 02219C84 */ if (_t8) goto L_02219C90; else goto L_02219C88;
   L_02219C88: ; // 0x2219c88
@@ -5430,13 +5430,13 @@ void Gambit_fn_02219C44(CPUState* cpu) {
   L_02219C90: ; // 0x2219c90
         /* 02219C90 */ _t9 = cpu->r[24] + 0x00000080u;
         /* 02219C90 */ cpu->r[25] = rbrew_read32(cpu->mem, _t9);
-        /* 02219C94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 02219C98 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219C94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 02219C98 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219C98 */ _t11 = _t10 & 0x00000001u;
         /* 02219C98 */ if (_t11) goto L_02219CCC; else goto L_02219C9C;
   L_02219C9C: ; // 0x2219c9c
-        /* 02219C9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02219CA0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219C9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02219CA0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219CA0 */ _t13 = _t12 & 0x00000001u;
         /* 02219CA0 */ if (_t13) goto L_02219CC4; else goto L_02219CA4;
   L_02219CA4: ; // 0x2219ca4
@@ -5444,8 +5444,8 @@ void Gambit_fn_02219C44(CPUState* cpu) {
         /* 02219CA8 */ Gambit_fn_02019890(cpu);
         /* 02219CAC */ _t14 = cpu->r[1] + 0x00000008u;
         /* 02219CAC */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
-        /* 02219CB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 02219CB4 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219CB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 02219CB4 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219CB4 */ _t16 = _t15 & 0x00000001u;
         /* 02219CB4 */ if (_t16) goto L_02219CC4; else goto L_02219CB8;
   L_02219CB8: ; // 0x2219cb8
@@ -5554,9 +5554,9 @@ void Gambit_fn_02219D28(CPUState* cpu) {
         /* 02219DA8 */ cpu->r[5] = rbrew_read8(cpu->mem, _t15);
         /* 02219DAC */ cpu->r[9] = cpu->r[5] + 0xFFFFFFFFu;
         /* 02219DB0 */ cpu->f[29] = cpu->f[1];
-        /* 02219DB4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000005u);
+        /* 02219DB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000005u));
         /* 02219DB8 */ cpu->r[12] = cpu->r[28] + 0x00000160u;
-        /* 02219DBC */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219DBC */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219DBC */ _t17 = _t16 & 0x00000001u;
         /* 02219DBC */ if (_t17) goto L_02219DC0; else goto L_02219E9C;
   L_02219DC0: ; // 0x2219dc0
@@ -5644,8 +5644,8 @@ void Gambit_fn_02219D28(CPUState* cpu) {
         /* 02219E88 */ cpu->f[9] = fma(cpu->f[0], cpu->f[0], cpu->f[12]);
         /* 02219E8C */ _t49 = cpu->r[11] + 0xFFFFBE2Cu;
         /* 02219E8C */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t49);
-        /* 02219E90 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[30]);
-        /* 02219E94 */ _t50 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02219E90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[30]));
+        /* 02219E94 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02219E94 */ _t51 = _t50 & 0x00000001u;
         /* 02219E94 */ if (_t51) goto L_02219E98; else goto L_02219F98;
   L_02219E98: ; // 0x2219e98
@@ -5730,8 +5730,8 @@ void Gambit_fn_02219D28(CPUState* cpu) {
         /* 02219F54 */ cpu->f[9] = fma(cpu->f[0], cpu->f[0], cpu->f[12]);
         /* 02219F58 */ _t82 = cpu->r[11] + 0xFFFFBE2Cu;
         /* 02219F58 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t82);
-        /* 02219F5C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[30]);
-        /* 02219F60 */ _t83 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02219F5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[30]));
+        /* 02219F60 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02219F60 */ _t84 = _t83 & 0x00000001u;
         /* 02219F60 */ if (_t84) goto L_02219F64; else goto L_02219F98;
   L_02219F64: ; // 0x2219f64
@@ -5780,26 +5780,26 @@ void Gambit_fn_02219D28(CPUState* cpu) {
         /* 02219FD8 */ cpu->f[27] = cpu->f[31];
         /* 02219FDC */ cpu->r[27] = 0x00000004u;
   L_02219FE0: ; // 0x2219fe0
-        /* 02219FE0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], 0x00000001u);
-        /* 02219FE4 */ _t97 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219FE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], 0x00000001u));
+        /* 02219FE4 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219FE4 */ _t98 = _t97 & 0x00000001u;
         /* 02219FE4 */ if (_t98) goto L_0221A004; else goto L_02219FE8;
   L_02219FE8: ; // 0x2219fe8
-        /* 02219FE8 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219FE8 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219FE8 */ _t100 = _t99 & 0x00000001u;
         /* 02219FE8 */ if (_t100) goto L_0221A048; else goto L_02219FEC;
   L_02219FEC: ; // 0x2219fec
-        /* 02219FEC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], 0x00000003u);
-        /* 02219FF0 */ _t101 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219FEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], 0x00000003u));
+        /* 02219FF0 */ _t101 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219FF0 */ _t102 = _t101 & 0x00000001u;
         /* 02219FF0 */ if (_t102) goto L_0221A0AC; else goto L_02219FF4;
   L_02219FF4: ; // 0x2219ff4
-        /* 02219FF4 */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02219FF4 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02219FF4 */ _t104 = _t103 & 0x00000001u;
         /* 02219FF4 */ if (_t104) goto L_0221A110; else goto L_02219FF8;
   L_02219FF8: ; // 0x2219ff8
-        /* 02219FF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000002u);
-        /* 02219FFC */ _t105 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02219FF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000002u));
+        /* 02219FFC */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02219FFC */ _t106 = _t105 & 0x00000001u;
         /* 02219FFC */ if (_t106) goto L_0221A034; else goto L_0221A000;
   L_0221A000: ; // 0x221a000
@@ -5936,7 +5936,7 @@ void Gambit_fn_02219D28(CPUState* cpu) {
         /* 0221A118 */ cpu->r[5] = cpu->r[7] + 0xFFFFFFFFu;
         /* 0221A11C */ _t162 = cpu->r[1] + 0x0000003Cu;
         /* 0221A11C */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t162);
-        /* 0221A120 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], 0x00000005u);
+        /* 0221A120 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], 0x00000005u));
         /* 0221A124 */ _t163 = cpu->r[1] + 0x00000044u;
         /* 0221A124 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t163);
         /* 0221A128 */ _t164 = cpu->r[1] + 0x00000008u;
@@ -5946,7 +5946,7 @@ void Gambit_fn_02219D28(CPUState* cpu) {
         /* 0221A130 */ cpu->r[10] = cpu->r[28] + 0x00000160u;
         /* 0221A134 */ _t166 = cpu->r[1] + 0x00000010u;
         /* 0221A134 */ rbrew_write_f32(cpu->mem, _t166, cpu->f[11]);
-        /* 0221A138 */ _t167 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221A138 */ _t167 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221A138 */ _t168 = _t167 & 0x00000001u;
         /* 0221A138 */ if (_t168) goto L_0221A13C; else goto L_0221A144;
   L_0221A13C: ; // 0x221a13c
@@ -5966,8 +5966,8 @@ void Gambit_fn_02219D28(CPUState* cpu) {
         /* 0221A158 */ _t174 = cpu->r[1] + 0x0000001Cu;
         /* 0221A158 */ rbrew_write_f32(cpu->mem, _t174, cpu->f[12]);
   L_0221A15C: ; // 0x221a15c
-        /* 0221A15C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000002u);
-        /* 0221A160 */ _t175 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221A15C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000002u));
+        /* 0221A160 */ _t175 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221A160 */ _t176 = _t175 & 0x00000001u;
         /* 0221A160 */ if (_t176) goto L_0221A034; else goto L_0221A164;
   L_0221A164: ; // 0x221a164
@@ -6043,8 +6043,8 @@ void Gambit_fn_02219D28(CPUState* cpu) {
         /* 0221A20C */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t203);
         /* 0221A210 */ /* nop */
         /* 0221A214 */ cpu->f[11] = fma(cpu->f[13], cpu->f[9], cpu->f[7]);
-        /* 0221A218 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[30]);
-        /* 0221A21C */ _t204 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221A218 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[30]));
+        /* 0221A21C */ _t204 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221A21C */ _t205 = _t204 & 0x00000001u;
         /* 0221A21C */ if (_t205) goto L_0221A2C0; else goto L_0221A220;
   L_0221A220: ; // 0x221a220
@@ -6094,13 +6094,13 @@ void Gambit_fn_02219D28(CPUState* cpu) {
         /* 0221A28C */ _t222 = cpu->r[1] + 0x00000038u;
         /* 0221A28C */ rbrew_write_f32(cpu->mem, _t222, cpu->f[9]);
         /* 0221A290 */ Gambit_fn_02819768(cpu);
-        /* 0221A294 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[27], cpu->f[30]);
-        /* 0221A298 */ _t223 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221A294 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[27], cpu->f[30]));
+        /* 0221A298 */ _t223 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221A298 */ _t224 = _t223 & 0x00000001u;
         /* 0221A298 */ if (_t224) goto L_0221A2A4; else goto L_0221A29C;
   L_0221A29C: ; // 0x221a29c
-        /* 0221A29C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[27]);
-        /* 0221A2A0 */ _t225 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221A29C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[27]));
+        /* 0221A2A0 */ _t225 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221A2A0 */ _t226 = _t225 & 0x00000001u;
         /* 0221A2A0 */ if (_t226) goto L_0221A2A4; else goto L_0221A2C0;
   L_0221A2A4: ; // 0x221a2a4
@@ -6119,9 +6119,9 @@ void Gambit_fn_02219D28(CPUState* cpu) {
         /* 0221A2BC */ rbrew_write_f32(cpu->mem, _t232, cpu->f[10]);
   L_0221A2C0: ; // 0x221a2c0
         /* 0221A2C0 */ cpu->r[27] = cpu->r[27] + 0xFFFFFFFFu;
-        /* 0221A2C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0221A2C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0221A2C4 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 0221A2C8 */ _t233 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221A2C8 */ _t233 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221A2C8 */ _t234 = _t233 & 0x00000001u;
         /* 0221A2C8 */ if (_t234) goto L_0221A2CC; else goto L_02219FE0;
   L_0221A2CC: ; // 0x221a2cc
@@ -6166,7 +6166,7 @@ void Gambit_fn_02219D28(CPUState* cpu) {
         /* 0221A320 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t251);
         /* 0221A324 */ _t252 = cpu->r[1] + 0x000001B0u;
         /* 0221A324 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t252);
-        /* 0221A328 */ _t253 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221A328 */ _t253 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221A328 */ _t254 = _t253 & 0x00000001u;
         /* 0221A328 */ if (_t254) goto L_0221A32C; // else: addr-0 trap, fall-through
   L_0221A32C: ; // 0x221a32c
@@ -6191,22 +6191,22 @@ void Gambit_fn_0221A33C(CPUState* cpu) {
         /* 0221A350 */ cpu->r[11] = cpu->r[9] + cpu->r[7];
         /* 0221A354 */ _t0 = cpu->r[11] + 0x00000004u;
         /* 0221A354 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t0);
-        /* 0221A358 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0221A35C */ _t1 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221A358 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0221A35C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221A35C */ _t2 = _t1 & 0x00000001u;
         /* 0221A35C */ if (_t2) goto L_0221A360; else goto L_0221A378;
   L_0221A360: ; // 0x221a360
         /* 0221A360 */ _t3 = cpu->r[11] + 0x00000006u;
         /* 0221A360 */ cpu->r[8] = rbrew_read8(cpu->mem, _t3);
-        /* 0221A364 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 0221A368 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221A364 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 0221A368 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221A368 */ _t5 = _t4 & 0x00000001u;
         /* 0221A368 */ if (_t5) goto L_0221A378; else goto L_0221A36C;
   L_0221A36C: ; // 0x221a36c
         /* 0221A36C */ _t6 = cpu->r[11] + 0x00000000u;
         /* 0221A36C */ cpu->r[0] = rbrew_read8(cpu->mem, _t6);
-        /* 0221A370 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[4]);
-        /* 0221A374 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221A370 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[4]));
+        /* 0221A374 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221A374 */ _t8 = _t7 & 0x00000001u;
         /* 0221A374 */ if (_t8) goto L_0221A388; else goto L_0221A378;
   L_0221A378: ; // 0x221a378
@@ -6237,9 +6237,9 @@ void Gambit_fn_0221A390(CPUState* cpu) {
   L_0221A3A4: ; // 0x221a3a4
         /* 0221A3A4 */ _t0 = cpu->r[10] + 0x0000000Cu;
         /* 0221A3A4 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t0);
-        /* 0221A3A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221A3A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221A3AC */ cpu->r[10] = cpu->r[10] + 0x00000008u;
-        /* 0221A3B0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221A3B0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221A3B0 */ _t2 = _t1 & 0x00000001u;
         /* 0221A3B0 */ if (_t2) goto L_0221A3FC; else goto L_0221A3B4;
   L_0221A3B4: ; // 0x221a3b4
@@ -6262,9 +6262,9 @@ void Gambit_fn_0221A390(CPUState* cpu) {
         /* 0221A3D8 */ cpu->r[12] = cpu->r[7] + cpu->r[8];
         /* 0221A3DC */ _t7 = cpu->r[12] + 0x00000004u;
         /* 0221A3DC */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t7);
-        /* 0221A3E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], cpu->r[8]);
+        /* 0221A3E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], cpu->r[8]));
         /* 0221A3E4 */ cpu->r[9] = cpu->r[9] + 0x00000008u;
-        /* 0221A3E8 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221A3E8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221A3E8 */ _t9 = _t8 & 0x00000001u;
         /* 0221A3E8 */ if (_t9) goto L_0221A3EC; else goto L_0221A3F0;
   L_0221A3EC: ; // 0x221a3ec
@@ -6296,8 +6296,8 @@ void Gambit_fn_0221A404(CPUState* cpu) {
         /* 0221A410 */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0221A410 */ cpu->r[1] = _t1;
         /* 0221A414 */ Gambit_fn_0221A33C(cpu);
-        /* 0221A418 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221A41C */ _t2 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221A418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221A41C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221A41C */ _t3 = _t2 & 0x00000001u;
         /* 0221A41C */ if (_t3) goto L_0221A420; else goto L_0221A428;
   L_0221A420: ; // 0x221a420
@@ -6320,8 +6320,8 @@ void Gambit_fn_0221A410(CPUState* cpu) {
         /* 0221A410 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 0221A410 */ cpu->r[1] = _t0;
         /* 0221A414 */ Gambit_fn_0221A33C(cpu);
-        /* 0221A418 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221A41C */ _t1 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221A418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221A41C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221A41C */ _t2 = _t1 & 0x00000001u;
         /* 0221A41C */ if (_t2) goto L_0221A420; else goto L_0221A428;
   L_0221A420: ; // 0x221a420
@@ -6360,9 +6360,9 @@ void Gambit_fn_0221A438(CPUState* cpu) {
         /* 0221A45C */ cpu->r[12] = rbrew_read32(cpu->mem, _t6);
         /* 0221A460 */ _t7 = cpu->r[8] + 0x000002B0u;
         /* 0221A460 */ cpu->r[0] = rbrew_read32(cpu->mem, _t7);
-        /* 0221A464 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
+        /* 0221A464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
         /* 0221A468 */ cpu->r[3] = cpu->r[4];
-        /* 0221A46C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221A46C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221A46C */ _t9 = _t8 & 0x00000001u;
         /* 0221A46C */ if (_t9) goto L_0221A470; else goto L_0221A694;
   L_0221A470: ; // 0x221a470
@@ -6370,10 +6370,10 @@ void Gambit_fn_0221A438(CPUState* cpu) {
         /* 0221A470 */ cpu->r[6] = rbrew_read8(cpu->mem, _t10);
         /* 0221A474 */ cpu->r[0] = cpu->r[6] + 0xFFFFFFFFu;
         /* 0221A478 */ cpu->r[31] = cpu->r[30] + 0x00000124u;
-        /* 0221A47C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
+        /* 0221A47C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
         /* 0221A480 */ _t11 = cpu->r[30] + 0x00000124u;
         /* 0221A480 */ cpu->r[9] = rbrew_read32(cpu->mem, _t11);
-        /* 0221A484 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221A484 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221A484 */ _t13 = _t12 & 0x00000001u;
         /* 0221A484 */ if (_t13) goto L_0221A488; else goto L_0221A4DC;
   L_0221A488: ; // 0x221a488
@@ -6407,10 +6407,10 @@ void Gambit_fn_0221A438(CPUState* cpu) {
         /* 0221A4C4 */ _t25 = cpu->r[30] + 0x00000122u;
         /* 0221A4C4 */ cpu->r[8] = rbrew_read8(cpu->mem, _t25);
         /* 0221A4C8 */ cpu->r[0] = cpu->r[8] + 0xFFFFFFFFu;
-        /* 0221A4CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
+        /* 0221A4CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
         /* 0221A4D0 */ _t26 = cpu->r[31] + 0x00000000u;
         /* 0221A4D0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t26);
-        /* 0221A4D4 */ _t27 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221A4D4 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221A4D4 */ _t28 = _t27 & 0x00000001u;
         /* 0221A4D4 */ if (_t28) goto L_0221A528; else goto L_0221A4D8;
   L_0221A4D8: ; // 0x221a4d8
@@ -6444,10 +6444,10 @@ void Gambit_fn_0221A438(CPUState* cpu) {
         /* 0221A514 */ _t40 = cpu->r[30] + 0x00000122u;
         /* 0221A514 */ cpu->r[8] = rbrew_read8(cpu->mem, _t40);
         /* 0221A518 */ cpu->r[0] = cpu->r[8] + 0xFFFFFFFFu;
-        /* 0221A51C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
+        /* 0221A51C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
         /* 0221A520 */ _t41 = cpu->r[31] + 0x00000000u;
         /* 0221A520 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t41);
-        /* 0221A524 */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221A524 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221A524 */ _t43 = _t42 & 0x00000001u;
         /* 0221A524 */ if (_t43) goto L_0221A528; else goto L_0221A5AC;
   L_0221A528: ; // 0x221a528
@@ -6495,8 +6495,8 @@ void Gambit_fn_0221A438(CPUState* cpu) {
         /* 0221A598 */ Gambit_fn_027B72F0(cpu);
         /* 0221A59C */ _t57 = cpu->r[1] + 0x00000024u;
         /* 0221A59C */ cpu->r[10] = rbrew_read32(cpu->mem, _t57);
-        /* 0221A5A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0221A5A4 */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221A5A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0221A5A4 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221A5A4 */ _t59 = _t58 & 0x00000001u;
         /* 0221A5A4 */ if (_t59) goto L_0221A67C; else goto L_0221A5A8;
   L_0221A5A8: ; // 0x221a5a8
@@ -6540,8 +6540,8 @@ void Gambit_fn_0221A438(CPUState* cpu) {
         /* 0221A60C */ Gambit_fn_027B72F0(cpu);
         /* 0221A610 */ _t71 = cpu->r[1] + 0x00000024u;
         /* 0221A610 */ cpu->r[10] = rbrew_read32(cpu->mem, _t71);
-        /* 0221A614 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0221A618 */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221A614 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0221A618 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221A618 */ _t73 = _t72 & 0x00000001u;
         /* 0221A618 */ if (_t73) goto L_0221A67C; else goto L_0221A61C;
   L_0221A61C: ; // 0x221a61c
@@ -6549,8 +6549,8 @@ void Gambit_fn_0221A438(CPUState* cpu) {
         /* 0221A61C */ cpu->r[6] = rbrew_read32(cpu->mem, _t74);
         /* 0221A620 */ _t75 = cpu->r[1] + 0x00000028u;
         /* 0221A620 */ cpu->r[11] = rbrew_read32(cpu->mem, _t75);
-        /* 0221A624 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[11]);
-        /* 0221A628 */ _t76 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221A624 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[11]));
+        /* 0221A628 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221A628 */ _t77 = _t76 & 0x00000001u;
         /* 0221A628 */ if (_t77) goto L_0221A62C; else goto L_0221A67C;
   L_0221A62C: ; // 0x221a62c
@@ -6638,9 +6638,9 @@ void Gambit_fn_0221A43C(CPUState* cpu) {
         /* 0221A45C */ cpu->r[12] = rbrew_read32(cpu->mem, _t6);
         /* 0221A460 */ _t7 = cpu->r[8] + 0x000002B0u;
         /* 0221A460 */ cpu->r[0] = rbrew_read32(cpu->mem, _t7);
-        /* 0221A464 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
+        /* 0221A464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
         /* 0221A468 */ cpu->r[3] = cpu->r[4];
-        /* 0221A46C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221A46C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221A46C */ _t9 = _t8 & 0x00000001u;
         /* 0221A46C */ if (_t9) goto L_0221A470; else goto L_0221A694;
   L_0221A470: ; // 0x221a470
@@ -6648,10 +6648,10 @@ void Gambit_fn_0221A43C(CPUState* cpu) {
         /* 0221A470 */ cpu->r[6] = rbrew_read8(cpu->mem, _t10);
         /* 0221A474 */ cpu->r[0] = cpu->r[6] + 0xFFFFFFFFu;
         /* 0221A478 */ cpu->r[31] = cpu->r[30] + 0x00000124u;
-        /* 0221A47C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
+        /* 0221A47C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
         /* 0221A480 */ _t11 = cpu->r[30] + 0x00000124u;
         /* 0221A480 */ cpu->r[9] = rbrew_read32(cpu->mem, _t11);
-        /* 0221A484 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221A484 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221A484 */ _t13 = _t12 & 0x00000001u;
         /* 0221A484 */ if (_t13) goto L_0221A488; else goto L_0221A4DC;
   L_0221A488: ; // 0x221a488
@@ -6685,10 +6685,10 @@ void Gambit_fn_0221A43C(CPUState* cpu) {
         /* 0221A4C4 */ _t25 = cpu->r[30] + 0x00000122u;
         /* 0221A4C4 */ cpu->r[8] = rbrew_read8(cpu->mem, _t25);
         /* 0221A4C8 */ cpu->r[0] = cpu->r[8] + 0xFFFFFFFFu;
-        /* 0221A4CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
+        /* 0221A4CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
         /* 0221A4D0 */ _t26 = cpu->r[31] + 0x00000000u;
         /* 0221A4D0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t26);
-        /* 0221A4D4 */ _t27 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221A4D4 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221A4D4 */ _t28 = _t27 & 0x00000001u;
         /* 0221A4D4 */ if (_t28) goto L_0221A528; else goto L_0221A4D8;
   L_0221A4D8: ; // 0x221a4d8
@@ -6722,10 +6722,10 @@ void Gambit_fn_0221A43C(CPUState* cpu) {
         /* 0221A514 */ _t40 = cpu->r[30] + 0x00000122u;
         /* 0221A514 */ cpu->r[8] = rbrew_read8(cpu->mem, _t40);
         /* 0221A518 */ cpu->r[0] = cpu->r[8] + 0xFFFFFFFFu;
-        /* 0221A51C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
+        /* 0221A51C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
         /* 0221A520 */ _t41 = cpu->r[31] + 0x00000000u;
         /* 0221A520 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t41);
-        /* 0221A524 */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221A524 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221A524 */ _t43 = _t42 & 0x00000001u;
         /* 0221A524 */ if (_t43) goto L_0221A528; else goto L_0221A5AC;
   L_0221A528: ; // 0x221a528
@@ -6773,8 +6773,8 @@ void Gambit_fn_0221A43C(CPUState* cpu) {
         /* 0221A598 */ Gambit_fn_027B72F0(cpu);
         /* 0221A59C */ _t57 = cpu->r[1] + 0x00000024u;
         /* 0221A59C */ cpu->r[10] = rbrew_read32(cpu->mem, _t57);
-        /* 0221A5A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0221A5A4 */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221A5A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0221A5A4 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221A5A4 */ _t59 = _t58 & 0x00000001u;
         /* 0221A5A4 */ if (_t59) goto L_0221A67C; else goto L_0221A5A8;
   L_0221A5A8: ; // 0x221a5a8
@@ -6818,8 +6818,8 @@ void Gambit_fn_0221A43C(CPUState* cpu) {
         /* 0221A60C */ Gambit_fn_027B72F0(cpu);
         /* 0221A610 */ _t71 = cpu->r[1] + 0x00000024u;
         /* 0221A610 */ cpu->r[10] = rbrew_read32(cpu->mem, _t71);
-        /* 0221A614 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0221A618 */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221A614 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0221A618 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221A618 */ _t73 = _t72 & 0x00000001u;
         /* 0221A618 */ if (_t73) goto L_0221A67C; else goto L_0221A61C;
   L_0221A61C: ; // 0x221a61c
@@ -6827,8 +6827,8 @@ void Gambit_fn_0221A43C(CPUState* cpu) {
         /* 0221A61C */ cpu->r[6] = rbrew_read32(cpu->mem, _t74);
         /* 0221A620 */ _t75 = cpu->r[1] + 0x00000028u;
         /* 0221A620 */ cpu->r[11] = rbrew_read32(cpu->mem, _t75);
-        /* 0221A624 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[11]);
-        /* 0221A628 */ _t76 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221A624 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[11]));
+        /* 0221A628 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221A628 */ _t77 = _t76 & 0x00000001u;
         /* 0221A628 */ if (_t77) goto L_0221A62C; else goto L_0221A67C;
   L_0221A62C: ; // 0x221a62c
@@ -6907,9 +6907,9 @@ void Gambit_fn_0221A6AC(CPUState* cpu) {
         /* 0221A6BC */ cpu->r[30] = cpu->r[3];
         /* 0221A6C0 */ _t2 = cpu->r[30] + 0x00000051u;
         /* 0221A6C0 */ cpu->r[10] = rbrew_read8(cpu->mem, _t2);
-        /* 0221A6C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0221A6C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0221A6C8 */ cpu->r[31] = cpu->r[4];
-        /* 0221A6CC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221A6CC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221A6CC */ _t4 = _t3 & 0x00000001u;
         /* 0221A6CC */ if (_t4) goto L_0221A76C; else goto L_0221A6D0;
   L_0221A6D0: ; // 0x221a6d0
@@ -6919,8 +6919,8 @@ void Gambit_fn_0221A6AC(CPUState* cpu) {
         /* 0221A6D8 */ _t6 = cpu->r[6] + 0x00006338u;
         /* 0221A6D8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t6);
         /* 0221A6D8 */ cpu->r[6] = _t6;
-        /* 0221A6DC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 0221A6E0 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221A6DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 0221A6E0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221A6E0 */ _t8 = _t7 & 0x00000001u;
         /* 0221A6E0 */ if (_t8) goto L_0221A6E4; else goto L_0221A704;
   L_0221A6E4: ; // 0x221a6e4
@@ -6928,8 +6928,8 @@ void Gambit_fn_0221A6AC(CPUState* cpu) {
         /* 0221A6E4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t9);
         /* 0221A6E8 */ _t10 = cpu->r[6] + 0x00000004u;
         /* 0221A6E8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t10);
-        /* 0221A6EC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
-        /* 0221A6F0 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221A6EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
+        /* 0221A6F0 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221A6F0 */ _t12 = _t11 & 0x00000001u;
         /* 0221A6F0 */ if (_t12) goto L_0221A6F4; else goto L_0221A704;
   L_0221A6F4: ; // 0x221a6f4
@@ -6937,8 +6937,8 @@ void Gambit_fn_0221A6AC(CPUState* cpu) {
         /* 0221A6F4 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t13);
         /* 0221A6F8 */ _t14 = cpu->r[6] + 0x00000008u;
         /* 0221A6F8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t14);
-        /* 0221A6FC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 0221A700 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221A6FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 0221A700 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221A700 */ _t16 = _t15 & 0x00000001u;
         /* 0221A700 */ if (_t16) goto L_0221A76C; else goto L_0221A704;
   L_0221A704: ; // 0x221a704
@@ -7019,10 +7019,10 @@ void Gambit_fn_0221A780(CPUState* cpu) {
         /* 0221A7C0 */ cpu->r[0] = 0x00000000u;
         /* 0221A7C4 */ _t6 = cpu->r[11] + 0x00000006u;
         /* 0221A7C4 */ rbrew_write8(cpu->mem, _t6, (uint8_t)cpu->r[12]);
-        /* 0221A7C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0221A7C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0221A7CC */ _t7 = cpu->r[11] + 0x00000007u;
         /* 0221A7CC */ rbrew_write8(cpu->mem, _t7, (uint8_t)cpu->r[0]);
-        /* 0221A7D0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221A7D0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221A7D0 */ _t9 = _t8 & 0x00000001u;
         /* 0221A7D0 */ if (_t9) goto L_0221A7E0; else goto L_0221A7D4;
   L_0221A7D4: ; // 0x221a7d4
@@ -7075,10 +7075,10 @@ void Gambit_fn_0221A784(CPUState* cpu) {
         /* 0221A7C0 */ cpu->r[0] = 0x00000000u;
         /* 0221A7C4 */ _t6 = cpu->r[11] + 0x00000006u;
         /* 0221A7C4 */ rbrew_write8(cpu->mem, _t6, (uint8_t)cpu->r[12]);
-        /* 0221A7C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0221A7C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0221A7CC */ _t7 = cpu->r[11] + 0x00000007u;
         /* 0221A7CC */ rbrew_write8(cpu->mem, _t7, (uint8_t)cpu->r[0]);
-        /* 0221A7D0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221A7D0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221A7D0 */ _t9 = _t8 & 0x00000001u;
         /* 0221A7D0 */ if (_t9) goto L_0221A7E0; else goto L_0221A7D4;
   L_0221A7D4: ; // 0x221a7d4
@@ -7157,9 +7157,9 @@ void Gambit_fn_0221A804(CPUState* cpu) {
         /* 0221A880 */ _t16 = cpu->r[27] + 0x00000120u;
         /* 0221A880 */ cpu->r[0] = rbrew_read32(cpu->mem, _t16);
         /* 0221A884 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 0221A884 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221A884 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221A888 */ cpu->r[31] = 0x00000000u;
-        /* 0221A88C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221A88C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221A88C */ _t18 = _t17 & 0x00000001u;
         /* 0221A88C */ if (_t18) goto L_0221A8A8; else goto L_0221A890;
   L_0221A890: ; // 0x221a890
@@ -7167,8 +7167,8 @@ void Gambit_fn_0221A804(CPUState* cpu) {
         /* 0221A894 */ Gambit_fn_02019890(cpu);
         /* 0221A898 */ _t19 = cpu->r[1] + 0x0000002Cu;
         /* 0221A898 */ cpu->r[6] = rbrew_read32(cpu->mem, _t19);
-        /* 0221A89C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000001u);
-        /* 0221A8A0 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221A89C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000001u));
+        /* 0221A8A0 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221A8A0 */ _t21 = _t20 & 0x00000001u;
         /* 0221A8A0 */ if (_t21) goto L_0221A8A4; else goto L_0221A8A8;
   L_0221A8A4: ; // 0x221a8a4
@@ -7247,17 +7247,17 @@ void Gambit_fn_0221A804(CPUState* cpu) {
         /* 0221A96C */ _t43 = cpu->r[5] + 0xFFFFC020u;
         /* 0221A96C */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t43);
         /* 0221A970 */ cpu->r[12] = 0x10050000u;
-        /* 0221A974 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[25], cpu->f[30]);
+        /* 0221A974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[25], cpu->f[30]));
         /* 0221A978 */ _t44 = cpu->r[12] + 0xFFFFBE20u;
         /* 0221A978 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t44);
         /* 0221A97C */ cpu->f[27] = cpu->f[1];
-        /* 0221A980 */ _t45 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221A980 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221A980 */ _t46 = _t45 & 0x00000001u;
         /* 0221A980 */ if (_t46) goto L_0221A984; else goto L_0221AA48;
   L_0221A984: ; // 0x221a984
         /* 0221A984 */ cpu->f[0] = cpu->f[26] * cpu->f[26];
-        /* 0221A988 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[25], cpu->f[0]);
-        /* 0221A98C */ _t47 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221A988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[25], cpu->f[0]));
+        /* 0221A98C */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221A98C */ _t48 = _t47 & 0x00000001u;
         /* 0221A98C */ if (_t48) goto L_0221A990; else goto L_0221A9E4;
   L_0221A990: ; // 0x221a990
@@ -7270,8 +7270,8 @@ void Gambit_fn_0221A804(CPUState* cpu) {
         /* 0221A9A0 */ _t51 = cpu->r[1] + 0x00000010u;
         /* 0221A9A0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t51);
         /* 0221A9A4 */ cpu->f[10] = fma(cpu->f[0], cpu->f[0], cpu->f[9]);
-        /* 0221A9A8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[30]);
-        /* 0221A9AC */ _t52 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221A9A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[30]));
+        /* 0221A9AC */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221A9AC */ _t53 = _t52 & 0x00000001u;
         /* 0221A9AC */ if (_t53) goto L_0221A9B0; else goto L_0221AAF0;
   L_0221A9B0: ; // 0x221a9b0
@@ -7294,8 +7294,8 @@ void Gambit_fn_0221A804(CPUState* cpu) {
         /* 0221A9E0 */ goto L_0221AAF0;
   L_0221A9E4: ; // 0x221a9e4
         /* 0221A9E4 */ cpu->f[12] = cpu->f[27] * cpu->f[27];
-        /* 0221A9E8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[25], cpu->f[12]);
-        /* 0221A9EC */ _t58 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221A9E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[25], cpu->f[12]));
+        /* 0221A9EC */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221A9EC */ _t59 = _t58 & 0x00000001u;
         /* 0221A9EC */ if (_t59) goto L_0221A9F0; else goto L_0221AAF0;
   L_0221A9F0: ; // 0x221a9f0
@@ -7308,8 +7308,8 @@ void Gambit_fn_0221A804(CPUState* cpu) {
         /* 0221AA00 */ _t62 = cpu->r[1] + 0x00000010u;
         /* 0221AA00 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t62);
         /* 0221AA04 */ cpu->f[7] = fma(cpu->f[0], cpu->f[0], cpu->f[10]);
-        /* 0221AA08 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[30]);
-        /* 0221AA0C */ _t63 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221AA08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[30]));
+        /* 0221AA0C */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221AA0C */ _t64 = _t63 & 0x00000001u;
         /* 0221AA0C */ if (_t64) goto L_0221AA10; else goto L_0221AAF0;
   L_0221AA10: ; // 0x221aa10
@@ -7375,10 +7375,10 @@ void Gambit_fn_0221A804(CPUState* cpu) {
         /* 0221AAAC */ cpu->f[10] = fma(cpu->f[0], cpu->f[0], cpu->f[13]);
         /* 0221AAB0 */ _t84 = cpu->r[1] + 0x00000008u;
         /* 0221AAB0 */ rbrew_write_f32(cpu->mem, _t84, cpu->f[8]);
-        /* 0221AAB4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[30]);
+        /* 0221AAB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[30]));
         /* 0221AAB8 */ _t85 = cpu->r[1] + 0x00000010u;
         /* 0221AAB8 */ rbrew_write_f32(cpu->mem, _t85, cpu->f[0]);
-        /* 0221AABC */ _t86 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221AABC */ _t86 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221AABC */ _t87 = _t86 & 0x00000001u;
         /* 0221AABC */ if (_t87) goto L_0221AAC0; else goto L_0221AAF0;
   L_0221AAC0: ; // 0x221aac0
@@ -7422,10 +7422,10 @@ void Gambit_fn_0221A804(CPUState* cpu) {
         /* 0221AB28 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t97);
         /* 0221AB2C */ /* nop */
         /* 0221AB30 */ cpu->f[0] = fma(cpu->f[12], cpu->f[13], cpu->f[10]);
-        /* 0221AB34 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[30]);
+        /* 0221AB34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[30]));
         /* 0221AB38 */ _t98 = cpu->r[1] + 0x00000028u;
         /* 0221AB38 */ rbrew_write_f32(cpu->mem, _t98, cpu->f[12]);
-        /* 0221AB3C */ _t99 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221AB3C */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221AB3C */ _t100 = _t99 & 0x00000001u;
         /* 0221AB3C */ if (_t100) goto L_0221AB40; else goto L_0221AC74;
   L_0221AB40: ; // 0x221ab40
@@ -7442,8 +7442,8 @@ void Gambit_fn_0221A804(CPUState* cpu) {
         /* 0221AB60 */ _t103 = cpu->r[1] + 0x0000001Cu;
         /* 0221AB60 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t103);
         /* 0221AB64 */ cpu->f[12] = fma(cpu->f[10], cpu->f[10], cpu->f[8]);
-        /* 0221AB68 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[30]);
-        /* 0221AB6C */ _t104 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221AB68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[30]));
+        /* 0221AB6C */ _t104 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221AB6C */ _t105 = _t104 & 0x00000001u;
         /* 0221AB6C */ if (_t105) goto L_0221AB98; else goto L_0221AB70;
   L_0221AB70: ; // 0x221ab70
@@ -7454,9 +7454,9 @@ void Gambit_fn_0221A804(CPUState* cpu) {
         /* 0221AB7C */ /* nop */
         /* 0221AB80 */ /* nop */
         /* 0221AB84 */ cpu->f[9] = fma(cpu->f[8], cpu->f[10], cpu->f[13]);
-        /* 0221AB88 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[30]);
+        /* 0221AB88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[30]));
         /* 0221AB8C */ cpu->r[31] = 0x00000001u;
-        /* 0221AB90 */ _t107 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221AB90 */ _t107 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221AB90 */ _t108 = _t107 & 0x00000001u;
         /* 0221AB90 */ if (_t108) goto L_0221AB94; else goto L_0221ABF8;
   L_0221AB94: ; // 0x221ab94
@@ -7482,10 +7482,10 @@ void Gambit_fn_0221A804(CPUState* cpu) {
         /* 0221ABC8 */ rbrew_write_f32(cpu->mem, _t113, cpu->f[10]);
         /* 0221ABCC */ /* nop */
         /* 0221ABD0 */ cpu->f[9] = fma(cpu->f[8], cpu->f[10], cpu->f[13]);
-        /* 0221ABD4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[30]);
+        /* 0221ABD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[30]));
         /* 0221ABD8 */ /* nop */
         /* 0221ABDC */ cpu->r[31] = 0x00000001u;
-        /* 0221ABE0 */ _t114 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221ABE0 */ _t114 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221ABE0 */ _t115 = _t114 & 0x00000001u;
         /* 0221ABE0 */ if (_t115) goto L_0221ABE4; else goto L_0221ABF8;
   L_0221ABE4: ; // 0x221abe4
@@ -7522,8 +7522,8 @@ void Gambit_fn_0221A804(CPUState* cpu) {
         /* 0221AC38 */ Gambit_fn_02C69350(cpu);
         /* 0221AC3C */ cpu->f[2] = cpu->f[30];
         /* 0221AC40 */ Gambit_fn_02C89074(cpu);
-        /* 0221AC44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0221AC48 */ _t124 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221AC44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0221AC48 */ _t124 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221AC48 */ _t125 = _t124 & 0x00000001u;
         /* 0221AC48 */ if (_t125) goto L_0221AC4C; else goto L_0221AC54;
   L_0221AC4C: ; // 0x221ac4c
@@ -7581,7 +7581,7 @@ void Gambit_fn_0221A804(CPUState* cpu) {
         /* 0221ACC0 */ cpu->f[25] = rbrew_read_f64(cpu->mem, _t145);
         /* 0221ACC4 */ _t146 = cpu->r[1] + 0x00000138u;
         /* 0221ACC4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t146);
-        /* 0221ACC8 */ _t147 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221ACC8 */ _t147 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221ACC8 */ _t148 = _t147 & 0x00000001u;
         /* 0221ACC8 */ if (_t148) goto L_0221ACCC; // else: addr-0 trap, fall-through
   L_0221ACCC: ; // 0x221accc
@@ -7606,22 +7606,22 @@ void Gambit_fn_0221ACDC(CPUState* cpu) {
         /* 0221ACF0 */ cpu->r[11] = cpu->r[9] + cpu->r[7];
         /* 0221ACF4 */ _t0 = cpu->r[11] + 0x00000004u;
         /* 0221ACF4 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t0);
-        /* 0221ACF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0221ACFC */ _t1 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221ACF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0221ACFC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221ACFC */ _t2 = _t1 & 0x00000001u;
         /* 0221ACFC */ if (_t2) goto L_0221AD00; else goto L_0221AD18;
   L_0221AD00: ; // 0x221ad00
         /* 0221AD00 */ _t3 = cpu->r[11] + 0x00000006u;
         /* 0221AD00 */ cpu->r[8] = rbrew_read8(cpu->mem, _t3);
-        /* 0221AD04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 0221AD08 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221AD04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 0221AD08 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221AD08 */ _t5 = _t4 & 0x00000001u;
         /* 0221AD08 */ if (_t5) goto L_0221AD0C; else goto L_0221AD18;
   L_0221AD0C: ; // 0x221ad0c
         /* 0221AD0C */ _t6 = cpu->r[11] + 0x00000000u;
         /* 0221AD0C */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 0221AD10 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[4]);
-        /* 0221AD14 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221AD10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[4]));
+        /* 0221AD14 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221AD14 */ _t8 = _t7 & 0x00000001u;
         /* 0221AD14 */ if (_t8) goto L_0221AD28; else goto L_0221AD18;
   L_0221AD18: ; // 0x221ad18
@@ -7652,8 +7652,8 @@ void Gambit_fn_0221AD30(CPUState* cpu) {
         /* 0221AD3C */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0221AD3C */ cpu->r[1] = _t1;
         /* 0221AD40 */ Gambit_fn_0221ACDC(cpu);
-        /* 0221AD44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221AD48 */ _t2 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221AD44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221AD48 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221AD48 */ _t3 = _t2 & 0x00000001u;
         /* 0221AD48 */ if (_t3) goto L_0221AD4C; else goto L_0221AD54;
   L_0221AD4C: ; // 0x221ad4c
@@ -7676,8 +7676,8 @@ void Gambit_fn_0221AD3C(CPUState* cpu) {
         /* 0221AD3C */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 0221AD3C */ cpu->r[1] = _t0;
         /* 0221AD40 */ Gambit_fn_0221ACDC(cpu);
-        /* 0221AD44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221AD48 */ _t1 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221AD44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221AD48 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221AD48 */ _t2 = _t1 & 0x00000001u;
         /* 0221AD48 */ if (_t2) goto L_0221AD4C; else goto L_0221AD54;
   L_0221AD4C: ; // 0x221ad4c
@@ -7712,17 +7712,17 @@ void Gambit_fn_0221AD64(CPUState* cpu) {
         /* 0221AD80 */ cpu->r[8] = rbrew_read32(cpu->mem, _t4);
         /* 0221AD84 */ cpu->r[4] = cpu->r[5];
         /* 0221AD88 */ cpu->r[8] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 0221AD88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0221AD88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0221AD8C */ cpu->r[5] = cpu->r[6];
-        /* 0221AD90 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221AD90 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221AD90 */ _t6 = _t5 & 0x00000001u;
         /* 0221AD90 */ if (_t6) goto L_0221ADA0; else goto L_0221AD94;
   L_0221AD94: ; // 0x221ad94
         /* 0221AD94 */ _t7 = cpu->r[30] + 0x0000020Cu;
         /* 0221AD94 */ cpu->r[0] = rbrew_read32(cpu->mem, _t7);
         /* 0221AD98 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000014u, 0x00000015u);
-        /* 0221AD98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0221AD9C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221AD98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0221AD9C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221AD9C */ _t9 = _t8 & 0x00000001u;
         /* 0221AD9C */ if (_t9) goto L_0221ADA0; else goto L_0221ADC8;
   L_0221ADA0: ; // 0x221ada0
@@ -7742,8 +7742,8 @@ void Gambit_fn_0221AD64(CPUState* cpu) {
         /* 0221ADC4 */ _t13 = cpu->r[10] + 0x00000007u;
         /* 0221ADC4 */ rbrew_write8(cpu->mem, _t13, (uint8_t)cpu->r[0]);
   L_0221ADC8: ; // 0x221adc8
-        /* 0221ADC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 0221ADCC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221ADC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 0221ADCC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221ADCC */ _t15 = _t14 & 0x00000001u;
         /* 0221ADCC */ if (_t15) goto L_0221ADDC; else goto L_0221ADD0;
   L_0221ADD0: ; // 0x221add0
@@ -7785,17 +7785,17 @@ void Gambit_fn_0221AD68(CPUState* cpu) {
         /* 0221AD80 */ cpu->r[8] = rbrew_read32(cpu->mem, _t4);
         /* 0221AD84 */ cpu->r[4] = cpu->r[5];
         /* 0221AD88 */ cpu->r[8] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 0221AD88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0221AD88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0221AD8C */ cpu->r[5] = cpu->r[6];
-        /* 0221AD90 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221AD90 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221AD90 */ _t6 = _t5 & 0x00000001u;
         /* 0221AD90 */ if (_t6) goto L_0221ADA0; else goto L_0221AD94;
   L_0221AD94: ; // 0x221ad94
         /* 0221AD94 */ _t7 = cpu->r[30] + 0x0000020Cu;
         /* 0221AD94 */ cpu->r[0] = rbrew_read32(cpu->mem, _t7);
         /* 0221AD98 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000014u, 0x00000015u);
-        /* 0221AD98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0221AD9C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221AD98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0221AD9C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221AD9C */ _t9 = _t8 & 0x00000001u;
         /* 0221AD9C */ if (_t9) goto L_0221ADA0; else goto L_0221ADC8;
   L_0221ADA0: ; // 0x221ada0
@@ -7815,8 +7815,8 @@ void Gambit_fn_0221AD68(CPUState* cpu) {
         /* 0221ADC4 */ _t13 = cpu->r[10] + 0x00000007u;
         /* 0221ADC4 */ rbrew_write8(cpu->mem, _t13, (uint8_t)cpu->r[0]);
   L_0221ADC8: ; // 0x221adc8
-        /* 0221ADC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 0221ADCC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221ADC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 0221ADCC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221ADCC */ _t15 = _t14 & 0x00000001u;
         /* 0221ADCC */ if (_t15) goto L_0221ADDC; else goto L_0221ADD0;
   L_0221ADD0: ; // 0x221add0
@@ -7863,9 +7863,9 @@ void Gambit_fn_0221AE00(CPUState* cpu) {
         /* 0221AE24 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
         /* 0221AE28 */ cpu->r[31] = cpu->r[6];
         /* 0221AE2C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 0221AE2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221AE2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221AE30 */ cpu->r[30] = cpu->r[5];
-        /* 0221AE34 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221AE34 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221AE34 */ _t8 = _t7 & 0x00000001u;
         /* 0221AE34 */ if (_t8) goto L_0221AE88; else goto L_0221AE38;
   L_0221AE38: ; // 0x221ae38
@@ -7874,9 +7874,9 @@ void Gambit_fn_0221AE00(CPUState* cpu) {
         /* 0221AE3C */ cpu->r[7] = rbrew_read32(cpu->mem, _t9);
         /* 0221AE3C */ cpu->r[11] = _t9;
         /* 0221AE40 */ cpu->r[4] = 0x101D0000u;
-        /* 0221AE44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0221AE44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0221AE48 */ cpu->r[4] = cpu->r[4] + 0xFFFFFF44u;
-        /* 0221AE4C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221AE4C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221AE4C */ _t11 = _t10 & 0x00000001u;
         /* 0221AE4C */ if (_t11) goto L_0221AE50; else goto L_0221AE64;
   L_0221AE50: ; // 0x221ae50
@@ -7888,8 +7888,8 @@ void Gambit_fn_0221AE00(CPUState* cpu) {
         /* 0221AE60 */ _t13 = cpu->r[4] + 0x00000000u;
         /* 0221AE60 */ rbrew_write32(cpu->mem, _t13, cpu->r[0]);
   L_0221AE64: ; // 0x221ae64
-        /* 0221AE64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0221AE68 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221AE64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0221AE68 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221AE68 */ _t15 = _t14 & 0x00000001u;
         /* 0221AE68 */ if (_t15) goto L_0221AE88; else goto L_0221AE6C;
   L_0221AE6C: ; // 0x221ae6c
@@ -7900,8 +7900,8 @@ void Gambit_fn_0221AE00(CPUState* cpu) {
         /* 0221AE74 */ cpu->ctr = cpu->r[0];
         /* 0221AE78 */ cpu->r[3] = cpu->r[30];
         /* 0221AE7C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0221AE80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221AE84 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221AE80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221AE84 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221AE84 */ _t19 = _t18 & 0x00000001u;
         /* 0221AE84 */ if (_t19) goto L_0221AE88; else goto L_0221AEB8;
   L_0221AE88: ; // 0x221ae88
@@ -7909,9 +7909,9 @@ void Gambit_fn_0221AE00(CPUState* cpu) {
         /* 0221AE8C */ cpu->r[5] = cpu->r[29];
         /* 0221AE90 */ cpu->r[3] = cpu->r[28];
         /* 0221AE94 */ Gambit_fn_0221A804(cpu);
-        /* 0221AE98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0221AE98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0221AE9C */ cpu->r[6] = 0x00000000u;
-        /* 0221AEA0 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221AEA0 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221AEA0 */ _t21 = _t20 & 0x00000001u;
         /* 0221AEA0 */ if (_t21) goto L_0221AEA8; else goto L_0221AEA4;
   L_0221AEA4: ; // 0x221aea4
@@ -7961,9 +7961,9 @@ void Gambit_fn_0221AE04(CPUState* cpu) {
         /* 0221AE24 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
         /* 0221AE28 */ cpu->r[31] = cpu->r[6];
         /* 0221AE2C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 0221AE2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221AE2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221AE30 */ cpu->r[30] = cpu->r[5];
-        /* 0221AE34 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221AE34 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221AE34 */ _t8 = _t7 & 0x00000001u;
         /* 0221AE34 */ if (_t8) goto L_0221AE88; else goto L_0221AE38;
   L_0221AE38: ; // 0x221ae38
@@ -7972,9 +7972,9 @@ void Gambit_fn_0221AE04(CPUState* cpu) {
         /* 0221AE3C */ cpu->r[7] = rbrew_read32(cpu->mem, _t9);
         /* 0221AE3C */ cpu->r[11] = _t9;
         /* 0221AE40 */ cpu->r[4] = 0x101D0000u;
-        /* 0221AE44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0221AE44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0221AE48 */ cpu->r[4] = cpu->r[4] + 0xFFFFFF44u;
-        /* 0221AE4C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221AE4C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221AE4C */ _t11 = _t10 & 0x00000001u;
         /* 0221AE4C */ if (_t11) goto L_0221AE50; else goto L_0221AE64;
   L_0221AE50: ; // 0x221ae50
@@ -7986,8 +7986,8 @@ void Gambit_fn_0221AE04(CPUState* cpu) {
         /* 0221AE60 */ _t13 = cpu->r[4] + 0x00000000u;
         /* 0221AE60 */ rbrew_write32(cpu->mem, _t13, cpu->r[0]);
   L_0221AE64: ; // 0x221ae64
-        /* 0221AE64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0221AE68 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221AE64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0221AE68 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221AE68 */ _t15 = _t14 & 0x00000001u;
         /* 0221AE68 */ if (_t15) goto L_0221AE88; else goto L_0221AE6C;
   L_0221AE6C: ; // 0x221ae6c
@@ -7998,8 +7998,8 @@ void Gambit_fn_0221AE04(CPUState* cpu) {
         /* 0221AE74 */ cpu->ctr = cpu->r[0];
         /* 0221AE78 */ cpu->r[3] = cpu->r[30];
         /* 0221AE7C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0221AE80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221AE84 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221AE80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221AE84 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221AE84 */ _t19 = _t18 & 0x00000001u;
         /* 0221AE84 */ if (_t19) goto L_0221AE88; else goto L_0221AEB8;
   L_0221AE88: ; // 0x221ae88
@@ -8007,9 +8007,9 @@ void Gambit_fn_0221AE04(CPUState* cpu) {
         /* 0221AE8C */ cpu->r[5] = cpu->r[29];
         /* 0221AE90 */ cpu->r[3] = cpu->r[28];
         /* 0221AE94 */ Gambit_fn_0221A804(cpu);
-        /* 0221AE98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0221AE98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0221AE9C */ cpu->r[6] = 0x00000000u;
-        /* 0221AEA0 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221AEA0 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221AEA0 */ _t21 = _t20 & 0x00000001u;
         /* 0221AEA0 */ if (_t21) goto L_0221AEA8; else goto L_0221AEA4;
   L_0221AEA4: ; // 0x221aea4
@@ -8055,9 +8055,9 @@ void Gambit_fn_0221AED8(CPUState* cpu) {
         /* 0221AEF8 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0221AEF8 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 0221AEFC */ Gambit_fn_0221A404(cpu);
-        /* 0221AF00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0221AF00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0221AF04 */ cpu->r[9] = 0x00000008u;
-        /* 0221AF08 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221AF08 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221AF08 */ _t5 = _t4 & 0x00000001u;
         /* 0221AF08 */ if (_t5) goto L_0221AF10; else goto L_0221AF0C;
   L_0221AF0C: ; // 0x221af0c
@@ -8108,9 +8108,9 @@ void Gambit_fn_0221AEDC(CPUState* cpu) {
         /* 0221AEF8 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 0221AEF8 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 0221AEFC */ Gambit_fn_0221A404(cpu);
-        /* 0221AF00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0221AF00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0221AF04 */ cpu->r[9] = 0x00000008u;
-        /* 0221AF08 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221AF08 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221AF08 */ _t5 = _t4 & 0x00000001u;
         /* 0221AF08 */ if (_t5) goto L_0221AF10; else goto L_0221AF0C;
   L_0221AF0C: ; // 0x221af0c
@@ -8285,9 +8285,9 @@ void Gambit_fn_0221AFE0(CPUState* cpu) {
         /* 0221AFEC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0221AFEC */ cpu->r[1] = _t1;
         /* 0221AFF0 */ Gambit_fn_0221A33C(cpu);
-        /* 0221AFF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0221AFF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0221AFF8 */ cpu->r[0] = 0x00000000u;
-        /* 0221AFFC */ _t2 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221AFFC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221AFFC */ _t3 = _t2 & 0x00000001u;
         /* 0221AFFC */ if (_t3) goto L_0221B00C; else goto L_0221B000;
   L_0221B000: ; // 0x221b000
@@ -8313,9 +8313,9 @@ void Gambit_fn_0221AFEC(CPUState* cpu) {
         /* 0221AFEC */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 0221AFEC */ cpu->r[1] = _t0;
         /* 0221AFF0 */ Gambit_fn_0221A33C(cpu);
-        /* 0221AFF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0221AFF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0221AFF8 */ cpu->r[0] = 0x00000000u;
-        /* 0221AFFC */ _t1 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221AFFC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221AFFC */ _t2 = _t1 & 0x00000001u;
         /* 0221AFFC */ if (_t2) goto L_0221B00C; else goto L_0221B000;
   L_0221B000: ; // 0x221b000
@@ -8535,8 +8535,8 @@ void Gambit_fn_0221B0A4(CPUState* cpu) {
   L_0221B15C: ; // 0x221b15c
         /* 0221B15C */ /* nop */
         /* 0221B160 */ cpu->r[9] = cpu->r[26] & cpu->r[8];
-        /* 0221B160 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0221B164 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221B160 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0221B164 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221B164 */ _t14 = _t13 & 0x00000001u;
         /* 0221B164 */ if (_t14) goto L_0221B210; else goto L_0221B168;
   L_0221B168: ; // 0x221b168
@@ -8584,9 +8584,9 @@ void Gambit_fn_0221B0A4(CPUState* cpu) {
         /* 0221B1CC */ cpu->r[6] = rbrew_read32(cpu->mem, _t30);
         /* 0221B1D0 */ _t31 = cpu->r[6] + 0x00000078u;
         /* 0221B1D0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t31);
-        /* 0221B1D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[23], cpu->r[0]);
+        /* 0221B1D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[23], cpu->r[0]));
         /* 0221B1D8 */ cpu->r[3] = 0x00000000u;
-        /* 0221B1DC */ _t32 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221B1DC */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221B1DC */ _t33 = _t32 & 0x00000001u;
         /* 0221B1DC */ if (_t33) goto L_0221B1E0; else goto L_0221B1E8;
   L_0221B1E0: ; // 0x221b1e0
@@ -8602,8 +8602,8 @@ void Gambit_fn_0221B0A4(CPUState* cpu) {
         /* 0221B1F4 */ cpu->r[6] = rbrew_read32(cpu->mem, _t36);
         /* 0221B1F8 */ _t37 = cpu->r[6] + 0x00000044u;
         /* 0221B1F8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t37);
-        /* 0221B1FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0221B200 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221B1FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0221B200 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221B200 */ _t39 = _t38 & 0x00000001u;
         /* 0221B200 */ if (_t39) goto L_0221B210; else goto L_0221B204;
   L_0221B204: ; // 0x221b204
@@ -8613,9 +8613,9 @@ void Gambit_fn_0221B0A4(CPUState* cpu) {
         /* 0221B20C */ Gambit_fn_023EED38(cpu);
   L_0221B210: ; // 0x221b210
         /* 0221B210 */ cpu->r[15] = cpu->r[15] + 0xFFFFFFFFu;
-        /* 0221B210 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[15], 0x00000000u);
+        /* 0221B210 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[15], 0x00000000u));
         /* 0221B214 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
-        /* 0221B218 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221B218 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221B218 */ _t42 = _t41 & 0x00000001u;
         /* 0221B218 */ if (_t42) goto L_0221B21C; else goto L_0221B15C;
   L_0221B21C: ; // 0x221b21c
@@ -8624,7 +8624,7 @@ void Gambit_fn_0221B0A4(CPUState* cpu) {
         /* 0221B220 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t43);
         /* 0221B224 */ _t44 = cpu->r[1] + 0x000000B8u;
         /* 0221B224 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t44);
-        /* 0221B228 */ _t45 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221B228 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221B228 */ _t46 = _t45 & 0x00000001u;
         /* 0221B228 */ if (_t46) goto L_0221B22C; // else: addr-0 trap, fall-through
   L_0221B22C: ; // 0x221b22c
@@ -8699,9 +8699,9 @@ void Gambit_fn_0221B23C(CPUState* cpu) {
         /* 0221B2DC */ cpu->r[25] = 0x00000009u;
         /* 0221B2E0 */ cpu->r[21] = cpu->r[3];
         /* 0221B2E4 */ cpu->r[0] = 0x00000000u;
-        /* 0221B2E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x0000000Cu);
+        /* 0221B2E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x0000000Cu));
         /* 0221B2EC */ cpu->r[23] = 0x0000001Du;
-        /* 0221B2F0 */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221B2F0 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221B2F0 */ _t15 = _t14 & 0x00000001u;
         /* 0221B2F0 */ if (_t15) goto L_0221B4B4; else goto L_0221B2F4;
   L_0221B2F4: ; // 0x221b2f4
@@ -8722,8 +8722,8 @@ void Gambit_fn_0221B23C(CPUState* cpu) {
   L_0221B4D4: ; // 0x221b4d4
         /* 0221B4D4 */ /* nop */
         /* 0221B4D8 */ cpu->r[6] = cpu->r[21] & cpu->r[5];
-        /* 0221B4D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0221B4DC */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221B4D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0221B4DC */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221B4DC */ _t17 = _t16 & 0x00000001u;
         /* 0221B4DC */ if (_t17) goto L_0221B590; else goto L_0221B4E0;
   L_0221B4E0: ; // 0x221b4e0
@@ -8773,9 +8773,9 @@ void Gambit_fn_0221B23C(CPUState* cpu) {
         /* 0221B54C */ cpu->r[5] = rbrew_read32(cpu->mem, _t33);
         /* 0221B550 */ _t34 = cpu->r[5] + 0x00000078u;
         /* 0221B550 */ cpu->r[0] = rbrew_read32(cpu->mem, _t34);
-        /* 0221B554 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[24], cpu->r[0]);
+        /* 0221B554 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[24], cpu->r[0]));
         /* 0221B558 */ cpu->r[3] = 0x00000000u;
-        /* 0221B55C */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221B55C */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221B55C */ _t36 = _t35 & 0x00000001u;
         /* 0221B55C */ if (_t36) goto L_0221B560; else goto L_0221B568;
   L_0221B560: ; // 0x221b560
@@ -8791,8 +8791,8 @@ void Gambit_fn_0221B23C(CPUState* cpu) {
         /* 0221B574 */ cpu->r[11] = rbrew_read32(cpu->mem, _t39);
         /* 0221B578 */ _t40 = cpu->r[11] + 0x00000044u;
         /* 0221B578 */ cpu->r[0] = rbrew_read8(cpu->mem, _t40);
-        /* 0221B57C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0221B580 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221B57C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0221B580 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221B580 */ _t42 = _t41 & 0x00000001u;
         /* 0221B580 */ if (_t42) goto L_0221B590; else goto L_0221B584;
   L_0221B584: ; // 0x221b584
@@ -8802,9 +8802,9 @@ void Gambit_fn_0221B23C(CPUState* cpu) {
         /* 0221B58C */ Gambit_fn_023EEED0(cpu);
   L_0221B590: ; // 0x221b590
         /* 0221B590 */ cpu->r[14] = cpu->r[14] + 0xFFFFFFFFu;
-        /* 0221B590 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[14], 0x00000000u);
+        /* 0221B590 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[14], 0x00000000u));
         /* 0221B594 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 0221B598 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221B598 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221B598 */ _t45 = _t44 & 0x00000001u;
         /* 0221B598 */ if (_t45) goto L_0221B59C; else goto L_0221B4D4;
   L_0221B59C: ; // 0x221b59c
@@ -8813,7 +8813,7 @@ void Gambit_fn_0221B23C(CPUState* cpu) {
         /* 0221B5A0 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t46);
         /* 0221B5A4 */ _t47 = cpu->r[1] + 0x000000B8u;
         /* 0221B5A4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t47);
-        /* 0221B5A8 */ _t48 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221B5A8 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221B5A8 */ _t49 = _t48 & 0x00000001u;
         /* 0221B5A8 */ if (_t49) goto L_0221B5AC; // else: addr-0 trap, fall-through
   L_0221B5AC: ; // 0x221b5ac
@@ -8925,9 +8925,9 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221B69C */ cpu->r[29] = 0x101E0000u;
         /* 0221B6A0 */ cpu->r[18] = cpu->r[18] + 0x00001EF8u;
         /* 0221B6A4 */ cpu->r[17] = 0x00000000u;
-        /* 0221B6A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0221B6A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0221B6AC */ cpu->r[29] = cpu->r[29] + 0xFFFF9594u;
-        /* 0221B6B0 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221B6B0 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221B6B0 */ _t36 = _t35 & 0x00000001u;
         /* 0221B6B0 */ if (_t36) goto L_0221B6FC; else goto L_0221B6B4;
   L_0221B6B4: ; // 0x221b6b4
@@ -8957,8 +8957,8 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221B6E8 */ rbrew_write32(cpu->mem, _t46, cpu->r[9]);
         /* 0221B6EC */ _t47 = cpu->r[31] + 0x0000020Du;
         /* 0221B6EC */ cpu->r[9] = rbrew_read8(cpu->mem, _t47);
-        /* 0221B6F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000002u);
-        /* 0221B6F4 */ _t48 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221B6F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000002u));
+        /* 0221B6F4 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221B6F4 */ _t49 = _t48 & 0x00000001u;
         /* 0221B6F4 */ if (_t49) goto L_0221D440; else goto L_0221B6F8;
   L_0221B6F8: ; // 0x221b6f8
@@ -8967,10 +8967,10 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221B6FC */ _t50 = cpu->r[31] + 0x00000051u;
         /* 0221B6FC */ cpu->r[0] = rbrew_read8(cpu->mem, _t50);
         /* 0221B700 */ cpu->r[10] = 0x00000002u;
-        /* 0221B704 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221B704 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221B708 */ _t51 = cpu->r[31] + 0x000000C0u;
         /* 0221B708 */ rbrew_write32(cpu->mem, _t51, cpu->r[10]);
-        /* 0221B70C */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221B70C */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221B70C */ _t53 = _t52 & 0x00000001u;
         /* 0221B70C */ if (_t53) goto L_0221B710; else goto L_0221B74C;
   L_0221B710: ; // 0x221b710
@@ -9014,10 +9014,10 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221B784 */ _t61 = cpu->r[10] + 0xFFFFC020u;
         /* 0221B784 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t61);
         /* 0221B788 */ cpu->r[8] = 0x10050000u;
-        /* 0221B78C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[5], cpu->f[30]);
+        /* 0221B78C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[5], cpu->f[30]));
         /* 0221B790 */ _t62 = cpu->r[8] + 0xFFFFBE20u;
         /* 0221B790 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t62);
-        /* 0221B794 */ _t63 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221B794 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221B794 */ _t64 = _t63 & 0x00000001u;
         /* 0221B794 */ if (_t64) goto L_0221B864; else goto L_0221B798;
   L_0221B798: ; // 0x221b798
@@ -9090,10 +9090,10 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221B84C */ cpu->f[8] = fma(cpu->f[7], cpu->f[7], cpu->f[6]);
         /* 0221B850 */ _t86 = cpu->r[1] + 0x00000114u;
         /* 0221B850 */ rbrew_write_f32(cpu->mem, _t86, cpu->f[7]);
-        /* 0221B854 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[30]);
+        /* 0221B854 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[30]));
         /* 0221B858 */ _t87 = cpu->r[1] + 0x00000118u;
         /* 0221B858 */ rbrew_write_f32(cpu->mem, _t87, cpu->f[12]);
-        /* 0221B85C */ _t88 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221B85C */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221B85C */ _t89 = _t88 & 0x00000001u;
         /* 0221B85C */ if (_t89) goto L_0221B860; else goto L_0221B974;
   L_0221B860: ; // 0x221b860
@@ -9181,10 +9181,10 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221B93C */ cpu->f[8] = fma(cpu->f[7], cpu->f[7], cpu->f[6]);
         /* 0221B940 */ _t115 = cpu->r[1] + 0x00000114u;
         /* 0221B940 */ rbrew_write_f32(cpu->mem, _t115, cpu->f[7]);
-        /* 0221B944 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[30]);
+        /* 0221B944 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[30]));
         /* 0221B948 */ _t116 = cpu->r[1] + 0x00000118u;
         /* 0221B948 */ rbrew_write_f32(cpu->mem, _t116, cpu->f[12]);
-        /* 0221B94C */ _t117 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221B94C */ _t117 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221B94C */ _t118 = _t117 & 0x00000001u;
         /* 0221B94C */ if (_t118) goto L_0221B950; else goto L_0221B974;
   L_0221B950: ; // 0x221b950
@@ -9200,33 +9200,33 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221B96C */ cpu->r[28] = cpu->r[25];
         /* 0221B970 */ /* nop */
   L_0221B974: ; // 0x221b974
-        /* 0221B974 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[27], cpu->f[30]);
+        /* 0221B974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[27], cpu->f[30]));
         /* 0221B978 */ cpu->r[11] = 0x00000001u;
-        /* 0221B97C */ _t121 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221B97C */ _t121 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221B97C */ _t122 = _t121 & 0x00000001u;
         /* 0221B97C */ if (_t122) goto L_0221B980; else goto L_0221B98C;
   L_0221B980: ; // 0x221b980
         /* 0221B980 */ _t123 = cpu->r[31] + 0x00000120u;
         /* 0221B980 */ cpu->r[0] = rbrew_read32(cpu->mem, _t123);
         /* 0221B984 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000001u, 0x00000001u);
-        /* 0221B984 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0221B988 */ _t124 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221B984 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0221B988 */ _t124 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221B988 */ _t125 = _t124 & 0x00000001u;
         /* 0221B988 */ if (_t125) goto L_0221B99C; else goto L_0221B98C;
   L_0221B98C: ; // 0x221b98c
         /* 0221B98C */ _t126 = cpu->r[31] + 0x00000120u;
         /* 0221B98C */ cpu->r[7] = rbrew_read32(cpu->mem, _t126);
         /* 0221B990 */ cpu->r[5] = rbrew_rlwinm(cpu->r[7], 0x00000004u, 0x0000001Fu, 0x0000001Fu);
-        /* 0221B990 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 0221B994 */ _t127 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221B990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 0221B994 */ _t127 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221B994 */ _t128 = _t127 & 0x00000001u;
         /* 0221B994 */ if (_t128) goto L_0221B998; else goto L_0221B99C;
   L_0221B998: ; // 0x221b998
         /* 0221B998 */ cpu->r[11] = 0x00000000u;
   L_0221B99C: ; // 0x221b99c
         /* 0221B99C */ cpu->r[30] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000018u, 0x0000001Fu);
-        /* 0221B99C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0221B9A0 */ _t129 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221B99C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0221B9A0 */ _t129 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221B9A0 */ _t130 = _t129 & 0x00000001u;
         /* 0221B9A0 */ if (_t130) goto L_0221BBF8; else goto L_0221B9A4;
   L_0221B9A4: ; // 0x221b9a4
@@ -9234,9 +9234,9 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221B9A4 */ cpu->r[10] = rbrew_read8(cpu->mem, _t131);
         /* 0221B9A8 */ cpu->r[30] = 0x00000000u;
         /* 0221B9AC */ cpu->r[7] = cpu->r[10];
-        /* 0221B9AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0221B9AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0221B9B0 */ cpu->r[6] = cpu->r[30];
-        /* 0221B9B4 */ _t132 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221B9B4 */ _t132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221B9B4 */ _t133 = _t132 & 0x00000001u;
         /* 0221B9B4 */ if (_t133) goto L_0221B9B8; else goto L_0221BBF8;
   L_0221B9B8: ; // 0x221b9b8
@@ -9246,20 +9246,20 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
   L_0221B9C0: ; // 0x221b9c0
         /* 0221B9C0 */ _t134 = cpu->r[9] + 0x00000000u;
         /* 0221B9C0 */ cpu->r[8] = rbrew_read8(cpu->mem, _t134);
-        /* 0221B9C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 0221B9C8 */ _t135 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221B9C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 0221B9C8 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221B9C8 */ _t136 = _t135 & 0x00000001u;
         /* 0221B9C8 */ if (_t136) goto L_0221B9CC; else goto L_0221B9E8;
   L_0221B9CC: ; // 0x221b9cc
         /* 0221B9CC */ cpu->r[7] = cpu->r[7] + 0xFFFFFFFFu;
-        /* 0221B9CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0221B9CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0221B9D0 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 0221B9D4 */ _t137 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221B9D4 */ _t137 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221B9D4 */ _t138 = _t137 & 0x00000001u;
         /* 0221B9D4 */ if (_t138) goto L_0221BBF8; else goto L_0221B9D8;
   L_0221B9D8: ; // 0x221b9d8
-        /* 0221B9D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], 0x00000005u);
-        /* 0221B9DC */ _t139 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221B9D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], 0x00000005u));
+        /* 0221B9DC */ _t139 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221B9DC */ _t140 = _t139 & 0x00000001u;
         /* 0221B9DC */ if (_t140) goto L_0221B9BC; else goto L_0221B9E0;
   L_0221B9E0: ; // 0x221b9e0
@@ -9268,10 +9268,10 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
   L_0221B9E8: ; // 0x221b9e8
         /* 0221B9E8 */ cpu->r[8] = cpu->r[10] + 0xFFFFFFFFu;
         /* 0221B9EC */ cpu->r[4] = cpu->r[31] + 0x00000160u;
-        /* 0221B9F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000005u);
+        /* 0221B9F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000005u));
         /* 0221B9F4 */ /* nop */
         /* 0221B9F8 */ cpu->r[30] = 0x00000001u;
-        /* 0221B9FC */ _t141 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221B9FC */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221B9FC */ _t142 = _t141 & 0x00000001u;
         /* 0221B9FC */ if (_t142) goto L_0221BA00; else goto L_0221BA5C;
   L_0221BA00: ; // 0x221ba00
@@ -9337,22 +9337,22 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221BAA4 */ rbrew_write_f32(cpu->mem, _t159, cpu->f[10]);
   L_0221BAA8: ; // 0x221baa8
         /* 0221BAA8 */ cpu->r[0] = cpu->r[10];
-        /* 0221BAA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221BAA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221BAAC */ cpu->r[12] = 0x00000000u;
-        /* 0221BAB0 */ _t160 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221BAB0 */ _t160 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221BAB0 */ _t161 = _t160 & 0x00000001u;
         /* 0221BAB0 */ if (_t161) goto L_0221BAB4; else goto L_0221BB1C;
   L_0221BAB4: ; // 0x221bab4
         /* 0221BAB4 */ cpu->ctr = cpu->r[0];
   L_0221BAB8: ; // 0x221bab8
-        /* 0221BAB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221BABC */ _t162 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221BAB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221BABC */ _t162 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221BABC */ _t163 = _t162 & 0x00000001u;
         /* 0221BABC */ if (_t163) goto L_0221BAC0; else goto L_0221BAD0;
   L_0221BAC0: ; // 0x221bac0
         /* 0221BAC0 */ cpu->r[6] = cpu->r[12];
-        /* 0221BAC4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], 0x00000005u);
-        /* 0221BAC8 */ _t164 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221BAC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], 0x00000005u));
+        /* 0221BAC8 */ _t164 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221BAC8 */ _t165 = _t164 & 0x00000001u;
         /* 0221BAC8 */ if (_t165) goto L_0221BAE0; else goto L_0221BACC;
   L_0221BACC: ; // 0x221bacc
@@ -9360,15 +9360,15 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
   L_0221BAD0: ; // 0x221bad0
         /* 0221BAD0 */ cpu->r[7] = cpu->r[10] - cpu->r[12];
         /* 0221BAD4 */ cpu->r[6] = cpu->r[7] + 0xFFFFFFFFu;
-        /* 0221BAD8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], 0x00000005u);
-        /* 0221BADC */ _t166 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221BAD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], 0x00000005u));
+        /* 0221BADC */ _t166 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221BADC */ _t167 = _t166 & 0x00000001u;
         /* 0221BADC */ if (_t167) goto L_0221BAE0; else goto L_0221BAF0;
   L_0221BAE0: ; // 0x221bae0
         /* 0221BAE0 */ _t168 = cpu->r[11] + cpu->r[6];
         /* 0221BAE0 */ cpu->r[5] = rbrew_read8(cpu->mem, _t168);
-        /* 0221BAE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 0221BAE8 */ _t169 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221BAE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 0221BAE8 */ _t169 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221BAE8 */ _t170 = _t169 & 0x00000001u;
         /* 0221BAE8 */ if (_t170) goto L_0221BB14; else goto L_0221BAEC;
   L_0221BAEC: ; // 0x221baec
@@ -9376,18 +9376,18 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
   L_0221BAF0: ; // 0x221baf0
         /* 0221BAF0 */ _t171 = cpu->r[11] + 0x00000000u;
         /* 0221BAF0 */ cpu->r[5] = rbrew_read8(cpu->mem, _t171);
-        /* 0221BAF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 0221BAF8 */ _t172 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221BAF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 0221BAF8 */ _t172 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221BAF8 */ _t173 = _t172 & 0x00000001u;
         /* 0221BAF8 */ if (_t173) goto L_0221BB14; else goto L_0221BAFC;
   L_0221BAFC: ; // 0x221bafc
         /* 0221BAFC */ cpu->r[8] = cpu->r[8] + 0xFFFFFFFFu;
-        /* 0221BAFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0221BAFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0221BB00 */ cpu->r[3] = cpu->r[3] + 0x00000001u;
         /* 0221BB04 */ _t174 = cpu->r[9] + 0x00000000u;
         /* 0221BB04 */ rbrew_write32(cpu->mem, _t174, cpu->r[6]);
         /* 0221BB08 */ cpu->r[9] = cpu->r[9] + 0x00000004u;
-        /* 0221BB0C */ _t175 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221BB0C */ _t175 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221BB0C */ _t176 = _t175 & 0x00000001u;
         /* 0221BB0C */ if (_t176) goto L_0221BB10; else goto L_0221BAA8;
   L_0221BB10: ; // 0x221bb10
@@ -9401,36 +9401,36 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221BB18 */ if (_t179) goto L_0221BAB8; else goto L_0221BB1C;
   L_0221BB1C: ; // 0x221bb1c
         /* 0221BB1C */ cpu->r[8] = cpu->r[8] + 0xFFFFFFFFu;
-        /* 0221BB1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0221BB1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0221BB20 */ cpu->r[3] = cpu->r[3] + 0x00000001u;
         /* 0221BB24 */ cpu->r[9] = cpu->r[9] + 0x00000004u;
-        /* 0221BB28 */ _t180 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221BB28 */ _t180 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221BB28 */ _t181 = _t180 & 0x00000001u;
         /* 0221BB28 */ if (_t181) goto L_0221BB2C; else goto L_0221BAA8;
   L_0221BB2C: ; // 0x221bb2c
         /* 0221BB2C */ _t182 = cpu->r[1] + 0x00000078u;
         /* 0221BB2C */ cpu->r[0] = rbrew_read32(cpu->mem, _t182);
-        /* 0221BB30 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
+        /* 0221BB30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
         /* 0221BB34 */ _t183 = cpu->r[1] + 0x0000007Cu;
         /* 0221BB34 */ cpu->r[6] = rbrew_read32(cpu->mem, _t183);
-        /* 0221BB38 */ _t184 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221BB38 */ _t184 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221BB38 */ _t185 = _t184 & 0x00000001u;
         /* 0221BB38 */ if (_t185) goto L_0221BB3C; else goto L_0221BB54;
   L_0221BB3C: ; // 0x221bb3c
         /* 0221BB3C */ cpu->r[7] = (uint32_t)((int32_t)cpu->r[0] * (int32_t)0x0000000Cu);
         /* 0221BB40 */ cpu->r[11] = cpu->r[4] + cpu->r[7];
-        /* 0221BB44 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], 0x00000005u);
+        /* 0221BB44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], 0x00000005u));
         /* 0221BB48 */ /* nop */
-        /* 0221BB4C */ _t186 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221BB4C */ _t186 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221BB4C */ _t187 = _t186 & 0x00000001u;
         /* 0221BB4C */ if (_t187) goto L_0221BB64; else goto L_0221BB50;
   L_0221BB50: ; // 0x221bb50
         /* 0221BB50 */ goto L_0221BB6C;
   L_0221BB54: ; // 0x221bb54
         /* 0221BB54 */ cpu->r[11] = cpu->r[4];
-        /* 0221BB58 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], 0x00000005u);
+        /* 0221BB58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], 0x00000005u));
         /* 0221BB5C */ /* nop */
-        /* 0221BB60 */ _t188 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221BB60 */ _t188 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221BB60 */ _t189 = _t188 & 0x00000001u;
         /* 0221BB60 */ if (_t189) goto L_0221BB64; else goto L_0221BB50;
   L_0221BB64: ; // 0x221bb64
@@ -9526,13 +9526,13 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221BC44 */ _t221 = cpu->r[1] + 0x00000120u;
         /* 0221BC44 */ rbrew_write32(cpu->mem, _t221, cpu->r[7]);
         /* 0221BC48 */ cpu->r[28] = 0x101E0000u;
-        /* 0221BC4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0221BC4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0221BC50 */ _t222 = cpu->r[1] + 0x000001C8u;
         /* 0221BC50 */ rbrew_write32(cpu->mem, _t222, cpu->r[0]);
         /* 0221BC54 */ cpu->r[28] = cpu->r[28] + 0xFFFF9598u;
         /* 0221BC58 */ _t223 = cpu->r[1] + 0x00000124u;
         /* 0221BC58 */ rbrew_write32(cpu->mem, _t223, cpu->r[9]);
-        /* 0221BC5C */ _t224 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221BC5C */ _t224 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221BC5C */ _t225 = _t224 & 0x00000001u;
         /* 0221BC5C */ if (_t225) goto L_0221C2D8; else goto L_0221BC60;
   L_0221BC60: ; // 0x221bc60
@@ -9556,15 +9556,15 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221BC88 */ _t233 = cpu->r[31] + 0x00000120u;
         /* 0221BC88 */ cpu->r[0] = rbrew_read32(cpu->mem, _t233);
         /* 0221BC8C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 0221BC8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0221BC90 */ _t234 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221BC8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0221BC90 */ _t234 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221BC90 */ _t235 = _t234 & 0x00000001u;
         /* 0221BC90 */ if (_t235) goto L_0221BCA0; else goto L_0221BC94;
   L_0221BC94: ; // 0x221bc94
         /* 0221BC94 */ _t236 = cpu->r[31] + 0x00000122u;
         /* 0221BC94 */ cpu->r[10] = rbrew_read8(cpu->mem, _t236);
-        /* 0221BC98 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000001u);
-        /* 0221BC9C */ _t237 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221BC98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000001u));
+        /* 0221BC9C */ _t237 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221BC9C */ _t238 = _t237 & 0x00000001u;
         /* 0221BC9C */ if (_t238) goto L_0221BDC0; else goto L_0221BCA0;
   L_0221BCA0: ; // 0x221bca0
@@ -9673,19 +9673,19 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221BDA8 */ rbrew_write32(cpu->mem, _t274, cpu->r[0]);
         /* 0221BDAC */ Gambit_fn_0204A864(cpu);
         /* 0221BDB0 */ cpu->r[8] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0221BDB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0221BDB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0221BDB4 */ _t275 = cpu->r[1] + 0x00000258u;
         /* 0221BDB4 */ rbrew_write32(cpu->mem, _t275, cpu->r[3]);
-        /* 0221BDB8 */ _t276 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221BDB8 */ _t276 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221BDB8 */ _t277 = _t276 & 0x00000001u;
         /* 0221BDB8 */ if (_t277) goto L_0221C0D0; else goto L_0221BDBC;
   L_0221BDBC: ; // 0x221bdbc
         /* 0221BDBC */ goto L_0221C02C;
   L_0221BDC0: ; // 0x221bdc0
         /* 0221BDC0 */ cpu->r[6] = cpu->r[10] + 0xFFFFFFFFu;
-        /* 0221BDC4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], 0x00000005u);
+        /* 0221BDC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], 0x00000005u));
         /* 0221BDC8 */ cpu->r[4] = cpu->r[31] + 0x00000160u;
-        /* 0221BDCC */ _t278 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221BDCC */ _t278 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221BDCC */ _t279 = _t278 & 0x00000001u;
         /* 0221BDCC */ if (_t279) goto L_0221BDD0; else goto L_0221BE18;
   L_0221BDD0: ; // 0x221bdd0
@@ -9707,10 +9707,10 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221BDFC */ cpu->f[8] = cpu->f[6] - cpu->f[8];
         /* 0221BE00 */ cpu->f[7] = fma(cpu->f[11], cpu->f[11], cpu->f[0]);
         /* 0221BE04 */ cpu->f[6] = fma(cpu->f[8], cpu->f[8], cpu->f[7]);
-        /* 0221BE08 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[30]);
+        /* 0221BE08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[30]));
         /* 0221BE0C */ _t284 = cpu->r[1] + 0x00000030u;
         /* 0221BE0C */ rbrew_write_f32(cpu->mem, _t284, cpu->f[8]);
-        /* 0221BE10 */ _t285 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221BE10 */ _t285 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221BE10 */ _t286 = _t285 & 0x00000001u;
         /* 0221BE10 */ if (_t286) goto L_0221BE14; else goto L_0221BE78;
   L_0221BE14: ; // 0x221be14
@@ -9729,10 +9729,10 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221BE34 */ cpu->f[8] = cpu->f[8] - cpu->f[8];
         /* 0221BE38 */ cpu->f[7] = fma(cpu->f[11], cpu->f[11], cpu->f[0]);
         /* 0221BE3C */ cpu->f[6] = fma(cpu->f[8], cpu->f[8], cpu->f[7]);
-        /* 0221BE40 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[30]);
+        /* 0221BE40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[30]));
         /* 0221BE44 */ _t290 = cpu->r[1] + 0x00000030u;
         /* 0221BE44 */ rbrew_write_f32(cpu->mem, _t290, cpu->f[8]);
-        /* 0221BE48 */ _t291 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221BE48 */ _t291 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221BE48 */ _t292 = _t291 & 0x00000001u;
         /* 0221BE48 */ if (_t292) goto L_0221BE4C; else goto L_0221BE78;
   L_0221BE4C: ; // 0x221be4c
@@ -9859,7 +9859,7 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221BF94 */ cpu->r[5] = rbrew_read32(cpu->mem, _t329);
         /* 0221BF98 */ _t330 = cpu->r[1] + 0x00000078u;
         /* 0221BF98 */ rbrew_write32(cpu->mem, _t330, cpu->r[0]);
-        /* 0221BF9C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[30]);
+        /* 0221BF9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[30]));
         /* 0221BFA0 */ _t331 = cpu->r[1] + 0x00000314u;
         /* 0221BFA0 */ rbrew_write_f32(cpu->mem, _t331, cpu->f[8]);
         /* 0221BFA4 */ _t332 = cpu->r[1] + 0x00000314u;
@@ -9868,7 +9868,7 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221BFA8 */ rbrew_write32(cpu->mem, _t333, cpu->r[5]);
         /* 0221BFAC */ _t334 = cpu->r[1] + 0x00000080u;
         /* 0221BFAC */ rbrew_write32(cpu->mem, _t334, cpu->r[7]);
-        /* 0221BFB0 */ _t335 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221BFB0 */ _t335 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221BFB0 */ _t336 = _t335 & 0x00000001u;
         /* 0221BFB0 */ if (_t336) goto L_0221BFF0; else goto L_0221BFB4;
   L_0221BFB4: ; // 0x221bfb4
@@ -9910,8 +9910,8 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C020 */ cpu->r[3] = rbrew_read32(cpu->mem, _t343);
   L_0221C024: ; // 0x221c024
         /* 0221C024 */ cpu->r[8] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0221C024 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 0221C028 */ _t344 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C024 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 0221C028 */ _t344 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C028 */ _t345 = _t344 & 0x00000001u;
         /* 0221C028 */ if (_t345) goto L_0221C0D0; else goto L_0221C02C;
   L_0221C02C: ; // 0x221c02c
@@ -9920,8 +9920,8 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C030 */ _t347 = cpu->r[4] + 0x0000015Cu;
         /* 0221C030 */ cpu->r[7] = rbrew_read32(cpu->mem, _t347);
         /* 0221C034 */ cpu->r[9] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 0221C034 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0221C038 */ _t348 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C034 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0221C038 */ _t348 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C038 */ _t349 = _t348 & 0x00000001u;
         /* 0221C038 */ if (_t349) goto L_0221C058; else goto L_0221C03C;
   L_0221C03C: ; // 0x221c03c
@@ -9940,8 +9940,8 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C054 */ goto L_0221C078;
   L_0221C058: ; // 0x221c058
         /* 0221C058 */ cpu->r[0] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 0221C058 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0221C05C */ _t356 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C058 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0221C05C */ _t356 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C05C */ _t357 = _t356 & 0x00000001u;
         /* 0221C05C */ if (_t357) goto L_0221C078; else goto L_0221C060;
   L_0221C060: ; // 0x221c060
@@ -9995,8 +9995,8 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C0D0 */ _t375 = cpu->r[31] + 0x000001F0u;
         /* 0221C0D0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t375);
         /* 0221C0D4 */ cpu->r[9] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0221C0D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0221C0D8 */ _t376 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C0D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0221C0D8 */ _t376 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C0D8 */ _t377 = _t376 & 0x00000001u;
         /* 0221C0D8 */ if (_t377) goto L_0221C2D8; else goto L_0221C0DC;
   L_0221C0DC: ; // 0x221c0dc
@@ -10005,8 +10005,8 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C0E0 */ _t379 = cpu->r[26] + 0x0000015Cu;
         /* 0221C0E0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t379);
         /* 0221C0E4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Cu, 0x0000001Eu);
-        /* 0221C0E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0221C0E8 */ _t380 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C0E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0221C0E8 */ _t380 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C0E8 */ _t381 = _t380 & 0x00000001u;
         /* 0221C0E8 */ if (_t381) goto L_0221C2D8; else goto L_0221C0EC;
   L_0221C0EC: ; // 0x221c0ec
@@ -10020,10 +10020,10 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C0FC */ cpu->r[27] = rbrew_read32(cpu->mem, _t384);
         /* 0221C100 */ cpu->r[24] = 0x00000000u;
         /* 0221C104 */ cpu->r[8] = 0x10050000u;
-        /* 0221C108 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0221C108 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0221C10C */ _t385 = cpu->r[8] + 0xFFFFC024u;
         /* 0221C10C */ cpu->f[26] = rbrew_read_f32(cpu->mem, _t385);
-        /* 0221C110 */ _t386 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221C110 */ _t386 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221C110 */ _t387 = _t386 & 0x00000001u;
         /* 0221C110 */ if (_t387) goto L_0221C114; else goto L_0221C2D8;
   L_0221C114: ; // 0x221c114
@@ -10055,10 +10055,10 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C164 */ _t392 = cpu->r[5] + 0x00000000u;
         /* 0221C164 */ cpu->r[7] = rbrew_read32(cpu->mem, _t392);
         /* 0221C168 */ cpu->r[6] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0221C168 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 0221C168 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 0221C16C */ _t393 = cpu->r[31] + 0x00000120u;
         /* 0221C16C */ cpu->r[0] = rbrew_read32(cpu->mem, _t393);
-        /* 0221C170 */ _t394 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C170 */ _t394 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C170 */ _t395 = _t394 & 0x00000001u;
         /* 0221C170 */ if (_t395) goto L_0221C1FC; else goto L_0221C174;
   L_0221C174: ; // 0x221c174
@@ -10107,10 +10107,10 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C1E4 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t409);
         /* 0221C1E8 */ cpu->f[0] = cpu->f[7] + cpu->f[6];
         /* 0221C1EC */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 0221C1EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221C1EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221C1F0 */ _t410 = cpu->r[1] + 0x00000030u;
         /* 0221C1F0 */ rbrew_write_f32(cpu->mem, _t410, cpu->f[0]);
-        /* 0221C1F4 */ _t411 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C1F4 */ _t411 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C1F4 */ _t412 = _t411 & 0x00000001u;
         /* 0221C1F4 */ if (_t412) goto L_0221C234; else goto L_0221C1F8;
   L_0221C1F8: ; // 0x221c1f8
@@ -10123,18 +10123,18 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C208 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t413);
         /* 0221C20C */ cpu->f[9] = cpu->f[6] + cpu->f[10];
         /* 0221C210 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 0221C210 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221C210 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221C214 */ _t414 = cpu->r[1] + 0x00000030u;
         /* 0221C214 */ rbrew_write_f32(cpu->mem, _t414, cpu->f[9]);
-        /* 0221C218 */ _t415 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C218 */ _t415 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C218 */ _t416 = _t415 & 0x00000001u;
         /* 0221C218 */ if (_t416) goto L_0221C234; else goto L_0221C21C;
   L_0221C21C: ; // 0x221c21c
         /* 0221C21C */ cpu->r[3] = cpu->r[23];
         /* 0221C220 */ cpu->r[4] = cpu->r[22];
         /* 0221C224 */ Gambit_fn_02C69328(cpu);
-        /* 0221C228 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[26]);
-        /* 0221C22C */ _t417 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221C228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[26]));
+        /* 0221C22C */ _t417 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221C22C */ _t418 = _t417 & 0x00000001u;
         /* 0221C22C */ if (_t418) goto L_0221C240; else goto L_0221C230;
   L_0221C230: ; // 0x221c230
@@ -10142,8 +10142,8 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
   L_0221C234: ; // 0x221c234
         /* 0221C234 */ _t419 = cpu->r[1] + 0x0000002Cu;
         /* 0221C234 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t419);
-        /* 0221C238 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[26]);
-        /* 0221C23C */ _t420 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221C238 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[26]));
+        /* 0221C23C */ _t420 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221C23C */ _t421 = _t420 & 0x00000001u;
         /* 0221C23C */ if (_t421) goto L_0221C240; else goto L_0221C2CC;
   L_0221C240: ; // 0x221c240
@@ -10165,9 +10165,9 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C26C */ _t426 = cpu->r[1] + 0x00000030u;
         /* 0221C26C */ rbrew_write_f32(cpu->mem, _t426, cpu->f[0]);
         /* 0221C270 */ cpu->f[0] = fma(cpu->f[0], cpu->f[0], cpu->f[9]);
-        /* 0221C274 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[22]);
+        /* 0221C274 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[22]));
         /* 0221C278 */ cpu->f[26] = cpu->f[1];
-        /* 0221C27C */ _t427 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221C27C */ _t427 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221C27C */ _t428 = _t427 & 0x00000001u;
         /* 0221C27C */ if (_t428) goto L_0221C280; else goto L_0221C2CC;
   L_0221C280: ; // 0x221c280
@@ -10183,12 +10183,12 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C29C */ /* nop */
         /* 0221C2A0 */ _t431 = cpu->r[1] + 0x00000030u;
         /* 0221C2A0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t431);
-        /* 0221C2A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[22]);
+        /* 0221C2A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[22]));
         /* 0221C2A8 */ cpu->f[7] = cpu->f[12] * cpu->f[23];
         /* 0221C2AC */ /* nop */
         /* 0221C2B0 */ _t432 = cpu->r[1] + 0x00000030u;
         /* 0221C2B0 */ rbrew_write_f32(cpu->mem, _t432, cpu->f[7]);
-        /* 0221C2B4 */ _t433 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221C2B4 */ _t433 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221C2B4 */ _t434 = _t433 & 0x00000001u;
         /* 0221C2B4 */ if (_t434) goto L_0221C2B8; else goto L_0221C2CC;
   L_0221C2B8: ; // 0x221c2b8
@@ -10204,17 +10204,17 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C2C8 */ rbrew_write_f32(cpu->mem, _t439, cpu->f[7]);
   L_0221C2CC: ; // 0x221c2cc
         /* 0221C2CC */ cpu->r[27] = cpu->r[27] + 0xFFFFFFFFu;
-        /* 0221C2CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0221C2CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0221C2D0 */ cpu->r[24] = cpu->r[24] + 0x00000001u;
-        /* 0221C2D4 */ _t440 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C2D4 */ _t440 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C2D4 */ _t441 = _t440 & 0x00000001u;
         /* 0221C2D4 */ if (_t441) goto L_0221C2D8; else goto L_0221C120;
   L_0221C2D8: ; // 0x221c2d8
         /* 0221C2D8 */ cpu->r[12] = 0x00000000u;
-        /* 0221C2DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0221C2DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0221C2E0 */ _t442 = cpu->r[1] + 0x0000000Cu;
         /* 0221C2E0 */ rbrew_write8(cpu->mem, _t442, (uint8_t)cpu->r[12]);
-        /* 0221C2E4 */ _t443 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C2E4 */ _t443 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C2E4 */ _t444 = _t443 & 0x00000001u;
         /* 0221C2E4 */ if (_t444) goto L_0221C2E8; else goto L_0221C314;
   L_0221C2E8: ; // 0x221c2e8
@@ -10228,8 +10228,8 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C300 */ Gambit_fn_0221E164(cpu);
         /* 0221C304 */ _t446 = cpu->r[1] + 0x0000000Cu;
         /* 0221C304 */ cpu->r[12] = rbrew_read8(cpu->mem, _t446);
-        /* 0221C308 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0221C30C */ _t447 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C308 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0221C30C */ _t447 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C30C */ _t448 = _t447 & 0x00000001u;
         /* 0221C30C */ if (_t448) goto L_0221D3B0; else goto L_0221C310;
   L_0221C310: ; // 0x221c310
@@ -10258,8 +10258,8 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C348 */ _t456 = cpu->r[1] + 0x000001B0u;
         /* 0221C348 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t456);
         /* 0221C34C */ cpu->f[13] = fma(cpu->f[7], cpu->f[7], cpu->f[8]);
-        /* 0221C350 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[30]);
-        /* 0221C354 */ _t457 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221C350 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[30]));
+        /* 0221C354 */ _t457 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221C354 */ _t458 = _t457 & 0x00000001u;
         /* 0221C354 */ if (_t458) goto L_0221C358; else goto L_0221C384;
   L_0221C358: ; // 0x221c358
@@ -10285,14 +10285,14 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C38C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t463);
         /* 0221C390 */ _t464 = cpu->r[3] + 0x00000990u;
         /* 0221C390 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t464);
-        /* 0221C394 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 0221C398 */ _t465 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C394 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 0221C398 */ _t465 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C398 */ _t466 = _t465 & 0x00000001u;
         /* 0221C398 */ if (_t466) goto L_0221C39C; else goto L_0221C3AC;
   L_0221C39C: ; // 0x221c39c
         /* 0221C39C */ cpu->f[8] = cpu->f[31];
-        /* 0221C3A0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[30]);
-        /* 0221C3A4 */ _t467 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221C3A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[30]));
+        /* 0221C3A4 */ _t467 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221C3A4 */ _t468 = _t467 & 0x00000001u;
         /* 0221C3A4 */ if (_t468) goto L_0221C3C0; else goto L_0221C3A8;
   L_0221C3A8: ; // 0x221c3a8
@@ -10301,8 +10301,8 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C3AC */ cpu->f[12] = fma(cpu->f[27], cpu->f[29], -(cpu->f[0]));
         /* 0221C3B0 */ cpu->f[13] = cpu->f[13] - cpu->f[0];
         /* 0221C3B4 */ cpu->f[8] = cpu->f[12] / cpu->f[13];
-        /* 0221C3B8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[30]);
-        /* 0221C3BC */ _t469 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221C3B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[30]));
+        /* 0221C3BC */ _t469 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221C3BC */ _t470 = _t469 & 0x00000001u;
         /* 0221C3BC */ if (_t470) goto L_0221C3C0; else goto L_0221C430;
   L_0221C3C0: ; // 0x221c3c0
@@ -10333,7 +10333,7 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C3FC */ _t480 = cpu->r[1] + 0x00000288u;
         /* 0221C3FC */ rbrew_write_f32(cpu->mem, _t480, cpu->f[30]);
         /* 0221C400 */ /* nop */
-        /* 0221C404 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000001u);
+        /* 0221C404 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000001u));
         /* 0221C408 */ _t481 = cpu->r[1] + 0x00000234u;
         /* 0221C408 */ rbrew_write32(cpu->mem, _t481, cpu->r[11]);
         /* 0221C40C */ _t482 = cpu->r[1] + 0x00000238u;
@@ -10349,14 +10349,14 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C420 */ rbrew_write_f32(cpu->mem, _t486, cpu->f[30]);
         /* 0221C424 */ _t487 = cpu->r[1] + 0x0000023Cu;
         /* 0221C424 */ rbrew_write32(cpu->mem, _t487, cpu->r[6]);
-        /* 0221C428 */ _t488 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221C428 */ _t488 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221C428 */ _t489 = _t488 & 0x00000001u;
         /* 0221C428 */ if (_t489) goto L_0221C4CC; else goto L_0221C42C;
   L_0221C42C: ; // 0x221c42c
         /* 0221C42C */ goto L_0221C4A8;
   L_0221C430: ; // 0x221c430
-        /* 0221C430 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
-        /* 0221C434 */ _t490 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221C430 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
+        /* 0221C434 */ _t490 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221C434 */ _t491 = _t490 & 0x00000001u;
         /* 0221C434 */ if (_t491) goto L_0221C438; else goto L_0221C43C;
   L_0221C438: ; // 0x221c438
@@ -10389,7 +10389,7 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C478 */ _t501 = cpu->r[1] + 0x00000288u;
         /* 0221C478 */ rbrew_write_f32(cpu->mem, _t501, cpu->f[30]);
         /* 0221C47C */ /* nop */
-        /* 0221C480 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000001u);
+        /* 0221C480 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000001u));
         /* 0221C484 */ _t502 = cpu->r[1] + 0x00000234u;
         /* 0221C484 */ rbrew_write32(cpu->mem, _t502, cpu->r[11]);
         /* 0221C488 */ _t503 = cpu->r[1] + 0x00000238u;
@@ -10405,7 +10405,7 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C49C */ rbrew_write_f32(cpu->mem, _t507, cpu->f[30]);
         /* 0221C4A0 */ _t508 = cpu->r[1] + 0x0000023Cu;
         /* 0221C4A0 */ rbrew_write32(cpu->mem, _t508, cpu->r[6]);
-        /* 0221C4A4 */ _t509 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221C4A4 */ _t509 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221C4A4 */ _t510 = _t509 & 0x00000001u;
         /* 0221C4A4 */ if (_t510) goto L_0221C4CC; else goto L_0221C4A8;
   L_0221C4A8: ; // 0x221c4a8
@@ -10422,9 +10422,9 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
   L_0221C4CC: ; // 0x221c4cc
         /* 0221C4CC */ cpu->r[0] = cpu->r[10] + 0xFFFFFFFFu;
         /* 0221C4D0 */ cpu->r[4] = cpu->r[31] + 0x00000160u;
-        /* 0221C4D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
+        /* 0221C4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
         /* 0221C4D8 */ cpu->r[3] = cpu->r[4];
-        /* 0221C4DC */ _t512 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221C4DC */ _t512 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221C4DC */ _t513 = _t512 & 0x00000001u;
         /* 0221C4DC */ if (_t513) goto L_0221C4E0; else goto L_0221C4E8;
   L_0221C4E0: ; // 0x221c4e0
@@ -10459,9 +10459,9 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C534 */ cpu->r[8] = cpu->r[1] + 0x000001B4u;
   L_0221C538: ; // 0x221c538
         /* 0221C538 */ cpu->r[0] = cpu->r[12];
-        /* 0221C538 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221C538 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221C53C */ cpu->r[6] = 0x00000000u;
-        /* 0221C540 */ _t520 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221C540 */ _t520 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221C540 */ _t521 = _t520 & 0x00000001u;
         /* 0221C540 */ if (_t521) goto L_0221C544; else goto L_0221C628;
   L_0221C544: ; // 0x221c544
@@ -10469,14 +10469,14 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C548 */ cpu->ctr = cpu->r[0];
         /* 0221C54C */ cpu->r[11] = cpu->r[31] + 0x0000019Cu;
   L_0221C550: ; // 0x221c550
-        /* 0221C550 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0221C554 */ _t522 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C550 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0221C554 */ _t522 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C554 */ _t523 = _t522 & 0x00000001u;
         /* 0221C554 */ if (_t523) goto L_0221C558; else goto L_0221C568;
   L_0221C558: ; // 0x221c558
         /* 0221C558 */ cpu->r[7] = cpu->r[6];
-        /* 0221C55C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x00000005u);
-        /* 0221C560 */ _t524 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221C55C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x00000005u));
+        /* 0221C560 */ _t524 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221C560 */ _t525 = _t524 & 0x00000001u;
         /* 0221C560 */ if (_t525) goto L_0221C578; else goto L_0221C564;
   L_0221C564: ; // 0x221c564
@@ -10484,15 +10484,15 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
   L_0221C568: ; // 0x221c568
         /* 0221C568 */ cpu->r[7] = cpu->r[12] - cpu->r[6];
         /* 0221C56C */ cpu->r[7] = cpu->r[7] + 0xFFFFFFFFu;
-        /* 0221C570 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], 0x00000005u);
-        /* 0221C574 */ _t526 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221C570 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], 0x00000005u));
+        /* 0221C574 */ _t526 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221C574 */ _t527 = _t526 & 0x00000001u;
         /* 0221C574 */ if (_t527) goto L_0221C578; else goto L_0221C588;
   L_0221C578: ; // 0x221c578
         /* 0221C578 */ _t528 = cpu->r[11] + cpu->r[7];
         /* 0221C578 */ cpu->r[0] = rbrew_read8(cpu->mem, _t528);
-        /* 0221C57C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0221C580 */ _t529 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C57C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0221C580 */ _t529 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C580 */ _t530 = _t529 & 0x00000001u;
         /* 0221C580 */ if (_t530) goto L_0221C5CC; else goto L_0221C584;
   L_0221C584: ; // 0x221c584
@@ -10500,13 +10500,13 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
   L_0221C588: ; // 0x221c588
         /* 0221C588 */ _t531 = cpu->r[11] + 0x00000000u;
         /* 0221C588 */ cpu->r[0] = rbrew_read8(cpu->mem, _t531);
-        /* 0221C58C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0221C590 */ _t532 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C58C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0221C590 */ _t532 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C590 */ _t533 = _t532 & 0x00000001u;
         /* 0221C590 */ if (_t533) goto L_0221C5CC; else goto L_0221C594;
   L_0221C594: ; // 0x221c594
-        /* 0221C594 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0221C598 */ _t534 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C594 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0221C598 */ _t534 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C598 */ _t535 = _t534 & 0x00000001u;
         /* 0221C598 */ if (_t535) goto L_0221C628; else goto L_0221C59C;
   L_0221C59C: ; // 0x221c59c
@@ -10515,25 +10515,25 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C5A0 */ cpu->f[0] = cpu->f[6] + cpu->f[1];
         /* 0221C5A4 */ cpu->f[7] = cpu->f[0] - cpu->f[28];
         /* 0221C5A8 */ cpu->f[0] = cpu->f[7] + cpu->f[1];
-        /* 0221C5AC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[6]);
-        /* 0221C5B0 */ _t537 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221C5AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[6]));
+        /* 0221C5B0 */ _t537 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221C5B0 */ _t538 = _t537 & 0x00000001u;
         /* 0221C5B0 */ if (_t538) goto L_0221C5B4; else goto L_0221C628;
   L_0221C5B4: ; // 0x221c5b4
         /* 0221C5B4 */ cpu->r[10] = cpu->r[10] + 0xFFFFFFFFu;
-        /* 0221C5B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0221C5B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0221C5B8 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
         /* 0221C5BC */ _t539 = cpu->r[8] + 0x00000000u;
         /* 0221C5BC */ rbrew_write_f32(cpu->mem, _t539, cpu->f[0]);
         /* 0221C5C0 */ cpu->r[8] = cpu->r[8] + 0x00000004u;
-        /* 0221C5C4 */ _t540 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C5C4 */ _t540 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C5C4 */ _t541 = _t540 & 0x00000001u;
         /* 0221C5C4 */ if (_t541) goto L_0221C5C8; else goto L_0221C538;
   L_0221C5C8: ; // 0x221c5c8
         /* 0221C5C8 */ goto L_0221C638;
   L_0221C5CC: ; // 0x221c5cc
-        /* 0221C5CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0221C5D0 */ _t542 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C5CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0221C5D0 */ _t542 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C5D0 */ _t543 = _t542 & 0x00000001u;
         /* 0221C5D0 */ if (_t543) goto L_0221C5D4; else goto L_0221C614;
   L_0221C5D4: ; // 0x221c5d4
@@ -10577,10 +10577,10 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C624 */ if (_t556) goto L_0221C550; else goto L_0221C628;
   L_0221C628: ; // 0x221c628
         /* 0221C628 */ cpu->r[10] = cpu->r[10] + 0xFFFFFFFFu;
-        /* 0221C628 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0221C628 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0221C62C */ cpu->r[30] = cpu->r[30] + 0x00000001u;
         /* 0221C630 */ cpu->r[8] = cpu->r[8] + 0x00000004u;
-        /* 0221C634 */ _t557 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C634 */ _t557 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C634 */ _t558 = _t557 & 0x00000001u;
         /* 0221C634 */ if (_t558) goto L_0221C638; else goto L_0221C538;
   L_0221C638: ; // 0x221c638
@@ -10603,16 +10603,16 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C668 */ _t562 = cpu->r[26] + 0x00000004u;
         /* 0221C668 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t562);
         /* 0221C668 */ cpu->r[26] = _t562;
-        /* 0221C66C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[23]);
-        /* 0221C670 */ _t563 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221C66C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[23]));
+        /* 0221C670 */ _t563 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221C670 */ _t564 = _t563 & 0x00000001u;
         /* 0221C670 */ if (_t564) goto L_0221C674; else goto L_0221CA34;
   L_0221C674: ; // 0x221c674
         /* 0221C674 */ _t565 = cpu->r[1] + 0x000001B0u;
         /* 0221C674 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t565);
-        /* 0221C678 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0221C678 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0221C67C */ /* nop */
-        /* 0221C680 */ _t566 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C680 */ _t566 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C680 */ _t567 = _t566 & 0x00000001u;
         /* 0221C680 */ if (_t567) goto L_0221C684; else goto L_0221C728;
   L_0221C684: ; // 0x221c684
@@ -10673,7 +10673,7 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C704 */ cpu->r[10] = rbrew_read32(cpu->mem, _t589);
         /* 0221C708 */ _t590 = cpu->r[1] + 0x00000170u;
         /* 0221C708 */ cpu->r[8] = rbrew_read32(cpu->mem, _t590);
-        /* 0221C70C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[23]);
+        /* 0221C70C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[23]));
         /* 0221C710 */ _t591 = cpu->r[1] + 0x000001DCu;
         /* 0221C710 */ rbrew_write32(cpu->mem, _t591, cpu->r[0]);
         /* 0221C714 */ _t592 = cpu->r[1] + 0x000001E0u;
@@ -10681,7 +10681,7 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C718 */ cpu->f[2] = cpu->f[22];
         /* 0221C71C */ _t593 = cpu->r[1] + 0x000001E4u;
         /* 0221C71C */ rbrew_write32(cpu->mem, _t593, cpu->r[10]);
-        /* 0221C720 */ _t594 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221C720 */ _t594 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221C720 */ _t595 = _t594 & 0x00000001u;
         /* 0221C720 */ if (_t595) goto L_0221C724; else goto L_0221C7C8;
   L_0221C724: ; // 0x221c724
@@ -10744,7 +10744,7 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C7A8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t617);
         /* 0221C7AC */ _t618 = cpu->r[1] + 0x00000170u;
         /* 0221C7AC */ cpu->r[8] = rbrew_read32(cpu->mem, _t618);
-        /* 0221C7B0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[23]);
+        /* 0221C7B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[23]));
         /* 0221C7B4 */ _t619 = cpu->r[1] + 0x000001DCu;
         /* 0221C7B4 */ rbrew_write32(cpu->mem, _t619, cpu->r[0]);
         /* 0221C7B8 */ _t620 = cpu->r[1] + 0x000001E0u;
@@ -10752,7 +10752,7 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C7BC */ cpu->f[2] = cpu->f[22];
         /* 0221C7C0 */ _t621 = cpu->r[1] + 0x000001E4u;
         /* 0221C7C0 */ rbrew_write32(cpu->mem, _t621, cpu->r[10]);
-        /* 0221C7C4 */ _t622 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221C7C4 */ _t622 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221C7C4 */ _t623 = _t622 & 0x00000001u;
         /* 0221C7C4 */ if (_t623) goto L_0221C800; else goto L_0221C7C8;
   L_0221C7C8: ; // 0x221c7c8
@@ -10768,10 +10768,10 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C7E8 */ rbrew_write32(cpu->mem, _t624, cpu->r[11]);
         /* 0221C7EC */ Gambit_fn_0204A4DC(cpu);
         /* 0221C7F0 */ cpu->r[4] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0221C7F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 0221C7F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 0221C7F4 */ _t625 = cpu->r[31] + 0x000001F0u;
         /* 0221C7F4 */ rbrew_write32(cpu->mem, _t625, cpu->r[3]);
-        /* 0221C7F8 */ _t626 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C7F8 */ _t626 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C7F8 */ _t627 = _t626 & 0x00000001u;
         /* 0221C7F8 */ if (_t627) goto L_0221CA34; else goto L_0221C7FC;
   L_0221C7FC: ; // 0x221c7fc
@@ -10788,10 +10788,10 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C820 */ cpu->r[9] = cpu->r[31] + 0x000001F0u;
         /* 0221C824 */ Gambit_fn_0204A864(cpu);
         /* 0221C828 */ cpu->r[4] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0221C828 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 0221C828 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 0221C82C */ _t628 = cpu->r[31] + 0x000001F0u;
         /* 0221C82C */ rbrew_write32(cpu->mem, _t628, cpu->r[3]);
-        /* 0221C830 */ _t629 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C830 */ _t629 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C830 */ _t630 = _t629 & 0x00000001u;
         /* 0221C830 */ if (_t630) goto L_0221CA34; else goto L_0221C834;
   L_0221C834: ; // 0x221c834
@@ -10801,8 +10801,8 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C83C */ cpu->f[21] = cpu->f[23];
         /* 0221C840 */ goto L_0221C84C;
   L_0221C844: ; // 0x221c844
-        /* 0221C844 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 0221C848 */ _t632 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 0221C848 */ _t632 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C848 */ _t633 = _t632 & 0x00000001u;
         /* 0221C848 */ if (_t633) goto L_0221C84C; else goto L_0221C868;
   L_0221C84C: ; // 0x221c84c
@@ -10821,30 +10821,30 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C870 */ cpu->r[5] = cpu->r[11] + 0xFFFFFFFFu;
         /* 0221C874 */ cpu->r[11] = cpu->r[11] - cpu->r[5];
   L_0221C878: ; // 0x221c878
-        /* 0221C878 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0221C87C */ _t636 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C878 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0221C87C */ _t636 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C87C */ _t637 = _t636 & 0x00000001u;
         /* 0221C87C */ if (_t637) goto L_0221CA28; else goto L_0221C880;
   L_0221C880: ; // 0x221c880
-        /* 0221C880 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 0221C880 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 0221C884 */ _t638 = cpu->r[23] + 0x00000000u;
         /* 0221C884 */ cpu->r[0] = rbrew_read32(cpu->mem, _t638);
-        /* 0221C888 */ _t639 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C888 */ _t639 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C888 */ _t640 = _t639 & 0x00000001u;
         /* 0221C888 */ if (_t640) goto L_0221C88C; else goto L_0221C918;
   L_0221C88C: ; // 0x221c88c
         /* 0221C88C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0221C88C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0221C890 */ _t641 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C88C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0221C890 */ _t641 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C890 */ _t642 = _t641 & 0x00000001u;
         /* 0221C890 */ if (_t642) goto L_0221C8CC; else goto L_0221C894;
   L_0221C894: ; // 0x221c894
         /* 0221C894 */ cpu->r[3] = cpu->r[23] + 0x0000012Cu;
         /* 0221C898 */ Gambit_fn_02C69350(cpu);
-        /* 0221C89C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[20]);
+        /* 0221C89C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[20]));
         /* 0221C8A0 */ _t643 = cpu->r[23] + 0x00000000u;
         /* 0221C8A0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t643);
-        /* 0221C8A4 */ _t644 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221C8A4 */ _t644 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221C8A4 */ _t645 = _t644 & 0x00000001u;
         /* 0221C8A4 */ if (_t645) goto L_0221C8A8; else goto L_0221C8C4;
   L_0221C8A8: ; // 0x221c8a8
@@ -10889,25 +10889,25 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C904 */ _t659 = cpu->r[1] + 0x00000024u;
         /* 0221C904 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t659);
         /* 0221C908 */ cpu->f[9] = fma(cpu->f[7], cpu->f[8], cpu->f[9]);
-        /* 0221C90C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[20]);
-        /* 0221C910 */ _t660 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221C90C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[20]));
+        /* 0221C910 */ _t660 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221C910 */ _t661 = _t660 & 0x00000001u;
         /* 0221C910 */ if (_t661) goto L_0221C9A4; else goto L_0221C914;
   L_0221C914: ; // 0x221c914
         /* 0221C914 */ goto L_0221CA28;
   L_0221C918: ; // 0x221c918
         /* 0221C918 */ cpu->r[4] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0221C918 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0221C91C */ _t662 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0221C91C */ _t662 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C91C */ _t663 = _t662 & 0x00000001u;
         /* 0221C91C */ if (_t663) goto L_0221C958; else goto L_0221C920;
   L_0221C920: ; // 0x221c920
         /* 0221C920 */ cpu->r[3] = cpu->r[23] + 0x00000138u;
         /* 0221C924 */ Gambit_fn_02C69350(cpu);
-        /* 0221C928 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[20]);
+        /* 0221C928 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[20]));
         /* 0221C92C */ _t664 = cpu->r[23] + 0x00000000u;
         /* 0221C92C */ cpu->r[5] = rbrew_read32(cpu->mem, _t664);
-        /* 0221C930 */ _t665 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221C930 */ _t665 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221C930 */ _t666 = _t665 & 0x00000001u;
         /* 0221C930 */ if (_t666) goto L_0221C934; else goto L_0221C950;
   L_0221C934: ; // 0x221c934
@@ -10954,13 +10954,13 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C994 */ _t681 = cpu->r[1] + 0x00000024u;
         /* 0221C994 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t681);
         /* 0221C998 */ cpu->f[9] = fma(cpu->f[7], cpu->f[8], cpu->f[9]);
-        /* 0221C99C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[20]);
-        /* 0221C9A0 */ _t682 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221C99C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[20]));
+        /* 0221C9A0 */ _t682 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221C9A0 */ _t683 = _t682 & 0x00000001u;
         /* 0221C9A0 */ if (_t683) goto L_0221C9A4; else goto L_0221CA28;
   L_0221C9A4: ; // 0x221c9a4
-        /* 0221C9A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 0221C9A8 */ _t684 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221C9A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 0221C9A8 */ _t684 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221C9A8 */ _t685 = _t684 & 0x00000001u;
         /* 0221C9A8 */ if (_t685) goto L_0221C9AC; else goto L_0221C9E8;
   L_0221C9AC: ; // 0x221c9ac
@@ -10979,10 +10979,10 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221C9D0 */ cpu->f[9] = fma(cpu->f[6], cpu->f[9], cpu->f[7]);
         /* 0221C9D4 */ _t689 = cpu->r[22] + 0x00000000u;
         /* 0221C9D4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t689);
-        /* 0221C9D8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[9]);
+        /* 0221C9D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[9]));
         /* 0221C9DC */ _t690 = cpu->r[1] + 0x00000018u;
         /* 0221C9DC */ rbrew_write_f32(cpu->mem, _t690, cpu->f[6]);
-        /* 0221C9E0 */ _t691 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221C9E0 */ _t691 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221C9E0 */ _t692 = _t691 & 0x00000001u;
         /* 0221C9E0 */ if (_t692) goto L_0221C9E4; else goto L_0221CA28;
   L_0221C9E4: ; // 0x221c9e4
@@ -11003,10 +11003,10 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221CA0C */ cpu->f[9] = fma(cpu->f[6], cpu->f[9], cpu->f[7]);
         /* 0221CA10 */ _t696 = cpu->r[22] + 0x00000000u;
         /* 0221CA10 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t696);
-        /* 0221CA14 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[9]);
+        /* 0221CA14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[9]));
         /* 0221CA18 */ _t697 = cpu->r[1] + 0x00000018u;
         /* 0221CA18 */ rbrew_write_f32(cpu->mem, _t697, cpu->f[6]);
-        /* 0221CA1C */ _t698 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221CA1C */ _t698 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221CA1C */ _t699 = _t698 & 0x00000001u;
         /* 0221CA1C */ if (_t699) goto L_0221CA20; else goto L_0221CA28;
   L_0221CA20: ; // 0x221ca20
@@ -11015,15 +11015,15 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221CA24 */ rbrew_write_f32(cpu->mem, _t700, cpu->f[11]);
   L_0221CA28: ; // 0x221ca28
         /* 0221CA28 */ cpu->r[24] = cpu->r[24] + 0x00000001u;
-        /* 0221CA2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000002u);
-        /* 0221CA30 */ _t701 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221CA2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000002u));
+        /* 0221CA30 */ _t701 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221CA30 */ _t702 = _t701 & 0x00000001u;
         /* 0221CA30 */ if (_t702) goto L_0221C844; else goto L_0221CA34;
   L_0221CA34: ; // 0x221ca34
         /* 0221CA34 */ cpu->r[27] = cpu->r[27] + 0xFFFFFFFFu;
-        /* 0221CA34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0221CA34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0221CA38 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0221CA3C */ _t703 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221CA3C */ _t703 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221CA3C */ _t704 = _t703 & 0x00000001u;
         /* 0221CA3C */ if (_t704) goto L_0221CA40; else goto L_0221C668;
   L_0221CA40: ; // 0x221ca40
@@ -11058,7 +11058,7 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221CA84 */ cpu->r[4] = rbrew_read32(cpu->mem, _t715);
         /* 0221CA88 */ _t716 = cpu->r[1] + 0x00000234u;
         /* 0221CA88 */ rbrew_write_f32(cpu->mem, _t716, cpu->f[11]);
-        /* 0221CA8C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[30]);
+        /* 0221CA8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[30]));
         /* 0221CA90 */ _t717 = cpu->r[1] + 0x00000338u;
         /* 0221CA90 */ rbrew_write32(cpu->mem, _t717, cpu->r[4]);
         /* 0221CA94 */ _t718 = cpu->r[1] + 0x00000338u;
@@ -11067,17 +11067,17 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221CA98 */ rbrew_write_f32(cpu->mem, _t719, cpu->f[12]);
         /* 0221CA9C */ _t720 = cpu->r[1] + 0x0000023Cu;
         /* 0221CA9C */ rbrew_write_f32(cpu->mem, _t720, cpu->f[13]);
-        /* 0221CAA0 */ _t721 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221CAA0 */ _t721 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221CAA0 */ _t722 = _t721 & 0x00000001u;
         /* 0221CAA0 */ if (_t722) goto L_0221CAA4; else goto L_0221D38C;
   L_0221CAA4: ; // 0x221caa4
         /* 0221CAA4 */ _t723 = cpu->r[31] + 0x00000120u;
         /* 0221CAA4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t723);
         /* 0221CAA8 */ cpu->r[5] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 0221CAA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0221CAA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0221CAAC */ _t724 = cpu->r[28] + 0x00000000u;
         /* 0221CAAC */ cpu->f[2] = rbrew_read_f32(cpu->mem, _t724);
-        /* 0221CAB0 */ _t725 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221CAB0 */ _t725 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221CAB0 */ _t726 = _t725 & 0x00000001u;
         /* 0221CAB0 */ if (_t726) goto L_0221CAD0; else goto L_0221CAB4;
   L_0221CAB4: ; // 0x221cab4
@@ -11086,10 +11086,10 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221CAB8 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t727);
         /* 0221CABC */ _t728 = cpu->r[31] + 0x000001F4u;
         /* 0221CABC */ cpu->r[9] = rbrew_read32(cpu->mem, _t728);
-        /* 0221CAC0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 0221CAC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 0221CAC4 */ _t729 = cpu->r[18] + 0x00000000u;
         /* 0221CAC4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t729);
-        /* 0221CAC8 */ _t730 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221CAC8 */ _t730 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221CAC8 */ _t731 = _t730 & 0x00000001u;
         /* 0221CAC8 */ if (_t731) goto L_0221CACC; else goto L_0221CAE8;
   L_0221CACC: ; // 0x221cacc
@@ -11100,10 +11100,10 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221CAD4 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t732);
         /* 0221CAD8 */ _t733 = cpu->r[31] + 0x000001F4u;
         /* 0221CAD8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t733);
-        /* 0221CADC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 0221CADC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 0221CAE0 */ _t734 = cpu->r[18] + 0x00000000u;
         /* 0221CAE0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t734);
-        /* 0221CAE4 */ _t735 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221CAE4 */ _t735 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221CAE4 */ _t736 = _t735 & 0x00000001u;
         /* 0221CAE4 */ if (_t736) goto L_0221CB28; else goto L_0221CAE8;
   L_0221CAE8: ; // 0x221cae8
@@ -11122,10 +11122,10 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221CB10 */ rbrew_write32(cpu->mem, _t738, cpu->r[0]);
         /* 0221CB14 */ Gambit_fn_0204A4DC(cpu);
         /* 0221CB18 */ cpu->r[8] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0221CB18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0221CB18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0221CB1C */ _t739 = cpu->r[31] + 0x000001F0u;
         /* 0221CB1C */ rbrew_write32(cpu->mem, _t739, cpu->r[3]);
-        /* 0221CB20 */ _t740 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221CB20 */ _t740 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221CB20 */ _t741 = _t740 & 0x00000001u;
         /* 0221CB20 */ if (_t741) goto L_0221D38C; else goto L_0221CB24;
   L_0221CB24: ; // 0x221cb24
@@ -11145,10 +11145,10 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221CB50 */ cpu->r[6] = cpu->r[6] + 0x00000002u;
         /* 0221CB54 */ Gambit_fn_0204A864(cpu);
         /* 0221CB58 */ cpu->r[8] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0221CB58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0221CB58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0221CB5C */ _t743 = cpu->r[31] + 0x000001F0u;
         /* 0221CB5C */ rbrew_write32(cpu->mem, _t743, cpu->r[3]);
-        /* 0221CB60 */ _t744 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221CB60 */ _t744 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221CB60 */ _t745 = _t744 & 0x00000001u;
         /* 0221CB60 */ if (_t745) goto L_0221D38C; else goto L_0221CB64;
   L_0221CB64: ; // 0x221cb64
@@ -11157,8 +11157,8 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221CB68 */ _t747 = cpu->r[26] + 0x0000015Cu;
         /* 0221CB68 */ cpu->r[10] = rbrew_read32(cpu->mem, _t747);
         /* 0221CB6C */ cpu->r[9] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Cu, 0x0000001Eu);
-        /* 0221CB6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0221CB70 */ _t748 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221CB6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0221CB70 */ _t748 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221CB70 */ _t749 = _t748 & 0x00000001u;
         /* 0221CB70 */ if (_t749) goto L_0221D38C; else goto L_0221CB74;
   L_0221CB74: ; // 0x221cb74
@@ -11170,10 +11170,10 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221CB84 */ _t751 = cpu->r[11] + cpu->r[21];
         /* 0221CB84 */ cpu->r[23] = rbrew_read32(cpu->mem, _t751);
         /* 0221CB88 */ cpu->r[27] = 0x00000000u;
-        /* 0221CB8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
+        /* 0221CB8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
         /* 0221CB90 */ _t752 = cpu->r[1] + 0x000001BCu;
         /* 0221CB90 */ rbrew_write32(cpu->mem, _t752, cpu->r[17]);
-        /* 0221CB94 */ _t753 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221CB94 */ _t753 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221CB94 */ _t754 = _t753 & 0x00000001u;
         /* 0221CB94 */ if (_t754) goto L_0221CB98; else goto L_0221D38C;
   L_0221CB98: ; // 0x221cb98
@@ -11293,10 +11293,10 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221CCC8 */ rbrew_write32(cpu->mem, _t790, cpu->r[11]);
         /* 0221CCCC */ _t791 = cpu->r[1] + 0x0000006Cu;
         /* 0221CCCC */ rbrew_write32(cpu->mem, _t791, cpu->r[7]);
-        /* 0221CCD0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x000000FDu);
+        /* 0221CCD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x000000FDu));
         /* 0221CCD4 */ _t792 = cpu->r[1] + 0x00000070u;
         /* 0221CCD4 */ rbrew_write32(cpu->mem, _t792, cpu->r[8]);
-        /* 0221CCD8 */ _t793 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221CCD8 */ _t793 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221CCD8 */ _t794 = _t793 & 0x00000001u;
         /* 0221CCD8 */ if (_t794) goto L_0221CCDC; else goto L_0221CED4;
   L_0221CCDC: ; // 0x221ccdc
@@ -11306,8 +11306,8 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221CCE4 */ _t796 = cpu->r[9] + 0xFFFFCEDCu;
         /* 0221CCE4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t796);
         /* 0221CCE8 */ Gambit_fn_023E4380(cpu);
-        /* 0221CCEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221CCF0 */ _t797 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221CCEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221CCF0 */ _t797 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221CCF0 */ _t798 = _t797 & 0x00000001u;
         /* 0221CCF0 */ if (_t798) goto L_0221CED4; else goto L_0221CCF4;
   L_0221CCF4: ; // 0x221ccf4
@@ -11504,9 +11504,9 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221CED4 */ _t863 = cpu->r[31] + 0x00000120u;
         /* 0221CED4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t863);
         /* 0221CED8 */ cpu->r[9] = rbrew_rlwinm(cpu->r[9], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 0221CED8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0221CED8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0221CEDC */ cpu->r[3] = cpu->r[31];
-        /* 0221CEE0 */ _t864 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221CEE0 */ _t864 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221CEE0 */ _t865 = _t864 & 0x00000001u;
         /* 0221CEE0 */ if (_t865) goto L_0221D318; else goto L_0221CEE4;
   L_0221CEE4: ; // 0x221cee4
@@ -11555,18 +11555,18 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221CF50 */ _t881 = cpu->r[26] + 0x00000000u;
         /* 0221CF50 */ cpu->r[6] = rbrew_read32(cpu->mem, _t881);
         /* 0221CF54 */ cpu->r[4] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0221CF54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 0221CF54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 0221CF58 */ cpu->r[16] = cpu->r[26] + 0x00000048u;
-        /* 0221CF5C */ _t882 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221CF5C */ _t882 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221CF5C */ _t883 = _t882 & 0x00000001u;
         /* 0221CF5C */ if (_t883) goto L_0221CF98; else goto L_0221CF60;
   L_0221CF60: ; // 0x221cf60
         /* 0221CF60 */ cpu->r[3] = cpu->r[26] + 0x0000012Cu;
         /* 0221CF64 */ Gambit_fn_02C69350(cpu);
-        /* 0221CF68 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 0221CF68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 0221CF6C */ _t884 = cpu->r[26] + 0x00000000u;
         /* 0221CF6C */ cpu->r[0] = rbrew_read32(cpu->mem, _t884);
-        /* 0221CF70 */ _t885 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221CF70 */ _t885 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221CF70 */ _t886 = _t885 & 0x00000001u;
         /* 0221CF70 */ if (_t886) goto L_0221CF74; else goto L_0221CF90;
   L_0221CF74: ; // 0x221cf74
@@ -11588,8 +11588,8 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221CF9C */ Gambit_fn_02C88F2C(cpu);
         /* 0221CFA0 */ _t890 = cpu->r[16] + 0x00000004u;
         /* 0221CFA0 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t890);
-        /* 0221CFA4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[1]);
-        /* 0221CFA8 */ _t891 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221CFA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[1]));
+        /* 0221CFA8 */ _t891 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221CFA8 */ _t892 = _t891 & 0x00000001u;
         /* 0221CFA8 */ if (_t892) goto L_0221D380; else goto L_0221CFAC;
   L_0221CFAC: ; // 0x221cfac
@@ -11602,25 +11602,25 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221CFB8 */ Gambit_fn_0261F55C(cpu);
         /* 0221CFBC */ cpu->r[16] = cpu->r[3];
         /* 0221CFC0 */ Gambit_fn_025AD3E8(cpu);
-        /* 0221CFC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221CFC8 */ _t896 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221CFC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221CFC8 */ _t896 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221CFC8 */ _t897 = _t896 & 0x00000001u;
         /* 0221CFC8 */ if (_t897) goto L_0221D380; else goto L_0221CFCC;
   L_0221CFCC: ; // 0x221cfcc
         /* 0221CFCC */ _t898 = cpu->r[16] + 0x00000304u;
         /* 0221CFCC */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t898);
-        /* 0221CFD0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[29]);
-        /* 0221CFD4 */ _t899 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221CFD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[29]));
+        /* 0221CFD4 */ _t899 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221CFD4 */ _t900 = _t899 & 0x00000001u;
         /* 0221CFD4 */ if (_t900) goto L_0221CFD8; else goto L_0221D380;
   L_0221CFD8: ; // 0x221cfd8
         /* 0221CFD8 */ _t901 = cpu->r[31] + 0x0000020Cu;
         /* 0221CFD8 */ cpu->r[5] = rbrew_read8(cpu->mem, _t901);
         /* 0221CFDC */ cpu->r[12] = 0x00000001u;
-        /* 0221CFE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0221CFE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0221CFE4 */ _t902 = cpu->r[1] + 0x0000000Cu;
         /* 0221CFE4 */ rbrew_write8(cpu->mem, _t902, (uint8_t)cpu->r[12]);
-        /* 0221CFE8 */ _t903 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221CFE8 */ _t903 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221CFE8 */ _t904 = _t903 & 0x00000001u;
         /* 0221CFE8 */ if (_t904) goto L_0221D300; else goto L_0221CFEC;
   L_0221CFEC: ; // 0x221cfec
@@ -11639,8 +11639,8 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221D00C */ _t909 = cpu->r[16] + 0x00000000u;
         /* 0221D00C */ cpu->r[0] = rbrew_read32(cpu->mem, _t909);
         /* 0221D010 */ cpu->r[5] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0221D010 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 0221D014 */ _t910 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D010 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 0221D014 */ _t910 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D014 */ _t911 = _t910 & 0x00000001u;
         /* 0221D014 */ if (_t911) goto L_0221D0C4; else goto L_0221D018;
   L_0221D018: ; // 0x221d018
@@ -11704,8 +11704,8 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221D0A8 */ _t933 = cpu->r[16] + 0x00000000u;
         /* 0221D0A8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t933);
         /* 0221D0AC */ cpu->r[4] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0221D0AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0221D0B0 */ _t934 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D0AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0221D0B0 */ _t934 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D0B0 */ _t935 = _t934 & 0x00000001u;
         /* 0221D0B0 */ if (_t935) goto L_0221D0B4; else goto L_0221D108;
   L_0221D0B4: ; // 0x221d0b4
@@ -11739,8 +11739,8 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221D0FC */ _t944 = cpu->r[16] + 0x00000000u;
         /* 0221D0FC */ cpu->r[5] = rbrew_read32(cpu->mem, _t944);
         /* 0221D100 */ cpu->r[4] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0221D100 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0221D104 */ _t945 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D100 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0221D104 */ _t945 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D104 */ _t946 = _t945 & 0x00000001u;
         /* 0221D104 */ if (_t946) goto L_0221D0B4; else goto L_0221D108;
   L_0221D108: ; // 0x221d108
@@ -11824,8 +11824,8 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221D208 */ _t959 = cpu->r[1] + 0x00000218u;
         /* 0221D208 */ cpu->r[4] = rbrew_read32(cpu->mem, _t959);
         /* 0221D20C */ cpu->r[11] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0221D20C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0221D210 */ _t960 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D20C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0221D210 */ _t960 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D210 */ _t961 = _t960 & 0x00000001u;
         /* 0221D210 */ if (_t961) goto L_0221D2FC; else goto L_0221D214;
   L_0221D214: ; // 0x221d214
@@ -11834,16 +11834,16 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221D218 */ cpu->r[4] = 0x000000E0u;
         /* 0221D21C */ cpu->r[3] = cpu->r[15];
         /* 0221D220 */ Gambit_fn_0221E544(cpu);
-        /* 0221D224 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221D228 */ _t963 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D224 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221D228 */ _t963 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D228 */ _t964 = _t963 & 0x00000001u;
         /* 0221D228 */ if (_t964) goto L_0221D22C; else goto L_0221D240;
   L_0221D22C: ; // 0x221d22c
         /* 0221D22C */ cpu->r[3] = cpu->r[15];
         /* 0221D230 */ cpu->r[4] = 0x0000000Eu;
         /* 0221D234 */ Gambit_fn_0221E544(cpu);
-        /* 0221D238 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221D23C */ _t965 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D238 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221D23C */ _t965 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D23C */ _t966 = _t965 & 0x00000001u;
         /* 0221D23C */ if (_t966) goto L_0221D2FC; else goto L_0221D240;
   L_0221D240: ; // 0x221d240
@@ -11858,9 +11858,9 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221D254 */ Gambit_fn_0221E138(cpu);
         /* 0221D258 */ cpu->r[3] = cpu->r[1] + 0x000000DCu;
         /* 0221D25C */ Gambit_fn_0221E138(cpu);
-        /* 0221D260 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[16], 0x00000000u);
+        /* 0221D260 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[16], 0x00000000u));
         /* 0221D264 */ cpu->r[14] = 0x00000000u;
-        /* 0221D268 */ _t970 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221D268 */ _t970 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221D268 */ _t971 = _t970 & 0x00000001u;
         /* 0221D268 */ if (_t971) goto L_0221D26C; else goto L_0221D2FC;
   L_0221D26C: ; // 0x221d26c
@@ -11907,9 +11907,9 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221D2E8 */ rbrew_write32(cpu->mem, _t979, cpu->r[12]);
         /* 0221D2EC */ Gambit_fn_0221B0A4(cpu);
         /* 0221D2F0 */ cpu->r[16] = cpu->r[16] + 0xFFFFFFFFu;
-        /* 0221D2F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[16], 0x00000000u);
+        /* 0221D2F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[16], 0x00000000u));
         /* 0221D2F4 */ cpu->r[14] = cpu->r[14] + 0x00000001u;
-        /* 0221D2F8 */ _t980 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D2F8 */ _t980 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D2F8 */ _t981 = _t980 & 0x00000001u;
         /* 0221D2F8 */ if (_t981) goto L_0221D2FC; else goto L_0221D278;
   L_0221D2FC: ; // 0x221d2fc
@@ -11920,9 +11920,9 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221D304 */ _t983 = cpu->r[31] + 0x0000020Cu;
         /* 0221D304 */ rbrew_write8(cpu->mem, _t983, (uint8_t)cpu->r[10]);
         /* 0221D308 */ cpu->r[23] = cpu->r[23] + 0xFFFFFFFFu;
-        /* 0221D308 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
+        /* 0221D308 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
         /* 0221D30C */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 0221D310 */ _t984 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D310 */ _t984 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D310 */ _t985 = _t984 & 0x00000001u;
         /* 0221D310 */ if (_t985) goto L_0221D314; else goto L_0221CC18;
   L_0221D314: ; // 0x221d314
@@ -11966,9 +11966,9 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221D37C */ Gambit_fn_0221B23C(cpu);
   L_0221D380: ; // 0x221d380
         /* 0221D380 */ cpu->r[23] = cpu->r[23] + 0xFFFFFFFFu;
-        /* 0221D380 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
+        /* 0221D380 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
         /* 0221D384 */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 0221D388 */ _t996 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D388 */ _t996 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D388 */ _t997 = _t996 & 0x00000001u;
         /* 0221D388 */ if (_t997) goto L_0221D38C; else goto L_0221CC18;
   L_0221D38C: ; // 0x221d38c
@@ -11980,8 +11980,8 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221D3A0 */ Gambit_fn_0221E164(cpu);
         /* 0221D3A4 */ _t998 = cpu->r[1] + 0x0000000Cu;
         /* 0221D3A4 */ cpu->r[12] = rbrew_read8(cpu->mem, _t998);
-        /* 0221D3A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0221D3AC */ _t999 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D3A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0221D3AC */ _t999 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D3AC */ _t1000 = _t999 & 0x00000001u;
         /* 0221D3AC */ if (_t1000) goto L_0221D3B0; else goto L_0221D3B4;
   L_0221D3B0: ; // 0x221d3b0
@@ -12027,8 +12027,8 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221D418 */ rbrew_write32(cpu->mem, _t1011, cpu->r[9]);
         /* 0221D41C */ _t1012 = cpu->r[31] + 0x0000020Du;
         /* 0221D41C */ cpu->r[9] = rbrew_read8(cpu->mem, _t1012);
-        /* 0221D420 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000002u);
-        /* 0221D424 */ _t1013 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221D420 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000002u));
+        /* 0221D424 */ _t1013 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221D424 */ _t1014 = _t1013 & 0x00000001u;
         /* 0221D424 */ if (_t1014) goto L_0221D440; else goto L_0221D428;
   L_0221D428: ; // 0x221d428
@@ -12039,8 +12039,8 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221D430 */ rbrew_write32(cpu->mem, _t1016, cpu->r[10]);
         /* 0221D434 */ _t1017 = cpu->r[31] + 0x0000020Du;
         /* 0221D434 */ cpu->r[9] = rbrew_read8(cpu->mem, _t1017);
-        /* 0221D438 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x000000FFu);
-        /* 0221D43C */ _t1018 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221D438 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x000000FFu));
+        /* 0221D43C */ _t1018 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221D43C */ _t1019 = _t1018 & 0x00000001u;
         /* 0221D43C */ if (_t1019) goto L_0221D440; else goto L_0221D448;
   L_0221D440: ; // 0x221d440
@@ -12099,10 +12099,10 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221D4D0 */ cpu->r[10] = cpu->r[6];
         /* 0221D4D4 */ Gambit_fn_0204A4DC(cpu);
         /* 0221D4D8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0221D4D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221D4D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221D4DC */ _t1035 = cpu->r[1] + 0x0000036Cu;
         /* 0221D4DC */ rbrew_write32(cpu->mem, _t1035, cpu->r[3]);
-        /* 0221D4E0 */ _t1036 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D4E0 */ _t1036 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D4E0 */ _t1037 = _t1036 & 0x00000001u;
         /* 0221D4E0 */ if (_t1037) goto L_0221D4F0; else goto L_0221D4E4;
   L_0221D4E4: ; // 0x221d4e4
@@ -12114,8 +12114,8 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221D4F0 */ _t1039 = cpu->r[31] + 0x00000120u;
         /* 0221D4F0 */ cpu->r[6] = rbrew_read32(cpu->mem, _t1039);
         /* 0221D4F4 */ cpu->r[6] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 0221D4F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0221D4F8 */ _t1040 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D4F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0221D4F8 */ _t1040 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D4F8 */ _t1041 = _t1040 & 0x00000001u;
         /* 0221D4F8 */ if (_t1041) goto L_0221D4FC; else goto L_0221D524;
   L_0221D4FC: ; // 0x221d4fc
@@ -12125,8 +12125,8 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
   L_0221D508: ; // 0x221d508
         /* 0221D508 */ _t1042 = cpu->r[7] + 0x00000004u;
         /* 0221D508 */ cpu->r[4] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t1042);
-        /* 0221D50C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0221D510 */ _t1043 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221D50C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0221D510 */ _t1043 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221D510 */ _t1044 = _t1043 & 0x00000001u;
         /* 0221D510 */ if (_t1044) goto L_0221D514; else goto L_0221D51C;
   L_0221D514: ; // 0x221d514
@@ -12206,7 +12206,7 @@ void Gambit_fn_0221B5BC(CPUState* cpu) {
         /* 0221D5A0 */ cpu->f[25] = rbrew_read_f64(cpu->mem, _t1079);
         /* 0221D5A4 */ _t1080 = cpu->r[1] + 0x000004E8u;
         /* 0221D5A4 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t1080);
-        /* 0221D5A8 */ _t1081 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221D5A8 */ _t1081 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221D5A8 */ _t1082 = _t1081 & 0x00000001u;
         /* 0221D5A8 */ if (_t1082) goto L_0221D5AC; // else: addr-0 trap, fall-through
   L_0221D5AC: ; // 0x221d5ac
@@ -12352,36 +12352,36 @@ void Gambit_fn_0221D62C(CPUState* cpu) {
         /* 0221D66C */ cpu->r[30] = cpu->r[4];
         /* 0221D670 */ cpu->r[27] = cpu->r[6];
         /* 0221D674 */ cpu->r[9] = 0x10050000u;
-        /* 0221D678 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[10]);
+        /* 0221D678 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[10]));
         /* 0221D67C */ _t10 = cpu->r[9] + 0xFFFFBE2Cu;
         /* 0221D67C */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t10);
-        /* 0221D680 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D680 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D680 */ _t12 = _t11 & 0x00000001u;
         /* 0221D680 */ if (_t12) goto L_0221D84C; else goto L_0221D684;
   L_0221D684: ; // 0x221d684
-        /* 0221D684 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000008u);
-        /* 0221D688 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D684 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000008u));
+        /* 0221D688 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D688 */ _t14 = _t13 & 0x00000001u;
         /* 0221D688 */ if (_t14) goto L_0221D68C; else goto L_0221D698;
   L_0221D68C: ; // 0x221d68c
         /* 0221D68C */ _t15 = cpu->r[29] + 0x00000120u;
         /* 0221D68C */ cpu->r[0] = rbrew_read32(cpu->mem, _t15);
         /* 0221D690 */ cpu->r[0] = cpu->r[0] & 0x00500000u;
-        /* 0221D690 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0221D694 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D690 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0221D694 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D694 */ _t17 = _t16 & 0x00000001u;
         /* 0221D694 */ if (_t17) goto L_0221D698; else goto L_0221D84C;
   L_0221D698: ; // 0x221d698
-        /* 0221D698 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000005u);
-        /* 0221D69C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D698 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000005u));
+        /* 0221D69C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D69C */ _t19 = _t18 & 0x00000001u;
         /* 0221D69C */ if (_t19) goto L_0221D6A0; else goto L_0221D6AC;
   L_0221D6A0: ; // 0x221d6a0
         /* 0221D6A0 */ _t20 = cpu->r[29] + 0x00000120u;
         /* 0221D6A0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
         /* 0221D6A4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000009u, 0x00000009u);
-        /* 0221D6A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0221D6A8 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D6A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0221D6A8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D6A8 */ _t22 = _t21 & 0x00000001u;
         /* 0221D6A8 */ if (_t22) goto L_0221D6AC; else goto L_0221D84C;
   L_0221D6AC: ; // 0x221d6ac
@@ -12389,43 +12389,43 @@ void Gambit_fn_0221D62C(CPUState* cpu) {
         /* 0221D6AC */ cpu->r[4] = rbrew_read32(cpu->mem, _t23);
         /* 0221D6B0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000008u, 0x0000001Du, 0x0000001Fu);
         /* 0221D6B4 */ cpu->r[5] = cpu->r[0] & 0x00000005u;
-        /* 0221D6B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 0221D6B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000005u);
-        /* 0221D6BC */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D6B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 0221D6B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000005u));
+        /* 0221D6BC */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D6BC */ _t25 = _t24 & 0x00000001u;
         /* 0221D6BC */ if (_t25) goto L_0221D804; else goto L_0221D6C0;
   L_0221D6C0: ; // 0x221d6c0
         /* 0221D6C0 */ _t26 = cpu->r[29] + 0x00000120u;
         /* 0221D6C0 */ cpu->r[6] = rbrew_read32(cpu->mem, _t26);
         /* 0221D6C4 */ cpu->r[6] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 0221D6C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0221D6C8 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D6C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0221D6C8 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D6C8 */ _t28 = _t27 & 0x00000001u;
         /* 0221D6C8 */ if (_t28) goto L_0221D6CC; else goto L_0221D7F8;
   L_0221D6CC: ; // 0x221d6cc
-        /* 0221D6CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000005u);
-        /* 0221D6D0 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D6CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000005u));
+        /* 0221D6D0 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D6D0 */ _t30 = _t29 & 0x00000001u;
         /* 0221D6D0 */ if (_t30) goto L_0221D7F8; else goto L_0221D6D4;
   L_0221D6D4: ; // 0x221d6d4
-        /* 0221D6D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000008u);
-        /* 0221D6D8 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D6D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000008u));
+        /* 0221D6D8 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D6D8 */ _t32 = _t31 & 0x00000001u;
         /* 0221D6D8 */ if (_t32) goto L_0221D7F8; else goto L_0221D6DC;
   L_0221D6DC: ; // 0x221d6dc
         /* 0221D6DC */ _t33 = cpu->r[29] + 0x0000020Cu;
         /* 0221D6DC */ cpu->r[7] = rbrew_read32(cpu->mem, _t33);
         /* 0221D6E0 */ cpu->r[7] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0221D6E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0221D6E4 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D6E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0221D6E4 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D6E4 */ _t35 = _t34 & 0x00000001u;
         /* 0221D6E4 */ if (_t35) goto L_0221D6E8; else goto L_0221D84C;
   L_0221D6E8: ; // 0x221d6e8
         /* 0221D6E8 */ _t36 = cpu->r[29] + 0x00000120u;
         /* 0221D6E8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t36);
         /* 0221D6EC */ cpu->r[8] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x00000002u, 0x00000002u);
-        /* 0221D6EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 0221D6F0 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D6EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 0221D6F0 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D6F0 */ _t38 = _t37 & 0x00000001u;
         /* 0221D6F0 */ if (_t38) goto L_0221D6F4; else goto L_0221D84C;
   L_0221D6F4: ; // 0x221d6f4
@@ -12434,9 +12434,9 @@ void Gambit_fn_0221D62C(CPUState* cpu) {
         /* 0221D6F8 */ cpu->r[6] = 0x00000001u;
         /* 0221D6FC */ cpu->r[8] = 0x00000000u;
         /* 0221D700 */ cpu->r[5] = cpu->r[11];
-        /* 0221D700 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0221D700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0221D704 */ cpu->r[7] = cpu->r[6];
-        /* 0221D708 */ _t40 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221D708 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221D708 */ _t41 = _t40 & 0x00000001u;
         /* 0221D708 */ if (_t41) goto L_0221D70C; else goto L_0221D84C;
   L_0221D70C: ; // 0x221d70c
@@ -12446,21 +12446,21 @@ void Gambit_fn_0221D62C(CPUState* cpu) {
   L_0221D714: ; // 0x221d714
         /* 0221D714 */ _t42 = cpu->r[9] + 0x00000000u;
         /* 0221D714 */ cpu->r[0] = rbrew_read8(cpu->mem, _t42);
-        /* 0221D718 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0221D71C */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D718 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0221D71C */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D71C */ _t44 = _t43 & 0x00000001u;
         /* 0221D71C */ if (_t44) goto L_0221D740; else goto L_0221D720;
   L_0221D720: ; // 0x221d720
         /* 0221D720 */ cpu->r[5] = cpu->r[5] + 0xFFFFFFFFu;
-        /* 0221D720 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0221D720 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0221D724 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
         /* 0221D728 */ cpu->r[7] = 0x00000000u;
-        /* 0221D72C */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D72C */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D72C */ _t46 = _t45 & 0x00000001u;
         /* 0221D72C */ if (_t46) goto L_0221D750; else goto L_0221D730;
   L_0221D730: ; // 0x221d730
-        /* 0221D730 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000005u);
-        /* 0221D734 */ _t47 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221D730 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000005u));
+        /* 0221D734 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221D734 */ _t48 = _t47 & 0x00000001u;
         /* 0221D734 */ if (_t48) goto L_0221D710; else goto L_0221D738;
   L_0221D738: ; // 0x221d738
@@ -12468,30 +12468,30 @@ void Gambit_fn_0221D62C(CPUState* cpu) {
         /* 0221D73C */ goto L_0221D714;
   L_0221D740: ; // 0x221d740
         /* 0221D740 */ cpu->r[5] = cpu->r[5] + 0xFFFFFFFFu;
-        /* 0221D740 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0221D740 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0221D744 */ cpu->r[8] = cpu->r[8] + 0x00000001u;
         /* 0221D748 */ cpu->r[6] = 0x00000000u;
-        /* 0221D74C */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D74C */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D74C */ _t50 = _t49 & 0x00000001u;
         /* 0221D74C */ if (_t50) goto L_0221D750; else goto L_0221D730;
   L_0221D750: ; // 0x221d750
-        /* 0221D750 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0221D754 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D750 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0221D754 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D754 */ _t52 = _t51 & 0x00000001u;
         /* 0221D754 */ if (_t52) goto L_0221D758; else goto L_0221D84C;
   L_0221D758: ; // 0x221d758
-        /* 0221D758 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0221D75C */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D758 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0221D75C */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D75C */ _t54 = _t53 & 0x00000001u;
         /* 0221D75C */ if (_t54) goto L_0221D760; else goto L_0221D7F8;
   L_0221D760: ; // 0x221d760
         /* 0221D760 */ cpu->r[26] = 0x00000000u;
         /* 0221D764 */ cpu->r[28] = cpu->r[26];
         /* 0221D768 */ cpu->r[12] = 0x10050000u;
-        /* 0221D76C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], cpu->r[11]);
+        /* 0221D76C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], cpu->r[11]));
         /* 0221D770 */ _t55 = cpu->r[12] + 0xFFFFC044u;
         /* 0221D770 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t55);
-        /* 0221D774 */ _t56 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221D774 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221D774 */ _t57 = _t56 & 0x00000001u;
         /* 0221D774 */ if (_t57) goto L_0221D778; else goto L_0221D7E0;
   L_0221D778: ; // 0x221d778
@@ -12499,18 +12499,18 @@ void Gambit_fn_0221D62C(CPUState* cpu) {
         /* 0221D77C */ cpu->r[25] = cpu->r[29] + 0x00000160u;
         /* 0221D780 */ cpu->r[24] = 0x00000000u;
   L_0221D784: ; // 0x221d784
-        /* 0221D784 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], 0x00000005u);
-        /* 0221D788 */ _t58 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221D784 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], 0x00000005u));
+        /* 0221D788 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221D788 */ _t59 = _t58 & 0x00000001u;
         /* 0221D788 */ if (_t59) goto L_0221D78C; else goto L_0221D7A8;
   L_0221D78C: ; // 0x221d78c
         /* 0221D78C */ cpu->r[3] = cpu->r[27];
         /* 0221D790 */ cpu->r[4] = cpu->r[25] + cpu->r[24];
         /* 0221D794 */ Gambit_fn_02C69328(cpu);
-        /* 0221D798 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[29]);
+        /* 0221D798 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[29]));
         /* 0221D79C */ _t60 = cpu->r[29] + 0x00000122u;
         /* 0221D79C */ cpu->r[9] = rbrew_read8(cpu->mem, _t60);
-        /* 0221D7A0 */ _t61 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221D7A0 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221D7A0 */ _t62 = _t61 & 0x00000001u;
         /* 0221D7A0 */ if (_t62) goto L_0221D7A4; else goto L_0221D7C0;
   L_0221D7A4: ; // 0x221d7a4
@@ -12519,15 +12519,15 @@ void Gambit_fn_0221D62C(CPUState* cpu) {
         /* 0221D7A8 */ cpu->r[3] = cpu->r[27];
         /* 0221D7AC */ cpu->r[4] = cpu->r[25];
         /* 0221D7B0 */ Gambit_fn_02C69328(cpu);
-        /* 0221D7B4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[29]);
+        /* 0221D7B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[29]));
         /* 0221D7B8 */ _t63 = cpu->r[29] + 0x00000122u;
         /* 0221D7B8 */ cpu->r[9] = rbrew_read8(cpu->mem, _t63);
-        /* 0221D7BC */ _t64 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221D7BC */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221D7BC */ _t65 = _t64 & 0x00000001u;
         /* 0221D7BC */ if (_t65) goto L_0221D7C8; else goto L_0221D7C0;
   L_0221D7C0: ; // 0x221d7c0
-        /* 0221D7C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
-        /* 0221D7C4 */ _t66 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221D7C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
+        /* 0221D7C4 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221D7C4 */ _t67 = _t66 & 0x00000001u;
         /* 0221D7C4 */ if (_t67) goto L_0221D7C8; else goto L_0221D7D0;
   L_0221D7C8: ; // 0x221d7c8
@@ -12535,14 +12535,14 @@ void Gambit_fn_0221D62C(CPUState* cpu) {
         /* 0221D7CC */ cpu->r[26] = cpu->r[28];
   L_0221D7D0: ; // 0x221d7d0
         /* 0221D7D0 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
-        /* 0221D7D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], cpu->r[9]);
+        /* 0221D7D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], cpu->r[9]));
         /* 0221D7D8 */ cpu->r[24] = cpu->r[24] + 0x0000000Cu;
-        /* 0221D7DC */ _t68 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221D7DC */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221D7DC */ _t69 = _t68 & 0x00000001u;
         /* 0221D7DC */ if (_t69) goto L_0221D784; else goto L_0221D7E0;
   L_0221D7E0: ; // 0x221d7e0
-        /* 0221D7E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], 0x00000005u);
-        /* 0221D7E4 */ _t70 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221D7E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], 0x00000005u));
+        /* 0221D7E4 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221D7E4 */ _t71 = _t70 & 0x00000001u;
         /* 0221D7E4 */ if (_t71) goto L_0221D7E8; else goto L_0221D7EC;
   L_0221D7E8: ; // 0x221d7e8
@@ -12550,16 +12550,16 @@ void Gambit_fn_0221D62C(CPUState* cpu) {
   L_0221D7EC: ; // 0x221d7ec
         /* 0221D7EC */ _t72 = cpu->r[31] + 0x00000000u;
         /* 0221D7EC */ cpu->r[10] = rbrew_read8(cpu->mem, _t72);
-        /* 0221D7F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0221D7F4 */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D7F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0221D7F4 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D7F4 */ _t74 = _t73 & 0x00000001u;
         /* 0221D7F4 */ if (_t74) goto L_0221D84C; else goto L_0221D7F8;
   L_0221D7F8: ; // 0x221d7f8
         /* 0221D7F8 */ _t75 = cpu->r[29] + 0x0000020Cu;
         /* 0221D7F8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t75);
         /* 0221D7FC */ cpu->r[11] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000014u, 0x00000015u);
-        /* 0221D7FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0221D800 */ _t76 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D7FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0221D800 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D800 */ _t77 = _t76 & 0x00000001u;
         /* 0221D800 */ if (_t77) goto L_0221D804; else goto L_0221D84C;
   L_0221D804: ; // 0x221d804
@@ -12568,13 +12568,13 @@ void Gambit_fn_0221D62C(CPUState* cpu) {
         /* 0221D80C */ cpu->r[31] = cpu->r[3];
         /* 0221D810 */ cpu->r[3] = cpu->r[30];
         /* 0221D814 */ Gambit_fn_021BCFBC(cpu);
-        /* 0221D818 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221D81C */ _t78 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D818 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221D81C */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D81C */ _t79 = _t78 & 0x00000001u;
         /* 0221D81C */ if (_t79) goto L_0221D83C; else goto L_0221D820;
   L_0221D820: ; // 0x221d820
-        /* 0221D820 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x0000000Cu);
-        /* 0221D824 */ _t80 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D820 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x0000000Cu));
+        /* 0221D824 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D824 */ _t81 = _t80 & 0x00000001u;
         /* 0221D824 */ if (_t81) goto L_0221D828; else goto L_0221D83C;
   L_0221D828: ; // 0x221d828
@@ -12607,7 +12607,7 @@ void Gambit_fn_0221D62C(CPUState* cpu) {
         /* 0221D864 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t90);
         /* 0221D868 */ _t91 = cpu->r[1] + 0x00000048u;
         /* 0221D868 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t91);
-        /* 0221D86C */ _t92 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221D86C */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221D86C */ _t93 = _t92 & 0x00000001u;
         /* 0221D86C */ if (_t93) goto L_0221D870; // else: addr-0 trap, fall-through
   L_0221D870: ; // 0x221d870
@@ -12722,9 +12722,9 @@ void Gambit_fn_0221D8D8(CPUState* cpu) {
         /* 0221D8F0 */ _t4 = cpu->r[31] + 0x00000120u;
         /* 0221D8F0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t4);
         /* 0221D8F4 */ cpu->r[8] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 0221D8F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0221D8F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0221D8F8 */ cpu->r[30] = cpu->r[4];
-        /* 0221D8FC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D8FC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D8FC */ _t6 = _t5 & 0x00000001u;
         /* 0221D8FC */ if (_t6) goto L_0221D900; else goto L_0221D9D4;
   L_0221D900: ; // 0x221d900
@@ -12735,18 +12735,18 @@ void Gambit_fn_0221D8D8(CPUState* cpu) {
         /* 0221D90C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t7);
         /* 0221D910 */ _t8 = cpu->r[8] + 0xFFFFC080u;
         /* 0221D910 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t8);
-        /* 0221D914 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[13]);
+        /* 0221D914 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[13]));
         /* 0221D918 */ _t9 = cpu->r[31] + 0x00000064u;
         /* 0221D918 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t9);
-        /* 0221D91C */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221D91C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221D91C */ _t11 = _t10 & 0x00000001u;
         /* 0221D91C */ if (_t11) goto L_0221D954; else goto L_0221D920;
   L_0221D920: ; // 0x221d920
         /* 0221D920 */ cpu->r[11] = 0x10050000u;
         /* 0221D924 */ _t12 = cpu->r[11] + 0xFFFFC084u;
         /* 0221D924 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t12);
-        /* 0221D928 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[10]);
-        /* 0221D92C */ _t13 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221D928 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[10]));
+        /* 0221D92C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221D92C */ _t14 = _t13 & 0x00000001u;
         /* 0221D92C */ if (_t14) goto L_0221D954; else goto L_0221D930;
   L_0221D930: ; // 0x221d930
@@ -12759,7 +12759,7 @@ void Gambit_fn_0221D8D8(CPUState* cpu) {
         /* 0221D93C */ _t18 = cpu->r[30] + 0x00000000u;
         /* 0221D93C */ rbrew_write16(cpu->mem, _t18, (uint16_t)cpu->r[0]);
         /* 0221D940 */ cpu->r[0] = cpu->r[12] & 0x0000FEFFu;
-        /* 0221D940 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221D940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221D944 */ cpu->r[6] = 0x00000000u;
         /* 0221D948 */ _t19 = cpu->r[30] + 0x00000002u;
         /* 0221D948 */ rbrew_write16(cpu->mem, _t19, (uint16_t)cpu->r[0]);
@@ -12789,16 +12789,16 @@ void Gambit_fn_0221D8D8(CPUState* cpu) {
         /* 0221D988 */ cpu->f[0] = rbrew_read_f64(cpu->mem, _t26);
         /* 0221D98C */ cpu->f[9] = cpu->f[0] - cpu->f[12];
         /* 0221D990 */ cpu->f[10] = (double)(float)cpu->f[9];
-        /* 0221D994 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[11]);
-        /* 0221D998 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D994 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[11]));
+        /* 0221D998 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D998 */ _t28 = _t27 & 0x00000001u;
         /* 0221D998 */ if (_t28) goto L_0221D9B0; else goto L_0221D99C;
   L_0221D99C: ; // 0x221d99c
         /* 0221D99C */ cpu->r[10] = 0x10050000u;
         /* 0221D9A0 */ _t29 = cpu->r[10] + 0xFFFFBE2Cu;
         /* 0221D9A0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t29);
-        /* 0221D9A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[13]);
-        /* 0221D9A8 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221D9A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[13]));
+        /* 0221D9A8 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221D9A8 */ _t31 = _t30 & 0x00000001u;
         /* 0221D9A8 */ if (_t31) goto L_0221D9B0; else goto L_0221D9AC;
   L_0221D9AC: ; // 0x221d9ac
@@ -12813,7 +12813,7 @@ void Gambit_fn_0221D8D8(CPUState* cpu) {
         /* 0221D9BC */ _t35 = cpu->r[30] + 0x00000000u;
         /* 0221D9BC */ rbrew_write16(cpu->mem, _t35, (uint16_t)cpu->r[0]);
         /* 0221D9C0 */ cpu->r[0] = cpu->r[12] & 0x0000FEFFu;
-        /* 0221D9C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221D9C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221D9C4 */ cpu->r[6] = cpu->r[11] + 0xFFFFFFFFu;
         /* 0221D9C8 */ _t36 = cpu->r[30] + 0x00000002u;
         /* 0221D9C8 */ rbrew_write16(cpu->mem, _t36, (uint16_t)cpu->r[0]);
@@ -12852,7 +12852,7 @@ void Gambit_fn_0221D8D8(CPUState* cpu) {
         /* 0221DA1C */ _t48 = cpu->r[30] + 0x00000000u;
         /* 0221DA1C */ rbrew_write16(cpu->mem, _t48, (uint16_t)cpu->r[0]);
         /* 0221DA20 */ cpu->r[0] = cpu->r[12] & 0x0000FEFFu;
-        /* 0221DA20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221DA20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221DA24 */ cpu->r[6] = 0x00000000u;
         /* 0221DA28 */ _t49 = cpu->r[30] + 0x00000002u;
         /* 0221DA28 */ rbrew_write16(cpu->mem, _t49, (uint16_t)cpu->r[0]);
@@ -12888,9 +12888,9 @@ void Gambit_fn_0221D8DC(CPUState* cpu) {
         /* 0221D8F0 */ _t4 = cpu->r[31] + 0x00000120u;
         /* 0221D8F0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t4);
         /* 0221D8F4 */ cpu->r[8] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 0221D8F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0221D8F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0221D8F8 */ cpu->r[30] = cpu->r[4];
-        /* 0221D8FC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D8FC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D8FC */ _t6 = _t5 & 0x00000001u;
         /* 0221D8FC */ if (_t6) goto L_0221D900; else goto L_0221D9D4;
   L_0221D900: ; // 0x221d900
@@ -12901,18 +12901,18 @@ void Gambit_fn_0221D8DC(CPUState* cpu) {
         /* 0221D90C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t7);
         /* 0221D910 */ _t8 = cpu->r[8] + 0xFFFFC080u;
         /* 0221D910 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t8);
-        /* 0221D914 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[13]);
+        /* 0221D914 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[13]));
         /* 0221D918 */ _t9 = cpu->r[31] + 0x00000064u;
         /* 0221D918 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t9);
-        /* 0221D91C */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221D91C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221D91C */ _t11 = _t10 & 0x00000001u;
         /* 0221D91C */ if (_t11) goto L_0221D954; else goto L_0221D920;
   L_0221D920: ; // 0x221d920
         /* 0221D920 */ cpu->r[11] = 0x10050000u;
         /* 0221D924 */ _t12 = cpu->r[11] + 0xFFFFC084u;
         /* 0221D924 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t12);
-        /* 0221D928 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[10]);
-        /* 0221D92C */ _t13 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221D928 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[10]));
+        /* 0221D92C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221D92C */ _t14 = _t13 & 0x00000001u;
         /* 0221D92C */ if (_t14) goto L_0221D954; else goto L_0221D930;
   L_0221D930: ; // 0x221d930
@@ -12925,7 +12925,7 @@ void Gambit_fn_0221D8DC(CPUState* cpu) {
         /* 0221D93C */ _t18 = cpu->r[30] + 0x00000000u;
         /* 0221D93C */ rbrew_write16(cpu->mem, _t18, (uint16_t)cpu->r[0]);
         /* 0221D940 */ cpu->r[0] = cpu->r[12] & 0x0000FEFFu;
-        /* 0221D940 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221D940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221D944 */ cpu->r[6] = 0x00000000u;
         /* 0221D948 */ _t19 = cpu->r[30] + 0x00000002u;
         /* 0221D948 */ rbrew_write16(cpu->mem, _t19, (uint16_t)cpu->r[0]);
@@ -12955,16 +12955,16 @@ void Gambit_fn_0221D8DC(CPUState* cpu) {
         /* 0221D988 */ cpu->f[0] = rbrew_read_f64(cpu->mem, _t26);
         /* 0221D98C */ cpu->f[9] = cpu->f[0] - cpu->f[12];
         /* 0221D990 */ cpu->f[10] = (double)(float)cpu->f[9];
-        /* 0221D994 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[11]);
-        /* 0221D998 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221D994 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[11]));
+        /* 0221D998 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221D998 */ _t28 = _t27 & 0x00000001u;
         /* 0221D998 */ if (_t28) goto L_0221D9B0; else goto L_0221D99C;
   L_0221D99C: ; // 0x221d99c
         /* 0221D99C */ cpu->r[10] = 0x10050000u;
         /* 0221D9A0 */ _t29 = cpu->r[10] + 0xFFFFBE2Cu;
         /* 0221D9A0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t29);
-        /* 0221D9A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[13]);
-        /* 0221D9A8 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221D9A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[13]));
+        /* 0221D9A8 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221D9A8 */ _t31 = _t30 & 0x00000001u;
         /* 0221D9A8 */ if (_t31) goto L_0221D9B0; else goto L_0221D9AC;
   L_0221D9AC: ; // 0x221d9ac
@@ -12979,7 +12979,7 @@ void Gambit_fn_0221D8DC(CPUState* cpu) {
         /* 0221D9BC */ _t35 = cpu->r[30] + 0x00000000u;
         /* 0221D9BC */ rbrew_write16(cpu->mem, _t35, (uint16_t)cpu->r[0]);
         /* 0221D9C0 */ cpu->r[0] = cpu->r[12] & 0x0000FEFFu;
-        /* 0221D9C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221D9C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221D9C4 */ cpu->r[6] = cpu->r[11] + 0xFFFFFFFFu;
         /* 0221D9C8 */ _t36 = cpu->r[30] + 0x00000002u;
         /* 0221D9C8 */ rbrew_write16(cpu->mem, _t36, (uint16_t)cpu->r[0]);
@@ -13018,7 +13018,7 @@ void Gambit_fn_0221D8DC(CPUState* cpu) {
         /* 0221DA1C */ _t48 = cpu->r[30] + 0x00000000u;
         /* 0221DA1C */ rbrew_write16(cpu->mem, _t48, (uint16_t)cpu->r[0]);
         /* 0221DA20 */ cpu->r[0] = cpu->r[12] & 0x0000FEFFu;
-        /* 0221DA20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221DA20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221DA24 */ cpu->r[6] = 0x00000000u;
         /* 0221DA28 */ _t49 = cpu->r[30] + 0x00000002u;
         /* 0221DA28 */ rbrew_write16(cpu->mem, _t49, (uint16_t)cpu->r[0]);
@@ -13062,26 +13062,26 @@ void Gambit_fn_0221DA48(CPUState* cpu) {
         /* 0221DA80 */ Gambit_fn_02019890(cpu);
         /* 0221DA84 */ _t3 = cpu->r[1] + 0x0000000Cu;
         /* 0221DA84 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0221DA88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000001u);
-        /* 0221DA8C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221DA88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000001u));
+        /* 0221DA8C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221DA8C */ _t5 = _t4 & 0x00000001u;
         /* 0221DA8C */ if (_t5) goto L_0221DA90; else goto L_0221DAD0;
   L_0221DA90: ; // 0x221da90
-        /* 0221DA90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000002u);
-        /* 0221DA94 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221DA90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000002u));
+        /* 0221DA94 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221DA94 */ _t7 = _t6 & 0x00000001u;
         /* 0221DA94 */ if (_t7) goto L_0221DAD0; else goto L_0221DA98;
   L_0221DA98: ; // 0x221da98
         /* 0221DA98 */ _t8 = cpu->r[23] + 0x0000020Cu;
         /* 0221DA98 */ cpu->r[12] = rbrew_read32(cpu->mem, _t8);
         /* 0221DA9C */ cpu->r[12] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000014u, 0x00000015u);
-        /* 0221DA9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0221DAA0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221DA9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0221DAA0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221DAA0 */ _t10 = _t9 & 0x00000001u;
         /* 0221DAA0 */ if (_t10) goto L_0221DAD0; else goto L_0221DAA4;
   L_0221DAA4: ; // 0x221daa4
-        /* 0221DAA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 0221DAA8 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221DAA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 0221DAA8 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221DAA8 */ _t12 = _t11 & 0x00000001u;
         /* 0221DAA8 */ if (_t12) goto L_0221DAB8; else goto L_0221DAAC;
   L_0221DAAC: ; // 0x221daac
@@ -13149,9 +13149,9 @@ void Gambit_fn_0221DB14(CPUState* cpu) {
         /* 0221DB40 */ _t7 = cpu->r[31] + 0x00000122u;
         /* 0221DB40 */ cpu->r[6] = rbrew_read8(cpu->mem, _t7);
         /* 0221DB44 */ cpu->r[0] = cpu->r[6] + 0xFFFFFFFFu;
-        /* 0221DB48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
+        /* 0221DB48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
         /* 0221DB4C */ cpu->r[3] = cpu->r[31] + 0x00000124u;
-        /* 0221DB50 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221DB50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221DB50 */ _t9 = _t8 & 0x00000001u;
         /* 0221DB50 */ if (_t9) goto L_0221DB54; else goto L_0221DBAC;
   L_0221DB54: ; // 0x221db54
@@ -13180,10 +13180,10 @@ void Gambit_fn_0221DB14(CPUState* cpu) {
         /* 0221DB94 */ cpu->f[13] = cpu->f[11] * cpu->f[31];
         /* 0221DB98 */ _t16 = cpu->r[1] + 0x0000000Cu;
         /* 0221DB98 */ rbrew_write_f32(cpu->mem, _t16, cpu->f[0]);
-        /* 0221DB9C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
+        /* 0221DB9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
         /* 0221DBA0 */ _t17 = cpu->r[1] + 0x00000010u;
         /* 0221DBA0 */ rbrew_write_f32(cpu->mem, _t17, cpu->f[13]);
-        /* 0221DBA4 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221DBA4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221DBA4 */ _t19 = _t18 & 0x00000001u;
         /* 0221DBA4 */ if (_t19) goto L_0221DBF0; else goto L_0221DBA8;
   L_0221DBA8: ; // 0x221dba8
@@ -13209,10 +13209,10 @@ void Gambit_fn_0221DB14(CPUState* cpu) {
         /* 0221DBDC */ cpu->f[13] = cpu->f[11] * cpu->f[31];
         /* 0221DBE0 */ _t25 = cpu->r[1] + 0x0000000Cu;
         /* 0221DBE0 */ rbrew_write_f32(cpu->mem, _t25, cpu->f[0]);
-        /* 0221DBE4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
+        /* 0221DBE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
         /* 0221DBE8 */ _t26 = cpu->r[1] + 0x00000010u;
         /* 0221DBE8 */ rbrew_write_f32(cpu->mem, _t26, cpu->f[13]);
-        /* 0221DBEC */ _t27 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221DBEC */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221DBEC */ _t28 = _t27 & 0x00000001u;
         /* 0221DBEC */ if (_t28) goto L_0221DBF0; else goto L_0221DC38;
   L_0221DBF0: ; // 0x221dbf0
@@ -13234,13 +13234,13 @@ void Gambit_fn_0221DB14(CPUState* cpu) {
         /* 0221DC1C */ _t33 = cpu->r[1] + 0x00000040u;
         /* 0221DC1C */ rbrew_write32(cpu->mem, _t33, cpu->r[11]);
         /* 0221DC20 */ cpu->r[12] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 0221DC20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0221DC20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0221DC24 */ _t34 = cpu->r[1] + 0x0000003Cu;
         /* 0221DC24 */ rbrew_write32(cpu->mem, _t34, cpu->r[10]);
         /* 0221DC28 */ cpu->f[30] = cpu->f[30] + cpu->f[10];
         /* 0221DC2C */ _t35 = cpu->r[1] + 0x00000038u;
         /* 0221DC2C */ rbrew_write32(cpu->mem, _t35, cpu->r[8]);
-        /* 0221DC30 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221DC30 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221DC30 */ _t37 = _t36 & 0x00000001u;
         /* 0221DC30 */ if (_t37) goto L_0221DC84; else goto L_0221DC34;
   L_0221DC34: ; // 0x221dc34
@@ -13263,21 +13263,21 @@ void Gambit_fn_0221DB14(CPUState* cpu) {
         /* 0221DC60 */ _t42 = cpu->r[1] + 0x00000040u;
         /* 0221DC60 */ rbrew_write32(cpu->mem, _t42, cpu->r[11]);
         /* 0221DC64 */ cpu->r[12] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 0221DC64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0221DC64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0221DC68 */ _t43 = cpu->r[1] + 0x0000003Cu;
         /* 0221DC68 */ rbrew_write32(cpu->mem, _t43, cpu->r[10]);
         /* 0221DC6C */ cpu->f[30] = cpu->f[30] + cpu->f[10];
         /* 0221DC70 */ _t44 = cpu->r[1] + 0x00000038u;
         /* 0221DC70 */ rbrew_write32(cpu->mem, _t44, cpu->r[8]);
-        /* 0221DC74 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221DC74 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221DC74 */ _t46 = _t45 & 0x00000001u;
         /* 0221DC74 */ if (_t46) goto L_0221DC84; else goto L_0221DC78;
   L_0221DC78: ; // 0x221dc78
         /* 0221DC78 */ _t47 = cpu->r[31] + 0x0000020Cu;
         /* 0221DC78 */ cpu->r[0] = rbrew_read32(cpu->mem, _t47);
         /* 0221DC7C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000014u, 0x00000015u);
-        /* 0221DC7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0221DC80 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221DC7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0221DC80 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221DC80 */ _t49 = _t48 & 0x00000001u;
         /* 0221DC80 */ if (_t49) goto L_0221DCD4; else goto L_0221DC84;
   L_0221DC84: ; // 0x221dc84
@@ -13396,7 +13396,7 @@ void Gambit_fn_0221DB14(CPUState* cpu) {
         /* 0221DDA0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t88);
         /* 0221DDA4 */ _t89 = cpu->r[1] + 0x00000058u;
         /* 0221DDA4 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t89);
-        /* 0221DDA8 */ _t90 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221DDA8 */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221DDA8 */ _t91 = _t90 & 0x00000001u;
         /* 0221DDA8 */ if (_t91) goto L_0221DDAC; // else: addr-0 trap, fall-through
   L_0221DDAC: ; // 0x221ddac
@@ -13433,9 +13433,9 @@ void Gambit_fn_0221DB18(CPUState* cpu) {
         /* 0221DB40 */ _t7 = cpu->r[31] + 0x00000122u;
         /* 0221DB40 */ cpu->r[6] = rbrew_read8(cpu->mem, _t7);
         /* 0221DB44 */ cpu->r[0] = cpu->r[6] + 0xFFFFFFFFu;
-        /* 0221DB48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
+        /* 0221DB48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
         /* 0221DB4C */ cpu->r[3] = cpu->r[31] + 0x00000124u;
-        /* 0221DB50 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221DB50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221DB50 */ _t9 = _t8 & 0x00000001u;
         /* 0221DB50 */ if (_t9) goto L_0221DB54; else goto L_0221DBAC;
   L_0221DB54: ; // 0x221db54
@@ -13464,10 +13464,10 @@ void Gambit_fn_0221DB18(CPUState* cpu) {
         /* 0221DB94 */ cpu->f[13] = cpu->f[11] * cpu->f[31];
         /* 0221DB98 */ _t16 = cpu->r[1] + 0x0000000Cu;
         /* 0221DB98 */ rbrew_write_f32(cpu->mem, _t16, cpu->f[0]);
-        /* 0221DB9C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
+        /* 0221DB9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
         /* 0221DBA0 */ _t17 = cpu->r[1] + 0x00000010u;
         /* 0221DBA0 */ rbrew_write_f32(cpu->mem, _t17, cpu->f[13]);
-        /* 0221DBA4 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221DBA4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221DBA4 */ _t19 = _t18 & 0x00000001u;
         /* 0221DBA4 */ if (_t19) goto L_0221DBF0; else goto L_0221DBA8;
   L_0221DBA8: ; // 0x221dba8
@@ -13493,10 +13493,10 @@ void Gambit_fn_0221DB18(CPUState* cpu) {
         /* 0221DBDC */ cpu->f[13] = cpu->f[11] * cpu->f[31];
         /* 0221DBE0 */ _t25 = cpu->r[1] + 0x0000000Cu;
         /* 0221DBE0 */ rbrew_write_f32(cpu->mem, _t25, cpu->f[0]);
-        /* 0221DBE4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000005u);
+        /* 0221DBE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000005u));
         /* 0221DBE8 */ _t26 = cpu->r[1] + 0x00000010u;
         /* 0221DBE8 */ rbrew_write_f32(cpu->mem, _t26, cpu->f[13]);
-        /* 0221DBEC */ _t27 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221DBEC */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221DBEC */ _t28 = _t27 & 0x00000001u;
         /* 0221DBEC */ if (_t28) goto L_0221DBF0; else goto L_0221DC38;
   L_0221DBF0: ; // 0x221dbf0
@@ -13518,13 +13518,13 @@ void Gambit_fn_0221DB18(CPUState* cpu) {
         /* 0221DC1C */ _t33 = cpu->r[1] + 0x00000040u;
         /* 0221DC1C */ rbrew_write32(cpu->mem, _t33, cpu->r[11]);
         /* 0221DC20 */ cpu->r[12] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 0221DC20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0221DC20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0221DC24 */ _t34 = cpu->r[1] + 0x0000003Cu;
         /* 0221DC24 */ rbrew_write32(cpu->mem, _t34, cpu->r[10]);
         /* 0221DC28 */ cpu->f[30] = cpu->f[30] + cpu->f[10];
         /* 0221DC2C */ _t35 = cpu->r[1] + 0x00000038u;
         /* 0221DC2C */ rbrew_write32(cpu->mem, _t35, cpu->r[8]);
-        /* 0221DC30 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221DC30 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221DC30 */ _t37 = _t36 & 0x00000001u;
         /* 0221DC30 */ if (_t37) goto L_0221DC84; else goto L_0221DC34;
   L_0221DC34: ; // 0x221dc34
@@ -13547,21 +13547,21 @@ void Gambit_fn_0221DB18(CPUState* cpu) {
         /* 0221DC60 */ _t42 = cpu->r[1] + 0x00000040u;
         /* 0221DC60 */ rbrew_write32(cpu->mem, _t42, cpu->r[11]);
         /* 0221DC64 */ cpu->r[12] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 0221DC64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0221DC64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0221DC68 */ _t43 = cpu->r[1] + 0x0000003Cu;
         /* 0221DC68 */ rbrew_write32(cpu->mem, _t43, cpu->r[10]);
         /* 0221DC6C */ cpu->f[30] = cpu->f[30] + cpu->f[10];
         /* 0221DC70 */ _t44 = cpu->r[1] + 0x00000038u;
         /* 0221DC70 */ rbrew_write32(cpu->mem, _t44, cpu->r[8]);
-        /* 0221DC74 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221DC74 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221DC74 */ _t46 = _t45 & 0x00000001u;
         /* 0221DC74 */ if (_t46) goto L_0221DC84; else goto L_0221DC78;
   L_0221DC78: ; // 0x221dc78
         /* 0221DC78 */ _t47 = cpu->r[31] + 0x0000020Cu;
         /* 0221DC78 */ cpu->r[0] = rbrew_read32(cpu->mem, _t47);
         /* 0221DC7C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000014u, 0x00000015u);
-        /* 0221DC7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0221DC80 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221DC7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0221DC80 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221DC80 */ _t49 = _t48 & 0x00000001u;
         /* 0221DC80 */ if (_t49) goto L_0221DCD4; else goto L_0221DC84;
   L_0221DC84: ; // 0x221dc84
@@ -13680,7 +13680,7 @@ void Gambit_fn_0221DB18(CPUState* cpu) {
         /* 0221DDA0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t88);
         /* 0221DDA4 */ _t89 = cpu->r[1] + 0x00000058u;
         /* 0221DDA4 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t89);
-        /* 0221DDA8 */ _t90 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221DDA8 */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221DDA8 */ _t91 = _t90 & 0x00000001u;
         /* 0221DDA8 */ if (_t91) goto L_0221DDAC; // else: addr-0 trap, fall-through
   L_0221DDAC: ; // 0x221ddac
@@ -13709,9 +13709,9 @@ void Gambit_fn_0221DDBC(CPUState* cpu) {
         /* 02031BE4 */ _t4 = cpu->r[4] + 0x00000000u;
         /* 02031BE4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t4);
         /* 02031BE8 */ cpu->r[31] = cpu->r[4];
-        /* 02031BEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02031BEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02031BF0 */ cpu->r[30] = cpu->r[3];
-        /* 02031BF4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02031BF4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02031BF4 */ _t6 = _t5 & 0x00000001u;
         /* 02031BF4 */ if (_t6) goto L_02031C58; else goto L_02031BF8;
   L_02031BF8: ; // 0x2031bf8
@@ -13719,8 +13719,8 @@ void Gambit_fn_0221DDBC(CPUState* cpu) {
         /* 02031BF8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
         /* 02031BFC */ _t8 = cpu->r[3] + 0x0000011Cu;
         /* 02031BFC */ cpu->r[11] = rbrew_read8(cpu->mem, _t8);
-        /* 02031C00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02031C04 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02031C00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02031C04 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02031C04 */ _t10 = _t9 & 0x00000001u;
         /* 02031C04 */ if (_t10) goto L_02031C58; else goto L_02031C08;
   L_02031C08: ; // 0x2031c08
@@ -14023,17 +14023,17 @@ void Gambit_fn_0221DDCC(CPUState* cpu) {
         /* 0221DFE0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t100);
         /* 0221DFE4 */ _t101 = cpu->r[11] + 0xFFFFC034u;
         /* 0221DFE4 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t101);
-        /* 0221DFE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u);
+        /* 0221DFE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u));
         /* 0221DFEC */ _t102 = cpu->r[31] + 0x000000ACu;
         /* 0221DFEC */ rbrew_write32(cpu->mem, _t102, cpu->r[10]);
-        /* 0221DFF0 */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221DFF0 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221DFF0 */ _t104 = _t103 & 0x00000001u;
         /* 0221DFF0 */ if (_t104) goto L_0221DFF4; else goto L_0221E004;
   L_0221DFF4: ; // 0x221dff4
         /* 0221DFF4 */ cpu->r[3] = 0x00000010u;
         /* 0221DFF8 */ Gambit_fn_02801A78(cpu);
-        /* 0221DFFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221E000 */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221DFFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221E000 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E000 */ _t106 = _t105 & 0x00000001u;
         /* 0221E000 */ if (_t106) goto L_0221E014; else goto L_0221E004;
   L_0221E004: ; // 0x221e004
@@ -14046,16 +14046,16 @@ void Gambit_fn_0221DDCC(CPUState* cpu) {
         /* 0221E010 */ _t110 = cpu->r[3] + 0x0000000Cu;
         /* 0221E010 */ rbrew_write_f32(cpu->mem, _t110, cpu->f[30]);
   L_0221E014: ; // 0x221e014
-        /* 0221E014 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u);
+        /* 0221E014 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u));
         /* 0221E018 */ cpu->r[3] = cpu->r[31] + 0x000000D0u;
-        /* 0221E01C */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E01C */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E01C */ _t112 = _t111 & 0x00000001u;
         /* 0221E01C */ if (_t112) goto L_0221E020; else goto L_0221E030;
   L_0221E020: ; // 0x221e020
         /* 0221E020 */ cpu->r[3] = 0x00000010u;
         /* 0221E024 */ Gambit_fn_02801A78(cpu);
-        /* 0221E028 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221E02C */ _t113 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E028 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221E02C */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E02C */ _t114 = _t113 & 0x00000001u;
         /* 0221E02C */ if (_t114) goto L_0221E040; else goto L_0221E030;
   L_0221E030: ; // 0x221e030
@@ -14103,7 +14103,7 @@ void Gambit_fn_0221DDCC(CPUState* cpu) {
         /* 0221E084 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t133);
         /* 0221E088 */ _t134 = cpu->r[1] + 0x00000058u;
         /* 0221E088 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t134);
-        /* 0221E08C */ _t135 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221E08C */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221E08C */ _t136 = _t135 & 0x00000001u;
         /* 0221E08C */ if (_t136) goto L_0221E090; // else: addr-0 trap, fall-through
   L_0221E090: ; // 0x221e090
@@ -14119,15 +14119,15 @@ void Gambit_fn_0221E0A0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0221E0A0: ; // 0x221e0a0
-        /* 0221E0A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221E0A4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E0A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221E0A4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E0A4 */ _t1 = _t0 & 0x00000001u;
         /* 0221E0A4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0221E0A4 */ goto L_0221E0A8;
   L_0221E0A8: ; // 0x221e0a8
         /* 0221E0A8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0221E0A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0221E0AC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E0A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0221E0AC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E0AC */ _t3 = _t2 & 0x00000001u;
         /* 0221E0AC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0221E0AC */ goto L_0221E0B0;
@@ -14146,8 +14146,8 @@ void Gambit_fn_0221E0A0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -14161,15 +14161,15 @@ void Gambit_fn_0221E0A0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -14228,20 +14228,20 @@ void Gambit_fn_0221E0C8(CPUState* cpu) {
         /* 0221E0E0 */ _t3 = cpu->r[1] + 0x00000008u;
         /* 0221E0E0 */ rbrew_write_f64(cpu->mem, _t3, cpu->f[30]);
         /* 0221E0E4 */ /* nop */
-        /* 0221E0E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0221E0E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0221E0EC */ _t4 = cpu->r[1] + 0x00000010u;
         /* 0221E0EC */ rbrew_write_f32(cpu->mem, _t4, cpu->f[30]);
         /* 0221E0F0 */ cpu->f[30] = cpu->f[1];
         /* 0221E0F4 */ _t5 = cpu->r[1] + 0x0000002Cu;
         /* 0221E0F4 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
-        /* 0221E0F8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E0F8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E0F8 */ _t7 = _t6 & 0x00000001u;
         /* 0221E0F8 */ if (_t7) goto L_0221E0FC; else goto L_0221E10C;
   L_0221E0FC: ; // 0x221e0fc
         /* 0221E0FC */ cpu->r[3] = 0x00000008u;
         /* 0221E100 */ Gambit_fn_02801A78(cpu);
-        /* 0221E104 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221E108 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E104 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221E108 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E108 */ _t9 = _t8 & 0x00000001u;
         /* 0221E108 */ if (_t9) goto L_0221E114; else goto L_0221E10C;
   L_0221E10C: ; // 0x221e10c
@@ -14258,7 +14258,7 @@ void Gambit_fn_0221E0C8(CPUState* cpu) {
         /* 0221E11C */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t14);
         /* 0221E120 */ _t15 = cpu->r[1] + 0x00000018u;
         /* 0221E120 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t15);
-        /* 0221E124 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221E124 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221E124 */ _t17 = _t16 & 0x00000001u;
         /* 0221E124 */ if (_t17) goto L_0221E128; // else: addr-0 trap, fall-through
   L_0221E128: ; // 0x221e128
@@ -14286,20 +14286,20 @@ void Gambit_fn_0221E0CC(CPUState* cpu) {
         /* 0221E0E0 */ _t3 = cpu->r[1] + 0x00000008u;
         /* 0221E0E0 */ rbrew_write_f64(cpu->mem, _t3, cpu->f[30]);
         /* 0221E0E4 */ /* nop */
-        /* 0221E0E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0221E0E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0221E0EC */ _t4 = cpu->r[1] + 0x00000010u;
         /* 0221E0EC */ rbrew_write_f32(cpu->mem, _t4, cpu->f[30]);
         /* 0221E0F0 */ cpu->f[30] = cpu->f[1];
         /* 0221E0F4 */ _t5 = cpu->r[1] + 0x0000002Cu;
         /* 0221E0F4 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
-        /* 0221E0F8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E0F8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E0F8 */ _t7 = _t6 & 0x00000001u;
         /* 0221E0F8 */ if (_t7) goto L_0221E0FC; else goto L_0221E10C;
   L_0221E0FC: ; // 0x221e0fc
         /* 0221E0FC */ cpu->r[3] = 0x00000008u;
         /* 0221E100 */ Gambit_fn_02801A78(cpu);
-        /* 0221E104 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221E108 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E104 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221E108 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E108 */ _t9 = _t8 & 0x00000001u;
         /* 0221E108 */ if (_t9) goto L_0221E114; else goto L_0221E10C;
   L_0221E10C: ; // 0x221e10c
@@ -14316,7 +14316,7 @@ void Gambit_fn_0221E0CC(CPUState* cpu) {
         /* 0221E11C */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t14);
         /* 0221E120 */ _t15 = cpu->r[1] + 0x00000018u;
         /* 0221E120 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t15);
-        /* 0221E124 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221E124 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221E124 */ _t17 = _t16 & 0x00000001u;
         /* 0221E124 */ if (_t17) goto L_0221E128; // else: addr-0 trap, fall-through
   L_0221E128: ; // 0x221e128
@@ -14335,11 +14335,11 @@ void Gambit_fn_0221E138(CPUState* cpu) {
         /* 0221E138 */ cpu->r[0] = cpu->lr;
         /* 0221E13C */ _t0 = cpu->r[1] + 0x00000004u;
         /* 0221E13C */ rbrew_write32(cpu->mem, _t0, cpu->r[0]);
-        /* 0221E140 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0221E140 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0221E144 */ _t1 = cpu->r[1] + 0xFFFFFFF8u;
         /* 0221E144 */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0221E144 */ cpu->r[1] = _t1;
-        /* 0221E148 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E148 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E148 */ _t3 = _t2 & 0x00000001u;
         /* 0221E148 */ if (_t3) goto L_0221E14C; else goto L_0221E154;
   L_0221E14C: ; // 0x221e14c
@@ -14361,7 +14361,7 @@ void Gambit_fn_0221E144(CPUState* cpu) {
         /* 0221E144 */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 0221E144 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 0221E144 */ cpu->r[1] = _t0;
-        /* 0221E148 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E148 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E148 */ _t2 = _t1 & 0x00000001u;
         /* 0221E148 */ if (_t2) goto L_0221E14C; else goto L_0221E154;
   L_0221E14C: ; // 0x221e14c
@@ -14589,11 +14589,11 @@ void Gambit_fn_0221E288(CPUState* cpu) {
         /* 0221E288 */ cpu->r[0] = cpu->lr;
         /* 0221E28C */ _t0 = cpu->r[1] + 0x00000004u;
         /* 0221E28C */ rbrew_write32(cpu->mem, _t0, cpu->r[0]);
-        /* 0221E290 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0221E290 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0221E294 */ _t1 = cpu->r[1] + 0xFFFFFFF8u;
         /* 0221E294 */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0221E294 */ cpu->r[1] = _t1;
-        /* 0221E298 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E298 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E298 */ _t3 = _t2 & 0x00000001u;
         /* 0221E298 */ if (_t3) goto L_0221E29C; else goto L_0221E2A4;
   L_0221E29C: ; // 0x221e29c
@@ -14615,7 +14615,7 @@ void Gambit_fn_0221E294(CPUState* cpu) {
         /* 0221E294 */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 0221E294 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 0221E294 */ cpu->r[1] = _t0;
-        /* 0221E298 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E298 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E298 */ _t2 = _t1 & 0x00000001u;
         /* 0221E298 */ if (_t2) goto L_0221E29C; else goto L_0221E2A4;
   L_0221E29C: ; // 0x221e29c
@@ -14757,8 +14757,8 @@ void Gambit_fn_0221E2E8(CPUState* cpu) {
         /* 0221E2E8 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0221E2E8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0221E2EC */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 0221E2EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0221E2F0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E2EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0221E2F0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E2F0 */ _t2 = _t1 & 0x00000001u;
         /* 0221E2F0 */ _t3 = _t2 ^ 0x00000001u;
         /* 0221E2F0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -14780,8 +14780,8 @@ void Gambit_fn_0221E304(CPUState* cpu) {
         /* 0221E304 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0221E304 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0221E308 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 0221E308 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0221E30C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E308 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0221E30C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E30C */ _t2 = _t1 & 0x00000001u;
         /* 0221E30C */ _t3 = _t2 ^ 0x00000001u;
         /* 0221E30C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -14803,8 +14803,8 @@ void Gambit_fn_0221E320(CPUState* cpu) {
         /* 0221E320 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0221E320 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0221E324 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 0221E324 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0221E328 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E324 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0221E328 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E328 */ _t2 = _t1 & 0x00000001u;
         /* 0221E328 */ _t3 = _t2 ^ 0x00000001u;
         /* 0221E328 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -14847,8 +14847,8 @@ void Gambit_fn_0221E34C(CPUState* cpu) {
         /* 0221E35C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0221E360 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0221E360 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0221E364 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0221E368 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E364 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0221E368 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E368 */ _t5 = _t4 & 0x00000001u;
         /* 0221E368 */ if (_t5) goto L_0221E36C; else goto L_0221E388;
   L_0221E36C: ; // 0x221e36c
@@ -14887,8 +14887,8 @@ void Gambit_fn_0221E350(CPUState* cpu) {
         /* 0221E35C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0221E360 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0221E360 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0221E364 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0221E368 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E364 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0221E368 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E368 */ _t5 = _t4 & 0x00000001u;
         /* 0221E368 */ if (_t5) goto L_0221E36C; else goto L_0221E388;
   L_0221E36C: ; // 0x221e36c
@@ -14925,17 +14925,17 @@ void Gambit_fn_0221E39C(CPUState* cpu) {
         /* 0221E3A4 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0221E3A8 */ cpu->r[31] = cpu->r[3];
         /* 0221E3AC */ cpu->r[3] = cpu->r[4];
-        /* 0221E3AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0221E3AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0221E3B0 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0221E3B0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0221E3B4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E3B4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E3B4 */ _t4 = _t3 & 0x00000001u;
         /* 0221E3B4 */ if (_t4) goto L_0221E3B8; else goto L_0221E3C8;
   L_0221E3B8: ; // 0x221e3b8
         /* 0221E3B8 */ cpu->r[3] = 0x00000004u;
         /* 0221E3BC */ Gambit_fn_02801A78(cpu);
-        /* 0221E3C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221E3C4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E3C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221E3C4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E3C4 */ _t6 = _t5 & 0x00000001u;
         /* 0221E3C4 */ if (_t6) goto L_0221E3D0; else goto L_0221E3C8;
   L_0221E3C8: ; // 0x221e3c8
@@ -14965,17 +14965,17 @@ void Gambit_fn_0221E3A0(CPUState* cpu) {
         /* 0221E3A4 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0221E3A8 */ cpu->r[31] = cpu->r[3];
         /* 0221E3AC */ cpu->r[3] = cpu->r[4];
-        /* 0221E3AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0221E3AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0221E3B0 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0221E3B0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0221E3B4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E3B4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E3B4 */ _t4 = _t3 & 0x00000001u;
         /* 0221E3B4 */ if (_t4) goto L_0221E3B8; else goto L_0221E3C8;
   L_0221E3B8: ; // 0x221e3b8
         /* 0221E3B8 */ cpu->r[3] = 0x00000004u;
         /* 0221E3BC */ Gambit_fn_02801A78(cpu);
-        /* 0221E3C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221E3C4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E3C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221E3C4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E3C4 */ _t6 = _t5 & 0x00000001u;
         /* 0221E3C4 */ if (_t6) goto L_0221E3D0; else goto L_0221E3C8;
   L_0221E3C8: ; // 0x221e3c8
@@ -15157,7 +15157,7 @@ void Gambit_fn_0221E4B4(CPUState* cpu) {
         /* 0221E4C0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t1);
         /* 0221E4C4 */ _t2 = cpu->r[1] + 0x0000000Cu;
         /* 0221E4C4 */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
-        /* 0221E4C8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
+        /* 0221E4C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
         /* 0221E4CC */ cpu->r[8] = cpu->r[7];
         /* 0221E4D0 */ cpu->r[11] = 0x101C0000u;
         /* 0221E4D4 */ cpu->r[31] = cpu->r[3];
@@ -15165,7 +15165,7 @@ void Gambit_fn_0221E4B4(CPUState* cpu) {
         /* 0221E4D8 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 0221E4DC */ _t4 = cpu->r[11] + 0x00001EF8u;
         /* 0221E4DC */ cpu->r[3] = rbrew_read32(cpu->mem, _t4);
-        /* 0221E4E0 */ _t5 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221E4E0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221E4E0 */ _t6 = _t5 & 0x00000001u;
         /* 0221E4E0 */ if (_t6) goto L_0221E514; else goto L_0221E4E4;
   L_0221E4E4: ; // 0x221e4e4
@@ -15216,7 +15216,7 @@ void Gambit_fn_0221E4BC(CPUState* cpu) {
         /* 0221E4C0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t1);
         /* 0221E4C4 */ _t2 = cpu->r[1] + 0x0000000Cu;
         /* 0221E4C4 */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
-        /* 0221E4C8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
+        /* 0221E4C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
         /* 0221E4CC */ cpu->r[8] = cpu->r[7];
         /* 0221E4D0 */ cpu->r[11] = 0x101C0000u;
         /* 0221E4D4 */ cpu->r[31] = cpu->r[3];
@@ -15224,7 +15224,7 @@ void Gambit_fn_0221E4BC(CPUState* cpu) {
         /* 0221E4D8 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 0221E4DC */ _t4 = cpu->r[11] + 0x00001EF8u;
         /* 0221E4DC */ cpu->r[3] = rbrew_read32(cpu->mem, _t4);
-        /* 0221E4E0 */ _t5 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221E4E0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221E4E0 */ _t6 = _t5 & 0x00000001u;
         /* 0221E4E0 */ if (_t6) goto L_0221E514; else goto L_0221E4E4;
   L_0221E4E4: ; // 0x221e4e4
@@ -15436,9 +15436,9 @@ void Gambit_fn_0221E5F8(CPUState* cpu) {
         /* 0221E5FC */ _t0 = cpu->r[9] + 0xFFFFFD8Cu;
         /* 0221E5FC */ cpu->r[9] = rbrew_read32(cpu->mem, _t0);
         /* 0221E600 */ cpu->r[11] = 0x101D0000u;
-        /* 0221E604 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0221E604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0221E608 */ cpu->r[11] = cpu->r[11] + 0xFFFFFD88u;
-        /* 0221E60C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E60C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E60C */ _t2 = _t1 & 0x00000001u;
         /* 0221E60C */ if (_t2) goto L_0221E610; else goto L_0221E628;
   L_0221E610: ; // 0x221e610
@@ -15451,8 +15451,8 @@ void Gambit_fn_0221E5F8(CPUState* cpu) {
         /* 0221E624 */ _t4 = cpu->r[11] + 0x00000000u;
         /* 0221E624 */ rbrew_write32(cpu->mem, _t4, cpu->r[9]);
   L_0221E628: ; // 0x221e628
-        /* 0221E628 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 0221E62C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E628 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 0221E62C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E62C */ _t6 = _t5 & 0x00000001u;
         /* 0221E62C */ if (_t6) goto L_0221E630; else goto L_0221E638;
   L_0221E630: ; // 0x221e630
@@ -15462,10 +15462,10 @@ void Gambit_fn_0221E5F8(CPUState* cpu) {
         /* 0221E638 */ cpu->r[12] = 0x101D0000u;
         /* 0221E63C */ _t7 = cpu->r[12] + 0xFFFFD9ECu;
         /* 0221E63C */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 0221E640 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0221E640 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0221E644 */ cpu->r[12] = 0x101D0000u;
         /* 0221E648 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 0221E64C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E64C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E64C */ _t9 = _t8 & 0x00000001u;
         /* 0221E64C */ if (_t9) goto L_0221E650; else goto L_0221E668;
   L_0221E650: ; // 0x221e650
@@ -15478,8 +15478,8 @@ void Gambit_fn_0221E5F8(CPUState* cpu) {
         /* 0221E664 */ _t11 = cpu->r[12] + 0x00000000u;
         /* 0221E664 */ rbrew_write32(cpu->mem, _t11, cpu->r[11]);
   L_0221E668: ; // 0x221e668
-        /* 0221E668 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0221E66C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E668 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0221E66C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E66C */ _t13 = _t12 & 0x00000001u;
         /* 0221E66C */ if (_t13) goto L_0221E670; else goto L_0221E678;
   L_0221E670: ; // 0x221e670
@@ -15491,9 +15491,9 @@ void Gambit_fn_0221E5F8(CPUState* cpu) {
         /* 0221E67C */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 0221E67C */ cpu->r[10] = _t14;
         /* 0221E680 */ cpu->r[11] = 0x101D0000u;
-        /* 0221E684 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0221E684 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0221E688 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4ECu;
-        /* 0221E68C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E68C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E68C */ _t16 = _t15 & 0x00000001u;
         /* 0221E68C */ if (_t16) goto L_0221E690; else goto L_0221E6A4;
   L_0221E690: ; // 0x221e690
@@ -15505,8 +15505,8 @@ void Gambit_fn_0221E5F8(CPUState* cpu) {
         /* 0221E6A0 */ _t18 = cpu->r[11] + 0x00000000u;
         /* 0221E6A0 */ rbrew_write32(cpu->mem, _t18, cpu->r[9]);
   L_0221E6A4: ; // 0x221e6a4
-        /* 0221E6A4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 0221E6A8 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E6A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 0221E6A8 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E6A8 */ _t20 = _t19 & 0x00000001u;
         /* 0221E6A8 */ if (_t20) goto L_0221E6AC; else goto L_0221E6B4;
   L_0221E6AC: ; // 0x221e6ac
@@ -15518,9 +15518,9 @@ void Gambit_fn_0221E5F8(CPUState* cpu) {
         /* 0221E6B8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t21);
         /* 0221E6B8 */ cpu->r[9] = _t21;
         /* 0221E6BC */ cpu->r[12] = 0x101D0000u;
-        /* 0221E6C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0221E6C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0221E6C4 */ cpu->r[12] = cpu->r[12] + 0xFFFFD4E4u;
-        /* 0221E6C8 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E6C8 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E6C8 */ _t23 = _t22 & 0x00000001u;
         /* 0221E6C8 */ if (_t23) goto L_0221E6CC; else goto L_0221E6E0;
   L_0221E6CC: ; // 0x221e6cc
@@ -15548,14 +15548,14 @@ void Gambit_fn_0221E700(CPUState* cpu) {
         /* 0221E700 */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 0221E700 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 0221E700 */ cpu->r[1] = _t0;
-        /* 0221E704 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E704 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E704 */ _t2 = _t1 & 0x00000001u;
         /* 0221E704 */ if (_t2) goto L_0221E708; else goto L_0221E718;
   L_0221E708: ; // 0x221e708
         /* 0221E708 */ cpu->r[3] = 0x00000008u;
         /* 0221E70C */ Gambit_fn_02801A78(cpu);
-        /* 0221E710 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221E714 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221E714 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E714 */ _t4 = _t3 & 0x00000001u;
         /* 0221E714 */ if (_t4) goto L_0221E720; else goto L_0221E718;
   L_0221E718: ; // 0x221e718
@@ -15706,15 +15706,15 @@ void Gambit_fn_0221E7C0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0221E7C0: ; // 0x221e7c0
-        /* 0221E7C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221E7C4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E7C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221E7C4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E7C4 */ _t1 = _t0 & 0x00000001u;
         /* 0221E7C4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0221E7C4 */ goto L_0221E7C8;
   L_0221E7C8: ; // 0x221e7c8
         /* 0221E7C8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0221E7C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0221E7CC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E7C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0221E7CC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E7CC */ _t3 = _t2 & 0x00000001u;
         /* 0221E7CC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0221E7CC */ goto L_0221E7D0;
@@ -15733,8 +15733,8 @@ void Gambit_fn_0221E7C0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -15748,15 +15748,15 @@ void Gambit_fn_0221E7C0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -15784,15 +15784,15 @@ void Gambit_fn_0221E7D4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0221E7D4: ; // 0x221e7d4
-        /* 0221E7D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221E7D8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E7D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221E7D8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E7D8 */ _t1 = _t0 & 0x00000001u;
         /* 0221E7D8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0221E7D8 */ goto L_0221E7DC;
   L_0221E7DC: ; // 0x221e7dc
         /* 0221E7DC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0221E7DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0221E7E0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E7DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0221E7E0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E7E0 */ _t3 = _t2 & 0x00000001u;
         /* 0221E7E0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0221E7E0 */ goto L_0221E7E4;
@@ -15811,8 +15811,8 @@ void Gambit_fn_0221E7D4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -15826,15 +15826,15 @@ void Gambit_fn_0221E7D4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -15868,10 +15868,10 @@ void Gambit_fn_0221E7E8(CPUState* cpu) {
         /* 0221E7F0 */ _t1 = cpu->r[3] + 0x00000020u;
         /* 0221E7F0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 0221E7F4 */ cpu->r[8] = cpu->r[0];
-        /* 0221E7F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 0221E7F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 0221E7FC */ _t2 = cpu->r[3] + 0x00000024u;
         /* 0221E7FC */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0221E800 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221E800 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221E800 */ _t4 = _t3 & 0x00000001u;
         /* 0221E800 */ if (_t4) goto L_0221E804; else goto L_0221E81C;
   L_0221E804: ; // 0x221e804
@@ -15879,8 +15879,8 @@ void Gambit_fn_0221E7E8(CPUState* cpu) {
         /* 0221E808 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 0221E80C */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0221E80C */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0221E810 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0221E814 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E810 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0221E814 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E814 */ _t7 = _t6 & 0x00000001u;
         /* 0221E814 */ if (_t7) goto L_0221E818; else goto L_0221E828;
   L_0221E818: ; // 0x221e818
@@ -15888,16 +15888,16 @@ void Gambit_fn_0221E7E8(CPUState* cpu) {
   L_0221E81C: ; // 0x221e81c
         /* 0221E81C */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0221E81C */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0221E820 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0221E824 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E820 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0221E824 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E824 */ _t10 = _t9 & 0x00000001u;
         /* 0221E824 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0221E824 */ goto L_0221E828;
   L_0221E828: ; // 0x221e828
-        /* 0221E828 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 0221E828 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 0221E82C */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0221E82C */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 0221E830 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221E830 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221E830 */ _t13 = _t12 & 0x00000001u;
         /* 0221E830 */ if (_t13) goto L_0221E834; else goto L_0221E83C;
   L_0221E834: ; // 0x221e834
@@ -15908,11 +15908,11 @@ void Gambit_fn_0221E7E8(CPUState* cpu) {
         /* 0221E83C */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0221E840 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0221E840 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0221E844 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221E844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221E848 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0221E848 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0221E84C */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 0221E850 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221E850 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221E850 */ _t18 = _t17 & 0x00000001u;
         /* 0221E850 */ if (_t18) goto L_0221E868; else goto L_0221E854;
   L_0221E854: ; // 0x221e854
@@ -15939,10 +15939,10 @@ void Gambit_fn_0221E870(CPUState* cpu) {
         /* 0221E878 */ _t1 = cpu->r[3] + 0x00000028u;
         /* 0221E878 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 0221E87C */ cpu->r[8] = cpu->r[0];
-        /* 0221E880 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 0221E880 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 0221E884 */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 0221E884 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0221E888 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221E888 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221E888 */ _t4 = _t3 & 0x00000001u;
         /* 0221E888 */ if (_t4) goto L_0221E88C; else goto L_0221E8A4;
   L_0221E88C: ; // 0x221e88c
@@ -15950,8 +15950,8 @@ void Gambit_fn_0221E870(CPUState* cpu) {
         /* 0221E890 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 0221E894 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0221E894 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0221E898 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0221E89C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E898 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0221E89C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E89C */ _t7 = _t6 & 0x00000001u;
         /* 0221E89C */ if (_t7) goto L_0221E8A0; else goto L_0221E8B0;
   L_0221E8A0: ; // 0x221e8a0
@@ -15959,16 +15959,16 @@ void Gambit_fn_0221E870(CPUState* cpu) {
   L_0221E8A4: ; // 0x221e8a4
         /* 0221E8A4 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0221E8A4 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0221E8A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0221E8AC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E8A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0221E8AC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E8AC */ _t10 = _t9 & 0x00000001u;
         /* 0221E8AC */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0221E8AC */ goto L_0221E8B0;
   L_0221E8B0: ; // 0x221e8b0
-        /* 0221E8B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 0221E8B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 0221E8B4 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0221E8B4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 0221E8B8 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221E8B8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221E8B8 */ _t13 = _t12 & 0x00000001u;
         /* 0221E8B8 */ if (_t13) goto L_0221E8BC; else goto L_0221E8C4;
   L_0221E8BC: ; // 0x221e8bc
@@ -15979,11 +15979,11 @@ void Gambit_fn_0221E870(CPUState* cpu) {
         /* 0221E8C4 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0221E8C8 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0221E8C8 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0221E8CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221E8CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221E8D0 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0221E8D0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0221E8D4 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 0221E8D8 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221E8D8 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221E8D8 */ _t18 = _t17 & 0x00000001u;
         /* 0221E8D8 */ if (_t18) goto L_0221E8F0; else goto L_0221E8DC;
   L_0221E8DC: ; // 0x221e8dc
@@ -16016,18 +16016,18 @@ void Gambit_fn_0221E8F8(CPUState* cpu) {
         /* 0221E90C */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0221E90C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0221E910 */ cpu->r[12] = 0x00000000u;
-        /* 0221E914 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221E914 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221E918 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0221E918 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0221E91C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E91C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E91C */ _t6 = _t5 & 0x00000001u;
         /* 0221E91C */ if (_t6) goto L_0221E944; else goto L_0221E920;
   L_0221E920: ; // 0x221e920
         /* 0221E920 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0221E920 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0221E924 */ /* nop */
-        /* 0221E928 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0221E92C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E928 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0221E92C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E92C */ _t9 = _t8 & 0x00000001u;
         /* 0221E92C */ if (_t9) goto L_0221E930; else goto L_0221E944;
   L_0221E930: ; // 0x221e930
@@ -16068,18 +16068,18 @@ void Gambit_fn_0221E8FC(CPUState* cpu) {
         /* 0221E90C */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0221E90C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0221E910 */ cpu->r[12] = 0x00000000u;
-        /* 0221E914 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221E914 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221E918 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0221E918 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0221E91C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E91C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E91C */ _t6 = _t5 & 0x00000001u;
         /* 0221E91C */ if (_t6) goto L_0221E944; else goto L_0221E920;
   L_0221E920: ; // 0x221e920
         /* 0221E920 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0221E920 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0221E924 */ /* nop */
-        /* 0221E928 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0221E92C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E928 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0221E92C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E92C */ _t9 = _t8 & 0x00000001u;
         /* 0221E92C */ if (_t9) goto L_0221E930; else goto L_0221E944;
   L_0221E930: ; // 0x221e930
@@ -16115,10 +16115,10 @@ void Gambit_fn_0221E968(CPUState* cpu) {
         /* 0221E970 */ _t1 = cpu->r[3] + 0x00000030u;
         /* 0221E970 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 0221E974 */ cpu->r[7] = cpu->r[0];
-        /* 0221E978 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 0221E978 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 0221E97C */ _t2 = cpu->r[3] + 0x00000034u;
         /* 0221E97C */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0221E980 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221E980 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221E980 */ _t4 = _t3 & 0x00000001u;
         /* 0221E980 */ if (_t4) goto L_0221E984; else goto L_0221E99C;
   L_0221E984: ; // 0x221e984
@@ -16126,8 +16126,8 @@ void Gambit_fn_0221E968(CPUState* cpu) {
         /* 0221E988 */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 0221E98C */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0221E98C */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0221E990 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0221E994 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0221E994 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E994 */ _t7 = _t6 & 0x00000001u;
         /* 0221E994 */ if (_t7) goto L_0221E998; else goto L_0221E9A8;
   L_0221E998: ; // 0x221e998
@@ -16135,16 +16135,16 @@ void Gambit_fn_0221E968(CPUState* cpu) {
   L_0221E99C: ; // 0x221e99c
         /* 0221E99C */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0221E99C */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0221E9A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0221E9A4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221E9A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0221E9A4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221E9A4 */ _t10 = _t9 & 0x00000001u;
         /* 0221E9A4 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0221E9A4 */ goto L_0221E9A8;
   L_0221E9A8: ; // 0x221e9a8
-        /* 0221E9A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 0221E9A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 0221E9AC */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0221E9AC */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 0221E9B0 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221E9B0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221E9B0 */ _t13 = _t12 & 0x00000001u;
         /* 0221E9B0 */ if (_t13) goto L_0221E9B4; else goto L_0221E9BC;
   L_0221E9B4: ; // 0x221e9b4
@@ -16155,11 +16155,11 @@ void Gambit_fn_0221E968(CPUState* cpu) {
         /* 0221E9BC */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0221E9C0 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0221E9C0 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0221E9C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0221E9C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0221E9C8 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0221E9C8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0221E9CC */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 0221E9D0 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221E9D0 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221E9D0 */ _t18 = _t17 & 0x00000001u;
         /* 0221E9D0 */ if (_t18) goto L_0221E9E8; else goto L_0221E9D4;
   L_0221E9D4: ; // 0x221e9d4
@@ -16194,9 +16194,9 @@ void Gambit_fn_0221E9F0(CPUState* cpu) {
         /* 0221EA08 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 0221EA08 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 0221EA0C */ /* nop */
-        /* 0221EA10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 0221EA10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 0221EA14 */ cpu->r[31] = cpu->r[4];
-        /* 0221EA18 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EA18 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EA18 */ _t6 = _t5 & 0x00000001u;
         /* 0221EA18 */ if (_t6) goto L_0221EA1C; else goto L_0221EA30;
   L_0221EA1C: ; // 0x221ea1c
@@ -16245,9 +16245,9 @@ void Gambit_fn_0221E9F4(CPUState* cpu) {
         /* 0221EA08 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 0221EA08 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 0221EA0C */ /* nop */
-        /* 0221EA10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 0221EA10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 0221EA14 */ cpu->r[31] = cpu->r[4];
-        /* 0221EA18 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EA18 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EA18 */ _t6 = _t5 & 0x00000001u;
         /* 0221EA18 */ if (_t6) goto L_0221EA1C; else goto L_0221EA30;
   L_0221EA1C: ; // 0x221ea1c
@@ -16289,18 +16289,18 @@ void Gambit_fn_0221EA6C(CPUState* cpu) {
         /* 0221EA70 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0221EA70 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0221EA74 */ cpu->r[31] = cpu->r[3];
-        /* 0221EA74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0221EA74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0221EA78 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0221EA78 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0221EA7C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EA7C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EA7C */ _t4 = _t3 & 0x00000001u;
         /* 0221EA7C */ if (_t4) goto L_0221EA80; else goto L_0221EA90;
   L_0221EA80: ; // 0x221ea80
         /* 0221EA80 */ cpu->r[3] = 0x000001E0u;
         /* 0221EA84 */ Gambit_fn_02801A78(cpu);
         /* 0221EA88 */ cpu->r[31] = cpu->r[3];
-        /* 0221EA88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0221EA8C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EA88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0221EA8C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EA8C */ _t6 = _t5 & 0x00000001u;
         /* 0221EA8C */ if (_t6) goto L_0221EAA4; else goto L_0221EA90;
   L_0221EA90: ; // 0x221ea90
@@ -16377,8 +16377,8 @@ void Gambit_fn_0221EADC(CPUState* cpu) {
         /* 0221EADC */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0221EADC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0221EAE0 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 0221EAE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0221EAE4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EAE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0221EAE4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EAE4 */ _t2 = _t1 & 0x00000001u;
         /* 0221EAE4 */ _t3 = _t2 ^ 0x00000001u;
         /* 0221EAE4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -16400,8 +16400,8 @@ void Gambit_fn_0221EAF8(CPUState* cpu) {
         /* 0221EAF8 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0221EAF8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0221EAFC */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 0221EAFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0221EB00 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EAFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0221EB00 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EB00 */ _t2 = _t1 & 0x00000001u;
         /* 0221EB00 */ _t3 = _t2 ^ 0x00000001u;
         /* 0221EB00 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -16423,8 +16423,8 @@ void Gambit_fn_0221EB14(CPUState* cpu) {
         /* 0221EB14 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0221EB14 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0221EB18 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 0221EB18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0221EB1C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EB18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0221EB1C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EB1C */ _t2 = _t1 & 0x00000001u;
         /* 0221EB1C */ _t3 = _t2 ^ 0x00000001u;
         /* 0221EB1C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -16467,8 +16467,8 @@ void Gambit_fn_0221EB40(CPUState* cpu) {
         /* 0221EB50 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0221EB54 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0221EB54 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0221EB58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0221EB5C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EB58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0221EB5C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EB5C */ _t5 = _t4 & 0x00000001u;
         /* 0221EB5C */ if (_t5) goto L_0221EB60; else goto L_0221EB7C;
   L_0221EB60: ; // 0x221eb60
@@ -16507,8 +16507,8 @@ void Gambit_fn_0221EB44(CPUState* cpu) {
         /* 0221EB50 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0221EB54 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0221EB54 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0221EB58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0221EB5C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EB58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0221EB5C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EB5C */ _t5 = _t4 & 0x00000001u;
         /* 0221EB5C */ if (_t5) goto L_0221EB60; else goto L_0221EB7C;
   L_0221EB60: ; // 0x221eb60
@@ -16905,8 +16905,8 @@ void Gambit_fn_0221ED14(CPUState* cpu) {
         /* 0221ED14 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 0221ED14 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0221ED18 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0221ED18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0221ED1C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221ED18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0221ED1C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221ED1C */ _t2 = _t1 & 0x00000001u;
         /* 0221ED1C */ if (_t2) goto L_0221ED2C; else goto L_0221ED20;
   L_0221ED20: ; // 0x221ed20
@@ -16935,8 +16935,8 @@ void Gambit_fn_0221ED38(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -17044,9 +17044,9 @@ void Gambit_fn_0221ED9C(CPUState* cpu) {
         /* 0221EDA0 */ _t0 = cpu->r[7] + 0xFFFFFD98u;
         /* 0221EDA0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t0);
         /* 0221EDA4 */ cpu->r[8] = 0x101D0000u;
-        /* 0221EDA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0221EDA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0221EDAC */ cpu->r[8] = cpu->r[8] + 0xFFFFFF58u;
-        /* 0221EDB0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EDB0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EDB0 */ _t2 = _t1 & 0x00000001u;
         /* 0221EDB0 */ if (_t2) goto L_0221EDB4; else goto L_0221EDCC;
   L_0221EDB4: ; // 0x221edb4
@@ -17059,8 +17059,8 @@ void Gambit_fn_0221ED9C(CPUState* cpu) {
         /* 0221EDC8 */ _t4 = cpu->r[8] + 0x00000000u;
         /* 0221EDC8 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_0221EDCC: ; // 0x221edcc
-        /* 0221EDCC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 0221EDD0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EDCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 0221EDD0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EDD0 */ _t6 = _t5 & 0x00000001u;
         /* 0221EDD0 */ if (_t6) goto L_0221EDD4; else goto L_0221EDDC;
   L_0221EDD4: ; // 0x221edd4
@@ -17071,9 +17071,9 @@ void Gambit_fn_0221ED9C(CPUState* cpu) {
         /* 0221EDE0 */ _t7 = cpu->r[8] + 0xFFFFFC4Cu;
         /* 0221EDE0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 0221EDE4 */ cpu->r[11] = 0x101D0000u;
-        /* 0221EDE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0221EDE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0221EDEC */ cpu->r[11] = cpu->r[11] + 0xFFFFFD90u;
-        /* 0221EDF0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EDF0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EDF0 */ _t9 = _t8 & 0x00000001u;
         /* 0221EDF0 */ if (_t9) goto L_0221EDF4; else goto L_0221EE0C;
   L_0221EDF4: ; // 0x221edf4
@@ -17086,8 +17086,8 @@ void Gambit_fn_0221ED9C(CPUState* cpu) {
         /* 0221EE08 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 0221EE08 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_0221EE0C: ; // 0x221ee0c
-        /* 0221EE0C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 0221EE10 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EE0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 0221EE10 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EE10 */ _t13 = _t12 & 0x00000001u;
         /* 0221EE10 */ if (_t13) goto L_0221EE14; else goto L_0221EE1C;
   L_0221EE14: ; // 0x221ee14
@@ -17098,9 +17098,9 @@ void Gambit_fn_0221ED9C(CPUState* cpu) {
         /* 0221EE20 */ _t14 = cpu->r[9] + 0xFFFFDA0Cu;
         /* 0221EE20 */ cpu->r[9] = rbrew_read32(cpu->mem, _t14);
         /* 0221EE24 */ cpu->r[8] = 0x101D0000u;
-        /* 0221EE28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0221EE28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0221EE2C */ cpu->r[8] = cpu->r[8] + 0xFFFFFC00u;
-        /* 0221EE30 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EE30 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EE30 */ _t16 = _t15 & 0x00000001u;
         /* 0221EE30 */ if (_t16) goto L_0221EE34; else goto L_0221EE4C;
   L_0221EE34: ; // 0x221ee34
@@ -17113,8 +17113,8 @@ void Gambit_fn_0221ED9C(CPUState* cpu) {
         /* 0221EE48 */ _t18 = cpu->r[8] + 0x00000000u;
         /* 0221EE48 */ rbrew_write32(cpu->mem, _t18, cpu->r[10]);
   L_0221EE4C: ; // 0x221ee4c
-        /* 0221EE4C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 0221EE50 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EE4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 0221EE50 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EE50 */ _t20 = _t19 & 0x00000001u;
         /* 0221EE50 */ if (_t20) goto L_0221EE54; else goto L_0221EE5C;
   L_0221EE54: ; // 0x221ee54
@@ -17125,9 +17125,9 @@ void Gambit_fn_0221ED9C(CPUState* cpu) {
         /* 0221EE60 */ _t21 = cpu->r[11] + 0xFFFFDA00u;
         /* 0221EE60 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 0221EE64 */ cpu->r[8] = 0x101D0000u;
-        /* 0221EE68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0221EE68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0221EE6C */ cpu->r[8] = cpu->r[8] + 0xFFFFFBFCu;
-        /* 0221EE70 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EE70 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EE70 */ _t23 = _t22 & 0x00000001u;
         /* 0221EE70 */ if (_t23) goto L_0221EE74; else goto L_0221EE8C;
   L_0221EE74: ; // 0x221ee74
@@ -17140,8 +17140,8 @@ void Gambit_fn_0221ED9C(CPUState* cpu) {
         /* 0221EE88 */ _t25 = cpu->r[8] + 0x00000000u;
         /* 0221EE88 */ rbrew_write32(cpu->mem, _t25, cpu->r[9]);
   L_0221EE8C: ; // 0x221ee8c
-        /* 0221EE8C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 0221EE90 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EE8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 0221EE90 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EE90 */ _t27 = _t26 & 0x00000001u;
         /* 0221EE90 */ if (_t27) goto L_0221EE94; else goto L_0221EE9C;
   L_0221EE94: ; // 0x221ee94
@@ -17152,9 +17152,9 @@ void Gambit_fn_0221ED9C(CPUState* cpu) {
         /* 0221EEA0 */ _t28 = cpu->r[10] + 0xFFFFD9ECu;
         /* 0221EEA0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t28);
         /* 0221EEA4 */ cpu->r[11] = 0x101D0000u;
-        /* 0221EEA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0221EEA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0221EEAC */ cpu->r[11] = cpu->r[11] + 0xFFFFFB4Cu;
-        /* 0221EEB0 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EEB0 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EEB0 */ _t30 = _t29 & 0x00000001u;
         /* 0221EEB0 */ if (_t30) goto L_0221EEB4; else goto L_0221EECC;
   L_0221EEB4: ; // 0x221eeb4
@@ -17167,8 +17167,8 @@ void Gambit_fn_0221ED9C(CPUState* cpu) {
         /* 0221EEC8 */ _t32 = cpu->r[11] + 0x00000000u;
         /* 0221EEC8 */ rbrew_write32(cpu->mem, _t32, cpu->r[7]);
   L_0221EECC: ; // 0x221eecc
-        /* 0221EECC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 0221EED0 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EECC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 0221EED0 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EED0 */ _t34 = _t33 & 0x00000001u;
         /* 0221EED0 */ if (_t34) goto L_0221EED4; else goto L_0221EEDC;
   L_0221EED4: ; // 0x221eed4
@@ -17180,9 +17180,9 @@ void Gambit_fn_0221ED9C(CPUState* cpu) {
         /* 0221EEE0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t35);
         /* 0221EEE0 */ cpu->r[11] = _t35;
         /* 0221EEE4 */ cpu->r[10] = 0x101D0000u;
-        /* 0221EEE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221EEE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221EEEC */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 0221EEF0 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EEF0 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EEF0 */ _t37 = _t36 & 0x00000001u;
         /* 0221EEF0 */ if (_t37) goto L_0221EEF4; else goto L_0221EF08;
   L_0221EEF4: ; // 0x221eef4
@@ -17194,8 +17194,8 @@ void Gambit_fn_0221ED9C(CPUState* cpu) {
         /* 0221EF04 */ _t39 = cpu->r[10] + 0x00000000u;
         /* 0221EF04 */ rbrew_write32(cpu->mem, _t39, cpu->r[0]);
   L_0221EF08: ; // 0x221ef08
-        /* 0221EF08 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0221EF0C */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EF08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0221EF0C */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EF0C */ _t41 = _t40 & 0x00000001u;
         /* 0221EF0C */ if (_t41) goto L_0221EF10; else goto L_0221EF18;
   L_0221EF10: ; // 0x221ef10
@@ -17207,9 +17207,9 @@ void Gambit_fn_0221ED9C(CPUState* cpu) {
         /* 0221EF1C */ cpu->r[9] = rbrew_read32(cpu->mem, _t42);
         /* 0221EF1C */ cpu->r[10] = _t42;
         /* 0221EF20 */ cpu->r[11] = 0x101D0000u;
-        /* 0221EF24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0221EF24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0221EF28 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 0221EF2C */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EF2C */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EF2C */ _t44 = _t43 & 0x00000001u;
         /* 0221EF2C */ if (_t44) goto L_0221EF30; else goto L_0221EF44;
   L_0221EF30: ; // 0x221ef30
@@ -17256,18 +17256,18 @@ void Gambit_fn_0221EF68(CPUState* cpu) {
         /* 0221EF7C */ _t2 = cpu->r[1] + 0x00000058u;
         /* 0221EF7C */ rbrew_write_f32(cpu->mem, _t2, cpu->f[31]);
         /* 0221EF80 */ cpu->r[31] = cpu->r[3];
-        /* 0221EF80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0221EF80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0221EF84 */ _t3 = cpu->r[1] + 0x00000064u;
         /* 0221EF84 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0221EF88 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EF88 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EF88 */ _t5 = _t4 & 0x00000001u;
         /* 0221EF88 */ if (_t5) goto L_0221EF8C; else goto L_0221EF9C;
   L_0221EF8C: ; // 0x221ef8c
         /* 0221EF8C */ cpu->r[3] = 0x000001E0u;
         /* 0221EF90 */ Gambit_fn_02801A78(cpu);
         /* 0221EF94 */ cpu->r[31] = cpu->r[3];
-        /* 0221EF94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0221EF98 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EF94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0221EF98 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EF98 */ _t7 = _t6 & 0x00000001u;
         /* 0221EF98 */ if (_t7) goto L_0221F388; else goto L_0221EF9C;
   L_0221EF9C: ; // 0x221ef9c
@@ -17278,7 +17278,7 @@ void Gambit_fn_0221EF68(CPUState* cpu) {
         /* 0221EFAC */ _t8 = cpu->r[6] + 0xFFFFCA58u;
         /* 0221EFAC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t8);
         /* 0221EFB0 */ cpu->r[30] = cpu->r[31] + 0x00000184u;
-        /* 0221EFB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0221EFB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0221EFB4 */ _t9 = cpu->r[5] + 0xFFFFCA5Cu;
         /* 0221EFB4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t9);
         /* 0221EFB8 */ _t10 = cpu->r[31] + 0x00000178u;
@@ -17294,15 +17294,15 @@ void Gambit_fn_0221EF68(CPUState* cpu) {
         /* 0221EFD0 */ cpu->r[27] = 0x00000000u;
         /* 0221EFD4 */ _t14 = cpu->r[31] + 0x0000017Cu;
         /* 0221EFD4 */ rbrew_write_f32(cpu->mem, _t14, cpu->f[31]);
-        /* 0221EFD8 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EFD8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EFD8 */ _t16 = _t15 & 0x00000001u;
         /* 0221EFD8 */ if (_t16) goto L_0221EFDC; else goto L_0221EFEC;
   L_0221EFDC: ; // 0x221efdc
         /* 0221EFDC */ cpu->r[3] = 0x00000038u;
         /* 0221EFE0 */ Gambit_fn_02801A78(cpu);
         /* 0221EFE4 */ cpu->r[30] = cpu->r[3];
-        /* 0221EFE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0221EFE8 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221EFE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0221EFE8 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221EFE8 */ _t18 = _t17 & 0x00000001u;
         /* 0221EFE8 */ if (_t18) goto L_0221F01C; else goto L_0221EFEC;
   L_0221EFEC: ; // 0x221efec
@@ -17330,10 +17330,10 @@ void Gambit_fn_0221EF68(CPUState* cpu) {
         /* 0221F01C */ cpu->r[3] = cpu->r[31] + 0x000001BCu;
         /* 0221F020 */ Gambit_fn_0203092C(cpu);
         /* 0221F024 */ cpu->r[9] = cpu->r[31] + 0x000001C8u;
-        /* 0221F024 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0221F024 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0221F028 */ _t27 = cpu->r[31] + 0x000001C4u;
         /* 0221F028 */ rbrew_write_f32(cpu->mem, _t27, cpu->f[31]);
-        /* 0221F02C */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221F02C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221F02C */ _t29 = _t28 & 0x00000001u;
         /* 0221F02C */ if (_t29) goto L_0221F030; else goto L_0221F038;
   L_0221F030: ; // 0x221f030
@@ -17347,10 +17347,10 @@ void Gambit_fn_0221EF68(CPUState* cpu) {
         /* 0221F040 */ _t32 = cpu->r[10] & 0xFFF8FFFFu;
         /* 0221F040 */ cpu->r[10] = _t32 | _t31;
         /* 0221F044 */ cpu->r[0] = cpu->r[31] + 0x000001D8u;
-        /* 0221F044 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221F044 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221F048 */ _t33 = cpu->r[31] + 0x000001D4u;
         /* 0221F048 */ rbrew_write32(cpu->mem, _t33, cpu->r[10]);
-        /* 0221F04C */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221F04C */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221F04C */ _t35 = _t34 & 0x00000001u;
         /* 0221F04C */ if (_t35) goto L_0221F050; else goto L_0221F058;
   L_0221F050: ; // 0x221f050
@@ -17390,23 +17390,23 @@ void Gambit_fn_0221EF68(CPUState* cpu) {
         /* 0221F0B4 */ _t43 = cpu->r[7] + 0x00000000u;
         /* 0221F0B4 */ cpu->r[5] = rbrew_read8(cpu->mem, _t43);
         /* 0221F0B8 */ cpu->r[30] = 0x00000000u;
-        /* 0221F0BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[29]);
+        /* 0221F0BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[29]));
         /* 0221F0C0 */ cpu->r[10] = 0x00080000u;
-        /* 0221F0C4 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221F0C4 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221F0C4 */ _t45 = _t44 & 0x00000001u;
         /* 0221F0C4 */ if (_t45) goto L_0221F0EC; else goto L_0221F0C8;
   L_0221F0C8: ; // 0x221f0c8
         /* 0221F0C8 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0221F0CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[10]);
+        /* 0221F0CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[10]));
         /* 0221F0D0 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 0221F0D4 */ _t46 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221F0D4 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221F0D4 */ _t47 = _t46 & 0x00000001u;
         /* 0221F0D4 */ if (_t47) goto L_0221F0E8; else goto L_0221F0D8;
   L_0221F0D8: ; // 0x221f0d8
         /* 0221F0D8 */ _t48 = cpu->r[7] + 0x00000000u;
         /* 0221F0D8 */ cpu->r[6] = rbrew_read8(cpu->mem, _t48);
-        /* 0221F0DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[29]);
-        /* 0221F0E0 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221F0DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[29]));
+        /* 0221F0E0 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221F0E0 */ _t50 = _t49 & 0x00000001u;
         /* 0221F0E0 */ if (_t50) goto L_0221F0E4; else goto L_0221F0C8;
   L_0221F0E4: ; // 0x221f0e4
@@ -17416,8 +17416,8 @@ void Gambit_fn_0221EF68(CPUState* cpu) {
   L_0221F0EC: ; // 0x221f0ec
         /* 0221F0EC */ _t51 = cpu->r[24] + 0x00000008u;
         /* 0221F0EC */ cpu->r[7] = rbrew_read32(cpu->mem, _t51);
-        /* 0221F0F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
-        /* 0221F0F4 */ _t52 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221F0F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
+        /* 0221F0F4 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221F0F4 */ _t53 = _t52 & 0x00000001u;
         /* 0221F0F4 */ if (_t53) goto L_0221F0FC; else goto L_0221F0F8;
   L_0221F0F8: ; // 0x221f0f8
@@ -17478,10 +17478,10 @@ void Gambit_fn_0221EF68(CPUState* cpu) {
         /* 0221F18C */ rbrew_write32(cpu->mem, _t69, cpu->r[12]);
         /* 0221F190 */ _t70 = cpu->r[31] + 0x00000198u;
         /* 0221F190 */ cpu->r[0] = rbrew_read32(cpu->mem, _t70);
-        /* 0221F194 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
+        /* 0221F194 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
         /* 0221F198 */ _t71 = cpu->r[31] + 0x0000019Cu;
         /* 0221F198 */ cpu->r[25] = rbrew_read32(cpu->mem, _t71);
-        /* 0221F19C */ _t72 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221F19C */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221F19C */ _t73 = _t72 & 0x00000001u;
         /* 0221F19C */ if (_t73) goto L_0221F1A0; else goto L_0221F1A4;
   L_0221F1A0: ; // 0x221f1a0
@@ -17497,23 +17497,23 @@ void Gambit_fn_0221EF68(CPUState* cpu) {
         /* 0221F1B8 */ _t76 = cpu->r[11] + 0x00000000u;
         /* 0221F1B8 */ cpu->r[5] = rbrew_read8(cpu->mem, _t76);
         /* 0221F1BC */ cpu->r[30] = 0x00000000u;
-        /* 0221F1C0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[29]);
+        /* 0221F1C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[29]));
         /* 0221F1C4 */ cpu->r[12] = 0x00080000u;
-        /* 0221F1C8 */ _t77 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221F1C8 */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221F1C8 */ _t78 = _t77 & 0x00000001u;
         /* 0221F1C8 */ if (_t78) goto L_0221F1F0; else goto L_0221F1CC;
   L_0221F1CC: ; // 0x221f1cc
         /* 0221F1CC */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0221F1D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[12]);
+        /* 0221F1D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[12]));
         /* 0221F1D4 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
-        /* 0221F1D8 */ _t79 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221F1D8 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221F1D8 */ _t80 = _t79 & 0x00000001u;
         /* 0221F1D8 */ if (_t80) goto L_0221F1EC; else goto L_0221F1DC;
   L_0221F1DC: ; // 0x221f1dc
         /* 0221F1DC */ _t81 = cpu->r[11] + 0x00000000u;
         /* 0221F1DC */ cpu->r[0] = rbrew_read8(cpu->mem, _t81);
-        /* 0221F1E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[29]);
-        /* 0221F1E4 */ _t82 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221F1E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[29]));
+        /* 0221F1E4 */ _t82 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221F1E4 */ _t83 = _t82 & 0x00000001u;
         /* 0221F1E4 */ if (_t83) goto L_0221F1E8; else goto L_0221F1CC;
   L_0221F1E8: ; // 0x221f1e8
@@ -17525,10 +17525,10 @@ void Gambit_fn_0221EF68(CPUState* cpu) {
         /* 0221F1F0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t84);
         /* 0221F1F4 */ _t85 = cpu->r[1] + 0x00000010u;
         /* 0221F1F4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t85);
-        /* 0221F1F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[10]);
+        /* 0221F1F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[10]));
         /* 0221F1FC */ _t86 = cpu->r[7] + 0x00000014u;
         /* 0221F1FC */ cpu->r[0] = rbrew_read32(cpu->mem, _t86);
-        /* 0221F200 */ _t87 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221F200 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221F200 */ _t88 = _t87 & 0x00000001u;
         /* 0221F200 */ if (_t88) goto L_0221F208; else goto L_0221F204;
   L_0221F204: ; // 0x221f204
@@ -17585,10 +17585,10 @@ void Gambit_fn_0221EF68(CPUState* cpu) {
         /* 0221F290 */ rbrew_write32(cpu->mem, _t102, cpu->r[8]);
         /* 0221F294 */ _t103 = cpu->r[31] + 0x00000198u;
         /* 0221F294 */ cpu->r[9] = rbrew_read32(cpu->mem, _t103);
-        /* 0221F298 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000002u);
+        /* 0221F298 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000002u));
         /* 0221F29C */ _t104 = cpu->r[31] + 0x0000019Cu;
         /* 0221F29C */ cpu->r[28] = rbrew_read32(cpu->mem, _t104);
-        /* 0221F2A0 */ _t105 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221F2A0 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221F2A0 */ _t106 = _t105 & 0x00000001u;
         /* 0221F2A0 */ if (_t106) goto L_0221F2A4; else goto L_0221F2A8;
   L_0221F2A4: ; // 0x221f2a4
@@ -17604,23 +17604,23 @@ void Gambit_fn_0221EF68(CPUState* cpu) {
         /* 0221F2BC */ _t109 = cpu->r[12] + 0x00000000u;
         /* 0221F2BC */ cpu->r[5] = rbrew_read8(cpu->mem, _t109);
         /* 0221F2C0 */ cpu->r[30] = 0x00000000u;
-        /* 0221F2C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[29]);
+        /* 0221F2C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[29]));
         /* 0221F2C8 */ cpu->r[7] = 0x00080000u;
-        /* 0221F2CC */ _t110 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221F2CC */ _t110 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221F2CC */ _t111 = _t110 & 0x00000001u;
         /* 0221F2CC */ if (_t111) goto L_0221F2F4; else goto L_0221F2D0;
   L_0221F2D0: ; // 0x221f2d0
         /* 0221F2D0 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0221F2D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 0221F2D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 0221F2D8 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 0221F2DC */ _t112 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221F2DC */ _t112 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221F2DC */ _t113 = _t112 & 0x00000001u;
         /* 0221F2DC */ if (_t113) goto L_0221F2F0; else goto L_0221F2E0;
   L_0221F2E0: ; // 0x221f2e0
         /* 0221F2E0 */ _t114 = cpu->r[12] + 0x00000000u;
         /* 0221F2E0 */ cpu->r[6] = rbrew_read8(cpu->mem, _t114);
-        /* 0221F2E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[29]);
-        /* 0221F2E8 */ _t115 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221F2E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[29]));
+        /* 0221F2E8 */ _t115 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221F2E8 */ _t116 = _t115 & 0x00000001u;
         /* 0221F2E8 */ if (_t116) goto L_0221F2EC; else goto L_0221F2D0;
   L_0221F2EC: ; // 0x221f2ec
@@ -17632,10 +17632,10 @@ void Gambit_fn_0221EF68(CPUState* cpu) {
         /* 0221F2F4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t117);
         /* 0221F2F8 */ _t118 = cpu->r[1] + 0x00000010u;
         /* 0221F2F8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t118);
-        /* 0221F2FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[12]);
+        /* 0221F2FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[12]));
         /* 0221F300 */ _t119 = cpu->r[8] + 0x00000014u;
         /* 0221F300 */ cpu->r[0] = rbrew_read32(cpu->mem, _t119);
-        /* 0221F304 */ _t120 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221F304 */ _t120 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221F304 */ _t121 = _t120 & 0x00000001u;
         /* 0221F304 */ if (_t121) goto L_0221F30C; else goto L_0221F308;
   L_0221F308: ; // 0x221f308
@@ -17691,7 +17691,7 @@ void Gambit_fn_0221EF68(CPUState* cpu) {
         /* 0221F390 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t134);
         /* 0221F394 */ _t135 = cpu->r[1] + 0x00000050u;
         /* 0221F394 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t135);
-        /* 0221F398 */ _t136 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221F398 */ _t136 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221F398 */ _t137 = _t136 & 0x00000001u;
         /* 0221F398 */ if (_t137) goto L_0221F39C; // else: addr-0 trap, fall-through
   L_0221F39C: ; // 0x221f39c
@@ -17716,9 +17716,9 @@ void Gambit_fn_0221F3AC(CPUState* cpu) {
         /* 0221F3BC */ cpu->r[4] = cpu->r[11] + 0x000001BCu;
         /* 0221F3C0 */ goto L_026C06AC;
   L_026C0690: ; // 0x26c0690
-        /* 026C0690 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], 0x0000000Eu);
+        /* 026C0690 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], 0x0000000Eu));
         /* 026C0694 */ cpu->r[12] = cpu->r[3] + 0x000003E4u;
-        /* 026C0698 */ _t2 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 026C0698 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 026C0698 */ _t3 = _t2 & 0x00000001u;
         /* 026C0698 */ if (_t3) goto L_026C069C; else goto L_026C06A4;
   L_026C069C: ; // 0x26c069c
@@ -17749,8 +17749,8 @@ void Gambit_fn_0221F3C4(CPUState* cpu) {
         /* 0221F3D4 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0221F3D4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0221F3D8 */ Gambit_fn_0221F3AC(cpu);
-        /* 0221F3DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0221F3E0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221F3DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0221F3E0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221F3E0 */ _t4 = _t3 & 0x00000001u;
         /* 0221F3E0 */ if (_t4) goto L_0221F3EC; else goto L_0221F3E4;
   L_0221F3E4: ; // 0x221f3e4
@@ -17784,8 +17784,8 @@ void Gambit_fn_0221F3C8(CPUState* cpu) {
         /* 0221F3D4 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0221F3D4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0221F3D8 */ Gambit_fn_0221F3AC(cpu);
-        /* 0221F3DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0221F3E0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221F3DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0221F3E0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221F3E0 */ _t4 = _t3 & 0x00000001u;
         /* 0221F3E0 */ if (_t4) goto L_0221F3EC; else goto L_0221F3E4;
   L_0221F3E4: ; // 0x221f3e4
@@ -17845,8 +17845,8 @@ void Gambit_fn_0221F404(CPUState* cpu) {
         /* 0221F454 */ cpu->r[31] = cpu->r[4];
         /* 0221F458 */ cpu->f[31] = cpu->f[13] + cpu->f[0];
         /* 0221F45C */ Gambit_fn_0221F3AC(cpu);
-        /* 0221F460 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0221F464 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221F460 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0221F464 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221F464 */ _t12 = _t11 & 0x00000001u;
         /* 0221F464 */ if (_t12) goto L_0221F478; else goto L_0221F468;
   L_0221F468: ; // 0x221f468
@@ -17867,7 +17867,7 @@ void Gambit_fn_0221F404(CPUState* cpu) {
         /* 0221F488 */ cpu->r[31] = rbrew_read32(cpu->mem, _t16);
         /* 0221F48C */ _t17 = cpu->r[1] + 0x00000018u;
         /* 0221F48C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t17);
-        /* 0221F490 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221F490 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221F490 */ _t19 = _t18 & 0x00000001u;
         /* 0221F490 */ if (_t19) goto L_0221F494; // else: addr-0 trap, fall-through
   L_0221F494: ; // 0x221f494
@@ -17917,8 +17917,8 @@ void Gambit_fn_0221F408(CPUState* cpu) {
         /* 0221F454 */ cpu->r[31] = cpu->r[4];
         /* 0221F458 */ cpu->f[31] = cpu->f[13] + cpu->f[0];
         /* 0221F45C */ Gambit_fn_0221F3AC(cpu);
-        /* 0221F460 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0221F464 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221F460 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0221F464 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221F464 */ _t12 = _t11 & 0x00000001u;
         /* 0221F464 */ if (_t12) goto L_0221F478; else goto L_0221F468;
   L_0221F468: ; // 0x221f468
@@ -17939,7 +17939,7 @@ void Gambit_fn_0221F408(CPUState* cpu) {
         /* 0221F488 */ cpu->r[31] = rbrew_read32(cpu->mem, _t16);
         /* 0221F48C */ _t17 = cpu->r[1] + 0x00000018u;
         /* 0221F48C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t17);
-        /* 0221F490 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221F490 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221F490 */ _t19 = _t18 & 0x00000001u;
         /* 0221F490 */ if (_t19) goto L_0221F494; // else: addr-0 trap, fall-through
   L_0221F494: ; // 0x221f494
@@ -17965,8 +17965,8 @@ void Gambit_fn_0221F4A4(CPUState* cpu) {
         /* 0221F4B4 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0221F4B4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0221F4B8 */ Gambit_fn_0221F3AC(cpu);
-        /* 0221F4BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0221F4C0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221F4BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0221F4C0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221F4C0 */ _t4 = _t3 & 0x00000001u;
         /* 0221F4C0 */ if (_t4) goto L_0221F4CC; else goto L_0221F4C4;
   L_0221F4C4: ; // 0x221f4c4
@@ -18000,8 +18000,8 @@ void Gambit_fn_0221F4A8(CPUState* cpu) {
         /* 0221F4B4 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0221F4B4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0221F4B8 */ Gambit_fn_0221F3AC(cpu);
-        /* 0221F4BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0221F4C0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221F4BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0221F4C0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221F4C0 */ _t4 = _t3 & 0x00000001u;
         /* 0221F4C0 */ if (_t4) goto L_0221F4CC; else goto L_0221F4C4;
   L_0221F4C4: ; // 0x221f4c4
@@ -18036,8 +18036,8 @@ void Gambit_fn_0221F4E4(CPUState* cpu) {
         /* 0221F4F4 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0221F4F4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0221F4F8 */ Gambit_fn_0221F3AC(cpu);
-        /* 0221F4FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0221F500 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221F4FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0221F500 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221F500 */ _t4 = _t3 & 0x00000001u;
         /* 0221F500 */ if (_t4) goto L_0221F50C; else goto L_0221F504;
   L_0221F504: ; // 0x221f504
@@ -18071,8 +18071,8 @@ void Gambit_fn_0221F4E8(CPUState* cpu) {
         /* 0221F4F4 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0221F4F4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0221F4F8 */ Gambit_fn_0221F3AC(cpu);
-        /* 0221F4FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0221F500 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221F4FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0221F500 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221F500 */ _t4 = _t3 & 0x00000001u;
         /* 0221F500 */ if (_t4) goto L_0221F50C; else goto L_0221F504;
   L_0221F504: ; // 0x221f504
@@ -18143,9 +18143,9 @@ void Gambit_fn_0221F524(CPUState* cpu) {
         /* 0221F594 */ _t14 = cpu->r[24] + 0x000001D4u;
         /* 0221F594 */ cpu->r[8] = rbrew_read32(cpu->mem, _t14);
         /* 0221F598 */ cpu->r[8] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x0000000Eu, 0x0000000Eu);
-        /* 0221F598 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0221F598 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0221F59C */ cpu->r[29] = cpu->r[3];
-        /* 0221F5A0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221F5A0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221F5A0 */ _t16 = _t15 & 0x00000001u;
         /* 0221F5A0 */ if (_t16) goto L_0221F5AC; else goto L_0221F5A4;
   L_0221F5A4: ; // 0x221f5a4
@@ -18257,7 +18257,7 @@ void Gambit_fn_0221F524(CPUState* cpu) {
         /* 0221F6D4 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t43);
         /* 0221F6D8 */ _t44 = cpu->r[1] + 0x00000070u;
         /* 0221F6D8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t44);
-        /* 0221F6DC */ _t45 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221F6DC */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221F6DC */ _t46 = _t45 & 0x00000001u;
         /* 0221F6DC */ if (_t46) goto L_0221F6E0; // else: addr-0 trap, fall-through
   L_0221F6E0: ; // 0x221f6e0
@@ -18551,9 +18551,9 @@ void Gambit_fn_0221F7A4(CPUState* cpu) {
         /* 0221F884 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t29);
         /* 0221F888 */ _t30 = cpu->r[9] + 0xFFFFCA58u;
         /* 0221F888 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t30);
-        /* 0221F88C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
+        /* 0221F88C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
         /* 0221F890 */ cpu->f[28] = cpu->f[1];
-        /* 0221F894 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221F894 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221F894 */ _t32 = _t31 & 0x00000001u;
         /* 0221F894 */ if (_t32) goto L_0221F914; else goto L_0221F898;
   L_0221F898: ; // 0x221f898
@@ -18567,8 +18567,8 @@ void Gambit_fn_0221F7A4(CPUState* cpu) {
         /* 0221F8A8 */ cpu->ctr = cpu->r[0];
         /* 0221F8AC */ cpu->r[3] = cpu->r[30];
         /* 0221F8B0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0221F8B4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[1]);
-        /* 0221F8B8 */ _t36 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221F8B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[1]));
+        /* 0221F8B8 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221F8B8 */ _t37 = _t36 & 0x00000001u;
         /* 0221F8B8 */ if (_t37) goto L_0221F8BC; else goto L_0221F914;
   L_0221F8BC: ; // 0x221f8bc
@@ -18603,7 +18603,7 @@ void Gambit_fn_0221F7A4(CPUState* cpu) {
         /* 0221F8F8 */ cpu->f[25] = rbrew_read_f64(cpu->mem, _t50);
         /* 0221F8FC */ _t51 = cpu->r[1] + 0x000000B8u;
         /* 0221F8FC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t51);
-        /* 0221F900 */ _t52 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221F900 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221F900 */ _t53 = _t52 & 0x00000001u;
         /* 0221F900 */ if (_t53) goto L_0221F904; // else: addr-0 trap, fall-through
   L_0221F904: ; // 0x221f904
@@ -18623,8 +18623,8 @@ void Gambit_fn_0221F7A4(CPUState* cpu) {
         /* 0221F928 */ cpu->r[24] = cpu->r[3];
         /* 0221F92C */ _t57 = cpu->r[24] + 0x00001768u;
         /* 0221F92C */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t57);
-        /* 0221F930 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[31]);
-        /* 0221F934 */ _t58 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221F930 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[31]));
+        /* 0221F934 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221F934 */ _t59 = _t58 & 0x00000001u;
         /* 0221F934 */ if (_t59) goto L_0221F938; else goto L_0221FAB8;
   L_0221F938: ; // 0x221f938
@@ -18643,10 +18643,10 @@ void Gambit_fn_0221F7A4(CPUState* cpu) {
         /* 0221F95C */ cpu->r[31] = rbrew_read32(cpu->mem, _t62);
         /* 0221F960 */ cpu->f[25] = cpu->f[26] - cpu->f[13];
         /* 0221F964 */ cpu->r[25] = 0x00000000u;
-        /* 0221F968 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0221F968 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0221F96C */ _t63 = cpu->r[30] + 0x000001C4u;
         /* 0221F96C */ rbrew_write_f32(cpu->mem, _t63, cpu->f[6]);
-        /* 0221F970 */ _t64 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221F970 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221F970 */ _t65 = _t64 & 0x00000001u;
         /* 0221F970 */ if (_t65) goto L_0221F974; else goto L_0221FAB8;
   L_0221F974: ; // 0x221f974
@@ -18716,18 +18716,18 @@ void Gambit_fn_0221F7A4(CPUState* cpu) {
         /* 0221FA1C */ cpu->r[9] = cpu->r[3] + cpu->r[0];
         /* 0221FA20 */ _t86 = cpu->r[9] + 0x00000104u;
         /* 0221FA20 */ cpu->r[4] = rbrew_read8(cpu->mem, _t86);
-        /* 0221FA24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 0221FA24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 0221FA28 */ _t87 = cpu->r[30] + 0x00000051u;
         /* 0221FA28 */ cpu->r[5] = rbrew_read8(cpu->mem, _t87);
-        /* 0221FA2C */ _t88 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221FA2C */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221FA2C */ _t89 = _t88 & 0x00000001u;
         /* 0221FA2C */ if (_t89) goto L_0221FAA0; else goto L_0221FA30;
   L_0221FA30: ; // 0x221fa30
         /* 0221FA30 */ cpu->r[6] = cpu->r[1] + 0x00000010u;
         /* 0221FA34 */ cpu->r[7] = cpu->r[26] + 0x00006338u;
         /* 0221FA38 */ Gambit_fn_021F000C(cpu);
-        /* 0221FA3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221FA40 */ _t90 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221FA3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221FA40 */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221FA40 */ _t91 = _t90 & 0x00000001u;
         /* 0221FA40 */ if (_t91) goto L_0221FAA0; else goto L_0221FA44;
   L_0221FA44: ; // 0x221fa44
@@ -18772,10 +18772,10 @@ void Gambit_fn_0221F7A4(CPUState* cpu) {
         /* 0221FAA4 */ cpu->f[12] = cpu->f[12] - cpu->f[26];
         /* 0221FAA8 */ cpu->r[25] = cpu->r[25] + 0x00000001u;
         /* 0221FAAC */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 0221FAAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0221FAAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0221FAB0 */ _t105 = cpu->r[30] + 0x000001C4u;
         /* 0221FAB0 */ rbrew_write_f32(cpu->mem, _t105, cpu->f[12]);
-        /* 0221FAB4 */ _t106 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221FAB4 */ _t106 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221FAB4 */ _t107 = _t106 & 0x00000001u;
         /* 0221FAB4 */ if (_t107) goto L_0221FAB8; else goto L_0221F994;
   L_0221FAB8: ; // 0x221fab8
@@ -18808,7 +18808,7 @@ void Gambit_fn_0221F7A4(CPUState* cpu) {
         /* 0221FAEC */ cpu->f[25] = rbrew_read_f64(cpu->mem, _t120);
         /* 0221FAF0 */ _t121 = cpu->r[1] + 0x000000B8u;
         /* 0221FAF0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t121);
-        /* 0221FAF4 */ _t122 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221FAF4 */ _t122 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221FAF4 */ _t123 = _t122 & 0x00000001u;
         /* 0221FAF4 */ if (_t123) goto L_0221FAF8; // else: addr-0 trap, fall-through
   L_0221FAF8: ; // 0x221faf8
@@ -18843,10 +18843,10 @@ void Gambit_fn_0221FB08(CPUState* cpu) {
         /* 0221FB30 */ cpu->r[11] = rbrew_read32(cpu->mem, _t4);
         /* 0221FB34 */ cpu->r[11] = cpu->r[11] + 0x00100000u;
         /* 0221FB38 */ cpu->r[0] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000000u, 0x0000000Bu);
-        /* 0221FB38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221FB38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221FB3C */ _t5 = cpu->r[31] + 0x000001D4u;
         /* 0221FB3C */ rbrew_write32(cpu->mem, _t5, cpu->r[11]);
-        /* 0221FB40 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221FB40 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221FB40 */ _t7 = _t6 & 0x00000001u;
         /* 0221FB40 */ if (_t7) goto L_0221FB44; else goto L_0221FB50;
   L_0221FB44: ; // 0x221fb44
@@ -18888,10 +18888,10 @@ void Gambit_fn_0221FB0C(CPUState* cpu) {
         /* 0221FB30 */ cpu->r[11] = rbrew_read32(cpu->mem, _t4);
         /* 0221FB34 */ cpu->r[11] = cpu->r[11] + 0x00100000u;
         /* 0221FB38 */ cpu->r[0] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000000u, 0x0000000Bu);
-        /* 0221FB38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0221FB38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0221FB3C */ _t5 = cpu->r[31] + 0x000001D4u;
         /* 0221FB3C */ rbrew_write32(cpu->mem, _t5, cpu->r[11]);
-        /* 0221FB40 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221FB40 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221FB40 */ _t7 = _t6 & 0x00000001u;
         /* 0221FB40 */ if (_t7) goto L_0221FB44; else goto L_0221FB50;
   L_0221FB44: ; // 0x221fb44
@@ -18981,16 +18981,16 @@ void Gambit_fn_0221FB64(CPUState* cpu) {
         /* 0221FC08 */ cpu->r[5] = 0x10050000u;
         /* 0221FC0C */ _t21 = cpu->r[5] + 0xFFFFCAB4u;
         /* 0221FC0C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t21);
-        /* 0221FC10 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[1]);
-        /* 0221FC14 */ _t22 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221FC10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[1]));
+        /* 0221FC14 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221FC14 */ _t23 = _t22 & 0x00000001u;
         /* 0221FC14 */ if (_t23) goto L_0221FC88; else goto L_0221FC18;
   L_0221FC18: ; // 0x221fc18
         /* 0221FC18 */ cpu->r[12] = 0x10050000u;
         /* 0221FC1C */ _t24 = cpu->r[12] + 0xFFFFCAB8u;
         /* 0221FC1C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t24);
-        /* 0221FC20 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[11]);
-        /* 0221FC24 */ _t25 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0221FC20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[11]));
+        /* 0221FC24 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0221FC24 */ _t26 = _t25 & 0x00000001u;
         /* 0221FC24 */ if (_t26) goto L_0221FC88; else goto L_0221FC28;
   L_0221FC28: ; // 0x221fc28
@@ -19048,16 +19048,16 @@ void Gambit_fn_0221FB64(CPUState* cpu) {
         /* 0221FCBC */ cpu->f[10] = rbrew_read_f64(cpu->mem, _t39);
         /* 0221FCC0 */ cpu->f[13] = cpu->f[10] - cpu->f[13];
         /* 0221FCC4 */ cpu->f[9] = (double)(float)cpu->f[13];
-        /* 0221FCC8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[11]);
-        /* 0221FCCC */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221FCC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[11]));
+        /* 0221FCCC */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221FCCC */ _t41 = _t40 & 0x00000001u;
         /* 0221FCCC */ if (_t41) goto L_0221FCE4; else goto L_0221FCD0;
   L_0221FCD0: ; // 0x221fcd0
         /* 0221FCD0 */ cpu->r[11] = 0x10050000u;
         /* 0221FCD4 */ _t42 = cpu->r[11] + 0xFFFFCA58u;
         /* 0221FCD4 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t42);
-        /* 0221FCD8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[12]);
-        /* 0221FCDC */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221FCD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[12]));
+        /* 0221FCDC */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221FCDC */ _t44 = _t43 & 0x00000001u;
         /* 0221FCDC */ if (_t44) goto L_0221FCE4; else goto L_0221FCE0;
   L_0221FCE0: ; // 0x221fce0
@@ -19111,7 +19111,7 @@ void Gambit_fn_0221FB64(CPUState* cpu) {
         /* 0221FD5C */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t58);
         /* 0221FD60 */ _t59 = cpu->r[1] + 0x00000078u;
         /* 0221FD60 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t59);
-        /* 0221FD64 */ _t60 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221FD64 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221FD64 */ _t61 = _t60 & 0x00000001u;
         /* 0221FD64 */ if (_t61) goto L_0221FD68; // else: addr-0 trap, fall-through
   L_0221FD68: ; // 0x221fd68
@@ -19212,12 +19212,12 @@ void Gambit_fn_0221FD78(CPUState* cpu) {
         /* 0221FE74 */ _t18 = cpu->r[30] + 0x00000174u;
         /* 0221FE74 */ rbrew_write_f32(cpu->mem, _t18, cpu->f[31]);
         /* 0221FE78 */ cpu->r[9] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x0000000Fu, 0x0000000Fu);
-        /* 0221FE78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0221FE78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0221FE7C */ _t19 = cpu->r[30] + 0x000001D4u;
         /* 0221FE7C */ rbrew_write32(cpu->mem, _t19, cpu->r[8]);
         /* 0221FE80 */ _t20 = cpu->r[30] + 0x00000180u;
         /* 0221FE80 */ rbrew_write_f32(cpu->mem, _t20, cpu->f[0]);
-        /* 0221FE84 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221FE84 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221FE84 */ _t22 = _t21 & 0x00000001u;
         /* 0221FE84 */ if (_t22) goto L_0221FE88; else goto L_0221FEB8;
   L_0221FE88: ; // 0x221fe88
@@ -19228,8 +19228,8 @@ void Gambit_fn_0221FD78(CPUState* cpu) {
         /* 0221FE90 */ cpu->ctr = cpu->r[0];
         /* 0221FE94 */ cpu->r[3] = cpu->r[30];
         /* 0221FE98 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0221FE9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0221FEA0 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221FE9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0221FEA0 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221FEA0 */ _t26 = _t25 & 0x00000001u;
         /* 0221FEA0 */ if (_t26) goto L_0221FEB8; else goto L_0221FEA4;
   L_0221FEA4: ; // 0x221fea4
@@ -19258,7 +19258,7 @@ void Gambit_fn_0221FD78(CPUState* cpu) {
         /* 0221FED4 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t35);
         /* 0221FED8 */ _t36 = cpu->r[1] + 0x00000060u;
         /* 0221FED8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t36);
-        /* 0221FEDC */ _t37 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0221FEDC */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0221FEDC */ _t38 = _t37 & 0x00000001u;
         /* 0221FEDC */ if (_t38) goto L_0221FEE0; // else: addr-0 trap, fall-through
   L_0221FEE0: ; // 0x221fee0
@@ -19284,8 +19284,8 @@ void Gambit_fn_0221FEF0(CPUState* cpu) {
         /* 0221FF00 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0221FF00 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0221FF04 */ Gambit_fn_0221F3AC(cpu);
-        /* 0221FF08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0221FF0C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221FF08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0221FF0C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221FF0C */ _t4 = _t3 & 0x00000001u;
         /* 0221FF0C */ if (_t4) goto L_0221FF18; else goto L_0221FF10;
   L_0221FF10: ; // 0x221ff10
@@ -19319,8 +19319,8 @@ void Gambit_fn_0221FEF4(CPUState* cpu) {
         /* 0221FF00 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0221FF00 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0221FF04 */ Gambit_fn_0221F3AC(cpu);
-        /* 0221FF08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0221FF0C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221FF08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0221FF0C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221FF0C */ _t4 = _t3 & 0x00000001u;
         /* 0221FF0C */ if (_t4) goto L_0221FF18; else goto L_0221FF10;
   L_0221FF10: ; // 0x221ff10
@@ -19355,8 +19355,8 @@ void Gambit_fn_0221FF30(CPUState* cpu) {
         /* 0221FF40 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0221FF40 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0221FF44 */ Gambit_fn_0221F3AC(cpu);
-        /* 0221FF48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0221FF4C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221FF48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0221FF4C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221FF4C */ _t4 = _t3 & 0x00000001u;
         /* 0221FF4C */ if (_t4) goto L_0221FF58; else goto L_0221FF50;
   L_0221FF50: ; // 0x221ff50
@@ -19390,8 +19390,8 @@ void Gambit_fn_0221FF34(CPUState* cpu) {
         /* 0221FF40 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0221FF40 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0221FF44 */ Gambit_fn_0221F3AC(cpu);
-        /* 0221FF48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0221FF4C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221FF48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0221FF4C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221FF4C */ _t4 = _t3 & 0x00000001u;
         /* 0221FF4C */ if (_t4) goto L_0221FF58; else goto L_0221FF50;
   L_0221FF50: ; // 0x221ff50
@@ -19426,8 +19426,8 @@ void Gambit_fn_0221FF70(CPUState* cpu) {
         /* 0221FF80 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0221FF80 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0221FF84 */ Gambit_fn_0221F3AC(cpu);
-        /* 0221FF88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0221FF8C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221FF88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0221FF8C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221FF8C */ _t4 = _t3 & 0x00000001u;
         /* 0221FF8C */ if (_t4) goto L_0221FF98; else goto L_0221FF90;
   L_0221FF90: ; // 0x221ff90
@@ -19461,8 +19461,8 @@ void Gambit_fn_0221FF74(CPUState* cpu) {
         /* 0221FF80 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0221FF80 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0221FF84 */ Gambit_fn_0221F3AC(cpu);
-        /* 0221FF88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0221FF8C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221FF88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0221FF8C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221FF8C */ _t4 = _t3 & 0x00000001u;
         /* 0221FF8C */ if (_t4) goto L_0221FF98; else goto L_0221FF90;
   L_0221FF90: ; // 0x221ff90
@@ -19497,8 +19497,8 @@ void Gambit_fn_0221FFB0(CPUState* cpu) {
         /* 0221FFC0 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0221FFC0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0221FFC4 */ Gambit_fn_0221F3AC(cpu);
-        /* 0221FFC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0221FFCC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221FFC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0221FFCC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221FFCC */ _t4 = _t3 & 0x00000001u;
         /* 0221FFCC */ if (_t4) goto L_0221FFD8; else goto L_0221FFD0;
   L_0221FFD0: ; // 0x221ffd0
@@ -19532,8 +19532,8 @@ void Gambit_fn_0221FFB4(CPUState* cpu) {
         /* 0221FFC0 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0221FFC0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0221FFC4 */ Gambit_fn_0221F3AC(cpu);
-        /* 0221FFC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0221FFCC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0221FFC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0221FFCC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0221FFCC */ _t4 = _t3 & 0x00000001u;
         /* 0221FFCC */ if (_t4) goto L_0221FFD8; else goto L_0221FFD0;
   L_0221FFD0: ; // 0x221ffd0
@@ -19629,10 +19629,10 @@ void Gambit_fn_02220014(CPUState* cpu) {
         /* 02220054 */ cpu->r[12] = rbrew_read32(cpu->mem, _t11);
         /* 02220058 */ cpu->r[31] = cpu->r[4];
         /* 0222005C */ cpu->r[10] = 0x10050000u;
-        /* 02220060 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
+        /* 02220060 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
         /* 02220064 */ _t12 = cpu->r[10] + 0xFFFFCA58u;
         /* 02220064 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t12);
-        /* 02220068 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220068 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220068 */ _t14 = _t13 & 0x00000001u;
         /* 02220068 */ if (_t14) goto L_0222006C; else goto L_022200A4;
   L_0222006C: ; // 0x222006c
@@ -19653,7 +19653,7 @@ void Gambit_fn_02220014(CPUState* cpu) {
         /* 02220088 */ cpu->f[29] = rbrew_read_f64(cpu->mem, _t21);
         /* 0222008C */ _t22 = cpu->r[1] + 0x0000000Cu;
         /* 0222008C */ cpu->r[31] = rbrew_read32(cpu->mem, _t22);
-        /* 02220090 */ _t23 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02220090 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02220090 */ _t24 = _t23 & 0x00000001u;
         /* 02220090 */ if (_t24) goto L_02220094; // else: addr-0 trap, fall-through
   L_02220094: ; // 0x2220094
@@ -19677,8 +19677,8 @@ void Gambit_fn_02220014(CPUState* cpu) {
         /* 022200C4 */ cpu->r[4] = rbrew_rlwinm(cpu->r[0], 0x0000000Fu, 0x0000001Fu, 0x0000001Fu);
         /* 022200C8 */ Gambit_fn_0221FF30(cpu);
         /* 022200CC */ cpu->f[12] = cpu->f[30] - cpu->f[1];
-        /* 022200D0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[31]);
-        /* 022200D4 */ _t29 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022200D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[31]));
+        /* 022200D4 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022200D4 */ _t30 = _t29 & 0x00000001u;
         /* 022200D4 */ if (_t30) goto L_022200D8; else goto L_02220134;
   L_022200D8: ; // 0x22200d8
@@ -19690,8 +19690,8 @@ void Gambit_fn_02220014(CPUState* cpu) {
         /* 022200E8 */ Gambit_fn_0221FF30(cpu);
         /* 022200EC */ cpu->f[13] = cpu->f[30] - cpu->f[1];
         /* 022200F0 */ cpu->f[30] = cpu->f[29] / cpu->f[13];
-        /* 022200F4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
-        /* 022200F8 */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022200F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
+        /* 022200F8 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022200F8 */ _t33 = _t32 & 0x00000001u;
         /* 022200F8 */ if (_t33) goto L_02220124; else goto L_022200FC;
   L_022200FC: ; // 0x22200fc
@@ -19703,8 +19703,8 @@ void Gambit_fn_02220014(CPUState* cpu) {
         /* 0222010C */ cpu->r[3] = cpu->r[31];
         /* 02220110 */ cpu->f[31] = cpu->f[1];
         /* 02220114 */ Gambit_fn_021BCFBC(cpu);
-        /* 02220118 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222011C */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220118 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222011C */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222011C */ _t36 = _t35 & 0x00000001u;
         /* 0222011C */ if (_t36) goto L_022201FC; else goto L_02220120;
   L_02220120: ; // 0x2220120
@@ -19713,8 +19713,8 @@ void Gambit_fn_02220014(CPUState* cpu) {
         /* 02220124 */ cpu->r[12] = 0x10050000u;
         /* 02220128 */ _t37 = cpu->r[12] + 0xFFFFCA98u;
         /* 02220128 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t37);
-        /* 0222012C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[13]);
-        /* 02220130 */ _t38 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222012C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[13]));
+        /* 02220130 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02220130 */ _t39 = _t38 & 0x00000001u;
         /* 02220130 */ if (_t39) goto L_0222015C; else goto L_02220134;
   L_02220134: ; // 0x2220134
@@ -19726,8 +19726,8 @@ void Gambit_fn_02220014(CPUState* cpu) {
         /* 02220144 */ cpu->r[3] = cpu->r[31];
         /* 02220148 */ cpu->f[31] = cpu->f[1];
         /* 0222014C */ Gambit_fn_021BCFBC(cpu);
-        /* 02220150 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02220154 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220150 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02220154 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220154 */ _t42 = _t41 & 0x00000001u;
         /* 02220154 */ if (_t42) goto L_022201FC; else goto L_02220158;
   L_02220158: ; // 0x2220158
@@ -19757,20 +19757,20 @@ void Gambit_fn_02220014(CPUState* cpu) {
         /* 022201A4 */ cpu->r[3] = cpu->r[31];
         /* 022201A8 */ cpu->f[31] = fma(cpu->f[0], cpu->f[30], cpu->f[31]);
         /* 022201AC */ Gambit_fn_021BCFBC(cpu);
-        /* 022201B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022201B4 */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022201B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022201B4 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022201B4 */ _t47 = _t46 & 0x00000001u;
         /* 022201B4 */ if (_t47) goto L_022201FC; else goto L_022201B8;
   L_022201B8: ; // 0x22201b8
-        /* 022201B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x0000000Cu);
-        /* 022201BC */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022201B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x0000000Cu));
+        /* 022201BC */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022201BC */ _t49 = _t48 & 0x00000001u;
         /* 022201BC */ if (_t49) goto L_022201C0; else goto L_022201F0;
   L_022201C0: ; // 0x22201c0
         /* 022201C0 */ cpu->r[3] = cpu->r[30];
         /* 022201C4 */ Gambit_fn_0221FFF0(cpu);
-        /* 022201C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022201CC */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022201C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022201CC */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022201CC */ _t51 = _t50 & 0x00000001u;
         /* 022201CC */ if (_t51) goto L_022201E0; else goto L_022201D0;
   L_022201D0: ; // 0x22201d0
@@ -19809,7 +19809,7 @@ void Gambit_fn_02220014(CPUState* cpu) {
         /* 02220218 */ cpu->r[31] = rbrew_read32(cpu->mem, _t61);
         /* 0222021C */ _t62 = cpu->r[1] + 0x00000008u;
         /* 0222021C */ cpu->r[30] = rbrew_read32(cpu->mem, _t62);
-        /* 02220220 */ _t63 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02220220 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02220220 */ _t64 = _t63 & 0x00000001u;
         /* 02220220 */ if (_t64) goto L_02220224; // else: addr-0 trap, fall-through
   L_02220224: ; // 0x2220224
@@ -19870,10 +19870,10 @@ void Gambit_fn_02220234(CPUState* cpu) {
         /* 022202A0 */ _t13 = cpu->r[10] + 0xFFFFCA58u;
         /* 022202A0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t13);
         /* 022202A4 */ cpu->r[12] = 0x10050000u;
-        /* 022202A8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[12]);
+        /* 022202A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[12]));
         /* 022202AC */ _t14 = cpu->r[12] + 0xFFFFCAC4u;
         /* 022202AC */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t14);
-        /* 022202B0 */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022202B0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022202B0 */ _t16 = _t15 & 0x00000001u;
         /* 022202B0 */ if (_t16) goto L_02220344; else goto L_022202B4;
   L_022202B4: ; // 0x22202b4
@@ -19898,10 +19898,10 @@ void Gambit_fn_02220234(CPUState* cpu) {
         /* 022202DC */ _t25 = cpu->r[1] + 0x00000010u;
         /* 022202DC */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t25);
         /* 022202E0 */ cpu->f[8] = fma(cpu->f[6], cpu->f[6], cpu->f[8]);
-        /* 022202E4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[12]);
+        /* 022202E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[12]));
         /* 022202E8 */ cpu->f[7] = cpu->f[12] * cpu->f[7];
         /* 022202EC */ cpu->r[9] = cpu->r[29] + 0x00000300u;
-        /* 022202F0 */ _t26 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022202F0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022202F0 */ _t27 = _t26 & 0x00000001u;
         /* 022202F0 */ if (_t27) goto L_022202F4; else goto L_02220398;
   L_022202F4: ; // 0x22202f4
@@ -19960,10 +19960,10 @@ void Gambit_fn_02220234(CPUState* cpu) {
         /* 02220380 */ _t44 = cpu->r[1] + 0x00000010u;
         /* 02220380 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t44);
         /* 02220384 */ cpu->f[8] = fma(cpu->f[6], cpu->f[6], cpu->f[8]);
-        /* 02220388 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[12]);
+        /* 02220388 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[12]));
         /* 0222038C */ cpu->f[7] = cpu->f[0] * cpu->f[7];
         /* 02220390 */ cpu->r[9] = cpu->r[29] + 0x00000300u;
-        /* 02220394 */ _t45 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02220394 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02220394 */ _t46 = _t45 & 0x00000001u;
         /* 02220394 */ if (_t46) goto L_022202F4; else goto L_02220398;
   L_02220398: ; // 0x2220398
@@ -20042,10 +20042,10 @@ void Gambit_fn_02220238(CPUState* cpu) {
         /* 022202A0 */ _t13 = cpu->r[10] + 0xFFFFCA58u;
         /* 022202A0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t13);
         /* 022202A4 */ cpu->r[12] = 0x10050000u;
-        /* 022202A8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[12]);
+        /* 022202A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[12]));
         /* 022202AC */ _t14 = cpu->r[12] + 0xFFFFCAC4u;
         /* 022202AC */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t14);
-        /* 022202B0 */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022202B0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022202B0 */ _t16 = _t15 & 0x00000001u;
         /* 022202B0 */ if (_t16) goto L_02220344; else goto L_022202B4;
   L_022202B4: ; // 0x22202b4
@@ -20070,10 +20070,10 @@ void Gambit_fn_02220238(CPUState* cpu) {
         /* 022202DC */ _t25 = cpu->r[1] + 0x00000010u;
         /* 022202DC */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t25);
         /* 022202E0 */ cpu->f[8] = fma(cpu->f[6], cpu->f[6], cpu->f[8]);
-        /* 022202E4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[12]);
+        /* 022202E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[12]));
         /* 022202E8 */ cpu->f[7] = cpu->f[12] * cpu->f[7];
         /* 022202EC */ cpu->r[9] = cpu->r[29] + 0x00000300u;
-        /* 022202F0 */ _t26 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022202F0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022202F0 */ _t27 = _t26 & 0x00000001u;
         /* 022202F0 */ if (_t27) goto L_022202F4; else goto L_02220398;
   L_022202F4: ; // 0x22202f4
@@ -20132,10 +20132,10 @@ void Gambit_fn_02220238(CPUState* cpu) {
         /* 02220380 */ _t44 = cpu->r[1] + 0x00000010u;
         /* 02220380 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t44);
         /* 02220384 */ cpu->f[8] = fma(cpu->f[6], cpu->f[6], cpu->f[8]);
-        /* 02220388 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[12]);
+        /* 02220388 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[12]));
         /* 0222038C */ cpu->f[7] = cpu->f[0] * cpu->f[7];
         /* 02220390 */ cpu->r[9] = cpu->r[29] + 0x00000300u;
-        /* 02220394 */ _t45 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02220394 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02220394 */ _t46 = _t45 & 0x00000001u;
         /* 02220394 */ if (_t46) goto L_022202F4; else goto L_02220398;
   L_02220398: ; // 0x2220398
@@ -20221,17 +20221,17 @@ void Gambit_fn_022203DC(CPUState* cpu) {
         /* 0222044C */ _t18 = cpu->r[1] + 0x00000008u;
         /* 0222044C */ rbrew_write_f32(cpu->mem, _t18, cpu->f[12]);
         /* 02220450 */ cpu->r[12] = 0x10050000u;
-        /* 02220454 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[28]);
+        /* 02220454 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[28]));
         /* 02220458 */ _t19 = cpu->r[12] + 0xFFFFCAC4u;
         /* 02220458 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t19);
         /* 0222045C */ cpu->r[31] = cpu->r[4];
-        /* 02220460 */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02220460 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02220460 */ _t21 = _t20 & 0x00000001u;
         /* 02220460 */ if (_t21) goto L_02220474; else goto L_02220464;
   L_02220464: ; // 0x2220464
         /* 02220464 */ cpu->f[10] = cpu->f[28] * cpu->f[13];
-        /* 02220468 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[28]);
-        /* 0222046C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220468 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[28]));
+        /* 0222046C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222046C */ _t23 = _t22 & 0x00000001u;
         /* 0222046C */ if (_t23) goto L_02220470; else goto L_02220494;
   L_02220470: ; // 0x2220470
@@ -20245,8 +20245,8 @@ void Gambit_fn_022203DC(CPUState* cpu) {
         /* 02220480 */ cpu->f[10] = -fma(cpu->f[10], cpu->f[13], -(cpu->f[29]));
         /* 02220484 */ cpu->f[0] = cpu->f[10] * cpu->f[12];
         /* 02220488 */ cpu->f[10] = cpu->f[0] * cpu->f[13];
-        /* 0222048C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[28]);
-        /* 02220490 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222048C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[28]));
+        /* 02220490 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220490 */ _t27 = _t26 & 0x00000001u;
         /* 02220490 */ if (_t27) goto L_0222061C; else goto L_02220494;
   L_02220494: ; // 0x2220494
@@ -20259,10 +20259,10 @@ void Gambit_fn_022203DC(CPUState* cpu) {
         /* 022204A4 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t29);
         /* 022204A8 */ cpu->f[8] = cpu->f[12] / cpu->f[9];
         /* 022204AC */ cpu->r[12] = 0x10050000u;
-        /* 022204B0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[28]);
+        /* 022204B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[28]));
         /* 022204B4 */ _t30 = cpu->r[12] + 0xFFFFCA98u;
         /* 022204B4 */ cpu->f[27] = rbrew_read_f32(cpu->mem, _t30);
-        /* 022204B8 */ _t31 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022204B8 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022204B8 */ _t32 = _t31 & 0x00000001u;
         /* 022204B8 */ if (_t32) goto L_022204FC; else goto L_022204BC;
   L_022204BC: ; // 0x22204bc
@@ -20283,15 +20283,15 @@ void Gambit_fn_022203DC(CPUState* cpu) {
         /* 022204E8 */ _t36 = cpu->r[12] + 0xFFFFCAE4u;
         /* 022204E8 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t36);
         /* 022204EC */ cpu->f[9] = cpu->f[9] / cpu->f[10];
-        /* 022204F0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[28]);
-        /* 022204F4 */ _t37 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022204F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[28]));
+        /* 022204F4 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022204F4 */ _t38 = _t37 & 0x00000001u;
         /* 022204F4 */ if (_t38) goto L_022204F8; else goto L_0222058C;
   L_022204F8: ; // 0x22204f8
         /* 022204F8 */ goto L_022205A4;
   L_022204FC: ; // 0x22204fc
-        /* 022204FC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[27]);
-        /* 02220500 */ _t39 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022204FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[27]));
+        /* 02220500 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02220500 */ _t40 = _t39 & 0x00000001u;
         /* 02220500 */ if (_t40) goto L_02220548; else goto L_02220504;
   L_02220504: ; // 0x2220504
@@ -20314,8 +20314,8 @@ void Gambit_fn_022203DC(CPUState* cpu) {
         /* 02220534 */ _t45 = cpu->r[12] + 0xFFFFCAE4u;
         /* 02220534 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t45);
         /* 02220538 */ cpu->f[9] = cpu->f[9] / cpu->f[10];
-        /* 0222053C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[28]);
-        /* 02220540 */ _t46 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222053C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[28]));
+        /* 02220540 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02220540 */ _t47 = _t46 & 0x00000001u;
         /* 02220540 */ if (_t47) goto L_02220544; else goto L_0222058C;
   L_02220544: ; // 0x2220544
@@ -20341,25 +20341,25 @@ void Gambit_fn_022203DC(CPUState* cpu) {
         /* 0222057C */ _t52 = cpu->r[12] + 0xFFFFCAE4u;
         /* 0222057C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t52);
         /* 02220580 */ cpu->f[9] = cpu->f[9] / cpu->f[10];
-        /* 02220584 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[28]);
-        /* 02220588 */ _t53 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02220584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[28]));
+        /* 02220588 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02220588 */ _t54 = _t53 & 0x00000001u;
         /* 02220588 */ if (_t54) goto L_022205A4; else goto L_0222058C;
   L_0222058C: ; // 0x222058c
         /* 0222058C */ cpu->f[0] = cpu->f[29];
         /* 02220590 */ _t55 = cpu->r[1] + 0x00000008u;
         /* 02220590 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t55);
-        /* 02220594 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[0]);
+        /* 02220594 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[0]));
         /* 02220598 */ _t56 = cpu->r[1] + 0x0000000Cu;
         /* 02220598 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t56);
-        /* 0222059C */ _t57 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222059C */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222059C */ _t58 = _t57 & 0x00000001u;
         /* 0222059C */ if (_t58) goto L_022205E4; else goto L_022205A0;
   L_022205A0: ; // 0x22205a0
         /* 022205A0 */ goto L_022205E8;
   L_022205A4: ; // 0x22205a4
-        /* 022205A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[27]);
-        /* 022205A8 */ _t59 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022205A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[27]));
+        /* 022205A8 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022205A8 */ _t60 = _t59 & 0x00000001u;
         /* 022205A8 */ if (_t60) goto L_022205C8; else goto L_022205AC;
   L_022205AC: ; // 0x22205ac
@@ -20368,10 +20368,10 @@ void Gambit_fn_022203DC(CPUState* cpu) {
         /* 022205B0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t61);
         /* 022205B4 */ _t62 = cpu->r[1] + 0x00000008u;
         /* 022205B4 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t62);
-        /* 022205B8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[0]);
+        /* 022205B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[0]));
         /* 022205BC */ _t63 = cpu->r[1] + 0x0000000Cu;
         /* 022205BC */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t63);
-        /* 022205C0 */ _t64 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022205C0 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022205C0 */ _t65 = _t64 & 0x00000001u;
         /* 022205C0 */ if (_t65) goto L_022205E4; else goto L_022205C4;
   L_022205C4: ; // 0x22205c4
@@ -20383,10 +20383,10 @@ void Gambit_fn_022203DC(CPUState* cpu) {
         /* 022205D0 */ cpu->f[0] = fma(cpu->f[8], cpu->f[9], cpu->f[29]);
         /* 022205D4 */ _t67 = cpu->r[1] + 0x00000008u;
         /* 022205D4 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t67);
-        /* 022205D8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[0]);
+        /* 022205D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[0]));
         /* 022205DC */ _t68 = cpu->r[1] + 0x0000000Cu;
         /* 022205DC */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t68);
-        /* 022205E0 */ _t69 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022205E0 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022205E0 */ _t70 = _t69 & 0x00000001u;
         /* 022205E0 */ if (_t70) goto L_022205E4; else goto L_022205E8;
   L_022205E4: ; // 0x22205e4
@@ -20394,8 +20394,8 @@ void Gambit_fn_022203DC(CPUState* cpu) {
   L_022205E8: ; // 0x22205e8
         /* 022205E8 */ cpu->f[10] = cpu->f[8] * cpu->f[8];
         /* 022205EC */ cpu->f[8] = fma(cpu->f[9], cpu->f[9], cpu->f[10]);
-        /* 022205F0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[28]);
-        /* 022205F4 */ _t71 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022205F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[28]));
+        /* 022205F4 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022205F4 */ _t72 = _t71 & 0x00000001u;
         /* 022205F4 */ if (_t72) goto L_022205F8; else goto L_0222061C;
   L_022205F8: ; // 0x22205f8
@@ -20441,7 +20441,7 @@ void Gambit_fn_022203DC(CPUState* cpu) {
         /* 02220650 */ cpu->r[31] = rbrew_read32(cpu->mem, _t88);
         /* 02220654 */ _t89 = cpu->r[1] + 0x00000058u;
         /* 02220654 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t89);
-        /* 02220658 */ _t90 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02220658 */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02220658 */ _t91 = _t90 & 0x00000001u;
         /* 02220658 */ if (_t91) goto L_0222065C; // else: addr-0 trap, fall-through
   L_0222065C: ; // 0x222065c
@@ -20476,10 +20476,10 @@ void Gambit_fn_0222066C(CPUState* cpu) {
         /* 02220694 */ _t5 = cpu->r[8] + 0xFFFFCAF0u;
         /* 02220694 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t5);
         /* 02220698 */ cpu->r[6] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x0000000Cu, 0x0000000Cu);
-        /* 02220698 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02220698 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 0222069C */ _t6 = cpu->r[30] + 0x00000114u;
         /* 0222069C */ cpu->r[10] = rbrew_read32(cpu->mem, _t6);
-        /* 022206A0 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022206A0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022206A0 */ _t8 = _t7 & 0x00000001u;
         /* 022206A0 */ if (_t8) goto L_022206F4; else goto L_022206A4;
   L_022206A4: ; // 0x22206a4
@@ -20516,8 +20516,8 @@ void Gambit_fn_0222066C(CPUState* cpu) {
         /* 022206F0 */ rbrew_write_f32(cpu->mem, _t19, cpu->f[11]);
   L_022206F4: ; // 0x22206f4
         /* 022206F4 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000000Au, 0x0000000Bu);
-        /* 022206F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 022206F8 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022206F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 022206F8 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022206F8 */ _t21 = _t20 & 0x00000001u;
         /* 022206F8 */ if (_t21) goto L_0222074C; else goto L_022206FC;
   L_022206FC: ; // 0x22206fc
@@ -20632,10 +20632,10 @@ void Gambit_fn_02220670(CPUState* cpu) {
         /* 02220694 */ _t5 = cpu->r[8] + 0xFFFFCAF0u;
         /* 02220694 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t5);
         /* 02220698 */ cpu->r[6] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x0000000Cu, 0x0000000Cu);
-        /* 02220698 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02220698 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 0222069C */ _t6 = cpu->r[30] + 0x00000114u;
         /* 0222069C */ cpu->r[10] = rbrew_read32(cpu->mem, _t6);
-        /* 022206A0 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022206A0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022206A0 */ _t8 = _t7 & 0x00000001u;
         /* 022206A0 */ if (_t8) goto L_022206F4; else goto L_022206A4;
   L_022206A4: ; // 0x22206a4
@@ -20672,8 +20672,8 @@ void Gambit_fn_02220670(CPUState* cpu) {
         /* 022206F0 */ rbrew_write_f32(cpu->mem, _t19, cpu->f[11]);
   L_022206F4: ; // 0x22206f4
         /* 022206F4 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000000Au, 0x0000000Bu);
-        /* 022206F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 022206F8 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022206F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 022206F8 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022206F8 */ _t21 = _t20 & 0x00000001u;
         /* 022206F8 */ if (_t21) goto L_0222074C; else goto L_022206FC;
   L_022206FC: ; // 0x22206fc
@@ -20789,9 +20789,9 @@ void Gambit_fn_022207D0(CPUState* cpu) {
         /* 022207F0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t6);
         /* 022207F4 */ cpu->r[31] = cpu->r[5];
         /* 022207F8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x0000000Fu, 0x0000000Fu);
-        /* 022207F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 022207F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 022207FC */ cpu->r[30] = cpu->r[4];
-        /* 02220800 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220800 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220800 */ _t8 = _t7 & 0x00000001u;
         /* 02220800 */ if (_t8) goto L_02220830; else goto L_02220804;
   L_02220804: ; // 0x2220804
@@ -20815,17 +20815,17 @@ void Gambit_fn_022207D0(CPUState* cpu) {
         /* 02220830 */ _t14 = cpu->r[31] + 0x0000015Cu;
         /* 02220830 */ cpu->r[10] = rbrew_read32(cpu->mem, _t14);
         /* 02220834 */ cpu->r[8] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 02220834 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02220838 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220834 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02220838 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220838 */ _t16 = _t15 & 0x00000001u;
         /* 02220838 */ if (_t16) goto L_022208B8; else goto L_0222083C;
   L_0222083C: ; // 0x222083c
         /* 0222083C */ _t17 = cpu->r[31] + 0x00000000u;
         /* 0222083C */ cpu->r[0] = rbrew_read32(cpu->mem, _t17);
         /* 02220840 */ cpu->r[11] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02220840 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02220840 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02220844 */ cpu->r[28] = cpu->r[31] + 0x00000048u;
-        /* 02220848 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220848 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220848 */ _t19 = _t18 & 0x00000001u;
         /* 02220848 */ if (_t19) goto L_02220894; else goto L_0222084C;
   L_0222084C: ; // 0x222084c
@@ -20834,10 +20834,10 @@ void Gambit_fn_022207D0(CPUState* cpu) {
         /* 02220854 */ cpu->r[12] = 0x10050000u;
         /* 02220858 */ _t20 = cpu->r[12] + 0xFFFFCA58u;
         /* 02220858 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t20);
-        /* 0222085C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[13]);
+        /* 0222085C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[13]));
         /* 02220860 */ _t21 = cpu->r[31] + 0x00000000u;
         /* 02220860 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
-        /* 02220864 */ _t22 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02220864 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02220864 */ _t23 = _t22 & 0x00000001u;
         /* 02220864 */ if (_t23) goto L_02220868; else goto L_0222088C;
   L_02220868: ; // 0x2220868
@@ -20864,8 +20864,8 @@ void Gambit_fn_022207D0(CPUState* cpu) {
         /* 0222089C */ Gambit_fn_02C88F2C(cpu);
         /* 022208A0 */ _t29 = cpu->r[28] + 0x00000004u;
         /* 022208A0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t29);
-        /* 022208A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[1]);
-        /* 022208A8 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022208A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[1]));
+        /* 022208A8 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022208A8 */ _t31 = _t30 & 0x00000001u;
         /* 022208A8 */ if (_t31) goto L_022208B8; else goto L_022208AC;
   L_022208AC: ; // 0x22208ac
@@ -20880,8 +20880,8 @@ void Gambit_fn_022207D0(CPUState* cpu) {
         /* 022208C0 */ cpu->r[3] = cpu->r[29];
         /* 022208C4 */ Gambit_fn_0222CA20(cpu);
         /* 022208C8 */ cpu->r[31] = cpu->r[3];
-        /* 022208C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022208CC */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022208C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022208CC */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022208CC */ _t35 = _t34 & 0x00000001u;
         /* 022208CC */ if (_t35) goto L_022208E4; else goto L_022208D0;
   L_022208D0: ; // 0x22208d0
@@ -20937,9 +20937,9 @@ void Gambit_fn_022207D4(CPUState* cpu) {
         /* 022207F0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t6);
         /* 022207F4 */ cpu->r[31] = cpu->r[5];
         /* 022207F8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x0000000Fu, 0x0000000Fu);
-        /* 022207F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 022207F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 022207FC */ cpu->r[30] = cpu->r[4];
-        /* 02220800 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220800 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220800 */ _t8 = _t7 & 0x00000001u;
         /* 02220800 */ if (_t8) goto L_02220830; else goto L_02220804;
   L_02220804: ; // 0x2220804
@@ -20963,17 +20963,17 @@ void Gambit_fn_022207D4(CPUState* cpu) {
         /* 02220830 */ _t14 = cpu->r[31] + 0x0000015Cu;
         /* 02220830 */ cpu->r[10] = rbrew_read32(cpu->mem, _t14);
         /* 02220834 */ cpu->r[8] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 02220834 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02220838 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220834 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02220838 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220838 */ _t16 = _t15 & 0x00000001u;
         /* 02220838 */ if (_t16) goto L_022208B8; else goto L_0222083C;
   L_0222083C: ; // 0x222083c
         /* 0222083C */ _t17 = cpu->r[31] + 0x00000000u;
         /* 0222083C */ cpu->r[0] = rbrew_read32(cpu->mem, _t17);
         /* 02220840 */ cpu->r[11] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02220840 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02220840 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02220844 */ cpu->r[28] = cpu->r[31] + 0x00000048u;
-        /* 02220848 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220848 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220848 */ _t19 = _t18 & 0x00000001u;
         /* 02220848 */ if (_t19) goto L_02220894; else goto L_0222084C;
   L_0222084C: ; // 0x222084c
@@ -20982,10 +20982,10 @@ void Gambit_fn_022207D4(CPUState* cpu) {
         /* 02220854 */ cpu->r[12] = 0x10050000u;
         /* 02220858 */ _t20 = cpu->r[12] + 0xFFFFCA58u;
         /* 02220858 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t20);
-        /* 0222085C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[13]);
+        /* 0222085C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[13]));
         /* 02220860 */ _t21 = cpu->r[31] + 0x00000000u;
         /* 02220860 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
-        /* 02220864 */ _t22 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02220864 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02220864 */ _t23 = _t22 & 0x00000001u;
         /* 02220864 */ if (_t23) goto L_02220868; else goto L_0222088C;
   L_02220868: ; // 0x2220868
@@ -21012,8 +21012,8 @@ void Gambit_fn_022207D4(CPUState* cpu) {
         /* 0222089C */ Gambit_fn_02C88F2C(cpu);
         /* 022208A0 */ _t29 = cpu->r[28] + 0x00000004u;
         /* 022208A0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t29);
-        /* 022208A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[1]);
-        /* 022208A8 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022208A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[1]));
+        /* 022208A8 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022208A8 */ _t31 = _t30 & 0x00000001u;
         /* 022208A8 */ if (_t31) goto L_022208B8; else goto L_022208AC;
   L_022208AC: ; // 0x22208ac
@@ -21028,8 +21028,8 @@ void Gambit_fn_022207D4(CPUState* cpu) {
         /* 022208C0 */ cpu->r[3] = cpu->r[29];
         /* 022208C4 */ Gambit_fn_0222CA20(cpu);
         /* 022208C8 */ cpu->r[31] = cpu->r[3];
-        /* 022208C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022208CC */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022208C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022208CC */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022208CC */ _t35 = _t34 & 0x00000001u;
         /* 022208CC */ if (_t35) goto L_022208E4; else goto L_022208D0;
   L_022208D0: ; // 0x22208d0
@@ -21076,8 +21076,8 @@ void Gambit_fn_02220914(CPUState* cpu) {
         /* 02220920 */ _t2 = cpu->r[3] + 0x000001D4u;
         /* 02220920 */ cpu->r[0] = rbrew_read32(cpu->mem, _t2);
         /* 02220924 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000000Fu, 0x0000000Fu);
-        /* 02220924 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02220928 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220924 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02220928 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220928 */ _t4 = _t3 & 0x00000001u;
         /* 02220928 */ if (_t4) goto L_02220944; else goto L_0222092C;
   L_0222092C: ; // 0x222092c
@@ -21108,8 +21108,8 @@ void Gambit_fn_0222091C(CPUState* cpu) {
         /* 02220920 */ _t1 = cpu->r[3] + 0x000001D4u;
         /* 02220920 */ cpu->r[0] = rbrew_read32(cpu->mem, _t1);
         /* 02220924 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000000Fu, 0x0000000Fu);
-        /* 02220924 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02220928 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220924 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02220928 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220928 */ _t3 = _t2 & 0x00000001u;
         /* 02220928 */ if (_t3) goto L_02220944; else goto L_0222092C;
   L_0222092C: ; // 0x222092c
@@ -21138,9 +21138,9 @@ void Gambit_fn_02220958(CPUState* cpu) {
         /* 02220958 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 0222095C */ cpu->r[11] = rbrew_rlwinm(cpu->r[12], 0x00000010u, 0x0000001Du, 0x0000001Fu);
         /* 02220960 */ cpu->r[0] = cpu->r[11] & 0x00000005u;
-        /* 02220960 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02220964 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 02220968 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220960 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02220964 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 02220968 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220968 */ _t2 = _t1 & 0x00000001u;
         /* 02220968 */ if (_t2) goto L_0222097C; else goto L_0222096C;
   L_0222096C: ; // 0x222096c
@@ -21158,8 +21158,8 @@ void Gambit_fn_02220958(CPUState* cpu) {
         /* 02220980 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t7);
         /* 02220984 */ _t8 = cpu->r[11] + 0xFFFFCA58u;
         /* 02220984 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t8);
-        /* 02220988 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 0222098C */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02220988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 0222098C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222098C */ _t10 = _t9 & 0x00000001u;
         /* 0222098C */ _t11 = _t10 ^ 0x00000001u;
         /* 0222098C */ if (_t11) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -21198,9 +21198,9 @@ void Gambit_fn_02220998(CPUState* cpu) {
         /* 022209C4 */ cpu->r[28] = cpu->r[5];
         /* 022209C8 */ cpu->r[30] = cpu->r[3];
         /* 022209CC */ cpu->r[4] = cpu->r[4] + 0xFFFFE310u;
-        /* 022209D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 022209D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 022209D4 */ cpu->r[29] = cpu->r[6];
-        /* 022209D8 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022209D8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022209D8 */ _t8 = _t7 & 0x00000001u;
         /* 022209D8 */ if (_t8) goto L_022209DC; else goto L_022209F0;
   L_022209DC: ; // 0x22209dc
@@ -21212,8 +21212,8 @@ void Gambit_fn_02220998(CPUState* cpu) {
         /* 022209EC */ _t10 = cpu->r[4] + 0x00000000u;
         /* 022209EC */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
   L_022209F0: ; // 0x22209f0
-        /* 022209F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022209F4 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022209F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022209F4 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022209F4 */ _t12 = _t11 & 0x00000001u;
         /* 022209F4 */ if (_t12) goto L_02220A60; else goto L_022209F8;
   L_022209F8: ; // 0x22209f8
@@ -21224,13 +21224,13 @@ void Gambit_fn_02220998(CPUState* cpu) {
         /* 02220A00 */ cpu->ctr = cpu->r[0];
         /* 02220A04 */ cpu->r[3] = cpu->r[31];
         /* 02220A08 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02220A0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02220A10 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220A0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02220A10 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220A10 */ _t16 = _t15 & 0x00000001u;
         /* 02220A10 */ if (_t16) goto L_02220A60; else goto L_02220A14;
   L_02220A14: ; // 0x2220a14
-        /* 02220A14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02220A18 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220A14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02220A18 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220A18 */ _t18 = _t17 & 0x00000001u;
         /* 02220A18 */ if (_t18) goto L_02220A60; else goto L_02220A1C;
   L_02220A1C: ; // 0x2220a1c
@@ -21238,16 +21238,16 @@ void Gambit_fn_02220998(CPUState* cpu) {
         /* 02220A1C */ cpu->r[10] = rbrew_read32(cpu->mem, _t19);
         /* 02220A20 */ _t20 = cpu->r[30] + 0x0000002Cu;
         /* 02220A20 */ cpu->r[8] = rbrew_read32(cpu->mem, _t20);
-        /* 02220A24 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[8]);
-        /* 02220A28 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220A24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[8]));
+        /* 02220A28 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220A28 */ _t22 = _t21 & 0x00000001u;
         /* 02220A28 */ if (_t22) goto L_02220A2C; else goto L_02220A60;
   L_02220A2C: ; // 0x2220a2c
         /* 02220A2C */ _t23 = cpu->r[30] + 0x000001D4u;
         /* 02220A2C */ cpu->r[0] = rbrew_read32(cpu->mem, _t23);
         /* 02220A30 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x0000000Cu, 0x00000014u, 0x0000001Fu);
-        /* 02220A34 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
-        /* 02220A38 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02220A34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
+        /* 02220A38 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02220A38 */ _t25 = _t24 & 0x00000001u;
         /* 02220A38 */ if (_t25) goto L_02220A3C; else goto L_02220A60;
   L_02220A3C: ; // 0x2220a3c
@@ -21313,9 +21313,9 @@ void Gambit_fn_0222099C(CPUState* cpu) {
         /* 022209C4 */ cpu->r[28] = cpu->r[5];
         /* 022209C8 */ cpu->r[30] = cpu->r[3];
         /* 022209CC */ cpu->r[4] = cpu->r[4] + 0xFFFFE310u;
-        /* 022209D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 022209D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 022209D4 */ cpu->r[29] = cpu->r[6];
-        /* 022209D8 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022209D8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022209D8 */ _t8 = _t7 & 0x00000001u;
         /* 022209D8 */ if (_t8) goto L_022209DC; else goto L_022209F0;
   L_022209DC: ; // 0x22209dc
@@ -21327,8 +21327,8 @@ void Gambit_fn_0222099C(CPUState* cpu) {
         /* 022209EC */ _t10 = cpu->r[4] + 0x00000000u;
         /* 022209EC */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
   L_022209F0: ; // 0x22209f0
-        /* 022209F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022209F4 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022209F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022209F4 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022209F4 */ _t12 = _t11 & 0x00000001u;
         /* 022209F4 */ if (_t12) goto L_02220A60; else goto L_022209F8;
   L_022209F8: ; // 0x22209f8
@@ -21339,13 +21339,13 @@ void Gambit_fn_0222099C(CPUState* cpu) {
         /* 02220A00 */ cpu->ctr = cpu->r[0];
         /* 02220A04 */ cpu->r[3] = cpu->r[31];
         /* 02220A08 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02220A0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02220A10 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220A0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02220A10 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220A10 */ _t16 = _t15 & 0x00000001u;
         /* 02220A10 */ if (_t16) goto L_02220A60; else goto L_02220A14;
   L_02220A14: ; // 0x2220a14
-        /* 02220A14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02220A18 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220A14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02220A18 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220A18 */ _t18 = _t17 & 0x00000001u;
         /* 02220A18 */ if (_t18) goto L_02220A60; else goto L_02220A1C;
   L_02220A1C: ; // 0x2220a1c
@@ -21353,16 +21353,16 @@ void Gambit_fn_0222099C(CPUState* cpu) {
         /* 02220A1C */ cpu->r[10] = rbrew_read32(cpu->mem, _t19);
         /* 02220A20 */ _t20 = cpu->r[30] + 0x0000002Cu;
         /* 02220A20 */ cpu->r[8] = rbrew_read32(cpu->mem, _t20);
-        /* 02220A24 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[8]);
-        /* 02220A28 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220A24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[8]));
+        /* 02220A28 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220A28 */ _t22 = _t21 & 0x00000001u;
         /* 02220A28 */ if (_t22) goto L_02220A2C; else goto L_02220A60;
   L_02220A2C: ; // 0x2220a2c
         /* 02220A2C */ _t23 = cpu->r[30] + 0x000001D4u;
         /* 02220A2C */ cpu->r[0] = rbrew_read32(cpu->mem, _t23);
         /* 02220A30 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x0000000Cu, 0x00000014u, 0x0000001Fu);
-        /* 02220A34 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000003u);
-        /* 02220A38 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02220A34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000003u));
+        /* 02220A38 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02220A38 */ _t25 = _t24 & 0x00000001u;
         /* 02220A38 */ if (_t25) goto L_02220A3C; else goto L_02220A60;
   L_02220A3C: ; // 0x2220a3c
@@ -21416,8 +21416,8 @@ void Gambit_fn_02220A94(CPUState* cpu) {
         /* 02220AA4 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02220AA4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02220AA8 */ Gambit_fn_0221F3AC(cpu);
-        /* 02220AAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02220AB0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220AAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02220AB0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220AB0 */ _t4 = _t3 & 0x00000001u;
         /* 02220AB0 */ if (_t4) goto L_02220ABC; else goto L_02220AB4;
   L_02220AB4: ; // 0x2220ab4
@@ -21451,8 +21451,8 @@ void Gambit_fn_02220A98(CPUState* cpu) {
         /* 02220AA4 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02220AA4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02220AA8 */ Gambit_fn_0221F3AC(cpu);
-        /* 02220AAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02220AB0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220AAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02220AB0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220AB0 */ _t4 = _t3 & 0x00000001u;
         /* 02220AB0 */ if (_t4) goto L_02220ABC; else goto L_02220AB4;
   L_02220AB4: ; // 0x2220ab4
@@ -21487,8 +21487,8 @@ void Gambit_fn_02220AD4(CPUState* cpu) {
         /* 02220AE4 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02220AE4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02220AE8 */ Gambit_fn_0221F3AC(cpu);
-        /* 02220AEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02220AF0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220AEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02220AF0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220AF0 */ _t4 = _t3 & 0x00000001u;
         /* 02220AF0 */ if (_t4) goto L_02220AFC; else goto L_02220AF4;
   L_02220AF4: ; // 0x2220af4
@@ -21522,8 +21522,8 @@ void Gambit_fn_02220AD8(CPUState* cpu) {
         /* 02220AE4 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02220AE4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02220AE8 */ Gambit_fn_0221F3AC(cpu);
-        /* 02220AEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02220AF0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220AEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02220AF0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220AF0 */ _t4 = _t3 & 0x00000001u;
         /* 02220AF0 */ if (_t4) goto L_02220AFC; else goto L_02220AF4;
   L_02220AF4: ; // 0x2220af4
@@ -21558,8 +21558,8 @@ void Gambit_fn_02220B14(CPUState* cpu) {
         /* 02220B24 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02220B24 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02220B28 */ Gambit_fn_0221F3AC(cpu);
-        /* 02220B2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02220B30 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220B2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02220B30 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220B30 */ _t4 = _t3 & 0x00000001u;
         /* 02220B30 */ if (_t4) goto L_02220B3C; else goto L_02220B34;
   L_02220B34: ; // 0x2220b34
@@ -21593,8 +21593,8 @@ void Gambit_fn_02220B18(CPUState* cpu) {
         /* 02220B24 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02220B24 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02220B28 */ Gambit_fn_0221F3AC(cpu);
-        /* 02220B2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02220B30 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220B2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02220B30 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220B30 */ _t4 = _t3 & 0x00000001u;
         /* 02220B30 */ if (_t4) goto L_02220B3C; else goto L_02220B34;
   L_02220B34: ; // 0x2220b34
@@ -21639,8 +21639,8 @@ void Gambit_fn_02220B5C(CPUState* cpu) {
         /* 02220B6C */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02220B6C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02220B70 */ Gambit_fn_0221FFF0(cpu);
-        /* 02220B74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02220B78 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220B74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02220B78 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220B78 */ _t4 = _t3 & 0x00000001u;
         /* 02220B78 */ if (_t4) goto L_02220B80; else goto L_02220B7C;
   L_02220B7C: ; // 0x2220b7c
@@ -21670,8 +21670,8 @@ void Gambit_fn_02220B60(CPUState* cpu) {
         /* 02220B6C */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02220B6C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02220B70 */ Gambit_fn_0221FFF0(cpu);
-        /* 02220B74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02220B78 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220B74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02220B78 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220B78 */ _t4 = _t3 & 0x00000001u;
         /* 02220B78 */ if (_t4) goto L_02220B80; else goto L_02220B7C;
   L_02220B7C: ; // 0x2220b7c
@@ -21848,10 +21848,10 @@ void Gambit_fn_02220C34(CPUState* cpu) {
         /* 02220C78 */ cpu->r[0] = rbrew_read32(cpu->mem, _t11);
         /* 02220C7C */ cpu->r[11] = 0x10050000u;
         /* 02220C80 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000000Fu, 0x0000000Fu);
-        /* 02220C80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02220C80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02220C84 */ _t12 = cpu->r[11] + 0xFFFFCA58u;
         /* 02220C84 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t12);
-        /* 02220C88 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220C88 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220C88 */ _t14 = _t13 & 0x00000001u;
         /* 02220C88 */ if (_t14) goto L_02220C8C; else goto L_02220D50;
   L_02220C8C: ; // 0x2220c8c
@@ -21874,26 +21874,26 @@ void Gambit_fn_02220C34(CPUState* cpu) {
         /* 02220CBC */ cpu->r[3] = cpu->r[31];
         /* 02220CC0 */ cpu->r[4] = rbrew_rlwinm(cpu->r[0], 0x0000000Fu, 0x0000001Fu, 0x0000001Fu);
         /* 02220CC4 */ Gambit_fn_02220B14(cpu);
-        /* 02220CC8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[1]);
+        /* 02220CC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[1]));
         /* 02220CCC */ _t19 = cpu->r[31] + 0x00000174u;
         /* 02220CCC */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t19);
-        /* 02220CD0 */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02220CD0 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02220CD0 */ _t21 = _t20 & 0x00000001u;
         /* 02220CD0 */ if (_t21) goto L_02220D0C; else goto L_02220CD4;
   L_02220CD4: ; // 0x2220cd4
-        /* 02220CD4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[28]);
-        /* 02220CD8 */ _t22 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02220CD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[28]));
+        /* 02220CD8 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02220CD8 */ _t23 = _t22 & 0x00000001u;
         /* 02220CD8 */ if (_t23) goto L_02220CDC; else goto L_02220D24;
   L_02220CDC: ; // 0x2220cdc
-        /* 02220CDC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[1]);
-        /* 02220CE0 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02220CDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[1]));
+        /* 02220CE0 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02220CE0 */ _t25 = _t24 & 0x00000001u;
         /* 02220CE0 */ if (_t25) goto L_02220CE4; else goto L_02220D14;
   L_02220CE4: ; // 0x2220ce4
         /* 02220CE4 */ cpu->f[10] = cpu->f[1] - cpu->f[28];
-        /* 02220CE8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[30]);
-        /* 02220CEC */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220CE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[30]));
+        /* 02220CEC */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220CEC */ _t27 = _t26 & 0x00000001u;
         /* 02220CEC */ if (_t27) goto L_02220D04; else goto L_02220CF0;
   L_02220CF0: ; // 0x2220cf0
@@ -21906,16 +21906,16 @@ void Gambit_fn_02220C34(CPUState* cpu) {
         /* 02220D04 */ cpu->f[30] = cpu->f[31];
         /* 02220D08 */ goto L_02220D50;
   L_02220D0C: ; // 0x2220d0c
-        /* 02220D0C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[1]);
-        /* 02220D10 */ _t28 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02220D0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[1]));
+        /* 02220D10 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02220D10 */ _t29 = _t28 & 0x00000001u;
         /* 02220D10 */ if (_t29) goto L_02220D1C; else goto L_02220D14;
   L_02220D14: ; // 0x2220d14
         /* 02220D14 */ cpu->f[30] = cpu->f[29];
         /* 02220D18 */ goto L_02220D50;
   L_02220D1C: ; // 0x2220d1c
-        /* 02220D1C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[28]);
-        /* 02220D20 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02220D1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[28]));
+        /* 02220D20 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02220D20 */ _t31 = _t30 & 0x00000001u;
         /* 02220D20 */ if (_t31) goto L_02220D2C; else goto L_02220D24;
   L_02220D24: ; // 0x2220d24
@@ -21923,8 +21923,8 @@ void Gambit_fn_02220C34(CPUState* cpu) {
         /* 02220D28 */ goto L_02220D50;
   L_02220D2C: ; // 0x2220d2c
         /* 02220D2C */ cpu->f[13] = cpu->f[28] - cpu->f[1];
-        /* 02220D30 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[30]);
-        /* 02220D34 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220D30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[30]));
+        /* 02220D34 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220D34 */ _t33 = _t32 & 0x00000001u;
         /* 02220D34 */ if (_t33) goto L_02220D4C; else goto L_02220D38;
   L_02220D38: ; // 0x2220d38
@@ -21955,7 +21955,7 @@ void Gambit_fn_02220C34(CPUState* cpu) {
         /* 02220D70 */ cpu->r[31] = rbrew_read32(cpu->mem, _t41);
         /* 02220D74 */ _t42 = cpu->r[1] + 0x00000010u;
         /* 02220D74 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t42);
-        /* 02220D78 */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02220D78 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02220D78 */ _t44 = _t43 & 0x00000001u;
         /* 02220D78 */ if (_t44) goto L_02220D7C; // else: addr-0 trap, fall-through
   L_02220D7C: ; // 0x2220d7c
@@ -21981,8 +21981,8 @@ void Gambit_fn_02220D8C(CPUState* cpu) {
         /* 02220D9C */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02220D9C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02220DA0 */ Gambit_fn_0221F3AC(cpu);
-        /* 02220DA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02220DA8 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220DA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02220DA8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220DA8 */ _t4 = _t3 & 0x00000001u;
         /* 02220DA8 */ if (_t4) goto L_02220DB4; else goto L_02220DAC;
   L_02220DAC: ; // 0x2220dac
@@ -22016,8 +22016,8 @@ void Gambit_fn_02220D90(CPUState* cpu) {
         /* 02220D9C */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02220D9C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02220DA0 */ Gambit_fn_0221F3AC(cpu);
-        /* 02220DA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02220DA8 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220DA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02220DA8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220DA8 */ _t4 = _t3 & 0x00000001u;
         /* 02220DA8 */ if (_t4) goto L_02220DB4; else goto L_02220DAC;
   L_02220DAC: ; // 0x2220dac
@@ -22056,8 +22056,8 @@ void Gambit_fn_02220DE8(CPUState* cpu) {
         /* 02220E00 */ Gambit_fn_02220D8C(cpu);
         /* 02220E04 */ _t4 = cpu->r[31] + 0x0000018Cu;
         /* 02220E04 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
-        /* 02220E08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[3]);
-        /* 02220E0C */ _t5 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02220E08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[3]));
+        /* 02220E0C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02220E0C */ _t6 = _t5 & 0x00000001u;
         /* 02220E0C */ if (_t6) goto L_02220E1C; else goto L_02220E10;
   L_02220E10: ; // 0x2220e10
@@ -22106,24 +22106,24 @@ void Gambit_fn_02220E54(CPUState* cpu) {
         /* 02220E88 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t8);
         /* 02220E8C */ _t9 = cpu->r[3] + 0x00000000u;
         /* 02220E8C */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t9);
-        /* 02220E90 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[8]);
+        /* 02220E90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[8]));
         /* 02220E94 */ cpu->f[4] = fma(cpu->f[12], cpu->f[12], cpu->f[0]);
-        /* 02220E98 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02220E98 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02220E98 */ _t11 = _t10 & 0x00000001u;
         /* 02220E98 */ if (_t11) goto L_02220E9C; else goto L_02221160;
   L_02220E9C: ; // 0x2220e9c
         /* 02220E9C */ cpu->r[10] = 0x10050000u;
         /* 02220EA0 */ _t12 = cpu->r[10] + 0xFFFFCAF8u;
         /* 02220EA0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t12);
-        /* 02220EA4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[4], cpu->f[13]);
-        /* 02220EA8 */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02220EA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[4], cpu->f[13]));
+        /* 02220EA8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02220EA8 */ _t14 = _t13 & 0x00000001u;
         /* 02220EA8 */ if (_t14) goto L_02220EB8; else goto L_02220EAC;
   L_02220EAC: ; // 0x2220eac
         /* 02220EAC */ _t15 = cpu->r[30] + 0x0000018Cu;
         /* 02220EAC */ cpu->r[9] = rbrew_read32(cpu->mem, _t15);
-        /* 02220EB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02220EB4 */ _t16 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02220EB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02220EB4 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02220EB4 */ _t17 = _t16 & 0x00000001u;
         /* 02220EB4 */ if (_t17) goto L_02220EB8; else goto L_02221160;
   L_02220EB8: ; // 0x2220eb8
@@ -22131,21 +22131,21 @@ void Gambit_fn_02220E54(CPUState* cpu) {
         /* 02220EB8 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t18);
         /* 02220EBC */ cpu->r[9] = 0x10050000u;
         /* 02220EC0 */ cpu->r[8] = 0x10050000u;
-        /* 02220EC4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[8]);
+        /* 02220EC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[8]));
         /* 02220EC8 */ _t19 = cpu->r[9] + 0xFFFFCA58u;
         /* 02220EC8 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t19);
         /* 02220ECC */ _t20 = cpu->r[8] + 0xFFFFCA98u;
         /* 02220ECC */ cpu->f[5] = rbrew_read_f32(cpu->mem, _t20);
         /* 02220ED0 */ cpu->f[6] = cpu->f[12];
-        /* 02220ED4 */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02220ED4 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02220ED4 */ _t22 = _t21 & 0x00000001u;
         /* 02220ED4 */ if (_t22) goto L_02220EF0; else goto L_02220ED8;
   L_02220ED8: ; // 0x2220ed8
         /* 02220ED8 */ cpu->f[10] = cpu->f[8] - cpu->f[9];
         /* 02220EDC */ cpu->f[7] = cpu->f[11] - cpu->f[9];
         /* 02220EE0 */ cpu->f[6] = cpu->f[10] / cpu->f[7];
-        /* 02220EE4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[5]);
-        /* 02220EE8 */ _t23 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02220EE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[5]));
+        /* 02220EE8 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02220EE8 */ _t24 = _t23 & 0x00000001u;
         /* 02220EE8 */ if (_t24) goto L_02220EEC; else goto L_02220EF0;
   L_02220EEC: ; // 0x2220eec
@@ -22157,8 +22157,8 @@ void Gambit_fn_02220E54(CPUState* cpu) {
         /* 02220EF4 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t26);
         /* 02220EF8 */ cpu->f[11] = cpu->f[10] * cpu->f[10];
         /* 02220EFC */ cpu->f[11] = fma(cpu->f[13], cpu->f[13], cpu->f[11]);
-        /* 02220F00 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[12]);
-        /* 02220F04 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02220F00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[12]));
+        /* 02220F04 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02220F04 */ _t28 = _t27 & 0x00000001u;
         /* 02220F04 */ if (_t28) goto L_02220F24; else goto L_02220F08;
   L_02220F08: ; // 0x2220f08
@@ -22166,9 +22166,9 @@ void Gambit_fn_02220E54(CPUState* cpu) {
         /* 02220F0C */ cpu->f[3] = cpu->f[12] * cpu->f[11];
         /* 02220F10 */ _t29 = cpu->r[10] + 0xFFFFCAFCu;
         /* 02220F10 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t29);
-        /* 02220F14 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[3], cpu->f[9]);
+        /* 02220F14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[3], cpu->f[9]));
         /* 02220F18 */ cpu->f[9] = cpu->f[12];
-        /* 02220F1C */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02220F1C */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02220F1C */ _t31 = _t30 & 0x00000001u;
         /* 02220F1C */ if (_t31) goto L_02220FD0; else goto L_02220F20;
   L_02220F20: ; // 0x2220f20
@@ -22191,21 +22191,21 @@ void Gambit_fn_02220E54(CPUState* cpu) {
         /* 02220F4C */ cpu->f[3] = cpu->f[0] * cpu->f[11];
         /* 02220F50 */ _t36 = cpu->r[10] + 0xFFFFCAFCu;
         /* 02220F50 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t36);
-        /* 02220F54 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[3], cpu->f[9]);
+        /* 02220F54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[3], cpu->f[9]));
         /* 02220F58 */ cpu->f[9] = cpu->f[12];
-        /* 02220F5C */ _t37 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02220F5C */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02220F5C */ _t38 = _t37 & 0x00000001u;
         /* 02220F5C */ if (_t38) goto L_02220FD0; else goto L_02220F60;
   L_02220F60: ; // 0x2220f60
-        /* 02220F60 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[4], cpu->f[12]);
-        /* 02220F64 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02220F60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[4], cpu->f[12]));
+        /* 02220F64 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02220F64 */ _t40 = _t39 & 0x00000001u;
         /* 02220F64 */ if (_t40) goto L_02220F7C; else goto L_02220F68;
   L_02220F68: ; // 0x2220f68
         /* 02220F68 */ cpu->f[8] = -fma(cpu->f[3], cpu->f[3], -(cpu->f[4]));
-        /* 02220F6C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[12]);
+        /* 02220F6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[12]));
         /* 02220F70 */ cpu->f[11] = cpu->f[12] * cpu->f[4];
-        /* 02220F74 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220F74 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220F74 */ _t42 = _t41 & 0x00000001u;
         /* 02220F74 */ if (_t42) goto L_02220FD0; else goto L_02220F78;
   L_02220F78: ; // 0x2220f78
@@ -22225,9 +22225,9 @@ void Gambit_fn_02220E54(CPUState* cpu) {
         /* 02220F98 */ cpu->f[8] = -fma(cpu->f[8], cpu->f[4], -(cpu->f[13]));
         /* 02220F9C */ cpu->f[10] = cpu->f[8] * cpu->f[7];
         /* 02220FA0 */ cpu->f[8] = -fma(cpu->f[3], cpu->f[3], -(cpu->f[4]));
-        /* 02220FA4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[12]);
+        /* 02220FA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[12]));
         /* 02220FA8 */ cpu->f[11] = cpu->f[10] * cpu->f[4];
-        /* 02220FAC */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02220FAC */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02220FAC */ _t48 = _t47 & 0x00000001u;
         /* 02220FAC */ if (_t48) goto L_02220FD0; else goto L_02220FB0;
   L_02220FB0: ; // 0x2220fb0
@@ -22237,8 +22237,8 @@ void Gambit_fn_02220E54(CPUState* cpu) {
         /* 02220FB8 */ cpu->f[13] = cpu->f[11] - cpu->f[3];
         /* 02220FBC */ cpu->f[11] = cpu->f[0] - cpu->f[3];
         /* 02220FC0 */ cpu->f[9] = cpu->f[11] / cpu->f[13];
-        /* 02220FC4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[5]);
-        /* 02220FC8 */ _t50 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02220FC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[5]));
+        /* 02220FC8 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02220FC8 */ _t51 = _t50 & 0x00000001u;
         /* 02220FC8 */ if (_t51) goto L_02220FCC; else goto L_02220FD0;
   L_02220FCC: ; // 0x2220fcc
@@ -22247,10 +22247,10 @@ void Gambit_fn_02220E54(CPUState* cpu) {
         /* 02220FD0 */ _t52 = cpu->r[30] + 0x0000018Cu;
         /* 02220FD0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t52);
         /* 02220FD4 */ cpu->r[10] = cpu->r[8] + 0xFFFFFFFFu;
-        /* 02220FD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02220FD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02220FD8 */ _t53 = cpu->r[30] + 0x000001C8u;
         /* 02220FD8 */ cpu->f[3] = rbrew_read_f32(cpu->mem, _t53);
-        /* 02220FDC */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02220FDC */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02220FDC */ _t55 = _t54 & 0x00000001u;
         /* 02220FDC */ if (_t55) goto L_02220FE4; else goto L_02220FE0;
   L_02220FE0: ; // 0x2220fe0
@@ -22428,8 +22428,8 @@ void Gambit_fn_0222119C(CPUState* cpu) {
         /* 022211AC */ _t3 = cpu->r[31] + 0x000001D4u;
         /* 022211AC */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 022211B0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000000Fu, 0x0000000Fu);
-        /* 022211B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022211B4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022211B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022211B4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022211B4 */ _t5 = _t4 & 0x00000001u;
         /* 022211B4 */ if (_t5) goto L_022211F8; else goto L_022211B8;
   L_022211B8: ; // 0x22211b8
@@ -22438,8 +22438,8 @@ void Gambit_fn_0222119C(CPUState* cpu) {
         /* 022211C0 */ _t6 = cpu->r[31] + 0x000001D4u;
         /* 022211C0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
         /* 022211C4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000000Eu, 0x0000000Eu);
-        /* 022211C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022211C8 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022211C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022211C8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022211C8 */ _t8 = _t7 & 0x00000001u;
         /* 022211C8 */ if (_t8) goto L_022211E0; else goto L_022211CC;
   L_022211CC: ; // 0x22211cc
@@ -22447,8 +22447,8 @@ void Gambit_fn_0222119C(CPUState* cpu) {
         /* 022211CC */ cpu->r[11] = rbrew_read32(cpu->mem, _t9);
         /* 022211D0 */ _t10 = cpu->r[3] + 0x00001050u;
         /* 022211D0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t10);
-        /* 022211D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], cpu->r[0]);
-        /* 022211D8 */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022211D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], cpu->r[0]));
+        /* 022211D8 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022211D8 */ _t12 = _t11 & 0x00000001u;
         /* 022211D8 */ if (_t12) goto L_022211F8; else goto L_022211DC;
   L_022211DC: ; // 0x22211dc
@@ -22458,8 +22458,8 @@ void Gambit_fn_0222119C(CPUState* cpu) {
         /* 022211E0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t13);
         /* 022211E4 */ _t14 = cpu->r[3] + 0x00001590u;
         /* 022211E4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
-        /* 022211E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], cpu->r[0]);
-        /* 022211EC */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022211E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], cpu->r[0]));
+        /* 022211EC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022211EC */ _t16 = _t15 & 0x00000001u;
         /* 022211EC */ if (_t16) goto L_022211F8; else goto L_022211F0;
   L_022211F0: ; // 0x22211f0
@@ -22531,15 +22531,15 @@ void Gambit_fn_02221240(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02221240: ; // 0x2221240
-        /* 02221240 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02221244 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221240 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02221244 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221244 */ _t1 = _t0 & 0x00000001u;
         /* 02221244 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02221244 */ goto L_02221248;
   L_02221248: ; // 0x2221248
         /* 02221248 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02221248 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222124C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221248 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222124C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222124C */ _t3 = _t2 & 0x00000001u;
         /* 0222124C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0222124C */ goto L_02221250;
@@ -22558,8 +22558,8 @@ void Gambit_fn_02221240(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -22573,15 +22573,15 @@ void Gambit_fn_02221240(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -22615,15 +22615,15 @@ void Gambit_fn_02221258(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02221258: ; // 0x2221258
-        /* 02221258 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222125C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221258 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222125C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222125C */ _t1 = _t0 & 0x00000001u;
         /* 0222125C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0222125C */ goto L_02221260;
   L_02221260: ; // 0x2221260
         /* 02221260 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02221260 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02221264 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221260 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02221264 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221264 */ _t3 = _t2 & 0x00000001u;
         /* 02221264 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02221264 */ goto L_02221268;
@@ -22642,8 +22642,8 @@ void Gambit_fn_02221258(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -22657,15 +22657,15 @@ void Gambit_fn_02221258(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -22711,15 +22711,15 @@ void Gambit_fn_02221288(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02221288: ; // 0x2221288
-        /* 02221288 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222128C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221288 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222128C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222128C */ _t1 = _t0 & 0x00000001u;
         /* 0222128C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0222128C */ goto L_02221290;
   L_02221290: ; // 0x2221290
         /* 02221290 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02221290 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02221294 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221290 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02221294 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221294 */ _t3 = _t2 & 0x00000001u;
         /* 02221294 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02221294 */ goto L_02221298;
@@ -22738,8 +22738,8 @@ void Gambit_fn_02221288(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -22753,15 +22753,15 @@ void Gambit_fn_02221288(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -22789,15 +22789,15 @@ void Gambit_fn_0222129C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0222129C: ; // 0x222129c
-        /* 0222129C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022212A0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222129C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022212A0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022212A0 */ _t1 = _t0 & 0x00000001u;
         /* 022212A0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022212A0 */ goto L_022212A4;
   L_022212A4: ; // 0x22212a4
         /* 022212A4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022212A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022212A8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022212A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022212A8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022212A8 */ _t3 = _t2 & 0x00000001u;
         /* 022212A8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022212A8 */ goto L_022212AC;
@@ -22816,8 +22816,8 @@ void Gambit_fn_0222129C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -22831,15 +22831,15 @@ void Gambit_fn_0222129C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -22918,8 +22918,8 @@ void Gambit_fn_022212D0(CPUState* cpu) {
         /* 022212D0 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 022212D0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 022212D4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 022212D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022212D8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022212D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022212D8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022212D8 */ _t2 = _t1 & 0x00000001u;
         /* 022212D8 */ _t3 = _t2 ^ 0x00000001u;
         /* 022212D8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -22941,8 +22941,8 @@ void Gambit_fn_022212EC(CPUState* cpu) {
         /* 022212EC */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 022212EC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 022212F0 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 022212F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022212F4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022212F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022212F4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022212F4 */ _t2 = _t1 & 0x00000001u;
         /* 022212F4 */ _t3 = _t2 ^ 0x00000001u;
         /* 022212F4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -22964,8 +22964,8 @@ void Gambit_fn_02221308(CPUState* cpu) {
         /* 02221308 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02221308 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0222130C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 0222130C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02221310 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222130C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02221310 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221310 */ _t2 = _t1 & 0x00000001u;
         /* 02221310 */ _t3 = _t2 ^ 0x00000001u;
         /* 02221310 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -23008,8 +23008,8 @@ void Gambit_fn_02221334(CPUState* cpu) {
         /* 02221344 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02221348 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02221348 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0222134C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02221350 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222134C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02221350 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221350 */ _t5 = _t4 & 0x00000001u;
         /* 02221350 */ if (_t5) goto L_02221354; else goto L_02221370;
   L_02221354: ; // 0x2221354
@@ -23048,8 +23048,8 @@ void Gambit_fn_02221338(CPUState* cpu) {
         /* 02221344 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02221348 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02221348 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0222134C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02221350 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222134C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02221350 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221350 */ _t5 = _t4 & 0x00000001u;
         /* 02221350 */ if (_t5) goto L_02221354; else goto L_02221370;
   L_02221354: ; // 0x2221354
@@ -23510,8 +23510,8 @@ void Gambit_fn_02221548(CPUState* cpu) {
         /* 02221548 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 02221548 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0222154C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0222154C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02221550 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222154C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02221550 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221550 */ _t2 = _t1 & 0x00000001u;
         /* 02221550 */ if (_t2) goto L_02221560; else goto L_02221554;
   L_02221554: ; // 0x2221554
@@ -23540,8 +23540,8 @@ void Gambit_fn_0222156C(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -23654,9 +23654,9 @@ void Gambit_fn_022215C8(CPUState* cpu) {
         /* 022215CC */ _t0 = cpu->r[8] + 0xFFFFFC4Cu;
         /* 022215CC */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 022215D0 */ cpu->r[6] = 0x101D0000u;
-        /* 022215D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 022215D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 022215D8 */ cpu->r[6] = cpu->r[6] + 0xFFFFFD90u;
-        /* 022215DC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022215DC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022215DC */ _t2 = _t1 & 0x00000001u;
         /* 022215DC */ if (_t2) goto L_022215E0; else goto L_022215F8;
   L_022215E0: ; // 0x22215e0
@@ -23669,8 +23669,8 @@ void Gambit_fn_022215C8(CPUState* cpu) {
         /* 022215F4 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 022215F4 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_022215F8: ; // 0x22215f8
-        /* 022215F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 022215FC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022215F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 022215FC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022215FC */ _t6 = _t5 & 0x00000001u;
         /* 022215FC */ if (_t6) goto L_02221600; else goto L_02221608;
   L_02221600: ; // 0x2221600
@@ -23681,9 +23681,9 @@ void Gambit_fn_022215C8(CPUState* cpu) {
         /* 0222160C */ _t7 = cpu->r[10] + 0xFFFFDA0Cu;
         /* 0222160C */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 02221610 */ cpu->r[8] = 0x101D0000u;
-        /* 02221614 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02221614 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02221618 */ cpu->r[8] = cpu->r[8] + 0xFFFFFC00u;
-        /* 0222161C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222161C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222161C */ _t9 = _t8 & 0x00000001u;
         /* 0222161C */ if (_t9) goto L_02221620; else goto L_02221638;
   L_02221620: ; // 0x2221620
@@ -23696,8 +23696,8 @@ void Gambit_fn_022215C8(CPUState* cpu) {
         /* 02221634 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 02221634 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_02221638: ; // 0x2221638
-        /* 02221638 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 0222163C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221638 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 0222163C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222163C */ _t13 = _t12 & 0x00000001u;
         /* 0222163C */ if (_t13) goto L_02221640; else goto L_02221648;
   L_02221640: ; // 0x2221640
@@ -23708,9 +23708,9 @@ void Gambit_fn_022215C8(CPUState* cpu) {
         /* 0222164C */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 0222164C */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 02221650 */ cpu->r[10] = 0x101D0000u;
-        /* 02221654 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02221654 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02221658 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 0222165C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222165C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222165C */ _t16 = _t15 & 0x00000001u;
         /* 0222165C */ if (_t16) goto L_02221660; else goto L_02221678;
   L_02221660: ; // 0x2221660
@@ -23723,8 +23723,8 @@ void Gambit_fn_022215C8(CPUState* cpu) {
         /* 02221674 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 02221674 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_02221678: ; // 0x2221678
-        /* 02221678 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0222167C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221678 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0222167C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222167C */ _t20 = _t19 & 0x00000001u;
         /* 0222167C */ if (_t20) goto L_02221680; else goto L_02221688;
   L_02221680: ; // 0x2221680
@@ -23735,9 +23735,9 @@ void Gambit_fn_022215C8(CPUState* cpu) {
         /* 0222168C */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 0222168C */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 02221690 */ cpu->r[12] = 0x101D0000u;
-        /* 02221694 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02221694 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02221698 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 0222169C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222169C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222169C */ _t23 = _t22 & 0x00000001u;
         /* 0222169C */ if (_t23) goto L_022216A0; else goto L_022216B8;
   L_022216A0: ; // 0x22216a0
@@ -23750,8 +23750,8 @@ void Gambit_fn_022215C8(CPUState* cpu) {
         /* 022216B4 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 022216B4 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_022216B8: ; // 0x22216b8
-        /* 022216B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 022216BC */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022216B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 022216BC */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022216BC */ _t27 = _t26 & 0x00000001u;
         /* 022216BC */ if (_t27) goto L_022216C0; else goto L_022216C8;
   L_022216C0: ; // 0x22216c0
@@ -23763,9 +23763,9 @@ void Gambit_fn_022215C8(CPUState* cpu) {
         /* 022216CC */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 022216CC */ cpu->r[10] = _t28;
         /* 022216D0 */ cpu->r[7] = 0x101D0000u;
-        /* 022216D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 022216D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 022216D8 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 022216DC */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022216DC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022216DC */ _t30 = _t29 & 0x00000001u;
         /* 022216DC */ if (_t30) goto L_022216E0; else goto L_022216F4;
   L_022216E0: ; // 0x22216e0
@@ -23777,8 +23777,8 @@ void Gambit_fn_022215C8(CPUState* cpu) {
         /* 022216F0 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 022216F0 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_022216F4: ; // 0x22216f4
-        /* 022216F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 022216F8 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022216F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 022216F8 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022216F8 */ _t34 = _t33 & 0x00000001u;
         /* 022216F8 */ if (_t34) goto L_022216FC; else goto L_02221704;
   L_022216FC: ; // 0x22216fc
@@ -23790,9 +23790,9 @@ void Gambit_fn_022215C8(CPUState* cpu) {
         /* 02221708 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 02221708 */ cpu->r[8] = _t35;
         /* 0222170C */ cpu->r[6] = 0x101D0000u;
-        /* 02221710 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02221710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02221714 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 02221718 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221718 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221718 */ _t37 = _t36 & 0x00000001u;
         /* 02221718 */ if (_t37) goto L_0222171C; else goto L_02221730;
   L_0222171C: ; // 0x222171c
@@ -23908,9 +23908,9 @@ void Gambit_fn_022217AC(CPUState* cpu) {
         /* 022217B0 */ _t0 = cpu->r[9] + 0xFFFFFC54u;
         /* 022217B0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t0);
         /* 022217B4 */ cpu->r[10] = 0x101D0000u;
-        /* 022217B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 022217B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 022217BC */ cpu->r[10] = cpu->r[10] + 0xFFFFFF5Cu;
-        /* 022217C0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022217C0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022217C0 */ _t2 = _t1 & 0x00000001u;
         /* 022217C0 */ if (_t2) goto L_022217C4; else goto L_022217DC;
   L_022217C4: ; // 0x22217c4
@@ -23923,8 +23923,8 @@ void Gambit_fn_022217AC(CPUState* cpu) {
         /* 022217D8 */ _t4 = cpu->r[10] + 0x00000000u;
         /* 022217D8 */ rbrew_write32(cpu->mem, _t4, cpu->r[12]);
   L_022217DC: ; // 0x22217dc
-        /* 022217DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 022217E0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022217DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 022217E0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022217E0 */ _t6 = _t5 & 0x00000001u;
         /* 022217E0 */ if (_t6) goto L_022217E4; else goto L_022217EC;
   L_022217E4: ; // 0x22217e4
@@ -23935,9 +23935,9 @@ void Gambit_fn_022217AC(CPUState* cpu) {
         /* 022217F0 */ _t7 = cpu->r[11] + 0xFFFFE61Cu;
         /* 022217F0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t7);
         /* 022217F4 */ cpu->r[12] = 0x101D0000u;
-        /* 022217F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 022217F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 022217FC */ cpu->r[12] = cpu->r[12] + 0xFFFFFC08u;
-        /* 02221800 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221800 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221800 */ _t9 = _t8 & 0x00000001u;
         /* 02221800 */ if (_t9) goto L_02221804; else goto L_0222181C;
   L_02221804: ; // 0x2221804
@@ -23950,8 +23950,8 @@ void Gambit_fn_022217AC(CPUState* cpu) {
         /* 02221818 */ _t11 = cpu->r[12] + 0x00000000u;
         /* 02221818 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_0222181C: ; // 0x222181c
-        /* 0222181C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02221820 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222181C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02221820 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221820 */ _t13 = _t12 & 0x00000001u;
         /* 02221820 */ if (_t13) goto L_02221824; else goto L_0222182C;
   L_02221824: ; // 0x2221824
@@ -23962,9 +23962,9 @@ void Gambit_fn_022217AC(CPUState* cpu) {
         /* 02221830 */ _t14 = cpu->r[10] + 0xFFFFE618u;
         /* 02221830 */ cpu->r[10] = rbrew_read32(cpu->mem, _t14);
         /* 02221834 */ cpu->r[9] = 0x101D0000u;
-        /* 02221838 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02221838 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0222183C */ cpu->r[9] = cpu->r[9] + 0xFFFFFC04u;
-        /* 02221840 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221840 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221840 */ _t16 = _t15 & 0x00000001u;
         /* 02221840 */ if (_t16) goto L_02221844; else goto L_0222185C;
   L_02221844: ; // 0x2221844
@@ -23977,8 +23977,8 @@ void Gambit_fn_022217AC(CPUState* cpu) {
         /* 02221858 */ _t18 = cpu->r[9] + 0x00000000u;
         /* 02221858 */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_0222185C: ; // 0x222185c
-        /* 0222185C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 02221860 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222185C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 02221860 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221860 */ _t20 = _t19 & 0x00000001u;
         /* 02221860 */ if (_t20) goto L_02221864; else goto L_0222186C;
   L_02221864: ; // 0x2221864
@@ -23989,9 +23989,9 @@ void Gambit_fn_022217AC(CPUState* cpu) {
         /* 02221870 */ _t21 = cpu->r[9] + 0xFFFFDA0Cu;
         /* 02221870 */ cpu->r[9] = rbrew_read32(cpu->mem, _t21);
         /* 02221874 */ cpu->r[12] = 0x101D0000u;
-        /* 02221878 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02221878 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0222187C */ cpu->r[12] = cpu->r[12] + 0xFFFFFC00u;
-        /* 02221880 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221880 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221880 */ _t23 = _t22 & 0x00000001u;
         /* 02221880 */ if (_t23) goto L_02221884; else goto L_0222189C;
   L_02221884: ; // 0x2221884
@@ -24004,8 +24004,8 @@ void Gambit_fn_022217AC(CPUState* cpu) {
         /* 02221898 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 02221898 */ rbrew_write32(cpu->mem, _t25, cpu->r[9]);
   L_0222189C: ; // 0x222189c
-        /* 0222189C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 022218A0 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222189C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 022218A0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022218A0 */ _t27 = _t26 & 0x00000001u;
         /* 022218A0 */ if (_t27) goto L_022218A4; else goto L_022218AC;
   L_022218A4: ; // 0x22218a4
@@ -24016,9 +24016,9 @@ void Gambit_fn_022217AC(CPUState* cpu) {
         /* 022218B0 */ _t28 = cpu->r[12] + 0xFFFFDA00u;
         /* 022218B0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t28);
         /* 022218B4 */ cpu->r[9] = 0x101D0000u;
-        /* 022218B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 022218B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 022218BC */ cpu->r[9] = cpu->r[9] + 0xFFFFFBFCu;
-        /* 022218C0 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022218C0 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022218C0 */ _t30 = _t29 & 0x00000001u;
         /* 022218C0 */ if (_t30) goto L_022218C4; else goto L_022218DC;
   L_022218C4: ; // 0x22218c4
@@ -24031,8 +24031,8 @@ void Gambit_fn_022217AC(CPUState* cpu) {
         /* 022218D8 */ _t32 = cpu->r[9] + 0x00000000u;
         /* 022218D8 */ rbrew_write32(cpu->mem, _t32, cpu->r[12]);
   L_022218DC: ; // 0x22218dc
-        /* 022218DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 022218E0 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022218DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 022218E0 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022218E0 */ _t34 = _t33 & 0x00000001u;
         /* 022218E0 */ if (_t34) goto L_022218E4; else goto L_022218EC;
   L_022218E4: ; // 0x22218e4
@@ -24043,9 +24043,9 @@ void Gambit_fn_022217AC(CPUState* cpu) {
         /* 022218F0 */ _t35 = cpu->r[12] + 0xFFFFD9ECu;
         /* 022218F0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t35);
         /* 022218F4 */ cpu->r[11] = 0x101D0000u;
-        /* 022218F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 022218F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 022218FC */ cpu->r[11] = cpu->r[11] + 0xFFFFFB4Cu;
-        /* 02221900 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221900 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221900 */ _t37 = _t36 & 0x00000001u;
         /* 02221900 */ if (_t37) goto L_02221904; else goto L_0222191C;
   L_02221904: ; // 0x2221904
@@ -24058,8 +24058,8 @@ void Gambit_fn_022217AC(CPUState* cpu) {
         /* 02221918 */ _t39 = cpu->r[11] + 0x00000000u;
         /* 02221918 */ rbrew_write32(cpu->mem, _t39, cpu->r[0]);
   L_0222191C: ; // 0x222191c
-        /* 0222191C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 02221920 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222191C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 02221920 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221920 */ _t41 = _t40 & 0x00000001u;
         /* 02221920 */ if (_t41) goto L_02221924; else goto L_0222192C;
   L_02221924: ; // 0x2221924
@@ -24071,9 +24071,9 @@ void Gambit_fn_022217AC(CPUState* cpu) {
         /* 02221930 */ cpu->r[9] = rbrew_read32(cpu->mem, _t42);
         /* 02221930 */ cpu->r[10] = _t42;
         /* 02221934 */ cpu->r[12] = 0x101D0000u;
-        /* 02221938 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02221938 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0222193C */ cpu->r[12] = cpu->r[12] + 0xFFFFD4ECu;
-        /* 02221940 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221940 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221940 */ _t44 = _t43 & 0x00000001u;
         /* 02221940 */ if (_t44) goto L_02221944; else goto L_02221958;
   L_02221944: ; // 0x2221944
@@ -24085,8 +24085,8 @@ void Gambit_fn_022217AC(CPUState* cpu) {
         /* 02221954 */ _t46 = cpu->r[12] + 0x00000000u;
         /* 02221954 */ rbrew_write32(cpu->mem, _t46, cpu->r[0]);
   L_02221958: ; // 0x2221958
-        /* 02221958 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0222195C */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221958 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0222195C */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222195C */ _t48 = _t47 & 0x00000001u;
         /* 0222195C */ if (_t48) goto L_02221960; else goto L_02221968;
   L_02221960: ; // 0x2221960
@@ -24098,9 +24098,9 @@ void Gambit_fn_022217AC(CPUState* cpu) {
         /* 0222196C */ cpu->r[0] = rbrew_read32(cpu->mem, _t49);
         /* 0222196C */ cpu->r[9] = _t49;
         /* 02221970 */ cpu->r[10] = 0x101D0000u;
-        /* 02221974 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02221974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02221978 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4E4u;
-        /* 0222197C */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222197C */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222197C */ _t51 = _t50 & 0x00000001u;
         /* 0222197C */ if (_t51) goto L_02221980; else goto L_02221994;
   L_02221980: ; // 0x2221980
@@ -24144,10 +24144,10 @@ void Gambit_fn_022219B0(CPUState* cpu) {
         /* 022219D0 */ cpu->r[31] = 0x101D0000u;
         /* 022219D4 */ _t3 = cpu->r[28] + 0x0000001Cu;
         /* 022219D4 */ rbrew_write32(cpu->mem, _t3, cpu->r[4]);
-        /* 022219D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 022219D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 022219DC */ _t4 = cpu->r[28] + 0x0000000Fu;
         /* 022219DC */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[27]);
-        /* 022219E0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022219E0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022219E0 */ _t6 = _t5 & 0x00000001u;
         /* 022219E0 */ if (_t6) goto L_02221A24; else goto L_022219E4;
   L_022219E4: ; // 0x22219e4
@@ -24162,16 +24162,16 @@ void Gambit_fn_022219B0(CPUState* cpu) {
         /* 022219F8 */ cpu->r[5] = 0x00000004u;
         /* 022219FC */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 02221A00 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02221A04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02221A04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02221A08 */ cpu->r[0] = cpu->r[27];
-        /* 02221A0C */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02221A0C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02221A0C */ _t11 = _t10 & 0x00000001u;
         /* 02221A0C */ if (_t11) goto L_02221A14; else goto L_02221A10;
   L_02221A10: ; // 0x2221a10
         /* 02221A10 */ cpu->r[0] = 0x00000001u;
   L_02221A14: ; // 0x2221a14
-        /* 02221A14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02221A18 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221A14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02221A18 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221A18 */ _t13 = _t12 & 0x00000001u;
         /* 02221A18 */ if (_t13) goto L_02221A24; else goto L_02221A1C;
   L_02221A1C: ; // 0x2221a1c
@@ -24183,9 +24183,9 @@ void Gambit_fn_022219B0(CPUState* cpu) {
         /* 02221A24 */ _t16 = cpu->r[28] + 0x00000020u;
         /* 02221A24 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 02221A28 */ cpu->r[0] = 0x00000000u;
-        /* 02221A2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02221A2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02221A30 */ cpu->r[12] = cpu->r[0];
-        /* 02221A34 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02221A34 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02221A34 */ _t18 = _t17 & 0x00000001u;
         /* 02221A34 */ if (_t18) goto L_02221A38; else goto L_02221A5C;
   L_02221A38: ; // 0x2221a38
@@ -24210,8 +24210,8 @@ void Gambit_fn_022219B0(CPUState* cpu) {
   L_02221A5C: ; // 0x2221a5c
         /* 02221A5C */ _t26 = cpu->r[28] + 0x0000000Fu;
         /* 02221A5C */ cpu->r[27] = rbrew_read8(cpu->mem, _t26);
-        /* 02221A60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 02221A64 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221A60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 02221A64 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221A64 */ _t28 = _t27 & 0x00000001u;
         /* 02221A64 */ if (_t28) goto L_02221AA8; else goto L_02221A68;
   L_02221A68: ; // 0x2221a68
@@ -24226,16 +24226,16 @@ void Gambit_fn_022219B0(CPUState* cpu) {
         /* 02221A7C */ cpu->r[5] = 0x00000004u;
         /* 02221A80 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 02221A84 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02221A88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02221A88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02221A8C */ cpu->r[11] = cpu->r[27];
-        /* 02221A90 */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02221A90 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02221A90 */ _t33 = _t32 & 0x00000001u;
         /* 02221A90 */ if (_t33) goto L_02221A98; else goto L_02221A94;
   L_02221A94: ; // 0x2221a94
         /* 02221A94 */ cpu->r[11] = 0x00000001u;
   L_02221A98: ; // 0x2221a98
-        /* 02221A98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02221A9C */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221A98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02221A9C */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221A9C */ _t35 = _t34 & 0x00000001u;
         /* 02221A9C */ if (_t35) goto L_02221AA8; else goto L_02221AA0;
   L_02221AA0: ; // 0x2221aa0
@@ -24247,9 +24247,9 @@ void Gambit_fn_022219B0(CPUState* cpu) {
         /* 02221AA8 */ _t38 = cpu->r[28] + 0x00000028u;
         /* 02221AA8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 02221AAC */ cpu->r[0] = 0x00000000u;
-        /* 02221AB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02221AB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 02221AB4 */ cpu->r[12] = cpu->r[0];
-        /* 02221AB8 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02221AB8 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02221AB8 */ _t40 = _t39 & 0x00000001u;
         /* 02221AB8 */ if (_t40) goto L_02221ABC; else goto L_02221AE0;
   L_02221ABC: ; // 0x2221abc
@@ -24274,8 +24274,8 @@ void Gambit_fn_022219B0(CPUState* cpu) {
   L_02221AE0: ; // 0x2221ae0
         /* 02221AE0 */ _t48 = cpu->r[28] + 0x0000000Fu;
         /* 02221AE0 */ cpu->r[27] = rbrew_read8(cpu->mem, _t48);
-        /* 02221AE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 02221AE8 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221AE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 02221AE8 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221AE8 */ _t50 = _t49 & 0x00000001u;
         /* 02221AE8 */ if (_t50) goto L_02221B2C; else goto L_02221AEC;
   L_02221AEC: ; // 0x2221aec
@@ -24290,16 +24290,16 @@ void Gambit_fn_022219B0(CPUState* cpu) {
         /* 02221B00 */ cpu->r[5] = 0x00000004u;
         /* 02221B04 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 02221B08 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02221B0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02221B0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02221B10 */ cpu->r[10] = cpu->r[27];
-        /* 02221B14 */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02221B14 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02221B14 */ _t55 = _t54 & 0x00000001u;
         /* 02221B14 */ if (_t55) goto L_02221B1C; else goto L_02221B18;
   L_02221B18: ; // 0x2221b18
         /* 02221B18 */ cpu->r[10] = 0x00000001u;
   L_02221B1C: ; // 0x2221b1c
-        /* 02221B1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02221B20 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221B1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02221B20 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221B20 */ _t57 = _t56 & 0x00000001u;
         /* 02221B20 */ if (_t57) goto L_02221B2C; else goto L_02221B24;
   L_02221B24: ; // 0x2221b24
@@ -24311,9 +24311,9 @@ void Gambit_fn_022219B0(CPUState* cpu) {
         /* 02221B2C */ _t60 = cpu->r[28] + 0x00000030u;
         /* 02221B2C */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
         /* 02221B30 */ cpu->r[0] = 0x00000000u;
-        /* 02221B34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02221B34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02221B38 */ cpu->r[5] = cpu->r[0];
-        /* 02221B3C */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02221B3C */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02221B3C */ _t62 = _t61 & 0x00000001u;
         /* 02221B3C */ if (_t62) goto L_02221B40; else goto L_02221B64;
   L_02221B40: ; // 0x2221b40
@@ -24338,8 +24338,8 @@ void Gambit_fn_022219B0(CPUState* cpu) {
   L_02221B64: ; // 0x2221b64
         /* 02221B64 */ _t70 = cpu->r[30] + 0x00000000u;
         /* 02221B64 */ cpu->r[25] = rbrew_read8(cpu->mem, _t70);
-        /* 02221B68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 02221B6C */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221B68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 02221B6C */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221B6C */ _t72 = _t71 & 0x00000001u;
         /* 02221B6C */ if (_t72) goto L_02221C48; else goto L_02221B70;
   L_02221B70: ; // 0x2221b70
@@ -24355,10 +24355,10 @@ void Gambit_fn_022219B0(CPUState* cpu) {
         /* 02221B88 */ cpu->r[4] = (uint32_t)((int32_t)cpu->r[25] * (int32_t)0x00000024u);
         /* 02221B8C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02221B90 */ cpu->r[24] = cpu->r[3];
-        /* 02221B94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 02221B94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 02221B98 */ cpu->r[30] = cpu->r[25];
         /* 02221B9C */ cpu->r[7] = 0x00000000u;
-        /* 02221BA0 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02221BA0 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02221BA0 */ _t77 = _t76 & 0x00000001u;
         /* 02221BA0 */ if (_t77) goto L_02221BA8; else goto L_02221BA4;
   L_02221BA4: ; // 0x2221ba4
@@ -24371,36 +24371,36 @@ void Gambit_fn_022219B0(CPUState* cpu) {
         /* 02221BB4 */ cpu->r[23] = 0x00000018u;
   L_02221BB8: ; // 0x2221bb8
         /* 02221BB8 */ cpu->r[27] = cpu->r[24] + cpu->r[22];
-        /* 02221BB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 02221BBC */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221BB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 02221BBC */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221BBC */ _t80 = _t79 & 0x00000001u;
         /* 02221BBC */ if (_t80) goto L_02221C2C; else goto L_02221BC0;
   L_02221BC0: ; // 0x2221bc0
         /* 02221BC0 */ cpu->r[26] = cpu->r[27];
-        /* 02221BC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 02221BC4 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221BC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 02221BC4 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221BC4 */ _t82 = _t81 & 0x00000001u;
         /* 02221BC4 */ if (_t82) goto L_02221BC8; else goto L_02221BD8;
   L_02221BC8: ; // 0x2221bc8
         /* 02221BC8 */ cpu->r[3] = 0x00000024u;
         /* 02221BCC */ Gambit_fn_02801A78(cpu);
         /* 02221BD0 */ cpu->r[26] = cpu->r[3];
-        /* 02221BD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 02221BD4 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221BD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 02221BD4 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221BD4 */ _t84 = _t83 & 0x00000001u;
         /* 02221BD4 */ if (_t84) goto L_02221C20; else goto L_02221BD8;
   L_02221BD8: ; // 0x2221bd8
         /* 02221BD8 */ cpu->r[11] = cpu->r[26];
-        /* 02221BD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02221BDC */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221BD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02221BDC */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221BDC */ _t86 = _t85 & 0x00000001u;
         /* 02221BDC */ if (_t86) goto L_02221BE0; else goto L_02221BF0;
   L_02221BE0: ; // 0x2221be0
         /* 02221BE0 */ cpu->r[3] = 0x0000000Cu;
         /* 02221BE4 */ Gambit_fn_02801A78(cpu);
         /* 02221BE8 */ cpu->r[11] = cpu->r[3];
-        /* 02221BE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02221BEC */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221BE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02221BEC */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221BEC */ _t88 = _t87 & 0x00000001u;
         /* 02221BEC */ if (_t88) goto L_02221C0C; else goto L_02221BF0;
   L_02221BF0: ; // 0x2221bf0
@@ -24431,14 +24431,14 @@ void Gambit_fn_022219B0(CPUState* cpu) {
         /* 02221C28 */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
   L_02221C2C: ; // 0x2221c2c
         /* 02221C2C */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 02221C2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02221C2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02221C30 */ cpu->r[22] = cpu->r[22] + 0x00000024u;
-        /* 02221C34 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221C34 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221C34 */ _t98 = _t97 & 0x00000001u;
         /* 02221C34 */ if (_t98) goto L_02221C38; else goto L_02221BB8;
   L_02221C38: ; // 0x2221c38
-        /* 02221C38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 02221C3C */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221C38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 02221C3C */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221C3C */ _t100 = _t99 & 0x00000001u;
         /* 02221C3C */ if (_t100) goto L_02221C48; else goto L_02221C40;
   L_02221C40: ; // 0x2221c40
@@ -24468,10 +24468,10 @@ void Gambit_fn_02221C60(CPUState* cpu) {
         /* 02221C64 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 02221C68 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 02221C68 */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 02221C6C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[12]);
+        /* 02221C6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[12]));
         /* 02221C70 */ _t3 = cpu->r[4] + 0x00000000u;
         /* 02221C70 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 02221C74 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02221C74 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02221C74 */ _t5 = _t4 & 0x00000001u;
         /* 02221C74 */ if (_t5) goto L_02221C78; else goto L_02221C80;
   L_02221C78: ; // 0x2221c78
@@ -24488,10 +24488,10 @@ void Gambit_fn_02221C60(CPUState* cpu) {
         /* 02221C8C */ cpu->r[9] = rbrew_read8(cpu->mem, _t9);
         /* 02221C90 */ _t10 = cpu->r[3] + 0x00000028u;
         /* 02221C90 */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 02221C94 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
+        /* 02221C94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
         /* 02221C98 */ _t11 = cpu->r[3] + 0x0000002Cu;
         /* 02221C98 */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
-        /* 02221C9C */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02221C9C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02221C9C */ _t13 = _t12 & 0x00000001u;
         /* 02221C9C */ if (_t13) goto L_02221CA0; else goto L_02221CA8;
   L_02221CA0: ; // 0x2221ca0
@@ -24512,10 +24512,10 @@ void Gambit_fn_02221C60(CPUState* cpu) {
         /* 02221CBC */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
         /* 02221CC0 */ _t20 = cpu->r[3] + 0x00000034u;
         /* 02221CC0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 02221CC4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
+        /* 02221CC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
         /* 02221CC8 */ _t21 = cpu->r[6] + 0x00000000u;
         /* 02221CC8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
-        /* 02221CCC */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02221CCC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02221CCC */ _t23 = _t22 & 0x00000001u;
         /* 02221CCC */ if (_t23) goto L_02221CD0; else goto L_02221CD8;
   L_02221CD0: ; // 0x2221cd0
@@ -24542,10 +24542,10 @@ void Gambit_fn_02221CE8(CPUState* cpu) {
         /* 02221CF0 */ _t1 = cpu->r[3] + 0x00000028u;
         /* 02221CF0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 02221CF4 */ cpu->r[8] = cpu->r[0];
-        /* 02221CF8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 02221CF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 02221CFC */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 02221CFC */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 02221D00 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02221D00 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02221D00 */ _t4 = _t3 & 0x00000001u;
         /* 02221D00 */ if (_t4) goto L_02221D04; else goto L_02221D1C;
   L_02221D04: ; // 0x2221d04
@@ -24553,8 +24553,8 @@ void Gambit_fn_02221CE8(CPUState* cpu) {
         /* 02221D08 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 02221D0C */ _t5 = cpu->r[9] + 0x00000002u;
         /* 02221D0C */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 02221D10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02221D14 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221D10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02221D14 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221D14 */ _t7 = _t6 & 0x00000001u;
         /* 02221D14 */ if (_t7) goto L_02221D18; else goto L_02221D28;
   L_02221D18: ; // 0x2221d18
@@ -24562,16 +24562,16 @@ void Gambit_fn_02221CE8(CPUState* cpu) {
   L_02221D1C: ; // 0x2221d1c
         /* 02221D1C */ _t8 = cpu->r[12] + 0x00000002u;
         /* 02221D1C */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 02221D20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02221D24 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221D20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02221D24 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221D24 */ _t10 = _t9 & 0x00000001u;
         /* 02221D24 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02221D24 */ goto L_02221D28;
   L_02221D28: ; // 0x2221d28
-        /* 02221D28 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 02221D28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 02221D2C */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 02221D2C */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 02221D30 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02221D30 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02221D30 */ _t13 = _t12 & 0x00000001u;
         /* 02221D30 */ if (_t13) goto L_02221D34; else goto L_02221D3C;
   L_02221D34: ; // 0x2221d34
@@ -24582,11 +24582,11 @@ void Gambit_fn_02221CE8(CPUState* cpu) {
         /* 02221D3C */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 02221D40 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 02221D40 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 02221D44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02221D44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02221D48 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 02221D48 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 02221D4C */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 02221D50 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02221D50 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02221D50 */ _t18 = _t17 & 0x00000001u;
         /* 02221D50 */ if (_t18) goto L_02221D68; else goto L_02221D54;
   L_02221D54: ; // 0x2221d54
@@ -24619,18 +24619,18 @@ void Gambit_fn_02221D70(CPUState* cpu) {
         /* 02221D84 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02221D84 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02221D88 */ cpu->r[12] = 0x00000000u;
-        /* 02221D8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02221D8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02221D90 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 02221D90 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02221D94 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221D94 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221D94 */ _t6 = _t5 & 0x00000001u;
         /* 02221D94 */ if (_t6) goto L_02221DBC; else goto L_02221D98;
   L_02221D98: ; // 0x2221d98
         /* 02221D98 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02221D98 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02221D9C */ /* nop */
-        /* 02221DA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 02221DA4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221DA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 02221DA4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221DA4 */ _t9 = _t8 & 0x00000001u;
         /* 02221DA4 */ if (_t9) goto L_02221DA8; else goto L_02221DBC;
   L_02221DA8: ; // 0x2221da8
@@ -24671,18 +24671,18 @@ void Gambit_fn_02221D74(CPUState* cpu) {
         /* 02221D84 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02221D84 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02221D88 */ cpu->r[12] = 0x00000000u;
-        /* 02221D8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02221D8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02221D90 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 02221D90 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02221D94 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221D94 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221D94 */ _t6 = _t5 & 0x00000001u;
         /* 02221D94 */ if (_t6) goto L_02221DBC; else goto L_02221D98;
   L_02221D98: ; // 0x2221d98
         /* 02221D98 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02221D98 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02221D9C */ /* nop */
-        /* 02221DA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 02221DA4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221DA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 02221DA4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221DA4 */ _t9 = _t8 & 0x00000001u;
         /* 02221DA4 */ if (_t9) goto L_02221DA8; else goto L_02221DBC;
   L_02221DA8: ; // 0x2221da8
@@ -24718,10 +24718,10 @@ void Gambit_fn_02221DE0(CPUState* cpu) {
         /* 02221DE8 */ _t1 = cpu->r[3] + 0x00000020u;
         /* 02221DE8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 02221DEC */ cpu->r[8] = cpu->r[0];
-        /* 02221DF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 02221DF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 02221DF4 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 02221DF4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 02221DF8 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02221DF8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02221DF8 */ _t4 = _t3 & 0x00000001u;
         /* 02221DF8 */ if (_t4) goto L_02221DFC; else goto L_02221E14;
   L_02221DFC: ; // 0x2221dfc
@@ -24729,8 +24729,8 @@ void Gambit_fn_02221DE0(CPUState* cpu) {
         /* 02221E00 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 02221E04 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 02221E04 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 02221E08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02221E0C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221E08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02221E0C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221E0C */ _t7 = _t6 & 0x00000001u;
         /* 02221E0C */ if (_t7) goto L_02221E10; else goto L_02221E20;
   L_02221E10: ; // 0x2221e10
@@ -24738,16 +24738,16 @@ void Gambit_fn_02221DE0(CPUState* cpu) {
   L_02221E14: ; // 0x2221e14
         /* 02221E14 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 02221E14 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 02221E18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02221E1C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221E18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02221E1C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221E1C */ _t10 = _t9 & 0x00000001u;
         /* 02221E1C */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02221E1C */ goto L_02221E20;
   L_02221E20: ; // 0x2221e20
-        /* 02221E20 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 02221E20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 02221E24 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 02221E24 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 02221E28 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02221E28 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02221E28 */ _t13 = _t12 & 0x00000001u;
         /* 02221E28 */ if (_t13) goto L_02221E2C; else goto L_02221E34;
   L_02221E2C: ; // 0x2221e2c
@@ -24758,11 +24758,11 @@ void Gambit_fn_02221DE0(CPUState* cpu) {
         /* 02221E34 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 02221E38 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 02221E38 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 02221E3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02221E3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02221E40 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 02221E40 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 02221E44 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 02221E48 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02221E48 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02221E48 */ _t18 = _t17 & 0x00000001u;
         /* 02221E48 */ if (_t18) goto L_02221E60; else goto L_02221E4C;
   L_02221E4C: ; // 0x2221e4c
@@ -24789,10 +24789,10 @@ void Gambit_fn_02221E68(CPUState* cpu) {
         /* 02221E70 */ _t1 = cpu->r[3] + 0x00000030u;
         /* 02221E70 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 02221E74 */ cpu->r[7] = cpu->r[0];
-        /* 02221E78 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 02221E78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 02221E7C */ _t2 = cpu->r[3] + 0x00000034u;
         /* 02221E7C */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 02221E80 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02221E80 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02221E80 */ _t4 = _t3 & 0x00000001u;
         /* 02221E80 */ if (_t4) goto L_02221E84; else goto L_02221E9C;
   L_02221E84: ; // 0x2221e84
@@ -24800,8 +24800,8 @@ void Gambit_fn_02221E68(CPUState* cpu) {
         /* 02221E88 */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 02221E8C */ _t5 = cpu->r[9] + 0x00000002u;
         /* 02221E8C */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 02221E90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02221E94 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221E90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02221E94 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221E94 */ _t7 = _t6 & 0x00000001u;
         /* 02221E94 */ if (_t7) goto L_02221E98; else goto L_02221EA8;
   L_02221E98: ; // 0x2221e98
@@ -24809,16 +24809,16 @@ void Gambit_fn_02221E68(CPUState* cpu) {
   L_02221E9C: ; // 0x2221e9c
         /* 02221E9C */ _t8 = cpu->r[12] + 0x00000002u;
         /* 02221E9C */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 02221EA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02221EA4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221EA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02221EA4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221EA4 */ _t10 = _t9 & 0x00000001u;
         /* 02221EA4 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02221EA4 */ goto L_02221EA8;
   L_02221EA8: ; // 0x2221ea8
-        /* 02221EA8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 02221EA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 02221EAC */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 02221EAC */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 02221EB0 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02221EB0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02221EB0 */ _t13 = _t12 & 0x00000001u;
         /* 02221EB0 */ if (_t13) goto L_02221EB4; else goto L_02221EBC;
   L_02221EB4: ; // 0x2221eb4
@@ -24829,11 +24829,11 @@ void Gambit_fn_02221E68(CPUState* cpu) {
         /* 02221EBC */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 02221EC0 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 02221EC0 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 02221EC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02221EC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02221EC8 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 02221EC8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 02221ECC */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 02221ED0 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02221ED0 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02221ED0 */ _t18 = _t17 & 0x00000001u;
         /* 02221ED0 */ if (_t18) goto L_02221EE8; else goto L_02221ED4;
   L_02221ED4: ; // 0x2221ed4
@@ -24868,9 +24868,9 @@ void Gambit_fn_02221EF0(CPUState* cpu) {
         /* 02221F08 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 02221F08 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 02221F0C */ /* nop */
-        /* 02221F10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 02221F10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 02221F14 */ cpu->r[31] = cpu->r[4];
-        /* 02221F18 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221F18 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221F18 */ _t6 = _t5 & 0x00000001u;
         /* 02221F18 */ if (_t6) goto L_02221F1C; else goto L_02221F30;
   L_02221F1C: ; // 0x2221f1c
@@ -24919,9 +24919,9 @@ void Gambit_fn_02221EF4(CPUState* cpu) {
         /* 02221F08 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 02221F08 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 02221F0C */ /* nop */
-        /* 02221F10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 02221F10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 02221F14 */ cpu->r[31] = cpu->r[4];
-        /* 02221F18 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221F18 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221F18 */ _t6 = _t5 & 0x00000001u;
         /* 02221F18 */ if (_t6) goto L_02221F1C; else goto L_02221F30;
   L_02221F1C: ; // 0x2221f1c
@@ -24970,20 +24970,20 @@ void Gambit_fn_02221F6C(CPUState* cpu) {
         /* 02221F80 */ _t4 = cpu->r[1] + 0x00000020u;
         /* 02221F80 */ rbrew_write_f32(cpu->mem, _t4, cpu->f[31]);
         /* 02221F84 */ cpu->r[31] = cpu->r[3];
-        /* 02221F84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02221F84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02221F88 */ _t5 = cpu->r[1] + 0x00000010u;
         /* 02221F88 */ rbrew_write32(cpu->mem, _t5, cpu->r[30]);
         /* 02221F8C */ _t6 = cpu->r[1] + 0x0000002Cu;
         /* 02221F8C */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
-        /* 02221F90 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221F90 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221F90 */ _t8 = _t7 & 0x00000001u;
         /* 02221F90 */ if (_t8) goto L_02221F94; else goto L_02221FA4;
   L_02221F94: ; // 0x2221f94
         /* 02221F94 */ cpu->r[3] = 0x00000244u;
         /* 02221F98 */ Gambit_fn_02801A78(cpu);
         /* 02221F9C */ cpu->r[31] = cpu->r[3];
-        /* 02221F9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02221FA0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221F9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02221FA0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221FA0 */ _t10 = _t9 & 0x00000001u;
         /* 02221FA0 */ if (_t10) goto L_0222206C; else goto L_02221FA4;
   L_02221FA4: ; // 0x2221fa4
@@ -24997,10 +24997,10 @@ void Gambit_fn_02221F6C(CPUState* cpu) {
         /* 02221FBC */ _t12 = cpu->r[31] + 0x00000004u;
         /* 02221FBC */ rbrew_write32(cpu->mem, _t12, cpu->r[0]);
         /* 02221FC0 */ cpu->r[0] = cpu->r[31] + 0x0000012Cu;
-        /* 02221FC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02221FC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02221FC4 */ _t13 = cpu->r[31] + 0x00000128u;
         /* 02221FC4 */ rbrew_write_f32(cpu->mem, _t13, cpu->f[31]);
-        /* 02221FC8 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221FC8 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221FC8 */ _t15 = _t14 & 0x00000001u;
         /* 02221FC8 */ if (_t15) goto L_02221FCC; else goto L_02221FD4;
   L_02221FCC: ; // 0x2221fcc
@@ -25008,8 +25008,8 @@ void Gambit_fn_02221F6C(CPUState* cpu) {
         /* 02221FD0 */ Gambit_fn_02801A78(cpu);
   L_02221FD4: ; // 0x2221fd4
         /* 02221FD4 */ cpu->r[12] = cpu->r[31] + 0x0000015Cu;
-        /* 02221FD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02221FD8 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221FD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02221FD8 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221FD8 */ _t17 = _t16 & 0x00000001u;
         /* 02221FD8 */ if (_t17) goto L_02221FDC; else goto L_02221FE4;
   L_02221FDC: ; // 0x2221fdc
@@ -25022,31 +25022,31 @@ void Gambit_fn_02221F6C(CPUState* cpu) {
         /* 02221FEC */ _t19 = cpu->r[31] + 0x0000016Cu;
         /* 02221FEC */ rbrew_write16(cpu->mem, _t19, (uint16_t)cpu->r[29]);
         /* 02221FF0 */ cpu->r[30] = cpu->r[31] + 0x00000170u;
-        /* 02221FF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02221FF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02221FF4 */ _t20 = cpu->r[31] + 0x0000016Eu;
         /* 02221FF4 */ rbrew_write8(cpu->mem, _t20, (uint8_t)cpu->r[29]);
-        /* 02221FF8 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02221FF8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02221FF8 */ _t22 = _t21 & 0x00000001u;
         /* 02221FF8 */ if (_t22) goto L_02221FFC; else goto L_0222200C;
   L_02221FFC: ; // 0x2221ffc
         /* 02221FFC */ cpu->r[3] = 0x000000D0u;
         /* 02222000 */ Gambit_fn_02801A78(cpu);
         /* 02222004 */ cpu->r[30] = cpu->r[3];
-        /* 02222004 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02222008 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02222004 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02222008 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02222008 */ _t24 = _t23 & 0x00000001u;
         /* 02222008 */ if (_t24) goto L_02222050; else goto L_0222200C;
   L_0222200C: ; // 0x222200c
         /* 0222200C */ cpu->r[3] = cpu->r[30];
-        /* 0222200C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02222010 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222200C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02222010 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02222010 */ _t26 = _t25 & 0x00000001u;
         /* 02222010 */ if (_t26) goto L_02222014; else goto L_02222024;
   L_02222014: ; // 0x2222014
         /* 02222014 */ cpu->r[3] = 0x00000010u;
         /* 02222018 */ Gambit_fn_02801A78(cpu);
-        /* 0222201C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02222020 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222201C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02222020 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02222020 */ _t28 = _t27 & 0x00000001u;
         /* 02222020 */ if (_t28) goto L_02222034; else goto L_02222024;
   L_02222024: ; // 0x2222024
@@ -25060,8 +25060,8 @@ void Gambit_fn_02221F6C(CPUState* cpu) {
         /* 02222030 */ rbrew_write32(cpu->mem, _t32, cpu->r[29]);
   L_02222034: ; // 0x2222034
         /* 02222034 */ cpu->r[9] = cpu->r[30] + 0x00000010u;
-        /* 02222034 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02222038 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02222034 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02222038 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02222038 */ _t34 = _t33 & 0x00000001u;
         /* 02222038 */ if (_t34) goto L_02222050; else goto L_0222203C;
   L_0222203C: ; // 0x222203c
@@ -25076,15 +25076,15 @@ void Gambit_fn_02221F6C(CPUState* cpu) {
         /* 0222204C */ rbrew_write32(cpu->mem, _t38, cpu->r[29]);
   L_02222050: ; // 0x2222050
         /* 02222050 */ cpu->r[3] = cpu->r[31] + 0x00000240u;
-        /* 02222050 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02222054 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02222050 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02222054 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02222054 */ _t40 = _t39 & 0x00000001u;
         /* 02222054 */ if (_t40) goto L_02222058; else goto L_02222068;
   L_02222058: ; // 0x2222058
         /* 02222058 */ cpu->r[3] = 0x00000004u;
         /* 0222205C */ Gambit_fn_02801A78(cpu);
-        /* 02222060 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02222064 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02222060 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02222064 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02222064 */ _t42 = _t41 & 0x00000001u;
         /* 02222064 */ if (_t42) goto L_0222206C; else goto L_02222068;
   L_02222068: ; // 0x2222068
@@ -25102,7 +25102,7 @@ void Gambit_fn_02221F6C(CPUState* cpu) {
         /* 0222207C */ cpu->r[3] = cpu->r[31];
         /* 02222080 */ _t48 = cpu->r[1] + 0x00000014u;
         /* 02222080 */ cpu->r[31] = rbrew_read32(cpu->mem, _t48);
-        /* 02222084 */ _t49 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02222084 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02222084 */ _t50 = _t49 & 0x00000001u;
         /* 02222084 */ if (_t50) goto L_02222088; // else: addr-0 trap, fall-through
   L_02222088: ; // 0x2222088
@@ -25288,7 +25288,7 @@ void Gambit_fn_02222098(CPUState* cpu) {
         /* 02222230 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t62);
         /* 02222234 */ _t63 = cpu->r[1] + 0x00000098u;
         /* 02222234 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t63);
-        /* 02222238 */ _t64 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02222238 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02222238 */ _t65 = _t64 & 0x00000001u;
         /* 02222238 */ if (_t65) goto L_0222223C; // else: addr-0 trap, fall-through
   L_0222223C: ; // 0x222223c
@@ -25474,7 +25474,7 @@ void Gambit_fn_0222224C(CPUState* cpu) {
         /* 02222230 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t62);
         /* 02222234 */ _t63 = cpu->r[1] + 0x00000098u;
         /* 02222234 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t63);
-        /* 02222238 */ _t64 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02222238 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02222238 */ _t65 = _t64 & 0x00000001u;
         /* 02222238 */ if (_t65) goto L_0222223C; // else: addr-0 trap, fall-through
   L_0222223C: ; // 0x222223c
@@ -25656,8 +25656,8 @@ void Gambit_fn_022222D4(CPUState* cpu) {
         /* 02222348 */ cpu->f[10] = fma(cpu->f[10], cpu->f[10], cpu->f[11]);
         /* 0222234C */ _t17 = cpu->r[11] + 0xFFFFD458u;
         /* 0222234C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t17);
-        /* 02222350 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
-        /* 02222354 */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02222350 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
+        /* 02222354 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02222354 */ _t19 = _t18 & 0x00000001u;
         /* 02222354 */ if (_t19) goto L_02222358; else goto L_02222394;
   L_02222358: ; // 0x2222358
@@ -25689,8 +25689,8 @@ void Gambit_fn_022222D4(CPUState* cpu) {
         /* 0222239C */ cpu->r[12] = rbrew_read32(cpu->mem, _t26);
         /* 022223A0 */ _t27 = cpu->r[31] + 0x00000174u;
         /* 022223A0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t27);
-        /* 022223A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[8]);
-        /* 022223A8 */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022223A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[8]));
+        /* 022223A8 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022223A8 */ _t29 = _t28 & 0x00000001u;
         /* 022223A8 */ if (_t29) goto L_022223AC; else goto L_02222448;
   L_022223AC: ; // 0x22223ac
@@ -25699,10 +25699,10 @@ void Gambit_fn_022222D4(CPUState* cpu) {
         /* 022223B0 */ _t31 = cpu->r[31] + 0x0000017Cu;
         /* 022223B0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t31);
         /* 022223B4 */ cpu->r[9] = cpu->r[9] + 0xFFFFFFFFu;
-        /* 022223B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 022223B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 022223B8 */ _t32 = cpu->r[31] + 0x00000178u;
         /* 022223B8 */ rbrew_write32(cpu->mem, _t32, cpu->r[9]);
-        /* 022223BC */ _t33 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022223BC */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022223BC */ _t34 = _t33 & 0x00000001u;
         /* 022223BC */ if (_t34) goto L_022223C0; else goto L_022223CC;
   L_022223C0: ; // 0x22223c0
@@ -25719,12 +25719,12 @@ void Gambit_fn_022222D4(CPUState* cpu) {
         /* 022223D4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t38);
         /* 022223D8 */ _t39 = cpu->r[31] + 0x0000017Cu;
         /* 022223D8 */ rbrew_write32(cpu->mem, _t39, cpu->r[10]);
-        /* 022223DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], cpu->r[8]);
+        /* 022223DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], cpu->r[8]));
         /* 022223E0 */ _t40 = cpu->r[31] + 0x00000170u;
         /* 022223E0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t40);
         /* 022223E4 */ _t41 = cpu->r[31] + 0x000000FCu;
         /* 022223E4 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t41);
-        /* 022223E8 */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022223E8 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022223E8 */ _t43 = _t42 & 0x00000001u;
         /* 022223E8 */ if (_t43) goto L_022223F0; else goto L_022223EC;
   L_022223EC: ; // 0x22223ec
@@ -25758,25 +25758,25 @@ void Gambit_fn_022222D4(CPUState* cpu) {
         /* 02222430 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 02222434 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 02222438 */ Gambit_fn_021C6DD8(cpu);
-        /* 0222243C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02222440 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222243C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02222440 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02222440 */ _t54 = _t53 & 0x00000001u;
         /* 02222440 */ if (_t54) goto L_022224FC; else goto L_02222444;
   L_02222444: ; // 0x2222444
         /* 02222444 */ goto L_02222510;
   L_02222448: ; // 0x2222448
-        /* 02222448 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0222244C */ _t55 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02222448 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0222244C */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222244C */ _t56 = _t55 & 0x00000001u;
         /* 0222244C */ if (_t56) goto L_02222450; else goto L_022224C4;
   L_02222450: ; // 0x2222450
         /* 02222450 */ _t57 = cpu->r[31] + 0x00000174u;
         /* 02222450 */ cpu->r[8] = rbrew_read32(cpu->mem, _t57);
         /* 02222454 */ cpu->r[12] = cpu->r[12] + 0xFFFFFFFFu;
-        /* 02222458 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[8]);
+        /* 02222458 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[8]));
         /* 0222245C */ _t58 = cpu->r[31] + 0x0000017Cu;
         /* 0222245C */ rbrew_write32(cpu->mem, _t58, cpu->r[12]);
-        /* 02222460 */ _t59 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02222460 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02222460 */ _t60 = _t59 & 0x00000001u;
         /* 02222460 */ if (_t60) goto L_02222464; else goto L_022224C4;
   L_02222464: ; // 0x2222464
@@ -25785,10 +25785,10 @@ void Gambit_fn_022222D4(CPUState* cpu) {
         /* 02222468 */ _t62 = cpu->r[31] + 0x0000017Cu;
         /* 02222468 */ cpu->r[10] = rbrew_read32(cpu->mem, _t62);
         /* 0222246C */ cpu->r[9] = cpu->r[9] + 0xFFFFFFFFu;
-        /* 0222246C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0222246C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02222470 */ _t63 = cpu->r[31] + 0x00000178u;
         /* 02222470 */ rbrew_write32(cpu->mem, _t63, cpu->r[9]);
-        /* 02222474 */ _t64 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02222474 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02222474 */ _t65 = _t64 & 0x00000001u;
         /* 02222474 */ if (_t65) goto L_02222478; else goto L_02222484;
   L_02222478: ; // 0x2222478
@@ -25805,12 +25805,12 @@ void Gambit_fn_022222D4(CPUState* cpu) {
         /* 0222248C */ cpu->r[8] = rbrew_read32(cpu->mem, _t69);
         /* 02222490 */ _t70 = cpu->r[31] + 0x0000017Cu;
         /* 02222490 */ rbrew_write32(cpu->mem, _t70, cpu->r[10]);
-        /* 02222494 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[8]);
+        /* 02222494 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[8]));
         /* 02222498 */ _t71 = cpu->r[31] + 0x00000170u;
         /* 02222498 */ cpu->r[12] = rbrew_read32(cpu->mem, _t71);
         /* 0222249C */ _t72 = cpu->r[31] + 0x000000FCu;
         /* 0222249C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t72);
-        /* 022224A0 */ _t73 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022224A0 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022224A0 */ _t74 = _t73 & 0x00000001u;
         /* 022224A0 */ if (_t74) goto L_022224A8; else goto L_022224A4;
   L_022224A4: ; // 0x22224a4
@@ -25845,8 +25845,8 @@ void Gambit_fn_022222D4(CPUState* cpu) {
         /* 022224E8 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 022224EC */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 022224F0 */ Gambit_fn_021C6DD8(cpu);
-        /* 022224F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022224F8 */ _t84 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022224F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022224F8 */ _t84 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022224F8 */ _t85 = _t84 & 0x00000001u;
         /* 022224F8 */ if (_t85) goto L_022224FC; else goto L_02222510;
   L_022224FC: ; // 0x22224fc
@@ -25963,8 +25963,8 @@ void Gambit_fn_022222D8(CPUState* cpu) {
         /* 02222348 */ cpu->f[10] = fma(cpu->f[10], cpu->f[10], cpu->f[11]);
         /* 0222234C */ _t17 = cpu->r[11] + 0xFFFFD458u;
         /* 0222234C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t17);
-        /* 02222350 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
-        /* 02222354 */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02222350 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
+        /* 02222354 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02222354 */ _t19 = _t18 & 0x00000001u;
         /* 02222354 */ if (_t19) goto L_02222358; else goto L_02222394;
   L_02222358: ; // 0x2222358
@@ -25996,8 +25996,8 @@ void Gambit_fn_022222D8(CPUState* cpu) {
         /* 0222239C */ cpu->r[12] = rbrew_read32(cpu->mem, _t26);
         /* 022223A0 */ _t27 = cpu->r[31] + 0x00000174u;
         /* 022223A0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t27);
-        /* 022223A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[8]);
-        /* 022223A8 */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022223A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[8]));
+        /* 022223A8 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022223A8 */ _t29 = _t28 & 0x00000001u;
         /* 022223A8 */ if (_t29) goto L_022223AC; else goto L_02222448;
   L_022223AC: ; // 0x22223ac
@@ -26006,10 +26006,10 @@ void Gambit_fn_022222D8(CPUState* cpu) {
         /* 022223B0 */ _t31 = cpu->r[31] + 0x0000017Cu;
         /* 022223B0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t31);
         /* 022223B4 */ cpu->r[9] = cpu->r[9] + 0xFFFFFFFFu;
-        /* 022223B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 022223B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 022223B8 */ _t32 = cpu->r[31] + 0x00000178u;
         /* 022223B8 */ rbrew_write32(cpu->mem, _t32, cpu->r[9]);
-        /* 022223BC */ _t33 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022223BC */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022223BC */ _t34 = _t33 & 0x00000001u;
         /* 022223BC */ if (_t34) goto L_022223C0; else goto L_022223CC;
   L_022223C0: ; // 0x22223c0
@@ -26026,12 +26026,12 @@ void Gambit_fn_022222D8(CPUState* cpu) {
         /* 022223D4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t38);
         /* 022223D8 */ _t39 = cpu->r[31] + 0x0000017Cu;
         /* 022223D8 */ rbrew_write32(cpu->mem, _t39, cpu->r[10]);
-        /* 022223DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], cpu->r[8]);
+        /* 022223DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], cpu->r[8]));
         /* 022223E0 */ _t40 = cpu->r[31] + 0x00000170u;
         /* 022223E0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t40);
         /* 022223E4 */ _t41 = cpu->r[31] + 0x000000FCu;
         /* 022223E4 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t41);
-        /* 022223E8 */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022223E8 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022223E8 */ _t43 = _t42 & 0x00000001u;
         /* 022223E8 */ if (_t43) goto L_022223F0; else goto L_022223EC;
   L_022223EC: ; // 0x22223ec
@@ -26065,25 +26065,25 @@ void Gambit_fn_022222D8(CPUState* cpu) {
         /* 02222430 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 02222434 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 02222438 */ Gambit_fn_021C6DD8(cpu);
-        /* 0222243C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02222440 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222243C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02222440 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02222440 */ _t54 = _t53 & 0x00000001u;
         /* 02222440 */ if (_t54) goto L_022224FC; else goto L_02222444;
   L_02222444: ; // 0x2222444
         /* 02222444 */ goto L_02222510;
   L_02222448: ; // 0x2222448
-        /* 02222448 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0222244C */ _t55 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02222448 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0222244C */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222244C */ _t56 = _t55 & 0x00000001u;
         /* 0222244C */ if (_t56) goto L_02222450; else goto L_022224C4;
   L_02222450: ; // 0x2222450
         /* 02222450 */ _t57 = cpu->r[31] + 0x00000174u;
         /* 02222450 */ cpu->r[8] = rbrew_read32(cpu->mem, _t57);
         /* 02222454 */ cpu->r[12] = cpu->r[12] + 0xFFFFFFFFu;
-        /* 02222458 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[8]);
+        /* 02222458 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[8]));
         /* 0222245C */ _t58 = cpu->r[31] + 0x0000017Cu;
         /* 0222245C */ rbrew_write32(cpu->mem, _t58, cpu->r[12]);
-        /* 02222460 */ _t59 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02222460 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02222460 */ _t60 = _t59 & 0x00000001u;
         /* 02222460 */ if (_t60) goto L_02222464; else goto L_022224C4;
   L_02222464: ; // 0x2222464
@@ -26092,10 +26092,10 @@ void Gambit_fn_022222D8(CPUState* cpu) {
         /* 02222468 */ _t62 = cpu->r[31] + 0x0000017Cu;
         /* 02222468 */ cpu->r[10] = rbrew_read32(cpu->mem, _t62);
         /* 0222246C */ cpu->r[9] = cpu->r[9] + 0xFFFFFFFFu;
-        /* 0222246C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0222246C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02222470 */ _t63 = cpu->r[31] + 0x00000178u;
         /* 02222470 */ rbrew_write32(cpu->mem, _t63, cpu->r[9]);
-        /* 02222474 */ _t64 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02222474 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02222474 */ _t65 = _t64 & 0x00000001u;
         /* 02222474 */ if (_t65) goto L_02222478; else goto L_02222484;
   L_02222478: ; // 0x2222478
@@ -26112,12 +26112,12 @@ void Gambit_fn_022222D8(CPUState* cpu) {
         /* 0222248C */ cpu->r[8] = rbrew_read32(cpu->mem, _t69);
         /* 02222490 */ _t70 = cpu->r[31] + 0x0000017Cu;
         /* 02222490 */ rbrew_write32(cpu->mem, _t70, cpu->r[10]);
-        /* 02222494 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[8]);
+        /* 02222494 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[8]));
         /* 02222498 */ _t71 = cpu->r[31] + 0x00000170u;
         /* 02222498 */ cpu->r[12] = rbrew_read32(cpu->mem, _t71);
         /* 0222249C */ _t72 = cpu->r[31] + 0x000000FCu;
         /* 0222249C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t72);
-        /* 022224A0 */ _t73 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022224A0 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022224A0 */ _t74 = _t73 & 0x00000001u;
         /* 022224A0 */ if (_t74) goto L_022224A8; else goto L_022224A4;
   L_022224A4: ; // 0x22224a4
@@ -26152,8 +26152,8 @@ void Gambit_fn_022222D8(CPUState* cpu) {
         /* 022224E8 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 022224EC */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 022224F0 */ Gambit_fn_021C6DD8(cpu);
-        /* 022224F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022224F8 */ _t84 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022224F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022224F8 */ _t84 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022224F8 */ _t85 = _t84 & 0x00000001u;
         /* 022224F8 */ if (_t85) goto L_022224FC; else goto L_02222510;
   L_022224FC: ; // 0x22224fc
@@ -26224,8 +26224,8 @@ void Gambit_fn_02222594(CPUState* cpu) {
         /* 02222594 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02222598 */ _t1 = cpu->r[5] + 0x00000000u;
         /* 02222598 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
-        /* 0222259C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
-        /* 022225A0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222259C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
+        /* 022225A0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022225A0 */ _t3 = _t2 & 0x00000001u;
         /* 022225A0 */ if (_t3) goto L_022225A4; else goto L_022225B0;
   L_022225A4: ; // 0x22225a4
@@ -26341,8 +26341,8 @@ void Gambit_fn_022225EC(CPUState* cpu) {
         /* 02222658 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t16);
         /* 0222265C */ _t17 = cpu->r[30] + 0x0000017Cu;
         /* 0222265C */ cpu->r[8] = rbrew_read32(cpu->mem, _t17);
-        /* 02222660 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02222664 */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02222660 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02222664 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02222664 */ _t19 = _t18 & 0x00000001u;
         /* 02222664 */ if (_t19) goto L_022226E8; else goto L_02222668;
   L_02222668: ; // 0x2222668
@@ -26394,7 +26394,7 @@ void Gambit_fn_022225EC(CPUState* cpu) {
         /* 022226CC */ cpu->f[26] = rbrew_read_f64(cpu->mem, _t39);
         /* 022226D0 */ _t40 = cpu->r[1] + 0x000000D0u;
         /* 022226D0 */ cpu->r[30] = rbrew_read32(cpu->mem, _t40);
-        /* 022226D4 */ _t41 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022226D4 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022226D4 */ _t42 = _t41 & 0x00000001u;
         /* 022226D4 */ if (_t42) goto L_022226D8; // else: addr-0 trap, fall-through
   L_022226D8: ; // 0x22226d8
@@ -26409,30 +26409,30 @@ void Gambit_fn_022225EC(CPUState* cpu) {
         /* 022226EC */ _t45 = cpu->r[30] + 0x00000174u;
         /* 022226EC */ cpu->r[7] = rbrew_read32(cpu->mem, _t45);
         /* 022226F0 */ cpu->r[0] = cpu->r[9];
-        /* 022226F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[7]);
+        /* 022226F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[7]));
         /* 022226F8 */ _t46 = cpu->r[30] + 0x00000170u;
         /* 022226F8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t46);
-        /* 022226FC */ _t47 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022226FC */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022226FC */ _t48 = _t47 & 0x00000001u;
         /* 022226FC */ if (_t48) goto L_02222704; else goto L_02222700;
   L_02222700: ; // 0x2222700
         /* 02222700 */ cpu->r[0] = cpu->r[0] - cpu->r[7];
   L_02222704: ; // 0x2222704
         /* 02222704 */ cpu->r[0] = (uint32_t)((int32_t)cpu->r[0] * (int32_t)0x0000000Cu);
-        /* 02222708 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000002u);
+        /* 02222708 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000002u));
         /* 0222270C */ cpu->r[11] = cpu->r[10] + cpu->r[0];
-        /* 02222710 */ _t49 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02222710 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02222710 */ _t50 = _t49 & 0x00000001u;
         /* 02222710 */ if (_t50) goto L_02222714; else goto L_022227C8;
   L_02222714: ; // 0x2222714
-        /* 02222714 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000002u);
-        /* 02222718 */ _t51 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02222714 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000002u));
+        /* 02222718 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02222718 */ _t52 = _t51 & 0x00000001u;
         /* 02222718 */ if (_t52) goto L_0222271C; else goto L_0222277C;
   L_0222271C: ; // 0x222271c
         /* 0222271C */ cpu->r[0] = cpu->r[9] + 0x00000002u;
-        /* 02222720 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[7]);
-        /* 02222724 */ _t53 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02222720 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[7]));
+        /* 02222724 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02222724 */ _t54 = _t53 & 0x00000001u;
         /* 02222724 */ if (_t54) goto L_0222272C; else goto L_02222728;
   L_02222728: ; // 0x2222728
@@ -26459,10 +26459,10 @@ void Gambit_fn_022225EC(CPUState* cpu) {
         /* 02222760 */ rbrew_write_f32(cpu->mem, _t59, cpu->f[9]);
         /* 02222764 */ cpu->f[9] = fma(cpu->f[9], cpu->f[9], cpu->f[8]);
         /* 02222768 */ cpu->r[11] = 0x10050000u;
-        /* 0222276C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[29]);
+        /* 0222276C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[29]));
         /* 02222770 */ _t60 = cpu->r[11] + 0xFFFFD4E0u;
         /* 02222770 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t60);
-        /* 02222774 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02222774 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02222774 */ _t62 = _t61 & 0x00000001u;
         /* 02222774 */ if (_t62) goto L_02222778; else goto L_02222860;
   L_02222778: ; // 0x2222778
@@ -26488,10 +26488,10 @@ void Gambit_fn_022225EC(CPUState* cpu) {
         /* 022227AC */ rbrew_write_f32(cpu->mem, _t67, cpu->f[9]);
         /* 022227B0 */ cpu->f[9] = fma(cpu->f[9], cpu->f[9], cpu->f[8]);
         /* 022227B4 */ cpu->r[11] = 0x10050000u;
-        /* 022227B8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[29]);
+        /* 022227B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[29]));
         /* 022227BC */ _t68 = cpu->r[11] + 0xFFFFD4E0u;
         /* 022227BC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t68);
-        /* 022227C0 */ _t69 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022227C0 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022227C0 */ _t70 = _t69 & 0x00000001u;
         /* 022227C0 */ if (_t70) goto L_022227C4; else goto L_02222860;
   L_022227C4: ; // 0x22227c4
@@ -26499,8 +26499,8 @@ void Gambit_fn_022225EC(CPUState* cpu) {
   L_022227C8: ; // 0x22227c8
         /* 022227C8 */ cpu->r[8] = cpu->r[9] + cpu->r[8];
         /* 022227CC */ cpu->r[8] = cpu->r[8] + 0xFFFFFFFFu;
-        /* 022227D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], cpu->r[7]);
-        /* 022227D4 */ _t71 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022227D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], cpu->r[7]));
+        /* 022227D4 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022227D4 */ _t72 = _t71 & 0x00000001u;
         /* 022227D4 */ if (_t72) goto L_022227DC; else goto L_022227D8;
   L_022227D8: ; // 0x22227d8
@@ -26527,10 +26527,10 @@ void Gambit_fn_022225EC(CPUState* cpu) {
         /* 02222810 */ rbrew_write_f32(cpu->mem, _t77, cpu->f[9]);
         /* 02222814 */ cpu->f[9] = fma(cpu->f[9], cpu->f[9], cpu->f[8]);
         /* 02222818 */ cpu->r[11] = 0x10050000u;
-        /* 0222281C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[29]);
+        /* 0222281C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[29]));
         /* 02222820 */ _t78 = cpu->r[11] + 0xFFFFD4E0u;
         /* 02222820 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t78);
-        /* 02222824 */ _t79 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02222824 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02222824 */ _t80 = _t79 & 0x00000001u;
         /* 02222824 */ if (_t80) goto L_02222828; else goto L_02222860;
   L_02222828: ; // 0x2222828
@@ -26581,10 +26581,10 @@ void Gambit_fn_022225EC(CPUState* cpu) {
         /* 022228A0 */ _t94 = cpu->r[9] + 0xFFFFD4F8u;
         /* 022228A0 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t94);
         /* 022228A4 */ cpu->r[8] = 0x10050000u;
-        /* 022228A8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 022228A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 022228AC */ _t95 = cpu->r[8] + 0xFFFFD4D8u;
         /* 022228AC */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t95);
-        /* 022228B0 */ _t96 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022228B0 */ _t96 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022228B0 */ _t97 = _t96 & 0x00000001u;
         /* 022228B0 */ if (_t97) goto L_022228B4; else goto L_022228E8;
   L_022228B4: ; // 0x22228b4
@@ -26598,19 +26598,19 @@ void Gambit_fn_022225EC(CPUState* cpu) {
         /* 022228C8 */ _t100 = cpu->r[1] + 0x00000014u;
         /* 022228C8 */ rbrew_write_f32(cpu->mem, _t100, cpu->f[13]);
         /* 022228CC */ cpu->f[9] = fma(cpu->f[13], cpu->f[13], cpu->f[7]);
-        /* 022228D0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[29]);
+        /* 022228D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[29]));
         /* 022228D4 */ _t101 = cpu->r[1] + 0x00000018u;
         /* 022228D4 */ rbrew_write_f32(cpu->mem, _t101, cpu->f[8]);
         /* 022228D8 */ cpu->f[27] = cpu->f[1];
-        /* 022228DC */ _t102 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022228DC */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022228DC */ _t103 = _t102 & 0x00000001u;
         /* 022228DC */ if (_t103) goto L_0222291C; else goto L_022228E0;
   L_022228E0: ; // 0x22228e0
         /* 022228E0 */ cpu->f[1] = cpu->f[29];
         /* 022228E4 */ goto L_02222978;
   L_022228E8: ; // 0x22228e8
-        /* 022228E8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[28]);
-        /* 022228EC */ _t104 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022228E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[28]));
+        /* 022228EC */ _t104 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022228EC */ _t105 = _t104 & 0x00000001u;
         /* 022228EC */ if (_t105) goto L_022228F0; else goto L_022228F4;
   L_022228F0: ; // 0x22228f0
@@ -26625,11 +26625,11 @@ void Gambit_fn_022225EC(CPUState* cpu) {
         /* 02222904 */ _t108 = cpu->r[1] + 0x00000014u;
         /* 02222904 */ rbrew_write_f32(cpu->mem, _t108, cpu->f[13]);
         /* 02222908 */ cpu->f[9] = fma(cpu->f[13], cpu->f[13], cpu->f[7]);
-        /* 0222290C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[29]);
+        /* 0222290C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[29]));
         /* 02222910 */ _t109 = cpu->r[1] + 0x00000018u;
         /* 02222910 */ rbrew_write_f32(cpu->mem, _t109, cpu->f[8]);
         /* 02222914 */ cpu->f[27] = cpu->f[1];
-        /* 02222918 */ _t110 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02222918 */ _t110 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02222918 */ _t111 = _t110 & 0x00000001u;
         /* 02222918 */ if (_t111) goto L_0222291C; else goto L_022228E0;
   L_0222291C: ; // 0x222291c
@@ -26645,17 +26645,17 @@ void Gambit_fn_022225EC(CPUState* cpu) {
         /* 02222934 */ cpu->f[10] = cpu->f[12] * cpu->f[0];
         /* 02222938 */ cpu->f[9] = cpu->f[9] * cpu->f[10];
         /* 0222293C */ /* nop */
-        /* 02222940 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[29]);
+        /* 02222940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[29]));
         /* 02222944 */ /* nop */
         /* 02222948 */ /* nop */
-        /* 0222294C */ _t115 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222294C */ _t115 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222294C */ _t116 = _t115 & 0x00000001u;
         /* 0222294C */ if (_t116) goto L_02222950; else goto L_022228E0;
   L_02222950: ; // 0x2222950
         /* 02222950 */ _t117 = cpu->r[1] + 0x00000014u;
         /* 02222950 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t117);
-        /* 02222954 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
-        /* 02222958 */ _t118 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02222954 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
+        /* 02222958 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02222958 */ _t119 = _t118 & 0x00000001u;
         /* 02222958 */ if (_t119) goto L_0222295C; else goto L_02222968;
   L_0222295C: ; // 0x222295c
@@ -26663,8 +26663,8 @@ void Gambit_fn_022225EC(CPUState* cpu) {
         /* 02222960 */ Gambit_fn_02C892F8(cpu);
         /* 02222964 */ goto L_02222978;
   L_02222968: ; // 0x2222968
-        /* 02222968 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[28]);
-        /* 0222296C */ _t120 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02222968 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[28]));
+        /* 0222296C */ _t120 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222296C */ _t121 = _t120 & 0x00000001u;
         /* 0222296C */ if (_t121) goto L_02222970; else goto L_02222974;
   L_02222970: ; // 0x2222970
@@ -26878,7 +26878,7 @@ void Gambit_fn_022225EC(CPUState* cpu) {
         /* 02222B88 */ cpu->f[27] = rbrew_read_f64(cpu->mem, _t191);
         /* 02222B8C */ _t192 = cpu->r[1] + 0x00000128u;
         /* 02222B8C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t192);
-        /* 02222B90 */ _t193 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02222B90 */ _t193 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02222B90 */ _t194 = _t193 & 0x00000001u;
         /* 02222B90 */ if (_t194) goto L_02222B94; // else: addr-0 trap, fall-through
   L_02222B94: ; // 0x2222b94
@@ -26898,20 +26898,20 @@ void Gambit_fn_02222BA4(CPUState* cpu) {
         /* 02222BA4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 02222BA8 */ _t1 = cpu->r[3] + 0x00000174u;
         /* 02222BA8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t1);
-        /* 02222BAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[0]);
-        /* 02222BB0 */ _t2 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02222BAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[0]));
+        /* 02222BB0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02222BB0 */ _t3 = _t2 & 0x00000001u;
         /* 02222BB0 */ if (_t3) goto L_02222BB4; else goto L_02222C14;
   L_02222BB4: ; // 0x2222bb4
         /* 02222BB4 */ _t4 = cpu->r[3] + 0x00000178u;
         /* 02222BB4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t4);
         /* 02222BB8 */ cpu->r[10] = cpu->r[10] + 0xFFFFFFFFu;
-        /* 02222BB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02222BB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02222BBC */ _t5 = cpu->r[3] + 0x00000178u;
         /* 02222BBC */ rbrew_write32(cpu->mem, _t5, cpu->r[10]);
         /* 02222BC0 */ _t6 = cpu->r[3] + 0x0000017Cu;
         /* 02222BC0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t6);
-        /* 02222BC4 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02222BC4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02222BC4 */ _t8 = _t7 & 0x00000001u;
         /* 02222BC4 */ if (_t8) goto L_02222BC8; else goto L_02222BD4;
   L_02222BC8: ; // 0x2222bc8
@@ -26926,10 +26926,10 @@ void Gambit_fn_02222BA4(CPUState* cpu) {
         /* 02222BD8 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
         /* 02222BDC */ _t12 = cpu->r[3] + 0x00000178u;
         /* 02222BDC */ cpu->r[12] = rbrew_read32(cpu->mem, _t12);
-        /* 02222BE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[0]);
+        /* 02222BE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[0]));
         /* 02222BE4 */ _t13 = cpu->r[3] + 0x0000017Cu;
         /* 02222BE4 */ rbrew_write32(cpu->mem, _t13, cpu->r[10]);
-        /* 02222BE8 */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02222BE8 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02222BE8 */ _t15 = _t14 & 0x00000001u;
         /* 02222BE8 */ if (_t15) goto L_02222BF0; else goto L_02222BEC;
   L_02222BEC: ; // 0x2222bec
@@ -26953,8 +26953,8 @@ void Gambit_fn_02222BA4(CPUState* cpu) {
         /* 02222C0C */ rbrew_write_f32(cpu->mem, _t22, cpu->f[0]);
         /* 02222C10 */ return;
   L_02222C14: ; // 0x2222c14
-        /* 02222C14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02222C18 */ _t23 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02222C14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02222C18 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02222C18 */ _t24 = _t23 & 0x00000001u;
         /* 02222C18 */ _t25 = _t24 ^ 0x00000001u;
         /* 02222C18 */ if (_t25) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -26965,8 +26965,8 @@ void Gambit_fn_02222BA4(CPUState* cpu) {
         /* 02222C20 */ cpu->r[12] = cpu->r[12] + 0xFFFFFFFFu;
         /* 02222C24 */ _t27 = cpu->r[3] + 0x0000017Cu;
         /* 02222C24 */ rbrew_write32(cpu->mem, _t27, cpu->r[12]);
-        /* 02222C28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[0]);
-        /* 02222C2C */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02222C28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[0]));
+        /* 02222C2C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02222C2C */ _t29 = _t28 & 0x00000001u;
         /* 02222C2C */ _t30 = _t29 ^ 0x00000001u;
         /* 02222C2C */ if (_t30) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -26977,10 +26977,10 @@ void Gambit_fn_02222BA4(CPUState* cpu) {
         /* 02222C34 */ _t32 = cpu->r[3] + 0x0000017Cu;
         /* 02222C34 */ cpu->r[11] = rbrew_read32(cpu->mem, _t32);
         /* 02222C38 */ cpu->r[10] = cpu->r[10] + 0xFFFFFFFFu;
-        /* 02222C38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02222C38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02222C3C */ _t33 = cpu->r[3] + 0x00000178u;
         /* 02222C3C */ rbrew_write32(cpu->mem, _t33, cpu->r[10]);
-        /* 02222C40 */ _t34 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02222C40 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02222C40 */ _t35 = _t34 & 0x00000001u;
         /* 02222C40 */ if (_t35) goto L_02222C44; else goto L_02222C50;
   L_02222C44: ; // 0x2222c44
@@ -26997,12 +26997,12 @@ void Gambit_fn_02222BA4(CPUState* cpu) {
         /* 02222C58 */ cpu->r[0] = rbrew_read32(cpu->mem, _t39);
         /* 02222C5C */ _t40 = cpu->r[3] + 0x0000017Cu;
         /* 02222C5C */ rbrew_write32(cpu->mem, _t40, cpu->r[11]);
-        /* 02222C60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], cpu->r[0]);
+        /* 02222C60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], cpu->r[0]));
         /* 02222C64 */ _t41 = cpu->r[3] + 0x000000FCu;
         /* 02222C64 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t41);
         /* 02222C68 */ _t42 = cpu->r[3] + 0x00000170u;
         /* 02222C68 */ cpu->r[11] = rbrew_read32(cpu->mem, _t42);
-        /* 02222C6C */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02222C6C */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02222C6C */ _t44 = _t43 & 0x00000001u;
         /* 02222C6C */ if (_t44) goto L_02222C74; else goto L_02222C70;
   L_02222C70: ; // 0x2222c70
@@ -27036,7 +27036,7 @@ void Gambit_fn_02222C90(CPUState* cpu) {
         /* 02222C9C */ _t2 = cpu->r[4] + 0x00000000u;
         /* 02222C9C */ rbrew_write16(cpu->mem, _t2, (uint16_t)cpu->r[10]);
         /* 02222CA0 */ cpu->r[12] = cpu->r[11] & 0x0000FEFFu;
-        /* 02222CA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02222CA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02222CA4 */ cpu->r[0] = 0x00000000u;
         /* 02222CA8 */ _t3 = cpu->r[4] + 0x00000002u;
         /* 02222CA8 */ rbrew_write16(cpu->mem, _t3, (uint16_t)cpu->r[12]);
@@ -27062,8 +27062,8 @@ void Gambit_fn_02222CB4(CPUState* cpu) {
         /* 02222CC4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02222CC8 */ _t3 = cpu->r[31] + 0x0000016Eu;
         /* 02222CC8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 02222CCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02222CD0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02222CCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02222CD0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02222CD0 */ _t5 = _t4 & 0x00000001u;
         /* 02222CD0 */ if (_t5) goto L_02222E10; else goto L_02222CD4;
   L_02222CD4: ; // 0x2222cd4
@@ -27106,8 +27106,8 @@ void Gambit_fn_02222CB4(CPUState* cpu) {
         /* 02222D2C */ cpu->f[12] = fma(cpu->f[13], cpu->f[13], cpu->f[11]);
         /* 02222D30 */ _t20 = cpu->r[11] + 0xFFFFD458u;
         /* 02222D30 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t20);
-        /* 02222D34 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[0]);
-        /* 02222D38 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02222D34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[0]));
+        /* 02222D38 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02222D38 */ _t22 = _t21 & 0x00000001u;
         /* 02222D38 */ if (_t22) goto L_02222D3C; else goto L_02222D78;
   L_02222D3C: ; // 0x2222d3c
@@ -27138,8 +27138,8 @@ void Gambit_fn_02222CB4(CPUState* cpu) {
         /* 02222D80 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 02222D84 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 02222D88 */ Gambit_fn_021C6DD8(cpu);
-        /* 02222D8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02222D90 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02222D8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02222D90 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02222D90 */ _t30 = _t29 & 0x00000001u;
         /* 02222D90 */ if (_t30) goto L_02222D94; else goto L_02222DA8;
   L_02222D94: ; // 0x2222d94
@@ -27216,8 +27216,8 @@ void Gambit_fn_02222CB8(CPUState* cpu) {
         /* 02222CC4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02222CC8 */ _t3 = cpu->r[31] + 0x0000016Eu;
         /* 02222CC8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 02222CCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02222CD0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02222CCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02222CD0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02222CD0 */ _t5 = _t4 & 0x00000001u;
         /* 02222CD0 */ if (_t5) goto L_02222E10; else goto L_02222CD4;
   L_02222CD4: ; // 0x2222cd4
@@ -27260,8 +27260,8 @@ void Gambit_fn_02222CB8(CPUState* cpu) {
         /* 02222D2C */ cpu->f[12] = fma(cpu->f[13], cpu->f[13], cpu->f[11]);
         /* 02222D30 */ _t20 = cpu->r[11] + 0xFFFFD458u;
         /* 02222D30 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t20);
-        /* 02222D34 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[0]);
-        /* 02222D38 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02222D34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[0]));
+        /* 02222D38 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02222D38 */ _t22 = _t21 & 0x00000001u;
         /* 02222D38 */ if (_t22) goto L_02222D3C; else goto L_02222D78;
   L_02222D3C: ; // 0x2222d3c
@@ -27292,8 +27292,8 @@ void Gambit_fn_02222CB8(CPUState* cpu) {
         /* 02222D80 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 02222D84 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 02222D88 */ Gambit_fn_021C6DD8(cpu);
-        /* 02222D8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02222D90 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02222D8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02222D90 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02222D90 */ _t30 = _t29 & 0x00000001u;
         /* 02222D90 */ if (_t30) goto L_02222D94; else goto L_02222DA8;
   L_02222D94: ; // 0x2222d94
@@ -27365,20 +27365,20 @@ void Gambit_fn_02222E24(CPUState* cpu) {
         /* 02222E2C */ _t1 = cpu->r[12] + 0xFFFFD500u;
         /* 02222E2C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t1);
         /* 02222E30 */ cpu->r[12] = 0x10050000u;
-        /* 02222E34 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
+        /* 02222E34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
         /* 02222E38 */ _t2 = cpu->r[12] + 0xFFFFD4FCu;
         /* 02222E38 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t2);
         /* 02222E3C */ _t3 = cpu->r[3] + 0x000000E8u;
         /* 02222E3C */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t3);
-        /* 02222E40 */ _t4 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02222E40 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02222E40 */ _t5 = _t4 & 0x00000001u;
         /* 02222E40 */ if (_t5) goto L_02222E44; else goto L_02222E74;
   L_02222E44: ; // 0x2222e44
         /* 02222E44 */ cpu->r[12] = 0x10050000u;
         /* 02222E48 */ _t6 = cpu->r[12] + 0xFFFFD504u;
         /* 02222E48 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t6);
-        /* 02222E4C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[12]);
-        /* 02222E50 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02222E4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[12]));
+        /* 02222E50 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02222E50 */ _t8 = _t7 & 0x00000001u;
         /* 02222E50 */ _t9 = _t8 ^ 0x00000001u;
         /* 02222E50 */ if (_t9) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -27507,9 +27507,9 @@ void Gambit_fn_02222EE4(CPUState* cpu) {
         /* 02031BE4 */ _t4 = cpu->r[4] + 0x00000000u;
         /* 02031BE4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t4);
         /* 02031BE8 */ cpu->r[31] = cpu->r[4];
-        /* 02031BEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02031BEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02031BF0 */ cpu->r[30] = cpu->r[3];
-        /* 02031BF4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02031BF4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02031BF4 */ _t6 = _t5 & 0x00000001u;
         /* 02031BF4 */ if (_t6) goto L_02031C58; else goto L_02031BF8;
   L_02031BF8: ; // 0x2031bf8
@@ -27517,8 +27517,8 @@ void Gambit_fn_02222EE4(CPUState* cpu) {
         /* 02031BF8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
         /* 02031BFC */ _t8 = cpu->r[3] + 0x0000011Cu;
         /* 02031BFC */ cpu->r[11] = rbrew_read8(cpu->mem, _t8);
-        /* 02031C00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02031C04 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02031C00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02031C04 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02031C04 */ _t10 = _t9 & 0x00000001u;
         /* 02031C04 */ if (_t10) goto L_02031C58; else goto L_02031C08;
   L_02031C08: ; // 0x2031c08
@@ -27624,8 +27624,8 @@ void Gambit_fn_02222F14(CPUState* cpu) {
         /* 02222F14 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02222F14 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02222F18 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 02222F18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02222F1C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02222F18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02222F1C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02222F1C */ _t2 = _t1 & 0x00000001u;
         /* 02222F1C */ _t3 = _t2 ^ 0x00000001u;
         /* 02222F1C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -27647,8 +27647,8 @@ void Gambit_fn_02222F30(CPUState* cpu) {
         /* 02222F30 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02222F30 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02222F34 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 02222F34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02222F38 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02222F34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02222F38 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02222F38 */ _t2 = _t1 & 0x00000001u;
         /* 02222F38 */ _t3 = _t2 ^ 0x00000001u;
         /* 02222F38 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -27670,8 +27670,8 @@ void Gambit_fn_02222F4C(CPUState* cpu) {
         /* 02222F4C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02222F4C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02222F50 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 02222F50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02222F54 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02222F50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02222F54 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02222F54 */ _t2 = _t1 & 0x00000001u;
         /* 02222F54 */ _t3 = _t2 ^ 0x00000001u;
         /* 02222F54 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -27714,8 +27714,8 @@ void Gambit_fn_02222F78(CPUState* cpu) {
         /* 02222F88 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02222F8C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02222F8C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02222F90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02222F94 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02222F90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02222F94 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02222F94 */ _t5 = _t4 & 0x00000001u;
         /* 02222F94 */ if (_t5) goto L_02222F98; else goto L_02222FB4;
   L_02222F98: ; // 0x2222f98
@@ -27754,8 +27754,8 @@ void Gambit_fn_02222F7C(CPUState* cpu) {
         /* 02222F88 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02222F8C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02222F8C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02222F90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02222F94 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02222F90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02222F94 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02222F94 */ _t5 = _t4 & 0x00000001u;
         /* 02222F94 */ if (_t5) goto L_02222F98; else goto L_02222FB4;
   L_02222F98: ; // 0x2222f98
@@ -28197,8 +28197,8 @@ void Gambit_fn_02223180(CPUState* cpu) {
         /* 02223180 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 02223180 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02223184 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 02223184 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02223188 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223184 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02223188 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223188 */ _t2 = _t1 & 0x00000001u;
         /* 02223188 */ if (_t2) goto L_02223198; else goto L_0222318C;
   L_0222318C: ; // 0x222318c
@@ -28227,8 +28227,8 @@ void Gambit_fn_022231A4(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -28294,10 +28294,10 @@ void Gambit_fn_022231D4(CPUState* cpu) {
         /* 022231D4 */ cpu->r[10] = 0x101D0000u;
         /* 022231D8 */ _t0 = cpu->r[10] + 0xFFFFFC3Cu;
         /* 022231D8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 022231DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 022231DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 022231E0 */ cpu->r[10] = 0x101D0000u;
         /* 022231E4 */ cpu->r[10] = cpu->r[10] + 0xFFFFFF60u;
-        /* 022231E8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022231E8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022231E8 */ _t2 = _t1 & 0x00000001u;
         /* 022231E8 */ if (_t2) goto L_022231EC; else goto L_02223204;
   L_022231EC: ; // 0x22231ec
@@ -28310,8 +28310,8 @@ void Gambit_fn_022231D4(CPUState* cpu) {
         /* 02223200 */ _t4 = cpu->r[10] + 0x00000000u;
         /* 02223200 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_02223204: ; // 0x2223204
-        /* 02223204 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02223208 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223204 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02223208 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223208 */ _t6 = _t5 & 0x00000001u;
         /* 02223208 */ if (_t6) goto L_0222320C; else goto L_02223214;
   L_0222320C: ; // 0x222320c
@@ -28322,9 +28322,9 @@ void Gambit_fn_022231D4(CPUState* cpu) {
         /* 02223218 */ _t7 = cpu->r[9] + 0xFFFFDA00u;
         /* 02223218 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 0222321C */ cpu->r[11] = 0x101D0000u;
-        /* 02223220 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02223220 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02223224 */ cpu->r[11] = cpu->r[11] + 0xFFFFFBFCu;
-        /* 02223228 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223228 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223228 */ _t9 = _t8 & 0x00000001u;
         /* 02223228 */ if (_t9) goto L_0222322C; else goto L_02223244;
   L_0222322C: ; // 0x222322c
@@ -28337,8 +28337,8 @@ void Gambit_fn_022231D4(CPUState* cpu) {
         /* 02223240 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 02223240 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_02223244: ; // 0x2223244
-        /* 02223244 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 02223248 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223244 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 02223248 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223248 */ _t13 = _t12 & 0x00000001u;
         /* 02223248 */ if (_t13) goto L_0222324C; else goto L_02223254;
   L_0222324C: ; // 0x222324c
@@ -28349,9 +28349,9 @@ void Gambit_fn_022231D4(CPUState* cpu) {
         /* 02223258 */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 02223258 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 0222325C */ cpu->r[9] = 0x101D0000u;
-        /* 02223260 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02223260 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02223264 */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 02223268 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223268 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223268 */ _t16 = _t15 & 0x00000001u;
         /* 02223268 */ if (_t16) goto L_0222326C; else goto L_02223284;
   L_0222326C: ; // 0x222326c
@@ -28364,8 +28364,8 @@ void Gambit_fn_022231D4(CPUState* cpu) {
         /* 02223280 */ _t18 = cpu->r[9] + 0x00000000u;
         /* 02223280 */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_02223284: ; // 0x2223284
-        /* 02223284 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 02223288 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223284 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 02223288 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223288 */ _t20 = _t19 & 0x00000001u;
         /* 02223288 */ if (_t20) goto L_0222328C; else goto L_02223294;
   L_0222328C: ; // 0x222328c
@@ -28377,9 +28377,9 @@ void Gambit_fn_022231D4(CPUState* cpu) {
         /* 02223298 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 02223298 */ cpu->r[9] = _t21;
         /* 0222329C */ cpu->r[10] = 0x101D0000u;
-        /* 022232A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 022232A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 022232A4 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 022232A8 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022232A8 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022232A8 */ _t23 = _t22 & 0x00000001u;
         /* 022232A8 */ if (_t23) goto L_022232AC; else goto L_022232C0;
   L_022232AC: ; // 0x22232ac
@@ -28391,8 +28391,8 @@ void Gambit_fn_022231D4(CPUState* cpu) {
         /* 022232BC */ _t25 = cpu->r[10] + 0x00000000u;
         /* 022232BC */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_022232C0: ; // 0x22232c0
-        /* 022232C0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 022232C4 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022232C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 022232C4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022232C4 */ _t27 = _t26 & 0x00000001u;
         /* 022232C4 */ if (_t27) goto L_022232C8; else goto L_022232D0;
   L_022232C8: ; // 0x22232c8
@@ -28404,9 +28404,9 @@ void Gambit_fn_022231D4(CPUState* cpu) {
         /* 022232D4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 022232D4 */ cpu->r[10] = _t28;
         /* 022232D8 */ cpu->r[11] = 0x101D0000u;
-        /* 022232DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 022232DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 022232E0 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 022232E4 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022232E4 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022232E4 */ _t30 = _t29 & 0x00000001u;
         /* 022232E4 */ if (_t30) goto L_022232E8; else goto L_022232FC;
   L_022232E8: ; // 0x22232e8
@@ -28487,18 +28487,18 @@ void Gambit_fn_02223348(CPUState* cpu) {
         /* 02223350 */ _t2 = cpu->r[1] + 0x00000008u;
         /* 02223350 */ rbrew_write32(cpu->mem, _t2, cpu->r[30]);
         /* 02223354 */ cpu->r[31] = cpu->r[3];
-        /* 02223354 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02223354 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02223358 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02223358 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 0222335C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222335C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222335C */ _t5 = _t4 & 0x00000001u;
         /* 0222335C */ if (_t5) goto L_02223360; else goto L_02223370;
   L_02223360: ; // 0x2223360
         /* 02223360 */ cpu->r[3] = 0x000001A8u;
         /* 02223364 */ Gambit_fn_02801A78(cpu);
         /* 02223368 */ cpu->r[31] = cpu->r[3];
-        /* 02223368 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0222336C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223368 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0222336C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222336C */ _t7 = _t6 & 0x00000001u;
         /* 0222336C */ if (_t7) goto L_022233E8; else goto L_02223370;
   L_02223370: ; // 0x2223370
@@ -28507,10 +28507,10 @@ void Gambit_fn_02223348(CPUState* cpu) {
         /* 02223378 */ cpu->r[12] = 0x10050000u;
         /* 0222337C */ cpu->r[12] = cpu->r[12] + 0xFFFFD9FCu;
         /* 02223380 */ cpu->r[0] = cpu->r[31] + 0x00000128u;
-        /* 02223380 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02223380 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02223384 */ _t8 = cpu->r[31] + 0x00000004u;
         /* 02223384 */ rbrew_write32(cpu->mem, _t8, cpu->r[12]);
-        /* 02223388 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223388 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223388 */ _t10 = _t9 & 0x00000001u;
         /* 02223388 */ if (_t10) goto L_0222338C; else goto L_02223394;
   L_0222338C: ; // 0x222338c
@@ -28518,8 +28518,8 @@ void Gambit_fn_02223348(CPUState* cpu) {
         /* 02223390 */ Gambit_fn_02801A78(cpu);
   L_02223394: ; // 0x2223394
         /* 02223394 */ cpu->r[11] = cpu->r[31] + 0x00000158u;
-        /* 02223394 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02223398 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223394 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02223398 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223398 */ _t12 = _t11 & 0x00000001u;
         /* 02223398 */ if (_t12) goto L_0222339C; else goto L_022233A4;
   L_0222339C: ; // 0x222339c
@@ -28527,8 +28527,8 @@ void Gambit_fn_02223348(CPUState* cpu) {
         /* 022233A0 */ Gambit_fn_02801A78(cpu);
   L_022233A4: ; // 0x22233a4
         /* 022233A4 */ cpu->r[12] = cpu->r[31] + 0x00000164u;
-        /* 022233A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022233A8 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022233A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022233A8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022233A8 */ _t14 = _t13 & 0x00000001u;
         /* 022233A8 */ if (_t14) goto L_022233AC; else goto L_022233B4;
   L_022233AC: ; // 0x22233ac
@@ -28536,8 +28536,8 @@ void Gambit_fn_02223348(CPUState* cpu) {
         /* 022233B0 */ Gambit_fn_02801A78(cpu);
   L_022233B4: ; // 0x22233b4
         /* 022233B4 */ cpu->r[0] = cpu->r[31] + 0x00000194u;
-        /* 022233B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022233B8 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022233B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022233B8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022233B8 */ _t16 = _t15 & 0x00000001u;
         /* 022233B8 */ if (_t16) goto L_022233BC; else goto L_022233C4;
   L_022233BC: ; // 0x22233bc
@@ -28546,17 +28546,17 @@ void Gambit_fn_02223348(CPUState* cpu) {
   L_022233C4: ; // 0x22233c4
         /* 022233C4 */ cpu->r[30] = 0x00000000u;
         /* 022233C8 */ cpu->r[3] = cpu->r[31] + 0x000001A4u;
-        /* 022233C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 022233C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 022233CC */ _t17 = cpu->r[31] + 0x000001A0u;
         /* 022233CC */ rbrew_write8(cpu->mem, _t17, (uint8_t)cpu->r[30]);
-        /* 022233D0 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022233D0 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022233D0 */ _t19 = _t18 & 0x00000001u;
         /* 022233D0 */ if (_t19) goto L_022233D4; else goto L_022233E4;
   L_022233D4: ; // 0x22233d4
         /* 022233D4 */ cpu->r[3] = 0x00000004u;
         /* 022233D8 */ Gambit_fn_02801A78(cpu);
-        /* 022233DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022233E0 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022233DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022233E0 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022233E0 */ _t21 = _t20 & 0x00000001u;
         /* 022233E0 */ if (_t21) goto L_022233E8; else goto L_022233E4;
   L_022233E4: ; // 0x22233e4
@@ -28768,7 +28768,7 @@ void Gambit_fn_02223404(CPUState* cpu) {
         /* 022235FC */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t57);
         /* 02223600 */ _t58 = cpu->r[1] + 0x00000130u;
         /* 02223600 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t58);
-        /* 02223604 */ _t59 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02223604 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02223604 */ _t60 = _t59 & 0x00000001u;
         /* 02223604 */ if (_t60) goto L_02223608; // else: addr-0 trap, fall-through
   L_02223608: ; // 0x2223608
@@ -28972,7 +28972,7 @@ void Gambit_fn_02223618(CPUState* cpu) {
         /* 022235FC */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t57);
         /* 02223600 */ _t58 = cpu->r[1] + 0x00000130u;
         /* 02223600 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t58);
-        /* 02223604 */ _t59 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02223604 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02223604 */ _t60 = _t59 & 0x00000001u;
         /* 02223604 */ if (_t60) goto L_02223608; // else: addr-0 trap, fall-through
   L_02223608: ; // 0x2223608
@@ -29116,8 +29116,8 @@ void Gambit_fn_02223664(CPUState* cpu) {
         /* 022236F0 */ cpu->f[30] = fma(cpu->f[10], cpu->f[10], cpu->f[11]);
         /* 022236F4 */ _t21 = cpu->r[10] + 0xFFFFD978u;
         /* 022236F4 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t21);
-        /* 022236F8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
-        /* 022236FC */ _t22 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022236F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
+        /* 022236FC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022236FC */ _t23 = _t22 & 0x00000001u;
         /* 022236FC */ if (_t23) goto L_02223700; else goto L_02223740;
   L_02223700: ; // 0x2223700
@@ -29150,8 +29150,8 @@ void Gambit_fn_02223664(CPUState* cpu) {
         /* 0222374C */ _t30 = cpu->r[12] + 0xFFFFD9E4u;
         /* 0222374C */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t30);
         /* 02223750 */ cpu->f[30] = cpu->f[30] / cpu->f[12];
-        /* 02223754 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
-        /* 02223758 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223754 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
+        /* 02223758 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223758 */ _t32 = _t31 & 0x00000001u;
         /* 02223758 */ if (_t32) goto L_02223790; else goto L_0222375C;
   L_0222375C: ; // 0x222375c
@@ -29188,7 +29188,7 @@ void Gambit_fn_02223664(CPUState* cpu) {
         /* 022237B8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t38);
         /* 022237BC */ _t39 = cpu->r[1] + 0x00000060u;
         /* 022237BC */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t39);
-        /* 022237C0 */ _t40 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022237C0 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022237C0 */ _t41 = _t40 & 0x00000001u;
         /* 022237C0 */ if (_t41) goto L_022237C4; // else: addr-0 trap, fall-through
   L_022237C4: ; // 0x22237c4
@@ -29264,8 +29264,8 @@ void Gambit_fn_02223668(CPUState* cpu) {
         /* 022236F0 */ cpu->f[30] = fma(cpu->f[10], cpu->f[10], cpu->f[11]);
         /* 022236F4 */ _t21 = cpu->r[10] + 0xFFFFD978u;
         /* 022236F4 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t21);
-        /* 022236F8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
-        /* 022236FC */ _t22 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022236F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
+        /* 022236FC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022236FC */ _t23 = _t22 & 0x00000001u;
         /* 022236FC */ if (_t23) goto L_02223700; else goto L_02223740;
   L_02223700: ; // 0x2223700
@@ -29298,8 +29298,8 @@ void Gambit_fn_02223668(CPUState* cpu) {
         /* 0222374C */ _t30 = cpu->r[12] + 0xFFFFD9E4u;
         /* 0222374C */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t30);
         /* 02223750 */ cpu->f[30] = cpu->f[30] / cpu->f[12];
-        /* 02223754 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
-        /* 02223758 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223754 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
+        /* 02223758 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223758 */ _t32 = _t31 & 0x00000001u;
         /* 02223758 */ if (_t32) goto L_02223790; else goto L_0222375C;
   L_0222375C: ; // 0x222375c
@@ -29336,7 +29336,7 @@ void Gambit_fn_02223668(CPUState* cpu) {
         /* 022237B8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t38);
         /* 022237BC */ _t39 = cpu->r[1] + 0x00000060u;
         /* 022237BC */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t39);
-        /* 022237C0 */ _t40 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022237C0 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022237C0 */ _t41 = _t40 & 0x00000001u;
         /* 022237C0 */ if (_t41) goto L_022237C4; // else: addr-0 trap, fall-through
   L_022237C4: ; // 0x22237c4
@@ -29371,8 +29371,8 @@ void Gambit_fn_022237D8(CPUState* cpu) {
         /* 022237D8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 022237DC */ _t1 = cpu->r[5] + 0x00000000u;
         /* 022237DC */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
-        /* 022237E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
-        /* 022237E4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022237E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
+        /* 022237E4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022237E4 */ _t3 = _t2 & 0x00000001u;
         /* 022237E4 */ if (_t3) goto L_022237E8; else goto L_022237F4;
   L_022237E8: ; // 0x22237e8
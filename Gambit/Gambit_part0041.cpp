@@ -40,7 +40,7 @@ void Gambit_fn_02223830(CPUState* cpu) {
         /* 0222383C */ _t2 = cpu->r[4] + 0x00000000u;
         /* 0222383C */ rbrew_write16(cpu->mem, _t2, (uint16_t)cpu->r[10]);
         /* 02223840 */ cpu->r[12] = cpu->r[11] & 0x0000FEFFu;
-        /* 02223840 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02223840 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02223844 */ cpu->r[0] = 0x00000000u;
         /* 02223848 */ _t3 = cpu->r[4] + 0x00000002u;
         /* 02223848 */ rbrew_write16(cpu->mem, _t3, (uint16_t)cpu->r[12]);
@@ -89,9 +89,9 @@ void Gambit_fn_02223878(CPUState* cpu) {
         /* 0222388C */ _t3 = cpu->r[31] + 0x000001A0u;
         /* 0222388C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02223890 */ cpu->r[11] = cpu->r[5];
-        /* 02223894 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02223894 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02223898 */ cpu->r[8] = cpu->r[7];
-        /* 0222389C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222389C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222389C */ _t5 = _t4 & 0x00000001u;
         /* 0222389C */ if (_t5) goto L_022238D4; else goto L_022238A0;
   L_022238A0: ; // 0x22238a0
@@ -139,9 +139,9 @@ void Gambit_fn_0222387C(CPUState* cpu) {
         /* 0222388C */ _t3 = cpu->r[31] + 0x000001A0u;
         /* 0222388C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02223890 */ cpu->r[11] = cpu->r[5];
-        /* 02223894 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02223894 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02223898 */ cpu->r[8] = cpu->r[7];
-        /* 0222389C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222389C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222389C */ _t5 = _t4 & 0x00000001u;
         /* 0222389C */ if (_t5) goto L_022238D4; else goto L_022238A0;
   L_022238A0: ; // 0x22238a0
@@ -213,13 +213,13 @@ void Gambit_fn_022238E8(CPUState* cpu) {
         /* 02223938 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0222393C */ _t11 = cpu->r[29] + 0x00000052u;
         /* 0222393C */ cpu->r[12] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t11);
-        /* 02223940 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[3]);
-        /* 02223944 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02223940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[3]));
+        /* 02223944 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02223944 */ _t13 = _t12 & 0x00000001u;
         /* 02223944 */ if (_t13) goto L_02223950; else goto L_02223948;
   L_02223948: ; // 0x2223948
-        /* 02223948 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222394C */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02223948 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222394C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222394C */ _t15 = _t14 & 0x00000001u;
         /* 0222394C */ if (_t15) goto L_02223950; else goto L_02223A40;
   L_02223950: ; // 0x2223950
@@ -231,11 +231,11 @@ void Gambit_fn_022238E8(CPUState* cpu) {
         /* 02223960 */ cpu->f[3] = cpu->f[1];
         /* 02223964 */ _t17 = cpu->r[11] + 0x00001EF8u;
         /* 02223964 */ cpu->r[3] = rbrew_read32(cpu->mem, _t17);
-        /* 02223968 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[0]);
+        /* 02223968 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[0]));
         /* 0222396C */ _t18 = cpu->r[29] + 0x000000B4u;
         /* 0222396C */ cpu->r[9] = rbrew_read32(cpu->mem, _t18);
         /* 02223970 */ cpu->r[4] = cpu->r[30];
-        /* 02223974 */ _t19 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02223974 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02223974 */ _t20 = _t19 & 0x00000001u;
         /* 02223974 */ if (_t20) goto L_022239DC; else goto L_02223978;
   L_02223978: ; // 0x2223978
@@ -268,7 +268,7 @@ void Gambit_fn_022238E8(CPUState* cpu) {
         /* 022239C0 */ _t29 = cpu->r[1] + 0x00000014u;
         /* 022239C0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t29);
         /* 022239C4 */ cpu->r[3] = 0x00000001u;
-        /* 022239C8 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022239C8 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022239C8 */ _t31 = _t30 & 0x00000001u;
         /* 022239C8 */ if (_t31) goto L_022239CC; // else: addr-0 trap, fall-through
   L_022239CC: ; // 0x22239cc
@@ -307,7 +307,7 @@ void Gambit_fn_022238E8(CPUState* cpu) {
         /* 02223A24 */ _t41 = cpu->r[1] + 0x00000014u;
         /* 02223A24 */ cpu->r[31] = rbrew_read32(cpu->mem, _t41);
         /* 02223A28 */ cpu->r[3] = 0x00000001u;
-        /* 02223A2C */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02223A2C */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02223A2C */ _t43 = _t42 & 0x00000001u;
         /* 02223A2C */ if (_t43) goto L_02223A30; // else: addr-0 trap, fall-through
   L_02223A30: ; // 0x2223a30
@@ -337,7 +337,7 @@ void Gambit_fn_022238E8(CPUState* cpu) {
         /* 02223A6C */ cpu->r[31] = rbrew_read32(cpu->mem, _t50);
         /* 02223A70 */ _t51 = cpu->r[1] + 0x00000010u;
         /* 02223A70 */ cpu->r[30] = rbrew_read32(cpu->mem, _t51);
-        /* 02223A74 */ _t52 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02223A74 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02223A74 */ _t53 = _t52 & 0x00000001u;
         /* 02223A74 */ if (_t53) goto L_02223A78; // else: addr-0 trap, fall-through
   L_02223A78: ; // 0x2223a78
@@ -387,13 +387,13 @@ void Gambit_fn_022238EC(CPUState* cpu) {
         /* 02223938 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0222393C */ _t11 = cpu->r[29] + 0x00000052u;
         /* 0222393C */ cpu->r[12] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t11);
-        /* 02223940 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[3]);
-        /* 02223944 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02223940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[3]));
+        /* 02223944 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02223944 */ _t13 = _t12 & 0x00000001u;
         /* 02223944 */ if (_t13) goto L_02223950; else goto L_02223948;
   L_02223948: ; // 0x2223948
-        /* 02223948 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222394C */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02223948 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222394C */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222394C */ _t15 = _t14 & 0x00000001u;
         /* 0222394C */ if (_t15) goto L_02223950; else goto L_02223A40;
   L_02223950: ; // 0x2223950
@@ -405,11 +405,11 @@ void Gambit_fn_022238EC(CPUState* cpu) {
         /* 02223960 */ cpu->f[3] = cpu->f[1];
         /* 02223964 */ _t17 = cpu->r[11] + 0x00001EF8u;
         /* 02223964 */ cpu->r[3] = rbrew_read32(cpu->mem, _t17);
-        /* 02223968 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[0]);
+        /* 02223968 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[0]));
         /* 0222396C */ _t18 = cpu->r[29] + 0x000000B4u;
         /* 0222396C */ cpu->r[9] = rbrew_read32(cpu->mem, _t18);
         /* 02223970 */ cpu->r[4] = cpu->r[30];
-        /* 02223974 */ _t19 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02223974 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02223974 */ _t20 = _t19 & 0x00000001u;
         /* 02223974 */ if (_t20) goto L_022239DC; else goto L_02223978;
   L_02223978: ; // 0x2223978
@@ -442,7 +442,7 @@ void Gambit_fn_022238EC(CPUState* cpu) {
         /* 022239C0 */ _t29 = cpu->r[1] + 0x00000014u;
         /* 022239C0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t29);
         /* 022239C4 */ cpu->r[3] = 0x00000001u;
-        /* 022239C8 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022239C8 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022239C8 */ _t31 = _t30 & 0x00000001u;
         /* 022239C8 */ if (_t31) goto L_022239CC; // else: addr-0 trap, fall-through
   L_022239CC: ; // 0x22239cc
@@ -481,7 +481,7 @@ void Gambit_fn_022238EC(CPUState* cpu) {
         /* 02223A24 */ _t41 = cpu->r[1] + 0x00000014u;
         /* 02223A24 */ cpu->r[31] = rbrew_read32(cpu->mem, _t41);
         /* 02223A28 */ cpu->r[3] = 0x00000001u;
-        /* 02223A2C */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02223A2C */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02223A2C */ _t43 = _t42 & 0x00000001u;
         /* 02223A2C */ if (_t43) goto L_02223A30; // else: addr-0 trap, fall-through
   L_02223A30: ; // 0x2223a30
@@ -511,7 +511,7 @@ void Gambit_fn_022238EC(CPUState* cpu) {
         /* 02223A6C */ cpu->r[31] = rbrew_read32(cpu->mem, _t50);
         /* 02223A70 */ _t51 = cpu->r[1] + 0x00000010u;
         /* 02223A70 */ cpu->r[30] = rbrew_read32(cpu->mem, _t51);
-        /* 02223A74 */ _t52 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02223A74 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02223A74 */ _t53 = _t52 & 0x00000001u;
         /* 02223A74 */ if (_t53) goto L_02223A78; // else: addr-0 trap, fall-through
   L_02223A78: ; // 0x2223a78
@@ -774,9 +774,9 @@ void Gambit_fn_02223B94(CPUState* cpu) {
         /* 02031BE4 */ _t4 = cpu->r[4] + 0x00000000u;
         /* 02031BE4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t4);
         /* 02031BE8 */ cpu->r[31] = cpu->r[4];
-        /* 02031BEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02031BEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02031BF0 */ cpu->r[30] = cpu->r[3];
-        /* 02031BF4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02031BF4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02031BF4 */ _t6 = _t5 & 0x00000001u;
         /* 02031BF4 */ if (_t6) goto L_02031C58; else goto L_02031BF8;
   L_02031BF8: ; // 0x2031bf8
@@ -784,8 +784,8 @@ void Gambit_fn_02223B94(CPUState* cpu) {
         /* 02031BF8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
         /* 02031BFC */ _t8 = cpu->r[3] + 0x0000011Cu;
         /* 02031BFC */ cpu->r[11] = rbrew_read8(cpu->mem, _t8);
-        /* 02031C00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02031C04 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02031C00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02031C04 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02031C04 */ _t10 = _t9 & 0x00000001u;
         /* 02031C04 */ if (_t10) goto L_02031C58; else goto L_02031C08;
   L_02031C08: ; // 0x2031c08
@@ -891,8 +891,8 @@ void Gambit_fn_02223BC4(CPUState* cpu) {
         /* 02223BC4 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02223BC4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02223BC8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 02223BC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02223BCC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223BC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02223BCC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223BCC */ _t2 = _t1 & 0x00000001u;
         /* 02223BCC */ _t3 = _t2 ^ 0x00000001u;
         /* 02223BCC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -914,8 +914,8 @@ void Gambit_fn_02223BE0(CPUState* cpu) {
         /* 02223BE0 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02223BE0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02223BE4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 02223BE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02223BE8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223BE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02223BE8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223BE8 */ _t2 = _t1 & 0x00000001u;
         /* 02223BE8 */ _t3 = _t2 ^ 0x00000001u;
         /* 02223BE8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -937,8 +937,8 @@ void Gambit_fn_02223BFC(CPUState* cpu) {
         /* 02223BFC */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02223BFC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02223C00 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 02223C00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02223C04 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223C00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02223C04 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223C04 */ _t2 = _t1 & 0x00000001u;
         /* 02223C04 */ _t3 = _t2 ^ 0x00000001u;
         /* 02223C04 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -981,8 +981,8 @@ void Gambit_fn_02223C28(CPUState* cpu) {
         /* 02223C38 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02223C3C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02223C3C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02223C40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02223C44 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223C40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02223C44 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223C44 */ _t5 = _t4 & 0x00000001u;
         /* 02223C44 */ if (_t5) goto L_02223C48; else goto L_02223C64;
   L_02223C48: ; // 0x2223c48
@@ -1021,8 +1021,8 @@ void Gambit_fn_02223C2C(CPUState* cpu) {
         /* 02223C38 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02223C3C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02223C3C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02223C40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02223C44 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223C40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02223C44 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223C44 */ _t5 = _t4 & 0x00000001u;
         /* 02223C44 */ if (_t5) goto L_02223C48; else goto L_02223C64;
   L_02223C48: ; // 0x2223c48
@@ -1470,8 +1470,8 @@ void Gambit_fn_02223E34(CPUState* cpu) {
         /* 02223E34 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 02223E34 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02223E38 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 02223E38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02223E3C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223E38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02223E3C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223E3C */ _t2 = _t1 & 0x00000001u;
         /* 02223E3C */ if (_t2) goto L_02223E4C; else goto L_02223E40;
   L_02223E40: ; // 0x2223e40
@@ -1500,8 +1500,8 @@ void Gambit_fn_02223E58(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -1567,10 +1567,10 @@ void Gambit_fn_02223E88(CPUState* cpu) {
         /* 02223E88 */ cpu->r[10] = 0x101D0000u;
         /* 02223E8C */ _t0 = cpu->r[10] + 0xFFFFFDB4u;
         /* 02223E8C */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 02223E90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02223E90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02223E94 */ cpu->r[10] = 0x101D0000u;
         /* 02223E98 */ cpu->r[10] = cpu->r[10] + 0xFFFFFF64u;
-        /* 02223E9C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223E9C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223E9C */ _t2 = _t1 & 0x00000001u;
         /* 02223E9C */ if (_t2) goto L_02223EA0; else goto L_02223EB8;
   L_02223EA0: ; // 0x2223ea0
@@ -1583,8 +1583,8 @@ void Gambit_fn_02223E88(CPUState* cpu) {
         /* 02223EB4 */ _t4 = cpu->r[10] + 0x00000000u;
         /* 02223EB4 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_02223EB8: ; // 0x2223eb8
-        /* 02223EB8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02223EBC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223EB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02223EBC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223EBC */ _t6 = _t5 & 0x00000001u;
         /* 02223EBC */ if (_t6) goto L_02223EC0; else goto L_02223EC8;
   L_02223EC0: ; // 0x2223ec0
@@ -1595,9 +1595,9 @@ void Gambit_fn_02223E88(CPUState* cpu) {
         /* 02223ECC */ _t7 = cpu->r[9] + 0xFFFFDA00u;
         /* 02223ECC */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 02223ED0 */ cpu->r[11] = 0x101D0000u;
-        /* 02223ED4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02223ED4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02223ED8 */ cpu->r[11] = cpu->r[11] + 0xFFFFFBFCu;
-        /* 02223EDC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223EDC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223EDC */ _t9 = _t8 & 0x00000001u;
         /* 02223EDC */ if (_t9) goto L_02223EE0; else goto L_02223EF8;
   L_02223EE0: ; // 0x2223ee0
@@ -1610,8 +1610,8 @@ void Gambit_fn_02223E88(CPUState* cpu) {
         /* 02223EF4 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 02223EF4 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_02223EF8: ; // 0x2223ef8
-        /* 02223EF8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 02223EFC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223EF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 02223EFC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223EFC */ _t13 = _t12 & 0x00000001u;
         /* 02223EFC */ if (_t13) goto L_02223F00; else goto L_02223F08;
   L_02223F00: ; // 0x2223f00
@@ -1622,9 +1622,9 @@ void Gambit_fn_02223E88(CPUState* cpu) {
         /* 02223F0C */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 02223F0C */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 02223F10 */ cpu->r[9] = 0x101D0000u;
-        /* 02223F14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02223F14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02223F18 */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 02223F1C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223F1C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223F1C */ _t16 = _t15 & 0x00000001u;
         /* 02223F1C */ if (_t16) goto L_02223F20; else goto L_02223F38;
   L_02223F20: ; // 0x2223f20
@@ -1637,8 +1637,8 @@ void Gambit_fn_02223E88(CPUState* cpu) {
         /* 02223F34 */ _t18 = cpu->r[9] + 0x00000000u;
         /* 02223F34 */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_02223F38: ; // 0x2223f38
-        /* 02223F38 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 02223F3C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223F38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 02223F3C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223F3C */ _t20 = _t19 & 0x00000001u;
         /* 02223F3C */ if (_t20) goto L_02223F40; else goto L_02223F48;
   L_02223F40: ; // 0x2223f40
@@ -1650,9 +1650,9 @@ void Gambit_fn_02223E88(CPUState* cpu) {
         /* 02223F4C */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 02223F4C */ cpu->r[9] = _t21;
         /* 02223F50 */ cpu->r[10] = 0x101D0000u;
-        /* 02223F54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02223F54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02223F58 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 02223F5C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223F5C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223F5C */ _t23 = _t22 & 0x00000001u;
         /* 02223F5C */ if (_t23) goto L_02223F60; else goto L_02223F74;
   L_02223F60: ; // 0x2223f60
@@ -1664,8 +1664,8 @@ void Gambit_fn_02223E88(CPUState* cpu) {
         /* 02223F70 */ _t25 = cpu->r[10] + 0x00000000u;
         /* 02223F70 */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_02223F74: ; // 0x2223f74
-        /* 02223F74 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02223F78 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223F74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02223F78 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223F78 */ _t27 = _t26 & 0x00000001u;
         /* 02223F78 */ if (_t27) goto L_02223F7C; else goto L_02223F84;
   L_02223F7C: ; // 0x2223f7c
@@ -1677,9 +1677,9 @@ void Gambit_fn_02223E88(CPUState* cpu) {
         /* 02223F88 */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 02223F88 */ cpu->r[10] = _t28;
         /* 02223F8C */ cpu->r[11] = 0x101D0000u;
-        /* 02223F90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02223F90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02223F94 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 02223F98 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02223F98 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02223F98 */ _t30 = _t29 & 0x00000001u;
         /* 02223F98 */ if (_t30) goto L_02223F9C; else goto L_02223FB0;
   L_02223F9C: ; // 0x2223f9c
@@ -1761,18 +1761,18 @@ void Gambit_fn_02223FF4(CPUState* cpu) {
         /* 02224008 */ _t4 = cpu->r[1] + 0x00000010u;
         /* 02224008 */ rbrew_write32(cpu->mem, _t4, cpu->r[30]);
         /* 0222400C */ cpu->r[31] = cpu->r[3];
-        /* 0222400C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0222400C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02224010 */ _t5 = cpu->r[1] + 0x0000001Cu;
         /* 02224010 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
-        /* 02224014 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224014 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224014 */ _t7 = _t6 & 0x00000001u;
         /* 02224014 */ if (_t7) goto L_02224018; else goto L_02224028;
   L_02224018: ; // 0x2224018
         /* 02224018 */ cpu->r[3] = 0x00000228u;
         /* 0222401C */ Gambit_fn_02801A78(cpu);
         /* 02224020 */ cpu->r[31] = cpu->r[3];
-        /* 02224020 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02224024 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224020 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02224024 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224024 */ _t9 = _t8 & 0x00000001u;
         /* 02224024 */ if (_t9) goto L_02224134; else goto L_02224028;
   L_02224028: ; // 0x2224028
@@ -1784,18 +1784,18 @@ void Gambit_fn_02223FF4(CPUState* cpu) {
         /* 0222403C */ _t10 = cpu->r[31] + 0x00000128u;
         /* 0222403C */ rbrew_write32(cpu->mem, _t10, cpu->r[30]);
         /* 02224040 */ cpu->r[28] = cpu->r[31] + 0x0000012Cu;
-        /* 02224040 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 02224040 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 02224044 */ _t11 = cpu->r[31] + 0x00000004u;
         /* 02224044 */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
-        /* 02224048 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224048 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224048 */ _t13 = _t12 & 0x00000001u;
         /* 02224048 */ if (_t13) goto L_0222404C; else goto L_0222405C;
   L_0222404C: ; // 0x222404c
         /* 0222404C */ cpu->r[3] = 0x00000088u;
         /* 02224050 */ Gambit_fn_02801A78(cpu);
         /* 02224054 */ cpu->r[28] = cpu->r[3];
-        /* 02224054 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 02224058 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 02224058 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224058 */ _t15 = _t14 & 0x00000001u;
         /* 02224058 */ if (_t15) goto L_022240B8; else goto L_0222405C;
   L_0222405C: ; // 0x222405c
@@ -1821,8 +1821,8 @@ void Gambit_fn_02223FF4(CPUState* cpu) {
         /* 022240A0 */ cpu->r[6] = cpu->r[6] + 0x00005804u;
         /* 022240A4 */ Gambit_fn_02C82E00(cpu);
         /* 022240A8 */ cpu->r[7] = cpu->r[28] + 0x0000007Cu;
-        /* 022240A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 022240AC */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022240A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 022240AC */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022240AC */ _t19 = _t18 & 0x00000001u;
         /* 022240AC */ if (_t19) goto L_022240B0; else goto L_022240B8;
   L_022240B0: ; // 0x22240b0
@@ -1831,10 +1831,10 @@ void Gambit_fn_02223FF4(CPUState* cpu) {
   L_022240B8: ; // 0x22240b8
         /* 022240B8 */ cpu->r[8] = 0x00000003u;
         /* 022240BC */ cpu->r[9] = cpu->r[31] + 0x000001B8u;
-        /* 022240BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 022240BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 022240C0 */ _t20 = cpu->r[31] + 0x000001B4u;
         /* 022240C0 */ rbrew_write32(cpu->mem, _t20, cpu->r[8]);
-        /* 022240C4 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022240C4 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022240C4 */ _t22 = _t21 & 0x00000001u;
         /* 022240C4 */ if (_t22) goto L_022240C8; else goto L_022240D0;
   L_022240C8: ; // 0x22240c8
@@ -1844,10 +1844,10 @@ void Gambit_fn_02223FF4(CPUState* cpu) {
         /* 022240D0 */ _t23 = cpu->r[31] + 0x000001C0u;
         /* 022240D0 */ rbrew_write16(cpu->mem, _t23, (uint16_t)cpu->r[30]);
         /* 022240D4 */ cpu->r[10] = cpu->r[31] + 0x000001C4u;
-        /* 022240D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 022240D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 022240D8 */ _t24 = cpu->r[31] + 0x000001C2u;
         /* 022240D8 */ rbrew_write16(cpu->mem, _t24, (uint16_t)cpu->r[30]);
-        /* 022240DC */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022240DC */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022240DC */ _t26 = _t25 & 0x00000001u;
         /* 022240DC */ if (_t26) goto L_022240E0; else goto L_022240E8;
   L_022240E0: ; // 0x22240e0
@@ -1855,8 +1855,8 @@ void Gambit_fn_02223FF4(CPUState* cpu) {
         /* 022240E4 */ Gambit_fn_02801A78(cpu);
   L_022240E8: ; // 0x22240e8
         /* 022240E8 */ cpu->r[11] = cpu->r[31] + 0x000001D0u;
-        /* 022240E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 022240EC */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022240E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 022240EC */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022240EC */ _t28 = _t27 & 0x00000001u;
         /* 022240EC */ if (_t28) goto L_022240F0; else goto L_022240F8;
   L_022240F0: ; // 0x22240f0
@@ -1869,7 +1869,7 @@ void Gambit_fn_02223FF4(CPUState* cpu) {
         /* 02224100 */ _t30 = cpu->r[31] + 0x000001DCu;
         /* 02224100 */ rbrew_write8(cpu->mem, _t30, (uint8_t)cpu->r[30]);
         /* 02224104 */ cpu->r[0] = cpu->r[31] + 0x000001ECu;
-        /* 02224104 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02224104 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02224108 */ _t31 = cpu->r[31] + 0x000001E0u;
         /* 02224108 */ rbrew_write8(cpu->mem, _t31, (uint8_t)cpu->r[30]);
         /* 0222410C */ _t32 = cpu->r[6] + 0xFFFFDEF4u;
@@ -1878,7 +1878,7 @@ void Gambit_fn_02223FF4(CPUState* cpu) {
         /* 02224110 */ rbrew_write32(cpu->mem, _t33, cpu->r[30]);
         /* 02224114 */ _t34 = cpu->r[31] + 0x000001E8u;
         /* 02224114 */ rbrew_write_f32(cpu->mem, _t34, cpu->f[0]);
-        /* 02224118 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224118 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224118 */ _t36 = _t35 & 0x00000001u;
         /* 02224118 */ if (_t36) goto L_0222411C; else goto L_02224124;
   L_0222411C: ; // 0x222411c
@@ -1886,8 +1886,8 @@ void Gambit_fn_02223FF4(CPUState* cpu) {
         /* 02224120 */ Gambit_fn_02801A78(cpu);
   L_02224124: ; // 0x2224124
         /* 02224124 */ cpu->r[0] = cpu->r[31] + 0x0000021Cu;
-        /* 02224124 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02224128 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224124 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02224128 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224128 */ _t38 = _t37 & 0x00000001u;
         /* 02224128 */ if (_t38) goto L_0222412C; else goto L_02224134;
   L_0222412C: ; // 0x222412c
@@ -1927,18 +1927,18 @@ void Gambit_fn_02223FF8(CPUState* cpu) {
         /* 02224008 */ _t4 = cpu->r[1] + 0x00000010u;
         /* 02224008 */ rbrew_write32(cpu->mem, _t4, cpu->r[30]);
         /* 0222400C */ cpu->r[31] = cpu->r[3];
-        /* 0222400C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0222400C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02224010 */ _t5 = cpu->r[1] + 0x0000001Cu;
         /* 02224010 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
-        /* 02224014 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224014 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224014 */ _t7 = _t6 & 0x00000001u;
         /* 02224014 */ if (_t7) goto L_02224018; else goto L_02224028;
   L_02224018: ; // 0x2224018
         /* 02224018 */ cpu->r[3] = 0x00000228u;
         /* 0222401C */ Gambit_fn_02801A78(cpu);
         /* 02224020 */ cpu->r[31] = cpu->r[3];
-        /* 02224020 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02224024 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224020 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02224024 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224024 */ _t9 = _t8 & 0x00000001u;
         /* 02224024 */ if (_t9) goto L_02224134; else goto L_02224028;
   L_02224028: ; // 0x2224028
@@ -1950,18 +1950,18 @@ void Gambit_fn_02223FF8(CPUState* cpu) {
         /* 0222403C */ _t10 = cpu->r[31] + 0x00000128u;
         /* 0222403C */ rbrew_write32(cpu->mem, _t10, cpu->r[30]);
         /* 02224040 */ cpu->r[28] = cpu->r[31] + 0x0000012Cu;
-        /* 02224040 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 02224040 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 02224044 */ _t11 = cpu->r[31] + 0x00000004u;
         /* 02224044 */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
-        /* 02224048 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224048 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224048 */ _t13 = _t12 & 0x00000001u;
         /* 02224048 */ if (_t13) goto L_0222404C; else goto L_0222405C;
   L_0222404C: ; // 0x222404c
         /* 0222404C */ cpu->r[3] = 0x00000088u;
         /* 02224050 */ Gambit_fn_02801A78(cpu);
         /* 02224054 */ cpu->r[28] = cpu->r[3];
-        /* 02224054 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 02224058 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 02224058 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224058 */ _t15 = _t14 & 0x00000001u;
         /* 02224058 */ if (_t15) goto L_022240B8; else goto L_0222405C;
   L_0222405C: ; // 0x222405c
@@ -1987,8 +1987,8 @@ void Gambit_fn_02223FF8(CPUState* cpu) {
         /* 022240A0 */ cpu->r[6] = cpu->r[6] + 0x00005804u;
         /* 022240A4 */ Gambit_fn_02C82E00(cpu);
         /* 022240A8 */ cpu->r[7] = cpu->r[28] + 0x0000007Cu;
-        /* 022240A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 022240AC */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022240A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 022240AC */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022240AC */ _t19 = _t18 & 0x00000001u;
         /* 022240AC */ if (_t19) goto L_022240B0; else goto L_022240B8;
   L_022240B0: ; // 0x22240b0
@@ -1997,10 +1997,10 @@ void Gambit_fn_02223FF8(CPUState* cpu) {
   L_022240B8: ; // 0x22240b8
         /* 022240B8 */ cpu->r[8] = 0x00000003u;
         /* 022240BC */ cpu->r[9] = cpu->r[31] + 0x000001B8u;
-        /* 022240BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 022240BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 022240C0 */ _t20 = cpu->r[31] + 0x000001B4u;
         /* 022240C0 */ rbrew_write32(cpu->mem, _t20, cpu->r[8]);
-        /* 022240C4 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022240C4 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022240C4 */ _t22 = _t21 & 0x00000001u;
         /* 022240C4 */ if (_t22) goto L_022240C8; else goto L_022240D0;
   L_022240C8: ; // 0x22240c8
@@ -2010,10 +2010,10 @@ void Gambit_fn_02223FF8(CPUState* cpu) {
         /* 022240D0 */ _t23 = cpu->r[31] + 0x000001C0u;
         /* 022240D0 */ rbrew_write16(cpu->mem, _t23, (uint16_t)cpu->r[30]);
         /* 022240D4 */ cpu->r[10] = cpu->r[31] + 0x000001C4u;
-        /* 022240D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 022240D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 022240D8 */ _t24 = cpu->r[31] + 0x000001C2u;
         /* 022240D8 */ rbrew_write16(cpu->mem, _t24, (uint16_t)cpu->r[30]);
-        /* 022240DC */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022240DC */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022240DC */ _t26 = _t25 & 0x00000001u;
         /* 022240DC */ if (_t26) goto L_022240E0; else goto L_022240E8;
   L_022240E0: ; // 0x22240e0
@@ -2021,8 +2021,8 @@ void Gambit_fn_02223FF8(CPUState* cpu) {
         /* 022240E4 */ Gambit_fn_02801A78(cpu);
   L_022240E8: ; // 0x22240e8
         /* 022240E8 */ cpu->r[11] = cpu->r[31] + 0x000001D0u;
-        /* 022240E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 022240EC */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022240E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 022240EC */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022240EC */ _t28 = _t27 & 0x00000001u;
         /* 022240EC */ if (_t28) goto L_022240F0; else goto L_022240F8;
   L_022240F0: ; // 0x22240f0
@@ -2035,7 +2035,7 @@ void Gambit_fn_02223FF8(CPUState* cpu) {
         /* 02224100 */ _t30 = cpu->r[31] + 0x000001DCu;
         /* 02224100 */ rbrew_write8(cpu->mem, _t30, (uint8_t)cpu->r[30]);
         /* 02224104 */ cpu->r[0] = cpu->r[31] + 0x000001ECu;
-        /* 02224104 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02224104 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02224108 */ _t31 = cpu->r[31] + 0x000001E0u;
         /* 02224108 */ rbrew_write8(cpu->mem, _t31, (uint8_t)cpu->r[30]);
         /* 0222410C */ _t32 = cpu->r[6] + 0xFFFFDEF4u;
@@ -2044,7 +2044,7 @@ void Gambit_fn_02223FF8(CPUState* cpu) {
         /* 02224110 */ rbrew_write32(cpu->mem, _t33, cpu->r[30]);
         /* 02224114 */ _t34 = cpu->r[31] + 0x000001E8u;
         /* 02224114 */ rbrew_write_f32(cpu->mem, _t34, cpu->f[0]);
-        /* 02224118 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224118 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224118 */ _t36 = _t35 & 0x00000001u;
         /* 02224118 */ if (_t36) goto L_0222411C; else goto L_02224124;
   L_0222411C: ; // 0x222411c
@@ -2052,8 +2052,8 @@ void Gambit_fn_02223FF8(CPUState* cpu) {
         /* 02224120 */ Gambit_fn_02801A78(cpu);
   L_02224124: ; // 0x2224124
         /* 02224124 */ cpu->r[0] = cpu->r[31] + 0x0000021Cu;
-        /* 02224124 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02224128 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224124 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02224128 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224128 */ _t38 = _t37 & 0x00000001u;
         /* 02224128 */ if (_t38) goto L_0222412C; else goto L_02224134;
   L_0222412C: ; // 0x222412c
@@ -2262,10 +2262,10 @@ void Gambit_fn_02224198(CPUState* cpu) {
         /* 022242AC */ rbrew_write16(cpu->mem, _t45, (uint16_t)cpu->r[24]);
         /* 022242B0 */ _t46 = cpu->r[1] + 0x00000014u;
         /* 022242B0 */ rbrew_write_f32(cpu->mem, _t46, cpu->f[30]);
-        /* 022242B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000002u);
+        /* 022242B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000002u));
         /* 022242B8 */ _t47 = cpu->r[1] + 0x00000054u;
         /* 022242B8 */ rbrew_write32(cpu->mem, _t47, cpu->r[20]);
-        /* 022242BC */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022242BC */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022242BC */ _t49 = _t48 & 0x00000001u;
         /* 022242BC */ if (_t49) goto L_022242C0; else goto L_022242C8;
   L_022242C0: ; // 0x22242c0
@@ -2295,8 +2295,8 @@ void Gambit_fn_02224198(CPUState* cpu) {
         /* 022242F8 */ cpu->r[25] = _t56;
         /* 022242FC */ cpu->r[4] = cpu->r[31];
         /* 02224300 */ Gambit_fn_02227938(cpu);
-        /* 02224304 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02224308 */ _t57 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224304 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02224308 */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224308 */ _t58 = _t57 & 0x00000001u;
         /* 02224308 */ if (_t58) goto L_022243C8; else goto L_0222430C;
   L_0222430C: ; // 0x222430c
@@ -2353,7 +2353,7 @@ void Gambit_fn_02224198(CPUState* cpu) {
         /* 02224390 */ Gambit_fn_02C88F2C(cpu);
         /* 02224394 */ _t76 = cpu->r[30] + 0x000001D8u;
         /* 02224394 */ rbrew_write_f32(cpu->mem, _t76, cpu->f[30]);
-        /* 02224398 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 02224398 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0222439C */ _t77 = cpu->r[30] + 0x000001BCu;
         /* 0222439C */ rbrew_write_f32(cpu->mem, _t77, cpu->f[1]);
         /* 022243A0 */ _t78 = cpu->r[30] + 0x000001C4u;
@@ -2372,7 +2372,7 @@ void Gambit_fn_02224198(CPUState* cpu) {
         /* 022243B8 */ rbrew_write_f32(cpu->mem, _t84, cpu->f[29]);
         /* 022243BC */ _t85 = cpu->r[30] + 0x000001D0u;
         /* 022243BC */ rbrew_write_f32(cpu->mem, _t85, cpu->f[30]);
-        /* 022243C0 */ _t86 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022243C0 */ _t86 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022243C0 */ _t87 = _t86 & 0x00000001u;
         /* 022243C0 */ if (_t87) goto L_02224500; else goto L_022243C4;
   L_022243C4: ; // 0x22243c4
@@ -2412,7 +2412,7 @@ void Gambit_fn_02224198(CPUState* cpu) {
         /* 02224420 */ Gambit_fn_02C88F2C(cpu);
         /* 02224424 */ _t97 = cpu->r[30] + 0x000001D8u;
         /* 02224424 */ rbrew_write_f32(cpu->mem, _t97, cpu->f[30]);
-        /* 02224428 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 02224428 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0222442C */ _t98 = cpu->r[30] + 0x000001BCu;
         /* 0222442C */ rbrew_write_f32(cpu->mem, _t98, cpu->f[1]);
         /* 02224430 */ _t99 = cpu->r[30] + 0x000001C4u;
@@ -2431,7 +2431,7 @@ void Gambit_fn_02224198(CPUState* cpu) {
         /* 02224448 */ rbrew_write_f32(cpu->mem, _t105, cpu->f[30]);
         /* 0222444C */ _t106 = cpu->r[30] + 0x000001B8u;
         /* 0222444C */ rbrew_write_f32(cpu->mem, _t106, cpu->f[29]);
-        /* 02224450 */ _t107 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224450 */ _t107 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224450 */ _t108 = _t107 & 0x00000001u;
         /* 02224450 */ if (_t108) goto L_02224500; else goto L_02224454;
   L_02224454: ; // 0x2224454
@@ -2491,7 +2491,7 @@ void Gambit_fn_02224198(CPUState* cpu) {
         /* 022244E4 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t125);
         /* 022244E8 */ _t126 = cpu->r[1] + 0x000000D8u;
         /* 022244E8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t126);
-        /* 022244EC */ _t127 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022244EC */ _t127 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022244EC */ _t128 = _t127 & 0x00000001u;
         /* 022244EC */ if (_t128) goto L_022244F0; // else: addr-0 trap, fall-through
   L_022244F0: ; // 0x22244f0
@@ -2510,8 +2510,8 @@ void Gambit_fn_02224198(CPUState* cpu) {
         /* 02224510 */ _t132 = cpu->r[8] + 0xFFFFCEDCu;
         /* 02224510 */ cpu->r[3] = rbrew_read32(cpu->mem, _t132);
         /* 02224514 */ Gambit_fn_023E4380(cpu);
-        /* 02224518 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222451C */ _t133 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224518 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222451C */ _t133 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222451C */ _t134 = _t133 & 0x00000001u;
         /* 0222451C */ if (_t134) goto L_022245C8; else goto L_02224520;
   L_02224520: ; // 0x2224520
@@ -2571,7 +2571,7 @@ void Gambit_fn_02224198(CPUState* cpu) {
         /* 022245AC */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t152);
         /* 022245B0 */ _t153 = cpu->r[1] + 0x000000D8u;
         /* 022245B0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t153);
-        /* 022245B4 */ _t154 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022245B4 */ _t154 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022245B4 */ _t155 = _t154 & 0x00000001u;
         /* 022245B4 */ if (_t155) goto L_022245B8; // else: addr-0 trap, fall-through
   L_022245B8: ; // 0x22245b8
@@ -2583,8 +2583,8 @@ void Gambit_fn_02224198(CPUState* cpu) {
   L_022245C8: ; // 0x22245c8
         /* 022245C8 */ _t157 = cpu->r[30] + 0x000001E0u;
         /* 022245C8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t157);
-        /* 022245CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x000000FEu);
-        /* 022245D0 */ _t158 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022245CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x000000FEu));
+        /* 022245D0 */ _t158 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022245D0 */ _t159 = _t158 & 0x00000001u;
         /* 022245D0 */ if (_t159) goto L_022245D4; else goto L_0222461C;
   L_022245D4: ; // 0x22245d4
@@ -2613,7 +2613,7 @@ void Gambit_fn_02224198(CPUState* cpu) {
         /* 02224600 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t170);
         /* 02224604 */ _t171 = cpu->r[1] + 0x000000D8u;
         /* 02224604 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t171);
-        /* 02224608 */ _t172 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02224608 */ _t172 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02224608 */ _t173 = _t172 & 0x00000001u;
         /* 02224608 */ if (_t173) goto L_0222460C; // else: addr-0 trap, fall-through
   L_0222460C: ; // 0x222460c
@@ -2638,7 +2638,7 @@ void Gambit_fn_02224198(CPUState* cpu) {
         /* 02224638 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t179);
         /* 0222463C */ _t180 = cpu->r[1] + 0x000000D8u;
         /* 0222463C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t180);
-        /* 02224640 */ _t181 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02224640 */ _t181 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02224640 */ _t182 = _t181 & 0x00000001u;
         /* 02224640 */ if (_t182) goto L_02224644; // else: addr-0 trap, fall-through
   L_02224644: ; // 0x2224644
@@ -2662,7 +2662,7 @@ void Gambit_fn_02224654(CPUState* cpu) {
         /* 02224660 */ _t2 = cpu->r[4] + 0x00000000u;
         /* 02224660 */ rbrew_write16(cpu->mem, _t2, (uint16_t)cpu->r[10]);
         /* 02224664 */ cpu->r[12] = cpu->r[11] & 0x0000FEFFu;
-        /* 02224664 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02224664 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02224668 */ cpu->r[0] = 0x00000000u;
         /* 0222466C */ _t3 = cpu->r[4] + 0x00000002u;
         /* 0222466C */ rbrew_write16(cpu->mem, _t3, (uint16_t)cpu->r[12]);
@@ -2700,8 +2700,8 @@ void Gambit_fn_0222467C(CPUState* cpu) {
         /* 0222469C */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 022246A0 */ cpu->ctr = cpu->r[0];
         /* 022246A4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 022246A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000004u);
-        /* 022246AC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022246A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000004u));
+        /* 022246AC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022246AC */ _t7 = _t6 & 0x00000001u;
         /* 022246AC */ if (_t7) goto L_022246B0; else goto L_022246B8;
   L_022246B0: ; // 0x22246b0
@@ -2741,8 +2741,8 @@ void Gambit_fn_02224680(CPUState* cpu) {
         /* 0222469C */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 022246A0 */ cpu->ctr = cpu->r[0];
         /* 022246A4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 022246A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000004u);
-        /* 022246AC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022246A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000004u));
+        /* 022246AC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022246AC */ _t7 = _t6 & 0x00000001u;
         /* 022246AC */ if (_t7) goto L_022246B0; else goto L_022246B8;
   L_022246B0: ; // 0x22246b0
@@ -2869,10 +2869,10 @@ void Gambit_fn_02224718(CPUState* cpu) {
         /* 02224768 */ cpu->f[8] = fma(cpu->f[0], cpu->f[0], cpu->f[9]);
         /* 0222476C */ _t14 = cpu->r[1] + 0x0000000Cu;
         /* 0222476C */ rbrew_write32(cpu->mem, _t14, cpu->r[10]);
-        /* 02224770 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[13]);
+        /* 02224770 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[13]));
         /* 02224774 */ _t15 = cpu->r[1] + 0x0000000Cu;
         /* 02224774 */ rbrew_write_f32(cpu->mem, _t15, cpu->f[13]);
-        /* 02224778 */ _t16 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02224778 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02224778 */ _t17 = _t16 & 0x00000001u;
         /* 02224778 */ if (_t17) goto L_0222477C; else goto L_022247BC;
   L_0222477C: ; // 0x222477c
@@ -2900,22 +2900,22 @@ void Gambit_fn_02224718(CPUState* cpu) {
         /* 022247B8 */ _t24 = cpu->r[1] + 0x00000010u;
         /* 022247B8 */ rbrew_write_f32(cpu->mem, _t24, cpu->f[12]);
   L_022247BC: ; // 0x22247bc
-        /* 022247BC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
+        /* 022247BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
         /* 022247C0 */ cpu->r[4] = 0x101F0000u;
         /* 022247C4 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
-        /* 022247C8 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022247C8 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022247C8 */ _t26 = _t25 & 0x00000001u;
         /* 022247C8 */ if (_t26) goto L_022247CC; else goto L_022247F8;
   L_022247CC: ; // 0x22247cc
         /* 022247CC */ _t27 = cpu->r[1] + 0x0000000Cu;
         /* 022247CC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t27);
-        /* 022247D0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
-        /* 022247D4 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022247D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
+        /* 022247D4 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022247D4 */ _t29 = _t28 & 0x00000001u;
         /* 022247D4 */ if (_t29) goto L_022247D8; else goto L_022247F8;
   L_022247D8: ; // 0x22247d8
-        /* 022247D8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[13]);
-        /* 022247DC */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022247D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[13]));
+        /* 022247DC */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022247DC */ _t31 = _t30 & 0x00000001u;
         /* 022247DC */ if (_t31) goto L_022247E0; else goto L_022247F8;
   L_022247E0: ; // 0x22247e0
@@ -2935,8 +2935,8 @@ void Gambit_fn_02224718(CPUState* cpu) {
         /* 022247F8 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 022247FC */ cpu->r[3] = cpu->r[1] + 0x00000014u;
         /* 02224800 */ Gambit_fn_021C6DD8(cpu);
-        /* 02224804 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02224808 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224804 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02224808 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224808 */ _t39 = _t38 & 0x00000001u;
         /* 02224808 */ if (_t39) goto L_0222480C; else goto L_02224820;
   L_0222480C: ; // 0x222480c
@@ -3015,10 +3015,10 @@ void Gambit_fn_0222471C(CPUState* cpu) {
         /* 02224768 */ cpu->f[8] = fma(cpu->f[0], cpu->f[0], cpu->f[9]);
         /* 0222476C */ _t14 = cpu->r[1] + 0x0000000Cu;
         /* 0222476C */ rbrew_write32(cpu->mem, _t14, cpu->r[10]);
-        /* 02224770 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[13]);
+        /* 02224770 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[13]));
         /* 02224774 */ _t15 = cpu->r[1] + 0x0000000Cu;
         /* 02224774 */ rbrew_write_f32(cpu->mem, _t15, cpu->f[13]);
-        /* 02224778 */ _t16 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02224778 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02224778 */ _t17 = _t16 & 0x00000001u;
         /* 02224778 */ if (_t17) goto L_0222477C; else goto L_022247BC;
   L_0222477C: ; // 0x222477c
@@ -3046,22 +3046,22 @@ void Gambit_fn_0222471C(CPUState* cpu) {
         /* 022247B8 */ _t24 = cpu->r[1] + 0x00000010u;
         /* 022247B8 */ rbrew_write_f32(cpu->mem, _t24, cpu->f[12]);
   L_022247BC: ; // 0x22247bc
-        /* 022247BC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
+        /* 022247BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
         /* 022247C0 */ cpu->r[4] = 0x101F0000u;
         /* 022247C4 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
-        /* 022247C8 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022247C8 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022247C8 */ _t26 = _t25 & 0x00000001u;
         /* 022247C8 */ if (_t26) goto L_022247CC; else goto L_022247F8;
   L_022247CC: ; // 0x22247cc
         /* 022247CC */ _t27 = cpu->r[1] + 0x0000000Cu;
         /* 022247CC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t27);
-        /* 022247D0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
-        /* 022247D4 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022247D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
+        /* 022247D4 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022247D4 */ _t29 = _t28 & 0x00000001u;
         /* 022247D4 */ if (_t29) goto L_022247D8; else goto L_022247F8;
   L_022247D8: ; // 0x22247d8
-        /* 022247D8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[13]);
-        /* 022247DC */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022247D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[13]));
+        /* 022247DC */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022247DC */ _t31 = _t30 & 0x00000001u;
         /* 022247DC */ if (_t31) goto L_022247E0; else goto L_022247F8;
   L_022247E0: ; // 0x22247e0
@@ -3081,8 +3081,8 @@ void Gambit_fn_0222471C(CPUState* cpu) {
         /* 022247F8 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 022247FC */ cpu->r[3] = cpu->r[1] + 0x00000014u;
         /* 02224800 */ Gambit_fn_021C6DD8(cpu);
-        /* 02224804 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02224808 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224804 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02224808 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224808 */ _t39 = _t38 & 0x00000001u;
         /* 02224808 */ if (_t39) goto L_0222480C; else goto L_02224820;
   L_0222480C: ; // 0x222480c
@@ -3140,10 +3140,10 @@ void Gambit_fn_02224864(CPUState* cpu) {
         /* 02224884 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
         /* 02224888 */ _t5 = cpu->r[31] + 0x000001B4u;
         /* 02224888 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
-        /* 0222488C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0222488C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02224890 */ _t6 = cpu->r[31] + 0x000001C0u;
         /* 02224890 */ rbrew_write16(cpu->mem, _t6, (uint16_t)cpu->r[7]);
-        /* 02224894 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224894 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224894 */ _t8 = _t7 & 0x00000001u;
         /* 02224894 */ if (_t8) goto L_02224954; else goto L_02224898;
   L_02224898: ; // 0x2224898
@@ -3222,8 +3222,8 @@ void Gambit_fn_02224864(CPUState* cpu) {
         /* 02224950 */ _t35 = cpu->r[31] + 0x000001CCu;
         /* 02224950 */ rbrew_write_f32(cpu->mem, _t35, cpu->f[10]);
   L_02224954: ; // 0x2224954
-        /* 02224954 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 02224958 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224954 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 02224958 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224958 */ _t37 = _t36 & 0x00000001u;
         /* 02224958 */ if (_t37) goto L_0222495C; else goto L_02224984;
   L_0222495C: ; // 0x222495c
@@ -3240,8 +3240,8 @@ void Gambit_fn_02224864(CPUState* cpu) {
         /* 0222497C */ Gambit_fn_0222467C(cpu);
         /* 02224980 */ goto L_022249E0;
   L_02224984: ; // 0x2224984
-        /* 02224984 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02224988 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224984 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02224988 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224988 */ _t41 = _t40 & 0x00000001u;
         /* 02224988 */ if (_t41) goto L_0222498C; else goto L_022249B4;
   L_0222498C: ; // 0x222498c
@@ -3258,8 +3258,8 @@ void Gambit_fn_02224864(CPUState* cpu) {
         /* 022249AC */ Gambit_fn_0222467C(cpu);
         /* 022249B0 */ goto L_022249E0;
   L_022249B4: ; // 0x22249b4
-        /* 022249B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 022249B8 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022249B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 022249B8 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022249B8 */ _t45 = _t44 & 0x00000001u;
         /* 022249B8 */ if (_t45) goto L_022249BC; else goto L_022249D0;
   L_022249BC: ; // 0x22249bc
@@ -3306,10 +3306,10 @@ void Gambit_fn_02224868(CPUState* cpu) {
         /* 02224884 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
         /* 02224888 */ _t5 = cpu->r[31] + 0x000001B4u;
         /* 02224888 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
-        /* 0222488C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0222488C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02224890 */ _t6 = cpu->r[31] + 0x000001C0u;
         /* 02224890 */ rbrew_write16(cpu->mem, _t6, (uint16_t)cpu->r[7]);
-        /* 02224894 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224894 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224894 */ _t8 = _t7 & 0x00000001u;
         /* 02224894 */ if (_t8) goto L_02224954; else goto L_02224898;
   L_02224898: ; // 0x2224898
@@ -3388,8 +3388,8 @@ void Gambit_fn_02224868(CPUState* cpu) {
         /* 02224950 */ _t35 = cpu->r[31] + 0x000001CCu;
         /* 02224950 */ rbrew_write_f32(cpu->mem, _t35, cpu->f[10]);
   L_02224954: ; // 0x2224954
-        /* 02224954 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 02224958 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224954 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 02224958 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224958 */ _t37 = _t36 & 0x00000001u;
         /* 02224958 */ if (_t37) goto L_0222495C; else goto L_02224984;
   L_0222495C: ; // 0x222495c
@@ -3406,8 +3406,8 @@ void Gambit_fn_02224868(CPUState* cpu) {
         /* 0222497C */ Gambit_fn_0222467C(cpu);
         /* 02224980 */ goto L_022249E0;
   L_02224984: ; // 0x2224984
-        /* 02224984 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02224988 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224984 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02224988 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224988 */ _t41 = _t40 & 0x00000001u;
         /* 02224988 */ if (_t41) goto L_0222498C; else goto L_022249B4;
   L_0222498C: ; // 0x222498c
@@ -3424,8 +3424,8 @@ void Gambit_fn_02224868(CPUState* cpu) {
         /* 022249AC */ Gambit_fn_0222467C(cpu);
         /* 022249B0 */ goto L_022249E0;
   L_022249B4: ; // 0x22249b4
-        /* 022249B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 022249B8 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022249B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 022249B8 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022249B8 */ _t45 = _t44 & 0x00000001u;
         /* 022249B8 */ if (_t45) goto L_022249BC; else goto L_022249D0;
   L_022249BC: ; // 0x22249bc
@@ -3474,11 +3474,11 @@ void Gambit_fn_022249F8(CPUState* cpu) {
         /* 022249F8 */ cpu->r[0] = cpu->lr;
         /* 022249FC */ _t0 = cpu->r[1] + 0x00000004u;
         /* 022249FC */ rbrew_write32(cpu->mem, _t0, cpu->r[0]);
-        /* 02224A00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x0000000Bu);
+        /* 02224A00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x0000000Bu));
         /* 02224A04 */ _t1 = cpu->r[1] + 0xFFFFFFF8u;
         /* 02224A04 */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 02224A04 */ cpu->r[1] = _t1;
-        /* 02224A08 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224A08 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224A08 */ _t3 = _t2 & 0x00000001u;
         /* 02224A08 */ rbrew_dispatch(cpu, (_t3) ? 0x02224158u : 0x02224a0cu); return;
         /* 02224A0C */ _t4 = cpu->r[1] + 0x0000000Cu;
@@ -3497,7 +3497,7 @@ void Gambit_fn_02224A04(CPUState* cpu) {
         /* 02224A04 */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 02224A04 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 02224A04 */ cpu->r[1] = _t0;
-        /* 02224A08 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224A08 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224A08 */ _t2 = _t1 & 0x00000001u;
         /* 02224A08 */ rbrew_dispatch(cpu, (_t2) ? 0x02224158u : 0x02224a0cu); return;
         /* 02224A0C */ _t3 = cpu->r[1] + 0x0000000Cu;
@@ -3532,18 +3532,18 @@ void Gambit_fn_02224A20(CPUState* cpu) {
         /* 02224A48 */ cpu->r[8] = cpu->r[6] + 0x101E0000u;
         /* 02224A4C */ _t4 = cpu->r[8] + 0xFFFF9484u;
         /* 02224A4C */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
-        /* 02224A50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 02224A54 */ _t5 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02224A50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 02224A54 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02224A54 */ _t6 = _t5 & 0x00000001u;
         /* 02224A54 */ if (_t6) goto L_02224A58; else goto L_02224A5C;
   L_02224A58: ; // 0x2224a58
         /* 02224A58 */ cpu->r[0] = 0x00000004u;
   L_02224A5C: ; // 0x2224a5c
         /* 02224A5C */ cpu->r[27] = 0x00000000u;
-        /* 02224A60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[0]);
+        /* 02224A60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[0]));
         /* 02224A64 */ _t7 = cpu->r[28] + 0x00000130u;
         /* 02224A64 */ rbrew_write32(cpu->mem, _t7, cpu->r[0]);
-        /* 02224A68 */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02224A68 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02224A68 */ _t9 = _t8 & 0x00000001u;
         /* 02224A68 */ if (_t9) goto L_02224A6C; else goto L_02224ABC;
   L_02224A6C: ; // 0x2224a6c
@@ -3566,9 +3566,9 @@ void Gambit_fn_02224A20(CPUState* cpu) {
         /* 02224AA4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t10);
         /* 02224AA8 */ cpu->r[27] = cpu->r[27] + 0x00000001u;
         /* 02224AAC */ cpu->r[31] = cpu->r[31] + 0x00000004u;
-        /* 02224AB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], cpu->r[8]);
+        /* 02224AB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], cpu->r[8]));
         /* 02224AB4 */ cpu->r[30] = cpu->r[30] + 0x0000000Cu;
-        /* 02224AB8 */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02224AB8 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02224AB8 */ _t12 = _t11 & 0x00000001u;
         /* 02224AB8 */ if (_t12) goto L_02224A80; else goto L_02224ABC;
   L_02224ABC: ; // 0x2224abc
@@ -3577,8 +3577,8 @@ void Gambit_fn_02224A20(CPUState* cpu) {
         /* 02224AC0 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t13);
         /* 02224AC4 */ _t14 = cpu->r[10] + 0xFFFFDEDCu;
         /* 02224AC4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t14);
-        /* 02224AC8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[9]);
-        /* 02224ACC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224AC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[9]));
+        /* 02224ACC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224ACC */ _t16 = _t15 & 0x00000001u;
         /* 02224ACC */ if (_t16) goto L_02224AF4; else goto L_02224AD0;
   L_02224AD0: ; // 0x2224ad0
@@ -3587,7 +3587,7 @@ void Gambit_fn_02224A20(CPUState* cpu) {
         /* 02224AD4 */ _t18 = cpu->r[29] + 0x00000034u;
         /* 02224AD4 */ rbrew_write_f32(cpu->mem, _t18, cpu->f[0]);
         /* 02224AD8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 02224AD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02224AD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02224ADC */ _t19 = cpu->r[29] + 0x0000003Cu;
         /* 02224ADC */ rbrew_write_f32(cpu->mem, _t19, cpu->f[0]);
         /* 02224AE0 */ _t20 = cpu->r[29] + 0x00000040u;
@@ -3595,7 +3595,7 @@ void Gambit_fn_02224A20(CPUState* cpu) {
         /* 02224AE4 */ cpu->r[12] = cpu->r[29] + 0x00000034u;
         /* 02224AE8 */ _t21 = cpu->r[29] + 0x00000038u;
         /* 02224AE8 */ rbrew_write_f32(cpu->mem, _t21, cpu->f[0]);
-        /* 02224AEC */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224AEC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224AEC */ _t23 = _t22 & 0x00000001u;
         /* 02224AEC */ if (_t23) goto L_02224AF0; else goto L_02224B4C;
   L_02224AF0: ; // 0x2224af0
@@ -3604,8 +3604,8 @@ void Gambit_fn_02224A20(CPUState* cpu) {
         /* 02224AF4 */ _t24 = cpu->r[29] + 0x00000000u;
         /* 02224AF4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t24);
         /* 02224AF8 */ cpu->r[9] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x0000001Bu, 0x0000001Cu);
-        /* 02224AF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02224AFC */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224AF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02224AFC */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224AFC */ _t26 = _t25 & 0x00000001u;
         /* 02224AFC */ if (_t26) goto L_02224B00; else goto L_02224B30;
   L_02224B00: ; // 0x2224b00
@@ -3622,10 +3622,10 @@ void Gambit_fn_02224A20(CPUState* cpu) {
         /* 02224B14 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t31);
         /* 02224B18 */ cpu->f[8] = fma(cpu->f[12], cpu->f[12], cpu->f[7]);
         /* 02224B1C */ cpu->f[7] = fma(cpu->f[11], cpu->f[11], cpu->f[8]);
-        /* 02224B20 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[0]);
+        /* 02224B20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[0]));
         /* 02224B24 */ _t32 = cpu->r[28] + 0x000001B0u;
         /* 02224B24 */ rbrew_write_f32(cpu->mem, _t32, cpu->f[11]);
-        /* 02224B28 */ _t33 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02224B28 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02224B28 */ _t34 = _t33 & 0x00000001u;
         /* 02224B28 */ if (_t34) goto L_02224B2C; else goto L_02224D2C;
   L_02224B2C: ; // 0x2224b2c
@@ -3636,13 +3636,13 @@ void Gambit_fn_02224A20(CPUState* cpu) {
         /* 02224B34 */ _t36 = cpu->r[29] + 0x00000038u;
         /* 02224B34 */ rbrew_write_f32(cpu->mem, _t36, cpu->f[0]);
         /* 02224B38 */ cpu->r[0] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 02224B38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02224B38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02224B3C */ _t37 = cpu->r[29] + 0x00000034u;
         /* 02224B3C */ rbrew_write_f32(cpu->mem, _t37, cpu->f[0]);
         /* 02224B40 */ cpu->r[12] = cpu->r[29] + 0x00000034u;
         /* 02224B44 */ _t38 = cpu->r[29] + 0x0000003Cu;
         /* 02224B44 */ rbrew_write_f32(cpu->mem, _t38, cpu->f[0]);
-        /* 02224B48 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224B48 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224B48 */ _t40 = _t39 & 0x00000001u;
         /* 02224B48 */ if (_t40) goto L_02224B70; else goto L_02224B4C;
   L_02224B4C: ; // 0x2224b4c
@@ -3661,8 +3661,8 @@ void Gambit_fn_02224A20(CPUState* cpu) {
         /* 02224B6C */ cpu->r[10] = rbrew_read32(cpu->mem, _t44);
   L_02224B70: ; // 0x2224b70
         /* 02224B70 */ cpu->r[5] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Bu, 0x0000001Bu);
-        /* 02224B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 02224B74 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 02224B74 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224B74 */ _t46 = _t45 & 0x00000001u;
         /* 02224B74 */ if (_t46) goto L_02224CBC; else goto L_02224B78;
   L_02224B78: ; // 0x2224b78
@@ -3670,12 +3670,12 @@ void Gambit_fn_02224A20(CPUState* cpu) {
         /* 02224B78 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t47);
         /* 02224B7C */ _t48 = cpu->r[29] + 0x00000040u;
         /* 02224B7C */ cpu->f[5] = rbrew_read_f32(cpu->mem, _t48);
-        /* 02224B80 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
+        /* 02224B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
         /* 02224B84 */ _t49 = cpu->r[29] + 0x0000001Cu;
         /* 02224B84 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t49);
         /* 02224B88 */ _t50 = cpu->r[29] + 0x00000028u;
         /* 02224B88 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t50);
-        /* 02224B8C */ _t51 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02224B8C */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02224B8C */ _t52 = _t51 & 0x00000001u;
         /* 02224B8C */ if (_t52) goto L_02224B90; else goto L_02224BB4;
   L_02224B90: ; // 0x2224b90
@@ -3683,20 +3683,20 @@ void Gambit_fn_02224A20(CPUState* cpu) {
         /* 02224B94 */ /* nop */
         /* 02224B98 */ _t53 = cpu->r[12] + 0x00000004u;
         /* 02224B98 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t53);
-        /* 02224B9C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
+        /* 02224B9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
         /* 02224BA0 */ _t54 = cpu->r[29] + 0x00000020u;
         /* 02224BA0 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t54);
         /* 02224BA4 */ cpu->f[6] = fma(cpu->f[12], cpu->f[5], cpu->f[9]);
         /* 02224BA8 */ _t55 = cpu->r[29] + 0x0000002Cu;
         /* 02224BA8 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t55);
-        /* 02224BAC */ _t56 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02224BAC */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02224BAC */ _t57 = _t56 & 0x00000001u;
         /* 02224BAC */ if (_t57) goto L_02224BB0; else goto L_02224C1C;
   L_02224BB0: ; // 0x2224bb0
         /* 02224BB0 */ goto L_02224BF8;
   L_02224BB4: ; // 0x2224bb4
-        /* 02224BB4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
-        /* 02224BB8 */ _t58 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02224BB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
+        /* 02224BB8 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02224BB8 */ _t59 = _t58 & 0x00000001u;
         /* 02224BB8 */ if (_t59) goto L_02224BBC; else goto L_02224BE0;
   L_02224BBC: ; // 0x2224bbc
@@ -3707,10 +3707,10 @@ void Gambit_fn_02224A20(CPUState* cpu) {
         /* 02224BC8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t60);
         /* 02224BCC */ _t61 = cpu->r[29] + 0x00000020u;
         /* 02224BCC */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t61);
-        /* 02224BD0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
+        /* 02224BD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
         /* 02224BD4 */ _t62 = cpu->r[29] + 0x0000002Cu;
         /* 02224BD4 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t62);
-        /* 02224BD8 */ _t63 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02224BD8 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02224BD8 */ _t64 = _t63 & 0x00000001u;
         /* 02224BD8 */ if (_t64) goto L_02224BDC; else goto L_02224C1C;
   L_02224BDC: ; // 0x2224bdc
@@ -3721,10 +3721,10 @@ void Gambit_fn_02224A20(CPUState* cpu) {
         /* 02224BE4 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t65);
         /* 02224BE8 */ _t66 = cpu->r[29] + 0x00000020u;
         /* 02224BE8 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t66);
-        /* 02224BEC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
+        /* 02224BEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
         /* 02224BF0 */ _t67 = cpu->r[29] + 0x0000002Cu;
         /* 02224BF0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t67);
-        /* 02224BF4 */ _t68 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02224BF4 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02224BF4 */ _t69 = _t68 & 0x00000001u;
         /* 02224BF4 */ if (_t69) goto L_02224BF8; else goto L_02224C1C;
   L_02224BF8: ; // 0x2224bf8
@@ -3732,20 +3732,20 @@ void Gambit_fn_02224A20(CPUState* cpu) {
         /* 02224BFC */ /* nop */
         /* 02224C00 */ _t70 = cpu->r[12] + 0x00000008u;
         /* 02224C00 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t70);
-        /* 02224C04 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[0]);
+        /* 02224C04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[0]));
         /* 02224C08 */ _t71 = cpu->r[29] + 0x00000030u;
         /* 02224C08 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t71);
         /* 02224C0C */ cpu->f[12] = fma(cpu->f[10], cpu->f[5], cpu->f[8]);
         /* 02224C10 */ _t72 = cpu->r[29] + 0x00000024u;
         /* 02224C10 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t72);
-        /* 02224C14 */ _t73 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02224C14 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02224C14 */ _t74 = _t73 & 0x00000001u;
         /* 02224C14 */ if (_t74) goto L_02224C18; else goto L_02224C80;
   L_02224C18: ; // 0x2224c18
         /* 02224C18 */ goto L_02224C60;
   L_02224C1C: ; // 0x2224c1c
-        /* 02224C1C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 02224C20 */ _t75 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02224C1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 02224C20 */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02224C20 */ _t76 = _t75 & 0x00000001u;
         /* 02224C20 */ if (_t76) goto L_02224C24; else goto L_02224C48;
   L_02224C24: ; // 0x2224c24
@@ -3753,13 +3753,13 @@ void Gambit_fn_02224A20(CPUState* cpu) {
         /* 02224C28 */ _t77 = cpu->r[12] + 0x00000008u;
         /* 02224C28 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t77);
         /* 02224C2C */ /* nop */
-        /* 02224C30 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[0]);
+        /* 02224C30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[0]));
         /* 02224C34 */ _t78 = cpu->r[29] + 0x00000024u;
         /* 02224C34 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t78);
         /* 02224C38 */ cpu->f[12] = fma(cpu->f[12], cpu->f[5], cpu->f[11]);
         /* 02224C3C */ _t79 = cpu->r[29] + 0x00000030u;
         /* 02224C3C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t79);
-        /* 02224C40 */ _t80 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02224C40 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02224C40 */ _t81 = _t80 & 0x00000001u;
         /* 02224C40 */ if (_t81) goto L_02224C44; else goto L_02224C80;
   L_02224C44: ; // 0x2224c44
@@ -3770,10 +3770,10 @@ void Gambit_fn_02224A20(CPUState* cpu) {
         /* 02224C4C */ cpu->f[12] = cpu->f[10] + cpu->f[12];
         /* 02224C50 */ _t83 = cpu->r[29] + 0x00000030u;
         /* 02224C50 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t83);
-        /* 02224C54 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[0]);
+        /* 02224C54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[0]));
         /* 02224C58 */ _t84 = cpu->r[29] + 0x00000024u;
         /* 02224C58 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t84);
-        /* 02224C5C */ _t85 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02224C5C */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02224C5C */ _t86 = _t85 & 0x00000001u;
         /* 02224C5C */ if (_t86) goto L_02224C60; else goto L_02224C80;
   L_02224C60: ; // 0x2224c60
@@ -3790,8 +3790,8 @@ void Gambit_fn_02224A20(CPUState* cpu) {
         /* 02224C78 */ cpu->r[10] = rbrew_read32(cpu->mem, _t90);
         /* 02224C7C */ goto L_02224CBC;
   L_02224C80: ; // 0x2224c80
-        /* 02224C80 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[0]);
-        /* 02224C84 */ _t91 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02224C80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[0]));
+        /* 02224C84 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02224C84 */ _t92 = _t91 & 0x00000001u;
         /* 02224C84 */ if (_t92) goto L_02224C88; else goto L_02224CA8;
   L_02224C88: ; // 0x2224c88
@@ -3834,10 +3834,10 @@ void Gambit_fn_02224A20(CPUState* cpu) {
         /* 02224CD8 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t106);
         /* 02224CDC */ cpu->f[8] = fma(cpu->f[12], cpu->f[12], cpu->f[7]);
         /* 02224CE0 */ cpu->f[7] = fma(cpu->f[11], cpu->f[11], cpu->f[8]);
-        /* 02224CE4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[0]);
+        /* 02224CE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[0]));
         /* 02224CE8 */ _t107 = cpu->r[28] + 0x000001B0u;
         /* 02224CE8 */ rbrew_write_f32(cpu->mem, _t107, cpu->f[11]);
-        /* 02224CEC */ _t108 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02224CEC */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02224CEC */ _t109 = _t108 & 0x00000001u;
         /* 02224CEC */ if (_t109) goto L_02224CF0; else goto L_02224D2C;
   L_02224CF0: ; // 0x2224cf0
@@ -3886,8 +3886,8 @@ void Gambit_fn_02224D40(CPUState* cpu) {
         /* 02224D50 */ cpu->r[31] = cpu->r[3];
         /* 02224D54 */ _t2 = cpu->r[31] + 0x000001C0u;
         /* 02224D54 */ cpu->r[10] = rbrew_read16(cpu->mem, _t2);
-        /* 02224D58 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00008CA0u);
-        /* 02224D5C */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02224D58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00008CA0u));
+        /* 02224D5C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02224D5C */ _t4 = _t3 & 0x00000001u;
         /* 02224D5C */ if (_t4) goto L_02224D68; else goto L_02224D60;
   L_02224D60: ; // 0x2224d60
@@ -3899,10 +3899,10 @@ void Gambit_fn_02224D40(CPUState* cpu) {
         /* 02224D6C */ cpu->r[29] = 0x00000000u;
         /* 02224D70 */ _t6 = cpu->r[31] + 0x00000130u;
         /* 02224D70 */ rbrew_write32(cpu->mem, _t6, cpu->r[29]);
-        /* 02224D74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02224D74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02224D78 */ _t7 = cpu->r[31] + 0x0000012Cu;
         /* 02224D78 */ rbrew_write8(cpu->mem, _t7, (uint8_t)cpu->r[29]);
-        /* 02224D7C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224D7C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224D7C */ _t9 = _t8 & 0x00000001u;
         /* 02224D7C */ if (_t9) goto L_02224D94; else goto L_02224D80;
   L_02224D80: ; // 0x2224d80
@@ -3928,7 +3928,7 @@ void Gambit_fn_02224D40(CPUState* cpu) {
         /* 02224DB4 */ cpu->r[30] = cpu->r[12] + 0x000000FAu;
         /* 02224DB8 */ Gambit_fn_02830138(cpu);
         /* 02224DBC */ /* nop */
-        /* 02224DC0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224DC0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224DC0 */ _t16 = _t15 & 0x00000001u;
         /* 02224DC0 */ if (_t16) goto L_02224DC4; else goto L_02224FF8;
   L_02224DC4: ; // 0x2224dc4
@@ -3964,10 +3964,10 @@ void Gambit_fn_02224D40(CPUState* cpu) {
         /* 02224E18 */ rbrew_write32(cpu->mem, _t24, cpu->r[0]);
         /* 02224E1C */ Gambit_fn_0204A4DC(cpu);
         /* 02224E20 */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02224E20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02224E20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02224E24 */ _t25 = cpu->r[31] + 0x000000B0u;
         /* 02224E24 */ rbrew_write32(cpu->mem, _t25, cpu->r[3]);
-        /* 02224E28 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224E28 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224E28 */ _t27 = _t26 & 0x00000001u;
         /* 02224E28 */ if (_t27) goto L_02224FF0; else goto L_02224E2C;
   L_02224E2C: ; // 0x2224e2c
@@ -3980,15 +3980,15 @@ void Gambit_fn_02224D40(CPUState* cpu) {
         /* 02224E3C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t29);
         /* 02224E40 */ _t30 = cpu->r[11] + 0xFFFFDF10u;
         /* 02224E40 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t30);
-        /* 02224E44 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
+        /* 02224E44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
         /* 02224E48 */ _t31 = cpu->r[31] + 0x000001DCu;
         /* 02224E48 */ cpu->r[8] = rbrew_read8(cpu->mem, _t31);
-        /* 02224E4C */ _t32 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02224E4C */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02224E4C */ _t33 = _t32 & 0x00000001u;
         /* 02224E4C */ if (_t33) goto L_02224E50; else goto L_02224FE8;
   L_02224E50: ; // 0x2224e50
-        /* 02224E50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02224E54 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224E50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02224E54 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224E54 */ _t35 = _t34 & 0x00000001u;
         /* 02224E54 */ if (_t35) goto L_02224EB4; else goto L_02224E58;
   L_02224E58: ; // 0x2224e58
@@ -4026,8 +4026,8 @@ void Gambit_fn_02224D40(CPUState* cpu) {
         /* 02224EA4 */ cpu->r[7] = 0x10050000u;
         /* 02224EA8 */ _t48 = cpu->r[7] + 0xFFFFDF14u;
         /* 02224EA8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t48);
-        /* 02224EAC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
-        /* 02224EB0 */ _t49 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02224EAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
+        /* 02224EB0 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02224EB0 */ _t50 = _t49 & 0x00000001u;
         /* 02224EB0 */ if (_t50) goto L_02224FF8; else goto L_02224EB4;
   L_02224EB4: ; // 0x2224eb4
@@ -4071,9 +4071,9 @@ void Gambit_fn_02224D40(CPUState* cpu) {
         /* 02224F00 */ _t69 = cpu->r[7] + 0xFFFFFE00u;
         /* 02224F00 */ cpu->r[6] = rbrew_read32(cpu->mem, _t69);
         /* 02224F00 */ cpu->r[7] = _t69;
-        /* 02224F04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02224F04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 02224F08 */ cpu->r[30] = 0x101D0000u;
-        /* 02224F0C */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224F0C */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224F0C */ _t71 = _t70 & 0x00000001u;
         /* 02224F0C */ if (_t71) goto L_02224F10; else goto L_02224F2C;
   L_02224F10: ; // 0x2224f10
@@ -4090,9 +4090,9 @@ void Gambit_fn_02224D40(CPUState* cpu) {
         /* 02224F30 */ _t73 = cpu->r[5] + 0xFFFFFDFCu;
         /* 02224F30 */ cpu->r[9] = rbrew_read32(cpu->mem, _t73);
         /* 02224F30 */ cpu->r[5] = _t73;
-        /* 02224F34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02224F34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02224F38 */ cpu->r[28] = 0x101D0000u;
-        /* 02224F3C */ _t74 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224F3C */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224F3C */ _t75 = _t74 & 0x00000001u;
         /* 02224F3C */ if (_t75) goto L_02224F40; else goto L_02224F68;
   L_02224F40: ; // 0x2224f40
@@ -4106,8 +4106,8 @@ void Gambit_fn_02224D40(CPUState* cpu) {
         /* 02224F54 */ Gambit_fn_02836FFC(cpu);
         /* 02224F58 */ _t78 = cpu->r[28] + 0xFFFFFF6Cu;
         /* 02224F58 */ cpu->r[12] = rbrew_read32(cpu->mem, _t78);
-        /* 02224F5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02224F60 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224F5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02224F60 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224F60 */ _t80 = _t79 & 0x00000001u;
         /* 02224F60 */ if (_t80) goto L_02224F8C; else goto L_02224F64;
   L_02224F64: ; // 0x2224f64
@@ -4115,8 +4115,8 @@ void Gambit_fn_02224D40(CPUState* cpu) {
   L_02224F68: ; // 0x2224f68
         /* 02224F68 */ _t81 = cpu->r[28] + 0xFFFFFF6Cu;
         /* 02224F68 */ cpu->r[8] = rbrew_read32(cpu->mem, _t81);
-        /* 02224F6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02224F70 */ _t82 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224F6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02224F70 */ _t82 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224F70 */ _t83 = _t82 & 0x00000001u;
         /* 02224F70 */ if (_t83) goto L_02224F74; else goto L_02224FB4;
   L_02224F74: ; // 0x2224f74
@@ -4125,8 +4125,8 @@ void Gambit_fn_02224D40(CPUState* cpu) {
         /* 02224F7C */ Gambit_fn_02836FFC(cpu);
         /* 02224F80 */ _t84 = cpu->r[28] + 0xFFFFFF6Cu;
         /* 02224F80 */ cpu->r[12] = rbrew_read32(cpu->mem, _t84);
-        /* 02224F84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02224F88 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224F84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02224F88 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224F88 */ _t86 = _t85 & 0x00000001u;
         /* 02224F88 */ if (_t86) goto L_02224F8C; else goto L_02224FA8;
   L_02224F8C: ; // 0x2224f8c
@@ -4163,8 +4163,8 @@ void Gambit_fn_02224D40(CPUState* cpu) {
         /* 02224FE0 */ cpu->r[1] = cpu->r[1] + 0x00000050u;
         /* 02224FE4 */ return;
   L_02224FE8: ; // 0x2224fe8
-        /* 02224FE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02224FEC */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02224FE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02224FEC */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02224FEC */ _t95 = _t94 & 0x00000001u;
         /* 02224FEC */ if (_t95) goto L_02224FF0; else goto L_02224FF8;
   L_02224FF0: ; // 0x2224ff0
@@ -4206,7 +4206,7 @@ void Gambit_fn_0222500C(CPUState* cpu) {
         /* 02225040 */ cpu->r[31] = cpu->r[9] + 0x000000FAu;
         /* 02225044 */ Gambit_fn_02830138(cpu);
         /* 02225048 */ /* nop */
-        /* 0222504C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222504C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222504C */ _t6 = _t5 & 0x00000001u;
         /* 0222504C */ if (_t6) goto L_02225050; else goto L_02225180;
   L_02225050: ; // 0x2225050
@@ -4255,9 +4255,9 @@ void Gambit_fn_0222500C(CPUState* cpu) {
         /* 022250A8 */ _t27 = cpu->r[11] + 0xFFFFFE00u;
         /* 022250A8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t27);
         /* 022250A8 */ cpu->r[11] = _t27;
-        /* 022250AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 022250AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 022250B0 */ cpu->r[28] = 0x101D0000u;
-        /* 022250B4 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022250B4 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022250B4 */ _t29 = _t28 & 0x00000001u;
         /* 022250B4 */ if (_t29) goto L_022250B8; else goto L_022250D4;
   L_022250B8: ; // 0x22250b8
@@ -4274,9 +4274,9 @@ void Gambit_fn_0222500C(CPUState* cpu) {
         /* 022250D8 */ _t31 = cpu->r[9] + 0xFFFFFDFCu;
         /* 022250D8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t31);
         /* 022250D8 */ cpu->r[9] = _t31;
-        /* 022250DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 022250DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 022250E0 */ cpu->r[27] = 0x101D0000u;
-        /* 022250E4 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022250E4 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022250E4 */ _t33 = _t32 & 0x00000001u;
         /* 022250E4 */ if (_t33) goto L_022250E8; else goto L_02225114;
   L_022250E8: ; // 0x22250e8
@@ -4291,8 +4291,8 @@ void Gambit_fn_0222500C(CPUState* cpu) {
         /* 02225100 */ Gambit_fn_02836FFC(cpu);
         /* 02225104 */ _t36 = cpu->r[27] + 0xFFFFFF6Cu;
         /* 02225104 */ cpu->r[0] = rbrew_read32(cpu->mem, _t36);
-        /* 02225108 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222510C */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225108 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222510C */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222510C */ _t38 = _t37 & 0x00000001u;
         /* 0222510C */ if (_t38) goto L_02225138; else goto L_02225110;
   L_02225110: ; // 0x2225110
@@ -4300,8 +4300,8 @@ void Gambit_fn_0222500C(CPUState* cpu) {
   L_02225114: ; // 0x2225114
         /* 02225114 */ _t39 = cpu->r[27] + 0xFFFFFF6Cu;
         /* 02225114 */ cpu->r[12] = rbrew_read32(cpu->mem, _t39);
-        /* 02225118 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0222511C */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225118 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0222511C */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222511C */ _t41 = _t40 & 0x00000001u;
         /* 0222511C */ if (_t41) goto L_02225120; else goto L_02225160;
   L_02225120: ; // 0x2225120
@@ -4310,8 +4310,8 @@ void Gambit_fn_0222500C(CPUState* cpu) {
         /* 02225128 */ Gambit_fn_02836FFC(cpu);
         /* 0222512C */ _t42 = cpu->r[27] + 0xFFFFFF6Cu;
         /* 0222512C */ cpu->r[0] = rbrew_read32(cpu->mem, _t42);
-        /* 02225130 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02225134 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225130 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02225134 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225134 */ _t44 = _t43 & 0x00000001u;
         /* 02225134 */ if (_t44) goto L_02225138; else goto L_02225154;
   L_02225138: ; // 0x2225138
@@ -4376,9 +4376,9 @@ void Gambit_fn_02225194(CPUState* cpu) {
         /* 022251C0 */ _t6 = cpu->r[24] + 0x00000130u;
         /* 022251C0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
         /* 022251C4 */ cpu->r[25] = 0x00000000u;
-        /* 022251C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], cpu->r[0]);
+        /* 022251C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], cpu->r[0]));
         /* 022251CC */ cpu->f[30] = cpu->f[1];
-        /* 022251D0 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022251D0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022251D0 */ _t8 = _t7 & 0x00000001u;
         /* 022251D0 */ if (_t8) goto L_022251D4; else goto L_02225268;
   L_022251D4: ; // 0x22251d4
@@ -4435,9 +4435,9 @@ void Gambit_fn_02225194(CPUState* cpu) {
         /* 02225254 */ _t25 = cpu->r[24] + 0x00000130u;
         /* 02225254 */ cpu->r[9] = rbrew_read32(cpu->mem, _t25);
         /* 02225258 */ cpu->r[25] = cpu->r[25] + 0x00000001u;
-        /* 0222525C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], cpu->r[9]);
+        /* 0222525C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], cpu->r[9]));
         /* 02225260 */ cpu->r[26] = cpu->r[26] + 0x0000000Cu;
-        /* 02225264 */ _t26 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02225264 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02225264 */ _t27 = _t26 & 0x00000001u;
         /* 02225264 */ if (_t27) goto L_022251F8; else goto L_02225268;
   L_02225268: ; // 0x2225268
@@ -4450,7 +4450,7 @@ void Gambit_fn_02225194(CPUState* cpu) {
         /* 02225274 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t30);
         /* 02225278 */ _t31 = cpu->r[1] + 0x00000060u;
         /* 02225278 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t31);
-        /* 0222527C */ _t32 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222527C */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222527C */ _t33 = _t32 & 0x00000001u;
         /* 0222527C */ if (_t33) goto L_02225280; // else: addr-0 trap, fall-through
   L_02225280: ; // 0x2225280
@@ -4479,10 +4479,10 @@ void Gambit_fn_02225290(CPUState* cpu) {
         /* 022252A8 */ cpu->r[29] = 0x00000000u;
         /* 022252AC */ _t3 = cpu->r[31] + 0x00000130u;
         /* 022252AC */ rbrew_write32(cpu->mem, _t3, cpu->r[29]);
-        /* 022252B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 022252B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 022252B4 */ _t4 = cpu->r[31] + 0x0000012Cu;
         /* 022252B4 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[29]);
-        /* 022252B8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022252B8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022252B8 */ _t6 = _t5 & 0x00000001u;
         /* 022252B8 */ if (_t6) goto L_022252D0; else goto L_022252BC;
   L_022252BC: ; // 0x22252bc
@@ -4529,10 +4529,10 @@ void Gambit_fn_02225290(CPUState* cpu) {
         /* 02225330 */ rbrew_write32(cpu->mem, _t16, cpu->r[0]);
         /* 02225334 */ Gambit_fn_0204A4DC(cpu);
         /* 02225338 */ cpu->r[7] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02225338 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02225338 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0222533C */ _t17 = cpu->r[31] + 0x000000B0u;
         /* 0222533C */ rbrew_write32(cpu->mem, _t17, cpu->r[3]);
-        /* 02225340 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225340 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225340 */ _t19 = _t18 & 0x00000001u;
         /* 02225340 */ if (_t19) goto L_02225350; else goto L_02225344;
   L_02225344: ; // 0x2225344
@@ -4543,8 +4543,8 @@ void Gambit_fn_02225290(CPUState* cpu) {
   L_02225350: ; // 0x2225350
         /* 02225350 */ _t21 = cpu->r[31] + 0x00000051u;
         /* 02225350 */ cpu->r[9] = rbrew_read8(cpu->mem, _t21);
-        /* 02225354 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02225358 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225354 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02225358 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225358 */ _t23 = _t22 & 0x00000001u;
         /* 02225358 */ if (_t23) goto L_02225378; else goto L_0222535C;
   L_0222535C: ; // 0x222535c
@@ -4572,7 +4572,7 @@ void Gambit_fn_02225290(CPUState* cpu) {
         /* 02225398 */ cpu->r[30] = cpu->r[7] + 0x000000FAu;
         /* 0222539C */ Gambit_fn_02830138(cpu);
         /* 022253A0 */ /* nop */
-        /* 022253A4 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022253A4 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022253A4 */ _t30 = _t29 & 0x00000001u;
         /* 022253A4 */ if (_t30) goto L_022253A8; else goto L_022254D4;
   L_022253A8: ; // 0x22253a8
@@ -4621,9 +4621,9 @@ void Gambit_fn_02225290(CPUState* cpu) {
         /* 02225400 */ _t51 = cpu->r[7] + 0xFFFFFE00u;
         /* 02225400 */ cpu->r[9] = rbrew_read32(cpu->mem, _t51);
         /* 02225400 */ cpu->r[7] = _t51;
-        /* 02225404 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02225404 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02225408 */ cpu->r[30] = 0x101D0000u;
-        /* 0222540C */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222540C */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222540C */ _t53 = _t52 & 0x00000001u;
         /* 0222540C */ if (_t53) goto L_02225410; else goto L_0222542C;
   L_02225410: ; // 0x2225410
@@ -4640,9 +4640,9 @@ void Gambit_fn_02225290(CPUState* cpu) {
         /* 02225430 */ _t55 = cpu->r[12] + 0xFFFFFDFCu;
         /* 02225430 */ cpu->r[0] = rbrew_read32(cpu->mem, _t55);
         /* 02225430 */ cpu->r[12] = _t55;
-        /* 02225434 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02225434 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02225438 */ cpu->r[28] = 0x101D0000u;
-        /* 0222543C */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222543C */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222543C */ _t57 = _t56 & 0x00000001u;
         /* 0222543C */ if (_t57) goto L_02225440; else goto L_02225468;
   L_02225440: ; // 0x2225440
@@ -4656,8 +4656,8 @@ void Gambit_fn_02225290(CPUState* cpu) {
         /* 02225454 */ Gambit_fn_02836FFC(cpu);
         /* 02225458 */ _t60 = cpu->r[28] + 0xFFFFFF6Cu;
         /* 02225458 */ cpu->r[8] = rbrew_read32(cpu->mem, _t60);
-        /* 0222545C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02225460 */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222545C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02225460 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225460 */ _t62 = _t61 & 0x00000001u;
         /* 02225460 */ if (_t62) goto L_0222548C; else goto L_02225464;
   L_02225464: ; // 0x2225464
@@ -4665,8 +4665,8 @@ void Gambit_fn_02225290(CPUState* cpu) {
   L_02225468: ; // 0x2225468
         /* 02225468 */ _t63 = cpu->r[28] + 0xFFFFFF6Cu;
         /* 02225468 */ cpu->r[11] = rbrew_read32(cpu->mem, _t63);
-        /* 0222546C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02225470 */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222546C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02225470 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225470 */ _t65 = _t64 & 0x00000001u;
         /* 02225470 */ if (_t65) goto L_02225474; else goto L_022254B4;
   L_02225474: ; // 0x2225474
@@ -4675,8 +4675,8 @@ void Gambit_fn_02225290(CPUState* cpu) {
         /* 0222547C */ Gambit_fn_02836FFC(cpu);
         /* 02225480 */ _t66 = cpu->r[28] + 0xFFFFFF6Cu;
         /* 02225480 */ cpu->r[8] = rbrew_read32(cpu->mem, _t66);
-        /* 02225484 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02225488 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225484 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02225488 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225488 */ _t68 = _t67 & 0x00000001u;
         /* 02225488 */ if (_t68) goto L_0222548C; else goto L_022254A8;
   L_0222548C: ; // 0x222548c
@@ -4744,8 +4744,8 @@ void Gambit_fn_022254E8(CPUState* cpu) {
   L_0222552C: ; // 0x222552c
         /* 0222552C */ _t3 = cpu->r[25] + 0xFFFFFE00u;
         /* 0222552C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 02225530 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02225534 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225530 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02225534 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225534 */ _t5 = _t4 & 0x00000001u;
         /* 02225534 */ if (_t5) goto L_02225538; else goto L_02225550;
   L_02225538: ; // 0x2225538
@@ -4759,8 +4759,8 @@ void Gambit_fn_022254E8(CPUState* cpu) {
   L_02225550: ; // 0x2225550
         /* 02225550 */ _t7 = cpu->r[22] + 0xFFFFFDFCu;
         /* 02225550 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
-        /* 02225554 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02225558 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225554 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02225558 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225558 */ _t9 = _t8 & 0x00000001u;
         /* 02225558 */ if (_t9) goto L_0222555C; else goto L_02225564;
   L_0222555C: ; // 0x222555c
@@ -4769,8 +4769,8 @@ void Gambit_fn_022254E8(CPUState* cpu) {
         /* 02225560 */ _t11 = cpu->r[22] + 0xFFFFFDFCu;
         /* 02225560 */ rbrew_write32(cpu->mem, _t11, cpu->r[24]);
   L_02225564: ; // 0x2225564
-        /* 02225564 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000003u);
-        /* 02225568 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02225564 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000003u));
+        /* 02225568 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02225568 */ _t13 = _t12 & 0x00000001u;
         /* 02225568 */ if (_t13) goto L_02225594; else goto L_0222556C;
   L_0222556C: ; // 0x222556c
@@ -4783,8 +4783,8 @@ void Gambit_fn_022254E8(CPUState* cpu) {
         /* 0222557C */ rbrew_write32(cpu->mem, _t15, cpu->r[0]);
         /* 02225580 */ Gambit_fn_027B70B8(cpu);
         /* 02225584 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02225588 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000003u);
-        /* 0222558C */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02225588 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000003u));
+        /* 0222558C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222558C */ _t17 = _t16 & 0x00000001u;
         /* 0222558C */ if (_t17) goto L_0222552C; else goto L_02225590;
   L_02225590: ; // 0x2225590
@@ -4792,8 +4792,8 @@ void Gambit_fn_022254E8(CPUState* cpu) {
   L_02225594: ; // 0x2225594
         /* 02225594 */ _t18 = cpu->r[21] + 0xFFFFFF6Cu;
         /* 02225594 */ cpu->r[11] = rbrew_read32(cpu->mem, _t18);
-        /* 02225598 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0222559C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225598 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0222559C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222559C */ _t20 = _t19 & 0x00000001u;
         /* 0222559C */ if (_t20) goto L_022255A0; else goto L_022255D8;
   L_022255A0: ; // 0x22255a0
@@ -4802,8 +4802,8 @@ void Gambit_fn_022254E8(CPUState* cpu) {
         /* 022255A8 */ Gambit_fn_02836FFC(cpu);
         /* 022255AC */ _t21 = cpu->r[21] + 0xFFFFFF6Cu;
         /* 022255AC */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
-        /* 022255B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022255B4 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022255B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022255B4 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022255B4 */ _t23 = _t22 & 0x00000001u;
         /* 022255B4 */ if (_t23) goto L_022255B8; else goto L_022255CC;
   L_022255B8: ; // 0x22255b8
@@ -4830,8 +4830,8 @@ void Gambit_fn_022254E8(CPUState* cpu) {
         /* 022255EC */ rbrew_write32(cpu->mem, _t28, cpu->r[0]);
         /* 022255F0 */ Gambit_fn_027B70B8(cpu);
         /* 022255F4 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 022255F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000003u);
-        /* 022255FC */ _t29 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022255F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000003u));
+        /* 022255FC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022255FC */ _t30 = _t29 & 0x00000001u;
         /* 022255FC */ if (_t30) goto L_0222552C; else goto L_02225600;
   L_02225600: ; // 0x2225600
@@ -4959,15 +4959,15 @@ void Gambit_fn_02225688(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02225688: ; // 0x2225688
-        /* 02225688 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222568C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225688 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222568C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222568C */ _t1 = _t0 & 0x00000001u;
         /* 0222568C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0222568C */ goto L_02225690;
   L_02225690: ; // 0x2225690
         /* 02225690 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02225690 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02225694 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225690 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02225694 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225694 */ _t3 = _t2 & 0x00000001u;
         /* 02225694 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02225694 */ goto L_02225698;
@@ -4986,8 +4986,8 @@ void Gambit_fn_02225688(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -5001,15 +5001,15 @@ void Gambit_fn_02225688(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -5046,7 +5046,7 @@ void Gambit_fn_022256AC(CPUState* cpu) {
         /* 022256AC */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 022256AC */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 022256AC */ cpu->r[1] = _t0;
-        /* 022256B0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022256B0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022256B0 */ _t2 = _t1 & 0x00000001u;
         /* 022256B0 */ if (_t2) goto L_022256B4; else goto L_022256BC;
   L_022256B4: ; // 0x22256b4
@@ -5116,8 +5116,8 @@ void Gambit_fn_022256EC(CPUState* cpu) {
         /* 022256EC */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 022256EC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 022256F0 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 022256F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022256F4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022256F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022256F4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022256F4 */ _t2 = _t1 & 0x00000001u;
         /* 022256F4 */ _t3 = _t2 ^ 0x00000001u;
         /* 022256F4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -5139,8 +5139,8 @@ void Gambit_fn_02225708(CPUState* cpu) {
         /* 02225708 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02225708 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0222570C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 0222570C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02225710 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222570C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02225710 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225710 */ _t2 = _t1 & 0x00000001u;
         /* 02225710 */ _t3 = _t2 ^ 0x00000001u;
         /* 02225710 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -5162,8 +5162,8 @@ void Gambit_fn_02225724(CPUState* cpu) {
         /* 02225724 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02225724 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02225728 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 02225728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0222572C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0222572C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222572C */ _t2 = _t1 & 0x00000001u;
         /* 0222572C */ _t3 = _t2 ^ 0x00000001u;
         /* 0222572C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -5206,8 +5206,8 @@ void Gambit_fn_02225750(CPUState* cpu) {
         /* 02225760 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02225764 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02225764 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02225768 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0222576C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0222576C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222576C */ _t5 = _t4 & 0x00000001u;
         /* 0222576C */ if (_t5) goto L_02225770; else goto L_0222578C;
   L_02225770: ; // 0x2225770
@@ -5246,8 +5246,8 @@ void Gambit_fn_02225754(CPUState* cpu) {
         /* 02225760 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02225764 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02225764 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02225768 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0222576C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0222576C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222576C */ _t5 = _t4 & 0x00000001u;
         /* 0222576C */ if (_t5) goto L_02225770; else goto L_0222578C;
   L_02225770: ; // 0x2225770
@@ -5381,14 +5381,14 @@ void Gambit_fn_02225810(CPUState* cpu) {
         /* 02225810 */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 02225810 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 02225810 */ cpu->r[1] = _t0;
-        /* 02225814 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225814 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225814 */ _t2 = _t1 & 0x00000001u;
         /* 02225814 */ if (_t2) goto L_02225818; else goto L_02225828;
   L_02225818: ; // 0x2225818
         /* 02225818 */ cpu->r[3] = 0x00000004u;
         /* 0222581C */ Gambit_fn_02801A78(cpu);
-        /* 02225820 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02225824 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225820 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02225824 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225824 */ _t4 = _t3 & 0x00000001u;
         /* 02225824 */ if (_t4) goto L_02225830; else goto L_02225828;
   L_02225828: ; // 0x2225828
@@ -5737,8 +5737,8 @@ void Gambit_fn_0222599C(CPUState* cpu) {
         /* 0222599C */ _t0 = cpu->r[3] + 0x00000114u;
         /* 0222599C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 022259A0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 022259A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022259A4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022259A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022259A4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022259A4 */ _t2 = _t1 & 0x00000001u;
         /* 022259A4 */ if (_t2) goto L_022259B4; else goto L_022259A8;
   L_022259A8: ; // 0x22259a8
@@ -5767,8 +5767,8 @@ void Gambit_fn_022259C0(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -5834,10 +5834,10 @@ void Gambit_fn_022259F0(CPUState* cpu) {
         /* 022259F0 */ cpu->r[10] = 0x101D0000u;
         /* 022259F4 */ _t0 = cpu->r[10] + 0xFFFFFDF0u;
         /* 022259F4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 022259F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 022259F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 022259FC */ cpu->r[10] = 0x101D0000u;
         /* 02225A00 */ cpu->r[10] = cpu->r[10] + 0xFFFFFF68u;
-        /* 02225A04 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225A04 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225A04 */ _t2 = _t1 & 0x00000001u;
         /* 02225A04 */ if (_t2) goto L_02225A08; else goto L_02225A20;
   L_02225A08: ; // 0x2225a08
@@ -5850,8 +5850,8 @@ void Gambit_fn_022259F0(CPUState* cpu) {
         /* 02225A1C */ _t4 = cpu->r[10] + 0x00000000u;
         /* 02225A1C */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_02225A20: ; // 0x2225a20
-        /* 02225A20 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02225A24 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225A20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02225A24 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225A24 */ _t6 = _t5 & 0x00000001u;
         /* 02225A24 */ if (_t6) goto L_02225A28; else goto L_02225A30;
   L_02225A28: ; // 0x2225a28
@@ -5862,9 +5862,9 @@ void Gambit_fn_022259F0(CPUState* cpu) {
         /* 02225A34 */ _t7 = cpu->r[9] + 0xFFFFDA00u;
         /* 02225A34 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 02225A38 */ cpu->r[11] = 0x101D0000u;
-        /* 02225A3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02225A3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02225A40 */ cpu->r[11] = cpu->r[11] + 0xFFFFFBFCu;
-        /* 02225A44 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225A44 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225A44 */ _t9 = _t8 & 0x00000001u;
         /* 02225A44 */ if (_t9) goto L_02225A48; else goto L_02225A60;
   L_02225A48: ; // 0x2225a48
@@ -5877,8 +5877,8 @@ void Gambit_fn_022259F0(CPUState* cpu) {
         /* 02225A5C */ _t11 = cpu->r[11] + 0x00000000u;
         /* 02225A5C */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_02225A60: ; // 0x2225a60
-        /* 02225A60 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 02225A64 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225A60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 02225A64 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225A64 */ _t13 = _t12 & 0x00000001u;
         /* 02225A64 */ if (_t13) goto L_02225A68; else goto L_02225A70;
   L_02225A68: ; // 0x2225a68
@@ -5889,9 +5889,9 @@ void Gambit_fn_022259F0(CPUState* cpu) {
         /* 02225A74 */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 02225A74 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 02225A78 */ cpu->r[9] = 0x101D0000u;
-        /* 02225A7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02225A7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02225A80 */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 02225A84 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225A84 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225A84 */ _t16 = _t15 & 0x00000001u;
         /* 02225A84 */ if (_t16) goto L_02225A88; else goto L_02225AA0;
   L_02225A88: ; // 0x2225a88
@@ -5904,8 +5904,8 @@ void Gambit_fn_022259F0(CPUState* cpu) {
         /* 02225A9C */ _t18 = cpu->r[9] + 0x00000000u;
         /* 02225A9C */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_02225AA0: ; // 0x2225aa0
-        /* 02225AA0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 02225AA4 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225AA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 02225AA4 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225AA4 */ _t20 = _t19 & 0x00000001u;
         /* 02225AA4 */ if (_t20) goto L_02225AA8; else goto L_02225AB0;
   L_02225AA8: ; // 0x2225aa8
@@ -5917,9 +5917,9 @@ void Gambit_fn_022259F0(CPUState* cpu) {
         /* 02225AB4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 02225AB4 */ cpu->r[9] = _t21;
         /* 02225AB8 */ cpu->r[10] = 0x101D0000u;
-        /* 02225ABC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02225ABC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02225AC0 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 02225AC4 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225AC4 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225AC4 */ _t23 = _t22 & 0x00000001u;
         /* 02225AC4 */ if (_t23) goto L_02225AC8; else goto L_02225ADC;
   L_02225AC8: ; // 0x2225ac8
@@ -5931,8 +5931,8 @@ void Gambit_fn_022259F0(CPUState* cpu) {
         /* 02225AD8 */ _t25 = cpu->r[10] + 0x00000000u;
         /* 02225AD8 */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_02225ADC: ; // 0x2225adc
-        /* 02225ADC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02225AE0 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225ADC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02225AE0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225AE0 */ _t27 = _t26 & 0x00000001u;
         /* 02225AE0 */ if (_t27) goto L_02225AE4; else goto L_02225AEC;
   L_02225AE4: ; // 0x2225ae4
@@ -5944,9 +5944,9 @@ void Gambit_fn_022259F0(CPUState* cpu) {
         /* 02225AF0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 02225AF0 */ cpu->r[10] = _t28;
         /* 02225AF4 */ cpu->r[11] = 0x101D0000u;
-        /* 02225AF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02225AF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02225AFC */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 02225B00 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225B00 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225B00 */ _t30 = _t29 & 0x00000001u;
         /* 02225B00 */ if (_t30) goto L_02225B04; else goto L_02225B18;
   L_02225B04: ; // 0x2225b04
@@ -6030,18 +6030,18 @@ void Gambit_fn_02225B68(CPUState* cpu) {
         /* 02225B6C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 02225B6C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02225B70 */ cpu->r[31] = cpu->r[3];
-        /* 02225B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02225B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02225B74 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02225B74 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 02225B78 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225B78 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225B78 */ _t4 = _t3 & 0x00000001u;
         /* 02225B78 */ if (_t4) goto L_02225B7C; else goto L_02225B8C;
   L_02225B7C: ; // 0x2225b7c
         /* 02225B7C */ cpu->r[3] = 0x00000234u;
         /* 02225B80 */ Gambit_fn_02801A78(cpu);
         /* 02225B84 */ cpu->r[31] = cpu->r[3];
-        /* 02225B84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02225B88 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225B84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02225B88 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225B88 */ _t6 = _t5 & 0x00000001u;
         /* 02225B88 */ if (_t6) goto L_02225BB0; else goto L_02225B8C;
   L_02225B8C: ; // 0x2225b8c
@@ -6135,10 +6135,10 @@ void Gambit_fn_02225BC8(CPUState* cpu) {
         /* 02225C58 */ rbrew_write32(cpu->mem, _t19, cpu->r[10]);
         /* 02225C5C */ Gambit_fn_0204A864(cpu);
         /* 02225C60 */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02225C60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02225C60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02225C64 */ _t20 = cpu->r[31] + 0x000000B0u;
         /* 02225C64 */ rbrew_write32(cpu->mem, _t20, cpu->r[3]);
-        /* 02225C68 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225C68 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225C68 */ _t22 = _t21 & 0x00000001u;
         /* 02225C68 */ if (_t22) goto L_02225D54; else goto L_02225C6C;
   L_02225C6C: ; // 0x2225c6c
@@ -6147,8 +6147,8 @@ void Gambit_fn_02225BC8(CPUState* cpu) {
         /* 02225C70 */ _t24 = cpu->r[10] + 0x0000015Cu;
         /* 02225C70 */ cpu->r[6] = rbrew_read32(cpu->mem, _t24);
         /* 02225C74 */ cpu->r[5] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 02225C74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 02225C78 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225C74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 02225C78 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225C78 */ _t26 = _t25 & 0x00000001u;
         /* 02225C78 */ if (_t26) goto L_02225D54; else goto L_02225C7C;
   L_02225C7C: ; // 0x2225c7c
@@ -6356,10 +6356,10 @@ void Gambit_fn_02225DA0(CPUState* cpu) {
         /* 02225E30 */ cpu->r[7] = cpu->r[7] + 0x0000000Bu;
         /* 02225E34 */ Gambit_fn_0204A4DC(cpu);
         /* 02225E38 */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02225E38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02225E38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02225E3C */ _t14 = cpu->r[31] + 0x000000B0u;
         /* 02225E3C */ rbrew_write32(cpu->mem, _t14, cpu->r[3]);
-        /* 02225E40 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225E40 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225E40 */ _t16 = _t15 & 0x00000001u;
         /* 02225E40 */ if (_t16) goto L_02225E50; else goto L_02225E44;
   L_02225E44: ; // 0x2225e44
@@ -6373,9 +6373,9 @@ void Gambit_fn_02225DA0(CPUState* cpu) {
         /* 02225E54 */ cpu->r[26] = 0x101D0000u;
         /* 02225E58 */ cpu->r[27] = 0x101D0000u;
         /* 02225E5C */ cpu->r[28] = 0x101D0000u;
-        /* 02225E60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02225E60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02225E64 */ cpu->r[30] = 0x101D0000u;
-        /* 02225E68 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225E68 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225E68 */ _t20 = _t19 & 0x00000001u;
         /* 02225E68 */ if (_t20) goto L_02225FB0; else goto L_02225E6C;
   L_02225E6C: ; // 0x2225e6c
@@ -6407,10 +6407,10 @@ void Gambit_fn_02225DA0(CPUState* cpu) {
         /* 02225EAC */ cpu->r[12] = 0x10050000u;
         /* 02225EB0 */ _t30 = cpu->r[12] + 0xFFFFE440u;
         /* 02225EB0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t30);
-        /* 02225EB4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
+        /* 02225EB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
         /* 02225EB8 */ _t31 = cpu->r[31] + 0x00000004u;
         /* 02225EB8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t31);
-        /* 02225EBC */ _t32 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02225EBC */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02225EBC */ _t33 = _t32 & 0x00000001u;
         /* 02225EBC */ if (_t33) goto L_02225EC0; else goto L_02225EC4;
   L_02225EC0: ; // 0x2225ec0
@@ -6426,15 +6426,15 @@ void Gambit_fn_02225DA0(CPUState* cpu) {
         /* 02225ED8 */ Gambit_fn_02225194(cpu);
         /* 02225EDC */ _t36 = cpu->r[31] + 0x00000130u;
         /* 02225EDC */ cpu->r[0] = rbrew_read32(cpu->mem, _t36);
-        /* 02225EE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02225EE4 */ _t37 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02225EE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02225EE4 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02225EE4 */ _t38 = _t37 & 0x00000001u;
         /* 02225EE4 */ if (_t38) goto L_02225EE8; else goto L_02225FB0;
   L_02225EE8: ; // 0x2225ee8
         /* 02225EE8 */ _t39 = cpu->r[30] + 0xFFFFFE00u;
         /* 02225EE8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t39);
-        /* 02225EEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02225EF0 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225EEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02225EF0 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225EF0 */ _t41 = _t40 & 0x00000001u;
         /* 02225EF0 */ if (_t41) goto L_02225EF4; else goto L_02225F10;
   L_02225EF4: ; // 0x2225ef4
@@ -6449,8 +6449,8 @@ void Gambit_fn_02225DA0(CPUState* cpu) {
   L_02225F10: ; // 0x2225f10
         /* 02225F10 */ _t43 = cpu->r[28] + 0xFFFFFDFCu;
         /* 02225F10 */ cpu->r[8] = rbrew_read32(cpu->mem, _t43);
-        /* 02225F14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02225F18 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225F14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02225F18 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225F18 */ _t45 = _t44 & 0x00000001u;
         /* 02225F18 */ if (_t45) goto L_02225F1C; else goto L_02225F44;
   L_02225F1C: ; // 0x2225f1c
@@ -6464,8 +6464,8 @@ void Gambit_fn_02225DA0(CPUState* cpu) {
         /* 02225F30 */ Gambit_fn_02836FFC(cpu);
         /* 02225F34 */ _t48 = cpu->r[26] + 0xFFFFFF6Cu;
         /* 02225F34 */ cpu->r[0] = rbrew_read32(cpu->mem, _t48);
-        /* 02225F38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02225F3C */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225F38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02225F3C */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225F3C */ _t50 = _t49 & 0x00000001u;
         /* 02225F3C */ if (_t50) goto L_02225F68; else goto L_02225F40;
   L_02225F40: ; // 0x2225f40
@@ -6473,8 +6473,8 @@ void Gambit_fn_02225DA0(CPUState* cpu) {
   L_02225F44: ; // 0x2225f44
         /* 02225F44 */ _t51 = cpu->r[26] + 0xFFFFFF6Cu;
         /* 02225F44 */ cpu->r[5] = rbrew_read32(cpu->mem, _t51);
-        /* 02225F48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 02225F4C */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225F48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 02225F4C */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225F4C */ _t53 = _t52 & 0x00000001u;
         /* 02225F4C */ if (_t53) goto L_02225F50; else goto L_02225F90;
   L_02225F50: ; // 0x2225f50
@@ -6483,8 +6483,8 @@ void Gambit_fn_02225DA0(CPUState* cpu) {
         /* 02225F58 */ Gambit_fn_02836FFC(cpu);
         /* 02225F5C */ _t54 = cpu->r[26] + 0xFFFFFF6Cu;
         /* 02225F5C */ cpu->r[0] = rbrew_read32(cpu->mem, _t54);
-        /* 02225F60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02225F64 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225F60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02225F64 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225F64 */ _t56 = _t55 & 0x00000001u;
         /* 02225F64 */ if (_t56) goto L_02225F68; else goto L_02225F84;
   L_02225F68: ; // 0x2225f68
@@ -6533,7 +6533,7 @@ void Gambit_fn_02225DA0(CPUState* cpu) {
         /* 02225FD8 */ cpu->r[25] = cpu->r[12] + cpu->r[7];
         /* 02225FDC */ Gambit_fn_02830138(cpu);
         /* 02225FE0 */ /* nop */
-        /* 02225FE4 */ _t68 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02225FE4 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02225FE4 */ _t69 = _t68 & 0x00000001u;
         /* 02225FE4 */ if (_t69) goto L_02225FE8; else goto L_02226114;
   L_02225FE8: ; // 0x2225fe8
@@ -6541,8 +6541,8 @@ void Gambit_fn_02225DA0(CPUState* cpu) {
         /* 02225FE8 */ cpu->r[8] = rbrew_read16(cpu->mem, _t70);
         /* 02225FEC */ _t71 = cpu->r[31] + 0x00000228u;
         /* 02225FEC */ cpu->r[10] = rbrew_read32(cpu->mem, _t71);
-        /* 02225FF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], cpu->r[10]);
-        /* 02225FF4 */ _t72 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02225FF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], cpu->r[10]));
+        /* 02225FF4 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02225FF4 */ _t73 = _t72 & 0x00000001u;
         /* 02225FF4 */ if (_t73) goto L_02225FF8; else goto L_02226114;
   L_02225FF8: ; // 0x2225ff8
@@ -6589,8 +6589,8 @@ void Gambit_fn_02225DA0(CPUState* cpu) {
         /* 02226048 */ rbrew_write_f32(cpu->mem, _t93, cpu->f[13]);
         /* 0222604C */ _t94 = cpu->r[30] + 0xFFFFFE00u;
         /* 0222604C */ cpu->r[6] = rbrew_read32(cpu->mem, _t94);
-        /* 02226050 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 02226054 */ _t95 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226050 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 02226054 */ _t95 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226054 */ _t96 = _t95 & 0x00000001u;
         /* 02226054 */ if (_t96) goto L_02226058; else goto L_02226074;
   L_02226058: ; // 0x2226058
@@ -6605,8 +6605,8 @@ void Gambit_fn_02225DA0(CPUState* cpu) {
   L_02226074: ; // 0x2226074
         /* 02226074 */ _t98 = cpu->r[28] + 0xFFFFFDFCu;
         /* 02226074 */ cpu->r[8] = rbrew_read32(cpu->mem, _t98);
-        /* 02226078 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 0222607C */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226078 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 0222607C */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222607C */ _t100 = _t99 & 0x00000001u;
         /* 0222607C */ if (_t100) goto L_02226080; else goto L_022260A8;
   L_02226080: ; // 0x2226080
@@ -6620,8 +6620,8 @@ void Gambit_fn_02225DA0(CPUState* cpu) {
         /* 02226094 */ Gambit_fn_02836FFC(cpu);
         /* 02226098 */ _t103 = cpu->r[26] + 0xFFFFFF6Cu;
         /* 02226098 */ cpu->r[10] = rbrew_read32(cpu->mem, _t103);
-        /* 0222609C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 022260A0 */ _t104 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222609C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 022260A0 */ _t104 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022260A0 */ _t105 = _t104 & 0x00000001u;
         /* 022260A0 */ if (_t105) goto L_022260CC; else goto L_022260A4;
   L_022260A4: ; // 0x22260a4
@@ -6629,8 +6629,8 @@ void Gambit_fn_02225DA0(CPUState* cpu) {
   L_022260A8: ; // 0x22260a8
         /* 022260A8 */ _t106 = cpu->r[26] + 0xFFFFFF6Cu;
         /* 022260A8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t106);
-        /* 022260AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 022260B0 */ _t107 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022260AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 022260B0 */ _t107 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022260B0 */ _t108 = _t107 & 0x00000001u;
         /* 022260B0 */ if (_t108) goto L_022260B4; else goto L_022260F4;
   L_022260B4: ; // 0x22260b4
@@ -6639,8 +6639,8 @@ void Gambit_fn_02225DA0(CPUState* cpu) {
         /* 022260BC */ Gambit_fn_02836FFC(cpu);
         /* 022260C0 */ _t109 = cpu->r[26] + 0xFFFFFF6Cu;
         /* 022260C0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t109);
-        /* 022260C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 022260C8 */ _t110 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022260C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 022260C8 */ _t110 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022260C8 */ _t111 = _t110 & 0x00000001u;
         /* 022260C8 */ if (_t111) goto L_022260CC; else goto L_022260E8;
   L_022260CC: ; // 0x22260cc
@@ -6858,7 +6858,7 @@ void Gambit_fn_02226138(CPUState* cpu) {
         /* 022262D4 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t61);
         /* 022262D8 */ _t62 = cpu->r[1] + 0x00000098u;
         /* 022262D8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t62);
-        /* 022262DC */ _t63 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022262DC */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022262DC */ _t64 = _t63 & 0x00000001u;
         /* 022262DC */ if (_t64) goto L_022262E0; // else: addr-0 trap, fall-through
   L_022262E0: ; // 0x22262e0
@@ -6887,14 +6887,14 @@ void Gambit_fn_022262F0(CPUState* cpu) {
         /* 02226304 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 02226308 */ _t4 = cpu->r[31] + 0x00004710u;
         /* 02226308 */ cpu->r[10] = rbrew_read32(cpu->mem, _t4);
-        /* 0222630C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0222630C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02226310 */ cpu->r[30] = cpu->r[3];
-        /* 02226314 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226314 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226314 */ _t6 = _t5 & 0x00000001u;
         /* 02226314 */ if (_t6) goto L_02226320; else goto L_02226318;
   L_02226318: ; // 0x2226318
-        /* 02226318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000001u);
-        /* 0222631C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000001u));
+        /* 0222631C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222631C */ _t8 = _t7 & 0x00000001u;
         /* 0222631C */ if (_t8) goto L_02226320; else goto L_02226364;
   L_02226320: ; // 0x2226320
@@ -6923,8 +6923,8 @@ void Gambit_fn_022262F0(CPUState* cpu) {
         /* 02226350 */ rbrew_write_f32(cpu->mem, _t18, cpu->f[0]);
         /* 02226354 */ _t19 = cpu->r[31] + 0x000046E0u;
         /* 02226354 */ cpu->r[0] = rbrew_read8(cpu->mem, _t19);
-        /* 02226358 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222635C */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226358 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222635C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222635C */ _t21 = _t20 & 0x00000001u;
         /* 0222635C */ if (_t21) goto L_022263BC; else goto L_02226360;
   L_02226360: ; // 0x2226360
@@ -6954,8 +6954,8 @@ void Gambit_fn_022262F0(CPUState* cpu) {
         /* 02226394 */ rbrew_write_f32(cpu->mem, _t30, cpu->f[0]);
         /* 02226398 */ _t31 = cpu->r[31] + 0x000046E0u;
         /* 02226398 */ cpu->r[0] = rbrew_read8(cpu->mem, _t31);
-        /* 0222639C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022263A0 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222639C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022263A0 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022263A0 */ _t33 = _t32 & 0x00000001u;
         /* 022263A0 */ if (_t33) goto L_022263BC; else goto L_022263A4;
   L_022263A4: ; // 0x22263a4
@@ -6965,8 +6965,8 @@ void Gambit_fn_022262F0(CPUState* cpu) {
         /* 022263A8 */ rbrew_write32(cpu->mem, _t35, cpu->r[10]);
         /* 022263AC */ _t36 = cpu->r[31] + 0x000046E1u;
         /* 022263AC */ cpu->r[12] = rbrew_read8(cpu->mem, _t36);
-        /* 022263B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022263B4 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022263B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022263B4 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022263B4 */ _t38 = _t37 & 0x00000001u;
         /* 022263B4 */ if (_t38) goto L_022263E8; else goto L_022263B8;
   L_022263B8: ; // 0x22263b8
@@ -6977,8 +6977,8 @@ void Gambit_fn_022262F0(CPUState* cpu) {
         /* 022263C0 */ rbrew_write32(cpu->mem, _t39, cpu->r[10]);
         /* 022263C4 */ _t40 = cpu->r[31] + 0x000046E1u;
         /* 022263C4 */ cpu->r[12] = rbrew_read8(cpu->mem, _t40);
-        /* 022263C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022263CC */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022263C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022263CC */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022263CC */ _t42 = _t41 & 0x00000001u;
         /* 022263CC */ if (_t42) goto L_022263E8; else goto L_022263D0;
   L_022263D0: ; // 0x22263d0
@@ -6988,8 +6988,8 @@ void Gambit_fn_022262F0(CPUState* cpu) {
         /* 022263D4 */ rbrew_write32(cpu->mem, _t44, cpu->r[11]);
         /* 022263D8 */ _t45 = cpu->r[31] + 0x000046E2u;
         /* 022263D8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t45);
-        /* 022263DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022263E0 */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022263DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022263E0 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022263E0 */ _t47 = _t46 & 0x00000001u;
         /* 022263E0 */ if (_t47) goto L_02226430; else goto L_022263E4;
   L_022263E4: ; // 0x22263e4
@@ -7000,8 +7000,8 @@ void Gambit_fn_022262F0(CPUState* cpu) {
         /* 022263EC */ rbrew_write32(cpu->mem, _t48, cpu->r[11]);
         /* 022263F0 */ _t49 = cpu->r[31] + 0x000046E2u;
         /* 022263F0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t49);
-        /* 022263F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022263F8 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022263F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022263F8 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022263F8 */ _t51 = _t50 & 0x00000001u;
         /* 022263F8 */ if (_t51) goto L_02226430; else goto L_022263FC;
   L_022263FC: ; // 0x22263fc
@@ -7012,8 +7012,8 @@ void Gambit_fn_022262F0(CPUState* cpu) {
         /* 02226404 */ rbrew_write32(cpu->mem, _t53, cpu->r[12]);
         /* 02226408 */ _t54 = cpu->r[31] + 0x00004708u;
         /* 02226408 */ cpu->r[0] = rbrew_read8(cpu->mem, _t54);
-        /* 0222640C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02226410 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222640C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02226410 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226410 */ _t56 = _t55 & 0x00000001u;
         /* 02226410 */ if (_t56) goto L_02226414; else goto L_02226444;
   L_02226414: ; // 0x2226414
@@ -7033,8 +7033,8 @@ void Gambit_fn_022262F0(CPUState* cpu) {
         /* 02226434 */ rbrew_write32(cpu->mem, _t60, cpu->r[12]);
         /* 02226438 */ _t61 = cpu->r[31] + 0x00004708u;
         /* 02226438 */ cpu->r[0] = rbrew_read8(cpu->mem, _t61);
-        /* 0222643C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02226440 */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222643C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02226440 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226440 */ _t63 = _t62 & 0x00000001u;
         /* 02226440 */ if (_t63) goto L_02226414; else goto L_02226444;
   L_02226444: ; // 0x2226444
@@ -7075,14 +7075,14 @@ void Gambit_fn_022262F4(CPUState* cpu) {
         /* 02226304 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 02226308 */ _t4 = cpu->r[31] + 0x00004710u;
         /* 02226308 */ cpu->r[10] = rbrew_read32(cpu->mem, _t4);
-        /* 0222630C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0222630C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02226310 */ cpu->r[30] = cpu->r[3];
-        /* 02226314 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226314 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226314 */ _t6 = _t5 & 0x00000001u;
         /* 02226314 */ if (_t6) goto L_02226320; else goto L_02226318;
   L_02226318: ; // 0x2226318
-        /* 02226318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000001u);
-        /* 0222631C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000001u));
+        /* 0222631C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222631C */ _t8 = _t7 & 0x00000001u;
         /* 0222631C */ if (_t8) goto L_02226320; else goto L_02226364;
   L_02226320: ; // 0x2226320
@@ -7111,8 +7111,8 @@ void Gambit_fn_022262F4(CPUState* cpu) {
         /* 02226350 */ rbrew_write_f32(cpu->mem, _t18, cpu->f[0]);
         /* 02226354 */ _t19 = cpu->r[31] + 0x000046E0u;
         /* 02226354 */ cpu->r[0] = rbrew_read8(cpu->mem, _t19);
-        /* 02226358 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222635C */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226358 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222635C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222635C */ _t21 = _t20 & 0x00000001u;
         /* 0222635C */ if (_t21) goto L_022263BC; else goto L_02226360;
   L_02226360: ; // 0x2226360
@@ -7142,8 +7142,8 @@ void Gambit_fn_022262F4(CPUState* cpu) {
         /* 02226394 */ rbrew_write_f32(cpu->mem, _t30, cpu->f[0]);
         /* 02226398 */ _t31 = cpu->r[31] + 0x000046E0u;
         /* 02226398 */ cpu->r[0] = rbrew_read8(cpu->mem, _t31);
-        /* 0222639C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022263A0 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222639C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022263A0 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022263A0 */ _t33 = _t32 & 0x00000001u;
         /* 022263A0 */ if (_t33) goto L_022263BC; else goto L_022263A4;
   L_022263A4: ; // 0x22263a4
@@ -7153,8 +7153,8 @@ void Gambit_fn_022262F4(CPUState* cpu) {
         /* 022263A8 */ rbrew_write32(cpu->mem, _t35, cpu->r[10]);
         /* 022263AC */ _t36 = cpu->r[31] + 0x000046E1u;
         /* 022263AC */ cpu->r[12] = rbrew_read8(cpu->mem, _t36);
-        /* 022263B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022263B4 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022263B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022263B4 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022263B4 */ _t38 = _t37 & 0x00000001u;
         /* 022263B4 */ if (_t38) goto L_022263E8; else goto L_022263B8;
   L_022263B8: ; // 0x22263b8
@@ -7165,8 +7165,8 @@ void Gambit_fn_022262F4(CPUState* cpu) {
         /* 022263C0 */ rbrew_write32(cpu->mem, _t39, cpu->r[10]);
         /* 022263C4 */ _t40 = cpu->r[31] + 0x000046E1u;
         /* 022263C4 */ cpu->r[12] = rbrew_read8(cpu->mem, _t40);
-        /* 022263C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022263CC */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022263C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022263CC */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022263CC */ _t42 = _t41 & 0x00000001u;
         /* 022263CC */ if (_t42) goto L_022263E8; else goto L_022263D0;
   L_022263D0: ; // 0x22263d0
@@ -7176,8 +7176,8 @@ void Gambit_fn_022262F4(CPUState* cpu) {
         /* 022263D4 */ rbrew_write32(cpu->mem, _t44, cpu->r[11]);
         /* 022263D8 */ _t45 = cpu->r[31] + 0x000046E2u;
         /* 022263D8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t45);
-        /* 022263DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022263E0 */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022263DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022263E0 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022263E0 */ _t47 = _t46 & 0x00000001u;
         /* 022263E0 */ if (_t47) goto L_02226430; else goto L_022263E4;
   L_022263E4: ; // 0x22263e4
@@ -7188,8 +7188,8 @@ void Gambit_fn_022262F4(CPUState* cpu) {
         /* 022263EC */ rbrew_write32(cpu->mem, _t48, cpu->r[11]);
         /* 022263F0 */ _t49 = cpu->r[31] + 0x000046E2u;
         /* 022263F0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t49);
-        /* 022263F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022263F8 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022263F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022263F8 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022263F8 */ _t51 = _t50 & 0x00000001u;
         /* 022263F8 */ if (_t51) goto L_02226430; else goto L_022263FC;
   L_022263FC: ; // 0x22263fc
@@ -7200,8 +7200,8 @@ void Gambit_fn_022262F4(CPUState* cpu) {
         /* 02226404 */ rbrew_write32(cpu->mem, _t53, cpu->r[12]);
         /* 02226408 */ _t54 = cpu->r[31] + 0x00004708u;
         /* 02226408 */ cpu->r[0] = rbrew_read8(cpu->mem, _t54);
-        /* 0222640C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02226410 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222640C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02226410 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226410 */ _t56 = _t55 & 0x00000001u;
         /* 02226410 */ if (_t56) goto L_02226414; else goto L_02226444;
   L_02226414: ; // 0x2226414
@@ -7221,8 +7221,8 @@ void Gambit_fn_022262F4(CPUState* cpu) {
         /* 02226434 */ rbrew_write32(cpu->mem, _t60, cpu->r[12]);
         /* 02226438 */ _t61 = cpu->r[31] + 0x00004708u;
         /* 02226438 */ cpu->r[0] = rbrew_read8(cpu->mem, _t61);
-        /* 0222643C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02226440 */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222643C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02226440 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226440 */ _t63 = _t62 & 0x00000001u;
         /* 02226440 */ if (_t63) goto L_02226414; else goto L_02226444;
   L_02226444: ; // 0x2226444
@@ -7326,15 +7326,15 @@ void Gambit_fn_022264D4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_022264D4: ; // 0x22264d4
-        /* 022264D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022264D8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022264D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022264D8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022264D8 */ _t1 = _t0 & 0x00000001u;
         /* 022264D8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022264D8 */ goto L_022264DC;
   L_022264DC: ; // 0x22264dc
         /* 022264DC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022264DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022264E0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022264DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022264E0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022264E0 */ _t3 = _t2 & 0x00000001u;
         /* 022264E0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022264E0 */ goto L_022264E4;
@@ -7353,8 +7353,8 @@ void Gambit_fn_022264D4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -7368,15 +7368,15 @@ void Gambit_fn_022264D4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -7455,8 +7455,8 @@ void Gambit_fn_02226508(CPUState* cpu) {
         /* 02226508 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02226508 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0222650C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 0222650C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02226510 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222650C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02226510 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226510 */ _t2 = _t1 & 0x00000001u;
         /* 02226510 */ _t3 = _t2 ^ 0x00000001u;
         /* 02226510 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -7478,8 +7478,8 @@ void Gambit_fn_02226524(CPUState* cpu) {
         /* 02226524 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02226524 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02226528 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 02226528 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0222652C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226528 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0222652C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222652C */ _t2 = _t1 & 0x00000001u;
         /* 0222652C */ _t3 = _t2 ^ 0x00000001u;
         /* 0222652C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -7501,8 +7501,8 @@ void Gambit_fn_02226540(CPUState* cpu) {
         /* 02226540 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02226540 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02226544 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 02226544 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02226548 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226544 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02226548 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226548 */ _t2 = _t1 & 0x00000001u;
         /* 02226548 */ _t3 = _t2 ^ 0x00000001u;
         /* 02226548 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -7545,8 +7545,8 @@ void Gambit_fn_0222656C(CPUState* cpu) {
         /* 0222657C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02226580 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02226580 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02226584 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02226588 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02226588 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226588 */ _t5 = _t4 & 0x00000001u;
         /* 02226588 */ if (_t5) goto L_0222658C; else goto L_022265A8;
   L_0222658C: ; // 0x222658c
@@ -7585,8 +7585,8 @@ void Gambit_fn_02226570(CPUState* cpu) {
         /* 0222657C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02226580 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02226580 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02226584 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02226588 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02226588 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226588 */ _t5 = _t4 & 0x00000001u;
         /* 02226588 */ if (_t5) goto L_0222658C; else goto L_022265A8;
   L_0222658C: ; // 0x222658c
@@ -7615,15 +7615,15 @@ void Gambit_fn_022265C4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_022265C4: ; // 0x22265c4
-        /* 022265C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022265C8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022265C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022265C8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022265C8 */ _t1 = _t0 & 0x00000001u;
         /* 022265C8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022265C8 */ goto L_022265CC;
   L_022265CC: ; // 0x22265cc
         /* 022265CC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022265CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022265D0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022265CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022265D0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022265D0 */ _t3 = _t2 & 0x00000001u;
         /* 022265D0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022265D0 */ goto L_022265D4;
@@ -7642,8 +7642,8 @@ void Gambit_fn_022265C4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -7657,15 +7657,15 @@ void Gambit_fn_022265C4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -8124,8 +8124,8 @@ void Gambit_fn_02226798(CPUState* cpu) {
         /* 02226798 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 02226798 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0222679C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0222679C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022267A0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222679C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022267A0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022267A0 */ _t2 = _t1 & 0x00000001u;
         /* 022267A0 */ if (_t2) goto L_022267B0; else goto L_022267A4;
   L_022267A4: ; // 0x22267a4
@@ -8154,8 +8154,8 @@ void Gambit_fn_022267BC(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -8261,10 +8261,10 @@ void Gambit_fn_02226814(CPUState* cpu) {
         /* 02226814 */ cpu->r[10] = 0x101D0000u;
         /* 02226818 */ _t0 = cpu->r[10] + 0xFFFFFE0Cu;
         /* 02226818 */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 0222681C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0222681C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02226820 */ cpu->r[10] = 0x101D0000u;
         /* 02226824 */ cpu->r[10] = cpu->r[10] + 0xFFFFFF7Cu;
-        /* 02226828 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226828 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226828 */ _t2 = _t1 & 0x00000001u;
         /* 02226828 */ if (_t2) goto L_0222682C; else goto L_02226844;
   L_0222682C: ; // 0x222682c
@@ -8277,8 +8277,8 @@ void Gambit_fn_02226814(CPUState* cpu) {
         /* 02226840 */ _t4 = cpu->r[10] + 0x00000000u;
         /* 02226840 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_02226844: ; // 0x2226844
-        /* 02226844 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02226848 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02226848 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226848 */ _t6 = _t5 & 0x00000001u;
         /* 02226848 */ if (_t6) goto L_0222684C; else goto L_02226854;
   L_0222684C: ; // 0x222684c
@@ -8289,9 +8289,9 @@ void Gambit_fn_02226814(CPUState* cpu) {
         /* 02226858 */ _t7 = cpu->r[9] + 0xFFFFDA00u;
         /* 02226858 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 0222685C */ cpu->r[11] = 0x101D0000u;
-        /* 02226860 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02226860 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02226864 */ cpu->r[11] = cpu->r[11] + 0xFFFFFBFCu;
-        /* 02226868 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226868 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226868 */ _t9 = _t8 & 0x00000001u;
         /* 02226868 */ if (_t9) goto L_0222686C; else goto L_02226884;
   L_0222686C: ; // 0x222686c
@@ -8304,8 +8304,8 @@ void Gambit_fn_02226814(CPUState* cpu) {
         /* 02226880 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 02226880 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_02226884: ; // 0x2226884
-        /* 02226884 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 02226888 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226884 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 02226888 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226888 */ _t13 = _t12 & 0x00000001u;
         /* 02226888 */ if (_t13) goto L_0222688C; else goto L_02226894;
   L_0222688C: ; // 0x222688c
@@ -8316,9 +8316,9 @@ void Gambit_fn_02226814(CPUState* cpu) {
         /* 02226898 */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 02226898 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 0222689C */ cpu->r[9] = 0x101D0000u;
-        /* 022268A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 022268A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 022268A4 */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 022268A8 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022268A8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022268A8 */ _t16 = _t15 & 0x00000001u;
         /* 022268A8 */ if (_t16) goto L_022268AC; else goto L_022268C4;
   L_022268AC: ; // 0x22268ac
@@ -8331,8 +8331,8 @@ void Gambit_fn_02226814(CPUState* cpu) {
         /* 022268C0 */ _t18 = cpu->r[9] + 0x00000000u;
         /* 022268C0 */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_022268C4: ; // 0x22268c4
-        /* 022268C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 022268C8 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022268C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 022268C8 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022268C8 */ _t20 = _t19 & 0x00000001u;
         /* 022268C8 */ if (_t20) goto L_022268CC; else goto L_022268D4;
   L_022268CC: ; // 0x22268cc
@@ -8344,9 +8344,9 @@ void Gambit_fn_02226814(CPUState* cpu) {
         /* 022268D8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 022268D8 */ cpu->r[9] = _t21;
         /* 022268DC */ cpu->r[10] = 0x101D0000u;
-        /* 022268E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 022268E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 022268E4 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 022268E8 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022268E8 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022268E8 */ _t23 = _t22 & 0x00000001u;
         /* 022268E8 */ if (_t23) goto L_022268EC; else goto L_02226900;
   L_022268EC: ; // 0x22268ec
@@ -8358,8 +8358,8 @@ void Gambit_fn_02226814(CPUState* cpu) {
         /* 022268FC */ _t25 = cpu->r[10] + 0x00000000u;
         /* 022268FC */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_02226900: ; // 0x2226900
-        /* 02226900 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02226904 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226900 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02226904 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226904 */ _t27 = _t26 & 0x00000001u;
         /* 02226904 */ if (_t27) goto L_02226908; else goto L_02226910;
   L_02226908: ; // 0x2226908
@@ -8371,9 +8371,9 @@ void Gambit_fn_02226814(CPUState* cpu) {
         /* 02226914 */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 02226914 */ cpu->r[10] = _t28;
         /* 02226918 */ cpu->r[11] = 0x101D0000u;
-        /* 0222691C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0222691C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02226920 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 02226924 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226924 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226924 */ _t30 = _t29 & 0x00000001u;
         /* 02226924 */ if (_t30) goto L_02226928; else goto L_0222693C;
   L_02226928: ; // 0x2226928
@@ -8477,8 +8477,8 @@ void Gambit_fn_022269AC(CPUState* cpu) {
         /* 022269D4 */ cpu->r[4] = cpu->r[27];
         /* 022269D8 */ Gambit_fn_027DB318(cpu);
         /* 022269DC */ cpu->r[28] = cpu->r[3] + cpu->r[31];
-        /* 022269DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 022269E0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022269DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 022269E0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022269E0 */ _t3 = _t2 & 0x00000001u;
         /* 022269E0 */ if (_t3) goto L_02226A74; else goto L_022269E4;
   L_022269E4: ; // 0x22269e4
@@ -8492,24 +8492,24 @@ void Gambit_fn_022269AC(CPUState* cpu) {
         /* 022269F8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 022269FC */ cpu->r[30] = cpu->r[30] - cpu->r[29];
         /* 02226A00 */ cpu->r[31] = cpu->r[0] - cpu->r[29];
-        /* 02226A04 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[30]);
+        /* 02226A04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[30]));
         /* 02226A08 */ cpu->r[25] = 0x00000000u;
-        /* 02226A0C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226A0C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226A0C */ _t7 = _t6 & 0x00000001u;
         /* 02226A0C */ if (_t7) goto L_02226A74; else goto L_02226A10;
   L_02226A10: ; // 0x2226a10
         /* 02226A10 */ cpu->r[24] = 0x101C0000u;
   L_02226A14: ; // 0x2226a14
-        /* 02226A14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 02226A18 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226A14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 02226A18 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226A18 */ _t9 = _t8 & 0x00000001u;
         /* 02226A18 */ if (_t9) goto L_02226A30; else goto L_02226A1C;
   L_02226A1C: ; // 0x2226a1c
         /* 02226A1C */ cpu->ctr = cpu->r[27];
         /* 02226A20 */ cpu->r[3] = cpu->r[31];
         /* 02226A24 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02226A28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02226A2C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226A28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02226A2C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226A2C */ _t11 = _t10 & 0x00000001u;
         /* 02226A2C */ if (_t11) goto L_02226A60; else goto L_02226A30;
   L_02226A30: ; // 0x2226a30
@@ -8536,8 +8536,8 @@ void Gambit_fn_022269AC(CPUState* cpu) {
         /* 02226A64 */ _t18 = cpu->r[12] + 0x00000004u;
         /* 02226A64 */ cpu->r[0] = rbrew_read32(cpu->mem, _t18);
         /* 02226A68 */ cpu->r[31] = cpu->r[0] - cpu->r[29];
-        /* 02226A6C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[30]);
-        /* 02226A70 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226A6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[30]));
+        /* 02226A70 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226A70 */ _t20 = _t19 & 0x00000001u;
         /* 02226A70 */ if (_t20) goto L_02226A74; else goto L_02226A14;
   L_02226A74: ; // 0x2226a74
@@ -8568,32 +8568,32 @@ void Gambit_fn_02226A8C(CPUState* cpu) {
         /* 02226AA0 */ _t4 = cpu->r[1] + 0x00000010u;
         /* 02226AA0 */ rbrew_write32(cpu->mem, _t4, cpu->r[30]);
         /* 02226AA4 */ cpu->r[31] = cpu->r[3];
-        /* 02226AA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02226AA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02226AA8 */ _t5 = cpu->r[1] + 0x0000001Cu;
         /* 02226AA8 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
-        /* 02226AAC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226AAC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226AAC */ _t7 = _t6 & 0x00000001u;
         /* 02226AAC */ if (_t7) goto L_02226AB0; else goto L_02226AC0;
   L_02226AB0: ; // 0x2226ab0
         /* 02226AB0 */ cpu->r[3] = 0x00000038u;
         /* 02226AB4 */ Gambit_fn_02801A78(cpu);
         /* 02226AB8 */ cpu->r[31] = cpu->r[3];
-        /* 02226AB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02226ABC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226AB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02226ABC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226ABC */ _t9 = _t8 & 0x00000001u;
         /* 02226ABC */ if (_t9) goto L_02226BB8; else goto L_02226AC0;
   L_02226AC0: ; // 0x2226ac0
         /* 02226AC0 */ cpu->r[3] = cpu->r[31];
-        /* 02226AC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02226AC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02226AC4 */ cpu->r[29] = 0x00000000u;
-        /* 02226AC8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226AC8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226AC8 */ _t11 = _t10 & 0x00000001u;
         /* 02226AC8 */ if (_t11) goto L_02226ACC; else goto L_02226ADC;
   L_02226ACC: ; // 0x2226acc
         /* 02226ACC */ cpu->r[3] = 0x00000008u;
         /* 02226AD0 */ Gambit_fn_02801A78(cpu);
-        /* 02226AD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02226AD8 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226AD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02226AD8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226AD8 */ _t13 = _t12 & 0x00000001u;
         /* 02226AD8 */ if (_t13) goto L_02226AEC; else goto L_02226ADC;
   L_02226ADC: ; // 0x2226adc
@@ -8611,31 +8611,31 @@ void Gambit_fn_02226A8C(CPUState* cpu) {
         /* 02226AF4 */ rbrew_write32(cpu->mem, _t17, cpu->r[29]);
         /* 02226AF8 */ cpu->r[0] = cpu->r[0] + 0xFFFFE9D0u;
         /* 02226AFC */ cpu->r[30] = cpu->r[31] + 0x00000020u;
-        /* 02226AFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02226AFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02226B00 */ _t18 = cpu->r[31] + 0x00000004u;
         /* 02226B00 */ rbrew_write32(cpu->mem, _t18, cpu->r[0]);
-        /* 02226B04 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226B04 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226B04 */ _t20 = _t19 & 0x00000001u;
         /* 02226B04 */ if (_t20) goto L_02226B08; else goto L_02226B18;
   L_02226B08: ; // 0x2226b08
         /* 02226B08 */ cpu->r[3] = 0x00000014u;
         /* 02226B0C */ Gambit_fn_02801A78(cpu);
         /* 02226B10 */ cpu->r[30] = cpu->r[3];
-        /* 02226B10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02226B14 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226B10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02226B14 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226B14 */ _t22 = _t21 & 0x00000001u;
         /* 02226B14 */ if (_t22) goto L_02226B44; else goto L_02226B18;
   L_02226B18: ; // 0x2226b18
         /* 02226B18 */ cpu->r[3] = cpu->r[30];
-        /* 02226B18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02226B1C */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226B18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02226B1C */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226B1C */ _t24 = _t23 & 0x00000001u;
         /* 02226B1C */ if (_t24) goto L_02226B20; else goto L_02226B30;
   L_02226B20: ; // 0x2226b20
         /* 02226B20 */ cpu->r[3] = 0x0000000Cu;
         /* 02226B24 */ Gambit_fn_02801A78(cpu);
-        /* 02226B28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02226B2C */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226B28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02226B2C */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226B2C */ _t26 = _t25 & 0x00000001u;
         /* 02226B2C */ if (_t26) goto L_02226B3C; else goto L_02226B30;
   L_02226B30: ; // 0x2226b30
@@ -8654,41 +8654,41 @@ void Gambit_fn_02226A8C(CPUState* cpu) {
         /* 02226B44 */ cpu->r[3] = 0x00000020u;
         /* 02226B48 */ Gambit_fn_02801A78(cpu);
         /* 02226B4C */ cpu->r[30] = cpu->r[3];
-        /* 02226B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02226B50 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02226B50 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226B50 */ _t33 = _t32 & 0x00000001u;
         /* 02226B50 */ if (_t33) goto L_02226BB0; else goto L_02226B54;
   L_02226B54: ; // 0x2226b54
         /* 02226B54 */ _t34 = cpu->r[30] + 0x00000000u;
         /* 02226B54 */ rbrew_write8(cpu->mem, _t34, (uint8_t)cpu->r[29]);
         /* 02226B58 */ cpu->r[28] = cpu->r[30] + 0x00000008u;
-        /* 02226B58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 02226B58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 02226B5C */ _t35 = cpu->r[30] + 0x00000004u;
         /* 02226B5C */ rbrew_write32(cpu->mem, _t35, cpu->r[29]);
         /* 02226B60 */ _t36 = cpu->r[30] + 0x00000001u;
         /* 02226B60 */ rbrew_write8(cpu->mem, _t36, (uint8_t)cpu->r[29]);
-        /* 02226B64 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226B64 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226B64 */ _t38 = _t37 & 0x00000001u;
         /* 02226B64 */ if (_t38) goto L_02226B68; else goto L_02226B78;
   L_02226B68: ; // 0x2226b68
         /* 02226B68 */ cpu->r[3] = 0x00000014u;
         /* 02226B6C */ Gambit_fn_02801A78(cpu);
         /* 02226B70 */ cpu->r[28] = cpu->r[3];
-        /* 02226B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 02226B74 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 02226B74 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226B74 */ _t40 = _t39 & 0x00000001u;
         /* 02226B74 */ if (_t40) goto L_02226BA4; else goto L_02226B78;
   L_02226B78: ; // 0x2226b78
         /* 02226B78 */ cpu->r[3] = cpu->r[28];
-        /* 02226B78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02226B7C */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226B78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02226B7C */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226B7C */ _t42 = _t41 & 0x00000001u;
         /* 02226B7C */ if (_t42) goto L_02226B80; else goto L_02226B90;
   L_02226B80: ; // 0x2226b80
         /* 02226B80 */ cpu->r[3] = 0x0000000Cu;
         /* 02226B84 */ Gambit_fn_02801A78(cpu);
-        /* 02226B88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02226B8C */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226B88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02226B8C */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226B8C */ _t44 = _t43 & 0x00000001u;
         /* 02226B8C */ if (_t44) goto L_02226B9C; else goto L_02226B90;
   L_02226B90: ; // 0x2226b90
@@ -8747,32 +8747,32 @@ void Gambit_fn_02226A90(CPUState* cpu) {
         /* 02226AA0 */ _t4 = cpu->r[1] + 0x00000010u;
         /* 02226AA0 */ rbrew_write32(cpu->mem, _t4, cpu->r[30]);
         /* 02226AA4 */ cpu->r[31] = cpu->r[3];
-        /* 02226AA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02226AA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02226AA8 */ _t5 = cpu->r[1] + 0x0000001Cu;
         /* 02226AA8 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
-        /* 02226AAC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226AAC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226AAC */ _t7 = _t6 & 0x00000001u;
         /* 02226AAC */ if (_t7) goto L_02226AB0; else goto L_02226AC0;
   L_02226AB0: ; // 0x2226ab0
         /* 02226AB0 */ cpu->r[3] = 0x00000038u;
         /* 02226AB4 */ Gambit_fn_02801A78(cpu);
         /* 02226AB8 */ cpu->r[31] = cpu->r[3];
-        /* 02226AB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02226ABC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226AB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02226ABC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226ABC */ _t9 = _t8 & 0x00000001u;
         /* 02226ABC */ if (_t9) goto L_02226BB8; else goto L_02226AC0;
   L_02226AC0: ; // 0x2226ac0
         /* 02226AC0 */ cpu->r[3] = cpu->r[31];
-        /* 02226AC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02226AC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02226AC4 */ cpu->r[29] = 0x00000000u;
-        /* 02226AC8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226AC8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226AC8 */ _t11 = _t10 & 0x00000001u;
         /* 02226AC8 */ if (_t11) goto L_02226ACC; else goto L_02226ADC;
   L_02226ACC: ; // 0x2226acc
         /* 02226ACC */ cpu->r[3] = 0x00000008u;
         /* 02226AD0 */ Gambit_fn_02801A78(cpu);
-        /* 02226AD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02226AD8 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226AD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02226AD8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226AD8 */ _t13 = _t12 & 0x00000001u;
         /* 02226AD8 */ if (_t13) goto L_02226AEC; else goto L_02226ADC;
   L_02226ADC: ; // 0x2226adc
@@ -8790,31 +8790,31 @@ void Gambit_fn_02226A90(CPUState* cpu) {
         /* 02226AF4 */ rbrew_write32(cpu->mem, _t17, cpu->r[29]);
         /* 02226AF8 */ cpu->r[0] = cpu->r[0] + 0xFFFFE9D0u;
         /* 02226AFC */ cpu->r[30] = cpu->r[31] + 0x00000020u;
-        /* 02226AFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02226AFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02226B00 */ _t18 = cpu->r[31] + 0x00000004u;
         /* 02226B00 */ rbrew_write32(cpu->mem, _t18, cpu->r[0]);
-        /* 02226B04 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226B04 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226B04 */ _t20 = _t19 & 0x00000001u;
         /* 02226B04 */ if (_t20) goto L_02226B08; else goto L_02226B18;
   L_02226B08: ; // 0x2226b08
         /* 02226B08 */ cpu->r[3] = 0x00000014u;
         /* 02226B0C */ Gambit_fn_02801A78(cpu);
         /* 02226B10 */ cpu->r[30] = cpu->r[3];
-        /* 02226B10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02226B14 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226B10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02226B14 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226B14 */ _t22 = _t21 & 0x00000001u;
         /* 02226B14 */ if (_t22) goto L_02226B44; else goto L_02226B18;
   L_02226B18: ; // 0x2226b18
         /* 02226B18 */ cpu->r[3] = cpu->r[30];
-        /* 02226B18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02226B1C */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226B18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02226B1C */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226B1C */ _t24 = _t23 & 0x00000001u;
         /* 02226B1C */ if (_t24) goto L_02226B20; else goto L_02226B30;
   L_02226B20: ; // 0x2226b20
         /* 02226B20 */ cpu->r[3] = 0x0000000Cu;
         /* 02226B24 */ Gambit_fn_02801A78(cpu);
-        /* 02226B28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02226B2C */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226B28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02226B2C */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226B2C */ _t26 = _t25 & 0x00000001u;
         /* 02226B2C */ if (_t26) goto L_02226B3C; else goto L_02226B30;
   L_02226B30: ; // 0x2226b30
@@ -8833,41 +8833,41 @@ void Gambit_fn_02226A90(CPUState* cpu) {
         /* 02226B44 */ cpu->r[3] = 0x00000020u;
         /* 02226B48 */ Gambit_fn_02801A78(cpu);
         /* 02226B4C */ cpu->r[30] = cpu->r[3];
-        /* 02226B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02226B50 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02226B50 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226B50 */ _t33 = _t32 & 0x00000001u;
         /* 02226B50 */ if (_t33) goto L_02226BB0; else goto L_02226B54;
   L_02226B54: ; // 0x2226b54
         /* 02226B54 */ _t34 = cpu->r[30] + 0x00000000u;
         /* 02226B54 */ rbrew_write8(cpu->mem, _t34, (uint8_t)cpu->r[29]);
         /* 02226B58 */ cpu->r[28] = cpu->r[30] + 0x00000008u;
-        /* 02226B58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 02226B58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 02226B5C */ _t35 = cpu->r[30] + 0x00000004u;
         /* 02226B5C */ rbrew_write32(cpu->mem, _t35, cpu->r[29]);
         /* 02226B60 */ _t36 = cpu->r[30] + 0x00000001u;
         /* 02226B60 */ rbrew_write8(cpu->mem, _t36, (uint8_t)cpu->r[29]);
-        /* 02226B64 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226B64 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226B64 */ _t38 = _t37 & 0x00000001u;
         /* 02226B64 */ if (_t38) goto L_02226B68; else goto L_02226B78;
   L_02226B68: ; // 0x2226b68
         /* 02226B68 */ cpu->r[3] = 0x00000014u;
         /* 02226B6C */ Gambit_fn_02801A78(cpu);
         /* 02226B70 */ cpu->r[28] = cpu->r[3];
-        /* 02226B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 02226B74 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 02226B74 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226B74 */ _t40 = _t39 & 0x00000001u;
         /* 02226B74 */ if (_t40) goto L_02226BA4; else goto L_02226B78;
   L_02226B78: ; // 0x2226b78
         /* 02226B78 */ cpu->r[3] = cpu->r[28];
-        /* 02226B78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02226B7C */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226B78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02226B7C */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226B7C */ _t42 = _t41 & 0x00000001u;
         /* 02226B7C */ if (_t42) goto L_02226B80; else goto L_02226B90;
   L_02226B80: ; // 0x2226b80
         /* 02226B80 */ cpu->r[3] = 0x0000000Cu;
         /* 02226B84 */ Gambit_fn_02801A78(cpu);
-        /* 02226B88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02226B8C */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226B88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02226B8C */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226B8C */ _t44 = _t43 & 0x00000001u;
         /* 02226B8C */ if (_t44) goto L_02226B9C; else goto L_02226B90;
   L_02226B90: ; // 0x2226b90
@@ -8933,8 +8933,8 @@ void Gambit_fn_02226BDC(CPUState* cpu) {
         /* 02226C00 */ _t6 = cpu->r[29] + 0x000054F4u;
         /* 02226C00 */ cpu->r[3] = rbrew_read32(cpu->mem, _t6);
         /* 02226C00 */ cpu->r[29] = _t6;
-        /* 02226C04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02226C08 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226C04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02226C08 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226C08 */ _t8 = _t7 & 0x00000001u;
         /* 02226C08 */ if (_t8) goto L_02226C0C; else goto L_02226C5C;
   L_02226C0C: ; // 0x2226c0c
@@ -8944,8 +8944,8 @@ void Gambit_fn_02226BDC(CPUState* cpu) {
         /* 02226C18 */ Gambit_fn_02801ADC(cpu);
         /* 02226C1C */ cpu->r[31] = cpu->r[3];
         /* 02226C20 */ cpu->r[28] = cpu->r[31] + 0x00000008u;
-        /* 02226C20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 02226C24 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226C20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 02226C24 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226C24 */ _t10 = _t9 & 0x00000001u;
         /* 02226C24 */ if (_t10) goto L_02226C44; else goto L_02226C28;
   L_02226C28: ; // 0x2226c28
@@ -8960,10 +8960,10 @@ void Gambit_fn_02226BDC(CPUState* cpu) {
   L_02226C44: ; // 0x2226c44
         /* 02226C44 */ cpu->r[12] = 0x101C0000u;
         /* 02226C48 */ cpu->r[3] = cpu->r[31];
-        /* 02226C48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02226C48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02226C4C */ _t12 = cpu->r[12] + 0x000054F8u;
         /* 02226C4C */ rbrew_write32(cpu->mem, _t12, cpu->r[28]);
-        /* 02226C50 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226C50 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226C50 */ _t14 = _t13 & 0x00000001u;
         /* 02226C50 */ if (_t14) goto L_02226C58; else goto L_02226C54;
   L_02226C54: ; // 0x2226c54
@@ -9010,8 +9010,8 @@ void Gambit_fn_02226BE0(CPUState* cpu) {
         /* 02226C00 */ _t6 = cpu->r[29] + 0x000054F4u;
         /* 02226C00 */ cpu->r[3] = rbrew_read32(cpu->mem, _t6);
         /* 02226C00 */ cpu->r[29] = _t6;
-        /* 02226C04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02226C08 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226C04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02226C08 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226C08 */ _t8 = _t7 & 0x00000001u;
         /* 02226C08 */ if (_t8) goto L_02226C0C; else goto L_02226C5C;
   L_02226C0C: ; // 0x2226c0c
@@ -9021,8 +9021,8 @@ void Gambit_fn_02226BE0(CPUState* cpu) {
         /* 02226C18 */ Gambit_fn_02801ADC(cpu);
         /* 02226C1C */ cpu->r[31] = cpu->r[3];
         /* 02226C20 */ cpu->r[28] = cpu->r[31] + 0x00000008u;
-        /* 02226C20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 02226C24 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226C20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 02226C24 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226C24 */ _t10 = _t9 & 0x00000001u;
         /* 02226C24 */ if (_t10) goto L_02226C44; else goto L_02226C28;
   L_02226C28: ; // 0x2226c28
@@ -9037,10 +9037,10 @@ void Gambit_fn_02226BE0(CPUState* cpu) {
   L_02226C44: ; // 0x2226c44
         /* 02226C44 */ cpu->r[12] = 0x101C0000u;
         /* 02226C48 */ cpu->r[3] = cpu->r[31];
-        /* 02226C48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02226C48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02226C4C */ _t12 = cpu->r[12] + 0x000054F8u;
         /* 02226C4C */ rbrew_write32(cpu->mem, _t12, cpu->r[28]);
-        /* 02226C50 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226C50 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226C50 */ _t14 = _t13 & 0x00000001u;
         /* 02226C50 */ if (_t14) goto L_02226C58; else goto L_02226C54;
   L_02226C54: ; // 0x2226c54
@@ -9075,11 +9075,11 @@ void Gambit_fn_02226C7C(CPUState* cpu) {
         /* 02226C80 */ cpu->r[0] = cpu->lr;
         /* 02226C84 */ /* nop */
         /* 02226C88 */ cpu->r[27] = cpu->r[3];
-        /* 02226C88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02226C88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02226C8C */ cpu->r[28] = cpu->r[4];
         /* 02226C90 */ _t1 = cpu->r[1] + 0x00000024u;
         /* 02226C90 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
-        /* 02226C94 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226C94 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226C94 */ _t3 = _t2 & 0x00000001u;
         /* 02226C94 */ if (_t3) goto L_02226D30; else goto L_02226C98;
   L_02226C98: ; // 0x2226c98
@@ -9088,10 +9088,10 @@ void Gambit_fn_02226C7C(CPUState* cpu) {
         /* 02226C9C */ cpu->r[0] = 0x10050000u;
         /* 02226CA0 */ cpu->r[29] = 0x00000000u;
         /* 02226CA4 */ cpu->r[0] = cpu->r[0] + 0xFFFFE9D0u;
-        /* 02226CA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[7]);
+        /* 02226CA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[7]));
         /* 02226CAC */ _t5 = cpu->r[27] + 0x00000004u;
         /* 02226CAC */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
-        /* 02226CB0 */ _t6 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02226CB0 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02226CB0 */ _t7 = _t6 & 0x00000001u;
         /* 02226CB0 */ if (_t7) goto L_02226CB4; else goto L_02226CF8;
   L_02226CB4: ; // 0x2226cb4
@@ -9117,10 +9117,10 @@ void Gambit_fn_02226C7C(CPUState* cpu) {
         /* 02226CE0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 02226CE4 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
         /* 02226CE8 */ cpu->r[31] = cpu->r[31] + 0x00000004u;
-        /* 02226CEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[11]);
+        /* 02226CEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[11]));
         /* 02226CF0 */ _t15 = cpu->r[27] + 0x0000002Cu;
         /* 02226CF0 */ rbrew_write32(cpu->mem, _t15, cpu->r[30]);
-        /* 02226CF4 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02226CF4 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02226CF4 */ _t17 = _t16 & 0x00000001u;
         /* 02226CF4 */ if (_t17) goto L_02226CB8; else goto L_02226CF8;
   L_02226CF8: ; // 0x2226cf8
@@ -9138,8 +9138,8 @@ void Gambit_fn_02226C7C(CPUState* cpu) {
         /* 02226D18 */ cpu->r[3] = rbrew_read32(cpu->mem, _t20);
         /* 02226D1C */ Gambit_fn_02801BB0(cpu);
         /* 02226D20 */ cpu->r[0] = rbrew_rlwinm(cpu->r[28], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02226D20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02226D24 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226D20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02226D24 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226D24 */ _t22 = _t21 & 0x00000001u;
         /* 02226D24 */ if (_t22) goto L_02226D30; else goto L_02226D28;
   L_02226D28: ; // 0x2226d28
@@ -9178,10 +9178,10 @@ void Gambit_fn_02226D44(CPUState* cpu) {
         /* 02226D6C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[5]);
         /* 02226D70 */ cpu->r[5] = 0x00000010u;
         /* 02226D74 */ Gambit_fn_02C82E00(cpu);
-        /* 02226D78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02226D78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02226D7C */ _t5 = cpu->r[30] + 0x0000001Cu;
         /* 02226D7C */ rbrew_write32(cpu->mem, _t5, cpu->r[3]);
-        /* 02226D80 */ _t6 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02226D80 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02226D80 */ _t7 = _t6 & 0x00000001u;
         /* 02226D80 */ if (_t7) goto L_02226D84; else goto L_02226DE4;
   L_02226D84: ; // 0x2226d84
@@ -9190,16 +9190,16 @@ void Gambit_fn_02226D44(CPUState* cpu) {
         /* 02226D8C */ cpu->r[5] = 0x00000004u;
         /* 02226D90 */ Gambit_fn_02801ADC(cpu);
         /* 02226D94 */ cpu->r[12] = cpu->r[3];
-        /* 02226D94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02226D98 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226D94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02226D98 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226D98 */ _t9 = _t8 & 0x00000001u;
         /* 02226D98 */ if (_t9) goto L_02226DE4; else goto L_02226D9C;
   L_02226D9C: ; // 0x2226d9c
         /* 02226D9C */ cpu->r[0] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 02226D9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02226D9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02226DA0 */ _t10 = cpu->r[30] + 0x00000014u;
         /* 02226DA0 */ rbrew_write32(cpu->mem, _t10, cpu->r[12]);
-        /* 02226DA4 */ _t11 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02226DA4 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02226DA4 */ _t12 = _t11 & 0x00000001u;
         /* 02226DA4 */ if (_t12) goto L_02226DA8; else goto L_02226DC4;
   L_02226DA8: ; // 0x2226da8
@@ -9262,10 +9262,10 @@ void Gambit_fn_02226D48(CPUState* cpu) {
         /* 02226D6C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[5]);
         /* 02226D70 */ cpu->r[5] = 0x00000010u;
         /* 02226D74 */ Gambit_fn_02C82E00(cpu);
-        /* 02226D78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02226D78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02226D7C */ _t5 = cpu->r[30] + 0x0000001Cu;
         /* 02226D7C */ rbrew_write32(cpu->mem, _t5, cpu->r[3]);
-        /* 02226D80 */ _t6 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02226D80 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02226D80 */ _t7 = _t6 & 0x00000001u;
         /* 02226D80 */ if (_t7) goto L_02226D84; else goto L_02226DE4;
   L_02226D84: ; // 0x2226d84
@@ -9274,16 +9274,16 @@ void Gambit_fn_02226D48(CPUState* cpu) {
         /* 02226D8C */ cpu->r[5] = 0x00000004u;
         /* 02226D90 */ Gambit_fn_02801ADC(cpu);
         /* 02226D94 */ cpu->r[12] = cpu->r[3];
-        /* 02226D94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02226D98 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226D94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02226D98 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226D98 */ _t9 = _t8 & 0x00000001u;
         /* 02226D98 */ if (_t9) goto L_02226DE4; else goto L_02226D9C;
   L_02226D9C: ; // 0x2226d9c
         /* 02226D9C */ cpu->r[0] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 02226D9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02226D9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02226DA0 */ _t10 = cpu->r[30] + 0x00000014u;
         /* 02226DA0 */ rbrew_write32(cpu->mem, _t10, cpu->r[12]);
-        /* 02226DA4 */ _t11 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02226DA4 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02226DA4 */ _t12 = _t11 & 0x00000001u;
         /* 02226DA4 */ if (_t12) goto L_02226DA8; else goto L_02226DC4;
   L_02226DA8: ; // 0x2226da8
@@ -9354,10 +9354,10 @@ void Gambit_fn_02226DFC(CPUState* cpu) {
         /* 02226E3C */ _t6 = cpu->r[28] + 0x00000018u;
         /* 02226E3C */ rbrew_write32(cpu->mem, _t6, cpu->r[31]);
         /* 02226E40 */ Gambit_fn_02C82E00(cpu);
-        /* 02226E44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02226E44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02226E48 */ _t7 = cpu->r[28] + 0x0000001Cu;
         /* 02226E48 */ rbrew_write32(cpu->mem, _t7, cpu->r[3]);
-        /* 02226E4C */ _t8 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02226E4C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02226E4C */ _t9 = _t8 & 0x00000001u;
         /* 02226E4C */ if (_t9) goto L_02226E50; else goto L_02226EB0;
   L_02226E50: ; // 0x2226e50
@@ -9366,16 +9366,16 @@ void Gambit_fn_02226DFC(CPUState* cpu) {
         /* 02226E58 */ cpu->r[5] = 0x00000004u;
         /* 02226E5C */ Gambit_fn_02801ADC(cpu);
         /* 02226E60 */ cpu->r[12] = cpu->r[3];
-        /* 02226E60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02226E64 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226E60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02226E64 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226E64 */ _t11 = _t10 & 0x00000001u;
         /* 02226E64 */ if (_t11) goto L_02226EB0; else goto L_02226E68;
   L_02226E68: ; // 0x2226e68
         /* 02226E68 */ cpu->r[9] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 02226E68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02226E68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02226E6C */ _t12 = cpu->r[28] + 0x0000002Cu;
         /* 02226E6C */ rbrew_write32(cpu->mem, _t12, cpu->r[12]);
-        /* 02226E70 */ _t13 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02226E70 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02226E70 */ _t14 = _t13 & 0x00000001u;
         /* 02226E70 */ if (_t14) goto L_02226E74; else goto L_02226E90;
   L_02226E74: ; // 0x2226e74
@@ -9404,8 +9404,8 @@ void Gambit_fn_02226DFC(CPUState* cpu) {
         /* 02226EA8 */ rbrew_write32(cpu->mem, _t20, cpu->r[12]);
         /* 02226EAC */ Gambit_fn_028023A8(cpu);
   L_02226EB0: ; // 0x2226eb0
-        /* 02226EB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02226EB4 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226EB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02226EB4 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226EB4 */ _t22 = _t21 & 0x00000001u;
         /* 02226EB4 */ if (_t22) goto L_02226F44; else goto L_02226EB8;
   L_02226EB8: ; // 0x2226eb8
@@ -9413,8 +9413,8 @@ void Gambit_fn_02226DFC(CPUState* cpu) {
         /* 02226EB8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t23);
         /* 02226EBC */ _t24 = cpu->r[28] + 0x00000024u;
         /* 02226EBC */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
-        /* 02226EC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], cpu->r[0]);
-        /* 02226EC4 */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02226EC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], cpu->r[0]));
+        /* 02226EC4 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02226EC4 */ _t26 = _t25 & 0x00000001u;
         /* 02226EC4 */ if (_t26) goto L_02226EE0; else goto L_02226EC8;
   L_02226EC8: ; // 0x2226ec8
@@ -9422,8 +9422,8 @@ void Gambit_fn_02226DFC(CPUState* cpu) {
         /* 02226ECC */ cpu->r[3] = cpu->r[4];
         /* 02226ED0 */ Gambit_fn_023C0574(cpu);
         /* 02226ED4 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 02226ED4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02226ED8 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226ED4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02226ED8 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226ED8 */ _t28 = _t27 & 0x00000001u;
         /* 02226ED8 */ if (_t28) goto L_02226EDC; else goto L_02226EB8;
   L_02226EDC: ; // 0x2226edc
@@ -9431,8 +9431,8 @@ void Gambit_fn_02226DFC(CPUState* cpu) {
   L_02226EE0: ; // 0x2226ee0
         /* 02226EE0 */ _t29 = cpu->r[28] + 0x0000002Cu;
         /* 02226EE0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t29);
-        /* 02226EE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02226EE8 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226EE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02226EE8 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226EE8 */ _t31 = _t30 & 0x00000001u;
         /* 02226EE8 */ if (_t31) goto L_02226EF4; else goto L_02226EEC;
   L_02226EEC: ; // 0x2226eec
@@ -9441,8 +9441,8 @@ void Gambit_fn_02226DFC(CPUState* cpu) {
         /* 02226EF0 */ _t33 = cpu->r[28] + 0x0000002Cu;
         /* 02226EF0 */ rbrew_write32(cpu->mem, _t33, cpu->r[0]);
   L_02226EF4: ; // 0x2226ef4
-        /* 02226EF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02226EF8 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226EF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02226EF8 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226EF8 */ _t35 = _t34 & 0x00000001u;
         /* 02226EF8 */ if (_t35) goto L_02226F08; else goto L_02226EFC;
   L_02226EFC: ; // 0x2226efc
@@ -9454,8 +9454,8 @@ void Gambit_fn_02226DFC(CPUState* cpu) {
         /* 02226F08 */ cpu->r[6] = rbrew_read32(cpu->mem, _t36);
         /* 02226F0C */ _t37 = cpu->r[28] + 0x00000024u;
         /* 02226F0C */ cpu->r[5] = rbrew_read32(cpu->mem, _t37);
-        /* 02226F10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], cpu->r[5]);
-        /* 02226F14 */ _t38 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02226F10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], cpu->r[5]));
+        /* 02226F14 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02226F14 */ _t39 = _t38 & 0x00000001u;
         /* 02226F14 */ if (_t39) goto L_02226F18; else goto L_02226F30;
   L_02226F18: ; // 0x2226f18
@@ -9474,8 +9474,8 @@ void Gambit_fn_02226DFC(CPUState* cpu) {
         /* 02226F34 */ cpu->r[4] = 0x00000000u;
         /* 02226F38 */ Gambit_fn_023C0574(cpu);
         /* 02226F3C */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 02226F3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02226F40 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226F3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02226F40 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226F40 */ _t45 = _t44 & 0x00000001u;
         /* 02226F40 */ if (_t45) goto L_02226F44; else goto L_02226EB8;
   L_02226F44: ; // 0x2226f44
@@ -9505,8 +9505,8 @@ void Gambit_fn_02226DFC(CPUState* cpu) {
         /* 02226F8C */ cpu->r[12] = rbrew_read32(cpu->mem, _t50);
         /* 02226F90 */ _t51 = cpu->r[12] + 0x0000015Cu;
         /* 02226F90 */ cpu->r[0] = rbrew_read32(cpu->mem, _t51);
-        /* 02226F94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02226F98 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226F94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02226F98 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226F98 */ _t53 = _t52 & 0x00000001u;
         /* 02226F98 */ if (_t53) goto L_02226FA8; else goto L_02226F9C;
   L_02226F9C: ; // 0x2226f9c
@@ -9559,10 +9559,10 @@ void Gambit_fn_02226E00(CPUState* cpu) {
         /* 02226E3C */ _t6 = cpu->r[28] + 0x00000018u;
         /* 02226E3C */ rbrew_write32(cpu->mem, _t6, cpu->r[31]);
         /* 02226E40 */ Gambit_fn_02C82E00(cpu);
-        /* 02226E44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02226E44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02226E48 */ _t7 = cpu->r[28] + 0x0000001Cu;
         /* 02226E48 */ rbrew_write32(cpu->mem, _t7, cpu->r[3]);
-        /* 02226E4C */ _t8 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02226E4C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02226E4C */ _t9 = _t8 & 0x00000001u;
         /* 02226E4C */ if (_t9) goto L_02226E50; else goto L_02226EB0;
   L_02226E50: ; // 0x2226e50
@@ -9571,16 +9571,16 @@ void Gambit_fn_02226E00(CPUState* cpu) {
         /* 02226E58 */ cpu->r[5] = 0x00000004u;
         /* 02226E5C */ Gambit_fn_02801ADC(cpu);
         /* 02226E60 */ cpu->r[12] = cpu->r[3];
-        /* 02226E60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02226E64 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226E60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02226E64 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226E64 */ _t11 = _t10 & 0x00000001u;
         /* 02226E64 */ if (_t11) goto L_02226EB0; else goto L_02226E68;
   L_02226E68: ; // 0x2226e68
         /* 02226E68 */ cpu->r[9] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 02226E68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02226E68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02226E6C */ _t12 = cpu->r[28] + 0x0000002Cu;
         /* 02226E6C */ rbrew_write32(cpu->mem, _t12, cpu->r[12]);
-        /* 02226E70 */ _t13 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02226E70 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02226E70 */ _t14 = _t13 & 0x00000001u;
         /* 02226E70 */ if (_t14) goto L_02226E74; else goto L_02226E90;
   L_02226E74: ; // 0x2226e74
@@ -9609,8 +9609,8 @@ void Gambit_fn_02226E00(CPUState* cpu) {
         /* 02226EA8 */ rbrew_write32(cpu->mem, _t20, cpu->r[12]);
         /* 02226EAC */ Gambit_fn_028023A8(cpu);
   L_02226EB0: ; // 0x2226eb0
-        /* 02226EB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02226EB4 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226EB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02226EB4 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226EB4 */ _t22 = _t21 & 0x00000001u;
         /* 02226EB4 */ if (_t22) goto L_02226F44; else goto L_02226EB8;
   L_02226EB8: ; // 0x2226eb8
@@ -9618,8 +9618,8 @@ void Gambit_fn_02226E00(CPUState* cpu) {
         /* 02226EB8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t23);
         /* 02226EBC */ _t24 = cpu->r[28] + 0x00000024u;
         /* 02226EBC */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
-        /* 02226EC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], cpu->r[0]);
-        /* 02226EC4 */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02226EC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], cpu->r[0]));
+        /* 02226EC4 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02226EC4 */ _t26 = _t25 & 0x00000001u;
         /* 02226EC4 */ if (_t26) goto L_02226EE0; else goto L_02226EC8;
   L_02226EC8: ; // 0x2226ec8
@@ -9627,8 +9627,8 @@ void Gambit_fn_02226E00(CPUState* cpu) {
         /* 02226ECC */ cpu->r[3] = cpu->r[4];
         /* 02226ED0 */ Gambit_fn_023C0574(cpu);
         /* 02226ED4 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 02226ED4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02226ED8 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226ED4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02226ED8 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226ED8 */ _t28 = _t27 & 0x00000001u;
         /* 02226ED8 */ if (_t28) goto L_02226EDC; else goto L_02226EB8;
   L_02226EDC: ; // 0x2226edc
@@ -9636,8 +9636,8 @@ void Gambit_fn_02226E00(CPUState* cpu) {
   L_02226EE0: ; // 0x2226ee0
         /* 02226EE0 */ _t29 = cpu->r[28] + 0x0000002Cu;
         /* 02226EE0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t29);
-        /* 02226EE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02226EE8 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226EE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02226EE8 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226EE8 */ _t31 = _t30 & 0x00000001u;
         /* 02226EE8 */ if (_t31) goto L_02226EF4; else goto L_02226EEC;
   L_02226EEC: ; // 0x2226eec
@@ -9646,8 +9646,8 @@ void Gambit_fn_02226E00(CPUState* cpu) {
         /* 02226EF0 */ _t33 = cpu->r[28] + 0x0000002Cu;
         /* 02226EF0 */ rbrew_write32(cpu->mem, _t33, cpu->r[0]);
   L_02226EF4: ; // 0x2226ef4
-        /* 02226EF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02226EF8 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226EF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02226EF8 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226EF8 */ _t35 = _t34 & 0x00000001u;
         /* 02226EF8 */ if (_t35) goto L_02226F08; else goto L_02226EFC;
   L_02226EFC: ; // 0x2226efc
@@ -9659,8 +9659,8 @@ void Gambit_fn_02226E00(CPUState* cpu) {
         /* 02226F08 */ cpu->r[6] = rbrew_read32(cpu->mem, _t36);
         /* 02226F0C */ _t37 = cpu->r[28] + 0x00000024u;
         /* 02226F0C */ cpu->r[5] = rbrew_read32(cpu->mem, _t37);
-        /* 02226F10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], cpu->r[5]);
-        /* 02226F14 */ _t38 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02226F10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], cpu->r[5]));
+        /* 02226F14 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02226F14 */ _t39 = _t38 & 0x00000001u;
         /* 02226F14 */ if (_t39) goto L_02226F18; else goto L_02226F30;
   L_02226F18: ; // 0x2226f18
@@ -9679,8 +9679,8 @@ void Gambit_fn_02226E00(CPUState* cpu) {
         /* 02226F34 */ cpu->r[4] = 0x00000000u;
         /* 02226F38 */ Gambit_fn_023C0574(cpu);
         /* 02226F3C */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 02226F3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02226F40 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226F3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02226F40 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226F40 */ _t45 = _t44 & 0x00000001u;
         /* 02226F40 */ if (_t45) goto L_02226F44; else goto L_02226EB8;
   L_02226F44: ; // 0x2226f44
@@ -9710,8 +9710,8 @@ void Gambit_fn_02226E00(CPUState* cpu) {
         /* 02226F8C */ cpu->r[12] = rbrew_read32(cpu->mem, _t50);
         /* 02226F90 */ _t51 = cpu->r[12] + 0x0000015Cu;
         /* 02226F90 */ cpu->r[0] = rbrew_read32(cpu->mem, _t51);
-        /* 02226F94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02226F98 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02226F94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02226F98 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02226F98 */ _t53 = _t52 & 0x00000001u;
         /* 02226F98 */ if (_t53) goto L_02226FA8; else goto L_02226F9C;
   L_02226F9C: ; // 0x2226f9c
@@ -9763,9 +9763,9 @@ void Gambit_fn_02226FC8(CPUState* cpu) {
         /* 02226FF8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t7);
         /* 02226FFC */ _t8 = cpu->r[5] + 0x00000008u;
         /* 02226FFC */ cpu->r[26] = rbrew_read32(cpu->mem, _t8);
-        /* 02227000 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
+        /* 02227000 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
         /* 02227004 */ cpu->r[30] = cpu->r[3];
-        /* 02227008 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227008 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227008 */ _t10 = _t9 & 0x00000001u;
         /* 02227008 */ if (_t10) goto L_0222733C; else goto L_0222700C;
   L_0222700C: ; // 0x222700c
@@ -9773,10 +9773,10 @@ void Gambit_fn_02226FC8(CPUState* cpu) {
         /* 02227010 */ Gambit_fn_02980F6C(cpu);
         /* 02227014 */ cpu->r[28] = 0x00000000u;
         /* 02227018 */ cpu->r[25] = cpu->r[3];
-        /* 02227018 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 02227018 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 0222701C */ _t11 = cpu->r[30] + 0x00000000u;
         /* 0222701C */ rbrew_write8(cpu->mem, _t11, (uint8_t)cpu->r[28]);
-        /* 02227020 */ _t12 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02227020 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02227020 */ _t13 = _t12 & 0x00000001u;
         /* 02227020 */ if (_t13) goto L_02227024; else goto L_0222733C;
   L_02227024: ; // 0x2227024
@@ -9792,7 +9792,7 @@ void Gambit_fn_02226FC8(CPUState* cpu) {
         /* 0222703C */ cpu->r[4] = cpu->r[29] + 0xFFFFE9A4u;
         /* 02227040 */ cpu->r[3] = cpu->r[1] + 0x000000B0u;
         /* 02227044 */ cpu->r[5] = cpu->r[28];
-        /* 02227048 */ _t16 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02227048 */ _t16 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02227048 */ _t17 = _t16 & 0x00000001u;
         /* 02227048 */ if (_t17) goto L_0222704C; // else: addr-0 trap, fall-through
   L_0222704C: ; // 0x222704c
@@ -9802,14 +9802,14 @@ void Gambit_fn_02226FC8(CPUState* cpu) {
         /* 02227058 */ Gambit_fn_029807A8(cpu);
         /* 0222705C */ cpu->r[24] = cpu->r[3];
         /* 02227060 */ /* nop */
-        /* 02227064 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0xFFFFFFFFu);
-        /* 02227068 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227064 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0xFFFFFFFFu));
+        /* 02227068 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227068 */ _t19 = _t18 & 0x00000001u;
         /* 02227068 */ if (_t19) goto L_02227330; else goto L_0222706C;
   L_0222706C: ; // 0x222706c
         /* 0222706C */ /* nop */
-        /* 02227070 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 02227074 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227070 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 02227074 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227074 */ _t21 = _t20 & 0x00000001u;
         /* 02227074 */ if (_t21) goto L_02227330; else goto L_02227078;
   L_02227078: ; // 0x2227078
@@ -9817,8 +9817,8 @@ void Gambit_fn_02226FC8(CPUState* cpu) {
         /* 02227078 */ cpu->r[11] = rbrew_read8(cpu->mem, _t22);
         /* 0222707C */ _t23 = cpu->r[30] + 0x00000001u;
         /* 0222707C */ cpu->r[0] = rbrew_read8(cpu->mem, _t23);
-        /* 02227080 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[0]);
-        /* 02227084 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02227080 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[0]));
+        /* 02227084 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02227084 */ _t25 = _t24 & 0x00000001u;
         /* 02227084 */ if (_t25) goto L_02227088; else goto L_02227330;
   L_02227088: ; // 0x2227088
@@ -9828,9 +9828,9 @@ void Gambit_fn_02226FC8(CPUState* cpu) {
         /* 02227094 */ Gambit_fn_0297FC7C(cpu);
         /* 02227098 */ _t26 = cpu->r[26] + 0x0000001Cu;
         /* 02227098 */ cpu->r[4] = rbrew_read32(cpu->mem, _t26);
-        /* 0222709C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[4]);
+        /* 0222709C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[4]));
         /* 022270A0 */ cpu->r[12] = 0x00000000u;
-        /* 022270A4 */ _t27 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022270A4 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022270A4 */ _t28 = _t27 & 0x00000001u;
         /* 022270A4 */ if (_t28) goto L_022270A8; else goto L_022270B4;
   L_022270A8: ; // 0x22270a8
@@ -9896,8 +9896,8 @@ void Gambit_fn_02226FC8(CPUState* cpu) {
         /* 02227134 */ cpu->r[5] = rbrew_read32(cpu->mem, _t51);
         /* 02227138 */ _t52 = cpu->r[30] + 0x0000000Cu;
         /* 02227138 */ cpu->r[6] = rbrew_read32(cpu->mem, _t52);
-        /* 0222713C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], cpu->r[6]);
-        /* 02227140 */ _t53 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222713C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], cpu->r[6]));
+        /* 02227140 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02227140 */ _t54 = _t53 & 0x00000001u;
         /* 02227140 */ if (_t54) goto L_02227214; else goto L_02227144;
   L_02227144: ; // 0x2227144
@@ -9991,8 +9991,8 @@ void Gambit_fn_02226FC8(CPUState* cpu) {
   L_02227214: ; // 0x2227214
         /* 02227214 */ _t90 = cpu->r[30] + 0x00000014u;
         /* 02227214 */ cpu->r[31] = rbrew_read32(cpu->mem, _t90);
-        /* 02227218 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0222721C */ _t91 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227218 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0222721C */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222721C */ _t92 = _t91 & 0x00000001u;
         /* 0222721C */ if (_t92) goto L_02227228; else goto L_02227220;
   L_02227220: ; // 0x2227220
@@ -10001,9 +10001,9 @@ void Gambit_fn_02226FC8(CPUState* cpu) {
         /* 02227224 */ _t94 = cpu->r[30] + 0x00000014u;
         /* 02227224 */ rbrew_write32(cpu->mem, _t94, cpu->r[7]);
   L_02227228: ; // 0x2227228
-        /* 02227228 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02227228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0222722C */ cpu->r[3] = cpu->r[31];
-        /* 02227230 */ _t95 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227230 */ _t95 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227230 */ _t96 = _t95 & 0x00000001u;
         /* 02227230 */ if (_t96) goto L_0222723C; else goto L_02227234;
   L_02227234: ; // 0x2227234
@@ -10014,8 +10014,8 @@ void Gambit_fn_02226FC8(CPUState* cpu) {
         /* 0222723C */ cpu->r[7] = rbrew_read32(cpu->mem, _t97);
         /* 02227240 */ _t98 = cpu->r[30] + 0x0000000Cu;
         /* 02227240 */ cpu->r[8] = rbrew_read32(cpu->mem, _t98);
-        /* 02227244 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], cpu->r[8]);
-        /* 02227248 */ _t99 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02227244 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], cpu->r[8]));
+        /* 02227248 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02227248 */ _t100 = _t99 & 0x00000001u;
         /* 02227248 */ if (_t100) goto L_0222724C; else goto L_02227264;
   L_0222724C: ; // 0x222724c
@@ -10118,9 +10118,9 @@ void Gambit_fn_02226FC8(CPUState* cpu) {
         /* 0222732C */ rbrew_write8(cpu->mem, _t139, (uint8_t)cpu->r[5]);
   L_02227330: ; // 0x2227330
         /* 02227330 */ cpu->r[25] = cpu->r[25] + 0xFFFFFFFFu;
-        /* 02227330 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 02227330 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 02227334 */ cpu->r[28] = cpu->r[28] + 0x00000001u;
-        /* 02227338 */ _t140 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227338 */ _t140 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227338 */ _t141 = _t140 & 0x00000001u;
         /* 02227338 */ if (_t141) goto L_0222733C; else goto L_0222703C;
   L_0222733C: ; // 0x222733c
@@ -10133,7 +10133,7 @@ void Gambit_fn_02226FC8(CPUState* cpu) {
         /* 02227348 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t144);
         /* 0222734C */ _t145 = cpu->r[1] + 0x000001F0u;
         /* 0222734C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t145);
-        /* 02227350 */ _t146 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02227350 */ _t146 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02227350 */ _t147 = _t146 & 0x00000001u;
         /* 02227350 */ if (_t147) goto L_02227354; // else: addr-0 trap, fall-through
   L_02227354: ; // 0x2227354
@@ -10175,8 +10175,8 @@ void Gambit_fn_02227364(CPUState* cpu) {
         /* 02227394 */ cpu->r[11] = rbrew_read32(cpu->mem, _t9);
         /* 02227398 */ _t10 = cpu->r[11] + 0x0000015Cu;
         /* 02227398 */ cpu->r[11] = rbrew_read32(cpu->mem, _t10);
-        /* 0222739C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 022273A0 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222739C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 022273A0 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022273A0 */ _t12 = _t11 & 0x00000001u;
         /* 022273A0 */ if (_t12) goto L_022273FC; else goto L_022273A4;
   L_022273A4: ; // 0x22273a4
@@ -10188,8 +10188,8 @@ void Gambit_fn_02227364(CPUState* cpu) {
         /* 022273AC */ cpu->r[0] = rbrew_read32(cpu->mem, _t15);
         /* 022273B0 */ cpu->r[31] = cpu->r[10] - cpu->r[30];
         /* 022273B4 */ cpu->r[29] = cpu->r[0] - cpu->r[30];
-        /* 022273B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[31]);
-        /* 022273BC */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022273B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[31]));
+        /* 022273BC */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022273BC */ _t17 = _t16 & 0x00000001u;
         /* 022273BC */ if (_t17) goto L_022273FC; else goto L_022273C0;
   L_022273C0: ; // 0x22273c0
@@ -10209,8 +10209,8 @@ void Gambit_fn_02227364(CPUState* cpu) {
         /* 022273EC */ _t19 = cpu->r[9] + 0x00000004u;
         /* 022273EC */ cpu->r[0] = rbrew_read32(cpu->mem, _t19);
         /* 022273F0 */ cpu->r[29] = cpu->r[0] - cpu->r[30];
-        /* 022273F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[31]);
-        /* 022273F8 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022273F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[31]));
+        /* 022273F8 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022273F8 */ _t21 = _t20 & 0x00000001u;
         /* 022273F8 */ if (_t21) goto L_022273FC; else goto L_022273C4;
   L_022273FC: ; // 0x22273fc
@@ -10259,8 +10259,8 @@ void Gambit_fn_02227368(CPUState* cpu) {
         /* 02227394 */ cpu->r[11] = rbrew_read32(cpu->mem, _t9);
         /* 02227398 */ _t10 = cpu->r[11] + 0x0000015Cu;
         /* 02227398 */ cpu->r[11] = rbrew_read32(cpu->mem, _t10);
-        /* 0222739C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 022273A0 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222739C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 022273A0 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022273A0 */ _t12 = _t11 & 0x00000001u;
         /* 022273A0 */ if (_t12) goto L_022273FC; else goto L_022273A4;
   L_022273A4: ; // 0x22273a4
@@ -10272,8 +10272,8 @@ void Gambit_fn_02227368(CPUState* cpu) {
         /* 022273AC */ cpu->r[0] = rbrew_read32(cpu->mem, _t15);
         /* 022273B0 */ cpu->r[31] = cpu->r[10] - cpu->r[30];
         /* 022273B4 */ cpu->r[29] = cpu->r[0] - cpu->r[30];
-        /* 022273B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[31]);
-        /* 022273BC */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022273B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[31]));
+        /* 022273BC */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022273BC */ _t17 = _t16 & 0x00000001u;
         /* 022273BC */ if (_t17) goto L_022273FC; else goto L_022273C0;
   L_022273C0: ; // 0x22273c0
@@ -10293,8 +10293,8 @@ void Gambit_fn_02227368(CPUState* cpu) {
         /* 022273EC */ _t19 = cpu->r[9] + 0x00000004u;
         /* 022273EC */ cpu->r[0] = rbrew_read32(cpu->mem, _t19);
         /* 022273F0 */ cpu->r[29] = cpu->r[0] - cpu->r[30];
-        /* 022273F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[31]);
-        /* 022273F8 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022273F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[31]));
+        /* 022273F8 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022273F8 */ _t21 = _t20 & 0x00000001u;
         /* 022273F8 */ if (_t21) goto L_022273FC; else goto L_022273C4;
   L_022273FC: ; // 0x22273fc
@@ -10332,9 +10332,9 @@ void Gambit_fn_0222741C(CPUState* cpu) {
         /* 02227438 */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
         /* 0222743C */ cpu->r[28] = cpu->r[5];
         /* 02227440 */ cpu->r[30] = cpu->r[7];
-        /* 02227444 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[11]);
+        /* 02227444 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[11]));
         /* 02227448 */ cpu->r[3] = 0x00000000u;
-        /* 0222744C */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222744C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222744C */ _t4 = _t3 & 0x00000001u;
         /* 0222744C */ if (_t4) goto L_02227450; else goto L_0222745C;
   L_02227450: ; // 0x2227450
@@ -10347,9 +10347,9 @@ void Gambit_fn_0222741C(CPUState* cpu) {
         /* 0222745C */ Gambit_fn_023E4504(cpu);
         /* 02227460 */ _t7 = cpu->r[27] + 0x00000008u;
         /* 02227460 */ cpu->r[11] = rbrew_read32(cpu->mem, _t7);
-        /* 02227464 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[11]);
+        /* 02227464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[11]));
         /* 02227468 */ cpu->r[3] = 0x00000000u;
-        /* 0222746C */ _t8 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222746C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222746C */ _t9 = _t8 & 0x00000001u;
         /* 0222746C */ if (_t9) goto L_02227470; else goto L_0222747C;
   L_02227470: ; // 0x2227470
@@ -10403,10 +10403,10 @@ void Gambit_fn_022274A0(CPUState* cpu) {
         /* 022274E0 */ cpu->r[9] = (uint32_t)((int32_t)cpu->r[9] * (int32_t)0x00000078u);
         /* 022274E4 */ cpu->r[6] = cpu->r[7] + 0x00000001u;
         /* 022274E8 */ cpu->r[8] = cpu->r[7] - cpu->r[9];
-        /* 022274E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 022274E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 022274EC */ _t7 = cpu->r[31] + 0x00000004u;
         /* 022274EC */ rbrew_write32(cpu->mem, _t7, cpu->r[6]);
-        /* 022274F0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022274F0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022274F0 */ _t9 = _t8 & 0x00000001u;
         /* 022274F0 */ if (_t9) goto L_022274F4; else goto L_0222766C;
   L_022274F4: ; // 0x22274f4
@@ -10416,10 +10416,10 @@ void Gambit_fn_022274A0(CPUState* cpu) {
         /* 022274FC */ _t11 = cpu->r[12] + 0x00006000u;
         /* 022274FC */ cpu->r[12] = rbrew_read32(cpu->mem, _t11);
         /* 02227500 */ cpu->r[23] = 0x00000000u;
-        /* 02227504 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], cpu->r[0]);
+        /* 02227504 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], cpu->r[0]));
         /* 02227508 */ _t12 = cpu->r[12] + 0x00000274u;
         /* 02227508 */ cpu->r[22] = rbrew_read32(cpu->mem, _t12);
-        /* 0222750C */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222750C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222750C */ _t14 = _t13 & 0x00000001u;
         /* 0222750C */ if (_t14) goto L_02227510; else goto L_0222766C;
   L_02227510: ; // 0x2227510
@@ -10442,8 +10442,8 @@ void Gambit_fn_022274A0(CPUState* cpu) {
         /* 02227540 */ cpu->r[11] = cpu->r[12] + cpu->r[24];
         /* 02227544 */ _t18 = cpu->r[11] + 0x0000000Cu;
         /* 02227544 */ cpu->r[10] = rbrew_read8(cpu->mem, _t18);
-        /* 02227548 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0222754C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227548 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0222754C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222754C */ _t20 = _t19 & 0x00000001u;
         /* 0222754C */ if (_t20) goto L_02227550; else goto L_0222765C;
   L_02227550: ; // 0x2227550
@@ -10466,8 +10466,8 @@ void Gambit_fn_022274A0(CPUState* cpu) {
         /* 0222757C */ _t26 = cpu->r[1] + 0x00000044u;
         /* 0222757C */ rbrew_write32(cpu->mem, _t26, cpu->r[0]);
         /* 02227580 */ Gambit_fn_0222741C(cpu);
-        /* 02227584 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02227588 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02227588 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227588 */ _t28 = _t27 & 0x00000001u;
         /* 02227588 */ if (_t28) goto L_02227658; else goto L_0222758C;
   L_0222758C: ; // 0x222758c
@@ -10476,16 +10476,16 @@ void Gambit_fn_022274A0(CPUState* cpu) {
         /* 02227590 */ _t30 = cpu->r[1] + 0x0000002Cu;
         /* 02227590 */ cpu->r[0] = rbrew_read32(cpu->mem, _t30);
         /* 02227594 */ cpu->r[8] = cpu->r[11] + cpu->r[0];
-        /* 02227598 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000005u);
-        /* 0222759C */ _t31 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02227598 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000005u));
+        /* 0222759C */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222759C */ _t32 = _t31 & 0x00000001u;
         /* 0222759C */ if (_t32) goto L_022275A0; else goto L_02227658;
   L_022275A0: ; // 0x22275a0
         /* 022275A0 */ _t33 = cpu->r[1] + 0x00000030u;
         /* 022275A0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t33);
         /* 022275A4 */ cpu->r[10] = rbrew_rlwinm(cpu->r[12], 0x00000001u, 0x00000000u, 0x0000001Eu);
-        /* 022275A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[10]);
-        /* 022275AC */ _t34 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022275A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[10]));
+        /* 022275AC */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022275AC */ _t35 = _t34 & 0x00000001u;
         /* 022275AC */ if (_t35) goto L_022275B0; else goto L_02227658;
   L_022275B0: ; // 0x22275b0
@@ -10511,8 +10511,8 @@ void Gambit_fn_022274A0(CPUState* cpu) {
         /* 022275E0 */ rbrew_write_f32(cpu->mem, _t42, cpu->f[31]);
         /* 022275E4 */ _t43 = cpu->r[9] + 0x00000104u;
         /* 022275E4 */ cpu->r[4] = rbrew_read8(cpu->mem, _t43);
-        /* 022275E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
-        /* 022275EC */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022275E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
+        /* 022275EC */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022275EC */ _t45 = _t44 & 0x00000001u;
         /* 022275EC */ if (_t45) goto L_02227658; else goto L_022275F0;
   L_022275F0: ; // 0x22275f0
@@ -10522,8 +10522,8 @@ void Gambit_fn_022274A0(CPUState* cpu) {
         /* 022275FC */ cpu->r[3] = cpu->r[22];
         /* 02227600 */ Gambit_fn_021F000C(cpu);
         /* 02227604 */ cpu->r[21] = cpu->r[3];
-        /* 02227604 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 02227608 */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 02227608 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227608 */ _t47 = _t46 & 0x00000001u;
         /* 02227608 */ if (_t47) goto L_02227658; else goto L_0222760C;
   L_0222760C: ; // 0x222760c
@@ -10561,9 +10561,9 @@ void Gambit_fn_022274A0(CPUState* cpu) {
         /* 02227658 */ cpu->r[0] = rbrew_read8(cpu->mem, _t58);
   L_0222765C: ; // 0x222765c
         /* 0222765C */ cpu->r[23] = cpu->r[23] + 0x00000001u;
-        /* 02227660 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], cpu->r[0]);
+        /* 02227660 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], cpu->r[0]));
         /* 02227664 */ cpu->r[24] = cpu->r[24] + 0x00000010u;
-        /* 02227668 */ _t59 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02227668 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02227668 */ _t60 = _t59 & 0x00000001u;
         /* 02227668 */ if (_t60) goto L_0222753C; else goto L_0222766C;
   L_0222766C: ; // 0x222766c
@@ -10576,7 +10576,7 @@ void Gambit_fn_022274A0(CPUState* cpu) {
         /* 02227678 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t63);
         /* 0222767C */ _t64 = cpu->r[1] + 0x00000088u;
         /* 0222767C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t64);
-        /* 02227680 */ _t65 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02227680 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02227680 */ _t66 = _t65 & 0x00000001u;
         /* 02227680 */ if (_t66) goto L_02227684; // else: addr-0 trap, fall-through
   L_02227684: ; // 0x2227684
@@ -10619,10 +10619,10 @@ void Gambit_fn_02227694(CPUState* cpu) {
         /* 022276D0 */ cpu->r[31] = 0x00000000u;
         /* 022276D4 */ _t8 = cpu->r[12] + 0x00006000u;
         /* 022276D4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t8);
-        /* 022276D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[5]);
+        /* 022276D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[5]));
         /* 022276DC */ _t9 = cpu->r[12] + 0x00000274u;
         /* 022276DC */ cpu->r[26] = rbrew_read32(cpu->mem, _t9);
-        /* 022276E0 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022276E0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022276E0 */ _t11 = _t10 & 0x00000001u;
         /* 022276E0 */ if (_t11) goto L_022276E4; else goto L_02227910;
   L_022276E4: ; // 0x22276e4
@@ -10642,8 +10642,8 @@ void Gambit_fn_02227694(CPUState* cpu) {
         /* 02227708 */ cpu->r[6] = cpu->r[3];
         /* 0222770C */ _t15 = cpu->r[6] + 0x0000000Cu;
         /* 0222770C */ cpu->r[8] = rbrew_read32(cpu->mem, _t15);
-        /* 02227710 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02227714 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02227710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02227714 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02227714 */ _t17 = _t16 & 0x00000001u;
         /* 02227714 */ if (_t17) goto L_02227728; else goto L_02227718;
   L_02227718: ; // 0x2227718
@@ -10656,8 +10656,8 @@ void Gambit_fn_02227694(CPUState* cpu) {
   L_02227728: ; // 0x2227728
         /* 02227728 */ _t20 = cpu->r[3] + 0x0000000Cu;
         /* 02227728 */ cpu->r[9] = rbrew_read32(cpu->mem, _t20);
-        /* 0222772C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02227730 */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222772C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02227730 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02227730 */ _t22 = _t21 & 0x00000001u;
         /* 02227730 */ if (_t22) goto L_022278FC; else goto L_02227734;
   L_02227734: ; // 0x2227734
@@ -10669,16 +10669,16 @@ void Gambit_fn_02227694(CPUState* cpu) {
         /* 02227744 */ cpu->r[12] = rbrew_rlwinm(cpu->r[12], 0x0000001Au, 0x00000006u, 0x0000001Fu);
         /* 02227748 */ cpu->r[12] = (uint32_t)((int32_t)cpu->r[12] * (int32_t)0x00000078u);
         /* 0222774C */ cpu->r[10] = cpu->r[11] - cpu->r[12];
-        /* 0222774C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02227750 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222774C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02227750 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227750 */ _t25 = _t24 & 0x00000001u;
         /* 02227750 */ if (_t25) goto L_02227754; else goto L_022278FC;
   L_02227754: ; // 0x2227754
         /* 02227754 */ _t26 = cpu->r[30] + 0x00000020u;
         /* 02227754 */ cpu->r[4] = rbrew_read32(cpu->mem, _t26);
-        /* 02227758 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[4]);
+        /* 02227758 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[4]));
         /* 0222775C */ cpu->r[25] = 0x00000000u;
-        /* 02227760 */ _t27 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02227760 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02227760 */ _t28 = _t27 & 0x00000001u;
         /* 02227760 */ if (_t28) goto L_02227764; else goto L_02227770;
   L_02227764: ; // 0x2227764
@@ -10785,8 +10785,8 @@ void Gambit_fn_02227694(CPUState* cpu) {
         /* 0222784C */ cpu->r[5] = cpu->r[1] + 0x00000024u;
         /* 02227850 */ cpu->r[6] = cpu->r[1] + 0x00000070u;
         /* 02227854 */ Gambit_fn_023C05C8(cpu);
-        /* 02227858 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222785C */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227858 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222785C */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222785C */ _t71 = _t70 & 0x00000001u;
         /* 0222785C */ if (_t71) goto L_022278FC; else goto L_02227860;
   L_02227860: ; // 0x2227860
@@ -10799,19 +10799,19 @@ void Gambit_fn_02227694(CPUState* cpu) {
         /* 0222786C */ cpu->r[10] = rbrew_read32(cpu->mem, _t74);
         /* 02227870 */ _t75 = cpu->r[3] + 0x00000010u;
         /* 02227870 */ cpu->r[6] = rbrew_read32(cpu->mem, _t75);
-        /* 02227874 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[10]);
+        /* 02227874 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[10]));
         /* 02227878 */ _t76 = cpu->r[3] + 0x00000014u;
         /* 02227878 */ cpu->r[8] = rbrew_read32(cpu->mem, _t76);
-        /* 0222787C */ _t77 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222787C */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222787C */ _t78 = _t77 & 0x00000001u;
         /* 0222787C */ if (_t78) goto L_022278D0; else goto L_02227880;
   L_02227880: ; // 0x2227880
-        /* 02227880 */ _t79 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02227880 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02227880 */ _t80 = _t79 & 0x00000001u;
         /* 02227880 */ if (_t80) goto L_02227884; else goto L_022278FC;
   L_02227884: ; // 0x2227884
-        /* 02227884 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000001u);
-        /* 02227888 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227884 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000001u));
+        /* 02227888 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227888 */ _t82 = _t81 & 0x00000001u;
         /* 02227888 */ if (_t82) goto L_0222788C; else goto L_022278C8;
   L_0222788C: ; // 0x222788c
@@ -10834,21 +10834,21 @@ void Gambit_fn_02227694(CPUState* cpu) {
         /* 022278B0 */ _t90 = cpu->r[30] + 0x00000018u;
         /* 022278B0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t90);
         /* 022278B4 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 022278B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[8]);
+        /* 022278B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[8]));
         /* 022278BC */ cpu->r[27] = cpu->r[27] + 0x00000018u;
-        /* 022278C0 */ _t91 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022278C0 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022278C0 */ _t92 = _t91 & 0x00000001u;
         /* 022278C0 */ if (_t92) goto L_02227700; else goto L_022278C4;
   L_022278C4: ; // 0x22278c4
         /* 022278C4 */ goto L_02227910;
   L_022278C8: ; // 0x22278c8
-        /* 022278C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[10]);
-        /* 022278CC */ _t93 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022278C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[10]));
+        /* 022278CC */ _t93 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022278CC */ _t94 = _t93 & 0x00000001u;
         /* 022278CC */ if (_t94) goto L_022278D0; else goto L_022278FC;
   L_022278D0: ; // 0x22278d0
-        /* 022278D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 022278D4 */ _t95 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022278D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 022278D4 */ _t95 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022278D4 */ _t96 = _t95 & 0x00000001u;
         /* 022278D4 */ if (_t96) goto L_022278D8; else goto L_022278FC;
   L_022278D8: ; // 0x22278d8
@@ -10872,9 +10872,9 @@ void Gambit_fn_02227694(CPUState* cpu) {
         /* 022278FC */ _t104 = cpu->r[30] + 0x00000018u;
         /* 022278FC */ cpu->r[8] = rbrew_read32(cpu->mem, _t104);
         /* 02227900 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02227904 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[8]);
+        /* 02227904 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[8]));
         /* 02227908 */ cpu->r[27] = cpu->r[27] + 0x00000018u;
-        /* 0222790C */ _t105 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222790C */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222790C */ _t106 = _t105 & 0x00000001u;
         /* 0222790C */ if (_t106) goto L_02227700; else goto L_02227910;
   L_02227910: ; // 0x2227910
@@ -10887,7 +10887,7 @@ void Gambit_fn_02227694(CPUState* cpu) {
         /* 0222791C */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t109);
         /* 02227920 */ _t110 = cpu->r[1] + 0x000000B0u;
         /* 02227920 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t110);
-        /* 02227924 */ _t111 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02227924 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02227924 */ _t112 = _t111 & 0x00000001u;
         /* 02227924 */ if (_t112) goto L_02227928; // else: addr-0 trap, fall-through
   L_02227928: ; // 0x2227928
@@ -10926,9 +10926,9 @@ void Gambit_fn_02227938(CPUState* cpu) {
         /* 02227964 */ _t8 = cpu->r[28] + 0x00000018u;
         /* 02227964 */ cpu->r[10] = rbrew_read32(cpu->mem, _t8);
         /* 02227968 */ cpu->r[29] = 0x00000000u;
-        /* 0222796C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[10]);
+        /* 0222796C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[10]));
         /* 02227970 */ cpu->r[30] = cpu->r[4];
-        /* 02227974 */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02227974 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02227974 */ _t10 = _t9 & 0x00000001u;
         /* 02227974 */ if (_t10) goto L_02227978; else goto L_02227A00;
   L_02227978: ; // 0x2227978
@@ -10942,24 +10942,24 @@ void Gambit_fn_02227938(CPUState* cpu) {
         /* 02227988 */ cpu->r[3] = cpu->r[12] + cpu->r[31];
         /* 0222798C */ _t13 = cpu->r[3] + 0x0000000Cu;
         /* 0222798C */ cpu->r[0] = rbrew_read32(cpu->mem, _t13);
-        /* 02227990 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02227994 */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02227990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02227994 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02227994 */ _t15 = _t14 & 0x00000001u;
         /* 02227994 */ if (_t15) goto L_022279F0; else goto L_02227998;
   L_02227998: ; // 0x2227998
         /* 02227998 */ cpu->r[4] = cpu->r[30];
         /* 0222799C */ Gambit_fn_02C69328(cpu);
-        /* 022279A0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
-        /* 022279A4 */ _t16 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022279A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
+        /* 022279A4 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022279A4 */ _t17 = _t16 & 0x00000001u;
         /* 022279A4 */ if (_t17) goto L_022279A8; else goto L_022279C0;
   L_022279A8: ; // 0x22279a8
         /* 022279A8 */ _t18 = cpu->r[28] + 0x00000018u;
         /* 022279A8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t18);
         /* 022279AC */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 022279B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[10]);
+        /* 022279B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[10]));
         /* 022279B4 */ cpu->r[31] = cpu->r[31] + 0x00000018u;
-        /* 022279B8 */ _t19 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022279B8 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022279B8 */ _t20 = _t19 & 0x00000001u;
         /* 022279B8 */ if (_t20) goto L_02227984; else goto L_022279BC;
   L_022279BC: ; // 0x22279bc
@@ -10978,7 +10978,7 @@ void Gambit_fn_02227938(CPUState* cpu) {
         /* 022279D4 */ _t26 = cpu->r[1] + 0x00000014u;
         /* 022279D4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t26);
         /* 022279D8 */ cpu->r[3] = 0x00000000u;
-        /* 022279DC */ _t27 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022279DC */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022279DC */ _t28 = _t27 & 0x00000001u;
         /* 022279DC */ if (_t28) goto L_022279E0; // else: addr-0 trap, fall-through
   L_022279E0: ; // 0x22279e0
@@ -10989,9 +10989,9 @@ void Gambit_fn_02227938(CPUState* cpu) {
         /* 022279EC */ return;
   L_022279F0: ; // 0x22279f0
         /* 022279F0 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 022279F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[10]);
+        /* 022279F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[10]));
         /* 022279F8 */ cpu->r[31] = cpu->r[31] + 0x00000018u;
-        /* 022279FC */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022279FC */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022279FC */ _t31 = _t30 & 0x00000001u;
         /* 022279FC */ if (_t31) goto L_02227984; else goto L_02227A00;
   L_02227A00: ; // 0x2227a00
@@ -11008,7 +11008,7 @@ void Gambit_fn_02227938(CPUState* cpu) {
         /* 02227A14 */ _t37 = cpu->r[1] + 0x00000014u;
         /* 02227A14 */ cpu->r[31] = rbrew_read32(cpu->mem, _t37);
         /* 02227A18 */ cpu->r[3] = 0x00000001u;
-        /* 02227A1C */ _t38 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02227A1C */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02227A1C */ _t39 = _t38 & 0x00000001u;
         /* 02227A1C */ if (_t39) goto L_02227A20; // else: addr-0 trap, fall-through
   L_02227A20: ; // 0x2227a20
@@ -11046,9 +11046,9 @@ void Gambit_fn_0222793C(CPUState* cpu) {
         /* 02227964 */ _t8 = cpu->r[28] + 0x00000018u;
         /* 02227964 */ cpu->r[10] = rbrew_read32(cpu->mem, _t8);
         /* 02227968 */ cpu->r[29] = 0x00000000u;
-        /* 0222796C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[10]);
+        /* 0222796C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[10]));
         /* 02227970 */ cpu->r[30] = cpu->r[4];
-        /* 02227974 */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02227974 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02227974 */ _t10 = _t9 & 0x00000001u;
         /* 02227974 */ if (_t10) goto L_02227978; else goto L_02227A00;
   L_02227978: ; // 0x2227978
@@ -11062,24 +11062,24 @@ void Gambit_fn_0222793C(CPUState* cpu) {
         /* 02227988 */ cpu->r[3] = cpu->r[12] + cpu->r[31];
         /* 0222798C */ _t13 = cpu->r[3] + 0x0000000Cu;
         /* 0222798C */ cpu->r[0] = rbrew_read32(cpu->mem, _t13);
-        /* 02227990 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02227994 */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02227990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02227994 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02227994 */ _t15 = _t14 & 0x00000001u;
         /* 02227994 */ if (_t15) goto L_022279F0; else goto L_02227998;
   L_02227998: ; // 0x2227998
         /* 02227998 */ cpu->r[4] = cpu->r[30];
         /* 0222799C */ Gambit_fn_02C69328(cpu);
-        /* 022279A0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
-        /* 022279A4 */ _t16 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022279A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
+        /* 022279A4 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022279A4 */ _t17 = _t16 & 0x00000001u;
         /* 022279A4 */ if (_t17) goto L_022279A8; else goto L_022279C0;
   L_022279A8: ; // 0x22279a8
         /* 022279A8 */ _t18 = cpu->r[28] + 0x00000018u;
         /* 022279A8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t18);
         /* 022279AC */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 022279B0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[10]);
+        /* 022279B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[10]));
         /* 022279B4 */ cpu->r[31] = cpu->r[31] + 0x00000018u;
-        /* 022279B8 */ _t19 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022279B8 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022279B8 */ _t20 = _t19 & 0x00000001u;
         /* 022279B8 */ if (_t20) goto L_02227984; else goto L_022279BC;
   L_022279BC: ; // 0x22279bc
@@ -11098,7 +11098,7 @@ void Gambit_fn_0222793C(CPUState* cpu) {
         /* 022279D4 */ _t26 = cpu->r[1] + 0x00000014u;
         /* 022279D4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t26);
         /* 022279D8 */ cpu->r[3] = 0x00000000u;
-        /* 022279DC */ _t27 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022279DC */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022279DC */ _t28 = _t27 & 0x00000001u;
         /* 022279DC */ if (_t28) goto L_022279E0; // else: addr-0 trap, fall-through
   L_022279E0: ; // 0x22279e0
@@ -11109,9 +11109,9 @@ void Gambit_fn_0222793C(CPUState* cpu) {
         /* 022279EC */ return;
   L_022279F0: ; // 0x22279f0
         /* 022279F0 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 022279F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[10]);
+        /* 022279F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[10]));
         /* 022279F8 */ cpu->r[31] = cpu->r[31] + 0x00000018u;
-        /* 022279FC */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022279FC */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022279FC */ _t31 = _t30 & 0x00000001u;
         /* 022279FC */ if (_t31) goto L_02227984; else goto L_02227A00;
   L_02227A00: ; // 0x2227a00
@@ -11128,7 +11128,7 @@ void Gambit_fn_0222793C(CPUState* cpu) {
         /* 02227A14 */ _t37 = cpu->r[1] + 0x00000014u;
         /* 02227A14 */ cpu->r[31] = rbrew_read32(cpu->mem, _t37);
         /* 02227A18 */ cpu->r[3] = 0x00000001u;
-        /* 02227A1C */ _t38 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02227A1C */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02227A1C */ _t39 = _t38 & 0x00000001u;
         /* 02227A1C */ if (_t39) goto L_02227A20; // else: addr-0 trap, fall-through
   L_02227A20: ; // 0x2227a20
@@ -11160,9 +11160,9 @@ void Gambit_fn_02227A30(CPUState* cpu) {
         /* 02227A4C */ _t5 = cpu->r[30] + 0x00000020u;
         /* 02227A4C */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 02227A50 */ cpu->r[31] = cpu->r[4];
-        /* 02227A54 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
+        /* 02227A54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
         /* 02227A58 */ cpu->r[29] = 0x00000000u;
-        /* 02227A5C */ _t6 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02227A5C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02227A5C */ _t7 = _t6 & 0x00000001u;
         /* 02227A5C */ if (_t7) goto L_02227A60; else goto L_02227A6C;
   L_02227A60: ; // 0x2227a60
@@ -11216,9 +11216,9 @@ void Gambit_fn_02227A34(CPUState* cpu) {
         /* 02227A4C */ _t5 = cpu->r[30] + 0x00000020u;
         /* 02227A4C */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 02227A50 */ cpu->r[31] = cpu->r[4];
-        /* 02227A54 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
+        /* 02227A54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
         /* 02227A58 */ cpu->r[29] = 0x00000000u;
-        /* 02227A5C */ _t6 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02227A5C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02227A5C */ _t7 = _t6 & 0x00000001u;
         /* 02227A5C */ if (_t7) goto L_02227A60; else goto L_02227A6C;
   L_02227A60: ; // 0x2227a60
@@ -11272,9 +11272,9 @@ void Gambit_fn_02227AAC(CPUState* cpu) {
         /* 02227ACC */ cpu->r[25] = cpu->r[5];
         /* 02227AD0 */ cpu->r[28] = cpu->r[6];
         /* 02227AD4 */ cpu->r[26] = cpu->r[4];
-        /* 02227AD8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
+        /* 02227AD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
         /* 02227ADC */ cpu->r[12] = 0xFFFFFFFFu;
-        /* 02227AE0 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02227AE0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02227AE0 */ _t4 = _t3 & 0x00000001u;
         /* 02227AE0 */ if (_t4) goto L_02227AE4; else goto L_02227B6C;
   L_02227AE4: ; // 0x2227ae4
@@ -11286,8 +11286,8 @@ void Gambit_fn_02227AAC(CPUState* cpu) {
         /* 02227AF0 */ cpu->r[27] = cpu->r[11] + cpu->r[9];
         /* 02227AF4 */ _t6 = cpu->r[27] + 0x0000000Cu;
         /* 02227AF4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t6);
-        /* 02227AF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02227AFC */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02227AF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02227AFC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02227AFC */ _t8 = _t7 & 0x00000001u;
         /* 02227AFC */ if (_t8) goto L_02227B00; else goto L_02227B4C;
   L_02227B00: ; // 0x2227b00
@@ -11322,8 +11322,8 @@ void Gambit_fn_02227AAC(CPUState* cpu) {
         /* 02227B44 */ cpu->r[1] = cpu->r[1] + 0x00000028u;
         /* 02227B48 */ return;
   L_02227B4C: ; // 0x2227b4c
-        /* 02227B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[10]);
-        /* 02227B50 */ _t20 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02227B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[10]));
+        /* 02227B50 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02227B50 */ _t21 = _t20 & 0x00000001u;
         /* 02227B50 */ if (_t21) goto L_02227B54; else goto L_02227B5C;
   L_02227B54: ; // 0x2227b54
@@ -11331,9 +11331,9 @@ void Gambit_fn_02227AAC(CPUState* cpu) {
         /* 02227B58 */ cpu->r[30] = cpu->r[31];
   L_02227B5C: ; // 0x2227b5c
         /* 02227B5C */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 02227B60 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
+        /* 02227B60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
         /* 02227B64 */ cpu->r[9] = cpu->r[9] + 0x00000018u;
-        /* 02227B68 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02227B68 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02227B68 */ _t23 = _t22 & 0x00000001u;
         /* 02227B68 */ if (_t23) goto L_02227AF0; else goto L_02227B6C;
   L_02227B6C: ; // 0x2227b6c
@@ -11415,12 +11415,12 @@ void Gambit_fn_02227BF0(CPUState* cpu) {
         /* 02227C04 */ _t3 = cpu->r[1] + 0x0000000Cu;
         /* 02227C04 */ rbrew_write32(cpu->mem, _t3, cpu->r[29]);
         /* 02227C08 */ cpu->r[31] = cpu->r[3];
-        /* 02227C08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02227C08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02227C0C */ _t4 = cpu->r[1] + 0x00000010u;
         /* 02227C0C */ rbrew_write32(cpu->mem, _t4, cpu->r[30]);
         /* 02227C10 */ _t5 = cpu->r[1] + 0x0000001Cu;
         /* 02227C10 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
-        /* 02227C14 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227C14 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227C14 */ _t7 = _t6 & 0x00000001u;
         /* 02227C14 */ if (_t7) goto L_02227C78; else goto L_02227C18;
   L_02227C18: ; // 0x2227c18
@@ -11432,8 +11432,8 @@ void Gambit_fn_02227BF0(CPUState* cpu) {
         /* 02227C28 */ _t9 = cpu->r[12] + 0x000054F8u;
         /* 02227C28 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
         /* 02227C28 */ cpu->r[12] = _t9;
-        /* 02227C2C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 02227C30 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227C2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 02227C30 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227C30 */ _t11 = _t10 & 0x00000001u;
         /* 02227C30 */ if (_t11) goto L_02227C34; else goto L_02227C5C;
   L_02227C34: ; // 0x2227c34
@@ -11457,8 +11457,8 @@ void Gambit_fn_02227BF0(CPUState* cpu) {
         /* 02227C60 */ cpu->r[4] = 0x00000000u;
         /* 02227C64 */ Gambit_fn_02821E68(cpu);
         /* 02227C68 */ cpu->r[0] = rbrew_rlwinm(cpu->r[28], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02227C68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02227C6C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227C68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02227C6C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227C6C */ _t18 = _t17 & 0x00000001u;
         /* 02227C6C */ if (_t18) goto L_02227C78; else goto L_02227C70;
   L_02227C70: ; // 0x2227c70
@@ -11496,12 +11496,12 @@ void Gambit_fn_02227BF4(CPUState* cpu) {
         /* 02227C04 */ _t3 = cpu->r[1] + 0x0000000Cu;
         /* 02227C04 */ rbrew_write32(cpu->mem, _t3, cpu->r[29]);
         /* 02227C08 */ cpu->r[31] = cpu->r[3];
-        /* 02227C08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02227C08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02227C0C */ _t4 = cpu->r[1] + 0x00000010u;
         /* 02227C0C */ rbrew_write32(cpu->mem, _t4, cpu->r[30]);
         /* 02227C10 */ _t5 = cpu->r[1] + 0x0000001Cu;
         /* 02227C10 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
-        /* 02227C14 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227C14 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227C14 */ _t7 = _t6 & 0x00000001u;
         /* 02227C14 */ if (_t7) goto L_02227C78; else goto L_02227C18;
   L_02227C18: ; // 0x2227c18
@@ -11513,8 +11513,8 @@ void Gambit_fn_02227BF4(CPUState* cpu) {
         /* 02227C28 */ _t9 = cpu->r[12] + 0x000054F8u;
         /* 02227C28 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
         /* 02227C28 */ cpu->r[12] = _t9;
-        /* 02227C2C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[0]);
-        /* 02227C30 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227C2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[0]));
+        /* 02227C30 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227C30 */ _t11 = _t10 & 0x00000001u;
         /* 02227C30 */ if (_t11) goto L_02227C34; else goto L_02227C5C;
   L_02227C34: ; // 0x2227c34
@@ -11538,8 +11538,8 @@ void Gambit_fn_02227BF4(CPUState* cpu) {
         /* 02227C60 */ cpu->r[4] = 0x00000000u;
         /* 02227C64 */ Gambit_fn_02821E68(cpu);
         /* 02227C68 */ cpu->r[0] = rbrew_rlwinm(cpu->r[28], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02227C68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02227C6C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227C68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02227C6C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227C6C */ _t18 = _t17 & 0x00000001u;
         /* 02227C6C */ if (_t18) goto L_02227C78; else goto L_02227C70;
   L_02227C70: ; // 0x2227c70
@@ -11566,15 +11566,15 @@ void Gambit_fn_02227C98(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02227C98: ; // 0x2227c98
-        /* 02227C98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02227C9C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227C98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02227C9C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227C9C */ _t1 = _t0 & 0x00000001u;
         /* 02227C9C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02227C9C */ goto L_02227CA0;
   L_02227CA0: ; // 0x2227ca0
         /* 02227CA0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02227CA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02227CA4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227CA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02227CA4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227CA4 */ _t3 = _t2 & 0x00000001u;
         /* 02227CA4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02227CA4 */ goto L_02227CA8;
@@ -11593,8 +11593,8 @@ void Gambit_fn_02227C98(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -11608,15 +11608,15 @@ void Gambit_fn_02227C98(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -11650,15 +11650,15 @@ void Gambit_fn_02227CB0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02227CB0: ; // 0x2227cb0
-        /* 02227CB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02227CB4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227CB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02227CB4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227CB4 */ _t1 = _t0 & 0x00000001u;
         /* 02227CB4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02227CB4 */ goto L_02227CB8;
   L_02227CB8: ; // 0x2227cb8
         /* 02227CB8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02227CB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02227CBC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227CB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02227CBC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227CBC */ _t3 = _t2 & 0x00000001u;
         /* 02227CBC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02227CBC */ goto L_02227CC0;
@@ -11677,8 +11677,8 @@ void Gambit_fn_02227CB0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -11692,15 +11692,15 @@ void Gambit_fn_02227CB0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -11746,15 +11746,15 @@ void Gambit_fn_02227CE0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02227CE0: ; // 0x2227ce0
-        /* 02227CE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02227CE4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227CE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02227CE4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227CE4 */ _t1 = _t0 & 0x00000001u;
         /* 02227CE4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02227CE4 */ goto L_02227CE8;
   L_02227CE8: ; // 0x2227ce8
         /* 02227CE8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02227CE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02227CEC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227CE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02227CEC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227CEC */ _t3 = _t2 & 0x00000001u;
         /* 02227CEC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02227CEC */ goto L_02227CF0;
@@ -11773,8 +11773,8 @@ void Gambit_fn_02227CE0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -11788,15 +11788,15 @@ void Gambit_fn_02227CE0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -11824,15 +11824,15 @@ void Gambit_fn_02227CF4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02227CF4: ; // 0x2227cf4
-        /* 02227CF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02227CF8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227CF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02227CF8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227CF8 */ _t1 = _t0 & 0x00000001u;
         /* 02227CF8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02227CF8 */ goto L_02227CFC;
   L_02227CFC: ; // 0x2227cfc
         /* 02227CFC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02227CFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02227D00 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227CFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02227D00 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227D00 */ _t3 = _t2 & 0x00000001u;
         /* 02227D00 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02227D00 */ goto L_02227D04;
@@ -11851,8 +11851,8 @@ void Gambit_fn_02227CF4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -11866,15 +11866,15 @@ void Gambit_fn_02227CF4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -11932,7 +11932,7 @@ void Gambit_fn_02227D08(CPUState* cpu) {
         /* 02227D3C */ rbrew_write32(cpu->mem, _t12, cpu->r[4]);
         /* 02227D40 */ _t13 = cpu->r[1] + 0x00000028u;
         /* 02227D40 */ rbrew_write32(cpu->mem, _t13, cpu->r[7]);
-        /* 02227D44 */ _t14 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02227D44 */ _t14 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02227D44 */ _t15 = _t14 & 0x00000001u;
         /* 02227D44 */ if (_t15) goto L_02227D48; else goto L_02227D68;
   L_02227D48: ; // 0x2227d48
@@ -11954,45 +11954,45 @@ void Gambit_fn_02227D08(CPUState* cpu) {
         /* 02227D64 */ rbrew_write_f64(cpu->mem, _t23, cpu->f[1]);
   L_02227D68: ; // 0x2227d68
         /* 02227D68 */ cpu->r[31] = cpu->r[3];
-        /* 02227D68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02227D68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02227D6C */ cpu->r[30] = cpu->r[4];
-        /* 02227D70 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227D70 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227D70 */ _t25 = _t24 & 0x00000001u;
         /* 02227D70 */ if (_t25) goto L_02227D74; else goto L_02227D84;
   L_02227D74: ; // 0x2227d74
         /* 02227D74 */ cpu->r[3] = 0x0000010Cu;
         /* 02227D78 */ Gambit_fn_02801A78(cpu);
         /* 02227D7C */ cpu->r[31] = cpu->r[3];
-        /* 02227D7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02227D80 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227D7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02227D80 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227D80 */ _t27 = _t26 & 0x00000001u;
         /* 02227D80 */ if (_t27) goto L_02227E48; else goto L_02227D84;
   L_02227D84: ; // 0x2227d84
         /* 02227D84 */ cpu->r[29] = cpu->r[31];
-        /* 02227D84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02227D88 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227D84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02227D88 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227D88 */ _t29 = _t28 & 0x00000001u;
         /* 02227D88 */ if (_t29) goto L_02227D8C; else goto L_02227D9C;
   L_02227D8C: ; // 0x2227d8c
         /* 02227D8C */ cpu->r[3] = 0x0000010Cu;
         /* 02227D90 */ Gambit_fn_02801A78(cpu);
         /* 02227D94 */ cpu->r[29] = cpu->r[3];
-        /* 02227D94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02227D98 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227D94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02227D98 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227D98 */ _t31 = _t30 & 0x00000001u;
         /* 02227D98 */ if (_t31) goto L_02227E0C; else goto L_02227D9C;
   L_02227D9C: ; // 0x2227d9c
         /* 02227D9C */ cpu->r[3] = cpu->r[29];
-        /* 02227D9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02227D9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02227DA0 */ cpu->r[28] = 0x10110000u;
-        /* 02227DA4 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227DA4 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227DA4 */ _t33 = _t32 & 0x00000001u;
         /* 02227DA4 */ if (_t33) goto L_02227DA8; else goto L_02227DD4;
   L_02227DA8: ; // 0x2227da8
         /* 02227DA8 */ cpu->r[3] = 0x0000000Cu;
         /* 02227DAC */ Gambit_fn_02801A78(cpu);
-        /* 02227DB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02227DB4 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227DB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02227DB4 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227DB4 */ _t35 = _t34 & 0x00000001u;
         /* 02227DB4 */ if (_t35) goto L_02227DB8; else goto L_02227DD4;
   L_02227DB8: ; // 0x2227db8
@@ -12102,7 +12102,7 @@ void Gambit_fn_02227D0C(CPUState* cpu) {
         /* 02227D3C */ rbrew_write32(cpu->mem, _t12, cpu->r[4]);
         /* 02227D40 */ _t13 = cpu->r[1] + 0x00000028u;
         /* 02227D40 */ rbrew_write32(cpu->mem, _t13, cpu->r[7]);
-        /* 02227D44 */ _t14 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02227D44 */ _t14 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02227D44 */ _t15 = _t14 & 0x00000001u;
         /* 02227D44 */ if (_t15) goto L_02227D48; else goto L_02227D68;
   L_02227D48: ; // 0x2227d48
@@ -12124,45 +12124,45 @@ void Gambit_fn_02227D0C(CPUState* cpu) {
         /* 02227D64 */ rbrew_write_f64(cpu->mem, _t23, cpu->f[1]);
   L_02227D68: ; // 0x2227d68
         /* 02227D68 */ cpu->r[31] = cpu->r[3];
-        /* 02227D68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02227D68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02227D6C */ cpu->r[30] = cpu->r[4];
-        /* 02227D70 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227D70 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227D70 */ _t25 = _t24 & 0x00000001u;
         /* 02227D70 */ if (_t25) goto L_02227D74; else goto L_02227D84;
   L_02227D74: ; // 0x2227d74
         /* 02227D74 */ cpu->r[3] = 0x0000010Cu;
         /* 02227D78 */ Gambit_fn_02801A78(cpu);
         /* 02227D7C */ cpu->r[31] = cpu->r[3];
-        /* 02227D7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02227D80 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227D7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02227D80 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227D80 */ _t27 = _t26 & 0x00000001u;
         /* 02227D80 */ if (_t27) goto L_02227E48; else goto L_02227D84;
   L_02227D84: ; // 0x2227d84
         /* 02227D84 */ cpu->r[29] = cpu->r[31];
-        /* 02227D84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02227D88 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227D84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02227D88 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227D88 */ _t29 = _t28 & 0x00000001u;
         /* 02227D88 */ if (_t29) goto L_02227D8C; else goto L_02227D9C;
   L_02227D8C: ; // 0x2227d8c
         /* 02227D8C */ cpu->r[3] = 0x0000010Cu;
         /* 02227D90 */ Gambit_fn_02801A78(cpu);
         /* 02227D94 */ cpu->r[29] = cpu->r[3];
-        /* 02227D94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02227D98 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227D94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02227D98 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227D98 */ _t31 = _t30 & 0x00000001u;
         /* 02227D98 */ if (_t31) goto L_02227E0C; else goto L_02227D9C;
   L_02227D9C: ; // 0x2227d9c
         /* 02227D9C */ cpu->r[3] = cpu->r[29];
-        /* 02227D9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02227D9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02227DA0 */ cpu->r[28] = 0x10110000u;
-        /* 02227DA4 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227DA4 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227DA4 */ _t33 = _t32 & 0x00000001u;
         /* 02227DA4 */ if (_t33) goto L_02227DA8; else goto L_02227DD4;
   L_02227DA8: ; // 0x2227da8
         /* 02227DA8 */ cpu->r[3] = 0x0000000Cu;
         /* 02227DAC */ Gambit_fn_02801A78(cpu);
-        /* 02227DB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02227DB4 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227DB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02227DB4 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227DB4 */ _t35 = _t34 & 0x00000001u;
         /* 02227DB4 */ if (_t35) goto L_02227DB8; else goto L_02227DD4;
   L_02227DB8: ; // 0x2227db8
@@ -12243,15 +12243,15 @@ void Gambit_fn_02227E6C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02227E6C: ; // 0x2227e6c
-        /* 02227E6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02227E70 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227E6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02227E70 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227E70 */ _t1 = _t0 & 0x00000001u;
         /* 02227E70 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02227E70 */ goto L_02227E74;
   L_02227E74: ; // 0x2227e74
         /* 02227E74 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02227E74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02227E78 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227E74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02227E78 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227E78 */ _t3 = _t2 & 0x00000001u;
         /* 02227E78 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02227E78 */ goto L_02227E7C;
@@ -12270,8 +12270,8 @@ void Gambit_fn_02227E6C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -12285,15 +12285,15 @@ void Gambit_fn_02227E6C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -12327,23 +12327,23 @@ void Gambit_fn_02227E84(CPUState* cpu) {
         /* 02227E88 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 02227E88 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02227E8C */ cpu->r[31] = cpu->r[3];
-        /* 02227E8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02227E8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02227E90 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02227E90 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 02227E94 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227E94 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227E94 */ _t4 = _t3 & 0x00000001u;
         /* 02227E94 */ if (_t4) goto L_02227E98; else goto L_02227EA8;
   L_02227E98: ; // 0x2227e98
         /* 02227E98 */ cpu->r[3] = 0x00000018u;
         /* 02227E9C */ Gambit_fn_02801A78(cpu);
         /* 02227EA0 */ cpu->r[31] = cpu->r[3];
-        /* 02227EA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02227EA4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227EA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02227EA4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227EA4 */ _t6 = _t5 & 0x00000001u;
         /* 02227EA4 */ if (_t6) goto L_02227ECC; else goto L_02227EA8;
   L_02227EA8: ; // 0x2227ea8
-        /* 02227EA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02227EAC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227EA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02227EAC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227EAC */ _t8 = _t7 & 0x00000001u;
         /* 02227EAC */ if (_t8) goto L_02227EB0; else goto L_02227EB8;
   L_02227EB0: ; // 0x2227eb0
@@ -12380,43 +12380,43 @@ void Gambit_fn_02227EE8(CPUState* cpu) {
         /* 02227EEC */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 02227EEC */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02227EF0 */ cpu->r[31] = cpu->r[3];
-        /* 02227EF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02227EF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02227EF4 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02227EF4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 02227EF8 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227EF8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227EF8 */ _t4 = _t3 & 0x00000001u;
         /* 02227EF8 */ if (_t4) goto L_02227EFC; else goto L_02227F0C;
   L_02227EFC: ; // 0x2227efc
         /* 02227EFC */ cpu->r[3] = 0x00000010u;
         /* 02227F00 */ Gambit_fn_02801A78(cpu);
         /* 02227F04 */ cpu->r[31] = cpu->r[3];
-        /* 02227F04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02227F08 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227F04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02227F08 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227F08 */ _t6 = _t5 & 0x00000001u;
         /* 02227F08 */ if (_t6) goto L_02227F58; else goto L_02227F0C;
   L_02227F0C: ; // 0x2227f0c
         /* 02227F0C */ cpu->r[3] = cpu->r[31];
-        /* 02227F0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02227F10 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227F0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02227F10 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227F10 */ _t8 = _t7 & 0x00000001u;
         /* 02227F10 */ if (_t8) goto L_02227F14; else goto L_02227F24;
   L_02227F14: ; // 0x2227f14
         /* 02227F14 */ cpu->r[3] = 0x0000000Cu;
         /* 02227F18 */ Gambit_fn_02801A78(cpu);
-        /* 02227F1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02227F20 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227F1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02227F20 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227F20 */ _t10 = _t9 & 0x00000001u;
         /* 02227F20 */ if (_t10) goto L_02227F50; else goto L_02227F24;
   L_02227F24: ; // 0x2227f24
-        /* 02227F24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02227F28 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227F24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02227F28 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227F28 */ _t12 = _t11 & 0x00000001u;
         /* 02227F28 */ if (_t12) goto L_02227F2C; else goto L_02227F3C;
   L_02227F2C: ; // 0x2227f2c
         /* 02227F2C */ cpu->r[3] = 0x0000000Cu;
         /* 02227F30 */ Gambit_fn_02801A78(cpu);
-        /* 02227F34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02227F38 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227F34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02227F38 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227F38 */ _t14 = _t13 & 0x00000001u;
         /* 02227F38 */ if (_t14) goto L_02227F50; else goto L_02227F3C;
   L_02227F3C: ; // 0x2227f3c
@@ -12500,8 +12500,8 @@ void Gambit_fn_02227F90(CPUState* cpu) {
         /* 02227F90 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02227F90 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02227F94 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 02227F94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02227F98 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227F94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02227F98 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227F98 */ _t2 = _t1 & 0x00000001u;
         /* 02227F98 */ _t3 = _t2 ^ 0x00000001u;
         /* 02227F98 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -12523,8 +12523,8 @@ void Gambit_fn_02227FAC(CPUState* cpu) {
         /* 02227FAC */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02227FAC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02227FB0 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 02227FB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02227FB4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227FB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02227FB4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227FB4 */ _t2 = _t1 & 0x00000001u;
         /* 02227FB4 */ _t3 = _t2 ^ 0x00000001u;
         /* 02227FB4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -12546,8 +12546,8 @@ void Gambit_fn_02227FC8(CPUState* cpu) {
         /* 02227FC8 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02227FC8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02227FCC */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 02227FCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02227FD0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02227FCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02227FD0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02227FD0 */ _t2 = _t1 & 0x00000001u;
         /* 02227FD0 */ _t3 = _t2 ^ 0x00000001u;
         /* 02227FD0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -12590,8 +12590,8 @@ void Gambit_fn_02227FF4(CPUState* cpu) {
         /* 02228004 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02228008 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02228008 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0222800C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02228010 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222800C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02228010 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228010 */ _t5 = _t4 & 0x00000001u;
         /* 02228010 */ if (_t5) goto L_02228014; else goto L_02228030;
   L_02228014: ; // 0x2228014
@@ -12630,8 +12630,8 @@ void Gambit_fn_02227FF8(CPUState* cpu) {
         /* 02228004 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02228008 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02228008 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0222800C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02228010 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222800C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02228010 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228010 */ _t5 = _t4 & 0x00000001u;
         /* 02228010 */ if (_t5) goto L_02228014; else goto L_02228030;
   L_02228014: ; // 0x2228014
@@ -13016,8 +13016,8 @@ void Gambit_fn_022281B8(CPUState* cpu) {
         /* 022281B8 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 022281B8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 022281BC */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 022281BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022281C0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022281BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022281C0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022281C0 */ _t2 = _t1 & 0x00000001u;
         /* 022281C0 */ if (_t2) goto L_022281D0; else goto L_022281C4;
   L_022281C4: ; // 0x22281c4
@@ -13046,8 +13046,8 @@ void Gambit_fn_022281DC(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -13180,9 +13180,9 @@ void Gambit_fn_02228250(CPUState* cpu) {
         /* 02228254 */ _t0 = cpu->r[8] + 0xFFFFFD40u;
         /* 02228254 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 02228258 */ cpu->r[6] = 0x101D0000u;
-        /* 0222825C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0222825C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02228260 */ cpu->r[6] = cpu->r[6] + 0xFFFFFF2Cu;
-        /* 02228264 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228264 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228264 */ _t2 = _t1 & 0x00000001u;
         /* 02228264 */ if (_t2) goto L_02228268; else goto L_02228280;
   L_02228268: ; // 0x2228268
@@ -13195,8 +13195,8 @@ void Gambit_fn_02228250(CPUState* cpu) {
         /* 0222827C */ _t4 = cpu->r[6] + 0x00000000u;
         /* 0222827C */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_02228280: ; // 0x2228280
-        /* 02228280 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 02228284 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228280 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 02228284 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228284 */ _t6 = _t5 & 0x00000001u;
         /* 02228284 */ if (_t6) goto L_02228288; else goto L_02228290;
   L_02228288: ; // 0x2228288
@@ -13207,9 +13207,9 @@ void Gambit_fn_02228250(CPUState* cpu) {
         /* 02228294 */ _t7 = cpu->r[10] + 0xFFFFE610u;
         /* 02228294 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 02228298 */ cpu->r[8] = 0x101D0000u;
-        /* 0222829C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0222829C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 022282A0 */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 022282A4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022282A4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022282A4 */ _t9 = _t8 & 0x00000001u;
         /* 022282A4 */ if (_t9) goto L_022282A8; else goto L_022282C0;
   L_022282A8: ; // 0x22282a8
@@ -13222,8 +13222,8 @@ void Gambit_fn_02228250(CPUState* cpu) {
         /* 022282BC */ _t11 = cpu->r[8] + 0x00000000u;
         /* 022282BC */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_022282C0: ; // 0x22282c0
-        /* 022282C0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 022282C4 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022282C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 022282C4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022282C4 */ _t13 = _t12 & 0x00000001u;
         /* 022282C4 */ if (_t13) goto L_022282C8; else goto L_022282D0;
   L_022282C8: ; // 0x22282c8
@@ -13234,9 +13234,9 @@ void Gambit_fn_02228250(CPUState* cpu) {
         /* 022282D4 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 022282D4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 022282D8 */ cpu->r[10] = 0x101D0000u;
-        /* 022282DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 022282DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 022282E0 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 022282E4 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022282E4 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022282E4 */ _t16 = _t15 & 0x00000001u;
         /* 022282E4 */ if (_t16) goto L_022282E8; else goto L_02228300;
   L_022282E8: ; // 0x22282e8
@@ -13249,8 +13249,8 @@ void Gambit_fn_02228250(CPUState* cpu) {
         /* 022282FC */ _t18 = cpu->r[10] + 0x00000000u;
         /* 022282FC */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_02228300: ; // 0x2228300
-        /* 02228300 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02228304 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228300 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02228304 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228304 */ _t20 = _t19 & 0x00000001u;
         /* 02228304 */ if (_t20) goto L_02228308; else goto L_02228310;
   L_02228308: ; // 0x2228308
@@ -13261,9 +13261,9 @@ void Gambit_fn_02228250(CPUState* cpu) {
         /* 02228314 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 02228314 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 02228318 */ cpu->r[12] = 0x101D0000u;
-        /* 0222831C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0222831C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02228320 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 02228324 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228324 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228324 */ _t23 = _t22 & 0x00000001u;
         /* 02228324 */ if (_t23) goto L_02228328; else goto L_02228340;
   L_02228328: ; // 0x2228328
@@ -13276,8 +13276,8 @@ void Gambit_fn_02228250(CPUState* cpu) {
         /* 0222833C */ _t25 = cpu->r[12] + 0x00000000u;
         /* 0222833C */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_02228340: ; // 0x2228340
-        /* 02228340 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02228344 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228340 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02228344 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228344 */ _t27 = _t26 & 0x00000001u;
         /* 02228344 */ if (_t27) goto L_02228348; else goto L_02228350;
   L_02228348: ; // 0x2228348
@@ -13289,9 +13289,9 @@ void Gambit_fn_02228250(CPUState* cpu) {
         /* 02228354 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 02228354 */ cpu->r[10] = _t28;
         /* 02228358 */ cpu->r[7] = 0x101D0000u;
-        /* 0222835C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0222835C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02228360 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 02228364 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228364 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228364 */ _t30 = _t29 & 0x00000001u;
         /* 02228364 */ if (_t30) goto L_02228368; else goto L_0222837C;
   L_02228368: ; // 0x2228368
@@ -13303,8 +13303,8 @@ void Gambit_fn_02228250(CPUState* cpu) {
         /* 02228378 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 02228378 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_0222837C: ; // 0x222837c
-        /* 0222837C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 02228380 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222837C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 02228380 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228380 */ _t34 = _t33 & 0x00000001u;
         /* 02228380 */ if (_t34) goto L_02228384; else goto L_0222838C;
   L_02228384: ; // 0x2228384
@@ -13316,9 +13316,9 @@ void Gambit_fn_02228250(CPUState* cpu) {
         /* 02228390 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 02228390 */ cpu->r[8] = _t35;
         /* 02228394 */ cpu->r[6] = 0x101D0000u;
-        /* 02228398 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02228398 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0222839C */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 022283A0 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022283A0 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022283A0 */ _t37 = _t36 & 0x00000001u;
         /* 022283A0 */ if (_t37) goto L_022283A4; else goto L_022283B8;
   L_022283A4: ; // 0x22283a4
@@ -13364,9 +13364,9 @@ void Gambit_fn_022283E4(CPUState* cpu) {
         /* 022283E8 */ _t0 = cpu->r[8] + 0xFFFFFD44u;
         /* 022283E8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 022283EC */ cpu->r[6] = 0x101D0000u;
-        /* 022283F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 022283F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 022283F4 */ cpu->r[6] = cpu->r[6] + 0xFFFFFF30u;
-        /* 022283F8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022283F8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022283F8 */ _t2 = _t1 & 0x00000001u;
         /* 022283F8 */ if (_t2) goto L_022283FC; else goto L_02228414;
   L_022283FC: ; // 0x22283fc
@@ -13379,8 +13379,8 @@ void Gambit_fn_022283E4(CPUState* cpu) {
         /* 02228410 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 02228410 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_02228414: ; // 0x2228414
-        /* 02228414 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 02228418 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228414 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 02228418 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228418 */ _t6 = _t5 & 0x00000001u;
         /* 02228418 */ if (_t6) goto L_0222841C; else goto L_02228424;
   L_0222841C: ; // 0x222841c
@@ -13391,9 +13391,9 @@ void Gambit_fn_022283E4(CPUState* cpu) {
         /* 02228428 */ _t7 = cpu->r[10] + 0xFFFFE610u;
         /* 02228428 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 0222842C */ cpu->r[8] = 0x101D0000u;
-        /* 02228430 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02228430 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02228434 */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 02228438 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228438 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228438 */ _t9 = _t8 & 0x00000001u;
         /* 02228438 */ if (_t9) goto L_0222843C; else goto L_02228454;
   L_0222843C: ; // 0x222843c
@@ -13406,8 +13406,8 @@ void Gambit_fn_022283E4(CPUState* cpu) {
         /* 02228450 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 02228450 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_02228454: ; // 0x2228454
-        /* 02228454 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02228458 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228454 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02228458 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228458 */ _t13 = _t12 & 0x00000001u;
         /* 02228458 */ if (_t13) goto L_0222845C; else goto L_02228464;
   L_0222845C: ; // 0x222845c
@@ -13418,9 +13418,9 @@ void Gambit_fn_022283E4(CPUState* cpu) {
         /* 02228468 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 02228468 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 0222846C */ cpu->r[10] = 0x101D0000u;
-        /* 02228470 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02228470 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02228474 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 02228478 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228478 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228478 */ _t16 = _t15 & 0x00000001u;
         /* 02228478 */ if (_t16) goto L_0222847C; else goto L_02228494;
   L_0222847C: ; // 0x222847c
@@ -13433,8 +13433,8 @@ void Gambit_fn_022283E4(CPUState* cpu) {
         /* 02228490 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 02228490 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_02228494: ; // 0x2228494
-        /* 02228494 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02228498 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228494 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02228498 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228498 */ _t20 = _t19 & 0x00000001u;
         /* 02228498 */ if (_t20) goto L_0222849C; else goto L_022284A4;
   L_0222849C: ; // 0x222849c
@@ -13445,9 +13445,9 @@ void Gambit_fn_022283E4(CPUState* cpu) {
         /* 022284A8 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 022284A8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 022284AC */ cpu->r[12] = 0x101D0000u;
-        /* 022284B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 022284B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 022284B4 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 022284B8 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022284B8 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022284B8 */ _t23 = _t22 & 0x00000001u;
         /* 022284B8 */ if (_t23) goto L_022284BC; else goto L_022284D4;
   L_022284BC: ; // 0x22284bc
@@ -13460,8 +13460,8 @@ void Gambit_fn_022283E4(CPUState* cpu) {
         /* 022284D0 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 022284D0 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_022284D4: ; // 0x22284d4
-        /* 022284D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 022284D8 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022284D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 022284D8 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022284D8 */ _t27 = _t26 & 0x00000001u;
         /* 022284D8 */ if (_t27) goto L_022284DC; else goto L_022284E4;
   L_022284DC: ; // 0x22284dc
@@ -13473,9 +13473,9 @@ void Gambit_fn_022283E4(CPUState* cpu) {
         /* 022284E8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 022284E8 */ cpu->r[10] = _t28;
         /* 022284EC */ cpu->r[7] = 0x101D0000u;
-        /* 022284F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 022284F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 022284F4 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 022284F8 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022284F8 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022284F8 */ _t30 = _t29 & 0x00000001u;
         /* 022284F8 */ if (_t30) goto L_022284FC; else goto L_02228510;
   L_022284FC: ; // 0x22284fc
@@ -13487,8 +13487,8 @@ void Gambit_fn_022283E4(CPUState* cpu) {
         /* 0222850C */ _t32 = cpu->r[7] + 0x00000000u;
         /* 0222850C */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_02228510: ; // 0x2228510
-        /* 02228510 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 02228514 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228510 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 02228514 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228514 */ _t34 = _t33 & 0x00000001u;
         /* 02228514 */ if (_t34) goto L_02228518; else goto L_02228520;
   L_02228518: ; // 0x2228518
@@ -13500,9 +13500,9 @@ void Gambit_fn_022283E4(CPUState* cpu) {
         /* 02228524 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 02228524 */ cpu->r[8] = _t35;
         /* 02228528 */ cpu->r[6] = 0x101D0000u;
-        /* 0222852C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0222852C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02228530 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 02228534 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228534 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228534 */ _t37 = _t36 & 0x00000001u;
         /* 02228534 */ if (_t37) goto L_02228538; else goto L_0222854C;
   L_02228538: ; // 0x2228538
@@ -13548,9 +13548,9 @@ void Gambit_fn_02228578(CPUState* cpu) {
         /* 0222857C */ _t0 = cpu->r[8] + 0xFFFFFD48u;
         /* 0222857C */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 02228580 */ cpu->r[6] = 0x101D0000u;
-        /* 02228584 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02228584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02228588 */ cpu->r[6] = cpu->r[6] + 0xFFFFFF34u;
-        /* 0222858C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222858C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222858C */ _t2 = _t1 & 0x00000001u;
         /* 0222858C */ if (_t2) goto L_02228590; else goto L_022285A8;
   L_02228590: ; // 0x2228590
@@ -13563,8 +13563,8 @@ void Gambit_fn_02228578(CPUState* cpu) {
         /* 022285A4 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 022285A4 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_022285A8: ; // 0x22285a8
-        /* 022285A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 022285AC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022285A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 022285AC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022285AC */ _t6 = _t5 & 0x00000001u;
         /* 022285AC */ if (_t6) goto L_022285B0; else goto L_022285B8;
   L_022285B0: ; // 0x22285b0
@@ -13575,9 +13575,9 @@ void Gambit_fn_02228578(CPUState* cpu) {
         /* 022285BC */ _t7 = cpu->r[10] + 0xFFFFE610u;
         /* 022285BC */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 022285C0 */ cpu->r[8] = 0x101D0000u;
-        /* 022285C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 022285C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 022285C8 */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 022285CC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022285CC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022285CC */ _t9 = _t8 & 0x00000001u;
         /* 022285CC */ if (_t9) goto L_022285D0; else goto L_022285E8;
   L_022285D0: ; // 0x22285d0
@@ -13590,8 +13590,8 @@ void Gambit_fn_02228578(CPUState* cpu) {
         /* 022285E4 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 022285E4 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_022285E8: ; // 0x22285e8
-        /* 022285E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 022285EC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022285E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 022285EC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022285EC */ _t13 = _t12 & 0x00000001u;
         /* 022285EC */ if (_t13) goto L_022285F0; else goto L_022285F8;
   L_022285F0: ; // 0x22285f0
@@ -13602,9 +13602,9 @@ void Gambit_fn_02228578(CPUState* cpu) {
         /* 022285FC */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 022285FC */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 02228600 */ cpu->r[10] = 0x101D0000u;
-        /* 02228604 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02228604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02228608 */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 0222860C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222860C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222860C */ _t16 = _t15 & 0x00000001u;
         /* 0222860C */ if (_t16) goto L_02228610; else goto L_02228628;
   L_02228610: ; // 0x2228610
@@ -13617,8 +13617,8 @@ void Gambit_fn_02228578(CPUState* cpu) {
         /* 02228624 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 02228624 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_02228628: ; // 0x2228628
-        /* 02228628 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0222862C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228628 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0222862C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222862C */ _t20 = _t19 & 0x00000001u;
         /* 0222862C */ if (_t20) goto L_02228630; else goto L_02228638;
   L_02228630: ; // 0x2228630
@@ -13629,9 +13629,9 @@ void Gambit_fn_02228578(CPUState* cpu) {
         /* 0222863C */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 0222863C */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 02228640 */ cpu->r[12] = 0x101D0000u;
-        /* 02228644 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02228644 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02228648 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 0222864C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222864C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222864C */ _t23 = _t22 & 0x00000001u;
         /* 0222864C */ if (_t23) goto L_02228650; else goto L_02228668;
   L_02228650: ; // 0x2228650
@@ -13644,8 +13644,8 @@ void Gambit_fn_02228578(CPUState* cpu) {
         /* 02228664 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 02228664 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_02228668: ; // 0x2228668
-        /* 02228668 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0222866C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228668 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0222866C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222866C */ _t27 = _t26 & 0x00000001u;
         /* 0222866C */ if (_t27) goto L_02228670; else goto L_02228678;
   L_02228670: ; // 0x2228670
@@ -13657,9 +13657,9 @@ void Gambit_fn_02228578(CPUState* cpu) {
         /* 0222867C */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 0222867C */ cpu->r[10] = _t28;
         /* 02228680 */ cpu->r[7] = 0x101D0000u;
-        /* 02228684 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02228684 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02228688 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 0222868C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222868C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222868C */ _t30 = _t29 & 0x00000001u;
         /* 0222868C */ if (_t30) goto L_02228690; else goto L_022286A4;
   L_02228690: ; // 0x2228690
@@ -13671,8 +13671,8 @@ void Gambit_fn_02228578(CPUState* cpu) {
         /* 022286A0 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 022286A0 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_022286A4: ; // 0x22286a4
-        /* 022286A4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 022286A8 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022286A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 022286A8 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022286A8 */ _t34 = _t33 & 0x00000001u;
         /* 022286A8 */ if (_t34) goto L_022286AC; else goto L_022286B4;
   L_022286AC: ; // 0x22286ac
@@ -13684,9 +13684,9 @@ void Gambit_fn_02228578(CPUState* cpu) {
         /* 022286B8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 022286B8 */ cpu->r[8] = _t35;
         /* 022286BC */ cpu->r[6] = 0x101D0000u;
-        /* 022286C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 022286C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 022286C4 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 022286C8 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022286C8 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022286C8 */ _t37 = _t36 & 0x00000001u;
         /* 022286C8 */ if (_t37) goto L_022286CC; else goto L_022286E0;
   L_022286CC: ; // 0x22286cc
@@ -13732,9 +13732,9 @@ void Gambit_fn_0222870C(CPUState* cpu) {
         /* 02228710 */ _t0 = cpu->r[8] + 0xFFFFFD4Cu;
         /* 02228710 */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 02228714 */ cpu->r[6] = 0x101D0000u;
-        /* 02228718 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02228718 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0222871C */ cpu->r[6] = cpu->r[6] + 0xFFFFFF38u;
-        /* 02228720 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228720 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228720 */ _t2 = _t1 & 0x00000001u;
         /* 02228720 */ if (_t2) goto L_02228724; else goto L_0222873C;
   L_02228724: ; // 0x2228724
@@ -13747,8 +13747,8 @@ void Gambit_fn_0222870C(CPUState* cpu) {
         /* 02228738 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 02228738 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_0222873C: ; // 0x222873c
-        /* 0222873C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 02228740 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222873C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 02228740 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228740 */ _t6 = _t5 & 0x00000001u;
         /* 02228740 */ if (_t6) goto L_02228744; else goto L_0222874C;
   L_02228744: ; // 0x2228744
@@ -13759,9 +13759,9 @@ void Gambit_fn_0222870C(CPUState* cpu) {
         /* 02228750 */ _t7 = cpu->r[10] + 0xFFFFE610u;
         /* 02228750 */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 02228754 */ cpu->r[8] = 0x101D0000u;
-        /* 02228758 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02228758 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0222875C */ cpu->r[8] = cpu->r[8] + 0xFFFFFEC8u;
-        /* 02228760 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228760 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228760 */ _t9 = _t8 & 0x00000001u;
         /* 02228760 */ if (_t9) goto L_02228764; else goto L_0222877C;
   L_02228764: ; // 0x2228764
@@ -13774,8 +13774,8 @@ void Gambit_fn_0222870C(CPUState* cpu) {
         /* 02228778 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 02228778 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_0222877C: ; // 0x222877c
-        /* 0222877C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02228780 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222877C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02228780 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228780 */ _t13 = _t12 & 0x00000001u;
         /* 02228780 */ if (_t13) goto L_02228784; else goto L_0222878C;
   L_02228784: ; // 0x2228784
@@ -13786,9 +13786,9 @@ void Gambit_fn_0222870C(CPUState* cpu) {
         /* 02228790 */ _t14 = cpu->r[12] + 0xFFFFDA00u;
         /* 02228790 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 02228794 */ cpu->r[10] = 0x101D0000u;
-        /* 02228798 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02228798 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0222879C */ cpu->r[10] = cpu->r[10] + 0xFFFFFBFCu;
-        /* 022287A0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022287A0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022287A0 */ _t16 = _t15 & 0x00000001u;
         /* 022287A0 */ if (_t16) goto L_022287A4; else goto L_022287BC;
   L_022287A4: ; // 0x22287a4
@@ -13801,8 +13801,8 @@ void Gambit_fn_0222870C(CPUState* cpu) {
         /* 022287B8 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 022287B8 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_022287BC: ; // 0x22287bc
-        /* 022287BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 022287C0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022287BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 022287C0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022287C0 */ _t20 = _t19 & 0x00000001u;
         /* 022287C0 */ if (_t20) goto L_022287C4; else goto L_022287CC;
   L_022287C4: ; // 0x22287c4
@@ -13813,9 +13813,9 @@ void Gambit_fn_0222870C(CPUState* cpu) {
         /* 022287D0 */ _t21 = cpu->r[11] + 0xFFFFD9ECu;
         /* 022287D0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 022287D4 */ cpu->r[12] = 0x101D0000u;
-        /* 022287D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 022287D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 022287DC */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 022287E0 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022287E0 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022287E0 */ _t23 = _t22 & 0x00000001u;
         /* 022287E0 */ if (_t23) goto L_022287E4; else goto L_022287FC;
   L_022287E4: ; // 0x22287e4
@@ -13828,8 +13828,8 @@ void Gambit_fn_0222870C(CPUState* cpu) {
         /* 022287F8 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 022287F8 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_022287FC: ; // 0x22287fc
-        /* 022287FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02228800 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022287FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02228800 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228800 */ _t27 = _t26 & 0x00000001u;
         /* 02228800 */ if (_t27) goto L_02228804; else goto L_0222880C;
   L_02228804: ; // 0x2228804
@@ -13841,9 +13841,9 @@ void Gambit_fn_0222870C(CPUState* cpu) {
         /* 02228810 */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 02228810 */ cpu->r[10] = _t28;
         /* 02228814 */ cpu->r[7] = 0x101D0000u;
-        /* 02228818 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02228818 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0222881C */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 02228820 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228820 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228820 */ _t30 = _t29 & 0x00000001u;
         /* 02228820 */ if (_t30) goto L_02228824; else goto L_02228838;
   L_02228824: ; // 0x2228824
@@ -13855,8 +13855,8 @@ void Gambit_fn_0222870C(CPUState* cpu) {
         /* 02228834 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 02228834 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_02228838: ; // 0x2228838
-        /* 02228838 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 0222883C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228838 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 0222883C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222883C */ _t34 = _t33 & 0x00000001u;
         /* 0222883C */ if (_t34) goto L_02228840; else goto L_02228848;
   L_02228840: ; // 0x2228840
@@ -13868,9 +13868,9 @@ void Gambit_fn_0222870C(CPUState* cpu) {
         /* 0222884C */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 0222884C */ cpu->r[8] = _t35;
         /* 02228850 */ cpu->r[6] = 0x101D0000u;
-        /* 02228854 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02228854 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02228858 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 0222885C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222885C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222885C */ _t37 = _t36 & 0x00000001u;
         /* 0222885C */ if (_t37) goto L_02228860; else goto L_02228874;
   L_02228860: ; // 0x2228860
@@ -13916,20 +13916,20 @@ void Gambit_fn_02228894(CPUState* cpu) {
         /* 022288A8 */ _t3 = cpu->r[1] + 0x00000018u;
         /* 022288A8 */ rbrew_write_f32(cpu->mem, _t3, cpu->f[31]);
         /* 022288AC */ cpu->r[31] = cpu->r[3];
-        /* 022288AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 022288AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 022288B0 */ _t4 = cpu->r[1] + 0x00000008u;
         /* 022288B0 */ rbrew_write32(cpu->mem, _t4, cpu->r[30]);
         /* 022288B4 */ _t5 = cpu->r[1] + 0x00000024u;
         /* 022288B4 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
-        /* 022288B8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022288B8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022288B8 */ _t7 = _t6 & 0x00000001u;
         /* 022288B8 */ if (_t7) goto L_022288BC; else goto L_022288CC;
   L_022288BC: ; // 0x22288bc
         /* 022288BC */ cpu->r[3] = 0x00000128u;
         /* 022288C0 */ Gambit_fn_02801A78(cpu);
         /* 022288C4 */ cpu->r[31] = cpu->r[3];
-        /* 022288C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022288C8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022288C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022288C8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022288C8 */ _t9 = _t8 & 0x00000001u;
         /* 022288C8 */ if (_t9) goto L_022289FC; else goto L_022288CC;
   L_022288CC: ; // 0x22288cc
@@ -13941,17 +13941,17 @@ void Gambit_fn_02228894(CPUState* cpu) {
         /* 022288DC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t10);
         /* 022288E0 */ cpu->r[0] = cpu->r[0] + 0x00000134u;
         /* 022288E4 */ cpu->r[3] = cpu->r[31] + 0x00000084u;
-        /* 022288E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 022288E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 022288E8 */ _t11 = cpu->r[31] + 0x00000004u;
         /* 022288E8 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
-        /* 022288EC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022288EC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022288EC */ _t13 = _t12 & 0x00000001u;
         /* 022288EC */ if (_t13) goto L_022288F0; else goto L_02228900;
   L_022288F0: ; // 0x22288f0
         /* 022288F0 */ cpu->r[3] = 0x00000020u;
         /* 022288F4 */ Gambit_fn_02801A78(cpu);
-        /* 022288F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022288FC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022288F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022288FC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022288FC */ _t15 = _t14 & 0x00000001u;
         /* 022288FC */ if (_t15) goto L_02228944; else goto L_02228900;
   L_02228900: ; // 0x2228900
@@ -13989,8 +13989,8 @@ void Gambit_fn_02228894(CPUState* cpu) {
         /* 02228940 */ rbrew_write32(cpu->mem, _t29, cpu->r[10]);
   L_02228944: ; // 0x2228944
         /* 02228944 */ cpu->r[0] = cpu->r[31] + 0x000000A4u;
-        /* 02228944 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02228948 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228944 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02228948 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228948 */ _t31 = _t30 & 0x00000001u;
         /* 02228948 */ if (_t31) goto L_0222894C; else goto L_02228954;
   L_0222894C: ; // 0x222894c
@@ -14001,10 +14001,10 @@ void Gambit_fn_02228894(CPUState* cpu) {
         /* 02228958 */ Gambit_fn_02043B8C(cpu);
         /* 0222895C */ cpu->r[30] = 0x00000000u;
         /* 02228960 */ cpu->r[10] = cpu->r[31] + 0x000000C4u;
-        /* 02228960 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02228960 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02228964 */ _t32 = cpu->r[31] + 0x000000C0u;
         /* 02228964 */ rbrew_write8(cpu->mem, _t32, (uint8_t)cpu->r[30]);
-        /* 02228968 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228968 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228968 */ _t34 = _t33 & 0x00000001u;
         /* 02228968 */ if (_t34) goto L_0222896C; else goto L_02228974;
   L_0222896C: ; // 0x222896c
@@ -14012,8 +14012,8 @@ void Gambit_fn_02228894(CPUState* cpu) {
         /* 02228970 */ Gambit_fn_02801A78(cpu);
   L_02228974: ; // 0x2228974
         /* 02228974 */ cpu->r[0] = cpu->r[31] + 0x000000D0u;
-        /* 02228974 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02228978 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02228978 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228978 */ _t36 = _t35 & 0x00000001u;
         /* 02228978 */ if (_t36) goto L_0222897C; else goto L_02228984;
   L_0222897C: ; // 0x222897c
@@ -14026,7 +14026,7 @@ void Gambit_fn_02228894(CPUState* cpu) {
         /* 0222898C */ _t38 = cpu->r[31] + 0x000000DCu;
         /* 0222898C */ rbrew_write_f32(cpu->mem, _t38, cpu->f[31]);
         /* 02228990 */ cpu->r[10] = cpu->r[31] + 0x000000F0u;
-        /* 02228990 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02228990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02228994 */ _t39 = cpu->r[31] + 0x000000E4u;
         /* 02228994 */ rbrew_write_f32(cpu->mem, _t39, cpu->f[31]);
         /* 02228998 */ _t40 = cpu->r[12] + 0x00000098u;
@@ -14035,7 +14035,7 @@ void Gambit_fn_02228894(CPUState* cpu) {
         /* 0222899C */ rbrew_write_f32(cpu->mem, _t41, cpu->f[31]);
         /* 022289A0 */ _t42 = cpu->r[31] + 0x000000ECu;
         /* 022289A0 */ rbrew_write_f32(cpu->mem, _t42, cpu->f[0]);
-        /* 022289A4 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022289A4 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022289A4 */ _t44 = _t43 & 0x00000001u;
         /* 022289A4 */ if (_t44) goto L_022289A8; else goto L_022289B0;
   L_022289A8: ; // 0x22289a8
@@ -14043,8 +14043,8 @@ void Gambit_fn_02228894(CPUState* cpu) {
         /* 022289AC */ Gambit_fn_02801A78(cpu);
   L_022289B0: ; // 0x22289b0
         /* 022289B0 */ cpu->r[11] = cpu->r[31] + 0x000000FCu;
-        /* 022289B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 022289B4 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022289B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 022289B4 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022289B4 */ _t46 = _t45 & 0x00000001u;
         /* 022289B4 */ if (_t46) goto L_022289B8; else goto L_022289C0;
   L_022289B8: ; // 0x22289b8
@@ -14052,8 +14052,8 @@ void Gambit_fn_02228894(CPUState* cpu) {
         /* 022289BC */ Gambit_fn_02801A78(cpu);
   L_022289C0: ; // 0x22289c0
         /* 022289C0 */ cpu->r[12] = cpu->r[31] + 0x00000108u;
-        /* 022289C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022289C4 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022289C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022289C4 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022289C4 */ _t48 = _t47 & 0x00000001u;
         /* 022289C4 */ if (_t48) goto L_022289C8; else goto L_022289D0;
   L_022289C8: ; // 0x22289c8
@@ -14072,10 +14072,10 @@ void Gambit_fn_02228894(CPUState* cpu) {
         /* 022289E4 */ _t53 = cpu->r[10] & 0xFFFF8000u;
         /* 022289E4 */ cpu->r[10] = _t53 | _t52;
         /* 022289E8 */ cpu->r[0] = cpu->r[31] + 0x0000011Cu;
-        /* 022289E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 022289E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 022289EC */ _t54 = cpu->r[31] + 0x00000114u;
         /* 022289EC */ rbrew_write32(cpu->mem, _t54, cpu->r[10]);
-        /* 022289F0 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022289F0 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022289F0 */ _t56 = _t55 & 0x00000001u;
         /* 022289F0 */ if (_t56) goto L_022289F4; else goto L_022289FC;
   L_022289F4: ; // 0x22289f4
@@ -14091,7 +14091,7 @@ void Gambit_fn_02228894(CPUState* cpu) {
         /* 02228A08 */ cpu->r[31] = rbrew_read32(cpu->mem, _t59);
         /* 02228A0C */ _t60 = cpu->r[1] + 0x00000010u;
         /* 02228A0C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t60);
-        /* 02228A10 */ _t61 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02228A10 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02228A10 */ _t62 = _t61 & 0x00000001u;
         /* 02228A10 */ if (_t62) goto L_02228A14; // else: addr-0 trap, fall-through
   L_02228A14: ; // 0x2228a14
@@ -14118,20 +14118,20 @@ void Gambit_fn_02228898(CPUState* cpu) {
         /* 022288A8 */ _t3 = cpu->r[1] + 0x00000018u;
         /* 022288A8 */ rbrew_write_f32(cpu->mem, _t3, cpu->f[31]);
         /* 022288AC */ cpu->r[31] = cpu->r[3];
-        /* 022288AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 022288AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 022288B0 */ _t4 = cpu->r[1] + 0x00000008u;
         /* 022288B0 */ rbrew_write32(cpu->mem, _t4, cpu->r[30]);
         /* 022288B4 */ _t5 = cpu->r[1] + 0x00000024u;
         /* 022288B4 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
-        /* 022288B8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022288B8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022288B8 */ _t7 = _t6 & 0x00000001u;
         /* 022288B8 */ if (_t7) goto L_022288BC; else goto L_022288CC;
   L_022288BC: ; // 0x22288bc
         /* 022288BC */ cpu->r[3] = 0x00000128u;
         /* 022288C0 */ Gambit_fn_02801A78(cpu);
         /* 022288C4 */ cpu->r[31] = cpu->r[3];
-        /* 022288C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022288C8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022288C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022288C8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022288C8 */ _t9 = _t8 & 0x00000001u;
         /* 022288C8 */ if (_t9) goto L_022289FC; else goto L_022288CC;
   L_022288CC: ; // 0x22288cc
@@ -14143,17 +14143,17 @@ void Gambit_fn_02228898(CPUState* cpu) {
         /* 022288DC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t10);
         /* 022288E0 */ cpu->r[0] = cpu->r[0] + 0x00000134u;
         /* 022288E4 */ cpu->r[3] = cpu->r[31] + 0x00000084u;
-        /* 022288E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 022288E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 022288E8 */ _t11 = cpu->r[31] + 0x00000004u;
         /* 022288E8 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
-        /* 022288EC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022288EC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022288EC */ _t13 = _t12 & 0x00000001u;
         /* 022288EC */ if (_t13) goto L_022288F0; else goto L_02228900;
   L_022288F0: ; // 0x22288f0
         /* 022288F0 */ cpu->r[3] = 0x00000020u;
         /* 022288F4 */ Gambit_fn_02801A78(cpu);
-        /* 022288F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022288FC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022288F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022288FC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022288FC */ _t15 = _t14 & 0x00000001u;
         /* 022288FC */ if (_t15) goto L_02228944; else goto L_02228900;
   L_02228900: ; // 0x2228900
@@ -14191,8 +14191,8 @@ void Gambit_fn_02228898(CPUState* cpu) {
         /* 02228940 */ rbrew_write32(cpu->mem, _t29, cpu->r[10]);
   L_02228944: ; // 0x2228944
         /* 02228944 */ cpu->r[0] = cpu->r[31] + 0x000000A4u;
-        /* 02228944 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02228948 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228944 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02228948 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228948 */ _t31 = _t30 & 0x00000001u;
         /* 02228948 */ if (_t31) goto L_0222894C; else goto L_02228954;
   L_0222894C: ; // 0x222894c
@@ -14203,10 +14203,10 @@ void Gambit_fn_02228898(CPUState* cpu) {
         /* 02228958 */ Gambit_fn_02043B8C(cpu);
         /* 0222895C */ cpu->r[30] = 0x00000000u;
         /* 02228960 */ cpu->r[10] = cpu->r[31] + 0x000000C4u;
-        /* 02228960 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02228960 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02228964 */ _t32 = cpu->r[31] + 0x000000C0u;
         /* 02228964 */ rbrew_write8(cpu->mem, _t32, (uint8_t)cpu->r[30]);
-        /* 02228968 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228968 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228968 */ _t34 = _t33 & 0x00000001u;
         /* 02228968 */ if (_t34) goto L_0222896C; else goto L_02228974;
   L_0222896C: ; // 0x222896c
@@ -14214,8 +14214,8 @@ void Gambit_fn_02228898(CPUState* cpu) {
         /* 02228970 */ Gambit_fn_02801A78(cpu);
   L_02228974: ; // 0x2228974
         /* 02228974 */ cpu->r[0] = cpu->r[31] + 0x000000D0u;
-        /* 02228974 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02228978 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02228978 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228978 */ _t36 = _t35 & 0x00000001u;
         /* 02228978 */ if (_t36) goto L_0222897C; else goto L_02228984;
   L_0222897C: ; // 0x222897c
@@ -14228,7 +14228,7 @@ void Gambit_fn_02228898(CPUState* cpu) {
         /* 0222898C */ _t38 = cpu->r[31] + 0x000000DCu;
         /* 0222898C */ rbrew_write_f32(cpu->mem, _t38, cpu->f[31]);
         /* 02228990 */ cpu->r[10] = cpu->r[31] + 0x000000F0u;
-        /* 02228990 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02228990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02228994 */ _t39 = cpu->r[31] + 0x000000E4u;
         /* 02228994 */ rbrew_write_f32(cpu->mem, _t39, cpu->f[31]);
         /* 02228998 */ _t40 = cpu->r[12] + 0x00000098u;
@@ -14237,7 +14237,7 @@ void Gambit_fn_02228898(CPUState* cpu) {
         /* 0222899C */ rbrew_write_f32(cpu->mem, _t41, cpu->f[31]);
         /* 022289A0 */ _t42 = cpu->r[31] + 0x000000ECu;
         /* 022289A0 */ rbrew_write_f32(cpu->mem, _t42, cpu->f[0]);
-        /* 022289A4 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022289A4 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022289A4 */ _t44 = _t43 & 0x00000001u;
         /* 022289A4 */ if (_t44) goto L_022289A8; else goto L_022289B0;
   L_022289A8: ; // 0x22289a8
@@ -14245,8 +14245,8 @@ void Gambit_fn_02228898(CPUState* cpu) {
         /* 022289AC */ Gambit_fn_02801A78(cpu);
   L_022289B0: ; // 0x22289b0
         /* 022289B0 */ cpu->r[11] = cpu->r[31] + 0x000000FCu;
-        /* 022289B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 022289B4 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022289B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 022289B4 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022289B4 */ _t46 = _t45 & 0x00000001u;
         /* 022289B4 */ if (_t46) goto L_022289B8; else goto L_022289C0;
   L_022289B8: ; // 0x22289b8
@@ -14254,8 +14254,8 @@ void Gambit_fn_02228898(CPUState* cpu) {
         /* 022289BC */ Gambit_fn_02801A78(cpu);
   L_022289C0: ; // 0x22289c0
         /* 022289C0 */ cpu->r[12] = cpu->r[31] + 0x00000108u;
-        /* 022289C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022289C4 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022289C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022289C4 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022289C4 */ _t48 = _t47 & 0x00000001u;
         /* 022289C4 */ if (_t48) goto L_022289C8; else goto L_022289D0;
   L_022289C8: ; // 0x22289c8
@@ -14274,10 +14274,10 @@ void Gambit_fn_02228898(CPUState* cpu) {
         /* 022289E4 */ _t53 = cpu->r[10] & 0xFFFF8000u;
         /* 022289E4 */ cpu->r[10] = _t53 | _t52;
         /* 022289E8 */ cpu->r[0] = cpu->r[31] + 0x0000011Cu;
-        /* 022289E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 022289E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 022289EC */ _t54 = cpu->r[31] + 0x00000114u;
         /* 022289EC */ rbrew_write32(cpu->mem, _t54, cpu->r[10]);
-        /* 022289F0 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022289F0 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022289F0 */ _t56 = _t55 & 0x00000001u;
         /* 022289F0 */ if (_t56) goto L_022289F4; else goto L_022289FC;
   L_022289F4: ; // 0x22289f4
@@ -14293,7 +14293,7 @@ void Gambit_fn_02228898(CPUState* cpu) {
         /* 02228A08 */ cpu->r[31] = rbrew_read32(cpu->mem, _t59);
         /* 02228A0C */ _t60 = cpu->r[1] + 0x00000010u;
         /* 02228A0C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t60);
-        /* 02228A10 */ _t61 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02228A10 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02228A10 */ _t62 = _t61 & 0x00000001u;
         /* 02228A10 */ if (_t62) goto L_02228A14; // else: addr-0 trap, fall-through
   L_02228A14: ; // 0x2228a14
@@ -14388,10 +14388,10 @@ void Gambit_fn_02228A24(CPUState* cpu) {
         /* 02228AD8 */ rbrew_write_f32(cpu->mem, _t28, cpu->f[10]);
         /* 02228ADC */ _t29 = cpu->r[9] + 0x000000A0u;
         /* 02228ADC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t29);
-        /* 02228AE0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[29]);
+        /* 02228AE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[29]));
         /* 02228AE4 */ _t30 = cpu->r[31] + 0x00000008u;
         /* 02228AE4 */ rbrew_write_f32(cpu->mem, _t30, cpu->f[12]);
-        /* 02228AE8 */ _t31 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02228AE8 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02228AE8 */ _t32 = _t31 & 0x00000001u;
         /* 02228AE8 */ if (_t32) goto L_02228AEC; else goto L_02228B1C;
   L_02228AEC: ; // 0x2228aec
@@ -14415,8 +14415,8 @@ void Gambit_fn_02228A24(CPUState* cpu) {
         /* 02228B1C */ cpu->r[7] = 0x10050000u;
         /* 02228B20 */ _t37 = cpu->r[7] + 0x000000A8u;
         /* 02228B20 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t37);
-        /* 02228B24 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[0]);
-        /* 02228B28 */ _t38 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02228B24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[0]));
+        /* 02228B28 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02228B28 */ _t39 = _t38 & 0x00000001u;
         /* 02228B28 */ if (_t39) goto L_02228B2C; else goto L_02228BF0;
   L_02228B2C: ; // 0x2228b2c
@@ -14450,10 +14450,10 @@ void Gambit_fn_02228A24(CPUState* cpu) {
         /* 02228B70 */ rbrew_write_f32(cpu->mem, _t49, cpu->f[13]);
         /* 02228B74 */ _t50 = cpu->r[30] + 0x00000004u;
         /* 02228B74 */ rbrew_write_f32(cpu->mem, _t50, cpu->f[8]);
-        /* 02228B78 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[29]);
+        /* 02228B78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[29]));
         /* 02228B7C */ _t51 = cpu->r[30] + 0x00000000u;
         /* 02228B7C */ rbrew_write_f32(cpu->mem, _t51, cpu->f[0]);
-        /* 02228B80 */ _t52 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02228B80 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02228B80 */ _t53 = _t52 & 0x00000001u;
         /* 02228B80 */ if (_t53) goto L_02228B84; else goto L_02228BB0;
   L_02228B84: ; // 0x2228b84
@@ -14546,7 +14546,7 @@ void Gambit_fn_02228A24(CPUState* cpu) {
         /* 02228C48 */ cpu->r[31] = rbrew_read32(cpu->mem, _t88);
         /* 02228C4C */ _t89 = cpu->r[1] + 0x00000060u;
         /* 02228C4C */ cpu->r[30] = rbrew_read32(cpu->mem, _t89);
-        /* 02228C50 */ _t90 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02228C50 */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02228C50 */ _t91 = _t90 & 0x00000001u;
         /* 02228C50 */ if (_t91) goto L_02228C54; // else: addr-0 trap, fall-through
   L_02228C54: ; // 0x2228c54
@@ -14603,19 +14603,19 @@ void Gambit_fn_02228C64(CPUState* cpu) {
         /* 02228CC8 */ cpu->r[21] = cpu->r[8];
         /* 02228CCC */ _t11 = cpu->r[1] + 0x00000217u;
         /* 02228CCC */ cpu->r[31] = rbrew_read8(cpu->mem, _t11);
-        /* 02228CD0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[31]);
+        /* 02228CD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[31]));
         /* 02228CD4 */ _t12 = cpu->r[1] + 0x00000218u;
         /* 02228CD4 */ cpu->r[24] = rbrew_read32(cpu->mem, _t12);
         /* 02228CD8 */ cpu->r[23] = cpu->r[10];
         /* 02228CDC */ _t13 = cpu->r[1] + 0x00000210u;
         /* 02228CDC */ cpu->r[22] = rbrew_read32(cpu->mem, _t13);
         /* 02228CE0 */ /* nop */
-        /* 02228CE4 */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02228CE4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02228CE4 */ _t15 = _t14 & 0x00000001u;
         /* 02228CE4 */ if (_t15) goto L_02228CE8; else goto L_02229488;
   L_02228CE8: ; // 0x2228ce8
-        /* 02228CE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 02228CEC */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228CE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 02228CEC */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228CEC */ _t17 = _t16 & 0x00000001u;
         /* 02228CEC */ if (_t17) goto L_02228D98; else goto L_02228CF0;
   L_02228CF0: ; // 0x2228cf0
@@ -14676,8 +14676,8 @@ void Gambit_fn_02228C64(CPUState* cpu) {
         /* 02228D84 */ cpu->r[4] = cpu->r[8];
         /* 02228D88 */ cpu->r[3] = cpu->r[25];
         /* 02228D8C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02228D90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02228D94 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228D90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02228D94 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228D94 */ _t36 = _t35 & 0x00000001u;
         /* 02228D94 */ if (_t36) goto L_02228D98; else goto L_02229488;
   L_02228D98: ; // 0x2228d98
@@ -14688,8 +14688,8 @@ void Gambit_fn_02228C64(CPUState* cpu) {
         /* 02228DA0 */ cpu->ctr = cpu->r[11];
         /* 02228DA4 */ cpu->r[3] = cpu->r[25];
         /* 02228DA8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02228DAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02228DB0 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228DAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02228DB0 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228DB0 */ _t40 = _t39 & 0x00000001u;
         /* 02228DB0 */ if (_t40) goto L_02228DB4; else goto L_02229488;
   L_02228DB4: ; // 0x2228db4
@@ -14739,13 +14739,13 @@ void Gambit_fn_02228C64(CPUState* cpu) {
         /* 02228E24 */ cpu->r[5] = rbrew_read32(cpu->mem, _t54);
         /* 02228E28 */ _t55 = cpu->r[1] + 0x00000020u;
         /* 02228E28 */ rbrew_write32(cpu->mem, _t55, cpu->r[4]);
-        /* 02228E2C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], 0x000000FDu);
+        /* 02228E2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], 0x000000FDu));
         /* 02228E30 */ _t56 = cpu->r[1] + 0x00000024u;
         /* 02228E30 */ rbrew_write32(cpu->mem, _t56, cpu->r[5]);
         /* 02228E34 */ cpu->r[21] = 0x00000000u;
         /* 02228E38 */ _t57 = cpu->r[1] + 0x00000028u;
         /* 02228E38 */ rbrew_write32(cpu->mem, _t57, cpu->r[6]);
-        /* 02228E3C */ _t58 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02228E3C */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02228E3C */ _t59 = _t58 & 0x00000001u;
         /* 02228E3C */ if (_t59) goto L_02228E40; else goto L_02228FF0;
   L_02228E40: ; // 0x2228e40
@@ -14756,8 +14756,8 @@ void Gambit_fn_02228C64(CPUState* cpu) {
         /* 02228E48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t61);
         /* 02228E4C */ cpu->r[4] = cpu->r[29];
         /* 02228E50 */ Gambit_fn_023E43BC(cpu);
-        /* 02228E54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02228E58 */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02228E54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02228E58 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02228E58 */ _t63 = _t62 & 0x00000001u;
         /* 02228E58 */ if (_t63) goto L_02228E5C; else goto L_02228EB0;
   L_02228E5C: ; // 0x2228e5c
@@ -14929,10 +14929,10 @@ void Gambit_fn_02228C64(CPUState* cpu) {
         /* 02229010 */ cpu->r[8] = 0x10050000u;
         /* 02229014 */ _t118 = cpu->r[9] + 0x000000A4u;
         /* 02229014 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t118);
-        /* 02229018 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
+        /* 02229018 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
         /* 0222901C */ _t119 = cpu->r[8] + 0x000000A0u;
         /* 0222901C */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t119);
-        /* 02229020 */ _t120 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229020 */ _t120 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02229020 */ _t121 = _t120 & 0x00000001u;
         /* 02229020 */ if (_t121) goto L_02229180; else goto L_02229024;
   L_02229024: ; // 0x2229024
@@ -14943,8 +14943,8 @@ void Gambit_fn_02228C64(CPUState* cpu) {
         /* 0222902C */ cpu->ctr = cpu->r[0];
         /* 02229030 */ cpu->r[3] = cpu->r[25];
         /* 02229034 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02229038 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222903C */ _t124 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229038 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222903C */ _t124 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222903C */ _t125 = _t124 & 0x00000001u;
         /* 0222903C */ if (_t125) goto L_02229180; else goto L_02229040;
   L_02229040: ; // 0x2229040
@@ -15006,24 +15006,24 @@ void Gambit_fn_02228C64(CPUState* cpu) {
         /* 022290EC */ cpu->f[12] = fma(cpu->f[9], cpu->f[3], cpu->f[8]);
         /* 022290F0 */ _t138 = cpu->r[1] + 0x0000002Cu;
         /* 022290F0 */ rbrew_write_f32(cpu->mem, _t138, cpu->f[10]);
-        /* 022290F4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[5], cpu->f[31]);
+        /* 022290F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[5], cpu->f[31]));
         /* 022290F8 */ _t139 = cpu->r[1] + 0x00000030u;
         /* 022290F8 */ rbrew_write_f32(cpu->mem, _t139, cpu->f[7]);
         /* 022290FC */ _t140 = cpu->r[1] + 0x00000034u;
         /* 022290FC */ rbrew_write_f32(cpu->mem, _t140, cpu->f[12]);
-        /* 02229100 */ _t141 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02229100 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02229100 */ _t142 = _t141 & 0x00000001u;
         /* 02229100 */ if (_t142) goto L_02229124; else goto L_02229104;
   L_02229104: ; // 0x2229104
         /* 02229104 */ cpu->f[11] = cpu->f[12] * cpu->f[12];
         /* 02229108 */ cpu->f[7] = fma(cpu->f[10], cpu->f[10], cpu->f[11]);
-        /* 0222910C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[31]);
+        /* 0222910C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[31]));
         /* 02229110 */ _t143 = cpu->r[1] + 0x00000018u;
         /* 02229110 */ rbrew_write_f32(cpu->mem, _t143, cpu->f[10]);
         /* 02229114 */ cpu->f[8] = cpu->f[31] * cpu->f[5];
         /* 02229118 */ _t144 = cpu->r[1] + 0x0000001Cu;
         /* 02229118 */ rbrew_write_f32(cpu->mem, _t144, cpu->f[12]);
-        /* 0222911C */ _t145 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222911C */ _t145 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222911C */ _t146 = _t145 & 0x00000001u;
         /* 0222911C */ if (_t146) goto L_02229120; else goto L_02229180;
   L_02229120: ; // 0x2229120
@@ -15042,13 +15042,13 @@ void Gambit_fn_02228C64(CPUState* cpu) {
         /* 0222913C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t150);
         /* 02229140 */ cpu->f[11] = cpu->f[12] * cpu->f[12];
         /* 02229144 */ cpu->f[7] = fma(cpu->f[10], cpu->f[10], cpu->f[11]);
-        /* 02229148 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[31]);
+        /* 02229148 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[31]));
         /* 0222914C */ _t151 = cpu->r[1] + 0x0000001Cu;
         /* 0222914C */ rbrew_write_f32(cpu->mem, _t151, cpu->f[12]);
         /* 02229150 */ cpu->f[8] = cpu->f[0] * cpu->f[5];
         /* 02229154 */ _t152 = cpu->r[1] + 0x00000018u;
         /* 02229154 */ rbrew_write_f32(cpu->mem, _t152, cpu->f[10]);
-        /* 02229158 */ _t153 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02229158 */ _t153 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02229158 */ _t154 = _t153 & 0x00000001u;
         /* 02229158 */ if (_t154) goto L_0222915C; else goto L_02229180;
   L_0222915C: ; // 0x222915c
@@ -15071,8 +15071,8 @@ void Gambit_fn_02228C64(CPUState* cpu) {
         /* 02229188 */ cpu->ctr = cpu->r[0];
         /* 0222918C */ cpu->r[3] = cpu->r[25];
         /* 02229190 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02229194 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02229198 */ _t159 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229194 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02229198 */ _t159 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02229198 */ _t160 = _t159 & 0x00000001u;
         /* 02229198 */ if (_t160) goto L_0222919C; else goto L_0222934C;
   L_0222919C: ; // 0x222919c
@@ -15084,8 +15084,8 @@ void Gambit_fn_02228C64(CPUState* cpu) {
         /* 022291AC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t161);
         /* 022291B0 */ _t162 = cpu->r[1] + 0x00000108u;
         /* 022291B0 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t162);
-        /* 022291B4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[6]);
-        /* 022291B8 */ _t163 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022291B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[6]));
+        /* 022291B8 */ _t163 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022291B8 */ _t164 = _t163 & 0x00000001u;
         /* 022291B8 */ if (_t164) goto L_022291BC; else goto L_0222934C;
   L_022291BC: ; // 0x22291bc
@@ -15165,8 +15165,8 @@ void Gambit_fn_02228C64(CPUState* cpu) {
         /* 0222926C */ _t194 = cpu->r[1] + 0x00000060u;
         /* 0222926C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t194);
         /* 02229270 */ cpu->f[10] = fma(cpu->f[0], cpu->f[0], cpu->f[10]);
-        /* 02229274 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
-        /* 02229278 */ _t195 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02229274 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
+        /* 02229278 */ _t195 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02229278 */ _t196 = _t195 & 0x00000001u;
         /* 02229278 */ if (_t196) goto L_022292D4; else goto L_0222927C;
   L_0222927C: ; // 0x222927c
@@ -15261,8 +15261,8 @@ void Gambit_fn_02228C64(CPUState* cpu) {
   L_0222936C: ; // 0x222936c
         /* 0222936C */ /* nop */
         /* 02229370 */ cpu->r[10] = cpu->r[23] & cpu->r[9];
-        /* 02229370 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02229374 */ _t223 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229370 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02229374 */ _t223 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02229374 */ _t224 = _t223 & 0x00000001u;
         /* 02229374 */ if (_t224) goto L_0222947C; else goto L_02229378;
   L_02229378: ; // 0x2229378
@@ -15283,8 +15283,8 @@ void Gambit_fn_02228C64(CPUState* cpu) {
         /* 02229398 */ cpu->r[16] = 0xFFFFFFFFu;
         /* 0222939C */ cpu->r[3] = cpu->r[25];
         /* 022293A0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 022293A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022293A8 */ _t231 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022293A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022293A8 */ _t231 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022293A8 */ _t232 = _t231 & 0x00000001u;
         /* 022293A8 */ if (_t232) goto L_022293B0; else goto L_022293AC;
   L_022293AC: ; // 0x22293ac
@@ -15340,10 +15340,10 @@ void Gambit_fn_02228C64(CPUState* cpu) {
         /* 02229428 */ _t250 = cpu->r[25] + 0x00000004u;
         /* 02229428 */ cpu->r[4] = rbrew_read32(cpu->mem, _t250);
         /* 0222942C */ cpu->r[16] = 0x00000000u;
-        /* 02229430 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], cpu->r[0]);
+        /* 02229430 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], cpu->r[0]));
         /* 02229434 */ _t251 = cpu->r[4] + 0x00000414u;
         /* 02229434 */ cpu->r[0] = rbrew_read32(cpu->mem, _t251);
-        /* 02229438 */ _t252 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02229438 */ _t252 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02229438 */ _t253 = _t252 & 0x00000001u;
         /* 02229438 */ if (_t253) goto L_0222943C; else goto L_02229444;
   L_0222943C: ; // 0x222943c
@@ -15363,8 +15363,8 @@ void Gambit_fn_02228C64(CPUState* cpu) {
         /* 02229460 */ cpu->r[7] = rbrew_read32(cpu->mem, _t256);
         /* 02229464 */ _t257 = cpu->r[7] + 0x00000044u;
         /* 02229464 */ cpu->r[0] = rbrew_read8(cpu->mem, _t257);
-        /* 02229468 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222946C */ _t258 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229468 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222946C */ _t258 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222946C */ _t259 = _t258 & 0x00000001u;
         /* 0222946C */ if (_t259) goto L_0222947C; else goto L_02229470;
   L_02229470: ; // 0x2229470
@@ -15374,9 +15374,9 @@ void Gambit_fn_02228C64(CPUState* cpu) {
         /* 02229478 */ Gambit_fn_023EED38(cpu);
   L_0222947C: ; // 0x222947c
         /* 0222947C */ cpu->r[18] = cpu->r[18] + 0xFFFFFFFFu;
-        /* 0222947C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[18], 0x00000000u);
+        /* 0222947C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[18], 0x00000000u));
         /* 02229480 */ cpu->r[17] = cpu->r[17] + 0x00000001u;
-        /* 02229484 */ _t261 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229484 */ _t261 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02229484 */ _t262 = _t261 & 0x00000001u;
         /* 02229484 */ if (_t262) goto L_02229488; else goto L_0222936C;
   L_02229488: ; // 0x2229488
@@ -15397,7 +15397,7 @@ void Gambit_fn_02228C64(CPUState* cpu) {
         /* 022294A4 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t269);
         /* 022294A8 */ _t270 = cpu->r[1] + 0x000001F8u;
         /* 022294A8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t270);
-        /* 022294AC */ _t271 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022294AC */ _t271 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022294AC */ _t272 = _t271 & 0x00000001u;
         /* 022294AC */ if (_t272) goto L_022294B0; // else: addr-0 trap, fall-through
   L_022294B0: ; // 0x22294b0
@@ -15457,8 +15457,8 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229520 */ cpu->r[11] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
         /* 02229524 */ cpu->r[3] = rbrew_rlwinm(cpu->r[12], 0x0000000Du, 0x0000001Fu, 0x0000001Fu);
         /* 02229528 */ cpu->r[7] = cpu->r[11] | cpu->r[3];
-        /* 02229528 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0222952C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229528 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0222952C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222952C */ _t16 = _t15 & 0x00000001u;
         /* 0222952C */ if (_t16) goto L_02229530; else goto L_02229578;
   L_02229530: ; // 0x2229530
@@ -15487,7 +15487,7 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 0222955C */ cpu->f[26] = rbrew_read_f64(cpu->mem, _t27);
         /* 02229560 */ _t28 = cpu->r[1] + 0x000001B0u;
         /* 02229560 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t28);
-        /* 02229564 */ _t29 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02229564 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02229564 */ _t30 = _t29 & 0x00000001u;
         /* 02229564 */ if (_t30) goto L_02229568; // else: addr-0 trap, fall-through
   L_02229568: ; // 0x2229568
@@ -15500,11 +15500,11 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229578 */ cpu->r[9] = 0x10050000u;
         /* 0222957C */ _t32 = cpu->r[29] + 0x000000B4u;
         /* 0222957C */ cpu->r[28] = rbrew_read32(cpu->mem, _t32);
-        /* 02229580 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02229580 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02229584 */ cpu->r[30] = 0x00000000u;
         /* 02229588 */ _t33 = cpu->r[9] + 0x0000009Cu;
         /* 02229588 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t33);
-        /* 0222958C */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222958C */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222958C */ _t35 = _t34 & 0x00000001u;
         /* 0222958C */ if (_t35) goto L_02229CBC; else goto L_02229590;
   L_02229590: ; // 0x2229590
@@ -15513,12 +15513,12 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229594 */ _t37 = cpu->r[4] + 0x00000008u;
         /* 02229594 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t37);
         /* 02229598 */ cpu->r[11] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000004u, 0x00000004u);
-        /* 02229598 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02229598 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0222959C */ _t38 = cpu->r[5] + 0x00000008u;
         /* 0222959C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t38);
         /* 022295A0 */ /* nop */
         /* 022295A4 */ /* nop */
-        /* 022295A8 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022295A8 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022295A8 */ _t40 = _t39 & 0x00000001u;
         /* 022295A8 */ if (_t40) goto L_022295D0; else goto L_022295AC;
   L_022295AC: ; // 0x22295ac
@@ -15532,8 +15532,8 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 022295C0 */ _t43 = cpu->r[28] + 0x0000015Cu;
         /* 022295C0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t43);
         /* 022295C4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 022295C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022295C8 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022295C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022295C8 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022295C8 */ _t45 = _t44 & 0x00000001u;
         /* 022295C8 */ if (_t45) goto L_02229624; else goto L_022295CC;
   L_022295CC: ; // 0x22295cc
@@ -15547,8 +15547,8 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 022295E0 */ _t47 = cpu->r[28] + 0x0000015Cu;
         /* 022295E0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t47);
         /* 022295E4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 022295E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022295E8 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022295E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022295E8 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022295E8 */ _t49 = _t48 & 0x00000001u;
         /* 022295E8 */ if (_t49) goto L_02229624; else goto L_022295EC;
   L_022295EC: ; // 0x22295ec
@@ -15570,9 +15570,9 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229610 */ _t56 = cpu->r[28] + 0x0000015Cu;
         /* 02229610 */ cpu->r[12] = rbrew_read32(cpu->mem, _t56);
         /* 02229614 */ cpu->r[11] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 02229614 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02229614 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02229618 */ cpu->r[26] = 0x00000000u;
-        /* 0222961C */ _t57 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222961C */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222961C */ _t58 = _t57 & 0x00000001u;
         /* 0222961C */ if (_t58) goto L_02229694; else goto L_02229620;
   L_02229620: ; // 0x2229620
@@ -15596,9 +15596,9 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229648 */ _t65 = cpu->r[28] + 0x0000015Cu;
         /* 02229648 */ cpu->r[12] = rbrew_read32(cpu->mem, _t65);
         /* 0222964C */ cpu->r[11] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 0222964C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0222964C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02229650 */ cpu->r[26] = 0x00000000u;
-        /* 02229654 */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229654 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02229654 */ _t67 = _t66 & 0x00000001u;
         /* 02229654 */ if (_t67) goto L_02229694; else goto L_02229658;
   L_02229658: ; // 0x2229658
@@ -15618,8 +15618,8 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 0222967C */ cpu->r[4] = cpu->r[29] + 0x00000108u;
         /* 02229680 */ cpu->r[3] = cpu->r[29];
         /* 02229684 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02229688 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222968C */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229688 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222968C */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222968C */ _t73 = _t72 & 0x00000001u;
         /* 0222968C */ if (_t73) goto L_02229694; else goto L_02229690;
   L_02229690: ; // 0x2229690
@@ -15632,29 +15632,29 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 0222969C */ cpu->ctr = cpu->r[10];
         /* 022296A0 */ cpu->r[3] = cpu->r[29];
         /* 022296A4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 022296A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 022296A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 022296AC */ _t76 = cpu->r[28] + 0x0000015Cu;
         /* 022296AC */ cpu->r[0] = rbrew_read32(cpu->mem, _t76);
-        /* 022296B0 */ _t77 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022296B0 */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022296B0 */ _t78 = _t77 & 0x00000001u;
         /* 022296B0 */ if (_t78) goto L_022296B4; else goto L_022296BC;
   L_022296B4: ; // 0x22296b4
         /* 022296B4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 022296B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022296B8 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022296B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022296B8 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022296B8 */ _t80 = _t79 & 0x00000001u;
         /* 022296B8 */ if (_t80) goto L_022296BC; else goto L_02229A7C;
   L_022296BC: ; // 0x22296bc
         /* 022296BC */ cpu->r[5] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 022296BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 022296C0 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022296BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 022296C0 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022296C0 */ _t82 = _t81 & 0x00000001u;
         /* 022296C0 */ if (_t82) goto L_02229A7C; else goto L_022296C4;
   L_022296C4: ; // 0x22296c4
         /* 022296C4 */ _t83 = cpu->r[29] + 0x00000051u;
         /* 022296C4 */ cpu->r[7] = rbrew_read8(cpu->mem, _t83);
-        /* 022296C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 022296CC */ _t84 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022296C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 022296CC */ _t84 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022296CC */ _t85 = _t84 & 0x00000001u;
         /* 022296CC */ if (_t85) goto L_022297DC; else goto L_022296D0;
   L_022296D0: ; // 0x22296d0
@@ -15666,8 +15666,8 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 022296DC */ cpu->r[3] = cpu->r[29];
         /* 022296E0 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 022296E4 */ cpu->f[29] = cpu->f[1];
-        /* 022296E8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[31]);
-        /* 022296EC */ _t88 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022296E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[31]));
+        /* 022296EC */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022296EC */ _t89 = _t88 & 0x00000001u;
         /* 022296EC */ if (_t89) goto L_022296F0; else goto L_022297DC;
   L_022296F0: ; // 0x22296f0
@@ -15680,9 +15680,9 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229700 */ cpu->r[11] = rbrew_rlwinm(cpu->r[12], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 02229704 */ _t92 = cpu->r[11] + cpu->r[0];
         /* 02229704 */ cpu->r[27] = rbrew_read32(cpu->mem, _t92);
-        /* 02229708 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02229708 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0222970C */ cpu->r[25] = 0x00000000u;
-        /* 02229710 */ _t93 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02229710 */ _t93 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02229710 */ _t94 = _t93 & 0x00000001u;
         /* 02229710 */ if (_t94) goto L_02229714; else goto L_022297DC;
   L_02229714: ; // 0x2229714
@@ -15700,8 +15700,8 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 0222973C */ Gambit_fn_02040F70(cpu);
         /* 02229740 */ _t95 = cpu->r[1] + 0x00000018u;
         /* 02229740 */ cpu->r[11] = rbrew_read32(cpu->mem, _t95);
-        /* 02229744 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000001u);
-        /* 02229748 */ _t96 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229744 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000001u));
+        /* 02229748 */ _t96 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02229748 */ _t97 = _t96 & 0x00000001u;
         /* 02229748 */ if (_t97) goto L_0222974C; else goto L_022297D0;
   L_0222974C: ; // 0x222974c
@@ -15760,9 +15760,9 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 022297CC */ Gambit_fn_02228C64(cpu);
   L_022297D0: ; // 0x22297d0
         /* 022297D0 */ cpu->r[27] = cpu->r[27] + 0xFFFFFFFFu;
-        /* 022297D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 022297D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 022297D4 */ cpu->r[25] = cpu->r[25] + 0x00000001u;
-        /* 022297D8 */ _t118 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022297D8 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022297D8 */ _t119 = _t118 & 0x00000001u;
         /* 022297D8 */ if (_t119) goto L_022297DC; else goto L_0222971C;
   L_022297DC: ; // 0x22297dc
@@ -15777,9 +15777,9 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 022297F0 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t122);
         /* 022297F4 */ _t123 = cpu->r[29] + 0x00000004u;
         /* 022297F4 */ cpu->r[4] = rbrew_read32(cpu->mem, _t123);
-        /* 022297F8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[10]);
+        /* 022297F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[10]));
         /* 022297FC */ cpu->r[4] = cpu->r[4] + 0x00000360u;
-        /* 02229800 */ _t124 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229800 */ _t124 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02229800 */ _t125 = _t124 & 0x00000001u;
         /* 02229800 */ if (_t125) goto L_02229828; else goto L_02229804;
   L_02229804: ; // 0x2229804
@@ -15788,7 +15788,7 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229808 */ _t127 = cpu->r[28] + 0x00000038u;
         /* 02229808 */ rbrew_write_f32(cpu->mem, _t127, cpu->f[31]);
         /* 0222980C */ cpu->r[8] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 0222980C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0222980C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02229810 */ _t128 = cpu->r[28] + 0x0000003Cu;
         /* 02229810 */ rbrew_write_f32(cpu->mem, _t128, cpu->f[31]);
         /* 02229814 */ _t129 = cpu->r[28] + 0x00000034u;
@@ -15796,7 +15796,7 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229818 */ cpu->r[12] = cpu->r[28] + 0x00000034u;
         /* 0222981C */ _t130 = cpu->r[28] + 0x00000040u;
         /* 0222981C */ rbrew_write_f32(cpu->mem, _t130, cpu->f[31]);
-        /* 02229820 */ _t131 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229820 */ _t131 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02229820 */ _t132 = _t131 & 0x00000001u;
         /* 02229820 */ if (_t132) goto L_02229824; else goto L_022298AC;
   L_02229824: ; // 0x2229824
@@ -15805,8 +15805,8 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229828 */ _t133 = cpu->r[28] + 0x00000000u;
         /* 02229828 */ cpu->r[0] = rbrew_read32(cpu->mem, _t133);
         /* 0222982C */ cpu->r[5] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Bu, 0x0000001Cu);
-        /* 0222982C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 02229830 */ _t134 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222982C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 02229830 */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02229830 */ _t135 = _t134 & 0x00000001u;
         /* 02229830 */ if (_t135) goto L_02229834; else goto L_02229890;
   L_02229834: ; // 0x2229834
@@ -15840,8 +15840,8 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229878 */ cpu->r[3] = cpu->r[29];
         /* 0222987C */ cpu->r[5] = cpu->r[28];
         /* 02229880 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02229884 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02229888 */ _t146 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229884 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02229888 */ _t146 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02229888 */ _t147 = _t146 & 0x00000001u;
         /* 02229888 */ if (_t147) goto L_02229A7C; else goto L_0222988C;
   L_0222988C: ; // 0x222988c
@@ -15852,13 +15852,13 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229894 */ _t149 = cpu->r[28] + 0x00000038u;
         /* 02229894 */ rbrew_write_f32(cpu->mem, _t149, cpu->f[31]);
         /* 02229898 */ cpu->r[8] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 02229898 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02229898 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0222989C */ _t150 = cpu->r[28] + 0x00000034u;
         /* 0222989C */ rbrew_write_f32(cpu->mem, _t150, cpu->f[31]);
         /* 022298A0 */ cpu->r[12] = cpu->r[28] + 0x00000034u;
         /* 022298A4 */ _t151 = cpu->r[28] + 0x0000003Cu;
         /* 022298A4 */ rbrew_write_f32(cpu->mem, _t151, cpu->f[31]);
-        /* 022298A8 */ _t152 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022298A8 */ _t152 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022298A8 */ _t153 = _t152 & 0x00000001u;
         /* 022298A8 */ if (_t153) goto L_022298D0; else goto L_022298AC;
   L_022298AC: ; // 0x22298ac
@@ -15877,8 +15877,8 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 022298CC */ cpu->r[0] = rbrew_read32(cpu->mem, _t157);
   L_022298D0: ; // 0x22298d0
         /* 022298D0 */ cpu->r[10] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Bu, 0x0000001Bu);
-        /* 022298D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 022298D4 */ _t158 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022298D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 022298D4 */ _t158 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022298D4 */ _t159 = _t158 & 0x00000001u;
         /* 022298D4 */ if (_t159) goto L_02229A1C; else goto L_022298D8;
   L_022298D8: ; // 0x22298d8
@@ -15886,12 +15886,12 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 022298D8 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t160);
         /* 022298DC */ _t161 = cpu->r[28] + 0x00000040u;
         /* 022298DC */ cpu->f[4] = rbrew_read_f32(cpu->mem, _t161);
-        /* 022298E0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
+        /* 022298E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
         /* 022298E4 */ _t162 = cpu->r[28] + 0x0000001Cu;
         /* 022298E4 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t162);
         /* 022298E8 */ _t163 = cpu->r[28] + 0x00000028u;
         /* 022298E8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t163);
-        /* 022298EC */ _t164 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022298EC */ _t164 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022298EC */ _t165 = _t164 & 0x00000001u;
         /* 022298EC */ if (_t165) goto L_022298F0; else goto L_02229914;
   L_022298F0: ; // 0x22298f0
@@ -15899,20 +15899,20 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 022298F4 */ /* nop */
         /* 022298F8 */ _t166 = cpu->r[12] + 0x00000004u;
         /* 022298F8 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t166);
-        /* 022298FC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
+        /* 022298FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
         /* 02229900 */ _t167 = cpu->r[28] + 0x00000020u;
         /* 02229900 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t167);
         /* 02229904 */ cpu->f[5] = fma(cpu->f[12], cpu->f[4], cpu->f[13]);
         /* 02229908 */ _t168 = cpu->r[28] + 0x0000002Cu;
         /* 02229908 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t168);
-        /* 0222990C */ _t169 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222990C */ _t169 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222990C */ _t170 = _t169 & 0x00000001u;
         /* 0222990C */ if (_t170) goto L_02229910; else goto L_0222997C;
   L_02229910: ; // 0x2229910
         /* 02229910 */ goto L_02229958;
   L_02229914: ; // 0x2229914
-        /* 02229914 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
-        /* 02229918 */ _t171 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02229914 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
+        /* 02229918 */ _t171 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02229918 */ _t172 = _t171 & 0x00000001u;
         /* 02229918 */ if (_t172) goto L_0222991C; else goto L_02229940;
   L_0222991C: ; // 0x222991c
@@ -15920,13 +15920,13 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229920 */ _t173 = cpu->r[12] + 0x00000004u;
         /* 02229920 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t173);
         /* 02229924 */ /* nop */
-        /* 02229928 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
+        /* 02229928 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
         /* 0222992C */ _t174 = cpu->r[28] + 0x00000020u;
         /* 0222992C */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t174);
         /* 02229930 */ cpu->f[5] = fma(cpu->f[13], cpu->f[4], cpu->f[10]);
         /* 02229934 */ _t175 = cpu->r[28] + 0x0000002Cu;
         /* 02229934 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t175);
-        /* 02229938 */ _t176 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02229938 */ _t176 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02229938 */ _t177 = _t176 & 0x00000001u;
         /* 02229938 */ if (_t177) goto L_0222993C; else goto L_0222997C;
   L_0222993C: ; // 0x222993c
@@ -15936,11 +15936,11 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229940 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t178);
         /* 02229944 */ _t179 = cpu->r[28] + 0x00000020u;
         /* 02229944 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t179);
-        /* 02229948 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
+        /* 02229948 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
         /* 0222994C */ _t180 = cpu->r[28] + 0x0000002Cu;
         /* 0222994C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t180);
         /* 02229950 */ cpu->f[5] = cpu->f[12] + cpu->f[13];
-        /* 02229954 */ _t181 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02229954 */ _t181 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02229954 */ _t182 = _t181 & 0x00000001u;
         /* 02229954 */ if (_t182) goto L_02229958; else goto L_0222997C;
   L_02229958: ; // 0x2229958
@@ -15948,20 +15948,20 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 0222995C */ _t183 = cpu->r[12] + 0x00000008u;
         /* 0222995C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t183);
         /* 02229960 */ /* nop */
-        /* 02229964 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[31]);
+        /* 02229964 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[31]));
         /* 02229968 */ _t184 = cpu->r[28] + 0x00000024u;
         /* 02229968 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t184);
         /* 0222996C */ cpu->f[9] = fma(cpu->f[9], cpu->f[4], cpu->f[8]);
         /* 02229970 */ _t185 = cpu->r[28] + 0x00000030u;
         /* 02229970 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t185);
-        /* 02229974 */ _t186 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02229974 */ _t186 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02229974 */ _t187 = _t186 & 0x00000001u;
         /* 02229974 */ if (_t187) goto L_02229978; else goto L_022299E0;
   L_02229978: ; // 0x2229978
         /* 02229978 */ goto L_022299C0;
   L_0222997C: ; // 0x222997c
-        /* 0222997C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
-        /* 02229980 */ _t188 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222997C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
+        /* 02229980 */ _t188 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02229980 */ _t189 = _t188 & 0x00000001u;
         /* 02229980 */ if (_t189) goto L_02229984; else goto L_022299A8;
   L_02229984: ; // 0x2229984
@@ -15969,13 +15969,13 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229988 */ _t190 = cpu->r[12] + 0x00000008u;
         /* 02229988 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t190);
         /* 0222998C */ /* nop */
-        /* 02229990 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[31]);
+        /* 02229990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[31]));
         /* 02229994 */ _t191 = cpu->r[28] + 0x00000030u;
         /* 02229994 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t191);
         /* 02229998 */ cpu->f[9] = fma(cpu->f[10], cpu->f[4], cpu->f[6]);
         /* 0222999C */ _t192 = cpu->r[28] + 0x00000024u;
         /* 0222999C */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t192);
-        /* 022299A0 */ _t193 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022299A0 */ _t193 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022299A0 */ _t194 = _t193 & 0x00000001u;
         /* 022299A0 */ if (_t194) goto L_022299A4; else goto L_022299E0;
   L_022299A4: ; // 0x22299a4
@@ -15985,11 +15985,11 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 022299A8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t195);
         /* 022299AC */ _t196 = cpu->r[28] + 0x00000024u;
         /* 022299AC */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t196);
-        /* 022299B0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[31]);
+        /* 022299B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[31]));
         /* 022299B4 */ _t197 = cpu->r[28] + 0x00000030u;
         /* 022299B4 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t197);
         /* 022299B8 */ cpu->f[9] = cpu->f[9] + cpu->f[10];
-        /* 022299BC */ _t198 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022299BC */ _t198 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022299BC */ _t199 = _t198 & 0x00000001u;
         /* 022299BC */ if (_t199) goto L_022299C0; else goto L_022299E0;
   L_022299C0: ; // 0x22299c0
@@ -16006,8 +16006,8 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 022299D8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t203);
         /* 022299DC */ goto L_02229A1C;
   L_022299E0: ; // 0x22299e0
-        /* 022299E0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[31]);
-        /* 022299E4 */ _t204 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022299E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[31]));
+        /* 022299E4 */ _t204 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022299E4 */ _t205 = _t204 & 0x00000001u;
         /* 022299E4 */ if (_t205) goto L_022299E8; else goto L_02229A08;
   L_022299E8: ; // 0x22299e8
@@ -16067,13 +16067,13 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229A68 */ cpu->r[3] = cpu->r[29];
         /* 02229A6C */ cpu->r[6] = cpu->r[1] + 0x00000138u;
         /* 02229A70 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02229A74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02229A78 */ _t225 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229A74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02229A78 */ _t225 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02229A78 */ _t226 = _t225 & 0x00000001u;
         /* 02229A78 */ if (_t226) goto L_02229A7C; else goto L_0222A6EC;
   L_02229A7C: ; // 0x2229a7c
-        /* 02229A7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 02229A80 */ _t227 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229A7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 02229A80 */ _t227 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02229A80 */ _t228 = _t227 & 0x00000001u;
         /* 02229A80 */ if (_t228) goto L_02229A84; else goto L_0222A6EC;
   L_02229A84: ; // 0x2229a84
@@ -16091,8 +16091,8 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229A98 */ rbrew_write_f32(cpu->mem, _t234, cpu->f[6]);
         /* 02229A9C */ _t235 = cpu->r[28] + 0x00000040u;
         /* 02229A9C */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t235);
-        /* 02229AA0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[7]);
-        /* 02229AA4 */ _t236 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229AA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[7]));
+        /* 02229AA4 */ _t236 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02229AA4 */ _t237 = _t236 & 0x00000001u;
         /* 02229AA4 */ if (_t237) goto L_02229ACC; else goto L_02229AA8;
   L_02229AA8: ; // 0x2229aa8
@@ -16101,7 +16101,7 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229AAC */ _t239 = cpu->r[28] + 0x00000038u;
         /* 02229AAC */ rbrew_write_f32(cpu->mem, _t239, cpu->f[31]);
         /* 02229AB0 */ cpu->r[8] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 02229AB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02229AB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02229AB4 */ _t240 = cpu->r[28] + 0x0000003Cu;
         /* 02229AB4 */ rbrew_write_f32(cpu->mem, _t240, cpu->f[31]);
         /* 02229AB8 */ _t241 = cpu->r[28] + 0x00000034u;
@@ -16109,7 +16109,7 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229ABC */ cpu->r[12] = cpu->r[28] + 0x00000034u;
         /* 02229AC0 */ _t242 = cpu->r[28] + 0x00000040u;
         /* 02229AC0 */ rbrew_write_f32(cpu->mem, _t242, cpu->f[31]);
-        /* 02229AC4 */ _t243 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229AC4 */ _t243 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02229AC4 */ _t244 = _t243 & 0x00000001u;
         /* 02229AC4 */ if (_t244) goto L_02229AC8; else goto L_02229B1C;
   L_02229AC8: ; // 0x2229ac8
@@ -16118,8 +16118,8 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229ACC */ _t245 = cpu->r[28] + 0x00000000u;
         /* 02229ACC */ cpu->r[0] = rbrew_read32(cpu->mem, _t245);
         /* 02229AD0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Bu, 0x0000001Cu);
-        /* 02229AD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02229AD4 */ _t246 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229AD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02229AD4 */ _t246 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02229AD4 */ _t247 = _t246 & 0x00000001u;
         /* 02229AD4 */ if (_t247) goto L_02229AD8; else goto L_02229B00;
   L_02229AD8: ; // 0x2229ad8
@@ -16142,13 +16142,13 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229B04 */ _t252 = cpu->r[28] + 0x00000038u;
         /* 02229B04 */ rbrew_write_f32(cpu->mem, _t252, cpu->f[31]);
         /* 02229B08 */ cpu->r[8] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 02229B08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02229B08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02229B0C */ _t253 = cpu->r[28] + 0x00000034u;
         /* 02229B0C */ rbrew_write_f32(cpu->mem, _t253, cpu->f[31]);
         /* 02229B10 */ cpu->r[12] = cpu->r[28] + 0x00000034u;
         /* 02229B14 */ _t254 = cpu->r[28] + 0x0000003Cu;
         /* 02229B14 */ rbrew_write_f32(cpu->mem, _t254, cpu->f[31]);
-        /* 02229B18 */ _t255 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229B18 */ _t255 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02229B18 */ _t256 = _t255 & 0x00000001u;
         /* 02229B18 */ if (_t256) goto L_02229B40; else goto L_02229B1C;
   L_02229B1C: ; // 0x2229b1c
@@ -16167,8 +16167,8 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229B3C */ cpu->r[0] = rbrew_read32(cpu->mem, _t260);
   L_02229B40: ; // 0x2229b40
         /* 02229B40 */ cpu->r[6] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Bu, 0x0000001Bu);
-        /* 02229B40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 02229B44 */ _t261 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229B40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 02229B44 */ _t261 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02229B44 */ _t262 = _t261 & 0x00000001u;
         /* 02229B44 */ if (_t262) goto L_02229C8C; else goto L_02229B48;
   L_02229B48: ; // 0x2229b48
@@ -16176,12 +16176,12 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229B48 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t263);
         /* 02229B4C */ _t264 = cpu->r[28] + 0x00000040u;
         /* 02229B4C */ cpu->f[5] = rbrew_read_f32(cpu->mem, _t264);
-        /* 02229B50 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
+        /* 02229B50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
         /* 02229B54 */ _t265 = cpu->r[28] + 0x0000001Cu;
         /* 02229B54 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t265);
         /* 02229B58 */ _t266 = cpu->r[28] + 0x00000028u;
         /* 02229B58 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t266);
-        /* 02229B5C */ _t267 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02229B5C */ _t267 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02229B5C */ _t268 = _t267 & 0x00000001u;
         /* 02229B5C */ if (_t268) goto L_02229B60; else goto L_02229B84;
   L_02229B60: ; // 0x2229b60
@@ -16189,20 +16189,20 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229B64 */ /* nop */
         /* 02229B68 */ _t269 = cpu->r[12] + 0x00000004u;
         /* 02229B68 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t269);
-        /* 02229B6C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
+        /* 02229B6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
         /* 02229B70 */ _t270 = cpu->r[28] + 0x0000002Cu;
         /* 02229B70 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t270);
         /* 02229B74 */ cpu->f[6] = fma(cpu->f[7], cpu->f[5], cpu->f[12]);
         /* 02229B78 */ _t271 = cpu->r[28] + 0x00000020u;
         /* 02229B78 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t271);
-        /* 02229B7C */ _t272 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02229B7C */ _t272 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02229B7C */ _t273 = _t272 & 0x00000001u;
         /* 02229B7C */ if (_t273) goto L_02229B80; else goto L_02229BEC;
   L_02229B80: ; // 0x2229b80
         /* 02229B80 */ goto L_02229BC8;
   L_02229B84: ; // 0x2229b84
-        /* 02229B84 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
-        /* 02229B88 */ _t274 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02229B84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
+        /* 02229B88 */ _t274 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02229B88 */ _t275 = _t274 & 0x00000001u;
         /* 02229B88 */ if (_t275) goto L_02229B8C; else goto L_02229BB0;
   L_02229B8C: ; // 0x2229b8c
@@ -16210,13 +16210,13 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229B90 */ _t276 = cpu->r[12] + 0x00000004u;
         /* 02229B90 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t276);
         /* 02229B94 */ /* nop */
-        /* 02229B98 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
+        /* 02229B98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
         /* 02229B9C */ _t277 = cpu->r[28] + 0x0000002Cu;
         /* 02229B9C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t277);
         /* 02229BA0 */ cpu->f[6] = fma(cpu->f[9], cpu->f[5], cpu->f[10]);
         /* 02229BA4 */ _t278 = cpu->r[28] + 0x00000020u;
         /* 02229BA4 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t278);
-        /* 02229BA8 */ _t279 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02229BA8 */ _t279 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02229BA8 */ _t280 = _t279 & 0x00000001u;
         /* 02229BA8 */ if (_t280) goto L_02229BAC; else goto L_02229BEC;
   L_02229BAC: ; // 0x2229bac
@@ -16226,11 +16226,11 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229BB0 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t281);
         /* 02229BB4 */ _t282 = cpu->r[28] + 0x00000020u;
         /* 02229BB4 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t282);
-        /* 02229BB8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
+        /* 02229BB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
         /* 02229BBC */ _t283 = cpu->r[28] + 0x0000002Cu;
         /* 02229BBC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t283);
         /* 02229BC0 */ cpu->f[6] = cpu->f[7] + cpu->f[9];
-        /* 02229BC4 */ _t284 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02229BC4 */ _t284 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02229BC4 */ _t285 = _t284 & 0x00000001u;
         /* 02229BC4 */ if (_t285) goto L_02229BC8; else goto L_02229BEC;
   L_02229BC8: ; // 0x2229bc8
@@ -16238,20 +16238,20 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229BCC */ /* nop */
         /* 02229BD0 */ _t286 = cpu->r[12] + 0x00000008u;
         /* 02229BD0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t286);
-        /* 02229BD4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[31]);
+        /* 02229BD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[31]));
         /* 02229BD8 */ _t287 = cpu->r[28] + 0x00000030u;
         /* 02229BD8 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t287);
         /* 02229BDC */ cpu->f[8] = fma(cpu->f[13], cpu->f[5], cpu->f[8]);
         /* 02229BE0 */ _t288 = cpu->r[28] + 0x00000024u;
         /* 02229BE0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t288);
-        /* 02229BE4 */ _t289 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02229BE4 */ _t289 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02229BE4 */ _t290 = _t289 & 0x00000001u;
         /* 02229BE4 */ if (_t290) goto L_02229BE8; else goto L_02229C50;
   L_02229BE8: ; // 0x2229be8
         /* 02229BE8 */ goto L_02229C30;
   L_02229BEC: ; // 0x2229bec
-        /* 02229BEC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
-        /* 02229BF0 */ _t291 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02229BEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
+        /* 02229BF0 */ _t291 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02229BF0 */ _t292 = _t291 & 0x00000001u;
         /* 02229BF0 */ if (_t292) goto L_02229BF4; else goto L_02229C18;
   L_02229BF4: ; // 0x2229bf4
@@ -16262,10 +16262,10 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229C00 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t293);
         /* 02229C04 */ _t294 = cpu->r[28] + 0x00000024u;
         /* 02229C04 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t294);
-        /* 02229C08 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[31]);
+        /* 02229C08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[31]));
         /* 02229C0C */ _t295 = cpu->r[28] + 0x00000030u;
         /* 02229C0C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t295);
-        /* 02229C10 */ _t296 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02229C10 */ _t296 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02229C10 */ _t297 = _t296 & 0x00000001u;
         /* 02229C10 */ if (_t297) goto L_02229C14; else goto L_02229C50;
   L_02229C14: ; // 0x2229c14
@@ -16276,10 +16276,10 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229C1C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t298);
         /* 02229C20 */ _t299 = cpu->r[28] + 0x00000024u;
         /* 02229C20 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t299);
-        /* 02229C24 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[31]);
+        /* 02229C24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[31]));
         /* 02229C28 */ _t300 = cpu->r[28] + 0x00000030u;
         /* 02229C28 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t300);
-        /* 02229C2C */ _t301 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02229C2C */ _t301 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02229C2C */ _t302 = _t301 & 0x00000001u;
         /* 02229C2C */ if (_t302) goto L_02229C30; else goto L_02229C50;
   L_02229C30: ; // 0x2229c30
@@ -16296,8 +16296,8 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229C48 */ cpu->r[0] = rbrew_read32(cpu->mem, _t306);
         /* 02229C4C */ goto L_02229C8C;
   L_02229C50: ; // 0x2229c50
-        /* 02229C50 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[31]);
-        /* 02229C54 */ _t307 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02229C50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[31]));
+        /* 02229C54 */ _t307 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02229C54 */ _t308 = _t307 & 0x00000001u;
         /* 02229C54 */ if (_t308) goto L_02229C58; else goto L_02229C78;
   L_02229C58: ; // 0x2229c58
@@ -16345,8 +16345,8 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229CBC */ cpu->r[7] = rbrew_read32(cpu->mem, _t321);
         /* 02229CC0 */ cpu->r[8] = rbrew_rlwinm(cpu->r[7], 0x00000014u, 0x00000000u, 0x0000000Bu);
         /* 02229CC4 */ /* nop */
-        /* 02229CC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x0000000Bu);
-        /* 02229CCC */ _t322 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229CC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x0000000Bu));
+        /* 02229CCC */ _t322 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02229CCC */ _t323 = _t322 & 0x00000001u;
         /* 02229CCC */ if (_t323) goto L_02229CD0; else goto L_0222A6EC;
   L_02229CD0: ; // 0x2229cd0
@@ -16369,17 +16369,17 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229CFC */ _t329 = cpu->r[12] + 0x000000ACu;
         /* 02229CFC */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t329);
         /* 02229D00 */ cpu->r[11] = 0x10050000u;
-        /* 02229D04 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
+        /* 02229D04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
         /* 02229D08 */ _t330 = cpu->r[11] + 0x00000098u;
         /* 02229D08 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t330);
-        /* 02229D0C */ _t331 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02229D0C */ _t331 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02229D0C */ _t332 = _t331 & 0x00000001u;
         /* 02229D0C */ if (_t332) goto L_02229D20; else goto L_02229D10;
   L_02229D10: ; // 0x2229d10
         /* 02229D10 */ cpu->f[7] = cpu->f[28] - cpu->f[11];
         /* 02229D14 */ cpu->f[29] = cpu->f[7] / cpu->f[9];
-        /* 02229D18 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[30]);
-        /* 02229D1C */ _t333 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02229D18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[30]));
+        /* 02229D1C */ _t333 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02229D1C */ _t334 = _t333 & 0x00000001u;
         /* 02229D1C */ if (_t334) goto L_02229D20; else goto L_02229D88;
   L_02229D20: ; // 0x2229d20
@@ -16419,10 +16419,10 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229D70 */ /* nop */
         /* 02229D74 */ _t348 = cpu->r[9] + 0x000000A0u;
         /* 02229D74 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t348);
-        /* 02229D78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x0000000Cu);
+        /* 02229D78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x0000000Cu));
         /* 02229D7C */ _t349 = cpu->r[29] + 0x00000114u;
         /* 02229D7C */ rbrew_write32(cpu->mem, _t349, cpu->r[4]);
-        /* 02229D80 */ _t350 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229D80 */ _t350 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02229D80 */ _t351 = _t350 & 0x00000001u;
         /* 02229D80 */ if (_t351) goto L_02229D84; else goto L_0222A3CC;
   L_02229D84: ; // 0x2229d84
@@ -16465,9 +16465,9 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229DE0 */ /* nop */
         /* 02229DE4 */ _t364 = cpu->r[29] + 0x00000114u;
         /* 02229DE4 */ rbrew_write32(cpu->mem, _t364, cpu->r[4]);
-        /* 02229DE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x0000000Cu);
+        /* 02229DE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x0000000Cu));
         /* 02229DEC */ cpu->r[31] = cpu->r[31] + 0x00006350u;
-        /* 02229DF0 */ _t365 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229DF0 */ _t365 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02229DF0 */ _t366 = _t365 & 0x00000001u;
         /* 02229DF0 */ if (_t366) goto L_02229DF4; else goto L_0222A3CC;
   L_02229DF4: ; // 0x2229df4
@@ -16499,8 +16499,8 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229E2C */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t377);
         /* 02229E30 */ cpu->f[7] = fma(cpu->f[8], cpu->f[8], cpu->f[6]);
         /* 02229E34 */ cpu->f[12] = fma(cpu->f[12], cpu->f[12], cpu->f[7]);
-        /* 02229E38 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[31]);
-        /* 02229E3C */ _t378 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02229E38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[31]));
+        /* 02229E3C */ _t378 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02229E3C */ _t379 = _t378 & 0x00000001u;
         /* 02229E3C */ if (_t379) goto L_02229E40; else goto L_02229E78;
   L_02229E40: ; // 0x2229e40
@@ -16527,13 +16527,13 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229E78 */ cpu->r[6] = 0x10050000u;
         /* 02229E7C */ _t385 = cpu->r[6] + 0x000000B0u;
         /* 02229E7C */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t385);
-        /* 02229E80 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[12]);
-        /* 02229E84 */ _t386 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02229E80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[12]));
+        /* 02229E84 */ _t386 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02229E84 */ _t387 = _t386 & 0x00000001u;
         /* 02229E84 */ if (_t387) goto L_02229E90; else goto L_02229E88;
   L_02229E88: ; // 0x2229e88
-        /* 02229E88 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[29]);
-        /* 02229E8C */ _t388 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02229E88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[29]));
+        /* 02229E8C */ _t388 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02229E8C */ _t389 = _t388 & 0x00000001u;
         /* 02229E8C */ if (_t389) goto L_02229E90; else goto L_02229F10;
   L_02229E90: ; // 0x2229e90
@@ -16581,12 +16581,12 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229EF4 */ cpu->r[3] = cpu->r[29];
         /* 02229EF8 */ cpu->f[26] = fabs(cpu->f[6]);
         /* 02229EFC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02229F00 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000001u);
-        /* 02229F04 */ _t406 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02229F00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000001u));
+        /* 02229F04 */ _t406 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02229F04 */ _t407 = _t406 & 0x00000001u;
         /* 02229F04 */ if (_t407) goto L_02229FFC; else goto L_02229F08;
   L_02229F08: ; // 0x2229f08
-        /* 02229F08 */ _t408 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229F08 */ _t408 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02229F08 */ _t409 = _t408 & 0x00000001u;
         /* 02229F08 */ if (_t409) goto L_0222A184; else goto L_02229F0C;
   L_02229F0C: ; // 0x2229f0c
@@ -16667,12 +16667,12 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 02229FB8 */ cpu->r[3] = cpu->r[29];
         /* 02229FBC */ cpu->f[26] = fabs(cpu->f[6]);
         /* 02229FC0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02229FC4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000001u);
-        /* 02229FC8 */ _t440 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02229FC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000001u));
+        /* 02229FC8 */ _t440 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02229FC8 */ _t441 = _t440 & 0x00000001u;
         /* 02229FC8 */ if (_t441) goto L_02229FFC; else goto L_02229FCC;
   L_02229FCC: ; // 0x2229fcc
-        /* 02229FCC */ _t442 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02229FCC */ _t442 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02229FCC */ _t443 = _t442 & 0x00000001u;
         /* 02229FCC */ if (_t443) goto L_0222A184; else goto L_02229FD0;
   L_02229FD0: ; // 0x2229fd0
@@ -16715,9 +16715,9 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 0222A034 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t453);
         /* 0222A038 */ cpu->f[9] = fma(cpu->f[6], cpu->f[31], cpu->f[8]);
         /* 0222A03C */ cpu->r[30] = 0x101C0000u;
-        /* 0222A040 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[26], cpu->f[9]);
+        /* 0222A040 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[26], cpu->f[9]));
         /* 0222A044 */ cpu->r[30] = cpu->r[30] + 0x00006000u;
-        /* 0222A048 */ _t454 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222A048 */ _t454 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222A048 */ _t455 = _t454 & 0x00000001u;
         /* 0222A048 */ if (_t455) goto L_0222A04C; else goto L_0222A0A0;
   L_0222A04C: ; // 0x222a04c
@@ -16775,11 +16775,11 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 0222A0DC */ cpu->f[11] = fma(cpu->f[0], cpu->f[31], cpu->f[7]);
         /* 0222A0E0 */ _t470 = cpu->r[30] + 0x00000000u;
         /* 0222A0E0 */ cpu->r[6] = rbrew_read32(cpu->mem, _t470);
-        /* 0222A0E4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[26], cpu->f[11]);
+        /* 0222A0E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[26], cpu->f[11]));
         /* 0222A0E8 */ _t471 = cpu->r[6] + 0x00000274u;
         /* 0222A0E8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t471);
         /* 0222A0EC */ cpu->r[4] = cpu->r[29];
-        /* 0222A0F0 */ _t472 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222A0F0 */ _t472 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222A0F0 */ _t473 = _t472 & 0x00000001u;
         /* 0222A0F0 */ if (_t473) goto L_0222A0F4; else goto L_0222A13C;
   L_0222A0F4: ; // 0x222a0f4
@@ -16860,8 +16860,8 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 0222A1CC */ _t492 = cpu->r[7] + 0x00000008u;
         /* 0222A1CC */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t492);
         /* 0222A1D0 */ cpu->f[8] = fma(cpu->f[0], cpu->f[31], cpu->f[10]);
-        /* 0222A1D4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[26], cpu->f[8]);
-        /* 0222A1D8 */ _t493 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222A1D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[26], cpu->f[8]));
+        /* 0222A1D8 */ _t493 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222A1D8 */ _t494 = _t493 & 0x00000001u;
         /* 0222A1D8 */ if (_t494) goto L_0222A1DC; else goto L_0222A1E4;
   L_0222A1DC: ; // 0x222a1dc
@@ -16890,9 +16890,9 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 0222A21C */ _t500 = cpu->r[9] + 0x00000008u;
         /* 0222A21C */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t500);
         /* 0222A220 */ cpu->f[9] = fma(cpu->f[7], cpu->f[31], cpu->f[9]);
-        /* 0222A224 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[26], cpu->f[9]);
+        /* 0222A224 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[26], cpu->f[9]));
         /* 0222A228 */ cpu->r[5] = 0x00000002u;
-        /* 0222A22C */ _t501 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222A22C */ _t501 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222A22C */ _t502 = _t501 & 0x00000001u;
         /* 0222A22C */ if (_t502) goto L_0222A230; else goto L_0222A234;
   L_0222A230: ; // 0x222a230
@@ -17015,7 +17015,7 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 0222A348 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t546);
         /* 0222A34C */ _t547 = cpu->r[1] + 0x00000104u;
         /* 0222A34C */ rbrew_write_f32(cpu->mem, _t547, cpu->f[8]);
-        /* 0222A350 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0222A350 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0222A354 */ _t548 = cpu->r[1] + 0x000000F0u;
         /* 0222A354 */ rbrew_write_f32(cpu->mem, _t548, cpu->f[10]);
         /* 0222A358 */ _t549 = cpu->r[1] + 0x000000ECu;
@@ -17026,7 +17026,7 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 0222A360 */ rbrew_write_f32(cpu->mem, _t551, cpu->f[12]);
         /* 0222A364 */ _t552 = cpu->r[1] + 0x000000FCu;
         /* 0222A364 */ rbrew_write_f32(cpu->mem, _t552, cpu->f[0]);
-        /* 0222A368 */ _t553 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222A368 */ _t553 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222A368 */ _t554 = _t553 & 0x00000001u;
         /* 0222A368 */ if (_t554) goto L_0222A6C4; else goto L_0222A36C;
   L_0222A36C: ; // 0x222a36c
@@ -17034,8 +17034,8 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 0222A36C */ cpu->r[5] = rbrew_read32(cpu->mem, _t555);
         /* 0222A370 */ _t556 = cpu->r[1] + 0x0000010Cu;
         /* 0222A370 */ cpu->r[6] = rbrew_read32(cpu->mem, _t556);
-        /* 0222A374 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[6]);
-        /* 0222A378 */ _t557 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222A374 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[6]));
+        /* 0222A378 */ _t557 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222A378 */ _t558 = _t557 & 0x00000001u;
         /* 0222A378 */ if (_t558) goto L_0222A37C; else goto L_0222A6C4;
   L_0222A37C: ; // 0x222a37c
@@ -17069,8 +17069,8 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 0222A3C4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0222A3C8 */ goto L_0222A6EC;
   L_0222A3CC: ; // 0x222a3cc
-        /* 0222A3CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000016u);
-        /* 0222A3D0 */ _t568 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222A3CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000016u));
+        /* 0222A3D0 */ _t568 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222A3D0 */ _t569 = _t568 & 0x00000001u;
         /* 0222A3D0 */ if (_t569) goto L_0222A3D4; else goto L_0222A6C4;
   L_0222A3D4: ; // 0x222a3d4
@@ -17102,8 +17102,8 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 0222A40C */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t580);
         /* 0222A410 */ cpu->f[11] = fma(cpu->f[6], cpu->f[6], cpu->f[9]);
         /* 0222A414 */ cpu->f[0] = fma(cpu->f[7], cpu->f[7], cpu->f[11]);
-        /* 0222A418 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[31]);
-        /* 0222A41C */ _t581 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222A418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[31]));
+        /* 0222A41C */ _t581 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222A41C */ _t582 = _t581 & 0x00000001u;
         /* 0222A41C */ if (_t582) goto L_0222A420; else goto L_0222A458;
   L_0222A420: ; // 0x222a420
@@ -17130,13 +17130,13 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 0222A458 */ cpu->r[5] = 0x10050000u;
         /* 0222A45C */ _t588 = cpu->r[5] + 0x000000B0u;
         /* 0222A45C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t588);
-        /* 0222A460 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
-        /* 0222A464 */ _t589 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222A460 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
+        /* 0222A464 */ _t589 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222A464 */ _t590 = _t589 & 0x00000001u;
         /* 0222A464 */ if (_t590) goto L_0222A470; else goto L_0222A468;
   L_0222A468: ; // 0x222a468
-        /* 0222A468 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[29]);
-        /* 0222A46C */ _t591 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222A468 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[29]));
+        /* 0222A46C */ _t591 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222A46C */ _t592 = _t591 & 0x00000001u;
         /* 0222A46C */ if (_t592) goto L_0222A470; else goto L_0222A4C0;
   L_0222A470: ; // 0x222a470
@@ -17171,8 +17171,8 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 0222A4A8 */ cpu->ctr = cpu->r[11];
         /* 0222A4AC */ cpu->r[3] = cpu->r[29];
         /* 0222A4B0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222A4B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000001u);
-        /* 0222A4B8 */ _t607 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222A4B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000001u));
+        /* 0222A4B8 */ _t607 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222A4B8 */ _t608 = _t607 & 0x00000001u;
         /* 0222A4B8 */ if (_t608) goto L_0222A4BC; else goto L_0222A6C4;
   L_0222A4BC: ; // 0x222a4bc
@@ -17242,8 +17242,8 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 0222A540 */ cpu->ctr = cpu->r[11];
         /* 0222A544 */ cpu->r[3] = cpu->r[29];
         /* 0222A548 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222A54C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000001u);
-        /* 0222A550 */ _t638 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222A54C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000001u));
+        /* 0222A550 */ _t638 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222A550 */ _t639 = _t638 & 0x00000001u;
         /* 0222A550 */ if (_t639) goto L_0222A554; else goto L_0222A6C4;
   L_0222A554: ; // 0x222a554
@@ -17374,10 +17374,10 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 0222A67C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t688);
         /* 0222A680 */ _t689 = cpu->r[1] + 0x000000FCu;
         /* 0222A680 */ rbrew_write_f32(cpu->mem, _t689, cpu->f[8]);
-        /* 0222A684 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0222A684 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0222A688 */ _t690 = cpu->r[1] + 0x00000100u;
         /* 0222A688 */ rbrew_write_f32(cpu->mem, _t690, cpu->f[11]);
-        /* 0222A68C */ _t691 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222A68C */ _t691 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222A68C */ _t692 = _t691 & 0x00000001u;
         /* 0222A68C */ if (_t692) goto L_0222A6C4; else goto L_0222A690;
   L_0222A690: ; // 0x222a690
@@ -17385,8 +17385,8 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 0222A690 */ cpu->r[0] = rbrew_read32(cpu->mem, _t693);
         /* 0222A694 */ _t694 = cpu->r[1] + 0x0000010Cu;
         /* 0222A694 */ cpu->r[4] = rbrew_read32(cpu->mem, _t694);
-        /* 0222A698 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[4]);
-        /* 0222A69C */ _t695 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222A698 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[4]));
+        /* 0222A69C */ _t695 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222A69C */ _t696 = _t695 & 0x00000001u;
         /* 0222A69C */ if (_t696) goto L_0222A6A0; else goto L_0222A6C4;
   L_0222A6A0: ; // 0x222a6a0
@@ -17447,7 +17447,7 @@ void Gambit_fn_022294C0(CPUState* cpu) {
         /* 0222A71C */ cpu->f[26] = rbrew_read_f64(cpu->mem, _t716);
         /* 0222A720 */ _t717 = cpu->r[1] + 0x000001B0u;
         /* 0222A720 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t717);
-        /* 0222A724 */ _t718 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222A724 */ _t718 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222A724 */ _t719 = _t718 & 0x00000001u;
         /* 0222A724 */ if (_t719) goto L_0222A728; // else: addr-0 trap, fall-through
   L_0222A728: ; // 0x222a728
@@ -17609,15 +17609,15 @@ void Gambit_fn_0222A738(CPUState* cpu) {
         /* 0222A868 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t64);
         /* 0222A86C */ _t65 = cpu->r[30] + 0x00000114u;
         /* 0222A86C */ rbrew_write32(cpu->mem, _t65, cpu->r[11]);
-        /* 0222A870 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000002u);
+        /* 0222A870 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000002u));
         /* 0222A874 */ _t66 = cpu->r[30] + 0x000000ECu;
         /* 0222A874 */ rbrew_write_f32(cpu->mem, _t66, cpu->f[12]);
-        /* 0222A878 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222A878 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222A878 */ _t68 = _t67 & 0x00000001u;
         /* 0222A878 */ if (_t68) goto L_0222A884; else goto L_0222A87C;
   L_0222A87C: ; // 0x222a87c
-        /* 0222A87C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000003u);
-        /* 0222A880 */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222A87C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000003u));
+        /* 0222A880 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222A880 */ _t70 = _t69 & 0x00000001u;
         /* 0222A880 */ if (_t70) goto L_0222A884; else goto L_0222A898;
   L_0222A884: ; // 0x222a884
@@ -17641,9 +17641,9 @@ void Gambit_fn_0222A738(CPUState* cpu) {
         /* 0222A8AC */ cpu->r[4] = 0x101D0000u;
         /* 0222A8B0 */ _t76 = cpu->r[29] + 0x00000014u;
         /* 0222A8B0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t76);
-        /* 0222A8B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0222A8B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0222A8B8 */ cpu->r[4] = cpu->r[4] + 0xFFFFE310u;
-        /* 0222A8BC */ _t77 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222A8BC */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222A8BC */ _t78 = _t77 & 0x00000001u;
         /* 0222A8BC */ if (_t78) goto L_0222A8C0; else goto L_0222A8D4;
   L_0222A8C0: ; // 0x222a8c0
@@ -17659,10 +17659,10 @@ void Gambit_fn_0222A738(CPUState* cpu) {
         /* 0222A8D8 */ cpu->r[9] = 0x10050000u;
         /* 0222A8DC */ _t81 = cpu->r[11] + 0x000000A0u;
         /* 0222A8DC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t81);
-        /* 0222A8E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0222A8E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0222A8E4 */ _t82 = cpu->r[9] + 0x000000A4u;
         /* 0222A8E4 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t82);
-        /* 0222A8E8 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222A8E8 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222A8E8 */ _t84 = _t83 & 0x00000001u;
         /* 0222A8E8 */ if (_t84) goto L_0222ABC4; else goto L_0222A8EC;
   L_0222A8EC: ; // 0x222a8ec
@@ -17673,13 +17673,13 @@ void Gambit_fn_0222A738(CPUState* cpu) {
         /* 0222A8F4 */ cpu->ctr = cpu->r[7];
         /* 0222A8F8 */ cpu->r[3] = cpu->r[31];
         /* 0222A8FC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222A900 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222A904 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222A900 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222A904 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222A904 */ _t88 = _t87 & 0x00000001u;
         /* 0222A904 */ if (_t88) goto L_0222ABC4; else goto L_0222A908;
   L_0222A908: ; // 0x222a908
-        /* 0222A908 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0222A90C */ _t89 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222A908 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0222A90C */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222A90C */ _t90 = _t89 & 0x00000001u;
         /* 0222A90C */ if (_t90) goto L_0222ABC4; else goto L_0222A910;
   L_0222A910: ; // 0x222a910
@@ -17734,21 +17734,21 @@ void Gambit_fn_0222A738(CPUState* cpu) {
         /* 0222A984 */ cpu->r[5] = cpu->r[30] + 0x000000F0u;
         /* 0222A988 */ cpu->r[4] = cpu->r[1] + 0x00000038u;
         /* 0222A98C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222A990 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[28]);
+        /* 0222A990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[28]));
         /* 0222A994 */ _t110 = cpu->r[1] + 0x00000010u;
         /* 0222A994 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t110);
         /* 0222A998 */ _t111 = cpu->r[1] + 0x00000008u;
         /* 0222A998 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t111);
-        /* 0222A99C */ _t112 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222A99C */ _t112 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222A99C */ _t113 = _t112 & 0x00000001u;
         /* 0222A99C */ if (_t113) goto L_0222A9A0; else goto L_0222A9B8;
   L_0222A9A0: ; // 0x222a9a0
         /* 0222A9A0 */ cpu->f[9] = cpu->f[13] * cpu->f[13];
         /* 0222A9A4 */ cpu->f[13] = fma(cpu->f[10], cpu->f[10], cpu->f[9]);
-        /* 0222A9A8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[28]);
+        /* 0222A9A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[28]));
         /* 0222A9AC */ _t114 = cpu->r[1] + 0x0000000Cu;
         /* 0222A9AC */ rbrew_write_f32(cpu->mem, _t114, cpu->f[28]);
-        /* 0222A9B0 */ _t115 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222A9B0 */ _t115 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222A9B0 */ _t116 = _t115 & 0x00000001u;
         /* 0222A9B0 */ if (_t116) goto L_0222A9B4; else goto L_0222AAEC;
   L_0222A9B4: ; // 0x222a9b4
@@ -17759,8 +17759,8 @@ void Gambit_fn_0222A738(CPUState* cpu) {
         /* 0222A9BC */ cpu->f[8] = cpu->f[12] * cpu->f[12];
         /* 0222A9C0 */ cpu->f[9] = fma(cpu->f[10], cpu->f[10], cpu->f[8]);
         /* 0222A9C4 */ cpu->f[11] = fma(cpu->f[13], cpu->f[13], cpu->f[9]);
-        /* 0222A9C8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[28]);
-        /* 0222A9CC */ _t118 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222A9C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[28]));
+        /* 0222A9CC */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222A9CC */ _t119 = _t118 & 0x00000001u;
         /* 0222A9CC */ if (_t119) goto L_0222AA40; else goto L_0222A9D0;
   L_0222A9D0: ; // 0x222a9d0
@@ -17870,10 +17870,10 @@ void Gambit_fn_0222A738(CPUState* cpu) {
   L_0222AAD8: ; // 0x222aad8
         /* 0222AAD8 */ cpu->f[9] = cpu->f[13] * cpu->f[13];
         /* 0222AADC */ cpu->f[13] = fma(cpu->f[10], cpu->f[10], cpu->f[9]);
-        /* 0222AAE0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[28]);
+        /* 0222AAE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[28]));
         /* 0222AAE4 */ _t156 = cpu->r[1] + 0x0000000Cu;
         /* 0222AAE4 */ rbrew_write_f32(cpu->mem, _t156, cpu->f[28]);
-        /* 0222AAE8 */ _t157 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222AAE8 */ _t157 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222AAE8 */ _t158 = _t157 & 0x00000001u;
         /* 0222AAE8 */ if (_t158) goto L_0222AB38; else goto L_0222AAEC;
   L_0222AAEC: ; // 0x222aaec
@@ -17899,8 +17899,8 @@ void Gambit_fn_0222A738(CPUState* cpu) {
         /* 0222AB20 */ cpu->f[29] = fma(cpu->f[13], cpu->f[9], cpu->f[0]);
         /* 0222AB24 */ cpu->r[3] = cpu->r[30];
         /* 0222AB28 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222AB2C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[1]);
-        /* 0222AB30 */ _t165 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222AB2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[1]));
+        /* 0222AB30 */ _t165 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222AB30 */ _t166 = _t165 & 0x00000001u;
         /* 0222AB30 */ if (_t166) goto L_0222AB34; else goto L_0222ABC4;
   L_0222AB34: ; // 0x222ab34
@@ -17943,8 +17943,8 @@ void Gambit_fn_0222A738(CPUState* cpu) {
         /* 0222AB98 */ cpu->f[29] = fma(cpu->f[13], cpu->f[9], cpu->f[0]);
         /* 0222AB9C */ cpu->r[3] = cpu->r[30];
         /* 0222ABA0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222ABA4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[1]);
-        /* 0222ABA8 */ _t177 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222ABA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[1]));
+        /* 0222ABA8 */ _t177 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222ABA8 */ _t178 = _t177 & 0x00000001u;
         /* 0222ABA8 */ if (_t178) goto L_0222ABAC; else goto L_0222ABC4;
   L_0222ABAC: ; // 0x222abac
@@ -17969,8 +17969,8 @@ void Gambit_fn_0222A738(CPUState* cpu) {
         /* 0222ABD4 */ cpu->r[4] = cpu->r[30] + 0x000000F0u;
         /* 0222ABD8 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0222ABDC */ cpu->f[29] = cpu->f[1];
-        /* 0222ABE0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[28]);
-        /* 0222ABE4 */ _t186 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222ABE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[28]));
+        /* 0222ABE4 */ _t186 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222ABE4 */ _t187 = _t186 & 0x00000001u;
         /* 0222ABE4 */ if (_t187) goto L_0222ABE8; else goto L_0222AD8C;
   L_0222ABE8: ; // 0x222abe8
@@ -17995,8 +17995,8 @@ void Gambit_fn_0222A738(CPUState* cpu) {
         /* 0222AC0C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t196);
         /* 0222AC10 */ cpu->f[10] = fma(cpu->f[9], cpu->f[9], cpu->f[8]);
         /* 0222AC14 */ cpu->f[8] = fma(cpu->f[11], cpu->f[11], cpu->f[10]);
-        /* 0222AC18 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[28]);
-        /* 0222AC1C */ _t197 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222AC18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[28]));
+        /* 0222AC1C */ _t197 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222AC1C */ _t198 = _t197 & 0x00000001u;
         /* 0222AC1C */ if (_t198) goto L_0222ACC4; else goto L_0222AC20;
   L_0222AC20: ; // 0x222ac20
@@ -18179,7 +18179,7 @@ void Gambit_fn_0222A738(CPUState* cpu) {
         /* 0222ADE8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t258);
         /* 0222ADEC */ _t259 = cpu->r[1] + 0x00000088u;
         /* 0222ADEC */ cpu->r[30] = rbrew_read32(cpu->mem, _t259);
-        /* 0222ADF0 */ _t260 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222ADF0 */ _t260 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222ADF0 */ _t261 = _t260 & 0x00000001u;
         /* 0222ADF0 */ if (_t261) goto L_0222ADF4; // else: addr-0 trap, fall-through
   L_0222ADF4: ; // 0x222adf4
@@ -18237,19 +18237,19 @@ void Gambit_fn_0222AE04(CPUState* cpu) {
         /* 0222AE5C */ cpu->r[7] = 0x10050000u;
         /* 0222AE60 */ _t16 = cpu->r[6] + 0x00000098u;
         /* 0222AE60 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t16);
-        /* 0222AE64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0222AE64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0222AE68 */ _t17 = cpu->r[7] + 0x0000009Cu;
         /* 0222AE68 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t17);
         /* 0222AE6C */ _t18 = cpu->r[3] + 0x000000FCu;
         /* 0222AE6C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t18);
-        /* 0222AE70 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222AE70 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222AE70 */ _t20 = _t19 & 0x00000001u;
         /* 0222AE70 */ if (_t20) goto L_0222AE74; else goto L_0222B040;
   L_0222AE74: ; // 0x222ae74
         /* 0222AE74 */ cpu->r[11] = cpu->r[12] + 0x00000218u;
         /* 0222AE78 */ cpu->r[0] = cpu->r[1] + 0x00000074u;
-        /* 0222AE7C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[0]);
-        /* 0222AE80 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222AE7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[0]));
+        /* 0222AE80 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222AE80 */ _t22 = _t21 & 0x00000001u;
         /* 0222AE80 */ if (_t22) goto L_0222AEB8; else goto L_0222AE84;
   L_0222AE84: ; // 0x222ae84
@@ -18305,16 +18305,16 @@ void Gambit_fn_0222AE04(CPUState* cpu) {
         /* 0222AF08 */ /* nop */
         /* 0222AF0C */ /* nop */
         /* 0222AF10 */ /* nop */
-        /* 0222AF14 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[7]);
+        /* 0222AF14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[7]));
         /* 0222AF18 */ /* nop */
         /* 0222AF1C */ /* nop */
-        /* 0222AF20 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222AF20 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222AF20 */ _t35 = _t34 & 0x00000001u;
         /* 0222AF20 */ if (_t35) goto L_0222AF24; else goto L_0222AF30;
   L_0222AF24: ; // 0x222af24
         /* 0222AF24 */ /* nop */
-        /* 0222AF28 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[5], cpu->f[7]);
-        /* 0222AF2C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222AF28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[5], cpu->f[7]));
+        /* 0222AF2C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222AF2C */ _t37 = _t36 & 0x00000001u;
         /* 0222AF2C */ if (_t37) goto L_0222AFA8; else goto L_0222AF30;
   L_0222AF30: ; // 0x222af30
@@ -18420,8 +18420,8 @@ void Gambit_fn_0222AE04(CPUState* cpu) {
         /* 0222B044 */ cpu->r[8] = rbrew_read32(cpu->mem, _t65);
         /* 0222B048 */ _t66 = cpu->r[8] + 0x00000753u;
         /* 0222B048 */ cpu->r[0] = rbrew_read8(cpu->mem, _t66);
-        /* 0222B04C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 0222B050 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222B04C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 0222B050 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222B050 */ _t68 = _t67 & 0x00000001u;
         /* 0222B050 */ if (_t68) goto L_0222B054; else goto L_0222B24C;
   L_0222B054: ; // 0x222b054
@@ -18499,19 +18499,19 @@ void Gambit_fn_0222AE04(CPUState* cpu) {
         /* 0222B108 */ /* nop */
         /* 0222B10C */ /* nop */
         /* 0222B110 */ /* nop */
-        /* 0222B114 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[4], cpu->f[7]);
+        /* 0222B114 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[4], cpu->f[7]));
         /* 0222B118 */ /* nop */
         /* 0222B11C */ /* nop */
         /* 0222B120 */ /* nop */
         /* 0222B124 */ /* nop */
         /* 0222B128 */ /* nop */
-        /* 0222B12C */ _t95 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222B12C */ _t95 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222B12C */ _t96 = _t95 & 0x00000001u;
         /* 0222B12C */ if (_t96) goto L_0222B130; else goto L_0222B13C;
   L_0222B130: ; // 0x222b130
         /* 0222B130 */ /* nop */
-        /* 0222B134 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[7]);
-        /* 0222B138 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222B134 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[7]));
+        /* 0222B138 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222B138 */ _t98 = _t97 & 0x00000001u;
         /* 0222B138 */ if (_t98) goto L_0222B1B8; else goto L_0222B13C;
   L_0222B13C: ; // 0x222b13c
@@ -18687,19 +18687,19 @@ void Gambit_fn_0222AE04(CPUState* cpu) {
         /* 0222B304 */ /* nop */
         /* 0222B308 */ /* nop */
         /* 0222B30C */ /* nop */
-        /* 0222B310 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[7]);
+        /* 0222B310 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[7]));
         /* 0222B314 */ /* nop */
         /* 0222B318 */ /* nop */
         /* 0222B31C */ /* nop */
         /* 0222B320 */ /* nop */
         /* 0222B324 */ /* nop */
-        /* 0222B328 */ _t152 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222B328 */ _t152 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222B328 */ _t153 = _t152 & 0x00000001u;
         /* 0222B328 */ if (_t153) goto L_0222B32C; else goto L_0222B338;
   L_0222B32C: ; // 0x222b32c
         /* 0222B32C */ /* nop */
-        /* 0222B330 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[5], cpu->f[7]);
-        /* 0222B334 */ _t154 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222B330 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[5], cpu->f[7]));
+        /* 0222B334 */ _t154 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222B334 */ _t155 = _t154 & 0x00000001u;
         /* 0222B334 */ if (_t155) goto L_0222B3B4; else goto L_0222B338;
   L_0222B338: ; // 0x222b338
@@ -18818,7 +18818,7 @@ void Gambit_fn_0222AE04(CPUState* cpu) {
         /* 0222B464 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t190);
         /* 0222B468 */ _t191 = cpu->r[1] + 0x000000A8u;
         /* 0222B468 */ cpu->f[27] = rbrew_read_f64(cpu->mem, _t191);
-        /* 0222B46C */ _t192 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222B46C */ _t192 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222B46C */ _t193 = _t192 & 0x00000001u;
         /* 0222B46C */ if (_t193) goto L_0222B470; // else: addr-0 trap, fall-through
   L_0222B470: ; // 0x222b470
@@ -18884,9 +18884,9 @@ void Gambit_fn_0222B478(CPUState* cpu) {
         /* 0222B4E8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t19);
         /* 0222B4EC */ cpu->r[9] = rbrew_rlwinm(cpu->r[7], 0x00000014u, 0x00000000u, 0x0000000Bu);
         /* 0222B4F0 */ /* nop */
-        /* 0222B4F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x0000000Bu);
+        /* 0222B4F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x0000000Bu));
         /* 0222B4F8 */ cpu->r[30] = cpu->r[4];
-        /* 0222B4FC */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222B4FC */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222B4FC */ _t21 = _t20 & 0x00000001u;
         /* 0222B4FC */ if (_t21) goto L_0222B750; else goto L_0222B500;
   L_0222B500: ; // 0x222b500
@@ -18897,8 +18897,8 @@ void Gambit_fn_0222B478(CPUState* cpu) {
         /* 0222B508 */ cpu->ctr = cpu->r[0];
         /* 0222B50C */ cpu->r[3] = cpu->r[29];
         /* 0222B510 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222B514 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222B518 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222B514 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222B518 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222B518 */ _t25 = _t24 & 0x00000001u;
         /* 0222B518 */ if (_t25) goto L_0222B51C; else goto L_0222B750;
   L_0222B51C: ; // 0x222b51c
@@ -18930,10 +18930,10 @@ void Gambit_fn_0222B478(CPUState* cpu) {
         /* 0222B558 */ cpu->f[10] = fma(cpu->f[13], cpu->f[13], cpu->f[6]);
         /* 0222B55C */ _t36 = cpu->r[12] + 0x0000009Cu;
         /* 0222B55C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t36);
-        /* 0222B560 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
+        /* 0222B560 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
         /* 0222B564 */ _t37 = cpu->r[1] + 0x0000000Cu;
         /* 0222B564 */ rbrew_write_f32(cpu->mem, _t37, cpu->f[31]);
-        /* 0222B568 */ _t38 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222B568 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222B568 */ _t39 = _t38 & 0x00000001u;
         /* 0222B568 */ if (_t39) goto L_0222B56C; else goto L_0222B5AC;
   L_0222B56C: ; // 0x222b56c
@@ -18960,10 +18960,10 @@ void Gambit_fn_0222B478(CPUState* cpu) {
         /* 0222B5A8 */ _t45 = cpu->r[1] + 0x00000010u;
         /* 0222B5A8 */ rbrew_write_f32(cpu->mem, _t45, cpu->f[12]);
   L_0222B5AC: ; // 0x222b5ac
-        /* 0222B5AC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
+        /* 0222B5AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
         /* 0222B5B0 */ cpu->r[31] = 0x101F0000u;
         /* 0222B5B4 */ cpu->r[31] = cpu->r[31] + 0x0000635Cu;
-        /* 0222B5B8 */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222B5B8 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222B5B8 */ _t47 = _t46 & 0x00000001u;
         /* 0222B5B8 */ if (_t47) goto L_0222B610; else goto L_0222B5BC;
   L_0222B5BC: ; // 0x222b5bc
@@ -18986,12 +18986,12 @@ void Gambit_fn_0222B478(CPUState* cpu) {
         /* 0222B5F4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t49);
         /* 0222B5F8 */ _t50 = cpu->r[30] + 0x00000008u;
         /* 0222B5F8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t50);
-        /* 0222B5FC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
+        /* 0222B5FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
         /* 0222B600 */ _t51 = cpu->r[30] + 0x00000014u;
         /* 0222B600 */ cpu->r[0] = rbrew_read32(cpu->mem, _t51);
         /* 0222B604 */ _t52 = cpu->r[3] + 0x00000148u;
         /* 0222B604 */ cpu->r[11] = rbrew_read32(cpu->mem, _t52);
-        /* 0222B608 */ _t53 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222B608 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222B608 */ _t54 = _t53 & 0x00000001u;
         /* 0222B608 */ if (_t54) goto L_0222B60C; else goto L_0222B7B4;
   L_0222B60C: ; // 0x222b60c
@@ -19043,12 +19043,12 @@ void Gambit_fn_0222B478(CPUState* cpu) {
         /* 0222B698 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t63);
         /* 0222B69C */ _t64 = cpu->r[30] + 0x00000008u;
         /* 0222B69C */ cpu->r[3] = rbrew_read32(cpu->mem, _t64);
-        /* 0222B6A0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
+        /* 0222B6A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
         /* 0222B6A4 */ _t65 = cpu->r[30] + 0x00000014u;
         /* 0222B6A4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t65);
         /* 0222B6A8 */ _t66 = cpu->r[3] + 0x00000148u;
         /* 0222B6A8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t66);
-        /* 0222B6AC */ _t67 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222B6AC */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222B6AC */ _t68 = _t67 & 0x00000001u;
         /* 0222B6AC */ if (_t68) goto L_0222B6B0; else goto L_0222B7B4;
   L_0222B6B0: ; // 0x222b6b0
@@ -19112,10 +19112,10 @@ void Gambit_fn_0222B478(CPUState* cpu) {
         /* 0222B738 */ cpu->r[9] = rbrew_read8(cpu->mem, _t91);
         /* 0222B73C */ _t92 = cpu->r[29] + 0x00000078u;
         /* 0222B73C */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t92);
-        /* 0222B740 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0222B740 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0222B744 */ _t93 = cpu->r[29] + 0x0000007Cu;
         /* 0222B744 */ cpu->f[3] = rbrew_read_f32(cpu->mem, _t93);
-        /* 0222B748 */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222B748 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222B748 */ _t95 = _t94 & 0x00000001u;
         /* 0222B748 */ if (_t95) goto L_0222B74C; else goto L_0222BA18;
   L_0222B74C: ; // 0x222b74c
@@ -19158,7 +19158,7 @@ void Gambit_fn_0222B478(CPUState* cpu) {
         /* 0222B798 */ cpu->r[31] = rbrew_read32(cpu->mem, _t111);
         /* 0222B79C */ _t112 = cpu->r[1] + 0x000000E0u;
         /* 0222B79C */ cpu->r[30] = rbrew_read32(cpu->mem, _t112);
-        /* 0222B7A0 */ _t113 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222B7A0 */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222B7A0 */ _t114 = _t113 & 0x00000001u;
         /* 0222B7A0 */ if (_t114) goto L_0222B7A4; // else: addr-0 trap, fall-through
   L_0222B7A4: ; // 0x222b7a4
@@ -19227,17 +19227,17 @@ void Gambit_fn_0222B478(CPUState* cpu) {
         /* 0222B838 */ cpu->r[9] = rbrew_read8(cpu->mem, _t138);
         /* 0222B83C */ _t139 = cpu->r[29] + 0x00000078u;
         /* 0222B83C */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t139);
-        /* 0222B840 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0222B840 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0222B844 */ _t140 = cpu->r[29] + 0x0000007Cu;
         /* 0222B844 */ cpu->f[3] = rbrew_read_f32(cpu->mem, _t140);
-        /* 0222B848 */ _t141 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222B848 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222B848 */ _t142 = _t141 & 0x00000001u;
         /* 0222B848 */ if (_t142) goto L_0222B84C; else goto L_0222BA18;
   L_0222B84C: ; // 0x222b84c
         /* 0222B84C */ cpu->r[6] = cpu->r[3] + 0x00000218u;
         /* 0222B850 */ cpu->r[10] = cpu->r[1] + 0x0000009Cu;
-        /* 0222B854 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[10]);
-        /* 0222B858 */ _t143 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222B854 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[10]));
+        /* 0222B858 */ _t143 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222B858 */ _t144 = _t143 & 0x00000001u;
         /* 0222B858 */ if (_t144) goto L_0222B890; else goto L_0222B85C;
   L_0222B85C: ; // 0x222b85c
@@ -19293,16 +19293,16 @@ void Gambit_fn_0222B478(CPUState* cpu) {
         /* 0222B8E0 */ /* nop */
         /* 0222B8E4 */ /* nop */
         /* 0222B8E8 */ /* nop */
-        /* 0222B8EC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[31]);
+        /* 0222B8EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[31]));
         /* 0222B8F0 */ /* nop */
         /* 0222B8F4 */ /* nop */
-        /* 0222B8F8 */ _t156 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222B8F8 */ _t156 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222B8F8 */ _t157 = _t156 & 0x00000001u;
         /* 0222B8F8 */ if (_t157) goto L_0222B8FC; else goto L_0222B908;
   L_0222B8FC: ; // 0x222b8fc
         /* 0222B8FC */ /* nop */
-        /* 0222B900 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
-        /* 0222B904 */ _t158 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222B900 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
+        /* 0222B904 */ _t158 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222B904 */ _t159 = _t158 & 0x00000001u;
         /* 0222B904 */ if (_t159) goto L_0222B980; else goto L_0222B908;
   L_0222B908: ; // 0x222b908
@@ -19408,8 +19408,8 @@ void Gambit_fn_0222B478(CPUState* cpu) {
         /* 0222BA1C */ cpu->r[6] = rbrew_read32(cpu->mem, _t187);
         /* 0222BA20 */ _t188 = cpu->r[6] + 0x00000753u;
         /* 0222BA20 */ cpu->r[7] = rbrew_read8(cpu->mem, _t188);
-        /* 0222BA24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000002u);
-        /* 0222BA28 */ _t189 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222BA24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000002u));
+        /* 0222BA28 */ _t189 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222BA28 */ _t190 = _t189 & 0x00000001u;
         /* 0222BA28 */ if (_t190) goto L_0222BA2C; else goto L_0222BC24;
   L_0222BA2C: ; // 0x222ba2c
@@ -19487,19 +19487,19 @@ void Gambit_fn_0222B478(CPUState* cpu) {
         /* 0222BAE0 */ /* nop */
         /* 0222BAE4 */ /* nop */
         /* 0222BAE8 */ /* nop */
-        /* 0222BAEC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[31]);
+        /* 0222BAEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[31]));
         /* 0222BAF0 */ /* nop */
         /* 0222BAF4 */ /* nop */
         /* 0222BAF8 */ /* nop */
         /* 0222BAFC */ /* nop */
         /* 0222BB00 */ /* nop */
-        /* 0222BB04 */ _t217 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222BB04 */ _t217 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222BB04 */ _t218 = _t217 & 0x00000001u;
         /* 0222BB04 */ if (_t218) goto L_0222BB08; else goto L_0222BB14;
   L_0222BB08: ; // 0x222bb08
         /* 0222BB08 */ /* nop */
-        /* 0222BB0C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[31]);
-        /* 0222BB10 */ _t219 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222BB0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[31]));
+        /* 0222BB10 */ _t219 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222BB10 */ _t220 = _t219 & 0x00000001u;
         /* 0222BB10 */ if (_t220) goto L_0222BB90; else goto L_0222BB14;
   L_0222BB14: ; // 0x222bb14
@@ -19678,16 +19678,16 @@ void Gambit_fn_0222B478(CPUState* cpu) {
         /* 0222BCE8 */ /* nop */
         /* 0222BCEC */ /* nop */
         /* 0222BCF0 */ /* nop */
-        /* 0222BCF4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[31]);
+        /* 0222BCF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[31]));
         /* 0222BCF8 */ /* nop */
         /* 0222BCFC */ /* nop */
-        /* 0222BD00 */ _t274 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222BD00 */ _t274 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222BD00 */ _t275 = _t274 & 0x00000001u;
         /* 0222BD00 */ if (_t275) goto L_0222BD04; else goto L_0222BD10;
   L_0222BD04: ; // 0x222bd04
         /* 0222BD04 */ /* nop */
-        /* 0222BD08 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[31]);
-        /* 0222BD0C */ _t276 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222BD08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[31]));
+        /* 0222BD0C */ _t276 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222BD0C */ _t277 = _t276 & 0x00000001u;
         /* 0222BD0C */ if (_t277) goto L_0222BD8C; else goto L_0222BD10;
   L_0222BD10: ; // 0x222bd10
@@ -19820,7 +19820,7 @@ void Gambit_fn_0222B478(CPUState* cpu) {
         /* 0222BE58 */ cpu->r[31] = rbrew_read32(cpu->mem, _t319);
         /* 0222BE5C */ _t320 = cpu->r[1] + 0x000000E0u;
         /* 0222BE5C */ cpu->r[30] = rbrew_read32(cpu->mem, _t320);
-        /* 0222BE60 */ _t321 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222BE60 */ _t321 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222BE60 */ _t322 = _t321 & 0x00000001u;
         /* 0222BE60 */ if (_t322) goto L_0222BE64; // else: addr-0 trap, fall-through
   L_0222BE64: ; // 0x222be64
@@ -19861,8 +19861,8 @@ void Gambit_fn_0222BE74(CPUState* cpu) {
         /* 0222BEB0 */ cpu->f[31] = cpu->f[1];
         /* 0222BEB4 */ _t6 = cpu->r[11] + 0x0000009Cu;
         /* 0222BEB4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t6);
-        /* 0222BEB8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[0]);
-        /* 0222BEBC */ _t7 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222BEB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[0]));
+        /* 0222BEBC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222BEBC */ _t8 = _t7 & 0x00000001u;
         /* 0222BEBC */ if (_t8) goto L_0222BEC0; else goto L_0222BF74;
   L_0222BEC0: ; // 0x222bec0
@@ -19875,9 +19875,9 @@ void Gambit_fn_0222BE74(CPUState* cpu) {
         /* 0222BECC */ cpu->r[0] = rbrew_read32(cpu->mem, _t11);
         /* 0222BED0 */ cpu->ctr = cpu->r[0];
         /* 0222BED4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222BED8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0222BED8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0222BEDC */ /* nop */
-        /* 0222BEE0 */ _t12 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222BEE0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222BEE0 */ _t13 = _t12 & 0x00000001u;
         /* 0222BEE0 */ if (_t13) goto L_0222BEE4; else goto L_0222BF74;
   L_0222BEE4: ; // 0x222bee4
@@ -19935,9 +19935,9 @@ void Gambit_fn_0222BE74(CPUState* cpu) {
         /* 0222BF60 */ rbrew_write32(cpu->mem, _t32, cpu->r[12]);
         /* 0222BF64 */ Gambit_fn_02228C64(cpu);
         /* 0222BF68 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 0222BF68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0222BF68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0222BF6C */ cpu->r[31] = cpu->r[31] + 0x00000020u;
-        /* 0222BF70 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222BF70 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222BF70 */ _t34 = _t33 & 0x00000001u;
         /* 0222BF70 */ if (_t34) goto L_0222BF74; else goto L_0222BEE8;
   L_0222BF74: ; // 0x222bf74
@@ -19946,7 +19946,7 @@ void Gambit_fn_0222BE74(CPUState* cpu) {
         /* 0222BF78 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t35);
         /* 0222BF7C */ _t36 = cpu->r[1] + 0x00000048u;
         /* 0222BF7C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t36);
-        /* 0222BF80 */ _t37 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222BF80 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222BF80 */ _t38 = _t37 & 0x00000001u;
         /* 0222BF80 */ if (_t38) goto L_0222BF84; // else: addr-0 trap, fall-through
   L_0222BF84: ; // 0x222bf84
@@ -19994,10 +19994,10 @@ void Gambit_fn_0222BF94(CPUState* cpu) {
         /* 0222BFD4 */ _t11 = cpu->r[10] + 0x000000A4u;
         /* 0222BFD4 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t11);
         /* 0222BFD8 */ cpu->r[8] = 0x10050000u;
-        /* 0222BFDC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
+        /* 0222BFDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
         /* 0222BFE0 */ _t12 = cpu->r[8] + 0x000000A0u;
         /* 0222BFE0 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t12);
-        /* 0222BFE4 */ _t13 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222BFE4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222BFE4 */ _t14 = _t13 & 0x00000001u;
         /* 0222BFE4 */ if (_t14) goto L_0222C044; else goto L_0222BFE8;
   L_0222BFE8: ; // 0x222bfe8
@@ -20026,10 +20026,10 @@ void Gambit_fn_0222BF94(CPUState* cpu) {
         /* 0222C028 */ cpu->f[7] = fma(cpu->f[10], cpu->f[10], cpu->f[7]);
         /* 0222C02C */ cpu->f[9] = fma(cpu->f[8], cpu->f[9], cpu->f[4]);
         /* 0222C030 */ cpu->f[7] = fma(cpu->f[9], cpu->f[9], cpu->f[7]);
-        /* 0222C034 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[0]);
+        /* 0222C034 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[0]));
         /* 0222C038 */ _t21 = cpu->r[3] + 0x00000008u;
         /* 0222C038 */ rbrew_write_f32(cpu->mem, _t21, cpu->f[9]);
-        /* 0222C03C */ _t22 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222C03C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222C03C */ _t23 = _t22 & 0x00000001u;
         /* 0222C03C */ if (_t23) goto L_0222C040; else goto L_0222C100;
   L_0222C040: ; // 0x222c040
@@ -20079,10 +20079,10 @@ void Gambit_fn_0222BF94(CPUState* cpu) {
         /* 0222C0BC */ cpu->f[7] = fma(cpu->f[9], cpu->f[9], cpu->f[7]);
         /* 0222C0C0 */ _t35 = cpu->r[3] + 0x00000008u;
         /* 0222C0C0 */ rbrew_write_f32(cpu->mem, _t35, cpu->f[9]);
-        /* 0222C0C4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[0]);
+        /* 0222C0C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[0]));
         /* 0222C0C8 */ _t36 = cpu->r[1] + 0x00000010u;
         /* 0222C0C8 */ rbrew_write_f32(cpu->mem, _t36, cpu->f[4]);
-        /* 0222C0CC */ _t37 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222C0CC */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222C0CC */ _t38 = _t37 & 0x00000001u;
         /* 0222C0CC */ if (_t38) goto L_0222C0D0; else goto L_0222C100;
   L_0222C0D0: ; // 0x222c0d0
@@ -20142,10 +20142,10 @@ void Gambit_fn_0222C128(CPUState* cpu) {
         /* 0222C144 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000011u, 0x0000000Fu);
         /* 0222C148 */ cpu->r[3] = cpu->r[31];
         /* 0222C14C */ cpu->r[0] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 0222C14C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0222C14C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0222C150 */ _t4 = cpu->r[31] + 0x00000114u;
         /* 0222C150 */ rbrew_write32(cpu->mem, _t4, cpu->r[10]);
-        /* 0222C154 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C154 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C154 */ _t6 = _t5 & 0x00000001u;
         /* 0222C154 */ if (_t6) goto L_0222C184; else goto L_0222C158;
   L_0222C158: ; // 0x222c158
@@ -20243,8 +20243,8 @@ void Gambit_fn_0222C128(CPUState* cpu) {
         /* 0222C238 */ cpu->r[10] = rbrew_read32(cpu->mem, _t40);
         /* 0222C23C */ cpu->ctr = cpu->r[10];
         /* 0222C240 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222C244 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222C248 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C244 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222C248 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C248 */ _t42 = _t41 & 0x00000001u;
         /* 0222C248 */ if (_t42) goto L_0222C260; else goto L_0222C24C;
   L_0222C24C: ; // 0x222c24c
@@ -20258,8 +20258,8 @@ void Gambit_fn_0222C128(CPUState* cpu) {
   L_0222C260: ; // 0x222c260
         /* 0222C260 */ _t45 = cpu->r[31] + 0x00000114u;
         /* 0222C260 */ cpu->r[11] = rbrew_read8(cpu->mem, _t45);
-        /* 0222C264 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x000000FFu);
-        /* 0222C268 */ _t46 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222C264 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x000000FFu));
+        /* 0222C268 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222C268 */ _t47 = _t46 & 0x00000001u;
         /* 0222C268 */ if (_t47) goto L_0222C26C; else goto L_0222C274;
   L_0222C26C: ; // 0x222c26c
@@ -20270,8 +20270,8 @@ void Gambit_fn_0222C128(CPUState* cpu) {
         /* 0222C274 */ _t49 = cpu->r[31] + 0x00000114u;
         /* 0222C274 */ cpu->r[11] = rbrew_read32(cpu->mem, _t49);
         /* 0222C278 */ cpu->r[11] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0222C278 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0222C27C */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C278 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0222C27C */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C27C */ _t51 = _t50 & 0x00000001u;
         /* 0222C27C */ if (_t51) goto L_0222C3D4; else goto L_0222C280;
   L_0222C280: ; // 0x222c280
@@ -20303,10 +20303,10 @@ void Gambit_fn_0222C128(CPUState* cpu) {
         /* 0222C2BC */ cpu->f[9] = fma(cpu->f[8], cpu->f[8], cpu->f[9]);
         /* 0222C2C0 */ _t62 = cpu->r[9] + 0x0000009Cu;
         /* 0222C2C0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t62);
-        /* 0222C2C4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[12]);
+        /* 0222C2C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[12]));
         /* 0222C2C8 */ _t63 = cpu->r[1] + 0x00000018u;
         /* 0222C2C8 */ rbrew_write_f32(cpu->mem, _t63, cpu->f[12]);
-        /* 0222C2CC */ _t64 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222C2CC */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222C2CC */ _t65 = _t64 & 0x00000001u;
         /* 0222C2CC */ if (_t65) goto L_0222C334; else goto L_0222C2D0;
   L_0222C2D0: ; // 0x222c2d0
@@ -20344,8 +20344,8 @@ void Gambit_fn_0222C128(CPUState* cpu) {
         /* 0222C320 */ cpu->f[9] = fma(cpu->f[8], cpu->f[10], cpu->f[9]);
         /* 0222C324 */ _t77 = cpu->r[31] + 0x00000118u;
         /* 0222C324 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t77);
-        /* 0222C328 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[13]);
-        /* 0222C32C */ _t78 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222C328 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[13]));
+        /* 0222C32C */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222C32C */ _t79 = _t78 & 0x00000001u;
         /* 0222C32C */ if (_t79) goto L_0222C3D4; else goto L_0222C330;
   L_0222C330: ; // 0x222c330
@@ -20404,8 +20404,8 @@ void Gambit_fn_0222C128(CPUState* cpu) {
         /* 0222C3B8 */ cpu->f[9] = fma(cpu->f[8], cpu->f[10], cpu->f[9]);
         /* 0222C3BC */ _t97 = cpu->r[31] + 0x00000118u;
         /* 0222C3BC */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t97);
-        /* 0222C3C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[13]);
-        /* 0222C3C4 */ _t98 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222C3C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[13]));
+        /* 0222C3C4 */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222C3C4 */ _t99 = _t98 & 0x00000001u;
         /* 0222C3C4 */ if (_t99) goto L_0222C3D4; else goto L_0222C3C8;
   L_0222C3C8: ; // 0x222c3c8
@@ -20444,10 +20444,10 @@ void Gambit_fn_0222C12C(CPUState* cpu) {
         /* 0222C144 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000011u, 0x0000000Fu);
         /* 0222C148 */ cpu->r[3] = cpu->r[31];
         /* 0222C14C */ cpu->r[0] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 0222C14C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0222C14C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0222C150 */ _t4 = cpu->r[31] + 0x00000114u;
         /* 0222C150 */ rbrew_write32(cpu->mem, _t4, cpu->r[10]);
-        /* 0222C154 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C154 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C154 */ _t6 = _t5 & 0x00000001u;
         /* 0222C154 */ if (_t6) goto L_0222C184; else goto L_0222C158;
   L_0222C158: ; // 0x222c158
@@ -20545,8 +20545,8 @@ void Gambit_fn_0222C12C(CPUState* cpu) {
         /* 0222C238 */ cpu->r[10] = rbrew_read32(cpu->mem, _t40);
         /* 0222C23C */ cpu->ctr = cpu->r[10];
         /* 0222C240 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222C244 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222C248 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C244 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222C248 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C248 */ _t42 = _t41 & 0x00000001u;
         /* 0222C248 */ if (_t42) goto L_0222C260; else goto L_0222C24C;
   L_0222C24C: ; // 0x222c24c
@@ -20560,8 +20560,8 @@ void Gambit_fn_0222C12C(CPUState* cpu) {
   L_0222C260: ; // 0x222c260
         /* 0222C260 */ _t45 = cpu->r[31] + 0x00000114u;
         /* 0222C260 */ cpu->r[11] = rbrew_read8(cpu->mem, _t45);
-        /* 0222C264 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], 0x000000FFu);
-        /* 0222C268 */ _t46 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222C264 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], 0x000000FFu));
+        /* 0222C268 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222C268 */ _t47 = _t46 & 0x00000001u;
         /* 0222C268 */ if (_t47) goto L_0222C26C; else goto L_0222C274;
   L_0222C26C: ; // 0x222c26c
@@ -20572,8 +20572,8 @@ void Gambit_fn_0222C12C(CPUState* cpu) {
         /* 0222C274 */ _t49 = cpu->r[31] + 0x00000114u;
         /* 0222C274 */ cpu->r[11] = rbrew_read32(cpu->mem, _t49);
         /* 0222C278 */ cpu->r[11] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0222C278 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0222C27C */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C278 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0222C27C */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C27C */ _t51 = _t50 & 0x00000001u;
         /* 0222C27C */ if (_t51) goto L_0222C3D4; else goto L_0222C280;
   L_0222C280: ; // 0x222c280
@@ -20605,10 +20605,10 @@ void Gambit_fn_0222C12C(CPUState* cpu) {
         /* 0222C2BC */ cpu->f[9] = fma(cpu->f[8], cpu->f[8], cpu->f[9]);
         /* 0222C2C0 */ _t62 = cpu->r[9] + 0x0000009Cu;
         /* 0222C2C0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t62);
-        /* 0222C2C4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[12]);
+        /* 0222C2C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[12]));
         /* 0222C2C8 */ _t63 = cpu->r[1] + 0x00000018u;
         /* 0222C2C8 */ rbrew_write_f32(cpu->mem, _t63, cpu->f[12]);
-        /* 0222C2CC */ _t64 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222C2CC */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222C2CC */ _t65 = _t64 & 0x00000001u;
         /* 0222C2CC */ if (_t65) goto L_0222C334; else goto L_0222C2D0;
   L_0222C2D0: ; // 0x222c2d0
@@ -20646,8 +20646,8 @@ void Gambit_fn_0222C12C(CPUState* cpu) {
         /* 0222C320 */ cpu->f[9] = fma(cpu->f[8], cpu->f[10], cpu->f[9]);
         /* 0222C324 */ _t77 = cpu->r[31] + 0x00000118u;
         /* 0222C324 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t77);
-        /* 0222C328 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[13]);
-        /* 0222C32C */ _t78 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222C328 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[13]));
+        /* 0222C32C */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222C32C */ _t79 = _t78 & 0x00000001u;
         /* 0222C32C */ if (_t79) goto L_0222C3D4; else goto L_0222C330;
   L_0222C330: ; // 0x222c330
@@ -20706,8 +20706,8 @@ void Gambit_fn_0222C12C(CPUState* cpu) {
         /* 0222C3B8 */ cpu->f[9] = fma(cpu->f[8], cpu->f[10], cpu->f[9]);
         /* 0222C3BC */ _t97 = cpu->r[31] + 0x00000118u;
         /* 0222C3BC */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t97);
-        /* 0222C3C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[13]);
-        /* 0222C3C4 */ _t98 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222C3C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[13]));
+        /* 0222C3C4 */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222C3C4 */ _t99 = _t98 & 0x00000001u;
         /* 0222C3C4 */ if (_t99) goto L_0222C3D4; else goto L_0222C3C8;
   L_0222C3C8: ; // 0x222c3c8
@@ -20750,8 +20750,8 @@ void Gambit_fn_0222C3E8(CPUState* cpu) {
         /* 0222C40C */ _t6 = cpu->r[31] + 0x00000114u;
         /* 0222C40C */ cpu->r[11] = rbrew_read32(cpu->mem, _t6);
         /* 0222C410 */ cpu->r[0] = rbrew_rlwinm(cpu->r[11], 0x0000000Cu, 0x0000001Eu, 0x0000001Fu);
-        /* 0222C410 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222C414 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C410 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222C414 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C414 */ _t8 = _t7 & 0x00000001u;
         /* 0222C414 */ if (_t8) goto L_0222C4BC; else goto L_0222C418;
   L_0222C418: ; // 0x222c418
@@ -20764,20 +20764,20 @@ void Gambit_fn_0222C3E8(CPUState* cpu) {
         /* 0222C428 */ cpu->ctr = cpu->r[0];
         /* 0222C42C */ cpu->r[3] = cpu->r[31];
         /* 0222C430 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222C434 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0222C434 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0222C438 */ _t11 = cpu->r[31] + 0x00000114u;
         /* 0222C438 */ cpu->r[0] = rbrew_read32(cpu->mem, _t11);
-        /* 0222C43C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C43C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C43C */ _t13 = _t12 & 0x00000001u;
         /* 0222C43C */ if (_t13) goto L_0222C440; else goto L_0222C444;
   L_0222C440: ; // 0x222c440
         /* 0222C440 */ cpu->r[30] = 0x00000000u;
   L_0222C444: ; // 0x222c444
         /* 0222C444 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000000Cu, 0x00000009u);
-        /* 0222C448 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0222C448 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0222C44C */ _t14 = cpu->r[31] + 0x00000114u;
         /* 0222C44C */ rbrew_write32(cpu->mem, _t14, cpu->r[0]);
-        /* 0222C450 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C450 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C450 */ _t16 = _t15 & 0x00000001u;
         /* 0222C450 */ if (_t16) goto L_0222C4BC; else goto L_0222C454;
   L_0222C454: ; // 0x222c454
@@ -20794,8 +20794,8 @@ void Gambit_fn_0222C3E8(CPUState* cpu) {
         /* 0222C470 */ cpu->ctr = cpu->r[9];
         /* 0222C474 */ cpu->r[3] = cpu->r[31];
         /* 0222C478 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222C47C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222C480 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C47C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222C480 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C480 */ _t21 = _t20 & 0x00000001u;
         /* 0222C480 */ if (_t21) goto L_0222C4A8; else goto L_0222C484;
   L_0222C484: ; // 0x222c484
@@ -20881,7 +20881,7 @@ void Gambit_fn_0222C3E8(CPUState* cpu) {
         /* 0222C560 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t43);
         /* 0222C564 */ _t44 = cpu->r[1] + 0x00000020u;
         /* 0222C564 */ cpu->r[30] = rbrew_read32(cpu->mem, _t44);
-        /* 0222C568 */ _t45 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222C568 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222C568 */ _t46 = _t45 & 0x00000001u;
         /* 0222C568 */ if (_t46) goto L_0222C56C; // else: addr-0 trap, fall-through
   L_0222C56C: ; // 0x222c56c
@@ -20915,8 +20915,8 @@ void Gambit_fn_0222C3EC(CPUState* cpu) {
         /* 0222C40C */ _t6 = cpu->r[31] + 0x00000114u;
         /* 0222C40C */ cpu->r[11] = rbrew_read32(cpu->mem, _t6);
         /* 0222C410 */ cpu->r[0] = rbrew_rlwinm(cpu->r[11], 0x0000000Cu, 0x0000001Eu, 0x0000001Fu);
-        /* 0222C410 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222C414 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C410 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222C414 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C414 */ _t8 = _t7 & 0x00000001u;
         /* 0222C414 */ if (_t8) goto L_0222C4BC; else goto L_0222C418;
   L_0222C418: ; // 0x222c418
@@ -20929,20 +20929,20 @@ void Gambit_fn_0222C3EC(CPUState* cpu) {
         /* 0222C428 */ cpu->ctr = cpu->r[0];
         /* 0222C42C */ cpu->r[3] = cpu->r[31];
         /* 0222C430 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222C434 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0222C434 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0222C438 */ _t11 = cpu->r[31] + 0x00000114u;
         /* 0222C438 */ cpu->r[0] = rbrew_read32(cpu->mem, _t11);
-        /* 0222C43C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C43C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C43C */ _t13 = _t12 & 0x00000001u;
         /* 0222C43C */ if (_t13) goto L_0222C440; else goto L_0222C444;
   L_0222C440: ; // 0x222c440
         /* 0222C440 */ cpu->r[30] = 0x00000000u;
   L_0222C444: ; // 0x222c444
         /* 0222C444 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000000Cu, 0x00000009u);
-        /* 0222C448 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0222C448 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0222C44C */ _t14 = cpu->r[31] + 0x00000114u;
         /* 0222C44C */ rbrew_write32(cpu->mem, _t14, cpu->r[0]);
-        /* 0222C450 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C450 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C450 */ _t16 = _t15 & 0x00000001u;
         /* 0222C450 */ if (_t16) goto L_0222C4BC; else goto L_0222C454;
   L_0222C454: ; // 0x222c454
@@ -20959,8 +20959,8 @@ void Gambit_fn_0222C3EC(CPUState* cpu) {
         /* 0222C470 */ cpu->ctr = cpu->r[9];
         /* 0222C474 */ cpu->r[3] = cpu->r[31];
         /* 0222C478 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222C47C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222C480 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C47C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222C480 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C480 */ _t21 = _t20 & 0x00000001u;
         /* 0222C480 */ if (_t21) goto L_0222C4A8; else goto L_0222C484;
   L_0222C484: ; // 0x222c484
@@ -21046,7 +21046,7 @@ void Gambit_fn_0222C3EC(CPUState* cpu) {
         /* 0222C560 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t43);
         /* 0222C564 */ _t44 = cpu->r[1] + 0x00000020u;
         /* 0222C564 */ cpu->r[30] = rbrew_read32(cpu->mem, _t44);
-        /* 0222C568 */ _t45 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222C568 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222C568 */ _t46 = _t45 & 0x00000001u;
         /* 0222C568 */ if (_t46) goto L_0222C56C; // else: addr-0 trap, fall-through
   L_0222C56C: ; // 0x222c56c
@@ -21074,8 +21074,8 @@ void Gambit_fn_0222C57C(CPUState* cpu) {
         /* 0222C590 */ _t3 = cpu->r[31] + 0x00000114u;
         /* 0222C590 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 0222C594 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 0222C594 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222C598 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C594 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222C598 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C598 */ _t5 = _t4 & 0x00000001u;
         /* 0222C598 */ if (_t5) goto L_0222C59C; else goto L_0222C5B8;
   L_0222C59C: ; // 0x222c59c
@@ -21095,8 +21095,8 @@ void Gambit_fn_0222C57C(CPUState* cpu) {
         /* 0222C5C0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t8);
         /* 0222C5C4 */ cpu->r[11] = rbrew_rlwinm(cpu->r[10], 0x00000014u, 0x00000000u, 0x0000000Bu);
         /* 0222C5C8 */ /* nop */
-        /* 0222C5CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x0000000Bu);
-        /* 0222C5D0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C5CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x0000000Bu));
+        /* 0222C5D0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C5D0 */ _t10 = _t9 & 0x00000001u;
         /* 0222C5D0 */ if (_t10) goto L_0222C5F8; else goto L_0222C5D4;
   L_0222C5D4: ; // 0x222c5d4
@@ -21116,8 +21116,8 @@ void Gambit_fn_0222C57C(CPUState* cpu) {
         /* 0222C5F8 */ _t14 = cpu->r[31] + 0x00000114u;
         /* 0222C5F8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 0222C5FC */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000000Eu, 0x0000000Eu);
-        /* 0222C5FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222C600 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C5FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222C600 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C600 */ _t16 = _t15 & 0x00000001u;
         /* 0222C600 */ if (_t16) goto L_0222C618; else goto L_0222C604;
   L_0222C604: ; // 0x222c604
@@ -21131,8 +21131,8 @@ void Gambit_fn_0222C57C(CPUState* cpu) {
   L_0222C618: ; // 0x222c618
         /* 0222C618 */ cpu->r[3] = cpu->r[31] + 0x00000094u;
         /* 0222C61C */ Gambit_fn_027E3F3C(cpu);
-        /* 0222C620 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222C624 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C620 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222C624 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C624 */ _t20 = _t19 & 0x00000001u;
         /* 0222C624 */ if (_t20) goto L_0222C644; else goto L_0222C628;
   L_0222C628: ; // 0x222c628
@@ -21171,8 +21171,8 @@ void Gambit_fn_0222C580(CPUState* cpu) {
         /* 0222C590 */ _t3 = cpu->r[31] + 0x00000114u;
         /* 0222C590 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 0222C594 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 0222C594 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222C598 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C594 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222C598 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C598 */ _t5 = _t4 & 0x00000001u;
         /* 0222C598 */ if (_t5) goto L_0222C59C; else goto L_0222C5B8;
   L_0222C59C: ; // 0x222c59c
@@ -21192,8 +21192,8 @@ void Gambit_fn_0222C580(CPUState* cpu) {
         /* 0222C5C0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t8);
         /* 0222C5C4 */ cpu->r[11] = rbrew_rlwinm(cpu->r[10], 0x00000014u, 0x00000000u, 0x0000000Bu);
         /* 0222C5C8 */ /* nop */
-        /* 0222C5CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x0000000Bu);
-        /* 0222C5D0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C5CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x0000000Bu));
+        /* 0222C5D0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C5D0 */ _t10 = _t9 & 0x00000001u;
         /* 0222C5D0 */ if (_t10) goto L_0222C5F8; else goto L_0222C5D4;
   L_0222C5D4: ; // 0x222c5d4
@@ -21213,8 +21213,8 @@ void Gambit_fn_0222C580(CPUState* cpu) {
         /* 0222C5F8 */ _t14 = cpu->r[31] + 0x00000114u;
         /* 0222C5F8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 0222C5FC */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000000Eu, 0x0000000Eu);
-        /* 0222C5FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222C600 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C5FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222C600 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C600 */ _t16 = _t15 & 0x00000001u;
         /* 0222C600 */ if (_t16) goto L_0222C618; else goto L_0222C604;
   L_0222C604: ; // 0x222c604
@@ -21228,8 +21228,8 @@ void Gambit_fn_0222C580(CPUState* cpu) {
   L_0222C618: ; // 0x222c618
         /* 0222C618 */ cpu->r[3] = cpu->r[31] + 0x00000094u;
         /* 0222C61C */ Gambit_fn_027E3F3C(cpu);
-        /* 0222C620 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222C624 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C620 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222C624 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C624 */ _t20 = _t19 & 0x00000001u;
         /* 0222C624 */ if (_t20) goto L_0222C644; else goto L_0222C628;
   L_0222C628: ; // 0x222c628
@@ -21298,8 +21298,8 @@ void Gambit_fn_0222C668(CPUState* cpu) {
         /* 0222C6A8 */ cpu->r[4] = cpu->r[30] + 0x000000C4u;
         /* 0222C6AC */ cpu->r[3] = cpu->r[1] + 0x00000008u;
         /* 0222C6B0 */ Gambit_fn_0222BF94(cpu);
-        /* 0222C6B4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
-        /* 0222C6B8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C6B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
+        /* 0222C6B8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C6B8 */ _t9 = _t8 & 0x00000001u;
         /* 0222C6B8 */ if (_t9) goto L_0222C6BC; else goto L_0222C708;
   L_0222C6BC: ; // 0x222c6bc
@@ -21429,7 +21429,7 @@ void Gambit_fn_0222C668(CPUState* cpu) {
         /* 0222C7E4 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t56);
         /* 0222C7E8 */ _t57 = cpu->r[1] + 0x00000080u;
         /* 0222C7E8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t57);
-        /* 0222C7EC */ _t58 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222C7EC */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222C7EC */ _t59 = _t58 & 0x00000001u;
         /* 0222C7EC */ if (_t59) goto L_0222C7F0; // else: addr-0 trap, fall-through
   L_0222C7F0: ; // 0x222c7f0
@@ -21476,8 +21476,8 @@ void Gambit_fn_0222C800(CPUState* cpu) {
         /* 0222C838 */ _t14 = cpu->r[3] + 0x00000114u;
         /* 0222C838 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 0222C83C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000010u, 0x00000010u);
-        /* 0222C83C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222C840 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C83C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222C840 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C840 */ _t16 = _t15 & 0x00000001u;
         /* 0222C840 */ if (_t16) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0222C840 */ goto L_0222C844;
@@ -21513,14 +21513,14 @@ void Gambit_fn_0222C860(CPUState* cpu) {
         /* 0222C870 */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
         /* 0222C874 */ _t3 = cpu->r[1] + 0x00000010u;
         /* 0222C874 */ rbrew_write32(cpu->mem, _t3, cpu->r[28]);
-        /* 0222C878 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x0000000Fu);
+        /* 0222C878 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x0000000Fu));
         /* 0222C87C */ cpu->r[31] = cpu->r[7];
         /* 0222C880 */ _t4 = cpu->r[1] + 0x00000014u;
         /* 0222C880 */ rbrew_write32(cpu->mem, _t4, cpu->r[29]);
         /* 0222C884 */ _t5 = cpu->r[1] + 0x00000024u;
         /* 0222C884 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
         /* 0222C888 */ cpu->r[29] = cpu->r[3];
-        /* 0222C88C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C88C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C88C */ _t7 = _t6 & 0x00000001u;
         /* 0222C88C */ if (_t7) goto L_0222C8D0; else goto L_0222C890;
   L_0222C890: ; // 0x222c890
@@ -21576,14 +21576,14 @@ void Gambit_fn_0222C864(CPUState* cpu) {
         /* 0222C870 */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
         /* 0222C874 */ _t3 = cpu->r[1] + 0x00000010u;
         /* 0222C874 */ rbrew_write32(cpu->mem, _t3, cpu->r[28]);
-        /* 0222C878 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x0000000Fu);
+        /* 0222C878 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x0000000Fu));
         /* 0222C87C */ cpu->r[31] = cpu->r[7];
         /* 0222C880 */ _t4 = cpu->r[1] + 0x00000014u;
         /* 0222C880 */ rbrew_write32(cpu->mem, _t4, cpu->r[29]);
         /* 0222C884 */ _t5 = cpu->r[1] + 0x00000024u;
         /* 0222C884 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
         /* 0222C888 */ cpu->r[29] = cpu->r[3];
-        /* 0222C88C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C88C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C88C */ _t7 = _t6 & 0x00000001u;
         /* 0222C88C */ if (_t7) goto L_0222C8D0; else goto L_0222C890;
   L_0222C890: ; // 0x222c890
@@ -21647,9 +21647,9 @@ void Gambit_fn_0222C8F0(CPUState* cpu) {
         /* 0222C914 */ cpu->r[10] = rbrew_read32(cpu->mem, _t4);
         /* 0222C918 */ cpu->r[27] = cpu->r[3];
         /* 0222C91C */ cpu->r[9] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Cu, 0x0000001Eu);
-        /* 0222C91C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0222C91C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0222C920 */ cpu->f[31] = cpu->f[1];
-        /* 0222C924 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C924 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C924 */ _t6 = _t5 & 0x00000001u;
         /* 0222C924 */ if (_t6) goto L_0222C9F4; else goto L_0222C928;
   L_0222C928: ; // 0x222c928
@@ -21661,10 +21661,10 @@ void Gambit_fn_0222C8F0(CPUState* cpu) {
         /* 0222C938 */ _t8 = cpu->r[12] + cpu->r[0];
         /* 0222C938 */ cpu->r[31] = rbrew_read32(cpu->mem, _t8);
         /* 0222C93C */ cpu->r[30] = 0x00000000u;
-        /* 0222C940 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0222C940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0222C944 */ _t9 = cpu->r[1] + 0x00000028u;
         /* 0222C944 */ rbrew_write32(cpu->mem, _t9, cpu->r[30]);
-        /* 0222C948 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222C948 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222C948 */ _t11 = _t10 & 0x00000001u;
         /* 0222C948 */ if (_t11) goto L_0222C94C; else goto L_0222C9F4;
   L_0222C94C: ; // 0x222c94c
@@ -21692,8 +21692,8 @@ void Gambit_fn_0222C8F0(CPUState* cpu) {
         /* 0222C98C */ cpu->r[3] = cpu->r[27];
         /* 0222C990 */ cpu->r[4] = cpu->r[1] + 0x0000001Cu;
         /* 0222C994 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222C998 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222C99C */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C998 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222C99C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C99C */ _t17 = _t16 & 0x00000001u;
         /* 0222C99C */ if (_t17) goto L_0222C9E8; else goto L_0222C9A0;
   L_0222C9A0: ; // 0x222c9a0
@@ -21728,9 +21728,9 @@ void Gambit_fn_0222C8F0(CPUState* cpu) {
         /* 0222C9E4 */ Gambit_fn_02228C64(cpu);
   L_0222C9E8: ; // 0x222c9e8
         /* 0222C9E8 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 0222C9E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0222C9E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0222C9EC */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0222C9F0 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222C9F0 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222C9F0 */ _t30 = _t29 & 0x00000001u;
         /* 0222C9F0 */ if (_t30) goto L_0222C9F4; else goto L_0222C954;
   L_0222C9F4: ; // 0x222c9f4
@@ -21739,7 +21739,7 @@ void Gambit_fn_0222C8F0(CPUState* cpu) {
         /* 0222C9F8 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t31);
         /* 0222C9FC */ _t32 = cpu->r[1] + 0x00000060u;
         /* 0222C9FC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t32);
-        /* 0222CA00 */ _t33 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222CA00 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222CA00 */ _t34 = _t33 & 0x00000001u;
         /* 0222CA00 */ if (_t34) goto L_0222CA04; // else: addr-0 trap, fall-through
   L_0222CA04: ; // 0x222ca04
@@ -21795,16 +21795,16 @@ void Gambit_fn_0222CA20(CPUState* cpu) {
         /* 0222CA64 */ cpu->r[25] = cpu->r[26];
         /* 0222CA68 */ cpu->r[8] = 0x10050000u;
         /* 0222CA6C */ cpu->r[5] = cpu->r[0] & 0x00000044u;
-        /* 0222CA6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0222CA6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0222CA70 */ _t8 = cpu->r[8] + 0x0000009Cu;
         /* 0222CA70 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t8);
-        /* 0222CA74 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CA74 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CA74 */ _t10 = _t9 & 0x00000001u;
         /* 0222CA74 */ if (_t10) goto L_0222CB3C; else goto L_0222CA78;
   L_0222CA78: ; // 0x222ca78
         /* 0222CA78 */ cpu->r[9] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 0222CA78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0222CA7C */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CA78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0222CA7C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CA7C */ _t12 = _t11 & 0x00000001u;
         /* 0222CA7C */ if (_t12) goto L_0222CA80; else goto L_0222CB3C;
   L_0222CA80: ; // 0x222ca80
@@ -21821,18 +21821,18 @@ void Gambit_fn_0222CA20(CPUState* cpu) {
         /* 0222CA9C */ cpu->r[5] = rbrew_read32(cpu->mem, _t15);
         /* 0222CAA0 */ cpu->r[31] = cpu->r[3];
         /* 0222CAA4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0222CAA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0222CAA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0222CAA8 */ cpu->r[27] = cpu->r[30] + 0x00000048u;
-        /* 0222CAAC */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CAAC */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CAAC */ _t17 = _t16 & 0x00000001u;
         /* 0222CAAC */ if (_t17) goto L_0222CAE8; else goto L_0222CAB0;
   L_0222CAB0: ; // 0x222cab0
         /* 0222CAB0 */ cpu->r[3] = cpu->r[30] + 0x0000012Cu;
         /* 0222CAB4 */ Gambit_fn_02C69350(cpu);
-        /* 0222CAB8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 0222CAB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 0222CABC */ _t18 = cpu->r[30] + 0x00000000u;
         /* 0222CABC */ cpu->r[7] = rbrew_read32(cpu->mem, _t18);
-        /* 0222CAC0 */ _t19 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222CAC0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222CAC0 */ _t20 = _t19 & 0x00000001u;
         /* 0222CAC0 */ if (_t20) goto L_0222CAC4; else goto L_0222CAE0;
   L_0222CAC4: ; // 0x222cac4
@@ -21855,8 +21855,8 @@ void Gambit_fn_0222CA20(CPUState* cpu) {
         /* 0222CAEC */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t24);
         /* 0222CAF0 */ _t25 = cpu->r[12] + 0x00000114u;
         /* 0222CAF0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t25);
-        /* 0222CAF4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 0222CAF8 */ _t26 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222CAF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 0222CAF8 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222CAF8 */ _t27 = _t26 & 0x00000001u;
         /* 0222CAF8 */ if (_t27) goto L_0222CAFC; else goto L_0222CB10;
   L_0222CAFC: ; // 0x222cafc
@@ -21878,7 +21878,7 @@ void Gambit_fn_0222CA20(CPUState* cpu) {
         /* 0222CB20 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t32);
         /* 0222CB24 */ _t33 = cpu->r[1] + 0x00000070u;
         /* 0222CB24 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t33);
-        /* 0222CB28 */ _t34 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222CB28 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222CB28 */ _t35 = _t34 & 0x00000001u;
         /* 0222CB28 */ if (_t35) goto L_0222CB2C; // else: addr-0 trap, fall-through
   L_0222CB2C: ; // 0x222cb2c
@@ -21889,15 +21889,15 @@ void Gambit_fn_0222CA20(CPUState* cpu) {
         /* 0222CB38 */ return;
   L_0222CB3C: ; // 0x222cb3c
         /* 0222CB3C */ cpu->r[10] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Cu, 0x0000001Eu);
-        /* 0222CB3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0222CB40 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CB3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0222CB40 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CB40 */ _t38 = _t37 & 0x00000001u;
         /* 0222CB40 */ if (_t38) goto L_0222CBB4; else goto L_0222CB44;
   L_0222CB44: ; // 0x222cb44
         /* 0222CB44 */ _t39 = cpu->r[28] + 0x00000051u;
         /* 0222CB44 */ cpu->r[0] = rbrew_read8(cpu->mem, _t39);
-        /* 0222CB48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222CB4C */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CB48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222CB4C */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CB4C */ _t41 = _t40 & 0x00000001u;
         /* 0222CB4C */ if (_t41) goto L_0222CBB4; else goto L_0222CB50;
   L_0222CB50: ; // 0x222cb50
@@ -21931,8 +21931,8 @@ void Gambit_fn_0222CA20(CPUState* cpu) {
         /* 0222CB90 */ cpu->ctr = cpu->r[0];
         /* 0222CB94 */ cpu->r[3] = cpu->r[28];
         /* 0222CB98 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222CB9C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
-        /* 0222CBA0 */ _t53 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222CB9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
+        /* 0222CBA0 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222CBA0 */ _t54 = _t53 & 0x00000001u;
         /* 0222CBA0 */ if (_t54) goto L_0222CBA4; else goto L_0222CBB4;
   L_0222CBA4: ; // 0x222cba4
@@ -21948,8 +21948,8 @@ void Gambit_fn_0222CA20(CPUState* cpu) {
         /* 0222CBC0 */ cpu->r[11] = rbrew_rlwinm(cpu->r[12], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 0222CBC4 */ _t56 = cpu->r[11] + cpu->r[0];
         /* 0222CBC4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t56);
-        /* 0222CBC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0222CBCC */ _t57 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CBC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0222CBCC */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CBCC */ _t58 = _t57 & 0x00000001u;
         /* 0222CBCC */ if (_t58) goto L_0222CBD0; else goto L_0222CBE0;
   L_0222CBD0: ; // 0x222cbd0
@@ -21959,10 +21959,10 @@ void Gambit_fn_0222CA20(CPUState* cpu) {
         /* 0222CBDC */ goto L_0222CC5C;
   L_0222CBE0: ; // 0x222cbe0
         /* 0222CBE0 */ cpu->r[27] = 0x00000000u;
-        /* 0222CBE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0222CBE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0222CBE8 */ _t59 = cpu->r[1] + 0x0000000Cu;
         /* 0222CBE8 */ rbrew_write32(cpu->mem, _t59, cpu->r[27]);
-        /* 0222CBEC */ _t60 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222CBEC */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222CBEC */ _t61 = _t60 & 0x00000001u;
         /* 0222CBEC */ if (_t61) goto L_0222CBF0; else goto L_0222CC5C;
   L_0222CBF0: ; // 0x222cbf0
@@ -21979,37 +21979,37 @@ void Gambit_fn_0222CA20(CPUState* cpu) {
         /* 0222CC14 */ cpu->r[9] = rbrew_read32(cpu->mem, _t62);
         /* 0222CC18 */ _t63 = cpu->r[9] + 0x000001ACu;
         /* 0222CC18 */ cpu->r[7] = rbrew_read32(cpu->mem, _t63);
-        /* 0222CC1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0222CC1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0222CC20 */ _t64 = cpu->r[1] + 0x0000000Cu;
         /* 0222CC20 */ cpu->r[0] = rbrew_read32(cpu->mem, _t64);
-        /* 0222CC24 */ _t65 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CC24 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CC24 */ _t66 = _t65 & 0x00000001u;
         /* 0222CC24 */ if (_t66) goto L_0222CC2C; else goto L_0222CC28;
   L_0222CC28: ; // 0x222cc28
         /* 0222CC28 */ cpu->r[26] = 0x00000001u;
   L_0222CC2C: ; // 0x222cc2c
-        /* 0222CC2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222CC30 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CC2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222CC30 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CC30 */ _t68 = _t67 & 0x00000001u;
         /* 0222CC30 */ if (_t68) goto L_0222CC34; else goto L_0222CC40;
   L_0222CC34: ; // 0x222cc34
-        /* 0222CC34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0222CC38 */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CC34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0222CC38 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CC38 */ _t70 = _t69 & 0x00000001u;
         /* 0222CC38 */ if (_t70) goto L_0222CC3C; else goto L_0222CC40;
   L_0222CC3C: ; // 0x222cc3c
         /* 0222CC3C */ cpu->r[25] = 0x00000001u;
   L_0222CC40: ; // 0x222cc40
         /* 0222CC40 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 0222CC40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0222CC40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0222CC44 */ cpu->r[27] = cpu->r[27] + 0x00000001u;
-        /* 0222CC48 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CC48 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CC48 */ _t72 = _t71 & 0x00000001u;
         /* 0222CC48 */ if (_t72) goto L_0222CC4C; else goto L_0222CBF0;
   L_0222CC4C: ; // 0x222cc4c
         /* 0222CC4C */ cpu->r[0] = cpu->r[26] | cpu->r[25];
-        /* 0222CC4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222CC50 */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CC4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222CC50 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CC50 */ _t74 = _t73 & 0x00000001u;
         /* 0222CC50 */ if (_t74) goto L_0222CC5C; else goto L_0222CC54;
   L_0222CC54: ; // 0x222cc54
@@ -22019,18 +22019,18 @@ void Gambit_fn_0222CA20(CPUState* cpu) {
         /* 0222CC5C */ _t75 = cpu->r[30] + 0x00000000u;
         /* 0222CC5C */ cpu->r[6] = rbrew_read32(cpu->mem, _t75);
         /* 0222CC60 */ cpu->r[0] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0222CC60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0222CC60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0222CC64 */ cpu->r[27] = cpu->r[30] + 0x00000048u;
-        /* 0222CC68 */ _t76 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CC68 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CC68 */ _t77 = _t76 & 0x00000001u;
         /* 0222CC68 */ if (_t77) goto L_0222CCA4; else goto L_0222CC6C;
   L_0222CC6C: ; // 0x222cc6c
         /* 0222CC6C */ cpu->r[3] = cpu->r[30] + 0x0000012Cu;
         /* 0222CC70 */ Gambit_fn_02C69350(cpu);
-        /* 0222CC74 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 0222CC74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 0222CC78 */ _t78 = cpu->r[30] + 0x00000000u;
         /* 0222CC78 */ cpu->r[11] = rbrew_read32(cpu->mem, _t78);
-        /* 0222CC7C */ _t79 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222CC7C */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222CC7C */ _t80 = _t79 & 0x00000001u;
         /* 0222CC7C */ if (_t80) goto L_0222CC80; else goto L_0222CC9C;
   L_0222CC80: ; // 0x222cc80
@@ -22071,7 +22071,7 @@ void Gambit_fn_0222CA20(CPUState* cpu) {
         /* 0222CCE0 */ _t89 = cpu->r[1] + 0x00000070u;
         /* 0222CCE0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t89);
         /* 0222CCE4 */ cpu->r[3] = 0x00000001u;
-        /* 0222CCE8 */ _t90 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222CCE8 */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222CCE8 */ _t91 = _t90 & 0x00000001u;
         /* 0222CCE8 */ if (_t91) goto L_0222CCEC; // else: addr-0 trap, fall-through
   L_0222CCEC: ; // 0x222ccec
@@ -22113,8 +22113,8 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222CD34 */ cpu->r[30] = cpu->r[5];
         /* 0222CD38 */ cpu->r[28] = cpu->r[4];
         /* 0222CD3C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222CD40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222CD44 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CD40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222CD44 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CD44 */ _t9 = _t8 & 0x00000001u;
         /* 0222CD44 */ if (_t9) goto L_0222CD48; else goto L_0222CD74;
   L_0222CD48: ; // 0x222cd48
@@ -22128,7 +22128,7 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222CD58 */ _t13 = cpu->r[1] + 0x000000A0u;
         /* 0222CD58 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t13);
         /* 0222CD5C */ cpu->r[3] = 0x00000000u;
-        /* 0222CD60 */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222CD60 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222CD60 */ _t15 = _t14 & 0x00000001u;
         /* 0222CD60 */ if (_t15) goto L_0222CD64; // else: addr-0 trap, fall-through
   L_0222CD64: ; // 0x222cd64
@@ -22145,8 +22145,8 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222CD7C */ cpu->ctr = cpu->r[0];
         /* 0222CD80 */ cpu->r[3] = cpu->r[29];
         /* 0222CD84 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222CD88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222CD8C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CD88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222CD8C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CD8C */ _t20 = _t19 & 0x00000001u;
         /* 0222CD8C */ if (_t20) goto L_0222CE04; else goto L_0222CD90;
   L_0222CD90: ; // 0x222cd90
@@ -22157,9 +22157,9 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222CD98 */ cpu->r[7] = rbrew_read32(cpu->mem, _t22);
         /* 0222CD9C */ _t23 = cpu->r[9] + 0x00000078u;
         /* 0222CD9C */ cpu->r[4] = rbrew_read32(cpu->mem, _t23);
-        /* 0222CDA0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[4]);
+        /* 0222CDA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[4]));
         /* 0222CDA4 */ cpu->r[3] = 0x00000000u;
-        /* 0222CDA8 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222CDA8 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222CDA8 */ _t25 = _t24 & 0x00000001u;
         /* 0222CDA8 */ if (_t25) goto L_0222CDAC; else goto L_0222CDB8;
   L_0222CDAC: ; // 0x222cdac
@@ -22170,8 +22170,8 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222CDB4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t27);
   L_0222CDB8: ; // 0x222cdb8
         /* 0222CDB8 */ Gambit_fn_025E068C(cpu);
-        /* 0222CDBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222CDC0 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CDBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222CDC0 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CDC0 */ _t29 = _t28 & 0x00000001u;
         /* 0222CDC0 */ if (_t29) goto L_0222CDC4; else goto L_0222CE04;
   L_0222CDC4: ; // 0x222cdc4
@@ -22192,7 +22192,7 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222CDE8 */ _t35 = cpu->r[1] + 0x000000A0u;
         /* 0222CDE8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t35);
         /* 0222CDEC */ cpu->r[3] = 0x00000001u;
-        /* 0222CDF0 */ _t36 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222CDF0 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222CDF0 */ _t37 = _t36 & 0x00000001u;
         /* 0222CDF0 */ if (_t37) goto L_0222CDF4; // else: addr-0 trap, fall-through
   L_0222CDF4: ; // 0x222cdf4
@@ -22210,18 +22210,18 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222CE10 */ cpu->r[31] = rbrew_read32(cpu->mem, _t40);
         /* 0222CE14 */ cpu->r[26] = 0x00000000u;
         /* 0222CE18 */ cpu->r[7] = 0x10050000u;
-        /* 0222CE1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0222CE1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0222CE20 */ _t41 = cpu->r[7] + 0x0000009Cu;
         /* 0222CE20 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t41);
-        /* 0222CE24 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CE24 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CE24 */ _t43 = _t42 & 0x00000001u;
         /* 0222CE24 */ if (_t43) goto L_0222CE28; else goto L_0222CE34;
   L_0222CE28: ; // 0x222ce28
         /* 0222CE28 */ _t44 = cpu->r[30] + 0x0000015Cu;
         /* 0222CE28 */ cpu->r[11] = rbrew_read32(cpu->mem, _t44);
         /* 0222CE2C */ cpu->r[5] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000018u, 0x0000001Au);
-        /* 0222CE2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 0222CE30 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CE2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 0222CE30 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CE30 */ _t46 = _t45 & 0x00000001u;
         /* 0222CE30 */ if (_t46) goto L_0222CF50; else goto L_0222CE34;
   L_0222CE34: ; // 0x222ce34
@@ -22236,14 +22236,14 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222CE48 */ cpu->r[3] = cpu->r[29];
         /* 0222CE4C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0222CE50 */ cpu->f[30] = cpu->f[1];
-        /* 0222CE54 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
-        /* 0222CE58 */ _t50 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222CE54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
+        /* 0222CE58 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222CE58 */ _t51 = _t50 & 0x00000001u;
         /* 0222CE58 */ if (_t51) goto L_0222CE5C; else goto L_0222CF4C;
   L_0222CE5C: ; // 0x222ce5c
-        /* 0222CE5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0222CE5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0222CE60 */ cpu->r[24] = 0x00000000u;
-        /* 0222CE64 */ _t52 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222CE64 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222CE64 */ _t53 = _t52 & 0x00000001u;
         /* 0222CE64 */ if (_t53) goto L_0222CE68; else goto L_0222CF4C;
   L_0222CE68: ; // 0x222ce68
@@ -22261,8 +22261,8 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222CE90 */ Gambit_fn_02040F70(cpu);
         /* 0222CE94 */ _t54 = cpu->r[1] + 0x00000018u;
         /* 0222CE94 */ cpu->r[0] = rbrew_read32(cpu->mem, _t54);
-        /* 0222CE98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222CE9C */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CE98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222CE9C */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CE9C */ _t56 = _t55 & 0x00000001u;
         /* 0222CE9C */ if (_t56) goto L_0222CF40; else goto L_0222CEA0;
   L_0222CEA0: ; // 0x222cea0
@@ -22270,15 +22270,15 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222CEA0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t57);
         /* 0222CEA4 */ _t58 = cpu->r[9] + 0x000001ACu;
         /* 0222CEA4 */ cpu->r[4] = rbrew_read32(cpu->mem, _t58);
-        /* 0222CEA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0222CEAC */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CEA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0222CEAC */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CEAC */ _t60 = _t59 & 0x00000001u;
         /* 0222CEAC */ if (_t60) goto L_0222CF40; else goto L_0222CEB0;
   L_0222CEB0: ; // 0x222ceb0
         /* 0222CEB0 */ _t61 = cpu->r[29] + 0x00000051u;
         /* 0222CEB0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t61);
-        /* 0222CEB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222CEB8 */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CEB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222CEB8 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CEB8 */ _t63 = _t62 & 0x00000001u;
         /* 0222CEB8 */ if (_t63) goto L_0222CF3C; else goto L_0222CEBC;
   L_0222CEBC: ; // 0x222cebc
@@ -22337,9 +22337,9 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222CF3C */ cpu->r[26] = 0x00000001u;
   L_0222CF40: ; // 0x222cf40
         /* 0222CF40 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 0222CF40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0222CF40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0222CF44 */ cpu->r[24] = cpu->r[24] + 0x00000001u;
-        /* 0222CF48 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CF48 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CF48 */ _t84 = _t83 & 0x00000001u;
         /* 0222CF48 */ if (_t84) goto L_0222CF4C; else goto L_0222CE70;
   L_0222CF4C: ; // 0x222cf4c
@@ -22350,26 +22350,26 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222CF54 */ _t86 = cpu->r[30] + 0x00000000u;
         /* 0222CF54 */ cpu->r[5] = rbrew_read32(cpu->mem, _t86);
         /* 0222CF58 */ cpu->r[12] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 0222CF58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0222CF58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0222CF5C */ _t87 = cpu->r[6] + 0x00000098u;
         /* 0222CF5C */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t87);
-        /* 0222CF60 */ _t88 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CF60 */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CF60 */ _t89 = _t88 & 0x00000001u;
         /* 0222CF60 */ if (_t89) goto L_0222CFB4; else goto L_0222CF64;
   L_0222CF64: ; // 0x222cf64
         /* 0222CF64 */ cpu->r[4] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0222CF64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 0222CF64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 0222CF68 */ cpu->r[31] = cpu->r[30] + 0x000000A8u;
-        /* 0222CF6C */ _t90 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CF6C */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CF6C */ _t91 = _t90 & 0x00000001u;
         /* 0222CF6C */ if (_t91) goto L_0222CFA8; else goto L_0222CF70;
   L_0222CF70: ; // 0x222cf70
         /* 0222CF70 */ cpu->r[3] = cpu->r[30] + 0x00000138u;
         /* 0222CF74 */ Gambit_fn_02C69350(cpu);
-        /* 0222CF78 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
+        /* 0222CF78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
         /* 0222CF7C */ _t92 = cpu->r[30] + 0x00000000u;
         /* 0222CF7C */ cpu->r[12] = rbrew_read32(cpu->mem, _t92);
-        /* 0222CF80 */ _t93 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222CF80 */ _t93 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222CF80 */ _t94 = _t93 & 0x00000001u;
         /* 0222CF80 */ if (_t94) goto L_0222CF84; else goto L_0222CFA0;
   L_0222CF84: ; // 0x222cf84
@@ -22387,26 +22387,26 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222CFA4 */ _t97 = cpu->r[30] + 0x00000000u;
         /* 0222CFA4 */ rbrew_write32(cpu->mem, _t97, cpu->r[12]);
   L_0222CFA8: ; // 0x222cfa8
-        /* 0222CFA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0222CFAC */ _t98 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CFA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0222CFAC */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CFAC */ _t99 = _t98 & 0x00000001u;
         /* 0222CFAC */ if (_t99) goto L_0222D018; else goto L_0222CFB0;
   L_0222CFB0: ; // 0x222cfb0
         /* 0222CFB0 */ goto L_0222D000;
   L_0222CFB4: ; // 0x222cfb4
         /* 0222CFB4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[5], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0222CFB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0222CFB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0222CFB8 */ cpu->r[31] = cpu->r[30] + 0x00000048u;
-        /* 0222CFBC */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CFBC */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CFBC */ _t101 = _t100 & 0x00000001u;
         /* 0222CFBC */ if (_t101) goto L_0222CFF8; else goto L_0222CFC0;
   L_0222CFC0: ; // 0x222cfc0
         /* 0222CFC0 */ cpu->r[3] = cpu->r[30] + 0x0000012Cu;
         /* 0222CFC4 */ Gambit_fn_02C69350(cpu);
-        /* 0222CFC8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
+        /* 0222CFC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
         /* 0222CFCC */ _t102 = cpu->r[30] + 0x00000000u;
         /* 0222CFCC */ cpu->r[0] = rbrew_read32(cpu->mem, _t102);
-        /* 0222CFD0 */ _t103 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222CFD0 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222CFD0 */ _t104 = _t103 & 0x00000001u;
         /* 0222CFD0 */ if (_t104) goto L_0222CFD4; else goto L_0222CFF0;
   L_0222CFD4: ; // 0x222cfd4
@@ -22424,8 +22424,8 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222CFF4 */ _t107 = cpu->r[30] + 0x00000000u;
         /* 0222CFF4 */ rbrew_write32(cpu->mem, _t107, cpu->r[0]);
   L_0222CFF8: ; // 0x222cff8
-        /* 0222CFF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0222CFFC */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222CFF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0222CFFC */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222CFFC */ _t109 = _t108 & 0x00000001u;
         /* 0222CFFC */ if (_t109) goto L_0222D018; else goto L_0222D000;
   L_0222D000: ; // 0x222d000
@@ -22450,8 +22450,8 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D02C */ rbrew_write_f32(cpu->mem, _t115, cpu->f[7]);
         /* 0222D030 */ _t116 = cpu->r[30] + 0x00000040u;
         /* 0222D030 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t116);
-        /* 0222D034 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[10]);
-        /* 0222D038 */ _t117 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D034 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[10]));
+        /* 0222D038 */ _t117 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D038 */ _t118 = _t117 & 0x00000001u;
         /* 0222D038 */ if (_t118) goto L_0222D060; else goto L_0222D03C;
   L_0222D03C: ; // 0x222d03c
@@ -22460,7 +22460,7 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D040 */ _t120 = cpu->r[30] + 0x00000034u;
         /* 0222D040 */ rbrew_write_f32(cpu->mem, _t120, cpu->f[31]);
         /* 0222D044 */ cpu->r[11] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 0222D044 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0222D044 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0222D048 */ _t121 = cpu->r[30] + 0x0000003Cu;
         /* 0222D048 */ rbrew_write_f32(cpu->mem, _t121, cpu->f[31]);
         /* 0222D04C */ _t122 = cpu->r[30] + 0x00000040u;
@@ -22468,7 +22468,7 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D050 */ cpu->r[12] = cpu->r[30] + 0x00000034u;
         /* 0222D054 */ _t123 = cpu->r[30] + 0x00000038u;
         /* 0222D054 */ rbrew_write_f32(cpu->mem, _t123, cpu->f[31]);
-        /* 0222D058 */ _t124 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D058 */ _t124 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D058 */ _t125 = _t124 & 0x00000001u;
         /* 0222D058 */ if (_t125) goto L_0222D05C; else goto L_0222D0BC;
   L_0222D05C: ; // 0x222d05c
@@ -22477,8 +22477,8 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D060 */ _t126 = cpu->r[30] + 0x00000000u;
         /* 0222D060 */ cpu->r[10] = rbrew_read32(cpu->mem, _t126);
         /* 0222D064 */ cpu->r[6] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Bu, 0x0000001Cu);
-        /* 0222D064 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0222D068 */ _t127 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D064 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0222D068 */ _t127 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D068 */ _t128 = _t127 & 0x00000001u;
         /* 0222D068 */ if (_t128) goto L_0222D06C; else goto L_0222D0A0;
   L_0222D06C: ; // 0x222d06c
@@ -22495,9 +22495,9 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D088 */ rbrew_write_f32(cpu->mem, _t131, cpu->f[10]);
         /* 0222D08C */ _t132 = cpu->r[30] + 0x00000040u;
         /* 0222D08C */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t132);
-        /* 0222D090 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[12]);
+        /* 0222D090 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[12]));
         /* 0222D094 */ cpu->r[12] = cpu->r[30] + 0x00000034u;
-        /* 0222D098 */ _t133 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D098 */ _t133 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D098 */ _t134 = _t133 & 0x00000001u;
         /* 0222D098 */ if (_t134) goto L_0222D280; else goto L_0222D09C;
   L_0222D09C: ; // 0x222d09c
@@ -22508,13 +22508,13 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D0A4 */ _t136 = cpu->r[30] + 0x00000038u;
         /* 0222D0A4 */ rbrew_write_f32(cpu->mem, _t136, cpu->f[31]);
         /* 0222D0A8 */ cpu->r[11] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 0222D0A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0222D0A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0222D0AC */ _t137 = cpu->r[30] + 0x00000034u;
         /* 0222D0AC */ rbrew_write_f32(cpu->mem, _t137, cpu->f[31]);
         /* 0222D0B0 */ cpu->r[12] = cpu->r[30] + 0x00000034u;
         /* 0222D0B4 */ _t138 = cpu->r[30] + 0x0000003Cu;
         /* 0222D0B4 */ rbrew_write_f32(cpu->mem, _t138, cpu->f[31]);
-        /* 0222D0B8 */ _t139 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D0B8 */ _t139 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D0B8 */ _t140 = _t139 & 0x00000001u;
         /* 0222D0B8 */ if (_t140) goto L_0222D0E0; else goto L_0222D0BC;
   L_0222D0BC: ; // 0x222d0bc
@@ -22533,8 +22533,8 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D0DC */ cpu->r[10] = rbrew_read32(cpu->mem, _t144);
   L_0222D0E0: ; // 0x222d0e0
         /* 0222D0E0 */ cpu->r[4] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Bu, 0x0000001Bu);
-        /* 0222D0E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0222D0E4 */ _t145 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D0E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0222D0E4 */ _t145 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D0E4 */ _t146 = _t145 & 0x00000001u;
         /* 0222D0E4 */ if (_t146) goto L_0222D22C; else goto L_0222D0E8;
   L_0222D0E8: ; // 0x222d0e8
@@ -22542,12 +22542,12 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D0E8 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t147);
         /* 0222D0EC */ _t148 = cpu->r[30] + 0x00000040u;
         /* 0222D0EC */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t148);
-        /* 0222D0F0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
+        /* 0222D0F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
         /* 0222D0F4 */ _t149 = cpu->r[30] + 0x0000001Cu;
         /* 0222D0F4 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t149);
         /* 0222D0F8 */ _t150 = cpu->r[30] + 0x00000028u;
         /* 0222D0F8 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t150);
-        /* 0222D0FC */ _t151 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D0FC */ _t151 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D0FC */ _t152 = _t151 & 0x00000001u;
         /* 0222D0FC */ if (_t152) goto L_0222D100; else goto L_0222D124;
   L_0222D100: ; // 0x222d100
@@ -22558,17 +22558,17 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D10C */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t153);
         /* 0222D110 */ _t154 = cpu->r[30] + 0x0000002Cu;
         /* 0222D110 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t154);
-        /* 0222D114 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 0222D114 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 0222D118 */ _t155 = cpu->r[30] + 0x00000020u;
         /* 0222D118 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t155);
-        /* 0222D11C */ _t156 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D11C */ _t156 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D11C */ _t157 = _t156 & 0x00000001u;
         /* 0222D11C */ if (_t157) goto L_0222D120; else goto L_0222D18C;
   L_0222D120: ; // 0x222d120
         /* 0222D120 */ goto L_0222D168;
   L_0222D124: ; // 0x222d124
-        /* 0222D124 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
-        /* 0222D128 */ _t158 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222D124 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
+        /* 0222D128 */ _t158 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222D128 */ _t159 = _t158 & 0x00000001u;
         /* 0222D128 */ if (_t159) goto L_0222D12C; else goto L_0222D150;
   L_0222D12C: ; // 0x222d12c
@@ -22576,13 +22576,13 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D130 */ /* nop */
         /* 0222D134 */ _t160 = cpu->r[12] + 0x00000004u;
         /* 0222D134 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t160);
-        /* 0222D138 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 0222D138 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 0222D13C */ _t161 = cpu->r[30] + 0x00000020u;
         /* 0222D13C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t161);
         /* 0222D140 */ cpu->f[0] = fma(cpu->f[7], cpu->f[12], cpu->f[0]);
         /* 0222D144 */ _t162 = cpu->r[30] + 0x0000002Cu;
         /* 0222D144 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t162);
-        /* 0222D148 */ _t163 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D148 */ _t163 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D148 */ _t164 = _t163 & 0x00000001u;
         /* 0222D148 */ if (_t164) goto L_0222D14C; else goto L_0222D18C;
   L_0222D14C: ; // 0x222d14c
@@ -22593,10 +22593,10 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D154 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t165);
         /* 0222D158 */ _t166 = cpu->r[30] + 0x00000020u;
         /* 0222D158 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t166);
-        /* 0222D15C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 0222D15C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 0222D160 */ _t167 = cpu->r[30] + 0x0000002Cu;
         /* 0222D160 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t167);
-        /* 0222D164 */ _t168 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D164 */ _t168 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D164 */ _t169 = _t168 & 0x00000001u;
         /* 0222D164 */ if (_t169) goto L_0222D168; else goto L_0222D18C;
   L_0222D168: ; // 0x222d168
@@ -22604,20 +22604,20 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D16C */ /* nop */
         /* 0222D170 */ _t170 = cpu->r[12] + 0x00000008u;
         /* 0222D170 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t170);
-        /* 0222D174 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
+        /* 0222D174 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
         /* 0222D178 */ _t171 = cpu->r[30] + 0x00000030u;
         /* 0222D178 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t171);
         /* 0222D17C */ cpu->f[7] = fma(cpu->f[13], cpu->f[12], cpu->f[9]);
         /* 0222D180 */ _t172 = cpu->r[30] + 0x00000024u;
         /* 0222D180 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t172);
-        /* 0222D184 */ _t173 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D184 */ _t173 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D184 */ _t174 = _t173 & 0x00000001u;
         /* 0222D184 */ if (_t174) goto L_0222D188; else goto L_0222D1F0;
   L_0222D188: ; // 0x222d188
         /* 0222D188 */ goto L_0222D1D0;
   L_0222D18C: ; // 0x222d18c
-        /* 0222D18C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
-        /* 0222D190 */ _t175 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222D18C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
+        /* 0222D190 */ _t175 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222D190 */ _t176 = _t175 & 0x00000001u;
         /* 0222D190 */ if (_t176) goto L_0222D194; else goto L_0222D1B8;
   L_0222D194: ; // 0x222d194
@@ -22625,13 +22625,13 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D198 */ _t177 = cpu->r[12] + 0x00000008u;
         /* 0222D198 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t177);
         /* 0222D19C */ /* nop */
-        /* 0222D1A0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
+        /* 0222D1A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
         /* 0222D1A4 */ _t178 = cpu->r[30] + 0x00000024u;
         /* 0222D1A4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t178);
         /* 0222D1A8 */ cpu->f[7] = fma(cpu->f[7], cpu->f[12], cpu->f[11]);
         /* 0222D1AC */ _t179 = cpu->r[30] + 0x00000030u;
         /* 0222D1AC */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t179);
-        /* 0222D1B0 */ _t180 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D1B0 */ _t180 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D1B0 */ _t181 = _t180 & 0x00000001u;
         /* 0222D1B0 */ if (_t181) goto L_0222D1B4; else goto L_0222D1F0;
   L_0222D1B4: ; // 0x222d1b4
@@ -22641,11 +22641,11 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D1B8 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t182);
         /* 0222D1BC */ _t183 = cpu->r[30] + 0x00000024u;
         /* 0222D1BC */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t183);
-        /* 0222D1C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
+        /* 0222D1C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
         /* 0222D1C4 */ _t184 = cpu->r[30] + 0x00000030u;
         /* 0222D1C4 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t184);
         /* 0222D1C8 */ cpu->f[7] = cpu->f[13] + cpu->f[7];
-        /* 0222D1CC */ _t185 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D1CC */ _t185 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D1CC */ _t186 = _t185 & 0x00000001u;
         /* 0222D1CC */ if (_t186) goto L_0222D1D0; else goto L_0222D1F0;
   L_0222D1D0: ; // 0x222d1d0
@@ -22662,8 +22662,8 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D1E8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t190);
         /* 0222D1EC */ goto L_0222D22C;
   L_0222D1F0: ; // 0x222d1f0
-        /* 0222D1F0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
-        /* 0222D1F4 */ _t191 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222D1F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
+        /* 0222D1F4 */ _t191 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222D1F4 */ _t192 = _t191 & 0x00000001u;
         /* 0222D1F4 */ if (_t192) goto L_0222D1F8; else goto L_0222D218;
   L_0222D1F8: ; // 0x222d1f8
@@ -22706,8 +22706,8 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D250 */ rbrew_write_f32(cpu->mem, _t204, cpu->f[10]);
         /* 0222D254 */ _t205 = cpu->r[30] + 0x00000040u;
         /* 0222D254 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t205);
-        /* 0222D258 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[12]);
-        /* 0222D25C */ _t206 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D258 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[12]));
+        /* 0222D25C */ _t206 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D25C */ _t207 = _t206 & 0x00000001u;
         /* 0222D25C */ if (_t207) goto L_0222D280; else goto L_0222D260;
   L_0222D260: ; // 0x222d260
@@ -22722,8 +22722,8 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D270 */ _t212 = cpu->r[30] + 0x00000000u;
         /* 0222D270 */ cpu->r[10] = rbrew_read32(cpu->mem, _t212);
         /* 0222D274 */ cpu->r[9] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 0222D274 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0222D278 */ _t213 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D274 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0222D278 */ _t213 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D278 */ _t214 = _t213 & 0x00000001u;
         /* 0222D278 */ if (_t214) goto L_0222D27C; else goto L_0222D2A4;
   L_0222D27C: ; // 0x222d27c
@@ -22732,8 +22732,8 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D280 */ _t215 = cpu->r[30] + 0x00000000u;
         /* 0222D280 */ cpu->r[7] = rbrew_read32(cpu->mem, _t215);
         /* 0222D284 */ cpu->r[5] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000001Bu, 0x0000001Cu);
-        /* 0222D284 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 0222D288 */ _t216 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D284 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 0222D288 */ _t216 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D288 */ _t217 = _t216 & 0x00000001u;
         /* 0222D288 */ if (_t217) goto L_0222D41C; else goto L_0222D28C;
   L_0222D28C: ; // 0x222d28c
@@ -22746,8 +22746,8 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D298 */ _t221 = cpu->r[30] + 0x00000000u;
         /* 0222D298 */ cpu->r[10] = rbrew_read32(cpu->mem, _t221);
         /* 0222D29C */ cpu->r[9] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Cu, 0x0000001Cu);
-        /* 0222D29C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0222D2A0 */ _t222 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D29C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0222D2A0 */ _t222 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D2A0 */ _t223 = _t222 & 0x00000001u;
         /* 0222D2A0 */ if (_t223) goto L_0222D2C8; else goto L_0222D2A4;
   L_0222D2A4: ; // 0x222d2a4
@@ -22766,8 +22766,8 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D2C4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t227);
   L_0222D2C8: ; // 0x222d2c8
         /* 0222D2C8 */ cpu->r[7] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Bu, 0x0000001Bu);
-        /* 0222D2C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0222D2CC */ _t228 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D2C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0222D2CC */ _t228 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D2CC */ _t229 = _t228 & 0x00000001u;
         /* 0222D2CC */ if (_t229) goto L_0222D414; else goto L_0222D2D0;
   L_0222D2D0: ; // 0x222d2d0
@@ -22775,12 +22775,12 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D2D0 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t230);
         /* 0222D2D4 */ _t231 = cpu->r[30] + 0x00000040u;
         /* 0222D2D4 */ cpu->f[4] = rbrew_read_f32(cpu->mem, _t231);
-        /* 0222D2D8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
+        /* 0222D2D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
         /* 0222D2DC */ _t232 = cpu->r[30] + 0x0000001Cu;
         /* 0222D2DC */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t232);
         /* 0222D2E0 */ _t233 = cpu->r[30] + 0x00000028u;
         /* 0222D2E0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t233);
-        /* 0222D2E4 */ _t234 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D2E4 */ _t234 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D2E4 */ _t235 = _t234 & 0x00000001u;
         /* 0222D2E4 */ if (_t235) goto L_0222D2E8; else goto L_0222D30C;
   L_0222D2E8: ; // 0x222d2e8
@@ -22788,20 +22788,20 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D2EC */ _t236 = cpu->r[12] + 0x00000004u;
         /* 0222D2EC */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t236);
         /* 0222D2F0 */ /* nop */
-        /* 0222D2F4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 0222D2F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 0222D2F8 */ _t237 = cpu->r[30] + 0x0000002Cu;
         /* 0222D2F8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t237);
         /* 0222D2FC */ cpu->f[5] = fma(cpu->f[11], cpu->f[4], cpu->f[8]);
         /* 0222D300 */ _t238 = cpu->r[30] + 0x00000020u;
         /* 0222D300 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t238);
-        /* 0222D304 */ _t239 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D304 */ _t239 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D304 */ _t240 = _t239 & 0x00000001u;
         /* 0222D304 */ if (_t240) goto L_0222D308; else goto L_0222D374;
   L_0222D308: ; // 0x222d308
         /* 0222D308 */ goto L_0222D350;
   L_0222D30C: ; // 0x222d30c
-        /* 0222D30C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
-        /* 0222D310 */ _t241 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222D30C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
+        /* 0222D310 */ _t241 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222D310 */ _t242 = _t241 & 0x00000001u;
         /* 0222D310 */ if (_t242) goto L_0222D314; else goto L_0222D338;
   L_0222D314: ; // 0x222d314
@@ -22809,13 +22809,13 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D318 */ _t243 = cpu->r[12] + 0x00000004u;
         /* 0222D318 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t243);
         /* 0222D31C */ /* nop */
-        /* 0222D320 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 0222D320 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 0222D324 */ _t244 = cpu->r[30] + 0x0000002Cu;
         /* 0222D324 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t244);
         /* 0222D328 */ cpu->f[5] = fma(cpu->f[12], cpu->f[4], cpu->f[10]);
         /* 0222D32C */ _t245 = cpu->r[30] + 0x00000020u;
         /* 0222D32C */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t245);
-        /* 0222D330 */ _t246 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D330 */ _t246 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D330 */ _t247 = _t246 & 0x00000001u;
         /* 0222D330 */ if (_t247) goto L_0222D334; else goto L_0222D374;
   L_0222D334: ; // 0x222d334
@@ -22826,10 +22826,10 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D33C */ cpu->f[5] = cpu->f[11] + cpu->f[12];
         /* 0222D340 */ _t249 = cpu->r[30] + 0x0000002Cu;
         /* 0222D340 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t249);
-        /* 0222D344 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 0222D344 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 0222D348 */ _t250 = cpu->r[30] + 0x00000020u;
         /* 0222D348 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t250);
-        /* 0222D34C */ _t251 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D34C */ _t251 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D34C */ _t252 = _t251 & 0x00000001u;
         /* 0222D34C */ if (_t252) goto L_0222D350; else goto L_0222D374;
   L_0222D350: ; // 0x222d350
@@ -22837,20 +22837,20 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D354 */ _t253 = cpu->r[12] + 0x00000008u;
         /* 0222D354 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t253);
         /* 0222D358 */ /* nop */
-        /* 0222D35C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
+        /* 0222D35C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
         /* 0222D360 */ _t254 = cpu->r[30] + 0x00000030u;
         /* 0222D360 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t254);
         /* 0222D364 */ cpu->f[7] = fma(cpu->f[12], cpu->f[4], cpu->f[6]);
         /* 0222D368 */ _t255 = cpu->r[30] + 0x00000024u;
         /* 0222D368 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t255);
-        /* 0222D36C */ _t256 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D36C */ _t256 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D36C */ _t257 = _t256 & 0x00000001u;
         /* 0222D36C */ if (_t257) goto L_0222D370; else goto L_0222D3D8;
   L_0222D370: ; // 0x222d370
         /* 0222D370 */ goto L_0222D3B8;
   L_0222D374: ; // 0x222d374
-        /* 0222D374 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
-        /* 0222D378 */ _t258 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222D374 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
+        /* 0222D378 */ _t258 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222D378 */ _t259 = _t258 & 0x00000001u;
         /* 0222D378 */ if (_t259) goto L_0222D37C; else goto L_0222D3A0;
   L_0222D37C: ; // 0x222d37c
@@ -22861,10 +22861,10 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D388 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t260);
         /* 0222D38C */ _t261 = cpu->r[30] + 0x00000030u;
         /* 0222D38C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t261);
-        /* 0222D390 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
+        /* 0222D390 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
         /* 0222D394 */ _t262 = cpu->r[30] + 0x00000024u;
         /* 0222D394 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t262);
-        /* 0222D398 */ _t263 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D398 */ _t263 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D398 */ _t264 = _t263 & 0x00000001u;
         /* 0222D398 */ if (_t264) goto L_0222D39C; else goto L_0222D3D8;
   L_0222D39C: ; // 0x222d39c
@@ -22875,10 +22875,10 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D3A4 */ cpu->f[7] = cpu->f[12] + cpu->f[0];
         /* 0222D3A8 */ _t266 = cpu->r[30] + 0x00000024u;
         /* 0222D3A8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t266);
-        /* 0222D3AC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
+        /* 0222D3AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
         /* 0222D3B0 */ _t267 = cpu->r[30] + 0x00000030u;
         /* 0222D3B0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t267);
-        /* 0222D3B4 */ _t268 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D3B4 */ _t268 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D3B4 */ _t269 = _t268 & 0x00000001u;
         /* 0222D3B4 */ if (_t269) goto L_0222D3B8; else goto L_0222D3D8;
   L_0222D3B8: ; // 0x222d3b8
@@ -22895,8 +22895,8 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D3D0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t273);
         /* 0222D3D4 */ goto L_0222D414;
   L_0222D3D8: ; // 0x222d3d8
-        /* 0222D3D8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
-        /* 0222D3DC */ _t274 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222D3D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
+        /* 0222D3DC */ _t274 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222D3DC */ _t275 = _t274 & 0x00000001u;
         /* 0222D3DC */ if (_t275) goto L_0222D3E0; else goto L_0222D400;
   L_0222D3E0: ; // 0x222d3e0
@@ -22941,8 +22941,8 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D43C */ _t288 = cpu->r[30] + 0x0000015Cu;
         /* 0222D43C */ cpu->r[0] = rbrew_read32(cpu->mem, _t288);
         /* 0222D440 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 0222D440 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222D444 */ _t289 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D440 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222D444 */ _t289 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D444 */ _t290 = _t289 & 0x00000001u;
         /* 0222D444 */ if (_t290) goto L_0222D498; else goto L_0222D448;
   L_0222D448: ; // 0x222d448
@@ -22972,8 +22972,8 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D480 */ cpu->r[3] = cpu->r[29];
         /* 0222D484 */ cpu->r[5] = cpu->r[31];
         /* 0222D488 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222D48C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222D490 */ _t300 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D48C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222D490 */ _t300 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D490 */ _t301 = _t300 & 0x00000001u;
         /* 0222D490 */ if (_t301) goto L_0222D4E4; else goto L_0222D494;
   L_0222D494: ; // 0x222d494
@@ -23005,15 +23005,15 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D4D0 */ cpu->r[3] = cpu->r[29];
         /* 0222D4D4 */ cpu->r[5] = cpu->r[31];
         /* 0222D4D8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222D4DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222D4E0 */ _t311 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D4DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222D4E0 */ _t311 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D4E0 */ _t312 = _t311 & 0x00000001u;
         /* 0222D4E0 */ if (_t312) goto L_0222D4E4; else goto L_0222D5A4;
   L_0222D4E4: ; // 0x222d4e4
         /* 0222D4E4 */ _t313 = cpu->r[29] + 0x00000051u;
         /* 0222D4E4 */ cpu->r[7] = rbrew_read8(cpu->mem, _t313);
-        /* 0222D4E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0222D4EC */ _t314 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D4E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0222D4EC */ _t314 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D4EC */ _t315 = _t314 & 0x00000001u;
         /* 0222D4EC */ if (_t315) goto L_0222D4F0; else goto L_0222D588;
   L_0222D4F0: ; // 0x222d4f0
@@ -23035,8 +23035,8 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D518 */ cpu->f[6] = cpu->f[8] - cpu->f[30];
         /* 0222D51C */ _t321 = cpu->r[3] + 0x00000268u;
         /* 0222D51C */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t321);
-        /* 0222D520 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[9]);
-        /* 0222D524 */ _t322 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222D520 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[9]));
+        /* 0222D524 */ _t322 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222D524 */ _t323 = _t322 & 0x00000001u;
         /* 0222D524 */ if (_t323) goto L_0222D528; else goto L_0222D5A4;
   L_0222D528: ; // 0x222d528
@@ -23053,13 +23053,13 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D548 */ Gambit_fn_02019890(cpu);
         /* 0222D54C */ _t326 = cpu->r[1] + 0x0000005Cu;
         /* 0222D54C */ cpu->r[12] = rbrew_read32(cpu->mem, _t326);
-        /* 0222D550 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], 0x00000000u);
-        /* 0222D554 */ _t327 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D550 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], 0x00000000u));
+        /* 0222D554 */ _t327 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D554 */ _t328 = _t327 & 0x00000001u;
         /* 0222D554 */ if (_t328) goto L_0222D560; else goto L_0222D558;
   L_0222D558: ; // 0x222d558
-        /* 0222D558 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], 0x0000000Eu);
-        /* 0222D55C */ _t329 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D558 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], 0x0000000Eu));
+        /* 0222D55C */ _t329 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D55C */ _t330 = _t329 & 0x00000001u;
         /* 0222D55C */ if (_t330) goto L_0222D560; else goto L_0222D588;
   L_0222D560: ; // 0x222d560
@@ -23070,11 +23070,11 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D56C */ cpu->r[3] = cpu->r[11] + 0x00000008u;
         /* 0222D570 */ Gambit_fn_02C69328(cpu);
         /* 0222D574 */ cpu->f[8] = cpu->f[31] * cpu->f[31];
-        /* 0222D578 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[8]);
+        /* 0222D578 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[8]));
         /* 0222D57C */ /* nop */
         /* 0222D580 */ cpu->r[0] = rbrew_rlwinm(cpu->r[5], 0x00000002u, 0x0000001Fu, 0x0000001Fu);
-        /* 0222D580 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222D584 */ _t332 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D580 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222D584 */ _t332 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D584 */ _t333 = _t332 & 0x00000001u;
         /* 0222D584 */ if (_t333) goto L_0222D588; else goto L_0222D5A4;
   L_0222D588: ; // 0x222d588
@@ -23112,7 +23112,7 @@ void Gambit_fn_0222CCFC(CPUState* cpu) {
         /* 0222D5DC */ _t343 = cpu->r[1] + 0x000000A0u;
         /* 0222D5DC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t343);
         /* 0222D5E0 */ cpu->r[3] = 0x00000001u;
-        /* 0222D5E4 */ _t344 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222D5E4 */ _t344 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222D5E4 */ _t345 = _t344 & 0x00000001u;
         /* 0222D5E4 */ if (_t345) goto L_0222D5E8; // else: addr-0 trap, fall-through
   L_0222D5E8: ; // 0x222d5e8
@@ -23208,9 +23208,9 @@ void Gambit_fn_0222D5F8(CPUState* cpu) {
         /* 0222D6C4 */ cpu->r[31] = _t23;
         /* 0222D6C8 */ _t24 = cpu->r[12] + 0x00000078u;
         /* 0222D6C8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t24);
-        /* 0222D6CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], cpu->r[6]);
+        /* 0222D6CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], cpu->r[6]));
         /* 0222D6D0 */ cpu->r[3] = 0x00000000u;
-        /* 0222D6D4 */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222D6D4 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222D6D4 */ _t26 = _t25 & 0x00000001u;
         /* 0222D6D4 */ if (_t26) goto L_0222D6D8; else goto L_0222D6E4;
   L_0222D6D8: ; // 0x222d6d8
@@ -23227,8 +23227,8 @@ void Gambit_fn_0222D5F8(CPUState* cpu) {
         /* 0222D6F0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t29);
         /* 0222D6F4 */ _t30 = cpu->r[5] + 0x00000044u;
         /* 0222D6F4 */ cpu->r[7] = rbrew_read8(cpu->mem, _t30);
-        /* 0222D6F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0222D6FC */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D6F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0222D6FC */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D6FC */ _t32 = _t31 & 0x00000001u;
         /* 0222D6FC */ if (_t32) goto L_0222D710; else goto L_0222D700;
   L_0222D700: ; // 0x222d700
@@ -23243,7 +23243,7 @@ void Gambit_fn_0222D5F8(CPUState* cpu) {
         /* 0222D714 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t34);
         /* 0222D718 */ _t35 = cpu->r[1] + 0x00000088u;
         /* 0222D718 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t35);
-        /* 0222D71C */ _t36 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222D71C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222D71C */ _t37 = _t36 & 0x00000001u;
         /* 0222D71C */ if (_t37) goto L_0222D720; // else: addr-0 trap, fall-through
   L_0222D720: ; // 0x222d720
@@ -23279,8 +23279,8 @@ void Gambit_fn_0222D730(CPUState* cpu) {
         /* 0222D754 */ cpu->ctr = cpu->r[0];
         /* 0222D758 */ cpu->r[31] = cpu->r[3];
         /* 0222D75C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222D760 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222D764 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D760 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222D764 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D764 */ _t8 = _t7 & 0x00000001u;
         /* 0222D764 */ if (_t8) goto L_0222D7F0; else goto L_0222D768;
   L_0222D768: ; // 0x222d768
@@ -23315,8 +23315,8 @@ void Gambit_fn_0222D730(CPUState* cpu) {
         /* 0222D7BC */ cpu->r[3] = cpu->r[31];
         /* 0222D7C0 */ cpu->r[4] = cpu->r[1] + 0x0000000Cu;
         /* 0222D7C4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222D7C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222D7CC */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D7C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222D7CC */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D7CC */ _t17 = _t16 & 0x00000001u;
         /* 0222D7CC */ if (_t17) goto L_0222D7E0; else goto L_0222D7D0;
   L_0222D7D0: ; // 0x222d7d0
@@ -23340,7 +23340,7 @@ void Gambit_fn_0222D730(CPUState* cpu) {
         /* 0222D7F4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t23);
         /* 0222D7F8 */ _t24 = cpu->r[1] + 0x00000028u;
         /* 0222D7F8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t24);
-        /* 0222D7FC */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222D7FC */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222D7FC */ _t26 = _t25 & 0x00000001u;
         /* 0222D7FC */ if (_t26) goto L_0222D800; // else: addr-0 trap, fall-through
   L_0222D800: ; // 0x222d800
@@ -23375,8 +23375,8 @@ void Gambit_fn_0222D734(CPUState* cpu) {
         /* 0222D754 */ cpu->ctr = cpu->r[0];
         /* 0222D758 */ cpu->r[31] = cpu->r[3];
         /* 0222D75C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222D760 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222D764 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D760 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222D764 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D764 */ _t8 = _t7 & 0x00000001u;
         /* 0222D764 */ if (_t8) goto L_0222D7F0; else goto L_0222D768;
   L_0222D768: ; // 0x222d768
@@ -23411,8 +23411,8 @@ void Gambit_fn_0222D734(CPUState* cpu) {
         /* 0222D7BC */ cpu->r[3] = cpu->r[31];
         /* 0222D7C0 */ cpu->r[4] = cpu->r[1] + 0x0000000Cu;
         /* 0222D7C4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222D7C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222D7CC */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D7C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222D7CC */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D7CC */ _t17 = _t16 & 0x00000001u;
         /* 0222D7CC */ if (_t17) goto L_0222D7E0; else goto L_0222D7D0;
   L_0222D7D0: ; // 0x222d7d0
@@ -23436,7 +23436,7 @@ void Gambit_fn_0222D734(CPUState* cpu) {
         /* 0222D7F4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t23);
         /* 0222D7F8 */ _t24 = cpu->r[1] + 0x00000028u;
         /* 0222D7F8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t24);
-        /* 0222D7FC */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222D7FC */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222D7FC */ _t26 = _t25 & 0x00000001u;
         /* 0222D7FC */ if (_t26) goto L_0222D800; // else: addr-0 trap, fall-through
   L_0222D800: ; // 0x222d800
@@ -23486,8 +23486,8 @@ void Gambit_fn_0222D810(CPUState* cpu) {
         /* 0222D860 */ cpu->r[30] = cpu->r[4];
         /* 0222D864 */ cpu->r[31] = cpu->r[5];
         /* 0222D868 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0222D86C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222D870 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D86C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222D870 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D870 */ _t11 = _t10 & 0x00000001u;
         /* 0222D870 */ if (_t11) goto L_0222D878; else goto L_0222D874;
   L_0222D874: ; // 0x222d874
@@ -23503,10 +23503,10 @@ void Gambit_fn_0222D810(CPUState* cpu) {
         /* 0222D88C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0222D890 */ _t14 = cpu->r[28] + 0x00000004u;
         /* 0222D890 */ cpu->r[26] = rbrew_read32(cpu->mem, _t14);
-        /* 0222D894 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0222D894 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0222D898 */ _t15 = cpu->r[26] + 0x00000434u;
         /* 0222D898 */ cpu->r[0] = rbrew_read32(cpu->mem, _t15);
-        /* 0222D89C */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D89C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D89C */ _t17 = _t16 & 0x00000001u;
         /* 0222D89C */ if (_t17) goto L_0222D8A4; else goto L_0222D8A0;
   L_0222D8A0: ; // 0x222d8a0
@@ -23528,14 +23528,14 @@ void Gambit_fn_0222D810(CPUState* cpu) {
         /* 0222D8D4 */ _t19 = cpu->r[8] + 0x0000009Cu;
         /* 0222D8D4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t19);
         /* 0222D8D8 */ cpu->r[10] = 0x101C0000u;
-        /* 0222D8DC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[0]);
+        /* 0222D8DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[0]));
         /* 0222D8E0 */ cpu->r[8] = cpu->r[27] | 0x000000FFu;
         /* 0222D8E4 */ cpu->r[0] = cpu->r[28] + 0x000000B0u;
         /* 0222D8E8 */ cpu->f[4] = cpu->f[1];
         /* 0222D8EC */ _t20 = cpu->r[10] + 0x00001EF8u;
         /* 0222D8EC */ cpu->r[3] = rbrew_read32(cpu->mem, _t20);
         /* 0222D8F0 */ cpu->r[4] = cpu->r[30];
-        /* 0222D8F4 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222D8F4 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222D8F4 */ _t22 = _t21 & 0x00000001u;
         /* 0222D8F4 */ if (_t22) goto L_0222D928; else goto L_0222D8F8;
   L_0222D8F8: ; // 0x222d8f8
@@ -23583,7 +23583,7 @@ void Gambit_fn_0222D810(CPUState* cpu) {
         /* 0222D96C */ _t33 = cpu->r[1] + 0x00000038u;
         /* 0222D96C */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t33);
         /* 0222D970 */ cpu->r[3] = cpu->r[0];
-        /* 0222D974 */ _t34 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222D974 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222D974 */ _t35 = _t34 & 0x00000001u;
         /* 0222D974 */ if (_t35) goto L_0222D978; // else: addr-0 trap, fall-through
   L_0222D978: ; // 0x222d978
@@ -23703,9 +23703,9 @@ void Gambit_fn_0222D9F0(CPUState* cpu) {
         /* 02031BE4 */ _t4 = cpu->r[4] + 0x00000000u;
         /* 02031BE4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t4);
         /* 02031BE8 */ cpu->r[31] = cpu->r[4];
-        /* 02031BEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02031BEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02031BF0 */ cpu->r[30] = cpu->r[3];
-        /* 02031BF4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02031BF4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02031BF4 */ _t6 = _t5 & 0x00000001u;
         /* 02031BF4 */ if (_t6) goto L_02031C58; else goto L_02031BF8;
   L_02031BF8: ; // 0x2031bf8
@@ -23713,8 +23713,8 @@ void Gambit_fn_0222D9F0(CPUState* cpu) {
         /* 02031BF8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
         /* 02031BFC */ _t8 = cpu->r[3] + 0x0000011Cu;
         /* 02031BFC */ cpu->r[11] = rbrew_read8(cpu->mem, _t8);
-        /* 02031C00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02031C04 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02031C00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02031C04 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02031C04 */ _t10 = _t9 & 0x00000001u;
         /* 02031C04 */ if (_t10) goto L_02031C58; else goto L_02031C08;
   L_02031C08: ; // 0x2031c08
@@ -23760,8 +23760,8 @@ void Gambit_fn_0222D9F0(CPUState* cpu) {
         /* 0222D9F0 */ cpu->r[12] = cpu->r[3];
         /* 0222D9F4 */ _t22 = cpu->r[12] + 0x00000080u;
         /* 0222D9F4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t22);
-        /* 0222D9F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222D9FC */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222D9F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222D9FC */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222D9FC */ _t24 = _t23 & 0x00000001u;
         /* 0222D9FC */ if (_t24) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0222D9FC */ goto L_0222DA00;
@@ -23886,8 +23886,8 @@ void Gambit_fn_0222DA90(CPUState* cpu) {
         /* 0222DA90 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 0222DA90 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0222DA94 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000010u, 0x00000010u);
-        /* 0222DA94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222DA98 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222DA94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222DA98 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222DA98 */ _t2 = _t1 & 0x00000001u;
         /* 0222DA98 */ if (_t2) goto L_0222DA9C; else goto L_0222DAC0;
   L_0222DA9C: ; // 0x222da9c
@@ -23941,8 +23941,8 @@ void Gambit_fn_0222DADC(CPUState* cpu) {
         /* 0222DAF0 */ _t3 = cpu->r[31] + 0x00000114u;
         /* 0222DAF0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
         /* 0222DAF4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 0222DAF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0222DAF8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222DAF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0222DAF8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222DAF8 */ _t5 = _t4 & 0x00000001u;
         /* 0222DAF8 */ if (_t5) goto L_0222DB18; else goto L_0222DAFC;
   L_0222DAFC: ; // 0x222dafc
@@ -23981,8 +23981,8 @@ void Gambit_fn_0222DAE0(CPUState* cpu) {
         /* 0222DAF0 */ _t3 = cpu->r[31] + 0x00000114u;
         /* 0222DAF0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
         /* 0222DAF4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 0222DAF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0222DAF8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222DAF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0222DAF8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222DAF8 */ _t5 = _t4 & 0x00000001u;
         /* 0222DAF8 */ if (_t5) goto L_0222DB18; else goto L_0222DAFC;
   L_0222DAFC: ; // 0x222dafc
@@ -24047,9 +24047,9 @@ void Gambit_fn_0222DB2C(CPUState* cpu) {
         /* 0222DB7C */ _t12 = cpu->r[31] + 0x00000114u;
         /* 0222DB7C */ cpu->r[8] = rbrew_read32(cpu->mem, _t12);
         /* 0222DB80 */ cpu->r[8] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x0000000Cu, 0x0000000Du);
-        /* 0222DB80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0222DB80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0222DB84 */ cpu->r[30] = cpu->r[4];
-        /* 0222DB88 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222DB88 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222DB88 */ _t14 = _t13 & 0x00000001u;
         /* 0222DB88 */ if (_t14) goto L_0222E00C; else goto L_0222DB8C;
   L_0222DB8C: ; // 0x222db8c
@@ -24091,13 +24091,13 @@ void Gambit_fn_0222DB2C(CPUState* cpu) {
         /* 0222DBF0 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t23);
         /* 0222DBF4 */ cpu->f[10] = cpu->f[10] - cpu->f[0];
         /* 0222DBF8 */ cpu->r[27] = 0x101C0000u;
-        /* 0222DBFC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[11]);
+        /* 0222DBFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[11]));
         /* 0222DC00 */ cpu->r[28] = cpu->r[28] + 0xFFFF958Cu;
         /* 0222DC04 */ _t24 = cpu->r[1] + 0x00000020u;
         /* 0222DC04 */ rbrew_write_f32(cpu->mem, _t24, cpu->f[10]);
         /* 0222DC08 */ cpu->r[27] = cpu->r[27] + 0x00001EF8u;
         /* 0222DC0C */ cpu->f[29] = cpu->f[31];
-        /* 0222DC10 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222DC10 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222DC10 */ _t26 = _t25 & 0x00000001u;
         /* 0222DC10 */ if (_t26) goto L_0222DC14; else goto L_0222DC74;
   L_0222DC14: ; // 0x222dc14
@@ -24105,15 +24105,15 @@ void Gambit_fn_0222DB2C(CPUState* cpu) {
         /* 0222DC14 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t27);
         /* 0222DC18 */ _t28 = cpu->r[6] + 0x00000004u;
         /* 0222DC18 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t28);
-        /* 0222DC1C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[13]);
-        /* 0222DC20 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222DC1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[13]));
+        /* 0222DC20 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222DC20 */ _t30 = _t29 & 0x00000001u;
         /* 0222DC20 */ if (_t30) goto L_0222DC24; else goto L_0222DC74;
   L_0222DC24: ; // 0x222dc24
         /* 0222DC24 */ _t31 = cpu->r[6] + 0x00000008u;
         /* 0222DC24 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t31);
-        /* 0222DC28 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
-        /* 0222DC2C */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222DC28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
+        /* 0222DC2C */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222DC2C */ _t33 = _t32 & 0x00000001u;
         /* 0222DC2C */ if (_t33) goto L_0222DC30; else goto L_0222DC74;
   L_0222DC30: ; // 0x222dc30
@@ -24135,10 +24135,10 @@ void Gambit_fn_0222DB2C(CPUState* cpu) {
         /* 0222DC5C */ rbrew_write32(cpu->mem, _t37, cpu->r[11]);
         /* 0222DC60 */ Gambit_fn_0204A4DC(cpu);
         /* 0222DC64 */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0222DC64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0222DC64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0222DC68 */ _t38 = cpu->r[1] + 0x0000003Cu;
         /* 0222DC68 */ rbrew_write32(cpu->mem, _t38, cpu->r[3]);
-        /* 0222DC6C */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222DC6C */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222DC6C */ _t40 = _t39 & 0x00000001u;
         /* 0222DC6C */ if (_t40) goto L_0222DF94; else goto L_0222DC70;
   L_0222DC70: ; // 0x222dc70
@@ -24228,14 +24228,14 @@ void Gambit_fn_0222DB2C(CPUState* cpu) {
         /* 0222DD3C */ cpu->r[7] = 0x10050000u;
         /* 0222DD40 */ _t72 = cpu->r[1] + 0x00000010u;
         /* 0222DD40 */ rbrew_write_f32(cpu->mem, _t72, cpu->f[7]);
-        /* 0222DD44 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
+        /* 0222DD44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
         /* 0222DD48 */ _t73 = cpu->r[9] + 0x000000A0u;
         /* 0222DD48 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t73);
         /* 0222DD4C */ _t74 = cpu->r[7] + 0x000000A4u;
         /* 0222DD4C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t74);
         /* 0222DD50 */ _t75 = cpu->r[1] + 0x00000058u;
         /* 0222DD50 */ rbrew_write_f32(cpu->mem, _t75, cpu->f[8]);
-        /* 0222DD54 */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222DD54 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222DD54 */ _t77 = _t76 & 0x00000001u;
         /* 0222DD54 */ if (_t77) goto L_0222DD58; else goto L_0222DD88;
   L_0222DD58: ; // 0x222dd58
@@ -24311,8 +24311,8 @@ void Gambit_fn_0222DB2C(CPUState* cpu) {
         /* 0222DE0C */ _t101 = cpu->r[1] + 0x00000038u;
         /* 0222DE0C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t101);
         /* 0222DE10 */ cpu->f[12] = fma(cpu->f[9], cpu->f[10], cpu->f[7]);
-        /* 0222DE14 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[31]);
-        /* 0222DE18 */ _t102 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222DE14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[31]));
+        /* 0222DE18 */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222DE18 */ _t103 = _t102 & 0x00000001u;
         /* 0222DE18 */ if (_t103) goto L_0222DE1C; else goto L_0222DE50;
   L_0222DE1C: ; // 0x222de1c
@@ -24329,10 +24329,10 @@ void Gambit_fn_0222DB2C(CPUState* cpu) {
         /* 0222DE34 */ cpu->f[9] = cpu->f[5] - cpu->f[7];
         /* 0222DE38 */ cpu->f[12] = fma(cpu->f[11], cpu->f[11], cpu->f[10]);
         /* 0222DE3C */ cpu->f[29] = fma(cpu->f[9], cpu->f[9], cpu->f[12]);
-        /* 0222DE40 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[31]);
+        /* 0222DE40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[31]));
         /* 0222DE44 */ _t108 = cpu->r[1] + 0x0000002Cu;
         /* 0222DE44 */ rbrew_write_f32(cpu->mem, _t108, cpu->f[9]);
-        /* 0222DE48 */ _t109 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222DE48 */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222DE48 */ _t110 = _t109 & 0x00000001u;
         /* 0222DE48 */ if (_t110) goto L_0222DE4C; else goto L_0222DECC;
   L_0222DE4C: ; // 0x222de4c
@@ -24363,10 +24363,10 @@ void Gambit_fn_0222DB2C(CPUState* cpu) {
         /* 0222DE84 */ cpu->f[9] = cpu->f[5] - cpu->f[7];
         /* 0222DE88 */ cpu->f[12] = fma(cpu->f[11], cpu->f[11], cpu->f[10]);
         /* 0222DE8C */ cpu->f[29] = fma(cpu->f[9], cpu->f[9], cpu->f[12]);
-        /* 0222DE90 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[31]);
+        /* 0222DE90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[31]));
         /* 0222DE94 */ _t120 = cpu->r[1] + 0x0000002Cu;
         /* 0222DE94 */ rbrew_write_f32(cpu->mem, _t120, cpu->f[9]);
-        /* 0222DE98 */ _t121 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222DE98 */ _t121 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222DE98 */ _t122 = _t121 & 0x00000001u;
         /* 0222DE98 */ if (_t122) goto L_0222DE9C; else goto L_0222DECC;
   L_0222DE9C: ; // 0x222de9c
@@ -24387,13 +24387,13 @@ void Gambit_fn_0222DB2C(CPUState* cpu) {
         /* 0222DEC8 */ _t126 = cpu->r[1] + 0x0000002Cu;
         /* 0222DEC8 */ rbrew_write_f32(cpu->mem, _t126, cpu->f[13]);
   L_0222DECC: ; // 0x222decc
-        /* 0222DECC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[31]);
+        /* 0222DECC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[31]));
         /* 0222DED0 */ _t127 = cpu->r[27] + 0x00000000u;
         /* 0222DED0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t127);
         /* 0222DED4 */ _t128 = cpu->r[28] + 0x00000000u;
         /* 0222DED4 */ cpu->f[3] = rbrew_read_f32(cpu->mem, _t128);
         /* 0222DED8 */ cpu->r[4] = cpu->r[29];
-        /* 0222DEDC */ _t129 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222DEDC */ _t129 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222DEDC */ _t130 = _t129 & 0x00000001u;
         /* 0222DEDC */ if (_t130) goto L_0222DEE0; else goto L_0222DF1C;
   L_0222DEE0: ; // 0x222dee0
@@ -24411,18 +24411,18 @@ void Gambit_fn_0222DB2C(CPUState* cpu) {
         /* 0222DF04 */ rbrew_write32(cpu->mem, _t132, cpu->r[0]);
         /* 0222DF08 */ Gambit_fn_0204A4DC(cpu);
         /* 0222DF0C */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0222DF0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0222DF0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0222DF10 */ _t133 = cpu->r[1] + 0x0000003Cu;
         /* 0222DF10 */ rbrew_write32(cpu->mem, _t133, cpu->r[3]);
-        /* 0222DF14 */ _t134 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222DF14 */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222DF14 */ _t135 = _t134 & 0x00000001u;
         /* 0222DF14 */ if (_t135) goto L_0222DF94; else goto L_0222DF18;
   L_0222DF18: ; // 0x222df18
         /* 0222DF18 */ goto L_0222DFC8;
   L_0222DF1C: ; // 0x222df1c
         /* 0222DF1C */ cpu->f[1] = cpu->f[29] + cpu->f[28];
-        /* 0222DF20 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
-        /* 0222DF24 */ _t136 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222DF20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
+        /* 0222DF24 */ _t136 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222DF24 */ _t137 = _t136 & 0x00000001u;
         /* 0222DF24 */ if (_t137) goto L_0222DF64; else goto L_0222DF28;
   L_0222DF28: ; // 0x222df28
@@ -24440,10 +24440,10 @@ void Gambit_fn_0222DB2C(CPUState* cpu) {
         /* 0222DF4C */ rbrew_write32(cpu->mem, _t139, cpu->r[0]);
         /* 0222DF50 */ Gambit_fn_0204A4DC(cpu);
         /* 0222DF54 */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0222DF54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0222DF54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0222DF58 */ _t140 = cpu->r[1] + 0x0000003Cu;
         /* 0222DF58 */ rbrew_write32(cpu->mem, _t140, cpu->r[3]);
-        /* 0222DF5C */ _t141 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222DF5C */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222DF5C */ _t142 = _t141 & 0x00000001u;
         /* 0222DF5C */ if (_t142) goto L_0222DF94; else goto L_0222DF60;
   L_0222DF60: ; // 0x222df60
@@ -24461,23 +24461,23 @@ void Gambit_fn_0222DB2C(CPUState* cpu) {
         /* 0222DF80 */ cpu->r[7] = 0x000001FFu;
         /* 0222DF84 */ Gambit_fn_0204A864(cpu);
         /* 0222DF88 */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0222DF88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0222DF88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0222DF8C */ _t145 = cpu->r[1] + 0x0000003Cu;
         /* 0222DF8C */ rbrew_write32(cpu->mem, _t145, cpu->r[3]);
-        /* 0222DF90 */ _t146 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222DF90 */ _t146 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222DF90 */ _t147 = _t146 & 0x00000001u;
         /* 0222DF90 */ if (_t147) goto L_0222DF94; else goto L_0222DFC8;
   L_0222DF94: ; // 0x222df94
         /* 0222DF94 */ cpu->r[3] = 0x101C0000u;
         /* 0222DF98 */ _t148 = cpu->r[3] + 0x00005B90u;
         /* 0222DF98 */ cpu->r[3] = rbrew_read32(cpu->mem, _t148);
-        /* 0222DF9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222DFA0 */ _t149 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222DF9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222DFA0 */ _t149 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222DFA0 */ _t150 = _t149 & 0x00000001u;
         /* 0222DFA0 */ if (_t150) goto L_0222E00C; else goto L_0222DFA4;
   L_0222DFA4: ; // 0x222dfa4
-        /* 0222DFA4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[31]);
-        /* 0222DFA8 */ _t151 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222DFA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[31]));
+        /* 0222DFA8 */ _t151 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222DFA8 */ _t152 = _t151 & 0x00000001u;
         /* 0222DFA8 */ if (_t152) goto L_0222DFAC; else goto L_0222E00C;
   L_0222DFAC: ; // 0x222dfac
@@ -24487,8 +24487,8 @@ void Gambit_fn_0222DB2C(CPUState* cpu) {
         /* 0222DFB4 */ cpu->r[5] = cpu->r[1] + 0x00000024u;
         /* 0222DFB8 */ cpu->r[4] = cpu->r[31] + 0x00000088u;
         /* 0222DFBC */ Gambit_fn_02399D90(cpu);
-        /* 0222DFC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222DFC4 */ _t154 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222DFC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222DFC4 */ _t154 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222DFC4 */ _t155 = _t154 & 0x00000001u;
         /* 0222DFC4 */ if (_t155) goto L_0222E00C; else goto L_0222DFC8;
   L_0222DFC8: ; // 0x222dfc8
@@ -24514,7 +24514,7 @@ void Gambit_fn_0222DB2C(CPUState* cpu) {
         /* 0222DFF0 */ _t165 = cpu->r[1] + 0x000000C0u;
         /* 0222DFF0 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t165);
         /* 0222DFF4 */ cpu->r[3] = 0x00000001u;
-        /* 0222DFF8 */ _t166 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222DFF8 */ _t166 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222DFF8 */ _t167 = _t166 & 0x00000001u;
         /* 0222DFF8 */ if (_t167) goto L_0222DFFC; // else: addr-0 trap, fall-through
   L_0222DFFC: ; // 0x222dffc
@@ -24546,7 +24546,7 @@ void Gambit_fn_0222DB2C(CPUState* cpu) {
         /* 0222E034 */ _t178 = cpu->r[1] + 0x000000C0u;
         /* 0222E034 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t178);
         /* 0222E038 */ cpu->r[3] = 0x00000000u;
-        /* 0222E03C */ _t179 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222E03C */ _t179 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222E03C */ _t180 = _t179 & 0x00000001u;
         /* 0222E03C */ if (_t180) goto L_0222E040; // else: addr-0 trap, fall-through
   L_0222E040: ; // 0x222e040
@@ -24603,8 +24603,8 @@ void Gambit_fn_0222E050(CPUState* cpu) {
         /* 0222E0B4 */ cpu->f[30] = cpu->f[10] - cpu->f[31];
         /* 0222E0B8 */ _t12 = cpu->r[9] + 0x0000009Cu;
         /* 0222E0B8 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t12);
-        /* 0222E0BC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
-        /* 0222E0C0 */ _t13 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222E0BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
+        /* 0222E0C0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222E0C0 */ _t14 = _t13 & 0x00000001u;
         /* 0222E0C0 */ if (_t14) goto L_0222E0C4; else goto L_0222E1C8;
   L_0222E0C4: ; // 0x222e0c4
@@ -24633,7 +24633,7 @@ void Gambit_fn_0222E050(CPUState* cpu) {
         /* 0222E104 */ cpu->r[11] = rbrew_read32(cpu->mem, _t20);
         /* 0222E108 */ _t21 = cpu->r[1] + 0x00000010u;
         /* 0222E108 */ cpu->r[12] = rbrew_read32(cpu->mem, _t21);
-        /* 0222E10C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
+        /* 0222E10C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
         /* 0222E110 */ _t22 = cpu->r[1] + 0x00000014u;
         /* 0222E110 */ rbrew_write_f32(cpu->mem, _t22, cpu->f[8]);
         /* 0222E114 */ _t23 = cpu->r[1] + 0x00000014u;
@@ -24649,7 +24649,7 @@ void Gambit_fn_0222E050(CPUState* cpu) {
         /* 0222E12C */ cpu->r[4] = cpu->r[31] + 0x00000088u;
         /* 0222E130 */ _t27 = cpu->r[1] + 0x00000030u;
         /* 0222E130 */ rbrew_write32(cpu->mem, _t27, cpu->r[0]);
-        /* 0222E134 */ _t28 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222E134 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222E134 */ _t29 = _t28 & 0x00000001u;
         /* 0222E134 */ if (_t29) goto L_0222E198; else goto L_0222E138;
   L_0222E138: ; // 0x222e138
@@ -24667,8 +24667,8 @@ void Gambit_fn_0222E050(CPUState* cpu) {
         /* 0222E15C */ rbrew_write32(cpu->mem, _t31, cpu->r[0]);
         /* 0222E160 */ Gambit_fn_0204A4DC(cpu);
         /* 0222E164 */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0222E164 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222E168 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E164 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222E168 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E168 */ _t33 = _t32 & 0x00000001u;
         /* 0222E168 */ if (_t33) goto L_0222E16C; else goto L_0222E1C8;
   L_0222E16C: ; // 0x222e16c
@@ -24683,7 +24683,7 @@ void Gambit_fn_0222E050(CPUState* cpu) {
         /* 0222E17C */ _t38 = cpu->r[1] + 0x00000034u;
         /* 0222E17C */ cpu->r[31] = rbrew_read32(cpu->mem, _t38);
         /* 0222E180 */ cpu->r[3] = 0x00000000u;
-        /* 0222E184 */ _t39 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222E184 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222E184 */ _t40 = _t39 & 0x00000001u;
         /* 0222E184 */ if (_t40) goto L_0222E188; // else: addr-0 trap, fall-through
   L_0222E188: ; // 0x222e188
@@ -24706,8 +24706,8 @@ void Gambit_fn_0222E050(CPUState* cpu) {
         /* 0222E1B8 */ cpu->r[9] = cpu->r[1] + 0x00000018u;
         /* 0222E1BC */ Gambit_fn_0204A864(cpu);
         /* 0222E1C0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0222E1C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222E1C4 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E1C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222E1C4 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E1C4 */ _t45 = _t44 & 0x00000001u;
         /* 0222E1C4 */ if (_t45) goto L_0222E16C; else goto L_0222E1C8;
   L_0222E1C8: ; // 0x222e1c8
@@ -24722,7 +24722,7 @@ void Gambit_fn_0222E050(CPUState* cpu) {
         /* 0222E1D8 */ _t50 = cpu->r[1] + 0x00000034u;
         /* 0222E1D8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t50);
         /* 0222E1DC */ cpu->r[3] = 0x00000001u;
-        /* 0222E1E0 */ _t51 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222E1E0 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222E1E0 */ _t52 = _t51 & 0x00000001u;
         /* 0222E1E0 */ if (_t52) goto L_0222E1E4; // else: addr-0 trap, fall-through
   L_0222E1E4: ; // 0x222e1e4
@@ -24778,8 +24778,8 @@ void Gambit_fn_0222E054(CPUState* cpu) {
         /* 0222E0B4 */ cpu->f[30] = cpu->f[10] - cpu->f[31];
         /* 0222E0B8 */ _t12 = cpu->r[9] + 0x0000009Cu;
         /* 0222E0B8 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t12);
-        /* 0222E0BC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
-        /* 0222E0C0 */ _t13 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222E0BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
+        /* 0222E0C0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222E0C0 */ _t14 = _t13 & 0x00000001u;
         /* 0222E0C0 */ if (_t14) goto L_0222E0C4; else goto L_0222E1C8;
   L_0222E0C4: ; // 0x222e0c4
@@ -24808,7 +24808,7 @@ void Gambit_fn_0222E054(CPUState* cpu) {
         /* 0222E104 */ cpu->r[11] = rbrew_read32(cpu->mem, _t20);
         /* 0222E108 */ _t21 = cpu->r[1] + 0x00000010u;
         /* 0222E108 */ cpu->r[12] = rbrew_read32(cpu->mem, _t21);
-        /* 0222E10C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
+        /* 0222E10C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
         /* 0222E110 */ _t22 = cpu->r[1] + 0x00000014u;
         /* 0222E110 */ rbrew_write_f32(cpu->mem, _t22, cpu->f[8]);
         /* 0222E114 */ _t23 = cpu->r[1] + 0x00000014u;
@@ -24824,7 +24824,7 @@ void Gambit_fn_0222E054(CPUState* cpu) {
         /* 0222E12C */ cpu->r[4] = cpu->r[31] + 0x00000088u;
         /* 0222E130 */ _t27 = cpu->r[1] + 0x00000030u;
         /* 0222E130 */ rbrew_write32(cpu->mem, _t27, cpu->r[0]);
-        /* 0222E134 */ _t28 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222E134 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222E134 */ _t29 = _t28 & 0x00000001u;
         /* 0222E134 */ if (_t29) goto L_0222E198; else goto L_0222E138;
   L_0222E138: ; // 0x222e138
@@ -24842,8 +24842,8 @@ void Gambit_fn_0222E054(CPUState* cpu) {
         /* 0222E15C */ rbrew_write32(cpu->mem, _t31, cpu->r[0]);
         /* 0222E160 */ Gambit_fn_0204A4DC(cpu);
         /* 0222E164 */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0222E164 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222E168 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E164 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222E168 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E168 */ _t33 = _t32 & 0x00000001u;
         /* 0222E168 */ if (_t33) goto L_0222E16C; else goto L_0222E1C8;
   L_0222E16C: ; // 0x222e16c
@@ -24858,7 +24858,7 @@ void Gambit_fn_0222E054(CPUState* cpu) {
         /* 0222E17C */ _t38 = cpu->r[1] + 0x00000034u;
         /* 0222E17C */ cpu->r[31] = rbrew_read32(cpu->mem, _t38);
         /* 0222E180 */ cpu->r[3] = 0x00000000u;
-        /* 0222E184 */ _t39 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222E184 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222E184 */ _t40 = _t39 & 0x00000001u;
         /* 0222E184 */ if (_t40) goto L_0222E188; // else: addr-0 trap, fall-through
   L_0222E188: ; // 0x222e188
@@ -24881,8 +24881,8 @@ void Gambit_fn_0222E054(CPUState* cpu) {
         /* 0222E1B8 */ cpu->r[9] = cpu->r[1] + 0x00000018u;
         /* 0222E1BC */ Gambit_fn_0204A864(cpu);
         /* 0222E1C0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0222E1C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222E1C4 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E1C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222E1C4 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E1C4 */ _t45 = _t44 & 0x00000001u;
         /* 0222E1C4 */ if (_t45) goto L_0222E16C; else goto L_0222E1C8;
   L_0222E1C8: ; // 0x222e1c8
@@ -24897,7 +24897,7 @@ void Gambit_fn_0222E054(CPUState* cpu) {
         /* 0222E1D8 */ _t50 = cpu->r[1] + 0x00000034u;
         /* 0222E1D8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t50);
         /* 0222E1DC */ cpu->r[3] = 0x00000001u;
-        /* 0222E1E0 */ _t51 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222E1E0 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222E1E0 */ _t52 = _t51 & 0x00000001u;
         /* 0222E1E0 */ if (_t52) goto L_0222E1E4; // else: addr-0 trap, fall-through
   L_0222E1E4: ; // 0x222e1e4
@@ -24930,16 +24930,16 @@ void Gambit_fn_0222E1F4(CPUState* cpu) {
         /* 0222E214 */ _t5 = cpu->r[31] + 0x00000114u;
         /* 0222E214 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 0222E218 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000000Fu, 0x0000000Fu);
-        /* 0222E218 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0222E218 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0222E21C */ cpu->f[31] = cpu->f[1];
-        /* 0222E220 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E220 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E220 */ _t7 = _t6 & 0x00000001u;
         /* 0222E220 */ if (_t7) goto L_0222E224; else goto L_0222E2B8;
   L_0222E224: ; // 0x222e224
         /* 0222E224 */ _t8 = cpu->r[31] + 0x00000114u;
         /* 0222E224 */ cpu->r[0] = rbrew_read8(cpu->mem, _t8);
-        /* 0222E228 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000001Eu);
-        /* 0222E22C */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222E228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000001Eu));
+        /* 0222E22C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222E22C */ _t10 = _t9 & 0x00000001u;
         /* 0222E22C */ if (_t10) goto L_0222E2B8; else goto L_0222E230;
   L_0222E230: ; // 0x222e230
@@ -24955,8 +24955,8 @@ void Gambit_fn_0222E1F4(CPUState* cpu) {
         /* 0222E248 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t13);
         /* 0222E24C */ _t14 = cpu->r[12] + 0x0000009Cu;
         /* 0222E24C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t14);
-        /* 0222E250 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 0222E254 */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222E250 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 0222E254 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222E254 */ _t16 = _t15 & 0x00000001u;
         /* 0222E254 */ if (_t16) goto L_0222E258; else goto L_0222E2B8;
   L_0222E258: ; // 0x222e258
@@ -24974,8 +24974,8 @@ void Gambit_fn_0222E1F4(CPUState* cpu) {
         /* 0222E278 */ _t20 = cpu->r[3] + 0x00000000u;
         /* 0222E278 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t20);
         /* 0222E27C */ cpu->f[0] = fma(cpu->f[0], cpu->f[0], cpu->f[13]);
-        /* 0222E280 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[12]);
-        /* 0222E284 */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222E280 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[12]));
+        /* 0222E284 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222E284 */ _t22 = _t21 & 0x00000001u;
         /* 0222E284 */ if (_t22) goto L_0222E288; else goto L_0222E2B8;
   L_0222E288: ; // 0x222e288
@@ -24986,8 +24986,8 @@ void Gambit_fn_0222E1F4(CPUState* cpu) {
         /* 0222E294 */ _t24 = cpu->r[31] + 0x00000114u;
         /* 0222E294 */ rbrew_write32(cpu->mem, _t24, cpu->r[0]);
         /* 0222E298 */ Gambit_fn_0222E050(cpu);
-        /* 0222E29C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E2A0 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E29C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E2A0 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E2A0 */ _t26 = _t25 & 0x00000001u;
         /* 0222E2A0 */ if (_t26) goto L_0222E2A4; else goto L_0222E2B8;
   L_0222E2A4: ; // 0x222e2a4
@@ -25005,7 +25005,7 @@ void Gambit_fn_0222E1F4(CPUState* cpu) {
         /* 0222E2BC */ cpu->r[31] = rbrew_read32(cpu->mem, _t30);
         /* 0222E2C0 */ _t31 = cpu->r[1] + 0x00000010u;
         /* 0222E2C0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t31);
-        /* 0222E2C4 */ _t32 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222E2C4 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222E2C4 */ _t33 = _t32 & 0x00000001u;
         /* 0222E2C4 */ if (_t33) goto L_0222E2C8; // else: addr-0 trap, fall-through
   L_0222E2C8: ; // 0x222e2c8
@@ -25037,16 +25037,16 @@ void Gambit_fn_0222E1F8(CPUState* cpu) {
         /* 0222E214 */ _t5 = cpu->r[31] + 0x00000114u;
         /* 0222E214 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 0222E218 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000000Fu, 0x0000000Fu);
-        /* 0222E218 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0222E218 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0222E21C */ cpu->f[31] = cpu->f[1];
-        /* 0222E220 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E220 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E220 */ _t7 = _t6 & 0x00000001u;
         /* 0222E220 */ if (_t7) goto L_0222E224; else goto L_0222E2B8;
   L_0222E224: ; // 0x222e224
         /* 0222E224 */ _t8 = cpu->r[31] + 0x00000114u;
         /* 0222E224 */ cpu->r[0] = rbrew_read8(cpu->mem, _t8);
-        /* 0222E228 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000001Eu);
-        /* 0222E22C */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222E228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000001Eu));
+        /* 0222E22C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222E22C */ _t10 = _t9 & 0x00000001u;
         /* 0222E22C */ if (_t10) goto L_0222E2B8; else goto L_0222E230;
   L_0222E230: ; // 0x222e230
@@ -25062,8 +25062,8 @@ void Gambit_fn_0222E1F8(CPUState* cpu) {
         /* 0222E248 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t13);
         /* 0222E24C */ _t14 = cpu->r[12] + 0x0000009Cu;
         /* 0222E24C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t14);
-        /* 0222E250 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 0222E254 */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222E250 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 0222E254 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222E254 */ _t16 = _t15 & 0x00000001u;
         /* 0222E254 */ if (_t16) goto L_0222E258; else goto L_0222E2B8;
   L_0222E258: ; // 0x222e258
@@ -25081,8 +25081,8 @@ void Gambit_fn_0222E1F8(CPUState* cpu) {
         /* 0222E278 */ _t20 = cpu->r[3] + 0x00000000u;
         /* 0222E278 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t20);
         /* 0222E27C */ cpu->f[0] = fma(cpu->f[0], cpu->f[0], cpu->f[13]);
-        /* 0222E280 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[12]);
-        /* 0222E284 */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222E280 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[12]));
+        /* 0222E284 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222E284 */ _t22 = _t21 & 0x00000001u;
         /* 0222E284 */ if (_t22) goto L_0222E288; else goto L_0222E2B8;
   L_0222E288: ; // 0x222e288
@@ -25093,8 +25093,8 @@ void Gambit_fn_0222E1F8(CPUState* cpu) {
         /* 0222E294 */ _t24 = cpu->r[31] + 0x00000114u;
         /* 0222E294 */ rbrew_write32(cpu->mem, _t24, cpu->r[0]);
         /* 0222E298 */ Gambit_fn_0222E050(cpu);
-        /* 0222E29C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E2A0 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E29C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E2A0 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E2A0 */ _t26 = _t25 & 0x00000001u;
         /* 0222E2A0 */ if (_t26) goto L_0222E2A4; else goto L_0222E2B8;
   L_0222E2A4: ; // 0x222e2a4
@@ -25112,7 +25112,7 @@ void Gambit_fn_0222E1F8(CPUState* cpu) {
         /* 0222E2BC */ cpu->r[31] = rbrew_read32(cpu->mem, _t30);
         /* 0222E2C0 */ _t31 = cpu->r[1] + 0x00000010u;
         /* 0222E2C0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t31);
-        /* 0222E2C4 */ _t32 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222E2C4 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222E2C4 */ _t33 = _t32 & 0x00000001u;
         /* 0222E2C4 */ if (_t33) goto L_0222E2C8; // else: addr-0 trap, fall-through
   L_0222E2C8: ; // 0x222e2c8
@@ -25140,15 +25140,15 @@ void Gambit_fn_0222E2D8(CPUState* cpu) {
         /* 0222E2EC */ _t3 = cpu->r[31] + 0x00000114u;
         /* 0222E2EC */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
         /* 0222E2F0 */ cpu->r[12] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x0000000Fu, 0x0000000Fu);
-        /* 0222E2F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0222E2F4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E2F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0222E2F4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E2F4 */ _t5 = _t4 & 0x00000001u;
         /* 0222E2F4 */ if (_t5) goto L_0222E2F8; else goto L_0222E334;
   L_0222E2F8: ; // 0x222e2f8
         /* 0222E2F8 */ _t6 = cpu->r[31] + 0x00000114u;
         /* 0222E2F8 */ cpu->r[9] = rbrew_read8(cpu->mem, _t6);
-        /* 0222E2FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x0000000Au);
-        /* 0222E300 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222E2FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x0000000Au));
+        /* 0222E300 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222E300 */ _t8 = _t7 & 0x00000001u;
         /* 0222E300 */ if (_t8) goto L_0222E334; else goto L_0222E304;
   L_0222E304: ; // 0x222e304
@@ -25159,8 +25159,8 @@ void Gambit_fn_0222E2D8(CPUState* cpu) {
         /* 0222E310 */ _t10 = cpu->r[31] + 0x00000114u;
         /* 0222E310 */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
         /* 0222E314 */ Gambit_fn_0222E050(cpu);
-        /* 0222E318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E31C */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E31C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E31C */ _t12 = _t11 & 0x00000001u;
         /* 0222E31C */ if (_t12) goto L_0222E320; else goto L_0222E334;
   L_0222E320: ; // 0x222e320
@@ -25197,15 +25197,15 @@ void Gambit_fn_0222E2DC(CPUState* cpu) {
         /* 0222E2EC */ _t3 = cpu->r[31] + 0x00000114u;
         /* 0222E2EC */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
         /* 0222E2F0 */ cpu->r[12] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x0000000Fu, 0x0000000Fu);
-        /* 0222E2F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0222E2F4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E2F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0222E2F4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E2F4 */ _t5 = _t4 & 0x00000001u;
         /* 0222E2F4 */ if (_t5) goto L_0222E2F8; else goto L_0222E334;
   L_0222E2F8: ; // 0x222e2f8
         /* 0222E2F8 */ _t6 = cpu->r[31] + 0x00000114u;
         /* 0222E2F8 */ cpu->r[9] = rbrew_read8(cpu->mem, _t6);
-        /* 0222E2FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x0000000Au);
-        /* 0222E300 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222E2FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x0000000Au));
+        /* 0222E300 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222E300 */ _t8 = _t7 & 0x00000001u;
         /* 0222E300 */ if (_t8) goto L_0222E334; else goto L_0222E304;
   L_0222E304: ; // 0x222e304
@@ -25216,8 +25216,8 @@ void Gambit_fn_0222E2DC(CPUState* cpu) {
         /* 0222E310 */ _t10 = cpu->r[31] + 0x00000114u;
         /* 0222E310 */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
         /* 0222E314 */ Gambit_fn_0222E050(cpu);
-        /* 0222E318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E31C */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E31C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E31C */ _t12 = _t11 & 0x00000001u;
         /* 0222E31C */ if (_t12) goto L_0222E320; else goto L_0222E334;
   L_0222E320: ; // 0x222e320
@@ -25260,10 +25260,10 @@ void Gambit_fn_0222E348(CPUState* cpu) {
         /* 0222E364 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t4);
         /* 0222E368 */ cpu->f[7] = fma(cpu->f[9], cpu->f[9], cpu->f[0]);
         /* 0222E36C */ cpu->r[10] = 0x10050000u;
-        /* 0222E370 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[12]);
+        /* 0222E370 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[12]));
         /* 0222E374 */ _t5 = cpu->r[10] + 0x000000A4u;
         /* 0222E374 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t5);
-        /* 0222E378 */ _t6 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222E378 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222E378 */ _t7 = _t6 & 0x00000001u;
         /* 0222E378 */ if (_t7) goto L_0222E3A0; else goto L_0222E37C;
   L_0222E37C: ; // 0x222e37c
@@ -25274,10 +25274,10 @@ void Gambit_fn_0222E348(CPUState* cpu) {
         /* 0222E388 */ _t9 = cpu->r[1] + 0x0000000Cu;
         /* 0222E388 */ rbrew_write_f32(cpu->mem, _t9, cpu->f[8]);
         /* 0222E38C */ cpu->f[7] = cpu->f[7] / cpu->f[0];
-        /* 0222E390 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[10]);
+        /* 0222E390 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[10]));
         /* 0222E394 */ _t10 = cpu->r[1] + 0x00000008u;
         /* 0222E394 */ rbrew_write_f32(cpu->mem, _t10, cpu->f[9]);
-        /* 0222E398 */ _t11 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222E398 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222E398 */ _t12 = _t11 & 0x00000001u;
         /* 0222E398 */ if (_t12) goto L_0222E3DC; else goto L_0222E39C;
   L_0222E39C: ; // 0x222e39c
@@ -25301,10 +25301,10 @@ void Gambit_fn_0222E348(CPUState* cpu) {
         /* 0222E3C8 */ rbrew_write_f32(cpu->mem, _t17, cpu->f[8]);
         /* 0222E3CC */ _t18 = cpu->r[5] + 0x00000000u;
         /* 0222E3CC */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t18);
-        /* 0222E3D0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[10]);
+        /* 0222E3D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[10]));
         /* 0222E3D4 */ _t19 = cpu->r[1] + 0x00000008u;
         /* 0222E3D4 */ rbrew_write_f32(cpu->mem, _t19, cpu->f[9]);
-        /* 0222E3D8 */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222E3D8 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222E3D8 */ _t21 = _t20 & 0x00000001u;
         /* 0222E3D8 */ if (_t21) goto L_0222E3DC; else goto L_0222E3E0;
   L_0222E3DC: ; // 0x222e3dc
@@ -25312,8 +25312,8 @@ void Gambit_fn_0222E348(CPUState* cpu) {
   L_0222E3E0: ; // 0x222e3e0
         /* 0222E3E0 */ cpu->f[11] = cpu->f[8] * cpu->f[8];
         /* 0222E3E4 */ cpu->f[9] = fma(cpu->f[9], cpu->f[9], cpu->f[11]);
-        /* 0222E3E8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[12]);
-        /* 0222E3EC */ _t22 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222E3E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[12]));
+        /* 0222E3EC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222E3EC */ _t23 = _t22 & 0x00000001u;
         /* 0222E3EC */ if (_t23) goto L_0222E3F0; else goto L_0222E414;
   L_0222E3F0: ; // 0x222e3f0
@@ -25352,8 +25352,8 @@ void Gambit_fn_0222E42C(CPUState* cpu) {
         /* 0222E434 */ _t1 = cpu->r[11] + 0x00006338u;
         /* 0222E434 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t1);
         /* 0222E434 */ cpu->r[11] = _t1;
-        /* 0222E438 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 0222E43C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E438 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 0222E43C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E43C */ _t3 = _t2 & 0x00000001u;
         /* 0222E43C */ if (_t3) goto L_0222E440; else goto L_0222E450;
   L_0222E440: ; // 0x222e440
@@ -25361,8 +25361,8 @@ void Gambit_fn_0222E42C(CPUState* cpu) {
         /* 0222E440 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t4);
         /* 0222E444 */ _t5 = cpu->r[11] + 0x00000004u;
         /* 0222E444 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t5);
-        /* 0222E448 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[9]);
-        /* 0222E44C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E448 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[9]));
+        /* 0222E44C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E44C */ _t7 = _t6 & 0x00000001u;
         /* 0222E44C */ if (_t7) goto L_0222E484; else goto L_0222E450;
   L_0222E450: ; // 0x222e450
@@ -25378,8 +25378,8 @@ void Gambit_fn_0222E42C(CPUState* cpu) {
         /* 0222E46C */ cpu->f[12] = fma(cpu->f[11], cpu->f[8], cpu->f[9]);
         /* 0222E470 */ _t10 = cpu->r[12] + 0x0000009Cu;
         /* 0222E470 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t10);
-        /* 0222E474 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[0]);
-        /* 0222E478 */ _t11 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222E474 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[0]));
+        /* 0222E478 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222E478 */ _t12 = _t11 & 0x00000001u;
         /* 0222E478 */ if (_t12) goto L_0222E4BC; else goto L_0222E47C;
   L_0222E47C: ; // 0x222e47c
@@ -25390,8 +25390,8 @@ void Gambit_fn_0222E42C(CPUState* cpu) {
         /* 0222E484 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t13);
         /* 0222E488 */ _t14 = cpu->r[11] + 0x00000008u;
         /* 0222E488 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t14);
-        /* 0222E48C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[10]);
-        /* 0222E490 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E48C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[10]));
+        /* 0222E490 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E490 */ _t16 = _t15 & 0x00000001u;
         /* 0222E490 */ if (_t16) goto L_0222E47C; else goto L_0222E494;
   L_0222E494: ; // 0x222e494
@@ -25405,8 +25405,8 @@ void Gambit_fn_0222E42C(CPUState* cpu) {
         /* 0222E4AC */ cpu->f[12] = fma(cpu->f[11], cpu->f[8], cpu->f[9]);
         /* 0222E4B0 */ _t18 = cpu->r[12] + 0x0000009Cu;
         /* 0222E4B0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t18);
-        /* 0222E4B4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[0]);
-        /* 0222E4B8 */ _t19 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222E4B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[0]));
+        /* 0222E4B8 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222E4B8 */ _t20 = _t19 & 0x00000001u;
         /* 0222E4B8 */ if (_t20) goto L_0222E4BC; else goto L_0222E47C;
   L_0222E4BC: ; // 0x222e4bc
@@ -25426,8 +25426,8 @@ void Gambit_fn_0222E4C4(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -25459,8 +25459,8 @@ void Gambit_fn_0222E4CC(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t0;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t2 = _t1 & 0x00000001u;
         /* 0222E4D8 */ if (_t2) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -25490,14 +25490,14 @@ void Gambit_fn_0222E50C(CPUState* cpu) {
   L_0222E50C: ; // 0x222e50c
         /* 0222E50C */ _t0 = cpu->r[4] + 0x00000000u;
         /* 0222E50C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 0222E510 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000003u);
+        /* 0222E510 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000003u));
         /* 0222E514 */ cpu->r[0] = 0x00000001u;
-        /* 0222E518 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E518 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E518 */ _t2 = _t1 & 0x00000001u;
         /* 0222E518 */ if (_t2) goto L_0222E528; else goto L_0222E51C;
   L_0222E51C: ; // 0x222e51c
-        /* 0222E51C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000001u);
-        /* 0222E520 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E51C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000001u));
+        /* 0222E520 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E520 */ _t4 = _t3 & 0x00000001u;
         /* 0222E520 */ if (_t4) goto L_0222E528; else goto L_0222E524;
   L_0222E524: ; // 0x222e524
@@ -25554,9 +25554,9 @@ void Gambit_fn_0222E540(CPUState* cpu) {
         /* 0222E584 */ cpu->r[10] = cpu->r[28] + cpu->r[11];
         /* 0222E588 */ _t8 = cpu->r[10] + 0x00000104u;
         /* 0222E588 */ cpu->r[4] = rbrew_read8(cpu->mem, _t8);
-        /* 0222E58C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 0222E58C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 0222E590 */ cpu->r[7] = cpu->r[3];
-        /* 0222E594 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E594 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E594 */ _t10 = _t9 & 0x00000001u;
         /* 0222E594 */ if (_t10) goto L_0222E614; else goto L_0222E598;
   L_0222E598: ; // 0x222e598
@@ -25565,8 +25565,8 @@ void Gambit_fn_0222E540(CPUState* cpu) {
         /* 0222E5A0 */ cpu->r[3] = cpu->r[28];
         /* 0222E5A4 */ Gambit_fn_021F000C(cpu);
         /* 0222E5A8 */ cpu->r[28] = cpu->r[3];
-        /* 0222E5A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 0222E5AC */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E5A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 0222E5AC */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E5AC */ _t12 = _t11 & 0x00000001u;
         /* 0222E5AC */ if (_t12) goto L_0222E614; else goto L_0222E5B0;
   L_0222E5B0: ; // 0x222e5b0
@@ -25867,17 +25867,17 @@ void Gambit_fn_0222E628(CPUState* cpu) {
         /* 0222E83C */ cpu->r[10] = rbrew_read32(cpu->mem, _t100);
         /* 0222E840 */ _t101 = cpu->r[11] + 0x000000A8u;
         /* 0222E840 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t101);
-        /* 0222E844 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u);
+        /* 0222E844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u));
         /* 0222E848 */ _t102 = cpu->r[31] + 0x000000ACu;
         /* 0222E848 */ rbrew_write32(cpu->mem, _t102, cpu->r[10]);
-        /* 0222E84C */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E84C */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E84C */ _t104 = _t103 & 0x00000001u;
         /* 0222E84C */ if (_t104) goto L_0222E850; else goto L_0222E860;
   L_0222E850: ; // 0x222e850
         /* 0222E850 */ cpu->r[3] = 0x00000010u;
         /* 0222E854 */ Gambit_fn_02801A78(cpu);
-        /* 0222E858 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E85C */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E858 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E85C */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E85C */ _t106 = _t105 & 0x00000001u;
         /* 0222E85C */ if (_t106) goto L_0222E870; else goto L_0222E860;
   L_0222E860: ; // 0x222e860
@@ -25890,16 +25890,16 @@ void Gambit_fn_0222E628(CPUState* cpu) {
         /* 0222E86C */ _t110 = cpu->r[3] + 0x0000000Cu;
         /* 0222E86C */ rbrew_write_f32(cpu->mem, _t110, cpu->f[30]);
   L_0222E870: ; // 0x222e870
-        /* 0222E870 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u);
+        /* 0222E870 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u));
         /* 0222E874 */ cpu->r[3] = cpu->r[31] + 0x000000D0u;
-        /* 0222E878 */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E878 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E878 */ _t112 = _t111 & 0x00000001u;
         /* 0222E878 */ if (_t112) goto L_0222E87C; else goto L_0222E88C;
   L_0222E87C: ; // 0x222e87c
         /* 0222E87C */ cpu->r[3] = 0x00000010u;
         /* 0222E880 */ Gambit_fn_02801A78(cpu);
-        /* 0222E884 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E888 */ _t113 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E884 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E888 */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E888 */ _t114 = _t113 & 0x00000001u;
         /* 0222E888 */ if (_t114) goto L_0222E89C; else goto L_0222E88C;
   L_0222E88C: ; // 0x222e88c
@@ -25947,7 +25947,7 @@ void Gambit_fn_0222E628(CPUState* cpu) {
         /* 0222E8E0 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t133);
         /* 0222E8E4 */ _t134 = cpu->r[1] + 0x00000058u;
         /* 0222E8E4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t134);
-        /* 0222E8E8 */ _t135 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222E8E8 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222E8E8 */ _t136 = _t135 & 0x00000001u;
         /* 0222E8E8 */ if (_t136) goto L_0222E8EC; // else: addr-0 trap, fall-through
   L_0222E8EC: ; // 0x222e8ec
@@ -26019,8 +26019,8 @@ void Gambit_fn_0222E920(CPUState* cpu) {
   L_0222E920: ; // 0x222e920
         /* 0222E920 */ _t0 = cpu->r[3] + 0x00000008u;
         /* 0222E920 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 0222E924 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0222E928 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E924 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0222E928 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E928 */ _t2 = _t1 & 0x00000001u;
         /* 0222E928 */ if (_t2) goto L_0222E934; else goto L_0222E92C;
   L_0222E92C: ; // 0x222e92c
@@ -26038,8 +26038,8 @@ void Gambit_fn_0222E93C(CPUState* cpu) {
   L_0222E93C: ; // 0x222e93c
         /* 0222E93C */ _t0 = cpu->r[3] + 0x00000008u;
         /* 0222E93C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 0222E940 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0222E944 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0222E944 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E944 */ _t2 = _t1 & 0x00000001u;
         /* 0222E944 */ if (_t2) goto L_0222E950; else goto L_0222E948;
   L_0222E948: ; // 0x222e948
@@ -26058,8 +26058,8 @@ void Gambit_fn_0222E958(CPUState* cpu) {
         /* 0222E958 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0222E958 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0222E95C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 0222E95C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0222E960 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E95C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0222E960 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E960 */ _t2 = _t1 & 0x00000001u;
         /* 0222E960 */ _t3 = _t2 ^ 0x00000001u;
         /* 0222E960 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -26081,8 +26081,8 @@ void Gambit_fn_0222E974(CPUState* cpu) {
         /* 0222E974 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0222E974 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0222E978 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 0222E978 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0222E97C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E978 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0222E97C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E97C */ _t2 = _t1 & 0x00000001u;
         /* 0222E97C */ _t3 = _t2 ^ 0x00000001u;
         /* 0222E97C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -26104,8 +26104,8 @@ void Gambit_fn_0222E990(CPUState* cpu) {
         /* 0222E990 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0222E990 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0222E994 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 0222E994 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0222E998 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E994 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0222E998 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E998 */ _t2 = _t1 & 0x00000001u;
         /* 0222E998 */ _t3 = _t2 ^ 0x00000001u;
         /* 0222E998 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -26148,8 +26148,8 @@ void Gambit_fn_0222E9BC(CPUState* cpu) {
         /* 0222E9CC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0222E9D0 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0222E9D0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0222E9D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0222E9D8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E9D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0222E9D8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E9D8 */ _t5 = _t4 & 0x00000001u;
         /* 0222E9D8 */ if (_t5) goto L_0222E9DC; else goto L_0222E9F8;
   L_0222E9DC: ; // 0x222e9dc
@@ -26188,8 +26188,8 @@ void Gambit_fn_0222E9C0(CPUState* cpu) {
         /* 0222E9CC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0222E9D0 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0222E9D0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0222E9D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0222E9D8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E9D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0222E9D8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E9D8 */ _t5 = _t4 & 0x00000001u;
         /* 0222E9D8 */ if (_t5) goto L_0222E9DC; else goto L_0222E9F8;
   L_0222E9DC: ; // 0x222e9dc
@@ -39,9 +39,9 @@ void Gambit_fn_0222EAEC(CPUState* cpu) {
         /* 0222EAF0 */ _t0 = cpu->r[9] + 0xFFFFDA00u;
         /* 0222EAF0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t0);
         /* 0222EAF4 */ cpu->r[11] = 0x101D0000u;
-        /* 0222EAF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0222EAF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0222EAFC */ cpu->r[11] = cpu->r[11] + 0xFFFFFBFCu;
-        /* 0222EB00 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222EB00 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222EB00 */ _t2 = _t1 & 0x00000001u;
         /* 0222EB00 */ if (_t2) goto L_0222EB04; else goto L_0222EB1C;
   L_0222EB04: ; // 0x222eb04
@@ -54,8 +54,8 @@ void Gambit_fn_0222EAEC(CPUState* cpu) {
         /* 0222EB18 */ _t4 = cpu->r[11] + 0x00000000u;
         /* 0222EB18 */ rbrew_write32(cpu->mem, _t4, cpu->r[9]);
   L_0222EB1C: ; // 0x222eb1c
-        /* 0222EB1C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 0222EB20 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222EB1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 0222EB20 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222EB20 */ _t6 = _t5 & 0x00000001u;
         /* 0222EB20 */ if (_t6) goto L_0222EB24; else goto L_0222EB2C;
   L_0222EB24: ; // 0x222eb24
@@ -65,10 +65,10 @@ void Gambit_fn_0222EAEC(CPUState* cpu) {
         /* 0222EB2C */ cpu->r[12] = 0x101D0000u;
         /* 0222EB30 */ _t7 = cpu->r[12] + 0xFFFFD9ECu;
         /* 0222EB30 */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 0222EB34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0222EB34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0222EB38 */ cpu->r[12] = 0x101D0000u;
         /* 0222EB3C */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 0222EB40 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222EB40 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222EB40 */ _t9 = _t8 & 0x00000001u;
         /* 0222EB40 */ if (_t9) goto L_0222EB44; else goto L_0222EB5C;
   L_0222EB44: ; // 0x222eb44
@@ -81,8 +81,8 @@ void Gambit_fn_0222EAEC(CPUState* cpu) {
         /* 0222EB58 */ _t11 = cpu->r[12] + 0x00000000u;
         /* 0222EB58 */ rbrew_write32(cpu->mem, _t11, cpu->r[11]);
   L_0222EB5C: ; // 0x222eb5c
-        /* 0222EB5C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0222EB60 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222EB5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0222EB60 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222EB60 */ _t13 = _t12 & 0x00000001u;
         /* 0222EB60 */ if (_t13) goto L_0222EB64; else goto L_0222EB6C;
   L_0222EB64: ; // 0x222eb64
@@ -94,9 +94,9 @@ void Gambit_fn_0222EAEC(CPUState* cpu) {
         /* 0222EB70 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 0222EB70 */ cpu->r[10] = _t14;
         /* 0222EB74 */ cpu->r[11] = 0x101D0000u;
-        /* 0222EB78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0222EB78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0222EB7C */ cpu->r[11] = cpu->r[11] + 0xFFFFD4ECu;
-        /* 0222EB80 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222EB80 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222EB80 */ _t16 = _t15 & 0x00000001u;
         /* 0222EB80 */ if (_t16) goto L_0222EB84; else goto L_0222EB98;
   L_0222EB84: ; // 0x222eb84
@@ -108,8 +108,8 @@ void Gambit_fn_0222EAEC(CPUState* cpu) {
         /* 0222EB94 */ _t18 = cpu->r[11] + 0x00000000u;
         /* 0222EB94 */ rbrew_write32(cpu->mem, _t18, cpu->r[9]);
   L_0222EB98: ; // 0x222eb98
-        /* 0222EB98 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 0222EB9C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222EB98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 0222EB9C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222EB9C */ _t20 = _t19 & 0x00000001u;
         /* 0222EB9C */ if (_t20) goto L_0222EBA0; else goto L_0222EBA8;
   L_0222EBA0: ; // 0x222eba0
@@ -121,9 +121,9 @@ void Gambit_fn_0222EAEC(CPUState* cpu) {
         /* 0222EBAC */ cpu->r[10] = rbrew_read32(cpu->mem, _t21);
         /* 0222EBAC */ cpu->r[9] = _t21;
         /* 0222EBB0 */ cpu->r[12] = 0x101D0000u;
-        /* 0222EBB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0222EBB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0222EBB8 */ cpu->r[12] = cpu->r[12] + 0xFFFFD4E4u;
-        /* 0222EBBC */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222EBBC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222EBBC */ _t23 = _t22 & 0x00000001u;
         /* 0222EBBC */ if (_t23) goto L_0222EBC0; else goto L_0222EBD4;
   L_0222EBC0: ; // 0x222ebc0
@@ -392,8 +392,8 @@ void Gambit_fn_0222ECE4(CPUState* cpu) {
         /* 0222ECE4 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 0222ECE4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0222ECE8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0222ECE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222ECEC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222ECE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222ECEC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222ECEC */ _t2 = _t1 & 0x00000001u;
         /* 0222ECEC */ if (_t2) goto L_0222ECFC; else goto L_0222ECF0;
   L_0222ECF0: ; // 0x222ecf0
@@ -420,8 +420,8 @@ void Gambit_fn_0222ED08(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -478,15 +478,15 @@ void Gambit_fn_0222ED2C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0222ED2C: ; // 0x222ed2c
-        /* 0222ED2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222ED30 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222ED2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222ED30 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222ED30 */ _t1 = _t0 & 0x00000001u;
         /* 0222ED30 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0222ED30 */ goto L_0222ED34;
   L_0222ED34: ; // 0x222ed34
         /* 0222ED34 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0222ED34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222ED38 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222ED34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222ED38 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222ED38 */ _t3 = _t2 & 0x00000001u;
         /* 0222ED38 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0222ED38 */ goto L_0222ED3C;
@@ -505,8 +505,8 @@ void Gambit_fn_0222ED2C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -520,15 +520,15 @@ void Gambit_fn_0222ED2C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -556,15 +556,15 @@ void Gambit_fn_0222ED40(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0222ED40: ; // 0x222ed40
-        /* 0222ED40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222ED44 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222ED40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222ED44 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222ED44 */ _t1 = _t0 & 0x00000001u;
         /* 0222ED44 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0222ED44 */ goto L_0222ED48;
   L_0222ED48: ; // 0x222ed48
         /* 0222ED48 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0222ED48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222ED4C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222ED48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222ED4C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222ED4C */ _t3 = _t2 & 0x00000001u;
         /* 0222ED4C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0222ED4C */ goto L_0222ED50;
@@ -583,8 +583,8 @@ void Gambit_fn_0222ED40(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -598,15 +598,15 @@ void Gambit_fn_0222ED40(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -641,18 +641,18 @@ void Gambit_fn_0222ED54(CPUState* cpu) {
         /* 0222ED5C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0222ED5C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0222ED60 */ cpu->r[31] = cpu->r[3];
-        /* 0222ED60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0222ED60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0222ED64 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0222ED64 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0222ED68 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222ED68 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222ED68 */ _t4 = _t3 & 0x00000001u;
         /* 0222ED68 */ if (_t4) goto L_0222ED6C; else goto L_0222ED7C;
   L_0222ED6C: ; // 0x222ed6c
         /* 0222ED6C */ cpu->r[3] = 0x00000174u;
         /* 0222ED70 */ Gambit_fn_02801A78(cpu);
         /* 0222ED74 */ cpu->r[31] = cpu->r[3];
-        /* 0222ED74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0222ED78 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222ED74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0222ED78 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222ED78 */ _t6 = _t5 & 0x00000001u;
         /* 0222ED78 */ if (_t6) goto L_0222EE04; else goto L_0222ED7C;
   L_0222ED7C: ; // 0x222ed7c
@@ -671,10 +671,10 @@ void Gambit_fn_0222ED54(CPUState* cpu) {
         /* 0222EDA0 */ _t10 = cpu->r[31] + 0x00000004u;
         /* 0222EDA0 */ rbrew_write32(cpu->mem, _t10, cpu->r[9]);
         /* 0222EDA4 */ cpu->r[12] = cpu->r[31] + 0x00000130u;
-        /* 0222EDA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0222EDA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0222EDA8 */ _t11 = cpu->r[31] + 0x0000012Cu;
         /* 0222EDA8 */ rbrew_write_f32(cpu->mem, _t11, cpu->f[13]);
-        /* 0222EDAC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222EDAC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222EDAC */ _t13 = _t12 & 0x00000001u;
         /* 0222EDAC */ if (_t13) goto L_0222EDB0; else goto L_0222EDB8;
   L_0222EDB0: ; // 0x222edb0
@@ -682,8 +682,8 @@ void Gambit_fn_0222ED54(CPUState* cpu) {
         /* 0222EDB4 */ Gambit_fn_02801A78(cpu);
   L_0222EDB8: ; // 0x222edb8
         /* 0222EDB8 */ cpu->r[0] = cpu->r[31] + 0x00000160u;
-        /* 0222EDB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222EDBC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222EDB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222EDBC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222EDBC */ _t15 = _t14 & 0x00000001u;
         /* 0222EDBC */ if (_t15) goto L_0222EDC0; else goto L_0222EDC8;
   L_0222EDC0: ; // 0x222edc0
@@ -692,17 +692,17 @@ void Gambit_fn_0222ED54(CPUState* cpu) {
   L_0222EDC8: ; // 0x222edc8
         /* 0222EDC8 */ cpu->r[9] = 0x00000001u;
         /* 0222EDCC */ cpu->r[3] = cpu->r[31] + 0x0000016Eu;
-        /* 0222EDCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0222EDCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0222EDD0 */ _t16 = cpu->r[31] + 0x0000016Cu;
         /* 0222EDD0 */ rbrew_write8(cpu->mem, _t16, (uint8_t)cpu->r[9]);
-        /* 0222EDD4 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222EDD4 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222EDD4 */ _t18 = _t17 & 0x00000001u;
         /* 0222EDD4 */ if (_t18) goto L_0222EDD8; else goto L_0222EDE8;
   L_0222EDD8: ; // 0x222edd8
         /* 0222EDD8 */ cpu->r[3] = 0x00000004u;
         /* 0222EDDC */ Gambit_fn_02801A78(cpu);
-        /* 0222EDE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222EDE4 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222EDE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222EDE4 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222EDE4 */ _t20 = _t19 & 0x00000001u;
         /* 0222EDE4 */ if (_t20) goto L_0222EE04; else goto L_0222EDE8;
   L_0222EDE8: ; // 0x222ede8
@@ -741,18 +741,18 @@ void Gambit_fn_0222ED58(CPUState* cpu) {
         /* 0222ED5C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0222ED5C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0222ED60 */ cpu->r[31] = cpu->r[3];
-        /* 0222ED60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0222ED60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0222ED64 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0222ED64 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0222ED68 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222ED68 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222ED68 */ _t4 = _t3 & 0x00000001u;
         /* 0222ED68 */ if (_t4) goto L_0222ED6C; else goto L_0222ED7C;
   L_0222ED6C: ; // 0x222ed6c
         /* 0222ED6C */ cpu->r[3] = 0x00000174u;
         /* 0222ED70 */ Gambit_fn_02801A78(cpu);
         /* 0222ED74 */ cpu->r[31] = cpu->r[3];
-        /* 0222ED74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0222ED78 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222ED74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0222ED78 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222ED78 */ _t6 = _t5 & 0x00000001u;
         /* 0222ED78 */ if (_t6) goto L_0222EE04; else goto L_0222ED7C;
   L_0222ED7C: ; // 0x222ed7c
@@ -771,10 +771,10 @@ void Gambit_fn_0222ED58(CPUState* cpu) {
         /* 0222EDA0 */ _t10 = cpu->r[31] + 0x00000004u;
         /* 0222EDA0 */ rbrew_write32(cpu->mem, _t10, cpu->r[9]);
         /* 0222EDA4 */ cpu->r[12] = cpu->r[31] + 0x00000130u;
-        /* 0222EDA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0222EDA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0222EDA8 */ _t11 = cpu->r[31] + 0x0000012Cu;
         /* 0222EDA8 */ rbrew_write_f32(cpu->mem, _t11, cpu->f[13]);
-        /* 0222EDAC */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222EDAC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222EDAC */ _t13 = _t12 & 0x00000001u;
         /* 0222EDAC */ if (_t13) goto L_0222EDB0; else goto L_0222EDB8;
   L_0222EDB0: ; // 0x222edb0
@@ -782,8 +782,8 @@ void Gambit_fn_0222ED58(CPUState* cpu) {
         /* 0222EDB4 */ Gambit_fn_02801A78(cpu);
   L_0222EDB8: ; // 0x222edb8
         /* 0222EDB8 */ cpu->r[0] = cpu->r[31] + 0x00000160u;
-        /* 0222EDB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222EDBC */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222EDB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222EDBC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222EDBC */ _t15 = _t14 & 0x00000001u;
         /* 0222EDBC */ if (_t15) goto L_0222EDC0; else goto L_0222EDC8;
   L_0222EDC0: ; // 0x222edc0
@@ -792,17 +792,17 @@ void Gambit_fn_0222ED58(CPUState* cpu) {
   L_0222EDC8: ; // 0x222edc8
         /* 0222EDC8 */ cpu->r[9] = 0x00000001u;
         /* 0222EDCC */ cpu->r[3] = cpu->r[31] + 0x0000016Eu;
-        /* 0222EDCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0222EDCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0222EDD0 */ _t16 = cpu->r[31] + 0x0000016Cu;
         /* 0222EDD0 */ rbrew_write8(cpu->mem, _t16, (uint8_t)cpu->r[9]);
-        /* 0222EDD4 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222EDD4 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222EDD4 */ _t18 = _t17 & 0x00000001u;
         /* 0222EDD4 */ if (_t18) goto L_0222EDD8; else goto L_0222EDE8;
   L_0222EDD8: ; // 0x222edd8
         /* 0222EDD8 */ cpu->r[3] = 0x00000004u;
         /* 0222EDDC */ Gambit_fn_02801A78(cpu);
-        /* 0222EDE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222EDE4 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222EDE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222EDE4 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222EDE4 */ _t20 = _t19 & 0x00000001u;
         /* 0222EDE4 */ if (_t20) goto L_0222EE04; else goto L_0222EDE8;
   L_0222EDE8: ; // 0x222ede8
@@ -1025,7 +1025,7 @@ void Gambit_fn_0222EE1C(CPUState* cpu) {
         /* 0222EFD4 */ cpu->f[26] = rbrew_read_f64(cpu->mem, _t74);
         /* 0222EFD8 */ _t75 = cpu->r[1] + 0x000000D0u;
         /* 0222EFD8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t75);
-        /* 0222EFDC */ _t76 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222EFDC */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222EFDC */ _t77 = _t76 & 0x00000001u;
         /* 0222EFDC */ if (_t77) goto L_0222EFE0; // else: addr-0 trap, fall-through
   L_0222EFE0: ; // 0x222efe0
@@ -1149,8 +1149,8 @@ void Gambit_fn_0222F028(CPUState* cpu) {
         /* 0222F09C */ cpu->f[8] = fma(cpu->f[10], cpu->f[10], cpu->f[9]);
         /* 0222F0A0 */ _t17 = cpu->r[10] + 0x000005FCu;
         /* 0222F0A0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t17);
-        /* 0222F0A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
-        /* 0222F0A8 */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222F0A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
+        /* 0222F0A8 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222F0A8 */ _t19 = _t18 & 0x00000001u;
         /* 0222F0A8 */ if (_t19) goto L_0222F0AC; else goto L_0222F0E8;
   L_0222F0AC: ; // 0x222f0ac
@@ -1194,8 +1194,8 @@ void Gambit_fn_0222F028(CPUState* cpu) {
         /* 0222F114 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 0222F118 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 0222F11C */ Gambit_fn_021C6DD8(cpu);
-        /* 0222F120 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222F124 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F120 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222F124 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F124 */ _t31 = _t30 & 0x00000001u;
         /* 0222F124 */ if (_t31) goto L_0222F128; else goto L_0222F13C;
   L_0222F128: ; // 0x222f128
@@ -1311,8 +1311,8 @@ void Gambit_fn_0222F02C(CPUState* cpu) {
         /* 0222F09C */ cpu->f[8] = fma(cpu->f[10], cpu->f[10], cpu->f[9]);
         /* 0222F0A0 */ _t17 = cpu->r[10] + 0x000005FCu;
         /* 0222F0A0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t17);
-        /* 0222F0A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
-        /* 0222F0A8 */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222F0A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
+        /* 0222F0A8 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222F0A8 */ _t19 = _t18 & 0x00000001u;
         /* 0222F0A8 */ if (_t19) goto L_0222F0AC; else goto L_0222F0E8;
   L_0222F0AC: ; // 0x222f0ac
@@ -1356,8 +1356,8 @@ void Gambit_fn_0222F02C(CPUState* cpu) {
         /* 0222F114 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 0222F118 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 0222F11C */ Gambit_fn_021C6DD8(cpu);
-        /* 0222F120 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222F124 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F120 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222F124 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F124 */ _t31 = _t30 & 0x00000001u;
         /* 0222F124 */ if (_t31) goto L_0222F128; else goto L_0222F13C;
   L_0222F128: ; // 0x222f128
@@ -1427,8 +1427,8 @@ void Gambit_fn_0222F1BC(CPUState* cpu) {
         /* 0222F1BC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0222F1C0 */ _t1 = cpu->r[5] + 0x00000000u;
         /* 0222F1C0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t1);
-        /* 0222F1C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[0]);
-        /* 0222F1C8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F1C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[0]));
+        /* 0222F1C8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F1C8 */ _t3 = _t2 & 0x00000001u;
         /* 0222F1C8 */ if (_t3) goto L_0222F1CC; else goto L_0222F1D8;
   L_0222F1CC: ; // 0x222f1cc
@@ -1520,7 +1520,7 @@ void Gambit_fn_0222F210(CPUState* cpu) {
         /* 0222F240 */ cpu->r[0] = _t9 | _t8;
         /* 0222F244 */ _t10 = cpu->r[1] + 0x0000000Cu;
         /* 0222F244 */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
-        /* 0222F248 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[4]);
+        /* 0222F248 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[4]));
         /* 0222F24C */ _t11 = cpu->r[1] + 0x0000000Fu;
         /* 0222F24C */ rbrew_write8(cpu->mem, _t11, (uint8_t)cpu->r[11]);
         /* 0222F250 */ _t12 = cpu->r[10] + 0x00000000u;
@@ -1529,15 +1529,15 @@ void Gambit_fn_0222F210(CPUState* cpu) {
         /* 0222F254 */ cpu->r[30] = rbrew_read32(cpu->mem, _t13);
         /* 0222F258 */ _t14 = cpu->r[1] + 0x00000010u;
         /* 0222F258 */ rbrew_write32(cpu->mem, _t14, cpu->r[0]);
-        /* 0222F25C */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222F25C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222F25C */ _t16 = _t15 & 0x00000001u;
         /* 0222F25C */ if (_t16) goto L_0222F298; else goto L_0222F260;
   L_0222F260: ; // 0x222f260
         /* 0222F260 */ cpu->r[11] = 0x10050000u;
         /* 0222F264 */ _t17 = cpu->r[11] + 0x00000608u;
         /* 0222F264 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t17);
-        /* 0222F268 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[4], cpu->f[0]);
-        /* 0222F26C */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222F268 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[4], cpu->f[0]));
+        /* 0222F26C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222F26C */ _t19 = _t18 & 0x00000001u;
         /* 0222F26C */ if (_t19) goto L_0222F298; else goto L_0222F270;
   L_0222F270: ; // 0x222f270
@@ -1579,16 +1579,16 @@ void Gambit_fn_0222F210(CPUState* cpu) {
         /* 0222F2CC */ cpu->f[9] = rbrew_read_f64(cpu->mem, _t30);
         /* 0222F2D0 */ cpu->f[12] = cpu->f[9] - cpu->f[11];
         /* 0222F2D4 */ cpu->f[0] = (double)(float)cpu->f[12];
-        /* 0222F2D8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[8]);
-        /* 0222F2DC */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F2D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[8]));
+        /* 0222F2DC */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F2DC */ _t32 = _t31 & 0x00000001u;
         /* 0222F2DC */ if (_t32) goto L_0222F2F4; else goto L_0222F2E0;
   L_0222F2E0: ; // 0x222f2e0
         /* 0222F2E0 */ cpu->r[11] = 0x10050000u;
         /* 0222F2E4 */ _t33 = cpu->r[11] + 0x000005FCu;
         /* 0222F2E4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t33);
-        /* 0222F2E8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[10]);
-        /* 0222F2EC */ _t34 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222F2E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[10]));
+        /* 0222F2EC */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222F2EC */ _t35 = _t34 & 0x00000001u;
         /* 0222F2EC */ if (_t35) goto L_0222F2F4; else goto L_0222F2F0;
   L_0222F2F0: ; // 0x222f2f0
@@ -1650,7 +1650,7 @@ void Gambit_fn_0222F214(CPUState* cpu) {
         /* 0222F240 */ cpu->r[0] = _t9 | _t8;
         /* 0222F244 */ _t10 = cpu->r[1] + 0x0000000Cu;
         /* 0222F244 */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
-        /* 0222F248 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[4]);
+        /* 0222F248 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[4]));
         /* 0222F24C */ _t11 = cpu->r[1] + 0x0000000Fu;
         /* 0222F24C */ rbrew_write8(cpu->mem, _t11, (uint8_t)cpu->r[11]);
         /* 0222F250 */ _t12 = cpu->r[10] + 0x00000000u;
@@ -1659,15 +1659,15 @@ void Gambit_fn_0222F214(CPUState* cpu) {
         /* 0222F254 */ cpu->r[30] = rbrew_read32(cpu->mem, _t13);
         /* 0222F258 */ _t14 = cpu->r[1] + 0x00000010u;
         /* 0222F258 */ rbrew_write32(cpu->mem, _t14, cpu->r[0]);
-        /* 0222F25C */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222F25C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222F25C */ _t16 = _t15 & 0x00000001u;
         /* 0222F25C */ if (_t16) goto L_0222F298; else goto L_0222F260;
   L_0222F260: ; // 0x222f260
         /* 0222F260 */ cpu->r[11] = 0x10050000u;
         /* 0222F264 */ _t17 = cpu->r[11] + 0x00000608u;
         /* 0222F264 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t17);
-        /* 0222F268 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[4], cpu->f[0]);
-        /* 0222F26C */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222F268 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[4], cpu->f[0]));
+        /* 0222F26C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222F26C */ _t19 = _t18 & 0x00000001u;
         /* 0222F26C */ if (_t19) goto L_0222F298; else goto L_0222F270;
   L_0222F270: ; // 0x222f270
@@ -1709,16 +1709,16 @@ void Gambit_fn_0222F214(CPUState* cpu) {
         /* 0222F2CC */ cpu->f[9] = rbrew_read_f64(cpu->mem, _t30);
         /* 0222F2D0 */ cpu->f[12] = cpu->f[9] - cpu->f[11];
         /* 0222F2D4 */ cpu->f[0] = (double)(float)cpu->f[12];
-        /* 0222F2D8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[8]);
-        /* 0222F2DC */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F2D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[8]));
+        /* 0222F2DC */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F2DC */ _t32 = _t31 & 0x00000001u;
         /* 0222F2DC */ if (_t32) goto L_0222F2F4; else goto L_0222F2E0;
   L_0222F2E0: ; // 0x222f2e0
         /* 0222F2E0 */ cpu->r[11] = 0x10050000u;
         /* 0222F2E4 */ _t33 = cpu->r[11] + 0x000005FCu;
         /* 0222F2E4 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t33);
-        /* 0222F2E8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[10]);
-        /* 0222F2EC */ _t34 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222F2E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[10]));
+        /* 0222F2EC */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222F2EC */ _t35 = _t34 & 0x00000001u;
         /* 0222F2EC */ if (_t35) goto L_0222F2F4; else goto L_0222F2F0;
   L_0222F2F0: ; // 0x222f2f0
@@ -1783,8 +1783,8 @@ void Gambit_fn_0222F344(CPUState* cpu) {
         /* 0222F354 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0222F358 */ _t3 = cpu->r[31] + 0x0000016Cu;
         /* 0222F358 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 0222F35C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222F360 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F35C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222F360 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F360 */ _t5 = _t4 & 0x00000001u;
         /* 0222F360 */ if (_t5) goto L_0222F49C; else goto L_0222F364;
   L_0222F364: ; // 0x222f364
@@ -1827,8 +1827,8 @@ void Gambit_fn_0222F344(CPUState* cpu) {
         /* 0222F3BC */ cpu->f[11] = fma(cpu->f[13], cpu->f[13], cpu->f[10]);
         /* 0222F3C0 */ _t20 = cpu->r[11] + 0x000005FCu;
         /* 0222F3C0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t20);
-        /* 0222F3C4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[12]);
-        /* 0222F3C8 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222F3C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[12]));
+        /* 0222F3C8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222F3C8 */ _t22 = _t21 & 0x00000001u;
         /* 0222F3C8 */ if (_t22) goto L_0222F3CC; else goto L_0222F408;
   L_0222F3CC: ; // 0x222f3cc
@@ -1859,8 +1859,8 @@ void Gambit_fn_0222F344(CPUState* cpu) {
         /* 0222F410 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 0222F414 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 0222F418 */ Gambit_fn_021C6DD8(cpu);
-        /* 0222F41C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222F420 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F41C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222F420 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F420 */ _t30 = _t29 & 0x00000001u;
         /* 0222F420 */ if (_t30) goto L_0222F424; else goto L_0222F438;
   L_0222F424: ; // 0x222f424
@@ -1936,8 +1936,8 @@ void Gambit_fn_0222F348(CPUState* cpu) {
         /* 0222F354 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0222F358 */ _t3 = cpu->r[31] + 0x0000016Cu;
         /* 0222F358 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 0222F35C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222F360 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F35C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222F360 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F360 */ _t5 = _t4 & 0x00000001u;
         /* 0222F360 */ if (_t5) goto L_0222F49C; else goto L_0222F364;
   L_0222F364: ; // 0x222f364
@@ -1980,8 +1980,8 @@ void Gambit_fn_0222F348(CPUState* cpu) {
         /* 0222F3BC */ cpu->f[11] = fma(cpu->f[13], cpu->f[13], cpu->f[10]);
         /* 0222F3C0 */ _t20 = cpu->r[11] + 0x000005FCu;
         /* 0222F3C0 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t20);
-        /* 0222F3C4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[12]);
-        /* 0222F3C8 */ _t21 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222F3C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[12]));
+        /* 0222F3C8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222F3C8 */ _t22 = _t21 & 0x00000001u;
         /* 0222F3C8 */ if (_t22) goto L_0222F3CC; else goto L_0222F408;
   L_0222F3CC: ; // 0x222f3cc
@@ -2012,8 +2012,8 @@ void Gambit_fn_0222F348(CPUState* cpu) {
         /* 0222F410 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 0222F414 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 0222F418 */ Gambit_fn_021C6DD8(cpu);
-        /* 0222F41C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222F420 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F41C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222F420 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F420 */ _t30 = _t29 & 0x00000001u;
         /* 0222F420 */ if (_t30) goto L_0222F424; else goto L_0222F438;
   L_0222F424: ; // 0x222f424
@@ -2129,8 +2129,8 @@ void Gambit_fn_0222F4D0(CPUState* cpu) {
         /* 0222F4D0 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0222F4D0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0222F4D4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 0222F4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0222F4D8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0222F4D8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F4D8 */ _t2 = _t1 & 0x00000001u;
         /* 0222F4D8 */ _t3 = _t2 ^ 0x00000001u;
         /* 0222F4D8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -2152,8 +2152,8 @@ void Gambit_fn_0222F4EC(CPUState* cpu) {
         /* 0222F4EC */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0222F4EC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0222F4F0 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 0222F4F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0222F4F4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F4F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0222F4F4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F4F4 */ _t2 = _t1 & 0x00000001u;
         /* 0222F4F4 */ _t3 = _t2 ^ 0x00000001u;
         /* 0222F4F4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -2175,8 +2175,8 @@ void Gambit_fn_0222F508(CPUState* cpu) {
         /* 0222F508 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0222F508 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0222F50C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 0222F50C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0222F510 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F50C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0222F510 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F510 */ _t2 = _t1 & 0x00000001u;
         /* 0222F510 */ _t3 = _t2 ^ 0x00000001u;
         /* 0222F510 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -2219,8 +2219,8 @@ void Gambit_fn_0222F534(CPUState* cpu) {
         /* 0222F544 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0222F548 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0222F548 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0222F54C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0222F550 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F54C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0222F550 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F550 */ _t5 = _t4 & 0x00000001u;
         /* 0222F550 */ if (_t5) goto L_0222F554; else goto L_0222F570;
   L_0222F554: ; // 0x222f554
@@ -2259,8 +2259,8 @@ void Gambit_fn_0222F538(CPUState* cpu) {
         /* 0222F544 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0222F548 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0222F548 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0222F54C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0222F550 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F54C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0222F550 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F550 */ _t5 = _t4 & 0x00000001u;
         /* 0222F550 */ if (_t5) goto L_0222F554; else goto L_0222F570;
   L_0222F554: ; // 0x222f554
@@ -2721,8 +2721,8 @@ void Gambit_fn_0222F748(CPUState* cpu) {
         /* 0222F748 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 0222F748 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0222F74C */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0222F74C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0222F750 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F74C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0222F750 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F750 */ _t2 = _t1 & 0x00000001u;
         /* 0222F750 */ if (_t2) goto L_0222F760; else goto L_0222F754;
   L_0222F754: ; // 0x222f754
@@ -2749,8 +2749,8 @@ void Gambit_fn_0222F76C(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -2811,10 +2811,10 @@ void Gambit_fn_0222F794(CPUState* cpu) {
         /* 0222F794 */ cpu->r[10] = 0x101D0000u;
         /* 0222F798 */ _t0 = cpu->r[10] + 0xFFFFDA0Cu;
         /* 0222F798 */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 0222F79C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0222F79C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0222F7A0 */ cpu->r[10] = 0x101D0000u;
         /* 0222F7A4 */ cpu->r[10] = cpu->r[10] + 0xFFFFFC00u;
-        /* 0222F7A8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F7A8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F7A8 */ _t2 = _t1 & 0x00000001u;
         /* 0222F7A8 */ if (_t2) goto L_0222F7AC; else goto L_0222F7C4;
   L_0222F7AC: ; // 0x222f7ac
@@ -2827,8 +2827,8 @@ void Gambit_fn_0222F794(CPUState* cpu) {
         /* 0222F7C0 */ _t4 = cpu->r[10] + 0x00000000u;
         /* 0222F7C0 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_0222F7C4: ; // 0x222f7c4
-        /* 0222F7C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0222F7C8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F7C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0222F7C8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F7C8 */ _t6 = _t5 & 0x00000001u;
         /* 0222F7C8 */ if (_t6) goto L_0222F7CC; else goto L_0222F7D4;
   L_0222F7CC: ; // 0x222f7cc
@@ -2839,9 +2839,9 @@ void Gambit_fn_0222F794(CPUState* cpu) {
         /* 0222F7D8 */ _t7 = cpu->r[9] + 0xFFFFDA00u;
         /* 0222F7D8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 0222F7DC */ cpu->r[11] = 0x101D0000u;
-        /* 0222F7E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0222F7E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0222F7E4 */ cpu->r[11] = cpu->r[11] + 0xFFFFFBFCu;
-        /* 0222F7E8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F7E8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F7E8 */ _t9 = _t8 & 0x00000001u;
         /* 0222F7E8 */ if (_t9) goto L_0222F7EC; else goto L_0222F804;
   L_0222F7EC: ; // 0x222f7ec
@@ -2854,8 +2854,8 @@ void Gambit_fn_0222F794(CPUState* cpu) {
         /* 0222F800 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 0222F800 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_0222F804: ; // 0x222f804
-        /* 0222F804 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 0222F808 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F804 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 0222F808 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F808 */ _t13 = _t12 & 0x00000001u;
         /* 0222F808 */ if (_t13) goto L_0222F80C; else goto L_0222F814;
   L_0222F80C: ; // 0x222f80c
@@ -2866,9 +2866,9 @@ void Gambit_fn_0222F794(CPUState* cpu) {
         /* 0222F818 */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 0222F818 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 0222F81C */ cpu->r[9] = 0x101D0000u;
-        /* 0222F820 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0222F820 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0222F824 */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 0222F828 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F828 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F828 */ _t16 = _t15 & 0x00000001u;
         /* 0222F828 */ if (_t16) goto L_0222F82C; else goto L_0222F844;
   L_0222F82C: ; // 0x222f82c
@@ -2881,8 +2881,8 @@ void Gambit_fn_0222F794(CPUState* cpu) {
         /* 0222F840 */ _t18 = cpu->r[9] + 0x00000000u;
         /* 0222F840 */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_0222F844: ; // 0x222f844
-        /* 0222F844 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 0222F848 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 0222F848 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F848 */ _t20 = _t19 & 0x00000001u;
         /* 0222F848 */ if (_t20) goto L_0222F84C; else goto L_0222F854;
   L_0222F84C: ; // 0x222f84c
@@ -2894,9 +2894,9 @@ void Gambit_fn_0222F794(CPUState* cpu) {
         /* 0222F858 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 0222F858 */ cpu->r[9] = _t21;
         /* 0222F85C */ cpu->r[10] = 0x101D0000u;
-        /* 0222F860 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0222F860 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0222F864 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 0222F868 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F868 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F868 */ _t23 = _t22 & 0x00000001u;
         /* 0222F868 */ if (_t23) goto L_0222F86C; else goto L_0222F880;
   L_0222F86C: ; // 0x222f86c
@@ -2908,8 +2908,8 @@ void Gambit_fn_0222F794(CPUState* cpu) {
         /* 0222F87C */ _t25 = cpu->r[10] + 0x00000000u;
         /* 0222F87C */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_0222F880: ; // 0x222f880
-        /* 0222F880 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0222F884 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F880 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0222F884 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F884 */ _t27 = _t26 & 0x00000001u;
         /* 0222F884 */ if (_t27) goto L_0222F888; else goto L_0222F890;
   L_0222F888: ; // 0x222f888
@@ -2921,9 +2921,9 @@ void Gambit_fn_0222F794(CPUState* cpu) {
         /* 0222F894 */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 0222F894 */ cpu->r[10] = _t28;
         /* 0222F898 */ cpu->r[11] = 0x101D0000u;
-        /* 0222F89C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0222F89C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0222F8A0 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 0222F8A4 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F8A4 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F8A4 */ _t30 = _t29 & 0x00000001u;
         /* 0222F8A4 */ if (_t30) goto L_0222F8A8; else goto L_0222F8BC;
   L_0222F8A8: ; // 0x222f8a8
@@ -2995,18 +2995,18 @@ void Gambit_fn_0222F900(CPUState* cpu) {
         /* 0222F90C */ _t3 = cpu->r[1] + 0x00000010u;
         /* 0222F90C */ rbrew_write32(cpu->mem, _t3, cpu->r[30]);
         /* 0222F910 */ cpu->r[31] = cpu->r[3];
-        /* 0222F910 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0222F910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0222F914 */ _t4 = cpu->r[1] + 0x0000001Cu;
         /* 0222F914 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
-        /* 0222F918 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F918 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F918 */ _t6 = _t5 & 0x00000001u;
         /* 0222F918 */ if (_t6) goto L_0222F91C; else goto L_0222F92C;
   L_0222F91C: ; // 0x222f91c
         /* 0222F91C */ cpu->r[3] = 0x00000238u;
         /* 0222F920 */ Gambit_fn_02801A78(cpu);
         /* 0222F924 */ cpu->r[31] = cpu->r[3];
-        /* 0222F924 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0222F928 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F924 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0222F928 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F928 */ _t8 = _t7 & 0x00000001u;
         /* 0222F928 */ if (_t8) goto L_0222F9B0; else goto L_0222F92C;
   L_0222F92C: ; // 0x222f92c
@@ -3014,33 +3014,33 @@ void Gambit_fn_0222F900(CPUState* cpu) {
         /* 0222F930 */ Gambit_fn_021D8244(cpu);
         /* 0222F934 */ cpu->r[11] = 0x10050000u;
         /* 0222F938 */ cpu->r[29] = cpu->r[31] + 0x00000184u;
-        /* 0222F938 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 0222F938 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0222F93C */ cpu->r[11] = cpu->r[11] + 0x00000B80u;
         /* 0222F940 */ cpu->r[30] = 0x00000000u;
         /* 0222F944 */ _t9 = cpu->r[31] + 0x00000004u;
         /* 0222F944 */ rbrew_write32(cpu->mem, _t9, cpu->r[11]);
-        /* 0222F948 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F948 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F948 */ _t11 = _t10 & 0x00000001u;
         /* 0222F948 */ if (_t11) goto L_0222F94C; else goto L_0222F95C;
   L_0222F94C: ; // 0x222f94c
         /* 0222F94C */ cpu->r[3] = 0x000000ACu;
         /* 0222F950 */ Gambit_fn_02801A78(cpu);
         /* 0222F954 */ cpu->r[29] = cpu->r[3];
-        /* 0222F954 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0222F958 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F954 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0222F958 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F958 */ _t13 = _t12 & 0x00000001u;
         /* 0222F958 */ if (_t13) goto L_0222F9A0; else goto L_0222F95C;
   L_0222F95C: ; // 0x222f95c
         /* 0222F95C */ cpu->r[3] = cpu->r[29];
-        /* 0222F95C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222F960 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F95C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222F960 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F960 */ _t15 = _t14 & 0x00000001u;
         /* 0222F960 */ if (_t15) goto L_0222F964; else goto L_0222F974;
   L_0222F964: ; // 0x222f964
         /* 0222F964 */ cpu->r[3] = 0x00000010u;
         /* 0222F968 */ Gambit_fn_02801A78(cpu);
-        /* 0222F96C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222F970 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F96C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222F970 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F970 */ _t17 = _t16 & 0x00000001u;
         /* 0222F970 */ if (_t17) goto L_0222F984; else goto L_0222F974;
   L_0222F974: ; // 0x222f974
@@ -3054,8 +3054,8 @@ void Gambit_fn_0222F900(CPUState* cpu) {
         /* 0222F980 */ rbrew_write32(cpu->mem, _t21, cpu->r[30]);
   L_0222F984: ; // 0x222f984
         /* 0222F984 */ cpu->r[12] = cpu->r[29] + 0x00000010u;
-        /* 0222F984 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0222F988 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222F984 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0222F988 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222F988 */ _t23 = _t22 & 0x00000001u;
         /* 0222F988 */ if (_t23) goto L_0222F9A0; else goto L_0222F98C;
   L_0222F98C: ; // 0x222f98c
@@ -3235,8 +3235,8 @@ void Gambit_fn_0222FA98(CPUState* cpu) {
         /* 0222FB0C */ cpu->f[9] = fma(cpu->f[8], cpu->f[8], cpu->f[11]);
         /* 0222FB10 */ _t17 = cpu->r[8] + 0x00000AB0u;
         /* 0222FB10 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t17);
-        /* 0222FB14 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
-        /* 0222FB18 */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222FB14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
+        /* 0222FB18 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222FB18 */ _t19 = _t18 & 0x00000001u;
         /* 0222FB18 */ if (_t19) goto L_0222FB1C; else goto L_0222FB58;
   L_0222FB1C: ; // 0x222fb1c
@@ -3268,8 +3268,8 @@ void Gambit_fn_0222FA98(CPUState* cpu) {
         /* 0222FB60 */ cpu->r[7] = rbrew_read32(cpu->mem, _t26);
         /* 0222FB64 */ _t27 = cpu->r[31] + 0x00000188u;
         /* 0222FB64 */ cpu->r[0] = rbrew_read32(cpu->mem, _t27);
-        /* 0222FB68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], cpu->r[0]);
-        /* 0222FB6C */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222FB68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], cpu->r[0]));
+        /* 0222FB6C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222FB6C */ _t29 = _t28 & 0x00000001u;
         /* 0222FB6C */ if (_t29) goto L_0222FB70; else goto L_0222FC00;
   L_0222FB70: ; // 0x222fb70
@@ -3278,10 +3278,10 @@ void Gambit_fn_0222FA98(CPUState* cpu) {
         /* 0222FB74 */ _t31 = cpu->r[31] + 0x00000190u;
         /* 0222FB74 */ cpu->r[12] = rbrew_read32(cpu->mem, _t31);
         /* 0222FB78 */ cpu->r[10] = cpu->r[10] + 0xFFFFFFFFu;
-        /* 0222FB78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0222FB78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0222FB7C */ _t32 = cpu->r[31] + 0x0000018Cu;
         /* 0222FB7C */ rbrew_write32(cpu->mem, _t32, cpu->r[10]);
-        /* 0222FB80 */ _t33 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222FB80 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222FB80 */ _t34 = _t33 & 0x00000001u;
         /* 0222FB80 */ if (_t34) goto L_0222FB84; else goto L_0222FB90;
   L_0222FB84: ; // 0x222fb84
@@ -3298,12 +3298,12 @@ void Gambit_fn_0222FA98(CPUState* cpu) {
         /* 0222FB98 */ cpu->r[0] = rbrew_read32(cpu->mem, _t38);
         /* 0222FB9C */ _t39 = cpu->r[31] + 0x00000190u;
         /* 0222FB9C */ rbrew_write32(cpu->mem, _t39, cpu->r[12]);
-        /* 0222FBA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], cpu->r[0]);
+        /* 0222FBA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], cpu->r[0]));
         /* 0222FBA4 */ _t40 = cpu->r[31] + 0x00000184u;
         /* 0222FBA4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t40);
         /* 0222FBA8 */ _t41 = cpu->r[31] + 0x000000FCu;
         /* 0222FBA8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t41);
-        /* 0222FBAC */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222FBAC */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222FBAC */ _t43 = _t42 & 0x00000001u;
         /* 0222FBAC */ if (_t43) goto L_0222FBB4; else goto L_0222FBB0;
   L_0222FBB0: ; // 0x222fbb0
@@ -3334,37 +3334,37 @@ void Gambit_fn_0222FA98(CPUState* cpu) {
         /* 0222FBE8 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 0222FBEC */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 0222FBF0 */ Gambit_fn_021C6DD8(cpu);
-        /* 0222FBF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222FBF8 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222FBF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222FBF8 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222FBF8 */ _t53 = _t52 & 0x00000001u;
         /* 0222FBF8 */ if (_t53) goto L_0222FCAC; else goto L_0222FBFC;
   L_0222FBFC: ; // 0x222fbfc
         /* 0222FBFC */ goto L_0222FCC0;
   L_0222FC00: ; // 0x222fc00
-        /* 0222FC00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0222FC04 */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222FC00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0222FC04 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222FC04 */ _t55 = _t54 & 0x00000001u;
         /* 0222FC04 */ if (_t55) goto L_0222FC08; else goto L_0222FC7C;
   L_0222FC08: ; // 0x222fc08
         /* 0222FC08 */ _t56 = cpu->r[31] + 0x00000188u;
         /* 0222FC08 */ cpu->r[0] = rbrew_read32(cpu->mem, _t56);
         /* 0222FC0C */ cpu->r[7] = cpu->r[7] + 0xFFFFFFFFu;
-        /* 0222FC10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], cpu->r[0]);
+        /* 0222FC10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], cpu->r[0]));
         /* 0222FC14 */ _t57 = cpu->r[31] + 0x00000190u;
         /* 0222FC14 */ rbrew_write32(cpu->mem, _t57, cpu->r[7]);
-        /* 0222FC18 */ _t58 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222FC18 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222FC18 */ _t59 = _t58 & 0x00000001u;
         /* 0222FC18 */ if (_t59) goto L_0222FC1C; else goto L_0222FC7C;
   L_0222FC1C: ; // 0x222fc1c
         /* 0222FC1C */ _t60 = cpu->r[31] + 0x0000018Cu;
         /* 0222FC1C */ cpu->r[10] = rbrew_read32(cpu->mem, _t60);
         /* 0222FC20 */ cpu->r[10] = cpu->r[10] + 0xFFFFFFFFu;
-        /* 0222FC20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0222FC20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0222FC24 */ _t61 = cpu->r[31] + 0x0000018Cu;
         /* 0222FC24 */ rbrew_write32(cpu->mem, _t61, cpu->r[10]);
         /* 0222FC28 */ _t62 = cpu->r[31] + 0x00000190u;
         /* 0222FC28 */ cpu->r[10] = rbrew_read32(cpu->mem, _t62);
-        /* 0222FC2C */ _t63 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222FC2C */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222FC2C */ _t64 = _t63 & 0x00000001u;
         /* 0222FC2C */ if (_t64) goto L_0222FC30; else goto L_0222FC3C;
   L_0222FC30: ; // 0x222fc30
@@ -3381,12 +3381,12 @@ void Gambit_fn_0222FA98(CPUState* cpu) {
         /* 0222FC44 */ cpu->r[0] = rbrew_read32(cpu->mem, _t68);
         /* 0222FC48 */ _t69 = cpu->r[31] + 0x00000190u;
         /* 0222FC48 */ rbrew_write32(cpu->mem, _t69, cpu->r[10]);
-        /* 0222FC4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], cpu->r[0]);
+        /* 0222FC4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], cpu->r[0]));
         /* 0222FC50 */ _t70 = cpu->r[31] + 0x00000184u;
         /* 0222FC50 */ cpu->r[12] = rbrew_read32(cpu->mem, _t70);
         /* 0222FC54 */ _t71 = cpu->r[31] + 0x000000FCu;
         /* 0222FC54 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t71);
-        /* 0222FC58 */ _t72 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222FC58 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222FC58 */ _t73 = _t72 & 0x00000001u;
         /* 0222FC58 */ if (_t73) goto L_0222FC60; else goto L_0222FC5C;
   L_0222FC5C: ; // 0x222fc5c
@@ -3418,8 +3418,8 @@ void Gambit_fn_0222FA98(CPUState* cpu) {
         /* 0222FC98 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 0222FC9C */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 0222FCA0 */ Gambit_fn_021C6DD8(cpu);
-        /* 0222FCA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222FCA8 */ _t82 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222FCA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222FCA8 */ _t82 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222FCA8 */ _t83 = _t82 & 0x00000001u;
         /* 0222FCA8 */ if (_t83) goto L_0222FCAC; else goto L_0222FCC0;
   L_0222FCAC: ; // 0x222fcac
@@ -3534,8 +3534,8 @@ void Gambit_fn_0222FA9C(CPUState* cpu) {
         /* 0222FB0C */ cpu->f[9] = fma(cpu->f[8], cpu->f[8], cpu->f[11]);
         /* 0222FB10 */ _t17 = cpu->r[8] + 0x00000AB0u;
         /* 0222FB10 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t17);
-        /* 0222FB14 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
-        /* 0222FB18 */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222FB14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
+        /* 0222FB18 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222FB18 */ _t19 = _t18 & 0x00000001u;
         /* 0222FB18 */ if (_t19) goto L_0222FB1C; else goto L_0222FB58;
   L_0222FB1C: ; // 0x222fb1c
@@ -3567,8 +3567,8 @@ void Gambit_fn_0222FA9C(CPUState* cpu) {
         /* 0222FB60 */ cpu->r[7] = rbrew_read32(cpu->mem, _t26);
         /* 0222FB64 */ _t27 = cpu->r[31] + 0x00000188u;
         /* 0222FB64 */ cpu->r[0] = rbrew_read32(cpu->mem, _t27);
-        /* 0222FB68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], cpu->r[0]);
-        /* 0222FB6C */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222FB68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], cpu->r[0]));
+        /* 0222FB6C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222FB6C */ _t29 = _t28 & 0x00000001u;
         /* 0222FB6C */ if (_t29) goto L_0222FB70; else goto L_0222FC00;
   L_0222FB70: ; // 0x222fb70
@@ -3577,10 +3577,10 @@ void Gambit_fn_0222FA9C(CPUState* cpu) {
         /* 0222FB74 */ _t31 = cpu->r[31] + 0x00000190u;
         /* 0222FB74 */ cpu->r[12] = rbrew_read32(cpu->mem, _t31);
         /* 0222FB78 */ cpu->r[10] = cpu->r[10] + 0xFFFFFFFFu;
-        /* 0222FB78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0222FB78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0222FB7C */ _t32 = cpu->r[31] + 0x0000018Cu;
         /* 0222FB7C */ rbrew_write32(cpu->mem, _t32, cpu->r[10]);
-        /* 0222FB80 */ _t33 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222FB80 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222FB80 */ _t34 = _t33 & 0x00000001u;
         /* 0222FB80 */ if (_t34) goto L_0222FB84; else goto L_0222FB90;
   L_0222FB84: ; // 0x222fb84
@@ -3597,12 +3597,12 @@ void Gambit_fn_0222FA9C(CPUState* cpu) {
         /* 0222FB98 */ cpu->r[0] = rbrew_read32(cpu->mem, _t38);
         /* 0222FB9C */ _t39 = cpu->r[31] + 0x00000190u;
         /* 0222FB9C */ rbrew_write32(cpu->mem, _t39, cpu->r[12]);
-        /* 0222FBA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], cpu->r[0]);
+        /* 0222FBA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], cpu->r[0]));
         /* 0222FBA4 */ _t40 = cpu->r[31] + 0x00000184u;
         /* 0222FBA4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t40);
         /* 0222FBA8 */ _t41 = cpu->r[31] + 0x000000FCu;
         /* 0222FBA8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t41);
-        /* 0222FBAC */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222FBAC */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222FBAC */ _t43 = _t42 & 0x00000001u;
         /* 0222FBAC */ if (_t43) goto L_0222FBB4; else goto L_0222FBB0;
   L_0222FBB0: ; // 0x222fbb0
@@ -3633,37 +3633,37 @@ void Gambit_fn_0222FA9C(CPUState* cpu) {
         /* 0222FBE8 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 0222FBEC */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 0222FBF0 */ Gambit_fn_021C6DD8(cpu);
-        /* 0222FBF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222FBF8 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222FBF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222FBF8 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222FBF8 */ _t53 = _t52 & 0x00000001u;
         /* 0222FBF8 */ if (_t53) goto L_0222FCAC; else goto L_0222FBFC;
   L_0222FBFC: ; // 0x222fbfc
         /* 0222FBFC */ goto L_0222FCC0;
   L_0222FC00: ; // 0x222fc00
-        /* 0222FC00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0222FC04 */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222FC00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0222FC04 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222FC04 */ _t55 = _t54 & 0x00000001u;
         /* 0222FC04 */ if (_t55) goto L_0222FC08; else goto L_0222FC7C;
   L_0222FC08: ; // 0x222fc08
         /* 0222FC08 */ _t56 = cpu->r[31] + 0x00000188u;
         /* 0222FC08 */ cpu->r[0] = rbrew_read32(cpu->mem, _t56);
         /* 0222FC0C */ cpu->r[7] = cpu->r[7] + 0xFFFFFFFFu;
-        /* 0222FC10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], cpu->r[0]);
+        /* 0222FC10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], cpu->r[0]));
         /* 0222FC14 */ _t57 = cpu->r[31] + 0x00000190u;
         /* 0222FC14 */ rbrew_write32(cpu->mem, _t57, cpu->r[7]);
-        /* 0222FC18 */ _t58 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222FC18 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222FC18 */ _t59 = _t58 & 0x00000001u;
         /* 0222FC18 */ if (_t59) goto L_0222FC1C; else goto L_0222FC7C;
   L_0222FC1C: ; // 0x222fc1c
         /* 0222FC1C */ _t60 = cpu->r[31] + 0x0000018Cu;
         /* 0222FC1C */ cpu->r[10] = rbrew_read32(cpu->mem, _t60);
         /* 0222FC20 */ cpu->r[10] = cpu->r[10] + 0xFFFFFFFFu;
-        /* 0222FC20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0222FC20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0222FC24 */ _t61 = cpu->r[31] + 0x0000018Cu;
         /* 0222FC24 */ rbrew_write32(cpu->mem, _t61, cpu->r[10]);
         /* 0222FC28 */ _t62 = cpu->r[31] + 0x00000190u;
         /* 0222FC28 */ cpu->r[10] = rbrew_read32(cpu->mem, _t62);
-        /* 0222FC2C */ _t63 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222FC2C */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222FC2C */ _t64 = _t63 & 0x00000001u;
         /* 0222FC2C */ if (_t64) goto L_0222FC30; else goto L_0222FC3C;
   L_0222FC30: ; // 0x222fc30
@@ -3680,12 +3680,12 @@ void Gambit_fn_0222FA9C(CPUState* cpu) {
         /* 0222FC44 */ cpu->r[0] = rbrew_read32(cpu->mem, _t68);
         /* 0222FC48 */ _t69 = cpu->r[31] + 0x00000190u;
         /* 0222FC48 */ rbrew_write32(cpu->mem, _t69, cpu->r[10]);
-        /* 0222FC4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], cpu->r[0]);
+        /* 0222FC4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], cpu->r[0]));
         /* 0222FC50 */ _t70 = cpu->r[31] + 0x00000184u;
         /* 0222FC50 */ cpu->r[12] = rbrew_read32(cpu->mem, _t70);
         /* 0222FC54 */ _t71 = cpu->r[31] + 0x000000FCu;
         /* 0222FC54 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t71);
-        /* 0222FC58 */ _t72 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222FC58 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222FC58 */ _t73 = _t72 & 0x00000001u;
         /* 0222FC58 */ if (_t73) goto L_0222FC60; else goto L_0222FC5C;
   L_0222FC5C: ; // 0x222fc5c
@@ -3717,8 +3717,8 @@ void Gambit_fn_0222FA9C(CPUState* cpu) {
         /* 0222FC98 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 0222FC9C */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 0222FCA0 */ Gambit_fn_021C6DD8(cpu);
-        /* 0222FCA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222FCA8 */ _t82 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222FCA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222FCA8 */ _t82 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222FCA8 */ _t83 = _t82 & 0x00000001u;
         /* 0222FCA8 */ if (_t83) goto L_0222FCAC; else goto L_0222FCC0;
   L_0222FCAC: ; // 0x222fcac
@@ -3787,20 +3787,20 @@ void Gambit_fn_0222FD3C(CPUState* cpu) {
         /* 0222FD3C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
         /* 0222FD40 */ _t1 = cpu->r[3] + 0x00000188u;
         /* 0222FD40 */ cpu->r[0] = rbrew_read32(cpu->mem, _t1);
-        /* 0222FD44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[0]);
-        /* 0222FD48 */ _t2 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222FD44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[0]));
+        /* 0222FD48 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222FD48 */ _t3 = _t2 & 0x00000001u;
         /* 0222FD48 */ if (_t3) goto L_0222FD4C; else goto L_0222FDAC;
   L_0222FD4C: ; // 0x222fd4c
         /* 0222FD4C */ _t4 = cpu->r[3] + 0x0000018Cu;
         /* 0222FD4C */ cpu->r[10] = rbrew_read32(cpu->mem, _t4);
         /* 0222FD50 */ cpu->r[10] = cpu->r[10] + 0xFFFFFFFFu;
-        /* 0222FD50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0222FD50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0222FD54 */ _t5 = cpu->r[3] + 0x0000018Cu;
         /* 0222FD54 */ rbrew_write32(cpu->mem, _t5, cpu->r[10]);
         /* 0222FD58 */ _t6 = cpu->r[3] + 0x00000190u;
         /* 0222FD58 */ cpu->r[10] = rbrew_read32(cpu->mem, _t6);
-        /* 0222FD5C */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222FD5C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222FD5C */ _t8 = _t7 & 0x00000001u;
         /* 0222FD5C */ if (_t8) goto L_0222FD60; else goto L_0222FD6C;
   L_0222FD60: ; // 0x222fd60
@@ -3815,10 +3815,10 @@ void Gambit_fn_0222FD3C(CPUState* cpu) {
         /* 0222FD70 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
         /* 0222FD74 */ _t12 = cpu->r[3] + 0x0000018Cu;
         /* 0222FD74 */ cpu->r[12] = rbrew_read32(cpu->mem, _t12);
-        /* 0222FD78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[0]);
+        /* 0222FD78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[0]));
         /* 0222FD7C */ _t13 = cpu->r[3] + 0x00000190u;
         /* 0222FD7C */ rbrew_write32(cpu->mem, _t13, cpu->r[10]);
-        /* 0222FD80 */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222FD80 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222FD80 */ _t15 = _t14 & 0x00000001u;
         /* 0222FD80 */ if (_t15) goto L_0222FD88; else goto L_0222FD84;
   L_0222FD84: ; // 0x222fd84
@@ -3842,8 +3842,8 @@ void Gambit_fn_0222FD3C(CPUState* cpu) {
         /* 0222FDA4 */ rbrew_write_f32(cpu->mem, _t22, cpu->f[0]);
         /* 0222FDA8 */ return;
   L_0222FDAC: ; // 0x222fdac
-        /* 0222FDAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0222FDB0 */ _t23 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222FDAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0222FDB0 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222FDB0 */ _t24 = _t23 & 0x00000001u;
         /* 0222FDB0 */ _t25 = _t24 ^ 0x00000001u;
         /* 0222FDB0 */ if (_t25) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -3854,8 +3854,8 @@ void Gambit_fn_0222FD3C(CPUState* cpu) {
         /* 0222FDB8 */ cpu->r[12] = cpu->r[12] + 0xFFFFFFFFu;
         /* 0222FDBC */ _t27 = cpu->r[3] + 0x00000190u;
         /* 0222FDBC */ rbrew_write32(cpu->mem, _t27, cpu->r[12]);
-        /* 0222FDC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], cpu->r[0]);
-        /* 0222FDC4 */ _t28 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222FDC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], cpu->r[0]));
+        /* 0222FDC4 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222FDC4 */ _t29 = _t28 & 0x00000001u;
         /* 0222FDC4 */ _t30 = _t29 ^ 0x00000001u;
         /* 0222FDC4 */ if (_t30) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -3866,10 +3866,10 @@ void Gambit_fn_0222FD3C(CPUState* cpu) {
         /* 0222FDCC */ _t32 = cpu->r[3] + 0x00000190u;
         /* 0222FDCC */ cpu->r[11] = rbrew_read32(cpu->mem, _t32);
         /* 0222FDD0 */ cpu->r[10] = cpu->r[10] + 0xFFFFFFFFu;
-        /* 0222FDD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0222FDD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0222FDD4 */ _t33 = cpu->r[3] + 0x0000018Cu;
         /* 0222FDD4 */ rbrew_write32(cpu->mem, _t33, cpu->r[10]);
-        /* 0222FDD8 */ _t34 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222FDD8 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222FDD8 */ _t35 = _t34 & 0x00000001u;
         /* 0222FDD8 */ if (_t35) goto L_0222FDDC; else goto L_0222FDE8;
   L_0222FDDC: ; // 0x222fddc
@@ -3886,12 +3886,12 @@ void Gambit_fn_0222FD3C(CPUState* cpu) {
         /* 0222FDF0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t39);
         /* 0222FDF4 */ _t40 = cpu->r[3] + 0x00000190u;
         /* 0222FDF4 */ rbrew_write32(cpu->mem, _t40, cpu->r[11]);
-        /* 0222FDF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], cpu->r[0]);
+        /* 0222FDF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], cpu->r[0]));
         /* 0222FDFC */ _t41 = cpu->r[3] + 0x000000FCu;
         /* 0222FDFC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t41);
         /* 0222FE00 */ _t42 = cpu->r[3] + 0x00000184u;
         /* 0222FE00 */ cpu->r[11] = rbrew_read32(cpu->mem, _t42);
-        /* 0222FE04 */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222FE04 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222FE04 */ _t44 = _t43 & 0x00000001u;
         /* 0222FE04 */ if (_t44) goto L_0222FE0C; else goto L_0222FE08;
   L_0222FE08: ; // 0x222fe08
@@ -3964,10 +3964,10 @@ void Gambit_fn_0222FE28(CPUState* cpu) {
         /* 0222FE90 */ _t16 = cpu->r[30] + 0x00000190u;
         /* 0222FE90 */ cpu->r[8] = rbrew_read32(cpu->mem, _t16);
         /* 0222FE94 */ cpu->r[11] = 0x10050000u;
-        /* 0222FE98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0222FE98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0222FE9C */ _t17 = cpu->r[11] + 0x00000AB0u;
         /* 0222FE9C */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t17);
-        /* 0222FEA0 */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222FEA0 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222FEA0 */ _t19 = _t18 & 0x00000001u;
         /* 0222FEA0 */ if (_t19) goto L_0222FF24; else goto L_0222FEA4;
   L_0222FEA4: ; // 0x222fea4
@@ -4019,7 +4019,7 @@ void Gambit_fn_0222FE28(CPUState* cpu) {
         /* 0222FF08 */ cpu->f[26] = rbrew_read_f64(cpu->mem, _t39);
         /* 0222FF0C */ _t40 = cpu->r[1] + 0x000000D0u;
         /* 0222FF0C */ cpu->r[30] = rbrew_read32(cpu->mem, _t40);
-        /* 0222FF10 */ _t41 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222FF10 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222FF10 */ _t42 = _t41 & 0x00000001u;
         /* 0222FF10 */ if (_t42) goto L_0222FF14; // else: addr-0 trap, fall-through
   L_0222FF14: ; // 0x222ff14
@@ -4034,30 +4034,30 @@ void Gambit_fn_0222FE28(CPUState* cpu) {
         /* 0222FF28 */ _t45 = cpu->r[30] + 0x00000188u;
         /* 0222FF28 */ cpu->r[6] = rbrew_read32(cpu->mem, _t45);
         /* 0222FF2C */ cpu->r[5] = cpu->r[9];
-        /* 0222FF30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], cpu->r[6]);
+        /* 0222FF30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], cpu->r[6]));
         /* 0222FF34 */ _t46 = cpu->r[30] + 0x00000184u;
         /* 0222FF34 */ cpu->r[10] = rbrew_read32(cpu->mem, _t46);
-        /* 0222FF38 */ _t47 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222FF38 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222FF38 */ _t48 = _t47 & 0x00000001u;
         /* 0222FF38 */ if (_t48) goto L_0222FF40; else goto L_0222FF3C;
   L_0222FF3C: ; // 0x222ff3c
         /* 0222FF3C */ cpu->r[5] = cpu->r[5] - cpu->r[6];
   L_0222FF40: ; // 0x222ff40
         /* 0222FF40 */ cpu->r[12] = (uint32_t)((int32_t)cpu->r[5] * (int32_t)0x0000000Cu);
-        /* 0222FF44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x0000000Cu);
+        /* 0222FF44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x0000000Cu));
         /* 0222FF48 */ cpu->r[11] = cpu->r[10] + cpu->r[12];
-        /* 0222FF4C */ _t49 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222FF4C */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222FF4C */ _t50 = _t49 & 0x00000001u;
         /* 0222FF4C */ if (_t50) goto L_0222FF50; else goto L_02230004;
   L_0222FF50: ; // 0x222ff50
-        /* 0222FF50 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x0000000Cu);
-        /* 0222FF54 */ _t51 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222FF50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x0000000Cu));
+        /* 0222FF54 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222FF54 */ _t52 = _t51 & 0x00000001u;
         /* 0222FF54 */ if (_t52) goto L_0222FF58; else goto L_0222FFB8;
   L_0222FF58: ; // 0x222ff58
         /* 0222FF58 */ cpu->r[7] = cpu->r[9] + 0x0000000Cu;
-        /* 0222FF5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], cpu->r[6]);
-        /* 0222FF60 */ _t53 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0222FF5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], cpu->r[6]));
+        /* 0222FF60 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0222FF60 */ _t54 = _t53 & 0x00000001u;
         /* 0222FF60 */ if (_t54) goto L_0222FF68; else goto L_0222FF64;
   L_0222FF64: ; // 0x222ff64
@@ -4084,10 +4084,10 @@ void Gambit_fn_0222FE28(CPUState* cpu) {
         /* 0222FF9C */ rbrew_write_f32(cpu->mem, _t59, cpu->f[8]);
         /* 0222FFA0 */ cpu->f[9] = fma(cpu->f[8], cpu->f[8], cpu->f[7]);
         /* 0222FFA4 */ cpu->r[10] = 0x10050000u;
-        /* 0222FFA8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[28]);
+        /* 0222FFA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[28]));
         /* 0222FFAC */ _t60 = cpu->r[10] + 0x00000B58u;
         /* 0222FFAC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t60);
-        /* 0222FFB0 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222FFB0 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222FFB0 */ _t62 = _t61 & 0x00000001u;
         /* 0222FFB0 */ if (_t62) goto L_0222FFB4; else goto L_0223009C;
   L_0222FFB4: ; // 0x222ffb4
@@ -4113,10 +4113,10 @@ void Gambit_fn_0222FE28(CPUState* cpu) {
         /* 0222FFE8 */ rbrew_write_f32(cpu->mem, _t67, cpu->f[8]);
         /* 0222FFEC */ cpu->f[9] = fma(cpu->f[8], cpu->f[8], cpu->f[7]);
         /* 0222FFF0 */ cpu->r[10] = 0x10050000u;
-        /* 0222FFF4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[28]);
+        /* 0222FFF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[28]));
         /* 0222FFF8 */ _t68 = cpu->r[10] + 0x00000B58u;
         /* 0222FFF8 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t68);
-        /* 0222FFFC */ _t69 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0222FFFC */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0222FFFC */ _t70 = _t69 & 0x00000001u;
         /* 0222FFFC */ if (_t70) goto L_02230000; else goto L_0223009C;
   L_02230000: ; // 0x2230000
@@ -4124,8 +4124,8 @@ void Gambit_fn_0222FE28(CPUState* cpu) {
   L_02230004: ; // 0x2230004
         /* 02230004 */ cpu->r[5] = cpu->r[9] + cpu->r[8];
         /* 02230008 */ cpu->r[0] = cpu->r[5] + 0xFFFFFFFFu;
-        /* 0223000C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[6]);
-        /* 02230010 */ _t71 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223000C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[6]));
+        /* 02230010 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02230010 */ _t72 = _t71 & 0x00000001u;
         /* 02230010 */ if (_t72) goto L_02230018; else goto L_02230014;
   L_02230014: ; // 0x2230014
@@ -4152,10 +4152,10 @@ void Gambit_fn_0222FE28(CPUState* cpu) {
         /* 0223004C */ rbrew_write_f32(cpu->mem, _t77, cpu->f[8]);
         /* 02230050 */ cpu->f[9] = fma(cpu->f[8], cpu->f[8], cpu->f[7]);
         /* 02230054 */ cpu->r[10] = 0x10050000u;
-        /* 02230058 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[28]);
+        /* 02230058 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[28]));
         /* 0223005C */ _t78 = cpu->r[10] + 0x00000B58u;
         /* 0223005C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t78);
-        /* 02230060 */ _t79 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02230060 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02230060 */ _t80 = _t79 & 0x00000001u;
         /* 02230060 */ if (_t80) goto L_02230064; else goto L_0223009C;
   L_02230064: ; // 0x2230064
@@ -4211,10 +4211,10 @@ void Gambit_fn_0222FE28(CPUState* cpu) {
         /* 022300EC */ _t95 = cpu->r[5] + 0x00000B74u;
         /* 022300EC */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t95);
         /* 022300F0 */ cpu->r[12] = 0x10050000u;
-        /* 022300F4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[29]);
+        /* 022300F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[29]));
         /* 022300F8 */ _t96 = cpu->r[12] + 0x00000B50u;
         /* 022300F8 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t96);
-        /* 022300FC */ _t97 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022300FC */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022300FC */ _t98 = _t97 & 0x00000001u;
         /* 022300FC */ if (_t98) goto L_02230100; else goto L_02230134;
   L_02230100: ; // 0x2230100
@@ -4228,19 +4228,19 @@ void Gambit_fn_0222FE28(CPUState* cpu) {
         /* 02230114 */ _t101 = cpu->r[1] + 0x00000014u;
         /* 02230114 */ rbrew_write_f32(cpu->mem, _t101, cpu->f[10]);
         /* 02230118 */ cpu->f[8] = fma(cpu->f[10], cpu->f[10], cpu->f[7]);
-        /* 0223011C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[28]);
+        /* 0223011C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[28]));
         /* 02230120 */ _t102 = cpu->r[1] + 0x00000018u;
         /* 02230120 */ rbrew_write_f32(cpu->mem, _t102, cpu->f[12]);
         /* 02230124 */ cpu->f[27] = cpu->f[1];
-        /* 02230128 */ _t103 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02230128 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02230128 */ _t104 = _t103 & 0x00000001u;
         /* 02230128 */ if (_t104) goto L_02230168; else goto L_0223012C;
   L_0223012C: ; // 0x223012c
         /* 0223012C */ cpu->f[1] = cpu->f[28];
         /* 02230130 */ goto L_022301C4;
   L_02230134: ; // 0x2230134
-        /* 02230134 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
-        /* 02230138 */ _t105 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02230134 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
+        /* 02230138 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02230138 */ _t106 = _t105 & 0x00000001u;
         /* 02230138 */ if (_t106) goto L_0223013C; else goto L_02230140;
   L_0223013C: ; // 0x223013c
@@ -4255,11 +4255,11 @@ void Gambit_fn_0222FE28(CPUState* cpu) {
         /* 02230150 */ _t109 = cpu->r[1] + 0x00000014u;
         /* 02230150 */ rbrew_write_f32(cpu->mem, _t109, cpu->f[10]);
         /* 02230154 */ cpu->f[8] = fma(cpu->f[10], cpu->f[10], cpu->f[7]);
-        /* 02230158 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[28]);
+        /* 02230158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[28]));
         /* 0223015C */ _t110 = cpu->r[1] + 0x00000018u;
         /* 0223015C */ rbrew_write_f32(cpu->mem, _t110, cpu->f[12]);
         /* 02230160 */ cpu->f[27] = cpu->f[1];
-        /* 02230164 */ _t111 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02230164 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02230164 */ _t112 = _t111 & 0x00000001u;
         /* 02230164 */ if (_t112) goto L_02230168; else goto L_0223012C;
   L_02230168: ; // 0x2230168
@@ -4275,17 +4275,17 @@ void Gambit_fn_0222FE28(CPUState* cpu) {
         /* 02230180 */ cpu->f[10] = cpu->f[11] * cpu->f[13];
         /* 02230184 */ cpu->f[8] = cpu->f[8] * cpu->f[10];
         /* 02230188 */ /* nop */
-        /* 0223018C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[28]);
+        /* 0223018C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[28]));
         /* 02230190 */ /* nop */
         /* 02230194 */ /* nop */
-        /* 02230198 */ _t116 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02230198 */ _t116 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02230198 */ _t117 = _t116 & 0x00000001u;
         /* 02230198 */ if (_t117) goto L_0223019C; else goto L_0223012C;
   L_0223019C: ; // 0x223019c
         /* 0223019C */ _t118 = cpu->r[1] + 0x00000014u;
         /* 0223019C */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t118);
-        /* 022301A0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[29]);
-        /* 022301A4 */ _t119 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022301A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[29]));
+        /* 022301A4 */ _t119 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022301A4 */ _t120 = _t119 & 0x00000001u;
         /* 022301A4 */ if (_t120) goto L_022301A8; else goto L_022301B4;
   L_022301A8: ; // 0x22301a8
@@ -4293,8 +4293,8 @@ void Gambit_fn_0222FE28(CPUState* cpu) {
         /* 022301AC */ Gambit_fn_02C892F8(cpu);
         /* 022301B0 */ goto L_022301C4;
   L_022301B4: ; // 0x22301b4
-        /* 022301B4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
-        /* 022301B8 */ _t121 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022301B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
+        /* 022301B8 */ _t121 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022301B8 */ _t122 = _t121 & 0x00000001u;
         /* 022301B8 */ if (_t122) goto L_022301BC; else goto L_022301C0;
   L_022301BC: ; // 0x22301bc
@@ -4507,7 +4507,7 @@ void Gambit_fn_0222FE28(CPUState* cpu) {
         /* 022303D0 */ cpu->f[29] = rbrew_read_f64(cpu->mem, _t192);
         /* 022303D4 */ _t193 = cpu->r[1] + 0x000000D0u;
         /* 022303D4 */ cpu->r[30] = rbrew_read32(cpu->mem, _t193);
-        /* 022303D8 */ _t194 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022303D8 */ _t194 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022303D8 */ _t195 = _t194 & 0x00000001u;
         /* 022303D8 */ if (_t195) goto L_022303DC; // else: addr-0 trap, fall-through
   L_022303DC: ; // 0x22303dc
@@ -4717,7 +4717,7 @@ void Gambit_fn_022301DC(CPUState* cpu) {
         /* 022303D0 */ cpu->f[29] = rbrew_read_f64(cpu->mem, _t65);
         /* 022303D4 */ _t66 = cpu->r[1] + 0x000000D0u;
         /* 022303D4 */ cpu->r[30] = rbrew_read32(cpu->mem, _t66);
-        /* 022303D8 */ _t67 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022303D8 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022303D8 */ _t68 = _t67 & 0x00000001u;
         /* 022303D8 */ if (_t68) goto L_022303DC; // else: addr-0 trap, fall-through
   L_022303DC: ; // 0x22303dc
@@ -4784,8 +4784,8 @@ void Gambit_fn_0223040C(CPUState* cpu) {
         /* 0223040C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0223040C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02230410 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 02230410 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02230414 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230410 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02230414 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02230414 */ _t2 = _t1 & 0x00000001u;
         /* 02230414 */ _t3 = _t2 ^ 0x00000001u;
         /* 02230414 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -4807,8 +4807,8 @@ void Gambit_fn_02230428(CPUState* cpu) {
         /* 02230428 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02230428 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223042C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 0223042C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02230430 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223042C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02230430 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02230430 */ _t2 = _t1 & 0x00000001u;
         /* 02230430 */ _t3 = _t2 ^ 0x00000001u;
         /* 02230430 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -4830,8 +4830,8 @@ void Gambit_fn_02230444(CPUState* cpu) {
         /* 02230444 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02230444 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02230448 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 02230448 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0223044C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230448 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0223044C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223044C */ _t2 = _t1 & 0x00000001u;
         /* 0223044C */ _t3 = _t2 ^ 0x00000001u;
         /* 0223044C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -4874,8 +4874,8 @@ void Gambit_fn_02230470(CPUState* cpu) {
         /* 02230480 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02230484 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02230484 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02230488 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0223048C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230488 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0223048C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223048C */ _t5 = _t4 & 0x00000001u;
         /* 0223048C */ if (_t5) goto L_02230490; else goto L_022304AC;
   L_02230490: ; // 0x2230490
@@ -4914,8 +4914,8 @@ void Gambit_fn_02230474(CPUState* cpu) {
         /* 02230480 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02230484 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02230484 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02230488 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0223048C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230488 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0223048C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223048C */ _t5 = _t4 & 0x00000001u;
         /* 0223048C */ if (_t5) goto L_02230490; else goto L_022304AC;
   L_02230490: ; // 0x2230490
@@ -5345,8 +5345,8 @@ void Gambit_fn_02230664(CPUState* cpu) {
         /* 02230664 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 02230664 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02230668 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 02230668 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223066C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230668 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223066C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223066C */ _t2 = _t1 & 0x00000001u;
         /* 0223066C */ if (_t2) goto L_0223067C; else goto L_02230670;
   L_02230670: ; // 0x2230670
@@ -5373,8 +5373,8 @@ void Gambit_fn_02230688(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -5464,9 +5464,9 @@ void Gambit_fn_022306D0(CPUState* cpu) {
         /* 022306D4 */ _t0 = cpu->r[7] + 0xFFFFFC58u;
         /* 022306D4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t0);
         /* 022306D8 */ cpu->r[8] = 0x101D0000u;
-        /* 022306DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 022306DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 022306E0 */ cpu->r[8] = cpu->r[8] + 0xFFFFFF80u;
-        /* 022306E4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022306E4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022306E4 */ _t2 = _t1 & 0x00000001u;
         /* 022306E4 */ if (_t2) goto L_022306E8; else goto L_02230700;
   L_022306E8: ; // 0x22306e8
@@ -5479,8 +5479,8 @@ void Gambit_fn_022306D0(CPUState* cpu) {
         /* 022306FC */ _t4 = cpu->r[8] + 0x00000000u;
         /* 022306FC */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_02230700: ; // 0x2230700
-        /* 02230700 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02230704 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02230704 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02230704 */ _t6 = _t5 & 0x00000001u;
         /* 02230704 */ if (_t6) goto L_02230708; else goto L_02230710;
   L_02230708: ; // 0x2230708
@@ -5491,9 +5491,9 @@ void Gambit_fn_022306D0(CPUState* cpu) {
         /* 02230714 */ _t7 = cpu->r[8] + 0xFFFFE618u;
         /* 02230714 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 02230718 */ cpu->r[11] = 0x101D0000u;
-        /* 0223071C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0223071C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02230720 */ cpu->r[11] = cpu->r[11] + 0xFFFFFC04u;
-        /* 02230724 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230724 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02230724 */ _t9 = _t8 & 0x00000001u;
         /* 02230724 */ if (_t9) goto L_02230728; else goto L_02230740;
   L_02230728: ; // 0x2230728
@@ -5506,8 +5506,8 @@ void Gambit_fn_022306D0(CPUState* cpu) {
         /* 0223073C */ _t11 = cpu->r[11] + 0x00000000u;
         /* 0223073C */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_02230740: ; // 0x2230740
-        /* 02230740 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 02230744 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230740 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 02230744 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02230744 */ _t13 = _t12 & 0x00000001u;
         /* 02230744 */ if (_t13) goto L_02230748; else goto L_02230750;
   L_02230748: ; // 0x2230748
@@ -5518,9 +5518,9 @@ void Gambit_fn_022306D0(CPUState* cpu) {
         /* 02230754 */ _t14 = cpu->r[9] + 0xFFFFDA0Cu;
         /* 02230754 */ cpu->r[9] = rbrew_read32(cpu->mem, _t14);
         /* 02230758 */ cpu->r[8] = 0x101D0000u;
-        /* 0223075C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0223075C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02230760 */ cpu->r[8] = cpu->r[8] + 0xFFFFFC00u;
-        /* 02230764 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230764 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02230764 */ _t16 = _t15 & 0x00000001u;
         /* 02230764 */ if (_t16) goto L_02230768; else goto L_02230780;
   L_02230768: ; // 0x2230768
@@ -5533,8 +5533,8 @@ void Gambit_fn_022306D0(CPUState* cpu) {
         /* 0223077C */ _t18 = cpu->r[8] + 0x00000000u;
         /* 0223077C */ rbrew_write32(cpu->mem, _t18, cpu->r[10]);
   L_02230780: ; // 0x2230780
-        /* 02230780 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 02230784 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230780 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 02230784 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02230784 */ _t20 = _t19 & 0x00000001u;
         /* 02230784 */ if (_t20) goto L_02230788; else goto L_02230790;
   L_02230788: ; // 0x2230788
@@ -5545,9 +5545,9 @@ void Gambit_fn_022306D0(CPUState* cpu) {
         /* 02230794 */ _t21 = cpu->r[11] + 0xFFFFDA00u;
         /* 02230794 */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 02230798 */ cpu->r[8] = 0x101D0000u;
-        /* 0223079C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0223079C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 022307A0 */ cpu->r[8] = cpu->r[8] + 0xFFFFFBFCu;
-        /* 022307A4 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022307A4 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022307A4 */ _t23 = _t22 & 0x00000001u;
         /* 022307A4 */ if (_t23) goto L_022307A8; else goto L_022307C0;
   L_022307A8: ; // 0x22307a8
@@ -5560,8 +5560,8 @@ void Gambit_fn_022306D0(CPUState* cpu) {
         /* 022307BC */ _t25 = cpu->r[8] + 0x00000000u;
         /* 022307BC */ rbrew_write32(cpu->mem, _t25, cpu->r[9]);
   L_022307C0: ; // 0x22307c0
-        /* 022307C0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 022307C4 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022307C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 022307C4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022307C4 */ _t27 = _t26 & 0x00000001u;
         /* 022307C4 */ if (_t27) goto L_022307C8; else goto L_022307D0;
   L_022307C8: ; // 0x22307c8
@@ -5572,9 +5572,9 @@ void Gambit_fn_022306D0(CPUState* cpu) {
         /* 022307D4 */ _t28 = cpu->r[10] + 0xFFFFD9ECu;
         /* 022307D4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t28);
         /* 022307D8 */ cpu->r[11] = 0x101D0000u;
-        /* 022307DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 022307DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 022307E0 */ cpu->r[11] = cpu->r[11] + 0xFFFFFB4Cu;
-        /* 022307E4 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022307E4 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022307E4 */ _t30 = _t29 & 0x00000001u;
         /* 022307E4 */ if (_t30) goto L_022307E8; else goto L_02230800;
   L_022307E8: ; // 0x22307e8
@@ -5587,8 +5587,8 @@ void Gambit_fn_022306D0(CPUState* cpu) {
         /* 022307FC */ _t32 = cpu->r[11] + 0x00000000u;
         /* 022307FC */ rbrew_write32(cpu->mem, _t32, cpu->r[7]);
   L_02230800: ; // 0x2230800
-        /* 02230800 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 02230804 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230800 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 02230804 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02230804 */ _t34 = _t33 & 0x00000001u;
         /* 02230804 */ if (_t34) goto L_02230808; else goto L_02230810;
   L_02230808: ; // 0x2230808
@@ -5600,9 +5600,9 @@ void Gambit_fn_022306D0(CPUState* cpu) {
         /* 02230814 */ cpu->r[0] = rbrew_read32(cpu->mem, _t35);
         /* 02230814 */ cpu->r[11] = _t35;
         /* 02230818 */ cpu->r[10] = 0x101D0000u;
-        /* 0223081C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0223081C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02230820 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 02230824 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230824 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02230824 */ _t37 = _t36 & 0x00000001u;
         /* 02230824 */ if (_t37) goto L_02230828; else goto L_0223083C;
   L_02230828: ; // 0x2230828
@@ -5614,8 +5614,8 @@ void Gambit_fn_022306D0(CPUState* cpu) {
         /* 02230838 */ _t39 = cpu->r[10] + 0x00000000u;
         /* 02230838 */ rbrew_write32(cpu->mem, _t39, cpu->r[0]);
   L_0223083C: ; // 0x223083c
-        /* 0223083C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02230840 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223083C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02230840 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02230840 */ _t41 = _t40 & 0x00000001u;
         /* 02230840 */ if (_t41) goto L_02230844; else goto L_0223084C;
   L_02230844: ; // 0x2230844
@@ -5627,9 +5627,9 @@ void Gambit_fn_022306D0(CPUState* cpu) {
         /* 02230850 */ cpu->r[9] = rbrew_read32(cpu->mem, _t42);
         /* 02230850 */ cpu->r[10] = _t42;
         /* 02230854 */ cpu->r[11] = 0x101D0000u;
-        /* 02230858 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02230858 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0223085C */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 02230860 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230860 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02230860 */ _t44 = _t43 & 0x00000001u;
         /* 02230860 */ if (_t44) goto L_02230864; else goto L_02230878;
   L_02230864: ; // 0x2230864
@@ -5714,18 +5714,18 @@ void Gambit_fn_022308C8(CPUState* cpu) {
         /* 022308CC */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 022308CC */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 022308D0 */ cpu->r[31] = cpu->r[3];
-        /* 022308D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 022308D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 022308D4 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 022308D4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 022308D8 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022308D8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022308D8 */ _t4 = _t3 & 0x00000001u;
         /* 022308D8 */ if (_t4) goto L_022308DC; else goto L_022308EC;
   L_022308DC: ; // 0x22308dc
         /* 022308DC */ cpu->r[3] = 0x00000168u;
         /* 022308E0 */ Gambit_fn_02801A78(cpu);
         /* 022308E4 */ cpu->r[31] = cpu->r[3];
-        /* 022308E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022308E8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022308E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022308E8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022308E8 */ _t6 = _t5 & 0x00000001u;
         /* 022308E8 */ if (_t6) goto L_02230928; else goto L_022308EC;
   L_022308EC: ; // 0x22308ec
@@ -5737,10 +5737,10 @@ void Gambit_fn_022308C8(CPUState* cpu) {
         /* 02230900 */ _t7 = cpu->r[31] + 0x00000128u;
         /* 02230900 */ rbrew_write8(cpu->mem, _t7, (uint8_t)cpu->r[11]);
         /* 02230904 */ cpu->r[12] = cpu->r[31] + 0x0000012Cu;
-        /* 02230904 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02230904 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02230908 */ _t8 = cpu->r[31] + 0x00000004u;
         /* 02230908 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
-        /* 0223090C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223090C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223090C */ _t10 = _t9 & 0x00000001u;
         /* 0223090C */ if (_t10) goto L_02230910; else goto L_02230918;
   L_02230910: ; // 0x2230910
@@ -5748,8 +5748,8 @@ void Gambit_fn_022308C8(CPUState* cpu) {
         /* 02230914 */ Gambit_fn_02801A78(cpu);
   L_02230918: ; // 0x2230918
         /* 02230918 */ cpu->r[0] = cpu->r[31] + 0x0000015Cu;
-        /* 02230918 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223091C */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223091C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223091C */ _t12 = _t11 & 0x00000001u;
         /* 0223091C */ if (_t12) goto L_02230920; else goto L_02230928;
   L_02230920: ; // 0x2230920
@@ -5956,8 +5956,8 @@ void Gambit_fn_02230A6C(CPUState* cpu) {
         /* 02230AD8 */ cpu->f[8] = fma(cpu->f[11], cpu->f[11], cpu->f[13]);
         /* 02230ADC */ _t17 = cpu->r[12] + 0x00001080u;
         /* 02230ADC */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t17);
-        /* 02230AE0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[13]);
-        /* 02230AE4 */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02230AE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[13]));
+        /* 02230AE4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02230AE4 */ _t19 = _t18 & 0x00000001u;
         /* 02230AE4 */ if (_t19) goto L_02230AE8; else goto L_02230B24;
   L_02230AE8: ; // 0x2230ae8
@@ -5988,8 +5988,8 @@ void Gambit_fn_02230A6C(CPUState* cpu) {
         /* 02230B2C */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 02230B30 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 02230B34 */ Gambit_fn_021C6DD8(cpu);
-        /* 02230B38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02230B3C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230B38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02230B3C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02230B3C */ _t27 = _t26 & 0x00000001u;
         /* 02230B3C */ if (_t27) goto L_02230B40; else goto L_02230B54;
   L_02230B40: ; // 0x2230b40
@@ -6104,8 +6104,8 @@ void Gambit_fn_02230A70(CPUState* cpu) {
         /* 02230AD8 */ cpu->f[8] = fma(cpu->f[11], cpu->f[11], cpu->f[13]);
         /* 02230ADC */ _t17 = cpu->r[12] + 0x00001080u;
         /* 02230ADC */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t17);
-        /* 02230AE0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[13]);
-        /* 02230AE4 */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02230AE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[13]));
+        /* 02230AE4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02230AE4 */ _t19 = _t18 & 0x00000001u;
         /* 02230AE4 */ if (_t19) goto L_02230AE8; else goto L_02230B24;
   L_02230AE8: ; // 0x2230ae8
@@ -6136,8 +6136,8 @@ void Gambit_fn_02230A70(CPUState* cpu) {
         /* 02230B2C */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 02230B30 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 02230B34 */ Gambit_fn_021C6DD8(cpu);
-        /* 02230B38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02230B3C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230B38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02230B3C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02230B3C */ _t27 = _t26 & 0x00000001u;
         /* 02230B3C */ if (_t27) goto L_02230B40; else goto L_02230B54;
   L_02230B40: ; // 0x2230b40
@@ -6378,8 +6378,8 @@ void Gambit_fn_02230C78(CPUState* cpu) {
         /* 02230C78 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02230C78 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02230C7C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 02230C7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02230C80 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230C7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02230C80 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02230C80 */ _t2 = _t1 & 0x00000001u;
         /* 02230C80 */ _t3 = _t2 ^ 0x00000001u;
         /* 02230C80 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -6401,8 +6401,8 @@ void Gambit_fn_02230C94(CPUState* cpu) {
         /* 02230C94 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02230C94 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02230C98 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 02230C98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02230C9C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230C98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02230C9C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02230C9C */ _t2 = _t1 & 0x00000001u;
         /* 02230C9C */ _t3 = _t2 ^ 0x00000001u;
         /* 02230C9C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -6424,8 +6424,8 @@ void Gambit_fn_02230CB0(CPUState* cpu) {
         /* 02230CB0 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02230CB0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02230CB4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 02230CB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02230CB8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230CB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02230CB8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02230CB8 */ _t2 = _t1 & 0x00000001u;
         /* 02230CB8 */ _t3 = _t2 ^ 0x00000001u;
         /* 02230CB8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -6468,8 +6468,8 @@ void Gambit_fn_02230CDC(CPUState* cpu) {
         /* 02230CEC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02230CF0 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02230CF0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02230CF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02230CF8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230CF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02230CF8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02230CF8 */ _t5 = _t4 & 0x00000001u;
         /* 02230CF8 */ if (_t5) goto L_02230CFC; else goto L_02230D18;
   L_02230CFC: ; // 0x2230cfc
@@ -6508,8 +6508,8 @@ void Gambit_fn_02230CE0(CPUState* cpu) {
         /* 02230CEC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02230CF0 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02230CF0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02230CF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02230CF8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230CF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02230CF8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02230CF8 */ _t5 = _t4 & 0x00000001u;
         /* 02230CF8 */ if (_t5) goto L_02230CFC; else goto L_02230D18;
   L_02230CFC: ; // 0x2230cfc
@@ -6977,8 +6977,8 @@ void Gambit_fn_02230EF8(CPUState* cpu) {
         /* 02230EF8 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 02230EF8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02230EFC */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 02230EFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02230F00 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230EFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02230F00 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02230F00 */ _t2 = _t1 & 0x00000001u;
         /* 02230F00 */ if (_t2) goto L_02230F10; else goto L_02230F04;
   L_02230F04: ; // 0x2230f04
@@ -7005,8 +7005,8 @@ void Gambit_fn_02230F1C(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -7074,10 +7074,10 @@ void Gambit_fn_02230F4C(CPUState* cpu) {
         /* 02230F4C */ cpu->r[10] = 0x101D0000u;
         /* 02230F50 */ _t0 = cpu->r[10] + 0xFFFFFE14u;
         /* 02230F50 */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 02230F54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02230F54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02230F58 */ cpu->r[10] = 0x101D0000u;
         /* 02230F5C */ cpu->r[10] = cpu->r[10] + 0xFFFFFF84u;
-        /* 02230F60 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230F60 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02230F60 */ _t2 = _t1 & 0x00000001u;
         /* 02230F60 */ if (_t2) goto L_02230F64; else goto L_02230F7C;
   L_02230F64: ; // 0x2230f64
@@ -7090,8 +7090,8 @@ void Gambit_fn_02230F4C(CPUState* cpu) {
         /* 02230F78 */ _t4 = cpu->r[10] + 0x00000000u;
         /* 02230F78 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_02230F7C: ; // 0x2230f7c
-        /* 02230F7C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02230F80 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230F7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02230F80 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02230F80 */ _t6 = _t5 & 0x00000001u;
         /* 02230F80 */ if (_t6) goto L_02230F84; else goto L_02230F8C;
   L_02230F84: ; // 0x2230f84
@@ -7102,9 +7102,9 @@ void Gambit_fn_02230F4C(CPUState* cpu) {
         /* 02230F90 */ _t7 = cpu->r[9] + 0xFFFFDA00u;
         /* 02230F90 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 02230F94 */ cpu->r[11] = 0x101D0000u;
-        /* 02230F98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02230F98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02230F9C */ cpu->r[11] = cpu->r[11] + 0xFFFFFBFCu;
-        /* 02230FA0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230FA0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02230FA0 */ _t9 = _t8 & 0x00000001u;
         /* 02230FA0 */ if (_t9) goto L_02230FA4; else goto L_02230FBC;
   L_02230FA4: ; // 0x2230fa4
@@ -7117,8 +7117,8 @@ void Gambit_fn_02230F4C(CPUState* cpu) {
         /* 02230FB8 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 02230FB8 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_02230FBC: ; // 0x2230fbc
-        /* 02230FBC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 02230FC0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230FBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 02230FC0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02230FC0 */ _t13 = _t12 & 0x00000001u;
         /* 02230FC0 */ if (_t13) goto L_02230FC4; else goto L_02230FCC;
   L_02230FC4: ; // 0x2230fc4
@@ -7129,9 +7129,9 @@ void Gambit_fn_02230F4C(CPUState* cpu) {
         /* 02230FD0 */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 02230FD0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 02230FD4 */ cpu->r[9] = 0x101D0000u;
-        /* 02230FD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02230FD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02230FDC */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 02230FE0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230FE0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02230FE0 */ _t16 = _t15 & 0x00000001u;
         /* 02230FE0 */ if (_t16) goto L_02230FE4; else goto L_02230FFC;
   L_02230FE4: ; // 0x2230fe4
@@ -7144,8 +7144,8 @@ void Gambit_fn_02230F4C(CPUState* cpu) {
         /* 02230FF8 */ _t18 = cpu->r[9] + 0x00000000u;
         /* 02230FF8 */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_02230FFC: ; // 0x2230ffc
-        /* 02230FFC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 02231000 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02230FFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 02231000 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231000 */ _t20 = _t19 & 0x00000001u;
         /* 02231000 */ if (_t20) goto L_02231004; else goto L_0223100C;
   L_02231004: ; // 0x2231004
@@ -7157,9 +7157,9 @@ void Gambit_fn_02230F4C(CPUState* cpu) {
         /* 02231010 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 02231010 */ cpu->r[9] = _t21;
         /* 02231014 */ cpu->r[10] = 0x101D0000u;
-        /* 02231018 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02231018 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0223101C */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 02231020 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231020 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231020 */ _t23 = _t22 & 0x00000001u;
         /* 02231020 */ if (_t23) goto L_02231024; else goto L_02231038;
   L_02231024: ; // 0x2231024
@@ -7171,8 +7171,8 @@ void Gambit_fn_02230F4C(CPUState* cpu) {
         /* 02231034 */ _t25 = cpu->r[10] + 0x00000000u;
         /* 02231034 */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_02231038: ; // 0x2231038
-        /* 02231038 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0223103C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231038 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0223103C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223103C */ _t27 = _t26 & 0x00000001u;
         /* 0223103C */ if (_t27) goto L_02231040; else goto L_02231048;
   L_02231040: ; // 0x2231040
@@ -7184,9 +7184,9 @@ void Gambit_fn_02230F4C(CPUState* cpu) {
         /* 0223104C */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 0223104C */ cpu->r[10] = _t28;
         /* 02231050 */ cpu->r[11] = 0x101D0000u;
-        /* 02231054 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02231054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02231058 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 0223105C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223105C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223105C */ _t30 = _t29 & 0x00000001u;
         /* 0223105C */ if (_t30) goto L_02231060; else goto L_02231074;
   L_02231060: ; // 0x2231060
@@ -7250,16 +7250,16 @@ void Gambit_fn_022310AC(CPUState* cpu) {
         /* 022310BC */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 022310C0 */ /* nop */
         /* 022310C4 */ cpu->r[29] = cpu->r[3];
-        /* 022310C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 022310C8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022310C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 022310C8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022310C8 */ _t5 = _t4 & 0x00000001u;
         /* 022310C8 */ if (_t5) goto L_022310CC; else goto L_022310DC;
   L_022310CC: ; // 0x22310cc
         /* 022310CC */ cpu->r[3] = 0x00000318u;
         /* 022310D0 */ Gambit_fn_02801A78(cpu);
         /* 022310D4 */ cpu->r[29] = cpu->r[3];
-        /* 022310D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 022310D8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022310D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 022310D8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022310D8 */ _t7 = _t6 & 0x00000001u;
         /* 022310D8 */ if (_t7) goto L_0223166C; else goto L_022310DC;
   L_022310DC: ; // 0x22310dc
@@ -7267,20 +7267,20 @@ void Gambit_fn_022310AC(CPUState* cpu) {
         /* 022310E0 */ Gambit_fn_021BAF70(cpu);
         /* 022310E4 */ cpu->r[9] = 0x10050000u;
         /* 022310E8 */ cpu->r[31] = cpu->r[29] + 0x00000084u;
-        /* 022310E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 022310E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 022310EC */ cpu->r[9] = cpu->r[9] + 0x000016A4u;
         /* 022310F0 */ cpu->r[28] = 0x00000000u;
         /* 022310F4 */ _t8 = cpu->r[29] + 0x00000004u;
         /* 022310F4 */ rbrew_write32(cpu->mem, _t8, cpu->r[9]);
-        /* 022310F8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022310F8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022310F8 */ _t10 = _t9 & 0x00000001u;
         /* 022310F8 */ if (_t10) goto L_022310FC; else goto L_0223110C;
   L_022310FC: ; // 0x22310fc
         /* 022310FC */ cpu->r[3] = 0x00000038u;
         /* 02231100 */ Gambit_fn_02801A78(cpu);
         /* 02231104 */ cpu->r[31] = cpu->r[3];
-        /* 02231104 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02231108 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231104 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02231108 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231108 */ _t12 = _t11 & 0x00000001u;
         /* 02231108 */ if (_t12) goto L_0223113C; else goto L_0223110C;
   L_0223110C: ; // 0x223110c
@@ -7306,8 +7306,8 @@ void Gambit_fn_022310AC(CPUState* cpu) {
         /* 02231138 */ rbrew_write32(cpu->mem, _t20, cpu->r[28]);
   L_0223113C: ; // 0x223113c
         /* 0223113C */ cpu->r[0] = cpu->r[29] + 0x000000BCu;
-        /* 0223113C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02231140 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223113C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02231140 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231140 */ _t22 = _t21 & 0x00000001u;
         /* 02231140 */ if (_t22) goto L_02231144; else goto L_0223114C;
   L_02231144: ; // 0x2231144
@@ -7316,29 +7316,29 @@ void Gambit_fn_022310AC(CPUState* cpu) {
   L_0223114C: ; // 0x223114c
         /* 0223114C */ cpu->r[12] = 0x10050000u;
         /* 02231150 */ cpu->r[3] = cpu->r[29] + 0x000000ECu;
-        /* 02231150 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02231150 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02231154 */ _t23 = cpu->r[12] + 0x00001514u;
         /* 02231154 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t23);
-        /* 02231158 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231158 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231158 */ _t25 = _t24 & 0x00000001u;
         /* 02231158 */ if (_t25) goto L_0223115C; else goto L_0223116C;
   L_0223115C: ; // 0x223115c
         /* 0223115C */ cpu->r[3] = 0x0000000Cu;
         /* 02231160 */ Gambit_fn_02801A78(cpu);
-        /* 02231164 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02231168 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231164 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02231168 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231168 */ _t27 = _t26 & 0x00000001u;
         /* 02231168 */ if (_t27) goto L_02231190; else goto L_0223116C;
   L_0223116C: ; // 0x223116c
-        /* 0223116C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02231170 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223116C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02231170 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231170 */ _t29 = _t28 & 0x00000001u;
         /* 02231170 */ if (_t29) goto L_02231174; else goto L_02231184;
   L_02231174: ; // 0x2231174
         /* 02231174 */ cpu->r[3] = 0x0000000Cu;
         /* 02231178 */ Gambit_fn_02801A78(cpu);
-        /* 0223117C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02231180 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223117C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02231180 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231180 */ _t31 = _t30 & 0x00000001u;
         /* 02231180 */ if (_t31) goto L_02231190; else goto L_02231184;
   L_02231184: ; // 0x2231184
@@ -7350,8 +7350,8 @@ void Gambit_fn_022310AC(CPUState* cpu) {
         /* 0223118C */ rbrew_write_f32(cpu->mem, _t34, cpu->f[31]);
   L_02231190: ; // 0x2231190
         /* 02231190 */ cpu->r[5] = cpu->r[29] + 0x000000F8u;
-        /* 02231190 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 02231194 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231190 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 02231194 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231194 */ _t36 = _t35 & 0x00000001u;
         /* 02231194 */ if (_t36) goto L_02231198; else goto L_022311A0;
   L_02231198: ; // 0x2231198
@@ -7359,27 +7359,27 @@ void Gambit_fn_022310AC(CPUState* cpu) {
         /* 0223119C */ Gambit_fn_02801A78(cpu);
   L_022311A0: ; // 0x22311a0
         /* 022311A0 */ cpu->r[3] = cpu->r[29] + 0x00000128u;
-        /* 022311A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022311A4 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022311A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022311A4 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022311A4 */ _t38 = _t37 & 0x00000001u;
         /* 022311A4 */ if (_t38) goto L_022311A8; else goto L_022311B8;
   L_022311A8: ; // 0x22311a8
         /* 022311A8 */ cpu->r[3] = 0x0000000Cu;
         /* 022311AC */ Gambit_fn_02801A78(cpu);
-        /* 022311B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022311B4 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022311B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022311B4 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022311B4 */ _t40 = _t39 & 0x00000001u;
         /* 022311B4 */ if (_t40) goto L_022311DC; else goto L_022311B8;
   L_022311B8: ; // 0x22311b8
-        /* 022311B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022311BC */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022311B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022311BC */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022311BC */ _t42 = _t41 & 0x00000001u;
         /* 022311BC */ if (_t42) goto L_022311C0; else goto L_022311D0;
   L_022311C0: ; // 0x22311c0
         /* 022311C0 */ cpu->r[3] = 0x0000000Cu;
         /* 022311C4 */ Gambit_fn_02801A78(cpu);
-        /* 022311C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022311CC */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022311C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022311CC */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022311CC */ _t44 = _t43 & 0x00000001u;
         /* 022311CC */ if (_t44) goto L_022311DC; else goto L_022311D0;
   L_022311D0: ; // 0x22311d0
@@ -7391,10 +7391,10 @@ void Gambit_fn_022310AC(CPUState* cpu) {
         /* 022311D8 */ rbrew_write_f32(cpu->mem, _t47, cpu->f[31]);
   L_022311DC: ; // 0x22311dc
         /* 022311DC */ cpu->r[6] = cpu->r[29] + 0x00000138u;
-        /* 022311DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 022311DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 022311E0 */ _t48 = cpu->r[29] + 0x00000134u;
         /* 022311E0 */ rbrew_write_f32(cpu->mem, _t48, cpu->f[31]);
-        /* 022311E4 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022311E4 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022311E4 */ _t50 = _t49 & 0x00000001u;
         /* 022311E4 */ if (_t50) goto L_022311E8; else goto L_022311F0;
   L_022311E8: ; // 0x22311e8
@@ -7454,23 +7454,23 @@ void Gambit_fn_022310AC(CPUState* cpu) {
         /* 02231294 */ _t60 = cpu->r[5] + 0x00000000u;
         /* 02231294 */ cpu->r[0] = rbrew_read8(cpu->mem, _t60);
         /* 02231298 */ cpu->r[31] = 0x00000000u;
-        /* 0223129C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
+        /* 0223129C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
         /* 022312A0 */ cpu->r[7] = 0x00080000u;
-        /* 022312A4 */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022312A4 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022312A4 */ _t62 = _t61 & 0x00000001u;
         /* 022312A4 */ if (_t62) goto L_022312CC; else goto L_022312A8;
   L_022312A8: ; // 0x22312a8
         /* 022312A8 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 022312AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[7]);
+        /* 022312AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[7]));
         /* 022312B0 */ cpu->r[5] = cpu->r[5] + 0x00000001u;
-        /* 022312B4 */ _t63 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022312B4 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022312B4 */ _t64 = _t63 & 0x00000001u;
         /* 022312B4 */ if (_t64) goto L_022312C8; else goto L_022312B8;
   L_022312B8: ; // 0x22312b8
         /* 022312B8 */ _t65 = cpu->r[5] + 0x00000000u;
         /* 022312B8 */ cpu->r[6] = rbrew_read8(cpu->mem, _t65);
-        /* 022312BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], cpu->r[30]);
-        /* 022312C0 */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022312BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], cpu->r[30]));
+        /* 022312C0 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022312C0 */ _t67 = _t66 & 0x00000001u;
         /* 022312C0 */ if (_t67) goto L_022312C4; else goto L_022312A8;
   L_022312C4: ; // 0x22312c4
@@ -7482,10 +7482,10 @@ void Gambit_fn_022310AC(CPUState* cpu) {
         /* 022312CC */ cpu->r[10] = rbrew_read32(cpu->mem, _t68);
         /* 022312D0 */ _t69 = cpu->r[1] + 0x00000010u;
         /* 022312D0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t69);
-        /* 022312D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 022312D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 022312D8 */ _t70 = cpu->r[8] + 0x00000014u;
         /* 022312D8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t70);
-        /* 022312DC */ _t71 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022312DC */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022312DC */ _t72 = _t71 & 0x00000001u;
         /* 022312DC */ if (_t72) goto L_022312E4; else goto L_022312E0;
   L_022312E0: ; // 0x22312e0
@@ -7542,10 +7542,10 @@ void Gambit_fn_022310AC(CPUState* cpu) {
         /* 0223136C */ rbrew_write32(cpu->mem, _t86, cpu->r[5]);
         /* 02231370 */ _t87 = cpu->r[29] + 0x00000098u;
         /* 02231370 */ cpu->r[9] = rbrew_read32(cpu->mem, _t87);
-        /* 02231374 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000001u);
+        /* 02231374 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000001u));
         /* 02231378 */ _t88 = cpu->r[29] + 0x0000009Cu;
         /* 02231378 */ cpu->r[25] = rbrew_read32(cpu->mem, _t88);
-        /* 0223137C */ _t89 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223137C */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223137C */ _t90 = _t89 & 0x00000001u;
         /* 0223137C */ if (_t90) goto L_02231380; else goto L_02231384;
   L_02231380: ; // 0x2231380
@@ -7561,23 +7561,23 @@ void Gambit_fn_022310AC(CPUState* cpu) {
         /* 02231398 */ _t93 = cpu->r[9] + 0x00000000u;
         /* 02231398 */ cpu->r[0] = rbrew_read8(cpu->mem, _t93);
         /* 0223139C */ cpu->r[31] = 0x00000000u;
-        /* 022313A0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
+        /* 022313A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
         /* 022313A4 */ cpu->r[10] = 0x00080000u;
-        /* 022313A8 */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022313A8 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022313A8 */ _t95 = _t94 & 0x00000001u;
         /* 022313A8 */ if (_t95) goto L_022313D0; else goto L_022313AC;
   L_022313AC: ; // 0x22313ac
         /* 022313AC */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 022313B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 022313B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 022313B4 */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 022313B8 */ _t96 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022313B8 */ _t96 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022313B8 */ _t97 = _t96 & 0x00000001u;
         /* 022313B8 */ if (_t97) goto L_022313CC; else goto L_022313BC;
   L_022313BC: ; // 0x22313bc
         /* 022313BC */ _t98 = cpu->r[9] + 0x00000000u;
         /* 022313BC */ cpu->r[5] = rbrew_read8(cpu->mem, _t98);
-        /* 022313C0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[30]);
-        /* 022313C4 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022313C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[30]));
+        /* 022313C4 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022313C4 */ _t100 = _t99 & 0x00000001u;
         /* 022313C4 */ if (_t100) goto L_022313C8; else goto L_022313AC;
   L_022313C8: ; // 0x22313c8
@@ -7589,10 +7589,10 @@ void Gambit_fn_022310AC(CPUState* cpu) {
         /* 022313D0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t101);
         /* 022313D4 */ _t102 = cpu->r[1] + 0x00000010u;
         /* 022313D4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t102);
-        /* 022313D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[12]);
+        /* 022313D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[12]));
         /* 022313DC */ _t103 = cpu->r[7] + 0x00000014u;
         /* 022313DC */ cpu->r[8] = rbrew_read32(cpu->mem, _t103);
-        /* 022313E0 */ _t104 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022313E0 */ _t104 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022313E0 */ _t105 = _t104 & 0x00000001u;
         /* 022313E0 */ if (_t105) goto L_022313E8; else goto L_022313E4;
   L_022313E4: ; // 0x22313e4
@@ -7649,10 +7649,10 @@ void Gambit_fn_022310AC(CPUState* cpu) {
         /* 02231470 */ rbrew_write32(cpu->mem, _t119, cpu->r[8]);
         /* 02231474 */ _t120 = cpu->r[29] + 0x00000098u;
         /* 02231474 */ cpu->r[9] = rbrew_read32(cpu->mem, _t120);
-        /* 02231478 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000002u);
+        /* 02231478 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000002u));
         /* 0223147C */ _t121 = cpu->r[29] + 0x0000009Cu;
         /* 0223147C */ cpu->r[31] = rbrew_read32(cpu->mem, _t121);
-        /* 02231480 */ _t122 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02231480 */ _t122 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02231480 */ _t123 = _t122 & 0x00000001u;
         /* 02231480 */ if (_t123) goto L_02231484; else goto L_02231488;
   L_02231484: ; // 0x2231484
@@ -7668,23 +7668,23 @@ void Gambit_fn_022310AC(CPUState* cpu) {
         /* 0223149C */ _t126 = cpu->r[12] + 0x00000000u;
         /* 0223149C */ cpu->r[0] = rbrew_read8(cpu->mem, _t126);
         /* 022314A0 */ cpu->r[25] = 0x00000000u;
-        /* 022314A4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
+        /* 022314A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
         /* 022314A8 */ cpu->r[6] = 0x00080000u;
-        /* 022314AC */ _t127 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022314AC */ _t127 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022314AC */ _t128 = _t127 & 0x00000001u;
         /* 022314AC */ if (_t128) goto L_022314D4; else goto L_022314B0;
   L_022314B0: ; // 0x22314b0
         /* 022314B0 */ cpu->r[25] = cpu->r[25] + 0x00000001u;
-        /* 022314B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], cpu->r[6]);
+        /* 022314B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], cpu->r[6]));
         /* 022314B8 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 022314BC */ _t129 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022314BC */ _t129 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022314BC */ _t130 = _t129 & 0x00000001u;
         /* 022314BC */ if (_t130) goto L_022314D0; else goto L_022314C0;
   L_022314C0: ; // 0x22314c0
         /* 022314C0 */ _t131 = cpu->r[12] + 0x00000000u;
         /* 022314C0 */ cpu->r[5] = rbrew_read8(cpu->mem, _t131);
-        /* 022314C4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[30]);
-        /* 022314C8 */ _t132 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022314C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[30]));
+        /* 022314C8 */ _t132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022314C8 */ _t133 = _t132 & 0x00000001u;
         /* 022314C8 */ if (_t133) goto L_022314CC; else goto L_022314B0;
   L_022314CC: ; // 0x22314cc
@@ -7696,10 +7696,10 @@ void Gambit_fn_022310AC(CPUState* cpu) {
         /* 022314D4 */ cpu->r[6] = rbrew_read32(cpu->mem, _t134);
         /* 022314D8 */ _t135 = cpu->r[1] + 0x00000010u;
         /* 022314D8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t135);
-        /* 022314DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], cpu->r[6]);
+        /* 022314DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], cpu->r[6]));
         /* 022314E0 */ _t136 = cpu->r[7] + 0x00000014u;
         /* 022314E0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t136);
-        /* 022314E4 */ _t137 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022314E4 */ _t137 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022314E4 */ _t138 = _t137 & 0x00000001u;
         /* 022314E4 */ if (_t138) goto L_022314EC; else goto L_022314E8;
   L_022314E8: ; // 0x22314e8
@@ -7756,10 +7756,10 @@ void Gambit_fn_022310AC(CPUState* cpu) {
         /* 02231574 */ rbrew_write32(cpu->mem, _t152, cpu->r[5]);
         /* 02231578 */ _t153 = cpu->r[29] + 0x00000098u;
         /* 02231578 */ cpu->r[6] = rbrew_read32(cpu->mem, _t153);
-        /* 0223157C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], 0x00000003u);
+        /* 0223157C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], 0x00000003u));
         /* 02231580 */ _t154 = cpu->r[29] + 0x0000009Cu;
         /* 02231580 */ cpu->r[27] = rbrew_read32(cpu->mem, _t154);
-        /* 02231584 */ _t155 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02231584 */ _t155 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02231584 */ _t156 = _t155 & 0x00000001u;
         /* 02231584 */ if (_t156) goto L_02231588; else goto L_0223158C;
   L_02231588: ; // 0x2231588
@@ -7775,23 +7775,23 @@ void Gambit_fn_022310AC(CPUState* cpu) {
         /* 022315A0 */ _t159 = cpu->r[6] + 0x00000000u;
         /* 022315A0 */ cpu->r[7] = rbrew_read8(cpu->mem, _t159);
         /* 022315A4 */ cpu->r[31] = 0x00000000u;
-        /* 022315A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[30]);
+        /* 022315A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[30]));
         /* 022315AC */ cpu->r[10] = 0x00080000u;
-        /* 022315B0 */ _t160 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022315B0 */ _t160 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022315B0 */ _t161 = _t160 & 0x00000001u;
         /* 022315B0 */ if (_t161) goto L_022315D8; else goto L_022315B4;
   L_022315B4: ; // 0x22315b4
         /* 022315B4 */ cpu->r[31] = cpu->r[31] + 0x00000001u;
-        /* 022315B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[10]);
+        /* 022315B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[10]));
         /* 022315BC */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 022315C0 */ _t162 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022315C0 */ _t162 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022315C0 */ _t163 = _t162 & 0x00000001u;
         /* 022315C0 */ if (_t163) goto L_022315D4; else goto L_022315C4;
   L_022315C4: ; // 0x22315c4
         /* 022315C4 */ _t164 = cpu->r[6] + 0x00000000u;
         /* 022315C4 */ cpu->r[8] = rbrew_read8(cpu->mem, _t164);
-        /* 022315C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[30]);
-        /* 022315CC */ _t165 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022315C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[30]));
+        /* 022315CC */ _t165 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022315CC */ _t166 = _t165 & 0x00000001u;
         /* 022315CC */ if (_t166) goto L_022315D0; else goto L_022315B4;
   L_022315D0: ; // 0x22315d0
@@ -7803,10 +7803,10 @@ void Gambit_fn_022310AC(CPUState* cpu) {
         /* 022315D8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t167);
         /* 022315DC */ _t168 = cpu->r[1] + 0x00000010u;
         /* 022315DC */ cpu->r[9] = rbrew_read32(cpu->mem, _t168);
-        /* 022315E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], cpu->r[8]);
+        /* 022315E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], cpu->r[8]));
         /* 022315E4 */ _t169 = cpu->r[9] + 0x00000014u;
         /* 022315E4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t169);
-        /* 022315E8 */ _t170 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022315E8 */ _t170 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022315E8 */ _t171 = _t170 & 0x00000001u;
         /* 022315E8 */ if (_t171) goto L_022315F0; else goto L_022315EC;
   L_022315EC: ; // 0x22315ec
@@ -7862,7 +7862,7 @@ void Gambit_fn_022310AC(CPUState* cpu) {
         /* 02231674 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t184);
         /* 02231678 */ _t185 = cpu->r[1] + 0x00000050u;
         /* 02231678 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t185);
-        /* 0223167C */ _t186 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223167C */ _t186 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223167C */ _t187 = _t186 & 0x00000001u;
         /* 0223167C */ if (_t187) goto L_02231680; // else: addr-0 trap, fall-through
   L_02231680: ; // 0x2231680
@@ -8011,8 +8011,8 @@ void Gambit_fn_022317F0(CPUState* cpu) {
   L_022317F0: ; // 0x22317f0
         /* 022317F0 */ _t0 = cpu->r[3] + 0x00000314u;
         /* 022317F0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
-        /* 022317F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022317F8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022317F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022317F8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022317F8 */ _t2 = _t1 & 0x00000001u;
         /* 022317F8 */ if (_t2) goto L_02231808; else goto L_022317FC;
   L_022317FC: ; // 0x22317fc
@@ -8049,9 +8049,9 @@ void Gambit_fn_02231814(CPUState* cpu) {
         /* 02231838 */ cpu->r[30] = cpu->r[6];
         /* 0223183C */ cpu->r[31] = cpu->r[7];
         /* 02231840 */ cpu->r[4] = cpu->r[4] + 0xFFFFE310u;
-        /* 02231844 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02231844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02231848 */ cpu->r[29] = cpu->r[5];
-        /* 0223184C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223184C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223184C */ _t4 = _t3 & 0x00000001u;
         /* 0223184C */ if (_t4) goto L_02231850; else goto L_02231864;
   L_02231850: ; // 0x2231850
@@ -8063,8 +8063,8 @@ void Gambit_fn_02231814(CPUState* cpu) {
         /* 02231860 */ _t6 = cpu->r[4] + 0x00000000u;
         /* 02231860 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
   L_02231864: ; // 0x2231864
-        /* 02231864 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 02231868 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231864 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 02231868 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231868 */ _t8 = _t7 & 0x00000001u;
         /* 02231868 */ if (_t8) goto L_022318C4; else goto L_0223186C;
   L_0223186C: ; // 0x223186c
@@ -8075,8 +8075,8 @@ void Gambit_fn_02231814(CPUState* cpu) {
         /* 02231874 */ cpu->ctr = cpu->r[0];
         /* 02231878 */ cpu->r[3] = cpu->r[28];
         /* 0223187C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02231880 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02231884 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231880 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02231884 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231884 */ _t12 = _t11 & 0x00000001u;
         /* 02231884 */ if (_t12) goto L_022318C4; else goto L_02231888;
   L_02231888: ; // 0x2231888
@@ -8199,9 +8199,9 @@ void Gambit_fn_0223199C(CPUState* cpu) {
         /* 022319C0 */ cpu->r[30] = cpu->r[6];
         /* 022319C4 */ cpu->r[31] = cpu->r[7];
         /* 022319C8 */ cpu->r[4] = cpu->r[4] + 0xFFFFE310u;
-        /* 022319CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 022319CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 022319D0 */ cpu->r[29] = cpu->r[5];
-        /* 022319D4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022319D4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022319D4 */ _t4 = _t3 & 0x00000001u;
         /* 022319D4 */ if (_t4) goto L_022319D8; else goto L_022319EC;
   L_022319D8: ; // 0x22319d8
@@ -8213,8 +8213,8 @@ void Gambit_fn_0223199C(CPUState* cpu) {
         /* 022319E8 */ _t6 = cpu->r[4] + 0x00000000u;
         /* 022319E8 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
   L_022319EC: ; // 0x22319ec
-        /* 022319EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 022319F0 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022319EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 022319F0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022319F0 */ _t8 = _t7 & 0x00000001u;
         /* 022319F0 */ if (_t8) goto L_02231A4C; else goto L_022319F4;
   L_022319F4: ; // 0x22319f4
@@ -8225,8 +8225,8 @@ void Gambit_fn_0223199C(CPUState* cpu) {
         /* 022319FC */ cpu->ctr = cpu->r[0];
         /* 02231A00 */ cpu->r[3] = cpu->r[28];
         /* 02231A04 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02231A08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02231A0C */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231A08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02231A0C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231A0C */ _t12 = _t11 & 0x00000001u;
         /* 02231A0C */ if (_t12) goto L_02231A4C; else goto L_02231A10;
   L_02231A10: ; // 0x2231a10
@@ -8278,8 +8278,8 @@ void Gambit_fn_02231A98(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11;
 
   L_02231A98: ; // 0x2231a98
-        /* 02231A98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 02231A9C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231A98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 02231A9C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231A9C */ _t1 = _t0 & 0x00000001u;
         /* 02231A9C */ if (_t1) goto L_02231AA0; else goto L_02231AB8;
   L_02231AA0: ; // 0x2231aa0
@@ -8317,9 +8317,9 @@ void Gambit_fn_02231AE0(CPUState* cpu) {
     uint32_t _t0, _t1;
 
   L_02231AE0: ; // 0x2231ae0
-        /* 02231AE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02231AE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02231AE4 */ cpu->r[3] = 0x0000000Au;
-        /* 02231AE8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231AE8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231AE8 */ _t1 = _t0 & 0x00000001u;
         /* 02231AE8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02231AE8 */ goto L_02231AEC;
@@ -8425,10 +8425,10 @@ void Gambit_fn_02231B04(CPUState* cpu) {
         /* 02231BC0 */ rbrew_write32(cpu->mem, _t26, cpu->r[0]);
         /* 02231BC4 */ Gambit_fn_0204A864(cpu);
         /* 02231BC8 */ cpu->r[6] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02231BC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02231BC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 02231BCC */ _t27 = cpu->r[31] + 0x00000148u;
         /* 02231BCC */ rbrew_write32(cpu->mem, _t27, cpu->r[3]);
-        /* 02231BD0 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231BD0 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231BD0 */ _t29 = _t28 & 0x00000001u;
         /* 02231BD0 */ if (_t29) goto L_02231C04; else goto L_02231BD4;
   L_02231BD4: ; // 0x2231bd4
@@ -8437,8 +8437,8 @@ void Gambit_fn_02231B04(CPUState* cpu) {
         /* 02231BD8 */ _t31 = cpu->r[10] + 0x0000015Cu;
         /* 02231BD8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t31);
         /* 02231BDC */ cpu->r[8] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 02231BDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02231BE0 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231BDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02231BE0 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231BE0 */ _t33 = _t32 & 0x00000001u;
         /* 02231BE0 */ if (_t33) goto L_02231BF0; else goto L_02231BE4;
   L_02231BE4: ; // 0x2231be4
@@ -8449,8 +8449,8 @@ void Gambit_fn_02231B04(CPUState* cpu) {
         /* 02231BEC */ goto L_02231C10;
   L_02231BF0: ; // 0x2231bf0
         /* 02231BF0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 02231BF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02231BF4 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231BF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02231BF4 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231BF4 */ _t37 = _t36 & 0x00000001u;
         /* 02231BF4 */ if (_t37) goto L_02231C10; else goto L_02231BF8;
   L_02231BF8: ; // 0x2231bf8
@@ -8559,10 +8559,10 @@ void Gambit_fn_02231B08(CPUState* cpu) {
         /* 02231BC0 */ rbrew_write32(cpu->mem, _t26, cpu->r[0]);
         /* 02231BC4 */ Gambit_fn_0204A864(cpu);
         /* 02231BC8 */ cpu->r[6] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02231BC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02231BC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 02231BCC */ _t27 = cpu->r[31] + 0x00000148u;
         /* 02231BCC */ rbrew_write32(cpu->mem, _t27, cpu->r[3]);
-        /* 02231BD0 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231BD0 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231BD0 */ _t29 = _t28 & 0x00000001u;
         /* 02231BD0 */ if (_t29) goto L_02231C04; else goto L_02231BD4;
   L_02231BD4: ; // 0x2231bd4
@@ -8571,8 +8571,8 @@ void Gambit_fn_02231B08(CPUState* cpu) {
         /* 02231BD8 */ _t31 = cpu->r[10] + 0x0000015Cu;
         /* 02231BD8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t31);
         /* 02231BDC */ cpu->r[8] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 02231BDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02231BE0 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231BDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02231BE0 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231BE0 */ _t33 = _t32 & 0x00000001u;
         /* 02231BE0 */ if (_t33) goto L_02231BF0; else goto L_02231BE4;
   L_02231BE4: ; // 0x2231be4
@@ -8583,8 +8583,8 @@ void Gambit_fn_02231B08(CPUState* cpu) {
         /* 02231BEC */ goto L_02231C10;
   L_02231BF0: ; // 0x2231bf0
         /* 02231BF0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 02231BF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02231BF4 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231BF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02231BF4 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231BF4 */ _t37 = _t36 & 0x00000001u;
         /* 02231BF4 */ if (_t37) goto L_02231C10; else goto L_02231BF8;
   L_02231BF8: ; // 0x2231bf8
@@ -8634,9 +8634,9 @@ void Gambit_fn_02231C28(CPUState* cpu) {
         /* 02231C48 */ _t6 = cpu->r[29] + 0x00000314u;
         /* 02231C48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t6);
         /* 02231C4C */ cpu->r[31] = cpu->r[5];
-        /* 02231C50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02231C50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02231C54 */ cpu->r[30] = cpu->r[4];
-        /* 02231C58 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231C58 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231C58 */ _t8 = _t7 & 0x00000001u;
         /* 02231C58 */ if (_t8) goto L_02231C60; else goto L_02231C5C;
   L_02231C5C: ; // 0x2231c5c
@@ -8671,8 +8671,8 @@ void Gambit_fn_02231C28(CPUState* cpu) {
         /* 02231CB0 */ _t14 = cpu->r[29] + 0x0000018Cu;
         /* 02231CB0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 02231CB4 */ cpu->r[0] = cpu->r[0] - cpu->r[28];
-        /* 02231CB8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[3]);
-        /* 02231CBC */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02231CB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[3]));
+        /* 02231CBC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02231CBC */ _t16 = _t15 & 0x00000001u;
         /* 02231CBC */ if (_t16) goto L_02231CC0; else goto L_02231CC8;
   L_02231CC0: ; // 0x2231cc0
@@ -8704,8 +8704,8 @@ void Gambit_fn_02231C28(CPUState* cpu) {
         /* 02231D04 */ cpu->r[12] = 0x101D0000u;
         /* 02231D08 */ _t24 = cpu->r[12] + 0xFFFF80F4u;
         /* 02231D08 */ cpu->r[12] = rbrew_read32(cpu->mem, _t24);
-        /* 02231D0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02231D10 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231D0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02231D10 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231D10 */ _t26 = _t25 & 0x00000001u;
         /* 02231D10 */ if (_t26) goto L_02231D28; else goto L_02231D14;
   L_02231D14: ; // 0x2231d14
@@ -8755,9 +8755,9 @@ void Gambit_fn_02231C2C(CPUState* cpu) {
         /* 02231C48 */ _t6 = cpu->r[29] + 0x00000314u;
         /* 02231C48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t6);
         /* 02231C4C */ cpu->r[31] = cpu->r[5];
-        /* 02231C50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02231C50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02231C54 */ cpu->r[30] = cpu->r[4];
-        /* 02231C58 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231C58 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231C58 */ _t8 = _t7 & 0x00000001u;
         /* 02231C58 */ if (_t8) goto L_02231C60; else goto L_02231C5C;
   L_02231C5C: ; // 0x2231c5c
@@ -8792,8 +8792,8 @@ void Gambit_fn_02231C2C(CPUState* cpu) {
         /* 02231CB0 */ _t14 = cpu->r[29] + 0x0000018Cu;
         /* 02231CB0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 02231CB4 */ cpu->r[0] = cpu->r[0] - cpu->r[28];
-        /* 02231CB8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[3]);
-        /* 02231CBC */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02231CB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[3]));
+        /* 02231CBC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02231CBC */ _t16 = _t15 & 0x00000001u;
         /* 02231CBC */ if (_t16) goto L_02231CC0; else goto L_02231CC8;
   L_02231CC0: ; // 0x2231cc0
@@ -8825,8 +8825,8 @@ void Gambit_fn_02231C2C(CPUState* cpu) {
         /* 02231D04 */ cpu->r[12] = 0x101D0000u;
         /* 02231D08 */ _t24 = cpu->r[12] + 0xFFFF80F4u;
         /* 02231D08 */ cpu->r[12] = rbrew_read32(cpu->mem, _t24);
-        /* 02231D0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02231D10 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231D0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02231D10 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231D10 */ _t26 = _t25 & 0x00000001u;
         /* 02231D10 */ if (_t26) goto L_02231D28; else goto L_02231D14;
   L_02231D14: ; // 0x2231d14
@@ -8871,8 +8871,8 @@ void Gambit_fn_02231D48(CPUState* cpu) {
         /* 02231D5C */ _t3 = cpu->r[31] + 0x00000090u;
         /* 02231D5C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02231D60 */ /* nop */
-        /* 02231D64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 02231D68 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231D64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 02231D68 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231D68 */ _t5 = _t4 & 0x00000001u;
         /* 02231D68 */ if (_t5) goto L_02231D6C; else goto L_02231E14;
   L_02231D6C: ; // 0x2231d6c
@@ -8929,8 +8929,8 @@ void Gambit_fn_02231D48(CPUState* cpu) {
         /* 02231E00 */ Gambit_fn_021620C4(cpu);
         /* 02231E04 */ _t19 = cpu->r[31] + 0x00000314u;
         /* 02231E04 */ cpu->r[3] = rbrew_read32(cpu->mem, _t19);
-        /* 02231E08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02231E0C */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231E08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02231E0C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231E0C */ _t21 = _t20 & 0x00000001u;
         /* 02231E0C */ if (_t21) goto L_02231E14; else goto L_02231E10;
   L_02231E10: ; // 0x2231e10
@@ -8961,8 +8961,8 @@ void Gambit_fn_02231D4C(CPUState* cpu) {
         /* 02231D5C */ _t3 = cpu->r[31] + 0x00000090u;
         /* 02231D5C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02231D60 */ /* nop */
-        /* 02231D64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 02231D68 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231D64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 02231D68 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231D68 */ _t5 = _t4 & 0x00000001u;
         /* 02231D68 */ if (_t5) goto L_02231D6C; else goto L_02231E14;
   L_02231D6C: ; // 0x2231d6c
@@ -9019,8 +9019,8 @@ void Gambit_fn_02231D4C(CPUState* cpu) {
         /* 02231E00 */ Gambit_fn_021620C4(cpu);
         /* 02231E04 */ _t19 = cpu->r[31] + 0x00000314u;
         /* 02231E04 */ cpu->r[3] = rbrew_read32(cpu->mem, _t19);
-        /* 02231E08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02231E0C */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231E08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02231E0C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231E0C */ _t21 = _t20 & 0x00000001u;
         /* 02231E0C */ if (_t21) goto L_02231E14; else goto L_02231E10;
   L_02231E10: ; // 0x2231e10
@@ -9052,8 +9052,8 @@ void Gambit_fn_02231E28(CPUState* cpu) {
         /* 02231D5C */ _t3 = cpu->r[31] + 0x00000090u;
         /* 02231D5C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02231D60 */ /* nop */
-        /* 02231D64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 02231D68 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231D64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 02231D68 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231D68 */ _t5 = _t4 & 0x00000001u;
         /* 02231D68 */ if (_t5) goto L_02231D6C; else goto L_02231E14;
   L_02231D6C: ; // 0x2231d6c
@@ -9110,8 +9110,8 @@ void Gambit_fn_02231E28(CPUState* cpu) {
         /* 02231E00 */ Gambit_fn_021620C4(cpu);
         /* 02231E04 */ _t19 = cpu->r[31] + 0x00000314u;
         /* 02231E04 */ cpu->r[3] = rbrew_read32(cpu->mem, _t19);
-        /* 02231E08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02231E0C */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231E08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02231E0C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231E0C */ _t21 = _t20 & 0x00000001u;
         /* 02231E0C */ if (_t21) goto L_02231E14; else goto L_02231E10;
   L_02231E10: ; // 0x2231e10
@@ -9128,19 +9128,19 @@ void Gambit_fn_02231E28(CPUState* cpu) {
         /* 02231E28 */ _t24 = cpu->r[3] + 0x00000090u;
         /* 02231E28 */ cpu->r[0] = rbrew_read8(cpu->mem, _t24);
         /* 02231E2C */ /* nop */
-        /* 02231E30 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231E30 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231E30 */ _t26 = _t25 & 0x00000001u;
         /* 02231E30 */ if (_t26) goto L_02231E3C; else goto L_02231E34;
   L_02231E34: ; // 0x2231e34
-        /* 02231E34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 02231E38 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231E34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 02231E38 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231E38 */ _t28 = _t27 & 0x00000001u;
         /* 02231E38 */ if (_t28) goto L_02231E40; else goto L_02231E3C;
   L_02231E3C: ; // 0x2231e3c
         /* 02231E3C */ goto L_02790488;
   L_02231E40: ; // 0x2231e40
-        /* 02231E40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 02231E44 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231E40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 02231E44 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231E44 */ _t30 = _t29 & 0x00000001u;
         /* 02231E44 */ _t31 = _t30 ^ 0x00000001u;
         /* 02231E44 */ if (_t31) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -9150,8 +9150,8 @@ void Gambit_fn_02231E28(CPUState* cpu) {
   L_02790488: ; // 0x2790488
         /* 02790488 */ _t32 = cpu->r[3] + 0x00000018u;
         /* 02790488 */ cpu->r[0] = rbrew_read32(cpu->mem, _t32);
-        /* 0279048C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02790490 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0279048C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02790490 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02790490 */ _t34 = _t33 & 0x00000001u;
         /* 02790490 */ if (_t34) goto L_027904A0; else goto L_02790494;
   L_02790494: ; // 0x2790494
@@ -9182,14 +9182,14 @@ void Gambit_fn_02231E28(CPUState* cpu) {
         /* 027914EC */ rbrew_write32(cpu->mem, _t41, cpu->r[0]);
         /* 027914F0 */ _t42 = cpu->r[31] + 0x0000001Cu;
         /* 027914F0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t42);
-        /* 027914F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
+        /* 027914F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
         /* 027914F8 */ cpu->r[30] = cpu->r[3];
-        /* 027914FC */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 027914FC */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 027914FC */ _t44 = _t43 & 0x00000001u;
         /* 027914FC */ if (_t44) goto L_02791508; else goto L_02791500;
   L_02791500: ; // 0x2791500
-        /* 02791500 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 02791504 */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02791500 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 02791504 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02791504 */ _t46 = _t45 & 0x00000001u;
         /* 02791504 */ if (_t46) goto L_02791508; else goto L_02791550;
   L_02791508: ; // 0x2791508
@@ -9251,9 +9251,9 @@ void Gambit_fn_02231E4C(CPUState* cpu) {
         /* 02056BC4 */ cpu->r[7] = _t2;
         /* 02056BC8 */ cpu->r[31] = 0x101E0000u;
         /* 02056BCC */ cpu->r[22] = cpu->r[3];
-        /* 02056BD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02056BD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02056BD4 */ cpu->r[31] = cpu->r[31] + 0xFFFFA4D0u;
-        /* 02056BD8 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056BD8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056BD8 */ _t4 = _t3 & 0x00000001u;
         /* 02056BD8 */ if (_t4) goto L_02056BDC; else goto L_02056C24;
   L_02056BDC: ; // 0x2056bdc
@@ -9279,8 +9279,8 @@ void Gambit_fn_02231E4C(CPUState* cpu) {
   L_02056C24: ; // 0x2056c24
         /* 02056C24 */ _t6 = cpu->r[31] + 0x00000054u;
         /* 02056C24 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 02056C28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02056C2C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056C28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02056C2C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056C2C */ _t8 = _t7 & 0x00000001u;
         /* 02056C2C */ if (_t8) goto L_02056C30; else goto L_02056D24;
   L_02056C30: ; // 0x2056c30
@@ -9296,9 +9296,9 @@ void Gambit_fn_02231E4C(CPUState* cpu) {
   L_02056C54: ; // 0x2056c54
         /* 02056C54 */ _t9 = cpu->r[24] + 0xFFFFE548u;
         /* 02056C54 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 02056C58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02056C58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02056C5C */ cpu->r[29] = cpu->r[30];
-        /* 02056C60 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056C60 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056C60 */ _t11 = _t10 & 0x00000001u;
         /* 02056C60 */ if (_t11) goto L_02056C64; else goto L_02056C7C;
   L_02056C64: ; // 0x2056c64
@@ -9312,8 +9312,8 @@ void Gambit_fn_02231E4C(CPUState* cpu) {
   L_02056C7C: ; // 0x2056c7c
         /* 02056C7C */ _t13 = cpu->r[20] + 0xFFFFE544u;
         /* 02056C7C */ cpu->r[11] = rbrew_read32(cpu->mem, _t13);
-        /* 02056C80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02056C84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056C80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02056C84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056C84 */ _t15 = _t14 & 0x00000001u;
         /* 02056C84 */ if (_t15) goto L_02056C88; else goto L_02056C90;
   L_02056C88: ; // 0x2056c88
@@ -9322,8 +9322,8 @@ void Gambit_fn_02231E4C(CPUState* cpu) {
         /* 02056C8C */ _t17 = cpu->r[20] + 0xFFFFE544u;
         /* 02056C8C */ rbrew_write32(cpu->mem, _t17, cpu->r[21]);
   L_02056C90: ; // 0x2056c90
-        /* 02056C90 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], 0x00000002u);
-        /* 02056C94 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02056C90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], 0x00000002u));
+        /* 02056C94 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02056C94 */ _t19 = _t18 & 0x00000001u;
         /* 02056C94 */ if (_t19) goto L_02056CBC; else goto L_02056C98;
   L_02056C98: ; // 0x2056c98
@@ -9332,12 +9332,12 @@ void Gambit_fn_02231E4C(CPUState* cpu) {
         /* 02056CA0 */ cpu->r[5] = 0x00000000u;
         /* 02056CA4 */ Gambit_fn_028A6634(cpu);
         /* 02056CA8 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02056CAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000002u);
-        /* 02056CB0 */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02056CAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000002u));
+        /* 02056CB0 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02056CB0 */ _t21 = _t20 & 0x00000001u;
         /* 02056CB0 */ if (_t21) goto L_02056D24; else goto L_02056CB4;
   L_02056CB4: ; // 0x2056cb4
-        /* 02056CB4 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02056CB4 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02056CB4 */ _t23 = _t22 & 0x00000001u;
         /* 02056CB4 */ if (_t23) goto L_02056C54; else goto L_02056CB8;
   L_02056CB8: ; // 0x2056cb8
@@ -9345,8 +9345,8 @@ void Gambit_fn_02231E4C(CPUState* cpu) {
   L_02056CBC: ; // 0x2056cbc
         /* 02056CBC */ _t24 = cpu->r[19] + 0xFFFFE540u;
         /* 02056CBC */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
-        /* 02056CC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02056CC4 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056CC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02056CC4 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056CC4 */ _t26 = _t25 & 0x00000001u;
         /* 02056CC4 */ if (_t26) goto L_02056CC8; else goto L_02056D00;
   L_02056CC8: ; // 0x2056cc8
@@ -9355,8 +9355,8 @@ void Gambit_fn_02231E4C(CPUState* cpu) {
         /* 02056CD0 */ Gambit_fn_02836FFC(cpu);
         /* 02056CD4 */ _t27 = cpu->r[19] + 0xFFFFE540u;
         /* 02056CD4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t27);
-        /* 02056CD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02056CDC */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056CD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02056CDC */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056CDC */ _t29 = _t28 & 0x00000001u;
         /* 02056CDC */ if (_t29) goto L_02056CE0; else goto L_02056CF4;
   L_02056CE0: ; // 0x2056ce0
@@ -9379,12 +9379,12 @@ void Gambit_fn_02231E4C(CPUState* cpu) {
         /* 02056D0C */ cpu->r[4] = cpu->r[30];
         /* 02056D10 */ Gambit_fn_028A6634(cpu);
         /* 02056D14 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02056D18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000002u);
-        /* 02056D1C */ _t33 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02056D18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000002u));
+        /* 02056D1C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02056D1C */ _t34 = _t33 & 0x00000001u;
         /* 02056D1C */ if (_t34) goto L_02056D24; else goto L_02056D20;
   L_02056D20: ; // 0x2056d20
-        /* 02056D20 */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02056D20 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02056D20 */ _t36 = _t35 & 0x00000001u;
         /* 02056D20 */ if (_t36) goto L_02056C54; else goto L_02056D24;
   L_02056D24: ; // 0x2056d24
@@ -9429,23 +9429,23 @@ void Gambit_fn_02231E58(CPUState* cpu) {
         /* 02231E7C */ cpu->r[12] = rbrew_read32(cpu->mem, _t5);
         /* 02231E80 */ _t6 = cpu->r[31] + 0x0000002Cu;
         /* 02231E80 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 02231E84 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 02231E88 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231E84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 02231E88 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231E88 */ _t8 = _t7 & 0x00000001u;
         /* 02231E88 */ if (_t8) goto L_02231ED4; else goto L_02231E8C;
   L_02231E8C: ; // 0x2231e8c
         /* 02231E8C */ _t9 = cpu->r[31] + 0x00000090u;
         /* 02231E8C */ cpu->r[0] = rbrew_read8(cpu->mem, _t9);
         /* 02231E90 */ /* nop */
-        /* 02231E94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 02231E98 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231E94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 02231E98 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231E98 */ _t11 = _t10 & 0x00000001u;
         /* 02231E98 */ if (_t11) goto L_02231E9C; else goto L_02231ECC;
   L_02231E9C: ; // 0x2231e9c
         /* 02231E9C */ _t12 = cpu->r[31] + 0x00000080u;
         /* 02231E9C */ cpu->r[10] = rbrew_read32(cpu->mem, _t12);
-        /* 02231EA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02231EA4 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231EA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02231EA4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231EA4 */ _t14 = _t13 & 0x00000001u;
         /* 02231EA4 */ if (_t14) goto L_02231ED4; else goto L_02231EA8;
   L_02231EA8: ; // 0x2231ea8
@@ -9497,23 +9497,23 @@ void Gambit_fn_02231E5C(CPUState* cpu) {
         /* 02231E7C */ cpu->r[12] = rbrew_read32(cpu->mem, _t5);
         /* 02231E80 */ _t6 = cpu->r[31] + 0x0000002Cu;
         /* 02231E80 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 02231E84 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
-        /* 02231E88 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231E84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
+        /* 02231E88 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231E88 */ _t8 = _t7 & 0x00000001u;
         /* 02231E88 */ if (_t8) goto L_02231ED4; else goto L_02231E8C;
   L_02231E8C: ; // 0x2231e8c
         /* 02231E8C */ _t9 = cpu->r[31] + 0x00000090u;
         /* 02231E8C */ cpu->r[0] = rbrew_read8(cpu->mem, _t9);
         /* 02231E90 */ /* nop */
-        /* 02231E94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 02231E98 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231E94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 02231E98 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231E98 */ _t11 = _t10 & 0x00000001u;
         /* 02231E98 */ if (_t11) goto L_02231E9C; else goto L_02231ECC;
   L_02231E9C: ; // 0x2231e9c
         /* 02231E9C */ _t12 = cpu->r[31] + 0x00000080u;
         /* 02231E9C */ cpu->r[10] = rbrew_read32(cpu->mem, _t12);
-        /* 02231EA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02231EA4 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231EA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02231EA4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231EA4 */ _t14 = _t13 & 0x00000001u;
         /* 02231EA4 */ if (_t14) goto L_02231ED4; else goto L_02231EA8;
   L_02231EA8: ; // 0x2231ea8
@@ -9741,8 +9741,8 @@ void Gambit_fn_02231FC8(CPUState* cpu) {
         /* 02231FD8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02231FDC */ _t3 = cpu->r[31] + 0x00000051u;
         /* 02231FDC */ cpu->r[11] = rbrew_read8(cpu->mem, _t3);
-        /* 02231FE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02231FE4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231FE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02231FE4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231FE4 */ _t5 = _t4 & 0x00000001u;
         /* 02231FE4 */ if (_t5) goto L_02232048; else goto L_02231FE8;
   L_02231FE8: ; // 0x2231fe8
@@ -9755,27 +9755,27 @@ void Gambit_fn_02231FC8(CPUState* cpu) {
         /* 02231FF4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t8);
         /* 02231FF8 */ cpu->ctr = cpu->r[10];
         /* 02231FFC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02232000 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000003u);
-        /* 02232004 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232000 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000003u));
+        /* 02232004 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232004 */ _t10 = _t9 & 0x00000001u;
         /* 02232004 */ if (_t10) goto L_02232010; else goto L_02232008;
   L_02232008: ; // 0x2232008
-        /* 02232008 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000008u);
-        /* 0223200C */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232008 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000008u));
+        /* 0223200C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223200C */ _t12 = _t11 & 0x00000001u;
         /* 0223200C */ if (_t12) goto L_02232010; else goto L_02232048;
   L_02232010: ; // 0x2232010
         /* 02232010 */ _t13 = cpu->r[31] + 0x00000090u;
         /* 02232010 */ cpu->r[0] = rbrew_read8(cpu->mem, _t13);
         /* 02232014 */ /* nop */
-        /* 02232018 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232018 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232018 */ _t15 = _t14 & 0x00000001u;
         /* 02232018 */ if (_t15) goto L_0223201C; else goto L_02232038;
   L_0223201C: ; // 0x223201c
         /* 0223201C */ _t16 = cpu->r[31] + 0x00000314u;
         /* 0223201C */ cpu->r[3] = rbrew_read32(cpu->mem, _t16);
-        /* 02232020 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02232024 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232020 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02232024 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232024 */ _t18 = _t17 & 0x00000001u;
         /* 02232024 */ if (_t18) goto L_02232048; else goto L_02232028;
   L_02232028: ; // 0x2232028
@@ -9784,8 +9784,8 @@ void Gambit_fn_02231FC8(CPUState* cpu) {
         /* 02232030 */ Gambit_fn_021BEFA0(cpu);
         /* 02232034 */ goto L_02232050;
   L_02232038: ; // 0x2232038
-        /* 02232038 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 0223203C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232038 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 0223203C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223203C */ _t20 = _t19 & 0x00000001u;
         /* 0223203C */ if (_t20) goto L_02232040; else goto L_02232048;
   L_02232040: ; // 0x2232040
@@ -9819,8 +9819,8 @@ void Gambit_fn_02231FCC(CPUState* cpu) {
         /* 02231FD8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02231FDC */ _t3 = cpu->r[31] + 0x00000051u;
         /* 02231FDC */ cpu->r[11] = rbrew_read8(cpu->mem, _t3);
-        /* 02231FE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02231FE4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02231FE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02231FE4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02231FE4 */ _t5 = _t4 & 0x00000001u;
         /* 02231FE4 */ if (_t5) goto L_02232048; else goto L_02231FE8;
   L_02231FE8: ; // 0x2231fe8
@@ -9833,27 +9833,27 @@ void Gambit_fn_02231FCC(CPUState* cpu) {
         /* 02231FF4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t8);
         /* 02231FF8 */ cpu->ctr = cpu->r[10];
         /* 02231FFC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02232000 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000003u);
-        /* 02232004 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232000 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000003u));
+        /* 02232004 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232004 */ _t10 = _t9 & 0x00000001u;
         /* 02232004 */ if (_t10) goto L_02232010; else goto L_02232008;
   L_02232008: ; // 0x2232008
-        /* 02232008 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000008u);
-        /* 0223200C */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232008 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000008u));
+        /* 0223200C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223200C */ _t12 = _t11 & 0x00000001u;
         /* 0223200C */ if (_t12) goto L_02232010; else goto L_02232048;
   L_02232010: ; // 0x2232010
         /* 02232010 */ _t13 = cpu->r[31] + 0x00000090u;
         /* 02232010 */ cpu->r[0] = rbrew_read8(cpu->mem, _t13);
         /* 02232014 */ /* nop */
-        /* 02232018 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232018 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232018 */ _t15 = _t14 & 0x00000001u;
         /* 02232018 */ if (_t15) goto L_0223201C; else goto L_02232038;
   L_0223201C: ; // 0x223201c
         /* 0223201C */ _t16 = cpu->r[31] + 0x00000314u;
         /* 0223201C */ cpu->r[3] = rbrew_read32(cpu->mem, _t16);
-        /* 02232020 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02232024 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232020 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02232024 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232024 */ _t18 = _t17 & 0x00000001u;
         /* 02232024 */ if (_t18) goto L_02232048; else goto L_02232028;
   L_02232028: ; // 0x2232028
@@ -9862,8 +9862,8 @@ void Gambit_fn_02231FCC(CPUState* cpu) {
         /* 02232030 */ Gambit_fn_021BEFA0(cpu);
         /* 02232034 */ goto L_02232050;
   L_02232038: ; // 0x2232038
-        /* 02232038 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 0223203C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232038 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 0223203C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223203C */ _t20 = _t19 & 0x00000001u;
         /* 0223203C */ if (_t20) goto L_02232040; else goto L_02232048;
   L_02232040: ; // 0x2232040
@@ -9897,28 +9897,28 @@ void Gambit_fn_02232064(CPUState* cpu) {
         /* 02232074 */ cpu->r[30] = cpu->r[3];
         /* 02232078 */ _t2 = cpu->r[30] + 0x0000001Cu;
         /* 02232078 */ cpu->r[0] = rbrew_read32(cpu->mem, _t2);
-        /* 0223207C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02232080 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223207C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02232080 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232080 */ _t4 = _t3 & 0x00000001u;
         /* 02232080 */ if (_t4) goto L_0223208C; else goto L_02232084;
   L_02232084: ; // 0x2232084
-        /* 02232084 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 02232088 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232084 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 02232088 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232088 */ _t6 = _t5 & 0x00000001u;
         /* 02232088 */ if (_t6) goto L_0223208C; else goto L_02232360;
   L_0223208C: ; // 0x223208c
         /* 0223208C */ _t7 = cpu->r[30] + 0x00000090u;
         /* 0223208C */ cpu->r[11] = rbrew_read8(cpu->mem, _t7);
         /* 02232090 */ /* nop */
-        /* 02232094 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02232098 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232094 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02232098 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232098 */ _t9 = _t8 & 0x00000001u;
         /* 02232098 */ if (_t9) goto L_0223209C; else goto L_02232360;
   L_0223209C: ; // 0x223209c
         /* 0223209C */ _t10 = cpu->r[30] + 0x00000080u;
         /* 0223209C */ cpu->r[19] = rbrew_read32(cpu->mem, _t10);
-        /* 022320A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[19], 0x00000000u);
-        /* 022320A4 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022320A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[19], 0x00000000u));
+        /* 022320A4 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022320A4 */ _t12 = _t11 & 0x00000001u;
         /* 022320A4 */ if (_t12) goto L_02232360; else goto L_022320A8;
   L_022320A8: ; // 0x22320a8
@@ -9934,8 +9934,8 @@ void Gambit_fn_02232064(CPUState* cpu) {
         /* 022320BC */ cpu->r[28] = _t15;
         /* 022320C0 */ /* nop */
         /* 022320C4 */ cpu->r[10] = rbrew_rlwinm(cpu->r[9], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022320C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 022320C8 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022320C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 022320C8 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022320C8 */ _t17 = _t16 & 0x00000001u;
         /* 022320C8 */ if (_t17) goto L_02232360; else goto L_022320CC;
   L_022320CC: ; // 0x22320cc
@@ -9990,15 +9990,15 @@ void Gambit_fn_02232064(CPUState* cpu) {
         /* 02232150 */ cpu->r[3] = rbrew_read32(cpu->mem, _t31);
         /* 02232154 */ Gambit_fn_02031DAC(cpu);
         /* 02232158 */ cpu->r[31] = cpu->r[3];
-        /* 02232158 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0223215C */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0223215C */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223215C */ _t33 = _t32 & 0x00000001u;
         /* 0223215C */ if (_t33) goto L_02232360; else goto L_02232160;
   L_02232160: ; // 0x2232160
         /* 02232160 */ _t34 = cpu->r[27] + 0xFFFFE5E4u;
         /* 02232160 */ cpu->r[12] = rbrew_read32(cpu->mem, _t34);
-        /* 02232164 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02232168 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232164 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02232168 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232168 */ _t36 = _t35 & 0x00000001u;
         /* 02232168 */ if (_t36) goto L_0223216C; else goto L_0223217C;
   L_0223216C: ; // 0x223216c
@@ -10018,17 +10018,17 @@ void Gambit_fn_02232064(CPUState* cpu) {
         /* 0223218C */ cpu->r[17] = cpu->r[31];
         /* 02232190 */ cpu->r[3] = cpu->r[31];
         /* 02232194 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02232198 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02232198 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0223219C */ _t41 = cpu->r[26] + 0xFFFFE5ECu;
         /* 0223219C */ cpu->r[6] = rbrew_read32(cpu->mem, _t41);
-        /* 022321A0 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022321A0 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022321A0 */ _t43 = _t42 & 0x00000001u;
         /* 022321A0 */ if (_t43) goto L_022321A4; else goto L_022321A8;
   L_022321A4: ; // 0x22321a4
         /* 022321A4 */ cpu->r[17] = 0x00000000u;
   L_022321A8: ; // 0x22321a8
-        /* 022321A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 022321AC */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022321A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 022321AC */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022321AC */ _t45 = _t44 & 0x00000001u;
         /* 022321AC */ if (_t45) goto L_022321B0; else goto L_022321B8;
   L_022321B0: ; // 0x22321b0
@@ -10046,17 +10046,17 @@ void Gambit_fn_02232064(CPUState* cpu) {
         /* 022321C8 */ cpu->r[3] = cpu->r[31];
         /* 022321CC */ cpu->r[4] = cpu->r[21] + 0xFFFFFC28u;
         /* 022321D0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 022321D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 022321D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 022321D8 */ _t50 = cpu->r[25] + 0xFFFFE5E8u;
         /* 022321D8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t50);
-        /* 022321DC */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022321DC */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022321DC */ _t52 = _t51 & 0x00000001u;
         /* 022321DC */ if (_t52) goto L_022321E0; else goto L_022321E4;
   L_022321E0: ; // 0x22321e0
         /* 022321E0 */ cpu->r[18] = 0x00000000u;
   L_022321E4: ; // 0x22321e4
-        /* 022321E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 022321E8 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022321E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 022321E8 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022321E8 */ _t54 = _t53 & 0x00000001u;
         /* 022321E8 */ if (_t54) goto L_022321EC; else goto L_022321F4;
   L_022321EC: ; // 0x22321ec
@@ -10073,15 +10073,15 @@ void Gambit_fn_02232064(CPUState* cpu) {
         /* 02232200 */ cpu->r[3] = cpu->r[31];
         /* 02232204 */ cpu->r[4] = cpu->r[20] + 0xFFFFFC0Cu;
         /* 02232208 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0223220C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02232210 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223220C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02232210 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232210 */ _t60 = _t59 & 0x00000001u;
         /* 02232210 */ if (_t60) goto L_02232214; else goto L_02232218;
   L_02232214: ; // 0x2232214
         /* 02232214 */ cpu->r[31] = 0x00000000u;
   L_02232218: ; // 0x2232218
-        /* 02232218 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[17], 0x00000000u);
-        /* 0223221C */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232218 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[17], 0x00000000u));
+        /* 0223221C */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223221C */ _t62 = _t61 & 0x00000001u;
         /* 0223221C */ if (_t62) goto L_02232284; else goto L_02232220;
   L_02232220: ; // 0x2232220
@@ -10095,8 +10095,8 @@ void Gambit_fn_02232064(CPUState* cpu) {
         /* 02232234 */ cpu->r[3] = cpu->r[17];
         /* 02232238 */ cpu->r[5] = cpu->r[1] + 0x00000018u;
         /* 0223223C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02232240 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02232244 */ _t65 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232240 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02232244 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232244 */ _t66 = _t65 & 0x00000001u;
         /* 02232244 */ if (_t66) goto L_02232148; else goto L_02232248;
   L_02232248: ; // 0x2232248
@@ -10121,8 +10121,8 @@ void Gambit_fn_02232064(CPUState* cpu) {
         /* 0223227C */ cpu->r[5] = cpu->r[4];
         /* 02232280 */ rbrew_call_indirect(cpu, cpu->ctr);
   L_02232284: ; // 0x2232284
-        /* 02232284 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[18], 0x00000000u);
-        /* 02232288 */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232284 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[18], 0x00000000u));
+        /* 02232288 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232288 */ _t73 = _t72 & 0x00000001u;
         /* 02232288 */ if (_t73) goto L_022322F0; else goto L_0223228C;
   L_0223228C: ; // 0x223228c
@@ -10136,8 +10136,8 @@ void Gambit_fn_02232064(CPUState* cpu) {
         /* 022322A0 */ cpu->r[3] = cpu->r[18];
         /* 022322A4 */ cpu->r[5] = cpu->r[1] + 0x00000018u;
         /* 022322A8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 022322AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022322B0 */ _t76 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022322AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022322B0 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022322B0 */ _t77 = _t76 & 0x00000001u;
         /* 022322B0 */ if (_t77) goto L_02232148; else goto L_022322B4;
   L_022322B4: ; // 0x22322b4
@@ -10162,8 +10162,8 @@ void Gambit_fn_02232064(CPUState* cpu) {
         /* 022322E8 */ cpu->r[5] = cpu->r[4];
         /* 022322EC */ rbrew_call_indirect(cpu, cpu->ctr);
   L_022322F0: ; // 0x22322f0
-        /* 022322F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022322F4 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022322F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022322F4 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022322F4 */ _t84 = _t83 & 0x00000001u;
         /* 022322F4 */ if (_t84) goto L_02232148; else goto L_022322F8;
   L_022322F8: ; // 0x22322f8
@@ -10177,8 +10177,8 @@ void Gambit_fn_02232064(CPUState* cpu) {
         /* 0223230C */ cpu->r[3] = cpu->r[31];
         /* 02232310 */ cpu->r[5] = cpu->r[1] + 0x00000018u;
         /* 02232314 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02232318 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223231C */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232318 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223231C */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223231C */ _t88 = _t87 & 0x00000001u;
         /* 0223231C */ if (_t88) goto L_02232148; else goto L_02232320;
   L_02232320: ; // 0x2232320
@@ -10227,8 +10227,8 @@ void Gambit_fn_02232374(CPUState* cpu) {
         /* 02232384 */ cpu->r[31] = cpu->r[3];
         /* 02232388 */ _t2 = cpu->r[31] + 0x00000310u;
         /* 02232388 */ cpu->r[9] = rbrew_read8(cpu->mem, _t2);
-        /* 0223238C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000020u);
-        /* 02232390 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223238C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000020u));
+        /* 02232390 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02232390 */ _t4 = _t3 & 0x00000001u;
         /* 02232390 */ if (_t4) goto L_02232394; else goto L_022325B0;
   L_02232394: ; // 0x2232394
@@ -10297,10 +10297,10 @@ void Gambit_fn_02232374(CPUState* cpu) {
         /* 02232438 */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
         /* 0223243C */ Gambit_fn_0204A864(cpu);
         /* 02232440 */ cpu->r[7] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02232440 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02232440 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02232444 */ _t26 = cpu->r[31] + 0x00000148u;
         /* 02232444 */ rbrew_write32(cpu->mem, _t26, cpu->r[3]);
-        /* 02232448 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232448 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232448 */ _t28 = _t27 & 0x00000001u;
         /* 02232448 */ if (_t28) goto L_022325B0; else goto L_0223244C;
   L_0223244C: ; // 0x223244c
@@ -10313,10 +10313,10 @@ void Gambit_fn_02232374(CPUState* cpu) {
         /* 0223245C */ _t31 = cpu->r[10] + 0xFFFF9484u;
         /* 0223245C */ cpu->r[27] = rbrew_read32(cpu->mem, _t31);
         /* 02232460 */ cpu->r[26] = 0x00000000u;
-        /* 02232464 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02232464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02232468 */ _t32 = cpu->r[1] + 0x0000000Cu;
         /* 02232468 */ rbrew_write32(cpu->mem, _t32, cpu->r[26]);
-        /* 0223246C */ _t33 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223246C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223246C */ _t34 = _t33 & 0x00000001u;
         /* 0223246C */ if (_t34) goto L_02232470; else goto L_022325B0;
   L_02232470: ; // 0x2232470
@@ -10335,10 +10335,10 @@ void Gambit_fn_02232374(CPUState* cpu) {
         /* 0223249C */ Gambit_fn_02040F70(cpu);
         /* 022324A0 */ _t35 = cpu->r[1] + 0x0000000Cu;
         /* 022324A0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t35);
-        /* 022324A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 022324A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 022324A8 */ _t36 = cpu->r[31] + 0x00000310u;
         /* 022324A8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t36);
-        /* 022324AC */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022324AC */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022324AC */ _t38 = _t37 & 0x00000001u;
         /* 022324AC */ if (_t38) goto L_022324B0; else goto L_022324BC;
   L_022324B0: ; // 0x22324b0
@@ -10349,9 +10349,9 @@ void Gambit_fn_02232374(CPUState* cpu) {
         /* 022324B8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t40);
   L_022324BC: ; // 0x22324bc
         /* 022324BC */ cpu->r[7] = cpu->r[0];
-        /* 022324BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 022324BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 022324C0 */ cpu->r[3] = 0x00000000u;
-        /* 022324C4 */ _t41 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022324C4 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022324C4 */ _t42 = _t41 & 0x00000001u;
         /* 022324C4 */ if (_t42) goto L_022324C8; else goto L_02232534;
   L_022324C8: ; // 0x22324c8
@@ -10360,8 +10360,8 @@ void Gambit_fn_02232374(CPUState* cpu) {
         /* 022324CC */ cpu->r[10] = rbrew_read8(cpu->mem, _t43);
         /* 022324D0 */ goto L_022324DC;
   L_022324D4: ; // 0x22324d4
-        /* 022324D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000020u);
-        /* 022324D8 */ _t44 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022324D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000020u));
+        /* 022324D8 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022324D8 */ _t45 = _t44 & 0x00000001u;
         /* 022324D8 */ if (_t45) goto L_022324DC; else goto L_022324E8;
   L_022324DC: ; // 0x22324dc
@@ -10373,21 +10373,21 @@ void Gambit_fn_02232374(CPUState* cpu) {
   L_022324EC: ; // 0x22324ec
         /* 022324EC */ _t46 = cpu->r[4] + 0x00000008u;
         /* 022324EC */ cpu->r[8] = rbrew_read8(cpu->mem, _t46);
-        /* 022324F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[10]);
-        /* 022324F4 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022324F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[10]));
+        /* 022324F4 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022324F4 */ _t48 = _t47 & 0x00000001u;
         /* 022324F4 */ if (_t48) goto L_022324F8; else goto L_02232520;
   L_022324F8: ; // 0x22324f8
-        /* 022324F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000020u);
-        /* 022324FC */ _t49 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022324F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000020u));
+        /* 022324FC */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022324FC */ _t50 = _t49 & 0x00000001u;
         /* 022324FC */ if (_t50) goto L_02232500; else goto L_02232514;
   L_02232500: ; // 0x2232500
         /* 02232500 */ cpu->r[6] = cpu->r[30] + cpu->r[5];
         /* 02232504 */ _t51 = cpu->r[6] + 0x00000004u;
         /* 02232504 */ cpu->r[9] = rbrew_read32(cpu->mem, _t51);
-        /* 02232508 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[11]);
-        /* 0223250C */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232508 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[11]));
+        /* 0223250C */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223250C */ _t53 = _t52 & 0x00000001u;
         /* 0223250C */ if (_t53) goto L_02232510; else goto L_02232520;
   L_02232510: ; // 0x2232510
@@ -10395,24 +10395,24 @@ void Gambit_fn_02232374(CPUState* cpu) {
   L_02232514: ; // 0x2232514
         /* 02232514 */ _t54 = cpu->r[30] + 0x00000004u;
         /* 02232514 */ cpu->r[9] = rbrew_read32(cpu->mem, _t54);
-        /* 02232518 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[11]);
-        /* 0223251C */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232518 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[11]));
+        /* 0223251C */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223251C */ _t56 = _t55 & 0x00000001u;
         /* 0223251C */ if (_t56) goto L_022325A4; else goto L_02232520;
   L_02232520: ; // 0x2232520
         /* 02232520 */ cpu->r[5] = cpu->r[5] + 0x0000000Cu;
         /* 02232524 */ cpu->r[7] = cpu->r[7] + 0xFFFFFFFFu;
-        /* 02232524 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02232524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02232528 */ cpu->r[3] = cpu->r[3] + 0x00000001u;
         /* 0223252C */ cpu->r[12] = cpu->r[12] + 0x0000000Cu;
-        /* 02232530 */ _t57 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232530 */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232530 */ _t58 = _t57 & 0x00000001u;
         /* 02232530 */ if (_t58) goto L_02232534; else goto L_022324D4;
   L_02232534: ; // 0x2232534
-        /* 02232534 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000020u);
+        /* 02232534 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000020u));
         /* 02232538 */ _t59 = cpu->r[1] + 0x00000010u;
         /* 02232538 */ cpu->r[4] = rbrew_read32(cpu->mem, _t59);
-        /* 0223253C */ _t60 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223253C */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223253C */ _t61 = _t60 & 0x00000001u;
         /* 0223253C */ if (_t61) goto L_02232540; else goto L_02232578;
   L_02232540: ; // 0x2232540
@@ -10432,10 +10432,10 @@ void Gambit_fn_02232374(CPUState* cpu) {
         /* 0223255C */ cpu->r[7] = rbrew_read8(cpu->mem, _t67);
         /* 02232560 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
         /* 02232564 */ cpu->r[0] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x00000018u, 0x0000001Fu);
-        /* 02232568 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000020u);
+        /* 02232568 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000020u));
         /* 0223256C */ _t68 = cpu->r[31] + 0x00000310u;
         /* 0223256C */ rbrew_write8(cpu->mem, _t68, (uint8_t)cpu->r[7]);
-        /* 02232570 */ _t69 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02232570 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02232570 */ _t70 = _t69 & 0x00000001u;
         /* 02232570 */ if (_t70) goto L_022325A4; else goto L_02232574;
   L_02232574: ; // 0x2232574
@@ -10455,17 +10455,17 @@ void Gambit_fn_02232374(CPUState* cpu) {
         /* 0223258C */ cpu->r[7] = rbrew_read8(cpu->mem, _t76);
         /* 02232590 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
         /* 02232594 */ cpu->r[0] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x00000018u, 0x0000001Fu);
-        /* 02232598 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000020u);
+        /* 02232598 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000020u));
         /* 0223259C */ _t77 = cpu->r[31] + 0x00000310u;
         /* 0223259C */ rbrew_write8(cpu->mem, _t77, (uint8_t)cpu->r[7]);
-        /* 022325A0 */ _t78 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022325A0 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022325A0 */ _t79 = _t78 & 0x00000001u;
         /* 022325A0 */ if (_t79) goto L_022325A4; else goto L_022325B0;
   L_022325A4: ; // 0x22325a4
         /* 022325A4 */ cpu->r[27] = cpu->r[27] + 0xFFFFFFFFu;
-        /* 022325A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 022325A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 022325A8 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 022325AC */ _t80 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022325AC */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022325AC */ _t81 = _t80 & 0x00000001u;
         /* 022325AC */ if (_t81) goto L_022325B0; else goto L_0223247C;
   L_022325B0: ; // 0x22325b0
@@ -10505,8 +10505,8 @@ void Gambit_fn_022325C4(CPUState* cpu) {
         /* 022325F4 */ cpu->r[24] = cpu->r[3];
         /* 022325F8 */ _t7 = cpu->r[24] + 0x00000134u;
         /* 022325F8 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t7);
-        /* 022325FC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[30]);
-        /* 02232600 */ _t8 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022325FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[30]));
+        /* 02232600 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02232600 */ _t9 = _t8 & 0x00000001u;
         /* 02232600 */ if (_t9) goto L_02232604; else goto L_02232C50;
   L_02232604: ; // 0x2232604
@@ -10526,8 +10526,8 @@ void Gambit_fn_022325C4(CPUState* cpu) {
         /* 02232628 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x0000001Fu, 0x00000001u, 0x0000001Fu);
         /* 0223262C */ cpu->r[10] = (uint32_t)((int32_t)cpu->r[10] * (int32_t)0x00000003u);
         /* 02232630 */ cpu->r[7] = cpu->r[3] - cpu->r[10];
-        /* 02232630 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 02232634 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232630 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 02232634 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232634 */ _t14 = _t13 & 0x00000001u;
         /* 02232634 */ if (_t14) goto L_02232638; else goto L_02232C40;
   L_02232638: ; // 0x2232638
@@ -10655,8 +10655,8 @@ void Gambit_fn_022325C4(CPUState* cpu) {
         /* 02232770 */ rbrew_write32(cpu->mem, _t56, cpu->r[0]);
         /* 02232774 */ Gambit_fn_02232374(cpu);
         /* 02232778 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 02232778 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0223277C */ _t57 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232778 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0223277C */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223277C */ _t58 = _t57 & 0x00000001u;
         /* 0223277C */ if (_t58) goto L_02232788; else goto L_02232780;
   L_02232780: ; // 0x2232780
@@ -10667,8 +10667,8 @@ void Gambit_fn_022325C4(CPUState* cpu) {
         /* 02232788 */ _t60 = cpu->r[24] + 0x00000310u;
         /* 02232788 */ cpu->r[8] = rbrew_read8(cpu->mem, _t60);
         /* 0223278C */ cpu->r[20] = 0x00000000u;
-        /* 02232790 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], cpu->r[8]);
-        /* 02232794 */ _t61 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02232790 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], cpu->r[8]));
+        /* 02232794 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02232794 */ _t62 = _t61 & 0x00000001u;
         /* 02232794 */ if (_t62) goto L_02232798; else goto L_02232C40;
   L_02232798: ; // 0x2232798
@@ -10684,8 +10684,8 @@ void Gambit_fn_022325C4(CPUState* cpu) {
         /* 022327B8 */ cpu->r[26] = 0x101C0000u;
         /* 022327BC */ cpu->r[21] = 0x00000000u;
   L_022327C0: ; // 0x22327c0
-        /* 022327C0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[20], 0x00000020u);
-        /* 022327C4 */ _t64 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022327C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[20], 0x00000020u));
+        /* 022327C4 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022327C4 */ _t65 = _t64 & 0x00000001u;
         /* 022327C4 */ if (_t65) goto L_022327C8; else goto L_022327DC;
   L_022327C8: ; // 0x22327c8
@@ -10694,8 +10694,8 @@ void Gambit_fn_022325C4(CPUState* cpu) {
         /* 022327CC */ _t67 = cpu->r[8] + 0x00000000u;
         /* 022327CC */ cpu->r[0] = rbrew_read32(cpu->mem, _t67);
         /* 022327D0 */ cpu->r[9] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 022327D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 022327D4 */ _t68 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022327D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 022327D4 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022327D4 */ _t69 = _t68 & 0x00000001u;
         /* 022327D4 */ if (_t69) goto L_022327D8; else goto L_022327EC;
   L_022327D8: ; // 0x22327d8
@@ -10706,8 +10706,8 @@ void Gambit_fn_022325C4(CPUState* cpu) {
         /* 022327E0 */ _t71 = cpu->r[8] + 0x00000000u;
         /* 022327E0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t71);
         /* 022327E4 */ cpu->r[9] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 022327E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 022327E8 */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022327E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 022327E8 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022327E8 */ _t73 = _t72 & 0x00000001u;
         /* 022327E8 */ if (_t73) goto L_02232848; else goto L_022327EC;
   L_022327EC: ; // 0x22327ec
@@ -10735,10 +10735,10 @@ void Gambit_fn_022325C4(CPUState* cpu) {
         /* 02232830 */ cpu->f[13] = fma(cpu->f[31], cpu->f[12], cpu->f[10]);
         /* 02232834 */ _t78 = cpu->r[1] + 0x00000020u;
         /* 02232834 */ rbrew_write_f32(cpu->mem, _t78, cpu->f[8]);
-        /* 02232838 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[20], 0x00000020u);
+        /* 02232838 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[20], 0x00000020u));
         /* 0223283C */ _t79 = cpu->r[1] + 0x00000024u;
         /* 0223283C */ rbrew_write_f32(cpu->mem, _t79, cpu->f[13]);
-        /* 02232840 */ _t80 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02232840 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02232840 */ _t81 = _t80 & 0x00000001u;
         /* 02232840 */ if (_t81) goto L_02232864; else goto L_02232844;
   L_02232844: ; // 0x2232844
@@ -10752,10 +10752,10 @@ void Gambit_fn_022325C4(CPUState* cpu) {
         /* 02232850 */ rbrew_write_f32(cpu->mem, _t84, cpu->f[7]);
         /* 02232854 */ _t85 = cpu->r[1] + 0x00000024u;
         /* 02232854 */ rbrew_write_f32(cpu->mem, _t85, cpu->f[31]);
-        /* 02232858 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[20], 0x00000020u);
+        /* 02232858 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[20], 0x00000020u));
         /* 0223285C */ _t86 = cpu->r[1] + 0x00000020u;
         /* 0223285C */ rbrew_write_f32(cpu->mem, _t86, cpu->f[8]);
-        /* 02232860 */ _t87 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02232860 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02232860 */ _t88 = _t87 & 0x00000001u;
         /* 02232860 */ if (_t88) goto L_02232864; else goto L_02232880;
   L_02232864: ; // 0x2232864
@@ -10765,9 +10765,9 @@ void Gambit_fn_022325C4(CPUState* cpu) {
         /* 02232868 */ cpu->r[0] = rbrew_read32(cpu->mem, _t90);
         /* 0223286C */ /* nop */
         /* 02232870 */ cpu->r[6] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 02232870 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02232870 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 02232874 */ /* nop */
-        /* 02232878 */ _t91 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232878 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232878 */ _t92 = _t91 & 0x00000001u;
         /* 02232878 */ if (_t92) goto L_0223287C; else goto L_02232898;
   L_0223287C: ; // 0x223287c
@@ -10779,9 +10779,9 @@ void Gambit_fn_022325C4(CPUState* cpu) {
         /* 02232884 */ cpu->r[0] = rbrew_read32(cpu->mem, _t94);
         /* 02232888 */ /* nop */
         /* 0223288C */ cpu->r[6] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0223288C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 0223288C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 02232890 */ /* nop */
-        /* 02232894 */ _t95 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232894 */ _t95 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232894 */ _t96 = _t95 & 0x00000001u;
         /* 02232894 */ if (_t96) goto L_02232930; else goto L_02232898;
   L_02232898: ; // 0x2232898
@@ -10831,10 +10831,10 @@ void Gambit_fn_022325C4(CPUState* cpu) {
         /* 02232918 */ cpu->f[6] = cpu->f[0] * cpu->f[9];
         /* 0223291C */ _t108 = cpu->r[1] + 0x0000002Cu;
         /* 0223291C */ rbrew_write_f32(cpu->mem, _t108, cpu->f[13]);
-        /* 02232920 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[20], 0x00000020u);
+        /* 02232920 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[20], 0x00000020u));
         /* 02232924 */ _t109 = cpu->r[1] + 0x00000030u;
         /* 02232924 */ rbrew_write_f32(cpu->mem, _t109, cpu->f[6]);
-        /* 02232928 */ _t110 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02232928 */ _t110 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02232928 */ _t111 = _t110 & 0x00000001u;
         /* 02232928 */ if (_t111) goto L_02232984; else goto L_0223292C;
   L_0223292C: ; // 0x223292c
@@ -10868,20 +10868,20 @@ void Gambit_fn_022325C4(CPUState* cpu) {
         /* 02232970 */ cpu->f[6] = cpu->f[0] * cpu->f[9];
         /* 02232974 */ _t121 = cpu->r[1] + 0x0000002Cu;
         /* 02232974 */ rbrew_write_f32(cpu->mem, _t121, cpu->f[13]);
-        /* 02232978 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[20], 0x00000020u);
+        /* 02232978 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[20], 0x00000020u));
         /* 0223297C */ _t122 = cpu->r[1] + 0x00000030u;
         /* 0223297C */ rbrew_write_f32(cpu->mem, _t122, cpu->f[6]);
-        /* 02232980 */ _t123 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02232980 */ _t123 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02232980 */ _t124 = _t123 & 0x00000001u;
         /* 02232980 */ if (_t124) goto L_02232984; else goto L_0223299C;
   L_02232984: ; // 0x2232984
         /* 02232984 */ cpu->r[8] = cpu->r[31] + cpu->r[21];
         /* 02232988 */ _t125 = cpu->r[8] + 0x00000004u;
         /* 02232988 */ cpu->r[0] = rbrew_read32(cpu->mem, _t125);
-        /* 0223298C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[20], 0x00000020u);
+        /* 0223298C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[20], 0x00000020u));
         /* 02232990 */ _t126 = cpu->r[1] + 0x0000004Cu;
         /* 02232990 */ rbrew_write32(cpu->mem, _t126, cpu->r[0]);
-        /* 02232994 */ _t127 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02232994 */ _t127 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02232994 */ _t128 = _t127 & 0x00000001u;
         /* 02232994 */ if (_t128) goto L_022329AC; else goto L_02232998;
   L_02232998: ; // 0x2232998
@@ -10889,10 +10889,10 @@ void Gambit_fn_022325C4(CPUState* cpu) {
   L_0223299C: ; // 0x223299c
         /* 0223299C */ _t129 = cpu->r[31] + 0x00000004u;
         /* 0223299C */ cpu->r[0] = rbrew_read32(cpu->mem, _t129);
-        /* 022329A0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[20], 0x00000020u);
+        /* 022329A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[20], 0x00000020u));
         /* 022329A4 */ _t130 = cpu->r[1] + 0x0000004Cu;
         /* 022329A4 */ rbrew_write32(cpu->mem, _t130, cpu->r[0]);
-        /* 022329A8 */ _t131 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022329A8 */ _t131 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022329A8 */ _t132 = _t131 & 0x00000001u;
         /* 022329A8 */ if (_t132) goto L_022329AC; else goto L_02232A28;
   L_022329AC: ; // 0x22329ac
@@ -10939,10 +10939,10 @@ void Gambit_fn_022325C4(CPUState* cpu) {
         /* 02232A10 */ Gambit_fn_023F6240(cpu);
         /* 02232A14 */ _t148 = cpu->r[28] + 0x00000000u;
         /* 02232A14 */ cpu->r[7] = rbrew_read32(cpu->mem, _t148);
-        /* 02232A18 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[20], 0x00000020u);
+        /* 02232A18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[20], 0x00000020u));
         /* 02232A1C */ _t149 = cpu->r[1] + 0x00000050u;
         /* 02232A1C */ rbrew_write32(cpu->mem, _t149, cpu->r[7]);
-        /* 02232A20 */ _t150 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02232A20 */ _t150 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02232A20 */ _t151 = _t150 & 0x00000001u;
         /* 02232A20 */ if (_t151) goto L_02232A9C; else goto L_02232A24;
   L_02232A24: ; // 0x2232a24
@@ -10990,10 +10990,10 @@ void Gambit_fn_022325C4(CPUState* cpu) {
         /* 02232A88 */ Gambit_fn_023F6240(cpu);
         /* 02232A8C */ _t167 = cpu->r[28] + 0x00000000u;
         /* 02232A8C */ cpu->r[7] = rbrew_read32(cpu->mem, _t167);
-        /* 02232A90 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[20], 0x00000020u);
+        /* 02232A90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[20], 0x00000020u));
         /* 02232A94 */ _t168 = cpu->r[1] + 0x00000050u;
         /* 02232A94 */ rbrew_write32(cpu->mem, _t168, cpu->r[7]);
-        /* 02232A98 */ _t169 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02232A98 */ _t169 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02232A98 */ _t170 = _t169 & 0x00000001u;
         /* 02232A98 */ if (_t170) goto L_02232A9C; else goto L_02232B1C;
   L_02232A9C: ; // 0x2232a9c
@@ -11043,9 +11043,9 @@ void Gambit_fn_022325C4(CPUState* cpu) {
         /* 02232B04 */ cpu->r[12] = rbrew_read32(cpu->mem, _t187);
         /* 02232B08 */ _t188 = cpu->r[10] + 0x00000078u;
         /* 02232B08 */ cpu->r[0] = rbrew_read32(cpu->mem, _t188);
-        /* 02232B0C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
+        /* 02232B0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
         /* 02232B10 */ cpu->r[3] = 0x00000000u;
-        /* 02232B14 */ _t189 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02232B14 */ _t189 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02232B14 */ _t190 = _t189 & 0x00000001u;
         /* 02232B14 */ if (_t190) goto L_02232B18; else goto L_02232BA0;
   L_02232B18: ; // 0x2232b18
@@ -11096,9 +11096,9 @@ void Gambit_fn_022325C4(CPUState* cpu) {
         /* 02232B80 */ cpu->r[12] = rbrew_read32(cpu->mem, _t207);
         /* 02232B84 */ _t208 = cpu->r[10] + 0x00000078u;
         /* 02232B84 */ cpu->r[0] = rbrew_read32(cpu->mem, _t208);
-        /* 02232B88 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
+        /* 02232B88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
         /* 02232B8C */ cpu->r[3] = 0x00000000u;
-        /* 02232B90 */ _t209 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02232B90 */ _t209 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02232B90 */ _t210 = _t209 & 0x00000001u;
         /* 02232B90 */ if (_t210) goto L_02232B94; else goto L_02232BA0;
   L_02232B94: ; // 0x2232b94
@@ -11108,17 +11108,17 @@ void Gambit_fn_022325C4(CPUState* cpu) {
         /* 02232B9C */ _t212 = cpu->r[12] + cpu->r[4];
         /* 02232B9C */ cpu->r[3] = rbrew_read32(cpu->mem, _t212);
   L_02232BA0: ; // 0x2232ba0
-        /* 02232BA0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[20], 0x00000020u);
-        /* 02232BA4 */ _t213 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02232BA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[20], 0x00000020u));
+        /* 02232BA4 */ _t213 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02232BA4 */ _t214 = _t213 & 0x00000001u;
         /* 02232BA4 */ if (_t214) goto L_02232BA8; else goto L_02232BC0;
   L_02232BA8: ; // 0x2232ba8
         /* 02232BA8 */ cpu->r[4] = cpu->r[31] + cpu->r[21];
         /* 02232BAC */ _t215 = cpu->r[4] + 0x00000008u;
         /* 02232BAC */ cpu->r[0] = rbrew_read8(cpu->mem, _t215);
-        /* 02232BB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x000000FEu);
+        /* 02232BB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x000000FEu));
         /* 02232BB4 */ cpu->r[4] = cpu->r[1] + 0x000000ACu;
-        /* 02232BB8 */ _t216 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232BB8 */ _t216 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232BB8 */ _t217 = _t216 & 0x00000001u;
         /* 02232BB8 */ if (_t217) goto L_02232BBC; else goto L_02232BD4;
   L_02232BBC: ; // 0x2232bbc
@@ -11126,9 +11126,9 @@ void Gambit_fn_022325C4(CPUState* cpu) {
   L_02232BC0: ; // 0x2232bc0
         /* 02232BC0 */ _t218 = cpu->r[31] + 0x00000008u;
         /* 02232BC0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t218);
-        /* 02232BC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x000000FEu);
+        /* 02232BC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x000000FEu));
         /* 02232BC8 */ cpu->r[4] = cpu->r[1] + 0x000000ACu;
-        /* 02232BCC */ _t219 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232BCC */ _t219 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232BCC */ _t220 = _t219 & 0x00000001u;
         /* 02232BCC */ if (_t220) goto L_02232BD0; else goto L_02232BD4;
   L_02232BD0: ; // 0x2232bd0
@@ -11140,13 +11140,13 @@ void Gambit_fn_022325C4(CPUState* cpu) {
         /* 02232BDC */ cpu->r[6] = rbrew_read32(cpu->mem, _t221);
         /* 02232BE0 */ _t222 = cpu->r[6] + 0x00000044u;
         /* 02232BE0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t222);
-        /* 02232BE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02232BE8 */ _t223 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232BE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02232BE8 */ _t223 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232BE8 */ _t224 = _t223 & 0x00000001u;
         /* 02232BE8 */ if (_t224) goto L_02232C2C; else goto L_02232BEC;
   L_02232BEC: ; // 0x2232bec
-        /* 02232BEC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[20], 0x00000020u);
-        /* 02232BF0 */ _t225 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02232BEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[20], 0x00000020u));
+        /* 02232BF0 */ _t225 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02232BF0 */ _t226 = _t225 & 0x00000001u;
         /* 02232BF0 */ if (_t226) goto L_02232BF4; else goto L_02232C10;
   L_02232BF4: ; // 0x2232bf4
@@ -11154,10 +11154,10 @@ void Gambit_fn_022325C4(CPUState* cpu) {
         /* 02232BF8 */ _t227 = cpu->r[5] + 0x00000008u;
         /* 02232BF8 */ cpu->r[9] = rbrew_read8(cpu->mem, _t227);
         /* 02232BFC */ cpu->r[4] = cpu->r[1] + 0x000000ACu;
-        /* 02232C00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x000000FEu);
+        /* 02232C00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x000000FEu));
         /* 02232C04 */ _t228 = cpu->r[30] + 0x000060F4u;
         /* 02232C04 */ cpu->r[3] = rbrew_read32(cpu->mem, _t228);
-        /* 02232C08 */ _t229 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232C08 */ _t229 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232C08 */ _t230 = _t229 & 0x00000001u;
         /* 02232C08 */ if (_t230) goto L_02232C0C; else goto L_02232C28;
   L_02232C0C: ; // 0x2232c0c
@@ -11166,10 +11166,10 @@ void Gambit_fn_022325C4(CPUState* cpu) {
         /* 02232C10 */ _t231 = cpu->r[31] + 0x00000008u;
         /* 02232C10 */ cpu->r[9] = rbrew_read8(cpu->mem, _t231);
         /* 02232C14 */ cpu->r[4] = cpu->r[1] + 0x000000ACu;
-        /* 02232C18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x000000FEu);
+        /* 02232C18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x000000FEu));
         /* 02232C1C */ _t232 = cpu->r[30] + 0x000060F4u;
         /* 02232C1C */ cpu->r[3] = rbrew_read32(cpu->mem, _t232);
-        /* 02232C20 */ _t233 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232C20 */ _t233 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232C20 */ _t234 = _t233 & 0x00000001u;
         /* 02232C20 */ if (_t234) goto L_02232C24; else goto L_02232C28;
   L_02232C24: ; // 0x2232c24
@@ -11180,9 +11180,9 @@ void Gambit_fn_022325C4(CPUState* cpu) {
         /* 02232C2C */ _t235 = cpu->r[24] + 0x00000310u;
         /* 02232C2C */ cpu->r[0] = rbrew_read8(cpu->mem, _t235);
         /* 02232C30 */ cpu->r[20] = cpu->r[20] + 0x00000001u;
-        /* 02232C34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], cpu->r[0]);
+        /* 02232C34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], cpu->r[0]));
         /* 02232C38 */ cpu->r[21] = cpu->r[21] + 0x0000000Cu;
-        /* 02232C3C */ _t236 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02232C3C */ _t236 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02232C3C */ _t237 = _t236 & 0x00000001u;
         /* 02232C3C */ if (_t237) goto L_022327C0; else goto L_02232C40;
   L_02232C40: ; // 0x2232c40
@@ -11202,7 +11202,7 @@ void Gambit_fn_022325C4(CPUState* cpu) {
         /* 02232C5C */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t242);
         /* 02232C60 */ _t243 = cpu->r[1] + 0x00000168u;
         /* 02232C60 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t243);
-        /* 02232C64 */ _t244 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02232C64 */ _t244 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02232C64 */ _t245 = _t244 & 0x00000001u;
         /* 02232C64 */ if (_t245) goto L_02232C68; // else: addr-0 trap, fall-through
   L_02232C68: ; // 0x2232c68
@@ -11229,21 +11229,21 @@ void Gambit_fn_02232C78(CPUState* cpu) {
         /* 02232C88 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02232C8C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02232C8C */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
-        /* 02232C90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000002u);
-        /* 02232C94 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232C90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000002u));
+        /* 02232C94 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232C94 */ _t5 = _t4 & 0x00000001u;
         /* 02232C94 */ if (_t5) goto L_02232CA0; else goto L_02232C98;
   L_02232C98: ; // 0x2232c98
-        /* 02232C98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000003u);
-        /* 02232C9C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232C98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000003u));
+        /* 02232C9C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232C9C */ _t7 = _t6 & 0x00000001u;
         /* 02232C9C */ if (_t7) goto L_02232CA0; else goto L_02232CCC;
   L_02232CA0: ; // 0x2232ca0
         /* 02232CA0 */ _t8 = cpu->r[31] + 0x00000090u;
         /* 02232CA0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t8);
         /* 02232CA4 */ /* nop */
-        /* 02232CA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02232CAC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232CA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02232CAC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232CAC */ _t10 = _t9 & 0x00000001u;
         /* 02232CAC */ if (_t10) goto L_02232CCC; else goto L_02232CB0;
   L_02232CB0: ; // 0x2232cb0
@@ -11251,8 +11251,8 @@ void Gambit_fn_02232C78(CPUState* cpu) {
         /* 02232CB4 */ Gambit_fn_021BF004(cpu);
         /* 02232CB8 */ _t11 = cpu->r[31] + 0x00000051u;
         /* 02232CB8 */ cpu->r[11] = rbrew_read8(cpu->mem, _t11);
-        /* 02232CBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02232CC0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232CBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02232CC0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232CC0 */ _t13 = _t12 & 0x00000001u;
         /* 02232CC0 */ if (_t13) goto L_02232CCC; else goto L_02232CC4;
   L_02232CC4: ; // 0x2232cc4
@@ -11283,21 +11283,21 @@ void Gambit_fn_02232C7C(CPUState* cpu) {
         /* 02232C88 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02232C8C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02232C8C */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
-        /* 02232C90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000002u);
-        /* 02232C94 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232C90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000002u));
+        /* 02232C94 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232C94 */ _t5 = _t4 & 0x00000001u;
         /* 02232C94 */ if (_t5) goto L_02232CA0; else goto L_02232C98;
   L_02232C98: ; // 0x2232c98
-        /* 02232C98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000003u);
-        /* 02232C9C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232C98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000003u));
+        /* 02232C9C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232C9C */ _t7 = _t6 & 0x00000001u;
         /* 02232C9C */ if (_t7) goto L_02232CA0; else goto L_02232CCC;
   L_02232CA0: ; // 0x2232ca0
         /* 02232CA0 */ _t8 = cpu->r[31] + 0x00000090u;
         /* 02232CA0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t8);
         /* 02232CA4 */ /* nop */
-        /* 02232CA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02232CAC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232CA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02232CAC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232CAC */ _t10 = _t9 & 0x00000001u;
         /* 02232CAC */ if (_t10) goto L_02232CCC; else goto L_02232CB0;
   L_02232CB0: ; // 0x2232cb0
@@ -11305,8 +11305,8 @@ void Gambit_fn_02232C7C(CPUState* cpu) {
         /* 02232CB4 */ Gambit_fn_021BF004(cpu);
         /* 02232CB8 */ _t11 = cpu->r[31] + 0x00000051u;
         /* 02232CB8 */ cpu->r[11] = rbrew_read8(cpu->mem, _t11);
-        /* 02232CBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02232CC0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232CBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02232CC0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232CC0 */ _t13 = _t12 & 0x00000001u;
         /* 02232CC0 */ if (_t13) goto L_02232CCC; else goto L_02232CC4;
   L_02232CC4: ; // 0x2232cc4
@@ -11338,8 +11338,8 @@ void Gambit_fn_02232CE0(CPUState* cpu) {
         /* 02232CF0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02232CF4 */ _t3 = cpu->r[31] + 0x00000080u;
         /* 02232CF4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
-        /* 02232CF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02232CFC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232CF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02232CFC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232CFC */ _t5 = _t4 & 0x00000001u;
         /* 02232CFC */ if (_t5) goto L_02232D10; else goto L_02232D00;
   L_02232D00: ; // 0x2232d00
@@ -11351,8 +11351,8 @@ void Gambit_fn_02232CE0(CPUState* cpu) {
   L_02232D10: ; // 0x2232d10
         /* 02232D10 */ _t7 = cpu->r[31] + 0x00000039u;
         /* 02232D10 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
-        /* 02232D14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02232D18 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232D14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02232D18 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232D18 */ _t9 = _t8 & 0x00000001u;
         /* 02232D18 */ if (_t9) goto L_02232D1C; else goto L_02232D24;
   L_02232D1C: ; // 0x2232d1c
@@ -11384,8 +11384,8 @@ void Gambit_fn_02232CE4(CPUState* cpu) {
         /* 02232CF0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02232CF4 */ _t3 = cpu->r[31] + 0x00000080u;
         /* 02232CF4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
-        /* 02232CF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02232CFC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232CF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02232CFC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232CFC */ _t5 = _t4 & 0x00000001u;
         /* 02232CFC */ if (_t5) goto L_02232D10; else goto L_02232D00;
   L_02232D00: ; // 0x2232d00
@@ -11397,8 +11397,8 @@ void Gambit_fn_02232CE4(CPUState* cpu) {
   L_02232D10: ; // 0x2232d10
         /* 02232D10 */ _t7 = cpu->r[31] + 0x00000039u;
         /* 02232D10 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
-        /* 02232D14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02232D18 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232D14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02232D18 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232D18 */ _t9 = _t8 & 0x00000001u;
         /* 02232D18 */ if (_t9) goto L_02232D1C; else goto L_02232D24;
   L_02232D1C: ; // 0x2232d1c
@@ -11528,10 +11528,10 @@ void Gambit_fn_02232DDC(CPUState* cpu) {
         /* 02232E08 */ _t7 = cpu->r[11] + 0x0000002Cu;
         /* 02232E08 */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
         /* 02232E0C */ cpu->r[9] = 0x10050000u;
-        /* 02232E10 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
+        /* 02232E10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
         /* 02232E14 */ _t8 = cpu->r[9] + 0x00001514u;
         /* 02232E14 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t8);
-        /* 02232E18 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232E18 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232E18 */ _t10 = _t9 & 0x00000001u;
         /* 02232E18 */ if (_t10) goto L_02232EA4; else goto L_02232E1C;
   L_02232E1C: ; // 0x2232e1c
@@ -11544,8 +11544,8 @@ void Gambit_fn_02232DDC(CPUState* cpu) {
         /* 02232E2C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t12);
         /* 02232E30 */ cpu->f[10] = cpu->f[11] / cpu->f[1];
         /* 02232E34 */ cpu->f[9] = cpu->f[31] - cpu->f[10];
-        /* 02232E38 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
-        /* 02232E3C */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02232E38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
+        /* 02232E3C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02232E3C */ _t14 = _t13 & 0x00000001u;
         /* 02232E3C */ if (_t14) goto L_02232E40; else goto L_02232E68;
   L_02232E40: ; // 0x2232e40
@@ -11558,15 +11558,15 @@ void Gambit_fn_02232DDC(CPUState* cpu) {
         /* 02232E50 */ cpu->r[3] = cpu->r[4];
         /* 02232E54 */ cpu->f[30] = fma(cpu->f[12], cpu->f[0], cpu->f[13]);
         /* 02232E58 */ Gambit_fn_021BCFBC(cpu);
-        /* 02232E5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02232E60 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232E5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02232E60 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232E60 */ _t18 = _t17 & 0x00000001u;
         /* 02232E60 */ if (_t18) goto L_02232E64; else goto L_02232E98;
   L_02232E64: ; // 0x2232e64
         /* 02232E64 */ goto L_02232EA0;
   L_02232E68: ; // 0x2232e68
-        /* 02232E68 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[31]);
-        /* 02232E6C */ _t19 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02232E68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[31]));
+        /* 02232E6C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02232E6C */ _t20 = _t19 & 0x00000001u;
         /* 02232E6C */ if (_t20) goto L_02232E70; else goto L_02232E74;
   L_02232E70: ; // 0x2232e70
@@ -11581,8 +11581,8 @@ void Gambit_fn_02232DDC(CPUState* cpu) {
         /* 02232E84 */ cpu->r[3] = cpu->r[4];
         /* 02232E88 */ cpu->f[30] = fma(cpu->f[12], cpu->f[9], cpu->f[13]);
         /* 02232E8C */ Gambit_fn_021BCFBC(cpu);
-        /* 02232E90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02232E94 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232E90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02232E94 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232E94 */ _t24 = _t23 & 0x00000001u;
         /* 02232E94 */ if (_t24) goto L_02232EA0; else goto L_02232E98;
   L_02232E98: ; // 0x2232e98
@@ -11601,7 +11601,7 @@ void Gambit_fn_02232DDC(CPUState* cpu) {
         /* 02232EB0 */ _t29 = cpu->r[1] + 0x00000018u;
         /* 02232EB0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t29);
         /* 02232EB4 */ cpu->f[1] = cpu->f[0];
-        /* 02232EB8 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02232EB8 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02232EB8 */ _t31 = _t30 & 0x00000001u;
         /* 02232EB8 */ if (_t31) goto L_02232EBC; // else: addr-0 trap, fall-through
   L_02232EBC: ; // 0x2232ebc
@@ -11638,10 +11638,10 @@ void Gambit_fn_02232DE0(CPUState* cpu) {
         /* 02232E08 */ _t7 = cpu->r[11] + 0x0000002Cu;
         /* 02232E08 */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
         /* 02232E0C */ cpu->r[9] = 0x10050000u;
-        /* 02232E10 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
+        /* 02232E10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
         /* 02232E14 */ _t8 = cpu->r[9] + 0x00001514u;
         /* 02232E14 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t8);
-        /* 02232E18 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232E18 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232E18 */ _t10 = _t9 & 0x00000001u;
         /* 02232E18 */ if (_t10) goto L_02232EA4; else goto L_02232E1C;
   L_02232E1C: ; // 0x2232e1c
@@ -11654,8 +11654,8 @@ void Gambit_fn_02232DE0(CPUState* cpu) {
         /* 02232E2C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t12);
         /* 02232E30 */ cpu->f[10] = cpu->f[11] / cpu->f[1];
         /* 02232E34 */ cpu->f[9] = cpu->f[31] - cpu->f[10];
-        /* 02232E38 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
-        /* 02232E3C */ _t13 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02232E38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
+        /* 02232E3C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02232E3C */ _t14 = _t13 & 0x00000001u;
         /* 02232E3C */ if (_t14) goto L_02232E40; else goto L_02232E68;
   L_02232E40: ; // 0x2232e40
@@ -11668,15 +11668,15 @@ void Gambit_fn_02232DE0(CPUState* cpu) {
         /* 02232E50 */ cpu->r[3] = cpu->r[4];
         /* 02232E54 */ cpu->f[30] = fma(cpu->f[12], cpu->f[0], cpu->f[13]);
         /* 02232E58 */ Gambit_fn_021BCFBC(cpu);
-        /* 02232E5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02232E60 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232E5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02232E60 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232E60 */ _t18 = _t17 & 0x00000001u;
         /* 02232E60 */ if (_t18) goto L_02232E64; else goto L_02232E98;
   L_02232E64: ; // 0x2232e64
         /* 02232E64 */ goto L_02232EA0;
   L_02232E68: ; // 0x2232e68
-        /* 02232E68 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[31]);
-        /* 02232E6C */ _t19 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02232E68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[31]));
+        /* 02232E6C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02232E6C */ _t20 = _t19 & 0x00000001u;
         /* 02232E6C */ if (_t20) goto L_02232E70; else goto L_02232E74;
   L_02232E70: ; // 0x2232e70
@@ -11691,8 +11691,8 @@ void Gambit_fn_02232DE0(CPUState* cpu) {
         /* 02232E84 */ cpu->r[3] = cpu->r[4];
         /* 02232E88 */ cpu->f[30] = fma(cpu->f[12], cpu->f[9], cpu->f[13]);
         /* 02232E8C */ Gambit_fn_021BCFBC(cpu);
-        /* 02232E90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02232E94 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02232E90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02232E94 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02232E94 */ _t24 = _t23 & 0x00000001u;
         /* 02232E94 */ if (_t24) goto L_02232EA0; else goto L_02232E98;
   L_02232E98: ; // 0x2232e98
@@ -11711,7 +11711,7 @@ void Gambit_fn_02232DE0(CPUState* cpu) {
         /* 02232EB0 */ _t29 = cpu->r[1] + 0x00000018u;
         /* 02232EB0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t29);
         /* 02232EB4 */ cpu->f[1] = cpu->f[0];
-        /* 02232EB8 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02232EB8 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02232EB8 */ _t31 = _t30 & 0x00000001u;
         /* 02232EB8 */ if (_t31) goto L_02232EBC; // else: addr-0 trap, fall-through
   L_02232EBC: ; // 0x2232ebc
@@ -11738,7 +11738,7 @@ void Gambit_fn_02232ECC(CPUState* cpu) {
         /* 02232EDC */ _t4 = cpu->r[4] + 0x00000000u;
         /* 02232EDC */ rbrew_write16(cpu->mem, _t4, (uint16_t)cpu->r[0]);
         /* 02232EE0 */ cpu->r[11] = cpu->r[9] & 0x0000FEFFu;
-        /* 02232EE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02232EE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02232EE4 */ cpu->r[12] = 0x00000000u;
         /* 02232EE8 */ _t5 = cpu->r[4] + 0x00000002u;
         /* 02232EE8 */ rbrew_write16(cpu->mem, _t5, (uint16_t)cpu->r[11]);
@@ -12114,8 +12114,8 @@ void Gambit_fn_022330A4(CPUState* cpu) {
         /* 022330B4 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 022330B8 */ _t4 = cpu->r[31] + 0x00000314u;
         /* 022330B8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t4);
-        /* 022330BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 022330C0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022330BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 022330C0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022330C0 */ _t6 = _t5 & 0x00000001u;
         /* 022330C0 */ if (_t6) goto L_0223310C; else goto L_022330C4;
   L_022330C4: ; // 0x22330c4
@@ -12136,10 +12136,10 @@ void Gambit_fn_022330A4(CPUState* cpu) {
         /* 022330E8 */ rbrew_write_f32(cpu->mem, _t11, cpu->f[0]);
         /* 022330EC */ _t12 = cpu->r[30] + 0x0000024Cu;
         /* 022330EC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t12);
-        /* 022330F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 022330F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 022330F4 */ _t13 = cpu->r[31] + 0x00000140u;
         /* 022330F4 */ rbrew_write_f32(cpu->mem, _t13, cpu->f[0]);
-        /* 022330F8 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022330F8 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022330F8 */ _t15 = _t14 & 0x00000001u;
         /* 022330F8 */ if (_t15) goto L_022330FC; else goto L_02233120;
   L_022330FC: ; // 0x22330fc
@@ -12152,8 +12152,8 @@ void Gambit_fn_022330A4(CPUState* cpu) {
         /* 02233110 */ Gambit_fn_02232FE0(cpu);
         /* 02233114 */ _t16 = cpu->r[31] + 0x00000314u;
         /* 02233114 */ cpu->r[0] = rbrew_read32(cpu->mem, _t16);
-        /* 02233118 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223311C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233118 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223311C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223311C */ _t18 = _t17 & 0x00000001u;
         /* 0223311C */ if (_t18) goto L_022330FC; else goto L_02233120;
   L_02233120: ; // 0x2233120
@@ -12191,8 +12191,8 @@ void Gambit_fn_02233150(CPUState* cpu) {
         /* 02233160 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 02233164 */ _t4 = cpu->r[31] + 0x00000314u;
         /* 02233164 */ cpu->r[8] = rbrew_read32(cpu->mem, _t4);
-        /* 02233168 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 0223316C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233168 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 0223316C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223316C */ _t6 = _t5 & 0x00000001u;
         /* 0223316C */ if (_t6) goto L_02233198; else goto L_02233170;
   L_02233170: ; // 0x2233170
@@ -12231,8 +12231,8 @@ void Gambit_fn_02233150(CPUState* cpu) {
         /* 022331C4 */ _t17 = cpu->r[31] + 0x0000018Cu;
         /* 022331C4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t17);
         /* 022331C8 */ cpu->r[0] = cpu->r[10] - cpu->r[30];
-        /* 022331CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], cpu->r[0]);
-        /* 022331D0 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022331CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], cpu->r[0]));
+        /* 022331D0 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022331D0 */ _t19 = _t18 & 0x00000001u;
         /* 022331D0 */ if (_t19) goto L_022331DC; else goto L_022331D4;
   L_022331D4: ; // 0x22331d4
@@ -12241,8 +12241,8 @@ void Gambit_fn_02233150(CPUState* cpu) {
   L_022331DC: ; // 0x22331dc
         /* 022331DC */ _t20 = cpu->r[31] + 0x00000314u;
         /* 022331DC */ cpu->r[0] = rbrew_read32(cpu->mem, _t20);
-        /* 022331E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022331E4 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022331E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022331E4 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022331E4 */ _t22 = _t21 & 0x00000001u;
         /* 022331E4 */ if (_t22) goto L_02233224; else goto L_022331E8;
   L_022331E8: ; // 0x22331e8
@@ -12253,9 +12253,9 @@ void Gambit_fn_02233150(CPUState* cpu) {
         /* 022331F4 */ Gambit_fn_02C69510(cpu);
         /* 022331F8 */ _t24 = cpu->r[31] + 0x00000314u;
         /* 022331F8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t24);
-        /* 022331FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 022331FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02233200 */ cpu->r[3] = cpu->r[31];
-        /* 02233204 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233204 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233204 */ _t26 = _t25 & 0x00000001u;
         /* 02233204 */ if (_t26) goto L_02233208; else goto L_02233240;
   L_02233208: ; // 0x2233208
@@ -12275,9 +12275,9 @@ void Gambit_fn_02233150(CPUState* cpu) {
         /* 0223322C */ Gambit_fn_02C69510(cpu);
         /* 02233230 */ _t30 = cpu->r[31] + 0x00000314u;
         /* 02233230 */ cpu->r[8] = rbrew_read32(cpu->mem, _t30);
-        /* 02233234 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02233234 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02233238 */ cpu->r[3] = cpu->r[31];
-        /* 0223323C */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223323C */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223323C */ _t32 = _t31 & 0x00000001u;
         /* 0223323C */ if (_t32) goto L_02233208; else goto L_02233240;
   L_02233240: ; // 0x2233240
@@ -12323,15 +12323,15 @@ void Gambit_fn_0223327C(CPUState* cpu) {
         /* 0223328C */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 02233290 */ _t4 = cpu->r[31] + 0x0000008Cu;
         /* 02233290 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
-        /* 02233294 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02233298 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233294 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02233298 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233298 */ _t6 = _t5 & 0x00000001u;
         /* 02233298 */ if (_t6) goto L_0223329C; else goto L_022332E4;
   L_0223329C: ; // 0x223329c
         /* 0223329C */ _t7 = cpu->r[31] + 0x00000314u;
         /* 0223329C */ cpu->r[7] = rbrew_read32(cpu->mem, _t7);
-        /* 022332A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 022332A4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022332A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 022332A4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022332A4 */ _t9 = _t8 & 0x00000001u;
         /* 022332A4 */ if (_t9) goto L_022332E4; else goto L_022332A8;
   L_022332A8: ; // 0x22332a8
@@ -12352,8 +12352,8 @@ void Gambit_fn_0223327C(CPUState* cpu) {
         /* 022332D0 */ _t14 = cpu->r[31] + 0x0000018Cu;
         /* 022332D0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 022332D4 */ cpu->r[30] = cpu->r[3];
-        /* 022332D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[12]);
-        /* 022332DC */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022332D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[12]));
+        /* 022332DC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022332DC */ _t16 = _t15 & 0x00000001u;
         /* 022332DC */ if (_t16) goto L_02233324; else goto L_022332E0;
   L_022332E0: ; // 0x22332e0
@@ -12374,8 +12374,8 @@ void Gambit_fn_0223327C(CPUState* cpu) {
         /* 02233308 */ _t20 = cpu->r[31] + 0x0000018Cu;
         /* 02233308 */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
         /* 0223330C */ cpu->r[30] = cpu->r[3];
-        /* 02233310 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[12]);
-        /* 02233314 */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02233310 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[12]));
+        /* 02233314 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02233314 */ _t22 = _t21 & 0x00000001u;
         /* 02233314 */ if (_t22) goto L_02233324; else goto L_02233318;
   L_02233318: ; // 0x2233318
@@ -12385,13 +12385,13 @@ void Gambit_fn_0223327C(CPUState* cpu) {
   L_02233324: ; // 0x2233324
         /* 02233324 */ _t23 = cpu->r[31] + 0x0000001Cu;
         /* 02233324 */ cpu->r[0] = rbrew_read32(cpu->mem, _t23);
-        /* 02233328 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 0223332C */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233328 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 0223332C */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223332C */ _t25 = _t24 & 0x00000001u;
         /* 0223332C */ if (_t25) goto L_02233338; else goto L_02233330;
   L_02233330: ; // 0x2233330
-        /* 02233330 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 02233334 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233330 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 02233334 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233334 */ _t27 = _t26 & 0x00000001u;
         /* 02233334 */ if (_t27) goto L_02233338; else goto L_022334EC;
   L_02233338: ; // 0x2233338
@@ -12432,10 +12432,10 @@ void Gambit_fn_0223327C(CPUState* cpu) {
         /* 0223339C */ cpu->f[8] = fma(cpu->f[13], cpu->f[13], cpu->f[11]);
         /* 022333A0 */ _t37 = cpu->r[7] + 0x00001514u;
         /* 022333A0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t37);
-        /* 022333A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[0]);
+        /* 022333A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[0]));
         /* 022333A8 */ _t38 = cpu->r[1] + 0x00000010u;
         /* 022333A8 */ rbrew_write_f32(cpu->mem, _t38, cpu->f[13]);
-        /* 022333AC */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022333AC */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022333AC */ _t40 = _t39 & 0x00000001u;
         /* 022333AC */ if (_t40) goto L_022333B0; else goto L_022333EC;
   L_022333B0: ; // 0x22333b0
@@ -12470,8 +12470,8 @@ void Gambit_fn_0223327C(CPUState* cpu) {
         /* 02233404 */ Gambit_fn_021620C4(cpu);
         /* 02233408 */ _t47 = cpu->r[31] + 0x00000314u;
         /* 02233408 */ cpu->r[0] = rbrew_read32(cpu->mem, _t47);
-        /* 0223340C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02233410 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223340C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02233410 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233410 */ _t49 = _t48 & 0x00000001u;
         /* 02233410 */ if (_t49) goto L_02233414; else goto L_02233420;
   L_02233414: ; // 0x2233414
@@ -12492,8 +12492,8 @@ void Gambit_fn_0223327C(CPUState* cpu) {
         /* 0223343C */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 02233440 */ cpu->r[4] = cpu->r[4] + 0x00006350u;
         /* 02233444 */ Gambit_fn_021C6DD8(cpu);
-        /* 02233448 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223344C */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233448 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223344C */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223344C */ _t54 = _t53 & 0x00000001u;
         /* 0223344C */ if (_t54) goto L_02233450; else goto L_02233468;
   L_02233450: ; // 0x2233450
@@ -12620,10 +12620,10 @@ void Gambit_fn_02233508(CPUState* cpu) {
         /* 02233574 */ cpu->r[11] = 0x10050000u;
         /* 02233578 */ _t13 = cpu->r[11] + 0x00001688u;
         /* 02233578 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t13);
-        /* 0223357C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
+        /* 0223357C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
         /* 02233580 */ _t14 = cpu->r[31] + 0x00000030u;
         /* 02233580 */ cpu->r[3] = rbrew_read32(cpu->mem, _t14);
-        /* 02233584 */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02233584 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02233584 */ _t16 = _t15 & 0x00000001u;
         /* 02233584 */ if (_t16) goto L_02233588; else goto L_0223358C;
   L_02233588: ; // 0x2233588
@@ -12687,10 +12687,10 @@ void Gambit_fn_022335C0(CPUState* cpu) {
         /* 02233620 */ _t8 = cpu->r[31] + 0x00000134u;
         /* 02233620 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t8);
         /* 02233624 */ cpu->f[0] = cpu->f[0] + cpu->f[12];
-        /* 02233628 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[1]);
+        /* 02233628 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[1]));
         /* 0223362C */ _t9 = cpu->r[31] + 0x00000134u;
         /* 0223362C */ rbrew_write_f32(cpu->mem, _t9, cpu->f[0]);
-        /* 02233630 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02233630 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02233630 */ _t11 = _t10 & 0x00000001u;
         /* 02233630 */ if (_t11) goto L_02233650; else goto L_02233634;
   L_02233634: ; // 0x2233634
@@ -12706,8 +12706,8 @@ void Gambit_fn_022335C0(CPUState* cpu) {
   L_02233650: ; // 0x2233650
         /* 02233650 */ _t14 = cpu->r[31] + 0x00000080u;
         /* 02233650 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
-        /* 02233654 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02233658 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233654 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02233658 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233658 */ _t16 = _t15 & 0x00000001u;
         /* 02233658 */ if (_t16) goto L_02233684; else goto L_0223365C;
   L_0223365C: ; // 0x223365c
@@ -12979,20 +12979,20 @@ void Gambit_fn_022336A0(CPUState* cpu) {
         /* 02233898 */ cpu->r[9] = rbrew_read32(cpu->mem, _t96);
         /* 0223389C */ _t97 = cpu->r[26] + 0x0000000Cu;
         /* 0223389C */ cpu->r[0] = rbrew_read32(cpu->mem, _t97);
-        /* 022338A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u);
+        /* 022338A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u));
         /* 022338A4 */ _t98 = cpu->r[31] + 0x00000068u;
         /* 022338A4 */ rbrew_write32(cpu->mem, _t98, cpu->r[9]);
         /* 022338A8 */ cpu->r[3] = cpu->r[31] + 0x000000C0u;
         /* 022338AC */ _t99 = cpu->r[31] + 0x000000ACu;
         /* 022338AC */ rbrew_write32(cpu->mem, _t99, cpu->r[0]);
-        /* 022338B0 */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022338B0 */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022338B0 */ _t101 = _t100 & 0x00000001u;
         /* 022338B0 */ if (_t101) goto L_022338B4; else goto L_022338C4;
   L_022338B4: ; // 0x22338b4
         /* 022338B4 */ cpu->r[3] = 0x00000010u;
         /* 022338B8 */ Gambit_fn_02801A78(cpu);
-        /* 022338BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022338C0 */ _t102 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022338BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022338C0 */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022338C0 */ _t103 = _t102 & 0x00000001u;
         /* 022338C0 */ if (_t103) goto L_022338DC; else goto L_022338C4;
   L_022338C4: ; // 0x22338c4
@@ -13008,16 +13008,16 @@ void Gambit_fn_022336A0(CPUState* cpu) {
         /* 022338D8 */ _t108 = cpu->r[3] + 0x0000000Cu;
         /* 022338D8 */ rbrew_write_f32(cpu->mem, _t108, cpu->f[13]);
   L_022338DC: ; // 0x22338dc
-        /* 022338DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u);
+        /* 022338DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u));
         /* 022338E0 */ cpu->r[3] = cpu->r[31] + 0x000000D0u;
-        /* 022338E4 */ _t109 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022338E4 */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022338E4 */ _t110 = _t109 & 0x00000001u;
         /* 022338E4 */ if (_t110) goto L_022338E8; else goto L_022338F8;
   L_022338E8: ; // 0x22338e8
         /* 022338E8 */ cpu->r[3] = 0x00000010u;
         /* 022338EC */ Gambit_fn_02801A78(cpu);
-        /* 022338F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022338F4 */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022338F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022338F4 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022338F4 */ _t112 = _t111 & 0x00000001u;
         /* 022338F4 */ if (_t112) goto L_02233910; else goto L_022338F8;
   L_022338F8: ; // 0x22338f8
@@ -13073,7 +13073,7 @@ void Gambit_fn_022336A0(CPUState* cpu) {
         /* 0223395C */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t133);
         /* 02233960 */ _t134 = cpu->r[1] + 0x00000048u;
         /* 02233960 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t134);
-        /* 02233964 */ _t135 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02233964 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02233964 */ _t136 = _t135 & 0x00000001u;
         /* 02233964 */ if (_t136) goto L_02233968; // else: addr-0 trap, fall-through
   L_02233968: ; // 0x2233968
@@ -13089,15 +13089,15 @@ void Gambit_fn_02233978(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02233978: ; // 0x2233978
-        /* 02233978 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223397C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233978 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223397C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223397C */ _t1 = _t0 & 0x00000001u;
         /* 0223397C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0223397C */ goto L_02233980;
   L_02233980: ; // 0x2233980
         /* 02233980 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02233980 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02233984 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233980 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02233984 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233984 */ _t3 = _t2 & 0x00000001u;
         /* 02233984 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02233984 */ goto L_02233988;
@@ -13116,8 +13116,8 @@ void Gambit_fn_02233978(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -13131,15 +13131,15 @@ void Gambit_fn_02233978(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -13173,15 +13173,15 @@ void Gambit_fn_02233990(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02233990: ; // 0x2233990
-        /* 02233990 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02233994 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02233994 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233994 */ _t1 = _t0 & 0x00000001u;
         /* 02233994 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02233994 */ goto L_02233998;
   L_02233998: ; // 0x2233998
         /* 02233998 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02233998 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223399C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233998 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223399C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223399C */ _t3 = _t2 & 0x00000001u;
         /* 0223399C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0223399C */ goto L_022339A0;
@@ -13200,8 +13200,8 @@ void Gambit_fn_02233990(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -13215,15 +13215,15 @@ void Gambit_fn_02233990(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -13269,15 +13269,15 @@ void Gambit_fn_022339C0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_022339C0: ; // 0x22339c0
-        /* 022339C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022339C4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022339C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022339C4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022339C4 */ _t1 = _t0 & 0x00000001u;
         /* 022339C4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022339C4 */ goto L_022339C8;
   L_022339C8: ; // 0x22339c8
         /* 022339C8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022339C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022339CC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022339C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022339CC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022339CC */ _t3 = _t2 & 0x00000001u;
         /* 022339CC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022339CC */ goto L_022339D0;
@@ -13296,8 +13296,8 @@ void Gambit_fn_022339C0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -13311,15 +13311,15 @@ void Gambit_fn_022339C0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -13347,15 +13347,15 @@ void Gambit_fn_022339D4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_022339D4: ; // 0x22339d4
-        /* 022339D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022339D8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022339D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022339D8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022339D8 */ _t1 = _t0 & 0x00000001u;
         /* 022339D8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022339D8 */ goto L_022339DC;
   L_022339DC: ; // 0x22339dc
         /* 022339DC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022339DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022339E0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022339DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022339E0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022339E0 */ _t3 = _t2 & 0x00000001u;
         /* 022339E0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022339E0 */ goto L_022339E4;
@@ -13374,8 +13374,8 @@ void Gambit_fn_022339D4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -13389,15 +13389,15 @@ void Gambit_fn_022339D4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -13464,8 +13464,8 @@ void Gambit_fn_02233A00(CPUState* cpu) {
         /* 02233A00 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02233A00 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02233A04 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 02233A04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02233A08 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233A04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02233A08 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233A08 */ _t2 = _t1 & 0x00000001u;
         /* 02233A08 */ _t3 = _t2 ^ 0x00000001u;
         /* 02233A08 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -13487,8 +13487,8 @@ void Gambit_fn_02233A1C(CPUState* cpu) {
         /* 02233A1C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02233A1C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02233A20 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 02233A20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02233A24 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233A20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02233A24 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233A24 */ _t2 = _t1 & 0x00000001u;
         /* 02233A24 */ _t3 = _t2 ^ 0x00000001u;
         /* 02233A24 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -13510,8 +13510,8 @@ void Gambit_fn_02233A38(CPUState* cpu) {
         /* 02233A38 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02233A38 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02233A3C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 02233A3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02233A40 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233A3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02233A40 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233A40 */ _t2 = _t1 & 0x00000001u;
         /* 02233A40 */ _t3 = _t2 ^ 0x00000001u;
         /* 02233A40 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -13554,8 +13554,8 @@ void Gambit_fn_02233A64(CPUState* cpu) {
         /* 02233A74 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02233A78 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02233A78 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02233A7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02233A80 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233A7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02233A80 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233A80 */ _t5 = _t4 & 0x00000001u;
         /* 02233A80 */ if (_t5) goto L_02233A84; else goto L_02233AA0;
   L_02233A84: ; // 0x2233a84
@@ -13594,8 +13594,8 @@ void Gambit_fn_02233A68(CPUState* cpu) {
         /* 02233A74 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02233A78 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02233A78 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02233A7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02233A80 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233A7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02233A80 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233A80 */ _t5 = _t4 & 0x00000001u;
         /* 02233A80 */ if (_t5) goto L_02233A84; else goto L_02233AA0;
   L_02233A84: ; // 0x2233a84
@@ -13869,9 +13869,9 @@ void Gambit_fn_02233BB0(CPUState* cpu) {
         /* 02233BB4 */ _t0 = cpu->r[9] + 0xFFFFE604u;
         /* 02233BB4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t0);
         /* 02233BB8 */ cpu->r[11] = 0x101D0000u;
-        /* 02233BBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02233BBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02233BC0 */ cpu->r[11] = cpu->r[11] + 0xFFFFFF88u;
-        /* 02233BC4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233BC4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233BC4 */ _t2 = _t1 & 0x00000001u;
         /* 02233BC4 */ if (_t2) goto L_02233BC8; else goto L_02233BE0;
   L_02233BC8: ; // 0x2233bc8
@@ -13884,8 +13884,8 @@ void Gambit_fn_02233BB0(CPUState* cpu) {
         /* 02233BDC */ _t4 = cpu->r[11] + 0x00000000u;
         /* 02233BDC */ rbrew_write32(cpu->mem, _t4, cpu->r[9]);
   L_02233BE0: ; // 0x2233be0
-        /* 02233BE0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 02233BE4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233BE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 02233BE4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233BE4 */ _t6 = _t5 & 0x00000001u;
         /* 02233BE4 */ if (_t6) goto L_02233BE8; else goto L_02233BF0;
   L_02233BE8: ; // 0x2233be8
@@ -13895,10 +13895,10 @@ void Gambit_fn_02233BB0(CPUState* cpu) {
         /* 02233BF0 */ cpu->r[12] = 0x101D0000u;
         /* 02233BF4 */ _t7 = cpu->r[12] + 0xFFFFD9ECu;
         /* 02233BF4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 02233BF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02233BF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02233BFC */ cpu->r[12] = 0x101D0000u;
         /* 02233C00 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 02233C04 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233C04 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233C04 */ _t9 = _t8 & 0x00000001u;
         /* 02233C04 */ if (_t9) goto L_02233C08; else goto L_02233C20;
   L_02233C08: ; // 0x2233c08
@@ -13911,8 +13911,8 @@ void Gambit_fn_02233BB0(CPUState* cpu) {
         /* 02233C1C */ _t11 = cpu->r[12] + 0x00000000u;
         /* 02233C1C */ rbrew_write32(cpu->mem, _t11, cpu->r[11]);
   L_02233C20: ; // 0x2233c20
-        /* 02233C20 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02233C24 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233C20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02233C24 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233C24 */ _t13 = _t12 & 0x00000001u;
         /* 02233C24 */ if (_t13) goto L_02233C28; else goto L_02233C30;
   L_02233C28: ; // 0x2233c28
@@ -13924,9 +13924,9 @@ void Gambit_fn_02233BB0(CPUState* cpu) {
         /* 02233C34 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 02233C34 */ cpu->r[10] = _t14;
         /* 02233C38 */ cpu->r[11] = 0x101D0000u;
-        /* 02233C3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02233C3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02233C40 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4ECu;
-        /* 02233C44 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233C44 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233C44 */ _t16 = _t15 & 0x00000001u;
         /* 02233C44 */ if (_t16) goto L_02233C48; else goto L_02233C5C;
   L_02233C48: ; // 0x2233c48
@@ -13938,8 +13938,8 @@ void Gambit_fn_02233BB0(CPUState* cpu) {
         /* 02233C58 */ _t18 = cpu->r[11] + 0x00000000u;
         /* 02233C58 */ rbrew_write32(cpu->mem, _t18, cpu->r[9]);
   L_02233C5C: ; // 0x2233c5c
-        /* 02233C5C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 02233C60 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233C5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 02233C60 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233C60 */ _t20 = _t19 & 0x00000001u;
         /* 02233C60 */ if (_t20) goto L_02233C64; else goto L_02233C6C;
   L_02233C64: ; // 0x2233c64
@@ -13951,9 +13951,9 @@ void Gambit_fn_02233BB0(CPUState* cpu) {
         /* 02233C70 */ cpu->r[10] = rbrew_read32(cpu->mem, _t21);
         /* 02233C70 */ cpu->r[9] = _t21;
         /* 02233C74 */ cpu->r[12] = 0x101D0000u;
-        /* 02233C78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02233C78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02233C7C */ cpu->r[12] = cpu->r[12] + 0xFFFFD4E4u;
-        /* 02233C80 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233C80 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233C80 */ _t23 = _t22 & 0x00000001u;
         /* 02233C80 */ if (_t23) goto L_02233C84; else goto L_02233C98;
   L_02233C84: ; // 0x2233c84
@@ -13981,14 +13981,14 @@ void Gambit_fn_02233CB8(CPUState* cpu) {
         /* 02233CB8 */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 02233CB8 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 02233CB8 */ cpu->r[1] = _t0;
-        /* 02233CBC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233CBC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233CBC */ _t2 = _t1 & 0x00000001u;
         /* 02233CBC */ if (_t2) goto L_02233CC0; else goto L_02233CD0;
   L_02233CC0: ; // 0x2233cc0
         /* 02233CC0 */ cpu->r[3] = 0x0000000Cu;
         /* 02233CC4 */ Gambit_fn_02801A78(cpu);
-        /* 02233CC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02233CCC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233CC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02233CCC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233CCC */ _t4 = _t3 & 0x00000001u;
         /* 02233CCC */ if (_t4) goto L_02233CD8; else goto L_02233CD0;
   L_02233CD0: ; // 0x2233cd0
@@ -14101,18 +14101,18 @@ void Gambit_fn_02233D44(CPUState* cpu) {
         /* 02057400 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02057400 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02057404 */ cpu->r[12] = 0x00000000u;
-        /* 02057408 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02057408 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0205740C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0205740C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02057410 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02057410 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02057410 */ _t6 = _t5 & 0x00000001u;
         /* 02057410 */ if (_t6) goto L_02057438; else goto L_02057414;
   L_02057414: ; // 0x2057414
         /* 02057414 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02057414 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02057418 */ /* nop */
-        /* 0205741C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 02057420 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0205741C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 02057420 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02057420 */ _t9 = _t8 & 0x00000001u;
         /* 02057420 */ if (_t9) goto L_02057424; else goto L_02057438;
   L_02057424: ; // 0x2057424
@@ -14219,10 +14219,10 @@ void Gambit_fn_02233D8C(CPUState* cpu) {
         /* 02233DAC */ cpu->r[31] = 0x101D0000u;
         /* 02233DB0 */ _t3 = cpu->r[28] + 0x0000001Cu;
         /* 02233DB0 */ rbrew_write32(cpu->mem, _t3, cpu->r[4]);
-        /* 02233DB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02233DB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02233DB8 */ _t4 = cpu->r[28] + 0x0000000Fu;
         /* 02233DB8 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[27]);
-        /* 02233DBC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233DBC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233DBC */ _t6 = _t5 & 0x00000001u;
         /* 02233DBC */ if (_t6) goto L_02233E00; else goto L_02233DC0;
   L_02233DC0: ; // 0x2233dc0
@@ -14237,16 +14237,16 @@ void Gambit_fn_02233D8C(CPUState* cpu) {
         /* 02233DD4 */ cpu->r[5] = 0x00000004u;
         /* 02233DD8 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 02233DDC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02233DE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02233DE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02233DE4 */ cpu->r[0] = cpu->r[27];
-        /* 02233DE8 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02233DE8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02233DE8 */ _t11 = _t10 & 0x00000001u;
         /* 02233DE8 */ if (_t11) goto L_02233DF0; else goto L_02233DEC;
   L_02233DEC: ; // 0x2233dec
         /* 02233DEC */ cpu->r[0] = 0x00000001u;
   L_02233DF0: ; // 0x2233df0
-        /* 02233DF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02233DF4 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233DF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02233DF4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233DF4 */ _t13 = _t12 & 0x00000001u;
         /* 02233DF4 */ if (_t13) goto L_02233E00; else goto L_02233DF8;
   L_02233DF8: ; // 0x2233df8
@@ -14258,9 +14258,9 @@ void Gambit_fn_02233D8C(CPUState* cpu) {
         /* 02233E00 */ _t16 = cpu->r[28] + 0x00000020u;
         /* 02233E00 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 02233E04 */ cpu->r[0] = 0x00000000u;
-        /* 02233E08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02233E08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02233E0C */ cpu->r[12] = cpu->r[0];
-        /* 02233E10 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02233E10 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02233E10 */ _t18 = _t17 & 0x00000001u;
         /* 02233E10 */ if (_t18) goto L_02233E14; else goto L_02233E38;
   L_02233E14: ; // 0x2233e14
@@ -14285,8 +14285,8 @@ void Gambit_fn_02233D8C(CPUState* cpu) {
   L_02233E38: ; // 0x2233e38
         /* 02233E38 */ _t26 = cpu->r[28] + 0x0000000Fu;
         /* 02233E38 */ cpu->r[27] = rbrew_read8(cpu->mem, _t26);
-        /* 02233E3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 02233E40 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233E3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 02233E40 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233E40 */ _t28 = _t27 & 0x00000001u;
         /* 02233E40 */ if (_t28) goto L_02233E84; else goto L_02233E44;
   L_02233E44: ; // 0x2233e44
@@ -14301,16 +14301,16 @@ void Gambit_fn_02233D8C(CPUState* cpu) {
         /* 02233E58 */ cpu->r[5] = 0x00000004u;
         /* 02233E5C */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 02233E60 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02233E64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02233E64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02233E68 */ cpu->r[11] = cpu->r[27];
-        /* 02233E6C */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02233E6C */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02233E6C */ _t33 = _t32 & 0x00000001u;
         /* 02233E6C */ if (_t33) goto L_02233E74; else goto L_02233E70;
   L_02233E70: ; // 0x2233e70
         /* 02233E70 */ cpu->r[11] = 0x00000001u;
   L_02233E74: ; // 0x2233e74
-        /* 02233E74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02233E78 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233E74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02233E78 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233E78 */ _t35 = _t34 & 0x00000001u;
         /* 02233E78 */ if (_t35) goto L_02233E84; else goto L_02233E7C;
   L_02233E7C: ; // 0x2233e7c
@@ -14322,9 +14322,9 @@ void Gambit_fn_02233D8C(CPUState* cpu) {
         /* 02233E84 */ _t38 = cpu->r[28] + 0x00000028u;
         /* 02233E84 */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 02233E88 */ cpu->r[0] = 0x00000000u;
-        /* 02233E8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02233E8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 02233E90 */ cpu->r[12] = cpu->r[0];
-        /* 02233E94 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02233E94 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02233E94 */ _t40 = _t39 & 0x00000001u;
         /* 02233E94 */ if (_t40) goto L_02233E98; else goto L_02233EBC;
   L_02233E98: ; // 0x2233e98
@@ -14349,8 +14349,8 @@ void Gambit_fn_02233D8C(CPUState* cpu) {
   L_02233EBC: ; // 0x2233ebc
         /* 02233EBC */ _t48 = cpu->r[28] + 0x0000000Fu;
         /* 02233EBC */ cpu->r[27] = rbrew_read8(cpu->mem, _t48);
-        /* 02233EC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 02233EC4 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233EC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 02233EC4 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233EC4 */ _t50 = _t49 & 0x00000001u;
         /* 02233EC4 */ if (_t50) goto L_02233F08; else goto L_02233EC8;
   L_02233EC8: ; // 0x2233ec8
@@ -14365,16 +14365,16 @@ void Gambit_fn_02233D8C(CPUState* cpu) {
         /* 02233EDC */ cpu->r[5] = 0x00000004u;
         /* 02233EE0 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 02233EE4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02233EE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02233EE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02233EEC */ cpu->r[10] = cpu->r[27];
-        /* 02233EF0 */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02233EF0 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02233EF0 */ _t55 = _t54 & 0x00000001u;
         /* 02233EF0 */ if (_t55) goto L_02233EF8; else goto L_02233EF4;
   L_02233EF4: ; // 0x2233ef4
         /* 02233EF4 */ cpu->r[10] = 0x00000001u;
   L_02233EF8: ; // 0x2233ef8
-        /* 02233EF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02233EFC */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233EF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02233EFC */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233EFC */ _t57 = _t56 & 0x00000001u;
         /* 02233EFC */ if (_t57) goto L_02233F08; else goto L_02233F00;
   L_02233F00: ; // 0x2233f00
@@ -14386,9 +14386,9 @@ void Gambit_fn_02233D8C(CPUState* cpu) {
         /* 02233F08 */ _t60 = cpu->r[28] + 0x00000030u;
         /* 02233F08 */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
         /* 02233F0C */ cpu->r[0] = 0x00000000u;
-        /* 02233F10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02233F10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02233F14 */ cpu->r[5] = cpu->r[0];
-        /* 02233F18 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02233F18 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02233F18 */ _t62 = _t61 & 0x00000001u;
         /* 02233F18 */ if (_t62) goto L_02233F1C; else goto L_02233F40;
   L_02233F1C: ; // 0x2233f1c
@@ -14413,8 +14413,8 @@ void Gambit_fn_02233D8C(CPUState* cpu) {
   L_02233F40: ; // 0x2233f40
         /* 02233F40 */ _t70 = cpu->r[30] + 0x00000000u;
         /* 02233F40 */ cpu->r[25] = rbrew_read8(cpu->mem, _t70);
-        /* 02233F44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 02233F48 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233F44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 02233F48 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233F48 */ _t72 = _t71 & 0x00000001u;
         /* 02233F48 */ if (_t72) goto L_02234024; else goto L_02233F4C;
   L_02233F4C: ; // 0x2233f4c
@@ -14430,10 +14430,10 @@ void Gambit_fn_02233D8C(CPUState* cpu) {
         /* 02233F64 */ cpu->r[4] = (uint32_t)((int32_t)cpu->r[25] * (int32_t)0x00000024u);
         /* 02233F68 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02233F6C */ cpu->r[24] = cpu->r[3];
-        /* 02233F70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 02233F70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 02233F74 */ cpu->r[30] = cpu->r[25];
         /* 02233F78 */ cpu->r[7] = 0x00000000u;
-        /* 02233F7C */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02233F7C */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02233F7C */ _t77 = _t76 & 0x00000001u;
         /* 02233F7C */ if (_t77) goto L_02233F84; else goto L_02233F80;
   L_02233F80: ; // 0x2233f80
@@ -14446,36 +14446,36 @@ void Gambit_fn_02233D8C(CPUState* cpu) {
         /* 02233F90 */ cpu->r[23] = 0x00000018u;
   L_02233F94: ; // 0x2233f94
         /* 02233F94 */ cpu->r[27] = cpu->r[24] + cpu->r[22];
-        /* 02233F94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 02233F98 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233F94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 02233F98 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233F98 */ _t80 = _t79 & 0x00000001u;
         /* 02233F98 */ if (_t80) goto L_02234008; else goto L_02233F9C;
   L_02233F9C: ; // 0x2233f9c
         /* 02233F9C */ cpu->r[26] = cpu->r[27];
-        /* 02233F9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 02233FA0 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233F9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 02233FA0 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233FA0 */ _t82 = _t81 & 0x00000001u;
         /* 02233FA0 */ if (_t82) goto L_02233FA4; else goto L_02233FB4;
   L_02233FA4: ; // 0x2233fa4
         /* 02233FA4 */ cpu->r[3] = 0x00000024u;
         /* 02233FA8 */ Gambit_fn_02801A78(cpu);
         /* 02233FAC */ cpu->r[26] = cpu->r[3];
-        /* 02233FAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 02233FB0 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233FAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 02233FB0 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233FB0 */ _t84 = _t83 & 0x00000001u;
         /* 02233FB0 */ if (_t84) goto L_02233FFC; else goto L_02233FB4;
   L_02233FB4: ; // 0x2233fb4
         /* 02233FB4 */ cpu->r[11] = cpu->r[26];
-        /* 02233FB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02233FB8 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233FB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02233FB8 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233FB8 */ _t86 = _t85 & 0x00000001u;
         /* 02233FB8 */ if (_t86) goto L_02233FBC; else goto L_02233FCC;
   L_02233FBC: ; // 0x2233fbc
         /* 02233FBC */ cpu->r[3] = 0x0000000Cu;
         /* 02233FC0 */ Gambit_fn_02801A78(cpu);
         /* 02233FC4 */ cpu->r[11] = cpu->r[3];
-        /* 02233FC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02233FC8 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02233FC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02233FC8 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02233FC8 */ _t88 = _t87 & 0x00000001u;
         /* 02233FC8 */ if (_t88) goto L_02233FE8; else goto L_02233FCC;
   L_02233FCC: ; // 0x2233fcc
@@ -14506,14 +14506,14 @@ void Gambit_fn_02233D8C(CPUState* cpu) {
         /* 02234004 */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
   L_02234008: ; // 0x2234008
         /* 02234008 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 02234008 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02234008 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0223400C */ cpu->r[22] = cpu->r[22] + 0x00000024u;
-        /* 02234010 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02234010 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02234010 */ _t98 = _t97 & 0x00000001u;
         /* 02234010 */ if (_t98) goto L_02234014; else goto L_02233F94;
   L_02234014: ; // 0x2234014
-        /* 02234014 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 02234018 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02234014 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 02234018 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02234018 */ _t100 = _t99 & 0x00000001u;
         /* 02234018 */ if (_t100) goto L_02234024; else goto L_0223401C;
   L_0223401C: ; // 0x223401c
@@ -14543,10 +14543,10 @@ void Gambit_fn_0223403C(CPUState* cpu) {
         /* 02234040 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 02234044 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 02234044 */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 02234048 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[12]);
+        /* 02234048 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[12]));
         /* 0223404C */ _t3 = cpu->r[4] + 0x00000000u;
         /* 0223404C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 02234050 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02234050 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02234050 */ _t5 = _t4 & 0x00000001u;
         /* 02234050 */ if (_t5) goto L_02234054; else goto L_0223405C;
   L_02234054: ; // 0x2234054
@@ -14563,10 +14563,10 @@ void Gambit_fn_0223403C(CPUState* cpu) {
         /* 02234068 */ cpu->r[9] = rbrew_read8(cpu->mem, _t9);
         /* 0223406C */ _t10 = cpu->r[3] + 0x00000028u;
         /* 0223406C */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 02234070 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
+        /* 02234070 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
         /* 02234074 */ _t11 = cpu->r[3] + 0x0000002Cu;
         /* 02234074 */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
-        /* 02234078 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02234078 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02234078 */ _t13 = _t12 & 0x00000001u;
         /* 02234078 */ if (_t13) goto L_0223407C; else goto L_02234084;
   L_0223407C: ; // 0x223407c
@@ -14587,10 +14587,10 @@ void Gambit_fn_0223403C(CPUState* cpu) {
         /* 02234098 */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
         /* 0223409C */ _t20 = cpu->r[3] + 0x00000034u;
         /* 0223409C */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 022340A0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
+        /* 022340A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
         /* 022340A4 */ _t21 = cpu->r[6] + 0x00000000u;
         /* 022340A4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
-        /* 022340A8 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022340A8 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022340A8 */ _t23 = _t22 & 0x00000001u;
         /* 022340A8 */ if (_t23) goto L_022340AC; else goto L_022340B4;
   L_022340AC: ; // 0x22340ac
@@ -14622,18 +14622,18 @@ void Gambit_fn_022340C4(CPUState* cpu) {
         /* 022340D8 */ _t2 = cpu->r[1] + 0x00000058u;
         /* 022340D8 */ rbrew_write_f32(cpu->mem, _t2, cpu->f[31]);
         /* 022340DC */ cpu->r[28] = cpu->r[3];
-        /* 022340DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 022340DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 022340E0 */ _t3 = cpu->r[1] + 0x00000064u;
         /* 022340E0 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 022340E4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022340E4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022340E4 */ _t5 = _t4 & 0x00000001u;
         /* 022340E4 */ if (_t5) goto L_022340E8; else goto L_022340F8;
   L_022340E8: ; // 0x22340e8
         /* 022340E8 */ cpu->r[3] = 0x00000144u;
         /* 022340EC */ Gambit_fn_02801A78(cpu);
         /* 022340F0 */ cpu->r[28] = cpu->r[3];
-        /* 022340F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 022340F4 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022340F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 022340F4 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022340F4 */ _t7 = _t6 & 0x00000001u;
         /* 022340F4 */ if (_t7) goto L_02234584; else goto L_022340F8;
   L_022340F8: ; // 0x22340f8
@@ -14641,20 +14641,20 @@ void Gambit_fn_022340C4(CPUState* cpu) {
         /* 022340FC */ Gambit_fn_021BAF70(cpu);
         /* 02234100 */ cpu->r[10] = 0x10050000u;
         /* 02234104 */ cpu->r[31] = cpu->r[28] + 0x00000084u;
-        /* 02234104 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02234104 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02234108 */ cpu->r[10] = cpu->r[10] + 0x00001B40u;
         /* 0223410C */ cpu->r[27] = 0x00000000u;
         /* 02234110 */ _t8 = cpu->r[28] + 0x00000004u;
         /* 02234110 */ rbrew_write32(cpu->mem, _t8, cpu->r[10]);
-        /* 02234114 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02234114 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02234114 */ _t10 = _t9 & 0x00000001u;
         /* 02234114 */ if (_t10) goto L_02234118; else goto L_02234128;
   L_02234118: ; // 0x2234118
         /* 02234118 */ cpu->r[3] = 0x00000038u;
         /* 0223411C */ Gambit_fn_02801A78(cpu);
         /* 02234120 */ cpu->r[31] = cpu->r[3];
-        /* 02234120 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02234124 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02234120 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02234124 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02234124 */ _t12 = _t11 & 0x00000001u;
         /* 02234124 */ if (_t12) goto L_02234158; else goto L_02234128;
   L_02234128: ; // 0x2234128
@@ -14680,8 +14680,8 @@ void Gambit_fn_022340C4(CPUState* cpu) {
         /* 02234154 */ rbrew_write32(cpu->mem, _t20, cpu->r[27]);
   L_02234158: ; // 0x2234158
         /* 02234158 */ cpu->r[6] = cpu->r[28] + 0x000000BCu;
-        /* 02234158 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0223415C */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02234158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0223415C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223415C */ _t22 = _t21 & 0x00000001u;
         /* 0223415C */ if (_t22) goto L_02234160; else goto L_02234168;
   L_02234160: ; // 0x2234160
@@ -14689,8 +14689,8 @@ void Gambit_fn_022340C4(CPUState* cpu) {
         /* 02234164 */ Gambit_fn_02801A78(cpu);
   L_02234168: ; // 0x2234168
         /* 02234168 */ cpu->r[9] = cpu->r[28] + 0x000000ECu;
-        /* 02234168 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0223416C */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02234168 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0223416C */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223416C */ _t24 = _t23 & 0x00000001u;
         /* 0223416C */ if (_t24) goto L_02234170; else goto L_02234178;
   L_02234170: ; // 0x2234170
@@ -14699,29 +14699,29 @@ void Gambit_fn_022340C4(CPUState* cpu) {
   L_02234178: ; // 0x2234178
         /* 02234178 */ cpu->r[9] = 0x10050000u;
         /* 0223417C */ cpu->r[3] = cpu->r[28] + 0x000000F8u;
-        /* 0223417C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0223417C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02234180 */ _t25 = cpu->r[9] + 0x000019D8u;
         /* 02234180 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t25);
-        /* 02234184 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02234184 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02234184 */ _t27 = _t26 & 0x00000001u;
         /* 02234184 */ if (_t27) goto L_02234188; else goto L_02234198;
   L_02234188: ; // 0x2234188
         /* 02234188 */ cpu->r[3] = 0x0000000Cu;
         /* 0223418C */ Gambit_fn_02801A78(cpu);
-        /* 02234190 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02234194 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02234190 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02234194 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02234194 */ _t29 = _t28 & 0x00000001u;
         /* 02234194 */ if (_t29) goto L_022341BC; else goto L_02234198;
   L_02234198: ; // 0x2234198
-        /* 02234198 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223419C */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02234198 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223419C */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223419C */ _t31 = _t30 & 0x00000001u;
         /* 0223419C */ if (_t31) goto L_022341A0; else goto L_022341B0;
   L_022341A0: ; // 0x22341a0
         /* 022341A0 */ cpu->r[3] = 0x0000000Cu;
         /* 022341A4 */ Gambit_fn_02801A78(cpu);
-        /* 022341A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022341AC */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022341A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022341AC */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022341AC */ _t33 = _t32 & 0x00000001u;
         /* 022341AC */ if (_t33) goto L_022341BC; else goto L_022341B0;
   L_022341B0: ; // 0x22341b0
@@ -14733,8 +14733,8 @@ void Gambit_fn_022340C4(CPUState* cpu) {
         /* 022341B8 */ rbrew_write_f32(cpu->mem, _t36, cpu->f[31]);
   L_022341BC: ; // 0x22341bc
         /* 022341BC */ cpu->r[12] = cpu->r[28] + 0x00000104u;
-        /* 022341BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022341C0 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022341BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022341C0 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022341C0 */ _t38 = _t37 & 0x00000001u;
         /* 022341C0 */ if (_t38) goto L_022341C4; else goto L_022341CC;
   L_022341C4: ; // 0x22341c4
@@ -14742,8 +14742,8 @@ void Gambit_fn_022340C4(CPUState* cpu) {
         /* 022341C8 */ Gambit_fn_02801A78(cpu);
   L_022341CC: ; // 0x22341cc
         /* 022341CC */ cpu->r[6] = cpu->r[28] + 0x00000110u;
-        /* 022341CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 022341D0 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022341CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 022341D0 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022341D0 */ _t40 = _t39 & 0x00000001u;
         /* 022341D0 */ if (_t40) goto L_022341D4; else goto L_022341DC;
   L_022341D4: ; // 0x22341d4
@@ -14751,15 +14751,15 @@ void Gambit_fn_022340C4(CPUState* cpu) {
         /* 022341D8 */ Gambit_fn_02801A78(cpu);
   L_022341DC: ; // 0x22341dc
         /* 022341DC */ cpu->r[3] = cpu->r[28] + 0x0000011Cu;
-        /* 022341DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022341E0 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022341DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022341E0 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022341E0 */ _t42 = _t41 & 0x00000001u;
         /* 022341E0 */ if (_t42) goto L_022341E4; else goto L_022341F4;
   L_022341E4: ; // 0x22341e4
         /* 022341E4 */ cpu->r[3] = 0x00000020u;
         /* 022341E8 */ Gambit_fn_02801A78(cpu);
-        /* 022341EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022341F0 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022341EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022341F0 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022341F0 */ _t44 = _t43 & 0x00000001u;
         /* 022341F0 */ if (_t44) goto L_02234238; else goto L_022341F4;
   L_022341F4: ; // 0x22341f4
@@ -14839,23 +14839,23 @@ void Gambit_fn_022340C4(CPUState* cpu) {
         /* 022342B0 */ _t69 = cpu->r[9] + 0x00000000u;
         /* 022342B0 */ cpu->r[5] = rbrew_read8(cpu->mem, _t69);
         /* 022342B4 */ cpu->r[30] = 0x00000000u;
-        /* 022342B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[31]);
+        /* 022342B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[31]));
         /* 022342BC */ cpu->r[11] = 0x00080000u;
-        /* 022342C0 */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022342C0 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022342C0 */ _t71 = _t70 & 0x00000001u;
         /* 022342C0 */ if (_t71) goto L_022342E8; else goto L_022342C4;
   L_022342C4: ; // 0x22342c4
         /* 022342C4 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 022342C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[11]);
+        /* 022342C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[11]));
         /* 022342CC */ cpu->r[9] = cpu->r[9] + 0x00000001u;
-        /* 022342D0 */ _t72 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022342D0 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022342D0 */ _t73 = _t72 & 0x00000001u;
         /* 022342D0 */ if (_t73) goto L_022342E4; else goto L_022342D4;
   L_022342D4: ; // 0x22342d4
         /* 022342D4 */ _t74 = cpu->r[9] + 0x00000000u;
         /* 022342D4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t74);
-        /* 022342D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 022342DC */ _t75 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022342D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 022342DC */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022342DC */ _t76 = _t75 & 0x00000001u;
         /* 022342DC */ if (_t76) goto L_022342E0; else goto L_022342C4;
   L_022342E0: ; // 0x22342e0
@@ -14867,10 +14867,10 @@ void Gambit_fn_022340C4(CPUState* cpu) {
         /* 022342E8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t77);
         /* 022342EC */ _t78 = cpu->r[1] + 0x00000010u;
         /* 022342EC */ cpu->r[7] = rbrew_read32(cpu->mem, _t78);
-        /* 022342F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[5]);
+        /* 022342F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[5]));
         /* 022342F4 */ _t79 = cpu->r[7] + 0x00000014u;
         /* 022342F4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t79);
-        /* 022342F8 */ _t80 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022342F8 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022342F8 */ _t81 = _t80 & 0x00000001u;
         /* 022342F8 */ if (_t81) goto L_02234300; else goto L_022342FC;
   L_022342FC: ; // 0x22342fc
@@ -14927,10 +14927,10 @@ void Gambit_fn_022340C4(CPUState* cpu) {
         /* 02234388 */ rbrew_write32(cpu->mem, _t95, cpu->r[8]);
         /* 0223438C */ _t96 = cpu->r[28] + 0x00000098u;
         /* 0223438C */ cpu->r[10] = rbrew_read32(cpu->mem, _t96);
-        /* 02234390 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000001u);
+        /* 02234390 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000001u));
         /* 02234394 */ _t97 = cpu->r[28] + 0x0000009Cu;
         /* 02234394 */ cpu->r[29] = rbrew_read32(cpu->mem, _t97);
-        /* 02234398 */ _t98 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02234398 */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02234398 */ _t99 = _t98 & 0x00000001u;
         /* 02234398 */ if (_t99) goto L_0223439C; else goto L_022343A0;
   L_0223439C: ; // 0x223439c
@@ -14946,23 +14946,23 @@ void Gambit_fn_022340C4(CPUState* cpu) {
         /* 022343B4 */ _t102 = cpu->r[6] + 0x00000000u;
         /* 022343B4 */ cpu->r[12] = rbrew_read8(cpu->mem, _t102);
         /* 022343B8 */ cpu->r[30] = 0x00000000u;
-        /* 022343BC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[31]);
+        /* 022343BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[31]));
         /* 022343C0 */ cpu->r[7] = 0x00080000u;
-        /* 022343C4 */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022343C4 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022343C4 */ _t104 = _t103 & 0x00000001u;
         /* 022343C4 */ if (_t104) goto L_022343EC; else goto L_022343C8;
   L_022343C8: ; // 0x22343c8
         /* 022343C8 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 022343CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 022343CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 022343D0 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 022343D4 */ _t105 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022343D4 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022343D4 */ _t106 = _t105 & 0x00000001u;
         /* 022343D4 */ if (_t106) goto L_022343E8; else goto L_022343D8;
   L_022343D8: ; // 0x22343d8
         /* 022343D8 */ _t107 = cpu->r[6] + 0x00000000u;
         /* 022343D8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t107);
-        /* 022343DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 022343E0 */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022343DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 022343E0 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022343E0 */ _t109 = _t108 & 0x00000001u;
         /* 022343E0 */ if (_t109) goto L_022343E4; else goto L_022343C8;
   L_022343E4: ; // 0x22343e4
@@ -14974,10 +14974,10 @@ void Gambit_fn_022340C4(CPUState* cpu) {
         /* 022343EC */ cpu->r[7] = rbrew_read32(cpu->mem, _t110);
         /* 022343F0 */ _t111 = cpu->r[1] + 0x00000010u;
         /* 022343F0 */ cpu->r[6] = rbrew_read32(cpu->mem, _t111);
-        /* 022343F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 022343F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 022343F8 */ _t112 = cpu->r[6] + 0x00000014u;
         /* 022343F8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t112);
-        /* 022343FC */ _t113 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022343FC */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022343FC */ _t114 = _t113 & 0x00000001u;
         /* 022343FC */ if (_t114) goto L_02234404; else goto L_02234400;
   L_02234400: ; // 0x2234400
@@ -15034,10 +15034,10 @@ void Gambit_fn_022340C4(CPUState* cpu) {
         /* 0223448C */ rbrew_write32(cpu->mem, _t128, cpu->r[5]);
         /* 02234490 */ _t129 = cpu->r[28] + 0x00000098u;
         /* 02234490 */ cpu->r[6] = rbrew_read32(cpu->mem, _t129);
-        /* 02234494 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], 0x00000002u);
+        /* 02234494 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], 0x00000002u));
         /* 02234498 */ _t130 = cpu->r[28] + 0x0000009Cu;
         /* 02234498 */ cpu->r[29] = rbrew_read32(cpu->mem, _t130);
-        /* 0223449C */ _t131 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223449C */ _t131 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223449C */ _t132 = _t131 & 0x00000001u;
         /* 0223449C */ if (_t132) goto L_022344A0; else goto L_022344A4;
   L_022344A0: ; // 0x22344a0
@@ -15053,23 +15053,23 @@ void Gambit_fn_022340C4(CPUState* cpu) {
         /* 022344B8 */ _t135 = cpu->r[12] + 0x00000000u;
         /* 022344B8 */ cpu->r[8] = rbrew_read8(cpu->mem, _t135);
         /* 022344BC */ cpu->r[30] = 0x00000000u;
-        /* 022344C0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[31]);
+        /* 022344C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[31]));
         /* 022344C4 */ cpu->r[5] = 0x00080000u;
-        /* 022344C8 */ _t136 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022344C8 */ _t136 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022344C8 */ _t137 = _t136 & 0x00000001u;
         /* 022344C8 */ if (_t137) goto L_022344F0; else goto L_022344CC;
   L_022344CC: ; // 0x22344cc
         /* 022344CC */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 022344D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[5]);
+        /* 022344D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[5]));
         /* 022344D4 */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 022344D8 */ _t138 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022344D8 */ _t138 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022344D8 */ _t139 = _t138 & 0x00000001u;
         /* 022344D8 */ if (_t139) goto L_022344EC; else goto L_022344DC;
   L_022344DC: ; // 0x22344dc
         /* 022344DC */ _t140 = cpu->r[12] + 0x00000000u;
         /* 022344DC */ cpu->r[9] = rbrew_read8(cpu->mem, _t140);
-        /* 022344E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[31]);
-        /* 022344E4 */ _t141 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022344E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[31]));
+        /* 022344E4 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022344E4 */ _t142 = _t141 & 0x00000001u;
         /* 022344E4 */ if (_t142) goto L_022344E8; else goto L_022344CC;
   L_022344E8: ; // 0x22344e8
@@ -15081,10 +15081,10 @@ void Gambit_fn_022340C4(CPUState* cpu) {
         /* 022344F0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t143);
         /* 022344F4 */ _t144 = cpu->r[1] + 0x00000010u;
         /* 022344F4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t144);
-        /* 022344F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[9]);
+        /* 022344F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[9]));
         /* 022344FC */ _t145 = cpu->r[11] + 0x00000014u;
         /* 022344FC */ cpu->r[0] = rbrew_read32(cpu->mem, _t145);
-        /* 02234500 */ _t146 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02234500 */ _t146 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02234500 */ _t147 = _t146 & 0x00000001u;
         /* 02234500 */ if (_t147) goto L_02234508; else goto L_02234504;
   L_02234504: ; // 0x2234504
@@ -15140,7 +15140,7 @@ void Gambit_fn_022340C4(CPUState* cpu) {
         /* 0223458C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t160);
         /* 02234590 */ _t161 = cpu->r[1] + 0x00000050u;
         /* 02234590 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t161);
-        /* 02234594 */ _t162 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02234594 */ _t162 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02234594 */ _t163 = _t162 & 0x00000001u;
         /* 02234594 */ if (_t163) goto L_02234598; // else: addr-0 trap, fall-through
   L_02234598: ; // 0x2234598
@@ -15292,10 +15292,10 @@ void Gambit_fn_022345A8(CPUState* cpu) {
         /* 022346F4 */ _t48 = cpu->r[11] + 0x00001ACCu;
         /* 022346F4 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t48);
         /* 022346F8 */ cpu->r[7] = 0x10050000u;
-        /* 022346FC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[30]);
+        /* 022346FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[30]));
         /* 02234700 */ _t49 = cpu->r[7] + 0x000019DCu;
         /* 02234700 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t49);
-        /* 02234704 */ _t50 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02234704 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02234704 */ _t51 = _t50 & 0x00000001u;
         /* 02234704 */ if (_t51) goto L_02234708; else goto L_02234734;
   L_02234708: ; // 0x2234708
@@ -15376,10 +15376,10 @@ void Gambit_fn_022345A8(CPUState* cpu) {
         /* 022347C8 */ cpu->f[1] = rbrew_read_f32(cpu->mem, _t76);
         /* 022347CC */ cpu->f[12] = cpu->f[2] * cpu->f[2];
         /* 022347D0 */ cpu->f[11] = fma(cpu->f[1], cpu->f[1], cpu->f[12]);
-        /* 022347D4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[30]);
+        /* 022347D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[30]));
         /* 022347D8 */ _t77 = cpu->r[1] + 0x0000000Cu;
         /* 022347D8 */ rbrew_write_f32(cpu->mem, _t77, cpu->f[30]);
-        /* 022347DC */ _t78 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022347DC */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022347DC */ _t79 = _t78 & 0x00000001u;
         /* 022347DC */ if (_t79) goto L_022347E0; else goto L_02234810;
   L_022347E0: ; // 0x22347e0
@@ -15447,9 +15447,9 @@ void Gambit_fn_022345A8(CPUState* cpu) {
         /* 02234888 */ Gambit_fn_0297FC7C(cpu);
         /* 0223488C */ _t97 = cpu->r[30] + 0x0000001Cu;
         /* 0223488C */ cpu->r[7] = rbrew_read32(cpu->mem, _t97);
-        /* 02234890 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[7]);
+        /* 02234890 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[7]));
         /* 02234894 */ cpu->r[8] = 0x00000000u;
-        /* 02234898 */ _t98 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02234898 */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02234898 */ _t99 = _t98 & 0x00000001u;
         /* 02234898 */ if (_t99) goto L_0223489C; else goto L_022348A8;
   L_0223489C: ; // 0x223489c
@@ -15590,7 +15590,7 @@ void Gambit_fn_022345A8(CPUState* cpu) {
         /* 02234A1C */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t136);
         /* 02234A20 */ _t137 = cpu->r[1] + 0x000002D8u;
         /* 02234A20 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t137);
-        /* 02234A24 */ _t138 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02234A24 */ _t138 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02234A24 */ _t139 = _t138 & 0x00000001u;
         /* 02234A24 */ if (_t139) goto L_02234A28; // else: addr-0 trap, fall-through
   L_02234A28: ; // 0x2234a28
@@ -15621,8 +15621,8 @@ void Gambit_fn_02234A38(CPUState* cpu) {
         /* 02234A58 */ cpu->r[12] = 0x101D0000u;
         /* 02234A5C */ _t3 = cpu->r[12] + 0xFFFF80F4u;
         /* 02234A5C */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
-        /* 02234A60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02234A64 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02234A60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02234A64 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02234A64 */ _t5 = _t4 & 0x00000001u;
         /* 02234A64 */ if (_t5) goto L_02234A80; else goto L_02234A68;
   L_02234A68: ; // 0x2234a68
@@ -15663,8 +15663,8 @@ void Gambit_fn_02234A3C(CPUState* cpu) {
         /* 02234A58 */ cpu->r[12] = 0x101D0000u;
         /* 02234A5C */ _t3 = cpu->r[12] + 0xFFFF80F4u;
         /* 02234A5C */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
-        /* 02234A60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02234A64 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02234A60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02234A64 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02234A64 */ _t5 = _t4 & 0x00000001u;
         /* 02234A64 */ if (_t5) goto L_02234A80; else goto L_02234A68;
   L_02234A68: ; // 0x2234a68
@@ -15706,8 +15706,8 @@ void Gambit_fn_02234A94(CPUState* cpu) {
         /* 02234AB4 */ cpu->r[12] = 0x101D0000u;
         /* 02234AB8 */ _t3 = cpu->r[12] + 0xFFFF80F4u;
         /* 02234AB8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
-        /* 02234ABC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02234AC0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02234ABC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02234AC0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02234AC0 */ _t5 = _t4 & 0x00000001u;
         /* 02234AC0 */ if (_t5) goto L_02234ADC; else goto L_02234AC4;
   L_02234AC4: ; // 0x2234ac4
@@ -15748,8 +15748,8 @@ void Gambit_fn_02234A98(CPUState* cpu) {
         /* 02234AB4 */ cpu->r[12] = 0x101D0000u;
         /* 02234AB8 */ _t3 = cpu->r[12] + 0xFFFF80F4u;
         /* 02234AB8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
-        /* 02234ABC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02234AC0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02234ABC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02234AC0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02234AC0 */ _t5 = _t4 & 0x00000001u;
         /* 02234AC0 */ if (_t5) goto L_02234ADC; else goto L_02234AC4;
   L_02234AC4: ; // 0x2234ac4
@@ -15816,11 +15816,11 @@ void Gambit_fn_02234AF0(CPUState* cpu) {
         /* 02234B44 */ _t14 = cpu->r[1] + 0x000000CCu;
         /* 02234B44 */ rbrew_write32(cpu->mem, _t14, cpu->r[29]);
         /* 02234B48 */ cpu->r[30] = cpu->r[3];
-        /* 02234B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02234B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02234B50 */ _t15 = cpu->r[1] + 0x000000E0u;
         /* 02234B50 */ rbrew_write_f32(cpu->mem, _t15, cpu->f[27]);
         /* 02234B54 */ cpu->r[29] = cpu->r[6];
-        /* 02234B58 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02234B58 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02234B58 */ _t17 = _t16 & 0x00000001u;
         /* 02234B58 */ if (_t17) goto L_02234B5C; else goto L_02234BC4;
   L_02234B5C: ; // 0x2234b5c
@@ -15866,7 +15866,7 @@ void Gambit_fn_02234AF0(CPUState* cpu) {
         /* 02234BA8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t36);
         /* 02234BAC */ _t37 = cpu->r[1] + 0x000000D0u;
         /* 02234BAC */ cpu->r[30] = rbrew_read32(cpu->mem, _t37);
-        /* 02234BB0 */ _t38 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02234BB0 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02234BB0 */ _t39 = _t38 & 0x00000001u;
         /* 02234BB0 */ if (_t39) goto L_02234BB4; // else: addr-0 trap, fall-through
   L_02234BB4: ; // 0x2234bb4
@@ -15904,10 +15904,10 @@ void Gambit_fn_02234AF0(CPUState* cpu) {
         /* 02234C00 */ _t51 = cpu->r[10] + 0x000019D8u;
         /* 02234C00 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t51);
         /* 02234C04 */ cpu->r[11] = 0x10050000u;
-        /* 02234C08 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[28]);
+        /* 02234C08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[28]));
         /* 02234C0C */ _t52 = cpu->r[11] + 0x00001ACCu;
         /* 02234C0C */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t52);
-        /* 02234C10 */ _t53 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02234C10 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02234C10 */ _t54 = _t53 & 0x00000001u;
         /* 02234C10 */ if (_t54) goto L_02234C14; else goto L_02234C40;
   L_02234C14: ; // 0x2234c14
@@ -15974,8 +15974,8 @@ void Gambit_fn_02234AF0(CPUState* cpu) {
         /* 02234CA4 */ _t78 = cpu->r[1] + 0x00000090u;
         /* 02234CA4 */ rbrew_write32(cpu->mem, _t78, cpu->r[0]);
         /* 02234CA8 */ Gambit_fn_0281975C(cpu);
-        /* 02234CAC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[28]);
-        /* 02234CB0 */ _t79 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02234CAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[28]));
+        /* 02234CB0 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02234CB0 */ _t80 = _t79 & 0x00000001u;
         /* 02234CB0 */ if (_t80) goto L_02234D40; else goto L_02234CB4;
   L_02234CB4: ; // 0x2234cb4
@@ -16023,12 +16023,12 @@ void Gambit_fn_02234AF0(CPUState* cpu) {
         /* 02234D20 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t94);
         /* 02234D24 */ cpu->f[7] = cpu->f[8] + cpu->f[9];
         /* 02234D28 */ cpu->r[12] = 0x10050000u;
-        /* 02234D2C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[2], cpu->f[28]);
+        /* 02234D2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[2], cpu->f[28]));
         /* 02234D30 */ _t95 = cpu->r[12] + 0x000019E4u;
         /* 02234D30 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t95);
         /* 02234D34 */ _t96 = cpu->r[1] + 0x0000002Cu;
         /* 02234D34 */ rbrew_write_f32(cpu->mem, _t96, cpu->f[7]);
-        /* 02234D38 */ _t97 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02234D38 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02234D38 */ _t98 = _t97 & 0x00000001u;
         /* 02234D38 */ if (_t98) goto L_02234DDC; else goto L_02234D3C;
   L_02234D3C: ; // 0x2234d3c
@@ -16085,12 +16085,12 @@ void Gambit_fn_02234AF0(CPUState* cpu) {
         /* 02234DC0 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t114);
         /* 02234DC4 */ cpu->f[7] = cpu->f[8] + cpu->f[9];
         /* 02234DC8 */ cpu->r[12] = 0x10050000u;
-        /* 02234DCC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[2], cpu->f[28]);
+        /* 02234DCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[2], cpu->f[28]));
         /* 02234DD0 */ _t115 = cpu->r[12] + 0x000019E4u;
         /* 02234DD0 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t115);
         /* 02234DD4 */ _t116 = cpu->r[1] + 0x0000002Cu;
         /* 02234DD4 */ rbrew_write_f32(cpu->mem, _t116, cpu->f[7]);
-        /* 02234DD8 */ _t117 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02234DD8 */ _t117 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02234DD8 */ _t118 = _t117 & 0x00000001u;
         /* 02234DD8 */ if (_t118) goto L_02234DDC; else goto L_02234E5C;
   L_02234DDC: ; // 0x2234ddc
@@ -16130,18 +16130,18 @@ void Gambit_fn_02234AF0(CPUState* cpu) {
         /* 02234E40 */ cpu->f[8] = fma(cpu->f[9], cpu->f[9], cpu->f[11]);
         /* 02234E44 */ _t127 = cpu->r[1] + 0x00000040u;
         /* 02234E44 */ rbrew_write_f32(cpu->mem, _t127, cpu->f[12]);
-        /* 02234E48 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[28]);
+        /* 02234E48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[28]));
         /* 02234E4C */ _t128 = cpu->r[1] + 0x00000044u;
         /* 02234E4C */ rbrew_write_f32(cpu->mem, _t128, cpu->f[9]);
         /* 02234E50 */ cpu->r[12] = cpu->r[1] + 0x0000003Cu;
-        /* 02234E54 */ _t129 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02234E54 */ _t129 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02234E54 */ _t130 = _t129 & 0x00000001u;
         /* 02234E54 */ if (_t130) goto L_02234F24; else goto L_02234E58;
   L_02234E58: ; // 0x2234e58
         /* 02234E58 */ goto L_02234EE0;
   L_02234E5C: ; // 0x2234e5c
-        /* 02234E5C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[2], cpu->f[31]);
-        /* 02234E60 */ _t131 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02234E5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[2], cpu->f[31]));
+        /* 02234E60 */ _t131 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02234E60 */ _t132 = _t131 & 0x00000001u;
         /* 02234E60 */ if (_t132) goto L_02234E64; else goto L_02234E68;
   L_02234E64: ; // 0x2234e64
@@ -16182,11 +16182,11 @@ void Gambit_fn_02234AF0(CPUState* cpu) {
         /* 02234EC8 */ cpu->f[8] = fma(cpu->f[9], cpu->f[9], cpu->f[11]);
         /* 02234ECC */ _t141 = cpu->r[1] + 0x00000040u;
         /* 02234ECC */ rbrew_write_f32(cpu->mem, _t141, cpu->f[12]);
-        /* 02234ED0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[28]);
+        /* 02234ED0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[28]));
         /* 02234ED4 */ _t142 = cpu->r[1] + 0x00000044u;
         /* 02234ED4 */ rbrew_write_f32(cpu->mem, _t142, cpu->f[9]);
         /* 02234ED8 */ cpu->r[12] = cpu->r[1] + 0x0000003Cu;
-        /* 02234EDC */ _t143 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02234EDC */ _t143 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02234EDC */ _t144 = _t143 & 0x00000001u;
         /* 02234EDC */ if (_t144) goto L_02234F24; else goto L_02234EE0;
   L_02234EE0: ; // 0x2234ee0
@@ -16208,8 +16208,8 @@ void Gambit_fn_02234AF0(CPUState* cpu) {
         /* 02234F10 */ cpu->r[8] = 0x10050000u;
         /* 02234F14 */ _t148 = cpu->r[8] + 0x00001AF8u;
         /* 02234F14 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t148);
-        /* 02234F18 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[10]);
-        /* 02234F1C */ _t149 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02234F18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[10]));
+        /* 02234F1C */ _t149 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02234F1C */ _t150 = _t149 & 0x00000001u;
         /* 02234F1C */ if (_t150) goto L_02234FEC; else goto L_02234F20;
   L_02234F20: ; // 0x2234f20
@@ -16245,8 +16245,8 @@ void Gambit_fn_02234AF0(CPUState* cpu) {
         /* 02234F78 */ cpu->r[8] = 0x10050000u;
         /* 02234F7C */ _t157 = cpu->r[8] + 0x00001AF8u;
         /* 02234F7C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t157);
-        /* 02234F80 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[10]);
-        /* 02234F84 */ _t158 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02234F80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[10]));
+        /* 02234F84 */ _t158 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02234F84 */ _t159 = _t158 & 0x00000001u;
         /* 02234F84 */ if (_t159) goto L_02234FEC; else goto L_02234F88;
   L_02234F88: ; // 0x2234f88
@@ -16282,7 +16282,7 @@ void Gambit_fn_02234AF0(CPUState* cpu) {
         /* 02234FD4 */ _t170 = cpu->r[1] + 0x00000038u;
         /* 02234FD4 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t170);
         /* 02234FD8 */ cpu->f[0] = fma(cpu->f[11], cpu->f[13], cpu->f[0]);
-        /* 02234FDC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[28]);
+        /* 02234FDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[28]));
         /* 02234FE0 */ /* nop */
         /* 02234FE4 */ cpu->r[28] = rbrew_rlwinm(cpu->r[8], 0x00000001u, 0x0000001Fu, 0x0000001Fu);
         /* 02234FE8 */ cpu->r[28] = cpu->r[28] ^ 0x00000001u;
@@ -16294,9 +16294,9 @@ void Gambit_fn_02234AF0(CPUState* cpu) {
         /* 02234FF8 */ /* nop */
         /* 02234FFC */ _t172 = cpu->r[1] + 0x00000010u;
         /* 02234FFC */ rbrew_write_f32(cpu->mem, _t172, cpu->f[10]);
-        /* 02235000 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 02235000 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 02235004 */ /* nop */
-        /* 02235008 */ _t173 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235008 */ _t173 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235008 */ _t174 = _t173 & 0x00000001u;
         /* 02235008 */ if (_t174) goto L_0223500C; else goto L_02235014;
   L_0223500C: ; // 0x223500c
@@ -16355,7 +16355,7 @@ void Gambit_fn_02234AF0(CPUState* cpu) {
         /* 02235084 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t195);
         /* 02235088 */ _t196 = cpu->r[1] + 0x000000D0u;
         /* 02235088 */ cpu->r[30] = rbrew_read32(cpu->mem, _t196);
-        /* 0223508C */ _t197 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223508C */ _t197 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223508C */ _t198 = _t197 & 0x00000001u;
         /* 0223508C */ if (_t198) goto L_02235090; // else: addr-0 trap, fall-through
   L_02235090: ; // 0x2235090
@@ -16506,8 +16506,8 @@ void Gambit_fn_022351DC(CPUState* cpu) {
         /* 021BEFB0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 021BEFB4 */ _t3 = cpu->r[31] + 0x00000050u;
         /* 021BEFB4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 021BEFB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 021BEFBC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021BEFB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 021BEFBC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021BEFBC */ _t5 = _t4 & 0x00000001u;
         /* 021BEFBC */ if (_t5) goto L_021BEFC0; else goto L_021BEFD4;
   L_021BEFC0: ; // 0x21befc0
@@ -16560,13 +16560,13 @@ void Gambit_fn_022351E0(CPUState* cpu) {
         /* 022351F8 */ Gambit_fn_027C71A0(cpu);
         /* 022351FC */ _t4 = cpu->r[31] + 0x0000001Cu;
         /* 022351FC */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
-        /* 02235200 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02235204 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235200 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02235204 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235204 */ _t6 = _t5 & 0x00000001u;
         /* 02235204 */ if (_t6) goto L_02235210; else goto L_02235208;
   L_02235208: ; // 0x2235208
-        /* 02235208 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 0223520C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 0223520C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223520C */ _t8 = _t7 & 0x00000001u;
         /* 0223520C */ if (_t8) goto L_02235210; else goto L_0223522C;
   L_02235210: ; // 0x2235210
@@ -16607,13 +16607,13 @@ void Gambit_fn_022351E4(CPUState* cpu) {
         /* 022351F8 */ Gambit_fn_027C71A0(cpu);
         /* 022351FC */ _t4 = cpu->r[31] + 0x0000001Cu;
         /* 022351FC */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
-        /* 02235200 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02235204 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235200 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02235204 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235204 */ _t6 = _t5 & 0x00000001u;
         /* 02235204 */ if (_t6) goto L_02235210; else goto L_02235208;
   L_02235208: ; // 0x2235208
-        /* 02235208 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 0223520C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 0223520C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223520C */ _t8 = _t7 & 0x00000001u;
         /* 0223520C */ if (_t8) goto L_02235210; else goto L_0223522C;
   L_02235210: ; // 0x2235210
@@ -16653,8 +16653,8 @@ void Gambit_fn_02235240(CPUState* cpu) {
         /* 02235254 */ _t3 = cpu->r[31] + 0x00000090u;
         /* 02235254 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02235258 */ /* nop */
-        /* 0223525C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02235260 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223525C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02235260 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235260 */ _t5 = _t4 & 0x00000001u;
         /* 02235260 */ if (_t5) goto L_02235264; else goto L_02235274;
   L_02235264: ; // 0x2235264
@@ -16692,8 +16692,8 @@ void Gambit_fn_02235244(CPUState* cpu) {
         /* 02235254 */ _t3 = cpu->r[31] + 0x00000090u;
         /* 02235254 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02235258 */ /* nop */
-        /* 0223525C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02235260 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223525C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02235260 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235260 */ _t5 = _t4 & 0x00000001u;
         /* 02235260 */ if (_t5) goto L_02235264; else goto L_02235274;
   L_02235264: ; // 0x2235264
@@ -16766,8 +16766,8 @@ void Gambit_fn_022352D0(CPUState* cpu) {
         /* 022352DC */ cpu->r[0] = rbrew_read32(cpu->mem, _t2);
         /* 022352E0 */ _t3 = cpu->r[3] + 0x0000002Cu;
         /* 022352E0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 022352E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[11]);
-        /* 022352E8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022352E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[11]));
+        /* 022352E8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022352E8 */ _t5 = _t4 & 0x00000001u;
         /* 022352E8 */ if (_t5) goto L_022352EC; else goto L_02235304;
   L_022352EC: ; // 0x22352ec
@@ -16804,8 +16804,8 @@ void Gambit_fn_022352D8(CPUState* cpu) {
         /* 022352DC */ cpu->r[0] = rbrew_read32(cpu->mem, _t1);
         /* 022352E0 */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 022352E0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 022352E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[11]);
-        /* 022352E8 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022352E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[11]));
+        /* 022352E8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022352E8 */ _t4 = _t3 & 0x00000001u;
         /* 022352E8 */ if (_t4) goto L_022352EC; else goto L_02235304;
   L_022352EC: ; // 0x22352ec
@@ -16846,7 +16846,7 @@ void Gambit_fn_02235324(CPUState* cpu) {
         /* 02235334 */ _t4 = cpu->r[4] + 0x00000000u;
         /* 02235334 */ rbrew_write16(cpu->mem, _t4, (uint16_t)cpu->r[0]);
         /* 02235338 */ cpu->r[11] = cpu->r[9] & 0x0000FEFFu;
-        /* 02235338 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02235338 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0223533C */ cpu->r[12] = 0x00000000u;
         /* 02235340 */ _t5 = cpu->r[4] + 0x00000002u;
         /* 02235340 */ rbrew_write16(cpu->mem, _t5, (uint16_t)cpu->r[11]);
@@ -16876,8 +16876,8 @@ void Gambit_fn_02235360(CPUState* cpu) {
         /* 0223537C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02235380 */ _t5 = cpu->r[31] + 0x0000008Cu;
         /* 02235380 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
-        /* 02235384 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[3]);
-        /* 02235388 */ _t6 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02235384 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[3]));
+        /* 02235388 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02235388 */ _t7 = _t6 & 0x00000001u;
         /* 02235388 */ if (_t7) goto L_02235398; else goto L_0223538C;
   L_0223538C: ; // 0x223538c
@@ -16909,13 +16909,13 @@ void Gambit_fn_022353B0(CPUState* cpu) {
         /* 022353BC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 022353C0 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 022353C0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 022353C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 022353C8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022353C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 022353C8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022353C8 */ _t5 = _t4 & 0x00000001u;
         /* 022353C8 */ if (_t5) goto L_022353D4; else goto L_022353CC;
   L_022353CC: ; // 0x22353cc
-        /* 022353CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 022353D0 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022353CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 022353D0 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022353D0 */ _t7 = _t6 & 0x00000001u;
         /* 022353D0 */ if (_t7) goto L_022353D4; else goto L_02235408;
   L_022353D4: ; // 0x22353d4
@@ -17061,8 +17061,8 @@ void Gambit_fn_02235420(CPUState* cpu) {
         /* 0223552C */ cpu->ctr = cpu->r[6];
         /* 02235530 */ cpu->r[3] = cpu->r[31];
         /* 02235534 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02235538 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223553C */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235538 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223553C */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223553C */ _t38 = _t37 & 0x00000001u;
         /* 0223553C */ if (_t38) goto L_0223559C; else goto L_02235540;
   L_02235540: ; // 0x2235540
@@ -17106,8 +17106,8 @@ void Gambit_fn_02235420(CPUState* cpu) {
         /* 022355A8 */ cpu->r[3] = cpu->r[31];
         /* 022355AC */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 022355B0 */ cpu->r[0] = cpu->r[3] + 0x0000001Eu;
-        /* 022355B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
-        /* 022355B8 */ _t49 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022355B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
+        /* 022355B8 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022355B8 */ _t50 = _t49 & 0x00000001u;
         /* 022355B8 */ if (_t50) goto L_022355C4; else goto L_022355BC;
   L_022355BC: ; // 0x22355bc
@@ -17363,7 +17363,7 @@ void Gambit_fn_022355DC(CPUState* cpu) {
         /* 022357CC */ cpu->r[12] = 0x10050000u;
         /* 022357D0 */ _t95 = cpu->r[31] + 0x000000B0u;
         /* 022357D0 */ rbrew_write32(cpu->mem, _t95, cpu->r[30]);
-        /* 022357D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u);
+        /* 022357D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u));
         /* 022357D8 */ _t96 = cpu->r[12] + 0x00001B34u;
         /* 022357D8 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t96);
         /* 022357DC */ _t97 = cpu->r[8] + 0x00001B38u;
@@ -17373,14 +17373,14 @@ void Gambit_fn_022355DC(CPUState* cpu) {
         /* 022357E4 */ cpu->r[3] = cpu->r[31] + 0x000000C0u;
         /* 022357E8 */ _t99 = cpu->r[31] + 0x00000068u;
         /* 022357E8 */ rbrew_write32(cpu->mem, _t99, cpu->r[0]);
-        /* 022357EC */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022357EC */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022357EC */ _t101 = _t100 & 0x00000001u;
         /* 022357EC */ if (_t101) goto L_022357F0; else goto L_02235800;
   L_022357F0: ; // 0x22357f0
         /* 022357F0 */ cpu->r[3] = 0x00000010u;
         /* 022357F4 */ Gambit_fn_02801A78(cpu);
-        /* 022357F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022357FC */ _t102 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022357F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022357FC */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022357FC */ _t103 = _t102 & 0x00000001u;
         /* 022357FC */ if (_t103) goto L_02235818; else goto L_02235800;
   L_02235800: ; // 0x2235800
@@ -17396,16 +17396,16 @@ void Gambit_fn_022355DC(CPUState* cpu) {
         /* 02235814 */ _t108 = cpu->r[3] + 0x0000000Cu;
         /* 02235814 */ rbrew_write_f32(cpu->mem, _t108, cpu->f[12]);
   L_02235818: ; // 0x2235818
-        /* 02235818 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u);
+        /* 02235818 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u));
         /* 0223581C */ cpu->r[3] = cpu->r[31] + 0x000000D0u;
-        /* 02235820 */ _t109 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235820 */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235820 */ _t110 = _t109 & 0x00000001u;
         /* 02235820 */ if (_t110) goto L_02235824; else goto L_02235834;
   L_02235824: ; // 0x2235824
         /* 02235824 */ cpu->r[3] = 0x00000010u;
         /* 02235828 */ Gambit_fn_02801A78(cpu);
-        /* 0223582C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02235830 */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223582C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02235830 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235830 */ _t112 = _t111 & 0x00000001u;
         /* 02235830 */ if (_t112) goto L_0223584C; else goto L_02235834;
   L_02235834: ; // 0x2235834
@@ -17463,7 +17463,7 @@ void Gambit_fn_022355DC(CPUState* cpu) {
         /* 0223589C */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t134);
         /* 022358A0 */ _t135 = cpu->r[1] + 0x00000048u;
         /* 022358A0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t135);
-        /* 022358A4 */ _t136 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022358A4 */ _t136 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022358A4 */ _t137 = _t136 & 0x00000001u;
         /* 022358A4 */ if (_t137) goto L_022358A8; // else: addr-0 trap, fall-through
   L_022358A8: ; // 0x22358a8
@@ -17479,15 +17479,15 @@ void Gambit_fn_022358B8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_022358B8: ; // 0x22358b8
-        /* 022358B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022358BC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022358B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022358BC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022358BC */ _t1 = _t0 & 0x00000001u;
         /* 022358BC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022358BC */ goto L_022358C0;
   L_022358C0: ; // 0x22358c0
         /* 022358C0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022358C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022358C4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022358C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022358C4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022358C4 */ _t3 = _t2 & 0x00000001u;
         /* 022358C4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022358C4 */ goto L_022358C8;
@@ -17506,8 +17506,8 @@ void Gambit_fn_022358B8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -17521,15 +17521,15 @@ void Gambit_fn_022358B8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -17563,15 +17563,15 @@ void Gambit_fn_022358D0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_022358D0: ; // 0x22358d0
-        /* 022358D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022358D4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022358D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022358D4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022358D4 */ _t1 = _t0 & 0x00000001u;
         /* 022358D4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022358D4 */ goto L_022358D8;
   L_022358D8: ; // 0x22358d8
         /* 022358D8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022358D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022358DC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022358D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022358DC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022358DC */ _t3 = _t2 & 0x00000001u;
         /* 022358DC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022358DC */ goto L_022358E0;
@@ -17590,8 +17590,8 @@ void Gambit_fn_022358D0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -17605,15 +17605,15 @@ void Gambit_fn_022358D0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -17659,15 +17659,15 @@ void Gambit_fn_02235900(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02235900: ; // 0x2235900
-        /* 02235900 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02235904 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235900 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02235904 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235904 */ _t1 = _t0 & 0x00000001u;
         /* 02235904 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02235904 */ goto L_02235908;
   L_02235908: ; // 0x2235908
         /* 02235908 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02235908 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223590C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235908 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223590C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223590C */ _t3 = _t2 & 0x00000001u;
         /* 0223590C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0223590C */ goto L_02235910;
@@ -17686,8 +17686,8 @@ void Gambit_fn_02235900(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -17701,15 +17701,15 @@ void Gambit_fn_02235900(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -17737,15 +17737,15 @@ void Gambit_fn_02235914(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02235914: ; // 0x2235914
-        /* 02235914 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02235918 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235914 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02235918 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235918 */ _t1 = _t0 & 0x00000001u;
         /* 02235918 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02235918 */ goto L_0223591C;
   L_0223591C: ; // 0x223591c
         /* 0223591C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0223591C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02235920 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223591C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02235920 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235920 */ _t3 = _t2 & 0x00000001u;
         /* 02235920 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02235920 */ goto L_02235924;
@@ -17764,8 +17764,8 @@ void Gambit_fn_02235914(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -17779,15 +17779,15 @@ void Gambit_fn_02235914(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -17854,8 +17854,8 @@ void Gambit_fn_02235940(CPUState* cpu) {
         /* 02235940 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02235940 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02235944 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 02235944 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02235948 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235944 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02235948 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235948 */ _t2 = _t1 & 0x00000001u;
         /* 02235948 */ _t3 = _t2 ^ 0x00000001u;
         /* 02235948 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -17877,8 +17877,8 @@ void Gambit_fn_0223595C(CPUState* cpu) {
         /* 0223595C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0223595C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02235960 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 02235960 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02235964 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235960 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02235964 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235964 */ _t2 = _t1 & 0x00000001u;
         /* 02235964 */ _t3 = _t2 ^ 0x00000001u;
         /* 02235964 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -17900,8 +17900,8 @@ void Gambit_fn_02235978(CPUState* cpu) {
         /* 02235978 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02235978 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223597C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 0223597C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02235980 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223597C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02235980 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235980 */ _t2 = _t1 & 0x00000001u;
         /* 02235980 */ _t3 = _t2 ^ 0x00000001u;
         /* 02235980 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -17944,8 +17944,8 @@ void Gambit_fn_022359A4(CPUState* cpu) {
         /* 022359B4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 022359B8 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 022359B8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 022359BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 022359C0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022359BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 022359C0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022359C0 */ _t5 = _t4 & 0x00000001u;
         /* 022359C0 */ if (_t5) goto L_022359C4; else goto L_022359E0;
   L_022359C4: ; // 0x22359c4
@@ -17984,8 +17984,8 @@ void Gambit_fn_022359A8(CPUState* cpu) {
         /* 022359B4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 022359B8 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 022359B8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 022359BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 022359C0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022359BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 022359C0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022359C0 */ _t5 = _t4 & 0x00000001u;
         /* 022359C0 */ if (_t5) goto L_022359C4; else goto L_022359E0;
   L_022359C4: ; // 0x22359c4
@@ -18259,9 +18259,9 @@ void Gambit_fn_02235AF0(CPUState* cpu) {
         /* 02235AF4 */ _t0 = cpu->r[9] + 0xFFFFFCBCu;
         /* 02235AF4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t0);
         /* 02235AF8 */ cpu->r[11] = 0x101D0000u;
-        /* 02235AFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02235AFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02235B00 */ cpu->r[11] = cpu->r[11] + 0xFFFFFCC0u;
-        /* 02235B04 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235B04 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235B04 */ _t2 = _t1 & 0x00000001u;
         /* 02235B04 */ if (_t2) goto L_02235B08; else goto L_02235B20;
   L_02235B08: ; // 0x2235b08
@@ -18274,8 +18274,8 @@ void Gambit_fn_02235AF0(CPUState* cpu) {
         /* 02235B1C */ _t4 = cpu->r[11] + 0x00000000u;
         /* 02235B1C */ rbrew_write32(cpu->mem, _t4, cpu->r[9]);
   L_02235B20: ; // 0x2235b20
-        /* 02235B20 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 02235B24 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235B20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 02235B24 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235B24 */ _t6 = _t5 & 0x00000001u;
         /* 02235B24 */ if (_t6) goto L_02235B28; else goto L_02235B30;
   L_02235B28: ; // 0x2235b28
@@ -18285,10 +18285,10 @@ void Gambit_fn_02235AF0(CPUState* cpu) {
         /* 02235B30 */ cpu->r[12] = 0x101D0000u;
         /* 02235B34 */ _t7 = cpu->r[12] + 0xFFFFD9ECu;
         /* 02235B34 */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 02235B38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02235B38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02235B3C */ cpu->r[12] = 0x101D0000u;
         /* 02235B40 */ cpu->r[12] = cpu->r[12] + 0xFFFFFB4Cu;
-        /* 02235B44 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235B44 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235B44 */ _t9 = _t8 & 0x00000001u;
         /* 02235B44 */ if (_t9) goto L_02235B48; else goto L_02235B60;
   L_02235B48: ; // 0x2235b48
@@ -18301,8 +18301,8 @@ void Gambit_fn_02235AF0(CPUState* cpu) {
         /* 02235B5C */ _t11 = cpu->r[12] + 0x00000000u;
         /* 02235B5C */ rbrew_write32(cpu->mem, _t11, cpu->r[11]);
   L_02235B60: ; // 0x2235b60
-        /* 02235B60 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02235B64 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235B60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02235B64 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235B64 */ _t13 = _t12 & 0x00000001u;
         /* 02235B64 */ if (_t13) goto L_02235B68; else goto L_02235B70;
   L_02235B68: ; // 0x2235b68
@@ -18314,9 +18314,9 @@ void Gambit_fn_02235AF0(CPUState* cpu) {
         /* 02235B74 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 02235B74 */ cpu->r[10] = _t14;
         /* 02235B78 */ cpu->r[11] = 0x101D0000u;
-        /* 02235B7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02235B7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02235B80 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4ECu;
-        /* 02235B84 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235B84 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235B84 */ _t16 = _t15 & 0x00000001u;
         /* 02235B84 */ if (_t16) goto L_02235B88; else goto L_02235B9C;
   L_02235B88: ; // 0x2235b88
@@ -18328,8 +18328,8 @@ void Gambit_fn_02235AF0(CPUState* cpu) {
         /* 02235B98 */ _t18 = cpu->r[11] + 0x00000000u;
         /* 02235B98 */ rbrew_write32(cpu->mem, _t18, cpu->r[9]);
   L_02235B9C: ; // 0x2235b9c
-        /* 02235B9C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 02235BA0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235B9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 02235BA0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235BA0 */ _t20 = _t19 & 0x00000001u;
         /* 02235BA0 */ if (_t20) goto L_02235BA4; else goto L_02235BAC;
   L_02235BA4: ; // 0x2235ba4
@@ -18341,9 +18341,9 @@ void Gambit_fn_02235AF0(CPUState* cpu) {
         /* 02235BB0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t21);
         /* 02235BB0 */ cpu->r[9] = _t21;
         /* 02235BB4 */ cpu->r[12] = 0x101D0000u;
-        /* 02235BB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02235BB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02235BBC */ cpu->r[12] = cpu->r[12] + 0xFFFFD4E4u;
-        /* 02235BC0 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235BC0 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235BC0 */ _t23 = _t22 & 0x00000001u;
         /* 02235BC0 */ if (_t23) goto L_02235BC4; else goto L_02235BD8;
   L_02235BC4: ; // 0x2235bc4
@@ -47,18 +47,18 @@ void Gambit_fn_02235C64(CPUState* cpu) {
         /* 021EA98C */ _t3 = cpu->r[31] + 0x00000010u;
         /* 021EA98C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 021EA990 */ cpu->r[12] = 0x00000000u;
-        /* 021EA994 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 021EA994 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 021EA998 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 021EA998 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 021EA99C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA99C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA99C */ _t6 = _t5 & 0x00000001u;
         /* 021EA99C */ if (_t6) goto L_021EA9C4; else goto L_021EA9A0;
   L_021EA9A0: ; // 0x21ea9a0
         /* 021EA9A0 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 021EA9A0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 021EA9A4 */ /* nop */
-        /* 021EA9A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 021EA9AC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 021EA9A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 021EA9AC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 021EA9AC */ _t9 = _t8 & 0x00000001u;
         /* 021EA9AC */ if (_t9) goto L_021EA9B0; else goto L_021EA9C4;
   L_021EA9B0: ; // 0x21ea9b0
@@ -165,10 +165,10 @@ void Gambit_fn_02235CAC(CPUState* cpu) {
         /* 02235CCC */ cpu->r[31] = 0x101D0000u;
         /* 02235CD0 */ _t3 = cpu->r[28] + 0x0000001Cu;
         /* 02235CD0 */ rbrew_write32(cpu->mem, _t3, cpu->r[4]);
-        /* 02235CD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02235CD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02235CD8 */ _t4 = cpu->r[28] + 0x0000000Fu;
         /* 02235CD8 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[27]);
-        /* 02235CDC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235CDC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235CDC */ _t6 = _t5 & 0x00000001u;
         /* 02235CDC */ if (_t6) goto L_02235D20; else goto L_02235CE0;
   L_02235CE0: ; // 0x2235ce0
@@ -183,16 +183,16 @@ void Gambit_fn_02235CAC(CPUState* cpu) {
         /* 02235CF4 */ cpu->r[5] = 0x00000004u;
         /* 02235CF8 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 02235CFC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02235D00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02235D00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02235D04 */ cpu->r[0] = cpu->r[27];
-        /* 02235D08 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02235D08 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02235D08 */ _t11 = _t10 & 0x00000001u;
         /* 02235D08 */ if (_t11) goto L_02235D10; else goto L_02235D0C;
   L_02235D0C: ; // 0x2235d0c
         /* 02235D0C */ cpu->r[0] = 0x00000001u;
   L_02235D10: ; // 0x2235d10
-        /* 02235D10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02235D14 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235D10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02235D14 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235D14 */ _t13 = _t12 & 0x00000001u;
         /* 02235D14 */ if (_t13) goto L_02235D20; else goto L_02235D18;
   L_02235D18: ; // 0x2235d18
@@ -204,9 +204,9 @@ void Gambit_fn_02235CAC(CPUState* cpu) {
         /* 02235D20 */ _t16 = cpu->r[28] + 0x00000020u;
         /* 02235D20 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 02235D24 */ cpu->r[0] = 0x00000000u;
-        /* 02235D28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02235D28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02235D2C */ cpu->r[12] = cpu->r[0];
-        /* 02235D30 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02235D30 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02235D30 */ _t18 = _t17 & 0x00000001u;
         /* 02235D30 */ if (_t18) goto L_02235D34; else goto L_02235D58;
   L_02235D34: ; // 0x2235d34
@@ -231,8 +231,8 @@ void Gambit_fn_02235CAC(CPUState* cpu) {
   L_02235D58: ; // 0x2235d58
         /* 02235D58 */ _t26 = cpu->r[28] + 0x0000000Fu;
         /* 02235D58 */ cpu->r[27] = rbrew_read8(cpu->mem, _t26);
-        /* 02235D5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 02235D60 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235D5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 02235D60 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235D60 */ _t28 = _t27 & 0x00000001u;
         /* 02235D60 */ if (_t28) goto L_02235DA4; else goto L_02235D64;
   L_02235D64: ; // 0x2235d64
@@ -247,16 +247,16 @@ void Gambit_fn_02235CAC(CPUState* cpu) {
         /* 02235D78 */ cpu->r[5] = 0x00000004u;
         /* 02235D7C */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 02235D80 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02235D84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02235D84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02235D88 */ cpu->r[11] = cpu->r[27];
-        /* 02235D8C */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02235D8C */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02235D8C */ _t33 = _t32 & 0x00000001u;
         /* 02235D8C */ if (_t33) goto L_02235D94; else goto L_02235D90;
   L_02235D90: ; // 0x2235d90
         /* 02235D90 */ cpu->r[11] = 0x00000001u;
   L_02235D94: ; // 0x2235d94
-        /* 02235D94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02235D98 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235D94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02235D98 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235D98 */ _t35 = _t34 & 0x00000001u;
         /* 02235D98 */ if (_t35) goto L_02235DA4; else goto L_02235D9C;
   L_02235D9C: ; // 0x2235d9c
@@ -268,9 +268,9 @@ void Gambit_fn_02235CAC(CPUState* cpu) {
         /* 02235DA4 */ _t38 = cpu->r[28] + 0x00000028u;
         /* 02235DA4 */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 02235DA8 */ cpu->r[0] = 0x00000000u;
-        /* 02235DAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02235DAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 02235DB0 */ cpu->r[12] = cpu->r[0];
-        /* 02235DB4 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02235DB4 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02235DB4 */ _t40 = _t39 & 0x00000001u;
         /* 02235DB4 */ if (_t40) goto L_02235DB8; else goto L_02235DDC;
   L_02235DB8: ; // 0x2235db8
@@ -295,8 +295,8 @@ void Gambit_fn_02235CAC(CPUState* cpu) {
   L_02235DDC: ; // 0x2235ddc
         /* 02235DDC */ _t48 = cpu->r[28] + 0x0000000Fu;
         /* 02235DDC */ cpu->r[27] = rbrew_read8(cpu->mem, _t48);
-        /* 02235DE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 02235DE4 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235DE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 02235DE4 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235DE4 */ _t50 = _t49 & 0x00000001u;
         /* 02235DE4 */ if (_t50) goto L_02235E28; else goto L_02235DE8;
   L_02235DE8: ; // 0x2235de8
@@ -311,16 +311,16 @@ void Gambit_fn_02235CAC(CPUState* cpu) {
         /* 02235DFC */ cpu->r[5] = 0x00000004u;
         /* 02235E00 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 02235E04 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02235E08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 02235E08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 02235E0C */ cpu->r[10] = cpu->r[27];
-        /* 02235E10 */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02235E10 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02235E10 */ _t55 = _t54 & 0x00000001u;
         /* 02235E10 */ if (_t55) goto L_02235E18; else goto L_02235E14;
   L_02235E14: ; // 0x2235e14
         /* 02235E14 */ cpu->r[10] = 0x00000001u;
   L_02235E18: ; // 0x2235e18
-        /* 02235E18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02235E1C */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235E18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02235E1C */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235E1C */ _t57 = _t56 & 0x00000001u;
         /* 02235E1C */ if (_t57) goto L_02235E28; else goto L_02235E20;
   L_02235E20: ; // 0x2235e20
@@ -332,9 +332,9 @@ void Gambit_fn_02235CAC(CPUState* cpu) {
         /* 02235E28 */ _t60 = cpu->r[28] + 0x00000030u;
         /* 02235E28 */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
         /* 02235E2C */ cpu->r[0] = 0x00000000u;
-        /* 02235E30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02235E30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02235E34 */ cpu->r[5] = cpu->r[0];
-        /* 02235E38 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02235E38 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02235E38 */ _t62 = _t61 & 0x00000001u;
         /* 02235E38 */ if (_t62) goto L_02235E3C; else goto L_02235E60;
   L_02235E3C: ; // 0x2235e3c
@@ -359,8 +359,8 @@ void Gambit_fn_02235CAC(CPUState* cpu) {
   L_02235E60: ; // 0x2235e60
         /* 02235E60 */ _t70 = cpu->r[30] + 0x00000000u;
         /* 02235E60 */ cpu->r[25] = rbrew_read8(cpu->mem, _t70);
-        /* 02235E64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 02235E68 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235E64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 02235E68 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235E68 */ _t72 = _t71 & 0x00000001u;
         /* 02235E68 */ if (_t72) goto L_02235F44; else goto L_02235E6C;
   L_02235E6C: ; // 0x2235e6c
@@ -376,10 +376,10 @@ void Gambit_fn_02235CAC(CPUState* cpu) {
         /* 02235E84 */ cpu->r[4] = (uint32_t)((int32_t)cpu->r[25] * (int32_t)0x00000024u);
         /* 02235E88 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02235E8C */ cpu->r[24] = cpu->r[3];
-        /* 02235E90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 02235E90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 02235E94 */ cpu->r[30] = cpu->r[25];
         /* 02235E98 */ cpu->r[7] = 0x00000000u;
-        /* 02235E9C */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02235E9C */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02235E9C */ _t77 = _t76 & 0x00000001u;
         /* 02235E9C */ if (_t77) goto L_02235EA4; else goto L_02235EA0;
   L_02235EA0: ; // 0x2235ea0
@@ -392,36 +392,36 @@ void Gambit_fn_02235CAC(CPUState* cpu) {
         /* 02235EB0 */ cpu->r[23] = 0x00000018u;
   L_02235EB4: ; // 0x2235eb4
         /* 02235EB4 */ cpu->r[27] = cpu->r[24] + cpu->r[22];
-        /* 02235EB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 02235EB8 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235EB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 02235EB8 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235EB8 */ _t80 = _t79 & 0x00000001u;
         /* 02235EB8 */ if (_t80) goto L_02235F28; else goto L_02235EBC;
   L_02235EBC: ; // 0x2235ebc
         /* 02235EBC */ cpu->r[26] = cpu->r[27];
-        /* 02235EBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 02235EC0 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235EBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 02235EC0 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235EC0 */ _t82 = _t81 & 0x00000001u;
         /* 02235EC0 */ if (_t82) goto L_02235EC4; else goto L_02235ED4;
   L_02235EC4: ; // 0x2235ec4
         /* 02235EC4 */ cpu->r[3] = 0x00000024u;
         /* 02235EC8 */ Gambit_fn_02801A78(cpu);
         /* 02235ECC */ cpu->r[26] = cpu->r[3];
-        /* 02235ECC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 02235ED0 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235ECC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 02235ED0 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235ED0 */ _t84 = _t83 & 0x00000001u;
         /* 02235ED0 */ if (_t84) goto L_02235F1C; else goto L_02235ED4;
   L_02235ED4: ; // 0x2235ed4
         /* 02235ED4 */ cpu->r[11] = cpu->r[26];
-        /* 02235ED4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02235ED8 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235ED4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02235ED8 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235ED8 */ _t86 = _t85 & 0x00000001u;
         /* 02235ED8 */ if (_t86) goto L_02235EDC; else goto L_02235EEC;
   L_02235EDC: ; // 0x2235edc
         /* 02235EDC */ cpu->r[3] = 0x0000000Cu;
         /* 02235EE0 */ Gambit_fn_02801A78(cpu);
         /* 02235EE4 */ cpu->r[11] = cpu->r[3];
-        /* 02235EE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02235EE8 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235EE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02235EE8 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235EE8 */ _t88 = _t87 & 0x00000001u;
         /* 02235EE8 */ if (_t88) goto L_02235F08; else goto L_02235EEC;
   L_02235EEC: ; // 0x2235eec
@@ -452,14 +452,14 @@ void Gambit_fn_02235CAC(CPUState* cpu) {
         /* 02235F24 */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
   L_02235F28: ; // 0x2235f28
         /* 02235F28 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 02235F28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 02235F28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 02235F2C */ cpu->r[22] = cpu->r[22] + 0x00000024u;
-        /* 02235F30 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235F30 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235F30 */ _t98 = _t97 & 0x00000001u;
         /* 02235F30 */ if (_t98) goto L_02235F34; else goto L_02235EB4;
   L_02235F34: ; // 0x2235f34
-        /* 02235F34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 02235F38 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02235F34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 02235F38 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02235F38 */ _t100 = _t99 & 0x00000001u;
         /* 02235F38 */ if (_t100) goto L_02235F44; else goto L_02235F3C;
   L_02235F3C: ; // 0x2235f3c
@@ -489,10 +489,10 @@ void Gambit_fn_02235F5C(CPUState* cpu) {
         /* 02235F60 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 02235F64 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 02235F64 */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 02235F68 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[12]);
+        /* 02235F68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[12]));
         /* 02235F6C */ _t3 = cpu->r[4] + 0x00000000u;
         /* 02235F6C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 02235F70 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02235F70 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02235F70 */ _t5 = _t4 & 0x00000001u;
         /* 02235F70 */ if (_t5) goto L_02235F74; else goto L_02235F7C;
   L_02235F74: ; // 0x2235f74
@@ -509,10 +509,10 @@ void Gambit_fn_02235F5C(CPUState* cpu) {
         /* 02235F88 */ cpu->r[9] = rbrew_read8(cpu->mem, _t9);
         /* 02235F8C */ _t10 = cpu->r[3] + 0x00000028u;
         /* 02235F8C */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 02235F90 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
+        /* 02235F90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
         /* 02235F94 */ _t11 = cpu->r[3] + 0x0000002Cu;
         /* 02235F94 */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
-        /* 02235F98 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02235F98 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02235F98 */ _t13 = _t12 & 0x00000001u;
         /* 02235F98 */ if (_t13) goto L_02235F9C; else goto L_02235FA4;
   L_02235F9C: ; // 0x2235f9c
@@ -533,10 +533,10 @@ void Gambit_fn_02235F5C(CPUState* cpu) {
         /* 02235FB8 */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
         /* 02235FBC */ _t20 = cpu->r[3] + 0x00000034u;
         /* 02235FBC */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 02235FC0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
+        /* 02235FC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
         /* 02235FC4 */ _t21 = cpu->r[6] + 0x00000000u;
         /* 02235FC4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
-        /* 02235FC8 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02235FC8 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02235FC8 */ _t23 = _t22 & 0x00000001u;
         /* 02235FC8 */ if (_t23) goto L_02235FCC; else goto L_02235FD4;
   L_02235FCC: ; // 0x2235fcc
@@ -577,20 +577,20 @@ void Gambit_fn_02235FE8(CPUState* cpu) {
         /* 0223600C */ _t7 = cpu->r[1] + 0x00000008u;
         /* 0223600C */ rbrew_write32(cpu->mem, _t7, cpu->r[28]);
         /* 02236010 */ cpu->r[31] = cpu->r[3];
-        /* 02236010 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02236010 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02236014 */ _t8 = cpu->r[1] + 0x00000020u;
         /* 02236014 */ rbrew_write_f32(cpu->mem, _t8, cpu->f[30]);
         /* 02236018 */ _t9 = cpu->r[1] + 0x0000000Cu;
         /* 02236018 */ rbrew_write32(cpu->mem, _t9, cpu->r[29]);
-        /* 0223601C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223601C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223601C */ _t11 = _t10 & 0x00000001u;
         /* 0223601C */ if (_t11) goto L_02236020; else goto L_02236030;
   L_02236020: ; // 0x2236020
         /* 02236020 */ cpu->r[3] = 0x00000214u;
         /* 02236024 */ Gambit_fn_02801A78(cpu);
         /* 02236028 */ cpu->r[31] = cpu->r[3];
-        /* 02236028 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0223602C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02236028 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0223602C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223602C */ _t13 = _t12 & 0x00000001u;
         /* 0223602C */ if (_t13) goto L_02236228; else goto L_02236030;
   L_02236030: ; // 0x2236030
@@ -615,10 +615,10 @@ void Gambit_fn_02235FE8(CPUState* cpu) {
         /* 02236060 */ _t20 = cpu->r[31] + 0x00000138u;
         /* 02236060 */ rbrew_write_f32(cpu->mem, _t20, cpu->f[31]);
         /* 02236064 */ cpu->r[5] = cpu->r[31] + 0x0000013Cu;
-        /* 02236064 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02236064 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02236068 */ _t21 = cpu->r[31] + 0x00000130u;
         /* 02236068 */ rbrew_write_f32(cpu->mem, _t21, cpu->f[31]);
-        /* 0223606C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223606C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223606C */ _t23 = _t22 & 0x00000001u;
         /* 0223606C */ if (_t23) goto L_02236070; else goto L_02236078;
   L_02236070: ; // 0x2236070
@@ -626,8 +626,8 @@ void Gambit_fn_02235FE8(CPUState* cpu) {
         /* 02236074 */ Gambit_fn_02801A78(cpu);
   L_02236078: ; // 0x2236078
         /* 02236078 */ cpu->r[7] = cpu->r[31] + 0x0000016Cu;
-        /* 02236078 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0223607C */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02236078 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0223607C */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223607C */ _t25 = _t24 & 0x00000001u;
         /* 0223607C */ if (_t25) goto L_02236080; else goto L_02236088;
   L_02236080: ; // 0x2236080
@@ -635,8 +635,8 @@ void Gambit_fn_02235FE8(CPUState* cpu) {
         /* 02236084 */ Gambit_fn_02801A78(cpu);
   L_02236088: ; // 0x2236088
         /* 02236088 */ cpu->r[9] = cpu->r[31] + 0x00000178u;
-        /* 02236088 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0223608C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02236088 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0223608C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223608C */ _t27 = _t26 & 0x00000001u;
         /* 0223608C */ if (_t27) goto L_02236090; else goto L_02236098;
   L_02236090: ; // 0x2236090
@@ -650,17 +650,17 @@ void Gambit_fn_02235FE8(CPUState* cpu) {
         /* 022360A4 */ rbrew_write8(cpu->mem, _t28, (uint8_t)cpu->r[0]);
         /* 022360A8 */ cpu->r[30] = cpu->r[30] + 0x00001EE0u;
         /* 022360AC */ cpu->r[3] = cpu->r[31] + 0x00000188u;
-        /* 022360AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 022360AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 022360B0 */ _t29 = cpu->r[31] + 0x00000184u;
         /* 022360B0 */ rbrew_write16(cpu->mem, _t29, (uint16_t)cpu->r[29]);
-        /* 022360B4 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022360B4 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022360B4 */ _t31 = _t30 & 0x00000001u;
         /* 022360B4 */ if (_t31) goto L_022360B8; else goto L_022360C8;
   L_022360B8: ; // 0x22360b8
         /* 022360B8 */ cpu->r[3] = 0x0000000Cu;
         /* 022360BC */ Gambit_fn_02801A78(cpu);
-        /* 022360C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022360C4 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022360C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022360C4 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022360C4 */ _t33 = _t32 & 0x00000001u;
         /* 022360C4 */ if (_t33) goto L_022360D4; else goto L_022360C8;
   L_022360C8: ; // 0x22360c8
@@ -674,17 +674,17 @@ void Gambit_fn_02235FE8(CPUState* cpu) {
         /* 022360D4 */ cpu->r[28] = 0x10050000u;
         /* 022360D8 */ cpu->r[28] = cpu->r[28] + 0x00001EF0u;
         /* 022360DC */ cpu->r[3] = cpu->r[31] + 0x00000194u;
-        /* 022360DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 022360DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 022360E0 */ _t37 = cpu->r[31] + 0x00000190u;
         /* 022360E0 */ rbrew_write32(cpu->mem, _t37, cpu->r[28]);
-        /* 022360E4 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022360E4 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022360E4 */ _t39 = _t38 & 0x00000001u;
         /* 022360E4 */ if (_t39) goto L_022360E8; else goto L_022360F8;
   L_022360E8: ; // 0x22360e8
         /* 022360E8 */ cpu->r[3] = 0x0000000Cu;
         /* 022360EC */ Gambit_fn_02801A78(cpu);
-        /* 022360F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022360F4 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022360F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022360F4 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022360F4 */ _t41 = _t40 & 0x00000001u;
         /* 022360F4 */ if (_t41) goto L_02236104; else goto L_022360F8;
   L_022360F8: ; // 0x22360f8
@@ -696,17 +696,17 @@ void Gambit_fn_02235FE8(CPUState* cpu) {
         /* 02236100 */ rbrew_write32(cpu->mem, _t44, cpu->r[29]);
   L_02236104: ; // 0x2236104
         /* 02236104 */ cpu->r[3] = cpu->r[31] + 0x000001A0u;
-        /* 02236104 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02236104 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02236108 */ _t45 = cpu->r[31] + 0x0000019Cu;
         /* 02236108 */ rbrew_write32(cpu->mem, _t45, cpu->r[28]);
-        /* 0223610C */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223610C */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223610C */ _t47 = _t46 & 0x00000001u;
         /* 0223610C */ if (_t47) goto L_02236110; else goto L_02236120;
   L_02236110: ; // 0x2236110
         /* 02236110 */ cpu->r[3] = 0x00000008u;
         /* 02236114 */ Gambit_fn_02801A78(cpu);
-        /* 02236118 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223611C */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02236118 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223611C */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223611C */ _t49 = _t48 & 0x00000001u;
         /* 0223611C */ if (_t49) goto L_02236128; else goto L_02236120;
   L_02236120: ; // 0x2236120
@@ -717,15 +717,15 @@ void Gambit_fn_02235FE8(CPUState* cpu) {
   L_02236128: ; // 0x2236128
         /* 02236128 */ cpu->r[11] = cpu->r[31] + 0x000001A0u;
         /* 0223612C */ cpu->r[3] = cpu->r[11] + 0x00000008u;
-        /* 0223612C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02236130 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223612C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02236130 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02236130 */ _t53 = _t52 & 0x00000001u;
         /* 02236130 */ if (_t53) goto L_02236134; else goto L_02236144;
   L_02236134: ; // 0x2236134
         /* 02236134 */ cpu->r[3] = 0x00000008u;
         /* 02236138 */ Gambit_fn_02801A78(cpu);
-        /* 0223613C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02236140 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223613C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02236140 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02236140 */ _t55 = _t54 & 0x00000001u;
         /* 02236140 */ if (_t55) goto L_0223614C; else goto L_02236144;
   L_02236144: ; // 0x2236144
@@ -735,15 +735,15 @@ void Gambit_fn_02235FE8(CPUState* cpu) {
         /* 02236148 */ rbrew_write_f32(cpu->mem, _t57, cpu->f[30]);
   L_0223614C: ; // 0x223614c
         /* 0223614C */ cpu->r[3] = cpu->r[31] + 0x000001B0u;
-        /* 0223614C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02236150 */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223614C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02236150 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02236150 */ _t59 = _t58 & 0x00000001u;
         /* 02236150 */ if (_t59) goto L_02236154; else goto L_02236164;
   L_02236154: ; // 0x2236154
         /* 02236154 */ cpu->r[3] = 0x0000000Cu;
         /* 02236158 */ Gambit_fn_02801A78(cpu);
-        /* 0223615C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02236160 */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223615C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02236160 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02236160 */ _t61 = _t60 & 0x00000001u;
         /* 02236160 */ if (_t61) goto L_02236170; else goto L_02236164;
   L_02236164: ; // 0x2236164
@@ -755,17 +755,17 @@ void Gambit_fn_02235FE8(CPUState* cpu) {
         /* 0223616C */ rbrew_write32(cpu->mem, _t64, cpu->r[29]);
   L_02236170: ; // 0x2236170
         /* 02236170 */ cpu->r[3] = cpu->r[31] + 0x000001BCu;
-        /* 02236170 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02236170 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02236174 */ _t65 = cpu->r[31] + 0x000001B8u;
         /* 02236174 */ rbrew_write32(cpu->mem, _t65, cpu->r[28]);
-        /* 02236178 */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02236178 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02236178 */ _t67 = _t66 & 0x00000001u;
         /* 02236178 */ if (_t67) goto L_0223617C; else goto L_0223618C;
   L_0223617C: ; // 0x223617c
         /* 0223617C */ cpu->r[3] = 0x0000000Cu;
         /* 02236180 */ Gambit_fn_02801A78(cpu);
-        /* 02236184 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02236188 */ _t68 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02236184 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02236188 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02236188 */ _t69 = _t68 & 0x00000001u;
         /* 02236188 */ if (_t69) goto L_02236198; else goto L_0223618C;
   L_0223618C: ; // 0x223618c
@@ -777,17 +777,17 @@ void Gambit_fn_02235FE8(CPUState* cpu) {
         /* 02236194 */ rbrew_write32(cpu->mem, _t72, cpu->r[29]);
   L_02236198: ; // 0x2236198
         /* 02236198 */ cpu->r[3] = cpu->r[31] + 0x000001C8u;
-        /* 02236198 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02236198 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0223619C */ _t73 = cpu->r[31] + 0x000001C4u;
         /* 0223619C */ rbrew_write32(cpu->mem, _t73, cpu->r[28]);
-        /* 022361A0 */ _t74 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022361A0 */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022361A0 */ _t75 = _t74 & 0x00000001u;
         /* 022361A0 */ if (_t75) goto L_022361A4; else goto L_022361B4;
   L_022361A4: ; // 0x22361a4
         /* 022361A4 */ cpu->r[3] = 0x0000000Cu;
         /* 022361A8 */ Gambit_fn_02801A78(cpu);
-        /* 022361AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022361B0 */ _t76 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022361AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022361B0 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022361B0 */ _t77 = _t76 & 0x00000001u;
         /* 022361B0 */ if (_t77) goto L_022361C0; else goto L_022361B4;
   L_022361B4: ; // 0x22361b4
@@ -803,29 +803,29 @@ void Gambit_fn_02235FE8(CPUState* cpu) {
         /* 022361C4 */ rbrew_write32(cpu->mem, _t81, cpu->r[28]);
         /* 022361C8 */ Gambit_fn_02043B8C(cpu);
         /* 022361CC */ cpu->r[30] = cpu->r[31] + 0x000001E4u;
-        /* 022361CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 022361D0 */ _t82 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022361CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 022361D0 */ _t82 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022361D0 */ _t83 = _t82 & 0x00000001u;
         /* 022361D0 */ if (_t83) goto L_022361D4; else goto L_022361E4;
   L_022361D4: ; // 0x22361d4
         /* 022361D4 */ cpu->r[3] = 0x00000030u;
         /* 022361D8 */ Gambit_fn_02801A78(cpu);
         /* 022361DC */ cpu->r[30] = cpu->r[3];
-        /* 022361DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 022361E0 */ _t84 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022361DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 022361E0 */ _t84 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022361E0 */ _t85 = _t84 & 0x00000001u;
         /* 022361E0 */ if (_t85) goto L_02236228; else goto L_022361E4;
   L_022361E4: ; // 0x22361e4
         /* 022361E4 */ cpu->r[3] = cpu->r[30];
-        /* 022361E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022361E8 */ _t86 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022361E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022361E8 */ _t86 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022361E8 */ _t87 = _t86 & 0x00000001u;
         /* 022361E8 */ if (_t87) goto L_022361EC; else goto L_022361FC;
   L_022361EC: ; // 0x22361ec
         /* 022361EC */ cpu->r[3] = 0x00000010u;
         /* 022361F0 */ Gambit_fn_02801A78(cpu);
-        /* 022361F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022361F8 */ _t88 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022361F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022361F8 */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022361F8 */ _t89 = _t88 & 0x00000001u;
         /* 022361F8 */ if (_t89) goto L_0223620C; else goto L_022361FC;
   L_022361FC: ; // 0x22361fc
@@ -839,8 +839,8 @@ void Gambit_fn_02235FE8(CPUState* cpu) {
         /* 02236208 */ rbrew_write32(cpu->mem, _t93, cpu->r[29]);
   L_0223620C: ; // 0x223620c
         /* 0223620C */ cpu->r[0] = cpu->r[30] + 0x00000010u;
-        /* 0223620C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02236210 */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223620C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02236210 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02236210 */ _t95 = _t94 & 0x00000001u;
         /* 02236210 */ if (_t95) goto L_02236228; else goto L_02236214;
   L_02236214: ; // 0x2236214
@@ -871,7 +871,7 @@ void Gambit_fn_02235FE8(CPUState* cpu) {
         /* 02236244 */ cpu->r[31] = rbrew_read32(cpu->mem, _t106);
         /* 02236248 */ _t107 = cpu->r[1] + 0x00000010u;
         /* 02236248 */ cpu->r[30] = rbrew_read32(cpu->mem, _t107);
-        /* 0223624C */ _t108 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223624C */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223624C */ _t109 = _t108 & 0x00000001u;
         /* 0223624C */ if (_t109) goto L_02236250; // else: addr-0 trap, fall-through
   L_02236250: ; // 0x2236250
@@ -904,18 +904,18 @@ void Gambit_fn_02236260(CPUState* cpu) {
         /* 02236280 */ _t5 = cpu->r[3] + 0x00000128u;
         /* 02236280 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t5);
         /* 02236284 */ cpu->r[12] = 0x10050000u;
-        /* 02236288 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[12]);
+        /* 02236288 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[12]));
         /* 0223628C */ _t6 = cpu->r[12] + 0x00001F24u;
         /* 0223628C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t6);
-        /* 02236290 */ _t7 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02236290 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02236290 */ _t8 = _t7 & 0x00000001u;
         /* 02236290 */ if (_t8) goto L_02236294; else goto L_022362D8;
   L_02236294: ; // 0x2236294
         /* 02236294 */ cpu->r[12] = 0x10050000u;
         /* 02236298 */ _t9 = cpu->r[12] + 0x00001F3Cu;
         /* 02236298 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t9);
-        /* 0223629C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
-        /* 022362A0 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223629C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
+        /* 022362A0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022362A0 */ _t11 = _t10 & 0x00000001u;
         /* 022362A0 */ if (_t11) goto L_022362A4; else goto L_022362D0;
   L_022362A4: ; // 0x22362a4
@@ -943,7 +943,7 @@ void Gambit_fn_02236260(CPUState* cpu) {
         /* 022362DC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t16);
         /* 022362E0 */ _t17 = cpu->r[1] + 0x00000008u;
         /* 022362E0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t17);
-        /* 022362E4 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022362E4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022362E4 */ _t19 = _t18 & 0x00000001u;
         /* 022362E4 */ if (_t19) goto L_022362E8; // else: addr-0 trap, fall-through
   L_022362E8: ; // 0x22362e8
@@ -975,18 +975,18 @@ void Gambit_fn_02236264(CPUState* cpu) {
         /* 02236280 */ _t5 = cpu->r[3] + 0x00000128u;
         /* 02236280 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t5);
         /* 02236284 */ cpu->r[12] = 0x10050000u;
-        /* 02236288 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[12]);
+        /* 02236288 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[12]));
         /* 0223628C */ _t6 = cpu->r[12] + 0x00001F24u;
         /* 0223628C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t6);
-        /* 02236290 */ _t7 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02236290 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02236290 */ _t8 = _t7 & 0x00000001u;
         /* 02236290 */ if (_t8) goto L_02236294; else goto L_022362D8;
   L_02236294: ; // 0x2236294
         /* 02236294 */ cpu->r[12] = 0x10050000u;
         /* 02236298 */ _t9 = cpu->r[12] + 0x00001F3Cu;
         /* 02236298 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t9);
-        /* 0223629C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
-        /* 022362A0 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223629C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
+        /* 022362A0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022362A0 */ _t11 = _t10 & 0x00000001u;
         /* 022362A0 */ if (_t11) goto L_022362A4; else goto L_022362D0;
   L_022362A4: ; // 0x22362a4
@@ -1014,7 +1014,7 @@ void Gambit_fn_02236264(CPUState* cpu) {
         /* 022362DC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t16);
         /* 022362E0 */ _t17 = cpu->r[1] + 0x00000008u;
         /* 022362E0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t17);
-        /* 022362E4 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022362E4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022362E4 */ _t19 = _t18 & 0x00000001u;
         /* 022362E4 */ if (_t19) goto L_022362E8; // else: addr-0 trap, fall-through
   L_022362E8: ; // 0x22362e8
@@ -1047,18 +1047,18 @@ void Gambit_fn_022362F8(CPUState* cpu) {
         /* 02236318 */ _t5 = cpu->r[3] + 0x00000128u;
         /* 02236318 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t5);
         /* 0223631C */ cpu->r[12] = 0x10050000u;
-        /* 02236320 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[12]);
+        /* 02236320 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[12]));
         /* 02236324 */ _t6 = cpu->r[12] + 0x00001F50u;
         /* 02236324 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t6);
-        /* 02236328 */ _t7 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02236328 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02236328 */ _t8 = _t7 & 0x00000001u;
         /* 02236328 */ if (_t8) goto L_0223632C; else goto L_02236370;
   L_0223632C: ; // 0x223632c
         /* 0223632C */ cpu->r[12] = 0x10050000u;
         /* 02236330 */ _t9 = cpu->r[12] + 0x00001F3Cu;
         /* 02236330 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t9);
-        /* 02236334 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
-        /* 02236338 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02236334 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
+        /* 02236338 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02236338 */ _t11 = _t10 & 0x00000001u;
         /* 02236338 */ if (_t11) goto L_0223633C; else goto L_02236368;
   L_0223633C: ; // 0x223633c
@@ -1086,7 +1086,7 @@ void Gambit_fn_022362F8(CPUState* cpu) {
         /* 02236374 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t16);
         /* 02236378 */ _t17 = cpu->r[1] + 0x00000008u;
         /* 02236378 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t17);
-        /* 0223637C */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223637C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223637C */ _t19 = _t18 & 0x00000001u;
         /* 0223637C */ if (_t19) goto L_02236380; // else: addr-0 trap, fall-through
   L_02236380: ; // 0x2236380
@@ -1118,18 +1118,18 @@ void Gambit_fn_022362FC(CPUState* cpu) {
         /* 02236318 */ _t5 = cpu->r[3] + 0x00000128u;
         /* 02236318 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t5);
         /* 0223631C */ cpu->r[12] = 0x10050000u;
-        /* 02236320 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[12]);
+        /* 02236320 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[12]));
         /* 02236324 */ _t6 = cpu->r[12] + 0x00001F50u;
         /* 02236324 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t6);
-        /* 02236328 */ _t7 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02236328 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02236328 */ _t8 = _t7 & 0x00000001u;
         /* 02236328 */ if (_t8) goto L_0223632C; else goto L_02236370;
   L_0223632C: ; // 0x223632c
         /* 0223632C */ cpu->r[12] = 0x10050000u;
         /* 02236330 */ _t9 = cpu->r[12] + 0x00001F3Cu;
         /* 02236330 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t9);
-        /* 02236334 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
-        /* 02236338 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02236334 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
+        /* 02236338 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02236338 */ _t11 = _t10 & 0x00000001u;
         /* 02236338 */ if (_t11) goto L_0223633C; else goto L_02236368;
   L_0223633C: ; // 0x223633c
@@ -1157,7 +1157,7 @@ void Gambit_fn_022362FC(CPUState* cpu) {
         /* 02236374 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t16);
         /* 02236378 */ _t17 = cpu->r[1] + 0x00000008u;
         /* 02236378 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t17);
-        /* 0223637C */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223637C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223637C */ _t19 = _t18 & 0x00000001u;
         /* 0223637C */ if (_t19) goto L_02236380; // else: addr-0 trap, fall-through
   L_02236380: ; // 0x2236380
@@ -1352,7 +1352,7 @@ void Gambit_fn_02236390(CPUState* cpu) {
         /* 02236538 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t67);
         /* 0223653C */ _t68 = cpu->r[1] + 0x00000080u;
         /* 0223653C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t68);
-        /* 02236540 */ _t69 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02236540 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02236540 */ _t70 = _t69 & 0x00000001u;
         /* 02236540 */ if (_t70) goto L_02236544; // else: addr-0 trap, fall-through
   L_02236544: ; // 0x2236544
@@ -1547,7 +1547,7 @@ void Gambit_fn_02236554(CPUState* cpu) {
         /* 02236538 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t67);
         /* 0223653C */ _t68 = cpu->r[1] + 0x00000080u;
         /* 0223653C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t68);
-        /* 02236540 */ _t69 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02236540 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02236540 */ _t70 = _t69 & 0x00000001u;
         /* 02236540 */ if (_t70) goto L_02236544; // else: addr-0 trap, fall-through
   L_02236544: ; // 0x2236544
@@ -1752,7 +1752,7 @@ void Gambit_fn_02236568(CPUState* cpu) {
         /* 02236538 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t67);
         /* 0223653C */ _t68 = cpu->r[1] + 0x00000080u;
         /* 0223653C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t68);
-        /* 02236540 */ _t69 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02236540 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02236540 */ _t70 = _t69 & 0x00000001u;
         /* 02236540 */ if (_t70) goto L_02236544; // else: addr-0 trap, fall-through
   L_02236544: ; // 0x2236544
@@ -1800,8 +1800,8 @@ void Gambit_fn_0223657C(CPUState* cpu) {
         /* 022365AC */ cpu->f[12] = cpu->f[12] - cpu->f[10];
         /* 022365B0 */ _t6 = cpu->r[9] + 0x00001F20u;
         /* 022365B0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t6);
-        /* 022365B4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[13]);
-        /* 022365B8 */ _t7 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022365B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[13]));
+        /* 022365B8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022365B8 */ _t8 = _t7 & 0x00000001u;
         /* 022365B8 */ if (_t8) goto L_022365BC; else goto L_0223665C;
   L_022365BC: ; // 0x22365bc
@@ -1812,9 +1812,9 @@ void Gambit_fn_0223657C(CPUState* cpu) {
         /* 022365C8 */ _t10 = cpu->r[10] + 0x00001F30u;
         /* 022365C8 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t10);
         /* 022365CC */ cpu->f[0] = cpu->f[12] / cpu->f[9];
-        /* 022365D0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[11]);
+        /* 022365D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[11]));
         /* 022365D4 */ cpu->r[0] = 0x00000000u;
-        /* 022365D8 */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022365D8 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022365D8 */ _t12 = _t11 & 0x00000001u;
         /* 022365D8 */ if (_t12) goto L_022365FC; else goto L_022365DC;
   L_022365DC: ; // 0x22365dc
@@ -1822,8 +1822,8 @@ void Gambit_fn_0223657C(CPUState* cpu) {
         /* 022365DC */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t13);
         /* 022365E0 */ cpu->r[0] = cpu->r[10] + 0x0000003Cu;
         /* 022365E4 */ /* nop */
-        /* 022365E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x0000003Cu);
-        /* 022365EC */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022365E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x0000003Cu));
+        /* 022365EC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022365EC */ _t15 = _t14 & 0x00000001u;
         /* 022365EC */ if (_t15) goto L_022365F0; else goto L_022365F4;
   L_022365F0: ; // 0x22365f0
@@ -1836,8 +1836,8 @@ void Gambit_fn_0223657C(CPUState* cpu) {
         /* 022365FC */ cpu->r[8] = 0x10050000u;
         /* 02236600 */ _t17 = cpu->r[8] + 0x00001F84u;
         /* 02236600 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t17);
-        /* 02236604 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[10]);
-        /* 02236608 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02236604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[10]));
+        /* 02236608 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02236608 */ _t19 = _t18 & 0x00000001u;
         /* 02236608 */ if (_t19) goto L_02236640; else goto L_0223660C;
   L_0223660C: ; // 0x223660c
@@ -1863,8 +1863,8 @@ void Gambit_fn_0223657C(CPUState* cpu) {
         /* 02236640 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t24);
         /* 02236644 */ cpu->r[0] = cpu->r[10] + cpu->r[0];
         /* 02236648 */ /* nop */
-        /* 0223664C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x0000003Cu);
-        /* 02236650 */ _t25 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223664C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x0000003Cu));
+        /* 02236650 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02236650 */ _t26 = _t25 & 0x00000001u;
         /* 02236650 */ if (_t26) goto L_02236654; else goto L_02236658;
   L_02236654: ; // 0x2236654
@@ -1903,8 +1903,8 @@ void Gambit_fn_02236580(CPUState* cpu) {
         /* 022365AC */ cpu->f[12] = cpu->f[12] - cpu->f[10];
         /* 022365B0 */ _t6 = cpu->r[9] + 0x00001F20u;
         /* 022365B0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t6);
-        /* 022365B4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[13]);
-        /* 022365B8 */ _t7 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022365B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[13]));
+        /* 022365B8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022365B8 */ _t8 = _t7 & 0x00000001u;
         /* 022365B8 */ if (_t8) goto L_022365BC; else goto L_0223665C;
   L_022365BC: ; // 0x22365bc
@@ -1915,9 +1915,9 @@ void Gambit_fn_02236580(CPUState* cpu) {
         /* 022365C8 */ _t10 = cpu->r[10] + 0x00001F30u;
         /* 022365C8 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t10);
         /* 022365CC */ cpu->f[0] = cpu->f[12] / cpu->f[9];
-        /* 022365D0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[11]);
+        /* 022365D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[11]));
         /* 022365D4 */ cpu->r[0] = 0x00000000u;
-        /* 022365D8 */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022365D8 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022365D8 */ _t12 = _t11 & 0x00000001u;
         /* 022365D8 */ if (_t12) goto L_022365FC; else goto L_022365DC;
   L_022365DC: ; // 0x22365dc
@@ -1925,8 +1925,8 @@ void Gambit_fn_02236580(CPUState* cpu) {
         /* 022365DC */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t13);
         /* 022365E0 */ cpu->r[0] = cpu->r[10] + 0x0000003Cu;
         /* 022365E4 */ /* nop */
-        /* 022365E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x0000003Cu);
-        /* 022365EC */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022365E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x0000003Cu));
+        /* 022365EC */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022365EC */ _t15 = _t14 & 0x00000001u;
         /* 022365EC */ if (_t15) goto L_022365F0; else goto L_022365F4;
   L_022365F0: ; // 0x22365f0
@@ -1939,8 +1939,8 @@ void Gambit_fn_02236580(CPUState* cpu) {
         /* 022365FC */ cpu->r[8] = 0x10050000u;
         /* 02236600 */ _t17 = cpu->r[8] + 0x00001F84u;
         /* 02236600 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t17);
-        /* 02236604 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[10]);
-        /* 02236608 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02236604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[10]));
+        /* 02236608 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02236608 */ _t19 = _t18 & 0x00000001u;
         /* 02236608 */ if (_t19) goto L_02236640; else goto L_0223660C;
   L_0223660C: ; // 0x223660c
@@ -1966,8 +1966,8 @@ void Gambit_fn_02236580(CPUState* cpu) {
         /* 02236640 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t24);
         /* 02236644 */ cpu->r[0] = cpu->r[10] + cpu->r[0];
         /* 02236648 */ /* nop */
-        /* 0223664C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x0000003Cu);
-        /* 02236650 */ _t25 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223664C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x0000003Cu));
+        /* 02236650 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02236650 */ _t26 = _t25 & 0x00000001u;
         /* 02236650 */ if (_t26) goto L_02236654; else goto L_02236658;
   L_02236654: ; // 0x2236654
@@ -2001,16 +2001,16 @@ void Gambit_fn_02236664(CPUState* cpu) {
         /* 02236680 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 02236684 */ _t5 = cpu->r[3] + 0x00000128u;
         /* 02236684 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t5);
-        /* 02236688 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
-        /* 0223668C */ _t6 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02236688 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
+        /* 0223668C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223668C */ _t7 = _t6 & 0x00000001u;
         /* 0223668C */ if (_t7) goto L_02236690; else goto L_022366C8;
   L_02236690: ; // 0x2236690
         /* 02236690 */ cpu->r[12] = 0x10050000u;
         /* 02236694 */ _t8 = cpu->r[12] + 0x00001F3Cu;
         /* 02236694 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t8);
-        /* 02236698 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[0]);
-        /* 0223669C */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02236698 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[0]));
+        /* 0223669C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223669C */ _t10 = _t9 & 0x00000001u;
         /* 0223669C */ if (_t10) goto L_022366A0; else goto L_022366C8;
   L_022366A0: ; // 0x22366a0
@@ -2033,7 +2033,7 @@ void Gambit_fn_02236664(CPUState* cpu) {
         /* 022366CC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t14);
         /* 022366D0 */ _t15 = cpu->r[1] + 0x00000008u;
         /* 022366D0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t15);
-        /* 022366D4 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022366D4 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022366D4 */ _t17 = _t16 & 0x00000001u;
         /* 022366D4 */ if (_t17) goto L_022366D8; // else: addr-0 trap, fall-through
   L_022366D8: ; // 0x22366d8
@@ -2064,16 +2064,16 @@ void Gambit_fn_02236668(CPUState* cpu) {
         /* 02236680 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 02236684 */ _t5 = cpu->r[3] + 0x00000128u;
         /* 02236684 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t5);
-        /* 02236688 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
-        /* 0223668C */ _t6 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02236688 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
+        /* 0223668C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223668C */ _t7 = _t6 & 0x00000001u;
         /* 0223668C */ if (_t7) goto L_02236690; else goto L_022366C8;
   L_02236690: ; // 0x2236690
         /* 02236690 */ cpu->r[12] = 0x10050000u;
         /* 02236694 */ _t8 = cpu->r[12] + 0x00001F3Cu;
         /* 02236694 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t8);
-        /* 02236698 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[0]);
-        /* 0223669C */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02236698 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[0]));
+        /* 0223669C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223669C */ _t10 = _t9 & 0x00000001u;
         /* 0223669C */ if (_t10) goto L_022366A0; else goto L_022366C8;
   L_022366A0: ; // 0x22366a0
@@ -2096,7 +2096,7 @@ void Gambit_fn_02236668(CPUState* cpu) {
         /* 022366CC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t14);
         /* 022366D0 */ _t15 = cpu->r[1] + 0x00000008u;
         /* 022366D0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t15);
-        /* 022366D4 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022366D4 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022366D4 */ _t17 = _t16 & 0x00000001u;
         /* 022366D4 */ if (_t17) goto L_022366D8; // else: addr-0 trap, fall-through
   L_022366D8: ; // 0x22366d8
@@ -2138,19 +2138,19 @@ void Gambit_fn_022366E8(CPUState* cpu) {
         /* 02236720 */ cpu->r[0] = cpu->r[10] + 0xFFFFFFFFu;
         /* 02236724 */ cpu->r[26] = 0x10050000u;
         /* 02236728 */ cpu->r[28] = cpu->r[10] - cpu->r[0];
-        /* 02236728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 02236728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 0223672C */ _t7 = cpu->r[29] + 0x00000030u;
         /* 0223672C */ cpu->r[25] = rbrew_read32(cpu->mem, _t7);
         /* 02236730 */ cpu->r[26] = cpu->r[26] + 0x00001F8Cu;
         /* 02236734 */ cpu->r[30] = cpu->r[4];
-        /* 02236738 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02236738 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02236738 */ _t9 = _t8 & 0x00000001u;
         /* 02236738 */ if (_t9) goto L_02236834; else goto L_0223673C;
   L_0223673C: ; // 0x223673c
         /* 0223673C */ _t10 = cpu->r[29] + 0x00000051u;
         /* 0223673C */ cpu->r[9] = rbrew_read8(cpu->mem, _t10);
-        /* 02236740 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02236744 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02236740 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02236744 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02236744 */ _t12 = _t11 & 0x00000001u;
         /* 02236744 */ if (_t12) goto L_02236798; else goto L_02236748;
   L_02236748: ; // 0x2236748
@@ -2186,8 +2186,8 @@ void Gambit_fn_022366E8(CPUState* cpu) {
   L_02236798: ; // 0x2236798
         /* 02236798 */ _t22 = cpu->r[29] + 0x000001B0u;
         /* 02236798 */ cpu->r[31] = rbrew_read32(cpu->mem, _t22);
-        /* 0223679C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022367A0 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223679C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022367A0 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022367A0 */ _t24 = _t23 & 0x00000001u;
         /* 022367A0 */ if (_t24) goto L_022367B4; else goto L_022367A4;
   L_022367A4: ; // 0x22367a4
@@ -2195,8 +2195,8 @@ void Gambit_fn_022366E8(CPUState* cpu) {
         /* 022367A4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t25);
         /* 022367A8 */ _t26 = cpu->r[29] + 0x000001B4u;
         /* 022367A8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t26);
-        /* 022367AC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[10]);
-        /* 022367B0 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022367AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[10]));
+        /* 022367B0 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022367B0 */ _t28 = _t27 & 0x00000001u;
         /* 022367B0 */ if (_t28) goto L_022367EC; else goto L_022367B4;
   L_022367B4: ; // 0x22367b4
@@ -2218,8 +2218,8 @@ void Gambit_fn_022366E8(CPUState* cpu) {
   L_022367EC: ; // 0x22367ec
         /* 022367EC */ _t30 = cpu->r[29] + 0x000001BCu;
         /* 022367EC */ cpu->r[31] = rbrew_read32(cpu->mem, _t30);
-        /* 022367F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022367F4 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022367F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022367F4 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022367F4 */ _t32 = _t31 & 0x00000001u;
         /* 022367F4 */ if (_t32) goto L_022368D4; else goto L_022367F8;
   L_022367F8: ; // 0x22367f8
@@ -2227,15 +2227,15 @@ void Gambit_fn_022366E8(CPUState* cpu) {
         /* 022367F8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t33);
         /* 022367FC */ _t34 = cpu->r[29] + 0x000001C0u;
         /* 022367FC */ cpu->r[0] = rbrew_read32(cpu->mem, _t34);
-        /* 02236800 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
-        /* 02236804 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02236800 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
+        /* 02236804 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02236804 */ _t36 = _t35 & 0x00000001u;
         /* 02236804 */ if (_t36) goto L_02236808; else goto L_022368D4;
   L_02236808: ; // 0x2236808
         /* 02236808 */ _t37 = cpu->r[31] + 0x00000028u;
         /* 02236808 */ cpu->r[3] = rbrew_read32(cpu->mem, _t37);
-        /* 0223680C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02236810 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223680C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02236810 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02236810 */ _t39 = _t38 & 0x00000001u;
         /* 02236810 */ if (_t39) goto L_02236828; else goto L_02236814;
   L_02236814: ; // 0x2236814
@@ -2256,8 +2256,8 @@ void Gambit_fn_022366E8(CPUState* cpu) {
         /* 02236838 */ Gambit_fn_0222CA14(cpu);
         /* 0223683C */ _t43 = cpu->r[29] + 0x000001BCu;
         /* 0223683C */ cpu->r[31] = rbrew_read32(cpu->mem, _t43);
-        /* 02236840 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02236844 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02236840 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02236844 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02236844 */ _t45 = _t44 & 0x00000001u;
         /* 02236844 */ if (_t45) goto L_02236858; else goto L_02236848;
   L_02236848: ; // 0x2236848
@@ -2265,8 +2265,8 @@ void Gambit_fn_022366E8(CPUState* cpu) {
         /* 02236848 */ cpu->r[10] = rbrew_read32(cpu->mem, _t46);
         /* 0223684C */ _t47 = cpu->r[29] + 0x000001C0u;
         /* 0223684C */ cpu->r[11] = rbrew_read32(cpu->mem, _t47);
-        /* 02236850 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[11]);
-        /* 02236854 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02236850 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[11]));
+        /* 02236854 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02236854 */ _t49 = _t48 & 0x00000001u;
         /* 02236854 */ if (_t49) goto L_02236890; else goto L_02236858;
   L_02236858: ; // 0x2236858
@@ -2288,8 +2288,8 @@ void Gambit_fn_022366E8(CPUState* cpu) {
   L_02236890: ; // 0x2236890
         /* 02236890 */ _t51 = cpu->r[29] + 0x000001B0u;
         /* 02236890 */ cpu->r[31] = rbrew_read32(cpu->mem, _t51);
-        /* 02236894 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02236898 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02236894 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02236898 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02236898 */ _t53 = _t52 & 0x00000001u;
         /* 02236898 */ if (_t53) goto L_022368D4; else goto L_0223689C;
   L_0223689C: ; // 0x223689c
@@ -2297,15 +2297,15 @@ void Gambit_fn_022366E8(CPUState* cpu) {
         /* 0223689C */ cpu->r[7] = rbrew_read32(cpu->mem, _t54);
         /* 022368A0 */ _t55 = cpu->r[29] + 0x000001B4u;
         /* 022368A0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t55);
-        /* 022368A4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
-        /* 022368A8 */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022368A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
+        /* 022368A8 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022368A8 */ _t57 = _t56 & 0x00000001u;
         /* 022368A8 */ if (_t57) goto L_022368AC; else goto L_022368D4;
   L_022368AC: ; // 0x22368ac
         /* 022368AC */ _t58 = cpu->r[31] + 0x00000028u;
         /* 022368AC */ cpu->r[3] = rbrew_read32(cpu->mem, _t58);
-        /* 022368B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022368B4 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022368B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022368B4 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022368B4 */ _t60 = _t59 & 0x00000001u;
         /* 022368B4 */ if (_t60) goto L_022368CC; else goto L_022368B8;
   L_022368B8: ; // 0x22368b8
@@ -2329,19 +2329,19 @@ void Gambit_fn_022366E8(CPUState* cpu) {
         /* 022368E4 */ _t65 = cpu->r[6] + 0x00001F20u;
         /* 022368E4 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t65);
         /* 022368E8 */ cpu->r[6] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022368E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 022368E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 022368EC */ _t66 = cpu->r[12] + 0x00001F28u;
         /* 022368EC */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t66);
-        /* 022368F0 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022368F0 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022368F0 */ _t68 = _t67 & 0x00000001u;
         /* 022368F0 */ if (_t68) goto L_0223692C; else goto L_022368F4;
   L_022368F4: ; // 0x22368f4
         /* 022368F4 */ cpu->r[3] = cpu->r[27] + 0x0000012Cu;
         /* 022368F8 */ Gambit_fn_02C69350(cpu);
-        /* 022368FC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
+        /* 022368FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
         /* 02236900 */ _t69 = cpu->r[27] + 0x00000000u;
         /* 02236900 */ cpu->r[0] = rbrew_read32(cpu->mem, _t69);
-        /* 02236904 */ _t70 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02236904 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02236904 */ _t71 = _t70 & 0x00000001u;
         /* 02236904 */ if (_t71) goto L_02236908; else goto L_02236924;
   L_02236908: ; // 0x2236908
@@ -2412,8 +2412,8 @@ void Gambit_fn_022366E8(CPUState* cpu) {
         /* 022369A8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t93);
         /* 022369AC */ cpu->f[10] = fma(cpu->f[8], cpu->f[8], cpu->f[9]);
         /* 022369B0 */ cpu->f[11] = fma(cpu->f[13], cpu->f[13], cpu->f[10]);
-        /* 022369B4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
-        /* 022369B8 */ _t94 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022369B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
+        /* 022369B8 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022369B8 */ _t95 = _t94 & 0x00000001u;
         /* 022369B8 */ if (_t95) goto L_022369BC; else goto L_022369F8;
   L_022369BC: ; // 0x22369bc
@@ -2477,15 +2477,15 @@ void Gambit_fn_022366E8(CPUState* cpu) {
         /* 02236A60 */ cpu->r[4] = cpu->r[1] + 0x00000068u;
         /* 02236A64 */ cpu->r[5] = cpu->r[1] + 0x00000098u;
         /* 02236A68 */ Gambit_fn_02C69544(cpu);
-        /* 02236A6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 02236A70 */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02236A6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 02236A70 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02236A70 */ _t112 = _t111 & 0x00000001u;
         /* 02236A70 */ if (_t112) goto L_02236AB8; else goto L_02236A74;
   L_02236A74: ; // 0x2236a74
         /* 02236A74 */ _t113 = cpu->r[29] + 0x000001B0u;
         /* 02236A74 */ cpu->r[31] = rbrew_read32(cpu->mem, _t113);
-        /* 02236A78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02236A7C */ _t114 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02236A78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02236A7C */ _t114 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02236A7C */ _t115 = _t114 & 0x00000001u;
         /* 02236A7C */ if (_t115) goto L_02236AF8; else goto L_02236A80;
   L_02236A80: ; // 0x2236a80
@@ -2493,8 +2493,8 @@ void Gambit_fn_022366E8(CPUState* cpu) {
         /* 02236A80 */ cpu->r[9] = rbrew_read32(cpu->mem, _t116);
         /* 02236A84 */ _t117 = cpu->r[29] + 0x000001B4u;
         /* 02236A84 */ cpu->r[10] = rbrew_read32(cpu->mem, _t117);
-        /* 02236A88 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[10]);
-        /* 02236A8C */ _t118 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02236A88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[10]));
+        /* 02236A8C */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02236A8C */ _t119 = _t118 & 0x00000001u;
         /* 02236A8C */ if (_t119) goto L_02236A90; else goto L_02236AF8;
   L_02236A90: ; // 0x2236a90
@@ -2516,8 +2516,8 @@ void Gambit_fn_022366E8(CPUState* cpu) {
   L_02236AB8: ; // 0x2236ab8
         /* 02236AB8 */ _t125 = cpu->r[29] + 0x000001BCu;
         /* 02236AB8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t125);
-        /* 02236ABC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02236AC0 */ _t126 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02236ABC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02236AC0 */ _t126 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02236AC0 */ _t127 = _t126 & 0x00000001u;
         /* 02236AC0 */ if (_t127) goto L_02236AF8; else goto L_02236AC4;
   L_02236AC4: ; // 0x2236ac4
@@ -2525,8 +2525,8 @@ void Gambit_fn_022366E8(CPUState* cpu) {
         /* 02236AC4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t128);
         /* 02236AC8 */ _t129 = cpu->r[29] + 0x000001C0u;
         /* 02236AC8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t129);
-        /* 02236ACC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[9]);
-        /* 02236AD0 */ _t130 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02236ACC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[9]));
+        /* 02236AD0 */ _t130 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02236AD0 */ _t131 = _t130 & 0x00000001u;
         /* 02236AD0 */ if (_t131) goto L_02236AD4; else goto L_02236AF8;
   L_02236AD4: ; // 0x2236ad4
@@ -2554,7 +2554,7 @@ void Gambit_fn_022366E8(CPUState* cpu) {
         /* 02236B04 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t139);
         /* 02236B08 */ _t140 = cpu->r[1] + 0x00000128u;
         /* 02236B08 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t140);
-        /* 02236B0C */ _t141 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02236B0C */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02236B0C */ _t142 = _t141 & 0x00000001u;
         /* 02236B0C */ if (_t142) goto L_02236B10; // else: addr-0 trap, fall-through
   L_02236B10: ; // 0x2236b10
@@ -2675,8 +2675,8 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 02236C1C */ cpu->f[7] = cpu->f[9] - cpu->f[27];
         /* 02236C20 */ _t37 = cpu->r[11] + 0x00001F98u;
         /* 02236C20 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t37);
-        /* 02236C24 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[10]);
-        /* 02236C28 */ _t38 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02236C24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[10]));
+        /* 02236C28 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02236C28 */ _t39 = _t38 & 0x00000001u;
         /* 02236C28 */ if (_t39) goto L_02237580; else goto L_02236C2C;
   L_02236C2C: ; // 0x2236c2c
@@ -2783,14 +2783,14 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 02236D24 */ cpu->r[7] = 0x10050000u;
         /* 02236D28 */ _t76 = cpu->r[1] + 0x00000090u;
         /* 02236D28 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t76);
-        /* 02236D2C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[28]);
+        /* 02236D2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[28]));
         /* 02236D30 */ _t77 = cpu->r[7] + 0x00001F30u;
         /* 02236D30 */ cpu->f[25] = rbrew_read_f32(cpu->mem, _t77);
         /* 02236D34 */ _t78 = cpu->r[1] + 0x00000080u;
         /* 02236D34 */ rbrew_write_f32(cpu->mem, _t78, cpu->f[0]);
         /* 02236D38 */ _t79 = cpu->r[1] + 0x00000088u;
         /* 02236D38 */ rbrew_write_f32(cpu->mem, _t79, cpu->f[11]);
-        /* 02236D3C */ _t80 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02236D3C */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02236D3C */ _t81 = _t80 & 0x00000001u;
         /* 02236D3C */ if (_t81) goto L_02236D40; else goto L_02236D60;
   L_02236D40: ; // 0x2236d40
@@ -2808,9 +2808,9 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 02236D60 */ cpu->r[30] = 0x101C0000u;
         /* 02236D64 */ cpu->r[23] = 0x00000000u;
         /* 02236D68 */ cpu->r[24] = cpu->r[21];
-        /* 02236D68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 02236D68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 02236D6C */ cpu->r[30] = cpu->r[30] + 0x00001EF8u;
-        /* 02236D70 */ _t84 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02236D70 */ _t84 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02236D70 */ _t85 = _t84 & 0x00000001u;
         /* 02236D70 */ if (_t85) goto L_02236D74; else goto L_022371E0;
   L_02236D74: ; // 0x2236d74
@@ -2913,10 +2913,10 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 02236E74 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t116);
         /* 02236E78 */ cpu->f[0] = fma(cpu->f[10], cpu->f[10], cpu->f[12]);
         /* 02236E7C */ cpu->f[1] = fma(cpu->f[9], cpu->f[9], cpu->f[0]);
-        /* 02236E80 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[21]);
+        /* 02236E80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[21]));
         /* 02236E84 */ _t117 = cpu->r[1] + 0x00000018u;
         /* 02236E84 */ rbrew_write_f32(cpu->mem, _t117, cpu->f[9]);
-        /* 02236E88 */ _t118 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02236E88 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02236E88 */ _t119 = _t118 & 0x00000001u;
         /* 02236E88 */ if (_t119) goto L_02236E8C; else goto L_02236EBC;
   L_02236E8C: ; // 0x2236e8c
@@ -2939,13 +2939,13 @@ void Gambit_fn_02236B20(CPUState* cpu) {
   L_02236EBC: ; // 0x2236ebc
         /* 02236EBC */ _t124 = cpu->r[31] + 0x00000134u;
         /* 02236EBC */ cpu->f[2] = rbrew_read_f32(cpu->mem, _t124);
-        /* 02236EC0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[21]);
+        /* 02236EC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[21]));
         /* 02236EC4 */ _t125 = cpu->r[31] + 0x000001D8u;
         /* 02236EC4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t125);
         /* 02236EC8 */ cpu->f[3] = cpu->f[24];
         /* 02236ECC */ _t126 = cpu->r[30] + 0x00000000u;
         /* 02236ECC */ cpu->r[3] = rbrew_read32(cpu->mem, _t126);
-        /* 02236ED0 */ _t127 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02236ED0 */ _t127 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02236ED0 */ _t128 = _t127 & 0x00000001u;
         /* 02236ED0 */ if (_t128) goto L_02236F10; else goto L_02236ED4;
   L_02236ED4: ; // 0x2236ed4
@@ -2962,10 +2962,10 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 02236EF8 */ cpu->r[10] = cpu->r[27];
         /* 02236EFC */ Gambit_fn_0204A4DC(cpu);
         /* 02236F00 */ cpu->r[9] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02236F00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02236F00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02236F04 */ _t130 = cpu->r[31] + 0x000001D4u;
         /* 02236F04 */ rbrew_write32(cpu->mem, _t130, cpu->r[3]);
-        /* 02236F08 */ _t131 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02236F08 */ _t131 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02236F08 */ _t132 = _t131 & 0x00000001u;
         /* 02236F08 */ if (_t132) goto L_022370AC; else goto L_02236F0C;
   L_02236F0C: ; // 0x2236f0c
@@ -2980,10 +2980,10 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 02236F28 */ cpu->r[7] = 0x000001F0u;
         /* 02236F2C */ Gambit_fn_0204A864(cpu);
         /* 02236F30 */ cpu->r[9] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02236F30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02236F30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02236F34 */ _t133 = cpu->r[31] + 0x000001D4u;
         /* 02236F34 */ rbrew_write32(cpu->mem, _t133, cpu->r[3]);
-        /* 02236F38 */ _t134 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02236F38 */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02236F38 */ _t135 = _t134 & 0x00000001u;
         /* 02236F38 */ if (_t135) goto L_022370AC; else goto L_02236F3C;
   L_02236F3C: ; // 0x2236f3c
@@ -2992,18 +2992,18 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 02236F40 */ _t137 = cpu->r[20] + 0x00000000u;
         /* 02236F40 */ cpu->r[4] = rbrew_read32(cpu->mem, _t137);
         /* 02236F44 */ cpu->r[11] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 02236F44 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02236F44 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02236F48 */ cpu->r[19] = cpu->r[20] + 0x000000A8u;
-        /* 02236F4C */ _t138 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02236F4C */ _t138 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02236F4C */ _t139 = _t138 & 0x00000001u;
         /* 02236F4C */ if (_t139) goto L_02236F88; else goto L_02236F50;
   L_02236F50: ; // 0x2236f50
         /* 02236F50 */ cpu->r[3] = cpu->r[20] + 0x00000138u;
         /* 02236F54 */ Gambit_fn_02C69350(cpu);
-        /* 02236F58 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[21]);
+        /* 02236F58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[21]));
         /* 02236F5C */ _t140 = cpu->r[20] + 0x00000000u;
         /* 02236F5C */ cpu->r[0] = rbrew_read32(cpu->mem, _t140);
-        /* 02236F60 */ _t141 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02236F60 */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02236F60 */ _t142 = _t141 & 0x00000001u;
         /* 02236F60 */ if (_t142) goto L_02236F64; else goto L_02236F80;
   L_02236F64: ; // 0x2236f64
@@ -3030,8 +3030,8 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 02236F9C */ _t147 = cpu->r[1] + 0x00000018u;
         /* 02236F9C */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t147);
         /* 02236FA0 */ cpu->f[8] = fma(cpu->f[6], cpu->f[7], cpu->f[13]);
-        /* 02236FA4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[21]);
-        /* 02236FA8 */ _t148 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02236FA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[21]));
+        /* 02236FA8 */ _t148 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02236FA8 */ _t149 = _t148 & 0x00000001u;
         /* 02236FA8 */ if (_t149) goto L_02236FAC; else goto L_022370AC;
   L_02236FAC: ; // 0x2236fac
@@ -3063,10 +3063,10 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 02236FE8 */ rbrew_write32(cpu->mem, _t159, cpu->r[7]);
         /* 02236FEC */ _t160 = cpu->r[9] + 0x00000104u;
         /* 02236FEC */ cpu->r[4] = rbrew_read8(cpu->mem, _t160);
-        /* 02236FF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 02236FF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 02236FF4 */ _t161 = cpu->r[31] + 0x00000051u;
         /* 02236FF4 */ cpu->r[5] = rbrew_read8(cpu->mem, _t161);
-        /* 02236FF8 */ _t162 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02236FF8 */ _t162 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02236FF8 */ _t163 = _t162 & 0x00000001u;
         /* 02236FF8 */ if (_t163) goto L_0223704C; else goto L_02236FFC;
   L_02236FFC: ; // 0x2236ffc
@@ -3074,8 +3074,8 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 02237000 */ cpu->r[6] = cpu->r[1] + 0x0000005Cu;
         /* 02237004 */ cpu->r[3] = cpu->r[22];
         /* 02237008 */ Gambit_fn_021F000C(cpu);
-        /* 0223700C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02237010 */ _t164 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223700C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02237010 */ _t164 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237010 */ _t165 = _t164 & 0x00000001u;
         /* 02237010 */ if (_t165) goto L_0223704C; else goto L_02237014;
   L_02237014: ; // 0x2237014
@@ -3113,20 +3113,20 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 02237064 */ _t176 = cpu->r[1] + 0x0000002Cu;
         /* 02237064 */ rbrew_write_f32(cpu->mem, _t176, cpu->f[11]);
         /* 02237068 */ Gambit_fn_02819758(cpu);
-        /* 0223706C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[23], cpu->f[21]);
+        /* 0223706C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[23], cpu->f[21]));
         /* 02237070 */ _t177 = cpu->r[1] + 0x0000003Cu;
         /* 02237070 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t177);
-        /* 02237074 */ _t178 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02237074 */ _t178 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02237074 */ _t179 = _t178 & 0x00000001u;
         /* 02237074 */ if (_t179) goto L_02237080; else goto L_02237078;
   L_02237078: ; // 0x2237078
-        /* 02237078 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[23], cpu->f[13]);
-        /* 0223707C */ _t180 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02237078 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[23], cpu->f[13]));
+        /* 0223707C */ _t180 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223707C */ _t181 = _t180 & 0x00000001u;
         /* 0223707C */ if (_t181) goto L_02237080; else goto L_022371D4;
   L_02237080: ; // 0x2237080
-        /* 02237080 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[21]);
-        /* 02237084 */ _t182 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02237080 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[21]));
+        /* 02237084 */ _t182 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02237084 */ _t183 = _t182 & 0x00000001u;
         /* 02237084 */ if (_t183) goto L_022371D4; else goto L_02237088;
   L_02237088: ; // 0x2237088
@@ -3135,14 +3135,14 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 0223708C */ _t185 = cpu->r[1] + 0x0000002Cu;
         /* 0223708C */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t185);
         /* 02237090 */ cpu->r[24] = cpu->r[24] + 0xFFFFFFFFu;
-        /* 02237090 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 02237090 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 02237094 */ _t186 = cpu->r[1] + 0x00000048u;
         /* 02237094 */ rbrew_write_f32(cpu->mem, _t186, cpu->f[6]);
         /* 02237098 */ cpu->f[23] = cpu->f[13];
         /* 0223709C */ cpu->r[23] = cpu->r[23] + 0x00000001u;
         /* 022370A0 */ _t187 = cpu->r[1] + 0x0000004Cu;
         /* 022370A0 */ rbrew_write_f32(cpu->mem, _t187, cpu->f[7]);
-        /* 022370A4 */ _t188 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022370A4 */ _t188 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022370A4 */ _t189 = _t188 & 0x00000001u;
         /* 022370A4 */ if (_t189) goto L_022370A8; else goto L_02236DB0;
   L_022370A8: ; // 0x22370a8
@@ -3150,18 +3150,18 @@ void Gambit_fn_02236B20(CPUState* cpu) {
   L_022370AC: ; // 0x22370ac
         /* 022370AC */ _t190 = cpu->r[29] + 0x00000000u;
         /* 022370AC */ cpu->r[0] = rbrew_read32(cpu->mem, _t190);
-        /* 022370B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022370B4 */ _t191 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022370B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022370B4 */ _t191 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022370B4 */ _t192 = _t191 & 0x00000001u;
         /* 022370B4 */ if (_t192) goto L_022370C8; else goto L_022370B8;
   L_022370B8: ; // 0x22370b8
-        /* 022370B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 022370BC */ _t193 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022370B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 022370BC */ _t193 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022370BC */ _t194 = _t193 & 0x00000001u;
         /* 022370BC */ if (_t194) goto L_022370C0; else goto L_022371D4;
   L_022370C0: ; // 0x22370c0
-        /* 022370C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000002u);
-        /* 022370C4 */ _t195 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022370C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000002u));
+        /* 022370C4 */ _t195 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022370C4 */ _t196 = _t195 & 0x00000001u;
         /* 022370C4 */ if (_t196) goto L_022371D4; else goto L_022370C8;
   L_022370C8: ; // 0x22370c8
@@ -3179,9 +3179,9 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 022370E4 */ cpu->r[11] = cpu->r[22] + cpu->r[0];
         /* 022370E8 */ _t201 = cpu->r[11] + 0x00000104u;
         /* 022370E8 */ cpu->r[4] = rbrew_read8(cpu->mem, _t201);
-        /* 022370EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 022370EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 022370F0 */ cpu->r[7] = cpu->r[3];
-        /* 022370F4 */ _t202 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022370F4 */ _t202 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022370F4 */ _t203 = _t202 & 0x00000001u;
         /* 022370F4 */ if (_t203) goto L_022371D4; else goto L_022370F8;
   L_022370F8: ; // 0x22370f8
@@ -3190,8 +3190,8 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 02237100 */ cpu->r[3] = cpu->r[22];
         /* 02237104 */ Gambit_fn_021F000C(cpu);
         /* 02237108 */ cpu->r[20] = cpu->r[3];
-        /* 02237108 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[20], 0x00000000u);
-        /* 0223710C */ _t204 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02237108 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[20], 0x00000000u));
+        /* 0223710C */ _t204 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223710C */ _t205 = _t204 & 0x00000001u;
         /* 0223710C */ if (_t205) goto L_022371D4; else goto L_02237110;
   L_02237110: ; // 0x2237110
@@ -3201,10 +3201,10 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 02237114 */ cpu->r[7] = rbrew_read8(cpu->mem, _t207);
         /* 02237118 */ _t208 = cpu->r[5] + 0x0000025Cu;
         /* 02237118 */ cpu->r[0] = rbrew_read32(cpu->mem, _t208);
-        /* 0223711C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0223711C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02237120 */ cpu->r[3] = cpu->r[31];
         /* 02237124 */ cpu->ctr = cpu->r[0];
-        /* 02237128 */ _t209 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02237128 */ _t209 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237128 */ _t210 = _t209 & 0x00000001u;
         /* 02237128 */ if (_t210) goto L_02237188; else goto L_0223712C;
   L_0223712C: ; // 0x223712c
@@ -3232,9 +3232,9 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 02237170 */ cpu->r[7] = cpu->r[1] + 0x0000001Cu;
         /* 02237174 */ Gambit_fn_0223A5D0(cpu);
         /* 02237178 */ cpu->r[24] = cpu->r[24] + 0xFFFFFFFFu;
-        /* 02237178 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 02237178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 0223717C */ cpu->r[23] = cpu->r[23] + 0x00000001u;
-        /* 02237180 */ _t215 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02237180 */ _t215 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237180 */ _t216 = _t215 & 0x00000001u;
         /* 02237180 */ if (_t216) goto L_02237184; else goto L_02236DB0;
   L_02237184: ; // 0x2237184
@@ -3265,14 +3265,14 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 022371D0 */ Gambit_fn_0223A5FC(cpu);
   L_022371D4: ; // 0x22371d4
         /* 022371D4 */ cpu->r[24] = cpu->r[24] + 0xFFFFFFFFu;
-        /* 022371D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 022371D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 022371D8 */ cpu->r[23] = cpu->r[23] + 0x00000001u;
-        /* 022371DC */ _t221 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022371DC */ _t221 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022371DC */ _t222 = _t221 & 0x00000001u;
         /* 022371DC */ if (_t222) goto L_022371E0; else goto L_02236DB0;
   L_022371E0: ; // 0x22371e0
-        /* 022371E0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[23], cpu->f[28]);
-        /* 022371E4 */ _t223 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022371E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[23], cpu->f[28]));
+        /* 022371E4 */ _t223 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022371E4 */ _t224 = _t223 & 0x00000001u;
         /* 022371E4 */ if (_t224) goto L_02237580; else goto L_022371E8;
   L_022371E8: ; // 0x22371e8
@@ -3305,10 +3305,10 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 02237234 */ _t232 = cpu->r[10] + 0x00001F28u;
         /* 02237234 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t232);
         /* 02237238 */ cpu->r[9] = 0x10050000u;
-        /* 0223723C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[28]);
+        /* 0223723C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[28]));
         /* 02237240 */ _t233 = cpu->r[9] + 0x00001F9Cu;
         /* 02237240 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t233);
-        /* 02237244 */ _t234 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02237244 */ _t234 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02237244 */ _t235 = _t234 & 0x00000001u;
         /* 02237244 */ if (_t235) goto L_02237248; else goto L_02237278;
   L_02237248: ; // 0x2237248
@@ -3353,10 +3353,10 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 022372AC */ cpu->f[0] = cpu->f[11] - cpu->f[13];
         /* 022372B0 */ cpu->f[6] = cpu->f[6] * cpu->f[6];
         /* 022372B4 */ cpu->f[11] = fma(cpu->f[0], cpu->f[0], cpu->f[6]);
-        /* 022372B8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[28]);
+        /* 022372B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[28]));
         /* 022372BC */ _t248 = cpu->r[1] + 0x00000070u;
         /* 022372BC */ rbrew_write_f32(cpu->mem, _t248, cpu->f[12]);
-        /* 022372C0 */ _t249 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022372C0 */ _t249 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022372C0 */ _t250 = _t249 & 0x00000001u;
         /* 022372C0 */ if (_t250) goto L_02237308; else goto L_022372C4;
   L_022372C4: ; // 0x22372c4
@@ -3380,8 +3380,8 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 022372F0 */ cpu->f[10] = cpu->f[7] - cpu->f[8];
         /* 022372F4 */ cpu->f[11] = cpu->f[11] * cpu->f[11];
         /* 022372F8 */ cpu->f[9] = fma(cpu->f[10], cpu->f[10], cpu->f[11]);
-        /* 022372FC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[28]);
-        /* 02237300 */ _t257 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022372FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[28]));
+        /* 02237300 */ _t257 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02237300 */ _t258 = _t257 & 0x00000001u;
         /* 02237300 */ if (_t258) goto L_022373F4; else goto L_02237304;
   L_02237304: ; // 0x2237304
@@ -3414,8 +3414,8 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 02237348 */ cpu->f[10] = cpu->f[7] - cpu->f[8];
         /* 0223734C */ cpu->f[11] = cpu->f[11] * cpu->f[11];
         /* 02237350 */ cpu->f[9] = fma(cpu->f[10], cpu->f[10], cpu->f[11]);
-        /* 02237354 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[28]);
-        /* 02237358 */ _t267 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02237354 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[28]));
+        /* 02237358 */ _t267 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02237358 */ _t268 = _t267 & 0x00000001u;
         /* 02237358 */ if (_t268) goto L_022373F4; else goto L_0223735C;
   L_0223735C: ; // 0x223735c
@@ -3472,10 +3472,10 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 022373DC */ cpu->f[1] = cpu->f[13] + cpu->f[6];
         /* 022373E0 */ _t287 = cpu->r[1] + 0x000000B4u;
         /* 022373E0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t287);
-        /* 022373E4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[28]);
+        /* 022373E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[28]));
         /* 022373E8 */ _t288 = cpu->r[1] + 0x000000D4u;
         /* 022373E8 */ rbrew_write32(cpu->mem, _t288, cpu->r[0]);
-        /* 022373EC */ _t289 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022373EC */ _t289 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022373EC */ _t290 = _t289 & 0x00000001u;
         /* 022373EC */ if (_t290) goto L_02237580; else goto L_022373F0;
   L_022373F0: ; // 0x22373f0
@@ -3541,10 +3541,10 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 02237488 */ cpu->f[1] = cpu->f[13] + cpu->f[6];
         /* 0223748C */ _t311 = cpu->r[1] + 0x000000B4u;
         /* 0223748C */ cpu->r[0] = rbrew_read32(cpu->mem, _t311);
-        /* 02237490 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[28]);
+        /* 02237490 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[28]));
         /* 02237494 */ _t312 = cpu->r[1] + 0x000000D4u;
         /* 02237494 */ rbrew_write32(cpu->mem, _t312, cpu->r[0]);
-        /* 02237498 */ _t313 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02237498 */ _t313 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02237498 */ _t314 = _t313 & 0x00000001u;
         /* 02237498 */ if (_t314) goto L_02237580; else goto L_0223749C;
   L_0223749C: ; // 0x223749c
@@ -3571,7 +3571,7 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 022374D0 */ rbrew_write_f32(cpu->mem, _t321, cpu->f[10]);
         /* 022374D4 */ _t322 = cpu->r[1] + 0x000000C0u;
         /* 022374D4 */ cpu->r[6] = rbrew_read32(cpu->mem, _t322);
-        /* 022374D8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[28]);
+        /* 022374D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[28]));
         /* 022374DC */ _t323 = cpu->r[1] + 0x000000E0u;
         /* 022374DC */ rbrew_write32(cpu->mem, _t323, cpu->r[10]);
         /* 022374E0 */ cpu->r[10] = 0x00040000u;
@@ -3580,7 +3580,7 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 022374E8 */ cpu->r[10] = cpu->r[10] + 0x0000000Au;
         /* 022374EC */ _t325 = cpu->r[1] + 0x000000E8u;
         /* 022374EC */ rbrew_write32(cpu->mem, _t325, cpu->r[6]);
-        /* 022374F0 */ _t326 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022374F0 */ _t326 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022374F0 */ _t327 = _t326 & 0x00000001u;
         /* 022374F0 */ if (_t327) goto L_02237530; else goto L_022374F4;
   L_022374F4: ; // 0x22374f4
@@ -3597,10 +3597,10 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 02237518 */ cpu->r[10] = cpu->r[5];
         /* 0223751C */ Gambit_fn_0204A4DC(cpu);
         /* 02237520 */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02237520 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02237520 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02237524 */ _t329 = cpu->r[31] + 0x000001D4u;
         /* 02237524 */ rbrew_write32(cpu->mem, _t329, cpu->r[3]);
-        /* 02237528 */ _t330 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02237528 */ _t330 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237528 */ _t331 = _t330 & 0x00000001u;
         /* 02237528 */ if (_t331) goto L_02237580; else goto L_0223752C;
   L_0223752C: ; // 0x223752c
@@ -3618,10 +3618,10 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 02237550 */ cpu->r[7] = 0x000011FFu;
         /* 02237554 */ Gambit_fn_0204A864(cpu);
         /* 02237558 */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02237558 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02237558 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0223755C */ _t333 = cpu->r[31] + 0x000001D4u;
         /* 0223755C */ rbrew_write32(cpu->mem, _t333, cpu->r[3]);
-        /* 02237560 */ _t334 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02237560 */ _t334 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237560 */ _t335 = _t334 & 0x00000001u;
         /* 02237560 */ if (_t335) goto L_02237580; else goto L_02237564;
   L_02237564: ; // 0x2237564
@@ -3630,8 +3630,8 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 02237568 */ _t337 = cpu->r[5] + 0x0000015Cu;
         /* 02237568 */ cpu->r[8] = rbrew_read32(cpu->mem, _t337);
         /* 0223756C */ cpu->r[6] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 0223756C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 02237570 */ _t338 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223756C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 02237570 */ _t338 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237570 */ _t339 = _t338 & 0x00000001u;
         /* 02237570 */ if (_t339) goto L_02237580; else goto L_02237574;
   L_02237574: ; // 0x2237574
@@ -3700,7 +3700,7 @@ void Gambit_fn_02236B20(CPUState* cpu) {
         /* 022375F4 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t368);
         /* 022375F8 */ _t369 = cpu->r[1] + 0x000001A0u;
         /* 022375F8 */ cpu->f[25] = rbrew_read_f64(cpu->mem, _t369);
-        /* 022375FC */ _t370 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022375FC */ _t370 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022375FC */ _t371 = _t370 & 0x00000001u;
         /* 022375FC */ if (_t371) goto L_02237600; // else: addr-0 trap, fall-through
   L_02237600: ; // 0x2237600
@@ -3750,9 +3750,9 @@ void Gambit_fn_02237610(CPUState* cpu) {
         /* 0223765C */ cpu->f[1] = cpu->f[13] - cpu->f[31];
         /* 02237660 */ _t11 = cpu->r[12] + 0x00001F20u;
         /* 02237660 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t11);
-        /* 02237664 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
+        /* 02237664 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
         /* 02237668 */ cpu->r[3] = cpu->r[31];
-        /* 0223766C */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223766C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223766C */ _t13 = _t12 & 0x00000001u;
         /* 0223766C */ if (_t13) goto L_02237670; else goto L_022376D8;
   L_02237670: ; // 0x2237670
@@ -3772,8 +3772,8 @@ void Gambit_fn_02237610(CPUState* cpu) {
         /* 02237694 */ cpu->r[10] = rbrew_read32(cpu->mem, _t17);
         /* 02237698 */ _t18 = cpu->r[31] + 0x0000002Cu;
         /* 02237698 */ cpu->r[0] = rbrew_read32(cpu->mem, _t18);
-        /* 0223769C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[10]);
-        /* 022376A0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223769C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[10]));
+        /* 022376A0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022376A0 */ _t20 = _t19 & 0x00000001u;
         /* 022376A0 */ if (_t20) goto L_022376A4; else goto L_022376E8;
   L_022376A4: ; // 0x22376a4
@@ -3790,7 +3790,7 @@ void Gambit_fn_02237610(CPUState* cpu) {
         /* 022376BC */ cpu->r[31] = rbrew_read32(cpu->mem, _t24);
         /* 022376C0 */ _t25 = cpu->r[1] + 0x00000018u;
         /* 022376C0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t25);
-        /* 022376C4 */ _t26 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022376C4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022376C4 */ _t27 = _t26 & 0x00000001u;
         /* 022376C4 */ if (_t27) goto L_022376C8; // else: addr-0 trap, fall-through
   L_022376C8: ; // 0x22376c8
@@ -3812,7 +3812,7 @@ void Gambit_fn_02237610(CPUState* cpu) {
         /* 022376EC */ cpu->r[31] = rbrew_read32(cpu->mem, _t31);
         /* 022376F0 */ _t32 = cpu->r[1] + 0x00000018u;
         /* 022376F0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t32);
-        /* 022376F4 */ _t33 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022376F4 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022376F4 */ _t34 = _t33 & 0x00000001u;
         /* 022376F4 */ if (_t34) goto L_022376F8; // else: addr-0 trap, fall-through
   L_022376F8: ; // 0x22376f8
@@ -3861,9 +3861,9 @@ void Gambit_fn_02237614(CPUState* cpu) {
         /* 0223765C */ cpu->f[1] = cpu->f[13] - cpu->f[31];
         /* 02237660 */ _t11 = cpu->r[12] + 0x00001F20u;
         /* 02237660 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t11);
-        /* 02237664 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[0]);
+        /* 02237664 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[0]));
         /* 02237668 */ cpu->r[3] = cpu->r[31];
-        /* 0223766C */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223766C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223766C */ _t13 = _t12 & 0x00000001u;
         /* 0223766C */ if (_t13) goto L_02237670; else goto L_022376D8;
   L_02237670: ; // 0x2237670
@@ -3883,8 +3883,8 @@ void Gambit_fn_02237614(CPUState* cpu) {
         /* 02237694 */ cpu->r[10] = rbrew_read32(cpu->mem, _t17);
         /* 02237698 */ _t18 = cpu->r[31] + 0x0000002Cu;
         /* 02237698 */ cpu->r[0] = rbrew_read32(cpu->mem, _t18);
-        /* 0223769C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[10]);
-        /* 022376A0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223769C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[10]));
+        /* 022376A0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022376A0 */ _t20 = _t19 & 0x00000001u;
         /* 022376A0 */ if (_t20) goto L_022376A4; else goto L_022376E8;
   L_022376A4: ; // 0x22376a4
@@ -3901,7 +3901,7 @@ void Gambit_fn_02237614(CPUState* cpu) {
         /* 022376BC */ cpu->r[31] = rbrew_read32(cpu->mem, _t24);
         /* 022376C0 */ _t25 = cpu->r[1] + 0x00000018u;
         /* 022376C0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t25);
-        /* 022376C4 */ _t26 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022376C4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022376C4 */ _t27 = _t26 & 0x00000001u;
         /* 022376C4 */ if (_t27) goto L_022376C8; // else: addr-0 trap, fall-through
   L_022376C8: ; // 0x22376c8
@@ -3923,7 +3923,7 @@ void Gambit_fn_02237614(CPUState* cpu) {
         /* 022376EC */ cpu->r[31] = rbrew_read32(cpu->mem, _t31);
         /* 022376F0 */ _t32 = cpu->r[1] + 0x00000018u;
         /* 022376F0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t32);
-        /* 022376F4 */ _t33 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022376F4 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022376F4 */ _t34 = _t33 & 0x00000001u;
         /* 022376F4 */ if (_t34) goto L_022376F8; // else: addr-0 trap, fall-through
   L_022376F8: ; // 0x22376f8
@@ -3966,28 +3966,28 @@ void Gambit_fn_0223770C(CPUState* cpu) {
         /* 02237734 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02237738 */ _t7 = cpu->r[31] + 0x0000001Cu;
         /* 02237738 */ cpu->r[0] = rbrew_read32(cpu->mem, _t7);
-        /* 0223773C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02237740 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223773C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02237740 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237740 */ _t9 = _t8 & 0x00000001u;
         /* 02237740 */ if (_t9) goto L_0223774C; else goto L_02237744;
   L_02237744: ; // 0x2237744
-        /* 02237744 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 02237748 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02237744 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 02237748 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237748 */ _t11 = _t10 & 0x00000001u;
         /* 02237748 */ if (_t11) goto L_0223774C; else goto L_022377C0;
   L_0223774C: ; // 0x223774c
         /* 0223774C */ _t12 = cpu->r[31] + 0x00000184u;
         /* 0223774C */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
         /* 02237750 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000014u, 0x00000015u);
-        /* 02237750 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02237754 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02237750 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02237754 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237754 */ _t14 = _t13 & 0x00000001u;
         /* 02237754 */ if (_t14) goto L_022377C0; else goto L_02237758;
   L_02237758: ; // 0x2237758
         /* 02237758 */ _t15 = cpu->r[31] + 0x00000188u;
         /* 02237758 */ cpu->r[9] = rbrew_read32(cpu->mem, _t15);
-        /* 0223775C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02237760 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223775C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02237760 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237760 */ _t17 = _t16 & 0x00000001u;
         /* 02237760 */ if (_t17) goto L_02237774; else goto L_02237764;
   L_02237764: ; // 0x2237764
@@ -3995,8 +3995,8 @@ void Gambit_fn_0223770C(CPUState* cpu) {
         /* 02237764 */ cpu->r[10] = rbrew_read32(cpu->mem, _t18);
         /* 02237768 */ _t19 = cpu->r[31] + 0x0000018Cu;
         /* 02237768 */ cpu->r[11] = rbrew_read32(cpu->mem, _t19);
-        /* 0223776C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[11]);
-        /* 02237770 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223776C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[11]));
+        /* 02237770 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237770 */ _t21 = _t20 & 0x00000001u;
         /* 02237770 */ if (_t21) goto L_0223778C; else goto L_02237774;
   L_02237774: ; // 0x2237774
@@ -4010,8 +4010,8 @@ void Gambit_fn_0223770C(CPUState* cpu) {
   L_0223778C: ; // 0x223778c
         /* 0223778C */ _t23 = cpu->r[31] + 0x00000194u;
         /* 0223778C */ cpu->r[10] = rbrew_read32(cpu->mem, _t23);
-        /* 02237790 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02237794 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02237790 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02237794 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237794 */ _t25 = _t24 & 0x00000001u;
         /* 02237794 */ if (_t25) goto L_022377A8; else goto L_02237798;
   L_02237798: ; // 0x2237798
@@ -4019,8 +4019,8 @@ void Gambit_fn_0223770C(CPUState* cpu) {
         /* 02237798 */ cpu->r[12] = rbrew_read32(cpu->mem, _t26);
         /* 0223779C */ _t27 = cpu->r[31] + 0x00000198u;
         /* 0223779C */ cpu->r[0] = rbrew_read32(cpu->mem, _t27);
-        /* 022377A0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
-        /* 022377A4 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022377A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
+        /* 022377A4 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022377A4 */ _t29 = _t28 & 0x00000001u;
         /* 022377A4 */ if (_t29) goto L_022377C0; else goto L_022377A8;
   L_022377A8: ; // 0x22377a8
@@ -4041,13 +4041,13 @@ void Gambit_fn_0223770C(CPUState* cpu) {
         /* 022377D0 */ Gambit_fn_0222C128(cpu);
         /* 022377D4 */ _t33 = cpu->r[31] + 0x0000001Cu;
         /* 022377D4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t33);
-        /* 022377D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 022377DC */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022377D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 022377DC */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022377DC */ _t35 = _t34 & 0x00000001u;
         /* 022377DC */ if (_t35) goto L_022377E8; else goto L_022377E0;
   L_022377E0: ; // 0x22377e0
-        /* 022377E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 022377E4 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022377E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 022377E4 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022377E4 */ _t37 = _t36 & 0x00000001u;
         /* 022377E4 */ if (_t37) goto L_022377E8; else goto L_0223791C;
   L_022377E8: ; // 0x22377e8
@@ -4093,10 +4093,10 @@ void Gambit_fn_0223770C(CPUState* cpu) {
         /* 0223784C */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t51);
         /* 02237850 */ _t52 = cpu->r[12] + 0x00001F24u;
         /* 02237850 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t52);
-        /* 02237854 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02237854 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02237858 */ _t53 = cpu->r[31] + 0x00000134u;
         /* 02237858 */ rbrew_write_f32(cpu->mem, _t53, cpu->f[1]);
-        /* 0223785C */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223785C */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223785C */ _t55 = _t54 & 0x00000001u;
         /* 0223785C */ if (_t55) goto L_02237860; else goto L_022378E4;
   L_02237860: ; // 0x2237860
@@ -4124,8 +4124,8 @@ void Gambit_fn_0223770C(CPUState* cpu) {
         /* 02237898 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t62);
         /* 0223789C */ cpu->f[10] = cpu->f[0] * cpu->f[12];
         /* 022378A0 */ cpu->f[11] = cpu->f[10] + cpu->f[31];
-        /* 022378A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
-        /* 022378A8 */ _t63 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022378A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
+        /* 022378A8 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022378A8 */ _t64 = _t63 & 0x00000001u;
         /* 022378A8 */ if (_t64) goto L_022378AC; else goto L_022378B0;
   L_022378AC: ; // 0x22378ac
@@ -4180,7 +4180,7 @@ void Gambit_fn_0223770C(CPUState* cpu) {
         /* 02237928 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t78);
         /* 0223792C */ _t79 = cpu->r[1] + 0x00000018u;
         /* 0223792C */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t79);
-        /* 02237930 */ _t80 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02237930 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02237930 */ _t81 = _t80 & 0x00000001u;
         /* 02237930 */ if (_t81) goto L_02237934; // else: addr-0 trap, fall-through
   L_02237934: ; // 0x2237934
@@ -4216,28 +4216,28 @@ void Gambit_fn_02237710(CPUState* cpu) {
         /* 02237734 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02237738 */ _t7 = cpu->r[31] + 0x0000001Cu;
         /* 02237738 */ cpu->r[0] = rbrew_read32(cpu->mem, _t7);
-        /* 0223773C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02237740 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223773C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02237740 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237740 */ _t9 = _t8 & 0x00000001u;
         /* 02237740 */ if (_t9) goto L_0223774C; else goto L_02237744;
   L_02237744: ; // 0x2237744
-        /* 02237744 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 02237748 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02237744 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 02237748 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237748 */ _t11 = _t10 & 0x00000001u;
         /* 02237748 */ if (_t11) goto L_0223774C; else goto L_022377C0;
   L_0223774C: ; // 0x223774c
         /* 0223774C */ _t12 = cpu->r[31] + 0x00000184u;
         /* 0223774C */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
         /* 02237750 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000014u, 0x00000015u);
-        /* 02237750 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02237754 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02237750 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02237754 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237754 */ _t14 = _t13 & 0x00000001u;
         /* 02237754 */ if (_t14) goto L_022377C0; else goto L_02237758;
   L_02237758: ; // 0x2237758
         /* 02237758 */ _t15 = cpu->r[31] + 0x00000188u;
         /* 02237758 */ cpu->r[9] = rbrew_read32(cpu->mem, _t15);
-        /* 0223775C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02237760 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223775C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02237760 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237760 */ _t17 = _t16 & 0x00000001u;
         /* 02237760 */ if (_t17) goto L_02237774; else goto L_02237764;
   L_02237764: ; // 0x2237764
@@ -4245,8 +4245,8 @@ void Gambit_fn_02237710(CPUState* cpu) {
         /* 02237764 */ cpu->r[10] = rbrew_read32(cpu->mem, _t18);
         /* 02237768 */ _t19 = cpu->r[31] + 0x0000018Cu;
         /* 02237768 */ cpu->r[11] = rbrew_read32(cpu->mem, _t19);
-        /* 0223776C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[11]);
-        /* 02237770 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223776C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[11]));
+        /* 02237770 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237770 */ _t21 = _t20 & 0x00000001u;
         /* 02237770 */ if (_t21) goto L_0223778C; else goto L_02237774;
   L_02237774: ; // 0x2237774
@@ -4260,8 +4260,8 @@ void Gambit_fn_02237710(CPUState* cpu) {
   L_0223778C: ; // 0x223778c
         /* 0223778C */ _t23 = cpu->r[31] + 0x00000194u;
         /* 0223778C */ cpu->r[10] = rbrew_read32(cpu->mem, _t23);
-        /* 02237790 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02237794 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02237790 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02237794 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237794 */ _t25 = _t24 & 0x00000001u;
         /* 02237794 */ if (_t25) goto L_022377A8; else goto L_02237798;
   L_02237798: ; // 0x2237798
@@ -4269,8 +4269,8 @@ void Gambit_fn_02237710(CPUState* cpu) {
         /* 02237798 */ cpu->r[12] = rbrew_read32(cpu->mem, _t26);
         /* 0223779C */ _t27 = cpu->r[31] + 0x00000198u;
         /* 0223779C */ cpu->r[0] = rbrew_read32(cpu->mem, _t27);
-        /* 022377A0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
-        /* 022377A4 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022377A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
+        /* 022377A4 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022377A4 */ _t29 = _t28 & 0x00000001u;
         /* 022377A4 */ if (_t29) goto L_022377C0; else goto L_022377A8;
   L_022377A8: ; // 0x22377a8
@@ -4291,13 +4291,13 @@ void Gambit_fn_02237710(CPUState* cpu) {
         /* 022377D0 */ Gambit_fn_0222C128(cpu);
         /* 022377D4 */ _t33 = cpu->r[31] + 0x0000001Cu;
         /* 022377D4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t33);
-        /* 022377D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 022377DC */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022377D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 022377DC */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022377DC */ _t35 = _t34 & 0x00000001u;
         /* 022377DC */ if (_t35) goto L_022377E8; else goto L_022377E0;
   L_022377E0: ; // 0x22377e0
-        /* 022377E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 022377E4 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022377E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 022377E4 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022377E4 */ _t37 = _t36 & 0x00000001u;
         /* 022377E4 */ if (_t37) goto L_022377E8; else goto L_0223791C;
   L_022377E8: ; // 0x22377e8
@@ -4343,10 +4343,10 @@ void Gambit_fn_02237710(CPUState* cpu) {
         /* 0223784C */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t51);
         /* 02237850 */ _t52 = cpu->r[12] + 0x00001F24u;
         /* 02237850 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t52);
-        /* 02237854 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02237854 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02237858 */ _t53 = cpu->r[31] + 0x00000134u;
         /* 02237858 */ rbrew_write_f32(cpu->mem, _t53, cpu->f[1]);
-        /* 0223785C */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223785C */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223785C */ _t55 = _t54 & 0x00000001u;
         /* 0223785C */ if (_t55) goto L_02237860; else goto L_022378E4;
   L_02237860: ; // 0x2237860
@@ -4374,8 +4374,8 @@ void Gambit_fn_02237710(CPUState* cpu) {
         /* 02237898 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t62);
         /* 0223789C */ cpu->f[10] = cpu->f[0] * cpu->f[12];
         /* 022378A0 */ cpu->f[11] = cpu->f[10] + cpu->f[31];
-        /* 022378A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[31]);
-        /* 022378A8 */ _t63 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022378A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[31]));
+        /* 022378A8 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022378A8 */ _t64 = _t63 & 0x00000001u;
         /* 022378A8 */ if (_t64) goto L_022378AC; else goto L_022378B0;
   L_022378AC: ; // 0x22378ac
@@ -4430,7 +4430,7 @@ void Gambit_fn_02237710(CPUState* cpu) {
         /* 02237928 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t78);
         /* 0223792C */ _t79 = cpu->r[1] + 0x00000018u;
         /* 0223792C */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t79);
-        /* 02237930 */ _t80 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02237930 */ _t80 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02237930 */ _t81 = _t80 & 0x00000001u;
         /* 02237930 */ if (_t81) goto L_02237934; // else: addr-0 trap, fall-through
   L_02237934: ; // 0x2237934
@@ -4498,8 +4498,8 @@ void Gambit_fn_02237944(CPUState* cpu) {
         /* 022379B8 */ cpu->f[0] = cpu->f[0] - cpu->f[30];
         /* 022379BC */ _t18 = cpu->r[7] + 0x00001F20u;
         /* 022379BC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t18);
-        /* 022379C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[31]);
-        /* 022379C4 */ _t19 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022379C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[31]));
+        /* 022379C4 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022379C4 */ _t20 = _t19 & 0x00000001u;
         /* 022379C4 */ if (_t20) goto L_022379C8; else goto L_02237A44;
   L_022379C8: ; // 0x22379c8
@@ -4544,10 +4544,10 @@ void Gambit_fn_02237944(CPUState* cpu) {
         /* 02237A28 */ cpu->f[8] = fma(cpu->f[10], cpu->f[10], cpu->f[0]);
         /* 02237A2C */ cpu->f[13] = fma(cpu->f[7], cpu->f[7], cpu->f[8]);
         /* 02237A30 */ cpu->r[12] = 0x10050000u;
-        /* 02237A34 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[31]);
+        /* 02237A34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[31]));
         /* 02237A38 */ _t35 = cpu->r[12] + 0x00001F30u;
         /* 02237A38 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t35);
-        /* 02237A3C */ _t36 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02237A3C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02237A3C */ _t37 = _t36 & 0x00000001u;
         /* 02237A3C */ if (_t37) goto L_02237A40; else goto L_02237AE4;
   L_02237A40: ; // 0x2237a40
@@ -4555,8 +4555,8 @@ void Gambit_fn_02237944(CPUState* cpu) {
   L_02237A44: ; // 0x2237a44
         /* 02237A44 */ _t38 = cpu->r[30] + 0x00000134u;
         /* 02237A44 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t38);
-        /* 02237A48 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[11]);
-        /* 02237A4C */ _t39 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02237A48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[11]));
+        /* 02237A4C */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02237A4C */ _t40 = _t39 & 0x00000001u;
         /* 02237A4C */ if (_t40) goto L_02237A50; else goto L_02237A58;
   L_02237A50: ; // 0x2237a50
@@ -4592,10 +4592,10 @@ void Gambit_fn_02237944(CPUState* cpu) {
         /* 02237A94 */ cpu->f[8] = fma(cpu->f[10], cpu->f[10], cpu->f[0]);
         /* 02237A98 */ cpu->f[13] = fma(cpu->f[7], cpu->f[7], cpu->f[8]);
         /* 02237A9C */ cpu->r[12] = 0x10050000u;
-        /* 02237AA0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[31]);
+        /* 02237AA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[31]));
         /* 02237AA4 */ _t52 = cpu->r[12] + 0x00001F30u;
         /* 02237AA4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t52);
-        /* 02237AA8 */ _t53 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02237AA8 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02237AA8 */ _t54 = _t53 & 0x00000001u;
         /* 02237AA8 */ if (_t54) goto L_02237AAC; else goto L_02237AE4;
   L_02237AAC: ; // 0x2237aac
@@ -4623,14 +4623,14 @@ void Gambit_fn_02237944(CPUState* cpu) {
         /* 02237AE8 */ _t60 = cpu->r[7] + 0x00001FBCu;
         /* 02237AE8 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t60);
         /* 02237AEC */ cpu->r[9] = 0x101F0000u;
-        /* 02237AF0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[13]);
+        /* 02237AF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[13]));
         /* 02237AF4 */ cpu->r[9] = cpu->r[9] + 0x00006350u;
-        /* 02237AF8 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02237AF8 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02237AF8 */ _t62 = _t61 & 0x00000001u;
         /* 02237AF8 */ if (_t62) goto L_02237B04; else goto L_02237AFC;
   L_02237AFC: ; // 0x2237afc
-        /* 02237AFC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 02237B00 */ _t63 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02237AFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 02237B00 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02237B00 */ _t64 = _t63 & 0x00000001u;
         /* 02237B00 */ if (_t64) goto L_02237B04; else goto L_02237B48;
   L_02237B04: ; // 0x2237b04
@@ -4654,8 +4654,8 @@ void Gambit_fn_02237944(CPUState* cpu) {
         /* 02237B34 */ Gambit_fn_027B8224(cpu);
         /* 02237B38 */ _t70 = cpu->r[30] + 0x000001C8u;
         /* 02237B38 */ cpu->r[31] = rbrew_read32(cpu->mem, _t70);
-        /* 02237B3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02237B40 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02237B3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02237B40 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237B40 */ _t72 = _t71 & 0x00000001u;
         /* 02237B40 */ if (_t72) goto L_02237B44; else goto L_02237BD0;
   L_02237B44: ; // 0x2237b44
@@ -4714,8 +4714,8 @@ void Gambit_fn_02237944(CPUState* cpu) {
         /* 02237BC0 */ Gambit_fn_027B8224(cpu);
         /* 02237BC4 */ _t93 = cpu->r[30] + 0x000001C8u;
         /* 02237BC4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t93);
-        /* 02237BC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02237BCC */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02237BC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02237BCC */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237BCC */ _t95 = _t94 & 0x00000001u;
         /* 02237BCC */ if (_t95) goto L_02237BE0; else goto L_02237BD0;
   L_02237BD0: ; // 0x2237bd0
@@ -4723,8 +4723,8 @@ void Gambit_fn_02237944(CPUState* cpu) {
         /* 02237BD0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t96);
         /* 02237BD4 */ _t97 = cpu->r[30] + 0x000001CCu;
         /* 02237BD4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t97);
-        /* 02237BD8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[0]);
-        /* 02237BDC */ _t98 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02237BD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[0]));
+        /* 02237BDC */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237BDC */ _t99 = _t98 & 0x00000001u;
         /* 02237BDC */ if (_t99) goto L_02237BF8; else goto L_02237BE0;
   L_02237BE0: ; // 0x2237be0
@@ -4829,7 +4829,7 @@ void Gambit_fn_02237944(CPUState* cpu) {
         /* 02237CBC */ cpu->r[31] = rbrew_read32(cpu->mem, _t140);
         /* 02237CC0 */ _t141 = cpu->r[1] + 0x00000060u;
         /* 02237CC0 */ rbrew_write_f32(cpu->mem, _t141, cpu->f[0]);
-        /* 02237CC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02237CC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02237CC8 */ _t142 = cpu->r[1] + 0x00000078u;
         /* 02237CC8 */ rbrew_write_f32(cpu->mem, _t142, cpu->f[13]);
         /* 02237CCC */ _t143 = cpu->r[1] + 0x00000058u;
@@ -4844,7 +4844,7 @@ void Gambit_fn_02237944(CPUState* cpu) {
         /* 02237CDC */ rbrew_write_f32(cpu->mem, _t147, cpu->f[7]);
         /* 02237CE0 */ _t148 = cpu->r[1] + 0x00000074u;
         /* 02237CE0 */ rbrew_write_f32(cpu->mem, _t148, cpu->f[12]);
-        /* 02237CE4 */ _t149 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02237CE4 */ _t149 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237CE4 */ _t150 = _t149 & 0x00000001u;
         /* 02237CE4 */ if (_t150) goto L_02237D24; else goto L_02237CE8;
   L_02237CE8: ; // 0x2237ce8
@@ -4852,8 +4852,8 @@ void Gambit_fn_02237944(CPUState* cpu) {
         /* 02237CE8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t151);
         /* 02237CEC */ _t152 = cpu->r[30] + 0x000001CCu;
         /* 02237CEC */ cpu->r[6] = rbrew_read32(cpu->mem, _t152);
-        /* 02237CF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[6]);
-        /* 02237CF4 */ _t153 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02237CF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[6]));
+        /* 02237CF4 */ _t153 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237CF4 */ _t154 = _t153 & 0x00000001u;
         /* 02237CF4 */ if (_t154) goto L_02237CF8; else goto L_02237D24;
   L_02237CF8: ; // 0x2237cf8
@@ -4897,7 +4897,7 @@ void Gambit_fn_02237944(CPUState* cpu) {
         /* 02237D48 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t170);
         /* 02237D4C */ _t171 = cpu->r[1] + 0x000000A0u;
         /* 02237D4C */ cpu->r[30] = rbrew_read32(cpu->mem, _t171);
-        /* 02237D50 */ _t172 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02237D50 */ _t172 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02237D50 */ _t173 = _t172 & 0x00000001u;
         /* 02237D50 */ if (_t173) goto L_02237D54; // else: addr-0 trap, fall-through
   L_02237D54: ; // 0x2237d54
@@ -5009,10 +5009,10 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02237E48 */ _t34 = cpu->r[12] + 0x00001F20u;
         /* 02237E48 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t34);
         /* 02237E4C */ cpu->r[10] = 0x10050000u;
-        /* 02237E50 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[30]);
+        /* 02237E50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[30]));
         /* 02237E54 */ _t35 = cpu->r[10] + 0x00001F30u;
         /* 02237E54 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t35);
-        /* 02237E58 */ _t36 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02237E58 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02237E58 */ _t37 = _t36 & 0x00000001u;
         /* 02237E58 */ if (_t37) goto L_02237E5C; else goto L_02237E94;
   L_02237E5C: ; // 0x2237e5c
@@ -5044,10 +5044,10 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02237EA4 */ _t44 = cpu->r[7] + 0x00001F28u;
         /* 02237EA4 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t44);
         /* 02237EA8 */ cpu->r[6] = rbrew_rlwinm(cpu->r[6], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 02237EA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02237EA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 02237EAC */ _t45 = cpu->r[5] + 0x00001F24u;
         /* 02237EAC */ cpu->f[27] = rbrew_read_f32(cpu->mem, _t45);
-        /* 02237EB0 */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02237EB0 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237EB0 */ _t47 = _t46 & 0x00000001u;
         /* 02237EB0 */ if (_t47) goto L_02237EB4; else goto L_02238AA0;
   L_02237EB4: ; // 0x2237eb4
@@ -5074,13 +5074,13 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02237EEC */ cpu->f[9] = rbrew_read_f64(cpu->mem, _t53);
         /* 02237EF0 */ cpu->f[10] = cpu->f[9] - cpu->f[12];
         /* 02237EF4 */ cpu->f[8] = (double)(float)cpu->f[10];
-        /* 02237EF8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[6]);
-        /* 02237EFC */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02237EF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[6]));
+        /* 02237EFC */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02237EFC */ _t55 = _t54 & 0x00000001u;
         /* 02237EFC */ if (_t55) goto L_02237F0C; else goto L_02237F00;
   L_02237F00: ; // 0x2237f00
-        /* 02237F00 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[30]);
-        /* 02237F04 */ _t56 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02237F00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[30]));
+        /* 02237F04 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02237F04 */ _t57 = _t56 & 0x00000001u;
         /* 02237F04 */ if (_t57) goto L_02237F0C; else goto L_02237F08;
   L_02237F08: ; // 0x2237f08
@@ -5206,8 +5206,8 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238028 */ Gambit_fn_02019890(cpu);
         /* 0223802C */ _t104 = cpu->r[1] + 0x0000009Cu;
         /* 0223802C */ cpu->r[0] = rbrew_read32(cpu->mem, _t104);
-        /* 02238030 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 02238034 */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238030 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 02238034 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238034 */ _t106 = _t105 & 0x00000001u;
         /* 02238034 */ if (_t106) goto L_0223803C; else goto L_02238038;
   L_02238038: ; // 0x2238038
@@ -5215,9 +5215,9 @@ void Gambit_fn_02237D64(CPUState* cpu) {
   L_0223803C: ; // 0x223803c
         /* 0223803C */ cpu->r[25] = 0x00000000u;
         /* 02238040 */ cpu->r[27] = 0x101C0000u;
-        /* 02238044 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], cpu->r[31]);
+        /* 02238044 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], cpu->r[31]));
         /* 02238048 */ cpu->r[27] = cpu->r[27] + 0x00001EF8u;
-        /* 0223804C */ _t107 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223804C */ _t107 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223804C */ _t108 = _t107 & 0x00000001u;
         /* 0223804C */ if (_t108) goto L_02238050; else goto L_022381D8;
   L_02238050: ; // 0x2238050
@@ -5230,13 +5230,13 @@ void Gambit_fn_02237D64(CPUState* cpu) {
   L_02238064: ; // 0x2238064
         /* 02238064 */ _t110 = cpu->r[30] + 0x00000134u;
         /* 02238064 */ cpu->f[2] = rbrew_read_f32(cpu->mem, _t110);
-        /* 02238068 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[24]);
+        /* 02238068 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[24]));
         /* 0223806C */ _t111 = cpu->r[27] + 0x00000000u;
         /* 0223806C */ cpu->r[3] = rbrew_read32(cpu->mem, _t111);
         /* 02238070 */ cpu->f[3] = cpu->f[26];
         /* 02238074 */ _t112 = cpu->r[30] + 0x000000B4u;
         /* 02238074 */ cpu->r[9] = rbrew_read32(cpu->mem, _t112);
-        /* 02238078 */ _t113 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02238078 */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02238078 */ _t114 = _t113 & 0x00000001u;
         /* 02238078 */ if (_t114) goto L_022380B8; else goto L_0223807C;
   L_0223807C: ; // 0x223807c
@@ -5253,10 +5253,10 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 022380A0 */ cpu->r[8] = 0x000011FFu;
         /* 022380A4 */ Gambit_fn_0204A4DC(cpu);
         /* 022380A8 */ cpu->r[8] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022380A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 022380A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 022380AC */ _t116 = cpu->r[30] + 0x000000B0u;
         /* 022380AC */ rbrew_write32(cpu->mem, _t116, cpu->r[3]);
-        /* 022380B0 */ _t117 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022380B0 */ _t117 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022380B0 */ _t118 = _t117 & 0x00000001u;
         /* 022380B0 */ if (_t118) goto L_0223818C; else goto L_022380B4;
   L_022380B4: ; // 0x22380b4
@@ -5272,10 +5272,10 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 022380D4 */ cpu->r[7] = 0x000011FFu;
         /* 022380D8 */ Gambit_fn_0204A864(cpu);
         /* 022380DC */ cpu->r[8] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022380DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 022380DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 022380E0 */ _t119 = cpu->r[30] + 0x000000B0u;
         /* 022380E0 */ rbrew_write32(cpu->mem, _t119, cpu->r[3]);
-        /* 022380E4 */ _t120 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022380E4 */ _t120 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022380E4 */ _t121 = _t120 & 0x00000001u;
         /* 022380E4 */ if (_t121) goto L_0223818C; else goto L_022380E8;
   L_022380E8: ; // 0x22380e8
@@ -5287,10 +5287,10 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 022380F8 */ _t123 = cpu->r[28] + 0x00000168u;
         /* 022380F8 */ cpu->r[4] = rbrew_read32(cpu->mem, _t123);
         /* 022380FC */ cpu->r[12] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x00000004u, 0x00000004u);
-        /* 022380FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 022380FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02238100 */ _t124 = cpu->r[30] + 0x00000134u;
         /* 02238100 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t124);
-        /* 02238104 */ _t125 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238104 */ _t125 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238104 */ _t126 = _t125 & 0x00000001u;
         /* 02238104 */ if (_t126) goto L_02238120; else goto L_02238108;
   L_02238108: ; // 0x2238108
@@ -5298,8 +5298,8 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238108 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t127);
         /* 0223810C */ cpu->f[6] = cpu->f[7] + cpu->f[8];
         /* 02238110 */ cpu->f[29] = cpu->f[29] - cpu->f[6];
-        /* 02238114 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[24]);
-        /* 02238118 */ _t128 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02238114 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[24]));
+        /* 02238118 */ _t128 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02238118 */ _t129 = _t128 & 0x00000001u;
         /* 02238118 */ if (_t129) goto L_0223811C; else goto L_0223818C;
   L_0223811C: ; // 0x223811c
@@ -5307,8 +5307,8 @@ void Gambit_fn_02237D64(CPUState* cpu) {
   L_02238120: ; // 0x2238120
         /* 02238120 */ cpu->f[6] = cpu->f[24] + cpu->f[8];
         /* 02238124 */ cpu->f[29] = cpu->f[29] - cpu->f[6];
-        /* 02238128 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[24]);
-        /* 0223812C */ _t130 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02238128 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[24]));
+        /* 0223812C */ _t130 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223812C */ _t131 = _t130 & 0x00000001u;
         /* 0223812C */ if (_t131) goto L_02238130; else goto L_0223818C;
   L_02238130: ; // 0x2238130
@@ -5341,10 +5341,10 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238170 */ cpu->f[11] = cpu->f[11] + cpu->f[12];
         /* 02238174 */ /* nop */
         /* 02238178 */ /* nop */
-        /* 0223817C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], cpu->r[31]);
+        /* 0223817C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], cpu->r[31]));
         /* 02238180 */ _t142 = cpu->r[1] + 0x00000030u;
         /* 02238180 */ rbrew_write_f32(cpu->mem, _t142, cpu->f[11]);
-        /* 02238184 */ _t143 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02238184 */ _t143 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02238184 */ _t144 = _t143 & 0x00000001u;
         /* 02238184 */ if (_t144) goto L_02238064; else goto L_02238188;
   L_02238188: ; // 0x2238188
@@ -5375,10 +5375,10 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 022381C4 */ cpu->r[25] = cpu->r[25] + 0x00000001u;
         /* 022381C8 */ _t153 = cpu->r[1] + 0x00000028u;
         /* 022381C8 */ rbrew_write_f32(cpu->mem, _t153, cpu->f[8]);
-        /* 022381CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], cpu->r[31]);
+        /* 022381CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], cpu->r[31]));
         /* 022381D0 */ _t154 = cpu->r[1] + 0x0000002Cu;
         /* 022381D0 */ rbrew_write_f32(cpu->mem, _t154, cpu->f[9]);
-        /* 022381D4 */ _t155 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022381D4 */ _t155 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022381D4 */ _t156 = _t155 & 0x00000001u;
         /* 022381D4 */ if (_t156) goto L_02238064; else goto L_022381D8;
   L_022381D8: ; // 0x22381d8
@@ -5443,10 +5443,10 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238260 */ cpu->f[8] = cpu->f[10] - cpu->f[12];
         /* 02238264 */ cpu->f[7] = fma(cpu->f[6], cpu->f[6], cpu->f[0]);
         /* 02238268 */ cpu->f[26] = fma(cpu->f[8], cpu->f[8], cpu->f[7]);
-        /* 0223826C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[26], cpu->f[30]);
+        /* 0223826C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[26], cpu->f[30]));
         /* 02238270 */ _t181 = cpu->r[1] + 0x00000030u;
         /* 02238270 */ rbrew_write_f32(cpu->mem, _t181, cpu->f[8]);
-        /* 02238274 */ _t182 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02238274 */ _t182 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02238274 */ _t183 = _t182 & 0x00000001u;
         /* 02238274 */ if (_t183) goto L_02238278; else goto L_022382B0;
   L_02238278: ; // 0x2238278
@@ -5484,9 +5484,9 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 022382C8 */ cpu->r[0] = cpu->r[8] ^ cpu->r[11];
         /* 022382CC */ cpu->r[11] = cpu->r[0] + 0xFFFFFFFFu;
         /* 022382D0 */ cpu->r[25] = cpu->r[0] - cpu->r[11];
-        /* 022382D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 022382D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 022382D4 */ cpu->r[10] = 0x00000000u;
-        /* 022382D8 */ _t193 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022382D8 */ _t193 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022382D8 */ _t194 = _t193 & 0x00000001u;
         /* 022382D8 */ if (_t194) goto L_022382E0; else goto L_022382DC;
   L_022382DC: ; // 0x22382dc
@@ -5495,7 +5495,7 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 022382E0 */ cpu->r[12] = 0x101E0000u;
         /* 022382E4 */ _t195 = cpu->r[12] + 0xFFFF958Cu;
         /* 022382E4 */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t195);
-        /* 022382E8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[26], cpu->f[30]);
+        /* 022382E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[26], cpu->f[30]));
         /* 022382EC */ _t196 = cpu->r[27] + 0x00000000u;
         /* 022382EC */ cpu->r[3] = rbrew_read32(cpu->mem, _t196);
         /* 022382F0 */ cpu->f[3] = cpu->f[29];
@@ -5504,7 +5504,7 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 022382F8 */ cpu->r[7] = cpu->r[10] | 0x00000002u;
         /* 022382FC */ _t198 = cpu->r[30] + 0x00000134u;
         /* 022382FC */ cpu->f[2] = rbrew_read_f32(cpu->mem, _t198);
-        /* 02238300 */ _t199 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02238300 */ _t199 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02238300 */ _t200 = _t199 & 0x00000001u;
         /* 02238300 */ if (_t200) goto L_0223833C; else goto L_02238304;
   L_02238304: ; // 0x2238304
@@ -5520,10 +5520,10 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238324 */ rbrew_write32(cpu->mem, _t201, cpu->r[0]);
         /* 02238328 */ Gambit_fn_0204A4DC(cpu);
         /* 0223832C */ cpu->r[6] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0223832C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 0223832C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 02238330 */ _t202 = cpu->r[30] + 0x000000B0u;
         /* 02238330 */ rbrew_write32(cpu->mem, _t202, cpu->r[3]);
-        /* 02238334 */ _t203 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238334 */ _t203 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238334 */ _t204 = _t203 & 0x00000001u;
         /* 02238334 */ if (_t204) goto L_022386EC; else goto L_02238338;
   L_02238338: ; // 0x2238338
@@ -5539,10 +5539,10 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238358 */ cpu->r[7] = 0x000011FFu;
         /* 0223835C */ Gambit_fn_0204A864(cpu);
         /* 02238360 */ cpu->r[6] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02238360 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02238360 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 02238364 */ _t205 = cpu->r[30] + 0x000000B0u;
         /* 02238364 */ rbrew_write32(cpu->mem, _t205, cpu->r[3]);
-        /* 02238368 */ _t206 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238368 */ _t206 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238368 */ _t207 = _t206 & 0x00000001u;
         /* 02238368 */ if (_t207) goto L_022386EC; else goto L_0223836C;
   L_0223836C: ; // 0x223836c
@@ -5551,26 +5551,26 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238370 */ _t209 = cpu->r[21] + 0x0000015Cu;
         /* 02238370 */ cpu->r[10] = rbrew_read32(cpu->mem, _t209);
         /* 02238374 */ cpu->r[9] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 02238374 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02238378 */ _t210 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238374 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02238378 */ _t210 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238378 */ _t211 = _t210 & 0x00000001u;
         /* 02238378 */ if (_t211) goto L_022383EC; else goto L_0223837C;
   L_0223837C: ; // 0x223837c
         /* 0223837C */ _t212 = cpu->r[21] + 0x00000000u;
         /* 0223837C */ cpu->r[0] = rbrew_read32(cpu->mem, _t212);
         /* 02238380 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 02238380 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02238380 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02238384 */ cpu->r[31] = cpu->r[21] + 0x000000A8u;
-        /* 02238388 */ _t213 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238388 */ _t213 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238388 */ _t214 = _t213 & 0x00000001u;
         /* 02238388 */ if (_t214) goto L_022383C4; else goto L_0223838C;
   L_0223838C: ; // 0x223838c
         /* 0223838C */ cpu->r[3] = cpu->r[21] + 0x00000138u;
         /* 02238390 */ Gambit_fn_02C69350(cpu);
-        /* 02238394 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 02238394 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 02238398 */ _t215 = cpu->r[21] + 0x00000000u;
         /* 02238398 */ cpu->r[9] = rbrew_read32(cpu->mem, _t215);
-        /* 0223839C */ _t216 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223839C */ _t216 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223839C */ _t217 = _t216 & 0x00000001u;
         /* 0223839C */ if (_t217) goto L_022383A0; else goto L_022383BC;
   L_022383A0: ; // 0x22383a0
@@ -5597,8 +5597,8 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 022383D8 */ _t222 = cpu->r[1] + 0x00000068u;
         /* 022383D8 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t222);
         /* 022383DC */ cpu->f[9] = fma(cpu->f[7], cpu->f[8], cpu->f[13]);
-        /* 022383E0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[30]);
-        /* 022383E4 */ _t223 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022383E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[30]));
+        /* 022383E4 */ _t223 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022383E4 */ _t224 = _t223 & 0x00000001u;
         /* 022383E4 */ if (_t224) goto L_022383F4; else goto L_022383E8;
   L_022383E8: ; // 0x22383e8
@@ -5606,16 +5606,16 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 022383E8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t225);
   L_022383EC: ; // 0x22383ec
         /* 022383EC */ cpu->r[0] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 022383EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022383F0 */ _t226 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022383EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022383F0 */ _t226 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022383F0 */ _t227 = _t226 & 0x00000001u;
         /* 022383F0 */ if (_t227) goto L_022386EC; else goto L_022383F4;
   L_022383F4: ; // 0x22383f4
         /* 022383F4 */ cpu->r[3] = cpu->r[21];
         /* 022383F8 */ cpu->r[4] = cpu->r[30];
         /* 022383FC */ Gambit_fn_02040DBC(cpu);
-        /* 02238400 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 02238404 */ _t228 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238400 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 02238404 */ _t228 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238404 */ _t229 = _t228 & 0x00000001u;
         /* 02238404 */ if (_t229) goto L_02238658; else goto L_02238408;
   L_02238408: ; // 0x2238408
@@ -5625,8 +5625,8 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238410 */ cpu->r[7] = cpu->r[5] + 0x101E0000u;
         /* 02238414 */ _t231 = cpu->r[7] + 0xFFFF9484u;
         /* 02238414 */ cpu->r[31] = rbrew_read32(cpu->mem, _t231);
-        /* 02238418 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0223841C */ _t232 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02238418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0223841C */ _t232 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223841C */ _t233 = _t232 & 0x00000001u;
         /* 0223841C */ if (_t233) goto L_02238420; else goto L_02238658;
   L_02238420: ; // 0x2238420
@@ -5638,15 +5638,15 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238428 */ cpu->r[9] = rbrew_read32(cpu->mem, _t236);
         /* 0223842C */ _t237 = cpu->r[9] + 0x00000014u;
         /* 0223842C */ cpu->r[10] = rbrew_read32(cpu->mem, _t237);
-        /* 02238430 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02238434 */ _t238 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238430 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02238434 */ _t238 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238434 */ _t239 = _t238 & 0x00000001u;
         /* 02238434 */ if (_t239) goto L_02238658; else goto L_02238438;
   L_02238438: ; // 0x2238438
-        /* 02238438 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02238438 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0223843C */ cpu->r[24] = 0x00000000u;
         /* 02238440 */ cpu->r[23] = 0x00000001u;
-        /* 02238444 */ _t240 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02238444 */ _t240 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02238444 */ _t241 = _t240 & 0x00000001u;
         /* 02238444 */ if (_t241) goto L_0223844C; else goto L_02238448;
   L_02238448: ; // 0x2238448
@@ -5673,8 +5673,8 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238488 */ cpu->r[11] = rbrew_read32(cpu->mem, _t243);
         /* 0223848C */ _t244 = cpu->r[11] + 0x000001ACu;
         /* 0223848C */ cpu->r[25] = rbrew_read32(cpu->mem, _t244);
-        /* 02238490 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 02238494 */ _t245 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238490 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 02238494 */ _t245 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238494 */ _t246 = _t245 & 0x00000001u;
         /* 02238494 */ if (_t246) goto L_02238658; else goto L_02238498;
   L_02238498: ; // 0x2238498
@@ -5714,10 +5714,10 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 022384E0 */ rbrew_write32(cpu->mem, _t261, cpu->r[29]);
         /* 022384E4 */ _t262 = cpu->r[1] + 0x00000020u;
         /* 022384E4 */ rbrew_write32(cpu->mem, _t262, cpu->r[28]);
-        /* 022384E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[20], cpu->r[29]);
+        /* 022384E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[20], cpu->r[29]));
         /* 022384EC */ _t263 = cpu->r[1] + 0x00000018u;
         /* 022384EC */ rbrew_write32(cpu->mem, _t263, cpu->r[10]);
-        /* 022384F0 */ _t264 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022384F0 */ _t264 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022384F0 */ _t265 = _t264 & 0x00000001u;
         /* 022384F0 */ if (_t265) goto L_02238524; else goto L_022384F4;
   L_022384F4: ; // 0x22384f4
@@ -5727,27 +5727,27 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 022384FC */ _t266 = cpu->r[4] + 0x00000004u;
         /* 022384FC */ cpu->r[11] = rbrew_read32(cpu->mem, _t266);
         /* 02238500 */ cpu->r[20] = cpu->r[11] - cpu->r[28];
-        /* 02238504 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[20], cpu->r[29]);
+        /* 02238504 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[20], cpu->r[29]));
         /* 02238508 */ _t267 = cpu->r[1] + 0x0000001Cu;
         /* 02238508 */ rbrew_write32(cpu->mem, _t267, cpu->r[20]);
-        /* 0223850C */ _t268 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223850C */ _t268 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223850C */ _t269 = _t268 & 0x00000001u;
         /* 0223850C */ if (_t269) goto L_02238524; else goto L_02238510;
   L_02238510: ; // 0x2238510
         /* 02238510 */ _t270 = cpu->r[20] + 0x0000001Cu;
         /* 02238510 */ cpu->r[4] = rbrew_read32(cpu->mem, _t270);
-        /* 02238514 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000002u);
-        /* 02238518 */ _t271 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238514 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000002u));
+        /* 02238518 */ _t271 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238518 */ _t272 = _t271 & 0x00000001u;
         /* 02238518 */ if (_t272) goto L_02238524; else goto L_0223851C;
   L_0223851C: ; // 0x223851c
-        /* 0223851C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000003u);
-        /* 02238520 */ _t273 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223851C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000003u));
+        /* 02238520 */ _t273 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238520 */ _t274 = _t273 & 0x00000001u;
         /* 02238520 */ if (_t274) goto L_02238524; else goto L_022384F8;
   L_02238524: ; // 0x2238524
-        /* 02238524 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[20], cpu->r[29]);
-        /* 02238528 */ _t275 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[20], cpu->r[29]));
+        /* 02238528 */ _t275 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238528 */ _t276 = _t275 & 0x00000001u;
         /* 02238528 */ if (_t276) goto L_022385C4; else goto L_0223852C;
   L_0223852C: ; // 0x223852c
@@ -5763,16 +5763,16 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238548 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0223854C */ _t279 = cpu->r[1] + 0x00000024u;
         /* 0223854C */ cpu->r[5] = rbrew_read32(cpu->mem, _t279);
-        /* 02238550 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[25], cpu->r[5]);
-        /* 02238554 */ _t280 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238550 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[25], cpu->r[5]));
+        /* 02238554 */ _t280 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238554 */ _t281 = _t280 & 0x00000001u;
         /* 02238554 */ if (_t281) goto L_0223856C; else goto L_02238558;
   L_02238558: ; // 0x2238558
         /* 02238558 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 02238558 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02238558 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0223855C */ cpu->r[24] = cpu->r[24] + 0x00000001u;
         /* 02238560 */ cpu->r[23] = 0x00000000u;
-        /* 02238564 */ _t282 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238564 */ _t282 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238564 */ _t283 = _t282 & 0x00000001u;
         /* 02238564 */ if (_t283) goto L_02238568; else goto L_02238460;
   L_02238568: ; // 0x2238568
@@ -5782,17 +5782,17 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238570 */ _t284 = cpu->r[11] + 0x00000004u;
         /* 02238570 */ cpu->r[6] = rbrew_read32(cpu->mem, _t284);
         /* 02238574 */ cpu->r[20] = cpu->r[6] - cpu->r[28];
-        /* 02238578 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[20], cpu->r[29]);
-        /* 0223857C */ _t285 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238578 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[20], cpu->r[29]));
+        /* 0223857C */ _t285 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223857C */ _t286 = _t285 & 0x00000001u;
         /* 0223857C */ if (_t286) goto L_02238580; else goto L_02238594;
   L_02238580: ; // 0x2238580
         /* 02238580 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 02238580 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02238580 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02238584 */ cpu->r[24] = cpu->r[24] + 0x00000001u;
         /* 02238588 */ _t287 = cpu->r[1] + 0x0000001Cu;
         /* 02238588 */ rbrew_write32(cpu->mem, _t287, cpu->r[20]);
-        /* 0223858C */ _t288 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223858C */ _t288 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223858C */ _t289 = _t288 & 0x00000001u;
         /* 0223858C */ if (_t289) goto L_02238590; else goto L_02238460;
   L_02238590: ; // 0x2238590
@@ -5800,41 +5800,41 @@ void Gambit_fn_02237D64(CPUState* cpu) {
   L_02238594: ; // 0x2238594
         /* 02238594 */ _t290 = cpu->r[20] + 0x0000001Cu;
         /* 02238594 */ cpu->r[6] = rbrew_read32(cpu->mem, _t290);
-        /* 02238598 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000002u);
-        /* 0223859C */ _t291 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238598 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000002u));
+        /* 0223859C */ _t291 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223859C */ _t292 = _t291 & 0x00000001u;
         /* 0223859C */ if (_t292) goto L_022385B8; else goto L_022385A0;
   L_022385A0: ; // 0x22385a0
-        /* 022385A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000003u);
-        /* 022385A4 */ _t293 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022385A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000003u));
+        /* 022385A4 */ _t293 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022385A4 */ _t294 = _t293 & 0x00000001u;
         /* 022385A4 */ if (_t294) goto L_022385A8; else goto L_0223856C;
   L_022385A8: ; // 0x22385a8
-        /* 022385A8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[20], cpu->r[29]);
+        /* 022385A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[20], cpu->r[29]));
         /* 022385AC */ _t295 = cpu->r[1] + 0x0000001Cu;
         /* 022385AC */ rbrew_write32(cpu->mem, _t295, cpu->r[20]);
-        /* 022385B0 */ _t296 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022385B0 */ _t296 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022385B0 */ _t297 = _t296 & 0x00000001u;
         /* 022385B0 */ if (_t297) goto L_022385B4; else goto L_0223852C;
   L_022385B4: ; // 0x22385b4
         /* 022385B4 */ goto L_022385C4;
   L_022385B8: ; // 0x22385b8
-        /* 022385B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[20], cpu->r[29]);
+        /* 022385B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[20], cpu->r[29]));
         /* 022385BC */ _t298 = cpu->r[1] + 0x0000001Cu;
         /* 022385BC */ rbrew_write32(cpu->mem, _t298, cpu->r[20]);
-        /* 022385C0 */ _t299 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022385C0 */ _t299 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022385C0 */ _t300 = _t299 & 0x00000001u;
         /* 022385C0 */ if (_t300) goto L_022385C4; else goto L_0223852C;
   L_022385C4: ; // 0x22385c4
         /* 022385C4 */ cpu->r[31] = cpu->r[31] + 0xFFFFFFFFu;
-        /* 022385C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 022385C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 022385C8 */ cpu->r[24] = cpu->r[24] + 0x00000001u;
-        /* 022385CC */ _t301 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022385CC */ _t301 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022385CC */ _t302 = _t301 & 0x00000001u;
         /* 022385CC */ if (_t302) goto L_022385D0; else goto L_02238460;
   L_022385D0: ; // 0x22385d0
-        /* 022385D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[23], 0x00000000u);
-        /* 022385D4 */ _t303 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022385D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[23], 0x00000000u));
+        /* 022385D4 */ _t303 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022385D4 */ _t304 = _t303 & 0x00000001u;
         /* 022385D4 */ if (_t304) goto L_02238658; else goto L_022385D8;
   L_022385D8: ; // 0x22385d8
@@ -5882,10 +5882,10 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 0223863C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t320);
         /* 02238640 */ cpu->f[13] = cpu->f[9] * cpu->f[9];
         /* 02238644 */ cpu->f[11] = fma(cpu->f[11], cpu->f[11], cpu->f[13]);
-        /* 02238648 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[30]);
+        /* 02238648 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[30]));
         /* 0223864C */ _t321 = cpu->r[1] + 0x00000064u;
         /* 0223864C */ rbrew_write_f32(cpu->mem, _t321, cpu->f[30]);
-        /* 02238650 */ _t322 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02238650 */ _t322 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02238650 */ _t323 = _t322 & 0x00000001u;
         /* 02238650 */ if (_t323) goto L_02238654; else goto L_02238B3C;
   L_02238654: ; // 0x2238654
@@ -5942,10 +5942,10 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 022386D0 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t341);
         /* 022386D4 */ cpu->f[13] = cpu->f[9] * cpu->f[9];
         /* 022386D8 */ cpu->f[11] = fma(cpu->f[11], cpu->f[11], cpu->f[13]);
-        /* 022386DC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[30]);
+        /* 022386DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[30]));
         /* 022386E0 */ _t342 = cpu->r[1] + 0x00000064u;
         /* 022386E0 */ rbrew_write_f32(cpu->mem, _t342, cpu->f[30]);
-        /* 022386E4 */ _t343 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022386E4 */ _t343 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022386E4 */ _t344 = _t343 & 0x00000001u;
         /* 022386E4 */ if (_t344) goto L_022386E8; else goto L_02238B3C;
   L_022386E8: ; // 0x22386e8
@@ -5993,7 +5993,7 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 0223874C */ cpu->f[8] = -cpu->f[9];
         /* 02238750 */ _t360 = cpu->r[1] + 0x000000ACu;
         /* 02238750 */ rbrew_write_f32(cpu->mem, _t360, cpu->f[12]);
-        /* 02238754 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
+        /* 02238754 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
         /* 02238758 */ _t361 = cpu->r[1] + 0x000000CCu;
         /* 02238758 */ rbrew_write_f32(cpu->mem, _t361, cpu->f[13]);
         /* 0223875C */ _t362 = cpu->r[1] + 0x000000D4u;
@@ -6002,7 +6002,7 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238760 */ rbrew_write_f32(cpu->mem, _t363, cpu->f[6]);
         /* 02238764 */ _t364 = cpu->r[30] + 0x000000B4u;
         /* 02238764 */ cpu->r[9] = rbrew_read32(cpu->mem, _t364);
-        /* 02238768 */ _t365 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02238768 */ _t365 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02238768 */ _t366 = _t365 & 0x00000001u;
         /* 02238768 */ if (_t366) goto L_022387B0; else goto L_0223876C;
   L_0223876C: ; // 0x223876c
@@ -6021,10 +6021,10 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238798 */ Gambit_fn_0204A4DC(cpu);
         /* 0223879C */ cpu->r[29] = 0x00000000u;
         /* 022387A0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022387A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 022387A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 022387A4 */ _t368 = cpu->r[30] + 0x000000B0u;
         /* 022387A4 */ rbrew_write32(cpu->mem, _t368, cpu->r[3]);
-        /* 022387A8 */ _t369 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022387A8 */ _t369 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022387A8 */ _t370 = _t369 & 0x00000001u;
         /* 022387A8 */ if (_t370) goto L_02238928; else goto L_022387AC;
   L_022387AC: ; // 0x22387ac
@@ -6042,10 +6042,10 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 022387D4 */ Gambit_fn_0204A864(cpu);
         /* 022387D8 */ cpu->r[29] = 0x00000000u;
         /* 022387DC */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022387DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 022387DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 022387E0 */ _t371 = cpu->r[30] + 0x000000B0u;
         /* 022387E0 */ rbrew_write32(cpu->mem, _t371, cpu->r[3]);
-        /* 022387E4 */ _t372 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022387E4 */ _t372 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022387E4 */ _t373 = _t372 & 0x00000001u;
         /* 022387E4 */ if (_t373) goto L_02238928; else goto L_022387E8;
   L_022387E8: ; // 0x22387e8
@@ -6054,8 +6054,8 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 022387EC */ _t375 = cpu->r[31] + 0x0000015Cu;
         /* 022387EC */ cpu->r[0] = rbrew_read32(cpu->mem, _t375);
         /* 022387F0 */ cpu->r[4] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Cu, 0x0000001Fu);
-        /* 022387F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 022387F4 */ _t376 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022387F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 022387F4 */ _t376 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022387F4 */ _t377 = _t376 & 0x00000001u;
         /* 022387F4 */ if (_t377) goto L_0223881C; else goto L_022387F8;
   L_022387F8: ; // 0x22387f8
@@ -6073,23 +6073,23 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238818 */ cpu->r[0] = rbrew_read32(cpu->mem, _t380);
   L_0223881C: ; // 0x223881c
         /* 0223881C */ cpu->r[7] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 0223881C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 02238820 */ _t381 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223881C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 02238820 */ _t381 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238820 */ _t382 = _t381 & 0x00000001u;
         /* 02238820 */ if (_t382) goto L_022388D8; else goto L_02238824;
   L_02238824: ; // 0x2238824
         /* 02238824 */ _t383 = cpu->r[31] + 0x00000168u;
         /* 02238824 */ cpu->r[9] = rbrew_read32(cpu->mem, _t383);
         /* 02238828 */ cpu->r[8] = rbrew_rlwinm(cpu->r[9], 0x00000000u, 0x00000004u, 0x00000004u);
-        /* 02238828 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 0223882C */ _t384 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238828 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 0223882C */ _t384 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223882C */ _t385 = _t384 & 0x00000001u;
         /* 0223882C */ if (_t385) goto L_0223883C; else goto L_02238830;
   L_02238830: ; // 0x2238830
         /* 02238830 */ _t386 = cpu->r[31] + 0x00000044u;
         /* 02238830 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t386);
-        /* 02238834 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[30]);
-        /* 02238838 */ _t387 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238834 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[30]));
+        /* 02238838 */ _t387 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238838 */ _t388 = _t387 & 0x00000001u;
         /* 02238838 */ if (_t388) goto L_0223883C; else goto L_022388BC;
   L_0223883C: ; // 0x223883c
@@ -6138,10 +6138,10 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 022388A0 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t405);
         /* 022388A4 */ cpu->f[13] = cpu->f[9] * cpu->f[9];
         /* 022388A8 */ cpu->f[11] = fma(cpu->f[11], cpu->f[11], cpu->f[13]);
-        /* 022388AC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[30]);
+        /* 022388AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[30]));
         /* 022388B0 */ _t406 = cpu->r[1] + 0x00000064u;
         /* 022388B0 */ rbrew_write_f32(cpu->mem, _t406, cpu->f[30]);
-        /* 022388B4 */ _t407 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022388B4 */ _t407 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022388B4 */ _t408 = _t407 & 0x00000001u;
         /* 022388B4 */ if (_t408) goto L_022388B8; else goto L_02238B3C;
   L_022388B8: ; // 0x22388b8
@@ -6159,8 +6159,8 @@ void Gambit_fn_02237D64(CPUState* cpu) {
   L_022388D8: ; // 0x22388d8
         /* 022388D8 */ _t411 = cpu->r[30] + 0x000001C8u;
         /* 022388D8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t411);
-        /* 022388DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022388E0 */ _t412 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022388DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022388E0 */ _t412 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022388E0 */ _t413 = _t412 & 0x00000001u;
         /* 022388E0 */ if (_t413) goto L_02238990; else goto L_022388E4;
   L_022388E4: ; // 0x22388e4
@@ -6168,15 +6168,15 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 022388E4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t414);
         /* 022388E8 */ _t415 = cpu->r[30] + 0x000001CCu;
         /* 022388E8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t415);
-        /* 022388EC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[0]);
-        /* 022388F0 */ _t416 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022388EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[0]));
+        /* 022388F0 */ _t416 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022388F0 */ _t417 = _t416 & 0x00000001u;
         /* 022388F0 */ if (_t417) goto L_022388F4; else goto L_02238990;
   L_022388F4: ; // 0x22388f4
         /* 022388F4 */ _t418 = cpu->r[31] + 0x00000028u;
         /* 022388F4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t418);
-        /* 022388F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022388FC */ _t419 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022388F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022388FC */ _t419 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022388FC */ _t420 = _t419 & 0x00000001u;
         /* 022388FC */ if (_t420) goto L_02238914; else goto L_02238900;
   L_02238900: ; // 0x2238900
@@ -6189,18 +6189,18 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238910 */ rbrew_call_indirect(cpu, cpu->ctr);
   L_02238914: ; // 0x2238914
         /* 02238914 */ cpu->r[9] = 0x00000001u;
-        /* 02238918 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 02238918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0223891C */ _t423 = cpu->r[31] + 0x0000004Cu;
         /* 0223891C */ rbrew_write8(cpu->mem, _t423, (uint8_t)cpu->r[9]);
-        /* 02238920 */ _t424 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238920 */ _t424 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238920 */ _t425 = _t424 & 0x00000001u;
         /* 02238920 */ if (_t425) goto L_02238998; else goto L_02238924;
   L_02238924: ; // 0x2238924
         /* 02238924 */ goto L_02238A20;
   L_02238928: ; // 0x2238928
         /* 02238928 */ cpu->r[11] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000000Cu, 0x0000000Cu);
-        /* 02238928 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0223892C */ _t426 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238928 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0223892C */ _t426 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223892C */ _t427 = _t426 & 0x00000001u;
         /* 0223892C */ if (_t427) goto L_0223894C; else goto L_02238930;
   L_02238930: ; // 0x2238930
@@ -6210,8 +6210,8 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238938 */ Gambit_fn_02237944(cpu);
         /* 0223893C */ _t429 = cpu->r[30] + 0x000001B0u;
         /* 0223893C */ cpu->r[31] = rbrew_read32(cpu->mem, _t429);
-        /* 02238940 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02238944 */ _t430 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02238944 */ _t430 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238944 */ _t431 = _t430 & 0x00000001u;
         /* 02238944 */ if (_t431) goto L_02238948; else goto L_022389A4;
   L_02238948: ; // 0x2238948
@@ -6219,8 +6219,8 @@ void Gambit_fn_02237D64(CPUState* cpu) {
   L_0223894C: ; // 0x223894c
         /* 0223894C */ _t432 = cpu->r[30] + 0x000001C8u;
         /* 0223894C */ cpu->r[31] = rbrew_read32(cpu->mem, _t432);
-        /* 02238950 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02238954 */ _t433 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238950 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02238954 */ _t433 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238954 */ _t434 = _t433 & 0x00000001u;
         /* 02238954 */ if (_t434) goto L_02238998; else goto L_02238958;
   L_02238958: ; // 0x2238958
@@ -6228,15 +6228,15 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238958 */ cpu->r[0] = rbrew_read32(cpu->mem, _t435);
         /* 0223895C */ _t436 = cpu->r[30] + 0x000001CCu;
         /* 0223895C */ cpu->r[5] = rbrew_read32(cpu->mem, _t436);
-        /* 02238960 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[5]);
-        /* 02238964 */ _t437 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238960 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[5]));
+        /* 02238964 */ _t437 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238964 */ _t438 = _t437 & 0x00000001u;
         /* 02238964 */ if (_t438) goto L_02238968; else goto L_02238998;
   L_02238968: ; // 0x2238968
         /* 02238968 */ _t439 = cpu->r[31] + 0x00000028u;
         /* 02238968 */ cpu->r[3] = rbrew_read32(cpu->mem, _t439);
-        /* 0223896C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02238970 */ _t440 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223896C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02238970 */ _t440 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238970 */ _t441 = _t440 & 0x00000001u;
         /* 02238970 */ if (_t441) goto L_02238988; else goto L_02238974;
   L_02238974: ; // 0x2238974
@@ -6252,15 +6252,15 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 0223898C */ _t444 = cpu->r[31] + 0x0000004Cu;
         /* 0223898C */ rbrew_write8(cpu->mem, _t444, (uint8_t)cpu->r[9]);
   L_02238990: ; // 0x2238990
-        /* 02238990 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02238994 */ _t445 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02238994 */ _t445 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238994 */ _t446 = _t445 & 0x00000001u;
         /* 02238994 */ if (_t446) goto L_02238998; else goto L_02238A20;
   L_02238998: ; // 0x2238998
         /* 02238998 */ _t447 = cpu->r[30] + 0x000001B0u;
         /* 02238998 */ cpu->r[31] = rbrew_read32(cpu->mem, _t447);
-        /* 0223899C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022389A0 */ _t448 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223899C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022389A0 */ _t448 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022389A0 */ _t449 = _t448 & 0x00000001u;
         /* 022389A0 */ if (_t449) goto L_022389DC; else goto L_022389A4;
   L_022389A4: ; // 0x22389a4
@@ -6268,15 +6268,15 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 022389A4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t450);
         /* 022389A8 */ _t451 = cpu->r[30] + 0x000001B4u;
         /* 022389A8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t451);
-        /* 022389AC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[11]);
-        /* 022389B0 */ _t452 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022389AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[11]));
+        /* 022389B0 */ _t452 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022389B0 */ _t453 = _t452 & 0x00000001u;
         /* 022389B0 */ if (_t453) goto L_022389B4; else goto L_022389DC;
   L_022389B4: ; // 0x22389b4
         /* 022389B4 */ _t454 = cpu->r[31] + 0x00000028u;
         /* 022389B4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t454);
-        /* 022389B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022389BC */ _t455 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022389B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022389BC */ _t455 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022389BC */ _t456 = _t455 & 0x00000001u;
         /* 022389BC */ if (_t456) goto L_022389D4; else goto L_022389C0;
   L_022389C0: ; // 0x22389c0
@@ -6294,8 +6294,8 @@ void Gambit_fn_02237D64(CPUState* cpu) {
   L_022389DC: ; // 0x22389dc
         /* 022389DC */ _t460 = cpu->r[30] + 0x000001BCu;
         /* 022389DC */ cpu->r[31] = rbrew_read32(cpu->mem, _t460);
-        /* 022389E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022389E4 */ _t461 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022389E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022389E4 */ _t461 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022389E4 */ _t462 = _t461 & 0x00000001u;
         /* 022389E4 */ if (_t462) goto L_02238A20; else goto L_022389E8;
   L_022389E8: ; // 0x22389e8
@@ -6303,15 +6303,15 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 022389E8 */ cpu->r[5] = rbrew_read32(cpu->mem, _t463);
         /* 022389EC */ _t464 = cpu->r[30] + 0x000001C0u;
         /* 022389EC */ cpu->r[7] = rbrew_read32(cpu->mem, _t464);
-        /* 022389F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[7]);
-        /* 022389F4 */ _t465 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022389F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[7]));
+        /* 022389F4 */ _t465 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022389F4 */ _t466 = _t465 & 0x00000001u;
         /* 022389F4 */ if (_t466) goto L_022389F8; else goto L_02238A20;
   L_022389F8: ; // 0x22389f8
         /* 022389F8 */ _t467 = cpu->r[31] + 0x00000028u;
         /* 022389F8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t467);
-        /* 022389FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02238A00 */ _t468 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022389FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02238A00 */ _t468 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238A00 */ _t469 = _t468 & 0x00000001u;
         /* 02238A00 */ if (_t469) goto L_02238A18; else goto L_02238A04;
   L_02238A04: ; // 0x2238a04
@@ -6367,15 +6367,15 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238A78 */ _t488 = cpu->r[1] + 0x0000012Cu;
         /* 02238A78 */ rbrew_write_f32(cpu->mem, _t488, cpu->f[7]);
         /* 02238A7C */ Gambit_fn_027E3F3C(cpu);
-        /* 02238A80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02238A84 */ _t489 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238A80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02238A84 */ _t489 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238A84 */ _t490 = _t489 & 0x00000001u;
         /* 02238A84 */ if (_t490) goto L_02238AA0; else goto L_02238A88;
   L_02238A88: ; // 0x2238a88
         /* 02238A88 */ cpu->r[3] = cpu->r[1] + 0x00000128u;
         /* 02238A8C */ Gambit_fn_027E3F3C(cpu);
-        /* 02238A90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02238A94 */ _t491 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238A90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02238A94 */ _t491 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238A94 */ _t492 = _t491 & 0x00000001u;
         /* 02238A94 */ if (_t492) goto L_02238AA0; else goto L_02238A98;
   L_02238A98: ; // 0x2238a98
@@ -6420,10 +6420,10 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238AF0 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t507);
         /* 02238AF4 */ cpu->f[13] = cpu->f[9] * cpu->f[9];
         /* 02238AF8 */ cpu->f[11] = fma(cpu->f[11], cpu->f[11], cpu->f[13]);
-        /* 02238AFC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[30]);
+        /* 02238AFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[30]));
         /* 02238B00 */ _t508 = cpu->r[1] + 0x00000064u;
         /* 02238B00 */ rbrew_write_f32(cpu->mem, _t508, cpu->f[30]);
-        /* 02238B04 */ _t509 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02238B04 */ _t509 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02238B04 */ _t510 = _t509 & 0x00000001u;
         /* 02238B04 */ if (_t510) goto L_02238B08; else goto L_02238B3C;
   L_02238B08: ; // 0x2238b08
@@ -6451,8 +6451,8 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238B44 */ cpu->r[5] = cpu->r[1] + 0x00000060u;
         /* 02238B48 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 02238B4C */ Gambit_fn_021C6DD8(cpu);
-        /* 02238B50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02238B54 */ _t516 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238B50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02238B54 */ _t516 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238B54 */ _t517 = _t516 & 0x00000001u;
         /* 02238B54 */ if (_t517) goto L_02238B58; else goto L_02238B6C;
   L_02238B58: ; // 0x2238b58
@@ -6501,10 +6501,10 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238BC8 */ _t531 = cpu->r[30] + 0x0000016Cu;
         /* 02238BC8 */ rbrew_write_f32(cpu->mem, _t531, cpu->f[13]);
         /* 02238BCC */ cpu->r[4] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x00000008u, 0x00000009u);
-        /* 02238BCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 02238BCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 02238BD0 */ _t532 = cpu->r[30] + 0x00000174u;
         /* 02238BD0 */ rbrew_write_f32(cpu->mem, _t532, cpu->f[8]);
-        /* 02238BD4 */ _t533 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238BD4 */ _t533 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238BD4 */ _t534 = _t533 & 0x00000001u;
         /* 02238BD4 */ if (_t534) goto L_02238BE0; else goto L_02238BD8;
   L_02238BD8: ; // 0x2238bd8
@@ -6513,13 +6513,13 @@ void Gambit_fn_02237D64(CPUState* cpu) {
   L_02238BE0: ; // 0x2238be0
         /* 02238BE0 */ _t535 = cpu->r[30] + 0x0000001Cu;
         /* 02238BE0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t535);
-        /* 02238BE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000002u);
-        /* 02238BE8 */ _t536 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238BE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000002u));
+        /* 02238BE8 */ _t536 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238BE8 */ _t537 = _t536 & 0x00000001u;
         /* 02238BE8 */ if (_t537) goto L_02238BF4; else goto L_02238BEC;
   L_02238BEC: ; // 0x2238bec
-        /* 02238BEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000003u);
-        /* 02238BF0 */ _t538 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238BEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000003u));
+        /* 02238BF0 */ _t538 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238BF0 */ _t539 = _t538 & 0x00000001u;
         /* 02238BF0 */ if (_t539) goto L_02238BF4; else goto L_02238E24;
   L_02238BF4: ; // 0x2238bf4
@@ -6531,9 +6531,9 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238C00 */ cpu->f[9] = cpu->f[10] + cpu->f[10];
         /* 02238C04 */ _t542 = cpu->r[7] + 0x00001F80u;
         /* 02238C04 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t542);
-        /* 02238C08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02238C08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 02238C0C */ cpu->f[31] = cpu->f[9] / cpu->f[8];
-        /* 02238C10 */ _t543 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238C10 */ _t543 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238C10 */ _t544 = _t543 & 0x00000001u;
         /* 02238C10 */ if (_t544) goto L_02238C48; else goto L_02238C14;
   L_02238C14: ; // 0x2238c14
@@ -6541,8 +6541,8 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238C14 */ cpu->r[5] = rbrew_read32(cpu->mem, _t545);
         /* 02238C18 */ _t546 = cpu->r[30] + 0x0000018Cu;
         /* 02238C18 */ cpu->r[6] = rbrew_read32(cpu->mem, _t546);
-        /* 02238C1C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[6]);
-        /* 02238C20 */ _t547 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238C1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[6]));
+        /* 02238C20 */ _t547 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238C20 */ _t548 = _t547 & 0x00000001u;
         /* 02238C20 */ if (_t548) goto L_02238C24; else goto L_02238C48;
   L_02238C24: ; // 0x2238c24
@@ -6563,8 +6563,8 @@ void Gambit_fn_02237D64(CPUState* cpu) {
   L_02238C48: ; // 0x2238c48
         /* 02238C48 */ _t554 = cpu->r[30] + 0x00000194u;
         /* 02238C48 */ cpu->r[8] = rbrew_read32(cpu->mem, _t554);
-        /* 02238C4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02238C50 */ _t555 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238C4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02238C50 */ _t555 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238C50 */ _t556 = _t555 & 0x00000001u;
         /* 02238C50 */ if (_t556) goto L_02238CAC; else goto L_02238C54;
   L_02238C54: ; // 0x2238c54
@@ -6572,8 +6572,8 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238C54 */ cpu->r[9] = rbrew_read32(cpu->mem, _t557);
         /* 02238C58 */ _t558 = cpu->r[30] + 0x00000198u;
         /* 02238C58 */ cpu->r[0] = rbrew_read32(cpu->mem, _t558);
-        /* 02238C5C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[0]);
-        /* 02238C60 */ _t559 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238C5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[0]));
+        /* 02238C60 */ _t559 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238C60 */ _t560 = _t559 & 0x00000001u;
         /* 02238C60 */ if (_t560) goto L_02238C64; else goto L_02238CAC;
   L_02238C64: ; // 0x2238c64
@@ -6616,15 +6616,15 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238CAC */ _t578 = cpu->r[30] + 0x00000184u;
         /* 02238CAC */ cpu->r[12] = rbrew_read32(cpu->mem, _t578);
         /* 02238CB0 */ cpu->r[12] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000014u, 0x00000015u);
-        /* 02238CB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02238CB4 */ _t579 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238CB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02238CB4 */ _t579 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238CB4 */ _t580 = _t579 & 0x00000001u;
         /* 02238CB4 */ if (_t580) goto L_02238D6C; else goto L_02238CB8;
   L_02238CB8: ; // 0x2238cb8
         /* 02238CB8 */ _t581 = cpu->r[30] + 0x00000188u;
         /* 02238CB8 */ cpu->r[31] = rbrew_read32(cpu->mem, _t581);
-        /* 02238CBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02238CC0 */ _t582 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238CBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02238CC0 */ _t582 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238CC0 */ _t583 = _t582 & 0x00000001u;
         /* 02238CC0 */ if (_t583) goto L_02238D4C; else goto L_02238CC4;
   L_02238CC4: ; // 0x2238cc4
@@ -6632,16 +6632,16 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238CC4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t584);
         /* 02238CC8 */ _t585 = cpu->r[30] + 0x0000018Cu;
         /* 02238CC8 */ cpu->r[4] = rbrew_read32(cpu->mem, _t585);
-        /* 02238CCC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[4]);
-        /* 02238CD0 */ _t586 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238CCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[4]));
+        /* 02238CD0 */ _t586 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238CD0 */ _t587 = _t586 & 0x00000001u;
         /* 02238CD0 */ if (_t587) goto L_02238CD4; else goto L_02238D4C;
   L_02238CD4: ; // 0x2238cd4
         /* 02238CD4 */ cpu->r[3] = cpu->r[31];
         /* 02238CD8 */ Gambit_fn_028B08CC(cpu);
         /* 02238CDC */ cpu->r[31] = cpu->r[3];
-        /* 02238CDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02238CE0 */ _t588 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238CDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02238CE0 */ _t588 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238CE0 */ _t589 = _t588 & 0x00000001u;
         /* 02238CE0 */ if (_t589) goto L_02238D4C; else goto L_02238CE4;
   L_02238CE4: ; // 0x2238ce4
@@ -6652,8 +6652,8 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238CEC */ cpu->ctr = cpu->r[6];
         /* 02238CF0 */ cpu->r[3] = cpu->r[31];
         /* 02238CF4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02238CF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02238CFC */ _t592 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238CF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02238CFC */ _t592 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238CFC */ _t593 = _t592 & 0x00000001u;
         /* 02238CFC */ if (_t593) goto L_02238D4C; else goto L_02238D00;
   L_02238D00: ; // 0x2238d00
@@ -6661,22 +6661,22 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238D00 */ cpu->r[11] = rbrew_read32(cpu->mem, _t594);
         /* 02238D04 */ _t595 = cpu->r[11] + 0x0000010Cu;
         /* 02238D04 */ cpu->r[7] = rbrew_read32(cpu->mem, _t595);
-        /* 02238D08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 02238D0C */ _t596 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238D08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 02238D0C */ _t596 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238D0C */ _t597 = _t596 & 0x00000001u;
         /* 02238D0C */ if (_t597) goto L_02238D4C; else goto L_02238D10;
   L_02238D10: ; // 0x2238d10
         /* 02238D10 */ _t598 = cpu->r[11] + 0x00000004u;
         /* 02238D10 */ cpu->r[9] = rbrew_read8(cpu->mem, _t598);
-        /* 02238D14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02238D18 */ _t599 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238D14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02238D18 */ _t599 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238D18 */ _t600 = _t599 & 0x00000001u;
         /* 02238D18 */ if (_t600) goto L_02238D4C; else goto L_02238D1C;
   L_02238D1C: ; // 0x2238d1c
         /* 02238D1C */ _t601 = cpu->r[11] + 0x00000128u;
         /* 02238D1C */ cpu->r[12] = rbrew_read32(cpu->mem, _t601);
-        /* 02238D20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02238D24 */ _t602 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238D20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02238D24 */ _t602 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238D24 */ _t603 = _t602 & 0x00000001u;
         /* 02238D24 */ if (_t603) goto L_02238D60; else goto L_02238D28;
   L_02238D28: ; // 0x2238d28
@@ -6688,10 +6688,10 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238D34 */ _t606 = cpu->r[30] + 0x0000012Cu;
         /* 02238D34 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t606);
         /* 02238D38 */ cpu->r[11] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000016u, 0x00000013u);
-        /* 02238D3C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[30]);
+        /* 02238D3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[30]));
         /* 02238D40 */ _t607 = cpu->r[30] + 0x00000184u;
         /* 02238D40 */ rbrew_write32(cpu->mem, _t607, cpu->r[11]);
-        /* 02238D44 */ _t608 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02238D44 */ _t608 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02238D44 */ _t609 = _t608 & 0x00000001u;
         /* 02238D44 */ if (_t609) goto L_02238D48; else goto L_02238E08;
   L_02238D48: ; // 0x2238d48
@@ -6700,9 +6700,9 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238D4C */ _t610 = cpu->r[30] + 0x00000184u;
         /* 02238D4C */ cpu->r[0] = rbrew_read32(cpu->mem, _t610);
         /* 02238D50 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000014u, 0x00000015u);
-        /* 02238D50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02238D50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02238D54 */ cpu->r[12] = 0x00000000u;
-        /* 02238D58 */ _t611 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238D58 */ _t611 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238D58 */ _t612 = _t611 & 0x00000001u;
         /* 02238D58 */ if (_t612) goto L_02238D6C; else goto L_02238D5C;
   L_02238D5C: ; // 0x2238d5c
@@ -6711,15 +6711,15 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238D60 */ _t613 = cpu->r[30] + 0x00000184u;
         /* 02238D60 */ cpu->r[0] = rbrew_read32(cpu->mem, _t613);
         /* 02238D64 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000014u, 0x00000015u);
-        /* 02238D64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02238D68 */ _t614 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238D64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02238D68 */ _t614 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238D68 */ _t615 = _t614 & 0x00000001u;
         /* 02238D68 */ if (_t615) goto L_02238D6C; else goto L_02238E24;
   L_02238D6C: ; // 0x2238d6c
         /* 02238D6C */ _t616 = cpu->r[30] + 0x0000012Cu;
         /* 02238D6C */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t616);
-        /* 02238D70 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[30]);
-        /* 02238D74 */ _t617 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02238D70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[30]));
+        /* 02238D74 */ _t617 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02238D74 */ _t618 = _t617 & 0x00000001u;
         /* 02238D74 */ if (_t618) goto L_02238D78; else goto L_02238E08;
   L_02238D78: ; // 0x2238d78
@@ -6778,7 +6778,7 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238DEC */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t641);
         /* 02238DF0 */ _t642 = cpu->r[1] + 0x00000210u;
         /* 02238DF0 */ cpu->f[25] = rbrew_read_f64(cpu->mem, _t642);
-        /* 02238DF4 */ _t643 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02238DF4 */ _t643 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02238DF4 */ _t644 = _t643 & 0x00000001u;
         /* 02238DF4 */ if (_t644) goto L_02238DF8; // else: addr-0 trap, fall-through
   L_02238DF8: ; // 0x2238df8
@@ -6840,7 +6840,7 @@ void Gambit_fn_02237D64(CPUState* cpu) {
         /* 02238E70 */ cpu->f[23] = rbrew_read_f64(cpu->mem, _t667);
         /* 02238E74 */ _t668 = cpu->r[1] + 0x00000270u;
         /* 02238E74 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t668);
-        /* 02238E78 */ _t669 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02238E78 */ _t669 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02238E78 */ _t670 = _t669 & 0x00000001u;
         /* 02238E78 */ if (_t670) goto L_02238E7C; // else: addr-0 trap, fall-through
   L_02238E7C: ; // 0x2238e7c
@@ -6866,8 +6866,8 @@ void Gambit_fn_02238E8C(CPUState* cpu) {
         /* 02238E98 */ cpu->r[0] = rbrew_read32(cpu->mem, _t2);
         /* 02238E9C */ _t3 = cpu->r[3] + 0x0000002Cu;
         /* 02238E9C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02238EA0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[11]);
-        /* 02238EA4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238EA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[11]));
+        /* 02238EA4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238EA4 */ _t5 = _t4 & 0x00000001u;
         /* 02238EA4 */ if (_t5) goto L_02238EA8; else goto L_02238EC0;
   L_02238EA8: ; // 0x2238ea8
@@ -6882,8 +6882,8 @@ void Gambit_fn_02238E8C(CPUState* cpu) {
   L_02238EC0: ; // 0x2238ec0
         /* 02238EC0 */ cpu->r[3] = cpu->r[4];
         /* 02238EC4 */ Gambit_fn_021BCFBC(cpu);
-        /* 02238EC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02238ECC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238EC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02238ECC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238ECC */ _t9 = _t8 & 0x00000001u;
         /* 02238ECC */ if (_t9) goto L_02238EE8; else goto L_02238ED0;
   L_02238ED0: ; // 0x2238ed0
@@ -6923,8 +6923,8 @@ void Gambit_fn_02238E94(CPUState* cpu) {
         /* 02238E98 */ cpu->r[0] = rbrew_read32(cpu->mem, _t1);
         /* 02238E9C */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 02238E9C */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 02238EA0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[11]);
-        /* 02238EA4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238EA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[11]));
+        /* 02238EA4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238EA4 */ _t4 = _t3 & 0x00000001u;
         /* 02238EA4 */ if (_t4) goto L_02238EA8; else goto L_02238EC0;
   L_02238EA8: ; // 0x2238ea8
@@ -6939,8 +6939,8 @@ void Gambit_fn_02238E94(CPUState* cpu) {
   L_02238EC0: ; // 0x2238ec0
         /* 02238EC0 */ cpu->r[3] = cpu->r[4];
         /* 02238EC4 */ Gambit_fn_021BCFBC(cpu);
-        /* 02238EC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02238ECC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238EC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02238ECC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238ECC */ _t8 = _t7 & 0x00000001u;
         /* 02238ECC */ if (_t8) goto L_02238EE8; else goto L_02238ED0;
   L_02238ED0: ; // 0x2238ed0
@@ -6989,8 +6989,8 @@ void Gambit_fn_02238F14(CPUState* cpu) {
         /* 02238F20 */ _t2 = cpu->r[4] + 0x00000168u;
         /* 02238F20 */ cpu->r[0] = rbrew_read32(cpu->mem, _t2);
         /* 02238F24 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000004u, 0x00000004u);
-        /* 02238F24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02238F28 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238F24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02238F28 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238F28 */ _t4 = _t3 & 0x00000001u;
         /* 02238F28 */ if (_t4) goto L_02238F44; else goto L_02238F2C;
   L_02238F2C: ; // 0x2238f2c
@@ -7030,8 +7030,8 @@ void Gambit_fn_02238F1C(CPUState* cpu) {
         /* 02238F20 */ _t1 = cpu->r[4] + 0x00000168u;
         /* 02238F20 */ cpu->r[0] = rbrew_read32(cpu->mem, _t1);
         /* 02238F24 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000004u, 0x00000004u);
-        /* 02238F24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02238F28 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02238F24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02238F28 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02238F28 */ _t3 = _t2 & 0x00000001u;
         /* 02238F28 */ if (_t3) goto L_02238F44; else goto L_02238F2C;
   L_02238F2C: ; // 0x2238f2c
@@ -7238,8 +7238,8 @@ void Gambit_fn_02238FDC(CPUState* cpu) {
         /* 02239074 */ cpu->f[9] = -fma(cpu->f[9], cpu->f[13], -(cpu->f[10]));
         /* 02239078 */ _t28 = cpu->r[12] + 0x00001F20u;
         /* 02239078 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t28);
-        /* 0223907C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
-        /* 02239080 */ _t29 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223907C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
+        /* 02239080 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02239080 */ _t30 = _t29 & 0x00000001u;
         /* 02239080 */ if (_t30) goto L_02239084; else goto L_02239108;
   L_02239084: ; // 0x2239084
@@ -7247,22 +7247,22 @@ void Gambit_fn_02238FDC(CPUState* cpu) {
         /* 02239084 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t31);
         /* 02239088 */ _t32 = cpu->r[30] + 0x00000008u;
         /* 02239088 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t32);
-        /* 0223908C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[11]);
-        /* 02239090 */ _t33 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223908C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[11]));
+        /* 02239090 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02239090 */ _t34 = _t33 & 0x00000001u;
         /* 02239090 */ if (_t34) goto L_02239094; else goto L_022390A4;
   L_02239094: ; // 0x2239094
         /* 02239094 */ cpu->f[12] = cpu->f[11] + cpu->f[9];
-        /* 02239098 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[12]);
-        /* 0223909C */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02239098 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[12]));
+        /* 0223909C */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223909C */ _t36 = _t35 & 0x00000001u;
         /* 0223909C */ if (_t36) goto L_022390B0; else goto L_022390A0;
   L_022390A0: ; // 0x22390a0
         /* 022390A0 */ goto L_022390B4;
   L_022390A4: ; // 0x22390a4
         /* 022390A4 */ cpu->f[12] = cpu->f[11] - cpu->f[9];
-        /* 022390A8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[12]);
-        /* 022390AC */ _t37 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022390A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[12]));
+        /* 022390AC */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022390AC */ _t38 = _t37 & 0x00000001u;
         /* 022390AC */ if (_t38) goto L_022390B0; else goto L_022390B4;
   L_022390B0: ; // 0x22390b0
@@ -7274,22 +7274,22 @@ void Gambit_fn_02238FDC(CPUState* cpu) {
         /* 022390B8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t40);
         /* 022390BC */ _t41 = cpu->r[30] + 0x00000014u;
         /* 022390BC */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t41);
-        /* 022390C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[12]);
-        /* 022390C4 */ _t42 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022390C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[12]));
+        /* 022390C4 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022390C4 */ _t43 = _t42 & 0x00000001u;
         /* 022390C4 */ if (_t43) goto L_022390C8; else goto L_022390D8;
   L_022390C8: ; // 0x22390c8
         /* 022390C8 */ cpu->f[13] = cpu->f[12] + cpu->f[9];
-        /* 022390CC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
-        /* 022390D0 */ _t44 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022390CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
+        /* 022390D0 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022390D0 */ _t45 = _t44 & 0x00000001u;
         /* 022390D0 */ if (_t45) goto L_022390D4; else goto L_022390E4;
   L_022390D4: ; // 0x22390d4
         /* 022390D4 */ goto L_02239104;
   L_022390D8: ; // 0x22390d8
         /* 022390D8 */ cpu->f[13] = cpu->f[12] - cpu->f[9];
-        /* 022390DC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
-        /* 022390E0 */ _t46 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022390DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
+        /* 022390E0 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022390E0 */ _t47 = _t46 & 0x00000001u;
         /* 022390E0 */ if (_t47) goto L_02239104; else goto L_022390E4;
   L_022390E4: ; // 0x22390e4
@@ -7397,8 +7397,8 @@ void Gambit_fn_02238FE0(CPUState* cpu) {
         /* 02239074 */ cpu->f[9] = -fma(cpu->f[9], cpu->f[13], -(cpu->f[10]));
         /* 02239078 */ _t28 = cpu->r[12] + 0x00001F20u;
         /* 02239078 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t28);
-        /* 0223907C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
-        /* 02239080 */ _t29 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223907C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
+        /* 02239080 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02239080 */ _t30 = _t29 & 0x00000001u;
         /* 02239080 */ if (_t30) goto L_02239084; else goto L_02239108;
   L_02239084: ; // 0x2239084
@@ -7406,22 +7406,22 @@ void Gambit_fn_02238FE0(CPUState* cpu) {
         /* 02239084 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t31);
         /* 02239088 */ _t32 = cpu->r[30] + 0x00000008u;
         /* 02239088 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t32);
-        /* 0223908C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[11]);
-        /* 02239090 */ _t33 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223908C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[11]));
+        /* 02239090 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02239090 */ _t34 = _t33 & 0x00000001u;
         /* 02239090 */ if (_t34) goto L_02239094; else goto L_022390A4;
   L_02239094: ; // 0x2239094
         /* 02239094 */ cpu->f[12] = cpu->f[11] + cpu->f[9];
-        /* 02239098 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[12]);
-        /* 0223909C */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02239098 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[12]));
+        /* 0223909C */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223909C */ _t36 = _t35 & 0x00000001u;
         /* 0223909C */ if (_t36) goto L_022390B0; else goto L_022390A0;
   L_022390A0: ; // 0x22390a0
         /* 022390A0 */ goto L_022390B4;
   L_022390A4: ; // 0x22390a4
         /* 022390A4 */ cpu->f[12] = cpu->f[11] - cpu->f[9];
-        /* 022390A8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[12]);
-        /* 022390AC */ _t37 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022390A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[12]));
+        /* 022390AC */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022390AC */ _t38 = _t37 & 0x00000001u;
         /* 022390AC */ if (_t38) goto L_022390B0; else goto L_022390B4;
   L_022390B0: ; // 0x22390b0
@@ -7433,22 +7433,22 @@ void Gambit_fn_02238FE0(CPUState* cpu) {
         /* 022390B8 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t40);
         /* 022390BC */ _t41 = cpu->r[30] + 0x00000014u;
         /* 022390BC */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t41);
-        /* 022390C0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[12]);
-        /* 022390C4 */ _t42 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022390C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[12]));
+        /* 022390C4 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022390C4 */ _t43 = _t42 & 0x00000001u;
         /* 022390C4 */ if (_t43) goto L_022390C8; else goto L_022390D8;
   L_022390C8: ; // 0x22390c8
         /* 022390C8 */ cpu->f[13] = cpu->f[12] + cpu->f[9];
-        /* 022390CC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
-        /* 022390D0 */ _t44 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022390CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
+        /* 022390D0 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022390D0 */ _t45 = _t44 & 0x00000001u;
         /* 022390D0 */ if (_t45) goto L_022390D4; else goto L_022390E4;
   L_022390D4: ; // 0x22390d4
         /* 022390D4 */ goto L_02239104;
   L_022390D8: ; // 0x22390d8
         /* 022390D8 */ cpu->f[13] = cpu->f[12] - cpu->f[9];
-        /* 022390DC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
-        /* 022390E0 */ _t46 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022390DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
+        /* 022390E0 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022390E0 */ _t47 = _t46 & 0x00000001u;
         /* 022390E0 */ if (_t47) goto L_02239104; else goto L_022390E4;
   L_022390E4: ; // 0x22390e4
@@ -7495,8 +7495,8 @@ void Gambit_fn_02239124(CPUState* cpu) {
         /* 0223912C */ cpu->r[1] = _t1;
         /* 02239130 */ _t2 = cpu->r[3] + 0x00000060u;
         /* 02239130 */ cpu->r[3] = rbrew_read32(cpu->mem, _t2);
-        /* 02239134 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02239138 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02239134 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02239138 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02239138 */ _t4 = _t3 & 0x00000001u;
         /* 02239138 */ if (_t4) goto L_02239180; else goto L_0223913C;
   L_0223913C: ; // 0x223913c
@@ -7505,9 +7505,9 @@ void Gambit_fn_02239124(CPUState* cpu) {
         /* 02239140 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 02239140 */ cpu->r[9] = _t5;
         /* 02239144 */ cpu->r[4] = 0x101D0000u;
-        /* 02239148 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02239148 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0223914C */ cpu->r[4] = cpu->r[4] + 0xFFFFFBC4u;
-        /* 02239150 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02239150 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02239150 */ _t7 = _t6 & 0x00000001u;
         /* 02239150 */ if (_t7) goto L_02239154; else goto L_02239168;
   L_02239154: ; // 0x2239154
@@ -7525,8 +7525,8 @@ void Gambit_fn_02239124(CPUState* cpu) {
         /* 0223916C */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
         /* 02239170 */ cpu->ctr = cpu->r[10];
         /* 02239174 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02239178 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223917C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02239178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223917C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223917C */ _t13 = _t12 & 0x00000001u;
         /* 0223917C */ if (_t13) goto L_02239194; else goto L_02239180;
   L_02239180: ; // 0x2239180
@@ -7555,8 +7555,8 @@ void Gambit_fn_0223912C(CPUState* cpu) {
         /* 0223912C */ cpu->r[1] = _t0;
         /* 02239130 */ _t1 = cpu->r[3] + 0x00000060u;
         /* 02239130 */ cpu->r[3] = rbrew_read32(cpu->mem, _t1);
-        /* 02239134 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02239138 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02239134 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02239138 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02239138 */ _t3 = _t2 & 0x00000001u;
         /* 02239138 */ if (_t3) goto L_02239180; else goto L_0223913C;
   L_0223913C: ; // 0x223913c
@@ -7565,9 +7565,9 @@ void Gambit_fn_0223912C(CPUState* cpu) {
         /* 02239140 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
         /* 02239140 */ cpu->r[9] = _t4;
         /* 02239144 */ cpu->r[4] = 0x101D0000u;
-        /* 02239148 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02239148 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0223914C */ cpu->r[4] = cpu->r[4] + 0xFFFFFBC4u;
-        /* 02239150 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02239150 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02239150 */ _t6 = _t5 & 0x00000001u;
         /* 02239150 */ if (_t6) goto L_02239154; else goto L_02239168;
   L_02239154: ; // 0x2239154
@@ -7585,8 +7585,8 @@ void Gambit_fn_0223912C(CPUState* cpu) {
         /* 0223916C */ cpu->r[10] = rbrew_read32(cpu->mem, _t10);
         /* 02239170 */ cpu->ctr = cpu->r[10];
         /* 02239174 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02239178 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223917C */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02239178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223917C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223917C */ _t12 = _t11 & 0x00000001u;
         /* 0223917C */ if (_t12) goto L_02239194; else goto L_02239180;
   L_02239180: ; // 0x2239180
@@ -7679,8 +7679,8 @@ void Gambit_fn_022391E4(CPUState* cpu) {
         /* 02239220 */ cpu->f[11] = cpu->f[12] - cpu->f[13];
         /* 02239224 */ _t9 = cpu->r[30] + 0x00000134u;
         /* 02239224 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t9);
-        /* 02239228 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[12]);
-        /* 0223922C */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02239228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[12]));
+        /* 0223922C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223922C */ _t11 = _t10 & 0x00000001u;
         /* 0223922C */ if (_t11) goto L_02239230; else goto L_02239250;
   L_02239230: ; // 0x2239230
@@ -7700,8 +7700,8 @@ void Gambit_fn_022391E4(CPUState* cpu) {
         /* 02239254 */ cpu->f[13] = cpu->f[13] - cpu->f[11];
         /* 02239258 */ _t15 = cpu->r[30] + 0x00000138u;
         /* 02239258 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t15);
-        /* 0223925C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
-        /* 02239260 */ _t16 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223925C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
+        /* 02239260 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02239260 */ _t17 = _t16 & 0x00000001u;
         /* 02239260 */ if (_t17) goto L_02239264; else goto L_02239268;
   L_02239264: ; // 0x2239264
@@ -7766,8 +7766,8 @@ void Gambit_fn_022391E8(CPUState* cpu) {
         /* 02239220 */ cpu->f[11] = cpu->f[12] - cpu->f[13];
         /* 02239224 */ _t9 = cpu->r[30] + 0x00000134u;
         /* 02239224 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t9);
-        /* 02239228 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[12]);
-        /* 0223922C */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02239228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[12]));
+        /* 0223922C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223922C */ _t11 = _t10 & 0x00000001u;
         /* 0223922C */ if (_t11) goto L_02239230; else goto L_02239250;
   L_02239230: ; // 0x2239230
@@ -7787,8 +7787,8 @@ void Gambit_fn_022391E8(CPUState* cpu) {
         /* 02239254 */ cpu->f[13] = cpu->f[13] - cpu->f[11];
         /* 02239258 */ _t15 = cpu->r[30] + 0x00000138u;
         /* 02239258 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t15);
-        /* 0223925C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[13]);
-        /* 02239260 */ _t16 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223925C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[13]));
+        /* 02239260 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02239260 */ _t17 = _t16 & 0x00000001u;
         /* 02239260 */ if (_t17) goto L_02239264; else goto L_02239268;
   L_02239264: ; // 0x2239264
@@ -7834,19 +7834,19 @@ void Gambit_fn_022392B0(CPUState* cpu) {
         /* 022392BC */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 022392BC */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 022392C0 */ cpu->r[31] = cpu->r[3];
-        /* 022392C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x0000000Fu);
+        /* 022392C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x0000000Fu));
         /* 022392C8 */ cpu->r[8] = cpu->r[7];
         /* 022392CC */ _t2 = cpu->r[1] + 0x00000014u;
         /* 022392CC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 022392D0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022392D0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022392D0 */ _t4 = _t3 & 0x00000001u;
         /* 022392D0 */ if (_t4) goto L_02239318; else goto L_022392D4;
   L_022392D4: ; // 0x22392d4
         /* 022392D4 */ _t5 = cpu->r[31] + 0x00000184u;
         /* 022392D4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 022392D8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000010u, 0x00000011u);
-        /* 022392D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022392DC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022392D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022392DC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022392DC */ _t7 = _t6 & 0x00000001u;
         /* 022392DC */ if (_t7) goto L_02239318; else goto L_022392E0;
   L_022392E0: ; // 0x22392e0
@@ -7892,19 +7892,19 @@ void Gambit_fn_022392B4(CPUState* cpu) {
         /* 022392BC */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 022392BC */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 022392C0 */ cpu->r[31] = cpu->r[3];
-        /* 022392C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x0000000Fu);
+        /* 022392C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x0000000Fu));
         /* 022392C8 */ cpu->r[8] = cpu->r[7];
         /* 022392CC */ _t2 = cpu->r[1] + 0x00000014u;
         /* 022392CC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 022392D0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022392D0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022392D0 */ _t4 = _t3 & 0x00000001u;
         /* 022392D0 */ if (_t4) goto L_02239318; else goto L_022392D4;
   L_022392D4: ; // 0x22392d4
         /* 022392D4 */ _t5 = cpu->r[31] + 0x00000184u;
         /* 022392D4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 022392D8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000010u, 0x00000011u);
-        /* 022392D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022392DC */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022392D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022392DC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022392DC */ _t7 = _t6 & 0x00000001u;
         /* 022392DC */ if (_t7) goto L_02239318; else goto L_022392E0;
   L_022392E0: ; // 0x22392e0
@@ -7946,10 +7946,10 @@ void Gambit_fn_0223932C(CPUState* cpu) {
         /* 0223932C */ _t0 = cpu->r[3] + 0x00000184u;
         /* 0223932C */ cpu->r[9] = rbrew_read32(cpu->mem, _t0);
         /* 02239330 */ cpu->r[9] = rbrew_rlwinm(cpu->r[9], 0x00000000u, 0x00000016u, 0x00000017u);
-        /* 02239330 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02239330 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02239334 */ _t1 = cpu->r[4] + 0x00000002u;
         /* 02239334 */ cpu->r[0] = rbrew_read16(cpu->mem, _t1);
-        /* 02239338 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02239338 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02239338 */ _t3 = _t2 & 0x00000001u;
         /* 02239338 */ if (_t3) goto L_0223933C; else goto L_02239360;
   L_0223933C: ; // 0x223933c
@@ -7960,7 +7960,7 @@ void Gambit_fn_0223932C(CPUState* cpu) {
         /* 02239344 */ _t6 = cpu->r[0] & 0xFFFF01FFu;
         /* 02239344 */ cpu->r[0] = _t6 | _t5;
         /* 02239348 */ cpu->r[12] = cpu->r[0] & 0x0000FEFFu;
-        /* 02239348 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02239348 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0223934C */ _t7 = cpu->r[4] + 0x00000000u;
         /* 0223934C */ rbrew_write16(cpu->mem, _t7, (uint16_t)cpu->r[11]);
         /* 02239350 */ cpu->r[0] = 0x00000000u;
@@ -8003,8 +8003,8 @@ void Gambit_fn_02239378(CPUState* cpu) {
         /* 02239394 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 02239398 */ cpu->r[29] = cpu->r[3];
         /* 0223939C */ Gambit_fn_021BC7D8(cpu);
-        /* 022393A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022393A4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022393A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022393A4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022393A4 */ _t6 = _t5 & 0x00000001u;
         /* 022393A4 */ if (_t6) goto L_022393A8; else goto L_022394D4;
   L_022393A8: ; // 0x22393a8
@@ -8116,8 +8116,8 @@ void Gambit_fn_02239378(CPUState* cpu) {
         /* 022394A4 */ _t48 = cpu->r[1] + 0x00000018u;
         /* 022394A4 */ rbrew_write_f32(cpu->mem, _t48, cpu->f[13]);
         /* 022394A8 */ Gambit_fn_027DDD78(cpu);
-        /* 022394AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022394B0 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022394AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022394B0 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022394B0 */ _t50 = _t49 & 0x00000001u;
         /* 022394B0 */ if (_t50) goto L_022394D4; else goto L_022394B4;
   L_022394B4: ; // 0x22394b4
@@ -8168,8 +8168,8 @@ void Gambit_fn_0223937C(CPUState* cpu) {
         /* 02239394 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 02239398 */ cpu->r[29] = cpu->r[3];
         /* 0223939C */ Gambit_fn_021BC7D8(cpu);
-        /* 022393A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022393A4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022393A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022393A4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022393A4 */ _t6 = _t5 & 0x00000001u;
         /* 022393A4 */ if (_t6) goto L_022393A8; else goto L_022394D4;
   L_022393A8: ; // 0x22393a8
@@ -8281,8 +8281,8 @@ void Gambit_fn_0223937C(CPUState* cpu) {
         /* 022394A4 */ _t48 = cpu->r[1] + 0x00000018u;
         /* 022394A4 */ rbrew_write_f32(cpu->mem, _t48, cpu->f[13]);
         /* 022394A8 */ Gambit_fn_027DDD78(cpu);
-        /* 022394AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022394B0 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022394AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022394B0 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022394B0 */ _t50 = _t49 & 0x00000001u;
         /* 022394B0 */ if (_t50) goto L_022394D4; else goto L_022394B4;
   L_022394B4: ; // 0x22394b4
@@ -8331,8 +8331,8 @@ void Gambit_fn_022394F4(CPUState* cpu) {
         /* 02239508 */ _t3 = cpu->r[31] + 0x00000184u;
         /* 02239508 */ cpu->r[8] = rbrew_read32(cpu->mem, _t3);
         /* 0223950C */ cpu->r[8] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0223950C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02239510 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223950C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02239510 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02239510 */ _t5 = _t4 & 0x00000001u;
         /* 02239510 */ if (_t5) goto L_02239670; else goto L_02239514;
   L_02239514: ; // 0x2239514
@@ -8389,10 +8389,10 @@ void Gambit_fn_022394F4(CPUState* cpu) {
         /* 02239588 */ cpu->f[12] = fma(cpu->f[13], cpu->f[13], cpu->f[0]);
         /* 0223958C */ _t27 = cpu->r[10] + 0x00001F20u;
         /* 0223958C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t27);
-        /* 02239590 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[13]);
+        /* 02239590 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[13]));
         /* 02239594 */ _t28 = cpu->r[1] + 0x0000000Cu;
         /* 02239594 */ rbrew_write_f32(cpu->mem, _t28, cpu->f[13]);
-        /* 02239598 */ _t29 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02239598 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02239598 */ _t30 = _t29 & 0x00000001u;
         /* 02239598 */ if (_t30) goto L_0223959C; else goto L_022395D8;
   L_0223959C: ; // 0x223959c
@@ -8423,8 +8423,8 @@ void Gambit_fn_022394F4(CPUState* cpu) {
         /* 022395E0 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 022395E4 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 022395E8 */ Gambit_fn_021C6DD8(cpu);
-        /* 022395EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022395F0 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022395EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022395F0 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022395F0 */ _t38 = _t37 & 0x00000001u;
         /* 022395F0 */ if (_t38) goto L_022395F4; else goto L_02239608;
   L_022395F4: ; // 0x22395f4
@@ -8502,8 +8502,8 @@ void Gambit_fn_022394F8(CPUState* cpu) {
         /* 02239508 */ _t3 = cpu->r[31] + 0x00000184u;
         /* 02239508 */ cpu->r[8] = rbrew_read32(cpu->mem, _t3);
         /* 0223950C */ cpu->r[8] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0223950C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02239510 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223950C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02239510 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02239510 */ _t5 = _t4 & 0x00000001u;
         /* 02239510 */ if (_t5) goto L_02239670; else goto L_02239514;
   L_02239514: ; // 0x2239514
@@ -8560,10 +8560,10 @@ void Gambit_fn_022394F8(CPUState* cpu) {
         /* 02239588 */ cpu->f[12] = fma(cpu->f[13], cpu->f[13], cpu->f[0]);
         /* 0223958C */ _t27 = cpu->r[10] + 0x00001F20u;
         /* 0223958C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t27);
-        /* 02239590 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[13]);
+        /* 02239590 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[13]));
         /* 02239594 */ _t28 = cpu->r[1] + 0x0000000Cu;
         /* 02239594 */ rbrew_write_f32(cpu->mem, _t28, cpu->f[13]);
-        /* 02239598 */ _t29 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02239598 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02239598 */ _t30 = _t29 & 0x00000001u;
         /* 02239598 */ if (_t30) goto L_0223959C; else goto L_022395D8;
   L_0223959C: ; // 0x223959c
@@ -8594,8 +8594,8 @@ void Gambit_fn_022394F8(CPUState* cpu) {
         /* 022395E0 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 022395E4 */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
         /* 022395E8 */ Gambit_fn_021C6DD8(cpu);
-        /* 022395EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022395F0 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022395EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022395F0 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022395F0 */ _t38 = _t37 & 0x00000001u;
         /* 022395F0 */ if (_t38) goto L_022395F4; else goto L_02239608;
   L_022395F4: ; // 0x22395f4
@@ -8681,16 +8681,16 @@ void Gambit_fn_02239684(CPUState* cpu) {
         /* 022396AC */ cpu->f[11] = fma(cpu->f[0], cpu->f[0], cpu->f[9]);
         /* 022396B0 */ _t5 = cpu->r[12] + 0x00001F28u;
         /* 022396B0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t5);
-        /* 022396B4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[0]);
-        /* 022396B8 */ _t6 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022396B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[0]));
+        /* 022396B8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022396B8 */ _t7 = _t6 & 0x00000001u;
         /* 022396B8 */ if (_t7) goto L_022396BC; else goto L_02239700;
   L_022396BC: ; // 0x22396bc
         /* 022396BC */ cpu->r[11] = 0x10050000u;
         /* 022396C0 */ _t8 = cpu->r[11] + 0x00001F20u;
         /* 022396C0 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t8);
-        /* 022396C4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[10]);
-        /* 022396C8 */ _t9 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022396C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[10]));
+        /* 022396C8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022396C8 */ _t10 = _t9 & 0x00000001u;
         /* 022396C8 */ if (_t10) goto L_022396CC; else goto L_02239700;
   L_022396CC: ; // 0x22396cc
@@ -8745,16 +8745,16 @@ void Gambit_fn_02239688(CPUState* cpu) {
         /* 022396AC */ cpu->f[11] = fma(cpu->f[0], cpu->f[0], cpu->f[9]);
         /* 022396B0 */ _t5 = cpu->r[12] + 0x00001F28u;
         /* 022396B0 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t5);
-        /* 022396B4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[0]);
-        /* 022396B8 */ _t6 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022396B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[0]));
+        /* 022396B8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022396B8 */ _t7 = _t6 & 0x00000001u;
         /* 022396B8 */ if (_t7) goto L_022396BC; else goto L_02239700;
   L_022396BC: ; // 0x22396bc
         /* 022396BC */ cpu->r[11] = 0x10050000u;
         /* 022396C0 */ _t8 = cpu->r[11] + 0x00001F20u;
         /* 022396C0 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t8);
-        /* 022396C4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[10]);
-        /* 022396C8 */ _t9 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022396C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[10]));
+        /* 022396C8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022396C8 */ _t10 = _t9 & 0x00000001u;
         /* 022396C8 */ if (_t10) goto L_022396CC; else goto L_02239700;
   L_022396CC: ; // 0x22396cc
@@ -8907,8 +8907,8 @@ void Gambit_fn_022397A8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19, _t20, _t21, _t22, _t23, _t24, _t25, _t26, _t27, _t28;
 
   L_022397A8: ; // 0x22397a8
-        /* 022397A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 022397AC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022397A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 022397AC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022397AC */ _t1 = _t0 & 0x00000001u;
         /* 022397AC */ if (_t1) goto L_02239854; else goto L_022397B0;
   L_022397B0: ; // 0x22397b0
@@ -8916,8 +8916,8 @@ void Gambit_fn_022397A8(CPUState* cpu) {
         /* 022397B0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t2);
         /* 022397B4 */ _t3 = cpu->r[3] + 0x0000002Cu;
         /* 022397B4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 022397B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[0]);
-        /* 022397BC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022397B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[0]));
+        /* 022397BC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022397BC */ _t5 = _t4 & 0x00000001u;
         /* 022397BC */ if (_t5) goto L_02239854; else goto L_022397C0;
   L_022397C0: ; // 0x22397c0
@@ -8933,10 +8933,10 @@ void Gambit_fn_022397A8(CPUState* cpu) {
         /* 022397D8 */ _t8 = cpu->r[10] + 0x00000004u;
         /* 022397D8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t8);
         /* 022397DC */ cpu->r[7] = cpu->r[7] + cpu->r[9];
-        /* 022397E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], cpu->r[8]);
+        /* 022397E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], cpu->r[8]));
         /* 022397E4 */ _t9 = cpu->r[10] + 0x00000000u;
         /* 022397E4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t9);
-        /* 022397E8 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022397E8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022397E8 */ _t11 = _t10 & 0x00000001u;
         /* 022397E8 */ if (_t11) goto L_022397F0; else goto L_022397EC;
   L_022397EC: ; // 0x22397ec
@@ -8945,8 +8945,8 @@ void Gambit_fn_022397A8(CPUState* cpu) {
         /* 022397F0 */ cpu->r[12] = rbrew_rlwinm(cpu->r[7], 0x00000002u, 0x00000000u, 0x0000001Du);
         /* 022397F4 */ _t12 = cpu->r[12] + cpu->r[5];
         /* 022397F4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t12);
-        /* 022397F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[4]);
-        /* 022397FC */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022397F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[4]));
+        /* 022397FC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022397FC */ _t14 = _t13 & 0x00000001u;
         /* 022397FC */ if (_t14) goto L_02239800; else goto L_02239808;
   L_02239800: ; // 0x2239800
@@ -8955,20 +8955,20 @@ void Gambit_fn_022397A8(CPUState* cpu) {
   L_02239808: ; // 0x2239808
         /* 02239808 */ cpu->r[9] = cpu->r[9] + 0x00000001u;
   L_0223980C: ; // 0x223980c
-        /* 0223980C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 02239810 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223980C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 02239810 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02239810 */ _t16 = _t15 & 0x00000001u;
         /* 02239810 */ if (_t16) goto L_022397D4; else goto L_02239814;
   L_02239814: ; // 0x2239814
-        /* 02239814 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[11]);
-        /* 02239818 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02239814 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[11]));
+        /* 02239818 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02239818 */ _t18 = _t17 & 0x00000001u;
         /* 02239818 */ if (_t18) goto L_0223981C; else goto L_022397D4;
   L_0223981C: ; // 0x223981c
         /* 0223981C */ _t19 = cpu->r[10] + 0x00000004u;
         /* 0223981C */ cpu->r[0] = rbrew_read32(cpu->mem, _t19);
-        /* 02239820 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], cpu->r[0]);
-        /* 02239824 */ _t20 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02239820 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], cpu->r[0]));
+        /* 02239824 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02239824 */ _t21 = _t20 & 0x00000001u;
         /* 02239824 */ if (_t21) goto L_02239828; else goto L_02239854;
   L_02239828: ; // 0x2239828
@@ -8980,10 +8980,10 @@ void Gambit_fn_022397A8(CPUState* cpu) {
         /* 02239834 */ cpu->r[11] = cpu->r[11] + 0x00000001u;
         /* 02239838 */ _t24 = cpu->r[10] + 0x0000000Cu;
         /* 02239838 */ rbrew_write32(cpu->mem, _t24, cpu->r[11]);
-        /* 0223983C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[6]);
+        /* 0223983C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[6]));
         /* 02239840 */ _t25 = cpu->r[10] + 0x00000000u;
         /* 02239840 */ cpu->r[8] = rbrew_read32(cpu->mem, _t25);
-        /* 02239844 */ _t26 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02239844 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02239844 */ _t27 = _t26 & 0x00000001u;
         /* 02239844 */ if (_t27) goto L_0223984C; else goto L_02239848;
   L_02239848: ; // 0x2239848
@@ -9046,9 +9046,9 @@ void Gambit_fn_0223985C(CPUState* cpu) {
         /* 022398B8 */ _t16 = cpu->r[31] + 0x00000114u;
         /* 022398B8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 022398BC */ cpu->r[7] = rbrew_rlwinm(cpu->r[7], 0x00000000u, 0x0000000Cu, 0x0000000Du);
-        /* 022398BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 022398BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 022398C0 */ cpu->r[30] = cpu->r[4];
-        /* 022398C4 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022398C4 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022398C4 */ _t18 = _t17 & 0x00000001u;
         /* 022398C4 */ if (_t18) goto L_02239EFC; else goto L_022398C8;
   L_022398C8: ; // 0x22398c8
@@ -9151,7 +9151,7 @@ void Gambit_fn_0223985C(CPUState* cpu) {
         /* 022399A4 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t59);
         /* 022399A8 */ _t60 = cpu->r[1] + 0x00000044u;
         /* 022399A8 */ rbrew_write_f32(cpu->mem, _t60, cpu->f[31]);
-        /* 022399AC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[12]);
+        /* 022399AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[12]));
         /* 022399B0 */ _t61 = cpu->r[1] + 0x000000F0u;
         /* 022399B0 */ rbrew_write32(cpu->mem, _t61, cpu->r[7]);
         /* 022399B4 */ _t62 = cpu->r[1] + 0x00000100u;
@@ -9175,14 +9175,14 @@ void Gambit_fn_0223985C(CPUState* cpu) {
         /* 022399D8 */ rbrew_write32(cpu->mem, _t70, cpu->r[11]);
         /* 022399DC */ _t71 = cpu->r[1] + 0x000000FCu;
         /* 022399DC */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t71);
-        /* 022399E0 */ _t72 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022399E0 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022399E0 */ _t73 = _t72 & 0x00000001u;
         /* 022399E0 */ if (_t73) goto L_022399E4; else goto L_022399F4;
   L_022399E4: ; // 0x22399e4
-        /* 022399E4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[7]);
+        /* 022399E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[7]));
         /* 022399E8 */ _t74 = cpu->r[1] + 0x00000010u;
         /* 022399E8 */ rbrew_write_f32(cpu->mem, _t74, cpu->f[12]);
-        /* 022399EC */ _t75 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022399EC */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022399EC */ _t76 = _t75 & 0x00000001u;
         /* 022399EC */ if (_t76) goto L_02239A10; else goto L_022399F0;
   L_022399F0: ; // 0x22399f0
@@ -9190,17 +9190,17 @@ void Gambit_fn_0223985C(CPUState* cpu) {
   L_022399F4: ; // 0x22399f4
         /* 022399F4 */ _t77 = cpu->r[1] + 0x000000D8u;
         /* 022399F4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t77);
-        /* 022399F8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[0]);
-        /* 022399FC */ _t78 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022399F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[0]));
+        /* 022399FC */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022399FC */ _t79 = _t78 & 0x00000001u;
         /* 022399FC */ if (_t79) goto L_02239A00; else goto L_02239A04;
   L_02239A00: ; // 0x2239a00
         /* 02239A00 */ cpu->f[11] = cpu->f[0];
   L_02239A04: ; // 0x2239a04
-        /* 02239A04 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[7]);
+        /* 02239A04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[7]));
         /* 02239A08 */ _t80 = cpu->r[1] + 0x00000010u;
         /* 02239A08 */ rbrew_write_f32(cpu->mem, _t80, cpu->f[11]);
-        /* 02239A0C */ _t81 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02239A0C */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02239A0C */ _t82 = _t81 & 0x00000001u;
         /* 02239A0C */ if (_t82) goto L_02239A10; else goto L_02239A84;
   L_02239A10: ; // 0x2239a10
@@ -9235,12 +9235,12 @@ void Gambit_fn_0223985C(CPUState* cpu) {
         /* 02239A60 */ _t90 = cpu->r[1] + 0x0000002Cu;
         /* 02239A60 */ rbrew_write_f32(cpu->mem, _t90, cpu->f[0]);
         /* 02239A64 */ cpu->r[28] = 0x101C0000u;
-        /* 02239A68 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[13]);
+        /* 02239A68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[13]));
         /* 02239A6C */ cpu->r[29] = 0x101E0000u;
         /* 02239A70 */ cpu->r[28] = cpu->r[28] + 0x00001EF8u;
         /* 02239A74 */ cpu->r[29] = cpu->r[29] + 0xFFFF958Cu;
         /* 02239A78 */ /* nop */
-        /* 02239A7C */ _t91 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02239A7C */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02239A7C */ _t92 = _t91 & 0x00000001u;
         /* 02239A7C */ if (_t92) goto L_02239A80; else goto L_02239B64;
   L_02239A80: ; // 0x2239a80
@@ -9248,8 +9248,8 @@ void Gambit_fn_0223985C(CPUState* cpu) {
   L_02239A84: ; // 0x2239a84
         /* 02239A84 */ _t93 = cpu->r[1] + 0x000000F0u;
         /* 02239A84 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t93);
-        /* 02239A88 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[8]);
-        /* 02239A8C */ _t94 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02239A88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[8]));
+        /* 02239A8C */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02239A8C */ _t95 = _t94 & 0x00000001u;
         /* 02239A8C */ if (_t95) goto L_02239A90; else goto L_02239A94;
   L_02239A90: ; // 0x2239a90
@@ -9286,12 +9286,12 @@ void Gambit_fn_0223985C(CPUState* cpu) {
         /* 02239AE4 */ _t103 = cpu->r[1] + 0x0000002Cu;
         /* 02239AE4 */ rbrew_write_f32(cpu->mem, _t103, cpu->f[0]);
         /* 02239AE8 */ cpu->r[28] = 0x101C0000u;
-        /* 02239AEC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[13]);
+        /* 02239AEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[13]));
         /* 02239AF0 */ cpu->r[29] = 0x101E0000u;
         /* 02239AF4 */ cpu->r[28] = cpu->r[28] + 0x00001EF8u;
         /* 02239AF8 */ cpu->r[29] = cpu->r[29] + 0xFFFF958Cu;
         /* 02239AFC */ /* nop */
-        /* 02239B00 */ _t104 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02239B00 */ _t104 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02239B00 */ _t105 = _t104 & 0x00000001u;
         /* 02239B00 */ if (_t105) goto L_02239B04; else goto L_02239B64;
   L_02239B04: ; // 0x2239b04
@@ -9299,15 +9299,15 @@ void Gambit_fn_0223985C(CPUState* cpu) {
         /* 02239B04 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t106);
         /* 02239B08 */ _t107 = cpu->r[11] + 0x00000004u;
         /* 02239B08 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t107);
-        /* 02239B0C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[8]);
-        /* 02239B10 */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02239B0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[8]));
+        /* 02239B10 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02239B10 */ _t109 = _t108 & 0x00000001u;
         /* 02239B10 */ if (_t109) goto L_02239B14; else goto L_02239B64;
   L_02239B14: ; // 0x2239b14
         /* 02239B14 */ _t110 = cpu->r[11] + 0x00000008u;
         /* 02239B14 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t110);
-        /* 02239B18 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[9]);
-        /* 02239B1C */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02239B18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[9]));
+        /* 02239B1C */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02239B1C */ _t112 = _t111 & 0x00000001u;
         /* 02239B1C */ if (_t112) goto L_02239B20; else goto L_02239B64;
   L_02239B20: ; // 0x2239b20
@@ -9329,10 +9329,10 @@ void Gambit_fn_0223985C(CPUState* cpu) {
         /* 02239B4C */ rbrew_write32(cpu->mem, _t116, cpu->r[0]);
         /* 02239B50 */ Gambit_fn_0204A4DC(cpu);
         /* 02239B54 */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02239B54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02239B54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02239B58 */ _t117 = cpu->r[1] + 0x00000054u;
         /* 02239B58 */ rbrew_write32(cpu->mem, _t117, cpu->r[3]);
-        /* 02239B5C */ _t118 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02239B5C */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02239B5C */ _t119 = _t118 & 0x00000001u;
         /* 02239B5C */ if (_t119) goto L_02239E78; else goto L_02239B60;
   L_02239B60: ; // 0x2239b60
@@ -9417,12 +9417,12 @@ void Gambit_fn_0223985C(CPUState* cpu) {
         /* 02239C1C */ cpu->f[12] = fma(cpu->f[0], cpu->f[0], cpu->f[13]);
         /* 02239C20 */ _t150 = cpu->r[10] + 0x00001F30u;
         /* 02239C20 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t150);
-        /* 02239C24 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[31]);
+        /* 02239C24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[31]));
         /* 02239C28 */ _t151 = cpu->r[1] + 0x00000018u;
         /* 02239C28 */ rbrew_write_f32(cpu->mem, _t151, cpu->f[9]);
         /* 02239C2C */ _t152 = cpu->r[1] + 0x0000007Cu;
         /* 02239C2C */ rbrew_write_f32(cpu->mem, _t152, cpu->f[8]);
-        /* 02239C30 */ _t153 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02239C30 */ _t153 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02239C30 */ _t154 = _t153 & 0x00000001u;
         /* 02239C30 */ if (_t154) goto L_02239C34; else goto L_02239C64;
   L_02239C34: ; // 0x2239c34
@@ -9497,10 +9497,10 @@ void Gambit_fn_0223985C(CPUState* cpu) {
         /* 02239CE4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t177);
         /* 02239CE8 */ /* nop */
         /* 02239CEC */ cpu->f[9] = fma(cpu->f[9], cpu->f[0], cpu->f[8]);
-        /* 02239CF0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[31]);
+        /* 02239CF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[31]));
         /* 02239CF4 */ _t178 = cpu->r[1] + 0x00000020u;
         /* 02239CF4 */ rbrew_write_f32(cpu->mem, _t178, cpu->f[12]);
-        /* 02239CF8 */ _t179 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02239CF8 */ _t179 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02239CF8 */ _t180 = _t179 & 0x00000001u;
         /* 02239CF8 */ if (_t180) goto L_02239CFC; else goto L_02239D30;
   L_02239CFC: ; // 0x2239cfc
@@ -9517,10 +9517,10 @@ void Gambit_fn_0223985C(CPUState* cpu) {
         /* 02239D14 */ cpu->f[9] = cpu->f[12] - cpu->f[0];
         /* 02239D18 */ cpu->f[8] = fma(cpu->f[7], cpu->f[7], cpu->f[8]);
         /* 02239D1C */ cpu->f[30] = fma(cpu->f[9], cpu->f[9], cpu->f[8]);
-        /* 02239D20 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
+        /* 02239D20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
         /* 02239D24 */ _t185 = cpu->r[1] + 0x00000038u;
         /* 02239D24 */ rbrew_write_f32(cpu->mem, _t185, cpu->f[9]);
-        /* 02239D28 */ _t186 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02239D28 */ _t186 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02239D28 */ _t187 = _t186 & 0x00000001u;
         /* 02239D28 */ if (_t187) goto L_02239D2C; else goto L_02239DA8;
   L_02239D2C: ; // 0x2239d2c
@@ -9549,10 +9549,10 @@ void Gambit_fn_0223985C(CPUState* cpu) {
         /* 02239D60 */ rbrew_write_f32(cpu->mem, _t195, cpu->f[9]);
         /* 02239D64 */ cpu->f[8] = fma(cpu->f[7], cpu->f[7], cpu->f[8]);
         /* 02239D68 */ cpu->f[30] = fma(cpu->f[9], cpu->f[9], cpu->f[8]);
-        /* 02239D6C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
+        /* 02239D6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
         /* 02239D70 */ _t196 = cpu->r[1] + 0x00000020u;
         /* 02239D70 */ rbrew_write_f32(cpu->mem, _t196, cpu->f[12]);
-        /* 02239D74 */ _t197 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02239D74 */ _t197 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02239D74 */ _t198 = _t197 & 0x00000001u;
         /* 02239D74 */ if (_t198) goto L_02239D78; else goto L_02239DA8;
   L_02239D78: ; // 0x2239d78
@@ -9573,12 +9573,12 @@ void Gambit_fn_0223985C(CPUState* cpu) {
         /* 02239DA4 */ _t202 = cpu->r[1] + 0x00000038u;
         /* 02239DA4 */ rbrew_write_f32(cpu->mem, _t202, cpu->f[8]);
   L_02239DA8: ; // 0x2239da8
-        /* 02239DA8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
+        /* 02239DA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
         /* 02239DAC */ _t203 = cpu->r[28] + 0x00000000u;
         /* 02239DAC */ cpu->r[3] = rbrew_read32(cpu->mem, _t203);
         /* 02239DB0 */ _t204 = cpu->r[29] + 0x00000000u;
         /* 02239DB0 */ cpu->f[3] = rbrew_read_f32(cpu->mem, _t204);
-        /* 02239DB4 */ _t205 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02239DB4 */ _t205 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02239DB4 */ _t206 = _t205 & 0x00000001u;
         /* 02239DB4 */ if (_t206) goto L_02239DB8; else goto L_02239DF8;
   L_02239DB8: ; // 0x2239db8
@@ -9597,18 +9597,18 @@ void Gambit_fn_0223985C(CPUState* cpu) {
         /* 02239DE0 */ cpu->r[10] = cpu->r[7];
         /* 02239DE4 */ Gambit_fn_0204A4DC(cpu);
         /* 02239DE8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02239DE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02239DE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02239DEC */ _t209 = cpu->r[1] + 0x00000054u;
         /* 02239DEC */ rbrew_write32(cpu->mem, _t209, cpu->r[3]);
-        /* 02239DF0 */ _t210 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02239DF0 */ _t210 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02239DF0 */ _t211 = _t210 & 0x00000001u;
         /* 02239DF0 */ if (_t211) goto L_02239E78; else goto L_02239DF4;
   L_02239DF4: ; // 0x2239df4
         /* 02239DF4 */ goto L_02239EAC;
   L_02239DF8: ; // 0x2239df8
         /* 02239DF8 */ cpu->f[1] = cpu->f[30] + cpu->f[28];
-        /* 02239DFC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
-        /* 02239E00 */ _t212 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02239DFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
+        /* 02239E00 */ _t212 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02239E00 */ _t213 = _t212 & 0x00000001u;
         /* 02239E00 */ if (_t213) goto L_02239E44; else goto L_02239E04;
   L_02239E04: ; // 0x2239e04
@@ -9627,10 +9627,10 @@ void Gambit_fn_0223985C(CPUState* cpu) {
         /* 02239E2C */ cpu->r[8] = 0x000001FFu;
         /* 02239E30 */ Gambit_fn_0204A4DC(cpu);
         /* 02239E34 */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02239E34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02239E34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02239E38 */ _t216 = cpu->r[1] + 0x00000054u;
         /* 02239E38 */ rbrew_write32(cpu->mem, _t216, cpu->r[3]);
-        /* 02239E3C */ _t217 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02239E3C */ _t217 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02239E3C */ _t218 = _t217 & 0x00000001u;
         /* 02239E3C */ if (_t218) goto L_02239E78; else goto L_02239E40;
   L_02239E40: ; // 0x2239e40
@@ -9649,23 +9649,23 @@ void Gambit_fn_0223985C(CPUState* cpu) {
         /* 02239E64 */ cpu->r[7] = 0x000001FFu;
         /* 02239E68 */ Gambit_fn_0204A864(cpu);
         /* 02239E6C */ cpu->r[0] = rbrew_rlwinm(cpu->r[3], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02239E6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02239E6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02239E70 */ _t221 = cpu->r[1] + 0x00000054u;
         /* 02239E70 */ rbrew_write32(cpu->mem, _t221, cpu->r[3]);
-        /* 02239E74 */ _t222 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02239E74 */ _t222 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02239E74 */ _t223 = _t222 & 0x00000001u;
         /* 02239E74 */ if (_t223) goto L_02239E78; else goto L_02239EAC;
   L_02239E78: ; // 0x2239e78
         /* 02239E78 */ cpu->r[3] = 0x101C0000u;
         /* 02239E7C */ _t224 = cpu->r[3] + 0x00005B90u;
         /* 02239E7C */ cpu->r[3] = rbrew_read32(cpu->mem, _t224);
-        /* 02239E80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02239E84 */ _t225 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02239E80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02239E84 */ _t225 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02239E84 */ _t226 = _t225 & 0x00000001u;
         /* 02239E84 */ if (_t226) goto L_02239EFC; else goto L_02239E88;
   L_02239E88: ; // 0x2239e88
-        /* 02239E88 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
-        /* 02239E8C */ _t227 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02239E88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
+        /* 02239E8C */ _t227 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02239E8C */ _t228 = _t227 & 0x00000001u;
         /* 02239E8C */ if (_t228) goto L_02239E90; else goto L_02239EFC;
   L_02239E90: ; // 0x2239e90
@@ -9675,8 +9675,8 @@ void Gambit_fn_0223985C(CPUState* cpu) {
         /* 02239E98 */ cpu->r[5] = cpu->r[1] + 0x00000030u;
         /* 02239E9C */ cpu->r[4] = cpu->r[1] + 0x0000000Cu;
         /* 02239EA0 */ Gambit_fn_02399D90(cpu);
-        /* 02239EA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02239EA8 */ _t230 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02239EA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02239EA8 */ _t230 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02239EA8 */ _t231 = _t230 & 0x00000001u;
         /* 02239EA8 */ if (_t231) goto L_02239EFC; else goto L_02239EAC;
   L_02239EAC: ; // 0x2239eac
@@ -9709,7 +9709,7 @@ void Gambit_fn_0223985C(CPUState* cpu) {
         /* 02239EE0 */ _t245 = cpu->r[1] + 0x00000128u;
         /* 02239EE0 */ cpu->r[30] = rbrew_read32(cpu->mem, _t245);
         /* 02239EE4 */ cpu->r[3] = 0x00000001u;
-        /* 02239EE8 */ _t246 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02239EE8 */ _t246 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02239EE8 */ _t247 = _t246 & 0x00000001u;
         /* 02239EE8 */ if (_t247) goto L_02239EEC; // else: addr-0 trap, fall-through
   L_02239EEC: ; // 0x2239eec
@@ -9748,7 +9748,7 @@ void Gambit_fn_0223985C(CPUState* cpu) {
         /* 02239F30 */ _t262 = cpu->r[1] + 0x00000128u;
         /* 02239F30 */ cpu->r[30] = rbrew_read32(cpu->mem, _t262);
         /* 02239F34 */ cpu->r[3] = 0x00000000u;
-        /* 02239F38 */ _t263 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02239F38 */ _t263 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02239F38 */ _t264 = _t263 & 0x00000001u;
         /* 02239F38 */ if (_t264) goto L_02239F3C; // else: addr-0 trap, fall-through
   L_02239F3C: ; // 0x2239f3c
@@ -10017,15 +10017,15 @@ void Gambit_fn_0223A070(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0223A070: ; // 0x223a070
-        /* 0223A070 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223A074 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A070 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223A074 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A074 */ _t1 = _t0 & 0x00000001u;
         /* 0223A074 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0223A074 */ goto L_0223A078;
   L_0223A078: ; // 0x223a078
         /* 0223A078 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0223A078 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223A07C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A078 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223A07C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A07C */ _t3 = _t2 & 0x00000001u;
         /* 0223A07C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0223A07C */ goto L_0223A080;
@@ -10044,8 +10044,8 @@ void Gambit_fn_0223A070(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -10059,15 +10059,15 @@ void Gambit_fn_0223A070(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -10152,8 +10152,8 @@ void Gambit_fn_0223A0A8(CPUState* cpu) {
         /* 0223A0A8 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0223A0A8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223A0AC */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 0223A0AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0223A0B0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A0AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0223A0B0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A0B0 */ _t2 = _t1 & 0x00000001u;
         /* 0223A0B0 */ _t3 = _t2 ^ 0x00000001u;
         /* 0223A0B0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -10175,8 +10175,8 @@ void Gambit_fn_0223A0C4(CPUState* cpu) {
         /* 0223A0C4 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0223A0C4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223A0C8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 0223A0C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0223A0CC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A0C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0223A0CC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A0CC */ _t2 = _t1 & 0x00000001u;
         /* 0223A0CC */ _t3 = _t2 ^ 0x00000001u;
         /* 0223A0CC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -10198,8 +10198,8 @@ void Gambit_fn_0223A0E0(CPUState* cpu) {
         /* 0223A0E0 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0223A0E0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223A0E4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 0223A0E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0223A0E8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A0E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0223A0E8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A0E8 */ _t2 = _t1 & 0x00000001u;
         /* 0223A0E8 */ _t3 = _t2 ^ 0x00000001u;
         /* 0223A0E8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -10242,8 +10242,8 @@ void Gambit_fn_0223A10C(CPUState* cpu) {
         /* 0223A11C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0223A120 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0223A120 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0223A124 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0223A128 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A124 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0223A128 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A128 */ _t5 = _t4 & 0x00000001u;
         /* 0223A128 */ if (_t5) goto L_0223A12C; else goto L_0223A148;
   L_0223A12C: ; // 0x223a12c
@@ -10282,8 +10282,8 @@ void Gambit_fn_0223A110(CPUState* cpu) {
         /* 0223A11C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0223A120 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0223A120 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0223A124 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0223A128 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A124 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0223A128 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A128 */ _t5 = _t4 & 0x00000001u;
         /* 0223A128 */ if (_t5) goto L_0223A12C; else goto L_0223A148;
   L_0223A12C: ; // 0x223a12c
@@ -10682,8 +10682,8 @@ void Gambit_fn_0223A2D8(CPUState* cpu) {
         /* 0223A2D8 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 0223A2D8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223A2DC */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0223A2DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223A2E0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A2DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223A2E0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A2E0 */ _t2 = _t1 & 0x00000001u;
         /* 0223A2E0 */ if (_t2) goto L_0223A2F0; else goto L_0223A2E4;
   L_0223A2E4: ; // 0x223a2e4
@@ -10710,8 +10710,8 @@ void Gambit_fn_0223A2FC(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -10772,10 +10772,10 @@ void Gambit_fn_0223A324(CPUState* cpu) {
         /* 0223A324 */ cpu->r[10] = 0x101D0000u;
         /* 0223A328 */ _t0 = cpu->r[10] + 0xFFFFFDB8u;
         /* 0223A328 */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 0223A32C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0223A32C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0223A330 */ cpu->r[10] = 0x101D0000u;
         /* 0223A334 */ cpu->r[10] = cpu->r[10] + 0xFFFFFF8Cu;
-        /* 0223A338 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A338 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A338 */ _t2 = _t1 & 0x00000001u;
         /* 0223A338 */ if (_t2) goto L_0223A33C; else goto L_0223A354;
   L_0223A33C: ; // 0x223a33c
@@ -10788,8 +10788,8 @@ void Gambit_fn_0223A324(CPUState* cpu) {
         /* 0223A350 */ _t4 = cpu->r[10] + 0x00000000u;
         /* 0223A350 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_0223A354: ; // 0x223a354
-        /* 0223A354 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0223A358 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A354 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0223A358 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A358 */ _t6 = _t5 & 0x00000001u;
         /* 0223A358 */ if (_t6) goto L_0223A35C; else goto L_0223A364;
   L_0223A35C: ; // 0x223a35c
@@ -10800,9 +10800,9 @@ void Gambit_fn_0223A324(CPUState* cpu) {
         /* 0223A368 */ _t7 = cpu->r[9] + 0xFFFFDA00u;
         /* 0223A368 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 0223A36C */ cpu->r[11] = 0x101D0000u;
-        /* 0223A370 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0223A370 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0223A374 */ cpu->r[11] = cpu->r[11] + 0xFFFFFBFCu;
-        /* 0223A378 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A378 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A378 */ _t9 = _t8 & 0x00000001u;
         /* 0223A378 */ if (_t9) goto L_0223A37C; else goto L_0223A394;
   L_0223A37C: ; // 0x223a37c
@@ -10815,8 +10815,8 @@ void Gambit_fn_0223A324(CPUState* cpu) {
         /* 0223A390 */ _t11 = cpu->r[11] + 0x00000000u;
         /* 0223A390 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_0223A394: ; // 0x223a394
-        /* 0223A394 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 0223A398 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A394 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 0223A398 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A398 */ _t13 = _t12 & 0x00000001u;
         /* 0223A398 */ if (_t13) goto L_0223A39C; else goto L_0223A3A4;
   L_0223A39C: ; // 0x223a39c
@@ -10827,9 +10827,9 @@ void Gambit_fn_0223A324(CPUState* cpu) {
         /* 0223A3A8 */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 0223A3A8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 0223A3AC */ cpu->r[9] = 0x101D0000u;
-        /* 0223A3B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0223A3B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0223A3B4 */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 0223A3B8 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A3B8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A3B8 */ _t16 = _t15 & 0x00000001u;
         /* 0223A3B8 */ if (_t16) goto L_0223A3BC; else goto L_0223A3D4;
   L_0223A3BC: ; // 0x223a3bc
@@ -10842,8 +10842,8 @@ void Gambit_fn_0223A324(CPUState* cpu) {
         /* 0223A3D0 */ _t18 = cpu->r[9] + 0x00000000u;
         /* 0223A3D0 */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_0223A3D4: ; // 0x223a3d4
-        /* 0223A3D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 0223A3D8 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A3D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 0223A3D8 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A3D8 */ _t20 = _t19 & 0x00000001u;
         /* 0223A3D8 */ if (_t20) goto L_0223A3DC; else goto L_0223A3E4;
   L_0223A3DC: ; // 0x223a3dc
@@ -10855,9 +10855,9 @@ void Gambit_fn_0223A324(CPUState* cpu) {
         /* 0223A3E8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 0223A3E8 */ cpu->r[9] = _t21;
         /* 0223A3EC */ cpu->r[10] = 0x101D0000u;
-        /* 0223A3F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0223A3F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0223A3F4 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 0223A3F8 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A3F8 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A3F8 */ _t23 = _t22 & 0x00000001u;
         /* 0223A3F8 */ if (_t23) goto L_0223A3FC; else goto L_0223A410;
   L_0223A3FC: ; // 0x223a3fc
@@ -10869,8 +10869,8 @@ void Gambit_fn_0223A324(CPUState* cpu) {
         /* 0223A40C */ _t25 = cpu->r[10] + 0x00000000u;
         /* 0223A40C */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_0223A410: ; // 0x223a410
-        /* 0223A410 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0223A414 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A410 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0223A414 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A414 */ _t27 = _t26 & 0x00000001u;
         /* 0223A414 */ if (_t27) goto L_0223A418; else goto L_0223A420;
   L_0223A418: ; // 0x223a418
@@ -10882,9 +10882,9 @@ void Gambit_fn_0223A324(CPUState* cpu) {
         /* 0223A424 */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 0223A424 */ cpu->r[10] = _t28;
         /* 0223A428 */ cpu->r[11] = 0x101D0000u;
-        /* 0223A42C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0223A42C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0223A430 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 0223A434 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A434 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A434 */ _t30 = _t29 & 0x00000001u;
         /* 0223A434 */ if (_t30) goto L_0223A438; else goto L_0223A44C;
   L_0223A438: ; // 0x223a438
@@ -10961,15 +10961,15 @@ void Gambit_fn_0223A49C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0223A49C: ; // 0x223a49c
-        /* 0223A49C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223A4A0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A49C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223A4A0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A4A0 */ _t1 = _t0 & 0x00000001u;
         /* 0223A4A0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0223A4A0 */ goto L_0223A4A4;
   L_0223A4A4: ; // 0x223a4a4
         /* 0223A4A4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0223A4A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223A4A8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A4A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223A4A8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A4A8 */ _t3 = _t2 & 0x00000001u;
         /* 0223A4A8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0223A4A8 */ goto L_0223A4AC;
@@ -10988,8 +10988,8 @@ void Gambit_fn_0223A49C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -11003,15 +11003,15 @@ void Gambit_fn_0223A49C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -11039,15 +11039,15 @@ void Gambit_fn_0223A4B0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0223A4B0: ; // 0x223a4b0
-        /* 0223A4B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223A4B4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A4B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223A4B4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A4B4 */ _t1 = _t0 & 0x00000001u;
         /* 0223A4B4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0223A4B4 */ goto L_0223A4B8;
   L_0223A4B8: ; // 0x223a4b8
         /* 0223A4B8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0223A4B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223A4BC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A4B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223A4BC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A4BC */ _t3 = _t2 & 0x00000001u;
         /* 0223A4BC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0223A4BC */ goto L_0223A4C0;
@@ -11066,8 +11066,8 @@ void Gambit_fn_0223A4B0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -11081,15 +11081,15 @@ void Gambit_fn_0223A4B0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -11123,18 +11123,18 @@ void Gambit_fn_0223A4C8(CPUState* cpu) {
         /* 0223A4CC */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0223A4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0223A4D0 */ cpu->r[31] = cpu->r[3];
-        /* 0223A4D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0223A4D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0223A4D4 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0223A4D4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0223A4D8 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A4D8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A4D8 */ _t4 = _t3 & 0x00000001u;
         /* 0223A4D8 */ if (_t4) goto L_0223A4DC; else goto L_0223A4EC;
   L_0223A4DC: ; // 0x223a4dc
         /* 0223A4DC */ cpu->r[3] = 0x00000184u;
         /* 0223A4E0 */ Gambit_fn_02801A78(cpu);
         /* 0223A4E4 */ cpu->r[31] = cpu->r[3];
-        /* 0223A4E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0223A4E8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A4E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0223A4E8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A4E8 */ _t6 = _t5 & 0x00000001u;
         /* 0223A4E8 */ if (_t6) goto L_0223A500; else goto L_0223A4EC;
   L_0223A4EC: ; // 0x223a4ec
@@ -11455,8 +11455,8 @@ void Gambit_fn_0223A64C(CPUState* cpu) {
         /* 0223A64C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0223A64C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223A650 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 0223A650 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0223A654 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A650 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0223A654 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A654 */ _t2 = _t1 & 0x00000001u;
         /* 0223A654 */ _t3 = _t2 ^ 0x00000001u;
         /* 0223A654 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -11478,8 +11478,8 @@ void Gambit_fn_0223A668(CPUState* cpu) {
         /* 0223A668 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0223A668 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223A66C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 0223A66C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0223A670 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A66C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0223A670 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A670 */ _t2 = _t1 & 0x00000001u;
         /* 0223A670 */ _t3 = _t2 ^ 0x00000001u;
         /* 0223A670 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -11501,8 +11501,8 @@ void Gambit_fn_0223A684(CPUState* cpu) {
         /* 0223A684 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0223A684 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223A688 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 0223A688 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0223A68C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A688 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0223A68C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A68C */ _t2 = _t1 & 0x00000001u;
         /* 0223A68C */ _t3 = _t2 ^ 0x00000001u;
         /* 0223A68C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -11545,8 +11545,8 @@ void Gambit_fn_0223A6B0(CPUState* cpu) {
         /* 0223A6C0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0223A6C4 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0223A6C4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0223A6C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0223A6CC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A6C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0223A6CC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A6CC */ _t5 = _t4 & 0x00000001u;
         /* 0223A6CC */ if (_t5) goto L_0223A6D0; else goto L_0223A6EC;
   L_0223A6D0: ; // 0x223a6d0
@@ -11585,8 +11585,8 @@ void Gambit_fn_0223A6B4(CPUState* cpu) {
         /* 0223A6C0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0223A6C4 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0223A6C4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0223A6C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0223A6CC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A6C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0223A6CC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A6CC */ _t5 = _t4 & 0x00000001u;
         /* 0223A6CC */ if (_t5) goto L_0223A6D0; else goto L_0223A6EC;
   L_0223A6D0: ; // 0x223a6d0
@@ -12034,8 +12034,8 @@ void Gambit_fn_0223A8B4(CPUState* cpu) {
         /* 0223A8B4 */ _t0 = cpu->r[3] + 0x00000114u;
         /* 0223A8B4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223A8B8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0223A8B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223A8BC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A8B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223A8BC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A8BC */ _t2 = _t1 & 0x00000001u;
         /* 0223A8BC */ if (_t2) goto L_0223A8CC; else goto L_0223A8C0;
   L_0223A8C0: ; // 0x223a8c0
@@ -12062,8 +12062,8 @@ void Gambit_fn_0223A8D8(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -12178,9 +12178,9 @@ void Gambit_fn_0223A934(CPUState* cpu) {
         /* 0223A938 */ _t0 = cpu->r[9] + 0xFFFFFDBCu;
         /* 0223A938 */ cpu->r[9] = rbrew_read32(cpu->mem, _t0);
         /* 0223A93C */ cpu->r[10] = 0x101D0000u;
-        /* 0223A940 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0223A940 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0223A944 */ cpu->r[10] = cpu->r[10] + 0xFFFFFF90u;
-        /* 0223A948 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A948 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A948 */ _t2 = _t1 & 0x00000001u;
         /* 0223A948 */ if (_t2) goto L_0223A94C; else goto L_0223A964;
   L_0223A94C: ; // 0x223a94c
@@ -12193,8 +12193,8 @@ void Gambit_fn_0223A934(CPUState* cpu) {
         /* 0223A960 */ _t4 = cpu->r[10] + 0x00000000u;
         /* 0223A960 */ rbrew_write32(cpu->mem, _t4, cpu->r[12]);
   L_0223A964: ; // 0x223a964
-        /* 0223A964 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0223A968 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A964 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0223A968 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A968 */ _t6 = _t5 & 0x00000001u;
         /* 0223A968 */ if (_t6) goto L_0223A96C; else goto L_0223A974;
   L_0223A96C: ; // 0x223a96c
@@ -12205,9 +12205,9 @@ void Gambit_fn_0223A934(CPUState* cpu) {
         /* 0223A978 */ _t7 = cpu->r[11] + 0xFFFFE61Cu;
         /* 0223A978 */ cpu->r[11] = rbrew_read32(cpu->mem, _t7);
         /* 0223A97C */ cpu->r[12] = 0x101D0000u;
-        /* 0223A980 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0223A980 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0223A984 */ cpu->r[12] = cpu->r[12] + 0xFFFFFC08u;
-        /* 0223A988 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A988 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A988 */ _t9 = _t8 & 0x00000001u;
         /* 0223A988 */ if (_t9) goto L_0223A98C; else goto L_0223A9A4;
   L_0223A98C: ; // 0x223a98c
@@ -12220,8 +12220,8 @@ void Gambit_fn_0223A934(CPUState* cpu) {
         /* 0223A9A0 */ _t11 = cpu->r[12] + 0x00000000u;
         /* 0223A9A0 */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_0223A9A4: ; // 0x223a9a4
-        /* 0223A9A4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0223A9A8 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A9A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0223A9A8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A9A8 */ _t13 = _t12 & 0x00000001u;
         /* 0223A9A8 */ if (_t13) goto L_0223A9AC; else goto L_0223A9B4;
   L_0223A9AC: ; // 0x223a9ac
@@ -12232,9 +12232,9 @@ void Gambit_fn_0223A934(CPUState* cpu) {
         /* 0223A9B8 */ _t14 = cpu->r[10] + 0xFFFFE618u;
         /* 0223A9B8 */ cpu->r[10] = rbrew_read32(cpu->mem, _t14);
         /* 0223A9BC */ cpu->r[9] = 0x101D0000u;
-        /* 0223A9C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0223A9C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0223A9C4 */ cpu->r[9] = cpu->r[9] + 0xFFFFFC04u;
-        /* 0223A9C8 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A9C8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A9C8 */ _t16 = _t15 & 0x00000001u;
         /* 0223A9C8 */ if (_t16) goto L_0223A9CC; else goto L_0223A9E4;
   L_0223A9CC: ; // 0x223a9cc
@@ -12247,8 +12247,8 @@ void Gambit_fn_0223A934(CPUState* cpu) {
         /* 0223A9E0 */ _t18 = cpu->r[9] + 0x00000000u;
         /* 0223A9E0 */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_0223A9E4: ; // 0x223a9e4
-        /* 0223A9E4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 0223A9E8 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223A9E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 0223A9E8 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223A9E8 */ _t20 = _t19 & 0x00000001u;
         /* 0223A9E8 */ if (_t20) goto L_0223A9EC; else goto L_0223A9F4;
   L_0223A9EC: ; // 0x223a9ec
@@ -12259,9 +12259,9 @@ void Gambit_fn_0223A934(CPUState* cpu) {
         /* 0223A9F8 */ _t21 = cpu->r[9] + 0xFFFFDA0Cu;
         /* 0223A9F8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t21);
         /* 0223A9FC */ cpu->r[12] = 0x101D0000u;
-        /* 0223AA00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0223AA00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0223AA04 */ cpu->r[12] = cpu->r[12] + 0xFFFFFC00u;
-        /* 0223AA08 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223AA08 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223AA08 */ _t23 = _t22 & 0x00000001u;
         /* 0223AA08 */ if (_t23) goto L_0223AA0C; else goto L_0223AA24;
   L_0223AA0C: ; // 0x223aa0c
@@ -12274,8 +12274,8 @@ void Gambit_fn_0223A934(CPUState* cpu) {
         /* 0223AA20 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 0223AA20 */ rbrew_write32(cpu->mem, _t25, cpu->r[9]);
   L_0223AA24: ; // 0x223aa24
-        /* 0223AA24 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0223AA28 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223AA24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0223AA28 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223AA28 */ _t27 = _t26 & 0x00000001u;
         /* 0223AA28 */ if (_t27) goto L_0223AA2C; else goto L_0223AA34;
   L_0223AA2C: ; // 0x223aa2c
@@ -12286,9 +12286,9 @@ void Gambit_fn_0223A934(CPUState* cpu) {
         /* 0223AA38 */ _t28 = cpu->r[12] + 0xFFFFDA00u;
         /* 0223AA38 */ cpu->r[12] = rbrew_read32(cpu->mem, _t28);
         /* 0223AA3C */ cpu->r[9] = 0x101D0000u;
-        /* 0223AA40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0223AA40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0223AA44 */ cpu->r[9] = cpu->r[9] + 0xFFFFFBFCu;
-        /* 0223AA48 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223AA48 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223AA48 */ _t30 = _t29 & 0x00000001u;
         /* 0223AA48 */ if (_t30) goto L_0223AA4C; else goto L_0223AA64;
   L_0223AA4C: ; // 0x223aa4c
@@ -12301,8 +12301,8 @@ void Gambit_fn_0223A934(CPUState* cpu) {
         /* 0223AA60 */ _t32 = cpu->r[9] + 0x00000000u;
         /* 0223AA60 */ rbrew_write32(cpu->mem, _t32, cpu->r[12]);
   L_0223AA64: ; // 0x223aa64
-        /* 0223AA64 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 0223AA68 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223AA64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 0223AA68 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223AA68 */ _t34 = _t33 & 0x00000001u;
         /* 0223AA68 */ if (_t34) goto L_0223AA6C; else goto L_0223AA74;
   L_0223AA6C: ; // 0x223aa6c
@@ -12313,9 +12313,9 @@ void Gambit_fn_0223A934(CPUState* cpu) {
         /* 0223AA78 */ _t35 = cpu->r[12] + 0xFFFFD9ECu;
         /* 0223AA78 */ cpu->r[12] = rbrew_read32(cpu->mem, _t35);
         /* 0223AA7C */ cpu->r[11] = 0x101D0000u;
-        /* 0223AA80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0223AA80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0223AA84 */ cpu->r[11] = cpu->r[11] + 0xFFFFFB4Cu;
-        /* 0223AA88 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223AA88 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223AA88 */ _t37 = _t36 & 0x00000001u;
         /* 0223AA88 */ if (_t37) goto L_0223AA8C; else goto L_0223AAA4;
   L_0223AA8C: ; // 0x223aa8c
@@ -12328,8 +12328,8 @@ void Gambit_fn_0223A934(CPUState* cpu) {
         /* 0223AAA0 */ _t39 = cpu->r[11] + 0x00000000u;
         /* 0223AAA0 */ rbrew_write32(cpu->mem, _t39, cpu->r[0]);
   L_0223AAA4: ; // 0x223aaa4
-        /* 0223AAA4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 0223AAA8 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223AAA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 0223AAA8 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223AAA8 */ _t41 = _t40 & 0x00000001u;
         /* 0223AAA8 */ if (_t41) goto L_0223AAAC; else goto L_0223AAB4;
   L_0223AAAC: ; // 0x223aaac
@@ -12341,9 +12341,9 @@ void Gambit_fn_0223A934(CPUState* cpu) {
         /* 0223AAB8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t42);
         /* 0223AAB8 */ cpu->r[10] = _t42;
         /* 0223AABC */ cpu->r[12] = 0x101D0000u;
-        /* 0223AAC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0223AAC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0223AAC4 */ cpu->r[12] = cpu->r[12] + 0xFFFFD4ECu;
-        /* 0223AAC8 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223AAC8 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223AAC8 */ _t44 = _t43 & 0x00000001u;
         /* 0223AAC8 */ if (_t44) goto L_0223AACC; else goto L_0223AAE0;
   L_0223AACC: ; // 0x223aacc
@@ -12355,8 +12355,8 @@ void Gambit_fn_0223A934(CPUState* cpu) {
         /* 0223AADC */ _t46 = cpu->r[12] + 0x00000000u;
         /* 0223AADC */ rbrew_write32(cpu->mem, _t46, cpu->r[0]);
   L_0223AAE0: ; // 0x223aae0
-        /* 0223AAE0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0223AAE4 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223AAE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0223AAE4 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223AAE4 */ _t48 = _t47 & 0x00000001u;
         /* 0223AAE4 */ if (_t48) goto L_0223AAE8; else goto L_0223AAF0;
   L_0223AAE8: ; // 0x223aae8
@@ -12368,9 +12368,9 @@ void Gambit_fn_0223A934(CPUState* cpu) {
         /* 0223AAF4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t49);
         /* 0223AAF4 */ cpu->r[9] = _t49;
         /* 0223AAF8 */ cpu->r[10] = 0x101D0000u;
-        /* 0223AAFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0223AAFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0223AB00 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4E4u;
-        /* 0223AB04 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223AB04 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223AB04 */ _t51 = _t50 & 0x00000001u;
         /* 0223AB04 */ if (_t51) goto L_0223AB08; else goto L_0223AB1C;
   L_0223AB08: ; // 0x223ab08
@@ -12410,18 +12410,18 @@ void Gambit_fn_0223AB3C(CPUState* cpu) {
         /* 0223AB4C */ _t3 = cpu->r[1] + 0x00000018u;
         /* 0223AB4C */ rbrew_write_f32(cpu->mem, _t3, cpu->f[31]);
         /* 0223AB50 */ cpu->r[31] = cpu->r[3];
-        /* 0223AB50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0223AB50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0223AB54 */ _t4 = cpu->r[1] + 0x00000024u;
         /* 0223AB54 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
-        /* 0223AB58 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223AB58 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223AB58 */ _t6 = _t5 & 0x00000001u;
         /* 0223AB58 */ if (_t6) goto L_0223AB5C; else goto L_0223AB6C;
   L_0223AB5C: ; // 0x223ab5c
         /* 0223AB5C */ cpu->r[3] = 0x000000D8u;
         /* 0223AB60 */ Gambit_fn_02801A78(cpu);
         /* 0223AB64 */ cpu->r[31] = cpu->r[3];
-        /* 0223AB64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0223AB68 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223AB64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0223AB68 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223AB68 */ _t8 = _t7 & 0x00000001u;
         /* 0223AB68 */ if (_t8) goto L_0223AC2C; else goto L_0223AB6C;
   L_0223AB6C: ; // 0x223ab6c
@@ -12430,10 +12430,10 @@ void Gambit_fn_0223AB3C(CPUState* cpu) {
         /* 0223AB74 */ cpu->r[11] = 0x10050000u;
         /* 0223AB78 */ cpu->r[11] = cpu->r[11] + 0x00002A30u;
         /* 0223AB7C */ cpu->r[12] = cpu->r[31] + 0x00000084u;
-        /* 0223AB7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0223AB7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0223AB80 */ _t9 = cpu->r[31] + 0x00000004u;
         /* 0223AB80 */ rbrew_write32(cpu->mem, _t9, cpu->r[11]);
-        /* 0223AB84 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223AB84 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223AB84 */ _t11 = _t10 & 0x00000001u;
         /* 0223AB84 */ if (_t11) goto L_0223AB88; else goto L_0223AB90;
   L_0223AB88: ; // 0x223ab88
@@ -12442,29 +12442,29 @@ void Gambit_fn_0223AB3C(CPUState* cpu) {
   L_0223AB90: ; // 0x223ab90
         /* 0223AB90 */ cpu->r[12] = 0x10050000u;
         /* 0223AB94 */ cpu->r[3] = cpu->r[31] + 0x000000B4u;
-        /* 0223AB94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0223AB94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0223AB98 */ _t12 = cpu->r[12] + 0x00002A14u;
         /* 0223AB98 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t12);
-        /* 0223AB9C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223AB9C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223AB9C */ _t14 = _t13 & 0x00000001u;
         /* 0223AB9C */ if (_t14) goto L_0223ABA0; else goto L_0223ABB0;
   L_0223ABA0: ; // 0x223aba0
         /* 0223ABA0 */ cpu->r[3] = 0x0000000Cu;
         /* 0223ABA4 */ Gambit_fn_02801A78(cpu);
-        /* 0223ABA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223ABAC */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223ABA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223ABAC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223ABAC */ _t16 = _t15 & 0x00000001u;
         /* 0223ABAC */ if (_t16) goto L_0223ABD4; else goto L_0223ABB0;
   L_0223ABB0: ; // 0x223abb0
-        /* 0223ABB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223ABB4 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223ABB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223ABB4 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223ABB4 */ _t18 = _t17 & 0x00000001u;
         /* 0223ABB4 */ if (_t18) goto L_0223ABB8; else goto L_0223ABC8;
   L_0223ABB8: ; // 0x223abb8
         /* 0223ABB8 */ cpu->r[3] = 0x0000000Cu;
         /* 0223ABBC */ Gambit_fn_02801A78(cpu);
-        /* 0223ABC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223ABC4 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223ABC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223ABC4 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223ABC4 */ _t20 = _t19 & 0x00000001u;
         /* 0223ABC4 */ if (_t20) goto L_0223ABD4; else goto L_0223ABC8;
   L_0223ABC8: ; // 0x223abc8
@@ -12476,27 +12476,27 @@ void Gambit_fn_0223AB3C(CPUState* cpu) {
         /* 0223ABD0 */ rbrew_write_f32(cpu->mem, _t23, cpu->f[31]);
   L_0223ABD4: ; // 0x223abd4
         /* 0223ABD4 */ cpu->r[3] = cpu->r[31] + 0x000000C0u;
-        /* 0223ABD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223ABD8 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223ABD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223ABD8 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223ABD8 */ _t25 = _t24 & 0x00000001u;
         /* 0223ABD8 */ if (_t25) goto L_0223ABDC; else goto L_0223ABEC;
   L_0223ABDC: ; // 0x223abdc
         /* 0223ABDC */ cpu->r[3] = 0x0000000Cu;
         /* 0223ABE0 */ Gambit_fn_02801A78(cpu);
-        /* 0223ABE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223ABE8 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223ABE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223ABE8 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223ABE8 */ _t27 = _t26 & 0x00000001u;
         /* 0223ABE8 */ if (_t27) goto L_0223AC10; else goto L_0223ABEC;
   L_0223ABEC: ; // 0x223abec
-        /* 0223ABEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223ABF0 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223ABEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223ABF0 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223ABF0 */ _t29 = _t28 & 0x00000001u;
         /* 0223ABF0 */ if (_t29) goto L_0223ABF4; else goto L_0223AC04;
   L_0223ABF4: ; // 0x223abf4
         /* 0223ABF4 */ cpu->r[3] = 0x0000000Cu;
         /* 0223ABF8 */ Gambit_fn_02801A78(cpu);
-        /* 0223ABFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223AC00 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223ABFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223AC00 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223AC00 */ _t31 = _t30 & 0x00000001u;
         /* 0223AC00 */ if (_t31) goto L_0223AC10; else goto L_0223AC04;
   L_0223AC04: ; // 0x223ac04
@@ -12526,7 +12526,7 @@ void Gambit_fn_0223AB3C(CPUState* cpu) {
         /* 0223AC34 */ cpu->r[31] = rbrew_read32(cpu->mem, _t40);
         /* 0223AC38 */ _t41 = cpu->r[1] + 0x00000010u;
         /* 0223AC38 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t41);
-        /* 0223AC3C */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223AC3C */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223AC3C */ _t43 = _t42 & 0x00000001u;
         /* 0223AC3C */ if (_t43) goto L_0223AC40; // else: addr-0 trap, fall-through
   L_0223AC40: ; // 0x223ac40
@@ -12565,10 +12565,10 @@ void Gambit_fn_0223AC54(CPUState* cpu) {
         /* 0223AC74 */ cpu->f[10] = cpu->f[10] + cpu->f[0];
         /* 0223AC78 */ _t5 = cpu->r[31] + 0x000000CCu;
         /* 0223AC78 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t5);
-        /* 0223AC7C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[12]);
+        /* 0223AC7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[12]));
         /* 0223AC80 */ _t6 = cpu->r[31] + 0x000000D0u;
         /* 0223AC80 */ rbrew_write_f32(cpu->mem, _t6, cpu->f[10]);
-        /* 0223AC84 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223AC84 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223AC84 */ _t8 = _t7 & 0x00000001u;
         /* 0223AC84 */ if (_t8) goto L_0223ACA4; else goto L_0223AC88;
   L_0223AC88: ; // 0x223ac88
@@ -12628,10 +12628,10 @@ void Gambit_fn_0223AC58(CPUState* cpu) {
         /* 0223AC74 */ cpu->f[10] = cpu->f[10] + cpu->f[0];
         /* 0223AC78 */ _t5 = cpu->r[31] + 0x000000CCu;
         /* 0223AC78 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t5);
-        /* 0223AC7C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[12]);
+        /* 0223AC7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[12]));
         /* 0223AC80 */ _t6 = cpu->r[31] + 0x000000D0u;
         /* 0223AC80 */ rbrew_write_f32(cpu->mem, _t6, cpu->f[10]);
-        /* 0223AC84 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223AC84 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223AC84 */ _t8 = _t7 & 0x00000001u;
         /* 0223AC84 */ if (_t8) goto L_0223ACA4; else goto L_0223AC88;
   L_0223AC88: ; // 0x223ac88
@@ -12697,8 +12697,8 @@ void Gambit_fn_0223ACE8(CPUState* cpu) {
         /* 0223AD14 */ cpu->r[25] = _t5;
         /* 0223AD18 */ /* nop */
         /* 0223AD1C */ cpu->r[5] = rbrew_rlwinm(cpu->r[8], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0223AD1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 0223AD20 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223AD1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 0223AD20 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223AD20 */ _t7 = _t6 & 0x00000001u;
         /* 0223AD20 */ if (_t7) goto L_0223AE3C; else goto L_0223AD24;
   L_0223AD24: ; // 0x223ad24
@@ -12741,15 +12741,15 @@ void Gambit_fn_0223ACE8(CPUState* cpu) {
         /* 0223AD80 */ cpu->r[3] = rbrew_read32(cpu->mem, _t18);
         /* 0223AD84 */ Gambit_fn_02031DAC(cpu);
         /* 0223AD88 */ cpu->r[31] = cpu->r[3];
-        /* 0223AD88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0223AD8C */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223AD88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0223AD8C */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223AD8C */ _t20 = _t19 & 0x00000001u;
         /* 0223AD8C */ if (_t20) goto L_0223AE3C; else goto L_0223AD90;
   L_0223AD90: ; // 0x223ad90
         /* 0223AD90 */ _t21 = cpu->r[29] + 0xFFFFE5E4u;
         /* 0223AD90 */ cpu->r[10] = rbrew_read32(cpu->mem, _t21);
-        /* 0223AD94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0223AD98 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223AD94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0223AD98 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223AD98 */ _t23 = _t22 & 0x00000001u;
         /* 0223AD98 */ if (_t23) goto L_0223AD9C; else goto L_0223ADAC;
   L_0223AD9C: ; // 0x223ad9c
@@ -12768,13 +12768,13 @@ void Gambit_fn_0223ACE8(CPUState* cpu) {
         /* 0223ADB8 */ cpu->r[3] = cpu->r[31];
         /* 0223ADBC */ cpu->r[4] = cpu->r[28] + 0xFFFFFB60u;
         /* 0223ADC0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0223ADC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223ADC8 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223ADC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223ADC8 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223ADC8 */ _t29 = _t28 & 0x00000001u;
         /* 0223ADC8 */ if (_t29) goto L_0223AD78; else goto L_0223ADCC;
   L_0223ADCC: ; // 0x223adcc
-        /* 0223ADCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0223ADD0 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223ADCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0223ADD0 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223ADD0 */ _t31 = _t30 & 0x00000001u;
         /* 0223ADD0 */ if (_t31) goto L_0223AD78; else goto L_0223ADD4;
   L_0223ADD4: ; // 0x223add4
@@ -12788,8 +12788,8 @@ void Gambit_fn_0223ACE8(CPUState* cpu) {
         /* 0223ADE8 */ cpu->r[3] = cpu->r[31];
         /* 0223ADEC */ cpu->r[5] = cpu->r[1] + 0x00000010u;
         /* 0223ADF0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0223ADF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223ADF8 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223ADF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223ADF8 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223ADF8 */ _t35 = _t34 & 0x00000001u;
         /* 0223ADF8 */ if (_t35) goto L_0223AD78; else goto L_0223ADFC;
   L_0223ADFC: ; // 0x223adfc
@@ -12913,9 +12913,9 @@ void Gambit_fn_0223AE50(CPUState* cpu) {
         /* 0223AF18 */ cpu->r[10] = rbrew_read32(cpu->mem, _t28);
         /* 0223AF1C */ _t29 = cpu->r[9] + 0x00000078u;
         /* 0223AF1C */ cpu->r[0] = rbrew_read32(cpu->mem, _t29);
-        /* 0223AF20 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[0]);
+        /* 0223AF20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[0]));
         /* 0223AF24 */ cpu->r[3] = 0x00000000u;
-        /* 0223AF28 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223AF28 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223AF28 */ _t31 = _t30 & 0x00000001u;
         /* 0223AF28 */ if (_t31) goto L_0223AF2C; else goto L_0223AF38;
   L_0223AF2C: ; // 0x223af2c
@@ -12932,8 +12932,8 @@ void Gambit_fn_0223AE50(CPUState* cpu) {
         /* 0223AF44 */ cpu->r[6] = rbrew_read32(cpu->mem, _t34);
         /* 0223AF48 */ _t35 = cpu->r[6] + 0x00000044u;
         /* 0223AF48 */ cpu->r[7] = rbrew_read8(cpu->mem, _t35);
-        /* 0223AF4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0223AF50 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223AF4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0223AF50 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223AF50 */ _t37 = _t36 & 0x00000001u;
         /* 0223AF50 */ if (_t37) goto L_0223AF64; else goto L_0223AF54;
   L_0223AF54: ; // 0x223af54
@@ -13043,9 +13043,9 @@ void Gambit_fn_0223AE54(CPUState* cpu) {
         /* 0223AF18 */ cpu->r[10] = rbrew_read32(cpu->mem, _t28);
         /* 0223AF1C */ _t29 = cpu->r[9] + 0x00000078u;
         /* 0223AF1C */ cpu->r[0] = rbrew_read32(cpu->mem, _t29);
-        /* 0223AF20 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[0]);
+        /* 0223AF20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[0]));
         /* 0223AF24 */ cpu->r[3] = 0x00000000u;
-        /* 0223AF28 */ _t30 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223AF28 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223AF28 */ _t31 = _t30 & 0x00000001u;
         /* 0223AF28 */ if (_t31) goto L_0223AF2C; else goto L_0223AF38;
   L_0223AF2C: ; // 0x223af2c
@@ -13062,8 +13062,8 @@ void Gambit_fn_0223AE54(CPUState* cpu) {
         /* 0223AF44 */ cpu->r[6] = rbrew_read32(cpu->mem, _t34);
         /* 0223AF48 */ _t35 = cpu->r[6] + 0x00000044u;
         /* 0223AF48 */ cpu->r[7] = rbrew_read8(cpu->mem, _t35);
-        /* 0223AF4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0223AF50 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223AF4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0223AF50 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223AF50 */ _t37 = _t36 & 0x00000001u;
         /* 0223AF50 */ if (_t37) goto L_0223AF64; else goto L_0223AF54;
   L_0223AF54: ; // 0x223af54
@@ -13101,8 +13101,8 @@ void Gambit_fn_0223AF7C(CPUState* cpu) {
         /* 0223AF90 */ Gambit_fn_021BF004(cpu);
         /* 0223AF94 */ _t3 = cpu->r[31] + 0x00000051u;
         /* 0223AF94 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 0223AF98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223AF9C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223AF98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223AF9C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223AF9C */ _t5 = _t4 & 0x00000001u;
         /* 0223AF9C */ if (_t5) goto L_0223AFA8; else goto L_0223AFA0;
   L_0223AFA0: ; // 0x223afa0
@@ -13134,8 +13134,8 @@ void Gambit_fn_0223AF80(CPUState* cpu) {
         /* 0223AF90 */ Gambit_fn_021BF004(cpu);
         /* 0223AF94 */ _t3 = cpu->r[31] + 0x00000051u;
         /* 0223AF94 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 0223AF98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223AF9C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223AF98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223AF9C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223AF9C */ _t5 = _t4 & 0x00000001u;
         /* 0223AF9C */ if (_t5) goto L_0223AFA8; else goto L_0223AFA0;
   L_0223AFA0: ; // 0x223afa0
@@ -13169,9 +13169,9 @@ void Gambit_fn_0223AFBC(CPUState* cpu) {
         /* 02031BE4 */ _t4 = cpu->r[4] + 0x00000000u;
         /* 02031BE4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t4);
         /* 02031BE8 */ cpu->r[31] = cpu->r[4];
-        /* 02031BEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02031BEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02031BF0 */ cpu->r[30] = cpu->r[3];
-        /* 02031BF4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02031BF4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02031BF4 */ _t6 = _t5 & 0x00000001u;
         /* 02031BF4 */ if (_t6) goto L_02031C58; else goto L_02031BF8;
   L_02031BF8: ; // 0x2031bf8
@@ -13179,8 +13179,8 @@ void Gambit_fn_0223AFBC(CPUState* cpu) {
         /* 02031BF8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
         /* 02031BFC */ _t8 = cpu->r[3] + 0x0000011Cu;
         /* 02031BFC */ cpu->r[11] = rbrew_read8(cpu->mem, _t8);
-        /* 02031C00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02031C04 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02031C00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02031C04 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02031C04 */ _t10 = _t9 & 0x00000001u;
         /* 02031C04 */ if (_t10) goto L_02031C58; else goto L_02031C08;
   L_02031C08: ; // 0x2031c08
@@ -13279,8 +13279,8 @@ void Gambit_fn_0223B010(CPUState* cpu) {
         /* 0223B010 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223B014 */ _t1 = cpu->r[5] + 0x00000000u;
         /* 0223B014 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
-        /* 0223B018 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
-        /* 0223B01C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B018 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
+        /* 0223B01C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B01C */ _t3 = _t2 & 0x00000001u;
         /* 0223B01C */ if (_t3) goto L_0223B020; else goto L_0223B02C;
   L_0223B020: ; // 0x223b020
@@ -13308,7 +13308,7 @@ void Gambit_fn_0223B038(CPUState* cpu) {
         /* 0223B044 */ _t2 = cpu->r[4] + 0x00000000u;
         /* 0223B044 */ rbrew_write16(cpu->mem, _t2, (uint16_t)cpu->r[10]);
         /* 0223B048 */ cpu->r[12] = cpu->r[11] & 0x0000FEFFu;
-        /* 0223B048 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0223B048 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0223B04C */ cpu->r[0] = 0x00000000u;
         /* 0223B050 */ _t3 = cpu->r[4] + 0x00000002u;
         /* 0223B050 */ rbrew_write16(cpu->mem, _t3, (uint16_t)cpu->r[12]);
@@ -13570,17 +13570,17 @@ void Gambit_fn_0223B05C(CPUState* cpu) {
         /* 0223B270 */ cpu->r[10] = rbrew_read32(cpu->mem, _t100);
         /* 0223B274 */ _t101 = cpu->r[11] + 0x00002A28u;
         /* 0223B274 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t101);
-        /* 0223B278 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u);
+        /* 0223B278 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u));
         /* 0223B27C */ _t102 = cpu->r[31] + 0x000000ACu;
         /* 0223B27C */ rbrew_write32(cpu->mem, _t102, cpu->r[10]);
-        /* 0223B280 */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B280 */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B280 */ _t104 = _t103 & 0x00000001u;
         /* 0223B280 */ if (_t104) goto L_0223B284; else goto L_0223B294;
   L_0223B284: ; // 0x223b284
         /* 0223B284 */ cpu->r[3] = 0x00000010u;
         /* 0223B288 */ Gambit_fn_02801A78(cpu);
-        /* 0223B28C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223B290 */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B28C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223B290 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B290 */ _t106 = _t105 & 0x00000001u;
         /* 0223B290 */ if (_t106) goto L_0223B2A4; else goto L_0223B294;
   L_0223B294: ; // 0x223b294
@@ -13593,16 +13593,16 @@ void Gambit_fn_0223B05C(CPUState* cpu) {
         /* 0223B2A0 */ _t110 = cpu->r[3] + 0x0000000Cu;
         /* 0223B2A0 */ rbrew_write_f32(cpu->mem, _t110, cpu->f[30]);
   L_0223B2A4: ; // 0x223b2a4
-        /* 0223B2A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u);
+        /* 0223B2A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u));
         /* 0223B2A8 */ cpu->r[3] = cpu->r[31] + 0x000000D0u;
-        /* 0223B2AC */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B2AC */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B2AC */ _t112 = _t111 & 0x00000001u;
         /* 0223B2AC */ if (_t112) goto L_0223B2B0; else goto L_0223B2C0;
   L_0223B2B0: ; // 0x223b2b0
         /* 0223B2B0 */ cpu->r[3] = 0x00000010u;
         /* 0223B2B4 */ Gambit_fn_02801A78(cpu);
-        /* 0223B2B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223B2BC */ _t113 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B2B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223B2BC */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B2BC */ _t114 = _t113 & 0x00000001u;
         /* 0223B2BC */ if (_t114) goto L_0223B2D0; else goto L_0223B2C0;
   L_0223B2C0: ; // 0x223b2c0
@@ -13650,7 +13650,7 @@ void Gambit_fn_0223B05C(CPUState* cpu) {
         /* 0223B314 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t133);
         /* 0223B318 */ _t134 = cpu->r[1] + 0x00000058u;
         /* 0223B318 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t134);
-        /* 0223B31C */ _t135 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223B31C */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223B31C */ _t136 = _t135 & 0x00000001u;
         /* 0223B31C */ if (_t136) goto L_0223B320; // else: addr-0 trap, fall-through
   L_0223B320: ; // 0x223b320
@@ -13711,8 +13711,8 @@ void Gambit_fn_0223B34C(CPUState* cpu) {
         /* 0223B34C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0223B34C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223B350 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 0223B350 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0223B354 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B350 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0223B354 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B354 */ _t2 = _t1 & 0x00000001u;
         /* 0223B354 */ _t3 = _t2 ^ 0x00000001u;
         /* 0223B354 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -13734,8 +13734,8 @@ void Gambit_fn_0223B368(CPUState* cpu) {
         /* 0223B368 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0223B368 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223B36C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 0223B36C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0223B370 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B36C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0223B370 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B370 */ _t2 = _t1 & 0x00000001u;
         /* 0223B370 */ _t3 = _t2 ^ 0x00000001u;
         /* 0223B370 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -13757,8 +13757,8 @@ void Gambit_fn_0223B384(CPUState* cpu) {
         /* 0223B384 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0223B384 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223B388 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 0223B388 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0223B38C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B388 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0223B38C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B38C */ _t2 = _t1 & 0x00000001u;
         /* 0223B38C */ _t3 = _t2 ^ 0x00000001u;
         /* 0223B38C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -13801,8 +13801,8 @@ void Gambit_fn_0223B3B0(CPUState* cpu) {
         /* 0223B3C0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0223B3C4 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0223B3C4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0223B3C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0223B3CC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B3C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0223B3CC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B3CC */ _t5 = _t4 & 0x00000001u;
         /* 0223B3CC */ if (_t5) goto L_0223B3D0; else goto L_0223B3EC;
   L_0223B3D0: ; // 0x223b3d0
@@ -13841,8 +13841,8 @@ void Gambit_fn_0223B3B4(CPUState* cpu) {
         /* 0223B3C0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0223B3C4 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0223B3C4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0223B3C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0223B3CC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B3C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0223B3CC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B3CC */ _t5 = _t4 & 0x00000001u;
         /* 0223B3CC */ if (_t5) goto L_0223B3D0; else goto L_0223B3EC;
   L_0223B3D0: ; // 0x223b3d0
@@ -14134,10 +14134,10 @@ void Gambit_fn_0223B50C(CPUState* cpu) {
         /* 0223B50C */ cpu->r[12] = 0x101D0000u;
         /* 0223B510 */ _t0 = cpu->r[12] + 0xFFFFFE10u;
         /* 0223B510 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 0223B514 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0223B514 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0223B518 */ cpu->r[12] = 0x101D0000u;
         /* 0223B51C */ cpu->r[12] = cpu->r[12] + 0xFFFFFF94u;
-        /* 0223B520 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B520 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B520 */ _t2 = _t1 & 0x00000001u;
         /* 0223B520 */ if (_t2) goto L_0223B524; else goto L_0223B53C;
   L_0223B524: ; // 0x223b524
@@ -14150,8 +14150,8 @@ void Gambit_fn_0223B50C(CPUState* cpu) {
         /* 0223B538 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 0223B538 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_0223B53C: ; // 0x223b53c
-        /* 0223B53C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0223B540 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B53C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0223B540 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B540 */ _t6 = _t5 & 0x00000001u;
         /* 0223B540 */ if (_t6) goto L_0223B544; else goto L_0223B54C;
   L_0223B544: ; // 0x223b544
@@ -14163,9 +14163,9 @@ void Gambit_fn_0223B50C(CPUState* cpu) {
         /* 0223B550 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 0223B550 */ cpu->r[11] = _t7;
         /* 0223B554 */ cpu->r[10] = 0x101D0000u;
-        /* 0223B558 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0223B558 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0223B55C */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 0223B560 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B560 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B560 */ _t9 = _t8 & 0x00000001u;
         /* 0223B560 */ if (_t9) goto L_0223B564; else goto L_0223B578;
   L_0223B564: ; // 0x223b564
@@ -14177,8 +14177,8 @@ void Gambit_fn_0223B50C(CPUState* cpu) {
         /* 0223B574 */ _t11 = cpu->r[10] + 0x00000000u;
         /* 0223B574 */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
   L_0223B578: ; // 0x223b578
-        /* 0223B578 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0223B57C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B578 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0223B57C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B57C */ _t13 = _t12 & 0x00000001u;
         /* 0223B57C */ if (_t13) goto L_0223B580; else goto L_0223B588;
   L_0223B580: ; // 0x223b580
@@ -14190,9 +14190,9 @@ void Gambit_fn_0223B50C(CPUState* cpu) {
         /* 0223B58C */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 0223B58C */ cpu->r[8] = _t14;
         /* 0223B590 */ cpu->r[11] = 0x101D0000u;
-        /* 0223B594 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0223B594 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0223B598 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 0223B59C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B59C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B59C */ _t16 = _t15 & 0x00000001u;
         /* 0223B59C */ if (_t16) goto L_0223B5A0; else goto L_0223B5B4;
   L_0223B5A0: ; // 0x223b5a0
@@ -14290,18 +14290,18 @@ void Gambit_fn_0223B60C(CPUState* cpu) {
         /* 0223B628 */ _t6 = cpu->r[1] + 0x0000002Cu;
         /* 0223B628 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 0223B62C */ cpu->r[31] = cpu->r[3];
-        /* 0223B62C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0223B62C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0223B630 */ _t7 = cpu->r[1] + 0x00000008u;
         /* 0223B630 */ rbrew_write32(cpu->mem, _t7, cpu->r[28]);
-        /* 0223B634 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B634 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B634 */ _t9 = _t8 & 0x00000001u;
         /* 0223B634 */ if (_t9) goto L_0223B638; else goto L_0223B648;
   L_0223B638: ; // 0x223b638
         /* 0223B638 */ cpu->r[3] = 0x00000314u;
         /* 0223B63C */ Gambit_fn_02801A78(cpu);
         /* 0223B640 */ cpu->r[31] = cpu->r[3];
-        /* 0223B640 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0223B644 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B640 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0223B644 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B644 */ _t11 = _t10 & 0x00000001u;
         /* 0223B644 */ if (_t11) goto L_0223B838; else goto L_0223B648;
   L_0223B648: ; // 0x223b648
@@ -14327,18 +14327,18 @@ void Gambit_fn_0223B60C(CPUState* cpu) {
         /* 0223B67C */ _t18 = cpu->r[31] + 0x00000134u;
         /* 0223B67C */ rbrew_write_f32(cpu->mem, _t18, cpu->f[0]);
         /* 0223B680 */ cpu->r[28] = cpu->r[31] + 0x0000013Cu;
-        /* 0223B680 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 0223B680 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 0223B684 */ _t19 = cpu->r[31] + 0x00000130u;
         /* 0223B684 */ rbrew_write_f32(cpu->mem, _t19, cpu->f[31]);
-        /* 0223B688 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B688 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B688 */ _t21 = _t20 & 0x00000001u;
         /* 0223B688 */ if (_t21) goto L_0223B68C; else goto L_0223B69C;
   L_0223B68C: ; // 0x223b68c
         /* 0223B68C */ cpu->r[3] = 0x00000078u;
         /* 0223B690 */ Gambit_fn_02801A78(cpu);
         /* 0223B694 */ cpu->r[28] = cpu->r[3];
-        /* 0223B694 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 0223B698 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B694 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 0223B698 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B698 */ _t23 = _t22 & 0x00000001u;
         /* 0223B698 */ if (_t23) goto L_0223B6E4; else goto L_0223B69C;
   L_0223B69C: ; // 0x223b69c
@@ -14359,8 +14359,8 @@ void Gambit_fn_0223B60C(CPUState* cpu) {
         /* 0223B6CC */ cpu->r[5] = 0x0000000Cu;
         /* 0223B6D0 */ Gambit_fn_02C82E00(cpu);
         /* 0223B6D4 */ cpu->r[11] = cpu->r[28] + 0x0000006Cu;
-        /* 0223B6D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0223B6D8 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B6D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0223B6D8 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B6D8 */ _t27 = _t26 & 0x00000001u;
         /* 0223B6D8 */ if (_t27) goto L_0223B6DC; else goto L_0223B6E4;
   L_0223B6DC: ; // 0x223b6dc
@@ -14368,16 +14368,16 @@ void Gambit_fn_0223B60C(CPUState* cpu) {
         /* 0223B6E0 */ Gambit_fn_02801A78(cpu);
   L_0223B6E4: ; // 0x223b6e4
         /* 0223B6E4 */ cpu->r[28] = cpu->r[31] + 0x000001B4u;
-        /* 0223B6E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 0223B6E8 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B6E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 0223B6E8 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B6E8 */ _t29 = _t28 & 0x00000001u;
         /* 0223B6E8 */ if (_t29) goto L_0223B6EC; else goto L_0223B6FC;
   L_0223B6EC: ; // 0x223b6ec
         /* 0223B6EC */ cpu->r[3] = 0x00000078u;
         /* 0223B6F0 */ Gambit_fn_02801A78(cpu);
         /* 0223B6F4 */ cpu->r[28] = cpu->r[3];
-        /* 0223B6F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 0223B6F8 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B6F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 0223B6F8 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B6F8 */ _t31 = _t30 & 0x00000001u;
         /* 0223B6F8 */ if (_t31) goto L_0223B744; else goto L_0223B6FC;
   L_0223B6FC: ; // 0x223b6fc
@@ -14398,8 +14398,8 @@ void Gambit_fn_0223B60C(CPUState* cpu) {
         /* 0223B72C */ cpu->r[5] = 0x0000000Cu;
         /* 0223B730 */ Gambit_fn_02C82E00(cpu);
         /* 0223B734 */ cpu->r[0] = cpu->r[28] + 0x0000006Cu;
-        /* 0223B734 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223B738 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B734 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223B738 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B738 */ _t35 = _t34 & 0x00000001u;
         /* 0223B738 */ if (_t35) goto L_0223B73C; else goto L_0223B744;
   L_0223B73C: ; // 0x223b73c
@@ -14407,16 +14407,16 @@ void Gambit_fn_0223B60C(CPUState* cpu) {
         /* 0223B740 */ Gambit_fn_02801A78(cpu);
   L_0223B744: ; // 0x223b744
         /* 0223B744 */ cpu->r[28] = cpu->r[31] + 0x0000022Cu;
-        /* 0223B744 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 0223B748 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B744 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 0223B748 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B748 */ _t37 = _t36 & 0x00000001u;
         /* 0223B748 */ if (_t37) goto L_0223B74C; else goto L_0223B75C;
   L_0223B74C: ; // 0x223b74c
         /* 0223B74C */ cpu->r[3] = 0x00000078u;
         /* 0223B750 */ Gambit_fn_02801A78(cpu);
         /* 0223B754 */ cpu->r[28] = cpu->r[3];
-        /* 0223B754 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 0223B758 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B754 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 0223B758 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B758 */ _t39 = _t38 & 0x00000001u;
         /* 0223B758 */ if (_t39) goto L_0223B7A4; else goto L_0223B75C;
   L_0223B75C: ; // 0x223b75c
@@ -14437,8 +14437,8 @@ void Gambit_fn_0223B60C(CPUState* cpu) {
         /* 0223B78C */ cpu->r[5] = 0x0000000Cu;
         /* 0223B790 */ Gambit_fn_02C82E00(cpu);
         /* 0223B794 */ cpu->r[10] = cpu->r[28] + 0x0000006Cu;
-        /* 0223B794 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0223B798 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B794 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0223B798 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B798 */ _t43 = _t42 & 0x00000001u;
         /* 0223B798 */ if (_t43) goto L_0223B79C; else goto L_0223B7A4;
   L_0223B79C: ; // 0x223b79c
@@ -14460,10 +14460,10 @@ void Gambit_fn_0223B60C(CPUState* cpu) {
         /* 0223B7C0 */ _t49 = cpu->r[31] + 0x000002ACu;
         /* 0223B7C0 */ rbrew_write32(cpu->mem, _t49, cpu->r[11]);
         /* 0223B7C4 */ cpu->r[0] = cpu->r[31] + 0x000002BCu;
-        /* 0223B7C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0223B7C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0223B7C8 */ _t50 = cpu->r[31] + 0x000002A8u;
         /* 0223B7C8 */ rbrew_write_f32(cpu->mem, _t50, cpu->f[13]);
-        /* 0223B7CC */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B7CC */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B7CC */ _t52 = _t51 & 0x00000001u;
         /* 0223B7CC */ if (_t52) goto L_0223B7D0; else goto L_0223B7D8;
   L_0223B7D0: ; // 0x223b7d0
@@ -14491,7 +14491,7 @@ void Gambit_fn_0223B60C(CPUState* cpu) {
         /* 0223B804 */ _t60 = cpu->r[31] + 0x000002D0u;
         /* 0223B804 */ rbrew_write_f32(cpu->mem, _t60, cpu->f[0]);
         /* 0223B808 */ cpu->r[12] = cpu->r[31] + 0x000002D8u;
-        /* 0223B808 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0223B808 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0223B80C */ _t61 = cpu->r[31] + 0x000002C5u;
         /* 0223B80C */ rbrew_write8(cpu->mem, _t61, (uint8_t)cpu->r[11]);
         /* 0223B810 */ _t62 = cpu->r[31] + 0x000002C7u;
@@ -14500,7 +14500,7 @@ void Gambit_fn_0223B60C(CPUState* cpu) {
         /* 0223B814 */ rbrew_write16(cpu->mem, _t63, (uint16_t)cpu->r[10]);
         /* 0223B818 */ _t64 = cpu->r[31] + 0x000002C8u;
         /* 0223B818 */ rbrew_write32(cpu->mem, _t64, cpu->r[0]);
-        /* 0223B81C */ _t65 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B81C */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B81C */ _t66 = _t65 & 0x00000001u;
         /* 0223B81C */ if (_t66) goto L_0223B820; else goto L_0223B828;
   L_0223B820: ; // 0x223b820
@@ -14508,8 +14508,8 @@ void Gambit_fn_0223B60C(CPUState* cpu) {
         /* 0223B824 */ Gambit_fn_02801A78(cpu);
   L_0223B828: ; // 0x223b828
         /* 0223B828 */ cpu->r[0] = cpu->r[31] + 0x00000308u;
-        /* 0223B828 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223B82C */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B828 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223B82C */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B82C */ _t68 = _t67 & 0x00000001u;
         /* 0223B82C */ if (_t68) goto L_0223B830; else goto L_0223B838;
   L_0223B830: ; // 0x223b830
@@ -14529,7 +14529,7 @@ void Gambit_fn_0223B60C(CPUState* cpu) {
         /* 0223B84C */ cpu->r[3] = cpu->r[31];
         /* 0223B850 */ _t74 = cpu->r[1] + 0x00000014u;
         /* 0223B850 */ cpu->r[31] = rbrew_read32(cpu->mem, _t74);
-        /* 0223B854 */ _t75 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223B854 */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223B854 */ _t76 = _t75 & 0x00000001u;
         /* 0223B854 */ if (_t76) goto L_0223B858; // else: addr-0 trap, fall-through
   L_0223B858: ; // 0x223b858
@@ -14548,30 +14548,30 @@ void Gambit_fn_0223B868(CPUState* cpu) {
         /* 0223B868 */ cpu->r[12] = 0x10050000u;
         /* 0223B86C */ _t0 = cpu->r[12] + 0x00002DF4u;
         /* 0223B86C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t0);
-        /* 0223B870 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x0000003Fu);
+        /* 0223B870 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x0000003Fu));
         /* 0223B874 */ cpu->f[1] = cpu->f[0];
-        /* 0223B878 */ _t1 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223B878 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223B878 */ _t2 = _t1 & 0x00000001u;
         /* 0223B878 */ if (_t2) goto L_0223B87C; else goto L_0223B948;
   L_0223B87C: ; // 0x223b87c
-        /* 0223B87C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x0000001Eu);
-        /* 0223B880 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223B87C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x0000001Eu));
+        /* 0223B880 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223B880 */ _t4 = _t3 & 0x00000001u;
         /* 0223B880 */ if (_t4) goto L_0223B884; else goto L_0223B8A8;
   L_0223B884: ; // 0x223b884
-        /* 0223B884 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000011u);
-        /* 0223B888 */ _t5 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223B884 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000011u));
+        /* 0223B888 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223B888 */ _t6 = _t5 & 0x00000001u;
         /* 0223B888 */ if (_t6) goto L_0223B88C; else goto L_0223B9CC;
   L_0223B88C: ; // 0x223b88c
-        /* 0223B88C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000014u);
-        /* 0223B890 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223B88C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000014u));
+        /* 0223B890 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223B890 */ _t8 = _t7 & 0x00000001u;
         /* 0223B890 */ if (_t8) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0223B890 */ goto L_0223B894;
   L_0223B894: ; // 0x223b894
-        /* 0223B894 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x0000001Bu);
-        /* 0223B898 */ _t9 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223B894 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x0000001Bu));
+        /* 0223B898 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223B898 */ _t10 = _t9 & 0x00000001u;
         /* 0223B898 */ if (_t10) goto L_0223B89C; else goto L_0223B9CC;
   L_0223B89C: ; // 0x223b89c
@@ -14588,50 +14588,50 @@ void Gambit_fn_0223B868(CPUState* cpu) {
         /* 0223B8BC */ cpu->ctr = cpu->r[0];
         /* 0223B8C0 */ rbrew_dispatch(cpu, cpu->ctr); return;
   L_0223B948: ; // 0x223b948
-        /* 0223B948 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x0000004Cu);
-        /* 0223B94C */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223B948 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x0000004Cu));
+        /* 0223B94C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223B94C */ _t13 = _t12 & 0x00000001u;
         /* 0223B94C */ if (_t13) goto L_0223B950; else goto L_0223B974;
   L_0223B950: ; // 0x223b950
-        /* 0223B950 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000043u);
-        /* 0223B954 */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223B950 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000043u));
+        /* 0223B954 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223B954 */ _t15 = _t14 & 0x00000001u;
         /* 0223B954 */ if (_t15) goto L_0223B958; else goto L_0223B994;
   L_0223B958: ; // 0x223b958
-        /* 0223B958 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000046u);
-        /* 0223B95C */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223B958 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000046u));
+        /* 0223B95C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223B95C */ _t17 = _t16 & 0x00000001u;
         /* 0223B95C */ if (_t17) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0223B95C */ goto L_0223B960;
   L_0223B960: ; // 0x223b960
-        /* 0223B960 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000047u);
-        /* 0223B964 */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223B960 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000047u));
+        /* 0223B964 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223B964 */ _t19 = _t18 & 0x00000001u;
         /* 0223B964 */ if (_t19) goto L_0223B968; else goto L_0223B9CC;
   L_0223B968: ; // 0x223b968
-        /* 0223B968 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000049u);
-        /* 0223B96C */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223B968 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000049u));
+        /* 0223B96C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223B96C */ _t21 = _t20 & 0x00000001u;
         /* 0223B96C */ if (_t21) goto L_0223B970; else goto L_0223B9B8;
   L_0223B970: ; // 0x223b970
         /* 0223B970 */ return;
   L_0223B974: ; // 0x223b974
-        /* 0223B974 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x0000004Fu);
-        /* 0223B978 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223B974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x0000004Fu));
+        /* 0223B978 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223B978 */ _t23 = _t22 & 0x00000001u;
         /* 0223B978 */ if (_t23) goto L_0223B9CC; else goto L_0223B97C;
   L_0223B97C: ; // 0x223b97c
-        /* 0223B97C */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B97C */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B97C */ _t25 = _t24 & 0x00000001u;
         /* 0223B97C */ if (_t25) goto L_0223B9AC; else goto L_0223B980;
   L_0223B980: ; // 0x223b980
-        /* 0223B980 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000054u);
-        /* 0223B984 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B980 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000054u));
+        /* 0223B984 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B984 */ _t27 = _t26 & 0x00000001u;
         /* 0223B984 */ if (_t27) goto L_0223B9C4; else goto L_0223B988;
   L_0223B988: ; // 0x223b988
-        /* 0223B988 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[3], 0x00000079u);
-        /* 0223B98C */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[3], 0x00000079u));
+        /* 0223B98C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B98C */ _t29 = _t28 & 0x00000001u;
         /* 0223B98C */ if (_t29) goto L_0223B9CC; else goto L_0223B990;
   L_0223B990: ; // 0x223b990
@@ -14668,8 +14668,8 @@ void Gambit_fn_0223B9D8(CPUState* cpu) {
   L_0223B9D8: ; // 0x223b9d8
         /* 0223B9D8 */ _t0 = cpu->r[3] + 0x000002CBu;
         /* 0223B9D8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t0);
-        /* 0223B9DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223B9E0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223B9DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223B9E0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223B9E0 */ _t2 = _t1 & 0x00000001u;
         /* 0223B9E0 */ if (_t2) goto L_0223B9F0; else goto L_0223B9E4;
   L_0223B9E4: ; // 0x223b9e4
@@ -14691,8 +14691,8 @@ void Gambit_fn_0223B9FC(CPUState* cpu) {
   L_0223B9FC: ; // 0x223b9fc
         /* 0223B9FC */ _t0 = cpu->r[3] + 0x000002CBu;
         /* 0223B9FC */ cpu->r[0] = rbrew_read8(cpu->mem, _t0);
-        /* 0223BA00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223BA04 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223BA00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223BA04 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223BA04 */ _t2 = _t1 & 0x00000001u;
         /* 0223BA04 */ if (_t2) goto L_0223BA14; else goto L_0223BA08;
   L_0223BA08: ; // 0x223ba08
@@ -14714,8 +14714,8 @@ void Gambit_fn_0223BA20(CPUState* cpu) {
   L_0223BA20: ; // 0x223ba20
         /* 0223BA20 */ _t0 = cpu->r[3] + 0x000002CBu;
         /* 0223BA20 */ cpu->r[0] = rbrew_read8(cpu->mem, _t0);
-        /* 0223BA24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223BA28 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223BA24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223BA28 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223BA28 */ _t2 = _t1 & 0x00000001u;
         /* 0223BA28 */ if (_t2) goto L_0223BA38; else goto L_0223BA2C;
   L_0223BA2C: ; // 0x223ba2c
@@ -14763,10 +14763,10 @@ void Gambit_fn_0223BA44(CPUState* cpu) {
         /* 0223BA84 */ _t8 = cpu->r[1] + 0x00000008u;
         /* 0223BA84 */ rbrew_write32(cpu->mem, _t8, cpu->r[9]);
         /* 0223BA88 */ cpu->r[10] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 0223BA88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0223BA88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0223BA8C */ _t9 = cpu->r[30] + 0x00000164u;
         /* 0223BA8C */ cpu->r[8] = rbrew_read32(cpu->mem, _t9);
-        /* 0223BA90 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223BA90 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223BA90 */ _t11 = _t10 & 0x00000001u;
         /* 0223BA90 */ if (_t11) goto L_0223BAB8; else goto L_0223BA94;
   L_0223BA94: ; // 0x223ba94
@@ -14775,11 +14775,11 @@ void Gambit_fn_0223BA44(CPUState* cpu) {
         /* 0223BA9C */ cpu->r[0] = cpu->r[11] + 0xFFFFFFFFu;
         /* 0223BAA0 */ cpu->r[9] = cpu->r[7] + 0x101E0000u;
         /* 0223BAA4 */ cpu->r[0] = cpu->r[11] - cpu->r[0];
-        /* 0223BAA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0223BAA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0223BAA8 */ _t12 = cpu->r[9] + 0xFFFF9484u;
         /* 0223BAA8 */ cpu->r[24] = rbrew_read32(cpu->mem, _t12);
         /* 0223BAAC */ cpu->r[0] = 0x00000000u;
-        /* 0223BAB0 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223BAB0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223BAB0 */ _t14 = _t13 & 0x00000001u;
         /* 0223BAB0 */ if (_t14) goto L_0223BADC; else goto L_0223BAB4;
   L_0223BAB4: ; // 0x223bab4
@@ -14790,28 +14790,28 @@ void Gambit_fn_0223BA44(CPUState* cpu) {
         /* 0223BAC0 */ cpu->r[0] = cpu->r[12] + 0xFFFFFFFFu;
         /* 0223BAC4 */ cpu->r[9] = cpu->r[7] + 0x101E0000u;
         /* 0223BAC8 */ cpu->r[0] = cpu->r[12] - cpu->r[0];
-        /* 0223BAC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0223BAC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0223BACC */ _t15 = cpu->r[9] + 0xFFFF9484u;
         /* 0223BACC */ cpu->r[24] = rbrew_read32(cpu->mem, _t15);
         /* 0223BAD0 */ cpu->r[0] = 0x00000000u;
-        /* 0223BAD4 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223BAD4 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223BAD4 */ _t17 = _t16 & 0x00000001u;
         /* 0223BAD4 */ if (_t17) goto L_0223BADC; else goto L_0223BAD8;
   L_0223BAD8: ; // 0x223bad8
         /* 0223BAD8 */ cpu->r[0] = cpu->r[24];
   L_0223BADC: ; // 0x223badc
-        /* 0223BADC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000004u);
-        /* 0223BAE0 */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223BADC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000004u));
+        /* 0223BAE0 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223BAE0 */ _t19 = _t18 & 0x00000001u;
         /* 0223BAE0 */ if (_t19) goto L_0223BAE4; else goto L_0223BAE8;
   L_0223BAE4: ; // 0x223bae4
         /* 0223BAE4 */ cpu->r[0] = 0x00000004u;
   L_0223BAE8: ; // 0x223bae8
         /* 0223BAE8 */ cpu->r[25] = 0x00000000u;
-        /* 0223BAEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], cpu->r[0]);
+        /* 0223BAEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], cpu->r[0]));
         /* 0223BAF0 */ _t20 = cpu->r[29] + 0x00000140u;
         /* 0223BAF0 */ rbrew_write32(cpu->mem, _t20, cpu->r[0]);
-        /* 0223BAF4 */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223BAF4 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223BAF4 */ _t22 = _t21 & 0x00000001u;
         /* 0223BAF4 */ if (_t22) goto L_0223BAF8; else goto L_0223BB40;
   L_0223BAF8: ; // 0x223baf8
@@ -14832,9 +14832,9 @@ void Gambit_fn_0223BA44(CPUState* cpu) {
         /* 0223BB2C */ _t23 = cpu->r[29] + 0x00000140u;
         /* 0223BB2C */ cpu->r[11] = rbrew_read32(cpu->mem, _t23);
         /* 0223BB30 */ cpu->r[25] = cpu->r[25] + 0x00000001u;
-        /* 0223BB34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], cpu->r[11]);
+        /* 0223BB34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], cpu->r[11]));
         /* 0223BB38 */ cpu->r[26] = cpu->r[26] + 0x0000000Cu;
-        /* 0223BB3C */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223BB3C */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223BB3C */ _t25 = _t24 & 0x00000001u;
         /* 0223BB3C */ if (_t25) goto L_0223BB08; else goto L_0223BB40;
   L_0223BB40: ; // 0x223bb40
@@ -14844,32 +14844,32 @@ void Gambit_fn_0223BA44(CPUState* cpu) {
         /* 0223BB48 */ Gambit_fn_02C886F8(cpu);
         /* 0223BB4C */ _t27 = cpu->r[29] + 0x00000140u;
         /* 0223BB4C */ cpu->r[0] = rbrew_read32(cpu->mem, _t27);
-        /* 0223BB50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0223BB50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0223BB54 */ cpu->f[31] = cpu->f[1];
-        /* 0223BB58 */ _t28 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223BB58 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223BB58 */ _t29 = _t28 & 0x00000001u;
         /* 0223BB58 */ if (_t29) goto L_0223BB5C; else goto L_0223BB7C;
   L_0223BB5C: ; // 0x223bb5c
         /* 0223BB5C */ _t30 = cpu->r[29] + 0x000001A4u;
         /* 0223BB5C */ cpu->r[0] = rbrew_read8(cpu->mem, _t30);
-        /* 0223BB60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x000000FEu);
+        /* 0223BB60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x000000FEu));
         /* 0223BB64 */ _t31 = cpu->r[29] + 0x000002C4u;
         /* 0223BB64 */ rbrew_write8(cpu->mem, _t31, (uint8_t)cpu->r[0]);
-        /* 0223BB68 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223BB68 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223BB68 */ _t33 = _t32 & 0x00000001u;
         /* 0223BB68 */ if (_t33) goto L_0223BB6C; else goto L_0223BBC8;
   L_0223BB6C: ; // 0x223bb6c
         /* 0223BB6C */ _t34 = cpu->r[29] + 0x00000148u;
         /* 0223BB6C */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t34);
-        /* 0223BB70 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[31]);
-        /* 0223BB74 */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223BB70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[31]));
+        /* 0223BB74 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223BB74 */ _t36 = _t35 & 0x00000001u;
         /* 0223BB74 */ if (_t36) goto L_0223BB78; else goto L_0223BBC8;
   L_0223BB78: ; // 0x223bb78
         /* 0223BB78 */ goto L_0223BBC0;
   L_0223BB7C: ; // 0x223bb7c
-        /* 0223BB7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 0223BB80 */ _t37 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223BB7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 0223BB80 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223BB80 */ _t38 = _t37 & 0x00000001u;
         /* 0223BB80 */ if (_t38) goto L_0223BB84; else goto L_0223BBC0;
   L_0223BB84: ; // 0x223bb84
@@ -14884,15 +14884,15 @@ void Gambit_fn_0223BA44(CPUState* cpu) {
         /* 0223BBA4 */ Gambit_fn_02040F70(cpu);
         /* 0223BBA8 */ _t39 = cpu->r[29] + 0x000002C4u;
         /* 0223BBA8 */ cpu->r[7] = rbrew_read8(cpu->mem, _t39);
-        /* 0223BBAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x000000FEu);
-        /* 0223BBB0 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223BBAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x000000FEu));
+        /* 0223BBB0 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223BBB0 */ _t41 = _t40 & 0x00000001u;
         /* 0223BBB0 */ if (_t41) goto L_0223BBB4; else goto L_0223BBC8;
   L_0223BBB4: ; // 0x223bbb4
         /* 0223BBB4 */ _t42 = cpu->r[1] + 0x00000010u;
         /* 0223BBB4 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t42);
-        /* 0223BBB8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[31]);
-        /* 0223BBBC */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223BBB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[31]));
+        /* 0223BBBC */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223BBBC */ _t44 = _t43 & 0x00000001u;
         /* 0223BBBC */ if (_t44) goto L_0223BBC0; else goto L_0223BBC8;
   L_0223BBC0: ; // 0x223bbc0
@@ -14909,26 +14909,26 @@ void Gambit_fn_0223BA44(CPUState* cpu) {
         /* 0223BBD8 */ _t48 = cpu->r[8] + 0x00002DF4u;
         /* 0223BBD8 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t48);
         /* 0223BBDC */ cpu->r[9] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000018u, 0x0000001Bu);
-        /* 0223BBDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0223BBDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0223BBE0 */ _t49 = cpu->r[12] + 0x00002DFCu;
         /* 0223BBE0 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t49);
-        /* 0223BBE4 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223BBE4 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223BBE4 */ _t51 = _t50 & 0x00000001u;
         /* 0223BBE4 */ if (_t51) goto L_0223BC48; else goto L_0223BBE8;
   L_0223BBE8: ; // 0x223bbe8
         /* 0223BBE8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Eu, 0x0000001Eu);
-        /* 0223BBE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0223BBE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0223BBEC */ cpu->r[31] = cpu->r[30] + 0x000000A8u;
-        /* 0223BBF0 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223BBF0 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223BBF0 */ _t53 = _t52 & 0x00000001u;
         /* 0223BBF0 */ if (_t53) goto L_0223BC2C; else goto L_0223BBF4;
   L_0223BBF4: ; // 0x223bbf4
         /* 0223BBF4 */ cpu->r[3] = cpu->r[30] + 0x00000138u;
         /* 0223BBF8 */ Gambit_fn_02C69350(cpu);
-        /* 0223BBFC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
+        /* 0223BBFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
         /* 0223BC00 */ _t54 = cpu->r[30] + 0x00000000u;
         /* 0223BC00 */ cpu->r[7] = rbrew_read32(cpu->mem, _t54);
-        /* 0223BC04 */ _t55 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223BC04 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223BC04 */ _t56 = _t55 & 0x00000001u;
         /* 0223BC04 */ if (_t56) goto L_0223BC08; else goto L_0223BC24;
   L_0223BC08: ; // 0x223bc08
@@ -14961,18 +14961,18 @@ void Gambit_fn_0223BA44(CPUState* cpu) {
         /* 0223BC44 */ goto L_0223BCA4;
   L_0223BC48: ; // 0x223bc48
         /* 0223BC48 */ cpu->r[9] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0223BC48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0223BC48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0223BC4C */ cpu->r[31] = cpu->r[30] + 0x00000048u;
-        /* 0223BC50 */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223BC50 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223BC50 */ _t67 = _t66 & 0x00000001u;
         /* 0223BC50 */ if (_t67) goto L_0223BC8C; else goto L_0223BC54;
   L_0223BC54: ; // 0x223bc54
         /* 0223BC54 */ cpu->r[3] = cpu->r[30] + 0x0000012Cu;
         /* 0223BC58 */ Gambit_fn_02C69350(cpu);
-        /* 0223BC5C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[31]);
+        /* 0223BC5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[31]));
         /* 0223BC60 */ _t68 = cpu->r[30] + 0x00000000u;
         /* 0223BC60 */ cpu->r[12] = rbrew_read32(cpu->mem, _t68);
-        /* 0223BC64 */ _t69 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223BC64 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223BC64 */ _t70 = _t69 & 0x00000001u;
         /* 0223BC64 */ if (_t70) goto L_0223BC68; else goto L_0223BC84;
   L_0223BC68: ; // 0x223bc68
@@ -15012,7 +15012,7 @@ void Gambit_fn_0223BA44(CPUState* cpu) {
         /* 0223BCB0 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t82);
         /* 0223BCB4 */ _t83 = cpu->r[1] + 0x00000058u;
         /* 0223BCB4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t83);
-        /* 0223BCB8 */ _t84 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223BCB8 */ _t84 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223BCB8 */ _t85 = _t84 & 0x00000001u;
         /* 0223BCB8 */ if (_t85) goto L_0223BCBC; // else: addr-0 trap, fall-through
   L_0223BCBC: ; // 0x223bcbc
@@ -15033,15 +15033,15 @@ void Gambit_fn_0223BCCC(CPUState* cpu) {
         /* 0223BCD0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t0);
         /* 0223BCD4 */ _t1 = cpu->r[11] + 0x00002DF4u;
         /* 0223BCD4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t1);
-        /* 0223BCD8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 0223BCDC */ _t2 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223BCD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 0223BCDC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223BCDC */ _t3 = _t2 & 0x00000001u;
         /* 0223BCDC */ if (_t3) goto L_0223BCE0; else goto L_0223BD04;
   L_0223BCE0: ; // 0x223bce0
         /* 0223BCE0 */ _t4 = cpu->r[3] + 0x000002CBu;
         /* 0223BCE0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t4);
-        /* 0223BCE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223BCE8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223BCE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223BCE8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223BCE8 */ _t6 = _t5 & 0x00000001u;
         /* 0223BCE8 */ if (_t6) goto L_0223BCF8; else goto L_0223BCEC;
   L_0223BCEC: ; // 0x223bcec
@@ -15068,8 +15068,8 @@ void Gambit_fn_0223BD10(CPUState* cpu) {
   L_0223BD10: ; // 0x223bd10
         /* 0223BD10 */ _t0 = cpu->r[3] + 0x000002CBu;
         /* 0223BD10 */ cpu->r[0] = rbrew_read8(cpu->mem, _t0);
-        /* 0223BD14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223BD18 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223BD14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223BD18 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223BD18 */ _t2 = _t1 & 0x00000001u;
         /* 0223BD18 */ if (_t2) goto L_0223BD28; else goto L_0223BD1C;
   L_0223BD1C: ; // 0x223bd1c
@@ -15091,8 +15091,8 @@ void Gambit_fn_0223BD34(CPUState* cpu) {
   L_0223BD34: ; // 0x223bd34
         /* 0223BD34 */ _t0 = cpu->r[3] + 0x000002CBu;
         /* 0223BD34 */ cpu->r[0] = rbrew_read8(cpu->mem, _t0);
-        /* 0223BD38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223BD3C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223BD38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223BD3C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223BD3C */ _t2 = _t1 & 0x00000001u;
         /* 0223BD3C */ if (_t2) goto L_0223BD4C; else goto L_0223BD40;
   L_0223BD40: ; // 0x223bd40
@@ -15114,8 +15114,8 @@ void Gambit_fn_0223BD58(CPUState* cpu) {
   L_0223BD58: ; // 0x223bd58
         /* 0223BD58 */ _t0 = cpu->r[3] + 0x000002CBu;
         /* 0223BD58 */ cpu->r[0] = rbrew_read8(cpu->mem, _t0);
-        /* 0223BD5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223BD60 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223BD5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223BD60 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223BD60 */ _t2 = _t1 & 0x00000001u;
         /* 0223BD60 */ if (_t2) goto L_0223BD70; else goto L_0223BD64;
   L_0223BD64: ; // 0x223bd64
@@ -15168,10 +15168,10 @@ void Gambit_fn_0223BD7C(CPUState* cpu) {
         /* 0223BDC0 */ _t11 = cpu->r[1] + 0x00000008u;
         /* 0223BDC0 */ rbrew_write32(cpu->mem, _t11, cpu->r[8]);
         /* 0223BDC4 */ cpu->r[11] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0223BDC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0223BDC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0223BDC8 */ _t12 = cpu->r[1] + 0x00000010u;
         /* 0223BDC8 */ rbrew_write32(cpu->mem, _t12, cpu->r[0]);
-        /* 0223BDCC */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223BDCC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223BDCC */ _t14 = _t13 & 0x00000001u;
         /* 0223BDCC */ if (_t14) goto L_0223BE68; else goto L_0223BDD0;
   L_0223BDD0: ; // 0x223bdd0
@@ -15184,10 +15184,10 @@ void Gambit_fn_0223BD7C(CPUState* cpu) {
         /* 0223BDE0 */ cpu->f[10] = fma(cpu->f[13], cpu->f[13], cpu->f[0]);
         /* 0223BDE4 */ _t17 = cpu->r[7] + 0x00002DF4u;
         /* 0223BDE4 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t17);
-        /* 0223BDE8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[11]);
+        /* 0223BDE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[11]));
         /* 0223BDEC */ _t18 = cpu->r[1] + 0x0000000Cu;
         /* 0223BDEC */ rbrew_write_f32(cpu->mem, _t18, cpu->f[11]);
-        /* 0223BDF0 */ _t19 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223BDF0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223BDF0 */ _t20 = _t19 & 0x00000001u;
         /* 0223BDF0 */ if (_t20) goto L_0223BDF4; else goto L_0223BE34;
   L_0223BDF4: ; // 0x223bdf4
@@ -15215,20 +15215,20 @@ void Gambit_fn_0223BD7C(CPUState* cpu) {
         /* 0223BE30 */ _t27 = cpu->r[1] + 0x00000010u;
         /* 0223BE30 */ rbrew_write_f32(cpu->mem, _t27, cpu->f[12]);
   L_0223BE34: ; // 0x223be34
-        /* 0223BE34 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[11]);
-        /* 0223BE38 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223BE34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[11]));
+        /* 0223BE38 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223BE38 */ _t29 = _t28 & 0x00000001u;
         /* 0223BE38 */ if (_t29) goto L_0223BE3C; else goto L_0223BE68;
   L_0223BE3C: ; // 0x223be3c
         /* 0223BE3C */ _t30 = cpu->r[1] + 0x0000000Cu;
         /* 0223BE3C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t30);
-        /* 0223BE40 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[11]);
-        /* 0223BE44 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223BE40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[11]));
+        /* 0223BE44 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223BE44 */ _t32 = _t31 & 0x00000001u;
         /* 0223BE44 */ if (_t32) goto L_0223BE48; else goto L_0223BE68;
   L_0223BE48: ; // 0x223be48
-        /* 0223BE48 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[11]);
-        /* 0223BE4C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223BE48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[11]));
+        /* 0223BE4C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223BE4C */ _t34 = _t33 & 0x00000001u;
         /* 0223BE4C */ if (_t34) goto L_0223BE50; else goto L_0223BE68;
   L_0223BE50: ; // 0x223be50
@@ -15248,8 +15248,8 @@ void Gambit_fn_0223BD7C(CPUState* cpu) {
         /* 0223BE68 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 0223BE6C */ cpu->r[3] = cpu->r[1] + 0x00000014u;
         /* 0223BE70 */ Gambit_fn_021C6DD8(cpu);
-        /* 0223BE74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223BE78 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223BE74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223BE78 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223BE78 */ _t42 = _t41 & 0x00000001u;
         /* 0223BE78 */ if (_t42) goto L_0223BE7C; else goto L_0223BE90;
   L_0223BE7C: ; // 0x223be7c
@@ -15266,7 +15266,7 @@ void Gambit_fn_0223BD7C(CPUState* cpu) {
         /* 0223BEA0 */ _t43 = cpu->r[31] + 0x000002C8u;
         /* 0223BEA0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t43);
         /* 0223BEA4 */ /* nop */
-        /* 0223BEA8 */ _t44 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223BEA8 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223BEA8 */ _t45 = _t44 & 0x00000001u;
         /* 0223BEA8 */ if (_t45) goto L_0223BEAC; else goto L_0223BEC0;
   L_0223BEAC: ; // 0x223beac
@@ -15336,10 +15336,10 @@ void Gambit_fn_0223BD80(CPUState* cpu) {
         /* 0223BDC0 */ _t11 = cpu->r[1] + 0x00000008u;
         /* 0223BDC0 */ rbrew_write32(cpu->mem, _t11, cpu->r[8]);
         /* 0223BDC4 */ cpu->r[11] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0223BDC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0223BDC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0223BDC8 */ _t12 = cpu->r[1] + 0x00000010u;
         /* 0223BDC8 */ rbrew_write32(cpu->mem, _t12, cpu->r[0]);
-        /* 0223BDCC */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223BDCC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223BDCC */ _t14 = _t13 & 0x00000001u;
         /* 0223BDCC */ if (_t14) goto L_0223BE68; else goto L_0223BDD0;
   L_0223BDD0: ; // 0x223bdd0
@@ -15352,10 +15352,10 @@ void Gambit_fn_0223BD80(CPUState* cpu) {
         /* 0223BDE0 */ cpu->f[10] = fma(cpu->f[13], cpu->f[13], cpu->f[0]);
         /* 0223BDE4 */ _t17 = cpu->r[7] + 0x00002DF4u;
         /* 0223BDE4 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t17);
-        /* 0223BDE8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[11]);
+        /* 0223BDE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[11]));
         /* 0223BDEC */ _t18 = cpu->r[1] + 0x0000000Cu;
         /* 0223BDEC */ rbrew_write_f32(cpu->mem, _t18, cpu->f[11]);
-        /* 0223BDF0 */ _t19 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223BDF0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223BDF0 */ _t20 = _t19 & 0x00000001u;
         /* 0223BDF0 */ if (_t20) goto L_0223BDF4; else goto L_0223BE34;
   L_0223BDF4: ; // 0x223bdf4
@@ -15383,20 +15383,20 @@ void Gambit_fn_0223BD80(CPUState* cpu) {
         /* 0223BE30 */ _t27 = cpu->r[1] + 0x00000010u;
         /* 0223BE30 */ rbrew_write_f32(cpu->mem, _t27, cpu->f[12]);
   L_0223BE34: ; // 0x223be34
-        /* 0223BE34 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[11]);
-        /* 0223BE38 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223BE34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[11]));
+        /* 0223BE38 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223BE38 */ _t29 = _t28 & 0x00000001u;
         /* 0223BE38 */ if (_t29) goto L_0223BE3C; else goto L_0223BE68;
   L_0223BE3C: ; // 0x223be3c
         /* 0223BE3C */ _t30 = cpu->r[1] + 0x0000000Cu;
         /* 0223BE3C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t30);
-        /* 0223BE40 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[11]);
-        /* 0223BE44 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223BE40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[11]));
+        /* 0223BE44 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223BE44 */ _t32 = _t31 & 0x00000001u;
         /* 0223BE44 */ if (_t32) goto L_0223BE48; else goto L_0223BE68;
   L_0223BE48: ; // 0x223be48
-        /* 0223BE48 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[11]);
-        /* 0223BE4C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223BE48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[11]));
+        /* 0223BE4C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223BE4C */ _t34 = _t33 & 0x00000001u;
         /* 0223BE4C */ if (_t34) goto L_0223BE50; else goto L_0223BE68;
   L_0223BE50: ; // 0x223be50
@@ -15416,8 +15416,8 @@ void Gambit_fn_0223BD80(CPUState* cpu) {
         /* 0223BE68 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 0223BE6C */ cpu->r[3] = cpu->r[1] + 0x00000014u;
         /* 0223BE70 */ Gambit_fn_021C6DD8(cpu);
-        /* 0223BE74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223BE78 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223BE74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223BE78 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223BE78 */ _t42 = _t41 & 0x00000001u;
         /* 0223BE78 */ if (_t42) goto L_0223BE7C; else goto L_0223BE90;
   L_0223BE7C: ; // 0x223be7c
@@ -15434,7 +15434,7 @@ void Gambit_fn_0223BD80(CPUState* cpu) {
         /* 0223BEA0 */ _t43 = cpu->r[31] + 0x000002C8u;
         /* 0223BEA0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t43);
         /* 0223BEA4 */ /* nop */
-        /* 0223BEA8 */ _t44 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223BEA8 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223BEA8 */ _t45 = _t44 & 0x00000001u;
         /* 0223BEA8 */ if (_t45) goto L_0223BEAC; else goto L_0223BEC0;
   L_0223BEAC: ; // 0x223beac
@@ -15493,9 +15493,9 @@ void Gambit_fn_0223BEE8(CPUState* cpu) {
         /* 0223BF14 */ _t6 = cpu->r[23] + 0x00000230u;
         /* 0223BF14 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
         /* 0223BF18 */ cpu->r[24] = 0x00000000u;
-        /* 0223BF1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], cpu->r[0]);
+        /* 0223BF1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], cpu->r[0]));
         /* 0223BF20 */ cpu->f[30] = cpu->f[1];
-        /* 0223BF24 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223BF24 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223BF24 */ _t8 = _t7 & 0x00000001u;
         /* 0223BF24 */ if (_t8) goto L_0223BF28; else goto L_0223BFB8;
   L_0223BF28: ; // 0x223bf28
@@ -15549,9 +15549,9 @@ void Gambit_fn_0223BEE8(CPUState* cpu) {
         /* 0223BFA4 */ _t24 = cpu->r[23] + 0x00000230u;
         /* 0223BFA4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t24);
         /* 0223BFA8 */ cpu->r[24] = cpu->r[24] + 0x00000001u;
-        /* 0223BFAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], cpu->r[10]);
+        /* 0223BFAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], cpu->r[10]));
         /* 0223BFB0 */ cpu->r[25] = cpu->r[25] + 0x0000000Cu;
-        /* 0223BFB4 */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223BFB4 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223BFB4 */ _t26 = _t25 & 0x00000001u;
         /* 0223BFB4 */ if (_t26) goto L_0223BF4C; else goto L_0223BFB8;
   L_0223BFB8: ; // 0x223bfb8
@@ -15564,7 +15564,7 @@ void Gambit_fn_0223BEE8(CPUState* cpu) {
         /* 0223BFC4 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t29);
         /* 0223BFC8 */ _t30 = cpu->r[1] + 0x00000060u;
         /* 0223BFC8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t30);
-        /* 0223BFCC */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223BFCC */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223BFCC */ _t32 = _t31 & 0x00000001u;
         /* 0223BFCC */ if (_t32) goto L_0223BFD0; // else: addr-0 trap, fall-through
   L_0223BFD0: ; // 0x223bfd0
@@ -15719,28 +15719,28 @@ void Gambit_fn_0223BFE0(CPUState* cpu) {
         /* 0223C15C */ _t40 = cpu->r[8] + 0x00002E50u;
         /* 0223C15C */ cpu->f[22] = rbrew_read_f32(cpu->mem, _t40);
         /* 0223C160 */ cpu->r[5] = 0x10050000u;
-        /* 0223C164 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x0000001Eu);
+        /* 0223C164 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x0000001Eu));
         /* 0223C168 */ _t41 = cpu->r[7] + 0x00002E48u;
         /* 0223C168 */ cpu->f[21] = rbrew_read_f32(cpu->mem, _t41);
         /* 0223C16C */ cpu->f[27] = cpu->f[1];
         /* 0223C170 */ _t42 = cpu->r[5] + 0x00002E44u;
         /* 0223C170 */ cpu->f[25] = rbrew_read_f32(cpu->mem, _t42);
-        /* 0223C174 */ _t43 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223C174 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223C174 */ _t44 = _t43 & 0x00000001u;
         /* 0223C174 */ if (_t44) goto L_0223C178; else goto L_0223C26C;
   L_0223C178: ; // 0x223c178
-        /* 0223C178 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000011u);
-        /* 0223C17C */ _t45 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223C178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000011u));
+        /* 0223C17C */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223C17C */ _t46 = _t45 & 0x00000001u;
         /* 0223C17C */ if (_t46) goto L_0223C180; else goto L_0223C364;
   L_0223C180: ; // 0x223c180
-        /* 0223C180 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000014u);
-        /* 0223C184 */ _t47 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223C180 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000014u));
+        /* 0223C184 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223C184 */ _t48 = _t47 & 0x00000001u;
         /* 0223C184 */ if (_t48) goto L_0223D28C; else goto L_0223C188;
   L_0223C188: ; // 0x223c188
-        /* 0223C188 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x0000001Bu);
-        /* 0223C18C */ _t49 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223C188 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x0000001Bu));
+        /* 0223C18C */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223C18C */ _t50 = _t49 & 0x00000001u;
         /* 0223C18C */ if (_t50) goto L_0223C190; else goto L_0223C364;
   L_0223C190: ; // 0x223c190
@@ -15799,14 +15799,14 @@ void Gambit_fn_0223BFE0(CPUState* cpu) {
         /* 0223C210 */ rbrew_write8(cpu->mem, _t70, (uint8_t)cpu->r[9]);
         /* 0223C214 */ _t71 = cpu->r[1] + 0x00000038u;
         /* 0223C214 */ rbrew_write32(cpu->mem, _t71, cpu->r[8]);
-        /* 0223C218 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0223C218 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0223C21C */ _t72 = cpu->r[1] + 0x00000048u;
         /* 0223C21C */ rbrew_write32(cpu->mem, _t72, cpu->r[25]);
         /* 0223C220 */ _t73 = cpu->r[1] + 0x0000004Cu;
         /* 0223C220 */ rbrew_write32(cpu->mem, _t73, cpu->r[22]);
         /* 0223C224 */ _t74 = cpu->r[1] + 0x00000050u;
         /* 0223C224 */ rbrew_write16(cpu->mem, _t74, (uint16_t)cpu->r[26]);
-        /* 0223C228 */ _t75 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223C228 */ _t75 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223C228 */ _t76 = _t75 & 0x00000001u;
         /* 0223C228 */ if (_t76) goto L_0223C22C; else goto L_0223D2F0;
   L_0223C22C: ; // 0x223c22c
@@ -15837,14 +15837,14 @@ void Gambit_fn_0223BFE0(CPUState* cpu) {
         /* 0223C264 */ rbrew_write32(cpu->mem, _t86, cpu->r[6]);
         /* 0223C268 */ goto L_0223D320;
   L_0223C26C: ; // 0x223c26c
-        /* 0223C26C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x0000004Cu);
-        /* 0223C270 */ _t87 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223C26C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x0000004Cu));
+        /* 0223C270 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223C270 */ _t88 = _t87 & 0x00000001u;
         /* 0223C270 */ if (_t88) goto L_0223C274; else goto L_0223C348;
   L_0223C274: ; // 0x223c274
         /* 0223C274 */ cpu->r[10] = cpu->r[10] + 0xFFFFFFE2u;
-        /* 0223C278 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x0000002Bu);
-        /* 0223C27C */ _t89 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223C278 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x0000002Bu));
+        /* 0223C27C */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223C27C */ _t90 = _t89 & 0x00000001u;
         /* 0223C27C */ if (_t90) goto L_0223D28C; else goto L_0223C280;
   L_0223C280: ; // 0x223c280
@@ -15855,22 +15855,22 @@ void Gambit_fn_0223BFE0(CPUState* cpu) {
         /* 0223C290 */ cpu->ctr = cpu->r[0];
         /* 0223C294 */ rbrew_dispatch(cpu, cpu->ctr); return;
   L_0223C348: ; // 0x223c348
-        /* 0223C348 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x0000004Fu);
-        /* 0223C34C */ _t91 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223C348 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x0000004Fu));
+        /* 0223C34C */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223C34C */ _t92 = _t91 & 0x00000001u;
         /* 0223C34C */ if (_t92) goto L_0223D010; else goto L_0223C350;
   L_0223C350: ; // 0x223c350
-        /* 0223C350 */ _t93 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223C350 */ _t93 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223C350 */ _t94 = _t93 & 0x00000001u;
         /* 0223C350 */ if (_t94) goto L_0223D0A8; else goto L_0223C354;
   L_0223C354: ; // 0x223c354
-        /* 0223C354 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000054u);
-        /* 0223C358 */ _t95 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223C354 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000054u));
+        /* 0223C358 */ _t95 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223C358 */ _t96 = _t95 & 0x00000001u;
         /* 0223C358 */ if (_t96) goto L_0223D26C; else goto L_0223C35C;
   L_0223C35C: ; // 0x223c35c
-        /* 0223C35C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000079u);
-        /* 0223C360 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223C35C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000079u));
+        /* 0223C360 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223C360 */ _t98 = _t97 & 0x00000001u;
         /* 0223C360 */ if (_t98) goto L_0223C364; else goto L_0223D28C;
   L_0223C364: ; // 0x223c364
@@ -15930,10 +15930,10 @@ void Gambit_fn_0223BFE0(CPUState* cpu) {
         /* 0223C3E4 */ rbrew_write8(cpu->mem, _t119, (uint8_t)cpu->r[24]);
         /* 0223C3E8 */ _t120 = cpu->r[27] + 0x000002C5u;
         /* 0223C3E8 */ rbrew_write8(cpu->mem, _t120, (uint8_t)cpu->r[9]);
-        /* 0223C3EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0223C3EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0223C3F0 */ _t121 = cpu->r[1] + 0x0000004Cu;
         /* 0223C3F0 */ rbrew_write32(cpu->mem, _t121, cpu->r[22]);
-        /* 0223C3F4 */ _t122 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223C3F4 */ _t122 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223C3F4 */ _t123 = _t122 & 0x00000001u;
         /* 0223C3F4 */ if (_t123) goto L_0223C22C; else goto L_0223C3F8;
   L_0223C3F8: ; // 0x223c3f8
@@ -15995,10 +15995,10 @@ void Gambit_fn_0223BFE0(CPUState* cpu) {
         /* 0223D090 */ cpu->r[8] = rbrew_read32(cpu->mem, _t144);
         /* 0223D094 */ _t145 = cpu->r[1] + 0x0000003Cu;
         /* 0223D094 */ rbrew_write8(cpu->mem, _t145, (uint8_t)cpu->r[24]);
-        /* 0223D098 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0223D098 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0223D09C */ _t146 = cpu->r[1] + 0x00000038u;
         /* 0223D09C */ rbrew_write32(cpu->mem, _t146, cpu->r[8]);
-        /* 0223D0A0 */ _t147 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223D0A0 */ _t147 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223D0A0 */ _t148 = _t147 & 0x00000001u;
         /* 0223D0A0 */ if (_t148) goto L_0223C22C; else goto L_0223D0A4;
   L_0223D0A4: ; // 0x223d0a4
@@ -16056,14 +16056,14 @@ void Gambit_fn_0223BFE0(CPUState* cpu) {
         /* 0223D120 */ rbrew_write32(cpu->mem, _t167, cpu->r[25]);
         /* 0223D124 */ _t168 = cpu->r[1] + 0x00000038u;
         /* 0223D124 */ rbrew_write32(cpu->mem, _t168, cpu->r[8]);
-        /* 0223D128 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0223D128 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0223D12C */ _t169 = cpu->r[1] + 0x0000003Cu;
         /* 0223D12C */ rbrew_write8(cpu->mem, _t169, (uint8_t)cpu->r[24]);
         /* 0223D130 */ _t170 = cpu->r[1] + 0x0000004Cu;
         /* 0223D130 */ rbrew_write32(cpu->mem, _t170, cpu->r[22]);
         /* 0223D134 */ _t171 = cpu->r[27] + 0x00000130u;
         /* 0223D134 */ rbrew_write_f32(cpu->mem, _t171, cpu->f[26]);
-        /* 0223D138 */ _t172 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223D138 */ _t172 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223D138 */ _t173 = _t172 & 0x00000001u;
         /* 0223D138 */ if (_t173) goto L_0223C22C; else goto L_0223D13C;
   L_0223D13C: ; // 0x223d13c
@@ -16115,14 +16115,14 @@ void Gambit_fn_0223BFE0(CPUState* cpu) {
         /* 0223D2D4 */ rbrew_write32(cpu->mem, _t189, cpu->r[25]);
         /* 0223D2D8 */ _t190 = cpu->r[27] + 0x00000130u;
         /* 0223D2D8 */ rbrew_write_f32(cpu->mem, _t190, cpu->f[26]);
-        /* 0223D2DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0223D2DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0223D2E0 */ _t191 = cpu->r[1] + 0x00000054u;
         /* 0223D2E0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t191);
         /* 0223D2E4 */ _t192 = cpu->r[1] + 0x0000003Cu;
         /* 0223D2E4 */ rbrew_write8(cpu->mem, _t192, (uint8_t)cpu->r[24]);
         /* 0223D2E8 */ _t193 = cpu->r[1] + 0x00000038u;
         /* 0223D2E8 */ rbrew_write32(cpu->mem, _t193, cpu->r[8]);
-        /* 0223D2EC */ _t194 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223D2EC */ _t194 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223D2EC */ _t195 = _t194 & 0x00000001u;
         /* 0223D2EC */ if (_t195) goto L_0223C22C; else goto L_0223D2F0;
   L_0223D2F0: ; // 0x223d2f0
@@ -16387,11 +16387,11 @@ void Gambit_fn_0223BFE0(CPUState* cpu) {
         /* 0223D57C */ Gambit_fn_02C88F2C(cpu);
         /* 0223D580 */ _t284 = cpu->r[27] + 0x000002BCu;
         /* 0223D580 */ rbrew_write_f32(cpu->mem, _t284, cpu->f[29]);
-        /* 0223D584 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0223D584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0223D588 */ cpu->r[0] = 0xFFFFFFFFu;
         /* 0223D58C */ _t285 = cpu->r[27] + 0x000002C0u;
         /* 0223D58C */ rbrew_write_f32(cpu->mem, _t285, cpu->f[1]);
-        /* 0223D590 */ _t286 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223D590 */ _t286 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223D590 */ _t287 = _t286 & 0x00000001u;
         /* 0223D590 */ if (_t287) goto L_0223D594; else goto L_0223D598;
   L_0223D594: ; // 0x223d594
@@ -16400,26 +16400,26 @@ void Gambit_fn_0223BFE0(CPUState* cpu) {
         /* 0223D598 */ _t288 = cpu->r[27] + 0x000002C7u;
         /* 0223D598 */ rbrew_write8(cpu->mem, _t288, (uint8_t)cpu->r[0]);
         /* 0223D59C */ cpu->r[9] = 0xFFFFFFFFu;
-        /* 0223D5A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0223D5A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0223D5A4 */ _t289 = cpu->r[27] + 0x000002C8u;
         /* 0223D5A4 */ rbrew_write8(cpu->mem, _t289, (uint8_t)cpu->r[9]);
-        /* 0223D5A8 */ _t290 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223D5A8 */ _t290 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223D5A8 */ _t291 = _t290 & 0x00000001u;
         /* 0223D5A8 */ if (_t291) goto L_0223D5CC; else goto L_0223D5AC;
   L_0223D5AC: ; // 0x223d5ac
         /* 0223D5AC */ _t292 = cpu->r[30] + 0x0000015Cu;
         /* 0223D5AC */ cpu->r[0] = rbrew_read32(cpu->mem, _t292);
         /* 0223D5B0 */ cpu->r[11] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000018u, 0x0000001Au);
-        /* 0223D5B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0223D5B4 */ _t293 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223D5B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0223D5B4 */ _t293 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223D5B4 */ _t294 = _t293 & 0x00000001u;
         /* 0223D5B4 */ if (_t294) goto L_0223D5B8; else goto L_0223D5CC;
   L_0223D5B8: ; // 0x223d5b8
         /* 0223D5B8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Cu, 0x0000001Eu);
         /* 0223D5BC */ cpu->r[0] = cpu->r[12] + 0xFFFFFFFFu;
         /* 0223D5C0 */ cpu->r[12] = cpu->r[12] - cpu->r[0];
-        /* 0223D5C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0223D5C4 */ _t295 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223D5C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0223D5C4 */ _t295 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223D5C4 */ _t296 = _t295 & 0x00000001u;
         /* 0223D5C4 */ if (_t296) goto L_0223D5C8; else goto L_0223D5CC;
   L_0223D5C8: ; // 0x223d5c8
@@ -16434,27 +16434,27 @@ void Gambit_fn_0223BFE0(CPUState* cpu) {
         /* 0223D5D8 */ rbrew_write16(cpu->mem, _t299, (uint16_t)cpu->r[31]);
         /* 0223D5DC */ /* nop */
         /* 0223D5E0 */ cpu->r[25] = 0x101C0000u;
-        /* 0223D5E4 */ _t300 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223D5E4 */ _t300 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223D5E4 */ _t301 = _t300 & 0x00000001u;
         /* 0223D5E4 */ if (_t301) goto L_0223D5E8; else goto L_0223D660;
   L_0223D5E8: ; // 0x223d5e8
-        /* 0223D5E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], 0x0000001Eu);
-        /* 0223D5EC */ _t302 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223D5E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], 0x0000001Eu));
+        /* 0223D5EC */ _t302 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223D5EC */ _t303 = _t302 & 0x00000001u;
         /* 0223D5EC */ if (_t303) goto L_0223D608; else goto L_0223D5F0;
   L_0223D5F0: ; // 0x223d5f0
-        /* 0223D5F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], 0x00000024u);
-        /* 0223D5F4 */ _t304 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223D5F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], 0x00000024u));
+        /* 0223D5F4 */ _t304 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223D5F4 */ _t305 = _t304 & 0x00000001u;
         /* 0223D5F4 */ if (_t305) goto L_0223D5F8; else goto L_0223D6C8;
   L_0223D5F8: ; // 0x223d5f8
-        /* 0223D5F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], 0x0000003Du);
-        /* 0223D5FC */ _t306 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223D5F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], 0x0000003Du));
+        /* 0223D5FC */ _t306 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223D5FC */ _t307 = _t306 & 0x00000001u;
         /* 0223D5FC */ if (_t307) goto L_0223D6C8; else goto L_0223D600;
   L_0223D600: ; // 0x223d600
-        /* 0223D600 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], 0x00000048u);
-        /* 0223D604 */ _t308 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223D600 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], 0x00000048u));
+        /* 0223D604 */ _t308 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223D604 */ _t309 = _t308 & 0x00000001u;
         /* 0223D604 */ if (_t309) goto L_0223D6C8; else goto L_0223D608;
   L_0223D608: ; // 0x223d608
@@ -16494,29 +16494,29 @@ void Gambit_fn_0223BFE0(CPUState* cpu) {
         /* 0223D650 */ /* nop */
         /* 0223D654 */ _t325 = cpu->r[27] + 0x000002C9u;
         /* 0223D654 */ rbrew_write8(cpu->mem, _t325, (uint8_t)cpu->r[10]);
-        /* 0223D658 */ _t326 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223D658 */ _t326 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223D658 */ _t327 = _t326 & 0x00000001u;
         /* 0223D658 */ if (_t327) goto L_0223D65C; else goto L_0223D764;
   L_0223D65C: ; // 0x223d65c
         /* 0223D65C */ goto L_0223D6DC;
   L_0223D660: ; // 0x223d660
-        /* 0223D660 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], 0x0000001Eu);
-        /* 0223D664 */ _t328 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223D660 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], 0x0000001Eu));
+        /* 0223D664 */ _t328 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223D664 */ _t329 = _t328 & 0x00000001u;
         /* 0223D664 */ if (_t329) goto L_0223D680; else goto L_0223D668;
   L_0223D668: ; // 0x223d668
-        /* 0223D668 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], 0x00000024u);
-        /* 0223D66C */ _t330 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223D668 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], 0x00000024u));
+        /* 0223D66C */ _t330 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223D66C */ _t331 = _t330 & 0x00000001u;
         /* 0223D66C */ if (_t331) goto L_0223D670; else goto L_0223D6C0;
   L_0223D670: ; // 0x223d670
-        /* 0223D670 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], 0x0000003Du);
-        /* 0223D674 */ _t332 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223D670 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], 0x0000003Du));
+        /* 0223D674 */ _t332 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223D674 */ _t333 = _t332 & 0x00000001u;
         /* 0223D674 */ if (_t333) goto L_0223D6C0; else goto L_0223D678;
   L_0223D678: ; // 0x223d678
-        /* 0223D678 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], 0x00000048u);
-        /* 0223D67C */ _t334 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223D678 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], 0x00000048u));
+        /* 0223D67C */ _t334 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223D67C */ _t335 = _t334 & 0x00000001u;
         /* 0223D67C */ if (_t335) goto L_0223D6C0; else goto L_0223D680;
   L_0223D680: ; // 0x223d680
@@ -16561,14 +16561,14 @@ void Gambit_fn_0223BFE0(CPUState* cpu) {
         /* 0223D6D0 */ /* nop */
         /* 0223D6D4 */ _t352 = cpu->r[27] + 0x000002C9u;
         /* 0223D6D4 */ rbrew_write8(cpu->mem, _t352, (uint8_t)cpu->r[10]);
-        /* 0223D6D8 */ _t353 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223D6D8 */ _t353 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223D6D8 */ _t354 = _t353 & 0x00000001u;
         /* 0223D6D8 */ if (_t354) goto L_0223D6DC; else goto L_0223D764;
   L_0223D6DC: ; // 0x223d6dc
         /* 0223D6DC */ _t355 = cpu->r[27] + 0x000002C7u;
         /* 0223D6DC */ cpu->r[0] = rbrew_read8(cpu->mem, _t355);
         /* 0223D6E0 */ /* nop */
-        /* 0223D6E4 */ _t356 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223D6E4 */ _t356 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223D6E4 */ _t357 = _t356 & 0x00000001u;
         /* 0223D6E4 */ if (_t357) goto L_0223D6E8; else goto L_0223D764;
   L_0223D6E8: ; // 0x223d6e8
@@ -16581,8 +16581,8 @@ void Gambit_fn_0223BFE0(CPUState* cpu) {
         /* 0223D6F8 */ cpu->r[4] = cpu->r[28];
         /* 0223D6FC */ cpu->r[3] = cpu->r[25];
         /* 0223D700 */ Gambit_fn_021EFCC0(cpu);
-        /* 0223D704 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223D708 */ _t360 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223D704 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223D708 */ _t360 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223D708 */ _t361 = _t360 & 0x00000001u;
         /* 0223D708 */ if (_t361) goto L_0223D70C; else goto L_0223D74C;
   L_0223D70C: ; // 0x223d70c
@@ -16610,7 +16610,7 @@ void Gambit_fn_0223BFE0(CPUState* cpu) {
         /* 0223D73C */ rbrew_write32(cpu->mem, _t370, cpu->r[11]);
         /* 0223D740 */ _t371 = cpu->r[27] + 0x000002D4u;
         /* 0223D740 */ rbrew_write_f32(cpu->mem, _t371, cpu->f[28]);
-        /* 0223D744 */ _t372 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223D744 */ _t372 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223D744 */ _t373 = _t372 & 0x00000001u;
         /* 0223D744 */ if (_t373) goto L_0223D748; else goto L_0223D7D0;
   L_0223D748: ; // 0x223d748
@@ -16645,28 +16645,28 @@ void Gambit_fn_0223BFE0(CPUState* cpu) {
         /* 0223D790 */ rbrew_write32(cpu->mem, _t381, cpu->r[11]);
         /* 0223D794 */ _t382 = cpu->r[27] + 0x000002D4u;
         /* 0223D794 */ rbrew_write_f32(cpu->mem, _t382, cpu->f[28]);
-        /* 0223D798 */ _t383 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223D798 */ _t383 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223D798 */ _t384 = _t383 & 0x00000001u;
         /* 0223D798 */ if (_t384) goto L_0223D79C; else goto L_0223D7D0;
   L_0223D79C: ; // 0x223d79c
         /* 0223D79C */ _t385 = cpu->r[27] + 0x000002C8u;
         /* 0223D79C */ cpu->r[5] = rbrew_read8(cpu->mem, _t385);
         /* 0223D7A0 */ /* nop */
-        /* 0223D7A4 */ _t386 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223D7A4 */ _t386 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223D7A4 */ _t387 = _t386 & 0x00000001u;
         /* 0223D7A4 */ if (_t387) goto L_0223D7A8; else goto L_0223D7D0;
   L_0223D7A8: ; // 0x223d7a8
         /* 0223D7A8 */ _t388 = cpu->r[27] + 0x000002C9u;
         /* 0223D7A8 */ cpu->r[7] = rbrew_read8(cpu->mem, _t388);
         /* 0223D7AC */ /* nop */
-        /* 0223D7B0 */ _t389 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223D7B0 */ _t389 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223D7B0 */ _t390 = _t389 & 0x00000001u;
         /* 0223D7B0 */ if (_t390) goto L_0223D7B4; else goto L_0223D7D0;
   L_0223D7B4: ; // 0x223d7b4
         /* 0223D7B4 */ _t391 = cpu->r[27] + 0x00000051u;
         /* 0223D7B4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t391);
-        /* 0223D7B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223D7BC */ _t392 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223D7B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223D7BC */ _t392 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223D7BC */ _t393 = _t392 & 0x00000001u;
         /* 0223D7BC */ if (_t393) goto L_0223D7D0; else goto L_0223D7C0;
   L_0223D7C0: ; // 0x223d7c0
@@ -16720,7 +16720,7 @@ void Gambit_fn_0223BFE0(CPUState* cpu) {
         /* 0223D824 */ cpu->f[21] = rbrew_read_f64(cpu->mem, _t414);
         /* 0223D828 */ _t415 = cpu->r[1] + 0x00000180u;
         /* 0223D828 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t415);
-        /* 0223D82C */ _t416 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223D82C */ _t416 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223D82C */ _t417 = _t416 & 0x00000001u;
         /* 0223D82C */ if (_t417) goto L_0223D830; // else: addr-0 trap, fall-through
   L_0223D830: ; // 0x223d830
@@ -16822,9 +16822,9 @@ void Gambit_fn_0223D88C(CPUState* cpu) {
         /* 02056770 */ cpu->r[26] = cpu->r[3];
         /* 02056774 */ cpu->r[27] = 0x00000000u;
         /* 02056778 */ cpu->r[31] = 0x101E0000u;
-        /* 0205677C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0205677C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02056780 */ cpu->r[31] = cpu->r[31] + 0xFFFFA398u;
-        /* 02056784 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056784 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056784 */ _t4 = _t3 & 0x00000001u;
         /* 02056784 */ if (_t4) goto L_02056788; else goto L_020567D0;
   L_02056788: ; // 0x2056788
@@ -16850,8 +16850,8 @@ void Gambit_fn_0223D88C(CPUState* cpu) {
   L_020567D0: ; // 0x20567d0
         /* 020567D0 */ _t6 = cpu->r[31] + 0x00000054u;
         /* 020567D0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t6);
-        /* 020567D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 020567D8 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020567D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 020567D8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020567D8 */ _t8 = _t7 & 0x00000001u;
         /* 020567D8 */ if (_t8) goto L_020567DC; else goto L_020568D0;
   L_020567DC: ; // 0x20567dc
@@ -16867,9 +16867,9 @@ void Gambit_fn_0223D88C(CPUState* cpu) {
   L_02056800: ; // 0x2056800
         /* 02056800 */ _t9 = cpu->r[22] + 0xFFFFE534u;
         /* 02056800 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 02056804 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02056804 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02056808 */ cpu->r[30] = cpu->r[29];
-        /* 0205680C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0205680C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0205680C */ _t11 = _t10 & 0x00000001u;
         /* 0205680C */ if (_t11) goto L_02056810; else goto L_02056828;
   L_02056810: ; // 0x2056810
@@ -16883,8 +16883,8 @@ void Gambit_fn_0223D88C(CPUState* cpu) {
   L_02056828: ; // 0x2056828
         /* 02056828 */ _t13 = cpu->r[20] + 0xFFFFE530u;
         /* 02056828 */ cpu->r[0] = rbrew_read32(cpu->mem, _t13);
-        /* 0205682C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02056830 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0205682C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02056830 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056830 */ _t15 = _t14 & 0x00000001u;
         /* 02056830 */ if (_t15) goto L_02056834; else goto L_0205683C;
   L_02056834: ; // 0x2056834
@@ -16893,8 +16893,8 @@ void Gambit_fn_0223D88C(CPUState* cpu) {
         /* 02056838 */ _t17 = cpu->r[20] + 0xFFFFE530u;
         /* 02056838 */ rbrew_write32(cpu->mem, _t17, cpu->r[21]);
   L_0205683C: ; // 0x205683c
-        /* 0205683C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000004u);
-        /* 02056840 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0205683C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000004u));
+        /* 02056840 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02056840 */ _t19 = _t18 & 0x00000001u;
         /* 02056840 */ if (_t19) goto L_02056868; else goto L_02056844;
   L_02056844: ; // 0x2056844
@@ -16903,12 +16903,12 @@ void Gambit_fn_0223D88C(CPUState* cpu) {
         /* 0205684C */ cpu->r[5] = 0x00000000u;
         /* 02056850 */ Gambit_fn_028A6634(cpu);
         /* 02056854 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 02056858 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000004u);
-        /* 0205685C */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02056858 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000004u));
+        /* 0205685C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0205685C */ _t21 = _t20 & 0x00000001u;
         /* 0205685C */ if (_t21) goto L_020568D0; else goto L_02056860;
   L_02056860: ; // 0x2056860
-        /* 02056860 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02056860 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02056860 */ _t23 = _t22 & 0x00000001u;
         /* 02056860 */ if (_t23) goto L_02056800; else goto L_02056864;
   L_02056864: ; // 0x2056864
@@ -16916,8 +16916,8 @@ void Gambit_fn_0223D88C(CPUState* cpu) {
   L_02056868: ; // 0x2056868
         /* 02056868 */ _t24 = cpu->r[19] + 0xFFFFE52Cu;
         /* 02056868 */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
-        /* 0205686C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02056870 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0205686C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02056870 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056870 */ _t26 = _t25 & 0x00000001u;
         /* 02056870 */ if (_t26) goto L_02056874; else goto L_020568AC;
   L_02056874: ; // 0x2056874
@@ -16926,8 +16926,8 @@ void Gambit_fn_0223D88C(CPUState* cpu) {
         /* 0205687C */ Gambit_fn_02836FFC(cpu);
         /* 02056880 */ _t27 = cpu->r[19] + 0xFFFFE52Cu;
         /* 02056880 */ cpu->r[6] = rbrew_read32(cpu->mem, _t27);
-        /* 02056884 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 02056888 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056884 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 02056888 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056888 */ _t29 = _t28 & 0x00000001u;
         /* 02056888 */ if (_t29) goto L_0205688C; else goto L_020568A0;
   L_0205688C: ; // 0x205688c
@@ -16950,12 +16950,12 @@ void Gambit_fn_0223D88C(CPUState* cpu) {
         /* 020568B8 */ cpu->r[4] = cpu->r[29];
         /* 020568BC */ Gambit_fn_028A6634(cpu);
         /* 020568C0 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 020568C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000004u);
-        /* 020568C8 */ _t33 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020568C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000004u));
+        /* 020568C8 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020568C8 */ _t34 = _t33 & 0x00000001u;
         /* 020568C8 */ if (_t34) goto L_020568D0; else goto L_020568CC;
   L_020568CC: ; // 0x20568cc
-        /* 020568CC */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020568CC */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020568CC */ _t36 = _t35 & 0x00000001u;
         /* 020568CC */ if (_t36) goto L_02056800; else goto L_020568D0;
   L_020568D0: ; // 0x20568d0
@@ -16968,9 +16968,9 @@ void Gambit_fn_0223D88C(CPUState* cpu) {
         /* 020568E4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t37);
         /* 020568E4 */ cpu->r[9] = _t37;
         /* 020568E8 */ cpu->r[30] = cpu->r[30] + 0xFFFFA418u;
-        /* 020568EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020568EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020568F0 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 020568F4 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020568F4 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020568F4 */ _t39 = _t38 & 0x00000001u;
         /* 020568F4 */ if (_t39) goto L_0205690C; else goto L_020568F8;
   L_020568F8: ; // 0x20568f8
@@ -17013,23 +17013,23 @@ void Gambit_fn_0223D88C(CPUState* cpu) {
         /* 02056960 */ _t49 = cpu->r[12] + 0x00000000u;
         /* 02056960 */ cpu->r[0] = rbrew_read8(cpu->mem, _t49);
         /* 02056964 */ cpu->r[6] = 0x00080000u;
-        /* 02056968 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 02056968 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 0205696C */ cpu->r[29] = 0x00000000u;
-        /* 02056970 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056970 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02056970 */ _t51 = _t50 & 0x00000001u;
         /* 02056970 */ if (_t51) goto L_02056998; else goto L_02056974;
   L_02056974: ; // 0x2056974
         /* 02056974 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 02056978 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[6]);
+        /* 02056978 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[6]));
         /* 0205697C */ cpu->r[12] = cpu->r[12] + 0x00000001u;
-        /* 02056980 */ _t52 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02056980 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02056980 */ _t53 = _t52 & 0x00000001u;
         /* 02056980 */ if (_t53) goto L_02056994; else goto L_02056984;
   L_02056984: ; // 0x2056984
         /* 02056984 */ _t54 = cpu->r[12] + 0x00000000u;
         /* 02056984 */ cpu->r[0] = rbrew_read8(cpu->mem, _t54);
-        /* 02056988 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 0205698C */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02056988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 0205698C */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0205698C */ _t56 = _t55 & 0x00000001u;
         /* 0205698C */ if (_t56) goto L_02056990; else goto L_02056974;
   L_02056990: ; // 0x2056990
@@ -17039,8 +17039,8 @@ void Gambit_fn_0223D88C(CPUState* cpu) {
   L_02056998: ; // 0x2056998
         /* 02056998 */ _t57 = cpu->r[30] + 0x00000008u;
         /* 02056998 */ cpu->r[11] = rbrew_read32(cpu->mem, _t57);
-        /* 0205699C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[11]);
-        /* 020569A0 */ _t58 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0205699C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[11]));
+        /* 020569A0 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020569A0 */ _t59 = _t58 & 0x00000001u;
         /* 020569A0 */ if (_t59) goto L_020569A8; else goto L_020569A4;
   L_020569A4: ; // 0x20569a4
@@ -17125,8 +17125,8 @@ void Gambit_fn_0223D8A8(CPUState* cpu) {
   L_0223D8A8: ; // 0x223d8a8
         /* 0223D8A8 */ _t0 = cpu->r[3] + 0x000002CBu;
         /* 0223D8A8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t0);
-        /* 0223D8AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223D8B0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223D8AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223D8B0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223D8B0 */ _t2 = _t1 & 0x00000001u;
         /* 0223D8B0 */ if (_t2) goto L_0223D8C0; else goto L_0223D8B4;
   L_0223D8B4: ; // 0x223d8b4
@@ -17174,9 +17174,9 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223D8F8 */ _t4 = cpu->r[30] + 0x000002C8u;
         /* 0223D8F8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t4);
         /* 0223D8FC */ cpu->r[11] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000010u, 0x00000011u);
-        /* 0223D8FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0223D8FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0223D900 */ cpu->r[29] = 0x00000000u;
-        /* 0223D904 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223D904 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223D904 */ _t6 = _t5 & 0x00000001u;
         /* 0223D904 */ if (_t6) goto L_0223D9EC; else goto L_0223D908;
   L_0223D908: ; // 0x223d908
@@ -17193,27 +17193,27 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223D920 */ rbrew_write32(cpu->mem, _t10, cpu->r[12]);
         /* 0223D924 */ _t11 = cpu->r[30] + 0x000002CEu;
         /* 0223D924 */ cpu->r[0] = rbrew_read16(cpu->mem, _t11);
-        /* 0223D928 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223D928 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223D928 */ _t13 = _t12 & 0x00000001u;
         /* 0223D928 */ if (_t13) goto L_0223D92C; else goto L_0223D95C;
   L_0223D92C: ; // 0x223d92c
-        /* 0223D92C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000001Eu);
-        /* 0223D930 */ _t14 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223D92C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000001Eu));
+        /* 0223D930 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223D930 */ _t15 = _t14 & 0x00000001u;
         /* 0223D930 */ if (_t15) goto L_0223D9E0; else goto L_0223D934;
   L_0223D934: ; // 0x223d934
-        /* 0223D934 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000024u);
-        /* 0223D938 */ _t16 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223D934 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000024u));
+        /* 0223D938 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223D938 */ _t17 = _t16 & 0x00000001u;
         /* 0223D938 */ if (_t17) goto L_0223D93C; else goto L_0223D9A8;
   L_0223D93C: ; // 0x223d93c
-        /* 0223D93C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000003Du);
-        /* 0223D940 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223D93C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000003Du));
+        /* 0223D940 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223D940 */ _t19 = _t18 & 0x00000001u;
         /* 0223D940 */ if (_t19) goto L_0223D9A8; else goto L_0223D944;
   L_0223D944: ; // 0x223d944
-        /* 0223D944 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000048u);
-        /* 0223D948 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223D944 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000048u));
+        /* 0223D948 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223D948 */ _t21 = _t20 & 0x00000001u;
         /* 0223D948 */ if (_t21) goto L_0223D97C; else goto L_0223D94C;
   L_0223D94C: ; // 0x223d94c
@@ -17224,23 +17224,23 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223D954 */ rbrew_write32(cpu->mem, _t23, cpu->r[11]);
         /* 0223D958 */ goto L_0223D9EC;
   L_0223D95C: ; // 0x223d95c
-        /* 0223D95C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000001Eu);
-        /* 0223D960 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223D95C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000001Eu));
+        /* 0223D960 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223D960 */ _t25 = _t24 & 0x00000001u;
         /* 0223D960 */ if (_t25) goto L_0223D9E0; else goto L_0223D964;
   L_0223D964: ; // 0x223d964
-        /* 0223D964 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000024u);
-        /* 0223D968 */ _t26 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223D964 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000024u));
+        /* 0223D968 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223D968 */ _t27 = _t26 & 0x00000001u;
         /* 0223D968 */ if (_t27) goto L_0223D96C; else goto L_0223D9A8;
   L_0223D96C: ; // 0x223d96c
-        /* 0223D96C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000003Du);
-        /* 0223D970 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223D96C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000003Du));
+        /* 0223D970 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223D970 */ _t29 = _t28 & 0x00000001u;
         /* 0223D970 */ if (_t29) goto L_0223D9A8; else goto L_0223D974;
   L_0223D974: ; // 0x223d974
-        /* 0223D974 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000048u);
-        /* 0223D978 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223D974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000048u));
+        /* 0223D978 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223D978 */ _t31 = _t30 & 0x00000001u;
         /* 0223D978 */ if (_t31) goto L_0223D97C; else goto L_0223D9E0;
   L_0223D97C: ; // 0x223d97c
@@ -17289,11 +17289,11 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223D9F4 */ /* nop */
         /* 0223D9F8 */ _t41 = cpu->r[8] + 0x00002DF4u;
         /* 0223D9F8 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t41);
-        /* 0223D9FC */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223D9FC */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223D9FC */ _t43 = _t42 & 0x00000001u;
         /* 0223D9FC */ if (_t43) goto L_0223DB48; else goto L_0223DA00;
   L_0223DA00: ; // 0x223da00
-        /* 0223DA00 */ _t44 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223DA00 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223DA00 */ _t45 = _t44 & 0x00000001u;
         /* 0223DA00 */ if (_t45) goto L_0223DB14; else goto L_0223DA04;
   L_0223DA04: ; // 0x223da04
@@ -17319,10 +17319,10 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DA2C */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t54);
         /* 0223DA30 */ cpu->f[13] = cpu->f[12] * cpu->f[12];
         /* 0223DA34 */ cpu->f[9] = fma(cpu->f[10], cpu->f[10], cpu->f[13]);
-        /* 0223DA38 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[31]);
+        /* 0223DA38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[31]));
         /* 0223DA3C */ _t55 = cpu->r[1] + 0x0000000Cu;
         /* 0223DA3C */ rbrew_write_f32(cpu->mem, _t55, cpu->f[31]);
-        /* 0223DA40 */ _t56 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223DA40 */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223DA40 */ _t57 = _t56 & 0x00000001u;
         /* 0223DA40 */ if (_t57) goto L_0223DA44; else goto L_0223DA84;
   L_0223DA44: ; // 0x223da44
@@ -17350,22 +17350,22 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DA80 */ _t64 = cpu->r[1] + 0x00000010u;
         /* 0223DA80 */ rbrew_write_f32(cpu->mem, _t64, cpu->f[12]);
   L_0223DA84: ; // 0x223da84
-        /* 0223DA84 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
+        /* 0223DA84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
         /* 0223DA88 */ cpu->r[4] = 0x101F0000u;
         /* 0223DA8C */ cpu->r[4] = cpu->r[4] + 0x0000635Cu;
-        /* 0223DA90 */ _t65 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223DA90 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223DA90 */ _t66 = _t65 & 0x00000001u;
         /* 0223DA90 */ if (_t66) goto L_0223DA94; else goto L_0223DAC0;
   L_0223DA94: ; // 0x223da94
         /* 0223DA94 */ _t67 = cpu->r[1] + 0x0000000Cu;
         /* 0223DA94 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t67);
-        /* 0223DA98 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[31]);
-        /* 0223DA9C */ _t68 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223DA98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[31]));
+        /* 0223DA9C */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223DA9C */ _t69 = _t68 & 0x00000001u;
         /* 0223DA9C */ if (_t69) goto L_0223DAA0; else goto L_0223DAC0;
   L_0223DAA0: ; // 0x223daa0
-        /* 0223DAA0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[31]);
-        /* 0223DAA4 */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223DAA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[31]));
+        /* 0223DAA4 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223DAA4 */ _t71 = _t70 & 0x00000001u;
         /* 0223DAA4 */ if (_t71) goto L_0223DAA8; else goto L_0223DAC0;
   L_0223DAA8: ; // 0x223daa8
@@ -17385,8 +17385,8 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DAC0 */ cpu->r[5] = cpu->r[1] + 0x00000008u;
         /* 0223DAC4 */ cpu->r[3] = cpu->r[1] + 0x00000034u;
         /* 0223DAC8 */ Gambit_fn_021C6DD8(cpu);
-        /* 0223DACC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223DAD0 */ _t78 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223DACC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223DAD0 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223DAD0 */ _t79 = _t78 & 0x00000001u;
         /* 0223DAD0 */ if (_t79) goto L_0223DAD4; else goto L_0223DAE8;
   L_0223DAD4: ; // 0x223dad4
@@ -17411,7 +17411,7 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DB08 */ rbrew_write_f32(cpu->mem, _t83, cpu->f[11]);
         /* 0223DB0C */ _t84 = cpu->r[30] + 0x00000310u;
         /* 0223DB0C */ rbrew_write_f32(cpu->mem, _t84, cpu->f[11]);
-        /* 0223DB10 */ _t85 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223DB10 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223DB10 */ _t86 = _t85 & 0x00000001u;
         /* 0223DB10 */ if (_t86) goto L_0223DB48; else goto L_0223DB14;
   L_0223DB14: ; // 0x223db14
@@ -17427,7 +17427,7 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DB2C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t89);
         /* 0223DB30 */ _t90 = cpu->r[1] + 0x000000B0u;
         /* 0223DB30 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t90);
-        /* 0223DB34 */ _t91 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223DB34 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223DB34 */ _t92 = _t91 & 0x00000001u;
         /* 0223DB34 */ if (_t92) goto L_0223DB38; // else: addr-0 trap, fall-through
   L_0223DB38: ; // 0x223db38
@@ -17441,8 +17441,8 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DB48 */ cpu->r[0] = rbrew_read8(cpu->mem, _t94);
         /* 0223DB4C */ cpu->r[11] = cpu->r[0] ^ 0x00000001u;
         /* 0223DB50 */ cpu->r[11] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x00000018u, 0x0000001Fu);
-        /* 0223DB50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0223DB54 */ _t95 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223DB50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0223DB54 */ _t95 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223DB54 */ _t96 = _t95 & 0x00000001u;
         /* 0223DB54 */ if (_t96) goto L_0223DB7C; else goto L_0223DB58;
   L_0223DB58: ; // 0x223db58
@@ -17452,12 +17452,12 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DB60 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t97);
         /* 0223DB64 */ _t98 = cpu->r[30] + 0x000000DCu;
         /* 0223DB64 */ rbrew_write_f32(cpu->mem, _t98, cpu->f[1]);
-        /* 0223DB68 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
+        /* 0223DB68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
         /* 0223DB6C */ _t99 = cpu->r[30] + 0x000002A4u;
         /* 0223DB6C */ cpu->r[9] = rbrew_read32(cpu->mem, _t99);
         /* 0223DB70 */ _t100 = cpu->r[30] + 0x000000E0u;
         /* 0223DB70 */ rbrew_write_f32(cpu->mem, _t100, cpu->f[1]);
-        /* 0223DB74 */ _t101 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223DB74 */ _t101 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223DB74 */ _t102 = _t101 & 0x00000001u;
         /* 0223DB74 */ if (_t102) goto L_0223DBA0; else goto L_0223DB78;
   L_0223DB78: ; // 0x223db78
@@ -17469,12 +17469,12 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DB80 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t104);
         /* 0223DB84 */ _t105 = cpu->r[30] + 0x000000DCu;
         /* 0223DB84 */ rbrew_write_f32(cpu->mem, _t105, cpu->f[1]);
-        /* 0223DB88 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
+        /* 0223DB88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
         /* 0223DB8C */ _t106 = cpu->r[30] + 0x000002A4u;
         /* 0223DB8C */ cpu->r[9] = rbrew_read32(cpu->mem, _t106);
         /* 0223DB90 */ _t107 = cpu->r[30] + 0x000000E0u;
         /* 0223DB90 */ rbrew_write_f32(cpu->mem, _t107, cpu->f[1]);
-        /* 0223DB94 */ _t108 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223DB94 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223DB94 */ _t109 = _t108 & 0x00000001u;
         /* 0223DB94 */ if (_t109) goto L_0223DBA0; else goto L_0223DB98;
   L_0223DB98: ; // 0x223db98
@@ -17483,13 +17483,13 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DB9C */ _t111 = cpu->r[30] + 0x000000E4u;
         /* 0223DB9C */ rbrew_write_f32(cpu->mem, _t111, cpu->f[7]);
   L_0223DBA0: ; // 0x223dba0
-        /* 0223DBA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0223DBA4 */ _t112 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223DBA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0223DBA4 */ _t112 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223DBA4 */ _t113 = _t112 & 0x00000001u;
         /* 0223DBA4 */ if (_t113) goto L_0223DBA8; else goto L_0223DC40;
   L_0223DBA8: ; // 0x223dba8
-        /* 0223DBA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0223DBAC */ _t114 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223DBA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0223DBAC */ _t114 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223DBAC */ _t115 = _t114 & 0x00000001u;
         /* 0223DBAC */ if (_t115) goto L_0223DBC0; else goto L_0223DBB0;
   L_0223DBB0: ; // 0x223dbb0
@@ -17502,10 +17502,10 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DBBC */ goto L_0223DC40;
   L_0223DBC0: ; // 0x223dbc0
         /* 0223DBC0 */ cpu->r[9] = cpu->r[9] + 0xFFFFFFFFu;
-        /* 0223DBC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0223DBC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0223DBC4 */ _t119 = cpu->r[30] + 0x000002A4u;
         /* 0223DBC4 */ rbrew_write32(cpu->mem, _t119, cpu->r[9]);
-        /* 0223DBC8 */ _t120 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223DBC8 */ _t120 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223DBC8 */ _t121 = _t120 & 0x00000001u;
         /* 0223DBC8 */ if (_t121) goto L_0223DBCC; else goto L_0223DBD8;
   L_0223DBCC: ; // 0x223dbcc
@@ -17554,8 +17554,8 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DC40 */ _t133 = cpu->r[30] + 0x000002C8u;
         /* 0223DC40 */ cpu->r[6] = rbrew_read32(cpu->mem, _t133);
         /* 0223DC44 */ cpu->r[5] = rbrew_rlwinm(cpu->r[6], 0x00000014u, 0x0000001Eu, 0x0000001Fu);
-        /* 0223DC48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[5], cpu->r[11]);
-        /* 0223DC4C */ _t134 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223DC48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[5], cpu->r[11]));
+        /* 0223DC4C */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223DC4C */ _t135 = _t134 & 0x00000001u;
         /* 0223DC4C */ if (_t135) goto L_0223DDF0; else goto L_0223DC50;
   L_0223DC50: ; // 0x223dc50
@@ -17573,9 +17573,9 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DC68 */ cpu->r[10] = rbrew_read32(cpu->mem, _t140);
         /* 0223DC6C */ cpu->r[9] = cpu->r[8] + 0xFFFFFFFFu;
         /* 0223DC70 */ cpu->r[28] = cpu->r[28] + 0x00004F95u;
-        /* 0223DC74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0223DC74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0223DC78 */ cpu->r[31] = cpu->r[8] - cpu->r[9];
-        /* 0223DC7C */ _t141 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223DC7C */ _t141 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223DC7C */ _t142 = _t141 & 0x00000001u;
         /* 0223DC7C */ if (_t142) goto L_0223DC80; else goto L_0223DCA0;
   L_0223DC80: ; // 0x223dc80
@@ -17594,9 +17594,9 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DCA4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t144);
         /* 0223DCA4 */ cpu->r[8] = _t144;
         /* 0223DCA8 */ cpu->r[27] = 0x101D0000u;
-        /* 0223DCAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0223DCAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0223DCB0 */ cpu->r[27] = cpu->r[27] + 0xFFFFFF9Cu;
-        /* 0223DCB4 */ _t145 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223DCB4 */ _t145 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223DCB4 */ _t146 = _t145 & 0x00000001u;
         /* 0223DCB4 */ if (_t146) goto L_0223DCB8; else goto L_0223DCC4;
   L_0223DCB8: ; // 0x223dcb8
@@ -17606,8 +17606,8 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DCC0 */ _t148 = cpu->r[8] + 0x00000000u;
         /* 0223DCC0 */ rbrew_write32(cpu->mem, _t148, cpu->r[0]);
   L_0223DCC4: ; // 0x223dcc4
-        /* 0223DCC4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], 0x00000003u);
-        /* 0223DCC8 */ _t149 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223DCC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], 0x00000003u));
+        /* 0223DCC8 */ _t149 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223DCC8 */ _t150 = _t149 & 0x00000001u;
         /* 0223DCC8 */ if (_t150) goto L_0223DD00; else goto L_0223DCCC;
   L_0223DCCC: ; // 0x223dccc
@@ -17625,10 +17625,10 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DCEC */ _t154 = cpu->r[30] + 0x000002C8u;
         /* 0223DCEC */ cpu->r[0] = rbrew_read32(cpu->mem, _t154);
         /* 0223DCF0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0223DCF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0223DCF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0223DCF4 */ _t155 = cpu->r[30] + 0x00000128u;
         /* 0223DCF4 */ rbrew_write32(cpu->mem, _t155, cpu->r[31]);
-        /* 0223DCF8 */ _t156 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223DCF8 */ _t156 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223DCF8 */ _t157 = _t156 & 0x00000001u;
         /* 0223DCF8 */ if (_t157) goto L_0223DDD0; else goto L_0223DCFC;
   L_0223DCFC: ; // 0x223dcfc
@@ -17636,8 +17636,8 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
   L_0223DD00: ; // 0x223dd00
         /* 0223DD00 */ _t158 = cpu->r[27] + 0x00000000u;
         /* 0223DD00 */ cpu->r[8] = rbrew_read32(cpu->mem, _t158);
-        /* 0223DD04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 0223DD08 */ _t159 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223DD04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 0223DD08 */ _t159 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223DD08 */ _t160 = _t159 & 0x00000001u;
         /* 0223DD08 */ if (_t160) goto L_0223DD0C; else goto L_0223DD4C;
   L_0223DD0C: ; // 0x223dd0c
@@ -17646,8 +17646,8 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DD14 */ Gambit_fn_02836FFC(cpu);
         /* 0223DD18 */ _t161 = cpu->r[27] + 0x00000000u;
         /* 0223DD18 */ cpu->r[6] = rbrew_read32(cpu->mem, _t161);
-        /* 0223DD1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0223DD20 */ _t162 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223DD1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0223DD20 */ _t162 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223DD20 */ _t163 = _t162 & 0x00000001u;
         /* 0223DD20 */ if (_t163) goto L_0223DD24; else goto L_0223DD40;
   L_0223DD24: ; // 0x223dd24
@@ -17681,10 +17681,10 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DD70 */ _t170 = cpu->r[30] + 0x000002C8u;
         /* 0223DD70 */ cpu->r[0] = rbrew_read32(cpu->mem, _t170);
         /* 0223DD74 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0223DD74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0223DD74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0223DD78 */ _t171 = cpu->r[30] + 0x00000128u;
         /* 0223DD78 */ rbrew_write32(cpu->mem, _t171, cpu->r[31]);
-        /* 0223DD7C */ _t172 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223DD7C */ _t172 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223DD7C */ _t173 = _t172 & 0x00000001u;
         /* 0223DD7C */ if (_t173) goto L_0223DDD0; else goto L_0223DD80;
   L_0223DD80: ; // 0x223dd80
@@ -17703,8 +17703,8 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DDA0 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0223DDA4 */ _t178 = cpu->r[3] + 0x00000004u;
         /* 0223DDA4 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t178);
-        /* 0223DDA8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[31]);
-        /* 0223DDAC */ _t179 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223DDA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[31]));
+        /* 0223DDAC */ _t179 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223DDAC */ _t180 = _t179 & 0x00000001u;
         /* 0223DDAC */ if (_t180) goto L_0223DDF0; else goto L_0223DDB0;
   L_0223DDB0: ; // 0x223ddb0
@@ -17717,8 +17717,8 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DDC0 */ _t183 = cpu->r[30] + 0x000002C8u;
         /* 0223DDC0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t183);
         /* 0223DDC4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0223DDC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223DDC8 */ _t184 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223DDC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223DDC8 */ _t184 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223DDC8 */ _t185 = _t184 & 0x00000001u;
         /* 0223DDC8 */ if (_t185) goto L_0223DE04; else goto L_0223DDCC;
   L_0223DDCC: ; // 0x223ddcc
@@ -17728,13 +17728,13 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DDD0 */ cpu->r[11] = rbrew_read8(cpu->mem, _t186);
         /* 0223DDD4 */ _t187 = cpu->r[30] + 0x000002C4u;
         /* 0223DDD4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t187);
-        /* 0223DDD8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[0]);
-        /* 0223DDDC */ _t188 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223DDD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[0]));
+        /* 0223DDDC */ _t188 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223DDDC */ _t189 = _t188 & 0x00000001u;
         /* 0223DDDC */ if (_t189) goto L_0223DDE0; else goto L_0223DDF0;
   L_0223DDE0: ; // 0x223dde0
-        /* 0223DDE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x000000FEu);
-        /* 0223DDE4 */ _t190 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223DDE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x000000FEu));
+        /* 0223DDE4 */ _t190 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223DDE4 */ _t191 = _t190 & 0x00000001u;
         /* 0223DDE4 */ if (_t191) goto L_0223DDF0; else goto L_0223DDE8;
   L_0223DDE8: ; // 0x223dde8
@@ -17746,15 +17746,15 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DDF8 */ _t192 = cpu->r[30] + 0x000002C8u;
         /* 0223DDF8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t192);
         /* 0223DDFC */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0223DDFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223DE00 */ _t193 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223DDFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223DE00 */ _t193 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223DE00 */ _t194 = _t193 & 0x00000001u;
         /* 0223DE00 */ if (_t194) goto L_0223DE04; else goto L_0223DE7C;
   L_0223DE04: ; // 0x223de04
         /* 0223DE04 */ _t195 = cpu->r[30] + 0x000002B8u;
         /* 0223DE04 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t195);
-        /* 0223DE08 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[31]);
-        /* 0223DE0C */ _t196 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223DE08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[31]));
+        /* 0223DE0C */ _t196 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223DE0C */ _t197 = _t196 & 0x00000001u;
         /* 0223DE0C */ if (_t197) goto L_0223DE7C; else goto L_0223DE10;
   L_0223DE10: ; // 0x223de10
@@ -17767,8 +17767,8 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DE28 */ _t198 = cpu->r[30] + 0x000002D0u;
         /* 0223DE28 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t198);
         /* 0223DE2C */ cpu->f[12] = cpu->f[8] - cpu->f[7];
-        /* 0223DE30 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[31]);
-        /* 0223DE34 */ _t199 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223DE30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[31]));
+        /* 0223DE34 */ _t199 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223DE34 */ _t200 = _t199 & 0x00000001u;
         /* 0223DE34 */ if (_t200) goto L_0223DE38; else goto L_0223DE3C;
   L_0223DE38: ; // 0x223de38
@@ -17779,10 +17779,10 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DE40 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t201);
         /* 0223DE44 */ _t202 = cpu->r[5] + 0x00002EC8u;
         /* 0223DE44 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t202);
-        /* 0223DE48 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
+        /* 0223DE48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
         /* 0223DE4C */ _t203 = cpu->r[30] + 0x000002D0u;
         /* 0223DE4C */ rbrew_write_f32(cpu->mem, _t203, cpu->f[12]);
-        /* 0223DE50 */ _t204 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223DE50 */ _t204 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223DE50 */ _t205 = _t204 & 0x00000001u;
         /* 0223DE50 */ if (_t205) goto L_0223DE60; else goto L_0223DE54;
   L_0223DE54: ; // 0x223de54
@@ -17797,7 +17797,7 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DE68 */ /* nop */
         /* 0223DE6C */ _t208 = cpu->r[30] + 0x000002CCu;
         /* 0223DE6C */ rbrew_write16(cpu->mem, _t208, (uint16_t)cpu->r[12]);
-        /* 0223DE70 */ _t209 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223DE70 */ _t209 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223DE70 */ _t210 = _t209 & 0x00000001u;
         /* 0223DE70 */ if (_t210) goto L_0223DE7C; else goto L_0223DE74;
   L_0223DE74: ; // 0x223de74
@@ -17811,7 +17811,7 @@ void Gambit_fn_0223D8D8(CPUState* cpu) {
         /* 0223DE88 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t211);
         /* 0223DE8C */ _t212 = cpu->r[1] + 0x000000B0u;
         /* 0223DE8C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t212);
-        /* 0223DE90 */ _t213 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223DE90 */ _t213 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223DE90 */ _t214 = _t213 & 0x00000001u;
         /* 0223DE90 */ if (_t214) goto L_0223DE94; // else: addr-0 trap, fall-through
   L_0223DE94: ; // 0x223de94
@@ -17843,9 +17843,9 @@ void Gambit_fn_0223DEA4(CPUState* cpu) {
         /* 0223DEC4 */ _t4 = cpu->r[29] + 0x000002C8u;
         /* 0223DEC4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
         /* 0223DEC8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0223DEC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0223DEC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0223DECC */ cpu->f[31] = cpu->f[1];
-        /* 0223DED0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223DED0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223DED0 */ _t6 = _t5 & 0x00000001u;
         /* 0223DED0 */ if (_t6) goto L_0223DF00; else goto L_0223DED4;
   L_0223DED4: ; // 0x223ded4
@@ -17858,7 +17858,7 @@ void Gambit_fn_0223DEA4(CPUState* cpu) {
         /* 0223DEE4 */ _t9 = cpu->r[1] + 0x00000050u;
         /* 0223DEE4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t9);
         /* 0223DEE8 */ cpu->r[3] = 0x00000001u;
-        /* 0223DEEC */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223DEEC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223DEEC */ _t11 = _t10 & 0x00000001u;
         /* 0223DEEC */ if (_t11) goto L_0223DEF0; // else: addr-0 trap, fall-through
   L_0223DEF0: ; // 0x223def0
@@ -17871,7 +17871,7 @@ void Gambit_fn_0223DEA4(CPUState* cpu) {
         /* 0223DF00 */ _t13 = cpu->r[29] + 0x000002C6u;
         /* 0223DF00 */ cpu->r[5] = rbrew_read8(cpu->mem, _t13);
         /* 0223DF04 */ /* nop */
-        /* 0223DF08 */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223DF08 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223DF08 */ _t15 = _t14 & 0x00000001u;
         /* 0223DF08 */ if (_t15) goto L_0223DF0C; else goto L_0223DF38;
   L_0223DF0C: ; // 0x223df0c
@@ -17884,7 +17884,7 @@ void Gambit_fn_0223DEA4(CPUState* cpu) {
         /* 0223DF1C */ _t18 = cpu->r[1] + 0x00000050u;
         /* 0223DF1C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t18);
         /* 0223DF20 */ cpu->r[3] = 0x00000001u;
-        /* 0223DF24 */ _t19 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223DF24 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223DF24 */ _t20 = _t19 & 0x00000001u;
         /* 0223DF24 */ if (_t20) goto L_0223DF28; // else: addr-0 trap, fall-through
   L_0223DF28: ; // 0x223df28
@@ -17902,9 +17902,9 @@ void Gambit_fn_0223DEA4(CPUState* cpu) {
         /* 0223DF40 */ cpu->r[12] = rbrew_read32(cpu->mem, _t23);
         /* 0223DF44 */ _t24 = cpu->r[11] + 0x00000078u;
         /* 0223DF44 */ cpu->r[4] = rbrew_read32(cpu->mem, _t24);
-        /* 0223DF48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[4]);
+        /* 0223DF48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[4]));
         /* 0223DF4C */ cpu->r[3] = 0x00000000u;
-        /* 0223DF50 */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223DF50 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223DF50 */ _t26 = _t25 & 0x00000001u;
         /* 0223DF50 */ if (_t26) goto L_0223DF54; else goto L_0223DF60;
   L_0223DF54: ; // 0x223df54
@@ -17915,8 +17915,8 @@ void Gambit_fn_0223DEA4(CPUState* cpu) {
         /* 0223DF5C */ cpu->r[3] = rbrew_read32(cpu->mem, _t28);
   L_0223DF60: ; // 0x223df60
         /* 0223DF60 */ Gambit_fn_025E068C(cpu);
-        /* 0223DF64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223DF68 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223DF64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223DF68 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223DF68 */ _t30 = _t29 & 0x00000001u;
         /* 0223DF68 */ if (_t30) goto L_0223DF6C; else goto L_0223DF90;
   L_0223DF6C: ; // 0x223df6c
@@ -17926,7 +17926,7 @@ void Gambit_fn_0223DEA4(CPUState* cpu) {
         /* 0223DF74 */ _t32 = cpu->r[1] + 0x00000050u;
         /* 0223DF74 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t32);
         /* 0223DF78 */ cpu->r[3] = 0x00000000u;
-        /* 0223DF7C */ _t33 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223DF7C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223DF7C */ _t34 = _t33 & 0x00000001u;
         /* 0223DF7C */ if (_t34) goto L_0223DF80; // else: addr-0 trap, fall-through
   L_0223DF80: ; // 0x223df80
@@ -17939,8 +17939,8 @@ void Gambit_fn_0223DEA4(CPUState* cpu) {
         /* 0223DF90 */ _t36 = cpu->r[29] + 0x00000140u;
         /* 0223DF90 */ cpu->r[7] = rbrew_read32(cpu->mem, _t36);
         /* 0223DF94 */ cpu->r[22] = 0x00000000u;
-        /* 0223DF98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], cpu->r[7]);
-        /* 0223DF9C */ _t37 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223DF98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], cpu->r[7]));
+        /* 0223DF9C */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223DF9C */ _t38 = _t37 & 0x00000001u;
         /* 0223DF9C */ if (_t38) goto L_0223DFA0; else goto L_0223E074;
   L_0223DFA0: ; // 0x223dfa0
@@ -17980,8 +17980,8 @@ void Gambit_fn_0223DEA4(CPUState* cpu) {
   L_0223E00C: ; // 0x223e00c
         /* 0223E00C */ /* nop */
         /* 0223E010 */ cpu->r[0] = cpu->r[28] & cpu->r[0];
-        /* 0223E010 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223E014 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E010 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223E014 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E014 */ _t45 = _t44 & 0x00000001u;
         /* 0223E014 */ if (_t45) goto L_0223E054; else goto L_0223E018;
   L_0223E018: ; // 0x223e018
@@ -18008,18 +18008,18 @@ void Gambit_fn_0223DEA4(CPUState* cpu) {
         /* 0223E050 */ Gambit_fn_0222D5F8(cpu);
   L_0223E054: ; // 0x223e054
         /* 0223E054 */ cpu->r[18] = cpu->r[18] + 0xFFFFFFFFu;
-        /* 0223E054 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[18], 0x00000000u);
+        /* 0223E054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[18], 0x00000000u));
         /* 0223E058 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0223E05C */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E05C */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E05C */ _t53 = _t52 & 0x00000001u;
         /* 0223E05C */ if (_t53) goto L_0223E060; else goto L_0223E00C;
   L_0223E060: ; // 0x223e060
         /* 0223E060 */ _t54 = cpu->r[29] + 0x00000140u;
         /* 0223E060 */ cpu->r[9] = rbrew_read32(cpu->mem, _t54);
         /* 0223E064 */ cpu->r[22] = cpu->r[22] + 0x00000001u;
-        /* 0223E068 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[22], cpu->r[9]);
+        /* 0223E068 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[22], cpu->r[9]));
         /* 0223E06C */ cpu->r[31] = cpu->r[31] + 0x0000000Cu;
-        /* 0223E070 */ _t55 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223E070 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223E070 */ _t56 = _t55 & 0x00000001u;
         /* 0223E070 */ if (_t56) goto L_0223DFBC; else goto L_0223E074;
   L_0223E074: ; // 0x223e074
@@ -18027,9 +18027,9 @@ void Gambit_fn_0223DEA4(CPUState* cpu) {
         /* 0223E074 */ cpu->r[10] = rbrew_read32(cpu->mem, _t57);
         /* 0223E078 */ _t58 = cpu->r[10] + 0x00000044u;
         /* 0223E078 */ cpu->r[11] = rbrew_read8(cpu->mem, _t58);
-        /* 0223E07C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0223E07C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0223E080 */ cpu->r[5] = 0x00000004u;
-        /* 0223E084 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E084 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E084 */ _t60 = _t59 & 0x00000001u;
         /* 0223E084 */ if (_t60) goto L_0223E08C; else goto L_0223E088;
   L_0223E088: ; // 0x223e088
@@ -18044,7 +18044,7 @@ void Gambit_fn_0223DEA4(CPUState* cpu) {
         /* 0223E09C */ _t63 = cpu->r[1] + 0x00000050u;
         /* 0223E09C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t63);
         /* 0223E0A0 */ cpu->r[3] = 0x00000001u;
-        /* 0223E0A4 */ _t64 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223E0A4 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223E0A4 */ _t65 = _t64 & 0x00000001u;
         /* 0223E0A4 */ if (_t65) goto L_0223E0A8; // else: addr-0 trap, fall-through
   L_0223E0A8: ; // 0x223e0a8
@@ -18081,11 +18081,11 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E0E4 */ _t6 = cpu->r[30] + 0x000002C7u;
         /* 0223E0E4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t6);
         /* 0223E0E8 */ /* nop */
-        /* 0223E0EC */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223E0EC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223E0EC */ _t8 = _t7 & 0x00000001u;
         /* 0223E0EC */ if (_t8) goto L_0223E134; else goto L_0223E0F0;
   L_0223E0F0: ; // 0x223e0f0
-        /* 0223E0F0 */ _t9 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223E0F0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223E0F0 */ _t10 = _t9 & 0x00000001u;
         /* 0223E0F0 */ if (_t10) goto L_0223E1D4; else goto L_0223E0F4;
   L_0223E0F4: ; // 0x223e0f4
@@ -18105,7 +18105,7 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E118 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t14);
         /* 0223E11C */ _t15 = cpu->r[1] + 0x00000070u;
         /* 0223E11C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t15);
-        /* 0223E120 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223E120 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223E120 */ _t17 = _t16 & 0x00000001u;
         /* 0223E120 */ if (_t17) goto L_0223E124; // else: addr-0 trap, fall-through
   L_0223E124: ; // 0x223e124
@@ -18118,11 +18118,11 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E134 */ _t19 = cpu->r[30] + 0x000002C8u;
         /* 0223E134 */ cpu->r[6] = rbrew_read8(cpu->mem, _t19);
         /* 0223E138 */ /* nop */
-        /* 0223E13C */ _t20 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223E13C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223E13C */ _t21 = _t20 & 0x00000001u;
         /* 0223E13C */ if (_t21) goto L_0223E184; else goto L_0223E140;
   L_0223E140: ; // 0x223e140
-        /* 0223E140 */ _t22 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223E140 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223E140 */ _t23 = _t22 & 0x00000001u;
         /* 0223E140 */ if (_t23) goto L_0223E1D4; else goto L_0223E144;
   L_0223E144: ; // 0x223e144
@@ -18142,7 +18142,7 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E168 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t27);
         /* 0223E16C */ _t28 = cpu->r[1] + 0x00000070u;
         /* 0223E16C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t28);
-        /* 0223E170 */ _t29 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223E170 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223E170 */ _t30 = _t29 & 0x00000001u;
         /* 0223E170 */ if (_t30) goto L_0223E174; // else: addr-0 trap, fall-through
   L_0223E174: ; // 0x223e174
@@ -18155,11 +18155,11 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E184 */ _t32 = cpu->r[30] + 0x000002C9u;
         /* 0223E184 */ cpu->r[0] = rbrew_read8(cpu->mem, _t32);
         /* 0223E188 */ /* nop */
-        /* 0223E18C */ _t33 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223E18C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223E18C */ _t34 = _t33 & 0x00000001u;
         /* 0223E18C */ if (_t34) goto L_0223E20C; else goto L_0223E190;
   L_0223E190: ; // 0x223e190
-        /* 0223E190 */ _t35 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223E190 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223E190 */ _t36 = _t35 & 0x00000001u;
         /* 0223E190 */ if (_t36) goto L_0223E1D4; else goto L_0223E194;
   L_0223E194: ; // 0x223e194
@@ -18179,7 +18179,7 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E1B8 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t40);
         /* 0223E1BC */ _t41 = cpu->r[1] + 0x00000070u;
         /* 0223E1BC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t41);
-        /* 0223E1C0 */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223E1C0 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223E1C0 */ _t43 = _t42 & 0x00000001u;
         /* 0223E1C0 */ if (_t43) goto L_0223E1C4; // else: addr-0 trap, fall-through
   L_0223E1C4: ; // 0x223e1c4
@@ -18202,7 +18202,7 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E1F0 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t47);
         /* 0223E1F4 */ _t48 = cpu->r[1] + 0x00000070u;
         /* 0223E1F4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t48);
-        /* 0223E1F8 */ _t49 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223E1F8 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223E1F8 */ _t50 = _t49 & 0x00000001u;
         /* 0223E1F8 */ if (_t50) goto L_0223E1FC; // else: addr-0 trap, fall-through
   L_0223E1FC: ; // 0x223e1fc
@@ -18216,13 +18216,13 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E210 */ Gambit_fn_0222C57C(cpu);
         /* 0223E214 */ _t52 = cpu->r[30] + 0x0000001Cu;
         /* 0223E214 */ cpu->r[6] = rbrew_read32(cpu->mem, _t52);
-        /* 0223E218 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000002u);
-        /* 0223E21C */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E218 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000002u));
+        /* 0223E21C */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E21C */ _t54 = _t53 & 0x00000001u;
         /* 0223E21C */ if (_t54) goto L_0223E258; else goto L_0223E220;
   L_0223E220: ; // 0x223e220
-        /* 0223E220 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000003u);
-        /* 0223E224 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E220 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000003u));
+        /* 0223E224 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E224 */ _t56 = _t55 & 0x00000001u;
         /* 0223E224 */ if (_t56) goto L_0223E258; else goto L_0223E228;
   L_0223E228: ; // 0x223e228
@@ -18237,7 +18237,7 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E23C */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t59);
         /* 0223E240 */ _t60 = cpu->r[1] + 0x00000070u;
         /* 0223E240 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t60);
-        /* 0223E244 */ _t61 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223E244 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223E244 */ _t62 = _t61 & 0x00000001u;
         /* 0223E244 */ if (_t62) goto L_0223E248; // else: addr-0 trap, fall-through
   L_0223E248: ; // 0x223e248
@@ -18254,16 +18254,16 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E260 */ cpu->ctr = cpu->r[7];
         /* 0223E264 */ cpu->r[3] = cpu->r[30];
         /* 0223E268 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0223E26C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223E270 */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E26C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223E270 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E270 */ _t67 = _t66 & 0x00000001u;
         /* 0223E270 */ if (_t67) goto L_0223E33C; else goto L_0223E274;
   L_0223E274: ; // 0x223e274
         /* 0223E274 */ _t68 = cpu->r[30] + 0x000002C8u;
         /* 0223E274 */ cpu->r[8] = rbrew_read32(cpu->mem, _t68);
         /* 0223E278 */ cpu->r[0] = rbrew_rlwinm(cpu->r[8], 0x00000014u, 0x0000001Eu, 0x0000001Fu);
-        /* 0223E278 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223E27C */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E278 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223E27C */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E27C */ _t70 = _t69 & 0x00000001u;
         /* 0223E27C */ if (_t70) goto L_0223E280; else goto L_0223E3F4;
   L_0223E280: ; // 0x223e280
@@ -18435,10 +18435,10 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E3F4 */ _t129 = cpu->r[30] + 0x0000013Cu;
         /* 0223E3F4 */ cpu->r[4] = rbrew_read8(cpu->mem, _t129);
         /* 0223E3F8 */ cpu->r[9] = 0x10050000u;
-        /* 0223E3FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[4]);
+        /* 0223E3FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[4]));
         /* 0223E400 */ _t130 = cpu->r[9] + 0x00002DF4u;
         /* 0223E400 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t130);
-        /* 0223E404 */ _t131 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E404 */ _t131 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E404 */ _t132 = _t131 & 0x00000001u;
         /* 0223E404 */ if (_t132) goto L_0223E408; else goto L_0223E684;
   L_0223E408: ; // 0x223e408
@@ -18454,9 +18454,9 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E41C */ _t137 = cpu->r[12] + 0xFFFFE5F8u;
         /* 0223E41C */ cpu->r[12] = rbrew_read32(cpu->mem, _t137);
         /* 0223E420 */ cpu->r[28] = 0x101D0000u;
-        /* 0223E424 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0223E424 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0223E428 */ cpu->r[31] = rbrew_rlwinm(cpu->r[7], 0x00000014u, 0x0000001Eu, 0x0000001Fu);
-        /* 0223E42C */ _t138 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E42C */ _t138 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E42C */ _t139 = _t138 & 0x00000001u;
         /* 0223E42C */ if (_t139) goto L_0223E430; else goto L_0223E450;
   L_0223E430: ; // 0x223e430
@@ -18475,9 +18475,9 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E454 */ cpu->r[0] = rbrew_read32(cpu->mem, _t141);
         /* 0223E454 */ cpu->r[12] = _t141;
         /* 0223E458 */ cpu->r[26] = 0x101D0000u;
-        /* 0223E45C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0223E45C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0223E460 */ cpu->r[29] = 0x00000000u;
-        /* 0223E464 */ _t142 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E464 */ _t142 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E464 */ _t143 = _t142 & 0x00000001u;
         /* 0223E464 */ if (_t143) goto L_0223E468; else goto L_0223E474;
   L_0223E468: ; // 0x223e468
@@ -18487,8 +18487,8 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E470 */ _t145 = cpu->r[12] + 0x00000000u;
         /* 0223E470 */ rbrew_write32(cpu->mem, _t145, cpu->r[0]);
   L_0223E474: ; // 0x223e474
-        /* 0223E474 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], 0x00000003u);
-        /* 0223E478 */ _t146 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223E474 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], 0x00000003u));
+        /* 0223E478 */ _t146 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223E478 */ _t147 = _t146 & 0x00000001u;
         /* 0223E478 */ if (_t147) goto L_0223E4B0; else goto L_0223E47C;
   L_0223E47C: ; // 0x223e47c
@@ -18506,10 +18506,10 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E49C */ _t151 = cpu->r[30] + 0x000002C8u;
         /* 0223E49C */ cpu->r[10] = rbrew_read32(cpu->mem, _t151);
         /* 0223E4A0 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0223E4A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0223E4A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0223E4A4 */ _t152 = cpu->r[30] + 0x00000128u;
         /* 0223E4A4 */ rbrew_write32(cpu->mem, _t152, cpu->r[31]);
-        /* 0223E4A8 */ _t153 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E4A8 */ _t153 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E4A8 */ _t154 = _t153 & 0x00000001u;
         /* 0223E4A8 */ if (_t154) goto L_0223E664; else goto L_0223E4AC;
   L_0223E4AC: ; // 0x223e4ac
@@ -18517,8 +18517,8 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
   L_0223E4B0: ; // 0x223e4b0
         /* 0223E4B0 */ _t155 = cpu->r[26] + 0xFFFFFF9Cu;
         /* 0223E4B0 */ cpu->r[5] = rbrew_read32(cpu->mem, _t155);
-        /* 0223E4B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 0223E4B8 */ _t156 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E4B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 0223E4B8 */ _t156 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E4B8 */ _t157 = _t156 & 0x00000001u;
         /* 0223E4B8 */ if (_t157) goto L_0223E4BC; else goto L_0223E4FC;
   L_0223E4BC: ; // 0x223e4bc
@@ -18527,8 +18527,8 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E4C4 */ Gambit_fn_02836FFC(cpu);
         /* 0223E4C8 */ _t158 = cpu->r[26] + 0xFFFFFF9Cu;
         /* 0223E4C8 */ cpu->r[4] = rbrew_read32(cpu->mem, _t158);
-        /* 0223E4CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0223E4D0 */ _t159 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E4CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0223E4D0 */ _t159 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E4D0 */ _t160 = _t159 & 0x00000001u;
         /* 0223E4D0 */ if (_t160) goto L_0223E4D4; else goto L_0223E4F0;
   L_0223E4D4: ; // 0x223e4d4
@@ -18562,10 +18562,10 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E520 */ _t167 = cpu->r[30] + 0x000002C8u;
         /* 0223E520 */ cpu->r[10] = rbrew_read32(cpu->mem, _t167);
         /* 0223E524 */ cpu->r[10] = rbrew_rlwinm(cpu->r[10], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0223E524 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0223E524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0223E528 */ _t168 = cpu->r[30] + 0x00000128u;
         /* 0223E528 */ rbrew_write32(cpu->mem, _t168, cpu->r[31]);
-        /* 0223E52C */ _t169 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E52C */ _t169 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E52C */ _t170 = _t169 & 0x00000001u;
         /* 0223E52C */ if (_t170) goto L_0223E664; else goto L_0223E530;
   L_0223E530: ; // 0x223e530
@@ -18575,10 +18575,10 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E538 */ cpu->r[0] = rbrew_read8(cpu->mem, _t171);
         /* 0223E53C */ _t172 = cpu->r[30] + 0x000002D0u;
         /* 0223E53C */ rbrew_write_f32(cpu->mem, _t172, cpu->f[1]);
-        /* 0223E540 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x000000FFu);
+        /* 0223E540 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x000000FFu));
         /* 0223E544 */ _t173 = cpu->r[30] + 0x000000E4u;
         /* 0223E544 */ rbrew_write_f32(cpu->mem, _t173, cpu->f[1]);
-        /* 0223E548 */ _t174 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E548 */ _t174 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E548 */ _t175 = _t174 & 0x00000001u;
         /* 0223E548 */ if (_t175) goto L_0223E624; else goto L_0223E54C;
   L_0223E54C: ; // 0x223e54c
@@ -18601,10 +18601,10 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E570 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t182);
         /* 0223E574 */ _t183 = cpu->r[3] + 0x00000008u;
         /* 0223E574 */ cpu->r[8] = rbrew_read32(cpu->mem, _t183);
-        /* 0223E578 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
+        /* 0223E578 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
         /* 0223E57C */ _t184 = cpu->r[1] + 0x00000030u;
         /* 0223E57C */ rbrew_write32(cpu->mem, _t184, cpu->r[8]);
-        /* 0223E580 */ _t185 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223E580 */ _t185 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223E580 */ _t186 = _t185 & 0x00000001u;
         /* 0223E580 */ if (_t186) goto L_0223E624; else goto L_0223E584;
   L_0223E584: ; // 0x223e584
@@ -18631,10 +18631,10 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E5B0 */ cpu->r[5] = cpu->r[3] + cpu->r[11];
         /* 0223E5B4 */ _t196 = cpu->r[5] + 0x00000104u;
         /* 0223E5B4 */ cpu->r[4] = rbrew_read8(cpu->mem, _t196);
-        /* 0223E5B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 0223E5B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 0223E5BC */ _t197 = cpu->r[30] + 0x00000051u;
         /* 0223E5BC */ cpu->r[31] = rbrew_read8(cpu->mem, _t197);
-        /* 0223E5C0 */ _t198 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E5C0 */ _t198 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E5C0 */ _t199 = _t198 & 0x00000001u;
         /* 0223E5C0 */ if (_t199) goto L_0223E624; else goto L_0223E5C4;
   L_0223E5C4: ; // 0x223e5c4
@@ -18642,8 +18642,8 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E5C8 */ cpu->r[6] = cpu->r[1] + 0x00000034u;
         /* 0223E5CC */ cpu->r[5] = cpu->r[31];
         /* 0223E5D0 */ Gambit_fn_021F000C(cpu);
-        /* 0223E5D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223E5D8 */ _t200 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E5D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223E5D8 */ _t200 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E5D8 */ _t201 = _t200 & 0x00000001u;
         /* 0223E5D8 */ if (_t201) goto L_0223E624; else goto L_0223E5DC;
   L_0223E5DC: ; // 0x223e5dc
@@ -18686,8 +18686,8 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E634 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0223E638 */ _t215 = cpu->r[3] + 0x00000004u;
         /* 0223E638 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t215);
-        /* 0223E63C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[31]);
-        /* 0223E640 */ _t216 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223E63C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[31]));
+        /* 0223E640 */ _t216 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223E640 */ _t217 = _t216 & 0x00000001u;
         /* 0223E640 */ if (_t217) goto L_0223E684; else goto L_0223E644;
   L_0223E644: ; // 0x223e644
@@ -18699,8 +18699,8 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E650 */ Gambit_fn_0223BD7C(cpu);
         /* 0223E654 */ _t220 = cpu->r[30] + 0x00000051u;
         /* 0223E654 */ cpu->r[6] = rbrew_read8(cpu->mem, _t220);
-        /* 0223E658 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0223E65C */ _t221 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E658 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0223E65C */ _t221 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E65C */ _t222 = _t221 & 0x00000001u;
         /* 0223E65C */ if (_t222) goto L_0223E6B8; else goto L_0223E660;
   L_0223E660: ; // 0x223e660
@@ -18710,13 +18710,13 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E664 */ cpu->r[11] = rbrew_read8(cpu->mem, _t223);
         /* 0223E668 */ _t224 = cpu->r[30] + 0x000002C4u;
         /* 0223E668 */ cpu->r[4] = rbrew_read8(cpu->mem, _t224);
-        /* 0223E66C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[4]);
-        /* 0223E670 */ _t225 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E66C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[4]));
+        /* 0223E670 */ _t225 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E670 */ _t226 = _t225 & 0x00000001u;
         /* 0223E670 */ if (_t226) goto L_0223E674; else goto L_0223E684;
   L_0223E674: ; // 0x223e674
-        /* 0223E674 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x000000FEu);
-        /* 0223E678 */ _t227 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E674 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x000000FEu));
+        /* 0223E678 */ _t227 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E678 */ _t228 = _t227 & 0x00000001u;
         /* 0223E678 */ if (_t228) goto L_0223E684; else goto L_0223E67C;
   L_0223E67C: ; // 0x223e67c
@@ -18727,8 +18727,8 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E688 */ Gambit_fn_0223BD7C(cpu);
         /* 0223E68C */ _t229 = cpu->r[30] + 0x00000051u;
         /* 0223E68C */ cpu->r[6] = rbrew_read8(cpu->mem, _t229);
-        /* 0223E690 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0223E694 */ _t230 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E690 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0223E694 */ _t230 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E694 */ _t231 = _t230 & 0x00000001u;
         /* 0223E694 */ if (_t231) goto L_0223E6B8; else goto L_0223E698;
   L_0223E698: ; // 0x223e698
@@ -18738,8 +18738,8 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E6A0 */ Gambit_fn_0223DEA4(cpu);
         /* 0223E6A4 */ cpu->r[0] = cpu->r[3] ^ 0x00000001u;
         /* 0223E6A8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000018u, 0x0000001Fu);
-        /* 0223E6A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223E6AC */ _t233 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E6A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223E6AC */ _t233 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E6AC */ _t234 = _t233 & 0x00000001u;
         /* 0223E6AC */ if (_t234) goto L_0223E6B8; else goto L_0223E6B0;
   L_0223E6B0: ; // 0x223e6b0
@@ -18749,15 +18749,15 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E6B8 */ _t235 = cpu->r[30] + 0x000002C8u;
         /* 0223E6B8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t235);
         /* 0223E6BC */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0223E6BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223E6C0 */ _t236 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E6BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223E6C0 */ _t236 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E6C0 */ _t237 = _t236 & 0x00000001u;
         /* 0223E6C0 */ if (_t237) goto L_0223E6C4; else goto L_0223E708;
   L_0223E6C4: ; // 0x223e6c4
         /* 0223E6C4 */ _t238 = cpu->r[30] + 0x000002B8u;
         /* 0223E6C4 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t238);
-        /* 0223E6C8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
-        /* 0223E6CC */ _t239 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223E6C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
+        /* 0223E6CC */ _t239 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223E6CC */ _t240 = _t239 & 0x00000001u;
         /* 0223E6CC */ if (_t240) goto L_0223E6D0; else goto L_0223E714;
   L_0223E6D0: ; // 0x223e6d0
@@ -18774,10 +18774,10 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E6E8 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t244);
         /* 0223E6EC */ cpu->f[10] = cpu->f[11] - cpu->f[12];
         /* 0223E6F0 */ cpu->f[30] = cpu->f[30] - cpu->f[10];
-        /* 0223E6F4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[31]);
+        /* 0223E6F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[31]));
         /* 0223E6F8 */ _t245 = cpu->r[30] + 0x000002B8u;
         /* 0223E6F8 */ rbrew_write_f32(cpu->mem, _t245, cpu->f[30]);
-        /* 0223E6FC */ _t246 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223E6FC */ _t246 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223E6FC */ _t247 = _t246 & 0x00000001u;
         /* 0223E6FC */ if (_t247) goto L_0223E71C; else goto L_0223E700;
   L_0223E700: ; // 0x223e700
@@ -18787,8 +18787,8 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
   L_0223E708: ; // 0x223e708
         /* 0223E708 */ _t249 = cpu->r[30] + 0x000002B8u;
         /* 0223E708 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t249);
-        /* 0223E70C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[31]);
-        /* 0223E710 */ _t250 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223E70C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[31]));
+        /* 0223E710 */ _t250 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223E710 */ _t251 = _t250 & 0x00000001u;
         /* 0223E710 */ if (_t251) goto L_0223E71C; else goto L_0223E714;
   L_0223E714: ; // 0x223e714
@@ -18804,8 +18804,8 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E72C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0223E730 */ _t254 = cpu->r[3] + 0x00000004u;
         /* 0223E730 */ cpu->f[8] = rbrew_read_f32(cpu->mem, _t254);
-        /* 0223E734 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[8], cpu->f[31]);
-        /* 0223E738 */ _t255 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223E734 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[8], cpu->f[31]));
+        /* 0223E738 */ _t255 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223E738 */ _t256 = _t255 & 0x00000001u;
         /* 0223E738 */ if (_t256) goto L_0223E73C; else goto L_0223E76C;
   L_0223E73C: ; // 0x223e73c
@@ -18821,8 +18821,8 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E754 */ _t260 = cpu->r[30] + 0x0000008Cu;
         /* 0223E754 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t260);
         /* 0223E758 */ cpu->f[12] = cpu->f[13] - cpu->f[0];
-        /* 0223E75C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[31]);
-        /* 0223E760 */ _t261 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223E75C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[31]));
+        /* 0223E760 */ _t261 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223E760 */ _t262 = _t261 & 0x00000001u;
         /* 0223E760 */ if (_t262) goto L_0223E76C; else goto L_0223E764;
   L_0223E764: ; // 0x223e764
@@ -18840,7 +18840,7 @@ void Gambit_fn_0223E0B8(CPUState* cpu) {
         /* 0223E780 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t265);
         /* 0223E784 */ _t266 = cpu->r[1] + 0x00000070u;
         /* 0223E784 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t266);
-        /* 0223E788 */ _t267 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223E788 */ _t267 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223E788 */ _t268 = _t267 & 0x00000001u;
         /* 0223E788 */ if (_t268) goto L_0223E78C; // else: addr-0 trap, fall-through
   L_0223E78C: ; // 0x223e78c
@@ -18860,8 +18860,8 @@ void Gambit_fn_0223E79C(CPUState* cpu) {
         /* 0223E79C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223E7A0 */ _t1 = cpu->r[5] + 0x00000000u;
         /* 0223E7A0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t1);
-        /* 0223E7A4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[0]);
-        /* 0223E7A8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E7A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[0]));
+        /* 0223E7A8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E7A8 */ _t3 = _t2 & 0x00000001u;
         /* 0223E7A8 */ if (_t3) goto L_0223E7AC; else goto L_0223E7B8;
   L_0223E7AC: ; // 0x223e7ac
@@ -18938,9 +18938,9 @@ void Gambit_fn_0223E7F0(CPUState* cpu) {
         /* 0223E804 */ _t2 = cpu->r[29] + 0x00000128u;
         /* 0223E804 */ cpu->r[8] = rbrew_read32(cpu->mem, _t2);
         /* 0223E808 */ cpu->r[30] = cpu->r[4];
-        /* 0223E80C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000001u);
+        /* 0223E80C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000001u));
         /* 0223E810 */ cpu->r[31] = cpu->r[5];
-        /* 0223E814 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E814 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E814 */ _t4 = _t3 & 0x00000001u;
         /* 0223E814 */ if (_t4) goto L_0223E818; else goto L_0223E8FC;
   L_0223E818: ; // 0x223e818
@@ -18948,9 +18948,9 @@ void Gambit_fn_0223E7F0(CPUState* cpu) {
         /* 0223E81C */ _t5 = cpu->r[12] + 0xFFFFE5F8u;
         /* 0223E81C */ cpu->r[10] = rbrew_read32(cpu->mem, _t5);
         /* 0223E81C */ cpu->r[12] = _t5;
-        /* 0223E820 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0223E820 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0223E824 */ cpu->r[28] = 0x101D0000u;
-        /* 0223E828 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E828 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E828 */ _t7 = _t6 & 0x00000001u;
         /* 0223E828 */ if (_t7) goto L_0223E82C; else goto L_0223E848;
   L_0223E82C: ; // 0x223e82c
@@ -18967,9 +18967,9 @@ void Gambit_fn_0223E7F0(CPUState* cpu) {
         /* 0223E84C */ _t9 = cpu->r[11] + 0xFFFFE5F4u;
         /* 0223E84C */ cpu->r[12] = rbrew_read32(cpu->mem, _t9);
         /* 0223E84C */ cpu->r[11] = _t9;
-        /* 0223E850 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0223E850 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0223E854 */ cpu->r[27] = 0x101D0000u;
-        /* 0223E858 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E858 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E858 */ _t11 = _t10 & 0x00000001u;
         /* 0223E858 */ if (_t11) goto L_0223E85C; else goto L_0223E888;
   L_0223E85C: ; // 0x223e85c
@@ -18984,8 +18984,8 @@ void Gambit_fn_0223E7F0(CPUState* cpu) {
         /* 0223E874 */ Gambit_fn_02836FFC(cpu);
         /* 0223E878 */ _t14 = cpu->r[27] + 0xFFFFFF9Cu;
         /* 0223E878 */ cpu->r[7] = rbrew_read32(cpu->mem, _t14);
-        /* 0223E87C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0223E880 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E87C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0223E880 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E880 */ _t16 = _t15 & 0x00000001u;
         /* 0223E880 */ if (_t16) goto L_0223E8AC; else goto L_0223E884;
   L_0223E884: ; // 0x223e884
@@ -18993,8 +18993,8 @@ void Gambit_fn_0223E7F0(CPUState* cpu) {
   L_0223E888: ; // 0x223e888
         /* 0223E888 */ _t17 = cpu->r[27] + 0xFFFFFF9Cu;
         /* 0223E888 */ cpu->r[10] = rbrew_read32(cpu->mem, _t17);
-        /* 0223E88C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0223E890 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E88C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0223E890 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E890 */ _t19 = _t18 & 0x00000001u;
         /* 0223E890 */ if (_t19) goto L_0223E894; else goto L_0223E8D4;
   L_0223E894: ; // 0x223e894
@@ -19003,8 +19003,8 @@ void Gambit_fn_0223E7F0(CPUState* cpu) {
         /* 0223E89C */ Gambit_fn_02836FFC(cpu);
         /* 0223E8A0 */ _t20 = cpu->r[27] + 0xFFFFFF9Cu;
         /* 0223E8A0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t20);
-        /* 0223E8A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0223E8A8 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223E8A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0223E8A8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223E8A8 */ _t22 = _t21 & 0x00000001u;
         /* 0223E8A8 */ if (_t22) goto L_0223E8AC; else goto L_0223E8C8;
   L_0223E8AC: ; // 0x223e8ac
@@ -19144,21 +19144,21 @@ void Gambit_fn_0223E978(CPUState* cpu) {
         /* 0223E98C */ _t3 = cpu->r[31] + 0x000002C7u;
         /* 0223E98C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0223E990 */ /* nop */
-        /* 0223E994 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223E994 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223E994 */ _t5 = _t4 & 0x00000001u;
         /* 0223E994 */ if (_t5) goto L_0223E998; else goto L_0223EAF0;
   L_0223E998: ; // 0x223e998
         /* 0223E998 */ _t6 = cpu->r[31] + 0x000002C8u;
         /* 0223E998 */ cpu->r[10] = rbrew_read8(cpu->mem, _t6);
         /* 0223E99C */ /* nop */
-        /* 0223E9A0 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223E9A0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223E9A0 */ _t8 = _t7 & 0x00000001u;
         /* 0223E9A0 */ if (_t8) goto L_0223E9A4; else goto L_0223EAF0;
   L_0223E9A4: ; // 0x223e9a4
         /* 0223E9A4 */ _t9 = cpu->r[31] + 0x000002C9u;
         /* 0223E9A4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t9);
         /* 0223E9A8 */ /* nop */
-        /* 0223E9AC */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223E9AC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223E9AC */ _t11 = _t10 & 0x00000001u;
         /* 0223E9AC */ if (_t11) goto L_0223E9B0; else goto L_0223EAF0;
   L_0223E9B0: ; // 0x223e9b0
@@ -19252,15 +19252,15 @@ void Gambit_fn_0223E978(CPUState* cpu) {
         /* 0223EA74 */ cpu->ctr = cpu->r[8];
         /* 0223EA78 */ cpu->r[3] = cpu->r[31];
         /* 0223EA7C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0223EA80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223EA84 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223EA80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223EA84 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223EA84 */ _t45 = _t44 & 0x00000001u;
         /* 0223EA84 */ if (_t45) goto L_0223EAF0; else goto L_0223EA88;
   L_0223EA88: ; // 0x223ea88
         /* 0223EA88 */ _t46 = cpu->r[31] + 0x000001B4u;
         /* 0223EA88 */ cpu->r[10] = rbrew_read8(cpu->mem, _t46);
-        /* 0223EA8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0223EA90 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223EA8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0223EA90 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223EA90 */ _t48 = _t47 & 0x00000001u;
         /* 0223EA90 */ if (_t48) goto L_0223EAF0; else goto L_0223EA94;
   L_0223EA94: ; // 0x223ea94
@@ -19327,21 +19327,21 @@ void Gambit_fn_0223E97C(CPUState* cpu) {
         /* 0223E98C */ _t3 = cpu->r[31] + 0x000002C7u;
         /* 0223E98C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0223E990 */ /* nop */
-        /* 0223E994 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223E994 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223E994 */ _t5 = _t4 & 0x00000001u;
         /* 0223E994 */ if (_t5) goto L_0223E998; else goto L_0223EAF0;
   L_0223E998: ; // 0x223e998
         /* 0223E998 */ _t6 = cpu->r[31] + 0x000002C8u;
         /* 0223E998 */ cpu->r[10] = rbrew_read8(cpu->mem, _t6);
         /* 0223E99C */ /* nop */
-        /* 0223E9A0 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223E9A0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223E9A0 */ _t8 = _t7 & 0x00000001u;
         /* 0223E9A0 */ if (_t8) goto L_0223E9A4; else goto L_0223EAF0;
   L_0223E9A4: ; // 0x223e9a4
         /* 0223E9A4 */ _t9 = cpu->r[31] + 0x000002C9u;
         /* 0223E9A4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t9);
         /* 0223E9A8 */ /* nop */
-        /* 0223E9AC */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223E9AC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223E9AC */ _t11 = _t10 & 0x00000001u;
         /* 0223E9AC */ if (_t11) goto L_0223E9B0; else goto L_0223EAF0;
   L_0223E9B0: ; // 0x223e9b0
@@ -19435,15 +19435,15 @@ void Gambit_fn_0223E97C(CPUState* cpu) {
         /* 0223EA74 */ cpu->ctr = cpu->r[8];
         /* 0223EA78 */ cpu->r[3] = cpu->r[31];
         /* 0223EA7C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0223EA80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223EA84 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223EA80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223EA84 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223EA84 */ _t45 = _t44 & 0x00000001u;
         /* 0223EA84 */ if (_t45) goto L_0223EAF0; else goto L_0223EA88;
   L_0223EA88: ; // 0x223ea88
         /* 0223EA88 */ _t46 = cpu->r[31] + 0x000001B4u;
         /* 0223EA88 */ cpu->r[10] = rbrew_read8(cpu->mem, _t46);
-        /* 0223EA8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0223EA90 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223EA8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0223EA90 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223EA90 */ _t48 = _t47 & 0x00000001u;
         /* 0223EA90 */ if (_t48) goto L_0223EAF0; else goto L_0223EA94;
   L_0223EA94: ; // 0x223ea94
@@ -19510,8 +19510,8 @@ void Gambit_fn_0223EB0C(CPUState* cpu) {
         /* 0223EB1C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0223EB20 */ _t3 = cpu->r[31] + 0x000001B4u;
         /* 0223EB20 */ cpu->r[9] = rbrew_read8(cpu->mem, _t3);
-        /* 0223EB24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0223EB28 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223EB24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0223EB28 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223EB28 */ _t5 = _t4 & 0x00000001u;
         /* 0223EB28 */ if (_t5) goto L_0223EB2C; else goto L_0223EB44;
   L_0223EB2C: ; // 0x223eb2c
@@ -19563,8 +19563,8 @@ void Gambit_fn_0223EB10(CPUState* cpu) {
         /* 0223EB1C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0223EB20 */ _t3 = cpu->r[31] + 0x000001B4u;
         /* 0223EB20 */ cpu->r[9] = rbrew_read8(cpu->mem, _t3);
-        /* 0223EB24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0223EB28 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223EB24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0223EB28 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223EB28 */ _t5 = _t4 & 0x00000001u;
         /* 0223EB28 */ if (_t5) goto L_0223EB2C; else goto L_0223EB44;
   L_0223EB2C: ; // 0x223eb2c
@@ -19630,8 +19630,8 @@ void Gambit_fn_0223EB84(CPUState* cpu) {
   L_0223EBC8: ; // 0x223ebc8
         /* 0223EBC8 */ _t3 = cpu->r[25] + 0xFFFFE5F8u;
         /* 0223EBC8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 0223EBCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223EBD0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223EBCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223EBD0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223EBD0 */ _t5 = _t4 & 0x00000001u;
         /* 0223EBD0 */ if (_t5) goto L_0223EBD4; else goto L_0223EBEC;
   L_0223EBD4: ; // 0x223ebd4
@@ -19645,8 +19645,8 @@ void Gambit_fn_0223EB84(CPUState* cpu) {
   L_0223EBEC: ; // 0x223ebec
         /* 0223EBEC */ _t7 = cpu->r[22] + 0xFFFFE5F4u;
         /* 0223EBEC */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
-        /* 0223EBF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0223EBF4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223EBF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0223EBF4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223EBF4 */ _t9 = _t8 & 0x00000001u;
         /* 0223EBF4 */ if (_t9) goto L_0223EBF8; else goto L_0223EC00;
   L_0223EBF8: ; // 0x223ebf8
@@ -19655,8 +19655,8 @@ void Gambit_fn_0223EB84(CPUState* cpu) {
         /* 0223EBFC */ _t11 = cpu->r[22] + 0xFFFFE5F4u;
         /* 0223EBFC */ rbrew_write32(cpu->mem, _t11, cpu->r[24]);
   L_0223EC00: ; // 0x223ec00
-        /* 0223EC00 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000003u);
-        /* 0223EC04 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223EC00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000003u));
+        /* 0223EC04 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223EC04 */ _t13 = _t12 & 0x00000001u;
         /* 0223EC04 */ if (_t13) goto L_0223EC30; else goto L_0223EC08;
   L_0223EC08: ; // 0x223ec08
@@ -19669,8 +19669,8 @@ void Gambit_fn_0223EB84(CPUState* cpu) {
         /* 0223EC18 */ rbrew_write32(cpu->mem, _t15, cpu->r[0]);
         /* 0223EC1C */ Gambit_fn_027B70B8(cpu);
         /* 0223EC20 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0223EC24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000003u);
-        /* 0223EC28 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223EC24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000003u));
+        /* 0223EC28 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223EC28 */ _t17 = _t16 & 0x00000001u;
         /* 0223EC28 */ if (_t17) goto L_0223EBC8; else goto L_0223EC2C;
   L_0223EC2C: ; // 0x223ec2c
@@ -19678,8 +19678,8 @@ void Gambit_fn_0223EB84(CPUState* cpu) {
   L_0223EC30: ; // 0x223ec30
         /* 0223EC30 */ _t18 = cpu->r[21] + 0xFFFFFF9Cu;
         /* 0223EC30 */ cpu->r[11] = rbrew_read32(cpu->mem, _t18);
-        /* 0223EC34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0223EC38 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223EC34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0223EC38 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223EC38 */ _t20 = _t19 & 0x00000001u;
         /* 0223EC38 */ if (_t20) goto L_0223EC3C; else goto L_0223EC74;
   L_0223EC3C: ; // 0x223ec3c
@@ -19688,8 +19688,8 @@ void Gambit_fn_0223EB84(CPUState* cpu) {
         /* 0223EC44 */ Gambit_fn_02836FFC(cpu);
         /* 0223EC48 */ _t21 = cpu->r[21] + 0xFFFFFF9Cu;
         /* 0223EC48 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
-        /* 0223EC4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223EC50 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223EC4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223EC50 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223EC50 */ _t23 = _t22 & 0x00000001u;
         /* 0223EC50 */ if (_t23) goto L_0223EC54; else goto L_0223EC68;
   L_0223EC54: ; // 0x223ec54
@@ -19716,8 +19716,8 @@ void Gambit_fn_0223EB84(CPUState* cpu) {
         /* 0223EC88 */ rbrew_write32(cpu->mem, _t28, cpu->r[0]);
         /* 0223EC8C */ Gambit_fn_027B70B8(cpu);
         /* 0223EC90 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0223EC94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000003u);
-        /* 0223EC98 */ _t29 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223EC94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000003u));
+        /* 0223EC98 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223EC98 */ _t30 = _t29 & 0x00000001u;
         /* 0223EC98 */ if (_t30) goto L_0223EBC8; else goto L_0223EC9C;
   L_0223EC9C: ; // 0x223ec9c
@@ -19986,17 +19986,17 @@ void Gambit_fn_0223ECB8(CPUState* cpu) {
         /* 0223EECC */ cpu->r[10] = rbrew_read32(cpu->mem, _t100);
         /* 0223EED0 */ _t101 = cpu->r[11] + 0x00002E44u;
         /* 0223EED0 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t101);
-        /* 0223EED4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u);
+        /* 0223EED4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u));
         /* 0223EED8 */ _t102 = cpu->r[31] + 0x000000ACu;
         /* 0223EED8 */ rbrew_write32(cpu->mem, _t102, cpu->r[10]);
-        /* 0223EEDC */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223EEDC */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223EEDC */ _t104 = _t103 & 0x00000001u;
         /* 0223EEDC */ if (_t104) goto L_0223EEE0; else goto L_0223EEF0;
   L_0223EEE0: ; // 0x223eee0
         /* 0223EEE0 */ cpu->r[3] = 0x00000010u;
         /* 0223EEE4 */ Gambit_fn_02801A78(cpu);
-        /* 0223EEE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223EEEC */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223EEE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223EEEC */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223EEEC */ _t106 = _t105 & 0x00000001u;
         /* 0223EEEC */ if (_t106) goto L_0223EF00; else goto L_0223EEF0;
   L_0223EEF0: ; // 0x223eef0
@@ -20009,16 +20009,16 @@ void Gambit_fn_0223ECB8(CPUState* cpu) {
         /* 0223EEFC */ _t110 = cpu->r[3] + 0x0000000Cu;
         /* 0223EEFC */ rbrew_write_f32(cpu->mem, _t110, cpu->f[30]);
   L_0223EF00: ; // 0x223ef00
-        /* 0223EF00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u);
+        /* 0223EF00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u));
         /* 0223EF04 */ cpu->r[3] = cpu->r[31] + 0x000000D0u;
-        /* 0223EF08 */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223EF08 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223EF08 */ _t112 = _t111 & 0x00000001u;
         /* 0223EF08 */ if (_t112) goto L_0223EF0C; else goto L_0223EF1C;
   L_0223EF0C: ; // 0x223ef0c
         /* 0223EF0C */ cpu->r[3] = 0x00000010u;
         /* 0223EF10 */ Gambit_fn_02801A78(cpu);
-        /* 0223EF14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223EF18 */ _t113 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223EF14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223EF18 */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223EF18 */ _t114 = _t113 & 0x00000001u;
         /* 0223EF18 */ if (_t114) goto L_0223EF2C; else goto L_0223EF1C;
   L_0223EF1C: ; // 0x223ef1c
@@ -20066,7 +20066,7 @@ void Gambit_fn_0223ECB8(CPUState* cpu) {
         /* 0223EF70 */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t133);
         /* 0223EF74 */ _t134 = cpu->r[1] + 0x00000058u;
         /* 0223EF74 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t134);
-        /* 0223EF78 */ _t135 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223EF78 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223EF78 */ _t136 = _t135 & 0x00000001u;
         /* 0223EF78 */ if (_t136) goto L_0223EF7C; // else: addr-0 trap, fall-through
   L_0223EF7C: ; // 0x223ef7c
@@ -20082,15 +20082,15 @@ void Gambit_fn_0223EF8C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0223EF8C: ; // 0x223ef8c
-        /* 0223EF8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223EF90 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223EF8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223EF90 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223EF90 */ _t1 = _t0 & 0x00000001u;
         /* 0223EF90 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0223EF90 */ goto L_0223EF94;
   L_0223EF94: ; // 0x223ef94
         /* 0223EF94 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0223EF94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223EF98 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223EF94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223EF98 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223EF98 */ _t3 = _t2 & 0x00000001u;
         /* 0223EF98 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0223EF98 */ goto L_0223EF9C;
@@ -20109,8 +20109,8 @@ void Gambit_fn_0223EF8C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -20124,15 +20124,15 @@ void Gambit_fn_0223EF8C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -20169,7 +20169,7 @@ void Gambit_fn_0223EFB0(CPUState* cpu) {
         /* 0223EFB0 */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 0223EFB0 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 0223EFB0 */ cpu->r[1] = _t0;
-        /* 0223EFB4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223EFB4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223EFB4 */ _t2 = _t1 & 0x00000001u;
         /* 0223EFB4 */ if (_t2) goto L_0223EFB8; else goto L_0223EFC0;
   L_0223EFB8: ; // 0x223efb8
@@ -20239,8 +20239,8 @@ void Gambit_fn_0223EFF0(CPUState* cpu) {
         /* 0223EFF0 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0223EFF0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223EFF4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 0223EFF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0223EFF8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223EFF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0223EFF8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223EFF8 */ _t2 = _t1 & 0x00000001u;
         /* 0223EFF8 */ _t3 = _t2 ^ 0x00000001u;
         /* 0223EFF8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -20262,8 +20262,8 @@ void Gambit_fn_0223F00C(CPUState* cpu) {
         /* 0223F00C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0223F00C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223F010 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 0223F010 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0223F014 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F010 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0223F014 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F014 */ _t2 = _t1 & 0x00000001u;
         /* 0223F014 */ _t3 = _t2 ^ 0x00000001u;
         /* 0223F014 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -20285,8 +20285,8 @@ void Gambit_fn_0223F028(CPUState* cpu) {
         /* 0223F028 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0223F028 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223F02C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 0223F02C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0223F030 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F02C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0223F030 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F030 */ _t2 = _t1 & 0x00000001u;
         /* 0223F030 */ _t3 = _t2 ^ 0x00000001u;
         /* 0223F030 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -20329,8 +20329,8 @@ void Gambit_fn_0223F054(CPUState* cpu) {
         /* 0223F064 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0223F068 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0223F068 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0223F06C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0223F070 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F06C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0223F070 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F070 */ _t5 = _t4 & 0x00000001u;
         /* 0223F070 */ if (_t5) goto L_0223F074; else goto L_0223F090;
   L_0223F074: ; // 0x223f074
@@ -20369,8 +20369,8 @@ void Gambit_fn_0223F058(CPUState* cpu) {
         /* 0223F064 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0223F068 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0223F068 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0223F06C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0223F070 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F06C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0223F070 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F070 */ _t5 = _t4 & 0x00000001u;
         /* 0223F070 */ if (_t5) goto L_0223F074; else goto L_0223F090;
   L_0223F074: ; // 0x223f074
@@ -20823,8 +20823,8 @@ void Gambit_fn_0223F25C(CPUState* cpu) {
         /* 0223F25C */ _t0 = cpu->r[3] + 0x00000114u;
         /* 0223F25C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223F260 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000012u, 0x00000013u);
-        /* 0223F260 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223F264 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F260 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223F264 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F264 */ _t2 = _t1 & 0x00000001u;
         /* 0223F264 */ if (_t2) goto L_0223F274; else goto L_0223F268;
   L_0223F268: ; // 0x223f268
@@ -20851,8 +20851,8 @@ void Gambit_fn_0223F280(CPUState* cpu) {
         /* 0222E4CC */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0222E4CC */ cpu->r[1] = _t1;
         /* 0222E4D0 */ Gambit_fn_021F7000(cpu);
-        /* 0222E4D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0222E4D8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0222E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0222E4D8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0222E4D8 */ _t3 = _t2 & 0x00000001u;
         /* 0222E4D8 */ if (_t3) goto L_0222E4F4; else goto L_0222E4DC;
   L_0222E4DC: ; // 0x222e4dc
@@ -20920,10 +20920,10 @@ void Gambit_fn_0223F2B0(CPUState* cpu) {
         /* 0223F2B0 */ cpu->r[10] = 0x101D0000u;
         /* 0223F2B4 */ _t0 = cpu->r[10] + 0xFFFFE5F0u;
         /* 0223F2B4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 0223F2B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0223F2B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0223F2BC */ cpu->r[10] = 0x101D0000u;
         /* 0223F2C0 */ cpu->r[10] = cpu->r[10] + 0xFFFFFF98u;
-        /* 0223F2C4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F2C4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F2C4 */ _t2 = _t1 & 0x00000001u;
         /* 0223F2C4 */ if (_t2) goto L_0223F2C8; else goto L_0223F2E0;
   L_0223F2C8: ; // 0x223f2c8
@@ -20936,8 +20936,8 @@ void Gambit_fn_0223F2B0(CPUState* cpu) {
         /* 0223F2DC */ _t4 = cpu->r[10] + 0x00000000u;
         /* 0223F2DC */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_0223F2E0: ; // 0x223f2e0
-        /* 0223F2E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0223F2E4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F2E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0223F2E4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F2E4 */ _t6 = _t5 & 0x00000001u;
         /* 0223F2E4 */ if (_t6) goto L_0223F2E8; else goto L_0223F2F0;
   L_0223F2E8: ; // 0x223f2e8
@@ -20948,9 +20948,9 @@ void Gambit_fn_0223F2B0(CPUState* cpu) {
         /* 0223F2F4 */ _t7 = cpu->r[9] + 0xFFFFDA00u;
         /* 0223F2F4 */ cpu->r[9] = rbrew_read32(cpu->mem, _t7);
         /* 0223F2F8 */ cpu->r[11] = 0x101D0000u;
-        /* 0223F2FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0223F2FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0223F300 */ cpu->r[11] = cpu->r[11] + 0xFFFFFBFCu;
-        /* 0223F304 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F304 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F304 */ _t9 = _t8 & 0x00000001u;
         /* 0223F304 */ if (_t9) goto L_0223F308; else goto L_0223F320;
   L_0223F308: ; // 0x223f308
@@ -20963,8 +20963,8 @@ void Gambit_fn_0223F2B0(CPUState* cpu) {
         /* 0223F31C */ _t11 = cpu->r[11] + 0x00000000u;
         /* 0223F31C */ rbrew_write32(cpu->mem, _t11, cpu->r[9]);
   L_0223F320: ; // 0x223f320
-        /* 0223F320 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 0223F324 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F320 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 0223F324 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F324 */ _t13 = _t12 & 0x00000001u;
         /* 0223F324 */ if (_t13) goto L_0223F328; else goto L_0223F330;
   L_0223F328: ; // 0x223f328
@@ -20975,9 +20975,9 @@ void Gambit_fn_0223F2B0(CPUState* cpu) {
         /* 0223F334 */ _t14 = cpu->r[11] + 0xFFFFD9ECu;
         /* 0223F334 */ cpu->r[11] = rbrew_read32(cpu->mem, _t14);
         /* 0223F338 */ cpu->r[9] = 0x101D0000u;
-        /* 0223F33C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0223F33C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0223F340 */ cpu->r[9] = cpu->r[9] + 0xFFFFFB4Cu;
-        /* 0223F344 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F344 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F344 */ _t16 = _t15 & 0x00000001u;
         /* 0223F344 */ if (_t16) goto L_0223F348; else goto L_0223F360;
   L_0223F348: ; // 0x223f348
@@ -20990,8 +20990,8 @@ void Gambit_fn_0223F2B0(CPUState* cpu) {
         /* 0223F35C */ _t18 = cpu->r[9] + 0x00000000u;
         /* 0223F35C */ rbrew_write32(cpu->mem, _t18, cpu->r[11]);
   L_0223F360: ; // 0x223f360
-        /* 0223F360 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[9]);
-        /* 0223F364 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F360 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[9]));
+        /* 0223F364 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F364 */ _t20 = _t19 & 0x00000001u;
         /* 0223F364 */ if (_t20) goto L_0223F368; else goto L_0223F370;
   L_0223F368: ; // 0x223f368
@@ -21003,9 +21003,9 @@ void Gambit_fn_0223F2B0(CPUState* cpu) {
         /* 0223F374 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
         /* 0223F374 */ cpu->r[9] = _t21;
         /* 0223F378 */ cpu->r[10] = 0x101D0000u;
-        /* 0223F37C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0223F37C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0223F380 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 0223F384 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F384 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F384 */ _t23 = _t22 & 0x00000001u;
         /* 0223F384 */ if (_t23) goto L_0223F388; else goto L_0223F39C;
   L_0223F388: ; // 0x223f388
@@ -21017,8 +21017,8 @@ void Gambit_fn_0223F2B0(CPUState* cpu) {
         /* 0223F398 */ _t25 = cpu->r[10] + 0x00000000u;
         /* 0223F398 */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_0223F39C: ; // 0x223f39c
-        /* 0223F39C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0223F3A0 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F39C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0223F3A0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F3A0 */ _t27 = _t26 & 0x00000001u;
         /* 0223F3A0 */ if (_t27) goto L_0223F3A4; else goto L_0223F3AC;
   L_0223F3A4: ; // 0x223f3a4
@@ -21030,9 +21030,9 @@ void Gambit_fn_0223F2B0(CPUState* cpu) {
         /* 0223F3B0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t28);
         /* 0223F3B0 */ cpu->r[10] = _t28;
         /* 0223F3B4 */ cpu->r[11] = 0x101D0000u;
-        /* 0223F3B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0223F3B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0223F3BC */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 0223F3C0 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F3C0 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F3C0 */ _t30 = _t29 & 0x00000001u;
         /* 0223F3C0 */ if (_t30) goto L_0223F3C4; else goto L_0223F3D8;
   L_0223F3C4: ; // 0x223f3c4
@@ -21087,15 +21087,15 @@ void Gambit_fn_0223F410(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0223F410: ; // 0x223f410
-        /* 0223F410 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223F414 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F410 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223F414 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F414 */ _t1 = _t0 & 0x00000001u;
         /* 0223F414 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0223F414 */ goto L_0223F418;
   L_0223F418: ; // 0x223f418
         /* 0223F418 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0223F418 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223F41C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223F41C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F41C */ _t3 = _t2 & 0x00000001u;
         /* 0223F41C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0223F41C */ goto L_0223F420;
@@ -21114,8 +21114,8 @@ void Gambit_fn_0223F410(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -21129,15 +21129,15 @@ void Gambit_fn_0223F410(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -21165,15 +21165,15 @@ void Gambit_fn_0223F424(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0223F424: ; // 0x223f424
-        /* 0223F424 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223F428 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F424 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223F428 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F428 */ _t1 = _t0 & 0x00000001u;
         /* 0223F428 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0223F428 */ goto L_0223F42C;
   L_0223F42C: ; // 0x223f42c
         /* 0223F42C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0223F42C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223F430 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F42C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223F430 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F430 */ _t3 = _t2 & 0x00000001u;
         /* 0223F430 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0223F430 */ goto L_0223F434;
@@ -21192,8 +21192,8 @@ void Gambit_fn_0223F424(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -21207,15 +21207,15 @@ void Gambit_fn_0223F424(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -21249,18 +21249,18 @@ void Gambit_fn_0223F43C(CPUState* cpu) {
         /* 0223F440 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0223F440 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0223F444 */ cpu->r[31] = cpu->r[3];
-        /* 0223F444 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0223F444 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0223F448 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0223F448 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0223F44C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F44C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F44C */ _t4 = _t3 & 0x00000001u;
         /* 0223F44C */ if (_t4) goto L_0223F450; else goto L_0223F460;
   L_0223F450: ; // 0x223f450
         /* 0223F450 */ cpu->r[3] = 0x0000023Cu;
         /* 0223F454 */ Gambit_fn_02801A78(cpu);
         /* 0223F458 */ cpu->r[31] = cpu->r[3];
-        /* 0223F458 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0223F45C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F458 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0223F45C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F45C */ _t6 = _t5 & 0x00000001u;
         /* 0223F45C */ if (_t6) goto L_0223F484; else goto L_0223F460;
   L_0223F460: ; // 0x223f460
@@ -21306,8 +21306,8 @@ void Gambit_fn_0223F49C(CPUState* cpu) {
         /* 0223F4B8 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 0223F4B8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t4);
         /* 0223F4BC */ cpu->r[29] = 0x00000000u;
-        /* 0223F4C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[7]);
-        /* 0223F4C4 */ _t5 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223F4C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[7]));
+        /* 0223F4C4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223F4C4 */ _t6 = _t5 & 0x00000001u;
         /* 0223F4C4 */ if (_t6) goto L_0223F4C8; else goto L_0223F50C;
   L_0223F4C8: ; // 0x223f4c8
@@ -21334,9 +21334,9 @@ void Gambit_fn_0223F49C(CPUState* cpu) {
         /* 0223F4F8 */ _t14 = cpu->r[11] + 0x00000000u;
         /* 0223F4F8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 0223F4FC */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 0223F500 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[0]);
+        /* 0223F500 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[0]));
         /* 0223F504 */ cpu->r[27] = cpu->r[27] + 0x00000004u;
-        /* 0223F508 */ _t15 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223F508 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223F508 */ _t16 = _t15 & 0x00000001u;
         /* 0223F508 */ if (_t16) goto L_0223F4D4; else goto L_0223F50C;
   L_0223F50C: ; // 0x223f50c
@@ -21478,10 +21478,10 @@ void Gambit_fn_0223F598(CPUState* cpu) {
         /* 0223F5D8 */ _t8 = cpu->r[31] + 0x00000238u;
         /* 0223F5D8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t8);
         /* 0223F5DC */ cpu->r[12] = cpu->r[12] | 0x00000040u;
-        /* 0223F5E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0223F5E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0223F5E4 */ _t9 = cpu->r[31] + 0x00000230u;
         /* 0223F5E4 */ rbrew_write32(cpu->mem, _t9, cpu->r[12]);
-        /* 0223F5E8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F5E8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F5E8 */ _t11 = _t10 & 0x00000001u;
         /* 0223F5E8 */ if (_t11) goto L_0223F5EC; else goto L_0223F644;
   L_0223F5EC: ; // 0x223f5ec
@@ -21491,8 +21491,8 @@ void Gambit_fn_0223F598(CPUState* cpu) {
         /* 0223F5F0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t13);
         /* 0223F5F4 */ _t14 = cpu->r[10] + 0x00000000u;
         /* 0223F5F4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
-        /* 0223F5F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223F5FC */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223F5F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223F5FC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223F5FC */ _t16 = _t15 & 0x00000001u;
         /* 0223F5FC */ if (_t16) goto L_0223F600; else goto L_0223F63C;
   L_0223F600: ; // 0x223f600
@@ -21514,8 +21514,8 @@ void Gambit_fn_0223F598(CPUState* cpu) {
         /* 0223F624 */ cpu->r[6] = rbrew_read32(cpu->mem, _t21);
         /* 0223F628 */ _t22 = cpu->r[6] + 0x00000030u;
         /* 0223F628 */ cpu->r[10] = rbrew_read8(cpu->mem, _t22);
-        /* 0223F62C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0223F630 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F62C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0223F630 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F630 */ _t24 = _t23 & 0x00000001u;
         /* 0223F630 */ if (_t24) goto L_0223F644; else goto L_0223F634;
   L_0223F634: ; // 0x223f634
@@ -21571,10 +21571,10 @@ void Gambit_fn_0223F59C(CPUState* cpu) {
         /* 0223F5D8 */ _t8 = cpu->r[31] + 0x00000238u;
         /* 0223F5D8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t8);
         /* 0223F5DC */ cpu->r[12] = cpu->r[12] | 0x00000040u;
-        /* 0223F5E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0223F5E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0223F5E4 */ _t9 = cpu->r[31] + 0x00000230u;
         /* 0223F5E4 */ rbrew_write32(cpu->mem, _t9, cpu->r[12]);
-        /* 0223F5E8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F5E8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F5E8 */ _t11 = _t10 & 0x00000001u;
         /* 0223F5E8 */ if (_t11) goto L_0223F5EC; else goto L_0223F644;
   L_0223F5EC: ; // 0x223f5ec
@@ -21584,8 +21584,8 @@ void Gambit_fn_0223F59C(CPUState* cpu) {
         /* 0223F5F0 */ cpu->r[10] = rbrew_read32(cpu->mem, _t13);
         /* 0223F5F4 */ _t14 = cpu->r[10] + 0x00000000u;
         /* 0223F5F4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
-        /* 0223F5F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223F5FC */ _t15 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0223F5F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223F5FC */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0223F5FC */ _t16 = _t15 & 0x00000001u;
         /* 0223F5FC */ if (_t16) goto L_0223F600; else goto L_0223F63C;
   L_0223F600: ; // 0x223f600
@@ -21607,8 +21607,8 @@ void Gambit_fn_0223F59C(CPUState* cpu) {
         /* 0223F624 */ cpu->r[6] = rbrew_read32(cpu->mem, _t21);
         /* 0223F628 */ _t22 = cpu->r[6] + 0x00000030u;
         /* 0223F628 */ cpu->r[10] = rbrew_read8(cpu->mem, _t22);
-        /* 0223F62C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0223F630 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F62C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0223F630 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F630 */ _t24 = _t23 & 0x00000001u;
         /* 0223F630 */ if (_t24) goto L_0223F644; else goto L_0223F634;
   L_0223F634: ; // 0x223f634
@@ -21675,8 +21675,8 @@ void Gambit_fn_0223F68C(CPUState* cpu) {
   L_0223F68C: ; // 0x223f68c
         /* 0223F68C */ _t0 = cpu->r[3] + 0x00000008u;
         /* 0223F68C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 0223F690 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0223F694 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F690 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0223F694 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F694 */ _t2 = _t1 & 0x00000001u;
         /* 0223F694 */ if (_t2) goto L_0223F6A0; else goto L_0223F698;
   L_0223F698: ; // 0x223f698
@@ -21694,8 +21694,8 @@ void Gambit_fn_0223F6A8(CPUState* cpu) {
   L_0223F6A8: ; // 0x223f6a8
         /* 0223F6A8 */ _t0 = cpu->r[3] + 0x00000008u;
         /* 0223F6A8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 0223F6AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0223F6B0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F6AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0223F6B0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F6B0 */ _t2 = _t1 & 0x00000001u;
         /* 0223F6B0 */ if (_t2) goto L_0223F6BC; else goto L_0223F6B4;
   L_0223F6B4: ; // 0x223f6b4
@@ -21727,8 +21727,8 @@ void Gambit_fn_0223F6D4(CPUState* cpu) {
         /* 0223F6D4 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0223F6D4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223F6D8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0223F6D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223F6DC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F6D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223F6DC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F6DC */ _t2 = _t1 & 0x00000001u;
         /* 0223F6DC */ _t3 = _t2 ^ 0x00000001u;
         /* 0223F6DC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -21750,8 +21750,8 @@ void Gambit_fn_0223F6F0(CPUState* cpu) {
         /* 0223F6F0 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0223F6F0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223F6F4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 0223F6F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0223F6F8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F6F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0223F6F8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F6F8 */ _t2 = _t1 & 0x00000001u;
         /* 0223F6F8 */ _t3 = _t2 ^ 0x00000001u;
         /* 0223F6F8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -21773,8 +21773,8 @@ void Gambit_fn_0223F70C(CPUState* cpu) {
         /* 0223F70C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0223F70C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223F710 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Eu, 0x0000001Fu, 0x0000001Fu);
-        /* 0223F710 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0223F714 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0223F714 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F714 */ _t2 = _t1 & 0x00000001u;
         /* 0223F714 */ _t3 = _t2 ^ 0x00000001u;
         /* 0223F714 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -21796,8 +21796,8 @@ void Gambit_fn_0223F728(CPUState* cpu) {
         /* 0223F728 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0223F728 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223F72C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 0223F72C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0223F730 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F72C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0223F730 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F730 */ _t2 = _t1 & 0x00000001u;
         /* 0223F730 */ _t3 = _t2 ^ 0x00000001u;
         /* 0223F730 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -21819,8 +21819,8 @@ void Gambit_fn_0223F744(CPUState* cpu) {
         /* 0223F744 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0223F744 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223F748 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Cu, 0x0000001Fu, 0x0000001Fu);
-        /* 0223F748 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0223F74C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F748 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0223F74C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F74C */ _t2 = _t1 & 0x00000001u;
         /* 0223F74C */ _t3 = _t2 ^ 0x00000001u;
         /* 0223F74C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -21842,8 +21842,8 @@ void Gambit_fn_0223F760(CPUState* cpu) {
         /* 0223F760 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0223F760 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223F764 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Bu, 0x0000001Fu, 0x0000001Fu);
-        /* 0223F764 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0223F768 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F764 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0223F768 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F768 */ _t2 = _t1 & 0x00000001u;
         /* 0223F768 */ _t3 = _t2 ^ 0x00000001u;
         /* 0223F768 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -21865,8 +21865,8 @@ void Gambit_fn_0223F77C(CPUState* cpu) {
         /* 0223F77C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0223F77C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0223F780 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 0223F780 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0223F784 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F780 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0223F784 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F784 */ _t2 = _t1 & 0x00000001u;
         /* 0223F784 */ _t3 = _t2 ^ 0x00000001u;
         /* 0223F784 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -21974,9 +21974,9 @@ void Gambit_fn_0223F7FC(CPUState* cpu) {
         /* 0223F800 */ cpu->r[11] = rbrew_read32(cpu->mem, _t0);
         /* 0223F800 */ cpu->r[9] = _t0;
         /* 0223F804 */ cpu->r[12] = 0x101D0000u;
-        /* 0223F808 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0223F808 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0223F80C */ cpu->r[12] = cpu->r[12] + 0xFFFFDB18u;
-        /* 0223F810 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F810 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F810 */ _t2 = _t1 & 0x00000001u;
         /* 0223F810 */ if (_t2) goto L_0223F814; else goto L_0223F828;
   L_0223F814: ; // 0x223f814
@@ -21988,8 +21988,8 @@ void Gambit_fn_0223F7FC(CPUState* cpu) {
         /* 0223F824 */ _t4 = cpu->r[12] + 0x00000000u;
         /* 0223F824 */ rbrew_write32(cpu->mem, _t4, cpu->r[7]);
   L_0223F828: ; // 0x223f828
-        /* 0223F828 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0223F82C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F828 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0223F82C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F82C */ _t6 = _t5 & 0x00000001u;
         /* 0223F82C */ if (_t6) goto L_0223F830; else goto L_0223F838;
   L_0223F830: ; // 0x223f830
@@ -22001,9 +22001,9 @@ void Gambit_fn_0223F7FC(CPUState* cpu) {
         /* 0223F83C */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 0223F83C */ cpu->r[7] = _t7;
         /* 0223F840 */ cpu->r[11] = 0x101D0000u;
-        /* 0223F844 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0223F844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0223F848 */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 0223F84C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223F84C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223F84C */ _t9 = _t8 & 0x00000001u;
         /* 0223F84C */ if (_t9) goto L_0223F850; else goto L_0223F864;
   L_0223F850: ; // 0x223f850
@@ -22774,8 +22774,8 @@ void Gambit_fn_0223FBB8(CPUState* cpu) {
         /* 0223FBC8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0223FBCC */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0223FBCC */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 0223FBD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 0223FBD4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223FBD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 0223FBD4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223FBD4 */ _t5 = _t4 & 0x00000001u;
         /* 0223FBD4 */ if (_t5) goto L_0223FBD8; else goto L_0223FBF4;
   L_0223FBD8: ; // 0x223fbd8
@@ -22831,8 +22831,8 @@ void Gambit_fn_0223FBBC(CPUState* cpu) {
         /* 0223FBC8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0223FBCC */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0223FBCC */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 0223FBD0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 0223FBD4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223FBD0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 0223FBD4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223FBD4 */ _t5 = _t4 & 0x00000001u;
         /* 0223FBD4 */ if (_t5) goto L_0223FBD8; else goto L_0223FBF4;
   L_0223FBD8: ; // 0x223fbd8
@@ -22948,18 +22948,18 @@ void Gambit_fn_0223FCA0(CPUState* cpu) {
         /* 0223FCA4 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0223FCA4 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0223FCA8 */ cpu->r[31] = cpu->r[3];
-        /* 0223FCA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0223FCA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0223FCAC */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0223FCAC */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0223FCB0 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223FCB0 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223FCB0 */ _t4 = _t3 & 0x00000001u;
         /* 0223FCB0 */ if (_t4) goto L_0223FCB4; else goto L_0223FCC4;
   L_0223FCB4: ; // 0x223fcb4
         /* 0223FCB4 */ cpu->r[3] = 0x00000038u;
         /* 0223FCB8 */ Gambit_fn_02801A78(cpu);
         /* 0223FCBC */ cpu->r[31] = cpu->r[3];
-        /* 0223FCBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0223FCC0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223FCBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0223FCC0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223FCC0 */ _t6 = _t5 & 0x00000001u;
         /* 0223FCC0 */ if (_t6) goto L_0223FCEC; else goto L_0223FCC4;
   L_0223FCC4: ; // 0x223fcc4
@@ -23022,9 +23022,9 @@ void Gambit_fn_0223FD04(CPUState* cpu) {
         /* 0223FD40 */ _t9 = cpu->r[12] + 0x00000238u;
         /* 0223FD40 */ cpu->r[7] = rbrew_read32(cpu->mem, _t9);
         /* 0223FD44 */ cpu->r[31] = 0x00000000u;
-        /* 0223FD48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 0223FD48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 0223FD4C */ cpu->r[6] = cpu->r[12] + 0x00000238u;
-        /* 0223FD50 */ _t10 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223FD50 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223FD50 */ _t11 = _t10 & 0x00000001u;
         /* 0223FD50 */ if (_t11) goto L_0223FD54; else goto L_0223FD60;
   L_0223FD54: ; // 0x223fd54
@@ -23038,9 +23038,9 @@ void Gambit_fn_0223FD04(CPUState* cpu) {
         /* 0223FD60 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 0223FD64 */ _t15 = cpu->r[1] + 0x00000010u;
         /* 0223FD64 */ cpu->r[0] = rbrew_read32(cpu->mem, _t15);
-        /* 0223FD68 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[12]);
+        /* 0223FD68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[12]));
         /* 0223FD6C */ cpu->r[28] = 0x00000000u;
-        /* 0223FD70 */ _t16 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223FD70 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223FD70 */ _t17 = _t16 & 0x00000001u;
         /* 0223FD70 */ if (_t17) goto L_0223FD74; else goto L_0223FD80;
   L_0223FD74: ; // 0x223fd74
@@ -23196,7 +23196,7 @@ void Gambit_fn_0223FD04(CPUState* cpu) {
         /* 0223FF10 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t62);
         /* 0223FF14 */ _t63 = cpu->r[1] + 0x00000130u;
         /* 0223FF14 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t63);
-        /* 0223FF18 */ _t64 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223FF18 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223FF18 */ _t65 = _t64 & 0x00000001u;
         /* 0223FF18 */ if (_t65) goto L_0223FF1C; // else: addr-0 trap, fall-through
   L_0223FF1C: ; // 0x223ff1c
@@ -23232,17 +23232,17 @@ void Gambit_fn_0223FF2C(CPUState* cpu) {
         /* 0223FF50 */ Gambit_fn_0216F4A0(cpu);
         /* 0223FF54 */ _t6 = cpu->r[31] + 0x00000024u;
         /* 0223FF54 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 0223FF58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[3]);
-        /* 0223FF5C */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223FF58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[3]));
+        /* 0223FF5C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223FF5C */ _t8 = _t7 & 0x00000001u;
         /* 0223FF5C */ if (_t8) goto L_0223FF60; else goto L_0223FF88;
   L_0223FF60: ; // 0x223ff60
         /* 0223FF60 */ _t9 = cpu->r[30] + 0x00000000u;
         /* 0223FF60 */ cpu->r[10] = rbrew_read32(cpu->mem, _t9);
-        /* 0223FF64 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000008u);
+        /* 0223FF64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000008u));
         /* 0223FF68 */ _t10 = cpu->r[10] + 0x00000010u;
         /* 0223FF68 */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 0223FF6C */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223FF6C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223FF6C */ _t12 = _t11 & 0x00000001u;
         /* 0223FF6C */ if (_t12) goto L_0223FF70; else goto L_0223FF78;
   L_0223FF70: ; // 0x223ff70
@@ -23253,8 +23253,8 @@ void Gambit_fn_0223FF2C(CPUState* cpu) {
         /* 0223FF78 */ cpu->r[4] = rbrew_read32(cpu->mem, _t13);
         /* 0223FF7C */ _t14 = cpu->r[4] + 0x00000004u;
         /* 0223FF7C */ cpu->r[0] = rbrew_read8(cpu->mem, _t14);
-        /* 0223FF80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223FF84 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223FF80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223FF84 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223FF84 */ _t16 = _t15 & 0x00000001u;
         /* 0223FF84 */ if (_t16) goto L_0223FF88; else goto L_0223FFB0;
   L_0223FF88: ; // 0x223ff88
@@ -23277,8 +23277,8 @@ void Gambit_fn_0223FF2C(CPUState* cpu) {
         /* 0223FFB4 */ Gambit_fn_0223FD04(cpu);
         /* 0223FFB8 */ cpu->r[3] = 0x0000036Cu;
         /* 0223FFBC */ Gambit_fn_02801A78(cpu);
-        /* 0223FFC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223FFC4 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223FFC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223FFC4 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223FFC4 */ _t22 = _t21 & 0x00000001u;
         /* 0223FFC4 */ if (_t22) goto L_0223FFCC; else goto L_0223FFC8;
   L_0223FFC8: ; // 0x223ffc8
@@ -23321,17 +23321,17 @@ void Gambit_fn_0223FF30(CPUState* cpu) {
         /* 0223FF50 */ Gambit_fn_0216F4A0(cpu);
         /* 0223FF54 */ _t6 = cpu->r[31] + 0x00000024u;
         /* 0223FF54 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 0223FF58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[3]);
-        /* 0223FF5C */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223FF58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[3]));
+        /* 0223FF5C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223FF5C */ _t8 = _t7 & 0x00000001u;
         /* 0223FF5C */ if (_t8) goto L_0223FF60; else goto L_0223FF88;
   L_0223FF60: ; // 0x223ff60
         /* 0223FF60 */ _t9 = cpu->r[30] + 0x00000000u;
         /* 0223FF60 */ cpu->r[10] = rbrew_read32(cpu->mem, _t9);
-        /* 0223FF64 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000008u);
+        /* 0223FF64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000008u));
         /* 0223FF68 */ _t10 = cpu->r[10] + 0x00000010u;
         /* 0223FF68 */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 0223FF6C */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0223FF6C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0223FF6C */ _t12 = _t11 & 0x00000001u;
         /* 0223FF6C */ if (_t12) goto L_0223FF70; else goto L_0223FF78;
   L_0223FF70: ; // 0x223ff70
@@ -23342,8 +23342,8 @@ void Gambit_fn_0223FF30(CPUState* cpu) {
         /* 0223FF78 */ cpu->r[4] = rbrew_read32(cpu->mem, _t13);
         /* 0223FF7C */ _t14 = cpu->r[4] + 0x00000004u;
         /* 0223FF7C */ cpu->r[0] = rbrew_read8(cpu->mem, _t14);
-        /* 0223FF80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0223FF84 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223FF80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0223FF84 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223FF84 */ _t16 = _t15 & 0x00000001u;
         /* 0223FF84 */ if (_t16) goto L_0223FF88; else goto L_0223FFB0;
   L_0223FF88: ; // 0x223ff88
@@ -23366,8 +23366,8 @@ void Gambit_fn_0223FF30(CPUState* cpu) {
         /* 0223FFB4 */ Gambit_fn_0223FD04(cpu);
         /* 0223FFB8 */ cpu->r[3] = 0x0000036Cu;
         /* 0223FFBC */ Gambit_fn_02801A78(cpu);
-        /* 0223FFC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0223FFC4 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0223FFC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0223FFC4 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0223FFC4 */ _t22 = _t21 & 0x00000001u;
         /* 0223FFC4 */ if (_t22) goto L_0223FFCC; else goto L_0223FFC8;
   L_0223FFC8: ; // 0x223ffc8
@@ -23402,15 +23402,15 @@ void Gambit_fn_0223FFE8(CPUState* cpu) {
         /* 0223FFF8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0223FFFC */ _t3 = cpu->r[31] + 0x00000028u;
         /* 0223FFFC */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02240000 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02240004 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02240000 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02240004 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02240004 */ _t5 = _t4 & 0x00000001u;
         /* 02240004 */ if (_t5) goto L_02240030; else goto L_02240008;
   L_02240008: ; // 0x2240008
         /* 02240008 */ _t6 = cpu->r[11] + 0x00000014u;
         /* 02240008 */ cpu->r[12] = rbrew_read8(cpu->mem, _t6);
-        /* 0224000C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02240010 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0224000C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02240010 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02240010 */ _t8 = _t7 & 0x00000001u;
         /* 02240010 */ if (_t8) goto L_02240030; else goto L_02240014;
   L_02240014: ; // 0x2240014
@@ -23449,15 +23449,15 @@ void Gambit_fn_0223FFEC(CPUState* cpu) {
         /* 0223FFF8 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0223FFFC */ _t3 = cpu->r[31] + 0x00000028u;
         /* 0223FFFC */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02240000 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02240004 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02240000 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02240004 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02240004 */ _t5 = _t4 & 0x00000001u;
         /* 02240004 */ if (_t5) goto L_02240030; else goto L_02240008;
   L_02240008: ; // 0x2240008
         /* 02240008 */ _t6 = cpu->r[11] + 0x00000014u;
         /* 02240008 */ cpu->r[12] = rbrew_read8(cpu->mem, _t6);
-        /* 0224000C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02240010 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0224000C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02240010 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02240010 */ _t8 = _t7 & 0x00000001u;
         /* 02240010 */ if (_t8) goto L_02240030; else goto L_02240014;
   L_02240014: ; // 0x2240014
@@ -23486,15 +23486,15 @@ void Gambit_fn_02240000(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9;
 
   L_02240000: ; // 0x2240000
-        /* 02240000 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02240004 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02240000 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02240004 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02240004 */ _t1 = _t0 & 0x00000001u;
         /* 02240004 */ if (_t1) goto L_02240030; else goto L_02240008;
   L_02240008: ; // 0x2240008
         /* 02240008 */ _t2 = cpu->r[11] + 0x00000014u;
         /* 02240008 */ cpu->r[12] = rbrew_read8(cpu->mem, _t2);
-        /* 0224000C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02240010 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0224000C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02240010 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02240010 */ _t4 = _t3 & 0x00000001u;
         /* 02240010 */ if (_t4) goto L_02240030; else goto L_02240014;
   L_02240014: ; // 0x2240014
@@ -23546,8 +23546,8 @@ void Gambit_fn_02240044(CPUState* cpu) {
         /* 02240078 */ _t6 = cpu->r[27] + 0x0000001Cu;
         /* 02240078 */ cpu->r[8] = rbrew_read32(cpu->mem, _t6);
         /* 0224007C */ cpu->r[26] = 0x00000000u;
-        /* 02240080 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[8]);
-        /* 02240084 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02240080 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[8]));
+        /* 02240084 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02240084 */ _t8 = _t7 & 0x00000001u;
         /* 02240084 */ if (_t8) goto L_02240088; else goto L_02240184;
   L_02240088: ; // 0x2240088
@@ -23575,24 +23575,24 @@ void Gambit_fn_02240044(CPUState* cpu) {
         /* 022400B8 */ rbrew_write32(cpu->mem, _t15, cpu->r[3]);
         /* 022400BC */ _t16 = cpu->r[1] + 0x00000008u;
         /* 022400BC */ cpu->r[30] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t16);
-        /* 022400C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0xFFFFFFFFu);
+        /* 022400C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0xFFFFFFFFu));
         /* 022400C4 */ _t17 = cpu->r[1] + 0x0000000Cu;
         /* 022400C4 */ rbrew_write32(cpu->mem, _t17, cpu->r[4]);
-        /* 022400C8 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022400C8 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022400C8 */ _t19 = _t18 & 0x00000001u;
         /* 022400C8 */ if (_t19) goto L_0224012C; else goto L_022400CC;
   L_022400CC: ; // 0x22400cc
         /* 022400CC */ _t20 = cpu->r[1] + 0x0000000Au;
         /* 022400CC */ cpu->r[25] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t20);
-        /* 022400D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0xFFFFFFFFu);
-        /* 022400D4 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022400D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0xFFFFFFFFu));
+        /* 022400D4 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022400D4 */ _t22 = _t21 & 0x00000001u;
         /* 022400D4 */ if (_t22) goto L_0224012C; else goto L_022400D8;
   L_022400D8: ; // 0x22400d8
         /* 022400D8 */ _t23 = cpu->r[1] + 0x0000000Cu;
         /* 022400D8 */ cpu->r[24] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t23);
-        /* 022400DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0xFFFFFFFFu);
-        /* 022400E0 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022400DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0xFFFFFFFFu));
+        /* 022400E0 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022400E0 */ _t25 = _t24 & 0x00000001u;
         /* 022400E0 */ if (_t25) goto L_0224012C; else goto L_022400E4;
   L_022400E4: ; // 0x22400e4
@@ -23601,9 +23601,9 @@ void Gambit_fn_02240044(CPUState* cpu) {
         /* 022400EC */ Gambit_fn_0297FC7C(cpu);
         /* 022400F0 */ _t26 = cpu->r[27] + 0x0000001Cu;
         /* 022400F0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t26);
-        /* 022400F4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
+        /* 022400F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
         /* 022400F8 */ cpu->r[10] = 0x00000000u;
-        /* 022400FC */ _t27 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022400FC */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022400FC */ _t28 = _t27 & 0x00000001u;
         /* 022400FC */ if (_t28) goto L_02240100; else goto L_0224010C;
   L_02240100: ; // 0x2240100
@@ -23632,9 +23632,9 @@ void Gambit_fn_02240044(CPUState* cpu) {
         /* 02240138 */ Gambit_fn_0297FC7C(cpu);
         /* 0224013C */ _t34 = cpu->r[27] + 0x0000001Cu;
         /* 0224013C */ cpu->r[0] = rbrew_read32(cpu->mem, _t34);
-        /* 02240140 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[26], cpu->r[0]);
+        /* 02240140 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[26], cpu->r[0]));
         /* 02240144 */ cpu->r[12] = 0x00000000u;
-        /* 02240148 */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02240148 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02240148 */ _t36 = _t35 & 0x00000001u;
         /* 02240148 */ if (_t36) goto L_0224014C; else goto L_02240154;
   L_0224014C: ; // 0x224014c
@@ -23651,17 +23651,17 @@ void Gambit_fn_02240044(CPUState* cpu) {
         /* 0224015C */ cpu->r[9] = rbrew_read32(cpu->mem, _t41);
         /* 02240160 */ cpu->ctr = cpu->r[9];
         /* 02240164 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02240168 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], cpu->r[3]);
-        /* 0224016C */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02240168 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], cpu->r[3]));
+        /* 0224016C */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0224016C */ _t43 = _t42 & 0x00000001u;
         /* 0224016C */ if (_t43) goto L_022400A0; else goto L_02240170;
   L_02240170: ; // 0x2240170
         /* 02240170 */ _t44 = cpu->r[27] + 0x0000001Cu;
         /* 02240170 */ cpu->r[10] = rbrew_read32(cpu->mem, _t44);
         /* 02240174 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 02240178 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], cpu->r[10]);
+        /* 02240178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], cpu->r[10]));
         /* 0224017C */ cpu->r[31] = cpu->r[31] + 0x00000004u;
-        /* 02240180 */ _t45 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02240180 */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02240180 */ _t46 = _t45 & 0x00000001u;
         /* 02240180 */ if (_t46) goto L_02240094; else goto L_02240184;
   L_02240184: ; // 0x2240184
@@ -23674,7 +23674,7 @@ void Gambit_fn_02240044(CPUState* cpu) {
         /* 02240190 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t49);
         /* 02240194 */ _t50 = cpu->r[1] + 0x00000048u;
         /* 02240194 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t50);
-        /* 02240198 */ _t51 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02240198 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02240198 */ _t52 = _t51 & 0x00000001u;
         /* 02240198 */ if (_t52) goto L_0224019C; // else: addr-0 trap, fall-through
   L_0224019C: ; // 0x224019c
@@ -23762,8 +23762,8 @@ void Gambit_fn_022401AC(CPUState* cpu) {
         /* 02240264 */ cpu->r[3] = 0x00000008u;
         /* 02240268 */ Gambit_fn_02801AC8(cpu);
         /* 0224026C */ cpu->r[31] = cpu->r[3];
-        /* 0224026C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02240270 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0224026C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02240270 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02240270 */ _t23 = _t22 & 0x00000001u;
         /* 02240270 */ if (_t23) goto L_0224028C; else goto L_02240274;
   L_02240274: ; // 0x2240274
@@ -23833,9 +23833,9 @@ void Gambit_fn_022401AC(CPUState* cpu) {
         /* 0224032C */ Gambit_fn_0297FC7C(cpu);
         /* 02240330 */ _t40 = cpu->r[28] + 0x0000001Cu;
         /* 02240330 */ cpu->r[5] = rbrew_read32(cpu->mem, _t40);
-        /* 02240334 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[5]);
+        /* 02240334 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[5]));
         /* 02240338 */ cpu->r[11] = 0x00000000u;
-        /* 0224033C */ _t41 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0224033C */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0224033C */ _t42 = _t41 & 0x00000001u;
         /* 0224033C */ if (_t42) goto L_02240340; else goto L_0224034C;
   L_02240340: ; // 0x2240340
@@ -23903,25 +23903,25 @@ void Gambit_fn_022401AC(CPUState* cpu) {
         /* 022403D4 */ _t66 = cpu->r[12] + 0x000035C4u;
         /* 022403D4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t66);
         /* 022403D8 */ cpu->r[8] = 0x10050000u;
-        /* 022403DC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[0]);
+        /* 022403DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[0]));
         /* 022403E0 */ _t67 = cpu->r[8] + 0x000035E4u;
         /* 022403E0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t67);
         /* 022403E4 */ cpu->f[29] = cpu->f[1];
-        /* 022403E8 */ _t68 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022403E8 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022403E8 */ _t69 = _t68 & 0x00000001u;
         /* 022403E8 */ if (_t69) goto L_022403EC; else goto L_022403F0;
   L_022403EC: ; // 0x22403ec
         /* 022403EC */ cpu->f[31] = cpu->f[13];
   L_022403F0: ; // 0x22403f0
-        /* 022403F0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[30], cpu->f[0]);
-        /* 022403F4 */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022403F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[30], cpu->f[0]));
+        /* 022403F4 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022403F4 */ _t71 = _t70 & 0x00000001u;
         /* 022403F4 */ if (_t71) goto L_022403F8; else goto L_022403FC;
   L_022403F8: ; // 0x22403f8
         /* 022403F8 */ cpu->f[30] = cpu->f[13];
   L_022403FC: ; // 0x22403fc
-        /* 022403FC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[29], cpu->f[0]);
-        /* 02240400 */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022403FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[29], cpu->f[0]));
+        /* 02240400 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02240400 */ _t73 = _t72 & 0x00000001u;
         /* 02240400 */ if (_t73) goto L_02240404; else goto L_02240408;
   L_02240404: ; // 0x2240404
@@ -23999,7 +23999,7 @@ void Gambit_fn_022401AC(CPUState* cpu) {
         /* 022404D8 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t90);
         /* 022404DC */ _t91 = cpu->r[1] + 0x000001E0u;
         /* 022404DC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t91);
-        /* 022404E0 */ _t92 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022404E0 */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022404E0 */ _t93 = _t92 & 0x00000001u;
         /* 022404E0 */ if (_t93) goto L_022404E4; // else: addr-0 trap, fall-through
   L_022404E4: ; // 0x22404e4
@@ -24127,23 +24127,23 @@ void Gambit_fn_022404F4(CPUState* cpu) {
         /* 02240604 */ cpu->r[6] = rbrew_read32(cpu->mem, _t39);
         /* 02240608 */ _t40 = cpu->r[6] + 0x00000000u;
         /* 02240608 */ cpu->r[12] = rbrew_read8(cpu->mem, _t40);
-        /* 0224060C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[31]);
+        /* 0224060C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[31]));
         /* 02240610 */ cpu->r[7] = 0x00080000u;
-        /* 02240614 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02240614 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02240614 */ _t42 = _t41 & 0x00000001u;
         /* 02240614 */ if (_t42) goto L_0224063C; else goto L_02240618;
   L_02240618: ; // 0x2240618
         /* 02240618 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0224061C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[7]);
+        /* 0224061C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[7]));
         /* 02240620 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 02240624 */ _t43 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02240624 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02240624 */ _t44 = _t43 & 0x00000001u;
         /* 02240624 */ if (_t44) goto L_02240638; else goto L_02240628;
   L_02240628: ; // 0x2240628
         /* 02240628 */ _t45 = cpu->r[6] + 0x00000000u;
         /* 02240628 */ cpu->r[0] = rbrew_read8(cpu->mem, _t45);
-        /* 0224062C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 02240630 */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0224062C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 02240630 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02240630 */ _t47 = _t46 & 0x00000001u;
         /* 02240630 */ if (_t47) goto L_02240634; else goto L_02240618;
   L_02240634: ; // 0x2240634
@@ -24155,10 +24155,10 @@ void Gambit_fn_022404F4(CPUState* cpu) {
         /* 0224063C */ cpu->r[10] = rbrew_read32(cpu->mem, _t48);
         /* 02240640 */ _t49 = cpu->r[1] + 0x0000000Cu;
         /* 02240640 */ cpu->r[5] = rbrew_read32(cpu->mem, _t49);
-        /* 02240644 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[10]);
+        /* 02240644 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[10]));
         /* 02240648 */ _t50 = cpu->r[5] + 0x00000014u;
         /* 02240648 */ cpu->r[6] = rbrew_read32(cpu->mem, _t50);
-        /* 0224064C */ _t51 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0224064C */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0224064C */ _t52 = _t51 & 0x00000001u;
         /* 0224064C */ if (_t52) goto L_02240654; else goto L_02240650;
   L_02240650: ; // 0x2240650
@@ -24207,7 +24207,7 @@ void Gambit_fn_022404F4(CPUState* cpu) {
         /* 022406C0 */ cpu->r[4] = cpu->r[4] + 0x00003620u;
         /* 022406C4 */ _t66 = cpu->r[1] + 0x00000028u;
         /* 022406C4 */ rbrew_write32(cpu->mem, _t66, cpu->r[0]);
-        /* 022406C8 */ _t67 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 022406C8 */ _t67 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 022406C8 */ _t68 = _t67 & 0x00000001u;
         /* 022406C8 */ if (_t68) goto L_022406CC; // else: addr-0 trap, fall-through
   L_022406CC: ; // 0x22406cc
@@ -24259,7 +24259,7 @@ void Gambit_fn_022404F4(CPUState* cpu) {
         /* 0224073C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t85);
         /* 02240740 */ _t86 = cpu->r[1] + 0x000000C8u;
         /* 02240740 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t86);
-        /* 02240744 */ _t87 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02240744 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02240744 */ _t88 = _t87 & 0x00000001u;
         /* 02240744 */ if (_t88) goto L_02240748; // else: addr-0 trap, fall-through
   L_02240748: ; // 0x2240748
@@ -24286,13 +24286,13 @@ void Gambit_fn_02240758(CPUState* cpu) {
         /* 02240768 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0224076C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0224076C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 02240770 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02240774 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02240770 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02240774 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02240774 */ _t5 = _t4 & 0x00000001u;
         /* 02240774 */ if (_t5) goto L_02240780; else goto L_02240778;
   L_02240778: ; // 0x2240778
-        /* 02240778 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 0224077C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02240778 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 0224077C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0224077C */ _t7 = _t6 & 0x00000001u;
         /* 0224077C */ if (_t7) goto L_02240780; else goto L_022407B4;
   L_02240780: ; // 0x2240780
@@ -24301,10 +24301,10 @@ void Gambit_fn_02240758(CPUState* cpu) {
         /* 02240784 */ cpu->r[12] = 0x101C0000u;
         /* 02240788 */ _t9 = cpu->r[12] + 0x00001358u;
         /* 02240788 */ cpu->r[12] = rbrew_read32(cpu->mem, _t9);
-        /* 0224078C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000008u);
+        /* 0224078C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000008u));
         /* 02240790 */ _t10 = cpu->r[12] + 0x00000010u;
         /* 02240790 */ cpu->r[11] = rbrew_read32(cpu->mem, _t10);
-        /* 02240794 */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02240794 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02240794 */ _t12 = _t11 & 0x00000001u;
         /* 02240794 */ if (_t12) goto L_02240798; else goto L_022407A0;
   L_02240798: ; // 0x2240798
@@ -24342,13 +24342,13 @@ void Gambit_fn_0224075C(CPUState* cpu) {
         /* 02240768 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0224076C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0224076C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 02240770 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02240774 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02240770 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02240774 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02240774 */ _t5 = _t4 & 0x00000001u;
         /* 02240774 */ if (_t5) goto L_02240780; else goto L_02240778;
   L_02240778: ; // 0x2240778
-        /* 02240778 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 0224077C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02240778 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 0224077C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0224077C */ _t7 = _t6 & 0x00000001u;
         /* 0224077C */ if (_t7) goto L_02240780; else goto L_022407B4;
   L_02240780: ; // 0x2240780
@@ -24357,10 +24357,10 @@ void Gambit_fn_0224075C(CPUState* cpu) {
         /* 02240784 */ cpu->r[12] = 0x101C0000u;
         /* 02240788 */ _t9 = cpu->r[12] + 0x00001358u;
         /* 02240788 */ cpu->r[12] = rbrew_read32(cpu->mem, _t9);
-        /* 0224078C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], 0x00000008u);
+        /* 0224078C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], 0x00000008u));
         /* 02240790 */ _t10 = cpu->r[12] + 0x00000010u;
         /* 02240790 */ cpu->r[11] = rbrew_read32(cpu->mem, _t10);
-        /* 02240794 */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02240794 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02240794 */ _t12 = _t11 & 0x00000001u;
         /* 02240794 */ if (_t12) goto L_02240798; else goto L_022407A0;
   L_02240798: ; // 0x2240798
@@ -24495,15 +24495,15 @@ void Gambit_fn_02240834(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02240834: ; // 0x2240834
-        /* 02240834 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02240838 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02240834 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02240838 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02240838 */ _t1 = _t0 & 0x00000001u;
         /* 02240838 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02240838 */ goto L_0224083C;
   L_0224083C: ; // 0x224083c
         /* 0224083C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0224083C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02240840 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0224083C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02240840 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02240840 */ _t3 = _t2 & 0x00000001u;
         /* 02240840 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02240840 */ goto L_02240844;
@@ -24522,8 +24522,8 @@ void Gambit_fn_02240834(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -24537,15 +24537,15 @@ void Gambit_fn_02240834(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -24579,15 +24579,15 @@ void Gambit_fn_0224084C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0224084C: ; // 0x224084c
-        /* 0224084C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02240850 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0224084C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02240850 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02240850 */ _t1 = _t0 & 0x00000001u;
         /* 02240850 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02240850 */ goto L_02240854;
   L_02240854: ; // 0x2240854
         /* 02240854 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02240854 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02240858 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02240854 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02240858 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02240858 */ _t3 = _t2 & 0x00000001u;
         /* 02240858 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02240858 */ goto L_0224085C;
@@ -24606,8 +24606,8 @@ void Gambit_fn_0224084C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -24621,15 +24621,15 @@ void Gambit_fn_0224084C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -24675,15 +24675,15 @@ void Gambit_fn_0224087C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0224087C: ; // 0x224087c
-        /* 0224087C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02240880 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0224087C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02240880 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02240880 */ _t1 = _t0 & 0x00000001u;
         /* 02240880 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02240880 */ goto L_02240884;
   L_02240884: ; // 0x2240884
         /* 02240884 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02240884 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02240888 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02240884 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02240888 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02240888 */ _t3 = _t2 & 0x00000001u;
         /* 02240888 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02240888 */ goto L_0224088C;
@@ -24702,8 +24702,8 @@ void Gambit_fn_0224087C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -24717,15 +24717,15 @@ void Gambit_fn_0224087C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -24753,15 +24753,15 @@ void Gambit_fn_02240890(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02240890: ; // 0x2240890
-        /* 02240890 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02240894 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02240890 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02240894 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02240894 */ _t1 = _t0 & 0x00000001u;
         /* 02240894 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02240894 */ goto L_02240898;
   L_02240898: ; // 0x2240898
         /* 02240898 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02240898 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0224089C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02240898 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0224089C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0224089C */ _t3 = _t2 & 0x00000001u;
         /* 0224089C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0224089C */ goto L_022408A0;
@@ -24780,8 +24780,8 @@ void Gambit_fn_02240890(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -24795,15 +24795,15 @@ void Gambit_fn_02240890(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -24831,15 +24831,15 @@ void Gambit_fn_022408A4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_022408A4: ; // 0x22408a4
-        /* 022408A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022408A8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022408A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022408A8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022408A8 */ _t1 = _t0 & 0x00000001u;
         /* 022408A8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022408A8 */ goto L_022408AC;
   L_022408AC: ; // 0x22408ac
         /* 022408AC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022408AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022408B0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022408AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022408B0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022408B0 */ _t3 = _t2 & 0x00000001u;
         /* 022408B0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022408B0 */ goto L_022408B4;
@@ -24858,8 +24858,8 @@ void Gambit_fn_022408A4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -24873,15 +24873,15 @@ void Gambit_fn_022408A4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -24909,15 +24909,15 @@ void Gambit_fn_022408B8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_022408B8: ; // 0x22408b8
-        /* 022408B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022408BC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022408B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022408BC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022408BC */ _t1 = _t0 & 0x00000001u;
         /* 022408BC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022408BC */ goto L_022408C0;
   L_022408C0: ; // 0x22408c0
         /* 022408C0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022408C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022408C4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022408C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022408C4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022408C4 */ _t3 = _t2 & 0x00000001u;
         /* 022408C4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022408C4 */ goto L_022408C8;
@@ -24936,8 +24936,8 @@ void Gambit_fn_022408B8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -24951,15 +24951,15 @@ void Gambit_fn_022408B8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -24992,9 +24992,9 @@ void Gambit_fn_022408CC(CPUState* cpu) {
         /* 022408D0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 022408D0 */ cpu->r[11] = _t0;
         /* 022408D4 */ cpu->r[12] = 0x101D0000u;
-        /* 022408D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 022408D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 022408DC */ cpu->r[12] = cpu->r[12] + 0xFFFFD4E4u;
-        /* 022408E0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022408E0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022408E0 */ _t2 = _t1 & 0x00000001u;
         /* 022408E0 */ if (_t2) goto L_022408E4; else goto L_022408F8;
   L_022408E4: ; // 0x22408e4
@@ -25085,8 +25085,8 @@ void Gambit_fn_02240934(CPUState* cpu) {
   L_02240934: ; // 0x2240934
         /* 02240934 */ _t0 = cpu->r[3] + 0x00000008u;
         /* 02240934 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 02240938 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0224093C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02240938 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0224093C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0224093C */ _t2 = _t1 & 0x00000001u;
         /* 0224093C */ if (_t2) goto L_02240948; else goto L_02240940;
   L_02240940: ; // 0x2240940
@@ -25104,8 +25104,8 @@ void Gambit_fn_02240950(CPUState* cpu) {
   L_02240950: ; // 0x2240950
         /* 02240950 */ _t0 = cpu->r[3] + 0x00000008u;
         /* 02240950 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 02240954 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02240958 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02240954 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02240958 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02240958 */ _t2 = _t1 & 0x00000001u;
         /* 02240958 */ if (_t2) goto L_02240964; else goto L_0224095C;
   L_0224095C: ; // 0x224095c
@@ -25124,8 +25124,8 @@ void Gambit_fn_0224096C(CPUState* cpu) {
         /* 0224096C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0224096C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02240970 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02240970 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02240974 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02240970 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02240974 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02240974 */ _t2 = _t1 & 0x00000001u;
         /* 02240974 */ _t3 = _t2 ^ 0x00000001u;
         /* 02240974 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -25147,8 +25147,8 @@ void Gambit_fn_02240988(CPUState* cpu) {
         /* 02240988 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02240988 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0224098C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 0224098C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02240990 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0224098C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02240990 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02240990 */ _t2 = _t1 & 0x00000001u;
         /* 02240990 */ _t3 = _t2 ^ 0x00000001u;
         /* 02240990 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -25170,8 +25170,8 @@ void Gambit_fn_022409A4(CPUState* cpu) {
         /* 022409A4 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 022409A4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 022409A8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Eu, 0x0000001Fu, 0x0000001Fu);
-        /* 022409A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022409AC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022409A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022409AC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022409AC */ _t2 = _t1 & 0x00000001u;
         /* 022409AC */ _t3 = _t2 ^ 0x00000001u;
         /* 022409AC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -25193,8 +25193,8 @@ void Gambit_fn_022409C0(CPUState* cpu) {
         /* 022409C0 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 022409C0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 022409C4 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 022409C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022409C8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022409C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022409C8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022409C8 */ _t2 = _t1 & 0x00000001u;
         /* 022409C8 */ _t3 = _t2 ^ 0x00000001u;
         /* 022409C8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -25216,8 +25216,8 @@ void Gambit_fn_022409DC(CPUState* cpu) {
         /* 022409DC */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 022409DC */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 022409E0 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Cu, 0x0000001Fu, 0x0000001Fu);
-        /* 022409E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022409E4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022409E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022409E4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022409E4 */ _t2 = _t1 & 0x00000001u;
         /* 022409E4 */ _t3 = _t2 ^ 0x00000001u;
         /* 022409E4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -20,8 +20,8 @@ void Gambit_fn_0226B58C(CPUState* cpu) {
         /* 0226B598 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0226B59C */ _t3 = cpu->r[31] + 0x00000208u;
         /* 0226B59C */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 0226B5A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 0226B5A4 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226B5A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 0226B5A4 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226B5A4 */ _t5 = _t4 & 0x00000001u;
         /* 0226B5A4 */ if (_t5) goto L_0226B5A8; else goto L_0226B5B4;
   L_0226B5A8: ; // 0x226b5a8
@@ -44,8 +44,8 @@ void Gambit_fn_0226B58C(CPUState* cpu) {
         /* 0226B5E0 */ Gambit_fn_022586BC(cpu);
         /* 0226B5E4 */ _t7 = cpu->r[31] + 0x00000208u;
         /* 0226B5E4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 0226B5E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000019u);
-        /* 0226B5EC */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226B5E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000019u));
+        /* 0226B5EC */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226B5EC */ _t9 = _t8 & 0x00000001u;
         /* 0226B5EC */ if (_t9) goto L_0226B5F0; else goto L_0226B600;
   L_0226B5F0: ; // 0x226b5f0
@@ -89,10 +89,10 @@ void Gambit_fn_0226B618(CPUState* cpu) {
         /* 0226B638 */ _t6 = cpu->r[1] + 0x0000002Cu;
         /* 0226B638 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 0226B63C */ cpu->r[29] = cpu->r[3];
-        /* 0226B640 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000014u);
+        /* 0226B640 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000014u));
         /* 0226B644 */ _t7 = cpu->r[9] + 0x00005EC4u;
         /* 0226B644 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t7);
-        /* 0226B648 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226B648 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226B648 */ _t9 = _t8 & 0x00000001u;
         /* 0226B648 */ if (_t9) goto L_0226B65C; else goto L_0226B64C;
   L_0226B64C: ; // 0x226b64c
@@ -142,8 +142,8 @@ void Gambit_fn_0226B618(CPUState* cpu) {
         /* 0226B6BC */ cpu->f[11] = cpu->f[11] - cpu->f[9];
         /* 0226B6C0 */ cpu->f[0] = cpu->f[13] * cpu->f[13];
         /* 0226B6C4 */ cpu->f[0] = fma(cpu->f[11], cpu->f[11], cpu->f[0]);
-        /* 0226B6C8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[31]);
-        /* 0226B6CC */ _t24 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0226B6C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[31]));
+        /* 0226B6CC */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0226B6CC */ _t25 = _t24 & 0x00000001u;
         /* 0226B6CC */ if (_t25) goto L_0226B6D0; else goto L_0226B6F4;
   L_0226B6D0: ; // 0x226b6d0
@@ -165,8 +165,8 @@ void Gambit_fn_0226B618(CPUState* cpu) {
         /* 0226B6F8 */ cpu->f[10] = cpu->f[31] * cpu->f[0];
         /* 0226B6FC */ _t30 = cpu->r[10] + 0x00006474u;
         /* 0226B6FC */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t30);
-        /* 0226B700 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
-        /* 0226B704 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226B700 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
+        /* 0226B704 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226B704 */ _t32 = _t31 & 0x00000001u;
         /* 0226B704 */ if (_t32) goto L_0226B708; else goto L_0226B778;
   L_0226B708: ; // 0x226b708
@@ -178,9 +178,9 @@ void Gambit_fn_0226B618(CPUState* cpu) {
         /* 0226B714 */ cpu->r[8] = _t33;
         /* 0226B718 */ cpu->r[4] = 0x101D0000u;
         /* 0226B71C */ cpu->r[31] = cpu->r[3];
-        /* 0226B720 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0226B720 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0226B724 */ cpu->r[4] = cpu->r[4] + 0x0000004Cu;
-        /* 0226B728 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226B728 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226B728 */ _t35 = _t34 & 0x00000001u;
         /* 0226B728 */ if (_t35) goto L_0226B72C; else goto L_0226B740;
   L_0226B72C: ; // 0x226b72c
@@ -192,8 +192,8 @@ void Gambit_fn_0226B618(CPUState* cpu) {
         /* 0226B73C */ _t37 = cpu->r[4] + 0x00000000u;
         /* 0226B73C */ rbrew_write32(cpu->mem, _t37, cpu->r[0]);
   L_0226B740: ; // 0x226b740
-        /* 0226B740 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226B744 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226B740 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226B744 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226B744 */ _t39 = _t38 & 0x00000001u;
         /* 0226B744 */ if (_t39) goto L_0226B764; else goto L_0226B748;
   L_0226B748: ; // 0x226b748
@@ -204,8 +204,8 @@ void Gambit_fn_0226B618(CPUState* cpu) {
         /* 0226B750 */ cpu->ctr = cpu->r[0];
         /* 0226B754 */ cpu->r[3] = cpu->r[31];
         /* 0226B758 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226B75C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226B760 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226B75C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226B760 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226B760 */ _t43 = _t42 & 0x00000001u;
         /* 0226B760 */ if (_t43) goto L_0226B764; else goto L_0226B768;
   L_0226B764: ; // 0x226b764
@@ -233,7 +233,7 @@ void Gambit_fn_0226B618(CPUState* cpu) {
         /* 0226B794 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t50);
         /* 0226B798 */ _t51 = cpu->r[1] + 0x00000014u;
         /* 0226B798 */ cpu->r[31] = rbrew_read32(cpu->mem, _t51);
-        /* 0226B79C */ _t52 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226B79C */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226B79C */ _t53 = _t52 & 0x00000001u;
         /* 0226B79C */ if (_t53) goto L_0226B7A0; // else: addr-0 trap, fall-through
   L_0226B7A0: ; // 0x226b7a0
@@ -280,11 +280,11 @@ void Gambit_fn_0226B7B8(CPUState* cpu) {
         /* 0226B800 */ cpu->r[29] = 0x10050000u;
         /* 0226B804 */ cpu->r[27] = 0x101D0000u;
         /* 0226B808 */ cpu->r[28] = 0x101D0000u;
-        /* 0226B80C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[13]);
+        /* 0226B80C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[13]));
         /* 0226B810 */ cpu->r[29] = cpu->r[29] + 0x00005CA4u;
         /* 0226B814 */ cpu->r[27] = cpu->r[27] + 0x0000004Cu;
         /* 0226B818 */ cpu->r[28] = cpu->r[28] + 0x00000050u;
-        /* 0226B81C */ _t8 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0226B81C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0226B81C */ _t9 = _t8 & 0x00000001u;
         /* 0226B81C */ if (_t9) goto L_0226B820; else goto L_0226B90C;
   L_0226B820: ; // 0x226b820
@@ -313,9 +313,9 @@ void Gambit_fn_0226B7B8(CPUState* cpu) {
         /* 0226B860 */ cpu->f[9] = fma(cpu->f[9], cpu->f[9], cpu->f[11]);
         /* 0226B864 */ _t16 = cpu->r[12] + 0x00005EC4u;
         /* 0226B864 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t16);
-        /* 0226B868 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[0]);
+        /* 0226B868 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[0]));
         /* 0226B86C */ cpu->r[26] = cpu->r[3];
-        /* 0226B870 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0226B870 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0226B870 */ _t18 = _t17 & 0x00000001u;
         /* 0226B870 */ if (_t18) goto L_0226B874; else goto L_0226B898;
   L_0226B874: ; // 0x226b874
@@ -337,8 +337,8 @@ void Gambit_fn_0226B7B8(CPUState* cpu) {
         /* 0226B89C */ cpu->f[0] = cpu->f[0] * cpu->f[9];
         /* 0226B8A0 */ _t23 = cpu->r[9] + 0x00006474u;
         /* 0226B8A0 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t23);
-        /* 0226B8A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[10]);
-        /* 0226B8A8 */ _t24 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226B8A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[10]));
+        /* 0226B8A8 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226B8A8 */ _t25 = _t24 & 0x00000001u;
         /* 0226B8A8 */ if (_t25) goto L_0226B8AC; else goto L_0226B90C;
   L_0226B8AC: ; // 0x226b8ac
@@ -346,9 +346,9 @@ void Gambit_fn_0226B7B8(CPUState* cpu) {
         /* 0226B8B0 */ Gambit_fn_0226ED34(cpu);
         /* 0226B8B4 */ _t26 = cpu->r[28] + 0x00000000u;
         /* 0226B8B4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t26);
-        /* 0226B8B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0226B8B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0226B8BC */ cpu->r[31] = cpu->r[3];
-        /* 0226B8C0 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226B8C0 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226B8C0 */ _t28 = _t27 & 0x00000001u;
         /* 0226B8C0 */ if (_t28) goto L_0226B8C4; else goto L_0226B8D0;
   L_0226B8C4: ; // 0x226b8c4
@@ -358,8 +358,8 @@ void Gambit_fn_0226B7B8(CPUState* cpu) {
         /* 0226B8CC */ _t30 = cpu->r[28] + 0x00000000u;
         /* 0226B8CC */ rbrew_write32(cpu->mem, _t30, cpu->r[0]);
   L_0226B8D0: ; // 0x226b8d0
-        /* 0226B8D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226B8D4 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226B8D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226B8D4 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226B8D4 */ _t32 = _t31 & 0x00000001u;
         /* 0226B8D4 */ if (_t32) goto L_0226B8F8; else goto L_0226B8D8;
   L_0226B8D8: ; // 0x226b8d8
@@ -371,8 +371,8 @@ void Gambit_fn_0226B7B8(CPUState* cpu) {
         /* 0226B8E4 */ cpu->r[3] = cpu->r[31];
         /* 0226B8E8 */ cpu->r[4] = cpu->r[27];
         /* 0226B8EC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226B8F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226B8F4 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226B8F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226B8F4 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226B8F4 */ _t36 = _t35 & 0x00000001u;
         /* 0226B8F4 */ if (_t36) goto L_0226B8F8; else goto L_0226B8FC;
   L_0226B8F8: ; // 0x226b8f8
@@ -388,9 +388,9 @@ void Gambit_fn_0226B7B8(CPUState* cpu) {
         /* 0226B910 */ Gambit_fn_0226ED34(cpu);
         /* 0226B914 */ _t38 = cpu->r[28] + 0x00000000u;
         /* 0226B914 */ cpu->r[10] = rbrew_read32(cpu->mem, _t38);
-        /* 0226B918 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0226B918 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0226B91C */ cpu->r[31] = cpu->r[3];
-        /* 0226B920 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226B920 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226B920 */ _t40 = _t39 & 0x00000001u;
         /* 0226B920 */ if (_t40) goto L_0226B924; else goto L_0226B930;
   L_0226B924: ; // 0x226b924
@@ -400,8 +400,8 @@ void Gambit_fn_0226B7B8(CPUState* cpu) {
         /* 0226B92C */ _t42 = cpu->r[28] + 0x00000000u;
         /* 0226B92C */ rbrew_write32(cpu->mem, _t42, cpu->r[0]);
   L_0226B930: ; // 0x226b930
-        /* 0226B930 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226B934 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226B930 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226B934 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226B934 */ _t44 = _t43 & 0x00000001u;
         /* 0226B934 */ if (_t44) goto L_0226B958; else goto L_0226B938;
   L_0226B938: ; // 0x226b938
@@ -413,8 +413,8 @@ void Gambit_fn_0226B7B8(CPUState* cpu) {
         /* 0226B944 */ cpu->r[3] = cpu->r[31];
         /* 0226B948 */ cpu->r[4] = cpu->r[27];
         /* 0226B94C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226B950 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226B954 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226B950 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226B954 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226B954 */ _t48 = _t47 & 0x00000001u;
         /* 0226B954 */ if (_t48) goto L_0226B958; else goto L_0226B95C;
   L_0226B958: ; // 0x226b958
@@ -424,8 +424,8 @@ void Gambit_fn_0226B7B8(CPUState* cpu) {
         /* 0226B95C */ cpu->r[0] = rbrew_read32(cpu->mem, _t49);
         /* 0226B960 */ _t50 = cpu->r[31] + 0x00004CA4u;
         /* 0226B960 */ cpu->r[8] = rbrew_read32(cpu->mem, _t50);
-        /* 0226B964 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
-        /* 0226B968 */ _t51 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226B964 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
+        /* 0226B968 */ _t51 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226B968 */ _t52 = _t51 & 0x00000001u;
         /* 0226B968 */ if (_t52) goto L_0226B96C; else goto L_0226B9CC;
   L_0226B96C: ; // 0x226b96c
@@ -433,9 +433,9 @@ void Gambit_fn_0226B7B8(CPUState* cpu) {
         /* 0226B970 */ Gambit_fn_0226ED34(cpu);
         /* 0226B974 */ _t53 = cpu->r[28] + 0x00000000u;
         /* 0226B974 */ cpu->r[9] = rbrew_read32(cpu->mem, _t53);
-        /* 0226B978 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0226B978 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0226B97C */ cpu->r[31] = cpu->r[3];
-        /* 0226B980 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226B980 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226B980 */ _t55 = _t54 & 0x00000001u;
         /* 0226B980 */ if (_t55) goto L_0226B984; else goto L_0226B990;
   L_0226B984: ; // 0x226b984
@@ -445,8 +445,8 @@ void Gambit_fn_0226B7B8(CPUState* cpu) {
         /* 0226B98C */ _t57 = cpu->r[28] + 0x00000000u;
         /* 0226B98C */ rbrew_write32(cpu->mem, _t57, cpu->r[0]);
   L_0226B990: ; // 0x226b990
-        /* 0226B990 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226B994 */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226B990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226B994 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226B994 */ _t59 = _t58 & 0x00000001u;
         /* 0226B994 */ if (_t59) goto L_0226B9B8; else goto L_0226B998;
   L_0226B998: ; // 0x226b998
@@ -458,8 +458,8 @@ void Gambit_fn_0226B7B8(CPUState* cpu) {
         /* 0226B9A4 */ cpu->r[3] = cpu->r[31];
         /* 0226B9A8 */ cpu->r[4] = cpu->r[27];
         /* 0226B9AC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226B9B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226B9B4 */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226B9B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226B9B4 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226B9B4 */ _t63 = _t62 & 0x00000001u;
         /* 0226B9B4 */ if (_t63) goto L_0226B9B8; else goto L_0226B9BC;
   L_0226B9B8: ; // 0x226b9b8
@@ -644,10 +644,10 @@ void Gambit_fn_0226BA88(CPUState* cpu) {
         /* 0226BB08 */ _t16 = cpu->r[31] + 0x000004E0u;
         /* 0226BB08 */ cpu->r[3] = rbrew_read32(cpu->mem, _t16);
         /* 0226BB0C */ cpu->r[0] = 0x0000000Fu;
-        /* 0226BB10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0226BB10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0226BB14 */ _t17 = cpu->r[31] + 0x000003B0u;
         /* 0226BB14 */ rbrew_write32(cpu->mem, _t17, cpu->r[0]);
-        /* 0226BB18 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226BB18 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226BB18 */ _t19 = _t18 & 0x00000001u;
         /* 0226BB18 */ if (_t19) goto L_0226BB2C; else goto L_0226BB1C;
   L_0226BB1C: ; // 0x226bb1c
@@ -660,8 +660,8 @@ void Gambit_fn_0226BA88(CPUState* cpu) {
   L_0226BB2C: ; // 0x226bb2c
         /* 0226BB2C */ _t22 = cpu->r[31] + 0x000004E4u;
         /* 0226BB2C */ cpu->r[3] = rbrew_read32(cpu->mem, _t22);
-        /* 0226BB30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226BB34 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226BB30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226BB34 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226BB34 */ _t24 = _t23 & 0x00000001u;
         /* 0226BB34 */ if (_t24) goto L_0226BB48; else goto L_0226BB38;
   L_0226BB38: ; // 0x226bb38
@@ -718,7 +718,7 @@ void Gambit_fn_0226BA88(CPUState* cpu) {
         /* 0226BBAC */ cpu->r[31] = rbrew_read32(cpu->mem, _t44);
         /* 0226BBB0 */ _t45 = cpu->r[1] + 0x00000010u;
         /* 0226BBB0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t45);
-        /* 0226BBB4 */ _t46 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226BBB4 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226BBB4 */ _t47 = _t46 & 0x00000001u;
         /* 0226BBB4 */ if (_t47) goto L_0226BBB8; // else: addr-0 trap, fall-through
   L_0226BBB8: ; // 0x226bbb8
@@ -876,8 +876,8 @@ void Gambit_fn_0226BC20(CPUState* cpu) {
         /* 0226BCBC */ Gambit_fn_0297FC7C(cpu);
         /* 0226BCC0 */ _t20 = cpu->r[29] + 0x0000001Cu;
         /* 0226BCC0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t20);
-        /* 0226BCC4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
-        /* 0226BCC8 */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226BCC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
+        /* 0226BCC8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226BCC8 */ _t22 = _t21 & 0x00000001u;
         /* 0226BCC8 */ if (_t22) goto L_0226BCCC; else goto L_0226BCD8;
   L_0226BCCC: ; // 0x226bccc
@@ -899,8 +899,8 @@ void Gambit_fn_0226BC20(CPUState* cpu) {
         /* 0226BCF0 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0226BCF4 */ _t28 = cpu->r[1] + 0x00000008u;
         /* 0226BCF4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t28);
-        /* 0226BCF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226BCFC */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226BCF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226BCFC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226BCFC */ _t30 = _t29 & 0x00000001u;
         /* 0226BCFC */ if (_t30) goto L_0226BD3C; else goto L_0226BD00;
   L_0226BD00: ; // 0x226bd00
@@ -908,8 +908,8 @@ void Gambit_fn_0226BC20(CPUState* cpu) {
         /* 0226BD00 */ cpu->r[12] = rbrew_read32(cpu->mem, _t31);
         /* 0226BD04 */ _t32 = cpu->r[1] + 0x0000000Cu;
         /* 0226BD04 */ cpu->r[0] = rbrew_read32(cpu->mem, _t32);
-        /* 0226BD08 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
-        /* 0226BD0C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226BD08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
+        /* 0226BD0C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226BD0C */ _t34 = _t33 & 0x00000001u;
         /* 0226BD0C */ if (_t34) goto L_0226BD10; else goto L_0226BD3C;
   L_0226BD10: ; // 0x226bd10
@@ -1013,8 +1013,8 @@ void Gambit_fn_0226BC24(CPUState* cpu) {
         /* 0226BCBC */ Gambit_fn_0297FC7C(cpu);
         /* 0226BCC0 */ _t20 = cpu->r[29] + 0x0000001Cu;
         /* 0226BCC0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t20);
-        /* 0226BCC4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
-        /* 0226BCC8 */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226BCC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
+        /* 0226BCC8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226BCC8 */ _t22 = _t21 & 0x00000001u;
         /* 0226BCC8 */ if (_t22) goto L_0226BCCC; else goto L_0226BCD8;
   L_0226BCCC: ; // 0x226bccc
@@ -1036,8 +1036,8 @@ void Gambit_fn_0226BC24(CPUState* cpu) {
         /* 0226BCF0 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0226BCF4 */ _t28 = cpu->r[1] + 0x00000008u;
         /* 0226BCF4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t28);
-        /* 0226BCF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226BCFC */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226BCF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226BCFC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226BCFC */ _t30 = _t29 & 0x00000001u;
         /* 0226BCFC */ if (_t30) goto L_0226BD3C; else goto L_0226BD00;
   L_0226BD00: ; // 0x226bd00
@@ -1045,8 +1045,8 @@ void Gambit_fn_0226BC24(CPUState* cpu) {
         /* 0226BD00 */ cpu->r[12] = rbrew_read32(cpu->mem, _t31);
         /* 0226BD04 */ _t32 = cpu->r[1] + 0x0000000Cu;
         /* 0226BD04 */ cpu->r[0] = rbrew_read32(cpu->mem, _t32);
-        /* 0226BD08 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[0]);
-        /* 0226BD0C */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226BD08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[0]));
+        /* 0226BD0C */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226BD0C */ _t34 = _t33 & 0x00000001u;
         /* 0226BD0C */ if (_t34) goto L_0226BD10; else goto L_0226BD3C;
   L_0226BD10: ; // 0x226bd10
@@ -1168,9 +1168,9 @@ void Gambit_fn_0226BDB0(CPUState* cpu) {
         /* 0226BDC4 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 0226BDC8 */ _t4 = cpu->r[31] + 0x000004E0u;
         /* 0226BDC8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t4);
-        /* 0226BDCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0226BDCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0226BDD0 */ cpu->r[30] = cpu->r[4];
-        /* 0226BDD4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226BDD4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226BDD4 */ _t6 = _t5 & 0x00000001u;
         /* 0226BDD4 */ if (_t6) goto L_0226BDEC; else goto L_0226BDD8;
   L_0226BDD8: ; // 0x226bdd8
@@ -1184,8 +1184,8 @@ void Gambit_fn_0226BDB0(CPUState* cpu) {
   L_0226BDEC: ; // 0x226bdec
         /* 0226BDEC */ _t9 = cpu->r[31] + 0x000004E4u;
         /* 0226BDEC */ cpu->r[3] = rbrew_read32(cpu->mem, _t9);
-        /* 0226BDF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226BDF4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226BDF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226BDF4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226BDF4 */ _t11 = _t10 & 0x00000001u;
         /* 0226BDF4 */ if (_t11) goto L_0226BE0C; else goto L_0226BDF8;
   L_0226BDF8: ; // 0x226bdf8
@@ -1225,9 +1225,9 @@ void Gambit_fn_0226BDB4(CPUState* cpu) {
         /* 0226BDC4 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 0226BDC8 */ _t4 = cpu->r[31] + 0x000004E0u;
         /* 0226BDC8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t4);
-        /* 0226BDCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0226BDCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0226BDD0 */ cpu->r[30] = cpu->r[4];
-        /* 0226BDD4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226BDD4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226BDD4 */ _t6 = _t5 & 0x00000001u;
         /* 0226BDD4 */ if (_t6) goto L_0226BDEC; else goto L_0226BDD8;
   L_0226BDD8: ; // 0x226bdd8
@@ -1241,8 +1241,8 @@ void Gambit_fn_0226BDB4(CPUState* cpu) {
   L_0226BDEC: ; // 0x226bdec
         /* 0226BDEC */ _t9 = cpu->r[31] + 0x000004E4u;
         /* 0226BDEC */ cpu->r[3] = rbrew_read32(cpu->mem, _t9);
-        /* 0226BDF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226BDF4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226BDF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226BDF4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226BDF4 */ _t11 = _t10 & 0x00000001u;
         /* 0226BDF4 */ if (_t11) goto L_0226BE0C; else goto L_0226BDF8;
   L_0226BDF8: ; // 0x226bdf8
@@ -1320,10 +1320,10 @@ void Gambit_fn_0226BE24(CPUState* cpu) {
         /* 0226BE90 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t17);
         /* 0226BE94 */ _t18 = cpu->r[1] + 0x0000000Cu;
         /* 0226BE94 */ rbrew_write32(cpu->mem, _t18, cpu->r[8]);
-        /* 0226BE98 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[0]);
+        /* 0226BE98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[0]));
         /* 0226BE9C */ _t19 = cpu->r[1] + 0x0000000Cu;
         /* 0226BE9C */ rbrew_write_f32(cpu->mem, _t19, cpu->f[0]);
-        /* 0226BEA0 */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0226BEA0 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0226BEA0 */ _t21 = _t20 & 0x00000001u;
         /* 0226BEA0 */ if (_t21) goto L_0226BEA4; else goto L_0226BEE0;
   L_0226BEA4: ; // 0x226bea4
@@ -1457,8 +1457,8 @@ void Gambit_fn_0226BF30(CPUState* cpu) {
         /* 0226BFBC */ Gambit_fn_021620C4(cpu);
         /* 0226BFC0 */ _t20 = cpu->r[1] + 0x00000008u;
         /* 0226BFC0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t20);
-        /* 0226BFC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226BFC8 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226BFC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226BFC8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226BFC8 */ _t22 = _t21 & 0x00000001u;
         /* 0226BFC8 */ if (_t22) goto L_0226C008; else goto L_0226BFCC;
   L_0226BFCC: ; // 0x226bfcc
@@ -1466,8 +1466,8 @@ void Gambit_fn_0226BF30(CPUState* cpu) {
         /* 0226BFCC */ cpu->r[0] = rbrew_read32(cpu->mem, _t23);
         /* 0226BFD0 */ _t24 = cpu->r[1] + 0x0000000Cu;
         /* 0226BFD0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t24);
-        /* 0226BFD4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[9]);
-        /* 0226BFD8 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226BFD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[9]));
+        /* 0226BFD8 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226BFD8 */ _t26 = _t25 & 0x00000001u;
         /* 0226BFD8 */ if (_t26) goto L_0226BFDC; else goto L_0226C008;
   L_0226BFDC: ; // 0x226bfdc
@@ -1564,8 +1564,8 @@ void Gambit_fn_0226BF3C(CPUState* cpu) {
         /* 0226BFBC */ Gambit_fn_021620C4(cpu);
         /* 0226BFC0 */ _t20 = cpu->r[1] + 0x00000008u;
         /* 0226BFC0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t20);
-        /* 0226BFC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226BFC8 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226BFC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226BFC8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226BFC8 */ _t22 = _t21 & 0x00000001u;
         /* 0226BFC8 */ if (_t22) goto L_0226C008; else goto L_0226BFCC;
   L_0226BFCC: ; // 0x226bfcc
@@ -1573,8 +1573,8 @@ void Gambit_fn_0226BF3C(CPUState* cpu) {
         /* 0226BFCC */ cpu->r[0] = rbrew_read32(cpu->mem, _t23);
         /* 0226BFD0 */ _t24 = cpu->r[1] + 0x0000000Cu;
         /* 0226BFD0 */ cpu->r[9] = rbrew_read32(cpu->mem, _t24);
-        /* 0226BFD4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[9]);
-        /* 0226BFD8 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226BFD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[9]));
+        /* 0226BFD8 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226BFD8 */ _t26 = _t25 & 0x00000001u;
         /* 0226BFD8 */ if (_t26) goto L_0226BFDC; else goto L_0226C008;
   L_0226BFDC: ; // 0x226bfdc
@@ -1630,8 +1630,8 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C044 */ cpu->r[29] = cpu->r[3];
         /* 0226C048 */ _t6 = cpu->r[29] + 0x000003B0u;
         /* 0226C048 */ cpu->r[9] = rbrew_read32(cpu->mem, _t6);
-        /* 0226C04C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000010u);
-        /* 0226C050 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C04C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000010u));
+        /* 0226C050 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C050 */ _t8 = _t7 & 0x00000001u;
         /* 0226C050 */ if (_t8) goto L_0226C054; else goto L_0226C060;
   L_0226C054: ; // 0x226c054
@@ -1644,11 +1644,11 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C064 */ cpu->r[26] = 0x101D0000u;
         /* 0226C068 */ cpu->r[27] = 0x101D0000u;
         /* 0226C06C */ cpu->r[28] = 0x10050000u;
-        /* 0226C070 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000011u);
+        /* 0226C070 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000011u));
         /* 0226C074 */ _t10 = cpu->r[12] + 0x00005EC4u;
         /* 0226C074 */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t10);
         /* 0226C078 */ cpu->r[28] = cpu->r[28] + 0x00005CA4u;
-        /* 0226C07C */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C07C */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C07C */ _t12 = _t11 & 0x00000001u;
         /* 0226C07C */ if (_t12) goto L_0226C080; else goto L_0226C134;
   L_0226C080: ; // 0x226c080
@@ -1673,13 +1673,13 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C0B0 */ cpu->f[10] = rbrew_read_f64(cpu->mem, _t18);
         /* 0226C0B4 */ cpu->f[10] = cpu->f[10] - cpu->f[0];
         /* 0226C0B8 */ cpu->f[13] = (double)(float)cpu->f[10];
-        /* 0226C0BC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[1]);
-        /* 0226C0C0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C0BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[1]));
+        /* 0226C0C0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C0C0 */ _t20 = _t19 & 0x00000001u;
         /* 0226C0C0 */ if (_t20) goto L_0226C0D0; else goto L_0226C0C4;
   L_0226C0C4: ; // 0x226c0c4
-        /* 0226C0C4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
-        /* 0226C0C8 */ _t21 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226C0C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
+        /* 0226C0C8 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226C0C8 */ _t22 = _t21 & 0x00000001u;
         /* 0226C0C8 */ if (_t22) goto L_0226C0CC; else goto L_0226C0D0;
   L_0226C0CC: ; // 0x226c0cc
@@ -1689,9 +1689,9 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C0D4 */ Gambit_fn_0226ED34(cpu);
         /* 0226C0D8 */ _t23 = cpu->r[27] + 0x00000050u;
         /* 0226C0D8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t23);
-        /* 0226C0DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 0226C0DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 0226C0E0 */ cpu->r[31] = cpu->r[3];
-        /* 0226C0E4 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C0E4 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C0E4 */ _t25 = _t24 & 0x00000001u;
         /* 0226C0E4 */ if (_t25) goto L_0226C0E8; else goto L_0226C0F4;
   L_0226C0E8: ; // 0x226c0e8
@@ -1701,8 +1701,8 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C0F0 */ _t27 = cpu->r[27] + 0x00000050u;
         /* 0226C0F0 */ rbrew_write32(cpu->mem, _t27, cpu->r[8]);
   L_0226C0F4: ; // 0x226c0f4
-        /* 0226C0F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226C0F8 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C0F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226C0F8 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C0F8 */ _t29 = _t28 & 0x00000001u;
         /* 0226C0F8 */ if (_t29) goto L_0226C11C; else goto L_0226C0FC;
   L_0226C0FC: ; // 0x226c0fc
@@ -1714,8 +1714,8 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C108 */ cpu->r[3] = cpu->r[31];
         /* 0226C10C */ cpu->r[4] = cpu->r[26] + 0x0000004Cu;
         /* 0226C110 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226C114 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226C118 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C114 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226C118 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C118 */ _t33 = _t32 & 0x00000001u;
         /* 0226C118 */ if (_t33) goto L_0226C11C; else goto L_0226C120;
   L_0226C11C: ; // 0x226c11c
@@ -1723,8 +1723,8 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
   L_0226C120: ; // 0x226c120
         /* 0226C120 */ _t34 = cpu->r[31] + 0x000052A4u;
         /* 0226C120 */ cpu->r[9] = rbrew_read32(cpu->mem, _t34);
-        /* 0226C124 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[9]);
-        /* 0226C128 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C124 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[9]));
+        /* 0226C128 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C128 */ _t36 = _t35 & 0x00000001u;
         /* 0226C128 */ if (_t36) goto L_0226C12C; else goto L_0226C134;
   L_0226C12C: ; // 0x226c12c
@@ -1735,9 +1735,9 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C138 */ Gambit_fn_0226ED34(cpu);
         /* 0226C13C */ _t37 = cpu->r[27] + 0x00000050u;
         /* 0226C13C */ cpu->r[10] = rbrew_read32(cpu->mem, _t37);
-        /* 0226C140 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0226C140 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0226C144 */ cpu->r[31] = cpu->r[3];
-        /* 0226C148 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C148 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C148 */ _t39 = _t38 & 0x00000001u;
         /* 0226C148 */ if (_t39) goto L_0226C14C; else goto L_0226C158;
   L_0226C14C: ; // 0x226c14c
@@ -1747,8 +1747,8 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C154 */ _t41 = cpu->r[27] + 0x00000050u;
         /* 0226C154 */ rbrew_write32(cpu->mem, _t41, cpu->r[0]);
   L_0226C158: ; // 0x226c158
-        /* 0226C158 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226C15C */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226C15C */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C15C */ _t43 = _t42 & 0x00000001u;
         /* 0226C15C */ if (_t43) goto L_0226C180; else goto L_0226C160;
   L_0226C160: ; // 0x226c160
@@ -1760,8 +1760,8 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C16C */ cpu->r[3] = cpu->r[31];
         /* 0226C170 */ cpu->r[4] = cpu->r[26] + 0x0000004Cu;
         /* 0226C174 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226C178 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226C17C */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C178 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226C17C */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C17C */ _t47 = _t46 & 0x00000001u;
         /* 0226C17C */ if (_t47) goto L_0226C180; else goto L_0226C184;
   L_0226C180: ; // 0x226c180
@@ -1771,15 +1771,15 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C184 */ cpu->r[10] = rbrew_read32(cpu->mem, _t48);
         /* 0226C188 */ _t49 = cpu->r[31] + 0x00004FA4u;
         /* 0226C188 */ cpu->r[12] = rbrew_read32(cpu->mem, _t49);
-        /* 0226C18C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[12]);
-        /* 0226C190 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C18C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[12]));
+        /* 0226C190 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C190 */ _t51 = _t50 & 0x00000001u;
         /* 0226C190 */ if (_t51) goto L_0226C194; else goto L_0226C1D0;
   L_0226C194: ; // 0x226c194
         /* 0226C194 */ _t52 = cpu->r[29] + 0x000001D8u;
         /* 0226C194 */ cpu->r[7] = rbrew_read32(cpu->mem, _t52);
-        /* 0226C198 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000001u);
-        /* 0226C19C */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C198 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000001u));
+        /* 0226C19C */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C19C */ _t54 = _t53 & 0x00000001u;
         /* 0226C19C */ if (_t54) goto L_0226C1A0; else goto L_0226C1AC;
   L_0226C1A0: ; // 0x226c1a0
@@ -1793,8 +1793,8 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C1B4 */ Gambit_fn_0226BDB0(cpu);
         /* 0226C1B8 */ _t56 = cpu->r[29] + 0x000001D8u;
         /* 0226C1B8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t56);
-        /* 0226C1BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000001u);
-        /* 0226C1C0 */ _t57 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C1BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000001u));
+        /* 0226C1C0 */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C1C0 */ _t58 = _t57 & 0x00000001u;
         /* 0226C1C0 */ if (_t58) goto L_0226C1C4; else goto L_0226C1D0;
   L_0226C1C4: ; // 0x226c1c4
@@ -1804,16 +1804,16 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
   L_0226C1D0: ; // 0x226c1d0
         /* 0226C1D0 */ _t59 = cpu->r[29] + 0x000003B0u;
         /* 0226C1D0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t59);
-        /* 0226C1D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x0000000Fu);
-        /* 0226C1D8 */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C1D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x0000000Fu));
+        /* 0226C1D8 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C1D8 */ _t61 = _t60 & 0x00000001u;
         /* 0226C1D8 */ if (_t61) goto L_0226C1DC; else goto L_0226C208;
   L_0226C1DC: ; // 0x226c1dc
         /* 0226C1DC */ _t62 = cpu->r[29] + 0x00000094u;
         /* 0226C1DC */ cpu->r[3] = rbrew_read32(cpu->mem, _t62);
         /* 0226C1E0 */ Gambit_fn_02398FA8(cpu);
-        /* 0226C1E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226C1E8 */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C1E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226C1E8 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C1E8 */ _t64 = _t63 & 0x00000001u;
         /* 0226C1E8 */ if (_t64) goto L_0226C208; else goto L_0226C1EC;
   L_0226C1EC: ; // 0x226c1ec
@@ -1822,8 +1822,8 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C1F4 */ Gambit_fn_0225DEE8(cpu);
         /* 0226C1F8 */ _t65 = cpu->r[29] + 0x000003B0u;
         /* 0226C1F8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t65);
-        /* 0226C1FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000011u);
-        /* 0226C200 */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C1FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000011u));
+        /* 0226C200 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C200 */ _t67 = _t66 & 0x00000001u;
         /* 0226C200 */ if (_t67) goto L_0226C204; else goto L_0226C4C0;
   L_0226C204: ; // 0x226c204
@@ -1832,15 +1832,15 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C208 */ _t68 = cpu->r[29] + 0x00000094u;
         /* 0226C208 */ cpu->r[3] = rbrew_read32(cpu->mem, _t68);
         /* 0226C20C */ Gambit_fn_02398FA8(cpu);
-        /* 0226C210 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226C214 */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C210 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226C214 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C214 */ _t70 = _t69 & 0x00000001u;
         /* 0226C214 */ if (_t70) goto L_0226C2D8; else goto L_0226C218;
   L_0226C218: ; // 0x226c218
         /* 0226C218 */ _t71 = cpu->r[29] + 0x000003B0u;
         /* 0226C218 */ cpu->r[6] = rbrew_read32(cpu->mem, _t71);
-        /* 0226C21C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000010u);
-        /* 0226C220 */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C21C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000010u));
+        /* 0226C220 */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C220 */ _t73 = _t72 & 0x00000001u;
         /* 0226C220 */ if (_t73) goto L_0226C224; else goto L_0226C2D8;
   L_0226C224: ; // 0x226c224
@@ -1857,8 +1857,8 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C240 */ Gambit_fn_0226BE24(cpu);
         /* 0226C244 */ _t77 = cpu->r[29] + 0x000004E0u;
         /* 0226C244 */ cpu->r[3] = rbrew_read32(cpu->mem, _t77);
-        /* 0226C248 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226C24C */ _t78 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C248 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226C24C */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C24C */ _t79 = _t78 & 0x00000001u;
         /* 0226C24C */ if (_t79) goto L_0226C268; else goto L_0226C250;
   L_0226C250: ; // 0x226c250
@@ -1905,8 +1905,8 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C2C0 */ cpu->f[12] = rbrew_read_f64(cpu->mem, _t90);
         /* 0226C2C4 */ cpu->f[0] = cpu->f[12] - cpu->f[11];
         /* 0226C2C8 */ cpu->f[12] = (double)(float)cpu->f[0];
-        /* 0226C2CC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[1]);
-        /* 0226C2D0 */ _t91 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C2CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[1]));
+        /* 0226C2D0 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C2D0 */ _t92 = _t91 & 0x00000001u;
         /* 0226C2D0 */ if (_t92) goto L_0226C2D4; else goto L_0226C374;
   L_0226C2D4: ; // 0x226c2d4
@@ -1915,22 +1915,22 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C2D8 */ _t93 = cpu->r[29] + 0x00000094u;
         /* 0226C2D8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t93);
         /* 0226C2DC */ Gambit_fn_02398FA8(cpu);
-        /* 0226C2E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226C2E4 */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C2E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226C2E4 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C2E4 */ _t95 = _t94 & 0x00000001u;
         /* 0226C2E4 */ if (_t95) goto L_0226C324; else goto L_0226C2E8;
   L_0226C2E8: ; // 0x226c2e8
         /* 0226C2E8 */ _t96 = cpu->r[29] + 0x000003B0u;
         /* 0226C2E8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t96);
-        /* 0226C2EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000011u);
-        /* 0226C2F0 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C2EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000011u));
+        /* 0226C2F0 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C2F0 */ _t98 = _t97 & 0x00000001u;
         /* 0226C2F0 */ if (_t98) goto L_0226C2F4; else goto L_0226C4C0;
   L_0226C2F4: ; // 0x226c2f4
         /* 0226C2F4 */ _t99 = cpu->r[29] + 0x000004FBu;
         /* 0226C2F4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t99);
-        /* 0226C2F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226C2FC */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C2F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226C2FC */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C2FC */ _t101 = _t100 & 0x00000001u;
         /* 0226C2FC */ if (_t101) goto L_0226C300; else goto L_0226C330;
   L_0226C300: ; // 0x226c300
@@ -1948,8 +1948,8 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
   L_0226C324: ; // 0x226c324
         /* 0226C324 */ _t104 = cpu->r[29] + 0x000003B0u;
         /* 0226C324 */ cpu->r[8] = rbrew_read32(cpu->mem, _t104);
-        /* 0226C328 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000011u);
-        /* 0226C32C */ _t105 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C328 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000011u));
+        /* 0226C32C */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C32C */ _t106 = _t105 & 0x00000001u;
         /* 0226C32C */ if (_t106) goto L_0226C330; else goto L_0226C4C0;
   L_0226C330: ; // 0x226c330
@@ -1974,13 +1974,13 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C360 */ cpu->f[12] = rbrew_read_f64(cpu->mem, _t112);
         /* 0226C364 */ cpu->f[0] = cpu->f[12] - cpu->f[11];
         /* 0226C368 */ cpu->f[12] = (double)(float)cpu->f[0];
-        /* 0226C36C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[1]);
-        /* 0226C370 */ _t113 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C36C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[1]));
+        /* 0226C370 */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C370 */ _t114 = _t113 & 0x00000001u;
         /* 0226C370 */ if (_t114) goto L_0226C380; else goto L_0226C374;
   L_0226C374: ; // 0x226c374
-        /* 0226C374 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
-        /* 0226C378 */ _t115 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226C374 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
+        /* 0226C378 */ _t115 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226C378 */ _t116 = _t115 & 0x00000001u;
         /* 0226C378 */ if (_t116) goto L_0226C37C; else goto L_0226C380;
   L_0226C37C: ; // 0x226c37c
@@ -1990,9 +1990,9 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C384 */ Gambit_fn_0226ED34(cpu);
         /* 0226C388 */ _t117 = cpu->r[27] + 0x00000050u;
         /* 0226C388 */ cpu->r[12] = rbrew_read32(cpu->mem, _t117);
-        /* 0226C38C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0226C38C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0226C390 */ cpu->r[31] = cpu->r[3];
-        /* 0226C394 */ _t118 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C394 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C394 */ _t119 = _t118 & 0x00000001u;
         /* 0226C394 */ if (_t119) goto L_0226C398; else goto L_0226C3A4;
   L_0226C398: ; // 0x226c398
@@ -2002,8 +2002,8 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C3A0 */ _t121 = cpu->r[27] + 0x00000050u;
         /* 0226C3A0 */ rbrew_write32(cpu->mem, _t121, cpu->r[0]);
   L_0226C3A4: ; // 0x226c3a4
-        /* 0226C3A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226C3A8 */ _t122 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C3A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226C3A8 */ _t122 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C3A8 */ _t123 = _t122 & 0x00000001u;
         /* 0226C3A8 */ if (_t123) goto L_0226C3CC; else goto L_0226C3AC;
   L_0226C3AC: ; // 0x226c3ac
@@ -2015,8 +2015,8 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C3B8 */ cpu->r[3] = cpu->r[31];
         /* 0226C3BC */ cpu->r[4] = cpu->r[26] + 0x0000004Cu;
         /* 0226C3C0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226C3C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226C3C8 */ _t126 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C3C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226C3C8 */ _t126 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C3C8 */ _t127 = _t126 & 0x00000001u;
         /* 0226C3C8 */ if (_t127) goto L_0226C3CC; else goto L_0226C3D0;
   L_0226C3CC: ; // 0x226c3cc
@@ -2025,10 +2025,10 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C3D0 */ _t128 = cpu->r[31] + 0x00005124u;
         /* 0226C3D0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t128);
         /* 0226C3D4 */ cpu->r[12] = 0x10050000u;
-        /* 0226C3D8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[8]);
+        /* 0226C3D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[8]));
         /* 0226C3DC */ _t129 = cpu->r[12] + 0x00006240u;
         /* 0226C3DC */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t129);
-        /* 0226C3E0 */ _t130 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C3E0 */ _t130 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C3E0 */ _t131 = _t130 & 0x00000001u;
         /* 0226C3E0 */ if (_t131) goto L_0226C3E4; else goto L_0226C400;
   L_0226C3E4: ; // 0x226c3e4
@@ -2038,8 +2038,8 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C3EC */ Gambit_fn_02277DB0(cpu);
         /* 0226C3F0 */ _t133 = cpu->r[29] + 0x000004E0u;
         /* 0226C3F0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t133);
-        /* 0226C3F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 0226C3F8 */ _t134 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C3F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 0226C3F8 */ _t134 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C3F8 */ _t135 = _t134 & 0x00000001u;
         /* 0226C3F8 */ if (_t135) goto L_0226C594; else goto L_0226C3FC;
   L_0226C3FC: ; // 0x226c3fc
@@ -2066,13 +2066,13 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C430 */ cpu->f[11] = rbrew_read_f64(cpu->mem, _t141);
         /* 0226C434 */ cpu->f[13] = cpu->f[11] - cpu->f[13];
         /* 0226C438 */ cpu->f[11] = (double)(float)cpu->f[13];
-        /* 0226C43C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[1]);
-        /* 0226C440 */ _t142 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C43C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[1]));
+        /* 0226C440 */ _t142 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C440 */ _t143 = _t142 & 0x00000001u;
         /* 0226C440 */ if (_t143) goto L_0226C450; else goto L_0226C444;
   L_0226C444: ; // 0x226c444
-        /* 0226C444 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
-        /* 0226C448 */ _t144 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226C444 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
+        /* 0226C448 */ _t144 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226C448 */ _t145 = _t144 & 0x00000001u;
         /* 0226C448 */ if (_t145) goto L_0226C44C; else goto L_0226C450;
   L_0226C44C: ; // 0x226c44c
@@ -2082,9 +2082,9 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C454 */ Gambit_fn_0226ED34(cpu);
         /* 0226C458 */ _t146 = cpu->r[27] + 0x00000050u;
         /* 0226C458 */ cpu->r[0] = rbrew_read32(cpu->mem, _t146);
-        /* 0226C45C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0226C45C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0226C460 */ cpu->r[31] = cpu->r[3];
-        /* 0226C464 */ _t147 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C464 */ _t147 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C464 */ _t148 = _t147 & 0x00000001u;
         /* 0226C464 */ if (_t148) goto L_0226C468; else goto L_0226C474;
   L_0226C468: ; // 0x226c468
@@ -2094,8 +2094,8 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C470 */ _t150 = cpu->r[27] + 0x00000050u;
         /* 0226C470 */ rbrew_write32(cpu->mem, _t150, cpu->r[7]);
   L_0226C474: ; // 0x226c474
-        /* 0226C474 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226C478 */ _t151 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C474 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226C478 */ _t151 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C478 */ _t152 = _t151 & 0x00000001u;
         /* 0226C478 */ if (_t152) goto L_0226C49C; else goto L_0226C47C;
   L_0226C47C: ; // 0x226c47c
@@ -2107,8 +2107,8 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C488 */ cpu->r[3] = cpu->r[31];
         /* 0226C48C */ cpu->r[4] = cpu->r[26] + 0x0000004Cu;
         /* 0226C490 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226C494 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226C498 */ _t155 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C494 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226C498 */ _t155 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C498 */ _t156 = _t155 & 0x00000001u;
         /* 0226C498 */ if (_t156) goto L_0226C49C; else goto L_0226C4A0;
   L_0226C49C: ; // 0x226c49c
@@ -2119,8 +2119,8 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C4A4 */ _t158 = cpu->r[29] + 0x000003F0u;
         /* 0226C4A4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t158);
         /* 0226C4A8 */ cpu->r[12] = cpu->r[6] - cpu->r[7];
-        /* 0226C4AC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[12]);
-        /* 0226C4B0 */ _t159 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C4AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[12]));
+        /* 0226C4B0 */ _t159 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C4B0 */ _t160 = _t159 & 0x00000001u;
         /* 0226C4B0 */ if (_t160) goto L_0226C4B4; else goto L_0226C4C0;
   L_0226C4B4: ; // 0x226c4b4
@@ -2131,8 +2131,8 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
   L_0226C4C0: ; // 0x226c4c0
         /* 0226C4C0 */ _t162 = cpu->r[29] + 0x000004E0u;
         /* 0226C4C0 */ cpu->r[8] = rbrew_read32(cpu->mem, _t162);
-        /* 0226C4C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 0226C4C8 */ _t163 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C4C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 0226C4C8 */ _t163 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C4C8 */ _t164 = _t163 & 0x00000001u;
         /* 0226C4C8 */ if (_t164) goto L_0226C594; else goto L_0226C4CC;
   L_0226C4CC: ; // 0x226c4cc
@@ -2157,13 +2157,13 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C4FC */ cpu->f[10] = rbrew_read_f64(cpu->mem, _t170);
         /* 0226C500 */ cpu->f[11] = cpu->f[10] - cpu->f[12];
         /* 0226C504 */ cpu->f[0] = (double)(float)cpu->f[11];
-        /* 0226C508 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[0], cpu->f[1]);
-        /* 0226C50C */ _t171 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C508 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[0], cpu->f[1]));
+        /* 0226C50C */ _t171 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C50C */ _t172 = _t171 & 0x00000001u;
         /* 0226C50C */ if (_t172) goto L_0226C51C; else goto L_0226C510;
   L_0226C510: ; // 0x226c510
-        /* 0226C510 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[1], cpu->f[30]);
-        /* 0226C514 */ _t173 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226C510 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[1], cpu->f[30]));
+        /* 0226C514 */ _t173 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226C514 */ _t174 = _t173 & 0x00000001u;
         /* 0226C514 */ if (_t174) goto L_0226C518; else goto L_0226C51C;
   L_0226C518: ; // 0x226c518
@@ -2173,9 +2173,9 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C520 */ Gambit_fn_0226ED34(cpu);
         /* 0226C524 */ _t175 = cpu->r[27] + 0x00000050u;
         /* 0226C524 */ cpu->r[9] = rbrew_read32(cpu->mem, _t175);
-        /* 0226C528 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0226C528 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0226C52C */ cpu->r[31] = cpu->r[3];
-        /* 0226C530 */ _t176 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C530 */ _t176 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C530 */ _t177 = _t176 & 0x00000001u;
         /* 0226C530 */ if (_t177) goto L_0226C534; else goto L_0226C540;
   L_0226C534: ; // 0x226c534
@@ -2185,8 +2185,8 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C53C */ _t179 = cpu->r[27] + 0x00000050u;
         /* 0226C53C */ rbrew_write32(cpu->mem, _t179, cpu->r[0]);
   L_0226C540: ; // 0x226c540
-        /* 0226C540 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226C544 */ _t180 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C540 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226C544 */ _t180 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C544 */ _t181 = _t180 & 0x00000001u;
         /* 0226C544 */ if (_t181) goto L_0226C568; else goto L_0226C548;
   L_0226C548: ; // 0x226c548
@@ -2198,8 +2198,8 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C554 */ cpu->r[3] = cpu->r[31];
         /* 0226C558 */ cpu->r[4] = cpu->r[26] + 0x0000004Cu;
         /* 0226C55C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226C560 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226C564 */ _t184 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C560 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226C564 */ _t184 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C564 */ _t185 = _t184 & 0x00000001u;
         /* 0226C564 */ if (_t185) goto L_0226C568; else goto L_0226C56C;
   L_0226C568: ; // 0x226c568
@@ -2207,8 +2207,8 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
   L_0226C56C: ; // 0x226c56c
         /* 0226C56C */ _t186 = cpu->r[31] + 0x00005004u;
         /* 0226C56C */ cpu->r[0] = rbrew_read32(cpu->mem, _t186);
-        /* 0226C570 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[0]);
-        /* 0226C574 */ _t187 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C570 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[0]));
+        /* 0226C574 */ _t187 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C574 */ _t188 = _t187 & 0x00000001u;
         /* 0226C574 */ if (_t188) goto L_0226C578; else goto L_0226C594;
   L_0226C578: ; // 0x226c578
@@ -2232,7 +2232,7 @@ void Gambit_fn_0226C01C(CPUState* cpu) {
         /* 0226C5A0 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t194);
         /* 0226C5A4 */ _t195 = cpu->r[1] + 0x00000038u;
         /* 0226C5A4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t195);
-        /* 0226C5A8 */ _t196 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226C5A8 */ _t196 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226C5A8 */ _t197 = _t196 & 0x00000001u;
         /* 0226C5A8 */ if (_t197) goto L_0226C5AC; // else: addr-0 trap, fall-through
   L_0226C5AC: ; // 0x226c5ac
@@ -2315,8 +2315,8 @@ void Gambit_fn_0226C5C0(CPUState* cpu) {
         /* 0226C664 */ Gambit_fn_0226BDB0(cpu);
         /* 0226C668 */ _t20 = cpu->r[31] + 0x000004E0u;
         /* 0226C668 */ cpu->r[3] = rbrew_read32(cpu->mem, _t20);
-        /* 0226C66C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226C670 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C66C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226C670 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C670 */ _t22 = _t21 & 0x00000001u;
         /* 0226C670 */ if (_t22) goto L_0226C6A4; else goto L_0226C674;
   L_0226C674: ; // 0x226c674
@@ -2328,8 +2328,8 @@ void Gambit_fn_0226C5C0(CPUState* cpu) {
         /* 0226C680 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0226C684 */ _t25 = cpu->r[31] + 0x000004FDu;
         /* 0226C684 */ cpu->r[0] = rbrew_read8(cpu->mem, _t25);
-        /* 0226C688 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226C68C */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C688 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226C68C */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C68C */ _t27 = _t26 & 0x00000001u;
         /* 0226C68C */ if (_t27) goto L_0226C690; else goto L_0226C6A4;
   L_0226C690: ; // 0x226c690
@@ -2374,10 +2374,10 @@ void Gambit_fn_0226C5C0(CPUState* cpu) {
         /* 0226C6EC */ _t41 = cpu->r[1] + 0x0000000Cu;
         /* 0226C6EC */ rbrew_write_f32(cpu->mem, _t41, cpu->f[0]);
         /* 0226C6F0 */ cpu->f[11] = fma(cpu->f[9], cpu->f[9], cpu->f[7]);
-        /* 0226C6F4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[11], cpu->f[0]);
+        /* 0226C6F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[11], cpu->f[0]));
         /* 0226C6F8 */ _t42 = cpu->r[1] + 0x00000010u;
         /* 0226C6F8 */ rbrew_write_f32(cpu->mem, _t42, cpu->f[8]);
-        /* 0226C6FC */ _t43 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0226C6FC */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0226C6FC */ _t44 = _t43 & 0x00000001u;
         /* 0226C6FC */ if (_t44) goto L_0226C700; else goto L_0226C73C;
   L_0226C700: ; // 0x226c700
@@ -2457,9 +2457,9 @@ void Gambit_fn_0226C788(CPUState* cpu) {
         /* 0226C7B4 */ cpu->r[6] = _t4;
         /* 0226C7B8 */ cpu->r[31] = cpu->r[3];
         /* 0226C7BC */ cpu->r[4] = 0x101D0000u;
-        /* 0226C7C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0226C7C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0226C7C4 */ cpu->r[4] = cpu->r[4] + 0x0000004Cu;
-        /* 0226C7C8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C7C8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C7C8 */ _t6 = _t5 & 0x00000001u;
         /* 0226C7C8 */ if (_t6) goto L_0226C7CC; else goto L_0226C7E0;
   L_0226C7CC: ; // 0x226c7cc
@@ -2471,8 +2471,8 @@ void Gambit_fn_0226C788(CPUState* cpu) {
         /* 0226C7DC */ _t8 = cpu->r[4] + 0x00000000u;
         /* 0226C7DC */ rbrew_write32(cpu->mem, _t8, cpu->r[10]);
   L_0226C7E0: ; // 0x226c7e0
-        /* 0226C7E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226C7E4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C7E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226C7E4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C7E4 */ _t10 = _t9 & 0x00000001u;
         /* 0226C7E4 */ if (_t10) goto L_0226C804; else goto L_0226C7E8;
   L_0226C7E8: ; // 0x226c7e8
@@ -2483,8 +2483,8 @@ void Gambit_fn_0226C788(CPUState* cpu) {
         /* 0226C7F0 */ cpu->ctr = cpu->r[0];
         /* 0226C7F4 */ cpu->r[3] = cpu->r[31];
         /* 0226C7F8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226C7FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226C800 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C7FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226C800 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C800 */ _t14 = _t13 & 0x00000001u;
         /* 0226C800 */ if (_t14) goto L_0226C804; else goto L_0226C808;
   L_0226C804: ; // 0x226c804
@@ -2555,8 +2555,8 @@ void Gambit_fn_0226C788(CPUState* cpu) {
         /* 0226C8A4 */ Gambit_fn_023EEED0(cpu);
         /* 0226C8A8 */ _t37 = cpu->r[30] + 0x000004E0u;
         /* 0226C8A8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t37);
-        /* 0226C8AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226C8B0 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226C8AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226C8B0 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226C8B0 */ _t39 = _t38 & 0x00000001u;
         /* 0226C8B0 */ if (_t39) goto L_0226C974; else goto L_0226C8B4;
   L_0226C8B4: ; // 0x226c8b4
@@ -2734,8 +2734,8 @@ void Gambit_fn_0226C98C(CPUState* cpu) {
         /* 0226CA44 */ Gambit_fn_02276860(cpu);
         /* 0226CA48 */ _t37 = cpu->r[31] + 0x000004E0u;
         /* 0226CA48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t37);
-        /* 0226CA4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226CA50 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CA4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226CA50 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CA50 */ _t39 = _t38 & 0x00000001u;
         /* 0226CA50 */ if (_t39) goto L_0226CA78; else goto L_0226CA54;
   L_0226CA54: ; // 0x226ca54
@@ -2789,7 +2789,7 @@ void Gambit_fn_0226C98C(CPUState* cpu) {
         /* 0226CABC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t59);
         /* 0226CAC0 */ _t60 = cpu->r[1] + 0x0000003Cu;
         /* 0226CAC0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t60);
-        /* 0226CAC4 */ _t61 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226CAC4 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226CAC4 */ _t62 = _t61 & 0x00000001u;
         /* 0226CAC4 */ if (_t62) goto L_0226CAC8; // else: addr-0 trap, fall-through
   L_0226CAC8: ; // 0x226cac8
@@ -2882,15 +2882,15 @@ void Gambit_fn_0226CB18(CPUState* cpu) {
         /* 0226CB2C */ _t3 = cpu->r[31] + 0x0000020Cu;
         /* 0226CB2C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0226CB30 */ /* nop */
-        /* 0226CB34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000012u);
-        /* 0226CB38 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CB34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000012u));
+        /* 0226CB38 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CB38 */ _t5 = _t4 & 0x00000001u;
         /* 0226CB38 */ if (_t5) goto L_0226CB3C; else goto L_0226CB64;
   L_0226CB3C: ; // 0x226cb3c
         /* 0226CB3C */ _t6 = cpu->r[31] + 0x00000208u;
         /* 0226CB3C */ cpu->r[11] = rbrew_read32(cpu->mem, _t6);
-        /* 0226CB40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000019u);
-        /* 0226CB44 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226CB40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000019u));
+        /* 0226CB44 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226CB44 */ _t8 = _t7 & 0x00000001u;
         /* 0226CB44 */ if (_t8) goto L_0226CB64; else goto L_0226CB48;
   L_0226CB48: ; // 0x226cb48
@@ -2931,15 +2931,15 @@ void Gambit_fn_0226CB1C(CPUState* cpu) {
         /* 0226CB2C */ _t3 = cpu->r[31] + 0x0000020Cu;
         /* 0226CB2C */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0226CB30 */ /* nop */
-        /* 0226CB34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000012u);
-        /* 0226CB38 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CB34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000012u));
+        /* 0226CB38 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CB38 */ _t5 = _t4 & 0x00000001u;
         /* 0226CB38 */ if (_t5) goto L_0226CB3C; else goto L_0226CB64;
   L_0226CB3C: ; // 0x226cb3c
         /* 0226CB3C */ _t6 = cpu->r[31] + 0x00000208u;
         /* 0226CB3C */ cpu->r[11] = rbrew_read32(cpu->mem, _t6);
-        /* 0226CB40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000019u);
-        /* 0226CB44 */ _t7 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226CB40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000019u));
+        /* 0226CB44 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226CB44 */ _t8 = _t7 & 0x00000001u;
         /* 0226CB44 */ if (_t8) goto L_0226CB64; else goto L_0226CB48;
   L_0226CB48: ; // 0x226cb48
@@ -2972,8 +2972,8 @@ void Gambit_fn_0226CB78(CPUState* cpu) {
         /* 0226CB78 */ _t0 = cpu->r[3] + 0x0000020Cu;
         /* 0226CB78 */ cpu->r[12] = rbrew_read8(cpu->mem, _t0);
         /* 0226CB7C */ /* nop */
-        /* 0226CB80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000016u);
-        /* 0226CB84 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CB80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000016u));
+        /* 0226CB84 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CB84 */ _t2 = _t1 & 0x00000001u;
         /* 0226CB84 */ if (_t2) goto L_0226CB88; else goto L_0226CB8C;
   L_0226CB88: ; // 0x226cb88
@@ -3005,8 +3005,8 @@ void Gambit_fn_0226CB78(CPUState* cpu) {
         /* 0227699C */ Gambit_fn_0224D2C8(cpu);
         /* 022769A0 */ _t11 = cpu->r[31] + 0x000001C8u;
         /* 022769A0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t11);
-        /* 022769A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022769A8 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022769A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022769A8 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022769A8 */ _t13 = _t12 & 0x00000001u;
         /* 022769A8 */ if (_t13) goto L_022769B0; else goto L_022769AC;
   L_022769AC: ; // 0x22769ac
@@ -3017,15 +3017,15 @@ void Gambit_fn_0226CB78(CPUState* cpu) {
         /* 022769B4 */ Gambit_fn_02277CC4(cpu);
         /* 022769B8 */ _t15 = cpu->r[31] + 0x000001D4u;
         /* 022769B8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t15);
-        /* 022769BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000004u);
-        /* 022769C0 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022769BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000004u));
+        /* 022769C0 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022769C0 */ _t17 = _t16 & 0x00000001u;
         /* 022769C0 */ if (_t17) goto L_022769C4; else goto L_022769D8;
   L_022769C4: ; // 0x22769c4
         /* 022769C4 */ _t18 = cpu->r[31] + 0x000001F8u;
         /* 022769C4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t18);
-        /* 022769C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022769CC */ _t19 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022769C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022769CC */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022769CC */ _t20 = _t19 & 0x00000001u;
         /* 022769CC */ if (_t20) goto L_022769D0; else goto L_022769D8;
   L_022769D0: ; // 0x22769d0
@@ -3069,9 +3069,9 @@ void Gambit_fn_0226CB98(CPUState* cpu) {
         /* 0205868C */ _t6 = cpu->r[10] + 0xFFFFAD08u;
         /* 0205868C */ cpu->r[10] = rbrew_read32(cpu->mem, _t6);
         /* 02058690 */ cpu->r[26] = cpu->r[3];
-        /* 02058694 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02058694 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02058698 */ cpu->r[27] = 0x00000000u;
-        /* 0205869C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0205869C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0205869C */ _t8 = _t7 & 0x00000001u;
         /* 0205869C */ if (_t8) goto L_020586B8; else goto L_020586A0;
   L_020586A0: ; // 0x20586a0
@@ -3079,8 +3079,8 @@ void Gambit_fn_0226CB98(CPUState* cpu) {
         /* 020586A4 */ cpu->r[25] = cpu->r[25] + 0xFFFFAA24u;
         /* 020586A8 */ _t9 = cpu->r[25] + 0x00000054u;
         /* 020586A8 */ cpu->r[8] = rbrew_read32(cpu->mem, _t9);
-        /* 020586AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 020586B0 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020586AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 020586B0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020586B0 */ _t11 = _t10 & 0x00000001u;
         /* 020586B0 */ if (_t11) goto L_020586B4; else goto L_0205880C;
   L_020586B4: ; // 0x20586b4
@@ -3110,8 +3110,8 @@ void Gambit_fn_0226CB98(CPUState* cpu) {
         /* 02058708 */ Gambit_fn_02C83090(cpu);
         /* 0205870C */ _t13 = cpu->r[25] + 0x00000054u;
         /* 0205870C */ cpu->r[8] = rbrew_read32(cpu->mem, _t13);
-        /* 02058710 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 02058714 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02058710 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 02058714 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02058714 */ _t15 = _t14 & 0x00000001u;
         /* 02058714 */ if (_t15) goto L_02058718; else goto L_0205880C;
   L_02058718: ; // 0x2058718
@@ -3127,9 +3127,9 @@ void Gambit_fn_0226CB98(CPUState* cpu) {
   L_0205873C: ; // 0x205873c
         /* 0205873C */ _t16 = cpu->r[21] + 0xFFFFDAB4u;
         /* 0205873C */ cpu->r[9] = rbrew_read32(cpu->mem, _t16);
-        /* 02058740 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02058740 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02058744 */ cpu->r[31] = cpu->r[30];
-        /* 02058748 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02058748 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02058748 */ _t18 = _t17 & 0x00000001u;
         /* 02058748 */ if (_t18) goto L_0205874C; else goto L_02058764;
   L_0205874C: ; // 0x205874c
@@ -3143,8 +3143,8 @@ void Gambit_fn_0226CB98(CPUState* cpu) {
   L_02058764: ; // 0x2058764
         /* 02058764 */ _t20 = cpu->r[19] + 0xFFFFDAB0u;
         /* 02058764 */ cpu->r[10] = rbrew_read32(cpu->mem, _t20);
-        /* 02058768 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0205876C */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02058768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0205876C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0205876C */ _t22 = _t21 & 0x00000001u;
         /* 0205876C */ if (_t22) goto L_02058770; else goto L_02058778;
   L_02058770: ; // 0x2058770
@@ -3153,8 +3153,8 @@ void Gambit_fn_0226CB98(CPUState* cpu) {
         /* 02058774 */ _t24 = cpu->r[19] + 0xFFFFDAB0u;
         /* 02058774 */ rbrew_write32(cpu->mem, _t24, cpu->r[20]);
   L_02058778: ; // 0x2058778
-        /* 02058778 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000002u);
-        /* 0205877C */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02058778 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000002u));
+        /* 0205877C */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0205877C */ _t26 = _t25 & 0x00000001u;
         /* 0205877C */ if (_t26) goto L_020587A4; else goto L_02058780;
   L_02058780: ; // 0x2058780
@@ -3163,12 +3163,12 @@ void Gambit_fn_0226CB98(CPUState* cpu) {
         /* 02058788 */ cpu->r[5] = 0x00000000u;
         /* 0205878C */ Gambit_fn_028A6634(cpu);
         /* 02058790 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02058794 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000002u);
-        /* 02058798 */ _t27 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02058794 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000002u));
+        /* 02058798 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02058798 */ _t28 = _t27 & 0x00000001u;
         /* 02058798 */ if (_t28) goto L_0205880C; else goto L_0205879C;
   L_0205879C: ; // 0x205879c
-        /* 0205879C */ _t29 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0205879C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0205879C */ _t30 = _t29 & 0x00000001u;
         /* 0205879C */ if (_t30) goto L_0205873C; else goto L_020587A0;
   L_020587A0: ; // 0x20587a0
@@ -3176,8 +3176,8 @@ void Gambit_fn_0226CB98(CPUState* cpu) {
   L_020587A4: ; // 0x20587a4
         /* 020587A4 */ _t31 = cpu->r[18] + 0xFFFFE6B4u;
         /* 020587A4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t31);
-        /* 020587A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020587AC */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020587A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020587AC */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020587AC */ _t33 = _t32 & 0x00000001u;
         /* 020587AC */ if (_t33) goto L_020587B0; else goto L_020587E8;
   L_020587B0: ; // 0x20587b0
@@ -3186,8 +3186,8 @@ void Gambit_fn_0226CB98(CPUState* cpu) {
         /* 020587B8 */ Gambit_fn_02836FFC(cpu);
         /* 020587BC */ _t34 = cpu->r[18] + 0xFFFFE6B4u;
         /* 020587BC */ cpu->r[0] = rbrew_read32(cpu->mem, _t34);
-        /* 020587C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020587C4 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020587C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020587C4 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020587C4 */ _t36 = _t35 & 0x00000001u;
         /* 020587C4 */ if (_t36) goto L_020587C8; else goto L_020587DC;
   L_020587C8: ; // 0x20587c8
@@ -3210,12 +3210,12 @@ void Gambit_fn_0226CB98(CPUState* cpu) {
         /* 020587F4 */ cpu->r[4] = cpu->r[31];
         /* 020587F8 */ Gambit_fn_028A6634(cpu);
         /* 020587FC */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 02058800 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000002u);
-        /* 02058804 */ _t40 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02058800 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000002u));
+        /* 02058804 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02058804 */ _t41 = _t40 & 0x00000001u;
         /* 02058804 */ if (_t41) goto L_0205880C; else goto L_02058808;
   L_02058808: ; // 0x2058808
-        /* 02058808 */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02058808 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02058808 */ _t43 = _t42 & 0x00000001u;
         /* 02058808 */ if (_t43) goto L_0205873C; else goto L_0205880C;
   L_0205880C: ; // 0x205880c
@@ -3235,10 +3235,10 @@ void Gambit_fn_0226CB98(CPUState* cpu) {
         /* 02058838 */ cpu->r[24] = cpu->r[24] + 0x0000630Cu;
         /* 0205883C */ _t46 = cpu->r[6] + 0x0000639Cu;
         /* 0205883C */ cpu->f[30] = rbrew_read_f32(cpu->mem, _t46);
-        /* 02058840 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02058840 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02058844 */ cpu->r[29] = 0x10110000u;
         /* 02058848 */ cpu->r[25] = cpu->r[25] + 0x000062F4u;
-        /* 0205884C */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0205884C */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0205884C */ _t48 = _t47 & 0x00000001u;
         /* 0205884C */ if (_t48) goto L_02058880; else goto L_02058850;
   L_02058850: ; // 0x2058850
@@ -3251,9 +3251,9 @@ void Gambit_fn_0226CB98(CPUState* cpu) {
         /* 02058868 */ _t49 = cpu->r[11] + 0xFFFFAD10u;
         /* 02058868 */ cpu->r[11] = rbrew_read32(cpu->mem, _t49);
         /* 0205886C */ cpu->r[30] = cpu->r[30] + 0xFFFFAAF0u;
-        /* 02058870 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02058870 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02058874 */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 02058878 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02058878 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02058878 */ _t51 = _t50 & 0x00000001u;
         /* 02058878 */ if (_t51) goto L_0205887C; else goto L_02058994;
   L_0205887C: ; // 0x205887c
@@ -3292,23 +3292,23 @@ void Gambit_fn_0226CB98(CPUState* cpu) {
         /* 020588D4 */ _t61 = cpu->r[10] + 0x00000000u;
         /* 020588D4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t61);
         /* 020588D8 */ cpu->r[30] = 0x00000000u;
-        /* 020588DC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
+        /* 020588DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
         /* 020588E0 */ cpu->r[12] = 0x00080000u;
-        /* 020588E4 */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020588E4 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020588E4 */ _t63 = _t62 & 0x00000001u;
         /* 020588E4 */ if (_t63) goto L_0205890C; else goto L_020588E8;
   L_020588E8: ; // 0x20588e8
         /* 020588E8 */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 020588EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[12]);
+        /* 020588EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[12]));
         /* 020588F0 */ cpu->r[10] = cpu->r[10] + 0x00000001u;
-        /* 020588F4 */ _t64 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020588F4 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020588F4 */ _t65 = _t64 & 0x00000001u;
         /* 020588F4 */ if (_t65) goto L_02058908; else goto L_020588F8;
   L_020588F8: ; // 0x20588f8
         /* 020588F8 */ _t66 = cpu->r[10] + 0x00000000u;
         /* 020588F8 */ cpu->r[0] = rbrew_read8(cpu->mem, _t66);
-        /* 020588FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 02058900 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020588FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 02058900 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02058900 */ _t68 = _t67 & 0x00000001u;
         /* 02058900 */ if (_t68) goto L_02058904; else goto L_020588E8;
   L_02058904: ; // 0x2058904
@@ -3320,10 +3320,10 @@ void Gambit_fn_0226CB98(CPUState* cpu) {
         /* 0205890C */ cpu->r[12] = rbrew_read32(cpu->mem, _t69);
         /* 02058910 */ _t70 = cpu->r[1] + 0x0000000Cu;
         /* 02058910 */ cpu->r[7] = rbrew_read32(cpu->mem, _t70);
-        /* 02058914 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[12]);
+        /* 02058914 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[12]));
         /* 02058918 */ _t71 = cpu->r[7] + 0x00000014u;
         /* 02058918 */ cpu->r[0] = rbrew_read32(cpu->mem, _t71);
-        /* 0205891C */ _t72 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0205891C */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0205891C */ _t73 = _t72 & 0x00000001u;
         /* 0205891C */ if (_t73) goto L_02058924; else goto L_02058920;
   L_02058920: ; // 0x2058920
@@ -3362,9 +3362,9 @@ void Gambit_fn_0226CB98(CPUState* cpu) {
         /* 02058980 */ _t81 = cpu->r[11] + 0xFFFFAD10u;
         /* 02058980 */ cpu->r[11] = rbrew_read32(cpu->mem, _t81);
         /* 02058984 */ cpu->r[30] = cpu->r[30] + 0xFFFFAAF0u;
-        /* 02058988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02058988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0205898C */ cpu->r[26] = cpu->r[26] + 0x00000001u;
-        /* 02058990 */ _t82 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02058990 */ _t82 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02058990 */ _t83 = _t82 & 0x00000001u;
         /* 02058990 */ if (_t83) goto L_020589A8; else goto L_02058994;
   L_02058994: ; // 0x2058994
@@ -3405,23 +3405,23 @@ void Gambit_fn_0226CB98(CPUState* cpu) {
         /* 020589F4 */ _t93 = cpu->r[6] + 0x00000000u;
         /* 020589F4 */ cpu->r[7] = rbrew_read8(cpu->mem, _t93);
         /* 020589F8 */ cpu->r[29] = 0x00000000u;
-        /* 020589FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[31]);
+        /* 020589FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[31]));
         /* 02058A00 */ cpu->r[7] = 0x00080000u;
-        /* 02058A04 */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02058A04 */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02058A04 */ _t95 = _t94 & 0x00000001u;
         /* 02058A04 */ if (_t95) goto L_02058A2C; else goto L_02058A08;
   L_02058A08: ; // 0x2058a08
         /* 02058A08 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 02058A0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[7]);
+        /* 02058A0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[7]));
         /* 02058A10 */ cpu->r[6] = cpu->r[6] + 0x00000001u;
-        /* 02058A14 */ _t96 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02058A14 */ _t96 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02058A14 */ _t97 = _t96 & 0x00000001u;
         /* 02058A14 */ if (_t97) goto L_02058A28; else goto L_02058A18;
   L_02058A18: ; // 0x2058a18
         /* 02058A18 */ _t98 = cpu->r[6] + 0x00000000u;
         /* 02058A18 */ cpu->r[0] = rbrew_read8(cpu->mem, _t98);
-        /* 02058A1C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[31]);
-        /* 02058A20 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02058A1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[31]));
+        /* 02058A20 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02058A20 */ _t100 = _t99 & 0x00000001u;
         /* 02058A20 */ if (_t100) goto L_02058A24; else goto L_02058A08;
   L_02058A24: ; // 0x2058a24
@@ -3431,8 +3431,8 @@ void Gambit_fn_0226CB98(CPUState* cpu) {
   L_02058A2C: ; // 0x2058a2c
         /* 02058A2C */ _t101 = cpu->r[30] + 0x00000008u;
         /* 02058A2C */ cpu->r[6] = rbrew_read32(cpu->mem, _t101);
-        /* 02058A30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], cpu->r[6]);
-        /* 02058A34 */ _t102 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02058A30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], cpu->r[6]));
+        /* 02058A34 */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02058A34 */ _t103 = _t102 & 0x00000001u;
         /* 02058A34 */ if (_t103) goto L_02058A3C; else goto L_02058A38;
   L_02058A38: ; // 0x2058a38
@@ -3481,7 +3481,7 @@ void Gambit_fn_0226CB98(CPUState* cpu) {
         /* 02058AA8 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t115);
         /* 02058AAC */ _t116 = cpu->r[1] + 0x00000060u;
         /* 02058AAC */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t116);
-        /* 02058AB0 */ _t117 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02058AB0 */ _t117 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02058AB0 */ _t118 = _t117 & 0x00000001u;
         /* 02058AB0 */ if (_t118) goto L_02058AB4; // else: addr-0 trap, fall-through
   L_02058AB4: ; // 0x2058ab4
@@ -3782,15 +3782,15 @@ void Gambit_fn_0226CCFC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0226CCFC: ; // 0x226ccfc
-        /* 0226CCFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226CD00 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CCFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226CD00 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CD00 */ _t1 = _t0 & 0x00000001u;
         /* 0226CD00 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226CD00 */ goto L_0226CD04;
   L_0226CD04: ; // 0x226cd04
         /* 0226CD04 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0226CD04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226CD08 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CD04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226CD08 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CD08 */ _t3 = _t2 & 0x00000001u;
         /* 0226CD08 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226CD08 */ goto L_0226CD0C;
@@ -3809,8 +3809,8 @@ void Gambit_fn_0226CCFC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -3824,15 +3824,15 @@ void Gambit_fn_0226CCFC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -3867,17 +3867,17 @@ void Gambit_fn_0226CD10(CPUState* cpu) {
         /* 0226CD18 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0226CD18 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0226CD1C */ cpu->r[31] = cpu->r[4];
-        /* 0226CD20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0226CD20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0226CD24 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0226CD24 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0226CD28 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CD28 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CD28 */ _t4 = _t3 & 0x00000001u;
         /* 0226CD28 */ if (_t4) goto L_0226CD2C; else goto L_0226CD3C;
   L_0226CD2C: ; // 0x226cd2c
         /* 0226CD2C */ cpu->r[3] = 0x00000008u;
         /* 0226CD30 */ Gambit_fn_02801A78(cpu);
-        /* 0226CD34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226CD38 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CD34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226CD38 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CD38 */ _t6 = _t5 & 0x00000001u;
         /* 0226CD38 */ if (_t6) goto L_0226CD4C; else goto L_0226CD3C;
   L_0226CD3C: ; // 0x226cd3c
@@ -3908,17 +3908,17 @@ void Gambit_fn_0226CD14(CPUState* cpu) {
         /* 0226CD18 */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0226CD18 */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 0226CD1C */ cpu->r[31] = cpu->r[4];
-        /* 0226CD20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0226CD20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0226CD24 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 0226CD24 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 0226CD28 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CD28 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CD28 */ _t4 = _t3 & 0x00000001u;
         /* 0226CD28 */ if (_t4) goto L_0226CD2C; else goto L_0226CD3C;
   L_0226CD2C: ; // 0x226cd2c
         /* 0226CD2C */ cpu->r[3] = 0x00000008u;
         /* 0226CD30 */ Gambit_fn_02801A78(cpu);
-        /* 0226CD34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226CD38 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CD34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226CD38 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CD38 */ _t6 = _t5 & 0x00000001u;
         /* 0226CD38 */ if (_t6) goto L_0226CD4C; else goto L_0226CD3C;
   L_0226CD3C: ; // 0x226cd3c
@@ -3949,15 +3949,15 @@ void Gambit_fn_0226CD64(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0226CD64: ; // 0x226cd64
-        /* 0226CD64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226CD68 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CD64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226CD68 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CD68 */ _t1 = _t0 & 0x00000001u;
         /* 0226CD68 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226CD68 */ goto L_0226CD6C;
   L_0226CD6C: ; // 0x226cd6c
         /* 0226CD6C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0226CD6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226CD70 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CD6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226CD70 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CD70 */ _t3 = _t2 & 0x00000001u;
         /* 0226CD70 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226CD70 */ goto L_0226CD74;
@@ -3976,8 +3976,8 @@ void Gambit_fn_0226CD64(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -3991,15 +3991,15 @@ void Gambit_fn_0226CD64(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4036,12 +4036,12 @@ void Gambit_fn_0226CD78(CPUState* cpu) {
         /* 0226CD84 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 0226CD88 */ cpu->r[29] = cpu->r[4];
         /* 0226CD8C */ cpu->r[30] = cpu->r[5];
-        /* 0226CD8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0226CD8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0226CD90 */ cpu->r[28] = cpu->r[3];
         /* 0226CD94 */ cpu->r[31] = 0x10110000u;
         /* 0226CD98 */ _t2 = cpu->r[28] + 0x00000000u;
         /* 0226CD98 */ cpu->r[27] = rbrew_read32(cpu->mem, _t2);
-        /* 0226CD9C */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226CD9C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226CD9C */ _t4 = _t3 & 0x00000001u;
         /* 0226CD9C */ if (_t4) goto L_0226CDBC; else goto L_0226CDA0;
   L_0226CDA0: ; // 0x226cda0
@@ -4051,10 +4051,10 @@ void Gambit_fn_0226CD78(CPUState* cpu) {
         /* 0226CDA4 */ cpu->r[5] = rbrew_read32(cpu->mem, _t6);
         /* 0226CDA8 */ _t7 = cpu->r[31] + 0x00007399u;
         /* 0226CDA8 */ cpu->r[31] = rbrew_read8(cpu->mem, _t7);
-        /* 0226CDAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[9]);
+        /* 0226CDAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[9]));
         /* 0226CDB0 */ _t8 = cpu->r[5] + 0x00000014u;
         /* 0226CDB0 */ cpu->r[6] = rbrew_read32(cpu->mem, _t8);
-        /* 0226CDB4 */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226CDB4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226CDB4 */ _t10 = _t9 & 0x00000001u;
         /* 0226CDB4 */ if (_t10) goto L_0226CE28; else goto L_0226CDB8;
   L_0226CDB8: ; // 0x226cdb8
@@ -4074,23 +4074,23 @@ void Gambit_fn_0226CD78(CPUState* cpu) {
         /* 0226CDD8 */ _t15 = cpu->r[7] + 0x00000000u;
         /* 0226CDD8 */ cpu->r[10] = rbrew_read8(cpu->mem, _t15);
         /* 0226CDDC */ cpu->r[30] = 0x00000000u;
-        /* 0226CDE0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], cpu->r[31]);
+        /* 0226CDE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], cpu->r[31]));
         /* 0226CDE4 */ cpu->r[0] = 0x00080000u;
-        /* 0226CDE8 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CDE8 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CDE8 */ _t17 = _t16 & 0x00000001u;
         /* 0226CDE8 */ if (_t17) goto L_0226CE10; else goto L_0226CDEC;
   L_0226CDEC: ; // 0x226cdec
         /* 0226CDEC */ cpu->r[30] = cpu->r[30] + 0x00000001u;
-        /* 0226CDF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[0]);
+        /* 0226CDF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[0]));
         /* 0226CDF4 */ cpu->r[7] = cpu->r[7] + 0x00000001u;
-        /* 0226CDF8 */ _t18 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0226CDF8 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0226CDF8 */ _t19 = _t18 & 0x00000001u;
         /* 0226CDF8 */ if (_t19) goto L_0226CE0C; else goto L_0226CDFC;
   L_0226CDFC: ; // 0x226cdfc
         /* 0226CDFC */ _t20 = cpu->r[7] + 0x00000000u;
         /* 0226CDFC */ cpu->r[12] = rbrew_read8(cpu->mem, _t20);
-        /* 0226CE00 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[12], cpu->r[31]);
-        /* 0226CE04 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CE00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[12], cpu->r[31]));
+        /* 0226CE04 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CE04 */ _t22 = _t21 & 0x00000001u;
         /* 0226CE04 */ if (_t22) goto L_0226CE08; else goto L_0226CDEC;
   L_0226CE08: ; // 0x226ce08
@@ -4102,10 +4102,10 @@ void Gambit_fn_0226CD78(CPUState* cpu) {
         /* 0226CE10 */ cpu->r[9] = rbrew_read32(cpu->mem, _t23);
         /* 0226CE14 */ _t24 = cpu->r[29] + 0x00000004u;
         /* 0226CE14 */ cpu->r[5] = rbrew_read32(cpu->mem, _t24);
-        /* 0226CE18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], cpu->r[9]);
+        /* 0226CE18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], cpu->r[9]));
         /* 0226CE1C */ _t25 = cpu->r[5] + 0x00000014u;
         /* 0226CE1C */ cpu->r[6] = rbrew_read32(cpu->mem, _t25);
-        /* 0226CE20 */ _t26 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226CE20 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226CE20 */ _t27 = _t26 & 0x00000001u;
         /* 0226CE20 */ if (_t27) goto L_0226CE28; else goto L_0226CE24;
   L_0226CE24: ; // 0x226ce24
@@ -4155,12 +4155,12 @@ void Gambit_fn_0226CE80(CPUState* cpu) {
 
   L_0226CE80: ; // 0x226ce80
         /* 0226CE80 */ cpu->r[0] = 0x00000001u;
-        /* 0226CE84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0226CE84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0226CE88 */ /* nop */
         /* 0226CE8C */ _t0 = cpu->r[3] + 0x00000000u;
         /* 0226CE8C */ cpu->r[11] = rbrew_read8(cpu->mem, _t0);
         /* 0226CE90 */ cpu->r[0] = rbrew_rlwinm(cpu->r[12], 0x00000000u, 0x00000018u, 0x0000001Fu);
-        /* 0226CE94 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CE94 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CE94 */ _t2 = _t1 & 0x00000001u;
         /* 0226CE94 */ if (_t2) goto L_0226CEA4; else goto L_0226CE98;
   L_0226CE98: ; // 0x226ce98
@@ -4181,15 +4181,15 @@ void Gambit_fn_0226CEB0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0226CEB0: ; // 0x226ceb0
-        /* 0226CEB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226CEB4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CEB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226CEB4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CEB4 */ _t1 = _t0 & 0x00000001u;
         /* 0226CEB4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226CEB4 */ goto L_0226CEB8;
   L_0226CEB8: ; // 0x226ceb8
         /* 0226CEB8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0226CEB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226CEBC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CEB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226CEBC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CEBC */ _t3 = _t2 & 0x00000001u;
         /* 0226CEBC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226CEBC */ goto L_0226CEC0;
@@ -4208,8 +4208,8 @@ void Gambit_fn_0226CEB0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4223,15 +4223,15 @@ void Gambit_fn_0226CEB0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4259,15 +4259,15 @@ void Gambit_fn_0226CEC4(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0226CEC4: ; // 0x226cec4
-        /* 0226CEC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226CEC8 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CEC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226CEC8 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CEC8 */ _t1 = _t0 & 0x00000001u;
         /* 0226CEC8 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226CEC8 */ goto L_0226CECC;
   L_0226CECC: ; // 0x226cecc
         /* 0226CECC */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0226CECC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226CED0 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CECC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226CED0 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CED0 */ _t3 = _t2 & 0x00000001u;
         /* 0226CED0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226CED0 */ goto L_0226CED4;
@@ -4286,8 +4286,8 @@ void Gambit_fn_0226CEC4(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4301,15 +4301,15 @@ void Gambit_fn_0226CEC4(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4337,15 +4337,15 @@ void Gambit_fn_0226CED8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0226CED8: ; // 0x226ced8
-        /* 0226CED8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226CEDC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CED8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226CEDC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CEDC */ _t1 = _t0 & 0x00000001u;
         /* 0226CEDC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226CEDC */ goto L_0226CEE0;
   L_0226CEE0: ; // 0x226cee0
         /* 0226CEE0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0226CEE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226CEE4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CEE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226CEE4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CEE4 */ _t3 = _t2 & 0x00000001u;
         /* 0226CEE4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226CEE4 */ goto L_0226CEE8;
@@ -4364,8 +4364,8 @@ void Gambit_fn_0226CED8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4379,15 +4379,15 @@ void Gambit_fn_0226CED8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4415,15 +4415,15 @@ void Gambit_fn_0226CEEC(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0226CEEC: ; // 0x226ceec
-        /* 0226CEEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226CEF0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CEEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226CEF0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CEF0 */ _t1 = _t0 & 0x00000001u;
         /* 0226CEF0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226CEF0 */ goto L_0226CEF4;
   L_0226CEF4: ; // 0x226cef4
         /* 0226CEF4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0226CEF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226CEF8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CEF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226CEF8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CEF8 */ _t3 = _t2 & 0x00000001u;
         /* 0226CEF8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226CEF8 */ goto L_0226CEFC;
@@ -4442,8 +4442,8 @@ void Gambit_fn_0226CEEC(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4457,15 +4457,15 @@ void Gambit_fn_0226CEEC(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4523,7 +4523,7 @@ void Gambit_fn_0226CF00(CPUState* cpu) {
         /* 0226CF34 */ rbrew_write32(cpu->mem, _t12, cpu->r[4]);
         /* 0226CF38 */ _t13 = cpu->r[1] + 0x00000028u;
         /* 0226CF38 */ rbrew_write32(cpu->mem, _t13, cpu->r[7]);
-        /* 0226CF3C */ _t14 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0226CF3C */ _t14 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0226CF3C */ _t15 = _t14 & 0x00000001u;
         /* 0226CF3C */ if (_t15) goto L_0226CF40; else goto L_0226CF60;
   L_0226CF40: ; // 0x226cf40
@@ -4545,45 +4545,45 @@ void Gambit_fn_0226CF00(CPUState* cpu) {
         /* 0226CF5C */ rbrew_write_f64(cpu->mem, _t23, cpu->f[1]);
   L_0226CF60: ; // 0x226cf60
         /* 0226CF60 */ cpu->r[31] = cpu->r[3];
-        /* 0226CF60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0226CF60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0226CF64 */ cpu->r[30] = cpu->r[4];
-        /* 0226CF68 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CF68 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CF68 */ _t25 = _t24 & 0x00000001u;
         /* 0226CF68 */ if (_t25) goto L_0226CF6C; else goto L_0226CF7C;
   L_0226CF6C: ; // 0x226cf6c
         /* 0226CF6C */ cpu->r[3] = 0x0000008Cu;
         /* 0226CF70 */ Gambit_fn_02801A78(cpu);
         /* 0226CF74 */ cpu->r[31] = cpu->r[3];
-        /* 0226CF74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226CF78 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CF74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226CF78 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CF78 */ _t27 = _t26 & 0x00000001u;
         /* 0226CF78 */ if (_t27) goto L_0226D040; else goto L_0226CF7C;
   L_0226CF7C: ; // 0x226cf7c
         /* 0226CF7C */ cpu->r[29] = cpu->r[31];
-        /* 0226CF7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0226CF80 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CF7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0226CF80 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CF80 */ _t29 = _t28 & 0x00000001u;
         /* 0226CF80 */ if (_t29) goto L_0226CF84; else goto L_0226CF94;
   L_0226CF84: ; // 0x226cf84
         /* 0226CF84 */ cpu->r[3] = 0x0000008Cu;
         /* 0226CF88 */ Gambit_fn_02801A78(cpu);
         /* 0226CF8C */ cpu->r[29] = cpu->r[3];
-        /* 0226CF8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0226CF90 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CF8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0226CF90 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CF90 */ _t31 = _t30 & 0x00000001u;
         /* 0226CF90 */ if (_t31) goto L_0226D004; else goto L_0226CF94;
   L_0226CF94: ; // 0x226cf94
         /* 0226CF94 */ cpu->r[3] = cpu->r[29];
-        /* 0226CF94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0226CF94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0226CF98 */ cpu->r[28] = 0x10110000u;
-        /* 0226CF9C */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CF9C */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CF9C */ _t33 = _t32 & 0x00000001u;
         /* 0226CF9C */ if (_t33) goto L_0226CFA0; else goto L_0226CFCC;
   L_0226CFA0: ; // 0x226cfa0
         /* 0226CFA0 */ cpu->r[3] = 0x0000000Cu;
         /* 0226CFA4 */ Gambit_fn_02801A78(cpu);
-        /* 0226CFA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226CFAC */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CFA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226CFAC */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CFAC */ _t35 = _t34 & 0x00000001u;
         /* 0226CFAC */ if (_t35) goto L_0226CFB0; else goto L_0226CFCC;
   L_0226CFB0: ; // 0x226cfb0
@@ -4693,7 +4693,7 @@ void Gambit_fn_0226CF04(CPUState* cpu) {
         /* 0226CF34 */ rbrew_write32(cpu->mem, _t12, cpu->r[4]);
         /* 0226CF38 */ _t13 = cpu->r[1] + 0x00000028u;
         /* 0226CF38 */ rbrew_write32(cpu->mem, _t13, cpu->r[7]);
-        /* 0226CF3C */ _t14 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 0226CF3C */ _t14 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 0226CF3C */ _t15 = _t14 & 0x00000001u;
         /* 0226CF3C */ if (_t15) goto L_0226CF40; else goto L_0226CF60;
   L_0226CF40: ; // 0x226cf40
@@ -4715,45 +4715,45 @@ void Gambit_fn_0226CF04(CPUState* cpu) {
         /* 0226CF5C */ rbrew_write_f64(cpu->mem, _t23, cpu->f[1]);
   L_0226CF60: ; // 0x226cf60
         /* 0226CF60 */ cpu->r[31] = cpu->r[3];
-        /* 0226CF60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0226CF60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0226CF64 */ cpu->r[30] = cpu->r[4];
-        /* 0226CF68 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CF68 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CF68 */ _t25 = _t24 & 0x00000001u;
         /* 0226CF68 */ if (_t25) goto L_0226CF6C; else goto L_0226CF7C;
   L_0226CF6C: ; // 0x226cf6c
         /* 0226CF6C */ cpu->r[3] = 0x0000008Cu;
         /* 0226CF70 */ Gambit_fn_02801A78(cpu);
         /* 0226CF74 */ cpu->r[31] = cpu->r[3];
-        /* 0226CF74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226CF78 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CF74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226CF78 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CF78 */ _t27 = _t26 & 0x00000001u;
         /* 0226CF78 */ if (_t27) goto L_0226D040; else goto L_0226CF7C;
   L_0226CF7C: ; // 0x226cf7c
         /* 0226CF7C */ cpu->r[29] = cpu->r[31];
-        /* 0226CF7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0226CF80 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CF7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0226CF80 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CF80 */ _t29 = _t28 & 0x00000001u;
         /* 0226CF80 */ if (_t29) goto L_0226CF84; else goto L_0226CF94;
   L_0226CF84: ; // 0x226cf84
         /* 0226CF84 */ cpu->r[3] = 0x0000008Cu;
         /* 0226CF88 */ Gambit_fn_02801A78(cpu);
         /* 0226CF8C */ cpu->r[29] = cpu->r[3];
-        /* 0226CF8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0226CF90 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CF8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0226CF90 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CF90 */ _t31 = _t30 & 0x00000001u;
         /* 0226CF90 */ if (_t31) goto L_0226D004; else goto L_0226CF94;
   L_0226CF94: ; // 0x226cf94
         /* 0226CF94 */ cpu->r[3] = cpu->r[29];
-        /* 0226CF94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0226CF94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0226CF98 */ cpu->r[28] = 0x10110000u;
-        /* 0226CF9C */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CF9C */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CF9C */ _t33 = _t32 & 0x00000001u;
         /* 0226CF9C */ if (_t33) goto L_0226CFA0; else goto L_0226CFCC;
   L_0226CFA0: ; // 0x226cfa0
         /* 0226CFA0 */ cpu->r[3] = 0x0000000Cu;
         /* 0226CFA4 */ Gambit_fn_02801A78(cpu);
-        /* 0226CFA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226CFAC */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226CFA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226CFAC */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226CFAC */ _t35 = _t34 & 0x00000001u;
         /* 0226CFAC */ if (_t35) goto L_0226CFB0; else goto L_0226CFCC;
   L_0226CFB0: ; // 0x226cfb0
@@ -4834,15 +4834,15 @@ void Gambit_fn_0226D064(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0226D064: ; // 0x226d064
-        /* 0226D064 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226D068 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D064 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226D068 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D068 */ _t1 = _t0 & 0x00000001u;
         /* 0226D068 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226D068 */ goto L_0226D06C;
   L_0226D06C: ; // 0x226d06c
         /* 0226D06C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0226D06C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226D070 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D06C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226D070 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D070 */ _t3 = _t2 & 0x00000001u;
         /* 0226D070 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226D070 */ goto L_0226D074;
@@ -4861,8 +4861,8 @@ void Gambit_fn_0226D064(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4876,15 +4876,15 @@ void Gambit_fn_0226D064(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -4912,15 +4912,15 @@ void Gambit_fn_0226D078(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0226D078: ; // 0x226d078
-        /* 0226D078 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226D07C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D078 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226D07C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D07C */ _t1 = _t0 & 0x00000001u;
         /* 0226D07C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226D07C */ goto L_0226D080;
   L_0226D080: ; // 0x226d080
         /* 0226D080 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0226D080 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226D084 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D080 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226D084 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D084 */ _t3 = _t2 & 0x00000001u;
         /* 0226D084 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226D084 */ goto L_0226D088;
@@ -4939,8 +4939,8 @@ void Gambit_fn_0226D078(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -4954,15 +4954,15 @@ void Gambit_fn_0226D078(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -5113,15 +5113,15 @@ void Gambit_fn_0226D120(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0226D120: ; // 0x226d120
-        /* 0226D120 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226D124 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D120 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226D124 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D124 */ _t1 = _t0 & 0x00000001u;
         /* 0226D124 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226D124 */ goto L_0226D128;
   L_0226D128: ; // 0x226d128
         /* 0226D128 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0226D128 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226D12C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D128 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226D12C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D12C */ _t3 = _t2 & 0x00000001u;
         /* 0226D12C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226D12C */ goto L_0226D130;
@@ -5140,8 +5140,8 @@ void Gambit_fn_0226D120(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -5155,15 +5155,15 @@ void Gambit_fn_0226D120(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -5241,8 +5241,8 @@ void Gambit_fn_0226D154(CPUState* cpu) {
   L_0226D154: ; // 0x226d154
         /* 0226D154 */ _t0 = cpu->r[3] + 0x00000008u;
         /* 0226D154 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 0226D158 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0226D15C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0226D15C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D15C */ _t2 = _t1 & 0x00000001u;
         /* 0226D15C */ if (_t2) goto L_0226D168; else goto L_0226D160;
   L_0226D160: ; // 0x226d160
@@ -5260,8 +5260,8 @@ void Gambit_fn_0226D170(CPUState* cpu) {
   L_0226D170: ; // 0x226d170
         /* 0226D170 */ _t0 = cpu->r[3] + 0x00000008u;
         /* 0226D170 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 0226D174 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0226D178 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D174 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0226D178 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D178 */ _t2 = _t1 & 0x00000001u;
         /* 0226D178 */ if (_t2) goto L_0226D184; else goto L_0226D17C;
   L_0226D17C: ; // 0x226d17c
@@ -5280,8 +5280,8 @@ void Gambit_fn_0226D18C(CPUState* cpu) {
         /* 0226D18C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0226D18C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0226D190 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 0226D190 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0226D194 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D190 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0226D194 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D194 */ _t2 = _t1 & 0x00000001u;
         /* 0226D194 */ _t3 = _t2 ^ 0x00000001u;
         /* 0226D194 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -5303,8 +5303,8 @@ void Gambit_fn_0226D1A8(CPUState* cpu) {
         /* 0226D1A8 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0226D1A8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0226D1AC */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 0226D1AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0226D1B0 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D1AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0226D1B0 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D1B0 */ _t2 = _t1 & 0x00000001u;
         /* 0226D1B0 */ _t3 = _t2 ^ 0x00000001u;
         /* 0226D1B0 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -5326,8 +5326,8 @@ void Gambit_fn_0226D1C4(CPUState* cpu) {
         /* 0226D1C4 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0226D1C4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0226D1C8 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 0226D1C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0226D1CC */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D1C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0226D1CC */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D1CC */ _t2 = _t1 & 0x00000001u;
         /* 0226D1CC */ _t3 = _t2 ^ 0x00000001u;
         /* 0226D1CC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -5370,8 +5370,8 @@ void Gambit_fn_0226D1F0(CPUState* cpu) {
         /* 0226D200 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0226D204 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0226D204 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0226D208 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0226D20C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0226D20C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D20C */ _t5 = _t4 & 0x00000001u;
         /* 0226D20C */ if (_t5) goto L_0226D210; else goto L_0226D22C;
   L_0226D210: ; // 0x226d210
@@ -5410,8 +5410,8 @@ void Gambit_fn_0226D1F4(CPUState* cpu) {
         /* 0226D200 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0226D204 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0226D204 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 0226D208 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 0226D20C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 0226D20C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D20C */ _t5 = _t4 & 0x00000001u;
         /* 0226D20C */ if (_t5) goto L_0226D210; else goto L_0226D22C;
   L_0226D210: ; // 0x226d210
@@ -5444,8 +5444,8 @@ void Gambit_fn_0226D240(CPUState* cpu) {
         /* 0226D240 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0226D244 */ _t1 = cpu->r[3] + 0x00000004u;
         /* 0226D244 */ cpu->r[3] = rbrew_read32(cpu->mem, _t1);
-        /* 0226D248 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[0]);
-        /* 0226D24C */ _t2 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226D248 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[0]));
+        /* 0226D24C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226D24C */ _t3 = _t2 & 0x00000001u;
         /* 0226D24C */ _t4 = _t3 ^ 0x00000001u;
         /* 0226D24C */ if (_t4) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -5491,22 +5491,22 @@ void Gambit_fn_0226D274(CPUState* cpu) {
         /* 0226D28C */ cpu->r[26] = cpu->r[5];
         /* 0226D290 */ cpu->r[25] = cpu->r[4];
         /* 0226D294 */ cpu->r[31] = cpu->r[3];
-        /* 0226D294 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0226D294 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0226D298 */ _t1 = cpu->r[1] + 0x00000034u;
         /* 0226D298 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 0226D29C */ cpu->r[29] = cpu->r[8];
         /* 0226D2A0 */ cpu->r[23] = cpu->r[10];
         /* 0226D2A4 */ _t2 = cpu->r[1] + 0x00000038u;
         /* 0226D2A4 */ cpu->r[24] = rbrew_read32(cpu->mem, _t2);
-        /* 0226D2A8 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D2A8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D2A8 */ _t4 = _t3 & 0x00000001u;
         /* 0226D2A8 */ if (_t4) goto L_0226D2AC; else goto L_0226D2BC;
   L_0226D2AC: ; // 0x226d2ac
         /* 0226D2AC */ cpu->r[3] = 0x00000060u;
         /* 0226D2B0 */ Gambit_fn_02801A78(cpu);
         /* 0226D2B4 */ cpu->r[31] = cpu->r[3];
-        /* 0226D2B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226D2B8 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D2B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226D2B8 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D2B8 */ _t6 = _t5 & 0x00000001u;
         /* 0226D2B8 */ if (_t6) goto L_0226D2F0; else goto L_0226D2BC;
   L_0226D2BC: ; // 0x226d2bc
@@ -5553,7 +5553,7 @@ void Gambit_fn_0226D308(CPUState* cpu) {
         /* 0226D31C */ cpu->r[28] = cpu->r[4];
         /* 0226D320 */ cpu->r[0] = cpu->lr;
         /* 0226D324 */ cpu->r[31] = cpu->r[3];
-        /* 0226D324 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0226D324 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0226D328 */ cpu->r[27] = cpu->r[8];
         /* 0226D32C */ /* nop */
         /* 0226D330 */ _t2 = cpu->r[1] + 0x00000038u;
@@ -5574,15 +5574,15 @@ void Gambit_fn_0226D308(CPUState* cpu) {
         /* 0226D358 */ _t7 = cpu->r[1] + 0x00000054u;
         /* 0226D358 */ rbrew_write32(cpu->mem, _t7, cpu->r[0]);
         /* 0226D35C */ cpu->r[29] = cpu->r[5];
-        /* 0226D360 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D360 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D360 */ _t9 = _t8 & 0x00000001u;
         /* 0226D360 */ if (_t9) goto L_0226D364; else goto L_0226D374;
   L_0226D364: ; // 0x226d364
         /* 0226D364 */ cpu->r[3] = 0x00000060u;
         /* 0226D368 */ Gambit_fn_02801A78(cpu);
         /* 0226D36C */ cpu->r[31] = cpu->r[3];
-        /* 0226D36C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226D370 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D36C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226D370 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D370 */ _t11 = _t10 & 0x00000001u;
         /* 0226D370 */ if (_t11) goto L_0226D3A8; else goto L_0226D374;
   L_0226D374: ; // 0x226d374
@@ -5618,7 +5618,7 @@ void Gambit_fn_0226D308(CPUState* cpu) {
         /* 0226D3C0 */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t20);
         /* 0226D3C4 */ _t21 = cpu->r[1] + 0x00000040u;
         /* 0226D3C4 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t21);
-        /* 0226D3C8 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226D3C8 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226D3C8 */ _t23 = _t22 & 0x00000001u;
         /* 0226D3C8 */ if (_t23) goto L_0226D3CC; // else: addr-0 trap, fall-through
   L_0226D3CC: ; // 0x226d3cc
@@ -5640,7 +5640,7 @@ void Gambit_fn_0226D3DC(CPUState* cpu) {
         /* 0226D3E0 */ cpu->r[0] = cpu->lr;
         /* 0226D3E4 */ /* nop */
         /* 0226D3E8 */ cpu->r[31] = cpu->r[3];
-        /* 0226D3E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0226D3E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0226D3EC */ cpu->r[25] = cpu->r[4];
         /* 0226D3F0 */ cpu->r[26] = cpu->r[5];
         /* 0226D3F4 */ cpu->r[27] = cpu->r[6];
@@ -5649,15 +5649,15 @@ void Gambit_fn_0226D3DC(CPUState* cpu) {
         /* 0226D400 */ _t1 = cpu->r[1] + 0x0000002Cu;
         /* 0226D400 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 0226D404 */ cpu->r[29] = cpu->r[8];
-        /* 0226D408 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D408 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D408 */ _t3 = _t2 & 0x00000001u;
         /* 0226D408 */ if (_t3) goto L_0226D40C; else goto L_0226D41C;
   L_0226D40C: ; // 0x226d40c
         /* 0226D40C */ cpu->r[3] = 0x00000058u;
         /* 0226D410 */ Gambit_fn_02801A78(cpu);
         /* 0226D414 */ cpu->r[31] = cpu->r[3];
-        /* 0226D414 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226D418 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D414 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226D418 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D418 */ _t5 = _t4 & 0x00000001u;
         /* 0226D418 */ if (_t5) goto L_0226D44C; else goto L_0226D41C;
   L_0226D41C: ; // 0x226d41c
@@ -5728,7 +5728,7 @@ void Gambit_fn_0226D468(CPUState* cpu) {
         /* 0226D46C */ cpu->r[0] = cpu->lr;
         /* 0226D470 */ /* nop */
         /* 0226D474 */ cpu->r[31] = cpu->r[3];
-        /* 0226D474 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0226D474 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0226D478 */ cpu->r[27] = cpu->r[4];
         /* 0226D47C */ cpu->r[28] = cpu->r[5];
         /* 0226D480 */ cpu->r[30] = cpu->r[7];
@@ -5736,15 +5736,15 @@ void Gambit_fn_0226D468(CPUState* cpu) {
         /* 0226D488 */ _t1 = cpu->r[1] + 0x00000024u;
         /* 0226D488 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 0226D48C */ cpu->r[29] = cpu->r[6];
-        /* 0226D490 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D490 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D490 */ _t3 = _t2 & 0x00000001u;
         /* 0226D490 */ if (_t3) goto L_0226D494; else goto L_0226D4A4;
   L_0226D494: ; // 0x226d494
         /* 0226D494 */ cpu->r[3] = 0x00000064u;
         /* 0226D498 */ Gambit_fn_02801A78(cpu);
         /* 0226D49C */ cpu->r[31] = cpu->r[3];
-        /* 0226D49C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226D4A0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D49C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226D4A0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D4A0 */ _t5 = _t4 & 0x00000001u;
         /* 0226D4A0 */ if (_t5) goto L_0226D50C; else goto L_0226D4A4;
   L_0226D4A4: ; // 0x226d4a4
@@ -5758,17 +5758,17 @@ void Gambit_fn_0226D468(CPUState* cpu) {
         /* 0226D4C0 */ cpu->r[0] = 0x10050000u;
         /* 0226D4C4 */ cpu->r[0] = cpu->r[0] + 0x00005E54u;
         /* 0226D4C8 */ cpu->r[3] = cpu->r[31] + 0x00000054u;
-        /* 0226D4C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0226D4C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0226D4CC */ _t6 = cpu->r[31] + 0x00000000u;
         /* 0226D4CC */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
-        /* 0226D4D0 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D4D0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D4D0 */ _t8 = _t7 & 0x00000001u;
         /* 0226D4D0 */ if (_t8) goto L_0226D4D4; else goto L_0226D4E4;
   L_0226D4D4: ; // 0x226d4d4
         /* 0226D4D4 */ cpu->r[3] = 0x00000010u;
         /* 0226D4D8 */ Gambit_fn_02801A78(cpu);
-        /* 0226D4DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226D4E0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D4DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226D4E0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D4E0 */ _t10 = _t9 & 0x00000001u;
         /* 0226D4E0 */ if (_t10) goto L_0226D50C; else goto L_0226D4E4;
   L_0226D4E4: ; // 0x226d4e4
@@ -5850,15 +5850,15 @@ void Gambit_fn_0226D528(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0226D528: ; // 0x226d528
-        /* 0226D528 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226D52C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D528 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226D52C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D52C */ _t1 = _t0 & 0x00000001u;
         /* 0226D52C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226D52C */ goto L_0226D530;
   L_0226D530: ; // 0x226d530
         /* 0226D530 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0226D530 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226D534 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D530 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226D534 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D534 */ _t3 = _t2 & 0x00000001u;
         /* 0226D534 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226D534 */ goto L_0226D538;
@@ -5877,8 +5877,8 @@ void Gambit_fn_0226D528(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -5892,15 +5892,15 @@ void Gambit_fn_0226D528(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -6368,9 +6368,9 @@ void Gambit_fn_0226D708(CPUState* cpu) {
         /* 0226D70C */ _t0 = cpu->r[8] + 0x00000038u;
         /* 0226D70C */ cpu->r[8] = rbrew_read32(cpu->mem, _t0);
         /* 0226D710 */ cpu->r[6] = 0x101D0000u;
-        /* 0226D714 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0226D714 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0226D718 */ cpu->r[6] = cpu->r[6] + 0x00000034u;
-        /* 0226D71C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D71C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D71C */ _t2 = _t1 & 0x00000001u;
         /* 0226D71C */ if (_t2) goto L_0226D720; else goto L_0226D738;
   L_0226D720: ; // 0x226d720
@@ -6383,8 +6383,8 @@ void Gambit_fn_0226D708(CPUState* cpu) {
         /* 0226D734 */ _t4 = cpu->r[6] + 0x00000000u;
         /* 0226D734 */ rbrew_write32(cpu->mem, _t4, cpu->r[5]);
   L_0226D738: ; // 0x226d738
-        /* 0226D738 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[6]);
-        /* 0226D73C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D738 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[6]));
+        /* 0226D73C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D73C */ _t6 = _t5 & 0x00000001u;
         /* 0226D73C */ if (_t6) goto L_0226D740; else goto L_0226D748;
   L_0226D740: ; // 0x226d740
@@ -6395,9 +6395,9 @@ void Gambit_fn_0226D708(CPUState* cpu) {
         /* 0226D74C */ _t7 = cpu->r[10] + 0x00000020u;
         /* 0226D74C */ cpu->r[10] = rbrew_read32(cpu->mem, _t7);
         /* 0226D750 */ cpu->r[8] = 0x101D0000u;
-        /* 0226D754 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0226D754 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0226D758 */ cpu->r[8] = cpu->r[8] + 0x0000001Cu;
-        /* 0226D75C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D75C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D75C */ _t9 = _t8 & 0x00000001u;
         /* 0226D75C */ if (_t9) goto L_0226D760; else goto L_0226D778;
   L_0226D760: ; // 0x226d760
@@ -6410,8 +6410,8 @@ void Gambit_fn_0226D708(CPUState* cpu) {
         /* 0226D774 */ _t11 = cpu->r[8] + 0x00000000u;
         /* 0226D774 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
   L_0226D778: ; // 0x226d778
-        /* 0226D778 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[8]);
-        /* 0226D77C */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D778 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[8]));
+        /* 0226D77C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D77C */ _t13 = _t12 & 0x00000001u;
         /* 0226D77C */ if (_t13) goto L_0226D780; else goto L_0226D788;
   L_0226D780: ; // 0x226d780
@@ -6422,9 +6422,9 @@ void Gambit_fn_0226D708(CPUState* cpu) {
         /* 0226D78C */ _t14 = cpu->r[12] + 0x00000018u;
         /* 0226D78C */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 0226D790 */ cpu->r[10] = 0x101D0000u;
-        /* 0226D794 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0226D794 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0226D798 */ cpu->r[10] = cpu->r[10] + 0x00000014u;
-        /* 0226D79C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D79C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D79C */ _t16 = _t15 & 0x00000001u;
         /* 0226D79C */ if (_t16) goto L_0226D7A0; else goto L_0226D7B8;
   L_0226D7A0: ; // 0x226d7a0
@@ -6437,8 +6437,8 @@ void Gambit_fn_0226D708(CPUState* cpu) {
         /* 0226D7B4 */ _t18 = cpu->r[10] + 0x00000000u;
         /* 0226D7B4 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
   L_0226D7B8: ; // 0x226d7b8
-        /* 0226D7B8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 0226D7BC */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D7B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 0226D7BC */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D7BC */ _t20 = _t19 & 0x00000001u;
         /* 0226D7BC */ if (_t20) goto L_0226D7C0; else goto L_0226D7C8;
   L_0226D7C0: ; // 0x226d7c0
@@ -6449,9 +6449,9 @@ void Gambit_fn_0226D708(CPUState* cpu) {
         /* 0226D7CC */ _t21 = cpu->r[11] + 0xFFFFDAC0u;
         /* 0226D7CC */ cpu->r[11] = rbrew_read32(cpu->mem, _t21);
         /* 0226D7D0 */ cpu->r[12] = 0x101D0000u;
-        /* 0226D7D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0226D7D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0226D7D8 */ cpu->r[12] = cpu->r[12] + 0xFFFFFBC4u;
-        /* 0226D7DC */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D7DC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D7DC */ _t23 = _t22 & 0x00000001u;
         /* 0226D7DC */ if (_t23) goto L_0226D7E0; else goto L_0226D7F8;
   L_0226D7E0: ; // 0x226d7e0
@@ -6464,8 +6464,8 @@ void Gambit_fn_0226D708(CPUState* cpu) {
         /* 0226D7F4 */ _t25 = cpu->r[12] + 0x00000000u;
         /* 0226D7F4 */ rbrew_write32(cpu->mem, _t25, cpu->r[10]);
   L_0226D7F8: ; // 0x226d7f8
-        /* 0226D7F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0226D7FC */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D7F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0226D7FC */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D7FC */ _t27 = _t26 & 0x00000001u;
         /* 0226D7FC */ if (_t27) goto L_0226D800; else goto L_0226D808;
   L_0226D800: ; // 0x226d800
@@ -6477,9 +6477,9 @@ void Gambit_fn_0226D708(CPUState* cpu) {
         /* 0226D80C */ cpu->r[11] = rbrew_read32(cpu->mem, _t28);
         /* 0226D80C */ cpu->r[10] = _t28;
         /* 0226D810 */ cpu->r[7] = 0x101D0000u;
-        /* 0226D814 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 0226D814 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 0226D818 */ cpu->r[7] = cpu->r[7] + 0xFFFFD4ECu;
-        /* 0226D81C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D81C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D81C */ _t30 = _t29 & 0x00000001u;
         /* 0226D81C */ if (_t30) goto L_0226D820; else goto L_0226D834;
   L_0226D820: ; // 0x226d820
@@ -6491,8 +6491,8 @@ void Gambit_fn_0226D708(CPUState* cpu) {
         /* 0226D830 */ _t32 = cpu->r[7] + 0x00000000u;
         /* 0226D830 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
   L_0226D834: ; // 0x226d834
-        /* 0226D834 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[7]);
-        /* 0226D838 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D834 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[7]));
+        /* 0226D838 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D838 */ _t34 = _t33 & 0x00000001u;
         /* 0226D838 */ if (_t34) goto L_0226D83C; else goto L_0226D844;
   L_0226D83C: ; // 0x226d83c
@@ -6504,9 +6504,9 @@ void Gambit_fn_0226D708(CPUState* cpu) {
         /* 0226D848 */ cpu->r[5] = rbrew_read32(cpu->mem, _t35);
         /* 0226D848 */ cpu->r[8] = _t35;
         /* 0226D84C */ cpu->r[6] = 0x101D0000u;
-        /* 0226D850 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 0226D850 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0226D854 */ cpu->r[6] = cpu->r[6] + 0xFFFFD4E4u;
-        /* 0226D858 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D858 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D858 */ _t37 = _t36 & 0x00000001u;
         /* 0226D858 */ if (_t37) goto L_0226D85C; else goto L_0226D870;
   L_0226D85C: ; // 0x226d85c
@@ -6547,7 +6547,7 @@ void Gambit_fn_0226D894(CPUState* cpu) {
         /* 0226D898 */ cpu->r[0] = cpu->lr;
         /* 0226D89C */ /* nop */
         /* 0226D8A0 */ cpu->r[31] = cpu->r[3];
-        /* 0226D8A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0226D8A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0226D8A4 */ cpu->r[26] = cpu->r[4];
         /* 0226D8A8 */ cpu->r[27] = cpu->r[5];
         /* 0226D8AC */ cpu->r[28] = cpu->r[6];
@@ -6555,15 +6555,15 @@ void Gambit_fn_0226D894(CPUState* cpu) {
         /* 0226D8B4 */ _t1 = cpu->r[1] + 0x00000024u;
         /* 0226D8B4 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 0226D8B8 */ cpu->r[29] = cpu->r[7];
-        /* 0226D8BC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D8BC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D8BC */ _t3 = _t2 & 0x00000001u;
         /* 0226D8BC */ if (_t3) goto L_0226D8C0; else goto L_0226D8D0;
   L_0226D8C0: ; // 0x226d8c0
         /* 0226D8C0 */ cpu->r[3] = 0x00000088u;
         /* 0226D8C4 */ Gambit_fn_02801A78(cpu);
         /* 0226D8C8 */ cpu->r[31] = cpu->r[3];
-        /* 0226D8C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226D8CC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D8C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226D8CC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D8CC */ _t5 = _t4 & 0x00000001u;
         /* 0226D8CC */ if (_t5) goto L_0226D96C; else goto L_0226D8D0;
   L_0226D8D0: ; // 0x226d8d0
@@ -6576,19 +6576,19 @@ void Gambit_fn_0226D894(CPUState* cpu) {
         /* 0226D8E8 */ Gambit_fn_027F84F0(cpu);
         /* 0226D8EC */ cpu->r[0] = 0x10050000u;
         /* 0226D8F0 */ cpu->r[3] = cpu->r[31] + 0x00000054u;
-        /* 0226D8F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0226D8F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0226D8F4 */ cpu->r[0] = cpu->r[0] + 0x00005D84u;
         /* 0226D8F8 */ cpu->r[30] = 0x00000000u;
         /* 0226D8FC */ _t6 = cpu->r[31] + 0x00000000u;
         /* 0226D8FC */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
-        /* 0226D900 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D900 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D900 */ _t8 = _t7 & 0x00000001u;
         /* 0226D900 */ if (_t8) goto L_0226D904; else goto L_0226D914;
   L_0226D904: ; // 0x226d904
         /* 0226D904 */ cpu->r[3] = 0x0000000Cu;
         /* 0226D908 */ Gambit_fn_02801A78(cpu);
-        /* 0226D90C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226D910 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D90C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226D910 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D910 */ _t10 = _t9 & 0x00000001u;
         /* 0226D910 */ if (_t10) goto L_0226D938; else goto L_0226D914;
   L_0226D914: ; // 0x226d914
@@ -6654,7 +6654,7 @@ void Gambit_fn_0226D984(CPUState* cpu) {
         /* 0226D988 */ cpu->r[0] = cpu->lr;
         /* 0226D98C */ /* nop */
         /* 0226D990 */ cpu->r[31] = cpu->r[3];
-        /* 0226D990 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0226D990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0226D994 */ cpu->r[26] = cpu->r[4];
         /* 0226D998 */ cpu->r[27] = cpu->r[5];
         /* 0226D99C */ cpu->r[28] = cpu->r[6];
@@ -6662,15 +6662,15 @@ void Gambit_fn_0226D984(CPUState* cpu) {
         /* 0226D9A4 */ _t1 = cpu->r[1] + 0x00000024u;
         /* 0226D9A4 */ rbrew_write32(cpu->mem, _t1, cpu->r[0]);
         /* 0226D9A8 */ cpu->r[29] = cpu->r[7];
-        /* 0226D9AC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D9AC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D9AC */ _t3 = _t2 & 0x00000001u;
         /* 0226D9AC */ if (_t3) goto L_0226D9B0; else goto L_0226D9C0;
   L_0226D9B0: ; // 0x226d9b0
         /* 0226D9B0 */ cpu->r[3] = 0x0000008Cu;
         /* 0226D9B4 */ Gambit_fn_02801A78(cpu);
         /* 0226D9B8 */ cpu->r[31] = cpu->r[3];
-        /* 0226D9B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226D9BC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D9B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226D9BC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D9BC */ _t5 = _t4 & 0x00000001u;
         /* 0226D9BC */ if (_t5) goto L_0226DA5C; else goto L_0226D9C0;
   L_0226D9C0: ; // 0x226d9c0
@@ -6683,19 +6683,19 @@ void Gambit_fn_0226D984(CPUState* cpu) {
         /* 0226D9D8 */ Gambit_fn_027F84F0(cpu);
         /* 0226D9DC */ cpu->r[0] = 0x10050000u;
         /* 0226D9E0 */ cpu->r[3] = cpu->r[31] + 0x00000054u;
-        /* 0226D9E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0226D9E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0226D9E4 */ cpu->r[0] = cpu->r[0] + 0x00005DECu;
         /* 0226D9E8 */ cpu->r[30] = 0x00000000u;
         /* 0226D9EC */ _t6 = cpu->r[31] + 0x00000000u;
         /* 0226D9EC */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
-        /* 0226D9F0 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D9F0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226D9F0 */ _t8 = _t7 & 0x00000001u;
         /* 0226D9F0 */ if (_t8) goto L_0226D9F4; else goto L_0226DA04;
   L_0226D9F4: ; // 0x226d9f4
         /* 0226D9F4 */ cpu->r[3] = 0x0000000Cu;
         /* 0226D9F8 */ Gambit_fn_02801A78(cpu);
-        /* 0226D9FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226DA00 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226D9FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226DA00 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226DA00 */ _t10 = _t9 & 0x00000001u;
         /* 0226DA00 */ if (_t10) goto L_0226DA28; else goto L_0226DA04;
   L_0226DA04: ; // 0x226da04
@@ -6788,18 +6788,18 @@ void Gambit_fn_0226DAAC(CPUState* cpu) {
         /* 0226E3E0 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0226E3E0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0226E3E4 */ cpu->r[12] = 0x00000000u;
-        /* 0226E3E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0226E3E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0226E3EC */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0226E3EC */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0226E3F0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E3F0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E3F0 */ _t6 = _t5 & 0x00000001u;
         /* 0226E3F0 */ if (_t6) goto L_0226E418; else goto L_0226E3F4;
   L_0226E3F4: ; // 0x226e3f4
         /* 0226E3F4 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0226E3F4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0226E3F8 */ /* nop */
-        /* 0226E3FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0226E400 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E3FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0226E400 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E400 */ _t9 = _t8 & 0x00000001u;
         /* 0226E400 */ if (_t9) goto L_0226E404; else goto L_0226E418;
   L_0226E404: ; // 0x226e404
@@ -6968,8 +6968,8 @@ void Gambit_fn_0226DB40(CPUState* cpu) {
         /* 0226DB48 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 0226DB48 */ cpu->r[9] = _t0;
         /* 0226DB4C */ cpu->r[3] = cpu->r[3] + 0x0000003Cu;
-        /* 0226DB50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226DB54 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226DB50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226DB54 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226DB54 */ _t2 = _t1 & 0x00000001u;
         /* 0226DB54 */ _t3 = _t2 ^ 0x00000001u;
         /* 0226DB54 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -7002,9 +7002,9 @@ void Gambit_fn_0226DB80(CPUState* cpu) {
         /* 0226DB84 */ _t0 = cpu->r[9] + 0x00000050u;
         /* 0226DB84 */ cpu->r[9] = rbrew_read32(cpu->mem, _t0);
         /* 0226DB88 */ cpu->r[11] = 0x101D0000u;
-        /* 0226DB8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0226DB8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0226DB90 */ cpu->r[11] = cpu->r[11] + 0x0000004Cu;
-        /* 0226DB94 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226DB94 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226DB94 */ _t2 = _t1 & 0x00000001u;
         /* 0226DB94 */ if (_t2) goto L_0226DB98; else goto L_0226DBB0;
   L_0226DB98: ; // 0x226db98
@@ -7017,8 +7017,8 @@ void Gambit_fn_0226DB80(CPUState* cpu) {
         /* 0226DBAC */ _t4 = cpu->r[11] + 0x00000000u;
         /* 0226DBAC */ rbrew_write32(cpu->mem, _t4, cpu->r[9]);
   L_0226DBB0: ; // 0x226dbb0
-        /* 0226DBB0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 0226DBB4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226DBB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 0226DBB4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226DBB4 */ _t6 = _t5 & 0x00000001u;
         /* 0226DBB4 */ if (_t6) goto L_0226DBB8; else goto L_0226DBC0;
   L_0226DBB8: ; // 0x226dbb8
@@ -7028,10 +7028,10 @@ void Gambit_fn_0226DB80(CPUState* cpu) {
         /* 0226DBC0 */ cpu->r[12] = 0x101D0000u;
         /* 0226DBC4 */ _t7 = cpu->r[12] + 0x00000030u;
         /* 0226DBC4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 0226DBC8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0226DBC8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0226DBCC */ cpu->r[12] = 0x101D0000u;
         /* 0226DBD0 */ cpu->r[12] = cpu->r[12] + 0x0000002Cu;
-        /* 0226DBD4 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226DBD4 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226DBD4 */ _t9 = _t8 & 0x00000001u;
         /* 0226DBD4 */ if (_t9) goto L_0226DBD8; else goto L_0226DBF0;
   L_0226DBD8: ; // 0x226dbd8
@@ -7044,8 +7044,8 @@ void Gambit_fn_0226DB80(CPUState* cpu) {
         /* 0226DBEC */ _t11 = cpu->r[12] + 0x00000000u;
         /* 0226DBEC */ rbrew_write32(cpu->mem, _t11, cpu->r[11]);
   L_0226DBF0: ; // 0x226dbf0
-        /* 0226DBF0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 0226DBF4 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226DBF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 0226DBF4 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226DBF4 */ _t13 = _t12 & 0x00000001u;
         /* 0226DBF4 */ if (_t13) goto L_0226DBF8; else goto L_0226DC00;
   L_0226DBF8: ; // 0x226dbf8
@@ -7057,9 +7057,9 @@ void Gambit_fn_0226DB80(CPUState* cpu) {
         /* 0226DC04 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
         /* 0226DC04 */ cpu->r[10] = _t14;
         /* 0226DC08 */ cpu->r[11] = 0x101D0000u;
-        /* 0226DC0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0226DC0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0226DC10 */ cpu->r[11] = cpu->r[11] + 0xFFFFFFE8u;
-        /* 0226DC14 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226DC14 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226DC14 */ _t16 = _t15 & 0x00000001u;
         /* 0226DC14 */ if (_t16) goto L_0226DC18; else goto L_0226DC2C;
   L_0226DC18: ; // 0x226dc18
@@ -7071,8 +7071,8 @@ void Gambit_fn_0226DB80(CPUState* cpu) {
         /* 0226DC28 */ _t18 = cpu->r[11] + 0x00000000u;
         /* 0226DC28 */ rbrew_write32(cpu->mem, _t18, cpu->r[9]);
   L_0226DC2C: ; // 0x226dc2c
-        /* 0226DC2C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[11]);
-        /* 0226DC30 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226DC2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[11]));
+        /* 0226DC30 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226DC30 */ _t20 = _t19 & 0x00000001u;
         /* 0226DC30 */ if (_t20) goto L_0226DC34; else goto L_0226DC3C;
   L_0226DC34: ; // 0x226dc34
@@ -7084,9 +7084,9 @@ void Gambit_fn_0226DB80(CPUState* cpu) {
         /* 0226DC40 */ cpu->r[10] = rbrew_read32(cpu->mem, _t21);
         /* 0226DC40 */ cpu->r[9] = _t21;
         /* 0226DC44 */ cpu->r[12] = 0x101D0000u;
-        /* 0226DC48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0226DC48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0226DC4C */ cpu->r[12] = cpu->r[12] + 0xFFFFDDE4u;
-        /* 0226DC50 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226DC50 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226DC50 */ _t23 = _t22 & 0x00000001u;
         /* 0226DC50 */ if (_t23) goto L_0226DC54; else goto L_0226DC68;
   L_0226DC54: ; // 0x226dc54
@@ -7147,11 +7147,11 @@ void Gambit_fn_0226DC7C(CPUState* cpu) {
         /* 0226DCD4 */ cpu->r[3] = cpu->r[29];
         /* 0226DCD8 */ Gambit_fn_02834450(cpu);
         /* 0226DCDC */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 0226DCDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0226DCDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0226DCE0 */ _t9 = cpu->r[31] + 0x00000004u;
         /* 0226DCE0 */ rbrew_write_f32(cpu->mem, _t9, cpu->f[1]);
         /* 0226DCE0 */ cpu->r[31] = _t9;
-        /* 0226DCE4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226DCE4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226DCE4 */ _t11 = _t10 & 0x00000001u;
         /* 0226DCE4 */ if (_t11) goto L_0226DCE8; else goto L_0226DCD4;
   L_0226DCE8: ; // 0x226dce8
@@ -7208,11 +7208,11 @@ void Gambit_fn_0226DC80(CPUState* cpu) {
         /* 0226DCD4 */ cpu->r[3] = cpu->r[29];
         /* 0226DCD8 */ Gambit_fn_02834450(cpu);
         /* 0226DCDC */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 0226DCDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0226DCDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0226DCE0 */ _t9 = cpu->r[31] + 0x00000004u;
         /* 0226DCE0 */ rbrew_write_f32(cpu->mem, _t9, cpu->f[1]);
         /* 0226DCE0 */ cpu->r[31] = _t9;
-        /* 0226DCE4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226DCE4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226DCE4 */ _t11 = _t10 & 0x00000001u;
         /* 0226DCE4 */ if (_t11) goto L_0226DCE8; else goto L_0226DCD4;
   L_0226DCE8: ; // 0x226dce8
@@ -7281,11 +7281,11 @@ void Gambit_fn_0226DD04(CPUState* cpu) {
         /* 0226DD5C */ cpu->r[3] = cpu->r[29];
         /* 0226DD60 */ Gambit_fn_02834450(cpu);
         /* 0226DD64 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 0226DD64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0226DD64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0226DD68 */ _t9 = cpu->r[31] + 0x00000004u;
         /* 0226DD68 */ rbrew_write_f32(cpu->mem, _t9, cpu->f[1]);
         /* 0226DD68 */ cpu->r[31] = _t9;
-        /* 0226DD6C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226DD6C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226DD6C */ _t11 = _t10 & 0x00000001u;
         /* 0226DD6C */ if (_t11) goto L_0226DD70; else goto L_0226DD5C;
   L_0226DD70: ; // 0x226dd70
@@ -7342,11 +7342,11 @@ void Gambit_fn_0226DD08(CPUState* cpu) {
         /* 0226DD5C */ cpu->r[3] = cpu->r[29];
         /* 0226DD60 */ Gambit_fn_02834450(cpu);
         /* 0226DD64 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 0226DD64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0226DD64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0226DD68 */ _t9 = cpu->r[31] + 0x00000004u;
         /* 0226DD68 */ rbrew_write_f32(cpu->mem, _t9, cpu->f[1]);
         /* 0226DD68 */ cpu->r[31] = _t9;
-        /* 0226DD6C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226DD6C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226DD6C */ _t11 = _t10 & 0x00000001u;
         /* 0226DD6C */ if (_t11) goto L_0226DD70; else goto L_0226DD5C;
   L_0226DD70: ; // 0x226dd70
@@ -7482,15 +7482,15 @@ void Gambit_fn_0226DE04(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0226DE04: ; // 0x226de04
-        /* 0226DE04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226DE08 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226DE04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226DE08 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226DE08 */ _t1 = _t0 & 0x00000001u;
         /* 0226DE08 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226DE08 */ goto L_0226DE0C;
   L_0226DE0C: ; // 0x226de0c
         /* 0226DE0C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0226DE0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226DE10 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226DE0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226DE10 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226DE10 */ _t3 = _t2 & 0x00000001u;
         /* 0226DE10 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226DE10 */ goto L_0226DE14;
@@ -7509,8 +7509,8 @@ void Gambit_fn_0226DE04(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -7524,15 +7524,15 @@ void Gambit_fn_0226DE04(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -7560,15 +7560,15 @@ void Gambit_fn_0226DE18(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0226DE18: ; // 0x226de18
-        /* 0226DE18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226DE1C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226DE18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226DE1C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226DE1C */ _t1 = _t0 & 0x00000001u;
         /* 0226DE1C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226DE1C */ goto L_0226DE20;
   L_0226DE20: ; // 0x226de20
         /* 0226DE20 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0226DE20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226DE24 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226DE20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226DE24 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226DE24 */ _t3 = _t2 & 0x00000001u;
         /* 0226DE24 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226DE24 */ goto L_0226DE28;
@@ -7587,8 +7587,8 @@ void Gambit_fn_0226DE18(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -7602,15 +7602,15 @@ void Gambit_fn_0226DE18(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -7653,10 +7653,10 @@ void Gambit_fn_0226DE2C(CPUState* cpu) {
         /* 0226DE4C */ cpu->r[31] = 0x101D0000u;
         /* 0226DE50 */ _t3 = cpu->r[28] + 0x0000001Cu;
         /* 0226DE50 */ rbrew_write32(cpu->mem, _t3, cpu->r[4]);
-        /* 0226DE54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0226DE54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0226DE58 */ _t4 = cpu->r[28] + 0x0000000Fu;
         /* 0226DE58 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[27]);
-        /* 0226DE5C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226DE5C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226DE5C */ _t6 = _t5 & 0x00000001u;
         /* 0226DE5C */ if (_t6) goto L_0226DEA0; else goto L_0226DE60;
   L_0226DE60: ; // 0x226de60
@@ -7671,16 +7671,16 @@ void Gambit_fn_0226DE2C(CPUState* cpu) {
         /* 0226DE74 */ cpu->r[5] = 0x00000004u;
         /* 0226DE78 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 0226DE7C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226DE80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0226DE80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0226DE84 */ cpu->r[0] = cpu->r[27];
-        /* 0226DE88 */ _t10 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0226DE88 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0226DE88 */ _t11 = _t10 & 0x00000001u;
         /* 0226DE88 */ if (_t11) goto L_0226DE90; else goto L_0226DE8C;
   L_0226DE8C: ; // 0x226de8c
         /* 0226DE8C */ cpu->r[0] = 0x00000001u;
   L_0226DE90: ; // 0x226de90
-        /* 0226DE90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226DE94 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226DE90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226DE94 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226DE94 */ _t13 = _t12 & 0x00000001u;
         /* 0226DE94 */ if (_t13) goto L_0226DEA0; else goto L_0226DE98;
   L_0226DE98: ; // 0x226de98
@@ -7692,9 +7692,9 @@ void Gambit_fn_0226DE2C(CPUState* cpu) {
         /* 0226DEA0 */ _t16 = cpu->r[28] + 0x00000020u;
         /* 0226DEA0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t16);
         /* 0226DEA4 */ cpu->r[0] = 0x00000000u;
-        /* 0226DEA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0226DEA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0226DEAC */ cpu->r[12] = cpu->r[0];
-        /* 0226DEB0 */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0226DEB0 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0226DEB0 */ _t18 = _t17 & 0x00000001u;
         /* 0226DEB0 */ if (_t18) goto L_0226DEB4; else goto L_0226DED8;
   L_0226DEB4: ; // 0x226deb4
@@ -7719,8 +7719,8 @@ void Gambit_fn_0226DE2C(CPUState* cpu) {
   L_0226DED8: ; // 0x226ded8
         /* 0226DED8 */ _t26 = cpu->r[28] + 0x0000000Fu;
         /* 0226DED8 */ cpu->r[27] = rbrew_read8(cpu->mem, _t26);
-        /* 0226DEDC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0226DEE0 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226DEDC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0226DEE0 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226DEE0 */ _t28 = _t27 & 0x00000001u;
         /* 0226DEE0 */ if (_t28) goto L_0226DF24; else goto L_0226DEE4;
   L_0226DEE4: ; // 0x226dee4
@@ -7735,16 +7735,16 @@ void Gambit_fn_0226DE2C(CPUState* cpu) {
         /* 0226DEF8 */ cpu->r[5] = 0x00000004u;
         /* 0226DEFC */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 0226DF00 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226DF04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0226DF04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0226DF08 */ cpu->r[11] = cpu->r[27];
-        /* 0226DF0C */ _t32 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0226DF0C */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0226DF0C */ _t33 = _t32 & 0x00000001u;
         /* 0226DF0C */ if (_t33) goto L_0226DF14; else goto L_0226DF10;
   L_0226DF10: ; // 0x226df10
         /* 0226DF10 */ cpu->r[11] = 0x00000001u;
   L_0226DF14: ; // 0x226df14
-        /* 0226DF14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226DF18 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226DF14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226DF18 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226DF18 */ _t35 = _t34 & 0x00000001u;
         /* 0226DF18 */ if (_t35) goto L_0226DF24; else goto L_0226DF1C;
   L_0226DF1C: ; // 0x226df1c
@@ -7756,9 +7756,9 @@ void Gambit_fn_0226DE2C(CPUState* cpu) {
         /* 0226DF24 */ _t38 = cpu->r[28] + 0x00000028u;
         /* 0226DF24 */ cpu->r[6] = rbrew_read32(cpu->mem, _t38);
         /* 0226DF28 */ cpu->r[0] = 0x00000000u;
-        /* 0226DF2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 0226DF2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 0226DF30 */ cpu->r[12] = cpu->r[0];
-        /* 0226DF34 */ _t39 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0226DF34 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0226DF34 */ _t40 = _t39 & 0x00000001u;
         /* 0226DF34 */ if (_t40) goto L_0226DF38; else goto L_0226DF5C;
   L_0226DF38: ; // 0x226df38
@@ -7783,8 +7783,8 @@ void Gambit_fn_0226DE2C(CPUState* cpu) {
   L_0226DF5C: ; // 0x226df5c
         /* 0226DF5C */ _t48 = cpu->r[28] + 0x0000000Fu;
         /* 0226DF5C */ cpu->r[27] = rbrew_read8(cpu->mem, _t48);
-        /* 0226DF60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0226DF64 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226DF60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0226DF64 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226DF64 */ _t50 = _t49 & 0x00000001u;
         /* 0226DF64 */ if (_t50) goto L_0226DFA8; else goto L_0226DF68;
   L_0226DF68: ; // 0x226df68
@@ -7799,16 +7799,16 @@ void Gambit_fn_0226DE2C(CPUState* cpu) {
         /* 0226DF7C */ cpu->r[5] = 0x00000004u;
         /* 0226DF80 */ cpu->r[4] = rbrew_rlwinm(cpu->r[27], 0x00000003u, 0x00000000u, 0x0000001Cu);
         /* 0226DF84 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226DF88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
+        /* 0226DF88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
         /* 0226DF8C */ cpu->r[10] = cpu->r[27];
-        /* 0226DF90 */ _t54 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0226DF90 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0226DF90 */ _t55 = _t54 & 0x00000001u;
         /* 0226DF90 */ if (_t55) goto L_0226DF98; else goto L_0226DF94;
   L_0226DF94: ; // 0x226df94
         /* 0226DF94 */ cpu->r[10] = 0x00000001u;
   L_0226DF98: ; // 0x226df98
-        /* 0226DF98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226DF9C */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226DF98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226DF9C */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226DF9C */ _t57 = _t56 & 0x00000001u;
         /* 0226DF9C */ if (_t57) goto L_0226DFA8; else goto L_0226DFA0;
   L_0226DFA0: ; // 0x226dfa0
@@ -7820,9 +7820,9 @@ void Gambit_fn_0226DE2C(CPUState* cpu) {
         /* 0226DFA8 */ _t60 = cpu->r[28] + 0x00000030u;
         /* 0226DFA8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t60);
         /* 0226DFAC */ cpu->r[0] = 0x00000000u;
-        /* 0226DFB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0226DFB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0226DFB4 */ cpu->r[5] = cpu->r[0];
-        /* 0226DFB8 */ _t61 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0226DFB8 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0226DFB8 */ _t62 = _t61 & 0x00000001u;
         /* 0226DFB8 */ if (_t62) goto L_0226DFBC; else goto L_0226DFE0;
   L_0226DFBC: ; // 0x226dfbc
@@ -7847,8 +7847,8 @@ void Gambit_fn_0226DE2C(CPUState* cpu) {
   L_0226DFE0: ; // 0x226dfe0
         /* 0226DFE0 */ _t70 = cpu->r[30] + 0x00000000u;
         /* 0226DFE0 */ cpu->r[25] = rbrew_read8(cpu->mem, _t70);
-        /* 0226DFE4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 0226DFE8 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226DFE4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 0226DFE8 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226DFE8 */ _t72 = _t71 & 0x00000001u;
         /* 0226DFE8 */ if (_t72) goto L_0226E0C4; else goto L_0226DFEC;
   L_0226DFEC: ; // 0x226dfec
@@ -7864,10 +7864,10 @@ void Gambit_fn_0226DE2C(CPUState* cpu) {
         /* 0226E004 */ cpu->r[4] = (uint32_t)((int32_t)cpu->r[25] * (int32_t)0x00000024u);
         /* 0226E008 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0226E00C */ cpu->r[24] = cpu->r[3];
-        /* 0226E010 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
+        /* 0226E010 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
         /* 0226E014 */ cpu->r[30] = cpu->r[25];
         /* 0226E018 */ cpu->r[7] = 0x00000000u;
-        /* 0226E01C */ _t76 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0226E01C */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0226E01C */ _t77 = _t76 & 0x00000001u;
         /* 0226E01C */ if (_t77) goto L_0226E024; else goto L_0226E020;
   L_0226E020: ; // 0x226e020
@@ -7880,36 +7880,36 @@ void Gambit_fn_0226DE2C(CPUState* cpu) {
         /* 0226E030 */ cpu->r[23] = 0x00000018u;
   L_0226E034: ; // 0x226e034
         /* 0226E034 */ cpu->r[27] = cpu->r[24] + cpu->r[22];
-        /* 0226E034 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0226E038 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E034 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0226E038 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E038 */ _t80 = _t79 & 0x00000001u;
         /* 0226E038 */ if (_t80) goto L_0226E0A8; else goto L_0226E03C;
   L_0226E03C: ; // 0x226e03c
         /* 0226E03C */ cpu->r[26] = cpu->r[27];
-        /* 0226E03C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0226E040 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E03C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0226E040 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E040 */ _t82 = _t81 & 0x00000001u;
         /* 0226E040 */ if (_t82) goto L_0226E044; else goto L_0226E054;
   L_0226E044: ; // 0x226e044
         /* 0226E044 */ cpu->r[3] = 0x00000024u;
         /* 0226E048 */ Gambit_fn_02801A78(cpu);
         /* 0226E04C */ cpu->r[26] = cpu->r[3];
-        /* 0226E04C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0226E050 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E04C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0226E050 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E050 */ _t84 = _t83 & 0x00000001u;
         /* 0226E050 */ if (_t84) goto L_0226E09C; else goto L_0226E054;
   L_0226E054: ; // 0x226e054
         /* 0226E054 */ cpu->r[11] = cpu->r[26];
-        /* 0226E054 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0226E058 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E054 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0226E058 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E058 */ _t86 = _t85 & 0x00000001u;
         /* 0226E058 */ if (_t86) goto L_0226E05C; else goto L_0226E06C;
   L_0226E05C: ; // 0x226e05c
         /* 0226E05C */ cpu->r[3] = 0x0000000Cu;
         /* 0226E060 */ Gambit_fn_02801A78(cpu);
         /* 0226E064 */ cpu->r[11] = cpu->r[3];
-        /* 0226E064 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0226E068 */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E064 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0226E068 */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E068 */ _t88 = _t87 & 0x00000001u;
         /* 0226E068 */ if (_t88) goto L_0226E088; else goto L_0226E06C;
   L_0226E06C: ; // 0x226e06c
@@ -7940,14 +7940,14 @@ void Gambit_fn_0226DE2C(CPUState* cpu) {
         /* 0226E0A4 */ rbrew_write32(cpu->mem, _t96, cpu->r[0]);
   L_0226E0A8: ; // 0x226e0a8
         /* 0226E0A8 */ cpu->r[30] = cpu->r[30] + 0xFFFFFFFFu;
-        /* 0226E0A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
+        /* 0226E0A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
         /* 0226E0AC */ cpu->r[22] = cpu->r[22] + 0x00000024u;
-        /* 0226E0B0 */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E0B0 */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E0B0 */ _t98 = _t97 & 0x00000001u;
         /* 0226E0B0 */ if (_t98) goto L_0226E0B4; else goto L_0226E034;
   L_0226E0B4: ; // 0x226e0b4
-        /* 0226E0B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
-        /* 0226E0B8 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E0B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
+        /* 0226E0B8 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E0B8 */ _t100 = _t99 & 0x00000001u;
         /* 0226E0B8 */ if (_t100) goto L_0226E0C4; else goto L_0226E0BC;
   L_0226E0BC: ; // 0x226e0bc
@@ -7977,10 +7977,10 @@ void Gambit_fn_0226E0DC(CPUState* cpu) {
         /* 0226E0E0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t1);
         /* 0226E0E4 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 0226E0E4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
-        /* 0226E0E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[12]);
+        /* 0226E0E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[12]));
         /* 0226E0EC */ _t3 = cpu->r[4] + 0x00000000u;
         /* 0226E0EC */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 0226E0F0 */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E0F0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E0F0 */ _t5 = _t4 & 0x00000001u;
         /* 0226E0F0 */ if (_t5) goto L_0226E0F4; else goto L_0226E0FC;
   L_0226E0F4: ; // 0x226e0f4
@@ -7997,10 +7997,10 @@ void Gambit_fn_0226E0DC(CPUState* cpu) {
         /* 0226E108 */ cpu->r[9] = rbrew_read8(cpu->mem, _t9);
         /* 0226E10C */ _t10 = cpu->r[3] + 0x00000028u;
         /* 0226E10C */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 0226E110 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[9], cpu->r[12]);
+        /* 0226E110 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[9], cpu->r[12]));
         /* 0226E114 */ _t11 = cpu->r[3] + 0x0000002Cu;
         /* 0226E114 */ cpu->r[10] = rbrew_read32(cpu->mem, _t11);
-        /* 0226E118 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E118 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E118 */ _t13 = _t12 & 0x00000001u;
         /* 0226E118 */ if (_t13) goto L_0226E11C; else goto L_0226E124;
   L_0226E11C: ; // 0x226e11c
@@ -8021,10 +8021,10 @@ void Gambit_fn_0226E0DC(CPUState* cpu) {
         /* 0226E138 */ cpu->r[11] = rbrew_read8(cpu->mem, _t19);
         /* 0226E13C */ _t20 = cpu->r[3] + 0x00000034u;
         /* 0226E13C */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 0226E140 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[9]);
+        /* 0226E140 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[9]));
         /* 0226E144 */ _t21 = cpu->r[6] + 0x00000000u;
         /* 0226E144 */ cpu->r[7] = rbrew_read32(cpu->mem, _t21);
-        /* 0226E148 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E148 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E148 */ _t23 = _t22 & 0x00000001u;
         /* 0226E148 */ if (_t23) goto L_0226E14C; else goto L_0226E154;
   L_0226E14C: ; // 0x226e14c
@@ -8112,10 +8112,10 @@ void Gambit_fn_0226E1BC(CPUState* cpu) {
         /* 0226E1C4 */ _t1 = cpu->r[3] + 0x00000030u;
         /* 0226E1C4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 0226E1C8 */ cpu->r[7] = cpu->r[0];
-        /* 0226E1CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 0226E1CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 0226E1D0 */ _t2 = cpu->r[3] + 0x00000034u;
         /* 0226E1D0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0226E1D4 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E1D4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E1D4 */ _t4 = _t3 & 0x00000001u;
         /* 0226E1D4 */ if (_t4) goto L_0226E1D8; else goto L_0226E1F0;
   L_0226E1D8: ; // 0x226e1d8
@@ -8123,8 +8123,8 @@ void Gambit_fn_0226E1BC(CPUState* cpu) {
         /* 0226E1DC */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 0226E1E0 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0226E1E0 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0226E1E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0226E1E8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E1E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0226E1E8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E1E8 */ _t7 = _t6 & 0x00000001u;
         /* 0226E1E8 */ if (_t7) goto L_0226E1EC; else goto L_0226E1FC;
   L_0226E1EC: ; // 0x226e1ec
@@ -8132,16 +8132,16 @@ void Gambit_fn_0226E1BC(CPUState* cpu) {
   L_0226E1F0: ; // 0x226e1f0
         /* 0226E1F0 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0226E1F0 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0226E1F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0226E1F8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E1F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0226E1F8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E1F8 */ _t10 = _t9 & 0x00000001u;
         /* 0226E1F8 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226E1F8 */ goto L_0226E1FC;
   L_0226E1FC: ; // 0x226e1fc
-        /* 0226E1FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 0226E1FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 0226E200 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0226E200 */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 0226E204 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E204 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E204 */ _t13 = _t12 & 0x00000001u;
         /* 0226E204 */ if (_t13) goto L_0226E208; else goto L_0226E210;
   L_0226E208: ; // 0x226e208
@@ -8152,11 +8152,11 @@ void Gambit_fn_0226E1BC(CPUState* cpu) {
         /* 0226E210 */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0226E214 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0226E214 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0226E218 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0226E218 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0226E21C */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0226E21C */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0226E220 */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 0226E224 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E224 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E224 */ _t18 = _t17 & 0x00000001u;
         /* 0226E224 */ if (_t18) goto L_0226E23C; else goto L_0226E228;
   L_0226E228: ; // 0x226e228
@@ -8183,10 +8183,10 @@ void Gambit_fn_0226E244(CPUState* cpu) {
         /* 0226E24C */ _t1 = cpu->r[3] + 0x00000020u;
         /* 0226E24C */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 0226E250 */ cpu->r[8] = cpu->r[0];
-        /* 0226E254 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 0226E254 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 0226E258 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 0226E258 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0226E25C */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E25C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E25C */ _t4 = _t3 & 0x00000001u;
         /* 0226E25C */ if (_t4) goto L_0226E260; else goto L_0226E278;
   L_0226E260: ; // 0x226e260
@@ -8194,8 +8194,8 @@ void Gambit_fn_0226E244(CPUState* cpu) {
         /* 0226E264 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 0226E268 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0226E268 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0226E26C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0226E270 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E26C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0226E270 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E270 */ _t7 = _t6 & 0x00000001u;
         /* 0226E270 */ if (_t7) goto L_0226E274; else goto L_0226E284;
   L_0226E274: ; // 0x226e274
@@ -8203,16 +8203,16 @@ void Gambit_fn_0226E244(CPUState* cpu) {
   L_0226E278: ; // 0x226e278
         /* 0226E278 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0226E278 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0226E27C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0226E280 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E27C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0226E280 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E280 */ _t10 = _t9 & 0x00000001u;
         /* 0226E280 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226E280 */ goto L_0226E284;
   L_0226E284: ; // 0x226e284
-        /* 0226E284 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 0226E284 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 0226E288 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0226E288 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 0226E28C */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E28C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E28C */ _t13 = _t12 & 0x00000001u;
         /* 0226E28C */ if (_t13) goto L_0226E290; else goto L_0226E298;
   L_0226E290: ; // 0x226e290
@@ -8223,11 +8223,11 @@ void Gambit_fn_0226E244(CPUState* cpu) {
         /* 0226E298 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0226E29C */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0226E29C */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0226E2A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0226E2A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0226E2A4 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0226E2A4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0226E2A8 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 0226E2AC */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E2AC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E2AC */ _t18 = _t17 & 0x00000001u;
         /* 0226E2AC */ if (_t18) goto L_0226E2C4; else goto L_0226E2B0;
   L_0226E2B0: ; // 0x226e2b0
@@ -8262,9 +8262,9 @@ void Gambit_fn_0226E2CC(CPUState* cpu) {
         /* 0226E2E4 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 0226E2E4 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 0226E2E8 */ /* nop */
-        /* 0226E2EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 0226E2EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 0226E2F0 */ cpu->r[31] = cpu->r[4];
-        /* 0226E2F4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E2F4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E2F4 */ _t6 = _t5 & 0x00000001u;
         /* 0226E2F4 */ if (_t6) goto L_0226E2F8; else goto L_0226E30C;
   L_0226E2F8: ; // 0x226e2f8
@@ -8313,9 +8313,9 @@ void Gambit_fn_0226E2D0(CPUState* cpu) {
         /* 0226E2E4 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 0226E2E4 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 0226E2E8 */ /* nop */
-        /* 0226E2EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 0226E2EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 0226E2F0 */ cpu->r[31] = cpu->r[4];
-        /* 0226E2F4 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E2F4 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E2F4 */ _t6 = _t5 & 0x00000001u;
         /* 0226E2F4 */ if (_t6) goto L_0226E2F8; else goto L_0226E30C;
   L_0226E2F8: ; // 0x226e2f8
@@ -8357,10 +8357,10 @@ void Gambit_fn_0226E344(CPUState* cpu) {
         /* 0226E34C */ _t1 = cpu->r[3] + 0x00000028u;
         /* 0226E34C */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 0226E350 */ cpu->r[8] = cpu->r[0];
-        /* 0226E354 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 0226E354 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 0226E358 */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 0226E358 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0226E35C */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E35C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E35C */ _t4 = _t3 & 0x00000001u;
         /* 0226E35C */ if (_t4) goto L_0226E360; else goto L_0226E378;
   L_0226E360: ; // 0x226e360
@@ -8368,8 +8368,8 @@ void Gambit_fn_0226E344(CPUState* cpu) {
         /* 0226E364 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 0226E368 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0226E368 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0226E36C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0226E370 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E36C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0226E370 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E370 */ _t7 = _t6 & 0x00000001u;
         /* 0226E370 */ if (_t7) goto L_0226E374; else goto L_0226E384;
   L_0226E374: ; // 0x226e374
@@ -8377,16 +8377,16 @@ void Gambit_fn_0226E344(CPUState* cpu) {
   L_0226E378: ; // 0x226e378
         /* 0226E378 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0226E378 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0226E37C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0226E380 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E37C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0226E380 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E380 */ _t10 = _t9 & 0x00000001u;
         /* 0226E380 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226E380 */ goto L_0226E384;
   L_0226E384: ; // 0x226e384
-        /* 0226E384 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 0226E384 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 0226E388 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0226E388 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 0226E38C */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E38C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E38C */ _t13 = _t12 & 0x00000001u;
         /* 0226E38C */ if (_t13) goto L_0226E390; else goto L_0226E398;
   L_0226E390: ; // 0x226e390
@@ -8397,11 +8397,11 @@ void Gambit_fn_0226E344(CPUState* cpu) {
         /* 0226E398 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0226E39C */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0226E39C */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0226E3A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0226E3A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0226E3A4 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0226E3A4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0226E3A8 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 0226E3AC */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E3AC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E3AC */ _t18 = _t17 & 0x00000001u;
         /* 0226E3AC */ if (_t18) goto L_0226E3C4; else goto L_0226E3B0;
   L_0226E3B0: ; // 0x226e3b0
@@ -8434,18 +8434,18 @@ void Gambit_fn_0226E3CC(CPUState* cpu) {
         /* 0226E3E0 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0226E3E0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0226E3E4 */ cpu->r[12] = 0x00000000u;
-        /* 0226E3E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0226E3E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0226E3EC */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0226E3EC */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0226E3F0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E3F0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E3F0 */ _t6 = _t5 & 0x00000001u;
         /* 0226E3F0 */ if (_t6) goto L_0226E418; else goto L_0226E3F4;
   L_0226E3F4: ; // 0x226e3f4
         /* 0226E3F4 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0226E3F4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0226E3F8 */ /* nop */
-        /* 0226E3FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0226E400 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E3FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0226E400 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E400 */ _t9 = _t8 & 0x00000001u;
         /* 0226E400 */ if (_t9) goto L_0226E404; else goto L_0226E418;
   L_0226E404: ; // 0x226e404
@@ -8486,18 +8486,18 @@ void Gambit_fn_0226E3D0(CPUState* cpu) {
         /* 0226E3E0 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0226E3E0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0226E3E4 */ cpu->r[12] = 0x00000000u;
-        /* 0226E3E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0226E3E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0226E3EC */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0226E3EC */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0226E3F0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E3F0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E3F0 */ _t6 = _t5 & 0x00000001u;
         /* 0226E3F0 */ if (_t6) goto L_0226E418; else goto L_0226E3F4;
   L_0226E3F4: ; // 0x226e3f4
         /* 0226E3F4 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0226E3F4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0226E3F8 */ /* nop */
-        /* 0226E3FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0226E400 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E3FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0226E400 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E400 */ _t9 = _t8 & 0x00000001u;
         /* 0226E400 */ if (_t9) goto L_0226E404; else goto L_0226E418;
   L_0226E404: ; // 0x226e404
@@ -8533,10 +8533,10 @@ void Gambit_fn_0226E43C(CPUState* cpu) {
         /* 0226E444 */ _t1 = cpu->r[3] + 0x00000020u;
         /* 0226E444 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 0226E448 */ cpu->r[8] = cpu->r[0];
-        /* 0226E44C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 0226E44C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 0226E450 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 0226E450 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0226E454 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E454 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E454 */ _t4 = _t3 & 0x00000001u;
         /* 0226E454 */ if (_t4) goto L_0226E458; else goto L_0226E470;
   L_0226E458: ; // 0x226e458
@@ -8544,8 +8544,8 @@ void Gambit_fn_0226E43C(CPUState* cpu) {
         /* 0226E45C */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 0226E460 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0226E460 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0226E464 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0226E468 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E464 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0226E468 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E468 */ _t7 = _t6 & 0x00000001u;
         /* 0226E468 */ if (_t7) goto L_0226E46C; else goto L_0226E47C;
   L_0226E46C: ; // 0x226e46c
@@ -8553,16 +8553,16 @@ void Gambit_fn_0226E43C(CPUState* cpu) {
   L_0226E470: ; // 0x226e470
         /* 0226E470 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0226E470 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0226E474 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0226E478 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E474 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0226E478 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E478 */ _t10 = _t9 & 0x00000001u;
         /* 0226E478 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226E478 */ goto L_0226E47C;
   L_0226E47C: ; // 0x226e47c
-        /* 0226E47C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 0226E47C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 0226E480 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0226E480 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 0226E484 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E484 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E484 */ _t13 = _t12 & 0x00000001u;
         /* 0226E484 */ if (_t13) goto L_0226E488; else goto L_0226E490;
   L_0226E488: ; // 0x226e488
@@ -8573,11 +8573,11 @@ void Gambit_fn_0226E43C(CPUState* cpu) {
         /* 0226E490 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0226E494 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0226E494 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0226E498 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0226E498 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0226E49C */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0226E49C */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0226E4A0 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 0226E4A4 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E4A4 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E4A4 */ _t18 = _t17 & 0x00000001u;
         /* 0226E4A4 */ if (_t18) goto L_0226E4BC; else goto L_0226E4A8;
   L_0226E4A8: ; // 0x226e4a8
@@ -8604,10 +8604,10 @@ void Gambit_fn_0226E4C4(CPUState* cpu) {
         /* 0226E4CC */ _t1 = cpu->r[3] + 0x00000028u;
         /* 0226E4CC */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 0226E4D0 */ cpu->r[8] = cpu->r[0];
-        /* 0226E4D4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 0226E4D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 0226E4D8 */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 0226E4D8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0226E4DC */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E4DC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E4DC */ _t4 = _t3 & 0x00000001u;
         /* 0226E4DC */ if (_t4) goto L_0226E4E0; else goto L_0226E4F8;
   L_0226E4E0: ; // 0x226e4e0
@@ -8615,8 +8615,8 @@ void Gambit_fn_0226E4C4(CPUState* cpu) {
         /* 0226E4E4 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 0226E4E8 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0226E4E8 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0226E4EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0226E4F0 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E4EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0226E4F0 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E4F0 */ _t7 = _t6 & 0x00000001u;
         /* 0226E4F0 */ if (_t7) goto L_0226E4F4; else goto L_0226E504;
   L_0226E4F4: ; // 0x226e4f4
@@ -8624,16 +8624,16 @@ void Gambit_fn_0226E4C4(CPUState* cpu) {
   L_0226E4F8: ; // 0x226e4f8
         /* 0226E4F8 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0226E4F8 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0226E4FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0226E500 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E4FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0226E500 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E500 */ _t10 = _t9 & 0x00000001u;
         /* 0226E500 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226E500 */ goto L_0226E504;
   L_0226E504: ; // 0x226e504
-        /* 0226E504 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 0226E504 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 0226E508 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0226E508 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 0226E50C */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E50C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E50C */ _t13 = _t12 & 0x00000001u;
         /* 0226E50C */ if (_t13) goto L_0226E510; else goto L_0226E518;
   L_0226E510: ; // 0x226e510
@@ -8644,11 +8644,11 @@ void Gambit_fn_0226E4C4(CPUState* cpu) {
         /* 0226E518 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0226E51C */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0226E51C */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0226E520 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0226E520 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0226E524 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0226E524 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0226E528 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 0226E52C */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E52C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E52C */ _t18 = _t17 & 0x00000001u;
         /* 0226E52C */ if (_t18) goto L_0226E544; else goto L_0226E530;
   L_0226E530: ; // 0x226e530
@@ -8681,18 +8681,18 @@ void Gambit_fn_0226E54C(CPUState* cpu) {
         /* 0226E560 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0226E560 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0226E564 */ cpu->r[12] = 0x00000000u;
-        /* 0226E568 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0226E568 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0226E56C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0226E56C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0226E570 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E570 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E570 */ _t6 = _t5 & 0x00000001u;
         /* 0226E570 */ if (_t6) goto L_0226E598; else goto L_0226E574;
   L_0226E574: ; // 0x226e574
         /* 0226E574 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0226E574 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0226E578 */ /* nop */
-        /* 0226E57C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0226E580 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E57C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0226E580 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E580 */ _t9 = _t8 & 0x00000001u;
         /* 0226E580 */ if (_t9) goto L_0226E584; else goto L_0226E598;
   L_0226E584: ; // 0x226e584
@@ -8733,18 +8733,18 @@ void Gambit_fn_0226E550(CPUState* cpu) {
         /* 0226E560 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0226E560 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0226E564 */ cpu->r[12] = 0x00000000u;
-        /* 0226E568 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0226E568 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0226E56C */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0226E56C */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0226E570 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E570 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E570 */ _t6 = _t5 & 0x00000001u;
         /* 0226E570 */ if (_t6) goto L_0226E598; else goto L_0226E574;
   L_0226E574: ; // 0x226e574
         /* 0226E574 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0226E574 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0226E578 */ /* nop */
-        /* 0226E57C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0226E580 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E57C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0226E580 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E580 */ _t9 = _t8 & 0x00000001u;
         /* 0226E580 */ if (_t9) goto L_0226E584; else goto L_0226E598;
   L_0226E584: ; // 0x226e584
@@ -8780,10 +8780,10 @@ void Gambit_fn_0226E5BC(CPUState* cpu) {
         /* 0226E5C4 */ _t1 = cpu->r[3] + 0x00000030u;
         /* 0226E5C4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 0226E5C8 */ cpu->r[7] = cpu->r[0];
-        /* 0226E5CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 0226E5CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 0226E5D0 */ _t2 = cpu->r[3] + 0x00000034u;
         /* 0226E5D0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0226E5D4 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E5D4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E5D4 */ _t4 = _t3 & 0x00000001u;
         /* 0226E5D4 */ if (_t4) goto L_0226E5D8; else goto L_0226E5F0;
   L_0226E5D8: ; // 0x226e5d8
@@ -8791,8 +8791,8 @@ void Gambit_fn_0226E5BC(CPUState* cpu) {
         /* 0226E5DC */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 0226E5E0 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0226E5E0 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0226E5E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0226E5E8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E5E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0226E5E8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E5E8 */ _t7 = _t6 & 0x00000001u;
         /* 0226E5E8 */ if (_t7) goto L_0226E5EC; else goto L_0226E5FC;
   L_0226E5EC: ; // 0x226e5ec
@@ -8800,16 +8800,16 @@ void Gambit_fn_0226E5BC(CPUState* cpu) {
   L_0226E5F0: ; // 0x226e5f0
         /* 0226E5F0 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0226E5F0 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0226E5F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0226E5F8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E5F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0226E5F8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E5F8 */ _t10 = _t9 & 0x00000001u;
         /* 0226E5F8 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226E5F8 */ goto L_0226E5FC;
   L_0226E5FC: ; // 0x226e5fc
-        /* 0226E5FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 0226E5FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 0226E600 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0226E600 */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 0226E604 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E604 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E604 */ _t13 = _t12 & 0x00000001u;
         /* 0226E604 */ if (_t13) goto L_0226E608; else goto L_0226E610;
   L_0226E608: ; // 0x226e608
@@ -8820,11 +8820,11 @@ void Gambit_fn_0226E5BC(CPUState* cpu) {
         /* 0226E610 */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0226E614 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0226E614 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0226E618 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0226E618 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0226E61C */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0226E61C */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0226E620 */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 0226E624 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E624 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E624 */ _t18 = _t17 & 0x00000001u;
         /* 0226E624 */ if (_t18) goto L_0226E63C; else goto L_0226E628;
   L_0226E628: ; // 0x226e628
@@ -8859,9 +8859,9 @@ void Gambit_fn_0226E644(CPUState* cpu) {
         /* 0226E65C */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 0226E65C */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 0226E660 */ /* nop */
-        /* 0226E664 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 0226E664 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 0226E668 */ cpu->r[31] = cpu->r[4];
-        /* 0226E66C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E66C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E66C */ _t6 = _t5 & 0x00000001u;
         /* 0226E66C */ if (_t6) goto L_0226E670; else goto L_0226E684;
   L_0226E670: ; // 0x226e670
@@ -8910,9 +8910,9 @@ void Gambit_fn_0226E648(CPUState* cpu) {
         /* 0226E65C */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 0226E65C */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 0226E660 */ /* nop */
-        /* 0226E664 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 0226E664 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 0226E668 */ cpu->r[31] = cpu->r[4];
-        /* 0226E66C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E66C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E66C */ _t6 = _t5 & 0x00000001u;
         /* 0226E66C */ if (_t6) goto L_0226E670; else goto L_0226E684;
   L_0226E670: ; // 0x226e670
@@ -8954,10 +8954,10 @@ void Gambit_fn_0226E6BC(CPUState* cpu) {
         /* 0226E6C4 */ _t1 = cpu->r[3] + 0x00000020u;
         /* 0226E6C4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 0226E6C8 */ cpu->r[8] = cpu->r[0];
-        /* 0226E6CC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 0226E6CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 0226E6D0 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 0226E6D0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0226E6D4 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E6D4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E6D4 */ _t4 = _t3 & 0x00000001u;
         /* 0226E6D4 */ if (_t4) goto L_0226E6D8; else goto L_0226E6F0;
   L_0226E6D8: ; // 0x226e6d8
@@ -8965,8 +8965,8 @@ void Gambit_fn_0226E6BC(CPUState* cpu) {
         /* 0226E6DC */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 0226E6E0 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0226E6E0 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0226E6E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0226E6E8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E6E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0226E6E8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E6E8 */ _t7 = _t6 & 0x00000001u;
         /* 0226E6E8 */ if (_t7) goto L_0226E6EC; else goto L_0226E6FC;
   L_0226E6EC: ; // 0x226e6ec
@@ -8974,16 +8974,16 @@ void Gambit_fn_0226E6BC(CPUState* cpu) {
   L_0226E6F0: ; // 0x226e6f0
         /* 0226E6F0 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0226E6F0 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0226E6F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0226E6F8 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E6F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0226E6F8 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E6F8 */ _t10 = _t9 & 0x00000001u;
         /* 0226E6F8 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226E6F8 */ goto L_0226E6FC;
   L_0226E6FC: ; // 0x226e6fc
-        /* 0226E6FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 0226E6FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 0226E700 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0226E700 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 0226E704 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E704 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E704 */ _t13 = _t12 & 0x00000001u;
         /* 0226E704 */ if (_t13) goto L_0226E708; else goto L_0226E710;
   L_0226E708: ; // 0x226e708
@@ -8994,11 +8994,11 @@ void Gambit_fn_0226E6BC(CPUState* cpu) {
         /* 0226E710 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0226E714 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0226E714 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0226E718 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0226E718 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0226E71C */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0226E71C */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0226E720 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 0226E724 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E724 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E724 */ _t18 = _t17 & 0x00000001u;
         /* 0226E724 */ if (_t18) goto L_0226E73C; else goto L_0226E728;
   L_0226E728: ; // 0x226e728
@@ -9025,10 +9025,10 @@ void Gambit_fn_0226E744(CPUState* cpu) {
         /* 0226E74C */ _t1 = cpu->r[3] + 0x00000028u;
         /* 0226E74C */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 0226E750 */ cpu->r[8] = cpu->r[0];
-        /* 0226E754 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 0226E754 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 0226E758 */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 0226E758 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0226E75C */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E75C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E75C */ _t4 = _t3 & 0x00000001u;
         /* 0226E75C */ if (_t4) goto L_0226E760; else goto L_0226E778;
   L_0226E760: ; // 0x226e760
@@ -9036,8 +9036,8 @@ void Gambit_fn_0226E744(CPUState* cpu) {
         /* 0226E764 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 0226E768 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0226E768 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0226E76C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0226E770 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E76C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0226E770 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E770 */ _t7 = _t6 & 0x00000001u;
         /* 0226E770 */ if (_t7) goto L_0226E774; else goto L_0226E784;
   L_0226E774: ; // 0x226e774
@@ -9045,16 +9045,16 @@ void Gambit_fn_0226E744(CPUState* cpu) {
   L_0226E778: ; // 0x226e778
         /* 0226E778 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0226E778 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0226E77C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0226E780 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E77C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0226E780 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E780 */ _t10 = _t9 & 0x00000001u;
         /* 0226E780 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226E780 */ goto L_0226E784;
   L_0226E784: ; // 0x226e784
-        /* 0226E784 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 0226E784 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 0226E788 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0226E788 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 0226E78C */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E78C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E78C */ _t13 = _t12 & 0x00000001u;
         /* 0226E78C */ if (_t13) goto L_0226E790; else goto L_0226E798;
   L_0226E790: ; // 0x226e790
@@ -9065,11 +9065,11 @@ void Gambit_fn_0226E744(CPUState* cpu) {
         /* 0226E798 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0226E79C */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0226E79C */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0226E7A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0226E7A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0226E7A4 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0226E7A4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0226E7A8 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 0226E7AC */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E7AC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E7AC */ _t18 = _t17 & 0x00000001u;
         /* 0226E7AC */ if (_t18) goto L_0226E7C4; else goto L_0226E7B0;
   L_0226E7B0: ; // 0x226e7b0
@@ -9102,18 +9102,18 @@ void Gambit_fn_0226E7CC(CPUState* cpu) {
         /* 0226E7E0 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0226E7E0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0226E7E4 */ cpu->r[12] = 0x00000000u;
-        /* 0226E7E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0226E7E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0226E7EC */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0226E7EC */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0226E7F0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E7F0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E7F0 */ _t6 = _t5 & 0x00000001u;
         /* 0226E7F0 */ if (_t6) goto L_0226E818; else goto L_0226E7F4;
   L_0226E7F4: ; // 0x226e7f4
         /* 0226E7F4 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0226E7F4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0226E7F8 */ /* nop */
-        /* 0226E7FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0226E800 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E7FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0226E800 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E800 */ _t9 = _t8 & 0x00000001u;
         /* 0226E800 */ if (_t9) goto L_0226E804; else goto L_0226E818;
   L_0226E804: ; // 0x226e804
@@ -9154,18 +9154,18 @@ void Gambit_fn_0226E7D0(CPUState* cpu) {
         /* 0226E7E0 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 0226E7E0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 0226E7E4 */ cpu->r[12] = 0x00000000u;
-        /* 0226E7E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0226E7E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0226E7EC */ _t4 = cpu->r[31] + 0x00000011u;
         /* 0226E7EC */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 0226E7F0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E7F0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E7F0 */ _t6 = _t5 & 0x00000001u;
         /* 0226E7F0 */ if (_t6) goto L_0226E818; else goto L_0226E7F4;
   L_0226E7F4: ; // 0x226e7f4
         /* 0226E7F4 */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 0226E7F4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 0226E7F8 */ /* nop */
-        /* 0226E7FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 0226E800 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E7FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 0226E800 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E800 */ _t9 = _t8 & 0x00000001u;
         /* 0226E800 */ if (_t9) goto L_0226E804; else goto L_0226E818;
   L_0226E804: ; // 0x226e804
@@ -9201,10 +9201,10 @@ void Gambit_fn_0226E83C(CPUState* cpu) {
         /* 0226E844 */ _t1 = cpu->r[3] + 0x00000030u;
         /* 0226E844 */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 0226E848 */ cpu->r[7] = cpu->r[0];
-        /* 0226E84C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 0226E84C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 0226E850 */ _t2 = cpu->r[3] + 0x00000034u;
         /* 0226E850 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 0226E854 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E854 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E854 */ _t4 = _t3 & 0x00000001u;
         /* 0226E854 */ if (_t4) goto L_0226E858; else goto L_0226E870;
   L_0226E858: ; // 0x226e858
@@ -9212,8 +9212,8 @@ void Gambit_fn_0226E83C(CPUState* cpu) {
         /* 0226E85C */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 0226E860 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 0226E860 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0226E864 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0226E868 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E864 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0226E868 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E868 */ _t7 = _t6 & 0x00000001u;
         /* 0226E868 */ if (_t7) goto L_0226E86C; else goto L_0226E87C;
   L_0226E86C: ; // 0x226e86c
@@ -9221,16 +9221,16 @@ void Gambit_fn_0226E83C(CPUState* cpu) {
   L_0226E870: ; // 0x226e870
         /* 0226E870 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 0226E870 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0226E874 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0226E878 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E874 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0226E878 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E878 */ _t10 = _t9 & 0x00000001u;
         /* 0226E878 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0226E878 */ goto L_0226E87C;
   L_0226E87C: ; // 0x226e87c
-        /* 0226E87C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 0226E87C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 0226E880 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 0226E880 */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 0226E884 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E884 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E884 */ _t13 = _t12 & 0x00000001u;
         /* 0226E884 */ if (_t13) goto L_0226E888; else goto L_0226E890;
   L_0226E888: ; // 0x226e888
@@ -9241,11 +9241,11 @@ void Gambit_fn_0226E83C(CPUState* cpu) {
         /* 0226E890 */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0226E894 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0226E894 */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 0226E898 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 0226E898 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0226E89C */ _t16 = cpu->r[12] + 0x00000004u;
         /* 0226E89C */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 0226E8A0 */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 0226E8A4 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226E8A4 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226E8A4 */ _t18 = _t17 & 0x00000001u;
         /* 0226E8A4 */ if (_t18) goto L_0226E8BC; else goto L_0226E8A8;
   L_0226E8A8: ; // 0x226e8a8
@@ -9280,9 +9280,9 @@ void Gambit_fn_0226E8C4(CPUState* cpu) {
         /* 0226E8DC */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 0226E8DC */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 0226E8E0 */ /* nop */
-        /* 0226E8E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 0226E8E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 0226E8E8 */ cpu->r[31] = cpu->r[4];
-        /* 0226E8EC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E8EC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E8EC */ _t6 = _t5 & 0x00000001u;
         /* 0226E8EC */ if (_t6) goto L_0226E8F0; else goto L_0226E904;
   L_0226E8F0: ; // 0x226e8f0
@@ -9331,9 +9331,9 @@ void Gambit_fn_0226E8C8(CPUState* cpu) {
         /* 0226E8DC */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 0226E8DC */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 0226E8E0 */ /* nop */
-        /* 0226E8E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 0226E8E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 0226E8E8 */ cpu->r[31] = cpu->r[4];
-        /* 0226E8EC */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E8EC */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E8EC */ _t6 = _t5 & 0x00000001u;
         /* 0226E8EC */ if (_t6) goto L_0226E8F0; else goto L_0226E904;
   L_0226E8F0: ; // 0x226e8f0
@@ -9385,8 +9385,8 @@ void Gambit_fn_0226E93C(CPUState* cpu) {
         /* 0226E964 */ cpu->r[4] = cpu->r[27];
         /* 0226E968 */ Gambit_fn_027DB318(cpu);
         /* 0226E96C */ cpu->r[28] = cpu->r[3] + cpu->r[31];
-        /* 0226E96C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 0226E970 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E96C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 0226E970 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E970 */ _t3 = _t2 & 0x00000001u;
         /* 0226E970 */ if (_t3) goto L_0226EA04; else goto L_0226E974;
   L_0226E974: ; // 0x226e974
@@ -9400,24 +9400,24 @@ void Gambit_fn_0226E93C(CPUState* cpu) {
         /* 0226E988 */ cpu->r[0] = rbrew_read32(cpu->mem, _t5);
         /* 0226E98C */ cpu->r[30] = cpu->r[30] - cpu->r[29];
         /* 0226E990 */ cpu->r[31] = cpu->r[0] - cpu->r[29];
-        /* 0226E994 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[30]);
+        /* 0226E994 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[30]));
         /* 0226E998 */ cpu->r[25] = 0x00000000u;
-        /* 0226E99C */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E99C */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E99C */ _t7 = _t6 & 0x00000001u;
         /* 0226E99C */ if (_t7) goto L_0226EA04; else goto L_0226E9A0;
   L_0226E9A0: ; // 0x226e9a0
         /* 0226E9A0 */ cpu->r[24] = 0x101C0000u;
   L_0226E9A4: ; // 0x226e9a4
-        /* 0226E9A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 0226E9A8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E9A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 0226E9A8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E9A8 */ _t9 = _t8 & 0x00000001u;
         /* 0226E9A8 */ if (_t9) goto L_0226E9C0; else goto L_0226E9AC;
   L_0226E9AC: ; // 0x226e9ac
         /* 0226E9AC */ cpu->ctr = cpu->r[27];
         /* 0226E9B0 */ cpu->r[3] = cpu->r[31];
         /* 0226E9B4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226E9B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226E9BC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E9B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226E9BC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226E9BC */ _t11 = _t10 & 0x00000001u;
         /* 0226E9BC */ if (_t11) goto L_0226E9F0; else goto L_0226E9C0;
   L_0226E9C0: ; // 0x226e9c0
@@ -9444,8 +9444,8 @@ void Gambit_fn_0226E93C(CPUState* cpu) {
         /* 0226E9F4 */ _t18 = cpu->r[12] + 0x00000004u;
         /* 0226E9F4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t18);
         /* 0226E9F8 */ cpu->r[31] = cpu->r[0] - cpu->r[29];
-        /* 0226E9FC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[30]);
-        /* 0226EA00 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226E9FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[30]));
+        /* 0226EA00 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EA00 */ _t20 = _t19 & 0x00000001u;
         /* 0226EA00 */ if (_t20) goto L_0226EA04; else goto L_0226E9A4;
   L_0226EA04: ; // 0x226ea04
@@ -9475,20 +9475,20 @@ void Gambit_fn_0226EA1C(CPUState* cpu) {
         /* 0226EA30 */ _t3 = cpu->r[1] + 0x00000018u;
         /* 0226EA30 */ rbrew_write_f32(cpu->mem, _t3, cpu->f[31]);
         /* 0226EA34 */ cpu->r[31] = cpu->r[3];
-        /* 0226EA34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0226EA34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0226EA38 */ _t4 = cpu->r[1] + 0x00000008u;
         /* 0226EA38 */ rbrew_write32(cpu->mem, _t4, cpu->r[30]);
         /* 0226EA3C */ _t5 = cpu->r[1] + 0x00000024u;
         /* 0226EA3C */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
-        /* 0226EA40 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EA40 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EA40 */ _t7 = _t6 & 0x00000001u;
         /* 0226EA40 */ if (_t7) goto L_0226EA44; else goto L_0226EA54;
   L_0226EA44: ; // 0x226ea44
         /* 0226EA44 */ cpu->r[3] = 0x00000184u;
         /* 0226EA48 */ Gambit_fn_02801A78(cpu);
         /* 0226EA4C */ cpu->r[31] = cpu->r[3];
-        /* 0226EA4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226EA50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EA4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226EA50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EA50 */ _t9 = _t8 & 0x00000001u;
         /* 0226EA50 */ if (_t9) goto L_0226EC54; else goto L_0226EA54;
   L_0226EA54: ; // 0x226ea54
@@ -9506,7 +9506,7 @@ void Gambit_fn_0226EA1C(CPUState* cpu) {
         /* 0226EA78 */ _t12 = cpu->r[10] + 0xFFFF8F18u;
         /* 0226EA78 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t12);
         /* 0226EA7C */ cpu->r[3] = cpu->r[31] + 0x00000078u;
-        /* 0226EA7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0226EA7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0226EA80 */ _t13 = cpu->r[31] + 0x00000068u;
         /* 0226EA80 */ rbrew_write16(cpu->mem, _t13, (uint16_t)cpu->r[0]);
         /* 0226EA84 */ _t14 = cpu->r[31] + 0x0000006Cu;
@@ -9530,26 +9530,26 @@ void Gambit_fn_0226EA1C(CPUState* cpu) {
         /* 0226EAA8 */ rbrew_write32(cpu->mem, _t22, cpu->r[30]);
         /* 0226EAAC */ _t23 = cpu->r[31] + 0x00000054u;
         /* 0226EAAC */ rbrew_write32(cpu->mem, _t23, cpu->r[30]);
-        /* 0226EAB0 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EAB0 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EAB0 */ _t25 = _t24 & 0x00000001u;
         /* 0226EAB0 */ if (_t25) goto L_0226EAB4; else goto L_0226EAC4;
   L_0226EAB4: ; // 0x226eab4
         /* 0226EAB4 */ cpu->r[3] = 0x0000000Cu;
         /* 0226EAB8 */ Gambit_fn_02801A78(cpu);
-        /* 0226EABC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226EAC0 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EABC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226EAC0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EAC0 */ _t27 = _t26 & 0x00000001u;
         /* 0226EAC0 */ if (_t27) goto L_0226EAE8; else goto L_0226EAC4;
   L_0226EAC4: ; // 0x226eac4
-        /* 0226EAC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226EAC8 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EAC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226EAC8 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EAC8 */ _t29 = _t28 & 0x00000001u;
         /* 0226EAC8 */ if (_t29) goto L_0226EACC; else goto L_0226EADC;
   L_0226EACC: ; // 0x226eacc
         /* 0226EACC */ cpu->r[3] = 0x0000000Cu;
         /* 0226EAD0 */ Gambit_fn_02801A78(cpu);
-        /* 0226EAD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226EAD8 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EAD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226EAD8 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EAD8 */ _t31 = _t30 & 0x00000001u;
         /* 0226EAD8 */ if (_t31) goto L_0226EAE8; else goto L_0226EADC;
   L_0226EADC: ; // 0x226eadc
@@ -9563,7 +9563,7 @@ void Gambit_fn_0226EA1C(CPUState* cpu) {
         /* 0226EAE8 */ _t35 = cpu->r[31] + 0x00000098u;
         /* 0226EAE8 */ rbrew_write32(cpu->mem, _t35, cpu->r[30]);
         /* 0226EAEC */ cpu->r[3] = cpu->r[31] + 0x0000009Cu;
-        /* 0226EAEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0226EAEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0226EAF0 */ _t36 = cpu->r[31] + 0x0000008Cu;
         /* 0226EAF0 */ rbrew_write32(cpu->mem, _t36, cpu->r[30]);
         /* 0226EAF4 */ _t37 = cpu->r[31] + 0x00000090u;
@@ -9574,14 +9574,14 @@ void Gambit_fn_0226EA1C(CPUState* cpu) {
         /* 0226EAFC */ rbrew_write32(cpu->mem, _t39, cpu->r[30]);
         /* 0226EB00 */ _t40 = cpu->r[31] + 0x00000088u;
         /* 0226EB00 */ rbrew_write32(cpu->mem, _t40, cpu->r[30]);
-        /* 0226EB04 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EB04 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EB04 */ _t42 = _t41 & 0x00000001u;
         /* 0226EB04 */ if (_t42) goto L_0226EB08; else goto L_0226EB18;
   L_0226EB08: ; // 0x226eb08
         /* 0226EB08 */ cpu->r[3] = 0x00000004u;
         /* 0226EB0C */ Gambit_fn_02801A78(cpu);
-        /* 0226EB10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226EB14 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EB10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226EB14 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EB14 */ _t44 = _t43 & 0x00000001u;
         /* 0226EB14 */ if (_t44) goto L_0226EB1C; else goto L_0226EB18;
   L_0226EB18: ; // 0x226eb18
@@ -9690,21 +9690,21 @@ void Gambit_fn_0226EA1C(CPUState* cpu) {
         /* 0226EBDC */ if (_t87) goto L_0226EBBC; else goto L_0226EBE0;
   L_0226EBE0: ; // 0x226ebe0
         /* 0226EBE0 */ cpu->r[30] = cpu->r[31] + 0x0000014Cu;
-        /* 0226EBE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0226EBE4 */ _t88 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EBE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0226EBE4 */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EBE4 */ _t89 = _t88 & 0x00000001u;
         /* 0226EBE4 */ if (_t89) goto L_0226EBE8; else goto L_0226EBF8;
   L_0226EBE8: ; // 0x226ebe8
         /* 0226EBE8 */ cpu->r[3] = 0x00000024u;
         /* 0226EBEC */ Gambit_fn_02801A78(cpu);
         /* 0226EBF0 */ cpu->r[30] = cpu->r[3];
-        /* 0226EBF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0226EBF4 */ _t90 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EBF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0226EBF4 */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EBF4 */ _t91 = _t90 & 0x00000001u;
         /* 0226EBF4 */ if (_t91) goto L_0226EC28; else goto L_0226EBF8;
   L_0226EBF8: ; // 0x226ebf8
-        /* 0226EBF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0226EBFC */ _t92 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EBF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0226EBFC */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EBFC */ _t93 = _t92 & 0x00000001u;
         /* 0226EBFC */ if (_t93) goto L_0226EC00; else goto L_0226EC08;
   L_0226EC00: ; // 0x226ec00
@@ -9712,8 +9712,8 @@ void Gambit_fn_0226EA1C(CPUState* cpu) {
         /* 0226EC04 */ Gambit_fn_02801A78(cpu);
   L_0226EC08: ; // 0x226ec08
         /* 0226EC08 */ cpu->r[6] = cpu->r[30] + 0x0000000Cu;
-        /* 0226EC08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0226EC0C */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EC08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0226EC0C */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EC0C */ _t95 = _t94 & 0x00000001u;
         /* 0226EC0C */ if (_t95) goto L_0226EC10; else goto L_0226EC18;
   L_0226EC10: ; // 0x226ec10
@@ -9721,8 +9721,8 @@ void Gambit_fn_0226EA1C(CPUState* cpu) {
         /* 0226EC14 */ Gambit_fn_02801A78(cpu);
   L_0226EC18: ; // 0x226ec18
         /* 0226EC18 */ cpu->r[7] = cpu->r[30] + 0x00000018u;
-        /* 0226EC18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0226EC1C */ _t96 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EC18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0226EC1C */ _t96 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EC1C */ _t97 = _t96 & 0x00000001u;
         /* 0226EC1C */ if (_t97) goto L_0226EC20; else goto L_0226EC28;
   L_0226EC20: ; // 0x226ec20
@@ -9731,8 +9731,8 @@ void Gambit_fn_0226EA1C(CPUState* cpu) {
   L_0226EC28: ; // 0x226ec28
         /* 0226EC28 */ cpu->r[8] = cpu->r[31] + 0x0000014Cu;
         /* 0226EC2C */ cpu->r[0] = cpu->r[8] + 0x00000024u;
-        /* 0226EC2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226EC30 */ _t98 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EC2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226EC30 */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EC30 */ _t99 = _t98 & 0x00000001u;
         /* 0226EC30 */ if (_t99) goto L_0226EC34; else goto L_0226EC3C;
   L_0226EC34: ; // 0x226ec34
@@ -9759,7 +9759,7 @@ void Gambit_fn_0226EA1C(CPUState* cpu) {
         /* 0226EC60 */ cpu->r[31] = rbrew_read32(cpu->mem, _t106);
         /* 0226EC64 */ _t107 = cpu->r[1] + 0x00000010u;
         /* 0226EC64 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t107);
-        /* 0226EC68 */ _t108 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226EC68 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226EC68 */ _t109 = _t108 & 0x00000001u;
         /* 0226EC68 */ if (_t109) goto L_0226EC6C; // else: addr-0 trap, fall-through
   L_0226EC6C: ; // 0x226ec6c
@@ -9786,20 +9786,20 @@ void Gambit_fn_0226EA20(CPUState* cpu) {
         /* 0226EA30 */ _t3 = cpu->r[1] + 0x00000018u;
         /* 0226EA30 */ rbrew_write_f32(cpu->mem, _t3, cpu->f[31]);
         /* 0226EA34 */ cpu->r[31] = cpu->r[3];
-        /* 0226EA34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0226EA34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0226EA38 */ _t4 = cpu->r[1] + 0x00000008u;
         /* 0226EA38 */ rbrew_write32(cpu->mem, _t4, cpu->r[30]);
         /* 0226EA3C */ _t5 = cpu->r[1] + 0x00000024u;
         /* 0226EA3C */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
-        /* 0226EA40 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EA40 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EA40 */ _t7 = _t6 & 0x00000001u;
         /* 0226EA40 */ if (_t7) goto L_0226EA44; else goto L_0226EA54;
   L_0226EA44: ; // 0x226ea44
         /* 0226EA44 */ cpu->r[3] = 0x00000184u;
         /* 0226EA48 */ Gambit_fn_02801A78(cpu);
         /* 0226EA4C */ cpu->r[31] = cpu->r[3];
-        /* 0226EA4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226EA50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EA4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226EA50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EA50 */ _t9 = _t8 & 0x00000001u;
         /* 0226EA50 */ if (_t9) goto L_0226EC54; else goto L_0226EA54;
   L_0226EA54: ; // 0x226ea54
@@ -9817,7 +9817,7 @@ void Gambit_fn_0226EA20(CPUState* cpu) {
         /* 0226EA78 */ _t12 = cpu->r[10] + 0xFFFF8F18u;
         /* 0226EA78 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t12);
         /* 0226EA7C */ cpu->r[3] = cpu->r[31] + 0x00000078u;
-        /* 0226EA7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0226EA7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0226EA80 */ _t13 = cpu->r[31] + 0x00000068u;
         /* 0226EA80 */ rbrew_write16(cpu->mem, _t13, (uint16_t)cpu->r[0]);
         /* 0226EA84 */ _t14 = cpu->r[31] + 0x0000006Cu;
@@ -9841,26 +9841,26 @@ void Gambit_fn_0226EA20(CPUState* cpu) {
         /* 0226EAA8 */ rbrew_write32(cpu->mem, _t22, cpu->r[30]);
         /* 0226EAAC */ _t23 = cpu->r[31] + 0x00000054u;
         /* 0226EAAC */ rbrew_write32(cpu->mem, _t23, cpu->r[30]);
-        /* 0226EAB0 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EAB0 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EAB0 */ _t25 = _t24 & 0x00000001u;
         /* 0226EAB0 */ if (_t25) goto L_0226EAB4; else goto L_0226EAC4;
   L_0226EAB4: ; // 0x226eab4
         /* 0226EAB4 */ cpu->r[3] = 0x0000000Cu;
         /* 0226EAB8 */ Gambit_fn_02801A78(cpu);
-        /* 0226EABC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226EAC0 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EABC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226EAC0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EAC0 */ _t27 = _t26 & 0x00000001u;
         /* 0226EAC0 */ if (_t27) goto L_0226EAE8; else goto L_0226EAC4;
   L_0226EAC4: ; // 0x226eac4
-        /* 0226EAC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226EAC8 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EAC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226EAC8 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EAC8 */ _t29 = _t28 & 0x00000001u;
         /* 0226EAC8 */ if (_t29) goto L_0226EACC; else goto L_0226EADC;
   L_0226EACC: ; // 0x226eacc
         /* 0226EACC */ cpu->r[3] = 0x0000000Cu;
         /* 0226EAD0 */ Gambit_fn_02801A78(cpu);
-        /* 0226EAD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226EAD8 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EAD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226EAD8 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EAD8 */ _t31 = _t30 & 0x00000001u;
         /* 0226EAD8 */ if (_t31) goto L_0226EAE8; else goto L_0226EADC;
   L_0226EADC: ; // 0x226eadc
@@ -9874,7 +9874,7 @@ void Gambit_fn_0226EA20(CPUState* cpu) {
         /* 0226EAE8 */ _t35 = cpu->r[31] + 0x00000098u;
         /* 0226EAE8 */ rbrew_write32(cpu->mem, _t35, cpu->r[30]);
         /* 0226EAEC */ cpu->r[3] = cpu->r[31] + 0x0000009Cu;
-        /* 0226EAEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0226EAEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0226EAF0 */ _t36 = cpu->r[31] + 0x0000008Cu;
         /* 0226EAF0 */ rbrew_write32(cpu->mem, _t36, cpu->r[30]);
         /* 0226EAF4 */ _t37 = cpu->r[31] + 0x00000090u;
@@ -9885,14 +9885,14 @@ void Gambit_fn_0226EA20(CPUState* cpu) {
         /* 0226EAFC */ rbrew_write32(cpu->mem, _t39, cpu->r[30]);
         /* 0226EB00 */ _t40 = cpu->r[31] + 0x00000088u;
         /* 0226EB00 */ rbrew_write32(cpu->mem, _t40, cpu->r[30]);
-        /* 0226EB04 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EB04 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EB04 */ _t42 = _t41 & 0x00000001u;
         /* 0226EB04 */ if (_t42) goto L_0226EB08; else goto L_0226EB18;
   L_0226EB08: ; // 0x226eb08
         /* 0226EB08 */ cpu->r[3] = 0x00000004u;
         /* 0226EB0C */ Gambit_fn_02801A78(cpu);
-        /* 0226EB10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226EB14 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EB10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226EB14 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EB14 */ _t44 = _t43 & 0x00000001u;
         /* 0226EB14 */ if (_t44) goto L_0226EB1C; else goto L_0226EB18;
   L_0226EB18: ; // 0x226eb18
@@ -10001,21 +10001,21 @@ void Gambit_fn_0226EA20(CPUState* cpu) {
         /* 0226EBDC */ if (_t87) goto L_0226EBBC; else goto L_0226EBE0;
   L_0226EBE0: ; // 0x226ebe0
         /* 0226EBE0 */ cpu->r[30] = cpu->r[31] + 0x0000014Cu;
-        /* 0226EBE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0226EBE4 */ _t88 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EBE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0226EBE4 */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EBE4 */ _t89 = _t88 & 0x00000001u;
         /* 0226EBE4 */ if (_t89) goto L_0226EBE8; else goto L_0226EBF8;
   L_0226EBE8: ; // 0x226ebe8
         /* 0226EBE8 */ cpu->r[3] = 0x00000024u;
         /* 0226EBEC */ Gambit_fn_02801A78(cpu);
         /* 0226EBF0 */ cpu->r[30] = cpu->r[3];
-        /* 0226EBF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0226EBF4 */ _t90 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EBF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0226EBF4 */ _t90 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EBF4 */ _t91 = _t90 & 0x00000001u;
         /* 0226EBF4 */ if (_t91) goto L_0226EC28; else goto L_0226EBF8;
   L_0226EBF8: ; // 0x226ebf8
-        /* 0226EBF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0226EBFC */ _t92 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EBF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0226EBFC */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EBFC */ _t93 = _t92 & 0x00000001u;
         /* 0226EBFC */ if (_t93) goto L_0226EC00; else goto L_0226EC08;
   L_0226EC00: ; // 0x226ec00
@@ -10023,8 +10023,8 @@ void Gambit_fn_0226EA20(CPUState* cpu) {
         /* 0226EC04 */ Gambit_fn_02801A78(cpu);
   L_0226EC08: ; // 0x226ec08
         /* 0226EC08 */ cpu->r[6] = cpu->r[30] + 0x0000000Cu;
-        /* 0226EC08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0226EC0C */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EC08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0226EC0C */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EC0C */ _t95 = _t94 & 0x00000001u;
         /* 0226EC0C */ if (_t95) goto L_0226EC10; else goto L_0226EC18;
   L_0226EC10: ; // 0x226ec10
@@ -10032,8 +10032,8 @@ void Gambit_fn_0226EA20(CPUState* cpu) {
         /* 0226EC14 */ Gambit_fn_02801A78(cpu);
   L_0226EC18: ; // 0x226ec18
         /* 0226EC18 */ cpu->r[7] = cpu->r[30] + 0x00000018u;
-        /* 0226EC18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0226EC1C */ _t96 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EC18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0226EC1C */ _t96 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EC1C */ _t97 = _t96 & 0x00000001u;
         /* 0226EC1C */ if (_t97) goto L_0226EC20; else goto L_0226EC28;
   L_0226EC20: ; // 0x226ec20
@@ -10042,8 +10042,8 @@ void Gambit_fn_0226EA20(CPUState* cpu) {
   L_0226EC28: ; // 0x226ec28
         /* 0226EC28 */ cpu->r[8] = cpu->r[31] + 0x0000014Cu;
         /* 0226EC2C */ cpu->r[0] = cpu->r[8] + 0x00000024u;
-        /* 0226EC2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226EC30 */ _t98 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EC2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226EC30 */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EC30 */ _t99 = _t98 & 0x00000001u;
         /* 0226EC30 */ if (_t99) goto L_0226EC34; else goto L_0226EC3C;
   L_0226EC34: ; // 0x226ec34
@@ -10070,7 +10070,7 @@ void Gambit_fn_0226EA20(CPUState* cpu) {
         /* 0226EC60 */ cpu->r[31] = rbrew_read32(cpu->mem, _t106);
         /* 0226EC64 */ _t107 = cpu->r[1] + 0x00000010u;
         /* 0226EC64 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t107);
-        /* 0226EC68 */ _t108 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226EC68 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226EC68 */ _t109 = _t108 & 0x00000001u;
         /* 0226EC68 */ if (_t109) goto L_0226EC6C; // else: addr-0 trap, fall-through
   L_0226EC6C: ; // 0x226ec6c
@@ -10103,8 +10103,8 @@ void Gambit_fn_0226EC7C(CPUState* cpu) {
         /* 0226EC9C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0226ECA0 */ _t5 = cpu->r[31] + 0x00000008u;
         /* 0226ECA0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t5);
-        /* 0226ECA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226ECA8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226ECA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226ECA8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226ECA8 */ _t7 = _t6 & 0x00000001u;
         /* 0226ECA8 */ if (_t7) goto L_0226ECC4; else goto L_0226ECAC;
   L_0226ECAC: ; // 0x226ecac
@@ -10155,8 +10155,8 @@ void Gambit_fn_0226EC80(CPUState* cpu) {
         /* 0226EC9C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0226ECA0 */ _t5 = cpu->r[31] + 0x00000008u;
         /* 0226ECA0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t5);
-        /* 0226ECA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226ECA8 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226ECA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226ECA8 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226ECA8 */ _t7 = _t6 & 0x00000001u;
         /* 0226ECA8 */ if (_t7) goto L_0226ECC4; else goto L_0226ECAC;
   L_0226ECAC: ; // 0x226ecac
@@ -10202,8 +10202,8 @@ void Gambit_fn_0226ECF4(CPUState* cpu) {
         /* 0226ED04 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0226ED08 */ _t3 = cpu->r[31] + 0x00000070u;
         /* 0226ED08 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
-        /* 0226ED0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226ED10 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226ED0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226ED10 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226ED10 */ _t5 = _t4 & 0x00000001u;
         /* 0226ED10 */ if (_t5) goto L_0226ED18; else goto L_0226ED14;
   L_0226ED14: ; // 0x226ed14
@@ -10235,8 +10235,8 @@ void Gambit_fn_0226ECF8(CPUState* cpu) {
         /* 0226ED04 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0226ED08 */ _t3 = cpu->r[31] + 0x00000070u;
         /* 0226ED08 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
-        /* 0226ED0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226ED10 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226ED0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226ED10 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226ED10 */ _t5 = _t4 & 0x00000001u;
         /* 0226ED10 */ if (_t5) goto L_0226ED18; else goto L_0226ED14;
   L_0226ED14: ; // 0x226ed14
@@ -10263,9 +10263,9 @@ void Gambit_fn_0226ED34(CPUState* cpu) {
         /* 0226ED38 */ cpu->r[11] = 0x101C0000u;
         /* 0226ED3C */ _t1 = cpu->r[11] + 0x000059ACu;
         /* 0226ED3C */ cpu->r[11] = rbrew_read32(cpu->mem, _t1);
-        /* 0226ED40 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000022u);
+        /* 0226ED40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000022u));
         /* 0226ED44 */ cpu->r[12] = cpu->r[11] + 0x00000010u;
-        /* 0226ED48 */ _t2 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226ED48 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226ED48 */ _t3 = _t2 & 0x00000001u;
         /* 0226ED48 */ if (_t3) goto L_0226ED4C; else goto L_0226ED54;
   L_0226ED4C: ; // 0x226ed4c
@@ -10300,9 +10300,9 @@ void Gambit_fn_0226ED5C(CPUState* cpu) {
         /* 0226ED7C */ cpu->r[10] = _t4;
         /* 0226ED80 */ cpu->r[31] = cpu->r[3];
         /* 0226ED84 */ cpu->r[4] = 0x101D0000u;
-        /* 0226ED88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0226ED88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0226ED8C */ cpu->r[4] = cpu->r[4] + 0xFFFFFFE8u;
-        /* 0226ED90 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226ED90 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226ED90 */ _t6 = _t5 & 0x00000001u;
         /* 0226ED90 */ if (_t6) goto L_0226ED94; else goto L_0226EDA8;
   L_0226ED94: ; // 0x226ed94
@@ -10314,8 +10314,8 @@ void Gambit_fn_0226ED5C(CPUState* cpu) {
         /* 0226EDA4 */ _t8 = cpu->r[4] + 0x00000000u;
         /* 0226EDA4 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
   L_0226EDA8: ; // 0x226eda8
-        /* 0226EDA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226EDAC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EDA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226EDAC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EDAC */ _t10 = _t9 & 0x00000001u;
         /* 0226EDAC */ if (_t10) goto L_0226EDCC; else goto L_0226EDB0;
   L_0226EDB0: ; // 0x226edb0
@@ -10326,8 +10326,8 @@ void Gambit_fn_0226ED5C(CPUState* cpu) {
         /* 0226EDB8 */ cpu->ctr = cpu->r[0];
         /* 0226EDBC */ cpu->r[3] = cpu->r[31];
         /* 0226EDC0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226EDC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226EDC8 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EDC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226EDC8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EDC8 */ _t14 = _t13 & 0x00000001u;
         /* 0226EDC8 */ if (_t14) goto L_0226EDCC; else goto L_0226EDD0;
   L_0226EDCC: ; // 0x226edcc
@@ -10374,9 +10374,9 @@ void Gambit_fn_0226ED60(CPUState* cpu) {
         /* 0226ED7C */ cpu->r[10] = _t4;
         /* 0226ED80 */ cpu->r[31] = cpu->r[3];
         /* 0226ED84 */ cpu->r[4] = 0x101D0000u;
-        /* 0226ED88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0226ED88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0226ED8C */ cpu->r[4] = cpu->r[4] + 0xFFFFFFE8u;
-        /* 0226ED90 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226ED90 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226ED90 */ _t6 = _t5 & 0x00000001u;
         /* 0226ED90 */ if (_t6) goto L_0226ED94; else goto L_0226EDA8;
   L_0226ED94: ; // 0x226ed94
@@ -10388,8 +10388,8 @@ void Gambit_fn_0226ED60(CPUState* cpu) {
         /* 0226EDA4 */ _t8 = cpu->r[4] + 0x00000000u;
         /* 0226EDA4 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
   L_0226EDA8: ; // 0x226eda8
-        /* 0226EDA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226EDAC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EDA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226EDAC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EDAC */ _t10 = _t9 & 0x00000001u;
         /* 0226EDAC */ if (_t10) goto L_0226EDCC; else goto L_0226EDB0;
   L_0226EDB0: ; // 0x226edb0
@@ -10400,8 +10400,8 @@ void Gambit_fn_0226ED60(CPUState* cpu) {
         /* 0226EDB8 */ cpu->ctr = cpu->r[0];
         /* 0226EDBC */ cpu->r[3] = cpu->r[31];
         /* 0226EDC0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226EDC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226EDC8 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EDC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226EDC8 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EDC8 */ _t14 = _t13 & 0x00000001u;
         /* 0226EDC8 */ if (_t14) goto L_0226EDCC; else goto L_0226EDD0;
   L_0226EDCC: ; // 0x226edcc
@@ -10442,8 +10442,8 @@ void Gambit_fn_0226EDFC(CPUState* cpu) {
         /* 0226EE0C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0226EE10 */ _t3 = cpu->r[31] + 0x0000005Cu;
         /* 0226EE10 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 0226EE14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226EE18 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EE14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226EE18 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EE18 */ _t5 = _t4 & 0x00000001u;
         /* 0226EE18 */ if (_t5) goto L_0226EE38; else goto L_0226EE1C;
   L_0226EE1C: ; // 0x226ee1c
@@ -10482,8 +10482,8 @@ void Gambit_fn_0226EE00(CPUState* cpu) {
         /* 0226EE0C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0226EE10 */ _t3 = cpu->r[31] + 0x0000005Cu;
         /* 0226EE10 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 0226EE14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226EE18 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EE14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226EE18 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EE18 */ _t5 = _t4 & 0x00000001u;
         /* 0226EE18 */ if (_t5) goto L_0226EE38; else goto L_0226EE1C;
   L_0226EE1C: ; // 0x226ee1c
@@ -10523,8 +10523,8 @@ void Gambit_fn_0226EE4C(CPUState* cpu) {
         /* 0226EE60 */ _t2 = cpu->r[1] + 0x0000001Cu;
         /* 0226EE60 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0226EE64 */ Gambit_fn_02801A78(cpu);
-        /* 0226EE68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226EE6C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EE68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226EE6C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EE6C */ _t4 = _t3 & 0x00000001u;
         /* 0226EE6C */ if (_t4) goto L_0226EE74; else goto L_0226EE70;
   L_0226EE70: ; // 0x226ee70
@@ -10539,8 +10539,8 @@ void Gambit_fn_0226EE4C(CPUState* cpu) {
         /* 0226EE80 */ cpu->ctr = cpu->r[0];
         /* 0226EE84 */ cpu->r[3] = cpu->r[31];
         /* 0226EE88 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226EE8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226EE90 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EE8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226EE90 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EE90 */ _t9 = _t8 & 0x00000001u;
         /* 0226EE90 */ if (_t9) goto L_0226EED8; else goto L_0226EE94;
   L_0226EE94: ; // 0x226ee94
@@ -10603,8 +10603,8 @@ void Gambit_fn_0226EE50(CPUState* cpu) {
         /* 0226EE60 */ _t2 = cpu->r[1] + 0x0000001Cu;
         /* 0226EE60 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0226EE64 */ Gambit_fn_02801A78(cpu);
-        /* 0226EE68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226EE6C */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EE68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226EE6C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EE6C */ _t4 = _t3 & 0x00000001u;
         /* 0226EE6C */ if (_t4) goto L_0226EE74; else goto L_0226EE70;
   L_0226EE70: ; // 0x226ee70
@@ -10619,8 +10619,8 @@ void Gambit_fn_0226EE50(CPUState* cpu) {
         /* 0226EE80 */ cpu->ctr = cpu->r[0];
         /* 0226EE84 */ cpu->r[3] = cpu->r[31];
         /* 0226EE88 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226EE8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226EE90 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EE8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226EE90 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EE90 */ _t9 = _t8 & 0x00000001u;
         /* 0226EE90 */ if (_t9) goto L_0226EED8; else goto L_0226EE94;
   L_0226EE94: ; // 0x226ee94
@@ -10689,22 +10689,22 @@ void Gambit_fn_0226EF0C(CPUState* cpu) {
         /* 0226EF28 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 0226EF2C */ Gambit_fn_02801A78(cpu);
         /* 0226EF30 */ cpu->r[31] = cpu->r[3];
-        /* 0226EF30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0226EF30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0226EF34 */ cpu->r[29] = 0x00000000u;
-        /* 0226EF38 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EF38 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EF38 */ _t6 = _t5 & 0x00000001u;
         /* 0226EF38 */ if (_t6) goto L_0226F004; else goto L_0226EF3C;
   L_0226EF3C: ; // 0x226ef3c
         /* 0226EF3C */ cpu->r[3] = cpu->r[31];
-        /* 0226EF3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226EF40 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EF3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226EF40 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EF40 */ _t8 = _t7 & 0x00000001u;
         /* 0226EF40 */ if (_t8) goto L_0226EF44; else goto L_0226EF54;
   L_0226EF44: ; // 0x226ef44
         /* 0226EF44 */ cpu->r[3] = 0x00000008u;
         /* 0226EF48 */ Gambit_fn_02801A78(cpu);
-        /* 0226EF4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226EF50 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EF4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226EF50 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EF50 */ _t10 = _t9 & 0x00000001u;
         /* 0226EF50 */ if (_t10) goto L_0226EF64; else goto L_0226EF54;
   L_0226EF54: ; // 0x226ef54
@@ -10744,17 +10744,17 @@ void Gambit_fn_0226EF0C(CPUState* cpu) {
         /* 0226EF9C */ _t24 = cpu->r[12] + 0x00000008u;
         /* 0226EF9C */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
         /* 0226EFA0 */ cpu->r[3] = cpu->r[31] + 0x00000020u;
-        /* 0226EFA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0226EFA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0226EFA4 */ _t25 = cpu->r[31] + 0x0000001Cu;
         /* 0226EFA4 */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
-        /* 0226EFA8 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EFA8 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EFA8 */ _t27 = _t26 & 0x00000001u;
         /* 0226EFA8 */ if (_t27) goto L_0226EFAC; else goto L_0226EFBC;
   L_0226EFAC: ; // 0x226efac
         /* 0226EFAC */ cpu->r[3] = 0x00000008u;
         /* 0226EFB0 */ Gambit_fn_02801A78(cpu);
-        /* 0226EFB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226EFB8 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EFB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226EFB8 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EFB8 */ _t29 = _t28 & 0x00000001u;
         /* 0226EFB8 */ if (_t29) goto L_0226EFC4; else goto L_0226EFBC;
   L_0226EFBC: ; // 0x226efbc
@@ -10806,8 +10806,8 @@ void Gambit_fn_0226EF0C(CPUState* cpu) {
         /* 0226F03C */ cpu->r[0] = 0xFFFFFFFFu;
   L_0226F040: ; // 0x226f040
         /* 0226F040 */ cpu->r[7] = cpu->r[3] + cpu->r[10];
-        /* 0226F040 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0226F044 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F040 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0226F044 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F044 */ _t42 = _t41 & 0x00000001u;
         /* 0226F044 */ if (_t42) goto L_0226F050; else goto L_0226F048;
   L_0226F048: ; // 0x226f048
@@ -10823,8 +10823,8 @@ void Gambit_fn_0226EF0C(CPUState* cpu) {
         /* 0226F054 */ _t47 = _t46 & 0x00000001u;
         /* 0226F054 */ if (_t47) goto L_0226F040; else goto L_0226F058;
   L_0226F058: ; // 0x226f058
-        /* 0226F058 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226F05C */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F058 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226F05C */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F05C */ _t49 = _t48 & 0x00000001u;
         /* 0226F05C */ if (_t49) goto L_0226F06C; else goto L_0226F060;
   L_0226F060: ; // 0x226f060
@@ -10844,9 +10844,9 @@ void Gambit_fn_0226EF0C(CPUState* cpu) {
         /* 0226F07C */ cpu->r[7] = _t53;
         /* 0226F080 */ cpu->r[4] = 0x101D0000u;
         /* 0226F084 */ cpu->r[31] = cpu->r[3];
-        /* 0226F088 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0226F088 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0226F08C */ cpu->r[4] = cpu->r[4] + 0xFFFFFFE8u;
-        /* 0226F090 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F090 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F090 */ _t55 = _t54 & 0x00000001u;
         /* 0226F090 */ if (_t55) goto L_0226F094; else goto L_0226F0A8;
   L_0226F094: ; // 0x226f094
@@ -10858,8 +10858,8 @@ void Gambit_fn_0226EF0C(CPUState* cpu) {
         /* 0226F0A4 */ _t57 = cpu->r[4] + 0x00000000u;
         /* 0226F0A4 */ rbrew_write32(cpu->mem, _t57, cpu->r[0]);
   L_0226F0A8: ; // 0x226f0a8
-        /* 0226F0A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226F0AC */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F0A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226F0AC */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F0AC */ _t59 = _t58 & 0x00000001u;
         /* 0226F0AC */ if (_t59) goto L_0226F0CC; else goto L_0226F0B0;
   L_0226F0B0: ; // 0x226f0b0
@@ -10870,8 +10870,8 @@ void Gambit_fn_0226EF0C(CPUState* cpu) {
         /* 0226F0B8 */ cpu->ctr = cpu->r[0];
         /* 0226F0BC */ cpu->r[3] = cpu->r[31];
         /* 0226F0C0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226F0C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226F0C8 */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F0C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226F0C8 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F0C8 */ _t63 = _t62 & 0x00000001u;
         /* 0226F0C8 */ if (_t63) goto L_0226F0CC; else goto L_0226F0D0;
   L_0226F0CC: ; // 0x226f0cc
@@ -10912,10 +10912,10 @@ void Gambit_fn_0226EF0C(CPUState* cpu) {
         /* 0226F124 */ Gambit_fn_029807A8(cpu);
         /* 0226F128 */ _t75 = cpu->r[29] + 0x00000020u;
         /* 0226F128 */ cpu->r[8] = rbrew_read32(cpu->mem, _t75);
-        /* 0226F12C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000001u);
+        /* 0226F12C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000001u));
         /* 0226F130 */ _t76 = cpu->r[29] + 0x00000024u;
         /* 0226F130 */ cpu->r[12] = rbrew_read32(cpu->mem, _t76);
-        /* 0226F134 */ _t77 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0226F134 */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0226F134 */ _t78 = _t77 & 0x00000001u;
         /* 0226F134 */ if (_t78) goto L_0226F138; else goto L_0226F13C;
   L_0226F138: ; // 0x226f138
@@ -10956,22 +10956,22 @@ void Gambit_fn_0226EF10(CPUState* cpu) {
         /* 0226EF28 */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
         /* 0226EF2C */ Gambit_fn_02801A78(cpu);
         /* 0226EF30 */ cpu->r[31] = cpu->r[3];
-        /* 0226EF30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0226EF30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0226EF34 */ cpu->r[29] = 0x00000000u;
-        /* 0226EF38 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EF38 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EF38 */ _t6 = _t5 & 0x00000001u;
         /* 0226EF38 */ if (_t6) goto L_0226F004; else goto L_0226EF3C;
   L_0226EF3C: ; // 0x226ef3c
         /* 0226EF3C */ cpu->r[3] = cpu->r[31];
-        /* 0226EF3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226EF40 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EF3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226EF40 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EF40 */ _t8 = _t7 & 0x00000001u;
         /* 0226EF40 */ if (_t8) goto L_0226EF44; else goto L_0226EF54;
   L_0226EF44: ; // 0x226ef44
         /* 0226EF44 */ cpu->r[3] = 0x00000008u;
         /* 0226EF48 */ Gambit_fn_02801A78(cpu);
-        /* 0226EF4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226EF50 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EF4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226EF50 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EF50 */ _t10 = _t9 & 0x00000001u;
         /* 0226EF50 */ if (_t10) goto L_0226EF64; else goto L_0226EF54;
   L_0226EF54: ; // 0x226ef54
@@ -11011,17 +11011,17 @@ void Gambit_fn_0226EF10(CPUState* cpu) {
         /* 0226EF9C */ _t24 = cpu->r[12] + 0x00000008u;
         /* 0226EF9C */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
         /* 0226EFA0 */ cpu->r[3] = cpu->r[31] + 0x00000020u;
-        /* 0226EFA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0226EFA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0226EFA4 */ _t25 = cpu->r[31] + 0x0000001Cu;
         /* 0226EFA4 */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
-        /* 0226EFA8 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EFA8 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EFA8 */ _t27 = _t26 & 0x00000001u;
         /* 0226EFA8 */ if (_t27) goto L_0226EFAC; else goto L_0226EFBC;
   L_0226EFAC: ; // 0x226efac
         /* 0226EFAC */ cpu->r[3] = 0x00000008u;
         /* 0226EFB0 */ Gambit_fn_02801A78(cpu);
-        /* 0226EFB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226EFB8 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226EFB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226EFB8 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226EFB8 */ _t29 = _t28 & 0x00000001u;
         /* 0226EFB8 */ if (_t29) goto L_0226EFC4; else goto L_0226EFBC;
   L_0226EFBC: ; // 0x226efbc
@@ -11073,8 +11073,8 @@ void Gambit_fn_0226EF10(CPUState* cpu) {
         /* 0226F03C */ cpu->r[0] = 0xFFFFFFFFu;
   L_0226F040: ; // 0x226f040
         /* 0226F040 */ cpu->r[7] = cpu->r[3] + cpu->r[10];
-        /* 0226F040 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0226F044 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F040 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0226F044 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F044 */ _t42 = _t41 & 0x00000001u;
         /* 0226F044 */ if (_t42) goto L_0226F050; else goto L_0226F048;
   L_0226F048: ; // 0x226f048
@@ -11090,8 +11090,8 @@ void Gambit_fn_0226EF10(CPUState* cpu) {
         /* 0226F054 */ _t47 = _t46 & 0x00000001u;
         /* 0226F054 */ if (_t47) goto L_0226F040; else goto L_0226F058;
   L_0226F058: ; // 0x226f058
-        /* 0226F058 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226F05C */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F058 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226F05C */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F05C */ _t49 = _t48 & 0x00000001u;
         /* 0226F05C */ if (_t49) goto L_0226F06C; else goto L_0226F060;
   L_0226F060: ; // 0x226f060
@@ -11111,9 +11111,9 @@ void Gambit_fn_0226EF10(CPUState* cpu) {
         /* 0226F07C */ cpu->r[7] = _t53;
         /* 0226F080 */ cpu->r[4] = 0x101D0000u;
         /* 0226F084 */ cpu->r[31] = cpu->r[3];
-        /* 0226F088 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0226F088 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0226F08C */ cpu->r[4] = cpu->r[4] + 0xFFFFFFE8u;
-        /* 0226F090 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F090 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F090 */ _t55 = _t54 & 0x00000001u;
         /* 0226F090 */ if (_t55) goto L_0226F094; else goto L_0226F0A8;
   L_0226F094: ; // 0x226f094
@@ -11125,8 +11125,8 @@ void Gambit_fn_0226EF10(CPUState* cpu) {
         /* 0226F0A4 */ _t57 = cpu->r[4] + 0x00000000u;
         /* 0226F0A4 */ rbrew_write32(cpu->mem, _t57, cpu->r[0]);
   L_0226F0A8: ; // 0x226f0a8
-        /* 0226F0A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226F0AC */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F0A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226F0AC */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F0AC */ _t59 = _t58 & 0x00000001u;
         /* 0226F0AC */ if (_t59) goto L_0226F0CC; else goto L_0226F0B0;
   L_0226F0B0: ; // 0x226f0b0
@@ -11137,8 +11137,8 @@ void Gambit_fn_0226EF10(CPUState* cpu) {
         /* 0226F0B8 */ cpu->ctr = cpu->r[0];
         /* 0226F0BC */ cpu->r[3] = cpu->r[31];
         /* 0226F0C0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226F0C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226F0C8 */ _t62 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F0C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226F0C8 */ _t62 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F0C8 */ _t63 = _t62 & 0x00000001u;
         /* 0226F0C8 */ if (_t63) goto L_0226F0CC; else goto L_0226F0D0;
   L_0226F0CC: ; // 0x226f0cc
@@ -11179,10 +11179,10 @@ void Gambit_fn_0226EF10(CPUState* cpu) {
         /* 0226F124 */ Gambit_fn_029807A8(cpu);
         /* 0226F128 */ _t75 = cpu->r[29] + 0x00000020u;
         /* 0226F128 */ cpu->r[8] = rbrew_read32(cpu->mem, _t75);
-        /* 0226F12C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], 0x00000001u);
+        /* 0226F12C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], 0x00000001u));
         /* 0226F130 */ _t76 = cpu->r[29] + 0x00000024u;
         /* 0226F130 */ cpu->r[12] = rbrew_read32(cpu->mem, _t76);
-        /* 0226F134 */ _t77 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0226F134 */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0226F134 */ _t78 = _t77 & 0x00000001u;
         /* 0226F134 */ if (_t78) goto L_0226F138; else goto L_0226F13C;
   L_0226F138: ; // 0x226f138
@@ -11224,13 +11224,13 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F17C */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0226F180 */ cpu->r[29] = 0x10060000u;
         /* 0226F184 */ cpu->r[31] = cpu->r[3];
-        /* 0226F184 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0226F184 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0226F188 */ cpu->r[29] = cpu->r[29] + 0xFFFF9008u;
         /* 0226F18C */ cpu->r[27] = 0x101D0000u;
         /* 0226F190 */ cpu->r[28] = 0x101D0000u;
         /* 0226F194 */ _t4 = cpu->r[30] + 0x00000070u;
         /* 0226F194 */ rbrew_write32(cpu->mem, _t4, cpu->r[31]);
-        /* 0226F198 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F198 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F198 */ _t6 = _t5 & 0x00000001u;
         /* 0226F198 */ if (_t6) goto L_0226F28C; else goto L_0226F19C;
   L_0226F19C: ; // 0x226f19c
@@ -11248,9 +11248,9 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F1C0 */ Gambit_fn_0226ED34(cpu);
         /* 0226F1C4 */ _t9 = cpu->r[28] + 0xFFFFDA38u;
         /* 0226F1C4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t9);
-        /* 0226F1C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0226F1C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 0226F1CC */ cpu->r[31] = cpu->r[3];
-        /* 0226F1D0 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F1D0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F1D0 */ _t11 = _t10 & 0x00000001u;
         /* 0226F1D0 */ if (_t11) goto L_0226F1D4; else goto L_0226F1E0;
   L_0226F1D4: ; // 0x226f1d4
@@ -11260,8 +11260,8 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F1DC */ _t13 = cpu->r[28] + 0xFFFFDA38u;
         /* 0226F1DC */ rbrew_write32(cpu->mem, _t13, cpu->r[9]);
   L_0226F1E0: ; // 0x226f1e0
-        /* 0226F1E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226F1E4 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F1E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226F1E4 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F1E4 */ _t15 = _t14 & 0x00000001u;
         /* 0226F1E4 */ if (_t15) goto L_0226F208; else goto L_0226F1E8;
   L_0226F1E8: ; // 0x226f1e8
@@ -11273,8 +11273,8 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F1F4 */ cpu->r[3] = cpu->r[31];
         /* 0226F1F8 */ cpu->r[4] = cpu->r[27] + 0xFFFFFFE8u;
         /* 0226F1FC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226F200 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226F204 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F200 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226F204 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F204 */ _t19 = _t18 & 0x00000001u;
         /* 0226F204 */ if (_t19) goto L_0226F208; else goto L_0226F20C;
   L_0226F208: ; // 0x226f208
@@ -11301,9 +11301,9 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F238 */ Gambit_fn_0226ED34(cpu);
         /* 0226F23C */ _t27 = cpu->r[28] + 0xFFFFDA38u;
         /* 0226F23C */ cpu->r[0] = rbrew_read32(cpu->mem, _t27);
-        /* 0226F240 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0226F240 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0226F244 */ cpu->r[31] = cpu->r[3];
-        /* 0226F248 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F248 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F248 */ _t29 = _t28 & 0x00000001u;
         /* 0226F248 */ if (_t29) goto L_0226F24C; else goto L_0226F258;
   L_0226F24C: ; // 0x226f24c
@@ -11313,8 +11313,8 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F254 */ _t31 = cpu->r[28] + 0xFFFFDA38u;
         /* 0226F254 */ rbrew_write32(cpu->mem, _t31, cpu->r[8]);
   L_0226F258: ; // 0x226f258
-        /* 0226F258 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226F25C */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F258 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226F25C */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F25C */ _t33 = _t32 & 0x00000001u;
         /* 0226F25C */ if (_t33) goto L_0226F280; else goto L_0226F260;
   L_0226F260: ; // 0x226f260
@@ -11326,8 +11326,8 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F26C */ cpu->r[3] = cpu->r[31];
         /* 0226F270 */ cpu->r[4] = cpu->r[27] + 0xFFFFFFE8u;
         /* 0226F274 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226F278 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226F27C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F278 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226F27C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F27C */ _t37 = _t36 & 0x00000001u;
         /* 0226F27C */ if (_t37) goto L_0226F280; else goto L_0226F284;
   L_0226F280: ; // 0x226f280
@@ -11359,9 +11359,9 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F2C0 */ Gambit_fn_0226ED34(cpu);
         /* 0226F2C4 */ _t45 = cpu->r[28] + 0xFFFFDA38u;
         /* 0226F2C4 */ cpu->r[10] = rbrew_read32(cpu->mem, _t45);
-        /* 0226F2C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0226F2C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0226F2CC */ cpu->r[31] = cpu->r[3];
-        /* 0226F2D0 */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F2D0 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F2D0 */ _t47 = _t46 & 0x00000001u;
         /* 0226F2D0 */ if (_t47) goto L_0226F2D4; else goto L_0226F2E0;
   L_0226F2D4: ; // 0x226f2d4
@@ -11371,8 +11371,8 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F2DC */ _t49 = cpu->r[28] + 0xFFFFDA38u;
         /* 0226F2DC */ rbrew_write32(cpu->mem, _t49, cpu->r[0]);
   L_0226F2E0: ; // 0x226f2e0
-        /* 0226F2E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226F2E4 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F2E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226F2E4 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F2E4 */ _t51 = _t50 & 0x00000001u;
         /* 0226F2E4 */ if (_t51) goto L_0226F308; else goto L_0226F2E8;
   L_0226F2E8: ; // 0x226f2e8
@@ -11384,8 +11384,8 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F2F4 */ cpu->r[3] = cpu->r[31];
         /* 0226F2F8 */ cpu->r[4] = cpu->r[27] + 0xFFFFFFE8u;
         /* 0226F2FC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226F300 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226F304 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F300 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226F304 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F304 */ _t55 = _t54 & 0x00000001u;
         /* 0226F304 */ if (_t55) goto L_0226F308; else goto L_0226F30C;
   L_0226F308: ; // 0x226f308
@@ -11393,8 +11393,8 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
   L_0226F30C: ; // 0x226f30c
         /* 0226F30C */ _t56 = cpu->r[31] + 0x00000A48u;
         /* 0226F30C */ cpu->r[9] = rbrew_read8(cpu->mem, _t56);
-        /* 0226F310 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 0226F314 */ _t57 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F310 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 0226F314 */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F314 */ _t58 = _t57 & 0x00000001u;
         /* 0226F314 */ if (_t58) goto L_0226F330; else goto L_0226F318;
   L_0226F318: ; // 0x226f318
@@ -11421,9 +11421,9 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F34C */ Gambit_fn_0226ED34(cpu);
         /* 0226F350 */ _t65 = cpu->r[28] + 0xFFFFDA38u;
         /* 0226F350 */ cpu->r[9] = rbrew_read32(cpu->mem, _t65);
-        /* 0226F354 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0226F354 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0226F358 */ cpu->r[31] = cpu->r[3];
-        /* 0226F35C */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F35C */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F35C */ _t67 = _t66 & 0x00000001u;
         /* 0226F35C */ if (_t67) goto L_0226F360; else goto L_0226F36C;
   L_0226F360: ; // 0x226f360
@@ -11433,8 +11433,8 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F368 */ _t69 = cpu->r[28] + 0xFFFFDA38u;
         /* 0226F368 */ rbrew_write32(cpu->mem, _t69, cpu->r[0]);
   L_0226F36C: ; // 0x226f36c
-        /* 0226F36C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226F370 */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F36C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226F370 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F370 */ _t71 = _t70 & 0x00000001u;
         /* 0226F370 */ if (_t71) goto L_0226F394; else goto L_0226F374;
   L_0226F374: ; // 0x226f374
@@ -11446,8 +11446,8 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F380 */ cpu->r[3] = cpu->r[31];
         /* 0226F384 */ cpu->r[4] = cpu->r[27] + 0xFFFFFFE8u;
         /* 0226F388 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226F38C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226F390 */ _t74 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F38C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226F390 */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F390 */ _t75 = _t74 & 0x00000001u;
         /* 0226F390 */ if (_t75) goto L_0226F394; else goto L_0226F398;
   L_0226F394: ; // 0x226f394
@@ -11455,8 +11455,8 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
   L_0226F398: ; // 0x226f398
         /* 0226F398 */ _t76 = cpu->r[31] + 0x00000AF8u;
         /* 0226F398 */ cpu->r[0] = rbrew_read8(cpu->mem, _t76);
-        /* 0226F39C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226F3A0 */ _t77 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F39C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226F3A0 */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F3A0 */ _t78 = _t77 & 0x00000001u;
         /* 0226F3A0 */ if (_t78) goto L_0226F3AC; else goto L_0226F3A4;
   L_0226F3A4: ; // 0x226f3a4
@@ -11472,8 +11472,8 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F3BC */ cpu->ctr = cpu->r[9];
         /* 0226F3C0 */ cpu->r[3] = cpu->r[30];
         /* 0226F3C4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226F3C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226F3CC */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F3C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226F3CC */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F3CC */ _t82 = _t81 & 0x00000001u;
         /* 0226F3CC */ if (_t82) goto L_0226F464; else goto L_0226F3D0;
   L_0226F3D0: ; // 0x226f3d0
@@ -11498,15 +11498,15 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F3FC */ cpu->r[10] = rbrew_read32(cpu->mem, _t89);
         /* 0226F400 */ _t90 = cpu->r[10] + 0x000000A4u;
         /* 0226F400 */ cpu->r[8] = rbrew_read32(cpu->mem, _t90);
-        /* 0226F404 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 0226F408 */ _t91 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F404 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 0226F408 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F408 */ _t92 = _t91 & 0x00000001u;
         /* 0226F408 */ if (_t92) goto L_0226F440; else goto L_0226F40C;
   L_0226F40C: ; // 0x226f40c
         /* 0226F40C */ cpu->r[3] = 0x00000028u;
         /* 0226F410 */ Gambit_fn_02801A78(cpu);
-        /* 0226F414 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226F418 */ _t93 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F414 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226F418 */ _t93 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F418 */ _t94 = _t93 & 0x00000001u;
         /* 0226F418 */ if (_t94) goto L_0226F428; else goto L_0226F41C;
   L_0226F41C: ; // 0x226f41c
@@ -11532,8 +11532,8 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F448 */ cpu->ctr = cpu->r[10];
         /* 0226F44C */ cpu->r[3] = cpu->r[30];
         /* 0226F450 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226F454 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226F458 */ _t101 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F454 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226F458 */ _t101 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F458 */ _t102 = _t101 & 0x00000001u;
         /* 0226F458 */ if (_t102) goto L_0226F464; else goto L_0226F45C;
   L_0226F45C: ; // 0x226f45c
@@ -11542,8 +11542,8 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
   L_0226F464: ; // 0x226f464
         /* 0226F464 */ _t103 = cpu->r[30] + 0x00000008u;
         /* 0226F464 */ cpu->r[11] = rbrew_read32(cpu->mem, _t103);
-        /* 0226F468 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 0226F46C */ _t104 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F468 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 0226F46C */ _t104 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F46C */ _t105 = _t104 & 0x00000001u;
         /* 0226F46C */ if (_t105) goto L_0226F57C; else goto L_0226F470;
   L_0226F470: ; // 0x226f470
@@ -11551,9 +11551,9 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F474 */ Gambit_fn_0226ED34(cpu);
         /* 0226F478 */ _t106 = cpu->r[28] + 0xFFFFDA38u;
         /* 0226F478 */ cpu->r[12] = rbrew_read32(cpu->mem, _t106);
-        /* 0226F47C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0226F47C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0226F480 */ cpu->r[31] = cpu->r[3];
-        /* 0226F484 */ _t107 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F484 */ _t107 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F484 */ _t108 = _t107 & 0x00000001u;
         /* 0226F484 */ if (_t108) goto L_0226F488; else goto L_0226F494;
   L_0226F488: ; // 0x226f488
@@ -11563,8 +11563,8 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F490 */ _t110 = cpu->r[28] + 0xFFFFDA38u;
         /* 0226F490 */ rbrew_write32(cpu->mem, _t110, cpu->r[0]);
   L_0226F494: ; // 0x226f494
-        /* 0226F494 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226F498 */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F494 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226F498 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F498 */ _t112 = _t111 & 0x00000001u;
         /* 0226F498 */ if (_t112) goto L_0226F4BC; else goto L_0226F49C;
   L_0226F49C: ; // 0x226f49c
@@ -11576,8 +11576,8 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F4A8 */ cpu->r[3] = cpu->r[31];
         /* 0226F4AC */ cpu->r[4] = cpu->r[27] + 0xFFFFFFE8u;
         /* 0226F4B0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226F4B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226F4B8 */ _t115 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F4B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226F4B8 */ _t115 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F4B8 */ _t116 = _t115 & 0x00000001u;
         /* 0226F4B8 */ if (_t116) goto L_0226F4BC; else goto L_0226F4C0;
   L_0226F4BC: ; // 0x226f4bc
@@ -11585,8 +11585,8 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
   L_0226F4C0: ; // 0x226f4c0
         /* 0226F4C0 */ _t117 = cpu->r[31] + 0x00000C00u;
         /* 0226F4C0 */ cpu->r[10] = rbrew_read8(cpu->mem, _t117);
-        /* 0226F4C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0226F4C8 */ _t118 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F4C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0226F4C8 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F4C8 */ _t119 = _t118 & 0x00000001u;
         /* 0226F4C8 */ if (_t119) goto L_0226F4D4; else goto L_0226F4CC;
   L_0226F4CC: ; // 0x226f4cc
@@ -11595,8 +11595,8 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
   L_0226F4D4: ; // 0x226f4d4
         /* 0226F4D4 */ _t120 = cpu->r[30] + 0x00000008u;
         /* 0226F4D4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t120);
-        /* 0226F4D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226F4DC */ _t121 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F4D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226F4DC */ _t121 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F4DC */ _t122 = _t121 & 0x00000001u;
         /* 0226F4DC */ if (_t122) goto L_0226F57C; else goto L_0226F4E0;
   L_0226F4E0: ; // 0x226f4e0
@@ -11604,9 +11604,9 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F4E4 */ Gambit_fn_0226ED34(cpu);
         /* 0226F4E8 */ _t123 = cpu->r[28] + 0xFFFFDA38u;
         /* 0226F4E8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t123);
-        /* 0226F4EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0226F4EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0226F4F0 */ cpu->r[31] = cpu->r[3];
-        /* 0226F4F4 */ _t124 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F4F4 */ _t124 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F4F4 */ _t125 = _t124 & 0x00000001u;
         /* 0226F4F4 */ if (_t125) goto L_0226F4F8; else goto L_0226F504;
   L_0226F4F8: ; // 0x226f4f8
@@ -11616,8 +11616,8 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F500 */ _t127 = cpu->r[28] + 0xFFFFDA38u;
         /* 0226F500 */ rbrew_write32(cpu->mem, _t127, cpu->r[0]);
   L_0226F504: ; // 0x226f504
-        /* 0226F504 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226F508 */ _t128 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F504 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226F508 */ _t128 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F508 */ _t129 = _t128 & 0x00000001u;
         /* 0226F508 */ if (_t129) goto L_0226F52C; else goto L_0226F50C;
   L_0226F50C: ; // 0x226f50c
@@ -11629,8 +11629,8 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F518 */ cpu->r[3] = cpu->r[31];
         /* 0226F51C */ cpu->r[4] = cpu->r[27] + 0xFFFFFFE8u;
         /* 0226F520 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226F524 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226F528 */ _t132 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226F528 */ _t132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F528 */ _t133 = _t132 & 0x00000001u;
         /* 0226F528 */ if (_t133) goto L_0226F52C; else goto L_0226F530;
   L_0226F52C: ; // 0x226f52c
@@ -11638,8 +11638,8 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
   L_0226F530: ; // 0x226f530
         /* 0226F530 */ _t134 = cpu->r[31] + 0x00000B50u;
         /* 0226F530 */ cpu->r[0] = rbrew_read8(cpu->mem, _t134);
-        /* 0226F534 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226F538 */ _t135 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F534 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226F538 */ _t135 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F538 */ _t136 = _t135 & 0x00000001u;
         /* 0226F538 */ if (_t136) goto L_0226F57C; else goto L_0226F53C;
   L_0226F53C: ; // 0x226f53c
@@ -11649,10 +11649,10 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F544 */ cpu->r[5] = 0x00000000u;
         /* 0226F548 */ cpu->r[4] = cpu->r[31] + 0xFFFF9080u;
         /* 0226F54C */ Gambit_fn_02390190(cpu);
-        /* 0226F550 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0226F550 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0226F554 */ _t138 = cpu->r[30] + 0x00000060u;
         /* 0226F554 */ rbrew_write32(cpu->mem, _t138, cpu->r[3]);
-        /* 0226F558 */ _t139 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F558 */ _t139 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F558 */ _t140 = _t139 & 0x00000001u;
         /* 0226F558 */ if (_t140) goto L_0226F57C; else goto L_0226F55C;
   L_0226F55C: ; // 0x226f55c
@@ -11685,9 +11685,9 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F5A4 */ _t148 = cpu->r[30] + 0x0000005Cu;
         /* 0226F5A4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t148);
         /* 0226F5A8 */ cpu->r[8] = 0x00000000u;
-        /* 0226F5AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0226F5AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0226F5B0 */ cpu->r[31] = cpu->r[8];
-        /* 0226F5B4 */ _t149 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F5B4 */ _t149 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F5B4 */ _t150 = _t149 & 0x00000001u;
         /* 0226F5B4 */ if (_t150) goto L_0226F5E8; else goto L_0226F5B8;
   L_0226F5B8: ; // 0x226f5b8
@@ -11702,17 +11702,17 @@ void Gambit_fn_0226F15C(CPUState* cpu) {
         /* 0226F5D4 */ _t152 = cpu->r[1] + 0x00000008u;
         /* 0226F5D4 */ rbrew_write32(cpu->mem, _t152, cpu->r[10]);
         /* 0226F5D8 */ Gambit_fn_020F0AA8(cpu);
-        /* 0226F5DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226F5E0 */ _t153 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F5DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226F5E0 */ _t153 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F5E0 */ _t154 = _t153 & 0x00000001u;
         /* 0226F5E0 */ if (_t154) goto L_0226F5E8; else goto L_0226F5E4;
   L_0226F5E4: ; // 0x226f5e4
         /* 0226F5E4 */ cpu->r[31] = 0x00000001u;
   L_0226F5E8: ; // 0x226f5e8
-        /* 0226F5E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0226F5E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0226F5EC */ _t155 = cpu->r[30] + 0x00000004u;
         /* 0226F5EC */ cpu->r[12] = rbrew_read32(cpu->mem, _t155);
-        /* 0226F5F0 */ _t156 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F5F0 */ _t156 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F5F0 */ _t157 = _t156 & 0x00000001u;
         /* 0226F5F0 */ if (_t157) goto L_0226F5FC; else goto L_0226F5F4;
   L_0226F5F4: ; // 0x226f5f4
@@ -11825,9 +11825,9 @@ void Gambit_fn_0226F680(CPUState* cpu) {
         /* 0226F684 */ cpu->r[11] = 0x101C0000u;
         /* 0226F688 */ _t1 = cpu->r[11] + 0x000059ACu;
         /* 0226F688 */ cpu->r[11] = rbrew_read32(cpu->mem, _t1);
-        /* 0226F68C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000022u);
+        /* 0226F68C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000022u));
         /* 0226F690 */ cpu->r[12] = cpu->r[11] + 0x00000098u;
-        /* 0226F694 */ _t2 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226F694 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226F694 */ _t3 = _t2 & 0x00000001u;
         /* 0226F694 */ if (_t3) goto L_0226F698; else goto L_0226F6A0;
   L_0226F698: ; // 0x226f698
@@ -11871,8 +11871,8 @@ void Gambit_fn_0226F6A8(CPUState* cpu) {
         /* 0226F6DC */ cpu->r[8] = rbrew_read32(cpu->mem, _t9);
         /* 0226F6E0 */ _t10 = cpu->r[8] + 0x00000098u;
         /* 0226F6E0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t10);
-        /* 0226F6E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226F6E8 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F6E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226F6E8 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F6E8 */ _t12 = _t11 & 0x00000001u;
         /* 0226F6E8 */ if (_t12) goto L_0226F7BC; else goto L_0226F6EC;
   L_0226F6EC: ; // 0x226f6ec
@@ -11902,33 +11902,33 @@ void Gambit_fn_0226F6A8(CPUState* cpu) {
         /* 0226F724 */ cpu->r[5] = rbrew_read32(cpu->mem, _t20);
         /* 0226F728 */ cpu->r[29] = cpu->r[5] - cpu->r[30];
   L_0226F72C: ; // 0x226f72c
-        /* 0226F72C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[31]);
-        /* 0226F730 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F72C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[31]));
+        /* 0226F730 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F730 */ _t22 = _t21 & 0x00000001u;
         /* 0226F730 */ if (_t22) goto L_0226F748; else goto L_0226F734;
   L_0226F734: ; // 0x226f734
         /* 0226F734 */ _t23 = cpu->r[29] + 0x0000001Cu;
         /* 0226F734 */ cpu->r[4] = rbrew_read32(cpu->mem, _t23);
-        /* 0226F738 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000002u);
-        /* 0226F73C */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F738 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000002u));
+        /* 0226F73C */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F73C */ _t25 = _t24 & 0x00000001u;
         /* 0226F73C */ if (_t25) goto L_0226F748; else goto L_0226F740;
   L_0226F740: ; // 0x226f740
-        /* 0226F740 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000003u);
-        /* 0226F744 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F740 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000003u));
+        /* 0226F744 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F744 */ _t27 = _t26 & 0x00000001u;
         /* 0226F744 */ if (_t27) goto L_0226F748; else goto L_0226F720;
   L_0226F748: ; // 0x226f748
-        /* 0226F748 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[31]);
-        /* 0226F74C */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F748 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[31]));
+        /* 0226F74C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F74C */ _t29 = _t28 & 0x00000001u;
         /* 0226F74C */ if (_t29) goto L_0226F7BC; else goto L_0226F750;
   L_0226F750: ; // 0x226f750
         /* 0226F750 */ cpu->r[3] = cpu->r[29];
         /* 0226F754 */ cpu->r[4] = cpu->r[28] + 0x00000140u;
         /* 0226F758 */ Gambit_fn_024AE2A0(cpu);
-        /* 0226F75C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226F760 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F75C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226F760 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F760 */ _t31 = _t30 & 0x00000001u;
         /* 0226F760 */ if (_t31) goto L_0226F788; else goto L_0226F764;
   L_0226F764: ; // 0x226f764
@@ -11952,27 +11952,27 @@ void Gambit_fn_0226F6A8(CPUState* cpu) {
         /* 0226F78C */ _t38 = cpu->r[6] + 0x00000004u;
         /* 0226F78C */ cpu->r[0] = rbrew_read32(cpu->mem, _t38);
         /* 0226F790 */ cpu->r[29] = cpu->r[0] - cpu->r[30];
-        /* 0226F794 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[31]);
-        /* 0226F798 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F794 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[31]));
+        /* 0226F798 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F798 */ _t40 = _t39 & 0x00000001u;
         /* 0226F798 */ if (_t40) goto L_0226F7BC; else goto L_0226F79C;
   L_0226F79C: ; // 0x226f79c
         /* 0226F79C */ _t41 = cpu->r[29] + 0x0000001Cu;
         /* 0226F79C */ cpu->r[0] = rbrew_read32(cpu->mem, _t41);
-        /* 0226F7A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 0226F7A4 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F7A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 0226F7A4 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F7A4 */ _t43 = _t42 & 0x00000001u;
         /* 0226F7A4 */ if (_t43) goto L_0226F7B4; else goto L_0226F7A8;
   L_0226F7A8: ; // 0x226f7a8
-        /* 0226F7A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 0226F7AC */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F7A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 0226F7AC */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F7AC */ _t45 = _t44 & 0x00000001u;
         /* 0226F7AC */ if (_t45) goto L_0226F7B0; else goto L_0226F788;
   L_0226F7B0: ; // 0x226f7b0
         /* 0226F7B0 */ goto L_0226F748;
   L_0226F7B4: ; // 0x226f7b4
-        /* 0226F7B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[31]);
-        /* 0226F7B8 */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F7B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[31]));
+        /* 0226F7B8 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F7B8 */ _t47 = _t46 & 0x00000001u;
         /* 0226F7B8 */ if (_t47) goto L_0226F7BC; else goto L_0226F750;
   L_0226F7BC: ; // 0x226f7bc
@@ -12022,8 +12022,8 @@ void Gambit_fn_0226F6AC(CPUState* cpu) {
         /* 0226F6DC */ cpu->r[8] = rbrew_read32(cpu->mem, _t9);
         /* 0226F6E0 */ _t10 = cpu->r[8] + 0x00000098u;
         /* 0226F6E0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t10);
-        /* 0226F6E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226F6E8 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F6E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226F6E8 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F6E8 */ _t12 = _t11 & 0x00000001u;
         /* 0226F6E8 */ if (_t12) goto L_0226F7BC; else goto L_0226F6EC;
   L_0226F6EC: ; // 0x226f6ec
@@ -12053,33 +12053,33 @@ void Gambit_fn_0226F6AC(CPUState* cpu) {
         /* 0226F724 */ cpu->r[5] = rbrew_read32(cpu->mem, _t20);
         /* 0226F728 */ cpu->r[29] = cpu->r[5] - cpu->r[30];
   L_0226F72C: ; // 0x226f72c
-        /* 0226F72C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[31]);
-        /* 0226F730 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F72C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[31]));
+        /* 0226F730 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F730 */ _t22 = _t21 & 0x00000001u;
         /* 0226F730 */ if (_t22) goto L_0226F748; else goto L_0226F734;
   L_0226F734: ; // 0x226f734
         /* 0226F734 */ _t23 = cpu->r[29] + 0x0000001Cu;
         /* 0226F734 */ cpu->r[4] = rbrew_read32(cpu->mem, _t23);
-        /* 0226F738 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000002u);
-        /* 0226F73C */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F738 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000002u));
+        /* 0226F73C */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F73C */ _t25 = _t24 & 0x00000001u;
         /* 0226F73C */ if (_t25) goto L_0226F748; else goto L_0226F740;
   L_0226F740: ; // 0x226f740
-        /* 0226F740 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000003u);
-        /* 0226F744 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F740 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000003u));
+        /* 0226F744 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F744 */ _t27 = _t26 & 0x00000001u;
         /* 0226F744 */ if (_t27) goto L_0226F748; else goto L_0226F720;
   L_0226F748: ; // 0x226f748
-        /* 0226F748 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[31]);
-        /* 0226F74C */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F748 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[31]));
+        /* 0226F74C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F74C */ _t29 = _t28 & 0x00000001u;
         /* 0226F74C */ if (_t29) goto L_0226F7BC; else goto L_0226F750;
   L_0226F750: ; // 0x226f750
         /* 0226F750 */ cpu->r[3] = cpu->r[29];
         /* 0226F754 */ cpu->r[4] = cpu->r[28] + 0x00000140u;
         /* 0226F758 */ Gambit_fn_024AE2A0(cpu);
-        /* 0226F75C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226F760 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F75C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226F760 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F760 */ _t31 = _t30 & 0x00000001u;
         /* 0226F760 */ if (_t31) goto L_0226F788; else goto L_0226F764;
   L_0226F764: ; // 0x226f764
@@ -12103,27 +12103,27 @@ void Gambit_fn_0226F6AC(CPUState* cpu) {
         /* 0226F78C */ _t38 = cpu->r[6] + 0x00000004u;
         /* 0226F78C */ cpu->r[0] = rbrew_read32(cpu->mem, _t38);
         /* 0226F790 */ cpu->r[29] = cpu->r[0] - cpu->r[30];
-        /* 0226F794 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[31]);
-        /* 0226F798 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F794 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[31]));
+        /* 0226F798 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F798 */ _t40 = _t39 & 0x00000001u;
         /* 0226F798 */ if (_t40) goto L_0226F7BC; else goto L_0226F79C;
   L_0226F79C: ; // 0x226f79c
         /* 0226F79C */ _t41 = cpu->r[29] + 0x0000001Cu;
         /* 0226F79C */ cpu->r[0] = rbrew_read32(cpu->mem, _t41);
-        /* 0226F7A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 0226F7A4 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F7A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 0226F7A4 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F7A4 */ _t43 = _t42 & 0x00000001u;
         /* 0226F7A4 */ if (_t43) goto L_0226F7B4; else goto L_0226F7A8;
   L_0226F7A8: ; // 0x226f7a8
-        /* 0226F7A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 0226F7AC */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F7A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 0226F7AC */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F7AC */ _t45 = _t44 & 0x00000001u;
         /* 0226F7AC */ if (_t45) goto L_0226F7B0; else goto L_0226F788;
   L_0226F7B0: ; // 0x226f7b0
         /* 0226F7B0 */ goto L_0226F748;
   L_0226F7B4: ; // 0x226f7b4
-        /* 0226F7B4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[31]);
-        /* 0226F7B8 */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F7B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[31]));
+        /* 0226F7B8 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F7B8 */ _t47 = _t46 & 0x00000001u;
         /* 0226F7B8 */ if (_t47) goto L_0226F7BC; else goto L_0226F750;
   L_0226F7BC: ; // 0x226f7bc
@@ -12150,10 +12150,10 @@ void Gambit_fn_0226F7DC(CPUState* cpu) {
         /* 0226F7DC */ cpu->r[5] = cpu->r[4];
         /* 0226F7E0 */ _t0 = cpu->r[3] + 0x00000084u;
         /* 0226F7E0 */ rbrew_write32(cpu->mem, _t0, cpu->r[4]);
-        /* 0226F7E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000001u);
+        /* 0226F7E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000001u));
         /* 0226F7E8 */ _t1 = cpu->r[3] + 0x00000030u;
         /* 0226F7E8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t1);
-        /* 0226F7EC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F7EC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F7EC */ _t3 = _t2 & 0x00000001u;
         /* 0226F7EC */ if (_t3) goto L_0226F7F4; else goto L_0226F7F0;
   L_0226F7F0: ; // 0x226f7f0
@@ -12164,8 +12164,8 @@ void Gambit_fn_0226F7DC(CPUState* cpu) {
   L_027B8224: ; // 0x27b8224
         /* 027B8224 */ _t4 = cpu->r[3] + 0x00000000u;
         /* 027B8224 */ cpu->r[3] = rbrew_read32(cpu->mem, _t4);
-        /* 027B8228 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 027B822C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 027B8228 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 027B822C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 027B822C */ _t6 = _t5 & 0x00000001u;
         /* 027B822C */ if (_t6) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 027B822C */ goto L_027B8230;
@@ -12188,9 +12188,9 @@ void Gambit_fn_0226F7DC(CPUState* cpu) {
         /* 027DA6B4 */ _t12 = cpu->r[29] + 0x00000014u;
         /* 027DA6B4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t12);
         /* 027DA6B8 */ cpu->r[31] = cpu->r[5];
-        /* 027DA6BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 027DA6BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 027DA6C0 */ cpu->r[30] = cpu->r[4];
-        /* 027DA6C4 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 027DA6C4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 027DA6C4 */ _t14 = _t13 & 0x00000001u;
         /* 027DA6C4 */ if (_t14) goto L_027DA6D4; else goto L_027DA6C8;
   L_027DA6C8: ; // 0x27da6c8
@@ -12200,8 +12200,8 @@ void Gambit_fn_0226F7DC(CPUState* cpu) {
   L_027DA6D4: ; // 0x27da6d4
         /* 027DA6D4 */ _t15 = cpu->r[29] + 0x00000018u;
         /* 027DA6D4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t15);
-        /* 027DA6D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 027DA6DC */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 027DA6D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 027DA6DC */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 027DA6DC */ _t17 = _t16 & 0x00000001u;
         /* 027DA6DC */ if (_t17) goto L_027DA6EC; else goto L_027DA6E0;
   L_027DA6E0: ; // 0x27da6e0
@@ -12313,10 +12313,10 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
         /* 0226F8A8 */ cpu->r[27] = 0x00000000u;
         /* 0226F8AC */ _t39 = cpu->r[28] + 0x0000009Cu;
         /* 0226F8AC */ rbrew_write32(cpu->mem, _t39, cpu->r[27]);
-        /* 0226F8B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0226F8B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0226F8B4 */ _t40 = cpu->r[28] + 0x000000C4u;
         /* 0226F8B4 */ rbrew_write32(cpu->mem, _t40, cpu->r[27]);
-        /* 0226F8B8 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F8B8 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F8B8 */ _t42 = _t41 & 0x00000001u;
         /* 0226F8B8 */ if (_t42) goto L_0226F8D0; else goto L_0226F8BC;
   L_0226F8BC: ; // 0x226f8bc
@@ -12330,8 +12330,8 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
   L_0226F8D0: ; // 0x226f8d0
         /* 0226F8D0 */ _t45 = cpu->r[28] + 0x00000070u;
         /* 0226F8D0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t45);
-        /* 0226F8D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226F8D8 */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F8D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226F8D8 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F8D8 */ _t47 = _t46 & 0x00000001u;
         /* 0226F8D8 */ if (_t47) goto L_0226F900; else goto L_0226F8DC;
   L_0226F8DC: ; // 0x226f8dc
@@ -12352,8 +12352,8 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
   L_0226F900: ; // 0x226f900
         /* 0226F900 */ _t53 = cpu->r[28] + 0x00000064u;
         /* 0226F900 */ cpu->r[8] = rbrew_read32(cpu->mem, _t53);
-        /* 0226F904 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
-        /* 0226F908 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F904 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
+        /* 0226F908 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F908 */ _t55 = _t54 & 0x00000001u;
         /* 0226F908 */ if (_t55) goto L_0226FB48; else goto L_0226F90C;
   L_0226F90C: ; // 0x226f90c
@@ -12368,9 +12368,9 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
         /* 0226F924 */ cpu->r[24] = 0x10060000u;
         /* 0226F928 */ cpu->r[29] = cpu->r[3];
         /* 0226F92C */ cpu->r[25] = 0x101D0000u;
-        /* 0226F930 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0226F930 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0226F934 */ cpu->r[24] = cpu->r[24] + 0xFFFF9008u;
-        /* 0226F938 */ _t57 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F938 */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F938 */ _t58 = _t57 & 0x00000001u;
         /* 0226F938 */ if (_t58) goto L_0226F93C; else goto L_0226F948;
   L_0226F93C: ; // 0x226f93c
@@ -12380,8 +12380,8 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
         /* 0226F944 */ _t60 = cpu->r[23] + 0x00000000u;
         /* 0226F944 */ rbrew_write32(cpu->mem, _t60, cpu->r[9]);
   L_0226F948: ; // 0x226f948
-        /* 0226F948 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 0226F94C */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F948 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 0226F94C */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F94C */ _t62 = _t61 & 0x00000001u;
         /* 0226F94C */ if (_t62) goto L_0226F994; else goto L_0226F950;
   L_0226F950: ; // 0x226f950
@@ -12393,10 +12393,10 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
         /* 0226F95C */ cpu->r[3] = cpu->r[29];
         /* 0226F960 */ cpu->r[4] = cpu->r[25] + 0xFFFFFFE8u;
         /* 0226F964 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226F968 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0226F968 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0226F96C */ _t65 = cpu->r[23] + 0x00000000u;
         /* 0226F96C */ cpu->r[9] = rbrew_read32(cpu->mem, _t65);
-        /* 0226F970 */ _t66 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F970 */ _t66 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F970 */ _t67 = _t66 & 0x00000001u;
         /* 0226F970 */ if (_t67) goto L_0226F974; else goto L_0226F97C;
   L_0226F974: ; // 0x226f974
@@ -12405,9 +12405,9 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
   L_0226F97C: ; // 0x226f97c
         /* 0226F97C */ cpu->r[3] = cpu->r[28];
         /* 0226F980 */ Gambit_fn_0226ED34(cpu);
-        /* 0226F984 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0226F984 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0226F988 */ cpu->r[30] = cpu->r[3];
-        /* 0226F98C */ _t68 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F98C */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F98C */ _t69 = _t68 & 0x00000001u;
         /* 0226F98C */ if (_t69) goto L_0226F990; else goto L_0226F9B8;
   L_0226F990: ; // 0x226f990
@@ -12417,9 +12417,9 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
   L_0226F998: ; // 0x226f998
         /* 0226F998 */ cpu->r[3] = cpu->r[28];
         /* 0226F99C */ Gambit_fn_0226ED34(cpu);
-        /* 0226F9A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0226F9A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0226F9A4 */ cpu->r[30] = cpu->r[3];
-        /* 0226F9A8 */ _t70 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F9A8 */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F9A8 */ _t71 = _t70 & 0x00000001u;
         /* 0226F9A8 */ if (_t71) goto L_0226F9AC; else goto L_0226F9B8;
   L_0226F9AC: ; // 0x226f9ac
@@ -12429,8 +12429,8 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
         /* 0226F9B4 */ _t73 = cpu->r[23] + 0x00000000u;
         /* 0226F9B4 */ rbrew_write32(cpu->mem, _t73, cpu->r[9]);
   L_0226F9B8: ; // 0x226f9b8
-        /* 0226F9B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0226F9BC */ _t74 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F9B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0226F9BC */ _t74 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F9BC */ _t75 = _t74 & 0x00000001u;
         /* 0226F9BC */ if (_t75) goto L_0226FA04; else goto L_0226F9C0;
   L_0226F9C0: ; // 0x226f9c0
@@ -12442,10 +12442,10 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
         /* 0226F9CC */ cpu->r[3] = cpu->r[30];
         /* 0226F9D0 */ cpu->r[4] = cpu->r[25] + 0xFFFFFFE8u;
         /* 0226F9D4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226F9D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0226F9D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0226F9DC */ _t78 = cpu->r[23] + 0x00000000u;
         /* 0226F9DC */ cpu->r[9] = rbrew_read32(cpu->mem, _t78);
-        /* 0226F9E0 */ _t79 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F9E0 */ _t79 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F9E0 */ _t80 = _t79 & 0x00000001u;
         /* 0226F9E0 */ if (_t80) goto L_0226F9E4; else goto L_0226F9EC;
   L_0226F9E4: ; // 0x226f9e4
@@ -12454,9 +12454,9 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
   L_0226F9EC: ; // 0x226f9ec
         /* 0226F9EC */ cpu->r[3] = cpu->r[28];
         /* 0226F9F0 */ Gambit_fn_0226ED34(cpu);
-        /* 0226F9F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0226F9F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0226F9F8 */ cpu->r[31] = cpu->r[3];
-        /* 0226F9FC */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226F9FC */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226F9FC */ _t82 = _t81 & 0x00000001u;
         /* 0226F9FC */ if (_t82) goto L_0226FA00; else goto L_0226FA28;
   L_0226FA00: ; // 0x226fa00
@@ -12466,9 +12466,9 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
   L_0226FA08: ; // 0x226fa08
         /* 0226FA08 */ cpu->r[3] = cpu->r[28];
         /* 0226FA0C */ Gambit_fn_0226ED34(cpu);
-        /* 0226FA10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0226FA10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0226FA14 */ cpu->r[31] = cpu->r[3];
-        /* 0226FA18 */ _t83 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FA18 */ _t83 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FA18 */ _t84 = _t83 & 0x00000001u;
         /* 0226FA18 */ if (_t84) goto L_0226FA1C; else goto L_0226FA28;
   L_0226FA1C: ; // 0x226fa1c
@@ -12478,8 +12478,8 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
         /* 0226FA24 */ _t86 = cpu->r[23] + 0x00000000u;
         /* 0226FA24 */ rbrew_write32(cpu->mem, _t86, cpu->r[9]);
   L_0226FA28: ; // 0x226fa28
-        /* 0226FA28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226FA2C */ _t87 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FA28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226FA2C */ _t87 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FA2C */ _t88 = _t87 & 0x00000001u;
         /* 0226FA2C */ if (_t88) goto L_0226FA74; else goto L_0226FA30;
   L_0226FA30: ; // 0x226fa30
@@ -12491,10 +12491,10 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
         /* 0226FA3C */ cpu->r[3] = cpu->r[31];
         /* 0226FA40 */ cpu->r[4] = cpu->r[25] + 0xFFFFFFE8u;
         /* 0226FA44 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226FA48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0226FA48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0226FA4C */ _t91 = cpu->r[23] + 0x00000000u;
         /* 0226FA4C */ cpu->r[9] = rbrew_read32(cpu->mem, _t91);
-        /* 0226FA50 */ _t92 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FA50 */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FA50 */ _t93 = _t92 & 0x00000001u;
         /* 0226FA50 */ if (_t93) goto L_0226FA54; else goto L_0226FA5C;
   L_0226FA54: ; // 0x226fa54
@@ -12503,9 +12503,9 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
   L_0226FA5C: ; // 0x226fa5c
         /* 0226FA5C */ cpu->r[3] = cpu->r[28];
         /* 0226FA60 */ Gambit_fn_0226ED34(cpu);
-        /* 0226FA64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0226FA64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0226FA68 */ cpu->r[26] = cpu->r[3];
-        /* 0226FA6C */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FA6C */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FA6C */ _t95 = _t94 & 0x00000001u;
         /* 0226FA6C */ if (_t95) goto L_0226FA70; else goto L_0226FA98;
   L_0226FA70: ; // 0x226fa70
@@ -12515,9 +12515,9 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
   L_0226FA78: ; // 0x226fa78
         /* 0226FA78 */ cpu->r[3] = cpu->r[28];
         /* 0226FA7C */ Gambit_fn_0226ED34(cpu);
-        /* 0226FA80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0226FA80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0226FA84 */ cpu->r[26] = cpu->r[3];
-        /* 0226FA88 */ _t96 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FA88 */ _t96 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FA88 */ _t97 = _t96 & 0x00000001u;
         /* 0226FA88 */ if (_t97) goto L_0226FA8C; else goto L_0226FA98;
   L_0226FA8C: ; // 0x226fa8c
@@ -12527,8 +12527,8 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
         /* 0226FA94 */ _t99 = cpu->r[23] + 0x00000000u;
         /* 0226FA94 */ rbrew_write32(cpu->mem, _t99, cpu->r[9]);
   L_0226FA98: ; // 0x226fa98
-        /* 0226FA98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[26], 0x00000000u);
-        /* 0226FA9C */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FA98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[26], 0x00000000u));
+        /* 0226FA9C */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FA9C */ _t101 = _t100 & 0x00000001u;
         /* 0226FA9C */ if (_t101) goto L_0226FAC0; else goto L_0226FAA0;
   L_0226FAA0: ; // 0x226faa0
@@ -12540,8 +12540,8 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
         /* 0226FAAC */ cpu->r[3] = cpu->r[26];
         /* 0226FAB0 */ cpu->r[4] = cpu->r[25] + 0xFFFFFFE8u;
         /* 0226FAB4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226FAB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226FABC */ _t104 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FAB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226FABC */ _t104 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FABC */ _t105 = _t104 & 0x00000001u;
         /* 0226FABC */ if (_t105) goto L_0226FAC0; else goto L_0226FAC4;
   L_0226FAC0: ; // 0x226fac0
@@ -12559,15 +12559,15 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
         /* 0226FAE0 */ Gambit_fn_023B3154(cpu);
         /* 0226FAE4 */ _t108 = cpu->r[28] + 0x00000068u;
         /* 0226FAE4 */ cpu->r[31] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t108);
-        /* 0226FAE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFFFFu);
-        /* 0226FAEC */ _t109 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FAE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFFFFu));
+        /* 0226FAEC */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FAEC */ _t110 = _t109 & 0x00000001u;
         /* 0226FAEC */ if (_t110) goto L_0226FB48; else goto L_0226FAF0;
   L_0226FAF0: ; // 0x226faf0
         /* 0226FAF0 */ _t111 = cpu->r[28] + 0x0000006Au;
         /* 0226FAF0 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t111);
-        /* 0226FAF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0xFFFFFFFFu);
-        /* 0226FAF8 */ _t112 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FAF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0xFFFFFFFFu));
+        /* 0226FAF8 */ _t112 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FAF8 */ _t113 = _t112 & 0x00000001u;
         /* 0226FAF8 */ if (_t113) goto L_0226FB48; else goto L_0226FAFC;
   L_0226FAFC: ; // 0x226fafc
@@ -12578,9 +12578,9 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
         /* 0226FB08 */ Gambit_fn_0297FC7C(cpu);
         /* 0226FB0C */ _t115 = cpu->r[30] + 0x0000001Cu;
         /* 0226FB0C */ cpu->r[12] = rbrew_read32(cpu->mem, _t115);
-        /* 0226FB10 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[12]);
+        /* 0226FB10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[12]));
         /* 0226FB14 */ cpu->r[11] = 0x00000000u;
-        /* 0226FB18 */ _t116 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226FB18 */ _t116 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226FB18 */ _t117 = _t116 & 0x00000001u;
         /* 0226FB18 */ if (_t117) goto L_0226FB1C; else goto L_0226FB28;
   L_0226FB1C: ; // 0x226fb1c
@@ -12607,8 +12607,8 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
   L_0226FB48: ; // 0x226fb48
         /* 0226FB48 */ _t126 = cpu->r[28] + 0x00000088u;
         /* 0226FB48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t126);
-        /* 0226FB4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226FB50 */ _t127 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FB4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226FB50 */ _t127 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FB50 */ _t128 = _t127 & 0x00000001u;
         /* 0226FB50 */ if (_t128) goto L_0226FB58; else goto L_0226FB54;
   L_0226FB54: ; // 0x226fb54
@@ -12616,8 +12616,8 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
   L_0226FB58: ; // 0x226fb58
         /* 0226FB58 */ _t129 = cpu->r[28] + 0x000000A4u;
         /* 0226FB58 */ cpu->r[3] = rbrew_read32(cpu->mem, _t129);
-        /* 0226FB5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226FB60 */ _t130 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FB5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226FB60 */ _t130 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FB60 */ _t131 = _t130 & 0x00000001u;
         /* 0226FB60 */ if (_t131) goto L_0226FB68; else goto L_0226FB64;
   L_0226FB64: ; // 0x226fb64
@@ -12625,8 +12625,8 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
   L_0226FB68: ; // 0x226fb68
         /* 0226FB68 */ _t132 = cpu->r[28] + 0x000000D8u;
         /* 0226FB68 */ cpu->r[3] = rbrew_read32(cpu->mem, _t132);
-        /* 0226FB6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226FB70 */ _t133 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FB6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226FB70 */ _t133 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FB70 */ _t134 = _t133 & 0x00000001u;
         /* 0226FB70 */ if (_t134) goto L_0226FB78; else goto L_0226FB74;
   L_0226FB74: ; // 0x226fb74
@@ -12635,10 +12635,10 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
         /* 0226FB78 */ _t135 = cpu->r[28] + 0x000000C8u;
         /* 0226FB78 */ cpu->r[10] = rbrew_read8(cpu->mem, _t135);
         /* 0226FB7C */ cpu->r[8] = 0x00000001u;
-        /* 0226FB80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0226FB80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0226FB84 */ _t136 = cpu->r[28] + 0x00000074u;
         /* 0226FB84 */ rbrew_write8(cpu->mem, _t136, (uint8_t)cpu->r[8]);
-        /* 0226FB88 */ _t137 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FB88 */ _t137 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FB88 */ _t138 = _t137 & 0x00000001u;
         /* 0226FB88 */ if (_t138) goto L_0226FBA4; else goto L_0226FB8C;
   L_0226FB8C: ; // 0x226fb8c
@@ -12676,8 +12676,8 @@ void Gambit_fn_0226F7FC(CPUState* cpu) {
         /* 0226FBD8 */ Gambit_fn_02000508(cpu);
         /* 0226FBDC */ _t150 = cpu->r[28] + 0x000000D4u;
         /* 0226FBDC */ cpu->r[3] = rbrew_read32(cpu->mem, _t150);
-        /* 0226FBE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226FBE4 */ _t151 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FBE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226FBE4 */ _t151 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FBE4 */ _t152 = _t151 & 0x00000001u;
         /* 0226FBE4 */ if (_t152) goto L_0226FBF0; else goto L_0226FBE8;
   L_0226FBE8: ; // 0x226fbe8
@@ -12701,9 +12701,9 @@ void Gambit_fn_0226FB0C(CPUState* cpu) {
   L_0226FB0C: ; // 0x226fb0c
         /* 0226FB0C */ _t0 = cpu->r[30] + 0x0000001Cu;
         /* 0226FB0C */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 0226FB10 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[31], cpu->r[12]);
+        /* 0226FB10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[31], cpu->r[12]));
         /* 0226FB14 */ cpu->r[11] = 0x00000000u;
-        /* 0226FB18 */ _t1 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226FB18 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226FB18 */ _t2 = _t1 & 0x00000001u;
         /* 0226FB18 */ if (_t2) goto L_0226FB1C; else goto L_0226FB28;
   L_0226FB1C: ; // 0x226fb1c
@@ -12729,8 +12729,8 @@ void Gambit_fn_0226FB0C(CPUState* cpu) {
         /* 0226FB44 */ rbrew_write32(cpu->mem, _t10, cpu->r[3]);
         /* 0226FB48 */ _t11 = cpu->r[28] + 0x00000088u;
         /* 0226FB48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t11);
-        /* 0226FB4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226FB50 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FB4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226FB50 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FB50 */ _t13 = _t12 & 0x00000001u;
         /* 0226FB50 */ if (_t13) goto L_0226FB58; else goto L_0226FB54;
   L_0226FB54: ; // 0x226fb54
@@ -12738,8 +12738,8 @@ void Gambit_fn_0226FB0C(CPUState* cpu) {
   L_0226FB58: ; // 0x226fb58
         /* 0226FB58 */ _t14 = cpu->r[28] + 0x000000A4u;
         /* 0226FB58 */ cpu->r[3] = rbrew_read32(cpu->mem, _t14);
-        /* 0226FB5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226FB60 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FB5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226FB60 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FB60 */ _t16 = _t15 & 0x00000001u;
         /* 0226FB60 */ if (_t16) goto L_0226FB68; else goto L_0226FB64;
   L_0226FB64: ; // 0x226fb64
@@ -12747,8 +12747,8 @@ void Gambit_fn_0226FB0C(CPUState* cpu) {
   L_0226FB68: ; // 0x226fb68
         /* 0226FB68 */ _t17 = cpu->r[28] + 0x000000D8u;
         /* 0226FB68 */ cpu->r[3] = rbrew_read32(cpu->mem, _t17);
-        /* 0226FB6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226FB70 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FB6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226FB70 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FB70 */ _t19 = _t18 & 0x00000001u;
         /* 0226FB70 */ if (_t19) goto L_0226FB78; else goto L_0226FB74;
   L_0226FB74: ; // 0x226fb74
@@ -12757,10 +12757,10 @@ void Gambit_fn_0226FB0C(CPUState* cpu) {
         /* 0226FB78 */ _t20 = cpu->r[28] + 0x000000C8u;
         /* 0226FB78 */ cpu->r[10] = rbrew_read8(cpu->mem, _t20);
         /* 0226FB7C */ cpu->r[8] = 0x00000001u;
-        /* 0226FB80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0226FB80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0226FB84 */ _t21 = cpu->r[28] + 0x00000074u;
         /* 0226FB84 */ rbrew_write8(cpu->mem, _t21, (uint8_t)cpu->r[8]);
-        /* 0226FB88 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FB88 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FB88 */ _t23 = _t22 & 0x00000001u;
         /* 0226FB88 */ if (_t23) goto L_0226FBA4; else goto L_0226FB8C;
   L_0226FB8C: ; // 0x226fb8c
@@ -12798,8 +12798,8 @@ void Gambit_fn_0226FB0C(CPUState* cpu) {
         /* 0226FBD8 */ Gambit_fn_02000508(cpu);
         /* 0226FBDC */ _t35 = cpu->r[28] + 0x000000D4u;
         /* 0226FBDC */ cpu->r[3] = rbrew_read32(cpu->mem, _t35);
-        /* 0226FBE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226FBE4 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FBE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226FBE4 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FBE4 */ _t37 = _t36 & 0x00000001u;
         /* 0226FBE4 */ if (_t37) goto L_0226FBF0; else goto L_0226FBE8;
   L_0226FBE8: ; // 0x226fbe8
@@ -12838,16 +12838,16 @@ void Gambit_fn_0226FC08(CPUState* cpu) {
         /* 02395548 */ _t3 = cpu->r[3] + 0x00005BA8u;
         /* 02395548 */ cpu->r[3] = rbrew_read32(cpu->mem, _t3);
         /* 0239554C */ cpu->r[5] = cpu->r[4];
-        /* 02395550 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02395550 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02395554 */ cpu->r[31] = 0x00000000u;
-        /* 02395558 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02395558 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02395558 */ _t5 = _t4 & 0x00000001u;
         /* 02395558 */ if (_t5) goto L_02395570; else goto L_0239555C;
   L_0239555C: ; // 0x239555c
         /* 0239555C */ cpu->r[4] = cpu->r[0];
         /* 02395560 */ Gambit_fn_0239B954(cpu);
-        /* 02395564 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02395568 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02395564 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02395568 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02395568 */ _t7 = _t6 & 0x00000001u;
         /* 02395568 */ if (_t7) goto L_02395570; else goto L_0239556C;
   L_0239556C: ; // 0x239556c
@@ -12914,15 +12914,15 @@ void Gambit_fn_0226FC14(CPUState* cpu) {
         /* 0231E360 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 0231E364 */ cpu->r[12] = (uint32_t)((int32_t)cpu->r[0] * (int32_t)0x00000068u);
         /* 0231E368 */ cpu->r[0] = cpu->r[28] + cpu->r[12];
-        /* 0231E36C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[0]);
-        /* 0231E370 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231E36C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[0]));
+        /* 0231E370 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231E370 */ _t16 = _t15 & 0x00000001u;
         /* 0231E370 */ if (_t16) goto L_0231E680; else goto L_0231E374;
   L_0231E374: ; // 0x231e374
         /* 0231E374 */ _t17 = cpu->r[28] + 0x00000004u;
         /* 0231E374 */ cpu->r[31] = rbrew_read32(cpu->mem, _t17);
-        /* 0231E378 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0231E37C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231E378 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0231E37C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231E37C */ _t19 = _t18 & 0x00000001u;
         /* 0231E37C */ if (_t19) goto L_0231E40C; else goto L_0231E380;
   L_0231E380: ; // 0x231e380
@@ -12934,9 +12934,9 @@ void Gambit_fn_0226FC14(CPUState* cpu) {
         /* 0231E390 */ Gambit_fn_0297FC7C(cpu);
         /* 0231E394 */ _t21 = cpu->r[31] + 0x0000001Cu;
         /* 0231E394 */ cpu->r[5] = rbrew_read32(cpu->mem, _t21);
-        /* 0231E398 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[27], cpu->r[5]);
+        /* 0231E398 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[27], cpu->r[5]));
         /* 0231E39C */ cpu->r[12] = 0x00000000u;
-        /* 0231E3A0 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0231E3A0 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0231E3A0 */ _t23 = _t22 & 0x00000001u;
         /* 0231E3A0 */ if (_t23) goto L_0231E3A4; else goto L_0231E3B0;
   L_0231E3A4: ; // 0x231e3a4
@@ -12973,8 +12973,8 @@ void Gambit_fn_0226FC14(CPUState* cpu) {
         /* 0231E3F8 */ _t32 = cpu->r[1] + 0x00000010u;
         /* 0231E3F8 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t32);
         /* 0231E3FC */ cpu->f[10] = fma(cpu->f[11], cpu->f[11], cpu->f[10]);
-        /* 0231E400 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
-        /* 0231E404 */ _t33 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0231E400 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
+        /* 0231E404 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0231E404 */ _t34 = _t33 & 0x00000001u;
         /* 0231E404 */ if (_t34) goto L_0231E408; else goto L_0231E4F0;
   L_0231E408: ; // 0x231e408
@@ -13046,8 +13046,8 @@ void Gambit_fn_0226FC14(CPUState* cpu) {
         /* 0231E49C */ _t62 = cpu->r[1] + 0x00000010u;
         /* 0231E49C */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t62);
         /* 0231E4A0 */ cpu->f[10] = fma(cpu->f[11], cpu->f[11], cpu->f[10]);
-        /* 0231E4A4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[31]);
-        /* 0231E4A8 */ _t63 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0231E4A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[31]));
+        /* 0231E4A8 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0231E4A8 */ _t64 = _t63 & 0x00000001u;
         /* 0231E4A8 */ if (_t64) goto L_0231E4AC; else goto L_0231E4F0;
   L_0231E4AC: ; // 0x231e4ac
@@ -13242,8 +13242,8 @@ void Gambit_fn_0226FC14(CPUState* cpu) {
         /* 0231E66C */ cpu->r[8] = rbrew_read32(cpu->mem, _t139);
         /* 0231E670 */ cpu->r[28] = cpu->r[28] + 0x00000068u;
         /* 0231E674 */ cpu->r[0] = cpu->r[8] + cpu->r[12];
-        /* 0231E678 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[28], cpu->r[0]);
-        /* 0231E67C */ _t140 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231E678 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[28], cpu->r[0]));
+        /* 0231E67C */ _t140 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231E67C */ _t141 = _t140 & 0x00000001u;
         /* 0231E67C */ if (_t141) goto L_0231E680; else goto L_0231E374;
   L_0231E680: ; // 0x231e680
@@ -13264,7 +13264,7 @@ void Gambit_fn_0226FC14(CPUState* cpu) {
         /* 0231E69C */ cpu->f[28] = rbrew_read_f64(cpu->mem, _t148);
         /* 0231E6A0 */ _t149 = cpu->r[1] + 0x00000108u;
         /* 0231E6A0 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t149);
-        /* 0231E6A4 */ _t150 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0231E6A4 */ _t150 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0231E6A4 */ _t151 = _t150 & 0x00000001u;
         /* 0231E6A4 */ if (_t151) goto L_0231E6A8; // else: addr-0 trap, fall-through
   L_0231E6A8: ; // 0x231e6a8
@@ -13293,8 +13293,8 @@ void Gambit_fn_0226FC20(CPUState* cpu) {
         /* 0226FC34 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 0226FC38 */ _t4 = cpu->r[30] + 0x000000DCu;
         /* 0226FC38 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
-        /* 0226FC3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226FC40 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FC3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226FC40 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FC40 */ _t6 = _t5 & 0x00000001u;
         /* 0226FC40 */ if (_t6) goto L_0226FC78; else goto L_0226FC44;
   L_0226FC44: ; // 0x226fc44
@@ -13302,17 +13302,17 @@ void Gambit_fn_0226FC20(CPUState* cpu) {
         /* 0226FC44 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
         /* 0226FC48 */ cpu->r[31] = 0x00000001u;
         /* 0226FC4C */ Gambit_fn_0231E06C(cpu);
-        /* 0226FC50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0226FC50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0226FC54 */ _t8 = cpu->r[30] + 0x000000DCu;
         /* 0226FC54 */ cpu->r[3] = rbrew_read32(cpu->mem, _t8);
-        /* 0226FC58 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FC58 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FC58 */ _t10 = _t9 & 0x00000001u;
         /* 0226FC58 */ if (_t10) goto L_0226FC5C; else goto L_0226FC6C;
   L_0226FC5C: ; // 0x226fc5c
         /* 0226FC5C */ _t11 = cpu->r[30] + 0x000000D0u;
         /* 0226FC5C */ cpu->r[0] = rbrew_read8(cpu->mem, _t11);
-        /* 0226FC60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226FC64 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FC60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226FC64 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FC64 */ _t13 = _t12 & 0x00000001u;
         /* 0226FC64 */ if (_t13) goto L_0226FC68; else goto L_0226FC6C;
   L_0226FC68: ; // 0x226fc68
@@ -13350,8 +13350,8 @@ void Gambit_fn_0226FC24(CPUState* cpu) {
         /* 0226FC34 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
         /* 0226FC38 */ _t4 = cpu->r[30] + 0x000000DCu;
         /* 0226FC38 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
-        /* 0226FC3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226FC40 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FC3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226FC40 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FC40 */ _t6 = _t5 & 0x00000001u;
         /* 0226FC40 */ if (_t6) goto L_0226FC78; else goto L_0226FC44;
   L_0226FC44: ; // 0x226fc44
@@ -13359,17 +13359,17 @@ void Gambit_fn_0226FC24(CPUState* cpu) {
         /* 0226FC44 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
         /* 0226FC48 */ cpu->r[31] = 0x00000001u;
         /* 0226FC4C */ Gambit_fn_0231E06C(cpu);
-        /* 0226FC50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0226FC50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0226FC54 */ _t8 = cpu->r[30] + 0x000000DCu;
         /* 0226FC54 */ cpu->r[3] = rbrew_read32(cpu->mem, _t8);
-        /* 0226FC58 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FC58 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FC58 */ _t10 = _t9 & 0x00000001u;
         /* 0226FC58 */ if (_t10) goto L_0226FC5C; else goto L_0226FC6C;
   L_0226FC5C: ; // 0x226fc5c
         /* 0226FC5C */ _t11 = cpu->r[30] + 0x000000D0u;
         /* 0226FC5C */ cpu->r[0] = rbrew_read8(cpu->mem, _t11);
-        /* 0226FC60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226FC64 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FC60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226FC64 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FC64 */ _t13 = _t12 & 0x00000001u;
         /* 0226FC64 */ if (_t13) goto L_0226FC68; else goto L_0226FC6C;
   L_0226FC68: ; // 0x226fc68
@@ -13401,10 +13401,10 @@ void Gambit_fn_0226FC90(CPUState* cpu) {
         /* 0226FC98 */ cpu->f[13] = cpu->f[11] + cpu->f[1];
         /* 0226FC9C */ _t1 = cpu->r[12] + 0xFFFF8F18u;
         /* 0226FC9C */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t1);
-        /* 0226FCA0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[12]);
+        /* 0226FCA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[12]));
         /* 0226FCA4 */ _t2 = cpu->r[3] + 0x000000E4u;
         /* 0226FCA4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t2);
-        /* 0226FCA8 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226FCA8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226FCA8 */ _t4 = _t3 & 0x00000001u;
         /* 0226FCA8 */ if (_t4) goto L_0226FCAC; else goto L_0226FCC4;
   L_0226FCAC: ; // 0x226fcac
@@ -13412,15 +13412,15 @@ void Gambit_fn_0226FC90(CPUState* cpu) {
         /* 0226FCB0 */ cpu->f[13] = cpu->f[12];
         /* 0226FCB4 */ _t5 = cpu->r[12] + 0xFFFF9098u;
         /* 0226FCB4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t5);
-        /* 0226FCB8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 0226FCBC */ _t6 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226FCB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 0226FCBC */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226FCBC */ _t7 = _t6 & 0x00000001u;
         /* 0226FCBC */ if (_t7) goto L_0226FCE0; else goto L_0226FCC0;
   L_0226FCC0: ; // 0x226fcc0
         /* 0226FCC0 */ goto L_0226FCE4;
   L_0226FCC4: ; // 0x226fcc4
-        /* 0226FCC4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 0226FCC8 */ _t8 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0226FCC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 0226FCC8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0226FCC8 */ _t9 = _t8 & 0x00000001u;
         /* 0226FCC8 */ if (_t9) goto L_0226FCCC; else goto L_0226FCD0;
   L_0226FCCC: ; // 0x226fccc
@@ -13429,8 +13429,8 @@ void Gambit_fn_0226FC90(CPUState* cpu) {
         /* 0226FCD0 */ cpu->r[12] = 0x10060000u;
         /* 0226FCD4 */ _t10 = cpu->r[12] + 0xFFFF9098u;
         /* 0226FCD4 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t10);
-        /* 0226FCD8 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[0]);
-        /* 0226FCDC */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226FCD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[0]));
+        /* 0226FCDC */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226FCDC */ _t12 = _t11 & 0x00000001u;
         /* 0226FCDC */ if (_t12) goto L_0226FCE0; else goto L_0226FCE4;
   L_0226FCE0: ; // 0x226fce0
@@ -13467,9 +13467,9 @@ void Gambit_fn_0226FCEC(CPUState* cpu) {
         /* 0226FD18 */ cpu->r[27] = 0x101D0000u;
         /* 0226FD1C */ cpu->r[31] = cpu->r[3];
         /* 0226FD20 */ cpu->r[29] = 0x10060000u;
-        /* 0226FD24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0226FD24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0226FD28 */ cpu->r[29] = cpu->r[29] + 0xFFFF9008u;
-        /* 0226FD2C */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FD2C */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FD2C */ _t6 = _t5 & 0x00000001u;
         /* 0226FD2C */ if (_t6) goto L_0226FD30; else goto L_0226FD3C;
   L_0226FD30: ; // 0x226fd30
@@ -13479,8 +13479,8 @@ void Gambit_fn_0226FCEC(CPUState* cpu) {
         /* 0226FD38 */ _t8 = cpu->r[28] + 0x00000000u;
         /* 0226FD38 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
   L_0226FD3C: ; // 0x226fd3c
-        /* 0226FD3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226FD40 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FD3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226FD40 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FD40 */ _t10 = _t9 & 0x00000001u;
         /* 0226FD40 */ if (_t10) goto L_0226FD64; else goto L_0226FD44;
   L_0226FD44: ; // 0x226fd44
@@ -13492,8 +13492,8 @@ void Gambit_fn_0226FCEC(CPUState* cpu) {
         /* 0226FD50 */ cpu->r[3] = cpu->r[31];
         /* 0226FD54 */ cpu->r[4] = cpu->r[27] + 0xFFFFFFE8u;
         /* 0226FD58 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226FD5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226FD60 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FD5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226FD60 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FD60 */ _t14 = _t13 & 0x00000001u;
         /* 0226FD60 */ if (_t14) goto L_0226FD64; else goto L_0226FD68;
   L_0226FD64: ; // 0x226fd64
@@ -13501,8 +13501,8 @@ void Gambit_fn_0226FCEC(CPUState* cpu) {
   L_0226FD68: ; // 0x226fd68
         /* 0226FD68 */ _t15 = cpu->r[31] + 0x000001B0u;
         /* 0226FD68 */ cpu->r[0] = rbrew_read8(cpu->mem, _t15);
-        /* 0226FD6C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0226FD70 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FD6C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0226FD70 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FD70 */ _t17 = _t16 & 0x00000001u;
         /* 0226FD70 */ if (_t17) goto L_0226FEF0; else goto L_0226FD74;
   L_0226FD74: ; // 0x226fd74
@@ -13510,10 +13510,10 @@ void Gambit_fn_0226FCEC(CPUState* cpu) {
         /* 0226FD74 */ cpu->r[8] = rbrew_read32(cpu->mem, _t18);
         /* 0226FD78 */ cpu->r[10] = 0x10060000u;
         /* 0226FD7C */ cpu->r[9] = rbrew_rlwinm(cpu->r[8], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 0226FD7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0226FD7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0226FD80 */ _t19 = cpu->r[10] + 0xFFFF8F18u;
         /* 0226FD80 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t19);
-        /* 0226FD84 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FD84 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FD84 */ _t21 = _t20 & 0x00000001u;
         /* 0226FD84 */ if (_t21) goto L_0226FD88; else goto L_0226FDB0;
   L_0226FD88: ; // 0x226fd88
@@ -13526,9 +13526,9 @@ void Gambit_fn_0226FCEC(CPUState* cpu) {
         /* 0226FD98 */ cpu->f[10] = cpu->f[10] + cpu->f[12];
         /* 0226FD9C */ _t24 = cpu->r[12] + 0xFFFF906Cu;
         /* 0226FD9C */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t24);
-        /* 0226FDA0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[10]);
+        /* 0226FDA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[10]));
         /* 0226FDA4 */ cpu->f[0] = cpu->f[10];
-        /* 0226FDA8 */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226FDA8 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226FDA8 */ _t26 = _t25 & 0x00000001u;
         /* 0226FDA8 */ if (_t26) goto L_0226FDD0; else goto L_0226FDAC;
   L_0226FDAC: ; // 0x226fdac
@@ -13541,9 +13541,9 @@ void Gambit_fn_0226FCEC(CPUState* cpu) {
         /* 0226FDBC */ cpu->f[10] = cpu->f[31] + cpu->f[12];
         /* 0226FDC0 */ _t28 = cpu->r[12] + 0xFFFF906Cu;
         /* 0226FDC0 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t28);
-        /* 0226FDC4 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[10]);
+        /* 0226FDC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[10]));
         /* 0226FDC8 */ cpu->f[0] = cpu->f[10];
-        /* 0226FDCC */ _t29 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226FDCC */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226FDCC */ _t30 = _t29 & 0x00000001u;
         /* 0226FDCC */ if (_t30) goto L_0226FDD0; else goto L_0226FDF0;
   L_0226FDD0: ; // 0x226fdd0
@@ -13553,18 +13553,18 @@ void Gambit_fn_0226FCEC(CPUState* cpu) {
         /* 0226FDD8 */ Gambit_fn_0226ED34(cpu);
         /* 0226FDDC */ _t32 = cpu->r[28] + 0x00000000u;
         /* 0226FDDC */ cpu->r[10] = rbrew_read32(cpu->mem, _t32);
-        /* 0226FDE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0226FDE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0226FDE4 */ cpu->r[31] = cpu->r[3];
-        /* 0226FDE8 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FDE8 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FDE8 */ _t34 = _t33 & 0x00000001u;
         /* 0226FDE8 */ if (_t34) goto L_0226FDEC; else goto L_0226FE20;
   L_0226FDEC: ; // 0x226fdec
         /* 0226FDEC */ goto L_0226FE14;
   L_0226FDF0: ; // 0x226fdf0
-        /* 0226FDF0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[13]);
+        /* 0226FDF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[13]));
         /* 0226FDF4 */ _t35 = cpu->r[30] + 0x000000E8u;
         /* 0226FDF4 */ rbrew_write_f32(cpu->mem, _t35, cpu->f[0]);
-        /* 0226FDF8 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FDF8 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FDF8 */ _t37 = _t36 & 0x00000001u;
         /* 0226FDF8 */ if (_t37) goto L_0226FDFC; else goto L_0226FEF0;
   L_0226FDFC: ; // 0x226fdfc
@@ -13572,9 +13572,9 @@ void Gambit_fn_0226FCEC(CPUState* cpu) {
         /* 0226FE00 */ Gambit_fn_0226ED34(cpu);
         /* 0226FE04 */ _t38 = cpu->r[28] + 0x00000000u;
         /* 0226FE04 */ cpu->r[10] = rbrew_read32(cpu->mem, _t38);
-        /* 0226FE08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 0226FE08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 0226FE0C */ cpu->r[31] = cpu->r[3];
-        /* 0226FE10 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FE10 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FE10 */ _t40 = _t39 & 0x00000001u;
         /* 0226FE10 */ if (_t40) goto L_0226FE14; else goto L_0226FE20;
   L_0226FE14: ; // 0x226fe14
@@ -13584,8 +13584,8 @@ void Gambit_fn_0226FCEC(CPUState* cpu) {
         /* 0226FE1C */ _t42 = cpu->r[28] + 0x00000000u;
         /* 0226FE1C */ rbrew_write32(cpu->mem, _t42, cpu->r[0]);
   L_0226FE20: ; // 0x226fe20
-        /* 0226FE20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226FE24 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FE20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226FE24 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FE24 */ _t44 = _t43 & 0x00000001u;
         /* 0226FE24 */ if (_t44) goto L_0226FE48; else goto L_0226FE28;
   L_0226FE28: ; // 0x226fe28
@@ -13597,8 +13597,8 @@ void Gambit_fn_0226FCEC(CPUState* cpu) {
         /* 0226FE34 */ cpu->r[3] = cpu->r[31];
         /* 0226FE38 */ cpu->r[4] = cpu->r[27] + 0xFFFFFFE8u;
         /* 0226FE3C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226FE40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226FE44 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FE40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226FE44 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FE44 */ _t48 = _t47 & 0x00000001u;
         /* 0226FE44 */ if (_t48) goto L_0226FE48; else goto L_0226FE4C;
   L_0226FE48: ; // 0x226fe48
@@ -13606,8 +13606,8 @@ void Gambit_fn_0226FCEC(CPUState* cpu) {
   L_0226FE4C: ; // 0x226fe4c
         /* 0226FE4C */ _t49 = cpu->r[31] + 0x00000208u;
         /* 0226FE4C */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t49);
-        /* 0226FE50 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[12], cpu->f[31]);
-        /* 0226FE54 */ _t50 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226FE50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[12], cpu->f[31]));
+        /* 0226FE54 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226FE54 */ _t51 = _t50 & 0x00000001u;
         /* 0226FE54 */ if (_t51) goto L_0226FECC; else goto L_0226FE58;
   L_0226FE58: ; // 0x226fe58
@@ -13615,9 +13615,9 @@ void Gambit_fn_0226FCEC(CPUState* cpu) {
         /* 0226FE5C */ Gambit_fn_0226ED34(cpu);
         /* 0226FE60 */ _t52 = cpu->r[28] + 0x00000000u;
         /* 0226FE60 */ cpu->r[9] = rbrew_read32(cpu->mem, _t52);
-        /* 0226FE64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 0226FE64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 0226FE68 */ cpu->r[31] = cpu->r[3];
-        /* 0226FE6C */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FE6C */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FE6C */ _t54 = _t53 & 0x00000001u;
         /* 0226FE6C */ if (_t54) goto L_0226FE70; else goto L_0226FE7C;
   L_0226FE70: ; // 0x226fe70
@@ -13627,8 +13627,8 @@ void Gambit_fn_0226FCEC(CPUState* cpu) {
         /* 0226FE78 */ _t56 = cpu->r[28] + 0x00000000u;
         /* 0226FE78 */ rbrew_write32(cpu->mem, _t56, cpu->r[10]);
   L_0226FE7C: ; // 0x226fe7c
-        /* 0226FE7C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0226FE80 */ _t57 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FE7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0226FE80 */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FE80 */ _t58 = _t57 & 0x00000001u;
         /* 0226FE80 */ if (_t58) goto L_0226FEA4; else goto L_0226FE84;
   L_0226FE84: ; // 0x226fe84
@@ -13640,8 +13640,8 @@ void Gambit_fn_0226FCEC(CPUState* cpu) {
         /* 0226FE90 */ cpu->r[3] = cpu->r[31];
         /* 0226FE94 */ cpu->r[4] = cpu->r[27] + 0xFFFFFFE8u;
         /* 0226FE98 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0226FE9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0226FEA0 */ _t61 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FE9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0226FEA0 */ _t61 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FEA0 */ _t62 = _t61 & 0x00000001u;
         /* 0226FEA0 */ if (_t62) goto L_0226FEA4; else goto L_0226FEA8;
   L_0226FEA4: ; // 0x226fea4
@@ -13678,7 +13678,7 @@ void Gambit_fn_0226FCEC(CPUState* cpu) {
         /* 0226FEF4 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t69);
         /* 0226FEF8 */ _t70 = cpu->r[1] + 0x00000020u;
         /* 0226FEF8 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t70);
-        /* 0226FEFC */ _t71 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226FEFC */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226FEFC */ _t72 = _t71 & 0x00000001u;
         /* 0226FEFC */ if (_t72) goto L_0226FF00; // else: addr-0 trap, fall-through
   L_0226FF00: ; // 0x226ff00
@@ -13708,8 +13708,8 @@ void Gambit_fn_0226FF10(CPUState* cpu) {
         /* 0226FF28 */ _t4 = cpu->r[31] + 0x0000000Cu;
         /* 0226FF28 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
         /* 0226FF2C */ cpu->r[10] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0226FF2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0226FF30 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FF2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0226FF30 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FF30 */ _t6 = _t5 & 0x00000001u;
         /* 0226FF30 */ if (_t6) goto L_0226FF34; else goto L_0227019C;
   L_0226FF34: ; // 0x226ff34
@@ -13717,19 +13717,19 @@ void Gambit_fn_0226FF10(CPUState* cpu) {
         /* 0226FF34 */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
         /* 0226FF38 */ cpu->r[30] = 0x00000000u;
         /* 0226FF3C */ cpu->r[0] = cpu->r[12] + 0xFFFFFFFFu;
-        /* 0226FF3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0226FF3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0226FF40 */ _t8 = cpu->r[31] + 0x00000050u;
         /* 0226FF40 */ cpu->r[9] = rbrew_read32(cpu->mem, _t8);
-        /* 0226FF44 */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226FF44 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226FF44 */ _t10 = _t9 & 0x00000001u;
         /* 0226FF44 */ if (_t10) goto L_0226FF48; else goto L_0226FF4C;
   L_0226FF48: ; // 0x226ff48
         /* 0226FF48 */ cpu->r[0] = cpu->r[30];
   L_0226FF4C: ; // 0x226ff4c
-        /* 0226FF4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000001u);
+        /* 0226FF4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000001u));
         /* 0226FF50 */ _t11 = cpu->r[31] + 0x000000BCu;
         /* 0226FF50 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
-        /* 0226FF54 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FF54 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FF54 */ _t13 = _t12 & 0x00000001u;
         /* 0226FF54 */ if (_t13) goto L_0226FF58; else goto L_02270068;
   L_0226FF58: ; // 0x226ff58
@@ -13738,10 +13738,10 @@ void Gambit_fn_0226FF10(CPUState* cpu) {
         /* 0226FF5C */ cpu->r[12] = cpu->r[12] + 0x00000001u;
         /* 0226FF60 */ _t15 = cpu->r[31] + 0x000000B0u;
         /* 0226FF60 */ cpu->r[6] = rbrew_read32(cpu->mem, _t15);
-        /* 0226FF64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000032u);
+        /* 0226FF64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000032u));
         /* 0226FF68 */ _t16 = cpu->r[31] + 0x00000054u;
         /* 0226FF68 */ rbrew_write32(cpu->mem, _t16, cpu->r[12]);
-        /* 0226FF6C */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0226FF6C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0226FF6C */ _t18 = _t17 & 0x00000001u;
         /* 0226FF6C */ if (_t18) goto L_0226FF70; else goto L_0226FF78;
   L_0226FF70: ; // 0x226ff70
@@ -13750,8 +13750,8 @@ void Gambit_fn_0226FF10(CPUState* cpu) {
         /* 0226FF74 */ _t20 = cpu->r[31] + 0x00000050u;
         /* 0226FF74 */ cpu->r[5] = rbrew_read32(cpu->mem, _t20);
   L_0226FF78: ; // 0x226ff78
-        /* 0226FF78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0226FF7C */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FF78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0226FF7C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FF7C */ _t22 = _t21 & 0x00000001u;
         /* 0226FF7C */ if (_t22) goto L_0227019C; else goto L_0226FF80;
   L_0226FF80: ; // 0x226ff80
@@ -13864,15 +13864,15 @@ void Gambit_fn_0226FF10(CPUState* cpu) {
   L_02270068: ; // 0x2270068
         /* 02270068 */ cpu->r[3] = cpu->r[31];
         /* 0227006C */ Gambit_fn_0226FC08(cpu);
-        /* 02270070 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02270070 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02270074 */ _t66 = cpu->r[31] + 0x000000C8u;
         /* 02270074 */ cpu->r[5] = rbrew_read8(cpu->mem, _t66);
-        /* 02270078 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270078 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270078 */ _t68 = _t67 & 0x00000001u;
         /* 02270078 */ if (_t68) goto L_022700C4; else goto L_0227007C;
   L_0227007C: ; // 0x227007c
-        /* 0227007C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 02270080 */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227007C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 02270080 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270080 */ _t70 = _t69 & 0x00000001u;
         /* 02270080 */ if (_t70) goto L_02270084; else goto L_0227019C;
   L_02270084: ; // 0x2270084
@@ -13900,8 +13900,8 @@ void Gambit_fn_0226FF10(CPUState* cpu) {
         /* 022700BC */ cpu->r[1] = cpu->r[1] + 0x00000070u;
         /* 022700C0 */ return;
   L_022700C4: ; // 0x22700c4
-        /* 022700C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 022700C8 */ _t78 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022700C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 022700C8 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022700C8 */ _t79 = _t78 & 0x00000001u;
         /* 022700C8 */ if (_t79) goto L_022700F0; else goto L_022700CC;
   L_022700CC: ; // 0x22700cc
@@ -13921,15 +13921,15 @@ void Gambit_fn_0226FF10(CPUState* cpu) {
   L_022700F0: ; // 0x22700f0
         /* 022700F0 */ _t84 = cpu->r[31] + 0x00000070u;
         /* 022700F0 */ cpu->r[4] = rbrew_read32(cpu->mem, _t84);
-        /* 022700F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 022700F8 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022700F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 022700F8 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022700F8 */ _t86 = _t85 & 0x00000001u;
         /* 022700F8 */ if (_t86) goto L_02270118; else goto L_022700FC;
   L_022700FC: ; // 0x22700fc
         /* 022700FC */ _t87 = cpu->r[31] + 0x00000074u;
         /* 022700FC */ cpu->r[0] = rbrew_read8(cpu->mem, _t87);
-        /* 02270100 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02270104 */ _t88 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270100 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02270104 */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270104 */ _t89 = _t88 & 0x00000001u;
         /* 02270104 */ if (_t89) goto L_02270118; else goto L_02270108;
   L_02270108: ; // 0x2270108
@@ -13940,15 +13940,15 @@ void Gambit_fn_0226FF10(CPUState* cpu) {
   L_02270118: ; // 0x2270118
         /* 02270118 */ _t90 = cpu->r[31] + 0x00000088u;
         /* 02270118 */ cpu->r[3] = rbrew_read32(cpu->mem, _t90);
-        /* 0227011C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270120 */ _t91 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227011C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270120 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270120 */ _t92 = _t91 & 0x00000001u;
         /* 02270120 */ if (_t92) goto L_02270134; else goto L_02270124;
   L_02270124: ; // 0x2270124
         /* 02270124 */ _t93 = cpu->r[31] + 0x00000070u;
         /* 02270124 */ cpu->r[4] = rbrew_read32(cpu->mem, _t93);
-        /* 02270128 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0227012C */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270128 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0227012C */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227012C */ _t95 = _t94 & 0x00000001u;
         /* 0227012C */ if (_t95) goto L_02270134; else goto L_02270130;
   L_02270130: ; // 0x2270130
@@ -13956,8 +13956,8 @@ void Gambit_fn_0226FF10(CPUState* cpu) {
   L_02270134: ; // 0x2270134
         /* 02270134 */ _t96 = cpu->r[31] + 0x0000008Cu;
         /* 02270134 */ cpu->r[3] = rbrew_read32(cpu->mem, _t96);
-        /* 02270138 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0227013C */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270138 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0227013C */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227013C */ _t98 = _t97 & 0x00000001u;
         /* 0227013C */ if (_t98) goto L_02270144; else goto L_02270140;
   L_02270140: ; // 0x2270140
@@ -13965,8 +13965,8 @@ void Gambit_fn_0226FF10(CPUState* cpu) {
   L_02270144: ; // 0x2270144
         /* 02270144 */ _t99 = cpu->r[31] + 0x00000064u;
         /* 02270144 */ cpu->r[3] = rbrew_read32(cpu->mem, _t99);
-        /* 02270148 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0227014C */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270148 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0227014C */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227014C */ _t101 = _t100 & 0x00000001u;
         /* 0227014C */ if (_t101) goto L_02270154; else goto L_02270150;
   L_02270150: ; // 0x2270150
@@ -13974,8 +13974,8 @@ void Gambit_fn_0226FF10(CPUState* cpu) {
   L_02270154: ; // 0x2270154
         /* 02270154 */ _t102 = cpu->r[31] + 0x000000A4u;
         /* 02270154 */ cpu->r[3] = rbrew_read32(cpu->mem, _t102);
-        /* 02270158 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0227015C */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0227015C */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227015C */ _t104 = _t103 & 0x00000001u;
         /* 0227015C */ if (_t104) goto L_02270164; else goto L_02270160;
   L_02270160: ; // 0x2270160
@@ -13983,8 +13983,8 @@ void Gambit_fn_0226FF10(CPUState* cpu) {
   L_02270164: ; // 0x2270164
         /* 02270164 */ _t105 = cpu->r[31] + 0x000000B0u;
         /* 02270164 */ cpu->r[7] = rbrew_read32(cpu->mem, _t105);
-        /* 02270168 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0227016C */ _t106 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270168 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0227016C */ _t106 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227016C */ _t107 = _t106 & 0x00000001u;
         /* 0227016C */ if (_t107) goto L_02270184; else goto L_02270170;
   L_02270170: ; // 0x2270170
@@ -14032,8 +14032,8 @@ void Gambit_fn_0226FF14(CPUState* cpu) {
         /* 0226FF28 */ _t4 = cpu->r[31] + 0x0000000Cu;
         /* 0226FF28 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
         /* 0226FF2C */ cpu->r[10] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0226FF2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0226FF30 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FF2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0226FF30 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FF30 */ _t6 = _t5 & 0x00000001u;
         /* 0226FF30 */ if (_t6) goto L_0226FF34; else goto L_0227019C;
   L_0226FF34: ; // 0x226ff34
@@ -14041,19 +14041,19 @@ void Gambit_fn_0226FF14(CPUState* cpu) {
         /* 0226FF34 */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
         /* 0226FF38 */ cpu->r[30] = 0x00000000u;
         /* 0226FF3C */ cpu->r[0] = cpu->r[12] + 0xFFFFFFFFu;
-        /* 0226FF3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0226FF3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0226FF40 */ _t8 = cpu->r[31] + 0x00000050u;
         /* 0226FF40 */ cpu->r[9] = rbrew_read32(cpu->mem, _t8);
-        /* 0226FF44 */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226FF44 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226FF44 */ _t10 = _t9 & 0x00000001u;
         /* 0226FF44 */ if (_t10) goto L_0226FF48; else goto L_0226FF4C;
   L_0226FF48: ; // 0x226ff48
         /* 0226FF48 */ cpu->r[0] = cpu->r[30];
   L_0226FF4C: ; // 0x226ff4c
-        /* 0226FF4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000001u);
+        /* 0226FF4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000001u));
         /* 0226FF50 */ _t11 = cpu->r[31] + 0x000000BCu;
         /* 0226FF50 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
-        /* 0226FF54 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FF54 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FF54 */ _t13 = _t12 & 0x00000001u;
         /* 0226FF54 */ if (_t13) goto L_0226FF58; else goto L_02270068;
   L_0226FF58: ; // 0x226ff58
@@ -14062,10 +14062,10 @@ void Gambit_fn_0226FF14(CPUState* cpu) {
         /* 0226FF5C */ cpu->r[12] = cpu->r[12] + 0x00000001u;
         /* 0226FF60 */ _t15 = cpu->r[31] + 0x000000B0u;
         /* 0226FF60 */ cpu->r[6] = rbrew_read32(cpu->mem, _t15);
-        /* 0226FF64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000032u);
+        /* 0226FF64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000032u));
         /* 0226FF68 */ _t16 = cpu->r[31] + 0x00000054u;
         /* 0226FF68 */ rbrew_write32(cpu->mem, _t16, cpu->r[12]);
-        /* 0226FF6C */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0226FF6C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0226FF6C */ _t18 = _t17 & 0x00000001u;
         /* 0226FF6C */ if (_t18) goto L_0226FF70; else goto L_0226FF78;
   L_0226FF70: ; // 0x226ff70
@@ -14074,8 +14074,8 @@ void Gambit_fn_0226FF14(CPUState* cpu) {
         /* 0226FF74 */ _t20 = cpu->r[31] + 0x00000050u;
         /* 0226FF74 */ cpu->r[5] = rbrew_read32(cpu->mem, _t20);
   L_0226FF78: ; // 0x226ff78
-        /* 0226FF78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0226FF7C */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FF78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0226FF7C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FF7C */ _t22 = _t21 & 0x00000001u;
         /* 0226FF7C */ if (_t22) goto L_0227019C; else goto L_0226FF80;
   L_0226FF80: ; // 0x226ff80
@@ -14188,15 +14188,15 @@ void Gambit_fn_0226FF14(CPUState* cpu) {
   L_02270068: ; // 0x2270068
         /* 02270068 */ cpu->r[3] = cpu->r[31];
         /* 0227006C */ Gambit_fn_0226FC08(cpu);
-        /* 02270070 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02270070 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02270074 */ _t66 = cpu->r[31] + 0x000000C8u;
         /* 02270074 */ cpu->r[5] = rbrew_read8(cpu->mem, _t66);
-        /* 02270078 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270078 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270078 */ _t68 = _t67 & 0x00000001u;
         /* 02270078 */ if (_t68) goto L_022700C4; else goto L_0227007C;
   L_0227007C: ; // 0x227007c
-        /* 0227007C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 02270080 */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227007C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 02270080 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270080 */ _t70 = _t69 & 0x00000001u;
         /* 02270080 */ if (_t70) goto L_02270084; else goto L_0227019C;
   L_02270084: ; // 0x2270084
@@ -14224,8 +14224,8 @@ void Gambit_fn_0226FF14(CPUState* cpu) {
         /* 022700BC */ cpu->r[1] = cpu->r[1] + 0x00000070u;
         /* 022700C0 */ return;
   L_022700C4: ; // 0x22700c4
-        /* 022700C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 022700C8 */ _t78 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022700C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 022700C8 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022700C8 */ _t79 = _t78 & 0x00000001u;
         /* 022700C8 */ if (_t79) goto L_022700F0; else goto L_022700CC;
   L_022700CC: ; // 0x22700cc
@@ -14245,15 +14245,15 @@ void Gambit_fn_0226FF14(CPUState* cpu) {
   L_022700F0: ; // 0x22700f0
         /* 022700F0 */ _t84 = cpu->r[31] + 0x00000070u;
         /* 022700F0 */ cpu->r[4] = rbrew_read32(cpu->mem, _t84);
-        /* 022700F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 022700F8 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022700F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 022700F8 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022700F8 */ _t86 = _t85 & 0x00000001u;
         /* 022700F8 */ if (_t86) goto L_02270118; else goto L_022700FC;
   L_022700FC: ; // 0x22700fc
         /* 022700FC */ _t87 = cpu->r[31] + 0x00000074u;
         /* 022700FC */ cpu->r[0] = rbrew_read8(cpu->mem, _t87);
-        /* 02270100 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02270104 */ _t88 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270100 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02270104 */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270104 */ _t89 = _t88 & 0x00000001u;
         /* 02270104 */ if (_t89) goto L_02270118; else goto L_02270108;
   L_02270108: ; // 0x2270108
@@ -14264,15 +14264,15 @@ void Gambit_fn_0226FF14(CPUState* cpu) {
   L_02270118: ; // 0x2270118
         /* 02270118 */ _t90 = cpu->r[31] + 0x00000088u;
         /* 02270118 */ cpu->r[3] = rbrew_read32(cpu->mem, _t90);
-        /* 0227011C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270120 */ _t91 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227011C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270120 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270120 */ _t92 = _t91 & 0x00000001u;
         /* 02270120 */ if (_t92) goto L_02270134; else goto L_02270124;
   L_02270124: ; // 0x2270124
         /* 02270124 */ _t93 = cpu->r[31] + 0x00000070u;
         /* 02270124 */ cpu->r[4] = rbrew_read32(cpu->mem, _t93);
-        /* 02270128 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0227012C */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270128 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0227012C */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227012C */ _t95 = _t94 & 0x00000001u;
         /* 0227012C */ if (_t95) goto L_02270134; else goto L_02270130;
   L_02270130: ; // 0x2270130
@@ -14280,8 +14280,8 @@ void Gambit_fn_0226FF14(CPUState* cpu) {
   L_02270134: ; // 0x2270134
         /* 02270134 */ _t96 = cpu->r[31] + 0x0000008Cu;
         /* 02270134 */ cpu->r[3] = rbrew_read32(cpu->mem, _t96);
-        /* 02270138 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0227013C */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270138 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0227013C */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227013C */ _t98 = _t97 & 0x00000001u;
         /* 0227013C */ if (_t98) goto L_02270144; else goto L_02270140;
   L_02270140: ; // 0x2270140
@@ -14289,8 +14289,8 @@ void Gambit_fn_0226FF14(CPUState* cpu) {
   L_02270144: ; // 0x2270144
         /* 02270144 */ _t99 = cpu->r[31] + 0x00000064u;
         /* 02270144 */ cpu->r[3] = rbrew_read32(cpu->mem, _t99);
-        /* 02270148 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0227014C */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270148 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0227014C */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227014C */ _t101 = _t100 & 0x00000001u;
         /* 0227014C */ if (_t101) goto L_02270154; else goto L_02270150;
   L_02270150: ; // 0x2270150
@@ -14298,8 +14298,8 @@ void Gambit_fn_0226FF14(CPUState* cpu) {
   L_02270154: ; // 0x2270154
         /* 02270154 */ _t102 = cpu->r[31] + 0x000000A4u;
         /* 02270154 */ cpu->r[3] = rbrew_read32(cpu->mem, _t102);
-        /* 02270158 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0227015C */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0227015C */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227015C */ _t104 = _t103 & 0x00000001u;
         /* 0227015C */ if (_t104) goto L_02270164; else goto L_02270160;
   L_02270160: ; // 0x2270160
@@ -14307,8 +14307,8 @@ void Gambit_fn_0226FF14(CPUState* cpu) {
   L_02270164: ; // 0x2270164
         /* 02270164 */ _t105 = cpu->r[31] + 0x000000B0u;
         /* 02270164 */ cpu->r[7] = rbrew_read32(cpu->mem, _t105);
-        /* 02270168 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0227016C */ _t106 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270168 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0227016C */ _t106 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227016C */ _t107 = _t106 & 0x00000001u;
         /* 0227016C */ if (_t107) goto L_02270184; else goto L_02270170;
   L_02270170: ; // 0x2270170
@@ -14355,22 +14355,22 @@ void Gambit_fn_022701B4(CPUState* cpu) {
         /* 022701C8 */ _t3 = cpu->r[31] + 0x0000000Cu;
         /* 022701C8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 022701CC */ cpu->r[10] = rbrew_rlwinm(cpu->r[0], 0x0000001Eu, 0x0000001Fu, 0x0000001Fu);
-        /* 022701CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 022701D0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022701CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 022701D0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022701D0 */ _t5 = _t4 & 0x00000001u;
         /* 022701D0 */ if (_t5) goto L_022701D4; else goto L_02270234;
   L_022701D4: ; // 0x22701d4
         /* 022701D4 */ _t6 = cpu->r[31] + 0x00000050u;
         /* 022701D4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t6);
-        /* 022701D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000001u);
-        /* 022701DC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022701D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000001u));
+        /* 022701DC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022701DC */ _t8 = _t7 & 0x00000001u;
         /* 022701DC */ if (_t8) goto L_02270234; else goto L_022701E0;
   L_022701E0: ; // 0x22701e0
         /* 022701E0 */ _t9 = cpu->r[31] + 0x000000C8u;
         /* 022701E0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t9);
-        /* 022701E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022701E8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022701E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022701E8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022701E8 */ _t11 = _t10 & 0x00000001u;
         /* 022701E8 */ if (_t11) goto L_022701EC; else goto L_02270234;
   L_022701EC: ; // 0x22701ec
@@ -14379,17 +14379,17 @@ void Gambit_fn_022701B4(CPUState* cpu) {
         /* 022701F0 */ _t13 = cpu->r[31] + 0x00000070u;
         /* 022701F0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t13);
         /* 022701F4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Du);
-        /* 022701F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 022701F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 022701FC */ _t14 = cpu->r[31] + 0x0000009Cu;
         /* 022701FC */ rbrew_write32(cpu->mem, _t14, cpu->r[0]);
-        /* 02270200 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270200 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270200 */ _t16 = _t15 & 0x00000001u;
         /* 02270200 */ if (_t16) goto L_02270214; else goto L_02270204;
   L_02270204: ; // 0x2270204
         /* 02270204 */ _t17 = cpu->r[31] + 0x00000074u;
         /* 02270204 */ cpu->r[12] = rbrew_read8(cpu->mem, _t17);
-        /* 02270208 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0227020C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0227020C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227020C */ _t19 = _t18 & 0x00000001u;
         /* 0227020C */ if (_t19) goto L_02270214; else goto L_02270210;
   L_02270210: ; // 0x2270210
@@ -14397,8 +14397,8 @@ void Gambit_fn_022701B4(CPUState* cpu) {
   L_02270214: ; // 0x2270214
         /* 02270214 */ _t20 = cpu->r[31] + 0x00000060u;
         /* 02270214 */ cpu->r[3] = rbrew_read32(cpu->mem, _t20);
-        /* 02270218 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0227021C */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270218 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0227021C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227021C */ _t22 = _t21 & 0x00000001u;
         /* 0227021C */ if (_t22) goto L_0227022C; else goto L_02270220;
   L_02270220: ; // 0x2270220
@@ -14436,22 +14436,22 @@ void Gambit_fn_022701B8(CPUState* cpu) {
         /* 022701C8 */ _t3 = cpu->r[31] + 0x0000000Cu;
         /* 022701C8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
         /* 022701CC */ cpu->r[10] = rbrew_rlwinm(cpu->r[0], 0x0000001Eu, 0x0000001Fu, 0x0000001Fu);
-        /* 022701CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 022701D0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022701CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 022701D0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022701D0 */ _t5 = _t4 & 0x00000001u;
         /* 022701D0 */ if (_t5) goto L_022701D4; else goto L_02270234;
   L_022701D4: ; // 0x22701d4
         /* 022701D4 */ _t6 = cpu->r[31] + 0x00000050u;
         /* 022701D4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t6);
-        /* 022701D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000001u);
-        /* 022701DC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022701D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000001u));
+        /* 022701DC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022701DC */ _t8 = _t7 & 0x00000001u;
         /* 022701DC */ if (_t8) goto L_02270234; else goto L_022701E0;
   L_022701E0: ; // 0x22701e0
         /* 022701E0 */ _t9 = cpu->r[31] + 0x000000C8u;
         /* 022701E0 */ cpu->r[0] = rbrew_read8(cpu->mem, _t9);
-        /* 022701E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022701E8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022701E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022701E8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022701E8 */ _t11 = _t10 & 0x00000001u;
         /* 022701E8 */ if (_t11) goto L_022701EC; else goto L_02270234;
   L_022701EC: ; // 0x22701ec
@@ -14460,17 +14460,17 @@ void Gambit_fn_022701B8(CPUState* cpu) {
         /* 022701F0 */ _t13 = cpu->r[31] + 0x00000070u;
         /* 022701F0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t13);
         /* 022701F4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Du);
-        /* 022701F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 022701F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 022701FC */ _t14 = cpu->r[31] + 0x0000009Cu;
         /* 022701FC */ rbrew_write32(cpu->mem, _t14, cpu->r[0]);
-        /* 02270200 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270200 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270200 */ _t16 = _t15 & 0x00000001u;
         /* 02270200 */ if (_t16) goto L_02270214; else goto L_02270204;
   L_02270204: ; // 0x2270204
         /* 02270204 */ _t17 = cpu->r[31] + 0x00000074u;
         /* 02270204 */ cpu->r[12] = rbrew_read8(cpu->mem, _t17);
-        /* 02270208 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0227020C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0227020C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227020C */ _t19 = _t18 & 0x00000001u;
         /* 0227020C */ if (_t19) goto L_02270214; else goto L_02270210;
   L_02270210: ; // 0x2270210
@@ -14478,8 +14478,8 @@ void Gambit_fn_022701B8(CPUState* cpu) {
   L_02270214: ; // 0x2270214
         /* 02270214 */ _t20 = cpu->r[31] + 0x00000060u;
         /* 02270214 */ cpu->r[3] = rbrew_read32(cpu->mem, _t20);
-        /* 02270218 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0227021C */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270218 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0227021C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227021C */ _t22 = _t21 & 0x00000001u;
         /* 0227021C */ if (_t22) goto L_0227022C; else goto L_02270220;
   L_02270220: ; // 0x2270220
@@ -14508,8 +14508,8 @@ void Gambit_fn_02270248(CPUState* cpu) {
   L_02270248: ; // 0x2270248
         /* 02270248 */ _t0 = cpu->r[3] + 0x00000094u;
         /* 02270248 */ cpu->r[3] = rbrew_read32(cpu->mem, _t0);
-        /* 0227024C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270250 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227024C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270250 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270250 */ _t2 = _t1 & 0x00000001u;
         /* 02270250 */ if (_t2) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02270250 */ goto L_02270254;
@@ -14531,8 +14531,8 @@ void Gambit_fn_02270248(CPUState* cpu) {
         /* 023985B4 */ cpu->r[29] = cpu->r[3];
         /* 023985B8 */ _t8 = cpu->r[29] + 0x00000004u;
         /* 023985B8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t8);
-        /* 023985BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 023985C0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 023985BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 023985C0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 023985C0 */ _t10 = _t9 & 0x00000001u;
         /* 023985C0 */ if (_t10) goto L_023985E8; else goto L_023985C4;
   L_023985C4: ; // 0x23985c4
@@ -14541,14 +14541,14 @@ void Gambit_fn_02270248(CPUState* cpu) {
         /* 023985C8 */ _t12 = cpu->r[8] + 0x00000000u;
         /* 023985C8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
         /* 023985CC */ /* nop */
-        /* 023985D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0xFFFFFFFFu);
-        /* 023985D4 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 023985D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0xFFFFFFFFu));
+        /* 023985D4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 023985D4 */ _t14 = _t13 & 0x00000001u;
         /* 023985D4 */ if (_t14) goto L_023985E8; else goto L_023985D8;
   L_023985D8: ; // 0x23985d8
         /* 023985D8 */ /* nop */
-        /* 023985DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 023985E0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 023985DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 023985E0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 023985E0 */ _t16 = _t15 & 0x00000001u;
         /* 023985E0 */ if (_t16) goto L_023985E8; else goto L_023985E4;
   L_023985E4: ; // 0x23985e4
@@ -14556,8 +14556,8 @@ void Gambit_fn_02270248(CPUState* cpu) {
   L_023985E8: ; // 0x23985e8
         /* 023985E8 */ _t17 = cpu->r[29] + 0x00000008u;
         /* 023985E8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t17);
-        /* 023985EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 023985F0 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 023985EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 023985F0 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 023985F0 */ _t19 = _t18 & 0x00000001u;
         /* 023985F0 */ if (_t19) goto L_02398638; else goto L_023985F4;
   L_023985F4: ; // 0x23985f4
@@ -14565,8 +14565,8 @@ void Gambit_fn_02270248(CPUState* cpu) {
         /* 023985F4 */ cpu->r[30] = rbrew_read32(cpu->mem, _t20);
         /* 023985F8 */ cpu->r[10] = rbrew_rlwinm(cpu->r[0], 0x00000002u, 0x00000000u, 0x0000001Du);
         /* 023985FC */ cpu->r[31] = cpu->r[30] + cpu->r[10];
-        /* 02398600 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[31]);
-        /* 02398604 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02398600 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[31]));
+        /* 02398604 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02398604 */ _t22 = _t21 & 0x00000001u;
         /* 02398604 */ if (_t22) goto L_02398638; else goto L_02398608;
   L_02398608: ; // 0x2398608
@@ -14575,30 +14575,30 @@ void Gambit_fn_02270248(CPUState* cpu) {
         /* 0239860C */ cpu->r[12] = cpu->r[3];
         /* 02398610 */ _t24 = cpu->r[12] + 0x00000000u;
         /* 02398610 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t24);
-        /* 02398614 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0xFFFFFFFFu);
-        /* 02398618 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02398614 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0xFFFFFFFFu));
+        /* 02398618 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02398618 */ _t26 = _t25 & 0x00000001u;
         /* 02398618 */ if (_t26) goto L_0239862C; else goto L_0239861C;
   L_0239861C: ; // 0x239861c
         /* 0239861C */ _t27 = cpu->r[12] + 0x00000002u;
         /* 0239861C */ cpu->r[12] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t27);
-        /* 02398620 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
-        /* 02398624 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02398620 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
+        /* 02398624 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02398624 */ _t29 = _t28 & 0x00000001u;
         /* 02398624 */ if (_t29) goto L_0239862C; else goto L_02398628;
   L_02398628: ; // 0x2398628
         /* 02398628 */ Gambit_fn_027C61D0(cpu);
   L_0239862C: ; // 0x239862c
         /* 0239862C */ cpu->r[30] = cpu->r[30] + 0x00000004u;
-        /* 02398630 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], cpu->r[31]);
-        /* 02398634 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02398630 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], cpu->r[31]));
+        /* 02398634 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02398634 */ _t31 = _t30 & 0x00000001u;
         /* 02398634 */ if (_t31) goto L_02398638; else goto L_02398608;
   L_02398638: ; // 0x2398638
         /* 02398638 */ _t32 = cpu->r[29] + 0x00000024u;
         /* 02398638 */ cpu->r[3] = rbrew_read32(cpu->mem, _t32);
-        /* 0239863C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02398640 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0239863C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02398640 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02398640 */ _t34 = _t33 & 0x00000001u;
         /* 02398640 */ if (_t34) goto L_02398648; else goto L_02398644;
   L_02398644: ; // 0x2398644
@@ -14636,15 +14636,15 @@ void Gambit_fn_02270258(CPUState* cpu) {
         /* 02270270 */ _t4 = cpu->r[31] + 0x0000000Cu;
         /* 02270270 */ cpu->r[11] = rbrew_read32(cpu->mem, _t4);
         /* 02270274 */ cpu->r[0] = rbrew_rlwinm(cpu->r[11], 0x0000001Cu, 0x0000001Fu, 0x0000001Fu);
-        /* 02270274 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02270278 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270274 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02270278 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270278 */ _t6 = _t5 & 0x00000001u;
         /* 02270278 */ if (_t6) goto L_0227027C; else goto L_02270498;
   L_0227027C: ; // 0x227027c
         /* 0227027C */ _t7 = cpu->r[31] + 0x00000050u;
         /* 0227027C */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 02270280 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000001u);
-        /* 02270284 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270280 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000001u));
+        /* 02270284 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270284 */ _t9 = _t8 & 0x00000001u;
         /* 02270284 */ if (_t9) goto L_02270288; else goto L_0227033C;
   L_02270288: ; // 0x2270288
@@ -14729,8 +14729,8 @@ void Gambit_fn_02270258(CPUState* cpu) {
   L_0227033C: ; // 0x227033c
         /* 0227033C */ _t43 = cpu->r[31] + 0x000000C8u;
         /* 0227033C */ cpu->r[0] = rbrew_read8(cpu->mem, _t43);
-        /* 02270340 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02270344 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270340 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02270344 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270344 */ _t45 = _t44 & 0x00000001u;
         /* 02270344 */ if (_t45) goto L_02270394; else goto L_02270348;
   L_02270348: ; // 0x2270348
@@ -14744,8 +14744,8 @@ void Gambit_fn_02270258(CPUState* cpu) {
         /* 02270358 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0227035C */ _t49 = cpu->r[31] + 0x000000D4u;
         /* 0227035C */ cpu->r[0] = rbrew_read32(cpu->mem, _t49);
-        /* 02270360 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02270364 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270360 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02270364 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270364 */ _t51 = _t50 & 0x00000001u;
         /* 02270364 */ if (_t51) goto L_02270498; else goto L_02270368;
   L_02270368: ; // 0x2270368
@@ -14775,15 +14775,15 @@ void Gambit_fn_02270258(CPUState* cpu) {
         /* 022703A4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 022703A8 */ _t59 = cpu->r[31] + 0x00000070u;
         /* 022703A8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t59);
-        /* 022703AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022703B0 */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022703AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022703B0 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022703B0 */ _t61 = _t60 & 0x00000001u;
         /* 022703B0 */ if (_t61) goto L_022703C4; else goto L_022703B4;
   L_022703B4: ; // 0x22703b4
         /* 022703B4 */ _t62 = cpu->r[31] + 0x00000074u;
         /* 022703B4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t62);
-        /* 022703B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022703BC */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022703B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022703BC */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022703BC */ _t64 = _t63 & 0x00000001u;
         /* 022703BC */ if (_t64) goto L_022703C4; else goto L_022703C0;
   L_022703C0: ; // 0x22703c0
@@ -14800,8 +14800,8 @@ void Gambit_fn_02270258(CPUState* cpu) {
         /* 022703DC */ Gambit_fn_02270248(cpu);
         /* 022703E0 */ _t67 = cpu->r[31] + 0x00000098u;
         /* 022703E0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t67);
-        /* 022703E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022703E8 */ _t68 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022703E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022703E8 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022703E8 */ _t69 = _t68 & 0x00000001u;
         /* 022703E8 */ if (_t69) goto L_022703FC; else goto L_022703EC;
   L_022703EC: ; // 0x22703ec
@@ -14816,8 +14816,8 @@ void Gambit_fn_02270258(CPUState* cpu) {
         /* 02270400 */ Gambit_fn_02000658(cpu);
         /* 02270404 */ _t72 = cpu->r[31] + 0x000000D4u;
         /* 02270404 */ cpu->r[0] = rbrew_read32(cpu->mem, _t72);
-        /* 02270408 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0227040C */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270408 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0227040C */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227040C */ _t74 = _t73 & 0x00000001u;
         /* 0227040C */ if (_t74) goto L_02270424; else goto L_02270410;
   L_02270410: ; // 0x2270410
@@ -14914,15 +14914,15 @@ void Gambit_fn_0227025C(CPUState* cpu) {
         /* 02270270 */ _t4 = cpu->r[31] + 0x0000000Cu;
         /* 02270270 */ cpu->r[11] = rbrew_read32(cpu->mem, _t4);
         /* 02270274 */ cpu->r[0] = rbrew_rlwinm(cpu->r[11], 0x0000001Cu, 0x0000001Fu, 0x0000001Fu);
-        /* 02270274 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02270278 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270274 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02270278 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270278 */ _t6 = _t5 & 0x00000001u;
         /* 02270278 */ if (_t6) goto L_0227027C; else goto L_02270498;
   L_0227027C: ; // 0x227027c
         /* 0227027C */ _t7 = cpu->r[31] + 0x00000050u;
         /* 0227027C */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 02270280 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000001u);
-        /* 02270284 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270280 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000001u));
+        /* 02270284 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270284 */ _t9 = _t8 & 0x00000001u;
         /* 02270284 */ if (_t9) goto L_02270288; else goto L_0227033C;
   L_02270288: ; // 0x2270288
@@ -15007,8 +15007,8 @@ void Gambit_fn_0227025C(CPUState* cpu) {
   L_0227033C: ; // 0x227033c
         /* 0227033C */ _t43 = cpu->r[31] + 0x000000C8u;
         /* 0227033C */ cpu->r[0] = rbrew_read8(cpu->mem, _t43);
-        /* 02270340 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02270344 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270340 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02270344 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270344 */ _t45 = _t44 & 0x00000001u;
         /* 02270344 */ if (_t45) goto L_02270394; else goto L_02270348;
   L_02270348: ; // 0x2270348
@@ -15022,8 +15022,8 @@ void Gambit_fn_0227025C(CPUState* cpu) {
         /* 02270358 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0227035C */ _t49 = cpu->r[31] + 0x000000D4u;
         /* 0227035C */ cpu->r[0] = rbrew_read32(cpu->mem, _t49);
-        /* 02270360 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02270364 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270360 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02270364 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270364 */ _t51 = _t50 & 0x00000001u;
         /* 02270364 */ if (_t51) goto L_02270498; else goto L_02270368;
   L_02270368: ; // 0x2270368
@@ -15053,15 +15053,15 @@ void Gambit_fn_0227025C(CPUState* cpu) {
         /* 022703A4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 022703A8 */ _t59 = cpu->r[31] + 0x00000070u;
         /* 022703A8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t59);
-        /* 022703AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022703B0 */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022703AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022703B0 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022703B0 */ _t61 = _t60 & 0x00000001u;
         /* 022703B0 */ if (_t61) goto L_022703C4; else goto L_022703B4;
   L_022703B4: ; // 0x22703b4
         /* 022703B4 */ _t62 = cpu->r[31] + 0x00000074u;
         /* 022703B4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t62);
-        /* 022703B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022703BC */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022703B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022703BC */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022703BC */ _t64 = _t63 & 0x00000001u;
         /* 022703BC */ if (_t64) goto L_022703C4; else goto L_022703C0;
   L_022703C0: ; // 0x22703c0
@@ -15078,8 +15078,8 @@ void Gambit_fn_0227025C(CPUState* cpu) {
         /* 022703DC */ Gambit_fn_02270248(cpu);
         /* 022703E0 */ _t67 = cpu->r[31] + 0x00000098u;
         /* 022703E0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t67);
-        /* 022703E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022703E8 */ _t68 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022703E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022703E8 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022703E8 */ _t69 = _t68 & 0x00000001u;
         /* 022703E8 */ if (_t69) goto L_022703FC; else goto L_022703EC;
   L_022703EC: ; // 0x22703ec
@@ -15094,8 +15094,8 @@ void Gambit_fn_0227025C(CPUState* cpu) {
         /* 02270400 */ Gambit_fn_02000658(cpu);
         /* 02270404 */ _t72 = cpu->r[31] + 0x000000D4u;
         /* 02270404 */ cpu->r[0] = rbrew_read32(cpu->mem, _t72);
-        /* 02270408 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0227040C */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270408 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0227040C */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227040C */ _t74 = _t73 & 0x00000001u;
         /* 0227040C */ if (_t74) goto L_02270424; else goto L_02270410;
   L_02270410: ; // 0x2270410
@@ -15190,8 +15190,8 @@ void Gambit_fn_022704B0(CPUState* cpu) {
         /* 022704C0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 022704C4 */ _t3 = cpu->r[31] + 0x000000D0u;
         /* 022704C4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 022704C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022704CC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022704C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022704CC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022704CC */ _t5 = _t4 & 0x00000001u;
         /* 022704CC */ if (_t5) goto L_022704D0; else goto L_0227050C;
   L_022704D0: ; // 0x22704d0
@@ -15199,15 +15199,15 @@ void Gambit_fn_022704B0(CPUState* cpu) {
         /* 022704D4 */ Gambit_fn_02270258(cpu);
         /* 022704D8 */ _t6 = cpu->r[31] + 0x000000BCu;
         /* 022704D8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t6);
-        /* 022704DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022704E0 */ _t7 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022704DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022704E0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022704E0 */ _t8 = _t7 & 0x00000001u;
         /* 022704E0 */ if (_t8) goto L_022704E4; else goto L_0227050C;
   L_022704E4: ; // 0x22704e4
         /* 022704E4 */ _t9 = cpu->r[31] + 0x000000B4u;
         /* 022704E4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t9);
-        /* 022704E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022704EC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022704E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022704EC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022704EC */ _t11 = _t10 & 0x00000001u;
         /* 022704EC */ if (_t11) goto L_022704F8; else goto L_022704F0;
   L_022704F0: ; // 0x22704f0
@@ -15217,8 +15217,8 @@ void Gambit_fn_022704B0(CPUState* cpu) {
   L_022704F8: ; // 0x22704f8
         /* 022704F8 */ _t13 = cpu->r[31] + 0x000000D8u;
         /* 022704F8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t13);
-        /* 022704FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270500 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022704FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270500 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270500 */ _t15 = _t14 & 0x00000001u;
         /* 02270500 */ if (_t15) goto L_0227050C; else goto L_02270504;
   L_02270504: ; // 0x2270504
@@ -15250,8 +15250,8 @@ void Gambit_fn_022704B4(CPUState* cpu) {
         /* 022704C0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 022704C4 */ _t3 = cpu->r[31] + 0x000000D0u;
         /* 022704C4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 022704C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022704CC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022704C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022704CC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022704CC */ _t5 = _t4 & 0x00000001u;
         /* 022704CC */ if (_t5) goto L_022704D0; else goto L_0227050C;
   L_022704D0: ; // 0x22704d0
@@ -15259,15 +15259,15 @@ void Gambit_fn_022704B4(CPUState* cpu) {
         /* 022704D4 */ Gambit_fn_02270258(cpu);
         /* 022704D8 */ _t6 = cpu->r[31] + 0x000000BCu;
         /* 022704D8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t6);
-        /* 022704DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022704E0 */ _t7 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022704DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022704E0 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022704E0 */ _t8 = _t7 & 0x00000001u;
         /* 022704E0 */ if (_t8) goto L_022704E4; else goto L_0227050C;
   L_022704E4: ; // 0x22704e4
         /* 022704E4 */ _t9 = cpu->r[31] + 0x000000B4u;
         /* 022704E4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t9);
-        /* 022704E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022704EC */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022704E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022704EC */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022704EC */ _t11 = _t10 & 0x00000001u;
         /* 022704EC */ if (_t11) goto L_022704F8; else goto L_022704F0;
   L_022704F0: ; // 0x22704f0
@@ -15277,8 +15277,8 @@ void Gambit_fn_022704B4(CPUState* cpu) {
   L_022704F8: ; // 0x22704f8
         /* 022704F8 */ _t13 = cpu->r[31] + 0x000000D8u;
         /* 022704F8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t13);
-        /* 022704FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270500 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022704FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270500 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270500 */ _t15 = _t14 & 0x00000001u;
         /* 02270500 */ if (_t15) goto L_0227050C; else goto L_02270504;
   L_02270504: ; // 0x2270504
@@ -15315,15 +15315,15 @@ void Gambit_fn_02270520(CPUState* cpu) {
         /* 0227053C */ Gambit_fn_020007C0(cpu);
         /* 02270540 */ _t4 = cpu->r[30] + 0x00000070u;
         /* 02270540 */ cpu->r[3] = rbrew_read32(cpu->mem, _t4);
-        /* 02270544 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270548 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270544 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270548 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270548 */ _t6 = _t5 & 0x00000001u;
         /* 02270548 */ if (_t6) goto L_02270560; else goto L_0227054C;
   L_0227054C: ; // 0x227054c
         /* 0227054C */ _t7 = cpu->r[30] + 0x00000074u;
         /* 0227054C */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
-        /* 02270550 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02270554 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270550 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02270554 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270554 */ _t9 = _t8 & 0x00000001u;
         /* 02270554 */ if (_t9) goto L_02270560; else goto L_02270558;
   L_02270558: ; // 0x2270558
@@ -15360,15 +15360,15 @@ void Gambit_fn_02270524(CPUState* cpu) {
         /* 0227053C */ Gambit_fn_020007C0(cpu);
         /* 02270540 */ _t4 = cpu->r[30] + 0x00000070u;
         /* 02270540 */ cpu->r[3] = rbrew_read32(cpu->mem, _t4);
-        /* 02270544 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270548 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270544 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270548 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270548 */ _t6 = _t5 & 0x00000001u;
         /* 02270548 */ if (_t6) goto L_02270560; else goto L_0227054C;
   L_0227054C: ; // 0x227054c
         /* 0227054C */ _t7 = cpu->r[30] + 0x00000074u;
         /* 0227054C */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
-        /* 02270550 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02270554 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270550 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02270554 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270554 */ _t9 = _t8 & 0x00000001u;
         /* 02270554 */ if (_t9) goto L_02270560; else goto L_02270558;
   L_02270558: ; // 0x2270558
@@ -15410,8 +15410,8 @@ void Gambit_fn_02270578(CPUState* cpu) {
         /* 02000154 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02000158 */ _t6 = cpu->r[31] + 0x0000003Au;
         /* 02000158 */ cpu->r[11] = rbrew_read8(cpu->mem, _t6);
-        /* 0200015C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02000160 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0200015C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02000160 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02000160 */ _t8 = _t7 & 0x00000001u;
         /* 02000160 */ if (_t8) goto L_02000188; else goto L_02000164;
   L_02000164: ; // 0x2000164
@@ -15465,8 +15465,8 @@ void Gambit_fn_0227057C(CPUState* cpu) {
         /* 022705A0 */ Gambit_fn_0200084C(cpu);
         /* 022705A4 */ _t6 = cpu->r[28] + 0x000000A4u;
         /* 022705A4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t6);
-        /* 022705A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022705AC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022705A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022705AC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022705AC */ _t8 = _t7 & 0x00000001u;
         /* 022705AC */ if (_t8) goto L_022705B8; else goto L_022705B0;
   L_022705B0: ; // 0x22705b0
@@ -15475,15 +15475,15 @@ void Gambit_fn_0227057C(CPUState* cpu) {
   L_022705B8: ; // 0x22705b8
         /* 022705B8 */ _t9 = cpu->r[28] + 0x000000A8u;
         /* 022705B8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 022705BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022705C0 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022705BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022705C0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022705C0 */ _t11 = _t10 & 0x00000001u;
         /* 022705C0 */ if (_t11) goto L_0227061C; else goto L_022705C4;
   L_022705C4: ; // 0x22705c4
         /* 022705C4 */ _t12 = cpu->r[28] + 0x00000008u;
         /* 022705C4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 022705C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[0]);
-        /* 022705CC */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022705C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[0]));
+        /* 022705CC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022705CC */ _t14 = _t13 & 0x00000001u;
         /* 022705CC */ if (_t14) goto L_022705D0; else goto L_0227061C;
   L_022705D0: ; // 0x22705d0
@@ -15555,8 +15555,8 @@ void Gambit_fn_02270580(CPUState* cpu) {
         /* 022705A0 */ Gambit_fn_0200084C(cpu);
         /* 022705A4 */ _t6 = cpu->r[28] + 0x000000A4u;
         /* 022705A4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t6);
-        /* 022705A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022705AC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022705A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022705AC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022705AC */ _t8 = _t7 & 0x00000001u;
         /* 022705AC */ if (_t8) goto L_022705B8; else goto L_022705B0;
   L_022705B0: ; // 0x22705b0
@@ -15565,15 +15565,15 @@ void Gambit_fn_02270580(CPUState* cpu) {
   L_022705B8: ; // 0x22705b8
         /* 022705B8 */ _t9 = cpu->r[28] + 0x000000A8u;
         /* 022705B8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 022705BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022705C0 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022705BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022705C0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022705C0 */ _t11 = _t10 & 0x00000001u;
         /* 022705C0 */ if (_t11) goto L_0227061C; else goto L_022705C4;
   L_022705C4: ; // 0x22705c4
         /* 022705C4 */ _t12 = cpu->r[28] + 0x00000008u;
         /* 022705C4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t12);
-        /* 022705C8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[0]);
-        /* 022705CC */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022705C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[0]));
+        /* 022705CC */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022705CC */ _t14 = _t13 & 0x00000001u;
         /* 022705CC */ if (_t14) goto L_022705D0; else goto L_0227061C;
   L_022705D0: ; // 0x22705d0
@@ -15632,14 +15632,14 @@ void Gambit_fn_0227063C(CPUState* cpu) {
         /* 02270640 */ cpu->r[11] = 0x00000001u;
         /* 02270644 */ _t1 = cpu->r[3] + 0x0000003Au;
         /* 02270644 */ rbrew_write8(cpu->mem, _t1, (uint8_t)cpu->r[11]);
-        /* 02270648 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02270648 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0227064C */ _t2 = cpu->r[3] + 0x00000059u;
         /* 0227064C */ rbrew_write8(cpu->mem, _t2, (uint8_t)cpu->r[11]);
         /* 02270650 */ _t3 = cpu->r[3] + 0x00000050u;
         /* 02270650 */ rbrew_write32(cpu->mem, _t3, cpu->r[11]);
         /* 02270654 */ _t4 = cpu->r[3] + 0x00000050u;
         /* 02270654 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
-        /* 02270658 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270658 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270658 */ _t6 = _t5 & 0x00000001u;
         /* 02270658 */ if (_t6) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02270658 */ goto L_0227065C;
@@ -15679,15 +15679,15 @@ void Gambit_fn_02270668(CPUState* cpu) {
         /* 02270698 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0227069C */ _t8 = cpu->r[30] + 0x00000008u;
         /* 0227069C */ cpu->r[12] = rbrew_read32(cpu->mem, _t8);
-        /* 022706A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022706A4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022706A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022706A4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022706A4 */ _t10 = _t9 & 0x00000001u;
         /* 022706A4 */ if (_t10) goto L_022706C8; else goto L_022706A8;
   L_022706A8: ; // 0x22706a8
         /* 022706A8 */ _t11 = cpu->r[12] + 0x000000A4u;
         /* 022706A8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t11);
-        /* 022706AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 022706B0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022706AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 022706B0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022706B0 */ _t13 = _t12 & 0x00000001u;
         /* 022706B0 */ if (_t13) goto L_022706C8; else goto L_022706B4;
   L_022706B4: ; // 0x22706b4
@@ -15719,10 +15719,10 @@ void Gambit_fn_02270668(CPUState* cpu) {
         /* 022706F4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 022706F8 */ _t22 = cpu->r[30] + 0x0000005Cu;
         /* 022706F8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t22);
-        /* 022706FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 022706FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02270700 */ _t23 = cpu->r[30] + 0x00000058u;
         /* 02270700 */ rbrew_write8(cpu->mem, _t23, (uint8_t)cpu->r[31]);
-        /* 02270704 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270704 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270704 */ _t25 = _t24 & 0x00000001u;
         /* 02270704 */ if (_t25) goto L_02270754; else goto L_02270708;
   L_02270708: ; // 0x2270708
@@ -15733,15 +15733,15 @@ void Gambit_fn_02270668(CPUState* cpu) {
         /* 02270710 */ cpu->ctr = cpu->r[0];
         /* 02270714 */ cpu->r[3] = cpu->r[30];
         /* 02270718 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0227071C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270720 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227071C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270720 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270720 */ _t29 = _t28 & 0x00000001u;
         /* 02270720 */ if (_t29) goto L_02270730; else goto L_02270724;
   L_02270724: ; // 0x2270724
         /* 02270724 */ _t30 = cpu->r[30] + 0x00000058u;
         /* 02270724 */ cpu->r[0] = rbrew_read8(cpu->mem, _t30);
-        /* 02270728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0227072C */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0227072C */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227072C */ _t32 = _t31 & 0x00000001u;
         /* 0227072C */ if (_t32) goto L_02270754; else goto L_02270730;
   L_02270730: ; // 0x2270730
@@ -15753,8 +15753,8 @@ void Gambit_fn_02270668(CPUState* cpu) {
         /* 0227073C */ _t35 = cpu->r[12] + 0x0000026Cu;
         /* 0227073C */ cpu->r[3] = rbrew_read32(cpu->mem, _t35);
         /* 02270740 */ Gambit_fn_022DABA8(cpu);
-        /* 02270744 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270748 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270744 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270748 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270748 */ _t37 = _t36 & 0x00000001u;
         /* 02270748 */ if (_t37) goto L_0227074C; else goto L_02270754;
   L_0227074C: ; // 0x227074c
@@ -15800,15 +15800,15 @@ void Gambit_fn_0227066C(CPUState* cpu) {
         /* 02270698 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0227069C */ _t8 = cpu->r[30] + 0x00000008u;
         /* 0227069C */ cpu->r[12] = rbrew_read32(cpu->mem, _t8);
-        /* 022706A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022706A4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022706A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022706A4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022706A4 */ _t10 = _t9 & 0x00000001u;
         /* 022706A4 */ if (_t10) goto L_022706C8; else goto L_022706A8;
   L_022706A8: ; // 0x22706a8
         /* 022706A8 */ _t11 = cpu->r[12] + 0x000000A4u;
         /* 022706A8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t11);
-        /* 022706AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 022706B0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022706AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 022706B0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022706B0 */ _t13 = _t12 & 0x00000001u;
         /* 022706B0 */ if (_t13) goto L_022706C8; else goto L_022706B4;
   L_022706B4: ; // 0x22706b4
@@ -15840,10 +15840,10 @@ void Gambit_fn_0227066C(CPUState* cpu) {
         /* 022706F4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 022706F8 */ _t22 = cpu->r[30] + 0x0000005Cu;
         /* 022706F8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t22);
-        /* 022706FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 022706FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02270700 */ _t23 = cpu->r[30] + 0x00000058u;
         /* 02270700 */ rbrew_write8(cpu->mem, _t23, (uint8_t)cpu->r[31]);
-        /* 02270704 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270704 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270704 */ _t25 = _t24 & 0x00000001u;
         /* 02270704 */ if (_t25) goto L_02270754; else goto L_02270708;
   L_02270708: ; // 0x2270708
@@ -15854,15 +15854,15 @@ void Gambit_fn_0227066C(CPUState* cpu) {
         /* 02270710 */ cpu->ctr = cpu->r[0];
         /* 02270714 */ cpu->r[3] = cpu->r[30];
         /* 02270718 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0227071C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270720 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227071C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270720 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270720 */ _t29 = _t28 & 0x00000001u;
         /* 02270720 */ if (_t29) goto L_02270730; else goto L_02270724;
   L_02270724: ; // 0x2270724
         /* 02270724 */ _t30 = cpu->r[30] + 0x00000058u;
         /* 02270724 */ cpu->r[0] = rbrew_read8(cpu->mem, _t30);
-        /* 02270728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0227072C */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0227072C */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227072C */ _t32 = _t31 & 0x00000001u;
         /* 0227072C */ if (_t32) goto L_02270754; else goto L_02270730;
   L_02270730: ; // 0x2270730
@@ -15874,8 +15874,8 @@ void Gambit_fn_0227066C(CPUState* cpu) {
         /* 0227073C */ _t35 = cpu->r[12] + 0x0000026Cu;
         /* 0227073C */ cpu->r[3] = rbrew_read32(cpu->mem, _t35);
         /* 02270740 */ Gambit_fn_022DABA8(cpu);
-        /* 02270744 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270748 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270744 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270748 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270748 */ _t37 = _t36 & 0x00000001u;
         /* 02270748 */ if (_t37) goto L_0227074C; else goto L_02270754;
   L_0227074C: ; // 0x227074c
@@ -15923,20 +15923,20 @@ void Gambit_fn_02270780(CPUState* cpu) {
         /* 02270794 */ Gambit_fn_0200086C(cpu);
         /* 02270798 */ _t3 = cpu->r[31] + 0x00000059u;
         /* 02270798 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 0227079C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022707A0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227079C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022707A0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022707A0 */ _t5 = _t4 & 0x00000001u;
         /* 022707A0 */ if (_t5) goto L_022707C4; else goto L_022707A4;
   L_022707A4: ; // 0x22707a4
         /* 022707A4 */ _t6 = cpu->r[31] + 0x0000001Cu;
         /* 022707A4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 022707A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 022707AC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022707A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 022707AC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022707AC */ _t8 = _t7 & 0x00000001u;
         /* 022707AC */ if (_t8) goto L_022707B8; else goto L_022707B0;
   L_022707B0: ; // 0x22707b0
-        /* 022707B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 022707B4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022707B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 022707B4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022707B4 */ _t10 = _t9 & 0x00000001u;
         /* 022707B4 */ if (_t10) goto L_022707B8; else goto L_022707C4;
   L_022707B8: ; // 0x22707b8
@@ -15974,20 +15974,20 @@ void Gambit_fn_02270784(CPUState* cpu) {
         /* 02270794 */ Gambit_fn_0200086C(cpu);
         /* 02270798 */ _t3 = cpu->r[31] + 0x00000059u;
         /* 02270798 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 0227079C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022707A0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227079C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022707A0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022707A0 */ _t5 = _t4 & 0x00000001u;
         /* 022707A0 */ if (_t5) goto L_022707C4; else goto L_022707A4;
   L_022707A4: ; // 0x22707a4
         /* 022707A4 */ _t6 = cpu->r[31] + 0x0000001Cu;
         /* 022707A4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 022707A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 022707AC */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022707A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 022707AC */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022707AC */ _t8 = _t7 & 0x00000001u;
         /* 022707AC */ if (_t8) goto L_022707B8; else goto L_022707B0;
   L_022707B0: ; // 0x22707b0
-        /* 022707B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 022707B4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022707B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 022707B4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022707B4 */ _t10 = _t9 & 0x00000001u;
         /* 022707B4 */ if (_t10) goto L_022707B8; else goto L_022707C4;
   L_022707B8: ; // 0x22707b8
@@ -16024,22 +16024,22 @@ void Gambit_fn_022707E0(CPUState* cpu) {
         /* 022707F0 */ cpu->r[29] = cpu->r[3];
         /* 022707F4 */ _t2 = cpu->r[29] + 0x0000001Cu;
         /* 022707F4 */ cpu->r[8] = rbrew_read32(cpu->mem, _t2);
-        /* 022707F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000002u);
+        /* 022707F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000002u));
         /* 022707FC */ cpu->r[28] = cpu->r[5];
-        /* 02270800 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270800 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270800 */ _t4 = _t3 & 0x00000001u;
         /* 02270800 */ if (_t4) goto L_0227098C; else goto L_02270804;
   L_02270804: ; // 0x2270804
-        /* 02270804 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000003u);
-        /* 02270808 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270804 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000003u));
+        /* 02270808 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270808 */ _t6 = _t5 & 0x00000001u;
         /* 02270808 */ if (_t6) goto L_0227098C; else goto L_0227080C;
   L_0227080C: ; // 0x227080c
         /* 0227080C */ _t7 = cpu->r[29] + 0x0000009Cu;
         /* 0227080C */ cpu->r[11] = rbrew_read32(cpu->mem, _t7);
         /* 02270810 */ cpu->r[12] = rbrew_rlwinm(cpu->r[11], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02270810 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02270814 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270810 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02270814 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270814 */ _t9 = _t8 & 0x00000001u;
         /* 02270814 */ if (_t9) goto L_02270818; else goto L_0227098C;
   L_02270818: ; // 0x2270818
@@ -16052,8 +16052,8 @@ void Gambit_fn_022707E0(CPUState* cpu) {
         /* 02270828 */ Gambit_fn_027912FC(cpu);
         /* 0227082C */ _t12 = cpu->r[28] + 0x00000000u;
         /* 0227082C */ cpu->r[31] = rbrew_read32(cpu->mem, _t12);
-        /* 02270830 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02270834 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270830 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02270834 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270834 */ _t14 = _t13 & 0x00000001u;
         /* 02270834 */ if (_t14) goto L_02270984; else goto L_02270838;
   L_02270838: ; // 0x2270838
@@ -16061,9 +16061,9 @@ void Gambit_fn_022707E0(CPUState* cpu) {
         /* 0227083C */ _t15 = cpu->r[11] + 0xFFFFEB28u;
         /* 0227083C */ cpu->r[11] = rbrew_read32(cpu->mem, _t15);
         /* 02270840 */ cpu->r[4] = 0x101D0000u;
-        /* 02270844 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02270844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02270848 */ cpu->r[4] = cpu->r[4] + 0x00000074u;
-        /* 0227084C */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227084C */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227084C */ _t17 = _t16 & 0x00000001u;
         /* 0227084C */ if (_t17) goto L_02270850; else goto L_02270868;
   L_02270850: ; // 0x2270850
@@ -16083,13 +16083,13 @@ void Gambit_fn_022707E0(CPUState* cpu) {
         /* 02270870 */ cpu->ctr = cpu->r[0];
         /* 02270874 */ cpu->r[3] = cpu->r[31];
         /* 02270878 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0227087C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270880 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227087C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270880 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270880 */ _t23 = _t22 & 0x00000001u;
         /* 02270880 */ if (_t23) goto L_02270984; else goto L_02270884;
   L_02270884: ; // 0x2270884
-        /* 02270884 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02270888 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270884 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02270888 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270888 */ _t25 = _t24 & 0x00000001u;
         /* 02270888 */ if (_t25) goto L_02270984; else goto L_0227088C;
   L_0227088C: ; // 0x227088c
@@ -16100,10 +16100,10 @@ void Gambit_fn_022707E0(CPUState* cpu) {
         /* 02270898 */ cpu->r[4] = 0x101D0000u;
         /* 0227089C */ cpu->r[27] = cpu->r[27] + 0xFFFF8FB8u;
         /* 022708A0 */ cpu->r[4] = cpu->r[4] + 0xFFFFFBC4u;
-        /* 022708A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 022708A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 022708A8 */ _t27 = cpu->r[28] + 0x00000000u;
         /* 022708A8 */ cpu->r[30] = rbrew_read32(cpu->mem, _t27);
-        /* 022708AC */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022708AC */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022708AC */ _t29 = _t28 & 0x00000001u;
         /* 022708AC */ if (_t29) goto L_022708B0; else goto L_022708C0;
   L_022708B0: ; // 0x22708b0
@@ -16114,8 +16114,8 @@ void Gambit_fn_022707E0(CPUState* cpu) {
         /* 022708BC */ _t31 = cpu->r[12] + 0xFFFFDAC0u;
         /* 022708BC */ rbrew_write32(cpu->mem, _t31, cpu->r[0]);
   L_022708C0: ; // 0x22708c0
-        /* 022708C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 022708C4 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022708C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 022708C4 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022708C4 */ _t33 = _t32 & 0x00000001u;
         /* 022708C4 */ if (_t33) goto L_022708E4; else goto L_022708C8;
   L_022708C8: ; // 0x22708c8
@@ -16126,8 +16126,8 @@ void Gambit_fn_022707E0(CPUState* cpu) {
         /* 022708D0 */ cpu->ctr = cpu->r[7];
         /* 022708D4 */ cpu->r[3] = cpu->r[30];
         /* 022708D8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 022708DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022708E0 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022708DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022708E0 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022708E0 */ _t37 = _t36 & 0x00000001u;
         /* 022708E0 */ if (_t37) goto L_022708E4; else goto L_022708E8;
   L_022708E4: ; // 0x22708e4
@@ -16140,9 +16140,9 @@ void Gambit_fn_022707E0(CPUState* cpu) {
         /* 022708F0 */ cpu->r[4] = 0x101D0000u;
         /* 022708F4 */ _t39 = cpu->r[28] + 0x00000000u;
         /* 022708F4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t39);
-        /* 022708F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 022708F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 022708FC */ cpu->r[4] = cpu->r[4] + 0xFFFFFBBCu;
-        /* 02270900 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270900 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270900 */ _t41 = _t40 & 0x00000001u;
         /* 02270900 */ if (_t41) goto L_02270904; else goto L_02270910;
   L_02270904: ; // 0x2270904
@@ -16152,8 +16152,8 @@ void Gambit_fn_022707E0(CPUState* cpu) {
         /* 0227090C */ _t43 = cpu->r[10] + 0x00000000u;
         /* 0227090C */ rbrew_write32(cpu->mem, _t43, cpu->r[0]);
   L_02270910: ; // 0x2270910
-        /* 02270910 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02270914 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270910 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02270914 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270914 */ _t45 = _t44 & 0x00000001u;
         /* 02270914 */ if (_t45) goto L_02270934; else goto L_02270918;
   L_02270918: ; // 0x2270918
@@ -16164,15 +16164,15 @@ void Gambit_fn_022707E0(CPUState* cpu) {
         /* 02270920 */ cpu->ctr = cpu->r[0];
         /* 02270924 */ cpu->r[3] = cpu->r[31];
         /* 02270928 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0227092C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270930 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227092C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270930 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270930 */ _t49 = _t48 & 0x00000001u;
         /* 02270930 */ if (_t49) goto L_02270934; else goto L_02270938;
   L_02270934: ; // 0x2270934
         /* 02270934 */ cpu->r[31] = 0x00000000u;
   L_02270938: ; // 0x2270938
-        /* 02270938 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 0227093C */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270938 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 0227093C */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227093C */ _t51 = _t50 & 0x00000001u;
         /* 0227093C */ if (_t51) goto L_02270964; else goto L_02270940;
   L_02270940: ; // 0x2270940
@@ -16192,8 +16192,8 @@ void Gambit_fn_022707E0(CPUState* cpu) {
         /* 0227095C */ Gambit_fn_0227063C(cpu);
         /* 02270960 */ goto L_0227098C;
   L_02270964: ; // 0x2270964
-        /* 02270964 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02270968 */ _t58 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270964 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02270968 */ _t58 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270968 */ _t59 = _t58 & 0x00000001u;
         /* 02270968 */ if (_t59) goto L_02270984; else goto L_0227096C;
   L_0227096C: ; // 0x227096c
@@ -16234,14 +16234,14 @@ void Gambit_fn_022709A0(CPUState* cpu) {
         /* 022709A8 */ cpu->r[1] = _t1;
         /* 022709AC */ _t2 = cpu->r[3] + 0x0000005Cu;
         /* 022709AC */ cpu->r[3] = rbrew_read32(cpu->mem, _t2);
-        /* 022709B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022709B4 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022709B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022709B4 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022709B4 */ _t4 = _t3 & 0x00000001u;
         /* 022709B4 */ if (_t4) goto L_022709D8; else goto L_022709B8;
   L_022709B8: ; // 0x22709b8
         /* 022709B8 */ Gambit_fn_02395444(cpu);
-        /* 022709BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022709C0 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022709BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022709C0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022709C0 */ _t6 = _t5 & 0x00000001u;
         /* 022709C0 */ if (_t6) goto L_022709D8; else goto L_022709C4;
   L_022709C4: ; // 0x22709c4
@@ -16270,14 +16270,14 @@ void Gambit_fn_022709A8(CPUState* cpu) {
         /* 022709A8 */ cpu->r[1] = _t0;
         /* 022709AC */ _t1 = cpu->r[3] + 0x0000005Cu;
         /* 022709AC */ cpu->r[3] = rbrew_read32(cpu->mem, _t1);
-        /* 022709B0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022709B4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022709B0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022709B4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022709B4 */ _t3 = _t2 & 0x00000001u;
         /* 022709B4 */ if (_t3) goto L_022709D8; else goto L_022709B8;
   L_022709B8: ; // 0x22709b8
         /* 022709B8 */ Gambit_fn_02395444(cpu);
-        /* 022709BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022709C0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022709BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022709C0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022709C0 */ _t5 = _t4 & 0x00000001u;
         /* 022709C0 */ if (_t5) goto L_022709D8; else goto L_022709C4;
   L_022709C4: ; // 0x22709c4
@@ -16327,7 +16327,7 @@ void Gambit_fn_022709EC(CPUState* cpu) {
         /* 02270A1C */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t9);
         /* 02270A20 */ _t10 = cpu->r[31] + 0x00000120u;
         /* 02270A20 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t10);
-        /* 02270A24 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[0]);
+        /* 02270A24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[0]));
         /* 02270A28 */ _t11 = cpu->r[1] + 0x00000020u;
         /* 02270A28 */ rbrew_write_f32(cpu->mem, _t11, cpu->f[10]);
         /* 02270A2C */ _t12 = cpu->r[31] + 0x00000124u;
@@ -16364,7 +16364,7 @@ void Gambit_fn_022709EC(CPUState* cpu) {
         /* 02270A68 */ rbrew_write_f32(cpu->mem, _t27, cpu->f[6]);
         /* 02270A6C */ _t28 = cpu->r[1] + 0x00000030u;
         /* 02270A6C */ rbrew_write_f32(cpu->mem, _t28, cpu->f[11]);
-        /* 02270A70 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270A70 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270A70 */ _t30 = _t29 & 0x00000001u;
         /* 02270A70 */ if (_t30) goto L_02270A90; else goto L_02270A74;
   L_02270A74: ; // 0x2270a74
@@ -16433,7 +16433,7 @@ void Gambit_fn_022709F0(CPUState* cpu) {
         /* 02270A1C */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t9);
         /* 02270A20 */ _t10 = cpu->r[31] + 0x00000120u;
         /* 02270A20 */ cpu->f[11] = rbrew_read_f32(cpu->mem, _t10);
-        /* 02270A24 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[7], cpu->f[0]);
+        /* 02270A24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[7], cpu->f[0]));
         /* 02270A28 */ _t11 = cpu->r[1] + 0x00000020u;
         /* 02270A28 */ rbrew_write_f32(cpu->mem, _t11, cpu->f[10]);
         /* 02270A2C */ _t12 = cpu->r[31] + 0x00000124u;
@@ -16470,7 +16470,7 @@ void Gambit_fn_022709F0(CPUState* cpu) {
         /* 02270A68 */ rbrew_write_f32(cpu->mem, _t27, cpu->f[6]);
         /* 02270A6C */ _t28 = cpu->r[1] + 0x00000030u;
         /* 02270A6C */ rbrew_write_f32(cpu->mem, _t28, cpu->f[11]);
-        /* 02270A70 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270A70 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270A70 */ _t30 = _t29 & 0x00000001u;
         /* 02270A70 */ if (_t30) goto L_02270A90; else goto L_02270A74;
   L_02270A74: ; // 0x2270a74
@@ -16529,9 +16529,9 @@ void Gambit_fn_02270AD4(CPUState* cpu) {
         /* 02057770 */ cpu->r[12] = _t2;
         /* 02057774 */ cpu->r[31] = 0x101E0000u;
         /* 02057778 */ cpu->r[25] = cpu->r[3];
-        /* 0205777C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0205777C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02057780 */ cpu->r[31] = cpu->r[31] + 0xFFFFA6F0u;
-        /* 02057784 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02057784 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02057784 */ _t4 = _t3 & 0x00000001u;
         /* 02057784 */ if (_t4) goto L_02057788; else goto L_020577D0;
   L_02057788: ; // 0x2057788
@@ -16557,8 +16557,8 @@ void Gambit_fn_02270AD4(CPUState* cpu) {
   L_020577D0: ; // 0x20577d0
         /* 020577D0 */ _t6 = cpu->r[31] + 0x00000054u;
         /* 020577D0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 020577D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020577D8 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020577D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020577D8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020577D8 */ _t8 = _t7 & 0x00000001u;
         /* 020577D8 */ if (_t8) goto L_020577DC; else goto L_020578D0;
   L_020577DC: ; // 0x20577dc
@@ -16574,9 +16574,9 @@ void Gambit_fn_02270AD4(CPUState* cpu) {
   L_02057800: ; // 0x2057800
         /* 02057800 */ _t9 = cpu->r[23] + 0xFFFFDA4Cu;
         /* 02057800 */ cpu->r[0] = rbrew_read32(cpu->mem, _t9);
-        /* 02057804 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02057804 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02057808 */ cpu->r[30] = cpu->r[29];
-        /* 0205780C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0205780C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0205780C */ _t11 = _t10 & 0x00000001u;
         /* 0205780C */ if (_t11) goto L_02057810; else goto L_02057828;
   L_02057810: ; // 0x2057810
@@ -16590,8 +16590,8 @@ void Gambit_fn_02270AD4(CPUState* cpu) {
   L_02057828: ; // 0x2057828
         /* 02057828 */ _t13 = cpu->r[21] + 0xFFFFDA48u;
         /* 02057828 */ cpu->r[12] = rbrew_read32(cpu->mem, _t13);
-        /* 0205782C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02057830 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0205782C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02057830 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02057830 */ _t15 = _t14 & 0x00000001u;
         /* 02057830 */ if (_t15) goto L_02057834; else goto L_0205783C;
   L_02057834: ; // 0x2057834
@@ -16600,8 +16600,8 @@ void Gambit_fn_02270AD4(CPUState* cpu) {
         /* 02057838 */ _t17 = cpu->r[21] + 0xFFFFDA48u;
         /* 02057838 */ rbrew_write32(cpu->mem, _t17, cpu->r[22]);
   L_0205783C: ; // 0x205783c
-        /* 0205783C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[30], 0x00000006u);
-        /* 02057840 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0205783C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[30], 0x00000006u));
+        /* 02057840 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02057840 */ _t19 = _t18 & 0x00000001u;
         /* 02057840 */ if (_t19) goto L_02057868; else goto L_02057844;
   L_02057844: ; // 0x2057844
@@ -16610,12 +16610,12 @@ void Gambit_fn_02270AD4(CPUState* cpu) {
         /* 0205784C */ cpu->r[5] = 0x00000000u;
         /* 02057850 */ Gambit_fn_028A6634(cpu);
         /* 02057854 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 02057858 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000006u);
-        /* 0205785C */ _t20 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02057858 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000006u));
+        /* 0205785C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0205785C */ _t21 = _t20 & 0x00000001u;
         /* 0205785C */ if (_t21) goto L_020578D0; else goto L_02057860;
   L_02057860: ; // 0x2057860
-        /* 02057860 */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02057860 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02057860 */ _t23 = _t22 & 0x00000001u;
         /* 02057860 */ if (_t23) goto L_02057800; else goto L_02057864;
   L_02057864: ; // 0x2057864
@@ -16623,8 +16623,8 @@ void Gambit_fn_02270AD4(CPUState* cpu) {
   L_02057868: ; // 0x2057868
         /* 02057868 */ _t24 = cpu->r[20] + 0xFFFFE64Cu;
         /* 02057868 */ cpu->r[0] = rbrew_read32(cpu->mem, _t24);
-        /* 0205786C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02057870 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0205786C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02057870 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02057870 */ _t26 = _t25 & 0x00000001u;
         /* 02057870 */ if (_t26) goto L_02057874; else goto L_020578AC;
   L_02057874: ; // 0x2057874
@@ -16633,8 +16633,8 @@ void Gambit_fn_02270AD4(CPUState* cpu) {
         /* 0205787C */ Gambit_fn_02836FFC(cpu);
         /* 02057880 */ _t27 = cpu->r[20] + 0xFFFFE64Cu;
         /* 02057880 */ cpu->r[5] = rbrew_read32(cpu->mem, _t27);
-        /* 02057884 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 02057888 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02057884 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 02057888 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02057888 */ _t29 = _t28 & 0x00000001u;
         /* 02057888 */ if (_t29) goto L_0205788C; else goto L_020578A0;
   L_0205788C: ; // 0x205788c
@@ -16657,12 +16657,12 @@ void Gambit_fn_02270AD4(CPUState* cpu) {
         /* 020578B8 */ cpu->r[4] = cpu->r[29];
         /* 020578BC */ Gambit_fn_028A6634(cpu);
         /* 020578C0 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 020578C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000006u);
-        /* 020578C8 */ _t33 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020578C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000006u));
+        /* 020578C8 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020578C8 */ _t34 = _t33 & 0x00000001u;
         /* 020578C8 */ if (_t34) goto L_020578D0; else goto L_020578CC;
   L_020578CC: ; // 0x20578cc
-        /* 020578CC */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020578CC */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020578CC */ _t36 = _t35 & 0x00000001u;
         /* 020578CC */ if (_t36) goto L_02057800; else goto L_020578D0;
   L_020578D0: ; // 0x20578d0
@@ -16675,9 +16675,9 @@ void Gambit_fn_02270AD4(CPUState* cpu) {
         /* 020578E4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t37);
         /* 020578E4 */ cpu->r[9] = _t37;
         /* 020578E8 */ cpu->r[31] = cpu->r[31] + 0xFFFFA780u;
-        /* 020578EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 020578EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 020578F0 */ cpu->r[25] = cpu->r[25] + 0x00000001u;
-        /* 020578F4 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020578F4 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020578F4 */ _t39 = _t38 & 0x00000001u;
         /* 020578F4 */ if (_t39) goto L_020578F8; else goto L_02057940;
   L_020578F8: ; // 0x20578f8
@@ -16703,8 +16703,8 @@ void Gambit_fn_02270AD4(CPUState* cpu) {
   L_02057940: ; // 0x2057940
         /* 02057940 */ _t41 = cpu->r[31] + 0x00000054u;
         /* 02057940 */ cpu->r[12] = rbrew_read32(cpu->mem, _t41);
-        /* 02057944 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02057948 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02057944 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02057948 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02057948 */ _t43 = _t42 & 0x00000001u;
         /* 02057948 */ if (_t43) goto L_0205794C; else goto L_02057A40;
   L_0205794C: ; // 0x205794c
@@ -16720,9 +16720,9 @@ void Gambit_fn_02270AD4(CPUState* cpu) {
   L_02057970: ; // 0x2057970
         /* 02057970 */ _t44 = cpu->r[20] + 0xFFFFDA54u;
         /* 02057970 */ cpu->r[0] = rbrew_read32(cpu->mem, _t44);
-        /* 02057974 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02057974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02057978 */ cpu->r[30] = cpu->r[29];
-        /* 0205797C */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0205797C */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0205797C */ _t46 = _t45 & 0x00000001u;
         /* 0205797C */ if (_t46) goto L_02057980; else goto L_02057998;
   L_02057980: ; // 0x2057980
@@ -16736,8 +16736,8 @@ void Gambit_fn_02270AD4(CPUState* cpu) {
   L_02057998: ; // 0x2057998
         /* 02057998 */ _t48 = cpu->r[28] + 0xFFFFDA50u;
         /* 02057998 */ cpu->r[0] = rbrew_read32(cpu->mem, _t48);
-        /* 0205799C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 020579A0 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0205799C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 020579A0 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020579A0 */ _t50 = _t49 & 0x00000001u;
         /* 020579A0 */ if (_t50) goto L_020579A4; else goto L_020579AC;
   L_020579A4: ; // 0x20579a4
@@ -16746,8 +16746,8 @@ void Gambit_fn_02270AD4(CPUState* cpu) {
         /* 020579A8 */ _t52 = cpu->r[28] + 0xFFFFDA50u;
         /* 020579A8 */ rbrew_write32(cpu->mem, _t52, cpu->r[19]);
   L_020579AC: ; // 0x20579ac
-        /* 020579AC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], 0x00000002u);
-        /* 020579B0 */ _t53 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020579AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], 0x00000002u));
+        /* 020579B0 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020579B0 */ _t54 = _t53 & 0x00000001u;
         /* 020579B0 */ if (_t54) goto L_020579D8; else goto L_020579B4;
   L_020579B4: ; // 0x20579b4
@@ -16756,12 +16756,12 @@ void Gambit_fn_02270AD4(CPUState* cpu) {
         /* 020579BC */ cpu->r[5] = 0x00000000u;
         /* 020579C0 */ Gambit_fn_028A6634(cpu);
         /* 020579C4 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 020579C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000002u);
-        /* 020579CC */ _t55 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 020579C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000002u));
+        /* 020579CC */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 020579CC */ _t56 = _t55 & 0x00000001u;
         /* 020579CC */ if (_t56) goto L_02057A40; else goto L_020579D0;
   L_020579D0: ; // 0x20579d0
-        /* 020579D0 */ _t57 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 020579D0 */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 020579D0 */ _t58 = _t57 & 0x00000001u;
         /* 020579D0 */ if (_t58) goto L_02057970; else goto L_020579D4;
   L_020579D4: ; // 0x20579d4
@@ -16769,8 +16769,8 @@ void Gambit_fn_02270AD4(CPUState* cpu) {
   L_020579D8: ; // 0x20579d8
         /* 020579D8 */ _t59 = cpu->r[27] + 0xFFFFE658u;
         /* 020579D8 */ cpu->r[6] = rbrew_read32(cpu->mem, _t59);
-        /* 020579DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 020579E0 */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020579DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 020579E0 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020579E0 */ _t61 = _t60 & 0x00000001u;
         /* 020579E0 */ if (_t61) goto L_020579E4; else goto L_02057A1C;
   L_020579E4: ; // 0x20579e4
@@ -16779,8 +16779,8 @@ void Gambit_fn_02270AD4(CPUState* cpu) {
         /* 020579EC */ Gambit_fn_02836FFC(cpu);
         /* 020579F0 */ _t62 = cpu->r[27] + 0xFFFFE658u;
         /* 020579F0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t62);
-        /* 020579F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 020579F8 */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 020579F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 020579F8 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 020579F8 */ _t64 = _t63 & 0x00000001u;
         /* 020579F8 */ if (_t64) goto L_020579FC; else goto L_02057A10;
   L_020579FC: ; // 0x20579fc
@@ -16803,12 +16803,12 @@ void Gambit_fn_02270AD4(CPUState* cpu) {
         /* 02057A28 */ cpu->r[4] = cpu->r[30];
         /* 02057A2C */ Gambit_fn_028A6634(cpu);
         /* 02057A30 */ cpu->r[29] = cpu->r[29] + 0x00000001u;
-        /* 02057A34 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000002u);
-        /* 02057A38 */ _t68 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02057A34 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000002u));
+        /* 02057A38 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02057A38 */ _t69 = _t68 & 0x00000001u;
         /* 02057A38 */ if (_t69) goto L_02057A40; else goto L_02057A3C;
   L_02057A3C: ; // 0x2057a3c
-        /* 02057A3C */ _t70 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02057A3C */ _t70 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02057A3C */ _t71 = _t70 & 0x00000001u;
         /* 02057A3C */ if (_t71) goto L_02057970; else goto L_02057A40;
   L_02057A40: ; // 0x2057a40
@@ -16847,8 +16847,8 @@ void Gambit_fn_02270AE0(CPUState* cpu) {
         /* 02270AF8 */ Gambit_fn_02019890(cpu);
         /* 02270AFC */ _t3 = cpu->r[1] + 0x00000008u;
         /* 02270AFC */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
-        /* 02270B00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000001u);
-        /* 02270B04 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270B00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000001u));
+        /* 02270B04 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270B04 */ _t5 = _t4 & 0x00000001u;
         /* 02270B04 */ if (_t5) goto L_02270B1C; else goto L_02270B08;
   L_02270B08: ; // 0x2270b08
@@ -16856,16 +16856,16 @@ void Gambit_fn_02270AE0(CPUState* cpu) {
         /* 02270B0C */ Gambit_fn_02019890(cpu);
         /* 02270B10 */ _t6 = cpu->r[1] + 0x0000000Cu;
         /* 02270B10 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 02270B14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 02270B18 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270B14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 02270B18 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270B18 */ _t8 = _t7 & 0x00000001u;
         /* 02270B18 */ if (_t8) goto L_02270B1C; else goto L_02270B44;
   L_02270B1C: ; // 0x2270b1c
         /* 02270B1C */ cpu->r[3] = 0x00000004u;
         /* 02270B20 */ Gambit_fn_02801A78(cpu);
         /* 02270B24 */ cpu->r[4] = cpu->r[3];
-        /* 02270B24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 02270B28 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270B24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 02270B28 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270B28 */ _t10 = _t9 & 0x00000001u;
         /* 02270B28 */ if (_t10) goto L_02270B38; else goto L_02270B2C;
   L_02270B2C: ; // 0x2270b2c
@@ -16906,8 +16906,8 @@ void Gambit_fn_02270AE4(CPUState* cpu) {
         /* 02270AF8 */ Gambit_fn_02019890(cpu);
         /* 02270AFC */ _t3 = cpu->r[1] + 0x00000008u;
         /* 02270AFC */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
-        /* 02270B00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000001u);
-        /* 02270B04 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270B00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000001u));
+        /* 02270B04 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270B04 */ _t5 = _t4 & 0x00000001u;
         /* 02270B04 */ if (_t5) goto L_02270B1C; else goto L_02270B08;
   L_02270B08: ; // 0x2270b08
@@ -16915,16 +16915,16 @@ void Gambit_fn_02270AE4(CPUState* cpu) {
         /* 02270B0C */ Gambit_fn_02019890(cpu);
         /* 02270B10 */ _t6 = cpu->r[1] + 0x0000000Cu;
         /* 02270B10 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 02270B14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 02270B18 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270B14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 02270B18 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270B18 */ _t8 = _t7 & 0x00000001u;
         /* 02270B18 */ if (_t8) goto L_02270B1C; else goto L_02270B44;
   L_02270B1C: ; // 0x2270b1c
         /* 02270B1C */ cpu->r[3] = 0x00000004u;
         /* 02270B20 */ Gambit_fn_02801A78(cpu);
         /* 02270B24 */ cpu->r[4] = cpu->r[3];
-        /* 02270B24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 02270B28 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270B24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 02270B28 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270B28 */ _t10 = _t9 & 0x00000001u;
         /* 02270B28 */ if (_t10) goto L_02270B38; else goto L_02270B2C;
   L_02270B2C: ; // 0x2270b2c
@@ -16955,16 +16955,16 @@ void Gambit_fn_02270B58(CPUState* cpu) {
   L_02270B58: ; // 0x2270b58
         /* 02270B58 */ _t0 = cpu->r[3] + 0x0000005Cu;
         /* 02270B58 */ cpu->r[10] = rbrew_read32(cpu->mem, _t0);
-        /* 02270B5C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02270B60 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270B5C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02270B60 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270B60 */ _t2 = _t1 & 0x00000001u;
         /* 02270B60 */ if (_t2) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02270B60 */ goto L_02270B64;
   L_02270B64: ; // 0x2270b64
         /* 02270B64 */ _t3 = cpu->r[10] + 0x00004714u;
         /* 02270B64 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 02270B68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 02270B6C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270B68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 02270B6C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270B6C */ _t5 = _t4 & 0x00000001u;
         /* 02270B6C */ if (_t5) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02270B6C */ goto L_02270B70;
@@ -16998,8 +16998,8 @@ void Gambit_fn_02270B58(CPUState* cpu) {
         /* 0240D484 */ Gambit_fn_02019890(cpu);
         /* 0240D488 */ _t14 = cpu->r[1] + 0x00000020u;
         /* 0240D488 */ cpu->r[12] = rbrew_read32(cpu->mem, _t14);
-        /* 0240D48C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000001u);
-        /* 0240D490 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0240D48C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000001u));
+        /* 0240D490 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0240D490 */ _t16 = _t15 & 0x00000001u;
         /* 0240D490 */ if (_t16) goto L_0240D4A8; else goto L_0240D494;
   L_0240D494: ; // 0x240d494
@@ -17007,8 +17007,8 @@ void Gambit_fn_02270B58(CPUState* cpu) {
         /* 0240D498 */ Gambit_fn_02019890(cpu);
         /* 0240D49C */ _t17 = cpu->r[1] + 0x00000024u;
         /* 0240D49C */ cpu->r[0] = rbrew_read32(cpu->mem, _t17);
-        /* 0240D4A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000006u);
-        /* 0240D4A4 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0240D4A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000006u));
+        /* 0240D4A4 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0240D4A4 */ _t19 = _t18 & 0x00000001u;
         /* 0240D4A4 */ if (_t19) goto L_0240D4A8; else goto L_0240D89C;
   L_0240D4A8: ; // 0x240d4a8
@@ -17017,10 +17017,10 @@ void Gambit_fn_02270B58(CPUState* cpu) {
         /* 0240D4AC */ cpu->r[3] = cpu->r[31];
         /* 0240D4B0 */ cpu->r[14] = 0x00000000u;
         /* 0240D4B4 */ Gambit_fn_0240D3D4(cpu);
-        /* 0240D4B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0240D4B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0240D4BC */ _t21 = cpu->r[1] + 0x00000014u;
         /* 0240D4BC */ rbrew_write32(cpu->mem, _t21, cpu->r[3]);
-        /* 0240D4C0 */ _t22 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0240D4C0 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0240D4C0 */ _t23 = _t22 & 0x00000001u;
         /* 0240D4C0 */ if (_t23) goto L_0240D4C4; else goto L_0240D89C;
   L_0240D4C4: ; // 0x240d4c4
@@ -17052,10 +17052,10 @@ void Gambit_fn_02270B58(CPUState* cpu) {
         /* 0240D518 */ cpu->r[0] = 0x00000000u;
         /* 0240D51C */ _t27 = cpu->r[1] + 0x0000001Cu;
         /* 0240D51C */ rbrew_write32(cpu->mem, _t27, cpu->r[0]);
-        /* 0240D520 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[6], 0x00000015u);
+        /* 0240D520 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[6], 0x00000015u));
         /* 0240D524 */ _t28 = cpu->r[1] + 0x00000010u;
         /* 0240D524 */ cpu->r[4] = rbrew_read32(cpu->mem, _t28);
-        /* 0240D528 */ _t29 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0240D528 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0240D528 */ _t30 = _t29 & 0x00000001u;
         /* 0240D528 */ if (_t30) goto L_0240D888; else goto L_0240D52C;
   L_0240D52C: ; // 0x240d52c
@@ -17068,11 +17068,11 @@ void Gambit_fn_02270B58(CPUState* cpu) {
         /* 0240D888 */ _t31 = cpu->r[1] + 0x00000014u;
         /* 0240D888 */ cpu->r[12] = rbrew_read32(cpu->mem, _t31);
         /* 0240D88C */ cpu->r[0] = cpu->r[12] + 0xFFFFFFFFu;
-        /* 0240D88C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0240D88C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0240D890 */ cpu->r[14] = cpu->r[14] + 0x00000001u;
         /* 0240D894 */ _t32 = cpu->r[1] + 0x00000014u;
         /* 0240D894 */ rbrew_write32(cpu->mem, _t32, cpu->r[0]);
-        /* 0240D898 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0240D898 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0240D898 */ _t34 = _t33 & 0x00000001u;
         /* 0240D898 */ if (_t34) goto L_0240D89C; else goto L_0240D514;
   L_0240D89C: ; // 0x240d89c
@@ -17182,10 +17182,10 @@ void Gambit_fn_02270BE0(CPUState* cpu) {
         /* 02270BFC */ _t5 = cpu->r[11] + 0xFFFFD9C8u;
         /* 02270BFC */ cpu->r[11] = rbrew_read32(cpu->mem, _t5);
         /* 02270C00 */ cpu->r[31] = cpu->r[3];
-        /* 02270C04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02270C04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02270C08 */ _t6 = cpu->r[31] + 0x000000C4u;
         /* 02270C08 */ cpu->r[30] = rbrew_read32(cpu->mem, _t6);
-        /* 02270C0C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270C0C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270C0C */ _t8 = _t7 & 0x00000001u;
         /* 02270C0C */ if (_t8) goto L_02270C10; else goto L_02270C2C;
   L_02270C10: ; // 0x2270c10
@@ -17199,8 +17199,8 @@ void Gambit_fn_02270BE0(CPUState* cpu) {
         /* 02270C28 */ _t10 = cpu->r[5] + 0xFFFFE310u;
         /* 02270C28 */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
   L_02270C2C: ; // 0x2270c2c
-        /* 02270C2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02270C30 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270C2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02270C30 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270C30 */ _t12 = _t11 & 0x00000001u;
         /* 02270C30 */ if (_t12) goto L_02270C60; else goto L_02270C34;
   L_02270C34: ; // 0x2270c34
@@ -17213,13 +17213,13 @@ void Gambit_fn_02270BE0(CPUState* cpu) {
         /* 02270C44 */ cpu->r[4] = cpu->r[4] + 0xFFFFE310u;
         /* 02270C48 */ cpu->r[3] = cpu->r[30];
         /* 02270C4C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02270C50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270C54 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270C50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270C54 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270C54 */ _t16 = _t15 & 0x00000001u;
         /* 02270C54 */ if (_t16) goto L_02270C60; else goto L_02270C58;
   L_02270C58: ; // 0x2270c58
-        /* 02270C58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02270C5C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270C58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02270C5C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270C5C */ _t18 = _t17 & 0x00000001u;
         /* 02270C5C */ if (_t18) goto L_02270C60; else goto L_02270DD4;
   L_02270C60: ; // 0x2270c60
@@ -17229,9 +17229,9 @@ void Gambit_fn_02270BE0(CPUState* cpu) {
         /* 02270C68 */ _t20 = cpu->r[31] + 0x000000C4u;
         /* 02270C68 */ cpu->r[30] = rbrew_read32(cpu->mem, _t20);
         /* 02270C6C */ cpu->r[29] = 0x10060000u;
-        /* 02270C70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02270C70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02270C74 */ cpu->r[29] = cpu->r[29] + 0xFFFF9018u;
-        /* 02270C78 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270C78 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270C78 */ _t22 = _t21 & 0x00000001u;
         /* 02270C78 */ if (_t22) goto L_02270C7C; else goto L_02270C90;
   L_02270C7C: ; // 0x2270c7c
@@ -17243,8 +17243,8 @@ void Gambit_fn_02270BE0(CPUState* cpu) {
         /* 02270C8C */ _t24 = cpu->r[9] + 0x00000078u;
         /* 02270C8C */ rbrew_write32(cpu->mem, _t24, cpu->r[29]);
   L_02270C90: ; // 0x2270c90
-        /* 02270C90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02270C94 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270C90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02270C94 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270C94 */ _t26 = _t25 & 0x00000001u;
         /* 02270C94 */ if (_t26) goto L_02270CC4; else goto L_02270C98;
   L_02270C98: ; // 0x2270c98
@@ -17257,23 +17257,23 @@ void Gambit_fn_02270BE0(CPUState* cpu) {
         /* 02270CA8 */ cpu->r[4] = cpu->r[4] + 0x00000078u;
         /* 02270CAC */ cpu->r[3] = cpu->r[30];
         /* 02270CB0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02270CB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270CB8 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270CB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270CB8 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270CB8 */ _t30 = _t29 & 0x00000001u;
         /* 02270CB8 */ if (_t30) goto L_02270CC4; else goto L_02270CBC;
   L_02270CBC: ; // 0x2270cbc
-        /* 02270CBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02270CC0 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270CBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02270CC0 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270CC0 */ _t32 = _t31 & 0x00000001u;
         /* 02270CC0 */ if (_t32) goto L_02270CC4; else goto L_02270DD4;
   L_02270CC4: ; // 0x2270cc4
         /* 02270CC4 */ cpu->r[9] = 0x101D0000u;
         /* 02270CC8 */ _t33 = cpu->r[9] + 0xFFFFFE68u;
         /* 02270CC8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t33);
-        /* 02270CCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02270CCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02270CD0 */ _t34 = cpu->r[31] + 0x000000C4u;
         /* 02270CD0 */ cpu->r[30] = rbrew_read32(cpu->mem, _t34);
-        /* 02270CD4 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270CD4 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270CD4 */ _t36 = _t35 & 0x00000001u;
         /* 02270CD4 */ if (_t36) goto L_02270CD8; else goto L_02270CEC;
   L_02270CD8: ; // 0x2270cd8
@@ -17285,8 +17285,8 @@ void Gambit_fn_02270BE0(CPUState* cpu) {
         /* 02270CE8 */ _t38 = cpu->r[11] + 0x0000007Cu;
         /* 02270CE8 */ rbrew_write32(cpu->mem, _t38, cpu->r[29]);
   L_02270CEC: ; // 0x2270cec
-        /* 02270CEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02270CF0 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270CEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02270CF0 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270CF0 */ _t40 = _t39 & 0x00000001u;
         /* 02270CF0 */ if (_t40) goto L_02270D20; else goto L_02270CF4;
   L_02270CF4: ; // 0x2270cf4
@@ -17299,13 +17299,13 @@ void Gambit_fn_02270BE0(CPUState* cpu) {
         /* 02270D04 */ cpu->r[4] = cpu->r[4] + 0x0000007Cu;
         /* 02270D08 */ cpu->r[3] = cpu->r[30];
         /* 02270D0C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02270D10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270D14 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270D10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270D14 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270D14 */ _t44 = _t43 & 0x00000001u;
         /* 02270D14 */ if (_t44) goto L_02270D20; else goto L_02270D18;
   L_02270D18: ; // 0x2270d18
-        /* 02270D18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02270D1C */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270D18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02270D1C */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270D1C */ _t46 = _t45 & 0x00000001u;
         /* 02270D1C */ if (_t46) goto L_02270D20; else goto L_02270DD4;
   L_02270D20: ; // 0x2270d20
@@ -17315,9 +17315,9 @@ void Gambit_fn_02270BE0(CPUState* cpu) {
         /* 02270D28 */ cpu->r[4] = 0x101D0000u;
         /* 02270D2C */ _t48 = cpu->r[31] + 0x000000C4u;
         /* 02270D2C */ cpu->r[30] = rbrew_read32(cpu->mem, _t48);
-        /* 02270D30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02270D30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02270D34 */ cpu->r[4] = cpu->r[4] + 0x00000080u;
-        /* 02270D38 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270D38 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270D38 */ _t50 = _t49 & 0x00000001u;
         /* 02270D38 */ if (_t50) goto L_02270D3C; else goto L_02270D4C;
   L_02270D3C: ; // 0x2270d3c
@@ -17328,8 +17328,8 @@ void Gambit_fn_02270BE0(CPUState* cpu) {
         /* 02270D48 */ _t52 = cpu->r[7] + 0xFFFFFE48u;
         /* 02270D48 */ rbrew_write32(cpu->mem, _t52, cpu->r[0]);
   L_02270D4C: ; // 0x2270d4c
-        /* 02270D4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02270D50 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270D4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02270D50 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270D50 */ _t54 = _t53 & 0x00000001u;
         /* 02270D50 */ if (_t54) goto L_02270D78; else goto L_02270D54;
   L_02270D54: ; // 0x2270d54
@@ -17340,13 +17340,13 @@ void Gambit_fn_02270BE0(CPUState* cpu) {
         /* 02270D5C */ cpu->ctr = cpu->r[5];
         /* 02270D60 */ cpu->r[3] = cpu->r[30];
         /* 02270D64 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02270D68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270D6C */ _t57 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270D68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270D6C */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270D6C */ _t58 = _t57 & 0x00000001u;
         /* 02270D6C */ if (_t58) goto L_02270D78; else goto L_02270D70;
   L_02270D70: ; // 0x2270d70
-        /* 02270D70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02270D74 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270D70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02270D74 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270D74 */ _t60 = _t59 & 0x00000001u;
         /* 02270D74 */ if (_t60) goto L_02270D78; else goto L_02270DD4;
   L_02270D78: ; // 0x2270d78
@@ -17357,9 +17357,9 @@ void Gambit_fn_02270BE0(CPUState* cpu) {
         /* 02270D80 */ cpu->r[4] = 0x101D0000u;
         /* 02270D84 */ _t62 = cpu->r[31] + 0x000000C4u;
         /* 02270D84 */ cpu->r[31] = rbrew_read32(cpu->mem, _t62);
-        /* 02270D88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02270D88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02270D8C */ cpu->r[4] = cpu->r[4] + 0x00000084u;
-        /* 02270D90 */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270D90 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270D90 */ _t64 = _t63 & 0x00000001u;
         /* 02270D90 */ if (_t64) goto L_02270D94; else goto L_02270DA8;
   L_02270D94: ; // 0x2270d94
@@ -17371,8 +17371,8 @@ void Gambit_fn_02270BE0(CPUState* cpu) {
         /* 02270DA4 */ _t66 = cpu->r[4] + 0x00000000u;
         /* 02270DA4 */ rbrew_write32(cpu->mem, _t66, cpu->r[0]);
   L_02270DA8: ; // 0x2270da8
-        /* 02270DA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02270DAC */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270DA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02270DAC */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270DAC */ _t68 = _t67 & 0x00000001u;
         /* 02270DAC */ if (_t68) goto L_02270DF4; else goto L_02270DB0;
   L_02270DB0: ; // 0x2270db0
@@ -17383,13 +17383,13 @@ void Gambit_fn_02270BE0(CPUState* cpu) {
         /* 02270DB8 */ cpu->ctr = cpu->r[0];
         /* 02270DBC */ cpu->r[3] = cpu->r[31];
         /* 02270DC0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02270DC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270DC8 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270DC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270DC8 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270DC8 */ _t72 = _t71 & 0x00000001u;
         /* 02270DC8 */ if (_t72) goto L_02270DF4; else goto L_02270DCC;
   L_02270DCC: ; // 0x2270dcc
-        /* 02270DCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02270DD0 */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270DCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02270DD0 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270DD0 */ _t74 = _t73 & 0x00000001u;
         /* 02270DD0 */ if (_t74) goto L_02270DF4; else goto L_02270DD4;
   L_02270DD4: ; // 0x2270dd4
@@ -17440,10 +17440,10 @@ void Gambit_fn_02270BE4(CPUState* cpu) {
         /* 02270BFC */ _t5 = cpu->r[11] + 0xFFFFD9C8u;
         /* 02270BFC */ cpu->r[11] = rbrew_read32(cpu->mem, _t5);
         /* 02270C00 */ cpu->r[31] = cpu->r[3];
-        /* 02270C04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 02270C04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 02270C08 */ _t6 = cpu->r[31] + 0x000000C4u;
         /* 02270C08 */ cpu->r[30] = rbrew_read32(cpu->mem, _t6);
-        /* 02270C0C */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270C0C */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270C0C */ _t8 = _t7 & 0x00000001u;
         /* 02270C0C */ if (_t8) goto L_02270C10; else goto L_02270C2C;
   L_02270C10: ; // 0x2270c10
@@ -17457,8 +17457,8 @@ void Gambit_fn_02270BE4(CPUState* cpu) {
         /* 02270C28 */ _t10 = cpu->r[5] + 0xFFFFE310u;
         /* 02270C28 */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
   L_02270C2C: ; // 0x2270c2c
-        /* 02270C2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02270C30 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270C2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02270C30 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270C30 */ _t12 = _t11 & 0x00000001u;
         /* 02270C30 */ if (_t12) goto L_02270C60; else goto L_02270C34;
   L_02270C34: ; // 0x2270c34
@@ -17471,13 +17471,13 @@ void Gambit_fn_02270BE4(CPUState* cpu) {
         /* 02270C44 */ cpu->r[4] = cpu->r[4] + 0xFFFFE310u;
         /* 02270C48 */ cpu->r[3] = cpu->r[30];
         /* 02270C4C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02270C50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270C54 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270C50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270C54 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270C54 */ _t16 = _t15 & 0x00000001u;
         /* 02270C54 */ if (_t16) goto L_02270C60; else goto L_02270C58;
   L_02270C58: ; // 0x2270c58
-        /* 02270C58 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02270C5C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270C58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02270C5C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270C5C */ _t18 = _t17 & 0x00000001u;
         /* 02270C5C */ if (_t18) goto L_02270C60; else goto L_02270DD4;
   L_02270C60: ; // 0x2270c60
@@ -17487,9 +17487,9 @@ void Gambit_fn_02270BE4(CPUState* cpu) {
         /* 02270C68 */ _t20 = cpu->r[31] + 0x000000C4u;
         /* 02270C68 */ cpu->r[30] = rbrew_read32(cpu->mem, _t20);
         /* 02270C6C */ cpu->r[29] = 0x10060000u;
-        /* 02270C70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02270C70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02270C74 */ cpu->r[29] = cpu->r[29] + 0xFFFF9018u;
-        /* 02270C78 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270C78 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270C78 */ _t22 = _t21 & 0x00000001u;
         /* 02270C78 */ if (_t22) goto L_02270C7C; else goto L_02270C90;
   L_02270C7C: ; // 0x2270c7c
@@ -17501,8 +17501,8 @@ void Gambit_fn_02270BE4(CPUState* cpu) {
         /* 02270C8C */ _t24 = cpu->r[9] + 0x00000078u;
         /* 02270C8C */ rbrew_write32(cpu->mem, _t24, cpu->r[29]);
   L_02270C90: ; // 0x2270c90
-        /* 02270C90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02270C94 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270C90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02270C94 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270C94 */ _t26 = _t25 & 0x00000001u;
         /* 02270C94 */ if (_t26) goto L_02270CC4; else goto L_02270C98;
   L_02270C98: ; // 0x2270c98
@@ -17515,23 +17515,23 @@ void Gambit_fn_02270BE4(CPUState* cpu) {
         /* 02270CA8 */ cpu->r[4] = cpu->r[4] + 0x00000078u;
         /* 02270CAC */ cpu->r[3] = cpu->r[30];
         /* 02270CB0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02270CB4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270CB8 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270CB4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270CB8 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270CB8 */ _t30 = _t29 & 0x00000001u;
         /* 02270CB8 */ if (_t30) goto L_02270CC4; else goto L_02270CBC;
   L_02270CBC: ; // 0x2270cbc
-        /* 02270CBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02270CC0 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270CBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02270CC0 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270CC0 */ _t32 = _t31 & 0x00000001u;
         /* 02270CC0 */ if (_t32) goto L_02270CC4; else goto L_02270DD4;
   L_02270CC4: ; // 0x2270cc4
         /* 02270CC4 */ cpu->r[9] = 0x101D0000u;
         /* 02270CC8 */ _t33 = cpu->r[9] + 0xFFFFFE68u;
         /* 02270CC8 */ cpu->r[9] = rbrew_read32(cpu->mem, _t33);
-        /* 02270CCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
+        /* 02270CCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
         /* 02270CD0 */ _t34 = cpu->r[31] + 0x000000C4u;
         /* 02270CD0 */ cpu->r[30] = rbrew_read32(cpu->mem, _t34);
-        /* 02270CD4 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270CD4 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270CD4 */ _t36 = _t35 & 0x00000001u;
         /* 02270CD4 */ if (_t36) goto L_02270CD8; else goto L_02270CEC;
   L_02270CD8: ; // 0x2270cd8
@@ -17543,8 +17543,8 @@ void Gambit_fn_02270BE4(CPUState* cpu) {
         /* 02270CE8 */ _t38 = cpu->r[11] + 0x0000007Cu;
         /* 02270CE8 */ rbrew_write32(cpu->mem, _t38, cpu->r[29]);
   L_02270CEC: ; // 0x2270cec
-        /* 02270CEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02270CF0 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270CEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02270CF0 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270CF0 */ _t40 = _t39 & 0x00000001u;
         /* 02270CF0 */ if (_t40) goto L_02270D20; else goto L_02270CF4;
   L_02270CF4: ; // 0x2270cf4
@@ -17557,13 +17557,13 @@ void Gambit_fn_02270BE4(CPUState* cpu) {
         /* 02270D04 */ cpu->r[4] = cpu->r[4] + 0x0000007Cu;
         /* 02270D08 */ cpu->r[3] = cpu->r[30];
         /* 02270D0C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02270D10 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270D14 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270D10 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270D14 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270D14 */ _t44 = _t43 & 0x00000001u;
         /* 02270D14 */ if (_t44) goto L_02270D20; else goto L_02270D18;
   L_02270D18: ; // 0x2270d18
-        /* 02270D18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02270D1C */ _t45 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270D18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02270D1C */ _t45 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270D1C */ _t46 = _t45 & 0x00000001u;
         /* 02270D1C */ if (_t46) goto L_02270D20; else goto L_02270DD4;
   L_02270D20: ; // 0x2270d20
@@ -17573,9 +17573,9 @@ void Gambit_fn_02270BE4(CPUState* cpu) {
         /* 02270D28 */ cpu->r[4] = 0x101D0000u;
         /* 02270D2C */ _t48 = cpu->r[31] + 0x000000C4u;
         /* 02270D2C */ cpu->r[30] = rbrew_read32(cpu->mem, _t48);
-        /* 02270D30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02270D30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02270D34 */ cpu->r[4] = cpu->r[4] + 0x00000080u;
-        /* 02270D38 */ _t49 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270D38 */ _t49 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270D38 */ _t50 = _t49 & 0x00000001u;
         /* 02270D38 */ if (_t50) goto L_02270D3C; else goto L_02270D4C;
   L_02270D3C: ; // 0x2270d3c
@@ -17586,8 +17586,8 @@ void Gambit_fn_02270BE4(CPUState* cpu) {
         /* 02270D48 */ _t52 = cpu->r[7] + 0xFFFFFE48u;
         /* 02270D48 */ rbrew_write32(cpu->mem, _t52, cpu->r[0]);
   L_02270D4C: ; // 0x2270d4c
-        /* 02270D4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02270D50 */ _t53 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270D4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02270D50 */ _t53 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270D50 */ _t54 = _t53 & 0x00000001u;
         /* 02270D50 */ if (_t54) goto L_02270D78; else goto L_02270D54;
   L_02270D54: ; // 0x2270d54
@@ -17598,13 +17598,13 @@ void Gambit_fn_02270BE4(CPUState* cpu) {
         /* 02270D5C */ cpu->ctr = cpu->r[5];
         /* 02270D60 */ cpu->r[3] = cpu->r[30];
         /* 02270D64 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02270D68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270D6C */ _t57 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270D68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270D6C */ _t57 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270D6C */ _t58 = _t57 & 0x00000001u;
         /* 02270D6C */ if (_t58) goto L_02270D78; else goto L_02270D70;
   L_02270D70: ; // 0x2270d70
-        /* 02270D70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02270D74 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270D70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02270D74 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270D74 */ _t60 = _t59 & 0x00000001u;
         /* 02270D74 */ if (_t60) goto L_02270D78; else goto L_02270DD4;
   L_02270D78: ; // 0x2270d78
@@ -17615,9 +17615,9 @@ void Gambit_fn_02270BE4(CPUState* cpu) {
         /* 02270D80 */ cpu->r[4] = 0x101D0000u;
         /* 02270D84 */ _t62 = cpu->r[31] + 0x000000C4u;
         /* 02270D84 */ cpu->r[31] = rbrew_read32(cpu->mem, _t62);
-        /* 02270D88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02270D88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02270D8C */ cpu->r[4] = cpu->r[4] + 0x00000084u;
-        /* 02270D90 */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270D90 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270D90 */ _t64 = _t63 & 0x00000001u;
         /* 02270D90 */ if (_t64) goto L_02270D94; else goto L_02270DA8;
   L_02270D94: ; // 0x2270d94
@@ -17629,8 +17629,8 @@ void Gambit_fn_02270BE4(CPUState* cpu) {
         /* 02270DA4 */ _t66 = cpu->r[4] + 0x00000000u;
         /* 02270DA4 */ rbrew_write32(cpu->mem, _t66, cpu->r[0]);
   L_02270DA8: ; // 0x2270da8
-        /* 02270DA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02270DAC */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270DA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02270DAC */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270DAC */ _t68 = _t67 & 0x00000001u;
         /* 02270DAC */ if (_t68) goto L_02270DF4; else goto L_02270DB0;
   L_02270DB0: ; // 0x2270db0
@@ -17641,13 +17641,13 @@ void Gambit_fn_02270BE4(CPUState* cpu) {
         /* 02270DB8 */ cpu->ctr = cpu->r[0];
         /* 02270DBC */ cpu->r[3] = cpu->r[31];
         /* 02270DC0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02270DC4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270DC8 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270DC4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270DC8 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270DC8 */ _t72 = _t71 & 0x00000001u;
         /* 02270DC8 */ if (_t72) goto L_02270DF4; else goto L_02270DCC;
   L_02270DCC: ; // 0x2270dcc
-        /* 02270DCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02270DD0 */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270DCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02270DD0 */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270DD0 */ _t74 = _t73 & 0x00000001u;
         /* 02270DD0 */ if (_t74) goto L_02270DF4; else goto L_02270DD4;
   L_02270DD4: ; // 0x2270dd4
@@ -17700,68 +17700,68 @@ void Gambit_fn_02270E14(CPUState* cpu) {
         /* 02270E34 */ _t5 = cpu->r[12] + 0x0000026Cu;
         /* 02270E34 */ cpu->r[3] = rbrew_read32(cpu->mem, _t5);
         /* 02270E38 */ Gambit_fn_022DABA8(cpu);
-        /* 02270E3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270E40 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270E3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270E40 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270E40 */ _t7 = _t6 & 0x00000001u;
         /* 02270E40 */ if (_t7) goto L_02270E44; else goto L_02270EC8;
   L_02270E44: ; // 0x2270e44
         /* 02270E44 */ _t8 = cpu->r[31] + 0x00000020u;
         /* 02270E44 */ cpu->r[10] = rbrew_read32(cpu->mem, _t8);
-        /* 02270E48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x0000000Fu);
-        /* 02270E4C */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02270E48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x0000000Fu));
+        /* 02270E4C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02270E4C */ _t10 = _t9 & 0x00000001u;
         /* 02270E4C */ if (_t10) goto L_02270E50; else goto L_02270E74;
   L_02270E50: ; // 0x2270e50
-        /* 02270E50 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x0000000Bu);
-        /* 02270E54 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270E50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x0000000Bu));
+        /* 02270E54 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270E54 */ _t12 = _t11 & 0x00000001u;
         /* 02270E54 */ if (_t12) goto L_02270EC8; else goto L_02270E58;
   L_02270E58: ; // 0x2270e58
-        /* 02270E58 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x0000000Du);
-        /* 02270E5C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270E58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x0000000Du));
+        /* 02270E5C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270E5C */ _t14 = _t13 & 0x00000001u;
         /* 02270E5C */ if (_t14) goto L_02270EC8; else goto L_02270E60;
   L_02270E60: ; // 0x2270e60
         /* 02270E60 */ cpu->r[3] = cpu->r[31];
         /* 02270E64 */ Gambit_fn_02270BE0(cpu);
-        /* 02270E68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270E6C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270E68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270E6C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270E6C */ _t16 = _t15 & 0x00000001u;
         /* 02270E6C */ if (_t16) goto L_02270E9C; else goto L_02270E70;
   L_02270E70: ; // 0x2270e70
         /* 02270E70 */ goto L_02270EB0;
   L_02270E74: ; // 0x2270e74
-        /* 02270E74 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x0000000Fu);
-        /* 02270E78 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270E74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x0000000Fu));
+        /* 02270E78 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270E78 */ _t18 = _t17 & 0x00000001u;
         /* 02270E78 */ if (_t18) goto L_02270EC8; else goto L_02270E7C;
   L_02270E7C: ; // 0x2270e7c
-        /* 02270E7C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000017u);
-        /* 02270E80 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270E7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000017u));
+        /* 02270E80 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270E80 */ _t20 = _t19 & 0x00000001u;
         /* 02270E80 */ if (_t20) goto L_02270EC8; else goto L_02270E84;
   L_02270E84: ; // 0x2270e84
-        /* 02270E84 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x0000001Fu);
-        /* 02270E88 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270E84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x0000001Fu));
+        /* 02270E88 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270E88 */ _t22 = _t21 & 0x00000001u;
         /* 02270E88 */ if (_t22) goto L_02270EC8; else goto L_02270E8C;
   L_02270E8C: ; // 0x2270e8c
         /* 02270E8C */ cpu->r[3] = cpu->r[31];
         /* 02270E90 */ Gambit_fn_02270BE0(cpu);
-        /* 02270E94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270E98 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270E94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270E98 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270E98 */ _t24 = _t23 & 0x00000001u;
         /* 02270E98 */ if (_t24) goto L_02270E9C; else goto L_02270EB0;
   L_02270E9C: ; // 0x2270e9c
         /* 02270E9C */ _t25 = cpu->r[31] + 0x00000084u;
         /* 02270E9C */ cpu->r[0] = rbrew_read32(cpu->mem, _t25);
-        /* 02270EA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 02270EA4 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270EA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 02270EA4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270EA4 */ _t27 = _t26 & 0x00000001u;
         /* 02270EA4 */ if (_t27) goto L_02270EB0; else goto L_02270EA8;
   L_02270EA8: ; // 0x2270ea8
-        /* 02270EA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02270EAC */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270EA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02270EAC */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270EAC */ _t29 = _t28 & 0x00000001u;
         /* 02270EAC */ if (_t29) goto L_02270EB0; else goto L_02270EC8;
   L_02270EB0: ; // 0x2270eb0
@@ -17805,68 +17805,68 @@ void Gambit_fn_02270E18(CPUState* cpu) {
         /* 02270E34 */ _t5 = cpu->r[12] + 0x0000026Cu;
         /* 02270E34 */ cpu->r[3] = rbrew_read32(cpu->mem, _t5);
         /* 02270E38 */ Gambit_fn_022DABA8(cpu);
-        /* 02270E3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270E40 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270E3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270E40 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270E40 */ _t7 = _t6 & 0x00000001u;
         /* 02270E40 */ if (_t7) goto L_02270E44; else goto L_02270EC8;
   L_02270E44: ; // 0x2270e44
         /* 02270E44 */ _t8 = cpu->r[31] + 0x00000020u;
         /* 02270E44 */ cpu->r[10] = rbrew_read32(cpu->mem, _t8);
-        /* 02270E48 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x0000000Fu);
-        /* 02270E4C */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02270E48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x0000000Fu));
+        /* 02270E4C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02270E4C */ _t10 = _t9 & 0x00000001u;
         /* 02270E4C */ if (_t10) goto L_02270E50; else goto L_02270E74;
   L_02270E50: ; // 0x2270e50
-        /* 02270E50 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x0000000Bu);
-        /* 02270E54 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270E50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x0000000Bu));
+        /* 02270E54 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270E54 */ _t12 = _t11 & 0x00000001u;
         /* 02270E54 */ if (_t12) goto L_02270EC8; else goto L_02270E58;
   L_02270E58: ; // 0x2270e58
-        /* 02270E58 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x0000000Du);
-        /* 02270E5C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270E58 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x0000000Du));
+        /* 02270E5C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270E5C */ _t14 = _t13 & 0x00000001u;
         /* 02270E5C */ if (_t14) goto L_02270EC8; else goto L_02270E60;
   L_02270E60: ; // 0x2270e60
         /* 02270E60 */ cpu->r[3] = cpu->r[31];
         /* 02270E64 */ Gambit_fn_02270BE0(cpu);
-        /* 02270E68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270E6C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270E68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270E6C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270E6C */ _t16 = _t15 & 0x00000001u;
         /* 02270E6C */ if (_t16) goto L_02270E9C; else goto L_02270E70;
   L_02270E70: ; // 0x2270e70
         /* 02270E70 */ goto L_02270EB0;
   L_02270E74: ; // 0x2270e74
-        /* 02270E74 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x0000000Fu);
-        /* 02270E78 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270E74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x0000000Fu));
+        /* 02270E78 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270E78 */ _t18 = _t17 & 0x00000001u;
         /* 02270E78 */ if (_t18) goto L_02270EC8; else goto L_02270E7C;
   L_02270E7C: ; // 0x2270e7c
-        /* 02270E7C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x00000017u);
-        /* 02270E80 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270E7C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x00000017u));
+        /* 02270E80 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270E80 */ _t20 = _t19 & 0x00000001u;
         /* 02270E80 */ if (_t20) goto L_02270EC8; else goto L_02270E84;
   L_02270E84: ; // 0x2270e84
-        /* 02270E84 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[10], 0x0000001Fu);
-        /* 02270E88 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270E84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[10], 0x0000001Fu));
+        /* 02270E88 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270E88 */ _t22 = _t21 & 0x00000001u;
         /* 02270E88 */ if (_t22) goto L_02270EC8; else goto L_02270E8C;
   L_02270E8C: ; // 0x2270e8c
         /* 02270E8C */ cpu->r[3] = cpu->r[31];
         /* 02270E90 */ Gambit_fn_02270BE0(cpu);
-        /* 02270E94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270E98 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270E94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270E98 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270E98 */ _t24 = _t23 & 0x00000001u;
         /* 02270E98 */ if (_t24) goto L_02270E9C; else goto L_02270EB0;
   L_02270E9C: ; // 0x2270e9c
         /* 02270E9C */ _t25 = cpu->r[31] + 0x00000084u;
         /* 02270E9C */ cpu->r[0] = rbrew_read32(cpu->mem, _t25);
-        /* 02270EA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 02270EA4 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270EA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 02270EA4 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270EA4 */ _t27 = _t26 & 0x00000001u;
         /* 02270EA4 */ if (_t27) goto L_02270EB0; else goto L_02270EA8;
   L_02270EA8: ; // 0x2270ea8
-        /* 02270EA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02270EAC */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270EA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02270EAC */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270EAC */ _t29 = _t28 & 0x00000001u;
         /* 02270EAC */ if (_t29) goto L_02270EB0; else goto L_02270EC8;
   L_02270EB0: ; // 0x2270eb0
@@ -17905,20 +17905,20 @@ void Gambit_fn_02270EE0(CPUState* cpu) {
   L_0238B714: ; // 0x238b714
         /* 0238B714 */ _t3 = cpu->r[3] + 0x0000000Cu;
         /* 0238B714 */ cpu->r[0] = rbrew_read32(cpu->mem, _t3);
-        /* 0238B718 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000003u);
-        /* 0238B71C */ _t4 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0238B718 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000003u));
+        /* 0238B71C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0238B71C */ _t5 = _t4 & 0x00000001u;
         /* 0238B71C */ if (_t5) goto L_0238B720; else goto L_0238B724;
   L_0238B720: ; // 0x238b720
         /* 0238B720 */ cpu->r[0] = 0x00000003u;
   L_0238B724: ; // 0x238b724
-        /* 0238B724 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000001u);
-        /* 0238B728 */ _t6 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0238B724 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000001u));
+        /* 0238B728 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0238B728 */ _t7 = _t6 & 0x00000001u;
         /* 0238B728 */ if (_t7) goto L_0238B744; else goto L_0238B72C;
   L_0238B72C: ; // 0x238b72c
-        /* 0238B72C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000004u);
-        /* 0238B730 */ _t8 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0238B72C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000004u));
+        /* 0238B730 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0238B730 */ _t9 = _t8 & 0x00000001u;
         /* 0238B730 */ if (_t9) goto L_0238B744; else goto L_0238B734;
   L_0238B734: ; // 0x238b734
@@ -17964,8 +17964,8 @@ void Gambit_fn_02270EF4(CPUState* cpu) {
         /* 02270F28 */ _t9 = cpu->r[10] + 0x0000026Cu;
         /* 02270F28 */ cpu->r[3] = rbrew_read32(cpu->mem, _t9);
         /* 02270F2C */ Gambit_fn_022DABA8(cpu);
-        /* 02270F30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270F34 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270F30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270F34 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270F34 */ _t11 = _t10 & 0x00000001u;
         /* 02270F34 */ if (_t11) goto L_02270F38; else goto L_02271044;
   L_02270F38: ; // 0x2270f38
@@ -17976,8 +17976,8 @@ void Gambit_fn_02270EF4(CPUState* cpu) {
         /* 02270F40 */ _t14 = cpu->r[11] + 0x0000026Cu;
         /* 02270F40 */ cpu->r[3] = rbrew_read32(cpu->mem, _t14);
         /* 02270F44 */ Gambit_fn_022DAC08(cpu);
-        /* 02270F48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270F4C */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270F48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270F4C */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270F4C */ _t16 = _t15 & 0x00000001u;
         /* 02270F4C */ if (_t16) goto L_02270F50; else goto L_02271044;
   L_02270F50: ; // 0x2270f50
@@ -18007,29 +18007,29 @@ void Gambit_fn_02270EF4(CPUState* cpu) {
         /* 02270F90 */ cpu->r[0] = rbrew_read32(cpu->mem, _t23);
         /* 02270F94 */ _t24 = cpu->r[10] + 0x0000002Cu;
         /* 02270F94 */ cpu->r[10] = rbrew_read32(cpu->mem, _t24);
-        /* 02270F98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[10]);
-        /* 02270F9C */ _t25 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02270F98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[10]));
+        /* 02270F9C */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02270F9C */ _t26 = _t25 & 0x00000001u;
         /* 02270F9C */ if (_t26) goto L_02270FA0; else goto L_02271008;
   L_02270FA0: ; // 0x2270fa0
         /* 02270FA0 */ _t27 = cpu->r[1] + 0x00000014u;
         /* 02270FA0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t27);
-        /* 02270FA4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[11], cpu->r[31]);
-        /* 02270FA8 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270FA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[11], cpu->r[31]));
+        /* 02270FA8 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270FA8 */ _t29 = _t28 & 0x00000001u;
         /* 02270FA8 */ if (_t29) goto L_02270FEC; else goto L_02270FAC;
   L_02270FAC: ; // 0x2270fac
         /* 02270FAC */ _t30 = cpu->r[11] + 0x00000064u;
         /* 02270FAC */ cpu->r[12] = rbrew_read32(cpu->mem, _t30);
-        /* 02270FB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02270FB4 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270FB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02270FB4 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270FB4 */ _t32 = _t31 & 0x00000001u;
         /* 02270FB4 */ if (_t32) goto L_02270FC8; else goto L_02270FB8;
   L_02270FB8: ; // 0x2270fb8
         /* 02270FB8 */ _t33 = cpu->r[12] + 0x00000048u;
         /* 02270FB8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t33);
-        /* 02270FBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 02270FC0 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270FBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 02270FC0 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270FC0 */ _t35 = _t34 & 0x00000001u;
         /* 02270FC0 */ if (_t35) goto L_02270FC4; else goto L_02270FC8;
   L_02270FC4: ; // 0x2270fc4
@@ -18042,8 +18042,8 @@ void Gambit_fn_02270EF4(CPUState* cpu) {
         /* 02270FD8 */ _t36 = cpu->r[12] + 0xFFFF909Cu;
         /* 02270FD8 */ cpu->f[13] = rbrew_read_f32(cpu->mem, _t36);
         /* 02270FDC */ cpu->f[13] = cpu->f[1] / cpu->f[13];
-        /* 02270FE0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[31]);
-        /* 02270FE4 */ _t37 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02270FE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[31]));
+        /* 02270FE4 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02270FE4 */ _t38 = _t37 & 0x00000001u;
         /* 02270FE4 */ if (_t38) goto L_02270FE8; else goto L_02270FEC;
   L_02270FE8: ; // 0x2270fe8
@@ -18057,8 +18057,8 @@ void Gambit_fn_02270EF4(CPUState* cpu) {
         /* 02270FF8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t40);
         /* 02270FFC */ _t41 = cpu->r[10] + 0x0000002Cu;
         /* 02270FFC */ cpu->r[0] = rbrew_read32(cpu->mem, _t41);
-        /* 02271000 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], cpu->r[0]);
-        /* 02271004 */ _t42 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02271000 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], cpu->r[0]));
+        /* 02271004 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02271004 */ _t43 = _t42 & 0x00000001u;
         /* 02271004 */ if (_t43) goto L_02270FA0; else goto L_02271008;
   L_02271008: ; // 0x2271008
@@ -18093,7 +18093,7 @@ void Gambit_fn_02270EF4(CPUState* cpu) {
         /* 02271050 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t52);
         /* 02271054 */ _t53 = cpu->r[1] + 0x00000024u;
         /* 02271054 */ cpu->r[31] = rbrew_read32(cpu->mem, _t53);
-        /* 02271058 */ _t54 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02271058 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02271058 */ _t55 = _t54 & 0x00000001u;
         /* 02271058 */ if (_t55) goto L_0227105C; // else: addr-0 trap, fall-through
   L_0227105C: ; // 0x227105c
@@ -18135,22 +18135,22 @@ void Gambit_fn_0227106C(CPUState* cpu) {
         /* 022710A4 */ Gambit_fn_0261F55C(cpu);
         /* 022710A8 */ _t7 = cpu->r[3] + 0x00000468u;
         /* 022710A8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t7);
-        /* 022710AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 022710B0 */ _t8 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022710AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 022710B0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022710B0 */ _t9 = _t8 & 0x00000001u;
         /* 022710B0 */ if (_t9) goto L_02271110; else goto L_022710B4;
   L_022710B4: ; // 0x22710b4
         /* 022710B4 */ _t10 = cpu->r[3] + 0x0000046Cu;
         /* 022710B4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 022710B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022710BC */ _t11 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022710B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022710BC */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022710BC */ _t12 = _t11 & 0x00000001u;
         /* 022710BC */ if (_t12) goto L_02271110; else goto L_022710C0;
   L_022710C0: ; // 0x22710c0
         /* 022710C0 */ _t13 = cpu->r[3] + 0x00000474u;
         /* 022710C0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t13);
-        /* 022710C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022710C8 */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022710C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022710C8 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022710C8 */ _t15 = _t14 & 0x00000001u;
         /* 022710C8 */ if (_t15) goto L_02271110; else goto L_022710CC;
   L_022710CC: ; // 0x22710cc
@@ -18161,32 +18161,32 @@ void Gambit_fn_0227106C(CPUState* cpu) {
         /* 022710D4 */ _t18 = cpu->r[8] + 0x0000026Cu;
         /* 022710D4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t18);
         /* 022710D8 */ Gambit_fn_022DABA8(cpu);
-        /* 022710DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022710E0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022710DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022710E0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022710E0 */ _t20 = _t19 & 0x00000001u;
         /* 022710E0 */ if (_t20) goto L_022710E4; else goto L_02271110;
   L_022710E4: ; // 0x22710e4
         /* 022710E4 */ _t21 = cpu->r[31] + 0x00000020u;
         /* 022710E4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
-        /* 022710E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000000Fu);
-        /* 022710EC */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022710E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000000Fu));
+        /* 022710EC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022710EC */ _t23 = _t22 & 0x00000001u;
         /* 022710EC */ if (_t23) goto L_022710F0; else goto L_02271130;
   L_022710F0: ; // 0x22710f0
-        /* 022710F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000000Bu);
-        /* 022710F4 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022710F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000000Bu));
+        /* 022710F4 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022710F4 */ _t25 = _t24 & 0x00000001u;
         /* 022710F4 */ if (_t25) goto L_02271110; else goto L_022710F8;
   L_022710F8: ; // 0x22710f8
-        /* 022710F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000000Du);
-        /* 022710FC */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022710F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000000Du));
+        /* 022710FC */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022710FC */ _t27 = _t26 & 0x00000001u;
         /* 022710FC */ if (_t27) goto L_02271110; else goto L_02271100;
   L_02271100: ; // 0x2271100
         /* 02271100 */ cpu->r[3] = cpu->r[31];
         /* 02271104 */ Gambit_fn_02270BE0(cpu);
-        /* 02271108 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0227110C */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271108 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0227110C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227110C */ _t29 = _t28 & 0x00000001u;
         /* 0227110C */ if (_t29) goto L_02271110; else goto L_02271158;
   L_02271110: ; // 0x2271110
@@ -18203,25 +18203,25 @@ void Gambit_fn_0227106C(CPUState* cpu) {
         /* 02271128 */ cpu->r[3] = 0x00000000u;
         /* 0227112C */ return;
   L_02271130: ; // 0x2271130
-        /* 02271130 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000000Fu);
-        /* 02271134 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271130 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000000Fu));
+        /* 02271134 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271134 */ _t35 = _t34 & 0x00000001u;
         /* 02271134 */ if (_t35) goto L_02271110; else goto L_02271138;
   L_02271138: ; // 0x2271138
-        /* 02271138 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000017u);
-        /* 0227113C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271138 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000017u));
+        /* 0227113C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227113C */ _t37 = _t36 & 0x00000001u;
         /* 0227113C */ if (_t37) goto L_02271110; else goto L_02271140;
   L_02271140: ; // 0x2271140
-        /* 02271140 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000001Fu);
-        /* 02271144 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271140 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000001Fu));
+        /* 02271144 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271144 */ _t39 = _t38 & 0x00000001u;
         /* 02271144 */ if (_t39) goto L_02271110; else goto L_02271148;
   L_02271148: ; // 0x2271148
         /* 02271148 */ cpu->r[3] = cpu->r[31];
         /* 0227114C */ Gambit_fn_02270BE0(cpu);
-        /* 02271150 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02271154 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271150 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02271154 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271154 */ _t41 = _t40 & 0x00000001u;
         /* 02271154 */ if (_t41) goto L_02271110; else goto L_02271158;
   L_02271158: ; // 0x2271158
@@ -18269,22 +18269,22 @@ void Gambit_fn_02271070(CPUState* cpu) {
         /* 022710A4 */ Gambit_fn_0261F55C(cpu);
         /* 022710A8 */ _t7 = cpu->r[3] + 0x00000468u;
         /* 022710A8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t7);
-        /* 022710AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 022710B0 */ _t8 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022710AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 022710B0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022710B0 */ _t9 = _t8 & 0x00000001u;
         /* 022710B0 */ if (_t9) goto L_02271110; else goto L_022710B4;
   L_022710B4: ; // 0x22710b4
         /* 022710B4 */ _t10 = cpu->r[3] + 0x0000046Cu;
         /* 022710B4 */ cpu->r[12] = rbrew_read32(cpu->mem, _t10);
-        /* 022710B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022710BC */ _t11 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022710B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022710BC */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022710BC */ _t12 = _t11 & 0x00000001u;
         /* 022710BC */ if (_t12) goto L_02271110; else goto L_022710C0;
   L_022710C0: ; // 0x22710c0
         /* 022710C0 */ _t13 = cpu->r[3] + 0x00000474u;
         /* 022710C0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t13);
-        /* 022710C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022710C8 */ _t14 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 022710C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022710C8 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 022710C8 */ _t15 = _t14 & 0x00000001u;
         /* 022710C8 */ if (_t15) goto L_02271110; else goto L_022710CC;
   L_022710CC: ; // 0x22710cc
@@ -18295,32 +18295,32 @@ void Gambit_fn_02271070(CPUState* cpu) {
         /* 022710D4 */ _t18 = cpu->r[8] + 0x0000026Cu;
         /* 022710D4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t18);
         /* 022710D8 */ Gambit_fn_022DABA8(cpu);
-        /* 022710DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022710E0 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022710DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022710E0 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022710E0 */ _t20 = _t19 & 0x00000001u;
         /* 022710E0 */ if (_t20) goto L_022710E4; else goto L_02271110;
   L_022710E4: ; // 0x22710e4
         /* 022710E4 */ _t21 = cpu->r[31] + 0x00000020u;
         /* 022710E4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t21);
-        /* 022710E8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000000Fu);
-        /* 022710EC */ _t22 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022710E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000000Fu));
+        /* 022710EC */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022710EC */ _t23 = _t22 & 0x00000001u;
         /* 022710EC */ if (_t23) goto L_022710F0; else goto L_02271130;
   L_022710F0: ; // 0x22710f0
-        /* 022710F0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000000Bu);
-        /* 022710F4 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022710F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000000Bu));
+        /* 022710F4 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022710F4 */ _t25 = _t24 & 0x00000001u;
         /* 022710F4 */ if (_t25) goto L_02271110; else goto L_022710F8;
   L_022710F8: ; // 0x22710f8
-        /* 022710F8 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000000Du);
-        /* 022710FC */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022710F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000000Du));
+        /* 022710FC */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022710FC */ _t27 = _t26 & 0x00000001u;
         /* 022710FC */ if (_t27) goto L_02271110; else goto L_02271100;
   L_02271100: ; // 0x2271100
         /* 02271100 */ cpu->r[3] = cpu->r[31];
         /* 02271104 */ Gambit_fn_02270BE0(cpu);
-        /* 02271108 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0227110C */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271108 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0227110C */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227110C */ _t29 = _t28 & 0x00000001u;
         /* 0227110C */ if (_t29) goto L_02271110; else goto L_02271158;
   L_02271110: ; // 0x2271110
@@ -18337,25 +18337,25 @@ void Gambit_fn_02271070(CPUState* cpu) {
         /* 02271128 */ cpu->r[3] = 0x00000000u;
         /* 0227112C */ return;
   L_02271130: ; // 0x2271130
-        /* 02271130 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000000Fu);
-        /* 02271134 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271130 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000000Fu));
+        /* 02271134 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271134 */ _t35 = _t34 & 0x00000001u;
         /* 02271134 */ if (_t35) goto L_02271110; else goto L_02271138;
   L_02271138: ; // 0x2271138
-        /* 02271138 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000017u);
-        /* 0227113C */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271138 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000017u));
+        /* 0227113C */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227113C */ _t37 = _t36 & 0x00000001u;
         /* 0227113C */ if (_t37) goto L_02271110; else goto L_02271140;
   L_02271140: ; // 0x2271140
-        /* 02271140 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x0000001Fu);
-        /* 02271144 */ _t38 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271140 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x0000001Fu));
+        /* 02271144 */ _t38 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271144 */ _t39 = _t38 & 0x00000001u;
         /* 02271144 */ if (_t39) goto L_02271110; else goto L_02271148;
   L_02271148: ; // 0x2271148
         /* 02271148 */ cpu->r[3] = cpu->r[31];
         /* 0227114C */ Gambit_fn_02270BE0(cpu);
-        /* 02271150 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02271154 */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271150 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02271154 */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271154 */ _t41 = _t40 & 0x00000001u;
         /* 02271154 */ if (_t41) goto L_02271110; else goto L_02271158;
   L_02271158: ; // 0x2271158
@@ -18386,8 +18386,8 @@ void Gambit_fn_02271178(CPUState* cpu) {
         /* 02271184 */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 02271184 */ cpu->r[1] = _t1;
         /* 02271188 */ Gambit_fn_02801A78(cpu);
-        /* 0227118C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02271190 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227118C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02271190 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271190 */ _t3 = _t2 & 0x00000001u;
         /* 02271190 */ if (_t3) goto L_02271198; else goto L_02271194;
   L_02271194: ; // 0x2271194
@@ -18409,8 +18409,8 @@ void Gambit_fn_02271184(CPUState* cpu) {
         /* 02271184 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 02271184 */ cpu->r[1] = _t0;
         /* 02271188 */ Gambit_fn_02801A78(cpu);
-        /* 0227118C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02271190 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227118C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02271190 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271190 */ _t2 = _t1 & 0x00000001u;
         /* 02271190 */ if (_t2) goto L_02271198; else goto L_02271194;
   L_02271194: ; // 0x2271194
@@ -18738,8 +18738,8 @@ void Gambit_fn_0227133C(CPUState* cpu) {
         /* 02271348 */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 02271348 */ cpu->r[1] = _t1;
         /* 0227134C */ Gambit_fn_02801A78(cpu);
-        /* 02271350 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02271354 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271350 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02271354 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271354 */ _t3 = _t2 & 0x00000001u;
         /* 02271354 */ if (_t3) goto L_0227135C; else goto L_02271358;
   L_02271358: ; // 0x2271358
@@ -18761,8 +18761,8 @@ void Gambit_fn_02271348(CPUState* cpu) {
         /* 02271348 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 02271348 */ cpu->r[1] = _t0;
         /* 0227134C */ Gambit_fn_02801A78(cpu);
-        /* 02271350 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02271354 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271350 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02271354 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271354 */ _t2 = _t1 & 0x00000001u;
         /* 02271354 */ if (_t2) goto L_0227135C; else goto L_02271358;
   L_02271358: ; // 0x2271358
@@ -18861,8 +18861,8 @@ void Gambit_fn_022713B8(CPUState* cpu) {
         /* 022713C0 */ cpu->r[11] = rbrew_read32(cpu->mem, _t2);
         /* 022713C4 */ _t3 = cpu->r[11] + 0x00000060u;
         /* 022713C4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 022713C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022713CC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022713C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022713CC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022713CC */ _t5 = _t4 & 0x00000001u;
         /* 022713CC */ _t6 = _t5 ^ 0x00000001u;
         /* 022713CC */ if (_t6) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -18910,8 +18910,8 @@ void Gambit_fn_02271414(CPUState* cpu) {
   L_02271414: ; // 0x2271414
         /* 02271414 */ _t0 = cpu->r[4] + 0x00000714u;
         /* 02271414 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
-        /* 02271418 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 0227141C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 0227141C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227141C */ _t2 = _t1 & 0x00000001u;
         /* 0227141C */ if (_t2) goto L_02271428; else goto L_02271420;
   L_02271420: ; // 0x2271420
@@ -18953,33 +18953,33 @@ void Gambit_fn_02271438(CPUState* cpu) {
         /* 0231A684 */ _t6 = cpu->r[1] + 0x0000002Cu;
         /* 0231A684 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 0231A688 */ cpu->r[31] = cpu->r[3];
-        /* 0231A688 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 0231A688 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0231A68C */ _t7 = cpu->r[1] + 0x00000008u;
         /* 0231A68C */ rbrew_write32(cpu->mem, _t7, cpu->r[28]);
         /* 0231A690 */ cpu->r[29] = cpu->r[4];
-        /* 0231A694 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231A694 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231A694 */ _t9 = _t8 & 0x00000001u;
         /* 0231A694 */ if (_t9) goto L_0231A698; else goto L_0231A6A8;
   L_0231A698: ; // 0x231a698
         /* 0231A698 */ cpu->r[3] = 0x000000F4u;
         /* 0231A69C */ Gambit_fn_02801A78(cpu);
         /* 0231A6A0 */ cpu->r[31] = cpu->r[3];
-        /* 0231A6A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0231A6A4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231A6A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0231A6A4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231A6A4 */ _t11 = _t10 & 0x00000001u;
         /* 0231A6A4 */ if (_t11) goto L_0231A938; else goto L_0231A6A8;
   L_0231A6A8: ; // 0x231a6a8
         /* 0231A6A8 */ cpu->r[3] = cpu->r[31];
-        /* 0231A6A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0231A6A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0231A6AC */ cpu->r[30] = 0x00000000u;
-        /* 0231A6B0 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231A6B0 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231A6B0 */ _t13 = _t12 & 0x00000001u;
         /* 0231A6B0 */ if (_t13) goto L_0231A6B4; else goto L_0231A6C4;
   L_0231A6B4: ; // 0x231a6b4
         /* 0231A6B4 */ cpu->r[3] = 0x00000008u;
         /* 0231A6B8 */ Gambit_fn_02801A78(cpu);
-        /* 0231A6BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0231A6C0 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231A6BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0231A6C0 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231A6C0 */ _t15 = _t14 & 0x00000001u;
         /* 0231A6C0 */ if (_t15) goto L_0231A6D4; else goto L_0231A6C4;
   L_0231A6C4: ; // 0x231a6c4
@@ -18993,17 +18993,17 @@ void Gambit_fn_02271438(CPUState* cpu) {
         /* 0231A6D4 */ cpu->r[7] = 0x10070000u;
         /* 0231A6D8 */ cpu->r[7] = cpu->r[7] + 0x00002FCCu;
         /* 0231A6DC */ cpu->r[3] = cpu->r[31] + 0x00000008u;
-        /* 0231A6DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0231A6DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0231A6E0 */ _t18 = cpu->r[31] + 0x00000004u;
         /* 0231A6E0 */ rbrew_write32(cpu->mem, _t18, cpu->r[7]);
-        /* 0231A6E4 */ _t19 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231A6E4 */ _t19 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231A6E4 */ _t20 = _t19 & 0x00000001u;
         /* 0231A6E4 */ if (_t20) goto L_0231A6E8; else goto L_0231A6F8;
   L_0231A6E8: ; // 0x231a6e8
         /* 0231A6E8 */ cpu->r[3] = 0x00000004u;
         /* 0231A6EC */ Gambit_fn_02801A78(cpu);
-        /* 0231A6F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0231A6F4 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231A6F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0231A6F4 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231A6F4 */ _t22 = _t21 & 0x00000001u;
         /* 0231A6F4 */ if (_t22) goto L_0231A6FC; else goto L_0231A6F8;
   L_0231A6F8: ; // 0x231a6f8
@@ -19011,15 +19011,15 @@ void Gambit_fn_02271438(CPUState* cpu) {
         /* 0231A6F8 */ rbrew_write32(cpu->mem, _t23, cpu->r[30]);
   L_0231A6FC: ; // 0x231a6fc
         /* 0231A6FC */ cpu->r[3] = cpu->r[31] + 0x0000000Cu;
-        /* 0231A6FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0231A700 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231A6FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0231A700 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231A700 */ _t25 = _t24 & 0x00000001u;
         /* 0231A700 */ if (_t25) goto L_0231A704; else goto L_0231A714;
   L_0231A704: ; // 0x231a704
         /* 0231A704 */ cpu->r[3] = 0x00000004u;
         /* 0231A708 */ Gambit_fn_02801A78(cpu);
-        /* 0231A70C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0231A710 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231A70C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0231A710 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231A710 */ _t27 = _t26 & 0x00000001u;
         /* 0231A710 */ if (_t27) goto L_0231A718; else goto L_0231A714;
   L_0231A714: ; // 0x231a714
@@ -19027,15 +19027,15 @@ void Gambit_fn_02271438(CPUState* cpu) {
         /* 0231A714 */ rbrew_write32(cpu->mem, _t28, cpu->r[30]);
   L_0231A718: ; // 0x231a718
         /* 0231A718 */ cpu->r[3] = cpu->r[31] + 0x00000010u;
-        /* 0231A718 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0231A71C */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231A718 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0231A71C */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231A71C */ _t30 = _t29 & 0x00000001u;
         /* 0231A71C */ if (_t30) goto L_0231A720; else goto L_0231A730;
   L_0231A720: ; // 0x231a720
         /* 0231A720 */ cpu->r[3] = 0x00000004u;
         /* 0231A724 */ Gambit_fn_02801A78(cpu);
-        /* 0231A728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0231A72C */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231A728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0231A72C */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231A72C */ _t32 = _t31 & 0x00000001u;
         /* 0231A72C */ if (_t32) goto L_0231A734; else goto L_0231A730;
   L_0231A730: ; // 0x231a730
@@ -19048,31 +19048,31 @@ void Gambit_fn_02271438(CPUState* cpu) {
         /* 0231A73C */ _t35 = cpu->r[31] + 0x00000014u;
         /* 0231A73C */ rbrew_write32(cpu->mem, _t35, cpu->r[29]);
         /* 0231A740 */ cpu->r[28] = cpu->r[31] + 0x0000001Cu;
-        /* 0231A740 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 0231A740 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 0231A744 */ _t36 = cpu->r[10] + 0x0000305Cu;
         /* 0231A744 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t36);
-        /* 0231A748 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231A748 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231A748 */ _t38 = _t37 & 0x00000001u;
         /* 0231A748 */ if (_t38) goto L_0231A74C; else goto L_0231A75C;
   L_0231A74C: ; // 0x231a74c
         /* 0231A74C */ cpu->r[3] = 0x00000018u;
         /* 0231A750 */ Gambit_fn_02801A78(cpu);
         /* 0231A754 */ cpu->r[28] = cpu->r[3];
-        /* 0231A754 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 0231A758 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231A754 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 0231A758 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231A758 */ _t40 = _t39 & 0x00000001u;
         /* 0231A758 */ if (_t40) goto L_0231A7A4; else goto L_0231A75C;
   L_0231A75C: ; // 0x231a75c
         /* 0231A75C */ cpu->r[3] = cpu->r[28];
-        /* 0231A75C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0231A760 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231A75C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0231A760 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231A760 */ _t42 = _t41 & 0x00000001u;
         /* 0231A760 */ if (_t42) goto L_0231A764; else goto L_0231A774;
   L_0231A764: ; // 0x231a764
         /* 0231A764 */ cpu->r[3] = 0x0000000Cu;
         /* 0231A768 */ Gambit_fn_02801A78(cpu);
-        /* 0231A76C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0231A770 */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231A76C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0231A770 */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231A770 */ _t44 = _t43 & 0x00000001u;
         /* 0231A770 */ if (_t44) goto L_0231A780; else goto L_0231A774;
   L_0231A774: ; // 0x231a774
@@ -19084,15 +19084,15 @@ void Gambit_fn_02271438(CPUState* cpu) {
         /* 0231A77C */ rbrew_write_f32(cpu->mem, _t47, cpu->f[31]);
   L_0231A780: ; // 0x231a780
         /* 0231A780 */ cpu->r[3] = cpu->r[28] + 0x0000000Cu;
-        /* 0231A780 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0231A784 */ _t48 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231A780 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0231A784 */ _t48 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231A784 */ _t49 = _t48 & 0x00000001u;
         /* 0231A784 */ if (_t49) goto L_0231A788; else goto L_0231A798;
   L_0231A788: ; // 0x231a788
         /* 0231A788 */ cpu->r[3] = 0x0000000Cu;
         /* 0231A78C */ Gambit_fn_02801A78(cpu);
-        /* 0231A790 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0231A794 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231A790 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0231A794 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231A794 */ _t51 = _t50 & 0x00000001u;
         /* 0231A794 */ if (_t51) goto L_0231A7A4; else goto L_0231A798;
   L_0231A798: ; // 0x231a798
@@ -19124,31 +19124,31 @@ void Gambit_fn_02271438(CPUState* cpu) {
         /* 0231A7C8 */ _t63 = cpu->r[31] + 0x00000048u;
         /* 0231A7C8 */ rbrew_write32(cpu->mem, _t63, cpu->r[30]);
         /* 0231A7CC */ cpu->r[28] = cpu->r[31] + 0x00000050u;
-        /* 0231A7CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
+        /* 0231A7CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
         /* 0231A7D0 */ _t64 = cpu->r[31] + 0x0000004Cu;
         /* 0231A7D0 */ rbrew_write32(cpu->mem, _t64, cpu->r[30]);
-        /* 0231A7D4 */ _t65 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231A7D4 */ _t65 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231A7D4 */ _t66 = _t65 & 0x00000001u;
         /* 0231A7D4 */ if (_t66) goto L_0231A7D8; else goto L_0231A7E8;
   L_0231A7D8: ; // 0x231a7d8
         /* 0231A7D8 */ cpu->r[3] = 0x00000018u;
         /* 0231A7DC */ Gambit_fn_02801A78(cpu);
         /* 0231A7E0 */ cpu->r[28] = cpu->r[3];
-        /* 0231A7E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 0231A7E4 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231A7E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 0231A7E4 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231A7E4 */ _t68 = _t67 & 0x00000001u;
         /* 0231A7E4 */ if (_t68) goto L_0231A830; else goto L_0231A7E8;
   L_0231A7E8: ; // 0x231a7e8
         /* 0231A7E8 */ cpu->r[3] = cpu->r[28];
-        /* 0231A7E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0231A7EC */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231A7E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0231A7EC */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231A7EC */ _t70 = _t69 & 0x00000001u;
         /* 0231A7EC */ if (_t70) goto L_0231A7F0; else goto L_0231A800;
   L_0231A7F0: ; // 0x231a7f0
         /* 0231A7F0 */ cpu->r[3] = 0x0000000Cu;
         /* 0231A7F4 */ Gambit_fn_02801A78(cpu);
-        /* 0231A7F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0231A7FC */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231A7F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0231A7FC */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231A7FC */ _t72 = _t71 & 0x00000001u;
         /* 0231A7FC */ if (_t72) goto L_0231A80C; else goto L_0231A800;
   L_0231A800: ; // 0x231a800
@@ -19160,15 +19160,15 @@ void Gambit_fn_02271438(CPUState* cpu) {
         /* 0231A808 */ rbrew_write_f32(cpu->mem, _t75, cpu->f[31]);
   L_0231A80C: ; // 0x231a80c
         /* 0231A80C */ cpu->r[3] = cpu->r[28] + 0x0000000Cu;
-        /* 0231A80C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0231A810 */ _t76 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231A80C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0231A810 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231A810 */ _t77 = _t76 & 0x00000001u;
         /* 0231A810 */ if (_t77) goto L_0231A814; else goto L_0231A824;
   L_0231A814: ; // 0x231a814
         /* 0231A814 */ cpu->r[3] = 0x0000000Cu;
         /* 0231A818 */ Gambit_fn_02801A78(cpu);
-        /* 0231A81C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0231A820 */ _t78 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231A81C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0231A820 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231A820 */ _t79 = _t78 & 0x00000001u;
         /* 0231A820 */ if (_t79) goto L_0231A830; else goto L_0231A824;
   L_0231A824: ; // 0x231a824
@@ -19190,10 +19190,10 @@ void Gambit_fn_02271438(CPUState* cpu) {
         /* 0231A840 */ _t87 = cpu->r[29] + 0x00000008u;
         /* 0231A840 */ cpu->r[0] = rbrew_read32(cpu->mem, _t87);
         /* 0231A844 */ cpu->r[12] = cpu->r[31] + 0x00000074u;
-        /* 0231A844 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 0231A844 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0231A848 */ _t88 = cpu->r[31] + 0x00000070u;
         /* 0231A848 */ rbrew_write32(cpu->mem, _t88, cpu->r[0]);
-        /* 0231A84C */ _t89 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231A84C */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231A84C */ _t90 = _t89 & 0x00000001u;
         /* 0231A84C */ if (_t90) goto L_0231A850; else goto L_0231A858;
   L_0231A850: ; // 0x231a850
@@ -19322,7 +19322,7 @@ void Gambit_fn_02271438(CPUState* cpu) {
         /* 0231A94C */ cpu->r[3] = cpu->r[31];
         /* 0231A950 */ _t146 = cpu->r[1] + 0x00000014u;
         /* 0231A950 */ cpu->r[31] = rbrew_read32(cpu->mem, _t146);
-        /* 0231A954 */ _t147 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0231A954 */ _t147 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0231A954 */ _t148 = _t147 & 0x00000001u;
         /* 0231A954 */ if (_t148) goto L_0231A958; // else: addr-0 trap, fall-through
   L_0231A958: ; // 0x231a958
@@ -19340,8 +19340,8 @@ void Gambit_fn_02271444(CPUState* cpu) {
   L_02271444: ; // 0x2271444
         /* 02271444 */ _t0 = cpu->r[3] + 0x00000070u;
         /* 02271444 */ cpu->r[3] = rbrew_read32(cpu->mem, _t0);
-        /* 02271448 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0227144C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271448 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0227144C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227144C */ _t2 = _t1 & 0x00000001u;
         /* 0227144C */ if (_t2) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0227144C */ goto L_02271450;
@@ -19413,8 +19413,8 @@ void Gambit_fn_02271444(CPUState* cpu) {
   L_0231A9E0: ; // 0x231a9e0
         /* 0231A9E0 */ _t22 = cpu->r[3] + 0x00000018u;
         /* 0231A9E0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t22);
-        /* 0231A9E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0231A9E8 */ _t23 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0231A9E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0231A9E8 */ _t23 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0231A9E8 */ _t24 = _t23 & 0x00000001u;
         /* 0231A9E8 */ if (_t24) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0231A9E8 */ goto L_0231A9EC;
@@ -19445,9 +19445,9 @@ void Gambit_fn_02271484(CPUState* cpu) {
         /* 022714A8 */ cpu->r[23] = 0x101D0000u;
         /* 022714AC */ cpu->r[27] = cpu->r[3];
         /* 022714B0 */ cpu->r[25] = 0x10060000u;
-        /* 022714B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 022714B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 022714B8 */ cpu->r[25] = cpu->r[25] + 0xFFFF9008u;
-        /* 022714BC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022714BC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022714BC */ _t5 = _t4 & 0x00000001u;
         /* 022714BC */ if (_t5) goto L_022714C0; else goto L_022714CC;
   L_022714C0: ; // 0x22714c0
@@ -19457,8 +19457,8 @@ void Gambit_fn_02271484(CPUState* cpu) {
         /* 022714C8 */ _t7 = cpu->r[22] + 0x00000000u;
         /* 022714C8 */ rbrew_write32(cpu->mem, _t7, cpu->r[7]);
   L_022714CC: ; // 0x22714cc
-        /* 022714CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[27], 0x00000000u);
-        /* 022714D0 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022714CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[27], 0x00000000u));
+        /* 022714D0 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022714D0 */ _t9 = _t8 & 0x00000001u;
         /* 022714D0 */ if (_t9) goto L_02271518; else goto L_022714D4;
   L_022714D4: ; // 0x22714d4
@@ -19470,10 +19470,10 @@ void Gambit_fn_02271484(CPUState* cpu) {
         /* 022714E0 */ cpu->r[3] = cpu->r[27];
         /* 022714E4 */ cpu->r[4] = cpu->r[23] + 0xFFFFFFE8u;
         /* 022714E8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 022714EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 022714EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 022714F0 */ _t12 = cpu->r[22] + 0x00000000u;
         /* 022714F0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t12);
-        /* 022714F4 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022714F4 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022714F4 */ _t14 = _t13 & 0x00000001u;
         /* 022714F4 */ if (_t14) goto L_022714F8; else goto L_02271500;
   L_022714F8: ; // 0x22714f8
@@ -19482,9 +19482,9 @@ void Gambit_fn_02271484(CPUState* cpu) {
   L_02271500: ; // 0x2271500
         /* 02271500 */ cpu->r[3] = cpu->r[26];
         /* 02271504 */ Gambit_fn_0226ED34(cpu);
-        /* 02271508 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02271508 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0227150C */ cpu->r[30] = cpu->r[3];
-        /* 02271510 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271510 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271510 */ _t16 = _t15 & 0x00000001u;
         /* 02271510 */ if (_t16) goto L_02271514; else goto L_0227153C;
   L_02271514: ; // 0x2271514
@@ -19494,9 +19494,9 @@ void Gambit_fn_02271484(CPUState* cpu) {
   L_0227151C: ; // 0x227151c
         /* 0227151C */ cpu->r[3] = cpu->r[26];
         /* 02271520 */ Gambit_fn_0226ED34(cpu);
-        /* 02271524 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02271524 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02271528 */ cpu->r[30] = cpu->r[3];
-        /* 0227152C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227152C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227152C */ _t18 = _t17 & 0x00000001u;
         /* 0227152C */ if (_t18) goto L_02271530; else goto L_0227153C;
   L_02271530: ; // 0x2271530
@@ -19506,8 +19506,8 @@ void Gambit_fn_02271484(CPUState* cpu) {
         /* 02271538 */ _t20 = cpu->r[22] + 0x00000000u;
         /* 02271538 */ rbrew_write32(cpu->mem, _t20, cpu->r[7]);
   L_0227153C: ; // 0x227153c
-        /* 0227153C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 02271540 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227153C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 02271540 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271540 */ _t22 = _t21 & 0x00000001u;
         /* 02271540 */ if (_t22) goto L_02271588; else goto L_02271544;
   L_02271544: ; // 0x2271544
@@ -19519,10 +19519,10 @@ void Gambit_fn_02271484(CPUState* cpu) {
         /* 02271550 */ cpu->r[3] = cpu->r[30];
         /* 02271554 */ cpu->r[4] = cpu->r[23] + 0xFFFFFFE8u;
         /* 02271558 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0227155C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0227155C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02271560 */ _t25 = cpu->r[22] + 0x00000000u;
         /* 02271560 */ cpu->r[7] = rbrew_read32(cpu->mem, _t25);
-        /* 02271564 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271564 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271564 */ _t27 = _t26 & 0x00000001u;
         /* 02271564 */ if (_t27) goto L_02271568; else goto L_02271570;
   L_02271568: ; // 0x2271568
@@ -19531,9 +19531,9 @@ void Gambit_fn_02271484(CPUState* cpu) {
   L_02271570: ; // 0x2271570
         /* 02271570 */ cpu->r[3] = cpu->r[26];
         /* 02271574 */ Gambit_fn_0226ED34(cpu);
-        /* 02271578 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02271578 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0227157C */ cpu->r[28] = cpu->r[3];
-        /* 02271580 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271580 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271580 */ _t29 = _t28 & 0x00000001u;
         /* 02271580 */ if (_t29) goto L_02271584; else goto L_022715AC;
   L_02271584: ; // 0x2271584
@@ -19543,9 +19543,9 @@ void Gambit_fn_02271484(CPUState* cpu) {
   L_0227158C: ; // 0x227158c
         /* 0227158C */ cpu->r[3] = cpu->r[26];
         /* 02271590 */ Gambit_fn_0226ED34(cpu);
-        /* 02271594 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02271594 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02271598 */ cpu->r[28] = cpu->r[3];
-        /* 0227159C */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227159C */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227159C */ _t31 = _t30 & 0x00000001u;
         /* 0227159C */ if (_t31) goto L_022715A0; else goto L_022715AC;
   L_022715A0: ; // 0x22715a0
@@ -19555,8 +19555,8 @@ void Gambit_fn_02271484(CPUState* cpu) {
         /* 022715A8 */ _t33 = cpu->r[22] + 0x00000000u;
         /* 022715A8 */ rbrew_write32(cpu->mem, _t33, cpu->r[7]);
   L_022715AC: ; // 0x22715ac
-        /* 022715AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[28], 0x00000000u);
-        /* 022715B0 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022715AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[28], 0x00000000u));
+        /* 022715B0 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022715B0 */ _t35 = _t34 & 0x00000001u;
         /* 022715B0 */ if (_t35) goto L_022715F8; else goto L_022715B4;
   L_022715B4: ; // 0x22715b4
@@ -19568,10 +19568,10 @@ void Gambit_fn_02271484(CPUState* cpu) {
         /* 022715C0 */ cpu->r[3] = cpu->r[28];
         /* 022715C4 */ cpu->r[4] = cpu->r[23] + 0xFFFFFFE8u;
         /* 022715C8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 022715CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 022715CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 022715D0 */ _t38 = cpu->r[22] + 0x00000000u;
         /* 022715D0 */ cpu->r[7] = rbrew_read32(cpu->mem, _t38);
-        /* 022715D4 */ _t39 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022715D4 */ _t39 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022715D4 */ _t40 = _t39 & 0x00000001u;
         /* 022715D4 */ if (_t40) goto L_022715D8; else goto L_022715E0;
   L_022715D8: ; // 0x22715d8
@@ -19580,9 +19580,9 @@ void Gambit_fn_02271484(CPUState* cpu) {
   L_022715E0: ; // 0x22715e0
         /* 022715E0 */ cpu->r[3] = cpu->r[26];
         /* 022715E4 */ Gambit_fn_0226ED34(cpu);
-        /* 022715E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 022715E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 022715EC */ cpu->r[31] = cpu->r[3];
-        /* 022715F0 */ _t41 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022715F0 */ _t41 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022715F0 */ _t42 = _t41 & 0x00000001u;
         /* 022715F0 */ if (_t42) goto L_022715F4; else goto L_0227161C;
   L_022715F4: ; // 0x22715f4
@@ -19592,9 +19592,9 @@ void Gambit_fn_02271484(CPUState* cpu) {
   L_022715FC: ; // 0x22715fc
         /* 022715FC */ cpu->r[3] = cpu->r[26];
         /* 02271600 */ Gambit_fn_0226ED34(cpu);
-        /* 02271604 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02271604 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02271608 */ cpu->r[31] = cpu->r[3];
-        /* 0227160C */ _t43 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227160C */ _t43 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227160C */ _t44 = _t43 & 0x00000001u;
         /* 0227160C */ if (_t44) goto L_02271610; else goto L_0227161C;
   L_02271610: ; // 0x2271610
@@ -19604,8 +19604,8 @@ void Gambit_fn_02271484(CPUState* cpu) {
         /* 02271618 */ _t46 = cpu->r[22] + 0x00000000u;
         /* 02271618 */ rbrew_write32(cpu->mem, _t46, cpu->r[7]);
   L_0227161C: ; // 0x227161c
-        /* 0227161C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02271620 */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227161C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02271620 */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271620 */ _t48 = _t47 & 0x00000001u;
         /* 02271620 */ if (_t48) goto L_02271668; else goto L_02271624;
   L_02271624: ; // 0x2271624
@@ -19617,10 +19617,10 @@ void Gambit_fn_02271484(CPUState* cpu) {
         /* 02271630 */ cpu->r[3] = cpu->r[31];
         /* 02271634 */ cpu->r[4] = cpu->r[23] + 0xFFFFFFE8u;
         /* 02271638 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0227163C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0227163C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02271640 */ _t51 = cpu->r[22] + 0x00000000u;
         /* 02271640 */ cpu->r[7] = rbrew_read32(cpu->mem, _t51);
-        /* 02271644 */ _t52 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271644 */ _t52 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271644 */ _t53 = _t52 & 0x00000001u;
         /* 02271644 */ if (_t53) goto L_02271648; else goto L_02271650;
   L_02271648: ; // 0x2271648
@@ -19629,9 +19629,9 @@ void Gambit_fn_02271484(CPUState* cpu) {
   L_02271650: ; // 0x2271650
         /* 02271650 */ cpu->r[3] = cpu->r[26];
         /* 02271654 */ Gambit_fn_0226ED34(cpu);
-        /* 02271658 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02271658 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 0227165C */ cpu->r[29] = cpu->r[3];
-        /* 02271660 */ _t54 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271660 */ _t54 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271660 */ _t55 = _t54 & 0x00000001u;
         /* 02271660 */ if (_t55) goto L_02271664; else goto L_0227168C;
   L_02271664: ; // 0x2271664
@@ -19641,9 +19641,9 @@ void Gambit_fn_02271484(CPUState* cpu) {
   L_0227166C: ; // 0x227166c
         /* 0227166C */ cpu->r[3] = cpu->r[26];
         /* 02271670 */ Gambit_fn_0226ED34(cpu);
-        /* 02271674 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02271674 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02271678 */ cpu->r[29] = cpu->r[3];
-        /* 0227167C */ _t56 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227167C */ _t56 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227167C */ _t57 = _t56 & 0x00000001u;
         /* 0227167C */ if (_t57) goto L_02271680; else goto L_0227168C;
   L_02271680: ; // 0x2271680
@@ -19653,8 +19653,8 @@ void Gambit_fn_02271484(CPUState* cpu) {
         /* 02271688 */ _t59 = cpu->r[22] + 0x00000000u;
         /* 02271688 */ rbrew_write32(cpu->mem, _t59, cpu->r[9]);
   L_0227168C: ; // 0x227168c
-        /* 0227168C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02271690 */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227168C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02271690 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271690 */ _t61 = _t60 & 0x00000001u;
         /* 02271690 */ if (_t61) goto L_022716B4; else goto L_02271694;
   L_02271694: ; // 0x2271694
@@ -19666,8 +19666,8 @@ void Gambit_fn_02271484(CPUState* cpu) {
         /* 022716A0 */ cpu->r[3] = cpu->r[29];
         /* 022716A4 */ cpu->r[4] = cpu->r[23] + 0xFFFFFFE8u;
         /* 022716A8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 022716AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022716B0 */ _t64 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022716AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022716B0 */ _t64 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022716B0 */ _t65 = _t64 & 0x00000001u;
         /* 022716B0 */ if (_t65) goto L_022716B4; else goto L_022716B8;
   L_022716B4: ; // 0x22716b4
@@ -19712,10 +19712,10 @@ void Gambit_fn_02271708(CPUState* cpu) {
         /* 0227170C */ cpu->r[11] = rbrew_read32(cpu->mem, _t1);
         /* 02271710 */ _t2 = cpu->r[11] + 0x00000010u;
         /* 02271710 */ cpu->r[0] = rbrew_read32(cpu->mem, _t2);
-        /* 02271714 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[0]);
+        /* 02271714 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[0]));
         /* 02271718 */ _t3 = cpu->r[11] + 0x00000014u;
         /* 02271718 */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
-        /* 0227171C */ _t4 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0227171C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0227171C */ _t5 = _t4 & 0x00000001u;
         /* 0227171C */ if (_t5) goto L_02271720; else goto L_02271728;
   L_02271720: ; // 0x2271720
@@ -19754,9 +19754,9 @@ void Gambit_fn_02271730(CPUState* cpu) {
         /* 0227175C */ cpu->r[11] = _t5;
         /* 02271760 */ cpu->r[4] = 0x101D0000u;
         /* 02271764 */ cpu->r[31] = cpu->r[3];
-        /* 02271768 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02271768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0227176C */ cpu->r[4] = cpu->r[4] + 0xFFFFFFE8u;
-        /* 02271770 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271770 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271770 */ _t7 = _t6 & 0x00000001u;
         /* 02271770 */ if (_t7) goto L_02271774; else goto L_02271788;
   L_02271774: ; // 0x2271774
@@ -19768,8 +19768,8 @@ void Gambit_fn_02271730(CPUState* cpu) {
         /* 02271784 */ _t9 = cpu->r[4] + 0x00000000u;
         /* 02271784 */ rbrew_write32(cpu->mem, _t9, cpu->r[0]);
   L_02271788: ; // 0x2271788
-        /* 02271788 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0227178C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271788 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0227178C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227178C */ _t11 = _t10 & 0x00000001u;
         /* 0227178C */ if (_t11) goto L_022717AC; else goto L_02271790;
   L_02271790: ; // 0x2271790
@@ -19780,8 +19780,8 @@ void Gambit_fn_02271730(CPUState* cpu) {
         /* 02271798 */ cpu->ctr = cpu->r[11];
         /* 0227179C */ cpu->r[3] = cpu->r[31];
         /* 022717A0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 022717A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022717A8 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022717A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022717A8 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022717A8 */ _t15 = _t14 & 0x00000001u;
         /* 022717A8 */ if (_t15) goto L_022717AC; else goto L_022717B0;
   L_022717AC: ; // 0x22717ac
@@ -19871,9 +19871,9 @@ void Gambit_fn_02271734(CPUState* cpu) {
         /* 0227175C */ cpu->r[11] = _t5;
         /* 02271760 */ cpu->r[4] = 0x101D0000u;
         /* 02271764 */ cpu->r[31] = cpu->r[3];
-        /* 02271768 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02271768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0227176C */ cpu->r[4] = cpu->r[4] + 0xFFFFFFE8u;
-        /* 02271770 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271770 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271770 */ _t7 = _t6 & 0x00000001u;
         /* 02271770 */ if (_t7) goto L_02271774; else goto L_02271788;
   L_02271774: ; // 0x2271774
@@ -19885,8 +19885,8 @@ void Gambit_fn_02271734(CPUState* cpu) {
         /* 02271784 */ _t9 = cpu->r[4] + 0x00000000u;
         /* 02271784 */ rbrew_write32(cpu->mem, _t9, cpu->r[0]);
   L_02271788: ; // 0x2271788
-        /* 02271788 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0227178C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271788 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0227178C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227178C */ _t11 = _t10 & 0x00000001u;
         /* 0227178C */ if (_t11) goto L_022717AC; else goto L_02271790;
   L_02271790: ; // 0x2271790
@@ -19897,8 +19897,8 @@ void Gambit_fn_02271734(CPUState* cpu) {
         /* 02271798 */ cpu->ctr = cpu->r[11];
         /* 0227179C */ cpu->r[3] = cpu->r[31];
         /* 022717A0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 022717A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022717A8 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022717A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022717A8 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022717A8 */ _t15 = _t14 & 0x00000001u;
         /* 022717A8 */ if (_t15) goto L_022717AC; else goto L_022717B0;
   L_022717AC: ; // 0x22717ac
@@ -19976,32 +19976,32 @@ void Gambit_fn_02271838(CPUState* cpu) {
         /* 022465C0 */ _t2 = cpu->r[1] + 0x0000000Cu;
         /* 022465C0 */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
         /* 022465C4 */ cpu->r[31] = cpu->r[3];
-        /* 022465C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 022465C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 022465C8 */ cpu->r[30] = cpu->r[4];
         /* 022465CC */ _t3 = cpu->r[1] + 0x00000014u;
         /* 022465CC */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 022465D0 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022465D0 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022465D0 */ _t5 = _t4 & 0x00000001u;
         /* 022465D0 */ if (_t5) goto L_022465D4; else goto L_022465E4;
   L_022465D4: ; // 0x22465d4
         /* 022465D4 */ cpu->r[3] = 0x00000018u;
         /* 022465D8 */ Gambit_fn_02801A78(cpu);
         /* 022465DC */ cpu->r[31] = cpu->r[3];
-        /* 022465DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022465E0 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022465DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022465E0 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022465E0 */ _t7 = _t6 & 0x00000001u;
         /* 022465E0 */ if (_t7) goto L_0224663C; else goto L_022465E4;
   L_022465E4: ; // 0x22465e4
         /* 022465E4 */ cpu->r[3] = cpu->r[31];
-        /* 022465E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022465E8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022465E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022465E8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022465E8 */ _t9 = _t8 & 0x00000001u;
         /* 022465E8 */ if (_t9) goto L_022465EC; else goto L_022465FC;
   L_022465EC: ; // 0x22465ec
         /* 022465EC */ cpu->r[3] = 0x00000008u;
         /* 022465F0 */ Gambit_fn_02801A78(cpu);
-        /* 022465F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022465F8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022465F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022465F8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022465F8 */ _t11 = _t10 & 0x00000001u;
         /* 022465F8 */ if (_t11) goto L_02246610; else goto L_022465FC;
   L_022465FC: ; // 0x22465fc
@@ -20064,32 +20064,32 @@ void Gambit_fn_02271844(CPUState* cpu) {
         /* 02246744 */ _t2 = cpu->r[1] + 0x0000000Cu;
         /* 02246744 */ rbrew_write32(cpu->mem, _t2, cpu->r[31]);
         /* 02246748 */ cpu->r[31] = cpu->r[3];
-        /* 02246748 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02246748 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0224674C */ cpu->r[30] = cpu->r[4];
         /* 02246750 */ _t3 = cpu->r[1] + 0x00000014u;
         /* 02246750 */ rbrew_write32(cpu->mem, _t3, cpu->r[0]);
-        /* 02246754 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02246754 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02246754 */ _t5 = _t4 & 0x00000001u;
         /* 02246754 */ if (_t5) goto L_02246758; else goto L_02246768;
   L_02246758: ; // 0x2246758
         /* 02246758 */ cpu->r[3] = 0x0000000Cu;
         /* 0224675C */ Gambit_fn_02801A78(cpu);
         /* 02246760 */ cpu->r[31] = cpu->r[3];
-        /* 02246760 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02246764 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02246760 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02246764 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02246764 */ _t7 = _t6 & 0x00000001u;
         /* 02246764 */ if (_t7) goto L_022467A4; else goto L_02246768;
   L_02246768: ; // 0x2246768
         /* 02246768 */ cpu->r[3] = cpu->r[31];
-        /* 02246768 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0224676C */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02246768 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0224676C */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0224676C */ _t9 = _t8 & 0x00000001u;
         /* 0224676C */ if (_t9) goto L_02246770; else goto L_02246780;
   L_02246770: ; // 0x2246770
         /* 02246770 */ cpu->r[3] = 0x00000008u;
         /* 02246774 */ Gambit_fn_02801A78(cpu);
-        /* 02246778 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0224677C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02246778 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0224677C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0224677C */ _t11 = _t10 & 0x00000001u;
         /* 0224677C */ if (_t11) goto L_02246794; else goto L_02246780;
   L_02246780: ; // 0x2246780
@@ -20149,9 +20149,9 @@ void Gambit_fn_02271850(CPUState* cpu) {
         /* 02271874 */ cpu->r[7] = _t5;
         /* 02271878 */ cpu->r[4] = 0x101D0000u;
         /* 0227187C */ cpu->r[31] = cpu->r[3];
-        /* 02271880 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02271880 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02271884 */ cpu->r[4] = cpu->r[4] + 0xFFFFFFE8u;
-        /* 02271888 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271888 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271888 */ _t7 = _t6 & 0x00000001u;
         /* 02271888 */ if (_t7) goto L_0227188C; else goto L_022718A0;
   L_0227188C: ; // 0x227188c
@@ -20163,8 +20163,8 @@ void Gambit_fn_02271850(CPUState* cpu) {
         /* 0227189C */ _t9 = cpu->r[4] + 0x00000000u;
         /* 0227189C */ rbrew_write32(cpu->mem, _t9, cpu->r[8]);
   L_022718A0: ; // 0x22718a0
-        /* 022718A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022718A4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022718A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022718A4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022718A4 */ _t11 = _t10 & 0x00000001u;
         /* 022718A4 */ if (_t11) goto L_022718C4; else goto L_022718A8;
   L_022718A8: ; // 0x22718a8
@@ -20175,8 +20175,8 @@ void Gambit_fn_02271850(CPUState* cpu) {
         /* 022718B0 */ cpu->ctr = cpu->r[11];
         /* 022718B4 */ cpu->r[3] = cpu->r[31];
         /* 022718B8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 022718BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022718C0 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022718BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022718C0 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022718C0 */ _t15 = _t14 & 0x00000001u;
         /* 022718C0 */ if (_t15) goto L_022718C4; else goto L_022718C8;
   L_022718C4: ; // 0x22718c4
@@ -20185,8 +20185,8 @@ void Gambit_fn_02271850(CPUState* cpu) {
         /* 022718C8 */ cpu->r[3] = 0x00000020u;
         /* 022718CC */ Gambit_fn_02801A78(cpu);
         /* 022718D0 */ cpu->r[30] = cpu->r[3];
-        /* 022718D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 022718D4 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022718D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 022718D4 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022718D4 */ _t17 = _t16 & 0x00000001u;
         /* 022718D4 */ if (_t17) goto L_022718F4; else goto L_022718D8;
   L_022718D8: ; // 0x22718d8
@@ -20238,9 +20238,9 @@ void Gambit_fn_02271854(CPUState* cpu) {
         /* 02271874 */ cpu->r[7] = _t5;
         /* 02271878 */ cpu->r[4] = 0x101D0000u;
         /* 0227187C */ cpu->r[31] = cpu->r[3];
-        /* 02271880 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02271880 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02271884 */ cpu->r[4] = cpu->r[4] + 0xFFFFFFE8u;
-        /* 02271888 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271888 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271888 */ _t7 = _t6 & 0x00000001u;
         /* 02271888 */ if (_t7) goto L_0227188C; else goto L_022718A0;
   L_0227188C: ; // 0x227188c
@@ -20252,8 +20252,8 @@ void Gambit_fn_02271854(CPUState* cpu) {
         /* 0227189C */ _t9 = cpu->r[4] + 0x00000000u;
         /* 0227189C */ rbrew_write32(cpu->mem, _t9, cpu->r[8]);
   L_022718A0: ; // 0x22718a0
-        /* 022718A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022718A4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022718A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022718A4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022718A4 */ _t11 = _t10 & 0x00000001u;
         /* 022718A4 */ if (_t11) goto L_022718C4; else goto L_022718A8;
   L_022718A8: ; // 0x22718a8
@@ -20264,8 +20264,8 @@ void Gambit_fn_02271854(CPUState* cpu) {
         /* 022718B0 */ cpu->ctr = cpu->r[11];
         /* 022718B4 */ cpu->r[3] = cpu->r[31];
         /* 022718B8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 022718BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022718C0 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022718BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022718C0 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022718C0 */ _t15 = _t14 & 0x00000001u;
         /* 022718C0 */ if (_t15) goto L_022718C4; else goto L_022718C8;
   L_022718C4: ; // 0x22718c4
@@ -20274,8 +20274,8 @@ void Gambit_fn_02271854(CPUState* cpu) {
         /* 022718C8 */ cpu->r[3] = 0x00000020u;
         /* 022718CC */ Gambit_fn_02801A78(cpu);
         /* 022718D0 */ cpu->r[30] = cpu->r[3];
-        /* 022718D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[30], 0x00000000u);
-        /* 022718D4 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022718D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[30], 0x00000000u));
+        /* 022718D4 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022718D4 */ _t17 = _t16 & 0x00000001u;
         /* 022718D4 */ if (_t17) goto L_022718F4; else goto L_022718D8;
   L_022718D8: ; // 0x22718d8
@@ -20311,8 +20311,8 @@ void Gambit_fn_02271914(CPUState* cpu) {
         /* 02271914 */ cpu->r[12] = cpu->r[3];
         /* 02271918 */ _t0 = cpu->r[12] + 0x00000090u;
         /* 02271918 */ cpu->r[3] = rbrew_read32(cpu->mem, _t0);
-        /* 0227191C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02271920 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227191C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02271920 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271920 */ _t2 = _t1 & 0x00000001u;
         /* 02271920 */ if (_t2) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02271920 */ goto L_02271924;
@@ -20343,15 +20343,15 @@ void Gambit_fn_02271914(CPUState* cpu) {
         /* 02390E0C */ cpu->r[30] = cpu->r[4];
         /* 02390E10 */ cpu->r[31] = cpu->r[5];
         /* 02390E14 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02390E18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02390E1C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02390E18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02390E1C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02390E1C */ _t11 = _t10 & 0x00000001u;
         /* 02390E1C */ if (_t11) goto L_02390EE8; else goto L_02390E20;
   L_02390E20: ; // 0x2390e20
         /* 02390E20 */ _t12 = cpu->r[29] + 0x00000011u;
         /* 02390E20 */ cpu->r[9] = rbrew_read8(cpu->mem, _t12);
-        /* 02390E24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02390E28 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02390E24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02390E28 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02390E28 */ _t14 = _t13 & 0x00000001u;
         /* 02390E28 */ if (_t14) goto L_02390E2C; else goto L_02390E60;
   L_02390E2C: ; // 0x2390e2c
@@ -20360,8 +20360,8 @@ void Gambit_fn_02271914(CPUState* cpu) {
         /* 02390E30 */ _t16 = cpu->r[29] + 0x00000014u;
         /* 02390E30 */ cpu->r[12] = rbrew_read32(cpu->mem, _t16);
         /* 02390E34 */ cpu->r[0] = cpu->r[10] + 0x00000001u;
-        /* 02390E38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], cpu->r[12]);
-        /* 02390E3C */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02390E38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], cpu->r[12]));
+        /* 02390E3C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02390E3C */ _t18 = _t17 & 0x00000001u;
         /* 02390E3C */ if (_t18) goto L_02390E40; else goto L_02390E60;
   L_02390E40: ; // 0x2390e40
@@ -20382,10 +20382,10 @@ void Gambit_fn_02271914(CPUState* cpu) {
         /* 02390E60 */ _t24 = cpu->r[29] + 0x00000008u;
         /* 02390E60 */ cpu->r[5] = rbrew_read32(cpu->mem, _t24);
         /* 02390E64 */ cpu->r[0] = 0x00000000u;
-        /* 02390E68 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000002u);
+        /* 02390E68 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000002u));
         /* 02390E6C */ _t25 = cpu->r[29] + 0x00000004u;
         /* 02390E6C */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
-        /* 02390E70 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02390E70 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02390E70 */ _t27 = _t26 & 0x00000001u;
         /* 02390E70 */ if (_t27) goto L_02390E74; else goto L_02390ED8;
   L_02390E74: ; // 0x2390e74
@@ -20457,8 +20457,8 @@ void Gambit_fn_02271934(CPUState* cpu) {
         /* 02271940 */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 02271940 */ cpu->r[1] = _t1;
         /* 02271944 */ Gambit_fn_02801A78(cpu);
-        /* 02271948 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0227194C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271948 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0227194C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227194C */ _t3 = _t2 & 0x00000001u;
         /* 0227194C */ if (_t3) goto L_02271954; else goto L_02271950;
   L_02271950: ; // 0x2271950
@@ -20480,8 +20480,8 @@ void Gambit_fn_02271940(CPUState* cpu) {
         /* 02271940 */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 02271940 */ cpu->r[1] = _t0;
         /* 02271944 */ Gambit_fn_02801A78(cpu);
-        /* 02271948 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0227194C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271948 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0227194C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227194C */ _t2 = _t1 & 0x00000001u;
         /* 0227194C */ if (_t2) goto L_02271954; else goto L_02271950;
   L_02271950: ; // 0x2271950
@@ -20506,12 +20506,12 @@ void Gambit_fn_02271964(CPUState* cpu) {
         /* 0227196C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0227196C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02271970 */ cpu->r[31] = cpu->r[3];
-        /* 02271974 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 02271974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 02271978 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02271978 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0227197C */ _t3 = cpu->r[31] + 0x00000098u;
         /* 0227197C */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
-        /* 02271980 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271980 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271980 */ _t5 = _t4 & 0x00000001u;
         /* 02271980 */ if (_t5) goto L_022719A8; else goto L_02271984;
   L_02271984: ; // 0x2271984
@@ -20564,12 +20564,12 @@ void Gambit_fn_02271968(CPUState* cpu) {
         /* 0227196C */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 0227196C */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 02271970 */ cpu->r[31] = cpu->r[3];
-        /* 02271974 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 02271974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 02271978 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 02271978 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0227197C */ _t3 = cpu->r[31] + 0x00000098u;
         /* 0227197C */ cpu->r[12] = rbrew_read32(cpu->mem, _t3);
-        /* 02271980 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271980 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271980 */ _t5 = _t4 & 0x00000001u;
         /* 02271980 */ if (_t5) goto L_022719A8; else goto L_02271984;
   L_02271984: ; // 0x2271984
@@ -20633,20 +20633,20 @@ void Gambit_fn_022719E4(CPUState* cpu) {
         /* 02271A04 */ _t5 = cpu->r[12] + 0x0000026Cu;
         /* 02271A04 */ cpu->r[3] = rbrew_read32(cpu->mem, _t5);
         /* 02271A08 */ Gambit_fn_022DABA8(cpu);
-        /* 02271A0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02271A10 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271A0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02271A10 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271A10 */ _t7 = _t6 & 0x00000001u;
         /* 02271A10 */ if (_t7) goto L_02271A14; else goto L_02271A40;
   L_02271A14: ; // 0x2271a14
         /* 02271A14 */ _t8 = cpu->r[31] + 0x00000084u;
         /* 02271A14 */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
-        /* 02271A18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 02271A1C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271A18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 02271A1C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271A1C */ _t10 = _t9 & 0x00000001u;
         /* 02271A1C */ if (_t10) goto L_02271A40; else goto L_02271A20;
   L_02271A20: ; // 0x2271a20
-        /* 02271A20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02271A24 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271A20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02271A24 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271A24 */ _t12 = _t11 & 0x00000001u;
         /* 02271A24 */ if (_t12) goto L_02271A40; else goto L_02271A28;
   L_02271A28: ; // 0x2271a28
@@ -20690,20 +20690,20 @@ void Gambit_fn_022719E8(CPUState* cpu) {
         /* 02271A04 */ _t5 = cpu->r[12] + 0x0000026Cu;
         /* 02271A04 */ cpu->r[3] = rbrew_read32(cpu->mem, _t5);
         /* 02271A08 */ Gambit_fn_022DABA8(cpu);
-        /* 02271A0C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02271A10 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271A0C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02271A10 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271A10 */ _t7 = _t6 & 0x00000001u;
         /* 02271A10 */ if (_t7) goto L_02271A14; else goto L_02271A40;
   L_02271A14: ; // 0x2271a14
         /* 02271A14 */ _t8 = cpu->r[31] + 0x00000084u;
         /* 02271A14 */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
-        /* 02271A18 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
-        /* 02271A1C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271A18 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
+        /* 02271A1C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271A1C */ _t10 = _t9 & 0x00000001u;
         /* 02271A1C */ if (_t10) goto L_02271A40; else goto L_02271A20;
   L_02271A20: ; // 0x2271a20
-        /* 02271A20 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000002u);
-        /* 02271A24 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271A20 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000002u));
+        /* 02271A24 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271A24 */ _t12 = _t11 & 0x00000001u;
         /* 02271A24 */ if (_t12) goto L_02271A40; else goto L_02271A28;
   L_02271A28: ; // 0x2271a28
@@ -20745,23 +20745,23 @@ void Gambit_fn_02271A58(CPUState* cpu) {
         /* 02271A70 */ _t4 = cpu->r[31] + 0x0000009Cu;
         /* 02271A70 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
         /* 02271A74 */ cpu->r[9] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02271A74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02271A78 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271A74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02271A78 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271A78 */ _t6 = _t5 & 0x00000001u;
         /* 02271A78 */ if (_t6) goto L_02271A7C; else goto L_02271B24;
   L_02271A7C: ; // 0x2271a7c
         /* 02271A7C */ _t7 = cpu->r[31] + 0x0000001Cu;
         /* 02271A7C */ cpu->r[11] = rbrew_read32(cpu->mem, _t7);
         /* 02271A80 */ cpu->r[0] = cpu->r[0] | 0x00000001u;
-        /* 02271A84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000002u);
+        /* 02271A84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000002u));
         /* 02271A88 */ _t8 = cpu->r[31] + 0x0000009Cu;
         /* 02271A88 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
-        /* 02271A8C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271A8C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271A8C */ _t10 = _t9 & 0x00000001u;
         /* 02271A8C */ if (_t10) goto L_02271A98; else goto L_02271A90;
   L_02271A90: ; // 0x2271a90
-        /* 02271A90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02271A94 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271A90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02271A94 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271A94 */ _t12 = _t11 & 0x00000001u;
         /* 02271A94 */ if (_t12) goto L_02271A98; else goto L_02271B24;
   L_02271A98: ; // 0x2271a98
@@ -20769,9 +20769,9 @@ void Gambit_fn_02271A58(CPUState* cpu) {
         /* 02271A9C */ Gambit_fn_02270B58(cpu);
         /* 02271AA0 */ cpu->r[3] = cpu->r[31];
         /* 02271AA4 */ Gambit_fn_02270E14(cpu);
-        /* 02271AA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02271AA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02271AAC */ cpu->r[30] = 0x101C0000u;
-        /* 02271AB0 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271AB0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271AB0 */ _t14 = _t13 & 0x00000001u;
         /* 02271AB0 */ if (_t14) goto L_02271ACC; else goto L_02271AB4;
   L_02271AB4: ; // 0x2271ab4
@@ -20787,8 +20787,8 @@ void Gambit_fn_02271A58(CPUState* cpu) {
   L_02271ACC: ; // 0x2271acc
         /* 02271ACC */ cpu->r[3] = cpu->r[31];
         /* 02271AD0 */ Gambit_fn_0227106C(cpu);
-        /* 02271AD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02271AD8 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271AD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02271AD8 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271AD8 */ _t19 = _t18 & 0x00000001u;
         /* 02271AD8 */ if (_t19) goto L_02271AE4; else goto L_02271ADC;
   L_02271ADC: ; // 0x2271adc
@@ -20797,8 +20797,8 @@ void Gambit_fn_02271A58(CPUState* cpu) {
   L_02271AE4: ; // 0x2271ae4
         /* 02271AE4 */ cpu->r[3] = cpu->r[31];
         /* 02271AE8 */ Gambit_fn_022719E4(cpu);
-        /* 02271AEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02271AF0 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271AEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02271AF0 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271AF0 */ _t21 = _t20 & 0x00000001u;
         /* 02271AF0 */ if (_t21) goto L_02271B24; else goto L_02271AF4;
   L_02271AF4: ; // 0x2271af4
@@ -20853,23 +20853,23 @@ void Gambit_fn_02271A5C(CPUState* cpu) {
         /* 02271A70 */ _t4 = cpu->r[31] + 0x0000009Cu;
         /* 02271A70 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
         /* 02271A74 */ cpu->r[9] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02271A74 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02271A78 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271A74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02271A78 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271A78 */ _t6 = _t5 & 0x00000001u;
         /* 02271A78 */ if (_t6) goto L_02271A7C; else goto L_02271B24;
   L_02271A7C: ; // 0x2271a7c
         /* 02271A7C */ _t7 = cpu->r[31] + 0x0000001Cu;
         /* 02271A7C */ cpu->r[11] = rbrew_read32(cpu->mem, _t7);
         /* 02271A80 */ cpu->r[0] = cpu->r[0] | 0x00000001u;
-        /* 02271A84 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000002u);
+        /* 02271A84 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000002u));
         /* 02271A88 */ _t8 = cpu->r[31] + 0x0000009Cu;
         /* 02271A88 */ rbrew_write32(cpu->mem, _t8, cpu->r[0]);
-        /* 02271A8C */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271A8C */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271A8C */ _t10 = _t9 & 0x00000001u;
         /* 02271A8C */ if (_t10) goto L_02271A98; else goto L_02271A90;
   L_02271A90: ; // 0x2271a90
-        /* 02271A90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02271A94 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271A90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02271A94 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271A94 */ _t12 = _t11 & 0x00000001u;
         /* 02271A94 */ if (_t12) goto L_02271A98; else goto L_02271B24;
   L_02271A98: ; // 0x2271a98
@@ -20877,9 +20877,9 @@ void Gambit_fn_02271A5C(CPUState* cpu) {
         /* 02271A9C */ Gambit_fn_02270B58(cpu);
         /* 02271AA0 */ cpu->r[3] = cpu->r[31];
         /* 02271AA4 */ Gambit_fn_02270E14(cpu);
-        /* 02271AA8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02271AA8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02271AAC */ cpu->r[30] = 0x101C0000u;
-        /* 02271AB0 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271AB0 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271AB0 */ _t14 = _t13 & 0x00000001u;
         /* 02271AB0 */ if (_t14) goto L_02271ACC; else goto L_02271AB4;
   L_02271AB4: ; // 0x2271ab4
@@ -20895,8 +20895,8 @@ void Gambit_fn_02271A5C(CPUState* cpu) {
   L_02271ACC: ; // 0x2271acc
         /* 02271ACC */ cpu->r[3] = cpu->r[31];
         /* 02271AD0 */ Gambit_fn_0227106C(cpu);
-        /* 02271AD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02271AD8 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271AD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02271AD8 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271AD8 */ _t19 = _t18 & 0x00000001u;
         /* 02271AD8 */ if (_t19) goto L_02271AE4; else goto L_02271ADC;
   L_02271ADC: ; // 0x2271adc
@@ -20905,8 +20905,8 @@ void Gambit_fn_02271A5C(CPUState* cpu) {
   L_02271AE4: ; // 0x2271ae4
         /* 02271AE4 */ cpu->r[3] = cpu->r[31];
         /* 02271AE8 */ Gambit_fn_022719E4(cpu);
-        /* 02271AEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02271AF0 */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271AEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02271AF0 */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271AF0 */ _t21 = _t20 & 0x00000001u;
         /* 02271AF0 */ if (_t21) goto L_02271B24; else goto L_02271AF4;
   L_02271AF4: ; // 0x2271af4
@@ -20958,8 +20958,8 @@ void Gambit_fn_02271B3C(CPUState* cpu) {
         /* 02271B48 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02271B4C */ _t3 = cpu->r[3] + 0x0000005Cu;
         /* 02271B4C */ cpu->r[31] = rbrew_read32(cpu->mem, _t3);
-        /* 02271B50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02271B54 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271B50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02271B54 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271B54 */ _t5 = _t4 & 0x00000001u;
         /* 02271B54 */ if (_t5) goto L_02271B84; else goto L_02271B58;
   L_02271B58: ; // 0x2271b58
@@ -21009,8 +21009,8 @@ void Gambit_fn_02271B40(CPUState* cpu) {
         /* 02271B48 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02271B4C */ _t3 = cpu->r[3] + 0x0000005Cu;
         /* 02271B4C */ cpu->r[31] = rbrew_read32(cpu->mem, _t3);
-        /* 02271B50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02271B54 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271B50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02271B54 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271B54 */ _t5 = _t4 & 0x00000001u;
         /* 02271B54 */ if (_t5) goto L_02271B84; else goto L_02271B58;
   L_02271B58: ; // 0x2271b58
@@ -21086,9 +21086,9 @@ void Gambit_fn_02271BA8(CPUState* cpu) {
         /* 02271BF8 */ cpu->r[9] = _t9;
         /* 02271BFC */ cpu->r[4] = 0x101D0000u;
         /* 02271C00 */ cpu->r[31] = cpu->r[3];
-        /* 02271C04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02271C04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02271C08 */ cpu->r[4] = cpu->r[4] + 0xFFFFFFE8u;
-        /* 02271C0C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271C0C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271C0C */ _t11 = _t10 & 0x00000001u;
         /* 02271C0C */ if (_t11) goto L_02271C10; else goto L_02271C24;
   L_02271C10: ; // 0x2271c10
@@ -21100,8 +21100,8 @@ void Gambit_fn_02271BA8(CPUState* cpu) {
         /* 02271C20 */ _t13 = cpu->r[4] + 0x00000000u;
         /* 02271C20 */ rbrew_write32(cpu->mem, _t13, cpu->r[0]);
   L_02271C24: ; // 0x2271c24
-        /* 02271C24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02271C28 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271C24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02271C28 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271C28 */ _t15 = _t14 & 0x00000001u;
         /* 02271C28 */ if (_t15) goto L_02271C48; else goto L_02271C2C;
   L_02271C2C: ; // 0x2271c2c
@@ -21112,8 +21112,8 @@ void Gambit_fn_02271BA8(CPUState* cpu) {
         /* 02271C34 */ cpu->ctr = cpu->r[0];
         /* 02271C38 */ cpu->r[3] = cpu->r[31];
         /* 02271C3C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02271C40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02271C44 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271C40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02271C44 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271C44 */ _t19 = _t18 & 0x00000001u;
         /* 02271C44 */ if (_t19) goto L_02271C48; else goto L_02271C4C;
   L_02271C48: ; // 0x2271c48
@@ -21121,8 +21121,8 @@ void Gambit_fn_02271BA8(CPUState* cpu) {
   L_02271C4C: ; // 0x2271c4c
         /* 02271C4C */ _t20 = cpu->r[31] + 0x00000BA8u;
         /* 02271C4C */ cpu->r[0] = rbrew_read8(cpu->mem, _t20);
-        /* 02271C50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02271C54 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271C50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02271C54 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271C54 */ _t22 = _t21 & 0x00000001u;
         /* 02271C54 */ if (_t22) goto L_02271C64; else goto L_02271C58;
   L_02271C58: ; // 0x2271c58
@@ -21184,9 +21184,9 @@ void Gambit_fn_02271BAC(CPUState* cpu) {
         /* 02271BF8 */ cpu->r[9] = _t9;
         /* 02271BFC */ cpu->r[4] = 0x101D0000u;
         /* 02271C00 */ cpu->r[31] = cpu->r[3];
-        /* 02271C04 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02271C04 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 02271C08 */ cpu->r[4] = cpu->r[4] + 0xFFFFFFE8u;
-        /* 02271C0C */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271C0C */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271C0C */ _t11 = _t10 & 0x00000001u;
         /* 02271C0C */ if (_t11) goto L_02271C10; else goto L_02271C24;
   L_02271C10: ; // 0x2271c10
@@ -21198,8 +21198,8 @@ void Gambit_fn_02271BAC(CPUState* cpu) {
         /* 02271C20 */ _t13 = cpu->r[4] + 0x00000000u;
         /* 02271C20 */ rbrew_write32(cpu->mem, _t13, cpu->r[0]);
   L_02271C24: ; // 0x2271c24
-        /* 02271C24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02271C28 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271C24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02271C28 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271C28 */ _t15 = _t14 & 0x00000001u;
         /* 02271C28 */ if (_t15) goto L_02271C48; else goto L_02271C2C;
   L_02271C2C: ; // 0x2271c2c
@@ -21210,8 +21210,8 @@ void Gambit_fn_02271BAC(CPUState* cpu) {
         /* 02271C34 */ cpu->ctr = cpu->r[0];
         /* 02271C38 */ cpu->r[3] = cpu->r[31];
         /* 02271C3C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02271C40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02271C44 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271C40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02271C44 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271C44 */ _t19 = _t18 & 0x00000001u;
         /* 02271C44 */ if (_t19) goto L_02271C48; else goto L_02271C4C;
   L_02271C48: ; // 0x2271c48
@@ -21219,8 +21219,8 @@ void Gambit_fn_02271BAC(CPUState* cpu) {
   L_02271C4C: ; // 0x2271c4c
         /* 02271C4C */ _t20 = cpu->r[31] + 0x00000BA8u;
         /* 02271C4C */ cpu->r[0] = rbrew_read8(cpu->mem, _t20);
-        /* 02271C50 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02271C54 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271C50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02271C54 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271C54 */ _t22 = _t21 & 0x00000001u;
         /* 02271C54 */ if (_t22) goto L_02271C64; else goto L_02271C58;
   L_02271C58: ; // 0x2271c58
@@ -21271,9 +21271,9 @@ void Gambit_fn_02271C80(CPUState* cpu) {
         /* 02271CB0 */ cpu->r[4] = 0x101D0000u;
         /* 02271CB4 */ cpu->r[29] = cpu->r[29] + 0xFFFF8FB8u;
         /* 02271CB8 */ cpu->r[28] = cpu->r[5];
-        /* 02271CBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02271CBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02271CC0 */ cpu->r[4] = cpu->r[4] + 0xFFFFE310u;
-        /* 02271CC4 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271CC4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271CC4 */ _t8 = _t7 & 0x00000001u;
         /* 02271CC4 */ if (_t8) goto L_02271CC8; else goto L_02271CD8;
   L_02271CC8: ; // 0x2271cc8
@@ -21284,8 +21284,8 @@ void Gambit_fn_02271C80(CPUState* cpu) {
         /* 02271CD4 */ _t10 = cpu->r[10] + 0xFFFFD9C8u;
         /* 02271CD4 */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
   L_02271CD8: ; // 0x2271cd8
-        /* 02271CD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02271CDC */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271CD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02271CDC */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271CDC */ _t12 = _t11 & 0x00000001u;
         /* 02271CDC */ if (_t12) goto L_02271D40; else goto L_02271CE0;
   L_02271CE0: ; // 0x2271ce0
@@ -21296,13 +21296,13 @@ void Gambit_fn_02271C80(CPUState* cpu) {
         /* 02271CE8 */ cpu->ctr = cpu->r[0];
         /* 02271CEC */ cpu->r[3] = cpu->r[31];
         /* 02271CF0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02271CF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02271CF8 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271CF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02271CF8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271CF8 */ _t16 = _t15 & 0x00000001u;
         /* 02271CF8 */ if (_t16) goto L_02271D40; else goto L_02271CFC;
   L_02271CFC: ; // 0x2271cfc
-        /* 02271CFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02271D00 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271CFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02271D00 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271D00 */ _t18 = _t17 & 0x00000001u;
         /* 02271D00 */ if (_t18) goto L_02271D40; else goto L_02271D04;
   L_02271D04: ; // 0x2271d04
@@ -21334,9 +21334,9 @@ void Gambit_fn_02271C80(CPUState* cpu) {
         /* 02271D44 */ cpu->r[0] = rbrew_read32(cpu->mem, _t26);
         /* 02271D44 */ cpu->r[8] = _t26;
         /* 02271D48 */ cpu->r[4] = 0x101D0000u;
-        /* 02271D4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02271D4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02271D50 */ cpu->r[4] = cpu->r[4] + 0xFFFFFB4Cu;
-        /* 02271D54 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271D54 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271D54 */ _t28 = _t27 & 0x00000001u;
         /* 02271D54 */ if (_t28) goto L_02271D58; else goto L_02271D64;
   L_02271D58: ; // 0x2271d58
@@ -21346,8 +21346,8 @@ void Gambit_fn_02271C80(CPUState* cpu) {
         /* 02271D60 */ _t30 = cpu->r[8] + 0x00000000u;
         /* 02271D60 */ rbrew_write32(cpu->mem, _t30, cpu->r[7]);
   L_02271D64: ; // 0x2271d64
-        /* 02271D64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02271D68 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271D64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02271D68 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271D68 */ _t32 = _t31 & 0x00000001u;
         /* 02271D68 */ if (_t32) goto L_02271DAC; else goto L_02271D6C;
   L_02271D6C: ; // 0x2271d6c
@@ -21358,13 +21358,13 @@ void Gambit_fn_02271C80(CPUState* cpu) {
         /* 02271D74 */ cpu->ctr = cpu->r[9];
         /* 02271D78 */ cpu->r[3] = cpu->r[31];
         /* 02271D7C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02271D80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02271D84 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271D80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02271D84 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271D84 */ _t36 = _t35 & 0x00000001u;
         /* 02271D84 */ if (_t36) goto L_02271DAC; else goto L_02271D88;
   L_02271D88: ; // 0x2271d88
-        /* 02271D88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02271D8C */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271D88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02271D8C */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271D8C */ _t38 = _t37 & 0x00000001u;
         /* 02271D8C */ if (_t38) goto L_02271DAC; else goto L_02271D90;
   L_02271D90: ; // 0x2271d90
@@ -21420,9 +21420,9 @@ void Gambit_fn_02271C84(CPUState* cpu) {
         /* 02271CB0 */ cpu->r[4] = 0x101D0000u;
         /* 02271CB4 */ cpu->r[29] = cpu->r[29] + 0xFFFF8FB8u;
         /* 02271CB8 */ cpu->r[28] = cpu->r[5];
-        /* 02271CBC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02271CBC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02271CC0 */ cpu->r[4] = cpu->r[4] + 0xFFFFE310u;
-        /* 02271CC4 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271CC4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271CC4 */ _t8 = _t7 & 0x00000001u;
         /* 02271CC4 */ if (_t8) goto L_02271CC8; else goto L_02271CD8;
   L_02271CC8: ; // 0x2271cc8
@@ -21433,8 +21433,8 @@ void Gambit_fn_02271C84(CPUState* cpu) {
         /* 02271CD4 */ _t10 = cpu->r[10] + 0xFFFFD9C8u;
         /* 02271CD4 */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
   L_02271CD8: ; // 0x2271cd8
-        /* 02271CD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02271CDC */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271CD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02271CDC */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271CDC */ _t12 = _t11 & 0x00000001u;
         /* 02271CDC */ if (_t12) goto L_02271D40; else goto L_02271CE0;
   L_02271CE0: ; // 0x2271ce0
@@ -21445,13 +21445,13 @@ void Gambit_fn_02271C84(CPUState* cpu) {
         /* 02271CE8 */ cpu->ctr = cpu->r[0];
         /* 02271CEC */ cpu->r[3] = cpu->r[31];
         /* 02271CF0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02271CF4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02271CF8 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271CF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02271CF8 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271CF8 */ _t16 = _t15 & 0x00000001u;
         /* 02271CF8 */ if (_t16) goto L_02271D40; else goto L_02271CFC;
   L_02271CFC: ; // 0x2271cfc
-        /* 02271CFC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02271D00 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271CFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02271D00 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271D00 */ _t18 = _t17 & 0x00000001u;
         /* 02271D00 */ if (_t18) goto L_02271D40; else goto L_02271D04;
   L_02271D04: ; // 0x2271d04
@@ -21483,9 +21483,9 @@ void Gambit_fn_02271C84(CPUState* cpu) {
         /* 02271D44 */ cpu->r[0] = rbrew_read32(cpu->mem, _t26);
         /* 02271D44 */ cpu->r[8] = _t26;
         /* 02271D48 */ cpu->r[4] = 0x101D0000u;
-        /* 02271D4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02271D4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02271D50 */ cpu->r[4] = cpu->r[4] + 0xFFFFFB4Cu;
-        /* 02271D54 */ _t27 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271D54 */ _t27 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271D54 */ _t28 = _t27 & 0x00000001u;
         /* 02271D54 */ if (_t28) goto L_02271D58; else goto L_02271D64;
   L_02271D58: ; // 0x2271d58
@@ -21495,8 +21495,8 @@ void Gambit_fn_02271C84(CPUState* cpu) {
         /* 02271D60 */ _t30 = cpu->r[8] + 0x00000000u;
         /* 02271D60 */ rbrew_write32(cpu->mem, _t30, cpu->r[7]);
   L_02271D64: ; // 0x2271d64
-        /* 02271D64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02271D68 */ _t31 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271D64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02271D68 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271D68 */ _t32 = _t31 & 0x00000001u;
         /* 02271D68 */ if (_t32) goto L_02271DAC; else goto L_02271D6C;
   L_02271D6C: ; // 0x2271d6c
@@ -21507,13 +21507,13 @@ void Gambit_fn_02271C84(CPUState* cpu) {
         /* 02271D74 */ cpu->ctr = cpu->r[9];
         /* 02271D78 */ cpu->r[3] = cpu->r[31];
         /* 02271D7C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02271D80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02271D84 */ _t35 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271D80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02271D84 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271D84 */ _t36 = _t35 & 0x00000001u;
         /* 02271D84 */ if (_t36) goto L_02271DAC; else goto L_02271D88;
   L_02271D88: ; // 0x2271d88
-        /* 02271D88 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02271D8C */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271D88 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02271D8C */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271D8C */ _t38 = _t37 & 0x00000001u;
         /* 02271D8C */ if (_t38) goto L_02271DAC; else goto L_02271D90;
   L_02271D90: ; // 0x2271d90
@@ -21755,10 +21755,10 @@ void Gambit_fn_02271EB0(CPUState* cpu) {
         /* 02271EE4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02271EE8 */ _t8 = cpu->r[31] + 0x000000B4u;
         /* 02271EE8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
-        /* 02271EEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02271EEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02271EF0 */ _t9 = cpu->r[31] + 0x000000BCu;
         /* 02271EF0 */ rbrew_write32(cpu->mem, _t9, cpu->r[3]);
-        /* 02271EF4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271EF4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271EF4 */ _t11 = _t10 & 0x00000001u;
         /* 02271EF4 */ if (_t11) goto L_02271F04; else goto L_02271EF8;
   L_02271EF8: ; // 0x2271ef8
@@ -21768,8 +21768,8 @@ void Gambit_fn_02271EB0(CPUState* cpu) {
   L_02271F04: ; // 0x2271f04
         /* 02271F04 */ _t12 = cpu->r[31] + 0x000000D8u;
         /* 02271F04 */ cpu->r[3] = rbrew_read32(cpu->mem, _t12);
-        /* 02271F08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02271F0C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271F08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02271F0C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271F0C */ _t14 = _t13 & 0x00000001u;
         /* 02271F0C */ if (_t14) goto L_02271F18; else goto L_02271F10;
   L_02271F10: ; // 0x2271f10
@@ -21782,7 +21782,7 @@ void Gambit_fn_02271EB0(CPUState* cpu) {
         /* 02271F1C */ cpu->r[31] = rbrew_read32(cpu->mem, _t16);
         /* 02271F20 */ _t17 = cpu->r[1] + 0x00000010u;
         /* 02271F20 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t17);
-        /* 02271F24 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02271F24 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02271F24 */ _t19 = _t18 & 0x00000001u;
         /* 02271F24 */ if (_t19) goto L_02271F28; // else: addr-0 trap, fall-through
   L_02271F28: ; // 0x2271f28
@@ -21822,10 +21822,10 @@ void Gambit_fn_02271EB4(CPUState* cpu) {
         /* 02271EE4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02271EE8 */ _t8 = cpu->r[31] + 0x000000B4u;
         /* 02271EE8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t8);
-        /* 02271EEC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02271EEC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02271EF0 */ _t9 = cpu->r[31] + 0x000000BCu;
         /* 02271EF0 */ rbrew_write32(cpu->mem, _t9, cpu->r[3]);
-        /* 02271EF4 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271EF4 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271EF4 */ _t11 = _t10 & 0x00000001u;
         /* 02271EF4 */ if (_t11) goto L_02271F04; else goto L_02271EF8;
   L_02271EF8: ; // 0x2271ef8
@@ -21835,8 +21835,8 @@ void Gambit_fn_02271EB4(CPUState* cpu) {
   L_02271F04: ; // 0x2271f04
         /* 02271F04 */ _t12 = cpu->r[31] + 0x000000D8u;
         /* 02271F04 */ cpu->r[3] = rbrew_read32(cpu->mem, _t12);
-        /* 02271F08 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02271F0C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02271F08 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02271F0C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02271F0C */ _t14 = _t13 & 0x00000001u;
         /* 02271F0C */ if (_t14) goto L_02271F18; else goto L_02271F10;
   L_02271F10: ; // 0x2271f10
@@ -21849,7 +21849,7 @@ void Gambit_fn_02271EB4(CPUState* cpu) {
         /* 02271F1C */ cpu->r[31] = rbrew_read32(cpu->mem, _t16);
         /* 02271F20 */ _t17 = cpu->r[1] + 0x00000010u;
         /* 02271F20 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t17);
-        /* 02271F24 */ _t18 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02271F24 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02271F24 */ _t19 = _t18 & 0x00000001u;
         /* 02271F24 */ if (_t19) goto L_02271F28; // else: addr-0 trap, fall-through
   L_02271F28: ; // 0x2271f28
@@ -21947,9 +21947,9 @@ void Gambit_fn_02271F38(CPUState* cpu) {
         /* 0227200C */ cpu->ctr = cpu->r[0];
         /* 02272010 */ cpu->r[3] = cpu->r[31];
         /* 02272014 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02272018 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 02272018 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0227201C */ cpu->r[12] = cpu->r[3];
-        /* 02272020 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272020 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272020 */ _t26 = _t25 & 0x00000001u;
         /* 02272020 */ if (_t26) goto L_02272094; else goto L_02272024;
   L_02272024: ; // 0x2272024
@@ -22109,9 +22109,9 @@ void Gambit_fn_02271F3C(CPUState* cpu) {
         /* 0227200C */ cpu->ctr = cpu->r[0];
         /* 02272010 */ cpu->r[3] = cpu->r[31];
         /* 02272014 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02272018 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
+        /* 02272018 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
         /* 0227201C */ cpu->r[12] = cpu->r[3];
-        /* 02272020 */ _t25 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272020 */ _t25 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272020 */ _t26 = _t25 & 0x00000001u;
         /* 02272020 */ if (_t26) goto L_02272094; else goto L_02272024;
   L_02272024: ; // 0x2272024
@@ -22211,8 +22211,8 @@ void Gambit_fn_022720DC(CPUState* cpu) {
         /* 02272104 */ cpu->r[30] = cpu->r[4];
         /* 02272108 */ cpu->r[31] = cpu->r[5];
         /* 0227210C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02272110 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02272114 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272110 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02272114 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272114 */ _t8 = _t7 & 0x00000001u;
         /* 02272114 */ if (_t8) goto L_02272180; else goto L_02272118;
   L_02272118: ; // 0x2272118
@@ -22223,8 +22223,8 @@ void Gambit_fn_022720DC(CPUState* cpu) {
         /* 02272120 */ cpu->ctr = cpu->r[0];
         /* 02272124 */ cpu->r[3] = cpu->r[29];
         /* 02272128 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0227212C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02272130 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227212C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02272130 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272130 */ _t12 = _t11 & 0x00000001u;
         /* 02272130 */ if (_t12) goto L_0227216C; else goto L_02272134;
   L_02272134: ; // 0x2272134
@@ -22291,8 +22291,8 @@ void Gambit_fn_022720E0(CPUState* cpu) {
         /* 02272104 */ cpu->r[30] = cpu->r[4];
         /* 02272108 */ cpu->r[31] = cpu->r[5];
         /* 0227210C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02272110 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02272114 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272110 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02272114 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272114 */ _t8 = _t7 & 0x00000001u;
         /* 02272114 */ if (_t8) goto L_02272180; else goto L_02272118;
   L_02272118: ; // 0x2272118
@@ -22303,8 +22303,8 @@ void Gambit_fn_022720E0(CPUState* cpu) {
         /* 02272120 */ cpu->ctr = cpu->r[0];
         /* 02272124 */ cpu->r[3] = cpu->r[29];
         /* 02272128 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0227212C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02272130 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227212C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02272130 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272130 */ _t12 = _t11 & 0x00000001u;
         /* 02272130 */ if (_t12) goto L_0227216C; else goto L_02272134;
   L_02272134: ; // 0x2272134
@@ -22366,22 +22366,22 @@ void Gambit_fn_0227219C(CPUState* cpu) {
         /* 022721B8 */ cpu->ctr = cpu->r[6];
         /* 022721BC */ cpu->r[28] = cpu->r[3];
         /* 022721C0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 022721C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022721C8 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022721C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022721C8 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022721C8 */ _t5 = _t4 & 0x00000001u;
         /* 022721C8 */ if (_t5) goto L_02272214; else goto L_022721CC;
   L_022721CC: ; // 0x22721cc
         /* 022721CC */ _t6 = cpu->r[29] + 0x00000004u;
         /* 022721CC */ cpu->r[12] = rbrew_read32(cpu->mem, _t6);
-        /* 022721D0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022721D4 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022721D0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022721D4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022721D4 */ _t8 = _t7 & 0x00000001u;
         /* 022721D4 */ if (_t8) goto L_02272214; else goto L_022721D8;
   L_022721D8: ; // 0x22721d8
         /* 022721D8 */ _t9 = cpu->r[12] + 0x00000020u;
         /* 022721D8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t9);
-        /* 022721DC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000024u);
-        /* 022721E0 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022721DC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000024u));
+        /* 022721E0 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022721E0 */ _t11 = _t10 & 0x00000001u;
         /* 022721E0 */ if (_t11) goto L_022721E4; else goto L_02272214;
   L_022721E4: ; // 0x22721e4
@@ -22411,19 +22411,19 @@ void Gambit_fn_0227219C(CPUState* cpu) {
         /* 02272224 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 02272228 */ cpu->r[27] = 0x101D0000u;
         /* 0227222C */ cpu->r[26] = 0x10060000u;
-        /* 02272230 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02272230 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02272234 */ cpu->r[30] = 0x101D0000u;
         /* 02272238 */ cpu->r[26] = cpu->r[26] + 0xFFFF8FC8u;
-        /* 0227223C */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227223C */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227223C */ _t19 = _t18 & 0x00000001u;
         /* 0227223C */ if (_t19) goto L_02272310; else goto L_02272240;
   L_02272240: ; // 0x2272240
         /* 02272240 */ _t20 = cpu->r[27] + 0xFFFFFD8Cu;
         /* 02272240 */ cpu->r[12] = rbrew_read32(cpu->mem, _t20);
-        /* 02272244 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02272244 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02272248 */ _t21 = cpu->r[29] + 0x00000004u;
         /* 02272248 */ cpu->r[31] = rbrew_read32(cpu->mem, _t21);
-        /* 0227224C */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227224C */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227224C */ _t23 = _t22 & 0x00000001u;
         /* 0227224C */ if (_t23) goto L_02272250; else goto L_0227225C;
   L_02272250: ; // 0x2272250
@@ -22433,8 +22433,8 @@ void Gambit_fn_0227219C(CPUState* cpu) {
         /* 02272258 */ _t25 = cpu->r[27] + 0xFFFFFD8Cu;
         /* 02272258 */ rbrew_write32(cpu->mem, _t25, cpu->r[0]);
   L_0227225C: ; // 0x227225c
-        /* 0227225C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02272260 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227225C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02272260 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272260 */ _t27 = _t26 & 0x00000001u;
         /* 02272260 */ if (_t27) goto L_02272310; else goto L_02272264;
   L_02272264: ; // 0x2272264
@@ -22446,22 +22446,22 @@ void Gambit_fn_0227219C(CPUState* cpu) {
         /* 02272270 */ cpu->r[3] = cpu->r[31];
         /* 02272274 */ cpu->r[4] = cpu->r[30] + 0xFFFFFD88u;
         /* 02272278 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0227227C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02272280 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227227C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02272280 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272280 */ _t31 = _t30 & 0x00000001u;
         /* 02272280 */ if (_t31) goto L_02272310; else goto L_02272284;
   L_02272284: ; // 0x2272284
-        /* 02272284 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02272288 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272284 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02272288 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272288 */ _t33 = _t32 & 0x00000001u;
         /* 02272288 */ if (_t33) goto L_02272310; else goto L_0227228C;
   L_0227228C: ; // 0x227228c
         /* 0227228C */ _t34 = cpu->r[27] + 0xFFFFFD8Cu;
         /* 0227228C */ cpu->r[0] = rbrew_read32(cpu->mem, _t34);
-        /* 02272290 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02272290 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02272294 */ _t35 = cpu->r[29] + 0x00000004u;
         /* 02272294 */ cpu->r[31] = rbrew_read32(cpu->mem, _t35);
-        /* 02272298 */ _t36 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272298 */ _t36 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272298 */ _t37 = _t36 & 0x00000001u;
         /* 02272298 */ if (_t37) goto L_0227229C; else goto L_022722A8;
   L_0227229C: ; // 0x227229c
@@ -22471,8 +22471,8 @@ void Gambit_fn_0227219C(CPUState* cpu) {
         /* 022722A4 */ _t39 = cpu->r[27] + 0xFFFFFD8Cu;
         /* 022722A4 */ rbrew_write32(cpu->mem, _t39, cpu->r[8]);
   L_022722A8: ; // 0x22722a8
-        /* 022722A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022722AC */ _t40 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022722A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022722AC */ _t40 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022722AC */ _t41 = _t40 & 0x00000001u;
         /* 022722AC */ if (_t41) goto L_022722D0; else goto L_022722B0;
   L_022722B0: ; // 0x22722b0
@@ -22484,8 +22484,8 @@ void Gambit_fn_0227219C(CPUState* cpu) {
         /* 022722BC */ cpu->r[3] = cpu->r[31];
         /* 022722C0 */ cpu->r[4] = cpu->r[30] + 0xFFFFFD88u;
         /* 022722C4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 022722C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022722CC */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022722C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022722CC */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022722CC */ _t45 = _t44 & 0x00000001u;
         /* 022722CC */ if (_t45) goto L_022722D0; else goto L_022722D4;
   L_022722D0: ; // 0x22722d0
@@ -22494,8 +22494,8 @@ void Gambit_fn_0227219C(CPUState* cpu) {
         /* 022722D4 */ _t46 = cpu->r[31] + 0x00000120u;
         /* 022722D4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t46);
         /* 022722D8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x00000003u, 0x00000003u);
-        /* 022722D8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022722DC */ _t47 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022722D8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022722DC */ _t47 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022722DC */ _t48 = _t47 & 0x00000001u;
         /* 022722DC */ if (_t48) goto L_02272310; else goto L_022722E0;
   L_022722E0: ; // 0x22722e0
@@ -22523,17 +22523,17 @@ void Gambit_fn_0227219C(CPUState* cpu) {
         /* 02272318 */ cpu->ctr = cpu->r[7];
         /* 0227231C */ cpu->r[3] = cpu->r[28];
         /* 02272320 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02272324 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02272328 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272324 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02272328 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272328 */ _t56 = _t55 & 0x00000001u;
         /* 02272328 */ if (_t56) goto L_022723A8; else goto L_0227232C;
   L_0227232C: ; // 0x227232c
         /* 0227232C */ _t57 = cpu->r[27] + 0xFFFFFD8Cu;
         /* 0227232C */ cpu->r[8] = rbrew_read32(cpu->mem, _t57);
-        /* 02272330 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 02272330 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02272334 */ _t58 = cpu->r[29] + 0x00000004u;
         /* 02272334 */ cpu->r[31] = rbrew_read32(cpu->mem, _t58);
-        /* 02272338 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272338 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272338 */ _t60 = _t59 & 0x00000001u;
         /* 02272338 */ if (_t60) goto L_0227233C; else goto L_02272348;
   L_0227233C: ; // 0x227233c
@@ -22543,8 +22543,8 @@ void Gambit_fn_0227219C(CPUState* cpu) {
         /* 02272344 */ _t62 = cpu->r[27] + 0xFFFFFD8Cu;
         /* 02272344 */ rbrew_write32(cpu->mem, _t62, cpu->r[9]);
   L_02272348: ; // 0x2272348
-        /* 02272348 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0227234C */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272348 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0227234C */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227234C */ _t64 = _t63 & 0x00000001u;
         /* 0227234C */ if (_t64) goto L_022723A8; else goto L_02272350;
   L_02272350: ; // 0x2272350
@@ -22556,13 +22556,13 @@ void Gambit_fn_0227219C(CPUState* cpu) {
         /* 0227235C */ cpu->r[3] = cpu->r[31];
         /* 02272360 */ cpu->r[4] = cpu->r[30] + 0xFFFFFD88u;
         /* 02272364 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02272368 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0227236C */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272368 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0227236C */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227236C */ _t68 = _t67 & 0x00000001u;
         /* 0227236C */ if (_t68) goto L_022723A8; else goto L_02272370;
   L_02272370: ; // 0x2272370
-        /* 02272370 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02272374 */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272370 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02272374 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272374 */ _t70 = _t69 & 0x00000001u;
         /* 02272374 */ if (_t70) goto L_022723A8; else goto L_02272378;
   L_02272378: ; // 0x2272378
@@ -22590,18 +22590,18 @@ void Gambit_fn_0227219C(CPUState* cpu) {
         /* 022723B0 */ cpu->ctr = cpu->r[7];
         /* 022723B4 */ cpu->r[3] = cpu->r[28];
         /* 022723B8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 022723BC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022723C0 */ _t77 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022723BC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022723C0 */ _t77 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022723C0 */ _t78 = _t77 & 0x00000001u;
         /* 022723C0 */ if (_t78) goto L_02272458; else goto L_022723C4;
   L_022723C4: ; // 0x22723c4
         /* 022723C4 */ cpu->r[11] = 0x101D0000u;
         /* 022723C8 */ _t79 = cpu->r[11] + 0xFFFFFC4Cu;
         /* 022723C8 */ cpu->r[11] = rbrew_read32(cpu->mem, _t79);
-        /* 022723CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
+        /* 022723CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
         /* 022723D0 */ _t80 = cpu->r[29] + 0x00000004u;
         /* 022723D0 */ cpu->r[31] = rbrew_read32(cpu->mem, _t80);
-        /* 022723D4 */ _t81 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022723D4 */ _t81 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022723D4 */ _t82 = _t81 & 0x00000001u;
         /* 022723D4 */ if (_t82) goto L_022723D8; else goto L_022723F4;
   L_022723D8: ; // 0x22723d8
@@ -22615,8 +22615,8 @@ void Gambit_fn_0227219C(CPUState* cpu) {
         /* 022723F0 */ _t84 = cpu->r[6] + 0xFFFFFD90u;
         /* 022723F0 */ rbrew_write32(cpu->mem, _t84, cpu->r[9]);
   L_022723F4: ; // 0x22723f4
-        /* 022723F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022723F8 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022723F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022723F8 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022723F8 */ _t86 = _t85 & 0x00000001u;
         /* 022723F8 */ if (_t86) goto L_02272458; else goto L_022723FC;
   L_022723FC: ; // 0x22723fc
@@ -22629,13 +22629,13 @@ void Gambit_fn_0227219C(CPUState* cpu) {
         /* 0227240C */ cpu->r[4] = cpu->r[4] + 0xFFFFFD90u;
         /* 02272410 */ cpu->r[3] = cpu->r[31];
         /* 02272414 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02272418 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0227241C */ _t89 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272418 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0227241C */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227241C */ _t90 = _t89 & 0x00000001u;
         /* 0227241C */ if (_t90) goto L_02272458; else goto L_02272420;
   L_02272420: ; // 0x2272420
-        /* 02272420 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02272424 */ _t91 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272420 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02272424 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272424 */ _t92 = _t91 & 0x00000001u;
         /* 02272424 */ if (_t92) goto L_02272458; else goto L_02272428;
   L_02272428: ; // 0x2272428
@@ -22663,8 +22663,8 @@ void Gambit_fn_0227219C(CPUState* cpu) {
         /* 02272460 */ cpu->ctr = cpu->r[0];
         /* 02272464 */ cpu->r[3] = cpu->r[28];
         /* 02272468 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 0227246C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02272470 */ _t99 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227246C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02272470 */ _t99 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272470 */ _t100 = _t99 & 0x00000001u;
         /* 02272470 */ if (_t100) goto L_02272504; else goto L_02272474;
   L_02272474: ; // 0x2272474
@@ -22674,9 +22674,9 @@ void Gambit_fn_0227219C(CPUState* cpu) {
         /* 0227247C */ cpu->r[4] = 0x101D0000u;
         /* 02272480 */ _t102 = cpu->r[29] + 0x00000004u;
         /* 02272480 */ cpu->r[31] = rbrew_read32(cpu->mem, _t102);
-        /* 02272484 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02272484 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02272488 */ cpu->r[4] = cpu->r[4] + 0xFFFFFF8Cu;
-        /* 0227248C */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227248C */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227248C */ _t104 = _t103 & 0x00000001u;
         /* 0227248C */ if (_t104) goto L_02272490; else goto L_022724A8;
   L_02272490: ; // 0x2272490
@@ -22689,8 +22689,8 @@ void Gambit_fn_0227219C(CPUState* cpu) {
         /* 022724A4 */ _t106 = cpu->r[4] + 0x00000000u;
         /* 022724A4 */ rbrew_write32(cpu->mem, _t106, cpu->r[8]);
   L_022724A8: ; // 0x22724a8
-        /* 022724A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022724AC */ _t107 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022724A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022724AC */ _t107 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022724AC */ _t108 = _t107 & 0x00000001u;
         /* 022724AC */ if (_t108) goto L_02272504; else goto L_022724B0;
   L_022724B0: ; // 0x22724b0
@@ -22701,13 +22701,13 @@ void Gambit_fn_0227219C(CPUState* cpu) {
         /* 022724B8 */ cpu->ctr = cpu->r[0];
         /* 022724BC */ cpu->r[3] = cpu->r[31];
         /* 022724C0 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 022724C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022724C8 */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022724C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022724C8 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022724C8 */ _t112 = _t111 & 0x00000001u;
         /* 022724C8 */ if (_t112) goto L_02272504; else goto L_022724CC;
   L_022724CC: ; // 0x22724cc
-        /* 022724CC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022724D0 */ _t113 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022724CC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022724D0 */ _t113 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022724D0 */ _t114 = _t113 & 0x00000001u;
         /* 022724D0 */ if (_t114) goto L_02272504; else goto L_022724D4;
   L_022724D4: ; // 0x22724d4
@@ -22763,8 +22763,8 @@ void Gambit_fn_0227251C(CPUState* cpu) {
         /* 0227254C */ cpu->r[12] = 0x10060000u;
         /* 02272550 */ _t4 = cpu->r[12] + 0xFFFF8F18u;
         /* 02272550 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t4);
-        /* 02272554 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
-        /* 02272558 */ _t5 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02272554 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
+        /* 02272558 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02272558 */ _t6 = _t5 & 0x00000001u;
         /* 02272558 */ if (_t6) goto L_0227255C; else goto L_02272578;
   L_0227255C: ; // 0x227255c
@@ -22773,10 +22773,10 @@ void Gambit_fn_0227251C(CPUState* cpu) {
         /* 02272560 */ _t8 = cpu->r[31] + 0x000000A4u;
         /* 02272560 */ cpu->r[3] = rbrew_read32(cpu->mem, _t8);
         /* 02272564 */ cpu->r[10] = cpu->r[10] | 0x00000002u;
-        /* 02272568 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02272568 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0227256C */ _t9 = cpu->r[31] + 0x0000009Cu;
         /* 0227256C */ rbrew_write32(cpu->mem, _t9, cpu->r[10]);
-        /* 02272570 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272570 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272570 */ _t11 = _t10 & 0x00000001u;
         /* 02272570 */ if (_t11) goto L_02272578; else goto L_02272574;
   L_02272574: ; // 0x2272574
@@ -22784,8 +22784,8 @@ void Gambit_fn_0227251C(CPUState* cpu) {
   L_02272578: ; // 0x2272578
         /* 02272578 */ _t12 = cpu->r[31] + 0x00000064u;
         /* 02272578 */ cpu->r[3] = rbrew_read32(cpu->mem, _t12);
-        /* 0227257C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02272580 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227257C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02272580 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272580 */ _t14 = _t13 & 0x00000001u;
         /* 02272580 */ if (_t14) goto L_0227258C; else goto L_02272584;
   L_02272584: ; // 0x2272584
@@ -22831,8 +22831,8 @@ void Gambit_fn_02272520(CPUState* cpu) {
         /* 0227254C */ cpu->r[12] = 0x10060000u;
         /* 02272550 */ _t4 = cpu->r[12] + 0xFFFF8F18u;
         /* 02272550 */ cpu->f[0] = rbrew_read_f32(cpu->mem, _t4);
-        /* 02272554 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[10], cpu->f[0]);
-        /* 02272558 */ _t5 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02272554 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[10], cpu->f[0]));
+        /* 02272558 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02272558 */ _t6 = _t5 & 0x00000001u;
         /* 02272558 */ if (_t6) goto L_0227255C; else goto L_02272578;
   L_0227255C: ; // 0x227255c
@@ -22841,10 +22841,10 @@ void Gambit_fn_02272520(CPUState* cpu) {
         /* 02272560 */ _t8 = cpu->r[31] + 0x000000A4u;
         /* 02272560 */ cpu->r[3] = rbrew_read32(cpu->mem, _t8);
         /* 02272564 */ cpu->r[10] = cpu->r[10] | 0x00000002u;
-        /* 02272568 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02272568 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 0227256C */ _t9 = cpu->r[31] + 0x0000009Cu;
         /* 0227256C */ rbrew_write32(cpu->mem, _t9, cpu->r[10]);
-        /* 02272570 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272570 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272570 */ _t11 = _t10 & 0x00000001u;
         /* 02272570 */ if (_t11) goto L_02272578; else goto L_02272574;
   L_02272574: ; // 0x2272574
@@ -22852,8 +22852,8 @@ void Gambit_fn_02272520(CPUState* cpu) {
   L_02272578: ; // 0x2272578
         /* 02272578 */ _t12 = cpu->r[31] + 0x00000064u;
         /* 02272578 */ cpu->r[3] = rbrew_read32(cpu->mem, _t12);
-        /* 0227257C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02272580 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227257C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02272580 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272580 */ _t14 = _t13 & 0x00000001u;
         /* 02272580 */ if (_t14) goto L_0227258C; else goto L_02272584;
   L_02272584: ; // 0x2272584
@@ -22901,28 +22901,28 @@ void Gambit_fn_022725AC(CPUState* cpu) {
         /* 022725D8 */ _t6 = cpu->r[31] + 0x000000CCu;
         /* 022725D8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
         /* 022725DC */ cpu->r[30] = cpu->r[3];
-        /* 022725E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
-        /* 022725E4 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022725E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
+        /* 022725E4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022725E4 */ _t8 = _t7 & 0x00000001u;
         /* 022725E4 */ if (_t8) goto L_02272620; else goto L_022725E8;
   L_022725E8: ; // 0x22725e8
-        /* 022725E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022725EC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022725E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022725EC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022725EC */ _t10 = _t9 & 0x00000001u;
         /* 022725EC */ if (_t10) goto L_02272610; else goto L_022725F0;
   L_022725F0: ; // 0x22725f0
         /* 022725F0 */ cpu->r[3] = cpu->r[0];
         /* 022725F4 */ Gambit_fn_024AE500(cpu);
         /* 022725F8 */ cpu->r[29] = cpu->r[3];
-        /* 022725F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 022725FC */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022725F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 022725FC */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022725FC */ _t12 = _t11 & 0x00000001u;
         /* 022725FC */ if (_t12) goto L_02272610; else goto L_02272600;
   L_02272600: ; // 0x2272600
         /* 02272600 */ cpu->r[3] = cpu->r[30];
         /* 02272604 */ Gambit_fn_024AE500(cpu);
-        /* 02272608 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[3]);
-        /* 0227260C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272608 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[3]));
+        /* 0227260C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227260C */ _t14 = _t13 & 0x00000001u;
         /* 0227260C */ if (_t14) goto L_02272620; else goto L_02272610;
   L_02272610: ; // 0x2272610
@@ -22969,28 +22969,28 @@ void Gambit_fn_022725B0(CPUState* cpu) {
         /* 022725D8 */ _t6 = cpu->r[31] + 0x000000CCu;
         /* 022725D8 */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
         /* 022725DC */ cpu->r[30] = cpu->r[3];
-        /* 022725E0 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[30]);
-        /* 022725E4 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022725E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[30]));
+        /* 022725E4 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022725E4 */ _t8 = _t7 & 0x00000001u;
         /* 022725E4 */ if (_t8) goto L_02272620; else goto L_022725E8;
   L_022725E8: ; // 0x22725e8
-        /* 022725E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022725EC */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022725E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022725EC */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022725EC */ _t10 = _t9 & 0x00000001u;
         /* 022725EC */ if (_t10) goto L_02272610; else goto L_022725F0;
   L_022725F0: ; // 0x22725f0
         /* 022725F0 */ cpu->r[3] = cpu->r[0];
         /* 022725F4 */ Gambit_fn_024AE500(cpu);
         /* 022725F8 */ cpu->r[29] = cpu->r[3];
-        /* 022725F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 022725FC */ _t11 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022725F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 022725FC */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022725FC */ _t12 = _t11 & 0x00000001u;
         /* 022725FC */ if (_t12) goto L_02272610; else goto L_02272600;
   L_02272600: ; // 0x2272600
         /* 02272600 */ cpu->r[3] = cpu->r[30];
         /* 02272604 */ Gambit_fn_024AE500(cpu);
-        /* 02272608 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[29], cpu->r[3]);
-        /* 0227260C */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272608 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[29], cpu->r[3]));
+        /* 0227260C */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227260C */ _t14 = _t13 & 0x00000001u;
         /* 0227260C */ if (_t14) goto L_02272620; else goto L_02272610;
   L_02272610: ; // 0x2272610
@@ -23092,15 +23092,15 @@ void Gambit_fn_0227267C(CPUState* cpu) {
         /* 02270270 */ _t4 = cpu->r[31] + 0x0000000Cu;
         /* 02270270 */ cpu->r[11] = rbrew_read32(cpu->mem, _t4);
         /* 02270274 */ cpu->r[0] = rbrew_rlwinm(cpu->r[11], 0x0000001Cu, 0x0000001Fu, 0x0000001Fu);
-        /* 02270274 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02270278 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270274 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02270278 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270278 */ _t6 = _t5 & 0x00000001u;
         /* 02270278 */ if (_t6) goto L_0227027C; else goto L_02270498;
   L_0227027C: ; // 0x227027c
         /* 0227027C */ _t7 = cpu->r[31] + 0x00000050u;
         /* 0227027C */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
-        /* 02270280 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000001u);
-        /* 02270284 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270280 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000001u));
+        /* 02270284 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270284 */ _t9 = _t8 & 0x00000001u;
         /* 02270284 */ if (_t9) goto L_02270288; else goto L_0227033C;
   L_02270288: ; // 0x2270288
@@ -23185,8 +23185,8 @@ void Gambit_fn_0227267C(CPUState* cpu) {
   L_0227033C: ; // 0x227033c
         /* 0227033C */ _t43 = cpu->r[31] + 0x000000C8u;
         /* 0227033C */ cpu->r[0] = rbrew_read8(cpu->mem, _t43);
-        /* 02270340 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02270344 */ _t44 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270340 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02270344 */ _t44 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270344 */ _t45 = _t44 & 0x00000001u;
         /* 02270344 */ if (_t45) goto L_02270394; else goto L_02270348;
   L_02270348: ; // 0x2270348
@@ -23200,8 +23200,8 @@ void Gambit_fn_0227267C(CPUState* cpu) {
         /* 02270358 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 0227035C */ _t49 = cpu->r[31] + 0x000000D4u;
         /* 0227035C */ cpu->r[0] = rbrew_read32(cpu->mem, _t49);
-        /* 02270360 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02270364 */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270360 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02270364 */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270364 */ _t51 = _t50 & 0x00000001u;
         /* 02270364 */ if (_t51) goto L_02270498; else goto L_02270368;
   L_02270368: ; // 0x2270368
@@ -23231,15 +23231,15 @@ void Gambit_fn_0227267C(CPUState* cpu) {
         /* 022703A4 */ rbrew_call_indirect(cpu, cpu->ctr);
         /* 022703A8 */ _t59 = cpu->r[31] + 0x00000070u;
         /* 022703A8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t59);
-        /* 022703AC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022703B0 */ _t60 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022703AC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022703B0 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022703B0 */ _t61 = _t60 & 0x00000001u;
         /* 022703B0 */ if (_t61) goto L_022703C4; else goto L_022703B4;
   L_022703B4: ; // 0x22703b4
         /* 022703B4 */ _t62 = cpu->r[31] + 0x00000074u;
         /* 022703B4 */ cpu->r[0] = rbrew_read8(cpu->mem, _t62);
-        /* 022703B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022703BC */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022703B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022703BC */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022703BC */ _t64 = _t63 & 0x00000001u;
         /* 022703BC */ if (_t64) goto L_022703C4; else goto L_022703C0;
   L_022703C0: ; // 0x22703c0
@@ -23256,8 +23256,8 @@ void Gambit_fn_0227267C(CPUState* cpu) {
         /* 022703DC */ Gambit_fn_02270248(cpu);
         /* 022703E0 */ _t67 = cpu->r[31] + 0x00000098u;
         /* 022703E0 */ cpu->r[3] = rbrew_read32(cpu->mem, _t67);
-        /* 022703E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022703E8 */ _t68 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022703E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022703E8 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022703E8 */ _t69 = _t68 & 0x00000001u;
         /* 022703E8 */ if (_t69) goto L_022703FC; else goto L_022703EC;
   L_022703EC: ; // 0x22703ec
@@ -23272,8 +23272,8 @@ void Gambit_fn_0227267C(CPUState* cpu) {
         /* 02270400 */ Gambit_fn_02000658(cpu);
         /* 02270404 */ _t72 = cpu->r[31] + 0x000000D4u;
         /* 02270404 */ cpu->r[0] = rbrew_read32(cpu->mem, _t72);
-        /* 02270408 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0227040C */ _t73 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270408 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0227040C */ _t73 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227040C */ _t74 = _t73 & 0x00000001u;
         /* 0227040C */ if (_t74) goto L_02270424; else goto L_02270410;
   L_02270410: ; // 0x2270410
@@ -23361,8 +23361,8 @@ void Gambit_fn_02272680(CPUState* cpu) {
   L_02272680: ; // 0x2272680
         /* 02272680 */ _t0 = cpu->r[3] + 0x00000070u;
         /* 02272680 */ cpu->r[3] = rbrew_read32(cpu->mem, _t0);
-        /* 02272684 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02272688 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272684 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02272688 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272688 */ _t2 = _t1 & 0x00000001u;
         /* 02272688 */ if (_t2) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02272688 */ goto L_0227268C;
@@ -23450,8 +23450,8 @@ void Gambit_fn_022726CC(CPUState* cpu) {
         /* 022726E0 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 022726E0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 022726E4 */ Gambit_fn_02801A78(cpu);
-        /* 022726E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022726EC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022726E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022726EC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022726EC */ _t4 = _t3 & 0x00000001u;
         /* 022726EC */ if (_t4) goto L_022726F4; else goto L_022726F0;
   L_022726F0: ; // 0x22726f0
@@ -23483,8 +23483,8 @@ void Gambit_fn_022726D0(CPUState* cpu) {
         /* 022726E0 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 022726E0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 022726E4 */ Gambit_fn_02801A78(cpu);
-        /* 022726E8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022726EC */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022726E8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022726EC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022726EC */ _t4 = _t3 & 0x00000001u;
         /* 022726EC */ if (_t4) goto L_022726F4; else goto L_022726F0;
   L_022726F0: ; // 0x22726f0
@@ -23532,9 +23532,9 @@ void Gambit_fn_0227270C(CPUState* cpu) {
         /* 02272744 */ cpu->r[30] = cpu->r[4];
         /* 02272748 */ _t7 = cpu->r[10] + 0x00000104u;
         /* 02272748 */ cpu->r[4] = rbrew_read8(cpu->mem, _t7);
-        /* 0227274C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 0227274C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 02272750 */ cpu->f[31] = cpu->f[1];
-        /* 02272754 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272754 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272754 */ _t9 = _t8 & 0x00000001u;
         /* 02272754 */ if (_t9) goto L_02272774; else goto L_02272758;
   L_02272758: ; // 0x2272758
@@ -23544,8 +23544,8 @@ void Gambit_fn_0227270C(CPUState* cpu) {
         /* 02272764 */ cpu->r[6] = cpu->r[30];
         /* 02272768 */ Gambit_fn_021F000C(cpu);
         /* 0227276C */ cpu->r[31] = cpu->r[3];
-        /* 0227276C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02272770 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227276C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02272770 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272770 */ _t11 = _t10 & 0x00000001u;
         /* 02272770 */ if (_t11) goto L_02272774; else goto L_02272A6C;
   L_02272774: ; // 0x2272774
@@ -23554,15 +23554,15 @@ void Gambit_fn_0227270C(CPUState* cpu) {
         /* 02272778 */ _t13 = cpu->r[3] + 0x00000010u;
         /* 02272778 */ cpu->r[8] = rbrew_read32(cpu->mem, _t13);
         /* 0227277C */ cpu->r[9] = rbrew_rlwinm(cpu->r[8], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 0227277C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02272780 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227277C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02272780 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272780 */ _t15 = _t14 & 0x00000001u;
         /* 02272780 */ if (_t15) goto L_02272978; else goto L_02272784;
   L_02272784: ; // 0x2272784
         /* 02272784 */ _t16 = cpu->r[3] + 0x000000F1u;
         /* 02272784 */ cpu->r[10] = rbrew_read8(cpu->mem, _t16);
-        /* 02272788 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0227278C */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272788 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0227278C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227278C */ _t18 = _t17 & 0x00000001u;
         /* 0227278C */ if (_t18) goto L_02272884; else goto L_02272790;
   L_02272790: ; // 0x2272790
@@ -23649,7 +23649,7 @@ void Gambit_fn_0227270C(CPUState* cpu) {
         /* 02272868 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t44);
         /* 0227286C */ _t45 = cpu->r[1] + 0x000000F8u;
         /* 0227286C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t45);
-        /* 02272870 */ _t46 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02272870 */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02272870 */ _t47 = _t46 & 0x00000001u;
         /* 02272870 */ if (_t47) goto L_02272874; // else: addr-0 trap, fall-through
   L_02272874: ; // 0x2272874
@@ -23742,7 +23742,7 @@ void Gambit_fn_0227270C(CPUState* cpu) {
         /* 0227295C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t74);
         /* 02272960 */ _t75 = cpu->r[1] + 0x000000F8u;
         /* 02272960 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t75);
-        /* 02272964 */ _t76 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02272964 */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02272964 */ _t77 = _t76 & 0x00000001u;
         /* 02272964 */ if (_t77) goto L_02272968; // else: addr-0 trap, fall-through
   L_02272968: ; // 0x2272968
@@ -23834,7 +23834,7 @@ void Gambit_fn_0227270C(CPUState* cpu) {
         /* 02272A50 */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t103);
         /* 02272A54 */ _t104 = cpu->r[1] + 0x000000F8u;
         /* 02272A54 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t104);
-        /* 02272A58 */ _t105 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02272A58 */ _t105 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02272A58 */ _t106 = _t105 & 0x00000001u;
         /* 02272A58 */ if (_t106) goto L_02272A5C; // else: addr-0 trap, fall-through
   L_02272A5C: ; // 0x2272a5c
@@ -23911,7 +23911,7 @@ void Gambit_fn_0227270C(CPUState* cpu) {
         /* 02272B0C */ cpu->f[31] = rbrew_read_f32(cpu->mem, _t130);
         /* 02272B10 */ _t131 = cpu->r[1] + 0x000000F8u;
         /* 02272B10 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t131);
-        /* 02272B14 */ _t132 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02272B14 */ _t132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02272B14 */ _t133 = _t132 & 0x00000001u;
         /* 02272B14 */ if (_t133) goto L_02272B18; // else: addr-0 trap, fall-through
   L_02272B18: ; // 0x2272b18
@@ -23995,9 +23995,9 @@ void Gambit_fn_02272B54(CPUState* cpu) {
         /* 02272B84 */ cpu->r[8] = _t6;
         /* 02272B88 */ cpu->r[31] = cpu->r[3];
         /* 02272B8C */ cpu->r[4] = 0x101D0000u;
-        /* 02272B90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02272B90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02272B94 */ cpu->r[4] = cpu->r[4] + 0xFFFFFFE8u;
-        /* 02272B98 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272B98 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272B98 */ _t8 = _t7 & 0x00000001u;
         /* 02272B98 */ if (_t8) goto L_02272B9C; else goto L_02272BB0;
   L_02272B9C: ; // 0x2272b9c
@@ -24009,8 +24009,8 @@ void Gambit_fn_02272B54(CPUState* cpu) {
         /* 02272BAC */ _t10 = cpu->r[4] + 0x00000000u;
         /* 02272BAC */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
   L_02272BB0: ; // 0x2272bb0
-        /* 02272BB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02272BB4 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272BB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02272BB4 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272BB4 */ _t12 = _t11 & 0x00000001u;
         /* 02272BB4 */ if (_t12) goto L_02272BD4; else goto L_02272BB8;
   L_02272BB8: ; // 0x2272bb8
@@ -24021,8 +24021,8 @@ void Gambit_fn_02272B54(CPUState* cpu) {
         /* 02272BC0 */ cpu->ctr = cpu->r[7];
         /* 02272BC4 */ cpu->r[3] = cpu->r[31];
         /* 02272BC8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02272BCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02272BD0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272BCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02272BD0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272BD0 */ _t16 = _t15 & 0x00000001u;
         /* 02272BD0 */ if (_t16) goto L_02272BD4; else goto L_02272BD8;
   L_02272BD4: ; // 0x2272bd4
@@ -24081,7 +24081,7 @@ void Gambit_fn_02272B54(CPUState* cpu) {
         /* 02272C5C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t33);
         /* 02272C60 */ _t34 = cpu->r[1] + 0x00000030u;
         /* 02272C60 */ cpu->r[30] = rbrew_read32(cpu->mem, _t34);
-        /* 02272C64 */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02272C64 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02272C64 */ _t36 = _t35 & 0x00000001u;
         /* 02272C64 */ if (_t36) goto L_02272C68; // else: addr-0 trap, fall-through
   L_02272C68: ; // 0x2272c68
@@ -24120,9 +24120,9 @@ void Gambit_fn_02272B58(CPUState* cpu) {
         /* 02272B84 */ cpu->r[8] = _t6;
         /* 02272B88 */ cpu->r[31] = cpu->r[3];
         /* 02272B8C */ cpu->r[4] = 0x101D0000u;
-        /* 02272B90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02272B90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02272B94 */ cpu->r[4] = cpu->r[4] + 0xFFFFFFE8u;
-        /* 02272B98 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272B98 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272B98 */ _t8 = _t7 & 0x00000001u;
         /* 02272B98 */ if (_t8) goto L_02272B9C; else goto L_02272BB0;
   L_02272B9C: ; // 0x2272b9c
@@ -24134,8 +24134,8 @@ void Gambit_fn_02272B58(CPUState* cpu) {
         /* 02272BAC */ _t10 = cpu->r[4] + 0x00000000u;
         /* 02272BAC */ rbrew_write32(cpu->mem, _t10, cpu->r[0]);
   L_02272BB0: ; // 0x2272bb0
-        /* 02272BB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02272BB4 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272BB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02272BB4 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272BB4 */ _t12 = _t11 & 0x00000001u;
         /* 02272BB4 */ if (_t12) goto L_02272BD4; else goto L_02272BB8;
   L_02272BB8: ; // 0x2272bb8
@@ -24146,8 +24146,8 @@ void Gambit_fn_02272B58(CPUState* cpu) {
         /* 02272BC0 */ cpu->ctr = cpu->r[7];
         /* 02272BC4 */ cpu->r[3] = cpu->r[31];
         /* 02272BC8 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02272BCC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02272BD0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272BCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02272BD0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272BD0 */ _t16 = _t15 & 0x00000001u;
         /* 02272BD0 */ if (_t16) goto L_02272BD4; else goto L_02272BD8;
   L_02272BD4: ; // 0x2272bd4
@@ -24206,7 +24206,7 @@ void Gambit_fn_02272B58(CPUState* cpu) {
         /* 02272C5C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t33);
         /* 02272C60 */ _t34 = cpu->r[1] + 0x00000030u;
         /* 02272C60 */ cpu->r[30] = rbrew_read32(cpu->mem, _t34);
-        /* 02272C64 */ _t35 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02272C64 */ _t35 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02272C64 */ _t36 = _t35 & 0x00000001u;
         /* 02272C64 */ if (_t36) goto L_02272C68; // else: addr-0 trap, fall-through
   L_02272C68: ; // 0x2272c68
@@ -24240,20 +24240,20 @@ void Gambit_fn_02272C78(CPUState* cpu) {
         /* 02272C98 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
         /* 02272C9C */ _t6 = cpu->r[30] + 0x00000084u;
         /* 02272C9C */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 02272CA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
+        /* 02272CA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
         /* 02272CA4 */ cpu->f[31] = cpu->f[1];
-        /* 02272CA8 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272CA8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272CA8 */ _t8 = _t7 & 0x00000001u;
         /* 02272CA8 */ if (_t8) goto L_02272E88; else goto L_02272CAC;
   L_02272CAC: ; // 0x2272cac
-        /* 02272CAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 02272CAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 02272CB0 */ cpu->r[11] = 0x00000000u;
-        /* 02272CB4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272CB4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272CB4 */ _t10 = _t9 & 0x00000001u;
         /* 02272CB4 */ if (_t10) goto L_02272DB8; else goto L_02272CB8;
   L_02272CB8: ; // 0x2272cb8
-        /* 02272CB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 02272CBC */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272CB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 02272CBC */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272CBC */ _t12 = _t11 & 0x00000001u;
         /* 02272CBC */ if (_t12) goto L_02272CC0; else goto L_02272CC4;
   L_02272CC0: ; // 0x2272cc0
@@ -24370,8 +24370,8 @@ void Gambit_fn_02272C78(CPUState* cpu) {
         /* 02272DB8 */ cpu->r[11] = 0x10060000u;
         /* 02272DBC */ _t59 = cpu->r[11] + 0xFFFF8F18u;
         /* 02272DBC */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t59);
-        /* 02272DC0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[9]);
-        /* 02272DC4 */ _t60 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02272DC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[9]));
+        /* 02272DC4 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02272DC4 */ _t61 = _t60 & 0x00000001u;
         /* 02272DC4 */ if (_t61) goto L_02272DC8; else goto L_02272E2C;
   L_02272DC8: ; // 0x2272dc8
@@ -24383,9 +24383,9 @@ void Gambit_fn_02272C78(CPUState* cpu) {
         /* 02272DD4 */ cpu->r[5] = _t62;
         /* 02272DD8 */ cpu->r[4] = 0x101D0000u;
         /* 02272DDC */ cpu->r[31] = cpu->r[3];
-        /* 02272DE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02272DE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02272DE4 */ cpu->r[4] = cpu->r[4] + 0xFFFFFFE8u;
-        /* 02272DE8 */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272DE8 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272DE8 */ _t64 = _t63 & 0x00000001u;
         /* 02272DE8 */ if (_t64) goto L_02272DEC; else goto L_02272E00;
   L_02272DEC: ; // 0x2272dec
@@ -24397,8 +24397,8 @@ void Gambit_fn_02272C78(CPUState* cpu) {
         /* 02272DFC */ _t66 = cpu->r[4] + 0x00000000u;
         /* 02272DFC */ rbrew_write32(cpu->mem, _t66, cpu->r[6]);
   L_02272E00: ; // 0x2272e00
-        /* 02272E00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02272E04 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272E00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02272E04 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272E04 */ _t68 = _t67 & 0x00000001u;
         /* 02272E04 */ if (_t68) goto L_02272E24; else goto L_02272E08;
   L_02272E08: ; // 0x2272e08
@@ -24409,8 +24409,8 @@ void Gambit_fn_02272C78(CPUState* cpu) {
         /* 02272E10 */ cpu->ctr = cpu->r[8];
         /* 02272E14 */ cpu->r[3] = cpu->r[31];
         /* 02272E18 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02272E1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02272E20 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272E1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02272E20 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272E20 */ _t72 = _t71 & 0x00000001u;
         /* 02272E20 */ if (_t72) goto L_02272E24; else goto L_02272E28;
   L_02272E24: ; // 0x2272e24
@@ -24462,7 +24462,7 @@ void Gambit_fn_02272C78(CPUState* cpu) {
         /* 02272E90 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t87);
         /* 02272E94 */ _t88 = cpu->r[1] + 0x00000078u;
         /* 02272E94 */ cpu->r[30] = rbrew_read32(cpu->mem, _t88);
-        /* 02272E98 */ _t89 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02272E98 */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02272E98 */ _t90 = _t89 & 0x00000001u;
         /* 02272E98 */ if (_t90) goto L_02272E9C; // else: addr-0 trap, fall-through
   L_02272E9C: ; // 0x2272e9c
@@ -24495,20 +24495,20 @@ void Gambit_fn_02272C7C(CPUState* cpu) {
         /* 02272C98 */ rbrew_write32(cpu->mem, _t5, cpu->r[0]);
         /* 02272C9C */ _t6 = cpu->r[30] + 0x00000084u;
         /* 02272C9C */ cpu->r[0] = rbrew_read32(cpu->mem, _t6);
-        /* 02272CA0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000001u);
+        /* 02272CA0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000001u));
         /* 02272CA4 */ cpu->f[31] = cpu->f[1];
-        /* 02272CA8 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272CA8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272CA8 */ _t8 = _t7 & 0x00000001u;
         /* 02272CA8 */ if (_t8) goto L_02272E88; else goto L_02272CAC;
   L_02272CAC: ; // 0x2272cac
-        /* 02272CAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
+        /* 02272CAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
         /* 02272CB0 */ cpu->r[11] = 0x00000000u;
-        /* 02272CB4 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272CB4 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272CB4 */ _t10 = _t9 & 0x00000001u;
         /* 02272CB4 */ if (_t10) goto L_02272DB8; else goto L_02272CB8;
   L_02272CB8: ; // 0x2272cb8
-        /* 02272CB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 02272CBC */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272CB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 02272CBC */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272CBC */ _t12 = _t11 & 0x00000001u;
         /* 02272CBC */ if (_t12) goto L_02272CC0; else goto L_02272CC4;
   L_02272CC0: ; // 0x2272cc0
@@ -24625,8 +24625,8 @@ void Gambit_fn_02272C7C(CPUState* cpu) {
         /* 02272DB8 */ cpu->r[11] = 0x10060000u;
         /* 02272DBC */ _t59 = cpu->r[11] + 0xFFFF8F18u;
         /* 02272DBC */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t59);
-        /* 02272DC0 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[31], cpu->f[9]);
-        /* 02272DC4 */ _t60 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02272DC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[31], cpu->f[9]));
+        /* 02272DC4 */ _t60 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02272DC4 */ _t61 = _t60 & 0x00000001u;
         /* 02272DC4 */ if (_t61) goto L_02272DC8; else goto L_02272E2C;
   L_02272DC8: ; // 0x2272dc8
@@ -24638,9 +24638,9 @@ void Gambit_fn_02272C7C(CPUState* cpu) {
         /* 02272DD4 */ cpu->r[5] = _t62;
         /* 02272DD8 */ cpu->r[4] = 0x101D0000u;
         /* 02272DDC */ cpu->r[31] = cpu->r[3];
-        /* 02272DE0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02272DE0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 02272DE4 */ cpu->r[4] = cpu->r[4] + 0xFFFFFFE8u;
-        /* 02272DE8 */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272DE8 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272DE8 */ _t64 = _t63 & 0x00000001u;
         /* 02272DE8 */ if (_t64) goto L_02272DEC; else goto L_02272E00;
   L_02272DEC: ; // 0x2272dec
@@ -24652,8 +24652,8 @@ void Gambit_fn_02272C7C(CPUState* cpu) {
         /* 02272DFC */ _t66 = cpu->r[4] + 0x00000000u;
         /* 02272DFC */ rbrew_write32(cpu->mem, _t66, cpu->r[6]);
   L_02272E00: ; // 0x2272e00
-        /* 02272E00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02272E04 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272E00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02272E04 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272E04 */ _t68 = _t67 & 0x00000001u;
         /* 02272E04 */ if (_t68) goto L_02272E24; else goto L_02272E08;
   L_02272E08: ; // 0x2272e08
@@ -24664,8 +24664,8 @@ void Gambit_fn_02272C7C(CPUState* cpu) {
         /* 02272E10 */ cpu->ctr = cpu->r[8];
         /* 02272E14 */ cpu->r[3] = cpu->r[31];
         /* 02272E18 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02272E1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02272E20 */ _t71 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272E1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02272E20 */ _t71 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272E20 */ _t72 = _t71 & 0x00000001u;
         /* 02272E20 */ if (_t72) goto L_02272E24; else goto L_02272E28;
   L_02272E24: ; // 0x2272e24
@@ -24717,7 +24717,7 @@ void Gambit_fn_02272C7C(CPUState* cpu) {
         /* 02272E90 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t87);
         /* 02272E94 */ _t88 = cpu->r[1] + 0x00000078u;
         /* 02272E94 */ cpu->r[30] = rbrew_read32(cpu->mem, _t88);
-        /* 02272E98 */ _t89 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02272E98 */ _t89 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02272E98 */ _t90 = _t89 & 0x00000001u;
         /* 02272E98 */ if (_t90) goto L_02272E9C; // else: addr-0 trap, fall-through
   L_02272E9C: ; // 0x2272e9c
@@ -24814,9 +24814,9 @@ void Gambit_fn_02272EF4(CPUState* cpu) {
         /* 02272F1C */ cpu->r[27] = 0x101D0000u;
         /* 02272F20 */ cpu->r[31] = cpu->r[3];
         /* 02272F24 */ cpu->r[29] = 0x10060000u;
-        /* 02272F28 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 02272F28 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 02272F2C */ cpu->r[29] = cpu->r[29] + 0xFFFF9008u;
-        /* 02272F30 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272F30 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272F30 */ _t4 = _t3 & 0x00000001u;
         /* 02272F30 */ if (_t4) goto L_02272F34; else goto L_02272F40;
   L_02272F34: ; // 0x2272f34
@@ -24826,8 +24826,8 @@ void Gambit_fn_02272EF4(CPUState* cpu) {
         /* 02272F3C */ _t6 = cpu->r[28] + 0x00000000u;
         /* 02272F3C */ rbrew_write32(cpu->mem, _t6, cpu->r[11]);
   L_02272F40: ; // 0x2272f40
-        /* 02272F40 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02272F44 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272F40 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02272F44 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272F44 */ _t8 = _t7 & 0x00000001u;
         /* 02272F44 */ if (_t8) goto L_02272F68; else goto L_02272F48;
   L_02272F48: ; // 0x2272f48
@@ -24839,8 +24839,8 @@ void Gambit_fn_02272EF4(CPUState* cpu) {
         /* 02272F54 */ cpu->r[3] = cpu->r[31];
         /* 02272F58 */ cpu->r[4] = cpu->r[27] + 0xFFFFFFE8u;
         /* 02272F5C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02272F60 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02272F64 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272F60 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02272F64 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272F64 */ _t12 = _t11 & 0x00000001u;
         /* 02272F64 */ if (_t12) goto L_02272F68; else goto L_02272F6C;
   L_02272F68: ; // 0x2272f68
@@ -24854,9 +24854,9 @@ void Gambit_fn_02272EF4(CPUState* cpu) {
         /* 02272F78 */ Gambit_fn_0226ED34(cpu);
         /* 02272F7C */ _t15 = cpu->r[28] + 0x00000000u;
         /* 02272F7C */ cpu->r[6] = rbrew_read32(cpu->mem, _t15);
-        /* 02272F80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02272F80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 02272F84 */ cpu->r[31] = cpu->r[3];
-        /* 02272F88 */ _t16 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272F88 */ _t16 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272F88 */ _t17 = _t16 & 0x00000001u;
         /* 02272F88 */ if (_t17) goto L_02272F8C; else goto L_02272F98;
   L_02272F8C: ; // 0x2272f8c
@@ -24866,8 +24866,8 @@ void Gambit_fn_02272EF4(CPUState* cpu) {
         /* 02272F94 */ _t19 = cpu->r[28] + 0x00000000u;
         /* 02272F94 */ rbrew_write32(cpu->mem, _t19, cpu->r[7]);
   L_02272F98: ; // 0x2272f98
-        /* 02272F98 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02272F9C */ _t20 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272F98 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02272F9C */ _t20 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272F9C */ _t21 = _t20 & 0x00000001u;
         /* 02272F9C */ if (_t21) goto L_02272FC0; else goto L_02272FA0;
   L_02272FA0: ; // 0x2272fa0
@@ -24879,8 +24879,8 @@ void Gambit_fn_02272EF4(CPUState* cpu) {
         /* 02272FAC */ cpu->r[3] = cpu->r[31];
         /* 02272FB0 */ cpu->r[4] = cpu->r[27] + 0xFFFFFFE8u;
         /* 02272FB4 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02272FB8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02272FBC */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272FB8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02272FBC */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272FBC */ _t25 = _t24 & 0x00000001u;
         /* 02272FBC */ if (_t25) goto L_02272FC0; else goto L_02272FC4;
   L_02272FC0: ; // 0x2272fc0
@@ -24894,9 +24894,9 @@ void Gambit_fn_02272EF4(CPUState* cpu) {
         /* 02272FD0 */ Gambit_fn_0226ED34(cpu);
         /* 02272FD4 */ _t28 = cpu->r[28] + 0x00000000u;
         /* 02272FD4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t28);
-        /* 02272FD8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02272FD8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02272FDC */ cpu->r[31] = cpu->r[3];
-        /* 02272FE0 */ _t29 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272FE0 */ _t29 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272FE0 */ _t30 = _t29 & 0x00000001u;
         /* 02272FE0 */ if (_t30) goto L_02272FE4; else goto L_02272FF0;
   L_02272FE4: ; // 0x2272fe4
@@ -24906,8 +24906,8 @@ void Gambit_fn_02272EF4(CPUState* cpu) {
         /* 02272FEC */ _t32 = cpu->r[28] + 0x00000000u;
         /* 02272FEC */ rbrew_write32(cpu->mem, _t32, cpu->r[11]);
   L_02272FF0: ; // 0x2272ff0
-        /* 02272FF0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02272FF4 */ _t33 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02272FF0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02272FF4 */ _t33 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02272FF4 */ _t34 = _t33 & 0x00000001u;
         /* 02272FF4 */ if (_t34) goto L_02273018; else goto L_02272FF8;
   L_02272FF8: ; // 0x2272ff8
@@ -24919,8 +24919,8 @@ void Gambit_fn_02272EF4(CPUState* cpu) {
         /* 02273004 */ cpu->r[3] = cpu->r[31];
         /* 02273008 */ cpu->r[4] = cpu->r[27] + 0xFFFFFFE8u;
         /* 0227300C */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02273010 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02273014 */ _t37 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273010 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02273014 */ _t37 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273014 */ _t38 = _t37 & 0x00000001u;
         /* 02273014 */ if (_t38) goto L_02273018; else goto L_0227301C;
   L_02273018: ; // 0x2273018
@@ -24934,9 +24934,9 @@ void Gambit_fn_02272EF4(CPUState* cpu) {
         /* 02273028 */ Gambit_fn_0226ED34(cpu);
         /* 0227302C */ _t41 = cpu->r[28] + 0x00000000u;
         /* 0227302C */ cpu->r[6] = rbrew_read32(cpu->mem, _t41);
-        /* 02273030 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
+        /* 02273030 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
         /* 02273034 */ cpu->r[31] = cpu->r[3];
-        /* 02273038 */ _t42 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273038 */ _t42 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273038 */ _t43 = _t42 & 0x00000001u;
         /* 02273038 */ if (_t43) goto L_0227303C; else goto L_02273048;
   L_0227303C: ; // 0x227303c
@@ -24946,8 +24946,8 @@ void Gambit_fn_02272EF4(CPUState* cpu) {
         /* 02273044 */ _t45 = cpu->r[28] + 0x00000000u;
         /* 02273044 */ rbrew_write32(cpu->mem, _t45, cpu->r[7]);
   L_02273048: ; // 0x2273048
-        /* 02273048 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0227304C */ _t46 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273048 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0227304C */ _t46 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227304C */ _t47 = _t46 & 0x00000001u;
         /* 0227304C */ if (_t47) goto L_02273070; else goto L_02273050;
   L_02273050: ; // 0x2273050
@@ -24959,8 +24959,8 @@ void Gambit_fn_02272EF4(CPUState* cpu) {
         /* 0227305C */ cpu->r[3] = cpu->r[31];
         /* 02273060 */ cpu->r[4] = cpu->r[27] + 0xFFFFFFE8u;
         /* 02273064 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02273068 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0227306C */ _t50 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273068 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0227306C */ _t50 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227306C */ _t51 = _t50 & 0x00000001u;
         /* 0227306C */ if (_t51) goto L_02273070; else goto L_02273074;
   L_02273070: ; // 0x2273070
@@ -24974,9 +24974,9 @@ void Gambit_fn_02272EF4(CPUState* cpu) {
         /* 02273080 */ Gambit_fn_0226ED34(cpu);
         /* 02273084 */ _t54 = cpu->r[28] + 0x00000000u;
         /* 02273084 */ cpu->r[0] = rbrew_read32(cpu->mem, _t54);
-        /* 02273088 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02273088 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0227308C */ cpu->r[31] = cpu->r[3];
-        /* 02273090 */ _t55 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273090 */ _t55 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273090 */ _t56 = _t55 & 0x00000001u;
         /* 02273090 */ if (_t56) goto L_02273094; else goto L_022730A0;
   L_02273094: ; // 0x2273094
@@ -24986,8 +24986,8 @@ void Gambit_fn_02272EF4(CPUState* cpu) {
         /* 0227309C */ _t58 = cpu->r[28] + 0x00000000u;
         /* 0227309C */ rbrew_write32(cpu->mem, _t58, cpu->r[6]);
   L_022730A0: ; // 0x22730a0
-        /* 022730A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022730A4 */ _t59 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022730A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022730A4 */ _t59 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022730A4 */ _t60 = _t59 & 0x00000001u;
         /* 022730A4 */ if (_t60) goto L_022730C8; else goto L_022730A8;
   L_022730A8: ; // 0x22730a8
@@ -24999,8 +24999,8 @@ void Gambit_fn_02272EF4(CPUState* cpu) {
         /* 022730B4 */ cpu->r[3] = cpu->r[31];
         /* 022730B8 */ cpu->r[4] = cpu->r[27] + 0xFFFFFFE8u;
         /* 022730BC */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 022730C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022730C4 */ _t63 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022730C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022730C4 */ _t63 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022730C4 */ _t64 = _t63 & 0x00000001u;
         /* 022730C4 */ if (_t64) goto L_022730C8; else goto L_022730CC;
   L_022730C8: ; // 0x22730c8
@@ -25014,9 +25014,9 @@ void Gambit_fn_02272EF4(CPUState* cpu) {
         /* 022730D8 */ Gambit_fn_0226ED34(cpu);
         /* 022730DC */ _t67 = cpu->r[28] + 0x00000000u;
         /* 022730DC */ cpu->r[10] = rbrew_read32(cpu->mem, _t67);
-        /* 022730E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
+        /* 022730E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
         /* 022730E4 */ cpu->r[31] = cpu->r[3];
-        /* 022730E8 */ _t68 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022730E8 */ _t68 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022730E8 */ _t69 = _t68 & 0x00000001u;
         /* 022730E8 */ if (_t69) goto L_022730EC; else goto L_022730F8;
   L_022730EC: ; // 0x22730ec
@@ -25026,8 +25026,8 @@ void Gambit_fn_02272EF4(CPUState* cpu) {
         /* 022730F4 */ _t71 = cpu->r[28] + 0x00000000u;
         /* 022730F4 */ rbrew_write32(cpu->mem, _t71, cpu->r[11]);
   L_022730F8: ; // 0x22730f8
-        /* 022730F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022730FC */ _t72 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022730F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022730FC */ _t72 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022730FC */ _t73 = _t72 & 0x00000001u;
         /* 022730FC */ if (_t73) goto L_02273120; else goto L_02273100;
   L_02273100: ; // 0x2273100
@@ -25039,8 +25039,8 @@ void Gambit_fn_02272EF4(CPUState* cpu) {
         /* 0227310C */ cpu->r[3] = cpu->r[31];
         /* 02273110 */ cpu->r[4] = cpu->r[27] + 0xFFFFFFE8u;
         /* 02273114 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02273118 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0227311C */ _t76 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273118 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0227311C */ _t76 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227311C */ _t77 = _t76 & 0x00000001u;
         /* 0227311C */ if (_t77) goto L_02273120; else goto L_02273124;
   L_02273120: ; // 0x2273120
@@ -25070,9 +25070,9 @@ void Gambit_fn_02273140(CPUState* cpu) {
         /* 02273148 */ cpu->r[0] = rbrew_read32(cpu->mem, _t1);
         /* 0227314C */ _t2 = cpu->r[11] + 0x0000026Cu;
         /* 0227314C */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 02273150 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], 0x00000022u);
+        /* 02273150 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], 0x00000022u));
         /* 02273154 */ cpu->r[12] = cpu->r[12] + 0x00000250u;
-        /* 02273158 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02273158 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02273158 */ _t4 = _t3 & 0x00000001u;
         /* 02273158 */ if (_t4) goto L_0227315C; else goto L_02273160;
   L_0227315C: ; // 0x227315c
@@ -25099,15 +25099,15 @@ void Gambit_fn_02273168(CPUState* cpu) {
         /* 02273178 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0227317C */ _t3 = cpu->r[31] + 0x00000024u;
         /* 0227317C */ cpu->r[9] = rbrew_read32(cpu->mem, _t3);
-        /* 02273180 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02273184 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273180 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02273184 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273184 */ _t5 = _t4 & 0x00000001u;
         /* 02273184 */ if (_t5) goto L_02273188; else goto L_022731D0;
   L_02273188: ; // 0x2273188
         /* 02273188 */ cpu->r[3] = cpu->r[31];
         /* 0227318C */ Gambit_fn_0226ED34(cpu);
-        /* 02273190 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02273194 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273190 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02273194 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273194 */ _t7 = _t6 & 0x00000001u;
         /* 02273194 */ if (_t7) goto L_022731AC; else goto L_02273198;
   L_02273198: ; // 0x2273198
@@ -25121,8 +25121,8 @@ void Gambit_fn_02273168(CPUState* cpu) {
   L_022731AC: ; // 0x22731ac
         /* 022731AC */ cpu->r[3] = cpu->r[31];
         /* 022731B0 */ Gambit_fn_0226F680(cpu);
-        /* 022731B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022731B8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022731B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022731B8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022731B8 */ _t11 = _t10 & 0x00000001u;
         /* 022731B8 */ if (_t11) goto L_022731D0; else goto L_022731BC;
   L_022731BC: ; // 0x22731bc
@@ -25165,15 +25165,15 @@ void Gambit_fn_0227316C(CPUState* cpu) {
         /* 02273178 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0227317C */ _t3 = cpu->r[31] + 0x00000024u;
         /* 0227317C */ cpu->r[9] = rbrew_read32(cpu->mem, _t3);
-        /* 02273180 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000000u);
-        /* 02273184 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273180 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000000u));
+        /* 02273184 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273184 */ _t5 = _t4 & 0x00000001u;
         /* 02273184 */ if (_t5) goto L_02273188; else goto L_022731D0;
   L_02273188: ; // 0x2273188
         /* 02273188 */ cpu->r[3] = cpu->r[31];
         /* 0227318C */ Gambit_fn_0226ED34(cpu);
-        /* 02273190 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02273194 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273190 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02273194 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273194 */ _t7 = _t6 & 0x00000001u;
         /* 02273194 */ if (_t7) goto L_022731AC; else goto L_02273198;
   L_02273198: ; // 0x2273198
@@ -25187,8 +25187,8 @@ void Gambit_fn_0227316C(CPUState* cpu) {
   L_022731AC: ; // 0x22731ac
         /* 022731AC */ cpu->r[3] = cpu->r[31];
         /* 022731B0 */ Gambit_fn_0226F680(cpu);
-        /* 022731B4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022731B8 */ _t10 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022731B4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022731B8 */ _t10 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022731B8 */ _t11 = _t10 & 0x00000001u;
         /* 022731B8 */ if (_t11) goto L_022731D0; else goto L_022731BC;
   L_022731BC: ; // 0x22731bc
@@ -25458,20 +25458,20 @@ void Gambit_fn_022731F8(CPUState* cpu) {
         /* 022733F0 */ cpu->r[12] = 0x10060000u;
         /* 022733F4 */ _t97 = cpu->r[26] + 0x0000000Cu;
         /* 022733F4 */ cpu->r[0] = rbrew_read32(cpu->mem, _t97);
-        /* 022733F8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u);
+        /* 022733F8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF40u));
         /* 022733FC */ _t98 = cpu->r[12] + 0xFFFF8F14u;
         /* 022733FC */ cpu->f[29] = rbrew_read_f32(cpu->mem, _t98);
         /* 02273400 */ cpu->r[3] = cpu->r[31] + 0x000000C0u;
         /* 02273404 */ _t99 = cpu->r[31] + 0x000000ACu;
         /* 02273404 */ rbrew_write32(cpu->mem, _t99, cpu->r[0]);
-        /* 02273408 */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273408 */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273408 */ _t101 = _t100 & 0x00000001u;
         /* 02273408 */ if (_t101) goto L_0227340C; else goto L_0227341C;
   L_0227340C: ; // 0x227340c
         /* 0227340C */ cpu->r[3] = 0x00000010u;
         /* 02273410 */ Gambit_fn_02801A78(cpu);
-        /* 02273414 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02273418 */ _t102 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273414 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02273418 */ _t102 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273418 */ _t103 = _t102 & 0x00000001u;
         /* 02273418 */ if (_t103) goto L_02273434; else goto L_0227341C;
   L_0227341C: ; // 0x227341c
@@ -25487,16 +25487,16 @@ void Gambit_fn_022731F8(CPUState* cpu) {
         /* 02273430 */ _t108 = cpu->r[3] + 0x00000000u;
         /* 02273430 */ rbrew_write_f32(cpu->mem, _t108, cpu->f[11]);
   L_02273434: ; // 0x2273434
-        /* 02273434 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u);
+        /* 02273434 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0xFFFFFF30u));
         /* 02273438 */ cpu->r[3] = cpu->r[31] + 0x000000D0u;
-        /* 0227343C */ _t109 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227343C */ _t109 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227343C */ _t110 = _t109 & 0x00000001u;
         /* 0227343C */ if (_t110) goto L_02273440; else goto L_02273450;
   L_02273440: ; // 0x2273440
         /* 02273440 */ cpu->r[3] = 0x00000010u;
         /* 02273444 */ Gambit_fn_02801A78(cpu);
-        /* 02273448 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0227344C */ _t111 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273448 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0227344C */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227344C */ _t112 = _t111 & 0x00000001u;
         /* 0227344C */ if (_t112) goto L_02273468; else goto L_02273450;
   L_02273450: ; // 0x2273450
@@ -25585,7 +25585,7 @@ void Gambit_fn_022731F8(CPUState* cpu) {
         /* 0227350C */ cpu->f[30] = rbrew_read_f64(cpu->mem, _t144);
         /* 02273510 */ _t145 = cpu->r[1] + 0x00000048u;
         /* 02273510 */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t145);
-        /* 02273514 */ _t146 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02273514 */ _t146 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02273514 */ _t147 = _t146 & 0x00000001u;
         /* 02273514 */ if (_t147) goto L_02273518; // else: addr-0 trap, fall-through
   L_02273518: ; // 0x2273518
@@ -25601,15 +25601,15 @@ void Gambit_fn_02273528(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02273528: ; // 0x2273528
-        /* 02273528 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0227352C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273528 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0227352C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227352C */ _t1 = _t0 & 0x00000001u;
         /* 0227352C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0227352C */ goto L_02273530;
   L_02273530: ; // 0x2273530
         /* 02273530 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02273530 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02273534 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273530 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02273534 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273534 */ _t3 = _t2 & 0x00000001u;
         /* 02273534 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02273534 */ goto L_02273538;
@@ -25628,8 +25628,8 @@ void Gambit_fn_02273528(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -25643,15 +25643,15 @@ void Gambit_fn_02273528(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -25685,15 +25685,15 @@ void Gambit_fn_02273540(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02273540: ; // 0x2273540
-        /* 02273540 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02273544 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273540 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02273544 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273544 */ _t1 = _t0 & 0x00000001u;
         /* 02273544 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02273544 */ goto L_02273548;
   L_02273548: ; // 0x2273548
         /* 02273548 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02273548 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0227354C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273548 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0227354C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227354C */ _t3 = _t2 & 0x00000001u;
         /* 0227354C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0227354C */ goto L_02273550;
@@ -25712,8 +25712,8 @@ void Gambit_fn_02273540(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -25727,15 +25727,15 @@ void Gambit_fn_02273540(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -25781,15 +25781,15 @@ void Gambit_fn_02273570(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02273570: ; // 0x2273570
-        /* 02273570 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02273574 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273570 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02273574 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273574 */ _t1 = _t0 & 0x00000001u;
         /* 02273574 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02273574 */ goto L_02273578;
   L_02273578: ; // 0x2273578
         /* 02273578 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02273578 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0227357C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273578 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0227357C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227357C */ _t3 = _t2 & 0x00000001u;
         /* 0227357C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0227357C */ goto L_02273580;
@@ -25808,8 +25808,8 @@ void Gambit_fn_02273570(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -25823,15 +25823,15 @@ void Gambit_fn_02273570(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -25859,15 +25859,15 @@ void Gambit_fn_02273584(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02273584: ; // 0x2273584
-        /* 02273584 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02273588 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273584 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02273588 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273588 */ _t1 = _t0 & 0x00000001u;
         /* 02273588 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02273588 */ goto L_0227358C;
   L_0227358C: ; // 0x227358c
         /* 0227358C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0227358C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02273590 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227358C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02273590 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273590 */ _t3 = _t2 & 0x00000001u;
         /* 02273590 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02273590 */ goto L_02273594;
@@ -25886,8 +25886,8 @@ void Gambit_fn_02273584(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -25901,15 +25901,15 @@ void Gambit_fn_02273584(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -25937,15 +25937,15 @@ void Gambit_fn_02273598(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02273598: ; // 0x2273598
-        /* 02273598 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0227359C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273598 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0227359C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227359C */ _t1 = _t0 & 0x00000001u;
         /* 0227359C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0227359C */ goto L_022735A0;
   L_022735A0: ; // 0x22735a0
         /* 022735A0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022735A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022735A4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022735A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022735A4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022735A4 */ _t3 = _t2 & 0x00000001u;
         /* 022735A4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022735A4 */ goto L_022735A8;
@@ -25964,8 +25964,8 @@ void Gambit_fn_02273598(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -25979,15 +25979,15 @@ void Gambit_fn_02273598(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -26089,8 +26089,8 @@ void Gambit_fn_022735DC(CPUState* cpu) {
   L_022735DC: ; // 0x22735dc
         /* 022735DC */ _t0 = cpu->r[3] + 0x00000008u;
         /* 022735DC */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 022735E0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022735E4 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022735E0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022735E4 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022735E4 */ _t2 = _t1 & 0x00000001u;
         /* 022735E4 */ if (_t2) goto L_022735F0; else goto L_022735E8;
   L_022735E8: ; // 0x22735e8
@@ -26108,8 +26108,8 @@ void Gambit_fn_022735F8(CPUState* cpu) {
   L_022735F8: ; // 0x22735f8
         /* 022735F8 */ _t0 = cpu->r[3] + 0x00000008u;
         /* 022735F8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 022735FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02273600 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022735FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02273600 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273600 */ _t2 = _t1 & 0x00000001u;
         /* 02273600 */ if (_t2) goto L_0227360C; else goto L_02273604;
   L_02273604: ; // 0x2273604
@@ -26128,8 +26128,8 @@ void Gambit_fn_02273614(CPUState* cpu) {
         /* 02273614 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02273614 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02273618 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 02273618 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 0227361C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273618 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 0227361C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227361C */ _t2 = _t1 & 0x00000001u;
         /* 0227361C */ _t3 = _t2 ^ 0x00000001u;
         /* 0227361C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -26151,8 +26151,8 @@ void Gambit_fn_02273630(CPUState* cpu) {
         /* 02273630 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02273630 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02273634 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 02273634 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02273638 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273634 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02273638 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273638 */ _t2 = _t1 & 0x00000001u;
         /* 02273638 */ _t3 = _t2 ^ 0x00000001u;
         /* 02273638 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -26174,8 +26174,8 @@ void Gambit_fn_0227364C(CPUState* cpu) {
         /* 0227364C */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 0227364C */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02273650 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 02273650 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02273654 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273650 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02273654 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273654 */ _t2 = _t1 & 0x00000001u;
         /* 02273654 */ _t3 = _t2 ^ 0x00000001u;
         /* 02273654 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -26218,8 +26218,8 @@ void Gambit_fn_02273678(CPUState* cpu) {
         /* 02273688 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0227368C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0227368C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02273690 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02273694 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273690 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02273694 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273694 */ _t5 = _t4 & 0x00000001u;
         /* 02273694 */ if (_t5) goto L_02273698; else goto L_022736B4;
   L_02273698: ; // 0x2273698
@@ -26258,8 +26258,8 @@ void Gambit_fn_0227367C(CPUState* cpu) {
         /* 02273688 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 0227368C */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 0227368C */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02273690 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02273694 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273690 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02273694 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273694 */ _t5 = _t4 & 0x00000001u;
         /* 02273694 */ if (_t5) goto L_02273698; else goto L_022736B4;
   L_02273698: ; // 0x2273698
@@ -26375,10 +26375,10 @@ void Gambit_fn_02273720(CPUState* cpu) {
         /* 02273720 */ cpu->r[12] = 0x101D0000u;
         /* 02273724 */ _t0 = cpu->r[12] + 0xFFFFDAC0u;
         /* 02273724 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 02273728 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
+        /* 02273728 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
         /* 0227372C */ cpu->r[12] = 0x101D0000u;
         /* 02273730 */ cpu->r[12] = cpu->r[12] + 0xFFFFFBC4u;
-        /* 02273734 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273734 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273734 */ _t2 = _t1 & 0x00000001u;
         /* 02273734 */ if (_t2) goto L_02273738; else goto L_02273750;
   L_02273738: ; // 0x2273738
@@ -26391,8 +26391,8 @@ void Gambit_fn_02273720(CPUState* cpu) {
         /* 0227374C */ _t4 = cpu->r[12] + 0x00000000u;
         /* 0227374C */ rbrew_write32(cpu->mem, _t4, cpu->r[0]);
   L_02273750: ; // 0x2273750
-        /* 02273750 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[12]);
-        /* 02273754 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273750 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[12]));
+        /* 02273754 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273754 */ _t6 = _t5 & 0x00000001u;
         /* 02273754 */ if (_t6) goto L_02273758; else goto L_02273760;
   L_02273758: ; // 0x2273758
@@ -26404,9 +26404,9 @@ void Gambit_fn_02273720(CPUState* cpu) {
         /* 02273764 */ cpu->r[8] = rbrew_read32(cpu->mem, _t7);
         /* 02273764 */ cpu->r[11] = _t7;
         /* 02273768 */ cpu->r[10] = 0x101D0000u;
-        /* 0227376C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[8], 0x00000000u);
+        /* 0227376C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[8], 0x00000000u));
         /* 02273770 */ cpu->r[10] = cpu->r[10] + 0xFFFFD4ECu;
-        /* 02273774 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273774 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273774 */ _t9 = _t8 & 0x00000001u;
         /* 02273774 */ if (_t9) goto L_02273778; else goto L_0227378C;
   L_02273778: ; // 0x2273778
@@ -26418,8 +26418,8 @@ void Gambit_fn_02273720(CPUState* cpu) {
         /* 02273788 */ _t11 = cpu->r[10] + 0x00000000u;
         /* 02273788 */ rbrew_write32(cpu->mem, _t11, cpu->r[12]);
   L_0227378C: ; // 0x227378c
-        /* 0227378C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[4], cpu->r[10]);
-        /* 02273790 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227378C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[4], cpu->r[10]));
+        /* 02273790 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273790 */ _t13 = _t12 & 0x00000001u;
         /* 02273790 */ if (_t13) goto L_02273794; else goto L_0227379C;
   L_02273794: ; // 0x2273794
@@ -26431,9 +26431,9 @@ void Gambit_fn_02273720(CPUState* cpu) {
         /* 022737A0 */ cpu->r[0] = rbrew_read32(cpu->mem, _t14);
         /* 022737A0 */ cpu->r[8] = _t14;
         /* 022737A4 */ cpu->r[11] = 0x101D0000u;
-        /* 022737A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 022737A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 022737AC */ cpu->r[11] = cpu->r[11] + 0xFFFFD4E4u;
-        /* 022737B0 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022737B0 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022737B0 */ _t16 = _t15 & 0x00000001u;
         /* 022737B0 */ if (_t16) goto L_022737B4; else goto L_022737C8;
   L_022737B4: ; // 0x22737b4
@@ -26827,11 +26827,11 @@ void Gambit_fn_02273950(CPUState* cpu) {
         /* 02273950 */ cpu->r[0] = cpu->lr;
         /* 02273954 */ _t0 = cpu->r[1] + 0x00000004u;
         /* 02273954 */ rbrew_write32(cpu->mem, _t0, cpu->r[0]);
-        /* 02273958 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
+        /* 02273958 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
         /* 0227395C */ _t1 = cpu->r[1] + 0xFFFFFFF8u;
         /* 0227395C */ rbrew_write32(cpu->mem, _t1, cpu->r[1]);
         /* 0227395C */ cpu->r[1] = _t1;
-        /* 02273960 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273960 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273960 */ _t3 = _t2 & 0x00000001u;
         /* 02273960 */ if (_t3) goto L_02273964; else goto L_02273978;
   L_02273964: ; // 0x2273964
@@ -26859,7 +26859,7 @@ void Gambit_fn_0227395C(CPUState* cpu) {
         /* 0227395C */ _t0 = cpu->r[1] + 0xFFFFFFF8u;
         /* 0227395C */ rbrew_write32(cpu->mem, _t0, cpu->r[1]);
         /* 0227395C */ cpu->r[1] = _t0;
-        /* 02273960 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273960 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273960 */ _t2 = _t1 & 0x00000001u;
         /* 02273960 */ if (_t2) goto L_02273964; else goto L_02273978;
   L_02273964: ; // 0x2273964
@@ -27024,9 +27024,9 @@ void Gambit_fn_022739EC(CPUState* cpu) {
         /* 02273A70 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t17);
         /* 02273A70 */ cpu->r[4] = _t17;
         /* 02273A74 */ cpu->r[21] = 0x00000000u;
-        /* 02273A78 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[12]);
+        /* 02273A78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[12]));
         /* 02273A7C */ cpu->r[25] = cpu->r[21];
-        /* 02273A80 */ _t18 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273A80 */ _t18 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273A80 */ _t19 = _t18 & 0x00000001u;
         /* 02273A80 */ if (_t19) goto L_02273A84; else goto L_02273AA4;
   L_02273A84: ; // 0x2273a84
@@ -27034,8 +27034,8 @@ void Gambit_fn_022739EC(CPUState* cpu) {
         /* 02273A84 */ cpu->f[6] = rbrew_read_f32(cpu->mem, _t20);
         /* 02273A88 */ _t21 = cpu->r[4] + 0x00000004u;
         /* 02273A88 */ cpu->f[7] = rbrew_read_f32(cpu->mem, _t21);
-        /* 02273A8C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[6], cpu->f[7]);
-        /* 02273A90 */ _t22 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273A8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[6], cpu->f[7]));
+        /* 02273A90 */ _t22 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273A90 */ _t23 = _t22 & 0x00000001u;
         /* 02273A90 */ if (_t23) goto L_02273A94; else goto L_02273AA4;
   L_02273A94: ; // 0x2273a94
@@ -27043,25 +27043,25 @@ void Gambit_fn_022739EC(CPUState* cpu) {
         /* 02273A94 */ cpu->f[9] = rbrew_read_f32(cpu->mem, _t24);
         /* 02273A98 */ _t25 = cpu->r[4] + 0x00000008u;
         /* 02273A98 */ cpu->f[10] = rbrew_read_f32(cpu->mem, _t25);
-        /* 02273A9C */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[9], cpu->f[10]);
-        /* 02273AA0 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273A9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[9], cpu->f[10]));
+        /* 02273AA0 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273AA0 */ _t27 = _t26 & 0x00000001u;
         /* 02273AA0 */ if (_t27) goto L_02273AD4; else goto L_02273AA4;
   L_02273AA4: ; // 0x2273aa4
         /* 02273AA4 */ cpu->r[5] = cpu->r[23] + 0x00000044u;
         /* 02273AA8 */ cpu->r[3] = cpu->r[1] + 0x00000080u;
         /* 02273AAC */ Gambit_fn_021C6DD8(cpu);
-        /* 02273AB0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02273AB4 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273AB0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02273AB4 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273AB4 */ _t29 = _t28 & 0x00000001u;
         /* 02273AB4 */ if (_t29) goto L_02273AB8; else goto L_02273AD0;
   L_02273AB8: ; // 0x2273ab8
         /* 02273AB8 */ _t30 = cpu->r[23] + 0x00000004u;
         /* 02273AB8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t30);
         /* 02273ABC */ cpu->r[19] = 0x00000000u;
-        /* 02273AC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[19], cpu->r[7]);
+        /* 02273AC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[19], cpu->r[7]));
         /* 02273AC4 */ cpu->r[25] = 0x00000001u;
-        /* 02273AC8 */ _t31 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02273AC8 */ _t31 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02273AC8 */ _t32 = _t31 & 0x00000001u;
         /* 02273AC8 */ if (_t32) goto L_02273ACC; else goto L_02273DDC;
   L_02273ACC: ; // 0x2273acc
@@ -27072,8 +27072,8 @@ void Gambit_fn_022739EC(CPUState* cpu) {
         /* 02273AD4 */ _t33 = cpu->r[23] + 0x00000004u;
         /* 02273AD4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t33);
         /* 02273AD8 */ cpu->r[19] = 0x00000000u;
-        /* 02273ADC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[19], cpu->r[7]);
-        /* 02273AE0 */ _t34 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02273ADC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[19], cpu->r[7]));
+        /* 02273AE0 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02273AE0 */ _t35 = _t34 & 0x00000001u;
         /* 02273AE0 */ if (_t35) goto L_02273AE4; else goto L_02273DDC;
   L_02273AE4: ; // 0x2273ae4
@@ -27169,9 +27169,9 @@ void Gambit_fn_022739EC(CPUState* cpu) {
         /* 02273BC4 */ _t68 = cpu->r[23] + 0x00000034u;
         /* 02273BC4 */ cpu->f[28] = rbrew_read_f32(cpu->mem, _t68);
         /* 02273BC8 */ cpu->f[27] = cpu->f[0] - cpu->f[29];
-        /* 02273BCC */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[28], cpu->f[30]);
+        /* 02273BCC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[28], cpu->f[30]));
         /* 02273BD0 */ cpu->f[26] = fma(cpu->f[6], cpu->f[27], cpu->f[13]);
-        /* 02273BD4 */ _t69 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02273BD4 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02273BD4 */ _t70 = _t69 & 0x00000001u;
         /* 02273BD4 */ if (_t70) goto L_02273BD8; else goto L_02273C00;
   L_02273BD8: ; // 0x2273bd8
@@ -27250,8 +27250,8 @@ void Gambit_fn_022739EC(CPUState* cpu) {
         /* 02273CA4 */ _t91 = cpu->r[1] + 0x0000006Cu;
         /* 02273CA4 */ rbrew_write32(cpu->mem, _t91, cpu->r[8]);
         /* 02273CA8 */ Gambit_fn_0204EFD8(cpu);
-        /* 02273CAC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[21], 0x00000000u);
-        /* 02273CB0 */ _t92 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273CAC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[21], 0x00000000u));
+        /* 02273CB0 */ _t92 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273CB0 */ _t93 = _t92 & 0x00000001u;
         /* 02273CB0 */ if (_t93) goto L_02273CF8; else goto L_02273CB4;
   L_02273CB4: ; // 0x2273cb4
@@ -27271,17 +27271,17 @@ void Gambit_fn_022739EC(CPUState* cpu) {
         /* 02273CDC */ /* nop */
         /* 02273CE0 */ cpu->f[10] = cpu->f[12] * cpu->f[10];
         /* 02273CE4 */ /* nop */
-        /* 02273CE8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 02273CE8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 02273CEC */ _t97 = cpu->r[1] + 0x00000020u;
         /* 02273CEC */ rbrew_write_f32(cpu->mem, _t97, cpu->f[10]);
-        /* 02273CF0 */ _t98 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273CF0 */ _t98 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273CF0 */ _t99 = _t98 & 0x00000001u;
         /* 02273CF0 */ if (_t99) goto L_02273D58; else goto L_02273CF4;
   L_02273CF4: ; // 0x2273cf4
         /* 02273CF4 */ goto L_02273D3C;
   L_02273CF8: ; // 0x2273cf8
-        /* 02273CF8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[25], 0x00000000u);
-        /* 02273CFC */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273CF8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[25], 0x00000000u));
+        /* 02273CFC */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273CFC */ _t101 = _t100 & 0x00000001u;
         /* 02273CFC */ if (_t101) goto L_02273D0C; else goto L_02273D00;
   L_02273D00: ; // 0x2273d00
@@ -27303,10 +27303,10 @@ void Gambit_fn_022739EC(CPUState* cpu) {
         /* 02273D24 */ /* nop */
         /* 02273D28 */ cpu->f[10] = cpu->f[12] * cpu->f[10];
         /* 02273D2C */ /* nop */
-        /* 02273D30 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[24], 0x00000000u);
+        /* 02273D30 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[24], 0x00000000u));
         /* 02273D34 */ _t107 = cpu->r[1] + 0x00000020u;
         /* 02273D34 */ rbrew_write_f32(cpu->mem, _t107, cpu->f[10]);
-        /* 02273D38 */ _t108 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273D38 */ _t108 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273D38 */ _t109 = _t108 & 0x00000001u;
         /* 02273D38 */ if (_t109) goto L_02273D58; else goto L_02273D3C;
   L_02273D3C: ; // 0x2273d3c
@@ -27316,8 +27316,8 @@ void Gambit_fn_022739EC(CPUState* cpu) {
         /* 02273D44 */ cpu->f[12] = rbrew_read_f32(cpu->mem, _t110);
         /* 02273D48 */ /* nop */
         /* 02273D4C */ cpu->f[13] = fma(cpu->f[12], cpu->f[10], cpu->f[9]);
-        /* 02273D50 */ cpu->cr[0] = rbrew_cmp_f64(cpu->f[13], cpu->f[30]);
-        /* 02273D54 */ _t111 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 02273D50 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_f64(cpu->f[13], cpu->f[30]));
+        /* 02273D54 */ _t111 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 02273D54 */ _t112 = _t111 & 0x00000001u;
         /* 02273D54 */ if (_t112) goto L_02273D58; else goto L_02273DCC;
   L_02273D58: ; // 0x2273d58
@@ -27326,10 +27326,10 @@ void Gambit_fn_022739EC(CPUState* cpu) {
         /* 02273D5C */ cpu->r[6] = cpu->r[20] + cpu->r[7];
         /* 02273D60 */ _t114 = cpu->r[6] + 0x00000104u;
         /* 02273D60 */ cpu->r[4] = rbrew_read8(cpu->mem, _t114);
-        /* 02273D64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x000000FFu);
+        /* 02273D64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x000000FFu));
         /* 02273D68 */ _t115 = cpu->r[23] + 0x00000040u;
         /* 02273D68 */ cpu->r[5] = rbrew_read8(cpu->mem, _t115);
-        /* 02273D6C */ _t116 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273D6C */ _t116 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273D6C */ _t117 = _t116 & 0x00000001u;
         /* 02273D6C */ if (_t117) goto L_02273DCC; else goto L_02273D70;
   L_02273D70: ; // 0x2273d70
@@ -27337,8 +27337,8 @@ void Gambit_fn_022739EC(CPUState* cpu) {
         /* 02273D74 */ cpu->r[6] = cpu->r[1] + 0x00000024u;
         /* 02273D78 */ cpu->r[3] = cpu->r[20];
         /* 02273D7C */ Gambit_fn_021F000C(cpu);
-        /* 02273D80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02273D84 */ _t118 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273D80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02273D84 */ _t118 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273D84 */ _t119 = _t118 & 0x00000001u;
         /* 02273D84 */ if (_t119) goto L_02273DCC; else goto L_02273D88;
   L_02273D88: ; // 0x2273d88
@@ -27374,8 +27374,8 @@ void Gambit_fn_022739EC(CPUState* cpu) {
         /* 02273DCC */ _t131 = cpu->r[23] + 0x00000004u;
         /* 02273DCC */ cpu->r[4] = rbrew_read32(cpu->mem, _t131);
         /* 02273DD0 */ cpu->r[19] = cpu->r[19] + 0x00000001u;
-        /* 02273DD4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[19], cpu->r[4]);
-        /* 02273DD8 */ _t132 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02273DD4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[19], cpu->r[4]));
+        /* 02273DD8 */ _t132 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02273DD8 */ _t133 = _t132 & 0x00000001u;
         /* 02273DD8 */ if (_t133) goto L_02273B18; else goto L_02273DDC;
   L_02273DDC: ; // 0x2273ddc
@@ -27404,7 +27404,7 @@ void Gambit_fn_022739EC(CPUState* cpu) {
         /* 02273E08 */ cpu->f[26] = rbrew_read_f64(cpu->mem, _t144);
         /* 02273E0C */ _t145 = cpu->r[1] + 0x00000138u;
         /* 02273E0C */ cpu->f[31] = rbrew_read_f64(cpu->mem, _t145);
-        /* 02273E10 */ _t146 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02273E10 */ _t146 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02273E10 */ _t147 = _t146 & 0x00000001u;
         /* 02273E10 */ if (_t147) goto L_02273E14; // else: addr-0 trap, fall-through
   L_02273E14: ; // 0x2273e14
@@ -27485,10 +27485,10 @@ void Gambit_fn_02273E64(CPUState* cpu) {
         /* 02273E6C */ _t1 = cpu->r[3] + 0x00000020u;
         /* 02273E6C */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 02273E70 */ cpu->r[8] = cpu->r[0];
-        /* 02273E74 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 02273E74 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 02273E78 */ _t2 = cpu->r[3] + 0x00000024u;
         /* 02273E78 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 02273E7C */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02273E7C */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02273E7C */ _t4 = _t3 & 0x00000001u;
         /* 02273E7C */ if (_t4) goto L_02273E80; else goto L_02273E98;
   L_02273E80: ; // 0x2273e80
@@ -27496,8 +27496,8 @@ void Gambit_fn_02273E64(CPUState* cpu) {
         /* 02273E84 */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 02273E88 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 02273E88 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 02273E8C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02273E90 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273E8C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02273E90 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273E90 */ _t7 = _t6 & 0x00000001u;
         /* 02273E90 */ if (_t7) goto L_02273E94; else goto L_02273EA4;
   L_02273E94: ; // 0x2273e94
@@ -27505,16 +27505,16 @@ void Gambit_fn_02273E64(CPUState* cpu) {
   L_02273E98: ; // 0x2273e98
         /* 02273E98 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 02273E98 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 02273E9C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02273EA0 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273E9C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02273EA0 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273EA0 */ _t10 = _t9 & 0x00000001u;
         /* 02273EA0 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02273EA0 */ goto L_02273EA4;
   L_02273EA4: ; // 0x2273ea4
-        /* 02273EA4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 02273EA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 02273EA8 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 02273EA8 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 02273EAC */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02273EAC */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02273EAC */ _t13 = _t12 & 0x00000001u;
         /* 02273EAC */ if (_t13) goto L_02273EB0; else goto L_02273EB8;
   L_02273EB0: ; // 0x2273eb0
@@ -27525,11 +27525,11 @@ void Gambit_fn_02273E64(CPUState* cpu) {
         /* 02273EB8 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 02273EBC */ _t15 = cpu->r[12] + 0x00000000u;
         /* 02273EBC */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 02273EC0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02273EC0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02273EC4 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 02273EC4 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 02273EC8 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 02273ECC */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02273ECC */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02273ECC */ _t18 = _t17 & 0x00000001u;
         /* 02273ECC */ if (_t18) goto L_02273EE4; else goto L_02273ED0;
   L_02273ED0: ; // 0x2273ed0
@@ -27556,10 +27556,10 @@ void Gambit_fn_02273EEC(CPUState* cpu) {
         /* 02273EF4 */ _t1 = cpu->r[3] + 0x00000028u;
         /* 02273EF4 */ cpu->r[7] = rbrew_read32(cpu->mem, _t1);
         /* 02273EF8 */ cpu->r[8] = cpu->r[0];
-        /* 02273EFC */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[8], cpu->r[7]);
+        /* 02273EFC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[8], cpu->r[7]));
         /* 02273F00 */ _t2 = cpu->r[3] + 0x0000002Cu;
         /* 02273F00 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 02273F04 */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02273F04 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02273F04 */ _t4 = _t3 & 0x00000001u;
         /* 02273F04 */ if (_t4) goto L_02273F08; else goto L_02273F20;
   L_02273F08: ; // 0x2273f08
@@ -27567,8 +27567,8 @@ void Gambit_fn_02273EEC(CPUState* cpu) {
         /* 02273F0C */ cpu->r[9] = cpu->r[12] + cpu->r[9];
         /* 02273F10 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 02273F10 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 02273F14 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02273F18 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273F14 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02273F18 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273F18 */ _t7 = _t6 & 0x00000001u;
         /* 02273F18 */ if (_t7) goto L_02273F1C; else goto L_02273F2C;
   L_02273F1C: ; // 0x2273f1c
@@ -27576,16 +27576,16 @@ void Gambit_fn_02273EEC(CPUState* cpu) {
   L_02273F20: ; // 0x2273f20
         /* 02273F20 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 02273F20 */ cpu->r[10] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 02273F24 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 02273F28 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273F24 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 02273F28 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273F28 */ _t10 = _t9 & 0x00000001u;
         /* 02273F28 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02273F28 */ goto L_02273F2C;
   L_02273F2C: ; // 0x2273f2c
-        /* 02273F2C */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[7]);
+        /* 02273F2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[7]));
         /* 02273F30 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 02273F30 */ cpu->r[7] = rbrew_read32(cpu->mem, _t11);
-        /* 02273F34 */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02273F34 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02273F34 */ _t13 = _t12 & 0x00000001u;
         /* 02273F34 */ if (_t13) goto L_02273F38; else goto L_02273F40;
   L_02273F38: ; // 0x2273f38
@@ -27596,11 +27596,11 @@ void Gambit_fn_02273EEC(CPUState* cpu) {
         /* 02273F40 */ cpu->r[0] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 02273F44 */ _t15 = cpu->r[12] + 0x00000000u;
         /* 02273F44 */ cpu->r[8] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 02273F48 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02273F48 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02273F4C */ _t16 = cpu->r[12] + 0x00000004u;
         /* 02273F4C */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 02273F50 */ cpu->r[3] = cpu->r[7] + cpu->r[8];
-        /* 02273F54 */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02273F54 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02273F54 */ _t18 = _t17 & 0x00000001u;
         /* 02273F54 */ if (_t18) goto L_02273F6C; else goto L_02273F58;
   L_02273F58: ; // 0x2273f58
@@ -27633,18 +27633,18 @@ void Gambit_fn_02273F74(CPUState* cpu) {
         /* 02273F88 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02273F88 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02273F8C */ cpu->r[12] = 0x00000000u;
-        /* 02273F90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02273F90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02273F94 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 02273F94 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02273F98 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273F98 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273F98 */ _t6 = _t5 & 0x00000001u;
         /* 02273F98 */ if (_t6) goto L_02273FC0; else goto L_02273F9C;
   L_02273F9C: ; // 0x2273f9c
         /* 02273F9C */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02273F9C */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02273FA0 */ /* nop */
-        /* 02273FA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 02273FA8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273FA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 02273FA8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273FA8 */ _t9 = _t8 & 0x00000001u;
         /* 02273FA8 */ if (_t9) goto L_02273FAC; else goto L_02273FC0;
   L_02273FAC: ; // 0x2273fac
@@ -27685,18 +27685,18 @@ void Gambit_fn_02273F78(CPUState* cpu) {
         /* 02273F88 */ _t3 = cpu->r[31] + 0x00000010u;
         /* 02273F88 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
         /* 02273F8C */ cpu->r[12] = 0x00000000u;
-        /* 02273F90 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 02273F90 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 02273F94 */ _t4 = cpu->r[31] + 0x00000011u;
         /* 02273F94 */ rbrew_write8(cpu->mem, _t4, (uint8_t)cpu->r[12]);
-        /* 02273F98 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273F98 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273F98 */ _t6 = _t5 & 0x00000001u;
         /* 02273F98 */ if (_t6) goto L_02273FC0; else goto L_02273F9C;
   L_02273F9C: ; // 0x2273f9c
         /* 02273F9C */ _t7 = cpu->r[31] + 0x0000000Cu;
         /* 02273F9C */ cpu->r[0] = rbrew_read8(cpu->mem, _t7);
         /* 02273FA0 */ /* nop */
-        /* 02273FA4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu);
-        /* 02273FA8 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02273FA4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0xFFFFFFFFu));
+        /* 02273FA8 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02273FA8 */ _t9 = _t8 & 0x00000001u;
         /* 02273FA8 */ if (_t9) goto L_02273FAC; else goto L_02273FC0;
   L_02273FAC: ; // 0x2273fac
@@ -27732,10 +27732,10 @@ void Gambit_fn_02273FE4(CPUState* cpu) {
         /* 02273FEC */ _t1 = cpu->r[3] + 0x00000030u;
         /* 02273FEC */ cpu->r[8] = rbrew_read32(cpu->mem, _t1);
         /* 02273FF0 */ cpu->r[7] = cpu->r[0];
-        /* 02273FF4 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[7], cpu->r[8]);
+        /* 02273FF4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[7], cpu->r[8]));
         /* 02273FF8 */ _t2 = cpu->r[3] + 0x00000034u;
         /* 02273FF8 */ cpu->r[12] = rbrew_read32(cpu->mem, _t2);
-        /* 02273FFC */ _t3 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 02273FFC */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 02273FFC */ _t4 = _t3 & 0x00000001u;
         /* 02273FFC */ if (_t4) goto L_02274000; else goto L_02274018;
   L_02274000: ; // 0x2274000
@@ -27743,8 +27743,8 @@ void Gambit_fn_02273FE4(CPUState* cpu) {
         /* 02274004 */ cpu->r[9] = cpu->r[12] + cpu->r[10];
         /* 02274008 */ _t5 = cpu->r[9] + 0x00000002u;
         /* 02274008 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t5);
-        /* 0227400C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02274010 */ _t6 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227400C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02274010 */ _t6 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274010 */ _t7 = _t6 & 0x00000001u;
         /* 02274010 */ if (_t7) goto L_02274014; else goto L_02274024;
   L_02274014: ; // 0x2274014
@@ -27752,16 +27752,16 @@ void Gambit_fn_02273FE4(CPUState* cpu) {
   L_02274018: ; // 0x2274018
         /* 02274018 */ _t8 = cpu->r[12] + 0x00000002u;
         /* 02274018 */ cpu->r[11] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t8);
-        /* 0227401C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000000u);
-        /* 02274020 */ _t9 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227401C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000000u));
+        /* 02274020 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274020 */ _t10 = _t9 & 0x00000001u;
         /* 02274020 */ if (_t10) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02274020 */ goto L_02274024;
   L_02274024: ; // 0x2274024
-        /* 02274024 */ cpu->cr[0] = rbrew_cmp_u32(cpu->r[0], cpu->r[8]);
+        /* 02274024 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_u32(cpu->r[0], cpu->r[8]));
         /* 02274028 */ _t11 = cpu->r[3] + 0x0000001Cu;
         /* 02274028 */ cpu->r[8] = rbrew_read32(cpu->mem, _t11);
-        /* 0227402C */ _t12 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0227402C */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0227402C */ _t13 = _t12 & 0x00000001u;
         /* 0227402C */ if (_t13) goto L_02274030; else goto L_02274038;
   L_02274030: ; // 0x2274030
@@ -27772,11 +27772,11 @@ void Gambit_fn_02273FE4(CPUState* cpu) {
         /* 02274038 */ cpu->r[7] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t14);
         /* 0227403C */ _t15 = cpu->r[12] + 0x00000000u;
         /* 0227403C */ cpu->r[9] = (uint32_t)(int32_t)(int16_t)rbrew_read16(cpu->mem, _t15);
-        /* 02274040 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
+        /* 02274040 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
         /* 02274044 */ _t16 = cpu->r[12] + 0x00000004u;
         /* 02274044 */ cpu->r[11] = rbrew_read32(cpu->mem, _t16);
         /* 02274048 */ cpu->r[3] = cpu->r[8] + cpu->r[9];
-        /* 0227404C */ _t17 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0227404C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0227404C */ _t18 = _t17 & 0x00000001u;
         /* 0227404C */ if (_t18) goto L_02274064; else goto L_02274050;
   L_02274050: ; // 0x2274050
@@ -27811,9 +27811,9 @@ void Gambit_fn_0227406C(CPUState* cpu) {
         /* 02274084 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 02274084 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 02274088 */ /* nop */
-        /* 0227408C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 0227408C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 02274090 */ cpu->r[31] = cpu->r[4];
-        /* 02274094 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274094 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274094 */ _t6 = _t5 & 0x00000001u;
         /* 02274094 */ if (_t6) goto L_02274098; else goto L_022740AC;
   L_02274098: ; // 0x2274098
@@ -27862,9 +27862,9 @@ void Gambit_fn_02274070(CPUState* cpu) {
         /* 02274084 */ _t4 = cpu->r[30] + 0x0000000Cu;
         /* 02274084 */ cpu->r[12] = rbrew_read8(cpu->mem, _t4);
         /* 02274088 */ /* nop */
-        /* 0227408C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu);
+        /* 0227408C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0xFFFFFFFFu));
         /* 02274090 */ cpu->r[31] = cpu->r[4];
-        /* 02274094 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274094 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274094 */ _t6 = _t5 & 0x00000001u;
         /* 02274094 */ if (_t6) goto L_02274098; else goto L_022740AC;
   L_02274098: ; // 0x2274098
@@ -27907,18 +27907,18 @@ void Gambit_fn_022740E4(CPUState* cpu) {
         /* 022740EC */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 022740EC */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 022740F0 */ cpu->r[31] = cpu->r[3];
-        /* 022740F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 022740F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 022740F4 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 022740F4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 022740F8 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022740F8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022740F8 */ _t4 = _t3 & 0x00000001u;
         /* 022740F8 */ if (_t4) goto L_022740FC; else goto L_0227410C;
   L_022740FC: ; // 0x22740fc
         /* 022740FC */ cpu->r[3] = 0x000001C4u;
         /* 02274100 */ Gambit_fn_02801A78(cpu);
         /* 02274104 */ cpu->r[31] = cpu->r[3];
-        /* 02274104 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02274108 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274104 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02274108 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274108 */ _t6 = _t5 & 0x00000001u;
         /* 02274108 */ if (_t6) goto L_0227418C; else goto L_0227410C;
   L_0227410C: ; // 0x227410c
@@ -27935,29 +27935,29 @@ void Gambit_fn_022740E4(CPUState* cpu) {
         /* 0227412C */ _t9 = cpu->r[31] + 0x00000189u;
         /* 0227412C */ rbrew_write8(cpu->mem, _t9, (uint8_t)cpu->r[10]);
         /* 02274130 */ cpu->r[3] = cpu->r[31] + 0x0000018Cu;
-        /* 02274130 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02274130 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02274134 */ _t10 = cpu->r[31] + 0x00000004u;
         /* 02274134 */ rbrew_write32(cpu->mem, _t10, cpu->r[12]);
-        /* 02274138 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274138 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274138 */ _t12 = _t11 & 0x00000001u;
         /* 02274138 */ if (_t12) goto L_0227413C; else goto L_0227414C;
   L_0227413C: ; // 0x227413c
         /* 0227413C */ cpu->r[3] = 0x0000000Cu;
         /* 02274140 */ Gambit_fn_02801A78(cpu);
-        /* 02274144 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02274148 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02274148 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274148 */ _t14 = _t13 & 0x00000001u;
         /* 02274148 */ if (_t14) goto L_02274178; else goto L_0227414C;
   L_0227414C: ; // 0x227414c
-        /* 0227414C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02274150 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227414C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02274150 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274150 */ _t16 = _t15 & 0x00000001u;
         /* 02274150 */ if (_t16) goto L_02274154; else goto L_02274164;
   L_02274154: ; // 0x2274154
         /* 02274154 */ cpu->r[3] = 0x0000000Cu;
         /* 02274158 */ Gambit_fn_02801A78(cpu);
-        /* 0227415C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02274160 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227415C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02274160 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274160 */ _t18 = _t17 & 0x00000001u;
         /* 02274160 */ if (_t18) goto L_02274178; else goto L_02274164;
   L_02274164: ; // 0x2274164
@@ -27974,7 +27974,7 @@ void Gambit_fn_022740E4(CPUState* cpu) {
         /* 02274178 */ cpu->r[4] = 0x10060000u;
         /* 0227417C */ cpu->r[3] = cpu->r[31] + 0x00000198u;
         /* 02274180 */ cpu->r[4] = cpu->r[4] + 0xFFFF966Cu;
-        /* 02274184 */ _t23 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02274184 */ _t23 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02274184 */ _t24 = _t23 & 0x00000001u;
         /* 02274184 */ if (_t24) goto L_02274188; // else: addr-0 trap, fall-through
   L_02274188: ; // 0x2274188
@@ -28001,18 +28001,18 @@ void Gambit_fn_022740E8(CPUState* cpu) {
         /* 022740EC */ _t1 = cpu->r[1] + 0x0000000Cu;
         /* 022740EC */ rbrew_write32(cpu->mem, _t1, cpu->r[31]);
         /* 022740F0 */ cpu->r[31] = cpu->r[3];
-        /* 022740F0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 022740F0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 022740F4 */ _t2 = cpu->r[1] + 0x00000014u;
         /* 022740F4 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
-        /* 022740F8 */ _t3 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022740F8 */ _t3 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022740F8 */ _t4 = _t3 & 0x00000001u;
         /* 022740F8 */ if (_t4) goto L_022740FC; else goto L_0227410C;
   L_022740FC: ; // 0x22740fc
         /* 022740FC */ cpu->r[3] = 0x000001C4u;
         /* 02274100 */ Gambit_fn_02801A78(cpu);
         /* 02274104 */ cpu->r[31] = cpu->r[3];
-        /* 02274104 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02274108 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274104 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02274108 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274108 */ _t6 = _t5 & 0x00000001u;
         /* 02274108 */ if (_t6) goto L_0227418C; else goto L_0227410C;
   L_0227410C: ; // 0x227410c
@@ -28029,29 +28029,29 @@ void Gambit_fn_022740E8(CPUState* cpu) {
         /* 0227412C */ _t9 = cpu->r[31] + 0x00000189u;
         /* 0227412C */ rbrew_write8(cpu->mem, _t9, (uint8_t)cpu->r[10]);
         /* 02274130 */ cpu->r[3] = cpu->r[31] + 0x0000018Cu;
-        /* 02274130 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02274130 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02274134 */ _t10 = cpu->r[31] + 0x00000004u;
         /* 02274134 */ rbrew_write32(cpu->mem, _t10, cpu->r[12]);
-        /* 02274138 */ _t11 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274138 */ _t11 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274138 */ _t12 = _t11 & 0x00000001u;
         /* 02274138 */ if (_t12) goto L_0227413C; else goto L_0227414C;
   L_0227413C: ; // 0x227413c
         /* 0227413C */ cpu->r[3] = 0x0000000Cu;
         /* 02274140 */ Gambit_fn_02801A78(cpu);
-        /* 02274144 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02274148 */ _t13 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274144 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02274148 */ _t13 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274148 */ _t14 = _t13 & 0x00000001u;
         /* 02274148 */ if (_t14) goto L_02274178; else goto L_0227414C;
   L_0227414C: ; // 0x227414c
-        /* 0227414C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02274150 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227414C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02274150 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274150 */ _t16 = _t15 & 0x00000001u;
         /* 02274150 */ if (_t16) goto L_02274154; else goto L_02274164;
   L_02274154: ; // 0x2274154
         /* 02274154 */ cpu->r[3] = 0x0000000Cu;
         /* 02274158 */ Gambit_fn_02801A78(cpu);
-        /* 0227415C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02274160 */ _t17 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227415C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02274160 */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274160 */ _t18 = _t17 & 0x00000001u;
         /* 02274160 */ if (_t18) goto L_02274178; else goto L_02274164;
   L_02274164: ; // 0x2274164
@@ -28068,7 +28068,7 @@ void Gambit_fn_022740E8(CPUState* cpu) {
         /* 02274178 */ cpu->r[4] = 0x10060000u;
         /* 0227417C */ cpu->r[3] = cpu->r[31] + 0x00000198u;
         /* 02274180 */ cpu->r[4] = cpu->r[4] + 0xFFFF966Cu;
-        /* 02274184 */ _t23 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02274184 */ _t23 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02274184 */ _t24 = _t23 & 0x00000001u;
         /* 02274184 */ if (_t24) goto L_02274188; // else: addr-0 trap, fall-through
   L_02274188: ; // 0x2274188
@@ -28103,7 +28103,7 @@ void Gambit_fn_022741A4(CPUState* cpu) {
         /* 022741C0 */ cpu->r[5] = cpu->r[3];
         /* 022741C4 */ cpu->r[3] = cpu->r[31] + 0x00000198u;
         /* 022741C8 */ cpu->r[4] = cpu->r[4] + 0xFFFF9670u;
-        /* 022741CC */ _t3 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 022741CC */ _t3 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 022741CC */ _t4 = _t3 & 0x00000001u;
         /* 022741CC */ if (_t4) goto L_022741D0; // else: addr-0 trap, fall-through
   L_022741D0: ; // 0x22741d0
@@ -28137,7 +28137,7 @@ void Gambit_fn_022741A8(CPUState* cpu) {
         /* 022741C0 */ cpu->r[5] = cpu->r[3];
         /* 022741C4 */ cpu->r[3] = cpu->r[31] + 0x00000198u;
         /* 022741C8 */ cpu->r[4] = cpu->r[4] + 0xFFFF9670u;
-        /* 022741CC */ _t3 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 022741CC */ _t3 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 022741CC */ _t4 = _t3 & 0x00000001u;
         /* 022741CC */ if (_t4) goto L_022741D0; // else: addr-0 trap, fall-through
   L_022741D0: ; // 0x22741d0
@@ -28169,8 +28169,8 @@ void Gambit_fn_022741F0(CPUState* cpu) {
         /* 02274200 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02274204 */ _t3 = cpu->r[31] + 0x00000188u;
         /* 02274204 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 02274208 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0227420C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0227420C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227420C */ _t5 = _t4 & 0x00000001u;
         /* 0227420C */ if (_t5) goto L_02274258; else goto L_02274210;
   L_02274210: ; // 0x2274210
@@ -28227,8 +28227,8 @@ void Gambit_fn_022741F4(CPUState* cpu) {
         /* 02274200 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02274204 */ _t3 = cpu->r[31] + 0x00000188u;
         /* 02274204 */ cpu->r[0] = rbrew_read8(cpu->mem, _t3);
-        /* 02274208 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0227420C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274208 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0227420C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227420C */ _t5 = _t4 & 0x00000001u;
         /* 0227420C */ if (_t5) goto L_02274258; else goto L_02274210;
   L_02274210: ; // 0x2274210
@@ -28354,15 +28354,15 @@ void Gambit_fn_022742B4(CPUState* cpu) {
         /* 022742C0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 022742C4 */ _t3 = cpu->r[3] + 0x00000184u;
         /* 022742C4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t3);
-        /* 022742C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022742CC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022742C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022742CC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022742CC */ _t5 = _t4 & 0x00000001u;
         /* 022742CC */ if (_t5) goto L_022742EC; else goto L_022742D0;
   L_022742D0: ; // 0x22742d0
         /* 022742D0 */ _t6 = cpu->r[31] + 0x000001ECu;
         /* 022742D0 */ cpu->r[12] = rbrew_read8(cpu->mem, _t6);
-        /* 022742D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022742D8 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022742D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022742D8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022742D8 */ _t8 = _t7 & 0x00000001u;
         /* 022742D8 */ if (_t8) goto L_022742DC; else goto L_022742EC;
   L_022742DC: ; // 0x22742dc
@@ -28395,15 +28395,15 @@ void Gambit_fn_022742B8(CPUState* cpu) {
         /* 022742C0 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 022742C4 */ _t3 = cpu->r[3] + 0x00000184u;
         /* 022742C4 */ cpu->r[31] = rbrew_read32(cpu->mem, _t3);
-        /* 022742C8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 022742CC */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022742C8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 022742CC */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022742CC */ _t5 = _t4 & 0x00000001u;
         /* 022742CC */ if (_t5) goto L_022742EC; else goto L_022742D0;
   L_022742D0: ; // 0x22742d0
         /* 022742D0 */ _t6 = cpu->r[31] + 0x000001ECu;
         /* 022742D0 */ cpu->r[12] = rbrew_read8(cpu->mem, _t6);
-        /* 022742D4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022742D8 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022742D4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022742D8 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022742D8 */ _t8 = _t7 & 0x00000001u;
         /* 022742D8 */ if (_t8) goto L_022742DC; else goto L_022742EC;
   L_022742DC: ; // 0x22742dc
@@ -28488,15 +28488,15 @@ void Gambit_fn_02274334(CPUState* cpu) {
         /* 02274340 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02274344 */ _t3 = cpu->r[3] + 0x00000184u;
         /* 02274344 */ cpu->r[31] = rbrew_read32(cpu->mem, _t3);
-        /* 02274348 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0227434C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274348 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0227434C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227434C */ _t5 = _t4 & 0x00000001u;
         /* 0227434C */ if (_t5) goto L_0227436C; else goto L_02274350;
   L_02274350: ; // 0x2274350
         /* 02274350 */ _t6 = cpu->r[31] + 0x000001ECu;
         /* 02274350 */ cpu->r[12] = rbrew_read8(cpu->mem, _t6);
-        /* 02274354 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02274358 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274354 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02274358 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274358 */ _t8 = _t7 & 0x00000001u;
         /* 02274358 */ if (_t8) goto L_0227436C; else goto L_0227435C;
   L_0227435C: ; // 0x227435c
@@ -28529,15 +28529,15 @@ void Gambit_fn_02274338(CPUState* cpu) {
         /* 02274340 */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02274344 */ _t3 = cpu->r[3] + 0x00000184u;
         /* 02274344 */ cpu->r[31] = rbrew_read32(cpu->mem, _t3);
-        /* 02274348 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 0227434C */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274348 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 0227434C */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227434C */ _t5 = _t4 & 0x00000001u;
         /* 0227434C */ if (_t5) goto L_0227436C; else goto L_02274350;
   L_02274350: ; // 0x2274350
         /* 02274350 */ _t6 = cpu->r[31] + 0x000001ECu;
         /* 02274350 */ cpu->r[12] = rbrew_read8(cpu->mem, _t6);
-        /* 02274354 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02274358 */ _t7 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274354 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02274358 */ _t7 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274358 */ _t8 = _t7 & 0x00000001u;
         /* 02274358 */ if (_t8) goto L_0227436C; else goto L_0227435C;
   L_0227435C: ; // 0x227435c
@@ -28626,8 +28626,8 @@ void Gambit_fn_022743B4(CPUState* cpu) {
         /* 0226FF28 */ _t4 = cpu->r[31] + 0x0000000Cu;
         /* 0226FF28 */ cpu->r[0] = rbrew_read32(cpu->mem, _t4);
         /* 0226FF2C */ cpu->r[10] = rbrew_rlwinm(cpu->r[0], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0226FF2C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[10], 0x00000000u);
-        /* 0226FF30 */ _t5 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FF2C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[10], 0x00000000u));
+        /* 0226FF30 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FF30 */ _t6 = _t5 & 0x00000001u;
         /* 0226FF30 */ if (_t6) goto L_0226FF34; else goto L_0227019C;
   L_0226FF34: ; // 0x226ff34
@@ -28635,19 +28635,19 @@ void Gambit_fn_022743B4(CPUState* cpu) {
         /* 0226FF34 */ cpu->r[12] = rbrew_read32(cpu->mem, _t7);
         /* 0226FF38 */ cpu->r[30] = 0x00000000u;
         /* 0226FF3C */ cpu->r[0] = cpu->r[12] + 0xFFFFFFFFu;
-        /* 0226FF3C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
+        /* 0226FF3C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
         /* 0226FF40 */ _t8 = cpu->r[31] + 0x00000050u;
         /* 0226FF40 */ cpu->r[9] = rbrew_read32(cpu->mem, _t8);
-        /* 0226FF44 */ _t9 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 0226FF44 */ _t9 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 0226FF44 */ _t10 = _t9 & 0x00000001u;
         /* 0226FF44 */ if (_t10) goto L_0226FF48; else goto L_0226FF4C;
   L_0226FF48: ; // 0x226ff48
         /* 0226FF48 */ cpu->r[0] = cpu->r[30];
   L_0226FF4C: ; // 0x226ff4c
-        /* 0226FF4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[9], 0x00000001u);
+        /* 0226FF4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[9], 0x00000001u));
         /* 0226FF50 */ _t11 = cpu->r[31] + 0x000000BCu;
         /* 0226FF50 */ rbrew_write32(cpu->mem, _t11, cpu->r[0]);
-        /* 0226FF54 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FF54 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FF54 */ _t13 = _t12 & 0x00000001u;
         /* 0226FF54 */ if (_t13) goto L_0226FF58; else goto L_02270068;
   L_0226FF58: ; // 0x226ff58
@@ -28656,10 +28656,10 @@ void Gambit_fn_022743B4(CPUState* cpu) {
         /* 0226FF5C */ cpu->r[12] = cpu->r[12] + 0x00000001u;
         /* 0226FF60 */ _t15 = cpu->r[31] + 0x000000B0u;
         /* 0226FF60 */ cpu->r[6] = rbrew_read32(cpu->mem, _t15);
-        /* 0226FF64 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000032u);
+        /* 0226FF64 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000032u));
         /* 0226FF68 */ _t16 = cpu->r[31] + 0x00000054u;
         /* 0226FF68 */ rbrew_write32(cpu->mem, _t16, cpu->r[12]);
-        /* 0226FF6C */ _t17 = cpu->cr[0] >> (0x00000002u & 31u);
+        /* 0226FF6C */ _t17 = rbrew_cr_field(cpu->cr, 0) >> (0x00000002u & 31u);
         /* 0226FF6C */ _t18 = _t17 & 0x00000001u;
         /* 0226FF6C */ if (_t18) goto L_0226FF70; else goto L_0226FF78;
   L_0226FF70: ; // 0x226ff70
@@ -28668,8 +28668,8 @@ void Gambit_fn_022743B4(CPUState* cpu) {
         /* 0226FF74 */ _t20 = cpu->r[31] + 0x00000050u;
         /* 0226FF74 */ cpu->r[5] = rbrew_read32(cpu->mem, _t20);
   L_0226FF78: ; // 0x226ff78
-        /* 0226FF78 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[6], 0x00000000u);
-        /* 0226FF7C */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0226FF78 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[6], 0x00000000u));
+        /* 0226FF7C */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0226FF7C */ _t22 = _t21 & 0x00000001u;
         /* 0226FF7C */ if (_t22) goto L_0227019C; else goto L_0226FF80;
   L_0226FF80: ; // 0x226ff80
@@ -28782,15 +28782,15 @@ void Gambit_fn_022743B4(CPUState* cpu) {
   L_02270068: ; // 0x2270068
         /* 02270068 */ cpu->r[3] = cpu->r[31];
         /* 0227006C */ Gambit_fn_0226FC08(cpu);
-        /* 02270070 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 02270070 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02270074 */ _t66 = cpu->r[31] + 0x000000C8u;
         /* 02270074 */ cpu->r[5] = rbrew_read8(cpu->mem, _t66);
-        /* 02270078 */ _t67 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270078 */ _t67 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270078 */ _t68 = _t67 & 0x00000001u;
         /* 02270078 */ if (_t68) goto L_022700C4; else goto L_0227007C;
   L_0227007C: ; // 0x227007c
-        /* 0227007C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 02270080 */ _t69 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227007C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 02270080 */ _t69 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270080 */ _t70 = _t69 & 0x00000001u;
         /* 02270080 */ if (_t70) goto L_02270084; else goto L_0227019C;
   L_02270084: ; // 0x2270084
@@ -28818,8 +28818,8 @@ void Gambit_fn_022743B4(CPUState* cpu) {
         /* 022700BC */ cpu->r[1] = cpu->r[1] + 0x00000070u;
         /* 022700C0 */ return;
   L_022700C4: ; // 0x22700c4
-        /* 022700C4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[5], 0x00000000u);
-        /* 022700C8 */ _t78 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022700C4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[5], 0x00000000u));
+        /* 022700C8 */ _t78 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022700C8 */ _t79 = _t78 & 0x00000001u;
         /* 022700C8 */ if (_t79) goto L_022700F0; else goto L_022700CC;
   L_022700CC: ; // 0x22700cc
@@ -28839,15 +28839,15 @@ void Gambit_fn_022743B4(CPUState* cpu) {
   L_022700F0: ; // 0x22700f0
         /* 022700F0 */ _t84 = cpu->r[31] + 0x00000070u;
         /* 022700F0 */ cpu->r[4] = rbrew_read32(cpu->mem, _t84);
-        /* 022700F4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 022700F8 */ _t85 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022700F4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 022700F8 */ _t85 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022700F8 */ _t86 = _t85 & 0x00000001u;
         /* 022700F8 */ if (_t86) goto L_02270118; else goto L_022700FC;
   L_022700FC: ; // 0x22700fc
         /* 022700FC */ _t87 = cpu->r[31] + 0x00000074u;
         /* 022700FC */ cpu->r[0] = rbrew_read8(cpu->mem, _t87);
-        /* 02270100 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02270104 */ _t88 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270100 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02270104 */ _t88 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270104 */ _t89 = _t88 & 0x00000001u;
         /* 02270104 */ if (_t89) goto L_02270118; else goto L_02270108;
   L_02270108: ; // 0x2270108
@@ -28858,15 +28858,15 @@ void Gambit_fn_022743B4(CPUState* cpu) {
   L_02270118: ; // 0x2270118
         /* 02270118 */ _t90 = cpu->r[31] + 0x00000088u;
         /* 02270118 */ cpu->r[3] = rbrew_read32(cpu->mem, _t90);
-        /* 0227011C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02270120 */ _t91 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227011C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02270120 */ _t91 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02270120 */ _t92 = _t91 & 0x00000001u;
         /* 02270120 */ if (_t92) goto L_02270134; else goto L_02270124;
   L_02270124: ; // 0x2270124
         /* 02270124 */ _t93 = cpu->r[31] + 0x00000070u;
         /* 02270124 */ cpu->r[4] = rbrew_read32(cpu->mem, _t93);
-        /* 02270128 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[4], 0x00000000u);
-        /* 0227012C */ _t94 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270128 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[4], 0x00000000u));
+        /* 0227012C */ _t94 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227012C */ _t95 = _t94 & 0x00000001u;
         /* 0227012C */ if (_t95) goto L_02270134; else goto L_02270130;
   L_02270130: ; // 0x2270130
@@ -28874,8 +28874,8 @@ void Gambit_fn_022743B4(CPUState* cpu) {
   L_02270134: ; // 0x2270134
         /* 02270134 */ _t96 = cpu->r[31] + 0x0000008Cu;
         /* 02270134 */ cpu->r[3] = rbrew_read32(cpu->mem, _t96);
-        /* 02270138 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0227013C */ _t97 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270138 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0227013C */ _t97 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227013C */ _t98 = _t97 & 0x00000001u;
         /* 0227013C */ if (_t98) goto L_02270144; else goto L_02270140;
   L_02270140: ; // 0x2270140
@@ -28883,8 +28883,8 @@ void Gambit_fn_022743B4(CPUState* cpu) {
   L_02270144: ; // 0x2270144
         /* 02270144 */ _t99 = cpu->r[31] + 0x00000064u;
         /* 02270144 */ cpu->r[3] = rbrew_read32(cpu->mem, _t99);
-        /* 02270148 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0227014C */ _t100 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270148 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0227014C */ _t100 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227014C */ _t101 = _t100 & 0x00000001u;
         /* 0227014C */ if (_t101) goto L_02270154; else goto L_02270150;
   L_02270150: ; // 0x2270150
@@ -28892,8 +28892,8 @@ void Gambit_fn_022743B4(CPUState* cpu) {
   L_02270154: ; // 0x2270154
         /* 02270154 */ _t102 = cpu->r[31] + 0x000000A4u;
         /* 02270154 */ cpu->r[3] = rbrew_read32(cpu->mem, _t102);
-        /* 02270158 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0227015C */ _t103 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270158 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0227015C */ _t103 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227015C */ _t104 = _t103 & 0x00000001u;
         /* 0227015C */ if (_t104) goto L_02270164; else goto L_02270160;
   L_02270160: ; // 0x2270160
@@ -28901,8 +28901,8 @@ void Gambit_fn_022743B4(CPUState* cpu) {
   L_02270164: ; // 0x2270164
         /* 02270164 */ _t105 = cpu->r[31] + 0x000000B0u;
         /* 02270164 */ cpu->r[7] = rbrew_read32(cpu->mem, _t105);
-        /* 02270168 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[7], 0x00000000u);
-        /* 0227016C */ _t106 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02270168 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[7], 0x00000000u));
+        /* 0227016C */ _t106 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227016C */ _t107 = _t106 & 0x00000001u;
         /* 0227016C */ if (_t107) goto L_02270184; else goto L_02270170;
   L_02270170: ; // 0x2270170
@@ -28962,16 +28962,16 @@ void Gambit_fn_022743CC(CPUState* cpu) {
         /* 022743E4 */ _t4 = cpu->r[30] + 0x00000008u;
         /* 022743E4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t4);
         /* 022743E8 */ Gambit_fn_023DFAE8(cpu);
-        /* 022743EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022743F0 */ _t5 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022743EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022743F0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022743F0 */ _t6 = _t5 & 0x00000001u;
         /* 022743F0 */ if (_t6) goto L_02274414; else goto L_022743F4;
   L_022743F4: ; // 0x22743f4
         /* 022743F4 */ cpu->r[3] = 0x101C0000u;
         /* 022743F8 */ _t7 = cpu->r[3] + 0x000060F4u;
         /* 022743F8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 022743FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02274400 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022743FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02274400 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274400 */ _t9 = _t8 & 0x00000001u;
         /* 02274400 */ if (_t9) goto L_0227444C; else goto L_02274404;
   L_02274404: ; // 0x2274404
@@ -28996,8 +28996,8 @@ void Gambit_fn_022743CC(CPUState* cpu) {
         /* 02274434 */ cpu->r[12] = cpu->r[11] + 0xFFFFFFFFu;
         /* 02274438 */ cpu->r[10] = cpu->r[11] - cpu->r[12];
         /* 0227443C */ cpu->r[0] = cpu->r[31] | cpu->r[10];
-        /* 0227443C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02274440 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227443C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02274440 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274440 */ _t16 = _t15 & 0x00000001u;
         /* 02274440 */ if (_t16) goto L_0227444C; else goto L_02274444;
   L_02274444: ; // 0x2274444
@@ -29034,16 +29034,16 @@ void Gambit_fn_022743D0(CPUState* cpu) {
         /* 022743E4 */ _t4 = cpu->r[30] + 0x00000008u;
         /* 022743E4 */ cpu->r[3] = rbrew_read32(cpu->mem, _t4);
         /* 022743E8 */ Gambit_fn_023DFAE8(cpu);
-        /* 022743EC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022743F0 */ _t5 = cpu->cr[0] >> (0x00000003u & 31u);
+        /* 022743EC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022743F0 */ _t5 = rbrew_cr_field(cpu->cr, 0) >> (0x00000003u & 31u);
         /* 022743F0 */ _t6 = _t5 & 0x00000001u;
         /* 022743F0 */ if (_t6) goto L_02274414; else goto L_022743F4;
   L_022743F4: ; // 0x22743f4
         /* 022743F4 */ cpu->r[3] = 0x101C0000u;
         /* 022743F8 */ _t7 = cpu->r[3] + 0x000060F4u;
         /* 022743F8 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 022743FC */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02274400 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022743FC */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02274400 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274400 */ _t9 = _t8 & 0x00000001u;
         /* 02274400 */ if (_t9) goto L_0227444C; else goto L_02274404;
   L_02274404: ; // 0x2274404
@@ -29068,8 +29068,8 @@ void Gambit_fn_022743D0(CPUState* cpu) {
         /* 02274434 */ cpu->r[12] = cpu->r[11] + 0xFFFFFFFFu;
         /* 02274438 */ cpu->r[10] = cpu->r[11] - cpu->r[12];
         /* 0227443C */ cpu->r[0] = cpu->r[31] | cpu->r[10];
-        /* 0227443C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02274440 */ _t15 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227443C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02274440 */ _t15 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274440 */ _t16 = _t15 & 0x00000001u;
         /* 02274440 */ if (_t16) goto L_0227444C; else goto L_02274444;
   L_02274444: ; // 0x2274444
@@ -29139,7 +29139,7 @@ void Gambit_fn_02274464(CPUState* cpu) {
         /* 022744DC */ cpu->r[4] = 0x10060000u;
         /* 022744E0 */ cpu->r[3] = cpu->r[1] + 0x00000018u;
         /* 022744E4 */ cpu->r[4] = cpu->r[4] + 0xFFFF967Cu;
-        /* 022744E8 */ _t12 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 022744E8 */ _t12 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 022744E8 */ _t13 = _t12 & 0x00000001u;
         /* 022744E8 */ if (_t13) goto L_022744EC; // else: addr-0 trap, fall-through
   L_022744EC: ; // 0x22744ec
@@ -29172,8 +29172,8 @@ void Gambit_fn_02274464(CPUState* cpu) {
         /* 02274538 */ cpu->ctr = cpu->r[0];
         /* 0227453C */ cpu->r[3] = cpu->r[31];
         /* 02274540 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02274544 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02274548 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274544 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02274548 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274548 */ _t22 = _t21 & 0x00000001u;
         /* 02274548 */ if (_t22) goto L_02274554; else goto L_0227454C;
   L_0227454C: ; // 0x227454c
@@ -29241,7 +29241,7 @@ void Gambit_fn_02274468(CPUState* cpu) {
         /* 022744DC */ cpu->r[4] = 0x10060000u;
         /* 022744E0 */ cpu->r[3] = cpu->r[1] + 0x00000018u;
         /* 022744E4 */ cpu->r[4] = cpu->r[4] + 0xFFFF967Cu;
-        /* 022744E8 */ _t12 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 022744E8 */ _t12 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 022744E8 */ _t13 = _t12 & 0x00000001u;
         /* 022744E8 */ if (_t13) goto L_022744EC; // else: addr-0 trap, fall-through
   L_022744EC: ; // 0x22744ec
@@ -29274,8 +29274,8 @@ void Gambit_fn_02274468(CPUState* cpu) {
         /* 02274538 */ cpu->ctr = cpu->r[0];
         /* 0227453C */ cpu->r[3] = cpu->r[31];
         /* 02274540 */ rbrew_call_indirect(cpu, cpu->ctr);
-        /* 02274544 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02274548 */ _t21 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274544 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02274548 */ _t21 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274548 */ _t22 = _t21 & 0x00000001u;
         /* 02274548 */ if (_t22) goto L_02274554; else goto L_0227454C;
   L_0227454C: ; // 0x227454c
@@ -29787,15 +29787,15 @@ void Gambit_fn_022747A0(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_022747A0: ; // 0x22747a0
-        /* 022747A0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022747A4 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022747A0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022747A4 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022747A4 */ _t1 = _t0 & 0x00000001u;
         /* 022747A4 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022747A4 */ goto L_022747A8;
   L_022747A8: ; // 0x22747a8
         /* 022747A8 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022747A8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022747AC */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022747A8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022747AC */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022747AC */ _t3 = _t2 & 0x00000001u;
         /* 022747AC */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022747AC */ goto L_022747B0;
@@ -29814,8 +29814,8 @@ void Gambit_fn_022747A0(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -29829,15 +29829,15 @@ void Gambit_fn_022747A0(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -29871,15 +29871,15 @@ void Gambit_fn_022747B8(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_022747B8: ; // 0x22747b8
-        /* 022747B8 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022747BC */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022747B8 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022747BC */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022747BC */ _t1 = _t0 & 0x00000001u;
         /* 022747BC */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022747BC */ goto L_022747C0;
   L_022747C0: ; // 0x22747c0
         /* 022747C0 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022747C0 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022747C4 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022747C0 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022747C4 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022747C4 */ _t3 = _t2 & 0x00000001u;
         /* 022747C4 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022747C4 */ goto L_022747C8;
@@ -29898,8 +29898,8 @@ void Gambit_fn_022747B8(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -29913,15 +29913,15 @@ void Gambit_fn_022747B8(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -29997,7 +29997,7 @@ void Gambit_fn_022747E8(CPUState* cpu) {
         /* 0227481C */ rbrew_write32(cpu->mem, _t12, cpu->r[4]);
         /* 02274820 */ _t13 = cpu->r[1] + 0x00000028u;
         /* 02274820 */ rbrew_write32(cpu->mem, _t13, cpu->r[7]);
-        /* 02274824 */ _t14 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02274824 */ _t14 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02274824 */ _t15 = _t14 & 0x00000001u;
         /* 02274824 */ if (_t15) goto L_02274828; else goto L_02274848;
   L_02274828: ; // 0x2274828
@@ -30019,45 +30019,45 @@ void Gambit_fn_022747E8(CPUState* cpu) {
         /* 02274844 */ rbrew_write_f64(cpu->mem, _t23, cpu->f[1]);
   L_02274848: ; // 0x2274848
         /* 02274848 */ cpu->r[31] = cpu->r[3];
-        /* 02274848 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02274848 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0227484C */ cpu->r[30] = cpu->r[4];
-        /* 02274850 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274850 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274850 */ _t25 = _t24 & 0x00000001u;
         /* 02274850 */ if (_t25) goto L_02274854; else goto L_02274864;
   L_02274854: ; // 0x2274854
         /* 02274854 */ cpu->r[3] = 0x0000008Cu;
         /* 02274858 */ Gambit_fn_02801A78(cpu);
         /* 0227485C */ cpu->r[31] = cpu->r[3];
-        /* 0227485C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02274860 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227485C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02274860 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274860 */ _t27 = _t26 & 0x00000001u;
         /* 02274860 */ if (_t27) goto L_02274928; else goto L_02274864;
   L_02274864: ; // 0x2274864
         /* 02274864 */ cpu->r[29] = cpu->r[31];
-        /* 02274864 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02274868 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274864 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02274868 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274868 */ _t29 = _t28 & 0x00000001u;
         /* 02274868 */ if (_t29) goto L_0227486C; else goto L_0227487C;
   L_0227486C: ; // 0x227486c
         /* 0227486C */ cpu->r[3] = 0x0000008Cu;
         /* 02274870 */ Gambit_fn_02801A78(cpu);
         /* 02274874 */ cpu->r[29] = cpu->r[3];
-        /* 02274874 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02274878 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274874 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02274878 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274878 */ _t31 = _t30 & 0x00000001u;
         /* 02274878 */ if (_t31) goto L_022748EC; else goto L_0227487C;
   L_0227487C: ; // 0x227487c
         /* 0227487C */ cpu->r[3] = cpu->r[29];
-        /* 0227487C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0227487C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02274880 */ cpu->r[28] = 0x10110000u;
-        /* 02274884 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274884 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274884 */ _t33 = _t32 & 0x00000001u;
         /* 02274884 */ if (_t33) goto L_02274888; else goto L_022748B4;
   L_02274888: ; // 0x2274888
         /* 02274888 */ cpu->r[3] = 0x0000000Cu;
         /* 0227488C */ Gambit_fn_02801A78(cpu);
-        /* 02274890 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02274894 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274890 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02274894 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274894 */ _t35 = _t34 & 0x00000001u;
         /* 02274894 */ if (_t35) goto L_02274898; else goto L_022748B4;
   L_02274898: ; // 0x2274898
@@ -30167,7 +30167,7 @@ void Gambit_fn_022747EC(CPUState* cpu) {
         /* 0227481C */ rbrew_write32(cpu->mem, _t12, cpu->r[4]);
         /* 02274820 */ _t13 = cpu->r[1] + 0x00000028u;
         /* 02274820 */ rbrew_write32(cpu->mem, _t13, cpu->r[7]);
-        /* 02274824 */ _t14 = cpu->cr[1] >> (0x00000001u & 31u);
+        /* 02274824 */ _t14 = rbrew_cr_field(cpu->cr, 1) >> (0x00000001u & 31u);
         /* 02274824 */ _t15 = _t14 & 0x00000001u;
         /* 02274824 */ if (_t15) goto L_02274828; else goto L_02274848;
   L_02274828: ; // 0x2274828
@@ -30189,45 +30189,45 @@ void Gambit_fn_022747EC(CPUState* cpu) {
         /* 02274844 */ rbrew_write_f64(cpu->mem, _t23, cpu->f[1]);
   L_02274848: ; // 0x2274848
         /* 02274848 */ cpu->r[31] = cpu->r[3];
-        /* 02274848 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
+        /* 02274848 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
         /* 0227484C */ cpu->r[30] = cpu->r[4];
-        /* 02274850 */ _t24 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274850 */ _t24 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274850 */ _t25 = _t24 & 0x00000001u;
         /* 02274850 */ if (_t25) goto L_02274854; else goto L_02274864;
   L_02274854: ; // 0x2274854
         /* 02274854 */ cpu->r[3] = 0x0000008Cu;
         /* 02274858 */ Gambit_fn_02801A78(cpu);
         /* 0227485C */ cpu->r[31] = cpu->r[3];
-        /* 0227485C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02274860 */ _t26 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227485C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02274860 */ _t26 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274860 */ _t27 = _t26 & 0x00000001u;
         /* 02274860 */ if (_t27) goto L_02274928; else goto L_02274864;
   L_02274864: ; // 0x2274864
         /* 02274864 */ cpu->r[29] = cpu->r[31];
-        /* 02274864 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02274868 */ _t28 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274864 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02274868 */ _t28 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274868 */ _t29 = _t28 & 0x00000001u;
         /* 02274868 */ if (_t29) goto L_0227486C; else goto L_0227487C;
   L_0227486C: ; // 0x227486c
         /* 0227486C */ cpu->r[3] = 0x0000008Cu;
         /* 02274870 */ Gambit_fn_02801A78(cpu);
         /* 02274874 */ cpu->r[29] = cpu->r[3];
-        /* 02274874 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[29], 0x00000000u);
-        /* 02274878 */ _t30 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274874 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[29], 0x00000000u));
+        /* 02274878 */ _t30 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274878 */ _t31 = _t30 & 0x00000001u;
         /* 02274878 */ if (_t31) goto L_022748EC; else goto L_0227487C;
   L_0227487C: ; // 0x227487c
         /* 0227487C */ cpu->r[3] = cpu->r[29];
-        /* 0227487C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
+        /* 0227487C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
         /* 02274880 */ cpu->r[28] = 0x10110000u;
-        /* 02274884 */ _t32 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274884 */ _t32 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274884 */ _t33 = _t32 & 0x00000001u;
         /* 02274884 */ if (_t33) goto L_02274888; else goto L_022748B4;
   L_02274888: ; // 0x2274888
         /* 02274888 */ cpu->r[3] = 0x0000000Cu;
         /* 0227488C */ Gambit_fn_02801A78(cpu);
-        /* 02274890 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02274894 */ _t34 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274890 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02274894 */ _t34 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274894 */ _t35 = _t34 & 0x00000001u;
         /* 02274894 */ if (_t35) goto L_02274898; else goto L_022748B4;
   L_02274898: ; // 0x2274898
@@ -30308,15 +30308,15 @@ void Gambit_fn_0227494C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0227494C: ; // 0x227494c
-        /* 0227494C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02274950 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227494C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02274950 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274950 */ _t1 = _t0 & 0x00000001u;
         /* 02274950 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02274950 */ goto L_02274954;
   L_02274954: ; // 0x2274954
         /* 02274954 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02274954 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02274958 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274954 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02274958 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274958 */ _t3 = _t2 & 0x00000001u;
         /* 02274958 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02274958 */ goto L_0227495C;
@@ -30335,8 +30335,8 @@ void Gambit_fn_0227494C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -30350,15 +30350,15 @@ void Gambit_fn_0227494C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -30386,15 +30386,15 @@ void Gambit_fn_02274960(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02274960: ; // 0x2274960
-        /* 02274960 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02274964 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274960 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02274964 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274964 */ _t1 = _t0 & 0x00000001u;
         /* 02274964 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02274964 */ goto L_02274968;
   L_02274968: ; // 0x2274968
         /* 02274968 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02274968 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 0227496C */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274968 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 0227496C */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227496C */ _t3 = _t2 & 0x00000001u;
         /* 0227496C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0227496C */ goto L_02274970;
@@ -30413,8 +30413,8 @@ void Gambit_fn_02274960(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -30428,15 +30428,15 @@ void Gambit_fn_02274960(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -30464,15 +30464,15 @@ void Gambit_fn_02274974(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02274974: ; // 0x2274974
-        /* 02274974 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02274978 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274974 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02274978 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274978 */ _t1 = _t0 & 0x00000001u;
         /* 02274978 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02274978 */ goto L_0227497C;
   L_0227497C: ; // 0x227497c
         /* 0227497C */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 0227497C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02274980 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227497C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02274980 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274980 */ _t3 = _t2 & 0x00000001u;
         /* 02274980 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02274980 */ goto L_02274984;
@@ -30491,8 +30491,8 @@ void Gambit_fn_02274974(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -30506,15 +30506,15 @@ void Gambit_fn_02274974(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -30542,15 +30542,15 @@ void Gambit_fn_02274988(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_02274988: ; // 0x2274988
-        /* 02274988 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 0227498C */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274988 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 0227498C */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 0227498C */ _t1 = _t0 & 0x00000001u;
         /* 0227498C */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 0227498C */ goto L_02274990;
   L_02274990: ; // 0x2274990
         /* 02274990 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 02274990 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 02274994 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274990 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 02274994 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274994 */ _t3 = _t2 & 0x00000001u;
         /* 02274994 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 02274994 */ goto L_02274998;
@@ -30569,8 +30569,8 @@ void Gambit_fn_02274988(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -30584,15 +30584,15 @@ void Gambit_fn_02274988(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -30620,15 +30620,15 @@ void Gambit_fn_0227499C(CPUState* cpu) {
     uint32_t _t0, _t1, _t2, _t3, _t4, _t5, _t6, _t7, _t8, _t9, _t10, _t11, _t12, _t13, _t14, _t15, _t16, _t17, _t18, _t19;
 
   L_0227499C: ; // 0x227499c
-        /* 0227499C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 022749A0 */ _t0 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 0227499C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 022749A0 */ _t0 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022749A0 */ _t1 = _t0 & 0x00000001u;
         /* 022749A0 */ if (_t1) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022749A0 */ goto L_022749A4;
   L_022749A4: ; // 0x22749a4
         /* 022749A4 */ cpu->r[0] = rbrew_rlwinm(cpu->r[4], 0x00000000u, 0x0000001Fu, 0x0000001Fu);
-        /* 022749A4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[0], 0x00000000u);
-        /* 022749A8 */ _t2 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022749A4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[0], 0x00000000u));
+        /* 022749A8 */ _t2 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022749A8 */ _t3 = _t2 & 0x00000001u;
         /* 022749A8 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
         /* 022749A8 */ goto L_022749AC;
@@ -30647,8 +30647,8 @@ void Gambit_fn_0227499C(CPUState* cpu) {
         /* 02801B44 */ rbrew_write32(cpu->mem, _t6, cpu->r[0]);
         /* 02801B48 */ _t7 = cpu->r[3] + 0xFFFF98F0u;
         /* 02801B48 */ cpu->r[3] = rbrew_read32(cpu->mem, _t7);
-        /* 02801B4C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B50 */ _t8 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B4C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B50 */ _t8 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B50 */ _t9 = _t8 & 0x00000001u;
         /* 02801B50 */ if (_t9) goto L_02801B54; else goto L_02801B70;
   L_02801B54: ; // 0x2801b54
@@ -30662,15 +30662,15 @@ void Gambit_fn_0227499C(CPUState* cpu) {
         /* 02801B68 */ cpu->r[1] = cpu->r[1] + 0x00000010u;
         /* 02801B6C */ return;
   L_02801B70: ; // 0x2801b70
-        /* 02801B70 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[31], 0x00000000u);
-        /* 02801B74 */ _t12 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B70 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[31], 0x00000000u));
+        /* 02801B74 */ _t12 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B74 */ _t13 = _t12 & 0x00000001u;
         /* 02801B74 */ if (_t13) goto L_02801B9C; else goto L_02801B78;
   L_02801B78: ; // 0x2801b78
         /* 02801B78 */ cpu->r[4] = cpu->r[31];
         /* 02801B7C */ Gambit_fn_02826B90(cpu);
-        /* 02801B80 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[3], 0x00000000u);
-        /* 02801B84 */ _t14 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02801B80 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[3], 0x00000000u));
+        /* 02801B84 */ _t14 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02801B84 */ _t15 = _t14 & 0x00000001u;
         /* 02801B84 */ if (_t15) goto L_02801B9C; else goto L_02801B88;
   L_02801B88: ; // 0x2801b88
@@ -30772,8 +30772,8 @@ void Gambit_fn_022749E0(CPUState* cpu) {
   L_022749E0: ; // 0x22749e0
         /* 022749E0 */ _t0 = cpu->r[3] + 0x00000008u;
         /* 022749E0 */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 022749E4 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 022749E8 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 022749E4 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 022749E8 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 022749E8 */ _t2 = _t1 & 0x00000001u;
         /* 022749E8 */ if (_t2) goto L_022749F4; else goto L_022749EC;
   L_022749EC: ; // 0x22749ec
@@ -30791,8 +30791,8 @@ void Gambit_fn_022749FC(CPUState* cpu) {
   L_022749FC: ; // 0x22749fc
         /* 022749FC */ _t0 = cpu->r[3] + 0x00000008u;
         /* 022749FC */ cpu->r[12] = rbrew_read32(cpu->mem, _t0);
-        /* 02274A00 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02274A04 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274A00 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02274A04 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274A04 */ _t2 = _t1 & 0x00000001u;
         /* 02274A04 */ if (_t2) goto L_02274A10; else goto L_02274A08;
   L_02274A08: ; // 0x2274a08
@@ -30811,8 +30811,8 @@ void Gambit_fn_02274A18(CPUState* cpu) {
         /* 02274A18 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02274A18 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02274A1C */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Fu, 0x0000001Fu, 0x0000001Fu);
-        /* 02274A1C */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02274A20 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274A1C */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02274A20 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274A20 */ _t2 = _t1 & 0x00000001u;
         /* 02274A20 */ _t3 = _t2 ^ 0x00000001u;
         /* 02274A20 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -30834,8 +30834,8 @@ void Gambit_fn_02274A34(CPUState* cpu) {
         /* 02274A34 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02274A34 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02274A38 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Du, 0x0000001Fu, 0x0000001Fu);
-        /* 02274A38 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02274A3C */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274A38 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02274A3C */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274A3C */ _t2 = _t1 & 0x00000001u;
         /* 02274A3C */ _t3 = _t2 ^ 0x00000001u;
         /* 02274A3C */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -30857,8 +30857,8 @@ void Gambit_fn_02274A50(CPUState* cpu) {
         /* 02274A50 */ _t0 = cpu->r[3] + 0x0000000Cu;
         /* 02274A50 */ cpu->r[0] = rbrew_read32(cpu->mem, _t0);
         /* 02274A54 */ cpu->r[12] = rbrew_rlwinm(cpu->r[0], 0x0000001Au, 0x0000001Fu, 0x0000001Fu);
-        /* 02274A54 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[12], 0x00000000u);
-        /* 02274A58 */ _t1 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274A54 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[12], 0x00000000u));
+        /* 02274A58 */ _t1 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274A58 */ _t2 = _t1 & 0x00000001u;
         /* 02274A58 */ _t3 = _t2 ^ 0x00000001u;
         /* 02274A58 */ if (_t3) { rbrew_dispatch(cpu, cpu->lr); return; }
@@ -30901,8 +30901,8 @@ void Gambit_fn_02274A7C(CPUState* cpu) {
         /* 02274A8C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02274A90 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02274A90 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02274A94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02274A98 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274A94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02274A98 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274A98 */ _t5 = _t4 & 0x00000001u;
         /* 02274A98 */ if (_t5) goto L_02274A9C; else goto L_02274AB8;
   L_02274A9C: ; // 0x2274a9c
@@ -30941,8 +30941,8 @@ void Gambit_fn_02274A80(CPUState* cpu) {
         /* 02274A8C */ rbrew_write32(cpu->mem, _t2, cpu->r[0]);
         /* 02274A90 */ _t3 = cpu->r[31] + 0x0000001Cu;
         /* 02274A90 */ cpu->r[11] = rbrew_read32(cpu->mem, _t3);
-        /* 02274A94 */ cpu->cr[0] = rbrew_cmp_s32(cpu->r[11], 0x00000003u);
-        /* 02274A98 */ _t4 = cpu->cr[0] >> (0x00000001u & 31u);
+        /* 02274A94 */ cpu->cr = rbrew_cr_insert(cpu->cr, 0, rbrew_cmp_s32(cpu->r[11], 0x00000003u));
+        /* 02274A98 */ _t4 = rbrew_cr_field(cpu->cr, 0) >> (0x00000001u & 31u);
         /* 02274A98 */ _t5 = _t4 & 0x00000001u;
         /* 02274A98 */ if (_t5) goto L_02274A9C; else goto L_02274AB8;
   L_02274A9C: ; // 0x2274a9c